@@ -0,0 +1,9159 @@
+/**
+  ******************************************************************************
+  * @file    assets_argb8888.h
+  * @brief   LCD asset pack, 292160 bytes.
+  *          Generated by Tools/lcd_assets.py, do not edit.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ASSETS_ARGB8888_H
+#define __ASSETS_ARGB8888_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define ASSET_IMAGE_320X240                      0U
+#define ASSET_LIFE_AUGMENTED                     1U
+
+ALIGN_32BYTES(const uint32_t assets_argb8888[73040]) =
+{
+0x4144434C, 0x00020001, 0x00047540, 0x00000000, 0x00000000, 0x00000060, 0x0002EB8D, 0x00F00140,
+0x00000500, 0x00010200, 0x00000000, 0x00000000, 0x00000001, 0x0002EC00, 0x0001893C, 0x00F00140,
+0x00000500, 0x00010200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x25488844, 0x400004FF, 0xFF264989, 0x8A450004, 0x04FF274A, 0x254B8700, 0x254B8AFF, 0x00048CFF,
+0x264C8D42, 0x910004FF, 0x4D90FF25, 0x4E90FF26, 0x44000425, 0xFF264F91, 0x93BF0004, 0x94FF264E,
+0x95FF274F, 0x00042850, 0x51967D06, 0x5097FF29, 0x7100042A, 0xFF2B5198, 0x042A5298, 0x539B4000,
+0x0004FF2B, 0x2A549C48, 0x400004FF, 0xFF2B559D, 0x9BB20004, 0x9CFF2854, 0x9FFF2955, 0x00042A56,
+0xFF285743, 0x4F00049F, 0xFF2958A0, 0x44010004, 0xFF2A59A1, 0xA3400004, 0x04FF2959, 0x5AA44F00,
+0x0004FF2A, 0x5BA54405, 0x0004FF2B, 0x2B5BA740, 0x400004FF, 0xFF2C5CA8, 0xA64F0004, 0x04FF2C5C,
+0xA7440D00, 0x04FF2D5D, 0x5FA84900, 0x0004FF2D, 0xFF2E5E4B, 0x530004A8, 0xFF2F5FA9, 0x4A0004AB,
+0xFF2E5EAA, 0x2D920004, 0x2D5EAAFF, 0x2E5FABFF, 0x604F0004, 0x04ABFF2C, 0xAC481800, 0x04FF2D61,
+0x003C0F00, 0x002C080D, 0x39000C0C, 0x4C2E62AD, 0x00100000, 0x08000408, 0x18080030, 0x000C0900,
+0xFF2D634F, 0x100004AD, 0x2C62AC35, 0xAE360028, 0x000C2E64, 0xFF2D624F, 0x280004AE, 0x2E63AF4F,
+0x090004FF, 0x0D005C0F, 0x0C003C0C, 0x20040030, 0x00180C00, 0x4F00100E, 0x62AEFF2E, 0x44030004,
+0xFF2D61AD, 0x24040004, 0x00100400, 0x2F60AD4F, 0x0A0004FF, 0x4301F000, 0xACFF2C60, 0xF0080004,
+0x5FAA3101, 0x0002442B, 0x040F0250, 0xA9400100, 0x04FF2C5D, 0x5CA84F00, 0x0004FF2B, 0x102C1107,
+0x03140003, 0x2A5AA64F, 0x010004FF, 0x2959A544, 0x410004FF, 0xFF2858A4, 0x57430004, 0x04A2FF29,
+0x03A40800, 0x0403BC04, 0x9E400008, 0x04FF2955, 0x549D4000, 0x0004FF28, 0x27539C48, 0x790004FF,
+0xFF2A529A, 0x04295199, 0x50984400, 0x0004FF28, 0x28509648, 0x100004FF, 0x07049495, 0xFC000004,
+0x04F40004, 0x05000404, 0x4AA104F8, 0x4B8BFF27, 0x4C8BFF28, 0x02000426, 0xF80404F0, 0xFF267004,
+0xFF274D8E, 0x0004FC8E, 0x4E250004, 0x0004F825, 0x92310500, 0x04FC2750, 0x0905000F, 0x0004FC00,
+0x00080004, 0x04F80105, 0x5204FC00, 0x99FF2B51, 0x00000453, 0x040204FC, 0x00291900, 0x050C0405,
+0x1905000F, 0x0804F404, 0xFC0F0008, 0xE8001904, 0x04F40004, 0x04000408, 0x080F04D8, 0xE4050D00,
+0x05000F04, 0x04F80008, 0x04000404, 0x080E0500, 0x04F80300, 0x1405000F, 0x0F048408, 0x0935000C,
+0x623F04C0, 0x0010FF2E, 0x04FC0F2A, 0x04EC000C, 0x40000408, 0xFF2F65AF, 0x14040004, 0x04600400,
+0x9900080F, 0x0004FC0E, 0xFC0F05C4, 0xF00C0304, 0x00100404, 0x01000800, 0x000F0504, 0x4C003005,
+0x05000407, 0x00000C00, 0x10040004, 0x00080000, 0x0F050400, 0x04050004, 0x0000030C, 0x00040C05,
+0x00050C00, 0x08000014, 0x00040400, 0x40050804, 0xFF2A58A5, 0x04000004, 0x05000F05, 0x08D80409,
+0x00050400, 0x04000004, 0x00040805, 0x00041C00, 0x04080504, 0x05100800, 0x0404FC08, 0x0408000C,
+0x04F80F05, 0x04FC0006, 0xE8284B23, 0x04F80C09, 0x3104FC02, 0x00274E8F, 0x4E91440A, 0x0004FF27,
+0x284F9240, 0x4F0004FF, 0xFF295095, 0x40010004, 0xFF2A5196, 0xF8040004, 0x04F40804, 0x04000C00,
+0x9C4A04F8, 0x04FF2C54, 0x0A000A00, 0x00050004, 0x2C000114, 0x01440806, 0x08000C08, 0x0C0404EC,
+0x5AA24400, 0x0004FF2B, 0x0109F40F, 0x0009EC04, 0xF4000008, 0x00040804, 0x2D5DA948, 0x0C0004FF,
+0xE80504F8, 0x09D40C04, 0xFF2E606A, 0xFC2E60A9, 0x2D5F3409, 0x0404F0FF, 0x7C000008, 0x00040802,
+0x0C60AC20, 0x04F40A0A, 0x04001400, 0xD0080004, 0x000C0007, 0x1904E40F, 0x1104B80F, 0x0F005004,
+0x4C11002C, 0xFF2F63AE, 0x380F0004, 0xB8040D00, 0x04140C04, 0x0C001804, 0xB0400008, 0x04FF2F64,
+0x00180400, 0x0F000C00, 0x04090004, 0x080F0028, 0x3C0F0500, 0x1C0F0900, 0x4C080500, 0x00240800,
+0x0F001808, 0x0415000C, 0x300C00F8, 0x04E00000, 0x0D00040F, 0x40050000, 0xFF3061AE, 0x040D0004,
+0x0A34070A, 0x04002800, 0xD0040A00, 0x022C0001, 0x00000400, 0x70080248, 0x000C0402, 0x0F04F800,
+0x0F010004, 0x0A010508, 0x18020A1C, 0x04F8000D, 0x04000400, 0x080004F8, 0x04FC0500, 0x400A1007,
+0xFF2A58A3, 0x08000004, 0x00040405, 0xC456A127, 0x2B57220D, 0xE0030DD8, 0x03F0000D, 0x00000408,
+0x04080500, 0x05080800, 0x0F000C00, 0x080D0A08, 0x0C0009F0, 0x09F40100, 0x0004FC03, 0xF804000C,
+0x09F00209, 0x6004F800, 0x4E8FFF27, 0x04FCFF28, 0x0C000400, 0x934004F8, 0x04FF2950, 0x04E40000,
+0x0500040F, 0x2B529740, 0x0004ECFF, 0x99490004, 0x04FF2C52, 0x2B534700, 0x04FC9AFF, 0x2D559D42,
+0x020004FF, 0xF4000EF0, 0x0004050E, 0x21011400, 0x0EE42857, 0x0F04DC04, 0x04090008, 0x080804F4,
+0x05000400, 0x0C04EC00, 0xF8000004, 0x04E00C04, 0x0004FC08, 0xF00F000C, 0x18040504, 0x04D80400,
+0x0F04FC00, 0x29020004, 0x05042F5F, 0x04028004, 0xA0000008, 0x00040F02, 0x0CE0000A, 0x1400040F,
+0x0D048C0F, 0x2500200F, 0x0F04F40C, 0x0C190010, 0x100F03F8, 0xA0083D00, 0x000C0F04, 0x65B13121,
+0x0F057030, 0x0C21003C, 0xDC0F0034, 0x2F461B00, 0x0463AFFF, 0x050C0400, 0x04001404, 0xFC000010,
+0x00040F04, 0x0F4C0702, 0x04050000, 0x00040004, 0x00080005, 0x04050000, 0x080C0268, 0x04FC0F00,
+0x00140001, 0x0105000F, 0x0200140A, 0x18000820, 0x0500000A, 0x00000400, 0x040404FC, 0x05040C00,
+0x0804FC00, 0x04040004, 0x08C40405, 0x000A0004, 0xF8080008, 0x000C0404, 0x29539B31, 0x04041320,
+0x04F40005, 0x04000408, 0x97100A0C, 0x5129136C, 0x000F0C29, 0xF4000A10, 0x00040804, 0x0004F400,
+0xF8040004, 0x00080404, 0x0013E801, 0x4D2D0EEC, 0x0009EC26, 0x942009F0, 0x0213E84F, 0xF80809F4,
+0x04EC0004, 0x00000400, 0x040804EC, 0x04F40400, 0x0400B804, 0xF4060008, 0x09F00209, 0x2C569E49,
+0x470004FF, 0x9EFF2B57, 0x28040004, 0x04F80F01, 0x5BA34419, 0x0004FF2C, 0x2C5AA544, 0x450004FF,
+0xFF2D5BA6, 0x5C250004, 0x0813B42C, 0xF4000504, 0x13900804, 0x0D04E804, 0xE8030008, 0x04F4080E,
+0x2F61AA4C, 0x040004FF, 0x800C0020, 0x00100002, 0x0204F80F, 0x0C04EC0F, 0x2504C40F, 0x0500380F,
+0x0D04CC0F, 0x0F003800, 0x0F0D0024, 0x04090020, 0x1C0C0424, 0x00180404, 0x8100080F, 0x0F051400,
+0x0F090004, 0x082D00B4, 0x4C00010C, 0x00100200, 0x08050C06, 0x0C080504, 0x05140500, 0x0404FC07,
+0x00040014, 0x01B00005, 0x00000400, 0x04000500, 0x05040100, 0x0016400F, 0x03141C01, 0x0C000018,
+0x00040800, 0x2A5EA945, 0x030004FF, 0x040A1424, 0x0A040005, 0x19172800, 0x4614382A, 0xFF2A5BA7,
+0x20000004, 0x302B1500, 0x59A43114, 0x040A082B, 0x0808050C, 0x0DE00005, 0x04000404, 0x080404F8,
+0x539D4000, 0x0004FF29, 0x5B050802, 0x529AFF29, 0x20000428, 0x0510FF2A, 0x04050004, 0x96400008,
+0x04FF294F, 0x04FC0F00, 0x05000401, 0x0409F408, 0xF00F0500, 0xEC000509, 0x04F80F0E, 0x04FC0001,
+0x04000400, 0xF80404FC, 0x00080004, 0x2D539A3B, 0xF4060EE4, 0x09E4040E, 0x0004FC09, 0xFC07050C,
+0x05080004, 0x0D05000F, 0x0409EC04, 0x080404F0, 0x5CA44000, 0x0004FF2D, 0x6504F005, 0xA7FF2D5B,
+0x00042E5C, 0x0304D00D, 0xFC080ED0, 0x000C0004, 0x0F00280C, 0x0C0509F0, 0x100404F8, 0x05000400,
+0x0204EC0F, 0xFF2F603D, 0x00030018, 0x02C40005, 0x2900040F, 0x0904940F, 0x39001C0F, 0x3064AF4F,
+0x090004FF, 0x0F03E000, 0x00090004, 0x200F03FC, 0x1C0F0900, 0xF80F5D00, 0x1C0F0904, 0xB00F1100,
+0xE8042500, 0x64B02004, 0x30190A90, 0x1C040A1C, 0x00080000, 0x0404F004, 0x140C0008, 0x02340800,
+0x0C050000, 0x100F0004, 0x18080505, 0x050C0800, 0x050A140F, 0x020F140A, 0xFC061940, 0x05080004,
+0x0C05000E, 0x0C000504, 0x03E00405, 0x00000804, 0x04080A08, 0x549E4000, 0x0004FF2A, 0x04131004,
+0x08040508, 0x04FC0000, 0x04000400, 0x08001D50, 0x05040100, 0x001D7803, 0x040804EC, 0x4C8C4000,
+0x0004FF29, 0x0C04FC04, 0xD40004F8, 0x00040018, 0x081DD804, 0x0C0404F4, 0x04F00000, 0x00000404,
+0xEC0004F8, 0x00040504, 0x000EE003, 0x04000EE4, 0x0EDC0200, 0x0A0EE400, 0xF8050EE0, 0x04F00B04,
+0x2C58A149, 0x030004FF, 0xE8041DCC, 0x00080C04, 0x0104F000, 0xA80B04E8, 0x09D4051D, 0x4304F408,
+0xA8FF2F5D, 0xC8050004, 0x0EA00D04, 0x06139000, 0xC0040004, 0x00080F04, 0x04E80405, 0x0500080F,
+0x08028008, 0x0C0F029C, 0xAC0F1500, 0x900F2104, 0x1C0F0904, 0xA4031E00, 0x0398040D, 0x1F00080F,
+0x0F13D002, 0x0F050418, 0x0F0D0500, 0x040D0474, 0x280F0058, 0x200F0D00, 0xB4047900, 0x00080000,
+0x00009800, 0x040F0008, 0x1C080100, 0x04E80001, 0x0900040F, 0x00051004, 0x5C0F0230, 0x90080902,
+0x000C0C02, 0x08050408, 0x1009000C, 0x2B5F3005, 0x040010FF, 0x08080A10, 0x05000A05, 0x00050400,
+0x080A0004, 0x0F280005, 0x000F2400, 0x040804FC, 0x0DE00000, 0x00050404, 0x9E400008, 0x04FF2958,
+0x050C0900, 0x0C295521, 0x22100022, 0x00051000, 0xFC000504, 0x00040904, 0xFF2B5165, 0x742B519A,
+0x04FC0422, 0x0804F400, 0xE4020004, 0xEC281513, 0x09F8000E, 0x060EE802, 0xC00022D4, 0x04F40F1D,
+0x04FC0401, 0x05000800, 0xE80304F8, 0x04F40013, 0x15000404, 0x0613DC9B, 0xF8050500, 0x09EC0004,
+0x03000400, 0x9F400500, 0x04FF2C58, 0x04FC0000, 0x2D59A245, 0x030004FF, 0xE80018CC, 0x00040F04,
+0x04FC0001, 0x05000400, 0x8C0304F0, 0x09B80422, 0x0409F400, 0x080004F4, 0x5EA94100, 0x0004FF30,
+0x0404F80B, 0x90040510, 0x60AC401D, 0x0004FF30, 0x0504D80F, 0x1100180F, 0x0F053400, 0x0001028C,
+0x040F02A4, 0x2C000100, 0x00180F00, 0x00140F01, 0x04C80F01, 0x09A80F1E, 0x00500F0C, 0x04F00F05,
+0x65B1440D, 0x0004FF31, 0x01002C0F, 0x0003E000, 0xE00C0004, 0x00140003, 0x00000400, 0x08000018,
+0x66B24000, 0x0004FF31, 0x04000C00, 0x100C0004, 0x00180400, 0x1100080F, 0x0F003C00, 0x0F1D0004,
+0x0F110058, 0x00310024, 0x040400F4, 0x00500400, 0x08001004, 0x000F0008, 0x1C041905, 0x022C0405,
+0x04024C00, 0x140C0004, 0x04F80000, 0x00001C04, 0x0408000C, 0x04F80800, 0x00000C00, 0x0800001C,
+0x04F40000, 0x12000409, 0x0425A85E, 0x08000508, 0x050C0800, 0x00000C04, 0x04041420, 0x04FC0000,
+0x08000404, 0x0C0004FC, 0x05000F00, 0x050C0011, 0x0004FC01, 0x54300508, 0x0500FF2A, 0x00135804,
+0x08010008, 0x05000B05, 0x0404F404, 0xF80509F0, 0x284D5204, 0xCC4D91FF, 0x04F8021D, 0x2013E004,
+0x04F8FF28, 0x000A4401, 0xD0041450, 0x2B52301D, 0x0004F0FF, 0x040809F0, 0x1DD00400, 0x0604F404,
+0xF40009F0, 0xDC2D1A04, 0xDC561B13, 0x09EC0809, 0x0009E803, 0x04000108, 0x09E80400, 0x0504F40F,
+0x0018BC00, 0xF80F0004, 0x00040504, 0x00080005, 0x0C04DC04, 0x1C000008, 0x60AA4800, 0x0004FF30,
+0x0404F400, 0xAD7D0004, 0xADFF3161, 0x00043061, 0x040EB408, 0x140F0020, 0x1C000100, 0x027C0400,
+0x1500080F, 0x35048808, 0x5C3165B0, 0x000C000E, 0x08000400, 0x0C000020, 0x00140000, 0x00005C04,
+0x0400000C, 0x00180000, 0x08000400, 0x1000000C, 0x00040F00, 0x00380415, 0x00005800, 0x940803A0,
+0x00100003, 0x04000404, 0x10040018, 0x00080C00, 0x0C002000, 0x100F0014, 0x34080D00, 0x04C00F00,
+0x00540815, 0x0000340C, 0x140C001C, 0x00100F00, 0x66B14F59, 0x0004FF2E, 0x65B04001, 0x0004FF2D,
+0x0400A000, 0xFC000004, 0x00040F00, 0x05100009, 0x08000400, 0x10000024, 0x00040200, 0x00144002,
+0x040F01B4, 0xF0040100, 0x00080404, 0x0004D800, 0x10000004, 0x00080000, 0x0100040F, 0x0004F800,
+0x08000018, 0x00040C00, 0x21050C09, 0x28482B5F, 0x0105040F, 0x2C5BA940, 0x040004FF, 0x08040504,
+0x1C980400, 0x00000804, 0xF80003F0, 0x00040003, 0x080A0000, 0x1C040004, 0x00080114, 0x211D1400,
+0x28342A56, 0x00142400, 0x04000A08, 0x05000000, 0x01000400, 0x52210504, 0x000A042A, 0x00010A08,
+0x27CC0105, 0x001DD804, 0x28521DDC, 0x294E92FF, 0xD00D0004, 0x05000E22, 0x0404F800, 0xFC000004,
+0x09F40904, 0x080EF007, 0x9E3D09F0, 0x04FC2E56, 0x2D579F3A, 0x000F0EDC, 0x08000005, 0x00040401,
+0x0004FC0C, 0x040409E8, 0x04FC0000, 0x08000400, 0xD0000500, 0x00040404, 0x0004EC04, 0x0C040010,
+0x00080000, 0x0004EC00, 0x04040008, 0x00100000, 0x04000408, 0x080404FC, 0x04C40000, 0x2100040F,
+0x3162AE41, 0x0F0004FF, 0x00002234, 0x8C0402A0, 0x000C0804, 0x0F001404, 0x04010008, 0x1C080494,
+0x00140000, 0x04000400, 0x0C000014, 0x00040000, 0x40001004, 0xFF3266B1, 0x040F0010, 0x38081D00,
+0x039C0400, 0x00000808, 0x100C0440, 0x00140800, 0x00000C00, 0x24080004, 0x000C0400, 0x0F001800,
+0x0F090004, 0x0F150028, 0x0F090044, 0x3155001C, 0xB43267B3, 0x00700F0A, 0x2F674F0A, 0x0004B2FF,
+0x0AF80309, 0x04004400, 0x080F00FC, 0xF4080100, 0x000C0404, 0x04002800, 0x7C04000C, 0x01FC040B,
+0x0F025800, 0x00010004, 0x040C04F0, 0x04E40000, 0x0100040F, 0x0004F400, 0x08000018, 0x00040F00,
+0x05080505, 0x1E185E10, 0x002D500E, 0x040004FC, 0x04F80400, 0x04000804, 0x0008218C, 0x03F80005,
+0x08050000, 0x08040004, 0x04FC0105, 0x0330F800, 0x0C000500, 0x0004000A, 0x0204FC00, 0x2C150004,
+0x04011E28, 0x0A080305, 0x0009F002, 0x040204FC, 0x0EE80400, 0x0009F400, 0xD8000004, 0x00040818,
+0x0009F804, 0x4C000008, 0x04F00014, 0x0C000404, 0xFC0004F8, 0x09F80609, 0x0C13E002, 0xA11F0EE0,
+0x000404F4, 0x040F00EC, 0xA3440100, 0x04FF2B5B, 0xD4A41F00, 0xE4030513, 0x04FC040E, 0x0804E400,
+0xDC040004, 0x00080004, 0x00001800, 0x04000008, 0x04E80800, 0x07000C05, 0xAB2A1DB4, 0x0009EC62,
+0xFC0F09D4, 0xE4010D04, 0x04EC0004, 0x0404E80B, 0x080F0288, 0xD0042500, 0x04BC0802, 0x08004C08,
+0x0C000018, 0x001C0000, 0x08000800, 0xC8010004, 0x30664F04, 0x0004B0FF, 0x67B14F08, 0x0004FF31,
+0x68B23531, 0x09004832, 0xE007000C, 0x03E40003, 0x0000040C, 0x04040444, 0x001C0800, 0x0F001405,
+0x0F09043C, 0x4404001C, 0xFF3068B3, 0x7C080004, 0x00140404, 0x0F000800, 0x00050018, 0x040F001C,
+0x300F0100, 0x18080500, 0x000C0F00, 0x0A28092D, 0xFF306530, 0x540004E0, 0x00180900, 0x030A5004,
+0x24000020, 0x00040000, 0x00050804, 0x040F0208, 0x100F0500, 0x14000105, 0x05100C00, 0x00001000,
+0x040F04F8, 0x18041100, 0x19280005, 0x00000404, 0x04080A08, 0x0F0C0400, 0x00000802, 0x54061E3C,
+0x05000432, 0x0400080C, 0x0C04041C, 0x05080405, 0x04000805, 0x55652838, 0x559FFF2B, 0x00313C2B,
+0x04080A04, 0x27C40000, 0x13000404, 0x0009EC90, 0xC40004F8, 0x00040027, 0x0404FC00, 0x080013E4,
+0x04F80500, 0x0936A003, 0x523004F4, 0x1DD4FF2C, 0x21000401, 0x27C82C54, 0x0009F400, 0xF8040004,
+0x09E40004, 0x00000408, 0x040413D0, 0x13D40500, 0x0F13E000, 0x200613D8, 0x04F8FF2B, 0x00000404,
+0x040F04C0, 0xD0000100, 0x00040004, 0x00001C08, 0x04040010, 0x04E00400, 0x0400100C, 0x08040018,
+0x04F40000, 0x23000404, 0x09B463AC, 0x0EF8621F, 0x050C0003, 0x0004F005, 0x040804F4, 0x05000700,
+0x0502800F, 0x0F049C08, 0x050D000C, 0x65291354, 0x0409C431, 0x4000005C, 0x04E00000, 0x00000400,
+0x0400000C, 0x000C0000, 0x0F00040C, 0x000904FC, 0xFC0F001C, 0xE0002104, 0x00040004, 0x00003C04,
+0x0400000C, 0x00100F00, 0x04D40401, 0x0F04D004, 0x001D0008, 0x04040400, 0x04980000, 0x04000C04,
+0x14000008, 0x00040F00, 0x69B43565, 0x0F056831, 0x04050084, 0x080F00A8, 0xF0011900, 0x04E00304,
+0x01003808, 0x00070018, 0x015C0005, 0x0804FC00, 0x08000004, 0x00040802, 0x0C023004, 0xF8000008,
+0x00040804, 0x0C04F400, 0x00000004, 0x00140005, 0x04000800, 0x10000004, 0x00040000, 0x00001004,
+0x04010008, 0x34B00305, 0x04050404, 0x08040008, 0x04FC0205, 0x021E2800, 0x40040500, 0x0A080428,
+0x00000808, 0x0004050C, 0x00080005, 0x0205040F, 0xFF2B5740, 0x030504A0, 0x50000500, 0x0A080C22,
+0x00050800, 0x040836AC, 0x04F40000, 0x00000400, 0x040C04EC, 0x0EE40000, 0x0409EC04, 0x00040008,
+0x04F40105, 0xF42D5325, 0x13E80404, 0x0004F804, 0xF8010008, 0x2C586504, 0x2D59A0FF, 0xF4090004,
+0x04F80304, 0x000ED80C, 0x00040010, 0x0ED40001, 0x00000404, 0xE00809E0, 0x000C0004, 0x0F04D004,
+0x04050008, 0x080404D8, 0x04DC0000, 0x0018AC0C, 0x040C0014, 0x04FC0000, 0x08000400, 0xF00F04E0,
+0xAF350504, 0x13983263, 0x04025804, 0x1004024C, 0x00080000, 0x08028808, 0xA408000C, 0x00180404,
+0x20001404, 0x0D5466B2, 0x04000406, 0x08000454, 0x04B00000, 0x00000404, 0x74080010, 0x00100004,
+0x00000408, 0x040F001C, 0x34081100, 0x000C0F00, 0x004C0F09, 0x00340005, 0x00001C04, 0x0400000C,
+0x00100800, 0x0F000C04, 0x4F270008, 0x68B2FF30, 0x101B0004, 0x050498B3, 0x2F9F0004, 0x2F69B3FF,
+0x306AB4FF, 0x30630004, 0x28FF3169, 0x00040F05, 0x05440F11, 0x05040011, 0x0C051408, 0x20040504,
+0x02580502, 0x051AA003, 0x60030C50, 0x00100C23, 0x08194004, 0x54010008, 0x2F632D1E, 0xF4003900,
+0x0D1C0004, 0x002AC404, 0x040C0008, 0x05000400, 0x0E000800, 0x08000504, 0x00040205, 0x0003EC04,
+0x04040008, 0x05000004, 0x03000405, 0x04042838, 0x00080405, 0x0804FC00, 0x00000004, 0x00040005,
+0x02050402, 0x0C002C5C, 0x04FC0900, 0xBC285121, 0xD4941B31, 0x04F80018, 0x00000404, 0xF40404F8,
+0x00080004, 0x7004F805, 0x9BFF2D53, 0xECFF2E54, 0x00040009, 0x0213E002, 0xF80113E4, 0x2D573004,
+0x080008FF, 0x0C0004FC, 0x05000800, 0x2E5AA335, 0xC8042C98, 0x00080413, 0x04010000, 0xF8000004,
+0x00040404, 0x0804F400, 0xF80C0004, 0x04E80404, 0x45000808, 0xFF3161AB, 0x623C0004, 0x04ECFF30,
+0x0000100C, 0x040404F8, 0x05000800, 0x01000C00, 0xF00004EC, 0x00040704, 0x3364B035, 0xE8000994,
+0x00040C04, 0x00027C04, 0xD8040008, 0x00080F04, 0x67B24C01, 0x0018FF33, 0x3367B348, 0x0C0004FF,
+0x60000438, 0x00040004, 0x0F00180C, 0x0F250010, 0x4F09004C, 0xFF3369B3, 0x0F0D0058, 0x0F090040,
+0x0409001C, 0x64080058, 0x000C0000, 0x06000404, 0x312A0020, 0x0204D0FF, 0x14040010, 0x001C0F05,
+0x00140401, 0x326AB43F, 0x3F0E04F4, 0x24316BB5, 0x3C0F0E00, 0x38000105, 0x00040F00, 0x04F80F11,
+0x00240C11, 0x1105080F, 0x0B050405, 0x74001060, 0x05040101, 0x040C3803, 0x08080C48, 0x04FC0800,
+0x08001800, 0x0C040010, 0x05080400, 0x0007D804, 0x040809F4, 0x05000000, 0x0C00040C, 0x10000504,
+0x05000000, 0x04000400, 0x080C0504, 0x03E80400, 0x0003FC04, 0xFC050504, 0x2A5A2104, 0x380030BC,
+0x04F80428, 0x08000805, 0x5816183C, 0x04003144, 0x00040005, 0x0004FC00, 0xCC000004, 0x00040027,
+0x1227D006, 0x401DE029, 0x97FF2A52, 0x534F0EE4, 0x0498FF2C, 0xE0040800, 0x04F40013, 0x40000400,
+0xFF2E569C, 0xF0000004, 0x00040009, 0x0104F400, 0xF80B0004, 0x04FC0009, 0x00000400, 0xF8080500,
+0x09EC0004, 0x0004F404, 0x00040008, 0x00080801, 0x0404F001, 0xA80F3160, 0x08040422, 0x04F80F05,
+0x09BC0005, 0x00000400, 0xF00C04D8, 0x00100004, 0x00001800, 0xAD480004, 0x04FF3064, 0x04CC0C00,
+0x01050000, 0xF40004F0, 0x00040304, 0x3465B135, 0xE40004B8, 0x00040F04, 0x04D80501, 0x03002C00,
+0xB2400004, 0xF4FF3566, 0x00040F04, 0x04F40801, 0x00000C08, 0x14040408, 0x00080004, 0x04001000,
+0x10040004, 0x00080000, 0x08000400, 0x10080018, 0x00180400, 0x0500080F, 0x0F002C00, 0x00050004,
+0x1C0C0034, 0x00140800, 0x0C000C0C, 0x3C0C0010, 0x00100F00, 0x6AB4400D, 0x0004FF34, 0x02002804,
+0xC80004C4, 0x00040604, 0x0F04E004, 0x0A050008, 0xF8020034, 0x04AC0F09, 0x00240F11, 0x053C0D41,
+0x100A100F, 0x04050008, 0x14080040, 0x000C0900, 0xFF326738, 0x00001054, 0x00040105, 0xA4326621,
+0x0C500802, 0x0C04EC00, 0x20000004, 0x00140400, 0x0404FC04, 0x04010008, 0x30642205, 0xEC083DF4,
+0x12200F11, 0x050C0C00, 0x08001008, 0x0C000508, 0x00040805, 0x04357000, 0x14000004, 0x0004000F,
+0x00192404, 0xBC040008, 0x05040035, 0x00000400, 0x04010F10, 0x4C591200, 0x0460001D, 0x40136001,
+0xA0FF2D57, 0x56212750, 0x004A382C, 0x04000504, 0x04FC0800, 0x01050400, 0xFC0522DC, 0xFC2B1F04,
+0x18000A04, 0x04F40005, 0x2B569B35, 0xFC0009F8, 0x00040004, 0x0304F401, 0x0C0109F4, 0x05000F00,
+0x04FC0104, 0x0809F80F, 0x0304F80D, 0x3C003188, 0x00040027, 0x0F04E008, 0x0501000C, 0xF40809E8,
+0x22B80709, 0x0C04EC00, 0xF8000004, 0x00040004, 0x3264AD79, 0x3165AEFF, 0xCC080004, 0x04C40004,
+0x0204FC0F, 0x0304D000, 0x30080260, 0x000C0000, 0x00003400, 0xE4040004, 0x000C0004, 0x0F000400,
+0x440104FC, 0xFF3468B3, 0xB4100004, 0xFC0B000C, 0x05080009, 0x04045008, 0x08080414, 0x00200800,
+0x00000C00, 0x20040004, 0x000C0800, 0x0C001404, 0x240F0008, 0x880A0900, 0x04980A04, 0x0C004800,
+0x14000020, 0x00040000, 0x00001808, 0x04040010, 0x00180000, 0x0300040F, 0x0004DC00, 0x32930060,
+0x356BB5FF, 0x336BB5FF, 0x9C000504, 0x001C0009, 0x0400040E, 0xEC0A04FC, 0x00280E04, 0x0F044000,
+0x0F4104D8, 0x4F260054, 0xB5FF326A, 0x04100004, 0x68000A14, 0x00C40000, 0x08001004, 0x140104FC,
+0x33685000, 0x3468B4FF, 0x0508020C, 0x0101D000, 0x5C030004, 0x04E0000C, 0x020F2400, 0x58060008,
+0x00100811, 0x04050004, 0x000C0008, 0x08140005, 0x0F0D0C00, 0x00010004, 0x040F0864, 0x08040900,
+0x05040005, 0x0000040C, 0xFC040508, 0x00080404, 0x08050000, 0xC0000004, 0x05040435, 0x00000800,
+0x04000940, 0x04F80000, 0x00000408, 0x000F1D68, 0xD8020305, 0x13EC0027, 0x000EE404, 0xDC000008,
+0x00040004, 0x0F000C04, 0x6F060EEC, 0x9CFF2B56, 0x22CC2B58, 0x04F80002, 0x2E58A040, 0x410004FF,
+0xFF2E58A2, 0xE4000004, 0x2D593413, 0x0004F8FF, 0x040800C0, 0x04F00800, 0x01000C00, 0xF40409EC,
+0x09EC0704, 0x0004EC04, 0x0C0409E8, 0x00080F00, 0x04DC0C01, 0x00001000, 0x040404DC, 0x01B40C00,
+0x0F09D000, 0x03020004, 0xC4002C20, 0x00040F04, 0x04C80005, 0x0400040C, 0x740104E8, 0x32682F02,
+0x01060E30, 0x693404E8, 0x040CFF33, 0x04003004, 0x08000010, 0x00140400, 0x00000804, 0x38010014,
+0x051C0000, 0x01003C07, 0x100F0018, 0x50023600, 0x04500F0E, 0x00240F11, 0x04900F11, 0x04A40F0F,
+0x0E840100, 0xB4FF323C, 0x280F0008, 0x4C081004, 0x6BB64804, 0x0004FF33, 0x01001C00, 0x58000054,
+0x00040700, 0x326CB54F, 0x150004FF, 0x326CB644, 0x400004FF, 0xFF336DB7, 0x10040004, 0x049C0000,
+0x0F000C04, 0x00010008, 0x04000020, 0x001C0800, 0x0F001000, 0x04110004, 0x2C080034, 0x05080100,
+0x0314C804, 0xE4010A48, 0x14EC0000, 0x000A0803, 0x0404050C, 0x0A180500, 0x2A1F1000, 0x05283267,
+0x050F380C, 0x80024208, 0x050C0C37, 0x0F051405, 0x040C0A10, 0x080404F0, 0x03900000, 0x0C000400,
+0xD80003BC, 0x00040403, 0x00040400, 0x0408040C, 0x05040800, 0x030A0801, 0x040053A4, 0x0004000A,
+0x000A0401, 0x70031D44, 0x0E6C0004, 0x00314000, 0x04080E94, 0x04F80000, 0x00000400, 0x040004E8,
+0x04F40000, 0x00000400, 0x0400000C, 0x000C0000, 0x08000400, 0x0C0013E8, 0x13EC0400, 0x2C579C31,
+0x5C000500, 0x00040100, 0x0009F407, 0xA14004F8, 0x04FF2F59, 0x59A34100, 0x0004FF2F, 0x0709EC00,
+0xFC090004, 0x368C0004, 0x0422BC0F, 0x00010C04, 0x2C080008, 0x00100401, 0x0509E80F, 0x08015C00,
+0xF8040004, 0x09DC0004, 0x08000400, 0xF80C0500, 0x09DC0904, 0x00113003, 0xE40C04FC, 0x00100C04,
+0x2604F405, 0x0ED03367, 0x0804FC0F, 0x0C04D000, 0x140004B4, 0x00040000, 0x0D00180C, 0xFC000010,
+0x00040004, 0x2C04F00F, 0x0309780F, 0x135C341D, 0x2204C00F, 0x0F136801, 0x0F0004D8, 0x0F110018,
+0x08000498, 0xE00004B4, 0x00040F03, 0x04FC0C15, 0x0F003801, 0x041404EC, 0x180C0074, 0x04880405,
+0x08000800, 0x100004FC, 0x00040F00, 0x04D40425, 0x04004000, 0x080F000C, 0x1C0B1E00, 0x04F40406,
+0x0400080C, 0x2C010A30, 0x0528070A, 0x00051C00, 0x08000A18, 0x00040000, 0x02000C00, 0xD0061E48,
+0x05040033, 0x0404F804, 0x0C000008, 0x0004010A, 0xE0326321, 0x0354002A, 0x0F036404, 0x04010A08,
+0xD408039C, 0x000C0003, 0x0003D800, 0x0C040004, 0x05040C00, 0x000A1000, 0x08040504, 0x14200500,
+0x0044D003, 0x04000A04, 0x0A040400, 0x00050000, 0x94000004, 0x05000009, 0x00000800, 0xE4080004,
+0x04E80004, 0x00000406, 0x2A1131D0, 0xE40C5488, 0x0EF40013, 0x000EE400, 0x4C010004, 0x0EDC0000,
+0x0009E803, 0x040404F4, 0x04F80000, 0x04000404, 0xA44109F0, 0x04FF2F5B, 0x40800300, 0x0013E400,
+0xA5400004, 0x04FF2E5D, 0x36840000, 0x0F000401, 0x040009F4, 0x14000110, 0x00040C01, 0x44050008,
+0xFF3262AC, 0x60040004, 0x04F80401, 0x00000800, 0x040004F8, 0x65AE4000, 0x01A0FF33, 0x05000408,
+0xF00304F4, 0x04DC0C04, 0x0F001008, 0x030204E8, 0xA80404F4, 0x04C40004, 0x04000408, 0x080F0018,
+0x980F1500, 0x180F0504, 0x800F1F00, 0xA4032404, 0x09DC0004, 0x0D04FC0F, 0x000E9800, 0x28080004,
+0x00100000, 0x08000400, 0x0C000014, 0x00140000, 0x0200040F, 0x1404900F, 0x316DB540, 0x000004FF,
+0x040F0424, 0x6D472A00, 0x04B6FF33, 0x04E00C00, 0x0F006400, 0x31050004, 0x84326EB6, 0x00200800,
+0x316DB648, 0x440004FF, 0xFF326EB7, 0x18080004, 0x000C0000, 0x00001800, 0x380000BC, 0x00040405,
+0x0F001000, 0x00150004, 0x2C0F0514, 0xE4010D00, 0x326A2105, 0x0C000AF8, 0x04E80400, 0x3F050800,
+0x7C3469B5, 0x1401021E, 0x0A300B05, 0x00050400, 0x08000004, 0x00040005, 0x00050C02, 0x100B2884,
+0x03380305, 0x00050401, 0x18070D34, 0x0508041C, 0x00000808, 0xA4040390, 0x21880903, 0x18306021,
+0x03E8004E, 0x0003F800, 0x04000004, 0x00040805, 0x000A1000, 0x04004484, 0x000C0005, 0x04000400,
+0x54000508, 0x00040004, 0x00050400, 0xA1400004, 0x04FF2E5A, 0x05040100, 0x003B4C03, 0xF00609B0,
+0x18E80C04, 0x0213FC00, 0x00004F8C, 0x04F40005, 0x00000404, 0x040004F8, 0x589D2200, 0x48001DD4,
+0x04F40400, 0x04000804, 0xA24004F8, 0x04FF305A, 0x04F40100, 0x2104FC04, 0x04EC2F5B, 0x0804F000,
+0xA6220004, 0x0840805E, 0x00003B80, 0x00040F01, 0x04F00401, 0x00001C00, 0xF004000C, 0x00080804,
+0x3363AD40, 0x040160FF, 0xF4000004, 0x00040404, 0x0004FC00, 0xFC000004, 0x04F40504, 0x0018C003,
+0xE8080010, 0x000C0804, 0x0A04F40F, 0x04098800, 0x900F0004, 0xC8041409, 0x05100C04, 0x0F001804,
+0x02050008, 0x35111308, 0x240F1308, 0x180A0500, 0x05000F00, 0x04880F07, 0x336B2102, 0x1C001368,
+0x04B00000, 0x00000404, 0x04040010, 0x00140F00, 0x001C0401, 0x00000800, 0x08000020, 0x00040F00,
+0x05000F1A, 0x045C0440, 0x0100080F, 0x0404FC08, 0x0408000C, 0x04E40005, 0x0900040F, 0x2904FC09,
+0x04FC326E, 0x0004E404, 0x040004E8, 0x00100000, 0x00000404, 0x04000010, 0x04C00000, 0x0000980C,
+0x04000014, 0x00180F00, 0x001C0005, 0x1600040F, 0x000FF40F, 0x00050800, 0xB63504FC, 0x146C356A,
+0x03051805, 0x20000F38, 0x00040F05, 0x05040001, 0x00000400, 0x04020504, 0x14340A00, 0x080D2000,
+0x60000004, 0x00040C03, 0x0005000C, 0x040403A0, 0x00080405, 0x0003D800, 0xDC000004, 0x00080003,
+0x08050000, 0x08040004, 0x05000F05, 0x0504000D, 0x00000400, 0x040004FC, 0x05000000, 0x0F000408,
+0x71010500, 0xFF2D5499, 0x042C5499, 0x04FC0400, 0x0104F000, 0x57300004, 0x04F8FF2C, 0x32000400,
+0xD42E599E, 0x09FC0322, 0x0804F404, 0xFC000008, 0x00040004, 0x35050008, 0x00305CA5, 0x04F40005,
+0x40000404, 0xFF305FA7, 0xA84C0004, 0x04FF3160, 0x61A94000, 0x0004FF31, 0x0F011000, 0x05010004,
+0x632F04F8, 0x0604F431, 0x0204FC0A, 0xAC0818D8, 0x04E80801, 0x0F000C00, 0x040904EC, 0xB80C001C,
+0x00100F04, 0x04940A0D, 0x0017D402, 0x040F0428, 0x54041D00, 0x00380F04, 0x0030051D, 0x040E5803,
+0x080D0048, 0x04880F00, 0x00280715, 0x0104400F, 0x0C044C08, 0x3000000C, 0x00140C00, 0x01001008,
+0xE8040020, 0x045C0009, 0x04000407, 0x9C0F0478, 0x20040504, 0x00080000, 0x0500240F, 0x0900180F,
+0x00003800, 0x240F0004, 0x1C0F0900, 0x50011D00, 0x0A200300, 0x0004FC00, 0x10000004, 0x00080005,
+0x0F000408, 0x0C010014, 0x24000020, 0x00040F00, 0x1498030A, 0x09054400, 0x100F052C, 0x30070505,
+0x050C080F, 0x010A0C00, 0x48030010, 0x05140019, 0x04050000, 0x04020004, 0x429C0205, 0x00000C00,
+0x54080338, 0x000C0C03, 0x00050C08, 0x10000508, 0x00080000, 0x00000400, 0x08040F20, 0x05080000,
+0x000A1000, 0x04000008, 0x05040000, 0x04000408, 0x0804050C, 0x09FC0005, 0x01000404, 0xCC030A04,
+0x04FC0053, 0x00000400, 0x04000A04, 0x05040C00, 0x0205000C, 0x2D4204FC, 0x04559AFF, 0x09F40000,
+0x6A04F801, 0x9DFF2E56, 0x04FC2F57, 0xDC2F5A21, 0x09F40018, 0x0404F408, 0xF800000C, 0x00040404,
+0x01050004, 0x5C3C04FC, 0x04F4FF30, 0x0004F800, 0xF8040004, 0x61A94A04, 0x0004FF32, 0x05050002,
+0xE40304E8, 0x050C000E, 0x0F001404, 0x000109F0, 0x040F09E4, 0x31330300, 0x1DA4AFFF, 0x0401B400,
+0xD8040004, 0x00080F04, 0x18700505, 0x0C09E80F, 0x0004E80E, 0x040E04EC, 0x04780D00, 0x0F097807,
+0x0511001C, 0xC00004D0, 0x003C0F02, 0x00200F00, 0x04B80406, 0x0000340F, 0x03007801, 0x84010020,
+0x000C0304, 0x00049C00, 0x04040010, 0x00100C00, 0x08001804, 0x24000008, 0x00040C00, 0x0500200F,
+0x05001808, 0xF407000C, 0x04700F04, 0x04540001, 0x1500040F, 0x0000400C, 0x140C0038, 0x00100F00,
+0x6FB7401D, 0x0004FF33, 0x00003808, 0x04080010, 0x001C0900, 0x080F1007, 0xB81004D4, 0x1C0F0048,
+0x180F0000, 0x3C040500, 0x05040F00, 0x05000306, 0x346EB839, 0xB7401994, 0x04FF346C, 0x150C0800,
+0x01000C04, 0x48000A18, 0x00040702, 0x0004FC01, 0x00070A14, 0x05040005, 0x04000400, 0x08040504,
+0x05000400, 0x0C034C00, 0x100504F8, 0x0D640300, 0x0804F800, 0xF8000004, 0x00040804, 0x0904F400,
+0xC0070004, 0x05080421, 0x04050404, 0x0C090008, 0x184C0005, 0x13545C12, 0x00050000, 0x00040004,
+0x05040805, 0x0604F004, 0x2C110008, 0xF40404FC, 0x18E00104, 0x0009F40B, 0x440009F8, 0x04E80000,
+0x5304FC02, 0x5AA2FF31, 0x02000432, 0xF8000EF0, 0x5BA34404, 0x04F0FF31, 0x0C000804, 0xF00404F8,
+0x00080804, 0x4204F808, 0xFF3362AA, 0x324E0004, 0x0462AAFF, 0x0B3C0000, 0x04000400, 0x080409DC,
+0x04F40E00, 0x0009F002, 0x040004F4, 0x01A40000, 0x0C000404, 0xE40904EC, 0x0EC80F04, 0x04E80F0C,
+0x044C010D, 0x0504640F, 0x1000180F, 0x346CB644, 0x0F0004FF, 0x0702004C, 0x680C049C, 0x00100F04,
+0x04680511, 0x0F130407, 0x0F0A0014, 0x080C0490, 0x0C0403EC, 0x04680000, 0x04000400, 0x080F0010,
+0x40041100, 0x002C0F04, 0x306F4F0E, 0x0004B6FF, 0x00D00729, 0x08007404, 0x5C0F0008, 0xB7410500,
+0x04FF3170, 0x04B80000, 0x0000040F, 0x3470B840, 0x080004FF, 0x0C0F004C, 0x6E300200, 0x04E4FF32,
+0x00000408, 0x100804DC, 0x000C0F00, 0x002C0009, 0x1500040F, 0x03052C01, 0x14040518, 0x0A200C0A,
+0x00145400, 0x140F0004, 0x28000905, 0x05180C05, 0x07050405, 0x68083DE8, 0x036C0428, 0x08000804,
+0x08040510, 0x05000805, 0x00000C00, 0x04090A10, 0x30AC0705, 0x2F61A875, 0x2E60A7FF, 0x040C499C,
+0x050C0405, 0x00136004, 0x04080500, 0x050C0000, 0x40000400, 0xFF2E559A, 0x00000004, 0x00080005,
+0x0809F804, 0xEC000500, 0x0004000E, 0x0404F800, 0x00000004, 0x5BA22005, 0xFC081DDC, 0x05040004,
+0x00050002, 0x040004FC, 0x04F80400, 0x31000800, 0xF8315DA6, 0x09E80009, 0x08000404, 0x0C0004F8,
+0x04FC0800, 0x02000C00, 0x040004FC, 0x04FC0E05, 0x00051000, 0x040004FC, 0x04F80000, 0x4004F408,
+0xFF3466AF, 0x14060004, 0x09F00200, 0x1304FC00, 0x0C18A4B0, 0x100004F8, 0x04FC0900, 0x09B0681E,
+0x0404F00C, 0x080F1388, 0x48060700, 0x04C00813, 0x0104D40F, 0x0100140F, 0x356DB740, 0x040004FF,
+0x0800001C, 0x00480900, 0x1504B80F, 0x1800280F, 0x0834B710, 0x0D000403, 0x3007050C, 0x049C0004,
+0x0003D400, 0x040F0008, 0x1C0F0100, 0x300C0900, 0x002C0000, 0x0100040F, 0x0C00280C, 0x84010010,
+0x048C0404, 0x2000080F, 0x0C005004, 0xBC00007C, 0x00040004, 0x0500600F, 0x3271B841, 0x0F0004FF,
+0x000404E8, 0x040F003C, 0x70040900, 0x04DC0400, 0x3470B940, 0x040004FF, 0x08040010, 0x04DC0400,
+0x0F001004, 0x04110008, 0x080F0034, 0xF8040100, 0x00080004, 0x0404FC00, 0x10000004, 0x00040900,
+0x0F0F280B, 0x00050510, 0x04080A08, 0x1BEC0800, 0x00050008, 0x0404035C, 0x05040900, 0x1C84641E,
+0x0004FC00, 0x000F0004, 0x14001905, 0x05040F0A, 0x09700001, 0x04050404, 0x08040008, 0x05000805,
+0x000EE800, 0xF8040004, 0x0EEC0104, 0xFF2F5734, 0xE80004F0, 0x00040109, 0x032D5800, 0x0400194C,
+0x59A14005, 0x0004FF31, 0x0409F000, 0xF8000004, 0x5CA34004, 0x0004FF30, 0x0004F800, 0x88000004,
+0x00040000, 0x0404F804, 0xF40F0008, 0xF0020704, 0x63AB4004, 0x0004FF33, 0x0004EC00, 0x0C000004,
+0x00040800, 0x2004E006, 0x000CFF33, 0x0204F400, 0x32110004, 0xF0000EE0, 0x00040004, 0x0C017C04,
+0xB00F0008, 0x20040D13, 0x04F80C00, 0x08001004, 0x0C0F048C, 0x80040100, 0x001C080E, 0x0404C400,
+0xA4040004, 0x04680D09, 0x1804B00F, 0x0A003C0F, 0x070D5400, 0xF00408A0, 0x00080003, 0x0D038400,
+0xE00F003C, 0x28000004, 0x00040400, 0x08003800, 0xE4000004, 0x001C0003, 0x00001408, 0x04040010,
+0x00200400, 0x0D001004, 0xB4030008, 0x00280004, 0x08000400, 0x10000020, 0x00580000, 0x08001408,
+0x2000000C, 0x04840100, 0x8C327122, 0x004C0309, 0x0004B404, 0x0C00001C, 0x00080000, 0x00000404,
+0x04040010, 0x00140000, 0x08005000, 0x54010064, 0x04D40300, 0x04000C01, 0x640B04E8, 0x003C0000,
+0x3372B931, 0x280109E4, 0x00340800, 0x4C000C07, 0xFF3571B9, 0x30080004, 0x04F40000, 0x1D00040F,
+0x08050408, 0x1808003C, 0x000C0F00, 0x05140C05, 0x040F2004, 0x08000508, 0x05080400, 0x04000C08,
+0x08000500, 0x0A000000, 0x00000408, 0x28000A0C, 0x00040014, 0x04050000, 0x0C000334, 0x00040C00,
+0x0004FC04, 0x04000008, 0x2344000A, 0x00000400, 0x040F000C, 0xD8000100, 0x08E00008, 0x0C00040C,
+0x00000A18, 0x00040005, 0x04050404, 0xA6480008, 0x04FF2E5E, 0x5DA54200, 0x0004FF2D, 0x63002E11,
+0x0209F402, 0xFC0D3BB8, 0x30582504, 0xEC000500, 0x0004010E, 0x0004FC03, 0x040009FC, 0x00140000,
+0x0004F804, 0xFC080008, 0x05000004, 0x2109F401, 0x18D8315D, 0x0004F408, 0x040004F8, 0x09E40000,
+0x06000404, 0xF00609EC, 0x04EC0409, 0x4004FC08, 0xFF3464AC, 0x1C000004, 0x04F40000, 0x02000404,
+0xF80204F8, 0x04F40009, 0x00000400, 0x040009EC, 0x04F80000, 0x0109DC0C, 0xE00B0010, 0x04D8040E,
+0x0100080F, 0x0309E40F, 0x0309E00F, 0x0404F004, 0x080F04E8, 0x00000500, 0x04840D05, 0x1804FC0F,
+0x0F09AC08, 0x0801000C, 0xEC0003DC, 0x00040003, 0x03001409, 0x3C0509E8, 0x052C0700, 0x0C002C00,
+0xBC000004, 0x00140C03, 0x0F00100C, 0x000D0024, 0x04040020, 0x048C0000, 0x05044C00, 0x80030010,
+0x00100800, 0x0F000C04, 0x07020008, 0x480104A0, 0x00100F00, 0x04AC071D, 0x04006000, 0x0C0004AC,
+0x00040100, 0x00005003, 0x040004EC, 0x00640800, 0x04001000, 0x080F0030, 0x5C011D00, 0x34706F00,
+0x3571BAFF, 0x08020004, 0x0C0F04D8, 0xF80F1900, 0x180C0504, 0x05080400, 0x1505000F, 0x0114340F,
+0x0105040C, 0x500B0508, 0x050C0D03, 0x000D7C03, 0x04000500, 0x32680000, 0x3905000F, 0x0805040C,
+0x0C0404FC, 0x05000400, 0x0D0A1000, 0x582509F4, 0x2004F42D, 0x0EE05A9F, 0x0B000403, 0xFC0004F8,
+0x04E00004, 0x0004F400, 0xF8080004, 0xE8A41004, 0x0004000E, 0xF82F5E25, 0x04EC0004, 0x04000400,
+0x080404EC, 0x04D80000, 0x00000408, 0x040804D4, 0x04E80400, 0x41001404, 0xFF3464AE, 0x651F0004,
+0x000309F0, 0x040804EC, 0x04E40100, 0x0B18AC04, 0x9C040ED0, 0x00080401, 0x0A04F404, 0xE00A04E8,
+0x04C80C04, 0x0004E804, 0x1C080008, 0x00100000, 0x05000400, 0x68030458, 0x04EC0F04, 0x00240401,
+0x00001C0C, 0x14080018, 0x00100000, 0x0E00040F, 0x0F044003, 0x00010494, 0x180D0374, 0x356F4000,
+0x0004B8FF, 0x0D04080B, 0x200B0028, 0x004C0000, 0x08000400, 0x10000028, 0x00040800, 0x09001C0F,
+0x03002805, 0x58080460, 0x000C0104, 0x250E1000, 0x09603571, 0x0504600F, 0x0F004800, 0x0001001C,
+0x04080018, 0x00240400, 0x0100140F, 0x0C001C04, 0x2C040008, 0x00180000, 0x3473BA44, 0x010004FF,
+0x723004F8, 0x0008FF33, 0x3672BA4F, 0x090004FF, 0x00003C00, 0x24040004, 0x30BB1000, 0x04F40700,
+0x0F001000, 0x0F010004, 0x0F050518, 0x0F050018, 0x00190524, 0x100F002C, 0x14040105, 0x051C0100,
+0xFF336D3F, 0x0001051C, 0x04080A14, 0x0A100000, 0x00000408, 0x040002F4, 0x0CF80400, 0x0C035C04,
+0x18040008, 0x0504000A, 0x0C000408, 0x48040A04, 0x3F840028, 0x2F63AC46, 0x1F0004FF, 0x0244B831,
+0x011E3400, 0x40030004, 0x0A080428, 0x00000800, 0x040A1414, 0xAC2D1105, 0x09F80040, 0x130EF000,
+0x0009F09E, 0x040004F8, 0x5BA02200, 0xE00013CC, 0x04F00004, 0x00000408, 0x040104FC, 0x315B2100,
+0x0C000EE8, 0x04F80000, 0x13000400, 0x0022C8A5, 0xF40009F0, 0x00040004, 0x0004F004, 0xE80F0008,
+0x04000109, 0x04E40405, 0x00000804, 0x040C04FC, 0x04FC0000, 0x3565AF31, 0xF00013DC, 0x67B04209,
+0x0004FF35, 0xF8FF3320, 0x68B14804, 0x0004FF34, 0x41050004, 0xFF3569B4, 0x40030004, 0x04EC043F,
+0x0A00080C, 0x6C0204FC, 0x01D0003A, 0x0804DC08, 0x1C00000C, 0x00040000, 0x09001408, 0xCC03000C,
+0x04B80809, 0x00047001, 0x6F380474, 0x0018FF35, 0x04000C00, 0x0C0004F0, 0x00280000, 0x0F000800,
+0x0B1A0004, 0xC4040500, 0x00080F03, 0x00880306, 0x0500200F, 0x0F04C404, 0x0F050020, 0x00010018,
+0x180403F0, 0x00400000, 0x00000C04, 0x04040018, 0x00140400, 0x2104EC01, 0x044C3271, 0x05045000,
+0x380F0010, 0x3C04000E, 0x00080000, 0x00045004, 0x0404000C, 0x00140C00, 0x04006400, 0x080F001C,
+0x300C0100, 0x00240000, 0x0100140F, 0x07001801, 0x08080500, 0x00300405, 0x01000808, 0xE8000030,
+0x00040B04, 0x3773BB4F, 0x0104ECFF, 0x1D00140F, 0x0505040F, 0x1100180F, 0x0C04FC00, 0xF8040004,
+0x00080904, 0x00346E2F, 0x20001A05, 0x0004000A, 0x0002FC00, 0x04000310, 0x05040000, 0x0C04F80C,
+0x98000010, 0x0004040D, 0x0C050804, 0x10000504, 0x05000000, 0x0C000408, 0x10000F10, 0x0F140800,
+0x000A0800, 0xF8000004, 0x00040804, 0x2F5FA735, 0x08000F10, 0x18D8000A, 0x00000400, 0xF40013E8,
+0x00040004, 0x0404F800, 0xFC010004, 0x2CC40004, 0xFF2F5B34, 0xEC000500, 0x00040404, 0x0404F000,
+0xF8000004, 0x00040004, 0x27C0A615, 0x27B43011, 0x0427B800, 0xFC0A0004, 0x0EE80204, 0x0004F004,
+0xF0000008, 0x0004000F, 0x030ED40F, 0x130EDC04, 0x0004F434, 0x331904FC, 0xFC0804F0, 0x000C0004,
+0x0C04E00C, 0xA8000010, 0x00040F01, 0x01C80001, 0x1100040F, 0x336EB444, 0x4F0004FF, 0xFF346FB5,
+0x480D0004, 0xFF3570B6, 0xB54F0004, 0x04FF336F, 0xB6600100, 0xB7FF3470, 0x20002C71, 0x000CFF34,
+0x0500040F, 0x09052400, 0xA80B0004, 0x038C0009, 0x0100040F, 0x00041C00, 0xB74F0004, 0x04FF3671,
+0x351F0300, 0x00120080, 0x4800005C, 0x00040800, 0x04001400, 0x18040004, 0x00100400, 0x05000804,
+0x48030018, 0x04FC0009, 0x0F000401, 0x080804F8, 0x0C040464, 0x00500400, 0x04001004, 0x18040008,
+0x00080000, 0x0F001404, 0x01110008, 0xA80004A4, 0x37732D04, 0x4C0F09D8, 0xCC0F1100, 0xBC4F0104,
+0x04FF3773, 0x30000500, 0x001C0C00, 0x0F001400, 0x0F250004, 0x00110504, 0x04040024, 0x000C0805,
+0x04001404, 0x10000508, 0x000C0400, 0x0809F408, 0x2C00000C, 0x00100A14, 0x2F383415, 0x00035800,
+0x040A0504, 0x1C540200, 0x07050805, 0x080F0D9C, 0x10041105, 0x0008040A, 0x00042C00, 0x00000004,
+0x00040405, 0x07050809, 0x18005DC0, 0x4534000A, 0x04000400, 0xF8008F84, 0x00040004, 0x0F04F80C,
+0x04050500, 0x080004F8, 0x04F80000, 0x325EA541, 0x300004FF, 0xF8FF305F, 0x00040004, 0x27BCA711,
+0x0627B002, 0xD00204F8, 0x05000418, 0x3463AB42, 0x020004FF, 0xFC0018E0, 0x00040004, 0x0404F804,
+0xE4000008, 0x00040009, 0x0009E402, 0x040604F0, 0x68B13F00, 0x0A04FC36, 0x0E050008, 0xDC0009D8,
+0x5C351509, 0x04EC0F22, 0x1D84000D, 0x0100040F, 0x0804F00C, 0x0C0F04DC, 0xFC001100, 0x04DC0C04,
+0x0004F800, 0xB8310004, 0x04FC3672, 0x0F000C00, 0x49050004, 0xFF3670B9, 0x400B0004, 0x03F40004,
+0x0F03B800, 0x4F050004, 0xFF3772B8, 0x20030004, 0x0080FF36, 0x0C00040C, 0x60040088, 0x04D00400,
+0x00000800, 0x1800006C, 0x00040000, 0x0F000C00, 0x0B0A0004, 0x34000500, 0x00040F00, 0x04A00F09,
+0x001C0409, 0x0100400F, 0x04001C0C, 0x080C0010, 0x74BC4400, 0x0004FF38, 0x0F001C04, 0x04090050,
+0x08040024, 0x04CC0F00, 0x00180C05, 0x2500100F, 0x0405180C, 0x180C0048, 0x00100400, 0x0F04E000,
+0x000D0004, 0x040004E8, 0x00280400, 0x00000C00, 0x10000004, 0x00080000, 0x00050401, 0xE00311C0,
+0x04F00441, 0x010F200F, 0x00034800, 0x040F04F8, 0x08020100, 0x05000205, 0x25088805, 0x48E43569,
+0x0C0DAC00, 0x14040504, 0x0008000A, 0x000A0800, 0xFC040004, 0x00080004, 0x0804FC00, 0x04040004,
+0x00080405, 0x01050C0F, 0x04050000, 0x9EB90004, 0x9FFF2D5A, 0xA0FF2E5B, 0x00042F5C, 0x0109EC0F,
+0x0004F400, 0xF8000004, 0x00040404, 0x0009F000, 0xF8000004, 0x00040004, 0x3162A740, 0x000004FF,
+0x040F0ED0, 0xE4000100, 0x00040004, 0x3462AD40, 0x000004FF, 0xEC040ED0, 0x00080404, 0x0804F000,
+0xFC0F0004, 0x345F0304, 0x3569B2FF, 0x01060004, 0x69120EEC, 0xFC0404E4, 0x6CB64E04, 0x0004FF36,
+0x00276006, 0xE40F01BC, 0x14040104, 0x6EB84400, 0x0004FF36, 0x00001404, 0xE80F0500, 0x54000104,
+0x00180009, 0x0F000800, 0x00090004, 0x540404FC, 0x046C0004, 0x08000C08, 0x180C0010, 0x001C0000,
+0x4F000400, 0xFF3771BA, 0x0B020004, 0xC40C0D7C, 0x04940403, 0x4804FC0C, 0xFF3873B9, 0x64000004,
+0x00040000, 0x3773B944, 0x000004FF, 0x04040010, 0x03F80000, 0x00005C0C, 0x04000014, 0x00180C00,
+0x0000100C, 0xBB350024, 0x13583574, 0x010E5800, 0x80030014, 0x000C0F09, 0x73BC4401, 0x0004FF39,
+0x3872BB31, 0x0800000C, 0x00040F00, 0x011C0005, 0x05001C0F, 0x38004801, 0x68FF3874, 0x04FC0400,
+0x08000800, 0x0C080018, 0x001C0800, 0x3973BD4F, 0x090004FF, 0x00A4BC10, 0x0C000403, 0x1C000028,
+0x74BD4F00, 0x0004FF38, 0x04DC0405, 0x2900080F, 0x0F050804, 0x00070008, 0x33191984, 0xF4001984,
+0x00040004, 0x00050000, 0x0C000004, 0x28B91000, 0x0F140311, 0x0F04F800, 0x00010004, 0xC0000518,
+0x1BD40111, 0x002AB807, 0x04000358, 0x05140400, 0x0105080F, 0x040A1008, 0x08000504, 0x04F80000,
+0x00000800, 0x0C000004, 0x05000000, 0x04000408, 0x04080434, 0x000C0405, 0x1105040F, 0x0004FC00,
+0x000F0004, 0xE0000105, 0x04E80422, 0x0100080C, 0xFC0009F4, 0x09F80B09, 0x2404FC00, 0x09EC63A8,
+0x00000806, 0x040804F4, 0x63AE3200, 0x0018C835, 0xCC0D18D0, 0x0EE80218, 0x0204F808, 0x361109EC,
+0x0C020EF8, 0x05000200, 0x366AB34F, 0x010004FF, 0x366AB531, 0xF00E4E2C, 0x05040804, 0x0704FC0F,
+0x0F04E804, 0x000D0008, 0x040404E4, 0x04E80F00, 0x001C0409, 0x0F04700C, 0x040504D8, 0x080F0460,
+0xDC0F0D00, 0xB0080503, 0x04780C03, 0x00001004, 0x900C0504, 0x00100400, 0x04050404, 0xFC040080,
+0x00080804, 0x00006400, 0x0800039C, 0x00040000, 0x01001C00, 0xA4000454, 0x38722104, 0x18040598,
+0x00080000, 0x30000401, 0xB4FF3872, 0x04440000, 0x01000400, 0x74300014, 0x0508FF35, 0x00000400,
+0x44010014, 0x04980000, 0x40051C00, 0xB9FF3675, 0x44000020, 0x00580104, 0xBDFF3CB0, 0xBAFF3B73,
+0xBAFF3974, 0x75210024, 0x0405043A, 0xBC22045C, 0x00001072, 0x0400001C, 0x00600100, 0x25003C04,
+0x05DC3973, 0x00006404, 0x24010070, 0x05740F00, 0x01280000, 0x00001C08, 0xBD40002C, 0x04FF3975,
+0x000C0000, 0x04001C00, 0x080F0078, 0xBE4C1100, 0x04FF3A74, 0x04FC0000, 0x3975BE48, 0x000004FF,
+0x040F0014, 0x88001D00, 0x00040F01, 0x0514041D, 0x0004E400, 0x10000004, 0x00080000, 0x04000408,
+0x00000014, 0x00040005, 0x1204F801, 0x01191C6F, 0x1800000C, 0x0518030A, 0x0016A800, 0x04040500,
+0x08240400, 0x00000800, 0x04000500, 0x05040400, 0x05089400, 0x94030A04, 0x05040117, 0x080F1007,
+0x000F0A10, 0x080F0D05, 0x04040505, 0x00080005, 0x000A0C04, 0x04000F08, 0x0A040000, 0x0009E804,
+0xDC000008, 0x00040F09, 0x05000405, 0x0009EC00, 0xEC000004, 0x00040409, 0x000EF000, 0xA8440004,
+0x08FF3362, 0x0EE80000, 0x0E0EE002, 0xD4000EE8, 0x65AD4018, 0x0004FF35, 0x0018CC01, 0x656618D0,
+0x66B0FF35, 0x03000436, 0xEC0218D8, 0xFF365304, 0x043769B2, 0xF0351100, 0x09FC0404, 0x04014800,
+0xEC0F0004, 0xB7390104, 0x0EE4376D, 0x04018C00, 0x90010004, 0x356E2501, 0xC80413B4, 0x00080F04,
+0x04C40405, 0x0900080F, 0x0F044004, 0x04310008, 0x080F0484, 0x30023100, 0x04340004, 0x11000404,
+0x01044038, 0x58000408, 0x00040F04, 0x0E18070D, 0x0003FC00, 0xA4000004, 0xBF01F003, 0xBDFF3674,
+0xBAFF3674, 0xB8FF3675, 0x80FF3875, 0x72BD8004, 0x71BFFF3A, 0x0008FF3C, 0x71054000, 0xFF3976B9,
+0x683975BB, 0x73BD710F, 0x73BFFF3D, 0x312BEC3E, 0x903A76BF, 0x06040004, 0x3776BD31, 0x09F00504,
+0xFF3871B8, 0xFF3B74BB, 0xFF3573BC, 0xFF3676BD, 0xFF3478B9, 0xFF3576B8, 0x14F10018, 0xFF3E72BD,
+0xFF3F6FBB, 0xFF3D6FB8, 0xFF3A75B9, 0xFF3574B7, 0xFF3B76B8, 0xFF3770B7, 0xFF3871C0, 0x5C3A71C1,
+0x00400000, 0x3271B462, 0x5478BAFF, 0x00A80000, 0xB2009800, 0xFF3A73BA, 0xFF3873B5, 0xFC3774B5,
+0x00D40300, 0x0004D000, 0xD4000004, 0x00040000, 0x31000C00, 0xE83A76BE, 0x000C0004, 0x0900040F,
+0x00003000, 0x240F0004, 0x1C010900, 0x3A744B00, 0x0004BDFF, 0x00017C01, 0x00000A00, 0x3A763805,
+0x000074FF, 0x04000054, 0x003C0100, 0x00057403, 0x1400000C, 0x00040400, 0x0400100C, 0x080C0018,
+0x05A80000, 0x04000404, 0x1004001C, 0x00080100, 0x00069403, 0x30000698, 0x0004010B, 0x000C4007,
+0x04080728, 0x1AA40100, 0x12166804, 0x0003406F, 0x040104FC, 0x1B800800, 0x5C346E29, 0x05180147,
+0x040A1805, 0x30020888, 0x0A140214, 0x53003215, 0x00050C00, 0x04000520, 0x00040005, 0x12582001,
+0x0812FC66, 0x0C040E1C, 0x05000D00, 0xFF336330, 0x74043B10, 0x0E8C0409, 0x00139004, 0xA83F0008,
+0x18D43060, 0x05040C02, 0x0C04FC00, 0xE80009F0, 0x00040004, 0x0004F400, 0xA9400004, 0x04FF3463,
+0x000C0000, 0x04000400, 0xAC4204FC, 0x04FF3564, 0x27B40200, 0x4004FC08, 0xFF3666AE, 0xF8080500,
+0x67B14104, 0x0004FF37, 0x0013DC01, 0xFC0613E0, 0x6AB33104, 0x0804FC38, 0xFC0F09F0, 0x10020904,
+0x09E40605, 0x0804F800, 0x100009D0, 0x04EC0F00, 0x04D40F19, 0x04C40F29, 0x00440F31, 0x04D80E01,
+0x0F04E004, 0x0F0D0008, 0x10340500, 0x000DC073, 0x040004FC, 0x00540000, 0x04F83911, 0x00050004,
+0x48F10370, 0xFF3A79C0, 0xFF3473B8, 0xFF3B76BC, 0xFF3F70BC, 0xFF3E6FBB, 0xFF3F75BF, 0xFF3D73BB,
+0xFF4173B8, 0xFF4475B8, 0xFF3A6BAE, 0xFF4873B7, 0xFF5270B0, 0xFF4C68A7, 0xFF4B6EAE, 0xFF466FAD,
+0xFF4974AB, 0xFF5378AD, 0xFF5C75AB, 0xFF5A6FA6, 0xFF566EAA, 0xFF4F72B2, 0x184077B8, 0xB502F005,
+0xBFFF3572, 0xC3FF3E79, 0xC4FF3B74, 0xB9FF3A73, 0x72B010A4, 0x7DC0FF37, 0x75B7FF3E, 0x0558FF34,
+0x3775BE31, 0xBB10047C, 0x75300534, 0x0590FF3A, 0x00043C00, 0x08000974, 0x00040C00, 0x00048800,
+0x180C0004, 0x00100F00, 0x00380011, 0x05000408, 0xFC0B0034, 0x050C0504, 0x0404FC07, 0x34050038,
+0x04F80300, 0x0000180C, 0x240C0154, 0x00100000, 0x04001800, 0x10000004, 0x00040000, 0x0F001004,
+0x00010008, 0x840104FC, 0x06FC0305, 0x05050000, 0x00030004, 0x04F8081A, 0x08000C01, 0x711015B0,
+0x40021B24, 0x0348041B, 0x00160000, 0xF8000004, 0x0004011F, 0x010A2003, 0x1000051C, 0x05000F05,
+0x0A180004, 0x0A050402, 0xFC001420, 0x00040104, 0xFF366730, 0x14040504, 0x04F8040E, 0x04000808,
+0x08010504, 0x0E580000, 0x097C6410, 0x04186006, 0x08000504, 0x22880000, 0x0C000400, 0xEC0009F8,
+0x00040C04, 0x0F04FC00, 0x000109EC, 0x040404F0, 0x64AA4000, 0x0004FF35, 0x00001004, 0xF8000500,
+0x09E40004, 0x0000040C, 0x040404F8, 0x04FC0000, 0x0704F001, 0xEC0604F8, 0x09F40009, 0x0409F002,
+0xB44804F4, 0x04FF376B, 0x04E40200, 0x00064C02, 0x040609EC, 0x36380200, 0x0804E400, 0x00000004,
+0x6FB94005, 0x0004FF37, 0x0F000C00, 0x0C0509CC, 0x7C0F04EC, 0x140F0104, 0x94080500, 0x00240404,
+0x0F001408, 0x0015000C, 0x2C0F03B0, 0x24000D00, 0x00040400, 0x04002C04, 0x08000010, 0x00140400,
+0x040E0C00, 0x8C000004, 0x00040409, 0x0C038805, 0x7C0303A0, 0x03440003, 0x0600040F, 0x21003400,
+0x09B03B73, 0x00005000, 0xBB100458, 0x3C0009C8, 0x7304F000, 0x73BEFF3B, 0x76C1FF3B, 0x74C0FF38,
+0x74BEFF32, 0x09F0FF32, 0x6FB74CF1, 0x69B1FF3F, 0x70B8FF3F, 0x6AB0FF46, 0x6DAEFF42, 0x6CACFF47,
+0x6BACFF4D, 0x65A2FF56, 0x6397FF61, 0x6B98FF7A, 0x74A3FF86, 0x6592FF84, 0x456DFF6E, 0x2948FF50,
+0x2538FF3E, 0x2233FF4C, 0x0F2AFF47, 0x628CFF1F, 0x72ADFF55, 0x77BDFF40, 0x7BC3FF34, 0x70B9FF3B,
+0x74C1FF32, 0x0000043B, 0xC2310064, 0x18C43E7A, 0x3100B800, 0x783B77C0, 0x77BE4100, 0x0004FF38,
+0x10096800, 0x52002C75, 0x74C1FF3C, 0x610E903C, 0xBEFF3B75, 0x05243B75, 0x00011000, 0x040F000C,
+0x1C0F0100, 0x50000200, 0x00040800, 0x40004C03, 0xFF3C76BF, 0x480F0004, 0x140F0100, 0x2C000100,
+0x00040000, 0x01001C0F, 0x2900140F, 0x0F00B400, 0x00050004, 0x1C0404FC, 0x000C0000, 0x0000040C,
+0x0400050C, 0x00040F10, 0x053C0001, 0x00000400, 0x2C0402E0, 0x034C0003, 0x00052400, 0x04000500,
+0x05000000, 0x04209C04, 0x8C080500, 0x0D800003, 0x0000040C, 0x04020508, 0x17BC0200, 0x0117C804,
+0xDC010504, 0x13040226, 0x08050804, 0x0C0F0008, 0x70000105, 0x00040409, 0x000A0C0C, 0xEC0F0508,
+0x00000109, 0x04F40005, 0x22000404, 0x0ED85FA6, 0x0809F00C, 0xF80404F0, 0x00080404, 0x0004FC00,
+0xFC0F0004, 0xAF400504, 0x04FF3767, 0x04FC0800, 0x0004F80A, 0x371904FC, 0xF80809F0, 0x000C0404,
+0x1505000F, 0x0004EC00, 0xF8000004, 0x00040804, 0x0401B400, 0x080F01C0, 0xE0000100, 0x00040401,
+0x0F044C06, 0x0F0D095C, 0x000B0020, 0x040F0498, 0x84025F00, 0x04A8000E, 0x04000408, 0x080D0300,
+0x04C40000, 0x0C00040F, 0x4000C400, 0xFF3E74BA, 0xDC010004, 0x3A764309, 0x0004BCFF, 0xF103B401,
+0xFF3C7453, 0xFF3E74BC, 0xFF4675B9, 0xFF5276B4, 0xFF5871A9, 0xFF636EA4, 0xFF7172A8, 0xFF6F6AA0,
+0xFF7E74A8, 0xFF8672A3, 0xFF886C9C, 0xFF8C6695, 0xFF90608A, 0xFF905778, 0xFF8D5270, 0xFF582242,
+0xFF2F0016, 0xFF460C22, 0xFF64202B, 0xFF6C1B18, 0xFF540D07, 0xFF300C0E, 0xFF110E23, 0xFF5C78AA,
+0x644576B9, 0x79C22014, 0x02F104E4, 0x77C0FF3C, 0x78C0FF3D, 0x75BDFF38, 0x78C0FF35, 0x1104D03C,
+0xA00488C0, 0x76BFFF3A, 0x77BFFF38, 0x0510FF37, 0x3C75C271, 0x3D75C2FF, 0xBF130500, 0xB00104B0,
+0x000C0700, 0x00048C00, 0x180C0004, 0x00100400, 0x01001C00, 0x60000004, 0x00040805, 0x02007001,
+0x200104FC, 0x00100F00, 0x0050000C, 0x0F00280C, 0x00010014, 0x18000024, 0x00040800, 0x0F001400,
+0x04090004, 0xDC08002C, 0x00140F01, 0x00200801, 0x08000C00, 0x44000508, 0x00040006, 0x000A4008,
+0x040404F8, 0x031C0400, 0x00033C04, 0x0408052C, 0x05000405, 0x08000804, 0x0C000500, 0x05000C00,
+0x04001004, 0x00040DD8, 0x00080405, 0x08131004, 0x040F0008, 0x10000505, 0x04FC0405, 0x04000804,
+0x08040504, 0x05000800, 0x0004F800, 0xF8010004, 0x18D80C04, 0xFF326130, 0x04000ED8, 0x04E40000,
+0x0004FC00, 0x10040004, 0x00140500, 0xFF346552, 0x0EEC65AA, 0x0404FC08, 0x080009F0, 0x04F80100,
+0x000EE00F, 0x0F050000, 0x00010EE4, 0xB44F09FC, 0x04FF366C, 0xB5100900, 0x040313C8, 0x6FB64C00,
+0x0004FF36, 0x0F122400, 0x00010004, 0x04081258, 0x72B94100, 0x0004FF39, 0x0F1D0803, 0x001D04F4,
+0x04080414, 0x00400400, 0x0F025800, 0x08010004, 0x0C0C002C, 0x04540000, 0x0C00140C, 0xD0000010,
+0x00580F02, 0x02B40001, 0x0F0D3804, 0x00450008, 0xBA3100A0, 0x05003C75, 0x10008800, 0x6104F0BE,
+0xBEFF3F73, 0x09F83E74, 0xF0001C00, 0x476BA75B, 0x3E4474FF, 0x644766FF, 0x875169FF, 0x9A5B70FF,
+0xAC6376FF, 0xB56372FF, 0xBD5B6AFF, 0xBC4656FF, 0xB53544FF, 0xAC2939FF, 0xAC3C4AFF, 0x954955FF,
+0x470715FF, 0x440007FF, 0x640C18FF, 0x6D0A0DFF, 0x760F0AFF, 0x8B2018FF, 0x7C281DFF, 0x3F1B0DFF,
+0x0F0506FF, 0x383153FF, 0x6B78AFFF, 0x4575B7FF, 0x3F7EC3FF, 0xE072B7FF, 0xFF3A9205, 0xFF3A7AC4,
+0x6C3375BF, 0x6877100F, 0xFF3D200F, 0x180004E4, 0x0A8C000A, 0x3977C271, 0x3B76C2FF, 0x04000500,
+0x05200205, 0x0304B00F, 0x0F055000, 0x01090460, 0xFC08001C, 0x000C0F04, 0x05000F01, 0x34BF1F0C,
+0x14030100, 0x05C40000, 0x0900200F, 0x0F001C01, 0x010C0060, 0xD8070198, 0x00100805, 0x04023800,
+0x0C000010, 0x00040F00, 0x051C0811, 0x040A2000, 0x08040500, 0x00140000, 0x09144000, 0x70222594,
+0x00346436, 0xF40F1E44, 0x1C01002F, 0x43E80B0A, 0x000A0402, 0x0802357C, 0x1CD0010A, 0x130C6A10,
+0x0421F40A, 0x040F0508, 0xAD400505, 0x04FF3466, 0x05000400, 0x04000800, 0x080004FC, 0x04F00000,
+0x00000408, 0xF00004FC, 0x0EF00009, 0x0009F000, 0xE4000004, 0x00040004, 0x0404E400, 0xFC000004,
+0x00040004, 0x00001000, 0x04000008, 0x65AB7100, 0x66ABFF36, 0x00000435, 0x040C04E8, 0x04F80000,
+0x04000404, 0xF40000B8, 0x00040004, 0x0604F80F, 0x030EF000, 0xB54404FC, 0x04FF376D, 0x050C0400,
+0x00001004, 0xF40C0500, 0x00100004, 0x0804F404, 0x140004E4, 0x00100400, 0x0404EC01, 0x080304F4,
+0x17280000, 0x0404B804, 0x780C0008, 0x00100F04, 0x025C0F1D, 0x04440005, 0x08000400, 0x10000050,
+0x00040F00, 0x02C00415, 0x0800080D, 0x0C030D94, 0x03300100, 0x0F035C03, 0x7131000C, 0xFF3B77BD,
+0x043C77BB, 0x040C0000, 0x80044C01, 0xC0FF3F75, 0xC2FF3D75, 0x59F00988, 0xB5FF3C77, 0x70FF5579,
+0x2FFF4043, 0x2AFF4216, 0x14FF6D1D, 0x04FF730E, 0x00FF7703, 0x08FF7900, 0x17FF940A, 0x34FFB216,
+0x42FFCD31, 0x31FFCC3B, 0x14FF9E29, 0x3FFF5B0E, 0x47FF7F3A, 0x50FF9B40, 0x48FFB64C, 0x4DFFBE4F,
+0x2BFFC65A, 0x3BFF9E3F, 0x72FF9857, 0x39FFAF99, 0x1CFF5C55, 0x4BFF2B14, 0xAEFF3228, 0xB1FF5B7B,
+0x75211448, 0x0014083E, 0xC1D309E4, 0xBDFF3979, 0xB8FF3E79, 0xBEFF3C75, 0xF8010504, 0x39778109,
+0x3A78C3FF, 0x0004C1FF, 0x210A3003, 0x0EA83D77, 0x0000C001, 0x040F0A40, 0x78211900, 0x000A683C,
+0x040F04A8, 0x58000E00, 0x00300000, 0x0000080C, 0x04070014, 0x01980400, 0x0400500C, 0x08000018,
+0x001C0400, 0x00000C00, 0x040000B8, 0x05AC0000, 0x00000408, 0x04080014, 0x02200000, 0x00001008,
+0x1400000C, 0x00040F00, 0x04F0080D, 0x08000C04, 0xF80402CC, 0x00080404, 0x04002400, 0x08000504,
+0x00040405, 0x04051004, 0x08040A08, 0x04FC0100, 0x03142400, 0x140E0500, 0x12DC020A, 0x376BB640,
+0x000504FF, 0x0400090C, 0x1D000400, 0x00044804, 0x04080008, 0x000C0405, 0x0104FC00, 0x70030004,
+0x0500001D, 0x00000408, 0x04081DCC, 0x04F80400, 0x0404F000, 0xE4000004, 0x00040C04, 0x0104F000,
+0x65210004, 0x0404F034, 0xF40004F8, 0x04F80409, 0x7104EC00, 0xFF3567AE, 0x043668AF, 0x69B04400,
+0x0004FF37, 0x0004F400, 0xCC000004, 0x00040400, 0x040ED404, 0x080404DC, 0x04E40800, 0x0804E800,
+0xE4000004, 0x00040404, 0x0404D800, 0xE0040004, 0x00080404, 0x0604E80F, 0xFF3A7331, 0x080704F0,
+0x1C400000, 0x0F049008, 0x081D000C, 0x2C0804BC, 0x000C0002, 0x0302700D, 0xA40F049C, 0xE0010109,
+0x04B00F02, 0x00440418, 0x1900380F, 0x0F04C400, 0x4F0A0004, 0xBDFF3978, 0x71080004, 0xFF397ABC,
+0x54397ABE, 0x045C0604, 0x84FF3A20, 0x18F80004, 0xF1013C00, 0x5779B658, 0x605782FF, 0x57213BFF,
+0xA03640FF, 0xBA3A39FF, 0xB33332FF, 0xA42423FF, 0x961615FF, 0x811218FF, 0x742238FF, 0x82425AFF,
+0xAF7281FF, 0xAF6870FF, 0xAF4F53FF, 0xB04648FF, 0xA03F39FF, 0x631604FF, 0x582A06FF, 0x8C7B45FF,
+0x869047FF, 0x7B8445FF, 0x614D32FF, 0x281519FF, 0x333E5AFF, 0x5A7EB0FF, 0x4479BBFF, 0xC4631408,
+0xBAFF427E, 0xA218E477, 0xBAFF407B, 0xBCFF4077, 0x00A03E77, 0x00A87912, 0x00009800, 0xBDB100B8,
+0xBFFF3B7A, 0xBEFF3D79, 0x00043C78, 0x00000C00, 0x10080004, 0x000C0400, 0x0000080C, 0x04050028,
+0x00480000, 0x0400040F, 0x3A79BE41, 0x000004FF, 0x0C000064, 0x00080C00, 0xFF3A7943, 0x01003CBF,
+0x24000028, 0x00140700, 0x08001C00, 0x0C000018, 0x00140800, 0x0401EC00, 0xC1400510, 0x04FF3D79,
+0x00100400, 0x08000808, 0x18000028, 0x00100000, 0x0A00040F, 0x000A5803, 0x040902B4, 0x3B732100,
+0x84002480, 0x00040024, 0x00082004, 0xEC000008, 0x002C0001, 0x00050404, 0x04080508, 0x050C0C00,
+0x04051400, 0x08000508, 0x050C0500, 0x0205100B, 0x08020514, 0x04140005, 0x356BB344, 0x040004FF,
+0x08000508, 0x30F00000, 0x00050800, 0x00040004, 0x00080405, 0x08048800, 0xA8000508, 0x00040004,
+0x0504FC0F, 0x0104F008, 0xE00304E8, 0x000C0818, 0x4009F008, 0xFF3667AC, 0x54000004, 0x00040000,
+0x07050405, 0xB14404FC, 0x04FF386A, 0x09F00400, 0x0004F405, 0xE40009E8, 0x09E40705, 0x0004F805,
+0xD40F22C4, 0xF800000E, 0x04F00404, 0x04000800, 0x080C04EC, 0x04FC0000, 0x0004E40C, 0xE8000010,
+0x00080004, 0x00000400, 0x0408000C, 0x04C40400, 0x0401D400, 0x080F000C, 0xF00D2100, 0x0C8C0B04,
+0x04028404, 0x080004BC, 0x00140400, 0x4500080F, 0x04030000, 0xD80C0004, 0x00100D03, 0x00039003,
+0x040D0378, 0x397A6200, 0x377AC0FF, 0x79300004, 0x0458FF3A, 0x1304F800, 0x000468C3, 0x60F1000C,
+0xFF377BC4, 0xFF3E75B8, 0xFF5D73AC, 0xFF776289, 0xFF5C0F21, 0xFF902328, 0xFF9C2527, 0xFFA53132,
+0xFFA43D40, 0xFF722A38, 0xFF8D7295, 0xFF291337, 0xFF4C1221, 0xFF5D070A, 0xFF780C0C, 0xFF6F0200,
+0xFF670E00, 0xFF470C00, 0xFF9A874F, 0xFF7F8A3C, 0xFF799036, 0xFF758431, 0xFF938852, 0xFF34220A,
+0xFF1C141F, 0xFF455177, 0xFF4F79B5, 0x8C417ABF, 0x7ABD900A, 0x7CBDFF3D, 0x08B8FF3F, 0x3C776105,
+0x3C79BCFF, 0xC1100590, 0x793000AC, 0x04FCFF39, 0x397ABA80, 0x3A7BBBFF, 0x010504FF, 0x782200D8,
+0x0004883C, 0xF4000510, 0x09940000, 0x203C7B21, 0x04700105, 0x0104B803, 0xB00004F4, 0x3D792204,
+0x0C000030, 0xC47B1300, 0x00080C04, 0xFC3B7A22, 0x00500004, 0x0400040F, 0x1C005C00, 0xA20038BF,
+0xC0FF3A7B, 0xC0FF3C7B, 0x00643B7C, 0x05447B13, 0x10397A25, 0x00380100, 0x743B7A21, 0x01780201,
+0xC1FF3D51, 0x05003B7A, 0x01000800, 0x791001E0, 0x3D120688, 0xD0000024, 0x00100300, 0x00002005,
+0x040B0014, 0x02740500, 0x00050003, 0x04040A28, 0x02CC0100, 0x021A3401, 0x00002984, 0x03200005,
+0x00000408, 0x04080024, 0x050C0005, 0x04000400, 0x04040508, 0x00080005, 0x04050000, 0x00000004,
+0x00040005, 0x00050400, 0xAC000008, 0x00040017, 0x0204FC00, 0xC8000004, 0x13040626, 0x04050004,
+0x0000093C, 0x00040005, 0x0C04FC00, 0x04000004, 0x05000005, 0x30000401, 0x9CFF3666, 0x04A40004,
+0x00000400, 0x04000EE0, 0x09EC0F00, 0x04EC0801, 0x01000C00, 0xE40004F0, 0x3665210E, 0x14011DEC,
+0x35662100, 0xFC0004F8, 0x00040004, 0x00005C00, 0xF40009F8, 0x09EC0409, 0x40000800, 0xFF366BB1,
+0xB0040004, 0x00080800, 0x0405D400, 0xF4040004, 0x04DC0004, 0x00000400, 0x080009EC, 0x00040000,
+0x0004E400, 0x040418B0, 0x1F740000, 0x366FB4B1, 0x3770B5FF, 0x3871B6FF, 0xB8201204, 0x11216C73,
+0x00000C3A, 0x10041214, 0x74B84000, 0x0004FF39, 0x08263800, 0xBC080004, 0x000C0801, 0x4404EC00,
+0xFF3C77BD, 0x10000004, 0x00040400, 0x04001400, 0x0800000C, 0x00100000, 0x20000404, 0x085078BE,
+0x00383D15, 0x04001804, 0x08040244, 0x0CAC0400, 0x08047000, 0x10000980, 0x00040000, 0x0100140F,
+0x0F001800, 0x01110004, 0xA00003A4, 0x03CC0403, 0x04037C0F, 0x0F03F801, 0x0028001C, 0xC5220378,
+0x710E5478, 0xFF3D78BA, 0x803E7AB9, 0x77C35003, 0x58C1FF3C, 0x7963F103, 0x78BCFF3A, 0x78B9FF37,
+0x79BAFF3B, 0x6EA4FF46, 0x6287FF55, 0x1C30FF76, 0x2129FF57, 0x262AFF85, 0x3C49FF8F, 0x2C47FF8A,
+0x96C4FF53, 0x4C74FF85, 0x1923FF47, 0x140CFF5F, 0x190EFF85, 0x2513FF93, 0x2709FF98, 0x8B57FF80,
+0x9445FFC0, 0x8529FF9F, 0x9435FF78, 0x953DFF80, 0x853BFF85, 0x582AFF81, 0x211EFF63, 0x0520FF3D,
+0x709CFF15, 0x7BB6FF59, 0x0028184D, 0x00000098, 0x00780005, 0x00044400, 0xFC0005A4, 0x7BC29004,
+0x7CBDFF37, 0x94BAFF37, 0x007B1005, 0x003B1105, 0x04800F05, 0x04600101, 0x0C049807, 0x20000490,
+0x005C0000, 0x21003C01, 0x04AC387B, 0x397CC035, 0x18020008, 0x103A1300, 0x083B1500, 0x00180400,
+0x00000800, 0x04020040, 0xFF392000, 0xBF3D0010, 0x0008387B, 0x00002004, 0xC1600008, 0xC1FF3A7D,
+0x0205187D, 0x34000068, 0x6CC01000, 0x3A7AA106, 0x3C7BC2FF, 0x3B7BC2FF, 0x14000504, 0x01040000,
+0x3A7AC131, 0x080F0010, 0x40060700, 0x00300005, 0x00000401, 0x040701B8, 0x02B00400, 0x00000804,
+0x040104E0, 0x05080400, 0x00066000, 0x763024D8, 0x0340FF3B, 0x0404FC00, 0xF8000004, 0x00040C04,
+0x00193804, 0x04081928, 0x05080F00, 0x050C0101, 0x00366E21, 0x05040258, 0x10FF3520, 0x6DB44104,
+0x0004FF34, 0x03131800, 0x48040938, 0x04580009, 0x02050802, 0x64004508, 0x0510000E, 0x08050400,
+0x0C000004, 0x0A100005, 0x0004FC00, 0x000C0004, 0x04DC0005, 0x08000404, 0x0C0C04F8, 0x04F40000,
+0x40000400, 0xFF3768AD, 0xFC010004, 0xE8671604, 0x09F0040E, 0x0004FC00, 0xA0000004, 0x00040000,
+0x0C00B004, 0x000004F8, 0x6EB63F05, 0x0718C038, 0x3A987110, 0x003AB406, 0x040004F8, 0x04EC0900,
+0x05050403, 0x180004FC, 0x25F80026, 0x40000407, 0xFF3B76BA, 0xC0000004, 0x00040004, 0x0001BC00,
+0x0C000004, 0x00040400, 0x0F04BC04, 0x00050008, 0x1C040028, 0x04F80400, 0x0400080C, 0xF0040020,
+0x00080904, 0x0F085400, 0x04080004, 0xF40F0504, 0x240F1104, 0x08000100, 0x04E40405, 0x0403B000,
+0x080F000C, 0x38001900, 0x00040F00, 0x08480005, 0x0409EC04, 0x74000500, 0x13600200, 0xF20A1002,
+0x4080C064, 0x3879B9FF, 0x367ABBFF, 0x457BB7FF, 0x5973A4FF, 0x6D5F82FF, 0x5B1B2CFF, 0x742634FF,
+0x6E3A50FF, 0x483E61FF, 0x5D8AC3FF, 0x385382FF, 0x86424DFF, 0x9D241BFF, 0xA82216FF, 0x9E240DFF,
+0x752200FF, 0xE2B675FF, 0xC1BD64FF, 0x96A844FF, 0x728627FF, 0x84973EFF, 0x748330FF, 0x959056FF,
+0x3B1606FF, 0x462230FF, 0x0C0928FF, 0x647FAEFF, 0x4A7ABAFF, 0x00F02CDC, 0xBCFF3C7C, 0xC2FF3B7C,
+0xC4FF387D, 0x88FF367C, 0xC108F10A, 0xBEFF377C, 0xBCFF377E, 0xBCFF387E, 0xBFFF3C7C, 0xC1FF3F7C,
+0x04543D7C, 0x04045800, 0x6C000004, 0x00040F04, 0x04780109, 0x04D47C12, 0x0204B400, 0x940004F8,
+0x00040A04, 0x02001C02, 0x5C000028, 0x00540C00, 0x0F001402, 0x0A010034, 0x60000014, 0x04FC0200,
+0x00050000, 0x20020554, 0x00600000, 0x0004DC00, 0x040404F8, 0x00100000, 0x04000408, 0x08000018,
+0x00180800, 0x02000C06, 0xCC000534, 0x00040001, 0x070A3801, 0xB0090500, 0x152C0702, 0x00051000,
+0xE0000508, 0x03080002, 0x00000404, 0x04000014, 0x05040400, 0x01000808, 0xB400050C, 0x336C0733,
+0x29050405, 0x3EC83771, 0x000A0401, 0xD0001930, 0x00040329, 0x00050400, 0x04000500, 0x05000100,
+0x07050800, 0x58000504, 0x00040004, 0x06050000, 0x48020004, 0x05040022, 0x00000404, 0x00000508,
+0x00040005, 0x0004F804, 0xF4040008, 0x04F8040E, 0x05000800, 0xD80304F0, 0x04EC0018, 0x00000408,
+0x040004F4, 0x68B04100, 0x0004FF38, 0x0F13E403, 0x010104F8, 0xB00004F4, 0x00040700, 0x0004F000,
+0xF4010004, 0x04F80704, 0x2109EC01, 0x2FDC3770, 0x03000C01, 0x680044A8, 0x156C001F, 0x01107000,
+0xB8070004, 0x0EC80913, 0x903A7521, 0x01980406, 0x1100080F, 0x0C01CC00, 0x580F0004, 0x14000104,
+0x049C0400, 0x0003F000, 0x14000004, 0x00040F00, 0x002C0011, 0x01000408, 0x84070034, 0x046C0409,
+0x0504A40F, 0x0400200D, 0x44070540, 0x003C0400, 0x0F002C04, 0x0C290008, 0x100C03B4, 0x7CBE4000,
+0x0004FF3B, 0x3E7AC031, 0x0C010DB4, 0x397C2100, 0xB8000478, 0xBA63F003, 0xB7FF3C7C, 0xBAFF3A7A,
+0xB8FF3880, 0xB4FF387D, 0xAAFF4278, 0x83FF5B74, 0x3AFF6F5D, 0x45FF3F1C, 0x81FF3D29, 0xC1FF4F58,
+0x92FF4781, 0x4BFF3458, 0x2DFF6A34, 0x16FF9F2D, 0x05FFAB1C, 0x00FF9E1E, 0x6FFF7229, 0x49FFD4B8,
+0x35FF9BA1, 0x46FF7D95, 0x4CFF8AA1, 0x2EFF8DA4, 0x53FF6A82, 0x23FF8E93, 0x19FF623F, 0x24FF4B1B,
+0x3BFF3717, 0xB8FF211A, 0xF0050482, 0xBEFF4404, 0xBBFF3F81, 0xC5FF347B, 0xC7FF357D, 0xC2FF377C,
+0x02F409A4, 0xBDFF377A, 0xBEFF367D, 0xC1FF387D, 0xC2FF3F7B, 0x02050079, 0x64040458, 0x00B80004,
+0x04000404, 0x080F0014, 0x280F0500, 0x18040500, 0x00080400, 0x15004006, 0x2005703C, 0x057C7EC2,
+0x04007C02, 0x080F0028, 0x3C060100, 0x002C0200, 0x04001000, 0x0C000028, 0x00040400, 0x04001404,
+0x18000008, 0x000C0400, 0x0500080F, 0x00051800, 0x100F0004, 0x50000505, 0x00040414, 0x04051C08,
+0x08040F28, 0x24F80903, 0x0811E403, 0x0C0504FC, 0x25540300, 0x04235004, 0x08000A10, 0x050C0500,
+0x03327C00, 0x180C3ED8, 0x0DF4000A, 0x013F7400, 0x6E260004, 0x07221435, 0x04000A08, 0x00040805,
+0x24050C02, 0x0500FF37, 0x00000804, 0xF8000508, 0x00040004, 0x0004FC00, 0x040404F0, 0x04F80400,
+0x3766AC41, 0x030004FF, 0xFC0413E0, 0x04F40004, 0x22000404, 0x04FC69AE, 0x3969B135, 0x000013E0,
+0x6BB27105, 0x6CB2FF39, 0x01000437, 0xA40004FC, 0x366C2500, 0xF8091DC4, 0x04FC0004, 0xF0386E26,
+0x04FC0304, 0x0313CC05, 0xFC0044A8, 0x00040004, 0x2204FC01, 0x2B7C3974, 0x2B847413, 0x0F000807,
+0x0C0504F0, 0x100404E0, 0x09B80C00, 0x0A001006, 0xBC04171C, 0x04B80104, 0x10072800, 0x111C787A,
+0x0412283D, 0x08040014, 0x002C0400, 0x0A00080F, 0x0F124000, 0x00080004, 0xC00F04CC, 0xE8030A04,
+0x00240F0E, 0x0DBC0109, 0x00125000, 0x6C0312D0, 0x00140800, 0x0A000C0F, 0x0008E803, 0xB00004F8,
+0x00040008, 0x00000C00, 0xEC000004, 0x7EBB7104, 0x7DBDFF3C, 0xF109483C, 0x3F7BC300, 0x3D7CBFFF,
+0x3A7EBDFF, 0x397EBFFF, 0x68000004, 0xBC73F009, 0xBDFF3D7F, 0xBCFF3B81, 0xBFFF377E, 0xB7FF3A7E,
+0xB0FF4678, 0x7FFF6778, 0x48FF4D4F, 0xAAFF1D22, 0x99FF607B, 0x97FF1151, 0x5EFF2853, 0x3FFF5E3A,
+0x1EFF9134, 0x0BFFA21D, 0x00FF9A20, 0x62FF7432, 0x4BFFBFAB, 0x36FF98A2, 0x49FF7B94, 0x59FF8BA4,
+0x33FF97AF, 0x3BFF6D86, 0x43FF7680, 0x00FF8D72, 0x1AFF4517, 0x17FF4E1E, 0x6AFF2607, 0xB3FF3F44,
+0xB2FF5D81, 0xC2FF3C79, 0xC3FF3C81, 0xC6FF397C, 0x300E207C, 0x60C1FF3B, 0x377C300E, 0x00040CFF,
+0x000000AC, 0x00C80005, 0x0F001000, 0x00050004, 0xC2440444, 0x04FF3B7E, 0x00100000, 0x00000404,
+0x0C040014, 0x00080F00, 0x04F00007, 0x0004B800, 0x04060008, 0x04FC0000, 0x00000400, 0x3C020150,
+0x001C0000, 0x0F002804, 0x00170008, 0x04000084, 0x00440200, 0x06003800, 0x180F0004, 0xEC080500,
+0x04FC0000, 0x1300040A, 0x070F343C, 0x58030A18, 0x05080019, 0x00050408, 0xEC00000C, 0x05040402,
+0x00000800, 0x04040A18, 0x0A080000, 0x0B00040D, 0x080F3858, 0x0C010105, 0x05000B05, 0x00050800,
+0x00000A14, 0x00040005, 0x00050001, 0x30044E70, 0x386C6518, 0x386CB5FF, 0x0C00311C, 0x00040000,
+0x02047800, 0x3813050C, 0x10023B40, 0x0F18040A, 0x0004F800, 0xF80C0004, 0x1DD00404, 0x0804F004,
+0xF80C0008, 0x09F80004, 0x0804F000, 0xF8040004, 0x00080404, 0x0404EC00, 0xEC010004, 0x18D00409,
+0x4004F804, 0xB7FF396F, 0xF8030004, 0x09F40004, 0x0004FC04, 0xF40818C0, 0x04FC0404, 0x40001400,
+0xFF3C75BC, 0xBC000004, 0x0004040E, 0x0404FC04, 0x080F04DC, 0xC0000900, 0x00040401, 0x0104A80F,
+0x04001C00, 0xE4010018, 0x04F00708, 0x31001800, 0x443C7BBE, 0x17480012, 0x12F0BC10, 0x00000403,
+0x04000010, 0x04980F00, 0x001C0F09, 0x04A40F19, 0x00800005, 0x1100040F, 0x00049800, 0x2C040004,
+0x000C0000, 0x02000400, 0x7C000380, 0x00040F03, 0x7DBF311F, 0x0104EC3C, 0x13F10500, 0xC1FF407B,
+0xBEFF417A, 0xBCFF4278, 0xBAFF3F7A, 0xBCFF3B7D, 0xC3FF397D, 0xC4FF3C7C, 0xC5FF3C7C, 0x00043D7D,
+0x7DC468F1, 0x78BDFF3D, 0x74BBFF3F, 0x80C2FF48, 0x2156FF5D, 0x75AEFF06, 0x509EFF4E, 0x4F9BFF0E,
+0x3D6CFF1E, 0x2B44FF46, 0x242EFF67, 0x190BFF8E, 0x3003FF83, 0xB16CFF69, 0x9A43FFC4, 0x9739FF90,
+0xA54AFF7E, 0x8F3BFF8B, 0x7E2EFF76, 0x9448FF67, 0xBC72FF89, 0x3200FFC8, 0x1F09FF51, 0x1E20FF4F,
+0x020EFF4C, 0x5B78FF18, 0x81B4FF54, 0x7EBDFF56, 0x79BCFF42, 0x7BC0FF42, 0x3104C042, 0x8C397EC3,
+0x7BC47100, 0x7DC4FF3D, 0x0000043E, 0x040C0484, 0x01140800, 0x0F001C0C, 0x311E0010, 0x34FF3E7D,
+0x00080000, 0x0500040F, 0xFF3D7E40, 0x0F001CC2, 0x00210008, 0x04030034, 0x00B80400, 0x03007001,
+0x0C000014, 0x00180400, 0x0300080F, 0x02053002, 0xAC020608, 0x000C080F, 0x080FEC00, 0x900002A8,
+0x00040807, 0x01001C00, 0x88030010, 0x0514000C, 0x03000401, 0x000D0F2C, 0x0A1C0305, 0x01001800,
+0x100F0A14, 0x0C09040A, 0xE472160A, 0x04FC004D, 0x03000409, 0x5C040440, 0x00080504, 0x0A051003,
+0x2C060504, 0x05000045, 0x04000400, 0x080004F8, 0x09F40900, 0x0009F00B, 0xF8040500, 0x00080004,
+0x0009F400, 0xF4010004, 0x39693109, 0x0009ECFF, 0x040409F0, 0x376C6500, 0x386DB3FF, 0x98000004,
+0x04F80100, 0x0000B003, 0x040004E0, 0x00140000, 0x0004F801, 0x6F2104FC, 0x043EE839, 0x080004F8,
+0x04FC0100, 0x31507212, 0x0404E004, 0x08000500, 0x04FC0000, 0x03000401, 0xFC001584, 0x04F00F04,
+0x18A0020B, 0x0009E004, 0x040F04C4, 0xFC041100, 0x00080C04, 0x00045000, 0x040F04E8, 0x20000500,
+0x04BC0F02, 0x00180005, 0x0D00200F, 0x04002400, 0xAC010004, 0x12B00012, 0x6C3D7C21, 0x0018000E,
+0x0F04C400, 0x00250004, 0x140F3B24, 0x0C0F0303, 0x00001305, 0x7FC05005, 0xC8C0FF3B, 0x3F7B610D,
+0x4179C3FF, 0xBD500504, 0xBBFF407B, 0x7D1204E8, 0xC5A01794, 0xCBFF3B7B, 0xC5FF407E, 0x0009907A,
+0x62F10500, 0x82CBFF39, 0x7AC0FF44, 0x6AA6FF44, 0x5F9DFF40, 0x4A99FF31, 0x4E9CFF0B, 0x3E77FF19,
+0x274BFF2F, 0x2837FF45, 0x261CFF7A, 0x2400FF7E, 0x9B5AFF59, 0x9741FFB0, 0x9335FF8F, 0x9E45FF7A,
+0x9541FF84, 0x7B29FF7C, 0x933DFF65, 0xB858FF87, 0xC775FFB8, 0x2900FFD8, 0x1F0BFF4F, 0x1A16FF4E,
+0x0B19FF43, 0x6F98FF1D, 0x78AFFF60, 0x79B7FF51, 0x7BBCFF4B, 0x3100A444, 0xF43B80C5, 0x7CC44004,
+0x0588FF40, 0x3C7FC57F, 0x3E7FC3FF, 0x00020004, 0x04000438, 0x00200400, 0x0F000C08, 0x22020014,
+0x00483F7E, 0x07000800, 0xC4310004, 0x2DA0407F, 0x0C2DA400, 0xF4000004, 0x00140C04, 0x2200100F,
+0x05647F13, 0x0804F403, 0xB80000A0, 0x00040F00, 0x0ADC020B, 0x0802080C, 0x0C010504, 0x0C3C0700,
+0x0102B400, 0xA80804F4, 0x0C880323, 0x000A2400, 0x38040004, 0x0A0C0414, 0x00000808, 0x040504FC,
+0x26000300, 0x002FB000, 0x10000004, 0x0A00000A, 0x01000408, 0x1003050C, 0x1CFC080A, 0x00050801,
+0x54030948, 0x04640004, 0x07000405, 0x04040500, 0x0A0C0005, 0x04000400, 0x84000A10, 0x04F80822,
+0x01050000, 0xF4000EEC, 0x0500070E, 0x0004F000, 0xF0000004, 0x00040404, 0x396AAF40, 0x410004FF,
+0xFF3A6AB2, 0x6B650004, 0x6CB3FF39, 0x0805083A, 0xB44004FC, 0xE8FF396E, 0x00040004, 0x0904F400,
+0xF8030004, 0x05040004, 0x3A70B832, 0xF000317C, 0x13D80B04, 0x0404EC00, 0x08080500, 0x04F00000,
+0x08000404, 0xE00404F8, 0x00140004, 0x00000C04, 0x2C000008, 0x0004043F, 0x3F7AC040, 0x0F04D0FF,
+0x00010500, 0x04000018, 0x01EC0000, 0x00000400, 0x040C046C, 0x04900000, 0x0F050000, 0x04210004,
+0x3C00004C, 0x04C00F00, 0x04A00005, 0x05001C0F, 0x00001804, 0x04000024, 0x00100400, 0x00000800,
+0x04040010, 0x00100C00, 0x0804AC00, 0x1C0F0004, 0xA0000B03, 0x050C0212, 0x0400280C, 0xC3110330,
+0x3C520444, 0x3E7EC5FF, 0x2C0009E0, 0x3A7F800E, 0x3D7EBEFF, 0x0398BFFF, 0x407C73F1, 0x4180C7FF,
+0x3D7DC7FF, 0x3C7FC6FF, 0x3E81C5FF, 0x4084C3FF, 0x387CB9FF, 0x417FBAFF, 0x4C7FB8FF, 0x3F71AEFF,
+0x003981FF, 0x0F4791FF, 0x234987FF, 0x33325EFF, 0x612638FF, 0x691C14FF, 0x602A04FF, 0xB69D5DFF,
+0x878C3AFF, 0x81983EFF, 0x829A46FF, 0x7B933FFF, 0x657922FF, 0xA1B14FFF, 0xC3CB5BFF, 0xC3C055FF,
+0xBDAA5DFF, 0x3C1A00FF, 0x441406FF, 0x360B14FF, 0x270F29FF, 0x757AA2FF, 0x547DB3FF, 0xB0000A08,
+0x00A40000, 0x407FC260, 0x307EBEFF, 0xFF3B3004, 0x000F20C4, 0xB0070500, 0x04800C04, 0x0004C000,
+0x18040004, 0x000C0000, 0x00000404, 0x0C040014, 0x28780000, 0x40001000, 0xFF417DC3, 0x0404000C,
+0x7FC53900, 0x04001043, 0x080F0018, 0x7F303200, 0x0080FF40, 0x03007801, 0x100000C4, 0x00040000,
+0x00001404, 0x0404000C, 0x00140400, 0x00000805, 0xC00300FC, 0x01C80001, 0x0C0F3000, 0x58060004,
+0x0208020F, 0x01014800, 0x18040510, 0x05180B11, 0x0104FC00, 0x78100004, 0x04022974, 0x050C0400,
+0x04000804, 0x0401050C, 0x05000305, 0x0025F800, 0x04040500, 0x05080000, 0x04000408, 0x50000510,
+0x00040448, 0x00050C01, 0x44070E30, 0x04640004, 0x00000400, 0x040804F4, 0x04F80000, 0x02000408,
+0x36200504, 0x0404F4FF, 0xFC050004, 0x05000304, 0x0404F400, 0xF80C0004, 0x04FC0004, 0x00000400,
+0xF80004FC, 0x00040904, 0xFF386D30, 0x040604F4, 0x00381200, 0x366F2905, 0xE00013E0, 0x04F80009,
+0x01000400, 0x712104FC, 0x0005003B, 0x040018C8, 0x27900800, 0x0004F40C, 0x040004D8, 0x04FC0C00,
+0x0004E400, 0xE4040004, 0x000C0004, 0x04000404, 0xF8020014, 0x043F1104, 0x04E40017, 0x0C000400,
+0x14000504, 0x00040000, 0x0804FC0C, 0x000C0010, 0x046C0005, 0x0F000408, 0x000904DC, 0x0400003C,
+0x00300400, 0x0F04B004, 0x21220008, 0x44F03D7E, 0x21099001, 0x000C3E7D, 0x00004804, 0x0C040060,
+0x00080100, 0x03002C00, 0xC1100004, 0x340304A0, 0x04E00C08, 0x1500100F, 0x00086C04, 0xC4C00950,
+0xC4FF3B7E, 0xC2FF3A7F, 0x18FF3A7F, 0x0468000A, 0x31278C00, 0x884382C7, 0x00200013, 0xF1001800,
+0x397DBA38, 0x3C81BCFF, 0x3E7FB7FF, 0x6499CFFF, 0x5183BEFF, 0x01377DFF, 0x0A428CFF, 0x104589FF,
+0x283C6FFF, 0x53273EFF, 0x621F19FF, 0x531E00FF, 0x997B45FF, 0x919447FF, 0x7D943CFF, 0x889F4FFF,
+0x7A913FFF, 0x667D25FF, 0x34F51E10, 0xFFB2BF49, 0xFFB5BD46, 0xFFB6B44F, 0xFFAD9950, 0xFF3D0F00,
+0xFF4A130E, 0xFF3B0F1C, 0xFF271430, 0xFF6A7FAA, 0xFF507FB5, 0xFF417DBC, 0xFF3F80C2, 0xFF4081C1,
+0xFF3E80BD, 0xFF3A7FC0, 0xFF3D80C4, 0x044180C5, 0x051C0000, 0x40000404, 0xFF427EC6, 0x20000004,
+0x80C44400, 0x0018FF3F, 0x4380C341, 0x0304D4FF, 0x0C01047C, 0x427E2F00, 0x000204E4, 0x0404001C,
+0x04F00000, 0x40000C04, 0xFF4480C6, 0x10000004, 0x00180000, 0x0500040F, 0x00002000, 0x200C0004,
+0x00140000, 0x04000404, 0x080404DC, 0x00B00000, 0x00000400, 0xE8000010, 0x000C0004, 0x00000400,
+0x040F0010, 0x80300200, 0x00E0FF3F, 0x04000400, 0x080001CC, 0x02000F00, 0x05040009, 0x04000404,
+0x180007C8, 0x00040003, 0x00427C00, 0x04010004, 0x14380005, 0x32050807, 0xA43E78C1, 0x0F1C033D,
+0x00050805, 0x18000504, 0x0008000F, 0x04000403, 0x08040508, 0x050C0400, 0x00526400, 0x04020004,
+0x30371205, 0x3A70300E, 0x040440FF, 0x50000004, 0x6DB63104, 0x04141039, 0xFC080008, 0x000C0004,
+0x07050005, 0xEC0427C0, 0x0EEC0804, 0x0104F804, 0xE80013E4, 0x09F0040E, 0xFF3A6A30, 0xF8010EFC,
+0x0EE80304, 0x1304F006, 0x15050039, 0x0013D438, 0x040004EC, 0x09FC0100, 0x0022C407, 0x040422B8,
+0x22B00400, 0x3B74B940, 0x000004FF, 0xA4003A40, 0x00040F22, 0x35780401, 0x3D76BD31, 0xE40034E4,
+0x04E00404, 0x00000804, 0x080004E8, 0x00040435, 0x3F7ABE75, 0x3E7BBEFF, 0x9C000004, 0x00100203,
+0xACFF3C20, 0x00040404, 0x0F043400, 0x00150004, 0x040F04C4, 0xE4000900, 0x00040F0C, 0x02480409,
+0x0502700F, 0x00028C00, 0x20040004, 0x00300000, 0x00000C00, 0x04000014, 0x04F40000, 0x04185400,
+0xDC080008, 0x000C0009, 0x0F04E400, 0x40020004, 0xC1FF3F7E, 0x7F3C0004, 0x0020FF3E, 0x00003808,
+0x0400000C, 0x00240C00, 0x00001000, 0x54000018, 0x041C0205, 0xC1FF4251, 0x0054417E, 0x21046801,
+0x05883F7E, 0x32037C00, 0x084081C5, 0x04800014, 0xF0001800, 0xFF408004, 0xFF3E7EBC, 0xFF427FB8,
+0xFF689DD1, 0xFF487BB4, 0x50F10C8C, 0xFF073C8C, 0xFF04428F, 0xFF274782, 0xFF45233E, 0xFF632526,
+0xFF531B0A, 0xFF755429, 0xFF989953, 0xFF839644, 0xFF859B50, 0xFF7B9345, 0xFF617B24, 0xFF96AC4A,
+0xFFB9CA58, 0xFFAEBB45, 0xFFABB542, 0xFFBFBB58, 0xFF8E6B2B, 0xFF431200, 0xFF3E0E0E, 0xFF2C091D,
+0xFF2C223B, 0xFF7789AF, 0x144C7DB5, 0x81BFA01E, 0x82C0FF3B, 0x80C1FF3C, 0x40420A8C, 0xD07FC7FF,
+0x81C33104, 0xF0051C40, 0x4181BF0D, 0x4380C1FF, 0x467EC9FF, 0x457ECBFF, 0x3F7FC6FF, 0x3D81C2FF,
+0x3F80C0FF, 0x7123CCFF, 0xFF437EC0, 0x38447FC3, 0x0AD80000, 0x4004C800, 0xFF4481C4, 0x040F0518,
+0x1C040100, 0x7FC23100, 0x00002442, 0x04040010, 0x00300400, 0x0F001004, 0x04050008, 0x080F0028,
+0x54002100, 0x00380F00, 0x00940005, 0x15000406, 0x0205E440, 0x100201D0, 0x02240100, 0x00022800,
+0x5C0F01B8, 0x2C000407, 0x03040C03, 0x21051805, 0x0D643D79, 0x02084C00, 0x3F110004, 0xB00038A8,
+0x00040003, 0x0003AC00, 0xC8000008, 0x08CC0403, 0x00000808, 0x28010A24, 0x486C0014, 0x56DC7412,
+0x002D4C04, 0x10000008, 0x04580022, 0x01000404, 0x70610460, 0x6FB5FF37, 0x20000439, 0x098C6EB4,
+0x15000400, 0x00138C39, 0x98040E9C, 0x04EC0018, 0x04000400, 0x080804FC, 0x04FC0000, 0x0009E400,
+0xEC000004, 0x09EC0104, 0xFF3B6B66, 0xF43B6BB3, 0x04FC030E, 0x0A005400, 0x74000500, 0x1DD00600,
+0x0100A004, 0xCC0700B0, 0x04FC001D, 0x0004F804, 0xF8000008, 0x00040004, 0x0004FC01, 0xA8033F5C,
+0x05040C27, 0x00050004, 0x4400013C, 0x00040801, 0x0404F800, 0xF4010004, 0x04F80004, 0xFF3F7A61,
+0xF4407BBF, 0x25F80025, 0x00000400, 0xBC0004FC, 0x00040801, 0x0F03D000, 0x0F190004, 0x0F0904DC,
+0x0016001C, 0x000F0984, 0xC4000417, 0x04E80007, 0x00000800, 0x540104F8, 0x3D7E2200, 0x7F211254,
+0x0012D83E, 0x8C000954, 0x03D40004, 0x0F049800, 0x030A0004, 0xD80402CC, 0x02EC0102, 0x0008E000,
+0x0C0B049C, 0x04C80105, 0x030A2400, 0x10000020, 0x00040900, 0x14407F21, 0x04300004, 0x647FC120,
+0xFF435113, 0x40427FC0, 0x80C33104, 0x00035041, 0x00010858, 0x3E7F6105, 0x4182C6FF, 0x2CF10404,
+0xFF417EBF, 0xFF4480BF, 0xFF407BB7, 0xFF669BD1, 0xFF4D80B9, 0xFF5686CE, 0xFF003381, 0xFF084797,
+0xFF224887, 0xFF452C4A, 0xFF581F25, 0xFF581F16, 0xFF6B4725, 0xFF949551, 0x00819443, 0x4C34F105,
+0x28FF8098, 0x33FF637C, 0x5DFF7B93, 0x48FFB9CB, 0x37FFB0BF, 0x44FFA1B4, 0x56FFAFB3, 0x01FFC2AC,
+0x07FF5E35, 0x10FF4814, 0x25FF3705, 0x49FF3B17, 0xB7FF382E, 0xB7FF6F87, 0xC0FF4B7C, 0xC9FF4583,
+0x23B4468A, 0x4000FC00, 0xFF4580C6, 0x08F10424, 0xFF4182C2, 0xFF4183C0, 0xFF4481C0, 0xFF467FC2,
+0xFF497DC8, 0xBC487DC9, 0x0FB4000F, 0x000A3800, 0xBFB1051C, 0xC4FF4380, 0xC8FF4580, 0x00044480,
+0x00050004, 0x04080044, 0x04740400, 0x6082C522, 0x00100400, 0x00002404, 0x7C000010, 0x00100404,
+0x0D00080F, 0x0C003000, 0x14000024, 0x00040C00, 0x0C00240C, 0x300C0010, 0x05CC0000, 0x21000401,
+0x019C4380, 0x0000200C, 0x04040124, 0x02340400, 0x0C000800, 0x98010324, 0x02C40002, 0x0C3E7D21,
+0x05100020, 0x01050404, 0x20000008, 0x00040125, 0x06127400, 0xBF400004, 0x04FF3F78, 0x3DA80000,
+0x00000400, 0x04040DD4, 0x05080000, 0x000A2405, 0xA4070A20, 0x284C014C, 0x045BD007, 0x68041828,
+0x05000404, 0x08000804, 0xAC00049C, 0x00040404, 0x0004F004, 0x0C0804EC, 0x00100000, 0x0404F800,
+0xE0040004, 0x09F00118, 0xEC3A6C21, 0x000C0013, 0x02005808, 0x3811000C, 0x78040578, 0x2C9C0000,
+0x00000400, 0x040004E8, 0x05000000, 0x041DB800, 0xF4080004, 0x04F80904, 0x0004FC00, 0x00070004,
+0x04F40405, 0x3D78BC44, 0x020004FF, 0x3E1B04E8, 0xE4060664, 0x04E40009, 0x00000408, 0x040A04F8,
+0xB43D1100, 0x05040021, 0x0001D404, 0x0404000C, 0x00140400, 0x00000808, 0x040F0200, 0x3C023F00,
+0x09440409, 0x00000804, 0x80000324, 0x00100402, 0x1100080E, 0x000DD83F, 0x9C010024, 0xB87F1204,
+0x00100107, 0x02000C0F, 0x54FF4222, 0x00080000, 0x00002C02, 0x040404AC, 0x00380800, 0x04001404,
+0xC4440008, 0x04FF4281, 0x00140400, 0x4181C190, 0x4282C2FF, 0x0438C2FF, 0x00000407, 0x24000028,
+0x04FC0000, 0x0004F800, 0xC8310508, 0x046C4384, 0xB1052400, 0xFF4783C2, 0xFF4580BC, 0x18629AD5,
+0xC210F12D, 0xB2FF4D80, 0x81FF346A, 0x81FF0035, 0x50FF1F43, 0x2DFF4330, 0x21FF5521, 0x1AFF5D23,
+0x05005F36, 0x964147F2, 0x9A4CFF80, 0x9E53FF83, 0x802CFF88, 0x7E1EFF68, 0xD060FF66, 0xBD43FFBE,
+0xBF43FFAD, 0xB945FFAF, 0xAF4DFFB2, 0x6722FFB9, 0x2E16FF88, 0x0A0DFF6A, 0x1119FF4F, 0x0E23FF4D,
+0x406BFF35, 0x82BCFF4D, 0x79B7FF76, 0x7DC0FF50, 0x85C7FF44, 0x80C2FF4A, 0x81C0FF45, 0x00000004,
+0x00040105, 0x458000F0, 0x487FC2FF, 0x4B7EC0FF, 0x4B7DC2FF, 0x000520FF, 0xE00004E4, 0xBF04F100,
+0xBFFF4282, 0xC3FF3F84, 0xC7FF4283, 0xC9FF4681, 0x00204680, 0x0804640C, 0x00000010, 0x00040005,
+0x04001408, 0x6C00000C, 0x000C0404, 0x00000800, 0x040F0028, 0x1C000100, 0x00040800, 0x08002400,
+0x0C0F0010, 0x2C0F0900, 0x48081900, 0x009C0000, 0x0000040A, 0xD40206BC, 0x02240806, 0x0303080D,
+0xAC000794, 0x0CAC0007, 0x01000404, 0x84000504, 0x05040125, 0x127C3E11, 0x02298400, 0x140203C0,
+0x08C4080A, 0x0008D800, 0x08040508, 0x05080F00, 0x18180005, 0x01000404, 0x721B0454, 0x70211D44,
+0x040E843A, 0x10060490, 0x09A0020A, 0x0F04E800, 0x00010004, 0xB04404F8, 0x04FF3A6B, 0x05000000,
+0x0004F000, 0xB4410004, 0x04FF3B6D, 0xE86E1400, 0x0A6C000E, 0xB5FF3A40, 0x5600046F, 0x70B6FF39,
+0x0300043A, 0xFC013698, 0x31880004, 0x58247312, 0x0000B400, 0xF40013D4, 0x00040004, 0x0009F005,
+0x040704F4, 0x04E80400, 0x00000804, 0xD4050ECC, 0xF87B1A09, 0x01500004, 0x0A000404, 0x980004E4,
+0x00040A26, 0x407DC040, 0x0F0004FF, 0x000504E8, 0x10000018, 0x01E00D0F, 0x0F09400B, 0x080D0020,
+0x0C0F022C, 0x88000300, 0x00040F04, 0x02900413, 0x0404C006, 0xC8000038, 0x0D600004, 0x0002A400,
+0x080C07C8, 0x00140000, 0x0300040F, 0x0602F402, 0xB80004D8, 0x00040804, 0x0804C400, 0x0C0C0010,
+0x04FC0100, 0x1105000B, 0x0208F4C3, 0xFC000054, 0x00040004, 0x31050000, 0x1C4382C5, 0xC100F10A,
+0xBFFF4582, 0xCEFF4680, 0xC7FF558F, 0x000C4E88, 0x7EBE64F1, 0x89CCFF48, 0x3B81FF52, 0x427EFF00,
+0x2F53FF1E, 0x2738FF3B, 0x2328FF52, 0x2810FF60, 0x9A57FF56, 0x9843FF9B, 0x994BFF82, 0xA355FF82,
+0x812FFF8C, 0x7A1DFF6A, 0xB547FF65, 0xBC45FFA3, 0xC54CFFAD, 0xB942FFB7, 0xB548FFB0, 0xAA57FFB3,
+0x2100FFBF, 0x382BFF5B, 0x0D0BFF82, 0x1B28FF53, 0x0723FF59, 0x4772FF35, 0x7FB7FF5C, 0x7CBCFF6E,
+0x82C3FF53, 0x0205B44B, 0x44110500, 0x0CF105C4, 0xFF4383C3, 0xFF4681C5, 0xFF4780C3, 0xFF4981BE,
+0xFF4980C0, 0xFF487EC4, 0x2C467FC6, 0x05000405, 0x4084C171, 0x4581C7FF, 0x60000500, 0x00040F04,
+0x0164020D, 0x05FC4411, 0x40002C00, 0xFF4683C6, 0x04000008, 0x001C0400, 0x0F000C00, 0x00090004,
+0x200C0028, 0x00140000, 0x0100040F, 0x0800280C, 0x300C0010, 0x001C0400, 0x0E00180C, 0x60040010,
+0x025C0002, 0x04000406, 0x080502D4, 0x0C440303, 0x08050000, 0x10000004, 0x0004010A, 0x09FC7B10,
+0x4403B806, 0xFF407BC1, 0x08080504, 0x050C0000, 0x0004FC00, 0x08000004, 0x05000F05, 0x04440005,
+0x05044C00, 0x64000004, 0x49C80304, 0x040A1400, 0x94001414, 0x05040404, 0x04000800, 0xAE410508,
+0x04FF3968, 0x38693400, 0x0A0508FF, 0x393704FC, 0x09F0B1FF, 0x020A3800, 0xF40209E8, 0x000C0004,
+0x04005000, 0x68000004, 0x00040000, 0x3B71B741, 0x000004FF, 0x90030590, 0x04E80036, 0x0F000408,
+0x410104F4, 0xFF3D76BB, 0x58030004, 0x04F80049, 0x0004F400, 0xF8010004, 0x3E7B2D04, 0xA8000EC4,
+0x00040004, 0x0004B400, 0xAC080004, 0x000C0809, 0x1601A405, 0x0216D07E, 0xD8000950, 0x044C0406,
+0x1112C804, 0x04052041, 0x08080020, 0x04800E00, 0x0C003C06, 0xB404001C, 0x00080F04, 0x447F2106,
+0x84011250, 0x000C0F0C, 0x0D78000C, 0x08000400, 0x7800002C, 0x0E80040E, 0x0100080F, 0x0F08E400,
+0x12060004, 0x00039481, 0x080F02EC, 0x34061703, 0x00380000, 0x00051004, 0x40000508, 0x04FC0004,
+0x00092C00, 0xF0000018, 0x82C46204, 0x83C5FF41, 0x1400033C, 0x09FC0000, 0x4885C4B1, 0x417BBAFF,
+0x639FDDFF, 0x34001D8C, 0x86C53100, 0xF104704C, 0x366DB010, 0x082C68FF, 0x44436DFF, 0x422039FF,
+0x5E222AFF, 0x521F0AFF, 0x9A9958FF, 0x859B46FF, 0x04F10A00, 0xFF90A759, 0xFF6A802E, 0xFF6C7F25,
+0xFF96A23C, 0x00B6C252, 0x05040005, 0xB9450CF1, 0xC767FFAC, 0x7236FFCD, 0x2605FFA0, 0x3F30FF6B,
+0x0B08FF88, 0x161CFF56, 0xF0554C63, 0x67578401, 0x6A7EB9FF, 0x477AB9FF, 0x4586C8FF, 0x0000A4FF,
+0xC31000FC, 0x823004F8, 0x00C4FF45, 0x4284C1A0, 0x4085BEFF, 0xEC84BEFF, 0xFF4A5113, 0x184A7FC5,
+0x83C17105, 0x83BEFF43, 0x000F4445, 0xC9AE19D4, 0xC6FF4282, 0xC4FF4483, 0x00000484, 0x040F0048,
+0x2C0C0100, 0x00240F00, 0x00140F01, 0x0044000D, 0x0D00240F, 0x1500200F, 0x0C00FC00, 0xD8020004,
+0x01E80C01, 0x0600100A, 0x3C0002D0, 0x07800003, 0x03000403, 0x8400112C, 0x11940111, 0x010A1007,
+0x20030510, 0x0A10000F, 0x04193000, 0x1C0208B0, 0x05180614, 0x001C9000, 0x04062B7C, 0x3F540600,
+0x040F1800, 0x00000004, 0x00040005, 0x01050005, 0x39156B18, 0x040049D4, 0x00040005, 0x040F1804,
+0x08041420, 0x04FC0000, 0x3A69AF31, 0xF80022CC, 0x00040404, 0x0009F800, 0x040404F8, 0x09F00F00,
+0x04E80001, 0x0004F804, 0x10000008, 0x00040000, 0x0304F801, 0xE00C0500, 0x0500000E, 0x0104F804,
+0xF00404E8, 0x00080304, 0x0148AC00, 0xE4030004, 0x04F8000E, 0x01000400, 0xC40004FC, 0xC87C1A13,
+0x04F80009, 0x00000400, 0x040004F8, 0x04F00800, 0x08000C04, 0x0C0004F8, 0x06B40400, 0x06000802,
+0xD40404BC, 0x04C40C01, 0x0400100C, 0x080F0028, 0x540F1900, 0x80000602, 0x00040F12, 0x04E40400,
+0x0404F000, 0x9C000004, 0x00040008, 0x00001004, 0xDC0F0008, 0xC8000604, 0x00040B0D, 0x0003E401,
+0x040403E8, 0x03F00000, 0x2D12D000, 0x08904481, 0x0F00B00C, 0x02030324, 0xD80009E4, 0x05000804,
+0x2104D001, 0x045C4382, 0x00050004, 0x94000468, 0x13400003, 0x4884C231, 0xDF3113FC, 0x051C65A1,
+0x00032C00, 0x1CF10A14, 0xFF457FBE, 0xFF568BCD, 0xFF133977, 0xFF333D6E, 0xFF3B2647, 0xFF5A202C,
+0xFF511D08, 0xFF918D4E, 0xFF899C4B, 0xFF869B50, 0x0092A75A, 0x2835F005, 0x23FF6E81, 0x54FF7684,
+0x57FFB3C0, 0x48FFC0CD, 0x46FFB3C1, 0x3BFFAABC, 0x5EFFA2A3, 0x00FFCDAE, 0x19FF662E, 0x52FF772F,
+0x00FFAB58, 0x27FF5E05, 0x27FF6E21, 0x8FFF380C, 0xB9FF6C65, 0xBDFF6185, 0x8CFF4681, 0x83C86209,
+0x82C8FF44, 0xAC00000C, 0x09E00005, 0x3F86BE60, 0xE084BEFF, 0xFF485500, 0xE84881C6, 0x83C14004,
+0x0004FF47, 0x500FCC00, 0xFF4184C8, 0x0F0FD4C6, 0x00000500, 0x040004A4, 0x85C54000, 0x0004FF45,
+0x0F000C00, 0x00010004, 0x040F001C, 0x340F0900, 0x140F0100, 0x90003500, 0x01000001, 0x0C000404,
+0x100C01E4, 0x02140C00, 0x00001004, 0x04080C24, 0x11880100, 0x00165003, 0x04000504, 0x04FC0000,
+0x0016C800, 0xCC011E84, 0x05080316, 0x040A1404, 0x08000508, 0x050C0400, 0x06050400, 0x68000004,
+0xFF3E2035, 0x04000A10, 0x0A140000, 0x00000400, 0x040F04FC, 0x40000100, 0x00040422, 0x04050000,
+0x080C0004, 0x04F00805, 0x0404F400, 0xF8040004, 0x6DB25704, 0xE8B2FF3B, 0x09F0040E, 0x0104E804,
+0x71250A60, 0x04458038, 0xF80C0EE8, 0x528C0004, 0x40000404, 0xFF3D76B9, 0xBA310004, 0x09EC3E77,
+0x2104F001, 0x4DA83E77, 0x0004EC00, 0xF0040004, 0x13BC0F04, 0x050C000B, 0x0F21FC02, 0x000504EC,
+0xBC000EE4, 0x17740009, 0x0F087C00, 0x010D0004, 0x80130944, 0x080F0DA8, 0xDC000000, 0x00040908,
+0x0F04640B, 0x0F190490, 0x0D15002C, 0xC00404B8, 0x00080F04, 0x00640010, 0x00004001, 0x040B04EC,
+0x83C43100, 0x040E0446, 0x580004BC, 0x03140003, 0x0500040F, 0x04002000, 0x24040004, 0x04D80000,
+0x00043400, 0x1C0C0010, 0x00100000, 0x00001C00, 0x0C000004, 0x00040000, 0x83C200F1, 0x82C0FF46,
+0x83BFFF46, 0x9AD8FF48, 0x311D745E, 0x444286C7, 0x22A40009, 0x85C76EF0, 0x74B2FF50, 0x2E66FF4B,
+0x3B62FF15, 0x1F2CFF43, 0x1F0BFF55, 0x7B42FF56, 0x9C51FF84, 0x9A50FF8C, 0xA659FF88, 0x8735FF91,
+0x822AFF71, 0x811FFF6B, 0xC75CFF6B, 0xC351FFB4, 0xC24DFFB6, 0xB441FFB9, 0x8C21FFAA, 0xCC6BFF89,
+0xA965FFD6, 0x614AFFCC, 0x0807FFA5, 0x2524FF5E, 0x0D0FFF7B, 0x1F25FF5F, 0x1222FF66, 0x7597FF3B,
+0x82B3FF6F, 0x84C0FF5A, 0x85C9FF49, 0x84CCFF42, 0x1CCCFF44, 0x45842119, 0xBF80008C, 0xC1FF4485,
+0x9CFF4385, 0xC902F000, 0xC7FF4186, 0xC5FF4186, 0xC5FF4286, 0xC7FF4883, 0x85210004, 0x4F001C44,
+0xFF4485C5, 0x48290004, 0xFF4686C6, 0x0C0F0004, 0x1C040905, 0x00300000, 0x0F000C04, 0x00390008,
+0x040501A0, 0x46833000, 0x000220FF, 0x040F06CC, 0x7C000200, 0x10E80102, 0x000A1808, 0xEC020630,
+0x0510000B, 0x02086002, 0x780C0A18, 0x00100008, 0x0003B404, 0xBC000008, 0x00040808, 0x010A2000,
+0x30030004, 0x05140014, 0x00050C06, 0x980230C4, 0x0504003A, 0x0C000400, 0x14000A10, 0x0A140C05,
+0x03142001, 0x88005DD8, 0x00040018, 0x00050000, 0xB14A04F4, 0x04FF3B6C, 0xFF3A2400, 0xB31104FC,
+0xDC0013D8, 0x00040013, 0x020EF800, 0xE80013E4, 0x05580509, 0x040EE40B, 0xF00409E4, 0x04FC0009,
+0x0404F400, 0xFC000004, 0x00040004, 0x0004FC04, 0x04003514, 0x04F80400, 0x211DAC01, 0x22AC407B,
+0x0013CC04, 0x040404CC, 0x00140400, 0x0F014800, 0x000B0004, 0x94020BA0, 0x04DC0F1C, 0x01F8001D,
+0x0304EC09, 0x180017E0, 0x00040400, 0x0F046000, 0x010D0004, 0x30000480, 0x00040F02, 0x003C0F00,
+0x00580F29, 0x001C0109, 0x0004F000, 0x08000074, 0x00040700, 0x0102D800, 0x84210004, 0x040DF044,
+0x4C0004BC, 0x03000503, 0x0008D40F, 0x00002000, 0x24060004, 0x00431100, 0x04E00409, 0x00001C00,
+0x20040004, 0x000C0000, 0x0420C710, 0x04428321, 0x54C21009, 0x4985E100, 0x4480BCFF, 0x548CC9FF,
+0x5894D0FF, 0xC8401D74, 0x28FF4589, 0xC970F10A, 0xC4FF4B88, 0xC4FF4C83, 0x8EFF5484, 0x70FF2C50,
+0x2FFF3B42, 0x12FF4E1F, 0x3AFF5722, 0x57FF7A6E, 0x4EFF919C, 0x57FF8797, 0x3FFF91A3, 0x2EFF798E,
+0x22FF6C84, 0x47FF6780, 0x5BFF98AF, 0x5AFFBDC9, 0x24FFC2CA, 0x69FF8B93, 0x78FFCED6, 0x7BFFE0E3,
+0x00FFE1CC, 0x31FF5213, 0x42FF9037, 0x35FFA344, 0x0CFF9335, 0x1DFF630D, 0x2BFF5316, 0xA2FF2D15,
+0xB4FF747E, 0xC3FF5880, 0xCBFF4A84, 0x05004584, 0x4783CB90, 0x4784C7FF, 0x0004C3FF, 0xFF4486A2,
+0xFF4087C7, 0x083E88C7, 0x42862100, 0x2000001C, 0x05180000, 0x00051401, 0x040F00E0, 0xC43F0800,
+0x05204384, 0x86C64202, 0x0004FF45, 0x0B05000F, 0x0004EC00, 0x4C000004, 0x00080001, 0x3D00040F,
+0x0F005800, 0x01010004, 0x04030220, 0x000C0C05, 0x0002FC01, 0x811E0258, 0x140214C8, 0x0504060A,
+0x01072000, 0x8C0F0C20, 0xB801001B, 0x0F200303, 0x0004FC08, 0x1801000C, 0x34E8000A, 0x08050007,
+0x18040504, 0x14280C0F, 0x00050800, 0x040004FC, 0x05000000, 0x04000800, 0x10000004, 0x00040000,
+0x00050808, 0x040004FC, 0x04FC0400, 0x6104F401, 0xB3FF3B6D, 0x00043C6E, 0x0009FC00, 0xE0000004,
+0x0004000E, 0x0009F800, 0xFC000004, 0x00040104, 0x0013E00F, 0x0004FC04, 0xF8080008, 0x04F00004,
+0x40000408, 0xFF3F78BB, 0xF00004F0, 0x00040009, 0x04000C00, 0xE00004F8, 0x09FC0004, 0x00000800,
+0xF8000004, 0x09C80004, 0x00000400, 0x3400000C, 0x00040006, 0x04001000, 0xA8000004, 0x09E0000E,
+0x0004E804, 0x600F000C, 0xE0080D04, 0x01D80104, 0x0F042807, 0x31510010, 0x684784C5, 0x02640407,
+0x0400740C, 0x080F0018, 0x84312200, 0x0060FF44, 0x07047800, 0xF0080004, 0x04AC0202, 0xA8FF432F,
+0xDC0F0503, 0xE0000D08, 0x040C0004, 0x02002806, 0x10040DF0, 0x00580000, 0x4687C731, 0x40000568,
+0x87C6B113, 0x7FBBFF4B, 0x9FDCFF43, 0x620E8067, 0xFF4686C3, 0x095C85C2, 0xB2139000, 0xFF4984C6,
+0xFF4B80C2, 0x085687CA, 0x2868F02D, 0x2016FF4B, 0x5E2FFF4F, 0x9C59FF6C, 0x954DFF97, 0xA155FF88,
+0x9547FF8F, 0x832FFF7E, 0x862BFF6B, 0x9937FF6D, 0xCB62FF83, 0xB74BFFBC, 0xD971FFAB, 0xD36AFFCE,
+0xBE4AFFC8, 0xC766FFB1, 0x693AFFD1, 0x2F1CFFA1, 0x1A10FF8A, 0x2929FF8C, 0x333DFF9B, 0x1F2EFF8D,
+0x0B1BFF63, 0x1C35FF41, 0x82ABFF38, 0x83B8FF79, 0x80BEFF5E, 0x86C7FF4A, 0x82C6FF49, 0x86CCFF47,
+0x13DCFF4A, 0x89CC08F1, 0x88C6FF44, 0x89C4FF41, 0x87C8FF41, 0x86CAFF43, 0x85C8FF45, 0x40143846,
+0xFF4188C8, 0xC6330004, 0x04C84387, 0x0F04D004, 0x00630008, 0x50020164, 0x00800F05, 0x00380C1B,
+0x01021C08, 0x8421000C, 0x00024447, 0x04000248, 0x02880C00, 0x03076801, 0xBC08050C, 0x03580402,
+0x020F4404, 0x28060518, 0x03AC0029, 0x030A2001, 0x34041430, 0x0008000F, 0x00111000, 0x080003DC,
+0x12DC0005, 0x00000C00, 0x100103F4, 0x28500304, 0x080F2804, 0x18080500, 0x0508000F, 0x0C00040C,
+0x0C000508, 0x04F80605, 0x09F03C12, 0x0004FC07, 0x040409F8, 0x04FC0400, 0x0404F401, 0x723013DC,
+0x0EE8FF3C, 0x00000400, 0x040009E8, 0x04F40000, 0x0C000408, 0x000009F0, 0x04F80005, 0x21000401,
+0x05003E79, 0x0404F800, 0x00000004, 0x7CC02205, 0xF80C187C, 0x01340004, 0x0004EC04, 0x4001063C,
+0xC07F1201, 0x138C0413, 0x0004FC04, 0x84000008, 0x01A00901, 0x0301A804, 0x1C000008, 0x01B40805,
+0x0C000C04, 0x100F01E4, 0x9C004E00, 0x076C0004, 0x05000803, 0x3C000278, 0x02800012, 0x0000080F,
+0x03009401, 0x300F04E0, 0x34000200, 0x00040F00, 0x08480208, 0x0F04AC00, 0x002B0DC0, 0x04000418,
+0x037C0600, 0x0608D004, 0x04020388, 0x4704F005, 0x4787C5FF, 0x4581BFFF, 0x4A86C2FF, 0x639BD6FF,
+0x04ECBEFF, 0xFF478592, 0xFF4688C5, 0x050487C5, 0x4A87CA31, 0x18F10484, 0xFF4F8ACE, 0xFF3A5992,
+0xFF4C3758, 0xFF482221, 0xFF5F5025, 0xFF999A58, 0xFF8D9951, 0xFF87994D, 0xFF869C51, 0x08667E30,
+0x223CF11E, 0x69FF677B, 0x70FFBECF, 0x5AFFCDDA, 0x4CFFB9C1, 0x4AFFACB8, 0x5BFFB0C2, 0x3DFFC6C5,
+0x00FFA67D, 0x19FF5603, 0x13FFA429, 0x30FF9918, 0x44FF9229, 0x3AFF8836, 0x23FF6524, 0x4AFF3308,
+0xAEFF3928, 0xB9FF7A83, 0xC2FF5A83, 0x09F84983, 0x40058800, 0xFF4285CB, 0xFC000EF8, 0x88C43104,
+0x3104F842, 0x084884CA, 0x04F40000, 0x4289C740, 0x000004FF, 0xFC06000C, 0x00F40600, 0x1500140F,
+0x08048000, 0x380F0004, 0x280C1500, 0x00440400, 0x04001808, 0x080C0014, 0x00240800, 0x04000C0E,
+0x080301C0, 0x48852900, 0x04000500, 0x00040805, 0x4782C449, 0x340004FF, 0x48FF4683, 0x00080003,
+0x00050004, 0x04040008, 0x00080005, 0x0103B004, 0x040B0F28, 0x05000805, 0x08050400, 0x04000500,
+0x0004080A, 0x08050000, 0x04000004, 0x00040005, 0x000F1400, 0x040F0004, 0x0C040505, 0x09E80405,
+0x34000809, 0xF8FF3A6F, 0x70B47204, 0x71B4FF3B, 0x401DCC3A, 0xB8FF3B71, 0x722104F4, 0x0031A03C,
+0x040404F0, 0x04F40400, 0x0518D404, 0x783004F8, 0x531CFF3D, 0x3E79BB44, 0x000004FF, 0x04094420,
+0x3E7B2100, 0xB4005CB0, 0x7DBE4057, 0x13ACFF40, 0x0000040C, 0x040C09CC, 0x04E40000, 0x011D0000,
+0xD40704C8, 0x00140004, 0x0004F800, 0x08000198, 0x00040800, 0x08001400, 0xA4000004, 0x00040401,
+0x00045401, 0x7400209C, 0x00040F04, 0x0D280114, 0x0F0D2C00, 0x00240004, 0xC2400E14, 0x08FF4385,
+0xC300F100, 0xC3FF4486, 0xC4FF4585, 0xC4FF4587, 0x00084686, 0x00001000, 0x10040018, 0x00080000,
+0x04001000, 0xFC010018, 0x44852304, 0x80001244, 0x02B80003, 0x0F000800, 0x00180004, 0x040F08C4,
+0xC9402400, 0x04FF4488, 0x03640400, 0x0004E400, 0x10040004, 0x00080000, 0x310A0C00, 0x004888C6,
+0xC30AF005, 0xBFFF4985, 0xDAFF4783, 0xBCFF679F, 0xC2FF4782, 0xC8FF4785, 0xC3FF498B, 0x87700500,
+0x89CBFF41, 0x1890FF48, 0x8ACE6AF0, 0x7BB7FF49, 0x3B6AFF51, 0x2633FF43, 0x441DFF3E, 0x9956FF52,
+0x964DFF9A, 0xA056FF8C, 0x9D55FF8E, 0x7F37FF89, 0x803BFF69, 0x9849FF6C, 0xC966FF85, 0xCB5EFFB5,
+0xB144FFBB, 0xB643FFA9, 0xC043FFAD, 0xCA59FFAC, 0x8C3CFFC0, 0x1700FFA5, 0x2A11FF5B, 0x1C12FFA2,
+0x1912FFAA, 0x2228FF9E, 0x4569FF87, 0x2852FF79, 0x0826FF47, 0x2848FF33, 0x8CBEFF41, 0x87C3FF76,
+0x84C0FF53, 0x41894001, 0x0F94C6FF, 0xFF438780, 0xFF4389C7, 0x1000E4C7, 0x51142886, 0x87C9FF4A,
+0x31001046, 0xB84488C5, 0x00E00005, 0xA900040F, 0x0205000E, 0xD4040238, 0x07280200, 0x0B025400,
+0x85400004, 0x1CC6FF48, 0x48832105, 0x18001514, 0x00040115, 0x0C0CD00F, 0x00038C04, 0x14001BC8,
+0x05000005, 0x05337C00, 0x38030004, 0x08E0002F, 0x1104F802, 0x0034543E, 0x0C00000C, 0x0A100005,
+0x02000402, 0x0C082BE4, 0x000C0005, 0x04142404, 0x40000F20, 0x2C380422, 0x08000800, 0x08003148,
+0x04F8095E, 0x070EF400, 0x040004FC, 0x72B54005, 0x0004FF3B, 0x4004F805, 0xB9FF3D73, 0x74340004,
+0x04F4FF3B, 0x04000804, 0xD40004FC, 0x09E80013, 0x21000401, 0x04F83D78, 0x3004F009, 0x24FF3F7A,
+0x04F00044, 0x00000404, 0x040004F8, 0x04F80C00, 0x0F001004, 0x000204FC, 0x7F2118A0, 0x04259C44,
+0x0C000158, 0x00040005, 0x00001000, 0x080004E8, 0x00040000, 0x08000C00, 0xAC0F0004, 0x00000101,
+0x06DC0805, 0x11000C0F, 0x1D05000F, 0x0521FC00, 0xE4030004, 0x04F00104, 0x0304F400, 0xE0010004,
+0x03880004, 0x04448621, 0x00200C05, 0x0F001008, 0x0F0502C0, 0x040D0018, 0xDC0002E0, 0x00040F03,
+0x04FC0129, 0x13288810, 0x54FF4620, 0x04FC0000, 0x00000400, 0x0400000C, 0x88C83100, 0x40130047,
+0xFF4989C7, 0xC6B10EEC, 0xC5FF4B89, 0xD4FF4F8C, 0x05005F9A, 0x01051000, 0x88210500, 0x310E6842,
+0x904588CC, 0xCB7FF018, 0xCAFF468A, 0x77FF5B8D, 0x4CFF343F, 0x14FF3D33, 0x5CFF3E35, 0x53FFA09C,
+0x4EFF909A, 0x58FF8698, 0x3AFF8CA0, 0x67FF6D81, 0x40FF93A8, 0x32FF768B, 0x5CFF7F93, 0x48FFB9C9,
+0x4CFFB0B8, 0x4FFFBAC3, 0x50FFB9CE, 0x73FFB7C4, 0x03FFD9CB, 0x02FF723B, 0x05FF8B1D, 0x11FF9A10,
+0x26FFAA1E, 0x4EFF9325, 0x7FFF5D2B, 0x49FF6C52, 0x31FF4A24, 0x5DFF2B0D, 0xBDFF3433, 0xBAFF738E,
+0xC1FF4F87, 0xBFFF478D, 0xC5FF4385, 0xCAFF458A, 0xCAFF438A, 0xA018EC89, 0x86C5FF49, 0x87C7FF4A,
+0x00D4FF47, 0x0005D000, 0x0C000004, 0x00040F00, 0x0118001D, 0x0F000404, 0x0C1D003C, 0x48040030,
+0x00080F00, 0x00300805, 0x0500240F, 0x0B00180F, 0x00F44711, 0x0900F800, 0x2C000004, 0x48852210,
+0x0C001034, 0x49842105, 0x14010510, 0x083C0305, 0x0D035000, 0x30030004, 0x1068000A, 0x001E7800,
+0xFC00141C, 0x00040015, 0x12050401, 0x02285C80, 0x40110DDC, 0x0C0004FC, 0x00040005, 0x00050404,
+0x1C000508, 0x0004000E, 0x080F0800, 0x04000004, 0x00040005, 0x00050804, 0x04040500, 0x05000000,
+0x04000404, 0xE4000508, 0x00040804, 0x0309F001, 0xF80009F4, 0x73B64009, 0x0004FF3C, 0x01050000,
+0xFC0004F8, 0x3D732104, 0xF80075F4, 0x66DC007A, 0x40000400, 0xFF3F76B9, 0xF4010004, 0x3E773004,
+0x040008FF, 0xFC040EE4, 0x04F40F04, 0x3F280005, 0x3F7FBF4F, 0x010004FF, 0x0004F80C, 0xF8010010,
+0x43802209, 0x94031CBC, 0x0EEC0118, 0x0013BC0F, 0x00018004, 0x04001C78, 0x04B00F00, 0x45852102,
+0x54010978, 0x000C0F09, 0x0980021C, 0x000E4800, 0x240A0738, 0x001C0007, 0x00074008, 0x040C0010,
+0x04A80F00, 0x09340005, 0x0F000400, 0x0F050020, 0x040D0018, 0x280402D4, 0x00100400, 0x4900080F,
+0x020EC802, 0x0C010EE8, 0x46886100, 0x4889C9FF, 0xE400145C, 0x87C43104, 0xF1273C47, 0x66A3DC14,
+0x4A85BFFF, 0x4C87C1FF, 0x4B87C3FF, 0x4789C5FF, 0x4389C5FF, 0x438AC8FF, 0x4388CBFF, 0x4487CBFF,
+0x14F10980, 0xFF558DCA, 0xFF4A66A7, 0xFF3A4267, 0xFF363219, 0xFF9A985D, 0xFF8C9752, 0xFF899B51,
+0xFFA5B76D, 0x048FA35B, 0x3146F00A, 0x26FF687F, 0x64FF7185, 0x4CFFBDCE, 0x48FFB1BE, 0x45FFB5C0,
+0x42FFB4C5, 0x59FFAEB7, 0x06FFBBAF, 0x0DFF6A3D, 0x0FFF8021, 0x08FF9017, 0x1EFF9014, 0x45FF8921,
+0x64FF6C31, 0x82FF573D, 0x60FF4F4A, 0x27FF342D, 0x4EFF290B, 0xBEFF4733, 0xBFFF7691, 0xBEFF5286,
+0x0CF003D4, 0xCCFF4789, 0xCAFF418B, 0xC3FF418B, 0xC1FF458A, 0xC3FF4A88, 0xC6FF4A88, 0xACFF4A87,
+0x88CB3219, 0x4F050C49, 0xC6FF4789, 0x44040004, 0xFF488AC7, 0x240F0004, 0xC74F0100, 0x04FF468A,
+0x84000500, 0x00040F0A, 0x007C004D, 0x0300640A, 0x94001090, 0x00040F10, 0xE8871209, 0x05140501,
+0x03051000, 0xE40C1ECC, 0x00100402, 0x00166C01, 0x040711E8, 0x1B7C0000, 0x00000400, 0x04082084,
+0x0A180100, 0x000A0C03, 0x0000050C, 0x00040405, 0x06050800, 0xC8040004, 0x220C0030, 0x00000402,
+0x04041428, 0x18580000, 0x04000400, 0x08040504, 0x09AC0000, 0x0F09B800, 0x310104FC, 0xF43C71B5,
+0x09F80009, 0x0004FC00, 0xFC040004, 0x04F40004, 0x00000408, 0x040004F4, 0x70680000, 0x01000400,
+0xE00004F4, 0x00040352, 0x2104FC09, 0x0EE8407B, 0x0409E800, 0xF4040004, 0x3E5C0104, 0x04408029,
+0x00140005, 0x1904EC0F, 0x040EC800, 0x080804F0, 0x09C80000, 0x0104F80C, 0x80000984, 0x00040B09,
+0x0005040C, 0x040F0E70, 0xE0080900, 0x020C0504, 0x07348716, 0x0F002008, 0x0003000C, 0x04060538,
+0x04A00C00, 0x4D04C00F, 0x00082008, 0x800C000C, 0x00100400, 0x0F001C00, 0x05090004, 0x883003DC,
+0x0918FF48, 0x00001004, 0x44010500, 0x8A01F000, 0x87C3FF48, 0x86C3FF45, 0xA8E3FF48, 0x38BAFF6A,
+0x4C898024, 0x4B89C4FF, 0x0528C4FF, 0xFF458B61, 0x00448BCB, 0xCA98F105, 0xC3FF4589, 0xC4FF4789,
+0xD0FF4C88, 0x6BFF608B, 0x21FF283F, 0x60FF2E2F, 0x5AFF9593, 0x76FF909C, 0x5AFFACC1, 0x2CFF97A8,
+0x39FF6678, 0x35FF6E84, 0x27FF6D86, 0x57FF6D82, 0x4FFFABBD, 0x48FFB1C2, 0x47FFB4C4, 0x40FFB5C4,
+0x4AFFA9B0, 0x23FFA99F, 0x08FF815A, 0x10FF6F19, 0x09FF8212, 0x0BFF8B12, 0x22FF7D10, 0x51FF6518,
+0x96FF5330, 0x88FF4154, 0x49FF3048, 0x28FF4229, 0x67FF3210, 0xBDFF4240, 0xBFFF748B, 0xC7FF5986,
+0xCBFF4D89, 0xCBFF458A, 0xC4FF428C, 0xC2FF458C, 0xC6FF488B, 0xC7FF4989, 0xC9FF4B88, 0x05DC4989,
+0x0F04DC04, 0x20250008, 0x10008BC8, 0x00000402, 0x040F048C, 0xC4002500, 0x003C0F04, 0x00180001,
+0x0F000400, 0x0001001C, 0x80000014, 0x00080000, 0x04000404, 0x080F01B8, 0xD8040500, 0x0BE40006,
+0x02000400, 0xFC0002F4, 0x02F4000B, 0x02000802, 0x0C0A02B4, 0x02FC0008, 0x0B050801, 0x14000F20,
+0x05180000, 0x08050400, 0x38040004, 0x0508001E, 0x0C050000, 0x0C000004, 0x00140005, 0x08191800,
+0x14000004, 0x0004000A, 0x00050004, 0x00001858, 0x00040005, 0x0004FC00, 0x04000008, 0x0EA40000,
+0x00050400, 0x040409E4, 0x04F00000, 0x00000400, 0x040004F0, 0x74B74400, 0x0004FF3D, 0x04050000,
+0xBB1004F8, 0x04038EBC, 0x04F40000, 0xA98E8C01, 0xB9FF4077, 0xBCFF4178, 0x00044079, 0x0009F401,
+0x7D3022C8, 0x04F4FF40, 0x0600AC00, 0x411118C4, 0x5C0504F0, 0x50801243, 0x04F8013F, 0x00438800,
+0xE8030004, 0x04DC0009, 0x01000404, 0x480304DC, 0x000C010B, 0x00065003, 0x500004E8, 0x00040801,
+0x0904BC0F, 0x11001C0F, 0x0F01E400, 0x01090004, 0x140003DC, 0x00040312, 0x0C04240C, 0x100F0020,
+0x44081100, 0x00300800, 0x00001808, 0x1C04000C, 0x000C0000, 0x0F00040F, 0xC8FF484E, 0x00000488,
+0x180F03C8, 0x140F0100, 0x30000500, 0x00040800, 0x0003F805, 0x89210418, 0x01042049, 0xF8030424,
+0x00980008, 0x4A8BCB31, 0xE8000920, 0xC702F004, 0xDBFF4C8A, 0xC2FF62A0, 0xC1FF4D88, 0xC2FF4B88,
+0x89A10F10, 0x8ACDFF47, 0x8ACFFF45, 0x00000844, 0x80F1037C, 0xFF498AC0, 0xFF4987C0, 0xFF548BCE,
+0xFF385C8C, 0xFF212620, 0xFFACAA81, 0xFFA3B173, 0xFF81964B, 0xFFA5B364, 0xFF748332, 0xFF6F8636,
+0xFF6E8734, 0xFF6B832D, 0xFF8AA03C, 0xFFB5CC57, 0xFFB2C649, 0xFFA5B23E, 0xFF9DA039, 0xFFB6AE59,
+0xFF977339, 0xFF5B0A00, 0xFF730302, 0xFF7F0000, 0xFF890C08, 0xFF861B21, 0xFF693452, 0xFF305397,
+0xFF18519E, 0xFF37467F, 0xFF3C2B55, 0xFF300E2F, 0xFF5B456B, 0xFF748ABC, 0xFF5283BE, 0xFF4D89C8,
+0x34478BCA, 0xA4C91041, 0x0F140005, 0xFF468CB0, 0xFF458DC7, 0xFF468CC7, 0xDC000440, 0x00040F0A,
+0x04FC0227, 0x0F004802, 0x0423000C, 0x080404BC, 0x004C0000, 0x00000C08, 0x040F0010, 0x30040D00,
+0x00080E00, 0x000AC006, 0x9C0001EC, 0x00040E01, 0x01E04511, 0x01151400, 0x10070294, 0x00100111,
+0x050C8710, 0x1107E404, 0x05250C46, 0x2C0403A4, 0x1BFC000F, 0x04000407, 0x0808050C, 0x050C0005,
+0x00000400, 0x040404F8, 0x05080000, 0x02000402, 0x60001D34, 0x00040004, 0x01050400, 0x7C000004,
+0x3F7A2104, 0x80001384, 0x04A00418, 0x0009A800, 0xEC0F0EA4, 0xF4040109, 0x00080404, 0x3F74B853,
+0x0004BAFF, 0x0004FC00, 0x040409F0, 0x04FC0000, 0x3F79B931, 0xBA2204FC, 0x4104FC7A, 0xFF417ABD,
+0xF0000004, 0x00800009, 0xD4417C25, 0x04FC0418, 0x001DCC00, 0x000004E8, 0x0008000A, 0x083F4800,
+0x0C050004, 0x0EE0030B, 0x0104E808, 0x0007000C, 0x04F80005, 0x00107800, 0x58040004, 0x06700001,
+0x04069C00, 0xC40D04E4, 0x0BDC0304, 0x0D002000, 0xDC03001C, 0x00180F0B, 0x01E00411, 0x00000800,
+0x040F03EC, 0x9C002700, 0x125C0204, 0x2700440F, 0x0700400F, 0x0004B408, 0xE004000C, 0x000C0004,
+0x2100040F, 0x4A8ACA40, 0x000004FF, 0x04010314, 0x05000000, 0x004B8827, 0x0DD80205, 0x05043C00,
+0x8D100004, 0x43514580, 0x67A5E0FF, 0xC4D00F00, 0xBFFF4E8B, 0xC6FF4889, 0xCEFF468B, 0x89610004,
+0x8CCDFF44, 0x800F1048, 0xFF4C8BC0, 0xFF4D8AC1, 0x0EF32330, 0xFF5D87B9, 0xFF6B747D, 0xFF7F7F63,
+0xFF86955A, 0xFF869B4C, 0xFFABBA69, 0xFF6F812D, 0x10050034, 0xF1050433, 0xFF728B49, 0xFFB6CE5C,
+0xFFA9BD44, 0xFF9FAB3B, 0xFFB7BC55, 0xFFD3CF76, 0xFF957538, 0xFF651401, 0xFF922425, 0xFFAA302B,
+0xFFAF342F, 0xFF9E2A2D, 0xFF62233E, 0xFF2E569B, 0xFF0551A5, 0xFF1B4994, 0xFF313B76, 0xFF452348,
+0xFF350E2D, 0xFF58517A, 0xFF748CBC, 0xFF5586C0, 0x3000ECC8, 0xA4CCFF49, 0x8D02F000, 0x8ECAFF43,
+0x8FC5FF42, 0x8FC3FF42, 0x8CC7FF43, 0x491104B4, 0x040F19C4, 0xC9332105, 0x0544488C, 0x0F004800,
+0x08230004, 0xE80804B4, 0x00180004, 0x00001008, 0x7000000C, 0x00040800, 0x00001400, 0x040C0028,
+0x00180000, 0x06000402, 0xE80100DC, 0x048A1001, 0x0FF0080B, 0x0604FC00, 0xCC000004, 0x00040029,
+0x03165405, 0x20000818, 0x00040003, 0x09039800, 0x44000004, 0x0A140019, 0x0004FC07, 0x04040A10,
+0x38600000, 0x01050404, 0x8112142C, 0x000F285C, 0x5C000105, 0x04FC0004, 0x00000404, 0x4C000500,
+0x22540022, 0x0C0E8804, 0xB7530500, 0xB7FF3E70, 0xF4000EF0, 0x75B54009, 0x0004FF3B, 0x0027B800,
+0xFC0013D8, 0x74B94004, 0x0004FF42, 0x4375BA72, 0x4176BAFF, 0x7840987C, 0xF8B8FF41, 0x3F792104,
+0x580161F0, 0x0C7A1200, 0x09F40000, 0x04F4BE10, 0xFF427D40, 0x000004BF, 0x040B48F0, 0x04F40000,
+0x00000400, 0x140004F4, 0x48780035, 0x00000400, 0x040413C8, 0x09F00000, 0x0004EC01, 0x833030A8,
+0x4434FF47, 0x0100040C, 0x85350EC8, 0x0008FF48, 0x000ED00B, 0x040004E0, 0x04CC0F00, 0x0DB80111,
+0x0F0DC004, 0x00140008, 0x380417D8, 0x000C0400, 0x04006C04, 0x080F0018, 0xF8001200, 0x00740321,
+0x0F004800, 0x03160004, 0x9C040968, 0x00080002, 0x2103880F, 0x00003408, 0x04000044, 0x00140000,
+0x04000800, 0x10000004, 0x00040C00, 0x498ACA31, 0xC8310508, 0x092C4C89, 0x5009E000, 0xFF498BC7,
+0x62091CC8, 0xCBFF438E, 0x13D8468D, 0x09448D12, 0x9FDC10F1, 0x8DC8FF5F, 0x8AC4FF4F, 0x86BFFF4F,
+0x8CC3FF48, 0x8BC6FF47, 0x8ACEFF45, 0x89CDFF47, 0xF1050C46, 0x4B8CC424, 0x4F8BC1FF, 0x4B82BAFF,
+0x72A8E4FF, 0x81A9DAFF, 0x2C3852FF, 0x595C53FF, 0x8B9D61FF, 0x849C46FF, 0xACC06BFF, 0x738732FF,
+0x728B37FF, 0x6C8935FF, 0x50F10004, 0xFF688227, 0xFFAABD54, 0xFFAABB49, 0xFFB1BF4D, 0xFFC2CE60,
+0xFFB9BD5E, 0xFF896B2B, 0xFF802918, 0xFF932528, 0xFF821B16, 0xFF6F0704, 0xFF7D1015, 0xFF551633,
+0xFF284A8A, 0xFF0957AC, 0xFF0B51A9, 0xFF1F4B96, 0xFF393768, 0xFF482B49, 0xFF350F26, 0xFF655570,
+0xFF6D8FBF, 0xFF4D8BC6, 0xA84A8AC7, 0xC908FF13, 0xCEFF408A, 0xC2FF4692, 0xC6FF3F8C, 0xC8FF4692,
+0xC8FF478D, 0x0004488D, 0x046C0806, 0x11000C0F, 0x02047402, 0x300F0508, 0x280F0900, 0x38082500,
+0x04F40100, 0xC4478C21, 0x05C80005, 0x08000400, 0x0C0A0020, 0x05080600, 0x00020408, 0x20040A0C,
+0x00080002, 0x0010F000, 0xC4040004, 0x08840007, 0x0900040F, 0x00039C00, 0x14040004, 0x08C00405,
+0x00050004, 0x040008DC, 0x040C0004, 0x04000400, 0x1800041C, 0x04400413, 0x040E4000, 0x08040510,
+0x050C0000, 0x04000400, 0x0800050C, 0x00040405, 0x04051000, 0xB8640F18, 0xB8FF3F71, 0x910EE872,
+0x76B6FF3B, 0x77B6FF3C, 0x0136A03B, 0x752309E4, 0x2004FC40, 0x0500FF44, 0x0500B814, 0x5604FC00,
+0xBAFF407A, 0x0004F47B, 0x040004F8, 0x04FC0F00, 0x18B80001, 0x00000408, 0x040004F8, 0x04FC0400,
+0x003A0000, 0xE4000004, 0x00040400, 0x0400F800, 0xF8040004, 0x84C34104, 0x0004FF48, 0x1C508510,
+0xC5FF4840, 0x071B9886, 0xBC0F0004, 0x900F1009, 0x8C031204, 0x002C0F04, 0x04A8000D, 0x00002404,
+0x0400000C, 0x00100C00, 0x0F001400, 0x21060004, 0x12504B88, 0x01125400, 0x48000004, 0x00040F09,
+0x08880004, 0x04000404, 0x8C080050, 0x000C0F02, 0x8CC93F29, 0x2208C44A, 0x01050000, 0x20010078,
+0x00440004, 0xC8FF4B30, 0xF000004C, 0x208E1004, 0xFF454004, 0x22FC8FCD, 0x04404111, 0x68A8E531,
+0xFC0013F4, 0xCA01F00E, 0xC1FF5391, 0xC8FF458A, 0xD0FF4990, 0x4CFF4D8E, 0xC598F100, 0xBBFF498B,
+0xCCFF4485, 0xEAFF5A96, 0xC7FF7AB3, 0xB8FF568E, 0x92FF5886, 0x35FF556B, 0x60FF2432, 0x42FF8497,
+0x78FF8397, 0x3CFFBCCE, 0x35FF7F93, 0x37FF7089, 0x34FF6E8B, 0x2CFF6B88, 0x3EFF6B85, 0x5CFF90A2,
+0x4EFFB7C7, 0x46FFADBE, 0x54FFA3B0, 0x2EFFABB0, 0x00FF876E, 0x09FF6310, 0x09FF7306, 0x0DFF740E,
+0x34FF7711, 0x2EFF962D, 0x94FF4B10, 0xB3FF2B50, 0xB0FF0459, 0xA7FF0050, 0x90FF0E50, 0x54FF3250,
+0x36FF332B, 0x24FF5324, 0x86FF3E13, 0xC3FF5F63, 0xC1FF7193, 0xCAFF5886, 0xCDFF508C, 0xC9FF4B91,
+0x04FC438F, 0xBC8EC322, 0x8FCA4F00, 0x0004FF4A, 0x8ECB4805, 0x0004FF4A, 0x498DCA48, 0x080004FF,
+0x0C00001C, 0x001C0800, 0x09000C0F, 0x0F051C0C, 0x0805002C, 0x24040028, 0x00140800, 0x0805BC0C,
+0x0C08001C, 0x01E40100, 0x0B06D800, 0xF4000004, 0x00040004, 0x00002004, 0x040001C4, 0x05040000,
+0x00000402, 0x28001528, 0x0CE0001A, 0x0000040A, 0x2C050518, 0x193C0308, 0x04050800, 0x08010504,
+0x0F200400, 0x0028580B, 0x04000508, 0x04440005, 0x04519C00, 0x080604F8, 0x44C80600, 0x00050801,
+0x04072C54, 0x05040400, 0x3E73B741, 0x210004FF, 0x8E303D74, 0x35050000, 0x003C78B7, 0xBB04F105,
+0xBCFF4075, 0xBCFF4176, 0xBBFF4375, 0xB9FF4476, 0x0EEC4277, 0x407AB940, 0x310004FF, 0xCC407CBB,
+0x04F40022, 0x01000400, 0xF40309F0, 0x04F00909, 0x0722AC00, 0xC0000004, 0x04E80000, 0x0009F400,
+0x9C0004F8, 0x0004001D, 0x0004F004, 0xFC040008, 0x00080005, 0x0018C004, 0xF40009E8, 0x87C44004,
+0x0004FF49, 0x00000C00, 0x74040144, 0x00080F04, 0x043C0411, 0x3500080F, 0x00007404, 0xA0000050,
+0x00080404, 0x00000C0C, 0x040F0010, 0x88033600, 0x04B80002, 0x04000400, 0x080F0280, 0x472A1F00,
+0x0202E8FF, 0xFC00087C, 0x00180807, 0x07000C0F, 0x00404A12, 0x6104F000, 0xCAFF478F, 0x03E0488E,
+0x4C8CC940, 0x000004FF, 0x34010864, 0x488EC004, 0x4A8FC8FF, 0x67A8E2FF, 0x1210C1FF, 0xFF4D8E30,
+0xEC0013E4, 0x8EC63209, 0x30002C4D, 0x10FF4C8D, 0xB1E7C000, 0xA4DAFF70, 0x87BDFF67, 0x0510FF48,
+0x88C07CF2, 0x8CBBFF4D, 0x2A37FF66, 0xA37AFF10, 0x9E52FF94, 0xEF99FF93, 0x9A42FFE5, 0x8B35FF8C,
+0x8F39FF73, 0x8733FF71, 0x8930FF6A, 0x8B26FF6F, 0xBB51FF76, 0xAE47FFAA, 0x9D3FFF9F, 0x9C4BFF92,
+0x4610FF99, 0x1807FF5F, 0x0A09FF61, 0x0B04FF72, 0x2D28FF80, 0x181FFFA0, 0x1434FF80, 0x569FFF43,
+0x60BFFF24, 0x5DC1FF00, 0x5CBBFF04, 0x4FA2FF0D, 0x4A86FF11, 0x223AFF32, 0x1E29FF42, 0x1425FF56,
+0x6686FF40, 0x8CC4FF79, 0x86C7FF79, 0xA10A0C59, 0xC7FF488F, 0xC8FF4A91, 0x00D44B92, 0x0504FC0F,
+0x0100180F, 0x0804E400, 0x24040004, 0x90CB3F00, 0x0605444B, 0x0F002404, 0x3F3D0008, 0x74498EC9,
+0x1C000600, 0x00040000, 0x0205340F, 0x0F19B407, 0x00090270, 0x0C000518, 0x00040205, 0x1A344A13,
+0x04050C0A, 0xC400033C, 0x00040403, 0x010A1008, 0x040712D4, 0x04180005, 0x00000400, 0x0401043C,
+0x43832100, 0x30004CBC, 0x050C0213, 0x08FF4120, 0x13600000, 0x00000404, 0x04050500, 0x427D7000,
+0x427DC1FF, 0x000A0CFF, 0xFC010504, 0x2C731004, 0x00040293, 0x3D77B740, 0x000500FF, 0x0400141C,
+0x76BC2200, 0xBD400500, 0x04FF4277, 0x70500000, 0x0013E800, 0xFC000004, 0x00040004, 0x0004F804,
+0x04055C1C, 0x427F2100, 0x0400580C, 0x05A80105, 0x0018C803, 0x040004F8, 0x00BC0000, 0x0800C800,
+0xE40004FC, 0x04EC0004, 0x00000408, 0x04000100, 0x04F80400, 0x1304F001, 0x0004FC86, 0xA80F208C,
+0x84000409, 0x00040F04, 0x04B40F35, 0x0068000D, 0x48002400, 0xFF4B8BC9, 0xCA310004, 0x123C4C8C,
+0x00001C00, 0x1C080004, 0x000C0000, 0x0100140F, 0x00001800, 0x1C000004, 0x00040800, 0x09001400,
+0x8C100004, 0x040F0478, 0xCA402700, 0x04FF4B8D, 0x04D80400, 0x0102E80F, 0x04001C00, 0x080F0018,
+0xFC010600, 0x4901F008, 0x4691CAFF, 0x4691CBFF, 0x4690CDFF, 0xE48FCBFF, 0xFF4F4008, 0x00048DCA,
+0xFF4D13F0, 0xFF4C8EC8, 0xFF4588BF, 0xFF478ABF, 0xFF67AAE1, 0xFF4A8DC4, 0xFF4E91C8, 0xFF4E8FC5,
+0xFF518FC8, 0x9EF01408, 0xFF4685BB, 0xFF5D9CD2, 0xFF71B2EA, 0xFF4F90C6, 0xFF4788BE, 0xFF4D90C7,
+0xFF4890CB, 0xFF5095CE, 0xFF5E96C9, 0xFF22465E, 0xFF566347, 0xFFE1E3A4, 0xFFDCE191, 0xFF9AA44D,
+0xFF768832, 0xFF748D39, 0xFF6C8A34, 0xFF6E8B31, 0xFF728B26, 0xFF92A742, 0xFF8EA241, 0xFF8D9943,
+0xFF918E49, 0xFF4A2A00, 0xFF590A00, 0xFF8C1E1D, 0xFFA72A24, 0xFF98211D, 0xFF6C0D15, 0xFF411F40,
+0xFF1B59A4, 0xFF0870CF, 0xFF025EC1, 0xFF004CAC, 0xFF0352AE, 0xFF164891, 0xFF453F6B, 0xFF491F33,
+0xFF601E28, 0xFF4D1425, 0xFF5D4C78, 0xFF7083BB, 0xFF5B8CC6, 0x7000B8C9, 0xC6FF4C8E, 0xB8FF488D,
+0x00040F04, 0x0A100B1A, 0x1A003C0F, 0x704B902F, 0x340F1F00, 0xB00B2D00, 0x02080C00, 0x0905000F,
+0x02001C00, 0x240204FC, 0x16300011, 0x04166C0C, 0x08080500, 0x05080000, 0x000A1C00, 0xFC000004,
+0x04100803, 0x00000C00, 0x04050438, 0x3EC40300, 0x04050000, 0x00000004, 0x32600005, 0x00050004,
+0x000C0008, 0x05040405, 0x0013E000, 0xB6B10004, 0xB7FF3E75, 0xB8FF3F76, 0x00043E78, 0x00192000,
+0xBD440004, 0x04FF4177, 0x75DC0100, 0xFF427962, 0x04417BBB, 0x407C2100, 0xBD796658, 0xBEFF417E,
+0x0004427F, 0x040ED800, 0xE4040004, 0x04EC0009, 0x00000400, 0x040009E8, 0x04F00000, 0x00000800,
+0x0C000004, 0x00040000, 0x0000E000, 0xF8000004, 0x00040000, 0x00399400, 0x14000004, 0x01240801,
+0x00000C00, 0x08000478, 0x00040400, 0x0F001000, 0x020D0004, 0xAC0012A8, 0x00040212, 0x001CAC02,
+0x040F11DC, 0x94002300, 0x04A80404, 0x08000C00, 0x00000004, 0x099C0005, 0x0A00040F, 0xFF4B8D53,
+0x0E348DC9, 0x0F0E3800, 0x001C0004, 0x040C07A4, 0x08280800, 0x00001C0C, 0x200F0010, 0x14040100,
+0x00200000, 0x04000404, 0x080F0014, 0x00F10900, 0xFF4A91C9, 0xFF4992C9, 0xFF4991CB, 0x1C4792CC,
+0xCE40F113, 0xCCFF4791, 0xCBFF4B8F, 0xC7FF4E8E, 0xC4FF4F8B, 0xC7FF508D, 0xD1FF5392, 0xCCFF5A9D,
+0xC4FF5298, 0xC7FF4A90, 0xC4FF4E8F, 0xC6FF4D8B, 0xC5FF518C, 0xE8FF528D, 0xD4FF77B5, 0xC5FF62A1,
+0xCAFF4E8C, 0xC5FF4F90, 0xC5FF4D90, 0xCAFF488F, 0x00584490, 0x95CC8EF7, 0x5E7FFF50, 0x2D22FF30,
+0xD4A8FF23, 0xE39DFFDB, 0xAE59FFE2, 0x8531FFA6, 0x8E37FF79, 0x8D34FF7A, 0x8E32FF6C, 0x8D31FF6B,
+0x953AFF74, 0x9639FF7E, 0x8834FF79, 0x8A4CFF76, 0x1700FF95, 0x2E24FF4B, 0x2124FF93, 0x1714FF9F,
+0x100FFF97, 0x2B34FF82, 0x2C4FFF7C, 0x64AFFF40, 0x7AD5FF1F, 0x4FACFF0E, 0x50ACFF00, 0x59B3FF00,
+0x54A9FF05, 0x478EFF10, 0x2F5EFF21, 0x1927FF31, 0x1418FF53, 0x0E21FF5F, 0x254BFF47, 0x94CCFF3B,
+0x8ACAFF77, 0x92CFFF50, 0x90CCFF52, 0x91CCFF4E, 0x04CAFF4C, 0x00100000, 0x1900040F, 0x4D92CD31,
+0x340F0044, 0x2C001900, 0x05380C00, 0x0F001400, 0x00220004, 0x040700C4, 0x00580C00, 0x0100100F,
+0x03021009, 0x2C000FD0, 0x00040207, 0x0007940A, 0x040F0504, 0x20000500, 0x0004050A, 0x0411F403,
+0x080403CC, 0x0A0C0000, 0x00000400, 0x04010F18, 0x19300300, 0x01042400, 0x30000004, 0x05040335,
+0x051E3400, 0x6C070504, 0x0984000E, 0x08050400, 0x10040004, 0x04FC0105, 0xFF3F7435, 0x58000500,
+0x3E7830B1, 0x0004FCFF, 0xF4000004, 0x00040504, 0xD8407921, 0x09F0001D, 0x0048AC00, 0xFC080004,
+0x04F00404, 0x0F000804, 0x040504F8, 0xD40004F0, 0x04F40009, 0x00000400, 0x0400000C, 0x04F40000,
+0x00000404, 0x040004F8, 0x1CC81F00, 0x74040018, 0x04F00F04, 0x001C0401, 0x0200080F, 0x0217A801,
+0xC92404FC, 0x0616D88A, 0xC84F04FC, 0x04FF4B8B, 0xE4011900, 0x09F80304, 0x00000C00, 0x04040004,
+0x000C0105, 0x0009A803, 0x040F096C, 0xFC000100, 0x00040F04, 0x134C0009, 0x0900200F, 0x0404AC04,
+0x9C090008, 0x099C0102, 0x07129C0F, 0x0C002C04, 0x180002E4, 0x00140C00, 0x0100100F, 0x4B90C931,
+0x00F10E04, 0xFF4B92CA, 0xFF4A92CC, 0xFF4893CD, 0x044793CF, 0x000C0000, 0xF0039000, 0x5592C902,
+0x528EC2FF, 0x4E8CBFFF, 0x6BAADDFF, 0x05F0BFFF, 0x52950BF1, 0x4A8BC1FF, 0x508EC7FF, 0x659DD8FF,
+0x74AFE7FF, 0x4D8CBFFF, 0x5092C4FF, 0x6C00191C, 0xC993F018, 0xC9FF4F92, 0xCBFF4C93, 0xC9FF4994,
+0xCDFF4491, 0xAEFF4B93, 0x27FF5286, 0x7EFF1922, 0xADFFA49B, 0x6AFFE9E9, 0x32FFB3BA, 0x33FF7C85,
+0x33FF798C, 0x3CFF6F8D, 0x38FF7396, 0x37FF718D, 0x3BFF748E, 0x46FF7895, 0x6FFF8A95, 0x03FFC2A8,
+0x1AFF6924, 0x11FF9624, 0x10FF990E, 0x12FF9C12, 0x33FF7F0E, 0x6AFF6023, 0xC7FF3F41, 0xC1FF2F7B,
+0xB0FF0066, 0xB2FF0053, 0xB6FF0058, 0xA8FF075C, 0xA1FF0652, 0x85FF114E, 0x35FF2E48, 0x13FF3B1D,
+0x23FF400B, 0x35FF3C0F, 0x90FF2314, 0xD5FF3B5A, 0xCCFF5B97, 0x190A9C8F, 0x0004FC4B, 0xF4000508,
+0x00040800, 0x0C04E000, 0x200F0004, 0x14040100, 0x002C0800, 0x00001404, 0x18040008, 0x000C0000,
+0x3500040F, 0x01005400, 0x000705C4, 0x005C0C05, 0x0101F80F, 0x02001408, 0xE40606E8, 0x02E40414,
+0x4C8ECB40, 0x0F0004FF, 0x0F0107FC, 0x00020510, 0x04031640, 0x03D40405, 0x00050404, 0xB0040008,
+0x04100020, 0x01000408, 0x04031424, 0x19340005, 0x00050400, 0x64000004, 0x0004040E, 0x0C0E8000,
+0x0C000A10, 0x05040005, 0x0018D001, 0x766118D4, 0x77B7FF41, 0x40000440, 0xFF4178B8, 0x000022D4,
+0x98540005, 0x00000404, 0xBF317F48, 0x1DD4437C, 0x437FBE40, 0x0404FCFF, 0x080804EC, 0x04F80000,
+0x00000400, 0x040009EC, 0x04F00000, 0x0800040C, 0xF80004F4, 0x0ED80404, 0x00000804, 0x040C00F4,
+0x01180400, 0x0F000800, 0x210204DC, 0x0E704A8A, 0x09048004, 0x8A300008, 0x04F0FF4D, 0x0300040D,
+0xAC0012A8, 0x00040F12, 0x8DCA4815, 0x0004FF4D, 0x04003804, 0x10010014, 0x0E600000, 0xDC4C8E21,
+0x04C00009, 0x0F045400, 0x4F020004, 0xCAFF4C8E, 0x0B090004, 0x7C0804C4, 0x000C0002, 0x0200540F,
+0x284A8F2F, 0xF40C1A0D, 0x00100F02, 0x03F00015, 0x930EC800, 0xFF4C91C8, 0xFF4B91CC, 0x000504CD,
+0x1EF004FC, 0xFF4793CD, 0xFF4893CA, 0xFF4A8EBF, 0xFF5694C3, 0xFF4D8AB9, 0xFF72ACDE, 0xFF548CBF,
+0xFF518ABF, 0xFF5190C6, 0xFF72B3EB, 0xFF66A1DB, 0x401A04BF, 0xC4FF5395, 0x8E610EF0, 0x94D1FF4E,
+0xF10F2454, 0x4C92C68C, 0x488FC3FF, 0x5097CBFF, 0x4D94CCFF, 0x6396C3FF, 0x2F3A4EFF, 0x6F695DFF,
+0xE7E9B7FF, 0xBCC479FF, 0x768530FF, 0x788D32FF, 0x769035FF, 0x79973FFF, 0x739340FF, 0x748F3EFF,
+0x839A42FF, 0xC4C172FF, 0xB98A52FF, 0x741E00FF, 0x8C1205FF, 0x990908FF, 0xA5090AFF, 0x9A2430FF,
+0x573452FF, 0x4B6AA0FF, 0x1865B7FF, 0x005ABBFF, 0x005BBBFF, 0x0E6DC9FF, 0x0258ADFF, 0x004896FF,
+0x1655A2FF, 0x083473FF, 0x0F224AFF, 0x566181FF, 0x7C94BAFF, 0x7399C6FF, 0x5993C5FF, 0x4D92C9FF,
+0xD1500AF4, 0xCBFF4F97, 0x924F05A4, 0x04CBFF4D, 0x4C002C00, 0x00440C01, 0x0100140F, 0x0F00240C,
+0x00190010, 0x04000050, 0x00340900, 0xFF4F9190, 0xFF4F91CB, 0x0B7890CA, 0x0000040F, 0x0F0ADC03,
+0x00010214, 0x18000280, 0x00080000, 0x04000404, 0x10040290, 0x07980500, 0x110A280D, 0x04163848,
+0x2800050C, 0x000C0405, 0x03000801, 0xEC0003CC, 0x00040803, 0x00041400, 0x04040E0C, 0x092C0400,
+0x030A0C01, 0x0C001428, 0x0F200000, 0x00136404, 0x0C000008, 0x05080005, 0x00000400, 0x04040A10,
+0xA2380000, 0x447ABA4A, 0x510004FF, 0x7ABBFF43, 0x220EE443, 0x84407BBE, 0x0004FC00, 0xE0041434,
+0x04F00013, 0x000EF400, 0x040F04E8, 0xF80F0100, 0x08040504, 0x05000805, 0x0004F400, 0x04093454,
+0x48883000, 0x0400F8FF, 0x0C0004E8, 0x00040F00, 0x00200401, 0x0304EC09, 0x14080990, 0x8BCA4C00,
+0x0004FF4E, 0x4E8CC931, 0xB0001778, 0x04BC0404, 0x1100080F, 0x080DD800, 0x34040004, 0x00140400,
+0x00001001, 0x8F260700, 0x0B04DC4D, 0x280404C8, 0x04FC0802, 0x0854CB10, 0x0B00040C, 0x700011C0,
+0x00040F02, 0x080C0041, 0x08000400, 0x100C005C, 0x001C0400, 0x00001800, 0x48000004, 0x90C83103,
+0x0013CC4F, 0x04040358, 0x94CE5005, 0xB8CDFF49, 0x9514F009, 0x98C9FF49, 0x8EBCFF52, 0x92C0FF4E,
+0xADDCFF58, 0x8BBDFF77, 0xA2D8FF57, 0xB9EFFF6B, 0x92CAFF7A, 0x1E04FF51, 0x5796CCB1, 0x4E91C5FF,
+0x4E91C6FF, 0x40010E58, 0x51922101, 0xC3800010, 0xC3FF4E92, 0x10FF4C8F, 0xC168F10A, 0x7DFF5F92,
+0x4BFF4F5E, 0xB2FF4B4B, 0x96FFDADD, 0x32FFD5DC, 0x3BFF7685, 0x3AFF8196, 0x31FF7C97, 0x3FFF6D8B,
+0x39FF7292, 0x32FF6E8B, 0x7CFF778B, 0x37FFD7CA, 0x04FFB16B, 0x0DFF9122, 0x1CFFA41A, 0x23FFB81E,
+0x4AFFC323, 0x6CFFA63A, 0xB0FF423F, 0xB8FF316C, 0xC3FF1363, 0xC7FF0B66, 0xACFF0C6B, 0x90FF0054,
+0x98FF0042, 0x7FFF0B4F, 0xACFF0038, 0xCDFF336D, 0x05786A9C, 0x5692C431, 0xC9B20AA0, 0xC9FF5295,
+0xCDFF4E95, 0x0AF44D96, 0xFF4F944F, 0x1C0004CD, 0x4E93CC4F, 0x090004FF, 0x0F005000, 0x04090020,
+0x8000001C, 0x00040401, 0x0C001404, 0x20040008, 0x00080C00, 0x00002804, 0x040F04FC, 0x28040900,
+0x01F00000, 0x04000404, 0x08080208, 0x04F00400, 0x0D02D804, 0x8E210010, 0x001B184A, 0x28021440,
+0x0500020F, 0x0F04F800, 0x04010004, 0xF40C03D8, 0x04F80403, 0x04000804, 0x08040A0C, 0x00080405,
+0x04050400, 0x0C000004, 0x05000005, 0x00000400, 0x04000500, 0x05000400, 0x7FC000F1, 0x7DBCFF4C,
+0x7CBBFF4A, 0x7BBAFF49, 0x62611848, 0xFF4379B7, 0x050479B9, 0x2109F001, 0x1934437C, 0x12143401,
+0x00591C7E, 0xF80C0500, 0x04F40004, 0x04000400, 0x080804E4, 0x04F00000, 0x00000404, 0x040009F0,
+0x04F80000, 0x00000800, 0xFC0004F8, 0x00080421, 0x00000C00, 0x04000D04, 0xE0C51000, 0x0B180018,
+0x30448A10, 0x00306002, 0x040F0018, 0xB8000100, 0x04CC000E, 0x0100040C, 0x8D210350, 0x0012904D,
+0x100004A4, 0x00240000, 0x20003004, 0x17A48EC8, 0x0200040E, 0x180C16E8, 0xD04C1100, 0x17D40017,
+0x02000402, 0xC94C0020, 0x04FF4D8F, 0x00200000, 0x000E2400, 0x20000004, 0x00040904, 0xFF4B9230,
+0x1C0F0E38, 0x74030200, 0x00300907, 0x2000140F, 0x0002F400, 0x08000044, 0x00040F00, 0x03100435,
+0x31000804, 0xB05293CB, 0x95CD3118, 0x41090454, 0xFF4993D0, 0x33F10500, 0xC6FF5196, 0xC5FF4D93,
+0xBFFF4B93, 0xDBFF4D8F, 0xC4FF79AF, 0xE9FF6497, 0xDBFF81B4, 0xCDFF6BA4, 0xCFFF5996, 0xD1FF5899,
+0xD2FF5A9B, 0xD1FF5A9D, 0xD1FF579D, 0xD3FF579A, 0xD5FF5899, 0xD4FF5C9A, 0x001C5D9B, 0x9DCF78F1,
+0xA0D3FF5B, 0xA0D6FF61, 0x9BCEFF61, 0x91BAFF69, 0x505BFF7A, 0xE1BDFF48, 0xD795FFE1, 0x9143FFD6,
+0x9037FF86, 0x8C2FFF7C, 0x8E31FF71, 0x8933FF6F, 0x842FFF6B, 0x7B21FF68, 0xC577FF64, 0x4A1BFFD6,
+0x230AFFA5, 0x2218FFAF, 0x2320FFC6, 0x2221FFCB, 0x2B3FFFB8, 0x5694FF7E, 0x6BBEFF38, 0x65B8FF15,
+0x59ABFF0F, 0x4DA0FF07, 0x408EFF00, 0x327AFF00, 0x4A8CFF00, 0x9FDDFF0F, 0x98D2FF5F, 0x94C6FF56,
+0x94C4FF52, 0x80000852, 0xFF5294C8, 0xFF5293C9, 0xCD8000F4, 0xD0FF5193, 0x08FF5294, 0x94CB4F00,
+0x0004FF51, 0x0028000D, 0x44000404, 0xFF5294CE, 0xCB4F0004, 0x04FF4F94, 0x54042900, 0x00080F00,
+0x92CC401D, 0x0004FF50, 0x0500B80F, 0x04005004, 0x080801E8, 0x024C0800, 0x0F026000, 0x0F010004,
+0x0001051C, 0x20040514, 0x00080005, 0x0B0A1C01, 0x3C0016FC, 0x0004002A, 0x2D68C610, 0x002ADC08,
+0x04070404, 0x0A080000, 0x04000400, 0x08040508, 0x142C0000, 0x04000400, 0x200F3AC8, 0x8222060F,
+0xA11E2842, 0xBDFF5183, 0xBBFF4D81, 0x00084C7E, 0x4D7FBC31, 0x2000050C, 0x0A140066, 0x457CBD40,
+0x400504FF, 0xFF437EC2, 0x3C0109FC, 0x44812105, 0x00007528, 0x04F00005, 0x04000408, 0xEC0404F4,
+0x00080004, 0x0004E400, 0xF0000004, 0x00040804, 0x0004F000, 0x94040004, 0x04F80018, 0x00001000,
+0x98004424, 0x00040418, 0x0004EC00, 0x080004AC, 0x00040000, 0x04000C00, 0xC8000004, 0x00040F04,
+0x04F0000D, 0x0500040F, 0x0004FC04, 0x040004EC, 0x00100F00, 0x00180205, 0x04E44C1D, 0x04003400,
+0x440804F8, 0x0014040C, 0x0004E000, 0x240D0004, 0x05000302, 0x0F00180D, 0x041C04E8, 0x4808028C,
+0x00140400, 0x04000808, 0x140F02C0, 0x1C040100, 0x00080F00, 0x93CAC01D, 0x93C8FF4E, 0x97CDFF50,
+0x0A08FF56, 0xF0033400, 0x4E96D129, 0x4E96D0FF, 0x4B8EC3FF, 0x5193C5FF, 0x5A99CCFF, 0x4E8BBAFF,
+0xAEE2FFFF, 0x77ABDAFF, 0x558DC0FF, 0x528EC4FF, 0x5491C8FF, 0x5192C8FF, 0x4E94C8FF, 0x4F95C9FF,
+0x00004CFF, 0xC96009E4, 0xCBFF5290, 0x02054C92, 0xCA810004, 0xC5FF5496, 0x48FF5190, 0x8D47F114,
+0x91C0FF5A, 0x4D60FF71, 0xD3B4FF3E, 0xC788FFD4, 0x5709FFCB, 0x852EFF4C, 0x892EFF71, 0x8428FF6F,
+0x832AFF67, 0x842CFF69, 0x751BFF6C, 0xA257FF5E, 0x360DFFB8, 0x2712FFA3, 0x1B11FFC6, 0x1C19FFCC,
+0x3235FFBE, 0x2845FFA6, 0x62ADFF56, 0x64C1FF2E, 0x52A4FF07, 0xF209F401, 0x04469203, 0x003179FF,
+0x467DC0FF, 0x689FDFFF, 0xD48FCAFF, 0x009C0004, 0xA496C820, 0xA84E1100, 0x95CC2004, 0x539F04BC,
+0x5593CEFF, 0x5394CEFF, 0x000E04F8, 0x04000030, 0x04F00400, 0x0F00080C, 0x002904FC, 0x7400003C,
+0x00040F01, 0x00680401, 0x01001C0F, 0x00001408, 0x0400009C, 0x05080C00, 0x0F002405, 0x080C0ADC,
+0x0C080250, 0x0A2C0000, 0x00050408, 0x0000000C, 0x00040405, 0x01050000, 0x24070004, 0x12280012,
+0x0016F000, 0x04000004, 0x00040005, 0x000F0C01, 0x100325EC, 0x0A18040F, 0x00000804, 0x04040504,
+0x05040C00, 0x0C050800, 0x24000500, 0x00040014, 0x00142400, 0xBFB10004, 0xB9FF5181, 0xB9FF4C7E,
+0x84884D7E, 0x84BF01F0, 0x81BEFF53, 0x7EBAFF4F, 0x7DBBFF4A, 0x0500FF47, 0xFC7DBD22, 0x0A400004,
+0x02000400, 0xC80204F0, 0x04F00461, 0x00000804, 0x040004F0, 0x04F00000, 0x04000400, 0xD80104F0,
+0x18C80004, 0x00000403, 0x040004EC, 0xC4C51000, 0x38891022, 0x00040235, 0x20304000, 0x26108BC8,
+0x256C4E11, 0x4C8AC531, 0xC7750008, 0xC6FF4C8D, 0x0EB04B8C, 0x0004F404, 0x0404304C, 0x8EC92200,
+0x10011740, 0x26540000, 0xAC4E8F21, 0x04A40220, 0x00000C0A, 0x04001C64, 0x001C0400, 0x00000C00,
+0x10060004, 0x110C0F00, 0x11240400, 0x0404A408, 0x08000014, 0x00180800, 0x104C9121, 0x04980809,
+0x00000C00, 0xF8001230, 0x00040409, 0x0F023408, 0x0021000C, 0x04040438, 0x12980000, 0x0F000C04,
+0x00110008, 0x280F0340, 0x18000100, 0x00040400, 0x04002000, 0x080F000C, 0x96210200, 0x001DAC53,
+0x04000DB4, 0x96CB3100, 0x000EB853, 0x10F1093C, 0xFF5693CA, 0xFF5587BA, 0xFF306090, 0xFF3870A1,
+0xFF538FC1, 0xFF5593C2, 0xFF5997C8, 0xD45493C9, 0x0E4C000E, 0x21046001, 0x05105194, 0x1891C720,
+0xFF557000, 0xFF5492CD, 0x21096CCD, 0x0F285194, 0x97D00CF1, 0x93CBFF59, 0x91C4FF5C, 0x657DFF66,
+0xAF92FF4D, 0xE3A3FFB3, 0x8536FFE8, 0xF03BFC77, 0x6A812949, 0x768A31FF, 0x6F862CFF, 0x6C832BFF,
+0x6A7926FF, 0xA18241FF, 0x951A00FF, 0xC51B0CFF, 0xC5190BFF, 0xAB2420FF, 0x692A3DFF, 0x444677FF,
+0x225CAEFF, 0x0657B3FF, 0x07489CFF, 0x00357FFF, 0x145096FF, 0x5E9BDEFF, 0x5794D7FF, 0x5691D3FF,
+0x5C94CFFF, 0x5992C9FF, 0x1000C4FF, 0xA104F4CA, 0xD0FF4C97, 0xD0FF4B98, 0x09F84F95, 0x4004FC00,
+0xFF5394CC, 0x2000043C, 0x00040400, 0x08001000, 0xCD220004, 0x08002496, 0x0C0F0014, 0x7C0F5500,
+0x240F1100, 0xB0081100, 0x02040C00, 0x050A4400, 0xF000052C, 0x0A580306, 0x08074C04, 0x000002D4,
+0x00040403, 0x00081400, 0x100F0004, 0x14081505, 0x05180105, 0x0005100B, 0x080C0F28, 0x05100005,
+0x00050400, 0x94000004, 0x00040804, 0x000F1400, 0xE4000004, 0xBB01F03D, 0xBCFF5081, 0xC2FF5182,
+0xC3FF5788, 0x04FF5A88, 0x80BB3105, 0x620A104E, 0xFF477EBE, 0x7A247FBF, 0x0009F004, 0xC4007F44,
+0x6B080066, 0x04005408, 0xF800000C, 0x00040004, 0x0504FC0F, 0x00050C00, 0x040004FC, 0x09EC0200,
+0x0004FC06, 0x7C001394, 0x04CC0007, 0x048CC722, 0x00080005, 0x00050000, 0xC8000004, 0x0EC40009,
+0x01000400, 0x8D210994, 0x001C344F, 0x340004F4, 0x00040000, 0x04004000, 0x080004CC, 0x00040F00,
+0x91CB3105, 0x00216C50, 0x0C000020, 0x00040000, 0x02000C00, 0x4E110004, 0x1C0D1618, 0x16E80C11,
+0x08164003, 0x0C0F01E8, 0x14010500, 0x4D942102, 0x080017CC, 0x00040105, 0x0300500C, 0x2C010010,
+0x12280F00, 0x0024000C, 0x0C04A000, 0xA4080004, 0x001C0002, 0x0C00100C, 0x20080014, 0x000C0F00,
+0x0A00001D, 0xF009C400, 0x4F96CE1E, 0x4D94CAFF, 0x5092C6FF, 0x5594C9FF, 0x5693CCFF, 0x5089C0FF,
+0x83B2E6FF, 0x386899FF, 0x5E97CCFF, 0x5291C4FF, 0x5898C8FF, 0x18ECC7FF, 0xFF4D8E30, 0xCA80037C,
+0xC9FF4F96, 0x40FF5096, 0x00380004, 0x5693C9A0, 0x5794CBFF, 0x2095CFFF, 0xFC521164, 0x08CC0027,
+0xF0019400, 0x5691CB5B, 0x5A8EC7FF, 0x6486A2FF, 0x908E77FF, 0xECE3A8FF, 0x7A883BFF, 0x6D852FFF,
+0x768A35FF, 0x6E822BFF, 0x6E852BFF, 0x748831FF, 0x71792EFF, 0x704711FF, 0xB1301BFF, 0xC01B15FF,
+0xB01910FF, 0x953034FF, 0x35254AFF, 0x2E5493FF, 0x1455A7FF, 0x004197FF, 0x002874FF, 0x316AADFF,
+0x619FDCFF, 0x5597D3FF, 0x5192D2FF, 0xD48FCDFF, 0xFF5C3013, 0xA20500C7, 0xCDFF5794, 0xCFFF5196,
+0x00044D98, 0x40000C00, 0xCBFF5395, 0x96300FF0, 0x05F0FF53, 0x00000408, 0x040F00D4, 0xFC08B900,
+0x000C0204, 0x8CFF5020, 0x02280424, 0x08019C00, 0x0C050004, 0x0A380305, 0x0402A400, 0x18080004,
+0x05080403, 0x040A1800, 0x0C010004, 0x17340805, 0x000A1C03, 0x040004FC, 0x04F80000, 0x04000404,
+0xE4000A00, 0x000C0417, 0x0C050408, 0x9000050C, 0x00040804, 0x00141C00, 0xF0000500, 0xC200F104,
+0xC6FF5B8A, 0xCBFF5F8E, 0xC9FF6493, 0x05046390, 0xF2051800, 0x5183C001, 0x4B81BFFF, 0x4882C1FF,
+0x4682C1FF, 0x0209F8FF, 0xFC007500, 0x84C03104, 0x0057C048, 0x040057C4, 0x48DC0000, 0x00000400,
+0x04043198, 0x09E00000, 0x04000400, 0x08080ECC, 0x0ECC0200, 0x24228400, 0x09E8FF4C, 0x3104BC00,
+0x805391CC, 0x260C000C, 0x40000400, 0xFF4F8DC6, 0x0C000004, 0x04E00500, 0xFF518F30, 0x0400000C,
+0x21480000, 0x00002000, 0x50000008, 0x0004002B, 0x04266000, 0x9C000004, 0x91C9400D, 0x0004FF50,
+0x111CB002, 0x0117B44E, 0x68000D70, 0x80921021, 0x9050120D, 0x00100308, 0x31001C00, 0x985093CA,
+0x0430000D, 0x2100040D, 0x03F04D94, 0x0801DC00, 0x0C0401D8, 0x00180000, 0x1100040F, 0x2F00580D,
+0x00744E93, 0x02700402, 0x3900080F, 0x0002C804, 0x040F0008, 0x70000500, 0x001C0F00, 0x00180205,
+0x0E185212, 0xFF5198B0, 0xFF5299CD, 0xFF5197CB, 0x0CF109C4, 0xFF598CC1, 0xFF90C2F7, 0xFF5B92C8,
+0xFF5D96CB, 0xFF5894C6, 0xFF5795C6, 0xF45698CC, 0x99CD310E, 0x00280C53, 0x540004FC, 0x0EE80018,
+0x5695CA40, 0xF10004FF, 0x5695CB00, 0x5395CFFF, 0x5196CFFF, 0x5398D1FF, 0x6C000004, 0xD045F013,
+0xD0FF5596, 0xB4FF5A97, 0x82FF6B94, 0x9FFF8E90, 0x46FFD8D0, 0x26FF858F, 0x36FF677B, 0x2FFF758B,
+0x2FFF6C86, 0x33FF6A86, 0x43FF7184, 0x00FF8280, 0x1DFF5625, 0x1AFFA72C, 0x2DFFAB19, 0x35FF9B28,
+0x8BFF5A1F, 0x9BFF3D52, 0x90FF1250, 0x73FF0646, 0x6CFF002F, 0xD906F00C, 0xC8FF62A3, 0xC7FF4D94,
+0xD5FF4B94, 0xD1FF569D, 0xC8FF559A, 0x99A10A78, 0x98CBFF55, 0x98CCFF52, 0xF0000851, 0x5497CB05,
+0x5995CBFF, 0x5995C9FF, 0x5597C7FF, 0x5498C7FF, 0x4F0014FF, 0xFF5497CC, 0x00050004, 0x1C08051C,
+0x97CE4800, 0x0004FF54, 0x0F001C08, 0x0C21000C, 0x5C08056C, 0x000C0F00, 0x00340805, 0x0000740C,
+0x040800B0, 0x002C0800, 0x01000C0F, 0x11051402, 0x080B0852, 0x5004000C, 0x0510040F, 0x04030C08,
+0x08000324, 0x0F280000, 0x09000400, 0xF4030504, 0x0F20041B, 0x001C2400, 0x04000F1C, 0x05080000,
+0x00000408, 0x2404193C, 0x284C010F, 0x08142407, 0x8C040510, 0x00080009, 0x00050800, 0xB40109AC,
+0x8A13F10E, 0x8DC3FF5B, 0x92C9FF5E, 0x96CDFF65, 0x95CEFF69, 0x8EC7FF68, 0x87C2FF61, 0x85C0FF59,
+0x83BFFF53, 0x0070244D, 0x000004F0, 0x09FC0005, 0x4684C140, 0x1004FCFF, 0x003B84C1, 0xC8000004,
+0x0004033E, 0x0404F80E, 0x640609DC, 0x04F80027, 0x02000400, 0x4D1113C4, 0x64010284, 0x4E8C613E,
+0x5290CBFF, 0x0400115C, 0x120C0012, 0x0004D400, 0xE0000004, 0x00040004, 0x0004F000, 0x04000024,
+0x052C0000, 0x04002400, 0xF8000004, 0x00040504, 0x644F9021, 0x0504002B, 0x00050008, 0x040404D8,
+0x04E00200, 0x0F04E400, 0x0F090004, 0x00030490, 0x0400269C, 0x01D80800, 0x0D000C0F, 0x040E2000,
+0x2C040004, 0x04600000, 0x0900040F, 0x02046402, 0x0C0F0774, 0x3C000100, 0x00180F00, 0x00140F01,
+0x08D80011, 0x00002804, 0x040F000C, 0xCE440500, 0x04FF5297, 0x00240400, 0x00001004, 0xCF3104A4,
+0x18EC5398, 0xF004C800, 0x589BD001, 0x5390C6FF, 0x87BBEDFF, 0x5B8FC1FF, 0x0009D0FF, 0xC7711DE0,
+0xC9FF5694, 0x04285796, 0x569BD231, 0x0C000844, 0x0380002D, 0x5597CB40, 0x000004FF, 0xCF331448,
+0x04205697, 0xCFFF5242, 0x00035899, 0xD320034C, 0xF104FC9A, 0xD2FF520E, 0xB7FF5496, 0x83FF6191,
+0xA5FF7F88, 0x5DFFD1CE, 0x24FF98A2, 0x36FF6476, 0x3C0C7389, 0x852E30F1, 0x8439FF6B, 0x7846FF76,
+0x0700FF84, 0x2B24FF3F, 0x1B24FFA0, 0x283EFF94, 0x355FFF70, 0x5398FF46, 0x408BFF2B, 0x4184FF00,
+0x9DD8FF02, 0x9CD1FF5F, 0x99CDFF5D, 0x9BCCFF56, 0x9BCDFF51, 0xE204EC4F, 0xFF4F95C8, 0xFF549CCC,
+0xFF4F97C7, 0x05D89ACD, 0x5399CCD0, 0x5698CAFF, 0x5A96CAFF, 0x0004C8FF, 0x01000C00, 0x554F05C4,
+0x0498CDFF, 0xE0000700, 0x00040400, 0x48002800, 0xFF5598CF, 0x14000004, 0x00040F00, 0x003C0409,
+0x0500080F, 0x0504E40F, 0x1500180F, 0x0500580F, 0x0F001804, 0x0F010048, 0x08010508, 0x08080014,
+0x05000405, 0x0002F804, 0xFC040008, 0x00080002, 0x4E93CE40, 0x040500FF, 0x080D0004, 0x21100305,
+0x00050400, 0x04000004, 0x00040905, 0x042B6003, 0x0C040504, 0x0008080A, 0x03050801, 0x00001378,
+0x00040005, 0xF1050404, 0x5683BA10, 0x5886BAFF, 0x5E89BEFF, 0x638EC3FF, 0x6691C8FF, 0x628FC8FF,
+0x5C8AC5FF, 0x5687C2FF, 0xC1100500, 0xEC00892C, 0x00040709, 0x00001400, 0xC4480500, 0x04FF4A86,
+0x09EC0000, 0x04000400, 0xE8000ED8, 0x00040004, 0x0A04EC02, 0xC4002C5C, 0x09F80413, 0x000EE400,
+0xC0000EC4, 0x93CC8004, 0x96CFFF55, 0x11F4FF58, 0x0004DC00, 0xC7A00014, 0xC6FF518E, 0xC8FF508D,
+0xD117208F, 0x91CDFF55, 0x90CCFF55, 0x91CAFF54, 0x310D6C54, 0x085794CD, 0x05380000, 0x00215400,
+0xCD310008, 0x123C5694, 0x001BB000, 0xF0000344, 0x04FC0604, 0x0016D002, 0x04000014, 0x00200400,
+0x02000C00, 0x20040004, 0x05000300, 0x0009F003, 0x04080DE4, 0x95CB4F00, 0x0004FF4E, 0x04680411,
+0x0200080E, 0x180E03E4, 0x04F40600, 0x0F047404, 0x04010008, 0x1C0F0038, 0x14080100, 0x04B00400,
+0x0100140F, 0x0F001C04, 0x00050008, 0x040404E0, 0x00240400, 0x00001004, 0x840009A0, 0x1DCC0005,
+0xF231E400, 0x5490C203, 0x83BFF1FF, 0x5593C4FF, 0x5D9DCDFF, 0xF499CBFF, 0x03E40009, 0x579ACF71,
+0x5194C9FF, 0x04000E50, 0x08680005, 0x0004F400, 0x00010520, 0x5598D005, 0x5398D3FF, 0x5197D2FF,
+0x3C98CEFF, 0xFF538219, 0xFF599BCD, 0x098894C7, 0xF2001400, 0x5499D44B, 0x6598C3FF, 0x73868CFF,
+0xBBC2A3FF, 0xA9B978FF, 0x657B28FF, 0x6F8532FF, 0x70842FFF, 0x738634FF, 0x7E8340FF, 0x5B4722FF,
+0x4F1706FF, 0x871E1AFF, 0x8C2F41FF, 0x37214FFF, 0x38528FFF, 0x002B6DFF, 0x2D69A8FF, 0x68A6E1FF,
+0x5A99CFFF, 0x5796CBFF, 0x5394CAFF, 0x049AD2FF, 0x00C80000, 0xC01DF400, 0xFF569FCC, 0xFF529ACA,
+0xFF5499D2, 0xD0710074, 0xCEFF539A, 0x052C549A, 0x5799CDB1, 0x5699D0FF, 0x5499D0FF, 0xCE4F04FC,
+0x04FF5699, 0xF8000500, 0x00040C00, 0x0C002C08, 0x100F001C, 0x99305E00, 0x0B8CFF53, 0x0300040D,
+0x080405D4, 0x00080405, 0x30051005, 0xF4FF5596, 0x96CE481F, 0x0004FF55, 0x0505080F, 0x0002A804,
+0x040038CC, 0x00040805, 0x04050800, 0x080D0004, 0x05000305, 0x0C261C04, 0x0C080504, 0x000C000A,
+0x0C0A1005, 0x64001420, 0x4DA0002A, 0xD1050805, 0x85C4FF4A, 0x81B9FF49, 0x80B6FF52, 0x40000851,
+0xFF5584BC, 0xC8310F0C, 0x38E85F8D, 0x5587C232, 0x84300500, 0x04F0FF4C, 0x0461AC00, 0x10000004,
+0x05000000, 0x5CC0C510, 0xFF4A8835, 0xD0070008, 0x18CC0018, 0x0004FC00, 0x000F0004, 0xF8000505,
+0x09D40004, 0x00000400, 0xEC000500, 0x04C00009, 0x31050000, 0x205C9AD3, 0x05040026, 0x01001800,
+0x90210A00, 0x001C2053, 0xE4001B80, 0x92CBB104, 0x95CCFF55, 0x97CEFF58, 0x0000045A, 0x4000000C,
+0x053C000D, 0x00004000, 0x54010048, 0x28961008, 0xFF522000, 0x040004DC, 0x0E780005, 0x0003B800,
+0xFC000010, 0x00040404, 0x02001000, 0x00020004, 0x00240005, 0x00000405, 0xB00004EC, 0x00080F20,
+0x01E00100, 0xD84F9622, 0x00080308, 0x08051800, 0x0C0F0470, 0x53110300, 0x38021308, 0x041C0202,
+0x0300280F, 0x04001C02, 0x08040480, 0x002C0400, 0x04001004, 0x180C0008, 0x04B00000, 0x04001C04,
+0x14000008, 0x088C0800, 0x28001002, 0x0008FF53, 0x0C002C00, 0xB8000010, 0x00140009, 0x30041001,
+0xF4FF5396, 0x044C0009, 0x5490C471, 0x7FB9EBFF, 0x00F118E8, 0xFF589ACC, 0xFF5096C7, 0xFF5496C8,
+0x2C5598CC, 0x01240004, 0x00002C00, 0x580003E4, 0x9BD2B100, 0x98CEFF58, 0x97CDFF59, 0x000F1858,
+0x0CF10050, 0xFF5399D4, 0xFF529AD4, 0xFF529BCE, 0xFF559BCC, 0xFF5698C8, 0xFF5999C9, 0x80569ACB,
+0xD033F204, 0xC4FF5496, 0xAAFF5F95, 0x8FFF7695, 0x94FF8B9D, 0x1DFFBCCE, 0x33FF5C6F, 0x35FF7285,
+0x33FF7587, 0x4CFF7482, 0x01FF8A8A, 0x11FF3B1D, 0x26FF4F18, 0x36FF6D20, 0x89FF521C, 0x76FF434F,
+0xC4FF0130, 0x40327483, 0xFF5998CD, 0x080000A4, 0x98CE8000, 0x9AD5FF57, 0x0A64FF55, 0x0013D800,
+0xCA710574, 0xCAFF559C, 0x23045098, 0x5698D431, 0xCE130520, 0xA8000504, 0x05180000, 0x0519E400,
+0x9A2104CC, 0x0000A054, 0x1405001C, 0x05180F00, 0x00280401, 0x01001C0F, 0x03001400, 0x5C000020,
+0x004C0F05, 0x00180501, 0xFF579830, 0x6C0F0588, 0x50000A00, 0x00040F00, 0x0070030D, 0x08006C01,
+0x380F000C, 0xF8000400, 0x02340105, 0xFF569734, 0x00080358, 0x05200005, 0x0802CC02, 0x0C0402D8,
+0xF8511200, 0x50952523, 0x08000008, 0x03600005, 0x04000800, 0x18080504, 0x0510010F, 0xFF4F9143,
+0x000004CD, 0x0C0032B0, 0x05080005, 0x09000400, 0x5C000A0C, 0x0A100434, 0x0005000B, 0x70002264,
+0x00040418, 0x00188400, 0x0BF00A08, 0xFF4C80BC, 0xFF4C80BA, 0xFF4E82BE, 0xFF5084C0, 0xFF5185C1,
+0xFF5286C2, 0x000C86C2, 0xC2FF4F52, 0x00044D85, 0xFF4B8649, 0x110004C2, 0x0070C84A, 0xA40209EC,
+0x0EE80027, 0x4D284913, 0x200EEC00, 0x0500FF4C, 0x00116000, 0x040F18D4, 0x20000100, 0x8CC8403F,
+0x09DCFF50, 0x40000408, 0xFF5390C9, 0xBC0009BC, 0x13B40104, 0xBC4F9021, 0x2B300013, 0x0004F401,
+0x93301C18, 0x1B80FF52, 0xF10D6000, 0x5B97CD04, 0x5F9BD1FF, 0x5F9CD2FF, 0x5D9AD0FF, 0x5A97CDFF,
+0x5C002660, 0x00040203, 0x21A45711, 0x5596CC31, 0xE00220B0, 0x0C501104, 0x20E00000, 0x10000400,
+0x071784CA, 0xA8000004, 0x00040008, 0x05179800, 0x20000004, 0x52953100, 0x12002CFF, 0x0012EC95,
+0xF40008C4, 0x00080F12, 0x07380005, 0x03001C01, 0x1000172C, 0x00040400, 0x00001800, 0x10040094,
+0x00080F00, 0x0438000D, 0x08000400, 0x10000028, 0x00040F00, 0x03FC0029, 0x01000405, 0xD80008D4,
+0x00040008, 0x04B45411, 0x0004A800, 0x200404EC, 0x03700008, 0x2104D001, 0x0380589B, 0x04C0CB10,
+0xFF5C9AA1, 0xFF5593C6, 0x1C7CBAED, 0x9ACD3113, 0x0009585C, 0x5C0409DC, 0x03380000, 0x00000400,
+0x04090040, 0x57983100, 0x030024FF, 0xE0000370, 0x096C0203, 0x3309FC00, 0x74CDFF53, 0x13680009,
+0x5B9DD131, 0x34F106E4, 0xFF6095C9, 0xFF6A95C0, 0xFF607E86, 0xFFCADBA7, 0xFF616D1B, 0xFF6E7D2C,
+0xFF748535, 0xFF79863E, 0xFF77723B, 0xFF411701, 0xFF4D1B1E, 0xFF3D1E30, 0xFF403C61, 0xFF0C2965,
+0xFF5D8CD2, 0xFF689ADF, 0x505D98D4, 0x9CC83105, 0x0009D055, 0x78010090, 0x54992100, 0x100009C8,
+0x9BCE620F, 0x9BCFFF55, 0x1C0005B8, 0x14140000, 0x00001000, 0x04000AC4, 0x28AC0000, 0xE105CC01,
+0xCEFF5799, 0xD1FF579A, 0xD1FF549B, 0x0008539C, 0x03002801, 0x38000040, 0x00400000, 0x01006400,
+0x9C610464, 0x9CCEFF54, 0x00146454, 0x10000110, 0x00D80015, 0x00020C00, 0xD3400038, 0x00FF569D,
+0x9BD35101, 0xA0D2FF54, 0x09A00200, 0x00001C00, 0xD1220B34, 0x31101899, 0x5C5C9BD0, 0x9ACE4024,
+0x0090FF58, 0x0500040F, 0x0C007800, 0x140F001C, 0x18000500, 0x00040F00, 0x02780F19, 0x02A40509,
+0x04087800, 0xFC000004, 0x0A380014, 0x3C539621, 0x0528000A, 0x00071400, 0x08000350, 0x00040000,
+0x00050C00, 0xF0000004, 0x00040033, 0x001C240C, 0x24000510, 0x192C000F, 0x05142000, 0x9403050C,
+0x0E540035, 0x04000400, 0x0C000970, 0x00040000, 0x00001004, 0x8408098C, 0x80BD3118, 0x7192EC48,
+0xFF4A82BF, 0xEC4B83C0, 0x86C34004, 0x0004FF4E, 0x0004FC00, 0x04010008, 0x66AC0100, 0x0466B000,
+0x4B120004, 0xBC01660C, 0x2C980E22, 0x0404F800, 0xFC0C0004, 0x04F80004, 0x00000400, 0xF80809F4,
+0x000C0004, 0x000EE000, 0x04000500, 0x95CE310F, 0x002A6C57, 0x080004F8, 0x00080005, 0x01000404,
+0x952109B0, 0x00126054, 0x04F11194, 0xFF5D99CD, 0xFF5E9ACE, 0xFF5B98CE, 0xFF5996CC, 0x045895CB,
+0x085C0100, 0x00127800, 0x952D04FC, 0x0115A854, 0xD80704E4, 0x02880004, 0x0D00040F, 0x0F01DC05,
+0x0F0816F8, 0x00090024, 0x20050238, 0x021C0700, 0x00001404, 0x04040020, 0x00140000, 0x0F000C04,
+0x0F290008, 0x040602D8, 0x08000480, 0x05000F00, 0x03C00000, 0x33050000, 0xE0589ED2, 0x08780008,
+0x09B05611, 0x5897CA31, 0xC0B122CC, 0xEAFF5391, 0xD2FF7BB9, 0x18C0609F, 0x5897CC31, 0x4C000E5C,
+0x98D0230E, 0x08030E2C, 0x038C0C00, 0x0000100C, 0x04000070, 0x9BCF4800, 0x0004FF54, 0x31049400,
+0x805A9CD0, 0xCA04F113, 0xCAFF5C95, 0x9BFF6196, 0xA8FF5E87, 0x20FFC4D5, 0x3208666F, 0xFF09FC00,
+0x83884628, 0x4D3F12FF, 0x451A0AFF, 0x452028FF, 0x171C39FF, 0x1A3967FF, 0x6791CBFF, 0x6598D9FF,
+0x5891D4FF, 0x5A9AD7FF, 0x569DCBFF, 0x539CC7FF, 0x559DCFFF, 0x569CD0FF, 0x00060004, 0x04010478,
+0x579A2D00, 0xF8000468, 0x00040404, 0x0000AC00, 0x040404B0, 0x00540000, 0x03003801, 0xE8000508,
+0x002C0000, 0x569CCF41, 0x210004FF, 0x0504559B, 0x5DA0D5B1, 0x5396CAFF, 0x5C9FD3FF, 0xFC000B48,
+0x00440000, 0x00050800, 0xCD710758, 0xD0FF589C, 0x05645C9E, 0x5097CDA0, 0x549DD4FF, 0x849ED6FF,
+0xFF572001, 0x5401067C, 0x009C0F00, 0x00700000, 0x3900040F, 0x08024000, 0x10000050, 0x00040F00,
+0x02A40C01, 0x0007E000, 0x04040708, 0x0A340800, 0x01050000, 0x9722036C, 0x16085451, 0x0011F496,
+0x04000D3C, 0x05040000, 0x00000400, 0x04000A14, 0x05000000, 0x04000400, 0x00000504, 0x00040105,
+0x944E8E2F, 0xFC00023A, 0x00040004, 0x00050004, 0x04000008, 0x00040405, 0x0097E800, 0x00040004,
+0x84C13105, 0x0005044C, 0x040804FC, 0x00C31300, 0x66940005, 0x21000405, 0x09E44B89, 0x11004C02,
+0x0F18C84C, 0x000D04F4, 0xF8000EE4, 0x00040004, 0x0018C000, 0xE0000ED8, 0x00040413, 0x000EEC00,
+0xE8000F00, 0x0A040009, 0x00106400, 0xF80413C0, 0x00080404, 0x21001401, 0x05005594, 0x011B9400,
+0xF80009F4, 0x5A972209, 0xD8000500, 0x56953111, 0x22125CFF, 0x20B05695, 0x0020B400, 0xB4000504,
+0x068C0010, 0x041BD000, 0x88000998, 0x04D00004, 0x03000800, 0x0C01052C, 0x5697210D, 0xC0040A3C,
+0x00080C01, 0x0F01E000, 0x0C090004, 0x100F0030, 0x0C010D00, 0x048C0009, 0x0000040F, 0x0F003C00,
+0x0F010274, 0x08110014, 0x0C0902BC, 0xAC991000, 0x00040304, 0x04034804, 0x9B2103B4, 0x0004F455,
+0xA800319C, 0x058C0102, 0x2112FC00, 0x13985A9C, 0x000E4000, 0xED710E9C, 0xCEFF7DBD, 0x0EEC5C9B,
+0x00089000, 0xFC0008D0, 0x00680004, 0x00092800, 0x0C0003D4, 0x04100000, 0x00041800, 0x04010004,
+0x04780004, 0xF8589B21, 0x094C0003, 0x00000401, 0x04010014, 0x04980000, 0xD0FF5591, 0xD0FF549D,
+0x04A8559C, 0x589BCF32, 0x3AF21450, 0xCBFF5B99, 0xA9FF5F99, 0x8AFF6794, 0x36FF9CB1, 0x30FF757F,
+0x32FF7486, 0x48FF7881, 0x00FF8C7F, 0x1BFF3319, 0x25FF4421, 0x48FF2416, 0xD4FF0926, 0xCEFF71A5,
+0xCFFF6398, 0xDDFF5A95, 0xD5FF5CA0, 0xC9FF539B, 0xC9FF539C, 0x0000589E, 0x040F0060, 0xD1100100,
+0x8C01098C, 0x05200600, 0x0400B804, 0xA0050008, 0x589B3000, 0x0000A0FF, 0xD22204BC, 0x0009BC9D,
+0x60000054, 0x9DCD5005, 0xF8CDFF55, 0xF09B1004, 0xD85C1332, 0xFF55D132, 0xFF529ED0, 0xFF519ACF,
+0x2459A0D6, 0x102C0010, 0x40472400, 0xFF599CD0, 0xCBC01970, 0xC1FF599B, 0xC3FF5895, 0x08FF5A97,
+0x00500033, 0x559ED340, 0x000004FF, 0x48000B90, 0x00040F01, 0x01CC0065, 0x04000401, 0x08070234,
+0x02900F00, 0x0F3C0109, 0x001A0403, 0x54000F2C, 0x00040102, 0x0D509812, 0x0011B804, 0x04000A0C,
+0x0A0C0000, 0x04000400, 0x08040F1C, 0x26980000, 0x00307000, 0x04080F10, 0x050C0100, 0x0B234400,
+0x04000A10, 0x00040005, 0x08050000, 0xF4000004, 0x00040409, 0x0004FC00, 0xF8080004, 0x000C0104,
+0xFF4B863F, 0x0F0D0500, 0x010104F8, 0xD00009E4, 0x4E080148, 0xCBFF4F55, 0x22B4508E, 0x0004FC00,
+0xF8001DC4, 0x04F40004, 0x00000400, 0x040404F8, 0x05000000, 0x000A0400, 0x040004E8, 0x0EEC0000,
+0x00000404, 0x04000010, 0x2B440000, 0x22262C00, 0x09EC94CA, 0x0009F800, 0xFC000004, 0x21480009,
+0x00000400, 0x04020500, 0xFF552000, 0x440004A8, 0x00040004, 0x08018804, 0x18000014, 0x00100000,
+0x00000408, 0x040F0014, 0xD00F2900, 0x1C0F0904, 0x48001100, 0x00280904, 0x010E2803, 0x9A210450,
+0x040DB057, 0x14040270, 0x00080F00, 0x0500041A, 0x0702C004, 0xE00004FC, 0x09F80402, 0x599CD180,
+0x60A3D7FF, 0x2004DCFF, 0x0E9C95C9, 0x1D105911, 0x75B7E771, 0x5799C9FF, 0xCF40000C, 0xBCFF5A9E,
+0x0EB40003, 0x00003000, 0xB400039C, 0x0004000D, 0x08000C00, 0x40040004, 0x00280004, 0x0F000404,
+0x10010500, 0x0004A4D1, 0xA0210E58, 0x01050456, 0x40F00448, 0xCDFF5B9D, 0xB5FF5B9A, 0x68FF6E9E,
+0x67FF6E85, 0x2BFF9BA7, 0x3DFF6A7B, 0x27FF8187, 0x0DFF6851, 0x1BFF3A1D, 0x34FF2516, 0xCFFF131E,
+0xCAFF7BA8, 0xCFFF5A9A, 0xD2FF5E9C, 0xD4FF5B9C, 0xD5FF529D, 0xCEFF529F, 0xCDFF559F, 0xD0FF57A0,
+0xE8FF569E, 0x00040F04, 0x9C571207, 0x37A00037, 0xFF579D48, 0x700004D0, 0xD3FF569E, 0xA4FF539F,
+0x00F80000, 0x00000400, 0xA0000048, 0x09C00004, 0x80000C00, 0xFF579DCE, 0xFF579ECC, 0xCE310008,
+0x50E4599D, 0x00008800, 0xD0100078, 0x9DB0003C, 0xA0D5FF51, 0xA2D6FF57, 0x0020FF5C, 0x9ECE18F1,
+0x9BC7FF5E, 0x96C0FF5C, 0xB8E0FF5B, 0xCDF5FF7E, 0x9ECAFF93, 0x96C7FF61, 0x9FD3FF52, 0xA0D4FF58,
+0x9ED2FF59, 0x000F6C57, 0x64000038, 0x06A00000, 0x0D00040F, 0x0001C800, 0x28080004, 0x00100C00,
+0x0F001C08, 0x0809000C, 0xB40101C8, 0x06C40701, 0x01027C0F, 0x0002A004, 0xF4000008, 0x0004000F,
+0x04038004, 0x54000A30, 0x00040016, 0x04117000, 0x08000504, 0x05040000, 0x00000400, 0x04081420,
+0x2D780000, 0x04050400, 0x08001418, 0x05080400, 0x21050401, 0x3AF04E8E, 0x0F04F400, 0x04010004,
+0xE0010504, 0x13E40404, 0x01000807, 0x08000EF4, 0x09F8050F, 0x70904D11, 0x4D89C540, 0x000004FF,
+0x040022B0, 0x04F80400, 0x00000800, 0xD0000EE8, 0x09E40018, 0x00000400, 0x080409E4, 0x000C0000,
+0x0404F400, 0x6C000004, 0x92CC352C, 0x0013D851, 0xD40009D8, 0x00040F04, 0x1BA40005, 0x0000040C,
+0xF0000500, 0x00040818, 0x000EF000, 0xF4000004, 0x19080004, 0x00000800, 0x44000010, 0x04C80404,
+0x0004E000, 0x1400000C, 0x00200600, 0x178C5915, 0x04003000, 0x40020004, 0x001C0E14, 0x03001806,
+0xB00F12C0, 0x60000009, 0x00040F00, 0x04F0001D, 0x0100040F, 0x09004808, 0xB8040020, 0x00080704,
+0x00029408, 0x10080290, 0x000C0F00, 0x08F00F0E, 0x03F40000, 0x0013F400, 0x74001384, 0x9FD12217,
+0xEF711DD8, 0xD0FF7BBD, 0x03B85B9F, 0x5B9ED271, 0x589ED1FF, 0xD23308B8, 0x043458A0, 0x01045C0E,
+0x9E2103F8, 0x01047856, 0x5008000C, 0x04640304, 0x03037C02, 0xF800003C, 0x549ED004, 0x57A1D2FF,
+0x559FD0FF, 0x089FD1FF, 0xFF592000, 0x18F10E18, 0xFF6CA2BE, 0xFF556D5F, 0xFF9EAA7C, 0xFF707C3A,
+0xFF848549, 0xFF3B230B, 0xFF372325, 0xFF142132, 0xFF80A7C6, 0x3C6096C4, 0x13D00009, 0xA2D508F2,
+0x9FD1FF59, 0x9CCEFF53, 0xA0D0FF50, 0xA1CFFF52, 0x9FD2FF54, 0x21045056, 0x005C579F, 0x04006000,
+0xC8010004, 0x00180C00, 0xE8589E21, 0x00EC0000, 0x10002800, 0x210040D4, 0x0014569F, 0x001CCF10,
+0x50579F21, 0x00580000, 0xC0002000, 0xFF5A9ECD, 0xFF5B9ECB, 0xFF5B9DCD, 0x74010620, 0x589E3004,
+0x00002CFF, 0xD3310004, 0x054059A1, 0x4F98CF31, 0x04F104E0, 0xFF5D9DCB, 0xFF5E96BB, 0xFF8AB3CF,
+0xFFD8FFFF, 0x0469A3CB, 0xA2D6311A, 0xF100205B, 0x5397C800, 0x5DA1D2FF, 0x59A2D7FF, 0x519CD3FF,
+0x4801003C, 0x01540801, 0x00000C07, 0x04010084, 0x009C0000, 0x0100040F, 0x003D7C01, 0x04063D80,
+0x05C80000, 0x1500040F, 0x1F01AC02, 0x07104057, 0x00029807, 0x0400028C, 0x00040005, 0x00050400,
+0x00040004, 0x00080405, 0x00051800, 0x08000A18, 0x00040005, 0x00050400, 0x54040004, 0x12F80123,
+0x003D7003, 0x080017C8, 0x00040405, 0x00051000, 0x18000004, 0x2F30000A, 0x03000401, 0x38000A08,
+0x00040031, 0x0804A400, 0x00040004, 0x04F00505, 0x0304F400, 0xC4600004, 0xC4FF4F87, 0x0004F888,
+0x4C110004, 0xFC0104F8, 0x988A1204, 0x05000031, 0x00004C08, 0xF000000C, 0x00040004, 0x0004F00D,
+0x040739D8, 0x04FC0000, 0x0334E001, 0xF80018CC, 0x09E00404, 0x0000080C, 0xFC080F04, 0x0E980004,
+0x0004C400, 0xA8010004, 0x59962104, 0x54001E04, 0x0498043F, 0x00001801, 0x96101C58, 0x6C0204A0,
+0x0444003F, 0x0204F800, 0x56110038, 0x000C1778, 0x00400405, 0x0C1CD000, 0x1C040004, 0x00080000,
+0x03001C06, 0x48040E3C, 0x00080F09, 0x0094001C, 0x09000404, 0x480F04D8, 0xD03A0C00, 0x0E38599A,
+0x00078407, 0x540904E4, 0x001C0309, 0x04001404, 0x28080008, 0x00140400, 0x0002D004, 0xF8000008,
+0x00040004, 0xD8A0D322, 0xA0D16209, 0x9CCEFF5C, 0xE5310D8C, 0x129871B3, 0x579BCC32, 0x9C120DDC,
+0xD4310404, 0x17E05AA2, 0x20131000, 0x0354A1D5, 0x0004C803, 0x04002C58, 0x04500C00, 0x07001000,
+0x20000398, 0x00040404, 0x0008DC00, 0xF8000484, 0xA2D3B104, 0xA0D1FF58, 0xA0D1FF54, 0x00050C56,
+0x1DF00E54, 0xFF65A0C0, 0xFF658385, 0xFF87957B, 0xFF7A8052, 0xFF66633A, 0xFF2C1A16, 0xFF141124,
+0xFF7A9DBD, 0xFF629CC4, 0xFF629ED0, 0xFF5EA0D4, 0xCC4004FC, 0x48FF4E9A, 0xA3D27100, 0x9DCEFF59,
+0x31005051, 0x5857A0D3, 0x00680004, 0x0100040F, 0x0B043C01, 0xFC0100A4, 0x00B40304, 0x00099400,
+0x3C000044, 0xA0D07200, 0x9FD2FF58, 0x61000459, 0xD0FF58A0, 0x0124599F, 0x13C0CE10, 0x105C9E21,
+0x05C80000, 0x00000400, 0xD8000638, 0xA0D13113, 0xF005785A, 0x5DA6D90D, 0x5CA0CFFF, 0x5D92BAFF,
+0x8FBCDBFF, 0xE0FFFFFF, 0x8AB6D1FF, 0x609BC5FF, 0x0005BCFF, 0x880109F8, 0x5EA02101, 0x6C000028,
+0xA2D62F19, 0x050705BC, 0x900000B8, 0x00980705, 0x0100BC08, 0x9E3100AC, 0x06BCFF5B, 0x0005080F,
+0x0F0F8C00, 0x04010004, 0x1C02051C, 0x0B200A00, 0x00023800, 0x24050004, 0x027C030A, 0x00026C00,
+0x04040500, 0x11180200, 0x000CC00A, 0x00000518, 0x00040205, 0x2A745315, 0x0E050802, 0x0C043848,
+0x28640005, 0x0005040C, 0x04010960, 0x0A080300, 0x00363000, 0x94000500, 0x0004040E, 0x0404B000,
+0xEC0104F8, 0x4F872104, 0x0C0118F8, 0xE8881000, 0x004E1109, 0x89C53105, 0x1704FC4E, 0x0004F8C6,
+0xEC0804FC, 0x04F40009, 0x04000404, 0xE00004FC, 0x0004000E, 0x0031D001, 0x040748EC, 0x04F00500,
+0x27009512, 0x001D6405, 0x96211D58, 0x00259453, 0xEC0804F4, 0x000C0004, 0x04000400, 0x080204C0,
+0x40581100, 0x04940021, 0x0A00040F, 0xFF5A9943, 0x000004CE, 0x040020F4, 0x00100000, 0x00052800,
+0xD04004CC, 0x04FF5B9A, 0x000C0000, 0x00000400, 0x0402000C, 0x053C0200, 0x19049C0F, 0x01002C08,
+0xAC0004A8, 0x00040704, 0x04002000, 0x0C000018, 0x00040900, 0xD8579A2F, 0x48000A04, 0x00040D02,
+0x0009B403, 0x040F0278, 0x5C060D00, 0x02B80404, 0x0F04A400, 0x00070004, 0xAC0012D4, 0x13EC0003,
+0xB109F800, 0xFF5597C9, 0xFF78BAEA, 0x0C62A2D2, 0x05140005, 0x0DBCD510, 0xD4549C21, 0x03780009,
+0x00050400, 0xB00008B0, 0x0DAC0012, 0x00000400, 0x04000018, 0x03740100, 0x00041800, 0x24000004,
+0x00040304, 0x00001804, 0x0400038C, 0x035C0100, 0xFF589E30, 0xF4000458, 0x04B80104, 0x0057A125,
+0x00140005, 0x9FC510F1, 0xA7B9FF5F, 0x5A58FF7E, 0x3B28FF47, 0x2012FF42, 0x1D2EFF2C, 0x9BBFFF1A,
+0x9DCAFF83, 0x400EF46A, 0xFF5F9DD0, 0x40001938, 0x9DCE3104, 0x31048453, 0x745BA2D0, 0xA1D42204,
+0x7C050060, 0x04BC0400, 0x07009C00, 0xA4010004, 0x5CA03004, 0x0C00ECFF, 0xB8000004, 0x04980018,
+0x0000F400, 0x2C000004, 0x04C80000, 0x40000404, 0xFF5D9FD3, 0x84000004, 0xA1D25005, 0xC8D1FF5B,
+0x58A22105, 0x18010014, 0xA110F000, 0xA2D3FF5B, 0x9CCAFF5C, 0x96BCFF5C, 0xBAD2FF60, 0xFFFFFF96,
+0xC6E5FFE5, 0x94BBFF99, 0x0F10FF5D, 0x5EA1D531, 0x2000007C, 0xA2D3310F, 0x0000305E, 0x7C000154,
+0x00BC0005, 0x07056801, 0x100C00B0, 0x00940000, 0x00000404, 0x040401CC, 0x00CC0000, 0x2100C001,
+0x19805C9F, 0x0F017800, 0x00050004, 0x1C040028, 0x019C0100, 0x385A9D29, 0x02580405, 0x04000804,
+0x10000288, 0x000C0400, 0x03051405, 0xC80002B0, 0x05100102, 0x0B07EC08, 0x180411D4, 0x1424000A,
+0x00168400, 0x04040400, 0x04340400, 0x040F2000, 0x0800050C, 0x0A180800, 0x61050401, 0xCCFF5091,
+0x00044F8F, 0x00138400, 0x04040004, 0x05000005, 0x7104F001, 0xC5FF4F87, 0x0CFF5088, 0x04FC0300,
+0x4004F800, 0xFF4F8AC6, 0xC8000004, 0x0004005C, 0x0404E404, 0xEC000008, 0x000C0804, 0x00001000,
+0xF8040EE4, 0x3EC80104, 0x0743D000, 0xFC0509E8, 0x18941204, 0x0ADC0024, 0x0100CC00, 0x900300E0,
+0x00E40418, 0x02000800, 0x880604E8, 0x09300018, 0x0009C800, 0xF40C001C, 0x04BC0004, 0x00000400,
+0x08000018, 0x00040400, 0x1004EC00, 0x1004E4CF, 0x201B689B, 0x000CFF5C, 0x00000400, 0xD12004E4,
+0x0216949B, 0x10000004, 0x00340400, 0x0604A40F, 0x0401B007, 0x080F0024, 0xE4000900, 0x00040449,
+0x00002808, 0xFC080014, 0x001C0104, 0x00073007, 0x04000220, 0x099C0500, 0xFF599C3C, 0x5400000C,
+0x02600402, 0x00000808, 0x040F0278, 0x00021300, 0x02DC0408, 0x00000808, 0x68000328, 0xA0D2310E,
+0x0008C85E, 0xED1004FC, 0xA0A10EF4, 0x9BCBFF5E, 0x9FCFFF5B, 0x0013F05D, 0x04000854, 0x0DCC0005,
+0x000A3000, 0x7C0004B4, 0x04740000, 0x0454D310, 0x00088007, 0x040003B0, 0x005C0000, 0x1003A800,
+0x000E00D1, 0xA0300410, 0x0448FF5A, 0x01008008, 0x4003000C, 0x045C0000, 0x01000400, 0xA030005C,
+0x000CFF58, 0xA0CB18F1, 0x9DBCFF5D, 0x8899FF68, 0x1B1CFF6D, 0x040BFF25, 0x94B1FF13, 0x9FCCFF86,
+0x98CEFF7A, 0xA0D8FF61, 0x9FD4FF5F, 0x130A0060, 0xB10468D4, 0xFF5EA2D1, 0xFF5A9CCC, 0xC062A5D9,
+0xA0D44003, 0x001CFF5D, 0x00000800, 0x08000080, 0x00100000, 0x090E6400, 0xA0210004, 0x000E785E,
+0x8401010C, 0x5FA17004, 0x5FA1D3FF, 0x000010FF, 0xD5400028, 0x04FF5BA3, 0x00100000, 0x60A0D0B1,
+0x60A0CEFF, 0x5EA0D0FF, 0xD5710458, 0xD6FF5BA1, 0x00685EA1, 0x00050400, 0x10000004, 0x00040205,
+0xFF5D0EF1, 0xFF61A0CC, 0xFF6193B8, 0xFF9BC3DD, 0xFFE6FFFF, 0xFFA7CAE0, 0xFF5F93B8, 0x60619FCE,
+0x047C0000, 0x31067C00, 0x7060A2D2, 0x04800010, 0x5FA3D440, 0x000088FF, 0x5000007C, 0x00080F00,
+0xC45D1113, 0x04F80000, 0x0000A800, 0x5C000034, 0x00040F00, 0x01840009, 0x00002008, 0x04040010,
+0x00180000, 0x20000C06, 0x01ECFF59, 0x00000400, 0x040C01FC, 0x029C0400, 0x0902B000, 0x18070004,
+0x03000008, 0x03051001, 0x10000F34, 0x0004000A, 0x00050400, 0x04010500, 0x1CA00300, 0x00041400,
+0x34010400, 0x51972504, 0x000021D8, 0x00040005, 0x210A1406, 0x0E6CFF51, 0xFF509050, 0x050890CD,
+0xCCFF5130, 0x8E2147DC, 0x05189050, 0xF4070500, 0x04F80604, 0xF4FF4E20, 0x04F80009, 0x00000400,
+0xEC0827AC, 0x04E80004, 0x042C9400, 0xC4001DC4, 0x00040418, 0x0018C804, 0xCC010008, 0x432C0018,
+0x03483000, 0xE4000508, 0x0ED8000E, 0x0000C001, 0x7C004324, 0x0004081D, 0x03242800, 0xF0001D7C,
+0x00040504, 0x21889A10, 0x09CC5811, 0x0604C000, 0xC00204AC, 0x04C00009, 0x00000400, 0xE40004F0,
+0x00240109, 0xF05B9A25, 0x00100404, 0x00174000, 0x1C000004, 0x00040408, 0x599BCF4C, 0x020004FF,
+0x5911001C, 0xF80403E8, 0x0008080B, 0x08028C00, 0x0C0C0010, 0x09400000, 0x08000408, 0x18080020,
+0x000C0800, 0x00002400, 0x04000454, 0x042C0000, 0x0100040F, 0x01001C00, 0x88030004, 0x02880407,
+0x08000808, 0xA80002A0, 0x00040400, 0x00002400, 0x0400001C, 0x00140000, 0x00000800, 0x1000085C,
+0x03680003, 0x000D9800, 0x24001C70, 0x00100003, 0x61A1D131, 0xE80004F0, 0x184C001D, 0x0031D800,
+0xE0040898, 0x00400003, 0x34000401, 0x40FF5AA0, 0x00080004, 0x04045000, 0x08000018, 0x03780000,
+0x21000405, 0x08D45D9F, 0x5AA2D231, 0x0C010914, 0x5AA02105, 0x580403A0, 0x007C0004, 0x08000C00,
+0x9C0003E8, 0x00040004, 0x00057000, 0x14F104CC, 0xFF609FC8, 0xFF81A8C7, 0xFF423D51, 0xFF201327,
+0xFF5B698C, 0xFF7BA0CD, 0xFF659AD0, 0xFF619FD8, 0x945E9FD5, 0x00AC0000, 0x04B4D114, 0xFF609F40,
+0x00045CD2, 0x140040F4, 0x09540000, 0x0100080F, 0xFF5FA161, 0x0460A2D4, 0x0AF00000, 0x00048000,
+0x4800010C, 0x00080600, 0x10FF5F20, 0x40D51000, 0x0CA11000, 0xFF61A000, 0xFF62A0CF, 0xFF63A0CF,
+0x08000024, 0xD905F00B, 0xD9FF5BA4, 0xDAFF5CA3, 0xD3FF62A5, 0xCEFF639F, 0xC0FF609C, 0xA4D53104,
+0xF10B485E, 0x6195BC08, 0xA1C0D5FF, 0xEBFFFFFF, 0xACD1ECFF, 0x6494B8FF, 0x66A1CDFF, 0x58000040,
+0x0A000000, 0x0088D610, 0x0090A312, 0x00011400, 0x6400005C, 0x000C0005, 0x0001B800, 0x080401AC,
+0x01300000, 0x00001800, 0x18080064, 0x000C0100, 0x0005C800, 0x04000004, 0x00080001, 0x0400040F,
+0x00017C00, 0x34090004, 0x002C0F00, 0x01E80000, 0x00000400, 0x040401E0, 0x02600000, 0x00000400,
+0x0800025C, 0x00040000, 0x0302AC01, 0x0C001034, 0x07280000, 0x00000400, 0x04000804, 0x04FC0000,
+0x00000401, 0x00031F48, 0x050C0005, 0x00050000, 0x04000004, 0x00040105, 0x00041403, 0x04000900,
+0x04400400, 0x00000800, 0x04040944, 0x05040000, 0x04000401, 0x92340470, 0x0A0CFF51, 0x04141800,
+0xF0010A10, 0x09FC0009, 0x000EE401, 0xF4000EE8, 0x09F40004, 0x0F66BC02, 0x0C0D0500, 0xF00004FC,
+0x00040004, 0x0404F400, 0xC8000004, 0x04EC001D, 0x00000400, 0x040404F8, 0x00100000, 0x0000B800,
+0xDC010004, 0x05000705, 0x0000DC00, 0x080404F4, 0x000C0000, 0x0B000401, 0xEC000500, 0x09C00804,
+0x00000C00, 0xE8040014, 0x00080404, 0x082A3000, 0xFC000004, 0x00040004, 0x0004E002, 0x040F12E0,
+0xFC0F0500, 0xDC000304, 0x00040F01, 0x02100125, 0x00117003, 0x040C04EC, 0x00580000, 0x0104F40F,
+0x0100140F, 0x03002C01, 0x580011C4, 0x00040800, 0x00029004, 0x180F0008, 0x5C000500, 0x098C0003,
+0x00033400, 0xF4000008, 0x00040402, 0x63A3D350, 0x7CB0CFFF, 0xFF589870, 0xFF80C0F0, 0xF8000010,
+0x037C0004, 0x00000C00, 0x20000508, 0x03000003, 0x0408CC04, 0x140203B0, 0x7C5D1100, 0x00640004,
+0x0C039000, 0xB0010004, 0x5AA23003, 0x040504FF, 0x240508C4, 0x61A02100, 0xFC0054F8, 0x00140554,
+0xFF5FA132, 0x08020060, 0x00180000, 0xF3047C00, 0x6C9CC40A, 0x9BA1C1FF, 0x24203BFF, 0x151E3DFF,
+0x8CA8CFFF, 0x73A5D8FF, 0x09FCD5FF, 0x71002800, 0xFF61A1CF, 0xCC62A2D0, 0x69680004, 0x64A0D240,
+0x0C0004FF, 0x2C000060, 0x00040100, 0x00008003, 0x0400002C, 0x05000200, 0x04B06211, 0x02000C0F,
+0xFF63A183, 0xFF63A1D2, 0x000004D0, 0x3800005C, 0xA4D7B100, 0xA3D6FF5E, 0xA3D7FF5A, 0xF11F3C5C,
+0x649BD118, 0x6CA4D7FF, 0x63A3D1FF, 0x61A0CBFF, 0x6499C1FF, 0x98C1E1FF, 0xE9FFFFFF, 0xB7D2E7FF,
+0x6E9BBCFF, 0x67A0CBFF, 0x8805004C, 0x5FA15200, 0x04A2D6FF, 0x05900000, 0x31008000, 0x6864A1D0,
+0x018C0105, 0x01057C03, 0xB4040030, 0xECA11605, 0x00340000, 0x0F008C00, 0x00060004, 0x0403055C,
+0x00440400, 0x1500080F, 0x0801F804, 0x700001F0, 0x00040802, 0x00027C04, 0x040904F8, 0x07BC0000,
+0x30BC9C10, 0x24145A11, 0x0F050801, 0x00000D00, 0x04000508, 0x05080100, 0x0C05000B, 0x4C000438,
+0x00040004, 0x00285C00, 0x6C000004, 0x0E700004, 0x00186C00, 0x04040A08, 0x00080405, 0x0618E000,
+0xF80209F0, 0x04F40804, 0xA113E40D, 0xC9FF508C, 0xCAFF518D, 0x0004528E, 0x0009F000, 0x040004F0,
+0x04F00000, 0x001D9400, 0xCA440004, 0x04FF5594, 0x1D880400, 0x00186C00, 0x0402000C, 0x90541100,
+0x00C00422, 0x2105DC01, 0x18945598, 0x0004E808, 0x04081C70, 0x09D80000, 0x00000404, 0xD40404DC,
+0x000C0004, 0x0000040C, 0x9800001C, 0x00040F26, 0x05000209, 0x0004E40E, 0x04000458, 0x049C0800,
+0x04001000, 0xD4040004, 0x04340001, 0x0100040F, 0x0408E804, 0x1004001C, 0x00080C00, 0x00002004,
+0x04001C1C, 0x00100400, 0x06002804, 0x5A240010, 0x0A11C4FF, 0x5C240008, 0x0804B0FF, 0x98000008,
+0x00040F04, 0x09EC0011, 0x62A4D440, 0x0017A4FF, 0xBC00044C, 0xA4D4310D, 0x31127864, 0x845E9CCB,
+0xBDEC500D, 0xD4D1FF7F, 0x609E7008, 0x66A6D6FF, 0x000024FF, 0x04000508, 0x03540105, 0x0C033C00,
+0xA2210370, 0x010E2060, 0x2004037C, 0x40A11C00, 0x6003F004, 0x5CA3D1FF, 0x5CA5D2FF, 0x5DA4D2FF,
+0x5FA3D2FF, 0x000964FF, 0x4C0003E0, 0x00600004, 0x01000400, 0xA2120010, 0x7001003C, 0x006C0000,
+0xFF63A150, 0x044CA2D5, 0xFF660AF1, 0xFF6B9ECB, 0xFF84A2C6, 0xFF4E5A74, 0xFF131023, 0xFF858CA6,
+0x7C6B9CC7, 0x03C80005, 0x03004001, 0xD52004A0, 0x910038A2, 0xA2D3FF63, 0xA2D1FF64, 0x0005D464,
+0x040D0064, 0x001C0000, 0x8864A221, 0x008C0004, 0x00000400, 0x04040034, 0x003C0900, 0xFF64A261,
+0x0467A1CF, 0xA2D1B100, 0xA3D4FF65, 0xA3D6FF65, 0x31000464, 0x3862A4D8, 0xD90CF124, 0xD7FF63A5,
+0xD5FF65A4, 0xCEFF69A3, 0xD2FF659D, 0xBAFF70A6, 0xD6FF6696, 0x13F099BB, 0xE2FF05F0, 0x99BBFFBD,
+0x9FC7FF6B, 0x9ECCFF6A, 0xA6D9FF64, 0x0034FF67, 0xB0007001, 0xD5FF63A3, 0xD7FF61A3, 0xC0FF61A3,
+0x00140000, 0x31006800, 0xC866A3D2, 0x00BC0D00, 0x00E0A312, 0x00001800, 0x000800B8, 0x003C0001,
+0x00000405, 0x04070028, 0x00280100, 0x0F016803, 0x0001000C, 0x040A056C, 0x10040200, 0x0C016400,
+0x7C080004, 0x02CC0802, 0x06033804, 0x5C430008, 0x1C9ED2FF, 0x5B9D2F06, 0x04020D68, 0xEC010D1C,
+0x3499102D, 0x1CD40039, 0x04000402, 0x08040438, 0x04500400, 0x04000800, 0x60000508, 0x00040013,
+0x000A1001, 0xD80047D8, 0x188C0349, 0x0004FC00, 0xE4080004, 0x0EEC0513, 0x0304EC00, 0xEC0027B4,
+0x0004010E, 0xFF528E61, 0x04538FCB, 0x407C0000, 0x0004F804, 0xE80004FC, 0x04F40809, 0x0004E802,
+0x88022C7C, 0x0500002C, 0x02000406, 0xEC012790, 0x26D40804, 0x03135C04, 0xFC040E8C, 0x2B580004,
+0x29000401, 0x0ECC5A99, 0x0F04E400, 0x4F090004, 0xFF5D9CCF, 0x01060004, 0xFC0F0170, 0xA0060317,
+0x13200F01, 0x06E40007, 0x0004A004, 0xE8040008, 0x00080801, 0x00001804, 0x180408EC, 0x00140F00,
+0x04BC0101, 0x04176400, 0x6C000E18, 0x24A1120C, 0x0038040E, 0x06092404, 0x5D110008, 0x7C0C0464,
+0x00100F02, 0x04F00015, 0x00047000, 0x000013C8, 0xA9D93105, 0x0040B467, 0xD23109F4, 0x08CC65A3,
+0x7CBAE931, 0x34000868, 0x034C0003, 0x00030000, 0xD5310020, 0x0DA065A5, 0x0003E800, 0x040C0394,
+0x04A80100, 0x0004F807, 0x24000010, 0x03940000, 0x00056000, 0x0C000050, 0xA4D38100, 0xA5D3FF60,
+0x0008FF5E, 0x9061A326, 0x64A22104, 0x2C010448, 0x03A40700, 0x0104F400, 0x14F00004, 0xD6FF65A1,
+0xD1FF66A2, 0xCEFF659F, 0xC8FF699F, 0xBBFF70A0, 0x3DFF819F, 0x63FF332F, 0xD1FF5051, 0xD8FF7DAA,
+0xA4D24005, 0x0428FF64, 0x68A2D431, 0x50020030, 0x00680200, 0x00098400, 0x04090010, 0xC0A31200,
+0x04C40004, 0x0900040F, 0x31012000, 0xE466A4D3, 0x00280004, 0xA3CF04F1, 0xA2CFFF68, 0xA4D1FF69,
+0xA4D5FF67, 0xA5D7FF66, 0x1704C063, 0x400050D6, 0xFF67A4D3, 0x14F109B8, 0xFF6EA4D0, 0xFF6A9AC0,
+0xFF94B8D8, 0xFFE7FFFF, 0xFFCEECFF, 0xFF6D9BBF, 0xFF689ECA, 0xFF69A3D1, 0xA868A6D5, 0x053C000A,
+0x00016800, 0xA4050050, 0x65A33000, 0x000078FF, 0x0400004C, 0x007C0000, 0x13001C05, 0x080134A4,
+0xC8030074, 0x01700105, 0x08015404, 0x5C070020, 0x01900101, 0x0F00100B, 0x08010508, 0xD8000014,
+0x06E40101, 0x00069400, 0x040301F0, 0x02840800, 0x00050C04, 0x340002C8, 0x00040403, 0x00036400,
+0x04001A04, 0x05040000, 0x04000400, 0x08000860, 0x087C0400, 0x00050004, 0x24010008, 0x949A120F,
+0x000C001C, 0x000A1400, 0x000F0004, 0x04000105, 0x0A040005, 0x08000404, 0x14000504, 0x0004000A,
+0x4D8AC331, 0x94007A80, 0x000404A2, 0x0013D400, 0xDC040004, 0x2CA4080E, 0x00369C00, 0x780004F8,
+0x00040240, 0x11368400, 0x0809EC52, 0x0C0004F0, 0x04EC0000, 0x00000800, 0x0C000004, 0x1D6C0000,
+0x04351C00, 0xDC000004, 0x04D40104, 0x000ED404, 0xF80338CC, 0x13880404, 0x0409EC08, 0xF00809E0,
+0x04DC0404, 0x5E9DD04C, 0x010004FF, 0xE400001C, 0x207C0004, 0x1800040F, 0x00048C01, 0x040F0488,
+0x04053800, 0x00540702, 0x01001404, 0x90040008, 0x00080311, 0x000D9804, 0x4C05001C, 0x12A80302,
+0x0111D800, 0xA2210274, 0x00127C60, 0x04040494, 0x029C0800, 0x01000C0F, 0x0D02E400, 0xA4210018,
+0x000D9064, 0x74000E20, 0x03600017, 0x609DCCB1, 0x7EBBEAFF, 0x6CA9D8FF, 0xF00003B4, 0x03F40108,
+0x21088C00, 0x04A865A5, 0x01037800, 0x5007039C, 0x03900403, 0x09006800, 0x7C070004, 0x00340503,
+0x2103B000, 0x04A862A4, 0x61A3D340, 0x000050FF, 0x800004B0, 0x006C0000, 0x00000401, 0x040704C0,
+0x00600100, 0x30007000, 0xD4FF66A2, 0xA4D52004, 0x22F100A0, 0xA8D4FF69, 0xA4C6FF6B, 0x707EFF79,
+0x3846FF6A, 0xABCFFF32, 0xA2CEFF83, 0xA5D1FF67, 0xA5D2FF68, 0xA2D8FF68, 0xA2D7FF6D, 0xA5D5FF69,
+0xA7D3FF63, 0x01000860, 0xA538045C, 0x0008FF65, 0x00DCD310, 0x23000408, 0x047066A4, 0x0300080F,
+0x66A4D731, 0xD01004F0, 0xA42104DC, 0x00050067, 0x04F10B24, 0xFF63A7D8, 0xFF64A6D8, 0xFF68A4D6,
+0xFF6BA3D4, 0x906AA2D1, 0xCF14F100, 0xBFFF6AA8, 0xD6FF659B, 0xFFFF92B6, 0xFFFFE4FF, 0xBCFFD6F6,
+0xC6FF789F, 0xD4FF6D9E, 0xD6FF6DA8, 0x09EC67A5, 0x04003C00, 0x50000004, 0x00C80000, 0x60A4D022,
+0x01200005, 0x0F00B405, 0x000C00A0, 0x040F002C, 0xEC080A00, 0x000C0F00, 0x019C000C, 0x0500040C,
+0x680001E4, 0x053C0305, 0x00026008, 0x64000020, 0x02C40007, 0x0402CC00, 0x64000004, 0x0C7C0003,
+0x00001000, 0x0404000C, 0x081C0000, 0x00000400, 0x04000500, 0x05040400, 0x0B000805, 0x40011930,
+0x2B7C0709, 0x00133000, 0xFC000004, 0x00040804, 0x000A0C00, 0x20040004, 0x00080014, 0x003AFC00,
+0xF8007F7C, 0x4A5C0004, 0x00000400, 0x040404F4, 0x04F80000, 0x00000400, 0x04000EE4, 0x09EC0000,
+0x0004FC00, 0xFC000004, 0x57E40004, 0x0009F002, 0xE8025710, 0x04EC0009, 0x00000400, 0x040804F0,
+0x04FC0000, 0x001D9400, 0xD4041894, 0x00080104, 0x0004FC07, 0xF804050C, 0x00080004, 0x08001000,
+0x0C0404EC, 0x4DB40000, 0x00000404, 0xF80004E4, 0x9ED14004, 0x0004FF5F, 0x003A8400, 0x14000008,
+0x00040100, 0x070B5C00, 0x68040474, 0x00080F01, 0x01900005, 0x0C000408, 0x600001B8, 0x00200100,
+0x0104A803, 0xAC00000C, 0x00040F09, 0x00440008, 0x0200040F, 0x01126403, 0xA02104EC, 0x0112F062,
+0x4C000750, 0x00040807, 0x21075400, 0x031862A1, 0x00094400, 0x08010D0C, 0x63A22100, 0x64000488,
+0x00040802, 0x08044800, 0x0C080010, 0x001C0000, 0x00000409, 0xA2610ED0, 0xA7D5FF62, 0x00132067,
+0x04000474, 0xC0EFC005, 0xA5D4FF83, 0x9ECDFF68, 0x0868FF61, 0x69A6D531, 0xD7100A08, 0xA421089C,
+0x00043464, 0xCC000048, 0x00040F04, 0x001C0001, 0x04000400, 0xB80003A8, 0x00280004, 0x0403E000,
+0x10000004, 0x00200000, 0x01002800, 0xDC030004, 0xA5D43108, 0x00047467, 0x900C008C, 0x00340104,
+0x10047400, 0x510024A3, 0xA4D2FF67, 0x0000A06A, 0x06F30610, 0xFF6EA2CA, 0xFF92A6BE, 0xFF2B3A4F,
+0xFF6285A5, 0xFF76A7CF, 0x310434CE, 0x006AA1D7, 0xA6D39005, 0xA8D4FF62, 0x9CD6FF61, 0x66A62104,
+0x840000C8, 0x00040400, 0x0F00700C, 0x000A043C, 0xA5210A00, 0x4404B467, 0xFF67A6D2, 0xD4350004,
+0x006066A6, 0xF0050001, 0xFF6CA61A, 0xFF6EA4D2, 0xFF6CA3CA, 0xFF689EC0, 0xFF8AB9D5, 0xFFE0FEFF,
+0xFFDBF9FF, 0xFF82ABC9, 0xFF6B9DC2, 0xFF6CA3CC, 0x05A0A6D3, 0xDBFF6540, 0x5100D8A9, 0xAAD9FF64,
+0x0010706C, 0x00000050, 0xA5D13105, 0x0000646A, 0xB00400A4, 0x001C0000, 0x0F013000, 0x09190004,
+0xF40F00D4, 0x60010C04, 0x66A63000, 0x0F0074FF, 0x04010004, 0xE0000190, 0x00040101, 0x1054A416,
+0x00050800, 0x800001D8, 0x01A00002, 0x04000400, 0x38040308, 0x00100003, 0x00000C04, 0x24000008,
+0x0004000A, 0x080A1C00, 0x0C000004, 0x00040105, 0x142C9B12, 0x0809FC00, 0x48040004, 0x05100521,
+0x9C569921, 0x0A180C4C, 0x00050400, 0x00000004, 0x00040005, 0x0C595400, 0xF40809EC, 0x04F80804,
+0x0404F400, 0xCC400004, 0x74FF5792, 0x0500004F, 0x001E8800, 0x040A1E90, 0x45740000, 0xF0FF5820,
+0x00040404, 0x0404F000, 0x080C09C4, 0x001C0800, 0x0004E804, 0xE8040024, 0x00080404, 0x5E9DD248,
+0x010004FF, 0x9D2104E4, 0x0004FC5E, 0x040404F8, 0x0DA40000, 0x00000400, 0x04081BF8, 0x0DF40000,
+0x1100040A, 0x040DC861, 0x080F0940, 0xA0220E00, 0x04003062, 0xA12F0008, 0x07171461, 0xA062A221,
+0x02080004, 0x00000404, 0x0400020C, 0x00100500, 0x00073800, 0xA1220004, 0x0011CC65, 0x0407000C,
+0x02540400, 0x0200080F, 0x7C65A321, 0x001C0108, 0x03091400, 0x94040010, 0x00080002, 0x00001C08,
+0x1400000C, 0x00040000, 0x21048405, 0x09FC67A7, 0xF103BC00, 0x69A8D404, 0x63A0CDFF, 0x7FBCE9FF,
+0x6EA8D6FF, 0x629CCAFF, 0x98000D90, 0x12700003, 0x00033800, 0x4C000038, 0x12A0000D, 0x0102DC00,
+0xA4100010, 0x2002048C, 0x03880409, 0x00032C04, 0x44000558, 0x00100003, 0x00000800, 0x04000540,
+0x00380000, 0x02008808, 0x68110038, 0x78000574, 0x00900005, 0x55000402, 0xA7D2FF66, 0x00000464,
+0x04010044, 0x67A53000, 0xF10034FF, 0x64A4D014, 0x66A9D6FF, 0x63A2D8FF, 0x6EA3D7FF, 0x7BA0CAFF,
+0x7E9BBDFF, 0x203A5BFF, 0x8AAED0FF, 0x6EA3CFFF, 0xC4000124, 0x00C00005, 0x21050001, 0x099863A7,
+0x69A5D741, 0x4C004CFF, 0xD4FF64A7, 0xA6220004, 0x0F001C66, 0x00040008, 0x040400D8, 0xA7D74000,
+0x0004FF67, 0x52001001, 0xD3FF68A6, 0x010004A7, 0x1BF10EC8, 0xD2FF66A6, 0xCCFF66A6, 0xC7FF6AA4,
+0xC7FF72A4, 0xFFFF83AA, 0xFFFFDEFE, 0xC6FFE0FB, 0xC1FF8DB0, 0xD5FF689C, 0xD8FF6BA8, 0x06806BA9,
+0x40004800, 0xFF68A8D6, 0xCD400A50, 0xF4FF68A3, 0x04FC0004, 0x21005C01, 0x06A867A7, 0x01000C00,
+0xC00000B8, 0x00140F05, 0x012C0014, 0x2D00040F, 0x0B014001, 0xAC000A70, 0x00040001, 0x00001C04,
+0x040001D4, 0x026C0000, 0x00000400, 0x280005A8, 0x02F40002, 0x0000040A, 0x60130338, 0x602015F0,
+0x001FCCFF, 0x28000004, 0x00040012, 0x00050400, 0x2C080004, 0x0510010F, 0x00193400, 0x08031C3C,
+0x19340005, 0x04000400, 0x0804050C, 0x19300405, 0x000F1C00, 0x08050004, 0x5BD00105, 0x025BD400,
+0xF4040004, 0x45780009, 0x0204F808, 0x531109EC, 0xDC004F80, 0x04F80513, 0x68569321, 0x04FC0054,
+0x4564CE11, 0x0213DC00, 0x780113CC, 0x23A0030A, 0x0009F000, 0xD8000004, 0x00040404, 0x0004D000,
+0xE0040004, 0x00080404, 0x00001400, 0x10000004, 0x04E80400, 0x00000800, 0xEC0009DC, 0x04E40004,
+0x00000804, 0xE404000C, 0x00080004, 0x00099001, 0x040B098C, 0x04C80A00, 0x00209802, 0x780204F8,
+0x01780004, 0x02706211, 0x03001002, 0xA11204D4, 0x2C00050C, 0x20C4001C, 0x1117F400, 0x110998D3,
+0x00180062, 0x1C010054, 0x04F40000, 0x01175003, 0xE8031BF0, 0x01E00404, 0x0801F000, 0x18040004,
+0x00080000, 0x00001804, 0x5000000C, 0xC8D41113, 0x0DCC000D, 0x12F06615, 0x00002404, 0x4C000008,
+0x025C0402, 0x00000804, 0x5C000918, 0x00040002, 0x00000C00, 0x2C000004, 0x00040000, 0x04003000,
+0x20000004, 0x000C0400, 0x05000800, 0x14000040, 0x6EA4610E, 0x6DA6D3FF, 0x68000E1C, 0xA3CFB104,
+0xA2CDFF64, 0xBFECFF63, 0x31088882, 0x5C68A2D0, 0x09600009, 0x66A3D071, 0x6AA7D6FF, 0xBC04049C,
+0x0D940004, 0x0F000C00, 0x04010354, 0xA40003F8, 0x03AC0803, 0x21001001, 0x12E068A6, 0x00050000,
+0x08000090, 0x00440000, 0x00003400, 0x4C000004, 0x00100003, 0x41009400, 0xFF67A7D3, 0xA8400004,
+0x04D3FF65, 0x03EC0700, 0x01002C00, 0x17F1001C, 0xD7FF64A9, 0xDBFF66AA, 0xDAFF65A7, 0xD3FF68A4,
+0xD7FF6EA0, 0x79FF86AB, 0xA9FF4259, 0xD0FF6E88, 0xD6FF72A5, 0x000469A7, 0x41008C00, 0xFF64A8D5,
+0xA6610004, 0xA6D6FF69, 0x01008C6C, 0x5C080048, 0x000C0F00, 0x049C0008, 0x0C057000, 0xD8320008,
+0x050466A8, 0x21050004, 0x014869A6, 0xA9D414F1, 0xABD4FF66, 0xA0C2FF6C, 0xAECAFF6B, 0xFBFFFF85,
+0xFCFFFFDF, 0xBCD3FFE3, 0x9DBAFF9C, 0xA7D1FF70, 0x000F8C6C, 0xDA220040, 0x311E18AC, 0x0C66A5D1,
+0x001C000F, 0x6BA6D050, 0x00ACD2FF, 0xFF68A830, 0x78010024, 0x68A83000, 0x0006ACFF, 0x10040568,
+0x00DC0100, 0x0D00B807, 0x78040018, 0x010C0301, 0x03011405, 0x50000018, 0x00040F01, 0x01A00015,
+0x04000406, 0x900206B4, 0x00180406, 0x0001D800, 0x000001E0, 0x0F340005, 0x04029C00, 0x0C010008,
+0x10FC0307, 0x0010F800, 0xFC010F20, 0x28D4091A, 0x0D28AC06, 0x9E610504, 0x9DD3FF5B, 0x0000045C,
+0x040404FC, 0x05040900, 0x0923440F, 0x005BB800, 0x9861226C, 0x8DC7FF52, 0x40595452, 0xFF548FC9,
+0x040413DC, 0x0EE40400, 0x04707800, 0x0C000004, 0x0EDC046B, 0x00000800, 0xE4000004, 0x00040804,
+0x010EE400, 0x6C030004, 0x04D80031, 0x0100040F, 0x001D9404, 0x5404526C, 0x26740035, 0x0004F400,
+0xE8000004, 0x09C00004, 0x0204E400, 0x60420008, 0x049ECFFF, 0x9FD04000, 0x0004FF61, 0x0404A000,
+0x0C0025C8, 0x00040800, 0x00045C00, 0xA00408A8, 0x00080804, 0x0016F800, 0xCF3112D0, 0x08FC63A3,
+0x00001000, 0x94000188, 0x000C0004, 0x01040C00, 0xA1A20400, 0xA0D7FF69, 0xA1D7FF67, 0x611B7865,
+0xD0FF61A3, 0x000462A5, 0x0001CC00, 0xD0400478, 0x04FF65A4, 0x00100000, 0x00125C00, 0x4C041774,
+0x00140000, 0x00020400, 0x5C00006C, 0x04000013, 0x0401EC00, 0x40000214, 0x179C0000, 0x20000402,
+0x0030FF65, 0x20004400, 0x0E90A6D5, 0x08FF6020, 0x022C0000, 0x00031000, 0xCE230810, 0x2112D0A5,
+0x0C9067A6, 0x00003000, 0x2C001770, 0xA5D28004, 0xA9D5FF61, 0x02F8FF62, 0x00007400, 0x70000064,
+0xA7DA311C, 0x001D2869, 0x0CF113C8, 0xFF65A4CF, 0xFF66A5CE, 0xFF7AB4DA, 0xFF446E96, 0xFF709AC2,
+0xFF71A8D1, 0x6466A3CF, 0xC1EA203F, 0x9C001334, 0x1350021C, 0x00001800, 0x680009FC, 0x00040403,
+0x0002E004, 0x30040008, 0x04400403, 0x0100080F, 0x0CA8D420, 0x04C80309, 0x2104D004, 0x00A867A7,
+0x01001C00, 0x180300B0, 0x00100000, 0x0203D800, 0xE4000008, 0x003C0203, 0x00001006, 0x69110098,
+0x28050960, 0x04600000, 0xFF65AAC0, 0xFF63A7D4, 0xFF69A9D7, 0xF00AB8D8, 0xFF749F04, 0xFF7F91B5,
+0xFF516588, 0xFF75A9CE, 0xFF68A9D3, 0x0C0009EC, 0x00280001, 0x63A8D241, 0x400054FF, 0xD2FF6AA9,
+0xA87009AC, 0xA8D3FF69, 0x0168FF69, 0x71098C00, 0xFF6AA7D4, 0x606BA8D7, 0x0428010A, 0xB068A821,
+0x04F80000, 0x22058801, 0x059064A9, 0x9065A821, 0x00C40009, 0x6AAAD831, 0x30000A30, 0x011C0000,
+0xD0017000, 0xFF6DAAD7, 0xFF6BAAD5, 0xFF6CA4C7, 0xF004FCC4, 0xFFDCF902, 0xFFE8FDFF, 0xFFA7C3D9,
+0xFF709EC0, 0x13F4A8D2, 0x005C6911, 0x0200BC00, 0xE40200D4, 0x00840000, 0x6AA7D340, 0x040004FF,
+0xE4000018, 0x000C0404, 0x00000804, 0x0C040198, 0x00080800, 0x0F001800, 0x0F050004, 0x08090028,
+0x0C00001C, 0x00440F00, 0x00180F05, 0x02900009, 0x00010400, 0x24000008, 0x00080002, 0x00001004,
+0x6800029C, 0x00080001, 0x1002DC00, 0x612E88D2, 0xD1FF62A5, 0x000461A4, 0x06033C02, 0xB4010A1C,
+0x00A01208, 0x0A100033, 0x00000400, 0x14000A20, 0x0A100005, 0x000F1401, 0x04030A10, 0x14280000,
+0x07192801, 0x0C012348, 0x1424070A, 0x000A1001, 0x98222348, 0x30050055, 0x00FF538E, 0x90CA3105,
+0x04050455, 0xE00104FC, 0x56932213, 0x98037004, 0x13D4086B, 0x0105000C, 0x981004F8, 0x6C06199C,
+0x04FC0036, 0x0C09D800, 0x00040004, 0x04F40105, 0x0318A408, 0x600018C8, 0x04F80021, 0x00000404,
+0x040004F0, 0x129C0000, 0x04099C00, 0xF4000004, 0x8CD41304, 0x04F40009, 0x00000404, 0x040004FC,
+0x047C0000, 0x0100040F, 0x0004E400, 0x40000004, 0x0448000D, 0x0006A000, 0x10000004, 0x03F80000,
+0xA01BD000, 0xFF69A1D0, 0xFF69A0D6, 0x1BE8A2D8, 0xACFF6520, 0xA5CF4001, 0x0004FF62, 0x2404BC02,
+0x0454FF65, 0x20A5D122, 0x04C00000, 0x0007A800, 0x600002AC, 0x10CF1000, 0x093C0021, 0x2869A825,
+0x03300005, 0x00021400, 0x9C000020, 0x00040017, 0x00022000, 0xA0000520, 0x12A00103, 0xD461A821,
+0x0DFC0003, 0x67A6D150, 0x5DB0CFFF, 0xFF68A662, 0xB469A7D0, 0x70A71003, 0x28661112, 0x03C4000D,
+0x61A8D280, 0x5EA7D0FF, 0x0005D4FF, 0x78000590, 0x00840002, 0x310AB400, 0x546AA8D7, 0xCE06F026,
+0xCAFF72A8, 0x81FF78AB, 0x25FF3764, 0xB9FF0008, 0xCBFF7198, 0xA1E10E34, 0xC5EEFF63, 0xA3CCFF87,
+0xA9D2FF65, 0x0000046B, 0x74000378, 0x02E80005, 0x00030800, 0x0C000004, 0x00580100, 0x01083403,
+0x8C0103EC, 0x04AC0208, 0x0F045401, 0x20180010, 0x03ECA9D5, 0x0B003C0F, 0x02055400, 0x2C000058,
+0x00040A00, 0x6AA9D531, 0x240004C8, 0xABD56001, 0xAAD4FF68, 0x06F20620, 0xA8D5FF66, 0xA1C8FF75,
+0x6F92FF85, 0x95B8FF55, 0xADD4FF69, 0xE10FC876, 0xD6FF64A2, 0xD6FF6AAA, 0xD0FF6BAC, 0x191C66A5,
+0x6CABD631, 0xD471000C, 0xD5FF6AA9, 0x0FF86CA9, 0x0004B800, 0xD9400F30, 0x3CFF6DAA, 0x00680001,
+0x0000AC00, 0xD4810004, 0xD5FF69AA, 0xD8FF67AA, 0x66A92509, 0x2400058C, 0xAAD6B100, 0xABDAFF6B,
+0xAEDDFF6D, 0x0014C070, 0xC9B10050, 0xBFFF6CA4, 0xFFFF77A5, 0x31DCD3F3, 0xB9D4E7B1, 0x759AB5FF,
+0x70A7D0FF, 0x4400005C, 0x003C0001, 0x00000404, 0x04040168, 0x00140F00, 0x001C0001, 0x00001804,
+0x10000008, 0x00040000, 0x04000C00, 0x10000004, 0x00040F00, 0x00300011, 0x0500280F, 0x00001C00,
+0x200F0004, 0x18040500, 0x02140000, 0x1100040F, 0x0402F000, 0x00000004, 0x00040405, 0x3102F400,
+0xFC63A6D3, 0x03600007, 0x0E084006, 0xF8000504, 0x00040404, 0x00050800, 0x04000004, 0x00040405,
+0x00050C04, 0x28080504, 0x35440035, 0x070F1805, 0xB0002340, 0x0EF8000E, 0x0409F400, 0x080504F4,
+0x04F00400, 0x5C589521, 0x04F80840, 0x0509F008, 0x98211DCC, 0x00319459, 0xF4000EEC, 0x00040404,
+0x0404F800, 0xD8000ECC, 0x00040409, 0x0409E000, 0xE4040004, 0x04EC0409, 0x00000804, 0x04002668,
+0x03C40000, 0x0004E800, 0xC80104DC, 0x2A640309, 0x00000C00, 0x040F04E4, 0xA0040100, 0x00080F04,
+0x0188000D, 0x00068800, 0x04000930, 0x050C0000, 0x0204D400, 0x66110504, 0xC4001228, 0x06B00016,
+0x3104E400, 0x3065A6D0, 0x00100003, 0x31000400, 0x5467A6CF, 0x04A40009, 0x0001E000, 0xCD40047C,
+0xDCFF62A1, 0x04440004, 0x6BA4D140, 0x000004FF, 0xCE310550, 0x04BC65A2, 0x00002C00, 0xB4000380,
+0x04FC001C, 0x01000401, 0xEC031740, 0x63A82112, 0x6C010DA4, 0x13A00008, 0x03D8A610, 0x11120C00,
+0x000D0C68, 0x180004F0, 0x80D51004, 0x08C40008, 0xFF67A8A1, 0xFF62AAD2, 0x1064A9D2, 0x00580004,
+0x6BA9D072, 0x67A7CDFF, 0x17F10414, 0xD7FF69A8, 0x8BFF81B1, 0xDFFF4C6F, 0xFFFFB6D0, 0x3DFFEAFF,
+0xCDFF052A, 0xCBFF82B1, 0xE8FF6EA6, 0xD1FF81BF, 0x055C6AA8, 0x0003B400, 0x440004F8, 0x00C00000,
+0x00088800, 0x0C0C0914, 0x03B80003, 0x04041C00, 0x08040308, 0x00280000, 0x2900040F, 0x1D00480F,
+0x0000A000, 0x68000034, 0x04C40209, 0xF104C800, 0xD2FF6E1A, 0xC0FF76AA, 0x83FF709A, 0xCBFF415F,
+0xD0FF84A6, 0xD6FF73A8, 0xD1FF6EAD, 0xC7FF6EAC, 0xD5FF67A1, 0xD4FF73A9, 0x0F006EA7, 0x69ACD980,
+0x6CABD7FF, 0x0104C0FF, 0xAA210E6C, 0x041DC86D, 0x5C000014, 0xAAD3B100, 0xA9D1FF6C, 0xA9D3FF6E,
+0x0005286E, 0x040013B0, 0xACD73100, 0x1006306D, 0x210F4CD4, 0x13B06DA7, 0xF1013C00, 0x6EAEDC00,
+0x6CA6CEFF, 0x7AA3BFFF, 0xCCEBFFFF, 0xEED031DC, 0xB6FFBFDC, 0xCFFF6E9C, 0xD2FF75AB, 0xA721007C,
+0x0013FC6D, 0x04040078, 0x013C0800, 0x0F001404, 0x04090008, 0x24080030, 0x00140400, 0x0D00080F,
+0x0F003400, 0x00050024, 0x0400001C, 0x00200F00, 0x00180405, 0x00017C00, 0x10000004, 0x00080000,
+0x0100040F, 0x00052008, 0x04080324, 0x07500000, 0x00050400, 0x88000800, 0x00040003, 0x00038400,
+0x9000088C, 0x0004000D, 0x0612A406, 0x2C013300, 0x3D5C0319, 0x00234008, 0x04002344, 0x4DA80000,
+0x39000409, 0x20FF5A9B, 0x0508030F, 0x0804FC08, 0xEC0113E4, 0x74FC010E, 0x5E4C5911, 0x00050004,
+0xE80404FC, 0x00080009, 0x0018DC0C, 0x040804F0, 0x04FC0000, 0x00000400, 0xF00404F8, 0x00080004,
+0x0404F400, 0xC4000004, 0x04E80013, 0x01000408, 0x900304F4, 0x000C0013, 0x0004FC00, 0xCC0804E8,
+0x05000009, 0x0012E408, 0x0404000C, 0x04F80C00, 0x0F04AC00, 0x00010004, 0x1800018C, 0x13200000,
+0x00050000, 0xE8080180, 0x00200004, 0x00019C00, 0xB8000008, 0x00040404, 0x0012A800, 0xD1310038,
+0x0D6066A7, 0x0001E400, 0x2C0004FC, 0x0CCC0000, 0x00082C00, 0xB400055C, 0xA5D23520, 0x0103186C,
+0xAA2103A4, 0x00087C6B, 0xFC010468, 0x13900004, 0x02050001, 0xD2260E28, 0x000008A8, 0x940004EC,
+0x17040003, 0x00007C00, 0xFC000088, 0x00040404, 0x00006C00, 0xD11009F4, 0x980117C0, 0xCC6A1108,
+0xA7CB4004, 0x0004FF6B, 0xAACE14F1, 0xA8CCFF6A, 0x85A4FF72, 0x0519FF64, 0x5559FF00, 0xC7C9FF50,
+0x96A5FFBC, 0xA5BFFF75, 0xBBE0FF76, 0x000A5C83, 0x5C0009F8, 0x0500000A, 0x20006C00, 0x0D9CAAD6,
+0x03A06B11, 0x00050004, 0x040402E4, 0x04FC0000, 0x1103200F, 0x0F002400, 0x041D0004, 0x380F0064,
+0x6D510F00, 0x6FAAD6FF, 0xC000132C, 0x04A80000, 0x6CACD831, 0xC8000994, 0xDA1CF100, 0x7CFF82B2,
+0xC1FF4157, 0xCBFF889F, 0xCEFF75A5, 0xCDFF6DA9, 0xF3FF6DA9, 0xD0FF97CD, 0xC7FF7EAC, 0xD4FF73A0,
+0xD9FF72A8, 0x0E6870AD, 0x00003400, 0xD82004D0, 0x111444AD, 0x0006AC6C, 0xFC000054, 0xAAD2B104,
+0xAAD2FF6F, 0xA9D4FF70, 0x40007470, 0xFF6FA9D7, 0xD0B10004, 0xCFFF6DA8, 0xD8FF6CA7, 0x000472AB,
+0xA9D514F1, 0xABD4FF6E, 0xA6CEFF6D, 0xA6C6FF6B, 0xE4F9FF75, 0xFBFFFFC8, 0xE6F8FFE5, 0xA4BDFFC9,
+0xAACDFF7C, 0x31053072, 0x3071AAD7, 0xA9D63100, 0x00057C6C, 0x0400056C, 0x00F40800, 0x00001004,
+0x040F0008, 0x30080500, 0x000C0F00, 0x01A40459, 0x0500080F, 0x0D05080F, 0x00033000, 0x48000004,
+0x05040007, 0x00000400, 0x0400033C, 0x03840000, 0x00038C00, 0x08000004, 0x00040005, 0x00050800,
+0xF8000004, 0x1E480120, 0x3D1CA012, 0x00050800, 0x04003284, 0x00040805, 0x04050400, 0x08010004,
+0x19300705, 0x01050808, 0x74038488, 0x04F4007F, 0x00000404, 0xF4000EDC, 0x04F00004, 0x08000400,
+0xF40009E8, 0x09E80404, 0x00000800, 0xF0000004, 0x04F80009, 0x0004EC00, 0xF0000004, 0x00040004,
+0x0804EC00, 0xF4040004, 0x09E40004, 0x0704F001, 0xE40013CC, 0x00040009, 0x0004EC00, 0xF0000004,
+0x04E40004, 0x00000400, 0xD40804F8, 0x00100004, 0x00000400, 0x040C0484, 0x00280400, 0x0800180C,
+0x68000010, 0x00040001, 0x00134000, 0xC8000018, 0x13300025, 0x0017D800, 0x50000D50, 0xA8CF4004,
+0x04E0FF64, 0x01047800, 0xA5130004, 0xA5210984, 0x0020F468, 0xAC001800, 0x01B00006, 0x90000C00,
+0xFF69A7D8, 0xFF65A7D7, 0x802160D6, 0xD7FF61A8, 0xDAFF62A9, 0xA5130D70, 0xAB6120D0, 0xA3CEFF6B,
+0x001C1060, 0xD34404F8, 0xC0FF6BA5, 0x12800008, 0x10000404, 0x031290D1, 0x840011FC, 0x00040009,
+0x00002804, 0x10020230, 0xFF68200E, 0xA8020564, 0x4C681112, 0x0018000D, 0x0004BC00, 0x1CF12664,
+0xFF6CA8CC, 0xFF74ACCF, 0xFF7AAAD0, 0xFF8AADCD, 0xFF111D33, 0xFF7D7B86, 0xFF1A1511, 0xFF4F5352,
+0xFF839DAC, 0xFF94C0DD, 0xD075ACD3, 0x03FC0008, 0x00000404, 0x740004FC, 0x00080005, 0x05001404,
+0xA8120008, 0xB8000514, 0x00040403, 0x2D001C05, 0x004C6CA9, 0x0D001C0F, 0x040E8000, 0x6C000004,
+0x00040504, 0x00004C03, 0x040F0084, 0x68000500, 0xABD33104, 0x60048071, 0xFF6CADD5, 0x09FCADD7,
+0xFF690AF1, 0xFF6FACD9, 0xFF70AAD8, 0xFF78A3CE, 0xFF899CC4, 0xFF415377, 0x0489B0D9, 0xD108F20A,
+0xFFFF6CAA, 0xFFFFC1F7, 0xDCFFD7FB, 0xC2FFA3C3, 0xC9FF79A2, 0x010872A4, 0x04F8AC10, 0xD7FF6B91,
+0xD8FF69AC, 0x0A306DAE, 0x6CACD271, 0x6DABD2FF, 0xD43104D4, 0x04FC6FAA, 0xBCA9D620, 0xFF74D10E,
+0xFF74A9D5, 0xFF74AED4, 0x1872ACD2, 0x1A500005, 0xF00A1400, 0x71AAD51F, 0x74A1BEFF, 0xB5D4E8FF,
+0xECFCFFFF, 0xE6F9FFFF, 0x7CA5C3FF, 0x70A8CDFF, 0x6FADD4FF, 0x6DACD5FF, 0x73AEDAFF, 0x6BA6D2FF,
+0x74ABD7FF, 0x00040A00, 0x0400F000, 0x0C000018, 0x00040000, 0x00001004, 0x10000008, 0x00040F00,
+0x01C00855, 0x08007400, 0x0C000010, 0x02040400, 0x01000808, 0x28030730, 0x05200802, 0x0205140F,
+0x011A2803, 0xA6211668, 0x001B6469, 0x04040398, 0x039C0000, 0x04000400, 0x080008D8, 0x05080000,
+0x00042000, 0x04000918, 0x09400000, 0x04050800, 0xDC040004, 0x28600126, 0x21270000, 0x387C5B9D,
+0x0835EC00, 0x0C000F18, 0x18DC0800, 0x0004FC00, 0x04005950, 0x04FC0000, 0x00000400, 0x040104FC,
+0x66E80000, 0x000EE403, 0x040004EC, 0x04F00000, 0x00000404, 0x040004F4, 0x1DA80000, 0x08000400,
+0x0C0004F4, 0x04F80400, 0x1000AC01, 0x00431C9F, 0x61122BBC, 0xA02F1D58, 0x02346862, 0x0000EC00,
+0xD00404E4, 0x00080004, 0x04010C00, 0x10040004, 0x012C0400, 0x04000804, 0x08000020, 0x00140400,
+0x0100080F, 0x00094C00, 0xCC000488, 0xA5D84009, 0x0004FF67, 0x00050000, 0x4C000E78, 0xA9D0B10E,
+0xA7CFFF64, 0xA8D0FF66, 0x000E1C67, 0x04000414, 0x06B80000, 0x0004F000, 0xEC0020AC, 0x00080013,
+0x00176000, 0xC8000004, 0x09B40106, 0xA1134800, 0xD1FF6FAA, 0xD2FF72A7, 0x1D6C71A6, 0x32022400,
+0x8463A6D1, 0x6EA83012, 0x040D34FF, 0x1C0004D8, 0x05000102, 0x09C0A712, 0x00171C00, 0x14000004,
+0x0250002B, 0x00097000, 0x3C000004, 0x04F80014, 0x00128800, 0x68000A4C, 0xA9DB7117, 0xABDCFF6D,
+0x000DCC6D, 0x20F10D7C, 0xFF71ACD4, 0xFF6FA7CA, 0xFF74A7C6, 0xFF6F93B3, 0xFF31455D, 0xFF211B27,
+0xFFCABABB, 0xFF402F28, 0xFF4E4D4B, 0xFF173142, 0xFF78A3C3, 0x3C71A8CF, 0xACD8312C, 0x0004BC6F,
+0xD800056C, 0x09140002, 0x00004C00, 0xF800000C, 0x00040502, 0x00132400, 0xAA1008B4, 0x040F097C,
+0x78003000, 0x00040F0E, 0x00600301, 0x0003F000, 0x80040004, 0x000C0000, 0x00000400, 0x90000010,
+0xA9D17104, 0xADD5FF6F, 0x0104B072, 0x13F11404, 0xD9FF6AA9, 0xD7FF72AD, 0xD0FF70A8, 0xD2FF77A3,
+0x8DFF93AD, 0xB2FF596C, 0xD1FF768E, 0xD0FF86AC, 0x04886EA8, 0xE4FD08F1, 0xFFFFFFC2, 0xE9FFFFE8,
+0xABC6FFCB, 0xA5C7FF86, 0xA9CEFF77, 0x8001E871, 0xFF6CADD7, 0xFF6FB0D8, 0xD34004FC, 0x04FF6EAC,
+0x00740000, 0x00000400, 0xBC000558, 0xD703F009, 0xD3FF74A8, 0xCFFF74A9, 0xD0FF72AA, 0xD4FF71AB,
+0xF00A48AC, 0xDCFF7213, 0xC6FF75B0, 0xDDFF6FA1, 0xFFFFA9C8, 0xFFFFEBFE, 0xC3FFE5F7, 0xCDFF92AE,
+0xDAFF78AA, 0x5CFF70AF, 0x01B80000, 0x73B1DA31, 0xD8401900, 0x7CFF71AC, 0x00040F01, 0x00740005,
+0x08000400, 0x10000020, 0x00040F00, 0x0160004D, 0x1100040F, 0x08152C00, 0xE4000004, 0x00040402,
+0x0802B800, 0x0C080A94, 0x000C0405, 0x00030001, 0xF0001720, 0x29000007, 0x02000405, 0xC4042028,
+0x1E500003, 0x120DA401, 0x002128A4, 0x0400091C, 0x0F1C0800, 0x04050000, 0x04002850, 0x05000405,
+0x010A0800, 0x9D210A04, 0x00936C5B, 0x04049370, 0x27C00000, 0x00000400, 0x040109F0, 0x57962100,
+0xF0086BBC, 0x09E00409, 0x0004F400, 0x04004034, 0x18C00000, 0x0009E000, 0x04005C58, 0x4D680100,
+0x034D6C00, 0xD1400004, 0x04FF609E, 0x1DB40F00, 0x09E40801, 0x0C09DC04, 0xDC0404E8, 0x01000004,
+0x0800040C, 0xC40104CC, 0x1D100004, 0x101BC800, 0x001320A7, 0x04061818, 0x04AC0000, 0x0A00040F,
+0x00068003, 0xD93204BC, 0x20C468A6, 0x40216C00, 0xD1FF65AA, 0xA9400004, 0x04D1FF68, 0x8CA81600,
+0x0984001B, 0x0004F800, 0xA4000004, 0xD918F11D, 0xD9FF6BAB, 0xD3FF6FA9, 0xD2FF6FA5, 0xD4FF78A9,
+0xC4FF85B1, 0xB1FF84A9, 0xA1FF7898, 0xBBFF6C86, 0xD3FF809D, 0x129487AF, 0x6FADD640, 0x000EE0FF,
+0xDC0007FC, 0x04F80004, 0x0004D400, 0x14000004, 0x04740002, 0x000DCC00, 0x240004FC, 0x00240012,
+0x00024800, 0x4C000858, 0x0EF0000A, 0x72050000, 0xFF6AA9D2, 0x046BAAD3, 0x69A9300A, 0x000084FF,
+0x21F000E8, 0xFF70ABD7, 0xFF73AAD1, 0xFF6EA3C3, 0xFF80ACC5, 0xFF5A7789, 0xFF00010C, 0xFF412F2F,
+0xFF967973, 0xFF311811, 0xFF484244, 0xFF031F34, 0xFF7AABCB, 0xDC310440, 0x0F9073B0, 0x0004FC00,
+0x5C000368, 0x04F80003, 0x00000C00, 0x10000304, 0x00040400, 0x00001000, 0x10040004, 0x00080000,
+0x6EACD54F, 0x050004FF, 0x0F09A400, 0x0F05001C, 0x00090018, 0x04010128, 0x71ACA100, 0x71ACD6FF,
+0x70ABD5FF, 0x0C000004, 0x00040000, 0x00001000, 0xA80000EC, 0xB0DD7128, 0xABD7FF73, 0x00045C6B,
+0x80000034, 0xD40DF009, 0xD8FF70A6, 0xCAFF7EAF, 0xA9FF81AA, 0x6BFF748E, 0xC9FF4C50, 0xD0FFA0AB,
+0x34FF78A8, 0xC411F00A, 0xF1FF79A1, 0xFFFFB9D7, 0xFFFFE4F9, 0xEDFFE4FB, 0xC7FFB2D4, 0xCEFF7DAA,
+0xD4FF74AA, 0x28FF73AF, 0xB0D7C00A, 0xAED5FF72, 0xAED7FF70, 0x0F14FF70, 0x6EADD932, 0xB4000A5C,
+0x00280004, 0xFF74ABA1, 0xFF73ADD3, 0x2C72AED3, 0x7CD3110A, 0x7605F001, 0x91B6D3FF, 0xE8F8FFFF,
+0xECFAFFFF, 0xA6C6DDFF, 0x24A2C0FF, 0xE8761100, 0x01A80004, 0x72B2DE31, 0xD850144C, 0xD7FF75B0,
+0x040B05AC, 0x00E00000, 0x00001804, 0x0400000C, 0x00100400, 0x00000804, 0x040F0014, 0x280F0900,
+0x80021500, 0x05840005, 0x0000040A, 0x040F015C, 0x90002100, 0x00040010, 0x00051400, 0x08000508,
+0x00040000, 0x08050808, 0xF000000C, 0x00040002, 0x0002E400, 0x0804050C, 0x02CC000A, 0x04031C00,
+0x580003EC, 0x00040008, 0x00001004, 0x24000414, 0x0D800004, 0x0021B400, 0x0C062160, 0xA4611105,
+0x0E64003E, 0x00051400, 0x1C00050C, 0x0508000F, 0x00000406, 0x5A210A14, 0x0104F4FF, 0xC8006820,
+0x7FA00027, 0xFCFF5820, 0x0EE40004, 0x04000400, 0xE80404FC, 0x04F80009, 0x00000404, 0xF80C0500,
+0x00100004, 0x0004F800, 0xFC000004, 0x1DB40004, 0x00000400, 0x040004F4, 0x0AB80000, 0x08000404,
+0xD00004F4, 0x00040000, 0x0300D401, 0x10003008, 0x00F00400, 0x0000080C, 0x2400010C, 0x05000001,
+0x0F000800, 0x010D0004, 0xA81A014C, 0x14001C40, 0x03F40000, 0x40017800, 0xFF6AA6D8, 0x04000EC0,
+0x048C0000, 0x66A9D3C0, 0x66AAD1FF, 0x69AAD0FF, 0x00046CFF, 0xA40007B4, 0x04FC0001, 0x00002000,
+0x0401210C, 0xAA30F000, 0xA6D1FF6A, 0xA7CEFF6D, 0xA1C1FF7B, 0x8299FF7E, 0x5464FF68, 0x3942FF43,
+0x363CFF2F, 0x414BFF31, 0x232FFF41, 0x2538FF1F, 0x5A72FF16, 0xAECBFF3E, 0xB1D3FF82, 0xA6CEFF7C,
+0xA7D3FF72, 0x0224FF71, 0x00021000, 0x04002140, 0x000C0000, 0x00047C00, 0xD3201768, 0x200994A8,
+0x0240FF6E, 0x311C5800, 0xE86CACDC, 0x120C0004, 0x000D9400, 0xCC000004, 0x03FC001C, 0x70AFDB51,
+0x0D4CD8FF, 0xFF701EF1, 0xFF6FA5CB, 0xFF7CA8C3, 0xFFA7C6D8, 0xFFBDCCD1, 0xFFEAE5E1, 0xFFFFE5DA,
+0xFFDAB4A7, 0xFF715047, 0xFF362B2F, 0xFF5D788D, 0xB87EB0D1, 0x00700008, 0x3109F000, 0x0471AEDA,
+0x04F8040A, 0x0004E808, 0xEC000014, 0x00040404, 0x00001000, 0x70000004, 0x00040F04, 0x04E40409,
+0x0100240F, 0x00001C00, 0x040F045C, 0xD8350500, 0x042071AF, 0x0403EC00, 0x080403D4, 0x03BC0000,
+0x72ACDC60, 0x98ACDBFF, 0xFF6B600E, 0xFF72B1DA, 0x11F00484, 0xFF75ACD5, 0xFF76ACD8, 0xFF74A9D1,
+0xFF78AACB, 0xFF91B1CA, 0xFF3B364D, 0xFF504D68, 0xFF8AB0D5, 0xD4B10020, 0xBEFF80AD, 0xE4FF7A9E,
+0x0500B4CF, 0xE2FDFFB1, 0xD0F1FFFF, 0x9AC2DBFF, 0xCEC00EBC, 0xD0FF79AE, 0xD8FF73AB, 0x18FF73AE,
+0x00040401, 0x070A5C01, 0x6C0004B0, 0x0528000B, 0x71B0D931, 0x08F11070, 0xFF82A9C6, 0xFFD6F1FF,
+0xFFEEFEFF, 0xFFB9D0E2, 0xFF77A2C2, 0x2877AFD4, 0x00E80005, 0x401E1C00, 0xFF73B2DE, 0xD5330038,
+0x0ABC75AF, 0x00006802, 0xDC04006C, 0x00080C00, 0x04001C00, 0x1C040004, 0x01140C00, 0x0000100C,
+0x2C040030, 0x00080000, 0x0C002000, 0xD0000004, 0x00040800, 0x0F015400, 0x0D210004, 0x3C00052C,
+0x0004081F, 0x210BE400, 0x1A646BAA, 0x0402E400, 0x7C000004, 0x00040002, 0x00030800, 0x8C000360,
+0x05040103, 0x2018A710, 0x003D0C02, 0x780103EC, 0x25CC0003, 0x03348000, 0x20002EFC, 0x127C0004,
+0x0505040F, 0x04050000, 0x240C0A10, 0x1E340414, 0x007F0000, 0xF4000004, 0x00040404, 0x0004F808,
+0x040009EC, 0x04F40000, 0x0C04F000, 0xCE350004, 0x27985F9D, 0x0004F000, 0xF0040004, 0x04E80404,
+0x0009E400, 0xF0000004, 0x00040C04, 0x00206800, 0x040C1384, 0x0E980000, 0x03000401, 0xE8001818,
+0x00040004, 0x0104E80F, 0x000E7001, 0x040309FC, 0x0E480100, 0x03134400, 0x20000004, 0x00380000,
+0x0004F000, 0x0C000004, 0x00040000, 0x00000C00, 0x040004D8, 0x0E5C0000, 0x6AA8D940, 0x000004FF,
+0x1400000C, 0x04F80000, 0x69A9CF31, 0xB0000968, 0x01880001, 0x00048800, 0x54003498, 0x09A80026,
+0xF1174000, 0x87B2D52C, 0x7D8FA7FF, 0x5B5B63FF, 0x6F6460FF, 0x524233FF, 0x907F6FFF, 0xBEAB9CFF,
+0xE1CBBEFF, 0xB6A095FF, 0x6A5951FF, 0x484340FF, 0x09131CFF, 0x4B647AFF, 0x8DB3D8FF, 0x7AA9D5FF,
+0x54000504, 0x085C0004, 0x002B0000, 0xE00009E0, 0x08E00004, 0x01176C00, 0xAA211758, 0x22215870,
+0x2160ABDB, 0x40003000, 0xFF71ADD2, 0xD5310004, 0x2B606FAF, 0x00035C00, 0x9C0002DC, 0xCB21F80D,
+0xC8FF77A7, 0xFBFF95B4, 0xE9FFE8F5, 0xCBFFF8F1, 0x9FFFF1DC, 0x90FFD7B2, 0x62FFCBA2, 0x21FF956F,
+0xA9FF3020, 0xD0FF7D91, 0xD4FF7FAB, 0xF0FF74AB, 0x00440002, 0x1100040F, 0x00035000, 0x2C0F0004,
+0x24000D00, 0x00040F00, 0x0EBC0009, 0x4F00040C, 0xFF73AED6, 0x000D0004, 0x58000034, 0xAEDB4000,
+0x0004FF71, 0x71135000, 0xFF74AFD7, 0x0477AED5, 0x03FC0000, 0xF1004400, 0x76AED338, 0x88ACCCFF,
+0x9393ADFF, 0x54516CFF, 0x7E9CBEFF, 0x7CACD2FF, 0x7AABD4FF, 0x7DADD5FF, 0x77A2C4FF, 0xA3C5DEFF,
+0xDFF6FFFF, 0xE2F5FCFF, 0xEAFBFFFF, 0xCCE2EFFF, 0x86AAC2FF, 0x7AA8CAFF, 0x77ADD9FF, 0x72AFDCFF,
+0xDD3113B0, 0x13F078B3, 0xF4B0D520, 0xFF6C6013, 0xFF74B3DC, 0x08F104F8, 0xFF6DADD3, 0xFF73B1D6,
+0xFF7AABC9, 0xFFC7E1F2, 0xFFEAFDFF, 0x5CBFDEFA, 0xADD24000, 0x04E8FF79, 0x80009C00, 0xFF74AFD9,
+0xFF74AFDB, 0x10000008, 0x00480000, 0x74AED67F, 0x75AFD7FF, 0x00120004, 0x040C002C, 0x00480000,
+0x0500040F, 0x0F010000, 0x000D0004, 0x04080128, 0x01540000, 0x1900040F, 0x73ACD931, 0x440819C8,
+0x000C0802, 0x0802AC00, 0x54000004, 0x00040107, 0x21051000, 0x29206CAB, 0x0015F400, 0x040F0370,
+0xA8000100, 0x00040203, 0x20DC6711, 0x001BF804, 0x040025DC, 0x04140000, 0x02000400, 0x65201C6C,
+0x010940FF, 0xA3210464, 0x0030E063, 0x04001420, 0x05080400, 0x000A1004, 0x04000F1C, 0x04FC0400,
+0x0404F400, 0xF4040004, 0x0EF00009, 0x0004F800, 0xF8080004, 0x13D00004, 0x0F000404, 0x010D0500,
+0x6C03008C, 0x009C0048, 0x01000400, 0x480305B8, 0x04F80433, 0x0004EC01, 0x04071D08, 0x06080400,
+0x00010002, 0x04062B0C, 0x04BC0100, 0x0C04E003, 0x100404F0, 0x01500400, 0x00001000, 0x60000030,
+0x0004000E, 0x01000C00, 0x3C000004, 0x00040322, 0x00001800, 0x500004F8, 0x00040018, 0x001BC800,
+0x58000984, 0x1C000004, 0x6DACD831, 0x080034A4, 0xA7D3713B, 0xA9CEFF6C, 0xF1085C6F, 0x83A7C734,
+0x4B6075FF, 0x58555CFF, 0x9A8780FF, 0x93745FFF, 0x4E2A10FF, 0x6B4930FF, 0x785841FF, 0x6F4F3AFF,
+0x876653FF, 0x997865FF, 0x624B3DFF, 0x615853FF, 0x171B24FF, 0x1A2C44FF, 0x87A8C9FF, 0x81AED5FF,
+0x70001424, 0x05040000, 0x1CADDB20, 0x706F1117, 0x05000503, 0x0071AC21, 0x05200005, 0x00002400,
+0x7400094C, 0xACD17217, 0xADD2FF72, 0x3012A06F, 0x8CFF72AD, 0x05900002, 0xA8CA20F1, 0xC1D0FF7D,
+0xEFEDFFAE, 0xE3D5FFF0, 0xBFA8FFF9, 0x957BFFDF, 0x442FFFBA, 0x2418FF6A, 0x2629FF46, 0x4761FF35,
+0xAED5FF37, 0xABD5FF87, 0x00133076, 0xF80F0804, 0x34081902, 0x000C0F03, 0x039C0F25, 0x03D40409,
+0x0C002404, 0x18040010, 0x04F80000, 0x11045002, 0x00046875, 0x0400046C, 0x00140000, 0x00046C00,
+0x14F11398, 0xFF83ADD3, 0xFF9AA9CA, 0xFF4E5977, 0xFF506B89, 0xFF8CB3D4, 0xFF79A9D1, 0xFF77AAD5,
+0xFF77ABD3, 0x3079A6C7, 0xF6FFB106, 0xF5F8FFE2, 0xFAFFFFE7, 0x711DB4ED, 0xFFAACAE1, 0x347AA5C7,
+0xB0D8310F, 0xF128487C, 0x75AFD40C, 0x76B2D6FF, 0x74B4D8FF, 0x6FAFD3FF, 0x73B3D9FF, 0x75B1D6FF,
+0x77ACCCFF, 0x54000A3C, 0xECFD6014, 0x9FC1FFD2, 0x7AA004D8, 0x78AFD6FF, 0x76B0D6FF, 0x020EECFF,
+0x0C000004, 0x14761100, 0x00A80000, 0x1104FC04, 0x020024D8, 0x0C08001C, 0x00200400, 0x0700080F,
+0x0F006800, 0x02070004, 0x75150074, 0x48040080, 0x00080401, 0x75B0DA48, 0x000004FF, 0x040F0138,
+0xE80F0500, 0x74000101, 0x00040102, 0x0F028000, 0x00000004, 0x040C0C24, 0x05100500, 0xFF6DAC34,
+0x08001AFC, 0x05080000, 0x04000400, 0x080103B8, 0x0DB40500, 0x020A1000, 0x04000004, 0x04FC0005,
+0x04000400, 0x0404041C, 0x045C0005, 0x00046400, 0x04010A14, 0x4BD00300, 0x031E3401, 0x04045128,
+0x0F180005, 0x007AC400, 0xA8007948, 0x000400A2, 0x0009EC00, 0xF4000004, 0x00040004, 0x0004E808,
+0x040404EC, 0x09E80000, 0x00000400, 0x040009EC, 0x2C980C00, 0x0009F008, 0x1C000090, 0x05A40022,
+0x0900A800, 0xF00B0004, 0x05080404, 0x0304FC01, 0x0C01139C, 0x15200000, 0x0000040F, 0x0F103C00,
+0x00090004, 0x04040B5C, 0x06780100, 0x072F9400, 0xA0001C5C, 0x04E00012, 0x00017800, 0x880009E4,
+0x20D8000B, 0x001BE400, 0x88000480, 0x01B00013, 0x6EACDB60, 0x00ABDAFF, 0x7346F112, 0x74AAD0FF,
+0x7AA9C5FF, 0x86A7BAFF, 0x646F75FF, 0x443F3CFF, 0x9D8B7FFF, 0xCFB4A1FF, 0xC9A690FF, 0x552F18FF,
+0x7C5842FF, 0x54311EFF, 0x583728FF, 0x4F2F22FF, 0x573A2CFF, 0x705649FF, 0x635147FF, 0x554A46FF,
+0x1A1519FF, 0x28323EFF, 0x8BA9C5FF, 0x83AFD4FF, 0xCC01141C, 0x6EAD3103, 0x22056CFF, 0x0DFC6FAC,
+0xA073AC21, 0x0DE40004, 0x18ADDC20, 0x906F1105, 0x1DB80012, 0x75ADD071, 0x74AED3FF, 0x2CF10DF4,
+0xFF75B2E1, 0xFF70AADA, 0xFF7AAED6, 0xFF7EA1BD, 0xFFC0CAD4, 0xFFF8EDEB, 0xFFF5D8CA, 0xFFBA947F,
+0xFF916D55, 0xFF452612, 0xFF3C251F, 0xFF342D35, 0xFF000120, 0xFF7293BC, 0xE478ABD6, 0x02DC080D,
+0x0F045C04, 0x04090008, 0x08080340, 0x036C0C00, 0x1100100F, 0x00004000, 0x040F0908, 0x60000900,
+0x00040504, 0xE876B029, 0x04600004, 0x78B0D542, 0x110004FF, 0xB1098876, 0xFF73B1D8, 0xFF76AFDC,
+0x0478AEDD, 0xDF3CF100, 0xD6FF7FB2, 0xC7FF81AC, 0x78FF80A2, 0xCBFF4259, 0xCFFF95B0, 0xD6FF82AD,
+0xD7FF7BAF, 0xD7FF79B0, 0xCBFF7BB1, 0xC3FF7CAA, 0xF7FF86AC, 0xFAFFCDE9, 0xF8FFE0F3, 0xFFFFE7F2,
+0xFFFFEDF7, 0xCDFFE1F3, 0xC3FF9CB6, 0xD5FF7AA3, 0x04B87CB0, 0xF109EC00, 0x77B4D314, 0x75B0D0FF,
+0x74AFD1FF, 0x7EB1D0FF, 0x90B4CCFF, 0xD9F9FFFF, 0xD3F7FFFF, 0x7AA6C3FF, 0x80B2D5FF, 0x60000EF8,
+0xD904F100, 0xD9FF77B1, 0xD7FF76B1, 0xD7FF76B2, 0xD6FF77B1, 0x000877B1, 0x0F000C00, 0x000D0004,
+0x040F053C, 0xB1210A00, 0x05058075, 0x100F0120, 0xA40F1C00, 0x240C1101, 0x01B40000, 0x76000404,
+0xFF75AED9, 0x0474ADD8, 0xCCAE1600, 0x0254000F, 0x0107540F, 0x0607C000, 0x6E110004, 0x9C00153C,
+0x1F180029, 0x00382C00, 0x90000004, 0x00040803, 0x101BF001, 0x0212C0AA, 0xEC000504, 0x00040220,
+0x00341002, 0x58080508, 0x05080004, 0x01000400, 0x940B0504, 0x14280041, 0x000A1400, 0xFC040004,
+0x04F40804, 0x0404F800, 0xB8040004, 0x04F80F1D, 0x13D40005, 0x00000400, 0x040004F0, 0x09F00400,
+0x0804F400, 0xFC000004, 0x00040004, 0x0000A409, 0x00030EB0, 0x04E40105, 0x0004F008, 0x18031F0C,
+0x1014011A, 0x0C04FC03, 0xDC0404EC, 0x00080F04, 0x04F40405, 0x00000800, 0x040004C8, 0x000C0000,
+0x00000400, 0x68001280, 0x0008010E, 0xFF6DAC31, 0x440325FC, 0x0E480013, 0x73A9D740, 0x001384FF,
+0xDD31002C, 0x301C71AE, 0xA7D248F1, 0xACCDFF74, 0xA7BCFF7F, 0x6F76FF87, 0x423BFF5E, 0x5C4BFF4B,
+0xD1BDFF71, 0xE7D1FFEA, 0x8C76FFFF, 0x5D47FFAF, 0x8673FF81, 0x7464FFAB, 0x4234FF98, 0x2015FF5F,
+0x2218FF3B, 0x1C11FF3A, 0x4B43FF32, 0x534CFF62, 0x2C24FF67, 0x1A1BFF3D, 0x5769FF1E, 0xA8C7FF46,
+0x000E8C87, 0x4800098C, 0xB0DC2311, 0x04F112F8, 0xD5FF73AC, 0xD7FF73AD, 0xDAFF73AC, 0xDAFF70AD,
+0xE8FF6FAE, 0x71AF2113, 0xD171088C, 0xD2FF76AE, 0x124C75B0, 0x000AB400, 0x25F0B360, 0xFF7AA6C9,
+0xFF91ADC3, 0xFFE7F0F7, 0xFFF4EBE6, 0xFFDFC9BC, 0xFFA28573, 0xFF4E3320, 0xFF342113, 0xFF2A2124,
+0xFF3E4557, 0xFF587190, 0xFF8AB1DA, 0xFF78ADD5, 0xF40002CC, 0x00080007, 0x1500040F, 0x0F03140C,
+0x0F250010, 0x010D03B8, 0x38000434, 0x00040404, 0x50043C0B, 0xFF7AB0D6, 0x220004D4, 0x045879B1,
+0x9473B321, 0xB0DDB109, 0xAFDDFF77, 0xB0DFFF79, 0xF00DA07A, 0x79B4E005, 0x89B6DDFF, 0x516580FF,
+0x8495AFFF, 0x84ADCDFF, 0x00003CFF, 0x540004A0, 0xD81AF00E, 0xD0FF78B2, 0xC1FF79AE, 0xF0FF7EA8,
+0xFCFFC1E1, 0xF4FFE6F5, 0xF7FFE9F1, 0xFFFFEAF1, 0xF7FFEBF7, 0xCAFFC8E1, 0xCCFF8AAF, 0x1EF01A34,
+0xD1FF79AF, 0xD0FF7AB3, 0xCEFF7BB2, 0xC5FF7FB0, 0xFFFF83AB, 0xFFFFD2EE, 0xC4FFE0FC, 0xD0FF78A5,
+0xD3FF77AB, 0xD5FF7BB1, 0xD6FF7BB1, 0xF00560B1, 0xD9FF770B, 0xD8FF74B2, 0xD7FF75B3, 0xD7FF77B3,
+0xD7FF78B2, 0xD8FF7AB2, 0x78FF7AB1, 0x00040F00, 0x05200F09, 0x01200D0D, 0x0F012804, 0x0F000008,
+0x0F01016C, 0x042501B8, 0xDA400038, 0x04FF76AF, 0x00040505, 0x000FE003, 0x04000250, 0x05040000,
+0x05000408, 0xAE300510, 0x0504FF70, 0x220D6000, 0x07D4AED7, 0x00050400, 0x08000004, 0x0A100005,
+0x00000400, 0x08000394, 0x050C0000, 0x00050400, 0xF8021BFC, 0x26000204, 0x030DC801, 0x04000A24,
+0x00040405, 0x0012AC00, 0x20000004, 0x00040014, 0x01284C0F, 0x04050800, 0xF0040500, 0x0EE80404,
+0x5E9CCD40, 0x000004FF, 0x040C09E4, 0x09F00000, 0x02000400, 0x641304F8, 0x65204E20, 0x024424FF,
+0x66113ACC, 0xDC0F2F40, 0xE804090E, 0x00080009, 0x0004FC08, 0x04002260, 0x18980000, 0x0C000400,
+0x100104F0, 0x2F88031D, 0x000EA000, 0x040F1A6C, 0x1C000100, 0x04DC0121, 0x001C3803, 0xAC04000C,
+0x000C0012, 0x01000400, 0xAB210010, 0x001C6072, 0x04000178, 0x0BAC0200, 0xD8FF7182, 0xD6FF74AA,
+0x0006D8AA, 0x540016FC, 0x1C580126, 0x82B047F1, 0x7B9AB6FF, 0x97A8B2FF, 0x908F8DFF, 0x6F5B50FF,
+0xA88D7CFF, 0xFAE4CFFF, 0xEFD6C0FF, 0xB1957FFF, 0xF3D3BEFF, 0xD6B5A2FF, 0xAE9181FF, 0x654F41FF,
+0x3E2D23FF, 0x291C14FF, 0x33241FFF, 0x271410FF, 0x4A3733FF, 0x45322CFF, 0x2A201FFF, 0x0F1521FF,
+0x768AA2FF, 0xD3310504, 0x00747FAC, 0x77B2DE32, 0xAF2309FC, 0x11269875, 0x000F1075, 0xDB510088,
+0xD9FF71B0, 0x77E01C98, 0x77AFD2FF, 0x70ABCBFF, 0x7BB7DBFF, 0xF00034FF, 0x78ACD421, 0x85A7C2FF,
+0xC0D6E4FF, 0xE1EFF2FF, 0xDFE5E1FF, 0xD8DACFFF, 0x6F6C5DFF, 0x1E1408FF, 0x2D2825FF, 0x242D3EFF,
+0x91ACC9FF, 0x8EBDDBFF, 0x010540FF, 0xB112085C, 0x200F0D20, 0x20010103, 0xB0B01200, 0x000C080D,
+0x08039804, 0x8C0F0034, 0x2C0F1903, 0xD8491500, 0x04FF77B3, 0x78B22A00, 0xB0210434, 0x0009C07B,
+0x580009C4, 0x0E980004, 0x73B4DAA2, 0x75B3DAFF, 0x78B2DCFF, 0xB5DD2009, 0x0AF10990, 0xB0D0FF73,
+0x89A4FF7F, 0x6B88FF7B, 0xB5DBFF5D, 0xB0D9FF8B, 0xB1D9FF79, 0x4004887C, 0xFF78B6DF, 0x28F10A38,
+0xFF73ADD2, 0xFF78ABC8, 0xFFA9CCE0, 0xFFE1F7FF, 0xFFE5EEF5, 0xFFEAEFF3, 0xFFF3FAFF, 0xFFE4F5FF,
+0xFFA8C4D9, 0xFF86B0C9, 0xFF77ACCB, 0xFF80B3D2, 0xFF81A7BC, 0x54C9E8FA, 0x97B22033, 0x81D10A10,
+0x7EB4D8FF, 0x7AAFCFFF, 0x84B9D9FF, 0x98000504, 0x00900000, 0x74B4DA60, 0x3CB4D9FF, 0x00C4000F,
+0xD8FF7CDF, 0xD8FF7CB2, 0xD8FF7BB3, 0x000479B3, 0x00380002, 0x00001C04, 0x040F000C, 0x1C090100,
+0x012C0C01, 0x2000100F, 0x1501980F, 0x04002804, 0x080F0508, 0x500C0500, 0x0C540407, 0x0515C000,
+0xAE210004, 0x041A0870, 0x18001F6C, 0x00040005, 0x05089800, 0xB8000008, 0x6BAA310D, 0x000F14FF,
+0x040C38F8, 0x05040300, 0x04051000, 0x08000504, 0x09700400, 0x001D4000, 0x04000A10, 0x09980400,
+0x0009AC00, 0x040009F8, 0x05000000, 0x0004FC04, 0xF00F0008, 0xF8040509, 0x18DC0604, 0x005C4800,
+0x66111478, 0x00005768, 0x18D40805, 0x0F04DC08, 0x0005000C, 0x040409E0, 0x04F40000, 0x08000400,
+0xDC0A04F8, 0x846E1109, 0x04E0002A, 0x00000400, 0x040F0930, 0xDC010100, 0x213C0304, 0x04000C04,
+0x1005067C, 0x15BC0000, 0x0004E400, 0xAD210504, 0x000B886F, 0x200020E8, 0xABD74100, 0x0004FF75,
+0x8C73AC21, 0x22240004, 0xABD259F0, 0xABCCFF74, 0x8FA4FF84, 0x8C91FF7A, 0x6860FF8D, 0x7565FF79,
+0xAB96FF92, 0xE0C9FFCA, 0xD2BAFFF6, 0xB19AFFE6, 0xA48FFFCB, 0xA794FFC4, 0x8E7CFFCA, 0x3B2CFFAD,
+0x3226FF4E, 0x1F18FF3E, 0x1D1BFF28, 0x2323FF28, 0x1615FF35, 0x2019FF2A, 0x2923FF33, 0x3137FF36,
+0x303FFF36, 0xACC7FF27, 0xA4C7FF92, 0xAFD7FF7C, 0x0568FF7B, 0x00089400, 0xD531089C, 0x17D079AF,
+0x80074C00, 0xFF72AFDB, 0xFF72B1DC, 0xF800263C, 0xD338F20D, 0xCDFF79AF, 0xCCFF77AE, 0xCEFF78AD,
+0xC4FF7CAA, 0xD3FF80A4, 0xF6FFADC2, 0xEDFFE2F1, 0xE1FFDDED, 0xD3FFD7E6, 0xD7FFD1DD, 0xA1FFDAE2,
+0x30FFA5A6, 0xC4FF2128, 0xD3FF8DA6, 0xCFFF85B0, 0xD5FF73B0, 0xD6FF75B8, 0x0D9874B3, 0x0008300F,
+0x0B02E401, 0xF8040970, 0x08B40504, 0x2003640F, 0x78B4D94F, 0x150004FF, 0x0903E000, 0xB34F002C,
+0x04D9FF79, 0xB2220100, 0x6500187B, 0xD8FF78B4, 0x000476B5, 0x68B6DC20, 0x780EF104, 0x75B6D6FF,
+0x87BAD9FF, 0x99ACCAFF, 0x505F80FF, 0x90B7DEFF, 0x80B5DDFF, 0x7DB3D9FF, 0x3CF10500, 0xFF79B7DE,
+0xFF72B3DB, 0xFF76B7DD, 0xFF78B4D6, 0xFF79ABC6, 0xFF97BCCF, 0xFFDFF2FF, 0xFFE1ECF2, 0xFFDEE3E7,
+0xFFEFF6FE, 0xFFE9FBFF, 0xFFC7E2F5, 0xFF8AB2CB, 0xFF80A5BF, 0xFFC5E0F1, 0xFFECFFFF, 0xFF7C97AC,
+0xFF86A8C3, 0x5880ADCC, 0xB4D3311F, 0x10019C81, 0x0004E0D6, 0xB54000F0, 0x04D9FF75, 0x05000000,
+0x0004F001, 0x040404F8, 0x05000F00, 0x04FC0403, 0x0900080F, 0x00011C09, 0x040F0068, 0x54001000,
+0x00040401, 0x1900400F, 0x08003404, 0xD8000008, 0x00040F0F, 0x051C0C0D, 0x04051408, 0x08000510,
+0x05100000, 0x0303A401, 0xFC002474, 0x0A200004, 0x01000801, 0xFC000D98, 0x42540203, 0x07041401,
+0xC0000510, 0x04FC0017, 0x0000040C, 0x04000504, 0x0A0C0000, 0x00050400, 0x04000004, 0x00040005,
+0x08050800, 0xEC0004F8, 0x04F80C13, 0x0009FC00, 0x040004F4, 0x09F00F00, 0x09F40401, 0x0004F400,
+0xD0002C48, 0x00040409, 0x0C04F008, 0xE40004E0, 0x00040004, 0x0000B000, 0x040000BC, 0x13800000,
+0x0104F800, 0x680000DC, 0x2B04032B, 0x000E8000, 0xB40004EC, 0x00040809, 0x0804A800, 0x0C081A6C,
+0x001C0000, 0x03014C01, 0x5C0020AC, 0x01640001, 0x00000400, 0x0400000C, 0x0E580100, 0x9877AB21,
+0x016800B7, 0x001D4C00, 0x78000B8C, 0x21400021, 0x76ADD631, 0x20000E80, 0x09740016, 0xABD25BF2,
+0xADC9FF77, 0x7181FF8B, 0x4845FF65, 0x4E3EFF56, 0xA188FF6B, 0x9A7EFFC3, 0x9F83FFB9, 0xD6BBFFB7,
+0x8169FFEB, 0x634DFF9D, 0x7B65FF87, 0x7A67FFA5, 0x2B19FF9F, 0x3727FF42, 0x3B34FF44, 0x1E1CFF44,
+0x2222FF29, 0x1E1BFF34, 0x160CFF33, 0x170FFF28, 0x1B1BFF28, 0x545FFF27, 0xABC1FF56, 0xB4D2FF99,
+0xB3DBFF91, 0xB4DCFF82, 0xD1710D18, 0xD6FF74AC, 0x08E07CB2, 0x80124400, 0xFF74B1DD, 0xFF73B2DD,
+0x24000008, 0xD337F217, 0xCDFF7AAE, 0xC0FF7EAF, 0xC4FF81A6, 0xE2FF96AC, 0xF3FFC5D0, 0xE9FFE6ED,
+0xECFFE3EC, 0xD2FFDFEF, 0xD2FFC7D8, 0xB9FFD0DA, 0xB2FFB7BD, 0xBFFFA7AF, 0xD9FF9BAE, 0xDCFF8DB5,
+0xD1FF7CB3, 0xD1FF6FB1, 0xD7FF6FB4, 0x080D94B4, 0x0C0402D4, 0x031C0100, 0x0C03AC00, 0xB2220974,
+0x00046C78, 0x700F0488, 0x48011003, 0x78B46D00, 0x79B5DAFF, 0xD8100004, 0x440004B0, 0x79B54F00,
+0x0004D9FF, 0x00200400, 0x04000804, 0x10010024, 0xB50FF100, 0xB8DAFF76, 0xB7DAFF76, 0xB4E0FF75,
+0xB2E0FF77, 0xB1DCFF7C, 0xB3D7FF7E, 0xB7D2FF7D, 0x71000477, 0xFF7BB0D8, 0xE87CB1DB, 0xB2D3B105,
+0xB3D9FF7A, 0x7295FF93, 0x711E1458, 0xFF83B0D1, 0xCC7DB1D6, 0x18D40100, 0x78B723F1, 0x76B5D6FF,
+0x78B7D6FF, 0x7BB4D1FF, 0x7FB1CCFF, 0x85ADC6FF, 0xC3DFF4FF, 0xE0F3FFFF, 0xD0DEEBFF, 0xE8F4FFFF,
+0xEEFCFFFF, 0xE2F2FFFF, 0xDAECF8FF, 0x14F222E8, 0xFF8A9DAC, 0xFF7D98AB, 0xFF95B5CA, 0xFFADD0E6,
+0xFF8CB4CE, 0xFF80B1D1, 0xFF80B8DB, 0xFF77B6D9, 0x0876B6D9, 0x00E00000, 0x807AB421, 0x47840047,
+0x4F000400, 0xFF7AB4D9, 0x002A0004, 0x040F0054, 0x28010800, 0x01640301, 0x21000C0F, 0x08017004,
+0x48080008, 0x01DC0000, 0x09023004, 0x34030008, 0xB2DA4402, 0x0004FF78, 0x0002C400, 0xBC000004,
+0x00040402, 0x0019D808, 0x040007F4, 0x039C0100, 0x0403B803, 0xA00003C4, 0x03E0041B, 0x0212C400,
+0x6E1508F4, 0x3C001E40, 0x04440004, 0x00000400, 0x040F0454, 0x08000100, 0x00040005, 0x000A1404,
+0xEC000008, 0x04F80009, 0x00000404, 0xF4080500, 0x04F80004, 0x02000400, 0x631904FC, 0xEC000EE4,
+0x00040009, 0x0104FC04, 0xC4071D1C, 0x04F40013, 0x0205040C, 0x6B1104F4, 0xEC013074, 0x6BA82204,
+0x94032704, 0x04FC0018, 0x0004F000, 0xE8020ED4, 0x2B5C0300, 0x000EC803, 0x040404D8, 0x011C0000,
+0x00000C04, 0x0C00011C, 0x00080000, 0x04001800, 0x7C000004, 0x000C0010, 0x00015400, 0x040404FC,
+0x00100200, 0xDBFF7473, 0xD9FF78AC, 0xC8021304, 0xA0721225, 0x77AE7020, 0x77AED7FF, 0x0001A8FF,
+0x040125AC, 0xB16BF200, 0xB0C9FF7F, 0x6370FF90, 0x211BFF5B, 0x412EFF34, 0x856CFF62, 0x8064FFA7,
+0x3E20FF9F, 0xD1B5FF57, 0x664EFFE9, 0x3C23FF82, 0x735BFF5E, 0x654FFF9D, 0x2C19FF8E, 0x2C1EFF47,
+0x332AFF3E, 0x4842FF40, 0x1814FF55, 0x1C17FF2B, 0x2418FF31, 0x170DFF36, 0x211EFF28, 0x1D21FF30,
+0x3343FF23, 0x5D75FF2C, 0x88A8FF45, 0x9ABEFF5F, 0xADCFFF6A, 0xB8D9FF7F, 0xB1D3FF8B, 0xB1D3FF86,
+0x000D2C83, 0x40000478, 0xB02FF117, 0xAECEFF7A, 0xADC6FF7D, 0xCBDEFF81, 0xDFEEFFA6, 0xE8F5FFC5,
+0xF3F8FFE0, 0xE7E4FFF2, 0xD0C9FFE5, 0xB4B1FFC9, 0xE5E4FFA5, 0xD8D7FFD5, 0xA5A7FFCE, 0xBDC7FF9A,
+0x7F95FFAC, 0xAFD5FF63, 0x7200E07F, 0xFF7ABCDE, 0x2872B4D4, 0x04800009, 0x0500040F, 0x0F04E400,
+0x02040004, 0xCC0F03C0, 0xEC040309, 0x03200004, 0x0F000C04, 0x04010008, 0x6008034C, 0x000C0803,
+0x00002005, 0xE8000428, 0x00080803, 0xFF77B6B0, 0xFF74B9D8, 0xFF74B9DA, 0xDE710EC0, 0xDAFF7CB2,
+0x187C80B1, 0x7AB8D171, 0x7AB7D3FF, 0x14000010, 0xDC0CF205, 0xD5FF7AB9, 0xD6FF77B3, 0xCFFF82B2,
+0x94FF89AD, 0xD3FF5A78, 0xDAFF95B7, 0x0F5084B4, 0xFF7BB6A1, 0xFF7BB6D6, 0x0879B4D4, 0xB9D83100,
+0xF1000C7C, 0x7CB1D034, 0x83B0CDFF, 0x9CBED9FF, 0xBCD6EDFF, 0xA1B6CBFF, 0xD5E5F4FF, 0xF0FBFFFF,
+0xEEF7FCFF, 0xB4BECAFF, 0x8F9FAFFF, 0xDDF4FFFF, 0xB8D3E6FF, 0xB6D1E4FF, 0xA8CBE1FF, 0x7EACCDFF,
+0x7DB5D8FF, 0x78B7DAFF, 0xD8100004, 0xB6610008, 0xB5DBFF7A, 0x0100047B, 0x1001013C, 0xFF7B4A06,
+0x0004B5DA, 0x1A05100F, 0x0F011400, 0x4F080004, 0xFF7AB6DA, 0x08010004, 0x0C0F0164, 0x38042A00,
+0x02240002, 0x00000C04, 0x10000008, 0x073C0700, 0x00050400, 0x00000C34, 0x00040005, 0x00035800,
+0x0C040004, 0x05080400, 0x00050000, 0xB8000004, 0x00040803, 0x021C1C02, 0xE4003364, 0x00040003,
+0x01042000, 0x4C00042C, 0x285C0323, 0x00050000, 0x00040004, 0x000C0805, 0x00001404, 0x04000504,
+0x05000000, 0x0013E400, 0xF8040004, 0x9DCF4004, 0x0004FF61, 0x629FCE40, 0x000004FF, 0xE40065B0,
+0x00040009, 0x2204EC00, 0x65A4A2D2, 0x0065A800, 0xEC0F531C, 0xF4010109, 0x18B00304, 0x0404F000,
+0xF0000004, 0x00040004, 0x0404E400, 0xE8000004, 0x00040404, 0x0109DC08, 0xC00B0E04, 0x0484010E,
+0x346CAC10, 0x00000406, 0x04001820, 0x09CC0000, 0x30013801, 0x08FF74AD, 0x00040000, 0x0F015404,
+0x00110008, 0x9000208C, 0x09EC0001, 0x0015D400, 0x0401000C, 0x77B33000, 0x001C9CFF, 0x73F212E8,
+0xFF7FB1D2, 0xFF89A9C0, 0xFF3B454F, 0xFF2F1D19, 0xFF503325, 0xFF7E6350, 0xFF6D513B, 0xFF4B2B12,
+0xFFC2A48A, 0xFF786048, 0xFF3F250E, 0xFF967258, 0xFF79533C, 0xFF513122, 0xFF472F23, 0xFF533F34,
+0xFF4F3B32, 0xFF513A32, 0xFF2F1810, 0xFF2B1B0E, 0xFF322419, 0xFF2E201D, 0xFF392F30, 0xFF5A575E,
+0xFF4C5461, 0xFF415973, 0xFF587593, 0xFF516983, 0xFF5F748F, 0xFF778CA9, 0xFF8CABCA, 0xFF85B6D6,
+0x04F8B1D0, 0xB0C810F1, 0xCEDAFF86, 0xEFF4FFAC, 0xEAF1FFD6, 0xDADEFFD9, 0xCFD2FFCF, 0xCAC9FFCA,
+0xA6A0FFC6, 0xF109F0A1, 0xD3DFDF10, 0xD9E6ECFF, 0x9BAAB1FF, 0xADBFCBFF, 0x9BB2C2FF, 0x6C8FA5FF,
+0x6C9DBEFF, 0x7FB6DDFF, 0x900003F4, 0x036C0F04, 0x047C001A, 0x0C00040B, 0x100F03BC, 0x7D134700,
+0x08070428, 0x7AB63000, 0x010458FF, 0xB6210004, 0x7113787B, 0xFF7FB4D6, 0xC47EB4D6, 0xB6D9B204,
+0xB0D9FF7E, 0xB3DEFF7F, 0xF205E880, 0xFF76B816, 0xFF79B9D4, 0xFF8DBCD6, 0xFF536482, 0xFFA2B1D2,
+0xFF87B1D7, 0xFF7DB5DA, 0xFF7EB8DD, 0xFF7CB4D9, 0x0040B5D7, 0x7AB5D750, 0x0060D8FF, 0x7CB92FF1,
+0x7DB5D6FF, 0x7FB1D6FF, 0x82AED5FF, 0x88B2DAFF, 0x94B6D2FF, 0xA6BAC3FF, 0xACBABDFF, 0x4E5A66FF,
+0x303D4EFF, 0x738297FF, 0xC7D7EEFF, 0xCFE4F9FF, 0xBCDAF2FF, 0x87B5D6FF, 0x81B7DBFF, 0xD7500050,
+0xDCFF7EB6, 0xB62115A4, 0x1000087B, 0x400F94DB, 0xD8FF7DB8, 0xB61A0004, 0x400F04FC, 0x680F4701,
+0x100C1300, 0x00900F02, 0x0030000D, 0x04002402, 0x7B150198, 0xB8010AD0, 0x0A7C030F, 0x0010B400,
+0x08010010, 0x0A1C0300, 0x07114C01, 0x64001178, 0x00040003, 0x08037000, 0x0C000F24, 0x050C0400,
+0x0008CC00, 0x14000004, 0x14200D0F, 0x00094407, 0x6C010460, 0x3C880F04, 0x05140400, 0x00050400,
+0x040004F8, 0x09F40500, 0x89349E12, 0x0079C000, 0xF8000004, 0x00040004, 0x0004FC00, 0xF80009E8,
+0x00040004, 0x2104FC01, 0x58406AA4, 0x0F04F001, 0x00001DB0, 0x040C0080, 0x00980000, 0x01000400,
+0x200105B8, 0xFF71202E, 0xF0001D6C, 0x00040004, 0x138CD610, 0x00000407, 0x040000EC, 0x09B00200,
+0x012B180F, 0x1704F00F, 0x0B04D001, 0x70002568, 0x00040101, 0x3025A800, 0x90FF78AF, 0x00040006,
+0x00002C00, 0xD42017F0, 0x000E84B0, 0x6EF120BC, 0xAFCFFF78, 0xB2C9FF7E, 0x4751FF92, 0x2320FF3D,
+0x4035FF32, 0x4131FF5B, 0x402DFF58, 0x482FFF5B, 0x7D64FF6A, 0x543DFF9F, 0x1D06FF6A, 0x664DFF33,
+0x432DFF88, 0x3528FF67, 0x2419FF55, 0x4A3EFF40, 0x3F34FF62, 0x6056FF55, 0x2D22FF78, 0x1609FF43,
+0x1E13FF26, 0x2720FF2C, 0x312DFF38, 0x4747FF43, 0xA5ACFF57, 0xB4C8FFAA, 0x718CFFA2, 0x95AEFF56,
+0x8DA7FF81, 0x7593FF7C, 0x6380FF62, 0xF10D8848, 0x85AFC734, 0xA0C4DAFF, 0xBAD7E7FF, 0xDDF2F5FF,
+0xD6E5E2FF, 0xC3CFCDFF, 0xD4DFDBFF, 0xA4ADA8FF, 0x69726DFF, 0xEEF7F2FF, 0xE2EBE8FF, 0xC8D2D4FF,
+0xC8D5DBFF, 0x8A9CA6FF, 0x617886FF, 0x608194FF, 0x78A0B9FF, 0xE4001CB0, 0x12F80003, 0x7EB6DB33,
+0x1C0F0454, 0xE8021303, 0x002C0F02, 0x041C004B, 0x2000040A, 0x00A8FF7E, 0x0000040C, 0x900004B4,
+0xB7D98000, 0xB7D9FF7B, 0x0464FF7C, 0x7FB6D540, 0x000004FF, 0x1400000C, 0x00340000, 0xB3DE14F1,
+0xB6DEFF82, 0xB7DCFF82, 0xB7D7FF79, 0xBBD5FF75, 0xBCD5FF78, 0x7091FF8A, 0x6083FF67, 0xB9DDFF5C,
+0x000A149B, 0xDD710050, 0xD8FF80B8, 0x000481B6, 0x81BBE031, 0x2CF109B8, 0xFF78B9D9, 0xFF77B6D7,
+0xFF7DB7DD, 0xFF83B8E2, 0xFF7DB1E0, 0xFF82ADD0, 0xFFBCD4DE, 0xFFEAF9FC, 0xFF697784, 0xFF2C394A,
+0xFF465268, 0xFF5D6C81, 0xFFACBED4, 0xFFACCAE4, 0xFC8EBCDD, 0xB6D68004, 0xB7D6FF81, 0x1488FF80,
+0x0500DE13, 0xFCB7DC22, 0xB8D63104, 0x0A00BC7D, 0x7C2F00F0, 0x610010FF, 0x0F014C00, 0x00230004,
+0x040804F8, 0x02200200, 0x01051800, 0x9C040004, 0x0738070A, 0x00050800, 0x04000A0C, 0x1F100100,
+0x01164403, 0xB2101670, 0x900224C4, 0x1438001B, 0x0004FC00, 0x00000004, 0x05040417, 0x00000800,
+0x040412B0, 0x050C0000, 0x040A0C00, 0x5C040004, 0x00080104, 0x01134800, 0x1C000518, 0x00040643,
+0x040A0C04, 0xE00004F8, 0x0004000E, 0x00545800, 0xF80422C8, 0x04F80009, 0x00000400, 0xEC041DCC,
+0x00080009, 0x0144BC00, 0xF8070004, 0x32C00104, 0x03573800, 0xE8000004, 0x00040804, 0x00009000,
+0x04002770, 0x05BC0000, 0x0D000400, 0x700004F0, 0x00040718, 0x0209DC00, 0x72150004, 0x10003014,
+0x00040401, 0x0F04A800, 0x00210004, 0x040004E4, 0x01740400, 0x00209004, 0x18000BA8, 0x00040000,
+0x0006A000, 0xD5100D80, 0xB3211D20, 0xF01C4079, 0x96B6CDB5, 0x47515DFF, 0x362827FF, 0x593E33FF,
+0x2C1609FF, 0x371D0CFF, 0x623F29FF, 0x7C5943FF, 0x6B5540FF, 0x371E0AFF, 0x78553FFF, 0x65402DFF,
+0x563629FF, 0x43281FFF, 0x644E43FF, 0x361F17FF, 0x482F28FF, 0x3C231CFF, 0x402E24FF, 0x38261AFF,
+0x462E22FF, 0x4C3126FF, 0x4F322AFF, 0x584C4EFF, 0xA0B7C9FF, 0x96BED8FF, 0x708FAEFF, 0x91B2D1FF,
+0x8FB6D3FF, 0x88ADC7FF, 0x536E7FFF, 0xD0E3F1FF, 0xDAECFAFF, 0xC6D4DFFF, 0xCFD8DFFF, 0xD1DCDEFF,
+0xC9DDDCFF, 0xBFD5D2FF, 0x667570FF, 0xDBE7E3FF, 0xDAE6E6FF, 0xD2DDDFFF, 0xD7E3E3FF, 0xADBDBCFF,
+0xBFD4D7FF, 0x294751FF, 0x9FC8DAFF, 0x85B5CCFF, 0x84B6D1FF, 0x50179CFF, 0xFF8ABFDE, 0x001C80D4,
+0x800B0DA4, 0x0308080D, 0x4D038C0F, 0x0804A800, 0xDA490004, 0x04FF7DB8, 0x7FB74F00, 0x0004DAFF,
+0x09DC0100, 0x00095801, 0x7F400E64, 0xBCB6DAFF, 0xFF805104, 0x047FB7D8, 0xB8DA4000, 0x0468FF7C,
+0x7FB4DE31, 0xDE3118E8, 0x0A2C7DB9, 0xB9D518F1, 0xB9D4FF7D, 0x91B5FF8D, 0x3456FF8B, 0x9BBBFF35,
+0xB6D5FF8E, 0xB2D7FF97, 0xC0E4FF7E, 0xB6D4FF84, 0xB3D1FF7F, 0x0013B07C, 0xDD40190C, 0x04FF78BA,
+0xD630F105, 0xD9FF7FB8, 0xDEFF81B7, 0xD0FF7EB5, 0xE7FF82AF, 0xFEFFC6DC, 0xADFFEFFA, 0x61FF90A0,
+0x7CFF4051, 0x68FF5668, 0x85FF3E53, 0xA2FF566F, 0xD8FF6488, 0xDCFF85B7, 0xD6FF81B9, 0xD7FF81B8,
+0x008C81B8, 0x00054400, 0xDC200004, 0x5F10DCB7, 0xB8D9FF80, 0x0200DC80, 0x0100F00F, 0x4600140F,
+0x0301700C, 0x94080010, 0x000C0F01, 0x06640009, 0x1F00040A, 0x0A07547C, 0x03051401, 0x0801050C,
+0x0A200305, 0x01036800, 0x0C0B0004, 0x05040005, 0x04000400, 0xA00003F0, 0x050C000D, 0x00000400,
+0x04040508, 0x050C0000, 0x04050800, 0x0C0E0004, 0x377C0A05, 0x000A0400, 0xDC040004, 0x1DD00613,
+0x0213E400, 0xF8007534, 0x00040004, 0x0009F800, 0x040404F4, 0x09F00100, 0x2249BC00, 0x49C06CA6,
+0x286AA725, 0x09F0004E, 0x0004F404, 0x040804F0, 0x00940000, 0x0004F400, 0xA8010004, 0x71AC2100,
+0xBC0026DC, 0x0004040E, 0x07294C09, 0xB8000ECC, 0x01040413, 0x00000808, 0x040F04A8, 0xE0012500,
+0x0B8C0404, 0x61259000, 0xDBFF7BB3, 0x15B079B3, 0x00069C00, 0x1C000004, 0x06A40111, 0xF1262000,
+0xFF7FB047, 0xFF98B8D1, 0xFF3E4A56, 0xFF3A2C2B, 0xFF3C241A, 0xFF29150A, 0xFF341D0F, 0xFF482714,
+0xFF6B4B36, 0xFF684E3D, 0xFF361C0B, 0xFF5A3723, 0xFF603B29, 0xFF54362B, 0xFF51392F, 0xFF442D25,
+0xFF2C180F, 0xFF7E655E, 0xFF412821, 0xFF462F27, 0xFF412B1E, 0x24503524, 0x293CF10F, 0x3CFF5533,
+0xAAFF4C3C, 0xD3FF8499, 0xD7FF93B8, 0xDFFF99B8, 0xC8FF9FC0, 0xD5FF87AF, 0xEDFF9FC2, 0xF1FFD2E3,
+0xACFFE2E9, 0x9FFF9CA5, 0xE0FF8E99, 0xD5FFCFDA, 0xAEFFC3D2, 0x91FF9AB0, 0x33FF7D93, 0xEFFF2434,
+0xECFFE0EE, 0x0500DBE9, 0xDCDA19F0, 0x8D8DFFD0, 0xBDC0FF7F, 0x3C47FFA8, 0x6C7FFF20, 0xCAE2FF47,
+0xBFD8FFA0, 0xACC6FF95, 0x5E7CFF7E, 0xC0DFFF2D, 0x0448FF89, 0x2904E40F, 0x0F046400, 0x09290004,
+0x7C0304EC, 0x00140803, 0x04184400, 0x040F0004, 0xB8000104, 0x09B8000E, 0x00000400, 0x54000028,
+0x00040004, 0xD4B9DB22, 0xB4DC400E, 0x0004FF7F, 0x80BADF80, 0x7EBADCFF, 0xF00974FF, 0x89B6D309,
+0xA4B4D6FF, 0x5B5C7BFF, 0x5D5B71FF, 0xABB7CFFF, 0x8BB6D6FF, 0x801920FF, 0xFF7FB5D1, 0xFF85BDD8,
+0xE0310030, 0x245C7FBB, 0x80BBDB90, 0x82B9D7FF, 0x004CD3FF, 0x80B61DF3, 0x86B2CFFF, 0xD4E6F2FF,
+0xEAF3F8FF, 0x9DAFBBFF, 0xB0C5D6FF, 0xCFE6F8FF, 0xA1BAD0FF, 0x9AB8D0FF, 0x8DB4D1FF, 0x84BADCFF,
+0x0038DDFF, 0x00050400, 0xA400009C, 0x00040400, 0x0F001000, 0x0F550004, 0x04010138, 0xDB480014,
+0x04FF7EB9, 0x017C0800, 0x11000C0F, 0x0405CC00, 0x08020004, 0x0AC00F05, 0x07580807, 0x05000C00,
+0x2404050C, 0x0008000A, 0x03143C00, 0x50000004, 0x1E5C0819, 0x00050800, 0x04040500, 0x05040000,
+0x01000400, 0x2C000504, 0x1E38073E, 0x1726C802, 0x024C606F, 0x280056E0, 0x00040819, 0x0009F004,
+0x0404230C, 0x1E180000, 0x0409F000, 0xF8080004, 0x279C0004, 0x04000400, 0x080013D4, 0x04F40800,
+0x0004FC06, 0xB402007C, 0x13D80843, 0x0818A400, 0xF80C0004, 0x13B80C04, 0x0009DC0C, 0x040F04B4,
+0xB4000900, 0x00040F04, 0x2A6C0002, 0x0300040C, 0x880104FC, 0x20A80006, 0x00050003, 0xA0001D80,
+0x00040016, 0x64B0D520, 0xA07D111C, 0x26400025, 0xBAD3C0FF, 0x4B57FF9A, 0x2927FF3F, 0x1106FF34,
+0x1309FF27, 0x2416FF25, 0x190AFF37, 0x3827FF39, 0x4536FF59, 0x2312FF5F, 0x2B18FF3E, 0x4835FF4E,
+0x3F33FF6B, 0x3328FF5B, 0x271EFF49, 0x0F08FF3B, 0x3C35FF23, 0x1E17FF55, 0x1E17FF39, 0x3D31FF37,
+0x3924FF55, 0x533FFF55, 0x3026FF72, 0x3639FF4E, 0x6C7DFF46, 0x6881FF5F, 0x85A3FF4E, 0xC3DDFF72,
+0xD6E5FFB2, 0xF5FDFFC3, 0xE6ECFFE4, 0xE2E7FFE1, 0xADAEFFDF, 0xC8C8FFA3, 0x9A9BFFB6, 0xC3C4FF80,
+0x8E8EFFA9, 0x2223FF7C, 0x6067FF14, 0xF6FEFF51, 0xE6EBFFE9, 0xD7D9FFDD, 0xB4B3FFCF, 0x6466FFAB,
+0x828AFF59, 0x8796FF71, 0x0C1FFF74, 0x889FFF00, 0x7088FF72, 0x0922FF58, 0x8BAAFF00, 0xB8DAFF5E,
+0x3E088082, 0x1E03D40F, 0x0503800B, 0xB812038C, 0x500F1D40, 0xFC000900, 0x09D80004, 0x00000400,
+0x2C00000C, 0x04FC0000, 0x00000400, 0x6C00000C, 0xB7DF2004, 0x81110F00, 0xDE7104D0, 0xD6FF80BC,
+0x09E47ABA, 0xBEDE55F0, 0x9BB5FF9A, 0x5966FF8F, 0x6573FF69, 0xB8D3FF71, 0xB7D8FF9E, 0xB9D7FF89,
+0xB5D5FF8A, 0xBADFFF84, 0xB3D8FF88, 0xB7D9FF81, 0xB8D9FF89, 0xBBDAFF8A, 0xBDDCFF88, 0xBEDFFF8A,
+0xB5D0FF8D, 0xEDFBFF90, 0xF8FFFFE1, 0xBBC9FFF1, 0xEBFAFFA8, 0xEAFDFFD1, 0xA9BEFFCF, 0xB6D0FF8A,
+0xB8D7FF92, 0xBCDFFF8B, 0x0584FF84, 0x31053800, 0x6C83B8D7, 0xB8DE4501, 0x0004FF82, 0xFF81B961,
+0x247FBADC, 0x0A28000A, 0x2500040F, 0x0F00E800, 0x216A0004, 0x14E881B7, 0x05055004, 0xCC030008,
+0x071C0006, 0x0007600A, 0x30041174, 0x0F2C020F, 0x04050C00, 0x14050004, 0x19400305, 0x001B4000,
+0xDA130508, 0x100429CC, 0x050C0005, 0x00090808, 0x2400000C, 0x050C0009, 0x00133000, 0x04000A10,
+0x05080000, 0x08097800, 0x0C040988, 0x04AC0000, 0x080EEC00, 0xFC0004F8, 0x231C0104, 0x08319803,
+0xD00104FC, 0x18D8071D, 0x0004F800, 0x48000004, 0x00040000, 0x00005804, 0xA0000008, 0x19A4001E,
+0x0B04EC09, 0xA8001ED4, 0x09F00800, 0x042E4400, 0xF80418AC, 0x09DC0C04, 0x0104FC0F, 0x0004F00C,
+0x040D1564, 0x26200000, 0x0000040F, 0x1104FC02, 0x0016FC79, 0xF4001700, 0x1BA40504, 0xFF7BB561,
+0xA479B4D6, 0x00280011, 0xB4D53CF1, 0xB9D2FF83, 0x6F7CFF97, 0x1614FF61, 0x1B11FF20, 0x150DFF2D,
+0x2216FF26, 0x2012FF34, 0x2C1DFF3D, 0x483AFF4C, 0x2517FF64, 0x1E0BFF41, 0x4A3AFF41, 0x362AFF6E,
+0x352AFF52, 0x2B21FF4B, 0x0801FF3D, 0x1D15FF1B, 0x4A43FF34, 0xF10A0465, 0x5E433874, 0x361A05FF,
+0x896E5BFF, 0x644942FF, 0x4C4044FF, 0x8B97A7FF, 0x859AAFFF, 0x94A1B4FF, 0xBCC5D4FF, 0xBBC4C9FF,
+0xD1DAD9FF, 0xCCCDD1FF, 0xE2E6E9FF, 0x939D9FFF, 0x91A3A5FF, 0x92AEAFFF, 0x91ABACFF, 0x0F1D1EFF,
+0x232D2FFF, 0xF3FFFFFF, 0xBBC8D0FF, 0xA8B1B6FF, 0x9FA7AAFF, 0x899297FF, 0x525D63FF, 0x3A4855FF,
+0x576776FF, 0x1A2737FF, 0x102133FF, 0x000920FF, 0x43627EFF, 0x95C2E3FF, 0x85BADCFF, 0x400F02BC,
+0xF0002903, 0x00400F02, 0x04F00529, 0x01050803, 0x180F0414, 0xDE711404, 0xDFFF81B9, 0x00047FB9,
+0x4CB9DE22, 0x05D40104, 0x0005D800, 0xB9210460, 0x00047081, 0x20005AE4, 0xBBDD8105, 0xBBDAFF7F,
+0x0F04FF7C, 0x85B64FF1, 0xA2B8CFFF, 0x89747DFF, 0x674C53FF, 0x84899CFF, 0xA0BAD3FF, 0x8DB1D1FF,
+0x8CB7D9FF, 0x8EBADFFF, 0x93BEE1FF, 0x96BFDFFF, 0x93BFDCFF, 0x92C1DFFF, 0x94C5E5FF, 0x97C4E5FF,
+0x9CBCD5FF, 0xE6F0FCFF, 0xEBF2FAFF, 0xA2B5C3FF, 0xD2EFFFFF, 0xCAE7F9FF, 0x88A8BFFF, 0x92BBD7FF,
+0x88BADBFF, 0x70001950, 0xBAD96000, 0xB9D8FF83, 0x8470050C, 0x84B8DDFF, 0x0004DFFF, 0xFF83B961,
+0x9482BADF, 0xBADD4F05, 0x0004FF82, 0x05180C09, 0x0C002C0C, 0x10080020, 0x01980000, 0x0F001008,
+0x001D000C, 0x040F0040, 0xDC400D00, 0x04FF82B8, 0x00280D00, 0x2101D004, 0x0FFC7DB7, 0x0C050806,
+0x300215D0, 0x0500040A, 0x04000805, 0x14032428, 0xB3DB200A, 0x77202348, 0x000508FF, 0x08000004,
+0x05040005, 0x0800040C, 0xC8000A10, 0x48D80026, 0x00050400, 0x08000004, 0x00040405, 0x0004A400,
+0xA8000004, 0x3B9C0062, 0x00000400, 0x040036A0, 0x1E180000, 0x00191C00, 0xEC000004, 0x00040009,
+0x0009E800, 0xF0000004, 0x00040004, 0x0044FC00, 0x04003B38, 0x13D00000, 0x00000400, 0xEC040ED8,
+0x04F80009, 0x0404E000, 0xC4000004, 0x09DC0013, 0x04000408, 0x080004EC, 0x04F00400, 0x00000800,
+0xE80F04F4, 0x14000104, 0x04EC0400, 0x002F0C04, 0x04080498, 0x04C40000, 0x1900040F, 0x01017004,
+0xB52120AC, 0x00209C7D, 0xDC2216AC, 0x0006A8B5, 0xD72201D8, 0x312FA8B4, 0x0085B6D7, 0x7D30F105,
+0x0CFF6070, 0x1DFF160E, 0x08FF3625, 0x0EFF1F11, 0x11FF2918, 0x1AFF381E, 0x42FF472A, 0x16FF6D50,
+0x06FF4124, 0x45FF3817, 0x1BFF7756, 0x37FF4529, 0x25FF5A44, 0x06FF402F, 0x13FF2110, 0x0F38341E,
+0x3E231C71, 0x60453CFF, 0x6CF1052C, 0xFF877062, 0xFF796660, 0xFF2E292D, 0xFF6C7E8C, 0xFF95ADB9,
+0xFFE1EBED, 0xFFCFD5D1, 0xFFD4DED6, 0xFFCAD4CC, 0xFFD1D7D5, 0xFFDADFE2, 0xFF6D787E, 0xFF738289,
+0xFF37464B, 0xFF738184, 0xFF758082, 0xFFC4CED0, 0xFFBBC6CA, 0xFFAEB9BD, 0xFF919A9F, 0xFFC4CFD5,
+0xFF6C7D87, 0xFF30404D, 0xFF23313E, 0xFF313F4A, 0xFF21323C, 0xFF031A28, 0xFF61849A, 0xFF97C0DE,
+0xFF8CB8DB, 0xBC80B0D4, 0x03180F02, 0x0030081D, 0x00012000, 0x14080004, 0x000C0F00, 0x03E00C29,
+0x0900100F, 0x10044400, 0xF01894E0, 0xFF83B808, 0xFF83B9DF, 0xFF83B9DD, 0xFF83B9DB, 0xFF82BBD9,
+0xFF80BBD9, 0xDA710EB8, 0xDEFF7FBA, 0x0DE481BC, 0xF6000C00, 0x81BCDA5D, 0x83BCD9FF, 0x82B8D4FF,
+0xA0BCD2FF, 0x988892FF, 0x705053FF, 0x60494FFF, 0xBDB9C7FF, 0xAABFDEFF, 0x9CC0E4FF, 0x9CC2E6FF,
+0x9DC4E5FF, 0x99C2DEFF, 0x9AC6E1FF, 0x98C7E5FF, 0x94C3E1FF, 0x90BBDBFF, 0x9EBCD6FF, 0xEDF5FFFF,
+0xF4F8FFFF, 0x9EB4C1FF, 0xD0EDFDFF, 0xD1EEFFFF, 0x85A7C0FF, 0x88B3D3FF, 0x88BCE1FF, 0x80BCE0FF,
+0xF00500FF, 0xDAFF8603, 0xDCFF87B9, 0xDEFF87B9, 0xE0FF87B9, 0x60FF85B9, 0x00040019, 0x83BBDE7F,
+0x84BADEFF, 0x00060004, 0x040400D4, 0x00280F00, 0x001C0401, 0x2D00080F, 0x0F04C400, 0x00210004,
+0x38080078, 0x020C0000, 0x08000400, 0x10000204, 0x00040000, 0x05072C00, 0xB6120004, 0x5C0C0BE0,
+0x0A2C0014, 0x04039404, 0x14000008, 0x0898000A, 0x04000400, 0x080608D8, 0x1C9C0004, 0x05187611,
+0x00051404, 0x04040A0C, 0x0A100000, 0x00000400, 0x04040A0C, 0x137C0000, 0x04051004, 0xF8040500,
+0x04FC0804, 0x04453800, 0xF40004FC, 0x00040804, 0x0004F800, 0xF8000004, 0x00040004, 0x0004FC00,
+0xF8000058, 0x00040004, 0x0004F804, 0x9800007C, 0x04F8000A, 0x0C04E800, 0xF0000004, 0x00040404,
+0x0004F800, 0xE8080004, 0x00E80404, 0x04000800, 0x080100FC, 0x15440301, 0x0A011C00, 0x7C150004,
+0x080009CC, 0x1BD80005, 0x0900040F, 0x5110B402, 0xB5D9FF7E, 0x0200047F, 0x94000010, 0x1C7E1106,
+0x05180013, 0x3001BC01, 0x00FF7DB5, 0xD5B4F10A, 0x4EFF99BD, 0x17FF2E40, 0x16FF1D17, 0x03FF2D1F,
+0x10FF180B, 0x0DFF291B, 0x1DFF321B, 0x3BFF482B, 0x0FFF6649, 0x05FF3C1C, 0x51FF3716, 0x0FFF8263,
+0x33FF3A20, 0x22FF5542, 0x0AFF3B2D, 0x24FF2315, 0x26FF432F, 0x1DFF4A32, 0x33FF3F27, 0x35FF553D,
+0x46FF5842, 0x92FF6452, 0xD0FFA196, 0xDBFFCDCE, 0xAAFFC1D4, 0xB5FF8DA4, 0xD0FFAFB8, 0xD2FFD4DA,
+0xCAFFD3DD, 0xD1FFC8D4, 0xEDFFC8D2, 0x44FFE0EB, 0x2DFF313E, 0xC4FF1A27, 0xF5FFB6BF, 0xE7FFE9F3,
+0xD9FFDAE5, 0xC4FFCDD9, 0xD5FFBBC5, 0xE3FFC9D5, 0xF3FFD1E0, 0x89FFDAEB, 0x47FF687B, 0x40FF2538,
+0x33FF2536, 0x39FF1729, 0x99FF1530, 0xDEFF678B, 0x310896C4, 0x86B7D87F, 0x86B6DAFF, 0x0F2E0500,
+0x0F0904A0, 0x0449001C, 0x4C010438, 0x58B81004, 0x74851104, 0xBBDA4113, 0x0004FF84, 0xFF83BC43,
+0x310004DA, 0xEC84BDDB, 0xBADA310A, 0x00048885, 0x0CF13208, 0xFF8DC0DD, 0xFF9DBDD4, 0xFFB0ADB8,
+0xFF604347, 0xFF7B5552, 0xFF755B5E, 0x04C4C5D9, 0xE03CF105, 0xE4FF9DC0, 0xE0FF99C4, 0xDBFF98C6,
+0xDCFF92C1, 0xDDFF8DBE, 0xD9FF8EBF, 0xD4FF8EB9, 0xFCFFA0BC, 0xFEFFEAF0, 0xC0FFF1F5, 0xE9FF9CB2,
+0xFFFFBAD7, 0xC1FFD0ED, 0xE1FF86A8, 0xE0FF93C0, 0xDFFF84BA, 0xDFFF7FBB, 0xD9FF81BD, 0x017084BB,
+0x210A1401, 0x0F5888BA, 0x87BBE071, 0x83BDE2FF, 0x28000004, 0xBBDF4F0F, 0x0004FF85, 0x04F40F05,
+0x00140001, 0x0000300C, 0x040F0014, 0xA0000100, 0x00040804, 0x0800240C, 0x0C0F001C, 0x04082900,
+0x04FC0805, 0x00000C04, 0x04090344, 0x0F380800, 0x000F2C03, 0x00001470, 0x00040805, 0x00050404,
+0x040803F4, 0x040C0400, 0x081CC004, 0xFC040A14, 0x00080004, 0x000A100C, 0x08000A14, 0x05000005,
+0x00000400, 0x040104F8, 0x6C640000, 0x004F6C00, 0x4C014094, 0x58F00459, 0x08711002, 0xF80109F0,
+0x66780004, 0x946FAA25, 0x279C0057, 0x0022A400, 0xF00F0004, 0x64000504, 0x35B80027, 0x00000400,
+0x040135DC, 0x35600700, 0x0504E400, 0xB1210004, 0x013E247A, 0x9C031D98, 0x392C0013, 0x0804D400,
+0xA0000004, 0x00040F04, 0x17E00009, 0x0200040F, 0x0004F000, 0x04002620, 0x1C600022, 0x4480B621,
+0x15CC041C, 0x00000800, 0x3C0006AC, 0x00080000, 0x00001000, 0x2CF10500, 0xFF9ABED8, 0xFF233644,
+0xFF1E1A19, 0xFF1D1008, 0xFF1B1108, 0xFF261A0E, 0xFF301A0C, 0xFF4C3022, 0xFF5A3A2D, 0xFF422112,
+0xFF3D1C0B, 0xFF7A5B47, 0xFF3E2511, 0xFF523F2E, 0x2837291C, 0x2470F105, 0x47FF4432, 0x1BFF6A54,
+0x20FF3C26, 0x56FF3D29, 0xCFFF7163, 0xDBFFE2DA, 0xF1FFE1E0, 0x28FFEDF3, 0x81FF1828, 0xCBFF6D7F,
+0xCEFFC0CA, 0xD8FFCAD0, 0xC2FFD6E0, 0xD5FFBDC8, 0xC1FFC4D2, 0x88FFADBC, 0xF5FF7987, 0xE3FFE7F5,
+0xACFFD6E1, 0xE9FF9FAA, 0xDCFFDDE9, 0xD2FFD0DF, 0xD4FFCAD6, 0xBDFFC7D7, 0xE8FFA1B9, 0x8CFFC8E1,
+0x38FF6B81, 0x39FF172D, 0x58FF1A31, 0xDAFF314D, 0xD3FFA0CA, 0x08FC89BD, 0x00091800, 0xA0001C94,
+0x0E30003A, 0x0F093400, 0x00390004, 0x040F17FC, 0xDD444500, 0x04FF85BB, 0x04040000, 0x85B9DE31,
+0xCC000954, 0x04E0010F, 0x7085BA21, 0x04E40004, 0xF1000400, 0x89BADA00, 0x8DBBDCFF, 0x92BDE0FF,
+0x98BEE2FF, 0xE52009DC, 0xF104DCC1, 0xDDFF9B0E, 0xE0FFA0C2, 0x55FFC0CD, 0x53FF584D, 0x3FFF825C,
+0x64FF7348, 0xD8FF7A61, 0x2CF0C7C9, 0xC2E108F2, 0xC0D9FF8F, 0xC4DCFF88, 0xBCD8FF8A, 0xC0DEFF80,
+0xB8D5FF89, 0x139FAC8B, 0xF10A00F6, 0xFF9DB313, 0xFF9EBBCD, 0xFFDAF3FF, 0xFF88A8C1, 0xFF8DB9DC,
+0xFF86BCE2, 0xFF82BCE1, 0xFF83BEE0, 0x3C86BBDA, 0xBADB4014, 0x0004FF89, 0x89B9DD62, 0x20BADFFF,
+0x00240000, 0x4F00C400, 0xFF86BBDD, 0x001D0004, 0x040000F0, 0x00380800, 0x04001000, 0x18080004,
+0x000C0F00, 0x00300409, 0x0500080F, 0x08003C04, 0xDB130020, 0x080E0FD0, 0x0B800200, 0x09024C08,
+0x2C030518, 0x0014090F, 0x2881B921, 0x051C0833, 0x04037000, 0x80000004, 0x00040003, 0x04089800,
+0x000208C8, 0x33380204, 0x01052000, 0x6C030900, 0x093C002D, 0x03000401, 0x20042858, 0x050C000F,
+0x02000400, 0xA402049C, 0x09A40046, 0x0109F000, 0xF8040004, 0x4F540404, 0x30457C00, 0xECFF6BA8,
+0x00040404, 0x0409E800, 0xE80C0004, 0x04F8000E, 0x00000400, 0x68000060, 0x09E80C00, 0x0004FC01,
+0xAF223F48, 0x00487478, 0x04004878, 0x05000300, 0x0404F804, 0xEC0005D8, 0x00040804, 0x0000F402,
+0x3C041F5C, 0x00080215, 0x0004FC04, 0x040F0124, 0x48040100, 0x00080D01, 0x0504F003, 0x10030018,
+0x04E80000, 0x04001405, 0xB930214C, 0x174CFF81, 0xB3D4B8F1, 0xBCD6FF81, 0x7584FF97, 0x0E0EFF62,
+0x130AFF0E, 0x1209FF1D, 0x1C10FF1C, 0x1304FF28, 0x3728FF26, 0x3223FF51, 0x2B1AFF52, 0x1603FF4C,
+0x4C38FF37, 0x311CFF6B, 0x412EFF4C, 0x2D20FF56, 0x2014FF3B, 0x1607FF2C, 0x382AFF26, 0x564AFF4A,
+0x2319FF68, 0xBBB1FF34, 0xBBAFFFC5, 0xF2EBFFBD, 0xE4E0FFED, 0xD0CFFFD9, 0xE0E0FFC0, 0xEAEEFFD0,
+0xE5E7FFDF, 0xDBD9FFDB, 0xD7D7FFCF, 0xC1C5FFC9, 0xDEE2FFAF, 0xE9E5FFCB, 0xD6D0FFD6, 0xA9A9FFC5,
+0x9596FF9B, 0xE7E5FF87, 0xC4C2FFDB, 0xB9B5FFB8, 0xDAD9FFAD, 0xC9CBFFCA, 0x7C81FFB1, 0x555BFF63,
+0x343EFF3E, 0x2632FF1C, 0xB8CAFF0A, 0xBDD6FF93, 0xBAD8FF8B, 0xBCDCFF81, 0x512C1C81, 0xFF83BEDE,
+0x0217A4DD, 0xB00F02B4, 0xCC080504, 0x000C0402, 0x05002C0F, 0x2100180F, 0x0F04CC04, 0x20050008,
+0x041CBCDE, 0x0804F406, 0x70000028, 0x03A00400, 0x86BBDB41, 0xF00004FF, 0xFF89BC08, 0xFF8CBDDD,
+0xFF8FBEDC, 0xFF92BFDE, 0xFF95C0E2, 0xFF98C0E3, 0x20F104F4, 0xFF9FC1E6, 0xFFA2C0E6, 0xFFA0C0E6,
+0xFF9CC3E4, 0xFF9EC3E0, 0xFFA9C5DB, 0xFFABB3BE, 0xFF5B423E, 0xFF7C5246, 0xFF643C32, 0xFF8F7B7C,
+0xECB3C5D9, 0xBDD93104, 0xF0143087, 0x7FBCDB1E, 0x86BFDDFF, 0x88B7D3FF, 0xA9C8DCFF, 0xEEF7FEFF,
+0xF0F7FDFF, 0x96ABBCFF, 0x95B0C5FF, 0xDCF2FFFF, 0x8BA7BFFF, 0x8FBBDEFF, 0x09E0E2FF, 0xFF86BC30,
+0xDB6000BC, 0xDBFF87BC, 0xF10584BC, 0xDCFF8A02, 0xDEFF8ABB, 0xDEFF8ABA, 0xE0FF89BB, 0x052085BD,
+0x4F002400, 0xFF87BCDE, 0x041D0004, 0x380000F8, 0x000C0400, 0x4D00080F, 0x0F050408, 0x0007000C,
+0x540214EC, 0x02300002, 0x090A540C, 0xB82F04FC, 0x02168082, 0x04038008, 0x0000000C, 0x00040005,
+0x00050404, 0x040404F8, 0x05000800, 0x00044804, 0x04001934, 0x0F140000, 0x0C000400, 0x98000508,
+0x0004000E, 0x000EE000, 0xDC000004, 0x00040013, 0x0009E800, 0xF4050004, 0x09E80304, 0x00700000,
+0xE8005C5C, 0x00040009, 0x0004EC00, 0xD8000004, 0x0004040E, 0x0004F400, 0x040004E8, 0x2C3C0000,
+0x03000409, 0x10002C60, 0x00040048, 0x0209D800, 0x78110004, 0xC4041D5C, 0x04E80413, 0x01000804,
+0xB521137C, 0x002FDC7D, 0xA8044358, 0x0008050E, 0x0009C408, 0x040409C8, 0x04D00300, 0x0F261800,
+0x00090004, 0x04002FA4, 0x25DC0000, 0x08000400, 0x48000688, 0x0014001C, 0x00092400, 0x08F10500,
+0xFF86B8D9, 0xFF95BAD5, 0xFF728896, 0xFF080A09, 0xFF1C130A, 0x00170D04, 0x0B8CF105, 0x2CFF2C1B,
+0x1DFF553E, 0x1AFF4E2F, 0x05FF4E2D, 0x2CFF3918, 0x25FF5F40, 0x24FF563A, 0x1CFF4D36, 0x1CFF3929,
+0x0AFF3428, 0x3BFF281B, 0x81FF594C, 0x7EFF9C8E, 0x86FF9487, 0xD6FF988F, 0xDCFFE2DF, 0xE2FFDEE3,
+0xB7FFDAE6, 0xDDFFA3B5, 0xD7FFC6D9, 0xE1FFC5D4, 0xCCFFCFDE, 0xE9FFB6C8, 0x9AFFD2E5, 0x9AFF8297,
+0xE7FF869C, 0x62FFD7EC, 0xDBFF5469, 0x4EFFC8DC, 0xF3FF3E4E, 0x90FFEAF4, 0x91FF8791, 0xFFFF848F,
+0x98FFEFFD, 0x27FF8695, 0x3EFF1325, 0x3CFF2439, 0x9EFF1531, 0x17BC6187, 0xB1177C00, 0xFF87BDE3,
+0xFF85B7DA, 0x1089BEDE, 0x1D100013, 0x83BBDC31, 0x4C000E38, 0x00040004, 0x00046008, 0x1400000C,
+0x00040F00, 0x001C0001, 0x00000402, 0x040F04A0, 0xDC4F2700, 0x04FF87BC, 0x13F12600, 0xDDFF86BD,
+0xDEFF87BE, 0xDDFF88BF, 0xDEFF89BE, 0xE0FF8CBF, 0xE1FF8FC0, 0xE1FF92C0, 0xE2FF96C1, 0x04E899C2,
+0x9EC2E440, 0x400004FF, 0xFF9EC0E3, 0xE2310004, 0x00209CC0, 0xC1DE24F1, 0xBAD2FF94, 0xCADAFF90,
+0x9DA6FFAD, 0x4745FF9A, 0x4F3EFF5F, 0x4234FF80, 0x8E96FF6C, 0xBED6FF95, 0xBADAFFAA, 0xBFE3FF8F,
+0xC1E3FF89, 0xC1DFFF86, 0xF1064888, 0xACCDDE0C, 0xF4FFFFFF, 0xF3FBFEFF, 0x8FA4B5FF, 0x89A4B9FF,
+0xDFF4FFFF, 0x8DA7C0FF, 0xE3A21934, 0xDFFF8ABB, 0xDDFF88BD, 0x001E34BD, 0xDDA01E38, 0xDFFF8ABC,
+0xDDFF8ABC, 0xB01E1CBC, 0xBDE1FF8A, 0xBEE1FF87, 0xB8E0FF86, 0x8BBD4F00, 0x0004DEFF, 0x00340000,
+0x0900040F, 0x89BBDC4F, 0x050020FF, 0x0F001C00, 0x0F120004, 0x010C0180, 0x5C040654, 0x00080F06,
+0x05CC0000, 0x19F0DD10, 0x020AC407, 0x7400051C, 0x00040610, 0x02050C00, 0x20000004, 0x00040405,
+0x001F1802, 0x04040360, 0x03700000, 0x00000400, 0x04010394, 0x20080300, 0x0C050804, 0x040808E4,
+0x04440405, 0x00181C04, 0x10040008, 0x0F280405, 0x0005080C, 0x040004F4, 0x13DC0400, 0x0304F805,
+0xE8046FF4, 0x04FC0409, 0x0004F400, 0xE8000004, 0x00040009, 0x0804F400, 0xF4090004, 0xF0B01204,
+0x0A900151, 0x0009EC00, 0x68030004, 0x09DC0627, 0x021D7C00, 0xC8000ACC, 0x05E00605, 0x0009E00B,
+0x04030EB0, 0x04D00900, 0x0304F004, 0xC0050008, 0x10600304, 0x0F014401, 0x0408000C, 0x80040690,
+0x10B00401, 0x81B9DA40, 0x000004FF, 0x0000018C, 0xCCDD1004, 0xB6A7F134, 0xC5E0FF84, 0x4858FFA0,
+0x2122FF31, 0x0B03FF1D, 0x0A01FF12, 0x2015FF14, 0x1909FF2E, 0x4331FF2A, 0x2311FF5A, 0x3522FF42,
+0x1E0AFF56, 0x3E2AFF3D, 0x3D28FF5D, 0x2C18FF5C, 0x281CFF45, 0x2F23FF3A, 0x3222FF3B, 0xEDDBFF3E,
+0xAB9BFFF8, 0xBEB2FFB2, 0xA39AFFC4, 0xEEE8FFA7, 0xE6DFFFED, 0xDDDBFFD9, 0xB3B7FFCA, 0xCDD3FFA0,
+0xDADEFFBA, 0xB9BBFFC8, 0xBBBFFFA7, 0xE0E4FFA9, 0x8387FFCD, 0xB1B1FF6B, 0x514CFF99, 0x8A85FF3C,
+0x7F80FF75, 0x8185FF6B, 0xFFFFFF6F, 0x7B7DFFF5, 0x464CFF70, 0x666CFF39, 0x2C30FF59, 0x2F34FF21,
+0x3038FF20, 0x7081FF19, 0xC9E5FF4F, 0x2214D89A, 0x1778BCE4, 0x00088004, 0xDF311814, 0x0A0482BD,
+0x0F04C802, 0x08030964, 0xAC02001C, 0x08D80208, 0x0A000C06, 0xF80008BC, 0x00040803, 0x0008A000,
+0x14080004, 0x000C0400, 0x0003FC00, 0x040F0424, 0xB8001500, 0x00040405, 0x8ABFDF41, 0x700004FF,
+0xE0FF8BC0, 0xACFF8CC1, 0xC2E2B10E, 0xC4E3FF91, 0xC3E3FF91, 0x001EE092, 0xC000A958, 0x0004021D,
+0xDEFF94D1, 0xDEFF93BE, 0xDDFF96BD, 0x0A2094BD, 0xBFDA20F1, 0xC1DAFF8C, 0xBAD0FF8F, 0xBBD0FF90,
+0x97A0FFA5, 0x4B3FFF9A, 0x4B39FF73, 0x2D2AFF7A, 0xA1AFFF49, 0xBDDCFFA5, 0xBCE3FFA4, 0xBDE0FF90,
+0xF009C88B, 0x87B7CE0F, 0xB3D7E5FF, 0xE8F3F5FF, 0xF1FBFDFF, 0x8BA2B4FF, 0x84A0B6FF, 0xE1F6FFFF,
+0x34A6BEFF, 0xFF96511E, 0xD08ABCE1, 0xBDDA7104, 0xBEDDFF8A, 0x0006708B, 0x04000040, 0xBDDE3100,
+0x00001C8C, 0xE03200FC, 0x00C488BE, 0xFF8CBE4B, 0x0F0004DF, 0x00010510, 0x180F0024, 0x14040100,
+0x00200000, 0x04000400, 0x080F0010, 0x7C0F1100, 0x280F1501, 0xD4000500, 0x00040005, 0x0401E400,
+0x88020004, 0x0250020A, 0x0A033C00, 0xA8000004, 0x00040615, 0x06051402, 0x10000A30, 0x038C0000,
+0x00039804, 0xD4050390, 0x2E300B03, 0x00050C00, 0x30000A14, 0x05080014, 0x04044000, 0x0C040004,
+0x0E500605, 0x11517800, 0x08568876, 0xF8000A10, 0x09F0007F, 0x00000400, 0x680004FC, 0x00040045,
+0x0409F004, 0xF40404F8, 0x74F00009, 0x00000400, 0x040109E4, 0x61700300, 0x0813D400, 0xDC010004,
+0x04F00313, 0x1309E802, 0x004CEC7A, 0xA4083820, 0x04FC0218, 0x0004F804, 0xD8000ED0, 0x00040500,
+0x1404F40B, 0x032FE8D8, 0xA0000008, 0x00040F04, 0x014C0009, 0x00000400, 0x040F0158, 0x18000100,
+0x00040009, 0x04001C04, 0x100417B4, 0x06CC0000, 0x00004000, 0xC0001C60, 0xD700F111, 0x34FF95BD,
+0x17FF0D24, 0x06FF1216, 0x0F00150E, 0xF136C800, 0x2615054C, 0x4A3522FF, 0x482915FF, 0x583724FF,
+0x4B2C18FF, 0x563723FF, 0x563722FF, 0x4D3221FF, 0x3A281EFF, 0x21140BFF, 0x281F0EFF, 0xEDE6D4FF,
+0x858273FF, 0xE4E4D8FF, 0xD8DBD2FF, 0xDFEAE4FF, 0xBED7D4FF, 0xB4D0D1FF, 0xA0B5BAFF, 0xC3D6DAFF,
+0xB8CCCDFF, 0x9DAFAFFF, 0xC6D2D2FF, 0x1AB113F4, 0x85FF0011, 0x52FF667D, 0x14004252, 0x6E751FF2,
+0xEAF1FF5D, 0x6569FFD7, 0x3236FF52, 0x2D34FF1F, 0x4C55FF1E, 0x2D34FF42, 0x2F39FF24, 0x697DFF1E,
+0xCBE4FF4A, 0xBDDCFF9F, 0xC0E2FF86, 0x9800028C, 0x1C9C0002, 0x6F170400, 0xFF89BFE1, 0x097CBDDF,
+0x02F00F07, 0x00180F05, 0x049C0409, 0x0D00080F, 0x0304B801, 0xA40F04C0, 0xC4000103, 0x00040403,
+0x04002004, 0xE0440010, 0x04FF8DBF, 0xC0E13100, 0x1309F08E, 0xC009F4DE, 0xFF93C1E2, 0xFF8EC3E3,
+0xFF8DC2E2, 0xDF71001C, 0xDEFF8EBF, 0x0A188DBE, 0x8AC0DC41, 0x210004FF, 0x18CC8DBE, 0x000A2C00,
+0x40F10010, 0xFF8ABDD8, 0xFF8FBED8, 0xFF94BBDA, 0xFFAFC1D7, 0xFF7F7073, 0xFF6D4B41, 0xFF673B2E,
+0xFF5D3F3D, 0xFFA9ADC8, 0xFF9BB5DA, 0xFF96B8DB, 0xFF95BEDC, 0xFF91BDD6, 0xFFB7DBEB, 0xFFEAF5F9,
+0xFFF2FBFF, 0xFF87A2B5, 0xFF86A5BA, 0xFFE0F5FF, 0x308CA5BB, 0x04E80023, 0x31193000, 0x748CBED9,
+0x2E680000, 0x8ABFE140, 0x000004FF, 0x94002840, 0x00D00100, 0x0B010400, 0x180104F8, 0x00140F00,
+0x011C0014, 0x0900300F, 0x0D00200F, 0x00003C0C, 0x040F0030, 0x78041500, 0x0030000A, 0x00000C04,
+0xCC040008, 0x050C0A0B, 0x000C200A, 0x04060354, 0x0A0C0000, 0x0405000A, 0x0800037C, 0x037C0000,
+0x04000404, 0x040503E8, 0x08F40304, 0x040A1C00, 0x40000430, 0x00040004, 0x00050804, 0x0C000008,
+0x05080005, 0x000A0C05, 0x20031374, 0x04F80414, 0x0004FC01, 0x68037644, 0x04F80C45, 0x0809F404,
+0xEC0104FC, 0x0ED80409, 0x0113D80B, 0x700056DC, 0x18BC0F2C, 0x04EC0400, 0x0005BC00, 0x040005B8,
+0x000C0000, 0x00000400, 0xD00000C8, 0x00040500, 0x000EC807, 0x040409CC, 0x00080C01, 0x0C012404,
+0x44000008, 0x00040F01, 0x17400009, 0x02018C02, 0x58000BAC, 0x0E140A1C, 0x0106AC03, 0x0BF02654,
+0xC8E2FF88, 0x1928FFA0, 0x1010FF00, 0x0D05FF0A, 0x1109FF14, 0x190FFF1E, 0x0F00FF2A, 0x2B1848F1,
+0x3B27FF40, 0x321FFF5A, 0x3422FF53, 0x2917FF53, 0x3926FF48, 0x3626FF5A, 0x1E17FF53, 0x120AFF32,
+0x2D1DFF1F, 0xDFCEFF34, 0xAFA1FFE2, 0xE1D5FFAD, 0xCBC2FFDB, 0xEBE5FFC1, 0xBEBFFFDA, 0x9FA3FFA2,
+0xD7DCFF82, 0xCCD0FFC2, 0x7679FFBA, 0xC0C1FF67, 0x8B89FFB2, 0xF127E47F, 0x485A6628, 0x283B49FF,
+0xAEBDC0FF, 0x99A7A8FF, 0x74858DFF, 0x2B3E45FF, 0x1E3137FF, 0x26393FFF, 0x273840FF, 0x384953FF,
+0x142634FF, 0x587185FF, 0xA3C8E3FF, 0x8BB9DAFF, 0x2C001258, 0x02980001, 0x8CC1E131, 0xE5312168,
+0x0DA08BC1, 0x0F0D2000, 0x0F0D04AC, 0x08190020, 0x0C0404D8, 0x00400800, 0x09001404, 0xEC0F0008,
+0xE0040003, 0x00080004, 0x0004C800, 0x0C000004, 0x00040C00, 0x8DC0DF40, 0x0004E4FF, 0xDF721D98,
+0xDEFF91BE, 0x09508FBD, 0x0889C022, 0x005C0100, 0x70050000, 0xC1DEFF8A, 0x04DCFF88, 0x8AC03000,
+0x011DFCFF, 0x2BF1003C, 0xDFFF8BC0, 0xE3FF8BC0, 0xE1FF90C2, 0xD9FF8FBD, 0xCBFF99BA, 0x5DFFB3BC,
+0x25FF695D, 0x41FF5733, 0x5CFF6F4A, 0xDAFF5C50, 0xD6FFB9C0, 0xD5FF9FB8, 0xD0FF94B7, 0xF1FF8FB7,
+0x4600C0DF, 0xEBF103F0, 0x9EB2FFE0, 0xB1C7FF7F, 0xF3FFFF8E, 0xA6BAFFDE, 0x9511055C, 0xDCA009CC,
+0xD8FF91C0, 0xDDFF8DBF, 0x700AA0C1, 0xC0E4FF8A, 0xACE2FF8A, 0x8EBF610A, 0x90BEDFFF, 0x840000B8,
+0x00D40C00, 0x0C001000, 0x14000498, 0x00040F00, 0x00280C01, 0x5500100F, 0x0F04F400, 0x10060004,
+0x111580BE, 0x04026088, 0x0C040BE8, 0x00080805, 0x00078C00, 0x7C080004, 0x0A280403, 0x0103B00F,
+0x0003D808, 0x040402D0, 0x0A1C0400, 0x00043004, 0x04000440, 0x04540000, 0x00000404, 0x3C000504,
+0x0504001E, 0x01000400, 0x68030508, 0x59440037, 0x0009F000, 0xEC000004, 0x22BC000E, 0x00000400,
+0x040004F0, 0x13DC0400, 0x0004F80D, 0x040018CC, 0x04F80F00, 0xB2D92400, 0xEC0A51D8, 0x04F80809,
+0x0100A400, 0xB7210004, 0x042C607C, 0xD00400C0, 0x00080500, 0x080EBC03, 0x0C020100, 0x103C0000,
+0x11000400, 0x0F2F5C82, 0x0F010134, 0x04010014, 0x08060164, 0x04E00300, 0x22211C00, 0x0E1084BB,
+0x34BCBC10, 0xDBFF8551, 0x175485BC, 0x0101A400, 0xA7F115C8, 0xDBFF8BBC, 0x76FF99C1, 0x08FF4D67,
+0x05FF0009, 0x00FF120E, 0x15FF1506, 0x06FF311F, 0x23FF2614, 0x25FF4934, 0x20FF5839, 0x1AFF5633,
+0x10FF4B2C, 0x23FF4122, 0x13FF5936, 0x0FFF4222, 0x06FF2A16, 0x5BFF190C, 0xA3FF7068, 0xC5FFB4B2,
+0xD9FFCFD3, 0xCEFFD8E2, 0xD6FFC6D5, 0xA4FFC5D8, 0xC6FF8CA1, 0xCBFFABBF, 0x5DFFB3C4, 0xE3FF4C5A,
+0x8AFFD8E0, 0x1FFF7E88, 0x99FF0D1F, 0x3BFF8295, 0x4BFF1B2B, 0xB6FF2B3B, 0x79FFA0B2, 0x6FFF667A,
+0x40FF556A, 0x45FF273A, 0x3BFF323F, 0x3CFF2736, 0x32FF1F33, 0xB6FF0724, 0xE6FF799F, 0xD9FF9FCB,
+0xE0FF8CBB, 0xDDFF91BF, 0x04188FBC, 0x00131800, 0x0800048C, 0x04800005, 0x0007AC00, 0x0C0002C4,
+0x00040F00, 0xECE01041, 0x04600003, 0x0F08E400, 0x0F080004, 0x080103D8, 0xE1110014, 0xD40009DC,
+0x00040213, 0x8EBFE044, 0x000004FF, 0xC0000440, 0x04640004, 0x2104FC01, 0x09648FBD, 0x710ADC00,
+0xFF8EBEE2, 0xF891BDE0, 0x0470011D, 0xFF8AC161, 0xF08AC3E0, 0x00380004, 0xF1004400, 0x8DBFE200,
+0x8ABEE3FF, 0x8CBEE3FF, 0x91BFE3FF, 0xD8B109BC, 0xD4FF9CC0, 0x5CFFB7CB, 0x24B86965, 0x433808F1,
+0x5C5DFF59, 0xC0D8FF65, 0xBFDDFFAC, 0xB8CFFF9C, 0xE5F6FF98, 0xF1641CCB, 0xD8E6F104, 0x779AAEFF,
+0x9CC0D6FF, 0xDCF3FFFF, 0x8FAABBFF, 0xC0002D2C, 0x23340000, 0xF00F5C00, 0x8CC2DE01, 0x8AC3E1FF,
+0x8AC2E5FF, 0x8CC0E5FF, 0x0000D0FF, 0xDE400198, 0xB8FF91C0, 0x0198000A, 0x0C001400, 0xA0000004,
+0x00040800, 0x0D00200F, 0x0F002C08, 0x061B000C, 0xB8000B50, 0x00040F00, 0x055C0F05, 0x01EC0B16,
+0x00027400, 0xF0000004, 0x0510040F, 0x00000801, 0xBD211510, 0x0407A088, 0x10000518, 0x11700005,
+0x02039C06, 0xC80C0894, 0x04000203, 0x0303F803, 0x30041420, 0x04480404, 0x10045C01, 0x002D6CB6,
+0x68021D34, 0x05080032, 0x04000400, 0x0C000A10, 0x0EE80005, 0x04000400, 0xF40009F0, 0x00040404,
+0x007A0800, 0xE80113DC, 0x75AF310E, 0x006AFCFF, 0xF8006680, 0x13DC0404, 0x210EE400, 0x574479B0,
+0x0409F400, 0xC00404FC, 0x00080418, 0x0004FC08, 0xA80409E8, 0x00080100, 0x047DB829, 0x1378001F,
+0x010FF800, 0x78000008, 0x00040309, 0x0001080A, 0x04000B38, 0x0B3C0A00, 0x08013C0C, 0x5C000010,
+0x00040E01, 0x031C3803, 0x200115DC, 0x1D180000, 0x21001004, 0x2FD08ABC, 0x00183C00, 0x10F10508,
+0xFF8DB9D6, 0xFFABC8DA, 0xFF0F171A, 0xFF0D0802, 0xFF120500, 0xFF33221A, 0xFF1D0B00, 0xCC452F21,
+0x2F1CB13B, 0x2715FF50, 0x1F0DFF46, 0xF005103C, 0x381D0C5F, 0x220F09FF, 0x6B605CFF, 0xC5C1B6FF,
+0x55574AFF, 0xA7AFA4FF, 0xB0BDB4FF, 0xBAC9C4FF, 0xBBCBCAFF, 0x96A5AAFF, 0xCDDEE5FF, 0x91A0A7FF,
+0xEBF8FEFF, 0x99A0A8FF, 0x091217FF, 0x53686BFF, 0x263E42FF, 0x243443FF, 0x495764FF, 0x5E7273FF,
+0x2F4543FF, 0x1D3235FF, 0x23383DFF, 0x1D3037FF, 0x142833FF, 0x294654FF, 0x92B8CBFF, 0xE0C5E1FF,
+0x84881112, 0x04140008, 0x92BDDD31, 0x0800D050, 0x09480022, 0x0040F800, 0xD0000434, 0x02EC0002,
+0x0F000800, 0x10120500, 0x12185CBE, 0x000E7C8B, 0x880004DC, 0x04E00F0E, 0x04F80400, 0x01005C00,
+0x2803000C, 0x00100F00, 0x001C0002, 0x0E00040F, 0x0304F007, 0xF40004FC, 0x03E40009, 0x0004C800,
+0x000000CC, 0x04540014, 0x92C0E231, 0xE2200EFC, 0x110508C1, 0xF1188C91, 0x95BDE100, 0x92BFE0FF,
+0x8EC1E0FF, 0x8DC2E1FF, 0x74000008, 0x00300004, 0xF1004400, 0x8FC1E644, 0x90C2E7FF, 0x8FBCE3FF,
+0x92BEE1FF, 0x92BFDCFF, 0x9ABFD1FF, 0xB5C8CCFF, 0x6B6C64FF, 0x564535FF, 0x4B3A30FF, 0x676E76FF,
+0xB4C7D8FF, 0x9FB6C6FF, 0xD3E6F5FF, 0xEEFAFFFF, 0xC5D5E4FF, 0x7596A9FF, 0xA6CBDDFF, 0xDBF5FFFF,
+0x91AEBEFF, 0x93C1DBFF, 0xDBB10064, 0xD8FF90C2, 0xDCFF8FC1, 0x14A08EC1, 0x8EC0E540, 0x000004FF,
+0xFC00007C, 0x0A200004, 0x5F000400, 0xFF90C1E1, 0x000004E2, 0x0F04F00C, 0x00050010, 0x1C0F003C,
+0x180F0500, 0x98011100, 0x01840301, 0x00015000, 0x08020010, 0xFF8E2000, 0xB0000008, 0x0224010F,
+0x0528BE1F, 0x01A8000D, 0x0200240E, 0x8C30003C, 0x0240E1FF, 0x488BBD21, 0x10200015, 0x00000408,
+0x44000520, 0x115C0014, 0x04050C02, 0x9C000F30, 0x05040208, 0x0A03C804, 0x83190404, 0x040F3840,
+0x240F0905, 0x0C000114, 0xACD14405, 0x0004FF70, 0x00765000, 0xF8007ECC, 0x04F40004, 0x006C5C00,
+0xF8000008, 0x3B080004, 0x9CB1D320, 0xFF793046, 0x1465D4D4, 0x0027A0B2, 0xC40265CC, 0x0050001D,
+0x0404F000, 0x880104EC, 0x1DA0030F, 0x01059000, 0xD00304EC, 0x0ECC000E, 0x0100B000, 0x28001D64,
+0x14DC0057, 0x52187400, 0xD8FF82B8, 0x0005DCB9, 0xF800343C, 0x2AD00100, 0x0B2AD804, 0xA4010008,
+0x09A80009, 0x0500040F, 0x0004C803, 0xFC001AC8, 0x00040F08, 0xA4BB1006, 0xB4891120, 0x17DC0020,
+0x710E1C00, 0xFF8CBADB, 0xB48DBADB, 0xBEE3201B, 0x841125B4, 0x90F10214, 0xFFA7CADE, 0xFF141D24,
+0xFF0E0808, 0xFF0D0200, 0xFF271813, 0xFF291610, 0xFF2D160E, 0xFF482C20, 0xFF482819, 0xFF412412,
+0xFF6E533E, 0xFF7E654F, 0xFF210E00, 0xFF291C13, 0xFF2F2822, 0xFF4E4F49, 0xFF5F665F, 0xFFDEEBE4,
+0xFFCDDCD5, 0xFFBBC7C3, 0xFFB9C5C3, 0xFFA1AFB0, 0xFFAEBDC2, 0xFFDAEBF2, 0xFF9DAEB8, 0xFF0A1B25,
+0xFF30414B, 0xFF80949B, 0xFF2D4247, 0xFF293C42, 0xFF243638, 0xFF253737, 0xFF213333, 0xFF1F3135,
+0xFF152B36, 0xFF102F41, 0xFF6D93AA, 0xFFA5CDE6, 0xFF97C3DC, 0x808ABCD7, 0x02BC0003, 0x00126801,
+0x04000D70, 0x0E0C0100, 0x11176808, 0x0405248D, 0x080402A0, 0x03000000, 0x04000408, 0x080E0018,
+0x02F00203, 0x0F006800, 0x00020004, 0xC0210074, 0x0013A08D, 0xF800047C, 0x00080D03, 0x208FC022,
+0x00080F00, 0x09300414, 0x00000804, 0x5800043C, 0x00080000, 0x011DF401, 0x90261DF8, 0x110010FF,
+0x002C9093, 0xDF4636BC, 0x04FF90C1, 0x14921100, 0x0018001F, 0x00048C00, 0xE9710044, 0xE7FF90C1,
+0x13E491C1, 0xBED80CF1, 0xC5DBFF99, 0xC8D6FF9C, 0x6C6AFFAC, 0x3528FF6C, 0x4536FF43, 0x736AFF55,
+0x312E787C, 0x24DCEEFA, 0xDD18F173, 0xA6FFBACB, 0xECFF7B98, 0xFFFFBEE0, 0xC0FFDCF6, 0xDDFF8FAE,
+0xDFFF94C3, 0xDFFF8DC3, 0xD9FF91C4, 0xD9FF90C2, 0x8D6893C1, 0x96BDE450, 0x3748E4FF, 0xFF8FC262,
+0x1C8DC3DB, 0x94C21000, 0xB0921200, 0x00BC001E, 0xB492C021, 0x059C020B, 0x000C9111, 0x0300D805,
+0x100D0020, 0xF0C11300, 0x00080F00, 0x00E00008, 0x01000405, 0x94000590, 0x00040305, 0x04017C07,
+0x08010158, 0xA0BF1300, 0x91BF220A, 0x080301A4, 0x05540C00, 0x03005805, 0x10000020, 0x06A00000,
+0x00000404, 0x040F0664, 0x58000900, 0x158C0002, 0x01000800, 0xBD211A2C, 0x001F388B, 0x10000CA0,
+0x00040005, 0x0003B404, 0x0C0403C4, 0x04180004, 0x0808AC00, 0x18040510, 0x0F1C040A, 0x01000804,
+0x74000478, 0x048C0747, 0x00049C00, 0xC004225C, 0x00080083, 0x0004F804, 0xDC0004EC, 0x04F80013,
+0x0018D400, 0x60000010, 0x22B80070, 0x10000400, 0x2704FCD5, 0x2CA07BB1, 0x0060C002, 0xFC0F0500,
+0xB7100A04, 0x30024350, 0x0500013D, 0x3E60B710, 0x041D6802, 0xFC0000BC, 0x04F80004, 0x04000404,
+0x080400F0, 0x04F00F00, 0x0508040E, 0x0404F803, 0x080C013C, 0x01580000, 0x61000405, 0xDCFF8ABC,
+0x204C8BBC, 0x00181400, 0x80002154, 0x2B380001, 0xA1094001, 0xE2FF8CBA, 0xE6FF85BD, 0x019C87C1,
+0xC2D98CF1, 0x3D49FF9C, 0x090CFF31, 0x0202FF0B, 0x0F0BFF08, 0x231DFF1A, 0x1C15FF36, 0x1D11FF35,
+0x1707FF39, 0x4D38FF34, 0x7F68FF68, 0x1B07FF95, 0x1707FF2D, 0x1108FF24, 0x1D18FF1A, 0x3532FF20,
+0x8B8AFF33, 0xDCD9FF82, 0xDEDBFFCD, 0xD9D6FFCE, 0xDEDCFFCA, 0xA3A3FFD2, 0xC0C3FF95, 0xBAC1FFB1,
+0x272EFFA9, 0x414DFF14, 0x818DFF2F, 0x373EFF6F, 0x3B41FF24, 0x3E3DFF28, 0x3938FF2A, 0x2F30FF25,
+0x2A30FF1B, 0x303AFF17, 0x7D8EFF1E, 0xC9E3FF63, 0xC7E4FFA4, 0xBEDAFF9A, 0xBBD7FF8F, 0x0003E48C,
+0x74001310, 0x1D140021, 0x0A04CC08, 0xC000000C, 0x00040004, 0x0007B40E, 0x2C000028, 0x0004020A,
+0x000E7802, 0xDC0002F8, 0x00080C02, 0x01001400, 0x580404D8, 0x03500703, 0x03001C01, 0x94010010,
+0x03A40F04, 0x00240F00, 0x003C0011, 0x0004BC06, 0x04060434, 0x04100D00, 0x00042803, 0x040804DC,
+0xC2E04C00, 0x0004FF93, 0xC2DE04F1, 0xC4DBFF93, 0xC4DFFF94, 0xC3E8FF92, 0xC2E8FF91, 0xF10F0492,
+0x96BFDD2C, 0x91C3E4FF, 0x9AC3DFFF, 0xB4C8D3FF, 0x93948FFF, 0x493A27FF, 0x988871FF, 0x7B7567FF,
+0xFAFFF9FF, 0xEBF6FCFF, 0xB2C4D2FF, 0x8198A6FF, 0xD2ECFBFF, 0xDBF2FFFF, 0x94B3C7FF, 0x90013360,
+0x8EC4210A, 0x0FF20058, 0xFF95C2D9, 0xFF98C0DA, 0xFF98BEE3, 0xFF95BFE5, 0xFF90C3E2, 0xFF8DC5DE,
+0xFF91C3DA, 0x0094C3DA, 0x0F19B800, 0x04150004, 0x300400F0, 0x011C0000, 0x1E00040F, 0x248FC222,
+0x01900706, 0x0A016006, 0x4400061C, 0x06240101, 0x2104E000, 0x0FC091BF, 0x04020400, 0xAC080004,
+0x000C0F05, 0x34E11001, 0x00040F00, 0x05280408, 0x00000800, 0x0C0007B0, 0x05080505, 0x04243000,
+0x48002448, 0x03D40029, 0xE085BC21, 0x05000033, 0x08000408, 0x0C000508, 0x04500400, 0x00000800,
+0x6C000508, 0x05080C09, 0x10050400, 0x0013C0D8, 0xEC037E80, 0x0010015D, 0x030ED000, 0xD93218D8,
+0x2CB07AAF, 0xFF7AAF30, 0x0401614C, 0x7CB26100, 0x7DB1D9FF, 0xF0005D94, 0x05480009, 0x21004C01,
+0x36347DB5, 0x0309EC01, 0xAC0009E8, 0x00800019, 0x00000404, 0x04020090, 0x13BC0000, 0x040EBC00,
+0x08000EC4, 0x34841100, 0x2FC8046B, 0x00000800, 0x040805F4, 0x04C80C00, 0x0600100F, 0x08251C0F,
+0x0004DC00, 0x040012FC, 0x60DC1000, 0x20A40001, 0x12209801, 0x2125908C, 0x20A488BF, 0x0052C400,
+0x040039F0, 0x16C0010A, 0x5887BF21, 0xE200F117, 0x5FFFA1C9, 0x0AFF4050, 0x09FF0205, 0x0F080909,
+0x21173CF1, 0x3F2FFF32, 0x1702FF56, 0x1E08FF33, 0x1C06FF3A, 0x1400FF35, 0x0B00FF26, 0x1106FF17,
+0x1B15FF19, 0x2622FF20, 0x5756FF27, 0xAAABFF53, 0xC5C8FFA0, 0xC0C1FFB6, 0xC1C1FFAC, 0xD9D9FFAF,
+0xA6A4FFC9, 0xCCCCFF93, 0x9899FFBA, 0x0013F084, 0x1BF022DC, 0xFF24363A, 0xFF2C3B40, 0xFF2B3A3D,
+0xFF2B3B3B, 0xFF233537, 0xFF374B52, 0xFF768C9A, 0xFFA7BDD4, 0xFFA4C2DC, 0xFF98C1DD, 0x0410BFDB,
+0x3AA09211, 0x0007BC00, 0x50000500, 0x00040002, 0x1104C402, 0x081D108E, 0x3800000C, 0x0004000D,
+0x0C048008, 0x580C000C, 0x03240003, 0x00038000, 0x08020314, 0x00780000, 0x0D00040F, 0x0C035002,
+0x1004047C, 0x00480000, 0x04000404, 0x080003D4, 0x00200400, 0x3900080F, 0x083BC000, 0xF8000004,
+0xDA50F104, 0xD9FF92C5, 0xE0FF90C4, 0xE4FF91C2, 0xE6FF92C3, 0xE6FF95C1, 0xE5FF94C2, 0xE2FF91C1,
+0xDBFF94C1, 0xD7FF9BC0, 0xA7FFAEC8, 0x6BFFA1AA, 0x6EFF8880, 0x81FFAD97, 0xF3FFBBA9, 0xBEFFFEFF,
+0xB5FFAAB9, 0xFFFF92A3, 0xFFFFDEF0, 0xC4FFE1F1, 0xDCFF94AC, 0xE0FF98BF, 0xE6FF90BE, 0xE3FF91C3,
+0x056091C2, 0x95C3DBB1, 0x95C2E1FF, 0x94C2E4FF, 0xE6310568, 0x01AC8FC4, 0x94C3DF31, 0x94000008,
+0x00E80F00, 0x001C0005, 0x0F000400, 0x0F050020, 0x00230018, 0x932F00DC, 0x0D0168FF, 0x0C01E800,
+0xAC060004, 0x0FB80201, 0x0F001004, 0x22260008, 0x0A6090C1, 0x1ABCC010, 0x1A188E11, 0x04050800,
+0xA4000C78, 0x00040003, 0x0408AC04, 0x2C0203F0, 0x12BC0A14, 0x08043000, 0x0C000514, 0x050C0800,
+0x00048400, 0x04000508, 0x050C0000, 0x4704A801, 0xDAFF78AE, 0x00000004, 0x70180105, 0x65701C00,
+0xDAFF7AAF, 0x00047BB0, 0x00664800, 0x04027030, 0x66380000, 0x002C9802, 0x04000048, 0x00540000,
+0x00000400, 0xE0080060, 0x00780009, 0x1104F402, 0x003EA082, 0x3C040094, 0x13540033, 0x00000404,
+0xEC0F00D4, 0xD8000E04, 0x04B40004, 0x07061C04, 0x28000008, 0x00040F01, 0x01640019, 0x00066C00,
+0xDF100004, 0xBE231C3C, 0x2017408D, 0x12BCFF8A, 0x10044800, 0x401214DB, 0xE4FF90BD, 0xD400123C,
+0x2C3C002F, 0x98C203F1, 0x5E7585FF, 0x000C14FF, 0x4D565BFF, 0x060805FF, 0x30F12D0C, 0xFF685648,
+0xFF5D4430, 0xFF482F1B, 0xFF251400, 0xFF251909, 0xFF221C10, 0xFF221F18, 0xFF1B1A16, 0xFF313330,
+0xFF888E8E, 0xFFDEEAEA, 0xFFB5C7C9, 0xFF90A5A8, 0xFFA2B5B9, 0xFFBBCFD0, 0x04869A99, 0x8A24F100,
+0x54FF778B, 0x48FF4155, 0x3DFF3848, 0x3FFF2E3C, 0x42FF323D, 0x3CFF3540, 0x2BFF2D3B, 0x6BFF1527,
+0xE1FF4A5D, 0xDBFFB4CD, 0xDCFFA1BF, 0xDFFF99BC, 0x09FC96C2, 0x2207A401, 0x175493C2, 0x21270800,
+0x025892C3, 0x2004F40A, 0x131CFF8F, 0x0F000402, 0x040F0D38, 0xF8000500, 0x00040604, 0x0004D002,
+0x7C020318, 0x3C911103, 0x04400004, 0x0300040F, 0x0208E402, 0x0C0E002C, 0x03840000, 0x0100040F,
+0x0F03F400, 0x0F110004, 0x0F050058, 0x2211003C, 0x04FCC4DD, 0xB1050000, 0xFF91C3DC, 0xFF92C3E1,
+0x0493C4E5, 0x050C0000, 0x0508E310, 0xFF97C430, 0x24F124F4, 0xFFA6C2CE, 0xFFA6B0A7, 0xFF7D6E47,
+0xFFA89263, 0xFFCDC7A7, 0xFFBCC0B2, 0xFFA4ABB1, 0xFFE6F1FF, 0xFFE4F1FF, 0xFF97ABC4, 0xFF9BBFDF,
+0xFF9AC6E9, 0x2C99C7EB, 0xC5DD7109, 0xC5DBFF91, 0x000F1891, 0x64000094, 0x0004000A, 0x08005C00,
+0x1C000500, 0x00040F00, 0x95C2224A, 0x0800056C, 0x00040800, 0x1005840F, 0x06016408, 0x400201AC,
+0x00100602, 0x0C055002, 0x180F0010, 0x84030E05, 0x077C0C0A, 0x0B0F3402, 0x5C0311A4, 0x14300119,
+0x1E64BD12, 0x04051004, 0x14000008, 0x0004080F, 0x00050404, 0x84000474, 0x18580004, 0x00000400,
+0xAC0004A4, 0x18E00004, 0x00408004, 0x80000008, 0x00040440, 0x7AB1DA40, 0x0818D0FF, 0xDA410004,
+0x04FF7CB3, 0x7DB25200, 0x38B4DAFF, 0x5D500040, 0x0D09E80F, 0x043A6C00, 0xA8000004, 0x00040405,
+0x043E1800, 0x74000004, 0x00040F13, 0x09B40005, 0x04000402, 0x48022F2C, 0x2A50042A, 0x00000800,
+0x040F1044, 0x8C111B00, 0x7400261C, 0x07B4000B, 0x00000400, 0xA8011C14, 0x8BC0D020, 0x8EC1DEFF,
+0x90BDDAFF, 0x38C0DFFF, 0x048B112B, 0xC4E52005, 0x7AF11724, 0xC2D7FF93, 0x4452FFA6, 0x3947FF2E,
+0x1018FF23, 0x0405FF00, 0x6A64FF00, 0x3D32FF71, 0x4134FF4B, 0x0C00FF4F, 0x7165FF16, 0x251DFF75,
+0x231DFF24, 0x302EFF1E, 0x2F2CFF2A, 0x5D5CFF26, 0x9491FF53, 0xBFBDFF85, 0xE6E4FFAC, 0xD5D8FFD0,
+0xBDC2FFC0, 0x9293FFA8, 0x8785FF7D, 0x5553FF71, 0x3F3DFF3F, 0x3A39FF2B, 0x3939FF2A, 0x3839FF2D,
+0x2D2EFF2E, 0x1C1EFF23, 0x2229FF11, 0x1523FF13, 0xBFD7FF00, 0xBEDEFFA3, 0xBEE2FF9B, 0x40009C96,
+0xFF90BFDD, 0x04020004, 0x11B80205, 0x0004BC00, 0x08002C08, 0x00040400, 0x0C2C2000, 0xA0000004,
+0x04CC0002, 0x08000404, 0x0C0002EC, 0x03940000, 0x0F03A800, 0x00050004, 0x04040E44, 0x00240F00,
+0x001C0001, 0x47001809, 0xDFFF95C2, 0xE0400004, 0x04FF94C1, 0x09200000, 0x0900040F, 0x08003408,
+0xA000000C, 0x00040F00, 0xC4E04F09, 0x0004FF95, 0xC4DED105, 0xC6DBFF95, 0xC5DCFF93, 0x04E0FF93,
+0xFF92A000, 0xFF92C6DC, 0xFF92C6DB, 0xB80004B8, 0x4AFC0000, 0xC4E025F0, 0xC2DBFF9B, 0xC6D2FF96,
+0xC5BDFFA4, 0x7C62FFBA, 0x875EFF82, 0xC8A0FF9D, 0xBCA8FFDB, 0xF7F3FFC1, 0xEEF9FFF2, 0xADC5FFE6,
+0xBFDEFF9B, 0xC5E7FF98, 0x2390FF97, 0xC8E605F0, 0xC8E0FF99, 0xC8DEFF8E, 0xC4DBFF8E, 0xC3DDFF92,
+0x04F8FF95, 0x00000400, 0x80000094, 0x00080000, 0x1100040F, 0x0F008C00, 0x4F010004, 0xFF96C3E0,
+0x00110004, 0x38020728, 0x34961101, 0x00100207, 0x0F003C02, 0x0C010058, 0x640C0014, 0x04E80401,
+0x0400CC00, 0x3000001C, 0x00040C02, 0x00025804, 0x040F0268, 0x10071600, 0x0508041A, 0x0007C804,
+0xB800119C, 0x08E80508, 0x00237003, 0x04040A20, 0x09440905, 0x1940BA12, 0x08050000, 0x0C000004,
+0x09980005, 0x0013E800, 0xA4010004, 0x28180031, 0x1C77B121, 0x1E1C0067, 0x1204F805, 0x042CB0B4,
+0xC00013DC, 0x0004041D, 0x08318C00, 0x580004FC, 0x00040800, 0x0009E804, 0xF40504FC, 0x0FC80004,
+0x3C000404, 0xF4FF88BA, 0x04E80204, 0x02342C00, 0xEC020004, 0x04F00000, 0x0F000402, 0x020904E4,
+0xD8000130, 0x00040F12, 0x10B80403, 0x00000800, 0xE4000674, 0x0E340004, 0x0010BC00, 0xA40010AC,
+0x50E3101B, 0x272C0030, 0xFF8EC150, 0x16C0C0DD, 0x02B89311, 0x00056400, 0x7CF1262C, 0xFF90BDDC,
+0xFF95B9D1, 0xFFAACADF, 0xFFACCFE5, 0xFFAECADF, 0xFF9BADBB, 0xFF616A71, 0xFF3B3C3E, 0xFF201F1B,
+0xFF171812, 0xFF61665F, 0xFF1F2823, 0xFF242F2B, 0xFF2C3836, 0xFF263232, 0xFF7C8B88, 0xFFE3F3F0,
+0xFFA9BCB6, 0xFF9BAFAD, 0xFFAABFC2, 0xFF9DB5B9, 0xFF71898B, 0xFF809898, 0xFF4D6565, 0xFF233736,
+0xFF2D3D3D, 0xFF222D2F, 0xFF242C2F, 0xFF10181B, 0xFF1C252A, 0xFF1D2B34, 0xFF162D3D, 0xFF55758C,
+0xFF9EC5E6, 0x9896C2E5, 0xC6E43100, 0x0012DC97, 0xE2800504, 0xE3FF93C4, 0xE8FF94C5, 0x04F80004,
+0x0F050400, 0x00050004, 0xB00C08F0, 0x00100C02, 0x0F03080C, 0x01290010, 0xB00703E8, 0x03900003,
+0x0104F40F, 0x96C3E24C, 0x0F0004FF, 0x4F0503E4, 0xFF95C4E2, 0x01090004, 0x040B0074, 0x1F240005,
+0x71000400, 0xFF96C5DF, 0x0498C6DE, 0xC6E15000, 0x0CE0FF94, 0xC606F00F, 0xC7D7FF93, 0xC7DCFF92,
+0xC6DDFF93, 0xC5DEFF94, 0xC9E4FF99, 0x1AF14130, 0xBFD8FF93, 0xD7E1FF93, 0xFFF6FFBF, 0xA587FFFA,
+0x6542FFB8, 0xB69BFF7F, 0xF4E6FFCA, 0xF3F5FFFF, 0xA5B5FFF3, 0xC4DFFF95, 0x3101949F, 0x3CA0CBEB,
+0xE108F107, 0xDFFF90C8, 0xDDFF8FC9, 0xDDFF97C5, 0xE3FF9AC4, 0xE3FF98C3, 0x1FA897C4, 0x94C6DF40,
+0x000084FF, 0x040C008C, 0x00B80400, 0x04001804, 0x080D0010, 0x01500700, 0x0301240F, 0xE0FF974B,
+0x430004C3, 0xE0FF99C2, 0xE1350004, 0x062097C4, 0x0C01DC08, 0x64080068, 0x04F00001, 0x0404F804,
+0x14000018, 0x00040400, 0x0002440C, 0x30040010, 0x00080405, 0x0D050C0F, 0x00119C00, 0xA8000004,
+0x00040603, 0x0811C802, 0x0C010504, 0x38440005, 0x0405080B, 0x0C040504, 0x0A08000A, 0x00000408,
+0xA800050C, 0x18D80404, 0x0031A404, 0x9C040008, 0x75480036, 0x00000400, 0x04003B78, 0x3B740000,
+0x0004F000, 0xE00F0004, 0xDC000F0E, 0xFF832F13, 0x040104F4, 0x080005A8, 0x04EC0C00, 0x00392000,
+0xC4000468, 0x0004003E, 0x04100C00, 0xD0000004, 0x00040812, 0x0004C000, 0x08000010, 0x00040800,
+0x0503F800, 0x10030004, 0x01700F17, 0x0DD40001, 0x8FC2DD50, 0x2B00DDFF, 0xFF93C0C0, 0xFF93BFE2,
+0xFF90C0E6, 0x302140E4, 0x1CFF8DC2, 0xBDD78000, 0xC3DEFF8F, 0x04F4FF97, 0x97C5E640, 0x01009CFF,
+0xC2210008, 0xF14E1C99, 0x94BFDF6C, 0x9CC5E5FF, 0x9DC0DCFF, 0xA8C4DAFF, 0xB7CDDBFF, 0xBACBD3FF,
+0x121D21FF, 0x626E6EFF, 0x576565FF, 0x2B3939FF, 0x304040FF, 0x2B3D3DFF, 0x8B9E9CFF, 0x7A8D89FF,
+0xA3B4ACFF, 0xACBFB9FF, 0xB1C4C8FF, 0x9EB5BBFF, 0x566F73FF, 0x4E676BFF, 0x334C50FF, 0x475C61FF,
+0x26373EFF, 0x263039FF, 0x333A42FF, 0x131720FF, 0x2C333BFF, 0x223039FF, 0x193340FF, 0x2F5265FF,
+0xA8D4EDFF, 0xF40035C4, 0x07640004, 0x00028800, 0x08000508, 0x00140000, 0x020A0C00, 0x18004EB4,
+0x00040F14, 0x12840209, 0x0F02FC08, 0x0C19000C, 0x100F0328, 0xD00F0D00, 0xC4210E03, 0x04041C95,
+0x080F0028, 0x68003500, 0x00040804, 0x0634E010, 0xE498C621, 0x09E00018, 0x044AE800, 0xDE200490,
+0xB006DCC7, 0xC9DEFF93, 0xC4D8FF95, 0xB8DAFF94, 0x98C7A109, 0x99C1DAFF, 0xC1D9E5FF, 0x24F163F8,
+0xFFE0E0E2, 0xFFAE9F9A, 0xFF502B19, 0xFF825F4C, 0xFFEBDED8, 0xFFA7B2B8, 0xFFA4C4D9, 0xFF98C4E1,
+0xFF96BEE1, 0xFF9CC7E9, 0xFF95C7E2, 0xFF95C7E0, 0x709BC5DE, 0x50580041, 0x99C4E640, 0x0001ACFF,
+0x94020018, 0xFF973000, 0x0F0A34DF, 0x00000004, 0x04080098, 0x00280400, 0x04001404, 0x080F0010,
+0xC4400600, 0x04DFFF98, 0x9AC32600, 0xFC0100EC, 0xFF9C9541, 0xFF9CC5E1, 0x7C99C5E0, 0x4D1C0000,
+0x02000404, 0x96150098, 0xD80C018C, 0x02680001, 0x0C000404, 0x4008001C, 0x05140402, 0x0000080C,
+0x04010514, 0x0C000300, 0x02156C00, 0x48020004, 0x03B0090F, 0x000A1007, 0xE404050C, 0x04FC0108,
+0x0DC4BF12, 0x0012C400, 0xF8000004, 0x0004001B, 0x000A1008, 0x10040468, 0x00080405, 0x00137400,
+0x3C00099C, 0x88A80089, 0x00000400, 0x04047B6C, 0x04F80000, 0x02000400, 0x7F407050, 0x60B5D7FF,
+0x1DB00066, 0xD9FF8240, 0x0222A0B7, 0x440018C0, 0x054C0005, 0x08000400, 0x78040560, 0x00700405,
+0x00000800, 0x04040088, 0x00A00000, 0x00000400, 0xB80009DC, 0x00080000, 0x000E8800, 0xF00409DC,
+0x00080004, 0x0404E000, 0xE40F0004, 0xC8000504, 0x04F00004, 0x00128000, 0x080408F8, 0x08E00000,
+0x00067000, 0x080F0168, 0x04000500, 0x00040012, 0x22017C00, 0x16F8C0E3, 0x0109E400, 0xC3221BA8,
+0x214E0090, 0x0A0894C0, 0x2001C400, 0x5814C4E4, 0xE4FF8E20, 0x00580001, 0x93C3E771, 0x8EC0E3FF,
+0xF80016DC, 0xD914F102, 0xDDFF9DC1, 0x46FFB0CD, 0x40FF253B, 0x6AFF2A3C, 0x4DFF5867, 0x3AFF3D4D,
+0x50FF2638, 0xB3FF3B4F, 0x3BE8A0B4, 0xF1EB34F1, 0xCFCCFFE0, 0x7A7BFFBF, 0x999EFF66, 0x6569FF84,
+0x9598FF4C, 0xBEC2FF79, 0x6068FFA2, 0x3440FF49, 0x3E4AFF22, 0x3341FF32, 0x222EFF2D, 0x363FFF1C,
+0x323DFF2D, 0x3E49FF24, 0x2838FF23, 0xD2E7FF04, 0x31083CA5, 0x0097C6E2, 0x009C0009, 0x04009000,
+0xE331050C, 0x21E496C5, 0x00001800, 0x0C0017E8, 0x00080801, 0x00000C00, 0xC40F0004, 0xD40C0502,
+0x00100802, 0x08049408, 0x0C080018, 0x00240800, 0x29000C0F, 0x0000E001, 0x040F00E4, 0xF0022C00,
+0xFF972A04, 0x98950008, 0x9CC5E3FF, 0x9DC4E3FF, 0xB0000408, 0xE207F004, 0xDFFF96CA, 0xDDFF93CA,
+0xDCFF94C8, 0xDEFF99C8, 0xE2FF9AC7, 0xF05008C5, 0xE8FF9C24, 0xFFFFC1D8, 0xDEFFEAFA, 0xC7FFBBCC,
+0xC2FFB9BB, 0x33FFE6CB, 0x4AFF6541, 0x91FF6750, 0xCDFF9C92, 0xD1FFC5C8, 0xDBFFB4C1, 0xE3FFA6C0,
+0xE1FFA0C3, 0xC7501408, 0xC4DEFF98, 0x9C114670, 0xE4315054, 0x555498C5, 0x001CDF11, 0x00249913,
+0x04000802, 0x080404D8, 0x00400200, 0x07001C0F, 0x0F002804, 0x21060008, 0x00DC99C5, 0x0005E400,
+0xE24004F0, 0x04FF9EC5, 0xC6E34000, 0x0004FF9F, 0x00001400, 0x04000504, 0x05440E00, 0x08050006,
+0xE80F01C4, 0x14080101, 0x000C0800, 0x0C026004, 0x98000008, 0x00040002, 0x000BE800, 0x90000C04,
+0x0004005C, 0x0003A800, 0x00040004, 0x000C0005, 0x02000402, 0x14081970, 0x0418000A, 0x00042400,
+0x04000438, 0x04480000, 0x00000404, 0x60000450, 0x00040404, 0x04047804, 0x6C000008, 0x05040018,
+0x006AF800, 0xD5487F04, 0x04FF7EB3, 0x04F80000, 0xB104F400, 0xFF82B4D7, 0xFF83B5D8, 0x3C84B6D9,
+0x6AD80044, 0x00000404, 0x44004510, 0x04F80000, 0x0004F004, 0x04000058, 0x04F00000, 0x04000400,
+0x08040080, 0x00980000, 0x00000400, 0x040005BC, 0x00B80000, 0x05C4DC14, 0x0034D007, 0x9800187C,
+0x04DC000E, 0x00000408, 0x040804DC, 0x03D80400, 0x000DF800, 0x100411C4, 0x00080000, 0x00001002,
+0xE4062590, 0x01740008, 0x0404BC00, 0xFC000008, 0xC5DC9011, 0xC2E2FF95, 0x04E5FF97, 0x95C33000,
+0xB104E4FF, 0xFF92C5E2, 0xFF93C5DE, 0x5896C4DC, 0x0A040027, 0x020C6000, 0x932001C8, 0x000070FF,
+0xE6220028, 0x713A74C5, 0xFF92C7E7, 0x0095C8E5, 0xDC10F121, 0x89FFA1C7, 0x4AFF5E7B, 0x51FF2B42,
+0x3EFF3B4D, 0x66FF2C3B, 0xF5FF5463, 0xF3FFE1F3, 0x1DF8DEF2, 0x535318F1, 0x3A3AFF41, 0xB1B3FF28,
+0xB9BAFF9F, 0x7C7CFFA5, 0xAFB0FF64, 0x6569FF93, 0x3741FF49, 0x3D4BFF1F, 0x4251FF2A, 0xF08BB032,
+0x1B23300D, 0x37414BFF, 0x283943FF, 0x243C48FF, 0x0F303FFF, 0x85AEC0FF, 0x9CCAE1FF, 0x311244FF,
+0xA092C1DD, 0xC6E33103, 0x0105A899, 0xC53000A8, 0x44E0FF98, 0x000CE000, 0xC00007CC, 0x00080802,
+0x00000C04, 0x04080F2C, 0x0E080000, 0x03040401, 0x38000470, 0x02D00400, 0x00000C00, 0x94000004,
+0x00080004, 0x0500040F, 0x0F002000, 0x44090004, 0xFF98C7E3, 0x90080004, 0x64E11004, 0x00040359,
+0x08001804, 0x0C0F0014, 0x1C020300, 0x04280804, 0x11000C0F, 0x00047C00, 0xE9B10130, 0xE9FF9DC5,
+0xE3FF9EC4, 0x09109FC3, 0xC8E306F0, 0xCAE3FF95, 0xC9E1FF92, 0xC8E0FF95, 0xC6DFFF9A, 0xD4DEFF9E,
+0xC537F10E, 0xC1DDFF9C, 0xDDEFFF9E, 0xFAFFFFC6, 0xC8DBFFE5, 0xC0CEFFA5, 0xDDE0FFA3, 0xF5F4FFD5,
+0x6765FFFF, 0x342EFF86, 0x6758FF63, 0xB6ADFF9F, 0xC2D0FFE1, 0xC1D9FFC6, 0xCAE3FFA9, 0xC2DCFFA0,
+0xC9E2FF93, 0xCAE3FF9D, 0x3114589E, 0x609BCDE4, 0xC5DC7128, 0xC8DFFF9F, 0x0000689B, 0x040F006C,
+0xEC042100, 0x00D00000, 0x0200040F, 0x00C4C610, 0x91000400, 0xC7E0FF9C, 0xC7E1FF9D, 0x7100049F,
+0xFF9EC6E0, 0x149DC5DF, 0xC6DF4000, 0x0004FF9C, 0x310FEC00, 0xAC98C4DD, 0x050C040F, 0x0605580F,
+0x1C98C621, 0x00280408, 0x0500080C, 0xC22F0A48, 0x0A14A095, 0x0C050000, 0x10000004, 0x00040505,
+0xDC94C321, 0x05040211, 0x030A1C0B, 0x2000193C, 0x091C0004, 0x0005100C, 0x1004045C, 0x0E680405,
+0x01136C00, 0x80031870, 0x79D80013, 0x30050001, 0xF4FF80B2, 0xE4D61004, 0x7FB4304E, 0x0104F8FF,
+0xB76109E8, 0xB8DBFF85, 0x00000486, 0xC8005BC0, 0x0004005B, 0x22004401, 0x0EE088BA, 0x21363800,
+0x48C886BB, 0x0032DC00, 0xA40004EC, 0x00040019, 0x0004E402, 0xA8026638, 0x0FBC010A, 0x222B1800,
+0x2C4C8DBF, 0x688EC121, 0x13880018, 0x000E7000, 0xDE2200CC, 0x001C54C3, 0xC8000008, 0x08A80204,
+0x0016A402, 0xA4000478, 0x03B40003, 0x00000800, 0xB8000004, 0x00080F0C, 0x09080006, 0x06C8C512,
+0x0803F404, 0xDC710008, 0xDDFF96C6, 0x0CB496C6, 0x98C3E531, 0x3C0161E0, 0x94C62109, 0x20010018,
+0x07440412, 0xFF98C630, 0xE44403D8, 0x04FF95C6, 0x00900000, 0x48C9E620, 0xF4901116, 0xE21BF02A,
+0xDDFF99C8, 0xD7FF9DC7, 0x6FFFA5C6, 0x52FF4B63, 0x88FF3A4B, 0xE4FF7785, 0xC9FFD5E3, 0x96FFBAC8,
+0x83FF8496, 0xC6FF6F81, 0xF14FD0C2, 0xDCFFCC12, 0xB4FFCCDC, 0x70FFA2B4, 0x6BFF5C72, 0x50FF526C,
+0x48FF314D, 0x52FF2641, 0x9EFF2F45, 0x63B87D8E, 0x202E10F1, 0x3C48FF14, 0x3C46FF30, 0x414DFF2B,
+0x3342FF29, 0x9EB1FF13, 0xC9E1FF79, 0xCAE4FF9F, 0x00044C9C, 0x500014A8, 0xCAE77113, 0xC2DCFF9D,
+0x00281494, 0xC00A031C, 0x09000C02, 0x00D0971E, 0xB495C721, 0x00E8000D, 0x00000408, 0x100404EC,
+0x04BC0000, 0x00000C08, 0x040F0010, 0xD00C2100, 0x013C0004, 0x0C000400, 0x100F0018, 0x00020B00,
+0xC8E24F05, 0x0004FF9A, 0x046C0019, 0x40293800, 0xFF9CC7EA, 0x0CF10504, 0xFFA0C4E4, 0xFF9DC6E2,
+0xFF97C9E4, 0xFF94CAE4, 0xFF99C8E4, 0xFF9BC7E2, 0xF4A0C5DF, 0xC6E43247, 0xF105009D, 0xFFC9DE1B,
+0xFFE3FAFF, 0xFF9EC9DC, 0xFF9BC4D6, 0xFFC7DDE8, 0xFFF6F5FB, 0xFFFFF7FB, 0xFFAD7F7F, 0xFF703024,
+0xFF764034, 0xC09A878B, 0xDF04F165, 0xE3FFADC9, 0xE4FFA2CA, 0xDCFFA4C9, 0xE2FF99C3, 0x145C98CC,
+0x0474DC10, 0x00A2C82F, 0xF4042E05, 0x00D00000, 0x0200040F, 0x0100C400, 0x000F0504, 0xC62B0405,
+0x1105049E, 0x0014F49B, 0x3C0A0A10, 0x04F00202, 0x04001401, 0x08040310, 0x050C0300, 0x07001C01,
+0x1400000C, 0x078C0005, 0x0900040F, 0x0404FC08, 0x100004F4, 0x0004041B, 0x0008A800, 0x70000004,
+0x05040814, 0x02000C04, 0x8C020CF4, 0x0504001E, 0x00000400, 0x94040508, 0x0504002F, 0x03000401,
+0x08054C60, 0x4BF80305, 0x7FB3D831, 0xD9224F5C, 0x225900B4, 0x5094B6DB, 0x50B7DC24, 0x27980261,
+0x0009E802, 0x4C003290, 0x32A00244, 0x0009E004, 0xD4002744, 0x056C0009, 0x0204F002, 0x840104EC,
+0x44BF1000, 0x3EA80218, 0x0009D000, 0x080400A0, 0x04EC0000, 0x0009CC00, 0x040004E8, 0x0E880000,
+0x00099C00, 0x740008D4, 0x00080008, 0x00037800, 0x700004B0, 0x08140003, 0x00000800, 0x70000310,
+0x00080003, 0x40000400, 0xFF98C8DF, 0xE0200338, 0x2A030CC9, 0x0010FF98, 0x021B8400, 0x2000031C,
+0x02300002, 0x50000808, 0xFF9AC9DD, 0x30033CDF, 0xE4FF9BC7, 0xC7E43102, 0x0003489B, 0x04000024,
+0xC8E14800, 0x0004FF9C, 0x20C9E320, 0xFF992000, 0x24001BDC, 0x001C0003, 0x60073800, 0xFFA1CDE6,
+0x07D8C9E0, 0xFF9B62F1, 0xFFA2C8DD, 0xFFABCCDD, 0xFF8DA8B3, 0xFFAFC0C7, 0xFFBEC9CB, 0xFFA1ACA8,
+0xFFB3BEB8, 0xFFBECDCA, 0xFFC6D8D8, 0xFFD0E5EA, 0xFFB9CED3, 0xFF8B9B9B, 0xFFA1B1B0, 0xFF4F6361,
+0xFF3D5653, 0xFF213D3E, 0xFF3F5B5F, 0xFF98B1B8, 0xFF152934, 0xFF2B3B48, 0xFF3E4C57, 0xFF909EA7,
+0xFF24353F, 0xFF2D4351, 0xFF1C374A, 0xFF55758E, 0xFFAACFEA, 0x7496C2DD, 0xCBE5310A, 0x0011C89D,
+0xDF3162AC, 0x03BC9AC6, 0x00009800, 0x0405000C, 0x99C73800, 0x000824FF, 0xC400013C, 0x00040000,
+0x09015000, 0xC6300004, 0x0920FF99, 0x00013000, 0x04040548, 0x00100000, 0x3900040F, 0x4B016401,
+0xE1FF9BC9, 0x18000004, 0x00040000, 0x00001800, 0x040F0008, 0xC7430600, 0x04E0FF9B, 0x018C0000,
+0x1900040F, 0x5001CC00, 0xFF9AC9E7, 0x610984E5, 0xE0FF9CC9, 0x000C9CC9, 0x72001000, 0xFF9EC7E3,
+0xB89EC8E1, 0xC83BF109, 0xC9E6FF9C, 0xC1D7FF9C, 0xE4EBFF9D, 0xF8FFFFD1, 0xC5D8FFE4, 0xC4DBFF9F,
+0xE0EFFF9E, 0xF0FCFFD0, 0xE9F7FFEE, 0xAFBDFFED, 0xB0BCFFBA, 0x757FFFC4, 0x555BFF8C, 0x555EFF6C,
+0xA0B0FF62, 0xCAE2FF9A, 0xBFDEFFB8, 0xC4E3FFA6, 0x7104F0A3, 0xFF9DD0E5, 0x8C9BCDE6, 0x00E0000F,
+0x1900B40F, 0x0B002C0D, 0x50010138, 0x00140700, 0x0000D400, 0xDF400004, 0x04FF9DC7, 0xC7E04100,
+0x0004FF9F, 0xDCA1C622, 0xA1C62105, 0xE8000010, 0x0020020A, 0x060A1400, 0x3C050154, 0x05440102,
+0x000A4800, 0x30020004, 0x001C0C0A, 0x04027000, 0x40010004, 0x05200405, 0x00146400, 0x04031484,
+0x0D4C0000, 0x29149401, 0x0A1C98C4, 0x0007C000, 0xB8000004, 0x0004040C, 0x00001000, 0x10040004,
+0x00080005, 0x01219000, 0xC1160004, 0xF800258C, 0x16F40011, 0x00045C00, 0x40000004, 0x0004000E,
+0x000F2001, 0xC0004804, 0x8CBD2160, 0xA8004C90, 0x14240004, 0x01000400, 0xF4000EE4, 0x81B62174,
+0xDA134048, 0x1C006FAC, 0x0ED80014, 0x000F3001, 0x74005268, 0x00BE1227, 0x52700031, 0x0109DC00,
+0xBF100004, 0x1C02576C, 0x00700061, 0x02000404, 0x9111008C, 0xA0001284, 0x0004040D, 0x00211000,
+0xE8000004, 0x00040004, 0x0004E804, 0xE80004EC, 0x00040004, 0x0004E800, 0xC800064C, 0x03780004,
+0x00000800, 0xE0000374, 0x00080004, 0x9ACAE140, 0x0002BCFF, 0xE2890008, 0xE2FF9CCA, 0x08FF9BCB,
+0x00140000, 0x22091800, 0x00189DCB, 0x12001000, 0x00000CC9, 0xE3220C84, 0xB10C8CCB, 0xFF9DCBE2,
+0xFF9DCCE0, 0x9C9ECBE0, 0xC9E5310C, 0x000CB0A0, 0xE2400024, 0x04FF9ECB, 0x000C0000, 0x01000408,
+0xCB300014, 0x0470FF9D, 0x24CAE520, 0xA026F103, 0xA3C9E0FF, 0x9EC7DDFF, 0xA3CCE0FF, 0x9FC8DCFF,
+0xA5CADDFF, 0xACCBDDFF, 0xCEE9F4FF, 0xCADBE2FF, 0xC2CECEFF, 0xC8D1CCFF, 0xC9D3CAFF, 0xBFCCC5FF,
+0xC2D5D1FF, 0x38F14AE8, 0xFF72878C, 0xFF9AACAC, 0xFF839390, 0xFF344944, 0xFF5E7471, 0xFF7C9695,
+0xFFB4CECF, 0xFF0F282D, 0xFF283F45, 0xFF30434A, 0xFF6F8088, 0xFFBBC9D2, 0xFF3B4C56, 0xFF314453,
+0xFF274054, 0xFF213C57, 0xFFB2D4F0, 0x0CA2CBE7, 0x01180101, 0x02B8C912, 0x00032400, 0x1804029C,
+0x00080D04, 0x749AC825, 0x0148000D, 0x01000400, 0xC92103F4, 0x0004009B, 0x04050010, 0x06000000,
+0xFF9BC94F, 0x240008E3, 0x001D3C00, 0x0801019C, 0x1D480000, 0x07018800, 0x9C000008, 0x06380003,
+0x000E2000, 0x08000028, 0x03C40100, 0x00007003, 0x100F00CC, 0x24000600, 0x00040F00, 0x0050000C,
+0x0A00040F, 0xFF9CCA30, 0xDE400248, 0x04FF9BCA, 0x00E80000, 0x0304FC01, 0x3C010E28, 0x9CCA2100,
+0xD5E001F0, 0xEEFF9EC1, 0xF9FFD6E7, 0xD6FFE1F2, 0xF00ECCC3, 0xE8FFA128, 0xFFFFC9D9, 0xFFFFF2F8,
+0xC1FFE7F0, 0xD9FFA2AD, 0xD9FFB6C0, 0xD6FFC0C5, 0xD1FFD3CB, 0xBAFFD0C9, 0xA5FFA4AA, 0xD4FF838F,
+0xE6FFAEBA, 0xDAFFB7CB, 0xDAFFA1C4, 0xC7611400, 0xCBE7FF98, 0x0102A09C, 0xC80F00E4, 0x240F0C00,
+0xF8001200, 0x00480004, 0x00000804, 0xCA21000C, 0x4105D89D, 0xFF9EC8E0, 0x00030004, 0xC7E14805,
+0x0004FFA2, 0x0508E013, 0x100F2001, 0x0002D8C8, 0x34000004, 0x0254020A, 0x00024406, 0x04060520,
+0x0F380000, 0x0C026C00, 0x88000004, 0x05040007, 0x040B4400, 0x1000000C, 0x04F80500, 0x00051C03,
+0x040011A0, 0x0A240F00, 0x04FC0005, 0x00000400, 0xFC000A1C, 0x00040C04, 0x02046808, 0x8F110504,
+0x88042B04, 0x0A0C0104, 0x03398C00, 0x0C010004, 0x1370030A, 0x40000C00, 0xFF83B5D6, 0xD73183A4,
+0x6FA885B8, 0x11613400, 0x20450CD9, 0x5BBCFF88, 0x00052400, 0xDB80575C, 0xDBFF8BBE, 0xACFF89BF,
+0x4D380013, 0x00000801, 0x3C005240, 0x8FBE214D, 0xD0003084, 0x0004003D, 0x0004EC00, 0x880005C0,
+0x0004000D, 0x0024F800, 0x14050004, 0x1AE80010, 0x01060C03, 0x980304E0, 0x07E40408, 0x0402F004,
+0xE8000318, 0x02880112, 0x0004B807, 0xE3A04EDC, 0xE3FF9ECC, 0xE4FF9FCC, 0x170004CD, 0x000008A0,
+0xA082000C, 0xA1CEE5FF, 0x0CCDE4FF, 0xCCE43200, 0x0B000CA2, 0xE2400008, 0x04FFA0CD, 0x09C00000,
+0xCDE600F1, 0xCDE5FFA3, 0xCDE3FFA3, 0xCDE1FFA4, 0xA20008A4, 0xFFA2CCE5, 0xFFA0CCE7, 0x0048CCE5,
+0x40002C00, 0xFFA2CCE2, 0x50F10018, 0xFFA3CBE5, 0xFFA4C8E2, 0xFFA8CCE4, 0xFFA4CADF, 0xFFA5CBE0,
+0xFFA7CDE0, 0xFFA4C7DA, 0xFFA9C9D8, 0xFFBBD3DF, 0xFFC4D5DC, 0xFFD6E2E0, 0xFFCFDAD2, 0xFFC5D1C7,
+0xFFA9B9AE, 0xFF859892, 0xFF96ACAA, 0xFFD3E8E9, 0xFF899C9A, 0xFF42524F, 0xFF6C817C, 0xFFB2C8C5,
+0xFF9FB8B5, 0xFF3C5456, 0xF81F373B, 0x4914F13B, 0x82FF3043, 0xF8FF6C7E, 0x66FFE2F4, 0x70FF4E5F,
+0x49FF5165, 0x51FF2136, 0xC9FF1F37, 0xE3FF8FAD, 0x009CA1C9, 0x00077800, 0xE371044C, 0xDEFFA1CB,
+0x00C89CC6, 0x090F2000, 0xCA430004, 0x04E1FF9D, 0x01500100, 0x00048C03, 0xA00C000C, 0x05F40404,
+0x9FC9E233, 0xA01F0608, 0x32020008, 0x84A1CBE4, 0xA1CB2F01, 0x00020020, 0x34011300, 0xA0CA2106,
+0x10017D80, 0x68CA1200, 0x7D900006, 0x0000A001, 0xC9220094, 0x0F009C9F, 0x01040008, 0xB0010088,
+0x949F1100, 0x099C0009, 0x02000408, 0x1C000020, 0x00040A00, 0x00006001, 0x040F0054, 0xDF200400,
+0xB306B0C9, 0xCADDFF9D, 0xCBDDFF9D, 0x4CE1FF9C, 0x00380107, 0xFFA0C883, 0xFFA0C9DF, 0x7100BCE0,
+0xFFA1C1D6, 0x04DDEBF6, 0xD714F100, 0xDBFFA2C2, 0xF3FFA4C7, 0xF7FFD6EA, 0xFEFFE4F1, 0xC0FFE3F1,
+0xDEFF9CAF, 0xDBFFACC8, 0xD7FFA6C6, 0x3238ABC6, 0xC9DB07F0, 0xCFE0FFAC, 0x6E7AFFBC, 0xA1AEFF6E,
+0xCFE1FF9F, 0xC5D9FFB8, 0xA751028C, 0xA0C8E1FF, 0x6C0110C4, 0x00A00F00, 0x001C0F04, 0x04CC0105,
+0x080AA001, 0x9D2200F0, 0x1E0108FF, 0x2200589D, 0x09E8A0C8, 0x910F7401, 0xC8E0FFA2, 0xC9E1FFA4,
+0x000004A5, 0xDF20000C, 0x030A9CC7, 0xC8210514, 0x080048A0, 0x0C040160, 0x4E000000, 0x01000400,
+0x28030A44, 0x00740205, 0x04008802, 0x080C0028, 0x147C0000, 0x04052C02, 0x08000A3C, 0x449A1100,
+0x08EC0014, 0x00000408, 0x040C0F38, 0x05200400, 0x08050C00, 0x6C010004, 0x2FF80004, 0x00000403,
+0x04000F10, 0x050C0000, 0x06000402, 0x180034A0, 0x0E80000A, 0x04000400, 0xD8310518, 0x3A388CB9,
+0x8EBBD831, 0xDB715208, 0xD9FF91BE, 0x430890BF, 0x0015B800, 0xDAB14310, 0xDAFF91C0, 0xD9FF92C0,
+0x42E092C2, 0x0038B800, 0xDC0042E8, 0x04E0003D, 0x082A1C00, 0x88000004, 0x0004023F, 0x24F49911,
+0x9AC4DC40, 0x400004FF, 0xFF9BC5DD, 0xA0000004, 0x00040403, 0x02012802, 0x88000E64, 0x00040103,
+0x00097C00, 0x98000274, 0x03600309, 0x0103D800, 0xC00304CC, 0x04A80004, 0x0004E000, 0xE4850008,
+0xE6FFA2CF, 0x08FFA4CE, 0xA4CEA200, 0xA5CFE7FF, 0xA5CFE5FF, 0x10000018, 0xA6CE2100, 0xE71B0010,
+0xE3900008, 0xE5FFA5D0, 0xE7FFA3D0, 0xCFA10004, 0xCFE3FFA5, 0xCEE1FFA6, 0xE20004A8, 0xFFA9CFE4,
+0xFFA6CEE8, 0xFFA3CFEA, 0x0024CFE8, 0xF1003000, 0xA6CFE108, 0xA8CEE5FF, 0xA9CDE7FF, 0xADD1E9FF,
+0xA6CCE1FF, 0xA8D1E7FF, 0xE0E00A00, 0xE0FFA5CE, 0xE0FFABD0, 0xF3FFB5D2, 0xF177B8E9, 0xBCFFBB26,
+0x97FFAEBC, 0x97FF8F9E, 0xB6FF91A1, 0xDCFFADBE, 0xD4FFCFE2, 0x6EFFC2D6, 0x68FF5B6F, 0xDDFF576A,
+0xEDFFCCDF, 0x63FFDBEF, 0x8EFF5165, 0x3FFF788D, 0x5EC0273C, 0x5C6218F1, 0x383CFF49, 0xA2A6FF26,
+0xAFB1FF90, 0x7072FF9D, 0x848BFF5E, 0x5A68FF71, 0x273CFF47, 0x7A93FF12, 0xD8F2FF60, 0x3111B0B3,
+0xE0A4D1E8, 0x01280005, 0x00045800, 0x08000100, 0x00100000, 0x0000040D, 0xCB300634, 0x04BCFF9F,
+0x00000400, 0xE4490020, 0x08FFA2CA, 0xA3CB3100, 0x070634FF, 0xF8000008, 0xF4E41005, 0x01840005,
+0x1400080F, 0x1012FC00, 0x4001C4E1, 0xE1FFA2CA, 0x08040AAC, 0xA4C92100, 0x20001318, 0x00780000,
+0x0100080F, 0x0000C000, 0x0800386C, 0x05E80000, 0x0D053C00, 0x4C030008, 0x001C0105, 0x00000C0F,
+0x0F003C00, 0x00050004, 0xE05004D8, 0xDEFFA1CA, 0xCB610004, 0xCBDEFFA0, 0x000C0C9E, 0x68000030,
+0x007C0000, 0x22002000, 0x00BCCBDF, 0xC5D808F1, 0xEEFBFFA4, 0xE4F3FFDE, 0xC5DAFFD4, 0xC9DCFFA6,
+0xE5EBFFA8, 0xB1B434D2, 0xFFE2F0F9, 0xFFA0B5C6, 0xC8AACEE4, 0xCDE34005, 0x055CFFA3, 0xCAE10CF1,
+0xC8DBFFA4, 0xC4D0FFAD, 0x1F28FFC2, 0xA9B5FF22, 0xCBDCFF9F, 0xC2D7FFB6, 0x000C38A3, 0x70000064,
+0x00040F00, 0x05100C15, 0x05048C00, 0xAC000004, 0x00040306, 0x0100280C, 0xC721056C, 0x000074A2,
+0xFC0004F0, 0xC9E24004, 0x0004FFA7, 0xA6C8E180, 0xA5C7E0FF, 0x200504FF, 0x07D4C8E2, 0x02000400,
+0xDC080504, 0x01640104, 0x74A1C921, 0x00B80107, 0x0F000C00, 0x03010174, 0x3C080084, 0x000C0000,
+0x0003EC02, 0x04040A58, 0x589C1100, 0x0CBC000C, 0x00000400, 0x0400090C, 0x050C0F00, 0x0A240F01,
+0x05080101, 0x02427001, 0x50001CE4, 0x142C000E, 0x04050000, 0x64000004, 0x00040813, 0x0404FC00,
+0x04000004, 0xBFDBC005, 0xC1DBFF9C, 0xC2DCFF9C, 0x1A90FF9E, 0xA0C4DE35, 0xDD200008, 0x021FC0C6,
+0x1C000618, 0x12D80001, 0x31013C00, 0x40A3C9DE, 0xC8DF4106, 0x0108FFA2, 0x1E04AC00, 0x0006CCCA,
+0x78000624, 0x07440001, 0x00000400, 0x040C024C, 0x02FC0000, 0x00036801, 0x04030354, 0x03680000,
+0x00098400, 0x08080244, 0xE4E41000, 0xA5CE3004, 0x100008FF, 0x010484E5, 0xA69604E4, 0xA6D1E4FF,
+0xA7D0E6FF, 0xD0210008, 0x360490A7, 0x08A8D1E5, 0xAAD03100, 0x0B0010FF, 0xE5200008, 0xF2002CD2,
+0xE9FFA71D, 0xE7FFA5D2, 0xE3FFA7D1, 0xE3FFA8D1, 0xE3FFABD2, 0xE6FFADD0, 0xEBFFACD0, 0xEDFFA9D1,
+0xEBFFA6D2, 0xE8FFA6D2, 0xE4FFA6D3, 0x000020D3, 0x04009DE8, 0xCBE14000, 0x0044FFA7, 0xD0E418F1,
+0xD8ECFFA1, 0xD7E7FFA8, 0xCEDCFFA8, 0xD1DCFFA4, 0xECF4FFB3, 0xA8ACFFD5, 0xBDBDFF96, 0xC6C4FFAD,
+0xD2D0FFB2, 0xF08BACBE, 0xAABEBC2E, 0x849493FF, 0xBBCBCBFF, 0xD7EBEAFF, 0xC7DBDAFF, 0x3C504FFF,
+0x5A6E6FFF, 0x94A7ABFF, 0x12252BFF, 0x6D8087FF, 0x75868EFF, 0x1D2E35FF, 0xBDCCCFFF, 0x94A6A6FF,
+0x91A4A2FF, 0x8BF0DEFF, 0xB7CB03F1, 0x5C6F7DFF, 0x183346FF, 0xB6DCF1FF, 0xA2CFE6FF, 0xC40005C0,
+0x05F40000, 0x00000400, 0x24000168, 0x30E41101, 0x01340001, 0x11000400, 0x000610A4, 0x0405062C,
+0x18CD1000, 0xFFA56000, 0xFFA7CCE6, 0x0804002C, 0xCDE42200, 0x08000010, 0x00480000, 0x0005F000,
+0x1000061C, 0x54E21000, 0xA7CD2100, 0x1008062C, 0x00180400, 0x00000804, 0x20090B44, 0x00540000,
+0x30A7CD21, 0xCBE37206, 0xCCE3FFA7, 0x000004A6, 0x0C000B6C, 0x00080700, 0xA6CBE5C0, 0xA4CCE5FF,
+0xA5CAE4FF, 0x0C0574FF, 0xE5400008, 0x80FFA5CA, 0x0004040B, 0x00002401, 0x040F05AC, 0x78001C00,
+0x003C0005, 0xA3CCE271, 0xA5CBE2FF, 0xE4B20410, 0xE9FFA7C9, 0xE9FFA6C9, 0x0614A3CA, 0xDCA4CE21,
+0xD901F006, 0xFFFFA7C8, 0xECFFE0F2, 0xDCFFCCDE, 0xDCFFABC7, 0xEB00F109, 0xFBFFD5E4, 0xFAFFEFF9,
+0xC0FFE7F1, 0x05149FB2, 0xA9CFE6B1, 0xA0C5E2FF, 0xA8CCECFF, 0x08F15688, 0xFFAECCE4, 0xFFBACBDF,
+0xFF808696, 0xFF3C373E, 0xFFD1D4DD, 0x00B3CEE1, 0x007C000A, 0x0F008400, 0x011D0004, 0x80000378,
+0xA3C82104, 0xF0000064, 0x05B40056, 0x04000404, 0x08040020, 0x11A40000, 0x00000401, 0xC83009F8,
+0x04F4FFA6, 0xA9C9E250, 0x0CA8E0FF, 0x0500C912, 0x0003DC00, 0x04014350, 0xDCCA1200, 0x00500403,
+0x00000804, 0xAC010050, 0xA4C92900, 0xC00C03FC, 0x052C0105, 0x00051C0F, 0x00001800, 0x0402050C,
+0x0AB00000, 0x00129802, 0xF80110FC, 0x11C4000D, 0x149AC829, 0x05140824, 0x050A180F, 0x00134800,
+0x04040500, 0x05080000, 0x04000400, 0x68000508, 0x05080418, 0x040A0800, 0xDDB10004, 0xDDFFA9C5,
+0xDCFFA7C5, 0xCEB4AAC6, 0xABC7DD31, 0x1800000C, 0x0014006B, 0x440BD000, 0xFFACC8DD, 0xDE440004,
+0x04FFADC9, 0xC9DD9F00, 0xCEE2FFAA, 0x04E4FFAB, 0x1C000400, 0x00040100, 0xFFADCD4F, 0x010004E2,
+0x20003801, 0x0968FFAA, 0x00023400, 0x40000008, 0x00040F07, 0xA9CF8006, 0xABCFE5FF, 0x04C4E5FF,
+0x44000403, 0xFFAAD0E3, 0xE4200004, 0x0204B8D1, 0xE6400010, 0x10FFABD1, 0x04C40000, 0xACD1E431,
+0x140004CC, 0x00100000, 0x30000801, 0x08FFABD1, 0x00240100, 0xA9D229F0, 0xAAD3E9FF, 0xAAD3E7FF,
+0xACD3E4FF, 0xADD2E2FF, 0xAED1E4FF, 0xAED1E5FF, 0xACD1EBFF, 0xA9D3ECFF, 0xAAD4ECFF, 0xAAD5E8FF,
+0xABD5E5FF, 0xADD4E5FF, 0xAFD2E6FF, 0x0004E8FF, 0xFFAFD590, 0xFFABD6E7, 0x0040D9ED, 0xFFA36AF1,
+0xFFA9D8E8, 0xFFADD7E5, 0xFFB5D3DE, 0xFFBCD3DB, 0xFFADBFC3, 0xFFCBDDDF, 0xFFADC1C0, 0xFFB5C9C8,
+0xFFB0C6C4, 0xFFC0D4D3, 0xFFCADADA, 0xFFA4B4B4, 0xFF6E8281, 0xFF859B99, 0xFF4A5E5F, 0xFF90A4A5,
+0xFF516468, 0xFF14272B, 0xFFC7D8DF, 0xFF37484F, 0xFF5E6D72, 0xFFECFBFE, 0xFF6E817F, 0xFF445755,
+0xFF768888, 0xFF738589, 0xFFB2C5CC, 0xFF324957, 0xFF68899C, 0xE8BFE5FA, 0x04C00105, 0xFFA7D050,
+0x0128D2E6, 0xE4FFA630, 0x1800000C, 0x00080306, 0x00062400, 0xE8400004, 0x04FFA7CF, 0x000C0000,
+0x0148E713, 0x01015804, 0xCF21017C, 0x0408C8A9, 0x70010190, 0x5CCF1201, 0x00200001, 0x0020E213,
+0x0F017804, 0x00090008, 0x30010044, 0x04140000, 0x58AACF21, 0x08E21300, 0x004C0000, 0xA9CDE371,
+0xA8CEE3FF, 0x08040B50, 0x056C0000, 0x08053800, 0xE6400004, 0x10FFA8CC, 0x00080000, 0x00051C01,
+0x24000678, 0x00040005, 0x10ACCC12, 0x02072C02, 0x3C00000C, 0x00100005, 0x0100080C, 0x68030574,
+0x00480205, 0x00056802, 0x6000002C, 0xE401F000, 0xE6FFABCB, 0xE8FFACCA, 0xE8FFA8C9, 0x14FFA6CB,
+0xD0E63111, 0x310500A6, 0x08A9CADB, 0xDBEA31A5, 0xF10304C8, 0xADC8D918, 0xDBE8F0FF, 0xE8EFF5FF,
+0xE4EEF7FF, 0xA2B4C2FF, 0xB0CDDFFF, 0xA9CDE5FF, 0xA9CCEAFF, 0xA8CBEBFF, 0xA8CBE7FF, 0x08F60554,
+0xFFB1CDE5, 0xFFCAD7EA, 0xFF4B4048, 0xFF91878F, 0xFFBBCEDF, 0xE0A9CBE4, 0x05B80C05, 0x0C05F804,
+0xCB260018, 0x000B38A3, 0x04030B44, 0xC8E43100, 0x04480CA5, 0x780004BC, 0x0B70000A, 0x0104F400,
+0xCA16000C, 0xFC000EF0, 0xC8E12004, 0xA9200098, 0x600504FF, 0xFFA8C8DF, 0x0F90C7E0, 0xE2FFA642,
+0x000004CA, 0x4C000670, 0x0A100400, 0x0F000C00, 0x00010004, 0x040405C0, 0x06440100, 0x21064800,
+0x06B4A3CC, 0x05052800, 0x60000530, 0x0004040C, 0x0005B800, 0x20030004, 0x11200205, 0x01178402,
+0x20030E00, 0x11940016, 0x13159001, 0x000A28C8, 0xC7211C9C, 0x00293C9B, 0x04041454, 0x0A300000,
+0x0029A000, 0x2800051C, 0x00040F0A, 0x26B80001, 0x02051C00, 0x60020514, 0x05100022, 0xC6DB08F1,
+0xC7DBFFB0, 0xC8DDFFAE, 0xCADEFFB2, 0xC9DBFFB1, 0xC7D9FFB2, 0x000004B0, 0xDF71000C, 0xDEFFB6CD,
+0x0004B5CC, 0xB4CBDB40, 0x710004FF, 0xFFB5CCDC, 0x04B6CDDD, 0xCEDF4000, 0x0004FFB4, 0xB5CFE060,
+0xFCCFE3FF, 0xFFAC5115, 0x0CB2CBDF, 0xD1E24100, 0x0004FFB7, 0xFFB9D061, 0xFCB7CEE0, 0xE410F510,
+0xE3FFBBD2, 0xE4FFBAD1, 0xE4FFB9CF, 0xE2FFB7D0, 0xE4FFB4CF, 0xE6FFB5D2, 0xE5FFB5D1, 0x0004B6D3,
+0xB3D2E480, 0xB1D0E2FF, 0x040008FF, 0xE3B10004, 0xE3FFB1D2, 0xE2FFB2D1, 0x0004B0D1, 0x44001000,
+0xFFB2D3E6, 0xE5450004, 0x04FFB1D2, 0xAED12100, 0xA80004C4, 0xD2E53104, 0x3604B0AF, 0x08AED3E6,
+0x000C0000, 0xFFAED330, 0x0400001C, 0x00280000, 0x43002001, 0xE6FFB0D3, 0xE7D00004, 0xE8FFB0D3,
+0xE9FFAED2, 0xEAFFAED4, 0xD44104E8, 0x04E7FFAE, 0xAF06F200, 0xAFD3E9FF, 0xB0D5E8FF, 0xB0D5E7FF,
+0xAED5E6FF, 0xADD6E8FF, 0xD5A10004, 0xD5E5FFAF, 0xD5E3FFB1, 0x00211CB9, 0x58F14FD0, 0xFFE0F0F0,
+0xFFD8E6E6, 0xFFDDECE9, 0xFFC4D4D3, 0xFF9FAFAE, 0xFF9BADAD, 0xFFB2C4C4, 0xFFC2D6D5, 0xFF6B7F7D,
+0xFF475B5A, 0xFF7F9392, 0xFF243837, 0xFF687C7B, 0xFF9EB2B1, 0xFF172B2A, 0xFFC7D9D9, 0xFFE2F4F4,
+0xFF394949, 0xFFDBEBEB, 0xFF7A8A8A, 0xFF101F22, 0xFF38454D, 0xFF6B7C86, 0xFF2F4958, 0xFF4E6B7D,
+0xB0BCDBEF, 0x05B40005, 0xE1009801, 0xE6FFACD2, 0xE7FFADD3, 0xE5FFACD2, 0x0008ACD2, 0x00000C00,
+0xE9440004, 0x04FFACD2, 0xD2E54100, 0x0004FFAD, 0xFFAED131, 0x2C000100, 0x011C0001, 0x0000080F,
+0xAED3E540, 0x350114FF, 0x08AFD4E6, 0x000C0000, 0x00000404, 0x040C0020, 0x00540000, 0x07001401,
+0x5C000654, 0xD0E42006, 0xAC400664, 0x58D0E3FF, 0xD8AB1105, 0x000C0006, 0x0F051400, 0x20010004,
+0x0768CDE6, 0x08FFAA20, 0xCEE62600, 0x60000008, 0x05380005, 0x0000040C, 0xE24404CC, 0x58FFA7CD,
+0x00080407, 0x01057004, 0xCD210008, 0x0015BCA9, 0xE4000570, 0x00040004, 0xB1000C00, 0xFFAACCE5,
+0xFFADCBE7, 0x40ADCCE8, 0x0AF80000, 0x31111400, 0xE8ADCCE0, 0xEE10F168, 0xDEFFC6D8, 0xDDFFAFCC,
+0xEDFFB2CF, 0xF8FFD5E6, 0xFBFFE9F4, 0xBEFFE5F2, 0xE2FF9EB0, 0x0810B3D0, 0x3100A800, 0xB0ABCDE8,
+0xCAE37100, 0xD2EAFFA8, 0xF00344AE, 0xA9A3AD01, 0x2B212AFF, 0xB5BDD0FF, 0xB4CCE4FF, 0x00006CFF,
+0xE73151BC, 0x0B84A8CD, 0x00059400, 0xE840000C, 0x0CFFAACE, 0x00040400, 0x0005A000, 0x64050004,
+0x0AAC0004, 0x04000400, 0xCC0004B0, 0xA6CA400E, 0x0004E0FF, 0x08168800, 0x0C000008, 0xA6CA3000,
+0x000B74FF, 0xE46004E0, 0xE5FFA6CA, 0x20059CCA, 0x0508FFAC, 0xABC9E340, 0x000004FF, 0x0400050C,
+0xC3F80000, 0x00060800, 0xBC000004, 0x00040000, 0x00003800, 0x44000004, 0x00040800, 0x00001404,
+0xE2401704, 0x10FFA8CC, 0x0004020D, 0x00000C00, 0xA7200004, 0x00016CFF, 0x38000020, 0x0B640000,
+0x0000D404, 0x60000564, 0x01AC0005, 0x0006A800, 0x34000548, 0x00040005, 0x00067800, 0xE671119C,
+0xE4FFA1CA, 0x249C9FC8, 0x0024A000, 0x3C020F44, 0x1470060A, 0x00001000, 0xA4001AB4, 0x05140017,
+0x00196800, 0x3C001978, 0x05440005, 0x00197400, 0x100021D8, 0x20D40000, 0x0020F000, 0x34002AE4,
+0xCBDC4027, 0x0004FFB8, 0xB9CCDD31, 0xDE800694, 0xDAFFBACD, 0x10FFB8CB, 0xCDDCD000, 0xCEE0FFBA,
+0xCFDEFFBD, 0x08DEFFBC, 0xD002F200, 0xCFDFFFBD, 0xD1DFFFBE, 0xD1E1FFBE, 0xD3E2FFC0, 0xE1400004,
+0x38FFBDD3, 0x00480000, 0x10C6DA20, 0xBB06F105, 0xBED1E2FF, 0xC2D5E4FF, 0xC1D4E3FF, 0xC3D4E4FF,
+0xC2D3E3FF, 0xE6B20004, 0xE7FFC5D6, 0xE4FFC4D5, 0x0004C1D2, 0xFFBED3A1, 0xFFBED5E5, 0x08BFD4E5,
+0xD5E66200, 0xD6E6FFC0, 0x00F1000C, 0xFFBAD4E3, 0xFFBDD4E4, 0xFFBBD5E4, 0x04BCD6E5, 0x08E71000,
+0xBBD7A100, 0xBBD6E7FF, 0xBCD7E8FF, 0x0C000008, 0x00040000, 0xBAD5E653, 0x0004E8FF, 0xB8D5E748,
+0xB10004FF, 0xFFB7D6E8, 0xFFB8D7E9, 0x04B7D6EA, 0xE900F100, 0xE8FFB5D6, 0xE7FFB4D5, 0xE5FFB6D5,
+0x0008B6D6, 0x75000C00, 0xFFB5D4E6, 0x04B4D5E6, 0xD4E77100, 0xD5E8FFB3, 0x440004B2, 0xFFB3D6E9,
+0x04F10004, 0xFFB4D7EB, 0xFFB4D7EA, 0xFFB4D8E8, 0xFFB3D7E7, 0x10B5D8EB, 0xD7EA2200, 0x00000050,
+0xDBE6B105, 0xD1D8FFC5, 0xE0E1FFC0, 0x714FE4D2, 0xFFBCC8C4, 0xF8A9B8B5, 0xCECD7131, 0xCCCBFFBA,
+0xF109D8B8, 0x293C3A1C, 0x697C7AFF, 0x405351FF, 0x435654FF, 0xE6FAF8FF, 0x374B49FF, 0x586C6AFF,
+0xF0FFFFFF, 0xC4D6D6FF, 0x778989FF, 0xD8EAECFF, 0x04F10F0C, 0xFF9AA9AE, 0xFF09161C, 0xFF374850,
+0xFF485B69, 0x0CB0CAD9, 0xD6E83101, 0x00060CB9, 0x4C00009C, 0xD7EA2004, 0xB01100B8, 0x140005A8,
+0x00040105, 0xFFB1D465, 0x04B0D4EA, 0xD4E85700, 0x04E7FFB1, 0x00EC0400, 0x00000804, 0x0C04001C,
+0x00080F00, 0xD6E68C01, 0xD6E6FFB2, 0x0008FFB1, 0x21002C01, 0x0138B1D6, 0x00000C00, 0x040C0048,
+0x06680000, 0x00008000, 0xE7100098, 0x04070554, 0x05380000, 0x01000400, 0xD26F0B64, 0xD1E7FFAF,
+0x020004AE, 0x000BDC00, 0x08000BC4, 0x0A880000, 0x090AC804, 0x34000008, 0x0004030C, 0x05011800,
+0xCF610004, 0xCDE4FFAC, 0x003DC4AD, 0x3801111C, 0x0B10000B, 0xFFACCF30, 0xE63109B0, 0xAED0B2CE,
+0x00005800, 0xE1B10060, 0xFFFFAECD, 0xEBFFE2F4, 0x09E8C3D5, 0xB5D1DD71, 0xD4E7EDFF, 0x00001400,
+0xB1BF3105, 0x0007CC9F, 0xB00005DC, 0x11200000, 0xB1D3EC80, 0xACD0E8FF, 0x001014FF, 0x04F102A0,
+0xFFD9D9E3, 0xFF160C15, 0xFF524F60, 0xFFCAD5E9, 0xFCAFCEE3, 0x0578010A, 0x00059000, 0xCB210A14,
+0x000518A9, 0x4C000434, 0x0420000A, 0x03000401, 0x0C011078, 0x104C0000, 0x040B1400, 0x38000004,
+0xA8CC3000, 0x440484FF, 0xFFA8CDE0, 0xE1310004, 0x000CA9CE, 0x00001800, 0x04010050, 0x050C0000,
+0xFFA6C870, 0xFFA6C8E3, 0x040004E4, 0xCCE57100, 0xCDE6FFAC, 0x400110AD, 0xFFABCBE2, 0x08000504,
+0x01200000, 0x110DE006, 0x010ADCAA, 0x78040080, 0xA8CC2200, 0xCC0100AC, 0x10AB110D, 0x0DF4010E,
+0x000CCE12, 0x24CDE122, 0xCDE3400E, 0x0004FFAA, 0x6106BC01, 0xE8FFAACE, 0x00F8A9CE, 0x00069800,
+0x54010004, 0xA7CD2100, 0x1C000014, 0x17A80000, 0x71051000, 0xFFA5CDE7, 0xECA7CFE9, 0x00180025,
+0x0011A000, 0x38000AD0, 0x0ADC0005, 0x00058000, 0xAC0014CC, 0x00100013, 0x00139400, 0x0400054C,
+0x0A7C0000, 0x1116D800, 0x111148E6, 0x0067BCA2, 0x4C001CB8, 0x18D0001F, 0x00227401, 0xCF1304D0,
+0xD22104D0, 0x3104D8C1, 0x08BFD1DF, 0xD3E12000, 0xC1210010, 0x500008FF, 0xE0FFC2D2, 0xF004D0D4,
+0xE2FFC411, 0xE5FFC4D6, 0xE5FFC6D6, 0xE5FFC5D7, 0xE7FFC4D7, 0xDBFFC6D9, 0xD1FFBACB, 0xD6FFB0C1,
+0xF209B8C4, 0xE6FFBF02, 0xE9FFC3D4, 0xE5FFC8D9, 0xE6FFC4D5, 0x0030C7D7, 0xFFC6D6C0, 0xFFC8D8E7,
+0xFFC8D8E8, 0x41000CE6, 0xE7FFC7D7, 0xC6190004, 0xE8400008, 0x04FFC7D8, 0xD7E63100, 0x440008C4,
+0xFFC6D9E8, 0x01F00004, 0xFFC5D8E9, 0xFFC3D9E7, 0xFFC3D8E9, 0xFFC4D9EA, 0x04020010, 0x00140200,
+0x44001800, 0xFFC2D7E8, 0xEA400004, 0x04FFC1D8, 0xD9EB4400, 0x0004FFC2, 0x93001000, 0xFFC0D7E9,
+0xFFBDD7E8, 0x080004E6, 0xA8000560, 0x00040802, 0x054CE513, 0x00046000, 0x58000004, 0xD4E63205,
+0x700AACB7, 0xE4FFB8D5, 0x60FFB7D4, 0x05400005, 0x00002000, 0x14F104FC, 0xFFBCD3E1, 0xFFC7DBE4,
+0xFFCDDFE3, 0xFFC7D5D6, 0xFFC0CCCA, 0xFFB7C3BF, 0xFFC0D0CD, 0xFFCBDEDA, 0xF0C4DAD8, 0x3B40F54A,
+0x81FF2C3C, 0xD5FF7381, 0xBEFFC6D6, 0xFFFFAFBF, 0x72FFF1FF, 0x29FF6174, 0xDFFF1729, 0xD2FFCDDF,
+0x9DFFBFD3, 0xB2FF8A9E, 0xA1FF9DB1, 0x9FFF8A9D, 0xC6FF889B, 0xDAFFADC0, 0x36FFC1D4, 0x35FF1A2C,
+0x52FF1228, 0xF3FF2B42, 0xEAFFC8E2, 0x05DCBBD8, 0xB6D9EC31, 0xB004047C, 0x00080405, 0x0005A000,
+0x04040520, 0x00100000, 0x1D00040F, 0xB7D8EB4A, 0x130004FF, 0x0F0010B5, 0x0C050008, 0x10020030,
+0x06400000, 0x4700040D, 0xEAFFB3D6, 0xE9400004, 0x04FFB2D5, 0x05280100, 0x2105A800, 0x0A7CB0D3,
+0x050A8800, 0x38000004, 0x00180005, 0x02000807, 0xAE120538, 0xCC0010A4, 0x0004030A, 0x050B2000,
+0xD0A60004, 0xD0E5FFB0, 0xD1E6FFB1, 0x000C18B2, 0x10000028, 0xCE05F000, 0xD0E6FFB6, 0xD3E7FFB7,
+0xD3E3FFB4, 0xD4E5FFAF, 0x2CE0FFB3, 0xE4F370D7, 0xC2D1E6FF, 0x310CF0FF, 0x10B9D4DF, 0x0A000023,
+0x60140000, 0xFFA0B2BE, 0x0740D5E4, 0xB0FFAE20, 0xD3E93100, 0x001B20B0, 0x38000C40, 0xDE04F10C,
+0xE5FFB4D0, 0x3FFFD8DC, 0x0FFF4237, 0xCAFF1404, 0x0D08BFBB, 0x1005AC01, 0x8211A4CF, 0xCEE5FFAD,
+0xCCE3FFAE, 0x78080598, 0x0B140104, 0x4CA9CF21, 0x09500009, 0x00000404, 0x3C040520, 0x00080105,
+0x50A8CE21, 0x0B100410, 0x000B2004, 0x6800001C, 0xCFE74404, 0x0004FFAB, 0x03048C01, 0x6C000AA4,
+0x43CC0000, 0x0005B400, 0x04040008, 0x04B40000, 0x00006C00, 0x30000080, 0x00040012, 0x00062C00,
+0x44001138, 0x00BC020C, 0x1260AB12, 0x00C4D010, 0x2200040A, 0x1748D1E7, 0x01002800, 0x2403127C,
+0x00840100, 0xFFAAD030, 0x50000048, 0x00040400, 0x0011B404, 0x040000B0, 0x1C5C0000, 0x70000401,
+0xDFFFA7CB, 0x7CFFA7CC, 0xCBDE205D, 0xD8001C6C, 0x8CAC1105, 0x139C017E, 0xAAC901F0, 0xACCDE0FF,
+0xA9CADDFF, 0xA8CBDFFF, 0x14D4DDFF, 0x8CA9CC21, 0xC9DF20B0, 0xA91105E8, 0xDD401EEC, 0x2CFFA1C5,
+0x54DE1005, 0xA2CC800A, 0xC3D0E0FF, 0x04DCDFFF, 0xFFC5D369, 0x04C6D4E1, 0xD5E23500, 0x010010C7,
+0xD683000C, 0xD6E3FFC8, 0x08E1FFC8, 0xE303F000, 0xE3FFC6D6, 0xE4FFC5D7, 0xD9FFC4D6, 0xD6FFB8C9,
+0x420F18C6, 0xCDDDFFBC, 0xEA310004, 0x2520CBDB, 0xDAE704F1, 0xD9E6FFCA, 0xD7E4FFC9, 0xD9E6FFC7,
+0xD9E9FFCB, 0x930004CC, 0xFFCDDAEA, 0xFFCDD9E9, 0x310004E7, 0x0CCCD8E6, 0xDAE8B100, 0xDBE8FFCE,
+0xDAE7FFCD, 0x000008CC, 0x2C00000C, 0x00040000, 0xCADAE931, 0x08000054, 0x00040000, 0x04001400,
+0x10000004, 0x005C0100, 0xFFCADA31, 0xDAC0000C, 0xDBEBFFCA, 0xDAEAFFCB, 0x14EAFFC9, 0xC8D96100,
+0xC9D9E9FF, 0x08000598, 0x00180100, 0xC9DC00F0, 0xC7DDEAFF, 0xC9DCEAFF, 0xC6DCE9FF, 0x7711DCFF,
+0xFFC6DCEA, 0x04C5DBE9, 0xFFC45500, 0x04C3DAEA, 0xD9E96200, 0xD7E7FFC2, 0xE2600AA8, 0xE3FFBDD4,
+0x300A88D3, 0xB0E5FFBC, 0xBBD5300A, 0xF10014FF, 0xBFD5E000, 0xC9DCE3FF, 0xCEE0E4FF, 0x9FADAEFF,
+0x4CF12CF8, 0xFFD3E2DD, 0xFFD8E8E5, 0xFFC5D9D7, 0xFF415755, 0xFF4D6361, 0xFF96A6A5, 0xFFE2F0F0,
+0xFFDCECEB, 0xFFE0F0EF, 0xFF778786, 0xFF243735, 0xFF687A7A, 0xFFDBEDED, 0xFFA2B6B5, 0xFF99ADAE,
+0xFF92A5A9, 0xFF4C5F63, 0xFFDFF2F8, 0xFFB7CAD0, 0xFF465960, 0xFF3A4E57, 0xFF1B2E3C, 0x041C3240,
+0x0B04000A, 0x40104400, 0xFFBAD9EB, 0xEA310AE0, 0x0AF4B8D9, 0x000AF800, 0xEA440004, 0x04FFB9D8,
+0xD8EC4500, 0x0004FFB9, 0x0CB8D922, 0x00080F00, 0xD9ED8F00, 0xDAEDFFBA, 0x0008FFB9, 0x001C0002,
+0x0100040F, 0x0500300F, 0x00001808, 0xDA40000C, 0x74ECFFB9, 0x00040700, 0x40055802, 0xD7ECFFB5,
+0x08020524, 0x05240000, 0xB6D6EB31, 0x1C000B7C, 0x05CC0105, 0x000B9403, 0x04010010, 0xB5D52100,
+0xE9310538, 0x0530B4D4, 0x1B000804, 0x000010EB, 0x9C000018, 0xD3E84004, 0x0BDCFFB3, 0xB6D2E731,
+0xA400EAA8, 0x0004050A, 0xFFB5D4A1, 0xFFBBD1E8, 0xD8BBD1E6, 0x04FC0006, 0xD8E70CF1, 0xD2E3FFB7,
+0xF4FFFFB7, 0xD0E3FFE3, 0xD2E1FFC1, 0xD6E2FFB8, 0xE8EFFFBE, 0xF0A008D9, 0xE9F0F801, 0xA5B3BCFF,
+0xB8D8E5FF, 0xB1D8E9FF, 0xB10660FF, 0xFFB5D5EA, 0xFFB3D6EC, 0x1CB2D6EC, 0xDC05F00C, 0xDFFFB7CE,
+0x55FFDAD9, 0x0EFF6550, 0x8AFF2A07, 0x10FF957D, 0x0090000D, 0xB0D0E571, 0xB2D2E7FF, 0xE440058C,
+0x04FFB0CF, 0x00140000, 0xAFCFE440, 0x020A50FF, 0x28020498, 0x044C0010, 0x0104A004, 0xCF2104C4,
+0x000FA8A9, 0x040404E0, 0x04F80000, 0x01000400, 0xD01204B0, 0xC4001764, 0x003C0204, 0x11004800,
+0x001074AC, 0x980204F8, 0xFFAD2404, 0x0C0109AC, 0x78D21212, 0x06640000, 0x00001000, 0xA8020BA0,
+0x4CAE150B, 0xD3E83111, 0x001208AD, 0x1000001C, 0x00040012, 0x08123000, 0x6C000004, 0x0010040C,
+0x00002000, 0x1C000004, 0x0004000B, 0x00001800, 0x60021190, 0x1108000B, 0x0017BC02, 0xB8000BA0,
+0xCFE2200A, 0xAD511120, 0xABCFDFFF, 0xDBB12B50, 0xDEFFACCC, 0xDFFFB1CE, 0x2160B4D1, 0xD2E008F1,
+0xDDEBFFB6, 0xDEECFFC6, 0xE0EEFFC8, 0xE3F2FFC9, 0xDAE8FFC9, 0x3106A8BE, 0xA4AAC7D7, 0xC9DE9010,
+0xCADFFFAE, 0x90EAFFAF, 0xB7D32112, 0xD87118E4, 0xDAFFA5C4, 0x26A8A5C5, 0xD1DF00F1, 0xD3DEFFC5,
+0xD3DFFFC5, 0xD4E0FFC7, 0x480004C8, 0xFFC9D5E1, 0xE2B90004, 0xE3FFCAD6, 0xE1FFCBD7, 0x0008CBD8,
+0x00001400, 0x1AF004D4, 0xFFCBDBE8, 0xFFBECEDD, 0xFFB1C1D0, 0xFFB7C7D6, 0xFFBBCBDA, 0xFFBFCFDE,
+0xFFCBD8E8, 0xFFCEDCE9, 0xFFD0DEE9, 0xFFCFDDE8, 0x6104D4E6, 0xEAFFCFDB, 0x0004D0DC, 0xD2DEECB1,
+0xD2DCE8FF, 0xD3DDE9FF, 0xE7310008, 0x0008D1DB, 0x35001000, 0x18D4DEEA, 0x00240000, 0x00000400,
+0x04080018, 0x00240100, 0xFFD4DC44, 0x220004E9, 0x000CD3DD, 0x03000800, 0x24010004, 0xD1DD2300,
+0xD0E0004C, 0xD2DBEAFF, 0xD1DDEBFF, 0xD4DDECFF, 0x840080FF, 0xFFD1DFEA, 0xFFCFE0EA, 0xECB50008,
+0xECFFD1DF, 0xEBFFCFDF, 0x0004CEDE, 0xCCDEEA40, 0x530004FF, 0xFFCDDFEB, 0xA00004ED, 0xFFCBDDEB,
+0xFFCADCEA, 0x0174DBE9, 0x0564C811, 0x710AA404, 0xFFC5D8E6, 0xFCC4D6E0, 0xEC69F02C, 0xD7FFDAE9,
+0xA7FFC8D6, 0x97FF9BAA, 0xD0FF8A9A, 0xD1FFBFD2, 0xEFFFBED4, 0xFAFFD9F2, 0xEBFFE4FD, 0xF3FFD9ED,
+0xBBFFE2F5, 0x83FFAABD, 0x4DFF7285, 0x3AFF3C4F, 0xF0FF283C, 0xBEFFDDF1, 0xBFFFABBF, 0xC5FFAABE,
+0x85FFB0C4, 0xE0FF6E81, 0xF6FFC8D9, 0xA2FFDDEE, 0x9BFF899A, 0x64FF8293, 0x3FFF495A, 0x3EFF2133,
+0x91FF1C2F, 0xFCFF6B80, 0xECFFD3EA, 0xE8FFC0DB, 0x6CFFBBD8, 0xDAEA72F8, 0xD9E9FFBD, 0x650004BC,
+0xEAFFBDD8, 0x0004BED9, 0xBDDAEC46, 0x130004FF, 0x0E000CBB, 0xED8F0008, 0xEDFFBEDB, 0x08FFBCDB,
+0x1C000300, 0x00040F00, 0x00300601, 0x0E006402, 0xEE400058, 0x04FFBBDA, 0xDAEC2000, 0x040A001C,
+0x1CEB1000, 0xBAD93C05, 0x000008FF, 0x300005D0, 0x00080805, 0x52053002, 0xD7EBFFB7, 0x000A84B8,
+0xD72110E4, 0x000B08B6, 0xEB100AD8, 0x100710F0, 0x11000100, 0x00001003, 0x04010BB4, 0xB6D7A200,
+0xB3D8E8FF, 0xB4D9E9FF, 0xD8610004, 0xD6E9FFB7, 0x000004BB, 0xE671006C, 0xE9FFB4D8, 0xB078B7DB,
+0xF5FF17F0, 0xD3E4FFE2, 0xD7E3FFC0, 0xD8E1FFBB, 0xE7EFFFBD, 0xF2F8FFDA, 0xEFF6FFED, 0xB3BCFFEC,
+0xDBE6FFA9, 0xDAEAFFBD, 0xBBC005B8, 0xBBD5ECFF, 0xBAD9EEFF, 0x88D7ECFF, 0xFFBA3006, 0xF10864E0,
+0xFFE9DA03, 0xFF72494D, 0xFF4A0C11, 0xFF7C4D57, 0x3CD2D9E9, 0x16C40011, 0x22F03000, 0x0A74D3E8,
+0xB3D2E733, 0xB1120510, 0xD2250A9C, 0x0115E0AF, 0xBC000AC0, 0x1014010A, 0x64FFAD20, 0x04480009,
+0x13000409, 0x210018D1, 0x16C4ADD1, 0x00046C00, 0x040404C8, 0x056C0000, 0x0004DC00, 0x60000608,
+0x0618000B, 0x01061001, 0xB41111F0, 0x9400061C, 0x00140400, 0x00000800, 0x24001230, 0x00300106,
+0x70B2D521, 0x05E80106, 0x04120C00, 0xD7100BB4, 0xB29505EC, 0xB1D7ECFF, 0xB0D6EBFF, 0x8C000004,
+0x00040011, 0x00003C00, 0x0400004C, 0x07A40000, 0x0006CC00, 0x84001610, 0x00040017, 0xB2D3E440,
+0xF10004FF, 0xAFCFDE30, 0xB4D1E1FF, 0xB0CCDAFF, 0xB4D0DCFF, 0xBDD5E1FF, 0xC4DCE6FF, 0xCBE1ECFF,
+0xD2E6F1FF, 0xD4E8F1FF, 0xD5E7F1FF, 0xDDEBF4FF, 0xDAE8F1FF, 0xD7E8F0FF, 0xD8EAF4FF, 0xD5E9F4FF,
+0xCDE0EEFF, 0xD6314988, 0x246CB2C8, 0xBED3E431, 0x08000E10, 0xD3E52000, 0x0AF113CC, 0xC8D9FFB7,
+0xCEDDFFAE, 0xD2DEFFB4, 0xD4DDFFC6, 0xD5DEFFC7, 0xD5DFFFC8, 0x400004CB, 0xFFCCD6E0, 0x10000004,
+0x00080000, 0x71000400, 0xFFCDD7E1, 0x04CED8E2, 0xD9E34100, 0x0004FFCF, 0xFFCDDA40, 0xF109D0E4,
+0xFFCCDC07, 0xFFC1D1E0, 0xFFAFBFCE, 0xFFB3C0D0, 0xFFBAC7D7, 0x3CC2CFDF, 0xD7E2B10A, 0xDCE5FFC9,
+0xDEE7FFCF, 0x400004D1, 0xFFD4DEE8, 0x04000494, 0xDFEBB100, 0xDDE8FFD5, 0xDEE9FFD5, 0x310008D6,
+0x08D4DCE7, 0xDFEA4000, 0x0004FFD7, 0x0F001800, 0x31010004, 0x34D6DFE8, 0xE0E96F00, 0xDEE8FFD7,
+0x30040004, 0x28FFD6DF, 0x00040400, 0x00002C00, 0xEB310054, 0x005CD8E0, 0x00000C00, 0xE9100004,
+0xDF300084, 0x0008FFD5, 0x0100040F, 0xD2DFE848, 0x200004FF, 0x05B0DEEA, 0x00055000, 0xD06005AC,
+0xD1DDE9FF, 0x310014FF, 0x20D2E0ED, 0x053800C1, 0xDCE944F1, 0xD8E1FFCC, 0xDCE3FFCA, 0xE4E7FFCD,
+0xDEDEFFD6, 0xADADFFD0, 0xA6A3FF9F, 0x7371FF96, 0x8886FF60, 0xAFACFF74, 0xAEABFF96, 0xF3F0FF95,
+0x8986FFDD, 0x4D4BFF73, 0x5553FF39, 0x403EFF41, 0xA4A2FF2C, 0xDFDEFF90, 0x9594FFCB, 0x696AFF81,
+0x6264FF55, 0xF10F4850, 0xD8E7EE18, 0xCCDBE2FF, 0xC9D6DEFF, 0x56636CFF, 0x1F2D36FF, 0x243441FF,
+0x203240FF, 0x182B3AFF, 0xB2C7D8FF, 0xC3DDECFF, 0xED201528, 0x701078DE, 0xDAE9FFBD, 0x04E7FFC0,
+0x0AB40000, 0x00000407, 0x04000018, 0xDAEB4F00, 0x0004FFBF, 0x05480001, 0x0F000400, 0x0A01001C,
+0xC0480014, 0x04DAEBFF, 0x84BF1100, 0x003C0005, 0x00000400, 0x0800002C, 0xDBEE3100, 0x000018C0,
+0x4C000008, 0x05A00005, 0x18000400, 0x4B0080ED, 0xEBFFBEDB, 0x2C000004, 0x05C80000, 0x22054800,
+0x0528DBEA, 0x4E000808, 0xFFBCD9EB, 0xBA400004, 0x18D8EDFF, 0x00080E00, 0x0D0B1C00, 0xDA210004,
+0xF07CD4B9, 0xB6DBEB02, 0xB8DCECFF, 0xBADBECFF, 0xBED9ECFF, 0x0634EBFF, 0xFCBBDB21, 0xDBEA3104,
+0xF1009CBA, 0xDDF2FF00, 0xC3D6E7FF, 0xBFDBE7FF, 0xBFDAE3FF, 0x00001E00, 0xF42CF105, 0xBBFFEEEF,
+0xE5FFAAB5, 0xE9FFC0DD, 0xEFFFB9DD, 0xEDFFBFDA, 0xECFFC0D6, 0xEDFFBCD7, 0xEDFFBDD8, 0xE0FFC0D9,
+0xDAFFCCD2, 0x45FFF7D4, 0x20FF8444, 0x5FFF731D, 0xE8FF9657, 0x0B60D9DB, 0xB6D5E932, 0xD62105C4,
+0x7308ACBA, 0xFFB8D4E9, 0x04B5D4E9, 0xFFB42000, 0x040804A8, 0x04C00100, 0x24B2D221, 0x04C80005,
+0x04000401, 0x0C001000, 0x00040310, 0x0104F000, 0xD4000038, 0x16DC0016, 0x20000401, 0x11C0FFB7,
+0x00000400, 0x04000C30, 0x11D40000, 0x00073800, 0xE4710C44, 0xE5FFB8D3, 0x175CB9D4, 0x00000C00,
+0x1800120C, 0x00140000, 0x00000400, 0xF40011E4, 0x00040096, 0x22117401, 0x0C68B9D8, 0x20111801,
+0x117CFFB5, 0xB5DAED40, 0x420004FF, 0xFFB4D9EC, 0xB6200004, 0x000690FF, 0x50001224, 0x00040012,
+0x11123802, 0x001240B9, 0x0CF101F8, 0xFFBFDBE9, 0xFFBBD7E5, 0xFFB9D3E0, 0xFFBAD1DF, 0xFFC4DAE7,
+0xFFC9DDE8, 0xE0CFE1EB, 0xEAF13104, 0xF20170DB, 0xDAE7ED00, 0xDCE7EDFF, 0xDFE8EDFF, 0xDDE5E8FF,
+0x00F00004, 0xEAFFDAE3, 0xF2FFD9E4, 0xF7FFDDEA, 0x9CFFDEEC, 0xCCD9B50E, 0xD3E2FFBC, 0xD2E1FFC3,
+0x000008C2, 0x0CF11390, 0xFFC8DAE8, 0xFFC6D8E6, 0xFFC7DAE8, 0xFFC8D2DC, 0xFFCAD4DD, 0xFFCBD5DE,
+0x04CCD5DE, 0xD6DFB100, 0xD5E0FFCD, 0xD4DFFFCD, 0x000004CC, 0x0400000C, 0xD6E1B200, 0xD7E2FFCE,
+0xD8E3FFCF, 0xF10004D0, 0xFFCFD913, 0xFFCCD8E4, 0xFFC1CFDA, 0xFFBFCDDA, 0xFFC0CEDB, 0xFFC2CEDC,
+0xFFBAC6D4, 0xFFBECAD8, 0x60C3CFDB, 0x05380005, 0xD2DCE6A6, 0xD2DCE5FF, 0xF0DEE7FF, 0x04DC0104,
+0x40048003, 0xFFD4DEE7, 0xE8100004, 0xE070048C, 0xE1EAFFD6, 0x04B4FFD8, 0x00000400, 0x0400000C,
+0x000C0000, 0x1304D000, 0x1004DCE6, 0x4F0500E7, 0xE8FFD8E1, 0x5F100004, 0xFFDAE1E9, 0x000004EB,
+0xDBE2EC80, 0xDBE2EAFF, 0x010008FF, 0xE34F0004, 0x04ECFFDA, 0xEB400400, 0x40FFD9E2, 0x00040005,
+0x08053C00, 0xED400004, 0xD0FFD7E1, 0xEC08F105, 0xE9FFD4E0, 0xE5FFD3E0, 0xE6FFD0DD, 0xE0FFD3E0,
+0xE8FFD1DC, 0x95A8DCE8, 0xDAE9E671, 0xE3F3F2FF, 0x58F22CEC, 0xFFB8CECC, 0xFFCBE4E1, 0xFF7F9593,
+0xFF2F4845, 0xFF374D4B, 0xFF324846, 0xFF3E5452, 0xFFE2F8F6, 0xFFA3B7B6, 0xFF96AAA9, 0xFF798B8D,
+0xFFE4F6F8, 0xFFCCDBDE, 0xFFBDCAD0, 0xFFD1DEE4, 0xFFABB6BC, 0xFF96A0A9, 0xFF3B454E, 0xFF1B2934,
+0xFF223241, 0xFF243644, 0xFF6A7D8C, 0xFFD4EAF8, 0xFFCAE1EF, 0xFFC8DFED, 0xDCC7DFEB, 0xC7DD210F,
+0x4C000248, 0xDBE94002, 0x0004FFC8, 0x020FE400, 0xC54F0004, 0x04DCEAFF, 0xE94F0700, 0x04FFC4DB,
+0xE8170500, 0x20041014, 0xDBEB4110, 0x0004FFC4, 0xFFC2DC43, 0x000004EB, 0xEE310594, 0x0010C3DD,
+0xC2DCED71, 0xC1DCEDFF, 0xEB6F0004, 0xEAFFC1DD, 0x000004DB, 0xFFC0DC30, 0x0400001C, 0x053C0000,
+0x3CDCEA22, 0xDCEA8905, 0xDCECFFBF, 0x0008FFBF, 0x00055803, 0x04050028, 0xBFDC3000, 0x000568FF,
+0x080C002C, 0x00140000, 0x00000408, 0x04020584, 0xBD06F200, 0xBDDCEEFF, 0xBEDDEFFF, 0xC0DDEFFF,
+0xC4DAEFFF, 0xC3D9EEFF, 0x07F105B4, 0xECFFC1DE, 0xEEFFBDDD, 0xFFFFC2DD, 0xE9FFDCEF, 0xECFFC6D7,
+0x03A0C5DC, 0x00230000, 0xF331D724, 0x0198EBEE, 0xC2DFE7B1, 0xBEE0EAFF, 0xC2DBEFFF, 0xF1310040,
+0x000CC6DC, 0xF1050000, 0xD7D3E208, 0xFFCFD6FF, 0x87292AFF, 0x9B3334FF, 0xD58D91FF, 0xDAD8E5FF,
+0x98000B60, 0x05E40010, 0x00057400, 0xEA720004, 0xEBFFBCD7, 0x0004BAD6, 0x000ADC00, 0xCC000AD8,
+0x0004080A, 0xE4B9D521, 0x044C001B, 0x01000401, 0xF80C1BC8, 0xC8B9111B, 0x04C4000A, 0x011C5000,
+0xD5610004, 0xD6E4FFBE, 0x200004BF, 0x0474D5E3, 0x1CACC111, 0xBFD2E040, 0x310004FF, 0xDCC3D6E4,
+0x0CEC000C, 0xD0E2F0C0, 0xD4E6F4FF, 0xD3E5F3FF, 0x010CF4FF, 0xD61017F4, 0xC3110764, 0xE6D0D468,
+0xE5FFC1D8, 0xE7FFBED8, 0xE7FFBDD9, 0xDA300C6C, 0x0660FFBA, 0x21113401, 0x05DCB7DA, 0x31065000,
+0x40BADAE9, 0xD8E6600B, 0xD9E6FFBC, 0xC0600074, 0xBED4E1FF, 0x000080FF, 0xF0711D24, 0xF1FFCEE1,
+0x0D60D1E3, 0xF10E5000, 0xC9DAE434, 0xD6E4EDFF, 0xD9E6EEFF, 0xDEE9EFFF, 0xE2EBF2FF, 0xE2E9EFFF,
+0xE3E8ECFF, 0xE3E7EAFF, 0xE7E8ECFF, 0xE9EAEEFF, 0xEAEBEDFF, 0xEBECEEFF, 0xE8ECEFFF, 0xE4E9EDFF,
+0xE3ECF1FF, 0xE1EBF4FF, 0xCAD7E0FF, 0xE1600ED4, 0xDBFFC7D3, 0xC018C4CD, 0xD5E3FFC7, 0xD2E2FFC9,
+0xD7E4FFC6, 0x02F5138C, 0xD1DEFFC9, 0xD2DBFFC3, 0xD3DCFFC8, 0xD4DDFFC9, 0x000004CB, 0xFC000508,
+0xD3DE3104, 0x040508CB, 0x000404FC, 0x05040505, 0xFFCFD930, 0x40010F1C, 0xC5D1E10F, 0xBBC7D5FF,
+0xBCC8D6FF, 0xC3CFDDFF, 0xD9310018, 0x0A48C1CD, 0x0004F800, 0xFC0004B8, 0x00040404, 0x0109F800,
+0x00030004, 0x04F80005, 0x39050004, 0x00D7E1EA, 0x04F80005, 0x00050000, 0xEC080004, 0xE2E95B04,
+0x04E7FFD9, 0xE3E84800, 0x0004FFDA, 0xDCE5EA62, 0xE4E4E9FF, 0x05040004, 0x00000400, 0xEB4104F0,
+0x04FFDCE3, 0xDEE24300, 0x0004EBFF, 0xDDE1EA31, 0x2000050C, 0x00040400, 0x0100300C, 0xE2A10524,
+0xE3EDFFDB, 0xE4EEFFDC, 0x000004DD, 0x0400000C, 0x00A00000, 0xF1000400, 0xD8E2EB00, 0xD7E2E8FF,
+0xDBE6EAFF, 0xD0DBDDFF, 0x58F10004, 0xFFDBE7E7, 0xFFE2F1EE, 0xFFCCDCDB, 0xFF9AADAB, 0xFF708483,
+0xFF384C4B, 0xFF1A302E, 0xFF1B312F, 0xFF1F3533, 0xFF586E6C, 0xFFC3D7D6, 0xFF6F8382, 0xFFB1C5C4,
+0xFF647877, 0xFF7F9191, 0xFFBDCFCF, 0xFF808F92, 0xFFB5C3C6, 0xFFD1DFE2, 0xFFB3C1C4, 0xFF96A1A5,
+0xFFAEB9BF, 0xFF727F88, 0xFF192734, 0xFF1C2C39, 0xA0374957, 0xEC00F126, 0xEFFFCBDE, 0xEEFFCEE1,
+0xEDFFCFE3, 0x0740CFE1, 0x100FE400, 0x700FE8E8, 0xE9FFCFE0, 0xCCFFCDDF, 0x0004010F, 0xFFCCE04F,
+0x080004EB, 0xCBDFEA4F, 0x010004FF, 0xCADEE940, 0x000004FF, 0x040F1538, 0x54000200, 0x00040015,
+0x43155400, 0xEBFFC6DC, 0x4C08000C, 0x05780005, 0x08157400, 0xD0000004, 0x00040F11, 0xDDEA4F01,
+0x0004FFC3, 0xC5DC210A, 0x6C000AFC, 0x00040805, 0x450B0800, 0xFFC3DFED, 0xDF430008, 0x04EBFFC3,
+0xDEEC3100, 0x0004D4C2, 0x040104D8, 0xDE03F100, 0xDFEFFFC1, 0xDEEFFFC2, 0xDCEFFFC3, 0xDBECFFC7,
+0x4105B4C6, 0xFFC5E1EF, 0xDF61002C, 0xECFCFFC5, 0x311B94DB, 0x04C7DEEC, 0xE9F071B9, 0xF2F7FFDA,
+0xF12804E9, 0xA9B6BC04, 0xC4E1E7FF, 0xC0E0EBFF, 0xC4DEEFFF, 0xC5DCEEFF, 0x11F0060C, 0xFFC6E0EF,
+0xFFC3DEF1, 0xFFDFD4E4, 0xFFFFACAF, 0xFF8F1C19, 0xFF871B19, 0xFFF9B2B6, 0xFFDAD7E0, 0xFC0005E0,
+0x06300008, 0x00064800, 0x04011660, 0xB0D81000, 0xB4BF1110, 0xD8E94010, 0x0004FFBD, 0xBDD6EA31,
+0x08041BB8, 0x04C80000, 0xBFD7E340, 0x000004FF, 0x0404000C, 0x21440000, 0x00000C00, 0x10002150,
+0x8CE310D9, 0xD813F121, 0xDCE8FFC4, 0xE4EEFFCA, 0xE9F3FFD2, 0xEBF5FFD8, 0xE4EFFFDA, 0xEAF5FFD6,
+0xE5F0FFDC, 0xD6DFFFD7, 0xF11300C9, 0xD7E4ED04, 0xE3F0F9FF, 0xE5EFF9FF, 0xE1EBF5FF, 0xE7F1FBFF,
+0x14F10004, 0xFFDEE8F2, 0xFFD6E0EC, 0xFFD5E1ED, 0xFFD6E2EE, 0xFFD4E2ED, 0xFFC8DAE6, 0xFFC6DAE5,
+0xFFC3D9E6, 0x70C2DAE6, 0x00CC010C, 0xFFBEDB30, 0x80010BB8, 0xBFDBE111, 0xBFD9E8FF, 0xC0D8E4FF,
+0xC5DBE8FF, 0xE8710270, 0xE3FFCCDE, 0x1314C8D9, 0x00137800, 0xF0310D44, 0x0070DCE6, 0xECF507F0,
+0xE4EBFFE3, 0xE7EFFFDB, 0xEBF1FFE0, 0xEAEEFFE6, 0xE9EEFFE5, 0xE9C20008, 0xECECEEFF, 0xEEEEF0FF,
+0x04ECEFFF, 0xEDEEE000, 0xE8E9FFEF, 0xE9EBFFEA, 0xEBEEFFE9, 0x1CF00514, 0xE3E9FFE5, 0xCFD8FFDC,
+0xD4DEFFC6, 0xCCD8FFCA, 0xCFDBFFC2, 0xCEDDFFC5, 0xC9D8FFC5, 0xCAD9FFC0, 0xCCDBFFC1, 0xCBD7FFC3,
+0xFCDDFFC1, 0xCAD42113, 0xEC000EF4, 0x0004000E, 0x31003400, 0x3CC9D3DD, 0x0EF80000, 0x0009BC00,
+0xE4480004, 0x04FFCED8, 0xD9E5B100, 0xDAE6FFCF, 0xDAE3FFD0, 0x000EE0CD, 0xC00013A0, 0x00240013,
+0xCCD6E240, 0xA20004FF, 0xFFCDD7E3, 0xFFD3DBE6, 0x0004DCE5, 0xD4DDE494, 0xD6DDE5FF, 0x0EB4E6FF,
+0xF4D6DF25, 0x05000009, 0x42000400, 0xFFD6E0E9, 0xD7110004, 0x50000A00, 0x00040804, 0x00050000,
+0x980104F8, 0xDAE32104, 0xE8400500, 0x04FFD9E4, 0xE5E93100, 0x000008DA, 0xE740000C, 0x04FFD8E3,
+0x050C0800, 0x0D050800, 0xE3210004, 0x400130DC, 0xFFDBE2E8, 0x3C000004, 0xE4EA4001, 0x0004FFDD,
+0x00001000, 0x04000008, 0x052C0100, 0x61053404, 0xECFFDCE3, 0x0004DDE4, 0xE0E4ED31, 0x90000548,
+0xE6ED3100, 0x0001B8DD, 0xC00000A4, 0x006C0001, 0x050CE410, 0xFFDCE650, 0x2804ECEC, 0xFFDA06F1,
+0xFF7B8989, 0xFF758584, 0xFF677777, 0xFF829494, 0x0897A7A7, 0xF11CF132, 0xFFFFE1F1, 0xC3FFEFFF,
+0x43FFB1C3, 0xB6FF3143, 0x50FFA4B6, 0xA9FF3E50, 0xBFFF97A9, 0xD0FFAEC1, 0xCCFFBED0, 0xD1FFBCCC,
+0x2D38C1D1, 0x8E8D1DF0, 0x8B8BFF7E, 0x8991FF7B, 0x6571FF7C, 0x2B36FF59, 0x1E2BFF1D, 0xE7F4FF0E,
+0xE5F2FFD7, 0xE2EFFFD5, 0xE7F1FFD2, 0xE3ECFFD6, 0x30A4FFD5, 0xD6E3EB40, 0x000004FF, 0x04000010,
+0xE3EE7100, 0xE4EEFFD5, 0x000020D3, 0xEB350010, 0x000CD4E2, 0x04001000, 0x18000004, 0x00040F00,
+0xE1EA3105, 0x00B998D3, 0xEC40B99C, 0x04FFD1E2, 0x0CAC0000, 0x04000409, 0x640F056C, 0x5C040405,
+0x05840005, 0x48000C00, 0xFFCADDEB, 0x9C000004, 0xDEEB401A, 0x0004FFC8, 0x71000C00, 0xFFC6DEEA,
+0x04C5DDE9, 0x000C0000, 0xE8E0EC26, 0x05380F0A, 0x04A80001, 0xC4DEEB31, 0x08000AE4, 0x00040000,
+0xC3DEE960, 0xA8DFEAFF, 0xFFC5A004, 0xFFC6E0ED, 0xFFC5DFEC, 0xEA510018, 0xE9FFC2DE, 0x6C000004,
+0x0B3C0205, 0xC9E1ED31, 0x10F10EE8, 0xFFC6E3EB, 0xFFC5E0E9, 0xFFD7E9F5, 0xFFC9DBE7, 0xFFC7DFE9,
+0xFFC5DCE4, 0xFFDAECF0, 0x04E4F2F5, 0xB8BFC43C, 0xE5EBFFA7, 0xE1EAFFC8, 0x0574FFC0, 0xF0006C00,
+0xC4E0EB13, 0xC0E0EFFF, 0xE8DBE5FF, 0xEC8483FF, 0x9C1710FF, 0x7D1A15FF, 0xFFD3D4FF, 0xDBD8DFFF,
+0x90D9E4FF, 0xFFCBD100, 0xFFD9EDF8, 0xFFDEF0FC, 0x70D6E8F4, 0xD9E73116, 0x001C5CC7, 0x54002160,
+0xD6E39016, 0xD8E7FFC0, 0x30EDFFC5, 0xCBDE2139, 0x00F10DC4, 0xFFC6D7E1, 0xFFCADBE3, 0xFFD3E4EC,
+0xD4D9EAF4, 0xD8E22001, 0xC4201CB8, 0x000944FF, 0x07F0D2B4, 0xFFDBE9F4, 0xFFDEEBF4, 0xFFDCE9F1,
+0xFFE3EDF6, 0xFFE6F1F7, 0x00B4EFF5, 0xE328E611, 0xE3ECF371, 0xDEE7EEFF, 0x640002F4, 0xF0F622BB,
+0xF360E1F8, 0xF4FFE8ED, 0x1105DCEE, 0x000008EA, 0x08F1000C, 0xFFEBEFF8, 0xFFECF0F9, 0xFFEAEEF7,
+0xFFE6EFF6, 0xFFE0EDF5, 0xE4D9E7F0, 0x00780017, 0x50221000, 0xFFC2D8E5, 0x700EBCE8, 0xE7FFC3DA,
+0x10FFC2D9, 0x00180100, 0xFFC9DBE1, 0xFFDFEDF8, 0xFFE6F3FC, 0x7CE9F3FC, 0x1A380000, 0x80007400,
+0xFFDEE5ED, 0xFFE4E9EF, 0x00F10074, 0xFFE8EBF2, 0xFFE7EAEF, 0xFFE9ECF1, 0xE8ECEDF1, 0xEBF02209,
+0x00F104F8, 0xFFEDEBEE, 0xFFEFEDF0, 0xFFF4F0F1, 0x04F2EEEF, 0xED1CF100, 0xEDFFEEEC, 0xF0FFEBEB,
+0xD8FFEBEC, 0xE4FFD0D3, 0xE1FFD7DE, 0xD6FFCFD8, 0xDEFFC3CB, 0xDCFFC9D1, 0xDAFFC7CF, 0xD5FFC3CA,
+0x0004BEC5, 0xBFC8D771, 0xC2CBDAFF, 0xEC040508, 0x04FC0004, 0x00000408, 0xF40004FC, 0x00040013,
+0x0905000F, 0xCEDBE435, 0x04040500, 0x05180005, 0x35000400, 0x00D0DAE4, 0x04FC0105, 0xFCD5DE21,
+0x05000A04, 0x0504D513, 0x0804F806, 0xEA3204F0, 0x0A0CD9E0, 0x0F10DF12, 0xD9E0E840, 0x00046CFF,
+0x940009A0, 0xF0EA1004, 0x05000009, 0x00000807, 0x7C000508, 0x00040804, 0x0104CC00, 0xE222050C,
+0x030A10DB, 0xF00404E4, 0xE5EB2204, 0xEC000200, 0x00040404, 0x00001C04, 0xF0000010, 0x01A40004,
+0x00000400, 0x0400000C, 0x00180000, 0xDBE0E671, 0xDEE3E9FF, 0x10000544, 0x0A700000, 0xF1B88400,
+0xDEE7EC00, 0xD7E0E5FF, 0xD9E3E5FF, 0xD7E1E3FF, 0xA000C290, 0xDA08F1A9, 0xE1FFCCDA, 0xECFFD3E1,
+0xB3FFDDEB, 0xEEFFA4B2, 0xE8FFDFED, 0x0010D9E7, 0xDDDE00F1, 0x4141FFCF, 0x7575FF31, 0xB1B1FF65,
+0xA031EC9F, 0xFFBBCECC, 0xFFBCCFCD, 0x2830CAC9, 0xC8FFBCD1, 0xB8FFB9C9, 0xB2FFA9B9, 0xC2E0A5B5,
+0x979D18F1, 0x8690FF8C, 0x737CFF7C, 0x2D39FF66, 0xA0ACFF21, 0xF0FCFF94, 0xE5F1FFE4, 0xE3ECFFD9,
+0xE4EDFFD6, 0xE5EBFFDA, 0x010598DA, 0xE5650008, 0xE5EDFFDA, 0x000004D8, 0xEC710C60, 0xEEFFDBE6,
+0x0028DBE5, 0x00003004, 0x180F0010, 0x48000500, 0x00280000, 0x75004808, 0xFFD7E4EC, 0x04D6E5EC,
+0x05740100, 0xFFD5E462, 0x04D7E5EE, 0xD5E64300, 0x0004EEFF, 0xD4E5ED40, 0x000004FF, 0xB8000010,
+0x00040003, 0x00054400, 0x44000004, 0x00040005, 0x00000C00, 0x4C090004, 0xCFE16905, 0xCDE1EAFF,
+0xE8400004, 0x04FFCBDF, 0x0A8C0000, 0x00000400, 0x08000544, 0x00040000, 0x710FF000, 0xFFC9DFEA,
+0x04C8DEE9, 0x000C0000, 0x00000400, 0xE7400010, 0x04FFC8DF, 0xDCE5B100, 0xDDE6FFC8, 0xDEE7FFC9,
+0xF10048CA, 0xCBE2E808, 0xCEE2E9FF, 0xD1E2EAFF, 0xD2E3EBFF, 0xD3E4EBFF, 0xCDE0E6FF, 0xE6404CB0,
+0x84FFCCE1, 0xE0E83115, 0x503BF8D3, 0xFFCFE2E6, 0xD04110EE, 0xF8FFE7F2, 0xBFFFE5F2, 0xE9FFA6B7,
+0xF10048E1, 0xEEFFC422, 0xEEFFC7E1, 0xEAFFC8E3, 0xE2FFC8E3, 0xEDFFC0DB, 0xE4FFC6E2, 0x50FFF2DD,
+0x15FFCF55, 0x48FFAD1F, 0xDBFFA44C, 0xD6FFFFDB, 0xE9FFD5D3, 0x0540D5E4, 0xEAF7FD60, 0x7CF4FAFF,
+0xA8E61104, 0xE9F23104, 0x0004B4DF, 0x0C001964, 0x0694000E, 0xEAF301F0, 0xF1FAFFDD, 0xEFF8FFE4,
+0xE7F0FFE2, 0x8C84FFDD, 0x000DF400, 0xB400048C, 0xEDF6C0EB, 0xE8F1FFE4, 0xE9F2FFDE, 0x000CFFE0,
+0x40000400, 0xFFEAF3FA, 0x0CF104D4, 0xFFE7EEF4, 0xFFECF1F5, 0xFFEDF2F6, 0xFFEBF0F4, 0xFFEBF0F3,
+0xFFE9EEF1, 0x04EAEFF2, 0xF004F100, 0xF0FFE8ED, 0xF3FFE9ED, 0xF5FFECF0, 0xF3FFEEF2, 0x0E5CEEF2,
+0xEFF102F0, 0xF2F6FFEE, 0xF1F5FFF1, 0xEEF2FFF0, 0x74EFFFED, 0xE7EB700E, 0xE6EBEFFF, 0x500054FF,
+0xFFE1EAF1, 0x430D64ED, 0xECFFD7E1, 0x80000714, 0xE2EE4007, 0x170CFFD0, 0x31051800, 0x90C8D6DF,
+0x24280002, 0xEDF6FD60, 0x54F3F9FF, 0xFFED5100, 0xE8EEF1F6, 0x09E00004, 0x310EC400, 0xC8ECEDF2,
+0x04CC0004, 0x0004FC00, 0xF1C0007C, 0xF2FFEFEF, 0xF3FFF0F0, 0x0CFFF1F1, 0x00040100, 0xFFF0EE30,
+0xF17209FC, 0xF2FFF0EE, 0x0A18F1EF, 0xFFEBEC61, 0xC8CBD0D4, 0xDFE77108, 0xDDE6FFD8, 0xF113A8D4,
+0xCAD2DF04, 0xC2C9D9FF, 0xBAC1D1FF, 0xB6BDCDFF, 0xB5BECDFF, 0x0800519C, 0x1900000A, 0x04000400,
+0xF8001E00, 0x0ED4001D, 0x001DDC00, 0x0C080004, 0x13EC0000, 0x40000404, 0xFFCDD9E5, 0x08000004,
+0x04E80019, 0x0009FC00, 0x60000500, 0x0004001D, 0x00000C00, 0x000413F4, 0x0500040A, 0x000F0800,
+0xFC000004, 0x0F000113, 0x1904DD13, 0x18F4DD12, 0xD9DFEB48, 0x500004FF, 0xFFDBDFEA, 0x2104FCE9,
+0x0008DADE, 0x71001000, 0xFFDCE0EB, 0x80DEE2ED, 0x05080009, 0x00050400, 0x18080514, 0x051C000A,
+0x0404A400, 0xDC050004, 0xDDE1210E, 0xEC4409B0, 0xCCFFDFE3, 0x06FC0004, 0x32000400, 0x28DCE5EC,
+0xDBE43004, 0x00000CFF, 0x080509D0, 0xDEE72100, 0xD8001570, 0x04E00004, 0x0104E800, 0x07F10004,
+0xEBFFDDE4, 0xEAFFE0E8, 0xE9FFDFE7, 0xE8FFDEE6, 0xE9FFDCE6, 0xA4BCDDE7, 0xDADC14F1, 0xCED0FFD0,
+0xE0E2FFC3, 0xC8CAFFD5, 0xB5B7FFBD, 0x4747FFAA, 0x3B3BFF3B, 0x5353FF2F, 0x9393FF47, 0xF1050085,
+0xC9D7D838, 0xCDDDDDFF, 0x718181FF, 0x778787FF, 0xB0C0C0FF, 0xA9B9B9FF, 0x95A5A5FF, 0xA6B6B6FF,
+0xA8B8B8FF, 0xB5C3C3FF, 0xC2D0D0FF, 0xBCCBC8FF, 0xBDCCC9FF, 0xAEBDBAFF, 0xA7B3B3FF, 0x818C92FF,
+0x8E97A0FF, 0x78828BFF, 0x72715A24, 0xFFFF5E68, 0x04F8EBF5, 0x00031C00, 0xB00000C4, 0x05E00000,
+0x00000404, 0x40010014, 0x16440016, 0x300AB400, 0x14FFDDE6, 0x00280000, 0x0000F000, 0x100000D8,
+0x00EC0000, 0x00000800, 0x080F0018, 0x2C000100, 0x00040100, 0xFFDBE630, 0x7000052C, 0x00040FD2,
+0xE5EB4005, 0x0004FFD8, 0xD7E6ED48, 0x000004FF, 0x04000580, 0xE8EF1000, 0xD9E66111, 0xD8E5EEFF,
+0xEF400004, 0x04FFD8E6, 0x05400400, 0x08040000, 0x1000000C, 0x05380000, 0x43000401, 0xECFFD2E5,
+0xDC000004, 0x0004000D, 0x124CED10, 0x0A94E310, 0x1000D011, 0xD0E2EC40, 0x710004FF, 0xFFD0E3EA,
+0x04CEE1E8, 0xE0E73100, 0x001550CF, 0xEC001648, 0xEE00F106, 0xF2FFE1E8, 0xF5FFE4ED, 0xF5FFE7F0,
+0x0428EAF2, 0x71E5FC00, 0xFFE7EFF2, 0x94E7F1F3, 0x089400B5, 0xEAEDF231, 0xF171EB1C, 0xEEFFE6EE,
+0x0454E6EB, 0xE8EFF771, 0xAAB4BEFF, 0xE9312048, 0x0AB0CBDD, 0xDDE72CF1, 0xE2E6FFC5, 0xDFE2FFC9,
+0xDDE2FFCA, 0xE1E1FFCE, 0x1F16FFFF, 0x180EFFA5, 0x7C78FFAB, 0xDDDCFFC3, 0xE6E7FFF2, 0xF3F5FFE8,
+0xF7FAFFEB, 0xF2F5FFF2, 0xEFF2FFED, 0xF1F4FFEB, 0x000480ED, 0xA400000C, 0x04A00004, 0x049CF110,
+0xFFE7EC40, 0x000990F2, 0xF15204C4, 0xEFF4FFEE, 0xAC0004A8, 0x00040004, 0x21002C01, 0xE6B0EAED,
+0xEDF0F575, 0xEFF2F7FF, 0xBC000004, 0xF0F43104, 0x3104C8EF, 0x50F1F2F4, 0xCCF01004, 0xEE01F004,
+0xEEEFFFEA, 0xF0F1FFEA, 0xF1F2FFEC, 0xE4F3FFED, 0xF1F3A104, 0xF0F2F1FF, 0xEFF1F0FF, 0xEF400004,
+0x34FFEEF0, 0x001C0000, 0xE8EA00F1, 0xE5E7FFE7, 0xEAECFFE4, 0xEFF0FFE9, 0x0000B0EB, 0xA800009C,
+0xEBF1330E, 0x110574E4, 0x000EC8E3, 0xE6B105AC, 0xE0FFD3DD, 0xDFFFCDD7, 0x13C4CED9, 0x00058800,
+0x48000580, 0x00940005, 0x0000E400, 0xFC000574, 0xECED7104, 0xEEF1FFE8, 0x000058EA, 0x9400005C,
+0x00080000, 0xEFF0F240, 0x0400ACFF, 0xE80013E8, 0x0030000E, 0xECEDEFB1, 0xEBEAEFFF, 0xEDECF1FF,
+0x34001410, 0xCBCFB10A, 0xE0E6FFC6, 0xDCE4FFD9, 0x001D1CD5, 0x0CF1044C, 0xFFD5DBE7, 0xFFCED6E3,
+0xFFC6CDDD, 0xFFBBC4D3, 0xFFB3BCCD, 0xFFB5BECF, 0x04BAC6D6, 0x0F08000F, 0x0C000400, 0x0C000508,
+0x0F9C0005, 0x00000800, 0x04040508, 0x05180000, 0x00000400, 0x1C00050C, 0x0004000A, 0x400F1004,
+0xFFD1DAE9, 0x10040004, 0xDAE52005, 0xD31118F8, 0xE520058C, 0x0209ECDE, 0xFC050004, 0xD6DC8004,
+0xD6DCE8FF, 0x0500E9FF, 0xFCD8DE27, 0xFFDB3004, 0x0004FCEB, 0xDE5004F8, 0xDDE8FFDA, 0xDA600B64,
+0xDADEE9FF, 0x310500FF, 0x04DDE1EC, 0x05000005, 0x2104FC01, 0x0A18DAE1, 0x00000C00, 0x00000014,
+0x00040105, 0x0013DC08, 0x000013E0, 0x053C0005, 0x00050003, 0xDC000504, 0x00040003, 0x000EB400,
+0x0400054C, 0x03D80000, 0x00051400, 0x08010018, 0xDFE82D00, 0x60010500, 0xDEE6220A, 0xE51204F8,
+0xEB400508, 0x04FFDFE9, 0xE8EA3100, 0xF104F8DE, 0xB2BDBF08, 0x8E9C9DFF, 0xA5B0B2FF, 0x808E8FFF,
+0xB2BEBEFF, 0xEEFAFAFF, 0x00F11914, 0xFFD5E3E3, 0xFFB6C4C5, 0xFFBDCDCD, 0xF099A9A9, 0x8484B104,
+0x7B7BFF74, 0x7070FF6B, 0xB195E860, 0xFFC0CECF, 0xFFD4DFE1, 0x4CC7D2D4, 0xD618F505, 0xE1FFCBD5,
+0xB0FFD6E0, 0x75FFA5AF, 0xBBFF6973, 0xE2FFABB4, 0x9CFFD0D9, 0x35FF8A93, 0x55FF232C, 0xFFFF434C,
+0x0CD0EEF7, 0xDFE6EC75, 0xE1E6EAFF, 0x48000004, 0x001400C3, 0x0000D400, 0x140004E0, 0x00100005,
+0x00000400, 0x0404000C, 0x00100000, 0xE0E7ED40, 0x040008FF, 0x08000014, 0x00100000, 0x00000400,
+0x0404000C, 0x05F00000, 0x31052400, 0x80DCE7EB, 0x000808C3, 0x08006401, 0x0C000018, 0x05780000,
+0x00000803, 0x64000168, 0x00040001, 0x00009400, 0x0C000004, 0x05500200, 0x1BE8DB11, 0x31000C08,
+0x14DCE6EF, 0x00080000, 0x43056C05, 0xECFFD8E7, 0xA0000004, 0x00040C09, 0x00057008, 0x70000AA4,
+0xE5EAB109, 0xE7EAFFD6, 0xEBEEFFD9, 0x001238E3, 0x58000344, 0x08F40008, 0xEFF3F4B1, 0xF2F2F4FF,
+0xF1F1F1FF, 0xF4606DD8, 0xF6FFF3F5, 0xD10414F5, 0xF0F3FFEE, 0xF2F3FFF2, 0xF4F6FFF4, 0x000414F3,
+0xFC000034, 0xF308F11D, 0xC4FFE9EC, 0xF6FFB5B9, 0xF3FFE4EA, 0xF0FFDDE7, 0xE7FFD3E3, 0xABB4CBDD,
+0xF1D88C00, 0xE0DCD91C, 0xF4BDB8FF, 0xA41409FF, 0x9C0900FF, 0xEDB3B1FF, 0xF1E7E6FF, 0xF3F2F0FF,
+0xF2F4F3FF, 0xF1F3F2FF, 0xF2F2F2FF, 0xF4F4F4FF, 0xF2720004, 0xF0FFF3F1, 0x0004F0F0, 0xFFEFF170,
+0xFFEFEFEF, 0xFC000488, 0xEEEE3112, 0x0004C0EE, 0x140000A4, 0x00040609, 0x2CFFF020, 0x00040004,
+0x0004EC00, 0x640104B0, 0xD0F01204, 0xF4F63200, 0x2200D0F4, 0x0934F2F2, 0xEEEE01F0, 0xE9EBEAFF,
+0xE7EBEAFF, 0xE8ECEBFF, 0x0504EFFF, 0xF5008800, 0xFFF1F303, 0xFFF0F2EF, 0xFFEFF1EE, 0xFFF2F4F1,
+0x10EEF0ED, 0xE5E47105, 0xE3E2FFE3, 0x000038E1, 0x9400099C, 0x09AC0404, 0x31059000, 0x34ECF1F7,
+0x061000F1, 0xE6EDF531, 0x90001750, 0x02340004, 0x0004F800, 0xD8000024, 0x00C80009, 0x4000A000,
+0xFFE8E9EB, 0x040004F8, 0xEBEC3100, 0x04000CE7, 0x00000590, 0x00180005, 0x00001000, 0x00F1001C,
+0xFFE3E8EB, 0xFFE4E9EC, 0xFFE2E7EA, 0x7CE2E7EB, 0xEBF0B106, 0xE8EDFFEA, 0xE3E8FFE7, 0xF20014E0,
+0xC7CCD214, 0xD3DAE0FF, 0xCFD6DCFF, 0xD3DAE2FF, 0xD2D9E3FF, 0xD0D6E2FF, 0xCCD2DEFF, 0xC4CCD9FF,
+0xB9C2D1FF, 0xBF610500, 0xC5D5FFB3, 0x001904B9, 0x04001908, 0xD2DF3100, 0x0024A4C4, 0x040424A8,
+0x18DC0100, 0x18C6D421, 0x05080015, 0x04000404, 0x2004050C, 0x0500040F, 0xD0D9E840, 0x000004FF,
+0x04000F00, 0xDBE57105, 0xDBE4FFD1, 0x001DFCD1, 0xE720060C, 0x110218DD, 0x002790D3, 0xEA4027B8,
+0x04FFD6DC, 0xDDEB4000, 0x0004FFD7, 0xD8DEEA48, 0x040004FF, 0x04010518, 0xD8DF300A, 0x080F10FF,
+0x90041DC8, 0x00080418, 0x04188800, 0x14000004, 0xE0E94400, 0x0004FFDC, 0x000A0400, 0xFC0018EC,
+0x00040009, 0x0104FC00, 0xE5210A20, 0x0009F0DC, 0x04040500, 0x09040000, 0x0C03BC00, 0x18000004,
+0x00040000, 0x0004FC00, 0x04000008, 0x01DC0004, 0x710A0000, 0xFFE1E9EC, 0x00E0EAEC, 0xEB40F105,
+0xE4FFDEE9, 0xDBFFD7E2, 0x77FFCAD8, 0x81FF6574, 0xB7FF707E, 0xBAFFA7B7, 0xB8FFACBA, 0xBBFFAAB8,
+0xC2FFAFBE, 0xC6FFB6C5, 0xAAFFB5C8, 0x8DFF99AC, 0x43FF7C8F, 0x91FF3245, 0xABFF8191, 0xDFFF9BAB,
+0xC7FFCEDC, 0xD0FFB6C4, 0xDAFFC1CC, 0x119CCCD5, 0xB7BD09F0, 0x6C72FFB0, 0x656BFF67, 0x4950FF60,
+0x2228FF46, 0xBFC5FF1D, 0x1144FFBA, 0xFFFF00F1, 0x565EFFF9, 0x272FFF4F, 0xFBFFFF20, 0x31163CF4,
+0x14E3E8EE, 0x1B300002, 0x02000402, 0xB0000238, 0x203C000A, 0x00000400, 0x4C0000BC, 0x00040402,
+0x00052C04, 0x6C000010, 0x0008001B, 0x0600040F, 0xFCE0E822, 0x0008050A, 0x0B08DE11, 0x0005FC00,
+0x08000110, 0x01140400, 0x00000800, 0x04040618, 0x007C0100, 0x0560EA12, 0x08008400, 0x78000004,
+0x00040405, 0x04016000, 0x24000004, 0x05200000, 0x04019400, 0x0C000008, 0x00040400, 0x00058400,
+0x0400053C, 0x00200000, 0x00000400, 0x0404000C, 0x01B00000, 0xB101B804, 0xFFE0E9EE, 0xFFE4EEF0,
+0x34ECF1F4, 0x04D80004, 0xF2F0F131, 0xF13103E8, 0x0478EEF2, 0xF1F0EE40, 0x310014FF, 0x08F2F2F0,
+0xF3F03109, 0x230018F1, 0x0010F1EF, 0x000D9400, 0x07F10510, 0xF3FFF0EE, 0xC9FFEDEE, 0xFFFFC1C1,
+0xFEFFF7F5, 0xF8FFEFF1, 0x218CE5ED, 0xEAEB0CF1, 0xE5E1FFDC, 0xE5DBFFE6, 0x8275FFFF, 0x150AFFD1,
+0x110AFFAC, 0xDFE0FF9C, 0x00054CFF, 0x6C0004E4, 0xEFED4104, 0x0070FFEF, 0xFFF4F330, 0xEF710060,
+0xF3FFF4F0, 0x0014F6F5, 0xEDEDEB80, 0xEDECEAFF, 0x000024FF, 0xF140057C, 0x20FFF4F3, 0x00040405,
+0x0000A400, 0x3C04000C, 0x05B80005, 0x00051400, 0x64000550, 0x05100104, 0x210EC000, 0x0EC0F2F3,
+0xF11D3800, 0xE8E7EC04, 0xE7E7E9FF, 0xE5E6E8FF, 0xE6EAEBFF, 0xE9EDEEFF, 0x04000A04, 0xEFEE3105,
+0x0100F0EB, 0xF3620594, 0xEFEEFFF1, 0x3005A0ED, 0x00FFF1F3, 0xE4E6710A, 0xE8E9FFE3, 0x00000CE4,
+0x94041378, 0xEFF34018, 0x0578FFEE, 0x1004E400, 0x210A88F4, 0x13D4E8ED, 0x0018C000, 0xD8000F78,
+0x09E0000A, 0x00008000, 0xBC000500, 0x0004001D, 0x0004E000, 0xEC000004, 0x00040004, 0x00000C00,
+0x940009F8, 0xEAED3200, 0x211DDCE6, 0x1DFCE5EA, 0x001DE400, 0x6C0102C0, 0x07D80012, 0xE0E313F1,
+0xD9DCE3FF, 0xD7DAE1FF, 0xD6DBE1FF, 0xC5CACEFF, 0xC7CCD0FF, 0xCED3D7FF, 0xD4D9DFFF, 0xD5DAE0FF,
+0xE5410A0C, 0x08FFD3D9, 0xC1CA610F, 0xBDC6D5FF, 0xD62A09FC, 0x040500C6, 0x08000504, 0x00040405,
+0x00050008, 0x04040A0C, 0x05080400, 0x00050004, 0x040018F8, 0xD7E64000, 0x0004FFCE, 0x00051000,
+0x08000004, 0x0F200005, 0x01050804, 0xDC160F14, 0x04002CF8, 0x00040405, 0x0F0CEA13, 0x030A1C05,
+0x6800281C, 0x1E040822, 0x01142008, 0x98002294, 0xB8E11322, 0x22CC0022, 0x22ECE312, 0x00053400,
+0x340C1008, 0x0A180014, 0x0004F801, 0xE2291404, 0x000EF4DB, 0x04000890, 0x03280405, 0x04035C08,
+0x48000340, 0x00200414, 0x00039C00, 0xED311F98, 0x040CE2EA, 0xF10F0004, 0xDBE6E800, 0xD0DEDFFF,
+0xC0CFD2FF, 0xC2D1D4FF, 0x49F00008, 0xFF98A8A8, 0xFF879797, 0xFF92A2A1, 0xFFA3B2AF, 0xFFA3B3B0,
+0xFFA7B7B4, 0xFF9CACAB, 0xFF869695, 0xFFC1D1D0, 0xFF9DABAC, 0xFF9BA9AA, 0xFFA8B6B9, 0xFFC0CBD1,
+0xFFB2BBC2, 0xFF868F98, 0xFF5A616B, 0xFF383C47, 0xFF3C404B, 0xFF666874, 0xFF6C6E7A, 0xFF585B64,
+0xFF82868F, 0x04000774, 0x8F00F105, 0x35FF8087, 0xFFFF262D, 0xEDFFF7FE, 0xEEB4E2E7, 0x0204F802,
+0x0C002034, 0x04CC0400, 0x03046005, 0x1800074C, 0x04F00000, 0x0000040C, 0x04080018, 0x00200800,
+0x10001800, 0x070FFCEA, 0x9C000004, 0x00040902, 0x00006000, 0xAC000020, 0x8CE71302, 0x0008030A,
+0x00004000, 0x08000050, 0x05780400, 0x00000800, 0x34000014, 0x12600003, 0x00000C00, 0xED2202F4,
+0x000300E8, 0x140005D4, 0x00080000, 0x00001800, 0x0400003C, 0x00140000, 0x04000800, 0x20000004,
+0x00140100, 0xFCE0E521, 0x0AF8000A, 0x00005C00, 0x18000004, 0x0DB40000, 0x250E7001, 0x0500EDF1,
+0x00044400, 0xF400098C, 0x044C0008, 0xF5F4F231, 0xEF3609EC, 0x0410F1F1, 0x000A1803, 0xF33104B8,
+0x0948F3F3, 0x000A0400, 0x01F003FC, 0xFFC0C1C6, 0xFFF3F1FC, 0xFFEDEBF8, 0xFFE4EBF5, 0x10F21858,
+0xFFE4EEEF, 0xFFF6ECE3, 0xFFFFECDB, 0xFFB34E3A, 0xFFA40C00, 0xFFB4302B, 0xFFFFEBED, 0x74E8EBF0,
+0xF2F4210E, 0xEC3109E0, 0x12D4ECEC, 0x0012D800, 0xD8000004, 0xEEEF8004, 0xEDEDFFF0, 0x09F4FFED,
+0x0004D801, 0x84000074, 0x05AC0000, 0x08F2F021, 0x00280005, 0x01000400, 0x1C000090, 0x13280000,
+0x58F1F121, 0x0EC8000A, 0x0005D000, 0x340009AC, 0xE6EAE00E, 0xE1E6FFE5, 0xE0E5FFE0, 0xE1E5FFDF,
+0xE6510934, 0xE5E9EAFF, 0x70000B04, 0x0E540004, 0x0104F000, 0xEF210E70, 0x400E78ED, 0xFFEBEDEC,
+0x48000040, 0x0EF80005, 0x00053400, 0xE9312280, 0x1878E6E7, 0x20189400, 0x002CEDEF, 0x0560EE11,
+0x0009E000, 0x04081028, 0x14540000, 0x210EB801, 0x0EACEAEB, 0xEAEAEC40, 0x040548FF, 0x18000500,
+0x04FC0005, 0x00000400, 0x58000088, 0x09F4000A, 0xE9ED08F1, 0xE9ECFFE8, 0xE4E9FFE5, 0xE2E6FFE1,
+0xE2E8FFDD, 0xE1E7FFDD, 0x040004DC, 0xE531000C, 0x0010DBDE, 0xDBE0E480, 0xD0D5D9FF, 0x400F04FF,
+0xFFD6DBDF, 0xDEB50010, 0xE2FFD5DA, 0xE4FFD7DC, 0x0A04D5D9, 0xB122A400, 0xFFB6C2D2, 0xFFAFBCCC,
+0x04C2D0DD, 0x04FC0000, 0x35000408, 0x18C4D2DD, 0x141C0032, 0x212D2001, 0x1F24C9D6, 0x041F2800,
+0x28000004, 0x00040019, 0x001DF000, 0xE5400004, 0x04FFCDD6, 0x36CC0000, 0x010F2000, 0x28001424,
+0xCEDB302D, 0x40192CFF, 0xFFCEDAE6, 0xE9710004, 0xE8FFCFDB, 0x31F0D0DC, 0x04051404, 0x24040008,
+0x2D2C000A, 0x081E1400, 0xE6750004, 0xE7FFD5E0, 0x0004D6E1, 0x001E2C02, 0x3400193C, 0x00040023,
+0x40FFD820, 0x14640023, 0x00236C00, 0xE000282C, 0x1D940011, 0x00142000, 0x04000EDC, 0x04E40000,
+0x01000400, 0x14001918, 0x1E080719, 0xDAE1E731, 0xDC001544, 0x06680104, 0x21052800, 0x18E4DDE4,
+0x00003008, 0x1000001C, 0x00280800, 0x00B8B400, 0x0CF10E10, 0xFFDEE9ED, 0xFFD5E3E6, 0xFFABBABD,
+0xFF92A4A6, 0xFF76888A, 0xFF758787, 0xF091A3A3, 0xBEBB3109, 0x0090FCAE, 0x48F1E0C0, 0xFFA7B3B1,
+0xFF9EAAA8, 0xFF96A2A2, 0xFF949FA1, 0xFF939EA0, 0xFF8C979B, 0xFF747D84, 0xFF757E87, 0xFF808893,
+0xFF818994, 0xFF8C929E, 0xFF8F95A3, 0xFF828594, 0xFF8B8E9D, 0xFF696D79, 0xFF5F636C, 0xFFF3F8FE,
+0xFFE7ECF2, 0xFFCDD2D8, 0xFF72777D, 0xFFEBF0F6, 0x60E3E6ED, 0xE7EB4003, 0x0004FFE6, 0x0002AC00,
+0x440107B4, 0xE3E8300C, 0x0012ECFF, 0x30040004, 0x00080004, 0x00041800, 0x04000454, 0x000C0000,
+0x0C001400, 0x18000004, 0x00040400, 0x00001C00, 0x040F0C8C, 0xEC310900, 0x07B8E4E7, 0x00000800,
+0xEB200030, 0x2025BCE6, 0x0010FFE3, 0x10000400, 0x210848EB, 0xCDDCE3E7, 0x0005A000, 0x280002EC,
+0x12140003, 0x05031400, 0xE4030008, 0x17280025, 0x21081401, 0x0818E7EA, 0x00003400, 0x38000044,
+0x00040900, 0xFFE4E730, 0x38010018, 0x03E00005, 0x0848E912, 0x920DAC05, 0xF7FFEFF0, 0xF6FFF2F3,
+0x101314F3, 0x0009C8F5, 0xF0120450, 0xD4000E68, 0x047C0004, 0xF4EFF331, 0x00000494, 0x094C0004,
+0x007CE800, 0x0400095C, 0x13140000, 0x2008A800, 0x0930F1EF, 0xBEFFE8D2, 0xF0FFB4BC, 0xEDFFE8E8,
+0x165CE1E4, 0xDEE715F0, 0xDEE8E9FF, 0xF6E4DAFF, 0xFFDAC1FF, 0x9B280DFF, 0xA61206FF, 0xD45A57FF,
+0xFFECF1FF, 0xE5EAF0FF, 0x13D4EFFF, 0x7CECF221, 0x04740009, 0x000ED400, 0x580017EC, 0x048C0009,
+0x00007800, 0x6C000478, 0xF3F53100, 0x000F74F2, 0x80020088, 0x00100000, 0x00000402, 0x040509EC,
+0x0AA80000, 0x210F3400, 0x0ED4ECF0, 0xECF2F040, 0x31044CFF, 0x28E0E5E8, 0xE0E7400E, 0x0434FFDD,
+0xDEE1E850, 0x0A00EBFF, 0x3004C800, 0x6CFFE7E8, 0x1D680404, 0x20000800, 0x1D88E8EA, 0x04E4EB11,
+0x71001000, 0xFFEAE9EE, 0x50E7E6EB, 0xEAEF2202, 0xF8001D9C, 0x0A000004, 0x0000B000, 0xB8000004,
+0x00040004, 0x00056C00, 0xC0000004, 0x01D00001, 0x0001B400, 0x0C0001A0, 0x01980000, 0xE4E5E940,
+0x00058CFF, 0x0401194C, 0x27CC0000, 0xECE8E921, 0x0A20001D, 0x610AA001, 0xE8FFE4E5, 0x05B0E3E2,
+0xDDDEE3B1, 0xD9DCE1FF, 0xD6D9E0FF, 0xE53109EC, 0x3D4CD9DC, 0xD5D9E271, 0xD9DEE4FF, 0x18F10004,
+0xFFD9DEE2, 0xFFD2D7DB, 0xFFC3C8CB, 0xFFD9DDE0, 0xFFD8DCDF, 0xFFD6DADD, 0xFFD4D7DC, 0xFFCED2DB,
+0xFFC6CDD7, 0x9CC2CAD7, 0xD800F52C, 0xD5FFBCC8, 0xDBFFB8C5, 0xDCFFBECE, 0x0504BFCF, 0x08051004,
+0xF4000500, 0x09F00009, 0x030EF405, 0x04003720, 0x04FC0005, 0x311E3800, 0xF4CBD5E1, 0x09FC0022,
+0xCFD8E731, 0x04003BC8, 0x3BDC0005, 0x00050400, 0x2C000004, 0x00040023, 0x13000C00, 0x000500E7,
+0x0400321C, 0x051C0000, 0x00000400, 0xE632000C, 0x322CD0DD, 0x2D30DF10, 0xE6FFD460, 0x3CFFD1DE,
+0x0004000F, 0xD3DEE480, 0xD4DFE5FF, 0x000508FF, 0x00040004, 0x05240005, 0x00000C00, 0x040004FC,
+0x00100000, 0x00285000, 0x30040024, 0x27940005, 0xD8E3E940, 0x000004FF, 0x08002E2C, 0x142C0005,
+0x0004C400, 0xF8000008, 0x1E9C0004, 0xD6DDE331, 0x7000144C, 0x0018000D, 0x00171C00, 0x080004EC,
+0x00040400, 0x71001000, 0xFFE0E5EB, 0x9CE5E9F2, 0x068C00D6, 0x000DF400, 0x04001904, 0xE8EC4005,
+0x1308FFDD, 0xCCD9DFB1, 0xB6C5CAFF, 0xBCCBCEFF, 0x18F20A04, 0xFFCBDBDB, 0xFFC8D8D7, 0xFFC4D2D3,
+0xFFBFCBCB, 0xFFB4BDBC, 0xFFA4AAAA, 0xFFB9BDBE, 0xFFCBCFD0, 0xFFDDE1E2, 0x48FBFFFF, 0xF017F10C,
+0xD4DAFFEF, 0x979FFFD5, 0xA5ADFF97, 0xAFB8FFA5, 0x9FABFFAC, 0x626DFF9D, 0x3945FF5E, 0x3A45FF35,
+0x868CFF36, 0x000A0081, 0x840009F0, 0x308C0016, 0x00000800, 0x6C000730, 0x02640004, 0x14000405,
+0x030A08E7, 0xE7300F08, 0x0420FFE2, 0x00029000, 0xA0040004, 0x17D40002, 0x04000C00, 0xF004052C,
+0x00080004, 0x04051C00, 0x10000004, 0x04FC0600, 0x00005C00, 0x78020B04, 0x00400004, 0x00000401,
+0xE6300488, 0x008CFFE3, 0x00000408, 0x040004FC, 0xD2D40000, 0x0004C404, 0x3000031C, 0x17140003,
+0x01000404, 0xC0000D50, 0xEFF02112, 0x2C00085C, 0x03200003, 0x0004C804, 0x30000890, 0x043C0008,
+0x00042C00, 0x38000988, 0x03840004, 0x20000402, 0x0010FFEC, 0x00002000, 0xF6220448, 0x000430F1,
+0x54000468, 0x1C800004, 0xF0F1F6B1, 0xF1F0F5FF, 0xF0EFF4FF, 0x48000178, 0x05000000, 0x001C5C00,
+0xE000216C, 0x00140208, 0x44FFEE20, 0x0F2C0013, 0x00004800, 0x7C000050, 0xF1F1B100, 0xF0EFFFEB,
+0xB9BBFFE7, 0x3105D8B1, 0xACE4E7EE, 0x0B08012B, 0xE6EA0CF0, 0xFFE6DBFF, 0xFFAE91FF, 0xA01B00FF,
+0xA41A0DFF, 0xEF8784FF, 0xFFE5E9FF, 0x001948FF, 0xF2311D74, 0x1D78ECF2, 0x00013000, 0x980006AC,
+0x00040009, 0x0000E800, 0x08040108, 0x000C0006, 0x0018E800, 0xD80105B8, 0xEEED2113, 0xCC001D10,
+0x09FC0000, 0x000A2000, 0xC40009F0, 0x00980014, 0xE7E705F0, 0xEBEBFFE1, 0xECECFFE5, 0xE4E7FFE6,
+0xDDE1FFDF, 0x20B0FFD8, 0xDADFE571, 0xD7DBE4FF, 0x0C000434, 0xE7EC710A, 0xEBF1FFE6, 0x000004EC,
+0x04001850, 0x04EC0000, 0x00048400, 0xFC000004, 0x00040004, 0x40000C00, 0xFFE6E5EB, 0x74000004,
+0x09E80013, 0x31001801, 0x1CFFEAEA, 0xE9E92100, 0x9C001E1C, 0x00BC0001, 0x0004F400, 0xE87101DC,
+0xE5FFE1E5, 0x011CDDE0, 0x40020400, 0xFFDEE1E6, 0x440004D0, 0x10380000, 0xEBECF150, 0x1408EEFF,
+0x30058400, 0x90FFE7E8, 0xE3E93100, 0x000AA4E4, 0x07F03D30, 0xFFD9DADF, 0xFFDDDDE5, 0xFFDFDFE7,
+0xFFDADAE2, 0xFFD8D8E0, 0x28B0DAE3, 0xFFD311F3, 0xFFD5D8E1, 0xFFD9DDE6, 0xFFD2D7DD, 0xFFD1D6DA,
+0xFFCED3D6, 0xFFC2C7CA, 0xFFDCE0E3, 0x04FCD9DE, 0xD1D404F1, 0xCDD1DAFF, 0xCBD2DCFF, 0xC8D0DBFF,
+0xC3CDD9FF, 0x300500FF, 0xECFFB7C4, 0xCEDC7145, 0xD0DDFFBC, 0x000004C0, 0xDB7131CC, 0xDCFFC2D0,
+0x191CC4D0, 0x000F0800, 0x0804140C, 0x41080000, 0x00000400, 0x14002D4C, 0x0A180005, 0x00359000,
+0xDA20050C, 0x113268CE, 0x310F00CA, 0x08D3DCED, 0x190C0000, 0x000F0400, 0x2C000F0C, 0x0004001E,
+0x00141000, 0xA40104CC, 0xD3DD3904, 0x0309F8FF, 0xBC003208, 0x00040004, 0x00283C00, 0x3C00002C,
+0x09CC0019, 0x04000800, 0x10001E4C, 0x0F0C0000, 0x0009E800, 0x100009DC, 0x00200000, 0x4009EC00,
+0xFFD3DCE3, 0x100009F8, 0x00080000, 0x00000400, 0x18000020, 0x0F4C040A, 0x03000801, 0x2C002350,
+0xDBE3800F, 0xDBE4FFD4, 0x0028FFD2, 0x000F5800, 0x18000520, 0x05040000, 0x3127E800, 0x58E1E5EE,
+0x0D5C000E, 0xF024AC00, 0xE5E8F105, 0xE5E7F3FF, 0xE6E9F2FF, 0xE2E5EAFF, 0xDFE5E5FF, 0x310274FF,
+0x70E1E6E9, 0xEE58F120, 0xD6FFDFE6, 0xD2FFC5CC, 0xD1FFC0C9, 0xCDFFC1CA, 0xD1FFBEC9, 0xE5FFC2CD,
+0xF6FFD6E1, 0xFFFFE5F0, 0xFFFFF0F9, 0xFEFFFAFD, 0xFEFFFAF9, 0xF9FFFFFA, 0xFCFFFDF7, 0xF3FFFFFB,
+0xF9FFFEF4, 0xF8FFFFFB, 0x95FFFFFB, 0x36FFA997, 0x5BFF4636, 0x44FF6A5C, 0x27FF4F45, 0x44FF2A26,
+0x53FF4242, 0x84FF4E4F, 0xBAFF7F80, 0x045CB3B7, 0x000C6C00, 0xE0040084, 0x096C010D, 0x070E7C00,
+0x8C00047C, 0x00040002, 0x0004EC00, 0x0C000004, 0x0A180000, 0x012A3C00, 0xEC120448, 0x78000CE8,
+0x043C0016, 0x000A3000, 0x28000394, 0x00040000, 0x00000C00, 0x080002D4, 0x04BC0000, 0x00000400,
+0x940002D0, 0x02C40009, 0x000DD000, 0x04001690, 0x08200000, 0x0002E000, 0xD0000008, 0x00040402,
+0x00002C00, 0x78001BA8, 0x000C0005, 0x00008800, 0x08011280, 0x20FC000D, 0x001C9400, 0xEC1025F4,
+0xEA110878, 0x100003E0, 0x04900009, 0x00086804, 0x78000008, 0x00340008, 0x00174000, 0x240104E0,
+0x0DF40000, 0x1848F112, 0x00090C00, 0x48000410, 0x0EAC000E, 0x00000C00, 0x48001844, 0x093C0200,
+0x1CECF111, 0x00008C00, 0x780000B8, 0x1C940021, 0x00054000, 0x0C000004, 0x19140400, 0x0012AC00,
+0xE0000074, 0x216C0008, 0xF5F3F431, 0xC4000EF8, 0x042C000D, 0x0003C400, 0xBD311904, 0x0400B7B8,
+0x00094800, 0xCC000118, 0xE910F104, 0xDAFFEDE7, 0x57FFFFE4, 0x08FFF378, 0x16FFBD2A, 0xBDFF9F27,
+0xE9FFFFC2, 0xF1FFFFE7, 0x21D4EEEC, 0xE7E9E840, 0x0000C8FF, 0x5C00135C, 0xDCDE711D, 0xE3E6FFDB,
+0x000DF8DF, 0xF4000E68, 0x00900005, 0x00000400, 0xF2420474, 0x04FFEEED, 0xFFEF2000, 0x0000059C,
+0x01000027, 0x0000D800, 0x5400010C, 0xE1E48006, 0xE0E3FFDD, 0x0914FFDB, 0x00AC4C00, 0xE5400004,
+0x04FFD8DF, 0x18900000, 0x00000400, 0xE6310508, 0x04BCE1E2, 0xE9E8ED31, 0xF8000008, 0x00F80004,
+0x00000800, 0xEA6009EC, 0xEDFFE5E4, 0x11315CE7, 0x0009F8E8, 0x040009B8, 0x00DC0000, 0x0000E800,
+0x0400009C, 0x0A480000, 0xE3E4E831, 0x3400051C, 0x00040000, 0x1004D400, 0x610014E9, 0xE9FFE5E6,
+0x04C4E1E1, 0xA004C800, 0xFFDBDBE3, 0xFFDBDEE7, 0x0B00E8EF, 0x0BC8E811, 0x00025800, 0xC80002C0,
+0x0A980018, 0xDEDEE671, 0xD8DBE2FF, 0x08000034, 0xDBE46000, 0xDFE8FFD8, 0xDD5117CC, 0xDADDE6FF,
+0xDD310A08, 0x0048D3D6, 0xF0050400, 0xD1D8E001, 0xD0D7DDFF, 0xCED6D8FF, 0xBBC3C5FF, 0xF10A18FF,
+0xD2D6E100, 0xCCD3DDFF, 0xCAD1DBFF, 0xCBD1DDFF, 0x02F00F00, 0xFFC9CDD6, 0xFFC2C9D3, 0xFFBDC5D8,
+0xFFBAC5DB, 0xF14FD4DF, 0xFFBED103, 0xFFBDCDDC, 0xFFC1D1DE, 0xFFC1CFDC, 0x3CC3D1DC, 0x1E140032,
+0x0004EC00, 0x080004FC, 0x37540000, 0x00000C00, 0xDC004628, 0x1E040009, 0x0109CC00, 0x20004610,
+0xC9D52141, 0xF8002314, 0x0020000E, 0x00000400, 0x10010A00, 0x30D8120A, 0x1408002D, 0x71321000,
+0xFFD1DCE2, 0x1CD0DBE1, 0x0EF00019, 0x250EEC01, 0x09E8D4DE, 0x0004D400, 0x040404AC, 0x04940000,
+0x30000401, 0xD4FFD7DE, 0x09A80013, 0x002D4C00, 0xE8000028, 0x04F40023, 0x0004E400, 0x0C000004,
+0x002C0000, 0x00000C00, 0x1C000EE4, 0x00140005, 0x00000400, 0x040004D8, 0x05380000, 0x003C3C00,
+0x18001904, 0x07100019, 0xCFD6DE60, 0x60D3DBFF, 0xFFCF203B, 0x6800050C, 0x00040000, 0x40193400,
+0xFFE2E6EF, 0x580004F8, 0x02DC000E, 0xA003FC00, 0xFFE5E5ED, 0xFFDFDFE9, 0x2300E0EA, 0xE5FFE330,
+0xEA212D0C, 0xF23388E6, 0xECF0FB50, 0xD5D8E7FF, 0xB9BCCFFF, 0xBFC4D8FF, 0xBCC1D4FF, 0xC2C8D8FF,
+0xA0A7B7FF, 0x818898FF, 0x676E81FF, 0x6A6F82FF, 0x7E808FFF, 0xB6B4C1FF, 0xEDE5F0FF, 0xE5DAE2FF,
+0xC3B7B9FF, 0x8B7D7CFF, 0x594841FF, 0x3C2821FF, 0x402722FF, 0x452C27FF, 0x442F2AFF, 0x312320FF,
+0xEEE8E8FF, 0xFBFBFDFF, 0x04030DBC, 0x12CC0021, 0x00009401, 0x20001B20, 0xE1E62134, 0xE5200084,
+0x021D90E1, 0x10000F08, 0x16980021, 0x0003EC00, 0x780104C0, 0xC8E81004, 0xE0EA1120, 0x03DC000C,
+0x00050400, 0x84000004, 0x00080011, 0x21049801, 0x171CE8EC, 0x000CCC00, 0x080009A0, 0x00040000,
+0x0004BC00, 0xEA400104, 0xE4FFE4E5, 0x05000004, 0x00000800, 0x000002F4, 0x00040005, 0x00050000,
+0x1C000020, 0x001C0003, 0x00002400, 0x840005A8, 0x00400000, 0x00047C00, 0x9C000054, 0x0070000D,
+0x00000408, 0x040004DC, 0x04E80000, 0x0004B400, 0x0C000004, 0x00A80000, 0x00048C04, 0x8C0005B8,
+0x043C0012, 0x00001C00, 0xF80404E4, 0x14F01004, 0x18C00326, 0x00001800, 0x44000504, 0x00040013,
+0x01042C00, 0x680009D0, 0x30340005, 0x2CE7EB21, 0x09680010, 0x00046000, 0xC4000004, 0x03D80008,
+0x00000800, 0x20000098, 0x007C0004, 0x00000400, 0xE8310E18, 0x1840E6E6, 0x00050000, 0xF67104FC,
+0xBEFFEEEE, 0x12DCB4B7, 0xF0065401, 0xFFE6E714, 0xFFEAE9E7, 0xFFF4EADE, 0xFFFFDCC4, 0xFFD3401F,
+0xFFB81700, 0xFFB65243, 0xFFFFE5E1, 0xFFF0DEDE, 0x500000B4, 0x18880000, 0x0004FC00, 0xD00000C8,
+0x09FC0000, 0x00093400, 0x480001A4, 0x00840009, 0x01009400, 0xEC210004, 0x0021F0ED, 0x98010500,
+0xEDEB2105, 0x0C001420, 0x04FC0000, 0x0000B400, 0x48000038, 0x02000004, 0xDADFE340, 0x000008FF,
+0xE4310CA0, 0x0A00D9E1, 0xECE3E620, 0x15180229, 0x00002C00, 0x680004C8, 0x0C280005, 0x01000800,
+0xE7220004, 0x320988E6, 0xC4FFE3E4, 0x10A40E01, 0x0001BC00, 0x10000134, 0x01E40002, 0x30051801,
+0x08FFE5E6, 0x0A580005, 0x71000400, 0xFFE1E2E7, 0x70E0E3EA, 0x18A4000F, 0x3109B800, 0x90D4D7E0,
+0x03580013, 0x0004F400, 0xB000075C, 0x13B00000, 0xDADDE431, 0xE40009D0, 0x03940004, 0xD9DBE7B1,
+0xD4D8E1FF, 0xD4D6E2FF, 0x080004D4, 0xDAE33105, 0x000AC0D6, 0x10010FC4, 0x24D7100A, 0xFFD7D10E,
+0xFFD3DCE1, 0xFFD3DCDB, 0x34B7C0BF, 0xD3DF3100, 0x3109F4CF, 0xFCC8D1DA, 0xD5E0B104, 0xD2D7FFD1,
+0xCDD3FFCF, 0x312810C8, 0x9CBFC7DC, 0x54E0006A, 0xC3D3E331, 0x040045C4, 0x37300014, 0x0004FC00,
+0xC4000A04, 0x0A140036, 0x000F1004, 0xDA710014, 0xDAFFC4D1, 0x3BE0C6D0, 0x204B4000, 0x3804D1E1,
+0xEE98CA11, 0xC7D5DEB1, 0xC9D7E0FF, 0xCAD8E3FF, 0x6C0032DC, 0xD7E77137, 0xD8E8FFCB, 0x000004CC,
+0x0C000EF8, 0x0EC80041, 0x44050000, 0xFFD0DAE3, 0x08000500, 0x00040000, 0x00050C00, 0x040004D8,
+0x05000400, 0x00000800, 0xFC0009B0, 0x1DE0001D, 0x00099400, 0x100018D8, 0x00040000, 0x0009A800,
+0x140004D0, 0x051C0005, 0x00002000, 0xF03118E8, 0x27F0E1E8, 0x03002C01, 0x180036B4, 0x1E48001E,
+0x31001400, 0x04E7EAF1, 0x0E30000E, 0x32022800, 0x30D8DDE3, 0xD9DE2115, 0x5C00156C, 0x0BBC0010,
+0x00002000, 0xDC000294, 0x00040401, 0x0001F000, 0xE80006E0, 0x07B00003, 0x10164800, 0x0011D0F0,
+0x5CF00CDD, 0x62FFF9FC, 0x53FF4549, 0x5FFF3134, 0x5EFF383C, 0x62FF373B, 0x71FF3B3F, 0x6CFF4A4E,
+0x69FF4347, 0x5EFF3F43, 0x4DFF3539, 0x2DFF2B30, 0x2DFF1416, 0x4EFF1E19, 0x7CFF473F, 0xA1FF8176,
+0x97FFADA1, 0x4DFFAB9C, 0x39FF6754, 0x38FF5940, 0x34FF563D, 0x3EFF4B38, 0xFAFF4A3E, 0xDFFFF7F5,
+0xE9FFD3D6, 0xF2FFD7DA, 0xF6FFDEE4, 0x78FFE7EE, 0x124C0025, 0x000FB000, 0x9C04198C, 0x2D98000F,
+0x0005B400, 0x14002F54, 0x05280014, 0x000A2000, 0x04001648, 0xE6500000, 0x00082C00, 0x680002F0,
+0x02D00003, 0x00078800, 0x08002064, 0x00040400, 0x040E9400, 0x600002E8, 0x08880003, 0x00039400,
+0xBC000038, 0x00380002, 0x04030400, 0x38040558, 0x001C0000, 0x0002E000, 0x0400013C, 0x000C0000,
+0x0005A801, 0xE0040E20, 0x267C002F, 0x2125F400, 0x0808E9ED, 0x00004C04, 0x04040068, 0x03F80100,
+0x000A1C00, 0x7C001404, 0x122C032B, 0x00088400, 0x080003B4, 0x00900000, 0x00131800, 0x08001324,
+0x090C0000, 0x010E1400, 0x10000008, 0x44EF1218, 0x04F80026, 0x000F5400, 0x580009E4, 0x00F80000,
+0x0404E000, 0x4800006C, 0x00040000, 0x00001000, 0x1C00001C, 0x01240004, 0x00040401, 0x90001328,
+0x0DA80017, 0xECE8E921, 0x22380009, 0x000F0000, 0xBD732834, 0xE8FFAFB8, 0x0C04DEE6, 0xFFE211F0,
+0xFFECEADE, 0xFFF7EBC1, 0xFFFAB886, 0xFFC51C00, 0xFFC11404, 0xFFDE918B, 0xFFFDE9EA, 0xECACDEDF,
+0x0954E411, 0x00014800, 0xCC0000C4, 0xE4E73100, 0x0017ECE0, 0x2C000130, 0x06240001, 0x00063000,
+0x64000184, 0x00980001, 0x0000A000, 0xB800061C, 0x060C0000, 0x000FDC00, 0x10000004, 0x057C0000,
+0x00054400, 0x4C00029C, 0x02980000, 0x0102B800, 0xE72106AC, 0x00005CE2, 0x5C001408, 0x01E80000,
+0x000C2800, 0x480011B8, 0xE4E77140, 0xE4E8FFDC, 0x001B38DF, 0xEA310530, 0x0304DFE4, 0xDEE3E731,
+0x3C000018, 0x10FC0002, 0x0002E400, 0x280014B8, 0x00080011, 0xE2E8E840, 0x310064FF, 0x74E3E7E8,
+0x00080015, 0x00007C00, 0x8400DEB0, 0x026C000A, 0x320A8000, 0x9CD6DEE1, 0xD4DB6131, 0xD2DBE2FF,
+0x840008C8, 0x0004000A, 0xF1037800, 0xD2D9E108, 0xD3D7E0FF, 0xD1D8E2FF, 0xD3D7E2FF, 0xD0D7E1FF,
+0xD1D5E1FF, 0x01F009C4, 0xFFCED2DE, 0xFFCED5DF, 0xFFD0D4DF, 0xFFCED5DD, 0x3800002C, 0x0A1C0000,
+0xD8DF08F1, 0xDBE1FFD5, 0xDCDEFFD4, 0xD8D3FFD2, 0xBCBAFFCF, 0xD5DAFFB6, 0xB10EF4D2, 0xFFC9D0D6,
+0xFFC6CFD4, 0x00CDD4DA, 0xDDDC7110, 0xDADBFFD9, 0xF10064D6, 0xD0D8E510, 0xB9CADCFF, 0xB8C8D8FF,
+0xC3D0E1FF, 0xC1CEDEFF, 0xC6CFDEFF, 0xC6D0DCFF, 0xC2CCD6FF, 0x1000411C, 0x13E00037, 0x003C2400,
+0x64004124, 0x09500013, 0xD0D9DE90, 0xCED7E0FF, 0x4B34E2FF, 0x40504400, 0xDAFFC6D4, 0xD4613C50,
+0xD8DFFFC5, 0x100004C9, 0x004AF4E6, 0xF0004FCC, 0xD2DB214A, 0x08002318, 0xD9E4200F, 0xD2402314,
+0x08DAE3FF, 0x00D11500, 0x0A1C000F, 0x00050000, 0xFC004588, 0x0E8C0004, 0x01000800, 0xDF3009E0,
+0x09B8FFD6, 0x003B7400, 0xC0000500, 0x0E60001D, 0x001B6800, 0xD0000004, 0x04E51004, 0xCFD66101,
+0xCDD4DCFF, 0x0C003768, 0x28100005, 0x00290C00, 0x1800240C, 0x05240105, 0xFFD4DB50, 0x0050DDE7,
+0x122CD400, 0x000284E5, 0x680313C8, 0xDEE3401A, 0x0004FFDB, 0x0004F800, 0x280010AC, 0x04F40004,
+0xE2E3E731, 0xA4001AB4, 0x07B4000C, 0x00000400, 0x280002B4, 0x029C0003, 0x002F4C00, 0x04F11380,
+0xFFE2E8F4, 0xFFCFD4EA, 0xFF2D3250, 0xFF35395F, 0x04363964, 0x6F38F100, 0x70FF4144, 0x6BFF4043,
+0x69FF3B3E, 0x6AFF3739, 0x63FF3C3F, 0x55FF3C40, 0x4BFF363A, 0x31FF3533, 0x21FF2420, 0x0BFF1E16,
+0x06FF0F06, 0x21FF1206, 0x2DFF3224, 0x2FFF422E, 0x38FF4430, 0x83FF4737, 0xF2FF877E, 0x2918EBEA,
+0xDADDEEB1, 0xD8DEEEFF, 0xDEE5EFFF, 0xC40027A4, 0xD8DE3114, 0x010260D1, 0xDD3014C8, 0x0220FFD9,
+0x001CF800, 0xCC000004, 0x1B380002, 0x12120001, 0x0002E8E1, 0x040002D0, 0x02D40100, 0x34E5EA21,
+0x0310000A, 0xE0E5E941, 0x210004FF, 0x1898E1E6, 0x0004D800, 0xD8000498, 0x00EC0104, 0xFCEAEB21,
+0x041C0003, 0x00001C00, 0x48000004, 0x04F00108, 0x04030403, 0xE8000010, 0x03CC0009, 0x0016BC00,
+0x54000004, 0x00100001, 0x0103D800, 0x78000A0C, 0x80EE1021, 0x308C0030, 0x2B00EA11, 0x00056C00,
+0xEC0003E4, 0x041C0003, 0x00007400, 0x70000004, 0x00040800, 0x00001C00, 0x3C000180, 0x00180004,
+0x0004D000, 0x04000408, 0x0A300000, 0x0009E800, 0x04000004, 0x13AC0005, 0x0004FC00, 0x040405BC,
+0x00300000, 0x000FE800, 0x50000004, 0x00040004, 0x00007800, 0x7C000004, 0x00040000, 0x000FA800,
+0xA000042C, 0xE4EB3108, 0x000DB4E1, 0xE4001560, 0xE2E55013, 0xA0E9FFDE, 0xEBF16121, 0xE8F1F6FF,
+0x20F1E280, 0xFFDBE5E6, 0xFFDCE5E4, 0xFFDCE1E4, 0xFFEBE4D4, 0xFFFFEBB5, 0xFFD27C43, 0xFFC81A01,
+0xFFC6211B, 0xFFFFCDD2, 0xFFE1DEE5, 0xFFD7DFE2, 0x74E2ECEE, 0x0F7C0001, 0x00102000, 0x24000930,
+0x02700101, 0x54E0E321, 0x00800011, 0x00014400, 0x04010180, 0x05FC0300, 0x3104E400, 0x44E2E3E5,
+0x00FC0018, 0x3100AC01, 0xF8FFE8E9, 0xE2E32104, 0x18000008, 0x02B40001, 0x00012400, 0x40000024,
+0x01C40000, 0x0000D000, 0xD4000184, 0x04F00000, 0x3016B401, 0x18FFDCE4, 0x0228000A, 0x00073800,
+0x0400022C, 0x00080005, 0x00081800, 0x2C000504, 0x1F940002, 0x0004F400, 0xE92004FC, 0x7004F0E9,
+0xE3E3FFE3, 0x04E6FFDD, 0xA0E91235, 0x14740027, 0x80163C00, 0xFFDDE2E5, 0xFFDBE3E5, 0x08000558,
+0x3FAC0435, 0x60129C00, 0xFFCDD8DE, 0x1D14D7DE, 0xD0FFD720, 0x0EB00009, 0xD2D6DF40, 0x0109A4FF,
+0xD32104E8, 0x600EB4CF, 0xFFC9CFDB, 0x13B4CEDA, 0xD8FFC7D1, 0xD9FFC7CE, 0xD9FFC8CF, 0x003CCAD1,
+0x0003D400, 0x18F11910, 0xFFD4D7DE, 0xFFCBD2DA, 0xFFD1DBDD, 0xFFC8D1CE, 0xFFB9BFBD, 0xFFCED1D6,
+0xFFCBD0D6, 0xFFCED5DB, 0xFFCBD4D9, 0x94D2D9DF, 0xE2DEC001, 0xDEDAFFDD, 0xDCE2FFD9, 0x1348FFD5,
+0xBEC9DB71, 0xC0CCDCFF, 0xB0003210, 0xD7E3313B, 0x003168D1, 0xFC000A74, 0x08400008, 0x00010404,
+0xDC0000D0, 0x0D200012, 0xE2E6E571, 0xDBDFE0FF, 0xD8C00370, 0xD2FFC8D1, 0xD4FFC2CB, 0x3CFFC4CD,
+0x09A80046, 0x31352000, 0x88E1ECF2, 0xE9F0402B, 0x04ACFFE0, 0xD009A400, 0xFFD4D8E4, 0xFFD4D6E5,
+0xFFD7D9E8, 0x2119C4EB, 0x0EF4D2DA, 0x000F1400, 0xF4001418, 0x04F00004, 0x00000400, 0x340013FC,
+0x04AC0000, 0x04000800, 0xC40004FC, 0x00040004, 0x00001000, 0xFC0004F4, 0x06340004, 0x0028EC01,
+0xD825063C, 0x0040D4D1, 0xCC00015C, 0x01600000, 0x00000C00, 0x64000658, 0xDCE72001, 0xE2203060,
+0x000210FF, 0x80040734, 0x03B8000C, 0x00073400, 0xF8000004, 0x06C80007, 0x00000400, 0x04000010,
+0x06E80000, 0x0003E800, 0x08000280, 0x00380005, 0xDEDFE331, 0x480006F8, 0xF151F004, 0xFFFFE2E6,
+0x77FFF5FB, 0x52FF585C, 0x52FF2B2F, 0x50FF2629, 0x60FF1F23, 0x6CFF2F33, 0x6DFF3B3F, 0x71FF3F42,
+0x64FF4346, 0x55FF3437, 0x43FF2B2F, 0x3DFF2124, 0x31FF2224, 0x33FF1D1B, 0x36FF211E, 0x2FFF2825,
+0x2AFF2422, 0x18FF2421, 0x10FF1611, 0x0AFF1206, 0x14FF0C00, 0xD7FF150B, 0x74FFD5D0, 0x1108010F,
+0x14DBDD21, 0x0FC0002E, 0x310FEC00, 0x54D1DAE1, 0x11080007, 0x3105F000, 0xF8D3DAE4, 0x000C0124,
+0xD0D5DC21, 0x2A18000F, 0x0019DC00, 0xD800052C, 0x0A340001, 0xE3EAF041, 0x000004FF, 0xE5210B28,
+0x001EF8DE, 0x04000540, 0x03100000, 0x00032000, 0x88040514, 0x04740003, 0x00035800, 0x94000E10,
+0x03540004, 0x22011001, 0x4398E1E5, 0x00064803, 0x1C000514, 0x01600000, 0x04002000, 0x4400080C,
+0x178C0002, 0x3ED4ED10, 0x00354400, 0xED212FF4, 0x003048EC, 0xFC0117E0, 0xCCED1204, 0x0044003E,
+0x0008B800, 0x0800007C, 0x03B80000, 0x00000800, 0x14000410, 0x05400109, 0xFFEAEB30, 0xB4080F58,
+0x04D80004, 0x0004E404, 0xEC000008, 0x09F40009, 0x00001800, 0xC40000B4, 0x0FA80000, 0x00000C00,
+0x60000E38, 0x227C0022, 0x00000400, 0x0400050C, 0x06D00000, 0x00000400, 0xC0000428, 0x0414000D,
+0x00160400, 0xF3401AF0, 0x0CFFE4EB, 0x08B40000, 0x00020000, 0x0002055C, 0xECAF1246, 0xD6E12138,
+0x0CF18C18, 0xFFEEDBCD, 0xFFFFCC9D, 0xFFB83E0D, 0xFFCB2A18, 0xFFEF6769, 0xFFFFD8E7, 0x10D7D6E6,
+0x39A80030, 0x31018800, 0x58EBEEF5, 0x1D980005, 0x2208D000, 0x0978E2E9, 0x00048C00, 0x58001A64,
+0x01480002, 0x00000400, 0x68001094, 0xE6E7400C, 0x0580FFE2, 0x00065000, 0x5C001330, 0x0128020B,
+0x00168C00, 0xE760F230, 0xEBEAF0FF, 0x001848FF, 0x90000004, 0x0EA40013, 0x31056800, 0x90E4E4EC,
+0x13640013, 0x0007E800, 0x480007E4, 0xDFE43100, 0x00F264DC, 0x8C000518, 0x23240105, 0x20232803,
+0x0A3CE1E6, 0x1E00E511, 0x0007F800, 0x00011000, 0xE3E72103, 0xB4000088, 0x01E80005, 0x0001A400,
+0x34000344, 0x09F80002, 0x01024400, 0xA403024C, 0x1C7C0049, 0x0217F800, 0x040003F0, 0xCCD61109,
+0x13C40113, 0x0EE8D712, 0xB113B800, 0xFFD1D3DF, 0xFFCED2DD, 0x08CDD1DC, 0xD0DA3100, 0x001DC0C9,
+0xA4040504, 0x0A080012, 0x00002004, 0x140018D8, 0xCED0C0FD, 0xC0C3FFC6, 0xCDD4FFBB, 0x13ECFFCA,
+0x31002C00, 0x0CCBD4DB, 0x0F60002D, 0xDADEDD50, 0x1E14D9FF, 0xFFD1D930, 0xD97109C4, 0xDAFFBCC7,
+0x2D14BECA, 0xC7D1DD71, 0xDEE4F0FF, 0xF0310500, 0x1A20E3E7, 0x31285400, 0xA8D0D5DB, 0x02B40006,
+0xD8D900F1, 0xDEDFFFD4, 0xE6E5FFDA, 0xE1E0FFE4, 0x0015A8DF, 0x74000324, 0x0590003C, 0x000A9800,
+0xDD5009B4, 0xD3FFCDD6, 0xD2214168, 0x000F98C9, 0x3C000D9C, 0xE3EF3102, 0x804CF4E1, 0xFFD5D4E6,
+0xFFD0D2E1, 0xE0000A0C, 0x00040018, 0x00050000, 0x58003CB8, 0x0508000A, 0x000EF400, 0xFC0009EC,
+0x04E40004, 0x0004F000, 0xE8000EEC, 0xD6E04004, 0x04FCFFCF, 0x0004F800, 0xE6350020, 0x2D1CD5DC,
+0x0009E800, 0x6C0013D4, 0x44E8105C, 0x2D040332, 0x00001000, 0x44000664, 0xDAE5200B, 0xDE204B64,
+0x1001F4FF, 0x1005C8E2, 0x114C48E1, 0x000C20E1, 0x140006EC, 0x00D80002, 0x0001C401, 0xE12206C8,
+0x212480DC, 0x091CDFE4, 0x00050C00, 0xF8001664, 0x002C0001, 0x0002AC00, 0x51F000AC, 0xFFE0E6F6,
+0xFFB2B8CE, 0xFF353A58, 0xFF393E64, 0xFF3C416B, 0xFF292D5A, 0xFF3F4370, 0xFF3B406A, 0xFF393C65,
+0xFF30335C, 0xFF2D3157, 0xFF2C3053, 0xFF313550, 0xFF24263D, 0xFF27283D, 0xFF232136, 0xFF16172B,
+0xFF151726, 0xFF121423, 0xFF151422, 0xFF1A1422, 0xFF140C19, 0xFF030009, 0xFFD3D2DA, 0xC4000878,
+0x03280009, 0x4009E000, 0xFFD0D7DF, 0x500019E4, 0x0508000C, 0x08010800, 0x00000118, 0x14C40005,
+0x000B0800, 0x00000FF0, 0x00040005, 0x00003C00, 0x280006D8, 0x19E80010, 0x00000800, 0x04001030,
+0x000C0000, 0x0002B400, 0xD8000004, 0x0A0C0000, 0x00047804, 0x0000043C, 0x17200005, 0x00045000,
+0xA80004B0, 0x02FC0004, 0x00000800, 0x080003A4, 0x00040000, 0x01050000, 0xE821030C, 0x00077CE4,
+0x180004FC, 0x0D140009, 0x001E3800, 0xB8000024, 0x00480008, 0x0504FC00, 0xCC000DE4, 0xE6EA2148,
+0x50000654, 0x03DC0003, 0x04048800, 0x8C000004, 0x0A400400, 0x00187C00, 0x440004E0, 0x04D00000,
+0x0008E800, 0x0400050C, 0x005C0000, 0x00001000, 0x04000008, 0x000C0000, 0x00090C00, 0x08000BCC,
+0x00100000, 0x22050008, 0x1974EBEB, 0x000A0800, 0xC00104FC, 0xE1E42100, 0x3C0012BC, 0x024C0002,
+0x00113C04, 0x58000274, 0x010C002F, 0xF20A6001, 0xFFEDEE1F, 0xFFAFB4B8, 0xFFD0DBDF, 0xFFD1DCDE,
+0xFFD2D8D4, 0xFFF5D4C3, 0xFFF88A65, 0xFFC43411, 0xFFBF362C, 0xFFFFB0B8, 0xFFEBC8DC, 0x98CDCEE2,
+0xD0DB213A, 0x84000E60, 0x01D80011, 0x0004C800, 0x70000504, 0x019C0005, 0x00098000, 0x04000500,
+0x01480000, 0x00016400, 0x60000004, 0x079C020E, 0x84FFDF20, 0x02EC0020, 0x3101A800, 0x4CE6E9F0,
+0x156C003B, 0x7118B400, 0xFFEAE9EF, 0x04E7E6EC, 0xDFE53105, 0x001D40E0, 0x40001D44, 0x13600207,
+0xE2FFD851, 0x2C40D6D9, 0x00135800, 0x980013A0, 0x00880018, 0x0016D400, 0x0400002C, 0x05080000,
+0xE1E0E671, 0xE2E1E7FF, 0x0C000004, 0x00040005, 0xE3E2E740, 0x001200FF, 0x08000300, 0x05380003,
+0x00000800, 0x14000004, 0x0A380000, 0x0002AC00, 0x1C040270, 0x08D40004, 0x01042000, 0xDD210004,
+0x0022C4D6, 0x800022CC, 0xDAE64000, 0x13F0FFD8, 0x08DCE820, 0xFFD73000, 0x300EA8E6, 0x94FFD0D6,
+0x4A740009, 0x004A9400, 0x64004A8C, 0xD2DBE209, 0xCCD5FFC9, 0xC8D4FFC3, 0xCDDAFFC2, 0xD40045E0,
+0xCF08F145, 0xC1FFC0C7, 0xD1FFB6BB, 0xD9FFC2C6, 0xD8FFC9CD, 0xDAFFC5CD, 0x4FB8C7CF, 0xF1030C00,
+0xD7DBDE0C, 0xD4D9DCFF, 0xCFD8DDFF, 0xCCD7DDFF, 0xA6B7CBFF, 0xA9B8CBFF, 0xA5B2C5FF, 0xAC002810,
+0xD2DE4018, 0x0E8CFFC8, 0xCDD70DF0, 0xC0CAFFC3, 0xC1CAFFB6, 0xD9E0FFB7, 0xDDE2FFD0, 0xD1D4FFD4,
+0xDBDEFFC9, 0x0A08FFD3, 0x00018C00, 0x7C0006C0, 0x18300026, 0x00056C00, 0xEC000A0C, 0xDF00F137,
+0xD0FFCCD6, 0xCEFFBDC7, 0xD3FFBBC5, 0x1E78C0CA, 0x0000C400, 0xE12000CC, 0x204B38D5, 0x2D94FFD2,
+0x0004E800, 0x04000F08, 0x04FC0000, 0x000EBC00, 0xD8000ACC, 0x00B00003, 0x40026400, 0xFFDADEE7,
+0x0C040004, 0x09CC0000, 0xD0D4DD80, 0xCFD3DCFF, 0x000508FF, 0xF80008EC, 0x03E80008, 0x00079800,
+0xC00018AC, 0x02400005, 0x0001CC01, 0xE3300C4C, 0x155CFFE0, 0x000B2C00, 0x84001340, 0x06740015,
+0x00044800, 0xAC002018, 0x03E80001, 0x00224800, 0x3C0027D0, 0x04000000, 0x001B3000, 0x5C000004,
+0x00040000, 0x00044800, 0x08000420, 0x00100000, 0xDBE660F1, 0xDDE9FFD7, 0xDBEAFFD9, 0xDEF1FFD8,
+0xECFFFFD9, 0x4765FFE8, 0x4266FF42, 0x4C76FF3C, 0x416FFF45, 0x4371FF3A, 0x4B78FF3C, 0x456DFF47,
+0x3A60FF40, 0x4467FF36, 0x3D5EFF40, 0x3856FF3A, 0x304AFF33, 0x2D43FF29, 0x1E33FF27, 0x1C30FF1C,
+0x2033FF1B, 0x1C2BFF1D, 0x1827FF19, 0x1321FF16, 0x0B19FF14, 0x0713FF11, 0x010CFF0D, 0xBDC5FF04,
+0x012158BD, 0xE4210C4C, 0x0033E8DC, 0xB00009F8, 0x01400450, 0x000B2C00, 0x14000B1C, 0x00040020,
+0x00166400, 0x14001EB8, 0x32F40001, 0x0004F800, 0xBC002A10, 0x0BE00008, 0x00029800, 0xC0000004,
+0x06380001, 0x00052400, 0x540000DC, 0x01040003, 0x00000400, 0x7C00035C, 0x04880004, 0x00130800,
+0x64000844, 0x09780103, 0x0009AC07, 0x040003A4, 0x04D80000, 0x04000400, 0x1400050C, 0x08680000,
+0x00066C00, 0x0C000868, 0x004C0000, 0x000B4C00, 0x70000484, 0x09740004, 0x0012C000, 0x040004C4,
+0x00400000, 0x2103E401, 0x0894DFE2, 0x00035000, 0x5C000004, 0x008C0003, 0x01051800, 0xE82108F0,
+0x003088E7, 0x040C0988, 0x0BD80400, 0x00001804, 0xB8000010, 0x0004000B, 0x00001400, 0xF4000070,
+0x04F80009, 0xEAEAEA40, 0x000004FF, 0x88000014, 0x00BC0018, 0x00000400, 0x94000498, 0x178C0004,
+0x00027800, 0x98000C40, 0x1C580008, 0x31074C00, 0xC4E2E5EC, 0x3BA4003F, 0xACB6B771, 0xC8D7DCFF,
+0x10F1EC90, 0xFFD5D6C6, 0xFFFFD2B8, 0xFFCE4630, 0xFFD53C2C, 0xFFC76361, 0xFFF8C3CB, 0xFFDFCEDE,
+0x68CFD5E5, 0x17B00053, 0x00018C00, 0xA80000D8, 0x02A00002, 0x0009FC00, 0x28000004, 0x00040001,
+0x00045400, 0x040000F0, 0x000C0000, 0x21079C01, 0x13A4DEE3, 0x0002B400, 0xB4000858, 0x25980006,
+0x0010E800, 0x2C00061C, 0x1DD80000, 0x00000400, 0xC00004A0, 0xDCE43104, 0x0004E8DC, 0xE3330D04,
+0x135CD4D8, 0xD4FFCF24, 0x94E3114E, 0xFFD04003, 0x5D78DAE8, 0x100D9C02, 0x803A78EA, 0xE8FFD9DB,
+0xE9FFDADC, 0xDF610C70, 0xDEE8FFDC, 0x001D94DE, 0xE8500A3C, 0xE6FFE0E0, 0xE0300A34, 0x0010FFDD,
+0x01000400, 0xDD300530, 0x0070FFDD, 0x00001C04, 0x78000364, 0x09480003, 0x01278800, 0x98030004,
+0xCED9601D, 0xCFDAFFCA, 0xCC602298, 0xCAD0DCFF, 0x310EF0FF, 0xD4C7CDDB, 0x04D80004, 0xC8D1E0B1,
+0xC7D0DFFF, 0xC5D1E1FF, 0xE3314FBC, 0x4F60C7D3, 0xBBC9D6B1, 0xB6C2D0FF, 0xBAC3D4FF, 0x03F022CC,
+0xFFB9C6D7, 0xFFB2BECE, 0xFFB6BECB, 0xFFB3B9C5, 0x6390BBCA, 0xDCFFC0D1, 0xDDFFC2CB, 0xE0FFC3CC,
+0x3200C6CF, 0x001E0C00, 0x09F00F40, 0xFFC7D1DA, 0xFFC0CDD6, 0xFF91A3B7, 0xFF9AABBF, 0xFF9DACBF,
+0xFFAAB7C8, 0x11F02D18, 0xFFC4D0DE, 0xFFB7C3D1, 0xFFB8C4D0, 0xFFB7C3CF, 0xFFB3BFCB, 0xFFB9C3CD,
+0xFFBAC4CD, 0xFFC9D2D9, 0x40001400, 0x0C14011F, 0xB0E2E721, 0xCAD34019, 0x0484FFC6, 0x000EFC00,
+0x04F11424, 0xFFCCD9E2, 0xFFBDCAD3, 0xFFB6C3CC, 0xFFB9C6CF, 0x3CC1CED7, 0x0AF8005A, 0x0008AC00,
+0x80000004, 0x0EE8000F, 0x3109F000, 0x80CAD3DC, 0x05440050, 0x00050000, 0x50000508, 0x07780000,
+0x00027C00, 0x0C000004, 0x05080000, 0x00000400, 0x00000ED4, 0x0A000005, 0x001DB800, 0x100000D4,
+0x001C000B, 0x00020800, 0xB80022A0, 0x02580003, 0x0002A400, 0x0C001DB8, 0x01940400, 0x0106E800,
+0xDA21020C, 0x003338D6, 0x3000056C, 0x04040014, 0x00000C00, 0x84000AC8, 0x0B540005, 0x00059800,
+0x080000A4, 0x04680000, 0x0106C400, 0xDA1241D8, 0x3C00385C, 0xE855F002, 0xF2FFD0D5, 0xC6FFD6DC,
+0x59FFA3A8, 0x66FF3137, 0x68FF373F, 0x76FF353C, 0x6DFF4148, 0x6EFF383F, 0x64FF3D41, 0x64FF373C,
+0x57FF3B3F, 0x54FF3237, 0x4FFF3235, 0x47FF2D32, 0x46FF262D, 0x3DFF272F, 0x39FF2227, 0x39FF2224,
+0x2CFF2528, 0x1DFF1A1D, 0x26FF0E10, 0x22FF1A1A, 0x1CFF1A17, 0x07FF1812, 0x64FF0000, 0x3290013A,
+0xFFDDE840, 0x123D4CE3, 0x040D48E0, 0x7C000094, 0x0A000001, 0x40000400, 0xFFE6EAF3, 0x040008B0,
+0x00040005, 0x00013C00, 0x04000BCC, 0x04F80000, 0x0004D800, 0xA000083C, 0x00140007, 0x00254000,
+0xD4000140, 0x03E80003, 0x04003400, 0x48000504, 0x03940401, 0x00040C00, 0x4C0004BC, 0x0008000D,
+0x00000400, 0x040004AC, 0x04D00000, 0x00000400, 0x4004000C, 0x0EAC0009, 0x0404AC00, 0x0C0012D8,
+0x03A00000, 0x00000800, 0x8C000510, 0x04980009, 0x01047400, 0x00000494, 0x04D40026, 0xFFE3E730,
+0x24001078, 0x00040400, 0x00041000, 0x30000004, 0x05080004, 0x00002000, 0x48000D84, 0x04D40030,
+0x0404BC00, 0x50000548, 0x00100800, 0x00005C00, 0x08000068, 0x001C0400, 0x00002000, 0x0400057C,
+0x1E4C003B, 0x04001800, 0xC4000004, 0x05600100, 0xC0E2E521, 0x077C041C, 0x00113800, 0x4400304C,
+0xD0D9310C, 0x001168CC, 0x1CF13380, 0xFFE9F1F3, 0xFFADB7B8, 0xFFC8D5DD, 0xFFCDD6D1, 0xFFDBD5B5,
+0xFFFFD0AA, 0xFFAC1907, 0xFFB41C17, 0xFFFFBABC, 0xFFEAD5DE, 0x7CDBD8E3, 0x03400016, 0xD7DCDF31,
+0xE09026A4, 0xDFFFD8DB, 0xDBFFD7DA, 0xE01021D0, 0xDB1101DC, 0xE8000C98, 0x00FC0000, 0x0000F405,
+0xE0210468, 0x0015D8DB, 0xF40006C0, 0x02080017, 0xD6DFE440, 0x000004FF, 0xF8000968, 0x30F40030,
+0x012BF800, 0xD8252C00, 0x003608D5, 0x2C0006E8, 0x17D0013E, 0x1D14D210, 0x58B0C611, 0x001CF000,
+0xFC001304, 0x2CE51017, 0xD303F20E, 0xD3E4FFCA, 0xD5E5FFCA, 0xD7E7FFCE, 0xD9E7FFD0, 0x033AA4D3,
+0xFC00449C, 0x3F90040A, 0x00000800, 0x50000268, 0x05C00003, 0x00036000, 0xF4000008, 0x1DA00004,
+0x0022EC00, 0xA8000A58, 0x00040013, 0x00050800, 0xC00022B8, 0x01400008, 0x00050000, 0xDF4004F8,
+0x04FFCDD3, 0x4AB00000, 0x003BA800, 0x04004FA8, 0xD710F100, 0xD2FFBBC7, 0xCFFFB5C0, 0xD5FFB1BE,
+0xD7FFB5C2, 0xD5FFB7C4, 0xD1FFB3C2, 0xD2FFB1C1, 0x0018B2C2, 0xC4D71CF1, 0xBFD1FFB5, 0xBCCCFFAE,
+0xBBC9FFAC, 0xBECEFFAF, 0xB2C2FFB7, 0xBBCDFFAC, 0xBED2FFB4, 0xBED4FFB3, 0xC0D4FFB2, 0xC1D3FFB5,
+0x004100B6, 0x00F10A28, 0xFFC0CCDA, 0xFFBAC8D5, 0xFFA8B9CB, 0x04AABBCB, 0xC4D48019, 0xC1D1FFB7,
+0x001CFFB5, 0x00011400, 0x0C0018DC, 0xCBD92000, 0xCB915160, 0xC9D3DFFF, 0xC2CAD5FF, 0x84000EB4,
+0x0484000E, 0x00033C00, 0xA00005D8, 0x098C0004, 0x0009E400, 0x2C004110, 0x2820002D, 0xC0CED771,
+0xC1D0D7FF, 0xD6900004, 0xD2FFC5D3, 0xD4FFC3D1, 0xD370F3D0, 0xD6D7FFC7, 0x0460FFCC, 0x00004C00,
+0xDE31003C, 0x0544CDD4, 0x00088C00, 0x8804048C, 0x03880008, 0x00039000, 0xC80104DC, 0xA8D81003,
+0x2CD81127, 0x04A8001A, 0x71050000, 0xFFC8CFD7, 0xECC8CFD5, 0x03DC0001, 0x0003B400, 0xF4000EC0,
+0x0EC4000F, 0x00001000, 0x080003F0, 0x00200000, 0x000C6001, 0xDB210EF8, 0x00131CD7, 0x04000A44,
+0x0E3C0000, 0x00000800, 0x6C001584, 0xCED77115, 0xCCD7FFC5, 0x0000F8C4, 0x180000FC, 0x50D9101A,
+0xC7D15051, 0x38D2DDFF, 0x08CC115B, 0xE454F100, 0xEFFFCBD2, 0x80FFD3D9, 0x5FFF5D62, 0x61FF373D,
+0x62FF323A, 0x69FF3138, 0x6CFF363D, 0x67FF3940, 0x65FF383D, 0x5EFF383D, 0x54FF3438, 0x52FF2D31,
+0x4EFF2E31, 0x4CFF2B30, 0x4CFF282F, 0x43FF2A2F, 0x34FF262A, 0x29FF1D1F, 0x26FF1319, 0x28FF141A,
+0x2AFF1B1F, 0x22FF2023, 0x14FF1D1C, 0x05FF100D, 0x62640000, 0x00163C00, 0x38004980, 0x3858001F,
+0x000C4800, 0x04000590, 0x00040001, 0x00018800, 0xE4000128, 0xE8E9130C, 0x0280042F, 0x01029400,
+0xDD21029C, 0x002A90DA, 0x30000488, 0x08580008, 0x2554E210, 0x24D5DA21, 0x05200008, 0x00036000,
+0x7C000008, 0x0A380001, 0x00000400, 0x60000134, 0x08B40000, 0x00050800, 0x380004C4, 0x03A80000,
+0x03049001, 0x180009AC, 0x04F80000, 0x000EA400, 0x3C000678, 0x00300005, 0x000DD800, 0x1000068C,
+0x031C0100, 0x0034B800, 0xE71217AC, 0x4C00307C, 0x0004000E, 0x000F6400, 0xFC00009C, 0x00040003,
+0x000A3000, 0x0C000068, 0x00680000, 0x00041000, 0x8401107C, 0xE1E26210, 0xE6E6E6FF, 0x400009BC,
+0x531C0036, 0x00402C03, 0x04044030, 0x22F80000, 0x4009E800, 0xFFE8E8E8, 0x0C000004, 0x22300000,
+0x00050000, 0x740016D0, 0x04F40000, 0x00000400, 0x14000CD8, 0x00840001, 0x0000B400, 0xB00000BC,
+0x03DC0000, 0x00015800, 0x040003F0, 0x05140000, 0x00154400, 0x50004624, 0xB6BA314A, 0xF21C58B1,
+0xD8D8D007, 0xF1E4B0FF, 0xE5A871FF, 0x9B1300FF, 0x9E1912FF, 0xF8E6E9FF, 0x2A340018, 0x00083800,
+0x3C00295C, 0x05900019, 0x000F9C00, 0xDAE00608, 0xD8FFD5D6, 0xDBFFD2D3, 0xE2FFD5D6, 0xA02BC0DD,
+0xD6DEFFD8, 0xD0D8FFD6, 0x0438FFD0, 0x000CB400, 0x40001D20, 0x079C0009, 0x0001F000, 0xDCA212C4,
+0xDAFFCFDA, 0xD9FFCDD8, 0x100004D7, 0xA11CD8DB, 0xDCFFD1D9, 0xDBFFD1D9, 0x12E8CDD6, 0x00087000,
+0x18000234, 0x3AD40059, 0x0026E400, 0x0DF02BF4, 0xFFBCCCDB, 0xFFB4C6D4, 0xFFB1C2D2, 0xFFB4C4D3,
+0xFFB4C4D4, 0xFFB2C2D1, 0xFFB3C3D3, 0xCC003B20, 0x5DCC0062, 0x4058D400, 0xFFC6D2E0, 0x10025950,
+0xFFCB2031, 0x08003AFC, 0x0E900008, 0x00088800, 0xDE4003B8, 0x04FFD1D5, 0x3B780000, 0x61075401,
+0xDDFFD5D8, 0x3184D5D8, 0x002C9000, 0xC00001C8, 0x014C0001, 0x30026401, 0x8CFFD7DB, 0x00400112,
+0x4CD2D921, 0xD0DD3103, 0x0054ACC8, 0x0CF13BA8, 0xFFB0BCCC, 0xFFB3BED0, 0xFFB0BDD0, 0xFFACB8CE,
+0xFFA7B6CB, 0xFFA2B1C6, 0xBCA2B1C8, 0xCA04F10E, 0xCBFFA5B6, 0xC8FFA5B7, 0xC7FFA0B5, 0xC0FFA3B6,
+0x0504A3B0, 0xA8B713F0, 0xAEBFFF9F, 0xAFC4FFA5, 0xB3CAFFA0, 0xB5CCFFA3, 0xB4C9FFA5, 0xB5C6FFA5,
+0xBACBFFA8, 0xBFCFFFAD, 0xAD510528, 0xB5C5D4FF, 0xD74031FC, 0x0CFFBDC9, 0x55300469, 0x00190C00,
+0xEB102CB8, 0xD8612C48, 0xD2E1FFCF, 0x00553CC9, 0xB0000A94, 0x0AA80005, 0x00082800, 0xD4002460,
+0x00EC0000, 0x100C1C00, 0xF12868DF, 0xFFC5CC1B, 0xFFC7D0E1, 0xFFC2CEDE, 0xFFBFCBD7, 0xFFC5D3DC,
+0xFFC7D4DA, 0xFFC6D4D7, 0xFFC6D4D5, 0xFFC1CFD0, 0xFFC5D1D1, 0x38C4CFD1, 0x55AC0019, 0x0119E400,
+0xD42123A8, 0x000514CD, 0x60000484, 0x13F0000E, 0x000D9400, 0x700009AC, 0x05740000, 0x00016000,
+0x1400000C, 0x01740000, 0x00000400, 0xE4001CFC, 0x0DE00019, 0x0004E000, 0xFC000C1C, 0x00040004,
+0x0000A400, 0x040603CC, 0x2EFC0200, 0x00006000, 0x30000E30, 0x04F80009, 0x00000404, 0x7C00007C,
+0x0590001F, 0xC7CDD931, 0x08F15148, 0xFFBEC6D1, 0xFFBBC3CE, 0xFFB9C1CE, 0xFFBAC4D0, 0xFFBCC6D2,
+0xE4BEC8D2, 0x1028000F, 0xC8D91CF1, 0xD8EFFFBF, 0x4360FFD0, 0x3A5CFF3C, 0x395EFF34, 0x4B72FF31,
+0x4670FF43, 0x426CFF3F, 0x3B63FF3D, 0x375FFF36, 0x355AFF32, 0xF1050031, 0x2D304F14, 0x292C4BFF,
+0x272C4AFF, 0x292D4AFF, 0x2A2B47FF, 0x272940FF, 0x212639FF, 0x1D2331FF, 0x171E28FF, 0x2171AEF8,
+0x19FF1919, 0x0A001211, 0xC5C9D231, 0xC40037DC, 0x33780002, 0x00058000, 0x80000B38, 0x09BC0002,
+0x00031000, 0xAC000620, 0x35840104, 0xFFE1E430, 0xC000046C, 0x00040003, 0x001CC000, 0xA00004F0,
+0x03DC0004, 0x0003E400, 0x74001308, 0x00100004, 0x00046000, 0xBC003E4C, 0x3E3C0002, 0x03016001,
+0xF800256C, 0x01680004, 0x00018000, 0x90000674, 0x03C80006, 0x00050C00, 0xD00104A0, 0xDBDE2102,
+0x34000D10, 0x04F80004, 0x400E3C00, 0xFFE2E5EE, 0x7001007C, 0xD9DE2112, 0xA4012AB0, 0xDCDF2101,
+0xEC000958, 0x1CA40426, 0x00008800, 0x98000A58, 0x008C0000, 0x03109801, 0x64001F8C, 0x00BC0005,
+0x00055800, 0xFC000008, 0x18000009, 0x0009F000, 0xDC0004DC, 0x3AB8002C, 0x21000C01, 0x452CEEF0,
+0x0004FC00, 0x18001E0C, 0xEEED3100, 0x0044B4EC, 0xE75004FC, 0xE9FFE7E7, 0xEC215830, 0x003178EB,
+0xEC000AAC, 0x0FA80009, 0x00000800, 0x70000AD4, 0x02480000, 0x00014000, 0xC0000B24, 0x015C0000,
+0x0012A800, 0xF800010C, 0x00100010, 0x00008C00, 0x0400295C, 0xB4BC310A, 0xF01CC0AD, 0xE0D9CF05,
+0xF0D5A0FF, 0xD38D52FF, 0x9F1B02FF, 0xA62F2BFF, 0x0033D7FF, 0xA4000D38, 0x13D00002, 0x201C4000,
+0x297CECE9, 0x98FFEA21, 0xE604F00A, 0xDBDFFFE5, 0xD5D9FFDA, 0xDBE0FFD4, 0xD7DCFFDA, 0x093CFFD6,
+0xF1050000, 0xCBCED700, 0xC9CCD5FF, 0xC8CCD7FF, 0xCDD1DDFF, 0x440026CC, 0x13040012, 0x44219400,
+0xFFCAD7DD, 0x7C000004, 0x26580012, 0x002B6000, 0xE2311750, 0x6CB8CDDA, 0xC7D5E040, 0x002BBCFF,
+0xF0006C98, 0xCCDC4030, 0x7BE0FFBB, 0xF17BB400, 0xB0C5D610, 0xAEC1D2FF, 0xADC0D1FF, 0xACBFD0FF,
+0xAABDCEFF, 0xA9BCCDFF, 0xACBDCFFF, 0xAEBFCFFF, 0xCA310920, 0x0960AABA, 0x32043800, 0x24B0C0CF,
+0xB6C67005, 0xB9C7D4FF, 0x32043CFF, 0x58C0CCD8, 0xC4CE7031, 0xC9D1DCFF, 0x00009CFF, 0x98003670,
+0x0DD0000D, 0x21000405, 0x1DACCDD1, 0x0005C400, 0x94000DE4, 0xD0D93131, 0x3113A8C7, 0x58C0CAD4,
+0xCF48F103, 0xCDFFB5C1, 0xC9FFB1BD, 0xCBFFABB8, 0xCDFFABB8, 0xCBFFA9B8, 0xCAFFA5B4, 0xC8FFA1B1,
+0xC5FF9FAF, 0xC6FF9AAB, 0xC7FF99AA, 0xCAFF9AAE, 0xC2FF9DB3, 0xC8FF97AD, 0xC3FF99B2, 0xB7FF98AE,
+0xCAFF94A5, 0xB8FFACB9, 0xBAFF9EAA, 0xC4FF9DAA, 0xC3FF9AAC, 0xC4FF94A8, 0x003895A9, 0xABC401F0,
+0xACC3FF9B, 0xB1C7FF9C, 0xB5CAFF9F, 0x03BCFFA0, 0x200B1000, 0x04A8C7D2, 0x1018CA11, 0x0008F800,
+0xD9221468, 0xA03730CE, 0xFFC6CEDB, 0xFFBEC6D3, 0x5EE4CBD9, 0xD5FFC151, 0x2398C5C9, 0xD3D8DE40,
+0x811BD8FF, 0xFFDAE0E0, 0xFFCFD4DA, 0x03F12870, 0xDEFFC3C8, 0xDFFFC0C6, 0xD9FFC1C7, 0xD8FFBCC4,
+0x0504BEC7, 0x2830D910, 0x210B7400, 0x5F14CBD5, 0x31373000, 0x34CAD4E0, 0x09540001, 0xC1C9D680,
+0xC1CBD5FF, 0x310074FF, 0x08C5CFD8, 0x03DC0000, 0x00008800, 0x00000E7C, 0x012C001A, 0x00062800,
+0x34000004, 0x04B0010A, 0x15C0DD10, 0x06E4D311, 0x0014D400, 0x18001CE4, 0x1EE0000C, 0x0013B800,
+0x08001CEC, 0x0ED40000, 0x000C0000, 0x340003BC, 0x00080013, 0x00004400, 0x5400132C, 0x0004004B,
+0x0002D400, 0x20000CDC, 0x00040011, 0x00006800, 0x0C000508, 0x05F4000A, 0x400A0800, 0xFFC1C9D4,
+0x48000004, 0x013C0038, 0x23FCD810, 0xDCC9D621, 0xE210F528, 0x51FFC1CC, 0x51FF2B34, 0x59FF2932,
+0x65FF2F35, 0x62FF3B41, 0x62FF383E, 0x62FF393D, 0x04FC383C, 0x315110F1, 0x2E4BFF2C, 0x2D48FF2A,
+0x2D49FF29, 0x2741FF2C, 0x203BFF27, 0x2038FF23, 0x253AFF20, 0xF1050423, 0x1A21330C, 0x151B2BFF,
+0x0C0E1DFF, 0x090B1AFF, 0x00000EFF, 0x707682FF, 0xDBE5F1FF, 0xFC005B9C, 0x1AF40004, 0x00063400,
+0x2C0060BC, 0x00080001, 0x0000E800, 0x68001504, 0x04880009, 0x00047C00, 0xD80009F4, 0x000C0004,
+0x0003DC00, 0xA00003E4, 0x0468001B, 0x00087800, 0xC4001228, 0x06C80004, 0x0003F400, 0xDC0009E8,
+0x01600003, 0x00062000, 0x04000008, 0x10AC0000, 0x00000800, 0x3C000D44, 0x006C0001, 0x02090400,
+0xD9110420, 0x34001048, 0x051C0005, 0x000A8400, 0xDC000004, 0x05340007, 0x00015800, 0x30000BD4,
+0x0008040D, 0x00003C00, 0x04000578, 0x00980000, 0x00059800, 0x200000B4, 0x081C0005, 0x000DD000,
+0x64000088, 0x0064000C, 0x00166C00, 0x1C011D0C, 0xE7EA2241, 0x90001920, 0x18EA1027, 0xA8EB115D,
+0x0510012D, 0x21149400, 0x3AF4E9ED, 0x00195400, 0x0400360C, 0x09E80000, 0x030EE005, 0x44000034,
+0x2918001E, 0x0022D400, 0x24000114, 0x006C000C, 0x00008400, 0xE80015E8, 0x11140009, 0x0000C800,
+0xE40000F4, 0x02140007, 0x00048000, 0x4000102C, 0x3FDC0001, 0xE7F0F771, 0xA6B0B9FF, 0x10F1176C,
+0xFFE4D9D3, 0xFFF0C39A, 0xFFC56E41, 0xFF991405, 0xFFA83837, 0xFFFCE2E5, 0xFFD2E1E6, 0x10CFDADE,
+0x223C0022, 0x00050400, 0xC8002F34, 0x0180000A, 0xCBD001F0, 0xC8CDFFC8, 0xDCE1FFC7, 0xD9E1FFDB,
+0x7D2CFFD9, 0xD3DC04F1, 0xCEDAFFD0, 0xCAD7FFCC, 0xCCD8FFC8, 0xCAD8FFC8, 0x2258D0C4, 0x5DD0CCDC,
+0x40047C00, 0xFFBCCAD7, 0x14000004, 0xC8D84113, 0x0004FFBB, 0x26D8C912, 0xC7D71CF1, 0xC3D6FFB7,
+0xC0D2FFB4, 0xBFD3FFAF, 0xBCD2FFAE, 0xB9CEFFAA, 0xB5CDFFA4, 0xB3CBFFA1, 0xB8CDFF9F, 0xB9CEFFA3,
+0xBBD0FFA3, 0x310004A6, 0x08A5BACF, 0xBED33100, 0x31E710A9, 0x34ABBDD3, 0x00380000, 0xABBDD148,
+0x310004FF, 0x78ABBECF, 0xD503F00E, 0xD4FFB2C3, 0xD2FFB1C2, 0xD5FFB0BF, 0xD8FFB5C5, 0x111394C7,
+0x001D58BB, 0x1804406C, 0x0E480063, 0x00547400, 0xDC316824, 0x13C8C4CD, 0x002C6800, 0x28003148,
+0x36680031, 0xD3E364F1, 0xC6D6FFC6, 0xBCCFFFB6, 0xBBCFFFAD, 0xBAD3FFAA, 0xB5CFFFAA, 0xB1CDFFA4,
+0xAFCDFFA0, 0xACCCFF9C, 0xACCBFF99, 0xACCDFF97, 0xACCCFF98, 0xA8C3FF95, 0xACC5FF8E, 0xACC7FF92,
+0xA4BEFF92, 0xAAC2FF8C, 0xBCD0FF98, 0xA1B1FFAB, 0xA9BBFF91, 0xA8C3FF98, 0xA6C6FF93, 0xA9C9FF8F,
+0xA9CAFF92, 0xA8C9FF95, 0xAECEFF95, 0xB2CFFF9B, 0xB0CCFF9D, 0xC9D5FF98, 0x0168C4BD, 0xCEA103CC,
+0x8C97FFC4, 0xB5C0FF84, 0x220498AD, 0x04C0C5D4, 0x68BBCC20, 0xFFB5910F, 0xFFAFB8C9, 0x58A9B2C3,
+0x554C000F, 0x71041000, 0xFFC3CCD1, 0x20BFCACE, 0x04EC000E, 0xC3DA0CF1, 0xC9E3FFBB, 0xC4DEFFC2,
+0xC4DDFFBD, 0xC6DAFFBA, 0xBDCFFFBB, 0xC4D2FFB2, 0x000F58B8, 0xEAB10A14, 0xE2FFCDD8, 0xE0FFC3CE,
+0x14BCC1CC, 0x00012000, 0x5400011C, 0x6D500037, 0x00325400, 0x3C002D68, 0xCAD6310A, 0x042888C0,
+0xB0005AA8, 0x03EC0015, 0x00066400, 0x40001390, 0x14480019, 0x001D0400, 0xD4005970, 0x05000009,
+0x000C2000, 0x04001440, 0x091C0000, 0x0016B000, 0xDC000420, 0x07340064, 0x0005F400, 0x180064E0,
+0x02CC004C, 0x004C2400, 0xA0000004, 0x0A000019, 0x40509404, 0xFFDBE3EE, 0xECB10004, 0xEBFFD9E1,
+0xE6FFD6DE, 0x3CE8D1D9, 0x1105C002, 0x0028F4C8, 0x00F12DE4, 0xFFC9D6E9, 0xFFAEB8D3, 0xFF222B4A,
+0x04313A5B, 0x5800F114, 0x55FF3036, 0x57FF2E32, 0x5BFF3034, 0x000C3438, 0x292E4EB1, 0x2A2F4DFF,
+0x282C49FF, 0x20F10500, 0xFF2A2C45, 0xFF2A2A42, 0xFF29273F, 0xFF26243C, 0xFF202237, 0xFF1D2236,
+0xFF1F2438, 0xFF22273A, 0xFF2D2E42, 0xFF151426, 0xFF000012, 0xBC959BAB, 0xCCD9403D, 0x1FACFFBE,
+0x0029A800, 0x10006AC0, 0x07700001, 0x000A0800, 0xF4000B30, 0x18F4002D, 0x00099400, 0xF80004FC,
+0x0F04000E, 0x00050400, 0xE80008D0, 0x19E80003, 0x0119F000, 0xE1210C8C, 0x003018DE, 0x9C000B20,
+0x09E80004, 0x00010400, 0x3C0004F0, 0x01640052, 0x0051C800, 0x70001F90, 0x0500000F, 0x20014802,
+0x0B24FFCC, 0x000A7800, 0x4800041C, 0x0650000B, 0x01000400, 0x8C000528, 0xD0D62224, 0xD3212AB8,
+0x0017F4CD, 0xB80006D0, 0x0D380001, 0x001FD400, 0x940005AC, 0x19A80010, 0x00051000, 0xA800046C,
+0x00800406, 0x0014D400, 0x0C0001E0, 0x17EC0011, 0x0017E800, 0xE00004A4, 0x05300015, 0x0318A401,
+0x940031C4, 0x269C0026, 0x003B5400, 0xA80004D4, 0x0530002B, 0x00000400, 0xF0002690, 0x20C4002B,
+0x011DD800, 0xE9210004, 0x004084E6, 0x00001BC0, 0x00880005, 0x00057800, 0x20000234, 0x34240007,
+0x0020A000, 0xD8006BF0, 0x027C0011, 0xCDD5E240, 0x0007B8FF, 0x94001C24, 0x27700007, 0x713B8C00,
+0xFFEAF1F9, 0x38AEB8C2, 0xD303F076, 0x6CFFDDD5, 0x00FFBA8D, 0x22FF6919, 0x5BFF9F2D, 0x112B905A,
+0x712B14EA, 0xFFD2DFE5, 0x50CED7DC, 0x19E0002C, 0x00119C00, 0x400013B4, 0xCAD17108, 0xCFD6FFC7,
+0xF121BCCC, 0xD4D4DE08, 0xD0D2DEFF, 0xCDCFDCFF, 0xCACEDAFF, 0xCFD2E1FF, 0xC0C6D6FF, 0xD73153C4,
+0x17D8BDC6, 0xC3D500F1, 0xC3D6FFB8, 0xC1D6FFB6, 0xBDD2FFB2, 0x400430AE, 0xFFA9B9D0, 0xD1710004,
+0xD0FFA7B9, 0x0004A6B8, 0xA3B4CEB2, 0xA2B3CDFF, 0xA0B4CDFF, 0x03F10004, 0xCCFF9EB2, 0xCDFF9DB1,
+0xC5FF9DB2, 0xC7FF97AD, 0x000499AF, 0x98AEC631, 0x08000010, 0xC908F100, 0xCAFF9BB1, 0xD3FF9CB2,
+0xD5FFA6BA, 0xD3FFA7BD, 0xCFFFA5BB, 0x0004A1B7, 0xBBD204F1, 0xC1D8FFA5, 0xC2DAFFAB, 0xC4DCFFAE,
+0xC3D9FFB2, 0xF00004B1, 0xB3C5DB16, 0xB5C5DCFF, 0xB4C5D9FF, 0xB5C6DAFF, 0xBAC9DEFF, 0xBAC9DCFF,
+0xBCCBDEFF, 0xBDCCDFFF, 0xBDCCE1FF, 0x000CE0FF, 0xFFBBCAA1, 0xFFB9C8DD, 0x30B6C7D9, 0x00080081,
+0xCADB01F0, 0xC2D6FFB7, 0xBCD1FFB0, 0xB2CAFFA7, 0x0080FF9E, 0xB0CB71F0, 0xACC8FF9B, 0xA4C3FF94,
+0xA0C2FF8D, 0x9EC0FF88, 0x9BBEFF86, 0x9ABFFF81, 0x9CC3FF80, 0x99BEFF80, 0xA0C2FF7D, 0x9CBCFF83,
+0xA0C0FF7F, 0x9EBDFF83, 0x9CB9FF85, 0xB3CBFF87, 0xA7B9FFA1, 0x9FB3FF96, 0x9DBCFF8D, 0x9FC2FF86,
+0xA1C6FF85, 0x9DC3FF87, 0x98BFFF85, 0x9BC2FF82, 0x9DBFFF85, 0x96B7FF85, 0xB5C7FF7C, 0xB0C2FFA4,
+0xB7CAFF9F, 0xB4C7FFA8, 0x8B9EFFA5, 0x8FA2FF7C, 0xB4C8FF80, 0x0F5CFFA3, 0x9EB0C660, 0x30B6CEFF,
+0x58A31106, 0xB4CC5000, 0x78D9FFA2, 0xB806F314, 0xBBD0FFA9, 0xBACCFFAC, 0xB6C5FFA9, 0xBCCEFFA3,
+0xBACEFFAB, 0x0BF1017C, 0xCDFFA8B8, 0xCDFFA4B4, 0xCFFFA5B3, 0xCCFFA7B5, 0xD0FFA6B5, 0xDBFFAAB9,
+0x0004B3C1, 0xB8C6E1B1, 0xBDCBE6FF, 0xB9C7E1FF, 0xA400011C, 0x2D840006, 0x54D0E020, 0x7CA0007C,
+0x7D28CC11, 0x00045800, 0x18003790, 0x0F9C0006, 0x00468800, 0x4400463C, 0x000C0041, 0x310E0800,
+0x60CED8E1, 0x6EC40056, 0x90D3D920, 0xFFC86004, 0xFFC6CFD6, 0x580013B8, 0x04F4000B, 0x00041C00,
+0xB8001F04, 0x32B80013, 0x3032C001, 0xB4FFC2CE, 0x0560000B, 0x00151000, 0x04000FF8, 0x3D1C0000,
+0xC7D1DB40, 0x0404E0FF, 0xCC001004, 0x7878005A, 0x00783800, 0xA80006A8, 0x00940005, 0x006F5800,
+0x08F18808, 0xFFC0D1E5, 0xFFBECCE7, 0xFF9CA6C9, 0xFF1F274C, 0xFF2F375C, 0xE031375B, 0x5418F122,
+0x51FF3033, 0x53FF2D30, 0x4DFF2F32, 0x4CFF292C, 0x4DFF282B, 0x47FF2B2E, 0x45FF252A, 0x41FF252B,
+0x3CFF2329, 0x09FC2126, 0x1F1D3331, 0x00F11E04, 0xFF191A2C, 0xFF17182A, 0xFF181729, 0x04161125,
+0x1904F200, 0x48FF0607, 0xDDFF3138, 0xD0FFC0CD, 0xCEFFB0C2, 0x11B0ADBE, 0x0042C800, 0xCF300B38,
+0x010CFFC5, 0x001E0C00, 0x30002814, 0x09880004, 0x00102800, 0xC8000944, 0x04640008, 0x00047000,
+0x40000448, 0x0024002E, 0x00063000, 0x1C000008, 0x06440138, 0x2CD3DC21, 0x03EC0020, 0x01146000,
+0xD83005F0, 0x2EB8FFCE, 0x00339800, 0xB0002E9C, 0x04C4003D, 0x120B9801, 0x000174D1, 0x50000690,
+0x00380106, 0x002EE000, 0xD7300628, 0x0430FFCF, 0x000AAC00, 0x580011D4, 0x05B80001, 0x00000800,
+0x8400164C, 0x05640006, 0x00053000, 0xC800055C, 0x04680114, 0x24CDD721, 0x0FE4000C, 0x00126400,
+0x30000004, 0x00DC005C, 0x00051000, 0x1C0000B0, 0x05C40067, 0x00138000, 0x14000A18, 0x1FB00005,
+0x00112C00, 0xBC000020, 0x00040009, 0x00010C00, 0x0C0000EC, 0x1D280000, 0x001FDC00, 0xEC001B20,
+0x0FC00004, 0x000AA400, 0x38000578, 0x0AD00000, 0x00073800, 0xD0000650, 0x00800000, 0x0008A000,
+0xF000027C, 0xD2E28001, 0xD1E2FFC5, 0x02A8FFC4, 0xBDCDDDC1, 0xBFC9D5FF, 0xE2E3E8FF, 0xF1463CFF,
+0xFFE7EA13, 0xFFA5ADBA, 0xFFBFCCDD, 0xFFDADEE1, 0xFFAA9173, 0xFF552000, 0xFF480000, 0xFFA96D6C,
+0xD4E9DCE3, 0x30500000, 0x00015800, 0xA0001844, 0x05E80001, 0x0026D400, 0x00F10E2C, 0xFFBABEC9,
+0xFFC1C5D0, 0xFFB2B6C1, 0xC0C6C8D5, 0xC6D52021, 0xC2113FAC, 0xD33162B8, 0x53B4B9C2, 0xCADB10F1,
+0xC9DAFFBD, 0xC4D9FFBC, 0xC0D9FFB5, 0xBCD6FFB0, 0xB9D5FFAB, 0xB7D3FFA8, 0xB6D4FFA6, 0xF10004A3,
+0xA1B6D304, 0xA0B5D2FF, 0x9FB4D1FF, 0xA0B5D4FF, 0xA2B7D6FF, 0xD1220018, 0xF10948B3, 0x99ACCA10,
+0x98ABC9FF, 0x9AAFCAFF, 0x96AEC8FF, 0x92AAC4FF, 0x8FA7C1FF, 0x90A8C4FF, 0x93ABC7FF, 0x14F10004,
+0xFF91A9C5, 0xFF94A9C8, 0xFF93AAC9, 0xFF96ADCC, 0xFF99B0CF, 0xFF9BB2D1, 0xFF9CB4D0, 0xFF9DB5D1,
+0x20A0B5D0, 0xB5CD8005, 0xB7CFFFA3, 0x0574FFA5, 0x00042000, 0xD4220430, 0xF109BCBC, 0xACBCD508,
+0xB2C2DBFF, 0xB3C5DDFF, 0xAFC0DAFF, 0xAABBD5FF, 0xA6B7D1FF, 0xE4000588, 0xC924F104, 0xC1FF97AF,
+0xC3FF8EA8, 0xC4FF90AA, 0xB4FF8FA9, 0xB7FF7E99, 0xBCFF7F9A, 0xB8FF819E, 0xB9FF7B98, 0xB5FF7997,
+0xB7FF7391, 0xB6FF7090, 0xB4FF6F8F, 0x00046A8B, 0x8DB740F1, 0x8AB3FF6A, 0x8AB1FF69, 0x8BB1FF6A,
+0x8EB4FF6D, 0x8FB2FF70, 0x8AABFF75, 0xA2BEFF76, 0xA3B7FF91, 0x899FFF92, 0x8EADFF77, 0x8BB2FF75,
+0x8EB6FF6F, 0x93BBFF72, 0x8FBBFF77, 0x8DB7FF78, 0x90B5FF76, 0x91B3FF76, 0xA6BEFF74, 0xB0C8FF92,
+0xB100089C, 0xFFA5B9D1, 0xFF9BAFC7, 0xFC9DB1C9, 0x06200005, 0x0000E800, 0x03F00108, 0xFF88A1BF,
+0xFF859EBC, 0xFF95ADC9, 0xFF6D85A1, 0x0644B3CE, 0xFF9C07F0, 0xFFA2B8D0, 0xFF9FB7CF, 0xFFA4BCD4,
+0xFFAEC4DC, 0xFFB2C6DF, 0xD0310048, 0x0544A8BA, 0xB1055C00, 0xFF9EADC0, 0xFF8C9BAE, 0xC095A4B7,
+0xB2C95014, 0x94DAFFA3, 0xACBB210B, 0xCFB10AAC, 0xD2FFA9BB, 0xD5FFACBE, 0x0610B1C4, 0x00824800,
+0xDA408250, 0x04FFB9CA, 0xC8D63100, 0xF114A8B6, 0xB6C6D308, 0xBDCDDAFF, 0xBFD0DAFF, 0xBBCBD8FF,
+0xC0CED9FF, 0xC5D2DBFF, 0xAC0073BC, 0x23740002, 0x00038000, 0x480004F4, 0x6500000F, 0x00000400,
+0xE80004E0, 0x0A640004, 0x0019D800, 0x580046E4, 0x7DB40005, 0x0019F400, 0xD2311504, 0x7DC0B5C2,
+0x31BBBC00, 0xD8B7C5D2, 0x1A200010, 0xC4D1E132, 0xD140743C, 0xBCDFFFC4, 0xCA1FF186, 0xC5D5FFBA,
+0xC0D0FFB4, 0xBFCEFFAF, 0xBECDFFAC, 0xBCD0FFAB, 0xBCD9FFAA, 0xA5C7FFAD, 0x2549FF98, 0x264AFF1B,
+0x2C4CFF20, 0x2946FF27, 0x0009E425, 0x4D710EE8, 0x4CFF2C30, 0x13F42B2F, 0x3109FC00, 0xFC232943,
+0x253BB104, 0x2339FF1F, 0x2136FF1E, 0xF1280020, 0x26273910, 0x282A39FF, 0x222431FF, 0x1C1B29FF,
+0x181423FF, 0x0D0918FF, 0x000110FF, 0x5C6373FF, 0xD7717968, 0xD7FFB5C8, 0x11C0B1C6, 0xBACAD740,
+0x0038A4FF, 0x50000B30, 0x035C0004, 0x0009B001, 0xDD216A74, 0x0029F8D6, 0xC80009D4, 0x040C0018,
+0x00000400, 0x24000408, 0x044C0004, 0x00472C00, 0x940004D4, 0x00040038, 0x006B8800, 0xC0000664,
+0x0004001A, 0x004CA800, 0xDC0004FC, 0x00080151, 0xFFD0DA30, 0x04000064, 0x0504000A, 0x11000C02,
+0x000630CC, 0x04011718, 0xCDD9214D, 0xCC004CDC, 0xDFEB200B, 0x2C0256EC, 0x4CF00079, 0x00390000,
+0x5C007A34, 0x1B200000, 0x04050800, 0x78000668, 0x0D0C0000, 0x00066000, 0x8C041768, 0x43580039,
+0x1006F001, 0x110A70D6, 0x0066DCCA, 0x10000530, 0x053C0034, 0x0000C800, 0x08000FA8, 0x0200001F,
+0x00010800, 0x6C00058C, 0x057C0004, 0x01057000, 0xCE300700, 0x0714FFC6, 0x00103400, 0x780011E4,
+0xCFD84004, 0x0004FFCB, 0x0012A800, 0xD400207C, 0x00380005, 0x00070C00, 0x54010E5C, 0x88C9120E,
+0x352C0002, 0xB7C9DDB1, 0xB5C7DBFF, 0xB1C3D7FF, 0x60007AF0, 0xF4FAB10B, 0xF1FAFFF5, 0xB0C0FFEE,
+0x0008F8A9, 0x04F113E4, 0xFF9D8968, 0xFF542900, 0xFF410400, 0xFF703F3B, 0xC8EADEE8, 0x05480021,
+0xCAD6E450, 0x715CE0FF, 0xE8CBD321, 0x16540021, 0xC7D408F1, 0xA9B7FFBF, 0xA7B5FFA3, 0x9FADFFA1,
+0xAEBFFF99, 0xBECEFFAB, 0xF21CC8B8, 0xB2B9CB00, 0xAEB7C8FF, 0xAFBACCFF, 0xAEBBCCFF, 0xBFE10ED0,
+0xC0D4FFB0, 0xBAD4FFAF, 0xB9D4FFA9, 0x0004DCA5, 0xD37104F4, 0xD0FF9FB4, 0x04AC9AB1, 0x3204B000,
+0x1097AECD, 0x0DF00000, 0xFF9BAE61, 0x0899ADC8, 0x13440013, 0xABC300F2, 0xA9C1FF99, 0xACC4FF97,
+0xAEC6FF98, 0x2103FC9C, 0x049C9CB0, 0xA5B9D2B1, 0xA8BCD5FF, 0xA4B8D3FF, 0x48000034, 0xADC8410E,
+0x0994FF98, 0x3098AD21, 0x0F40000A, 0xA1B3C973, 0xA4B5C9FF, 0xAA1103C8, 0xD1801894, 0xD5FFACBD,
+0x1CFFAEBE, 0x050C0000, 0xB10A8800, 0xFFA4B8D1, 0xFFA2B6CF, 0x749FB3CE, 0x00500005, 0xA2BE06F0,
+0x9EBAFF8A, 0xA0BBFF86, 0x98B3FF86, 0x98B6FF7E, 0x00B6FF7F, 0x9943F105, 0x90B0FF7E, 0x8FAFFF73,
+0x8BADFF72, 0x8AAEFF6D, 0x8DB3FF6C, 0x91B8FF6D, 0x92B8FF71, 0x91BAFF70, 0x91B9FF70, 0x8EB7FF6E,
+0x86AFFF6D, 0x93BCFF66, 0x8BB3FF73, 0x87ACFF6E, 0x89ACFF6B, 0x9FBAFF75, 0x9FB1FF8B, 0x8699FF8E,
+0x87A6FF71, 0x89ADFF6E, 0x0005246B, 0x3DF00024, 0xFF728AB6, 0xFF728BB4, 0xFF718DB2, 0xFF728FB1,
+0xFF859AB7, 0xFF889DBA, 0xFF768BA6, 0xFF5F748F, 0xFF7D92AD, 0xFF7C94AE, 0xFF809AB5, 0xFF89A2C0,
+0xFF8FAAC8, 0xFF90AACB, 0xFF84A1C1, 0xFF87A4C4, 0xFF849FBD, 0xFF0C2745, 0xFF8CA5C3, 0x34F10514,
+0xFF8CA6C1, 0xFF90AAC5, 0xFF94ADCB, 0xFFA2BAD6, 0xFFAEC3DE, 0xFFAEC0D6, 0xFFA4B5C5, 0xFF8E9FA9,
+0xFF76858A, 0xFF627272, 0xFF2E3C3C, 0xFF354343, 0xFF536162, 0xFF626F75, 0xFF839099, 0xFFAAB8C5,
+0x88A2B4C8, 0x10940014, 0xF2000400, 0xA3B5CB00, 0xA7B9CDFF, 0xAFC1D5FF, 0xB2C5D6FF, 0xC7100004,
+0xBAD19678, 0xB5C7D5FF, 0xAFC1CFFF, 0xB0C2CEFF, 0xB000000C, 0xD4DF3141, 0x005094C6, 0xE0000C90,
+0x08600009, 0x00030000, 0x040009C0, 0x03600000, 0x00244000, 0xDB311070, 0x111CBFCB, 0x0004F000,
+0xDC0082AC, 0x05740015, 0xAFC4D731, 0xD4710B7C, 0xD3FFAEC3, 0x0004AFC2, 0x00161000, 0xCC71160C,
+0xCDFFA8BB, 0x10F8A7BC, 0xC0D30CF1, 0xC1D4FFAB, 0xC2D4FFAC, 0xC1D6FFAB, 0xC2D2FFAB, 0xC3CFFFAB,
+0xC6D3FFAB, 0xF101F0B0, 0xBAC8E318, 0x1C2743FF, 0x222946FF, 0x1C223AFF, 0x191E32FF, 0x1E2134FF,
+0x232639FF, 0x292B40FF, 0x2D2F46FF, 0x282C45FF, 0x3BB122EC, 0x3BFF2128, 0x3DFF2229, 0x0EE42628,
+0x2F4118F1, 0x2939FF30, 0x2330FF2A, 0x1D28FF21, 0x151EFF19, 0x0E17FF11, 0x0E18FF0B, 0x0C18FF0E,
+0x0C18FF0C, 0x3440FF08, 0x00B2702A, 0x300016B8, 0xCEDD320C, 0x3079DCBB, 0xA0FFC7D5, 0x60C00442,
+0x21010001, 0x3860CED6, 0x00041400, 0x9C000004, 0x0428000E, 0x00043800, 0xC0020520, 0xB0CE1104,
+0x0490000D, 0x00889800, 0x24000B70, 0x0F600017, 0x01000400, 0xD42103AC, 0x001BF4C7, 0xD0000904,
+0x0B400079, 0x000F7404, 0x98000008, 0x01840004, 0x00202C00, 0xF4000040, 0x004C0042, 0xCAD8E535,
+0x30007568, 0x04CC0043, 0x02067400, 0x70060004, 0x0010004D, 0x001C5C00, 0x70000060, 0x00280000,
+0x400AE400, 0xFFBFCCDC, 0x0C001C9C, 0x7A5C0000, 0x02000400, 0xBE111110, 0xB004399C, 0x15040011,
+0x0004B000, 0xF0000A68, 0x02080001, 0x00060C00, 0x680070F0, 0x12700012, 0x0006F400, 0x040404D0,
+0xCEDA3100, 0x0013A8C4, 0x040009E4, 0x84D71005, 0xC9D02126, 0x840016FC, 0x20C0007F, 0x0020F800,
+0xD4804E20, 0xD4FFB3C4, 0xFCFFB0C3, 0x13140001, 0xBED500F1, 0xBDD3FFA8, 0xB8D0FFA4, 0xB3C4FFA0,
+0x0035449E, 0x80005DD8, 0xB1BE3168, 0xF11358A3, 0xB7BFC20C, 0x90754AFF, 0x6F3704FF, 0x5E1000FF,
+0x50100EFF, 0xD3C9D4FF, 0xB7C8DAFF, 0xE0313A70, 0x011CBFD0, 0x04013400, 0x9000307C, 0xC51CF162,
+0xB5FFACB3, 0xA9FF9CA3, 0xABFF9097, 0xC2FF9398, 0xB3FFA9B0, 0xB7FF9AA1, 0xC3FF9CA4, 0xBAFFA6B1,
+0xCDFF9AA7, 0xC6FFABBA, 0x0324A1B2, 0xB4C703F0, 0xB6CDFF9F, 0xB6CEFFA0, 0xB6D1FFA0, 0xB5CFFFA1,
+0xD4000ED4, 0xFF958009, 0xFF96B0CB, 0x1824B3CE, 0xFF940BF0, 0xFF95ADC5, 0xFF95ABC2, 0xFF93A8BD,
+0xFF9AACC0, 0xFFA7B8CA, 0xFFB2C1D4, 0x7C0007FC, 0x06880001, 0x000CE000, 0xED2072D8, 0x9122ECDF,
+0xDDEDFFD0, 0xDFEFFFD1, 0x000AF0D3, 0xD9710A70, 0xDFFFB9C9, 0x0AFCBFCF, 0x0804DA11, 0xD5FFB591,
+0xD3FFB6C6, 0x4530B8C6, 0x7185E800, 0xFFCFDDEA, 0x04CCDCEB, 0x0B240000, 0x31225800, 0x749BACBE,
+0xC228F100, 0xC1FF98AD, 0xBFFF97AC, 0xB9FF92A8, 0xB5FF8BA1, 0xB4FF879D, 0xB2FF869C, 0xB9FF889A,
+0xB3FF90A0, 0xB4FF899B, 0xBFFF899A, 0xBBFF92A6, 0xB1FF8EA2, 0xB4FF8196, 0x05208499, 0x879EBD31,
+0xC531046C, 0x04908DA6, 0xA3C434F1, 0x99BAFF89, 0x93B8FF7F, 0x95BDFF77, 0x92BBFF78, 0x8DB5FF72,
+0x8CB1FF70, 0x87A8FF70, 0x9CB5FF73, 0xA7B5FF88, 0x93A0FF95, 0x99B1FF7D, 0x9FBEFF7D, 0x9ABCFF80,
+0x93B7FF7C, 0x92BAFF75, 0x94B9FF79, 0x7105607A, 0xFF6F8EAB, 0xD493A7C2, 0x00900005, 0x021830B1,
+0xA4B9D4FF, 0x91A6C1FF, 0xBB710B08, 0xBBFF879F, 0x0598849D, 0x839EBB71, 0x86A1BEFF, 0x1C000518,
+0xA1BCC005, 0x9EB9FF87, 0xA5C0FF84, 0x0504FF8B, 0xA6C224F1, 0xA3BEFF8E, 0xABC3FF8E, 0xB2C4FF97,
+0x8A95FFA1, 0x6063FF7C, 0x5A56FF52, 0x5F57FF4E, 0x3F36FF54, 0x453CFF35, 0x3D35FF3B, 0x3A36FF33,
+0x4F50FF2F, 0x317A3045, 0xFCABBBCA, 0xC5D93109, 0x310758B3, 0xD8B1C2D6, 0x15B00006, 0xF10F5400,
+0xA9BACA00, 0xA6B8C6FF, 0xACBECCFF, 0xADBFCDFF, 0x10000500, 0xCBD9320A, 0x120990B9, 0x0073C8CF,
+0xD4400EB8, 0xE8FFBEC8, 0x13180009, 0x000CB800, 0xFC00050C, 0x00040073, 0x10031000, 0x007D90DF,
+0xCD1050EC, 0xB95132F4, 0xB6C7D7FF, 0xA00096F4, 0xCFE080AC, 0xCCDDFFBA, 0x8334FFB7, 0xABC1CFC0,
+0xA5B8C9FF, 0x9FB2C3FF, 0xF00264FF, 0x9EB5C712, 0x9FB5CAFF, 0x9FB8CCFF, 0xA0B9CDFF, 0xA1BACEFF,
+0xA3B9D0FF, 0xA3B8CBFF, 0xA4BAC7FF, 0x111CC8FF, 0xA9BB03F1, 0xBECDE4FF, 0x222E48FF, 0x202A43FF,
+0x242B3EFF, 0x0CF122CC, 0xFF1B1E2D, 0xFF1E202D, 0xFF1E1F31, 0xFF25283B, 0xFF26293C, 0xFF1F2437,
+0x04222838, 0x23343100, 0xF1001C20, 0x17162818, 0x0F0E1EFF, 0x0F111EFF, 0x151723FF, 0x12171DFF,
+0x0C1117FF, 0x0E1118FF, 0x0A0D14FF, 0x040B15FF, 0x1E2A36FF, 0xB80042A4, 0x9E400005, 0x001BBC00,
+0x50001BC8, 0x1BD80003, 0x00043000, 0xE0000450, 0x05F40020, 0x0103E800, 0xD02108FC, 0x001544C6,
+0x28000518, 0x298C0010, 0xBBC8D1B1, 0xB8C6D1FF, 0xB3C3D0FF, 0x0001E4C8, 0xB2C32121, 0xE0000ADC,
+0x011C000A, 0x211C2801, 0x0074BDCD, 0x00049000, 0x4C000514, 0x04640004, 0x00130400, 0xDB310004,
+0x83F0BECB, 0x01213C00, 0xC0310654, 0x1C20FFB0, 0x54B0C122, 0xB2C32121, 0x2C000008, 0xC5D331E5,
+0x310BC8B3, 0xC0B4C6D2, 0x01C80406, 0x00000800, 0x78000694, 0xC3D33100, 0x000B5CB2, 0x1000934C,
+0x00880000, 0x350C0C00, 0x58B8CAD8, 0x0BB80089, 0x000B9C00, 0xCE310BA8, 0x2B08B3C1, 0xBCC3D322,
+0xC0D02025, 0xB61121CC, 0xE4000E28, 0x0460004D, 0x0004CC00, 0x04000508, 0x00040007, 0x0100C000,
+0xDC300A74, 0x0E80FFD2, 0x00061C00, 0xED710A48, 0xEEFFDAE2, 0x0ABCDAE4, 0x00014800, 0xD8021198,
+0x18340017, 0xFFA306F1, 0xFF9DB6CC, 0xFF9BB5CC, 0xFF9AB4CD, 0xFF95B1C9, 0xBC94AABF, 0xF4F74039,
+0x6D7CFFEC, 0xB0BD24F1, 0xA4BBFFA0, 0xB1B0FF8E, 0x9862FFA8, 0x9D5CFFB1, 0x1E00FFD4, 0x0C06FF71,
+0x7582FF55, 0xB2C6FF8D, 0xAFC3FFB1, 0xB8CAFFAE, 0xB9CAFFB7, 0xB9C9FFBC, 0x00174CBA, 0x04F126A4,
+0xFFA6B1C5, 0xFFADB5CA, 0xFF9CA3B6, 0xFFA0A7B9, 0xF4A1A9BC, 0xAE04F109, 0xB1FF969F, 0xAFFF95A1,
+0xB7FF909B, 0xC0FF95A1, 0x09709CAB, 0x40129800, 0xFF99AEC3, 0xC5710458, 0xC7FF9BB0, 0x00049CB2,
+0x08AFC422, 0xB4C8311D, 0x3118D89B, 0x9CB3CADC, 0x99C00199, 0x80BFCF21, 0xE4F4B194, 0xEAF6FFD7,
+0xE8F1FFDE, 0x0063A0DF, 0x50002030, 0x63B40015, 0x00000400, 0x08003E54, 0x065C0017, 0x0010B800,
+0x00000658, 0x2BD4000C, 0x00127C00, 0xE4000004, 0x12800149, 0xC0CDD722, 0xD4DE2171, 0x40000138,
+0x050C000C, 0x31021800, 0x34ADBDCC, 0x01CC001E, 0x000DC800, 0xD800EC30, 0xB7C95003, 0x08D0FFA6,
+0xBCCC21AD, 0x98000FC8, 0xEF0BF308, 0xF9FFD4DC, 0xF7FFDEE6, 0xF0FFDCE4, 0xEFFFD3DE, 0xE0FFCFDC,
+0xE3FFBECD, 0x610004CF, 0xE5FFBCCC, 0x0004BBCD, 0xABBFD880, 0x95AAC5FF, 0x3204A0FF, 0xDC87A1C4,
+0x86A06213, 0x8FA8C7FF, 0xB6210A60, 0xF0EE44A5, 0x9EB0BA17, 0x97B0C4FF, 0x9AB6CEFF, 0x99B4CFFF,
+0x9DB8D5FF, 0xA9C2E1FF, 0xA9C0DFFF, 0xA5BFD8FF, 0xAAC4DBFF, 0xD0BBCEFF, 0xB10CF008, 0xB7C8DCFF,
+0x728397FF, 0xB4C4DBFF, 0xA0B0C7FF, 0xB1C3DBFF, 0xA9BBD1FF, 0x0474D5FF, 0xFFA7B961, 0x04A6BBCE,
+0xC000F107, 0xCFFF98AD, 0xCDFFA7BC, 0xD4FFA5BA, 0x0EF8AABF, 0x9DB5CD31, 0x2CF11E88, 0xFF9EB0C4,
+0xFFACBCCB, 0xFFBCC9D2, 0xFF798287, 0xFF3D4343, 0xFF535854, 0xFF6F746D, 0xFF43463F, 0xFF3B3E37,
+0xFF454742, 0xFF2D322E, 0xFF393D3C, 0xFF5B6064, 0xFF919AA3, 0x78CBD4E3, 0x297C0041, 0xC1CCDE40,
+0x000004FF, 0xB000649C, 0xCAD6310E, 0x002DA8BE, 0xE80003B0, 0x0D1C000D, 0x402E0400, 0xFFC4CFE1,
+0xE8004658, 0x03E40004, 0x24D4E120, 0x94C2111B, 0x08000011, 0xC4D2DB31, 0xC0007398, 0x17740116,
+0x2182E000, 0x8318C6D2, 0xBDCFDD31, 0xB40096BC, 0x08600087, 0x5008AC00, 0xFFCADBE5, 0xE196E0DE,
+0xDBFFC7D9, 0xD6FFBFD1, 0xCBFFB9C9, 0x2454ABBB, 0x00245C00, 0x04F10148, 0xFF94AFC4, 0xFF97B0C6,
+0xFF9CB2C9, 0xFFA5B7CD, 0xECA2B3C7, 0xAEBF6005, 0xB9CDFF9B, 0x1BF0A3A0, 0x6983FFBE, 0x213AFF5D,
+0x1F32FF17, 0x1F2FFF18, 0x121EFF19, 0x2633FF0E, 0x2837FF24, 0x2130FF26, 0x2835FF1F, 0x2733FF26,
+0x0518FF23, 0x10202CF1, 0x0615FF0A, 0x2231FF03, 0x071BFF1F, 0x1D32FF06, 0x293BFF1F, 0x1E2CFF2A,
+0x1721FF1F, 0x181DFF17, 0x151AFF17, 0x141AFF12, 0x0B14FF0F, 0x1523FF02, 0xDAEDFF09, 0xC0D5FFCD,
+0x400D68B1, 0xFFB9CBE1, 0xD8620004, 0xDEFFB0C2, 0x609CB4CA, 0xFFBACCD8, 0x9C90CFDB, 0x025CC011,
+0x00014404, 0x0CF10FF4, 0xFFBAC8D3, 0xFFB8C9D1, 0xFFB5C7D1, 0xFFB1C4D2, 0xFFAFC2D1, 0xFFADC3D1,
+0x40B5CBD9, 0xCAE04000, 0x16C4FFB8, 0xBACCE031, 0x1C009D14, 0xCDDB404D, 0x0004FFBA, 0x40048400,
+0xFFC1D2E2, 0xE34012F8, 0x4CFFC5D2, 0xD0E05006, 0xA8DFFFC4, 0xB9C82109, 0xCA3108DC, 0x2140A8BB,
+0x50022000, 0xFF9FB4C9, 0x610894CB, 0xCCFFA5B7, 0x25A4A4B6, 0x000B5000, 0xD1C004E0, 0xD0FFB0C3,
+0xD2FFAEC1, 0x6CFFAEC4, 0xC1CF6006, 0xC0CEFFAA, 0x02F12F7C, 0xB9C9FFAB, 0xBCCCFFA2, 0xBACAFFA5,
+0xB9CBFFA3, 0xB10004A2, 0xFFA5BCCE, 0xFFA7BED0, 0x84A4B9CC, 0x0BB00002, 0x310B8800, 0xACB0C5D8,
+0x9874000B, 0xB7C6D960, 0x34BED1FF, 0xFFB8910C, 0xFFBDC8DA, 0x44C1CDDD, 0x06F80026, 0x0025C800,
+0x900014C8, 0x04FC0066, 0x71022000, 0xFFB9C5D1, 0x00BFCCD5, 0x03E80021, 0x0018E404, 0x0800100C,
+0xD7E73109, 0x0109ACCA, 0x0C001794, 0xA8BE300E, 0x7102E8FF, 0xFF9CB6CD, 0x6094AEC7, 0x123C0009,
+0xF034C400, 0xF1F4F945, 0xE8F3F7FF, 0x9EB1B8FF, 0x9CB1C4FF, 0xB2BCB4FF, 0xC4B16FFF, 0xD4A557FF,
+0x752600FF, 0x540400FF, 0x723E4AFF, 0xE5BFD4FF, 0xDFBACCFF, 0xC39EB0FF, 0xBD93A7FF, 0xDEC1D7FF,
+0xC5C3D8FF, 0xB0BCD2FF, 0xA0ACC4FF, 0xAAB5CBFF, 0x99A2B3FF, 0x919AA9FF, 0x0005D0FF, 0x14F1225C,
+0xFF9CABB2, 0xFFA1AFB8, 0xFF98A3B5, 0xFFA2ADC3, 0xFFA6B2C8, 0xFFACBBD2, 0xFFA0B2CA, 0xFF9CAEC4,
+0x88A5B6C8, 0x0660010F, 0x7CB5C721, 0x448801D4, 0xFFBECE30, 0xF0318148, 0x700CD8E4, 0x713A7C00,
+0xFFE6EAF5, 0xC8DCE4F1, 0x1610001B, 0x00246400, 0xEB2231B4, 0x005B90E3, 0x44012018, 0x4D180037,
+0xFFDCE061, 0x70D2D8E6, 0x07480019, 0x0B34D810, 0x212AF400, 0x8980C8D5, 0x3149E800, 0x20C6D3DC,
+0x1C5C0086, 0x0015B800, 0x08F10160, 0xFFCAD6E6, 0xFFC1CEDF, 0xFFBCC9DC, 0xFFBAC7DA, 0xFFBBC8D9,
+0x74C9D6E6, 0x8524008F, 0x32739800, 0xD4E5ECF4, 0x5B00007C, 0xF4E2E921, 0x2918002B, 0xE9E7F2B1,
+0xE8E7EFFF, 0xE6E6EEFF, 0x88005B44, 0x1614001B, 0x00116400, 0x5800117C, 0xD0E2315E, 0x001564C5,
+0xDE50108C, 0xE1FFB6C8, 0xC1B008C4, 0xC0DBFFAE, 0xC5DEFFAC, 0x0F7CFFB1, 0xABB8C8B1, 0xA3ACB3FF,
+0xA7B0B7FF, 0xBC0007DC, 0xC3D64004, 0x02E0FFAE, 0xB9C9E071, 0xB2C3D7FF, 0x00F11878, 0xFFC6D3E4,
+0xFF484F59, 0xFF59626B, 0x68575F6A, 0xC8D5715D, 0xAAB6FFC0, 0xF1126CA0, 0x4A546010, 0x59636DFF,
+0xACB6BFFF, 0xB4BEC7FF, 0x8E9BA3FF, 0x87919AFF, 0x8B98A0FF, 0xB2BCC5FF, 0xC0006FEC, 0x08840092,
+0xC4D4E131, 0x78008AF4, 0xDF20F124, 0x72FFD5DD, 0x3EFF6F73, 0x52FF4143, 0x4CFF595A, 0x28FF5454,
+0x36FF3030, 0x1EFF3E3E, 0x30FF2324, 0x58FF3435, 0x28FF595B, 0x65FF2526, 0x32405D60, 0x00241000,
+0x8C002124, 0xD8E4311D, 0x0037F4D2, 0x64001CD0, 0x37540012, 0x01327800, 0xCD2108BC, 0x001CFCC3,
+0x38002890, 0x55780005, 0x0008D800, 0xD40046CC, 0x0E040007, 0x80141800, 0xFFC6D4DD, 0xFFC1CFD8,
+0x0400051C, 0x01C00012, 0x40329000, 0xFFBDCED8, 0x30000424, 0x0CE00009, 0x00790800, 0xD9C00F24,
+0xDAFFC3D0, 0xD6FFC5D2, 0xD4FFC1CE, 0x0A3C0022, 0x000D4000, 0x880003F0, 0xDA00F10F, 0xD7FFB3CA,
+0xD7FFACC6, 0xE2FFAEC5, 0x0140BCCE, 0x0003FC00, 0x1C004BFC, 0xC7DA2004, 0x02F189B0, 0x90A8FFC5,
+0x2C45FF84, 0x2336FF22, 0x1321FF1C, 0xF10EB80D, 0x13152140, 0x1A1927FF, 0x232230FF, 0x181B24FF,
+0x0F121BFF, 0x060918FF, 0x010413FF, 0x282E3CFF, 0x111725FF, 0x222337FF, 0x25263AFF, 0x1F1C31FF,
+0x191627FF, 0x15141CFF, 0x0E0F13FF, 0x131418FF, 0x050A0EFF, 0x09121BFF, 0x091221FF, 0xD1DCEEFF,
+0xD931025C, 0x2070B9C6, 0xADBFD340, 0xB220A4FF, 0xFFAEC0D4, 0xFFA6B9CA, 0x20AEC2CD, 0xB5C5D010,
+0xBBCBDBFF, 0xBECCD7FF, 0xD0CDD8FF, 0xFFBB4005, 0x4CB8D4E3, 0xD2FFBE91, 0xD7FFB3C7, 0x0AECB3C9,
+0xB7CBD672, 0xB5C9D4FF, 0xC33009F8, 0x0B80FFB2, 0x000DA800, 0x01F01464, 0xFFB7CAD8, 0xFFB8CEDB,
+0xFFB4CAD7, 0xFFB5CADB, 0xE2710470, 0xD8FFBACC, 0x0028B3C4, 0x712F8800, 0xFFB6C5DA, 0x60B1C0D3,
+0x01280021, 0xBFD007F0, 0xC1D1FFAA, 0xCBDDFFAA, 0xD0E2FFB4, 0xD1E6FFB9, 0xCFE2FFBC, 0xB2920034,
+0xB3C6D7FF, 0xB6C9DAFF, 0xCF10A260, 0xBB5189E4, 0xBBD2E0FF, 0xE24089EC, 0x04FFBBD2, 0xCFDF4000,
+0x0004FFB8, 0xBDD2E3B1, 0xB9D0E0FF, 0xB1C6D9FF, 0x54001070, 0x05040005, 0xC021A800, 0xFFA8BED3,
+0xFFAEC3D8, 0xFFB9CEE1, 0x6C000028, 0xCDDF40A2, 0x018CFFBC, 0xE8D4E422, 0x0A9C0084, 0x01140400,
+0xDF211E68, 0x008E58D7, 0x80006658, 0x8EF00057, 0x00000400, 0x40000724, 0x0F180007, 0x000C3800,
+0x28002680, 0x35180002, 0x000AEC00, 0x14F10720, 0xFFBECFE1, 0xFFBFD1E5, 0xFFB7CCDF, 0xFFAFC4D9,
+0xFFB1C6DB, 0xFFB0C5DA, 0xFFA3B7CF, 0xFFA1B0C3, 0x98D7DBE7, 0x0500002E, 0xB5BD32F3, 0xC6D8FFA4,
+0xCAC6FFB5, 0xC78DFFC4, 0xA65EFFD3, 0x895AFFC8, 0x553FFFC6, 0x242BFF96, 0x8DA0FF57, 0x7C8AFFB8,
+0x4252FFA6, 0x3D4FFF77, 0x8C9FFF82, 0xC8DBFFC5, 0xC3D6FFDB, 0xB8CBFFC0, 0xF0C3FFB1, 0xA507F00E,
+0xC3FF8E95, 0xCCFFA7B3, 0xA1FFB1BF, 0xABFF8B9A, 0xB6FF95A2, 0xF10774A5, 0xD8FFB10A, 0xDBFFB9C4,
+0xCEFFBBC8, 0xE3FFAAB9, 0xEBFFBFCE, 0xF4FFCEDB, 0xB994DCE8, 0xD2E1E832, 0xDD405354, 0x48EAFFD4,
+0xD5DF2180, 0x20006D00, 0x3704004A, 0x40285000, 0xFFD4DAE6, 0xE8001FCC, 0x3B0C001E, 0x00286C00,
+0x5000598C, 0x0004002E, 0x0028F800, 0xEE101B24, 0xDFA17120, 0xDBE9FFD9, 0xD7E4FFD5, 0x002C98CF,
+0x84003634, 0xD7DF3103, 0x0085E0CA, 0x28000F38, 0x03400003, 0x2114D401, 0x3194C3D0, 0x001D4C00,
+0xD14027B4, 0x18FFADBC, 0x0F400003, 0x0015D000, 0x7800105C, 0x2968001A, 0x00298000, 0xB40055F8,
+0x3B90001F, 0xB15A5400, 0xFFE7E5EA, 0xFFEBE6EC, 0x74E8E6EB, 0x24880050, 0x0026C800, 0xA8004628,
+0x68C00021, 0xC4CBDD40, 0x0040B4FF, 0xF8002324, 0xC1DA9006, 0xC0D8FFB1, 0xF8DBFFAE, 0xA4B92102,
+0xC5E20304, 0xA9FFACBA, 0xB3FF9CA3, 0xCAFFA6AD, 0x0028D4BD, 0x80000530, 0x0A78000A, 0x0028CC00,
+0xE00072FC, 0x279EF003, 0x23FF302B, 0x29FF2A26, 0x2CFF2E2A, 0x69FF312D, 0x2AFF6E6A, 0x2FFF2D2C,
+0x39FF322E, 0x32FF3C3B, 0x28FF3534, 0x29FF2D2C, 0x17FF2E2D, 0x1EFF1C1D, 0x0EFF2322, 0x23FF1213,
+0x69FF2625, 0xA1FF686A, 0xBCFF969E, 0xBFFFB0BA, 0x8BFFB5BD, 0x72FF858B, 0x6AFF7176, 0x55FF6E71,
+0x4EFF5F5F, 0x31FF5A5A, 0x3EFF3E3F, 0x34FF4B4C, 0x25FF4040, 0x23FF3131, 0x3AFF2C2E, 0x38FF4142,
+0x37FF3C3F, 0x6FFF383A, 0xE7FF6D6D, 0xD0FFE5E5, 0xC4FFCECE, 0xCFFFBFC0, 0xC2FFC8CC, 0xCCFFBABD,
+0xDAFFC3C8, 0xC0FFCFD7, 0xDBFFB5BD, 0xE0FFCFD9, 0xD0FFD2DB, 0xD7A17DB4, 0xD8DCFFCC, 0xD5DBFFCD,
+0x000004CA, 0x800013F4, 0x04F80001, 0x00019000, 0x88009088, 0x9B340010, 0xCBD7E531, 0x000123DC,
+0xC9D3210F, 0x4400050C, 0x124C000A, 0x002EDC00, 0xB7710B78, 0xC4FF9FA4, 0x337CB0B3, 0xA1328401,
+0xDEFFCFD3, 0xCEFFCFD3, 0x390CBEC2, 0xB117D000, 0xFFB7C5D0, 0xFF7B8D97, 0x2497A9B3, 0x7F74000A,
+0x00112800, 0x3C000858, 0x7BA80013, 0x005B3400, 0x02F00A48, 0xFFA2AFC2, 0xFF1B263A, 0xFF252C3C,
+0xFF0F1521, 0xF013C820, 0xFF090B0D, 0xFF080814, 0xFF2F2F3B, 0xFF040710, 0xFF02050E, 0xFF070A19,
+0xFF2A303E, 0xF1D6DC30, 0xFF2B3123, 0xFF252638, 0xFF1A1B2D, 0xFF201D2E, 0xFF171522, 0xFF0E0D15,
+0xFF0F1014, 0xFF07080C, 0xFF0C1115, 0xFF00070F, 0xFF0E1621, 0xFFD9E0F0, 0x84BAC3D2, 0xC7D3812D,
+0xC4D1FFBB, 0x0E58FFB4, 0x68B3C421, 0xC0CAB10E, 0xC6D0FFAE, 0xC7D4FFB5, 0x3104FCB7, 0xD0BFCCD4,
+0x0E040005, 0x0019E400, 0xD51060F0, 0xD02117C4, 0x318708BC, 0x90D4E3E6, 0x38B4005A, 0x74E1EB20,
+0x30CE113E, 0xCBD63189, 0xE00A28BD, 0xFFB2C6CF, 0xFFA7BFCB, 0xFFACC3D3, 0x260CC4D8, 0x1300A311,
+0xA2BBD1B1, 0xA6BDCFFF, 0xA7B8C8FF, 0x28000BF4, 0x98CF1013, 0xCD02F0A0, 0xCBD6FFB7, 0xDBE3FFB5,
+0xDAE0FFC4, 0xE5ECFFC3, 0xCA5192F8, 0xB2C5D3FF, 0x240009F4, 0xD501F005, 0xD4FFB3C6, 0xD2FFB1C7,
+0xD7FFB1C7, 0x00FFB6C9, 0x1AF4000F, 0x000EF004, 0xDC310F8C, 0x9D54BCCC, 0xBECEDE31, 0x2002A25C,
+0x84BF1120, 0x0DCC0112, 0x94BECE23, 0x0CBE12A7, 0x0D4C001B, 0xFFC1CFA2, 0xFFBAC7D0, 0xACC9D4DA,
+0xDFE62174, 0x480048A0, 0x19F00028, 0x003EC400, 0x34001F24, 0xCFD8401B, 0x01D8FFC2, 0x000F4400,
+0x5C000620, 0x05000014, 0xBEC8D150, 0x08ECD7FF, 0x30070C00, 0x80FFC0CD, 0x8ED8000C, 0x31149C00,
+0xF4CCDAE5, 0x8DE40085, 0x00021800, 0xF0310C5C, 0x8110E2E4, 0xEFF841F0, 0xB5BFFFE6, 0xD5E6FFAB,
+0xD9DDFFCC, 0xDABFFFD8, 0xB385FFE4, 0x8A5AFFC5, 0xE2BFFFA6, 0xDADAFFFC, 0xAEBBFFEC, 0xBDC7FFBC,
+0xDAE2FFCE, 0x4B52FFFF, 0x0C12FFA0, 0x323AFF5E, 0xD6E0FF5B, 0xBCC8FFE6, 0xB6C6FFC2, 0xA9BCFFB7,
+0xADC0FFA6, 0x0948FFA6, 0xF10FE400, 0x8D99A704, 0xABB4C3FF, 0xBFC2D1FF, 0xC0C3D2FF, 0xCCD3E3FF,
+0xEEA085CC, 0xF5FFD4DD, 0xEEFFDBE4, 0x00822CDF, 0xD0208688, 0x00030CFF, 0x8C000830, 0xE8F53209,
+0x3009ECE0, 0x58FFDBDF, 0x284C0040, 0x0002D800, 0xA00020FC, 0x30900053, 0xC9D3D550, 0x7718D9FF,
+0xFFD5DA30, 0xDD31378C, 0x5E44D5DA, 0xD1D701F0, 0xCBD3FFCA, 0xC6D0FFC4, 0xC6D2FFBF, 0x2C1CFFC0,
+0x40000400, 0xFFBFC9D3, 0x68000004, 0x271C0012, 0x00144000, 0x4C00323C, 0x0C440007, 0xB0C7D740,
+0x000BACFF, 0xC940122C, 0x04FF9EB4, 0xB4CA400C, 0x0EF0FFA2, 0xB6C3D331, 0x7800868C, 0x2C38001A,
+0x0033C800, 0x2C004808, 0x00880062, 0x0125A000, 0xDB215ED8, 0x0028FCDC, 0xCC0032E8, 0x08DC0000,
+0x0003B400, 0xD8713060, 0xD3FFBBC6, 0x05FCB4BF, 0x00182800, 0xCA312328, 0x232C9DB1, 0xF11E4800,
+0x9AB3C90C, 0x9BB2C4FF, 0x9EB1BFFF, 0x9DA7B0FF, 0x9EA8B1FF, 0x9DB0BFFF, 0x9FB6C8FF, 0xEC02008C,
+0xFFA45128, 0x80A1B6C9, 0xA464000F, 0x31271CF1, 0x2419FF3B, 0x342BFF2C, 0x1D14FF3E, 0x251EFF26,
+0x3026FF2E, 0x2B22FF37, 0x2F25FF34, 0x2D23FF36, 0x281CFF34, 0x281CFF2C, 0xB500082E, 0xFF1F1B10,
+0xFF2F2B20, 0xD829251C, 0x4158F1EE, 0x49FF4546, 0x2EFF4F4E, 0x22FF3636, 0x27FF2E2B, 0x33FF3533,
+0x24FF4542, 0x1EFF3633, 0x1CFF322F, 0x31FF2D2B, 0x23FF403E, 0x1EFF3031, 0x12FF2828, 0x25FF1C1C,
+0x1DFF2C2D, 0x16FF2322, 0x55FF1D19, 0x50FF5C58, 0x30FF5753, 0x4BFF3635, 0x4EFF4F50, 0x42FF5153,
+0x57FF4146, 0x34FF5458, 0x71FF3036, 0xA0FF6B71, 0x0F50989D, 0xC05E6400, 0xFFD7DDDB, 0xFFD5DBD7,
+0xFFD5DBDB, 0x00F1014C, 0xFFAEB5BD, 0xFFB9C4C8, 0xFFC5D0D4, 0xF8ACB7BD, 0xC1CA310A, 0x0050A0B8,
+0xD8000144, 0x054C0021, 0x007E1C00, 0xF800650C, 0xBF34F120, 0xCDFFB0B7, 0xBDFFBEC5, 0xC4FFB1B4,
+0xD6FFBCBC, 0xABFFD2D1, 0x9AFFA9A9, 0x75FF9997, 0x64FF7472, 0x94FF5F5E, 0x81FF8C8C, 0x5CFF767B,
+0x62FF4E57, 0x6EFF535E, 0x72FF5D6B, 0xB2FF616C, 0xB3FF9FA9, 0x0714A1A7, 0x001E7801, 0xDA300710,
+0x1CDCFFCD, 0xC1D559F4, 0x1D32FFB6, 0x2A3AFF15, 0x3844FF23, 0x1D2AFF32, 0x0F1CFF1B, 0x111DFF0D,
+0x101CFF11, 0x010AFF0E, 0x1E29FF00, 0x3947FF1A, 0x3040FF33, 0x2D3BFF2A, 0x202EFF27, 0x1D2CFF1A,
+0x1A29FF1B, 0x0F1DFF18, 0x141FFF10, 0x0C12FF16, 0x0D11FF0D, 0x0A0CFF0C, 0x0F12FF09, 0x0B11FF0B,
+0x1F2AFF06, 0xEEF8FF1B, 0xE9F3FFE7, 0x6DC0FFE2, 0x00771C00, 0x7C00916C, 0x9BD00000, 0x00917C00,
+0xF5608030, 0xF3FFDFEC, 0x5157E4EA, 0xEBEFFFDB, 0x009C18E0, 0xF0206094, 0x11976CE2, 0x0086B8CF,
+0xE6409EBC, 0xB0FFDAE4, 0x2CF8010B, 0xFFD8DC30, 0xEC000820, 0x607C0028, 0xD4E1E960, 0xF4DAE2FF,
+0x50C2116A, 0xD204F198, 0xD1FFA9C0, 0xD2FFA6BC, 0xD2FFA5BE, 0xE2FFA7C1, 0x7FE0BED4, 0x00A1A800,
+0x70001980, 0xE5F1A00D, 0xE8F2FFD3, 0xDFE5FFD6, 0xD15173B4, 0xCDDEE5FF, 0x100081EC, 0xA7480080,
+0x00AC4000, 0x05F00A58, 0xFFC3D7E2, 0xFFC1D5DE, 0xFFC0D2DE, 0xFFC3D3E0, 0xFFC5D5E2, 0xBC000640,
+0x24640006, 0xD8E4F240, 0x0000ACFF, 0x10001950, 0x06DC002A, 0x02000400, 0xC01109B0, 0x50009358,
+0xDBE4319D, 0x108600CD, 0x218358E3, 0x6618CCD9, 0x006FA800, 0x6C0023E4, 0x69E4007B, 0x00050000,
+0x08002300, 0x1EF00002, 0x001EE800, 0xF4000130, 0xE1EE318A, 0x000CC8D3, 0x34001EA8, 0xD9E23109,
+0x200944CF, 0x40A4DAE0, 0x002FAC02, 0x100001E4, 0x24000044, 0x00281400, 0x800023B4, 0x2D00007A,
+0x0003C800, 0x08001900, 0xB8C13181, 0x000168AF, 0x30F12948, 0xFFDEDED6, 0xFFCFC9B1, 0xFF80794F,
+0xFFD5CD9F, 0xFFD8CFAE, 0xFFE0D5B9, 0xFFE5D4B8, 0xFFFFE3C7, 0xFF832F17, 0xFF640C00, 0xFF835234,
+0xFFE7CFB3, 0xFFD5C8B7, 0xFFC4BFBB, 0xFF9797A3, 0x489DA4B7, 0xC500F105, 0xA2FFADB6, 0xC3FF8B92,
+0xCFFFAFB5, 0x67C4C2C6, 0x31357800, 0xD4BDC5D0, 0x20DC0076, 0x00309C00, 0xDC013594, 0xD4C81085,
+0xFFC0203A, 0x30000D0C, 0x1214000E, 0xCBCEDDB1, 0xCED0DDFF, 0xD0D4E0FF, 0x180009F8, 0xDEE6200D,
+0xC9513564, 0xD3E1E4FF, 0xA40184A4, 0xDCE4654A, 0xDAE2E5FF, 0x34000630, 0x00040020, 0x0046F000,
+0x5400247C, 0x1AF00005, 0x000F0C00, 0x9C00176C, 0xC9D9603B, 0xC7D6FFBC, 0xC80015CC, 0x1CB21506,
+0xB32000B3, 0x000D3000, 0x48001C50, 0xC8D8311C, 0x00A468B7, 0x38000970, 0x35EC0030, 0x00424400,
+0xD7B11A78, 0xC8FFC9D2, 0xD5FFBAC3, 0x28FCCACF, 0xD1D1DB31, 0xD44132EC, 0x8CFFC2CB, 0xBECA400B,
+0x7608D1FF, 0x08B4C021, 0xB9CC3137, 0x100B78AC, 0x611958C0, 0xBEFF98AA, 0x22BC96A8, 0xA2B908F1,
+0xA9BEFF8C, 0xA4B5FF93, 0xA8B5FF8F, 0xAEB5FF98, 0xC8CFFFA5, 0x001C20BF, 0x50009CB0, 0x2268001D,
+0xA6B8CC50, 0x103CC6FF, 0xA4A3B421, 0x1E6CF19F, 0x11FF3129, 0x32FF231D, 0x2CFF453D, 0x1EFF3E38,
+0x1BFF2F28, 0x26FF2B27, 0x1BFF3832, 0x23FF2D2A, 0x10FF3532, 0x1FFF211F, 0x0FFF312E, 0x24FF201E,
+0x1AFF3331, 0x20FF2826, 0x09FF2C29, 0x0BFF1512, 0x10FF1814, 0x2CFF1F18, 0x19FF3B34, 0x14FF2A23,
+0x16FF2620, 0x25FF2A24, 0x23FF3933, 0x18FF3933, 0x2CFF2C26, 0x19FF3E3B, 0x32FF2925, 0x1DFF413F,
+0x16FF2926, 0x17FF221F, 0x0540211E, 0x241BB0F1, 0x4438FF28, 0x3529FF46, 0x3E32FF37, 0x4234FF3E,
+0x372AFF41, 0x392EFF35, 0x4037FF37, 0x332EFF3D, 0x2B26FF32, 0x2624FF2A, 0x332FFF27, 0x8D88FF34,
+0xA49BFF90, 0x988DFFA7, 0x7469FF9C, 0x6D68FF78, 0x5550FF70, 0x5C55FF54, 0x5E53FF57, 0x332CFF56,
+0x2B26FF2E, 0x3432FF29, 0x4949FF34, 0x7B78FF49, 0x6A64FF79, 0x796FFF69, 0x6054FF79, 0x796EFF64,
+0x796FFF81, 0x928BFF80, 0xA098FF95, 0x7165FFA0, 0x493AFF71, 0x4635FF4B, 0x4030FF49, 0x5343FF46,
+0x594EFF5A, 0x7E76FF61, 0x8681FF85, 0xA09BFF89, 0x5653FF9F, 0x5450FF54, 0x5655FF4F, 0x6C6FFF52,
+0x8F98FF68, 0xC0CFFF8C, 0xD6E7FFBE, 0x00026CD3, 0x1C001D14, 0x473C000C, 0xDDF708F1, 0x2845FFD6,
+0x2C3FFF23, 0x2232FF27, 0x3044FF1C, 0x2F41FF2F, 0xF119042E, 0x0F111D04, 0x2E303DFF, 0x303342FF,
+0x262B3EFF, 0x202538FF, 0x10F236EC, 0xFF191F2D, 0xFF1C1E2D, 0xFF141623, 0xFF161620, 0xFF0D0D15,
+0xFF0A0B0F, 0xFF0C0D0F, 0x080B0C10, 0x0205A105, 0x2C2F36FF, 0xF4F5FAFF, 0x84005C60, 0xEFEC317A,
+0x0075BCED, 0xD8002BE0, 0x26540022, 0x002CFC00, 0x700126E4, 0xDEE32151, 0xC9C033A0, 0xF1FFC0C5,
+0xEFFFE2E4, 0xD4FFDDE0, 0x02D40043, 0x00223C00, 0x0C003C4C, 0x0CF00023, 0xD5D7E4B1, 0xD9DBEAFF,
+0xDADCEBFF, 0x68000008, 0x34A00083, 0x330C7C00, 0xF4C4D1D9, 0x2CC611A6, 0xD5DF316B, 0x310474C4,
+0xBCD1E0E7, 0x041C005B, 0x00000400, 0xE40011A8, 0x22C80022, 0x10038000, 0x2142D4E2, 0x896CC5CE,
+0xC5CEDF71, 0xC8D4E4FF, 0xF0009D18, 0x1FBC0004, 0x71157000, 0xFFC6D7DF, 0x04CBD9E2, 0x6AFC0000,
+0x14DFE720, 0x58D0114E, 0x4D140018, 0x00924C00, 0x90006AF0, 0x115C0004, 0x71925400, 0xFFD5E0E4,
+0xE0D3DEE2, 0xE0E5318D, 0x008CE0D1, 0xE9100038, 0xE2628CE4, 0xEAF3FFD8, 0x613B88E1, 0xE0FFBEC4,
+0x7A50CED4, 0x000F0800, 0x000000A0, 0x00A0000F, 0x00050001, 0xDE218D1C, 0x007090D0, 0xE0001810,
+0x1F1C0004, 0x00000400, 0x080004E4, 0x0DB40000, 0x0009E800, 0x080012DC, 0x1448002A, 0x31804C00,
+0x60D5D9E5, 0xE3E28053, 0xF3EFFFDF, 0x7734FFEE, 0xB1B358F1, 0xD8DDFFA9, 0xD5DAFFC9, 0xD3D3FFC6,
+0xD4CAFFC7, 0xC8B4FFCE, 0x7546FFCD, 0xC870FF83, 0xB950FFE0, 0xC863FFDA, 0x9237FFEE, 0x4E03FFC5,
+0x5307FF93, 0xB354FF95, 0xB155FFDB, 0xB674FFCA, 0xBD98FFC8, 0x9794FFC5, 0xB6C6FF95, 0xC0D2FFAF,
+0x94A2FFB9, 0xA9B4FF8E, 0xC2C8FFA5, 0xD5D8FFBD, 0xCED4FFCD, 0xB4BFFFC7, 0x002824B0, 0xC80007BC,
+0x40300023, 0xC7CEDE71, 0xC5CADDFF, 0xAC008AE4, 0x0BBC003B, 0x000FDC00, 0x0C00121C, 0x43A00005,
+0x000EC400, 0xDC3101A4, 0x41A4C7D4, 0x00305000, 0x1000060C, 0x62280020, 0x00000400, 0xF4004D40,
+0x2E840004, 0x0037AC00, 0x1801623C, 0xD3DC212A, 0x34009508, 0x0AF80000, 0x00013C00, 0xE8000004,
+0x0B18001F, 0x001FB400, 0x24000004, 0xD3DD405E, 0x01D4FFC2, 0x80BBC000, 0xFFC5D6DD, 0xFFC2D3DA,
+0xD40006A4, 0x0D30006C, 0xDAEA00F1, 0xD9E9FFD3, 0xD1E4FFD3, 0xCCDCFFCC, 0x312F1CC6, 0x9CC4CBD1,
+0x463C0049, 0x01642800, 0xD8135F24, 0xDE626CF4, 0xD9E1FFD1, 0x00453CCC, 0xD4210E08, 0x005E78C8,
+0xA40012E4, 0x45AC001A, 0x000DC800, 0xA4002910, 0x0F88001B, 0x7129C400, 0xFFA7A7A9, 0xA0C6C6C8,
+0xE1F04094, 0x07FCFFD8, 0x59B4EA10, 0x08C4D021, 0x16080096, 0xF1064000, 0x2B251900, 0x292317FF,
+0x443E32FF, 0x373327FF, 0x2CF104FC, 0xFF2E2A1E, 0xFF333021, 0xFF252314, 0xFF252412, 0xFF2C2B19,
+0xFF2B291A, 0xFF202111, 0xFF2E2F21, 0xFF232317, 0xFF2A2A20, 0xFF1E1B12, 0xFF160F07, 0xFF1C130C,
+0xFF443B32, 0x4C281F16, 0x0F00F100, 0x1AFF211B, 0x14FF2E28, 0x10FF2822, 0x0514241E, 0x261A04F1,
+0x392DFF2C, 0x2218FF3F, 0x2016FF29, 0x261EFF27, 0x710A5C2D, 0xFF332D21, 0x68383526, 0x16A8F105,
+0x10FF2725, 0x22FF2322, 0x2DFF3132, 0x28FF3A3B, 0x20FF3434, 0x26FF2A27, 0x20FF2F2A, 0x22FF2B23,
+0x2AFF3027, 0x2AFF3D33, 0x38FF4236, 0x48FF5548, 0x23FF6458, 0x3DFF362E, 0x2EFF4D49, 0x20FF3E41,
+0x1DFF2F34, 0x27FF2E2F, 0x24FF3634, 0x25FF312D, 0x23FF322E, 0x19FF312F, 0x1DFF2B28, 0x2FFF3730,
+0x44FF5045, 0x32FF6A5B, 0x40FF5647, 0x3AFF5C50, 0x38FF534C, 0x3CFF514F, 0x2CFF5B57, 0x21FF4F48,
+0x40FF473B, 0x37FF6657, 0x3EFF594A, 0x52FF584C, 0x3DFF655D, 0x46FF4C48, 0x5CFF524F, 0x42FF6666,
+0x53FF4A4A, 0xB9FF5655, 0xEFFFB5B2, 0xE9FFE3E1, 0xE8FFDAD9, 0x3104D6D9, 0xD0023800, 0xFFCED4E2,
+0xFFD0D5F2, 0xFF242947, 0xF100043F, 0xFF262B0B, 0xFF202239, 0xFF212237, 0xFF1D1F2E, 0xFF1C202C,
+0xFF2B2E3F, 0xF42F3146, 0x31E8002C, 0xF1052400, 0x23263502, 0x232532FF, 0x161824FF, 0x14141EFF,
+0x13F419FF, 0x10FF0942, 0xF105080E, 0x07080D48, 0x0B0C11FF, 0x302F34FF, 0xC5C3C6FF, 0xD6D5D1FF,
+0x908D84FF, 0x6F6C63FF, 0x807D76FF, 0x797873FF, 0x959492FF, 0xCCCCCAFF, 0xB8B9B4FF, 0xB2B3AEFF,
+0xB8B8B6FF, 0xC7C7C5FF, 0xA7A6A2FF, 0x82817DFF, 0xA2A0A3FF, 0xCFCDD2FF, 0xDFDFE1FF, 0xDDDFDEFF,
+0xDDDEE0FF, 0x040064B0, 0x11F40012, 0x10121C00, 0xF05D94E9, 0xFFE3E100, 0xFFD9D8E0, 0xFFDFDEE3,
+0xFFDCDCDE, 0xE131678C, 0x44A0DCE0, 0x043B9000, 0x18F14980, 0xFFD8DEDC, 0xFFDAE0DE, 0xFFC2C6C9,
+0xFFC1C5C8, 0xFFBDC1C4, 0xFFA8ADB0, 0xFFB0B5B8, 0xFF787D81, 0xFF8C8F96, 0xBCB9BCC5, 0xC3CC4035,
+0x16E0FFC0, 0x212D8001, 0x74BCDEE5, 0x0041C400, 0x5C001248, 0xCFD7B105, 0xCDD6FFC2, 0xCDD3FFC3,
+0x802EBCC2, 0xFFC5CED5, 0xFFC6CDD5, 0x8C005CBC, 0x0898000D, 0x71868400, 0xFFE2EAEC, 0x60DFE7E9,
+0xDEDD6059, 0xDFE1FFD5, 0xD1114DCC, 0xC4905CF8, 0xCDFFB9C1, 0xDBFFC3CB, 0xDDE13994, 0xA6AEFFDA,
+0x8F97FFA6, 0xBFC9FF8F, 0x006730BF, 0xD800446C, 0xD0D84031, 0x0438FFC9, 0x0004D400, 0xB800282C,
+0xCD0CF101, 0x83FFC4C9, 0xB5FF7B80, 0xC7FFAEB2, 0xB5FFC4C5, 0x90FFB2B3, 0x7FFF8D8E, 0x00D87A7E,
+0x01454800, 0xDD253784, 0x004F30D9, 0xD1503BA0, 0xE1FFCECF, 0xF4218088, 0x407C20EF, 0xFFB4B9BC,
+0x40F1408C, 0xFFCFDFDF, 0xFFCCD8D8, 0xFFD0D6D2, 0xFFE0DED1, 0xFFA79A6E, 0xFF947A1B, 0xFFCCA52E,
+0xFFCD9E28, 0xFFDEA439, 0xFF9B5000, 0xFF955100, 0xFFA57B0B, 0xFFCEB541, 0xFFBDA649, 0xFFB6A668,
+0xFFA4A289, 0xFF9EA09D, 0xFF999A9F, 0xFF6F6E74, 0xE0CCCACD, 0xF5F17241, 0xEBE9FFEF, 0xF08AE8E5,
+0xFFEEEE08, 0xFFE6EBE7, 0xFFE8EEEC, 0xFFD3D7DA, 0xFFD1D1D9, 0xFFE0DFE7, 0x50013C9C, 0xD2DD2144,
+0xE631061C, 0x5324D7E2, 0x00150800, 0x0C002114, 0x10040017, 0x9EE8DC10, 0xFFCBD330, 0xF8000A20,
+0x25200119, 0x30D4DD21, 0x33F000A3, 0x00290400, 0xD0000124, 0x00040058, 0x0007DC00, 0xEC002464,
+0x0B800024, 0x0011EC00, 0xD8401034, 0x7CFFBDCB, 0x1F680004, 0x0035C400, 0xD2310004, 0xD4ACB9C7,
+0xBECDD4C0, 0xBDCCD3FF, 0xC0CDD5FF, 0x000F74FF, 0x84001284, 0xD1E19000, 0xCDDFFFCA, 0x28DCFFC6,
+0xC8CE213B, 0xAC005DA8, 0x3D48007C, 0x00569400, 0xA80057E0, 0x33800034, 0x0106F000, 0x78015A28,
+0xA4940277, 0x000A8400, 0x780000C8, 0xA990006D, 0x000F2000, 0x340024B0, 0x1E94000C, 0x0000A800,
+0xA9B17608, 0xBBFFAAA8, 0xD5FFBCBA, 0x72F4C8CC, 0x000A7800, 0xFC0018DC, 0xD4CC108B, 0xBF0FF14F,
+0xBBC6FFB7, 0x1A0FFFB3, 0x2F24FF1E, 0x2419FF33, 0x362AFF28, 0x2B1EFF38, 0x2A1DFF2D, 0xF00EB42C,
+0x22231329, 0x2B2C1AFF, 0x20210FFF, 0x272818FF, 0x212315FF, 0x232518FF, 0x1B1D12FF, 0x11120AFF,
+0x0F0E09FF, 0x100D08FF, 0x342F2BFF, 0x35302AFF, 0x28231DFF, 0x27231AFF, 0x4009D4FF, 0xFF2A261B,
+0x68F10F2C, 0xFF221E13, 0xFF2A2418, 0xFF2D271B, 0xFF393126, 0xFF392F25, 0xFF32281E, 0xFF3F3229,
+0xFF483B32, 0xFF4A4235, 0xFF343122, 0xFF272415, 0xFF21200E, 0xFF2A2819, 0xFF282617, 0xFF323023,
+0xFF363227, 0xFF352E26, 0xFF2F261F, 0xFF322721, 0xFF55473E, 0xFF534336, 0xFF513E2F, 0xFF6B5643,
+0xFF61503E, 0xFF392D1F, 0xFF423C2C, 0xFF363820, 0xFF2C2F14, 0xFF2E3018, 0x702D2C18, 0x1658F10A,
+0x21FF2822, 0x29FF352F, 0x31FF433C, 0x39FF564C, 0x38FF6456, 0x2DFF6657, 0x3FFF5A49, 0x2AFF6556,
+0x39FF493E, 0x43FF5751, 0x2AFF635D, 0x17FF5044, 0x40FF4030, 0x45FF6A55, 0x2BFF6956, 0x2CFF4A3A,
+0x33FF4438, 0x2EFF463E, 0x3CFF403A, 0x33FF504A, 0x34FF443D, 0x71FF3D38, 0xB9FF7470, 0xB9FFB1AE,
+0xE2FFAEAC, 0x5320D6D6, 0xB8BDC031, 0xED3165A0, 0x31E4CED2, 0xF145D000, 0x262B4108, 0x262743FF,
+0x1B1D36FF, 0x1B1E2FFF, 0x0F1221FF, 0x27293EFF, 0x14F145EC, 0xFF272B46, 0xFF20243D, 0xFF303247,
+0xFF282B3C, 0xFF101221, 0xFF181A26, 0xFF15181F, 0xFF090C11, 0xFC0D0E12, 0x0F147109, 0x0B10FF0E,
+0xF10F100A, 0x27252830, 0x4F4B48FF, 0x625B53FF, 0x564E41FF, 0x4C4332FF, 0x49412EFF, 0x645D4AFF,
+0x534C39FF, 0x6B654FFF, 0x59543EFF, 0x635E48FF, 0x57503EFF, 0x777060FF, 0x615847FF, 0x584F3EFF,
+0x534A3BFF, 0x09F00014, 0xFF494431, 0xFF706D5A, 0xFF716E5D, 0xFF979888, 0xFF65695B, 0xFF9DA095,
+0x34F144B4, 0xFF96938E, 0xFF898480, 0xFFA7A09A, 0xFF9F9890, 0xFFA39A91, 0xFF766F65, 0xFF928B83,
+0xFF8D8582, 0xFFC6BEBB, 0xFFADA5A2, 0xFFCAC3BB, 0xFFA9A397, 0xFFA29C90, 0xFF767269, 0xFF928F86,
+0xFFADAB9E, 0x4C767465, 0x3E18F10B, 0x46FF4D4B, 0x3AFF5551, 0x3DFF4945, 0x52FF4A46, 0x8CFF5E5B,
+0x7EFF9895, 0xB1FF8888, 0x83FFB8B9, 0x90FF8489, 0x8B648C92, 0xE4EDF480, 0xDDE6EFFF, 0x009404FF,
+0xF51031A8, 0xE9228588, 0x104134E4, 0x216278E1, 0x5DE8FFE3, 0xFFE7E861, 0x7CE8EAE9, 0x7B900085,
+0xD7D44CF1, 0xCCC9FFD5, 0xD6D7FFCA, 0xA5A6FFD8, 0x423FFFA9, 0x6760FF46, 0x8C83FF6A, 0x8A81FF90,
+0x8781FF8E, 0x5A54FF8E, 0x908DFF61, 0x8B87FF98, 0x7B76FF90, 0x9B97FF7E, 0xABABFF9C, 0xBFC1FFAB,
+0xCDD5FFBE, 0xC9CEFFCD, 0x8781FFCA, 0x5246FF8C, 0x4133FF58, 0x3B2BFF47, 0x4639FF42, 0x40015C4E,
+0xFF5D5548, 0x16F00004, 0xFF5C5646, 0xFF777163, 0xFFA29E93, 0xFF908B85, 0xFF87827E, 0xFF9B948E,
+0xFF635C52, 0xFF585449, 0xFFD5D6D0, 0xF09034EC, 0xFFEBEB8A, 0xFFB4B4BE, 0xFF9B9CA0, 0xFFA2A4A3,
+0xFF93968F, 0xFF828276, 0xFFA8A390, 0xFFA19678, 0xFFA3915F, 0xFFB69955, 0xFFC09843, 0xFFDFA051,
+0xFFA2410E, 0xFFA84A14, 0xFF8A5B03, 0xFFD3B753, 0xFFEACD6F, 0xFFCAB161, 0xFFBEB17A, 0xFF59512D,
+0xFF645947, 0xFF6B5E56, 0xFF766963, 0xFF8C837C, 0xFF97978B, 0xFFA9AC9B, 0xFF8A8776, 0xFFA9A693,
+0xFF787A65, 0xFFB0AF9B, 0xFF857E6C, 0xFFCCC3B4, 0xFFA3998F, 0xFFB9B2AA, 0xFFD7D6D2, 0xFFCDCFCC,
+0xFFC1C2BD, 0xFFC7C9C6, 0x99A4D1D6, 0x49B4D611, 0x0090A400, 0xF2103818, 0xE2211D80, 0x0044D4D8,
+0x240039F4, 0x1C78040B, 0x00808C00, 0x38001920, 0x3A280012, 0x11150C00, 0x021DE8DB, 0x18000BFC,
+0x90D41021, 0xB8C81230, 0x28480015, 0x00377C00, 0x98000004, 0x00040020, 0x001B1000, 0x04000018,
+0x2DB00000, 0xB0BDCE31, 0x74004A58, 0x957C0018, 0x001A6C00, 0x78000AB8, 0x14040024, 0xD2D6D544,
+0x0055D4FF, 0xD4003990, 0x0C7C0012, 0x1135D002, 0x000540C7, 0x44001968, 0x90C80005, 0x4095CC00,
+0xFFC7CEE0, 0x1C00501C, 0xD628F12F, 0xD3FFBFCD, 0xD5FFB5C7, 0xCBFFB9CB, 0xC5FFB2C3, 0xAFFFB4BF,
+0xA1FFAAAE, 0xBBFF9CA0, 0xC3FFA8B2, 0xC6FFA8B6, 0xC4FFABB9, 0xC4FFA9B7, 0xC0FFA5B5, 0xCEFFA1B1,
+0xB394B1C1, 0x18140935, 0x01F00500, 0xFF2B291D, 0xFF272518, 0xFF29271A, 0xFF292718, 0x22F00500,
+0xFF222311, 0xFF2C2D1B, 0xFF242515, 0xFF2B2D1F, 0xFF17170B, 0xFF0E1005, 0xFF1B1C16, 0xFF151610,
+0xFF0F0E0A, 0xFF2A2925, 0xFF171611, 0xFF15140F, 0xF0047C27, 0xFF212100, 0xFF191911, 0xFF1A170E,
+0xFF1C1A0E, 0x18F10064, 0xFF322C20, 0xFF2F271A, 0xFF2E2418, 0xFF322618, 0xFF514134, 0xFF3E3023,
+0xFF3C3226, 0xFF342E20, 0xFF272113, 0x80312D21, 0x0C04F10A, 0x14FF1A18, 0x38FF231F, 0x29FF4743,
+0x1BFF3831, 0x05382D24, 0x3D3079F0, 0x3B2BFF4B, 0x4E3DFF4C, 0x4E39FF61, 0x3D29FF63, 0x3525FF4E,
+0x3724FF41, 0x3820FF3C, 0x2E12FF38, 0x442AFF2E, 0x3621FF44, 0x1A0BFF37, 0x190DFF1D, 0x2619FF1F,
+0x4532FF2E, 0x5034FF4D, 0x4525FF5B, 0x4827FF52, 0x4325FF58, 0x4A31FF54, 0x4E39FF5A, 0x3D28FF5D,
+0x4D38FF45, 0x3D28FF55, 0x2D18FF4C, 0x412FFF42, 0x4B3BFF58, 0x4E40FF62, 0x3225FF60, 0x3728FF40,
+0x3121FF40, 0x3422FF38, 0x2B1BFF3B, 0x2920FF32, 0x1A34FF32, 0x393D14F1, 0x3A41FF3E, 0x7F84FF3D,
+0x9999FF80, 0x5049FF99, 0x8182FF4D, 0x89A0FF7D, 0x2A49FF87, 0x2D46FF27, 0x502CE829, 0xFF252644,
+0xF109FC38, 0xFF181B13, 0xFF0D101F, 0xFF20253B, 0xFF353956, 0xFF3A3D5C, 0xFF323653, 0xFF1E2037,
+0xFF0F1223, 0x00242635, 0x1DE1F00A, 0x14FF1316, 0x15FF0C0F, 0x13FF0F10, 0x0EFF0D0E, 0x11FF0809,
+0x0DFF0C0B, 0x29FF0A08, 0x61FF2C28, 0x49FF6E67, 0x37FF5C54, 0x34FF5449, 0x29FF564A, 0x2AFF4B3F,
+0x18FF4E42, 0x2EFF3E32, 0x2EFF544B, 0x38FF564D, 0x33FF5E55, 0x41FF574B, 0x3EFF6357, 0x32FF6253,
+0x3BFF5849, 0x44FF6355, 0x41FF6A5E, 0x2BFF675E, 0x1AFF4E47, 0x26FF3A34, 0x31FF433F, 0x35FF4949,
+0x49FF4B4A, 0x20FF5F5C, 0x36FF3630, 0x39FF4E45, 0x2DFF5549, 0x29FF4B3E, 0x46FF473A, 0x4AFF6356,
+0x3DFF6557, 0x3CFF5549, 0x3EFF5245, 0x40FF564A, 0x4AFF5A4E, 0x44FF685B, 0x45FF6358, 0x3FFF6058,
+0x63FF5A52, 0x40FF7D76, 0x30FF5C56, 0x36FF4E48, 0x25FF544E, 0x3BFF443C, 0x29FF5850, 0x3FFF463E,
+0x40FF5C54, 0x2EFF5A53, 0x28FF4641, 0x41FF3A37, 0x41FF4D4D, 0xB9FF4647, 0x5CFFBABC, 0xF8D9100A,
+0xDC1BF161, 0xCDCFFFDB, 0xD0D2FFCC, 0xB8B8FFD0, 0x9C9DFFB8, 0x918FFF9E, 0x7A77FF92, 0x615CFF7E,
+0x6861FF64, 0x8C85FF6B, 0x8A81FF8F, 0xF105708D, 0x645825FF, 0x4E43FF66, 0x5851FF52, 0x5A51FF61,
+0x584CFF64, 0x5645FF62, 0x5949FF5F, 0x5240FF65, 0x4E41FF5D, 0x483BFF5C, 0x4236FF56, 0x5145FF4E,
+0x6051FF5B, 0x5749FF69, 0x392FFF5D, 0x544BFF40, 0x706DFF58, 0x7F79FF74, 0x4C3BFF84, 0x442EFF55,
+0x3F26FF4F, 0x331BFF49, 0x5139FF3F, 0x533CFF5D, 0x462EFF62, 0x5339FF52, 0x5437FF5F, 0x4B30FF5D,
+0x4A36FF55, 0x5646FF55, 0x5648FF62, 0x4F3FFF62, 0x4D37FF5B, 0x4633FF59, 0xD3CAFF4D, 0xF9F9FFD0,
+0xEEFAFFF3, 0xB2BDFFEE, 0x5859FFB5, 0x6A63FF61, 0x6959FF73, 0x5842FF70, 0x7F65FF5E, 0x6D52FF86,
+0x6347FF77, 0x5D38FF6E, 0x5E27FF73, 0x3100FF89, 0x1F02FF7A, 0x3D1DFF92, 0x783AFFA8, 0x8132FFA8,
+0x7B2BFF96, 0x7521FF98, 0xBA61FF91, 0x6E26FFCE, 0x5F3DFF7F, 0x6355FF6F, 0x574CFF75, 0x5C50FF65,
+0x6350FF66, 0x5C47FF66, 0x634AFF5D, 0x5C41FF67, 0x5E41FF60, 0x6143FF62, 0x7357FF66, 0x6D52FF7E,
+0x614AFF7B, 0x604CFF70, 0x8C7DFF6B, 0x7669FF95, 0x6454FF7E, 0x8D81FF70, 0xB3ABFF99, 0xD3D0FFBA,
+0xD2D2FFD7, 0x00063CD2, 0xE9408C88, 0x24FFEBEB, 0x676C0111, 0xFFD7DD30, 0x04002170, 0x0F2C0005,
+0x00050000, 0xE4001008, 0x10900138, 0xFFD1DE30, 0x5400155C, 0x7C28002A, 0x00350400, 0x3C0439F8,
+0x3BDC004B, 0x003BCC00, 0x02F03BEC, 0xFFBBCADF, 0xFFB8C7DC, 0xFFB7C6DB, 0xFFBDC9DF, 0x21A478E3,
+0x26D0C2CD, 0x0026B400, 0x40007C1C, 0x0A74000F, 0x003E4800, 0xA8000B7C, 0xCFD27149, 0xDEE1FFCA,
+0x0068A0D9, 0xB0004878, 0x3E60003F, 0x00140000, 0x78001AA8, 0x0EE8012F, 0xC3CC00F0, 0xC0C7D9FF,
+0xC2C7DAFF, 0xC6CBDEFF, 0x004204FF, 0xCD711AB4, 0xD3FFB6C4, 0x0500B7C9, 0xD0D800F1, 0xCCD2FFBF,
+0xBABBFFBF, 0xAAABFFB6, 0x00A4E0A6, 0xB8000AB0, 0x166000B8, 0x01BD8C00, 0xCE302AD8, 0x2C44FFBC,
+0x282117B1, 0x393228FF, 0x2C251BFF, 0xFC000474, 0x00040013, 0x2E2B1C31, 0x1571098C, 0x16FF2827,
+0x09942928, 0x1B1C0EB1, 0x1F1D11FF, 0x121208FF, 0x01F009FC, 0xFF14150F, 0xFF1B1C17, 0xFF161712,
+0xFF1F201B, 0x00F10010, 0xFF191C15, 0xFF21241B, 0xFF13140C, 0x3015170C, 0x22164005, 0x0500FF24,
+0x231620F1, 0x291AFF2B, 0x3121FF32, 0x3F30FF3D, 0x3323FF4F, 0x4F43FF40, 0x2F24FF59, 0x281FFF37,
+0x1E16FF31, 0x231FFF25, 0x1D19FF28, 0x120DFF22, 0xF10A5015, 0x2E2A2114, 0x363024FF, 0x40382BFF,
+0x524938FF, 0x443925FF, 0x4C402AFF, 0x4E3F28FF, 0x443724FF, 0x3D3528FF, 0x00F10F40, 0xFF2F2C19,
+0xFF38361F, 0xFF35341F, 0xA42E2D1B, 0x19A40014, 0x382E2571, 0x483C2EFF, 0x2CF10424, 0xFF4C3E23,
+0xFF423417, 0xFF45371C, 0xFF5B4A36, 0xFF49392A, 0xFF3A3122, 0xFF3D3425, 0xFF372718, 0xFF463022,
+0xFF5E4739, 0xFF574032, 0xFF544035, 0xFF403023, 0xFF362A1A, 0x283A321F, 0x2D28F105, 0x28FF4740,
+0x25FF3F38, 0x2DFF3731, 0x2EFF3532, 0x5DFF3332, 0x4CFF6764, 0x4DFF5A58, 0x6BFF5E5F, 0xB1FF7273,
+0x43FFA2A4, 0x47FF2A2C, 0x3CFF2E33, 0x42FF2328, 0x36E02327, 0x2127F001, 0x05000E11, 0x3A3E5B31,
+0x42310A24, 0x4AF42023, 0x002D1400, 0x05F01400, 0xFF141622, 0xFF11141D, 0xFF0D1017, 0xFF0C0F16,
+0xFF090C13, 0x24F14B00, 0xFF0A0911, 0xFF0B090E, 0xFF352F2F, 0xFF554C45, 0xFF574E3F, 0xFF5D503D,
+0xFF594A35, 0xFF584838, 0xFF4D3D2D, 0xFF71624D, 0xFF5E523A, 0xFF40341C, 0xE45B4F37, 0x3C84F10F,
+0x38FF5E4F, 0x37FF5B4A, 0x44FF5C4B, 0x44FF6D5D, 0x44FF6E5E, 0x37FF6C5E, 0x2DFF5D51, 0x15FF5046,
+0x17FF362F, 0x3AFF3A35, 0x3AFF605A, 0x40FF5F55, 0x3BFF6458, 0x3DFF6152, 0x34FF6454, 0x2FFF5D4D,
+0x3CFF5646, 0x41FF6051, 0x34FF6354, 0x2DFF5144, 0x35FF483A, 0x4CFF5245, 0x42FF6A5D, 0x2DFF665A,
+0x36FF5347, 0x37FF594F, 0x33FF5A50, 0x27FF5247, 0x3FFF463B, 0x45FF5E53, 0x43FF665B, 0x32FF695D,
+0x33FF584C, 0x3EFF594D, 0x2FFF6256, 0x38FF4C41, 0x02084F48, 0x382D3CF1, 0x4239FF3C, 0x4941FF45,
+0x5F56FF49, 0x4B42FF62, 0x574EFF4E, 0x362BFF5B, 0x4539FF3A, 0x3B2DFF4B, 0x4336FF41, 0x4738FF4B,
+0x4D3DFF50, 0x5341FF59, 0x4B37FF5E, 0x301CFF56, 0x3922FF3B, 0x5039FF41, 0x5A40FF58, 0x4D37FF61,
+0xF1010858, 0x5C4D3A0C, 0x564730FF, 0x64563CFF, 0x68583FFF, 0x675740FF, 0x645341FF, 0x6C5B4BFF,
+0x1CF10120, 0xFF594C39, 0xFF655943, 0xFF554E34, 0xFF4F4730, 0xFF615B45, 0xFF5A5541, 0xFF6D6854,
+0xFF5F5941, 0xFF5D563C, 0xFF585135, 0x085B5136, 0x1A08F10C, 0x20FF4034, 0x3FFF473C, 0x40FF6A5F,
+0x3EFF6D63, 0x38FF695E, 0x00445E52, 0xF1111C00, 0x51422D8C, 0x695A3DFF, 0x5E573BFF, 0xCED6C7FF,
+0xECF7F3FF, 0xEEEEF8FF, 0xB7B0B8FF, 0x63524BFF, 0x6B5945FF, 0x6E5F42FF, 0x8E815EFF, 0x877A57FF,
+0x5C5430FF, 0x464227FF, 0x5B472EFF, 0x874E30FF, 0x812609FF, 0x9C1F0BFF, 0xA93C27FF, 0x7D532DFF,
+0x766A3AFF, 0x6C5521FF, 0x8F7626FF, 0xF4DF60FF, 0xA99620FF, 0x5E4E1DFF, 0x615547FF, 0x5C5543FF,
+0x514F3AFF, 0x6B6652FF, 0x5E5C47FF, 0x4A4C36FF, 0x4B4B33FF, 0x585335FF, 0x564D2CFF, 0x665D3EFF,
+0x514628FF, 0x4E4327FF, 0x61553BFF, 0x18F101E0, 0xFF79684E, 0xFF806749, 0xFF7A5F42, 0xFF735D45,
+0xFF84745D, 0xFF746756, 0xFFAEA191, 0xFFA69686, 0xFFAB9F91, 0x4CD5D6D1, 0x68E61310, 0x0EF400AD,
+0x003D6800, 0x1C000E50, 0x27DC0224, 0x8604C611, 0x0013D800, 0x440013E8, 0x32300120, 0x3414D312,
+0xECD5E420, 0xFFD32031, 0xF8001E8C, 0x4EF4001E, 0x402BC400, 0xFFCDD6E7, 0xA000001C, 0x24880026,
+0x0009BC00, 0x70000EA4, 0x0A580010, 0x21216801, 0x1238CFD6, 0x50779800, 0xFFB2B8C4, 0x214A30D3,
+0x0EACC5CB, 0x000A1C00, 0x7000174C, 0x33240050, 0x0013E800, 0xCC0004BC, 0x55A4002A, 0x200F4400,
+0xB374D2E2, 0xDBFFCE51, 0x33B8CCD0, 0x0005B000, 0x94001B20, 0x272C002D, 0xC2C2C271, 0xA5A5A7FF,
+0x24006E2C, 0x1A240005, 0x000F8000, 0x6C000548, 0x0FBC0034, 0x00005800, 0x00F10474, 0xFF322B23,
+0xFF2B241C, 0xFF272018, 0x14201C11, 0x2B1F710F, 0x1F13FF2F, 0xF0050423, 0x312F2031, 0x151306FF,
+0x2A281BFF, 0x1D1A11FF, 0x14110AFF, 0x100F0AFF, 0x11100BFF, 0x272622FF, 0x141510FF, 0x181914FF,
+0x13140FFF, 0x0E110AFF, 0x161912FF, 0x181B12FF, 0x16170FFF, 0x1D1D13FF, 0x000500FF, 0x01F009DC,
+0xFF342E22, 0xFF41372B, 0xFF4A3E30, 0xFF433528, 0x2AF009D0, 0xFF42382E, 0xFF30271E, 0xFF28211B,
+0xFF2C2421, 0xFF231D1D, 0xFF1E1A19, 0xFF110D0C, 0xFF23201B, 0xFF2B271E, 0xFF2D291D, 0xFF433D2D,
+0xFF4F4A36, 0xFF423C26, 0xFF544C35, 0x21037031, 0x14704439, 0x3B372B31, 0x1731196C, 0x0EFC302B,
+0x31144800, 0x8C252317, 0x2905F00F, 0x2BFF3C32, 0x2BFF4638, 0x1FFF4F40, 0x2AFF4739, 0xE0FF5146,
+0x2750F102, 0x19FF4837, 0x30FF3626, 0x24FF463C, 0x48FF3A30, 0x2AFF6555, 0x33FF4B38, 0x42FF573F,
+0x25FF6750, 0x22FF4633, 0x22FF4131, 0x2AFF3F34, 0x21FF453D, 0x2EFF3E36, 0x2CFF4841, 0x26FF453E,
+0x08FF3A34, 0x39FF1614, 0x50FF4745, 0x42FF605C, 0x3FFF5653, 0x43FF5757, 0x79FF5051, 0x4EFF6F6F,
+0x0EE83839, 0xF1140400, 0x21253E04, 0x22273BFF, 0x191D29FF, 0x131723FF, 0x282D43FF, 0x51310A00,
+0x3C102F32, 0x27294271, 0x1A1D30FF, 0x25311420, 0x281C1719, 0x0A0D1681, 0x080B14FF, 0x210010FF,
+0x230C1111, 0xF00A0000, 0x2E292606, 0x5C534AFF, 0x504436FF, 0x564734FF, 0x544532FF, 0x04A437FF,
+0x5B4B4BF1, 0x504332FF, 0x473A27FF, 0x3F301DFF, 0x675843FF, 0x493824FF, 0x4C3B27FF, 0x574531FF,
+0x5B4935FF, 0x67553DFF, 0x635339FF, 0x5C4E34FF, 0x52462CFF, 0x5F553CFF, 0x443D21FF, 0x504728FF,
+0x5C5334FF, 0x53482CFF, 0x695B41FF, 0x524229FF, 0x423219FF, 0x5B4B32FF, 0x605037FF, 0x30F1090C,
+0xFF483924, 0xFF493C2B, 0xFF4B3F2F, 0xFF605543, 0xFF625741, 0xFF5B5235, 0xFF665B3D, 0xFF766B4D,
+0xFF4C4125, 0xFF4B3F27, 0xFF413620, 0xFF534633, 0xFF6C604A, 0xFF574B31, 0xFF4D4226, 0x4C5E5337,
+0x04C00009, 0x42392A31, 0x26311B10, 0x116C3632, 0x001AF400, 0x37711B60, 0x29FF4D47, 0x0E804039,
+0x3A2924F1, 0x3926FF43, 0x3827FF41, 0x3E2BFF45, 0x543FFF4B, 0x4C35FF63, 0x5339FF5B, 0x4429FF61,
+0x4B2FFF52, 0x4D2FFF56, 0x5638FF58, 0x593DFF61, 0x442DFF64, 0xF004FC53, 0x63553A09, 0x5B4D30FF,
+0x5B4C2FFF, 0x79694FFF, 0x6C5B47FF, 0x645542FF, 0xF00604FF, 0x5347315F, 0x5F5639FF, 0x635D3DFF,
+0x645D40FF, 0x555033FF, 0x69654CFF, 0x68634DFF, 0x423C24FF, 0x504A30FF, 0x615A3EFF, 0x635C40FF,
+0x453B22FF, 0x5C5237FF, 0x605539FF, 0x5A5130FF, 0x726A45FF, 0x615935FF, 0x584F32FF, 0x4E432DFF,
+0x514431FF, 0x4D3E29FF, 0x7F7051FF, 0x5A5538FF, 0xC8D0C1FF, 0xEFF9F8FF, 0xF4F4FEFF, 0xB6ACB4FF,
+0x044B41FF, 0x5A87F00B, 0x776745FF, 0x807349FF, 0x75693FFF, 0x635B36FF, 0x444229FF, 0x5D4732FF,
+0x863A2AFF, 0x972918FF, 0xAA281AFF, 0xA43D2CFF, 0x75513BFF, 0x655F3FFF, 0x6E592AFF, 0x795E0DFF,
+0xE6CA43FF, 0xEFD75BFF, 0x3D2B00FF, 0x554C3DFF, 0x4F4D38FF, 0x54543CFF, 0x5F5A44FF, 0x56513DFF,
+0x4D4F3AFF, 0x414129FF, 0x544B2CFF, 0x6F6240FF, 0x5D5234FF, 0x433A1DFF, 0x3D3415FF, 0x574C2EFF,
+0x59482AFF, 0x6C5535FF, 0x7D5D37FF, 0x82603AFF, 0x7B5F3AFF, 0x5A4321FF, 0x6F5C3EFF, 0xF10518FF,
+0x7E6A5100, 0x726350FF, 0x8C8A7EFF, 0xC5CBC9FF, 0xE0006308, 0x27D80013, 0x005ABC00, 0x1C01341C,
+0xC4D22155, 0x3800B2D4, 0x3DAC002F, 0x01098C00, 0xCF213F58, 0x801E88C8, 0xFFBDC1CA, 0xFF8B9096,
+0xB93155F4, 0x2338B1B6, 0x311F6800, 0x44C5CCD4, 0x41D0007B, 0x00424800, 0xD0313D70, 0xA990BEC7,
+0xC7D0D760, 0x0CCCD2FF, 0x34CD1154, 0x6D9C0099, 0x00483C00, 0x48004ED8, 0x388C0048, 0xB2BBC431,
+0xD6318030, 0x4F04C4CD, 0x001F7C00, 0x6C001978, 0x00040053, 0x94C8D320, 0xC40BF024, 0xCACCD9FF,
+0xC5C3CEFF, 0xD6D4D9FF, 0xD7D5D8FF, 0xD2D5DCFF, 0xCCD1D7FF, 0xF1194CFF, 0xC5C9CA0C, 0xBDB8B4FF,
+0x9A9591FF, 0xD0D1D3FF, 0xC9CED2FF, 0xCED1D8FF, 0xD1D4DBFF, 0x04005934, 0x80980016, 0xC5CC00F1,
+0x1E18FFBC, 0x2923FF23, 0x1913FF2E, 0x00000C1E, 0x1CF113C4, 0xFF1B1610, 0xFF2A261D, 0xFF302C23,
+0xFF312D22, 0xFF2D291E, 0xFF19170B, 0xFF26231A, 0xFF25221B, 0xFF120F0A, 0xFF130F0C, 0x9C0C0805,
+0x09B00018, 0x14110CB1, 0x1E1B16FF, 0x1A1914FF, 0x00F10518, 0xFF0D0C07, 0xFF1C1C14, 0xFF1E1E16,
+0xC82D2A21, 0x1E240004, 0x443A3131, 0x1B7113FC, 0x37FF3124, 0x23644B41, 0xF00EEC00, 0x29241E02,
+0x24211CFF, 0x130F0EFF, 0x24201FFF, 0x005C07FF, 0x682E2B21, 0x2348001E, 0x38332071, 0x403B25FF,
+0x3DF00D60, 0xFF534B34, 0xFF30250F, 0xFF3F3724, 0xFF2F291D, 0xFF3A3428, 0xFF3A3323, 0xFF302917,
+0xFF292615, 0xFF343223, 0xFF2E2C20, 0xFF3B342A, 0xFF4D4037, 0xFF5A4A3D, 0xFF50412C, 0xFF51452D,
+0xFF3A3015, 0xFF3B301A, 0xFF2F1F10, 0xFF332518, 0x4DF00394, 0xFF504736, 0xFF574A39, 0xFF473624,
+0xFF584332, 0xFF65503F, 0xFF3B2817, 0xFF3D2E1B, 0xFF514634, 0xFF443C29, 0xFF413A28, 0xFF342D1B,
+0xFF393222, 0xFF3C3628, 0xFF4A4738, 0xFF423F30, 0xFF40382D, 0xFF585141, 0xFF55503A, 0xFF2F2D20,
+0xFF32303B, 0xFF42425A, 0xFF292B44, 0xFF252740, 0x10F10500, 0xFF171C2F, 0xFF1B222C, 0xFF0C131D,
+0xFF23283B, 0xFF3E425B, 0xFF2B2F4A, 0xFF262A45, 0x1423253C, 0x22FC0037, 0x131522B1, 0x10121EFF,
+0x050713FF, 0x08F15F00, 0xFF1C1E2B, 0xFF10101C, 0xFF090810, 0xFF100E11, 0xFF1E1916, 0x80574E45,
+0x301F310E, 0x0004F03D, 0x2D2019C8, 0xA012BC3E, 0x3C2AFF47, 0x2110FF47, 0x0910FF2E, 0x8F7F6631,
+0x37F009F0, 0xFF4F3D25, 0xFF5C4A32, 0xFF69593F, 0xFF504026, 0xFF54482E, 0xFF544A2F, 0xFF534E30,
+0xFF575234, 0xFF443D23, 0xFF4A3F2B, 0xFF423524, 0xFF594939, 0xFF4B3B2B, 0xFF433421, 0xFF4E3F2A,
+0xFF524630, 0xFF5B503A, 0x05704531, 0x30FF4F80, 0x34FF4B43, 0xF1086C49, 0x2BFF4A0A, 0x3CFF534D,
+0x61FF6961, 0x1DFF8E86, 0x33FF4941, 0x1AFF5B52, 0x09943D36, 0x6C614D71, 0x473C28FF, 0x08F106A4,
+0xFF5C513B, 0xFF4D452E, 0xFF4C4431, 0xFF352E1C, 0xFF474131, 0xA4494637, 0x0130001A, 0x242014D0,
+0x403A2CFF, 0x332B1EFF, 0x25701FFF, 0xFF3B32E1, 0xFF382F1E, 0xFF372A1A, 0xC03F3221, 0x0FC40104,
+0x564703F1, 0x4D3E27FF, 0x53472FFF, 0x463A20FF, 0x62563CFF, 0x00F10A58, 0xFF483C2C, 0xFF4E4232,
+0xFF6D624C, 0xB063593E, 0x2A00F10E, 0x30FF4F45, 0x50FF5349, 0x2BFF7166, 0x0A2C4C41, 0x60421CF1,
+0x5738FF65, 0x3D20FF5A, 0x3F26FF41, 0x634FFF41, 0x4A39FF64, 0x3B27FF4D, 0x3923FF40, 0x543AFF3E,
+0x5339FF5A, 0x4831FF5A, 0x000A6050, 0x18F10620, 0xFF6B6447, 0xFF58542F, 0xFF5E5A37, 0xFF605A42,
+0xFF48412F, 0xFF32281C, 0xFF534A39, 0xFF685E43, 0xFF47432A, 0x00CDD0C7, 0xF44BF064, 0xBBFFEAE6,
+0x3AFFBAB3, 0x2BFF4A41, 0x3BFF4A42, 0x48FF655C, 0x3AFF776F, 0x39FF6961, 0x37FF615B, 0x2DFF5250,
+0x2BFF6140, 0x18FF9D3C, 0x24FFA829, 0x38FFB336, 0x2EFFA649, 0x24FF5D3D, 0x2FFF4C46, 0x17FF8774,
+0x28FF9275, 0x49FFB893, 0x16FFC4A2, 0x43FF4D39, 0x2AFF5850, 0xF106D03E, 0x33FF590A, 0x3BFF4F49,
+0x31FF5751, 0x0FFF4A45, 0x37FF2D27, 0x3EFF6655, 0x06D4725D, 0x3F331950, 0x26B00EFF, 0x4E4323F1,
+0x5E4E2DFF, 0x715A38FF, 0x7F623AFF, 0x85683EFF, 0x745D33FF, 0x55431BFF, 0x685A35FF, 0x716243FF,
+0x726147FF, 0x665946FF, 0x78786CFF, 0x9CA5A2FF, 0x48009364, 0x00040018, 0x0076B800, 0x2C000EEC,
+0x31B40055, 0x00C64C00, 0x100048F4, 0x2CB8000F, 0xF113A400, 0xE9E9E718, 0xC7C6C2FF, 0x827D7AFF,
+0x65625BFF, 0x5D5E4EFF, 0x575A47FF, 0x66685AFF, 0xA5A89FFF, 0xC6CBC5FF, 0xC8CCCDFF, 0xC4005FA4,
+0x63700013, 0x00000400, 0xA0001D94, 0xB124F15D, 0xECFFA7AF, 0xCCFFE4ED, 0xA1FFC6CF, 0x90FF9FA5,
+0xBDFF9196, 0x9FFFBEC3, 0x9BFF9EA3, 0x7FFF999F, 0x6CFF7E83, 0x6FFF6B70, 0x83FF7072, 0x89FF8284,
+0x8A18868A, 0xC9C94CF1, 0xBCBFFFC3, 0xB7BCFFB7, 0xA3A9FFB4, 0xABB2FFA4, 0xB1B6FFB0, 0x8D8AFFBA,
+0x7F77FF9B, 0x7774FF8C, 0x9B96FF7F, 0xBAB5FF9E, 0xABA2FFBB, 0x9183FFAF, 0x8D7DFF9D, 0xA89DFF99,
+0x9088FFAC, 0xD1CCFF90, 0x9A95FFD4, 0x8D89FF9D, 0xA4A0FF8E, 0x7371FFA5, 0x9792FF74, 0x2922FF96,
+0xF1186032, 0x1D140F00, 0x19100BFF, 0x150C07FF, 0x1E1510FF, 0x15310014, 0x099C251C, 0x120900F1,
+0x2B21FF1B, 0x140AFF32, 0x2C24FF1B, 0xF109AC33, 0x160E0B3C, 0x1B1310FF, 0x281D19FF, 0x271C18FF,
+0x120904FF, 0x1B120DFF, 0x18110BFF, 0x110C06FF, 0x140F09FF, 0x1D1812FF, 0x2D2822FF, 0x181109FF,
+0x2E2721FF, 0x433A33FF, 0x3C312BFF, 0x30231DFF, 0x2F2019FF, 0x473A32FF, 0x352F23FF, 0x2CF12850,
+0xFF2D2920, 0xFF2B2620, 0xFF1B1613, 0xFF1F1A17, 0xFF140F0C, 0xFF2A231D, 0xFF1E170D, 0xFF282212,
+0xFF48402D, 0xFF433B26, 0xFF493E28, 0xFF473C26, 0xFF3B2F19, 0xFF342917, 0x04352D20, 0x3C2D3105,
+0x310F5C45, 0x9C1F1909, 0x28B40004, 0x2A1E20F1, 0x4539FF30, 0x4333FF51, 0x3C29FF50, 0x3F29FF49,
+0x2A12FF4A, 0x2613FF30, 0x1E10FF2D, 0x3C30FF2A, 0x2D1EFF48, 0x3F2EFF36, 0x2C1CFF48, 0xF109F039,
+0x5E4B3C04, 0x554231FF, 0x382715FF, 0x5D4E3BFF, 0x433826FF, 0x29710524, 0x20FF3E36, 0x0A70332B,
+0x3D2F21F0, 0x2D1DFF43, 0x4232FF33, 0x392DFF49, 0x483AFF45, 0x3F29FF54, 0x2E22FF45, 0x3F4AFF32,
+0x2941FF42, 0x2544FF2B, 0x2947FF26, 0x233CFF28, 0x0500FF1F, 0xF059D000, 0x151C2601, 0x232939FF,
+0x373C52FF, 0x2D314CFF, 0x201904FF, 0x3C10283F, 0x6DF42111, 0x171926E0, 0x0A0C18FF, 0x090B18FF,
+0x242534FF, 0x1C72F137, 0x1B1B27FF, 0x0B0A12FF, 0x110F10FF, 0x17140FFF, 0x534D41FF, 0x52493AFF,
+0x473A2AFF, 0x493E2CFF, 0x4C4532FF, 0x453E2BFF, 0x58513EFF, 0x2F2714FF, 0x372C1AFF, 0x7C6D58FF,
+0xD0C1A4FF, 0x726241FF, 0x705F41FF, 0x8F7E62FF, 0x6C5B3DFF, 0x56482BFF, 0x4F4329FF, 0x4B4428FF,
+0x524D2DFF, 0x4B4829FF, 0x403A22FF, 0x423A27FF, 0x5D5141FF, 0x514535FF, 0x483B2AFF, 0x463926FF,
+0x4F4430FF, 0x534832FF, 0x34F10410, 0xFF423A25, 0xFF3E3724, 0xFF59533D, 0xFF413A20, 0xFF3F3919,
+0xFF6A623D, 0xFF6C643D, 0xFF615934, 0xFF554D29, 0xFF544E2C, 0xFF352E11, 0xFF484127, 0xFF706A52,
+0xFF4C442F, 0xFF4A442E, 0xFF4B432E, 0x2047412B, 0x3800F101, 0x3FFF534E, 0x25FF5552, 0x28FF3837,
+0x1FE03735, 0x353125B1, 0x464236FF, 0x292315FF, 0x2A311AAC, 0x1090413A, 0x2F2313B1, 0x584C3CFF,
+0x625544FF, 0x18F103B0, 0xFF4A3D2A, 0xFF4A3E28, 0xFF342913, 0xFF3B3118, 0xFF60563D, 0xFF544933,
+0xFF514537, 0xFF382F20, 0xFF4D422E, 0xE0655B40, 0x5A3FB114, 0x422CFF64, 0x634EFF4D, 0x0010B86B,
+0x18F109E4, 0xFF5B5638, 0xFF514E2F, 0xFF484729, 0xFF4F4D36, 0xFF373624, 0xFF434132, 0xFF322F1C,
+0xFF3F3A24, 0xFF5A563D, 0xE44B452D, 0x0154000B, 0x5C4408F1, 0x5538FF62, 0x5532FF59, 0x5533FF58,
+0x3B24FF55, 0x2011FF3D, 0x711BDC23, 0xFF5B5549, 0x14666249, 0xBB67F000, 0xF9FFC1C4, 0xFFFFF4F5,
+0xB9FFF7F3, 0x2DFFB6AE, 0x2CFF3833, 0x44FF4341, 0x37FF6A67, 0x37FF6260, 0x29FF615D, 0x3DFF504C,
+0x14FF5F5A, 0x2AFF4E2A, 0x3EFF9F39, 0x3DFFCA4C, 0x1AFFBA4F, 0x39FF782D, 0x0EFF644A, 0x3AFF413A,
+0x27FFAE9C, 0x19FFB398, 0x1BFF9875, 0x28FF7A5B, 0x30FF5445, 0x2DFF443E, 0x2AFF4241, 0x37FF3E40,
+0x2CFF504B, 0x32FF4842, 0x42FF4B46, 0xF10AFC59, 0x28FF6A36, 0x1CFF5743, 0x09FF4236, 0x2FFF2A23,
+0x46FF4F49, 0x43FF6863, 0x2FFF6A5F, 0x37FF5E4D, 0x3EFF6C58, 0x39FF7763, 0x31FF6F60, 0x3BFF6658,
+0x43FF6D61, 0x46FF7265, 0x3EFF6F61, 0x55FF5F54, 0xABFF6966, 0x7718B1B4, 0x006D5800, 0xDC716D0C,
+0xE1FFC9D6, 0xC1D4CBDA, 0x007C0C00, 0x880038E0, 0x2310000E, 0xF171EC00, 0xD1D1C70C, 0x878475FF,
+0x58513FFF, 0x534739FF, 0x564E3BFF, 0x504C31FF, 0x565537FF, 0x04F11648, 0xFF51503C, 0xFF7F8072,
+0xFF62635B, 0xFFA7A9A4, 0x30CDCFCE, 0xD020F17B, 0xD9FFCFD1, 0xB6FFD9D9, 0x9EFFBABB, 0x9FFFA6A6,
+0x71FFA9A9, 0x41FF7E7F, 0x50FF5051, 0x87FF615F, 0x56FF9697, 0x54FF6264, 0x55FF6062, 0x1B446465,
+0x443500F1, 0x4337FF47, 0x4C40FF47, 0x6356FF50, 0xF21A4C65, 0x6D6D6330, 0x625F58FF, 0x6D6864FF,
+0x756969FF, 0x645250FF, 0x6B554AFF, 0x6D574AFF, 0x68574DFF, 0x685B52FF, 0x6A6257FF, 0x6E6254FF,
+0x887861FF, 0x9E8E77FF, 0x5C5342FF, 0x5E5649FF, 0x7F7569FF, 0x50611624, 0x5A4FFF58, 0xF1084862,
+0x5F574C00, 0x594B40FF, 0x4E4035FF, 0x4A3C33FF, 0x38901D60, 0x3BFF4E3F, 0x34FF5142, 0x34A1186C,
+0x372CFF42, 0x3A2FFF45, 0x0011FC48, 0x20F1000C, 0xFF57493E, 0xFF493B32, 0xFF3F3128, 0xFF44352E,
+0xFF33201A, 0xFF3E2B27, 0xFF32201C, 0xFF2B1915, 0xFF3E2F2A, 0xFF1E110B, 0xFF1C0F09, 0xB81F140E,
+0x1710F11D, 0x0AFF2C1F, 0x46FF1D10, 0x2CFF5C4D, 0x1AFF4433, 0x0AFF3221, 0x21FF2310, 0x17FF3A29,
+0x23282D23, 0x31238400, 0x70292017, 0x101CF105, 0x13FF2319, 0x1EFF281B, 0x21FF3427, 0x22FF3A2C,
+0x35FF3F32, 0x14FF5645, 0x34FF3726, 0x22FF5A48, 0x26FF4836, 0x16FF4C3A, 0x0EC03928, 0x3E362B71,
+0x42382CFF, 0x00F10EC8, 0xFF271F12, 0xFF2B2517, 0xFF302A1C, 0xE4322A1D, 0x2D04F104, 0x2DFF493D,
+0x1EFF4A3F, 0x1CFF3931, 0x27FF3530, 0x12883D37, 0xF1052000, 0x32281F24, 0x392C24FF, 0x33241DFF,
+0x34231BFF, 0x503E34FF, 0x402E22FF, 0x473626FF, 0x554535FF, 0x493B2EFF, 0x3E342AFF, 0x201712FF,
+0x261E1BFF, 0x1C150FFF, 0x15712930, 0x13FF2F26, 0x0F5C3025, 0xF1053C00, 0x41392414, 0x565344FF,
+0x4B4851FF, 0x201E36FF, 0x313052FF, 0x1C1C3EFF, 0x1C203BFF, 0x1D2235FF, 0x131925FF, 0x37B13210,
+0x5CFF2124, 0x4EFF4345, 0x59FC3132, 0x292B4271, 0x1D2031FF, 0x00002CFC, 0x0D1B310A, 0x0072F80E,
+0x08F13C2C, 0xFF202231, 0xFF161622, 0xFF0C0D12, 0xFF070705, 0xFF2C2C24, 0x0C423E32, 0x2728F110,
+0x22FF3F36, 0x20FF3C33, 0x16FF3934, 0x68FF312C, 0x84FF847E, 0x29FFA199, 0x21FF483D, 0x7AFF493B,
+0x59FFAB9B, 0x87FF8F7D, 0x15FFBCA8, 0x28FF4934, 0x27FF5949, 0x0E405546, 0x4A2D00F1, 0x5734FF51,
+0x4C2AFF5A, 0x2E13FF4C, 0x7108C832, 0xFF49432D, 0xF0443E28, 0x3B217104, 0x3117FF42, 0x00052838,
+0x20F10E1C, 0xFF49432B, 0xFF3B331E, 0xFF524A33, 0xFF4C4227, 0xFF584D2D, 0xFF6A5E36, 0xFF5F532B,
+0xFF493F1C, 0xFF4B4223, 0xFF2B2503, 0xFF4A4424, 0x50423D1F, 0x1D00F124, 0x29FF3B35, 0x31FF4642,
+0x25FF4F49, 0x00044440, 0x99957A71, 0x4A4831FF, 0x28002554, 0x2119312F, 0xF1190C21, 0x494A3C00,
+0x2C2A1BFF, 0x403E2FFF, 0x3E3B2AFF, 0x7400065C, 0x3B28F11A, 0x37FF544D, 0x36FF5148, 0x31FF5149,
+0x1BFF4B44, 0x25FF3731, 0x1EFF413B, 0x3BFF3C36, 0x46FF5854, 0x34FF625C, 0x22FF5044, 0x1EFF4136,
+0x3FFF4438, 0x3BFF685D, 0x18B86459, 0xF113F400, 0x40332210, 0x392C1BFF, 0x2D220EFF, 0x5E5439FF,
+0x554E31FF, 0x544F32FF, 0x48422AFF, 0x45402DFF, 0x13101134, 0xA7F12A90, 0x35FF2F2D, 0x45FF504E,
+0x21FF605B, 0x30FF3934, 0x50FF4843, 0x31FF6967, 0x30FF4F50, 0x28FF5355, 0x20FF4549, 0x0EFF3337,
+0x1CFF191B, 0x49FF2122, 0x3CFF5353, 0x14FF5052, 0xB6FF292D, 0xF2FFBEC7, 0xFFFFF0F6, 0xBCFFF5F1,
+0x39FFB6B0, 0x32FF423D, 0x1DFF4847, 0x2AFF3E42, 0x35FF5056, 0x32FF5C5D, 0x3EFF5C58, 0x36FF6B61,
+0x19FF7651, 0x0BFF8024, 0x33FF7C14, 0x1BFF9043, 0x22FF6232, 0x00FF5140, 0x70FF433E, 0x29FFFFF5,
+0x03FFC9B3, 0x09FF7057, 0x3AFF4937, 0x42FF5951, 0x33FF5152, 0x27FF4648, 0x27FF3B3D, 0x31FF3D3C,
+0x30FF4746, 0x34FF4947, 0x2AFF504A, 0x06004B40, 0xF11AC400, 0x2A2A1200, 0x585A44FF, 0x656752FF,
+0x585542FF, 0x08F11A68, 0xFF443D2A, 0xFF3C341D, 0xFF534C30, 0xFF615839, 0xFF6F6542, 0x04685B39,
+0x1C0C0021, 0xF1103C00, 0x827B6808, 0xB7B5B6FF, 0xCFD2D9FF, 0x898F8FFF, 0x707978FF, 0xB6C0C2FF,
+0x6C00AF54, 0xDAEB313B, 0x0068FCD1, 0x20F155A0, 0xFFC5C6BE, 0xFF5D5B46, 0xFF534E31, 0xFF5B5032,
+0xFF5F4F35, 0xFF514328, 0xFF4C4528, 0xFF817C5E, 0xFF454126, 0xFF555138, 0xFF76715B, 0x5C46442F,
+0x412BF00B, 0x9AFF5552, 0xA1FFB0AA, 0x6AFFBAB3, 0x65FF867A, 0x50FF8578, 0x3CFF7564, 0x3EFF6654,
+0x3AFF6958, 0x38FF6353, 0x70FF594E, 0x64FF8A83, 0x42FF7F7A, 0x3EFF5D58, 0x2EFF5C56, 0xF10CB448,
+0x28FF565E, 0x35FF4E42, 0x36FF5B4F, 0x41FF5C50, 0x37FF625B, 0x35FF564E, 0x36FF524A, 0x45FF5649,
+0x42FF6754, 0x3DFF694F, 0x3EFF6A4A, 0x47FF6B4B, 0x48FF6D52, 0x47FF6753, 0x3AFF6454, 0x53FF5B4A,
+0x84FF816B, 0x45FFB29C, 0x46FF695A, 0x49FF6457, 0x48FF6A59, 0x44FF6958, 0x41FF6353, 0x45FF6050,
+0x46FF6351, 0x30FF6654, 0x3BFF513E, 0x00045A46, 0x564239C0, 0x58443BFF, 0x655148FF, 0xF0000CFF,
+0x503C310E, 0x614D42FF, 0x635042FF, 0x624F41FF, 0x655244FF, 0x6E5B4DFF, 0x685547FF, 0x002839FF,
+0x675317F1, 0x69524AFF, 0x715851FF, 0x68514BFF, 0x715A52FF, 0x665249FF, 0x6B594FFF, 0x6E5C52FF,
+0x6A584EFF, 0x645248FF, 0x20F10010, 0xFF68544B, 0xFF624E43, 0xFF563F37, 0xFF675146, 0xFF6C534C,
+0xFF5E483D, 0xFF615142, 0xFF534636, 0xFF5B4E3E, 0xFF514132, 0xFF6A584C, 0x984F3D31, 0x3D48F100,
+0x3AFF604A, 0x36FF5D47, 0x35FF5B44, 0x1BFF5A43, 0x29FF442A, 0x20FF543A, 0x30FF4D34, 0x29FF5D44,
+0x29FF513C, 0x29FF4838, 0x1EFF4234, 0x20FF392B, 0x16FF3B2D, 0x33FF3123, 0x0FFF4E40, 0x0AFF2A1C,
+0x4DFF271A, 0x28FF6C5C, 0x1AFF4838, 0x20FF382B, 0x0DFF3D32, 0x0EC4271E, 0x3128F800, 0x68251F13,
+0x0B24F105, 0x22FF2112, 0x13FF3627, 0x22FF2718, 0x2CFF3B2A, 0x2CFF4A38, 0x2AFF4D3C, 0x3AFF4B3A,
+0x22FF5547, 0x11FF372A, 0x24FF1C12, 0x0AFF2C23, 0x1AFF150D, 0x03542D25, 0x3C2214F1, 0x3A23FF48,
+0x4129FF49, 0x2808FF4D, 0x5640FF2E, 0x4246FF5B, 0x2F44FF47, 0x2D4DFF31, 0x2A4CFF2E, 0x004AF02A,
+0x0BF00EF4, 0xFF1B212F, 0xFF101624, 0xFF1A1C31, 0xFF444561, 0xFF262648, 0xFF303150, 0x3BF02138,
+0xFCFF1320, 0x2400F109, 0x18FF1517, 0x2DFF0B0A, 0x45FF201F, 0x2D143233, 0x09091531, 0x10F12300,
+0xFF060604, 0xFF36382D, 0xFF3B392A, 0xFF484534, 0xFF494134, 0xFF30281B, 0xFF27220F, 0xC84D4834,
+0x5F0CF109, 0xC5FF7E76, 0x55FFE7DB, 0x6DFF7F6F, 0x91FFA18E, 0x1FFFC8B4, 0x17FF573E, 0x08104D36,
+0x625231A0, 0x54462BFF, 0x08472CFF, 0x4C07F009, 0x504D2EFF, 0x353116FF, 0x504C33FF, 0x413D24FF,
+0x554F37FF, 0xF108F8FF, 0x443E2408, 0x474225FF, 0x443F22FF, 0x524C32FF, 0x372F18FF, 0x3A321DFF,
+0x2BB20374, 0x31FF5345, 0x2CFF6152, 0x00046455, 0x5C4F13F1, 0x403716FF, 0x4D4423FF, 0x514B2BFF,
+0x3E391CFF, 0x555136FF, 0x444027FF, 0x332F16FF, 0x4F4B32FF, 0x11E0031C, 0x5DFF332E, 0x32FF7C78,
+0x11FF4D48, 0x510C5822, 0x1D16FF2A, 0x202EF420, 0x0EFC3527, 0xFF2E06F1, 0xFF353324, 0xFF353221,
+0xFF403D2C, 0xFF443E2E, 0x783E3828, 0x3104F110, 0x34FF4A43, 0x11FF4D46, 0x35FF2A25, 0x0FFF4E49,
+0x0E082A25, 0x55503C31, 0x0C001A9C, 0x45273111, 0xB218A850, 0xFF6D6242, 0xFF52472B, 0xB4574833,
+0x4008F014, 0x321EFF4D, 0x3E23FF3D, 0x3B1EFF48, 0x694DFF42, 0x4D35FF70, 0x0054FF53, 0x311FD000,
+0x54362F1D, 0x624A3116, 0x200EE468, 0x0BF8301D, 0x03885611, 0x573900F1, 0x4B24FF5C, 0x5632FF4D,
+0x4D34FF56, 0x0025A44F, 0x10001690, 0x4E08F125, 0x0DFF6D69, 0xB0FF2C2B, 0xF0FFC2C5, 0xF8FFF4F7,
+0xBBFFF2EF, 0x34D4B5B2, 0x503B58F1, 0x5A37FF4E, 0x5A31FF56, 0x421DFF55, 0x4E2DFF40, 0x5F3FFF51,
+0x4A32FF6C, 0x160DFF74, 0x0500FF70, 0x2316FF66, 0x391EFF61, 0x3F10FF5B, 0x8228FF4D, 0xDF46FF89,
+0xDC48FFEE, 0x5D15FFED, 0x4225FF6F, 0x402BFF50, 0x5A4AFF42, 0x5642FF59, 0x422DFF57, 0x4935FF43,
+0x3622FF4A, 0x4E39FF37, 0x341FFF4F, 0x3E2BFF36, 0xF10A6843, 0x32341C20, 0x2F331CFF, 0x474A35FF,
+0x606151FF, 0x525343FF, 0x3C3D2FFF, 0x28291BFF, 0x363523FF, 0x3D371FFF, 0x74694DFF, 0x655637FF,
+0x5F502FFF, 0x2E1014D8, 0x0FF108C4, 0x33FF6150, 0x41FF5A4A, 0xA6FF5247, 0x6DFFAEA9, 0x4DFF7777,
+0x45FF5558, 0xCBFF464B, 0xB7B8C1C9, 0xB8D7E720, 0xFFD82051, 0x10F17B20, 0xFF9A9B8D, 0xFF59583C,
+0xFF4E4622, 0xFF615431, 0xFF695938, 0xFF615233, 0xFF44391D, 0x50797256, 0x2338F120, 0x54FF433D,
+0x1EFF726C, 0x1FFF3B37, 0x20FF3B35, 0x19FF3E38, 0x6AFF3830, 0x2DFF8D83, 0x37FF5646, 0x3CFF6453,
+0x3CFF7058, 0x49FF745B, 0x3BFF846A, 0x35FF7259, 0x5EFF5C4C, 0x5AFF7F74, 0x26FF7971, 0x29FF4740,
+0x00544E44, 0x513404F1, 0x4B2DFF60, 0x593BFF5C, 0x5133FF6C, 0x5E41FF62, 0xF10ADC6C, 0x685A4020,
+0x64523CFF, 0x533D28FF, 0x5C3F2DFF, 0x6C4737FF, 0x603A2DFF, 0x715348FF, 0x6E564AFF, 0x584537FF,
+0x5E4B3AFF, 0x8E765CFF, 0xB29A80FF, 0x24F11BC4, 0xFF5E4F3A, 0xFF6E5C48, 0xFF62503C, 0xFF5B4837,
+0xFF665344, 0xFF5F493B, 0xFF5A4436, 0xFF513B2D, 0xFF4C3628, 0xFF584235, 0xFF5B453A, 0xFF553F34,
+0x08564035, 0x372C6000, 0x4034FF4D, 0x16F1251C, 0x4234FF58, 0x4537FF59, 0x5648FF5C, 0x4638FF6D,
+0x4C3EFF5D, 0x4B3DFF63, 0x4538FF62, 0x5346FF5F, 0x594EFF6D, 0x31000C74, 0x246C5245, 0x4A5CF100,
+0x3EFF715A, 0x33FF654E, 0x43FF5C45, 0x3EFF6E54, 0x36FF6A4F, 0x3DFF6449, 0x3BFF6A4D, 0x49FF6A4D,
+0x45FF7858, 0x44FF7255, 0x49FF6E52, 0x48FF7357, 0x3CFF7459, 0x5CFF684D, 0x3CFF8B6E, 0x47FF6B4E,
+0x46FF7457, 0x40FF7555, 0x4DFF6D4D, 0x4CFF7858, 0x4BFF7757, 0x48FF7659, 0x4BFF7558, 0x35FF795E,
+0x11FF664C, 0x3CFF4126, 0x0090654B, 0x4E4010F1, 0x4234FF64, 0x5244FF58, 0x483BFF69, 0x4536FF62,
+0x3F2EFF5F, 0x4432FF59, 0x3522FF5B, 0xF100044A, 0x4C372638, 0x372416FF, 0x463629FF, 0x362A1CFF,
+0x261A0EFF, 0x2B1D12FF, 0x2C1B13FF, 0x2D1E17FF, 0x34251EFF, 0x39281EFF, 0x322012FF, 0x3E2C18FF,
+0x392713FF, 0x3B2B1CFF, 0x271A12FF, 0x211716FF, 0x1F1617FF, 0x140D07FF, 0x29F00DA0, 0xFF302509,
+0xFF453815, 0xFF544621, 0xFF594D23, 0xFF7F784A, 0xFF4D4B25, 0xFF626054, 0xFF35343C, 0xFF2D2D47,
+0xFF30314F, 0xFF2B3044, 0xFF0E1424, 0xFF070D1D, 0xFF1E2336, 0x6BB118F0, 0x65FF4949, 0x5DFF3E3D,
+0x05003737, 0x242736B1, 0x191B28FF, 0x11131FFF, 0x325077F4, 0x3DFF2524, 0x0A212E74, 0xF150040B,
+0x0C101308, 0x0D0F0AFF, 0x2D2F22FF, 0x4C4A3BFF, 0x4B4839FF, 0x645E52FF, 0xC00033A4, 0x2A1A3133,
+0xF1226831, 0x43371F1C, 0x72624BFF, 0xC1AD94FF, 0x9B8465FF, 0x8B7253FF, 0x4F3119FF, 0x745840FF,
+0x8E7556FF, 0x5F4A2BFF, 0x56452BFF, 0x675B43FF, 0x263122A0, 0x124C443E, 0x46303CF1, 0x4731FF4C,
+0x3A23FF4D, 0x533CFF42, 0x280EFF5B, 0x4326FF2F, 0x4124FF48, 0x3E24FF46, 0x361FFF45, 0x2D19FF3E,
+0x2B15FF38, 0x3E25FF37, 0x492BFF4E, 0x522DFF5A, 0x5328FF66, 0x562CFF64, 0x4C26FF63, 0x5D3DFF58,
+0x381BFF68, 0x000A4041, 0x00000F28, 0x2C143103, 0xF1096C32, 0x2F291100, 0x433B24FF, 0x746E58FF,
+0x5F5846FF, 0x374010D0, 0x68FF4B45, 0x29E8002F, 0x393A2C32, 0x08F015B4, 0x25FF312F, 0x3AFF3734,
+0x1EFF4E48, 0x1DFF352E, 0x21FF342D, 0x14FF3930, 0x0AEC0019, 0x8004AC00, 0xFF433C2A, 0xFF26210D,
+0x00F128C8, 0xFF46412D, 0xFF2C2411, 0xFF595238, 0x8C706746, 0x4C27710F, 0x4C2BFF54, 0xF11E9C55,
+0x3A2F1910, 0x362B17FF, 0x514630FF, 0x494023FF, 0x4E472AFF, 0x5F583CFF, 0x332D15FF, 0x504939FF,
+0x29B11474, 0x44FF4539, 0x58FF6457, 0x2A147E6F, 0x5A493560, 0x2C5B47FF, 0x6F06F11F, 0x8A7A58FF,
+0x7F7045FF, 0x72633AFF, 0x7D6C4EFF, 0x73614BFF, 0x04F10264, 0xFF452F1A, 0xFF6F5836, 0xFF6E5C38,
+0xFF978C76, 0xCCF2EEE5, 0xB4B87195, 0x2820FFB3, 0x312F8821, 0x705D5C3E, 0x462B600F, 0x543FFF43,
+0x2AF11AAC, 0x2B1CFF52, 0x160DFF59, 0x0E07FF78, 0x281FFF75, 0x4125FF68, 0x2B00FF64, 0xC454FF3E,
+0xD032FFD1, 0xD84AFFE0, 0x5C21FFE9, 0x4533FF6C, 0x5643FF50, 0x4A36FF59, 0x3826FF4B, 0x310FE03F,
+0x383F372A, 0x3B297115, 0x2C17FF3A, 0xB12B9829, 0xFF2E311C, 0xFF1B1F08, 0x1C464A31, 0x4704F10A,
+0x3AFF5D5A, 0x37FF504D, 0x17FF4C4B, 0x0DFF272A, 0x1BEC2322, 0x523414F1, 0x5938FF63, 0x6646FF6D,
+0x442CFF79, 0x3923FF50, 0x3D26FF45, 0x4733FF53, 0x4434FF60, 0x3D2DFF55, 0xE001B84A, 0xFF45402A,
+0xFF2D2E1C, 0xFF7F827B, 0x7C78D3DA, 0x80ACD311, 0xA9AD22F0, 0x7062FFA8, 0x593DFF6F, 0x4A26FF5A,
+0x5D3AFF52, 0x6446FF6A, 0x583EFF75, 0x351DFF68, 0x705BFF41, 0x2610FF78, 0x422FFF2C, 0x7864FF49,
+0xC81EFF7D, 0x3517F106, 0x321EFF3A, 0x321CFF37, 0x8770FF38, 0x492FFF8F, 0x4629FF57, 0x5435FF55,
+0x6949FF69, 0x6645FF80, 0x5A3BFF80, 0x711BA871, 0xFF6F6452, 0xE0766E59, 0x460CF109, 0x2EFF695F,
+0x49FF5648, 0x3FFF7463, 0x51FF6E5A, 0x45FF816C, 0x40FF725E, 0x01A06959, 0x62513D31, 0x18F12700,
+0xFF583E31, 0xFF523225, 0xFF583323, 0xFF593424, 0xFF5E4236, 0xFF5E483B, 0xFF5B493B, 0xFF665543,
+0xFF7A654A, 0xD0AF9A7F, 0x16C80020, 0x442D30F1, 0x402AFF54, 0x3C2BFF52, 0x3B29FF4F, 0x4130FF4C,
+0x4D3CFF54, 0x382AFF60, 0x3C2EFF4F, 0x3C30FF53, 0x3428FF54, 0x3C32FF4C, 0x382EFF54, 0x3E34FF50,
+0x3B30FF56, 0x4437FF56, 0x4334FF5E, 0xB104505D, 0xFF5C4032, 0xFF715547, 0xB85A3E30, 0x3C2EA004,
+0x493BFF58, 0x483AFF65, 0x1AF1047C, 0x4939FF5F, 0x4938FF66, 0x4A37FF64, 0x402EFF65, 0x5641FF5D,
+0x4E39FF72, 0x432DFF69, 0x4A35FF5F, 0x412DFF6A, 0x4733FF64, 0x4000046A, 0xFF785541, 0x3CF10004,
+0xFF714E3B, 0xFF765340, 0xFF7D5A47, 0xFF5C3925, 0xFF805D49, 0xFF775440, 0xFF775441, 0xFF7C5946,
+0xFF745042, 0xFF765244, 0xFF6E4C40, 0xFF6B493D, 0xFF735344, 0xFF795A46, 0xFF70513D, 0xFF634430,
+0xFF6E4E3F, 0xFF715444, 0x04705544, 0x4B18F100, 0x43FF7A5A, 0x46FF7252, 0x25FF7857, 0x31FF5839,
+0x52FF6246, 0x52FF8267, 0x4CFF8065, 0x4DFF785D, 0x60FF775B, 0x0AC4876D, 0x584A20F1, 0x5B4DFF6B,
+0x5345FF72, 0x5649FF6A, 0x5143FF6C, 0x5B4AFF64, 0x523FFF6E, 0x5844FF67, 0x3D29FF71, 0x4737FF56,
+0x483AFF5E, 0x3A31FF5B, 0xF119B848, 0x3C302240, 0x382912FF, 0x5B4B29FF, 0x837247FF, 0x7E6B40FF,
+0x796938FF, 0x625922FF, 0x615D2EFF, 0x84826BFF, 0x343331FF, 0x35364AFF, 0x383957FF, 0x1E223BFF,
+0x0C1127FF, 0x32374BFF, 0x30354BFF, 0x070922FF, 0x333453FF, 0x3C3B63FF, 0x29294DFF, 0x180072F4,
+0x36FC001E, 0x004FFC00, 0x44713C08, 0x3BFF3335, 0x28302829, 0x131C08F1, 0x0608FF0F, 0x160DFF05,
+0x3123FF19, 0x4232FF37, 0x4735FF48, 0xB123884E, 0xFF31291C, 0xFF3B3125, 0x0C413829, 0x2C1CF128,
+0x21FF5545, 0x20FF4B39, 0x8BFF503B, 0x41FFC3A8, 0x1BFF7C5F, 0x25FF5434, 0x27FF5D3F, 0x30FF6045,
+0x21FF664F, 0x1DFF4E3A, 0x18A04231, 0x382405F0, 0x2E19FF43, 0x2E17FF3D, 0x341FFF3E, 0x311CFF43,
+0x0228FF40, 0xB109E400, 0xFF50472A, 0xFF453E22, 0xD84E472D, 0x0511F01D, 0x1FFF2718, 0x2EFF4636,
+0x24FF5C46, 0x40FF5A43, 0x2AFF7B65, 0x3BFF6552, 0x30FF7364, 0x80FF6256, 0x50363109, 0xF11A2C57,
+0x4C453300, 0x37301EFF, 0x1F1805FF, 0x59513CFF, 0x2371140C, 0x69FF4237, 0x0ED0867B, 0x201909B1,
+0x373020FF, 0x484234FF, 0xAC0138F8, 0x3937211A, 0x01F03E34, 0xFF403D2E, 0xFF322C1E, 0xFF413B2B,
+0xFF383222, 0x34401578, 0xF0FF4A40, 0x1708F10F, 0x46FF2E27, 0x16FF5D56, 0x24FF2C26, 0x32FF3B34,
+0x16FF4B44, 0x14943029, 0x55350CF1, 0x4723FF5B, 0x4B26FF4D, 0x5D39FF53, 0x4D30FF65, 0x381DFF56,
+0x4229FF42, 0x3222DC4C, 0xB4504A2A, 0x5946F019, 0x351BFF60, 0x5140FF3C, 0x2B1BFF5A, 0x422FFF37,
+0x6D53FF4F, 0x5B41FF7B, 0x5036FF6C, 0x3824FF61, 0x3820FF4A, 0x6445FF4C, 0x6B43FF7D, 0x8D61FF84,
+0x784CFFA5, 0x7C5AFF90, 0x5A3EFF99, 0x614BFF78, 0x5A3FFF84, 0x7750FF7C, 0x6944FF97, 0x957EFF83,
+0xEBE1FFA4, 0xF4D1B8BC, 0xB4B5B7FF, 0x252B21FF, 0x2B2E1BFF, 0x68001668, 0x2614310F, 0xF10FD825,
+0x4135272C, 0x5F3328FF, 0x75120CFF, 0x720905FF, 0x682B26FF, 0x5F3E1DFF, 0x624C00FF, 0xF3E163FF,
+0xE1D239FF, 0xB4A526FF, 0x6A5C2BFF, 0x4C4236FF, 0x4D4A37FF, 0x494834FF, 0x241E0EFF, 0x16F00BE8,
+0xFF3F372C, 0xFF453F33, 0xFF2C2D1D, 0xFF181B0A, 0xFF252719, 0xFF212413, 0xFF3C4029, 0xFF484A32,
+0xFF37321C, 0xF12FC847, 0xFF484207, 0xFF3F3921, 0xFF33311A, 0xFF38341B, 0xFF423419, 0x00604D2D,
+0x4A2C310C, 0xD01BFC5B, 0xFF534737, 0xFF543E30, 0xFF462F21, 0xA10CE82A, 0x18FF4C40, 0x23FF3B34,
+0x2640423E, 0x4A4A3E60, 0x5CDCDBFF, 0xFFE120C6, 0x14F181E8, 0xFF575652, 0xFF63604D, 0xFF696446,
+0xFF645C38, 0xFF796F4B, 0xFF57492C, 0xFF6E6046, 0xFF463E27, 0x84746D5A, 0x290CF12B, 0x61FF413C,
+0x24FF7774, 0x1BFF3A37, 0x2DFF312E, 0x29FF4340, 0x6AFF443F, 0x24588981, 0x442705F0, 0x5032FF52,
+0x6142FF61, 0x5233FF76, 0x5136FF69, 0x205CFF66, 0x645945B1, 0x817662FF, 0x5A4F39FF, 0x04F125C4,
+0xFF594930, 0xFF76624A, 0xFF6D5740, 0xFF6D573F, 0xD45B472F, 0x069C0024, 0x3130F400, 0xB0635041,
+0x352AC004, 0x291AFF51, 0x3827FF4A, 0x048CFF59, 0x45370CF1, 0x4C3CFF5B, 0x503FFF5D, 0x5139FF63,
+0xA186FF67, 0x3F26FFB6, 0x3B22FF4F, 0x7107F84B, 0xFF47331A, 0x2445331B, 0x2700F103, 0x2CFF5440,
+0x39FF5945, 0x2DFF5F44, 0x04EC5338, 0x352C0CF1, 0x3C33FF50, 0x4138FF57, 0x3E33FF5C, 0x3429FF59,
+0x3D31FF50, 0x4234FF59, 0xF104F45E, 0x6245354C, 0x624537FF, 0x56392BFF, 0x67473CFF, 0x54362BFF,
+0x6A4D3FFF, 0x593C2EFF, 0x6C4C3DFF, 0x60412FFF, 0x5F432EFF, 0x644832FF, 0x6B4C37FF, 0x70513CFF,
+0x664A34FF, 0x664830FF, 0x69452FFF, 0x744E39FF, 0x69432EFF, 0x734F39FF, 0x704C36FF, 0x77513CFF,
+0x6F4934FF, 0x724C37FF, 0x5CF12008, 0xFF68452F, 0xFF78553F, 0xFF795640, 0xFF845F4C, 0xFF714C3A,
+0xFF795643, 0xFF543020, 0xFF664536, 0xFF715041, 0xFF6A4938, 0xFF704F3E, 0xFF755141, 0xFF745342,
+0xFF715240, 0xFF6C4D3B, 0xFF634231, 0xFF6E4A3A, 0xFF6F4B3B, 0xFF73503D, 0xFF704F3C, 0xFF7D5D48,
+0xFF71523D, 0xFF81624E, 0xFF664532, 0xFF775343, 0xFF7E5A4A, 0x5C775645, 0x4748F10A, 0x3FFF7756,
+0x37FF744F, 0x43FF6E49, 0x47FF7858, 0x40FF7B5F, 0x65FF765B, 0x44FF9B7D, 0x4CFF7A57, 0x57FF805C,
+0x58FF8968, 0x4FFF8B6C, 0x4EFF8066, 0x78FF806B, 0x55FFAA95, 0x5FFF8E77, 0x4FFFA28B, 0x46FF997E,
+0x45FF8F72, 0x4AFF8D72, 0x4AFF937F, 0x73FF887C, 0x41EC9A96, 0x373646B2, 0x383958FF, 0x1D1F45FF,
+0x33F168FC, 0x29FF3338, 0x16FF0D13, 0x65FF0002, 0x58FF4A4F, 0x2FFF373B, 0x12FF1014, 0x17FF0004,
+0x2AFF080C, 0x33FF191B, 0x4CFF2021, 0x46FF3639, 0x32FF2E33, 0x19FF1920, 0x15FF040C, 0x09FF050E,
+0x03FF0909, 0x0BBC1C0E, 0x2B1A58F1, 0x5240FF3E, 0x1803FF63, 0x2E18FF27, 0x1B07FF3A, 0x2C19FF26,
+0x4D37FF39, 0x462DFF5F, 0x4426FF5A, 0x290AFF57, 0x5A3AFF40, 0x4E2CFF77, 0x492AFF6C, 0x4628FF68,
+0x3919FF63, 0x4528FF50, 0x331BFF5A, 0x432FFF47, 0x311EFF55, 0x442FFF3E, 0xD3BBFF53, 0x8E76FFEB,
+0x3B26FFAC, 0x3C27FF57, 0x2D18FF58, 0x5139FF4D, 0xF121486D, 0x463B1D10, 0x453921FF, 0x463722FF,
+0x2C1A04FF, 0x543C24FF, 0x6A482CFF, 0x8F6E4FFF, 0x6F5532FF, 0x09900904, 0x36FF3B2B, 0x1FFF6356,
+0x4F90313C, 0x1D0DFF54, 0x4338FF24, 0x305109DC, 0x181204FF, 0x303122D4, 0x1E584D42, 0x695601F0,
+0x4D3AFF78, 0x2412FF55, 0x3D2EFF2B, 0x15B8FF46, 0x001AF400, 0x2B400F08, 0x20FF3A33, 0x3829B125,
+0x3F2DFF3B, 0x2F1DFF40, 0xF12D2C30, 0x312B1F04, 0x4F473CFF, 0x473E35FF, 0x2C231AFF, 0x464034FF,
+0x00F13450, 0xFF41392C, 0xFF645D4D, 0xFF362F1C, 0xD8322A13, 0x5031B122, 0x3010FF59, 0x5C3CFF3B,
+0xF123D867, 0x51482B0C, 0x322B0EFF, 0x4C4727FF, 0x4E4A25FF, 0x5F5A34FF, 0x574E2DFF, 0x66583BFF,
+0x08F128E4, 0xFF4E3E27, 0xFF665939, 0xFF6E613E, 0xFF7C6C48, 0xFF4F3E20, 0xE4342812, 0x4C1EF00A,
+0x73FF8F73, 0x4FFFC1A0, 0x20FF9D7C, 0x2FFF6C4B, 0x44FF7958, 0x5BFF8D6A, 0x48FFA279, 0x57FF8F66,
+0x29FF9F7B, 0x9AFF644A, 0xECFFB9AE, 0x07F1B8B4, 0xB9FFEDF1, 0x40FFB6B7, 0x1AFF4F4B, 0x1BFF342D,
+0x23FF352E, 0x39803B36, 0x413F3332, 0x17F11674, 0x1BFF532D, 0x1CFF7F22, 0x31FF821E, 0x0BFF6A35,
+0x05FF4E32, 0x35FF846D, 0x50FFCFBD, 0x09FFE3D5, 0x4CFF7B6F, 0x14987F78, 0xF00FE800, 0x4946330E,
+0x2F3022FF, 0x28281CFF, 0x383629FF, 0x3D3B2EFF, 0x333426FF, 0x18190BFF, 0x212415FF, 0x171301F0,
+0x3D3A27FF, 0x423D27FF, 0x4A442CFF, 0x2DA832FF, 0x385C5021, 0x1407F013, 0x18FF382C, 0x19FF4032,
+0x3FFF4333, 0x33FF6B5C, 0x30FF6053, 0xE01E404C, 0x392DFF50, 0x342EFF43, 0x1C16FF41, 0x1A70FF29,
+0x462F25F0, 0x2D15FF48, 0x3620FF2D, 0x3320FF34, 0x3729FF30, 0x867BFF35, 0xA298FF84, 0x8075FFA2,
+0x3624FF84, 0x6246FF3D, 0x6948FF69, 0x633FFF72, 0x6C48FF6B, 0x0650FF74, 0x5D4014F1, 0x381FFF62,
+0x6D56FF3C, 0x2510FF6F, 0x2916FF27, 0x6E5CFF2C, 0x2513FF6F, 0x2514FF26, 0x3320FF28, 0x71059836,
+0xFF817B61, 0x2843391E, 0x482D3125, 0xF0255C56, 0x5E4C3607, 0x63533CFF, 0x4F432BFF, 0x675D44FF,
+0x93876FFF, 0x9C5D46FF, 0xFF61302A, 0xF1244431, 0xFF5A4507, 0xFF6D5843, 0xFF665239, 0xFF6F5B43,
+0xFF4A3726, 0xFC544333, 0x2AF40002, 0x423440F1, 0x4638FF54, 0x2B1CFF59, 0x2F1EFF45, 0x3C28FF4A,
+0x432EFF55, 0x301EFF59, 0x311FFF47, 0x4F3BFF48, 0x957FFF68, 0x4F34FFAE, 0x6041FF64, 0x6646FF75,
+0x7151FF7D, 0x6444FF88, 0x704EFF7B, 0x855CFF87, 0x8C62FF9C, 0x4136FFA3, 0x2F24FF5C, 0x1305004A,
+0xF105002A, 0x4D31260C, 0x54382DFF, 0x5C3E33FF, 0x55382AFF, 0x563929FF, 0x533626FF, 0x634334FF,
+0x338004E8, 0x44FF613F, 0x08FF7250, 0x3217F000, 0x2FFF5F3F, 0x34FF5E3E, 0x24FF6944, 0x21FF5B36,
+0x2EFF5636, 0x2CFF6343, 0x38FF6542, 0x34FF6F4F, 0x2DFF6A4C, 0xF109F844, 0x35FF7022, 0x31FF7348,
+0x31FF6E45, 0x2EFF7047, 0x2DFF6D44, 0x35FF6C43, 0x38FF744B, 0x39FF774E, 0x24FF7650, 0x24FF613B,
+0x3DFF603C, 0x32FF7753, 0x05246C48, 0x704B38B1, 0x77523FFF, 0x684331FF, 0x406004A8, 0x3AFF7752,
+0xF109E04B, 0x33FF7E16, 0x39FF6A45, 0x3BFF6F4C, 0x3EFF724F, 0x3FFF7651, 0x3BFF7852, 0x41FF764D,
+0x30FF7E55, 0x3CFF6B45, 0x056C7854, 0x644E98F1, 0x5A44FF88, 0x5742FF7E, 0x533EFF7D, 0x5441FF79,
+0x5341FF7A, 0x503EFF7C, 0x5141FF79, 0x4936FF7F, 0x5740FF74, 0x5339FF7D, 0x5539FF77, 0x664FFF78,
+0x3F2FFF8C, 0x594CFF69, 0x5949FF85, 0x5843FF84, 0x5236FF7E, 0x5E3CFF74, 0x835FFF7C, 0x7147FFA1,
+0x6C3DFF8E, 0x6837FF8C, 0x6839FF88, 0x8C5DFF88, 0x774BFFA8, 0x6942FF8E, 0x725BFF77, 0x4C47FF7A,
+0x3547FF4F, 0x3655FF34, 0x3156FF33, 0x4166FF2D, 0x2946FF3D, 0x0E24FF24, 0x172BFF08, 0x485CFF12,
+0x213AFF43, 0x0A20FF1D, 0x2535FF05, 0x3544FF1F, 0x3244FF32, 0xB1412831, 0xFF2E3144, 0xFF252A3D,
+0x000A1121, 0x1A6BF005, 0x0CFF0910, 0x11FF0F0B, 0x71FF351D, 0x6DFFA485, 0x70FF9E82, 0x59FF9F86,
+0x55FF8974, 0x4FFF8772, 0x59FF7D67, 0x59FF8971, 0x46FF8F71, 0x33FF8162, 0x44FF6E51, 0x27FF8366,
+0x2DFF6C4A, 0x1DFF734F, 0x35FF633F, 0x26FF7756, 0x21FF6346, 0x27FF593E, 0x27FF5B3F, 0x17FF583E,
+0x13FF432F, 0x4CFF432B, 0x9BFF8A66, 0x84FFDDB5, 0x52FFC19B, 0x36FF9168, 0x2CFF7A4D, 0x17FF6F45,
+0x1116E834, 0xF1002469, 0x6C523B14, 0x6F533BFF, 0x765438FF, 0x795030FF, 0x714B27FF, 0x4F3510FF,
+0x4B3510FF, 0x503C1BFF, 0x7E6D51FF, 0x48000D68, 0x24163123, 0xF1383830, 0x362C2008, 0x211809FF,
+0x3E3121FF, 0x5D4D3DFF, 0x66513EFF, 0x7A6854FF, 0x0D531E5C, 0x2BFF2A22, 0x01F01FB0, 0xFF1E180C,
+0xFF372E25, 0xFF382E24, 0xFF2C2012, 0x00F11A58, 0xFF312A17, 0xFF2F2A16, 0xFF3B3421, 0x282C2010,
+0x15DC002A, 0x00343800, 0x26310F10, 0x33F83E35, 0x423110F1, 0x321FFF4F, 0x462FFF41, 0x4D33FF55,
+0x4A2EFF5D, 0x3F21FF5B, 0x694BFF50, 0x4F30FF7A, 0xF005985E, 0x5548284B, 0x483E1BFF, 0x3C320EFF,
+0x796D47FF, 0x6B5B39FF, 0x7A6747FF, 0x7C644AFF, 0x685034FF, 0x6C5C3BFF, 0x70603CFF, 0x79633CFF,
+0x836C4AFF, 0x2F1F05FF, 0x887557FF, 0xC5A67AFF, 0xBA9463FF, 0x885E34FF, 0x794F27FF, 0x845D32FF,
+0x8B6139FF, 0x7D4F2EFF, 0x6A3D1EFF, 0x244424FF, 0xFF657306, 0xFFAA9F8B, 0x717D74E4, 0xFFB7B6B2,
+0x344F4734, 0x252CF106, 0x26FF4538, 0x21FF4236, 0x27FF372D, 0x13FF3C34, 0x0EFF2D24, 0x00FF3E1D,
+0x00FF5202, 0x1EFF5803, 0x05FF5227, 0x17FF4A34, 0x2DFFA48E, 0x2AFFCFBA, 0x00FFAD9C, 0x3BFF5045,
+0x183C6561, 0x382501F0, 0x2010FF3D, 0x3224FF26, 0x2719FF31, 0x0B18FF26, 0x00444800, 0x8000359C,
+0x30283144, 0x0049B037, 0x13311024, 0x0AE82F29, 0x5C4014F1, 0x5033FF67, 0x4527FF5F, 0x4D32FF58,
+0x5138FF61, 0x4F34FF65, 0x664AFF63, 0x4F32FF77, 0x4428FF5D, 0x3121044F, 0x9C271E0F, 0x21B0001C,
+0x1D0E28F1, 0x2A15FF20, 0x3823FF28, 0x3E29FF35, 0x3928FF3B, 0x402FFF36, 0x5649FF3D, 0x5D4EFF58,
+0x5C49FF60, 0x6D54FF64, 0x795BFF77, 0x6E4BFF84, 0x5531FF78, 0x6846FF5D, 0xF11AE86E, 0x4A492D00,
+0x2C2C14FF, 0x72715DFF, 0x242311FF, 0x0CF13634, 0xFF737164, 0xFF232114, 0xFF242112, 0xFF3D3A29,
+0xFF332E1A, 0xFF706C53, 0x7840391D, 0x3E245025, 0xB41BFF4A, 0x51422101, 0x01F02AA8, 0xFF55492F,
+0xFF6C6145, 0xFF92846A, 0xFF615138, 0xC4000AA4, 0x3464F107, 0x2AFF614B, 0x3DFF5741, 0x35FF6F5A,
+0x24FF6752, 0x34FF513B, 0x18FF5F49, 0x35FF4430, 0x28FF5F4D, 0x32FF503E, 0x1FFF5C47, 0x20FF4E35,
+0x39FF5339, 0x3FFF6E54, 0x56FF745A, 0x61FF896F, 0x73FF9278, 0x77FFA48A, 0x66FFA991, 0x8AFF9E85,
+0x5EFFC3AC, 0x78FF9983, 0x62FFB59F, 0x7AFF9F89, 0x77FFB9A3, 0x64FFB9A4, 0x3AFFAA96, 0x28FF6147,
+0x30FF4F35, 0x0004583C, 0x453A0CF1, 0x3D32FF61, 0x3A2FFF5B, 0x483BFF58, 0x2F20FF68, 0x4735FF4F,
+0x4230FF66, 0x20093861, 0x1910402F, 0xFF740EF1, 0xFF664234, 0xFF704C3E, 0xFF644032, 0xFF6B4636,
+0xFF6A3E31, 0xFF704535, 0xD076503D, 0x04680009, 0x634D28F1, 0x543DFF87, 0x432DFF74, 0x503DFF66,
+0x4331FF7B, 0x4530FF72, 0x553FFF72, 0x5A42FF7F, 0x4F37FF84, 0x5941FF79, 0x5C44FF83, 0x4E36FF86,
+0x5139FF78, 0x4129FF7B, 0xF105186B, 0x6B422C00, 0x714B34FF, 0x6A442DFF, 0x603721FF, 0x10F10534,
+0xFF764C36, 0xFF744A34, 0xFF6C422C, 0xFF714731, 0xFF6F452F, 0xFF7B513B, 0xFF774D35, 0x606E442C,
+0x3080F116, 0x33FF7447, 0x3BFF784C, 0x2EFF8153, 0x30FF7648, 0x48FF7648, 0x39FF8D61, 0x3AFF7C52,
+0x41FF7C54, 0x38FF835B, 0x32FF7A50, 0x38FF7649, 0x3DFF7A4D, 0x3BFF7A4C, 0x43FF764B, 0x40FF7E55,
+0x49FF7D54, 0x41FF875C, 0x33FF8154, 0x4CFF7243, 0x45FF8B5C, 0x47FF8353, 0x3AFF8557, 0x35FF7950,
+0x2FFF774F, 0x47FF7953, 0x2DFF9671, 0x39FF8259, 0x4BFF8F6B, 0x59FF9F81, 0x6AFFA08A, 0x66FF9B88,
+0x68FF7F71, 0x5BFF6A60, 0x54FF4B48, 0x4EFF3A3A, 0x86E42D31, 0x4AE84A10, 0xFF1E22E1, 0xFF10152B,
+0xFF181D31, 0x1841465C, 0x3C000028, 0xF0371C00, 0x19193101, 0x09071CFF, 0x0B0A1AFF, 0x0C0B19FF,
+0x315530FF, 0x0C121622, 0x8C040064, 0x000340F1, 0x291FFF08, 0x826FFF47, 0x937DFFA8, 0x7B60FFB7,
+0x8667FF9D, 0x7E5EFFA5, 0x7758FFA1, 0x886DFF9E, 0x7B5FFFB4, 0x6D51FFAA, 0x7354FF9C, 0x7758FFA0,
+0x7958FFA4, 0x603FFFA7, 0x4221FF8E, 0x4B2CFF70, 0x7658FF78, 0x7052FF9F, 0x7155FF99, 0xF100049A,
+0x9E765C5C, 0x9B7457FF, 0x9C6F50FF, 0x9B6C4EFF, 0xA97B61FF, 0x8E5F45FF, 0xA46E54FF, 0x855031FF,
+0x835031FF, 0x936446FF, 0x8C5C45FF, 0xA97B63FF, 0x9F7056FF, 0x8E6142FF, 0x9B6F4AFF, 0x856238FF,
+0x6B5428FF, 0x655228FF, 0x4A2D0BFF, 0x725337FF, 0x70563DFF, 0x644E37FF, 0x644D3BFF, 0x6A5343FF,
+0x442F1EFF, 0x402B18FF, 0x57422DFF, 0x35710018, 0x18FF644B, 0x2D604630, 0x362A1271, 0x4B4128FF,
+0x00F11950, 0xFF5D523C, 0xFF4E422C, 0xFF54422E, 0xA03E2914, 0x2A20F10C, 0x2DFF5442, 0x30FF5847,
+0x1DFF5D49, 0x4DFF4D35, 0x17FF7D65, 0x07FF472F, 0x12FF331F, 0x12FF3C2A, 0x26FF3B2B, 0x28FF503E,
+0x1FFF553F, 0x0C605135, 0x392118F1, 0x5137FF57, 0x492FFF6F, 0x6145FF67, 0x6C4EFF7F, 0x7A5BFF87,
+0x5E3CFF93, 0x3513FF76, 0x4624FF4C, 0x714FFF5D, 0xF0177889, 0xA2856791, 0x7C5D40FF, 0x6D4E32FF,
+0x765C41FF, 0x5E4527FF, 0x927150FF, 0x755431FF, 0xA78A6CFF, 0x6F512FFF, 0x8F693CFF, 0xC19564FF,
+0x926339FF, 0x976741FF, 0x7E502CFF, 0x906240FF, 0x936242FF, 0xA17254FF, 0x794C2DFF, 0x7C583EFF,
+0xCDBCA8FF, 0xFBF4E4FF, 0xF4EDE3FF, 0xC8C1B1FF, 0x65573AFF, 0x5F4F2DFF, 0x5B452DFF, 0x4C331FFF,
+0x3D2314FF, 0x432C1CFF, 0x341F0CFF, 0x401F0EFF, 0x420600FF, 0x460A00FF, 0x472A18FF, 0x3D2C00FF,
+0xC7AE30FF, 0xC9AE23FF, 0xAC9535FF, 0x433300FF, 0x676043FF, 0x710B04FF, 0xFF3D352A, 0x3820180D,
+0x802A103F, 0x5B50703E, 0x4B402EFF, 0xF120E0FF, 0x2E271D04, 0x3F362FFF, 0x241B12FF, 0x181101FF,
+0x2E2611FF, 0x20F13368, 0xFF56472A, 0xFF6B5838, 0xFF543D1D, 0xFF644B2D, 0xFF705739, 0xFF4D3318,
+0xFF7B6445, 0xFF5E4B2B, 0xFF463517, 0xFF4F4126, 0xFF31250D, 0x3C180C00, 0x1A09E000, 0x2612FF1D,
+0x3B26FF27, 0x341FFF39, 0x3051359C, 0x413F30FF, 0x04F10B68, 0xFF554B3F, 0xFF6D604F, 0xFF897A63,
+0xFF96876A, 0x64766949, 0x4018F11A, 0x1EFF6660, 0x3DFF3F3B, 0x0DFF5654, 0x55FF201F, 0x18FF6161,
+0x2AFF2222, 0x6CFF3232, 0x18FF7474, 0x0FFF2020, 0x4A2C1B18, 0xB10F0800, 0xFF6F6A54, 0xFF3D371D,
+0x08463F23, 0x2F17710A, 0x4C36FF3B, 0x1034A458, 0xF119EC28, 0xFF554573, 0xFF9E8C74, 0xFF57432A,
+0xFF564122, 0xFF654E2E, 0xFF6C5237, 0xFF6F5638, 0xFF896F4C, 0xFF836742, 0xFF876A4A, 0xFF9B7E5E,
+0xFFA58866, 0xFFA98F6A, 0xFFAC926F, 0xFFB99C7A, 0xFFB79771, 0xFFC2A07A, 0xFFC8A882, 0xFFCAAC86,
+0xFFCAAC88, 0xFFB89C77, 0xFFBBA17E, 0xFFAA926E, 0xFF96805B, 0xFFB19D78, 0xFF715F37, 0xFF95835B,
+0xFF8F8057, 0xFF928358, 0xFF807146, 0xFF8C7E51, 0xFF52382B, 0xE8543A2D, 0x2D21310E, 0x3109F449,
+0x5C624235, 0x1F08F114, 0x41FF4F2E, 0x3AFF7352, 0x2CFF6E4D, 0x3EFF623F, 0x2FFF7451, 0x0E606542,
+0x65413140, 0xF10004FF, 0x68433314, 0x835949FF, 0x754738FF, 0x754737FF, 0x784D3AFF, 0x8A614DFF,
+0x774E3AFF, 0x9E7863FF, 0x7B5842FF, 0x32710ED4, 0x47FF7045, 0x04748859, 0x664E18F1, 0x462CFF90,
+0x5F45FF6E, 0x573DFF87, 0x6B52FF7F, 0x6952FF95, 0x563DFF96, 0x5942FF82, 0x5138FF87, 0x5C43FF7D,
+0xF1047086, 0x8860460C, 0x7B5138FF, 0x855940FF, 0x865840FF, 0x7E4E37FF, 0x82543CFF, 0x80543BFF,
+0x98F10014, 0xFF7A4B31, 0xFF815238, 0xFF77492F, 0xFF895B41, 0xFF794A2E, 0xFF825035, 0xFF9C664A,
+0xFF8A5438, 0xFF925F42, 0xFF976648, 0xFF845738, 0xFF855A3A, 0xFF885C3F, 0xFF7A4E31, 0xFF7C4D31,
+0xFF7D4D36, 0xFF7C4D3B, 0xFF744535, 0xFF805340, 0xFF82553E, 0xFF8D5F48, 0xFF8D5D47, 0xFF87543F,
+0xFF7B4732, 0xFF8A5742, 0xFF885842, 0xFF83543A, 0xFF7B4C2E, 0xFFA57753, 0xFFA07349, 0xFF8A6030,
+0xFFB69260, 0xFF9C834D, 0xFF7F6D45, 0xFF6E5E51, 0xFF352933, 0xFF362D4A, 0xFF403C5F, 0xFF434463,
+0xFF2A2E49, 0xFF32384E, 0xEC2E3547, 0x1D30314A, 0xB1140C18, 0xFF343851, 0xFF30344F, 0x04333754,
+0x4124001E, 0x283E58F1, 0x2A3AFF2A, 0x202EFF2B, 0x1C28FF21, 0x2433FF1C, 0x1F2FFF22, 0x111FFF20,
+0x0002FF15, 0x4B3FFF0E, 0x674FFF6D, 0x8063FF91, 0x7F5FFFA7, 0x6642FFA3, 0x5C38FF8C, 0x6646FF84,
+0x7E5EFF97, 0x6E50FFB3, 0x6547FFA5, 0x593AFF9C, 0x6B4CFF8E, 0x6546FFA0, 0x694AFF9A, 0x7859FF9E,
+0x6E4FFFAB, 0x4325FFA1, 0x5234FF74, 0xF104D481, 0x9A6D4C58, 0x815433FF, 0x8E6140FF, 0x885736FF,
+0xA37051FF, 0x6A371AFF, 0x7D472BFF, 0xA66B4DFF, 0x925737FF, 0x885230FF, 0x9B6946FF, 0x895A3CFF,
+0x98694BFF, 0x8D5C3CFF, 0x9A6A46FF, 0x8A5D34FF, 0x9D7B4DFF, 0x685223FF, 0x5F4A1DFF, 0x704F2CFF,
+0x987356FF, 0x9F7D61FF, 0xA38468FF, 0x9F8169FF, 0x9D7F67FF, 0x997A65FF, 0x7CF11048, 0xFFA28269,
+0xFF9D7D64, 0xFF947559, 0xFF9C7E62, 0xFF9A8266, 0xFF907D5F, 0xFF918064, 0xFF948365, 0xFFA99978,
+0xFF917E5E, 0xFF9B8264, 0xFF9F8467, 0xFFA18367, 0xFF9E8064, 0xFFB19275, 0xFFAE8C70, 0xFFA98467,
+0xFF987152, 0xFF957151, 0xFF987756, 0xFF836646, 0xFFA18466, 0xFF9C7D61, 0xFF9C7A5F, 0xFFA57D63,
+0xFFA37960, 0xFFA17960, 0xFFA77F66, 0xFFA17C61, 0xFFAB886A, 0xFF8B6848, 0xFFA58461, 0xFF927450,
+0xFF947652, 0x04A38563, 0x6467F200, 0x6AFFA685, 0x5CFFAC8B, 0x5AFF9F7C, 0x5CFF9C7B, 0x65FF957A,
+0x6BFF9E83, 0x4FFFB18D, 0x68FF9773, 0x65FFAC8B, 0x3CFFAC8C, 0x40FF936A, 0x41FF9C72, 0x45FF9B71,
+0x47FF9B70, 0x43FF976D, 0x34FF9166, 0x3BFF8257, 0x47FF865E, 0x74FF8F68, 0x7CFFB194, 0x64FFA796,
+0x85FF877D, 0x72FFA69F, 0x52FF9A91, 0x44FF8A7B, 0x4DFF846D, 0x4AFF896A, 0x51FF8563, 0x3CFF8C6A,
+0xF1119053, 0x4B24131C, 0x3A0200FF, 0x461300FF, 0x59411DFF, 0x918134FF, 0xE8D143FF, 0xD4BA29FF,
+0x78600AFF, 0x4F3D0DFF, 0x6D6447FF, 0x231E0AFF, 0x148019F8, 0x15FF2C23, 0x80FF2F28, 0x18B80029,
+0x44382231, 0x1D712AE4, 0x27FF3028, 0x0B043D33, 0x362A1431, 0x0EF03318, 0xFF7B6A4C, 0xFF614D2A,
+0xFF644C26, 0xFF5F4520, 0xFF6A4D2B, 0xFF654826, 0xFF593E20, 0x211C7C31, 0x0E086E55, 0x5B3D03F0,
+0x593DFF6E, 0x4630FF6A, 0x200CFF58, 0x1500FF31, 0x32110A00, 0x21710EA8, 0x23FF3836, 0x3A503936,
+0x0044B400, 0x2CF13AB0, 0xFF6B5F4F, 0xFF867762, 0xFF928268, 0xFF7D6E4F, 0xFF6E5F40, 0xFF776A4A,
+0xFF4B4024, 0xFF514A30, 0xFF201907, 0xFF645E50, 0xFF251E14, 0xFF3A3329, 0xFF756E66, 0xFF181107,
+0x34140C01, 0x1420003F, 0x8A836731, 0x78F132B0, 0xFF3D3212, 0xFF3F3212, 0xFF594A2B, 0xFF756649,
+0xFF867559, 0xFF928163, 0xFF9F8C6E, 0xFFB7A287, 0xFFB19A7B, 0xFFA8916F, 0xFFC3AB87, 0xFFC9AF8E,
+0xFFC9AF8C, 0xFFC7AB83, 0xFFD0B389, 0xFFCCAF87, 0xFFC9AC84, 0xFFCFB286, 0xFFC9AC80, 0xFFC8AB81,
+0xFFCCAF85, 0xFFC4A579, 0xFFBE9F73, 0xFF9C7C53, 0xFF9F8258, 0xFF977C51, 0xFFAC9468, 0xFFA0895F,
+0xFF9E895E, 0xFF7D6A42, 0xFF8C7951, 0xFF503E16, 0xFF85734B, 0xB878673C, 0x3F0CF117, 0x48FF7967,
+0x22FF7E6F, 0x23FF4B31, 0x1AFF4C32, 0x1EFF4428, 0x1FFF482C, 0x04FC4A2D, 0x2C1D0CF1, 0x5545FF4D,
+0x3D2AFF79, 0x311DFF60, 0x5A47FF54, 0x4E3AFF7F, 0x2C18FF71, 0xF10E704F, 0x58352224, 0x6E4B38FF,
+0x542F1DFF, 0x58321FFF, 0x693E2DFF, 0x6F4431FF, 0x744B37FF, 0x714B36FF, 0x704A35FF, 0x66422CFF,
+0x5B3B26FF, 0x70503BFF, 0x623925FF, 0x4CF10020, 0xFF5E351F, 0xFF805B41, 0xFF735034, 0xFF6E4B2D,
+0xFF593417, 0xFF7D5639, 0xFF7C4E36, 0xFF95674D, 0xFF93634C, 0xFF8D5F45, 0xFF855C40, 0xFF855E41,
+0xFF8C6546, 0xFF896042, 0xFF86573B, 0xFF845237, 0xFF9B6A4C, 0xFF966749, 0xFF76492A, 0xFF885B3C,
+0xFF905E43, 0xFF89563B, 0xE8855436, 0x3514F104, 0x47FF8754, 0x38FF9B66, 0x47FF8F56, 0x47FF9E65,
+0x4DFF9D66, 0x4FFFA26D, 0x36FF9E70, 0x4AFF8457, 0x03F8986B, 0x583A00F1, 0x583DFF89, 0x6752FF8B,
+0x553FFF9E, 0x00093C89, 0x48F1001C, 0xFF8D5C3B, 0xFFA06E4D, 0xFF956041, 0xFF996244, 0xFF9D6848,
+0xFFA36F4A, 0xFFA57048, 0xFFAC774D, 0xFFA06B41, 0xFFA27242, 0xFFAD864D, 0xFF987B43, 0xFFCEBB93,
+0xFF615441, 0xFF22171F, 0xFF342B48, 0xFF28234B, 0xFF212048, 0xFF161A37, 0xFF0B1127, 0xFF242A3A,
+0xE43E4452, 0x2D00F163, 0x2CFF191C, 0x5DFF1517, 0x63FF3E42, 0x78203F42, 0x30355331, 0xFC027808,
+0xFF236086, 0xFF272A3D, 0x30F10F04, 0xFF313447, 0xFF131426, 0xFF0A0813, 0xFF0C0000, 0xFF896950,
+0xFFA78059, 0xFFB48E67, 0xFFBF9974, 0xFF906845, 0xFFA67B59, 0xFFB88766, 0xFFAE7C59, 0xFFA46F4F,
+0xFFA67151, 0xFFA26B4C, 0xBC9A6344, 0x2B7CF100, 0x48FF7F4A, 0x36FF9865, 0x11FF8653, 0x31FF6231,
+0x4CFF8052, 0x59FF996E, 0x43FFA57D, 0x45FF8F67, 0x4EFF9169, 0x27FF9E70, 0x29FF7C47, 0x31FF7F46,
+0x3CFF8A4D, 0x42FF985B, 0x57FF9C66, 0x46FFAD80, 0x64FF9370, 0x3FFFA88C, 0x53FF8266, 0x49FF9C79,
+0x44FF9770, 0x27FF986E, 0x37FF7954, 0x2EFF7F64, 0x4CFF725A, 0x54FF9371, 0x66FF9A76, 0x5DFFAC88,
+0x67FFA07D, 0x5BFFA988, 0x60FF9E7B, 0x5FFFA27D, 0x65FFA57E, 0x6BFFAC83, 0x0008B488, 0xF10A8400,
+0xA67F6084, 0x9B7858FF, 0xAF916FFF, 0x8F734EFF, 0x978057FF, 0x9B8259FF, 0xAC8C66FF, 0xA88462FF,
+0xAB8463FF, 0xB28969FF, 0xAA7D5CFF, 0xB07F5EFF, 0xBA8563FF, 0xA06A46FF, 0xA36F48FF, 0xAE7D55FF,
+0xB1845DFF, 0xB38764FF, 0x9F7150FF, 0x99684AFF, 0x8C5E3DFF, 0xA07251FF, 0x95684BFF, 0x996D50FF,
+0x8A6344FF, 0x896543FF, 0xA27F59FF, 0xA07F56FF, 0x6B4A21FF, 0xA08059FF, 0xA68660FF, 0xB59471FF,
+0xBD9C79FF, 0xA3835DFF, 0x9F7F58FF, 0x94794EFF, 0x9E895CFF, 0x47B11208, 0x52FF8E6C, 0x6CFF9977,
+0x0344AD94, 0x774738F1, 0x7B45FF9B, 0x884CFF9E, 0x6C33FFA0, 0x6538FF81, 0x5F37FF80, 0x613AFF7C,
+0x6139FF81, 0x572BFF7D, 0x7F53FF68, 0x8058FF8C, 0x7A50FF8C, 0x6E3EFF81, 0x6937FF6F, 0x7F4EFF6F,
+0x7045FF95, 0x6340FF91, 0x7B5BFF8B, 0xF10054A4, 0xA17D5D20, 0xA57662FF, 0x622A1BFF, 0x591B06FF,
+0x723A17FF, 0x9B7B3EFF, 0xCFBC53FF, 0xE4D32EFF, 0xF5E345FF, 0xA08A37FF, 0x7C673CFF, 0x9B8E6BFF,
+0x04F13BD8, 0xFF5E5335, 0xFF5A5132, 0xFF595532, 0xFF5D5936, 0xE85B5437, 0x37257119, 0x3825FF3E,
+0x7138703F, 0xFF625135, 0x8C755E3F, 0x4230F115, 0x28FF836A, 0x3FFF7055, 0x49FF8A6E, 0x5DFF9478,
+0x48FFA58A, 0x3FFF8C70, 0x37FF8064, 0x35FF7659, 0x44FF6E53, 0x53FF7D62, 0x42FF8B70, 0x3FFF7A5C,
+0x4EFF7656, 0x43FF8466, 0x50FF795E, 0x0514826D, 0x31341C00, 0x842F2A14, 0x16F4F14E, 0x15FF2324,
+0x4DFF2422, 0x69FF615E, 0x5CFF857F, 0x37FF8378, 0x37FF6858, 0x3FFF6E5A, 0x2FFF7861, 0x2FFF6951,
+0x01FF654E, 0x53FF2C1B, 0x07FF7A6A, 0x1EFF2A19, 0x5EFF4130, 0x0AFF8170, 0x26FF2F1E, 0x6CFF4D3D,
+0x84FF9686, 0x8BFFB5A5, 0x8EFFC1AF, 0x79FFC6B4, 0x82FFB4A1, 0x8FFFC1AB, 0x93FFCFB8, 0x87FFD1B9,
+0x8BFFC5AD, 0x8AFFC9B1, 0x8DFFC8B0, 0x88FFCAB0, 0x68FFC7AD, 0x6FFFAA91, 0x61FFB39B, 0x70FFA38A,
+0x55FFB299, 0x5BFF9D85, 0x73FFA38B, 0x78FFB9A1, 0x58FFBEA6, 0x52FFA088, 0x48FF9A82, 0x4DFF8E76,
+0x3FFF9079, 0x1DFF816C, 0x1AFF5D48, 0x11FF5741, 0x23FF4C39, 0x44FF614E, 0x41FF826F, 0x4CFF806F,
+0x30FF8978, 0x29FF6B58, 0x0EFF624E, 0x53FF4933, 0x3BFF907A, 0x49FF7B64, 0x78FF8A71, 0x5DFFB59B,
+0x25FF987E, 0x24FF4E34, 0x18FF4D33, 0x20FF4226, 0x26FF4A2E, 0x2BFF5333, 0x1DFF5A3A, 0x09EC4F2E,
+0x4E3B04F1, 0x3D27FF73, 0x5943FF61, 0x3721FF7C, 0x3720FF5A, 0xF1013C57, 0x5F3F2A10, 0x755540FF,
+0x7A5743FF, 0x57331DFF, 0x784F3BFF, 0x7A513DFF, 0x67412CFF, 0x724E38FF, 0x2EB113C4, 0x17FF6744,
+0x33FF4B2C, 0x05146748, 0x6F463050, 0x18FC35FF, 0x74521FF1, 0x8E6D4EFF, 0x644324FF, 0x896849FF,
+0x6A4528FF, 0x865A3FFF, 0x82543AFF, 0x7B4D33FF, 0x7F5338FF, 0x7D5637FF, 0x9E7A5AFF, 0x75512FFF,
+0x18F1076C, 0xFF7E4F31, 0xFF865537, 0xFF875636, 0xFF906241, 0xFF885D3B, 0xFF835836, 0xFF714224,
+0xFF905F41, 0xFF9A674A, 0xFC8B5839, 0x4224F104, 0x20FF9861, 0x42FF773E, 0x28FF9B63, 0x47FF804A,
+0x46FF9E69, 0x2FFF9867, 0x3EFF7F51, 0x22FF8E60, 0x48FF7143, 0x49FF9769, 0x40FF9867, 0x33FF905A,
+0x08E0834D, 0x6B4744F1, 0x5D35FF9B, 0x7D57FF8E, 0x6F4DFFB3, 0x603EFFA5, 0x6A42FF96, 0x6C3FFF9E,
+0x7D4DFF9F, 0x7D4BFFB1, 0x673BFFB2, 0x7141FF9D, 0x8046FFA1, 0x7E4CFFA4, 0x6B51FF95, 0x1311FF79,
+0x2139FF1B, 0x385DFF29, 0x3D69FF3C, 0x2A53FF3E, 0x1A37FF28, 0x2B41FF15, 0x00690425, 0xE80054E0,
+0x46000068, 0x162904F1, 0x3A53FF13, 0x3154FF36, 0x3056FF2E, 0x2F4FFF2C, 0x000F242A, 0x3F417318,
+0x04FF262B, 0x00400000, 0x20221FF1, 0x0A0B1DFF, 0x07060EFF, 0x0F0200FF, 0x846546FF, 0x9C754AFF,
+0xB69165FF, 0xA27B52FF, 0x845936FF, 0xA97D5AFF, 0xD3A281FF, 0xA2704DFF, 0xB4F1099C, 0xFF92603D,
+0xFFA0694A, 0xFFA2694B, 0xFF915A3B, 0xFF824D2D, 0xFF986546, 0xFF835232, 0xFF815030, 0xFF744825,
+0xFF8F6944, 0xFF815E38, 0xFF7F5D37, 0xFF89633E, 0xFF865B38, 0xFF8A5938, 0xFF854C2F, 0xFFA86D4F,
+0xFF9D6745, 0xFF996C43, 0xFF806031, 0xFF735F2D, 0xFF5D5322, 0xFF7B6F3F, 0xFF897145, 0xFF89683D,
+0xFF9F7D50, 0xFF68471A, 0xFF876F41, 0xFF70592D, 0xFF674E25, 0xFF7E603A, 0xFF6C4C25, 0xFF92724B,
+0xFF957850, 0xFFA18158, 0xFF906D47, 0xFF8D6541, 0xFFA27653, 0xFFAF815F, 0xFFA67A57, 0xFF8D613E,
+0xFFA77B58, 0xFF9C714E, 0xFF9B7550, 0xFF927249, 0xFF816639, 0xFF927748, 0xFFAB8A5F, 0x9CA27C55,
+0x5218F105, 0x50FF9E76, 0x6BFFA175, 0x4DFFC191, 0x5DFFA975, 0x6FFFBC87, 0x49FFCF9C, 0x5EFFA677,
+0x4FFFB489, 0x47FFA479, 0x0004996B, 0x784ED8F1, 0x7B53FFA3, 0x825EFFA5, 0x6D49FFAA, 0x623DFF91,
+0xA981FF84, 0x976BFFC6, 0x6233FFB4, 0x5C2DFF7D, 0xAC7FFF77, 0x9469FFC7, 0xB78FFFAF, 0x9E75FFD3,
+0x6C40FFB7, 0x6D3CFF83, 0x5723FF83, 0x8950FF68, 0x6E36FF92, 0x6837FF79, 0x774BFF7E, 0x9365FF8F,
+0x8F5FFFA5, 0x7947FFA1, 0x8147FF90, 0x7534FF94, 0x6C2CFF7D, 0x6C35FF70, 0x5E2DFF75, 0x5C2AFF6C,
+0x7B4AFF70, 0x5021FF91, 0x6336FF65, 0x552DFF78, 0x7F55FF6E, 0x8554FF96, 0x7541FF93, 0x7F4FFF86,
+0x673AFFA3, 0x5F34FF93, 0x7C51FF86, 0x7C4AFF9D, 0x8056FF93, 0x755EFF9D, 0x0D00FFA5, 0x0300FF4A,
+0x3407FF45, 0x7724FF6D, 0xCA4BFF96, 0xD428FFD9, 0xDB3FFFE0, 0x6D1BFFE8, 0x7347FF7F, 0x8859FF84,
+0x6E3FFF90, 0x6336FF72, 0x5D30FF67, 0x6131FF61, 0x6537FF62, 0xF1288866, 0x3F3C1964, 0x4B4B29FF,
+0x625F3CFF, 0x8A8359FF, 0x8D8255FF, 0x8A794EFF, 0x8A7548FF, 0x7D6937FF, 0x98844FFF, 0xAF9C62FF,
+0xAF9C64FF, 0x9D8954FF, 0x948250FF, 0x776537FF, 0x57441AFF, 0x544119FF, 0x68542FFF, 0x937D58FF,
+0x816947FF, 0x7D6342FF, 0x866C4BFF, 0x88704AFF, 0x948159FF, 0x8E8059FF, 0x726A46FF, 0x302D0EFF,
+0x25280DFF, 0x292D16FF, 0x232710FF, 0x3CF11E5C, 0xFF6F6E50, 0xFF6C6642, 0xFF696037, 0xFF86774C,
+0xFF867348, 0xFF735D34, 0xFF89764E, 0xFF92825E, 0xFFC3B592, 0xFFBCAD8C, 0xFFB5A687, 0xFFBAAB8C,
+0xFF9D8E6D, 0xFFA19370, 0xFFA79974, 0xFFB2A37A, 0xFFA89A6D, 0xFFA89769, 0x5C958554, 0x4B1FF001,
+0x5AFF8F7A, 0x61FF9C87, 0x57FFA38E, 0x54FF9984, 0x55FF9681, 0x47FF9580, 0x3EFF8974, 0x2CFF806E,
+0x3DFF705E, 0x4DFF7F6D, 0x4FFF8F7D, 0xF11C5881, 0x73FF8E36, 0x7FFFB5A3, 0x57FFBFAD, 0x2FFF9987,
+0x28FF735E, 0x20FF6A55, 0x27FF5E4B, 0x17FF5F50, 0x26FF4C3E, 0x28FF5749, 0x2CFF594B, 0x2EFF6153,
+0x37FF665B, 0x36FF7065, 0x20FF6F62, 0x2DFF5647, 0x2BFF6351, 0x05006450, 0x7B5210F1, 0x5C37FF92,
+0x7050FF76, 0x7254FF8D, 0x3828FF8F, 0x3021FF4F, 0x3A2CFF4A, 0x3123FF56, 0x3118CC4D, 0x50523223,
+0x2E2BF01D, 0x24FF6241, 0x27FF5B38, 0x31FF603D, 0x2BFF6A4A, 0x1DFF6345, 0x38FF5338, 0x21FF6E53,
+0x44FF543A, 0x14FF785C, 0x27FF4A2C, 0x3DFF6040, 0x33FF7955, 0x36FF6F4B, 0x2EFF714F, 0xD1050447,
+0x4A33FF71, 0x503AFF6A, 0x4933FF6C, 0xF10A0C65, 0x7F594230, 0x815F44FF, 0x5D3E21FF, 0x6D5030FF,
+0x806341FF, 0x6B4E2EFF, 0x6C4D2EFF, 0x906B4EFF, 0x80573BFF, 0x784C2FFF, 0x7E5738FF, 0x81603FFF,
+0x806240FF, 0x735531FF, 0x74522FFF, 0x916646FF, 0x10F10D8C, 0xFF865837, 0xFF7C4F2E, 0xFF916B47,
+0xFF7A5634, 0xFF774E30, 0xFF6E4225, 0xFF835438, 0xF88C593C, 0x3208F10E, 0x3DFF8750, 0x3DFF915C,
+0x47FF925D, 0x3CFF9A68, 0x3EFF8F5D, 0x0404905D, 0xF1054000, 0x82533500, 0x946748FF, 0x996C4DFF,
+0x8C5D41FF, 0x3CF10848, 0xFF82502F, 0xFF8A5533, 0xFFA36B46, 0xFF8D5532, 0xFF7F4628, 0xFF9F6A48,
+0xFFA27349, 0xFFB28657, 0xFFB68854, 0xFF9F713D, 0xFFA07143, 0xFF895E33, 0xFFBA986A, 0xFFB39C7A,
+0xFF332A23, 0xFF1D1B29, 0xFF2B2A4A, 0xFF474670, 0xE42A2D56, 0x5704F195, 0x3BFF3439, 0x2BFF1B21,
+0x1FFF0E12, 0x17FF080A, 0x7CC40405, 0x00000FB1, 0x31364AFF, 0x3D4061FF, 0x50310028, 0x460C272B,
+0x264100F1, 0x3148FF22, 0x3045FF2F, 0x293DFF2E, 0x20820828, 0x46040B1B, 0xFF0F1EF1, 0xFF100100,
+0xFF8B6C4F, 0xFF987148, 0xFFA57E53, 0xFF966C42, 0xFF9D714A, 0xFF8F613D, 0xFFB48362, 0xFFA57453,
+0xFF986A48, 0xC08B5A39, 0x3C28F104, 0x2AFF945E, 0x3BFF814C, 0x36FF905E, 0x43FF8A5A, 0x41FF9567,
+0x4CFF9365, 0x4DFF9A6F, 0x3DFF9573, 0x42FF8265, 0x44FF8969, 0x3CFF8B69, 0x2AFF8660, 0x2AFF774C,
+0x05447C4B, 0x6E4444F1, 0x693AFF93, 0x804CFF85, 0x8952FF90, 0x8C55FF8E, 0x7C49FF89, 0x7042FF7E,
+0x8155FF82, 0x794CFF99, 0x6738FF94, 0x7443FF7D, 0x5221FF82, 0x6033FF5C, 0x6B3EFF6D, 0x4C1EFF79,
+0x6232FF5E, 0x7745FF74, 0x8350FF89, 0x7F50FF97, 0x7447FF9B, 0x855CFF96, 0x4004A0AC, 0xFFA57E57,
+0xFFF10004, 0xB0865ECD, 0xA37951FF, 0xA48255FF, 0xB29365FF, 0x9E8857FF, 0xA79160FF, 0xB99C70FF,
+0xA3835AFF, 0xA6865DFF, 0xB99C72FF, 0xAB8E62FF, 0xAA8B5DFF, 0xC2A072FF, 0x866232FF, 0xA1814EFF,
+0xAC915CFF, 0xA58E5CFF, 0x998352FF, 0x9E8658FF, 0x9D8253FF, 0xAD915FFF, 0xA78B59FF, 0x9F8757FF,
+0x776233FF, 0x837141FF, 0x897B4AFF, 0xA69964FF, 0x8E814CFF, 0xA29560FF, 0xBAAD78FF, 0x9C8F5BFF,
+0xA29463FF, 0x918551FF, 0x928952FF, 0x8A854BFF, 0x858545FF, 0x79833EFF, 0x96A059FF, 0x919050FF,
+0x958F53FF, 0xA39E66FF, 0x9D9A63FF, 0x85844EFF, 0x898C53FF, 0x757F40FF, 0x6F7A36FF, 0x929D5BFF,
+0x818344FF, 0x82763AFF, 0x977C47FF, 0x8F6238FF, 0x86502EFF, 0x682F14FF, 0x4C1600FF, 0x633617FF,
+0x744622FF, 0x90522BFF, 0xB1784BFF, 0x9C7E4CFF, 0x998E56FF, 0x8D8D4FFF, 0x988F58FF, 0x926B4AFF,
+0x3C0400FF, 0x460800FF, 0x885424FF, 0x9E8622FF, 0xC4BC33FF, 0xDFD736FF, 0xC1B92AFF, 0x7E7321FF,
+0x87824AFF, 0x7F8346FF, 0x878F53FF, 0x6C7137FF, 0x636830FF, 0x7E8349FF, 0x777A43FF, 0x61642FFF,
+0x747740FF, 0x82884CFF, 0x818749FF, 0x909457FF, 0x84884DFF, 0x858851FF, 0x7B7C43FF, 0x7D7E42FF,
+0x828244FF, 0x8C8C4CFF, 0x818040FF, 0x7B793CFF, 0x88864BFF, 0x76753CFF, 0x6B6A32FF, 0x797842FF,
+0x7A7943FF, 0x93925CFF, 0x9A9764FF, 0x989260FF, 0x888250FF, 0x817E4BFF, 0x868451FF, 0x8E8E5CFF,
+0x878B59FF, 0x62683AFF, 0x6F764AFF, 0x697148FF, 0x626940FF, 0x676C43FF, 0x777A4DFF, 0x7C7E4CFF,
+0x71713BFF, 0x929159FF, 0x76753DFF, 0x6E6D37FF, 0x7D7B48FF, 0x86854FFF, 0x979562FF, 0x858352FF,
+0x3CF10004, 0xFF848353, 0xFF6D6C3C, 0xFF747241, 0xFF757342, 0xFF817F4C, 0xFF75743E, 0xFF706D36,
+0xFF807D46, 0xFF716C35, 0xFF746F38, 0xFF8B8551, 0xFF8E8753, 0xFF827B45, 0xFF77703A, 0xFF645F28,
+0xFF68632C, 0xFF6F6A33, 0xFF66612A, 0x04746E3A, 0x5706F000, 0x57FF928B, 0x71FF9088, 0x65FFAA9F,
+0x47FF9D92, 0x2AFF7E71, 0x55E14CA0, 0x441FFF64, 0x5B38FF52, 0x6D4EFF65, 0xF1439076, 0x675E3F2C,
+0x5A522EFF, 0x6F6A42FF, 0x645F35FF, 0x575228FF, 0x5F5730FF, 0x685F38FF, 0x695D35FF, 0x796B44FF,
+0x63542BFF, 0x68562EFF, 0x685431FF, 0x725B3BFF, 0x523B2BFF, 0x4D3626FF, 0x94F20F08, 0xFF503426,
+0xFF4C2F1F, 0xFF5F4230, 0xFF684937, 0xFF52331E, 0xFF583821, 0xFF6D4F35, 0xFF63482B, 0xFF62492B,
+0xFF533B1F, 0xFF634E31, 0xFF6A553A, 0xFF402B10, 0xFF553D21, 0xFF674C31, 0xFF64442B, 0xFF65432A,
+0xFF56381E, 0xFF5A3C22, 0xFF5C3C25, 0xFF65472F, 0xFF6E543D, 0xFF4B2F19, 0xFF67432D, 0xFF7E5A42,
+0xFF624025, 0xFF614225, 0xFF765939, 0xFF846A47, 0xFF674F2D, 0xFF775D3C, 0xFF836243, 0xFF724D30,
+0xFF7F583B, 0xFF623F1F, 0xFF6F5232, 0xFF836B47, 0xFF6A502D, 0xFF896B49, 0xFF754E2F, 0xF8865A3D,
+0x5C0FF10E, 0x704DFF85, 0x5433FF92, 0x4728FF75, 0x5C3FFF68, 0x5B40FF81, 0x4E32FF87, 0x5D42FF7D,
+0xF113F490, 0x96654708, 0x784727FF, 0x7C4E2DFF, 0xA87757FF, 0x865535FF, 0x8B5A3AFF, 0x1CF10F40,
+0xFF835436, 0xFF7A4F2F, 0xFF92694B, 0xFF7E5235, 0xFF946949, 0xFFA17956, 0xFF8C603D, 0xFFA57352,
+0xFF966141, 0xFF976243, 0xF4905F3E, 0x4205F00D, 0x31FF946F, 0x4FFF8A62, 0x29FFAC80, 0x72FF8458,
+0x44FFC29B, 0x62527117, 0x151CFF73, 0x3154E018, 0xDC3E4067, 0x6409F0B3, 0x65FF353A, 0x52FF3A3F,
+0x52FF2F34, 0x55FF3337, 0x4AFF3839, 0xD8FF3133, 0x33406081, 0x2632FF31, 0x29518BD4, 0x474C6CFF,
+0x04F19114, 0xFF2D2F56, 0xFF292C4F, 0xFF2A2B49, 0xFF2C2E47, 0x041E1E36, 0x2C1DF0AA, 0x16FF1B1A,
+0x0FFF0B09, 0x1CFF0B08, 0x5CFF3124, 0x48FF9479, 0x52FF9370, 0x38FF9D7A, 0x2FFF8762, 0x44FF8157,
+0x50FF976B, 0x30FF9E73, 0x3B10F109, 0x53FF8660, 0x3DFFA07A, 0x37FF8E62, 0x4AFF8A5E, 0x3AFF9A73,
+0x46FF8967, 0x41FF9573, 0x18B48F6E, 0x88693D50, 0x28F02FFF, 0x85735DF0, 0x816C41FF, 0x70592FFF,
+0x9A8159FF, 0x81643CFF, 0x82623BFF, 0x896C42FF, 0x7F6D3BFF, 0x9E955EFF, 0x828047FF, 0x868A4FFF,
+0x848F53FF, 0x5B642BFF, 0x98925EFF, 0x948856FF, 0x8A804DFF, 0x8E8854FF, 0x6B6A34FF, 0x8D8D59FF,
+0x7C7C4AFF, 0x757340FF, 0x817A46FF, 0x6A632DFF, 0x878049FF, 0x867D44FF, 0x92814BFF, 0x8A733FFF,
+0x4ED445FF, 0xFFAC90E1, 0xFF9F8457, 0xFFA4895A, 0x14A58658, 0x6C0CF168, 0x48FFB7A0, 0x4BFF8D7C,
+0x5BFF8C7F, 0x2FFF9A8C, 0x5AFF715F, 0x50FF9C8A, 0x00109181, 0x12FFFFF1, 0xFF9D915D, 0xFF908450,
+0xFFA1915D, 0xFF7A6A36, 0xFF9D905B, 0xFF9B925B, 0xFFA6A169, 0xFF8E8B54, 0xFF7F7945, 0xFF6F6832,
+0xFF94884E, 0xFF988C52, 0xFF80773E, 0xFF837E44, 0xFF7D7C43, 0xFF8B8C52, 0xFF9E9F63, 0xFF808145,
+0xFFA2A266, 0xFF9F9F63, 0xFF8A8950, 0xFF7E7D44, 0xFF7F8044, 0xFF85894C, 0xFF808948, 0xFF84914B,
+0xFF7B8B42, 0xFF8C9C51, 0xFF919D55, 0xFF828B48, 0xFF7A8040, 0xFF91975B, 0xFF848F55, 0xFF78864B,
+0xFF748245, 0xFF788245, 0xFF898A4E, 0xFF807A3E, 0xFF88793E, 0xFF573C05, 0xFF4E1F00, 0xFF5F2903,
+0xFF663111, 0xFF4C1B00, 0xFF3E1300, 0xFF3C0A00, 0xFF7C3710, 0xFF9C5529, 0xFFB98756, 0xFFAF965D,
+0xFF949655, 0xFF89874E, 0xFF966E4B, 0xFF4D1300, 0xFF531D01, 0xFFA17A41, 0xFF9F8E22, 0xFFD1CB3F,
+0xFFB9B31D, 0xFFA09B19, 0xFF96943F, 0xFFA3A566, 0xFF95A05C, 0xFF7F8E4B, 0xFF7D8949, 0xFF899354,
+0xFF969F60, 0xFF8B9153, 0xFF8F9557, 0xFF8F9855, 0xFF88944A, 0xFF879349, 0xFF7B8642, 0xFF909C5A,
+0xFF93A261, 0xFF7E8D4C, 0xFF8A9654, 0xFF707D38, 0xFF848F4B, 0xFF8C9752, 0xFF808946, 0xFF919A57,
+0xFF7E8947, 0xFF919C5A, 0xFF9AA465, 0xFF8C9657, 0xFF939D5E, 0xFF9DA667, 0xFF889152, 0xFF798145,
+0xFF7F874C, 0xFF81894E, 0xFF7F894D, 0xFF8A9559, 0xFF839154, 0xFF97A56A, 0xFF899660, 0xFF8A9761,
+0xFF859058, 0xFF8B965C, 0xFF7C8647, 0xFF8A9553, 0xFF848F4D, 0xFF6F793A, 0xFF818C50, 0xFF7E884B,
+0xFF85904E, 0xFF7B8441, 0xFF899253, 0xFF778142, 0xFF757F42, 0xFF858F52, 0xFF798346, 0xFF818B4E,
+0xFF8B9357, 0xFF60682C, 0xFF7B8445, 0xFF7F8547, 0xFF72783C, 0xFF787E42, 0xFF7F844A, 0xFF666B31,
+0xFF82854C, 0xFF7A7F45, 0xFF80854B, 0xFF7C8147, 0xFF7B8046, 0xFF666E33, 0xFF767B43, 0xFF7A7F49,
+0xFF7F844E, 0xFF707240, 0xFFA7A676, 0xFF848154, 0xFF767147, 0x7C645C35, 0x5C37313E, 0x7129D464,
+0xFF676242, 0x68625D3D, 0x371EF03D, 0x3FFF605E, 0x35FF6869, 0x48FF6061, 0x37FF7577, 0x3FFF6263,
+0x22FF6C6B, 0x27FF504D, 0x2AFF5651, 0x34FF5B54, 0x24FF635B, 0x19FF5248, 0x3D2148D4, 0x312D0453,
+0x083F281A, 0x1D48F114, 0x3FFF482E, 0x20FF6D52, 0x2BFF4F32, 0x2AFF5D41, 0x2CFF5D43, 0x36FF6147,
+0x1BFF6C55, 0x36FF4F3A, 0x1EFF6554, 0x37FF4C3D, 0x07FF6254, 0x2FFF3324, 0x4AFF604D, 0x18FF8069,
+0x29FF5234, 0x33FF6445, 0x29FF6D4F, 0x60FF6345, 0x58FF9979, 0x0FFF9072, 0x1DFF4327, 0x27E05135,
+0x634C07F0, 0x4127FF89, 0x6245FF65, 0x7F5FFF81, 0x6140FF9C, 0x4221FF7B, 0x0EF21AB4, 0x4729FF6F,
+0x5E42FF64, 0x5438FF80, 0x5233FF77, 0x593AFF71, 0x6341FF72, 0x6442FF7A, 0x61052C7C, 0x4DFF8964,
+0x14189269, 0x4A2D4EF0, 0x5839FF6F, 0x4C2BFF77, 0x3719FF66, 0x5E3FFF52, 0x4C2FFF7D, 0x5537FF71,
+0x4528FF7E, 0x6F51FF72, 0x5536FF9E, 0x5435FF82, 0x5E3FFF81, 0x6344FF8B, 0x5D3FFF90, 0x5638FF8C,
+0x6B4FFF85, 0x4326FF9A, 0x5C3EFF70, 0x4A2EFF85, 0x5C41FF73, 0x6343FF88, 0x653EFF87, 0x4D26FF7B,
+0xD834FF63, 0x764C2123, 0x30001BE4, 0x4526F019, 0x29FF8567, 0x3EFF6A4E, 0x53FF8764, 0x20FFA87D,
+0x46FF7E4E, 0x57FF9169, 0x35FF7662, 0x24FF352E, 0x44FF1315, 0x7CFF2227, 0x71FF4D52, 0x6AFF3D41,
+0x6AFF353C, 0x46619AF0, 0x364CFF41, 0x71500C31, 0xFF242539, 0xD0302F3F, 0x1A08F11D, 0x34FF0A0E,
+0x72FF1B20, 0x63FF494D, 0x6BFF373A, 0x61FF4345, 0x55343B3E, 0x31411400, 0x302D2F48, 0x2133315F,
+0xF1640C22, 0x09080D14, 0x61584FFF, 0x735E41FF, 0x8E724BFF, 0x977E56FF, 0x8B6E46FF, 0x7D5C33FF,
+0xAE8B63FF, 0x93734AFF, 0xEAF012C8, 0xFF927D50, 0xFF8C7748, 0xFF745E2F, 0xFF816D3B, 0xFFA99966,
+0xFF9A915A, 0xFFABA26B, 0xFF898049, 0xFF8A7E4A, 0xFF736934, 0xFF827C48, 0xFF686530, 0xFF847E4C,
+0xFF675F2E, 0xFF4E4617, 0xFF8E8657, 0xFF857F4B, 0xFF9F9E66, 0xFF8A9257, 0xFF7A8648, 0xFF7B8347,
+0xFF858F50, 0xFF859556, 0xFF788849, 0xFF798347, 0xFF767F46, 0xFF7A884D, 0xFF738247, 0xFF869157,
+0xFF949F65, 0xFF7C874F, 0xFF707942, 0xFF575A23, 0xFF74753C, 0xFF7D8347, 0xFF7E8245, 0xFF676228,
+0xFF786F36, 0xFF857A44, 0xFF584F18, 0xFF837E47, 0xFF908B54, 0xFF9D9660, 0xFF817A43, 0xFF757539,
+0xFF74783D, 0xFF7E814C, 0xFF767644, 0xFF696734, 0xFF5C5B25, 0xFF80834C, 0xFF98A065, 0xFF576125,
+0xFF6E783C, 0xFF61662E, 0xFF7C8149, 0xFF697138, 0xFF6B763C, 0xFF6A783D, 0xFF87955A, 0xFF818C52,
+0xFF586024, 0xF0309834, 0xFF7A7C62, 0xFF909754, 0xFF8A9551, 0xFF707F3C, 0xFF7C8D49, 0xFF6C7C3B,
+0xFF8C9A5C, 0xFF6E7A3C, 0xFFA2AE6E, 0xFF677230, 0xFF788442, 0xFF64732E, 0xFF7F904A, 0xFF849853,
+0xFF8EA25B, 0xFF8C9953, 0xFF86934D, 0xFF778842, 0xFF94A561, 0xFF697837, 0xFF98A466, 0xFF919B5E,
+0xFF6C763A, 0xFF636C35, 0xFF7B7543, 0xFF815F39, 0xFF5B310B, 0xFF5C3B10, 0x04C43908, 0x54FF9051,
+0x05F09F8F, 0x935C0CF1, 0x8B54FF98, 0x7A44FF92, 0x5728FF93, 0x2B00FF94, 0x451DFF7F, 0x6237FFAB,
+0xF00024B1, 0x857E4A6A, 0x743E24FF, 0x4D0F00FF, 0x3F1900FF, 0xA4904BFF, 0xA19527FF, 0xC9C03DFF,
+0xD8D14CFF, 0x8C8A13FF, 0x878935FF, 0x959C59FF, 0x879653FF, 0x7D8D4CFF, 0x758544FF, 0x788744FF,
+0x909B59FF, 0x949D5CFF, 0x8E9955FF, 0x818C47FF, 0x849149FF, 0x91A15AFF, 0x788649FF, 0x808E51FF,
+0x899A56FF, 0x8C9D56FF, 0x889952FF, 0x879651FF, 0x909D58FF, 0x8E9B56FF, 0x919E58FF, 0x04C051FF,
+0x8F9F0BF1, 0x91A158FF, 0x8F9F58FF, 0x889752FF, 0x93A05BFF, 0x97A361FF, 0x788341FF, 0x447104B0,
+0x47FF7781, 0x00787985, 0x8B4598F1, 0x8039FF7A, 0x8D48FF6C, 0x9A55FF78, 0x914EFF85, 0x803BFF7C,
+0x843DFF6B, 0x8E47FF70, 0x9349FF7D, 0x7831FF81, 0x8540FF68, 0x9251FF76, 0x7D3CFF83, 0x9148FF6E,
+0xA557FF81, 0x974EFF94, 0x9147FF87, 0x833CFF7F, 0x8E48FF72, 0x833DFF7D, 0x8D47FF72, 0x9A55FF7C,
+0x833EFF8B, 0x6F2CFF74, 0x7A38FF60, 0x7D3DFF6E, 0x8545FF71, 0x783AFF79, 0x672BFF6C, 0x8B53FF5C,
+0x7842FF7E, 0x814BFF6B, 0x7C45FF74, 0x8C55FF6D, 0x6A30FF7D, 0x7239FF58, 0x6F36FF63, 0x7841FF60,
+0x7741FF69, 0x7844FF6A, 0x6633FF6E, 0x6131FF5E, 0xF10A905B, 0x7B7E5140, 0x515226FF, 0x5D5E32FF,
+0x59582CFF, 0x4D4F20FF, 0x686A39FF, 0x888C5AFF, 0x787F4CFF, 0x7B8350FF, 0x6E7843FF, 0x68723DFF,
+0x59632EFF, 0x68703FFF, 0x545C2DFF, 0x666C40FF, 0x898E65FF, 0x757750FF, 0x80825BFF, 0x7C695AFF,
+0x311E0FFF, 0x20002E10, 0x2210F136, 0x24FF4B34, 0x31FF4F39, 0x2AFF5E45, 0x25FF5842, 0x35FF5540,
+0x3DFF6653, 0x2EFF6E5E, 0x2A5C5E4F, 0x573624F1, 0x5232FF60, 0x4E2FFF58, 0x5131FF57, 0x6847FF5E,
+0x5031FF78, 0x4022FF67, 0x3E1FFF59, 0x482AFF55, 0x664BFF61, 0x4025FF81, 0x4026FF5A, 0x543BFF58,
+0x0028106E, 0x2CF11410, 0xFF7B5B42, 0xFF56381C, 0xFF9A7F61, 0xFF7E6747, 0xFF5D4A29, 0xFF6E5B3A,
+0xFF775C3E, 0xFF715436, 0xFF624326, 0xFF705335, 0xFF7D6647, 0xFF766241, 0xFF9D8869, 0xFF563D1E,
+0x9C7F5D42, 0x3034F127, 0x62FF6F4A, 0x23FFA07E, 0x20FF5B40, 0x29FF5740, 0x34FF6049, 0x36FF6D52,
+0x3CFF7455, 0x35FF7F5C, 0x4FFF7B54, 0x37FF986F, 0x31FF8057, 0x40FF7A51, 0x2DFF8B60, 0x2CFF784D,
+0x4AFF774C, 0x45FF956A, 0x00048C63, 0x7E573A71, 0x754E31FF, 0x00F1197C, 0xFF886A48, 0xFF6F6037,
+0xFF786A43, 0xAC2A1000, 0x4004F11C, 0x3EFF8460, 0x4EFF8261, 0x2EFF836F, 0x3BFF624F, 0x4D54785E,
+0x704E2131, 0x5F602124, 0x34FF665B, 0xF231DC1F, 0x6CFF0B1A, 0x78FF464C, 0x75FF454C, 0x72FF3D43,
+0x4FFF3D44, 0x27FF2429, 0x19FF070D, 0x11FF0106, 0x0EFF0000, 0x0EFF0001, 0x00040202, 0xFF0000E1,
+0xFF2F334C, 0xFF45496F, 0x103E426F, 0x496CB1AF, 0x4260FF45, 0x1E3BFF3D, 0xF15A3819, 0x36384D50,
+0x2D2F3EFF, 0x252831FF, 0x161719FF, 0x3D3B2FFF, 0x66583DFF, 0x9A8864FF, 0x8D7E57FF, 0x76643CFF,
+0x7D663CFF, 0xAB9367FF, 0x917C4FFF, 0x8B7D4EFF, 0x988E5DFF, 0x88814DFF, 0x766F3BFF, 0x89834FFF,
+0x7F7F49FF, 0xAFB47AFF, 0x798146FF, 0xA7AC72FF, 0x94975EFF, 0x777A41FF, 0x767E43FF, 0x12F00004,
+0xFF6B7038, 0xFF8E915A, 0xFF2F3100, 0xFF6C703D, 0xFF626A31, 0xFF737E42, 0xFF819355, 0xFF4D5F21,
+0xF002A83F, 0xFF778335, 0xFF6F7F40, 0xFF7F9252, 0xFF6B7D3F, 0xFF6C8043, 0xFF61793D, 0xFF677C41,
+0xFF68763B, 0xFF515C22, 0xFF7B8850, 0xFF8D9A64, 0xFF525B24, 0xFF818950, 0xFF7A8447, 0xFF7F894C,
+0xFF7B7F44, 0xFF7F8046, 0xA10D9C42, 0x54FF797D, 0x46FF878F, 0x080C7882, 0x622544F1, 0x5F21FF58,
+0x6123FF51, 0x4B13FF51, 0x612CFF3E, 0x9760FF57, 0x4E15FF8E, 0x5C1EFF45, 0x7536FF4C, 0x6121FF61,
+0x8949FF4B, 0x985EFF73, 0x581FFF86, 0x652EFF49, 0x844DFF54, 0x955AFF73, 0xB77BFF81, 0x6528FFA5,
+0x7436FF57, 0x6C2DFF68, 0x7F3DFF62, 0xF2037473, 0x677B330F, 0x778D45FF, 0x819852FF, 0x5D7332FF,
+0x788E4DFF, 0x708244FF, 0x8DA060FF, 0xC87C38FF, 0x42CAF003, 0x3CFF768A, 0x56FF6E84, 0x46FF859C,
+0x38FF7489, 0x5FFF6C78, 0x3EFF939F, 0x3CFF6B7E, 0x3AFF687D, 0x45FF677A, 0x62FF7583, 0x47FF979C,
+0x3EFF7E7D, 0x11FF736C, 0x00FF4E38, 0x00FF4316, 0x34FF4113, 0x33FF7A5A, 0x4AFF7361, 0x6EFF8C83,
+0x63FFADAF, 0x47FF9AA5, 0x44FF838F, 0x0CFF8F94, 0x45FF6458, 0x4BFFAB83, 0x1BFFC779, 0x23FFB73C,
+0x44FFB244, 0x51FF9F77, 0x14FF9882, 0x00FF642A, 0x08FF450B, 0x55FF5237, 0x19FFAB9F, 0x25FF9284,
+0x33FFAB9F, 0x0DFFB1AB, 0x19FF7674, 0x59FF6366, 0x55FF8F98, 0x3FFF8691, 0x4AFF6E7E, 0x4FFF7D8E,
+0x49FF8594, 0x67FF808B, 0x4CFFA0AB, 0x52FF8491, 0x67FF8999, 0x56FF9DAC, 0x47FF8A99, 0x3FFF7684,
+0x5BFF6F7D, 0x5DFF94A4, 0x56FF98A8, 0x16F004E0, 0x47FF8999, 0x43FF7D8C, 0x55FF7988, 0x53FF8C9C,
+0x51FF8B9D, 0x50FF8B9D, 0x6DFF8A9C, 0x49FFA5B7, 0x54FF7F90, 0xD109C499, 0x793AFF83, 0x7E3FFF70,
+0x9457FF75, 0x310A6C8A, 0x206D7C37, 0x4118F100, 0x4BFF7589, 0x47FF7F93, 0x49FF7A90, 0x46FF7B91,
+0x45FF798D, 0x5DFF798D, 0x39FF93A8, 0x41FF7385, 0x4AFF798B, 0x05A08091, 0x813D17F0, 0x944AFF70,
+0xA859FF82, 0x9D50FF95, 0x8A3FFF88, 0x964EFF75, 0xAE66FF82, 0x853EFF9A, 0x8F48FF71, 0x9D56FF7B,
+0x8AF105A0, 0xA965FF89, 0x9450FF98, 0x8743FF83, 0x8945FF76, 0x7D3CFF78, 0x8C4EFF6D, 0x6E37FF7C,
+0x410BFF5F, 0x7842FF30, 0x6A33FF67, 0x733CFF57, 0x9F66FF60, 0x6E33FF8A, 0x7035FF59, 0x652CFF5B,
+0x8048FF50, 0x753AFF6D, 0x551BFF61, 0x7A43FF43, 0x824DFF6B, 0x743FFF74, 0x7C48FF67, 0x642FFF72,
+0x723BFF5B, 0x6327FF69, 0x8347FF59, 0x743AFF78, 0x763EFF69, 0x7D44FF69, 0x7138FF6E, 0x7337FF62,
+0x672DFF61, 0x6530FF55, 0x6E3DFF57, 0x5025FF60, 0x5C32FF45, 0x6B42FF51, 0x734AFF63, 0xF12D546B,
+0x6554440C, 0x3D2C1AFF, 0x6C5B49FF, 0x412F1BFF, 0x705E48FF, 0x4D3B25FF, 0x45341AFF, 0x34A02950,
+0x26FF6154, 0x40FF5349, 0x112B5464, 0xF11A9055, 0x65624110, 0x4D4A29FF, 0x383210FF, 0x908766FF,
+0x554625FF, 0x8F7F5EFF, 0x4E3F1EFF, 0x655534FF, 0x1CF13CB8, 0xFF968365, 0xFF49381C, 0xFF443317,
+0xFF785E45, 0xFF62462E, 0xFF5D4328, 0xFF5B4627, 0xFF887555, 0xFF443413, 0xFF6D5D3C, 0x605A4727,
+0x6300F10A, 0x4FFF9B80, 0x33FF896B, 0x4AFF6A51, 0x21187C67, 0x5A3C70F1, 0x5132FF6D, 0x553AFF68,
+0x5539FF70, 0x553CFF73, 0x5336FF75, 0x492DFF6E, 0x492AFF61, 0x3918FF5E, 0x5131FF4D, 0x6543FF68,
+0x6E4BFF7D, 0x5B39FF88, 0x6744FF79, 0x5231FF89, 0x5430FF79, 0x6542FF7A, 0x3E1AFF8D, 0x4E2CFF64,
+0x6A47FF72, 0x5E3EFF8C, 0x7557FF81, 0x583DFF98, 0x785BFF7D, 0x6E4CFF9D, 0x623AFF8C, 0x6037FF7B,
+0x744DFF76, 0x4F30FF8A, 0x7657FF68, 0x5E39FF8F, 0x633DFF74, 0xF13ADC75, 0x655B3748, 0x6D643DFF,
+0x4E471DFF, 0x69643AFF, 0x727057FF, 0x2B2D39FF, 0x1F2441FF, 0x1C2340FF, 0x474D6FFF, 0x414874FF,
+0x3F4674FF, 0x1F2650FF, 0x141A3AFF, 0x1F2639FF, 0x1D232FFF, 0x1B1E27FF, 0x0C0C14FF, 0x05040CFF,
+0x00000CFF, 0x000010FF, 0x414562FF, 0x525582FF, 0x66310A30, 0xAA30393E, 0x405D01F0, 0x4B64FF37,
+0x2B40FF41, 0x0F1FFF23, 0x4B2CFF08, 0x313764F1, 0x191BFF2C, 0x3D34FF11, 0x6850FF3A, 0x3C1BFF6E,
+0x512DFF45, 0x5F37FF57, 0x683BFF64, 0x7F4FFF73, 0x7E4DFF8B, 0x6634FF88, 0x8F5CFF6C, 0x5725FF91,
+0x8452FF57, 0x7745FF84, 0x713DFF75, 0x6631FF6A, 0x8752FF5D, 0x7641FF7D, 0x612AFF6C, 0x723AFF58,
+0x783EFF67, 0x9F64FF6D, 0x5F23FF91, 0x864DFF54, 0x6532FF7D, 0x622FFF5E, 0x7D47FF5B, 0x753CFF76,
+0xB1001C6C, 0xFF5A682D, 0xFF6A733C, 0x30495219, 0x2B2FF000, 0x52FF5766, 0x2DFF7A8C, 0x28FF5265,
+0x0AFF4C5F, 0x4BFF3241, 0x47FF7D80, 0x3CFF797C, 0x2DFF6871, 0x56FF5663, 0x23FF848D, 0x1CFF535C,
+0x39FF4B56, 0x25FF6B75, 0x35FF5860, 0x3FFF6A6F, 0xF10A1479, 0x3EFF792E, 0x1CFF6D7B, 0x3DFF4A5A,
+0x49FF6B7B, 0x4AFF7587, 0x56FF748A, 0x3DFF8096, 0x23FF6478, 0x45FF4B5A, 0x69FF7280, 0x41FF97A7,
+0x46FF6D82, 0x56FF7187, 0x39FF7F98, 0x41FF6379, 0x0814697B, 0x5B260CF1, 0x6D38FF4E, 0x7F47FF63,
+0x8C53FF74, 0x955CFF83, 0x6125FF92, 0x682AFF5B, 0xF1038C5C, 0x6B7F3A3C, 0x829850FF, 0xB8CF87FF,
+0x607731FF, 0x708645FF, 0x526828FF, 0x798B4FFF, 0x7B8E4EFF, 0x7F934EFF, 0x738740FF, 0x778B44FF,
+0x819651FF, 0x798E4BFF, 0x637539FF, 0x67743EFF, 0x515E29FF, 0x6E7D42FF, 0x66783AFF, 0x879A5AFF,
+0x0AF009F8, 0xFF968E5D, 0xFF7D6740, 0xFF442506, 0xFF361300, 0xFF543811, 0xFF927D52, 0xF02BAC34,
+0xFF9B9755, 0xFF807E4E, 0xFF8E8E58, 0xFF8B8D4C, 0xFF858734, 0xFFFBF78B, 0xFFF1E97E, 0xFF8E8334,
+0xFF9C6D39, 0xFFCA583D, 0xFFAD351C, 0xFFA25E31, 0xFFC99A6E, 0xFF4C1200, 0xFF350500, 0xFF6E5829,
+0xFF9D8F46, 0xFFA58F2A, 0xFF9D8919, 0xFF7F760F, 0xFFA2A049, 0xFF8D8D4D, 0xFF828653, 0xFF838A56,
+0xFF788148, 0xF10E8051, 0xFF9BA61F, 0xFF949D5A, 0xFF8C9753, 0xFF81904B, 0xFF778844, 0xFF627130,
+0xFF849050, 0xFF899450, 0xFF89954B, 0xFF95A253, 0xFF9BA859, 0xCC939F55, 0x5E28F10A, 0x4DFF94A3,
+0x48FF8392, 0x5AFF7E8F, 0x47FF90A5, 0x6DFF7F94, 0x45FFA3B8, 0x29FF7B8C, 0x37FF5F6E, 0x36FF6B77,
+0x33FF6A72, 0x43FF696C, 0x38FF797C, 0x47FF6B75, 0x0B1C7B87, 0x8A4400F1, 0x7832FF7D, 0x9F59FF6B,
+0x7331FF92, 0xF109B067, 0x6F7B394C, 0x73803BFF, 0x808D47FF, 0x748139FF, 0x818E48FF, 0x71803BFF,
+0x8C9B58FF, 0x869554FF, 0x8E9F5BFF, 0x859650FF, 0x879854FF, 0x869753FF, 0x8D9D5CFF, 0x92A261FF,
+0x728241FF, 0x889857FF, 0x5E712FFF, 0x788B49FF, 0x657534FF, 0x8B9B5AFF, 0x99A968FF, 0x596928FF,
+0x647433FF, 0x30F1020C, 0xFF5C6B34, 0xFF36440F, 0xFF606F38, 0xFF60713A, 0xFF485B23, 0xFF6A7E43,
+0xFF677D3F, 0xFF5F7535, 0xFF607638, 0xFF61793B, 0xFF506928, 0xFF6A8342, 0xFF7C9254, 0xFF74894E,
+0xFF697D40, 0x9464783B, 0x4A2DF007, 0x1FFF7589, 0x57FF4D62, 0x1EFF879C, 0x49FF4A5F, 0x5BFF7488,
+0x2DFF8196, 0x28FF5368, 0x2BFF5367, 0x39FF5468, 0x3BFF5F70, 0x34FF5C6C, 0x2FFF5360, 0x42FF4D5A,
+0x45FF616C, 0x44FF6570, 0x3623B12F, 0x4734FF43, 0x3B25FF54, 0x71351447, 0xFF473821, 0xE444361C,
+0x2520F123, 0x2FFF4F46, 0x4FFF5B53, 0x13FF7973, 0x3DFF3C38, 0x30FF6360, 0x5FFF5653, 0x20FF8181,
+0x1AFF4242, 0x58FF3B3C, 0x31FF7C7C, 0x34FF5953, 0x572C6058, 0xF1000800, 0x7469491C, 0x7C7151FF,
+0x3F3617FF, 0x413618FF, 0x655438FF, 0x604C31FF, 0x5E4F32FF, 0x675A3AFF, 0x8B8060FF, 0x665C39FF,
+0x706343FF, 0x48004450, 0x7054B10F, 0x5D41FF88, 0x4225FF75, 0x31481857, 0x105A4B2C, 0x2424002E,
+0x6A5538B1, 0x634B2FFF, 0x897155FF, 0xE80024C8, 0x2504F156, 0x5DFF5646, 0x39FF8E7E, 0x26FF6D5A,
+0x2EFF5A4A, 0x3A986654, 0x5B3614F1, 0x502CFF75, 0x6B45FF6E, 0x6845FF8B, 0x6C48FF89, 0x5F3AFF8A,
+0x6844FF79, 0x4221FF80, 0x583AFF5C, 0x71198873, 0xFF98795C, 0xC0927C57, 0x09540027, 0x2025BC00,
+0x2AEC8964, 0xFF5A08F0, 0xFF514922, 0xFF78734B, 0xFF706843, 0xFF9C9771, 0xFF96946D, 0xF190C00A,
+0xFF5D642F, 0xFF586257, 0xFF282F41, 0xFF191F41, 0xFF222848, 0xFF454B6D, 0xFF42476F, 0xFF2D355C,
+0xFF242A4E, 0xFF2C334F, 0xFF303548, 0xFF202430, 0xFF191923, 0xFF1C1C24, 0xFF1D1C24, 0xC81D1D27,
+0x4E6BB19F, 0x5986FF4A, 0x4675FF56, 0xF1BE2442, 0x30365608, 0x222C47FF, 0x1B223CFF, 0x050B21FF,
+0x080D20FF, 0x2F333FFF, 0x60F186F8, 0xFF040C0E, 0xFF090F05, 0xFF7D7B62, 0xFF54512E, 0xFF555732,
+0xFF676840, 0xFFA8A57A, 0xFF8A8657, 0xFF727040, 0xFF80804E, 0xFF5D5F2E, 0xFF777B49, 0xFF8B8E5F,
+0xFF4E5424, 0xFF7A8253, 0xFF565F30, 0xFF434F1F, 0xFF74804E, 0xFF798651, 0xFF55622C, 0xFF6C7B42,
+0xFF7F8E55, 0xFF68773C, 0xFF606D35, 0xFF8F9967, 0xFF7B8352, 0xFF414A15, 0x10505922, 0x8953B104,
+0x7440FF7C, 0x5F2AFF6A, 0xF00EDC55, 0x626D3506, 0x66733DFF, 0x6F7D48FF, 0x778552FF, 0x485220FF,
+0x496C35FF, 0x58747721, 0x3948F105, 0x87FF6671, 0x2CFFB4BF, 0x15FF5A63, 0x13FF434C, 0x23FF414A,
+0x28FF5259, 0x4AFF5961, 0x36FF7D85, 0x36FF6772, 0x36FF6474, 0x3CFF6274, 0x20FF687A, 0x41FF4B5F,
+0x2DFF6B81, 0x49FF556B, 0x59FF7183, 0x39FF8594, 0x28FF6876, 0x3BFF5767, 0x38FF677C, 0x50FF657C,
+0x05247992, 0x955B28F1, 0x6C36FF83, 0x915CFF5F, 0x7641FF87, 0x8049FF6D, 0x884FFF77, 0x844BFF80,
+0xA46BFF83, 0x6F33FFA1, 0xA668FF64, 0x9D5BFF94, 0x813CFF8A, 0x8C47FF6D, 0xA461FF77, 0xF103048F,
+0x7F915500, 0x56682CFF, 0x425416FF, 0x80904FFF, 0xA8010954, 0x9499F003, 0x9557FF84, 0x773EFF85,
+0x4F1DFF68, 0x5325FF45, 0x5828FF4D, 0x7744FF59, 0x7E47FF7A, 0x7544FF81, 0x714DFF83, 0x391DFF95,
+0x1500FF68, 0x4D2FFF47, 0x5428FF76, 0x713EFF65, 0x8153FF74, 0x6A3EFF82, 0x6F45FF69, 0x7949FF6E,
+0x7B3DFF7A, 0xD483FF81, 0xD267FFDC, 0xDE75FFE0, 0xAF61FFEB, 0x5F29FFB5, 0x4F32FF82, 0x4229FFB7,
+0x744EFFB6, 0x724DFFC2, 0x0B00FFAC, 0x0600FF44, 0x804FFF33, 0x8139FF90, 0x9E43FF89, 0x9431FFB3,
+0x6206FFAA, 0x9443FF6D, 0x9456FF99, 0xA26DFF94, 0x804DFF9F, 0x9358FF7C, 0xA965FF8B, 0x484AFF9E,
+0x863FF113, 0x8B4DFF81, 0x8E4CFF85, 0x8C49FF82, 0x4F13FF7D, 0xC386FF44, 0x9954FFB9, 0x8D41FF8E,
+0xA85CFF81, 0xAA61FF9D, 0x924DFFA0, 0x9A56FF87, 0xAF6FFF8F, 0x8947FFA3, 0x843DFF7D, 0x974DFF74,
+0x742AFF85, 0x9B51FF62, 0x7B36FF89, 0x7E3CFF6C, 0x000B9C72, 0x48710060, 0x3AFF7C7F, 0x10D46D72,
+0x804408F1, 0x8D4DFF75, 0x7533FF81, 0x7F3CFF6A, 0x7E3BFF76, 0x8B4AFF75, 0xB10A2482, 0xFF7F8849,
+0xFF737E3C, 0x5486914D, 0x6024F10F, 0x4DFF98A5, 0x48FF8190, 0x50FF7A89, 0x58FF808E, 0x43FF8A99,
+0x62FF7584, 0x4BFF94A3, 0x47FF7D8C, 0x60FF7988, 0x5AFF92A1, 0x45FF8C9B, 0x39FF7786, 0x04FC6A7A,
+0xF014A400, 0x73823F12, 0x849350FF, 0x697833FF, 0x7E8D48FF, 0x728140FF, 0x7C8B50FF, 0x707F46FF,
+0x849358FF, 0x0F6057FF, 0xDC596B21, 0x360CF104, 0x44FF6277, 0x47FF7188, 0x1BFF7187, 0x36FF455B,
+0x3CFF6177, 0x64FF657E, 0x05148EA4, 0x66283CF1, 0x7A3AFF50, 0x894BFF64, 0x8B4AFF73, 0x833FFF72,
+0x8C48FF6A, 0x6C2BFF73, 0x6022FF56, 0x5C21FF4A, 0x652AFF47, 0x7B3DFF50, 0x7437FF65, 0x662EFF60,
+0x430FFF53, 0x5C2FFF32, 0x572CFF4C, 0x784CFF48, 0x4A1CFF6B, 0x2E18FF3D, 0x0048F834, 0x00004C2C,
+0x43A80044, 0x713EC800, 0xFF4A4326, 0xEC645E3E, 0x362AF009, 0x39FF5F5B, 0x20FF625E, 0x1BFF4947,
+0x2DFF4341, 0x1AFF5151, 0x47FF3C3C, 0x12FF6869, 0x3EFF2F37, 0x3DFF5B63, 0x26FF6062, 0x46FF4A4A,
+0x52FF6C6C, 0x46FF7878, 0x27FF6E6C, 0x48A15268, 0x4421FF48, 0x5435FF47, 0xF15D685D, 0x4B462604,
+0x474423FF, 0x6A6A48FF, 0x716E4BFF, 0x565030FF, 0x01F00528, 0xFF68593C, 0xFF67563A, 0xFF9C8B6F,
+0xFF4E3F22, 0x0CF134B8, 0xFF534828, 0xFF605633, 0xFF4E4421, 0xFFA59876, 0xFF413412, 0xFF6D603E,
+0x88756845, 0x67437138, 0x7755FF6F, 0x50001084, 0xFF716743, 0xF16CEC31, 0xFF716357, 0xFF71623B,
+0xFF6B5732, 0xFFA69069, 0xFFA58F6A, 0xFF75613C, 0xFFA0906C, 0xFF7A6C49, 0xFF493918, 0xFF342403,
+0xFF5A4226, 0xFF897658, 0xFF584E2B, 0xFF67633D, 0xFF4A481F, 0xFF55582D, 0xFF7E8559, 0xFF525D32,
+0xFF59613A, 0xFF3D411C, 0xFF696540, 0xFF8B8561, 0xFF373310, 0xFF2A2811, 0xFF5A5C57, 0xB82B2F3B,
+0x9FD000C2, 0x2A4B08F1, 0x4767FF27, 0x4164FF42, 0x2F4FFF3D, 0x3653FF29, 0x324AFF31, 0x0068FC2C,
+0x369095F8, 0x3CFF2726, 0x30FF302E, 0x0E216A58, 0xF00F100E, 0x5A5E7901, 0x50557BFF, 0x333860FF,
+0x1E2343FF, 0xF01DFCFF, 0x1A203A4E, 0x181C37FF, 0x10112DFF, 0x32324AFF, 0x2A273CFF, 0x12101DFF,
+0x111214FF, 0x000200FF, 0x928F6EFF, 0xA6A47BFF, 0x84865EFF, 0x777952FF, 0x6E6A47FF, 0x3E3A15FF,
+0x67683EFF, 0x494C1FFF, 0x65683DFF, 0x9DA075FF, 0x63693DFF, 0x6A7145FF, 0x848A5EFF, 0x5F663AFF,
+0x767D51FF, 0x12406EFF, 0x798553F1, 0x808E5BFF, 0x56632EFF, 0x6D7B46FF, 0x47561FFF, 0x4D5B26FF,
+0x72804FFF, 0x2E3A0AFF, 0x59632FFF, 0x58622DFF, 0x5E6B36FF, 0x52632FFF, 0x819361FF, 0x435420FF,
+0x58602DFF, 0x505724FF, 0x888E5EFF, 0x4E5627FF, 0x4D592BFF, 0x616D3DFF, 0x64713CFF, 0x75824AFF,
+0x636E34FF, 0x6C773DFF, 0x7E8951FF, 0x08F20A70, 0xFF818854, 0xFF7A7E4B, 0xFF636734, 0xFF838A54,
+0xFF586027, 0x18495317, 0x7E8AE10F, 0x5E6C2FFF, 0x758547FF, 0x67753AFF, 0x0CF10A6C, 0xFF596428,
+0xFF7F8A4E, 0xFF8F995C, 0xFFA2AC6F, 0xFF6C7A3C, 0xFF809051, 0xBC647638, 0x0F68000E, 0xF1122400,
+0x737E4610, 0x3F4C14FF, 0x88955DFF, 0x616E36FF, 0x616930FF, 0x8A935AFF, 0x66733BFF, 0x718047FF,
+0x65B109C0, 0x43FF93A3, 0x46FF7280, 0x18BC7583, 0x79874C71, 0x77854AFF, 0x40600D68, 0x42FF6F7D,
+0x11277880, 0xF10E646D, 0x8A955B20, 0x777E48FF, 0x6E703FFF, 0x71653BFF, 0x6B4D2BFF, 0x835838FF,
+0xA97F59FF, 0x8C5634FF, 0x661504FF, 0x661305FF, 0x83432AFF, 0x89613EFF, 0x60F11EE8, 0xFF979765,
+0xFF716E43, 0xFF47441B, 0xFF6A6841, 0xFF5C5829, 0xFFD5C68F, 0xFFA6914E, 0xFF786113, 0xFF836C20,
+0xFF7D692A, 0xFF9B713F, 0xFFB25A36, 0xFFBB593C, 0xFF9E593A, 0xFF733B20, 0xFF571E0B, 0xFF3E1400,
+0xFF867C4B, 0xFF999A56, 0xFFA29747, 0xFF655500, 0xFF5B4C00, 0xFF857D2C, 0xFF7C7B38, 0xFFACB272,
+0xFF8C9556, 0xFF899452, 0xF09AA560, 0x5F0CF118, 0x68FF9897, 0x62FFA09D, 0x39FF9B9F, 0x2DFF6F78,
+0x5FFF6169, 0x59FF929C, 0x13F08F9B, 0x672250F1, 0xA05EFF5A, 0x8E51FF94, 0x6D31FF84, 0x8D52FF63,
+0x773BFF85, 0xA25FFF71, 0x8E47FF99, 0x934CFF84, 0x934EFF89, 0x9856FF88, 0x7A3BFF8D, 0xA467FF70,
+0x9458FF9A, 0xA266FF8A, 0x9155FF9A, 0x6732FF87, 0x925DFF5A, 0x6D33FF85, 0x783BFF62, 0x9655FF6E,
+0x8645FF8D, 0x9958FF7D, 0x8140FF90, 0xF104FC78, 0x87925028, 0x7E8945FF, 0x7F8C47FF, 0x899855FF,
+0x6B7B3AFF, 0x6A793EFF, 0x889659FF, 0x7F8B4BFF, 0x929D59FF, 0x747F3BFF, 0x798440FF, 0x616C27FF,
+0x909B56FF, 0x838E49FF, 0x36600078, 0x4FFF707B, 0xF0058094, 0x33FF7044, 0x60FF6F7B, 0x43FF9BA8,
+0x45FF808E, 0x45FF8492, 0x29FF7E8E, 0x49FF5A6A, 0x61FF7689, 0x31FF90A3, 0x39FF6073, 0x57FF6679,
+0x71FF8497, 0x51FFA4B8, 0x2AFF8498, 0x1FFF576A, 0x4EFF4C5F, 0x44FF7D90, 0x28FF7386, 0x3FFF5463,
+0x27FF6B7A, 0x40FF5362, 0x16F005D4, 0x51FF6377, 0x43FF778C, 0x3AFF6B81, 0x42FF6278, 0x2DFF697D,
+0x2AFF5468, 0x41FF4F62, 0x26FF6679, 0x3FFF4B5E, 0xF01E5C77, 0x3AFF5010, 0x2DFF5C6E, 0x38FF4D5F,
+0x28FF5668, 0x29FF4658, 0x28FF495B, 0x2BFF4341, 0x44FF4644, 0x0BF156A8, 0x2AFF4844, 0x36FF4945,
+0x44FF5753, 0x26FF6865, 0x3AFF4C49, 0x4BFF6260, 0x00047472, 0x573018F1, 0x5F39FF59, 0x2E08FF5F,
+0x6440FF2E, 0x5836FF64, 0x3613FF57, 0x4623FF2C, 0x401DFF3C, 0x1E00FF3C, 0x7E57FF1C, 0xF103A07C,
+0x6A6A4420, 0x4D4F28FF, 0x4D512CFF, 0x6A6E49FF, 0x4B4827FF, 0x6A6746FF, 0x353415FF, 0x444827FF,
+0x696F4DFF, 0x2E320FFF, 0x5A5736FF, 0x746E4EFF, 0x28F165C8, 0xFF847B5C, 0xFF837A5B, 0xFF52492A,
+0xFF67613F, 0xFF655F3B, 0xFF756F4B, 0xFF817D58, 0xFF504C27, 0xFF716D47, 0xFF635F39, 0xFF828057,
+0xFF6C6D43, 0xFF8C8A63, 0x046C6843, 0x2B5BF21A, 0x56FF5450, 0x4CFF807A, 0x23FF7971, 0x1EFF524A,
+0x3CFF5044, 0x2AFF6E62, 0x3EFF5A51, 0x4AFF6D65, 0x36FF746E, 0x48FF605A, 0x53FF6E68, 0x79FF7B72,
+0x57FFA095, 0x5DFF7D74, 0x3CFF817E, 0x12FF5F61, 0x00FF3139, 0x26FF1D2A, 0x3DFF4357, 0x63FF5A6E,
+0x25FF7D8C, 0x06FF424A, 0x20FF2C2C, 0x00FF4643, 0x09FF1514, 0x50FF1617, 0x0054BC42, 0x5740BDC0,
+0xE0FF3336, 0x345531A4, 0x623BEC31, 0xFF383D5A, 0x9AE4334D, 0x311DF400, 0xC42C2D41, 0x1910F131,
+0x0EFF0E0C, 0x0FFF0503, 0x1AFF0303, 0x7CFF0708, 0x68FF5D61, 0x5EFF3D42, 0x63FF3136, 0x1E283E43,
+0x00A02400, 0x18F16E34, 0xFF464660, 0xFF3B3750, 0xFF0A051B, 0xFF0B0716, 0xFF090A0E, 0xFF0B0D00,
+0xFF696947, 0xFF6A6B3F, 0xFF50572D, 0x946F754F, 0x56C4F158, 0x09FF7A77, 0x13FF2C31, 0x4FFF373C,
+0x2BFF7577, 0x72FF5157, 0x20FF969F, 0x03FF444D, 0x1EFF2932, 0x66FF444D, 0x41FF8E98, 0x3CFF6773,
+0x4FFF616F, 0x9AFF7482, 0x4AFFC0CC, 0x21FF707C, 0x25FF4654, 0x3FFF4A58, 0x4AFF6070, 0x2EFF6F7D,
+0x20FF5764, 0x19FF4D58, 0x64FF424F, 0x2CFF8798, 0x39FF4960, 0x1DFF5A6E, 0x27FF4751, 0x35FF545B,
+0x30FF5E66, 0x30FF5862, 0x1CFF525E, 0x2AFF3F4D, 0x31FF5261, 0x24FF5D6C, 0x5DFF5361, 0x44FF8E99,
+0x24FF6F7C, 0x2FFF4F59, 0x30FF5D61, 0x4DFF5E62, 0x41FF7980, 0x51FF6E75, 0x4EFF818A, 0x46FF808A,
+0x2DFF7A82, 0x2FFF606A, 0x3DFF5F6D, 0x29FF6C7A, 0x1EFF5863, 0x3EFF4E57, 0x41FF717B, 0x59FF747E,
+0x5DFF8D95, 0x18F89199, 0x6F7A3E71, 0x677739FF, 0x5110081C, 0x03F11300, 0x53FF96A1, 0x5EFF828D,
+0x1AFF8996, 0x57FF4254, 0x05088190, 0xAC743AF0, 0xA06AFFA1, 0x9E67FF93, 0x703AFF8F, 0x6934FF63,
+0x7B43FF5F, 0x8E57FF70, 0x844AFF85, 0x642AFF79, 0x7B40FF59, 0x6C31FF6D, 0x662BFF5E, 0x894EFF58,
+0x5F27FF7B, 0x864FFF54, 0x7B45FF7D, 0x7B48FF74, 0x7846FF77, 0xE42AFF76, 0x9168D06E, 0x854D32FF,
+0xFDC39EFF, 0xF06344FF, 0xC826F149, 0xEE9B8DFF, 0x9F664BFF, 0x705029FF, 0x908557FF, 0x6F6F3DFF,
+0x9F9B6CFF, 0x7F7B4EFF, 0x6B683DFF, 0x4A4616FF, 0x7A6B34FF, 0x826D34FF, 0x8D773EFF, 0x957E48FF,
+0x2FF00EE0, 0xFF856036, 0xFFA5613A, 0xFF994E2E, 0xFF9B6245, 0xFF471700, 0xFF764630, 0xFF4D2A0C,
+0xFF948E5A, 0xFF858745, 0xFF807728, 0xFF6F600B, 0xFF82741C, 0xFF9E9643, 0xFF8B8B43, 0xFF626926,
+0x135C8646, 0x1DB87C11, 0x6B2D1CF1, 0x6734FF65, 0xA371FF6A, 0x945AFFA9, 0x7A3AFF93, 0x8E50FF74,
+0x975BFF88, 0xA163FF8F, 0x8C4EFF95, 0x9759FF7E, 0x6529FF8B, 0xF109C85A, 0x8C945B10, 0x535820FF,
+0x7C8246FF, 0x929956FF, 0x8B924EFF, 0xA0A763FF, 0x7D8643FF, 0x80884CFF, 0x5C401098, 0x04FF8C95,
+0x874B5000, 0x944BFF7D, 0x717BE11D, 0x7A8450FF, 0x747D46FF, 0x646C31FF, 0x5CB10580, 0x25FF929B,
+0x31FF5B64, 0x1DCC656D, 0x838D4EB1, 0x7E8A48FF, 0x8D9957FF, 0x60F10F28, 0xFF99A867, 0xFF939E62,
+0xFF9FAA6E, 0xFF818B4C, 0xFF6D7834, 0xFF6A7330, 0xFF919B56, 0xFF6B7530, 0xFF737D36, 0xFF6E7833,
+0xFF727C37, 0xFF828C47, 0xFF8F9954, 0xFF818B44, 0xFF929E56, 0xFF97A359, 0xFF859147, 0xFF889448,
+0xFF77853A, 0xFF677832, 0xFF91A560, 0xFF899D58, 0xFF627631, 0xFF546423, 0xFF9AAA69, 0xFF85964F,
+0xFF61722B, 0x14728243, 0x0A2C0007, 0x000A5C00, 0x14F11B00, 0xFF5C6A2F, 0xFF647237, 0xFF556429,
+0xFF788A50, 0xFF485A20, 0xFF75874D, 0xFF586932, 0xFF586730, 0xE0718049, 0x5270F107, 0x39FF7987,
+0x32FF606E, 0x50FF5566, 0x59FF7384, 0x21FF7B8D, 0x23FF4355, 0x2BFF4458, 0x36FF4A5E, 0x30FF5569,
+0x20FF4C4C, 0x2FFF3C3C, 0x31FF4B4B, 0x2BFF4D4D, 0x2CFF494A, 0x22FF4B4C, 0x3FFF4444, 0x3CFF6363,
+0x5CFF6262, 0x31FF8384, 0x3BFF5859, 0x42FF6263, 0x32FF6A68, 0x2CFF5A58, 0x4DFF524F, 0x25FF6F6F,
+0x24FF4047, 0x1CFF3F46, 0x56FF3B3F, 0x24FF797B, 0x2FFF494B, 0x44FF5456, 0x00086B6C, 0x482248F1,
+0x5A35FF42, 0x4E2CFF56, 0x4C2DFF4E, 0x4122FF4D, 0x6F4FFF40, 0x5735FF6A, 0x5F3DFF4D, 0x3D1DFF58,
+0x5132FF3C, 0x5637FF52, 0x5839FF57, 0x5735FF59, 0x6442FF57, 0x704CFF64, 0x542EFF70, 0x4620FF54,
+0x825AFF46, 0x5E35FF80, 0x4B1FFF59, 0xBE8FFF45, 0x4213FFB6, 0xF00DDC39, 0x737A4E2A, 0x6B6F4AFF,
+0x4D4E2EFF, 0x3B3B19FF, 0x7C7958FF, 0x736F4CFF, 0x7F7D57FF, 0x585630FF, 0x999A72FF, 0x696B44FF,
+0x62673FFF, 0x535432FF, 0x7A7B59FF, 0x2D2C0EFF, 0x6E2416FF, 0x373737F1, 0x555436FF, 0x585536FF,
+0x464526FF, 0x36401DFF, 0x516238FF, 0x415524FF, 0x4C5E2EFF, 0x485328FF, 0x485027FF, 0x434A20FF,
+0x373D19FF, 0x434831FF, 0x242925FF, 0x3C4155FF, 0x313656FF, 0x2D3653FF, 0x2C3350FF, 0x04F1A9DC,
+0xFF2F2F51, 0xFF2A2B4A, 0xFF303352, 0xFF2F3350, 0xCC2D314A, 0x021150C2, 0x000AFF00, 0x080DF019,
+0x0107FF09, 0x010BFF02, 0x0A1DFF01, 0x5876FF07, 0x446CFF53, 0x436DFF3F, 0x0456FF3C, 0x2C17F1BE,
+0x3D55FF27, 0x4456FF37, 0x1B2AFF3D, 0x0616FF18, 0x091AFF07, 0x0A18FF0D, 0x040CFF0E, 0x160FFF04,
+0x7354FF13, 0xF1010072, 0x4A552A4C, 0x4E592FFF, 0x767A55FF, 0x434520FF, 0x333810FF, 0x73784FFF,
+0x61633BFF, 0x505628FF, 0x606E3BFF, 0x455620FF, 0x95A66FFF, 0x7C8E54FF, 0x5A6C32FF, 0x607238FF,
+0x74884DFF, 0x70814AFF, 0x68723EFF, 0x606837FF, 0x6F7947FF, 0x697543FF, 0x404E1BFF, 0x8E9D66FF,
+0xA4B277FF, 0x0CF11414, 0xFF505B21, 0xFF63723B, 0xFF5A7139, 0xFF61763E, 0xFF536028, 0xFF7F8A50,
+0x8062713A, 0x05440018, 0x4E190CF1, 0x4208FF41, 0x7E40FF37, 0x6325FF72, 0xA769FF57, 0x6025FF99,
+0x4E18FF51, 0xF11BA041, 0xA3A97914, 0x626A39FF, 0x858F5AFF, 0x88965BFF, 0x556123FF, 0x636D2EFF,
+0x808C4CFF, 0x506021FF, 0x5A6A2CFF, 0x3E710A38, 0x56FF6E77, 0x12808894, 0x828A4EB1, 0x8C9459FF,
+0x5A632AFF, 0x41B104BC, 0x42FF707B, 0x3DFF717C, 0x19B06E76, 0x6C3028F1, 0xC489FF61, 0x5E24FFB6,
+0x7C42FF4C, 0xA16CFF6A, 0x9762FF93, 0x935EFF8A, 0x723DFF85, 0x5826FF65, 0x7544FF4E, 0x925FFF6D,
+0x632FFF8B, 0x652CFF5C, 0x985CFF5C, 0xF11D248D, 0x5A692E30, 0x5D6C33FF, 0x54632CFF, 0x596631FF,
+0x555D2AFF, 0x676E3AFF, 0x8F9662FF, 0x7B8550FF, 0x6C6A39FF, 0x745831FF, 0x855932FF, 0x9E6C3BFF,
+0xE1AB7DFF, 0xFFCAAFFF, 0xFFDFC8FF, 0xC5A481FF, 0x60F13530, 0xFF585022, 0xFF746E3E, 0xFF817B49,
+0xFF7A7440, 0xFF807D48, 0xFF6C6932, 0xFF7B743D, 0xFF867F49, 0xFF82774A, 0xFF9E916E, 0xFF978A6A,
+0xFF6B5434, 0xFFBC956E, 0xFF9B6B45, 0xFFAD8063, 0xFF6A4228, 0xFF7B5C3F, 0xFF705D35, 0xFF9F9C65,
+0xFF6E6B24, 0xFF8B7B23, 0xFFB4A03F, 0xFFADA13F, 0xFF8E892E, 0xFF8C8E45, 0xFF898D50, 0xFFACAF7A,
+0x3C80854F, 0x510CF110, 0x5EFF8489, 0x71FF9491, 0x66FFA9A6, 0x3BFF9EA4, 0x2AFF727D, 0x4BFF646D,
+0x0628818A, 0x40012400, 0xFF687138, 0x02F00004, 0xFF828A51, 0xFF767E45, 0xFF81894D, 0xFF747D3E,
+0x2128D45B, 0x143C8A95, 0x00066400, 0x34F115A0, 0xFF69713E, 0xFF777F4E, 0xFF5A622F, 0xFF969D67,
+0xFF8D925C, 0xFF5B5F2C, 0xFF5C612B, 0xFF676A31, 0xFF676B30, 0xFF787C41, 0xFF8A9054, 0xFF747C43,
+0xFF474E18, 0xFF8D965F, 0xFF5E672E, 0xFF5E682B, 0x18566021, 0x5404F10F, 0x42FF8C95, 0x3BFF7C82,
+0x45FF757B, 0x31FF7C87, 0x1EA06976, 0x001EA400, 0x2CF1292C, 0xFF808B46, 0xFF75803C, 0xFF7A8541,
+0xFF828D49, 0xFF96A15D, 0xFF7C8743, 0xFF919E59, 0xFFA5B26C, 0xFF73803A, 0xFF6F7C34, 0xFF697630,
+0xFF505C1A, 0xFF798543, 0xFF8B9755, 0x0C6C7836, 0x1E200002, 0x63702A31, 0x31710028, 0x25FF636F,
+0x1FD85563, 0x793508F1, 0x7032FF68, 0x6F33FF60, 0x6529FF5D, 0x8345FF53, 0x6A2FFF71, 0x31027C5B,
+0xA4314009, 0x6832B102, 0x561EFF5B, 0x5E26FF49, 0xF11E0053, 0x4A562410, 0x626E3CFF, 0x515F2CFF,
+0x41521EFF, 0x4A5D26FF, 0x495C25FF, 0x546833FF, 0x5F7340FF, 0x20F104F8, 0xFF3E3E22, 0xFF525236,
+0xFF393C1F, 0xFF464A29, 0xFF5C603D, 0xFF5A5B39, 0xFF4B4B27, 0xFF868662, 0xFF595933, 0xFF626039,
+0xFF40401A, 0xBC5F5C39, 0x3804F10E, 0x0FFF5A5A, 0x28FF3031, 0x08FF4447, 0x6FFF2427, 0x08948E8F,
+0x3D1870F1, 0x764FFF3B, 0x4E27FF74, 0x4018FF4C, 0x825CFF3B, 0x4725FF7C, 0x6445FF41, 0x492DFF63,
+0x6B4EFF49, 0x593EFF68, 0x2004FF55, 0x3115FF1A, 0x6D50FF2B, 0x6C4DFF6A, 0x3314FF6B, 0x2F10FF30,
+0x6140FF2C, 0x4825FF5D, 0x6540FF44, 0x4119FF61, 0x7047FF3C, 0x6F43FF6B, 0x3A10FF68, 0x6439FF33,
+0x7046FF5B, 0x8A60FF65, 0x7349FF7F, 0x4720FF68, 0x7C5BFF3F, 0x3515FF75, 0x2D0EFF30, 0x3516FF2C,
+0xF162D436, 0x5858341C, 0x70724BFF, 0x484F26FF, 0x434925FF, 0x5B613FFF, 0x505634FF, 0x474B2AFF,
+0x363A19FF, 0x313415FF, 0x282D0FFF, 0x454829FF, 0x24F10030, 0xFF7B7B59, 0xFF37411C, 0xFF64754B,
+0xFF66774B, 0xFF455528, 0xFF4C5528, 0xFF394215, 0xFF414C21, 0xFF687450, 0xFF3C4736, 0xFF3A4446,
+0xFF363C56, 0xFC313558, 0x4E15F004, 0x4EFF2C31, 0x48FF2E2F, 0x40FF2A29, 0x36FF2122, 0x33FF191A,
+0x1EFF181A, 0x15FF0709, 0x13FF0203, 0xBCFF0707, 0x050A3181, 0xF04FC406, 0x00010802, 0x515368FF,
+0x474C6AFF, 0x3E436BFF, 0x2D0860FF, 0x373B03F1, 0x414664FF, 0x2D3349FF, 0x050B1BFF, 0x050915FF,
+0x1C20912C, 0xF04B1C0E, 0x12FF0635, 0x11FF0406, 0x2AFF1217, 0x52FF454A, 0x34FF7981, 0x42FF5765,
+0x55FF6370, 0x30FF7780, 0x53FF535A, 0x4EFF767D, 0x3CFF747A, 0x22FF6467, 0x6DFF4B53, 0x45FF94A2,
+0x0FFF6D7F, 0x36FF3749, 0x51FF6072, 0x912B1C8D, 0x5116FF6C, 0x7137FF3D, 0xF009245F, 0x454C190A,
+0x717948FF, 0x394311FF, 0x4A5722FF, 0x7A8950FF, 0x849255FF, 0x072C30FF, 0x636E1FF1, 0x435219FF,
+0x5E733BFF, 0x73884FFF, 0x637237FF, 0x586629FF, 0x55642BFF, 0x6A7B44FF, 0x62703DFF, 0x3E4B16FF,
+0x646D34FF, 0x576124FF, 0x20F1232C, 0xFF5C6A2D, 0xFF8D9C61, 0xFF6C7941, 0xFF3E4613, 0xFF6D7343,
+0xFF4B5523, 0xFF6C7644, 0xFF6C7944, 0xFF6F7A40, 0xFF8B9556, 0xFF95A15F, 0x68748342, 0x04D00000,
+0x6C2F24F1, 0x8242FF62, 0x7C3AFF76, 0x9C60FF70, 0x975EFF94, 0x7F48FF8F, 0x5924FF76, 0x9B66FF50,
+0x8651FF91, 0x743BFF7D, 0x6F36FF6C, 0x8D54FF67, 0x8E56FF84, 0x310FB481, 0xCC4A5B27, 0x6B38310A,
+0xF102DC5D, 0x4D592708, 0x4C5425FF, 0x7A8052FF, 0x646836FF, 0x5C602DFF, 0x787F49FF, 0x000019E0,
+0x7136710A, 0x440DFF63, 0xF1216435, 0x99A36F2C, 0x535B28FF, 0x49501DFF, 0x6B7340FF, 0x697640FF,
+0x838852FF, 0x736236FF, 0x8C7041FF, 0x94733DFF, 0xC5A46FFF, 0x6C4E28FF, 0xA08864FF, 0x908156FF,
+0x898152FF, 0x7E7647FF, 0x00F136E0, 0xFF7A753E, 0xFF77723A, 0xFF918C54, 0x5C8B8950, 0x1A78002C,
+0x542B50F1, 0x9471FF56, 0x9E7EFF98, 0x5330FFA3, 0x855CFF5D, 0x6D42FF9B, 0x633CFF88, 0x6640FF7F,
+0x865BFF7E, 0x7746FF95, 0x8E52FF7F, 0x792FFF8E, 0x7A21FF7B, 0x6D0EFF85, 0x7A19FF7C, 0x953DFF7E,
+0x813AFF95, 0x9B5FFF7E, 0x7540FF95, 0xAF7CFF72, 0x7A41FFAB, 0x9C63FF72, 0x8D5BFF94, 0x703EFF8D,
+0xB11FC86E, 0xFF838F51, 0xFF606A2B, 0xC48C9458, 0x733A310E, 0x7109C46A, 0xFF969F66, 0xC4606930,
+0x8D507127, 0x9455FF83, 0x402DB08A, 0xFF9CA765, 0x1CF109BC, 0xFF778145, 0xFF8F9764, 0xFF596132,
+0xFF6B7344, 0xFF414717, 0xFF919865, 0xFF929663, 0xFF666934, 0xFF7B7E49, 0xFF656831, 0x8C8E9359,
+0x2B2AF027, 0x4BFF5E66, 0x26FF7C84, 0x59FF545D, 0x27FF858E, 0x36FF535C, 0x41FF646D, 0x56FF747C,
+0x38FF8C92, 0x40FF7378, 0x49FF7D7F, 0x46FF8489, 0x35FF7E87, 0x2CFF6C77, 0x28FF636E, 0x99210EFC,
+0xB119B490, 0xFF97A05D, 0xFF737E3A, 0x7C7D8846, 0x01E4000F, 0x9C571AF0, 0xA863FF8F, 0xA55FFF9B,
+0x823AFF98, 0xA05AFF75, 0x7C3CFF93, 0x8445FF70, 0x8240FF7A, 0x7937FF77, 0x7132FF6D, 0x284AFF67,
+0x7457F111, 0x7230FF67, 0x7133FF66, 0x783BFF65, 0x9D5CFF6A, 0x803FFF8E, 0x9B5CFF70, 0x5D1FFF8B,
+0x8345FF4D, 0x9B5DFF73, 0x793CFF8B, 0x9459FF6B, 0x9862FF86, 0x5722FF8B, 0x5B26FF4D, 0x672FFF51,
+0x652EFF5C, 0x6A35FF5C, 0x6A3BFF61, 0x6F41FF61, 0x7241FF63, 0x6532FF64, 0x5721FF57, 0x420CFF46,
+0x5925FF31, 0x6834FF47, 0xF1611056, 0x4A462918, 0x464529FF, 0x57573BFF, 0x545535FF, 0x3E3F1DFF,
+0x4C4B2CFF, 0x4B4A2BFF, 0x5E5B3CFF, 0x63603FFF, 0x4E4A27FF, 0x30F10EAC, 0xFF585739, 0xFF626344,
+0xFF3F4424, 0xFF6C6F50, 0xFF454627, 0xFF454426, 0xFF8D8C6D, 0xFF61613F, 0xFF525331, 0xFF585C37,
+0xFF737953, 0xFF595F3B, 0xFF545B39, 0xFF3D4425, 0xFF32351A, 0x641C1E06, 0x513FB142, 0x1C0AFF52,
+0x5D4BFF1D, 0xF17CAC5E, 0x5E604804, 0x62654AFF, 0x34371CFF, 0x2D3214FF, 0x727757FF, 0x08F1003C,
+0xFF3F461D, 0xFF9AA175, 0xFF383F13, 0xFF454C23, 0xFF464C2A, 0xF46C7055, 0x1F17F056, 0x3FFF3335,
+0x1DFF5355, 0x66FF3335, 0x4AFF7E81, 0x37FF6869, 0x1CFF5556, 0x04FF3938, 0x23FF2423, 0x45FF4C4D,
+0x5148EC6D, 0x6549FF66, 0xA0001C65, 0xFF161A00, 0xFF494D28, 0x6CC04E29, 0xFF472DF0, 0xFF8B8F6E,
+0xFFC4C6A1, 0xFF777951, 0xFF323B10, 0xFF424F23, 0xFF6B7751, 0xFF414D27, 0xFF4F5829, 0xFF626C3A,
+0xFF182300, 0xFF273212, 0xFF1E2A20, 0xFF333D46, 0xFF373D57, 0x36B82F50, 0x4DFF3091, 0x49FF2F2E,
+0x6DEC2D2D, 0x00D6C000, 0x28409AC4, 0xE8FF1719, 0x0C16608B, 0x0A12FF0C, 0x061136C0, 0x04F15EC0,
+0xFF010506, 0xFF03080C, 0xFF5E6376, 0xFF474B68, 0x0C3C4065, 0x405F31CD, 0xF12CF83D, 0x10132600,
+0x101324FF, 0x0C0D1FFF, 0x050716FF, 0x24315F08, 0x69181716, 0x090E0AB1, 0x79815CFF, 0x5E6B35FF,
+0x0CF12510, 0xFF9CAA75, 0xFF7C8856, 0xFF7A8656, 0xFF5B6533, 0xFF4F5927, 0xFF636B3A, 0xEC848C59,
+0x8853B11D, 0x4C1AFF7E, 0x733FFF42, 0xB103F469, 0xFF7E8B55, 0xFF47541F, 0xA4303D08, 0x3204F113,
+0x22FF5E67, 0x5FFF4F56, 0x13FF8A92, 0x39FF3B45, 0x024C616E, 0x8E4F21F0, 0x8247FF7E, 0x5018FF74,
+0x6E37FF43, 0x8C54FF5B, 0x6E32FF79, 0x571AFF5C, 0x622AFF49, 0x7945FF57, 0x6C3EFF6F, 0x5527FF60,
+0x622EFF49, 0x0D70FF5B, 0x31272000, 0x6C6F7A42, 0xD4271309, 0x2810000E, 0x71256C00, 0xFF666D43,
+0x9C525930, 0x8D4E3100, 0x00122484, 0x4F710308, 0x4DFF838F, 0x2794828C, 0x934F1CF1, 0x702EFF88,
+0x7134FF65, 0x8B54FF67, 0x612CFF82, 0x7342FF58, 0x5422FF6B, 0x7442FF4A, 0x824DFF6A, 0x7B44FF79,
+0x6833FF72, 0xF018AC5E, 0x535E3321, 0x434E24FF, 0x879365FF, 0x3D4919FF, 0x3C4516FF, 0x4E5728FF,
+0x8E9667FF, 0x868D5AFF, 0x595E28FF, 0x7A7F47FF, 0x757A44FF, 0x5B622CFF, 0xF100ECFF, 0x3C470F0C,
+0x636E36FF, 0x2E3900FF, 0x7E884CFF, 0x5D662DFF, 0x404616FF, 0xA3AB7AFF, 0x08F10F30, 0xFF8A9259,
+0xFF666330, 0xFF756D3C, 0xFF665F2B, 0xFFA9A36F, 0x7C494515, 0x29180009, 0x8F581CF1, 0x8049FF92,
+0x8C54FF83, 0x985FFF8D, 0x8E55FF99, 0x8D56FF8F, 0x9D66FF92, 0x7A46FFA0, 0x7C4AFF7A, 0x9B6CFF7A,
+0xA172FF99, 0xF119209F, 0x9E9A6B04, 0x978F5EFF, 0xA09661FF, 0x9A905BFF, 0x5E5721FF, 0x11F02E50,
+0xFF9FA162, 0xFF8B904D, 0xFF656B21, 0xFF787B2C, 0xFFA3A655, 0xFF585D0D, 0xFF70782D, 0xFF818A47,
+0x4A22186C, 0xF12CF887, 0x717C3A10, 0x6D773AFF, 0x545A2AFF, 0x5E6539FF, 0x8B9360FF, 0x7C8651FF,
+0x666F3AFF, 0x88915AFF, 0x28002C7C, 0x4C04F104, 0x52FF7E8A, 0x28FF818F, 0x25FF5762, 0x37FF545F,
+0x00E46873, 0x6C753E31, 0xB8000600, 0x4814F129, 0x70FF7B83, 0x26FF9DA4, 0x46FF5259, 0x2EFF7279,
+0x39FF5A61, 0x20FF656C, 0x32FF4C53, 0x1EFF5F66, 0x00584B52, 0x656E3931, 0x3571101C, 0x7BFF646F,
+0x1414ACB7, 0x31103000, 0x5C626C38, 0x2554F107, 0x4AFF5158, 0x2EFF7B80, 0x49FF6467, 0x34FF8485,
+0x38FF6D71, 0x40FF6F73, 0x20FF767C, 0x3DFF585E, 0x4EFF777D, 0x48FF8A91, 0x5DFF848B, 0x3BFF979D,
+0x43FF737C, 0x58FF7B84, 0x28FF8F9A, 0x6EFF606D, 0x35FFA6B3, 0x56FF6E7E, 0x5AFF91A1, 0x46FF97A8,
+0x41FF7F8F, 0x1CFF737F, 0x55FF4D58, 0x39FF8995, 0x24CC6D7C, 0x7B3800F1, 0x7A39FF6C, 0x7B3DFF6B,
+0x7C41FF6D, 0x40162C6E, 0xFF7C8A4D, 0x00F100EC, 0xFF859153, 0xFF5F6B2D, 0xFF828E50, 0x006A7638,
+0x985E711B, 0x5B23FF8D, 0x0004F050, 0x08F105B0, 0xFF646D38, 0xFF5F6734, 0xFF5C6435, 0xFF60693C,
+0xFF4F5A2F, 0x384B582C, 0x5D2CB108, 0x5E2BFF4F, 0x400BFF50, 0xA002F833, 0xFF524D2F, 0xFF2E2A0D,
+0x1DF04327, 0xFF4057F0, 0xFF6F704E, 0xFF616240, 0xFF343515, 0xFF3A391B, 0xFF524E31, 0xFF555233,
+0xFF484526, 0xFF322F10, 0xFF444428, 0xFF42452A, 0xFF7B8263, 0xFF555A3A, 0xFF4A492A, 0xFF6D6A4B,
+0xFF555435, 0xFF535434, 0xFF3B3F1E, 0xFF333917, 0xFF505735, 0xFF5C6341, 0xFF252C0B, 0xFF727958,
+0xFF272B10, 0xFF30341B, 0xFF1D1F0A, 0x07F077A0, 0xFF1A160A, 0xFF3C382C, 0xFF32311D, 0xFF1E2008,
+0xFF4A4D32, 0x005C472A, 0xFF4102F1, 0xFF53583A, 0xFF242909, 0xFF545C37, 0x885F673E, 0x502AE033,
+0x4E2FFF4A, 0x240EFF4B, 0x5240FF22, 0x511185CC, 0x24F16BC4, 0xFF4C4B36, 0xFF46462C, 0xFF7F7F63,
+0xFF48492A, 0xFF616044, 0xFF484728, 0xFF73744A, 0xFF5D5E34, 0xFF5A593B, 0xFF616147, 0xFF3F3F23,
+0xFF4C502D, 0x18535830, 0x4800F10A, 0x44FF666C, 0x5DFF6268, 0x1BFF8085, 0x09EC3F44, 0x5C3117F3,
+0x5430FF51, 0x3E19FF48, 0x4013FF34, 0x7344FF37, 0x8F64FF6A, 0x0C00FF84, 0x2824FF01, 0x4450FF1C,
+0x2E46FF3A, 0x2852B8C0, 0x304EFF2B, 0xC4005EE8, 0x243871AE, 0x202FFF23, 0x222CB41E, 0x86B40E16,
+0x7181BC00, 0xFF06070C, 0xC404080B, 0x5452B118, 0x6472FF4E, 0x445FFF5E, 0xF1EB0C40, 0x34375A04,
+0x2C2D4BFF, 0x23233BFF, 0x2A2B3FFF, 0x292B3AFF, 0x43713228, 0x55FF3234, 0xA52C4648, 0x80005400,
+0xFF212524, 0xFFD1DCB4, 0x247110F8, 0x51FF505F, 0x0EB47B8A, 0x602900F1, 0x925CFF51, 0x8A55FF85,
+0x6732FF80, 0x0009305D, 0x40F11D24, 0xFFBCC491, 0xFF5B6236, 0xFF7D8458, 0xFF818B59, 0xFF97A16D,
+0xFF7E8856, 0xFF3C4614, 0xFF707A46, 0xFF858D5A, 0xFF81895A, 0xFF5D6438, 0xFF646D40, 0xFF778351,
+0xFF56682E, 0xFF91A365, 0xFF65723A, 0xFF515E28, 0xFF576832, 0xFF455821, 0x884E6024, 0x7F4A9013,
+0x5A29FF76, 0xCC48FF52, 0x6101F01D, 0x6F3FFF56, 0x5A27FF69, 0x7D48FF56, 0x3047FF74, 0x7C86211C,
+0x9001122C, 0x790BF127, 0x7542FF6F, 0x6539FF6E, 0x5930FF5F, 0x5E2EFF54, 0x591AFF58, 0x7A37FF50,
+0x00304471, 0x38001788, 0x8E4C400D, 0x08A4FF83, 0xA1AB6CB1, 0x99A269FF, 0x808954FF, 0x1CB10994,
+0x43FF474F, 0x21FF6B75, 0x2ABC4B55, 0x31056000, 0x1048521D, 0x5010F105, 0x18FF7179, 0x67FF3941,
+0x18FF9098, 0x46FF434D, 0x50FF6E78, 0x38FF7981, 0x1EFF646B, 0x36204D54, 0xF11D3000, 0x6A6F3704,
+0x787D47FF, 0x8D945EFF, 0x6B743DFF, 0x737C45FF, 0x04F11930, 0xFFB0BA7D, 0xFF6B743B, 0xFF5D6335,
+0xFFBDC397, 0x64636C37, 0x5325F00F, 0x22FF8588, 0x3CFF5457, 0x43FF6D72, 0x6DFF7279, 0x3AFF9DA6,
+0x67FF6F74, 0x4BFFA0A1, 0x58FF8584, 0x6CFF9291, 0x7FFFA5A6, 0x74FFB8B9, 0x64FFADAE, 0x18FF9F9D,
+0x4210F105, 0x30FF7477, 0x2BFF5F63, 0x59FF5A5E, 0x58FF8A8F, 0x74FF8A8D, 0x71FFAAAA, 0x73FFAAA9,
+0x2900ABAC, 0x8E5111F0, 0x8442FF8A, 0x9753FF7F, 0xA15BFF90, 0x924BFF9A, 0xA35AFF88, 0x863FFF99,
+0x7732FF7C, 0x0604FF6C, 0xAF7014F1, 0x8344FFA5, 0x8F4DFF79, 0xBA75FF83, 0xA15BFFAD, 0x9757FF94,
+0x8C58FF8B, 0x875AFF82, 0x713FFF7E, 0xF100EC67, 0x6E754904, 0x485021FF, 0x656E35FF, 0x949E61FF,
+0x7F8D50FF, 0xB8002E10, 0x0C24F106, 0x56FF3B46, 0x58FF8590, 0x33FF848D, 0x33FF5C64, 0x4AFF5D63,
+0x73FF7980, 0x45FFA4AC, 0x35FF7377, 0x3CFF6164, 0x1FFF686B, 0x67FF4B4E, 0x4BFF8F95, 0x0B0C757B,
+0x653210F1, 0x5C29FF5D, 0x5622FF54, 0x7D48FF4C, 0x6A32FF73, 0x7A3FFF5D, 0x6B30FF6C, 0x7B45FF5D,
+0xF00BCC6E, 0x5A623306, 0x757B4DFF, 0x585C2AFF, 0x5C5F2AFF, 0x87884FFF, 0x72FC24FF, 0xFF7D80B1,
+0xFF5B5F24, 0xFF6B6F34, 0x03F100E8, 0x48FF7D82, 0x52FF858A, 0x47FF8C92, 0x4CFF8187, 0x326C828B,
+0x000A0800, 0x10F128C4, 0xFF7B8842, 0xFF57671E, 0xFFA8B96B, 0xFF798940, 0xFF94A062, 0xFF7D884C,
+0xFF889454, 0xF45B6A27, 0x7635712D, 0x7C3FFF67, 0x001B206E, 0x42221AFC, 0x0032707D, 0x4B312ECC,
+0x0AD4808A, 0x000C3000, 0x5771205C, 0x41FF8790, 0x02FC6E79, 0x868F5AA0, 0x78814CFF, 0xF06B38FF,
+0x006A1109, 0x6F423117, 0xF10DC466, 0x45522620, 0x435024FF, 0x667244FF, 0x4E5A2AFF, 0x798351FF,
+0x46501CFF, 0x494829FF, 0x414022FF, 0x505034FF, 0x333617FF, 0x6A6E4BFF, 0x4B4F2CFF, 0x5AF06AF4,
+0xFF3B3C1D, 0xFF333415, 0xFF5C5B3C, 0xFF3A391A, 0xFF353616, 0xFF373A1F, 0xFF8C9075, 0xFF3E4526,
+0xFF3D4321, 0xFF565831, 0xFF5D5E36, 0xFF2C2C0A, 0xFF4D4E2F, 0xFF2E3116, 0xFF2F3318, 0xFF495031,
+0xFF353C1B, 0xFF1B2200, 0xFF515934, 0xFF343A16, 0xFF303614, 0xFF4C4F34, 0xFF555440, 0xFF252316,
+0xFF131104, 0xFF272611, 0xF10F5824, 0xFF565A23, 0xFF676B4A, 0xFF8B8E71, 0xFF22260D, 0xFF60644D,
+0xFF2C3019, 0xFF404429, 0xFF4F5233, 0xFF595D3C, 0xFF282909, 0xFF3E3E24, 0xFF2F2D16, 0xBC36341D,
+0x5B437390, 0x2E14FF5B, 0xF100A82E, 0x13FF5A0A, 0x23FF2F2F, 0x3FFF4243, 0x32FF676A, 0x2EFF5A5D,
+0x40FF4C4D, 0x0EEC5C5C, 0x381438F1, 0x451CFF32, 0x5E33FF3E, 0x2F08FF55, 0x320DFF27, 0x8661FF2A,
+0x421CFF82, 0x2801FF3C, 0x542CFF20, 0x7651FF49, 0x673FFF6C, 0x562DFF5C, 0x380FFF4E, 0x744AFF30,
+0x4C33FF69, 0x4C4DFF42, 0x3D4EFF42, 0x344CFF34, 0xB181D42E, 0xFF2D2C4B, 0xFF322F4E, 0xB4292943,
+0x233531C7, 0xF131E022, 0x1B1B2518, 0x101018FF, 0x090911FF, 0x05060BFF, 0x07080AFF, 0x000500FF,
+0x0D1402FF, 0x586051FF, 0x6E757DFF, 0x2B3046FF, 0x00F1E61C, 0xFF2E3056, 0xFF222244, 0xFF1B1C38,
+0x0418192E, 0x2C3B317D, 0x3196242A, 0x48191B27, 0x3260000A, 0x1D1C04F1, 0x421DFF19, 0x3901FF38,
+0xB87AFF2C, 0xA668FFA8, 0x0009B096, 0x27F00224, 0xFF737E44, 0xFF949D64, 0xFF6D763F, 0xFF757C48,
+0xFF2F3602, 0xFF979D6D, 0xFF6D744B, 0xFF545B32, 0xFF5D6639, 0xFFA2AC7A, 0xFFA6B282, 0xFF465222,
+0xFF5D6939, 0x4580A479, 0x0CFF8A91, 0x59FF262D, 0x07187880, 0x66774171, 0x85965FFF, 0x5EB122E8,
+0x37FF8693, 0x47FF5C6A, 0x0A706C7D, 0x834E10F1, 0x3A0AFF76, 0x9064FF34, 0x572EFF8A, 0x5E35FF4F,
+0x5B30FF56, 0x8654FF58, 0x8249FF82, 0xF035407A, 0x6E763B05, 0x879051FF, 0x76803BFF, 0x78813EFF,
+0x798148FF, 0xF11E0CFF, 0x737A4604, 0x7D854CFF, 0x576021FF, 0x7F8847FF, 0x8B9455FF, 0x4A31178C,
+0x08C47F89, 0x0031EC00, 0x6031232C, 0x04C88991, 0x4C5421B1, 0x656E37FF, 0x737C43FF, 0x31310F64,
+0x23985F68, 0x501B30F1, 0x6C39FF47, 0x6031FF64, 0x723FFF58, 0x7135FF6A, 0x8849FF69, 0x793DFF7E,
+0x6229FF6F, 0x5C26FF59, 0x5E22FF55, 0xB06AFF56, 0x853FFFA9, 0x874BFF7E, 0x7B41FF81, 0xA468FF76,
+0x9D62FF9C, 0xF1291095, 0xCCD39F08, 0x9BA36AFF, 0x636A36FF, 0xA3A580FF, 0xA5A984FF, 0xB1B885FF,
+0x65D00DEC, 0x4BFF9B9E, 0x2FFF8184, 0x49FF656B, 0x4BF123B4, 0x59FF6C75, 0x4BFF9197, 0x4AFF8485,
+0x44FF8283, 0x7AFF7C7D, 0x65FFB2B3, 0x76FF9E9F, 0x73FFB1B2, 0x67FFB2B0, 0x42FFA3A3, 0x4CFF787B,
+0x42FF7B82, 0x60FF7378, 0x54FF9398, 0x66FF888B, 0x92FF9A9D, 0x6EFFCACB, 0x7BFFA6A7, 0x3FFFB4B5,
+0x31FF787C, 0x75FF6A6E, 0x60FFAFB5, 0x1DD89CA3, 0x808A4531, 0x0C001320, 0x7D3E7106, 0xA061FF73,
+0x310B1496, 0xDC94A060, 0x924C311D, 0x00186C85, 0x0CF113DC, 0xFF7A834E, 0xFF3C4510, 0xFF737B4A,
+0xFF484C29, 0xFF5B5F3C, 0xFF72784A, 0x18929966, 0x3930F10A, 0x54FF646E, 0x13FF7F89, 0x26FF3F48,
+0x97FF525B, 0x93FFC1C7, 0x1FFFB6BB, 0x24FF4547, 0x38FF5256, 0x38FF676B, 0x75FF6066, 0x3AFF999E,
+0x49FF5D62, 0x90FF6C71, 0x1CFFB4B9, 0x7CFF4248, 0x3158A6AC, 0x2F003710, 0xFF6C7661, 0x7C6C7642,
+0x20100010, 0x646E3A50, 0x163040FF, 0x5D6603F1, 0x6E7647FF, 0x666C3EFF, 0x4E5220FF, 0x5E622FFF,
+0x18F129FC, 0xFF959861, 0xFF8C8F56, 0xFF7E8247, 0xFF888C51, 0xFF8D9154, 0xFF767B3B, 0xFF808545,
+0xFF969C5E, 0xFF909658, 0xDC9FA569, 0x9155401A, 0x00E8FF89, 0xF1373000, 0x83904B00, 0xA7B46EFF,
+0x687530FF, 0x657131FF, 0x68001FF8, 0x6424713D, 0x5B1DFF58, 0x7120104F, 0xFF727D45, 0x60828D55,
+0x20200034, 0x500B1800, 0xFF869051, 0xF104E450, 0xFF808807, 0xFF949961, 0xFF848B55, 0xFF77804B,
+0xFF939D69, 0x0C7A824F, 0x02400001, 0x8A570CF1, 0x6F3CFF82, 0x5D2BFF67, 0x5624FF53, 0x6737FF4C,
+0x7948FF5B, 0x5729FF6B, 0xF01BC04A, 0x5E6A3C0F, 0x404C1EFF, 0x546032FF, 0x525635FF, 0x515534FF,
+0x404324FF, 0x434627FF, 0xF0532FFF, 0xFF50916A, 0xFF5A5E3D, 0x74424526, 0x4508F109, 0x18FF6164,
+0x48FF3539, 0x4DFF6569, 0x44FF6468, 0x4DFF5B5F, 0x1818656C, 0x8D620BF0, 0x562BFF8A, 0x6D48FF53,
+0x4524FF6B, 0x3012FF41, 0x361BFF2B, 0x6246FF32, 0x06F10474, 0x5937FF41, 0x3A15FF52, 0x431FFF32,
+0x3715FF3D, 0x4F30FF31, 0xF142604C, 0x25271220, 0x383723FF, 0x37371DFF, 0x4F5030FF, 0x656944FF,
+0x939774FF, 0x383B1EFF, 0x4C4E38FF, 0x6D705DFF, 0x222512FF, 0x1F210BFF, 0x24270AFF, 0x48F10A90,
+0xFF191A00, 0xFF302F11, 0xFF343317, 0xFF37361A, 0xFF262509, 0xFF54543A, 0xFF4F4F33, 0xFF1F2000,
+0xFF666747, 0xFF747556, 0xFF8C8D6D, 0xFF4A4D22, 0xFF909368, 0xFF5B5C3C, 0xFF5A5D40, 0xFF4B5030,
+0xFF818763, 0xFF7C855A, 0xFF899267, 0xFF646F47, 0xFF555D38, 0x24979D79, 0x1E28F114, 0x32FF3940,
+0x3EFF4B55, 0x25FF5B66, 0x43FF444C, 0x21FF6369, 0x5FFF3F45, 0x3DFF7A81, 0x4EFF4952, 0x47FF3E47,
+0x3DFF2A32, 0x42FF2127, 0x51FF2529, 0x4FFF3332, 0x0EFC3130, 0x00C7B400, 0x2710A4BC, 0x13219FC0,
+0x312CF013, 0xBC090913, 0x0708F18B, 0x00FF080A, 0x4CFF0004, 0x64FF616C, 0x57FF737D, 0x50FF4D55,
+0xDC04363D, 0x282C5131, 0x4671BE10, 0x36FF2B2D, 0xA0042122, 0x11132240, 0x716E08FF, 0xFF141720,
+0x3C1A1D26, 0x114CF1A0, 0x55FF1015, 0x77FF707A, 0x2AFFA2AF, 0x54FF5868, 0x5FFF8292, 0x39FF8D9D,
+0x62FF6674, 0x28FF8E97, 0x3AFF5258, 0x45FF646A, 0x54FF6F75, 0x59FF8083, 0x2AFF8187, 0x25FF4B4F,
+0x47FF454B, 0x5FFF6972, 0x0CFF838F, 0x47FF2F3D, 0x0DFF6A78, 0x0AFF303E, 0x03FF2A35, 0x00FF1C26,
+0x14F8141E, 0x3F1307F0, 0x5F2EFF32, 0x5F2BFF4F, 0x8D5BFF4E, 0x6A38FF81, 0x602DFF5E, 0x6B110D2C,
+0x2B720034, 0x27FF515A, 0x1A484D53, 0xFF5258A1, 0xFF656B45, 0x5C676942, 0x945E9039, 0x6227FF8F,
+0x644AFF5A, 0xA3ABA10D, 0x88914EFF, 0x707A35FF, 0x200039D0, 0x6428E00F, 0x9D5EFF5C, 0x8546FF94,
+0x6327FF7C, 0x589116AC, 0x7C8449FF, 0x8B9559FF, 0x380021B0, 0xBE8AB100, 0x8E5FFFB7, 0x4112FF86,
+0x2013FC39, 0x034C9158, 0xFF8702F1, 0xFF525C20, 0xFF757E45, 0xFF808751, 0xF06D743E, 0x824FB102,
+0x642CFF7E, 0x6727FF5F, 0x0026AC61, 0x36100F58, 0x03F10FE8, 0x5AFF7E86, 0x41FF9298, 0x28FF8087,
+0x3CFF676E, 0x403C7579, 0x696F3331, 0x14F11958, 0xFF8F9660, 0xFFA9B07A, 0xFFB9C186, 0xFFA0A771,
+0xFF74764E, 0xFF888A62, 0xFF8A8E5B, 0xFFA8AD73, 0x5C83894D, 0xB072711D, 0x7635FFAA, 0xF00DBC6D,
+0x71773915, 0x8D9156FF, 0x7E8148FF, 0x8A8D54FF, 0xAFB077FF, 0x9A9B61FF, 0x929357FF, 0x9F9F5FFF,
+0xA5A768FF, 0x310060FF, 0x64626A2F, 0x965EB100, 0x8E56FF91, 0xAC75FF89, 0xF12C60A9, 0x8D905700,
+0x85884FFF, 0x646A2EFF, 0x63692DFF, 0x7F3113B8, 0x1D34B5BE, 0x68733131, 0xC00004F0, 0x00040005,
+0x8F5310F1, 0x8043FF85, 0x6426FF76, 0x8444FF58, 0xB16FFF78, 0x9755FFA5, 0x7C3FFF8C, 0x753AFF72,
+0xF10AA46D, 0x73794B20, 0x38391AFF, 0x49492FFF, 0x494A28FF, 0x686A42FF, 0x6B7145FF, 0x686E42FF,
+0x5B6133FF, 0x545A2CFF, 0x898C5FFF, 0xC6C8A0FF, 0x7D7E5CFF, 0x180012C8, 0x2010F116, 0x1EFF4A4D,
+0x33FF4345, 0x39FF5458, 0x1AFF585C, 0x32FF393D, 0x52FF5357, 0x6BFF767B, 0x15B09399, 0x19184C13,
+0x06C84510, 0xFF7983E1, 0xFF737B4C, 0xFF30390C, 0x4C30370D, 0x5829310C, 0xF11ADC50, 0x7A814E08,
+0x868A58FF, 0x898D5BFF, 0x626633FF, 0x989D65FF, 0x73783EFF, 0x00F13E2C, 0xFF747A3C, 0xFF767A3D,
+0xFF9BA163, 0x48676D2F, 0x2F00003D, 0x474C1431, 0x7C0014CC, 0x3C700034, 0x707A3DC0, 0x687233FF,
+0x717B3CFF, 0xF101BCFF, 0x808A4D00, 0x8C9659FF, 0x535D20FF, 0x697239FF, 0x28F104F4, 0xFF717B46,
+0xFF79834E, 0xFF77824A, 0xFF6B763A, 0xFF6C7637, 0xFF929C5D, 0xFF656E2F, 0xFF848C51, 0xFF848953,
+0xFF9DA471, 0xFF7F8756, 0xFF5A6432, 0xFF858D5C, 0x78535B2A, 0x7847711B, 0x6E3DFF70, 0xF10CEC66,
+0x76804C2C, 0x84915CFF, 0x586633FF, 0x475524FF, 0x768254FF, 0x566234FF, 0x495429FF, 0x4F5A30FF,
+0x313713FF, 0x626846FF, 0x282D0DFF, 0x5C6141FF, 0x4A4E2BFF, 0x494D2AFF, 0x1E2201FF, 0x44F10500,
+0xFF515638, 0xFF4E5333, 0xFF4A512F, 0xFF777E5D, 0xFF82886C, 0xFF20260A, 0xFF43482A, 0xFF292F0D,
+0xFF7A7F56, 0xFF4F5529, 0xFF5F643B, 0xFF4F532E, 0xFF494F2B, 0xFF5A603E, 0xFF585D3D, 0xFF585D3F,
+0xFF222709, 0xFF1B2002, 0xFF252A0C, 0xFF454A2C, 0x082E3313, 0x0A3C0005, 0x7F836290, 0x686949FF,
+0x19004AFF, 0x353627F1, 0x494A2AFF, 0x54573CFF, 0x646650FF, 0x797B66FF, 0x6D6F59FF, 0x77775DFF,
+0x5E5F40FF, 0x676648FF, 0x3D3C1EFF, 0x4E4A2FFF, 0x545033FF, 0x535031FF, 0x423F20FF, 0x00F113D8,
+0xFF383B1C, 0xFF515532, 0xFF656946, 0x7C4D5031, 0x4F16F070, 0x0EFF757B, 0x22FF343A, 0x16FF4145,
+0x28FF3235, 0x2EFF444A, 0x3DFF4C52, 0x10FF5E66, 0x6AFF2F3A, 0x3BFF8792, 0x17F1269C, 0x35FF353B,
+0x27FF5157, 0x24FF3F46, 0x17FF3E45, 0x4DFF363E, 0x29FF6E76, 0x1EFF474D, 0x3CFF393E, 0x4DFF5056,
+0xA4B05359, 0x273F05F0, 0x283EFF21, 0x2C42FF22, 0x2F4BFF27, 0x304CFF2E, 0x7CC0FF30, 0x1C1F3240,
+0x0013F8FF, 0x1C318BC0, 0x9FC01212, 0x0A0A1450, 0x22BC0FFF, 0x000607F1, 0x081000FF, 0x6F7C50FF,
+0x77835FFF, 0x4D5651FF, 0x363D4FFF, 0x4D511E44, 0x39FF262A, 0x1F917820, 0x16192AFF, 0x111423FF,
+0x04004FF4, 0x24303105, 0xF18C0C22, 0x070A1300, 0x0D120BFF, 0x8D986EFF, 0x8B995EFF, 0x84310C94,
+0x25B8AFBC, 0x7C4F10F1, 0x4724FF73, 0x5839FF43, 0x5333FF57, 0x5833FF52, 0x673FFF56, 0x4D25FF66,
+0x5E39FF4B, 0xF104A85A, 0x636C4110, 0x4E5A2CFF, 0x1B2800FF, 0x6A7749FF, 0x687643FF, 0x414F1CFF,
+0x475426FF, 0x586338FF, 0x10F11E4C, 0xFF3E4B20, 0xFF3B4A1F, 0xFF3A471B, 0xFF465224, 0xFF404C1C,
+0xFF404E1D, 0xFF4D5A2C, 0x08505B30, 0x4722711F, 0x5D38FF43, 0xB102205B, 0xFF6C704D, 0xFF545432,
+0x504D4D27, 0x2A08F10D, 0x16FF595D, 0x52FF4245, 0x36FF8185, 0x50FF6C72, 0x67FF8A90, 0x32009DA0,
+0x7D834540, 0xF10448FF, 0x6E743808, 0x7B8048FF, 0x929963FF, 0xA0A773FF, 0x6F7640FF, 0x788047FF,
+0x10F12174, 0xFF99A06A, 0xFF454B1D, 0xFF5E6436, 0xFF59602A, 0xFF6A7237, 0xFF6C7438, 0xFF444C10,
+0x0C50581F, 0x5218313F, 0x503C5C4D, 0xFF767940, 0xD271A81F, 0x52FF7C80, 0x30FF898D, 0x41FF646C,
+0xF004EC7D, 0x6A70341E, 0x55591CFF, 0x606427FF, 0x85864DFF, 0x63662FFF, 0x666B35FF, 0x636832FF,
+0x959A62FF, 0xBEC488FF, 0xAAB070FF, 0xB5BB7BFF, 0x06284AFF, 0xFF8D9061, 0xF07D8047, 0xB779B11C,
+0x7E40FFB1, 0xC385FF78, 0x0003BCBD, 0xC4004074, 0x793D3108, 0xF10A0873, 0x8086480C, 0xB7BB7EFF,
+0x9FA064FF, 0xAFB172FF, 0x8B8D4EFF, 0x63672AFF, 0x80894AFF, 0x0CF12738, 0xFF7B8548, 0xFF969E63,
+0xFF9FA76C, 0xFF9CA167, 0xFF989D63, 0xFF676C32, 0x0453581E, 0x5D233100, 0x312CD858, 0xAC8D955A,
+0x7A3E7135, 0x9054FF70, 0x400AEC85, 0xFF929B64, 0x00F10AE8, 0xFF475019, 0xFF6F7841, 0xFF4B541B,
+0x10879152, 0x66273114, 0xF10FD45D, 0x7D824A08, 0x6E7144FF, 0x232206FF, 0x5E5C45FF, 0x5D5C40FF,
+0x434223FF, 0x1CF10188, 0xFF4F4F2D, 0xFF31310F, 0xFF3E3E1A, 0xFF2D2D09, 0xFF2E2E0C, 0xFF727153,
+0xFF383719, 0xFF5D5D37, 0xFF33350E, 0xFF5E5F3D, 0x284C4D2D, 0x4B28C003, 0x4A26FF47, 0x5F36FF44,
+0x2144FF58, 0x71400CF1, 0x6936FF69, 0x5522FF61, 0x5B2CFF4D, 0x8256FF53, 0x5129FF7B, 0x5630FF4C,
+0x80173050, 0xFF646B41, 0xFF4D5526, 0x44710A24, 0x2CFF6F77, 0x1040565C, 0x0B2C3B10, 0x01C47F12,
+0x965A10F1, 0xA86CFF90, 0x8D51FFA0, 0x864AFF87, 0x8145FF80, 0x682EFF7B, 0x6C34FF63, 0x703AFF67,
+0x3140CC6B, 0x8C777C46, 0x773E3201, 0xF134206F, 0xFF687007, 0xFF687035, 0xFF737B3F, 0xFF858D51,
+0xFF879154, 0x74677037, 0x1974003D, 0x7E875271, 0x606932FF, 0x3B3110B8, 0x2D906F77, 0x3E460A31,
+0x00F1060C, 0xFF8E925F, 0xFF6E7444, 0xFF929A69, 0x9C444E1C, 0x5024312A, 0x002AFC49, 0x3FB111FC,
+0x4BFF666E, 0x4BFF737D, 0x2028757F, 0x531E08F1, 0x7845FF45, 0x6B3BFF6A, 0x2900FF5F, 0x3E14FF1E,
+0x4F27FF33, 0x310E9844, 0xE46D7351, 0x09F00004, 0x5C3A02F0, 0x3513FF5B, 0x3C1CFF34, 0x2E0FFF3B,
+0x8413FF2B, 0x3C1CF035, 0x6D4BFF35, 0x8462FF63, 0x4024FF7A, 0x270DFF3A, 0x3217FF21, 0x3D1DFF2E,
+0x7D5AFF38, 0x401BFF79, 0x6840FF3C, 0x3C14FF63, 0x18B4FF37, 0x383F1631, 0x6FD0087C, 0x5AFF8D93,
+0x65FF757A, 0x0CFF7E83, 0x4850B7F4, 0x5E3EFF44, 0x515122E4, 0x8D936DFF, 0x58711924, 0x1EFF777B,
+0x32483F40, 0x66473CF1, 0x4025FF65, 0x220CFF3D, 0x432DFF20, 0x5D42FF41, 0x5E3FFF5A, 0x6C4CFF5D,
+0x785AFF6B, 0xA284FF79, 0x9378FFA3, 0x7053FF97, 0x9976FF74, 0x8966FF9D, 0x4926FF8C, 0x411DFF45,
+0x532DFF3B, 0x603AFF4D, 0x7F5DFF5A, 0x5936FF79, 0xB10BDC55, 0xFF3B4115, 0xFF50542F, 0x004E5231,
+0x3F08F11E, 0x2AFF5D63, 0x19FF4B53, 0x7AFF3843, 0x15FF979F, 0x1DFF3037, 0x05AC383F, 0x636A4931,
+0x0DF019AC, 0xFF505831, 0xFF424920, 0xFF535734, 0xFF464A2F, 0xFF383B2A, 0xFF4F5352, 0xFF2B3141,
+0x45312CA4, 0x3BC0272D, 0x2E4A00F1, 0x334FFF2D, 0x1F36FF32, 0x1A2DFF1D, 0x00EAB017, 0xC000BDB8,
+0x0F17409F, 0x0A00FF0F, 0x006DB800, 0x10F109FC, 0xFF485230, 0xFF798754, 0xFF738257, 0xFF434D45,
+0xFF272E40, 0xFF323956, 0xFF303555, 0xF42C3049, 0x263771EA, 0x2D3EFF23, 0x0064082A, 0x2C71640C,
+0x14FF1D1F, 0x73000608, 0x060B0431, 0xAC000A98, 0x4A00F135, 0x6CFF7380, 0x1BFF94A1, 0x04FF3F4B,
+0x1534252D, 0x51513940, 0xF166C4FF, 0x3F3E2208, 0x50502EFF, 0x7D7F5AFF, 0x8B8F6AFF, 0x5D643BFF,
+0x5E6738FF, 0x04F110F0, 0xFF455224, 0xFF515E30, 0xFF687945, 0xFF6A7B45, 0x4C7F8D58, 0x5613F01E,
+0x10FF7580, 0x30FF2D38, 0x1AFF4C58, 0x11FF3845, 0x3DFF313C, 0x31FF616A, 0x4AFF535F, 0x2FFF6A75,
+0x51294858, 0x4B29FF5C, 0xB124444A, 0xFF5D5E3C, 0xFF555634, 0x187D7A5B, 0x663C3129, 0x403E9065,
+0xFF5B5D35, 0x3B713E94, 0x70FF6B6D, 0x43D8A4A7, 0x6E7237B1, 0x7B8143FF, 0x6D7335FF, 0x53710824,
+0x3FFF868B, 0x281C6C73, 0x71177800, 0xFF7A814B, 0xDC4D551A, 0x08880009, 0x7F855731, 0x1CF13788,
+0xFFA2AA6F, 0xFF60682D, 0xFF777F44, 0xFF858A54, 0xFF757A42, 0xFF878B50, 0xFF56571B, 0xFF5B5C22,
+0xFF8E8F56, 0xFF777640, 0x586E6E38, 0x4F14F100, 0x3DFF858B, 0x3FFF7376, 0x36FF7578, 0x38FF6F70,
+0x53FF7172, 0x4FFF8989, 0x6CFF8383, 0x2CFF9C9E, 0x3D045D62, 0xF1141800, 0xB0B77304, 0xA2A965FF,
+0xB0B676FF, 0x6C7033FF, 0xA8AC6FFF, 0x7C4017C8, 0x04FFB2BB, 0x985C8000, 0xA96DFF92, 0x0F10FFA3,
+0x8F935831, 0x65313CB0, 0x17C89BA4, 0xCC8C08F1, 0xA363FFC6, 0xAD71FF9E, 0x773CFFAC, 0x763AFF73,
+0xB374FF70, 0x313C84A9, 0x985B6528, 0x6709F02C, 0x5DFF9AA2, 0x3CFF9098, 0x3DFF7176, 0x50FF7277,
+0x4DFF8388, 0xF4FF7E86, 0x330DF003, 0x34FF616A, 0x40FF626B, 0x57FF6D78, 0x5AFF848F, 0x2FFF8792,
+0x29FF5D66, 0x84FF555E, 0x69383204, 0x210FE461, 0x1EF45E65, 0xF14AFC00, 0x777C4214, 0x72753EFF,
+0x6C6C3AFF, 0x98966DFF, 0x2F2A0DFF, 0x140E00FF, 0x534D33FF, 0x676245FF, 0x817C5FFF, 0x14F17974,
+0xFFB3AD93, 0xFF332D13, 0xFF817C5C, 0xFF423F1E, 0xFF7A7758, 0xFF515031, 0xFF80805C, 0xFF61613B,
+0xA03A3B19, 0xA57C3126, 0xF108B0A0, 0x474E2410, 0x7F865CFF, 0x4B5324FF, 0x6A7241FF, 0x57602BFF,
+0x929A67FF, 0x747A4CFF, 0x50552DFF, 0x0DB126D0, 0x31FF2C30, 0x4EFF5256, 0x15FC7178, 0x002F0C00,
+0x3DB14058, 0x21FF656F, 0x33FF454E, 0x198C5962, 0xF038F000, 0x3D470B2F, 0x889255FF, 0xA7B175FF,
+0x61692EFF, 0x71793EFF, 0x575C24FF, 0x727741FF, 0x7D824CFF, 0x696D3AFF, 0x767A47FF, 0x868A57FF,
+0x6A6E3BFF, 0x6C713BFF, 0x797E48FF, 0x666E35FF, 0xC07940FF, 0xFF75512E, 0x9C6F773C, 0x5E27401A,
+0x0FF4FF55, 0x0016CC00, 0xF0000004, 0x289C0019, 0x0013F000, 0x140046AC, 0x7D4A3120, 0x31166476,
+0xE86D7542, 0x1B08F104, 0x48FF424A, 0x58FF6D74, 0x3FFF7A81, 0x15FF6168, 0x57FF383F, 0x0CCC7B84,
+0xF12B0000, 0x5B693400, 0x768451FF, 0x475323FF, 0x444F24FF, 0x33313C04, 0x13EC505B, 0x565A39B1,
+0x525334FF, 0x363517FF, 0x34F179AC, 0xFF3E3B1A, 0xFF5D5C3D, 0xFF3C3D1E, 0xFF383D1F, 0xFF5A6140,
+0xFF66704E, 0xFF626C4A, 0xFF3D4329, 0xFF1A2006, 0xFF25290E, 0xFF161900, 0xFFA1A489, 0xFF36391C,
+0xFF3F4322, 0xFF4E522D, 0xFF70764A, 0x8C4B5121, 0x5C0CF126, 0x1FFF8288, 0x6FFF4247, 0x0BFF8E92,
+0x18FF262B, 0x22FF3136, 0x52FF3A41, 0x096C6C73, 0x393F1D71, 0x464A27FF, 0x1DB109B0, 0x3DFF3A3E,
+0x28FF595C, 0x1E2C4043, 0xB1191000, 0xFF3B3E1F, 0xFF565735, 0xECA1A37E, 0x3308F106, 0x49FF5352,
+0x5CFF6A66, 0x68FF7E7B, 0x56FF908E, 0x52FF7D7E, 0x1290747B, 0x360B04F1, 0x7E53FF2D, 0x6D46FF75,
+0x623CFF65, 0x5E34FF5C, 0xF117E057, 0x5D633D28, 0x646A46FF, 0x6B714FFF, 0xAAB08EFF, 0x414721FF,
+0x878F68FF, 0x3E4422FF, 0x2A3110FF, 0x555C3BFF, 0x515836FF, 0x7E8462FF, 0xA4AA86FF, 0x8B916BFF,
+0x5B5F3AFF, 0x00F105D4, 0xFF3E4227, 0xFF4A4B45, 0xFF3D4049, 0xB4282B3E, 0x2C466263, 0x324CFF26,
+0x4110F4B8, 0x03F1BDD4, 0x27FF191B, 0x1FFF1316, 0x19FF1012, 0x13FF0D10, 0x1DF00B0B, 0xF018FC00,
+0x0305020B, 0x2A321BFF, 0x68734BFF, 0x899861FF, 0x849467FF, 0x727B76FF, 0x383648FF, 0xFF26A01E,
+0xFF262B49, 0xFF1D213C, 0x3FB18204, 0x2FFF282A, 0x32FF191C, 0xBE2C1F20, 0x03051231, 0x14F11400,
+0xFF0B0B17, 0xFF090B08, 0xFF656C4B, 0xFF636C3D, 0xFFA7B17F, 0xFF596331, 0xFF344010, 0xFF80895E,
+0xA8989E7A, 0x2B13710B, 0x361EFF2B, 0x71246436, 0xFF696A4A, 0xFC555934, 0x3C04F131, 0x33FF6771,
+0x3BFF5C69, 0x12FF5C69, 0x4EFF313E, 0x31F46F7C, 0x4F1D28F1, 0x6131FF43, 0x6F45FF55, 0x320AFF64,
+0x6F44FF27, 0x2D01FF62, 0x7547FF20, 0x6134FF69, 0x4015FF58, 0x9F74FF37, 0x683FFF96, 0x653FFF60,
+0x714FFF5F, 0x5331FF70, 0xF1201453, 0x5E5D3E00, 0x807D5CFF, 0x8B8867FF, 0x696945FF, 0x74003410,
+0x4C265024, 0xF033FF4C, 0x5F612180, 0x64003C20, 0x682FB109, 0x9E63FF65, 0x7F43FF9A, 0x31091079,
+0x28757946, 0x6E00F10A, 0x46FF9DA4, 0x33FF777F, 0x34FF646C, 0x17AC6168, 0x858B5B71, 0x7F8650FF,
+0x2531267C, 0x2CA0565B, 0x5A280FF0, 0x7F4AFF58, 0x7D43FF7C, 0xA86EFF7C, 0x763EFFA7, 0x9865FF77,
+0x7748FF9A, 0x8150FF7B, 0x26F14AF0, 0x642BFF7B, 0x7B45FF61, 0x8751FF7B, 0x9A5EFF88, 0x4C10FF9A,
+0x5A22FF4C, 0x8F59FF5B, 0x7F46FF8F, 0x9056FF7C, 0xA369FF8B, 0xB478FF9E, 0xA15EFFAC, 0xB570FF98,
+0xF11248AB, 0x93995D0C, 0x696D30FF, 0x575B1EFF, 0xA5AD71FF, 0xA3AB6FFF, 0x959A60FF, 0x70753BFF,
+0x780050F8, 0x8448804F, 0xB677FF7C, 0x26F4FFAC, 0xAB6B00F1, 0x8747FFA5, 0x9B60FF82, 0x8C54FF97,
+0x00194887, 0x14F14628, 0xFF737F3F, 0xFF929E60, 0xFF99A567, 0xFF8E985C, 0xFF697337, 0xFF99A168,
+0xFF6B733A, 0xFF69703A, 0xA06E753F, 0x03CC0014, 0x774210F1, 0xBE89FF6E, 0x6F3AFFB4, 0xA26DFF65,
+0x3801FF98, 0x9B67FF2F, 0x5E32FF94, 0x764DFF58, 0xF10ECC71, 0x7C7F5010, 0x787C49FF, 0x727442FF,
+0x6F6E40FF, 0x656438FF, 0x6A673CFF, 0x77734DFF, 0x766F52FF, 0x08F18120, 0xFF6D6348, 0xFF8A8065,
+0xFF8E8469, 0xFF7F755C, 0xFF847C69, 0xE07F7762, 0x4C0CF12F, 0x63FF7571, 0x27FF8D89, 0x34FF504E,
+0x28FF5B5C, 0x2EFF4F50, 0x68FF5456, 0x158C9497, 0x000AA800, 0x437142B0, 0x4EFF6E76, 0x008C7882,
+0x00143800, 0x3E802818, 0x1EFF646A, 0x90FF3F43, 0x0E0C0003, 0x5A613880, 0x4A5125FF, 0x00283CFF,
+0x10F12A3C, 0xFF737D49, 0xFF5D6937, 0xFF5B6739, 0xFF3A4616, 0xFF657038, 0xFF747F45, 0xFF879258,
+0xEC838E52, 0x8B523224, 0x210EC882, 0x1A948088, 0x248C4B10, 0x7C8003F1, 0x4A4E1BFF, 0x939564FF,
+0x757746FF, 0x818351FF, 0x36712380, 0x33FF6269, 0x16486067, 0xC0237800, 0xFF687034, 0xFF5F672C,
+0xFF7F8851, 0x3B31012C, 0x45CC666E, 0x001ED000, 0x53312EB8, 0x1ACC818A, 0x001FD800, 0x28001B7C,
+0x6B37200F, 0x06F122E8, 0x5228FF62, 0x6842FF4B, 0x4E2AFF62, 0x663FFF48, 0x633AFF5E, 0x3113F05B,
+0xFC394515, 0x1DF80004, 0x87570CF1, 0x6133FF7B, 0x663BFF55, 0x5930FF5D, 0x4725FF51, 0x3917FF47,
+0x482BFF39, 0xF17AF04C, 0x4D472718, 0x635E3EFF, 0x7F7C5DFF, 0x1C1D00FF, 0x6B7052FF, 0x6D7453FF,
+0x2B3512FF, 0x5A6442FF, 0x2C3218FF, 0x3A3E25FF, 0x00F118E8, 0xFF52553A, 0xFF35371F, 0xFF5B5D45,
+0x744A4D2E, 0x0308F103, 0x25FF292F, 0x17FF5154, 0x1BFF4346, 0x41FF4548, 0x3FFF6769, 0x27746064,
+0xF10F6400, 0x464B2D04, 0x737A59FF, 0x484F2EFF, 0x343B19FF, 0x454B27FF, 0x04F10B8C, 0xFF5C603B,
+0xFF282E0A, 0xFF4E5132, 0xFF525739, 0x10313417, 0x5A35F028, 0x51FF7B7F, 0x88FF7678, 0x1EFFABAD,
+0x26FF4040, 0x60FF4848, 0x2CFF8484, 0x83FF5755, 0x1FFFADB0, 0x47FF414A, 0x3EFF6673, 0x69FF5F6C,
+0x12FF8B97, 0x31FF313C, 0x1EFF525A, 0x76FF4148, 0x21FF99A0, 0x3CFF434A, 0x4624B11E, 0x3011FF40,
+0x2401FF2D, 0xF1110420, 0x60634404, 0x6F7454FF, 0x4D5232FF, 0x767C58FF, 0x222802FF, 0xAC00314C,
+0x133C002D, 0x878C64B1, 0x7C8067FF, 0x4B4C50FF, 0x98006D98, 0x203631E0, 0x3163B81B, 0xB82F3451,
+0x22387109, 0x192CFF1D, 0x80050016, 0xFF121421, 0xFF10131C, 0xBC00A4B0, 0xB3B800A4, 0x050014F1,
+0x694CFF02, 0x7E53FF60, 0x4912FF73, 0x734BFF3A, 0x625FFF67, 0x3649FF59, 0x354FFF2F, 0x2C49FF2F,
+0x50910427, 0xFF1C1E35, 0x2113F828, 0xF9F80E11, 0x00140000, 0x4800C834, 0x05000023, 0x0D0C10F1,
+0x3C22FF0B, 0x5F38FF36, 0x6237FF57, 0x2700FF59, 0x3F14FF1E, 0x764BFF34, 0x6238FF6D, 0x000EEC5B,
+0x0D3129BC, 0x19EC2727, 0xB11EE800, 0xFF787D54, 0xFF757D4C, 0xC45E692F, 0x0100F140, 0x16FF232F,
+0x61FF3540, 0x15FF808B, 0x04E43540, 0x481B04F1, 0x6238FF3F, 0x643AFF57, 0x9062FF59, 0x9D6DFF84,
+0x1009FC91, 0xF11DAC2C, 0xFF596203, 0xFF9DA47A, 0xFF596036, 0xFF7F845B, 0xE071734E, 0x4504F129,
+0x24FF6564, 0x41FF4643, 0x60FF6661, 0x5AFF8683, 0x3E0C7E7B, 0x835F0CF1, 0x6F49FF83, 0xA983FF6F,
+0x461CFFA9, 0x7947FF45, 0x955EFF77, 0x7841FF92, 0x00048475, 0x04004DF8, 0x09CC0000, 0x00081400,
+0x04F127EC, 0xFF4E551F, 0xFF7D8451, 0xFF585E30, 0xFF595F33, 0x94848A5C, 0x4504F121, 0x38FF7279,
+0x51FF666A, 0x3AFF7D80, 0x31FF6769, 0x506C6062, 0x9A6602F0, 0x9C6CFF9A, 0x8D5EFFA0, 0x7041FF91,
+0x0C63FF74, 0x8917F10C, 0x9A64FF8A, 0x6D3CFF9B, 0xB584FF6F, 0x884FFFB7, 0xA267FF8A, 0x955FFFA4,
+0x7E48FF96, 0x9055FF7E, 0xCF93FF8C, 0xC00984C9, 0xFF899356, 0xFF9AA561, 0xFFACB772, 0x7231174C,
+0x4714A6AE, 0x000F5400, 0x00F13154, 0xFFA7B174, 0xFF979F64, 0xFF62672F, 0x7C929560, 0x4224004E,
+0x45501431, 0x547108DC, 0x42FF8A93, 0x2200797D, 0x000FC000, 0xB0002714, 0xB1737145, 0x8345FFA5,
+0x00050477, 0x7400276C, 0x7F05F022, 0x39FFB0B8, 0x14FF6A72, 0x53FF434A, 0x2DFF8289, 0xD0FF5962,
+0x8551B10D, 0x6531FF7B, 0xA570FF5B, 0xF122D098, 0x5C642B20, 0x707743FF, 0x9A9C74FF, 0x61633CFF,
+0x64663EFF, 0x5C5D31FF, 0x6B6C40FF, 0x6C6A41FF, 0x7E7A55FF, 0x4B4523FF, 0x625C3AFF, 0x786F50FF,
+0x00F187C8, 0xFF63573D, 0xFFA59A7E, 0xFF968B6F, 0xF0463B1F, 0x370CF19C, 0x53FF5548, 0x4EFF7267,
+0x74FF786F, 0x69FFA39E, 0x24FF9A96, 0x44FF5451, 0x4A247170, 0x393C0D31, 0x70500988, 0x34FFAAB3,
+0x75401378, 0xD434FF6B, 0x77822208, 0x7CA104C4, 0x9B68FF73, 0x582CFF93, 0xB135B452, 0xFF595D3A,
+0xFF1E2200, 0x9C4F562A, 0x3024F10A, 0x34FF5A64, 0x7EFF5C69, 0x06FFA4B0, 0x33FF2937, 0x39FF5664,
+0x1AFF5E6C, 0x5CFF4453, 0x69FF8897, 0x46FF96A4, 0x65FF7381, 0x5DFF92A0, 0x24FF8C97, 0x2380535E,
+0x441F7C00, 0xFF7C834D, 0x08F106F8, 0xFF747644, 0xFF646635, 0xFF8D8F5E, 0xFF5A5E2C, 0xFF7F8253,
+0x046B723F, 0x14E8000C, 0x312F0800, 0x18666E32, 0x5600F10B, 0x57FF8189, 0x20FF8088, 0x2EFF4951,
+0x24CC5961, 0x00250C00, 0x000033E4, 0x3615F005, 0x2CFF616B, 0x30FF5964, 0x3EFF5B65, 0x6FFF656D,
+0x42FF9299, 0x43FF6066, 0x2FFF5F65, 0x35FF4C54, 0x30FF545C, 0x0EF40025, 0x556330B1, 0x5D6B36FF,
+0x596533FF, 0x487139C0, 0x18FF6C75, 0x927C3A43, 0x314ACC00, 0x442E270B, 0x5232B155, 0x6544FF5D,
+0x3E20FF6E, 0xF18E2C43, 0x6D70510C, 0x424928FF, 0x3E4825FF, 0x46502DFF, 0x343A1EFF, 0x20240BFF,
+0x2D3015FF, 0xA800230C, 0x8669B109, 0x6141FF83, 0x5A35FF60, 0xF004F058, 0x7A7B5101, 0x2E2F07FF,
+0x31330CFF, 0x4B4C2AFF, 0x7113A0FF, 0xFF373A1D, 0x001E2305, 0x2E0CF114, 0x54FF4A50, 0x07FF737B,
+0x11FF262E, 0x1CFF2E36, 0x3EFF3B43, 0x76FF6168, 0x086C98A1, 0x575E3C71, 0x474C2EFF, 0x3C001430,
+0x3E19B12D, 0x542CFF3A, 0x956DFF4F, 0xB1006093, 0xFF6A6D42, 0xFF5D5F30, 0xA87E8454, 0x4918F112,
+0x63FF6A7A, 0x0EFF8697, 0x03FF313F, 0x5CFF232E, 0x46FF7B86, 0x3FFF676F, 0x22FF6269, 0x30FF444B,
+0x32FF5155, 0x163C4F53, 0x36371750, 0x7A440DFF, 0xFF262661, 0x1846462A, 0x1B04F10F, 0x7EFF3B41,
+0x3BFFA4AA, 0x49FF6366, 0x40FF6E70, 0x04546365, 0x4B4E3971, 0x393945FF, 0x363181CC, 0xAEB41F21,
+0x304B00F1, 0x3855FF2C, 0x263EFF34, 0x182CFF20, 0x7113B813, 0xFF121524, 0xA8121420, 0x131780CC,
+0x100FFF12, 0x04FCFF0E, 0x3B2A11F0, 0x5A39FF37, 0x855AFF53, 0x7542FF7A, 0x411FFF67, 0x4F51FF36,
+0x2339FF47, 0x2A44FF1D, 0xD704FF24, 0x44495F71, 0x34364BFF, 0x040063F8, 0x04F8000F, 0x20222F80,
+0x22212FFF, 0xF18C0CFF, 0x0D0C1A08, 0x08090DFF, 0x454938FF, 0x171E00FF, 0x464D2CFF, 0x474E2DFF,
+0x5EB10058, 0x4DFF7B83, 0x30FF737C, 0x0FFC575F, 0x4D2C36F0, 0x512EFF49, 0x663EFF4D, 0x8D5FFF61,
+0xA46FFF87, 0x965AFF9B, 0x662CFF8B, 0x7346FF5B, 0x6A43FF6A, 0x8A63FF62, 0x5D36FF82, 0x5229FF55,
+0x7E54FF4B, 0x5F36FF77, 0x6D42FF57, 0x4A18FF62, 0x8A56FF3E, 0x345CFF80, 0x7B0BF13A, 0x6A3EFF72,
+0x9367FF63, 0x9264FF8D, 0x7043FF8C, 0x7B53FF6D, 0x724EFF7A, 0x0024EC72, 0x0C009638, 0x2911F043,
+0x15FF5250, 0x30FF3D3B, 0x3BFF5758, 0x53FF6465, 0x37FF7C7D, 0x6FFF5E5F, 0x63FF9899, 0x1CFF9395,
+0x6120F122, 0x4FFF9396, 0x4AFF8386, 0x61FF8288, 0x61FF9BA1, 0x2AFF959D, 0x66FF5D65, 0x5DFF99A1,
+0x41FF8A91, 0x18FF656A, 0x54FF373B, 0x12FF7377, 0x1258353A, 0x5C623231, 0x8C0019C4, 0xA8411008,
+0x6D47F144, 0x673BFF6C, 0x7148FF68, 0x4721FF73, 0x8E66FF4C, 0x602EFF93, 0x8D56FF66, 0x7F4CFF90,
+0x8959FF82, 0x6B41FF8D, 0xBB91FF70, 0x8653FFC0, 0xA16CFF89, 0x9663FFA4, 0x8F5BFF98, 0x955BFF8F,
+0xA165FF90, 0x985FFF99, 0x894DFF8F, 0xA660FF7E, 0x8A42FF99, 0x9F5AFF7D, 0x71377C92, 0xFF6A6D38,
+0x9C5B5D2B, 0x720CF14B, 0x75FFA5AF, 0x53FFABB4, 0x7EFF898F, 0x80FFB0B3, 0x4DFFAFB3, 0x49FF7880,
+0x1294747E, 0x7104AC00, 0xFFACAF78, 0xE83E430B, 0x5204F141, 0x82FF7F8A, 0x6CFFB3BE, 0x25FF9DA8,
+0x6AFF5661, 0x32789BA6, 0xB2BB8231, 0x74002340, 0x13D00000, 0x8C955E31, 0x74310EE4, 0x3D68A0A9,
+0x00094800, 0xB4000500, 0x3BB00024, 0x81864E71, 0x75764CFF, 0x06F33568, 0xFF525329, 0xFF939266,
+0xFF98956C, 0xFF8A8460, 0xFF7A7356, 0xF109E46B, 0x83775F2C, 0x483C24FF, 0x372811FF, 0x7F7157FF,
+0x796B4EFF, 0x847659FF, 0x86785DFF, 0x61523DFF, 0x887C64FF, 0x857D56FF, 0x696536FF, 0x797545FF,
+0x898756FF, 0x807F4FFF, 0x636534FF, 0x900018AC, 0x6E257114, 0x792DFF64, 0x002CA46E, 0x35711F84,
+0x4BFF6671, 0x14807A85, 0x7B4804F1, 0x6E45FF73, 0x7E59FF69, 0x805BFF7A, 0x673EFF7C, 0xF0047C62,
+0x6F784317, 0x76804BFF, 0x9FAC77FF, 0xA5B382FF, 0x5F6F3EFF, 0x364711FF, 0x5D6E37FF, 0x52642AFF,
+0x798B51FF, 0x8C7940FF, 0xFF75D12D, 0xFF738249, 0xFF9BA870, 0x38606E33, 0x573C0034, 0x434C1331,
+0x64B10B00, 0x6DFF939A, 0x37FF9EA3, 0x0720666A, 0x0AE44A10, 0xFF6E7130, 0x37400ECC, 0xA8FF666D,
+0x19080028, 0x5F692D31, 0x527109E4, 0x41FF7D85, 0x1E846973, 0x002A7C00, 0x5C314FCC, 0x34948994,
+0x9AA46F31, 0xB0005038, 0x2014F125, 0x1AFF4956, 0x23FF4049, 0x29FF454E, 0x11FF494F, 0x20FF2F35,
+0x1FFF3D45, 0x21FF3E46, 0x2EFF434F, 0x34EC525E, 0x5F2A05F0, 0x703EFF52, 0x6132FF66, 0x4A1EFF58,
+0x895FFF43, 0x6994FF82, 0x745610F1, 0x492DFF7F, 0x5338FF54, 0x5838FF61, 0x7656FF65, 0x7053FF81,
+0x8B6EFF77, 0x4324FF8F, 0xF118E842, 0x272F0A10, 0x474E2CFF, 0x383E22FF, 0x2A2E13FF, 0x404326FF,
+0x7D7D61FF, 0x585B3EFF, 0x3A3D1EFF, 0x08F1410C, 0xFF72744F, 0xFF565630, 0xFF383812, 0xFF31310D,
+0xFF3D3D1B, 0x94646546, 0x08A00022, 0x1B0018F1, 0x2A0AFF18, 0x300CFF25, 0x653EFF2A, 0x5B32FF5D,
+0x7D58FF53, 0x1C00FF75, 0x9E71FF14, 0xA174FF95, 0x9168FF98, 0xF127F889, 0x31381700, 0x42492AFF,
+0x656B49FF, 0x212701FF, 0x5C000198, 0x0017F00F, 0x45FF1B21, 0x70FF6D73, 0x24FF9C9F, 0x14FF4D55,
+0x3FFF3745, 0x74FF6173, 0x0FFF97A8, 0x1CFF3442, 0x4DFF3C47, 0xD134D077, 0x340BFF50, 0x8259FF2D,
+0x5F38FF7D, 0x7118245D, 0xFF4B4A2E, 0xE84B4A2C, 0x8F40000F, 0x19180040, 0xF11480FF, 0x3A3F1714,
+0x66693CFF, 0x545529FF, 0x2C2D05FF, 0x484A25FF, 0x646847FF, 0x414433FF, 0x353746FF, 0x2C2C48FF,
+0xEC009AA8, 0x6DD40018, 0x00DBC800, 0x1CF19AD8, 0xFF1C2135, 0xFF1F2233, 0xFF1D212D, 0xFF151821,
+0xFF191C23, 0xFF111216, 0xFF0D0F0C, 0xFF040800, 0xFF555A43, 0xFF182000, 0x88717A4F, 0x4A2F9006,
+0x4349FF40, 0xF045FF3C, 0x252BD2F4, 0x191F35FF, 0x2C3144FF, 0xF82336FF, 0x000800EA, 0x303F00F1,
+0x2B38FF2E, 0x1E2EFF29, 0x1020FF1F, 0x00731011, 0x21F00500, 0xFF5B5F50, 0xFF373D23, 0xFF242A0E,
+0xFF62684C, 0xFF5B6049, 0xFF4B5233, 0xFFA0A97C, 0xFF384112, 0xFF454D24, 0xFF373D17, 0xFF575E35,
+0xFF767C50, 0xBC001110, 0x3B380003, 0x712C0000, 0xFF525B2E, 0x90596037, 0x3008802C, 0x9A71FF2B,
+0x0A24FF95, 0x3E471C31, 0x90000A0C, 0x3A04000D, 0x4C1824F1, 0x4110FF42, 0x471BFF39, 0x8D61FF41,
+0x7341FF87, 0x400EFF6F, 0x8458FF3C, 0x5B35FF83, 0x704FFF5B, 0x6D4DFF73, 0xAC86FF72, 0x8256FFB0,
+0x6E44FF83, 0x8052886D, 0xFF898B5C, 0xFF666839, 0x800006FC, 0x7D4EB157, 0x6736FF7B, 0x5C2BFF65,
+0xF112045A, 0x92975D04, 0x6B7337FF, 0x727A3EFF, 0x80884DFF, 0x868D57FF, 0x01F00EF4, 0xFF888C69,
+0xFF474A2B, 0xFF494C2D, 0xFF484C2B, 0x38000C08, 0x8846108B, 0x7C819003, 0x65673FFF, 0x603C15FF,
+0x692AF102, 0x252203FF, 0x5B5639FF, 0x8D8765FF, 0x595623FF, 0x7F7D44FF, 0x85824DFF, 0x898757FF,
+0x524D25FF, 0xD2CFA6FF, 0xA29E6FFF, 0x706E3DFF, 0x9B9B69FF, 0x959765FF, 0xA4A973FF, 0x194004FC,
+0xA8FF4651, 0x760CF132, 0x5CFFACBB, 0x61FF92A3, 0x2AFF97A6, 0x3EFF5E6A, 0x51FF6C70, 0x72FF7F83,
+0x1D80A2AB, 0xC18200F1, 0xA76BFFB8, 0x5C26FFA1, 0x915EFF57, 0x0003308A, 0x5EB132CC, 0x1DFF8A93,
+0x3CFF4C53, 0x0EFC6F74, 0x632E01F0, 0x753DFF5A, 0xA369FF6A, 0x8145FF98, 0x32D0FF76, 0x0018D000,
+0x507123B8, 0x63FF8089, 0x0504939C, 0x97A06931, 0xA8004C4C, 0xC6913121, 0x714758BD, 0xFF96A06C,
+0x00555F2B, 0x5ED00014, 0x9B6216F0, 0x8C5DFF98, 0x875BFF8A, 0x8C5EFF86, 0x5D30FF8D, 0x6A44FF60,
+0x8A68FF6F, 0x583BFF90, 0x4D34FF61, 0x7048FF57, 0x551BF1AB, 0x9484FF62, 0x6F5CFFA4, 0x3C28FF7E,
+0x573EFF4D, 0x7E61FF67, 0x6245FF8C, 0x2D16FF70, 0x3F23FF3C, 0x865FFF4A, 0xAE80FF8E, 0x403CA8B5,
+0xFF696737, 0x46715E90, 0x4BFF7776, 0x1884787A, 0x565C1C31, 0x594024A4, 0x6CFF9399, 0x7C404009,
+0x0EB0FF72, 0x5F2808F1, 0x4E1BFF56, 0x6138FF46, 0x7850FF5C, 0x421AFF73, 0x6D41FF3D, 0x000E8467,
+0x4FB14D38, 0x52FF7A84, 0x53FF7A87, 0x05007684, 0x82935C71, 0x63773AFF, 0x35312A38, 0x00085D6F,
+0x72844AB1, 0x9BAA71FF, 0x79884FFF, 0x57312894, 0x0C808492, 0x3C460AC0, 0x70783FFF, 0x737B42FF,
+0x0005ECFF, 0xA4000504, 0x025C004D, 0x494F1F31, 0x5B71328C, 0x65FF8A91, 0x24F8969E, 0x868F56B1,
+0x454E19FF, 0x5C6431FF, 0x4D3104FC, 0x1E0C757F, 0x2CC42010, 0x6D7A02F0, 0x5F6C34FF, 0x9DAA74FF,
+0xA0AD78FF, 0x8C8751FF, 0x7011F038, 0x7C8556FF, 0x889166FF, 0x5F663DFF, 0x363C16FF, 0x49512AFF,
+0x4E572CFF, 0x515D2DFF, 0xFC612FFF, 0x5E00F009, 0x7F8C57FF, 0x545E2CFF, 0x454E1FFF, 0x084823FF,
+0xFF5057C0, 0xFF5A4D2D, 0xFF736548, 0xE182CC45, 0x62FF5042, 0x37FF8F82, 0x82FF6158, 0x3B1CA8A2,
+0x2A2B0B71, 0x262A09FF, 0x48000EA4, 0x2F115013, 0xC413FF2A, 0x6262E1B7, 0x4E4F30FF, 0x2F3011FF,
+0x666748FF, 0x90002D34, 0x3408F13A, 0x0BFF5759, 0x37FF2E30, 0x26FF5A5C, 0x19FF4748, 0x33FF3839,
+0x05305152, 0x482B08F1, 0x3717FF45, 0x4826FF32, 0x4722FF42, 0x512CFF3F, 0x6B48FF49, 0x002C7061,
+0x1E312B58, 0x31703E49, 0x3D1300F1, 0x441FFF32, 0x7E59FF3C, 0x4219FF76, 0x31128C3A, 0xE07C8357,
+0x15B80014, 0xA37708F1, 0x4A1CFF9C, 0x6634FF44, 0x6231FF5C, 0xA16DFF54, 0x9A67FF90, 0xB13ACC8C,
+0xFF4D582D, 0xFF566139, 0x085E6641, 0x7A513114, 0xF109D475, 0x76755700, 0x403C21FF, 0x423E21FF,
+0x807C61FF, 0x05F09498, 0xFF686449, 0xFF6D6E4C, 0xFF777C53, 0xFF505125, 0xFF616334, 0x00F10780,
+0xFF62643F, 0xFF676B50, 0xFF6C6F66, 0xC42F3140, 0x233A31B3, 0x00050421, 0xB800F4A8, 0x1E04009A,
+0x2F4200F1, 0x2938FF2A, 0x212DFF26, 0x161EFF1F, 0xF10EFC16, 0x0B0C0E04, 0x050801FF, 0x0E1100FF,
+0x3F4328FF, 0x717952FF, 0x31B12848, 0x4EFF4E59, 0x79FF5C66, 0x87086C73, 0x30364CB1, 0x293043FF,
+0x252B3BFF, 0x41310004, 0xDC20282A, 0x2D2E4340, 0xF14138FF, 0x2F2E4008, 0x242333FF, 0x0D0D19FF,
+0x08090BFF, 0x5E6150FF, 0x4B4F34FF, 0x20001578, 0x35209029, 0x2009FF32, 0xC420FF1B, 0x3F4AE136,
+0x4A542FFF, 0x303811FF, 0x3B4216FF, 0x0C0034E8, 0x5A2E4016, 0x2ADCFF53, 0x5E2D18F1, 0x9367FF56,
+0x2F05FF8C, 0x9668FF28, 0x491AFF90, 0x7243FF46, 0x6B3EFF6F, 0x572BFF68, 0x7C4AFF50, 0x9158FF72,
+0x00272889, 0x31F01790, 0xFF8D9562, 0xFF7C8254, 0xFF585B2E, 0xFF575927, 0xFF7B7D4B, 0xFF8D9061,
+0xFF7B7C54, 0xFF524F2E, 0xFF36320F, 0xFF8F8D64, 0xFF9B9A6C, 0xFF909462, 0xFF676B39, 0xFF7D814F,
+0xFF757849, 0xFF606338, 0x04F1190C, 0xFF7E8058, 0xFF595C31, 0xFF4E5122, 0xFF818553, 0xFC7C804E,
+0x4204F118, 0x53FF7178, 0x19FF7F88, 0x55FF4048, 0x35FF777E, 0x257C5458, 0xB1391400, 0xFF61654A,
+0xFF484D2F, 0x94565C3A, 0x1B00B110, 0x4D25FF15, 0x512CFF48, 0xF13EA44F, 0x2F2D1848, 0x403B28FF,
+0x514B31FF, 0x918F5FFF, 0x5F5E26FF, 0x8C8B53FF, 0x959561FF, 0x7B784BFF, 0x949367FF, 0xA5A277FF,
+0x706F41FF, 0x717040FF, 0xA4A876FF, 0x606636FF, 0x5B6332FF, 0x75824DFF, 0x8E9D64FF, 0x96A665FF,
+0xA6BA75FF, 0x74853FFF, 0x4B5A19FF, 0x9BA26FFF, 0x7E405834, 0x14FFAEB7, 0x5208F140, 0x6DFF868E,
+0x4EFF9EA6, 0x25FF7B82, 0x3CFF4F55, 0x2FFF626B, 0x0EC05761, 0x7117AC00, 0xFF464B13, 0x64A3A872,
+0x8653402B, 0x1DBCFF7E, 0x323B0231, 0xD0001CB8, 0x14D00041, 0x7118EC00, 0xFF959D64, 0x1C889057,
+0x2D980028, 0xCAD39C40, 0xF112BCFF, 0x6B743F04, 0xA3AD78FF, 0xA7B17CFF, 0x78814AFF, 0x8D9357FF,
+0x2CF12364, 0xFF8C8C58, 0xFF71713F, 0xFF888653, 0xFF7E7C4B, 0xFF88835B, 0xFF504A26, 0xFF6C6342,
+0xFF8F8669, 0xFF8D806D, 0xFF7F7164, 0xFF493830, 0xFF64534B, 0xFF524233, 0xFF463724, 0x84988972,
+0xB6C0006B, 0x543604F1, 0x421DFF5F, 0xA17AFF4A, 0x5C38FFA9, 0x8863FF62, 0xF112288C, 0x8D8B6400,
+0x686842FF, 0x797953FF, 0x76774BFF, 0x40312CC4, 0x56F86F71, 0x4E552171, 0x818852FF, 0x38003D0C,
+0x6A00F159, 0x36FF8E93, 0x48FF595E, 0x3FFF6C71, 0x297C676D, 0x7B864C31, 0x04F11424, 0xFF869260,
+0xFF465325, 0xFF647443, 0xFF44561A, 0x887F9153, 0x6D33713B, 0x793FFF5B, 0x2051AC67, 0x05508148,
+0x5DFF7CD2, 0x44FF8998, 0x32FF717F, 0x36C4636E, 0xFF6D77A1, 0xFF9BA569, 0xC85E662D, 0x612E4024,
+0x2038FF5D, 0x8E956271, 0x7F8652FF, 0x2E712018, 0x39FF5D64, 0x3294666D, 0x001E6C00, 0x840002BC,
+0x1E0CF128, 0x53FF4953, 0x38FF808E, 0x43FF6775, 0x3CFF707E, 0x40FF6675, 0x4AFF6573, 0x0F846D7B,
+0x78865371, 0x99A577FF, 0x32B122D8, 0x11FF545D, 0x3AFF333C, 0x40245E67, 0x0048A800, 0x2271431C,
+0x69FF4B58, 0x2814919E, 0x474E2231, 0x2A3125CC, 0x73D04D52, 0x5D4E3131, 0x21719418, 0x2FFF483D,
+0x06785950, 0x8A856571, 0x474425FF, 0xE8001878, 0x7550313B, 0x0045B071, 0x3F7109C8, 0x25FF595C,
+0x1F504344, 0x725004F1, 0x4C27FF71, 0x815FFF4A, 0x3917FF80, 0x2F0FFF38, 0x0040902E, 0x44004144,
+0x0D940028, 0xB1283C00, 0xFF2B2F0E, 0xFF3B411F, 0x004C5230, 0x23500023, 0x422020F1, 0x5836FF3B,
+0x8B68FF4E, 0x5D35FF81, 0x491FFF52, 0x5329FF3E, 0x6D43FF48, 0x5D34FF62, 0xB58AFF55, 0x380BFFAC,
+0x3508FF2F, 0xA177FF2C, 0x711CD09A, 0xFFABB18B, 0x2C30370E, 0x7628F126, 0x23FF9EA8, 0x3BFF4551,
+0x48FF5E6C, 0x32FF6E7A, 0x0CFF5662, 0x0EFF2D35, 0x23FF2D35, 0x1EFF3F45, 0x2BFF3D41, 0x0DFF5153,
+0x57FF3435, 0x38FF7976, 0x68FF5753, 0xA7B88A85, 0x655F47B1, 0x4F4B30FF, 0x636442FF, 0x50B10024,
+0x37FF7B79, 0x21FF6463, 0x1CE84E4D, 0x3F4231B1, 0x4B4F4EFF, 0x2D3041FF, 0x000090B4, 0xBDCC0005,
+0x00A4D800, 0xA80090C4, 0x9FCC006D, 0x7195B800, 0xFF060912, 0xA8121318, 0x04AC00C2, 0x00100210,
+0x2A2D0FF1, 0x1F2404FF, 0x6A724BFF, 0x646C43FF, 0x38421FFF, 0x545C47FF, 0x3E4347FF, 0x363B4EFF,
+0x56716904, 0x40FF3A40, 0xAA20282D, 0x27284431, 0x05F01E50, 0xFF2A2B40, 0xFF303145, 0xFF323143,
+0xFF131220, 0xFF0F0F19, 0x04F12844, 0xFFABAE9B, 0xFF5C6045, 0xFF353A1C, 0xFF363B1D, 0x142D3118,
+0x3505F014, 0x42FF4B54, 0x27FF5964, 0x42FF404A, 0x3CFF5F67, 0x78FF5F66, 0x7D577136, 0x441EFF77,
+0x0004E03E, 0xD000275C, 0x5014000E, 0x8F5C05F0, 0x5D2BFF88, 0x4C20FF59, 0x5326FF4B, 0x9468FF50,
+0x25FCFF8D, 0x696E3671, 0x868B51FF, 0x54714FC4, 0x74FF7F87, 0x30309CA2, 0x5B2904F1, 0x7F4DFF59,
+0xBD8EFF7D, 0x6F44FFBA, 0x704DFF6C, 0xF1520873, 0x69683C04, 0x8A8C5BFF, 0x9EA572FF, 0x616835FF,
+0x7F8555FF, 0x0CF10534, 0xFF262800, 0xFF2E330B, 0xFF393B16, 0xFF343911, 0xFF515427, 0xFF666C3C,
+0x50575C33, 0x5726710D, 0x8556FF4F, 0xF110987D, 0x6F755110, 0x313512FF, 0x636947FF, 0x393D24FF,
+0x41452EFF, 0x282C13FF, 0x1C2206FF, 0x707555FF, 0x04F10728, 0xFF515733, 0xFF4A4E2D, 0xFF1F2109,
+0xFF3D3C2A, 0xF42A261A, 0x5A09F09B, 0x3BFF8583, 0x13FF6F6F, 0x5DFF4548, 0x1AFF8C8E, 0x2EFF4344,
+0x90FF5556, 0x9566501E, 0x8C4AFF93, 0x53576143, 0x909865FF, 0x2CB13300, 0x86FF5461, 0x51FFB0BF,
+0x5EFC7E91, 0x0058A000, 0x6880050C, 0x73FF949D, 0xDCFF9FA6, 0x2604F10E, 0x04FF5862, 0x60FF3640,
+0x4BFF9099, 0x08FF767E, 0x26603139, 0x5A2701F0, 0x8047FF52, 0x4B0FFF77, 0x6F34FF41, 0x12D0FF67,
+0x73794931, 0xA0002664, 0x7A417121, 0xAE75FF71, 0x001CBCA5, 0xF8004B98, 0x9B62B150, 0x8B52FF93,
+0x6A34FF83, 0x40318463, 0xFFA5AC76, 0x63801E00, 0x82FF8F98, 0x54FFAEB7, 0x003C000E, 0xA56704F1,
+0xA164FF9F, 0xA168FF9D, 0x7A44FFA0, 0x4D15FF7A, 0xB105044E, 0xFF68633B, 0xFF736D49, 0x4C6B633E,
+0x6014F1A5, 0x5CFF8176, 0x2CFF7567, 0x49FF4031, 0x4DFF5D4E, 0x1FFF6658, 0x52FF3C2F, 0x3DFF7265,
+0x54FF6155, 0x73307A6E, 0xA9A07F71, 0x686240FF, 0x553192C0, 0x6E2C7772, 0x72510DF0, 0x6246FF75,
+0x482CFF63, 0x8062FF49, 0x9270FF81, 0x4721FF92, 0x4016FF49, 0x281CFF3F, 0x5B5E2F31, 0x7000523C,
+0x2F00F115, 0x4EFF575A, 0x63FF7277, 0x2DFF878C, 0x18C0575D, 0x5F2604F1, 0x6A35FF56, 0x713FFF60,
+0x5325FF65, 0x703FFF47, 0x404A8862, 0xFF758546, 0x2831571C, 0x4FC45062, 0x314C8800, 0x6C7D8C53,
+0x783D3142, 0xB156F469, 0xFF99A468, 0xFF697537, 0xF46F793C, 0x15140029, 0x7C460CF1, 0x3F0CFF75,
+0x6F3CFF3B, 0x814DFF6B, 0x8F5BFF7A, 0xBA86FF88, 0x703CFFB3, 0x00379C69, 0x5331483C, 0x2CC47D83,
+0x424B16B1, 0x606B33FF, 0x798448FF, 0x40004608, 0x5F180057, 0x70814DB1, 0x667647FF, 0x6E7E4DFF,
+0x98000904, 0x450CF10A, 0x49FF6975, 0x31FF6F78, 0x50FF5760, 0x2EFF7882, 0x24FF5862, 0x3DFF4D5A,
+0x2FD86875, 0x875302F0, 0x6F3EFF7D, 0x5B2FFF67, 0x5027FF54, 0x8043FF4B, 0x796CE264, 0x45371AFF,
+0x504529FF, 0x5D5639FF, 0x6521A6EC, 0x31245068, 0x08737351, 0x1F3C0023, 0x747651B1, 0x3C3E19FF,
+0x6F7051FF, 0x000013F8, 0x538C0005, 0x84875C50, 0x014031FF, 0x386E7021, 0x3619F046, 0x34FF4E51,
+0x11FF4A4C, 0x33FF2729, 0x11FF4A4E, 0x0DFF2C31, 0x1FFF2B31, 0x33FF3F45, 0x37FF525A, 0x4BFF565E,
+0x70FF6870, 0x1B08F122, 0x24FF333A, 0x17FF3A43, 0x19FF2D36, 0x35FF323C, 0x3DFF505A, 0x4F7C5C64,
+0x50592E31, 0x14711EC0, 0x00FF3A43, 0x04442029, 0xA3AB86C0, 0x2D3311FF, 0x353B17FF, 0x313408FF,
+0xD06D7546, 0x1814002C, 0x919A6D50, 0x26EC3FFF, 0xFF4C52A1, 0xFF7E8261, 0x1476795C, 0x4604F12D,
+0x50FF6C6E, 0x2FFF797A, 0x67FF5350, 0x49FF8884, 0x00046C67, 0x0E0018F1, 0x492CFF13, 0x5230FF4D,
+0x724CFF52, 0x835DFF72, 0x663DFF87, 0x431AFF69, 0x6849FF45, 0x6B65FF67, 0x3A43FF6A, 0x00C7C837,
+0x3D3109EC, 0x95AC2426, 0x294108F1, 0x293EFF29, 0x273AFF28, 0x1C2AFF24, 0x0511FF16, 0x0B12FF03,
+0x00D1A808, 0x24F122F0, 0xFF0A0A0C, 0xFF080903, 0xFF1D210A, 0xFF353B19, 0xFF60673E, 0xFF414920,
+0xFF0F1900, 0xFF303821, 0xFF424846, 0xFF313842, 0xFF3A3F53, 0xFF3D415A, 0x08363A55, 0x2D4C71B9,
+0x2543FF2C, 0x00C83024, 0x22105EFC, 0x0861F4F4, 0x0D13FF08, 0xF1B0600E, 0x373A2708, 0x3E4325FF,
+0x8D916EFF, 0x666A45FF, 0x575B36FF, 0x606640FF, 0x3C314744, 0x1ECC545E, 0x1C2302B1, 0x2C3210FF,
+0x616745FF, 0x47913870, 0x00FF6065, 0x40FF1218, 0x64911E3C, 0x5D6534FF, 0x767C4CFF, 0x03F21040,
+0xFF373914, 0xFF5C5E39, 0xFF484F23, 0xFF838A57, 0x22A47039, 0x9C6504F1, 0x7944FF93, 0x6A3BFF70,
+0x8051FF67, 0x6A38FF7E, 0x00304068, 0x04F13028, 0xFF777A4F, 0xFF716F49, 0xFF67653E, 0xFF313206,
+0x78838755, 0x460BF22F, 0x28FF6F77, 0x60FF4F57, 0x0FFF838A, 0x45FF3034, 0x71FF6369, 0x34FF9094,
+0x0026285D, 0xA8003768, 0x2968001E, 0x623920F1, 0x865DFF5B, 0x6E4CFF7F, 0x4321FF67, 0x613BFF3C,
+0x7D59FF5B, 0x1B02FF77, 0x230DFF17, 0x4932FF1E, 0x250DFF44, 0x270BFF1D, 0x5C3DFF21, 0x00394055,
+0x22312A48, 0x85A8373B, 0x3D3B2C31, 0x36319E60, 0x54885A5A, 0x4A5024B1, 0x555C33FF, 0x252809FF,
+0x4E10433C, 0x52302820, 0x3AACFF4B, 0x7144F400, 0xFF5A6628, 0xC8899759, 0x7C437132, 0xB773FF6D,
+0xB14958A6, 0xFF91A25C, 0xFF9BAB6A, 0xE4758046, 0x5015B155, 0x773BFF48, 0xB377FF6D, 0x003A4CA9,
+0x28711508, 0x12FF505A, 0x3C983D45, 0x98A26371, 0x606B29FF, 0x54003FA0, 0x51100060, 0x71050400,
+0xFF686F39, 0x04979F66, 0x12C00033, 0xB11E6C00, 0xFF787D43, 0xFF858A52, 0x006C7139, 0x0A080023,
+0x7132E400, 0xFF626933, 0xF09EA571, 0x6A37801C, 0xBB85FF63, 0x2D70FFB4, 0x464C0E50, 0x1D9C60FF,
+0xFF7E8170, 0xFF7D7D47, 0x09F00A0C, 0xFF68653C, 0xFF69653F, 0xFF79744A, 0xFF7C7751, 0xFF90896D,
+0xFF7A6E5E, 0x1871A34C, 0x34FF2B1E, 0xC5A44A3D, 0x605000F1, 0x624EFF6C, 0x7156FF6D, 0x5235FF7B,
+0x31AFE459, 0x0C625D3F, 0xC01000C0, 0x513424F1, 0x6B50FF55, 0x6B57FF6F, 0x6050FF70, 0x614EFF66,
+0x5943FF66, 0x8063FF5E, 0x8E6DFF85, 0x7754FF91, 0x875FFF7A, 0x7E4FFF86, 0x5A2BFF7C, 0x7248FF58,
+0x31497071, 0x5483855D, 0x33C4002D, 0x3F481140, 0x711D88FF, 0xFF8C9566, 0x18475025, 0x8349B13A,
+0x6527FF78, 0x7035FF57, 0xB14F8C62, 0xFF6E7B43, 0xFF727F47, 0x0C57642C, 0x4207314D, 0x006A3C34,
+0x4F714CCC, 0x32FF818D, 0x0160646E, 0x7A4400F1, 0x501CFF73, 0x5422FF49, 0x7240FF50, 0x000C3C6E,
+0x5A313948, 0x0514898D, 0x969A6871, 0x707442FF, 0x1C002A58, 0x6935311E, 0x3141E462, 0x98748042,
+0x81437160, 0x955CFF71, 0xF14DA486, 0x74845300, 0x576738FF, 0x7D8D5CFF, 0x42501FFF, 0x3B7140E0,
+0x37FF6370, 0x5C2C5F6C, 0x1011D400, 0x2130E837, 0x64086570, 0x3D471331, 0x26314824, 0x361C4E54,
+0x4C4E2671, 0x5B5030FF, 0x00F18E2C, 0xFF494225, 0xFF666344, 0xFF52522E, 0xFC2E3009, 0x4204F153,
+0x45FF6165, 0x21FF6465, 0x37FF4243, 0x0FFF5B5B, 0x4A3C3333, 0x5A3B08F1, 0x4B2BFF59, 0x2E09FF4A,
+0x5F32FF2C, 0x7548FF5C, 0x6F48FF72, 0x00177C6D, 0x22B11418, 0x3BFF393D, 0x50FF5054, 0x3200686F,
+0xF13B5000, 0x222A0104, 0x455026FF, 0x3A421BFF, 0x606745FF, 0x444B2AFF, 0x2D20230C, 0xF1B0BC4C,
+0x33FF2B02, 0x08FF4C56, 0x45FF232D, 0x1CFF626A, 0x09383941, 0x58603740, 0xB10AD0FF, 0xFF3D461B,
+0xFF929A73, 0xCC111800, 0x31980045, 0xF008D000, 0x525A2B05, 0x6F744CFF, 0x414520FF, 0x72774FFF,
+0x7D825AFF, 0x0023CCFF, 0x00F12D30, 0xFF4C4C32, 0xFF2D2E0F, 0xFF777850, 0xAC5E5F35, 0x0A04005F,
+0x005FB400, 0xC4002524, 0x1C08F117, 0x17FF3E3B, 0x47FF3B38, 0x1EFF6D6A, 0x36FF4842, 0x4AFF615C,
+0x3C307470, 0x626365B1, 0x2E3140FF, 0x262D3FFF, 0x39B10EA8, 0x35FF2025, 0x3AFF1E20, 0xDBA82624,
+0x05003810, 0xB0181B21, 0x070E31A9, 0x900EA404, 0xFF080A09, 0xFF060608, 0xA1B9FC0E, 0x28FF2125,
+0x00FF464C, 0x41BC1F26, 0x502E04F1, 0x2C14FF49, 0x3D32FF24, 0x474BFF35, 0x4A5DFF42, 0xF1780845,
+0x42475D00, 0x3B3F58FF, 0x373854FF, 0x36384FFF, 0x2400E124, 0x0B1531DC, 0xF1BE000B, 0x07070900,
+0x1E1F19FF, 0x333623FF, 0x303517FF, 0x4271182C, 0x4BFF6367, 0x33806C70, 0x422100F1, 0x4A2DFF3B,
+0x2408FF41, 0x2509FF1E, 0x4029B01F, 0xFF262A0F, 0xC4000F20, 0x43237175, 0x5C36FF3E, 0xB1201C56,
+0xFF4B5226, 0xFF555B2F, 0x78747950, 0x5633312E, 0x311BF052, 0xB8979E6B, 0x763F403A, 0x2068FF73,
+0x00077400, 0x4FC04548, 0x3DFF7E80, 0x6DFF6C6E, 0x7CFF9B9F, 0x5816F030, 0x50FF7E84, 0x4AFF7977,
+0x52FF7371, 0x41FF7D7E, 0x68FF6B71, 0x0FFF9199, 0x41FF3741, 0x4CFF656E, 0x4CFF6C72, 0x3E212BF4,
+0x31118439, 0x6CB4BB8F, 0xAF08F14B, 0x3EFFD6DE, 0x2BFF5C62, 0x49FF464B, 0x6BFF676D, 0x06FF898F,
+0x247C2027, 0xF1479800, 0x54593950, 0x545942FF, 0x1B200AFF, 0x464E36FF, 0x232C11FF, 0x353E23FF,
+0x606850FF, 0x171F07FF, 0x0E1300FF, 0x5D6349FF, 0x54583FFF, 0x272913FF, 0x424226FF, 0x898B64FF,
+0x6A7044FF, 0x626B3EFF, 0x747F55FF, 0x212807FF, 0x434A28FF, 0x888F63FF, 0x717946FF, 0x545D28FF,
+0x525D25FF, 0x738143FF, 0x08F10004, 0xFF5E6D36, 0xFF6F7E47, 0xFF8E9E5D, 0xFF8FA05C, 0xFFB2C281,
+0x206E7C3E, 0x1F240055, 0x7E864AB1, 0x99A263FF, 0x919D5FFF, 0x28000014, 0xB17D314B, 0x00361CA7,
+0x14003B40, 0x823E3232, 0x6136B477, 0x42FF6E78, 0x03C47175, 0x31401000, 0x48596126, 0xA368206D,
+0x7B110550, 0x46B14548, 0x64FF797E, 0x5AFF979C, 0x27088D92, 0x713B04F1, 0x5F29FF6A, 0xA36FFF58,
+0x5D29FF9C, 0x8956FF56, 0x002E0482, 0x380072CC, 0x4010F131, 0x2CFF6F73, 0x56FF5B5D, 0x2DFF888B,
+0x63FF5F5F, 0x54FF8E8C, 0x41FF7E7A, 0x50FF716E, 0x04D87E7B, 0x40A0B800, 0xFF766D5E, 0x0CF1960C,
+0xFF483E34, 0xFF352C1D, 0xFF7E7663, 0xFF6E664F, 0xFF9B9478, 0xFF6A6545, 0xF0797552, 0xBF840091,
+0x6D5708F1, 0x3518FF73, 0x5A3FFF39, 0x3C28FF5E, 0x4333FF41, 0x6A58FF49, 0x31A54071, 0x30363016,
+0x3610F1AA, 0x2EFF5650, 0x45FF514C, 0x77FF716E, 0x4FFFA6A5, 0x31FF7C7B, 0x11FF5A5B, 0x72FF3737,
+0x101C989A, 0x314C2C00, 0x14848B58, 0x17500132, 0xA05D6421, 0x8D513118, 0x40663482, 0xFF616F34,
+0x1FC00F24, 0x5DFF4A57, 0x51FF8A95, 0x20FF7C89, 0x55540005, 0x005A5C00, 0x18014D28, 0x6770E124,
+0x5E6531FF, 0x6C7340FF, 0x727546FF, 0x81710938, 0x6FFFADB0, 0x4B889DA1, 0x8C905D40, 0x710108FF,
+0xFF686C39, 0x906B6F3D, 0x7D4A3173, 0x71013879, 0xFF848E52, 0xA0566224, 0x753A406E, 0x4FDCFF66,
+0x46572371, 0x768856FF, 0xBC0057AC, 0x511C3134, 0x0009E843, 0x717152C4, 0x40FF9CA6, 0x5CC46B75,
+0x005C3C00, 0x18316940, 0x35244149, 0xF1470000, 0x6F724504, 0x5F6233FF, 0x443E1CFF, 0x504B2BFF,
+0x575435FF, 0x00F109C0, 0xFF3D441B, 0xFF2B330A, 0xFF606841, 0xD4303612, 0x2AFC0004, 0x184D2920,
+0x08561137, 0x1B12F03C, 0x54FF393A, 0x15FF7374, 0x14FF3438, 0x43FF3539, 0x3DFF6468, 0x33FF5E62,
+0x31FF5359, 0x4EFF5157, 0x70212894, 0xF13B5066, 0x1D280000, 0x222E06FF, 0x434E26FF, 0x56623CFF,
+0x0EF012B0, 0xFF2B3513, 0xFF343D1E, 0xFF475031, 0xFF7F8667, 0xFF5D6442, 0xFF919972, 0xFF545C33,
+0xF03B7413, 0xFF656C04, 0xFF44492B, 0xFF5F6348, 0xFF393E20, 0xFF494E2E, 0x04F122C0, 0xFF6B714D,
+0xFF585E3A, 0xFF41481F, 0xFF959D6E, 0xD8565C2E, 0x1DD00029, 0x310A9C00, 0xB4454722, 0x55D400A7,
+0x797762B1, 0x414024FF, 0x53542CFF, 0x1C315438, 0x50844040, 0x6B4703F0, 0x653FFF6B, 0x724FFF67,
+0x6443FF75, 0x4B2CFF67, 0x1FF014C4, 0x6E4CFF33, 0x4622FF74, 0x5F3AFF4C, 0xAC97FF63, 0x4247FFAD,
+0x2E42FF3F, 0x3447FF29, 0x3245FF2D, 0x2337FF2B, 0x2538FF1E, 0x253AFF22, 0x40ECFF27, 0x20233231,
+0xF800B8D4, 0x0EFC001D, 0x0D0F0E40, 0xB227F0FF, 0xFF030303, 0xFF191A14, 0x9C2B2D15, 0x4327F12D,
+0x835AFF3D, 0x744FFF7C, 0xB295FF6C, 0x5443FFA9, 0x7B7BFF4B, 0x6174FF75, 0x3A4EFF5C, 0x6068FF35,
+0x3238FF59, 0x2E3AFF2B, 0x1C28FF2A, 0x1015FF18, 0x1C1FFF0D, 0xF0373C18, 0x16171B09, 0x111111FF,
+0x404139FF, 0x6D6E5CFF, 0x4F5237FF, 0x66694CFF, 0xF10B64FF, 0x4C4E3608, 0x3E422BFF, 0x111600FF,
+0x242913FF, 0x3F422DFF, 0x20230EFF, 0x04F12490, 0xFF1A1C04, 0xFF4C4D3B, 0xFF2C2E19, 0xFF565A3F,
+0x745B6040, 0x5D3B3129, 0x312FD456, 0xB8242B02, 0x4621712E, 0x390BFF42, 0x7118E433, 0xFF868654,
+0xEC797B49, 0x6C04F148, 0x47FF98A1, 0x5CFF7579, 0x35FF8B8D, 0x63FF6264, 0x4C848D90, 0x2133E801,
+0x1D886462, 0x5F623731, 0x6C71302C, 0x42FF949E, 0x23546672, 0x777F5A71, 0x72785CFF, 0x90000A8C,
+0x9964711B, 0xAF77FF8F, 0x7117F4A4, 0xFFA3AC81, 0xD4535B36, 0x15DC0015, 0x280330F1, 0x8766FF20,
+0x1E05FF80, 0x5A45FF1A, 0x1200FF57, 0x5640FF0D, 0x2506FF51, 0x5839FF1C, 0x3015FF4F, 0x7C67FF26,
+0x2413FF73, 0x2614FF1B, 0x1300FF1F, 0xA889FF0B, 0x1300FFA1, 0x865EFF0D, 0xF135B881, 0x353E0908,
+0xA6B57CFF, 0x64753EFF, 0x2E3B0FFF, 0x3B481CFF, 0x838F5DFF, 0x10F171B8, 0xFF637038, 0xFF59662E,
+0xFF6B793E, 0xFF5F6E35, 0xFF2E3C09, 0xFF8F9D6A, 0xFFBFCC94, 0x48ABB97E, 0x42500033, 0x00424000,
+0x6B7144E4, 0x56FFA1AA, 0x49A09099, 0xAE6D08F1, 0x8F54FF9F, 0xA36DFF81, 0x602CFF96, 0x955CFF59,
+0x7637FF8D, 0x3172746D, 0xB87C8944, 0xA36B3135, 0x0030D89E, 0x00F109EC, 0xFF6D7337, 0xFF9BA165,
+0xFFA7AD71, 0x40848A4E, 0x71D4001E, 0x311D7000, 0x0C82874F, 0x4FD4000A, 0x00310000, 0x63314128,
+0x42149195, 0x001CF400, 0x403137C0, 0x3BD0747C, 0x512908F1, 0x6639FF4F, 0x7C50FF63, 0x734BFF7B,
+0x7952FF72, 0x885AFF7B, 0x3271C089, 0xD476724D, 0x514BA12C, 0xAAA58FFF, 0x47402EFF, 0xB800B0FC,
+0x2B0CF1A5, 0x39FF4D48, 0x64FF5E59, 0x2FFF8D89, 0x5AFF5B58, 0x2BFF8381, 0x6EFF4F4C, 0x1AB0908D,
+0x533210F1, 0x3F25FF56, 0x2E16FF45, 0x3115FF34, 0x6B4EFF38, 0x6B49FF72, 0x7454FF71, 0x5742FF7A,
+0x60BF145F, 0xFF57522C, 0x2FA47649, 0x58608511, 0x666340B1, 0x6B6B45FF, 0xA6A77BFF, 0x5E310990,
+0x0C388A8D, 0xF1284800, 0x8B916500, 0x6D7440FF, 0x4A5219FF, 0x949E62FF, 0x40B15238, 0x30FF7079,
+0x2DFF5F6A, 0x1A185B64, 0x0031C800, 0x1C004268, 0x7236712D, 0x6B32FF68, 0x0029DC63, 0x0CF104D8,
+0xFF606334, 0xFF62653A, 0xFF93966B, 0xFF3B3C12, 0xFF97986C, 0xFF676937, 0x309B9E69, 0x824BE025,
+0x905BFF7F, 0x8B58FF8D, 0x7744FF87, 0x785131C4, 0x7E8750FF, 0x0CF168DC, 0xFF49571C, 0xFF58672C,
+0xFF97A66D, 0xFF5E6F38, 0xFF384B14, 0xFF61743D, 0xE042531C, 0x48BC0051, 0x316E5000, 0x64949E69,
+0x3C04001A, 0x00432400, 0x00001D2C, 0x5704F10D, 0x53FF8187, 0x35FF7F86, 0x1AFF6468, 0x2CFF4C4F,
+0x5400504D, 0x0018A400, 0x1F711334, 0x15FF3C47, 0x3F70343F, 0x4A742A10, 0x474B03F1, 0x626343FF,
+0x494927FF, 0x5E5B3AFF, 0x49482AFF, 0x1A312248, 0x1DC8373B, 0x2A300EB1, 0x434927FF, 0x616743FF,
+0x7C0022D4, 0x401DF027, 0x13FF5F6A, 0x44FF313E, 0x4DFF606F, 0x34FF6978, 0x42FF505F, 0x28FF5C6B,
+0x3BFF424E, 0x04FF535F, 0x0BFF1C28, 0x31FF232D, 0x04FF4953, 0x4929710F, 0x2C09FF44, 0x311BFC28,
+0x305D5E3E, 0x4B00F119, 0x38FF6366, 0x1AFF5053, 0x08FF3135, 0x13D02126, 0x50414400, 0xFF4F552F,
+0x124EF831, 0x31377882, 0x904E4F2F, 0x7F5D3100, 0x0032487E, 0x3D315560, 0xC8085757, 0x0041BC00,
+0x2671632C, 0x56FF4F50, 0x342C7878, 0x7D7D5971, 0x43431DFF, 0xCC0050C8, 0x6142311C, 0xF10AF862,
+0x67604410, 0x2F250AFF, 0x7E795BFF, 0x81806EFF, 0x2F323BFF, 0x292E44FF, 0x272F44FF, 0x232A3DFF,
+0x4031BDA4, 0x139C2B2C, 0x292A3C71, 0x212433FF, 0x08F1DB90, 0xFF15151F, 0xFF1D1D25, 0xFF080C0D,
+0xFF060805, 0xFF000000, 0xD8303024, 0x651EF050, 0x65FF868A, 0x4BFF858B, 0x55FF6B71, 0x3FFF757B,
+0x66FF5960, 0x48FF757D, 0x55FF4B53, 0x46FF484C, 0x4CFF373B, 0x03FF4851, 0x04FF040B, 0x13F13728,
+0xCBFF0003, 0xD4FFCFD5, 0x18FFDEE2, 0x00FF1C1F, 0x08FF0104, 0x3EFF0D0E, 0x24FF4848, 0x31FF3536,
+0x98A44547, 0x272B1450, 0x3DA047FF, 0xFF383DD0, 0xFF484C3B, 0xFF161A09, 0xA8285A49, 0x49FF4051,
+0x47A05F61, 0x190100F1, 0x6B52FF17, 0x331AFF67, 0x5E43FF2F, 0x7106485A, 0xFF575C3C, 0x10949A76,
+0x603C3129, 0xB133AC5A, 0xFF3E4617, 0xFF5F6633, 0xEC888A58, 0x6934000E, 0x0012A400, 0x39711B9C,
+0x37FF6568, 0x18F86061, 0x0004F000, 0x0DF040F4, 0xFF747249, 0xFF59572E, 0xFF81875B, 0xFF707849,
+0xFF838D5B, 0xFF838C5D, 0xFF4B5429, 0x3E8010A0, 0x00FF565D, 0x34FF0C13, 0xAB713149, 0x321CE4A0,
+0x083F4917, 0x4537F110, 0x926DFF3D, 0x734CFF8A, 0x3C15FF6B, 0x8563FF34, 0x2209FF7E, 0x4732FF1E,
+0x1100FF44, 0x1000FF0C, 0x795DFF0B, 0x3A1BFF73, 0x1E01FF31, 0x765DFF15, 0x4F3AFF6C, 0x2007FF46,
+0x3415FF16, 0x8C64FF2B, 0xC095FF81, 0x0016C4B5, 0x10F144E4, 0xFF768147, 0xFF6D7F41, 0xFF8CA063,
+0xFF485922, 0xFF63743E, 0xFF65733E, 0xFF96A46F, 0x284A5721, 0x4613F01C, 0x4AFF717E, 0x77FF7483,
+0x98FF9EAC, 0x5BFFBFCD, 0x62FF8392, 0x26FF8C9B, 0x11FF5361, 0x3FFF3D4C, 0x513C2078, 0x9859FF86,
+0xF153C48E, 0x9DAD6608, 0xA7B872FF, 0x6A783AFF, 0x8D9B60FF, 0x5F682FFF, 0x7E874EFF, 0xA40023B0,
+0x5200F15F, 0x34FF8692, 0x50FF6874, 0x55FF858A, 0x3C648A8F, 0x82874D80, 0xB2B77DFF, 0x0031ACFF,
+0x52314110, 0x3C08878C, 0x00508400, 0x297173BC, 0x69FF5C61, 0x06609A9F, 0x314B2C00, 0xDC939765,
+0x12FC0028, 0xA1A76931, 0x59B141AC, 0x68FF8588, 0x40FF8E90, 0x4D90686B, 0x5C5C3631, 0x00F10480,
+0xFFB4B387, 0xFF3D3C0E, 0xFF68663F, 0x84706D4A, 0x8D728049, 0x856FFF91, 0xA4B0FF8A, 0x65604340,
+0x007700FF, 0x00F14EA0, 0xFF6C6A43, 0xFF7D7F4E, 0xFF767847, 0xB0787951, 0x3024001F, 0x4038A800,
+0xFF706C4F, 0x34314EE8, 0xAF905B57, 0x8B885F31, 0x4C100A2C, 0x4D61B9A0, 0x5433FF58, 0x7177205D,
+0xFF403D12, 0xBCA6A37A, 0x3800F162, 0x34FF615F, 0x46FF5F60, 0x3AFF7478, 0x0228666D, 0x4F2104F2,
+0x592BFF49, 0x7B48FF53, 0x5925FF74, 0x9862FF52, 0x2136A091, 0x4D246A75, 0x545E2931, 0xCC003BB4,
+0x1A50006F, 0x838D5131, 0x3B400B1C, 0x64FF6E73, 0x9C6B7147, 0x7445FF9A, 0xF1025872, 0x74754B00,
+0x797A4EFF, 0x87895AFF, 0x60602EFF, 0xC80024B0, 0x874EB133, 0x632BFF84, 0x8855FF5E, 0x31078484,
+0x10747645, 0x4D17312E, 0x0025CC46, 0xD8006114, 0x713B7301, 0x864FFF64, 0xF059F877, 0x3DFF5601,
+0x59FF6374, 0x4FFF8190, 0x37FF7885, 0x1107A069, 0x31350052, 0x3C687142, 0x43400048, 0x3116DC00,
+0x0069703D, 0x6BC00005, 0x3D402331, 0x2D311754, 0x5994454C, 0x664000F1, 0x3008FF5A, 0x300DFF24,
+0x4D2EFF26, 0x3245B046, 0x282C2A11, 0x504F21AD, 0x16B13D7C, 0x18FF3033, 0x25FF333A, 0x5A00404A,
+0xF14AEC00, 0x6C73513C, 0x6F7954FF, 0x6D7953FF, 0x3A4920FF, 0x304117FF, 0x405125FF, 0x2C3D11FF,
+0x3D4E22FF, 0x5A6B3FFF, 0x64734AFF, 0x4F5E35FF, 0x4C5B32FF, 0x424E26FF, 0x49532EFF, 0x383F20FF,
+0x36391EFF, 0x8D896EFF, 0x696248FF, 0x40361DFF, 0xC000A7A4, 0x59378006, 0x3412FF58, 0x409CFF2E,
+0x00144400, 0xC40003B4, 0x3BE80054, 0x220DC400, 0x171C562D, 0x00213800, 0x13713AF0, 0x3BFF3438,
+0x1208585C, 0x3F4320B1, 0x3B3F1AFF, 0x5E6039FF, 0x640022D0, 0x7253B15A, 0x3E1DFF73, 0x5835FF41,
+0x002BC45B, 0x8931362C, 0x4354ABB2, 0x1D0C0CF1, 0x3F33FF26, 0x4936FF4B, 0x4236FF50, 0x3745FF44,
+0x2F48FF38, 0x324CFF2B, 0x00FEA82B, 0x28F14FDC, 0xFF252436, 0xFF1C1D2F, 0xFF282B3A, 0xFF1F232F,
+0xFF252934, 0xFF22222C, 0xFF2D3039, 0xFF0A0E17, 0xFF0A0E11, 0xFF0D0D05, 0xFF73725D, 0xFF92976F,
+0xFFB0B78B, 0x181A2100, 0x744D310E, 0xF12E2072, 0x838C6F04, 0x444D38FF, 0x2F3325FF, 0x4F554BFF,
+0x141C0FFF, 0x08F14620, 0xFF000300, 0xFF929783, 0xFFE4EBC9, 0xFFCCD4AD, 0xFFD5DBBF, 0x38646953,
+0xDD14004B, 0x1F0E30F1, 0x624EFF22, 0x4C3CFF63, 0x220CFF4B, 0x704CFF1D, 0x6946FF64, 0x1A08FF5B,
+0x2517FF13, 0x2715FF21, 0x745CFF26, 0x5539FF74, 0x7453FF55, 0x5531FF70, 0x613FFF4F, 0x1600FF5A,
+0x5137FF10, 0x312E804B, 0xD0919572, 0x28007134, 0x6B44FF23, 0x402A0063, 0xFF4D5725, 0x10004838,
+0x17AC005E, 0x4004FC00, 0xFF949C69, 0x00002784, 0x39157128, 0x613EFF39, 0x00276064, 0x62B18590,
+0x1EFF8E8B, 0x81FF4546, 0x1668A6AD, 0x4C5423B1, 0xABB183FF, 0xADB48AFF, 0xC0005690, 0x0C400010,
+0x4017E000, 0xFF677039, 0x04F1141C, 0xFF5C633A, 0xFF4E5134, 0xFF52563B, 0xFF848A68, 0xA8474D27,
+0x542B4020, 0x3A8CFF4D, 0x3A3F21B1, 0x121700FF, 0x717662FF, 0x1E500AC8, 0x49FF3337, 0x07F12ADC,
+0x22FF4751, 0x29FF404D, 0x51FF4855, 0x51FF737F, 0x42FF7581, 0x6C286576, 0x86955AB1, 0x617133FF,
+0x8A9B64FF, 0x73715A98, 0x00FF9FB1, 0x55702C3C, 0x6C7846B1, 0x4A5324FF, 0x3D4A15FF, 0x14F122F4,
+0xFFB9C789, 0xFF506022, 0xFF829156, 0xFF87995D, 0xFF516325, 0xFF445916, 0xFF728744, 0xFF718444,
+0x5CA8B879, 0x3310F11C, 0x64FF6574, 0x54FF97AB, 0x7FFF889C, 0x0AFFB3C2, 0x78FF404C, 0x4BFFABBC,
+0x7CFF7B89, 0x1CA8ABB2, 0x7B844D71, 0x747D44FF, 0xE8002D50, 0x21D0003B, 0xAAAF7771, 0xA5A871FF,
+0x33715444, 0x5EFF6969, 0x40549093, 0x312BC000, 0x0C90985F, 0x1404F136, 0x46FF4446, 0x3BFF7878,
+0x3EFF6D6D, 0x18FF7070, 0x33084749, 0x204F4C00, 0x5A889259, 0x0B6C8211, 0x710A0400, 0xFF8A8C67,
+0xA48D8A69, 0x6B41C007, 0x5B2FFF6A, 0x5C33FF5A, 0x31D8FF5F, 0x4F3010F1, 0x4226FF50, 0xA68DFF43,
+0x280DFFA8, 0x7454FF2C, 0x6D4AFF79, 0x7555FF71, 0x3911FF7A, 0x000F7038, 0x617154A8, 0x5EFF8A92,
+0x1A98838A, 0x6B3F08F1, 0x3112FF65, 0x5132FF30, 0x673DFF50, 0xA071FF66, 0x6E42FF9E, 0xF1ACB06D,
+0x7F795F10, 0x736B54FF, 0x918668FF, 0x7C724FFF, 0x5A572EFF, 0x868559FF, 0x817E53FF, 0x9F9E70FF,
+0x1A312E7C, 0x27CC494D, 0x3122D000, 0x2C4B541D, 0x3610F14B, 0x4BFF5E68, 0x5CFF717A, 0x34FF868C,
+0x46FF6067, 0x1CFF6F7C, 0x4AFF4453, 0x55FF717F, 0x09AC7D8A, 0x7A844831, 0x00F16F4C, 0xFF84894F,
+0xFF585824, 0xFF7C7A49, 0xE0837D4D, 0x744B2087, 0x26F16A54, 0x9D69FF55, 0x602AFF9D, 0x7946FF60,
+0x7541FF7B, 0x8650FF75, 0x3A01FF81, 0x5B25FF32, 0x9360FF54, 0x6B3EFF8F, 0x7043FF6E, 0x7949FF73,
+0x6F3DFF7B, 0x723CFF6D, 0x001A686B, 0xB4000A10, 0x58243137, 0x006BE04E, 0x00F161D0, 0xFF637440,
+0xFF5D6E3A, 0xFF697744, 0x10364214, 0x1F08F136, 0x35FF444B, 0x3BFF5D67, 0x32FF6873, 0x4DFF5F6A,
+0x35FF7882, 0x0F806068, 0x82855631, 0x840045AC, 0x1104F104, 0x13FF2730, 0x24FF2833, 0x0BFF3B46,
+0x08FF222D, 0x12541E27, 0x282A1471, 0x2F2E19FF, 0x1B403A60, 0xD0FF3535, 0x411400AB, 0x454F2C71,
+0x59633EFF, 0x1CF11174, 0xFF363D1B, 0xFF161D00, 0xFF535D3A, 0xFF48542E, 0xFF4C5B34, 0xFF2D3C13,
+0xFF192A00, 0xFF3B4C22, 0xFF404F26, 0xFF54633A, 0x045D6941, 0x5A327131, 0x4C24FF4F, 0x60368441,
+0xFF242408, 0x87605C43, 0xFF5406F1, 0xFF322610, 0xFF554633, 0xFF6A5E46, 0xFF4C4825, 0x44393913,
+0x0A880013, 0x42482432, 0x40300EFC, 0x3F80FF3C, 0x33380F31, 0x04F11C50, 0xFF2A2E0D, 0xFF303413,
+0xFF383E1A, 0xFF4B512D, 0xE4363C1A, 0x4AD80008, 0x898E6671, 0x333712FF, 0x1C000A18, 0x05040046,
+0xE1641C10, 0xFF585550, 0x6EC07E5F, 0x1F284111, 0x1E250080, 0x171100FF, 0x329E58FF, 0x9C595441,
+0x272290C6, 0x2B283BFF, 0x042E41FF, 0xFF295100, 0x041D1C2E, 0x2335B100, 0x1C29FF24, 0x1C25FF1A,
+0xF1D6AC19, 0x36373C04, 0x1C1D22FF, 0x06090EFF, 0x020605FF, 0x151304FF, 0x4B71AC28, 0x46FF6F74,
+0x338C6B72, 0xF1319000, 0x5053282C, 0x777D51FF, 0x444E29FF, 0x424D2FFF, 0x848973FF, 0x5C6051FF,
+0x767C72FF, 0x585E54FF, 0x242819FF, 0x151900FF, 0xAEB58BFF, 0xB9C192FF, 0xA6AC86FF, 0x595E40FF,
+0x5F604EFF, 0x03310054, 0xBBB41512, 0x5004E800, 0xFF52583C, 0xF1570C53, 0xFF788703, 0xFF262D1B,
+0xFF090B00, 0xFF181705, 0x2858583E, 0x8B637164, 0x8E64FF86, 0xF13C3487, 0x0C120004, 0x181E04FF,
+0x838667FF, 0xABAC8AFF, 0x202200FF, 0x5DB15F30, 0x5EFF7F88, 0x63FF808C, 0x3A908B98, 0x666F3871,
+0xB7C089FF, 0x10F1504C, 0xFF707A45, 0xFF56602C, 0xFF959C70, 0xFF42441F, 0xFF484522, 0xFF888457,
+0xFF888455, 0x206A6640, 0x5B00F117, 0x4EFF828A, 0x08FF7680, 0x9AFF373B, 0x2874C8CC, 0x0051AC00,
+0x67322F54, 0x4B908D96, 0x94777E21, 0x1C04F159, 0x36FF3F44, 0x43FF5053, 0x56FF5C61, 0x3AFF767C,
+0x2D7C5D64, 0x471E21F0, 0x7D55FF42, 0x300FFF78, 0x755BFF2C, 0x2611FF6F, 0x3E28FF23, 0x4F35FF3C,
+0x8C68FF4F, 0x784BFF86, 0x3B07FF6F, 0x9B63FF31, 0x844FFF90, 0x085CFF7B, 0x5B6C3671, 0x9CAD76FF,
+0x68315CF4, 0x731C94A3, 0x7A4304F1, 0xC283FF69, 0x793AFFB2, 0x450FFF69, 0xAC7AFF38, 0xF123D4A0,
+0xBECB9510, 0x606F2EFF, 0xBFD08CFF, 0x4E5E1FFF, 0xA8BB7BFF, 0x768B4AFF, 0x324704FF, 0x768D47FF,
+0x18F17BDC, 0xFF5A6D2D, 0xFF6D7D3F, 0xFF3A480B, 0xFF768645, 0xFF61772E, 0xFF94AA5F, 0xFF93A35A,
+0xFF4A5A13, 0xFF8FA35B, 0x1C92A661, 0xB37DC074, 0x8248FFAC, 0x7335FF77, 0x6324FF67, 0xADB67731,
+0xE40178D8, 0x7073A104, 0x53531FFF, 0x777542FF, 0x25B1864C, 0x4EFF4F52, 0x4EFF757D, 0x19407C85,
+0x71105000, 0xFF5A5C2D, 0x2C666535, 0x5E2F3191, 0xF17BB05C, 0x7B7E4500, 0x61652AFF, 0x8A8A54FF,
+0x707241FF, 0x0CF102D4, 0xFF6D714C, 0xFF898665, 0xFF83815B, 0xFF74774A, 0xFF717445, 0xFFA29F74,
+0xB05D5B34, 0x40C8001B, 0x85866440, 0x321294FF, 0xA4736F4A, 0x5F5D21C3, 0x12310F3C, 0x7DC0454D,
+0x71107C00, 0xFF838D59, 0xF08A935C, 0x3B16405E, 0x42C4FF37, 0x693914F1, 0x8754FF63, 0x5627FF80,
+0x542CFF53, 0x5F3DFF52, 0x3A1CFF5F, 0x8F70FF3F, 0x7753FF98, 0x8E67FF7F, 0x10813C90, 0x6183346D,
+0x54FF8484, 0x22B08486, 0x76844671, 0x8F9D5FFF, 0x94006AD0, 0x39840018, 0x001C9C00, 0x78002524,
+0x2C5C0046, 0x87986231, 0x50806B34, 0x1BFF7785, 0x10FF4653, 0x641CF157, 0x4CFF96A0, 0x46FF8186,
+0x3DFF7C7C, 0x5CFF7370, 0x3BFF958D, 0x5EFF716B, 0x1FFF8C89, 0x57FF4C4E, 0x3BFF8B8E, 0x45FF7374,
+0x24B47876, 0x767D4940, 0x0054C0FF, 0xB00077D8, 0x2801F055, 0x52FF5653, 0x67FF817C, 0x23FF9A96,
+0x34FF5555, 0x6027203E, 0x70113C58, 0xA0005BE8, 0x2FB80010, 0xF12C0800, 0x4858270C, 0x495A26FF,
+0x758350FF, 0x515D2FFF, 0x697245FF, 0x676F40FF, 0x545E2AFF, 0xD8006608, 0x7A6C0075, 0x007D0C00,
+0x26B14930, 0x15FF5255, 0x38FF2D34, 0x0E90505A, 0xB10C7800, 0xFF2D361B, 0xFF0F1400, 0x001A1F08,
+0x240DB18D, 0x3822FF20, 0x341EFF36, 0x71DB6032, 0xFF434828, 0x10474D2B, 0x44227146, 0x2A05FF3D,
+0xF113B422, 0x4A522D00, 0x252D08FF, 0x838D68FF, 0x929C77FF, 0xD0000A1C, 0x3D189018, 0x401BFF33,
+0x404BFF36, 0x5507F10B, 0x4626FF4F, 0x3112FF41, 0x2A0BFF2E, 0x5235FF27, 0x8A70FF56, 0x10D06C96,
+0x80BE6C1A, 0x1EFF5243, 0x18FF4034, 0x3E21D290, 0x00214441, 0x6C004B98, 0x2D7C0146, 0x3E4414F0,
+0x333818FF, 0x252906FF, 0x484D24FF, 0x646940FF, 0x6C704FFF, 0x5D6242FF, 0x353819FF, 0x393C1DFF,
+0x310510FF, 0x004D5130, 0x40040048, 0x797D5831, 0x18315F4C, 0x0A08393D, 0xF1483800, 0x43432108,
+0x7C7B5CFF, 0x6D6F4AFF, 0x474D21FF, 0x4A5022FF, 0xB8B690FF, 0x3E316440, 0xBB405B5A, 0x282501F0,
+0x1619FF37, 0x2627FF25, 0x3B40FF2A, 0x04F8FF3A, 0x211E3360, 0xF81A2CFF, 0x2202F10E, 0x303136FF,
+0x202123FF, 0x383836FF, 0x0C0D08FF, 0x00F131F0, 0xFF1E2012, 0xFF54523D, 0xFF444023, 0x58363715,
+0x5437314C, 0xF0394C51, 0x3A3E0C01, 0x909761FF, 0x8C986AFF, 0x7E8967FF, 0xF109F0FF, 0x0A0C0708,
+0x2F3237FF, 0x23272AFF, 0x31322CFF, 0x424331FF, 0x1F2302FF, 0x3B312580, 0x0F445A5E, 0x3F402E31,
+0x9C00AA50, 0x372631E2, 0x00CD683A, 0x28F122D8, 0xFF8E9B65, 0xFF919F6C, 0xFF393E28, 0xFF252519,
+0xFF1C1906, 0xFF3E3D21, 0xFF6F6D47, 0xFF878A5F, 0xFF969C70, 0xFF202800, 0xFF151A00, 0xFF121600,
+0xFFDEDEC2, 0xF4A9A987, 0x6604F120, 0x5DFF9295, 0x17FF868E, 0x5BFF414B, 0x81FF8690, 0x25E0AEB9,
+0x9AA77131, 0x19F00C40, 0xFF617339, 0xFF75864F, 0xFF4A5823, 0xFF70794C, 0xFF7D8357, 0xFF838554,
+0xFF929463, 0xFF5F6139, 0xFF202500, 0xFF646D3E, 0x5B312C14, 0x62B48F92, 0xB2B88831, 0x2C806598,
+0x1BFF525E, 0xD4FF4350, 0xBF8C3145, 0x71536CBB, 0xFF7F8257, 0xC0747B51, 0x8F60B160, 0x4718FF86,
+0x895DFF3F, 0x0033CC83, 0x5531205C, 0x3DF47174, 0x4D5035B1, 0x3A361BFF, 0x636041FF, 0x47713AB8,
+0x5FFF7376, 0x54889095, 0x3E0500F1, 0xA46BFF3B, 0xB680FF9C, 0xAD76FFA9, 0xF120D89E, 0x9CA97108,
+0x88975EFF, 0x79884DFF, 0x94A466FF, 0xA2B274FF, 0x4C5923FF, 0x9C3143F0, 0x7354C7D4, 0xF171A000,
+0xB6C78304, 0x8E9E5FFF, 0x9FB272FF, 0x485D1AFF, 0x94A964FF, 0x24F180E0, 0xFF7A8F4C, 0xFF5A6C30,
+0xFF7F8E53, 0xFF404E10, 0xFF758640, 0xFF5D7426, 0xFF748B39, 0xFF7C8F3E, 0xFF809344, 0xFF80964B,
+0xFF8FA35C, 0xFF6E7D3A, 0x409FAB69, 0x051C0082, 0x7C883CC0, 0x78843AFF, 0x54611CFF, 0x003758FF,
+0x05F00ED8, 0xFF7A7847, 0xFF504D18, 0xFF82804D, 0xFF4E5021, 0xFF656B3D, 0x6F714980, 0x33FF97A1,
+0x1A6C585F, 0x31292C00, 0x00616332, 0x73443113, 0x314F3C70, 0x246A6F2F, 0x8F5D3133, 0x0006B88B,
+0x47713EBC, 0x54FF7071, 0x22208183, 0x3159BC00, 0x78757448, 0x80B8000B, 0x00279C00, 0x700016FC,
+0x4A1E3129, 0x711A8C49, 0xFF888B5C, 0xFC505723, 0x662A7159, 0xA068FF5B, 0x00573095, 0x1BB182CC,
+0x71FF4D59, 0x31FF9DA6, 0x2EDC5A62, 0x80563000, 0xFF6B7143, 0xFF464C20, 0x3D712E68, 0x2CFF6264,
+0x00045553, 0x83855EB1, 0x94976CFF, 0x82854EFF, 0x59714FDC, 0x14FF8B8E, 0x37E0454A, 0x727D4131,
+0x94001DB4, 0x22A00038, 0x9E6E12F0, 0x8758FF98, 0x4515FF84, 0x814FFF3F, 0x7B47FF75, 0x824EFF6A,
+0x6631FF71, 0x4913FF58, 0x004DFF3C, 0x7B856164, 0x545C21FF, 0x7AB17F10, 0x62FFB3B2, 0x46FF9A94,
+0x0A5C7A76, 0x6A6E3C71, 0x7D844EFF, 0x26B1410C, 0x27FF5355, 0x63FF5456, 0x46888F96, 0x80382400,
+0xFF5F6535, 0xFF88865D, 0x24310504, 0x32345554, 0x4D4C6610, 0xFF767FA1, 0xFF5F6630, 0x38686D37,
+0x713A313C, 0x2065D868, 0x0F00713C, 0xFF7F00F0, 0xFF6F7E45, 0xFF616E38, 0xFF505A25, 0x61099428,
+0x2AFF5963, 0x6BDC5562, 0x38421071, 0x58602FFF, 0x2D710A5C, 0x17FF5F62, 0x263C2F39, 0x422012F0,
+0x3D1EFF38, 0x250FFF36, 0x2817FF20, 0x1F0CFF25, 0x3722FF1C, 0x250EFF34, 0x3019FF21, 0x641EFF2B,
+0x242A6163, 0x4E5533FF, 0x3F314F38, 0x22C85C64, 0x351000F1, 0x441DFF2D, 0x3D16FF3C, 0x6D48FF35,
+0x7136D065, 0xFF575F3A, 0xF06E7553, 0x1A20F154, 0x38FF353A, 0x0CFF5358, 0x0DFF2629, 0x19FF2929,
+0x16FF3432, 0x20FF312F, 0x28FF3B36, 0x14FF473F, 0x2CFF3E2C, 0x13FF5A44, 0x3CFF3C2C, 0xC1686054,
+0x8015A800, 0xFF403C1F, 0xFF3F3E1F, 0x4C003AD4, 0x458C0018, 0x33904910, 0xFF393E90, 0xFF676A4B,
+0x8804663F, 0x09F06211, 0x2F3416B1, 0x2F3217FF, 0x222206FF, 0x49B16408, 0x0DFF6968, 0x4DFF2D2C,
+0x0E746E6F, 0x633B00F1, 0x5F35FF5E, 0x7047FF58, 0x2E0BFF69, 0xF03CD82A, 0x76775723, 0x838361FF,
+0x50502AFF, 0x3A3B11FF, 0x95986BFF, 0x9B9E73FF, 0x90906CFF, 0x5C5038FF, 0xB18F86FF, 0x643E3DFF,
+0x45312AFF, 0x3B302CFF, 0x98232BFF, 0xFF24D1FE, 0xFF332733, 0xFF2A2126, 0x98454442, 0x2B08F11D,
+0x00FF3532, 0x06FF0C0A, 0x3DFF191B, 0x3CFF5558, 0x2AFF5D59, 0x60144D48, 0x31557800, 0x448F8F75,
+0x0020F124, 0x47FF1012, 0x51FF737A, 0x1FFF6E79, 0x13FF303A, 0x5AFF1B21, 0x64FF5B5D, 0x1EFF5D61,
+0x65FF191D, 0x0BFF6C6D, 0x60FF1E1D, 0x20FF7B79, 0x50F03F3E, 0xB1471000, 0xFF171700, 0xFF4A4734,
+0x200A0500, 0x906410C0, 0x595F6165, 0x78834BFF, 0x2C0056E0, 0x0D0CF151, 0x06FF1C1A, 0x2BFF1F1A,
+0x76FF4D4A, 0x86FFA29F, 0x50FFB7B6, 0x00FF7A7D, 0x057C161B, 0x494C2F71, 0x67664AFF, 0x68710500,
+0xA9FF9796, 0x2B98DBDE, 0x7C854C31, 0x6BB1437C, 0x79FF99A2, 0x9DFFA3AD, 0x04F8C5D2, 0x9E6304F1,
+0x965BFF8A, 0xA66CFF82, 0xA36EFF94, 0x8955FF96, 0x715D307F, 0xFF8E9464, 0xAC32380C, 0x2548003F,
+0xB104E400, 0xFFBDBE84, 0xFF818248, 0x3CD6DFAA, 0x7AD00073, 0x00668400, 0xA4316DFC, 0x38A8D4D6,
+0x7A4B18F1, 0xA572FF77, 0x4B16FF9D, 0x6F3BFF41, 0x7845FF65, 0x8457FF70, 0x5F37FF81, 0x7550FF5D,
+0x2101FF73, 0x1700FF20, 0xF151AC14, 0x302B0D10, 0x484220FF, 0x8A875EFF, 0x959363FF, 0x6C6B35FF,
+0x626129FF, 0x89884FFF, 0x9C9F66FF, 0x68003F58, 0x58A8001C, 0xBBC59031, 0x01F003E4, 0xFF879759,
+0xFF92A264, 0xFF455419, 0xFF3D4A14, 0x53B24C20, 0x4FFF8391, 0x4DFF8293, 0x77F88293, 0x08819421,
+0x1508F17D, 0x71FF465A, 0x49FFA3B9, 0x42FF7A8E, 0x44FF7184, 0x67FF7383, 0x815C98A8, 0x853614F1,
+0x8634FF72, 0xAE5AFF6F, 0xB05EFF96, 0xB362FF9D, 0xA75CFFA0, 0x782FFF91, 0x5F15FF62, 0xBB72FF4D,
+0xF18154AB, 0x83954900, 0x616F22FF, 0x6E7C31FF, 0x8B9B54FF, 0x09F08140, 0xFF696E38, 0xFF92905F,
+0xFF6A6732, 0xFF868350, 0xFF504F1F, 0xFF919767, 0x7C312174, 0x1A24A2AE, 0x00793800, 0x47314700,
+0x39BC747B, 0x8A8E5C71, 0xAFB376FF, 0x7F316348, 0x4F58B3B6, 0x7B835431, 0x740038D0, 0xA7744013,
+0x0B98FFA3, 0x8B945D50, 0x5F644DFF, 0xFF9798A1, 0xFF686E40, 0xE0545C2B, 0x65180062, 0x4B4F1C31,
+0xFC00131C, 0x86CC0068, 0x99590CF1, 0x6F2DFF8D, 0x9052FF63, 0x9A59FF82, 0xB873FF8B, 0x601EFFAB,
+0x8549FF54, 0x31551C7B, 0xB8969E6D, 0x0068001A, 0x666D41B1, 0x6A7147FF, 0x898F63FF, 0x39C013E8,
+0x3CFF6465, 0x38FF6065, 0xB4FF5F67, 0x56100014, 0x7E804EC0, 0x7B7F4CFF, 0x646E31FF, 0x005484FF,
+0x1DB131B8, 0x19FF4A4C, 0x86FF484A, 0x146CB4B8, 0xE02E2800, 0xFF909C6C, 0xFFAABA89, 0xFF51622E,
+0x755C5520, 0x5C944E11, 0x555E2531, 0x1C710500, 0x6FFF5357, 0x6054A8A9, 0x310F0800, 0x08505220,
+0xA0673124, 0x316FB097, 0x84787B4C, 0x3E100035, 0x0056E000, 0x08F127BC, 0xFF878F60, 0xFF909167,
+0xFF505127, 0xFF5F6130, 0xFF5E652F, 0x7C929D65, 0x77414089, 0x1F64FF70, 0x656A3040, 0x0029B8FF,
+0x94001E74, 0x4300F170, 0x30FF6D7F, 0x31FF5E6E, 0x2BFF606E, 0x6FF05A65, 0x58652FB1, 0x4F5E27FF,
+0x3C4A15FF, 0x0BB10334, 0x35FF343C, 0x30FF686D, 0x53F46669, 0x222C0971, 0x29300FFF, 0x24712B54,
+0x35FF3235, 0xAB744141, 0x00050400, 0x00B12094, 0x0DFF0A12, 0x26FF1F28, 0x2CA83C45, 0x754C0CF1,
+0x3F1AFF6D, 0x7A55FF37, 0x7D53FF72, 0x6339FF72, 0x370DFF58, 0x4B23FF2C, 0x00377840, 0x593109EC,
+0x40C47479, 0x341A00F1, 0x4127FF34, 0x3C25FF41, 0x3D28FF3E, 0xF1B1143F, 0x625D4A10, 0x403927FF,
+0x312413FF, 0x5C4631FF, 0x503A23FF, 0x493922FF, 0x2A1F09FF, 0x35301DFF, 0xC800B038, 0xD1F000E4,
+0x24210EB1, 0x31301EFF, 0x3F412CFF, 0x1DB121D4, 0x21FF2F32, 0x40FF3739, 0x3C5C605F, 0x422204F1,
+0x4529FF3D, 0x442EFF3F, 0x351DFF42, 0x2B0EFF35, 0x0013DC2F, 0x43B164B8, 0x07FF6362, 0x00FF282C,
+0x12AC1219, 0x323B0E31, 0x0571381C, 0x11FF2127, 0x5AFC3031, 0x665F4271, 0x454020FF, 0x10F12B90,
+0xFF9BA276, 0xFFA19E73, 0xFF6B5033, 0xFFC98A85, 0xFFC67E82, 0xFFBD8A86, 0xFF68473E, 0xBC322119,
+0x413F80CD, 0x4742FF53, 0xD774FF56, 0x1A0C00F1, 0x473BFF19, 0x200DFF4B, 0x5E3CFF25, 0xB17C985E,
+0xFFA6A27D, 0xFF383313, 0x74585437, 0x86667104, 0x2000FF85, 0xF07B301E, 0x6769441D, 0x323625FF,
+0x2D3329FF, 0x40433CFF, 0x979A91FF, 0x40463AFF, 0x3C4031FF, 0x939580FF, 0x6D6B56FF, 0x231E0BFF,
+0x38311EFF, 0x00C72CFF, 0x70314DD8, 0x45649494, 0x07040031, 0x363114B8, 0x030C6362, 0x83895B31,
+0x74003EA8, 0x460BF0CA, 0x0CFF5A54, 0x46FF2822, 0x77FF6B66, 0x71FFAAA6, 0x3BFFA6A4, 0x22FF686A,
+0x9142644A, 0x7455FF3A, 0x8C6FFF75, 0x00798890, 0x59718228, 0x68FF9495, 0x61B4A0A6, 0x91945B31,
+0x6C31632C, 0x5D60969C, 0x572004F1, 0xAC70FF48, 0xB67AFF9A, 0xA165FFA4, 0xAD72FF8F, 0x4011CC9F,
+0xFF99A26D, 0x340007F4, 0x62353108, 0x7130445F, 0xFFB4B780, 0x189E9E60, 0x23380095, 0xCCD9A440,
+0x002B00FF, 0xC000780C, 0x9A00F103, 0x4BFFCBCA, 0x99FF7A79, 0x79FFC8CA, 0x7828A9B2, 0x64713931,
+0xDC001180, 0x966A3109, 0xF065A495, 0x40451D33, 0x575C34FF, 0x7F7F59FF, 0x6D6743FF, 0x5B532EFF,
+0xA29A73FF, 0xA9A276FF, 0x5A5724FF, 0x5D5A25FF, 0xCCC992FF, 0xACAD73FF, 0x969E62FF, 0x4C571BFF,
+0x5A652DFF, 0x8F9A62FF, 0x657034FF, 0x7C793BFF, 0x8056F15D, 0x57652AFF, 0x9FAC74FF, 0x5B692CFF,
+0xC0D18DFF, 0x708238FF, 0x586A20FF, 0xA5B971FF, 0x9AAD6DFF, 0x5F7232FF, 0x718540FF, 0x81954EFF,
+0x73843EFF, 0x96A760FF, 0x9EB066FF, 0x98A959FF, 0x71802BFF, 0x90A34AFF, 0x768C37FF, 0x89A14BFF,
+0xBFD37EFF, 0xB8CE7CFF, 0x6B8339FF, 0x627A30FF, 0x90A558FF, 0xA6B86CFF, 0x2AB185FC, 0x1DFF5D6E,
+0x25FF4F5E, 0x76985766, 0x81915031, 0x55314AF4, 0x95548B8B, 0x80419800, 0xFF878755, 0xFF8D9460,
+0x10F11E88, 0xFFA3B279, 0xFF7D8C51, 0xFFA5B577, 0xFFA9B478, 0xFF99A366, 0xFF9DA76A, 0xFFA1A96D,
+0x50A3A868, 0xB47E3155, 0x0037B0B4, 0x71312768, 0x31109CA4, 0x005F8800, 0x24313FEC, 0x821C515C,
+0x311D0C00, 0x90A7B07B, 0x7B3F7101, 0x7033FF70, 0xF172D466, 0x616B2E10, 0x7A8543FF, 0x839048FF,
+0x69772AFF, 0x9AAB5DFF, 0x63732CFF, 0x5E6E27FF, 0x99A75CFF, 0x100081B4, 0x89577174, 0x895AFF7F,
+0x7111F480, 0xFF343D10, 0x205E673C, 0x55293157, 0x005F204E, 0x1E3154D0, 0x65B0454D, 0x582200F1,
+0x531DFF51, 0x5C2DFF4E, 0x7E4CFF59, 0x315F9C7A, 0x8C8F9857, 0x3F0D804B, 0x6433FF3D, 0x09C0FF62,
+0xB12E6800, 0xFF242A00, 0xFFB6C294, 0x003D4B1A, 0x83D00014, 0x00702400, 0x70004F7C, 0x83B0000E,
+0x0032E800, 0xE8005A28, 0x5E2A718D, 0x773FFF5E, 0x00510872, 0xC800750C, 0x504C001A, 0x7D835571,
+0x606934FF, 0xD4007F40, 0x70A80045, 0x3A4014B1, 0x6A7042FF, 0x686F3BFF, 0x333124D0, 0x7A005E6B,
+0x001A9800, 0x27719130, 0x1EFF5D63, 0x7550525A, 0x713604F1, 0x9353FF62, 0x7231FF80, 0x8648FF62,
+0x6D30FF78, 0x318C3C5F, 0x28424F1A, 0x3504F132, 0x35FF5866, 0x21FF5962, 0x41FF4A52, 0x3EFF7479,
+0x09B47579, 0x353C1A71, 0x373C1EFF, 0x33311C2C, 0xEFE44243, 0x76BC1F10, 0x3D401FF1, 0x414630FF,
+0x6F785DFF, 0x4C5739FF, 0x4A5533FF, 0x69744CFF, 0x7C875DFF, 0x1F2700FF, 0x939B72FF, 0x7C895DFF,
+0x3D4D20FF, 0x566337FF, 0x0CF1494C, 0xFF454F2A, 0xFF6F7654, 0xFF1D2204, 0xFF3C3E26, 0xFF44432E,
+0xFF413E2B, 0xD8474431, 0x3F2FB1CA, 0x2B1BFF45, 0x4434FF31, 0xB1D1C04B, 0xFF5D4B35, 0xFF7A6852,
+0x2860553F, 0x301F51D0, 0x302DFF33, 0x40491100, 0xE63400A6, 0xF1D0F400, 0x0A060000, 0x141203FF,
+0x1C1D0DFF, 0x34331FFF, 0x50311364, 0x40106F70, 0x5B3F0CF1, 0x503AFF55, 0x6D58FF4E, 0x6D53FF6F,
+0x7759FF73, 0x7558FF7C, 0x7758FF7A, 0xF1698C78, 0x4B542714, 0x606C3AFF, 0x3B4918FF, 0x37421AFF,
+0x1E2503FF, 0x36391AFF, 0x4C4B2DFF, 0x211A00FF, 0x3A3518FF, 0x0CF13C68, 0xFF6A7148, 0xFF7E7D51,
+0xFF735C3A, 0xFFB07567, 0xFFA15C55, 0xFF713D2F, 0x40866651, 0xBD1000D6, 0x392A1731, 0x5271C980,
+0x45FF6F6B, 0xA738605E, 0x393417B1, 0x75734CFF, 0xABAA7CFF, 0x174025B4, 0x84FF3F39, 0x583B312A,
+0xF04F905C, 0x42421C2D, 0x63643CFF, 0x505131FF, 0x585A4CFF, 0x30332AFF, 0x797D6CFF, 0x4A4F38FF,
+0x576043FF, 0x8E9574FF, 0x484929FF, 0x514D30FF, 0x3C3523FF, 0x776F5CFF, 0x8E896CFF, 0x73714BFF,
+0x311700FF, 0x748F9064, 0xD050002C, 0x3C0C1CF1, 0x7444FF3D, 0x4B23FF75, 0x6D4DFF49, 0x2410FF6C,
+0x0500FF29, 0x311AFF0C, 0x9C7AFF39, 0x7343FFA2, 0x713BFF77, 0x7648FF72, 0xF13B9C77, 0x80805A20,
+0x4A4724FF, 0x858060FF, 0x555229FF, 0x96955DFF, 0xACAE6DFF, 0x9BA05DFF, 0x9DA260FF, 0x656529FF,
+0x51511BFF, 0x4A5020FF, 0x515B29FF, 0x5F312FC8, 0x3EC8899B, 0x40940800, 0xFF96A165, 0x804053AC,
+0x18FFACB5, 0x20400037, 0x44150CF1, 0xAB79FF41, 0xB77EFFA9, 0x9555FFB6, 0x7D3EFF95, 0x4009FF7B,
+0xE1ACFF37, 0x006B88D4, 0x880009E8, 0xB88A718E, 0xC092FFB9, 0xB10F38C1, 0xFFA3AB72, 0xFFA3AE74,
+0x9456602B, 0xC5933137, 0x003870C1, 0x20F12C44, 0xFF767C4E, 0xFF6C7244, 0xFF46491C, 0xFF5A552D,
+0xFF544C25, 0xFF1C1500, 0xFF6F683C, 0xFF989464, 0xFF96935E, 0xFF85824B, 0xFF9A9960, 0xB06E7738,
+0x6E54008F, 0x00720000, 0x18F18C4C, 0xFF7C8848, 0xFF6F7B3D, 0xFF9AA86B, 0xFF4D5B20, 0xFFB2C083,
+0xFF899A53, 0xFF889A4E, 0xFF5B7021, 0xFF6C8136, 0x18AABD7B, 0x0E30F108, 0x40FF3F4F, 0x44FF7483,
+0x5EFF7A89, 0x57FF97A7, 0x41FF98A6, 0x3AFF8594, 0x75FF8393, 0x1AFFBBCE, 0x51FF576D, 0x51FF8DA3,
+0x44FF8FA2, 0x26FF7E93, 0x76FF576E, 0x4DFFA8C0, 0x33FF879C, 0x8AD46F82, 0x01143400, 0x10F00D64,
+0x32FF6473, 0x3BFF6075, 0x3FFF6C80, 0x49FF7681, 0x39FF8084, 0x4DFF716E, 0x40FF8380, 0xCCFF7272,
+0x1408F112, 0x08FF414F, 0x10FF3646, 0x2EFF3F4F, 0x17FF5F6F, 0x51FF4B57, 0x00308591, 0x71779800,
+0xFFABB070, 0xC48A8B51, 0x7C4B3183, 0x533B0C7A, 0xFFABB47D, 0x00605847, 0x56318D64, 0x1D7C838E,
+0x92996571, 0x717A43FF, 0xD8005910, 0x00F4000E, 0x714F7000, 0xFF909A5B, 0x5085924D, 0x83319077,
+0xC977FF71, 0x0C26FFB7, 0x8500F018, 0x974FFF75, 0x722DFF8A, 0x682EFF65, 0x28D0FF5D, 0x646E3CB1,
+0x485122FF, 0x283404FF, 0x11313630, 0x7558333A, 0x0060CC00, 0x1C006044, 0x2C00F174, 0x3CFF555D,
+0x14FF656D, 0x2AFF3E44, 0x2E4C5258, 0x316E5400, 0xE07A8340, 0x844C3154, 0x312F147F, 0xE05B5F2D,
+0x14EC000B, 0xB8C19440, 0x204A5CFF, 0x95B8834D, 0x20FF7251, 0x3B6C4A54, 0x57612D93, 0x757E49FF,
+0x56A444FF, 0x97976380, 0x656833FF, 0x0054D0FF, 0x34310AAC, 0x7EB46675, 0x004B7C00, 0xB000370C,
+0x5FF40064, 0x727B4631, 0xAC003200, 0x30E80036, 0x75804831, 0xFC002D6C, 0x7A427136, 0x551CFF6D,
+0x0038604C, 0x2C004D60, 0x0034009C, 0x69773CB1, 0x7E8E4DFF, 0x687B39FF, 0x26316E18, 0x118C515E,
+0x1032B800, 0xF168F82A, 0xFF4E5C03, 0xFF677345, 0xFF4A5223, 0xFF6E733D, 0x185E6128, 0x2C0FF059,
+0x19FF474C, 0x17FF3034, 0x2CFF2A2E, 0x14FF3F43, 0x24FF2629, 0x23FF3437, 0x49FF3237, 0x51A9A061,
+0x5634FF4D, 0x0022C04B, 0x11F017C0, 0xFF48532B, 0xFF3D481E, 0xFF879468, 0xFF768858, 0xFF415522,
+0xFF95A679, 0xFF36451A, 0xFF3C4822, 0x0880194C, 0x04FF1C22, 0xC0FF1619, 0x34252212, 0x2F31CBB8,
+0xCADC4340, 0x2B281531, 0x0CF1C9CC, 0xFF323019, 0xFF383218, 0xFF5E583E, 0xFF2A280F, 0xFF494833,
+0xFF565541, 0xDC5F5C4B, 0x5001F0C0, 0x31FF6A61, 0x15FF4940, 0x00FF291F, 0x2CFF120A, 0x362AB1B7,
+0x4130FF3A, 0x4D37FF44, 0x31415852, 0x185F6645, 0x321A3145, 0x00BF6C30, 0x2E71C0DC, 0x3DFF514A,
+0x784C605B, 0x555A3231, 0x61714BF0, 0x3CFF8694, 0x1E785D6D, 0x313B3400, 0x30171C00, 0x7A5B7114,
+0x684AFF7B, 0x00694069, 0x18000F58, 0x70CC0045, 0x94805D31, 0x18F1A220, 0xFF5B4722, 0xFF90845C,
+0xFF5D5A2F, 0xFF535428, 0xFF58562D, 0xFFC0BC96, 0xFF9E9973, 0xFF4A4420, 0xFF6B6742, 0x14908C66,
+0x4B1FC022, 0x845FFF4C, 0x3D1BFF88, 0x2068FF43, 0x918E6BB1, 0x514E2BFF, 0x7A7852FF, 0x04F17440,
+0xFF595935, 0xFF8F9277, 0xFF696D52, 0xFF5E653B, 0xC8A9B182, 0x63A4006C, 0xF081C400, 0x8280591D,
+0x554E32FF, 0x7D765AFF, 0x9B9772FF, 0x87855CFF, 0xB0B283FF, 0x414216FF, 0x45431CFF, 0x5B5930FF,
+0x555225FF, 0x77764AFF, 0xF0004CFF, 0x43422441, 0x28220AFF, 0x5C543DFF, 0x655E41FF, 0xB8B38DFF,
+0x545020FF, 0x797641FF, 0x858353FF, 0x565529FF, 0x54522BFF, 0x5B5932FF, 0x8B8761FF, 0x848252FF,
+0xA7A96AFF, 0x535611FF, 0xADB36DFF, 0x808240FF, 0x6D6B2EFF, 0x76753FFF, 0x626536FF, 0x001BD4FF,
+0x600066FC, 0x5B279025, 0xC792FF51, 0x542EFFBE, 0x6D752137, 0x50007100, 0x96633146, 0x312AC48E,
+0x1CB7BA83, 0x9C5E7163, 0x8E52FF9C, 0x0007A08D, 0xA831035C, 0x6174D0DA, 0xB117B400, 0xFF636536,
+0xFFC8CA9B, 0xF4A0A273, 0x207C002A, 0x6CC86210, 0x407A8221, 0x521F315D, 0x3104244E, 0x1C6C7540,
+0x3748004A, 0xC59904F1, 0x542CFFC6, 0x6134FF59, 0x9262FF64, 0x7B4AFF94, 0x7118547D, 0xFF8A8953,
+0x4475763D, 0x7032727D, 0x6D31FF62, 0xF1969462, 0xFF7A8207, 0xFF838C4D, 0xFF4B5516, 0xFF7D894B,
+0xFFB4BF85, 0xB0657336, 0x4A05F094, 0x21FF8699, 0x60FF5F72, 0x2AFF9AAC, 0x71FF5969, 0x0CFF9EAC,
+0x6C400073, 0xA25D2CF1, 0xB76FFF95, 0x8C40FFAA, 0xA051FF80, 0x7424FF93, 0x9647FF67, 0x772DFF88,
+0x520CFF65, 0x934CFF41, 0x661EFF82, 0xA45FFF52, 0x570FFF8F, 0x9B4EFF41, 0x7F32FF86, 0x6F2AFF6A,
+0xF18CC05B, 0x53622B08, 0x65773DFF, 0x9AB169FF, 0x758D41FF, 0x7A8A41FF, 0x3F4805FF, 0x34319B60,
+0x04206A6A, 0x0028A000, 0x2C004118, 0x581A3186, 0x0005B84A, 0x340004B4, 0x7533407C, 0x0950FF69,
+0x8F9356D0, 0x84834DFF, 0x676437FF, 0x55DC32FF, 0x54808621, 0x62E80054, 0x77803F31, 0x7C009704,
+0x6F40806A, 0x6C3FFF6C, 0x3C74FF69, 0x49541C71, 0xA4AE72FF, 0xC4001D5C, 0x3B580010, 0x5E1E18F1,
+0x8C46FF52, 0x6E23FF7F, 0xA151FF5E, 0x9F4EFF90, 0xB366FF90, 0x6826FFA5, 0x4509FF5D, 0x975BFF3B,
+0x9A61FF8D, 0x40108491, 0xFF3F4914, 0x04F17014, 0xFF525C2A, 0xFF3E431B, 0xFF4D4F27, 0xFF747647,
+0x18464A17, 0x4A700070, 0x636A4031, 0x39311AA4, 0x891C6068, 0x602300F1, 0x702CFF56, 0xAE6DFF65,
+0x8748FFA5, 0x3147107D, 0x5C4F5724, 0x8F65B12B, 0x7C50FF8E, 0xA374FF75, 0x0084449A, 0x6C007278,
+0x59289022, 0x592AFF51, 0xCC49FF50, 0x90973073, 0x312CCCFF, 0x44A7A977, 0x9B440042, 0x99A66171,
+0x54631EFF, 0xEC007500, 0x9761310A, 0x00192C92, 0x12806E50, 0x3BFF434B, 0xBCFF6770, 0x87553122,
+0x4046607B, 0xFF4E5D22, 0x4E31169C, 0x23087887, 0x00415000, 0x453127C4, 0x5658767B, 0x20050000,
+0x87348142, 0x37FF7451, 0x4AEC606D, 0x3150A800, 0x00586436, 0x61D4000A, 0x4C582A31, 0x14000500,
+0x2A2CF147, 0x2AFF5C5C, 0x2EFF4649, 0x2AFF484B, 0x12FF3F43, 0x0CFF272B, 0x25FF2228, 0x25FF3B41,
+0x22FF393F, 0x36FF323A, 0x20FF4851, 0x26FF363F, 0x32FF414B, 0x0CFF4D57, 0x03FF252F, 0x4E341E28,
+0x9B6C0CF1, 0x7E4AFF8B, 0x9E69FF6C, 0x7E4EFF8A, 0x3D12FF6C, 0x4420FF2E, 0x2306FF38, 0x8034CC1A,
+0xFF262916, 0xFF1C1E10, 0x1F31AB4C, 0xF5482E2F, 0x27291431, 0xF4006DC4, 0x4020006D, 0x00190C00,
+0x3BB177FC, 0x31FF5558, 0x2CFF4B4B, 0x04C84543, 0xCBE04610, 0xFF433BA1, 0xFF342C19, 0x44312A18,
+0xD6D400BB, 0x514B3D31, 0x3431C458, 0x2CEC4F4A, 0x71785631, 0x09311E7C, 0xD0682728, 0xF104FC00,
+0x463F2218, 0x373214FF, 0x3B3B17FF, 0x5A6137FF, 0x616D3FFF, 0x93A372FF, 0x536535FF, 0x5C6D41FF,
+0x44502AFF, 0x1D2403FF, 0x1C315FF4, 0x41043D3E, 0x2F2E12B1, 0x4C4F32FF, 0x464E27FF, 0x04F18140,
+0xFF848355, 0xFF7A7848, 0xFF696838, 0xFF4D4F1E, 0x34838553, 0x4400F115, 0xA7FF7375, 0x32FFD8D7,
+0x4CFF635F, 0x252C7D76, 0x7F5610F1, 0x3C13FF81, 0x512AFF3E, 0x5D38FF53, 0x4E2BFF61, 0x9B78FF52,
+0xA883FF9F, 0x2D08FFAC, 0x00313431, 0x04F197A4, 0xFF6B6940, 0xFF3F3F1D, 0xFF888A65, 0xFFC4C896,
+0x9C9AA16D, 0x4A1A7181, 0x5D2AFF3E, 0xF043FC56, 0x87815D13, 0x5E5836FF, 0x5F5D34FF, 0x6F7044FF,
+0x3B3C10FF, 0x57582EFF, 0x32300AFF, 0x5E5C36FF, 0xDC784FFF, 0x9471114B, 0x8162B122, 0x694CFF84,
+0x4F32FF6E, 0xB14CC856, 0xFF817E55, 0xFF5A5626, 0x00807E4B, 0x0500F105, 0x4EFF3532, 0x3DFF7977,
+0x87FF6866, 0x6C98B6B5, 0x8E4D00F1, 0x9851FF8C, 0xAA62FF95, 0xA866FFA4, 0x71A3A0A6, 0xFF818249,
+0xDC353C09, 0x460E404D, 0x34CCFF39, 0x262E0031, 0x20004F90, 0x3AF0007B, 0x0049C400, 0xB8002A54,
+0x7704F158, 0x1FFFA7B0, 0x25FF5257, 0x13FF5C60, 0x29FF4E4F, 0x2FC06064, 0xB17CF400, 0xFFC2CA9B,
+0xFF7E8657, 0x309AA070, 0xA204F162, 0x54FFCED1, 0x4CFF7E81, 0x5FFF7679, 0x47FF858B, 0x12C46D73,
+0xB6BD8A31, 0x5D318184, 0x40088C93, 0xF0673020, 0x8116F125, 0x292A00FF, 0x403F13FF, 0x686836FF,
+0x585B26FF, 0x797C45FF, 0xB0B07AFF, 0x858551FF, 0x80834EFF, 0x757F43FF, 0x94004BD4, 0x7A3F500A,
+0x1C40FF72, 0x868CA15A, 0xA6AF70FF, 0xBEC88BFF, 0x0CF17D40, 0xFF2B3600, 0xFF596922, 0xFF849748,
+0xFF9BAE5D, 0xFF809246, 0xFF7B894C, 0x9C77814C, 0x304C002B, 0xF1719400, 0x66702B10, 0x9BA560FF,
+0x5F6924FF, 0x4A540FFF, 0x85904CFF, 0x828E4EFF, 0x384608FF, 0x71803FFF, 0x46801418, 0x19FF778B,
+0x5CFF4C60, 0x7C347196, 0xB06CFF68, 0xF109CC9F, 0x56652C10, 0x223400FF, 0x6C863CFF, 0xA9C173FF,
+0x475811FF, 0x64712CFF, 0x7A8342FF, 0x4B5016FF, 0x55B17860, 0x74FF8088, 0x0DFFA5B0, 0x69CC3F4B,
+0x00048000, 0x28005068, 0x5534009F, 0x737D4031, 0x7431A4DC, 0x2270A7A5, 0x91906431, 0x2000136C,
+0xB171714C, 0xBA7AFFAB, 0x007774B4, 0x4471154C, 0x50FF7173, 0x72C07D7F, 0x929B6671, 0x39420BFF,
+0x5000141C, 0x93573140, 0x000EA089, 0x01908BF8, 0x23FF3743, 0x49FF5C69, 0x6C217710, 0x00598C60,
+0x68001B78, 0x5B54006A, 0x0042E000, 0xF8001F48, 0x804F311A, 0x10612C78, 0x225D783E, 0x27E85254,
+0xFF676E30, 0xB00024D4, 0x5E38503A, 0xAC54FF58, 0x5059613D, 0x555F23FF, 0x58B14C30, 0x68FF8D97,
+0x03FF9AA6, 0x6A88323D, 0x807F53C0, 0xA19F76FF, 0x575D31FF, 0xF11454FF, 0x9EA67508, 0x727848FF,
+0x686E3EFF, 0x595F31FF, 0x82895DFF, 0x9EA778FF, 0x48000010, 0x7A487189, 0x6028FF78, 0x71476C5B,
+0xFF7B8745, 0x945D6A25, 0x5D2731A0, 0xF118E058, 0x5C5D2400, 0x64682DFF, 0x595C25FF, 0x5A612DFF,
+0x493127B8, 0x81E46E7C, 0x62743880, 0x4A5C22FF, 0x004164FF, 0x60002ED8, 0x6630B12D, 0x5523FF61,
+0x5F2AFF53, 0x71842056, 0xFF6E7E40, 0xA4697B3F, 0x3B08F155, 0x27FF5D69, 0x2AFF4752, 0x20FF4B58,
+0x28FF4553, 0x3EFF4F5D, 0x5FCC626E, 0x66673B71, 0x6A693BFF, 0x0CF127D0, 0xFF424228, 0xFF2D2F17,
+0xFF30361A, 0xFF37411E, 0xFF616D47, 0xFF7A8662, 0xCC424C2A, 0x4A292009, 0x5011653C, 0x0B904594,
+0x11FF242E, 0x2EFF2A34, 0x6B217D58, 0x7182545B, 0xFF8A9C68, 0xF8435525, 0x4220D027, 0x4126FF37,
+0x2B17FF38, 0x942AFF26, 0x1F21B1F9, 0x222417FF, 0x2F3123FF, 0x210510FF, 0x27F42529, 0x3A4120B1,
+0x636D4AFF, 0x88946EFF, 0x21602808, 0x34FF3E42, 0xA0586052, 0x583AFF4D, 0x6444FF5D, 0x8C2CFF69,
+0x494627B1, 0x939274FF, 0x4B4932FF, 0x1440E3AC, 0xFCFF2D28, 0x1DA80004, 0x5E5F3F50, 0x121079FF,
+0xFF3A4261, 0x644B4D28, 0x2405F087, 0x34FF4841, 0x19FF5851, 0x1EFF403C, 0x2FFF4444, 0xFCFF5259,
+0x3605F05D, 0x09FF5263, 0x47FF2437, 0x32FF6273, 0x05FF4A59, 0x9CFF1D27, 0x67C80019, 0x734C09F0,
+0x3615FF71, 0x512FFF32, 0x744EFF4B, 0x3910FF6E, 0x582BFF34, 0x2EA8FF55, 0x696F4140, 0xF13830FF,
+0x6E6D3F14, 0x928F62FF, 0x7D7C4EFF, 0x828155FF, 0x67623AFF, 0x726D45FF, 0xB6B48DFF, 0x5F5D36FF,
+0x66643EFF, 0xA4008318, 0x3B08F190, 0x8DFF625E, 0x6AFFB4B0, 0x07FF928C, 0x32FF2F29, 0x21FF5E5B,
+0x53A05452, 0x78754C71, 0xA4A07BFF, 0x15400F30, 0xE4FF3B3D, 0x0805F037, 0x06FF2833, 0x67FF2E34,
+0x34FF9496, 0x17FF605D, 0x4CFF4340, 0x468C000A, 0xF141BC00, 0x22220008, 0x5D5A3BFF, 0x83805FFF,
+0x47431EFF, 0x46441DFF, 0xC6C49DFF, 0x10000A54, 0x5600F100, 0x50FF7F7B, 0x03FF7A76, 0x3AFF302F,
+0x09346A67, 0x85541DF0, 0xB282FF87, 0xAB7FFFB4, 0x4214FFAC, 0x743EFF43, 0x7E41FF74, 0x9653FF7A,
+0xA45CFF91, 0x9853FF9E, 0xA866FF95, 0xC083FFA3, 0x35C0FFBC, 0x7E8B5671, 0x9BA974FF, 0x5BB17CE8,
+0x00FF8491, 0x41FF2128, 0x22C06469, 0x323B0631, 0x6F711E20, 0x14FF99A8, 0x8B50404F, 0x006B9400,
+0xE4009FA0, 0xAA723158, 0xD07778A5, 0xFF535724, 0xFF8F9263, 0xFFB8BE90, 0x6107C01A, 0x87FF646C,
+0x608CB1B7, 0x7A5400F1, 0x815BFF7A, 0x350BFF81, 0x8152FF34, 0x0032687E, 0x55B17338, 0x6BFF868B,
+0x22FF9A9E, 0x1A204E57, 0x5B5C3031, 0xD4004B48, 0x7032710C, 0x8949FF6A, 0xB195E883, 0xFFB9B985,
+0xFFCACC9B, 0x48A8AF79, 0x6BFC0045, 0x555A2431, 0x7C006898, 0xDB9F5062, 0x681DFFD5, 0x464F2170,
+0x10F15888, 0xFF77843E, 0xFF9FAF64, 0xFF95A658, 0xFF54641B, 0xFF7C874D, 0xFF87915D, 0xFFB0B984,
+0x88464E15, 0x9B5B316E, 0x0068C095, 0xB800499C, 0x00040040, 0x4040CC00, 0xFF8F995D, 0x0C800FF8,
+0x55FF3C4A, 0xB8FF8796, 0x7736318F, 0x00859C68, 0x08F17B88, 0xFF7B8A47, 0xFFA1B06F, 0xFF5C7029,
+0xFF698437, 0xFF6F893F, 0x10697B3D, 0x80404088, 0x5530FF74, 0x4C5526B1, 0x6D7649FF, 0x9CA56EFF,
+0x52711CE4, 0x2CFF7C7F, 0x321C595B, 0x316F2800, 0xEC677238, 0x3810F169, 0x6BFF6567, 0x12FF9B98,
+0x84FF4541, 0x2AFFBABA, 0x5EFF6268, 0x6FFF989E, 0x4BFFAAAF, 0x24608286, 0x5C602EC0, 0x777745FF,
+0x73733FFF, 0x316044FF, 0x54959C66, 0x693B4001, 0x2D6CFF63, 0x889150B1, 0xAEB776FF, 0x5E6829FF,
+0x74006A54, 0x82280031, 0x7C042410, 0xFF646870, 0xFF9A9D6E, 0x18006440, 0x4A183179, 0x10656C46,
+0x215D7C13, 0x11604B50, 0x807E5531, 0x8C005570, 0x4D1F3154, 0x00005C47, 0x197185B8, 0x3EFF3B42,
+0x7D8C6A71, 0x3159C400, 0x78656C38, 0x14940019, 0x5B662E71, 0x6A733EFF, 0x6FB10444, 0x22FF9C9B,
+0x43FF4C4F, 0xD7F4696F, 0x006A5C00, 0x5D318490, 0x64608588, 0x49522531, 0x54000F48, 0x4D1BB102,
+0x8D55FF4B, 0x6D34FF88, 0x000AC065, 0x280068CC, 0x4D3C003D, 0x5C2E08F1, 0x8754FF5D, 0x6630FF89,
+0x7443FF67, 0x713FFF76, 0x7142FF6D, 0xF109BC69, 0x3F511704, 0x5F7336FF, 0x4B5D21FF, 0x596B2DFF,
+0x9CAC6EFF, 0x2A4029DC, 0x48FF5B60, 0x008C000C, 0x7F8C5631, 0x2BB1A038, 0x1FFF5162, 0x3EFF414D,
+0x52DC5E69, 0x408EE400, 0xFF55642D, 0x3E310BB4, 0x642C6470, 0xF11C2000, 0xA8A97D14, 0x3B3922FF,
+0x37371FFF, 0x33361BFF, 0x363D1CFF, 0x39451DFF, 0x5F6E43FF, 0x35441BFF, 0x232F07FF, 0x173104EC,
+0x43A43239, 0x003FD000, 0xF40027EC, 0x4F29B18B, 0x5A2FFF43, 0xAC7BFF4B, 0x7123709C, 0xFF334014,
+0x6C535D38, 0x2E0CF118, 0x21FF4045, 0x20FF2F32, 0x1DFF2D2E, 0x3FFF2929, 0x57FF4B4D, 0x28FF6667,
+0x72D03A3D, 0x31694800, 0x306A724D, 0x431DE02D, 0x4C27FF37, 0x3716FF42, 0x4223FF33, 0x5EA0D458,
+0x615B37FF, 0x413F19FF, 0x401338FF, 0xFF4F542B, 0x3FB12CD8, 0x5BFF5B5E, 0x32FF7777, 0x42C84F4E,
+0x47462731, 0x17B12264, 0x29FF3940, 0x35FF4C53, 0x04545D60, 0x47422271, 0x5A5434FF, 0x88003BD4,
+0x2F08F149, 0x2DFF515A, 0x18FF4C59, 0x06FF3042, 0x26FF1E30, 0x50FF3F50, 0x23F06877, 0xF1878800,
+0x7C7C5608, 0x272800FF, 0x3A4117FF, 0x949F74FF, 0x737A51FF, 0x676E44FF, 0x940008B0, 0x5D14F15C,
+0x1CFF8087, 0x16FF4045, 0x36FF423F, 0x60FF6461, 0x61FF898A, 0x32FF8A8B, 0x1EFF6159, 0x00FF4D45,
+0x33C02827, 0x464519B1, 0x6D6B42FF, 0x514F28FF, 0x02F02F3C, 0xFF413D1A, 0xFF6C6644, 0xFF615B3B,
+0xFF635E38, 0xF1A6BC4C, 0xFF817E03, 0xFFB2AE81, 0xFF7A754F, 0xFF6F6945, 0xE843431F, 0x30053146,
+0x80118425, 0xFF44471A, 0xFF838556, 0x1FB10208, 0x2CFF4A4B, 0x01FF5457, 0x61C42628, 0x4B2A04F1,
+0x3C1CFF4E, 0x3C17FF41, 0x744DFF40, 0x885CFF76, 0xC02B1887, 0xFF75734A, 0xFF403E15, 0xFFB7B68A,
+0x2FF00E70, 0xFFA7A678, 0xFF929161, 0xFF7D7D4B, 0xFF696736, 0xFF8C8B5F, 0xFF4E4D1D, 0xFF52561B,
+0xFF797E3C, 0xFFA1A761, 0xFF8A904A, 0xFF676928, 0xFFACB171, 0xFF93995B, 0xFF737D41, 0xFF929F69,
+0x8E30743F, 0x34FF5151, 0x56345E68, 0x2C0A00F1, 0x8D65FF2B, 0x8151FF8B, 0x561EFF7B, 0x7190644B,
+0xFF77894B, 0xCC334606, 0x03C40017, 0x88915C80, 0xCFD6A2FF, 0x0026C8FF, 0x0AF06334, 0xFF909260,
+0xFFE2E9B6, 0xFF636D39, 0xFF99A671, 0xFFB9C391, 0xFF676E42, 0x216FA429, 0x2FF01C1A, 0x53572531,
+0xE8007CD8, 0x59238072, 0x8C5AFF54, 0x7328FF8A, 0x7C835071, 0x707145FF, 0x84002708, 0x8D4A7185,
+0x7D38FF84, 0xC0714C73, 0xFF717341, 0xFFA3A576, 0xFFB3BA87, 0x04F11D40, 0xFF868856, 0xFF767944,
+0xFF63662D, 0xFFA2A76D, 0xBC575C22, 0x4A8400A5, 0x470A08F1, 0xA862FF3D, 0x590EFF9B, 0x7930FF4B,
+0x6522FF69, 0x733EFF56, 0x3117D869, 0x34515824, 0x71980021, 0x00A9E800, 0x6A310414, 0x9C049BA0,
+0x00448000, 0x980036A8, 0x4FC40069, 0xB10A6C00, 0xFF6E7839, 0xFF545E1F, 0x44444F15, 0x87EC008C,
+0x955218F1, 0x823DFF86, 0x853DFF73, 0x7329FF71, 0x9F59FF5B, 0x5C21FF88, 0x7740FF48, 0xA163FF66,
+0x490EFF91, 0x4818FF3B, 0x313D143C, 0x0C4A531E, 0x7504F192, 0x4FFFA2A1, 0x4AFF7F7C, 0x5CFF8384,
+0x80FF949A, 0x3CA4B0B9, 0xF3310000, 0x88855818, 0x6B6835FF, 0x8C8B52FF, 0x979C5AFF, 0x898E4BFF,
+0xAAAA6CFF, 0x55541BFF, 0x5B5B29FF, 0x7F7E4EFF, 0x9C9964FF, 0x02F11504, 0x723FFF98, 0x7D57FF6E,
+0x522AFF7D, 0x7D48FF51, 0x71565C7A, 0xFFA2A86C, 0x889DA26A, 0x50D0004C, 0xF1046400, 0x676A3500,
+0x75764AFF, 0x9F9E72FF, 0x888856FF, 0x2A310544, 0x8F3C5556, 0x492100F1, 0x653DFF47, 0x7549FF64,
+0x5123FF76, 0x3147EC52, 0xA45E6434, 0x3B128023, 0x7955FF36, 0x67C8FF73, 0x2C401810, 0xFF666B30,
+0x8000149C, 0x491B4069, 0x4D50FF43, 0x00739000, 0x7A600A98, 0x51FFACAA, 0x70BA207E, 0x976BFF62,
+0x400BFF91, 0x44455253, 0xE0815DFF, 0x57B4001F, 0x414A1B31, 0x0D717A70, 0x21FF3940, 0x24D45257,
+0x71660000, 0xFF404714, 0xA86D6F3E, 0x2404F111, 0x18FF4C4A, 0x4DFF413D, 0x54FF7C77, 0x4FFF8780,
+0x11E8807C, 0x4C532731, 0x283166C0, 0x9CB04E5F, 0x591B01F1, 0x6B2BFF47, 0x9F5FFF58, 0x7031FF8C,
+0x5F34FF60, 0x656D00F0, 0x79814EFF, 0x586530FF, 0x5E6C37FF, 0xF13C18FF, 0x424E2000, 0x576335FF,
+0x535F2FFF, 0x46541FFF, 0x3031A244, 0x23285A69, 0x00370C00, 0x90401BC4, 0x54FFBBBC, 0x1E11F04D,
+0x10FF3838, 0x1FFF2B30, 0x10FF3A44, 0x26FF2A39, 0x0FFF4152, 0x0CFF2B3C, 0x1CFF2939, 0xF4FF3944,
+0x42243104, 0xF13F803D, 0x1F260520, 0x343E1BFF, 0x46512FFF, 0x4C5832FF, 0x687146FF, 0x282F03FF,
+0x4F562DFF, 0x545A38FF, 0x3C3F24FF, 0x464832FF, 0x2F2E1CFF, 0x252314FF, 0xFC0077E8, 0x3D2B710E,
+0x4D35FF3E, 0x31728C4B, 0x20575D3B, 0x542D2069, 0x06F1B4B8, 0x2E0EFF3F, 0x4C2EFF29, 0x4B2EFF4D,
+0x6847FF52, 0x7753FF71, 0x0055447D, 0xBC004FEC, 0x572B4082, 0x286CFF4A, 0x7186E800, 0xFF414425,
+0x943E3F1F, 0x1C0CF137, 0x1AFF3F41, 0x06FF3D44, 0x34FF2B32, 0x49FF5E61, 0x23FF7273, 0x67FF4946,
+0x8C3C8D8A, 0x686D4431, 0x08F100A0, 0xFF37461D, 0xFF20300B, 0xFF344620, 0xFF2E3E17, 0xFF2C3B14,
+0xFC141F00, 0x2104F15E, 0x2FFF4844, 0x9DFF5A58, 0x1FFFC8D2, 0x40FF4759, 0x303C6672, 0x003AEC00,
+0x880038EC, 0x49CC0087, 0x401A0DF0, 0x875EFF44, 0x6C42FF89, 0x794DFF65, 0x754CFF73, 0x3508FF7E,
+0x7B47FF40, 0x53DCFF7B, 0x31A8CC00, 0xC497985F, 0x7243B138, 0x3F1AFF70, 0x2606FF43, 0xF1FE942C,
+0x524C2804, 0x777441FF, 0x716E37FF, 0x877F51FF, 0x9E956CFF, 0x26B152A8, 0x4FFF514F, 0x45FF767E,
+0x59706B74, 0x006D0000, 0x0CF17AA4, 0xFF76794A, 0xFF8D9365, 0xFF62683C, 0xFF62643C, 0xFF818258,
+0xFF4A471E, 0x20757249, 0x14A0000A, 0x999C6FD0, 0x4F5223FF, 0x3A390BFF, 0x1D689CFF, 0x28787A21,
+0x5488002B, 0x64754620, 0x43600043, 0xFF7217F0, 0xFF727145, 0xFF464515, 0xFF616528, 0xFFB4BB77,
+0xFFAAB16D, 0xFF939856, 0xFF6B6C30, 0xFFA1A56A, 0xFF596125, 0xB8000D40, 0x18B8003E, 0x00527800,
+0xF0005294, 0x4122B147, 0x6E48FF42, 0x8A5BFF6E, 0x310D7087, 0x0C7C874B, 0x52133131, 0x0016B442,
+0x0E312780, 0x59C83640, 0xA86B1DF0, 0x8947FFA4, 0xB77CFF84, 0xBE88FFB3, 0x9C66FFB7, 0xC792FF8F,
+0xA371FFB9, 0x9C6DFF97, 0x360BFF93, 0x491DFF33, 0x5D2BFF4A, 0x11E8FF5D, 0x00535400, 0x00B175E4,
+0x41FF1C1F, 0x66FF7777, 0x03BC979C, 0x7A794D31, 0x0F103AF4, 0x61210888, 0x008FBC57, 0x30316890,
+0x68005F5E, 0x5A2800F1, 0xAE7BFF56, 0x612DFFAA, 0x753FFF61, 0xA000C475, 0xFF62682C, 0xFF454A12,
+0x49885721, 0x72347611, 0x8D9A5431, 0x1F319EB0, 0x1C1C5561, 0x00128C00, 0x68007C14, 0xAD729012,
+0xAB73FFA5, 0x1826FFA6, 0x888E703D, 0x9FA46AFF, 0x00459CFF, 0x3B3122C4, 0xB3F86F72, 0x010E8400,
+0x03F17808, 0x1EFF7076, 0x12FF565C, 0x58FF4049, 0x5FFF838D, 0x80B4909B, 0xB1A9A800, 0xFFAEC27D,
+0xFF6D823F, 0xA0334708, 0x591400A5, 0x4F6029B1, 0x4A5922FF, 0x4D5B28FF, 0x68007E58, 0x7008F183,
+0x89FFA0A2, 0x3EFFBDB9, 0x58FF7670, 0x56FF9391, 0x92FF9192, 0x18E4C6CE, 0xA16F30F1, 0x7642FF9F,
+0xA06AFF76, 0x783CFFA1, 0x7939FF78, 0x8746FF74, 0x975AFF85, 0x7F44FF99, 0x804AFF81, 0x602DFF81,
+0xB27EFF62, 0x7B44FFB8, 0xB885FF80, 0xA473FFBA, 0x7A53FFA2, 0x7650FF7C, 0x315EE078, 0x545E5D2D,
+0x073C002D, 0x58592FB1, 0x4C4D25FF, 0x7C7D55FF, 0x6B7148CC, 0x40FF9694, 0xAE3C6E6B, 0x6A3D10F1,
+0x754AFF6D, 0x7148FF78, 0x6D41FF74, 0x491BFF6E, 0x6436FF4A, 0x8857FF65, 0x4814FF86, 0x71196441,
+0xFF4C5226, 0x3C41461E, 0x51287153, 0x3000FF4A, 0x222DA82A, 0x95047347, 0x82825E31, 0x01F08FE4,
+0xFF6C6F42, 0xFF777948, 0xFFAEAC7B, 0xFF595726, 0x04F102F4, 0xFF7C7E56, 0xFF3B3A1C, 0xFF48472B,
+0xFF5B5839, 0xAC51512B, 0x7DBC007D, 0x31934000, 0x283F4613, 0x4FFC0079, 0xF00A6800, 0x31360D06,
+0x635F3CFF, 0x625B3EFF, 0x888366FF, 0x383316FF, 0xE7F430FF, 0x615820F0, 0x78724EFF, 0x45431DFF,
+0x4A4F27FF, 0x5A6338FF, 0x4B5725FF, 0x617037FF, 0x4C5C1DFF, 0x495918FF, 0x6B803DFF, 0x839654FF,
+0x6D7738FF, 0x0087F4FF, 0x2F802830, 0x3FFF5462, 0x20FF6273, 0x68382089, 0x6B110B34, 0x28B18E1C,
+0x2AFF5261, 0x22FF5665, 0x461C4C5B, 0x711BE800, 0xFF676E3B, 0x28C6CA97, 0x86F800D8, 0xF06F1000,
+0x424D2311, 0x425128FF, 0x495A2EFF, 0x475929FF, 0x4E5E31FF, 0x57623AFF, 0x535A38FF, 0x2B2F14FF,
+0xF18640FF, 0x292E1000, 0x585F3EFF, 0x2A3515FF, 0x414B29FF, 0xF8003194, 0x3F01F072, 0x2DFF6061,
+0x36FF4B4C, 0x25FF5050, 0xE4FF3D3D, 0x2308F118, 0x20FF3734, 0x14FF3332, 0x2BFF2928, 0x26FF4140,
+0x1CFF3E3E, 0x78283838, 0x2F331031, 0x98003C40, 0x4124B177, 0x4A31FF3E, 0x4C32FF4E, 0x71C42853,
+0xFF4D4926, 0xC8666843, 0x67393163, 0x7171985A, 0xFF525C39, 0x14626948, 0x3211314E, 0x0087682E,
+0x20004178, 0x5EBC008C, 0xC39401F0, 0x4E22FFC0, 0x3E18FF4D, 0x7955FF3E, 0x29C8FF79, 0xF106C000,
+0x4C572F0C, 0x46552EFF, 0x253511FF, 0x283915FF, 0x2B3B16FF, 0x25340DFF, 0x152100FF, 0x38B14A2C,
+0x55FF5F5B, 0x97FF8380, 0xA2FCC6D4, 0x5D6A3571, 0x333B0CFF, 0x8400421C, 0x3F173109, 0x0096043D,
+0x79314620, 0x545CA39F, 0x936049F0, 0x8A5AFF8C, 0x602CFF90, 0xC38CFF67, 0xA971FFC0, 0x6F36FFA4,
+0xC58CFF6C, 0x6B34FFC4, 0x4716FF68, 0x4E25FF45, 0x906EFF51, 0x3114FF96, 0x3D1CFF3A, 0x7B4BFF46,
+0x6834FF7F, 0x8D5EFF6E, 0x6036FF95, 0x6138FF6C, 0x4D20FF6A, 0x9764FF50, 0x4814FF90, 0x4211FF3E,
+0x6800FF3A, 0x0080C800, 0xBA4081A0, 0x18FFE1E9, 0x5124311D, 0xB104C44E, 0xFF716D40, 0xFF676034,
+0xF05B562C, 0x5B0000AB, 0x712B3000, 0xFF313302, 0xC47C7E4D, 0x61500040, 0x696C3D71, 0x424614FF,
+0x3C0089D8, 0x8254B18A, 0x7B4BFF83, 0x6224FF7C, 0x3194105C, 0x54AEB572, 0x13F4000E, 0x002CBC00,
+0x11F07198, 0xFF343C01, 0xFF888F59, 0xFF3F4310, 0xFF858957, 0xFF5E6031, 0xFF222000, 0xFF413E1B,
+0xFF3B3C14, 0x6B32259C, 0x2068A0A5, 0xEC5C6621, 0xA7680058, 0xB07828F1, 0x6435FFA5, 0x3C09FF5B,
+0x8B4BFF34, 0xD28FFF85, 0x7030FFCD, 0x6B30FF6B, 0xCA94FF63, 0x854FFFBD, 0x4411FF74, 0xB27EFF36,
+0x4718FFA8, 0x8F5DFF44, 0x5F2BFF8D, 0x0017005F, 0x1B7185CC, 0x09FF4853, 0x72AC3D40, 0x6D723831,
+0xAC002AD0, 0x4700F1B1, 0x1AFF7675, 0x5CFF5056, 0x3EFF969F, 0x13E4767F, 0x9C724620, 0xFF70205D,
+0x57200DC0, 0x9163F48F, 0x571EFF9A, 0x7B3FFF56, 0xF1963875, 0x3F461008, 0x3B440DFF, 0x8D965DFF,
+0xA0AC6CFF, 0x68752FFF, 0x8F9C56FF, 0x5FC01928, 0x37FF8993, 0x2FFF5B64, 0xD8FF565E, 0x995E9009,
+0x6832FF91, 0x3C4EFF61, 0x666E2176, 0x7D31B870, 0x81C0AEB6, 0x31286400, 0x3493965D, 0x05780069,
+0x90925331, 0xA8007350, 0x0B04002B, 0x00501C00, 0x10F168EC, 0xFF9BAA69, 0xFF97AA68, 0xFF728545,
+0xFF384B0B, 0xFF3F4E13, 0xFF59682F, 0xFF1A2900, 0x88515F2A, 0x8888003C, 0x8D5909F0, 0x9964FF86,
+0x9F6AFF96, 0xA66FFFA2, 0x945DFFAB, 0xA56DFF97, 0x6E68FFA6, 0x48501431, 0x1F715A4C, 0x4DFF5356,
+0xB4B48687, 0xB110A400, 0xFF6A6B2F, 0xFF817C45, 0x94A39C68, 0x2304F1A0, 0x3BFF5B55, 0x69FF786E,
+0x45FFA49D, 0x5DFF7B78, 0xA2908C8B, 0x765302F0, 0x6944FF7A, 0x4E28FF6D, 0x7C51FF52, 0xF843FF7F,
+0x6603F155, 0x5430FF68, 0xAF8CFF54, 0x926CFFB2, 0x7852FF94, 0x715A4C7C, 0xFFD1CCA4, 0xC0BDB590,
+0x8864B1D1, 0x8A62FF90, 0x4C1FFF8F, 0x31466050, 0xEC5A5929, 0x46980090, 0x2B310531, 0x4A408A20,
+0x0CFF6A70, 0x4D1E7145, 0x8756FF4A, 0xB1261885, 0xFF68633D, 0xFF605D3C, 0x94585836, 0x89597116,
+0x713EFF8A, 0x316F6873, 0xB0545826, 0x3617B10C, 0x4F33FF35, 0x5D3EFF50, 0xB1950060, 0xFF61693A,
+0xFF8F9965, 0xA4757D4A, 0x284C0081, 0x441209F0, 0x4F23FF40, 0x3F1AFF49, 0x3B1EFF3D, 0x331CFF40,
+0x472FFF3B, 0xED34FF4D, 0x009F8000, 0x00C0DC8C, 0x4BFF1E18, 0x42FF726E, 0x34FF6567, 0x4011314D,
+0x3163E837, 0x286A7636, 0x6A277182, 0x9856FF55, 0x00B4F885, 0x12B1970C, 0x25FF3B48, 0x41FF4859,
+0x59086475, 0x0090F400, 0x39B14B0C, 0x1AFF626F, 0x31FF4552, 0x91205B6A, 0x6B794680, 0x5A6334FF,
+0x000C08FF, 0x16711048, 0x50FF3435, 0x58A86F73, 0x5A653B50, 0x0C2C3CFF, 0x57681BF1, 0x596A3EFF,
+0x4A592EFF, 0x505C36FF, 0x676E4DFF, 0x31371BFF, 0x31351CFF, 0x51553AFF, 0x5A6044FF, 0x3B4127FF,
+0x31371DFF, 0x00F17CB0, 0xFF444526, 0xFF57563A, 0xFF5F5E42, 0xCC37351C, 0x1DDC001D, 0x43412A80,
+0x27250EFF, 0x00000CFF, 0x00F1F240, 0xFF3C3A21, 0xFF28260D, 0xFF5A5A3E, 0x0C818263, 0x4AA80096,
+0x49493140, 0x31E8CCFF, 0x9C524C36, 0x13F40054, 0x381804F1, 0x3C18FF37, 0x3108FF36, 0x340CFF29,
+0x6647FF29, 0x714E105F, 0xFF484D2D, 0x9C242A06, 0x754DB165, 0x9E76FF70, 0x926AFF99, 0x000EB090,
+0xFC005EC4, 0x642C0076, 0x360D38F1, 0x552DFF2F, 0x3E1AFF4A, 0x3714FF32, 0x2708FF29, 0x2403FF18,
+0x401DFF15, 0x1B00FF32, 0x5933FF0C, 0x431DFF4D, 0x4620FF3D, 0xAD7DFF4A, 0xD695FFAE, 0x8746FFC7,
+0x3607FF77, 0x2900FF2E, 0x6835FF28, 0x4911FF6A, 0xB108184A, 0xFF494C1D, 0xFF4D4520, 0x548D845D,
+0x9E64C061, 0xA76BFF9D, 0x4F15FFA7, 0x4024FF4E, 0x800C4C00, 0xFF514F29, 0xFFD4D2AB, 0xC80016A8,
+0x2BBC0034, 0xAF871DF0, 0x3215FFB4, 0x3E1FFF3B, 0x6137FF47, 0x7D4DFF66, 0x9366FF81, 0x491FFF9E,
+0x643BFF55, 0x6336FF6D, 0x430DFF66, 0x4F18FF3C, 0x4A74FF46, 0xBCC59040, 0xF12AECFF, 0xBFCA9214,
+0xC5CF9BFF, 0x212900FF, 0x3B3D0EFF, 0x827F52FF, 0xA9A173FF, 0x82794EFF, 0x3D360CFF, 0x4B481DFF,
+0xB80059C4, 0x056C004A, 0x004FA400, 0x00004AB0, 0x570CF18B, 0x00FF848B, 0x04FF2D31, 0x82FF3639,
+0x6EFFB4B4, 0x51FF9E9B, 0x29FF8281, 0x94385E63, 0x838C4B31, 0x21801284, 0x1BFF5555, 0x04FF4D4D,
+0x814A3105, 0xB18F687E, 0xFF535121, 0xFF8D8A5D, 0x80747144, 0x91654014, 0x0D30FF92, 0x00439C00,
+0x268025BC, 0x26FF5F63, 0x5CFF5C5F, 0x6B333186, 0x31489866, 0xDCA4AC7D, 0x77E80002, 0x79803C71,
+0x686E2EFF, 0x45319E58, 0x4DA46C7A, 0x3E4C17B1, 0xB5C28CFF, 0x565D27FF, 0x5C317800, 0x2FBC8E91,
+0x00917800, 0x61B1AF38, 0x33FF969B, 0x5AFF6B71, 0x77F89099, 0x80313800, 0xFF6F7142, 0xFFC5CA90,
+0x2800451C, 0xA3A80021, 0x626339C0, 0xC1C298FF, 0x606731FF, 0x00804CFF, 0x040004F8, 0x7F408000,
+0x8C4FFF76, 0x4480FF82, 0x616C3431, 0x5A3104F0, 0x86408E9A, 0x7C8B4631, 0x0000498C, 0x71463162,
+0x0032A066, 0x66312250, 0x224898A2, 0x824B00F1, 0x965AFF79, 0x975AFF8C, 0x834AFF8D, 0x71A0547A,
+0xFFA9A973, 0x88AFAF79, 0x6E580044, 0x6D6D3171, 0x5B5B1FFF, 0x380078A8, 0xB7E00019, 0x5B1B00F1,
+0x7938FF4F, 0x8D4BFF69, 0x6C28FF7A, 0x71234C5B, 0xFF889550, 0x7485914F, 0x5A22712B, 0x5921FF4F,
+0xF19BB44E, 0x49511808, 0x91945DFF, 0x9E9D64FF, 0x84814AFF, 0x605C2CFF, 0x5C5A29FF, 0xE00019D8,
+0x8D547172, 0x8248FF85, 0x717C387D, 0xFF8D9252, 0x787C8045, 0x6F24F1AF, 0x37FFA39A, 0x75FF6B5F,
+0x41FFA9A0, 0x3EFF776F, 0x73FF7C70, 0x38FFB1A5, 0x65FF706A, 0x77FF9592, 0x65FFA19D, 0x5DFF8C88,
+0x44FF837D, 0x26FF6E68, 0x201C5550, 0x66643D31, 0x7171123C, 0x95FF9A98, 0x3C18BEBC, 0x987805F0,
+0x5B3AFF9E, 0x997BFF64, 0x573FFFA4, 0x2B13FF63, 0x67E8FF37, 0x654101F0, 0x7F58FF6F, 0x5429FF87,
+0x6C3AFF57, 0x0914FF68, 0x000CF400, 0x3D8099C8, 0x0AFF5B61, 0x00FF2C33, 0x1A8C0005, 0x8E8A5DC0,
+0xCCC7A1FF, 0x504D2AFF, 0x006FECFF, 0x1E90056C, 0x5FFF5050, 0x2DFF9595, 0x05F08758, 0x48FF6970,
+0x17FF7076, 0x2DFF3A3C, 0x14FF4E4F, 0x32FF3838, 0x77305050, 0x1DC0FF6F, 0x00825000, 0xC00081A4,
+0x5B94000B, 0x52592D31, 0x22B13FA0, 0x15FF423C, 0x17FF342C, 0xDC4C3430, 0x250F00F1, 0x381EFF2B,
+0x1700FF3F, 0x916CFF1D, 0x106B5495, 0x70B92C5C, 0x18FF555A, 0x90FF434B, 0xAA657110, 0x6B29FF9D,
+0x3138CC58, 0xE88E9D5A, 0x3305F0B5, 0x1FFF5B6A, 0x40FF4253, 0x32FF6576, 0x40FF5967, 0xB4FF6875,
+0x36FC0069, 0x71A2D400, 0xFF616F3A, 0xF44E5C29, 0x4A1C71A4, 0x5825FF3E, 0x00736450, 0x18F152A4,
+0xFF777F56, 0xFF7E865D, 0xFF525D33, 0xFF3A461E, 0xFF4B5A33, 0xFF404F28, 0xFF22310A, 0xFF46522E,
+0xFF444D2E, 0x14353E21, 0x4930311E, 0x00497845, 0x1E312324, 0xF1983033, 0x40280AF3, 0x2912FF40,
+0x3A20FF2B, 0x2A10FF3A, 0x2D11FF2A, 0x3519FF2D, 0x901AFF35, 0x472B3171, 0x004DB447, 0x1A714A98,
+0x1FFF3533, 0x05143836, 0x2B1404F1, 0x2F15FF2D, 0x533BFF2F, 0x3F2BFF51, 0x2D18FF40, 0xF181D82E,
+0x33321400, 0x212105FF, 0x292A0BFF, 0x4C4E29FF, 0x48717CC4, 0x41FF6265, 0x14885A5F, 0x444A2440,
+0x310B3CFF, 0x682E330A, 0x532CB196, 0x653DFF51, 0x8559FF63, 0xF070407F, 0x353C125D, 0x1F2A02FF,
+0x2D3915FF, 0x283615FF, 0x455234FF, 0x313E22FF, 0x142103FF, 0x142201FF, 0x2C3814FF, 0x8F9B73FF,
+0x252C03FF, 0x393711FF, 0x9B9A6EFF, 0xADB87EFF, 0x37450AFF, 0x272901FF, 0x423E19FF, 0x726A39FF,
+0x9A955EFF, 0x747845FF, 0x606233FF, 0x473D19FF, 0x8E805BFF, 0x888051FF, 0x6D6A33FF, 0x6B6C32FF,
+0x696C35FF, 0x003BD8FF, 0x4C0091F4, 0x6A04F1F9, 0x29FF8F8A, 0x1CFF5051, 0x5FFF4748, 0x35FF8F8C,
+0xF41C625D, 0x6C664660, 0x205B30FF, 0x6602F1C2, 0x7D7245FF, 0x493D13FF, 0x736B44FF, 0x777447FF,
+0x16312128, 0x8AFC464F, 0xA77200F1, 0x6129FF9E, 0x4E19FF56, 0x3E0AFF44, 0x00050034, 0x00F1007C,
+0xFF787447, 0xFF978B61, 0xFF76693F, 0x0C544B22, 0x16AC0071, 0x0039C800, 0xA4001E90, 0x02C00039,
+0x7E855140, 0x716148FF, 0xFFB4B981, 0x04494C17, 0x125C0063, 0x97966631, 0x9C0049AC, 0x2A04F17B,
+0x57FF5E66, 0x6EFF8C91, 0x3FFF9F9E, 0x4DFF716F, 0x58788181, 0x7F7D4DB1, 0x9B976AFF, 0x605C2FFF,
+0x7B310598, 0x2B74AAAC, 0x9CA06D31, 0x44207780, 0x51BC9484, 0x612BFF84, 0x313FC861, 0x18636631,
+0x76B40035, 0x868E5B40, 0x7170B8FF, 0xFF6A7334, 0x04454D11, 0x4E04F171, 0x5FFF7381, 0x31FF8492,
+0x7CFF5968, 0x16FFA7B4, 0x7AB84951, 0x71A04C00, 0xFFA5AD7A, 0x8C8D9967, 0xB1784011, 0x8010FFA8,
+0x884601F0, 0x9D60FF7C, 0x6431FF93, 0x602FFF60, 0x7804FF5E, 0x3E470871, 0x8A9256FF, 0x00F1172C,
+0xFF6B6E41, 0xFF636637, 0xFF778246, 0x6C829150, 0x2C00008C, 0x616D2FB1, 0x677537FF, 0x475216FF,
+0x3B71B814, 0x4EFF6D79, 0xA864808F, 0xC3D29140, 0x3119CCFF, 0xEC495525, 0x2E00317D, 0x007E4422,
+0x08F1A3B8, 0xFF58632B, 0xFF8A945F, 0xFF9BA66E, 0xFF384309, 0xFF6A7539, 0xECC5CD92, 0xB9807186,
+0x864DFFB8, 0xF19A1483, 0x86834E00, 0x64632DFF, 0x41460CFF, 0x394307FF, 0x3E712CB8, 0x04FF727E,
+0x27F83545, 0x4F5E1B71, 0x5C6826FF, 0x3240B3A4, 0x48FF6A73, 0x531A7255, 0x8952FF4B, 0x212BC880,
+0xBCEC6770, 0x67682F31, 0x5340C27C, 0x28FF8783, 0x99657137, 0x450DFF99, 0x003FCC40, 0x3B31B2BC,
+0x28407379, 0xABAD7B80, 0x59562BFF, 0x00A7FCFF, 0x14F1EF04, 0xFF807350, 0xFF655931, 0xFF998B5E,
+0xFF6A5C2D, 0xFF857D4F, 0xFF4F4A20, 0xFF5E5A34, 0xFF4E4826, 0x2482795A, 0x6C44715F, 0x4D24FF71,
+0xB1A7B050, 0xFF484620, 0xFFA09E77, 0xF893916A, 0x21100029, 0x4D2E18F1, 0x9276FF56, 0x5944FF9D,
+0x5F4AFF68, 0x452EFF6E, 0x6043FF54, 0x3818FF6E, 0x5430FF45, 0x6E45FF5E, 0x8359FF70, 0x50ADE082,
+0xFF5D5D3B, 0xF105104B, 0xFF5E6303, 0xFF484D17, 0xFFA6A670, 0xFF575024, 0xC8CBC6A0, 0x552DB115,
+0x7D4CFF53, 0x743DFF7B, 0x00062871, 0x204077E0, 0x50FF4C55, 0x2830001E, 0x40857C00, 0xFF44461E,
+0x3C004178, 0x5E00F184, 0x28FF828E, 0x1BFF4E5A, 0x49FF434D, 0x7EE87177, 0x001A2000, 0x00F15984,
+0xFF393416, 0xFF4A4327, 0xFF141300, 0x38474628, 0x1F05B1F2, 0x8C69FF25, 0x7E58FF90, 0xF173BC82,
+0x5E60380C, 0x595B33FF, 0x474A1BFF, 0x777D3FFF, 0x7F8A46FF, 0x627535FF, 0x637738FF, 0xA400BBA0,
+0xB61C00BF, 0x511A00F1, 0x5821FF3E, 0x5821FF47, 0x6836FF49, 0x0067185C, 0x2D222CF0, 0xF119105A,
+0x56633504, 0x4C592EFF, 0x3F4A1FFF, 0x535C2DFF, 0x565E2BFF, 0x2800871C, 0x683E7114, 0x4018FF5D,
+0xF1638C35, 0x56623E10, 0x2B3614FF, 0x32401FFF, 0x5E694BFF, 0x2F3A1CFF, 0x444F2FFF, 0x384124FF,
+0x2D321CFF, 0x0E711DC8, 0x19FF1F20, 0x00042A2B, 0x2D2F1A71, 0x3B3A25FF, 0x1831497C, 0x3BE03235,
+0xF19A6800, 0x696D4A00, 0x626643FF, 0x232706FF, 0x343718FF, 0x0EB1A06C, 0x27FF2626, 0x27FF3C3B,
+0xD8783B38, 0xECA80F10, 0x34252C21, 0x3B21501E, 0x8C26FF35, 0x9AA00090, 0xFF2E2AA1, 0xFF413C1F,
+0xC47A7452, 0x1E10F106, 0x50FF3D39, 0x90FF6E6F, 0x46FFB1B5, 0x1BFF6C72, 0x1DFF454B, 0x18FF474A,
+0x22FF3F40, 0x1E004646, 0x0027EC00, 0x10F10CE8, 0xFF3D491B, 0xFF3B4721, 0xFF394726, 0xFF4C593D,
+0xFF58654B, 0xFF283519, 0xFF131D02, 0xD03F4A2C, 0x7F54909A, 0x3106FF72, 0x7033FF28, 0x6663A1A0,
+0x474C24FF, 0x495027FF, 0x3AB18C3C, 0x2EFF5F5A, 0x1AFF6054, 0x18C44C40, 0x51241E10, 0x5B4E07F1,
+0x887A55FF, 0x777046FF, 0x312E03FF, 0x9A996DFF, 0x94956BFF, 0x2C31645C, 0x5B385050, 0x706C49B1,
+0x494925FF, 0x31310BFF, 0x84004D8C, 0xAAF80061, 0x4D482231, 0xFC001E00, 0x1D04F12E, 0x23FF5148,
+0x43FF534A, 0x52FF706B, 0x25FF7F7E, 0x57105456, 0x007EC800, 0x83712590, 0x87FFA9B5, 0x42C0ABB7,
+0xF19BF800, 0x52502704, 0xA7A076FF, 0x94865FFF, 0xAC9D76FF, 0x685C34FF, 0x6C31C004, 0x6344949A,
+0x00050000, 0x68000F00, 0xB38C008D, 0x0094E000, 0x04F1C074, 0xFF70703C, 0xFF72703F, 0xFF2D2B00,
+0xFF9B9A6A, 0x78808251, 0xC058006B, 0xC007B000, 0xFF575427, 0xFFB4B184, 0xFF5D602B, 0x9C003908,
+0x5A00F117, 0x37FF8984, 0x94FF6562, 0x89FFC3C5, 0xA930B9C2, 0x400203F0, 0x7A3AFF32, 0x904DFF6E,
+0x8D4DFF87, 0x511CFF87, 0x38006654, 0xCC6E1168, 0x26040011, 0x8C946140, 0x00094CFF, 0x05F02B64,
+0xFF424D15, 0xFF43501A, 0xFF6E7A4A, 0xFF546030, 0xFF445119, 0x3C005328, 0x4910314A, 0x717B7040,
+0xFF97A075, 0xD4788456, 0x10700011, 0x8F9E63C0, 0x7E8F4BFF, 0x83924FFF, 0x008ED0FF, 0x30007AE0,
+0x9E4C00C1, 0x00A90C00, 0x2400217C, 0x93DC0076, 0x40BE9000, 0xFF677A38, 0x591034E8, 0x8361B2E8,
+0x490BFF74, 0x00AD8439, 0x9400B254, 0x8F4E31BC, 0xF030047F, 0x86965805, 0x34430CFF, 0x94A271FF,
+0x738054FF, 0x5B6938FF, 0x005A04FF, 0x1C314AF8, 0x3A104754, 0x45511F71, 0x4C5924FF, 0x6F71A594,
+0x58FFA4AE, 0x8BD89394, 0x955B0CF1, 0x6D37FF94, 0x9062FF6D, 0x6E41FF97, 0x501DFF72, 0x9F68FF4C,
+0x8E55FF96, 0xB1A0F885, 0xFF60742F, 0xFF667A35, 0x44596827, 0xA572310A, 0x719AA8A1, 0xFF3E410A,
+0x30DADFA7, 0x08B00038, 0x6F783F90, 0x525A1FFF, 0xBDE057FF, 0x426C8B10, 0x48FF79D1, 0x3FFF827F,
+0x11FF7472, 0x1EAC4346, 0x00A64000, 0x22A08108, 0x0FFF5155, 0x49FF3537, 0x11FFB868, 0xF1F3BC4C,
+0x6A5B3E14, 0xA29471FF, 0x85734DFF, 0x6A5B34FF, 0x8A815AFF, 0x565129FF, 0x646138FF, 0x4E4923FF,
+0x615734FF, 0x2B71FB90, 0x3FFF534A, 0x5504645F, 0xF1A39C00, 0xB5B38D0C, 0x5F5D37FF, 0x54502DFF,
+0x756F4DFF, 0x483F1EFF, 0x74694BFF, 0x45371DFF, 0x2800ECF0, 0xEA5000EA, 0x664D08F1, 0x3B1DFF7A,
+0x573AFF4C, 0x5F42FF60, 0x371BFF64, 0x5235FF3E, 0xF1A31C57, 0x3F411904, 0x585C1FFF, 0xBCBE7FFF,
+0x3A3609FF, 0xB6B28DFF, 0x36316A8C, 0x8BD45F67, 0x68713031, 0x4F3183A0, 0x8C387C83, 0x31728800,
+0x344F5620, 0x4614005F, 0x7C5D2E22, 0x76A0002B, 0x29360831, 0x9C005F3C, 0x18D40061, 0xF086B400,
+0x6C744301, 0x424019FF, 0x64603BFF, 0x363810FF, 0xF16B98FF, 0x47482800, 0x585738FF, 0x848158FF,
+0x605D32FF, 0x2A316798, 0x19AC5354, 0x3F4112B1, 0x83874AFF, 0x626B28FF, 0x283147D0, 0x940C4F63,
+0xF136DC00, 0x84975F08, 0x566B32FF, 0x4E6225FF, 0x516329FF, 0x3B4717FF, 0x3F471EFF, 0xA4009A48,
+0x370F7240, 0x6B40FF2C, 0x702CC45E, 0x26FF4651, 0x98FF4851, 0x193CF11E, 0x17FF404E, 0x2DFF3A48,
+0x36FF4C57, 0x2BFF515B, 0x2EFF4650, 0x1BFF4751, 0x2EFF2E39, 0x28FF3F49, 0x32FF3744, 0x32FF4350,
+0x27FF4752, 0x1EFF3B44, 0x15FF2F34, 0x17FF2326, 0x26FF2826, 0x15FF3735, 0x21FF2425, 0x35FF3233,
+0x09C8484A, 0x0086E400, 0x37408718, 0xA8FF555B, 0x8A2C0009, 0x005CE000, 0x68005998, 0x2B163128,
+0xF1E7202C, 0x2C291A0C, 0x383725FF, 0x575C3EFF, 0x313B19FF, 0x5A6449FF, 0x4F593EFF, 0x636C4DFF,
+0x2A31319C, 0xEDB84743, 0xF165D400, 0x3B321104, 0x373117FF, 0x3C3B1DFF, 0xADAF88FF, 0xC2C89AFF,
+0xC40087FC, 0x09700067, 0x28280431, 0xF800370C, 0x9FB8007D, 0x616E4031, 0xFC004B88, 0x2100F109,
+0x1EFF2D39, 0x0FFF2A36, 0x18FF1E28, 0x05CC2933, 0x242F0D71, 0x3F4C20FF, 0x1480774C, 0x3FFF3636,
+0xD4FF605C, 0x6EC80055, 0x71553400, 0xFF7D785A, 0x9C7A6B4C, 0x735B40D8, 0xF9E8FF7F, 0xF1F8F400,
+0x67593208, 0x726A45FF, 0x918D68FF, 0x55522FFF, 0xA8A884FF, 0x757752FF, 0x7C005050, 0x603C40EE,
+0x36B4FF66, 0x636341B1, 0x595434FF, 0x655F3FFF, 0x11F04D58, 0xFF555028, 0xFF83814E, 0xFF6A6933,
+0xFF5D542B, 0xFF665C38, 0xFF5E5931, 0xFFA3A276, 0xFF6B6D3E, 0x7A311CF8, 0x37A4A2A8, 0xAAB68881,
+0x5E6B3DFF, 0xF10DB0FF, 0xFF363D0B, 0xFF4C4A21, 0xFF9E966F, 0xFF80714A, 0xFFBDAE87, 0xFF796D45,
+0x30969167, 0x3C0D3177, 0x31222C34, 0xC0555726, 0x2250001C, 0x743704F1, 0xA162FF6A, 0x6D39FF98,
+0x4110FF6D, 0x2900FF43, 0x00B2A82B, 0x21400EC8, 0x34FF4F53, 0x5128F122, 0x00FF8386, 0x33FF302D,
+0x01FF6360, 0x46FF3133, 0x4DFF787B, 0x34FF7D7A, 0x23FF625F, 0x8FFF514E, 0x86FFBDC1, 0x12FFB8C4,
+0x36FF4556, 0x76FF6578, 0x84FFA9BA, 0x98D4BEC9, 0xA1A371D0, 0x6D6F40FF, 0x808250FF, 0x94CC6BFF,
+0xFF777E61, 0x34575F2C, 0x9762408F, 0x3000FF8D, 0x71667400, 0xFF7D895B, 0x70849060, 0xA4E40027,
+0x31402400, 0x60414A11, 0xA9807178, 0x683DFFA1, 0x008C8C5D, 0x7D808790, 0x72FFA5B7, 0xC4FFA2B7,
+0x5404F1B8, 0x14FF8690, 0x0EFF474F, 0x57FF4550, 0x54FF919C, 0xB7A48B96, 0x009B5400, 0x3E712D9C,
+0x33FF6D80, 0xB9386077, 0x4B1300F1, 0x632AFF38, 0x8648FF54, 0x924EFF76, 0x003BEC81, 0x5C00C23C,
+0x2608F1BC, 0x1BFF5565, 0x4EFF4959, 0x98FF7583, 0x62FFBBC9, 0x3AFF8390, 0xB7685D6B, 0x4B5A1F71,
+0x4D5C23FF, 0x2C00AAC4, 0x5623B102, 0x8B4EFF48, 0xA361FF7D, 0xF02E2098, 0x9D9D5F03, 0x818246FF,
+0x9C9C66FF, 0x989167FF, 0xA84C24FF, 0xFF7B911A, 0xFFA8B17A, 0x74909962, 0x4F00F199, 0x28FF8094,
+0x36FF596D, 0x0FFF6674, 0x1D683D46, 0xA09F7331, 0xB0002468, 0xA477B181, 0x9969FFA1, 0x9B62FF93,
+0xF10FD892, 0x767A4804, 0x646432FF, 0xAEAD74FF, 0x8A884DFF, 0x706E3BFF, 0x500049D0, 0x55183119,
+0x0095D047, 0x54003B48, 0x4706F0AD, 0x59FF6460, 0x2FFF7969, 0x13FF5340, 0x28FF3D2D, 0x2FFF5949,
+0x54E1EEF4, 0x6E4CFF64, 0x7F59FF7B, 0x572FFF84, 0xC00C605C, 0xFF746A46, 0xFF635838, 0xFF8D8368,
+0x5671500C, 0x7DFF7974, 0x2A20A3A0, 0x95936D31, 0x0CF12F48, 0xFFA59F7B, 0xFF312807, 0xFFA79C7C,
+0xFF6D5D43, 0xFF4C3C25, 0xFF5A483A, 0x083E2B1C, 0x472C31F5, 0xA044785B, 0xFF5D553E, 0xFF564B35,
+0xB724553B, 0x20FF59D1, 0x53FF484B, 0x48FF9095, 0x142C888A, 0x31AD8800, 0x58676C44, 0x5C1A3163,
+0x00AEE451, 0x30006A14, 0x78D80061, 0x71A47400, 0xFF505A1E, 0xD44D5519, 0x1C04F17E, 0x38FF454D,
+0x13FF5764, 0x0EFF3040, 0x3AFF2D3A, 0x71F45C68, 0x48512431, 0xC4005220, 0x2A9C0051, 0x00213800,
+0x1931915C, 0x81103E45, 0x46462431, 0xD8007DF4, 0x40142019, 0x76111E14, 0x18F17DCC, 0xFF79784A,
+0xFF909155, 0xFF787F3C, 0xFF5C6B30, 0xFF44571F, 0xFF707E49, 0xFF5C6D37, 0xFF4D6028, 0xFF63783D,
+0x244A5E21, 0x34067128, 0x6942FF28, 0xF09AA461, 0x3239180D, 0x39431EFF, 0x455129FF, 0x495531FF,
+0x36421CFF, 0x3A421BFF, 0x4F572EFF, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x0001FF1F, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFE4F92, 0x0004FFFF, 0x4C710F01, 0x00540C2D,
+0x2D00500F, 0xFF00400F, 0xD70476FF, 0x028F0F02, 0x001D0402, 0x0F000800, 0x0F020021, 0x67FF0015,
+0xFFFFFD4A, 0x400004FF, 0xFFFDFFFE, 0xFC400004, 0x04FFFDFF, 0xFFFB9300, 0xFFFBFFFD, 0x04FCFFFF,
+0x17FE1A00, 0x01BA0105, 0x0201D800, 0x4C0A0004, 0x005C0000, 0x02004C00, 0x3902001C, 0x00480400,
+0x08000804, 0x0C0F001C, 0xC1016100, 0x00050F00, 0xE4FE1027, 0x00040F00, 0x06630F27, 0x01070F02,
+0x00740F61, 0x017A0F65, 0x003A0327, 0x2D00B90F, 0x0F004703, 0x00290007, 0xF9040083, 0x000C0002,
+0x0003540D, 0xF9310348, 0x0348FFFF, 0x0103400F, 0x29007D0F, 0xFF003C0F, 0x01CB0240, 0x0004B800,
+0x040001B8, 0x05000B00, 0x00017300, 0x040001E8, 0x000C0000, 0x0200040B, 0x140A0040, 0x00230204,
+0x00003100, 0xFC040004, 0x00080004, 0x02001000, 0x060F001E, 0xF00FA500, 0x140F0100, 0xF4051500,
+0x01070400, 0x1D00080F, 0x0F004105, 0x66FF0009, 0x0001B103, 0x04000007, 0x01870400, 0x11071807,
+0x130850FB, 0x0B0848F9, 0x30040D57, 0x00080F00, 0xB40066FF, 0x00040401, 0x0403B504, 0x94070010,
+0x0A140201, 0x07001900, 0x0B040015, 0x00170000, 0x1D00040F, 0x04003C03, 0x080F0073, 0xEC006B00,
+0x00040F05, 0x0AD40223, 0x1D00FD0F, 0x04003006, 0x00020158, 0x00840001, 0x0F063800, 0x0F170008,
+0x0F2D0080, 0x062D0040, 0xB40000C0, 0x00040F00, 0x00F00021, 0xA500040F, 0x0001C800, 0x0400081C,
+0x000C0000, 0x0602D500, 0xD40207D4, 0x00DC0401, 0x01011C02, 0x19000BF0, 0x002F0000, 0x00000400,
+0x040F0033, 0x006EFF00, 0x04000188, 0x01980000, 0x00000404, 0x040B0010, 0x001B0400, 0x0D000800,
+0x2C0B01B3, 0x01E80100, 0x0100140F, 0x00003D00, 0x1C030004, 0x000B0000, 0x22023E00, 0x0C1EFEFD,
+0x5E00080F, 0x000C9601, 0x8000029C, 0x00080F00, 0x03FC001B, 0x2D04400F, 0x02004000, 0x28000048,
+0x01150003, 0x1700080F, 0x0F003C00, 0x006D0004, 0xFB1100BC, 0xFE2F1128, 0x1F0008FF, 0x00017004,
+0x800000F4, 0x00080F01, 0x02400F28, 0x02000125, 0x2300780F, 0x0200FC00, 0xC200121C, 0x01BC0002,
+0x00000400, 0x04000500, 0x09E80600, 0x0402E400, 0x18050004, 0x03410103, 0x01003000, 0x050F0009,
+0x0065FF00, 0x04000180, 0x01B00000, 0x03000800, 0xAD0401B4, 0x00080401, 0x0B001B00, 0x1B000004,
+0x01B50200, 0x04001900, 0x0C000040, 0x00160200, 0x00000601, 0x040F000F, 0x4C011000, 0x0C300300,
+0x0F022000, 0x01950010, 0x050400E4, 0x00E80000, 0x0F000C00, 0x001D0008, 0x04000034, 0x00380F00,
+0x0030041D, 0x0F003C00, 0x006C0004, 0x83000408, 0x00080F00, 0x0270021F, 0x9501F00F, 0x0100A80F,
+0x00001400, 0xB8000004, 0x00040102, 0x03000501, 0x190013E4, 0x00040000, 0x0201AC05, 0x280005F0,
+0x05380A01, 0x0F013E00, 0x62FF0004, 0x00019900, 0xC00004BC, 0x00080006, 0x02001000, 0x150B0294,
+0x08670F19, 0x01B30103, 0x0C003400, 0x19010004, 0x00050600, 0x00001F0B, 0x27010213, 0x00220602,
+0x6F000A0F, 0x0000A400, 0x080F0086, 0x2C001900, 0x00040F00, 0x013400ED, 0x2900040F, 0x2D01400F,
+0x29007C0F, 0x00003C08, 0x10000088, 0x00080F00, 0x07B40319, 0x0002D000, 0xD4060CB8, 0x05000F02,
+0x0A680205, 0x00050002, 0x14001410, 0x00710419, 0x0F007D00, 0x5CFF0004, 0x35018802, 0x02FBFFFC,
+0x18EC0000, 0x00050807, 0x9F00018F, 0x00040C01, 0x04001800, 0x1C0C0004, 0x00100000, 0x05001C04,
+0xF8001B08, 0x00040406, 0x02007000, 0x60000068, 0x05590F1E, 0x00450003, 0x1500040F, 0x0F006D07,
+0x0026000B, 0x3D00006C, 0x00080F00, 0x0034001D, 0x2C00040F, 0x00034403, 0x4800033C, 0x00080F03,
+0x01A4035E, 0x0100C600, 0x100F0080, 0x34001800, 0x00040F00, 0x01F80FB3, 0x0030041D, 0x0004D002,
+0x0400083E, 0x01400000, 0x02035400, 0x480B02D4, 0x00330008, 0x0001EC03, 0x14020028, 0x036C0B19,
+0xB3014D0F, 0x9600C60F, 0x6C018804, 0xFFFEFFFA, 0x0498FFFA, 0x03019C04, 0xD60101B9, 0x000C0000,
+0x00000900, 0x04030008, 0x00070300, 0x0503B800, 0x23000004, 0x00040500, 0x06002108, 0xFC0004F8,
+0x00040004, 0x08022C02, 0x0C0F0024, 0x69051D00, 0x00090F00, 0x00700F24, 0x00300A1D, 0x0F014400,
+0x0FE50004, 0x0B240171, 0x500A0037, 0x02100F01, 0x004F0B1F, 0x1E000F0F, 0x2900800F, 0x0205000A,
+0xE80204D4, 0x00C80207, 0x0005040B, 0x04070229, 0x000F0005, 0x1E00AF0F, 0xFF00310F, 0x01800039,
+0x1638FB10, 0x05000400, 0xC0001608, 0x04A80601, 0x00051600, 0xFB3504A8, 0x2800FAFC, 0x0CFEFD24,
+0x05240000, 0x0401E403, 0xFE1F0198, 0x03090250, 0x24010025, 0x000C0200, 0xFEFEFE40, 0x020004FF,
+0x060F000E, 0x34001700, 0x00040000, 0x1700320F, 0x00002A0E, 0xEE000040, 0x00040000, 0x0F02B002,
+0x0F0900BC, 0x0003001C, 0x040F0144, 0xFC40A100, 0x04FFFEFE, 0x01160E00, 0x1C00120F, 0x0301170F,
+0x13014F0F, 0x0F006B01, 0x00290041, 0x4501003C, 0x00050F00, 0x00440028, 0x2500040F, 0xFEFFFFA0,
+0xFCFFFFFD, 0x44FFFFFE, 0x05000008, 0x00000400, 0xF8270A04, 0x000EDCFB, 0x2504005F, 0x05000F02,
+0xB00079FF, 0xFDFD8009, 0xFCFDFFFF, 0x10C0FFFF, 0x0001A302, 0x000C040E, 0x00140005, 0x2000040E,
+0x2D1CFDFA, 0x04C0FF13, 0x0A01E500, 0xFD320004, 0x0221FAFB, 0x01022500, 0xFD0B001B, 0x00140001,
+0x2802BA0F, 0x71003B0F, 0x04044400, 0x40020004, 0x08140201, 0x1D000C0F, 0x0000CC00, 0x08080034,
+0x00580000, 0x0C001008, 0x100F0020, 0x5C002D00, 0x00040F00, 0x01C4002E, 0x2500040F, 0x00007D05,
+0x0D000041, 0x00080E00, 0x0006A404, 0x5502001E, 0x000A0005, 0x00002804, 0x040A000C, 0x00300100,
+0x08075403, 0x260A000C, 0x000E0600, 0x00002401, 0x94012FF2, 0x00580407, 0x08000806, 0x02010020,
+0x005C0003, 0x03171D01, 0x38010044, 0x03400000, 0x00033402, 0xF8110314, 0x2E010318, 0x081D0600,
+0x00005300, 0x37030004, 0x037C0100, 0x0F000C04, 0x66FF0008, 0x00019000, 0xC7000345, 0x000C0009,
+0x00018801, 0xCC020009, 0x09F80101, 0xFFFFFFB0, 0xFFFEFDF9, 0xFFFFFDFA, 0x08000A2C, 0xFCFA3100,
+0x0006F4FD, 0x0A0010F4, 0x40F9110A, 0x2100000F, 0x210AFE11, 0x09070000, 0xED003230, 0x005C0101,
+0x00020F03, 0x0B030063, 0x03E40005, 0x00006E00, 0x04040034, 0x00100000, 0x0500040F, 0x0200240C,
+0x51030314, 0x00680100, 0x02000C0A, 0x36020286, 0x002C0E00, 0x2304AC0F, 0x04013300, 0xD7020004,
+0x00740A00, 0x0F00680E, 0x02090020, 0x060F0042, 0x9C016600, 0x00CE0006, 0x0900A40F, 0x09001C0F,
+0x00014402, 0x460000C0, 0x00080F00, 0x002C0019, 0x00000405, 0x0D000063, 0x00080F00, 0x0034001D,
+0x0001F80F, 0x1301840F, 0x0000BC02, 0x040F00B8, 0x7B012100, 0x35180100, 0x12030A03, 0x0009F4FE,
+0x040E026E, 0x00D90005, 0x09000400, 0x4302036D, 0x00060F00, 0x93006AFF, 0x01FD0001, 0x01000800,
+0xA0000248, 0x047E0401, 0x000D2400, 0xFF2006DC, 0x100A28FF, 0x0001E7FB, 0x04000028, 0x01B40100,
+0x00045E00, 0xF7101AC8, 0xFF700526, 0xFFF8FFFF, 0x000CFFFF, 0xFFFFF593, 0xFFFFF4FF, 0x0008F2FF,
+0x17000C00, 0x00000CF3, 0x04000020, 0x00180000, 0x00000804, 0x040F000C, 0x7C005D00, 0x00B00000,
+0x0900040F, 0xFFFFF64F, 0x090004FF, 0x0000B404, 0x040F00E0, 0x20040100, 0x00080000, 0x0900200F,
+0x00008C00, 0x080F0024, 0x74005D00, 0x00040F00, 0x00F00069, 0x0900040F, 0x09009C0F, 0x0F003804,
+0x0F090024, 0x0801001C, 0x44040188, 0x00080000, 0x01002C0F, 0x08001800, 0x24080004, 0x00480000,
+0xFFFFF153, 0x02ECEDFF, 0xFFFFF740, 0x000304FD, 0xFE500318, 0xFAFCF7FF, 0x04010A5A, 0x032F0100,
+0x01036007, 0x48050010, 0x000E0103, 0xFF00050F, 0x01850065, 0x02000400, 0x860204F8, 0x0500002A,
+0x3001C400, 0xF4FAFFFF, 0x05200004, 0x00000404, 0xFA10002B, 0x19000430, 0x04180000, 0x11020000,
+0xF10204F0, 0xD6EDFB10, 0xBAD4E3FF, 0xA5C2D2FF, 0x92B3C4FF, 0x7FA4B6FF, 0x769CAFFF, 0x739CAEFF,
+0x709BACFF, 0xAD930004, 0xACFF719C, 0xADFF6F9D, 0xAE7F0004, 0xB0FF719A, 0x00047399, 0x9AB17912,
+0x9BB2FF74, 0x00000475, 0x04080014, 0x00200C00, 0x769CB34F, 0x090004FF, 0x769CB14F, 0x090004FF,
+0x799FB44F, 0x050004FF, 0x769FB3A2, 0x769FB5FF, 0x04A0B6FF, 0xA1B74000, 0x0004FF77, 0x78A2B84F,
+0x1D0004FF, 0x7AA3B984, 0x79A3B9FF, 0x600008FF, 0xFF7BA4BA, 0x0014A4BA, 0x06000400, 0x20000018,
+0x00180000, 0x00002004, 0xB84F0008, 0x08FF7AA5, 0xBB8F0500, 0xB9FF7CA5, 0x08FF7BA6, 0xBB7F0100,
+0xBCFF7BA5, 0x00047CA6, 0xA7BD4F0A, 0x0004FF7D, 0xA9BC4F09, 0x0004FF7E, 0xA8BB3D05, 0x44001C7D,
+0xFF7FAABD, 0xBE6E0004, 0xBFFF80AB, 0x440004A9, 0xFF81AAC0, 0xC24F0004, 0x04FF83AC, 0xAB430A00,
+0x04C2FF85, 0xACC34F00, 0x0004FF86, 0xADC44111, 0x0004FF87, 0xFF85AE6F, 0x0484ADC1, 0xC24F0A00,
+0x04FF85AE, 0x3C000500, 0x44C41000, 0x88AED000, 0x88A9B8FF, 0xBFD7E1FF, 0x14FEFFFF, 0xFFFB6005,
+0xFFFAFCF9, 0x0400140C, 0x033B0000, 0x0004FB01, 0x0901033C, 0x0D080300, 0x01001900, 0xFB0F0014,
+0x0165FF04, 0x81000177, 0x04FC0401, 0x00000802, 0x9B000EF8, 0x00040001, 0x3201AF00, 0xCFFCF7FB,
+0x10EC010E, 0x0004FC00, 0x2DF004F4, 0xEFFDFFF1, 0xBFD4FFD8, 0x99B0FFA3, 0x7E94FF79, 0x8198FF5B,
+0x859FFF5B, 0x829DFF5D, 0x85A1FF56, 0x8EABFF56, 0x8EAAFF5B, 0x8EABFF58, 0x8EACFF55, 0x8EAAFF55,
+0x8FABFF52, 0x8FABFF53, 0x04020008, 0x90AEB900, 0x8FB0FF57, 0x8EB0FF57, 0x79000858, 0xFF578DAF,
+0x18568EAF, 0x90B1B600, 0x90B2FF58, 0x91B2FF5A, 0x00000859, 0x0407000C, 0x92B34F00, 0x0004FF5A,
+0x93B44809, 0x0004FF5B, 0x5B94B24F, 0x050004FF, 0x5C95B33F, 0x0F06001C, 0x00010034, 0x040F0030,
+0xB44F0D00, 0x04FF5D96, 0xB54F0900, 0x04FF5E97, 0xB65F1100, 0xB5FF5F98, 0x48100004, 0xFF6099B6,
+0xB7480004, 0x04FF619A, 0x9BB94C00, 0x0004FF62, 0x639CBA4F, 0x010004FF, 0x649DBB44, 0x420004FF,
+0xFF659EBC, 0x634A0004, 0x049EBCFF, 0x9FBD4400, 0x0004FF64, 0x65A0BE4F, 0x010004FF, 0x66A1BF40,
+0x4F0004FF, 0xFF66A1C1, 0x44090004, 0xFF65A0C0, 0x280C0004, 0xA2C27D00, 0xA1C2FF67, 0x4F000469,
+0xFF6AA2C3, 0x40050004, 0xFF6BA3C4, 0xC5400004, 0x04FF6CA4, 0xA4C27100, 0xA4C2FF6B, 0x48000469,
+0xFF6AA5C3, 0xC4350004, 0x00106BA6, 0x08000C00, 0xC5410004, 0x04FF6CA7, 0xA803F100, 0xA1B9FF6F,
+0xA2B4FF6B, 0x8F9BFF73, 0xF3FDFF6D, 0x001C4AE2, 0x1402083E, 0x08520219, 0x00176000, 0x9805034C,
+0x0377000F, 0x00036100, 0x88010008, 0x00050F03, 0x8B006CFF, 0x10B80001, 0x02000402, 0xB0021118,
+0x06AC0001, 0x00001E00, 0xDC0010DC, 0xEA21F206, 0xA3C3D2FF, 0x5F8695FF, 0x507B8EFF, 0x55839AFF,
+0x56859FFF, 0x5688A3FF, 0x5689A6FF, 0x558AA9FF, 0x578EADFF, 0x528DAFFF, 0x4B87ABFF, 0x0489AEFF,
+0x89B07100, 0x8AB1FF4B, 0x4400044C, 0xFF4C8AAF, 0xB18F0004, 0xB1FF4B8B, 0x08FF4A8B, 0xB38F0500,
+0xB3FF4D8D, 0x08FF4C8D, 0xB27D0100, 0xB5FF4B8C, 0x00044C8D, 0x4D8EB644, 0x040004FF, 0x10040020,
+0x8FB74000, 0x0004FF4E, 0x4F90B8B5, 0x4F90B6FF, 0x5191B5FF, 0xB6440004, 0x04FF5292, 0x93B74800,
+0x0004FF53, 0x5494B844, 0x410004FF, 0xFF5595B9, 0x94AF0004, 0x95B9FF56, 0x94B9FF59, 0x0A00045A,
+0x5B95BA44, 0x400004FF, 0xFF5C96BB, 0xBC620004, 0xBAFF5D97, 0x40000498, 0xFF5D98B8, 0xB9440004,
+0x04FF5E99, 0x9ABA4000, 0x0004FF5F, 0x4000100C, 0xFF609BBB, 0xBC440004, 0x04FF619C, 0x9CBA4F00,
+0x0004FF61, 0x004C0025, 0x2500040F, 0x5F9BBDBF, 0x5D9CBFFF, 0x5C9ABFFF, 0xA9230004, 0xC0FF5B9B,
+0xC0FF5A9A, 0x0004599A, 0x5899BF44, 0x7D0004FF, 0xFF5B9CC2, 0x045A9BC1, 0x00340400, 0x5A9BC34C,
+0x4F0004FF, 0xFF599AC2, 0x00110004, 0xBE4F0044, 0x04FF5A9A, 0xBD4D1100, 0x04FF5999, 0x9A07F200,
+0x9BBEFF58, 0xA0BFFF59, 0xA7BFFF61, 0x97AAFF71, 0xE2F0FF71, 0x100500D0, 0x020D44FC, 0x2A0004FC,
+0x0500000D, 0x06034600, 0x58000012, 0x04F40F03, 0x7E046CFF, 0x01980001, 0x0801A400, 0xA8020004,
+0x0A100006, 0xF10EE400, 0xFFFFF23E, 0xB8FFE2F8, 0x87FF89A6, 0x8FFF4E74, 0x9DFF4C7B, 0xA0FF5387,
+0xA7FF4F87, 0xA5FF518A, 0xA2FF4C84, 0xA0FF4782, 0x9DFF427E, 0x9CFF3D79, 0x9FFF3977, 0xA0FF3979,
+0xA0FF3877, 0xA3FF3778, 0xA5FF3879, 0xA6FF3A79, 0xA4FF3B7A, 0x00043A79, 0x3B7AA560, 0x047CA6FF,
+0xFF394200, 0x00047EA7, 0x7FA804F3, 0x80A9FF3A, 0x81AAFF3B, 0x81ABFF3C, 0x82ACFF3C, 0xF500043D,
+0xACFF3B02, 0xADFF3B82, 0xAEFF3C83, 0xAFFF3D84, 0x00043E85, 0x3F88B34C, 0x440004FF, 0xFF4089B4,
+0xB5710004, 0xB6FF418A, 0x0004428B, 0x8CB700F1, 0x8DB8FF43, 0x8DB7FF44, 0x8EB8FF46, 0x40000447,
+0xFF4B90B9, 0x08F50004, 0xFF4D90BA, 0xFF4C91BA, 0xFF4E91BB, 0xFF4D92B9, 0xFF4F92BC, 0x084F93BA,
+0x94BB7100, 0x95BCFF50, 0xF1000451, 0x5296BD20, 0x5397BEFF, 0x5596BEFF, 0x5696BCFF, 0x5795BCFF,
+0x5896BDFF, 0x5997BEFF, 0x5A98BFFF, 0x5B99C0FF, 0x5C9AC1FF, 0x5D9BC0FF, 0x5D9BC2FF, 0x0C000008,
+0x9CC17100, 0x9DC2FF5E, 0x4100045F, 0xFF609EC3, 0xA0400004, 0x04C3FF61, 0x639FE100, 0x62A1C4FF,
+0x64A0C4FF, 0x65A1C5FF, 0xC3100004, 0xA3430008, 0x04C5FF67, 0xA4C67100, 0xA5C7FF68, 0x40000469,
+0xFF6AA6C8, 0xC64F0004, 0x04FF6AA7, 0x24000900, 0xA6C52200, 0xC4310034, 0x004C68A5, 0x67A4C375,
+0x66A2C4FF, 0xC3400004, 0x6CFF63A2, 0xA1C23100, 0x7D008C62, 0xFF61A0C1, 0x04609FC2, 0x9EC17100,
+0x9DC0FF5F, 0x0000045E, 0xD40104F8, 0x5B9BA100, 0x5A99C2FF, 0x5998C1FF, 0xC0B10004, 0xBFFF5897,
+0xBEFF5796, 0x01205695, 0x94BF00F9, 0x94BEFF55, 0x93BEFF53, 0x93BDFF54, 0xB1000452, 0xFF5192BC,
+0xFF4D92BB, 0x7C4A92BA, 0x91B93101, 0xF1018C49, 0x4890B800, 0x4A8FB9FF, 0x488FB9FF, 0x458CB6FF,
+0x0CF50004, 0xFF448BB5, 0xFF438AB4, 0xFF4289B3, 0xFF4188B2, 0xFF4087B1, 0xFF3F88B1, 0x043E87B2,
+0x86B14000, 0x0004FF3D, 0x3C85B048, 0x400004FF, 0xFF3B84AF, 0xAE400004, 0x04FF3A83, 0x82AD4000,
+0x0004FF39, 0x3980AA80, 0x3B80AAFF, 0x000278FF, 0x88000004, 0x7CA67502, 0x7CA5FF39, 0x40000437,
+0xFF367BA4, 0xA3B10004, 0xA0FF3679, 0xA1FF3579, 0x00043477, 0x76A008F2, 0x779EFF33, 0x759CFF32,
+0xA5C5FF30, 0x99B1FF64, 0x93A6FF65, 0x2216E470, 0x033FFBFE, 0x001BE403, 0x04060360, 0x03540000,
+0x0F036A00, 0x6EFF09F9, 0x04018000, 0xFF400004, 0xEAFCFAFF, 0xFFFF4027, 0x0BBAFDF8, 0x00001800,
+0xEC0009F0, 0xEC14F015, 0x84A5B6FF, 0x467088FF, 0x487A95FF, 0x4A819FFF, 0x4883A1FF, 0x4784A3FF,
+0x3B7A9BFF, 0x38769BFF, 0x00049DFF, 0xFF3777A1, 0xFF37779D, 0xFC38789E, 0x7AA24804, 0x0004FF39,
+0x3A7BA531, 0xA74004F0, 0x04FF3B7B, 0x7DA87100, 0x7EA9FF3A, 0x3100043B, 0x883C7FAA, 0x04F40002,
+0x40000404, 0xFF3B82AE, 0xB0350004, 0x02CC3D84, 0x0502DC00, 0x88E102F0, 0x87B4FF3D, 0x8AB8FF3D,
+0x88B9FF3D, 0x6200043C, 0xFF3D89BA, 0x00048BBB, 0x3D8BB940, 0xF10004FF, 0x3F8CBA14, 0x408DBBFF,
+0x448EBBFF, 0x428CB9FF, 0x458FBCFF, 0x458EB9FF, 0x4790BBFF, 0x478EBAFF, 0x4990BAFF, 0xBB110004,
+0x02F104FC, 0x92BCFF4A, 0x93BBFF4D, 0x93BDFF4B, 0x93BCFF4E, 0xA000084E, 0xFF5095BE, 0xFF4F94BD,
+0x03C097C0, 0xFF5001F6, 0xFF5396C0, 0xFF5495BF, 0xFF5497C1, 0x000498BF, 0x5599C0B1, 0x569AC1FF,
+0x579BC2FF, 0xBC000894, 0x9BC47108, 0x9DC3FF5C, 0x2200045D, 0x000C9CC2, 0x5F9FC540, 0xF10004FF,
+0x5E9EC400, 0x5F9FC3FF, 0x60A0C4FF, 0x619FC4FF, 0xC5720008, 0xC6FF62A0, 0x000463A1, 0xFF64A362,
+0x0465A4C7, 0x67A34000, 0x0004C7FF, 0xF869A521, 0xA6C86204, 0xA4C6FF6B, 0x140004D8, 0x04E80005,
+0x00000408, 0x04000014, 0xA6C98000, 0xA6C7FF67, 0x0008FF67, 0x66A5C680, 0x66A5C8FF, 0x000008FF,
+0xC6A00058, 0xC5FF64A3, 0xC6FF63A2, 0x000004A3, 0x8000000C, 0xFF603005, 0x030090C3, 0xA0000004,
+0x00040000, 0x5E9EC240, 0x400004FF, 0xFF5C9EC1, 0xDC000004, 0x00040000, 0x9CC404F1, 0x9BC5FF5B,
+0x9AC4FF5A, 0x99C3FF59, 0x98C2FF58, 0x31000457, 0x285697C1, 0xC204F101, 0xC1FF5696, 0xC0FF5396,
+0xC0FF5494, 0xBFFF5295, 0x00045194, 0x5093C060, 0x6092BFFF, 0x4C01F001, 0x4B94BDFF, 0x4B92BCFF,
+0x4A93BCFF, 0x0C91BBFF, 0xFF48D505, 0xFF4990BC, 0xFF4891BC, 0x04468FBA, 0x01B80000, 0x438DBA31,
+0xB84001C8, 0x04FF3F8C, 0x8BB93100, 0x4001E83E, 0xFF3C8AB8, 0x00F10004, 0xFF3C89B7, 0xFF3B88B6,
+0xFF3D87B6, 0x243E88B7, 0x02280002, 0x79000400, 0xFF3C86B3, 0x043B85B2, 0x84B15000, 0x5CB0FF3B,
+0x3A816107, 0x3A81ADFF, 0x18000778, 0x80ACB105, 0x7FABFF39, 0x7DA9FF38, 0x31000836, 0x28387DA7,
+0x7BA64005, 0x0004FF38, 0x3A7FA9B1, 0x31769FFF, 0x468AAFFF, 0xA4720FC8, 0xD3FF6691, 0x1C04ACC6,
+0x00033F00, 0xFB103703, 0x660204F6, 0x000A0008, 0x0004F600, 0x12020004, 0x00250300, 0x0F000D02,
+0x65FF0006, 0x0006A100, 0xF002019A, 0x0EFC000E, 0x0013E902, 0x12F113E4, 0xCBD6FFF2, 0x7083FFB0,
+0x748BFF4D, 0x7B97FF46, 0x80A0FF45, 0x7FA2FF45, 0x799CFF40, 0x769AFF39, 0x80000436, 0xFF36779F,
+0xFF3677A1, 0xEC000008, 0x00040009, 0x3879A139, 0x080004FC, 0x05000205, 0xA7FF3942, 0x4000047C,
+0xFF397EA8, 0x04040244, 0x7FAC3100, 0x3102803B, 0x083C80AD, 0x02940000, 0x3A83B062, 0xB485B2FF,
+0x85B47102, 0x87B5FF3B, 0x0100043A, 0xE40002E0, 0x3A88A102, 0x3C8ABBFF, 0x3B89BAFF, 0xBB750004,
+0xBCFF3A8A, 0x00043B8B, 0x8CBB00F1, 0x8CBCFF3B, 0x8DBDFF3E, 0x8EBFFF3F, 0x31050842, 0x0C458FBE,
+0x00BD1005, 0x468F2105, 0x68000364, 0x90BE9303, 0x92BDFF49, 0x88BEFF49, 0x93BF8003, 0x93BDFF4C,
+0x0008FF4C, 0x4E95BF71, 0x4D94BEFF, 0xBE100500, 0xD0000508, 0x52952103, 0xC1800500, 0xC1FF5398,
+0x08FF5199, 0xC205F100, 0xC3FF5499, 0xC4FF559A, 0xC3FF579A, 0xC4FF589C, 0x20FF599D, 0xF89D1004,
+0xFF5C2004, 0xC3750430, 0xC5FF5C9D, 0x05005E9F, 0x44050800, 0xFF60A0C6, 0xC7B20004, 0xC6FF61A1,
+0xC7FF62A2, 0x000464A2, 0xB465A421, 0xA4C84004, 0x0A00FF68, 0x00000400, 0xC74004D8, 0x04FF6AA5,
+0x04F40800, 0x6BA7C940, 0x000004FF, 0xCA400014, 0x04FF6AA6, 0x04F80000, 0x00000404, 0x040804FC,
+0x05000900, 0x7862A221, 0xA1C57500, 0xA1C4FF61, 0x0200045F, 0x5E5100AC, 0x5D9EC4FF, 0xC0000004,
+0x9EC33100, 0x0000D85A, 0xC61100E0, 0x58130500, 0x56110500, 0xC26004FC, 0xC2FF5598, 0x16062097,
+0xF2000852, 0xFF529503, 0xFF5195C2, 0xFF5094C1, 0xFF4E95C1, 0x5C4F93C0, 0x4B942101, 0xBE400500,
+0x04FF4A93, 0x01840000, 0x00019000, 0xBE310004, 0x06B04791, 0x0006B400, 0xBDB101B8, 0xBCFF428F,
+0xBBFF418E, 0x01D43F8D, 0x3C8DBC40, 0x000004FF, 0x040401E8, 0x8ABA7100, 0x89B9FF3C, 0x0000043B,
+0xB8320710, 0x05103B87, 0x02408812, 0x3986B448, 0x930004FF, 0xFF3A84B3, 0xFF3A82B2, 0x000500AF,
+0x040004F8, 0x80AE8000, 0x80ADFF39, 0x0008FF37, 0x04050800, 0xC00002B0, 0x7AA54002, 0x0004FF37,
+0x000A0C00, 0xB3B11124, 0x99FF6197, 0xFFFF6386, 0x0EFCE3F5, 0xFCFAFB55, 0x04FCFEFF, 0x0004E802,
+0x40000366, 0x00040026, 0x02000C00, 0x0C000A21, 0x04FB0F0A, 0x4C002CFF, 0x00040001, 0x0601460F,
+0x01017F02, 0x2801016F, 0x00100000, 0x00002D07, 0xD0000014, 0x00210127, 0x0EECFE10, 0xF109F400,
+0x91FFEE1A, 0x7AFF6481, 0x8AFF4267, 0x9AFF4472, 0x99FF4A7D, 0x93FF437A, 0x96FF3873, 0x95FF3874,
+0x96FF3574, 0x9BFF3473, 0x09F43978, 0x0C04FC0C, 0xA3500500, 0xA5FF3A7B, 0xFC070738, 0x02500404,
+0x3A7EAB31, 0x68000760, 0x82AF3102, 0x00028839, 0x94000008, 0x83B24002, 0x04F8FF39, 0x6202B000,
+0xFF3985B6, 0x000487B7, 0x3A88B840, 0x410004FF, 0xFF3888B9, 0x01F704F4, 0xBCFF3989, 0xBDFF3989,
+0xBEFF398B, 0xBCFF3A8C, 0xBDA20004, 0xBDFF3C8C, 0xBFFF3D8E, 0xB103388F, 0xFF4390BE, 0xFF428FBB,
+0x5C4690BD, 0x03640003, 0x90000400, 0xFF4890C0, 0xFF4892BF, 0xA10388C0, 0xC1FF4994, 0xBFFF4B94,
+0x00084B94, 0x96C103F2, 0x95C0FF4D, 0x97C1FF4C, 0x94C0FF50, 0x97C1FF4D, 0xC21003CC, 0x040404FC,
+0x54973000, 0x3203F8FF, 0x0C5699C3, 0x12980304, 0x0009F404, 0x0C000A04, 0x0CC11000, 0x5F9F210A,
+0x50000EFC, 0x05000409, 0x000A0400, 0x0004047C, 0x0500000A, 0x4004A000, 0xFF66A2C6, 0xF40004FC,
+0x04FC0004, 0x7109F400, 0xFF69A4C4, 0x046AA5C5, 0x0EFC0000, 0xF8A8C722, 0x04FC0004, 0x00000408,
+0x38000508, 0x00080400, 0x02004002, 0x0C000F44, 0xA4C54100, 0x0064FF65, 0x000A0803, 0x84000A0C,
+0x0A000F0F, 0x0AAC0001, 0x00000400, 0x040000C8, 0x00CC0005, 0x0005D000, 0xC3310504, 0x0AF4579C,
+0x559AC140, 0x310B04FF, 0x105499C0, 0x98C03506, 0x80000850, 0xFF5196C0, 0xFF4F96C0, 0xBF31064C,
+0x06504D96, 0x01016000, 0x95610004, 0x93C0FF4A, 0x00000449, 0x90000184, 0x00040001, 0x4791C040,
+0x0004F8FF, 0xC03101B4, 0x01C4438F, 0x5001C800, 0xFF408EBE, 0x000504BE, 0x8D5001DC, 0x8DBDFF3B,
+0xF80206E8, 0x02100001, 0x3989BA41, 0x000004FF, 0x2C030A14, 0x02300002, 0x44024000, 0xFF3886B6,
+0x58000004, 0x05000002, 0x05076800, 0x7F210500, 0x000C8C3B, 0xF8000790, 0x00080004, 0x0009FC01,
+0x7D7011A4, 0x7DA7FF3A, 0x07CCFF3C, 0x7AA404F3, 0x80A6FF39, 0x98BAFF40, 0x8EA7FF5C, 0xA3B2FF5C,
+0x11230483, 0x01034BFC, 0x68012631, 0x03710003, 0x030D5400, 0x730013FA, 0x00180508, 0xFF05000F,
+0x04E40054, 0x0000040C, 0x14000183, 0x2CD00000, 0x20000800, 0x24E4FDFF, 0xFFF222F9, 0xFFC8E2F1,
+0xFF45687C, 0xFF436D86, 0xFF43728E, 0xFF447998, 0xFF397290, 0xFF346F8F, 0xFF397494, 0xFF3B7799,
+0xFF397597, 0xFF387498, 0x00367499, 0x04F80005, 0x00000404, 0x040409F4, 0x7CA33600, 0x00050038,
+0x7E300C48, 0x0500FF39, 0x8004FC04, 0xFF387FAD, 0xFF3881AE, 0xB14004F8, 0x04FF3981, 0x04FC0000,
+0x00029C00, 0xB52604F8, 0x4002B484, 0xFF3787B8, 0x040404F8, 0xF4BD1000, 0x05000F09, 0x03180004,
+0x0105000F, 0x04084800, 0x64000500, 0x00040403, 0x0492C124, 0x05000005, 0xC1FF4A42, 0x31000494,
+0x004C96C3, 0x98C33105, 0xB105004F, 0xFF5097C3, 0xFF4F96C2, 0x0C5198C4, 0x09FC0005, 0x020F0C00,
+0x0C030500, 0x05000F09, 0x5E9C2105, 0xFC0004FC, 0x140C0013, 0x0505000F, 0x0C049804, 0xFC080500,
+0x05040004, 0x40050008, 0xFF6CA8CA, 0x04040004, 0x04F80005, 0x00000408, 0xF800050C, 0x00080404,
+0x04145800, 0xFC000068, 0x00040004, 0x15050002, 0x000F9061, 0x04000EFC, 0x04FC0000, 0x00000400,
+0xFC020500, 0x0AD00204, 0x22050006, 0x0500FF56, 0x00FF5421, 0x51993105, 0x030500FF, 0xFC000008,
+0x00040004, 0x0004FC00, 0xBE220004, 0x040EF895, 0x00080164, 0x05040005, 0x30019405, 0xFCFF4690,
+0x00040004, 0x5104FC00, 0xFF418FC0, 0x210500BF, 0x01DCFF3D, 0x2504FC00, 0x06F4398D, 0x21050009,
+0x07343A8B, 0x0004FC00, 0x00000004, 0x00040005, 0x40050008, 0xFF3A84B1, 0xFC000500, 0x0004000E,
+0x00141000, 0xF8000004, 0x02A00004, 0x510CA000, 0xFF377CA6, 0x6004FCA7, 0x7DA5FF3A, 0x07D0FF3C,
+0x7BA104F1, 0x89ACFF3A, 0x8DABFF4A, 0x7C93FF56, 0xE6F4FF4F, 0x200500CA, 0x2B10FDFE, 0x00035E00,
+0xE0004249, 0x05000F04, 0x001C0009, 0x0F002C03, 0x25FF0007, 0x0004BC00, 0x3F060004, 0x01540001,
+0x03000400, 0x70030012, 0x1A800006, 0x000B7C00, 0x04001080, 0x00340000, 0x00000400, 0x9A0213F8,
+0xF316F106, 0xAFC9D8FF, 0x395D75FF, 0x3E6B88FF, 0x396E90FF, 0x3C7499FF, 0x397398FF, 0x367294FF,
+0x3B7698FF, 0x3D789AFF, 0x9631000C, 0x18E43672, 0xF8769C22, 0x0A00040E, 0x0004FC04, 0xF4000008,
+0x07240018, 0x0C2CA410, 0x3009FC00, 0x48FF387B, 0x00040007, 0x3104FC00, 0xF8377EAA, 0x00080409,
+0x00050004, 0x04000504, 0x05000400, 0x3885B340, 0x040004FF, 0x000C02B4, 0x0F000205, 0x0007F002,
+0x000802FC, 0x0D1C000F, 0x0D000400, 0x8E250A00, 0x040A0044, 0x70000368, 0x03780008, 0x00000400,
+0x9804038C, 0x95BF6F03, 0x97C1FF4A, 0x010B0500, 0x00050A08, 0x0500030A, 0xFF5B9A61, 0x005B9AC3,
+0x9CC34019, 0x18FCFF5E, 0x00000404, 0x040004FC, 0x05000000, 0x31045C01, 0xFCFF60A0, 0x0E7C0109,
+0x13946213, 0x0013FC02, 0xB40018A8, 0x00040404, 0x0018CC00, 0x040504F4, 0x6BA6A200, 0x6CA7C7FF,
+0x6DA8C8FF, 0xA9700004, 0xA9C8FF6C, 0x0A14FF6C, 0x12002405, 0x00192CA7, 0x040404F8, 0x00500000,
+0x30050001, 0x64FF66A2, 0x19740405, 0x00198000, 0x90001990, 0x00A40014, 0x01000408, 0xC40000B0,
+0x19D80319, 0x50050C01, 0xC1FF599D, 0x0A0A009D, 0xBF710500, 0xBEFF5398, 0x101C5297, 0x40050800,
+0xFF4F97BF, 0xBE410004, 0x04FF4E96, 0x05000500, 0x000B6402, 0x04000B78, 0x92BF4000, 0x0004FF49,
+0x000B9000, 0xBF45019C, 0x00FF4690, 0x428E210A, 0x00000A04, 0x10D4000A, 0x1101DC00, 0x510500BC,
+0x8CBBFF3B, 0x7200043A, 0xFF3A8BBA, 0x00398AB9, 0x3C8A5A0F, 0x3486B7FF, 0x11440011, 0x0409F800,
+0x00000004, 0x84AE2205, 0xF8001910, 0x04FC000E, 0x25000401, 0x169C3C7F, 0x000EF400, 0x040016AC,
+0xA40CF305, 0xA0FF3B7C, 0xA0FF397A, 0xABFF3C7C, 0xA1FF508B, 0x95FF5887, 0xFFFF5D82, 0x2FFCEEFF,
+0xFBFFFE30, 0x7F00036D, 0x3A590003, 0x02214501, 0x70000390, 0x03840003, 0x00000800, 0x2902001F,
+0x000A020A, 0xFF00060F, 0x014C0026, 0x06000400, 0x6C000140, 0x00040001, 0x03001203, 0x78000500,
+0x00040101, 0x03069700, 0xB2000004, 0x04FC0436, 0xACBA0CF1, 0x576BFF95, 0x6481FF34, 0x6C90FF37,
+0x759DFF36, 0x7097FF3A, 0x7095FF32, 0xB209EC32, 0xFF3A7597, 0xFF377294, 0xF4377397, 0x24771018,
+0xF8341500, 0x04F40013, 0x02000408, 0x392504FC, 0x010500FF, 0x04020744, 0x05000F05, 0x027C0001,
+0x001B9400, 0x900004FC, 0x00040007, 0x010A0000, 0x04070004, 0x07C00005, 0x3889B853, 0x0CD8B9FF,
+0x0013FC00, 0x080011F0, 0x02FC0000, 0x04050000, 0x2002120C, 0x303C1203, 0x418F6112, 0x408DB9FF,
+0x0C000EF4, 0x0A000419, 0x0404F800, 0xFC000004, 0x00040004, 0x0F00BE11, 0xFCFF4A20, 0x00040004,
+0x000F0004, 0x000208C0, 0xCC50110F, 0x04F80212, 0x08FF5222, 0xFF542000, 0x04000EFC, 0x180C0118,
+0x40050003, 0xFF5D9BC4, 0x04000500, 0x05000000, 0x03044401, 0x0C011DFC, 0x19000300, 0x0505000F,
+0x0704A401, 0x000413FC, 0x04E00405, 0x7104FC08, 0xFF6EA9C9, 0x006DAAC9, 0x05040C05, 0x040A0800,
+0x080004FC, 0x05000F00, 0x0A040009, 0x01050004, 0xB00800A4, 0x05000F00, 0x0F000F00, 0x05000501,
+0x08539821, 0x04FC000A, 0x01000400, 0x040004FC, 0x4D942105, 0x600113F8, 0x4B946115, 0x4B92C0FF,
+0xFC001400, 0x00040004, 0x4891BE40, 0x220004FF, 0x0F048FBF, 0x06B4BD10, 0xC8428F21, 0x8EBC3215,
+0x00140040, 0x8E3415DC, 0x0504FF3D, 0x00000800, 0x080001FC, 0x14080102, 0x303D8B21, 0x04F40016,
+0x00163404, 0xFC05000C, 0x38853504, 0x700500FF, 0xACFF3883, 0x88FF3881, 0x05000802, 0x0004F800,
+0x04001BAC, 0x05000400, 0x3B7B9F31, 0xA6E01708, 0x8FFF5188, 0xCDFF5079, 0xFFFFA3BF, 0x003004FF,
+0x4C021738, 0x04F70117, 0x00000501, 0x0400038C, 0x00180200, 0x06038400, 0x180203B0, 0x03AA0300,
+0xFF00070F, 0x014C0023, 0x02000400, 0x5000013D, 0x00040401, 0x00001202, 0x8F000183, 0x01780006,
+0x00000400, 0x0400002C, 0x10920200, 0xF033AC00, 0xB5FFF119, 0x6CFF8EA8, 0x81FF3558, 0x8AFF3A66,
+0x96FF356A, 0x98FF3670, 0x9AFF3371, 0x9AFF3573, 0x9BFF3975, 0x96FF3C76, 0xF30A0874, 0x9AFF3701,
+0x9CFF3775, 0xA0FF3576, 0xA3FF3176, 0x30200C79, 0xFCFF3778, 0x18FC0004, 0x04000404, 0x080404F8,
+0x09F80000, 0x62000400, 0xFF387CA9, 0x1B5C7DAA, 0x00116000, 0x6400050C, 0x0274000C, 0x1684AB13,
+0x0020A400, 0x9C000004, 0x00040802, 0x0002B800, 0xB61002C0, 0xD80304FC, 0x1DFC0016, 0x001BF400,
+0x00000008, 0x1E00001C, 0x001DF800, 0xBA400004, 0x04FF3E8C, 0x1E000000, 0x0D0EF400, 0x00071E00,
+0x17700019, 0x00177C00, 0x88000004, 0x178C011C, 0x13179C04, 0x6112B094, 0xBFFF5196, 0x19085095,
+0x021CD400, 0x000004F8, 0xFF517305, 0xFF5499C3, 0x0018FCC4, 0x14001900, 0x2698001D, 0x011E0008,
+0xF4030930, 0x09F8001D, 0x05000404, 0x000113FC, 0xFF61300A, 0xA2188CC5, 0xC7FF63A3, 0xC4FF64A4,
+0x1DB064A3, 0x001DC803, 0xC8441DCC, 0x04FF68A7, 0x0EEC0400, 0x400EF800, 0xFF6DA9CB, 0x0C000004,
+0x00180400, 0x0104F800, 0xA7210004, 0x011E0868, 0xA6211DFC, 0x01005467, 0x6000005C, 0x14000700,
+0x00148000, 0x00010004, 0x5F9F2105, 0xA8001DF4, 0x0FA80000, 0x000F000C, 0xE0011408, 0xF49B1319,
+0x0099160A, 0x10100019, 0x041F2800, 0x00021908, 0x01400214, 0x00014400, 0x60001A48, 0x1F68001A,
+0x20000800, 0x247491BE, 0xBDFF4B51, 0x00044A91, 0x001E0004, 0x00001AA8, 0x06B40019, 0x4115B801,
+0xBAFF428F, 0x40111904, 0xBB751DF8, 0xBAFF3D8E, 0x00043C8D, 0x4001F800, 0xFF3B89B7, 0xB6310214,
+0x1DEC3D8A, 0x001DF800, 0x04001E00, 0x000C0000, 0x011E0404, 0x85E1025C, 0x84B0FF38, 0x83AFFF37,
+0x81AEFF36, 0x00118837, 0x94000504, 0x04FC0002, 0x0002AC00, 0xB8000004, 0x02AC0002, 0x7DA408F3,
+0x7DA1FF39, 0x81A3FF3D, 0x7F9AFF45, 0x7083FF4D, 0xF9FFFF4F, 0x1109FCE5, 0x0009FCFB, 0xFC110360,
+0x8C041900, 0x00080003, 0x03050003, 0x9E02087C, 0x00180203, 0x0F000C02, 0x24FF0006, 0x00016C00,
+0x3E020004, 0x01500001, 0x02000404, 0xFC000012, 0x00040004, 0x0204FC04, 0x98000016, 0x40BA0010,
+0xFFF40EF1, 0xFF9EB8C7, 0xFF2B4F65, 0xFF37637C, 0xFF356686, 0xFF387093, 0xFF347095, 0x0037759C,
+0x72973105, 0x4009F838, 0xFF3A7295, 0xF4000A04, 0x769EB213, 0x77A3FF35, 0x75A1FF30, 0x0F250C2E,
+0x31240500, 0x08387FA9, 0x026C0014, 0x00050004, 0xEC000504, 0x05000027, 0x0125B400, 0x842102A4,
+0x0007A83A, 0x000202B8, 0x1BD40605, 0x0402E800, 0x00080004, 0x05080005, 0x0004FC00, 0x000F0004,
+0x58000105, 0x215C0003, 0x0404F800, 0xFC000004, 0x92BB3104, 0x00218849, 0x98000504, 0x039C0121,
+0x8008AC01, 0x96BFFF4F, 0x94BEFF51, 0x531117C8, 0xF80221DC, 0xFF504F13, 0x050098C2, 0x05040003,
+0x12042001, 0x0F23009C, 0x000D0500, 0xC42E1DF8, 0x040500A1, 0x080004F4, 0x04C00400, 0x22050000,
+0x230CA8C9, 0x0004EC00, 0xFC0004F4, 0x00040004, 0x00000C00, 0xF8010014, 0x28280304, 0x00003C04,
+0x04040040, 0x05000000, 0x00230808, 0xFC000578, 0x0A8C0004, 0x00059400, 0xA40004F8, 0x00080019,
+0x1105000A, 0x421ECC5B, 0xFF5C9DC5, 0x000C1E00, 0x1C551223, 0x5396251F, 0x000F1E00, 0x00000305,
+0x00040023, 0x24784C11, 0x00230400, 0x04002300, 0x05000400, 0x3101A400, 0xB4448FB9, 0x04F8011F,
+0x00050003, 0xEC000BCC, 0x04FC0004, 0x008CB920, 0xFF3B200F, 0x04000008, 0x05000802, 0x00073400,
+0x100004F4, 0x05000F23, 0x83B19309, 0x82B0FF36, 0x04B0FF35, 0x13FC0105, 0xFF3B7E30, 0x04001408,
+0x23080000, 0x00050000, 0x00F216CC, 0xFF3D7C9F, 0xFF477FA0, 0xFF47758D, 0xF47A94A3, 0x3EFC0027,
+0x2CF4FD12, 0x00039001, 0x7D000387, 0x00040108, 0x02037000, 0x1C00037A, 0x00040400, 0xFF0F000F,
+0x01750040, 0x00016C00, 0x70020008, 0xFDFC5001, 0xE0F9FFFF, 0x0678004A, 0xFFFDFD30, 0x0DF015A0,
+0xFFF9FFFF, 0xFFF2FDFF, 0xFFC4D8E3, 0xFF294D63, 0xFF2D5A77, 0xFF326383, 0xFF376C8E, 0x965104E8,
+0x99FF3771, 0x3A2018E0, 0x310500FF, 0x003B7396, 0x18F4000A, 0x35759BA2, 0x32759FFF, 0x0476A3FF,
+0x78A23100, 0x042CE435, 0xA21309F8, 0xF8042CF0, 0x79A43109, 0x02202C36, 0xF0021644, 0x02480004,
+0x1304F404, 0x001408A8, 0x04000774, 0x27F40100, 0xFF3C8531, 0x83122598, 0x040004F8, 0x02C80005,
+0x0404FC08, 0xE80116D0, 0x20F0030C, 0x000CFC00, 0x08001714, 0x0F080000, 0x010F0000, 0x2800000C,
+0x1C30000D, 0x001DF800, 0x8F212144, 0x001C5845, 0x08000858, 0x0D680005, 0x4792BC80, 0x4893BDFF,
+0x000EFCFF, 0x98010004, 0x4B94301C, 0x0117A8FF, 0x04040004, 0x0A00000A, 0x18F89612, 0x000A0000,
+0x00F204FC, 0xFF5099C2, 0xFF5299C3, 0xFF539AC4, 0x04569BC4, 0x579AB000, 0x589BC5FF, 0x5B9FC6FF,
+0x000428FF, 0x30011D2C, 0x5D9E2109, 0xC3412300, 0x04FF5EA0, 0x0F000300, 0x00047000, 0x04000478,
+0x90C71105, 0x0A000227, 0x0904A000, 0xC00422B4, 0x0A100327, 0x0004E400, 0x040004EC, 0x04F80000,
+0x00000400, 0x1C01000C, 0x68A72105, 0xCA4027F8, 0x04FF68A7, 0x23080000, 0x00004C00, 0x04050054,
+0x0A680000, 0x01007000, 0x61120A74, 0xA2621488, 0xA2C5FF60, 0x03230460, 0x080000B0, 0x00C00023,
+0x1000CC00, 0x212300C5, 0x23E4599D, 0x599CC6D0, 0x589BC6FF, 0x579AC5FF, 0x0A00C4FF, 0x2122F800,
+0x27F45396, 0x4022F000, 0xFF5397C4, 0xC3310004, 0x1A345296, 0x0022FC01, 0x9421244C, 0x0023004D,
+0x6C011050, 0x4C932101, 0x78000F00, 0x0004000B, 0x060F0402, 0xAC002300, 0x0A000001, 0x00230004,
+0xF00006D8, 0x01E40004, 0x000EF800, 0x04001FF4, 0x0EFC0114, 0x01140400, 0x3B110A04, 0xFC002028,
+0x2308000E, 0x00024000, 0x04000248, 0x16540000, 0x13000400, 0x410A00B1, 0xFF3482B0, 0x00030004,
+0x04F40005, 0x41050400, 0xFF397DAC, 0x7E610004, 0x7CA8FF37, 0xF018FC35, 0x407CA003, 0x417896FF,
+0x40697FFF, 0xCDE1ECFF, 0x3CFEFFFF, 0x08FC111C, 0x04DC054E, 0x00038301, 0x04000005, 0x03940000,
+0x04039002, 0x08040020, 0x00160200, 0xFF00060F, 0x01480A28, 0x00016C04, 0x70020008, 0x0020000B,
+0x2018F000, 0x09F0FAF8, 0xF1018800, 0xFFFFF90E, 0xFFFFF1FE, 0x58FFE9FB, 0x70FF2C47, 0x83FF2955,
+0x8DFF2E63, 0x92FF356B, 0x05003971, 0x36709540, 0x000504FF, 0x040404FC, 0x73992000, 0x36201910,
+0x720500FF, 0xFF34759D, 0x043376A1, 0x27FC0700, 0x000F0400, 0x040018F8, 0x05000000, 0x00000400,
+0x3C00163C, 0x04F40011, 0x40050400, 0xFF367BA5, 0x0C010004, 0x3A7F210F, 0x78001170, 0x04F8001B,
+0x00140000, 0x08001184, 0x19100000, 0x00258000, 0x040004FC, 0x02B40000, 0x00000400, 0x040002C4,
+0x14080000, 0x00191400, 0x0C0013FC, 0x1E100000, 0x0020F400, 0x04041904, 0x05040400, 0x00190000,
+0x40021734, 0x5043111C, 0x21580117, 0x03050800, 0xFC091268, 0x4A952104, 0xF40122FC, 0x4D963022,
+0x011CB0FF, 0xB80021B8, 0x04FC0726, 0x010EF400, 0x98122314, 0x00040A04, 0x2D000028, 0x040F0400,
+0xFC002804, 0x00040404, 0x41044400, 0xFF5D9FC2, 0x9E210004, 0x012CF45E, 0xA02104FC, 0x01047C62,
+0xA2162CFC, 0xB0001904, 0x00040004, 0x0004BC00, 0xC8000004, 0x00040009, 0x010A0000, 0xA6210004,
+0x0027F46A, 0xFC0004F4, 0x00040004, 0x00000C00, 0x20000518, 0x00340000, 0x0000040C, 0x04040050,
+0x1E000000, 0x01057001, 0x88020074, 0x28000819, 0x0027F800, 0x080004FC, 0x00BC0100, 0xD85B9C22,
+0x599D2128, 0x000C22F4, 0x98C33105, 0x02100C55, 0x5320061C, 0x0004F8FF, 0x34002430, 0x1540001F,
+0x00050000, 0x0800014C, 0x01600000, 0x0004EC00, 0x7C000670, 0x0184000B, 0x01000800, 0xA003068C,
+0x0EF80024, 0x24B4BC13, 0x11050002, 0x0415D040, 0xF8010EF8, 0x398BA104, 0x398BBBFF, 0x388ABAFF,
+0x200018FC, 0x07200016, 0x3C000409, 0x04FF3B87, 0x02480005, 0x000C5400, 0xB1410F00, 0x04FF3583,
+0x88821200, 0x05000020, 0x3507A400, 0x003C7FAC, 0x05100005, 0x3D7CA5B1, 0x3C7799FF, 0x3F718CFF,
+0xFF312B1C, 0x5818EFFD, 0xFCFCFE67, 0x00FBF9FF, 0x04D3010A, 0x04038800, 0x11010004, 0x09F30100,
+0x04039400, 0x16030004, 0x00070F00, 0x480A27FF, 0x016C0401, 0x02000800, 0x8C000500, 0xF8FB101A,
+0x51B40109, 0x0031D400, 0x12F506AC, 0x5968FFF0, 0x5268FF3F, 0x5977FF2F, 0x688AFF2A, 0x6F90FF32,
+0x7293FF37, 0x7194FF3A, 0x6F92FF39, 0xA2050037, 0xFF377398, 0xFF357398, 0x04FC749B, 0x00050000,
+0xFC000004, 0x759E401D, 0x0F0CFF36, 0x001E0000, 0x040004FC, 0x18F80000, 0x00050000, 0x04003430,
+0x0A200000, 0x00000800, 0x40002800, 0x58A91016, 0x3C7F611B, 0x3B7EA8FF, 0x54000EFC, 0x7FAC2007,
+0x7802117C, 0x19000002, 0x0004F001, 0x86442CF0, 0x04B5FF3C, 0x3A872100, 0xC4002AC8, 0x00040802,
+0x0518F801, 0x3C152D00, 0x08002CFC, 0x0004040A, 0x3D8DBE31, 0x04012630, 0x1C440005, 0x00000403,
+0x08001414, 0x00040019, 0x00190408, 0x04001E00, 0x18FC0000, 0x00089C01, 0x9321280C, 0x0022FC4C,
+0xC80103BC, 0x1CDC0003, 0x30000400, 0xECFF5398, 0x04FC0017, 0x0026FC00, 0xB0003200, 0x0EF8003A,
+0x0004F400, 0xF4000434, 0x00040027, 0x010E4C00, 0x58000004, 0x00040513, 0x31366802, 0x7C639FC3,
+0x1D800036, 0x05188000, 0xA2211D90, 0x0C36B466, 0xC4001908, 0x00040218, 0x202D0804, 0x3214FF6B,
+0x00000404, 0x20022D1C, 0x38691500, 0x18F4002D, 0x00000404, 0x00000050, 0x36FC000F, 0x0022F804,
+0xFC000F7C, 0x9CC2151D, 0xA05F1500, 0x0F040032, 0x0000BC01, 0xD00314C0, 0x22FC002D, 0x310AE400,
+0xF8579CC5, 0x0104002D, 0x04101401, 0x18002914, 0x5097212E, 0x34001DF8, 0x18FC0101, 0x211DF800,
+0x0B584C96, 0x62106000, 0xFF4B96C0, 0x247096C2, 0x4794C032, 0x93B12804, 0x92BEFF46, 0x91BDFF45,
+0x01A4FF44, 0x400BB803, 0xFF418FBD, 0x000018FC, 0x0EF8042D, 0x0724E401, 0xFC042804, 0x02180406,
+0x3987B840, 0x000004FF, 0x04000724, 0x07340000, 0x3785B540, 0x000004FF, 0x64000750, 0x83AC6011,
+0x82AFFF3A, 0x00002584, 0x94371114, 0x13FC0007, 0x0002A400, 0x0C0034AC, 0x7AA73100, 0xF231F836,
+0x3A789D00, 0x3A6F8FFF, 0x3C6980FF, 0x98B5C5FF, 0x5C0031F0, 0x52FC120D, 0x03900017, 0x0052D400,
+0xED015538, 0x0F000104, 0x08039002, 0x280004E5, 0x00040000, 0x0F001408, 0x22FF000C, 0x00014400,
+0x3C020004, 0x01680001, 0x02000404, 0x1C000500, 0x00040000, 0x025BA200, 0x0AF14F9C, 0x97A6FFEE,
+0x495EFF7D, 0x556EFF29, 0x5F80FF2B, 0x6C8FFF2D, 0x7091FF34, 0x000A0038, 0x04000500, 0x09F80014,
+0x0104FC00, 0x73611904, 0x749DFF35, 0x0009FC35, 0x992004FC, 0x11191875, 0x00320037, 0x00000508,
+0x0F000005, 0x0105000F, 0x00395000, 0x00000004, 0x0A100005, 0x00000800, 0x04040508, 0x07640100,
+0x74398021, 0x0F000002, 0x000A0004, 0x04000508, 0x3208041E, 0x020F1000, 0x3C91320C, 0x3D86B3FF,
+0x3D85B5FF, 0xD800051C, 0x00040411, 0x00140800, 0x04003710, 0x8ABB2000, 0x3E513518, 0x408CBDFF,
+0xBC403034, 0x44FF438D, 0x8EBE201C, 0x04022CF8, 0x0EFC0000, 0x0013FC05, 0x00031778, 0x04F40132,
+0x00320003, 0xAC0031F8, 0x00040117, 0x04509521, 0x95BF3114, 0x00140052, 0xBC1136FC, 0x08003C04,
+0xFF55913C, 0xFF5697BD, 0x285898BC, 0x9BBF403F, 0x0004FF5B, 0x5C9BBE32, 0x9C214024, 0x003B385D,
+0xBF443B44, 0x08FF5F9E, 0xC203F000, 0xC0FF629E, 0xC3FF639E, 0xC2FF649E, 0xC5FF65A0, 0x003B98A0,
+0xF8003BA0, 0x3BB0003B, 0xC3FF6840, 0x2031FCA3, 0x27FCFF69, 0x0004D800, 0x080027F8, 0xFCC61000,
+0x6CA4B022, 0x6DA5C6FF, 0x6DA5C8FF, 0x0C0010FF, 0xC9310008, 0x00186CA7, 0x04003000, 0x08000038,
+0x2D480000, 0x00454000, 0x04002360, 0x3C000100, 0xFF64A061, 0x04639FC1, 0x00C01300, 0x00A8003C,
+0x08000400, 0xF0013BF8, 0x40BC0340, 0x0005E000, 0xF4000508, 0x05FC000A, 0x00060400, 0x04020118,
+0x061C0200, 0x20230800, 0x3D3C96BD, 0xBBFF5091, 0xBAFF4F94, 0x00044C94, 0x4C94BC31, 0x0005156C,
+0x157C000A, 0x94489121, 0x38A00133, 0xA8468F21, 0x91BB3538, 0x0E24B046, 0xE8033700, 0x2CEC0038,
+0x2231FC00, 0x18FC3C88, 0x043D8725, 0x37080037, 0x00022400, 0x50001400, 0x09F4002F, 0x02076400,
+0x3E5204FC, 0x3F83AAFF, 0x18003E60, 0x3704033C, 0x3E7FA762, 0x047EA4FF, 0x27F40000, 0x312CF800,
+0x20407FA8, 0x6A867217, 0x5A6EFF3B, 0x2522F437, 0x04E7F7FC, 0x00036800, 0x00000004, 0x00150505,
+0x02050001, 0x060C039E, 0x002C0000, 0x0F00140C, 0x1EFF0010, 0x00014400, 0x38020004, 0x04FC0401,
+0x02000800, 0xDC050500, 0x15A00031, 0xFFF1FF30, 0x00F14FA4, 0xFF204055, 0xFF274F69, 0xFF22516F,
+0xF4366B8D, 0x04F8040E, 0x39719640, 0x710004FF, 0xFF387298, 0x04357196, 0x05040119, 0x00347422,
+0x36742105, 0x08001E04, 0x3704001E, 0x083BF400, 0xFC020500, 0xF8381109, 0x04F00022, 0x00342400,
+0xA63104F4, 0x2A3C3D7E, 0x00254000, 0x60000004, 0x80A84402, 0x0A10FF3F, 0xF1000800, 0x3E81AB00,
+0x4083ADFF, 0x4285AFFF, 0x4386B0FF, 0x00F10004, 0xFF4687B1, 0xFF4487B1, 0xFF4588B2, 0x044689B3,
+0x8AB45700, 0x04B5FF47, 0x8CB64400, 0x0004FF47, 0x488DB731, 0xDC0040D8, 0x40E4003B, 0x00174800,
+0xE0001750, 0x3BDC003B, 0xD492BD22, 0x93BD4140, 0x0004FF50, 0xFF529630, 0xBD3540D0, 0x40D45495,
+0x2103BC01, 0x04D05697, 0x5798BE60, 0x9098BEFF, 0xFF594044, 0x44A899BF, 0xBEFF5A55, 0x44F05B99,
+0x619DC148, 0x220004FF, 0x04CC9DC2, 0x66A1C348, 0x2A0004FF, 0x04D0A2C4, 0x68A3C531, 0xC63104D0,
+0x49886BA3, 0x04C8C713, 0x6EA6C975, 0x6FA7C8FF, 0x00F50004, 0xFF70A8C9, 0xFF70A9C7, 0xFF71A9CA,
+0x0871AAC8, 0xCB07FE00, 0xCAFF72AA, 0xCAFF73AC, 0xC8FF72A8, 0xCBFF72A9, 0xC9FF73A9, 0x310008AB,
+0x1874ACCD, 0x00400400, 0x00003800, 0x58000028, 0xA8C62600, 0xC7310068, 0x05486EA6, 0x00054C00,
+0x24004A18, 0x05340005, 0x00052800, 0x040400AC, 0x00C80000, 0x67A1C631, 0xA40005A8, 0x0AAC000A,
+0x110A3402, 0x0005D460, 0xBF570528, 0xC0FF5C9C, 0x08010004, 0x45680006, 0xFF599BA1, 0xFF589ABD,
+0x045799BC, 0x99BE3100, 0x003D4055, 0x50000520, 0x01880142, 0x00019003, 0x7400426C, 0x92B92042,
+0x4E114290, 0xA0004298, 0x42AC0042, 0x4A8FB8B1, 0x498EB7FF, 0x498EB8FF, 0x240042CC, 0x28B81341,
+0x8AB76641, 0x8BB5FF46, 0xB2440004, 0x04FF4388, 0x87B02000, 0x41420258, 0x0486AFFF, 0xAD00F100,
+0xA8FF4286, 0xA7FF4583, 0xABFF4482, 0x027C4283, 0x82AA1CF3, 0x82A8FF41, 0x80A4FF42, 0x80A2FF44,
+0x7FA3FF45, 0x7EA3FF43, 0x7FA6FF40, 0x779CFF41, 0x6788FF3B, 0x6780FF35, 0x8190FF3F, 0x0018F867,
+0xCC023BE9, 0x09F40045, 0x5829FD10, 0x0286F001, 0x98015D0C, 0x038F0003, 0x01000404, 0x050F0011,
+0x0038FF00, 0x040004FC, 0x01520200, 0x00016506, 0x04040014, 0xFDFC2100, 0xA0011402, 0x6677B12E,
+0x4F66FF4B, 0x5371FF29, 0x0004FC24, 0xE00004F8, 0x0EF40018, 0x31000400, 0xFC3A7297, 0x0500040E,
+0x000A0400, 0x04000F00, 0x1DFC0005, 0x04000400, 0x000004FC, 0x04FC0405, 0x000A0000, 0x000C0004,
+0x04FC0019, 0x04000400, 0x4C00320C, 0xA904F107, 0xA7FF4081, 0xA5FF4181, 0xA2FF3F7F, 0x9EFF3F7D,
+0x0F643B79, 0x6E9304FF, 0x688DFF30, 0x6287FF2A, 0x5E83FF24, 0x5C81FF22, 0x12000420, 0x1F5D8244,
+0x660004FF, 0xFF1F5D84, 0x00045F85, 0x1E5E8450, 0x000482FF, 0xFF1F5D61, 0x58205E83, 0x5F834400,
+0x0004FF23, 0x2460844F, 0x010004FF, 0x25618342, 0x460004FF, 0x6183FF26, 0x82410004, 0x04FF2961,
+0x2A60A900, 0x2A6082FF, 0x286081FF, 0x14000004, 0x61834000, 0x0004FF2B, 0x2C638231, 0x81800008,
+0x84FF2B62, 0x10FF2C62, 0x00080400, 0x2D6385B1, 0x2D6483FF, 0x2E6385FF, 0x080C1580, 0x15940000,
+0x638204F9, 0x6484FF2E, 0x6483FF2F, 0x6585FF2F, 0x6584FF30, 0x35000830, 0x10316685, 0x0C861000,
+0x31663900, 0x220008FF, 0x00103067, 0x00386713, 0x102F6621, 0x68868000, 0x6787FF31, 0x0040FF32,
+0x31000800, 0x18326786, 0x00100000, 0x01004000, 0x3C000004, 0x3067D600, 0x316887FF, 0x306786FF,
+0x046688FF, 0x65874400, 0x0004FF2F, 0x3068894F, 0x010004FF, 0x2E698B44, 0x460004FF, 0xFF2D688A,
+0x2C460004, 0x04688AFF, 0x6A8D4000, 0x0004FF2B, 0x2A698C31, 0x8D400008, 0x04FF2D69, 0x688C4000,
+0x0004FF2C, 0x05000C00, 0x6A5A0004, 0x698EFF2B, 0x91810004, 0x91FF2C6A, 0x08FF2B6B, 0x000C0000,
+0xFF2C6A4B, 0x4400048F, 0xFF2D6B90, 0x1C000004, 0x8E00F100, 0x8FFF2C6B, 0x8DFF2D6C, 0x8AFF2F6B,
+0x00043169, 0x2E6A8F71, 0x2B6B8FFF, 0x8C81003C, 0x87FF2E6A, 0x28FF3069, 0x3069A101, 0x336B8CFF,
+0x326C91FF, 0x849100F4, 0x62FF3A67, 0xEEFF2D4D, 0xF8114AE8, 0x430009E7, 0x03800060, 0x000F0200,
+0x15000004, 0x3F4C0000, 0x01000400, 0x970409FF, 0x00080003, 0x0F002900, 0x39FF0004, 0x0204E404,
+0x61060153, 0x00180001, 0x0004F600, 0xFE200008, 0xF1000AFC, 0xDCFFF80A, 0x50FFBDD1, 0x75FF1D3C,
+0x81FF3059, 0x93FF2A5F, 0x94FF346E, 0x04F0356F, 0x336D9231, 0xF800000C, 0x19000F0E, 0x05080401,
+0x00050000, 0xF8000EF4, 0x19080013, 0x00050000, 0xFC000004, 0x00040004, 0x00050006, 0x39112CFC,
+0x30001E1C, 0x04F80034, 0x400A0400, 0xFF3D7DA3, 0x8F310040, 0x04DC2A68, 0x1F577AB1, 0x1F5577FF,
+0x1E5476FF, 0x75400004, 0x04FF1F56, 0x7600F100, 0x77FF2057, 0x75FF2158, 0x76FF2055, 0x00042156,
+0x44000C00, 0xFF1F5474, 0x10000004, 0x10731000, 0x2055A100, 0x215675FF, 0x205574FF, 0x4004001C,
+0x00080000, 0x00000405, 0x0401001C, 0xFF224800, 0x00045574, 0x04003402, 0x50000054, 0x00040800,
+0x1E537240, 0x410010FF, 0xFF215471, 0x53430004, 0x0471FF22, 0x52707100, 0x5473FF21, 0x79007421,
+0xFF215374, 0x04225475, 0x00680000, 0x0F001400, 0x03020008, 0x778000B4, 0x76FF2456, 0x08FF2457,
+0x56758000, 0x5576FF23, 0x0008FF23, 0x22000400, 0x000C5673, 0x24577422, 0x00080000, 0x00001804,
+0x10000034, 0x58778F00, 0x5875FF25, 0x0008FF25, 0x23592202, 0x080B0018, 0x7604F600, 0x79FF245A,
+0x77FF275A, 0x79FF275A, 0x77FF2859, 0x00082859, 0xFF275A69, 0x04285B7A, 0x002C0000, 0x597A00F1,
+0x5A7BFF27, 0x5B7BFF28, 0x5A7AFF26, 0x00000425, 0x7A440010, 0x04FF295A, 0x5B7B7900, 0x5C7BFF2A,
+0x4F000429, 0xFF285D7C, 0x40010004, 0xFF295E7D, 0x7C410004, 0x04FF275E, 0x285D2100, 0x7E400010,
+0x04FF2A5F, 0x5E7F7A00, 0x5D7EFF2C, 0x6100042B, 0x7FFF295E, 0x00042A5F, 0x2B608040, 0x010004FF,
+0x60160010, 0x10000018, 0x00180000, 0x31000400, 0x4C2B607F, 0x00500100, 0xFF2B6030, 0x04010010,
+0x610BF100, 0x6280FF2A, 0x627EFF2B, 0x607EFF2C, 0x617EFF2F, 0x6384FF2E, 0x6486FF2B, 0x22000429,
+0x001C6482, 0x2E617C71, 0x2D637FFF, 0xD0000038, 0x6281E006, 0x5B75FF2F, 0x5C6FFF33, 0xFFFFFF41,
+0x59031748, 0x6E010021, 0x00038101, 0x04000380, 0xFFFC4000, 0x190CFEFB, 0x09050E02, 0x28010504,
+0x00050F00, 0x6F0039FF, 0x014F0101, 0x00000900, 0x8C020004, 0x04F8000B, 0x01000400, 0x7801001B,
+0xF402F197, 0x46606FFF, 0x30546CFF, 0x275674FF, 0x346A8EFF, 0x040022DC, 0x04F00005, 0x04000800,
+0x0C001DF4, 0x00140000, 0x0036FC00, 0xF4000A08, 0x00040031, 0x000A0800, 0xF8001908, 0x76A02018,
+0x34212308, 0x210008FF, 0x04E83677, 0x367AA145, 0x700004FF, 0xA0FF3879, 0xF0FF3A7A, 0x7BA03104,
+0xC03C2C3D, 0xFF28668B, 0xFF1E5A7E, 0xFF1B557A, 0x1EF304F8, 0xFF265879, 0xFF27556F, 0xFF275169,
+0xFF264E67, 0xFF234B64, 0xFF20495F, 0xFF1D465C, 0xFF1C455B, 0xFF1F455C, 0xFF20465D, 0xFF21455B,
+0x3200045D, 0x1820445C, 0x21452100, 0x5A100018, 0x46650010, 0x465CFF22, 0x01001022, 0x38000030,
+0x20462200, 0x0C000040, 0x21453000, 0x02002CFF, 0x21420004, 0x044458FF, 0x00100200, 0x58FF2020,
+0x43594F00, 0x0004FF1F, 0x44577505, 0x4357FF1F, 0xF2000420, 0x1F425600, 0x1F4258FF, 0x1F435BFF,
+0x1E445BFF, 0x0C000008, 0x1F436500, 0x1E425AFF, 0x20010004, 0x00180F00, 0x00340001, 0xFF1E4461,
+0x041D4159, 0x00340800, 0x22000C04, 0x00584258, 0x00009400, 0x080F0048, 0x2C000100, 0x00280000,
+0x01000808, 0x5C000028, 0x00640400, 0x0000080F, 0x22015C00, 0x00AC455A, 0x31004000, 0xFC20425B,
+0x01080000, 0x04011400, 0x08000170, 0x00140000, 0x71000400, 0xFF22465E, 0x5421475E, 0x455FA001,
+0x4660FF20, 0x445DFF22, 0x2384017C, 0x23455EFF, 0x08465CFF, 0x10221100, 0x01880000, 0x23475F8F,
+0x23475DFF, 0x050008FF, 0x22485D41, 0xE60004FF, 0x5EFF2347, 0x5FFF2448, 0x60FF2549, 0x0004264A,
+0x18254721, 0x08601300, 0x49613100, 0x13002425, 0x04002462, 0x08080010, 0x00400400, 0x274B614F,
+0x050004FF, 0x264C5FB1, 0x284D60FF, 0x284B5FFF, 0x66710024, 0x66FF254D, 0x0004244E, 0x244E6490,
+0x274D60FF, 0x00205FFF, 0xFF264CA1, 0xFF284E63, 0x94285167, 0x495B7200, 0xCFDBFF2C, 0x0066F0BD,
+0x73005D10, 0x00040003, 0x07036900, 0xFA0036F0, 0x03800004, 0x0F000400, 0x4BFF0500, 0x01017800,
+0x85000004, 0x00040001, 0x00050002, 0x04000B94, 0x0B8C0000, 0x4006AC00, 0xFFBED8E7, 0x777102C0,
+0x84FF2A55, 0x0EFC3060, 0x396F9131, 0xF8001DF8, 0x18F4000E, 0x000F0C01, 0x70402304, 0xF497FF36,
+0x3200003B, 0xFF357330, 0x9B2218F0, 0x0031FC77, 0x01F00F08, 0xFF36749D, 0xFF3776A1, 0xFF34739E,
+0xFF3978A3, 0x18F109F4, 0xFF33779E, 0xFF357AA1, 0xFF327B9E, 0xFF377D9F, 0xFF387A9D, 0xFF3E7DA0,
+0xFF346F91, 0xFF21597A, 0xFF235A79, 0xDC245979, 0x05800008, 0x4B691FF0, 0x455FFF22, 0x4D5EFF21,
+0x6673FF32, 0x8C9AFF50, 0xAFBAFF79, 0xC6D0FF9B, 0xD8E2FFB4, 0xE7EFFFC6, 0xF0F9FFD6, 0xEFF8FFE2,
+0xEFF7FFE1, 0x04080008, 0xFFE13700, 0x000014F8, 0x040C0020, 0x00200000, 0x04001400, 0x0C000008,
+0x00040500, 0xFFE4EE44, 0x250004F7, 0x0060E2EF, 0x03002005, 0x100D0014, 0x00340400, 0x00000807,
+0x040F0060, 0x80004500, 0x005C0000, 0x5200080F, 0x0300D400, 0x70040154, 0x007C0000, 0x0E00040F,
+0x48003800, 0xF8FFE4EE, 0x48000008, 0x00100000, 0x03000800, 0x4800014C, 0x00580400, 0x61000809,
+0xF8FFE3F0, 0x0184E3F0, 0x0C001800, 0x58010004, 0x00480000, 0x1500500F, 0x0C007003, 0x100F0048,
+0xF5360500, 0x007CE4EF, 0xFFE1F043, 0x440004F7, 0xFFE2EFF5, 0xF6220004, 0x600284EE, 0xFFE7F4FC,
+0x6BD4FBFF, 0x030D5000, 0x7C01036C, 0x00050F03, 0xCC0070FF, 0x54C2003B, 0x00067005, 0xA3010009,
+0x01AC0001, 0xFFF20AF1, 0xFF5B7E92, 0xFF24516E, 0xFF28587C, 0xFF3A6B93, 0xFF3B7092, 0x00356C8B,
+0x22FC0005, 0x386E9231, 0xFC0022FC, 0x09FC0018, 0x00050000, 0x9AB104EC, 0x97FF3474, 0x98FF3373,
+0x13A43474, 0x34729931, 0x27F0230C, 0xFF3875A1, 0xFF36739F, 0xFF37769F, 0xFF33749C, 0xFF377BA2,
+0xFF34789D, 0xFF367A9F, 0xFF3B7DA0, 0xFF327192, 0xFF215C7C, 0xFF235A78, 0xFF2A5C77, 0xFF29576F,
+0x07E04C65, 0x80FF26D3, 0xC5FF4C6B, 0xF4FF95B0, 0x1644CEE3, 0x00393800, 0xA000378C, 0x00040023,
+0x0000B400, 0xC10028AC, 0x00040400, 0x04026408, 0x08000014, 0x00180800, 0xFF000C0F, 0xDC0049FF,
+0x00040018, 0x02026208, 0x120818EC, 0x000C0F00, 0x030361FF, 0x05000004, 0x0086C600, 0x3E006A70,
+0x0B740504, 0x610EFC00, 0x62FFE6F8, 0x11F4234C, 0x2B5D80C0, 0x3B6D92FF, 0x386D8FFF, 0x400A00FF,
+0xFF366E91, 0x94510004, 0x95FF376F, 0x000036FC, 0x2D000037, 0x0A043511, 0x0013F000, 0x97314FEC,
+0x41083574, 0x80140800, 0xFF38739B, 0xFF38769F, 0x9A310F08, 0x09EC3577, 0xA2251800, 0xFF417CA4,
+0xFF386F98, 0x18305D84, 0x5D7A08F3, 0x5971FF24, 0x4E60FF23, 0x5A6BFF1F, 0xAFBDFF39, 0xF7FFFF99,
+0x002534EB, 0x040004F4, 0x04F80300, 0x2048FE10, 0x5204FC07, 0xFCFFFDFE, 0x002F54FC, 0xCC000278,
+0x0008010A, 0x000C7401, 0x040F1B74, 0x35FFFF00, 0x0F025404, 0x0F050008, 0x61FF04D2, 0x1A01730F,
+0x02041800, 0x30000031, 0xC8FB1309, 0x041C008B, 0x00299500, 0x0AF5051D, 0xA7B5FFF8, 0x546BFF90,
+0x607EFF24, 0x6A8CFF27, 0x6B90FF35, 0x6A8CFF39, 0x00050034, 0x00020F00, 0xFF362005, 0x040009FC,
+0x140C0000, 0x00000400, 0x08001404, 0x19180000, 0x3A769A33, 0x38113718, 0xC8003C20, 0x0F180018,
+0x759805F0, 0x799EFF35, 0x678DFF3F, 0x5B80FF31, 0x5F83FF29, 0x181CFF2F, 0x204E66B3, 0x3E6878FF,
+0xB3D3DEFF, 0xEC004320, 0x31FE1104, 0x073C0284, 0x0000A000, 0x040405AE, 0x00C40000, 0x00000400,
+0xD6020018, 0x00060500, 0x00001300, 0x11050004, 0x00090F00, 0x0F55FFFF, 0x8EFF0518, 0x1105000E,
+0x02A288F8, 0x31000A00, 0xF407F004, 0x3A5769FF, 0x275D77FF, 0x246382FF, 0x376D91FF, 0x366A8FFF,
+0x400EF0FF, 0xFF356D90, 0x040004F8, 0x45F40000, 0x2227F000, 0x1E107195, 0x0004F400, 0x10001410,
+0x141C003C, 0x40231800, 0xFF3A7499, 0x04000A00, 0x23040000, 0x5263FC05, 0x86FF3C78, 0xF01B8461,
+0x2B5D7803, 0x29566DFF, 0x385B6EFF, 0xAFC9D6FF, 0x18FEFFFF, 0x04F80048, 0x0004D802, 0xFA103788,
+0xFE408C70, 0xF7F8FFFF, 0x00A90104, 0x00001C00, 0xFE300004, 0x1B38FDFF, 0x1032B000, 0x021642FE,
+0xCB0028C4, 0x0004040F, 0x00002F01, 0x040400D7, 0x05070F00, 0x03000F4C, 0x00180405, 0x4C007F0F,
+0x0E005F0F, 0x0F008804, 0x0F650008, 0x0F0D00A1, 0x0F0D0098, 0x04050040, 0x200F0038, 0x180F0500,
+0x05F7FF00, 0xFE110408, 0xFC328686, 0xB068F7FF, 0xF1001800, 0xFFFCFF07, 0xFFBFD1E5, 0xFF294E68,
+0xFF2A637E, 0xFF2A6988, 0xE0336B8E, 0xF08F104F, 0x376F2F3B, 0x00020500, 0x95221DEC, 0x60141073,
+0xFF3B7195, 0x41087096, 0x0CFF3A20, 0x04FC051E, 0x08387821, 0x729A7150, 0x6187FF37, 0xF126E027,
+0x2C5E7702, 0x224B5FFF, 0x6C8C99FF, 0xF1FFFFFF, 0x0ED4FFFF, 0x20199002, 0x5218FCFD, 0x7F0CFD11,
+0x0004F700, 0x7C0004FC, 0x02E8005A, 0x058E4501, 0xDA0204D9, 0x04F00402, 0x0500080C, 0xE0000027,
+0x00040000, 0x0F002F02, 0xFFFF0006, 0x02A00048, 0x000CAC00, 0x0C000004, 0x02690F00, 0x04007FFF,
+0x54E40304, 0x02190000, 0xF9118684, 0x04F1428C, 0xFFF5FCFF, 0xFF58768E, 0xFF2F5E7C, 0xFF2D6684,
+0xC8326F8E, 0x6E937129, 0x698DFF36, 0x220A0433, 0x05046D93, 0x356F9531, 0x96314AF8, 0x54E43371,
+0x0054EC00, 0x984009F8, 0x04FF3C72, 0x729B7100, 0x729AFF3B, 0x00321038, 0x99B10EF4, 0x95FF3676,
+0x8FFF3171, 0x05002866, 0x2A5D7AB1, 0x2B5466FF, 0xBAD2DEFF, 0xF0014D0C, 0xFFFB3004, 0x004680FF,
+0x880204C4, 0x611C001E, 0x0B911403, 0x5C000249, 0x02640002, 0x003CB000, 0x0404254F, 0x003C0000,
+0x0B000408, 0x0F0F0037, 0x68FFFF00, 0x0002B000, 0x810F0004, 0x016EFF02, 0x00030F00, 0x2E700105,
+0xF04ADC00, 0xFFF8FF04, 0xFFF7FBFC, 0xFFE9F7FF, 0xFF29506D, 0xFF2F6388, 0x8F713070, 0x8FFF366E,
+0x0504306A, 0x010EDC00, 0x000F1900, 0xE0000005, 0x1E08005E, 0x396F9331, 0x00F109FC, 0xFF3B7098,
+0xFF39729D, 0xFF35739C, 0xF834739C, 0x7194713B, 0x6788FF32, 0xB52A3028, 0xFF2B5E7D, 0xFF345D73,
+0xFCDEFAFF, 0x09DC0004, 0x34FCFA22, 0x0ECA0191, 0x04891801, 0x020018E0, 0x2A3C000A, 0x0EF0FC11,
+0x08024808, 0x0C0C04EC, 0x026C0F00, 0x800F6EFF, 0x84FFFF01, 0x000A0004, 0xA1000008, 0x64FC1002,
+0x13700004, 0xAEFFF751, 0x09FC88A3, 0x648B00F1, 0x698EFF2D, 0x6C8FFF37, 0x6D92FF3A, 0x00050035,
+0x8F1040F4, 0x0800140C, 0x0504011E, 0x240A0004, 0x0500FF35, 0x3A709431, 0x97B10500, 0x9EFF356F,
+0x9FFF3572, 0x22EC3574, 0xE036F800, 0xFF2B6789, 0xFF2C6582, 0xFF2E6077, 0x2F10677A, 0x118E0400,
+0x0109F1F7, 0x0A015570, 0x00910070, 0x00009900, 0x040004F0, 0x009C0000, 0x00000400, 0x1600000C,
+0x001C0005, 0x00000404, 0x040F002C, 0x34041500, 0x00080000, 0x1500340F, 0xFF00280F, 0x00C7FFFF,
+0x04040403, 0x0E350000, 0x01222000, 0x07F040EC, 0x5B6BFFEE, 0x6282FF37, 0x678DFF2D, 0x6890FF2D,
+0x6A90FF38, 0x13F8FF3A, 0x326D8F31, 0x000445F4, 0x00080005, 0x00370800, 0x040059F8, 0x71972019,
+0x39204B00, 0x710500FF, 0xFF3C739A, 0xFC3C779F, 0x749E3104, 0x00050033, 0x81953944, 0x77FF2A63,
+0x74FF3060, 0xF44004FC, 0x64FDFFFF, 0x18B40250, 0x0233FE00, 0xD800784C, 0x00040018, 0x0004F400,
+0x0C000004, 0x23AE0000, 0x02647A02, 0xC1000F18, 0x04A00F00, 0x002C0015, 0x0F000408, 0x0F150038,
+0xFFFF0028, 0x7404C6FF, 0x79700151, 0x00041700, 0xFEA195B1, 0xCEDBFFF4, 0x596DFFAE, 0x313DC82A,
+0x00326A8F, 0x68913105, 0x3231F83B, 0x04346C8D, 0x376D6119, 0x386D8DFF, 0x0404280C, 0xFC98101E,
+0x05000431, 0x31500C00, 0xF4FF326C, 0x3071212C, 0x03F05EEC, 0xFF2C6C92, 0xFF31698C, 0xFF346583,
+0xFF395C70, 0x8C14FFFF, 0x0004F800, 0x40000A74, 0x09E00278, 0x043C7401, 0xB5010F9D, 0x04800218,
+0x000ED400, 0x2E005F8C, 0x00360000, 0x00050006, 0x040F00BD, 0x58022100, 0x00060F00, 0xE4FFFFFF,
+0x04044C00, 0x00010004, 0x0E790004, 0x0960FC10, 0x92FFF4D1, 0x81FF557E, 0x8AFF3068, 0x3BEC316C,
+0x040A0000, 0xF8000500, 0x6C8E3131, 0x2204F836, 0x05046C8C, 0x62050004, 0xFF377199, 0x13F87097,
+0x00190000, 0xF00027F4, 0x9D08F118, 0x97FF3276, 0x8EFF2E6F, 0x85FF2E6A, 0x69FF3366, 0xFFFF2A4F,
+0x0EE6DCF3, 0x15A52000, 0x0213E0F9, 0xD8020500, 0x1DFC0204, 0x0004FF00, 0xF80000A8, 0x00040004,
+0x00230000, 0x040004FC, 0x00B80100, 0x0F002100, 0x02260004, 0x060F0042, 0xFFFFFF00, 0x045400E4,
+0x02000404, 0x60007E70, 0xF802F11D, 0xD9EEFFFF, 0x295B74FF, 0x2A6A86FF, 0x316C8CFF, 0x00012CEC,
+0x39693005, 0x3104F0FF, 0xEC366D8C, 0x63F00063, 0x22001000, 0x1E046E8D, 0xB109FC00, 0xFF396F9B,
+0xFF397099, 0xEC396F95, 0x9100F151, 0x96FF3170, 0x99FF3274, 0x93FF3074, 0x49102F6F, 0x2A546D71,
+0xADC8DBFF, 0x58004B50, 0x0ED60055, 0x20008800, 0x09D6F8F8, 0xFCFFFE31, 0x58005F6C, 0x27D000AF,
+0x00190402, 0x040004EC, 0x002C0000, 0x00000400, 0x040005AB, 0x04B80F00, 0xE4FFFFFF, 0x3903F40F,
+0x005EDC00, 0x8000047C, 0x13520260, 0xB4FFF5D3, 0x81FF81A0, 0x96FF2C63, 0x05003373, 0x19003512,
+0xFF386A30, 0x040004FC, 0x04FC0000, 0x00000400, 0x00000500, 0x6E954014, 0x0500FF37, 0x386E9A31,
+0xF40036C4, 0x0A000027, 0x347394C0, 0x357797FF, 0x2B6F92FF, 0x72050CFF, 0xFF316280, 0xE0688BA1,
+0x14680127, 0xA1ECFC11, 0x0109BF0F, 0x00009800, 0xF40004E4, 0x00040109, 0x04329300, 0xEB0800FD,
+0x0014040E, 0xFF00080F, 0x24FFFFFF, 0x0222F400, 0x6C0081C4, 0x0E7C000E, 0x74FFECC0, 0x8EFF395F,
+0x93FF336E, 0x1168D870, 0x3536F430, 0xFC37698C, 0x14000113, 0x04376B21, 0x1400020A, 0x00FF3720,
+0x6E994105, 0x0500FF35, 0xFF396E50, 0x40C46F94, 0xFF390BF0, 0xFF2F6E8D, 0xFF367898, 0xFF2C7190,
+0xFF2D6A87, 0xFF2B5971, 0xFFEAFFFF, 0xF404285C, 0x27B80004, 0x1978FF11, 0x3BB4FF11, 0xFBFBFB32,
+0xD00F2880, 0xFD000604, 0x0FA80004, 0x00000400, 0x040F00B8, 0x3C0B0000, 0x054C0100, 0x08054003,
+0x270B000C, 0x000F0F00, 0xA9FFFFFF, 0x0203D404, 0x200003C1, 0x00040404, 0x0A1D5002, 0x26020020,
+0x00060000, 0x00224600, 0x4402136C, 0xF802F127, 0xAAC7D9FF, 0x32607AFF, 0x377395FF, 0x2D6D91FF,
+0xEC0027F0, 0x698A313B, 0x007CDC37, 0x00000F10, 0x0090101E, 0x396B2305, 0x37601900, 0x346E96FF,
+0x500500FF, 0xFF396E98, 0x12000496, 0x007CF071, 0x903190F0, 0x0508306F, 0x2F657F73, 0x99BCCFFF,
+0xC8003BCC, 0x04B8033B, 0x00009D00, 0xFC01008D, 0x0009005B, 0x02000402, 0xC8060094, 0x05300100,
+0x00000501, 0xFC000014, 0x00040004, 0x03000C00, 0x0B000048, 0x00040400, 0x09004301, 0xC201000D,
+0x003F0069, 0x00006F01, 0x2401001B, 0x00050F00, 0x380029FF, 0x0004002A, 0x05014300, 0x09000150,
+0x00040000, 0x0F001500, 0x00D00004, 0x040000EB, 0x00EB0500, 0x0C000D00, 0x1D050004, 0x00090F00,
+0x6B0340FF, 0x0E200101, 0x01000C00, 0x18000162, 0x09CC0004, 0x00C26000, 0x660045D6, 0x00040213,
+0x0003FC05, 0x0400002C, 0x00300100, 0x0036FC00, 0xF351001A, 0x5A7F99FF, 0xAC0018F0, 0x6C93C454,
+0x6A8DFF2E, 0x698BFF32, 0x0500FF33, 0x5BCC9011, 0x8EFF3430, 0x6B614104, 0x6C8BFF3A, 0x40190839,
+0xFF346F99, 0xF8000004, 0x22F80013, 0x20280400, 0x4AFC7297, 0x4FC43711, 0x386E90A0, 0x406A82FF,
+0xF0FFFFFF, 0x13C2006F, 0x0104B403, 0x050F0080, 0xBD002100, 0x00040700, 0x00000B07, 0xD800004E,
+0xAF88000A, 0x03234402, 0x240041D0, 0x00E70000, 0x00000800, 0x040F0025, 0x44002900, 0x00040000,
+0x0E00440F, 0x0F002500, 0x0C090004, 0x2C0F0041, 0x1C0F0900, 0x800C4100, 0x00100300, 0x10006B0F,
+0x00109C01, 0x54002EA4, 0x00040001, 0x01065D00, 0x8000BCD0, 0x00410002, 0x0001E403, 0x0400001C,
+0x00130000, 0x01053004, 0x7E02002C, 0x001B0007, 0x0300040C, 0x9B00001F, 0x00040207, 0x02009703,
+0x4903000D, 0x00250D00, 0x0F00180F, 0x00021802, 0x2C040078, 0x00590300, 0x0F000F04, 0x030D0008,
+0x0701002F, 0x00CC0000, 0x0400B904, 0x00010011, 0x02E00001, 0x04010400, 0x55040004, 0x00250100,
+0x0300C302, 0x070F000B, 0x0033FF00, 0xFD304010, 0x1D18FFFF, 0x00015002, 0x00000178, 0x924C0205,
+0x11183800, 0x02C964F8, 0x24010A0C, 0x01930300, 0x010E7C01, 0xFBD10248, 0xD8EEF9FF, 0x31607EFF,
+0x346F97FF, 0x8B2036A8, 0x52615466, 0x6989FF32, 0x1009FC34, 0x302CFC6A, 0x0091FF34, 0x376B4023,
+0x0A008CFF, 0xFF3B6C61, 0xFC396D92, 0x05000004, 0x00411800, 0x95716E0C, 0x98FF3372, 0x22FC3172,
+0x7140FC00, 0xFF326081, 0xE0A1C2D5, 0xB0D80031, 0x01197002, 0x050F008A, 0xC9032C00, 0x00070300,
+0x0200CB00, 0x42000293, 0x02880028, 0x00000400, 0xFD0719D8, 0x002C000E, 0x05007601, 0x0E010009,
+0x00050F00, 0x003B001A, 0x0F000400, 0x04120035, 0x080C0029, 0x003D0F00, 0x00280C05, 0x4500100F,
+0x0500800F, 0x0004B803, 0x040F0077, 0x00010800, 0xCA000005, 0x00017100, 0x7D000028, 0x04000101,
+0x01028000, 0x71020011, 0x00200002, 0x00000400, 0xF2010430, 0x0078001F, 0x00002000, 0x76020488,
+0x001F0016, 0x01000404, 0x1F020047, 0x042C0200, 0x00000C00, 0x04010033, 0x000D0000, 0x0100040F,
+0x00001D00, 0x080F0018, 0x64020B00, 0x00780200, 0x00000C00, 0x0401002E, 0x003B0000, 0x1100040F,
+0x03002D01, 0xD0000005, 0x00340400, 0x00001301, 0x040400F8, 0x00190400, 0x0B00080B, 0x3701000F,
+0x00050F00, 0x000431FF, 0x01D4020A, 0x03016500, 0x700003F8, 0x05200002, 0x0101AC00, 0x1C000168,
+0x01A40000, 0x02020406, 0x02F181D4, 0x9FB3FFF4, 0x698BFF80, 0x7AA1FF34, 0x6D92FF3C, 0x0009FC31,
+0x040004FC, 0x8BD80000, 0x004AFC00, 0x040004FC, 0x46040000, 0x006DFC00, 0x14003214, 0x31E40046,
+0x00000400, 0x10000500, 0x05000055, 0x32729631, 0x0C004FE4, 0x6A857137, 0xFFFFFF3E, 0x000500E9,
+0xF0010784, 0x008B0013, 0x0F009401, 0x00230005, 0xE60000EC, 0x05E00000, 0x01000400, 0xF0000104,
+0x04EB0100, 0x0000E400, 0x0800001E, 0x00FD0300, 0x00003100, 0x100003B0, 0x00280501, 0x00010800,
+0x080A0089, 0x00A40000, 0x0A000402, 0x430303C3, 0x0F4C0100, 0x00000C08, 0x100803B4, 0x000C0F00,
+0x0182009D, 0x1D00B40F, 0x02003400, 0x640004A1, 0x00040401, 0x02014800, 0x7E0004D4, 0x01180001,
+0x01000401, 0x18040194, 0x01700200, 0x04003C00, 0x4C020074, 0x00060F00, 0x00530028, 0x03003F00,
+0x58040008, 0x00080F00, 0x003B0015, 0x04002C00, 0x0C000008, 0x00040F00, 0x00C40011, 0x000C6402,
+0x680F0100, 0x7B05000C, 0x01180002, 0x03000400, 0x18000250, 0x00AC0000, 0x00000400, 0x040F0075,
+0x0027FF00, 0xFE110141, 0x0000CC5C, 0x01B40004, 0x02014B02, 0x7C000018, 0x07A80002, 0x02000800,
+0x960001AC, 0x00040002, 0x04092000, 0x2C000A34, 0xFFEA910A, 0xFF34607B, 0x9C40779E, 0x8B00F154,
+0x89FF2C66, 0x87FF336A, 0x88FF3568, 0x0A003669, 0x0081E400, 0x91323200, 0x3208356B, 0x21000800,
+0x2D0C366A, 0x366D9631, 0x00041904, 0x1DF80005, 0x0059F400, 0x40005EDC, 0xA7BF202D, 0xE400A1E0,
+0xA5200097, 0x03022C00, 0xAD020311, 0x00060F00, 0x00EC0022, 0x0004F800, 0x08002336, 0x00040000,
+0x0000DA00, 0x94020018, 0x000E0002, 0x03006C00, 0x19000298, 0x02780000, 0x0004FC03, 0xE40255EC,
+0x012C0204, 0x00000C00, 0x080A0124, 0x02B00200, 0x0000A100, 0x080F003F, 0x58030600, 0x01680000,
+0x0B002801, 0x14000010, 0x00040F00, 0x00380F09, 0x00180F05, 0x00540F0D, 0x001C0F09, 0x00E80F29,
+0x01B70906, 0x00013800, 0x0400023C, 0x016C0400, 0x0404E402, 0x84000194, 0x004C0200, 0x0003FC00,
+0x040233B8, 0x01680000, 0x06000402, 0x10020160, 0x00540000, 0x00000404, 0x040F003A, 0x2B040C00,
+0x00080F00, 0x007C0100, 0x0C01880B, 0x24000150, 0x00040F00, 0x00860011, 0x08002800, 0xB0020008,
+0x00F80000, 0x00010000, 0x1D030268, 0x000B0001, 0x03000400, 0x3800076C, 0x00260000, 0x00000409,
+0xB4040098, 0x00550000, 0xFF00040F, 0x01410023, 0x02016900, 0x600045BA, 0x016C0001, 0x0501E400,
+0x2300014F, 0x00040000, 0x00001101, 0xAC00002C, 0x00040001, 0x31050000, 0x64F9FFFE, 0xFFF55131,
+0xF0A4C9E3, 0x7AA3B109, 0x6B94FF3C, 0x688BFF2C, 0x6204F830, 0xFF386785, 0x18FC6886, 0x04050004,
+0x08000504, 0x050C000A, 0x103C1400, 0x218BFC94, 0x4614386D, 0x000A0000, 0xE0009FF4, 0x76A2B354,
+0x688EFF36, 0xEFFFFF32, 0x2031ECD2, 0x0302FFF8, 0x01008F00, 0x0900007B, 0x00040F00, 0x00EC0024,
+0x0004C400, 0xFC050F50, 0x004C0500, 0x0000EC00, 0xFD000004, 0x05000300, 0x00000B03, 0x1C000038,
+0xED440214, 0x01001503, 0x0C0F0135, 0x75052500, 0x00090F00, 0x00F80FA4, 0x01600025, 0x00024C00,
+0x0C000004, 0x04CC0200, 0x00068800, 0x04000500, 0x01980400, 0x00065400, 0xE4020004, 0x002C00F4,
+0x04007404, 0x10040133, 0x00080000, 0x00002000, 0x0C000004, 0x00200200, 0x0201B402, 0x0C000060,
+0x01AF0500, 0x0F001F02, 0x00380006, 0x040F0074, 0xA4001500, 0x00FC0000, 0x03000400, 0x9D000264,
+0xBCFB1000, 0x0004032A, 0x05050400, 0x1C020770, 0x01140106, 0xFF05000F, 0x0177003D, 0x05000404,
+0xC708021C, 0x00150101, 0x00017A00, 0x040001AC, 0x07900200, 0x51092802, 0x7A9AFFF0, 0x00BD5849,
+0x04F1BD54, 0xFF2D6B92, 0xFF316789, 0xFF386987, 0xFF386783, 0x00396884, 0x6DF4000A, 0x0004FC00,
+0xFC010004, 0x346C3004, 0x044B0CFF, 0x94400500, 0xE8FF386E, 0x46280018, 0x005EF000, 0xA072B8CC,
+0x9EFF3474, 0x7EEC497B, 0x12465C01, 0x099144F9, 0xBF0F009C, 0x490F2902, 0x13000000, 0x00F00100,
+0x00029403, 0x04040010, 0x006B0100, 0x00000D00, 0x0400010C, 0x000C0000, 0x0F001501, 0x04180005,
+0x08000034, 0x00040400, 0x18003F0F, 0x96002B0F, 0x0000DC00, 0x080F00AD, 0x04000900, 0x00040004,
+0x00D3E802, 0x00040C84, 0x00080005, 0x00029400, 0x04000042, 0x05000000, 0x02000404, 0x5804093C,
+0x001E0000, 0x00000C00, 0x4C000004, 0x00040800, 0x0004F406, 0x0400004C, 0x01DB0400, 0x00000801,
+0x040F003B, 0x73002900, 0x00040400, 0x1E00480F, 0x02003900, 0x980000AC, 0x00FC0000, 0x009AB700,
+0xCB000004, 0x20CF006D, 0x000D7C00, 0x040C001C, 0x00BC0100, 0x0F003F00, 0x0F1E0074, 0x00F90031,
+0x80020141, 0x01160001, 0x00016409, 0x0404001B, 0x001D0000, 0x00169801, 0x040203F0, 0x002C0200,
+0x51003C00, 0xEDFCFFF4, 0x0045D8CD, 0x9B319594, 0x7A383372, 0x32678971, 0x356684FF, 0x863104FC,
+0x14183968, 0x0854FC00, 0xF8000504, 0x05000004, 0x356C9340, 0x005008FF, 0x10001908, 0x0A000028,
+0x006DF400, 0x9B71A6E8, 0xCDFF3472, 0x22F481AE, 0x0102FC00, 0x00000702, 0x009C04E6, 0x01000800,
+0x050F00A0, 0x41002500, 0x00040700, 0x05000B07, 0xED020264, 0x03730700, 0x00002500, 0x0C000604,
+0x17EC0F01, 0x004C0513, 0x00003B00, 0x080400AB, 0x000C0000, 0x1900040F, 0x08003800, 0x3C0F0004,
+0x2C0F1900, 0x1B044000, 0x00080401, 0x0600E80F, 0x0000B400, 0x08080080, 0x000C0000, 0x0008C803,
+0x040003F4, 0x1B840000, 0x0004F800, 0x71020B98, 0x01600B01, 0x08004400, 0x44000004, 0x00100100,
+0x00000900, 0x94000004, 0x00040802, 0x00050007, 0x2C00006C, 0x00270000, 0x00000800, 0x0C000004,
+0x00040F00, 0x001C0001, 0x0D00040F, 0x08005000, 0xBF030004, 0x010C000E, 0x0F010809, 0x07010060,
+0x30000014, 0x04FC0000, 0x034DB401, 0x5A001C68, 0x00180002, 0x04008301, 0x0D09002C, 0x00150900,
+0x0F001A01, 0x24FF0005, 0x0001480A, 0x04080174, 0x01C80100, 0x08015901, 0x82040254, 0x01A6000E,
+0xD4FCEE11, 0x006DAC00, 0x9671BD3C, 0x87FF336E, 0x09F02C64, 0x376A8933, 0x37110500, 0xFC002304,
+0x05000522, 0x0013F803, 0x92710504, 0x92FF346B, 0x1E08366C, 0x146E8E22, 0x6DCC0073, 0x3A7EA5B1,
+0x316B91FF, 0xBBE3FDFF, 0x6E0018F8, 0x007A0200, 0x59B3FE11, 0x2D0F000F, 0x0500D701, 0x090400FF,
+0x00080400, 0x01037802, 0x84000780, 0x0004000C, 0x00001B05, 0x10040009, 0x00280201, 0x00012801,
+0x040F0017, 0x75010D00, 0x00050C00, 0x0100350F, 0x00002400, 0x08080018, 0x000C0000, 0x0100040F,
+0x0F002800, 0x000D0004, 0x24000038, 0x00080C00, 0x0F001400, 0x02250004, 0x300D00FC, 0x004F0002,
+0x0F006700, 0x000D0004, 0x04030028, 0x08F00000, 0x12040001, 0x022568FF, 0xF2020C58, 0x015C0D01,
+0x03005804, 0x2001003C, 0x00140100, 0x04001104, 0xA400019C, 0x0732010C, 0x016B8600, 0x27011A74,
+0x00050100, 0x01002C04, 0x050F000D, 0x24000400, 0x001B0000, 0x00000808, 0x0404000C, 0x055C0300,
+0x0F050400, 0x000504FC, 0x0400003F, 0x00330400, 0x0300080C, 0x0004001C, 0x0FF40005, 0x00060000,
+0x04021160, 0x00310001, 0x00016802, 0x1402002B, 0x00E00606, 0x0F001402, 0x38FF0006, 0x0002CC00,
+0x04000276, 0x000C0000, 0x00024200, 0x78020004, 0xFFFE2001, 0x180022F0, 0x01B00000, 0xA19FC801,
+0x8DFFE7FF, 0xA3FF3B6E, 0xBA9C3B7A, 0x2F658931, 0xF40040A0, 0x84C8001D, 0x36678531, 0xF0001408,
+0x05000059, 0x00000400, 0x8D310504, 0x3200386A, 0x01500800, 0x6B300A04, 0x2D14FF36, 0x3A6D8C40,
+0x040F00FF, 0x2400CA0C, 0xFFFF201E, 0xF822A6E0, 0x030218FF, 0x7400286C, 0x4B700002, 0x2801FB0F,
+0x0000C800, 0x780004E0, 0x8E340003, 0x00055C02, 0xDC0014D8, 0x7F440409, 0x0002E407, 0x3500028B,
+0x00080000, 0x07000404, 0x70000080, 0x0004002D, 0x07001307, 0x31043288, 0x00080800, 0x0F02C804,
+0x00010008, 0x18000028, 0x00080800, 0x08000C00, 0x20000004, 0x00040F00, 0x00380015, 0x06002C00,
+0xF0040008, 0x03680200, 0x0F001C00, 0x00210004, 0xF2090050, 0x03AD0300, 0x00001800, 0x310B1040,
+0x06B50001, 0x01000400, 0x240004B5, 0x026A0000, 0xFDFFFC40, 0x40025CF9, 0xFCF8FFFF, 0x94001556,
+0x040A00F1, 0x05018802, 0x2F00002B, 0x00040000, 0x00006F00, 0x5B030008, 0x00070000, 0x04001300,
+0x080402A4, 0x00180000, 0x00005E00, 0xF7130004, 0x1C029A1C, 0x024A0000, 0x00005C00, 0xF4000004,
+0x004D0000, 0x08025802, 0x180202EC, 0x001C0001, 0x00002404, 0x040C0008, 0x00200000, 0x00007E00,
+0x040F0008, 0xF0080400, 0x34A80300, 0x00022802, 0x84000030, 0x5C940000, 0x313EA802, 0xCCFDFCF7,
+0x010600EF, 0x0005BA02, 0x53030070, 0x00670001, 0x00010D01, 0x3C000014, 0x00040000, 0x0F001501,
+0x28FF0005, 0x00014300, 0x42030004, 0x02340801, 0x000E7002, 0xFA135924, 0xA4028350, 0x04340011,
+0x9001D301, 0xDFFFF3FF, 0x9AFF9CC6, 0x51D13475, 0x6F96FF42, 0x0004FC31, 0x88620EF8, 0x8AFF3368,
+0x221E0068, 0x5EF06889, 0x0004FC00, 0x00000004, 0x0C8B1005, 0x396B213C, 0xFC005008, 0x0F040086,
+0x00B3F800, 0x00000500, 0x80AB200F, 0x3880BAF4, 0x5481A0FF, 0xB4FFFFFF, 0x00F91172, 0x02CC0005,
+0x013C7400, 0xB8070207, 0x00BF0300, 0x1A00070F, 0x2200EC00, 0x0278FAF7, 0x0002F802, 0x5800028C,
+0x2D640084, 0xF7FFF1D2, 0xFAFFE0F3, 0xFAFFE2F3, 0x0004E4F3, 0xFFE5F243, 0xFC0004FB, 0xE5F1FD03,
+0xE4F2FDFF, 0xE5F3FCFF, 0xE3F4FBFF, 0x08F4FBFF, 0x00140000, 0xA7000402, 0xFFE3F4FC, 0xFFE4F5FD,
+0x0008F6FD, 0xFFE3F661, 0x04E4F7FE, 0x08FD1300, 0x00100100, 0xFFE5F647, 0x100004FE, 0x300038FF,
+0x08FFE4F5, 0x00040C00, 0x40005001, 0xFCFFE3F6, 0x080F0058, 0xF5430500, 0x44FCFFE4, 0x00080C00,
+0x03009405, 0x50040040, 0x00080F00, 0x00DC0019, 0x00010000, 0x04050008, 0xE2F52100, 0x4800C68C,
+0xF6FF2300, 0x640400E4, 0xE4F52100, 0xFDA000E0, 0xFFFFE5F6, 0xFDFFE5F6, 0x0247C4EF, 0xFD207BD4,
+0x002F70FB, 0x9A000476, 0x04140001, 0x034CD000, 0xEC00297C, 0x00040001, 0x0001E204, 0x04000023,
+0x00040007, 0x05001400, 0x0902001C, 0x001F0000, 0x10022C00, 0x03A780F8, 0xE40224B0, 0x74F40001,
+0xD5000400, 0xFEFFFFF2, 0xEEF6FFEC, 0xEDF4FFDD, 0x400004DC, 0xFFDDEEF5, 0xF7B90004, 0xF7FFDEEF,
+0xF9FFDFF0, 0x0004E0F1, 0x0214FA11, 0xFCFFE040, 0x02021CF2, 0xFA80001C, 0xFBFFE1F2, 0x1CFFE1F4,
+0x00080000, 0xE2F4FE44, 0x220004FF, 0x001CF3FD, 0x01010C00, 0x00030170, 0xF5FC3101, 0x020214E6,
+0xF21902DC, 0xFC0052BC, 0xFEFC200F, 0xC2000600, 0x00D00200, 0x0002F000, 0x940200D4, 0x00140303,
+0x0F00F800, 0x2EFF0004, 0x00014B00, 0x48030004, 0x01640001, 0x00017600, 0x84020168, 0x0294000B,
+0x0694FC11, 0x0009F400, 0xFC010004, 0x0CB10004, 0xFFF0FF70, 0xFF5284A5, 0xAA319550, 0x0EF84583,
+0x3104FC00, 0xF4376684, 0x1404002C, 0x35678A54, 0x05008BFF, 0xFF346A34, 0x8A710500, 0x8AFF396A,
+0x8DDC386B, 0x3105000C, 0x08367193, 0xCEE800AC, 0x78A0B933, 0xD00040EC, 0x071202E2, 0x011DB000,
+0xB8070084, 0x00BF0300, 0x1B00070F, 0x00004000, 0xF500074B, 0x0D220100, 0xFFEF0AF5, 0xFFC7E3EF,
+0xFF7BA0B0, 0xFF558093, 0xFF5D8A9F, 0xFF5C8AA1, 0x045B8BA1, 0x8CA27300, 0x8BA2FF5C, 0xF600045D,
+0xA2FF5E02, 0xA3FF5E8B, 0xA4FF5F8C, 0xA4FF628C, 0x0008608D, 0x18608D21, 0x8EA5E700, 0x8DA6FF61,
+0x8EA7FF61, 0x8FA7FF62, 0x07FD0008, 0xA8FF618F, 0xA8FF6290, 0xA7FF638F, 0xA8FF658F, 0xA9FF658F,
+0x00046690, 0x6692ADBD, 0x6692ABFF, 0x6793AEFF, 0xAFD00004, 0xAEFF6894, 0xADFF6995, 0xAEFF6896,
+0x0BF90004, 0xAFFF6997, 0xAEFF6997, 0xB0FF6997, 0xAFFF6B97, 0xB2FF6B98, 0xB1FF6D99, 0x00086D9A,
+0x6E9BB273, 0x709AB3FF, 0x6E4F0004, 0x049CB4FF, 0xB54C0F00, 0x04FF6F9D, 0x9EB6B100, 0x9DB6FF70,
+0x9EB5FF71, 0x01000871, 0x9EA10010, 0x9FB7FF70, 0x9FB9FF71, 0x76000871, 0xFF6E9CB6, 0x046D9BB3,
+0x6F9C7000, 0x6F9CB3FF, 0x000084FF, 0xB4730098, 0xB4FF709D, 0x01E47EA1, 0x00027A00, 0x9904ECF4,
+0x00100001, 0x0201A100, 0x0E0004BA, 0x02980200, 0x03091003, 0xBF011094, 0x00330001, 0x0001FE07,
+0xAC000014, 0x09EA0002, 0x02003800, 0x0E003EA4, 0xF506F100, 0xEAFEFFFF, 0x7A94A5FF, 0x4A6A7FFF,
+0x476D84FF, 0x456F87FF, 0x22F0D460, 0xFF48728A, 0xFF4A748C, 0xFF4B758D, 0xFF4B7790, 0xFF4C7990,
+0xFF4E7A93, 0xFF4F7B94, 0xFF507C95, 0xFF517D96, 0xFF537F98, 0xFF55819A, 0xFF55839D, 0xA1DE7C9B,
+0xA1FF5987, 0xA3FF5B89, 0x00045C8C, 0x8EA504F1, 0x8FA9FF5E, 0x91ABFF60, 0x92ACFF62, 0x93ADFF63,
+0x00019C65, 0x94000198, 0x00F80001, 0xF2000400, 0x6F99B100, 0x6F9AADFF, 0x6C93A4FF, 0xB8D6E1FF,
+0x3C008BD0, 0x9FC8005D, 0x0418F900, 0xD8001770, 0x05E40000, 0x0005C403, 0xD00000C2, 0x00E00000,
+0x01051400, 0xF8070004, 0x000B0F00, 0x5C002EFF, 0x00040001, 0x00026800, 0xFD11046E, 0x20021D74,
+0x017C0023, 0x02AECC00, 0xF7600C44, 0xCCE8FFFF, 0x00A998FF, 0x9E31D634, 0x94483D79, 0x3104FC00,
+0xF0366583, 0x65874036, 0x0500FF30, 0x34688D40, 0x710004FF, 0xFF33698F, 0x20346A90, 0x008B1437,
+0x05140005, 0x40336E21, 0x14040019, 0x00190000, 0xB4226E00, 0x20CEE483, 0xA1E4B8CD, 0x0027F400,
+0x92000588, 0x00040200, 0x0F68E000, 0x003201FC, 0xA0010249, 0xF41EF291, 0x95B1BDFF, 0x547D91FF,
+0x568AA2FF, 0x568FACFF, 0x5693B2FF, 0x5291B2FF, 0x5192B2FF, 0x5193B3FF, 0x5194B1FF, 0x5293B1FF,
+0x5493B2FF, 0x92E1001C, 0x93B3FF57, 0x94B3FF58, 0x95B4FF57, 0x80000458, 0xFF5995B7, 0xFF5996B5,
+0xB6710008, 0xB8FF5695, 0x00045897, 0x5998BB84, 0x5998B9FF, 0x400008FF, 0xFF5A99BC, 0xBD750004,
+0xBDFF5D99, 0x00045E98, 0x5F99BE44, 0x750004FF, 0xFF5E9ABF, 0x045F9BC0, 0x9CC14000, 0x0004FF60,
+0x619CC440, 0x000004FF, 0xF000BD1C, 0x00040099, 0x009F2400, 0x38080004, 0xA4D401DB, 0x03A4D800,
+0xDC010004, 0x64A029A4, 0x7C00DBE4, 0xA98400C2, 0x05000404, 0xF803AE98, 0xA9A804D6, 0x00A9C408,
+0x0404AECC, 0xA8CB4400, 0x0004FF69, 0x6AA9CC71, 0x69A9CCFF, 0x06F30004, 0xFF6AAACE, 0xFF6AAACD,
+0xFF6BABCF, 0xFF6BABCE, 0xFF6DACCF, 0x400004CD, 0xFF6EABCA, 0x00F30004, 0xFF70ABC9, 0xFF6EA7C2,
+0xFF6F9EB2, 0x98C2D9E7, 0x04EC027E, 0x020A0600, 0xA6020004, 0x027C000F, 0x0206F800, 0x58002300,
+0x0504020F, 0x000C8C00, 0xF80801C3, 0x00100003, 0x00001800, 0xF7240500, 0x000050FA, 0x02F1DB14,
+0xFAFFFFF3, 0x6575FFE6, 0x6B83FF48, 0x7693FF47, 0xF1CF5849, 0x417C9E08, 0x427D9FFF, 0x447FA1FF,
+0x4680A5FF, 0x4783A7FF, 0x4884A8FF, 0xAA310004, 0xE3484A86, 0x3488AD22, 0x8CB1E2E3, 0x8EB3FF50,
+0x90B5FF50, 0x91B6FF52, 0xBA10E2A4, 0x9921DD84, 0x009B5C57, 0xC032E090, 0xD2AC5B9D, 0x545EA022,
+0xAFE000AB, 0x21B9E400, 0xBA2065A4, 0x00C41800, 0xC9B3BF28, 0xBDFF73AC, 0xABFF75A8, 0x4DCC769B,
+0x00D1B803, 0x600104F4, 0x00E80308, 0x03F7FC04, 0x0C000122, 0x00DC0001, 0x0F00E400, 0x08320304,
+0x0C0F013D, 0x6D00DE00, 0x00F50201, 0x00023800, 0x00000158, 0x04E40205, 0x02000A00, 0x18000004,
+0x70F91000, 0x002B0107, 0xF00E2800, 0xBEFFEE05, 0xA9FF789F, 0xB1FF3F7E, 0x90FF4084, 0x84FF316B,
+0x51990063, 0x6585FF35, 0x399CA834, 0x00336588, 0x05040005, 0x31000400, 0x2035698E, 0x0F040105,
+0x04346A22, 0x1900000F, 0x820C6C12, 0x0027F800, 0xD000C538, 0xCDDF33A4, 0x00F400B0, 0x8C001398,
+0x02D0033C, 0x0600AD00, 0x960100BB, 0x00050F00, 0x0041001F, 0xF300E000, 0xC0FFF51E, 0x81FF9EB9,
+0x9CFF4D75, 0xA4FF5387, 0xA6FF4B88, 0x9DFF4586, 0xA3FF3677, 0xA4FF3C7D, 0xA2FF3D7E, 0xA3FF3D7F,
+0xA2FF3E80, 0x9D943F7F, 0xA3FF4440, 0x5503307E, 0x82A5FF42, 0xF1000440, 0x4182A804, 0x4183A6FF,
+0x4283A9FF, 0x4084A9FF, 0x4185AAFF, 0xEC000004, 0x86AB449D, 0x0008FF42, 0x4387AEB5, 0x4488AFFF,
+0x4687AFFF, 0xB0B10004, 0xB0FF4788, 0xB1FF4589, 0x0004468A, 0x40A07004, 0xFF458AB3, 0xB4400004,
+0x04FF468B, 0xA06C0400, 0x409E7800, 0xFF478FB7, 0xB4000004, 0x000400DF, 0x25DFC401, 0xDFD44991,
+0x049EB400, 0xEC000004, 0x000400DF, 0x00DC5800, 0x80000004, 0x9EE400A0, 0x00000404, 0x04089EF4,
+0x9F100000, 0x049F1800, 0x98010004, 0x609810A0, 0xD16804CC, 0x00000808, 0x54110018, 0x8800CC84,
+0x9BC381CC, 0x9CC2FF53, 0xA994FF54, 0xAC559A21, 0x9ABF40AE, 0x9F74FF56, 0x98BB08F1, 0x9CBFFF56,
+0xA1C1FF5A, 0xA5C1FF60, 0x98ADFF65, 0xEEFAFF65, 0x0401E8D6, 0xF8201660, 0x001088F6, 0xF00209FC,
+0x03F40006, 0x06050006, 0x07000F14, 0x00040002, 0x0001FC02, 0xB00601D0, 0x02B40015, 0x2001DE00,
+0x003EFCFB, 0xF102B400, 0x87FFF106, 0x86FF5A77, 0x90FF4770, 0xA0FF4172, 0xAEFF457D, 0x01744888,
+0x00017800, 0x74000004, 0x89B24401, 0x0004FF44, 0x00017800, 0xB4310004, 0xE100458A, 0x209FDC02,
+0xE110FF44, 0xF1018000, 0x448CB404, 0x458DB5FF, 0x458EB7FF, 0x448DB6FF, 0x438CB5FF, 0x10000008,
+0x00040100, 0x468D17F3, 0x468EB6FF, 0x498EB5FF, 0x498FB3FF, 0x4B8FB2FF, 0x498BAEFF, 0x589ABCFF,
+0x67A4C1FF, 0x6CA3B8FF, 0x8BB2C1FF, 0x94003ED8, 0xDCFF116B, 0x00FF141B, 0x00DD0005, 0x07050009,
+0xEF000304, 0x00040000, 0x0F00FD02, 0x25FF0006, 0x02014100, 0x2C000454, 0x022A0002, 0x02000800,
+0x80000500, 0x000E0002, 0x3220FB11, 0x000FF810, 0x00016601, 0xDFD10990, 0x427497FF, 0x4386B1FF,
+0x3E83ADFF, 0x82310EFC, 0x13F42F61, 0x34668990, 0x336485FF, 0x2CF889FF, 0xFF356761, 0x0033678C,
+0x04FC000A, 0x36688D3A, 0x6B314B10, 0x4B10FF35, 0x31050003, 0xD0346E94, 0xC2500090, 0x33E5C400,
+0x12C3DDEC, 0xD6FC111C, 0x13FC00A1, 0x01021300, 0xBB0006F8, 0x00900100, 0x2500050F, 0x0200D100,
+0x79600D10, 0x92FF4D6F, 0xA00CDC82, 0x7897FF49, 0x7197FF39, 0xE364FF30, 0x34759F40, 0x009B68FF,
+0x78009B70, 0x5A8C00C3, 0x007D7800, 0x9E31A28C, 0xE16C3B76, 0x408C7401, 0xA0FF3579, 0x7A70C390,
+0x7BA2FF36, 0xBBA8FF36, 0xE3C8A313, 0x367EA6B2, 0x387DA6FF, 0x377FA7FF, 0x7F21E66C, 0x00DECC37,
+0x0404DEE8, 0xBE780000, 0x00000400, 0x1000BE7C, 0x000400AD, 0x00A82000, 0xB144E448, 0x04FF3C87,
+0xA8440100, 0xFF3D8761, 0x043C89B5, 0x87B3B100, 0x89B4FF3A, 0x88B4FF3A, 0x0400043B, 0x7C000018,
+0x000400C1, 0x418BB844, 0x000004FF, 0x0400C380, 0xA8C40000, 0x00000400, 0x0400DFD0, 0x03A80000,
+0x31A5AC00, 0xF4468FB8, 0x90B935E4, 0x01000847, 0x0800E1A0, 0x499030E0, 0x00BE9CFF, 0x9C00A5CC,
+0xBD2C00BE, 0x01000400, 0xB4000010, 0x000400DC, 0x504A9321, 0xAE5800A9, 0x00AAC400, 0x04010008,
+0xAACC0300, 0x40057400, 0xFF4C91B8, 0xAC00A454, 0x9DC0A0AA, 0x9EBAFF5D, 0x94A7FF62, 0xA800A3CC,
+0x0BE4027E, 0x0008D801, 0x980001E1, 0x0DFC000B, 0x022C0007, 0xB8001194, 0x0A000201, 0x0001FA02,
+0x04040209, 0x00120200, 0x00004400, 0x23020500, 0x0045001B, 0xFFF205F0, 0xFFD2E8F3, 0xFF375C6F,
+0xFF3D6F8A, 0xFF437FA1, 0xA4C48DB4, 0xE0E04719, 0x01011000, 0x8C22011C, 0x03E0E842, 0xC8000140,
+0xE0EC00E2, 0x00ABDC00, 0x0400ABE8, 0x01740100, 0x70018C00, 0xB5FF3E88, 0x8CFF3E88, 0xB3D40001,
+0x00000800, 0xE8080004, 0xAF05F0A9, 0xACFF3D86, 0xA7FF3C84, 0xA2FF3B80, 0xBDFF397D, 0x4CFF5498,
+0x9DB260C9, 0xDBEAFF6A, 0xF51175B4, 0xFB106BBC, 0xCB000503, 0x0F000100, 0x0005E803, 0x18030878,
+0x06040423, 0x0100E601, 0x0A010028, 0x00050F00, 0x410025FF, 0x024C0001, 0x02095C00, 0x80001808,
+0x02380025, 0x00015102, 0x1200001C, 0x37200205, 0x021D2800, 0xEFD10C94, 0xA1CAE6FF, 0x407AA0FF,
+0x4487B2FF, 0x86310428, 0x0F002B63, 0xF331AC00, 0x31658A02, 0x366485FF, 0x3A6788FF, 0x36668AFF,
+0x14048CFF, 0x31140800, 0x1037678B, 0x3C0C0014, 0x00321000, 0x080004FC, 0x550C0000, 0x40320C00,
+0xFF326D95, 0x4000BDB4, 0x789D73AE, 0xE6F4FF3C, 0x0002FECF, 0xFE030500, 0x1B44000C, 0x0000BB00,
+0xA9020004, 0x00060F00, 0x00E00024, 0xCAFFF591, 0x7FFFA3BA, 0xC050486B, 0x40779631, 0x6C00AA78,
+0x91640073, 0x3974A071, 0x37759EFF, 0x10003C88, 0x2398000A, 0x35799E71, 0x37789EFF, 0xA131EB60,
+0xC87C3978, 0x00AA7800, 0x8000AA70, 0xA57000B4, 0x00D9A400, 0x8000AF78, 0xB96C00B9, 0x00B98400,
+0xCC00AF6C, 0x000800B1, 0x00E67400, 0x6C002430, 0x000404B9, 0x00C37400, 0xAF400004, 0x04FF3A85,
+0x86B24000, 0x0004FF39, 0x04034C00, 0x7C000004, 0x000405C8, 0xFF388969, 0x043A8BB8, 0xBC940000,
+0x00000400, 0x040ABCA0, 0xE6880300, 0x10CD8400, 0x02B2C88E, 0xBA410004, 0x04FF4590, 0xADEC0000,
+0xADF09112, 0x01B80000, 0x9221AF98, 0x00AE0C47, 0x18000010, 0xB82004B8, 0x01AE3000, 0x9321B838,
+0x00BD444A, 0x0401E548, 0xE1B00400, 0xFF4C9343, 0x00BD64C2, 0x6402BD60, 0xC26800C7, 0xBAFF5052,
+0x00045192, 0xFF5494D0, 0xFF5C97B9, 0xFF5A8CA5, 0xE4B8CDDC, 0x22A0F611, 0x00076400, 0x80027E9C,
+0x0E000607, 0x01001D01, 0x050001F0, 0x01B80000, 0x04000800, 0x10000004, 0x00040000, 0x02001000,
+0x0000020B, 0x00040105, 0x00050101, 0x01F007C4, 0x93A2FFF5, 0x657DFF79, 0x6C8AFF3B, 0x8EB5FF33,
+0x4711E76C, 0xE400C2D8, 0x000401B8, 0x02C2DC03, 0xE800BDE4, 0xC04011B8, 0x014800C9, 0x04C4D000,
+0xF4000004, 0x000404BF, 0x3E88B931, 0xE000E5E8, 0x000400AE, 0xE5F8B813, 0x00000C00, 0x34000500,
+0xBB5C00B1, 0x00ED3400, 0xA780ED58, 0xA6FF3C80, 0xB8FF3F80, 0xA0C173AF, 0x97ABFF68, 0x111BE06E,
+0x0009F8FB, 0xF711036E, 0xB000C2C8, 0x0004000A, 0x03010403, 0x02001400, 0x0B120203, 0x0200F00A,
+0x060F00F6, 0x001EFF00, 0x48000230, 0x13E00601, 0x0005000A, 0x92000738, 0x88FE1101, 0x097801FE,
+0xF0597401, 0xA6FFEB01, 0xAFFF5385, 0xB1FF4786, 0x8DFF4889, 0x11778866, 0x60A7C42E, 0xFF30668C,
+0xA7946489, 0x85FF3A56, 0x05003764, 0x2104F800, 0x0A143767, 0x00050800, 0x08000500, 0x320C001E,
+0x00050004, 0x9531000C, 0xC2B0306E, 0x418BBA40, 0x320500FF, 0xF0D3E9F6, 0x07100331, 0x01080000,
+0x040405AE, 0x01F30F05, 0x00FC002A, 0xB0FFF5E0, 0x81FF859B, 0x91FF4569, 0x6CFF4473, 0x2D740046,
+0x3977A060, 0x70709AFF, 0xFF3A5173, 0x7039749C, 0xA568008C, 0x96649F10, 0x8C347821, 0xED9000ED,
+0x00A57400, 0x0002F068, 0x9C391105, 0x04FC00DE, 0x00000404, 0xFC000500, 0x00040004, 0x3004FC01,
+0xFCFF3B7E, 0xBBD80004, 0x00050000, 0xAC71B470, 0xADFF3782, 0x00043883, 0x00D50C00, 0x200004FC,
+0xC11C00B2, 0x56050001, 0xB5FF3988, 0x41000487, 0xFF3889B6, 0x88000504, 0xD56C00D2, 0x04000403,
+0x0800C17C, 0xC3780000, 0x02000400, 0x3C11C1A0, 0xB400D0B0, 0x000400D5, 0x00B98800, 0xCC010004,
+0x428F30B7, 0x01C6E0FF, 0x90300504, 0xB2ECFF45, 0x00000400, 0x040C04F4, 0x05000100, 0xA8489321,
+0x000C00C3, 0x00050401, 0x0403D138, 0xD6400000, 0x4C93C144, 0x000004FF, 0x6800D15C, 0xCC5C00E5,
+0x00000400, 0x8C00EA7C, 0x91B750EF, 0x8CB3FF51, 0x578C62FB, 0x597E91FF, 0xFF1256D0, 0x7C000C64,
+0x04B80007, 0x00050009, 0x7D0001A7, 0x02AF0002, 0x010A1800, 0x0D00020C, 0x00040F00, 0x02110301,
+0x01001B08, 0xF160661C, 0x355669FF, 0x00B33CFF, 0xF0001660, 0xB8DC000A, 0x00D6DC00, 0x04000008,
+0x01100100, 0x06288D10, 0xE7B83F11, 0x00E7BC00, 0x04000144, 0xBFCC0000, 0x00B8DC04, 0xEC000008,
+0xB8E402BF, 0x21ED0000, 0x04F8FF3E, 0xFF3C8650, 0x001086B9, 0xD1F83C11, 0x3101C400, 0x483E87B4,
+0x83AF23ED, 0x8470F254, 0x89AFFF43, 0xC8E8FF49, 0x6295B460, 0xD4C0D2FF, 0xFCD00048, 0x00240002,
+0x7200FCEB, 0x17780203, 0x0005000A, 0x00000103, 0x05000F03, 0x2C0038FF, 0x02290202, 0x001F6E00,
+0x0000206E, 0x02800105, 0x01001700, 0x8E00026C, 0x8638001F, 0x00002C00, 0xEF510289, 0xC1E4F7FF,
+0xB680162C, 0x9CFF4B8F, 0xE8FF3D77, 0x6081801D, 0x6586FF2E, 0x13F4FF33, 0x326487C0, 0x356687FF,
+0x366788FF, 0x000F0CFF, 0xF4001904, 0x00040004, 0x005A0800, 0x280004FC, 0x0F100046, 0x00140C00,
+0x000022F8, 0x0A0C000A, 0x326E9331, 0x30000444, 0x7DA291B8, 0xE8F5FF41, 0xF0FFFFD2, 0x00910031,
+0x00B0D400, 0x25001E08, 0x23FD120C, 0x00970003, 0x2600040F, 0xD100D000, 0x98A6FFF7, 0x6379FF82,
+0x6C8AFF40, 0x00D2783B, 0x7800C860, 0x7699319B, 0x00E16C37, 0x7400D27C, 0x0A100096, 0xA070A410,
+0x00DC7800, 0x6C000508, 0xCD7C039B, 0x0209F800, 0x37150004, 0x0800B47C, 0x0500040A, 0x0009F400,
+0x88000004, 0x000400C3, 0x00C0CC00, 0x6800C0E4, 0x000400C3, 0x10B97005, 0x11DF1083, 0x01CD7039,
+0x85250340, 0x00E9303B, 0x04020D5C, 0xBC540000, 0x00C65C02, 0x84000384, 0x000404DC, 0x02001002,
+0x8000EB88, 0x050004BE, 0x00000800, 0x0400C388, 0x8FBE4100, 0x0004FF3E, 0x21D5C800, 0xE690428F,
+0x01C1E400, 0x8F210004, 0x10D7A445, 0x10D29CBC, 0x11B7F88F, 0x00D60847, 0x0400C8A4, 0xD7A00000,
+0x00000404, 0x0C010504, 0x4A93300F, 0x71BD3CFF, 0xFF4794C2, 0x004A92C2, 0x0A100005, 0x0009F800,
+0x04000F20, 0xB508000A, 0x00EA7C00, 0xB471F0CC, 0xA9FF4F91, 0x1D544E89, 0xFCA3AF20, 0x13EC0012,
+0x0003F600, 0xCD0301E4, 0x1D040101, 0x000EE403, 0x1B0003F9, 0x00040000, 0x01001F03, 0xFE300007,
+0x6AFCFFFF, 0x01001F00, 0xB9010010, 0x74FF1302, 0x002D0029, 0xF1093C03, 0xFFFAFF03, 0xFF9BB2C2,
+0xFF365E77, 0xFF326987, 0xE84181A5, 0x09F400EF, 0x00050002, 0xF0000B0C, 0x04FC0209, 0x00C2DC00,
+0x04000130, 0x04FC0000, 0x04000400, 0x60000500, 0xD8FC0001, 0x00000800, 0x00000174, 0x000400C5,
+0x00050000, 0xBB1104FC, 0x3992C2E8, 0x3788B3FF, 0x3887B0FF, 0x8430F23C, 0xD948FF3D, 0xF10A0C00,
+0x3C7BA400, 0x5F99BFFF, 0x629DBFFF, 0x5E8CA4FF, 0xFF101990, 0xC100B8C4, 0x086F0000, 0x002D4803,
+0x960202DD, 0x00190012, 0x01010803, 0xD803000B, 0x039C0100, 0x0F001101, 0x2DFF0005, 0x04015002,
+0x80000500, 0x015B0107, 0x05001700, 0x90000009, 0x0011002A, 0xD1002600, 0xA5BBFFED, 0x8BAEFF7B,
+0x91B9FF4C, 0x0031D850, 0x82B1CCBC, 0x84FF3162, 0x86FF3364, 0x00043465, 0x34668740, 0x000004FF,
+0x040404FC, 0x05000000, 0x0804F800, 0x04000004, 0x4B0C0405, 0x000A0800, 0xB000B0E8, 0xC21000AE,
+0x4180A360, 0xD0E8F4FF, 0x110800FB, 0x0002CC00, 0x00031C0C, 0x0A000F05, 0x02710032, 0xFFF602F1,
+0xFFAEBECB, 0xFF335368, 0xFF3A6987, 0xFC347094, 0xA0740013, 0x223C8400, 0xCD7C7897, 0x008C6800,
+0xA0207D84, 0x11D27C74, 0x00F06037, 0x00000F0C, 0x19A8000A, 0x020A0004, 0x04020F04, 0x05000405,
+0x03050401, 0xFC00E674, 0x05080004, 0x00050000, 0x7800D780, 0x050004EB, 0x00050400, 0x78010004,
+0x048312BE, 0x03380005, 0x00BC3400, 0x0400C12C, 0x05000200, 0xC64C3A11, 0x49C38800, 0xFF3C88BA,
+0x89210004, 0x00F0943B, 0xB40108A4, 0xD09C0303, 0x0303C401, 0x0400EEB0, 0x00040505, 0xE4418F21,
+0xC6DC01C1, 0xFC439023, 0x05040004, 0x00BEA406, 0xFC00BEA8, 0x00040204, 0x02051000, 0x20000004,
+0x1414010A, 0xFF4893C0, 0xFF4594BF, 0xFF4694C2, 0x00EA48C2, 0x50010A10, 0xC44D11D6, 0xD65400F0,
+0x4C95C231, 0x03F0F454, 0xFF4E93BA, 0xFF4484A7, 0xFF457A99, 0xFF4C7287, 0x01E0E1E8, 0x000EA000,
+0xD8000004, 0x06940006, 0x03026C00, 0x0B0004C8, 0x00040F00, 0x04F80004, 0x0002B000, 0x10010504,
+0x00280052, 0x00040E01, 0x48000009, 0x00040000, 0x51000C00, 0x6476FFF8, 0x405C9847, 0xFF306B8D,
+0xB00007B8, 0x050000B8, 0x0009F808, 0xD8000EE8, 0x000400C2, 0x0004FC00, 0x38000004, 0x00040101,
+0xF1EC8A10, 0xF1E83A11, 0x0404FC00, 0xE4050004, 0xF70C00C7, 0x3C8504F0, 0x3A86BAFF, 0x3886B7FF,
+0x3687B2FF, 0x3887AEFF, 0x4015C8FF, 0xFF3F86B2, 0x5000E350, 0x83ACE0CA, 0x94B7FF44, 0x92B1FF5C,
+0xA0B5FF5D, 0xFC00D1BC, 0x00B50128, 0x02000501, 0x0B012D18, 0x00050F00, 0x200055FF, 0x1A540002,
+0x018BBA02, 0x13000743, 0x017E0100, 0x00000900, 0x80030004, 0xF8FD1206, 0x839CB118, 0x8FB4FF51,
+0x89B0FF53, 0x00B3C84B, 0xFC000500, 0x00080004, 0x0218F800, 0x331F0504, 0x000E0500, 0x04000A08,
+0x0A04000F, 0x010A0001, 0x33513204, 0x3B7BA1FF, 0xA771E4F4, 0xEEFF4584, 0xC9E0C9E0, 0x00147802,
+0xAC001488, 0x0094030F, 0x0F00A401, 0x002D0005, 0x01F2004C, 0x4C60FFF7, 0x5E79FF2D, 0x627FFF32,
+0x708EFF2F, 0x640009F8, 0x91700096, 0x36719932, 0x6C000F00, 0x317530A5, 0x200F04FF, 0xF78079A2,
+0xAF783712, 0x04387921, 0x05080C14, 0x00050004, 0x040028C8, 0x00040014, 0x00050004, 0x80000504,
+0xC37408D7, 0x0F140800, 0x01010500, 0x38030504, 0x050004F3, 0x04000800, 0xB9110500, 0x3B110874,
+0x8C00FA84, 0x129C0108, 0xFF3A8B30, 0x04000F08, 0x03C00100, 0x00050803, 0x040003D4, 0x05000400,
+0x020DF400, 0x08020004, 0x09100005, 0x00000400, 0x0400D0F0, 0xC89C0000, 0x00000404, 0x04080694,
+0x05000000, 0x1424BA10, 0x05109212, 0x00EBC004, 0xF400D13C, 0x0EF40104, 0x2118FC00, 0xEBCC4790,
+0xE0052C00, 0xFF5393B9, 0xFF437B9E, 0xFF467893, 0x2EDC778A, 0x03025400, 0xFF1004FC, 0x7A0015E4,
+0x04DA0025, 0x0001D803, 0x040F019F, 0x1F030100, 0x002A0000, 0x03C06402, 0x34000011, 0x48FD1219,
+0x0E280100, 0xFFF6FD61, 0x34C9D9E6, 0x638131B8, 0x00E83834, 0x08001DB8, 0x13E8001A, 0x00100800,
+0x14001014, 0x01280801, 0x00000C08, 0x58000144, 0x00040001, 0x0009F400, 0x74000004, 0x04FC0006,
+0x00108800, 0xB780018C, 0xB8FF3D85, 0x30FF3D84, 0x86B4C0ED, 0x86B1FF38, 0x86AFFF35, 0x10D0FF37,
+0x00140000, 0x280001E8, 0x8FB37126, 0x94B2FF4F, 0x31E5B85B, 0xD8BEDDEF, 0x00BA0339, 0x0F0AB801,
+0x64FF0500, 0x01022A01, 0x50002C02, 0x09F70102, 0x02019501, 0x0B010974, 0x00050100, 0xDBFFF5E0,
+0xA7FFA0C9, 0xBCFF5289, 0xACFF5C96, 0xB8C80077, 0x0022F000, 0x04000004, 0x0500000A, 0x00000402,
+0x35118BA0, 0x00042300, 0x0008010A, 0x0C336821, 0x04FC0041, 0x00000400, 0x040113F4, 0x396B2105,
+0x28003710, 0x9E00F237, 0xC2FF3977, 0xABFF4F9A, 0xE2FF4988, 0xB0ECB9D3, 0x0231FE01, 0x2E002B1C,
+0x008F0003, 0x31022C0F, 0x00A4E400, 0xCF3137C8, 0xB394ABC1, 0x2C566EC0, 0x285A75FF, 0x2F6685FF,
+0x719B70FF, 0xFF39739B, 0x3438739D, 0x190004B9, 0x98769B20, 0xFF375155, 0x043A78A1, 0x0A040419,
+0x02050004, 0x37120A0C, 0x7C03F074, 0xD27C00EB, 0x0205000E, 0x0401F57C, 0xE3FC0014, 0x02F08403,
+0x39510504, 0x3983B0FF, 0x00000D38, 0xD52C0005, 0x000A0000, 0x70000004, 0x00040403, 0x00050400,
+0x30000500, 0x000C0124, 0x00CD8C00, 0x140BC688, 0x03D00414, 0x0803E800, 0xFC000004, 0xCBD00003,
+0x00040C00, 0x10000004, 0x00040009, 0x0C04FC00, 0x08040004, 0x00080805, 0x00050400, 0x1C020004,
+0xF0C0020A, 0x000F2000, 0x04000500, 0x050C0000, 0x20CDCC00, 0xD7DC95C1, 0xD4FF4D20, 0x6F90A010,
+0x6780FF3D, 0xC1D0FF3D, 0xF31712FC, 0xDA0015E0, 0x04ED0201, 0x03019802, 0x13020778, 0x0E130000,
+0x00000406, 0x1F000201, 0x11070000, 0x0302B501, 0xBD010011, 0x00310002, 0x00001000, 0x02F10A00,
+0x7C8BFFF5, 0x5970FF62, 0x5D7CFF33, 0x8AB2FF2A, 0x311DD849, 0xA44491BF, 0x010000EA, 0x0413E808,
+0x08000128, 0x04F80000, 0x04000400, 0x0000EAD0, 0x09F80405, 0x04017404, 0x00000188, 0x00040005,
+0x3101A000, 0xFC3887B2, 0x05000004, 0x001FB800, 0xF40004FC, 0xA703F015, 0xB4FF4081, 0xABFF5191,
+0x9CFF5890, 0xFFFF6187, 0x0089B4FF, 0xAC0013E4, 0x0AF00300, 0x01000B02, 0xE00F0006, 0x49013102,
+0x00050F00, 0x2B040AFF, 0x10780502, 0x03012D04, 0x07000019, 0x00040000, 0xF0025801, 0xA7FFF005,
+0xB5FF6090, 0xBEFF5793, 0x84FF6097, 0x85FF285C, 0x11C0DC62, 0x000EFC34, 0xFC000A00, 0x05000009,
+0x04638424, 0x14080014, 0x03050807, 0x04000500, 0x0500000F, 0x000EF400, 0x10006420, 0x00040064,
+0x000F1000, 0xC3B20974, 0xAFFF529C, 0xD5FF4F8E, 0x0724A6C3, 0x0228FE10, 0x0040F802, 0x040002EF,
+0x11200900, 0x0F00B704, 0x001E0008, 0x5C000054, 0xF901F000, 0x899BA5FF, 0x24475BFF, 0x27536CFF,
+0x445573FF, 0xFF2CC0AA, 0xFF3B7299, 0xFF3B79A2, 0xAF80759B, 0x9BFF2F51, 0xE6803478, 0x36719B50,
+0x2300A0FF, 0x0A047612, 0x00050404, 0x040004FC, 0x0F080F00, 0x05040005, 0x00000400, 0x74010A08,
+0x387F21E1, 0x2400F088, 0x00040003, 0x0804FC00, 0x04000004, 0x14080005, 0x2D050401, 0x140C3A84,
+0x0004F400, 0x040004FC, 0x000C0000, 0x0403A400, 0xA0000004, 0x03C00008, 0x00000400, 0x040003D0,
+0x0F140000, 0x00141800, 0x080C0004, 0x040C0105, 0x02141401, 0x08000A0C, 0x00040405, 0x08050C08,
+0x24010500, 0xEF2401D1, 0xC4FF4920, 0x0A2000FF, 0x00051000, 0x040004FC, 0x050C0000, 0xD150BF13,
+0x00230000, 0x877315EC, 0x71FF3E6A, 0x1CF8385B, 0x02115400, 0x7C003B7C, 0x01BF04A1, 0x04050005,
+0x080F0011, 0x2C000C00, 0x00040004, 0x01052104, 0x34000040, 0xFD03F202, 0x4A5EFFE7, 0x5973FF27,
+0x6689FF2B, 0x8FBCFF2E, 0x21EAC44B, 0xD3AC3E8C, 0x00010800, 0x18000004, 0x00040001, 0x04012400,
+0x38000004, 0x04FC0101, 0xD6DC8A10, 0x00FED806, 0x6C000158, 0xDBD80001, 0x611F9801, 0xB7FF3C86,
+0x00043E84, 0x3B86B090, 0x3886ADFF, 0xEADCAFFF, 0x12DBDC00, 0xF2CF5C83, 0x4180A904, 0x4382A5FF,
+0x5392B1FF, 0x51859BFF, 0x9BB8C8FF, 0x760131F4, 0x00DD0F08, 0x00D00203, 0x03001C0F, 0xFF00160F,
+0x04E90144, 0x03015B03, 0x6900000C, 0x95490004, 0xFFF8FFB0, 0xFFC4E0EE, 0xFF538BA6, 0xA480D4A8,
+0x85FF477C, 0xE8FF2D5D, 0x04F80004, 0x0009FC00, 0xF4000F04, 0x05040018, 0x00001800, 0x04000008,
+0x00040014, 0x0009FC01, 0x69212308, 0x040A0034, 0x1C000500, 0x0500006E, 0x40411000, 0xFF39698D,
+0x00002820, 0x9BC1B3BE, 0x95B5FF53, 0xB1C5FF54, 0x002F1C8E, 0x0B030328, 0x13B7000F, 0x0305B00D,
+0x070F00B7, 0xE8001E00, 0x00040000, 0xF1003900, 0xACFFF906, 0x55FF889E, 0x6DFF1C3F, 0x70FF2B53,
+0x84FF214F, 0xA5742A60, 0x39799D50, 0x8C809AFF, 0x0C357622, 0x3674300A, 0x001E24FF, 0xFC00B480,
+0x00040004, 0x000A000C, 0x7C050504, 0xFF7C03D7, 0x000A0800, 0x00000004, 0x0F040005, 0x04140400,
+0x00000004, 0x140C0E05, 0x000A0802, 0x04011240, 0x38852505, 0x6C000504, 0x04F80008, 0x00000404,
+0xFC040394, 0x00080004, 0x0003A800, 0x040403C4, 0x03D80000, 0x0003E400, 0xF4000004, 0x00040003,
+0x03050405, 0x0C02E1A4, 0xD2B4030A, 0x00232803, 0x2C000504, 0x00040013, 0x00050808, 0x0004000C,
+0x14240005, 0x3C8FBD22, 0x233C01D1, 0x51DCD801, 0x93C1FF47, 0x00196046, 0xAC31D7CC, 0x2F184384,
+0x365B7573, 0x7792A3FF, 0xF40201D8, 0x04FC0209, 0x0F166802, 0x031A03F8, 0x380401BB, 0x0500002D,
+0x3CFBFD20, 0x0019003C, 0xBAFFF891, 0x68FF8DAA, 0xB17C254F, 0x71C9EC00, 0xFF468CBD, 0xB03D8BBC,
+0x8FBF31DB, 0x01FEBC3D, 0x8B210108, 0x0005103B, 0x04000124, 0x01340000, 0x0004FC00, 0x0800DBCC,
+0x01500000, 0x00000400, 0xC8000154, 0x017400D6, 0x12050001, 0x00D41086, 0xB4570500, 0xAEFF3C84,
+0xD8010500, 0xE08212DB, 0xA804F306, 0xA8FF4381, 0xA8FF4B86, 0x8FFF528E, 0xFFFF4E7D, 0x2AD8E2F6,
+0x0000A800, 0x0402027C, 0x00FC0000, 0x02000400, 0x060F000E, 0x0051FF00, 0x0400017F, 0x09E00100,
+0x000C3000, 0x0400000D, 0x0C5D0000, 0x00046503, 0xFFB02995, 0xACBEFFF1, 0x9CB9FF87, 0x352CFF63,
+0x2C6087C0, 0x356289FF, 0x346284FF, 0x00689CFF, 0x04000500, 0x0004000F, 0x00050800, 0x080004FC,
+0x04FC000A, 0x05000400, 0x68210500, 0x04280036, 0x0004190C, 0x1E180005, 0x31050000, 0xF038688E,
+0x2A200059, 0x599AB873, 0x739DB3FF, 0xC00054FC, 0x00940234, 0x003BFC00, 0x3A000597, 0x00080003,
+0x2902260F, 0x3F74F913, 0x01004401, 0xF9D12F74, 0xA2B3C3FF, 0x1A3C55FF, 0x2A5774FF, 0x8140C774,
+0x84FF2B64, 0x559000B4, 0x00B47400, 0xF800D78C, 0x00040104, 0x00E18007, 0x04000504, 0x05080000,
+0x001E0C02, 0x0C06C884, 0x14100019, 0x0004FC00, 0x04000A00, 0x05040000, 0x0404FC04, 0x04000008,
+0xE1900005, 0x00140C00, 0x0C020F18, 0x1E140619, 0x01050400, 0x18001910, 0xDCA4001E, 0xF8608716,
+0x042B9400, 0xAC000004, 0x00040403, 0x00141000, 0x040212B4, 0x1E1C0200, 0x00050400, 0xB4000004,
+0xE4C001E4, 0x00191C0B, 0x04000508, 0x141C0200, 0x01051002, 0xC0000508, 0x192800E6, 0x04000403,
+0x0C01E1C8, 0x47906105, 0x488FBBFF, 0x24000004, 0xDB44000A, 0x4492C031, 0x8000DB4C, 0xCBE400EA,
+0x2B5A78B2, 0x2C4F63FF, 0xCFE2F0FF, 0xB000E4B8, 0x1DEC04FD, 0x03026F00, 0x040FAB7C, 0xE0001604,
+0x750B0027, 0x01ABB003, 0x050101C8, 0x07250000, 0xFFEF12F2, 0xFF2F5266, 0xFF20526D, 0xFF225D7F,
+0xFF4889B3, 0xFF438DBE, 0xFF3D8DC0, 0xFF3C8FC1, 0x00388BBD, 0xF9C40005, 0xC43A8C22, 0x408B10FE,
+0x18E8001A, 0x04FBD402, 0xF8000144, 0x00040004, 0x0004F800, 0xF8000004, 0x0500080E, 0x0004FC00,
+0xFC0027F0, 0x00040009, 0x000BB800, 0xB64006B4, 0xECFF3C84, 0x0500001A, 0x4E87A5B1, 0x4B7F95FF,
+0x749AA7FF, 0x340209FC, 0x00AD0180, 0x00000505, 0x040000F8, 0x00110500, 0xFF00090F, 0x04E7004A,
+0x00044100, 0x54010008, 0x2F800025, 0x03050404, 0x0F00046C, 0x001C0000, 0xDFF907F5, 0x6390A7FF,
+0x649DBBFF, 0x5490B2FF, 0x2B5D82FF, 0x335F84FF, 0x04000500, 0x04F8000A, 0x00050800, 0x08040008,
+0x2314000A, 0x0905000F, 0x000F0000, 0x00050504, 0x3A672105, 0xB9A02840, 0xBAFF5595, 0xA3FF5B9C,
+0x12FBDC8D, 0x001404E6, 0x040100A8, 0xACFE1100, 0x05000F6E, 0x00FB002D, 0x10000405, 0x0000E9FE,
+0x850014F0, 0xF703F003, 0xA7BDD2FF, 0x1C4058FF, 0x2E5C73FF, 0x215771FF, 0x009670FF, 0x9E71EB80,
+0xA0FF3974, 0x32A43774, 0x31749E31, 0x1800FA80, 0x04F80028, 0x00000404, 0x04020500, 0x2810000F,
+0x00D78C06, 0xF8000500, 0x00040804, 0x00031C00, 0x880404FC, 0x050000FF, 0x03000401, 0x00081410,
+0x03540005, 0x00050000, 0x04050004, 0x18861005, 0x743A1128, 0x04FC00DA, 0x00039400, 0xB8040004,
+0x00080403, 0x0412B800, 0x1C000500, 0x0004001E, 0x0105000F, 0x000A1004, 0x040004FC, 0x05000F00,
+0x1E2C0401, 0x40192800, 0xFF458FC0, 0x0C000004, 0x05040000, 0x498DBA32, 0x91A10500, 0x91BFFF44,
+0x92BFFF43, 0x002C6441, 0x79B11378, 0x70FF2157, 0x72FF2B57, 0x04004562, 0x061AD402, 0xB80003E1,
+0x000E047E, 0x04000C08, 0x080F0014, 0x10010200, 0xFFFF2402, 0xC0003418, 0x002801A6, 0xFFF6FD61,
+0xC8BFD2E0, 0x557340C9, 0x9338FF1E, 0xF1289000, 0x3E87BA00, 0x3C8CBFFF, 0x398CBEFF, 0x378DBEFF,
+0xC4000500, 0x000404E5, 0x00011800, 0xE0000004, 0xE7D40027, 0x01014000, 0x873404F8, 0x09F8FF39,
+0x000B6800, 0x04000500, 0x04F80000, 0x00000400, 0xB00004FC, 0x0EF80029, 0xF4D0AE10, 0xFF3882A1,
+0xFF3981B1, 0x003880B0, 0xD6E40005, 0x4E84A0B5, 0x4D7889FF, 0xBCD8E3FF, 0xEC0002D0, 0x00040404,
+0x0F00B801, 0x5AFF0005, 0x01023C03, 0xB60109FB, 0xFFF620B3, 0x8200B8C2, 0xF4FF101B, 0x07580009,
+0x10042100, 0xF27CD8FF, 0xB5FFA212, 0xC3FF659B, 0x8FFF6EA5, 0x7FFF3970, 0x86FF2B5B, 0x82FF3462,
+0x82FF3260, 0x83FF3361, 0x00043462, 0xCC326321, 0x09FC00EF, 0x00000404, 0x0000280C, 0x280C000A,
+0x01000400, 0x080009FC, 0x3469210A, 0x0000EAF8, 0x140C010F, 0x386A0BF2, 0x3E6A8FFF, 0x37678DFF,
+0x4682A6FF, 0x65A4C3FF, 0x5C92AAFF, 0xC6EBFBFF, 0x8C01AECC, 0x00B50200, 0x0020F400, 0x13012632,
+0x02340F00, 0x003C0024, 0x40033802, 0xFCFDFFFE, 0x80000F60, 0x00160021, 0xF1237000, 0xD5FFF507,
+0x59FFB2C8, 0x73FF1C45, 0x76FF275B, 0x7EFF285B, 0x90FF295E, 0x3673219B, 0xA23132A4, 0xCD803378,
+0x002D0000, 0x10000004, 0x0504000A, 0x00D76C04, 0x0400000C, 0x0004000F, 0x0404FC00, 0x18040004,
+0x0A000032, 0x00000404, 0x04000F0C, 0x04FC0100, 0xFF398031, 0x90000A04, 0xDF1400FA, 0x0F048210,
+0x000A0400, 0x18020004, 0x03700023, 0x00000404, 0x1804F360, 0x04FC0037, 0x04039800, 0xAC000004,
+0x384C0003, 0x010A0400, 0x20000004, 0x00040319, 0x2103E801, 0x0E0C388A, 0x00040000, 0x0004E4CC,
+0x00080405, 0x00141400, 0x0C000004, 0x00040005, 0x00192408, 0xBF1704F4, 0x0001E6CC, 0x478E3005,
+0x00DCFCFF, 0xBD710524, 0xBEFF3F90, 0xEBC04290, 0x31D60000, 0x04225373, 0xB4C235CE, 0x0104009E,
+0xD302027C, 0x0EBB0001, 0x1F01CA0F, 0x0001AF00, 0xFD12311C, 0x0F002AA4, 0x3B3C0200, 0xFFF502F1,
+0xFF597485, 0xFF25516A, 0xFF155070, 0x744388B1, 0x050000F1, 0x62060800, 0xFF398DBC, 0xEAB88FBE,
+0x01EABC00, 0x8912010C, 0xFC0109F4, 0xF1D40304, 0x0004F400, 0x58000500, 0x00040401, 0x00015C00,
+0x0400107C, 0x09E00000, 0x6131EC01, 0xAEFF3986, 0xF9CC3685, 0x000EF804, 0xAF100500, 0x80E2E0D0,
+0x81A4FF3D, 0x7E99FF41, 0x7382FF4B, 0x210FF853, 0x32D3FAFE, 0x1F00F10F, 0xFF00320F, 0x02780339,
+0x00FB2C02, 0xF00009FC, 0x315E0177, 0x00028C02, 0x6F010020, 0xFFF2E001, 0xFF72A1B5, 0xFF65A1BD,
+0xFF6CA2BE, 0x8335D468, 0x04FC3162, 0x0505000F, 0x000F0400, 0x00040004, 0x05040005, 0x00000400,
+0xF0000500, 0x00080109, 0x00356A21, 0x0A0406EB, 0x05003B11, 0xB2505400, 0xFF69A8C7, 0xFF629EB6,
+0x309DC8D9, 0x02DD0108, 0x0009F600, 0xFF202804, 0x014DDCFF, 0xA4010013, 0x00050F00, 0x00400223,
+0x0000E900, 0xF8000058, 0x79090004, 0x00191000, 0x06F10014, 0xD7E5FFF5, 0x485CFFBB, 0x5B72FF1F,
+0x5A78FF2E, 0x6387FF29, 0x5032102D, 0xFF32739D, 0x210A009F, 0x371C3475, 0x00050000, 0xF400370C,
+0x0A100004, 0x000A0400, 0x00000508, 0x05000014, 0x04000400, 0x08000500, 0x28140000, 0x0F000400,
+0x05050500, 0x00030508, 0x19140405, 0x000A0400, 0x14000004, 0x00040019, 0x00050408, 0x9C000508,
+0x00040003, 0x0003AC04, 0x04000500, 0x08C80000, 0x00000400, 0x04000A08, 0x04040000, 0x00000400,
+0x000003EC, 0x05000004, 0x00000400, 0x040012FC, 0x05000400, 0x001D1C00, 0x1C000004, 0x05000027,
+0x00FACC00, 0x04000504, 0x04FC0000, 0x418FC031, 0x1C001850, 0x3B38000F, 0x3C8EBB22, 0x051C0028,
+0x00EA3000, 0x30000F04, 0x5577B1E0, 0x546FFF1A, 0x4557FF28, 0x2660CC28, 0x10D0FEFF, 0x0F050409,
+0x001901C7, 0xFC0001A3, 0x16A00104, 0x020A4E00, 0xCE010504, 0xE8FB2120, 0x71D0D210, 0x8BFF2456,
+0xB7FF2968, 0xBDFF408A, 0x8A6118F4, 0x8ABCFF3E, 0x3109F83E, 0xFC378BBA, 0x01000005, 0x08010800,
+0x2C000004, 0x00040001, 0x0004FC00, 0x50040004, 0x015C0001, 0x01000400, 0x85A104FC, 0x81B5FF39,
+0x85B6FF3A, 0x311DF03B, 0x003486AE, 0x0EF80005, 0x0004FC00, 0xD400E83C, 0xD9780106, 0xFF438290,
+0xFF427289, 0x1EF4B7C5, 0x14FFF920, 0x027C02DF, 0x1900F10F, 0xFF002C0F, 0x1123003D, 0x01024000,
+0x000027F5, 0xFFFB2005, 0x2C019A48, 0x1158004D, 0xF3B33D00, 0xFFF8FF07, 0xFFC9E4ED, 0xFF6197AF,
+0xFF6CACC8, 0xFF52849F, 0xF42C5976, 0x08311109, 0x05000900, 0xFF346261, 0x00356384, 0x04FC0041,
+0x00000400, 0x10000500, 0x0004000F, 0x00050004, 0x040004FC, 0x09F80000, 0x05F00000, 0x06F00A04,
+0x8FFF3966, 0x8EFF3969, 0xC3FF3169, 0xBDFF67A4, 0xB5FF66A4, 0x001130A3, 0xA4002A28, 0x049C000E,
+0x0600AC00, 0x160FFA58, 0x05002B02, 0x04F80301, 0x20038907, 0x0068FAFE, 0xF1007000, 0xEDFFF70A,
+0x5EFFCCDF, 0x7AFF2349, 0x79FF3160, 0x80FF295C, 0xA2FF285E, 0xD27C3D78, 0x0009F400, 0x880146B0,
+0x707912E6, 0x412C00DC, 0x00050400, 0x08002DC8, 0x0004000F, 0x08050000, 0x04000004, 0x0A080005,
+0x00050004, 0x2C000008, 0x00040003, 0x041E1800, 0x08040500, 0x14100000, 0x00000400, 0x14040508,
+0xEB94020F, 0x04FF3B24, 0x00080005, 0x000F1800, 0x9400F0B4, 0xE9780008, 0x0404FC00, 0x08010004,
+0x2D20050A, 0x2D283C15, 0x0008FC00, 0x040C04F4, 0x05040500, 0x01141C03, 0x44000010, 0x192C0304,
+0x400A1800, 0xFF3E8EBF, 0xB000F5D8, 0x8CB93133, 0x00225C43, 0x040004FC, 0x05240000, 0x8DB803F0,
+0x7BA1FF44, 0x5775FF3A, 0x4D63FF20, 0x8A98FF24, 0x6C0001CC, 0x116002C9, 0x02017307, 0xCD0F0774,
+0x3C001401, 0x00040004, 0x000CA700, 0x44010044, 0xFDFF210E, 0x7000B0D0, 0xAABD62D4, 0x4A63FF8F,
+0x7000DDC4, 0x40C0003B, 0x3989BCC0, 0x3F8BBCFF, 0x3D89BAFF, 0x102900FF, 0x030AFCB9, 0xEC002CD8,
+0x00040004, 0x0104EC00, 0x54030004, 0x04F80429, 0x04000800, 0xFC0004F8, 0x24900004, 0x3884B5C0,
+0x3980B4FF, 0x3983B4FF, 0x7104FCFF, 0xFF3486AC, 0xBC3784B2, 0x1AC80052, 0xF027F000, 0x3D81A803,
+0x3A799CFF, 0x417A97FF, 0x426B7FFF, 0xCCF4FFFF, 0x05B90011, 0x0F46A802, 0x0F1400EF, 0x47FF0027,
+0x002A3C00, 0x3E000248, 0x2D060007, 0x03DD3802, 0xF800029C, 0xF2FF6113, 0x8BAFBDFF, 0xCEE64DA8,
+0x7CFF70AF, 0x7DFF2F61, 0x7FFF3662, 0x0C04FC5E, 0x0C000500, 0x0EFC000F, 0x0404FC00, 0x04000008,
+0x00040005, 0x000F0000, 0x04000504, 0x05000000, 0x001E0800, 0x00010004, 0x346A210A, 0x280009FC,
+0x8A07F0AA, 0xB3FF2E64, 0xC6FF5591, 0xAEFF6BAB, 0xFFFF6699, 0xFFFFDDF4, 0x0037A2FE, 0xE00257BC,
+0x05B70190, 0x0F024B02, 0x00270220, 0x4100194D, 0x1E5B0003, 0x01A0BC00, 0xFC130010, 0x10032694,
+0xF8FFE114, 0xD1EBFAFF, 0x294F62FF, 0x2F5F76FF, 0xA000DE94, 0x6D958000, 0x79A0FF33, 0x04FCFF3B,
+0x00F09800, 0xF8000508, 0x00040004, 0x000A0800, 0xFC000004, 0x00040004, 0x0004FC08, 0x0000000C,
+0x00040005, 0x00140C04, 0x04000500, 0x05000000, 0x00000400, 0xFC041414, 0x00080104, 0xFF38813C,
+0x08000500, 0x0A040005, 0x00000400, 0x040004FC, 0x05000000, 0x05000400, 0x86160504, 0x0800322C,
+0x09FC0005, 0x2000040A, 0x0500FF39, 0x081CF000, 0x0C000004, 0x04F00005, 0x09000800, 0x8B250004,
+0x003B1C3D, 0xBE310020, 0x044C3C8E, 0x428CBB40, 0x000A00FF, 0x340004F4, 0xF0F80014, 0x00001400,
+0x02F03704, 0xFF266588, 0xFF275A75, 0xFF234659, 0xFFD8E8F5, 0x002298FF, 0xC10042D6, 0x01C00001,
+0x0F000408, 0x001401CA, 0x040002B4, 0x05000000, 0x02004700, 0xB0000037, 0x0BC80006, 0xFFEE02F1,
+0xFF395D73, 0xFF2D607F, 0xFF225E82, 0x00478CB5, 0xF0BC113D, 0xC83E1104, 0x100C01F6, 0x032E2400,
+0xFC090EF4, 0x34881604, 0x04F80401, 0x0004FC0C, 0x04000500, 0xB600F100, 0xB3FF3A83, 0xADFF3882,
+0xACFF3584, 0xF4C83685, 0x0013F400, 0xF00001B4, 0xA200F640, 0x94FF3E7E, 0x88FF3B76, 0xA2FF3D6F,
+0x0FF87091, 0x01010000, 0xBA021674, 0x00060F00, 0x000066FF, 0x017C0113, 0x0103F800, 0x56034278,
+0x025D0027, 0x70C24000, 0xAEFFDEF8, 0xACFF6E98, 0x98B53151, 0xB2F9B05B, 0xFF345D7B, 0xFF356080,
+0xFC325F80, 0x1400081D, 0x00140803, 0x04000A04, 0x05000400, 0x04050C00, 0x04080500, 0x461C0105,
+0x00140807, 0x00011E00, 0x3268210A, 0xCEB3FBE8, 0xB8FF75B2, 0xD6FF6EA2, 0x5824A3C2, 0x00050400,
+0xA40402E8, 0x00BE0105, 0x2800050F, 0x00037D03, 0x53010A07, 0x08440000, 0x00145A00, 0x00030064,
+0x03650005, 0xE0F8FF21, 0x576B6087, 0x607BFF2E, 0x3220EA34, 0x0046E8FF, 0xF80028AC, 0x05040004,
+0x00000800, 0x0C000A10, 0x04FC000F, 0x00050800, 0x04000F08, 0x04F40000, 0x00000408, 0x040004FC,
+0x0F040000, 0x00000404, 0x04084124, 0x05080005, 0x04034800, 0x14000004, 0x0A000014, 0x00000400,
+0x040204FC, 0x14100A00, 0x0804FC00, 0x08040004, 0x09FC0005, 0x01000400, 0xE00008DC, 0x3A882103,
+0xF8002C00, 0x00040003, 0x03041001, 0x08002D38, 0x05140005, 0x0F192000, 0x11070004, 0x4022303D,
+0xFF3C8EBD, 0x60010508, 0x418E3009, 0x003150FF, 0xBE400010, 0xECFF3F8D, 0xAE00F3F5, 0x78FF4184,
+0x71FF1D58, 0x77FF2C5A, 0x79C44868, 0x6648FC11, 0x010C6300, 0x8303067B, 0x000C0101, 0x0C01CA0F,
+0x0C029700, 0x48010004, 0x00380100, 0x510BC800, 0xD4E1FFF1, 0x0013F8BA, 0x9C31EC38, 0x19802F72,
+0x1222F401, 0x0000F48A, 0xC40031B4, 0x00F4001D, 0x0000FC00, 0x1C000004, 0x00040006, 0x0004F000,
+0x38000004, 0x00040801, 0x00015404, 0x040418E4, 0x05000100, 0xF03B8521, 0x83AD8009, 0x85ACFF36,
+0x1FB4FF37, 0x0001B000, 0xEC0001AC, 0x9700F045, 0x91FF3776, 0x78FF4177, 0xE3FF3F65, 0x0766C0D6,
+0x01086B00, 0x6A0300AE, 0x000C0103, 0xFF00050F, 0x18EC0166, 0x00017D00, 0x49010EEC, 0xFFFE2007,
+0x50005230, 0xF9B00025, 0xC5DC0FF0, 0x9DBBFFA5, 0xADCAFF6C, 0x6F8CFF74, 0x617FFF36, 0x5B7BFF32,
+0x6181FF30, 0x5D7DFF38, 0x331F0500, 0x00060F04, 0xF8000500, 0x00040404, 0x00050000, 0x000409F8,
+0x0A000005, 0x00050000, 0x08004140, 0x7834001E, 0x30B92801, 0x10FF3667, 0x8A04F164, 0xC0FF2B65,
+0xC2FF67A2, 0xB0FF76AA, 0xFFFF759B, 0x5702E8FF, 0x0FAEDC01, 0x0011032D, 0x040F00D8, 0x08001400,
+0x083A000B, 0x02035C00, 0xFB5202A1, 0xF5F9FCFF, 0x1C000CA5, 0x03650105, 0xFFFFF651, 0xBE6CDDF9,
+0x315F7931, 0x1C004BF0, 0xA89810EE, 0x38783087, 0x002320FF, 0x04000500, 0x05000000, 0x00000400,
+0x040004FC, 0x04FC0800, 0x00000C00, 0x040004FC, 0x371C0100, 0x00281C03, 0x00000508, 0x00040005,
+0x0004FC00, 0x4C000004, 0x00040803, 0x0004FC00, 0xFC020004, 0xFD380204, 0x00141000, 0x040009FC,
+0x03A80400, 0x001E2400, 0x10000004, 0x0F0C0000, 0x2204FC01, 0x1CC43B87, 0x03FD9400, 0x10000500,
+0x04000005, 0x03000405, 0x00003238, 0x00040405, 0x0305040F, 0x51050008, 0x8BB9FF3B, 0x004A2C3D,
+0x00000E58, 0x8EBF7105, 0x8FBFFF40, 0xB1ABB447, 0xFF2A6180, 0xFF275064, 0xE4AAC5D0, 0x6CFF1154,
+0x03FE031A, 0x0004FC08, 0xB00F000C, 0xA0000C01, 0x00040801, 0x05019701, 0xB8000034, 0xFFF1E006,
+0xFF5D7E91, 0xFF2D5E7C, 0xFF236387, 0xF8004580, 0x40B40013, 0x0000D000, 0xC80027CC, 0x0500014A,
+0x483D8922, 0x0610003D, 0x000EF007, 0xFC0409EC, 0x01400004, 0x00000404, 0xFC040150, 0x00080404,
+0x31001400, 0xBC3680AF, 0x3BEC0047, 0x0051D000, 0x04F20EF8, 0xFF3D82AC, 0xFF3B7CA2, 0xFF347190,
+0xFF3D6F86, 0xF8516E7E, 0x02B80018, 0x00075700, 0x0C003EC0, 0x00BC0500, 0xFF00090F, 0x02840062,
+0x0108E807, 0x12000259, 0x00090005, 0xE0019000, 0x99B6FFF2, 0xA2C6FF72, 0x9DBBFF6C, 0xEDB8FF66,
+0x306181B1, 0x346182FF, 0x365F7FFF, 0x81350004, 0x0A043360, 0x000F0800, 0x00000004, 0x0004000F,
+0x04050004, 0x00010A04, 0x36665205, 0x106589FF, 0x05000032, 0x002CF000, 0x00000500, 0x0500000F,
+0x6E188F10, 0x00336721, 0x87440005, 0x809F00F2, 0xA6C1FF49, 0x99B0FF73, 0xD6E5FF6B, 0x000500B5,
+0x3C017629, 0x03310F02, 0x00C70010, 0x0800040F, 0x00123800, 0xFC00004B, 0x00040104, 0x02060403,
+0x1C030504, 0x23130001, 0x00006B00, 0x10000004, 0xE4FA7060, 0x356279FF, 0x80EDA8FF, 0xFF276689,
+0xFF2D6D93, 0x04004630, 0x0004040A, 0x0404FC04, 0x04000008, 0x0004020F, 0x14FF362F, 0xFC000119,
+0x00040104, 0xFF387D30, 0x04040500, 0x04FC0800, 0x07000C01, 0x08000F08, 0x82AF3105, 0x00372838,
+0x04000F04, 0x03900000, 0x04000400, 0x080003B4, 0x03CC0000, 0x0008D400, 0xD0000004, 0x0004001C,
+0x0104F800, 0xF8030004, 0x05000C03, 0x00180C04, 0x04040434, 0x05080000, 0x3B8BBE44, 0x000004FF,
+0x40040010, 0x8EBA3128, 0x0050883B, 0xFC01045C, 0x8D02F009, 0x89B6FF3F, 0x6389FF3F, 0x5F7CFF23,
+0x4E61FF2C, 0xC000A1B8, 0x10C00288, 0x0213ED00, 0x750131A4, 0x01A20F0B, 0x001B0208, 0x0F029200,
+0x00010004, 0xAC0201C0, 0x01A50007, 0xFFFFF691, 0x6AFFE4FB, 0xF5342D53, 0x2B6F96A0, 0x408CBEFF,
+0x3089BEFF, 0xF0391147, 0x04BA100A, 0x2C8C130F, 0x0C88123D, 0x0118000F, 0x00000405, 0x863054D0,
+0x0134FF3C, 0x00013C00, 0x04040654, 0x01600000, 0x00000404, 0x04011DE4, 0x39837000, 0x3680ADFF,
+0x001DE8FF, 0xA84009F4, 0xF4FF3A7F, 0xFC500013, 0xA0343400, 0xFF326F8B, 0xFF336276, 0x61C8AEB9,
+0x01165400, 0xEC010245, 0x00DA023B, 0xFF00060F, 0x04EE016C, 0x052A8000, 0xF400025D, 0x83810003,
+0xFFF502F1, 0xFFC6DCE9, 0xFF6695B3, 0xFF68A2C7, 0xF84A7F9F, 0x5D7E311D, 0x410EF82C, 0xFF37607E,
+0x04070004, 0x04FC000F, 0x00000404, 0x04000500, 0x04FC0000, 0x00000404, 0xFC000500, 0x64883504,
+0x004B1834, 0x34002CF4, 0x0500004B, 0x01F70C00, 0x68303C10, 0x7814FF32, 0x00731800, 0xBEB36E44,
+0xBEFF6A9F, 0xABFF6EA4, 0x39346D98, 0x0000A000, 0x4C0007EC, 0x00040402, 0x0402480B, 0x08000017,
+0x001B0100, 0x04000900, 0x11010004, 0x03830000, 0x00000401, 0xFC010844, 0x03430004, 0x01001B03,
+0x00013044, 0x0DAC0215, 0x01051700, 0x4300AF57, 0xC4FF1000, 0xFFE49103, 0xFF3C6C83, 0x302F6886,
+0x6C9131F8, 0x0005042E, 0xF80009FC, 0x0004040E, 0x00050000, 0x04000004, 0x0004040A, 0x21050001,
+0x50E83679, 0x000A0400, 0x08050004, 0x05000B0A, 0x08140800, 0x04040004, 0x46380005, 0x00050002,
+0x0400231C, 0x231C0200, 0x0004FC00, 0xBC000004, 0x03C40403, 0x00000C00, 0xD80017B4, 0x04F40108,
+0x0308F000, 0x08000004, 0x0DF80009, 0x00050005, 0xF00021F8, 0x23240135, 0x20221000, 0x050CFF3B,
+0x001E2C00, 0xBE320508, 0x05003D8A, 0x0A008A12, 0x00045000, 0xBB400F04, 0x5CFF3C8F, 0x0E680009,
+0x0009FC00, 0xD4000A70, 0x6388B728, 0x5C76FF25, 0x97A8FF2D, 0x00E76C7C, 0x71000EA8, 0x016D0302,
+0x00000700, 0x04000158, 0x000C0000, 0x00000401, 0xA000000D, 0x0B830207, 0x00002E00, 0xAC000004,
+0x00040006, 0x00000C06, 0xFF400028, 0xC2F9FAFF, 0xFFF8E001, 0xFF86A5B7, 0xFF30627D, 0xFF28688C,
+0xBCD0564C, 0xBFFF3B88, 0xBDFF3A8A, 0xBBFF3C89, 0xF80709F0, 0x01100000, 0x05000400, 0x883004FC,
+0x0B2CFF3B, 0x04013808, 0x080404FC, 0x05000000, 0x400B7000, 0xFF3683AF, 0x0C000004, 0x0EF40000,
+0x3D81AE40, 0x0009F8FF, 0xFC0075B8, 0x6C140004, 0x306F92B2, 0x366C86FF, 0x335A6BFF, 0x640009FC,
+0x02540112, 0x0100B402, 0xEC01000F, 0x00050F00, 0x8B0069FF, 0x0B900001, 0x0004F700, 0xDC01000C,
+0x43940003, 0xFFF01CF3, 0xFF81A4B8, 0xFF629BB6, 0xFF69A8C9, 0xFF29597F, 0xFF305C81, 0xFF346083,
+0xFF315C7E, 0xFF365F7B, 0xFF37607C, 0xFF33607D, 0x010A047F, 0x61123208, 0xFC000F10, 0x00040004,
+0x3104FC05, 0xF8FF3363, 0x35652104, 0x04010A00, 0x3666A10F, 0x39658AFF, 0x38668AFF, 0x1C004B48,
+0x000400A5, 0x10822801, 0x11AF3469, 0xE05F3835, 0xFF477FA2, 0xFF67A3C5, 0xFF679DB9, 0x0748BDD0,
+0x2810EE12, 0x00083B01, 0xB80002F8, 0x28AD0027, 0x0100C900, 0x03010015, 0x25610021, 0x0104B800,
+0x7801032C, 0x002C0302, 0x00034100, 0x77000ED4, 0x00F40102, 0x00036406, 0x04060013, 0x001D0000,
+0x03000400, 0x0B030054, 0x0A1C0200, 0x80050400, 0x6D84FFEC, 0x6B8AFF40, 0x31116ED8, 0xA110FD04,
+0x73313210, 0x0008FF33, 0x3C367721, 0x209F105F, 0x3A7B3046, 0x0082D0FF, 0x08005A38, 0x7BA8800A,
+0x7BA8FF38, 0x3210FF37, 0x087CA522, 0x000C0000, 0x40191004, 0xFF397DAA, 0x20010004, 0x3A7E212D,
+0x30002B44, 0x00040050, 0x00086800, 0x0800553C, 0x05100000, 0x00191800, 0x0800000C, 0x0F180400,
+0x0403A800, 0xBC010004, 0x39862503, 0xF0025DA0, 0x443A1203, 0x03F40055, 0x083B8822, 0x1887130E,
+0x04FC0109, 0x20FF3D21, 0xF8881213, 0x44F0003A, 0x22050401, 0x1E383D89, 0x31000803, 0x38398BBD,
+0x19240031, 0x001E1000, 0x0400052C, 0x1E0C0014, 0x6B9300F1, 0x6586FF2A, 0x556DFF2D, 0xECF7FF2B,
+0x240BBCD8, 0x0904FDFF, 0x0001AC00, 0x5503019A, 0x000B0001, 0x01000400, 0x0500000F, 0x25880000,
+0x0247EC00, 0xA3005C98, 0x01D00007, 0x0501BB00, 0x270001A0, 0x00340000, 0x015E2000, 0xF4D10015,
+0x3C697EFF, 0x317194FF, 0x26739FFF, 0xB40419D8, 0x89BD4000, 0x27FCFF3D, 0x3E86B640, 0x00292CFF,
+0xB4714FA0, 0xB7FF3588, 0x19103B89, 0x00011400, 0x2C01050C, 0x3C843006, 0x001F5CFF, 0xB4000004,
+0x0004004F, 0x02000C00, 0x3911015C, 0xFC0018E4, 0x0B7C0004, 0x001DE800, 0xF8006700, 0x18F00009,
+0x5101B402, 0x7CA5FF3B, 0x71FEB03E, 0xFF37617A, 0xC46B8795, 0x00AB003E, 0x03029902, 0x110068E8,
+0x00C40000, 0x0F00BC01, 0x61FF0005, 0x07017C00, 0x4C000004, 0x450C000C, 0xF2FFFF71, 0xD4F3FFFF,
+0x03F271B0, 0xFF64A0BC, 0xFF508BAB, 0xFF2B597D, 0xFF335A81, 0x05005E84, 0x7504FC00, 0xFF345E77,
+0x0034607D, 0x09FC0C05, 0x1105000F, 0x39658853, 0x050088FF, 0x306B8B32, 0x6B30B430, 0x2820FF33,
+0xF5000400, 0x34688F08, 0x30678EFF, 0x609EC3FF, 0x5D9AB9FF, 0x5D8FA6FF, 0xD4F5FFFF, 0x8C001748,
+0x3A3C0204, 0x0004A403, 0x04030254, 0x36CF0000, 0x12000B03, 0x005738FF, 0x040005E5, 0x037C0000,
+0x0F003003, 0x002A0277, 0xE9510504, 0x46738AFF, 0xC40096E8, 0x6F9862C8, 0x739EFF30, 0x4000643C,
+0x09F40064, 0x0004F400, 0x0400141C, 0x0A0C0000, 0xC8371C00, 0xFF367AA7, 0xFF3579A6, 0xFF367BA5,
+0x04040500, 0x7CA93105, 0x00050038, 0x04000350, 0x05080400, 0x09050000, 0x80120004, 0x00013F60,
+0x04811005, 0x0004040A, 0x020A1400, 0x0801191C, 0x38852105, 0x08005F4C, 0x0004000A, 0x025A5006,
+0x08043740, 0x0A0C010A, 0x0B04F400, 0x00000004, 0x00040005, 0x00094400, 0x0C000004, 0x1E480000,
+0x2240BD10, 0x2C488B10, 0x001E1802, 0x38003134, 0x4EF40005, 0x29678CB3, 0x2E6180FF, 0x527589FF,
+0x7C0409FC, 0x02750001, 0x00017900, 0x0C0309E0, 0x01A90000, 0x00001F03, 0x280001D4, 0x5DEC0004,
+0x010BE600, 0x1C005794, 0x00240000, 0x00002F03, 0x0401003E, 0x06D30000, 0xF0001401, 0xDBFFF904,
+0x7DFFBBD4, 0x99FF2D63, 0xADFF2872, 0xC0FF2D7E, 0xF0000F94, 0x05D80009, 0x10000400, 0x114AA086,
+0x0014143F, 0xB3330500, 0x5B583689, 0x00010402, 0x00000118, 0x0B400005, 0x21013401, 0x56883A84,
+0x0209E400, 0x70000004, 0x05000015, 0xF0000407, 0xFF3C8000, 0xFF3478A5, 0xFF3E83AA, 0xFF3C81A8,
+0xDC000A08, 0x6B93405B, 0x2B24FF31, 0x34576D71, 0xC5D9E4FF, 0xBC0018F8, 0x03600263, 0x03D99900,
+0xBC010C6D, 0x00CA0100, 0xFF00050F, 0x17F80063, 0x01025700, 0x2D01017D, 0x000E0009, 0xD4FFF3D1,
+0xB1FF95BE, 0xBFFF5C93, 0x048C679D, 0x5B7C08F5, 0x5C7CFF2E, 0x5E81FF31, 0x5D7EFF32, 0x617DFF30,
+0x5B77FF38, 0x00050032, 0x802A1918, 0x0809FC62, 0x08000500, 0x1908020A, 0x00501802, 0x0C000A00,
+0x0A00040F, 0x014AF800, 0x6A21AA2C, 0x01BE3032, 0x6910AA30, 0x38113210, 0x00F3280C, 0xFF39779C,
+0xFF6AA6C8, 0xFF5E94B0, 0x34729BB1, 0xC7FC005D, 0x0231BC00, 0x500109C0, 0x0250000C, 0x0109DC00,
+0x0D03205C, 0x026B0300, 0x0000DA00, 0xEC010004, 0x00050F00, 0x03950032, 0xF058BC00, 0x95FFEB0D,
+0x85FF567F, 0x93FF3166, 0x9AFF336F, 0xA3FF3172, 0x9FFF357A, 0xA2FF3176, 0x15000878, 0x00504037,
+0xA44009FC, 0x04FF357A, 0x79A36000, 0x7BA4FF34, 0x24066930, 0x0F08083C, 0x000A0C00, 0x040804FC,
+0x05080400, 0x00282400, 0x00000004, 0x0004000A, 0x00050004, 0xF8000A04, 0x08AC020D, 0x0103C002,
+0x900303CC, 0x5F500044, 0x01000400, 0x540F03EC, 0x04000450, 0x00040405, 0x080EC800, 0xF4000004,
+0x00040904, 0x001E3403, 0x04004028, 0x1400000A, 0xF1682800, 0x3077A300, 0x2B678CFF, 0x2E5C76FF,
+0xAECBDBFF, 0x28022EC0, 0x019400A2, 0x00040F00, 0x000201B8, 0x01940105, 0x04000500, 0xEA010004,
+0x09FC006A, 0x02000400, 0xF8010A00, 0x003B0109, 0x00000500, 0xC1080004, 0x0A540001, 0x98FFEEE2,
+0x92FF5E88, 0xA2FF3673, 0xE8FF2F7A, 0xFF36510F, 0xE43788B7, 0x05E00204, 0x00050002, 0x04000A04,
+0x0604001E, 0x002CBC00, 0x10000004, 0x1DD00001, 0x3785B371, 0x3586B3FF, 0xC4004FC0, 0x85B0604F,
+0x85B0FF34, 0x040018E0, 0x98381200, 0x3C803133, 0x610B80FF, 0xB2FF3D80, 0x0B9C4082, 0xF480A920,
+0xFF372009, 0xA7E00194, 0x85FF3C7D, 0x80FF275E, 0x6FFF3461, 0x00ACB45D, 0x5C000D50, 0x00B80030,
+0x2505B100, 0x75C0FFFC, 0x08001300, 0x0C0F00CB, 0x0059FF00, 0x9400026F, 0x00080006, 0x04FCFF10,
+0x00018C00, 0xFF520008, 0x8DA8FFF1, 0xB48076A0, 0x7BFF5D8F, 0xF4FF2C58, 0x5C793122, 0x0027F830,
+0xFC0027FC, 0x5D792013, 0x00021908, 0x0500000A, 0x0C000400, 0x08000A04, 0x04FC0046, 0x04000400,
+0x14000500, 0x0500043C, 0x24658924, 0x40331164, 0x6A8B319B, 0xB18C3C32, 0xFF38698A, 0xFF3A688A,
+0x2C3B6D90, 0x8903F0E1, 0xADFF2965, 0xBEFF4D89, 0xAAFF67A0, 0xC7FF5F8E, 0x305D38AF, 0x34FFFFEE,
+0x00B8007A, 0x4944FF12, 0x000D2404, 0x3E0214D8, 0x001D0003, 0x0009F007, 0x640F000F, 0x4D003602,
+0x12CC0000, 0x9161C000, 0x8A9FFFEB, 0x6B88FF64, 0x31412C38, 0xE42E7299, 0x5F4C0004, 0xA875A020,
+0xFF3820FA, 0x00003220, 0x05140005, 0x3479A231, 0xB8006E28, 0x000400FA, 0x001E1400, 0x00000004,
+0x00040005, 0x0004FC00, 0x08000004, 0x0004000A, 0x04050404, 0x1C000500, 0x0004001E, 0x0804FC00,
+0x00000004, 0x00040005, 0x00141C00, 0xFC010504, 0x08C80004, 0x000A0003, 0x040004FC, 0x03F00000,
+0x00000408, 0x04000DFC, 0x04280200, 0x000F1006, 0x000C0508, 0x1D4C0005, 0x00000400, 0x74000464,
+0x04B8103C, 0x38882105, 0x20001428, 0xB600F36D, 0x97FF4089, 0x90FF286D, 0x72FF336E, 0x42C0375D,
+0x0024B800, 0x04000130, 0x99DC0300, 0x032F7C00, 0xE001069C, 0x02890004, 0x00001F01, 0xBE000518,
+0x00040001, 0x0206DC02, 0x1D0001B3, 0x06740000, 0x02000400, 0xEC020012, 0xFFF29136, 0xFFD5F8FF,
+0x742F6581, 0x7BA6401D, 0x0088FF32, 0x0500A000, 0x8730652C, 0x04F8FF3D, 0x004FA400, 0xE4010004,
+0x39862113, 0x000031BC, 0x09F40005, 0x02050008, 0xFC0004F8, 0x00040004, 0x0004FC00, 0x00060004,
+0x13EC0005, 0x3D80AB60, 0x007BABFF, 0x63DC0019, 0xA9FF3A51, 0x6DE03981, 0xA0B6F800, 0xFF2B6185,
+0xFF29526E, 0x4AE8B1BF, 0x00395C00, 0x4C0236F0, 0x029C0085, 0x0019B401, 0xC70300CF, 0x00070F00,
+0x880062FF, 0x63DE0001, 0x01116A00, 0x94000280, 0xFB0FF11F, 0xD6ECFFF8, 0x88AAFFBD, 0x9AC1FF4C,
+0x719AFF56, 0x567AFF44, 0x5D7AFF30, 0x5C75FF36, 0x31AEE030, 0xFC305E7F, 0x04801022, 0x335E6119,
+0x325F7EFF, 0x08000F04, 0x00040014, 0x0806F800, 0x08000508, 0x4114001E, 0x02461C00, 0x1C020504,
+0x4118005F, 0x000A0400, 0x8B67050C, 0x8CFF3266, 0x61B42C68, 0x8AFF3A68, 0x64483B69, 0x3C719340,
+0x001E0CFF, 0xB8E04440, 0xBAFF5894, 0xAAFF6199, 0xDAFF598A, 0x00344CC4, 0x45000980, 0x14F411B2,
+0x03430014, 0x702CF913, 0x003C2400, 0xE50100E4, 0x00E10218, 0x070EF503, 0x790F0510, 0xC5002E02,
+0x03900002, 0xA007D800, 0x93A6FFF1, 0x6886FF6D, 0x31FCFF31, 0x3279A540, 0x40A0C0FF, 0xFF3776A1,
+0xA2310004, 0x5A303877, 0x000F1000, 0x9E311414, 0x5F48397B, 0x04372800, 0x04000004, 0x19100405,
+0x03050801, 0x1004231C, 0x0008001E, 0x0404F800, 0x1C000004, 0x05000819, 0x01000C00, 0x38030A0C,
+0x0DB80237, 0x010F0806, 0x8521140C, 0x00140C3B, 0x040F4EBC, 0x08000105, 0x13100005, 0x00000400,
+0x04090500, 0x0E500000, 0x21000404, 0x134C3B87, 0x0009F000, 0xFC00191C, 0x0034000E, 0x357CA862,
+0x10719BFF, 0xA7B7336B, 0x0010AC8A, 0x2C000120, 0x00040001, 0x0171EB01, 0x16007554, 0x00040000,
+0x00077701, 0xBC00001B, 0x2C1C000B, 0x00A1E601, 0xA1040508, 0x001D0001, 0x00016804, 0x18080008,
+0xFFF05100, 0x8C83B2D0, 0x78A54042, 0x1A1CFF35, 0x4087B531, 0xE8000EE8, 0x00040009, 0x4013F400,
+0xFF3D85B5, 0xB74004FC, 0xB8FF3C83, 0x83B3403B, 0x0EF0FF3B, 0x00000404, 0xBC000504, 0x00040036,
+0x01013804, 0x842159C0, 0x002E7C39, 0xAB400658, 0x04FF3982, 0x81AA4000, 0x5BC0FF38, 0xF136E400,
+0x337AA804, 0x347FA9FF, 0x367FA8FF, 0x3C82A6FF, 0x205F80FF, 0x5D332D7C, 0x18F82347, 0x000FC600,
+0x540200B4, 0x050A008E, 0x0002A800, 0xC6040004, 0x00080F00, 0x1C0062FF, 0x11640004, 0x00076601,
+0xFD10025F, 0xF091028A, 0x7097B6FF, 0x5195BAFF, 0x81B17ABC, 0x7DFF2D5A, 0x79FF3559, 0x0500355C,
+0x31607C71, 0x305F7DFF, 0x81531904, 0x7EFF345F, 0x040C0500, 0x05000805, 0x040F0800, 0x08060500,
+0x0504070A, 0x44346621, 0x78280069, 0x00320C00, 0xFC002318, 0x698B4009, 0x0A08FF3B, 0x00052000,
+0x1C00FF1C, 0x3F480069, 0x99BE04F1, 0x90B4FF5B, 0x8AA8FF54, 0xCCDEFF59, 0xFCFFFFAF, 0x000D60EA,
+0xD4005FC2, 0x00F71000, 0x7A340305, 0x00026402, 0x800200DD, 0x050C0502, 0x0F036803, 0x002F0278,
+0xFC11CD64, 0xB4004690, 0xFFFF8012, 0x9EB2FFEC, 0x0AC8FF75, 0x32783800, 0x2C3A7AA6, 0x34772141,
+0x2001412C, 0x39792123, 0x9B403514, 0x08FF3878, 0x14240005, 0x00000400, 0x00000504, 0x00040005,
+0x0004FC00, 0x14010004, 0x05040023, 0x081E180B, 0x04000500, 0x00040005, 0x0404FC00, 0xAC000004,
+0x00040003, 0x000A0800, 0x040017A8, 0x03D40000, 0x000A1004, 0x04000A04, 0x05000800, 0x00000C00,
+0x040804FC, 0x0A100000, 0x01000404, 0xFC040508, 0x40881004, 0x05000219, 0x00770800, 0x040204FC,
+0xFF3C6005, 0xFF2B729E, 0x78714C24, 0xFFFF2D5C, 0x17FCE1F7, 0x0013D400, 0xBC0204CE, 0x0ED40229,
+0x0072EC00, 0xA4000272, 0x00040C01, 0x02001804, 0xC00401A0, 0x00160001, 0x00000400, 0x1A0201CC,
+0x01740200, 0xFFED06F1, 0xFF3D749B, 0xFF3B83B5, 0xFF367CAD, 0xFF4488B9, 0x784588B5, 0x00D4006D,
+0x025E9000, 0x3C2005F8, 0x0004FCFF, 0xB4000004, 0x05000845, 0x0004FC00, 0xB2400004, 0x04FF3A82,
+0x22D00000, 0x00000400, 0x50005EBC, 0x01580406, 0x01000800, 0x806127E4, 0x7FAAFF37, 0x7122FC36,
+0xFF3882B1, 0xFC3380AC, 0x9A00F24F, 0x73FF3079, 0x5CFF1757, 0x84FF1342, 0x19F45572, 0x0200AB01,
+0xA00000B8, 0x0D740002, 0x11087800, 0x010370F8, 0x050F001D, 0x0065FF00, 0xFC250292, 0x000A00FF,
+0xEFB072DC, 0x81A9FFC8, 0x94BCFF46, 0x2EC0FF4C, 0x27577BB1, 0x345B7CFF, 0x335C7AFF, 0xF8006320,
+0x5D7AD02B, 0x5D80FF30, 0x5D80FF31, 0x0080FF32, 0x00040305, 0x0C5F7F23, 0x3360210F, 0x080410FC,
+0x0500010A, 0x18356321, 0x0A0C093C, 0xFF356652, 0x05086786, 0x0004E400, 0x10002D1C, 0x0500002D,
+0x38688C31, 0x340004FC, 0x5A18003C, 0x400A1C00, 0xFF2D678C, 0x03F07320, 0xFF307096, 0xFF5899C1,
+0xFF5191B5, 0xFF4C85A3, 0x321CCDE3, 0x0690B400, 0x230022AC, 0x19000028, 0x010F1001, 0x340009FC,
+0x00040003, 0x02034C00, 0x74000D54, 0x02790F03, 0x197C022D, 0x04005800, 0xE8003734, 0xF106F102,
+0x83A7BDFF, 0x3A6F91FF, 0x3578A3FF, 0x337CA9FF, 0x347BA5FF, 0xBC006438, 0x789B80E6, 0x789CFF39,
+0x0008FF3C, 0x0C7DE400, 0x08020504, 0x503C0005, 0x004B4002, 0x080F0A10, 0xA0001505, 0x00040503,
+0x004B4403, 0x080221A0, 0x19140205, 0x04050800, 0xC8040004, 0x050C002B, 0x02000400, 0x39110430,
+0x08005564, 0x00100005, 0x04000800, 0x04010004, 0x28340305, 0x0009EC00, 0x48000958, 0x85B5310A,
+0x801E1837, 0xFF3886B6, 0xFF2E75A1, 0xA2208DD4, 0x025DE489, 0x6A000198, 0x067C0102, 0x0215A501,
+0x50000500, 0x0184007A, 0x00000408, 0x0404013E, 0x00180000, 0x0001A002, 0x640001B4, 0x001A0401,
+0x01004E02, 0xFD61001C, 0xD8F0FFF3, 0x310B60BA, 0xE03784B8, 0x83B4B304, 0x86B3FF3D, 0x86B0FF43,
+0x1519F441, 0x403D2438, 0xFF3985B7, 0xF4000004, 0x05140009, 0x04061004, 0x34000110, 0x012C0110,
+0xD43A8121, 0x80AFB127, 0x7FAEFF3C, 0x7EADFF3B, 0x0000043A, 0x8000000C, 0x0010001A, 0x367FAC71,
+0x3280B0FF, 0x09F01464, 0xFF2A7BA8, 0xFF25749B, 0xFF05506F, 0xFF04425B, 0xFF0E394C, 0xFFC2DAE6,
+0xC8001EF0, 0x02280100, 0x0370C800, 0x00000FF0, 0x00040005, 0x0F00C401, 0x67FF0005, 0x02024800,
+0x830108C0, 0xFE0BF101, 0xAACFFFEC, 0x78A6FF6E, 0x88B0FF2A, 0x678AFF3D, 0x6181FF25, 0x5D7CFF2C,
+0x0018F430, 0xD00009E4, 0x5D777116, 0x6183FF2F, 0x00231033, 0xF8012D00, 0x04FC0004, 0x07000400,
+0x000F04FC, 0x20000605, 0x6E280041, 0xFF356661, 0x3C366787, 0x6788221D, 0x00002D14, 0x00040005,
+0x002D1800, 0x14000508, 0x00080005, 0xEB288F10, 0xFF366E30, 0xCC000A04, 0x9E04F24D, 0xBEFF3377,
+0xBBFF5098, 0x9EFF4D95, 0xCFFF4580, 0x0C6CA0C0, 0x005C5000, 0x7501032F, 0x026D0302, 0x01001000,
+0x440005E6, 0x04FC0403, 0x0100FC02, 0x050F00F8, 0x59002600, 0x0F4C0000, 0x000CE003, 0x130103DC,
+0x00100000, 0x14A4F011, 0x005ACC00, 0x300004FC, 0x7DA5310D, 0x005F4835, 0xD0006958, 0x789D3219,
+0x0082403A, 0x04072320, 0x05000F00, 0x0A0C0001, 0x00000400, 0x04041414, 0x0F0C0800, 0x000A0000,
+0xFC050004, 0x1E180304, 0x0604FC00, 0xB8040A08, 0x2D34021C, 0x0103F400, 0x1C030400, 0x050C0019,
+0x00130400, 0x040C04F4, 0x05000400, 0x040A0C00, 0x00000504, 0x05340005, 0x00826800, 0x2800000C,
+0x7CAD3114, 0x001D102E, 0xEA319CFC, 0x09FCB6D7, 0x049C5C02, 0xE80063A9, 0xFCFD1176, 0x0500000E,
+0x00017B02, 0x98040135, 0x09D20201, 0x0004EA00, 0x200601C3, 0x01BC0000, 0x03000400, 0x0701002C,
+0x00100000, 0xABFFF051, 0x8984668F, 0x3787BC80, 0x3A86B8FF, 0x0009DCFF, 0x74008494, 0x00A0007C,
+0x01639000, 0x86210008, 0x006D9C39, 0xEC0005A4, 0x4FAC0000, 0x00010400, 0x20000004, 0x04F8010B,
+0xF8398225, 0x04FC0004, 0x71000400, 0xFF3B7FB0, 0x04387EAF, 0x3BDC0000, 0x81B018F3, 0x82B0FF37,
+0x82B1FF35, 0x79A8FF31, 0x6B9AFF25, 0x6B99FF15, 0x668CFF17, 0x4764FF14, 0x4459FF00, 0x4757FF06,
+0x02029022, 0xFC017B3C, 0x25840005, 0x00126400, 0xB00314F8, 0x00E0024B, 0xFF00060F, 0x03B8006D,
+0xF030D800, 0xFFE6FF14, 0xFF1B6C97, 0xFF1E7EB0, 0xFF29749B, 0xFF094867, 0xFF17506D, 0xFF205370,
+0xFF2A587A, 0xFF305E80, 0x04000F00, 0x5F807200, 0x5E7FFF2E, 0x212D0C2D, 0x0008325F, 0x003C1002,
+0x04063210, 0x62834200, 0x0004FF35, 0x03502003, 0x86314620, 0x8C283664, 0x00141400, 0x1C010004,
+0x3466212D, 0x0800822C, 0x6408000F, 0x00000400, 0x24006E1C, 0x5F200046, 0x00000800, 0x0CF3281C,
+0xFF306C91, 0xFF2E6F95, 0xFF2D7299, 0xFF4C96BD, 0xFF4C90B5, 0xFF48819F, 0x2491B7CE, 0x0318003C,
+0x002D2403, 0xEC030345, 0x0354000E, 0x0459F002, 0x450104FC, 0x027D0F03, 0x00400028, 0x00000400,
+0x04000070, 0x000C0000, 0x00004F04, 0xF1600010, 0x8EB6CFFF, 0x00FFCCFF, 0x280086DC, 0x2B200030,
+0x000F1800, 0x0C000EF0, 0x00040023, 0x002D2C04, 0x18002B34, 0x05000000, 0x00000804, 0x4C02232C,
+0x5038117D, 0x0A080869, 0x00050800, 0x04000504, 0x0F100000, 0x041C7C00, 0x08000004, 0x05100D05,
+0x00323C03, 0x04010510, 0x08831B00, 0x3A842505, 0x1C000928, 0x4B500009, 0x04051000, 0x140F0004,
+0x00000105, 0x00200119, 0xE5630400, 0xAFFF3E88, 0xA4FF2E7B, 0x82FF3477, 0x2EAC3B67, 0x02018300,
+0x20000400, 0x00040001, 0x0204EC06, 0x2C000018, 0x01940001, 0x00001803, 0x040001B0, 0x014B0300,
+0x00592802, 0x20020038, 0x1D3C005F, 0x00143001, 0xF5B00CB0, 0x7A9CFFD6, 0x86B1FF45, 0x5AC8FF3D,
+0x1DBCB511, 0xB4FF3770, 0xABFF3F8A, 0x871200E0, 0xB1806D8C, 0xB2FF3786, 0xA8FF3684, 0x1DE4000A,
+0x20689C00, 0x7E7886AD, 0x6DA43612, 0xDC3A8321, 0x04F0011D, 0x3D8137F1, 0x3E80B2FF, 0x3D7FB1FF,
+0x3A7EAFFF, 0x3880B2FF, 0x3682B3FF, 0x3384B3FF, 0x2C83B0FF, 0x217CA8FF, 0x14739FFF, 0x0D6E9BFF,
+0x096999FF, 0x11709EFF, 0x166F9BFF, 0x085C80FF, 0x004C66FF, 0x013C4EFF, 0x8DABB5FF, 0x7B0105FC,
+0x00BB000C, 0x0300CC01, 0xDC030009, 0x01180200, 0x0F001901, 0x68FF0005, 0x01019300, 0x17F04390,
+0xC4D9FFF1, 0x75A1FF91, 0x83B3FF16, 0x6185FF1A, 0x4E6AFF15, 0x4D67FF11, 0x4D68FF11, 0x4B6CFF14,
+0x4E6FFF19, 0x52C4FF1D, 0x27587660, 0x045E7FFF, 0xFF2FA04B, 0xFF2F5D7E, 0xFF315F80, 0xF4020A08,
+0x10341313, 0x0008023C, 0x07001806, 0x04005524, 0x00040305, 0x000A0001, 0x28000A04, 0x642000A5,
+0x218C2000, 0x5F043367, 0x01874C00, 0x30032800, 0xC3440291, 0x00CD3C00, 0x31609630, 0x2F6F95FF,
+0x313EE0FF, 0xE44D92BC, 0x7FA46043, 0xB0CBFF45, 0x74006430, 0x1D94000D, 0x0C80F811, 0x40025D00,
+0xFFFEFAF9, 0x0400EBAC, 0x46E40105, 0x84FCFE2F, 0xDC024A34, 0x21980002, 0xDFFFED51, 0x92209DC7,
+0x3F84AE40, 0x002718FF, 0x9C31049C, 0x27FC2B6F, 0x0013EC00, 0xF4000510, 0x05080004, 0x00050400,
+0x40004B40, 0x05040019, 0x00050000, 0x04000004, 0x0004000F, 0x0505000F, 0x00050404, 0x04000508,
+0x04FC0000, 0x00000400, 0x0408006C, 0x04F80100, 0x00191C03, 0xF000000C, 0x0900000D, 0x01000404,
+0x30000A10, 0x050C031E, 0x3004DC01, 0x08FF3885, 0x05000C00, 0x00001000, 0x04000450, 0x8CAC0005,
+0xA20E1001, 0x9CFF347D, 0xCEFF3271, 0x4FE894B8, 0x000B7801, 0x69000182, 0x04E80002, 0x08000C00,
+0x18040004, 0x00080000, 0x001A9F02, 0x040004DC, 0x043C0100, 0x10001300, 0x006AA4FE, 0x6C001E34,
+0x0011000B, 0x20FFFF22, 0xFFF3605A, 0xFF8EB7D3, 0xC4009D7C, 0x89B4318C, 0x0022BC38, 0xDC001DBC,
+0x88B25009, 0x44B0FF3D, 0x34871288, 0x729C0065, 0x00D8B510, 0xFF3784A1, 0xFF3483AC, 0x683482A9,
+0x24300088, 0x300B2801, 0xA4FF3780, 0x09E40077, 0x3113D400, 0x303581B2, 0xB024F505, 0xA7FF2E80,
+0xA1FF2179, 0x9CFF1672, 0x9AFF0E6F, 0x99FF086F, 0x9BFF056F, 0xA1FF046F, 0x9CFF0972, 0x9EFF0D6F,
+0x6BFF1875, 0x64FF0049, 0x50FF014B, 0xC5AC0B40, 0x0300C401, 0xF60500DB, 0x00100000, 0x05050403,
+0x090F0014, 0x0166FF00, 0xC80003A9, 0xE318F02B, 0x3A7D97FF, 0x0E739FFF, 0x147BA8FF, 0x045070FF,
+0x114F68FF, 0x15536CFF, 0x14506AFF, 0x164B6BFF, 0x184A6BFF, 0x05086EFF, 0x1A4F05F1, 0x1C5170FF,
+0x1E5372FF, 0x2E5F7FFF, 0x2F6081FF, 0x050481FF, 0x0A242F11, 0x000A1C00, 0x82500010, 0x85FF3061,
+0x64210EEC, 0x00692833, 0x0400230C, 0x19040400, 0x0009F400, 0x04001918, 0x0A040200, 0x73303411,
+0x000A0000, 0x040004FC, 0x9B340050, 0x000A0800, 0x5000A544, 0x050400AF, 0x366B8B31, 0x2C009634,
+0x2A68007D, 0x709C03F0, 0x8DBBFF33, 0x8AB8FF46, 0x7FA9FF43, 0xA9C8FF3E, 0x34009850, 0x503400A5,
+0x12207C00, 0x0F0867F9, 0x043D0C78, 0xCC0002C8, 0x00040002, 0x010F6F03, 0xF9010153, 0x056E0002,
+0xA0008000, 0xD1E9FFF0, 0x7398FFAD, 0x0860FF3F, 0xC02C4000, 0xFF3F89B8, 0xFF2A739E, 0xFF2E739C,
+0x4C01AFE8, 0x35792287, 0x7D211CC4, 0x0055543C, 0x18007864, 0x00040005, 0x11050402, 0x010A043A,
+0x50000508, 0x00040791, 0x0F050000, 0x00010004, 0x040112AC, 0x0F100300, 0x0517CC00, 0x08070004,
+0x050C0005, 0x02040800, 0x44000510, 0x142C022D, 0x00051008, 0x3800000C, 0x00040513, 0x30284000,
+0x14FF3684, 0x0500000F, 0x00239C00, 0xCC001D7C, 0xF9FF32EC, 0x0140ECDE, 0xDD000108, 0x012D0003,
+0x0405000C, 0x18000014, 0x000C0000, 0x0104DC02, 0x0F000033, 0x04EF0000, 0x000E3003, 0x87010510,
+0x00180047, 0x00004F00, 0xFFB010E8, 0x8AABFFED, 0x8FB9FF58, 0x96FCFF4C, 0x3A85AD40, 0x0009E8FF,
+0xAE3118F0, 0x09D83582, 0x00009800, 0xF80031BC, 0x82B45004, 0xB4B4FF3A, 0x3B813027, 0x000018FF,
+0xAD400004, 0x04FF387F, 0x0F000000, 0xF105E401, 0xFF35880B, 0xFF3087B4, 0xFF2681AD, 0xFF1D7CA8,
+0xFF0F729C, 0xFF0A719C, 0xF006709A, 0x9C04F104, 0x9EFF0570, 0xA0FF0772, 0xA2FF0875, 0xA1FF0874,
+0x05100773, 0x658B00F2, 0x516FFF07, 0x475FFF00, 0x7D8AFF05, 0x010EFC4F, 0xC5000D58, 0x00B10100,
+0x00000506, 0x040400C4, 0x00160600, 0xFF000A0F, 0x01880064, 0xF1FF1FF1, 0xB6EAFFFF, 0x186987FF,
+0x13769FFF, 0x0C6C96FF, 0x085171FF, 0x14526BFF, 0x125069FF, 0x14506CFF, 0x164F6DFF, 0x174D6FFF,
+0x174D71FF, 0x6B400008, 0x04FF164D, 0x47673100, 0xD00A1C12, 0xFF215374, 0xFF295B7C, 0xFF2D5F80,
+0x21731483, 0x87103264, 0x00961400, 0x1C000010, 0x0004009B, 0x32648540, 0x000004FF, 0x04002804,
+0x18E00000, 0x140A0400, 0x21190C86, 0x1E0C3267, 0x34050001, 0x00FF3268, 0x04F80005, 0x30050001,
+0x00FF386B, 0xAF180005, 0x6A9104F1, 0x6D95FF36, 0x6490FF39, 0x6E9EFF2E, 0x8EBFFF2C, 0x002AF844,
+0xB8209364, 0x000504A3, 0x04031E18, 0x190D0005, 0x00F59C00, 0xFE300363, 0x5AF4FFFE, 0x0F0A1000,
+0x002A0275, 0x7C0004F4, 0x1E6C0335, 0x0004EE00, 0xE40004FC, 0x1CF0001B, 0x02000400, 0x08000DD6,
+0xFFEED10A, 0xFFB3D6F2, 0xFF38729A, 0x9C3D84B2, 0x88B37121, 0x77A0FF3F, 0x00191832, 0x58002804,
+0x09F4007D, 0x000F1400, 0x0401282C, 0x38792100, 0x00002324, 0x00040005, 0x0004FC00, 0x28040004,
+0x0F040032, 0x0C000408, 0x94000504, 0x00040004, 0x000A0408, 0x040F000C, 0x04050505, 0x38822113,
+0xF40035E8, 0x00040804, 0x001D2400, 0x04040004, 0x134C0005, 0x000E1C00, 0xE0004568, 0xC500000A,
+0xA097B520, 0x95D002E7, 0x00067902, 0x69000166, 0x00040002, 0x00000C00, 0x0C000004, 0x00040000,
+0x0004FC04, 0x9D00000C, 0x00040701, 0x03000B00, 0xE80068D8, 0x3D800181, 0x00016500, 0xFFE129F4,
+0xD7E9FFF5, 0x87ACFFB8, 0x95C2FF4F, 0x315EE051, 0xF03D87AE, 0x22F00018, 0x0014B000, 0xD0000AD4,
+0x05D40000, 0x3154A400, 0x003B82B6, 0x80B13105, 0x0063983A, 0x14000524, 0xB424F50F, 0xB4FF3687,
+0xABFF3286, 0xA0FF267F, 0x99FF1774, 0x97FF0C6F, 0x9BFF076E, 0x9DFF0671, 0x9CFF0774, 0x9DFF0474,
+0x9CFF0372, 0x9EFF0271, 0x9FFF0470, 0x00040671, 0x74A30BF0, 0x749FFF08, 0x587DFF0D, 0x526EFF00,
+0x4357FF05, 0xE2EBFF0A, 0xFEFFFFBD, 0xE8082F9C, 0x000C0000, 0x00000407, 0x040400EF, 0x00170700,
+0xFF000B0F, 0x03C1005C, 0xF12A9800, 0xB0FFEA0E, 0x8DFF5096, 0x99FF106A, 0x7AFF1A74, 0x6AFF0355,
+0x6AFF0A4D, 0x6AFF124E, 0x0004144D, 0x4E6C14F1, 0x4D6EFF15, 0x4D72FF15, 0x4E71FF15, 0x516DFF16,
+0x536FFF15, 0x5371FF17, 0x5172FF1A, 0x4F70FF19, 0x80002017, 0xFF164E6F, 0xFF1A5273, 0x7D7166EC,
+0x88FF255B, 0x00043066, 0x44A50C00, 0xFF2E6385, 0x86400004, 0x14FF2F64, 0x8C2C0000, 0x71051000,
+0xFF326584, 0x44306682, 0x67873131, 0x019B3432, 0x3C040EFC, 0x366B219B, 0x891004F8, 0x6A105F30,
+0x37A03C1C, 0x386991FF, 0x376891FF, 0xF0E134FF, 0x38719C07, 0x30719BFF, 0x418AB5FF, 0x3B85ACFF,
+0x397DA0FF, 0x589AB5FF, 0x4B340099, 0x000AE000, 0x28000484, 0x1788003C, 0x00126802, 0xB000034B,
+0x02740F04, 0x013F0026, 0x07000400, 0xF0020500, 0x03D40203, 0x02005C00, 0xE9006790, 0x0A080002,
+0xFCFFEED1, 0x9CFFC0E4, 0xABFF497B, 0x9E444382, 0x4489B371, 0x30759EFF, 0xD8000508, 0x3C380004,
+0x04FFE800, 0x04010F00, 0x0C781205, 0x0500001E, 0x000F3000, 0x2C000004, 0x00040000, 0x005A4400,
+0x18080004, 0x0504080F, 0x000F0C00, 0x04000004, 0x00040005, 0x310A0C01, 0x08FF3B7F, 0x64680000,
+0x000A040B, 0x04080A08, 0x043C0000, 0x00000408, 0x0404094C, 0x05080100, 0x210E6000, 0x40383784,
+0x002C1000, 0xF52029AC, 0x0067E0DF, 0xF8002998, 0x015E0F00, 0x001C0005, 0x00000408, 0x410704ED,
+0x001B000B, 0x020A0901, 0x00002734, 0x569F0005, 0x00001301, 0x08F013F8, 0xB4FFEBFF, 0xB9FF759E,
+0xC5FF5993, 0xABFF5598, 0xADFF3E81, 0xB4FF3C83, 0x81B2900E, 0x82B4FF33, 0xA8B2FF36, 0x39832118,
+0x10F15994, 0xFF3583B4, 0xFF3481B5, 0xFF3780B3, 0xFF3581B3, 0xFF3482B3, 0xFF2F85B4, 0xFF1F7EAC,
+0xC41277A3, 0x9800F509, 0x9CFF046E, 0x9FFF0772, 0x9EFF0976, 0x04F40875, 0xF104F802, 0x9FFF0518,
+0xA0FF0770, 0xA1FF0A70, 0xA2FF0C70, 0xA2FF0D71, 0x9CFF0C72, 0x97FF046D, 0x7BFF086D, 0x68FF0057,
+0x69FF084E, 0x7C00E8A0, 0xFFFB220C, 0x000001FC, 0x00CD0001, 0x02000402, 0xEC03071C, 0x00130200,
+0x0F002100, 0x65FF0004, 0x0003A800, 0x0EF102A8, 0x6283FFDE, 0x7399FF12, 0x6D8FFF13, 0x4F6FFF1A,
+0x4E6DFF08, 0x4F6CFF11, 0x4F6DFF16, 0xE0000418, 0xFF15506E, 0xFF134E6E, 0xFF124C71, 0x001C4C6E,
+0x6DFF1251, 0x00281451, 0x13506FB1, 0x155271FF, 0x165372FF, 0x0C000004, 0x66740000, 0x4F6F09F0,
+0x4D6DFF14, 0x5373FF12, 0x5B7CFF18, 0x6283FF23, 0x6788FF2A, 0x45E8FF2F, 0x405EF401, 0x8BFF3167,
+0x6412962C, 0x839004F8, 0x82FF3167, 0x85FF3268, 0x3801D234, 0xFF3542A0, 0xAA3C668B, 0x21462001,
+0xD254346B, 0x20282400, 0x05006890, 0x96FF3991, 0x8CFF3C6D, 0x0A283165, 0xF02D2000, 0x2C709703,
+0x3B83ABFF, 0x3C87AFFF, 0x3C7B9EFF, 0x3492ACFF, 0x49780046, 0x400A0800, 0xFBFFFFF7, 0x96021414,
+0x3A580109, 0x2D027A0F, 0x07050000, 0x000603B7, 0x05640205, 0x000DB801, 0x80000005, 0x03B8010A,
+0xFFEE03F0, 0xFFC6E6FB, 0xFF4F80A0, 0xFF4F8BB0, 0xFF4D90BA, 0x1000A354, 0x37300032, 0x006E5400,
+0x040018F0, 0x0A0C0114, 0x32387712, 0x1104FC02, 0x014B3C39, 0x7A124640, 0x04008260, 0x00040005,
+0x0F1E1C01, 0x04002828, 0x4000050C, 0x05000032, 0x04000408, 0xFC000504, 0x00040012, 0x0404F808,
+0x4000000C, 0x00040009, 0x08050408, 0xAE20000C, 0x11366081, 0x0050583A, 0x9D3344F8, 0x18F85682,
+0x247BF812, 0x0A01600F, 0x04040107, 0x3500000B, 0x00040006, 0x00001000, 0xFF521D30, 0xFEF8FFFB,
+0x0401B5FC, 0x00180141, 0xFFFFF583, 0xA8FFD3F2, 0x21AB1C8E, 0x36785295, 0x10408C00, 0x216DA8B8,
+0x04EC3484, 0x84B414F1, 0x87B3FF36, 0x87B3FF34, 0x88B6FF33, 0x85B5FF30, 0x7EB1FF2D, 0x77A9FF28,
+0x6EA0FF1F, 0x6A9AFF14, 0x7104D40A, 0xFF0574A1, 0x040776A3, 0x000C0000, 0x739F0CF1, 0x729FFF02,
+0x749FFF03, 0x709BFF05, 0x719CFF01, 0x72A0FF04, 0x73A2FF07, 0x0004F80A, 0x9F710500, 0x9BFF0C6E,
+0x0504086D, 0x03668FD1, 0x075D80FF, 0x0A4A63FF, 0x14F8C6FF, 0x0009FC02, 0xFF0201F7, 0x00B50000,
+0x00027400, 0xC4002B6A, 0x0500078E, 0x0F002102, 0x65FF0006, 0xF1091400, 0xCEFFEF17, 0x83FF8CBD,
+0x96FF075F, 0x76FF0D6F, 0x68FF0C57, 0x6CFF0F4C, 0x6AFF144A, 0x6AFF154A, 0x6BFF184B, 0xE4FF174C,
+0x11507104, 0x144F71FF, 0xC004D8FF, 0x6DFF1151, 0x70FF1051, 0x72FF1152, 0x51A10004, 0x5273FF12,
+0x5374FF13, 0x40000414, 0xFF155173, 0x76B10004, 0x75FF1854, 0x73FF1753, 0x003C1651, 0x00000800,
+0x0FF0670C, 0xFF225A7D, 0xFF275F84, 0xFF30658D, 0xFF31678D, 0xFF326988, 0xFF346A84, 0xFF346A82,
+0x64406883, 0x24FF3620, 0x230C021E, 0xB4283411, 0x009DB800, 0x2C002C58, 0x09F8003C, 0x00FA5400,
+0x68002328, 0xF5440127, 0xFF367030, 0x90001E1C, 0xBE900054, 0x417FA660, 0x78779BFF, 0x3F80006B,
+0x000F0C00, 0xFB203988, 0x002190FF, 0x000F321C, 0xB6012E0A, 0x02DC0002, 0x04064800, 0x10000004,
+0x02E00200, 0x00030000, 0x9004B030, 0x41840132, 0xF10D1801, 0xFFFFF00A, 0x9FFFD3F0, 0xB2FF5884,
+0xC3FF4F8D, 0xB9FF5299, 0x9FFF4A8F, 0x13E03075, 0x00372000, 0xFC000A08, 0x5A4C00D7, 0x000A0400,
+0x04001404, 0x37400000, 0x08000400, 0x00000A04, 0x00040405, 0x30050805, 0x50FF397C, 0x0F1C005A,
+0x00050404, 0x080C0008, 0x0F0C0005, 0x0100040F, 0x000F2005, 0x0C006E84, 0x22180027, 0x0000040F,
+0x00053800, 0xFC00A3FC, 0x80AA752C, 0xC1D4FF3D, 0x0040EC9C, 0x230104C7, 0x00050001, 0x0006280D,
+0x04020015, 0x00280000, 0x01000400, 0x090009DC, 0x00040000, 0x00000D01, 0xF91165E8, 0x5200709A,
+0x57A30024, 0xB6FBFF20, 0xFFF0A001, 0xFF9AC0D5, 0xFF5E96B1, 0xDC00AFFC, 0x0588006D, 0x81B110F1,
+0x88BDFF33, 0x87BDFF37, 0x83B5FF34, 0x83B2FF30, 0x7CA7FF2D, 0x79A0FF1F, 0x739CFF16, 0x3113C40C,
+0xBC056E9D, 0xA200F50E, 0xA4FF0773, 0xA4FF0975, 0xA3FF0773, 0x00040672, 0xDC72A120, 0xFF02C00E,
+0xFF036F9E, 0xFF036F9D, 0x0030719F, 0x9DFF0530, 0x03F10F0C, 0x9DFF0770, 0x9EFF0770, 0x9FFF0A71,
+0x9DFF0C71, 0x000C0C71, 0x005C84E0, 0x045779FF, 0x104C64FF, 0xE0FFFFFF, 0x69DC0263, 0x0014B006,
+0x66000214, 0xFFFB202B, 0xCC00D4BE, 0x00DF0100, 0x02001700, 0x060F0103, 0x0041FF00, 0x0404015D,
+0x015F0700, 0x05001300, 0xFC00000F, 0xE605F209, 0x235F77FF, 0x136B8FFF, 0x0C688DFF, 0x094C69FF,
+0xEC4E69FF, 0x18F00018, 0x4C6B14F1, 0x4D6CFF19, 0x4E70FF16, 0x4F70FF12, 0x4F6EFF10, 0x506DFF12,
+0x506CFF13, 0x506CFF10, 0x5472FF0F, 0x31050013, 0x08105171, 0x05040800, 0x13050C00, 0x40051872,
+0xFF155475, 0x0400050C, 0x05100000, 0xF2000400, 0x1854780B, 0x175179FF, 0x1B557BFF, 0x215C7CFF,
+0x29627FFF, 0x2E6782FF, 0x346A85FF, 0x09E800E6, 0x0118FC00, 0x6B304118, 0x4620FF30, 0x316C8E31,
+0x9140B444, 0x04FF3569, 0x5040000A, 0x00412C00, 0x4000FA54, 0x6E91719B, 0x6C92FF36, 0x40F05032,
+0xFF3E79A3, 0x9B739870, 0x9AFF3E76, 0x85705880, 0x000A0800, 0xFF20028C, 0x002680FF, 0x0400036B,
+0x01130500, 0x00029905, 0xB4000129, 0x09C80207, 0x02002002, 0xE4020014, 0x00120209, 0x0213E400,
+0x98000004, 0x05040003, 0x03002400, 0xC8000500, 0x328C0035, 0x107FEA03, 0x018F9CF7, 0x900008D4,
+0xF402F10F, 0xD8F3FFFF, 0x5C8BA5FF, 0x5792B4FF, 0x5999BFFF, 0xA1600A0C, 0x9DFF3376, 0x02413871,
+0x0C047864, 0x190C0014, 0x000A1000, 0x040209FC, 0x78580600, 0x00414400, 0x08000510, 0x05000000,
+0x03141C01, 0x00000A0C, 0x00040405, 0x00050004, 0x04040504, 0x0A100F00, 0x192C0302, 0x00051804,
+0x040018D4, 0x31100000, 0x04000404, 0x20000A20, 0x8CB72231, 0x54009638, 0xC4AC02A9, 0x0000E000,
+0x0C007794, 0x00040001, 0x00011003, 0x2C031A80, 0x013E040B, 0x00000800, 0x04040180, 0x0A350100,
+0x00003301, 0x9E000005, 0x00F81134, 0x06B00005, 0x01019B01, 0x02F125A8, 0x98B2FFED, 0xA0C1FF6A,
+0xA3C9FF61, 0x7FAAFF5B, 0xE213C030, 0xFF2782B1, 0xFF1D79AC, 0xFF1671A6, 0x22A070A1, 0x3104F800,
+0xC408749B, 0x749E6013, 0x76A2FF03, 0x080009EC, 0x010CF100, 0x0073A2FF, 0x0674A5FF, 0x0670A2FF,
+0x056FA3FF, 0x0670A4FF, 0x0671A5FF, 0x04F4A2FF, 0x40050800, 0x73A1FF06, 0x040218E4, 0x18F80000,
+0x09709B31, 0x08F30F2C, 0xFF096E9A, 0xFF076E99, 0xFF036A97, 0xFF06638C, 0xFF0B5673, 0x805F92A5,
+0x01F90025, 0x0000E903, 0xB90100C7, 0x05CC0000, 0x00765E00, 0x10026766, 0x00170101, 0x0F010100,
+0x32FF0004, 0x00016800, 0x4C010004, 0x00090001, 0x04038C00, 0x84030004, 0x0007001A, 0x0012FF00,
+0x7D01026D, 0xF01CF001, 0xACE0F8FF, 0x0F5879FF, 0x0E6183FF, 0x105F80FF, 0x0D4A69FF, 0x154865FF,
+0x1C4F6EFF, 0x154867FF, 0x154C6AFF, 0x134E6CFF, 0x0EFC70FF, 0x2109FC00, 0x05001350, 0x124F6B40,
+0x770004FF, 0xFF11506F, 0x04125170, 0x0C141100, 0x09FC000F, 0x0C527420, 0x18131114, 0x5376B50A,
+0x5477FF14, 0x5578FF14, 0x00000415, 0x7A710010, 0x79FF1656, 0x001C1555, 0x547415F0, 0x5575FF13,
+0x5878FF14, 0x5B7EFF17, 0x5E81FF1C, 0x678AFF1F, 0x698CFF28, 0x6C8DFF2A, 0x6D8FFF2D, 0x1DF4FF31,
+0x00BE4400, 0x9240AA2C, 0x00FF376B, 0xB94C0005, 0x62191400, 0xFF356C8B, 0xE1506C8E, 0x22554000,
+0x04486C96, 0x004F7800, 0x8B20EB54, 0x007B7873, 0xF5200A08, 0x00C16CFF, 0xF9131254, 0x37013A68,
+0x41440001, 0x024EA001, 0xB0000138, 0x2FA40009, 0x0204DA00, 0x180211B8, 0x04F00000, 0x00014300,
+0x38040004, 0x05140200, 0x02017800, 0x06040012, 0x00240000, 0x02000408, 0x48000028, 0x00560000,
+0xFFF60AF1, 0xFFE1F8FF, 0xFF6E93A5, 0xFF6095B5, 0xFF5998C1, 0xFF5795C4, 0x043474A2, 0x77A12205,
+0xF8003234, 0x759C4009, 0x0504FF37, 0x40463400, 0xFF2D749E, 0x10000F10, 0x7AA16205, 0x7CA2FF35,
+0xA4314648, 0x4B4C347C, 0x012D6800, 0x7E304B54, 0x000CFF36, 0x20AF8000, 0xC4507EA8, 0xA7FF3642,
+0x0000047D, 0x0401050C, 0x3A7DD200, 0x3A7DAAFF, 0x3A7CACFF, 0xE87DADFF, 0x0F180030, 0xA2284805,
+0xABFF3B7F, 0xB3FF387C, 0x27103F81, 0xF03D7F21, 0x3B040044, 0x0009FC00, 0xC0B519CC, 0xABFF5295,
+0xBFFF4A8B, 0x04007BAB, 0x00015C00, 0x2C005658, 0x00040101, 0x0304FC00, 0x5400060C, 0x01080101,
+0x03012F00, 0x0E000004, 0x01280001, 0x00029701, 0x09010014, 0xC0780000, 0x30FFFB20, 0x001C0200,
+0xF1002600, 0xEFFFF216, 0xB8FFBADA, 0xCFFF6398, 0xB1FF5DA6, 0xA3FF2A85, 0x9DFF1075, 0xA2FF076D,
+0xA3FF0972, 0xA1FF0973, 0x00040771, 0x000EB400, 0xA0401DA0, 0x04FF0473, 0x0EDC0000, 0x0574A2B1,
+0x0474A2FF, 0x0575A3FF, 0x1800050C, 0x18D40000, 0x046EA0B1, 0x046EA2FF, 0x0570A4FF, 0x9F800A0C,
+0x9EFF0972, 0x08FF0A74, 0x05040000, 0x70A004F1, 0x6F9EFF06, 0x6F98FF06, 0x6E95FF0C, 0x6E98FF0C,
+0xF209FC0B, 0x016C9A00, 0x015F85FF, 0x104E65FF, 0xCAEEFAFF, 0x7D0027F4, 0x01E30434, 0x000AF805,
+0x15000774, 0x00DD0100, 0x0100FF01, 0x290400E3, 0x00080F02, 0x57002EFF, 0x00040001, 0x00015501,
+0x04080168, 0x1CF00200, 0x00128301, 0x04000024, 0x20400100, 0xFFEA12F3, 0xFF4382A1, 0xFF0D5D82,
+0xFF166586, 0xFF074E6C, 0xFF114C6A, 0xFF194C69, 0xFF164966, 0xFC174A67, 0xFC131118, 0x14000013,
+0x4209FC02, 0x4F6BFF13, 0x10000004, 0x05000200, 0x70FF1442, 0x00000451, 0x00081400, 0x0A080005,
+0x13537631, 0x774804E4, 0x04FF1355, 0x56794000, 0x0004FF14, 0x13577A48, 0xF10004FF, 0x15597C04,
+0x175B7EFF, 0x105576FF, 0x145678FF, 0x19597CFF, 0x85B10510, 0x8AFF2362, 0x8EFF2A66, 0x050C2F69,
+0x12963C01, 0x000F206A, 0x04000A00, 0x6D904000, 0xB448FF35, 0x6F9808F5, 0x6F99FF31, 0x769DFF2C,
+0x799CFF32, 0x7491FF37, 0x7086FF3B, 0x00644846, 0x5200443C, 0x39900003, 0x02029100, 0x38023A9C,
+0x09FA0001, 0x00282800, 0x04000020, 0x05000A00, 0x08001E00, 0xBD0F0A18, 0x5A002502, 0xF80BF000,
+0xE3FAFFFF, 0x638DA6FF, 0x699FC5FF, 0x649FCBFF, 0x4F8DBCFF, 0x33739FFF, 0x000EE8FF, 0x34010A00,
+0x3730003C, 0xFF367430, 0x60007D74, 0x0F200040, 0x02001C00, 0x34112338, 0x74004B70, 0x0A04004B,
+0x00000404, 0x0C000504, 0x00080000, 0x000A0404, 0xF8040008, 0xAA900104, 0x903C7F25, 0x7EAE22AA,
+0xB80085AC, 0x2DA80059, 0x00000400, 0xF4004ED0, 0x80B14035, 0x3108FF3C, 0x0135F800, 0x82210A34,
+0xE03FF039, 0xFF4B92C0, 0xFF5897C0, 0xFF5288A2, 0x4EE8E9F7, 0xAC2CF811, 0x010B5C04, 0xF40004FC,
+0x05000F0A, 0x02AC0001, 0x00028C00, 0x3301001C, 0x000D0009, 0x01091C03, 0x68000153, 0x9CF40201,
+0x035F2C01, 0x10F109FC, 0xFF729CB4, 0xFF5B97BC, 0xFF4B9CC9, 0xFF0F74A2, 0xFF0371A2, 0xFF0373A3,
+0xFF0676A6, 0x0C0575A5, 0x73A13200, 0x2104E403, 0x04F00474, 0x4004F800, 0xFF0675A3, 0xA1310008,
+0x13E00473, 0x8018D800, 0xFF05729B, 0xFF05729D, 0xA37104E0, 0xA6FF0771, 0x0F140772, 0x4022F400,
+0xFF0A7098, 0xA0B109F0, 0x9FFF0871, 0x9DFF056F, 0x0500046F, 0x00122800, 0x00000500, 0x6895A014,
+0x668AFF00, 0x6B80FF0E, 0xFC0046E8, 0x19F9120E, 0x01DB0002, 0x00000400, 0xDC031B1C, 0x07500000,
+0x00026800, 0x040000F7, 0x05D40100, 0x0F00E801, 0x28FF0005, 0x03039802, 0x3F010234, 0x00050002,
+0x0103C402, 0xF501016C, 0x01930304, 0xFFFFFC31, 0x6F00BB0B, 0x12880101, 0xFFE001F2, 0xFF0D4E6C,
+0xFF0D5B7F, 0xFF145D7E, 0x05004969, 0x144C6731, 0x685004FC, 0x6AFF184B, 0x4D2227F8, 0x43050014,
+0x6CFF124F, 0x000809F8, 0x141C0005, 0x0404FC04, 0x00000008, 0x00040005, 0x0104FC00, 0x54300004,
+0x09E0FF13, 0x12547639, 0x78310500, 0x05001355, 0x16587B42, 0x150004FF, 0x20050814, 0x04F8587B,
+0x0CFF1520, 0x000C0005, 0x02002002, 0x1CF10028, 0xFF18587C, 0xFF17597C, 0xFF1A6082, 0xFF1D6385,
+0xFF24698A, 0xFF2B6D8D, 0xFF2F7090, 0xFF307191, 0xFF307094, 0xFF2F7098, 0x902E6F99, 0x9604F24F,
+0x8FFF2F73, 0x89FF3071, 0x7AFF3A72, 0xFFFF3C67, 0x4134E0FC, 0x01A84400, 0x340311A9, 0x25B40101,
+0x064EA000, 0xA8000CC0, 0x01680002, 0x03000402, 0x4400016C, 0x00040F01, 0x01AC002E, 0x00158400,
+0xD7E05670, 0x6790AEFF, 0x69A1C6FF, 0x66A5CEFF, 0x009430FF, 0xA031554C, 0xF6043A7A, 0x00372C00,
+0xA231000C, 0x5A343477, 0x367AA131, 0x1C00413C, 0x0004080A, 0x0F193C00, 0x00010004, 0x0400E298,
+0x7BA74000, 0x0004FF3B, 0x3C7CA880, 0x3A7DA7FF, 0x13B9A4FF, 0x01B9A0A4, 0x7EA10518, 0x81A8FF37,
+0x80A8FF37, 0x00000438, 0xE800B9B4, 0x3FEC0044, 0x3580AAD0, 0x3580A8FF, 0x3782AAFF, 0x3FF4A9FF,
+0xFF3C84E3, 0xFF599DCA, 0xFF5D99BE, 0xF46996AD, 0x4EE8002B, 0x44FFFF21, 0x03E5007A, 0x00000404,
+0xE8030908, 0x01480004, 0x00029C01, 0x0300001C, 0x04200301, 0x08068802, 0x1D000155, 0x01980300,
+0xF0001701, 0xFFFFF807, 0xA7FFD4F4, 0xC6FF598C, 0xC1FF5DA1, 0x99FF4195, 0xD0FF056C, 0x04DC0604,
+0xFCFF0320, 0x00040004, 0xC076A420, 0x2004110E, 0x09FC0000, 0x11000400, 0x1113E0A0, 0x3122C805,
+0xF003709B, 0x1DF4001D, 0x010A2C00, 0x73301414, 0x0008FF05, 0x0A6F99E0, 0x0C6D97FF, 0x0B6D9AFF,
+0xE46E9CFF, 0x190C0031, 0x97FF0382, 0x97FF0870, 0xF3001471, 0x066B9900, 0x086B95FF, 0x0C5C7FFF,
+0x99C6D9FF, 0x7C002DF0, 0x00D10191, 0x00037502, 0xFC002520, 0x00EC0000, 0x01060800, 0x89000004,
+0x001F020D, 0x0F00D701, 0x29FF0005, 0x00024C00, 0x380A03A0, 0x02340011, 0x02023C00, 0xD8000159,
+0x00240059, 0x020C9400, 0x0E005417, 0xEF12F100, 0x7DA7B7FF, 0x125572FF, 0x0C587AFF, 0x0B4F72FF,
+0x0E4D6CFF, 0x114D69FF, 0x104964FF, 0x174D67FF, 0x00020A08, 0xC8151119, 0x13FC001D, 0x00050000,
+0x00000004, 0x28180105, 0x1C135021, 0x04F80419, 0x00000804, 0x040004FC, 0x04FC0100, 0x04191400,
+0x53380500, 0x0504FF13, 0x42050004, 0xFF15577A, 0x08020004, 0x04F0000A, 0x2004F800, 0x00A0587A,
+0xB1000402, 0xFF13597B, 0xFF145A7C, 0x04155B7D, 0x5B7E7100, 0x5D7EFF12, 0xF000040E, 0x105B7B2B,
+0x115A7AFF, 0x135A7AFF, 0x175C7DFF, 0x1B5F82FF, 0x1F6388FF, 0x23678EFF, 0x286C93FF, 0x287194FF,
+0x2D7696FF, 0x2D738DFF, 0x326E86FF, 0x35657CFF, 0xDAF9FFFF, 0x14FEFFFF, 0x35580019, 0x0022A000,
+0xFF250138, 0x0013A7FF, 0x2B0016A9, 0x050B0301, 0x04000B00, 0x5A020004, 0x00060F01, 0x01A4002D,
+0x00006500, 0x0AF11330, 0xD4E8FFF1, 0x9CB7FFB5, 0xA5C4FF6A, 0xA6CBFF68, 0x7CA2FF68, 0x7097FF3C,
+0x00A3B432, 0x4000BE78, 0x1914005A, 0x00505400, 0x7800B984, 0x0F0401BE, 0x03B98400, 0xA3310004,
+0x7D983978, 0x00000808, 0xA4310F2C, 0x0F343A79, 0x3B7AA640, 0x004694FF, 0x34010008, 0x397E4019,
+0x04ECA6FF, 0x0067B800, 0x0C000004, 0x00040800, 0x3A7F06F0, 0x3A82AAFF, 0x3883AAFF, 0x3583A9FF,
+0x3686ABFF, 0x8482A8FF, 0xB0351105, 0xA1C8A014, 0x97B8FF5D, 0xCFE4FF5F, 0xF440C4A8, 0xF8FDFFFF,
+0x00D8001D, 0x00014C00, 0x24030004, 0x04040101, 0x0003F408, 0x08020024, 0x00220004, 0x2013EA00,
+0x1D20FFFA, 0x0400240A, 0x40018898, 0xFF0BF140, 0xB5C8FFF4, 0x95B4FF8A, 0x9EC4FF56, 0x77A3FF50,
+0x6F9CFF1C, 0x76A4FF06, 0x3309D807, 0xEC02719F, 0x04F40009, 0x000C0311, 0x0372A040, 0x010004FF,
+0xD8011DD0, 0x18D00213, 0x0118D800, 0x738018D4, 0x739DFF09, 0xE49EFF09, 0x06713209, 0x121900FF,
+0x62280406, 0x99FF0D6D, 0x05040E6D, 0xFF0570A1, 0xFF04719A, 0x04067097, 0x0F0C0000, 0x6C9D00F5,
+0x6992FF08, 0x5978FF0D, 0xFFFFFF14, 0x004BE8E4, 0xEF010370, 0x022D0304, 0x001EB800, 0x0C05000B,
+0x001D000B, 0x00011003, 0x0000000B, 0x00040F01, 0x000226FF, 0x014D0305, 0x01025300, 0x78030151,
+0x00100002, 0x12001B00, 0x001F74FC, 0x28010C94, 0xB6100105, 0xFFEA06F1, 0xFF1C4C60, 0xFF0D5470,
+0xFF0D5878, 0xFF0B4A6D, 0x000F4A6A, 0x4C666005, 0x4A63FF10, 0x1A5127FC, 0x194A6AFF, 0xC80031FC,
+0x23140222, 0x14101211, 0x154E6B31, 0x0C002D18, 0x0A000005, 0x04000400, 0x080404FC, 0x0F080100,
+0x001E1407, 0x04040A00, 0x0F040000, 0x000ED800, 0x04000500, 0x0F040000, 0x00000404, 0x00040508,
+0x04EC0005, 0x4004F400, 0xFF125B7C, 0x7F400004, 0x04FF125C, 0x7E13F200, 0x7EFF115B, 0x82FF105C,
+0x84FF0E5C, 0x84FF105E, 0x83FF1460, 0x81FF1660, 0x7EFF155E, 0x7FFF165C, 0xF000045A, 0x125A8013,
+0x105C80FF, 0x116184FF, 0x0D6082FF, 0x116182FF, 0x11607FFF, 0x145E7BFF, 0x18526AFF, 0x78F3FFFF,
+0xD48000C6, 0x02290800, 0x000004E9, 0x0B280105, 0x0502B502, 0x0F00029B, 0x00040400, 0x00001502,
+0x0A020161, 0x00060F00, 0x00440027, 0x0001B000, 0xF0910580, 0x95BCCDFF, 0x73A7BFFF, 0xC1B1CC20,
+0x92FF5D9D, 0xA1FF2F6D, 0xC88C3D7D, 0x00555400, 0xFC0009EC, 0x779B6009, 0x7B9FFF31, 0x3511C374,
+0x2C00918C, 0x0004080F, 0x3979A545, 0x220004FF, 0x04F4377A, 0xFC387B22, 0x3A7D3009, 0x000A00FF,
+0x20041E20, 0x050C000F, 0x00284808, 0x0400001C, 0x0A340000, 0x00001800, 0xA73109F0, 0x05003381,
+0x7FA707F0, 0x7DABFF34, 0xA3CFFF3D, 0xA3C7FF66, 0x96B1FF63, 0xFCFFFF64, 0x7802FB9C, 0x0DE802A9,
+0x030DFD00, 0xE300090C, 0x00040800, 0x03012D01, 0x07000011, 0x092F0100, 0x0013EC00, 0x00020004,
+0x02C70141, 0x00002805, 0x2800004C, 0xEA02F20B, 0x5189A0FF, 0x4F9BBDFF, 0x439BC3FF, 0x096A95FF,
+0x74211DCC, 0x0004E405, 0x080404E8, 0x709D310A, 0x000EE401, 0x040013DC, 0x04F00000, 0x002CB804,
+0x9F3109EC, 0x13DC0873, 0x2204FC00, 0x0EE8719A, 0x31054C00, 0x5405709E, 0x2D040005, 0x0E6E98B2,
+0x0F6E9AFF, 0x0B6C97FF, 0x73A118F4, 0x6F95FF07, 0x6F98FF03, 0xA0192402, 0xFF0B6FA0, 0xFF17698E,
+0x0AFCA1BA, 0x5280EB11, 0x0004E400, 0x08001138, 0xFCA40100, 0x000A0000, 0xCC050004, 0x01EC0000,
+0x03140C00, 0x000305E8, 0x001F0101, 0xFF00050F, 0x04FC041D, 0x01000800, 0x4C010230, 0x00050001,
+0x03016400, 0x63000DA8, 0x10840507, 0x000DD800, 0x0AF10020, 0xD0E0FFF7, 0x455CFFAB, 0x516FFF0D,
+0x5373FF0A, 0x496BFF0A, 0x4B69FF0D, 0x90050012, 0xFF124E68, 0xFF114962, 0x220F0066, 0x2304194A,
+0xEC124D21, 0x4D6B2227, 0x1C000500, 0x00040128, 0x0A004E12, 0x04050000, 0x000C0004, 0x1E140905,
+0x0F0A0803, 0x00010500, 0x040604F8, 0x0A080300, 0xFF135940, 0x1009D87B, 0x9109E059, 0x5B7DFF0F,
+0x5E7FFF0F, 0xB119AC0F, 0xFF115F83, 0xFF115C83, 0x040F5D83, 0x8008F100, 0x81FF0E5C, 0x80FF125C,
+0x83FF145D, 0x84FF195F, 0x86FF1A60, 0x04FC1662, 0x5F8304F1, 0x6588FF0B, 0x5F84FF0F, 0x5D82FF0A,
+0x5C81FF08, 0x7519F807, 0xFF15475E, 0xB4C8E5F5, 0x04FC0021, 0x0116BF00, 0x90010F13, 0x01300002,
+0x01000400, 0x3F02000D, 0x05270206, 0x0178FF11, 0x0F001702, 0x01270006, 0x05000551, 0x00640000,
+0xF00A0800, 0xABFFEA08, 0xBFFF719B, 0xD3FF6AA1, 0xAAFF6FAF, 0x96FF4686, 0x9CFF2F70, 0x78612D24,
+0x779EFF30, 0xB15A3832, 0xFF2E789D, 0xFF327CA1, 0x043378A1, 0x19180000, 0x00284400, 0x54015F58,
+0x367B2164, 0x2C000F28, 0x46800014, 0x347BA797, 0x337AA4FF, 0x0004A6FF, 0x317AA544, 0x000ED4FF,
+0xC0000ED8, 0x0EE80053, 0x043BC800, 0xE8000004, 0xA913F01D, 0xA9FF3681, 0xA3FF3382, 0xA6FF2A7E,
+0xA0FF2A7F, 0xB3FF2675, 0xD0FF3E82, 0xB9FF65A4, 0xCAFF5E99, 0x1154E4B4, 0x0003D1F7, 0x000200CA,
+0xFFF73005, 0x00DAC4FE, 0x150000D7, 0x00080000, 0x04012600, 0x0C000008, 0x00040000, 0x00001003,
+0xD600DFF0, 0x0606008D, 0x050B1200, 0x900002D0, 0x50FA1010, 0xF202F127, 0xA8CEDBFF, 0x4487A2FF,
+0x459DC1FF, 0x2585AFFF, 0xCC000494, 0x0F000004, 0x0004FC00, 0x9EB10A00, 0x9DFF0170, 0x9CFF006F,
+0x18F4006F, 0x0004F802, 0x07160520, 0xDC001DCC, 0x08716118, 0x08729CFF, 0x98402314, 0xD0FF086F,
+0x6F9B711D, 0x709DFF0A, 0x00000409, 0x983113E0, 0x0A000C6D, 0x0A6B9650, 0x1DF098FF, 0x09700AF0,
+0x026E95FF, 0x026F9AFF, 0x0474A6FF, 0x0F71A0FF, 0x1A6181FF, 0xA4F4FFFF, 0x32F002B1, 0x0204FC00,
+0xB4000100, 0x087D0005, 0xB49BFF11, 0x02010300, 0x9C000FF4, 0x14D80003, 0x0005E803, 0x040F0104,
+0x0025FF00, 0x04040380, 0x01430600, 0x02025100, 0x44040160, 0x02430102, 0xF1068409, 0x7FFFF106,
+0x65FF3D6A, 0x72FF0C49, 0x6CFF0E53, 0x68FF084D, 0x1DEC0D48, 0x4B6606F0, 0x4C64FF12, 0x4B64FF12,
+0x4964FF13, 0x4969FF16, 0x0869FF18, 0x134C3019, 0x0004FCFF, 0x10000004, 0x04FC011E, 0x19344F10,
+0x0A101311, 0x2CEC6D10, 0x001E2003, 0x04000508, 0x0A000005, 0x40191C00, 0xFF135271, 0x04002300,
+0x0A000400, 0x14000800, 0x21190C75, 0x18E41156, 0x040A1000, 0x0C020500, 0xFF12A00A, 0xFF155B7F,
+0xFF135C7F, 0x7DB10EEC, 0x7CFF105A, 0x7CFF0E5A, 0x14B40C5B, 0xF204F001, 0xFF105A07, 0xFF105B82,
+0xFF0F5F84, 0xFF106085, 0xFF115F85, 0x08125E82, 0x115BA105, 0x116081FF, 0x085B7DFF, 0x13F007A8,
+0xFF0E6086, 0xFF0F6189, 0xFF146590, 0xFF0A5E8C, 0xFF05547D, 0xFF105272, 0xFF11435C, 0xFFC1DEF0,
+0x2D28FCFF, 0x0054CC02, 0xA602128C, 0x02B00007, 0x02000400, 0xC4000158, 0x01740002, 0x0002DE00,
+0xD8020004, 0x017E0602, 0x1A000A0F, 0x01005306, 0xFD1106AD, 0x0AF16F7C, 0xE1E8FFF6, 0x99B2FFC8,
+0xA3C6FF67, 0xA6CBFF63, 0x769EFF62, 0x79A1FF2E, 0x603FB02E, 0xFF2F7B9F, 0x05047EA2, 0xA6FF3091,
+0xA5FF337E, 0x0004327D, 0x307DA780, 0x307EA5FF, 0x000008FF, 0xA8400004, 0x04FF307F, 0x221C0000,
+0x7EA700F1, 0x7DA8FF2F, 0x7EA6FF2C, 0x7CA7FF2C, 0xF100042B, 0x2A7BA628, 0x287BA7FF, 0x2178A3FF,
+0x2079A3FF, 0x1D79A0FF, 0x1B77A0FF, 0x1B74A0FF, 0x1A709FFF, 0x1870A0FF, 0x176F9DFF, 0x0F6A96FF,
+0x0E6C92FF, 0x0B6B91FF, 0x0B6D92FF, 0x06F01CFC, 0xFF0F6C97, 0xFF4294C4, 0xFF559CC6, 0xFF5991AA,
+0xFFCBEBFA, 0x301159FF, 0xF4FFFFFA, 0x0ECC001D, 0x00C1C002, 0x2D033370, 0x00EC0006, 0x07029101,
+0x14000122, 0x01410300, 0x1A050002, 0x002720F9, 0x2400001C, 0x01180100, 0xA7FFE7D1, 0xB5FF5F92,
+0xC1FF4594, 0x36A03999, 0x040EC000, 0xE80013D0, 0x09E80004, 0x016D9B71, 0x026E9CFF, 0x1C0027B8,
+0x22B40000, 0x00000400, 0x04041DC8, 0x27C00000, 0x0204E800, 0x045140C8, 0x056F97FF, 0xD0001DD0,
+0xD89B1045, 0x0C6E212C, 0x97400510, 0x04FF0A6D, 0x6A948005, 0x6C96FF09, 0x0010FF0B, 0x056C95A0,
+0x07749FFF, 0x0C79ABFF, 0xFF0F5328, 0xF83F7B97, 0x05BA0014, 0x0004D400, 0xFC310D6C, 0x2048FCFF,
+0x08087D00, 0xFC000100, 0x00D10000, 0x0003A002, 0x12000240, 0x00040F00, 0x1F0026FF, 0x038C0002,
+0x00000400, 0x04020398, 0x014E0200, 0x01001C02, 0x17010357, 0x2B8C0000, 0x00607401, 0xF3E13084,
+0x4058FFD9, 0x4C6AFF0C, 0x4B68FF0B, 0x80190408, 0xFF0C4765, 0xFF114A67, 0xFC0018FC, 0x4A64710E,
+0x4B65FF14, 0x11190815, 0x402D0869, 0x4D6BFF14, 0x000E0004, 0x0510000A, 0x0105000F, 0x59050402,
+0x5372FF13, 0x31050014, 0x0C125373, 0x05040019, 0x350A0800, 0x14115677, 0x04F80019, 0x01050404,
+0x566118F0, 0x587CFF12, 0x00050012, 0x00000EF4, 0x5C7D410A, 0x04FCFF0D, 0xFF115DA1, 0xFF145E83,
+0x04135D84, 0x0F0C0005, 0x000A0C00, 0x08000F10, 0x60843105, 0x0032D812, 0x1CF132DC, 0xFF0E5E81,
+0xFF0E5E83, 0xFF17648E, 0xFF0F5D8B, 0xFF0C5E8D, 0xFF0D5E8B, 0xFF07557B, 0xFF0C4F6C, 0xFF0D3D54,
+0xFFB9D9E8, 0xA4ECFDFF, 0x07C40089, 0x00217802, 0x000002B0, 0x00040805, 0x0002E400, 0xF30102EC,
+0x01710208, 0x2100060F, 0x00005B00, 0x270001A9, 0x99100108, 0x00130002, 0x64006F80, 0x8BAC20BF,
+0x50206084, 0xB104C0FF, 0xFF176893, 0xFF13668E, 0xCC176B8F, 0x668F8005, 0x6994FF17, 0x0018FF1A,
+0x699304F1, 0x6892FF16, 0x6992FF15, 0x6891FF14, 0x6790FF13, 0xB2000412, 0xFF0F678F, 0xFF116893,
+0x04106792, 0x0F686500, 0x106993FF, 0x95710004, 0x97FF0E69, 0x0DE00E6B, 0x096F9740, 0x000004FF,
+0x9DB10404, 0xA0FF0D6D, 0xA0FF0E6E, 0x2BE40D6F, 0x0D759CB1, 0x097198FF, 0x0C729AFF, 0x00F235EC,
+0xFF0F709D, 0xFF4FAAD7, 0xFF4D97BC, 0xE06A9AAE, 0x02610063, 0x0114FB12, 0x21013802, 0x1F50FFFC,
+0x0000E000, 0x20010004, 0x00F10001, 0x06000400, 0x51010298, 0x0100000B, 0x10C80000, 0x0331E8FF,
+0x34002720, 0x01730000, 0xF1000800, 0xFFF5FF07, 0xFFC5EEFF, 0xFF3A7B99, 0xFF3C94BA, 0xFF2489B3,
+0x98026D99, 0x04EC0031, 0x002CA800, 0xA33122E8, 0x40900975, 0x44000800, 0xFF0A75A3, 0xDC0040AC,
+0x2CB80013, 0x41000400, 0xFF086F9C, 0x6E120004, 0x977127C8, 0x98FF0470, 0x04E80670, 0x106D9953,
+0x13F09BFF, 0x000A1000, 0xF4010004, 0x0A6B2104, 0x08013F14, 0x6C03F20A, 0x78A4FF07, 0x7CADFF0D,
+0x6E97FF0E, 0xD3EBFF12, 0x1223F4A5, 0x0019F8FC, 0xF91004D4, 0xE807060C, 0x05F70C18, 0x00010B00,
+0x2C0000D7, 0x000C0000, 0xFF00040F, 0x01440026, 0x00000402, 0x2D000254, 0x06700302, 0x0B025001,
+0x2300039C, 0x01890100, 0xFFF206F1, 0xFF6E92A2, 0xFF0A435E, 0xFF0A4C6C, 0xFF0C4B6A, 0x040E4B67,
+0x4B654000, 0x04F8FF0F, 0x0109F800, 0x4A610004, 0x4B66FF14, 0x00051413, 0x04012808, 0x3C100300,
+0x07140001, 0x04000A00, 0x00040005, 0x00050800, 0xFC02372C, 0x14151704, 0x05080B23, 0xFF145330,
+0x000C0508, 0x0A040005, 0x00000400, 0x00002818, 0x050C0205, 0x7DFF1395, 0x7EFF1458, 0x0508145A,
+0x105A7F71, 0x0F597EFF, 0x24000010, 0x5C82220A, 0x00000508, 0x04E80005, 0x0D5F8431, 0xD40013F0,
+0x8120F228, 0x82FF135F, 0x83FF155F, 0x86FF135F, 0x88FF115F, 0x8CFF105F, 0x8DFF1261, 0x84FF1362,
+0x75FF0C5B, 0x6BFF0551, 0x52FF0B51, 0xD7FF073E, 0x1BC8A7CB, 0x0217C801, 0x600203D0, 0x01600006,
+0x0068EC00, 0x88000D9E, 0x01600BB9, 0x2102C50F, 0x03019400, 0xFC200004, 0x31D100FC, 0x10F8FFFC,
+0xFA1AF100, 0xDBFAFFFF, 0x3D7493FF, 0x3F8CB6FF, 0x3F97C5FF, 0x0A638FFF, 0x0E678FFF, 0x106A8FFF,
+0x0E668CFF, 0x12658FFF, 0x136692FF, 0xD40004D8, 0x6A947104, 0x6A93FF11, 0xF117900E, 0x0C699200,
+0x0D6A93FF, 0x0E6B94FF, 0x0D6A95FF, 0x974603BC, 0x04FF0D6D, 0x04C80000, 0x99FF0CC2, 0x9DFF0D6E,
+0x9CFF0E6D, 0x003FF06C, 0xEC000908, 0x6DA0A01C, 0x6EA2FF0C, 0x6FA0FF0A, 0x066049DC, 0x0A749CFF,
+0xF01D10FF, 0x0F719E07, 0x0B6B9BFF, 0x2A89B7FF, 0x449DC9FF, 0x468CAEFF, 0xBCD1E1FF, 0x64F011D1,
+0x25530007, 0x2003D400, 0x09CEFEF8, 0x001A5400, 0x74007994, 0x011D0411, 0x000B5200, 0xA8030004,
+0x02BD0002, 0x00003100, 0xFD3011A0, 0x0A34FFF7, 0x000A3C00, 0x18010013, 0x00090005, 0x70002400,
+0xC7FFEFFF, 0x60FF74AC, 0x94BE7195, 0x76A3FF34, 0x0022B40F, 0x8C0004F4, 0x13CC0109, 0x0813D000,
+0x72210004, 0x0013E009, 0xC40013D4, 0x00040022, 0x232CB000, 0x0EEC6D99, 0x0109E403, 0x000004FC,
+0x1DEC000F, 0x0F6B07F1, 0x0D6C9AFF, 0x0B6C99FF, 0x076E9BFF, 0x066D98FF, 0x096C96FF, 0x92310620,
+0x14700868, 0xB3004000, 0xFF1C83B0, 0xFF1379A9, 0xF8217097, 0x149C0018, 0x00022C02, 0x0002021E,
+0x01C90006, 0x0700F804, 0x17000008, 0x03A00300, 0x07002800, 0x0B0F001A, 0x0023FF00, 0xA009021F,
+0x00110003, 0x00016003, 0x6E000018, 0x01590102, 0x01001800, 0x02F118F8, 0x3D50FFEB, 0x4562FF12,
+0x4767FF08, 0x4A68FF05, 0x4009F80F, 0xFF0E4C65, 0x63200004, 0x110EF849, 0x000EFC17, 0x1000050C,
+0x4C67420F, 0x0A04FF13, 0x0F241611, 0x0F411400, 0x00090500, 0x000F0504, 0x0C001505, 0x27E4001E,
+0x26050801, 0x0F081355, 0xFF165630, 0x10040504, 0x577D310A, 0xF4050416, 0x13597D01, 0x115A7DFF,
+0x11597FFF, 0x10597CFF, 0x001E14FF, 0x813118F0, 0x1410155A, 0xEC5D8420, 0xFF0C2109, 0x0C000504,
+0x145EA10F, 0x165F82FF, 0x155F84FF, 0x14F10F20, 0xFF105F86, 0xFF0F6187, 0xFF10628A, 0xFF0E6189,
+0xFF095B81, 0xFF004D6E, 0xFF0C526C, 0xFF073B50, 0x1095B6C5, 0xFBFE3114, 0x00372CF7, 0x48020387,
+0xD4FE1201, 0x01510008, 0x0003C300, 0xD0000154, 0x00100002, 0x2400040F, 0x02109C00, 0x6000003B,
+0xFFFE4205, 0x0E44FDF7, 0x31644800, 0xD081AFC9, 0xC314F144, 0xA3FF3493, 0x8CFF1979, 0x90FF0666,
+0x90FF0A6A, 0x93FF0D69, 0x92FF1165, 0x93FF1064, 0x91FF0C67, 0x04E80B68, 0x4204EC00, 0xFF0B6B95,
+0x0A460004, 0x046B95FF, 0x08C80000, 0x00000404, 0xD00012DC, 0x0DEC0004, 0x0D6C9C31, 0x08010500,
+0x7101F004, 0x6D9EFF05, 0x6D9FFF09, 0x6DA1FF09, 0xF0A0FF08, 0xF0711035, 0xFF04201C, 0x9D3103F8,
+0x53F00E70, 0x3F9AC7A0, 0x4194BCFF, 0x4C86A2FF, 0x30E71129, 0x1F35010B, 0x2022E003, 0x13CAFBF5,
+0x00062003, 0x280500D7, 0x01460001, 0x00000400, 0x1802013D, 0x5E130105, 0x01002000, 0xF9110930,
+0x0F019D80, 0x00050000, 0x01000400, 0x01F0529C, 0x7395FFE9, 0x89B5FF2D, 0x8DBAFF2A, 0x6B98FF2B,
+0x08111DE0, 0xFC0422C4, 0x09E40004, 0x00000400, 0x040009E4, 0x04F80000, 0x00000400, 0xFC000EE4,
+0x00080004, 0x0000C400, 0xD8000004, 0x22D80009, 0x40000800, 0xFF097099, 0x9A100004, 0x6B2113EC,
+0xC004FC0C, 0xFF096B98, 0xFF076C9A, 0xFF076C98, 0x952009F4, 0xF0230C69, 0x96FF0D05, 0xA1FF0B6A,
+0xB3FF1274, 0xA3FF2689, 0xD8FF1E7A, 0x009BCCB6, 0xD002BDC4, 0x02280000, 0x02050006, 0x060201D6,
+0x02250000, 0x06000400, 0x9C000F0C, 0x0C640003, 0x0F002002, 0x28FF0006, 0x00022300, 0x7E020004,
+0x11700306, 0x01050007, 0x90010168, 0x0180000B, 0xFFF30EF1, 0xFF9EBFD0, 0xFF05374E, 0xFF094663,
+0xFF0A496A, 0xFF124968, 0xFF124A65, 0x000C4C65, 0x49657105, 0x4765FF13, 0x112D0016, 0x200A0066,
+0x0500FF12, 0x154B6763, 0x004C68FF, 0x154C3005, 0x000500FF, 0x08000004, 0x00080114, 0x301E1000,
+0xFCFF154E, 0x00040004, 0x14516E40, 0x000004FF, 0x04000508, 0x14040000, 0x00000400, 0x04050F0C,
+0x190C0100, 0x060F0C00, 0xFC002814, 0x00040109, 0xFF155543, 0x00050479, 0x7C450A04, 0x04FF1556,
+0x14582505, 0x0000050C, 0x00040005, 0x15597E42, 0x110500FF, 0x00190C12, 0x04000A04, 0x140C0000,
+0x10000400, 0x01050481, 0x1AF11E24, 0x6183FF10, 0x6384FF0D, 0x6587FF0D, 0x6287FF0C, 0x678CFF0D,
+0x5B80FF13, 0x4B6FFF07, 0x4768FF00, 0x3D57FF08, 0xAEBFFF0E, 0x00050493, 0xF5221BC8, 0x0103D0F9,
+0x47004B30, 0x00040001, 0x00017500, 0x04000008, 0x02BF0F00, 0x4EE00029, 0x000B9801, 0xFE150049,
+0x28013794, 0xEC12F27B, 0x79A4FFCC, 0x88BAFF30, 0x8DB6FF28, 0x6C8FFF2A, 0x6990FF05, 0x6A94FF06,
+0x6693FF0A, 0x6794FF0F, 0x93710500, 0x93FF0B68, 0x00180969, 0x3103A400, 0xB40C6B97, 0x03BC0008,
+0x001CBC00, 0xC8000004, 0x00040008, 0x0003D400, 0xFC000004, 0x04040103, 0xC80F6B21, 0x71987158,
+0x7298FF07, 0x0026EC06, 0x9E3121D8, 0x3AEC086E, 0x310E2000, 0xEC047096, 0x05300035, 0x78A500F2,
+0x94BEFF17, 0x87A7FF3B, 0xB1C7FF3C, 0x000DFC7D, 0xF0032A64, 0x01170012, 0x01425800, 0xFC040408,
+0x00150004, 0x0100DF00, 0xD000336C, 0x0B480031, 0x00050002, 0xEC010A34, 0x06090109, 0x00094800,
+0x31000035, 0x02CC0038, 0xF1004600, 0xD9FFF202, 0xA0FF99C3, 0xBDFF2578, 0xAAFF248D, 0x40781579,
+0x2004DC00, 0x18B073A0, 0x11138800, 0x002CA807, 0x040404E4, 0x09EC0100, 0xC8076E21, 0x18D80013,
+0x0018C000, 0x040405F8, 0x0AFC0000, 0x00000C04, 0x99800008, 0x9AFF0A6C, 0xFCFF096B, 0x00040104,
+0x21050000, 0x1020096B, 0x00065800, 0x03F30B3C, 0xFF066791, 0xFF2687B2, 0xFF2C88AF, 0xFF287295,
+0x1B38FAFF, 0x00037003, 0x04040500, 0x00F30000, 0x0101D701, 0xD4000005, 0x00040000, 0x03050003,
+0x000F178C, 0x003CFF05, 0x89030160, 0x017D0301, 0x02016000, 0x1C006A64, 0x019A0000, 0x6EFFF191,
+0x59FF305B, 0x5EDC0840, 0x09466581, 0x134867FF, 0xAD04F4FF, 0x64FF0E4C, 0x64FF0D4B, 0x05001248,
+0x000A0401, 0x4B12140C, 0x08043710, 0x04F8010F, 0x0C164F21, 0x4B200005, 0x12000402, 0x03050413,
+0xFC003728, 0x00040204, 0x00FF1220, 0x00040005, 0x05050005, 0x000F2818, 0x2C000305, 0x0A040037,
+0x00050004, 0x04000504, 0x05080400, 0x10232400, 0x210A047A, 0x231C115A, 0x00192400, 0x14081E00,
+0x5D81311E, 0x0019100F, 0x04001428, 0x0F0C0005, 0x0E6181B1, 0x0B6482FF, 0x0A6582FF, 0x0CF21E14,
+0xFF0D6186, 0xFF0F628A, 0xFF0F5E87, 0xFF02476E, 0xFF094464, 0xFF09364D, 0x0C86A3B1, 0xFBFF310F,
+0x005F38FF, 0x040003C4, 0x01600000, 0x00039B00, 0xFC0F000C, 0x3C012904, 0x083C0000, 0x04005100,
+0x15010008, 0x00050300, 0xFFEE06F1, 0xFF5493BC, 0xFF227CAE, 0xFF278EB7, 0xFF087299, 0xE002688E,
+0x6894D009, 0x6895FF0F, 0x6894FF11, 0xF094FF0D, 0x0504040E, 0xA8096821, 0x05080108, 0xD80B6C21,
+0x05000012, 0x01000400, 0xD4010500, 0xE8061303, 0xFF0A5103, 0x240E6A99, 0x05000400, 0x10051800,
+0x502BF49C, 0x9BFF086F, 0x11431471, 0x00007805, 0x6C000470, 0x8BB8E02C, 0x8EB2FF29, 0x7892FF36,
+0xEFFFFF36, 0xF6130400, 0x64005B48, 0x28FC1102, 0x026A0001, 0x01000400, 0xDB0340B0, 0x04070100,
+0x007CD801, 0x00033B08, 0x398C0005, 0x00003700, 0xB40002B7, 0x0A0401BD, 0x03000D00, 0xF8030020,
+0x7892B118, 0x83AFFF3C, 0x85B6FF24, 0x224A8017, 0x40786E9D, 0x01009000, 0xC00013CC, 0x00040F0E,
+0x04FC0004, 0x02000400, 0x0B1122D0, 0xF00018E8, 0x18D80004, 0x00000400, 0x28000128, 0x04FC0006,
+0x0009F404, 0x04000620, 0x06480005, 0x001A0000, 0x04000B64, 0x23100005, 0x3794BDB3, 0x3383A8FF,
+0x5B94B1FF, 0xF81140EC, 0xE7000FFC, 0x00F40000, 0x03087001, 0xF40404E7, 0x07440000, 0x00000402,
+0x1D0200DC, 0x00300000, 0x03002C00, 0x070F01E9, 0x0328FF00, 0x50000384, 0x01450101, 0x00001000,
+0x4C010004, 0x2550002A, 0x00000D00, 0xF5D10265, 0xD2ECFDFF, 0x0A3953FF, 0x0D4A67FF, 0xC4000F00,
+0x04FC002C, 0x110EF402, 0x312CF810, 0x14114866, 0x05180005, 0x134A6831, 0x04001400, 0x0A0C0014,
+0x000A0400, 0x68261920, 0x0005084D, 0x04015504, 0x144E1200, 0x1404000A, 0x00000400, 0x04003718,
+0x0A040000, 0x02000400, 0x1C020504, 0x1E18003C, 0x024B2C02, 0x08001404, 0x3BF80019, 0x00000400,
+0x00000F08, 0x0008000A, 0x40000400, 0xFF155779, 0x04000004, 0x00040405, 0x00141800, 0x180031FC,
+0x5B7B7128, 0x5D7BFF0F, 0x0000040C, 0x7F312D0C, 0x1DFC115D, 0x00088110, 0x01192000, 0x28000500,
+0xFF14A028, 0xFF175C83, 0xFF175D81, 0x1BF00508, 0xFF0D627F, 0xFF0A6381, 0xFF09607E, 0xFF12668A,
+0xFF126188, 0xFF145F89, 0xFF0D567F, 0xFF01456A, 0xFF04415E, 0xFF0A3A4E, 0x0CE494A1, 0x00413400,
+0xFD2134D8, 0x00628CFF, 0x5700016D, 0x00080001, 0x0F017501, 0x00300005, 0x31012B25, 0x01AC0003,
+0x3CFFFE21, 0xFF03F104, 0xDAFBFFF5, 0x6F9AFFA8, 0x83AFFF1E, 0x7BA4FF1E, 0x4005000E, 0xFF0C6C92,
+0x913113F0, 0x13F40E67, 0x0013F800, 0x08010508, 0x0508000A, 0x140B6821, 0x0F080005, 0x0056CC00,
+0xCC000004, 0x05040103, 0x1117CC01, 0x0012CC09, 0x96312740, 0x0F280D6A, 0x076F9440, 0x000004FF,
+0x0C00041C, 0x0434020E, 0x96FF0A91, 0x99FF0A70, 0x35FC0A72, 0xA01D6400, 0xFF258FB9, 0xFF348AAB,
+0x4AE88AA0, 0x001A2C04, 0x11000100, 0x00040001, 0x000EF802, 0x1F014EFC, 0x00130001, 0x00000404,
+0xE4010027, 0x00E40004, 0x00190402, 0xFB011E30, 0x0B080309, 0x005ED802, 0x04000031, 0xEA03F005,
+0xB5E7FEFF, 0x1C6B8CFF, 0x157FA9FF, 0x0B7BABFF, 0x400A98FF, 0xFF0A6C9B, 0x9D40317C, 0xA8FF0A6F,
+0x00040F00, 0x0FE00001, 0x00000400, 0x040800D0, 0x01040000, 0x00000400, 0xFC0004F4, 0x063C0004,
+0x000EE000, 0x04004B0C, 0x04F80005, 0x00062800, 0x40000020, 0x06680001, 0x0B648E31, 0xAFE01068,
+0xB9FF2A86, 0x9EFF3B93, 0xF1FF387D, 0x00F9B4DE, 0xD0000218, 0x00CC0205, 0x0100F001, 0xE00205E4,
+0x0010021D, 0x0300F500, 0xE00000D0, 0x000B0001, 0x00000400, 0x10000017, 0x00080100, 0xFF00050F,
+0x014C0029, 0x06065703, 0x1500014F, 0x1C4C0000, 0xF7FFFC30, 0x6501B168, 0xFFF2D10C, 0xFF6A8A9F,
+0xFF0B405F, 0xFC0D4C6D, 0x18F00022, 0x0004FC00, 0xF8000004, 0xF4641009, 0x31FC0027, 0x351E0800,
+0x00FF114A, 0x0F080005, 0x03000400, 0x000F190C, 0x18001105, 0x0004002D, 0x0004FC00, 0x00040004,
+0x00080005, 0x11050006, 0x004B2C16, 0x04000500, 0x05000400, 0x0104F800, 0x18000004, 0x12576323,
+0x125778FF, 0x24023714, 0x05000032, 0x00000400, 0x10020500, 0xFF0CD11E, 0xFF0D5C7B, 0xFF105C7C,
+0x20115C7C, 0x2D24002D, 0x01050400, 0x5DE11910, 0x5C84FF0F, 0x5B82FF14, 0x5C83FF16, 0xD02D2418,
+0xFF106081, 0xFF0D6281, 0xFF0C6180, 0xF009FC84, 0xFF13610E, 0xFF17628A, 0xFF146289, 0xFF145F86,
+0xFF004869, 0xFF06435F, 0xFF0E3D51, 0x1CE48A99, 0x01645003, 0xC40203C0, 0x01700607, 0x2802C00F,
+0x0001AB00, 0x43010004, 0x00090000, 0x11493C00, 0x002634FD, 0x07F2314C, 0xFFE1FFFF, 0xFF2A6E93,
+0xFF1577A4, 0xFF1180AD, 0xFF066A8E, 0x1404688A, 0x00050000, 0x04003080, 0x05040000, 0x001DD000,
+0x080903D0, 0x0A6A2105, 0x34000F18, 0x03D0000F, 0x0003FC00, 0xE0000004, 0x04000103, 0x050C6812,
+0x066C9262, 0xF06D93FF, 0x40991012, 0x0A6D900F, 0x0B6E97FF, 0x346D94FF, 0x54091109, 0xAE00F227,
+0xB2FF0C7F, 0x90FF1A8A, 0xDFFF1B72, 0x3840A4CA, 0xECF9FD21, 0x26F80036, 0x01090901, 0xA00200C8,
+0x04000063, 0x06000404, 0xE400012C, 0x05000300, 0x03002C01, 0x0C0083B8, 0x63E80000, 0x20050803,
+0x3398FCFF, 0xFFE907F0, 0xFF5396B3, 0xFF16769E, 0xFF1483AE, 0xFF0374A0, 0xFF066C9C, 0x99711EA0,
+0xA1FF086A, 0x637C1072, 0x00638000, 0x08040F9C, 0x0AC40005, 0x110EF002, 0x0022B409, 0xD40014F8,
+0x00080104, 0x12151400, 0x0000F46A, 0x28000114, 0x09DC001A, 0x0B6A9A31, 0x18005010, 0x22F00001,
+0x40000400, 0xFF096991, 0x8F400164, 0x08FF0D64, 0x98C3B205, 0x8FB6FF41, 0x87A3FF40, 0x0150E44B,
+0xD000149C, 0x05000214, 0x0200C300, 0x00070104, 0x00EF0005, 0x00001901, 0xD40000F4, 0x002C0805,
+0x0F001901, 0x30FF0005, 0x00050000, 0x4A000004, 0x01700101, 0x02016C00, 0x96001168, 0x20520224,
+0xFFF006F1, 0xFF173D54, 0xFF134B6C, 0xFF0F4F72, 0xFF0D4A66, 0xE8114B63, 0x05000031, 0x0013F400,
+0x040145F8, 0x1E100123, 0x00191802, 0x0C0009F8, 0x0A040141, 0x00050004, 0x4B221408, 0x12191416,
+0x000A0C4C, 0x04010F0C, 0x1C4F1000, 0x2414114B, 0x0A000046, 0x04000400, 0xF8000500, 0x05000404,
+0x00000C00, 0x24000A04, 0x37240A46, 0x18FF1221, 0x23140028, 0x41000403, 0xFF115878, 0x08050004,
+0xFF132005, 0x0C000EFC, 0x31E00019, 0x10190C01, 0x00001457, 0x14113C1C, 0x7D310F0C, 0x2D28115D,
+0x000F0000, 0x84720F10, 0x85FF125B, 0x0004145B, 0x2C135E21, 0x46F40028, 0x1C608322, 0x5E7E8032,
+0x6587FF0B, 0x2328FF12, 0x628706F1, 0x6387FF12, 0x4668FF17, 0x4865FF00, 0x394EFF0B, 0xB094FF06,
+0x08F000D4, 0x004C3400, 0xF8030DE8, 0x01740002, 0x2500040F, 0x0001AC00, 0xBC010421, 0x03340001,
+0x0001B800, 0x280012F8, 0x03280085, 0x510D5200, 0x9AB8FFEB, 0xF103F463, 0x0F7DAE08, 0x096B8EFF,
+0x096685FF, 0x0C6689FF, 0x0F6890FF, 0x0C688FFF, 0x14000004, 0x05080019, 0x001DFC00, 0x14000004,
+0x67903119, 0x00191C0A, 0xCC00000C, 0x6A922003, 0x20041910, 0x280B1119, 0xDC97100F, 0x04100017,
+0xFF096C40, 0x001CEC95, 0x69220010, 0x21001C0A, 0x0F600C6B, 0xF2091400, 0x0171A300, 0x0D85B7FF,
+0x0C83ADFF, 0x1E7795FF, 0xAC001CF8, 0x74FE1004, 0x00BC00B8, 0x0119B802, 0x18002564, 0x06280100,
+0x00242807, 0x040400EC, 0x050D0100, 0x03000D04, 0x040000F4, 0xFCFA2132, 0x4E022840, 0x02BA0000,
+0xFFE003F0, 0xFF0F6186, 0xFF0B77A5, 0xFF0778A0, 0xFF006F97, 0x9EC009F4, 0xA1FF0C6C, 0x95FF1171,
+0xACFF0565, 0x14C8010A, 0xA80B6D21, 0x04E40036, 0x00000408, 0xA40004F8, 0x0008003B, 0x00001800,
+0xDC0027C8, 0x00040004, 0x00061000, 0x3C000500, 0x69987106, 0x6897FF0D, 0x000B380C, 0x9171012C,
+0x8FFF086A, 0x1A6C0969, 0x80244800, 0xFF257CA7, 0xFF499AC5, 0xDA20F9F0, 0x116DDCBF, 0x00D992F4,
+0x68001EB0, 0x00D30512, 0x00000903, 0x040001D7, 0x000F0100, 0x04022001, 0xF80000E8, 0x00110100,
+0xFF00050F, 0x1B780038, 0x00034400, 0x5F010171, 0x016C0001, 0x00050002, 0x4C00537C, 0xBACC7117,
+0x425EFF9D, 0x31548C13, 0xBC09496C, 0x4961894A, 0x4A62FF0F, 0x0500FF10, 0x0C0F4B21, 0x08671023,
+0x114A3100, 0x030500FF, 0x080109FC, 0x144C3014, 0x000A00FF, 0x69321E10, 0x1E10144B, 0x00191007,
+0x18040F54, 0x04FC003C, 0x08000400, 0xF8000500, 0x00040404, 0x0505000F, 0x41247410, 0x0104FC03,
+0x57611E1C, 0x5777FF10, 0x24050410, 0x0A0C5679, 0x1CFF1320, 0x5980933C, 0x587FFF14, 0x2C7CFF13,
+0x05180019, 0x372C7B10, 0x18105C21, 0x0500083C, 0x21050401, 0x3730125D, 0x00282000, 0x82402D30,
+0x04FF105E, 0x28240000, 0x0D6080C1, 0x116486FF, 0x116186FF, 0xF21E24FF, 0xFF156003, 0xFF024B6C,
+0xFF0A4C66, 0xFF073F50, 0xEC577F89, 0x2CFF1026, 0x03A60237, 0x00017300, 0xCD0F0004, 0xAC002202,
+0x170C0001, 0x1204F300, 0x00EBDCFF, 0xEC011AC8, 0x001C003A, 0x51033D01, 0xD7EFFFF3, 0x002300AD,
+0x00F549DC, 0xFF0D6D93, 0xFF0E6988, 0xFF0B6588, 0x040E688D, 0x678E4005, 0x0004FF0B, 0x00050400,
+0x080003D4, 0x04F80000, 0x31050C08, 0x10086890, 0x05080105, 0x600EF801, 0x6A98FF0B, 0x09F0FF0B,
+0x40130C01, 0x97FF0A6B, 0x14002BEC, 0x0508000A, 0xF2281C00, 0xFF0F6A07, 0xFF066897, 0xFF0074A7,
+0xFF097FAD, 0xFF097599, 0x185CA6C1, 0x18AF0015, 0x2105A700, 0x5DECFDFF, 0x01010805, 0xC4000ED1,
+0x85EA0005, 0x1100D200, 0x018E5FFF, 0xD80500CF, 0x00090000, 0x0002A802, 0x33003BE4, 0x28430100,
+0x01001700, 0xF16045E8, 0x81B1C5FF, 0x000AD4FF, 0x9D40316C, 0x8CFF0575, 0x1DC00019, 0x20140000,
+0x54886797, 0x98FF1030, 0x0401319C, 0x2CA40000, 0x03000407, 0xD0000FE8, 0x05000109, 0x2100DC00,
+0x2CC80B6C, 0x001F1802, 0x0C20000C, 0x000120FF, 0x9440012C, 0x04FF0C67, 0x0B3C0000, 0x01013800,
+0x06F004FC, 0x8EFF0C6A, 0x8AFF0D69, 0xC5FF0C64, 0xBEFF489B, 0xA6FF4D97, 0x0209FC83, 0xA20082D4,
+0x22C40005, 0x00050001, 0xBC010201, 0x00050000, 0x02000400, 0xF40A1008, 0x00F00000, 0x00001C02,
+0x1C01002F, 0x00090100, 0xFF00050F, 0x2564002A, 0xF7FFFE40, 0x015270F9, 0xFF14028D, 0x9401BCBC,
+0x016F010C, 0xA4ACF711, 0x527701F0, 0x5275FF16, 0x4C6BFF13, 0x4763FF0D, 0x0F00FF0A, 0x114A6531,
+0xFC001E00, 0x0004020E, 0x64FF1062, 0x18FF0E4A, 0x001C0200, 0x2009FC02, 0x0500FF12, 0x02000404,
+0x1C021408, 0x23100064, 0x00000400, 0xFC000A00, 0x00040004, 0x001E0400, 0x34001408, 0x32100241,
+0x00502402, 0x04005510, 0x37140400, 0x62191001, 0x73FF1354, 0x00041455, 0x5A505310, 0x04FF1020,
+0x57764105, 0x2D1CFF12, 0x030F0808, 0xF4004110, 0x0004001D, 0x00050400, 0x2C000008, 0x00040041,
+0x00000C00, 0x2C001914, 0x3C200032, 0x00141000, 0x04001E00, 0x0A080000, 0x01000400, 0x5F3004F0,
+0x2D20FF11, 0x0A0C8510, 0x0C135E21, 0x00100000, 0x12608631, 0x10000500, 0x00040014, 0xF30A2000,
+0x07547200, 0x084E67FF, 0x0B4457FF, 0x4D757FFF, 0x54025548, 0x59E0006E, 0x00425800, 0xFB1303FC,
+0xCE04C188, 0x3F080102, 0x0002E501, 0x04040185, 0x03180200, 0x01003000, 0xB8000004, 0x001B0006,
+0x00002801, 0x040009F0, 0x0D280700, 0x5110C001, 0x5B7FFFE7, 0x0017BC0F, 0xE8000DB4, 0x688E2304,
+0x67222808, 0x0028180F, 0x0404281C, 0x1C681200, 0x0A14000A, 0x0F6B9440, 0x000004FF, 0xD80008E4,
+0x67903203, 0x1205040B, 0x00193869, 0x94310DFC, 0x05080968, 0x00044C00, 0x2C000928, 0x6F995018,
+0x5894FF0F, 0x0A662123, 0xAA404F5C, 0x2CFF0579, 0x6781724A, 0xF2FFFF1A, 0x006DDCC4, 0xED0400C1,
+0x00080D00, 0x0000D500, 0xF0020004, 0x00DF0100, 0x0200240F, 0x002D2802, 0x38040144, 0xFFFF201E,
+0xE36036F0, 0x23637FFF, 0x1023A0FF, 0x50407CA6, 0x94FF086F, 0x1127906C, 0x00368C07, 0x980009F4,
+0x00B4010A, 0x0404EC00, 0xE00004E0, 0x0004010E, 0xE4FF0B20, 0x14FC0009, 0x0209F400, 0x0C110008,
+0xF800290C, 0x10280009, 0x00014C00, 0x040004F0, 0x05680000, 0x0B669240, 0x0027E8FF, 0x9271002C,
+0x90FF0F68, 0x06641068, 0x729600F2, 0xA5CAFF1A, 0x99B9FF53, 0xA4BBFF57, 0x300EFC7E, 0x5CFFF9FF,
+0x18C4021C, 0x0D00E802, 0x110D00DF, 0x00280F00, 0x00390D15, 0xFF00110F, 0x07390008, 0x450C3C00,
+0xF8FFFFFD, 0x68001C94, 0x066C0001, 0x71034802, 0xFFD6E6F6, 0x24144566, 0x56776309, 0x4D69FF17,
+0xEC0304E4, 0x45F00045, 0x1004FC05, 0x0004F449, 0x18000004, 0x00080223, 0x0004F402, 0x0400190C,
+0x00080205, 0x00050000, 0x0C042318, 0x0008001E, 0x00050000, 0x00020004, 0x371C0205, 0x00503400,
+0x04000500, 0x370C0000, 0x14507241, 0x000500FF, 0x52105F20, 0x13116438, 0x73325A44, 0x00081554,
+0x64305310, 0x32201111, 0x050F0800, 0x10032820, 0x0A00000A, 0x11577932, 0x58611410, 0x5879FF12,
+0x0445F413, 0x000604FC, 0xFF112005, 0x08000504, 0x05040414, 0x02141000, 0x14000004, 0xFF10201E,
+0x00043C40, 0x13F40005, 0x01000400, 0x5F610A18, 0x6087FF11, 0x00372C11, 0x2000231C, 0x7107F014,
+0x6BFF0453, 0x57FF0C52, 0x83FF0E42, 0xFFFF4E73, 0xFFFFEFFF, 0x510A08FD, 0xF9F6FFFF, 0x000DB8FD,
+0x0000040F, 0x4EAC000E, 0x0004FC02, 0x8C0002B7, 0x00040801, 0x01041002, 0x4700002C, 0x05000D14,
+0x03095500, 0x37000F5C, 0x00290000, 0xECFF03F1, 0x256A87FF, 0x0A668DFF, 0x096691FF, 0x096490FF,
+0x8B312D04, 0x00080F64, 0x0E668E71, 0x0D668EFF, 0x24010004, 0x0508042D, 0x2D106712, 0x0004FC00,
+0xE8000004, 0x68912008, 0x0D1308F4, 0x0D602D28, 0x09668FFF, 0x000400FF, 0xF8000A04, 0x6A94352B,
+0x00043807, 0x9C31051C, 0x4A640F6E, 0x00709CB2, 0x0B6D90FF, 0x3D788AFF, 0xC4000600, 0x009C00B3,
+0x0000A400, 0x040F00E7, 0xF4002200, 0x02B5021E, 0x51064800, 0xFFFFFBF7, 0xF002D0F9, 0xF1FFF103,
+0x7BFFADDD, 0x9AFF0E58, 0xA4FF0967, 0xF4FF056D, 0x04D00018, 0x076A9150, 0x14A895FF, 0xFF096C52,
+0x14B06996, 0x0009E400, 0x040014D4, 0x04BC0000, 0x00000408, 0x040404EC, 0x04F00000, 0x0004F800,
+0x040400F0, 0x00140000, 0x0A679231, 0x1C003314, 0x00100101, 0xFF0C6930, 0x58000500, 0x8703F001,
+0xBCFF0961, 0xC0FF4397, 0xABFF509F, 0xF3FF5790, 0x003BECE5, 0xDC0009FA, 0x0364000A, 0x2A01010F,
+0x2201360F, 0xFB00350F, 0x00018000, 0xFF2086C4, 0x017BE4FF, 0xFE211580, 0x022A48FA, 0xF7D10C7A,
+0x738D9EFF, 0x184967FF, 0x1E5A7CFF, 0x5E7140E0, 0x61FF0C46, 0x0004124A, 0x0040E800, 0x080004FC,
+0x2808011E, 0x00280000, 0x08012810, 0x1C11122D, 0x124A2223, 0x4B250F08, 0x05000813, 0x4C211E0C,
+0x000F1016, 0x1800281C, 0x1E0C040F, 0x174E6C31, 0x14046940, 0x64340023, 0x21050401, 0x5A201550,
+0x64107110, 0x000C5213, 0x321C5210, 0x02693C00, 0x0C00643C, 0x14140119, 0xFF135430, 0x04015538,
+0x0F140005, 0x003C3003, 0x18001910, 0x050C022D, 0x05041511, 0x01191000, 0x58210EFC, 0x042D1414,
+0x14000508, 0x37380023, 0x12050801, 0x023C185C, 0x11200504, 0x000008FF, 0x8520373C, 0x1141305E,
+0x01322013, 0x5F120514, 0x88900F00, 0x88FF0E60, 0x86FF0C61, 0x62210004, 0xB219600E, 0xFF12536F,
+0xFF0F425D, 0x08476C86, 0x0F0C0304, 0x00029400, 0x13006458, 0x000C0004, 0x71ADFA11, 0x00019C00,
+0x0408000E, 0x00140000, 0x010F3C06, 0x04000918, 0x1C380105, 0x0B09FC00, 0x2F000500, 0xFF0BF100,
+0x88A3FFEF, 0x5E81FF48, 0x6189FF08, 0x638BFF08, 0x658BFF0A, 0x658CFF0D, 0x00000810, 0xAC00000C,
+0x00040003, 0x0212AC00, 0x0E110004, 0x18000A18, 0x05140005, 0x0404FC00, 0x0C040004, 0x00100005,
+0x00050000, 0x24010A18, 0x0A694004, 0x03FC95FF, 0x080A6721, 0x0E280009, 0x000A1C00, 0x95310E40,
+0x1F2C046E, 0x97C6D832, 0x540027F4, 0x009C011B, 0x0F00DC08, 0x001D000C, 0x44000041, 0x8D3C0004,
+0x02061802, 0x01F202B4, 0x7C93FFED, 0x5C81FF44, 0x6495FF0C, 0x699DFF08, 0x9C000500, 0x6A8F710A,
+0x6B90FF08, 0x314F7809, 0xA0086A97, 0x04F0082C, 0x01000C04, 0x6B1200D0, 0xF40C1F08, 0x04FC0504,
+0x240C6921, 0x01000033, 0x00334400, 0x923104F4, 0x0668116A, 0x000B3C00, 0x4C000168, 0xA3CAB338,
+0x9FBFFF54, 0x98B0FF58, 0x4009FC64, 0xFEFDFFF7, 0xEE044BAE, 0x00F80F01, 0x00300F1D, 0x44003AFF,
+0x35900202, 0x00015602, 0x440209F4, 0x95100003, 0xFFFF00F1, 0x4459FFE9, 0x5C78FF1E, 0x5C79FF26,
+0x0022E41F, 0x647104FC, 0x5EFF154D, 0x27F01046, 0x011DFC00, 0xFC000500, 0x00040304, 0x00001400,
+0x18040004, 0x14080500, 0x03140C00, 0x04000004, 0x04F80105, 0x03050400, 0x08010004, 0x781C030A,
+0x00050400, 0x04007838, 0x0A080105, 0x7D584F10, 0xFCFF1520, 0x6E200004, 0x03000401, 0x2C015A34,
+0x10521350, 0x2818001E, 0x12372000, 0x00050052, 0x10015F28, 0x3220031E, 0x0004FC02, 0x10025528,
+0x23180A1E, 0x00553003, 0x30003228, 0x10592150, 0x04003230, 0x281C0005, 0x00000405, 0x5C40231C,
+0x1084FF11, 0x125D3014, 0x000A08FF, 0x040004FC, 0x0A040000, 0x00372804, 0x68003220, 0x2D280004,
+0x005B2800, 0x76A0468C, 0x63FF1655, 0x87FF0E43, 0x00C1D06D, 0xF8113000, 0xF400C830, 0x21D00053,
+0x01031601, 0xDC002C14, 0x01960203, 0x02000606, 0x240001B0, 0x00040000, 0x0005000A, 0x04000030,
+0x0A000705, 0xA1002F00, 0xBFFFF1FF, 0x76FF6EA6, 0x46B80655, 0x0A648941, 0x6109FCFF, 0x8AFF1065,
+0x05040E63, 0x00658D20, 0x0A08000A, 0x00000404, 0x04020010, 0x05000C00, 0x0004F800, 0xE4000004,
+0x6A908003, 0x6B91FF0C, 0x141CFF0D, 0x51090800, 0xFF126897, 0x510F5495, 0x6B92FF07, 0xC12D5809,
+0xFF08668C, 0xFF076485, 0xFF0F5770, 0xFD1063E0, 0xB5000EA0, 0x00C20114, 0x0F00DB06, 0x001E000A,
+0x950000DD, 0x09500057, 0x00003D00, 0x06F10010, 0xFBFFFFF5, 0x4F6AFFD9, 0x6088FF0F, 0x6493FF0D,
+0x699AFF08, 0x000A0007, 0x880018C0, 0xC88F1041, 0x0EF00413, 0x19D06A16, 0x0409BC00, 0x10000004,
+0x0004012E, 0x09241003, 0x692104F4, 0x0133300C, 0x6C211528, 0x0018E40E, 0x90311DE0, 0x3D400E65,
+0x0013F000, 0x03F0011C, 0xFF07638A, 0xFF2E83AC, 0xFF539EC5, 0xFF5693B2, 0x9368CEE1, 0xFDFFF140,
+0x0247A8FD, 0xB60006C4, 0x00040F00, 0x68046AFF, 0x0008020D, 0x00024000, 0x44000C50, 0x00080003,
+0xD4FFF151, 0x40C89BC1, 0x25617D75, 0x195673FF, 0xD40022F8, 0x09F0000E, 0x12476640, 0x000004FF,
+0x040827F0, 0x00140000, 0x08000400, 0x0C000014, 0x49684800, 0x0004FF14, 0x04190400, 0xFC010004,
+0x190C0004, 0x00643401, 0x1620320C, 0x007810FF, 0x00007838, 0x00040005, 0x416E4000, 0xFF155072,
+0x0C000F08, 0x0004030F, 0x14507480, 0x155175FF, 0x046428FF, 0xAC000004, 0x34781014, 0x00040064,
+0x0404FC00, 0x55505A2C, 0x557BFF14, 0x15200FD0, 0x002D10FF, 0x7B10000C, 0x57304128, 0x3208FF13,
+0x00370C00, 0x18003C2C, 0x587E4019, 0x0004FF10, 0x233C3000, 0x4B305B82, 0x034B3400, 0x86A20004,
+0x86FF0F5C, 0x85FF0E5D, 0x0046405E, 0x08015028, 0x145F2114, 0x4C000514, 0x5F853137, 0x208EDC0D,
+0x2840678C, 0x4B5C1111, 0x6064A000, 0xFF114260, 0x8770ADC1, 0xCBD4F211, 0x00040E00, 0x080012C4,
+0x0B880100, 0x00092400, 0xE001031D, 0x00090009, 0x00000400, 0x040001A4, 0x08F00300, 0x01000B00,
+0x50000020, 0x05000003, 0x00000400, 0xCC030E18, 0x1D4C0115, 0xFFF102F1, 0xFF8FBDD4, 0xFF064B6A,
+0xFF065677, 0xF80B6085, 0x638C3104, 0x0100080E, 0x64220504, 0x2705140F, 0x0F140E66, 0x040A0406,
+0x0C000A08, 0x00040005, 0x001E3C00, 0xFC0003E4, 0x6B8F8004, 0x688EFF0D, 0x141CFF08, 0x14689781,
+0x136796FF, 0x211D04FF, 0x37740A6C, 0x055E80A0, 0x095670FF, 0xD098ACFF, 0x49E80095, 0x0000A402,
+0xD20000B2, 0x00040F00, 0x00FD0027, 0x00004C00, 0xF0000004, 0x10500000, 0xB2FFEED1, 0x76FF77A2,
+0x86FF0D56, 0x1484055E, 0x00199400, 0xE80013EC, 0x05B0000E, 0x0000B000, 0x040023BC, 0x0AA00000,
+0x0104E80F, 0x0204F004, 0xF40218E0, 0x0AF8000F, 0x0000040C, 0x08006BF4, 0x05000001, 0x0F639131,
+0x89104264, 0x67211058, 0x000A080D, 0xC26022F4, 0x9EFF519B, 0x00C2C083, 0xF5115EE0, 0xE40032C6,
+0x00040001, 0x2700FC0F, 0xFF003A0F, 0x01840034, 0x01000400, 0x7401014E, 0x09FC0008, 0x00488900,
+0xEED121A8, 0x376980FF, 0x21627EFF, 0x21617DFF, 0x689022F4, 0x64FF0E4B, 0x66FF0C48, 0x491F27E8,
+0x0F0B04FC, 0x04210500, 0xF4000504, 0x00040009, 0x080A0000, 0x08010500, 0x144F250F, 0x71310500,
+0x000C134F, 0x0105000F, 0x03050802, 0x53300A04, 0x5528FF13, 0x00000404, 0x080004F4, 0x0500050A,
+0x13051000, 0x00412857, 0x0400643C, 0x1C5A1200, 0x0500011E, 0xFF115934, 0xF8000504, 0x1908000E,
+0x08000400, 0x30000500, 0x18F0003C, 0x12618231, 0x30014130, 0x135E613C, 0x156389FF, 0x88310D8C,
+0x3C401363, 0x00001800, 0x78731470, 0x61FF1F57, 0x64502048, 0xA004F911, 0x00067600, 0xF002067E,
+0x03D8022F, 0x0001A000, 0xA4010004, 0x09F10401, 0x00000D00, 0x040003FF, 0x000C0000, 0x000F0001,
+0x04000030, 0x05000600, 0xF10F5400, 0xF4FFFF04, 0xA7CDE0FF, 0x084460FF, 0x055270FF, 0x0B5F81FF,
+0x8C3D32B0, 0x05000F62, 0x000F0C00, 0x10000004, 0x0004000A, 0x000F0C00, 0x8D3104FC, 0x14200C65,
+0x00000C00, 0x04010004, 0xFC691005, 0xFF0B3037, 0x211CE88E, 0x0F300C6A, 0x13659571, 0x126695FF,
+0x03F01D18, 0xFF0C6D90, 0xFF005C7E, 0xFF075876, 0xFF0D4A5F, 0x12FCEFFC, 0x05DBF612, 0x012DB001,
+0x050F00B9, 0x01002C00, 0x00040001, 0x00004700, 0xE7D10958, 0x154C61FF, 0x055475FF, 0x015D86FF,
+0xE80009A8, 0x2DAC0004, 0x3104E800, 0xF00B698F, 0x04E00123, 0xA0086721, 0x0018000A, 0x03001001,
+0xF00009EC, 0x0004000E, 0x0014C000, 0xE8000500, 0x04F80809, 0x000AFC00, 0x480013EC, 0x668B311A,
+0x0018E40A, 0x10F327E8, 0xFF106490, 0xFF14668E, 0xFF11648C, 0xFF0B658A, 0xFF167299, 0xFF449BC6,
+0xFF488DB4, 0xF882A8BF, 0x5AE0020F, 0x000BE800, 0xCF012DE4, 0x00BB0001, 0xFF00040F, 0x08380062,
+0x0322FC00, 0x83020333, 0x024C0001, 0x51038600, 0xE2F7FFF7, 0xB290BCC7, 0xFF1E6382, 0xFF1B5B77,
+0x9C094561, 0x164F2136, 0x632663D8, 0x0013E044, 0x08000A0C, 0x00040C14, 0x08001800, 0x0C020004,
+0x1904001E, 0x1E381311, 0x02001000, 0x1802190C, 0x14040023, 0x03050401, 0x10010F04, 0x3C1C0319,
+0x00051000, 0x1C001E14, 0x0508001E, 0x000F0000, 0x04001414, 0x0A100400, 0x000F0800, 0x00010004,
+0x0F080314, 0x01141000, 0x44041408, 0x0A100069, 0x6E505412, 0x006E3C00, 0x04040508, 0x0F0C0200,
+0x02280C00, 0x08001408, 0x4130000A, 0x31000400, 0x040F597C, 0x0F0C0505, 0xFF115D41, 0x110F0484,
+0x314B1C0F, 0x300F5F82, 0x5F7F7150, 0x5E7FFF13, 0x00000415, 0x8622554C, 0x0009F861, 0x08F1464C,
+0xFF1A6688, 0xFF135E7E, 0xFF196283, 0xFF21607F, 0xFF1D4A67, 0xCCB4D0E5, 0x04F800EE, 0x10A3D400,
+0x000A05F7, 0x70012700, 0x09E80242, 0x0221DC00, 0xA0000504, 0x00040001, 0x0208F000, 0x060201B2,
+0x094E0000, 0x00001800, 0x19000004, 0x00200219, 0x00005400, 0x05F0DAD0, 0xFFB2D3E4, 0xFF0B3F57,
+0xFF024C67, 0xFF0A5D7D, 0xFF0F6388, 0x8B410500, 0x04FF1063, 0x0A000300, 0x050F1800, 0x24000004,
+0x20661214, 0x648C400F, 0x0510FF0C, 0x02142400, 0x0D110004, 0x00010448, 0x0B69A104, 0x0F698CFF,
+0x0F678DFF, 0x00004154, 0x0A200005, 0x086587D0, 0x005A79FF, 0x054F68FF, 0x653478FF, 0x0019F400,
+0x21006D8E, 0x027C0056, 0x0F00B902, 0x032B0006, 0xE8040548, 0xDC00F205, 0x64FFA2CC, 0x77FF0949,
+0x87FF0454, 0x37EC0460, 0x123CF000, 0x001EB868, 0xF40009AC, 0x04F00128, 0xB00A6721, 0x04E40027,
+0x0404D400, 0xEC040004, 0x1EF80004, 0x01001404, 0x682113DC, 0x002CD00F, 0x000004EC, 0x06080006,
+0x04678C20, 0xFF0D2206, 0x11F00620, 0x638EFF0E, 0x638BFF12, 0x6389FF11, 0x86AEFF0B, 0x96C1FF2D,
+0x87AAFF3F, 0xEAFCFF43, 0xFBFFFFCD, 0xF800AC64, 0x01D40318, 0x0300FA00, 0x0B0001AF, 0x00040F00,
+0x84005FFF, 0x01800002, 0x00000800, 0x0C000691, 0x01850000, 0xD13E8C01, 0x8CA5FFF2, 0x5774FF6A,
+0x6682FF1A, 0x0027F01F, 0x00F522D4, 0xFF0F4866, 0xFF114867, 0xFF144565, 0xE0174866, 0x04F80C18,
+0x08001000, 0x100404F8, 0x04F00000, 0x04000404, 0x10000020, 0x05040000, 0x0404FC00, 0x04010004,
+0x37140305, 0x00050400, 0xFC000A08, 0x00040404, 0x00050400, 0xFC004B28, 0x00040004, 0x002D1800,
+0x08000004, 0x05000405, 0x07553001, 0x08000504, 0x140C0105, 0x0004FC03, 0x2400000C, 0x3C280041,
+0x04373400, 0x0C000A1C, 0x6E4C0005, 0x00191000, 0x28005F0C, 0x13B80032, 0x1A231802, 0x03322411,
+0x50001914, 0x5A580050, 0x105F7EB1, 0x125E7EFF, 0x145F7FFF, 0x83316A14, 0x05341760, 0x215A4801,
+0x5A781260, 0xD00A2001, 0x80FF1762, 0x71FF1E60, 0xBAFF2051, 0x203C28A5, 0x76A4FFF7, 0x0104FB00,
+0xFC016068, 0x04BE020E, 0x0004F800, 0x080021E0, 0x093D0200, 0x0301A903, 0xB3000007, 0x00180001,
+0x00214C09, 0x3001002D, 0x00250072, 0xFFF702F1, 0xFFB6D3E3, 0xFF0A3A51, 0xFF014761, 0xC0095A78,
+0x13200046, 0x0108AC00, 0x08000500, 0x05040F05, 0x0F642101, 0x000E26C0, 0x14280005, 0x26E00D11,
+0x0B678C62, 0x38688BFF, 0x6592710F, 0x6796FF0E, 0xE0052C11, 0xFF045A7D, 0xFF004E6C, 0xFF07455C,
+0x7CD8B9C7, 0x0209A000, 0x9F009738, 0xBB3C0000, 0x0F00BC02, 0x00280006, 0xFE100AEB, 0x2C0041F8,
+0xFFF1D101, 0xFF35657B, 0xFF044B69, 0xA0005175, 0x0F880005, 0x0009E000, 0xFC0004F4, 0x6A912204,
+0xDC0037F4, 0x00040009, 0x004BE400, 0xF40004E8, 0x04EC0504, 0x1EE06912, 0x00001400, 0x040109E8,
+0x0E676500, 0x0D6690FF, 0xE0000500, 0x00040005, 0xF4699120, 0xFF0D6009, 0xFF08648B, 0x54000618,
+0x00040006, 0x0A638DE0, 0x3E97BFFF, 0x398CB4FF, 0xD08CABFF, 0x571C0090, 0x00018C00, 0xE0000004,
+0x2DF80069, 0x0F06A402, 0x0F2800FE, 0x2FFF003B, 0x009D0C00, 0x38020B84, 0x014F0439, 0xE1165000,
+0x4360FFEE, 0x6884FF1C, 0x5B75FF2B, 0x63D4FF18, 0xF0104821, 0x13C80045, 0x18476373, 0x184761FF,
+0xE8000500, 0x00040F22, 0x14480023, 0x00000404, 0x2C002310, 0x0004009B, 0x0004F400, 0x040C2D0C,
+0x04F80000, 0x042D1400, 0xFC000004, 0x00040004, 0x00231C00, 0x10000004, 0x00040028, 0x00412404,
+0x0400000C, 0x502C0000, 0x00000400, 0x04040504, 0x37300000, 0x04232400, 0x04010004, 0x73500005,
+0x213C3400, 0x1E181358, 0x06691000, 0x11120004, 0x5A165F4C, 0xC8000008, 0x0520000E, 0x125D7D40,
+0x403234FF, 0xFF0F5E7D, 0x24000004, 0x5D82200F, 0x15115030, 0x87101924, 0x5F902818, 0x6085FF10,
+0x6287FF0E, 0x12C06470, 0x1F6386FF, 0x205372FF, 0x8CAABFFF, 0xF13C00B9, 0xF9FFFF30, 0x23014ECC,
+0x0B950003, 0x020B8800, 0x000F082C, 0x31010B05, 0x45070100, 0x0001C201, 0x6100000F, 0x0BDC0004,
+0xF001DD00, 0xFFF5FF08, 0xFFB5D1DF, 0xFF0A384F, 0xFF054862, 0xFF0B5A78, 0xFF14668B, 0xC4001EA0,
+0x0A0C004B, 0x40000404, 0xFF106489, 0x14000004, 0x14180805, 0x000A1405, 0x65210524, 0x4119340D,
+0xFF0C668B, 0x68620A00, 0x6487FF0C, 0x000A000A, 0x64101804, 0x11D312FC, 0x004A6BFF, 0x054A69FF,
+0x07374DFF, 0xD4000DFC, 0x00040000, 0x01207002, 0xAC003CA4, 0x00B50100, 0x2000050F, 0x0007B800,
+0x0B000004, 0xFD06F246, 0xF6FCFFF9, 0x3951FFDF, 0x4F6FFF03, 0x5579FF04, 0x6B90FF01, 0x80015A7C,
+0x0E6A305A, 0x0004ACFF, 0xE80004B4, 0x0EE00004, 0x00000400, 0x1400000C, 0x00040000, 0x0409D400,
+0xDC000004, 0x00040009, 0x11001006, 0x0005D40E, 0x04000B04, 0x04EC0000, 0x01002000, 0x67620004,
+0x648CFF0B, 0x0006280B, 0x02F01054, 0xA3FF085F, 0xBAFF1A77, 0xA2FF3790, 0xE3FF357F, 0x00CA74CA,
+0x980009FC, 0x0100030B, 0x0000B400, 0x040000FC, 0x00FB0F00, 0x00330F20, 0xF80036FF, 0x0D3A0018,
+0x00015000, 0xF4013038, 0xFF07F12C, 0xB0C6FFF7, 0x5370FF94, 0x5E77FF26, 0x556FFF20, 0x4A63FF13,
+0xF013F80C, 0x0E496907, 0x104869FF, 0x144563FF, 0x144661FF, 0x104765FF, 0x104965FF, 0x00040F3C,
+0x4A662023, 0x3400553C, 0x00040232, 0x104C6840, 0x480004FF, 0xFF104D6A, 0x6B400004, 0x04FF114E,
+0x69440000, 0x0F4E6D44, 0x000004FF, 0x04008254, 0x5C711000, 0x10513087, 0x040008FF, 0x08008750,
+0x2D280000, 0x0004F800, 0x14010004, 0x4853102D, 0x18121173, 0x1E140423, 0x04000804, 0x20020500,
+0x3C380223, 0x21230801, 0x2314135A, 0x01050800, 0x00050A08, 0x00180005, 0x7BFF17A4, 0x7CFF1759,
+0x04FF135C, 0x28300005, 0x00141C00, 0x87311E1C, 0x0F24155E, 0x001E1000, 0x94003214, 0x0F280021,
+0x648800F5, 0x5E80FF18, 0x4967FF1C, 0xDBF0FF1A, 0x000F00BF, 0xEC000A00, 0xD9FF1104, 0x08D4004E,
+0x0F050002, 0x00020F00, 0x040101B5, 0x03450200, 0x0504F300, 0x0D00000F, 0x739C0000, 0xD14CBC01,
+0xBFCFFFF5, 0x3B52FFA2, 0x4C66FF0B, 0x00050009, 0x897132A4, 0x88FF1163, 0x00041062, 0x98628720,
+0x00040205, 0x00050C00, 0x040446D0, 0x04FC0900, 0x00050000, 0x04030004, 0x0E000005, 0x00050800,
+0x919312F0, 0x91FF1169, 0x93FF0D64, 0x00F34C10, 0xFF004565, 0xFF053D58, 0xFF6C8FA3, 0x5CF1FEFF,
+0x30F203EA, 0x0332B800, 0xB40100A4, 0x00050F00, 0x0AE00021, 0x01C70B00, 0xF7D190D9, 0x6E8C96FF,
+0x043D58FF, 0x004A6CFF, 0x953119E4, 0x0AA0126E, 0x04318400, 0xD00004C8, 0x09C80014, 0x012CAC01,
+0x000A2CB0, 0x04D0012E, 0x00290C0F, 0x0A04F002, 0x08010504, 0x09652305, 0x040009FC, 0x380D110F,
+0x8D04F65B, 0xBBFF0861, 0xB0FF2A8C, 0x98FF2D86, 0xFFFF3C79, 0xB3C8DCFF, 0x0001D801, 0xFC030AB5,
+0x01BB0209, 0x2100FE0F, 0xFF00340F, 0x0D340033, 0x8E20FA10, 0x4288FD10, 0x00213800, 0x0FF01900,
+0x637BFFEF, 0x5A79FF3F, 0x627BFF27, 0x5D77FF24, 0x5874FF1B, 0x5979FF17, 0x5A7DFF17, 0x773CFF18,
+0x577900FF, 0x5677FF1C, 0x5877FF1E, 0x5877FF1B, 0x26000419, 0x1C597848, 0x400004FF, 0xFF1B5A79,
+0x7B4D0004, 0x04FF1B5A, 0x1A5B4B00, 0x00047BFF, 0x057CD800, 0x9C000004, 0x1959A100, 0x195B7DFF,
+0x1A5A7DFF, 0x7E720008, 0x7EFF1B5B, 0x00041A5C, 0xFF185D40, 0x03000C7F, 0x7F7E0008, 0x80FF185C,
+0x0004195D, 0xFF185E50, 0x04A05E82, 0x1DAC1811, 0x195F8136, 0x60700008, 0x6081FF17, 0x0ED8FF17,
+0x00001800, 0x040004C4, 0x78480000, 0x17618431, 0x00F1A5F8, 0xFF166188, 0xFF176188, 0xFF176089,
+0x08155C86, 0x62894000, 0x04F4FF17, 0x00002400, 0xFC0013FC, 0x5F7D7309, 0x6079FF26, 0x00261438,
+0xFF408AA8, 0x04FCF7FF, 0x0315000A, 0x00222000, 0x0003018C, 0x02EE0505, 0x00001C00, 0x11050004,
+0x03490300, 0x05002802, 0x23000016, 0x091C0100, 0xD1000900, 0xACBFFFF5, 0x415CFF8B, 0x526FFF0E,
+0x0028880F, 0x8A3123A8, 0x04FC1463, 0x00050400, 0x040D55D0, 0x0E622100, 0x10001428, 0x0A100005,
+0x00000401, 0xE00004FC, 0x1065211C, 0xEC002840, 0x00040121, 0x000B6521, 0x628E2019, 0x02F10424,
+0x5173FF12, 0x4966FF00, 0x3751FF06, 0xEAFBFF0F, 0x000400D5, 0xFF134352, 0xA7003AF6, 0x13BB012C,
+0x05009F00, 0x090F00B5, 0xE0001C00, 0x00400100, 0x91095400, 0x404FFFEF, 0x4561FF19, 0x000A7808,
+0xF00032E0, 0x0F98000E, 0x007C6000, 0xF80004D8, 0x658E2004, 0x0E240EB0, 0x020500FF, 0xB80013CC,
+0x0FD0001D, 0x0000040A, 0x2C00052C, 0x0004015B, 0x0900F003, 0x2000060C, 0x09656115, 0x09658CFF,
+0x8F600A1C, 0x8BFF1166, 0xD24C3463, 0x8BBBFF10, 0x7EA9FF25, 0x9FB7FF27, 0x0037EC71, 0xF50004F8,
+0x15000000, 0x0010DC00, 0x000F00B8, 0x2F0F2D06, 0x2F0F1C01, 0x0002FF00, 0x800009F0, 0x00040038,
+0x02885E00, 0x1EFF2A40, 0x455BFFEF, 0x5B76FF21, 0x627BFF29, 0x617BFF2A, 0x627EFF25, 0x6383FF22,
+0x6487FF22, 0x6286FF22, 0x6185FF22, 0x6081FF25, 0x617FFF28, 0x2C000426, 0x08004400, 0x50020004,
+0x61814F00, 0x0004FF26, 0x25626502, 0x246180FF, 0x834F0004, 0x04FF2561, 0x626D1200, 0x6182FF23,
+0x20000422, 0x96586283, 0x18FF2320, 0x000C0082, 0x50000800, 0xFF216282, 0x0F002C84, 0x22020008,
+0x0020FF21, 0x04000802, 0x1401008C, 0x20624300, 0x000485FF, 0x22628840, 0x710004FF, 0xFF236186,
+0x34206083, 0x7F08F200, 0x7FFF2061, 0x7EFF2562, 0x6FFF2861, 0x62FF1D53, 0xFFFF1D49, 0x0E1CDBF8,
+0x6200FE12, 0x84FBF720, 0x02AA0006, 0x02032100, 0xC3000A00, 0x032B000E, 0x00001600, 0x040213E8,
+0x04F00400, 0x00002800, 0x1E020004, 0x00060500, 0x00001305, 0xF1510009, 0x6B91A8FF, 0x10006FA0,
+0x50C4003D, 0xC4618522, 0x0A080041, 0x0004F800, 0x10000504, 0x0004000A, 0x00000C00, 0xF0000014,
+0x04FC0069, 0x00000400, 0x00080A0C, 0x04080405, 0x0028E004, 0x04001800, 0x17FC000E, 0x00473400,
+0x0400A700, 0x6177203E, 0xF8008834, 0xFFF92013, 0x00024D4E, 0x2A640005, 0x053BD407, 0x090F00B5,
+0xC0001F00, 0x2AA8000C, 0xC0CB04F1, 0x3B4EFFA0, 0x4763FF08, 0x567AFF06, 0x6B93FF08, 0x40049813,
+0xFF0F678B, 0x00040004, 0x04A40005, 0x00000400, 0xD80004F8, 0x00180013, 0x0009DC00, 0x040809CC,
+0x00140000, 0x00050000, 0x04011F0C, 0x05F80700, 0x0100FC04, 0x66120018, 0x8B401EF8, 0x00FF0D62,
+0x6089801E, 0x7BA5FF03, 0x5EE4FF1A, 0x1E7096A0, 0xC6E9FDFF, 0x8CFDFFFF, 0x06D00046, 0x0301DC00,
+0xDB000108, 0x00040001, 0x0F019F00, 0x0F1F00F7, 0x37FF0032, 0x04035800, 0xFA203888, 0x0002A8FB,
+0x0AF10195, 0x7D8CFFF1, 0x475DFF5D, 0x4E65FF1D, 0x4F69FF21, 0x516CFF20, 0x526EFF1E, 0x009FB01C,
+0x71DF9FA0, 0x6EFF1C51, 0x6CFF1F50, 0x6AFF2150, 0x002C0004, 0x04040060, 0x4F6B4800, 0x0004FF20,
+0x09006000, 0x51650004, 0x506BFF1F, 0x0900041E, 0x5021001C, 0x09009021, 0x514F0014, 0x046CFF1F,
+0xCC011000, 0x1F512100, 0x6B6000D4, 0x6DFF1D50, 0x1100644F, 0x0100101D, 0xEC0000FC, 0x01040000,
+0x0C1E5122, 0x00080301, 0x13005C04, 0x40001C6E, 0xFF1E5170, 0x6E400004, 0x04FF2150, 0x690BF000,
+0x6BFF1F4C, 0x67FF2454, 0x5FFF2151, 0x62FF1C4B, 0x5DFF244F, 0x95FF244A, 0x00270C82, 0x04009DE8,
+0x1570004E, 0x00461400, 0xD80F0B84, 0x0D000C04, 0x22EC0105, 0x0000280F, 0x00034C0F, 0x5110DC02,
+0x6E86FFF1, 0x23291C40, 0x69F4577B, 0xFF166261, 0xC80E5E7F, 0x05040146, 0xFF126230, 0x040523A0,
+0xE4621200, 0x0508005F, 0x00051000, 0x04040504, 0x0F2C0000, 0x00051000, 0x30000004, 0x05180005,
+0x00044800, 0x40000440, 0x587B7100, 0x5574FF0F, 0x401E7010, 0xFFB1C4D5, 0xFC200FCC, 0x0021F8FE,
+0xFC00025C, 0xFFFD2004, 0x7C00090B, 0x03C90F02, 0x00F1002B, 0x7109FC00, 0x6475FFF1, 0x8463FF39,
+0xFF046075, 0xFF156588, 0xA0000F8C, 0x09FC0022, 0x00000400, 0xA00004D0, 0x648E312C, 0x010AB811,
+0x68100F10, 0x0C1214C0, 0xE00314CC, 0x04DC0404, 0x002EB400, 0x10040004, 0x00E40000, 0x0300040D,
+0x24011A1C, 0x6006F000, 0x618CFF0F, 0x6A93FF0A, 0x7EA8FF07, 0x7DA7FF19, 0x7D9FFF1D, 0xD80086D4,
+0x00A80077, 0x0001B000, 0xE40046D0, 0x050C0001, 0x05140C00, 0x070F0BBB, 0x3E0F2B01, 0x0029FF00,
+0x0400F4C0, 0x01430200, 0x0001A800, 0x080002A4, 0xEC09F405, 0xB1CFDAFF, 0xACC9DBFF, 0xABCADFFF,
+0xABCBE0FF, 0xA7CCDFFF, 0x04CBE1FF, 0xA802FF00, 0xAACADFFF, 0xAACBDEFF, 0xAACBDCFF, 0xABCADEFF,
+0x221F0008, 0x0038ABCA, 0x00000803, 0x04090044, 0x00580300, 0x01006400, 0x10000018, 0x00040B00,
+0xAAC9DD4F, 0x090004FF, 0x0B003C01, 0x140F0034, 0xDD4C0500, 0x04FFA9CA, 0x002C0F00, 0x00180C05,
+0xA8CBDF41, 0x210004FF, 0x0130AACA, 0xC9DE0BF0, 0xC9DCFFAD, 0xCADAFFAE, 0xC9D7FFAD, 0xCBD6FFAC,
+0xC6CFFFAB, 0xDFEAFFA5, 0xF8003FFC, 0x2C080004, 0x00016800, 0xC400B968, 0x03200003, 0x02000402,
+0x0600018C, 0x01900000, 0x08000800, 0x14000004, 0x04D60200, 0x02044002, 0x17030010, 0x00290805,
+0x00035D03, 0xF0B0005C, 0x20536EFF, 0x195D82FF, 0x82DC85FF, 0xFF135D61, 0xC8156183, 0x28B0007D,
+0x0046C800, 0x04080504, 0x04F40100, 0x01050403, 0x6321000C, 0x000F0C0F, 0x040004FC, 0x09F80000,
+0x00001800, 0x86200F44, 0x11231C5E, 0x0019000C, 0x7BB37E48, 0x71FF155A, 0x63FF1754, 0x60041F4C,
+0x0018F000, 0x8C0019CC, 0x0EB50200, 0x0209B800, 0xB30B22B4, 0x000F0F00, 0x0050001A, 0xFFF807F0,
+0xFFD2ECF9, 0xFF093D55, 0xFF0B506F, 0xFF0A5678, 0xFF13678B, 0xE4003B78, 0x0A980004, 0x70000402,
+0x648DFF0D, 0xE88DFF0F, 0x0004001E, 0x040D6521, 0x09C4014C, 0x0B14CC00, 0xD4010500, 0x0FE80304,
+0x00000C01, 0x63210034, 0x00293810, 0x040005F8, 0x01080000, 0x31061400, 0xF40C6085, 0x608A2022,
+0x0760A9F4, 0x127CA4FF, 0x200F80FF, 0x4AE8C8E6, 0xCDADEF11, 0x00215F00, 0xF720932C, 0x0010E8FE,
+0x000F0604, 0x0474FF05, 0x40001E00, 0x74FC1403, 0x10AC003A, 0x0172E800, 0xA4005C40, 0x08A00003,
+0x00000400, 0x0400000C, 0x000C0000, 0x00129C00, 0x7400000C, 0x0BE0002F, 0x2100080F, 0x00003400,
+0x040F0044, 0x84000500, 0x0024002D, 0x00006008, 0x0408000C, 0x003C0F00, 0x00180F05, 0x00540005,
+0x0F000408, 0x0C050028, 0xF4000018, 0x00040C00, 0x0C002404, 0x28000050, 0x01200000, 0x00000800,
+0x20000004, 0x00B40000, 0x0035F800, 0xFC0009F0, 0x1D9D0045, 0x3D74FE11, 0x0018F000, 0xD002641C,
+0xFFFF2204, 0x09043BFC, 0x04E00304, 0x0101A100, 0x24020004, 0x15B80005, 0x01000408, 0x2B00001B,
+0x00370400, 0x51001105, 0xE9F6FFFC, 0x90BF88D3, 0xFF1A648B, 0xFF19608A, 0x297DE483, 0x05001460,
+0x00050400, 0x08040004, 0x050C0079, 0x2550C801, 0x14240F61, 0x0004F000, 0x04000A10, 0x03F80000,
+0x0409FC00, 0x8C311ED8, 0x2BF80C60, 0x608000F1, 0x5E7CFF14, 0x4D6CFF1D, 0x9CB2FF18, 0x00050078,
+0x680004EC, 0x00080011, 0x7E19FF10, 0x0000A801, 0xF2044BB0, 0x00B50500, 0x1C00090F, 0x5155EC00,
+0x99ABFFEF, 0x412A9C7A, 0xFF085476, 0x6321608C, 0x003D740E, 0x8E402890, 0x04FF0865, 0x1ECC0000,
+0x001EEC00, 0x0400229C, 0x64883100, 0x1F65C00C, 0x0804FC89, 0x04003400, 0xF00009F4, 0x00040004,
+0x0A00F800, 0x48020004, 0x1FD40010, 0x06628B31, 0xA1607D34, 0x8DFF0C77, 0x126DDC6D, 0x2110DCDA,
+0x14F6F7FA, 0x0002CA00, 0x6200020E, 0x019F0108, 0x2D00FF0F, 0x1C012E0F, 0xFF002F0F, 0x028C0003,
+0x00018800, 0x0C010004, 0x1A9C0000, 0x21086000, 0x0A18FFFE, 0x02001401, 0xB000084B, 0x00040020,
+0x0003B000, 0xAC000004, 0x0154021C, 0x0F002500, 0x02250004, 0x060E0042, 0x00500F00, 0x003A0E15,
+0x0B00120F, 0x0F00580C, 0x050B002E, 0x370C001E, 0x00100000, 0x03001D0D, 0x1C000011, 0x01470000,
+0x006D8C01, 0xFC31014C, 0x39F4F9FF, 0x0002FA00, 0x000649B0, 0x0148000D, 0x0A03F810, 0x12080F00,
+0x03C6DCFC, 0x07030046, 0x004D0300, 0x00033101, 0x000C000C, 0x00100205, 0x03001F01, 0x07020032,
+0x002C0000, 0xF0086800, 0xCEFFF703, 0x71FFA5BF, 0x87FF1853, 0x88FF1560, 0xC8FF165F, 0x61814037,
+0x28ACFF15, 0x004BCC00, 0xB80404F8, 0x3CBC004B, 0x04001000, 0xB4000004, 0x04F0011E, 0x08126122,
+0x12612205, 0x3800283C, 0x3C63121E, 0x668D7183, 0x5F89FF18, 0xC246F00C, 0xFF186383, 0xFF24617E,
+0xFF1C4861, 0xF811B8C4, 0x5F000248, 0x00980202, 0x00024C00, 0xB804000E, 0x00A80059, 0x03001400,
+0x25050004, 0x00090A00, 0x00003200, 0x160A0004, 0x06640000, 0x62FFEC60, 0x54FF204A, 0x5A80713D,
+0x658AFF0C, 0x3137C811, 0x7C14688D, 0x668F4042, 0x0004FF0A, 0x1004BC01, 0x2074B862, 0x37F8FF10,
+0x0E638832, 0xF8030500, 0x0EEC0009, 0x00000404, 0xFC0009F0, 0x00040104, 0x105BDC00, 0x067EF862,
+0x00001F1C, 0x24240005, 0xEC648A22, 0x6489604C, 0x6185FF14, 0x085138E4, 0x0675A2FF, 0xB2A05AF8,
+0xFFFF5A96, 0xFFFFE7FF, 0x515BF8FD, 0xFAF5FFFC, 0x0042EAFB, 0xF8100B06, 0xF7003568, 0x00040000,
+0x0F00D10A, 0x8CFF000E, 0x0001B000, 0xAC000CBF, 0x00040303, 0xFF01B10F, 0x01390314, 0x0004A501,
+0xEC03000C, 0x014C0703, 0x2501480F, 0x00041400, 0x5B000953, 0x09600000, 0x01827800, 0xF8012262,
+0x05700022, 0x8FFFF592, 0x75FF5E7D, 0x1E801B58, 0xFF135D30, 0xFC0046B0, 0x19080078, 0x004BB405,
+0x5F2150C8, 0x013CB411, 0x0C000504, 0x00040400, 0xFF106034, 0x87410520, 0x18FF1361, 0x1430030A,
+0x00002C00, 0xEC0037E0, 0x6188E050, 0x668CFF13, 0x5774FF1E, 0x7889FF1E, 0xFC0055EC, 0x04A40003,
+0x0005A402, 0x6800008E, 0x37DC021B, 0x00010800, 0xC4000004, 0x0109060E, 0x0000D000, 0xE4020AD8,
+0x06450319, 0x023B3201, 0xFB111B9A, 0x30008D59, 0x002A0000, 0xDFFFF551, 0x2590A0C5, 0x3165D000,
+0xD0196388, 0x0E980414, 0x003B8800, 0xF4021DF0, 0xB011110E, 0x0A040074, 0x3004D801, 0xFCFF0E63,
+0x42980009, 0x0004D000, 0x38010004, 0x0D602100, 0x89404138, 0x04FF0D62, 0x0A500000, 0x1F088613,
+0x0004F400, 0x08000AF4, 0x0004000B, 0x13628940, 0x000B00FF, 0x8760000C, 0x8EFF0B63, 0x11BDE86B,
+0x3252000B, 0xCCC0E4FA, 0x33C8009F, 0x0001DD01, 0x00000708, 0x00C80214, 0x0F001301, 0xFFFF0005,
+0x480033FF, 0x00040018, 0x00034B00, 0x6400503C, 0xFBF62004, 0x5C000474, 0x0FA00004, 0x65FFEED2,
+0x82FF284E, 0x85FF2463, 0x09FC1862, 0xE40F5A22, 0x125C2169, 0xA8006EDC, 0x46C00028, 0x04000409,
+0x080704FC, 0x05040100, 0x082DC800, 0x62100004, 0x11114BFC, 0xF8015B14, 0x1F63A123, 0x1B4E6BFF,
+0xB7D2DDFF, 0xEC0222F4, 0x05000404, 0x00614A00, 0xF4031D04, 0x05B50004, 0x00042001, 0x110004D0,
+0x041C022C, 0x00050009, 0x10010024, 0x1E3A027D, 0x0204F600, 0x4400051C, 0xFFEED100, 0xFF3E6D8B,
+0xFF17577B, 0xB81A5E83, 0x658A3165, 0x006A9015, 0x8A1004AC, 0x621046E0, 0x105213B4, 0x12618AFF,
+0x10010004, 0x3CF80200, 0x300A0401, 0xE0FF0E62, 0x04FC0004, 0x00000400, 0x040014D8, 0x0A300100,
+0x4014F400, 0x88FF1064, 0x63210004, 0x002EB811, 0xDC000EE8, 0x00040451, 0x000B2000, 0x87800F24,
+0x88FF0563, 0x74FF0664, 0x74912000, 0xEE1018F8, 0x970010C9, 0x00040301, 0x00019000, 0x0C020504,
+0x00150301, 0xFF00070F, 0x0033FFFF, 0xE800043C, 0x041A020E, 0x00000600, 0x3C010004, 0xF7FF2186,
+0x65201A60, 0x1191C849, 0x007DC426, 0xD4008CEC, 0x6EC4005F, 0x0069EC00, 0x040032A8, 0x5AE00000,
+0x00000404, 0x0C0582E8, 0x05000705, 0x0C09EC00, 0xEC000004, 0x0F440046, 0x658B00F2, 0x6187FF17,
+0x5F7FFF19, 0x586FFF1E, 0x0155E028, 0xE30212F6, 0x04D40003, 0x000A9800, 0xA4000E00, 0x04C40605,
+0x0004C800, 0xE80609E8, 0x00C0008F, 0x02003602, 0x2D000434, 0x0014001E, 0x00003800, 0xE90254E8,
+0xFFF68032, 0xFFD4EEFF, 0x92A04968, 0x86FF1F51, 0x97C01C62, 0x001E8000, 0xB80004D0, 0x92AC0009,
+0x0032E400, 0x00048DB4, 0x23A00005, 0x0004DC02, 0x0D160ED0, 0x612619D4, 0x000FD80F, 0x04030FDC,
+0x04F00000, 0xE4638522, 0x47DC0165, 0x0360DC00, 0x24020600, 0xFF0EA010, 0xFF075F85, 0xFF056690,
+0xD0002E0C, 0xD0E323B1, 0xE80086D4, 0x05C00027, 0x0000CD01, 0xF80600CC, 0x0013010B, 0x02001C05,
+0x060F000E, 0xFFFFFF00, 0x03540022, 0x00044000, 0x0C00041A, 0x3A580200, 0x025A4000, 0x02F10978,
+0x718BFFEE, 0x5F81FF4C, 0x5C81FF2A, 0x587FFF20, 0x0009F014, 0xF0002CFC, 0x418800A0, 0x0055D800,
+0x04040500, 0x05040400, 0x000A1400, 0xF00C0004, 0x00100804, 0x028D2800, 0x12120500, 0x62A10F5C,
+0x5672FF1C, 0xACBEFF1A, 0x0118F883, 0x9F0063B5, 0x112C0105, 0x002CFE00, 0xBC02A98C, 0x03EC02E0,
+0x0000BC00, 0x18030004, 0x002C0309, 0x08001C02, 0x2000042C, 0x0E3C0200, 0x01602301, 0xF19100EB,
+0x7295A9FF, 0x225978FF, 0xB0002EC0, 0x2E600097, 0x10049400, 0x3209B887, 0xD0FF0F63, 0x83A80209,
+0x40050000, 0xFF13628B, 0xB0000004, 0x0EF0000E, 0x00000400, 0x08000A28, 0x14E40000, 0x0409D400,
+0xD8000FC8, 0x0AF0000E, 0x04012C00, 0x2C0004F8, 0x0010001F, 0x01000400, 0x07F300FC, 0x89FF0F5F,
+0x82FF1066, 0x8AFF035D, 0x7EFF025F, 0x72FF0959, 0x56D82F5E, 0x041FE000, 0xD2050B88, 0x05F70200,
+0x0000C001, 0x09050014, 0x000D0000, 0xFF00040F, 0x0023FFFF, 0x52040431, 0x0E58001C, 0x01043403,
+0x05F0034A, 0xF7FFFFF8, 0x4D6BFFDD, 0x5D83FF1E, 0x5D86FF23, 0x567EFF1F, 0x12114B88, 0x78509704,
+0x7EFF0E59, 0xC00078B0, 0x78EC0341, 0x0405040C, 0x0800050C, 0x03F40000, 0x08000400, 0x0C000500,
+0x0A2C0100, 0xFF166030, 0x81B2137C, 0x63FF1F61, 0xFFFF1D4D, 0x0EFCDFFC, 0x0003DF00, 0x000100A3,
+0x04C00005, 0x00050006, 0x0D0809D0, 0x00100004, 0x01000400, 0x38030913, 0x00C70100, 0x0137F900,
+0x400028F0, 0xFFFF3005, 0x0105EBF9, 0xEB920014, 0x1F4D65FF, 0x245F81FF, 0x60109CA8, 0xA40233AC,
+0x0EB0000E, 0x4004FC00, 0xFF12668B, 0x040013B0, 0x04D80200, 0x0079A802, 0x040009D4, 0x04F80000,
+0x00000400, 0x00040A10, 0x04F40005, 0x00151400, 0xDC000004, 0x00040000, 0x102E2C01, 0x005BE061,
+0xF003981C, 0x9828006A, 0x0D6006F0, 0x0A6385FF, 0x045E81FF, 0x075C85FF, 0x0D4E6EFF, 0xACCAD6FF,
+0x107800FA, 0x0B019800, 0xD8000500, 0x00E50000, 0x00000400, 0xE101000C, 0x00050F00, 0x2CFFFFFF,
+0x00034500, 0x2C000940, 0x2D40006D, 0x045E0802, 0x05F009FC, 0xFF7499AC, 0xFF1F5474, 0xFF1F5F85,
+0xFF195883, 0xFF175882, 0x79932C9C, 0x7DFF0D59, 0x7BFF135E, 0xF80478EC, 0x00080F04, 0x05000005,
+0x000EE400, 0xF4000004, 0x00040404, 0x00041C00, 0xD40041E4, 0x678AA037, 0x5672FF1E, 0x7F91FF19,
+0xF1121CF8, 0xE700FB58, 0x41D0031E, 0x0103F300, 0x10000004, 0x00040005, 0x06051401, 0x200003FC,
+0x0004000F, 0x00001201, 0x040000D7, 0x000D0000, 0x1004EC00, 0x0404FCFD, 0x15008844, 0xFA06F100,
+0xA4C4D9FF, 0x1A4F6EFF, 0x216184FF, 0x1A6386FF, 0x166085FF, 0x88206590, 0x116A9863, 0x000ED80C,
+0xEC010F04, 0x1EB40009, 0x000EB403, 0x040623D8, 0x0EF40200, 0x0032E800, 0xD80113C8, 0xB45E1300,
+0x155F2142, 0xE4008DF0, 0x28D40000, 0x020AE802, 0x0C0004FC, 0x62864000, 0x0F18FF14, 0x045D7D31,
+0x757137EC, 0x7BFF0D53, 0x78D43361, 0x0083EC00, 0x900032EC, 0x00D40091, 0x0500F800, 0x0D0005D8,
+0x00040000, 0x0000E004, 0x040F00CF, 0xFFFFFF00, 0x81EC002D, 0x08305400, 0x7C003650, 0xE407F008,
+0x1B4D66FF, 0x245F7DFF, 0x216386FF, 0x13547EFF, 0x165983FF, 0x013200FF, 0x5F40AB08, 0x0479FF14,
+0xAB08000A, 0x10000407, 0x0FA0F480, 0x00000A14, 0x0802051C, 0x19340205, 0x00000C04, 0x0C0155CC,
+0x1A61A33D, 0x1A526BFF, 0xBFD9E6FF, 0xE50209FC, 0x04BF0004, 0x0023E400, 0x04010008, 0x03EC0304,
+0x00040300, 0x0F030004, 0x0AB90300, 0x03041503, 0x1C010007, 0x000C0000, 0x13190000, 0x000AE0FE,
+0x00F00015, 0x82FFF0FE, 0x7AFF3F69, 0x87FF1C58, 0x84FF1E62, 0x00A00005, 0x10049801, 0x115B8861,
+0x0219040E, 0x0F111408, 0xDC011D90, 0x14CC0304, 0x000EC801, 0x6031A1EC, 0x04FCFF0E, 0x00000800,
+0x2000479C, 0x65CC0000, 0xFF155D52, 0x05005D83, 0x00150804, 0x10000EF0, 0x0F60018E, 0xF0126221,
+0x79EC006F, 0x00567471, 0x0A5773FF, 0xFF318518, 0xAFC0D6F0, 0x002CEC00, 0xEC000ADC, 0x14F4001E,
+0x010AB300, 0xCC0000FC, 0x00C00000, 0x00000400, 0x0400000C, 0x000C0000, 0xFF00040F, 0x002BFFFF,
+0x04000444, 0x18180000, 0x00046401, 0xFF616D58, 0x97AEFFF0, 0x3127F46A, 0x1C236482, 0x5B8253A1,
+0xE07EFF17, 0x7DF8005F, 0x0096FC00, 0x040055D0, 0x6EE80000, 0x00000404, 0x04000500, 0x64E80100,
+0x000F180B, 0xF8040464, 0x00080104, 0x2C135D21, 0xBA4000AB, 0x1F608072, 0x2C5C73FF, 0xE0003FEC,
+0x03F10026, 0x02050300, 0x0F002DE7, 0x00040204, 0x021DF001, 0xB80004CC, 0x03FB0600, 0x00040D00,
+0x0B030004, 0x00190105, 0x00004100, 0x00000AE0, 0xFFFF2214, 0xF85122FC, 0xD1E8F6FF, 0x8620A258,
+0x110ADC60, 0x00B0BC17, 0xD8000990, 0x04A00019, 0x200A0400, 0x22885D82, 0x00ABB000, 0xD8020510,
+0x0EDC00A6, 0x00052400, 0xCC000004, 0x0508000F, 0x017D2000, 0x60100A10, 0x141104D4, 0x0C00A210,
+0x0004009D, 0x008DF400, 0x38000500, 0x00580000, 0x002E1C04, 0x04F1003C, 0xFF0C5A7E, 0xFF075373,
+0xFF004D68, 0xFF05435A, 0xFC7A97A7, 0x19AC0009, 0x0300BB01, 0xFC000AE0, 0x00040004, 0x01010F00,
+0x05010004, 0x19F00200, 0x04000B04, 0x080F0030, 0xFFFFFF00, 0x04400020, 0x002D3C00, 0xF6202E88,
+0x000420F8, 0xF7600342, 0xD2F2FFFF, 0xC06554FF, 0xFF1D6283, 0xFF1D607D, 0xFF175A77, 0x7CC06EEC,
+0x80FF1357, 0x80FF1758, 0xF8FF1559, 0x6EDC007D, 0x0C5AD800, 0xE0000004, 0x0004045A, 0x00192000,
+0x30000004, 0x5D80311E, 0x0055CC13, 0x1C00051C, 0x60100004, 0xB209FC00, 0xFF206284, 0xFF1B5471,
+0xF489AFC4, 0x04C70126, 0x1103E400, 0x011903FD, 0xAD0045E8, 0x00180100, 0x02131400, 0x130041EC,
+0x00B20000, 0x00000408, 0x04000014, 0x00140200, 0x02003100, 0xDC009C34, 0x1ED40205, 0xFFF002F1,
+0xFF6B90A2, 0xFF21597A, 0xFF1D6188, 0x70155F86, 0x04A40088, 0x21000401, 0x28041161, 0x0504B000,
+0xE8000004, 0xC05F10B0, 0x00040613, 0x0028FC00, 0xC4000508, 0x05080009, 0x10000C01, 0x1105D05F,
+0x048DE013, 0x14000A54, 0x0F1C00A7, 0x04000400, 0x00000A00, 0x5174E005, 0x4765FF07, 0x4861FF00,
+0x4C5CFF08, 0xF51182D0, 0xE50236E8, 0x00FC0005, 0x050BFF11, 0x0A00CC00, 0xFC000004, 0x00200205,
+0xFF05000F, 0x0034FFFF, 0x04000E5C, 0x2D040005, 0xF2915C01, 0xFFE9FF0A, 0xFF447186, 0xFF1B5C7A,
+0xFF1E6788, 0xFF155A77, 0xFF145772, 0x78F45675, 0x16577F71, 0x165781FF, 0xFC0082F4, 0x04FC0C87,
+0x2C00100A, 0x0508FF10, 0x000A1C04, 0x40000420, 0x6284B305, 0x607FFF1C, 0x4963FF23, 0x2130F01A,
+0x3954FFF6, 0x0003DD04, 0x010409C3, 0x00140104, 0x0005000A, 0xEC02001B, 0x00060204, 0x00001000,
+0x48050004, 0x0A300104, 0xC96BFE10, 0x017AA600, 0x6220AE2C, 0x5122EC4C, 0x6089FF21, 0x042DCC1B,
+0x000409A4, 0x09D00105, 0x00050804, 0x000F0ED4, 0xDC000405, 0x518C00B0, 0x00050000, 0x8020000C,
+0x02B5FC5E, 0xE0000504, 0x0A50000A, 0x31193800, 0xD00A5980, 0x050C0083, 0x718E3000, 0xFF0C5576,
+0x50004465, 0x33477165, 0xFFFFFF04, 0x00F228E3, 0xB80105A4, 0x29910000, 0x0000C500, 0xD70105BF,
+0x0AC00300, 0x002DC801, 0xD4000500, 0x0AE8080A, 0x0F002501, 0xFFFF0005, 0x670025FF, 0x40FA1003,
+0x0D65017D, 0xCAFFF8A0, 0x68FF94B7, 0xFCFF174F, 0x50A80009, 0x577500F1, 0x5673FF10, 0x5671FF11,
+0x5777FF13, 0x711E0415, 0xFF145480, 0x0412557F, 0x0F0C0005, 0x0455E400, 0x10000004, 0x00040500,
+0x7E045A10, 0x0000040A, 0x040504F4, 0x165CE300, 0x1E6384FF, 0x1E5573FF, 0x62859BFF, 0x890127F4,
+0xFDFF2100, 0xE8039A90, 0x00A50008, 0x0003DE01, 0x200003F8, 0x00040000, 0x05041402, 0x2C00001B,
+0x0F2C0004, 0x0104E603, 0xFC030448, 0x04FD0104, 0xF1002901, 0xCDFFF702, 0x6DFF92BB, 0x84FF1753,
+0x89FF1F61, 0x5B5C1961, 0x04139C00, 0x9C0013E0, 0x00040809, 0x0804C800, 0xC4000004, 0x0004040A,
+0x000A0400, 0x80226594, 0x01BB145F, 0x200383F0, 0x0FEC00C0, 0x40050000, 0xFF09587F, 0x5C0031E8,
+0x7D500005, 0x71C51C00, 0xFF0C4D6B, 0x500C4562, 0xDAE6325B, 0x000EF8BE, 0x010004DC, 0x00C80305,
+0x0100EF01, 0x11020005, 0x14080000, 0x02DBBC02, 0xE0021F08, 0x00210100, 0xFF00050F, 0x002FFFFF,
+0x58000360, 0xF905F204, 0xDBEEFCFF, 0x1B4961FF, 0x226180FF, 0x226788FF, 0xF45678FF, 0x8808008C,
+0x15587350, 0xD81876FF, 0x0C155621, 0xF07D1319, 0x64E4006E, 0x0004FC04, 0xFC050008, 0x79000404,
+0x00125821, 0x14300279, 0x110A1000, 0x00AB3812, 0x24000A28, 0x50D400C9, 0x194B6493, 0xC4DEEFFF,
+0x77D8FFFF, 0xE0FDFC22, 0x43500104, 0x00009F00, 0xFC010004, 0x00A80009, 0x0F000404, 0x00030500,
+0x340004E7, 0x0420021D, 0x002DD804, 0x45000548, 0xF102F200, 0x33657CFF, 0x1C5F7CFF, 0x1F6589FF,
+0x125A82FF, 0xC000ABB0, 0x000403C4, 0x021EA400, 0xA8020004, 0x04C80219, 0x007EAC02, 0xCC00000C,
+0x0004040F, 0x0009F000, 0x040065B4, 0x04FC0000, 0x04000400, 0x2C00001C, 0x65D40000, 0x0013F400,
+0x20000560, 0x597A3115, 0xB284FC14, 0xFF124862, 0xFF0C3A51, 0xE896B7C8, 0xFAA40128, 0x0100D002,
+0x080004CD, 0x00090005, 0x00747C00, 0x1C0000B7, 0xFEFF2305, 0x2800B99C, 0x00150000, 0x00000404,
+0x040F0029, 0xFFFFFF00, 0x044C0028, 0x00266C00, 0xEDD14654, 0x33576DFF, 0x265D7BFF, 0x266689FF,
+0x7522AAFC, 0x000EF453, 0x741087E4, 0x57220F04, 0x07D32C16, 0xE8007900, 0x00040469, 0x00050C01,
+0x04038300, 0x64D80000, 0x008D2000, 0x18000008, 0xBA480005, 0x00000804, 0x85B7B534, 0x7CFF2163,
+0x78FF2460, 0x09FC3A65, 0x001E9002, 0xD60103E6, 0x03E70003, 0x00000905, 0x0D0104C8, 0x0DFD0100,
+0x0104EC00, 0x2400000E, 0x1830030F, 0x00001402, 0x04020035, 0x00100000, 0x6013F802, 0xDFF3FFF8,
+0x7F14FFC6, 0x210F7401, 0x1DF8135C, 0x0809DC08, 0xA400000C, 0x00040014, 0x0004D004, 0x04016094,
+0x09E00300, 0x00001804, 0xEC000034, 0x001C0004, 0x000A1804, 0xF400001C, 0x000400C9, 0x00141800,
+0x14000018, 0x2DDC0061, 0x1B4B62A4, 0x13394EFF, 0xC8B6C8FF, 0xB0FA1182, 0x0ED60247, 0x02A59100,
+0xD80413F8, 0x05F70100, 0x000AD403, 0xD00032FC, 0x001C0100, 0x00001901, 0x0E0200E4, 0x00060F00,
+0x26FFFFFF, 0x00096800, 0x0AF14B58, 0x7F95FFE9, 0x5874FF56, 0x5B7DFF22, 0x5D81FF1F, 0x5578FF1D,
+0x5477FF16, 0x007DE815, 0xE40C7DDC, 0xAB180064, 0x0196F401, 0x2C02D338, 0x05080FC9, 0x0A080002,
+0x3C155B21, 0x04FC04BA, 0x00000800, 0x84A06020, 0x6BFF2364, 0xC2FF1B51, 0x2069C0B0, 0x0EA8FFF5,
+0x00E21800, 0xE80003CC, 0x4FE00203, 0x0003E400, 0x16000004, 0x04F70100, 0x0309DB02, 0x0704000F,
+0x00CA0004, 0x04000400, 0x25020017, 0x14FE1100, 0x000C026F, 0x9FFFF451, 0xE7E86686, 0x1D668931,
+0xC00018A4, 0x04C00009, 0x25000409, 0x3CDC135D, 0x00050000, 0xD00004BC, 0x04E00004, 0x0B000401,
+0xFC000500, 0x00040004, 0x10002401, 0x00C0285C, 0x10110FF0, 0x100019E8, 0x577A310A, 0xE08E200D,
+0xFF1C5C78, 0xFF1F536B, 0xFF173D50, 0x6ECCB8C6, 0x00CEF400, 0xB802017C, 0x0EE0009B, 0x03000402,
+0xF3003BE0, 0x15950100, 0x00001002, 0x140000DC, 0x00E00201, 0x04001D00, 0x12020004, 0x00060F00,
+0x26FFFFFF, 0x8027E800, 0x8DA0FFF0, 0x516EFF68, 0x1C7064B0, 0x226085FF, 0x830876FF, 0x175106F0,
+0x175377FF, 0x14547AFF, 0x12537BFF, 0x10547BFF, 0x0C5479FF, 0xFF134214, 0xE7445674, 0x0278FC0C,
+0x140473F8, 0x05140288, 0x000A1404, 0x0C006EE8, 0x05240000, 0x165A7D31, 0x7E60DD38, 0x67FF205F,
+0x0054E44D, 0xE000D1BC, 0x04E00659, 0x027BDC00, 0x060003F4, 0x28A00B00, 0x0109F003, 0x070303F4,
+0x00CA0004, 0x05132000, 0xF4010014, 0x40F40231, 0xD12DD002, 0x455FFFED, 0x5F83FF1D, 0x6389FF23,
+0x0032C41B, 0xBC000500, 0x00040104, 0x0028B400, 0x5B610004, 0x5B81FF13, 0x00C9F413, 0xD804C9F8,
+0x04FC0004, 0x0404D000, 0x080419D0, 0x19D00000, 0x001EC800, 0x04000FD0, 0x0FE80200, 0x11C01800,
+0xF0056411, 0x1A638405, 0x1D5F7FFF, 0x19526DFF, 0x164559FF, 0xBBD8E8FF, 0x02C460FF, 0xAE01A65C,
+0x00050100, 0x3154DC00, 0xF2F8F9F1, 0x2D00003C, 0x1205B401, 0x0032F0FD, 0x1301BF94, 0x00EC000F,
+0x0305F104, 0x3D0100E0, 0x00050F00, 0x00EAFFFF, 0x04000814, 0x03030600, 0x08032500, 0x1A060004,
+0x000A0200, 0x00001C00, 0x32000454, 0xFFF1E004, 0xFF7B9CAB, 0xFF1C4C63, 0xFF206282, 0x77103184,
+0x5261DD20, 0x5277FF16, 0xF2881018, 0x14527708, 0x13547AFF, 0x11557CFF, 0x11557AFF, 0x135673FF,
+0x145571FF, 0x1003EC28, 0x04F80088, 0x0300040F, 0x00A12C02, 0xFC00233C, 0x00040004, 0x00000C00,
+0xFC00E758, 0x5B797313, 0x899FFF20, 0x000EFC65, 0xE00353E4, 0x50C8000E, 0x0018CC03, 0xD600C2CA,
+0x00E40045, 0x00230801, 0x000F00BF, 0x1C000005, 0x4BBC000E, 0x0200E402, 0x34010006, 0x000B0100,
+0xC8FFF780, 0x71FF95B4, 0x20667853, 0x04B4FF21, 0x00796400, 0x9800ABB0, 0x00040013, 0x00001400,
+0x04041ED0, 0x19A40200, 0x1EC01115, 0x011DB800, 0x5A100004, 0x04088DD0, 0x09F00000, 0x0000040A,
+0x8031003C, 0x1A44165F, 0xA014E000, 0xFF1B546F, 0xFF2F5C71, 0xD8ECF7FF, 0x2DE0EF11, 0x00476C00,
+0x690200A0, 0x00E200AB, 0x02648600, 0x180105B0, 0x1E040000, 0x00B98700, 0xF000002E, 0x00F80300,
+0x01051801, 0x18020504, 0x00DF010A, 0xFF00050F, 0x2800E6FF, 0xA6600003, 0x0103FC00, 0x34010303,
+0x13D40003, 0x0004E000, 0x38000016, 0x56880209, 0x02095000, 0xF0000024, 0x5A480013, 0x9FFFED51,
+0x31E4698C, 0x225F7C31, 0xE8010500, 0x11512213, 0x0003B014, 0x7DE40092, 0x12000401, 0x00E23855,
+0xB4007404, 0x78F400E2, 0x000F1400, 0x200004F8, 0x0008000F, 0x00000400, 0x14007E0C, 0x0004017E,
+0x210F1C00, 0xC4541658, 0x0004FC00, 0x785009FC, 0x84FF1155, 0x63302778, 0x92C0FF1F, 0xCFE7F360,
+0xE0FDFFFF, 0xC8FE115A, 0x00A401AE, 0x000A0700, 0x0D0172E0, 0x03F90500, 0x0103FB08, 0x0501001A,
+0x001F0000, 0x02000905, 0x18001436, 0x01020001, 0x11314000, 0x515436FF, 0x6178FFEA, 0xF1555833,
+0x1C658600, 0x0D597BFF, 0x0F5C7AFF, 0x0F5A77FF, 0xB8057990, 0x1EB00519, 0x000EC002, 0x0400A0F4,
+0x13C80000, 0x0009FC00, 0x7A40D3FC, 0x04FF0F5A, 0x42000000, 0x007ED000, 0xE40014E0, 0x00040083,
+0x2C577D20, 0xFF16202D, 0x00F20F60, 0xFF1B607F, 0xFF215E7A, 0xFF174960, 0xD46B91A4, 0xACFE1040,
+0x28BC0092, 0x06FFFC20, 0x01A20000, 0x0000AC00, 0x080000BF, 0x00040400, 0x04001000, 0x14050004,
+0x00E80500, 0x0F001A04, 0xFFFF0008, 0x031C00F1, 0x00034400, 0x0E020504, 0x03250003, 0x00050000,
+0x02000016, 0x4F300004, 0x02213000, 0xFF11001E, 0x7400B230, 0xFFE9D112, 0xFF597F96, 0xFF20526D,
+0x48266382, 0x749C0082, 0x11537331, 0xEC02CE14, 0x22F00078, 0xA1081611, 0x027DF004, 0x20020008,
+0x050006B0, 0x00FF1224, 0x79000105, 0x40F64C00, 0x77FF1657, 0x5721192C, 0x00323C15, 0xFC000EF0,
+0x9C240004, 0x00002400, 0x7DA03B74, 0x80FF1D5C, 0xFFFF3A68, 0x020910FD, 0x780200A0, 0x000C0E46,
+0x0F001202, 0x00040006, 0x1B0100F3, 0x00090000, 0x00050002, 0x020000FA, 0x0EF80201, 0xF0FFF251,
+0xDE4CC0E1, 0x1D5D8040, 0x72884CFF, 0xFF0C587C, 0xD0156080, 0x115721AB, 0xC8002DDC, 0x00040004,
+0x400EC004, 0xFF0E587D, 0x18000004, 0x32E4000A, 0x0022BC00, 0x7D1004F4, 0x5C1279A8, 0x3801DE14,
+0x165A3005, 0x8005D4FF, 0xFF1A5E81, 0xFF1C6083, 0x01F041C4, 0xFF1D5D79, 0xFF1A506A, 0xFF305D72,
+0xFFC2E1F3, 0xFF11C94C, 0x9A00620C, 0x00A40400, 0x03019C00, 0xC00181C4, 0x00050F00, 0x22FFFFFF,
+0x04050000, 0x3E0C0004, 0x00180003, 0x0036D400, 0x18008210, 0x6D440087, 0xE1127801, 0x78FFDEF9,
+0x72FF365E, 0x84FF1B50, 0x40002460, 0x00BEE000, 0x7431B594, 0x7DD81151, 0xE0527520, 0xF014117D,
+0x9204026D, 0x02000C00, 0x08009208, 0x0A10048D, 0x400A0000, 0xFF105477, 0x24000004, 0x0A1C00A1,
+0x04052400, 0x20008318, 0xD3380000, 0x31052000, 0xF80F5378, 0x5678E079, 0x5E7CFF1A, 0x5875FF25,
+0xBBCEFF25, 0xFC002200, 0xFFFF2809, 0xCC0004FC, 0x0E200000, 0x0F000800, 0x000D0004, 0x0F0300E8,
+0x0A36000E, 0x00002F01, 0x04000014, 0x05000400, 0x7E9204F1, 0x5575FF5F, 0x638AFF24, 0x5882FF25,
+0x5882FF13, 0x0037CC11, 0x9800009C, 0x1EA00014, 0x00000404, 0xC00009C8, 0x0004040E, 0x00051000,
+0xB000000C, 0x0024001E, 0x000FC000, 0x7A3105C4, 0xECE81658, 0xF07A0400, 0x25698C07, 0x1C5E7EFF,
+0x225F7BFF, 0x1F5369FF, 0x30596BFF, 0xB4B3C4FF, 0x1F580081, 0x03C2A000, 0xA3007D69, 0x00A20005,
+0x0037E000, 0xE000000C, 0x00100022, 0xFF00040F, 0x012CFFFF, 0xFF130348, 0x3C02C704, 0x172C0021,
+0x00000400, 0x5B021C3F, 0x13EC0203, 0x9DBDCC31, 0x11F17490, 0xFF215876, 0xFF215F84, 0xFF206189,
+0xFF0F5174, 0xFF0B4D6F, 0xFF0E4E72, 0xFF105073, 0xFF0F4F73, 0x03F10508, 0x71FF1351, 0x75FF0F4E,
+0x74FF1250, 0x75FF1251, 0x00201151, 0x00247410, 0x38105021, 0x003C0000, 0x0F557971, 0x0F5577FF,
+0x0008FB28, 0x04FC0005, 0x40091800, 0xFF0E537A, 0x3C000004, 0x7D00F350, 0x82FF1A58, 0x7DFF2961,
+0x5BFF3062, 0x96B81943, 0x02C7C004, 0x060800AA, 0x5F900000, 0x0F001008, 0x0101000C, 0x040004E8,
+0x05050101, 0x00000900, 0x2A000004, 0x00080000, 0xD1322C00, 0x465BFFEE, 0x5E7FFF26, 0x5D84FF2D,
+0x3105001F, 0x880D547E, 0x0A9000BF, 0x000F9800, 0x040409C8, 0x1E9C0000, 0x04000405, 0x5A70CEE8,
+0x5B7EFF16, 0x7F0CFF19, 0x1F5E8140, 0x3179E8FF, 0x38246384, 0x6082A27A, 0x5674FF24, 0x4E69FF1D,
+0xBC0213E4, 0x8BAC00D3, 0x001ED002, 0xF910556C, 0xD000D355, 0x507D000F, 0x00009700, 0xB9000004,
+0x00080000, 0x0F00AB00, 0xFFFF0004, 0x44002CFF, 0x04ED0003, 0x036A5900, 0xF0022704, 0x03550009,
+0xF10D7000, 0xFBFFF106, 0x7FFFD0ED, 0x68FF3F6C, 0x77FF1951, 0x84FF1A5B, 0x31782065, 0x000DB000,
+0x90007D70, 0x648A717E, 0x6387FF24, 0x004AEC23, 0x8B310010, 0x7EA82565, 0x23638931, 0x8C010018,
+0x7D94047D, 0x31000803, 0x38216288, 0x27500059, 0x61323001, 0x81FF1F61, 0x7DB02061, 0x71005800,
+0xFF1E6289, 0x041B628C, 0x638D2000, 0x1FC07340, 0x2A5F7FFF, 0x19455EFF, 0xE4B8CCFF, 0x131002D7,
+0x0400AA00, 0x080C0004, 0x0018040A, 0x0500080F, 0x02044700, 0xF800001C, 0x00F0000F, 0x00000404,
+0x0FF004FC, 0xC3CDFFF5, 0x485BFFAB, 0x5F7AFF22, 0x5F81FF27, 0x6588FF1D, 0x6588FF1C, 0x6383FF1B,
+0x9898FF1C, 0x00148C01, 0x040F1490, 0x20000100, 0x2161A141, 0x206084FF, 0x205E83FF, 0x0CF20B30,
+0xFF245E83, 0xFF21597C, 0xFF1A5275, 0xFF1A4C6D, 0xFF24506B, 0xFF5E829A, 0xBCBDD8EB, 0xF4FF1041,
+0x15640009, 0x0027D200, 0xEA00B718, 0x06980213, 0x03B0A506, 0xB30018D9, 0x01C00000, 0x0F00C102,
+0xFFFF0006, 0xFC0026FF, 0x03440004, 0x1258FE14, 0xF51C1803, 0xFFFDFE1F, 0xFFE2EBF2, 0xFF5C6F7E,
+0xFF1D3E51, 0xFF215168, 0xFF1F5971, 0xFF1D5B74, 0xFF1B5972, 0xFF1B556D, 0xFF205670, 0xFF215675,
+0x041F5473, 0x52717500, 0x5372FF1D, 0x0000101E, 0x040F000C, 0x34010100, 0x1E556100, 0x1D5673FF,
+0x1FF00004, 0xFF1E5671, 0xFF1F556F, 0xFF21546F, 0xFF1F5571, 0xFF1E5574, 0xFF1D5576, 0xFF1B5779,
+0xFF175274, 0xFF1D5375, 0xFF20516F, 0xFF1D455E, 0x76D8ACBE, 0x0004FC00, 0x05001988, 0x03FB0F04,
+0x05000627, 0x00010500, 0x0400004C, 0x05040400, 0xFFF713F0, 0xFFDEF2FB, 0xFF204150, 0xFF28566D,
+0xFF215974, 0xFF195472, 0xFF185571, 0xFF215B73, 0xFF1A5269, 0x700000B8, 0x56744969, 0x0004FF1F,
+0x04205521, 0x52712301, 0x58007ED4, 0x214E217F, 0x85A004F0, 0xBBFF4069, 0xECFF78A2, 0x12FA74D4,
+0x101EC0EA, 0x0004F8FC, 0xEC027350, 0x00820004, 0x00B44C00, 0x8802328C, 0x00A00019, 0x0006A103,
+0xA7003297, 0x00130000, 0x0F000400, 0x0F2700FF, 0xFFFF003A, 0x222F00ED, 0x000D5800, 0xFD22125F,
+0x04A500FF, 0x2BF10350, 0xECFFFAFD, 0x9AFFDBE2, 0xB4FF7D8A, 0xACFF8CA1, 0xB6FF7B97, 0xB1FF81A1,
+0xB0FF7D9E, 0xAEFF7F9E, 0xADFF859F, 0xADFF869D, 0xAFFF839F, 0xAEFF829F, 0xB0FF819E, 0xB1FF83A0,
+0x000884A1, 0x00001000, 0x040F0018, 0x28000100, 0x00040100, 0x81A103F1, 0x7FA0AFFF, 0x7FA1ADFF,
+0x80A0ADFF, 0x82A0ABFF, 0x0C000004, 0xA0B1B100, 0xA0B3FF7F, 0xA0B4FF7D, 0xA000087D, 0xFF81A0B2,
+0xFF97B1BE, 0xA8C4F7FF, 0xE4FFF820, 0x04240036, 0x0004C000, 0x040013EC, 0x03CD0800, 0x000EFC00,
+0x14080004, 0x000C0F00, 0x00F00002, 0x00000400, 0x0808001D, 0x000C0100, 0xF1000500, 0xEAFFF80E,
+0xA3FFCDDD, 0xB3FF7892, 0xB8FF7F9E, 0xB1FF83A3, 0xACFF7E9D, 0xB1FF809B, 0x00B887A3, 0x4900C400,
+0xFF80A0AF, 0x9F210004, 0xE0011C82, 0xFF92AEBC, 0xFF9EB8C5, 0xFFBAD2DE, 0x9088F2FF, 0x005E9800,
+0x08006E98, 0x1A4C0000, 0x0014C000, 0xD1001060, 0x51440204, 0x00914F00, 0x93010004, 0xFEFF500F,
+0xE8F9F9FF, 0x0A900005, 0x00002802, 0x780400F4, 0x000C0042, 0x0F00BB00, 0xFFFF0004, 0x3C0024FF,
+0x04440003, 0x224AC000, 0x272AFCF8, 0x11001400, 0x006DC0FA, 0x88000865, 0xFFF8440D, 0x03ACFCFF,
+0x0003B800, 0x180303B4, 0xC6E80100, 0x0003C000, 0x04000014, 0x08C40000, 0x00000800, 0xB4000004,
+0x00080003, 0x0000040C, 0x04080018, 0x00200C00, 0x00001004, 0x7000004C, 0x007C0000, 0x11000800,
+0x0096A4F5, 0xB0011894, 0xFFFE4000, 0x59E0F6FF, 0x0003F907, 0xF4000504, 0x00040004, 0x0F001707,
+0x000B000B, 0x040004E3, 0x00260400, 0x09000C00, 0x54000004, 0x1E0E0036, 0x1000E803, 0x000090FE,
+0x8C00000C, 0x01080004, 0x04000C00, 0x080400B4, 0x00140000, 0x00000404, 0x04040024, 0x00340000,
+0x00017200, 0x040204EC, 0x09DC0000, 0x00A49200, 0x78000016, 0x1A740010, 0x0328A800, 0xD4013CC3,
+0x27DE0432, 0x64FFFD20, 0xFFFB20EC, 0x2C007DCC, 0x05040000, 0x0401B000, 0x080F00BB, 0xFFFFFF00,
+0x0EF40022, 0x0027E400, 0x70001264, 0x00040612, 0x02046800, 0x9A000004, 0x00040003, 0x0A03B002,
+0x29002745, 0x00180004, 0x0F002000, 0x00250004, 0x04040040, 0x00440000, 0x0C08E800, 0x18000004,
+0x00240000, 0x0200B000, 0x9200040E, 0x04000F04, 0x00C40033, 0x00000400, 0x04000060, 0x00640200,
+0x00045800, 0xF0020004, 0x00180000, 0x00009408, 0x6E040010, 0x000C0004, 0x0800A000, 0x14000004,
+0x00040C00, 0x00005806, 0x5C00002A, 0x00080000, 0x04D18000, 0xEC020004, 0x1E87030E, 0x00009300,
+0xF3010004, 0x003C000E, 0x0001A800, 0xA4000004, 0x0BB90001, 0x04002807, 0x080F008B, 0xFFFFFF00,
+0x03A40021, 0x0003D800, 0x0C000898, 0x03680000, 0x00140002, 0x900203A0, 0x03850303, 0x08000700,
+0x6C010004, 0x00110003, 0x08000900, 0x0C000008, 0x00040F00, 0x00380011, 0x02006C06, 0x14000DEC,
+0x003C0C00, 0x02002406, 0x10020094, 0x002A0000, 0x02049C02, 0x060F000A, 0x700A2700, 0x00F40200,
+0x00056402, 0x58020070, 0x011C0000, 0x00000400, 0x800004B2, 0x31680204, 0x06058000, 0x2A0200B8,
+0x00060C00, 0x00004400, 0x3A000004, 0x00040400, 0x0005BC04, 0x74000008, 0x05000032, 0x02007800,
+0x900E00D0, 0x3BD80200, 0x02298800, 0x740101A0, 0x00270400, 0x0F00710C, 0xFFFF0010, 0x45001DFF,
+0x03960003, 0x030E4903, 0x5F0003E3, 0x03DC0026, 0x0203B800, 0x700C034F, 0x00380408, 0x02003C00,
+0x94010022, 0x000B0303, 0x1200070F, 0x00004300, 0x80003598, 0x00690014, 0x00001000, 0x08000039,
+0x00040700, 0x00199F00, 0x0400008C, 0x000C0000, 0x0A002300, 0x2D000A98, 0x00160200, 0x2100060F,
+0x00007B00, 0x04010058, 0x096C0100, 0x01056002, 0x51050018, 0x01190000, 0x00000400, 0x000000F0,
+0x048C0005, 0x01052402, 0x830000F8, 0x00040F00, 0x00480404, 0x00000808, 0x10000046, 0x00080000,
+0x09000404, 0x0D010048, 0x001A0200, 0x02109600, 0xB8020500, 0x0F1C0073, 0x04001F01, 0xA4050070,
+0x00090F00, 0x28FFFFFF, 0x0004DC03, 0xE3030391, 0x05000003, 0x00036800, 0x56050013, 0x03700403,
+0x01000800, 0xA0020381, 0x00200103, 0x00001400, 0x0D010004, 0x00050F00, 0x0028000C, 0x00000407,
+0x4F010478, 0x00140000, 0x00003B00, 0x04070008, 0x00200000, 0x0004FC01, 0x20000528, 0x002D0100,
+0x00007C00, 0xBC000AB4, 0x002D000A, 0x0F001901, 0x00220005, 0x640000E4, 0x00040500, 0x06050407,
+0x64000051, 0x011D0000, 0x00000400, 0x8802000C, 0x003C0009, 0x02008F01, 0xBF0F0013, 0x14010109,
+0x00280100, 0x00005803, 0x10080054, 0x01680100, 0x04001100, 0x4C000004, 0x00550100, 0x00006C00,
+0x7C00056C, 0x056C026E, 0x00010801, 0x2C000020, 0x00080000, 0x00000400, 0x040F0051, 0xFFFFFF00,
+0x03470027, 0x00044A00, 0x0C000004, 0x03770100, 0x00035407, 0x04000014, 0x00200000, 0x00037C00,
+0x28000004, 0x00280104, 0x07000501, 0x8409002D, 0x00180003, 0x0500040F, 0x01002909, 0x4B010420,
+0x00170100, 0x06003408, 0x840012E0, 0x00240100, 0x01001F00, 0x92000009, 0x04FC0000, 0x01000800,
+0x3E010015, 0x00050F00, 0x0E780021, 0x0F000402, 0x030109F8, 0x63000052, 0x00040C00, 0x00009500,
+0x18000004, 0x00270300, 0x0700070F, 0x0F002500, 0x00000004, 0x7B000B00, 0x04EB000B, 0x04001F00,
+0x0C000041, 0x00040000, 0x00006000, 0x0C000004, 0x002C0000, 0x03002001, 0x0801000D, 0x000C0001,
+0x0F001501, 0xFFFF0005, 0x5B0025FF, 0x04420003, 0x00000400, 0x8D06000C, 0x03580004, 0x0008E406,
+0xFC000020, 0x00040404, 0x00002C01, 0x760F0023, 0x19000203, 0x00040F00, 0x00350F09, 0x00300C01,
+0x08002407, 0x1701001B, 0x00110400, 0x00043500, 0x15010004, 0x00050F00, 0x004C0224, 0x021D8400,
+0xF4000504, 0x00040200, 0x03010C06, 0x2B02005B, 0x05250A00, 0x02010901, 0x26030013, 0x00070F00,
+0x00390400, 0x0100080F, 0x0105E406, 0x050104CF, 0x00280000, 0x00001803, 0x04000060, 0x00130000,
+0x01000400, 0x0900005E, 0x00F80000, 0x00000400, 0x1501000C, 0x00050F00, 0x2BFFFFFF, 0x00034400,
+0x50000004, 0x0D700003, 0x02040000, 0x7B0003D4, 0x03930103, 0x02000501, 0x18000020, 0x00180004,
+0x01050C04, 0x3F00001B, 0x03820D00, 0x08001500, 0x210B0004, 0x001B0000, 0x000E1401, 0x78040070,
+0x000C0000, 0x0E007C0C, 0x80050038, 0x001B0000, 0x00004803, 0x040F000B, 0x3D001F00, 0x00040000,
+0x07008004, 0xD905007C, 0x00200000, 0x00049003, 0x0408000B, 0x00C00100, 0x000E9C00, 0x040400B8,
+0x00440600, 0x0F00A800, 0x040B0094, 0x5C00004D, 0x00400201, 0x0013EC00, 0x04001914, 0x06780000,
+0x04004401, 0x08040027, 0x00550F00, 0x001E0F0B, 0xA0005BFF, 0x00040001, 0x0A031800, 0x87020004,
+0x001C0001, 0x02000400, 0x1C06000E, 0x00100402, 0x0D00080F, 0x04003C00, 0x2C060004, 0x02090000,
+0x0F000E06, 0x0F13000A, 0x0F210034, 0x0F13005A, 0x00AB0026, 0x80000118, 0x00040203, 0x02090802,
+0x03052B88, 0x00090104, 0x00038E00, 0x2C000004, 0x178C0204, 0x00050400, 0x1F01019C, 0x01050D00,
+0x08005800, 0x210B0004, 0x001B0000, 0x00044001, 0x540003F8, 0x18540200, 0x04005000, 0x580F0004,
+0x08000200, 0x4FDC000E, 0x00000403, 0x5A0B002C, 0x000F0F00, 0x0089001C, 0x06000400, 0x5402029C,
+0x00140000, 0x0A000404, 0x2002001C, 0x00670200, 0x00013000, 0x080004B4, 0x00040200, 0x02002C0A,
+0x060F0026, 0x60000500, 0x01780000, 0x00015804, 0xD8000104, 0x00040245, 0x01005804, 0x2B00003E,
+0x00040000, 0x00007D00, 0x15010008, 0x006C0000, 0x03014000, 0x07000011, 0x00040000, 0x00001C03,
+0x2F000007, 0x00040000, 0x0E000C00, 0x2D0B0004, 0x00210E00, 0x7E00120F, 0x0000CC00, 0x990F0004,
+0x88007100, 0x1FC40000, 0x0601BE00, 0xD0001B94, 0x00040001, 0x00015C02, 0x040001C4, 0x00B00100,
+0x00306800, 0xF8015190, 0x00120102, 0x02075902, 0x3F01002B, 0x00540005, 0x02000402, 0x5C0001D8,
+0x00640100, 0x0102F800, 0x2D000033, 0x00600600, 0x05002C00, 0x09010017, 0x00050300, 0x02003003,
+0x34070020, 0x00110000, 0x01000F00, 0x0901035D, 0x00310300, 0xE900070F, 0x04010800, 0x08030004,
+0x000F0B01, 0x07019D01, 0x47000134, 0x00040001, 0x0F002E03, 0x002C0007, 0xCC00006D, 0x00470F03,
+0x01DC0914, 0x1400340F, 0x4800270F, 0x2B01080F, 0x0400FC00, 0x04020004, 0x00500001, 0x0D000404,
+0x2B0000B7, 0x00150300, 0x00057000, 0x0400233C, 0x00130100, 0x00003500, 0x04000020, 0x00110100,
+0x03054806, 0xC702000F, 0x000D0501, 0x01034806, 0x050F0013, 0xC4006000, 0x00040200, 0x00007D03,
+0x040000BC, 0x04240300, 0x00001C02, 0x10060011, 0x04140004, 0x03028B07, 0x070F0039, 0x6F005F00,
+0x049C0101, 0x00007B01, 0x0404014C, 0x00B00000, 0x10001501, 0x00019CFF, 0x79040004, 0x1BB60001,
+0x06000400, 0x2C0000C0, 0x1C840200, 0x00005000, 0x040000DC, 0x00F80200, 0x060C5C00, 0x3401086C,
+0x00050100, 0x00006800, 0x64020110, 0x00060100, 0x01004703, 0x1101001F, 0x024C0600, 0x03007C02,
+0x65000021, 0x03400100, 0x02076C00, 0x2F030048, 0x00070F00, 0x00A0FFFF, 0x26000324, 0x036001FD,
+0x0002DF00, 0x040002DC, 0x000C0000, 0x0002CE01, 0x0A000500, 0x0011038C, 0x00000700, 0x1C010004,
+0x02FC0000, 0x05000400, 0x16010011, 0x00050F00, 0x00C4005D, 0x03000402, 0x8F00007A, 0x00040000,
+0x9005000F, 0x00045802, 0x04000CBC, 0x04700200, 0x0000C601, 0x880500C0, 0x01640001, 0x0004D200,
+0x74000024, 0x00280304, 0x00002400, 0xB1010004, 0x04CC0204, 0x00002600, 0x3B000004, 0x00170300,
+0x00006302, 0x04040028, 0x00190300, 0x00002800, 0x70040004, 0x1C980000, 0x03204C00, 0xCD02001F,
+0x1EFF10A2, 0x20400002, 0x02008400, 0x20000A6B, 0x00380000, 0xFCFFF640, 0x000004FF, 0x4401017C,
+0x00050F00, 0x00A4FFFF, 0xDC000338, 0x38AC0002, 0x02043105, 0xD0010334, 0x03700002, 0x00030000,
+0x0006033D, 0x03600103, 0x04030900, 0x2C0178E0, 0x00050F00, 0x009C0065, 0x03000400, 0x0B000080,
+0x08A00100, 0x03042803, 0xD5020017, 0x00F00000, 0x0500180C, 0x090F0021, 0xAD006000, 0x044E0000,
+0x03940000, 0x86001234, 0x00C00000, 0x01019700, 0x24040169, 0x00BC0200, 0x02001F00, 0x18000004,
+0x00040000, 0x0000D002, 0x0404002B, 0x00200200, 0x00000603, 0x04040023, 0x00130300, 0x0004B400,
+0x08000076, 0x0F780200, 0x0065E802, 0x44003A18, 0x00270200, 0x00008100, 0x04023430, 0x00180005,
+0x00000400, 0x3C0001F7, 0xFFF84000, 0x0004FFFC, 0x02004402, 0x060F0032, 0xA1FFFF00, 0x00031900,
+0x400202E8, 0x502C000D, 0x00000401, 0xCD010017, 0x03740002, 0x00000402, 0x040402F8, 0x03080100,
+0x01000D04, 0x050F0028, 0x3C007800, 0x05CB0704, 0x00009A06, 0x040000D5, 0x00120600, 0x6F000A0F,
+0x03009000, 0x07000180, 0x2AA40100, 0x01017002, 0x6902098C, 0x05BB0201, 0x03000C00, 0x11020024,
+0x04860000, 0x0204A000, 0xCC020500, 0x00500000, 0x03001802, 0xC8030EFA, 0x00180009, 0x02000400,
+0x06020026, 0x00100000, 0x00002C00, 0xF9110F4E, 0x0A006AF8, 0x00040000, 0x06001600, 0x90030024,
+0x6AF00400, 0x00008800, 0x0001003B, 0x00910002, 0x02000D01, 0x060F002F, 0xA4FFFF00, 0x0602C000,
+0x08010500, 0x0013000D, 0x0002CC0C, 0xA0010014, 0x035A0203, 0x0007F800, 0x270C0004, 0x00100F00,
+0x039F006D, 0x0D000408, 0xC8000090, 0x00040000, 0x0F00190D, 0x00610011, 0x44000089, 0x05B10204,
+0x0004F400, 0x0400108C, 0x045F0100, 0x0000C900, 0x04000023, 0x000C0000, 0x00002B00, 0x1D010008,
+0x04A60000, 0x00050003, 0xBF010020, 0x00210000, 0x04001800, 0x0C002ADC, 0x00040000, 0x00001800,
+0xE8030004, 0x00300101, 0x00000500, 0xF200001C, 0xC4D40004, 0x00399402, 0x9400000E, 0x02080014,
+0x01006701, 0x7C000005, 0x0040000F, 0x00054F03, 0x88050037, 0x00790100, 0xFF00050F, 0x0700A9FF,
+0x00040703, 0x0102F800, 0xD20802DB, 0x00200002, 0x09001500, 0x78000500, 0x00190008, 0x0F002908,
+0x0060000C, 0x04000083, 0x04430200, 0x04AFB201, 0xB300039F, 0x00920D00, 0x00002C00, 0x190D0004,
+0x00110F00, 0x09600065, 0x04014C00, 0x74020480, 0x09E40115, 0x0400A800, 0x9F010004, 0x000D0400,
+0x00003400, 0x94060004, 0x001F0110, 0x0004AC03, 0x9C000ED4, 0x1E380006, 0x00000800, 0x04020010,
+0x00340C00, 0x00001000, 0x3D030004, 0xA2EC0301, 0x00050001, 0x0400013D, 0x00540700, 0x00006401,
+0xF000001D, 0x002C00C1, 0x01003703, 0x050F0018, 0xA7FFFF00, 0x01035306, 0x3C040EFB, 0x02CF0504,
+0x00002004, 0x0003030C, 0x000B0305, 0x035CFF12, 0x0F002A05, 0x04630009, 0xF80300A0, 0x00C0000E,
+0x02000400, 0xDC02009C, 0x00B00003, 0x04009D05, 0xD0010030, 0x000D000D, 0x0F001A05, 0x00620009,
+0x0400009C, 0x04AC0000, 0x04000404, 0x910100BC, 0x00D80000, 0x01000400, 0xB000046C, 0x00D40200,
+0x0000E400, 0x24010004, 0x00050300, 0x00004800, 0x0400003C, 0x04A70000, 0x0009CC00, 0x18000024,
+0x05500100, 0x0388C800, 0xD70125F8, 0x00540104, 0x00147803, 0x04000025, 0x00630000, 0x04000800,
+0x29010004, 0x0A000700, 0x12005100, 0x001E54FB, 0x27000064, 0x007F0300, 0xFF00070F, 0xF000A5FF,
+0x00040302, 0x0402CC00, 0xCD050004, 0x001C0302, 0x03051D01, 0x2404000C, 0x03680000, 0x0F002805,
+0x07650009, 0x9B030094, 0x05980303, 0x04001902, 0x9F0500AC, 0x00170200, 0x0F093901, 0x007100C0,
+0xA4007618, 0x04D60200, 0x000EA006, 0xD0000014, 0x00B80000, 0x01989000, 0xBC00765B, 0x0BA10000,
+0x0060BF00, 0x1D0004C8, 0x0AF20100, 0x021AA400, 0xC4000A40, 0x51DC0018, 0x007EB400, 0x640165F7,
+0x0038002B, 0x02002C01, 0x1C0058A4, 0x04BC0000, 0x00006000, 0x5C010068, 0x04E80000, 0x00000900,
+0x150062C8, 0x0EEF0000, 0x03000800, 0x50020068, 0x0049032F, 0x00000700, 0x0400001C, 0x000C0000,
+0x0F005C03, 0xFFFF0007, 0x085C00A4, 0x017DF000, 0xD402080C, 0xEE4800D2, 0x0002CC00, 0x17005610,
+0x00040D03, 0x0F001D00, 0x03750004, 0xCC000384, 0xFCF72003, 0x91001310, 0x03BD0003, 0x02000400,
+0x1C000456, 0x00270000, 0x0300C805, 0x000F00EC, 0xAB006E05, 0xFFFE4000, 0xFC50FCFF, 0x00009D00,
+0x05009874, 0x00140014, 0x1F7CFE10, 0x02099C00, 0x1F0000C8, 0x00040100, 0x20000501, 0xD570FFFE,
+0x00ABA802, 0x00020020, 0x89B00205, 0x0000EE00, 0xA80309FA, 0x006403F7, 0x03003701, 0x00080538,
+0x04F30005, 0x0001CB00, 0x2E02D22C, 0x200C0001, 0x7111FC10, 0x000A3301, 0x2C000138, 0x84DC0005,
+0x9328FA13, 0x04001901, 0x3D000058, 0x00040F00, 0x00AAFFFF, 0x480002E0, 0x60100003, 0x02122402,
+0xE4010350, 0x02D80002, 0x0402E804, 0x14000008, 0x00040F00, 0x03AF0079, 0x00128C03, 0x9E010E40,
+0xB2FD1019, 0xFFFC4003, 0x88D4FBFF, 0x00044803, 0xC40000B4, 0x00080000, 0x02050003, 0x11030030,
+0x00070F00, 0x095C0061, 0x0004AB00, 0xA1010185, 0x04BC0004, 0x9D7CFC13, 0x00009104, 0xFA120190,
+0xFE107FA4, 0xEE005C08, 0x0A28065B, 0x20002600, 0x0014FAF8, 0x30000A01, 0xFCFFFFFF, 0x6614006F,
+0x00DFA400, 0x0C005CF8, 0x00F90019, 0x0C000400, 0xFD000EB8, 0xE3CC0206, 0x02051400, 0xF9317BC8,
+0x664CFFFF, 0x11009900, 0x00ECEEF7, 0xFC00000A, 0x19980004, 0x000A0806, 0x040000AC, 0x00580200,
+0x0F007E00, 0xFFFF0004, 0x0377009F, 0x000D2C00, 0xFC020008, 0x16D90004, 0xFFFFF640, 0x000368FC,
+0x27010378, 0x050B020E, 0x0802E700, 0xED0F0004, 0xBD007502, 0xFFFE5000, 0xCCFEF8FF, 0x00A1007D,
+0x0000B800, 0x04000398, 0x000C0000, 0x0005000E, 0xFC000033, 0x00040004, 0x6A00C70F, 0x00047F00,
+0x230005AB, 0xA8FD1061, 0x046A0004, 0xF100B800, 0xFEFFF80A, 0xFFFFDFF3, 0xFFFFDAF6, 0xFFFFD9F8,
+0xFFFFDDFF, 0xFFFFD2F7, 0xA1ACDEFD, 0x01003300, 0x1000FEF0, 0xF8FC1037, 0x00C60000, 0xF200FC00,
+0xEEFFF102, 0xB1FFB4D8, 0xADFF6695, 0xFFFF6A94, 0x8DECD7F8, 0x000F2403, 0x3F000026, 0x0100000F,
+0x0001D502, 0x1600063D, 0x01280000, 0x0001F400, 0xDA916C14, 0xBAE3F9FF, 0xA9C6D6FF, 0xDC00003C,
+0x00700043, 0x00003400, 0x9E000B30, 0x01380000, 0x00BB1C02, 0x780000B4, 0x00440000, 0xFF00040F,
+0xD400A1FF, 0x12300002, 0x00000800, 0xE3A00938, 0xECFFD2D9, 0xEBFFD3DA, 0x128C28DE, 0x00B4B0FB,
+0x300103A4, 0x02E00309, 0x0002EF00, 0x0F030004, 0x00070F00, 0x1994006E, 0x1D34FC10, 0xC0008A00,
+0xD4E3FFFC, 0xD5EAFFD1, 0xDFF2FFD3, 0xAE006A2C, 0x05000203, 0x07095F01, 0xCC0000CC, 0x00040003,
+0x0F003600, 0x00650004, 0x5C000178, 0xFEF72004, 0xAC000FB8, 0x04500000, 0xF1000800, 0xC5FFED0A,
+0xBDFF63A2, 0xC3FF4093, 0xC1FF4195, 0xC5FF3B93, 0xB1FF3897, 0x6FEC4C93, 0x0066FE00, 0x40000026,
+0x13E00000, 0x137B6800, 0xF3B738FD, 0xA8D9F900, 0x5393B9FF, 0x518BB0FF, 0xCDFBFFFF, 0x58000A10,
+0x04E40005, 0x021E6802, 0x100000F0, 0x4D3D0000, 0xF2011500, 0xFFFFEC03, 0xD3FFD5FF, 0xB9FF66B5,
+0xBFFF3092, 0x00FF3C98, 0x6C2C00DE, 0x0035F912, 0x01002F03, 0x41011608, 0x00820000, 0x0F000400,
+0x0179020D, 0x050F0099, 0x18FFFF00, 0x00034001, 0x0500022E, 0xF902F012, 0x0215FFF2, 0x0621FF00,
+0x2138FF00, 0xF9FFFF19, 0xF5006A40, 0x02FF0202, 0x0002EA00, 0x48010030, 0x00050204, 0x00030B06,
+0x040F0044, 0xBD006500, 0x0916000F, 0x043CFC10, 0x1BFFFCD1, 0x21FF0005, 0x57FF0002, 0x0F00383C,
+0x0508E800, 0xEB0000B8, 0xA0CC0303, 0x02001800, 0xB90F0004, 0x58026500, 0x0E500001, 0x00314802,
+0x8000016C, 0x0512000B, 0xFFEC0AF1, 0xFF64A4C7, 0xFF3E97C3, 0xFF3D9DD0, 0xFF38A1D8, 0xFF36ABE1,
+0xC84AA6CD, 0x6B26008D, 0x21E28401, 0xB5A4FEFF, 0x006BB002, 0x02F30040, 0xD4F5FFF0, 0x94BCFFA2,
+0x92B7FF53, 0xF8FFFF54, 0x000500C9, 0xDE0267A0, 0x010C0113, 0x0000F301, 0x34000030, 0x051C0001,
+0xFFDF05F0, 0xFF4A99BA, 0xFF3CA3CC, 0xFF39A4D0, 0xFF3995BC, 0xAD109AB3, 0x12050000, 0x0000A9F8,
+0x04000201, 0x00410500, 0x0004F800, 0x08000044, 0x00510100, 0xFF00050F, 0xCF02A4FF, 0x02C40002,
+0xFFF900F1, 0xFF07112C, 0xFF0A1438, 0xFF242D4C, 0x006F9CFF, 0x1A0002F1, 0x1C5C020A, 0x00002C06,
+0x17020030, 0x02F50F03, 0x008B006E, 0x5FE6FD10, 0xF1000900, 0x23FFFB00, 0x35FF0104, 0x69FF0B0F,
+0xFFFF4548, 0xBC006F05, 0x0FC80321, 0x04142805, 0x340000B6, 0x000C0400, 0x5F00080F, 0x06015000,
+0x80001080, 0x05A10000, 0xF613DC00, 0xEEFFF50E, 0xF4FFC5E3, 0xFFFFB1E0, 0xDBFFADEC, 0xD9FF5EB1,
+0xCAFF36A4, 0xFFFF439E, 0x0678E5FF, 0x01193000, 0x9A0031BA, 0x0F450013, 0xFFEF02F1, 0xFFAAD4ED,
+0xFF4E84A6, 0xFF5283A3, 0xD0D3F7FF, 0x01C600BB, 0x0C006C00, 0xF2020004, 0xFFE65197, 0x5C78ADCF,
+0x97C3A000, 0xB6D6FF38, 0xFFFFFF75, 0x18000F68, 0x051C008F, 0x030F1800, 0x41000A04, 0x0C0C0100,
+0x0300A400, 0xB7000154, 0x00040F00, 0x01AAFFFF, 0x3C001DE4, 0xF900F209, 0x1236FFF3, 0x1240FF0A,
+0x2E55FF0A, 0x92ACFF26, 0x0607E000, 0x48000500, 0x09340203, 0x03043802, 0xFE0F030F, 0xB0006B02,
+0x26D80021, 0xF13C8C00, 0xFFF4FB01, 0xFF05092E, 0xFF0B0F3E, 0xFF464A70, 0x020E14FF, 0xB30100C4,
+0x05000F0A, 0x0094007C, 0x10139000, 0x001085FB, 0xCC010153, 0x014F0000, 0x00000D00, 0xCC00099C,
+0xFFDBD318, 0xFF6EB4D8, 0xFF39A1D4, 0xA449A4D1, 0x19DC00BB, 0x0000D800, 0xF4000028, 0x09E0007E,
+0x00003800, 0xE09304AC, 0xD4FAFFFF, 0xD5F5FFFF, 0xF00092F8, 0x1E480074, 0x01000403, 0xD40204C0,
+0xFFFF2001, 0xD6D27564, 0x468BB4FF, 0x429FCBFF, 0x69BBE1FF, 0x2801BB0C, 0xFFFF3075, 0x010F59F7,
+0x4400F548, 0x04F0028E, 0x03103402, 0x01080500, 0x008B0002, 0x00000400, 0x04070087, 0x00230000,
+0x00000400, 0x040900EC, 0x000D0500, 0x0F002D07, 0x0018000B, 0x04000054, 0x00330C00, 0x00001400,
+0x180C0004, 0x00100000, 0x0500180F, 0x0F001C00, 0x0F0B0004, 0x0F0000D9, 0x000C00C0, 0x04000128,
+0x03300200, 0x00005E03, 0x04000047, 0x000F0300, 0x0F000700, 0x000A0094, 0x1300002C, 0x01B40307,
+0x00002C00, 0x38000004, 0x00580200, 0x00002103, 0x0B070011, 0x000F0000, 0x00002800, 0x0C000004,
+0x00040200, 0x00002104, 0x12020008, 0x00060F00, 0x00380005, 0x05000404, 0x37050024, 0x0C480000,
+0x05000D05, 0x0905001F, 0x001B0900, 0x0C002C00, 0x21030928, 0x00070000, 0x01000400, 0x09050039,
+0x00D70D00, 0x03001F01, 0x94002BAC, 0x00100200, 0x08005402, 0x39060010, 0x00220400, 0x0000080A,
+0x0408002C, 0x001E0900, 0xE2910800, 0x31FFF8FE, 0x46FF030D, 0x55FF0B15, 0x0500232C, 0x04F2FE12,
+0x00000600, 0x40000004, 0x00680500, 0x04019803, 0x1C000207, 0x00040400, 0x0F005C09, 0x000C000D,
+0x04000224, 0x00270F00, 0x011B0006, 0x0F000407, 0x00010064, 0xFA11C038, 0xFB70985C, 0x00042CFF,
+0x05003FFF, 0xC4474B22, 0x00A10100, 0x0003BC02, 0x4006000B, 0x00550400, 0x06007A0F, 0x5300190F,
+0x00008704, 0xE8050008, 0x000D0002, 0x00000400, 0x01F00EEA, 0xB2D2FFE3, 0xA0D2FF70, 0xA2CFFF3C,
+0xFFFFFF4B, 0xD0001DDC, 0x04840300, 0x00002700, 0xA1002330, 0x06040001, 0x00890001, 0xF71309BC,
+0x28000100, 0x0FF50305, 0x0000FD00, 0xC7000030, 0x000C0036, 0xF3FF07F2, 0xABE2FFFF, 0x4796BDFF,
+0x4195B9FF, 0xB6F8FFFF, 0xEDFFFFFF, 0x5000C689, 0x00240000, 0x00111C00, 0x24010058, 0x01130302,
+0x00000C01, 0x74000201, 0x0029000A, 0xFAFFFE30, 0x5C030FBB, 0x02240500, 0x00007700, 0x23001A9C,
+0x004C0000, 0x00008B00, 0x77000FDF, 0x4BDA0114, 0x050A6000, 0x5D030035, 0x00070200, 0x00002F00,
+0x0E020004, 0x00060700, 0x00007700, 0x04030058, 0x01D40000, 0x10020000, 0x520094FF, 0xF5FFFEFF,
+0x013CCCFC, 0x5B00003C, 0x00090000, 0x021A2801, 0x6C002424, 0x20EC0202, 0x02001D00, 0xFE110144,
+0x54022480, 0x29900403, 0x02005800, 0x64000076, 0x068C0010, 0x00855803, 0x190106B1, 0xFFFB5100,
+0x4CF8FEFE, 0x0063007B, 0x000B9501, 0xC401158D, 0x16740001, 0x00007000, 0xDC000C7C, 0x00080042,
+0x01068002, 0xBC000128, 0xB8FD1000, 0x0028001A, 0x00AD8000, 0xD9000088, 0x00040000, 0x01004101,
+0x7B000143, 0x006F0001, 0x17005700, 0x1307BCFA, 0x020CD8FA, 0xFB2006C6, 0x0126B0FF, 0x890080F0,
+0x00040000, 0x23253C00, 0xAE7CFFFE, 0x00022C00, 0x240000F6, 0x1ABA000C, 0x00018D00, 0x6C032079,
+0x00E90100, 0x01010C00, 0xC70200D5, 0x25280000, 0x05007003, 0x5800012C, 0x27280100, 0x2400D800,
+0x1B80FFFB, 0x01001700, 0xFC10003A, 0xBC030788, 0x00150000, 0x616A0500, 0xF7FFFCFF, 0x0742FDFF,
+0x0025E401, 0x4C0000CD, 0x11B80302, 0x0007EF02, 0x5403007C, 0x000B00F6, 0x03003C00, 0x9B0000A3,
+0xCD340000, 0x021B8402, 0x6C019FB4, 0x00E00000, 0x0008F401, 0xE0020031, 0x1DC00000, 0xFCF8FD11,
+0x928CFE12, 0x00001B00, 0x6C000004, 0xFDFF3000, 0x001268FF, 0x3800027B, 0x000C0012, 0x00011200,
+0x3F020004, 0x01800013, 0x31FFF8D2, 0x42FF040E, 0x5AFF0513, 0x0F002632, 0x201D5401, 0x7EDCFFFF,
+0x00011901, 0xFF1302EF, 0x4C0001B8, 0x00AC0391, 0x0001A800, 0x600000B3, 0xFDF72000, 0x790001EC,
+0x00540000, 0x02002100, 0x9C00F628, 0x000E0026, 0x00266800, 0xE1000008, 0x00800001, 0x00D81600,
+0x1000019A, 0x12CD0200, 0x1500E201, 0x000288FF, 0x3800002D, 0x1CAB0003, 0xFFFFFD54, 0x18ECFEF6,
+0x0003F502, 0x0400001F, 0xA5C80100, 0xF8FB01F0, 0x010630FF, 0x0D1442FF, 0x434866FF, 0x05C0FFFF,
+0x0301E700, 0x5000008F, 0x005E0201, 0x00001102, 0x10020080, 0x00060F00, 0x00930070, 0x01031800,
+0x3C000004, 0x00940001, 0xDA09D000, 0xB1D0FFE6, 0xA0D1FF72, 0xA1CDFF3E, 0x0005004D, 0xF80300D1,
+0x9CE00203, 0x0022F000, 0xC80018CC, 0x15C0001D, 0x03004000, 0x25000464, 0x01480001, 0x00029801,
+0xFC0003D0, 0xE402F309, 0x97DFFFFF, 0x459EC8FF, 0x4597BCFF, 0xC6FFFFFF, 0xF3120A00, 0x3000040D,
+0x00900000, 0x3BFCFE21, 0x006F008E, 0x01009600, 0x340001AC, 0x1124010C, 0x0005A400, 0x08000570,
+0x00800000, 0x007FE000, 0x60000004, 0xFFF75100, 0xA2FBFDF8, 0x2DC4000F, 0x00000901, 0xB400008F,
+0x284C011A, 0x03008800, 0x590200F9, 0x00060500, 0x0000AF00, 0x11050004, 0x00090400, 0x0001D000,
+0x04030094, 0x00940100, 0x00004300, 0x5C010285, 0x00B50003, 0xFFFFFB40, 0x108178FA, 0x02295DFB,
+0x50008004, 0x00B401F4, 0x03002000, 0x30000004, 0x04390003, 0x00014403, 0x74001548, 0x00040000,
+0x02E0FB10, 0x00005D00, 0x40000244, 0x0064011F, 0x02004F02, 0xF200008B, 0x1AB80002, 0x01A4E002,
+0x3900007B, 0xF4FE1000, 0x257800B2, 0x11002002, 0x03258CFF, 0xB30001D0, 0x04580302, 0x42002B00,
+0xFFFAFCF9, 0x200004CC, 0x00D90000, 0x0000B800, 0x8000106C, 0x06510329, 0x0458FB13, 0x01008000,
+0x3A002A1C, 0xFFFC4000, 0xFD8EF9FF, 0x00006400, 0x51010151, 0x12B30206, 0x13001F00, 0x000450FF,
+0xFB1000A9, 0x28000020, 0x016C0000, 0x00003400, 0xC0000010, 0x006400FF, 0x04035502, 0xD8010438,
+0x00F40001, 0x0BFAFA22, 0x00BC0100, 0x13003003, 0x211608F5, 0x4CFAF4FC, 0x00005B00, 0x7402006B,
+0x000E002B, 0x0000DD03, 0xAC000015, 0x01110100, 0x00483C02, 0xA0010532, 0x01840006, 0x009F8800,
+0x0C002560, 0x01780000, 0x00018400, 0x78000160, 0x05200000, 0x0300AB00, 0xD3000044, 0x03A40001,
+0x6AFBF720, 0x0019004D, 0x0000B404, 0x6E0005C0, 0x0D080004, 0x0000A000, 0xEC00012C, 0x25BC0002,
+0x000CAC00, 0xC300014C, 0x00340304, 0x004DC803, 0x6B0004F8, 0x006B000D, 0x00046C01, 0xAC000009,
+0x06500000, 0xF6FD02F0, 0x010F34FF, 0x061846FF, 0x202F58FF, 0xD0FAFFFF, 0x01200002, 0x00056000,
+0x71000611, 0x2D200002, 0x0000D402, 0x1404003B, 0x000C0205, 0x00018400, 0x98000164, 0x00080000,
+0x1101C800, 0x06C858F7, 0xD9000204, 0x2B5B0000, 0x8880FC11, 0x00016500, 0xE400828C, 0x04C00100,
+0x00010000, 0x4703014B, 0x01340206, 0x00000D03, 0x3000003B, 0x01580001, 0x02DCFD10, 0x0001CC00,
+0x9501021C, 0x00A50205, 0xFBFE01F0, 0x000833FF, 0x050D3BFF, 0x444B67FF, 0x0164FFFF, 0x01036C00,
+0x5900003C, 0x00ED0000, 0x00000402, 0x17000074, 0x00160000, 0x7200040F, 0x00009700, 0x04010163,
+0x03100000, 0x00009600, 0x000F01D4, 0xAC000305, 0x06F40003, 0xF1080402, 0xF4FFF10A, 0xFEFFBCE6,
+0xFFFFB2E9, 0xFFFFB0E8, 0xFEFFB1E9, 0xFBFFB5E4, 0x22C4C4E9, 0x00031900, 0x840200F0, 0xF71AF19E,
+0xD5EFFCFF, 0xB3E5FEFF, 0xA7F0FFFF, 0x71C9F7FF, 0x3B9BCDFF, 0x3B97C6FF, 0x98ECFFFF, 0xADF5FFFF,
+0xB3E4F5FF, 0xEAFCFFFF, 0xA0000640, 0x245C0001, 0x00088400, 0x8C000130, 0x00500002, 0x00007802,
+0x01F004F8, 0xFFFFFFE2, 0xEBFFFFD4, 0xE6FFFFB3, 0xF2FFFFAE, 0xDA13C550, 0x58000548, 0xFFF740B2,
+0x0504FFF8, 0x0202A800, 0x03000250, 0x046002F8, 0x0F00E400, 0x001F0004, 0xDA000088, 0x00040002,
+0x0105CF01, 0x0500013C, 0x00120000, 0xFFF812F2, 0xFFD0DBEF, 0xFF737DA1, 0xFF333E6B, 0xFF131D4E,
+0xFF192150, 0xFF222A51, 0xFF606688, 0x18B2B7D5, 0x2470010B, 0xFFFB01F0, 0xFFD8DEEA, 0xFFB0B6C6,
+0xFFABAFBB, 0x00B0ECF3, 0xFDF0FF11, 0xF0009601, 0xFFFAFD03, 0xFFD7DBE7, 0xFFABB1BF, 0xFFAFAEBC,
+0xB3F6F5FD, 0x033B0202, 0x10291A00, 0x201078FD, 0x07DCFFFE, 0x00030401, 0xA4030403, 0xEE00F202,
+0xBBFFE5EA, 0xC4FFA9AF, 0xF7FFAEB1, 0xE4F9E4E5, 0x00039703, 0xFC0000A6, 0x01C00204, 0xF2033803,
+0xFFF9FE0F, 0xFF9399B9, 0xFF474F76, 0xFF18214C, 0xFF121E46, 0xFF212E51, 0xFF586182, 0xF6B1B8D2,
+0x0490005B, 0xFCFE02F0, 0xD9DBE8FF, 0xB5B4C6FF, 0xADAFBEFF, 0xE8F0F4FF, 0x04000029, 0xD10BD500,
+0xC7DCFFFF, 0xB2C8FFC5, 0xADBCFFAC, 0xF201C0AA, 0xF8FEFF0C, 0xA8AFCBFF, 0x4D5677FF, 0x1E284BFF,
+0x182245FF, 0x414C6CFF, 0x8E95B1FF, 0x50000108, 0x00040103, 0x0004F400, 0x0DF004E4, 0xEFFFFFF7,
+0x85A9FFE9, 0x4569FF7F, 0x2344FF3B, 0x2748FF13, 0x5E81FF18, 0xACCBFF5A, 0x94002514, 0x24F91102,
+0xFEF42001, 0xFF11C214, 0xFF1006E4, 0x000009CD, 0x008B0301, 0x03055402, 0x11F00408, 0xD6FFF9FF,
+0x8AFFB3B8, 0x50FF5D67, 0x47FF1C31, 0x4EFF1027, 0x74FF1C2C, 0xBAFF4954, 0xFFFF959F, 0xFB102AD8,
+0x50020730, 0xFBF62006, 0x33000B34, 0xFFFC2001, 0x75020560, 0xFFFCD201, 0xFFB9BACE, 0xFFAFAECD,
+0xD4B5B4D3, 0xFD0FF306, 0xE5FCFFF7, 0x7592FFDD, 0x385BFF6C, 0x1A3DFF2E, 0x284EFF10, 0x4C6FFF23,
+0x89A7FF48, 0x02180088, 0xFA310084, 0x0BACF6FC, 0x0101A801, 0x22F00B4D, 0xB1C6FFFD, 0xB5CFFFB3,
+0xB9DCFFB5, 0xB5DDFFB5, 0x1644FFA9, 0x1645FF04, 0x2A55FF00, 0xCDEEFF15, 0xB5D0FFC4, 0xB4CEFFB1,
+0xB3C8FFB4, 0xE5F3FFB2, 0x019CE5E7, 0xFB81039E, 0xF7FFF9FF, 0xD8FFF8FA, 0x053C01BE, 0xE0FFF851,
+0x0088C1C9, 0x375708F2, 0x2245FF2A, 0x254BFF15, 0x4B6EFF19, 0x90B1FF3E, 0xF2FFFF87, 0x00018CEC,
+0x28000168, 0x02B5010B, 0x00055400, 0xB80004C0, 0x01390001, 0x0004E802, 0xFA1005F4, 0x2C000794,
+0x08600000, 0xF4FD0FF2, 0x9DA7C0FF, 0x55607EFF, 0x1C294BFF, 0x172447FF, 0x1D2A4DFF, 0x465073FF,
+0x8F98B7FF, 0xE40013E4, 0x13EC0006, 0xFFF5FCE2, 0xFF000A34, 0xFF05123F, 0xC4434C69, 0x027400E2,
+0x00031B00, 0xFD010004, 0x10940000, 0x02000400, 0xE80108E3, 0x00050F02, 0x00A00171, 0x00045602,
+0xAB010CA6, 0x072C0000, 0x0500FF1F, 0x01E0000D, 0xFFEB0AF1, 0xFF679EB2, 0xFF4F94B3, 0xFF4A92B8,
+0xFF4B94BD, 0xFF4993BA, 0xD06AA3C0, 0x54AA000E, 0x021A2200, 0x19F004B8, 0xC3D4FFF5, 0x8EAEFFA2,
+0x9BC5FF4C, 0x9ECFFF42, 0xA6DAFF3C, 0xA8DAFF41, 0x99C6FF44, 0x99BCFF38, 0x89A3FF3F, 0xE9F7FF46,
+0xE000233C, 0x57000003, 0x00009802, 0x68020D68, 0x0A64000A, 0xFFE619F0, 0xFFA7D5E5, 0xFF63A0BC,
+0xFF4992B3, 0xFF4C98BC, 0xFF4A96BA, 0xFF4E94B8, 0xFF4B8DAF, 0xFF609FBE, 0xFFA4DBF0, 0x0520FFFF,
+0x00045800, 0xF9120A90, 0xC10032EC, 0x05E30004, 0x0F000800, 0x0024017C, 0x0400003B, 0x02300000,
+0xF1012C01, 0xFFF9FB13, 0xFFDADFF3, 0xFF2B324E, 0xFF00082A, 0xFF04113D, 0xFF051344, 0xFF051246,
+0xFF000D41, 0x18091545, 0x052FB107, 0x0F2FFF00, 0xBECCFF0A, 0xF10454B8, 0x7E899F00, 0x00011CFF,
+0x00061BFF, 0xB2B8C6FF, 0x140109E1, 0x00550117, 0xFFFC02F2, 0xFF757C8E, 0xFF00041C, 0xFF010318,
+0x35CBCADA, 0x00BC0002, 0x0704E801, 0xC3000248, 0xFCFC1402, 0xFB02F00C, 0x9DA0AFFF, 0x02061FFF,
+0x000322FF, 0xA4A4C0FF, 0x04020EE5, 0x03420000, 0x00079800, 0xFC1008F4, 0x1EF103F4, 0x748CFFF9,
+0x0324FF6E, 0x0A32FF00, 0x123EFF00, 0x123FFF05, 0x1440FF04, 0x123DFF03, 0x103AFF01, 0x0A2DFF03,
+0x1231FF00, 0xC6E0FF09, 0xE00850BF, 0xFF80829B, 0xFF020321, 0xFF000118, 0xFDA8C7CF, 0xF0047503,
+0xFFFCFA26, 0xFF404763, 0xFF000626, 0xFF000724, 0xFFF2F8FF, 0xFF1B2347, 0xFF00062A, 0xFF09123B,
+0xFF04103A, 0xFF08153F, 0xFF06143B, 0xFF00092B, 0xFF000922, 0xD6F48F9D, 0x000A1000, 0x19F00850,
+0x6F93FFF7, 0x0431FF65, 0x0B39FF00, 0x103BFF00, 0x123AFF01, 0x173DFF00, 0x0D37FF05, 0x072DFF06,
+0x1435FF02, 0xC7DEFF0B, 0x1800E124, 0xFFFE3002, 0x01C718F7, 0x83020185, 0x01370008, 0x00079C02,
+0xF7D105E6, 0xA6ADC0FF, 0x0D122FFF, 0x050A32FF, 0x0CF30080, 0xFF00153A, 0xFF00173B, 0xFF000F37,
+0xFF08163D, 0xFF030D30, 0xFF000928, 0xA07B85A0, 0xFFF7218C, 0x0F020A30, 0x01260004, 0x00005902,
+0x12A108DC, 0x0730FF0F, 0x0931FF04, 0x71E0A804, 0xFF4F5673, 0xB8000124, 0x3C0FF209, 0x39FF0413,
+0x3CFF020F, 0x36FF0811, 0x33FF050C, 0x26FF090D, 0xA8FF0106, 0xFFFF878E, 0x01027CFB, 0x68000670,
+0x0BFF0003, 0xFFFB23F0, 0x080520FF, 0x09092DFF, 0x000731FF, 0x000936FF, 0x051B4AFF, 0x001B4AFF,
+0x021945FF, 0x000A2EFF, 0x060B2BFF, 0x080B2AFF, 0x03051EFF, 0xABADBCFF, 0x550004A9, 0x0238010A,
+0xF1004C01, 0xFFFBFF0F, 0xFFC9CFE7, 0xFF1B2445, 0xFF020C30, 0xFF020E34, 0xFF010E38, 0xFF020F3B,
+0x0804133E, 0x0E363100, 0x32018002, 0x58585D7A, 0x01FC012D, 0x03008500, 0xC50000E1, 0x00900002,
+0x01000804, 0xB5000F91, 0xF716F104, 0x707B8FFF, 0x000E2BFF, 0x000E2FFF, 0x021639FF, 0x03163EFF,
+0x011240FF, 0x000E3DFF, 0x0A1640FF, 0x040D34FF, 0x9533005C, 0x00947378, 0x30FFF4D2, 0x41FF0005,
+0x65FF0614, 0x00AC3E49, 0x04006B00, 0x9D000004, 0x154C0101, 0x0002C702, 0x7F0F0073, 0x370F2403,
+0xA4003F00, 0x031C0000, 0x00000401, 0x63000361, 0x076C0000, 0x0B05000F, 0xB160FA11, 0xFFEE0AF1,
+0xFF6696AC, 0xFF4B8BAE, 0xFF4992BB, 0xFF4FA2CE, 0xFF42A1CF, 0x3066B2D4, 0x02AA000F, 0x0004C202,
+0x1AF10984, 0xBFCEFFF3, 0x89A8FF9F, 0x96BFFF4A, 0x9DCAFF41, 0xA5D6FF3C, 0xA6D9FF3F, 0x9BCDFF3E,
+0x9BC6FF37, 0x8CABFF3E, 0xE6F2FF47, 0x000820CA, 0x90010A38, 0x028A0105, 0x51024800, 0xFAFFFFED,
+0xF12330CC, 0x3C9CC41C, 0x419ECAFF, 0x4198C5FF, 0x4694BAFF, 0x4C94BAFF, 0x4F94BEFF, 0x4A94C3FF,
+0x409FCDFF, 0x3798C2FF, 0x499CBAFF, 0xBAF7FFFF, 0x840123B8, 0x0E000000, 0x03036F00, 0xE6000440,
+0x00040F00, 0x01350027, 0xF20D0400, 0xBBFFF73B, 0x2FFF979A, 0x3EFF0104, 0x36FF0D11, 0x2EFF060F,
+0x2DFF000C, 0x5FFF000E, 0x69FF3140, 0x4CFF3948, 0x2CFF1D2A, 0x38FF0009, 0x3FFF060F, 0x29FF0F18,
+0xB2FF0004, 0xC9FF848E, 0x35FF96A4, 0x29FF0412, 0xD2FF000B, 0xACFFB6BC, 0xFFFF400C, 0x0CC0FAFC,
+0x9EFFF9D1, 0x30FF7D84, 0x29FF080E, 0x2A58060B, 0x28F7FF20, 0x03930209, 0x00BC2800, 0xEA009964,
+0x024C0003, 0x00000400, 0x1C000502, 0xC200F203, 0x2EFFA5A9, 0x33FF070B, 0xC8FF070A, 0x13FDA6A6,
+0x0100AF00, 0x32000284, 0xF83AF100, 0xF1F8FFFF, 0x121B3CFF, 0x020B34FF, 0x0C1842FF, 0x051338FF,
+0x000927FF, 0x2B3C56FF, 0x44566EFF, 0x1F2E4BFF, 0x000C2FFF, 0x010D35FF, 0x08113AFF, 0x000229FF,
+0x9BA3C8FF, 0x98A0C5FF, 0x081037FF, 0x040D2EFF, 0xC3CADAFF, 0x2C020232, 0xFB02F10D, 0x444F6DFF,
+0x011039FF, 0x081341FF, 0x182051FF, 0x14F11CD0, 0xFF050E35, 0xFF030E2E, 0xFF32405B, 0xFF2D3C59,
+0xFF071635, 0xFF031032, 0xFF0D173A, 0xFF000728, 0x28636E8E, 0x3B5D600C, 0x0C36FF2E, 0x16F10840,
+0x0D33FF07, 0x1A39FF01, 0x4560FF0B, 0x3753FF31, 0x092DFF26, 0x1038FF01, 0x1846FF0B, 0x0028FF10,
+0xAAC4FF00, 0x000078A3, 0x3A0100CA, 0x1B2C0005, 0x0000E000, 0xDC0003C0, 0xFE27F301, 0x5676FFF8,
+0x062CFF50, 0x0E37FF02, 0x0D36FF0C, 0x092DFF0B, 0x2842FF03, 0x455CFF1A, 0x3754FF36, 0x082AFF30,
+0x072BFF02, 0x183CFF00, 0x0B33FF0E, 0x2343FF00, 0x40CC9016, 0xFAFFFFF7, 0x080316C0, 0x31F91003,
+0xF804F002, 0x172144FF, 0x061340FF, 0x142251FF, 0x43507CFF, 0x05A435FF, 0x081619F1, 0x00082BFF,
+0x0D1D3EFF, 0x364765FF, 0x1F2D4AFF, 0x030C2DFF, 0x090E36FF, 0x0E133DFF, 0x00052EFF, 0x50597AFF,
+0x066CFFFF, 0x00062800, 0x85001691, 0xFFFF9102, 0xFF07041F, 0xEC040728, 0x3800F104, 0x45FF0010,
+0x4BFF041B, 0x44FF001A, 0x02400016, 0x040926E0, 0x060A23FF, 0x000012FF, 0x84B4BDFF, 0x00EE040B,
+0x0228F411, 0x757996B1, 0x00002AFF, 0x0D1845FF, 0x18F201C4, 0xFF020C2F, 0xFF182140, 0xFF3A4362,
+0xFF313C5C, 0xFF071134, 0xFF010E31, 0xFF061034, 0xFF091135, 0xFF090F2F, 0x48E0E2F9, 0x0FC3000A,
+0xFFFFFE57, 0x0744FAF7, 0x000A1800, 0x16F011A4, 0x4AFFF9FE, 0x3BFF2026, 0x40FF0511, 0x36FF0615,
+0x27FF0011, 0x49FF0008, 0x67FF152A, 0x5EFF3343, 0x2EFF2C38, 0xD105A40A, 0x0E34FF04, 0x0A2EFF09,
+0x2844FF04, 0xB2013C21, 0xFF000C3D, 0xFF021442, 0x583D4B68, 0x0270000B, 0x00019800, 0x04030008,
+0x02A80000, 0x0F000B03, 0x0F27037B, 0x013D003A, 0x220100A4, 0x0D5A0004, 0x020BF301, 0x000F096C,
+0x18000705, 0x00040016, 0x01AD5801, 0x01F022B4, 0xFFFFFFCF, 0xA8D5FFCB, 0x9FD1FF57, 0xB6DBFF3B,
+0xE83127C4, 0x1A1CF8FF, 0x00066500, 0x580001C0, 0xE112F1F3, 0xC3F1FFFF, 0xBBFDFFFF, 0x7FD4FDFF,
+0x41A2CFFF, 0x3799C8FF, 0x99F4FFFF, 0xB1FDFFFF, 0xBCF0FFFF, 0xC8000A38, 0x04FC0003, 0x020EBE00,
+0x0DF0B6C8, 0xF0FFFFE7, 0x8CB6FFC1, 0xA3CFFF47, 0x9CC9FF46, 0xA6CEFF3B, 0xDDFFFF53, 0xFDFFFF97,
+0x0EF30888, 0xF5FFFFC8, 0xDEFFFFC0, 0xAAD4FFA0, 0x9AC4FF57, 0xA4CEFF3A, 0x92B7FF43, 0xDDFEFF40,
+0x201E90AF, 0x93A4FFFC, 0x0000E102, 0x490F0090, 0xD4002901, 0xF70AF100, 0x949FB1FF, 0x00022CFF,
+0x121447FF, 0x020532FF, 0x454B6DFF, 0xD0D8EBFF, 0xFF2023FC, 0x0011C8FD, 0xF4910968, 0xF0FBFFFF,
+0x76819DFF, 0x00F10508, 0xFF05103D, 0xFF02103F, 0xFF293B69, 0xBC071843, 0xB7D13107, 0x0202D8B0,
+0x91000092, 0xFFFB5101, 0x507D86A5, 0x082C7105, 0xD1EAFF02, 0x0000B7CD, 0xE7000DEB, 0x02480003,
+0x01000400, 0xFD210504, 0x010F08FD, 0x03F20B24, 0xC6FFFBFD, 0x32FFA4A7, 0x37FF0609, 0xC9FF090C,
+0x0500A5A8, 0x00027500, 0x7C000CA8, 0xF5FC210F, 0x00F109A8, 0xFF0C1540, 0xFF030E3B, 0xFF0D1A3D,
+0x88A7B5CF, 0xFFFF2404, 0xB80000B4, 0xF511F000, 0x838CABFF, 0x070F34FF, 0x0B143DFF, 0x000633FF,
+0x3A4974FF, 0x061743FF, 0x00072AFF, 0x70C7D8FF, 0x01480010, 0xF200B000, 0x73FFF90A, 0x45FF4554,
+0x51FF0315, 0x44FF0E19, 0x34FF050F, 0xBAFF0009, 0x010C9099, 0x000C5001, 0xF4512F3E, 0xA6B0CBFF,
+0x0FF00514, 0xFF07133D, 0xFF020F3C, 0xFF3C4B76, 0xFF000D37, 0xFF071039, 0xFF141C40, 0xFFC5CCE6,
+0x04DAFEFF, 0x20008C00, 0x0F48FFF4, 0x719603F0, 0x0432FF6D, 0x1846FF00, 0x0026FF0D, 0xEAFFFF00,
+0x90020BDC, 0x12F60017, 0x0119FA10, 0xF1008700, 0xFFF9FB07, 0xFF393F63, 0xFF020935, 0xFF101340,
+0xFF080A33, 0xBC8487A8, 0xFEFF200A, 0xF75000D4, 0xF7F8FFFF, 0x05F11309, 0xA9AECBFF, 0x0F1839FF,
+0x020E38FF, 0x09173EFF, 0x061532FF, 0x0A0103C8, 0x004C0003, 0x00000401, 0x0EF30910, 0x2445FFF5,
+0x1745FF15, 0x1A4CFF05, 0x1141FF06, 0x123DFF00, 0x4A6DFF03, 0xEFFFFF40, 0x400138E3, 0xFEFFFFF2,
+0xF6510004, 0x787D9DFF, 0x00F10A74, 0xFF0B1341, 0xFF020B36, 0xFF7A80A0, 0xC0F3F8FF, 0x01870001,
+0xF00E5F00, 0xCBCADC23, 0xCBCDE4FF, 0xC9D3EEFF, 0xBBCCEAFF, 0x02183FFF, 0x02194BFF, 0x1A305FFF,
+0xDAE5FFFF, 0xCBD0E4FF, 0xCCCFDEFF, 0xCCCFD6FF, 0xF0F4F7FF, 0x0CF9FCFF, 0x08440001, 0xFFF70AF1,
+0xFF6C6F8E, 0xFF03062F, 0xFF0E1644, 0xFF00042E, 0xFF67708F, 0x34EBF3FF, 0xC35C0108, 0x1488FE10,
+0xE4FFF691, 0x50FFBFC9, 0x0BC42732, 0x0B1337A2, 0x000220FF, 0x38E5F8FF, 0xFDF82201, 0xF615013C,
+0x460040B8, 0xF805F001, 0x060F2EFF, 0x040C3AFF, 0x030D3EFF, 0x07153CFF, 0xB09EBCFF, 0x175400A1,
+0x00221000, 0x900002C8, 0xFFF99101, 0xFFB7BBD4, 0x9C252B4B, 0x05600006, 0x335B00F3, 0x1246FF27,
+0x1242FF01, 0x4D67FF00, 0x0001F43D, 0xD2000141, 0x05680002, 0x00079E02, 0x0401000E, 0x001B0001,
+0x01000400, 0x050F0011, 0x88036C00, 0x02CA0000, 0x01047400, 0xB00100A0, 0x05000F02, 0x00D40009,
+0x03072400, 0xFC013C20, 0xFFD9513B, 0xD46AB0D4, 0xB1D93113, 0x05DE705E, 0xA0000050, 0x06600002,
+0x00005801, 0xE4D309CC, 0x9FE1FFFF, 0x4A9BC6FF, 0x4191B6FF, 0xFC001900, 0xFFF220F7, 0x10000558,
+0x0192003C, 0x02B4FB11, 0x1118DC00, 0xE03294D3, 0xFF44A3D3, 0xFF448BB7, 0xFFA1D6F6, 0x2D24FFFF,
+0x000F1000, 0x8C001E98, 0x01A40012, 0xFFE809F0, 0xFFE4FFFF, 0xFFB2E5FF, 0xFF4493BE, 0xFF45A0CF,
+0xFF4394BF, 0xB68CFBFF, 0xF4FFF131, 0xB8001639, 0x11000300, 0x00017B03, 0x0400044C, 0x000F0300,
+0x06000709, 0x29000018, 0x00040401, 0xF1FFFB51, 0x0E64D1DE, 0x101745B1, 0x000330FF, 0xA5A6C4FF,
+0x9C0115F8, 0x01450011, 0x00117000, 0xFB101810, 0x2C0003CC, 0xF80DF010, 0xE4EFFFFF, 0x0A163EFF,
+0x031346FF, 0x001446FF, 0x0B1D4BFF, 0x000630FF, 0x1CB9D6FF, 0xDCFE1114, 0x015A001C, 0xFDFF03F0,
+0x80A4FFF9, 0x0F3CFF78, 0x0B32FF04, 0xCFECFF03, 0xF0000B14, 0xD1240018, 0x000C4402, 0x040013FC,
+0x03590500, 0xF0009B01, 0xCAFFFC01, 0x34FFA5AA, 0x30FF050A, 0xC6FF050A, 0x000A00AC, 0xDE02177E,
+0x29780001, 0x1A2042E0, 0x0F1640FF, 0x030A36FF, 0x804266FF, 0x049800D1, 0x000BF000, 0x64000A78,
+0xFFFC3103, 0x001888FF, 0x0EF103FC, 0xEEFFFFFB, 0x193DFFE9, 0x1744FF11, 0x1446FF0A, 0x1D4BFF02,
+0x0F30FF05, 0xCCDAFF00, 0x000374C0, 0xE0000BA8, 0x7303F010, 0x42FF3F52, 0x4AFF0010, 0x3AFF0815,
+0xDEFF030B, 0x000B7CC1, 0x7C000940, 0x06300000, 0x000AC000, 0xFBD10108, 0xD4DAF0FF, 0x000C33FF,
+0x051546FF, 0x4272010C, 0x30FF0916, 0x13380A10, 0x00197800, 0x29000140, 0x196C0004, 0xA1179C00,
+0xA8FFFBFD, 0x3CFF7E84, 0x09880612, 0x3E486B60, 0x50F9FFFF, 0x1E6C0200, 0x61CD3C01, 0x9CFFFCFE,
+0x17887A7F, 0x31274C00, 0xAC11163C, 0xFCFF270E, 0x12000180, 0x01D1001E, 0x00FA0D00, 0xFE610058,
+0x476BFFF9, 0x720A043F, 0xFF041237, 0x0035405E, 0x1F98000A, 0x00167900, 0x07F10A00, 0x3EFFF5FF,
+0x46FF1324, 0x48FF051C, 0x38FF0018, 0x9AFF000D, 0x00FC6B78, 0x0017E801, 0x48000054, 0x07EC0114,
+0xE0009400, 0xC0DBFFFB, 0x0933FFBC, 0x0F3DFF02, 0x10F8FF07, 0xF0F3FF31, 0x59000574, 0x1EC00102,
+0x00000900, 0x680000E0, 0xF4FF2113, 0x48720150, 0x5CFF0216, 0x3F701D2E, 0x00001C01, 0xFD3504A4,
+0x9CD4F6FF, 0xD1FFF680, 0x2BFFAFB4, 0x200B2800, 0x09F4FF0F, 0xD4E0F632, 0x7C010E80, 0x02D80000,
+0x000E7B00, 0xF0000174, 0x01CC0016, 0x93FFF751, 0x05046D79, 0x332D6000, 0xEC0D1732, 0x085A020F,
+0x22019A00, 0x0618FAFD, 0x395900F0, 0x143EFF2E, 0x123DFF08, 0x3C5FFF09, 0x1131DA32, 0x01087CFF,
+0x1C000384, 0x03920002, 0x04021400, 0xF6510F40, 0x5D6782FF, 0x45710FC4, 0x4EFF0812, 0x0A000718,
+0x44546D32, 0x8C003FC8, 0x0BAA010B, 0x0700C800, 0x80000500, 0x02AC0101, 0x0F010501, 0x006F0005,
+0xA801008C, 0x06FA0000, 0x01014403, 0x000F04A8, 0xA0000B05, 0x00BD0118, 0x0000D000, 0xFFD20204,
+0xA7CAFFE4, 0x9BCEFF68, 0xB4DCFF3F, 0x00010A00, 0x01370005, 0x01002400, 0x94020068, 0xFFFFE01F,
+0xDDFDFFEF, 0x95BDFFA2, 0x94B5FF4A, 0xCB51235C, 0xF1FFFFFF, 0xB8000EEA, 0x1B2C00B7, 0x02019C00,
+0xE1912828, 0x63A3BFFF, 0x42A4D1FF, 0xFF35378C, 0x325CB7E9, 0x0001E200, 0x64020A64, 0x01F40014,
+0x00006D00, 0x0C00003A, 0xFFCDD105, 0xFF4594BF, 0xFF42A3D0, 0x184F9FC0, 0x16400019, 0x010A5C00,
+0x90011849, 0x00C20100, 0x00051601, 0x040000A3, 0x00120200, 0x00000606, 0x04000014, 0x04680600,
+0x91003900, 0x2B4AFFF9, 0x1740FF1C, 0x2004C008, 0x0468A9CA, 0x00013C02, 0x04000082, 0x03C30000,
+0x0022E000, 0xC400000C, 0x3CF61046, 0x0128001B, 0xA0EFF821, 0x17448011, 0x1845FF02, 0x0A10FF03,
+0xB4B9D932, 0x5F000320, 0x1D6C0002, 0xFFFBFF61, 0xA07D87AA, 0x07307109, 0xD2EFFF00, 0x001778CD,
+0x580000DA, 0x0CAF0000, 0x00009402, 0x88000F10, 0x0004001B, 0x91000C00, 0xA7CAFFFC, 0x0A31FFA3,
+0x100D8C02, 0x010500C2, 0x1C00034C, 0x94F81101, 0x0B37B212, 0x0E3EFF04, 0x3157FF08, 0x0103C42D,
+0x0A00C192, 0x00520321, 0x00000700, 0xE7001BBC, 0x01070000, 0x21123800, 0x0EA0F7FE, 0x081A4CE0,
+0x011949FF, 0x000E30FF, 0x00CDD9FF, 0x4EFC110F, 0x0558001F, 0x527600F2, 0x1749FF40, 0x1141FF03,
+0x496EFF05, 0x00047C41, 0x6C001EC4, 0x04AC030D, 0x11004F00, 0xF00454FB, 0x8BFFFB09, 0x3FFF5E68,
+0x4DFF0011, 0x38FF0919, 0xBFFF000C, 0xFFFFA2A6, 0x2015F8F9, 0x0700FFFF, 0x0305DC02, 0xE401036C,
+0xFFF8A00E, 0xFF131E3E, 0xFF071441, 0x68010114, 0x14FC031F, 0xF2019C00, 0xE0E5FB00, 0x000526FF,
+0x0C153EFF, 0x0A133AFF, 0x4C010D84, 0xFFF9401D, 0x05E0FDFD, 0x00013E00, 0xF80010B4, 0x13530319,
+0x2103A400, 0x0E34F8FE, 0x00149C00, 0xCB2014B0, 0x030B8CB2, 0x04010311, 0xFFF79101, 0xFF11223C,
+0xA4021943, 0x2F512018, 0x2403CDB8, 0x0B8D000F, 0x0000D500, 0xB403A4EC, 0x008C0022, 0xF9FCFF71,
+0x6E7496FF, 0x3971044C, 0xA2FF040B, 0x071C797D, 0x0015E000, 0x14000086, 0x00040002, 0xE2028C01,
+0x35FFF2FA, 0x44FF0512, 0x61FF0111, 0x01382734, 0x42FAB801, 0xFCF4FFFF, 0x280104A8, 0xF7FD2100,
+0x01F00FC8, 0xFF111240, 0xFF04062F, 0xFFE1E7FF, 0xFFF3FCFF, 0xE20002FC, 0x11140006, 0x01021C00,
+0x9C0002CD, 0x01B8003F, 0x3120F903, 0xB45F6887, 0x11337113, 0x8090FF04, 0x0009A070, 0x300206B8,
+0xFFF99115, 0xFFA4AEC7, 0x8C00072F, 0x2A4E3102, 0x000B7422, 0x8C00040E, 0x00280008, 0x00233C00,
+0x130000B8, 0x00040006, 0x00006801, 0x06F005BC, 0x80FFF4FD, 0x42FF5156, 0x4FFF050C, 0x43FF0918,
+0x62FF0315, 0x03075448, 0x6B000120, 0x15A80019, 0x01022601, 0x1F01014D, 0x00400201, 0x0F013901,
+0x036F0005, 0xE0010097, 0x00990000, 0x00001001, 0x000F0230, 0x1C040B05, 0x00330001, 0x00030000,
+0xCCA03220, 0xCFFF6CA8, 0xDEFF439A, 0x12CADCB2, 0x005110E9, 0xFF000350, 0x00580107, 0x0033D002,
+0xFBA0462C, 0xBEFF9FDF, 0xB4FF4698, 0x122D5C94, 0x00B144CA, 0x19000024, 0x008D0002, 0xF3000C00,
+0xFFF0FF03, 0xFFACE8FF, 0xFF4296BB, 0xFF429DC9, 0x3C83CDF0, 0x1BB002B7, 0x00002700, 0x0401005F,
+0x00300000, 0x00000404, 0x02F0019C, 0xF9FFEDFF, 0xC6FFB0E2, 0xBFFF3F9A, 0xF1FF3A96, 0x000F08E0,
+0x9C000BCC, 0x04300322, 0x01017E03, 0x6B030040, 0x00130303, 0x03112C02, 0x00000014, 0x01B90502,
+0xFFFEFE61, 0xF8C1C6DC, 0x08B80004, 0x3C426231, 0x0800049C, 0xE8F71401, 0x03580103, 0x20034400,
+0x0230FFFD, 0x0005A800, 0xA4010152, 0xFBFF800E, 0x9CA3BDFF, 0x090030FF, 0xFF091C90, 0xFF010937,
+0x0500B7D8, 0x0204C000, 0x300009DC, 0x84A7311F, 0x6005287A, 0xFF000A30, 0x0120D1EB, 0x2610FC12,
+0x0000E400, 0x6F0000B1, 0x00680105, 0x0000CC00, 0x6D000004, 0xF801F202, 0xA3A8C8FF, 0x040C31FF,
+0x030C2BFF, 0x2CACBDFF, 0x03400113, 0x44F8FF21, 0x1345E018, 0x0736FF0D, 0xF0FFFF03, 0xF7FFFFF0,
+0xEA000990, 0x00780402, 0x0000F103, 0xAB02AA54, 0x00950212, 0xF8FE06F0, 0xA1ACCAFF, 0x000B37FF,
+0x091B4DFF, 0x000A33FF, 0x00C9D7FF, 0x00380305, 0xFBFF02F0, 0x425276FF, 0x001240FF, 0x000C34FF,
+0x6CB6D0FF, 0x019E0001, 0x00046803, 0x0F000200, 0x05580000, 0xF2016101, 0xEDFFFE02, 0x2EFFCFD5,
+0x4BFF0008, 0x34FF0C1A, 0x0374000D, 0x00044403, 0x270100DF, 0x00050000, 0x0000F000, 0xFFA10004,
+0x8092FFFC, 0x0C33FF79, 0x2012F403, 0x2A34BDD0, 0x00227800, 0xFBD300C4, 0x5A617DFF, 0x060E32FF,
+0x010C2CFF, 0x18000080, 0x00790000, 0x0200040C, 0x6D0100D3, 0x001B0007, 0xE2000900, 0x29FFF0F9,
+0x3AFF0009, 0x40FF0C16, 0x012F2122, 0xF000B003, 0xF6FDFF03, 0x162441FF, 0x06184AFF, 0x000D3BFF,
+0xE8ADC2FF, 0x0C40030B, 0x0000A900, 0xA0000004, 0x06BC0000, 0x0100B000, 0x44000004, 0x54F2110B,
+0x113D7000, 0x2E53FF0A, 0x01020D2A, 0x50000079, 0x04B00004, 0x01021400, 0xFBE2002B, 0x0E38FFF7,
+0x1347FF07, 0x2E5BFF07, 0x030B0423, 0x90000050, 0x0608021D, 0xFFFB02F2, 0xFF8B91B1, 0xFF010A33,
+0xFF0C1139, 0xD87E81A0, 0x14530010, 0x010A0202, 0x500104F7, 0x003C0300, 0x00006000, 0xE0020848,
+0x44FB1122, 0x0C7C0015, 0x000E2A32, 0x3C000FB4, 0x00BC0002, 0xF8FA03F1, 0x1A2044FF, 0x0D1641FF,
+0x00082FFF, 0xE5EBFFFF, 0x1B011E34, 0x020F0300, 0x0002DC00, 0x13000010, 0x02D00001, 0x02000800,
+0x18001A2C, 0xF802F10A, 0x070D3DFF, 0x09164AFF, 0x02133FFF, 0x3F4D67FF, 0x91010560, 0x146C0000,
+0x0A00FF14, 0x01009900, 0x4B020103, 0x00AD0103, 0x7000050F, 0x00009703, 0xB00100D4, 0x00100109,
+0x0F03AE00, 0x00070500, 0x000200C1, 0x02410105, 0x3100F002, 0x00FFE3FF, 0x44992E05, 0x3D000500,
+0x00580101, 0x00050000, 0xEDC00009, 0x9DE0FBFF, 0x4599BEFF, 0x0093B6FF, 0x1DF40005, 0x03D91800,
+0x2F000227, 0x09080116, 0xD5FFEAC0, 0xCEFF63B1, 0xC3FF3D9F, 0x0028289A, 0xEC001468, 0x01DE000E,
+0x00000404, 0xBE0202E8, 0x0D880000, 0x0014BC02, 0x34000BD4, 0xFFE3C011, 0xFF53ABD3, 0xFF3E9DC9,
+0xCA8CA7C1, 0xFFFFE947, 0x03118CFA, 0x9F00017F, 0x00040400, 0x01001303, 0x20000007, 0x00180607,
+0x0002E100, 0xFA912700, 0x5C607BFF, 0x020D3BFF, 0xF0601314, 0xFFFFD2D8, 0x020070F8, 0x1402040C,
+0x0036002D, 0x0200E800, 0x780002A7, 0x02380014, 0x0291F911, 0xF2020400, 0x3DFFF802, 0x42FF0F1E,
+0x35FF0A19, 0xD9FF040B, 0x0374B7B7, 0x217CFD12, 0x35049200, 0x847E87A8, 0xD4EA201D, 0x00003D50,
+0x04500026, 0x0204F900, 0xA5012D14, 0x029D0000, 0x0026CC00, 0xFD80006F, 0xA8C6FFFE, 0x0030FFA3,
+0x040F5305, 0x00ABBEFF, 0xFD05F005, 0xC3D8FFF8, 0x082CFFBB, 0x0E3FFF00, 0x5B85FF06, 0x68FFFF56,
+0x00D30028, 0x01017303, 0x440108CB, 0x005C0200, 0x20068700, 0x4CE0F9F4, 0x00007000, 0xF8600DD8,
+0x172145FF, 0x000CECFF, 0xDC3113DC, 0x007FC8CB, 0x61003801, 0x76FFFBFD, 0x09D04351, 0x302BCC00,
+0xA9DDE4F7, 0x03030100, 0x000A7F01, 0x2B00019F, 0x05000702, 0xF6FBFF31, 0xF8001884, 0x244B202B,
+0xF9111880, 0x55010826, 0x00050100, 0x00008D00, 0x80000047, 0x00110000, 0xBDFFFE91, 0x33FFADB1,
+0x0500060E, 0x4094A820, 0x0204001E, 0x01D4F911, 0x040F2FB3, 0x0A173AFF, 0x0F1A38FF, 0x75000290,
+0x00440000, 0x00004000, 0x04000008, 0x000C000B, 0x0003D503, 0x9000001F, 0x05000022, 0xFFF5FFA1,
+0xFF52617E, 0xD8091639, 0xD7F2301D, 0x0202A9DA, 0xFF6101D1, 0x2345FFF8, 0x000FD816, 0xFF310AA8,
+0x0032F0F4, 0x0101D000, 0xEB0400E1, 0x00080401, 0x0100AB00, 0xF7C000F5, 0x212C48FF, 0x0B123CFF,
+0x5C0C30FF, 0x45D80014, 0x0100B000, 0x9A0110E2, 0x01BB0009, 0xF9FBFF31, 0x45750500, 0x59FF0713,
+0x074C252E, 0x01001C01, 0xE500004C, 0xFFF6800A, 0xFF242E52, 0x1E381340, 0x0A240012, 0x00008100,
+0xFB0100C4, 0x00050006, 0x04059400, 0xFD110004, 0xFC012E84, 0x01A1002D, 0xFFFBFB61, 0xB49295C0,
+0x09307202, 0xACC7FF00, 0xF105689E, 0xFFFFFD03, 0xFFDADDFC, 0xFF030832, 0xFF060D39, 0xFC464C6E,
+0x00770004, 0x00005F01, 0x04000137, 0x00110000, 0x00013703, 0x770000E7, 0x05C40000, 0x002F8800,
+0xB4313BEC, 0x15CC8A90, 0x05143F90, 0x424E68FF, 0x0B70FFFF, 0x01002900, 0x6C000260, 0x0F00002F,
+0x00004900, 0x00000004, 0x00510303, 0x7100070F, 0x00009303, 0x000F00D4, 0xB1021905, 0x02D50003,
+0x00000400, 0xE211046C, 0xCB710500, 0xDCFF419C, 0x1E0064B3, 0x0000DF00, 0xCB011167, 0x00680304,
+0x0003DC00, 0x00F2324C, 0xFF9BE1FB, 0xFF4698BD, 0xFF4D91B6, 0xB4D2FEFF, 0x31300002, 0x0108C700,
+0x82002F3C, 0xE201F003, 0x429ECDFF, 0x35A0D6FF, 0x78CCF1FF, 0x5CFFFFFF, 0xFCE01318, 0x13F80013,
+0x12000400, 0x10379CE7, 0x000008FF, 0x94001414, 0x28E41316, 0xFFDFD20A, 0xFF95E7FF, 0xFF4099C3,
+0xD05699B6, 0x0E84004B, 0x02019C03, 0x920205C8, 0x01000000, 0x01001700, 0xAC030278, 0x05000000,
+0x10011400, 0x000C4CF9, 0x3400216C, 0xFCFEE207, 0x181C37FF, 0x0A1741FF, 0x07153AFF, 0x120100B8,
+0x035C0303, 0x00000C01, 0x62000E18, 0x01F8002F, 0x09CFFF10, 0x00059B02, 0x5C000383, 0xFBFF6112,
+0x5D6B86FF, 0x2E721D78, 0xD9FF0106, 0x014FBAB9, 0x01029000, 0x01F0007C, 0x84A3FFFB, 0x0F36FF7B,
+0x0D2FFF01, 0xD5EAFF00, 0x50001900, 0x02850000, 0x0002EC00, 0x0802232F, 0x00390100, 0xFFFAFE30,
+0x8C000D5C, 0xA8C5311D, 0x72121CA3, 0xFF020D2B, 0xFCA4ACC3, 0xFBFF6117, 0x79839EFF, 0x94001C10,
+0xB5DB2017, 0x8D000DE4, 0x01A20000, 0x030E7000, 0x0F021944, 0x19500100, 0x00DA9800, 0x30050182,
+0xFAFC8028, 0x6F7396FF, 0x1E5C3BFF, 0xFF050861, 0xDDC7C8DC, 0x01340105, 0xFFFCFFA1, 0xFF465278,
+0x6403113E, 0x18B40005, 0x00015600, 0x500508EC, 0x00D80101, 0x00000500, 0x7C000004, 0x40F91100,
+0x16457117, 0x385FFF08, 0x0008C629, 0xD0010754, 0x28700000, 0x03014803, 0x14010093, 0xDD00F24A,
+0x34FFCDD1, 0x37FF030A, 0x9FFF030C, 0x017C808B, 0xFFF7FE61, 0x5CCCD4E7, 0x228C001A, 0x6E7D9E32,
+0x140012BC, 0x10290013, 0x0126D400, 0x48000004, 0x00040004, 0x00055400, 0x0C000004, 0x00E20000,
+0x8207EC00, 0xC2E1FFF2, 0x092FFFAD, 0xB7321988, 0x04FC9396, 0xD102B901, 0x244AFFF7, 0x1044FF18,
+0x1038FF03, 0x100C1804, 0x040F47F5, 0xE1050099, 0x00110300, 0x01022400, 0xF55100BC, 0x46546EFF,
+0x253219D8, 0x27300001, 0x00051801, 0x04030100, 0x002C0004, 0x98F7FB21, 0x0FD80001, 0x002F5520,
+0x028A0037, 0x0101E803, 0x1000005C, 0xFFF73000, 0x62254C32, 0x6EFF0A18, 0x13C43B49, 0x00101400,
+0xDC0000BF, 0x00EC0000, 0x0102D800, 0xD00012B8, 0x19040000, 0x0006B400, 0xFB120849, 0xE5D02EB4,
+0x0C3DFFE1, 0x0C3CFF04, 0x6B8DFF00, 0x280017A0, 0xFFFA9114, 0xFF979BBE, 0xDC030734, 0xA5C43123,
+0x0101D4A2, 0xD70005D8, 0x01DD0103, 0x0000B000, 0x0404000D, 0x011B0200, 0x00009601, 0xA4002FEC,
+0xE7EC6100, 0x00062CFF, 0x00012408, 0x00900028, 0x00003C00, 0x2000003B, 0x06DA0100, 0x0005F800,
+0x28030004, 0x00070F01, 0x00A40175, 0x0002AE00, 0xC4040004, 0x01440003, 0x0B0A000F, 0x06043C00,
+0x00000004, 0xFFE2B109, 0xFF6AA9CA, 0xFF409DC9, 0x000500DA, 0x4F031A94, 0x06080101, 0x0000F104,
+0xEB110148, 0xBB750A00, 0xB6FF4699, 0x05004F90, 0x00013300, 0xFA1154F0, 0xD8000EC0, 0xDA0DF309,
+0x3494C6FF, 0x35A6DEFF, 0x63BBE3FF, 0x78BDDEFF, 0x7FBCDBFF, 0x82B9D7FF, 0x04B7D6FF, 0xB905F000,
+0xBAD4FF80, 0xBBD0FF7E, 0xBAD2FF7E, 0xBAD6FF7E, 0x10D6FF7D, 0xBA06F000, 0xBBD4FF86, 0xBCE2FF7D,
+0xA2C9FF64, 0x90B0FF46, 0xF5FFFF47, 0x70003268, 0x00E804FC, 0x00019002, 0x040001CC, 0x00800000,
+0x0301AF01, 0xB2000114, 0x05000000, 0x00000400, 0x9C01E4A4, 0xFB02F003, 0x0724FFFA, 0x143DFF02,
+0x3B5DFF05, 0xFEFFFF2B, 0x3E0005FC, 0x03540000, 0x00004200, 0xAC0000E0, 0x11BC0004, 0x146BFB11,
+0x00025001, 0x1B0007FB, 0x005C0000, 0xF7FB03F2, 0xA0ACC6FF, 0x000D30FF, 0x03082EFF, 0xB9BAD8FF,
+0x20040520, 0xFAFE7009, 0x7C85A4FF, 0x6025C4FF, 0xFF010B2E, 0x1520D3E8, 0x0498FB11, 0x05009400,
+0xC70100A4, 0x007C0000, 0x00056802, 0xC9310018, 0x2614A7AC, 0x33003800, 0x7DA6ADC7, 0xFFFB9205,
+0xFF4F5875, 0xE4071437, 0xE6EC220C, 0xD4011E70, 0xFE6C0005, 0x0205B000, 0xD4003560, 0x0D740001,
+0x0100CA00, 0x71041E60, 0xFA02F000, 0xAAC7FFF7, 0x0B38FFA6, 0x0732FF08, 0xC6DAFF04, 0x0C021DA8,
+0x01180003, 0x48517890, 0x061242FF, 0x03EC26FF, 0x011C8400, 0xFC0030FC, 0x00240407, 0x0000F900,
+0xB0000101, 0x03940000, 0x0AA8F411, 0x07184660, 0x203C62FF, 0x0274000E, 0x00051800, 0x08000020,
+0x03DD0100, 0x00042903, 0xFB11133F, 0x68001D14, 0x0D3A7130, 0x89A0FF02, 0x00053481, 0xC3502CC4,
+0x31FFA8B0, 0x05F31050, 0x38FF091A, 0x2CFF0214, 0x2CFF000A, 0x2AFF040A, 0x2CFF0609, 0x2A660004,
+0x28FF0808, 0x00000409, 0x2D800018, 0x28FF050B, 0x14FF000A, 0x1535710E, 0x193EFF00, 0x20290805,
+0x2398698B, 0x00008400, 0x01F00440, 0x284CFFF3, 0x1344FF18, 0x1A40FF03, 0xF7FFFF0E, 0x1F042F58,
+0x00D0000A, 0x01000404, 0x2001018D, 0x01CD0205, 0x7BFFF491, 0x3AFF5361, 0x1E10060F, 0x00190401,
+0xF40001A1, 0x01540004, 0x00010F00, 0xFCE3000C, 0x1131FFF6, 0x153EFF04, 0x3052FF06, 0x000B8E23,
+0x58040338, 0xFFFB5100, 0x58D7E1EB, 0x2D280006, 0x00167401, 0x08612998, 0x082FFF05, 0x01407806,
+0x0FF100EC, 0x28FF010C, 0x27FF000D, 0x25FF000D, 0x26FF000E, 0x22FF020E, 0x2AFF0007, 0x2CFF0009,
+0x24900007, 0x0C1647B2, 0x0C1649FF, 0x2D375AFF, 0xFFA1013C, 0x6E92FFF8, 0x1240FF66, 0x3200A40B,
+0x2CD2D6F3, 0x007B002A, 0x00020100, 0xB4010004, 0x01940005, 0x00039000, 0xD0020019, 0x001B0001,
+0x00000400, 0xF0000C22, 0x0B2FB500, 0x1743FF01, 0x4665FF0A, 0x000A5C3D, 0x500000EF, 0x02200002,
+0x00070C00, 0x34000348, 0x00040000, 0x0F010300, 0x00720004, 0x76030188, 0x00A00001, 0x0000B402,
+0x000F028C, 0x38000C05, 0x00040000, 0x0000CD01, 0xE5B103DD, 0x6AA9C8FF, 0x3E9EC8FF, 0x1900D9FF,
+0x00FBED11, 0x040A0001, 0x30000500, 0x00040000, 0xFFF0FFD0, 0xFF9EE0FA, 0xFF4599BB, 0x4B5C92BA,
+0x030F0000, 0x7001139C, 0x01680001, 0xFFFB0AF1, 0xFFCDEDFA, 0xFF419CC8, 0xFF33A5DB, 0xFF40A2D1,
+0xFF3C94C2, 0x9C3E94C3, 0xC027F050, 0xBEFF4297, 0xC3FF4297, 0xC5FF4497, 0xC1FF4397, 0xBFFF4099,
+0xBFFF4199, 0xBFFF4497, 0xC0FF4597, 0xC0FF4698, 0xCCFF3D96, 0xC7FF3AA1, 0xB1FF3DA0, 0xFFFF4392,
+0x002C7CEC, 0x85001E50, 0x00040200, 0x0000BF00, 0xE200036A, 0x000C0001, 0x00010001, 0xFC01001B,
+0x02E80007, 0x0010C000, 0x9400001A, 0x35080000, 0x23FFFBC0, 0x3CFF0003, 0x6EFF0214, 0x2015EC4D,
+0x3E04FFF5, 0x01004005, 0x0E000041, 0x00040000, 0xFDFFFC30, 0x3F000E68, 0x086F0000, 0x0009FC01,
+0x01F2005D, 0xB3D0FFF9, 0x0A2FFFA5, 0x1035FF00, 0xB8D3FF08, 0x2C001400, 0x0A740001, 0xF0068A00,
+0x7F88A700, 0x051139FF, 0x000529FF, 0xCCD2EAFF, 0xFC01055D, 0x01550130, 0x00033800, 0x73010047,
+0x00680203, 0x00000600, 0xCA71310C, 0x32FFA7AC, 0x16F00009, 0xA2A9C630, 0x55000439, 0x6AFF4128,
+0x0500444D, 0xA0042720, 0x0104002C, 0x0002D000, 0x04000036, 0x00DC0000, 0x00005103, 0xB0030472,
+0x00CB0000, 0x00175801, 0xFF610009, 0xB9CCFFFB, 0x6014F8B2, 0xFF040933, 0x064CC9DC, 0x0A78FE12,
+0xFFFBFD70, 0xFF454E77, 0x2A100DC4, 0xEC010060, 0xB8FB1119, 0x021A00F3, 0x000D2C00, 0xAC0006D8,
+0x00DC0017, 0x21000401, 0x2308F9FE, 0x33143400, 0x9025395E, 0x01250003, 0x04047800, 0x5402008C,
+0x0114023B, 0xE1FFFE70, 0x35FFC9CE, 0x10622E64, 0x8DA7FF03, 0xF11DAC87, 0xFFFCFE0F, 0xFFA7AEC0,
+0xFF000A31, 0xFF061B48, 0xFF051B44, 0xFF011339, 0xFF051137, 0x44071037, 0x01480001, 0xB1236000,
+0xFF080F39, 0xFF080F3D, 0x5C07103B, 0x0F33B124, 0x1336FF05, 0x1134FF06, 0x00068C03, 0x2D102D70,
+0x5D1027B8, 0x14000C2C, 0x011C0001, 0x46FFF0D1, 0x41FF1225, 0x3BFF0116, 0x01500717, 0x00001600,
+0xE60200D0, 0x168C0006, 0x00001200, 0xD20000B4, 0x00080003, 0xF0001000, 0x76FFF502, 0x42FF4E5C,
+0x35FF0911, 0xFFFF0206, 0x0BB5EEF0, 0x00070B01, 0x2A00015F, 0x04180000, 0x23239800, 0x0500122D,
+0xC1223120, 0x2688011D, 0x22013400, 0x38D0FDF7, 0xC3CDD7B1, 0x000D31FF, 0x0B1D4DFF, 0x3A712C64,
+0x36FF0211, 0x00040410, 0x000A9400, 0x64000004, 0x2EB4002E, 0x00001C00, 0xCC000004, 0x0C326000,
+0x193DFF00, 0x02114B5C, 0xA8000040, 0x063C002D, 0x84224120, 0x1F1800CE, 0x51050000, 0x0C3FFF64,
+0x201F3802, 0x58F4E0FC, 0x0013DA02, 0xA8020F00, 0x01080400, 0x0000D400, 0x9C00019C, 0x0FA70005,
+0x00083C02, 0x240000A8, 0x13373215, 0x22320009, 0x0FA03F48, 0x00010700, 0x3C010004, 0x00440002,
+0x01003000, 0xC3010011, 0x01000202, 0x7000060F, 0x00009303, 0x000F00DE, 0x25001705, 0x00040303,
+0x00012501, 0xE351034C, 0x69AAC6FF, 0xDA17136C, 0xFF000500, 0x00230000, 0x01000404, 0xFF610201,
+0xDFFAFFF2, 0x000F009F, 0x3C003230, 0xECFF1028, 0x0C380118, 0x01012C02, 0x0FF1011A, 0xC1FFD9F5,
+0xDAFF3F96, 0xE7FF37A5, 0xF0FF5EBB, 0xEEFF75C8, 0xEEFF77C4, 0xE6FF7CC7, 0x000476C5, 0xC2EA18F1,
+0xC1EBFF7A, 0xC3EBFF7A, 0xC5E9FF78, 0xC3E5FF79, 0xC2E5FF7D, 0xC0E6FF7E, 0xC2E9FF78, 0xC9ECFF77,
+0xC2E1FF79, 0x200A0C77, 0x1440F9FF, 0x00056800, 0x040200F5, 0x00980000, 0x0205000F, 0x03001F00,
+0xF6110F8C, 0xFC000D90, 0x08100001, 0x27FFFBC0, 0x42FF0005, 0x5BFF0617, 0x0003B837, 0xE8023038,
+0x02340018, 0x0000B801, 0x94002EEC, 0x05CC0013, 0x3005FC00, 0xDCFFFEF9, 0x01640204, 0x51243400,
+0xA7C7FFF4, 0x001D549A, 0xD43143FC, 0x0838B4BA, 0x00008C00, 0x20000226, 0x7F9E3104, 0x752D3476,
+0xFF00082D, 0x20D0D4ED, 0x19440200, 0x00028002, 0x440009BF, 0x02B20003, 0x6112CB01, 0xC2FFFFFE,
+0x26789DA2, 0x012FA400, 0x28000500, 0xFCFE2135, 0x38500A00, 0x28FF0815, 0xED1004A0, 0x6C001028,
+0x0092001D, 0x10017000, 0x0A00B2FC, 0x17003FC0, 0x048F0000, 0x01366C00, 0x00F35D98, 0xA5B8FFF9,
+0x0E39FF9D, 0x0733FF05, 0x00DDFF00, 0x0090012D, 0xFFFCFEC0, 0xFF444D74, 0xFF050F40, 0x0003EC2B,
+0xFF103869, 0x3C002EFE, 0x06440006, 0x001B2200, 0x55000A0C, 0x00040300, 0xA4F9FE21, 0x13416419,
+0x3961FF01, 0xD1013FF8, 0x03610205, 0x000E0301, 0x52020A94, 0x01410001, 0xCDD2E650, 0x2C7434FF,
+0x20041121, 0x0128002E, 0x31010000, 0x00AAB0C0, 0x4630F105, 0x7AFF0416, 0x9DFF3D50, 0x95FF6979,
+0x93FF6A75, 0x93FF6B74, 0x95FF6A75, 0x95FF6875, 0x97FF6B74, 0x9AFF6B73, 0x98FF6A73, 0x97FF6A74,
+0x91FF6C77, 0x91FF6A75, 0x8FFF6C76, 0x99FF6972, 0x00286E7C, 0x69729171, 0x9A9EB7FF, 0x5C000170,
+0xFF00F100, 0x44FFF3FF, 0x40FF1124, 0x3AFF0016, 0x04A00214, 0x00CDAC00, 0x92000FAC, 0x00040215,
+0x000B8006, 0x380202F0, 0xFFF7B000, 0xFF505C74, 0xFF0A1241, 0x100B1430, 0x020674F3, 0x60000255,
+0x0405020B, 0x2113B000, 0x0500FFF5, 0xFF041641, 0x00050052, 0xDC000052, 0x01D60037, 0xF3020E00,
+0xEBFFFC46, 0x32FFD8E0, 0x45FF000B, 0x66FF0212, 0xA5FF2B39, 0x96FF707E, 0x92FF6976, 0x94FF6977,
+0x96FF6C75, 0x98FF6C75, 0x99FF6C74, 0x9BFF6C74, 0x9BFF6B74, 0x98FF6975, 0x97FF6875, 0x93FF6978,
+0x8FFF6677, 0x93FF6475, 0x96FF6979, 0x90FF6B79, 0x9EFF646C, 0x08F27E84, 0x9BFFF951, 0x0F146D77,
+0x20328C00, 0x4EB8DFF9, 0x020CB800, 0x1E0001B4, 0x00A80202, 0x0001B400, 0xA003000E, 0x00C70001,
+0x02021C03, 0xF91100FA, 0x3B750CAC, 0x70FF000B, 0x0500444C, 0x0602D000, 0x35000040, 0x04340300,
+0x03000B03, 0x070F01DA, 0x8C036B00, 0x00DE0000, 0x1905000F, 0x0000DC00, 0xF0020004, 0x0A300001,
+0xCAFFE1C0, 0xD0FF68AA, 0xE0FF3E9C, 0x022300B3, 0x20020F00, 0x0B340000, 0x00012A00, 0xEF000066,
+0xFFF02000, 0xBD311E00, 0x37384898, 0x00FFFF20, 0x295C000A, 0x00001C00, 0x68040091, 0xE401F001,
+0x3A91BEFF, 0x38A1D1FF, 0x8CD7F4FF, 0x20FFFFFF, 0x13E8005C, 0x0027E800, 0xE0000008, 0x41740036,
+0x0004D400, 0x040022F4, 0x00100000, 0x00000404, 0x2C000010, 0x027C003C, 0x00002400, 0x58000004,
+0x01880345, 0x0603F601, 0xD00501EC, 0x00830000, 0x0304B100, 0xE4010500, 0x04CC0006, 0x61050800,
+0x46FFF7F9, 0x26881E24, 0x012B3800, 0xE4002660, 0x21570004, 0x211BF700, 0x405CFDFC, 0x01032000,
+0x4C013A8C, 0xA8FF1100, 0x18FF0046, 0x00226A00, 0x9331040E, 0x34AC6372, 0x311D0400, 0xE0B5BCD6,
+0x0C240009, 0xF1033C01, 0xFFF7FE03, 0xFF7A83A2, 0xFF030C35, 0xFF070C32, 0x90C1C5E0, 0x00A00003,
+0x00047001, 0x0D001520, 0x005C0000, 0x00009800, 0x0C001160, 0xFFFD6100, 0x8589AEFF, 0x31312678,
+0x3B80010A, 0x00141400, 0x00000054, 0x31D40014, 0x050D3471, 0xAEB3D1FF, 0x880016E8, 0x00040603,
+0x0118F802, 0x5C0306A0, 0x0ABC0000, 0x00009402, 0xF69103A8, 0x5B6580FF, 0x071240FF, 0xDF2035B4,
+0x112E78CB, 0x00474EF6, 0x71310488, 0x05B04651, 0x10375000, 0x0328FCFF, 0x50000044, 0x014B0000,
+0x01066404, 0xAC000210, 0xFAFCE100, 0x050C28FF, 0x061745FF, 0x283A62FF, 0x8C000F90, 0x02220000,
+0x00452C00, 0x040017B7, 0x00380500, 0xFFFDFA92, 0xFFCDCFE4, 0x37200734, 0x838EA241, 0x612E64FF,
+0xE0FFF9FE, 0x0380CCD2, 0x010F4072, 0x6A769CFF, 0xB40122FC, 0x00690015, 0x08005200, 0x92000004,
+0x3C70000A, 0x0011B400, 0xD40007B8, 0x0004000B, 0x001CCC00, 0xC900069C, 0x010C0301, 0xF1028F00,
+0xFFF6FF01, 0xFF162743, 0xFF031847, 0xFF0B1C47, 0x00C7D4FF, 0x5C0002A0, 0x04A00000, 0x0105E406,
+0xF8000C33, 0x00040000, 0xFFF7FF62, 0x30545F71, 0x01065033, 0x84F4FFFF, 0x04350002, 0x0210E500,
+0x3800003C, 0xE7040001, 0x00229800, 0x53103170, 0xB8010F00, 0x02A00300, 0x01025800, 0xFB110055,
+0x45722028, 0x68FF040F, 0x14003440, 0x00136400, 0x0C010830, 0x0029000C, 0x01063100, 0x40020247,
+0x01750006, 0x00004C00, 0x50002EF4, 0x10940012, 0x00189800, 0xA0000038, 0x00830001, 0xFEFC04F0,
+0x989EBEFF, 0x030F37FF, 0x000F33FF, 0x96A4BEFF, 0x0009CCFF, 0xCC000408, 0x00430007, 0x01010301,
+0x900246F4, 0x01C00405, 0x01031400, 0x03F1021C, 0xFEFFFAFB, 0x38FFE3E8, 0x4BFF0007, 0x6CFF0B17,
+0x06244048, 0x00003800, 0x24010176, 0x02A40100, 0x06007100, 0x200000D8, 0x00040F00, 0x013B0372,
+0x0000AC00, 0x940200F8, 0x04D00000, 0xD2FFE4B1, 0xD1FF71B2, 0xCDFF3CA0, 0xD0024B00, 0x0C8C0204,
+0x0604D000, 0x38020004, 0xFFDFC030, 0xFF68AACC, 0xFF409BD2, 0x1900B2E2, 0x02FBEB10, 0x0105FF02,
+0x0004019B, 0x01080005, 0xFDFFF0C4, 0xBEFFA1DE, 0xB6FF4997, 0x060F0093, 0x34000500, 0x2D330001,
+0xE04B1400, 0xFF54A6CE, 0xFF3EA0CD, 0xFF61ABC6, 0x605CFFFF, 0x1308F413, 0x0000B200, 0x54030994,
+0x02740001, 0x01000400, 0x640000C1, 0x02DC0000, 0x0300C800, 0xFC100004, 0x700213A8, 0x1633008C,
+0x01002701, 0xDC0001CD, 0x00240006, 0x00052C00, 0x60001950, 0x0528001E, 0x4A68F711, 0x0104C800,
+0x4C0010E4, 0x026C0017, 0xFEFD03F1, 0x646786FF, 0x06113FFF, 0x000532FF, 0xC2C7DDFF, 0xEF000109,
+0x26EF0009, 0x00005300, 0xC4000087, 0x00040000, 0x00280400, 0x88010109, 0x00750146, 0x5100B400,
+0x163DFFF6, 0x0043F407, 0xD22039BC, 0x0041F8BB, 0x21000990, 0x00BC0000, 0xB7FFFB51, 0x0EC4919A,
+0x002D0000, 0x54011DD4, 0x05B00148, 0x0040F803, 0x4B000065, 0x00940000, 0x00007500, 0xF8610037,
+0x688EFFF9, 0x001BE863, 0xC83135D8, 0x04E8A3AD, 0x31269000, 0x08C2CADF, 0x2AE0002B, 0xA44C7220,
+0x003D004D, 0x0000BB01, 0x5F000346, 0x000D0209, 0x00010F00, 0xE301005C, 0x03E00003, 0x00001100,
+0x01F70120, 0x1135FFF7, 0x154AFF07, 0x0836FF0B, 0xCDE0FF00, 0xFDD00500, 0x506EFFF8, 0x133BFF45,
+0x0326FF07, 0x440217EC, 0x00970004, 0x00000404, 0x04000350, 0x010C0000, 0x51001402, 0x0E2AFFFC,
+0x313A5807, 0x34273661, 0x14700003, 0x00006A00, 0xDE0004A2, 0x00040001, 0xC8E0F713, 0x31003400,
+0xB0CBCCE1, 0x32300031, 0xC48B9C20, 0x002A0008, 0x1101E800, 0x310ED0F8, 0x70071142, 0x5380011D,
+0x00331803, 0x040001BC, 0x06080100, 0x01CEFE10, 0x03068200, 0xA8000556, 0x01D8000F, 0xFEFF00F1,
+0xB8BAC9FF, 0xB3B4C8FF, 0xADACBEFF, 0x003429FF, 0x540000F7, 0xF7FFA101, 0x132440FF, 0x001443FF,
+0xA00133B0, 0x029D0054, 0x00012403, 0xA80001B2, 0x00520100, 0x00003000, 0x04000018, 0xF9FF7000,
+0x535B70FF, 0x410F74FF, 0xFF02072F, 0x78041400, 0x00280004, 0x00000400, 0xFD610418, 0x1134FFF5,
+0x050ED804, 0x1C001900, 0x00440000, 0x01000400, 0xFBC0000C, 0x252A52FF, 0x0C1445FF, 0x2C0631FF,
+0x27600024, 0x0100A100, 0x4C010542, 0x0527011E, 0x00001300, 0x0800008D, 0x1C4C0000, 0x0000A800,
+0x03F200A1, 0xC9FFFEFE, 0xA8FFBABC, 0xA0FF9497, 0xF1FF8C8F, 0x0039E2E4, 0x4024E400, 0x28FFDBE1,
+0x19623DA8, 0x4963FF09, 0x101A3C39, 0x020FD4FF, 0x78000547, 0x00430001, 0x00041C00, 0x0C000004,
+0x03D50000, 0x02014600, 0x01F00045, 0x90B0FFF9, 0x0D3FFF8A, 0x1041FF01, 0x4A68FF02, 0x98002300,
+0x06180201, 0x00030400, 0x38010030, 0x00CC0000, 0x01000404, 0x050F0011, 0x0C016C00, 0x00C6024E,
+0x0005D000, 0xB0020228, 0x042C0000, 0xD0FFE4C0, 0xD0FF6EB0, 0xD1FF399F, 0x116400A5, 0x01244BEC,
+0x7B000110, 0x0378041C, 0x00033E01, 0xE2C00430, 0x67A6C9FF, 0x459AD1FF, 0x00AFDEFF, 0x1AEB1128,
+0x018F0000, 0x004CC800, 0x020001CB, 0x010C0205, 0xFFFFEEC0, 0xC0FFA2DD, 0xB1FF4D98, 0x1222D88E,
+0x002800CE, 0x52000210, 0xFBFD2208, 0x03F1186F, 0xF0FFF1FF, 0xC1FF8ED0, 0xBBFF3E9A, 0xFFFF3F97,
+0x3720B4F6, 0x00090402, 0xB20030A7, 0x2C3B0000, 0x00037000, 0xFE201AF0, 0x021B17FF, 0xC8000064,
+0xFFD8C004, 0xFFA9E0FE, 0xFFACDEF7, 0x2F2CECF8, 0x01189002, 0x0501022C, 0x009E0000, 0x51037200,
+0xC0DCFFE5, 0x734B8C7F, 0xFF4496BC, 0x407ABDDA, 0x32AC0041, 0x001D0A00, 0xC50100BE, 0x1D2D0005,
+0xEAFF01F2, 0x37FFD7D5, 0x41FF0008, 0x50FF030F, 0x04642C33, 0x0001D800, 0x2B000278, 0x00040000,
+0x0024FC00, 0x3703F7C8, 0x1DA00200, 0x5107FC00, 0xA0BAFFFD, 0x003E4C99, 0x337134F4, 0xCCFF0210,
+0x09E0B1B9, 0x20042000, 0x0884F8FD, 0xE2FFFE51, 0x1D20C2C8, 0x020B3260, 0xFC6A89FF, 0x00A80005,
+0x024C1000, 0x48010F4C, 0x00F70004, 0x01006803, 0x03F30974, 0x3CFFF9FE, 0x49FF0814, 0x39FF0A18,
+0xC7FF000D, 0x0CE89EA9, 0x5108E000, 0x1631FFF6, 0x0011A40C, 0xFA321344, 0x5170E1E3, 0x0500AC03,
+0x130001AD, 0x00C80001, 0x00034001, 0x0D0001B2, 0xF805F000, 0x848DAAFF, 0x030E3CFF, 0x0D1752FF,
+0x000536FF, 0x94C9DCFF, 0x1244000A, 0x31002002, 0x3C475476, 0x002B1118, 0x0A300005, 0x00011100,
+0x440002E0, 0x70000205, 0x0000E000, 0x72020012, 0xFFF85102, 0xF8030E2A, 0x3A65312B, 0x0030F82B,
+0xFC000284, 0x0B28012C, 0x0038FD12, 0x01009F00, 0x03F20034, 0xE2FFFFFE, 0x2FFFCDCE, 0x3DFF0004,
+0x9FFF0613, 0x30A0848C, 0xF008DC00, 0xFFF6FF02, 0xFF5A6082, 0xFF050C3A, 0xFF030A38, 0xE5849EC2,
+0x00051800, 0xFB110E4C, 0x140115A0, 0x097F0002, 0x004EC801, 0xE9000F8C, 0x03A80000, 0xF8FFF991,
+0x20FFDCE2, 0x41100003, 0x13173232, 0xD70000AD, 0x09010100, 0x42FFF5D1, 0x40FF1227, 0x40FF0017,
+0x05A80518, 0x01030401, 0x050100DF, 0x009F0100, 0x00004E00, 0x68010004, 0x014D0100, 0x79FFF8B0,
+0x47FF515A, 0x33FF0B10, 0xF31037B4, 0xFC120760, 0x37001530, 0x00040000, 0x5202F000, 0x34FFF6FE,
+0x20500013, 0x3B4C2F56, 0x02009400, 0x3D01069C, 0x0101002A, 0xFCFE03F2, 0x9197B1FF, 0x020A2FFF,
+0x050D3EFF, 0x60658FFF, 0x78000274, 0x10FD1052, 0x04AC0294, 0x01078400, 0x4800007B, 0x02180025,
+0x00009A00, 0xFAC003A8, 0x0627FFF9, 0x082BFF03, 0xA01BFF04, 0x01340101, 0x01001D01, 0x4D311578,
+0x208C222D, 0x000C2D60, 0x8CDAEDFF, 0x026C020D, 0x00019000, 0x3401007F, 0x00B00149, 0x020CC800,
+0x5E020158, 0x343C0051, 0xFFF401F0, 0xFF07143E, 0xFF081643, 0xFF021138, 0x0A004F66, 0x00004000,
+0xC4020544, 0x006A0001, 0x00013401, 0x4803004D, 0x00140100, 0x6D00050F, 0x0309FC00, 0xBC000128,
+0x04FC0001, 0x0020F002, 0xE3510C1C, 0x73B5D7FF, 0xD0200500, 0x1131A4A4, 0x020363EB, 0x7402066D,
+0x04880209, 0x00022900, 0xE2D50428, 0x69A8CBFF, 0x459AD0FF, 0x68B2DFFF, 0xCC003700, 0x00F70002,
+0x0000EB02, 0x40000E7C, 0xFFED9301, 0xFFA1DDFF, 0x004693BD, 0x0500000A, 0xFCFFEE30, 0xC1010BA4,
+0x360C0001, 0x00003200, 0xD911020C, 0xCC732D24, 0xCBFF449F, 0x5F2453A2, 0x00057000, 0xC7000048,
+0x00800026, 0x00015500, 0xC4000374, 0x0018000C, 0xF6009000, 0xCBFFDD02, 0xB7FF69AB, 0xA8FF4290,
+0xFFFF4486, 0x1098D8F4, 0x00003300, 0xF001005F, 0xEA09F03A, 0x75ABC3FF, 0x3E99C5FF, 0x38A7DCFF,
+0x37A6DDFF, 0x3D9CC8FF, 0x28AAC2FF, 0x0F64002F, 0x00289800, 0xF5000440, 0x04CD0305, 0xFFFDFB61,
+0x902E335B, 0x3FA0003A, 0x038CA310, 0x0209FD01, 0x900002B8, 0x0DBC0135, 0x0208BC03, 0x1C000206,
+0xFC02F100, 0xEBEDFFFF, 0x030B30FF, 0x03194BFF, 0x041B4DFF, 0xD02021B8, 0x1032D4BE, 0x0218BFFF,
+0xA0010984, 0xFFF89135, 0xFF010A29, 0xCC0E1A42, 0x330C013E, 0x00356801, 0x990001B5, 0x00F0000F,
+0x03175300, 0xFE830098, 0xA7C3FFFB, 0x2838FFA0, 0x0B367112, 0xB3D1FF00, 0x110E0CA8, 0xF00D04FC,
+0xA8FFFB04, 0x3AFF8E95, 0x43FF010E, 0x3BFF0916, 0xFFFF171E, 0x240034FC, 0x1449000D, 0x00014300,
+0x040401A9, 0x03380000, 0x7003A000, 0xF4FFF8FF, 0x2CFFDCE5, 0x1346E018, 0x124AFF09, 0x0F3DFF07,
+0xCFE0FF04, 0xFB121900, 0xFF61498C, 0x4E71FFF9, 0x0A46FC40, 0xFA000500, 0x05440000, 0x0037BC00,
+0x75004BE0, 0x00690001, 0xC201A400, 0x0C2CFFF6, 0x1448FF00, 0x3A67FF07, 0xF7111C90, 0x7F025098,
+0x00870004, 0x02003E00, 0xF4020638, 0xCFE33100, 0x0017A8CE, 0x9F31412C, 0x00DC8389, 0x001C7C00,
+0xFFB11050, 0x2CFFE2E8, 0x45FF0106, 0x46481115, 0x08EBFF20, 0x03880025, 0x00006C00, 0xC40002DE,
+0x03940001, 0x68FFFF21, 0x43C00100, 0x914F2800, 0x2B4FFFF6, 0x143AFF23, 0x323CD808, 0x4DADB2CF,
+0x02240004, 0xD000AB00, 0x3DFFF5FF, 0x40FF0D22, 0x3DFF0018, 0x10230018, 0x000405F8, 0x050200C9,
+0x00240003, 0x01009F02, 0x620002BA, 0x0094020A, 0xFFF701F0, 0xFF51597D, 0xFF070C46, 0xFF02053A,
+0x02B4F5FF, 0x0006C003, 0x5C010696, 0x0B650005, 0x24E4F611, 0x07154671, 0x202D57FF, 0xF94123D4,
+0x48FFF7FD, 0x0105022A, 0x0107E900, 0x00F10578, 0xFF040B27, 0xFF111747, 0xFF000735, 0xDCB7BDD5,
+0x00700024, 0x0216A002, 0x6801008F, 0x30FC1004, 0x02180050, 0xF1081400, 0x6EFFF902, 0x3AFF4B50,
+0x33FF0C0F, 0x9CFF060B, 0x04F47B82, 0x0005A802, 0xF75100B9, 0xAFB9D4FF, 0x38A04798, 0x3EFF0715,
+0xFFFF1321, 0x000FACFC, 0xCC030138, 0x00EE037B, 0x00003402, 0x98000119, 0x015C0003, 0xFFF405F0,
+0xFF445277, 0xFF061445, 0xFF0B194A, 0xFF04133A, 0x0A004E65, 0x02044000, 0x3B010040, 0x01240300,
+0x01009C01, 0x050F0011, 0x60007400, 0x00040001, 0x0100A000, 0xB4040353, 0x01000000, 0xD5FFE3B1,
+0xCFFF71B1, 0xCFFF399D, 0x54000A00, 0x01300027, 0x000B2300, 0x270208C8, 0x04E00002, 0xE3039C01,
+0xCCFFDDFF, 0xD0FF66AB, 0xDEFF419D, 0x27A460B1, 0x000C1600, 0x650001E4, 0x02840000, 0x000E5402,
+0xFF730ED8, 0xC4FF9FDF, 0x1E004899, 0x60189804, 0xFEFAFFFC, 0x594AFFF8, 0x02002E00, 0x05F00828,
+0xD6F3FFED, 0x95CAFFA9, 0x98D0FF45, 0xA5CBFF3F, 0xFFFFFF5D, 0xE4001AA8, 0x01680013, 0x0002D400,
+0x6C0009A4, 0x08900000, 0x51026800, 0xB3DAFFDE, 0x601E2C69, 0xFF4799C8, 0x2B2CC5E7, 0x0933F011,
+0x00017A02, 0x040000F1, 0xFFF05100, 0x24C9FBFF, 0xDB07F005, 0xE4FF41A4, 0xE4FF35A5, 0xDCFF32A5,
+0xB3FF3DA5, 0xFFFF418F, 0x000DE4F3, 0x69000050, 0x04C00009, 0x0002B900, 0xFB51000C, 0xEEF4FFFF,
+0x38313C00, 0x2BC80B13, 0x2022B000, 0x07E4F9FF, 0x02587A02, 0x340000C4, 0x00980000, 0xD1193800,
+0xDAF8FFF8, 0x0E38FFD5, 0x1445FF09, 0x91362C0A, 0xFF051A47, 0xFF020F32, 0x213700CF, 0x6090FFFD,
+0x01012B00, 0x02F2047C, 0x5B74FFF9, 0x0D37FF51, 0x103EFF01, 0x5277FF05, 0x0031244A, 0x980118D0,
+0x01AC0004, 0x00028800, 0xF93032D0, 0x005CFAFF, 0xFF020AA1, 0xFF0B184D, 0x100A1A4D, 0xAEC92018,
+0x80004B00, 0x00F60000, 0x51018800, 0x294AFFFA, 0x60407020, 0xFF05133A, 0x30EC304F, 0x097CEF11,
+0x20016C00, 0x0D58FBFA, 0x00008100, 0x600200B8, 0xE3F93100, 0x0021A0D8, 0x04003F10, 0x0A5C0045,
+0x00093150, 0x4B14D6FF, 0x00070D01, 0xFB510148, 0x424F6FFF, 0x2C101D6C, 0x4001325C, 0x05CB023C,
+0x00147C00, 0xFC000758, 0x0B730109, 0x00030501, 0xF711005C, 0x467158F8, 0x66FF0510, 0x00842D38,
+0x00002800, 0xA0000024, 0x00860010, 0x00050000, 0x330100BA, 0xFFFC6100, 0xCDCDE5FF, 0x3D7009E0,
+0xA6FF060E, 0x018D8589, 0x38D4FF10, 0xF2090202, 0x98FFF806, 0x37FF757C, 0x48FF0307, 0x31FF1215,
+0xECFF060B, 0x132CCED4, 0x44F9FF23, 0x002E0040, 0x000C3400, 0x8400025E, 0xFFF89100, 0xFF333661,
+0xE805083B, 0x42613346, 0x03061439, 0xDB000815, 0x0F000000, 0xFF1628A1, 0xFF011740, 0xA807193F,
+0x00900014, 0x0100A000, 0x24000410, 0x03170300, 0x00005600, 0x4C0000C4, 0x41C40001, 0x545B78A0,
+0x0A0D42FF, 0x000435FF, 0x46EF1105, 0x00380013, 0x01000400, 0xE8002C9C, 0x64000101, 0x49FF0880,
+0x5BFF0915, 0x001E002F, 0x4A000458, 0x1AE40000, 0x00014404, 0xF9800065, 0xAFB8C9FF, 0x64052AFF,
+0xFF0AC04D, 0xFF000629, 0xFFA7B1CA, 0x0984FBFF, 0x04003000, 0xA00054DC, 0x01F40004, 0x51021C00,
+0x5573FFF5, 0x7224F44A, 0xFF0A113B, 0xF4171D41, 0x44FE1038, 0x0054005C, 0x00021402, 0x6C313034,
+0x47F44550, 0x050E37A0, 0x21294EFF, 0xD0F7FFFF, 0x02B80041, 0x7194A400, 0xFEF7FFFE, 0xCCF5FFF9,
+0x0014003E, 0xF0036800, 0x7DFFF709, 0x37FF535C, 0x47FF0009, 0x50FF040F, 0x46FF0B15, 0x6AFF0814,
+0x02230047, 0x20010398, 0x01C10001, 0x04006B03, 0x48060138, 0x001D000F, 0x6500040F, 0x02009500,
+0x380108D0, 0x0087010B, 0xFFFFF880, 0xFFFFD8F2, 0xC02C68FA, 0xB0DBFFCA, 0xA2D3FF61, 0xAAD5FF3C,
+0xC98031A4, 0xD1F2FFFF, 0xDCF0FFFF, 0x2960002F, 0x11003100, 0x20E368FC, 0x63F4FCFF, 0xCEFFC7C0,
+0xD7FF54A9, 0xE1FF3EA3, 0x802040B2, 0xF7FFFFCC, 0xF2FDFFD6, 0x500068D4, 0xFFF4800F, 0xFFE4F8FF,
+0x781CF4FF, 0xFFD001F0, 0xFF83D5FD, 0xFF43A0CC, 0xFF4599C5, 0x2B90F6FF, 0xFFFFCF40, 0x11001CF3,
+0x0038D4F5, 0x72001060, 0x024C0115, 0xEAFF03F3, 0x7BB6E0FF, 0x4494C7FF, 0x49A0CBFF, 0x4998B9FF,
+0x0C004FE4, 0x0598002D, 0x001CD000, 0x05F009AC, 0xDFF4FFE3, 0x9DBDFFAC, 0x9DC9FF5B, 0x98C6FF49,
+0xAFD5FF44, 0x5C022B10, 0x02260041, 0x020AB404, 0x11F0035C, 0xE9FFFFEE, 0x99C5FFB2, 0xA5DDFF46,
+0xA9E8FF40, 0xA6E7FF37, 0xA4DEFF33, 0x99C1FF3A, 0xE1F9FF47, 0x00034D7C, 0x01BD0005, 0x00000401,
+0x4A000260, 0xFFF95100, 0xC8BAC2D5, 0x12394049, 0x36A8FF09, 0x25325260, 0x7CB4C4FF, 0x00F00050,
+0x00020400, 0xF8D102CC, 0xDCE2FAFF, 0x626888FF, 0x010930FF, 0xA4002588, 0x507CD009, 0x123BFF3F,
+0x0B2FFF03, 0x00D1FF03, 0x018F0023, 0x00000400, 0x90000A39, 0x0CA40009, 0xCCEFF821, 0x113EE02C,
+0x0A38FF06, 0x3E66FF02, 0xD9F4FF39, 0xBC00016C, 0xEE680003, 0x5106A800, 0x93ADFFF8, 0x3149788D,
+0xA80A1243, 0x1744312B, 0x1021D009, 0x003200C2, 0x58000364, 0x0455002D, 0xF3053801, 0x37FFF706,
+0x36FF0C1A, 0x3EFF000F, 0x2EFF0618, 0xA9FF000F, 0xDC2C8392, 0x0000B002, 0xFB712754, 0x8FFFE0E8,
+0x26786A74, 0x90172001, 0x7BFF000E, 0x43FF4554, 0x5126D014, 0xCEDEFF00, 0x000480C7, 0x9C000206,
+0x556F6214, 0x1336FF49, 0xFF104EFC, 0x14036B20, 0x05000004, 0x00030800, 0x040004D8, 0x000C0000,
+0x1001D401, 0x002D00FE, 0x07610F00, 0x303964FF, 0x211A48FF, 0x0C64FEFF, 0x0000FF00, 0xDC000448,
+0x00600108, 0xA1092C00, 0xE8FFFFFB, 0x2FFFD0CD, 0x0EE80002, 0x8586A531, 0xF840228C, 0x88FFF7FC,
+0x0A040122, 0xFFF8FF61, 0x7042466C, 0x143E3122, 0x6028040F, 0xFF5A6076, 0x0228E7F7, 0x00041000,
+0xF91100E0, 0x04F118C4, 0xFF878DA3, 0xFF0B0F32, 0xFF0D0D3F, 0xFF090B3C, 0x7C131939, 0x09BC0109,
+0x001AE800, 0x900004A5, 0xF7FF9201, 0x15233DFF, 0x14143FFF, 0x00BC0045, 0x0004BC00, 0x0400001F,
+0x07550100, 0x03000900, 0xB80000F0, 0x00240000, 0x90009000, 0xFF555C76, 0xFF0D1140, 0x100A0030,
+0x000214F7, 0x5C03023C, 0x005C0019, 0x21019C00, 0x32D4F4FA, 0x08124762, 0x002D57FF, 0xFCFB310F,
+0x0352B0F8, 0x440100F7, 0x0054045F, 0x737A9631, 0x94010248, 0x030C8147, 0x404966FF, 0x2520E8FF,
+0x00021400, 0xE4000004, 0xF502F100, 0x9EAAC0FF, 0x0F1D38FF, 0x061437FF, 0x09153BFF, 0xFF20381C,
+0x000324ED, 0x7D0002BC, 0xFFFF4000, 0x0114F8F8, 0x00009400, 0xF5510D38, 0x151E3DFF, 0x3E3114B0,
+0x02500910, 0x7B80A031, 0x7C024300, 0x005C0000, 0xF3336C00, 0xC5FFF412, 0x3CFFA7AD, 0x35FF171C,
+0x3BFF0A0F, 0x74FF060D, 0x4CFF3940, 0x40FF0A13, 0x72FF030D, 0x01CC454D, 0x00006803, 0x0404006B,
+0x02320300, 0x00050000, 0xDC010133, 0x00050F01, 0x05F80462, 0x04000800, 0xA5000B38, 0xED16F700,
+0x4489B0FF, 0x3696C9FF, 0x2F99CDFF, 0x3CAADFFF, 0x39A8DDFF, 0x34A4D4FF, 0x33A0C7FF, 0x3C99B8FF,
+0x599AB0FF, 0x15F0131C, 0x90B5FFEB, 0x95C5FF4C, 0x9CCEFF35, 0xA8DCFF32, 0xA7DEFF36, 0xA7DEFF34,
+0x9CCDFF38, 0x92BAFF3A, 0x9FBDFF40, 0x8000500C, 0xFFE5D102, 0xFF9BC6D9, 0xFF408FB8, 0xD4359AD0,
+0xD807F022, 0xD4FF33A7, 0xD0FF33A8, 0xC8FF32A2, 0xB1FF2F98, 0xFDFF3E89, 0x0026ECEB, 0xFB200660,
+0x0002DCFF, 0x94010146, 0xEBFFA102, 0x91C5DDFF, 0x3E92B7FF, 0x0400410C, 0xC214F14B, 0xDCFF3796,
+0xDEFF57B0, 0xD4FF5CB3, 0xC1FF54AC, 0xC4FF4199, 0xCAFF3E9B, 0xB6FF49A2, 0xD5FF4692, 0x6EB87FB8,
+0x0020C400, 0x5B000388, 0x03800204, 0x0000EC00, 0x28000004, 0xD70DF00F, 0x428AB0FF, 0x42A3D6FF,
+0x32A3DDFF, 0x38AAE6FF, 0x3DA1D5FF, 0x4B8CB2FF, 0x70FCFFFF, 0x04C8001E, 0x0001A500, 0x40000228,
+0x02080014, 0xC0092003, 0xE3FFF6FD, 0x2CFFC7CD, 0x33FF060C, 0x13104838, 0x001136D0, 0x41713E4C,
+0x44FF111E, 0x4850121E, 0x00063540, 0xF108B4FF, 0x0C133D00, 0x000021FF, 0xADB8D6FF, 0x94A0C6FF,
+0x2A6017B4, 0xD2FF0307, 0x083700B9, 0x9000018C, 0x029C0031, 0xE0FFF851, 0x2BA4C4D0, 0x004AB000,
+0x2A312AA8, 0x02780002, 0x2B345DB1, 0x1D294FFF, 0x01092EFF, 0x393108EC, 0x3B1C0A12, 0xC1505800,
+0xFF031233, 0xFF020D29, 0xFFA7AEC1, 0x9C0315B5, 0xE1200103, 0x512DB001, 0x3452FFF5, 0x2066B429,
+0x49A81844, 0x2FFF0040, 0x5152DC06, 0x204AFF09, 0x0022E414, 0x38404620, 0xC0FF050C, 0x072EC03A,
+0xABC7FF00, 0xA7C6FFA0, 0x4DE8FF98, 0x0153B400, 0x2C002300, 0x011B004F, 0xFFFAFDC0, 0xFF495166,
+0xFF060F2C, 0x0023601F, 0x740303B9, 0x01700400, 0x0004FC00, 0x10020004, 0x01400000, 0x29FFFBD1,
+0x3FFF070A, 0x5CFF0C13, 0x0DE02F37, 0x00001C01, 0x98000319, 0x38FE1017, 0x0028000F, 0x0013B500,
+0x000005C1, 0x60CF110A, 0x12387123, 0x85A4FF0D, 0x00103186, 0xC8000470, 0x27900075, 0x704A0002,
+0x5C7CFFF9, 0xA429FF57, 0x10137029, 0x080D35FF, 0xD027D4FF, 0xFF070B38, 0xFF1C204F, 0xFF080C3C,
+0xD0144434, 0x40FF090D, 0x33FF0E10, 0x53FF0807, 0x00008032, 0xA40007D4, 0x01E00404, 0x11031804,
+0x404F5CF9, 0xFF0A1542, 0x480026E4, 0xFDF52002, 0x9C0363D8, 0x00B00309, 0x02071B00, 0x5800000B,
+0x022C0002, 0x72FFF980, 0x34FF585F, 0x4009AC0E, 0xEDF8FF02, 0x300320AC, 0x00230029, 0x00000400,
+0xFCD00694, 0x0F31FFF7, 0x1443FF09, 0x2C53FF0C, 0xCE007300, 0x10DC0200, 0x04014700, 0x0C024AAC,
+0x009C0006, 0xFFF807F0, 0xFF8086A6, 0xFF000632, 0xFF070D3F, 0xFF0B1145, 0xFF000539, 0x4B310264,
+0x1A84151D, 0x00205400, 0x3C314760, 0x50A40A16, 0x121B3860, 0xC0F2FFFF, 0x0A18001C, 0x00026800,
+0xB9000004, 0x2CEF0001, 0x02008901, 0xFD615524, 0x4161FFF6, 0x0037103C, 0x2C0068CC, 0x08353101,
+0x710F3804, 0xFF282C52, 0xE813173D, 0x3300F14D, 0x36FF0508, 0x26FF0E10, 0x63FF0205, 0x003C3C40,
+0x724CA000, 0xFF0E1541, 0x643E4562, 0x076C010A, 0x00006803, 0x10030063, 0x03D00002, 0x7205000F,
+0x0000A001, 0x10000962, 0x4598040C, 0xFFED15F0, 0xFF4A8FB8, 0xFF3898CA, 0xFF3599CA, 0xFF3B9DCA,
+0xFF419AC6, 0xFF3B97C0, 0xFF369DC0, 0xFF3B99B5, 0x0E809FB5, 0xF0095002, 0xE8FFFF17, 0x579CC3FF,
+0x3A99C9FF, 0x389AC9FF, 0x359AC6FF, 0x3B9CC7FF, 0x3998C4FF, 0x3C9BCBFF, 0x3C8FBBFF, 0x0C9DBEFF,
+0x05000019, 0xFFE819F0, 0xFF97C0D2, 0xFF3F8EB9, 0xFF3899CE, 0xFF3797C7, 0xFF3C9DC7, 0xFF3B9EC5,
+0xFF349AC2, 0xFF37A0CF, 0xFF3D8CB5, 0x30ECEAFF, 0x113ED804, 0x00E9DCFE, 0xFC110134, 0x1EF26E34,
+0xF0FFFFE9, 0xA9D1FFB0, 0x94C0FF56, 0x9DCDFF39, 0x99CCFF3E, 0x9FD2FF39, 0x9BC7FF3F, 0x99C2FF3E,
+0x96BEFF3D, 0x9EC0FF3E, 0xE4FFFF52, 0x034B0CAC, 0x9C004AF6, 0x01F20202, 0x00019400, 0x0800000E,
+0x0C3C0000, 0xD7FFE9A0, 0xBBFF8BBF, 0x60FF4594, 0xA2D2A04B, 0x94BCFF42, 0xB6D1FF42, 0x94001760,
+0x03140069, 0x00003A00, 0x940001C5, 0x0A3A0003, 0x02013000, 0x1C010096, 0xFBFE6107, 0x5B607EFF,
+0x60001280, 0x1E1C0036, 0x000D3A71, 0x081542FF, 0xD4002714, 0x53100058, 0x282E4E71, 0xDEE5F8FF,
+0xA2712064, 0x1DFF7F86, 0x59500000, 0xB1B2C732, 0xA100034D, 0x1BB40105, 0x0011C000, 0xF0000060,
+0xF702F102, 0xE4EDFCFF, 0x29324FFF, 0x000027FF, 0x0D123CFF, 0x3B710900, 0x43FF040C, 0x34B80D15,
+0x092B0CF2, 0x1834FF03, 0xE9FFFF11, 0xC6E0FFDF, 0x051DFFBA, 0x081BFF00, 0xA5B3FF00, 0x0005009F,
+0x4D000058, 0x01F40103, 0x11055800, 0x4039A4F6, 0xFF9096B6, 0xD0001960, 0x57BC0053, 0x005A0000,
+0x08001938, 0x35140049, 0x6055D800, 0xFF1E2248, 0x10A0D4F4, 0x9FFFF451, 0x0A607482, 0x0020EC00,
+0xB000278C, 0x20100204, 0x52FFFE51, 0x5ACC3B42, 0x03061932, 0x5B021119, 0x0445040C, 0x02002B00,
+0x29001E64, 0x00880004, 0xFFFCFBD0, 0xFF05071E, 0xFF000121, 0x12F82743, 0xFBFFFB40, 0x002298F9,
+0xF8000825, 0x01680027, 0xF0183007, 0xFFFFFD03, 0xFFC7C6D8, 0xFF060A25, 0xFF00001B, 0xBD7C7D92,
+0x00600103, 0x00107202, 0x780018D4, 0x01380204, 0xBBD610F1, 0x1939FFB7, 0x052BFF14, 0x0C39FF01,
+0x0D3DFF08, 0x0F43FF09, 0x0D44FF09, 0x0E42FF08, 0x720F2808, 0xFF050831, 0x699898BA, 0x46FC100E,
+0x84F91100, 0x004A0016, 0x011FB001, 0xF96001F3, 0x0B1129FF, 0x202988FF, 0x5A000B28, 0x02695C00,
+0x46002534, 0x00CF0102, 0x00000900, 0xF405002C, 0x00880000, 0xFFFA02F1, 0xFF444A58, 0xFF020524,
+0xFF020621, 0x18F1F4FB, 0x024A0025, 0x000A3401, 0x10000030, 0xF8FB702F, 0x00041EFF, 0x7051E8FF,
+0xFF19203D, 0x02F4FBFF, 0x0130011C, 0x00005C00, 0xD20001BB, 0x0AE40200, 0x00021000, 0x02F10004,
+0xD8F9FFF8, 0x2D58FFD5, 0x0031FF2A, 0x0A41FF00, 0x71517405, 0xFF061041, 0x38081541, 0x0C900039,
+0x405BC000, 0xFF79809C, 0x85023D6C, 0xFFFE2039, 0x8001169C, 0x00590000, 0x000FE703, 0x71021F78,
+0x0EDC0000, 0xFFF803F0, 0xFF9BA0BE, 0xFF0F143A, 0xFF000531, 0xFF070E3C, 0x40000A10, 0x103F8006,
+0x0D3DFF0C, 0x0500FF0B, 0x0D0E2C72, 0x8B8DA4FF, 0xFB2104EC, 0x705BF8F5, 0xFF000421, 0xC1363C52,
+0x23890301, 0x02019F01, 0x0005005B, 0x015E0005, 0x0101DC00, 0x050F010A, 0xA4006700, 0x34A40111,
+0xFAFFF840, 0x000004FF, 0x15F0061C, 0xE6F6FFF5, 0xEBFFFFC9, 0xEEFFFFC5, 0xEAFFFFC3, 0xEAFFFFC0,
+0xE9FFFFC7, 0xECF6FFC7, 0xEEF6FFC4, 0xE5F1FFC9, 0x88021A20, 0x03FC0056, 0xDFF013F0, 0xE7FAFFCA,
+0xEDFCFFC6, 0xF1FEFFC6, 0xEEFDFFC5, 0xECFFFFC0, 0xECFFFFBF, 0xEBFFFFC2, 0xEBFCFFC7, 0x68000944,
+0xFFF87004, 0xFFE3F2F9, 0x1004E0FC, 0x70005CEB, 0xEDFFFFC1, 0x2CFCFFC7, 0xC6ECE264, 0xC2F1FFFF,
+0xBFE4F4FF, 0xEEFCFFFF, 0x540003B4, 0x00040302, 0x00031800, 0x680286F8, 0x13640023, 0xFFE80DF0,
+0xFFD4F7FF, 0xFFA3CFEA, 0xFF83BBE0, 0xFF75AFD4, 0xFF88BBD6, 0xFFA6D4E4, 0x452CF0FD, 0x00076C00,
+0xC4000028, 0x023A0310, 0x012B9403, 0x6100018D, 0x2734000D, 0x01251000, 0x01F03938, 0xD3E9FFEE,
+0xABCAFFA3, 0xACCBFF6E, 0xD6EDFF6F, 0x40000EC4, 0x09FC001E, 0x02043000, 0x1C002C20, 0x0126006B,
+0x08A0F810, 0x00153000, 0xC20007C0, 0x0DF00101, 0xF001E100, 0xBDFFFA0D, 0x87FFA1A7, 0x64FF646B,
+0x60FF3C45, 0x6FFF3742, 0xA0FF4853, 0xEFFF7F8A, 0x120FDCE0, 0xF27F1CF8, 0xFFFBFE03, 0xFFDBDFEB,
+0xFFC0C3D4, 0xFFC0C1D3, 0x34EDECFC, 0x03140004, 0x00000404, 0x880102FD, 0x100A0020, 0xF30B1000,
+0xEEFFF70E, 0x9BFFD4DD, 0x6CFF777E, 0x55FF4248, 0x56FF2B31, 0x83FF3036, 0xC2FF666A, 0x0940AEB1,
+0xFFF802F2, 0xFFEAF4FF, 0xFFB7C1CD, 0xFFBAC2CD, 0x81E5E9F2, 0x00540002, 0xFFFEFDC0, 0xFF61657E,
+0xFF697293, 0x0035E089, 0x90004E58, 0xFF0FF221, 0xC2D3FFF9, 0x788EFFB9, 0x455BFF6D, 0x4355FF3A,
+0x5366FF38, 0x89A0FF4B, 0xD7EFFF87, 0x00041CD7, 0xFFC00E10, 0x4868FFF8, 0x1145FF3D, 0xE435FF05,
+0x94F81209, 0x00A70064, 0x7101A000, 0xFFCFD6E0, 0x68BDC5D2, 0x18FF1321, 0x01BF0001, 0x00017001,
+0x1F000025, 0x00040001, 0x00000C00, 0xFEE20004, 0xBFC9FFFF, 0xC3D6FFBF, 0xCCDCFFBE, 0x000348C6,
+0x3B000018, 0x00390104, 0x00032800, 0x1B000670, 0x0039011F, 0xFEFF01F1, 0xC6FFF5F3, 0xD5FFB6BA,
+0xECFFC3C9, 0x005BE2E2, 0x002C8C00, 0x02000420, 0x84D00016, 0x11085C00, 0x0014C8FC, 0x0CF10428,
+0xD3E6FFF9, 0x7A91FFCC, 0x4864FF72, 0x425FFF41, 0x4B68FF39, 0x738CFF42, 0x74D0FF69, 0x14F00024,
+0x0042D400, 0x7900002C, 0x004A0200, 0x0009E400, 0xDC040083, 0xCAD3B005, 0xC1D4FFC6, 0xBFCFFFBC,
+0x01008DB9, 0x2A000078, 0x00240000, 0x0100B300, 0x64000450, 0x05000901, 0xE1FFFBD1, 0xD8FFD4D8,
+0xCCFFC1C3, 0x3888B6B9, 0x010AAC00, 0xF8000B90, 0x00300004, 0xC1000400, 0xD1FFFCFF, 0xD6FFBFC2,
+0xD9FFBBC0, 0x80004754, 0x0AF4002C, 0x0000F402, 0x6001062B, 0x00690100, 0x009E0100, 0x7E00020C,
+0x16880200, 0xE0E4FD71, 0x868BA9FF, 0x00F22EE0, 0xFF303C56, 0xFF38445A, 0xFF626D81, 0x7CA6AEC3,
+0x12DD015A, 0x000A780B, 0x5F000078, 0x24240000, 0x8F88FB12, 0x00242001, 0x30010064, 0x08800000,
+0xFFF40EF2, 0xFFC2CEDE, 0xFF758096, 0xFF3F4962, 0xFF39405C, 0xFF424764, 0xFF656986, 0xE8B4B6CD,
+0x009D016B, 0x90013802, 0xFFB9C0CA, 0xFFBEC4D0, 0x0157ACDA, 0xE4030230, 0x006C0304, 0x00032700,
+0x04000130, 0x00040001, 0x0F001000, 0x006A0004, 0x9C010098, 0xFFF8204B, 0x2A001872, 0x04D00020,
+0x000E6C02, 0x480203F4, 0x11DC0010, 0x0041E400, 0x20010214, 0x29400000, 0x0000F800, 0x44030040,
+0x02110106, 0x0012B000, 0x6805044C, 0x043C00ED, 0x0001AC00, 0x2D0001A8, 0x00EE0000, 0x00000800,
+0x04040058, 0x00680000, 0x0017C000, 0x30000010, 0x02900000, 0x03068400, 0xE7000249, 0x01350001,
+0x01218C00, 0xB4001416, 0x1AD80009, 0x00004800, 0x3400048A, 0x04EC0000, 0x0010D800, 0xEC00550C,
+0x0074002C, 0x00004400, 0x78000020, 0x3576001C, 0x02018C00, 0x86001928, 0x01E70000, 0x02236102,
+0x74006748, 0x19940119, 0x04414401, 0xF611004C, 0xEA0247BA, 0x16300207, 0x00008B00, 0xB40050A0,
+0x005E0091, 0x0017D400, 0xA7001A00, 0x2BBC0000, 0x01010801, 0xC0001D50, 0x0244000C, 0x0000A000,
+0x600000E4, 0x27E00003, 0x00022C00, 0x040300BC, 0x05880000, 0x01120400, 0xAB020004, 0x1E050104,
+0x0009AC00, 0x58000004, 0x7144014E, 0x00040800, 0x8C000128, 0x0924000A, 0x00012800, 0xC4000060,
+0x0054043E, 0x00000800, 0x04000096, 0x00700000, 0x00009600, 0xB600040E, 0x07E90000, 0x6BFFF951,
+0x0D38494C, 0x31583800, 0x409799B2, 0x01D40113, 0x0018C801, 0x08000034, 0x00B00012, 0x0301B400,
+0xD8010168, 0x11F8021E, 0x00218000, 0x41333A40, 0x05180C13, 0x01015800, 0x0E000152, 0x07F80606,
+0x0000DF03, 0x1401007A, 0x01710001, 0x00037000, 0xC4030004, 0x001C0228, 0x00003C00, 0xAC0000B8,
+0x0EEC0000, 0x00007400, 0x580001FC, 0x40FE1100, 0x001A005C, 0x05002C01, 0x3002026C, 0x56680200,
+0x02004000, 0x24002500, 0x002C0000, 0x0021B400, 0xB00500F6, 0x02940002, 0x01029C04, 0x94000C44,
+0x02700001, 0x0000E800, 0xAD000004, 0x017C0000, 0x10025C03, 0x033D0CFF, 0xB102030E, 0x001D000F,
+0x0100DC0A, 0xB3027390, 0x00DB000B, 0x00000409, 0xE40100BF, 0x00A80200, 0x00033C01, 0xFE000214,
+0x00500018, 0x00006F00, 0xD0000004, 0x00BF0000, 0x00020401, 0x040200BA, 0x1B380000, 0x01523000,
+0xCB000054, 0x00D90001, 0x00000401, 0x39010005, 0x004A0000, 0x04372402, 0xA4041B0C, 0x00EC0101,
+0x0000D400, 0x500001CC, 0x01C80000, 0x02008800, 0x24019E80, 0x00470034, 0x00000401, 0xAD010005,
+0x01A30500, 0x000AF400, 0x1600049C, 0x0408020E, 0x00012C00, 0x78000004, 0x1F2C0002, 0x00027800,
+0x54000095, 0x578C0000, 0x007BE400, 0x3800029C, 0x0018006A, 0x01007403, 0xDD0000BD, 0x013B0300,
+0x0201F801, 0x60000130, 0x00040000, 0x0F001E03, 0x00670007, 0x5800014B, 0x00040004, 0x00010701,
+0xC0000011, 0x013C0000, 0x00000400, 0x4000000C, 0x0ACB0301, 0x08012F01, 0x20030024, 0x01EC0100,
+0x0802B000, 0x280400CB, 0x00240000, 0x04000C00, 0x0C00001C, 0x00140000, 0x006D9A00, 0x68000004,
+0x014C0200, 0x00011405, 0x040C0023, 0x1E6F0000, 0x08097400, 0x53010018, 0x003C0000, 0x0002CC00,
+0x040001A4, 0x000C0000, 0x02005404, 0x96000170, 0x121C0001, 0x0024B000, 0xC7000A44, 0x045B0100,
+0x02004001, 0x920003FE, 0x000A0200, 0x00023C00, 0x44040004, 0x00600000, 0x00000404, 0x2602007D,
+0x00540000, 0x0004FC00, 0xEB010004, 0x001B0201, 0x0101ED02, 0xF10704CC, 0x001C0301, 0x00006400,
+0xE8000004, 0x00040000, 0x03027502, 0x24010085, 0x00050000, 0x07000400, 0x0F000014, 0x004B0300,
+0x0003D802, 0x4600008C, 0x00040000, 0x00043000, 0x30070021, 0x008D0000, 0x00008000, 0xC80306A0,
+0x00380003, 0x00740C00, 0xF1310410, 0x5D34D8DD, 0x0C144231, 0xFF335520, 0x2244EFF7, 0x0001E800,
+0x09010400, 0x0E580202, 0x00004805, 0xF6510110, 0x61698EFF, 0x3C7216EC, 0x9BFF0910, 0x053C7478,
+0x00009C03, 0x60000154, 0x00040200, 0x00009402, 0x04000014, 0x00E80500, 0x03001700, 0xA0000030,
+0x00C20004, 0x02000400, 0xD8000020, 0x00040000, 0x01008403, 0x40000028, 0x3744002B, 0x00017402,
+0xEA0000DB, 0x13080000, 0x00000402, 0x12000051, 0x00040300, 0x0D000F00, 0x11000004, 0x00580000,
+0x00000400, 0xD800006E, 0x00040201, 0x00020C00, 0x160004E6, 0x00040000, 0x0000AC00, 0x6E000004,
+0x0230000B, 0x01001404, 0x0C000078, 0x00040001, 0x02000D01, 0x200A0258, 0x01FB0200, 0x01001F03,
+0xE40252F8, 0x01A40301, 0x00003C03, 0x24010060, 0x00970000, 0x0200B703, 0x11000007, 0x00040000,
+0x0000F000, 0x080300F8, 0x00310001, 0x0000BB00, 0x1F000008, 0x002D0100, 0x04047003, 0x18000049,
+0x00040F00, 0x00200401, 0x0203A001, 0xB80007C6, 0x05830002, 0x01001B01, 0xB803004C, 0x00600000,
+0x00000404, 0x2101004C, 0x00E20000, 0x00012C00, 0x04000200, 0x000C0000, 0x03008D00, 0x4004009C,
+0x00080100, 0x020BAC00, 0xD0020004, 0x00580301, 0x01004C00, 0x340201CC, 0x00630201, 0x00042C00,
+0x39010019, 0x00050F00, 0x0817006B, 0x0075FB00, 0x8A0102FF, 0x00F40000, 0x03000400, 0x140000E8,
+0x00B50200, 0x0100C102, 0x1C0000B7, 0x010C0000, 0x00000400, 0x2E020954, 0x00270106, 0x0000EC00,
+0x28010009, 0x00050000, 0x0201AC00, 0x1700003B, 0x00040200, 0x00003000, 0xEC0020B2, 0x004C0001,
+0x03002800, 0x0B000024, 0x00250000, 0x01009800, 0x110006E6, 0x01700200, 0x000C3300, 0x9B010004,
+0x00170001, 0x05009C00, 0x1100000D, 0x004C0000, 0x00000404, 0x54020164, 0x00CE0000, 0x02033000,
+0x980006D0, 0x0F5F0209, 0x03003B05, 0x280003F3, 0x02200100, 0x01001003, 0x0509005F, 0x00640000,
+0x05005806, 0x17000040, 0x00280100, 0x02000900, 0x1C0100AC, 0x00C80000, 0x0005B807, 0x04000060,
+0x03180000, 0x01000400, 0x6C030033, 0x002B0000, 0x00023802, 0xAC0202FC, 0x055C0502, 0x01001D00,
+0x08020110, 0x043C0004, 0x02004002, 0x54000070, 0x00040000, 0x00007405, 0x0D010017, 0x00300000,
+0x000AE003, 0xD8000304, 0xA8FD100C, 0xE04A1127, 0x123AA018, 0x1434FF06, 0xF6FFFF07, 0x28001070,
+0x534D0026, 0x03020D00, 0xE8010984, 0x02F8000B, 0xAEFFF351, 0x59748894, 0x1016E000, 0x0030CC27,
+0xD401104C, 0x01640203, 0x0400A300, 0xD80E00C0, 0x00120300, 0x00009800, 0xF4030220, 0x00B40000,
+0x00000400, 0x040400CC, 0x00440100, 0x03002800, 0x080001FC, 0x01940009, 0x03002800, 0x5C0700D3,
+0x00580304, 0x00000704, 0x04000038, 0x008D0000, 0x00000404, 0x70010010, 0x01580000, 0x02027802,
+0x0C0005A4, 0x0E680000, 0x03028400, 0xE2030170, 0x01600009, 0x02000402, 0x780100DC, 0x00480000,
+0x0300F000, 0x940400C0, 0x00670000, 0x03002006, 0x700103F4, 0x017C0200, 0x0100D800, 0x800000D4,
+0x00180301, 0x03003001, 0x400000B4, 0x00040000, 0x01000F03, 0xB0000041, 0x00800006, 0x00001401,
+0x21000078, 0x00040000, 0x00007C03, 0xD0000054, 0x00080202, 0x02002601, 0x24000063, 0x00040400,
+0x00003800, 0x1F030004, 0x01400000, 0x0000B400, 0xFC010004, 0x001C0707, 0x00009001, 0x3B000038,
+0x00080003, 0x01000400, 0x11000038, 0x003A0000, 0x0203E802, 0x00070138, 0x00240103, 0x0100B301,
+0x2A00000A, 0x00600100, 0x03000E01, 0x4C0000ED, 0x00B80500, 0x02015002, 0x810800B8, 0x00310400,
+0x5F00080F, 0x00009F00, 0x340033FF, 0x00C00031, 0x01009C00, 0x9F00014D, 0x00040800, 0x00009B0D,
+0xFC000108, 0x00360004, 0x02002900, 0x5C000108, 0x06600501, 0x01001701, 0xBF010005, 0x011C0010,
+0x00000404, 0x040003DC, 0x017C0100, 0x03002300, 0x1000025C, 0x00940000, 0x00020000, 0x080013B6,
+0x0EBE004B, 0x01009800, 0x4C00003C, 0x00210001, 0x01003400, 0x80002A6E, 0x007C0200, 0x00003C04,
+0xAF010008, 0x00240100, 0x05001C06, 0x400000D8, 0x00040400, 0x00002400, 0xA0030004, 0x00640002,
+0x05006C00, 0x1C00002C, 0x002C0400, 0x00005503, 0x0B03000F, 0x005D0500, 0x04003405, 0xA800007D,
+0x00040700, 0x00001701, 0x3905004C, 0x000D0300, 0x0104D807, 0x90010074, 0x14E60210, 0x000FC600,
+0x3D010F5C, 0x00750001, 0x00000400, 0x04000037, 0x00480300, 0x00007800, 0x1B000102, 0x00640500,
+0x03002004, 0x4C00005C, 0x00240188, 0x01019900, 0xFB600168, 0x121838FF, 0x001CD0FF, 0x380027CC,
+0x8DB2331C, 0x0020B485, 0x040004F0, 0x0B4C0000, 0xFFF403F0, 0xFFD4E3F6, 0xFF3F4E6D, 0xFF000B31,
+0xFF0D143E, 0xC432463C, 0x00F8B2B5, 0x00006803, 0x0400007C, 0x00930100, 0x00000507, 0x04000014,
+0x00130500, 0x00003000, 0x11040004, 0x000C0000, 0x01000400, 0x09000010, 0x00040A00, 0x00020400,
+0x9402008A, 0x00730201, 0x0100E401, 0x100A0030, 0x00680000, 0x01000404, 0x4B000024, 0x00110000,
+0x03018400, 0x48000F9A, 0x01080000, 0x00003F02, 0xE0000021, 0x07A00203, 0x00001800, 0x08000290,
+0x00200200, 0x0303AC04, 0x2F00000E, 0x00040300, 0x04005700, 0x0C00004C, 0x00220300, 0x00000709,
+0x4C000018, 0x00080000, 0x00001904, 0x0400000C, 0x00100400, 0x0001F000, 0x100101C0, 0x005C0300,
+0x00000C00, 0x04000014, 0x00200000, 0x00001000, 0x380000D0, 0x00500000, 0x02000402, 0x0C020968,
+0x05680000, 0x0000AC02, 0x04050028, 0x00310000, 0x00005403, 0x2C06000B, 0x00150300, 0x06002905,
+0x1F000148, 0x00040002, 0x00001B06, 0x2402002C, 0x008C0401, 0x09004800, 0xA1000194, 0x00270000,
+0x04026C03, 0x44010118, 0x00790000, 0x07000400, 0x0F03050B, 0x00360000, 0x6E00040F, 0x01016400,
+0x05000090, 0x0A000300, 0x0C000B00, 0xFC020004, 0x04F00000, 0x02000400, 0x2402016C, 0x023C0000,
+0x03012000, 0x07030101, 0x00FC0100, 0x01000C00, 0x20040009, 0x01A80200, 0x00012000, 0x6C000004,
+0x052C0002, 0x0003DC01, 0x9801002C, 0x018C0203, 0x00005C00, 0xFC000704, 0x00040004, 0x020CA402,
+0x38003BB8, 0x00570100, 0x02015401, 0x30000080, 0x004C0000, 0x0001BC00, 0x10010020, 0x015E0500,
+0x0109900E, 0x74000040, 0x00290000, 0x05000800, 0xDC040011, 0x00150000, 0x0000380A, 0x2701005C,
+0x00780100, 0x00005D04, 0x040200DC, 0x014C0200, 0x00012002, 0x5B000028, 0x00040400, 0x01001000,
+0x57000032, 0x000D0500, 0x0000EC02, 0x1000000F, 0x00040001, 0x02016802, 0x64000128, 0x00040002,
+0x0000D000, 0x28010024, 0x00510401, 0x00004801, 0x700000AC, 0x00800000, 0x00001103, 0x04070007,
+0x002F0000, 0x00054000, 0xB40002B4, 0x314801AB, 0x00012900, 0xFE211AF8, 0x20763CFB, 0x68B00A37,
+0xFF0B0AF1, 0xFF00093A, 0xFF00092D, 0xFF22304B, 0xFF374761, 0xFF384963, 0x140C1D37, 0x366C0073,
+0x005D1C00, 0xA8314638, 0x26BD8D92, 0x017C1C02, 0xB70100D6, 0x006C0000, 0x05000E03, 0x14000007,
+0x00040000, 0x04001105, 0x1100009C, 0x000C0400, 0x00000800, 0x04010010, 0x000D0000, 0x00000406,
+0x180000B8, 0x00080001, 0x00004801, 0x0900001B, 0x00080000, 0x01000404, 0x34020038, 0x00280001,
+0x00000400, 0x34010023, 0x00240301, 0x00001000, 0x04000018, 0x000C0000, 0x06001C05, 0xC4010009,
+0x016C0000, 0x01002400, 0x58030017, 0x00300000, 0x01000400, 0x500B000F, 0x00180100, 0x01001400,
+0x050E001D, 0x00200000, 0x0600040C, 0x39000026, 0x01BC0F00, 0x00250104, 0x00002000, 0xEC0001E0,
+0x00E00204, 0x00010C00, 0xA4000004, 0x00040000, 0x00005C04, 0x2C00000C, 0x00100006, 0x00003B01,
+0x3F000005, 0x00110000, 0x030C8000, 0x0F02049C, 0x00740000, 0x00003202, 0xB80209D0, 0x024C0002,
+0x001B7F02, 0x0400021F, 0x01040600, 0x00004900, 0x24020004, 0x003A0000, 0x00008400, 0x50000004,
+0x006B0000, 0x03002C01, 0x18000064, 0x00240000, 0x01001404, 0x34030008, 0x00300503, 0x0F003501,
+0x006B0005, 0xE80000F8, 0x0B480010, 0x00008A01, 0x040300E3, 0x014C0000, 0x00048002, 0x15000178,
+0x01340C00, 0x02001800, 0x39010110, 0x126C0102, 0x0000F600, 0x0408002C, 0x00140000, 0x00000400,
+0x50020040, 0x01040004, 0x01000400, 0x38010074, 0x001C0000, 0x01000E02, 0x08001A80, 0x0C880105,
+0x0001F800, 0x20000CA4, 0x003C0200, 0x01002F01, 0x1800003D, 0x0CB80602, 0x0E001300, 0x88000004,
+0x003C0000, 0x06000400, 0x6A00046C, 0x00FC0000, 0x01000400, 0x2700019C, 0x00090600, 0x0000CF02,
+0x04000014, 0x00180100, 0x02056400, 0x180000EC, 0x05080002, 0x00000801, 0x91010049, 0x00E00F00,
+0x00440708, 0x02026C00, 0xCC030004, 0x001C0100, 0x00014802, 0x380004E8, 0x006F0102, 0x00001800,
+0x60000004, 0x00080000, 0x0000040C, 0x140000E9, 0x02540100, 0x06010802, 0x350000B5, 0x00EC0200,
+0x00002700, 0x580009F8, 0x1D180000, 0x0A001000, 0x45000060, 0xFFFB9100, 0xFF7F8699, 0xD0070F36,
+0x7D000040, 0x0050D400, 0x3B227C20, 0xF349EC13, 0x02103700, 0x00032EFF, 0x272B50FF, 0xD6D8EFFF,
+0x9C0013F4, 0x01140322, 0x01007303, 0x53000007, 0x00040000, 0x06000D01, 0x7C000005, 0x00040000,
+0x00001205, 0x04000024, 0x00150000, 0x0D000400, 0x1D000019, 0x02000000, 0x020E9803, 0x7106000F,
+0x00100400, 0x0009DC03, 0x04040182, 0x004F0000, 0x0F000404, 0x02040057, 0x44070048, 0x01180400,
+0x00003800, 0x10040048, 0x00080400, 0x00022C00, 0x20000314, 0x00540100, 0x01003C04, 0x0508000D,
+0x00190E00, 0x08003400, 0x2E020004, 0x00280400, 0x00029C00, 0xCD011420, 0x00980201, 0x01002D00,
+0x24000025, 0x027C0000, 0x02030400, 0xA0040228, 0x00A40105, 0x00002400, 0x0400002C, 0x102C0100,
+0x00031000, 0x2E000FD0, 0x00380008, 0x00026803, 0x28000020, 0x004F0001, 0x01003400, 0xD00002B4,
+0x31D4000E, 0x02003400, 0x27000168, 0x00F00600, 0x01007003, 0x97020388, 0x003B0100, 0x07004400,
+0x34000004, 0x01180000, 0x03001C01, 0x9C00002C, 0x00040000, 0x04001C00, 0x080F0018, 0x3C008300,
+0x0EC00703, 0x0000D807, 0x000000D4, 0x05040016, 0x02000C00, 0xAC0303B8, 0x0E280301, 0x0400E401,
+0x54010034, 0x00120001, 0x0F002404, 0x03010008, 0x34000190, 0x01110100, 0x00000900, 0x84000034,
+0x03B40200, 0x02018001, 0xDA010005, 0x0278000E, 0x0303DC02, 0x57000220, 0x01590100, 0x11000900,
+0x003E1BFC, 0x13010214, 0x00980700, 0x01005F01, 0x28000048, 0x00780700, 0x01020800, 0x540001A8,
+0x001C0002, 0x02007803, 0x06020031, 0x00970000, 0x01005100, 0x2400002C, 0x024C0001, 0x02000400,
+0x00004074, 0x005B0105, 0x00002E01, 0x4800002D, 0x00080000, 0x00022802, 0x0404003B, 0x00BC0200,
+0x02002000, 0x6C020004, 0x002C0206, 0x00003F00, 0x02000028, 0x04A40001, 0x01000800, 0x1F000058,
+0x00040B00, 0x00002800, 0x34000004, 0x00240400, 0x06001000, 0x31040120, 0x00220100, 0x000A2B05,
+0x04000054, 0x1E980500, 0x0123A400, 0x8800285C, 0x04C4003B, 0x00011C00, 0x12F21510, 0xAECEFFF9,
+0x668AFFA8, 0x375AFF5C, 0x274AFF29, 0x2649FF19, 0x4669FF18, 0x83A4FF3C, 0xD8F8FF7A, 0x6157D0D3,
+0xFEFFFCFE, 0x90F4F9FA, 0x00021800, 0x0400005C, 0x00760200, 0x00014C03, 0x1105008B, 0x00090200,
+0x0200AC02, 0x0601000C, 0x00240000, 0x01000408, 0x05000015, 0x00150600, 0x00003400, 0x0400005C,
+0x06700000, 0x0100F804, 0x270000DD, 0x02130300, 0x03002001, 0x4200000C, 0x00040400, 0x00004004,
+0x14010008, 0x00340000, 0x00000404, 0x0C040015, 0x00080B00, 0x09001B00, 0x79010070, 0x02300200,
+0x0000F400, 0x13010020, 0x00380000, 0x08005901, 0x15000005, 0x00040000, 0x06001408, 0x16040218,
+0x01B80000, 0x00020C02, 0x000300BE, 0x00370005, 0x00005D00, 0x29010008, 0x02340000, 0x00031C00,
+0x4403027C, 0x02940100, 0x01000C02, 0x23000084, 0x00340000, 0x00010001, 0x700004CC, 0x1E3E0056,
+0x01003802, 0x50000047, 0x00380000, 0x05000400, 0x78000011, 0x00040000, 0x0000D800, 0x540302E4,
+0x00480100, 0x00000C02, 0x0404001E, 0x00630300, 0x0302CF02, 0x4B000050, 0x00C80000, 0x01011404,
+0x1C030024, 0x000C0000, 0x00000400, 0x08000040, 0x002C0000, 0x7F00040F, 0x0000AD00, 0xB80000A2,
+0x1810031E, 0x0000AD00, 0xD0010017, 0x01780604, 0x0300F902, 0x74001E04, 0x00240001, 0x00015000,
+0x3400000C, 0x00DD0100, 0x00014800, 0x38000150, 0x06840200, 0x0003D800, 0xAC010004, 0x00340001,
+0x00002C00, 0x04000008, 0x00150500, 0x02000D01, 0x54000063, 0x11AC0300, 0x01009A00, 0x34070023,
+0x18FC0000, 0x0504F000, 0x1C000590, 0x00040000, 0x0000B001, 0x300206FC, 0x00380108, 0x04005700,
+0x24000004, 0x00040000, 0x01001000, 0xA4000528, 0x000D0100, 0x01007805, 0x00070034, 0x002F0002,
+0x06000404, 0xE9000025, 0x00380000, 0x00000403, 0x25000007, 0x00B80300, 0x00000B00, 0x04040210,
+0x02200000, 0x01003200, 0x2C00005C, 0x000D0300, 0x00011400, 0x30000004, 0x00130100, 0x0200050B,
+0x9C000038, 0x00040304, 0x0007E001, 0x04000041, 0x079C0600, 0x0000400D, 0x0403001F, 0x001C0000,
+0x1026BC00, 0x0004F4FD, 0x90010120, 0x01B10025, 0x0205C800, 0x98010008, 0x00050000, 0x00280400,
+0xA400799C, 0xE0F91021, 0x03940020, 0x0062E100, 0xD9000008, 0x244C000C, 0x00003402, 0xBC00009C,
+0x159C0003, 0x0200E804, 0x000F0120, 0xD0000B05, 0x003C0001, 0x0300EB01, 0x0C0100A4, 0x01740700,
+0x06004802, 0xC400001D, 0x048C0900, 0x03001B00, 0x1C000035, 0x00BB0000, 0x00000405, 0x20010018,
+0x00050000, 0x00000402, 0x040007C0, 0x00A80000, 0x04003001, 0xB0030024, 0x00940001, 0x02000400,
+0x6C00001C, 0x00C40601, 0x05007800, 0x40000018, 0x2A2C0001, 0x06023C01, 0x4F000024, 0x00040200,
+0x0202FC00, 0xC4020074, 0x00160200, 0x00009C04, 0x04000048, 0x00160300, 0x0019C003, 0x7E000150,
+0x01640000, 0x010E7C02, 0x470010AC, 0x00390100, 0x00002004, 0x9C030024, 0x00450000, 0x03002000,
+0x270100C0, 0x00100000, 0x00014401, 0x800409C8, 0x003C0003, 0x00003400, 0xB0020004, 0x00460000,
+0x000C6805, 0x38000089, 0x00040400, 0x0F004001, 0x04000258, 0x08040020, 0x00380000, 0x04002C01,
+0x68000011, 0x034C0700, 0x0000A000, 0xA0030004, 0x02E40000, 0x03000400, 0x07050037, 0x00230000,
+0x05000400, 0x090F0011, 0xC4006200, 0x00C00000, 0x02031000, 0x50014370, 0x008C0101, 0x02001C00,
+0xA805013C, 0x00130000, 0x00014500, 0x0C000004, 0x00040000, 0x00001D00, 0x0C000004, 0x01180300,
+0x000F5400, 0x740004FE, 0x01700102, 0x00010C00, 0x04000020, 0x002C0400, 0x06000C00, 0x3302006D,
+0x00280302, 0x00005F00, 0x08000134, 0x00230100, 0x00003404, 0xA80309B8, 0x00310223, 0x0314B107,
+0x380902A0, 0x00640000, 0x00000404, 0x04000044, 0x00100000, 0x00005501, 0x04000009, 0x021C0200,
+0x00001304, 0xA4000023, 0x00040203, 0x01070802, 0x0501010F, 0x00300000, 0x00000400, 0x04000134,
+0x00B10000, 0x0100F501, 0x3C02008F, 0x02440000, 0x04028800, 0x44030004, 0x00370000, 0x01000404,
+0x9400437A, 0x0334001D, 0x01005901, 0x0A030040, 0x08DF0100, 0x01013C00, 0x0C010015, 0x006C0210,
+0x02001400, 0x5C000098, 0x00680000, 0x00005C06, 0x4001007C, 0x00640400, 0x01000800, 0x05000011,
+0x01C80000, 0x0004C000, 0x4C02011E, 0x3D000200, 0x0200C000, 0x1A000029, 0x92680000, 0x00004801,
+0x04009ABC, 0x003B0390, 0x003AE800, 0x1C000120, 0x0A480000, 0x00008800, 0xE8020366, 0x008C0001,
+0x00004400, 0x4C070004, 0x003C0001, 0x00000407, 0x0402003C, 0x00280300, 0x03001C00, 0x1800000B,
+0x01EC0000, 0x01000800, 0x6D0000F4, 0x00040100, 0x00005007, 0x0400002C, 0x00380000, 0x01017303,
+0x14000030, 0x00040400, 0x00001C00, 0x3C01000C, 0x00090000, 0x00009C02, 0x04000500, 0x013C0000,
+0x01002300, 0xFB000004, 0x02500000, 0x01076C07, 0x37020020, 0x00870100, 0x02076800, 0x15000098,
+0x01380000, 0x02000400, 0x7C0501B4, 0x004D0100, 0x00000500, 0x28000018, 0x00040400, 0x06001400,
+0x300000C0, 0x00040000, 0x03001603, 0x2C000500, 0x00540000, 0x02000400, 0x88000380, 0x00040001,
+0x01008101, 0x820002D4, 0x00200000, 0x0601C400, 0x48000050, 0x00500100, 0x00004300, 0x11000004,
+0x01180100, 0x0100880B, 0x21020240, 0x004A0000, 0x01039001, 0x4C070028, 0x001F0200, 0x00027805,
+0x5C0101E0, 0x00540000, 0x00001C00, 0x0800000D, 0x00040000, 0x00003C03, 0x0400012C, 0x00A80207,
+0x03007404, 0x30070054, 0x00CC0000, 0x00007800, 0x0408004B, 0x00230000, 0x08000400, 0x0C0F0014,
+0xD5036300, 0x02100300, 0x0F023B01, 0x00090089, 0x0400002F, 0x00240400, 0x00000C00, 0x10040004,
+0x01200100, 0x00011002, 0x040400E0, 0x00580500, 0x07002C0B, 0x0B020037, 0x00880300, 0x02003805,
+0x06050016, 0x00180A00, 0x00004D08, 0x7800000C, 0x04140300, 0x03003205, 0x1F020009, 0x000D0300,
+0x2D00070F, 0x07004D07, 0x5604000B, 0x00A40400, 0x04000804, 0x08080018, 0x001C0F00, 0x00280009,
+0x00002000, 0x04020008, 0x00650000, 0x0000D80A, 0x04000020, 0x00200200, 0x1100060F, 0x04004400,
+0x300E0004, 0x004C0000, 0x0D000400, 0x3300001A, 0x00150B00, 0x00002802, 0x0400016C, 0x00980A00,
+0x0F002B0B, 0x0216000F, 0x2F0F0054, 0x880F0800, 0x2E0F0000, 0x1B050800, 0x00580000, 0x05000404,
+0x09070015, 0x001C0400, 0x07000800, 0xD7010017, 0x00140003, 0x02000400, 0x81000018, 0x00040000,
+0x0F000E02, 0x00370006, 0x04000054, 0x01480200, 0x00007000, 0x60020004, 0x00180000, 0x02000404,
+0x060F0012, 0x58002900, 0x00040400, 0x0500480F, 0x0D00200F, 0x0000380A, 0x120A009C, 0x000E0C00,
+0x1B00500F, 0x0F003E0C, 0xFFFF0010, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF5055FF, 0xFFFFFFFF, 0x00000000
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSETS_ARGB8888_H */
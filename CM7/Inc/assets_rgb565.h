@@ -0,0 +1,6304 @@
+/**
+  ******************************************************************************
+  * @file    assets_rgb565.h
+  * @brief   LCD asset pack, 200800 bytes.
+  *          Generated by Tools/lcd_assets.py, do not edit.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ASSETS_RGB565_H
+#define __ASSETS_RGB565_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define ASSET_IMAGE_320X240                      0U
+#define ASSET_LIFE_AUGMENTED                     1U
+
+ALIGN_32BYTES(const uint32_t assets_rgb565[50200]) =
+{
+0x4144434C, 0x00020001, 0x00031060, 0x00000000, 0x00000000, 0x00000060, 0x00025800, 0x00F00140,
+0x00000280, 0x00010002, 0x00000000, 0x00000000, 0x00000001, 0x00025860, 0x0000B7FB, 0x00F00140,
+0x00000280, 0x00010202, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x2A512230, 0x2A512230, 0x2A512250, 0x2A512250, 0x2A712250, 0x2A712251, 0x2A712251, 0x2A712251,
+0x2A722271, 0x2A922271, 0x2A922271, 0x2A922272, 0x2A922272, 0x2A922A72, 0x2A922272, 0x2A922A72,
+0x2A922A72, 0x2A932A72, 0x2A932A72, 0x2A932A92, 0x2AB32A92, 0x2AB32A93, 0x2AB32A92, 0x2AB32AB3,
+0x2AB32292, 0x2AB32AB3, 0x2AD322B3, 0x2AD42AB3, 0x2AD32AB3, 0x2AD42AB3, 0x2AD42AB3, 0x2AD42AD3,
+0x2AD42AD3, 0x2AD42AD4, 0x2AD42AD3, 0x2AD42AD4, 0x2AF42AD3, 0x2AF42AD4, 0x2AF42AD4, 0x32F52AD4,
+0x2AF42AD4, 0x32F42AD4, 0x2AF42AD4, 0x32F42AD4, 0x32F42AD4, 0x32F42AF4, 0x33142AF4, 0x33152AF4,
+0x32F42AF4, 0x32F52AF4, 0x33152AF4, 0x33152AF4, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x33152AF4,
+0x2B152AF4, 0x33152AF4, 0x2B152AF4, 0x33152AF4, 0x2B152AF4, 0x33152AF4, 0x33152AF4, 0x33152B15,
+0x2B152AF4, 0x33152AF4, 0x2B152AF4, 0x33152AF4, 0x33152AF4, 0x33152B15, 0x33152AF4, 0x33152B15,
+0x33152AF4, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152AF4, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33352B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152AF5, 0x33152AF5, 0x33152AF5, 0x33152AF5, 0x2B152AF5, 0x33152AF5, 0x2B152AF4, 0x2B152AF4,
+0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x2AF42AF4, 0x2AF52AD4, 0x2AF42AD4, 0x2AF52AD4,
+0x2AF42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD422B3, 0x2AD42AB4,
+0x2AD32AB3, 0x2AD42AB3, 0x2AD322B3, 0x2AD32AB3, 0x2AB32AB3, 0x2AB32A93, 0x2AB32292, 0x2AB32293,
+0x2A932A92, 0x2A932A92, 0x2A932A92, 0x2A932A72, 0x2A922272, 0x2A922A72, 0x2A922272, 0x2A922272,
+0x22502A51, 0x2A512A51, 0x2A512A71, 0x2A512A71, 0x22712A71, 0x2A712A72, 0x22712A71, 0x2A712A72,
+0x22712A72, 0x2A722A92, 0x2A922A92, 0x2A722A92, 0x2A922A92, 0x2A922A93, 0x2A922A92, 0x2A922A93,
+0x2A922A93, 0x2A923293, 0x2A923293, 0x2A9332B3, 0x2A9332B3, 0x2AB32AB3, 0x2AB32AB3, 0x2AB332B3,
+0x2AB32AB3, 0x2AB332D4, 0x2AB32AD4, 0x2AD32AD4, 0x2AD32AD4, 0x2AD32AD4, 0x2AD32AD4, 0x2AD332D4,
+0x2AD42AD4, 0x2AD432F4, 0x2AD42AF4, 0x2AD432F4, 0x2AD432F4, 0x2AF432F4, 0x2AF432F5, 0x2AF432F5,
+0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF43315, 0x2AF43315, 0x2AF43315,
+0x2AF43315, 0x32F43315, 0x2AF43315, 0x32F53315, 0x2AF53315, 0x32F53315, 0x2AF53315, 0x2AF53315,
+0x2AF53315, 0x2B153315, 0x2AF53315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315,
+0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153335,
+0x2B153315, 0x2B153335, 0x2B153315, 0x2B153335, 0x2B153315, 0x2B153335, 0x2B153315, 0x2B153335,
+0x2B153335, 0x2B153335, 0x2B153335, 0x2B153335, 0x2B153335, 0x2B353336, 0x2B353336, 0x2B353336,
+0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336,
+0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336,
+0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153336,
+0x2B153315, 0x2B153336, 0x2B153315, 0x2B153336, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153336,
+0x2AF53315, 0x33153315, 0x2AF53315, 0x33153315, 0x2AF53315, 0x2B153315, 0x2AF53315, 0x2AF53315,
+0x2AF53315, 0x2AF53315, 0x2AF53315, 0x2AF53315, 0x2AF43315, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5,
+0x2AF432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD42AD4, 0x2AD432D4,
+0x2AD32AD4, 0x2AD32AD4, 0x2AB32AD4, 0x2AB32AD4, 0x2AB32AD4, 0x2AB32AB4, 0x2AB32AB3, 0x2AB32AB3,
+0x2A9332B3, 0x2A9332B3, 0x2A922AB3, 0x2A932A93, 0x2A922A93, 0x2A922A93, 0x2A722A93, 0x2A722A93,
+0x2A512250, 0x2A512250, 0x2A712250, 0x2A712250, 0x2A712251, 0x2A712251, 0x2A712271, 0x2A712271,
+0x2A722271, 0x2A722271, 0x2A922A71, 0x2A922A72, 0x2A922A72, 0x2A922A72, 0x2A922A92, 0x2A922A72,
+0x2A932A92, 0x2A932A92, 0x2AB32A92, 0x2AB32A93, 0x32B32A93, 0x2AB32A93, 0x2AB32A93, 0x2AB32A93,
+0x2AD42AB3, 0x2AD42AB3, 0x2AD42AB3, 0x2AD42AB3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3,
+0x2AD42AD4, 0x2AD42AD4, 0x2AF42AD4, 0x2AF42AD4, 0x32F42AD4, 0x2AF42AD4, 0x32F52AF4, 0x32F52AF4,
+0x32F52AF4, 0x32F42AF4, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4,
+0x33152AF4, 0x33152AF4, 0x33152AF5, 0x33152AF4, 0x33152AF5, 0x33152AF4, 0x33152AF5, 0x33152AF5,
+0x33152AF5, 0x2B152AF4, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33352B15, 0x33152B15, 0x33152B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33362B15, 0x33352B15,
+0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33362B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33152B15, 0x33352B15, 0x33352B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33153315, 0x33152AF5, 0x33152AF5, 0x33152B15, 0x33152B15, 0x2B152AF5, 0x33152B15, 0x2B152AF4,
+0x33152AF5, 0x33152AF4, 0x33152AF5, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x2AF52AF4,
+0x2AF52AF4, 0x2AF52AD4, 0x32F52AD4, 0x2AF42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD4,
+0x2AD42AB4, 0x2AD42AB3, 0x2AB42AB3, 0x2AD322B3, 0x2AB42AB3, 0x2AB32AB3, 0x2AB32AB3, 0x2AB32AB3,
+0x2AB32A93, 0x2AB32A92, 0x2A932A92, 0x2A932A92, 0x2A932A72, 0x2A922272, 0x2A922A72, 0x2A922272,
+0x2A512A71, 0x2A512A71, 0x2A512A71, 0x2A512A71, 0x2A712A72, 0x2A712A72, 0x2A712A72, 0x2A712A92,
+0x2A722A92, 0x2A722A92, 0x2A922A92, 0x2A922A93, 0x2A923293, 0x2A922A93, 0x2A923293, 0x2A923293,
+0x2A9332B3, 0x2A9232B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332B4, 0x2AB332B3, 0x2AB332B4, 0x2AB332B3,
+0x2AD32AD4, 0x2AD32AD4, 0x2AD432D4, 0x2AD32AD4, 0x2AD432D4, 0x2AD42AD4, 0x2AD432F4, 0x2AD432F4,
+0x2AD432F4, 0x2AD432F4, 0x2AD432F5, 0x2AF432F4, 0x2AF432F5, 0x2AF432F5, 0x2AF532F5, 0x2AF432F5,
+0x32F43315, 0x2AF43315, 0x32F43315, 0x2AF43315, 0x32F53315, 0x2B143315, 0x33153315, 0x2B143315,
+0x32F53315, 0x32F43315, 0x32F53315, 0x2AF53315, 0x33153315, 0x33153315, 0x33153315, 0x33153315,
+0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315, 0x33153336, 0x2B153335,
+0x33153336, 0x2B153335, 0x33153336, 0x2B153335, 0x33153336, 0x2B153335, 0x33153336, 0x2B153335,
+0x33153336, 0x33153335, 0x33153336, 0x33153335, 0x33153336, 0x33153335, 0x33153336, 0x33153335,
+0x33153336, 0x2B153336, 0x33153336, 0x2B153336, 0x33153336, 0x2B153336, 0x33153336, 0x2B153336,
+0x33153336, 0x2B153336, 0x33153336, 0x2B153336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x2B153336, 0x33153336, 0x2B153336,
+0x33153336, 0x2B153336, 0x33153336, 0x33153336, 0x33153336, 0x2B153335, 0x33153336, 0x2B153335,
+0x33153316, 0x33153315, 0x33153316, 0x2B153335, 0x2B153336, 0x2B153315, 0x2B153315, 0x2B153315,
+0x32F53315, 0x2AF53315, 0x32F53315, 0x2AF53315, 0x2AF53315, 0x2AF53315, 0x2AF532F5, 0x2AF432F5,
+0x2AF532F5, 0x2AF432F5, 0x2AF532F5, 0x2AD432F5, 0x2AD432F5, 0x2AD42AF5, 0x2AD42AD5, 0x2AD42AD4,
+0x2AD432D4, 0x2AD42AD4, 0x2AB42AD4, 0x2AD32AD4, 0x2AB332D4, 0x2AB32AD4, 0x2AB32AB4, 0x2AB32AB4,
+0x2A932AB3, 0x2A9332B3, 0x2A9332B3, 0x2A932AB3, 0x2A932A93, 0x2A922A93, 0x2A922A93, 0x2A922A93,
+0x2A512250, 0x2A512250, 0x2A712250, 0x2A712251, 0x2A712251, 0x2A722271, 0x2A722271, 0x2A922271,
+0x2A922271, 0x2A922A72, 0x2A922A72, 0x2A922A92, 0x2A922A92, 0x2A932A92, 0x2A932A92, 0x32932A92,
+0x2AB32A92, 0x2AB32A92, 0x2AB32A92, 0x2AB32A93, 0x2AB32AB3, 0x32B32AB3, 0x2AD32AB3, 0x2AD32AB3,
+0x2AD32AB3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AF42AD3, 0x32F42AD3,
+0x2AD42AD4, 0x32F42AD4, 0x32F42AD4, 0x32F42AD4, 0x32F42AF4, 0x32F42AF4, 0x32F52AF4, 0x32F52AF4,
+0x32F42AF4, 0x32F52AF4, 0x32F42AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152B14,
+0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF5, 0x33152AF4, 0x33152B15,
+0x33152AF4, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15,
+0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15,
+0x33352B15, 0x33352B15, 0x33152B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33362B15, 0x33362B35,
+0x33362B15, 0x33362B35, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33362B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x2B152AF4, 0x33152AF4, 0x2B152AF4, 0x33152AF4, 0x2B152AF4, 0x2B152AF4, 0x2AF52AF4, 0x2AF52AF4,
+0x2AF52AF4, 0x32F52AF4, 0x2AF52AF4, 0x2AF42AD4, 0x2AF42AD4, 0x2AF42AD4, 0x2AF42AD4, 0x2AF42AD4,
+0x2AD42AD4, 0x2AD42AD4, 0x2AD42AB3, 0x2AD42AB3, 0x2AD32AB3, 0x2AD32AB3, 0x2AB32AB3, 0x2AB32AB3,
+0x2AB32A93, 0x2AB32A92, 0x2A932292, 0x2A932A92, 0x2A932A92, 0x2A932A92, 0x2A922A92, 0x2A922A72,
+0x2A512A71, 0x2A512A71, 0x2A512A71, 0x2A712A72, 0x2A712A72, 0x2A712A72, 0x2A712A92, 0x2A722A92,
+0x2A922A92, 0x2A922A93, 0x2A922A93, 0x2A9232B3, 0x2A9232B3, 0x2A923293, 0x2A9232B3, 0x2A9332B3,
+0x2AB332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332D3, 0x2AB332D4, 0x2AB332D3, 0x2AB332D4,
+0x2AD32AD4, 0x2AD332D4, 0x2AD32AD4, 0x2AD332D4, 0x2AD332F4, 0x2AD432F4, 0x2AD432F4, 0x2AF432F4,
+0x2AD432F4, 0x2AF432F5, 0x2AF432F5, 0x2AF43315, 0x2AF43315, 0x2AF43315, 0x2AF43315, 0x2AF53315,
+0x2AF43315, 0x2AF43315, 0x2AF43315, 0x2B143315, 0x2AF43315, 0x33153315, 0x2B143315, 0x33153315,
+0x2AF43315, 0x33153315, 0x2AF53315, 0x33153315, 0x2AF53315, 0x33153315, 0x2B153315, 0x2B153335,
+0x2B153315, 0x2B153335, 0x2B153315, 0x2B153335, 0x2B153315, 0x2B153335, 0x2B153315, 0x33153336,
+0x2B153335, 0x33153336, 0x2B153335, 0x33153336, 0x2B153335, 0x33153336, 0x2B153335, 0x33153336,
+0x2B153335, 0x33153336, 0x2B153335, 0x33153336, 0x33153336, 0x33353336, 0x33153336, 0x33353336,
+0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33353336,
+0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33353336,
+0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x2B153336, 0x33353336,
+0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33153336, 0x33153336, 0x33153336,
+0x2B153336, 0x33153336, 0x2B153315, 0x2B153336, 0x2B153336, 0x2B153336, 0x2B153315, 0x2B153335,
+0x2B153315, 0x2B153315, 0x2AF53315, 0x2B153315, 0x2AF53315, 0x2B153315, 0x2AF43315, 0x2AF53315,
+0x2AF43315, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AD432F5, 0x2AD42AF5, 0x2AD432F5,
+0x2AD42AF4, 0x2AD432D4, 0x2AD42AD4, 0x2AD432D4, 0x2AD32AD4, 0x2AD32AD4, 0x2AB32AD4, 0x2AB332D4,
+0x2AB32AB3, 0x2AB332B3, 0x2A932AB3, 0x2A932AB3, 0x2A932AB3, 0x2A9232B3, 0x2A922AB3, 0x2A923293,
+0x2A712A51, 0x2A712250, 0x2A712A51, 0x2A712271, 0x2A722271, 0x2A722271, 0x2A922272, 0x2A922272,
+0x2A922A92, 0x2A922A92, 0x2A932A92, 0x2A922A92, 0x32932A92, 0x2A932A92, 0x32B32A92, 0x2AB32A92,
+0x32B32AB3, 0x2AB32AB3, 0x2AB32AB3, 0x2AB32AB3, 0x2AD32AB3, 0x2AD32AB3, 0x32D42AB3, 0x2AD42AB3,
+0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x32F42AD4, 0x2AF42AD4, 0x32F42AD4, 0x32F42AF4,
+0x32F52AD4, 0x32F52AD4, 0x32F52AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF5, 0x33152AF4,
+0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152B14, 0x33152B14, 0x33152B14, 0x33152B14,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33353315, 0x33352B15, 0x33353315, 0x33352B15, 0x33353315, 0x33352B15, 0x33353315, 0x33352B15,
+0x33352B15, 0x33352B15, 0x33363315, 0x33352B15, 0x33363315, 0x33352B15, 0x33363315, 0x33352B15,
+0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15,
+0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33362B15, 0x33362B35, 0x33363335, 0x33362B35,
+0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35,
+0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35,
+0x33363335, 0x33362B35, 0x33363335, 0x33352B15, 0x33363335, 0x33352B15, 0x33362B15, 0x33352B15,
+0x33362B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x2B152B15, 0x33152AF5, 0x2B152AF4,
+0x2B152AF5, 0x2B152AF4, 0x2B152AF4, 0x2AF52AF4, 0x2AF52AD4, 0x2AF42AD4, 0x2AF52AD4, 0x2AF42AD4,
+0x2AF52AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AB3, 0x2AD42AB4, 0x2AD42AD3, 0x2AD42AB3, 0x2AD32AB3,
+0x2AB42AB3, 0x2AB32AB3, 0x2AB32AB3, 0x2AB32A93, 0x2A932A92, 0x2A932A92, 0x2A932A92, 0x2A922A72,
+0x2A512A71, 0x2A712A71, 0x2A712A71, 0x2A712A92, 0x2A722A92, 0x2A722A92, 0x2A922A92, 0x2A922A92,
+0x2A923293, 0x2A9232B3, 0x2A9232B3, 0x2A9232B3, 0x2A9332B3, 0x2A9232B3, 0x2AB332B3, 0x2AB332B3,
+0x2AB332B4, 0x2AB332B3, 0x2AB332D4, 0x2AB332D4, 0x2AB332D4, 0x2AD332D4, 0x2AD432D4, 0x2AD432D4,
+0x2AD432F4, 0x2AD432F4, 0x2AD432F4, 0x2AD432F4, 0x2AF432F4, 0x2AF432F5, 0x2AF432F5, 0x2AF43315,
+0x32F432F5, 0x32F432F5, 0x32F53315, 0x32F43315, 0x32F53315, 0x32F43315, 0x32F53315, 0x33153315,
+0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x2B143315,
+0x33153336, 0x2B153335, 0x33153336, 0x33153335, 0x33153336, 0x2B153335, 0x33153336, 0x33153335,
+0x33153336, 0x33153335, 0x33153336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353356, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353356,
+0x33363356, 0x33353356, 0x33363356, 0x33353356, 0x33363356, 0x33353356, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x2B153336,
+0x33353336, 0x33153336, 0x33153336, 0x33153336, 0x33153336, 0x33153336, 0x33153336, 0x2B153335,
+0x33153336, 0x2B153335, 0x2B153336, 0x2B153335, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315,
+0x2B153315, 0x2AF53315, 0x2AF53315, 0x2AF53315, 0x2AF532F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5,
+0x2AD432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD42AD4, 0x2AD432D4, 0x2AD32AD4, 0x2AD32AD4, 0x2AD32AD4,
+0x2AB332D4, 0x2AB32AD4, 0x2AB32AB3, 0x2A932AB3, 0x2A9332B3, 0x2A9332B3, 0x2A933293, 0x2A922A93,
+0x2A712A51, 0x2A712271, 0x2A712271, 0x2A722A71, 0x2A922271, 0x2A922A72, 0x2A922272, 0x2A932A92,
+0x2A922A92, 0x2A932A92, 0x2A932A92, 0x2A932A92, 0x2AB32A92, 0x32B32A92, 0x32B32AB3, 0x32B32AB3,
+0x2AB32AB3, 0x32B32AB3, 0x2AD42AB3, 0x32D42AB3, 0x2AD42AB3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3,
+0x2AF42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F42AD4, 0x32F42AF4, 0x32F42AF4, 0x32F42AF4, 0x32F52AF4,
+0x33152AF4, 0x33152AF4, 0x33152AF4, 0x32F52AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF5,
+0x33152AF5, 0x33152B15, 0x33152AF5, 0x33152AF5, 0x33152AF5, 0x33152AF5, 0x33152AF4, 0x33152B15,
+0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33363335, 0x33352B15, 0x33352B15, 0x33152B15, 0x33362B15, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33352B15, 0x33362B15, 0x33362B15, 0x33362B35, 0x33362B15, 0x33362B35, 0x33362B15, 0x33362B35,
+0x33362B15, 0x33362B35, 0x33362B15, 0x33362B35, 0x33362B15, 0x33362B35, 0x33362B15, 0x33362B35,
+0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33362B35, 0x33362B35, 0x33363335,
+0x33362B15, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335,
+0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335, 0x33362B35, 0x33363335,
+0x33362B35, 0x33362B35, 0x33362B35, 0x33362B35, 0x33362B15, 0x33362B35, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33352B15, 0x33352B15, 0x33362B15, 0x33152B15, 0x33352B15, 0x33152B15, 0x33352B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152AF4, 0x33152B15,
+0x2B152AF4, 0x33152AF4, 0x2B152AF4, 0x2B152AF4, 0x2B152AF4, 0x32F52AF4, 0x2AF42AD4, 0x2AF52AD4,
+0x2AF52AD4, 0x2AF42AD4, 0x2AF42AD4, 0x2AD42AD4, 0x2AD42AD3, 0x2AD42AD3, 0x2AD32AD3, 0x2AD42AB3,
+0x2AD32AB3, 0x2AD32AB3, 0x2AB32AB3, 0x2AB32AB3, 0x2AB32A92, 0x2AB32A92, 0x2A932A92, 0x2A932A92,
+0x2A712A71, 0x2A712A72, 0x2A712A92, 0x2A722A92, 0x2A722A92, 0x2A922A93, 0x2A922A92, 0x2A922A93,
+0x2A922A93, 0x2A9232B3, 0x2A923293, 0x2A9332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332D4,
+0x2AB332D3, 0x2AB332D4, 0x2AD332D4, 0x2AD332D4, 0x2AD332D4, 0x2AD332D4, 0x2AD332F4, 0x2AD432F4,
+0x2AD432F4, 0x2AF432F4, 0x2AF432F4, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF43315, 0x32F43315,
+0x2AF43315, 0x32F43315, 0x2AF43315, 0x32F43315, 0x32F43315, 0x33153315, 0x32F53315, 0x33153315,
+0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153336,
+0x2B153335, 0x33153336, 0x2B153335, 0x33353336, 0x33153335, 0x33353336, 0x33153336, 0x33353336,
+0x33153336, 0x33353336, 0x33153336, 0x33353336, 0x33153336, 0x33353336, 0x33153336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353356, 0x33353336, 0x33353356,
+0x33353336, 0x33353336, 0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356,
+0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356,
+0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356,
+0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356, 0x33353336, 0x33363356,
+0x2B353356, 0x33363356, 0x2B353356, 0x33363356, 0x33353336, 0x33353356, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x2B153336, 0x33353336, 0x2B153336, 0x33353336, 0x33153336, 0x33153336,
+0x2B153335, 0x33153336, 0x2B153315, 0x2B153335, 0x2B153315, 0x2B153315, 0x2B153315, 0x2B153315,
+0x2AF53315, 0x2B153315, 0x2AF53315, 0x2B153315, 0x2AF43315, 0x2AF43315, 0x2AF432F5, 0x2AF432F5,
+0x2AD432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD432F4, 0x2AD42AF4, 0x2AD432F4, 0x2AD32AD4, 0x2AD332D4,
+0x2AD32AD4, 0x2AB32AD4, 0x2AB32AD4, 0x2AB332D4, 0x2AB32AB3, 0x2A9332B3, 0x2A9332B3, 0x2A933293,
+0x2A722A71, 0x2A712271, 0x2A922271, 0x2A922271, 0x2A922A72, 0x2A922A72, 0x2A932A92, 0x2A932A92,
+0x2A932A92, 0x2A932A92, 0x32932A92, 0x2AB32A92, 0x32B32A92, 0x2AB32AB3, 0x32B32AB3, 0x2AB32AB3,
+0x32D42AB3, 0x2AD42AB3, 0x32D42AB3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AF42AD4, 0x2AF42AD3,
+0x32F42AD4, 0x32F42AD4, 0x32F52AF4, 0x32F42AF4, 0x32F52AF4, 0x32F52AF4, 0x33152AF4, 0x33152AF4,
+0x33152AF4, 0x33152AF4, 0x331532F4, 0x33152AF4, 0x33152B14, 0x33152B14, 0x33153315, 0x33152B15,
+0x33153315, 0x33152B15, 0x33153315, 0x33152B15, 0x33153315, 0x33352B15, 0x33352B15, 0x33352B15,
+0x33353315, 0x33352B15, 0x33353315, 0x33352B15, 0x33353315, 0x33352B15, 0x33353315, 0x33352B15,
+0x33363335, 0x33353335, 0x33353315, 0x33353335, 0x33363335, 0x33352B15, 0x33363335, 0x33363335,
+0x33363335, 0x33352B35, 0x33363335, 0x33352B35, 0x33563335, 0x33563335, 0x33563335, 0x33563335,
+0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335,
+0x33363335, 0x33363335, 0x33363335, 0x33363335, 0x33563335, 0x33363335, 0x33363335, 0x33563335,
+0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35,
+0x33562B35, 0x33562B35, 0x33563335, 0x33562B35, 0x33562B35, 0x33562B35, 0x33563335, 0x33562B35,
+0x33563335, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35,
+0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33362B35, 0x33362B35, 0x33362B35,
+0x33362B35, 0x33362B35, 0x33362B35, 0x33362B35, 0x33363335, 0x33352B15, 0x33353315, 0x33352B15,
+0x33353315, 0x33352B15, 0x33352B15, 0x33352B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152B15, 0x33152AF5, 0x32F52AF4, 0x32F52AF4, 0x2AF52AF4,
+0x2AF52AF4, 0x2AF52AD4, 0x32F52AD4, 0x2AF42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD4, 0x2AD42AD3,
+0x2AD42AD3, 0x2AD42AB3, 0x2AD42AB3, 0x2AB32AB3, 0x2AB42AB3, 0x2AB32A93, 0x2AB32A93, 0x2AB32A92,
+0x2A712A92, 0x2A712A92, 0x2A722A92, 0x2A922A92, 0x2A922A93, 0x2A922A93, 0x2A922A93, 0x2A922AB3,
+0x2A9332B3, 0x2A9232B3, 0x2A9332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332D4, 0x2AB332D4, 0x2AB332D4,
+0x2AD432D4, 0x2AD432D4, 0x2AD432D4, 0x2AD432F4, 0x2AD432F4, 0x2AD432F4, 0x2AF432F4, 0x2AF432F4,
+0x32F43315, 0x2AF43315, 0x32F43315, 0x32F43315, 0x32F43315, 0x32F43315, 0x32F53315, 0x33153315,
+0x32F53315, 0x33153315, 0x33153315, 0x33153315, 0x33153335, 0x33153335, 0x33153336, 0x33153315,
+0x33153316, 0x33153315, 0x33153336, 0x33153335, 0x33153336, 0x33153335, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353B56, 0x33353336, 0x33353B56, 0x33353356,
+0x33353356, 0x33353356, 0x33353356, 0x33353356, 0x33353356, 0x33353356, 0x33353356, 0x33353356,
+0x33353356, 0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356,
+0x33363356, 0x33363356, 0x33363B56, 0x33363356, 0x33363B56, 0x33363356, 0x33363B56, 0x33363356,
+0x33363356, 0x33563356, 0x33363356, 0x33353356, 0x33563356, 0x33563356, 0x33563356, 0x33563356,
+0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356,
+0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356,
+0x33363356, 0x33353356, 0x33363356, 0x33353356, 0x33363356, 0x33353356, 0x33353356, 0x33353336,
+0x33363356, 0x2B353356, 0x33353356, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353336, 0x33353336, 0x33153335, 0x33153336, 0x2B153335, 0x33153336, 0x2B153335,
+0x2B153336, 0x2B153315, 0x33153336, 0x2B153315, 0x2B153315, 0x2AF53315, 0x2AF53315, 0x2AF53315,
+0x2AF532F5, 0x2AF432F5, 0x2AF432F5, 0x2AD432F5, 0x2AD432F5, 0x2AD432F4, 0x2AD432F5, 0x2AD432F4,
+0x2AD432F4, 0x2AD32AD4, 0x2AD32AD4, 0x2AB332D4, 0x2AB332B4, 0x2AB332B3, 0x2A9332B3, 0x2A9332B3,
+0x2A922271, 0x2A922271, 0x2A922A71, 0x2A922A92, 0x2A922A92, 0x2A932A92, 0x2A932A92, 0x2A932A92,
+0x2A932A92, 0x32B32A92, 0x32B32A92, 0x32B32AB3, 0x2AB32AB3, 0x32D32AB3, 0x32D32AB3, 0x32D42AD3,
+0x32D42AD3, 0x32D42AD3, 0x2AF42AD3, 0x32F42AD3, 0x2AF42AD3, 0x2AF42AD4, 0x2AF42AD4, 0x32F42AD4,
+0x32F42AF4, 0x32F52AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4,
+0x33152B14, 0x33152B14, 0x33152AF4, 0x33152B14, 0x33152B14, 0x33353315, 0x33152B15, 0x33153315,
+0x33152B15, 0x33153315, 0x33152B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33352B15, 0x33362B15,
+0x33352B15, 0x33363335, 0x33362B15, 0x33363335, 0x33352B15, 0x33363335, 0x33363335, 0x33363335,
+0x33362B35, 0x33363335, 0x33352B35, 0x33563335, 0x33362B35, 0x33563335, 0x33362B35, 0x33563335,
+0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33362B35, 0x33563335, 0x33362B35, 0x33563335,
+0x33362B35, 0x33563335, 0x33563335, 0x33563335, 0x33562B35, 0x33563335, 0x33562B35, 0x33563335,
+0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335,
+0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33562B35, 0x33563355,
+0x33562B35, 0x33562B56, 0x33562B55, 0x33562B56, 0x33562B55, 0x33562B56, 0x33562B55, 0x33562B56,
+0x33562B55, 0x33562B56, 0x33562B55, 0x33562B56, 0x33562B55, 0x33562B56, 0x33562B55, 0x33562B56,
+0x33562B35, 0x33563356, 0x33562B35, 0x33563356, 0x33562B35, 0x33563356, 0x33562B35, 0x33562B35,
+0x33362B35, 0x33562B35, 0x33362B35, 0x33562B35, 0x33362B35, 0x33362B35, 0x33352B35, 0x33363335,
+0x33362B15, 0x33362B15, 0x33352B15, 0x33362B15, 0x33352B15, 0x33352B15, 0x33152B15, 0x33152B15,
+0x33152B15, 0x33152B15, 0x33152B15, 0x33152AF5, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x32F52AF4,
+0x2AF52AF4, 0x2AF52AF4, 0x2AF42AD4, 0x2AF52AD4, 0x2AF42AD4, 0x2AF42AD4, 0x2AD42AD4, 0x2AD42AD4,
+0x2AD42AD3, 0x2AD42AD3, 0x2AD42AD3, 0x2AD42AB3, 0x2AD32AB3, 0x2AB32AB3, 0x2AB32A92, 0x2AB32A93,
+0x2A922A92, 0x2A922A92, 0x2A922A92, 0x2A923293, 0x2A9232B3, 0x2A9232B3, 0x2A923293, 0x2A9332B3,
+0x2A9332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332D4, 0x2AB332D3, 0x2AB332D4, 0x2AD332D4, 0x2AD332D4,
+0x2AD332D4, 0x2AD432D4, 0x2AD432F4, 0x2AF432F4, 0x2AF432F4, 0x2AF432F5, 0x2AF432F4, 0x2AF432F5,
+0x2AF43315, 0x2AF43315, 0x2AF43315, 0x32F43315, 0x32F43315, 0x33153315, 0x33153315, 0x33153315,
+0x33153315, 0x33153335, 0x33153315, 0x33153335, 0x33153315, 0x33153335, 0x33153315, 0x33153336,
+0x33153336, 0x33153336, 0x33153336, 0x33353336, 0x33153336, 0x33353336, 0x33353336, 0x33353336,
+0x33353336, 0x33353356, 0x33353336, 0x33363356, 0x33353336, 0x33353356, 0x33363356, 0x33363B56,
+0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356,
+0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356,
+0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33353356,
+0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33353356, 0x33563356, 0x33563356, 0x33563356,
+0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356,
+0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563376, 0x33563376, 0x33563356, 0x33563376,
+0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376,
+0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33363356, 0x33563356,
+0x33363356, 0x33363356, 0x2B353356, 0x33363356, 0x33353336, 0x33363356, 0x33353356, 0x33353336,
+0x33353336, 0x33353336, 0x33153336, 0x33353336, 0x33153336, 0x33353336, 0x33153336, 0x33153336,
+0x2B153335, 0x2B153335, 0x2B153315, 0x33153315, 0x2AF53315, 0x2AF53315, 0x2AF53315, 0x2AF53315,
+0x2AF43315, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AD432F4, 0x2AD432F4,
+0x2AD432F4, 0x2AD332D4, 0x2AD32AD4, 0x2AD332D4, 0x2AD332D4, 0x2AB332D4, 0x2AB332B3, 0x2AB332B3,
+0x2A922272, 0x2A922272, 0x2A922A92, 0x2A922A92, 0x32B32A92, 0x2AB32A92, 0x32B32A92, 0x2AB32A92,
+0x32B32A92, 0x32B32AB2, 0x32B32AB3, 0x2AB32AB3, 0x32D42AB3, 0x32D42AB3, 0x32D42AD3, 0x32D42AD3,
+0x32D42AD3, 0x2AF42AD3, 0x32F42AD4, 0x32F42AD4, 0x32F52AF4, 0x32F42AF4, 0x32F52AF4, 0x33152AF4,
+0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x331532F4, 0x33152AF4, 0x33153315, 0x33152B15,
+0x33153315, 0x33152B14, 0x33153315, 0x33353315, 0x33353315, 0x33352B15, 0x33353315, 0x33352B15,
+0x33363315, 0x33353315, 0x3B363315, 0x33363335, 0x33363335, 0x33353335, 0x33363335, 0x33363335,
+0x3B363335, 0x3B363335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335,
+0x33563335, 0x33563355, 0x33563335, 0x33563335, 0x33563335, 0x33563355, 0x33563335, 0x33563355,
+0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563355, 0x33563355, 0x33563355,
+0x33563335, 0x33563355, 0x33563355, 0x33563355, 0x33563335, 0x33563355, 0x33563335, 0x33563355,
+0x33563355, 0x33563355, 0x33563355, 0x33563355, 0x33563355, 0x33563355, 0x3B563356, 0x33563355,
+0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563355, 0x33563355, 0x33563355, 0x33563355,
+0x33563356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33563356, 0x33562B55, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33562B35,
+0x33563356, 0x33562B35, 0x33563335, 0x33562B35, 0x33563335, 0x33563335, 0x33563335, 0x33363335,
+0x33363335, 0x33363335, 0x33363335, 0x33363335, 0x33363335, 0x33353335, 0x33363315, 0x33352B15,
+0x33353315, 0x33153315, 0x33153315, 0x33152B15, 0x33153315, 0x33152AF5, 0x33152AF5, 0x33152AF5,
+0x33152AF5, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x32F52AF4, 0x2AF52AF4, 0x2AF52AD4, 0x2AF42AD4,
+0x32D42AD4, 0x2AD42AD4, 0x2AD42AD3, 0x2AD42AD3, 0x32D42AD3, 0x2AB42AB3, 0x2AB32AB3, 0x2AB32AB3,
+0x2A922A92, 0x2A922A92, 0x2A922A93, 0x2A922AB3, 0x2A9232B3, 0x2A9232B3, 0x2A9232B3, 0x2A9232B3,
+0x2AB332B3, 0x2AB332B3, 0x32B332D3, 0x2AB332D4, 0x2AB332D4, 0x2AD332D4, 0x2AD332D4, 0x2AD332D4,
+0x32D432F4, 0x2AD432F4, 0x2AF432F4, 0x2AF432F4, 0x2AF432F5, 0x2AF432F5, 0x32F43315, 0x2B143315,
+0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153315,
+0x33153335, 0x33153335, 0x33153335, 0x33353335, 0x33353336, 0x33353335, 0x33353336, 0x33353336,
+0x33353B36, 0x33353B36, 0x33353B36, 0x33353356, 0x33353336, 0x33353336, 0x33353B56, 0x33353B56,
+0x33353B56, 0x33353B56, 0x33363B56, 0x33563B56, 0x33563B56, 0x33363B56, 0x33363B56, 0x33363B56,
+0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33553B56, 0x33563B56, 0x33553B56,
+0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56,
+0x33563B56, 0x33563B76, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B76, 0x33563B56, 0x33563B56,
+0x33563B56, 0x33563B56, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563376, 0x33563B76, 0x33563356, 0x33563B76, 0x33563376, 0x33563B76, 0x33563376,
+0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376,
+0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563376,
+0x33563376, 0x33563376, 0x33563B76, 0x33563376, 0x33563B76, 0x33563376, 0x33563B76, 0x33563356,
+0x33563376, 0x33563356, 0x33563356, 0x33563356, 0x33563B56, 0x33363356, 0x33563B56, 0x33353B56,
+0x33363B56, 0x33353356, 0x33363B56, 0x33353356, 0x33353B56, 0x33353336, 0x33353336, 0x33153336,
+0x33353336, 0x33153335, 0x33153336, 0x33153335, 0x33153316, 0x33153315, 0x33153316, 0x33153315,
+0x33153315, 0x2AF53315, 0x32F53315, 0x2AF53315, 0x2AF532F5, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5,
+0x2AD432F5, 0x2AD432F4, 0x2AD432F4, 0x2AD432D4, 0x2AD432D4, 0x2AB332D4, 0x2AB332D4, 0x2AB332B3,
+0x2A922272, 0x2A932A92, 0x2A922A92, 0x32B32A92, 0x2AB32A92, 0x32B32A92, 0x32B32A92, 0x32B32A92,
+0x2AD32AB2, 0x32B32AB3, 0x2AB32AB3, 0x32D32AB3, 0x32D32AB3, 0x32D42AB3, 0x32D42AD3, 0x32D42AD3,
+0x32F42AD4, 0x32F42AD4, 0x32F42AF4, 0x32F42AF4, 0x32F42AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4,
+0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x33152B14, 0x33152B14, 0x33152B14, 0x33353315,
+0x33152B15, 0x33153315, 0x33153315, 0x33353315, 0x33153315, 0x33352B15, 0x33352B15, 0x33363335,
+0x33352B15, 0x33363335, 0x33363335, 0x33363335, 0x33363335, 0x33563335, 0x33563335, 0x33563335,
+0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563355, 0x33563335, 0x33563335,
+0x33563335, 0x33563355, 0x33563335, 0x33563355, 0x33563335, 0x33563355, 0x33563335, 0x33563355,
+0x33563335, 0x33563355, 0x33563335, 0x33563355, 0x33562B35, 0x33563355, 0x33563355, 0x33563356,
+0x33563355, 0x33563356, 0x33562B35, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563356,
+0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33763356, 0x33563355, 0x33563356,
+0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33763356, 0x33563356, 0x33563356,
+0x33562B55, 0x33763356, 0x33762B55, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33762B56, 0x33763356, 0x33562B56, 0x33763356, 0x33562B56, 0x33763356, 0x33562B56, 0x33763356,
+0x33562B56, 0x33563356, 0x33562B55, 0x33563356, 0x33563356, 0x33563335, 0x33563335, 0x33563336,
+0x33563335, 0x33563335, 0x33363335, 0x33363335, 0x33362B35, 0x33362B35, 0x33352B15, 0x33363335,
+0x33352B15, 0x33362B15, 0x33152B15, 0x33153315, 0x33152B15, 0x33152B15, 0x33152AF4, 0x33152AF5,
+0x33152B14, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x32F42AF4, 0x32F42AF4, 0x32F42AF4, 0x32F52AD4,
+0x2AF42AD4, 0x2AF42AD4, 0x2AD42AD3, 0x2AD42AD3, 0x32D42AD3, 0x32D32AD3, 0x2AB32AB3, 0x32B32AB3,
+0x2A922A93, 0x2A9232B3, 0x2A9232B3, 0x2A9232B3, 0x2A9232B3, 0x2A9332B3, 0x2A9332B3, 0x2AB332B3,
+0x2AD332D3, 0x2AD332D4, 0x2AB332D4, 0x2AD332D4, 0x2AD332D4, 0x32D432D4, 0x2AD432F4, 0x2AD432F4,
+0x2AD432F4, 0x2AF432F5, 0x2AF432F5, 0x2AF432F5, 0x2AF43315, 0x32F43315, 0x32F43315, 0x33153315,
+0x32F43315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33153335, 0x33153335, 0x33353335,
+0x33153315, 0x33153336, 0x33153336, 0x33353336, 0x33153336, 0x33353336, 0x33353336, 0x33353356,
+0x33353336, 0x33353356, 0x33353336, 0x33363B56, 0x33353356, 0x33563356, 0x33353356, 0x33563356,
+0x33353356, 0x33563B56, 0x33563356, 0x33563356, 0x33563356, 0x33563B56, 0x33563356, 0x33563B56,
+0x33363B56, 0x33563B56, 0x33563356, 0x33563B56, 0x33563356, 0x33563B56, 0x33563356, 0x33563B56,
+0x33563356, 0x33563B76, 0x33563B56, 0x33563B76, 0x33563356, 0x33563356, 0x33563356, 0x33563376,
+0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563356, 0x33563376,
+0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563376, 0x33763376, 0x33563376, 0x33563376,
+0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563356, 0x33563376, 0x33563376, 0x33563376,
+0x33563376, 0x33763376, 0x33563376, 0x33763376, 0x33563376, 0x33563376, 0x33563376, 0x33763376,
+0x33563376, 0x33763377, 0x33563376, 0x33763377, 0x33563376, 0x33763377, 0x33563376, 0x33763377,
+0x33563376, 0x33763377, 0x33563376, 0x33763376, 0x33563376, 0x33563376, 0x33563376, 0x33563376,
+0x33563376, 0x33563376, 0x33563376, 0x33563376, 0x33563356, 0x33563B56, 0x33363356, 0x33563B56,
+0x33363356, 0x33563356, 0x33363356, 0x33363356, 0x33363356, 0x33353356, 0x33353336, 0x33353336,
+0x33153336, 0x33353336, 0x33153336, 0x33153336, 0x33153336, 0x33153336, 0x33153315, 0x33153315,
+0x33153315, 0x33153315, 0x32F43315, 0x32F43315, 0x2AF43315, 0x2AF43315, 0x2AF432F5, 0x2AF432F5,
+0x2AF432F5, 0x2AF432F5, 0x2AD432F4, 0x2AD432F4, 0x2AD332D4, 0x2AD332D4, 0x2AB332D4, 0x2AB332D4,
+0x32B32A92, 0x2AB32A92, 0x32B32A92, 0x2A922A92, 0x32B32A92, 0x32B32A92, 0x32B32AB3, 0x32B32AB3,
+0x32D42AB3, 0x32D42AB3, 0x32D42AB3, 0x32D42AB3, 0x32D42AD3, 0x32D42AD3, 0x32F42AD4, 0x32F42AD4,
+0x32F42AD4, 0x32F42AF4, 0x32F52AF4, 0x32F52AF4, 0x33152AF4, 0x33152AF4, 0x331532F4, 0x33152AF4,
+0x331532F4, 0x33153314, 0x33153315, 0x33153315, 0x33153315, 0x33353315, 0x33353315, 0x33353315,
+0x33353315, 0x33353315, 0x33363315, 0x33353335, 0x33363335, 0x33363335, 0x33363335, 0x33563335,
+0x33563335, 0x33563335, 0x33563335, 0x33563355, 0x33563335, 0x33563335, 0x33563355, 0x33563355,
+0x33563355, 0x33563355, 0x33563355, 0x33563355, 0x3B563356, 0x33563355, 0x3B563356, 0x33563355,
+0x3B563356, 0x33563355, 0x3B563356, 0x33563355, 0x3B563356, 0x33563355, 0x33563356, 0x33563355,
+0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355,
+0x33563356, 0x33763355, 0x33563356, 0x33563355, 0x33763356, 0x33563355, 0x33563356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763376,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763376, 0x33763376, 0x33763356, 0x33763356, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33763356, 0x33763376, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33563356, 0x33563356, 0x33563356, 0x33563335,
+0x33563356, 0x33563355, 0x33563356, 0x33563335, 0x33563336, 0x33563335, 0x33363335, 0x33362B35,
+0x33363335, 0x33363335, 0x33363335, 0x33352B15, 0x33353315, 0x33153315, 0x33153315, 0x33153315,
+0x33153315, 0x33152B14, 0x33152B14, 0x33152AF4, 0x331532F4, 0x32F52AF4, 0x32F52AF4, 0x32F42AF4,
+0x32F52AF4, 0x32F42AF4, 0x32F42AD4, 0x32F42AD4, 0x32F42AD4, 0x32D42AD3, 0x32D42AD3, 0x2AD32AB3,
+0x2A9232B3, 0x2A9232B3, 0x2A9232B3, 0x2A9232B3, 0x2AB332B3, 0x2AB332B3, 0x32B332B3, 0x2AD332D3,
+0x2AD332D4, 0x2AD332D4, 0x32D332D4, 0x32D332D4, 0x32D432F4, 0x32D432F4, 0x32D432F4, 0x2AF432F4,
+0x32F432F5, 0x32F432F4, 0x32F532F5, 0x32F43315, 0x33153315, 0x33153315, 0x33153315, 0x33153315,
+0x33153315, 0x33153335, 0x33153B35, 0x33153335, 0x33153335, 0x33353335, 0x33353B36, 0x33353B35,
+0x33353B36, 0x33353B36, 0x33353B36, 0x33353356, 0x33353B56, 0x33353356, 0x33363B56, 0x33353B56,
+0x33363B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56,
+0x33563B76, 0x33563B56, 0x33563B56, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563376, 0x33563B76, 0x33563376,
+0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563376, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563B76, 0x33763B76, 0x33763376, 0x33763B76, 0x33763376, 0x33763B76, 0x33763376,
+0x33763B77, 0x33763376, 0x33763B77, 0x33763376, 0x33763B77, 0x33763B77, 0x33763B77, 0x33763B77,
+0x33763B77, 0x33763B76, 0x33763B77, 0x33763376, 0x33763B97, 0x33763396, 0x33763B97, 0x33763396,
+0x33763376, 0x33763376, 0x33763377, 0x33763376, 0x33763B97, 0x33763397, 0x33763377, 0x33763397,
+0x33763B77, 0x33763B77, 0x33763B77, 0x33763376, 0x33763B77, 0x33763B77, 0x33763B77, 0x33763376,
+0x33763B77, 0x33763376, 0x33763B77, 0x33763376, 0x33563B77, 0x33563B76, 0x33563B76, 0x33563B56,
+0x33563B76, 0x33563356, 0x33563356, 0x33563B56, 0x33563B56, 0x33563B56, 0x33363B56, 0x33353356,
+0x33363B56, 0x33353356, 0x33353336, 0x33353336, 0x33153B36, 0x33153336, 0x33153B36, 0x33153335,
+0x33153335, 0x33153335, 0x33153335, 0x33153315, 0x33153315, 0x32F43315, 0x32F53315, 0x2AF43315,
+0x2AF53315, 0x2AF432F5, 0x2AF432F5, 0x2AF432F4, 0x2AF432F4, 0x2AD332F4, 0x2AD332D4, 0x2AD332D4,
+0x2AB32A92, 0x32B32A92, 0x32B32A92, 0x32B32A92, 0x32B32A92, 0x32B32AB3, 0x32D32AB2, 0x32D32AB3,
+0x32D32AB3, 0x32D42AB3, 0x32D42AD3, 0x32D42AD3, 0x32D42AD3, 0x32F42AD4, 0x32F42AD3, 0x32F42AF4,
+0x32F42AF4, 0x33142AF4, 0x33142AF4, 0x331532F4, 0x33142AF4, 0x33153314, 0x33152AF4, 0x33153314,
+0x33152AF4, 0x33153315, 0x33152B14, 0x33353315, 0x33353315, 0x33353315, 0x33353315, 0x33353335,
+0x33352B15, 0x33363335, 0x33363335, 0x33563335, 0x33363335, 0x33563335, 0x33363335, 0x33563335,
+0x33563335, 0x33563355, 0x33563335, 0x33563355, 0x33563335, 0x33563355, 0x33563355, 0x33563356,
+0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33763356,
+0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33563356, 0x33563355, 0x33763356,
+0x33563356, 0x33763356, 0x33563356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33762B56, 0x33763376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33762B56, 0x33763376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33762B56, 0x33763376,
+0x33762B56, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33762B56, 0x33763376, 0x33762B56, 0x33763356, 0x33763356, 0x33763356, 0x33563356, 0x33763356,
+0x33563356, 0x33563356, 0x33563356, 0x33563356, 0x33562B35, 0x33563336, 0x33363335, 0x33563335,
+0x33362B35, 0x33363335, 0x33353335, 0x33363335, 0x33352B15, 0x33363335, 0x33153315, 0x33153315,
+0x33153315, 0x33153315, 0x33152B15, 0x33152B14, 0x33152B14, 0x33152AF4, 0x33152AF4, 0x33152AF4,
+0x32F42AF4, 0x32F42AF4, 0x2AF42AF4, 0x32F42AD4, 0x32F42AD3, 0x32F42AD3, 0x32D32AD3, 0x32D42AD3,
+0x2A9232B3, 0x2A9232B3, 0x2AB232B3, 0x2AB332B3, 0x2AB332B3, 0x32B332D3, 0x2AD332D3, 0x32D332D4,
+0x2AD332D4, 0x32D332D4, 0x2AD332D4, 0x32D432D4, 0x32D332F4, 0x32D432F4, 0x32F432F4, 0x32F43315,
+0x32F43315, 0x32F43315, 0x32F43315, 0x33143315, 0x33143315, 0x33143315, 0x33153315, 0x33153335,
+0x33153315, 0x33153335, 0x33153335, 0x33353335, 0x33353335, 0x33353B36, 0x33353335, 0x33353336,
+0x33353336, 0x33353356, 0x33353356, 0x33363B56, 0x33353356, 0x33363B56, 0x33363B56, 0x33563B56,
+0x33563356, 0x33563B56, 0x33563356, 0x33563B76, 0x33563B56, 0x33563B76, 0x33563B56, 0x33563B76,
+0x33563376, 0x33563B76, 0x33563376, 0x33563B76, 0x33563376, 0x33563B76, 0x33563376, 0x33563B76,
+0x33563356, 0x33563376, 0x33563376, 0x33563B76, 0x33563356, 0x33563376, 0x33563376, 0x33763376,
+0x33563376, 0x33563B76, 0x33563376, 0x33763376, 0x33563376, 0x33763376, 0x33763376, 0x33763B77,
+0x33763376, 0x33763B77, 0x33763376, 0x33763B77, 0x33563376, 0x33763376, 0x33763376, 0x33763B77,
+0x33563376, 0x33763376, 0x33763376, 0x33763B77, 0x33763376, 0x33763397, 0x33763376, 0x33763397,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763397,
+0x33763376, 0x33763397, 0x33763376, 0x33763397, 0x33763376, 0x33763397, 0x33763376, 0x33763397,
+0x33763397, 0x33763397, 0x33763376, 0x33763B97, 0x33763397, 0x33763397, 0x33763377, 0x33763397,
+0x33763377, 0x33763B97, 0x33763377, 0x33763397, 0x33763397, 0x33763397, 0x33763377, 0x33763397,
+0x33763376, 0x33763377, 0x33763376, 0x33763377, 0x33763B77, 0x33763377, 0x33563B77, 0x33563B77,
+0x33563376, 0x33563B77, 0x33563356, 0x33563376, 0x33563356, 0x33563B56, 0x33363356, 0x33363B56,
+0x33363356, 0x33363356, 0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33153336, 0x33153336,
+0x33153336, 0x33153336, 0x33153315, 0x33153335, 0x33153315, 0x33153315, 0x32F43315, 0x32F43315,
+0x2AF43315, 0x2AF43315, 0x2AF43315, 0x2AF432F5, 0x2AF432F4, 0x2AD432F4, 0x2AD332F4, 0x2AD332D4,
+0x32B32A92, 0x32B32A92, 0x32B32A92, 0x32B32AB3, 0x32D32AB3, 0x32D32AB3, 0x32D32AD3, 0x32D42AD3,
+0x32D42AB3, 0x32D432D3, 0x32D432D3, 0x32F42AD3, 0x32F432D4, 0x32F42AD4, 0x32F42AF4, 0x33142AF4,
+0x331532F4, 0x331532F4, 0x331532F4, 0x33153314, 0x33153314, 0x33153314, 0x33153314, 0x33153314,
+0x33353315, 0x33353315, 0x33353315, 0x33353335, 0x33353335, 0x33353335, 0x33353335, 0x33363335,
+0x33563335, 0x33563335, 0x3B563335, 0x33563335, 0x33563355, 0x33563355, 0x33563355, 0x33563355,
+0x3B563356, 0x33563355, 0x3B563356, 0x33563355, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x3B763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33963376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33963376, 0x33962B76, 0x33963376, 0x33962B76, 0x33963376, 0x33962B76, 0x33963376, 0x33962B76,
+0x33763376, 0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33962B76, 0x33963376, 0x33963376,
+0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376,
+0x33973376, 0x33963376, 0x33763376, 0x33963376, 0x33973376, 0x33963376, 0x33973376, 0x33963376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763356, 0x33763356,
+0x33763376, 0x33763356, 0x33763356, 0x33763356, 0x33563356, 0x33563356, 0x33563356, 0x33563355,
+0x33563336, 0x33563335, 0x33563335, 0x33563335, 0x33363335, 0x33363335, 0x33363335, 0x33353335,
+0x33353315, 0x33153315, 0x33153315, 0x33153315, 0x33153315, 0x33152B14, 0x33153315, 0x33142B14,
+0x331532F4, 0x33152AF4, 0x32F52AF4, 0x32F52AF4, 0x32F42AF4, 0x32F42AD4, 0x32F42AD4, 0x2AF42AD3,
+0x32B332B3, 0x2AB332B3, 0x2AB332B3, 0x2AB332D3, 0x2AD332D3, 0x2AD332D3, 0x32D332D4, 0x32D432F4,
+0x32D432D4, 0x32D432F4, 0x32D432F4, 0x32D432F4, 0x32F432F5, 0x32F432F4, 0x32F43315, 0x32F43315,
+0x33143315, 0x33143315, 0x33153B15, 0x33143315, 0x33153B35, 0x33153335, 0x33153B35, 0x33153335,
+0x33153335, 0x33353335, 0x33353B36, 0x33353B56, 0x33353B36, 0x33353335, 0x33353B56, 0x33353B56,
+0x33363B56, 0x33353B56, 0x33563B56, 0x33563B56, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33763B76,
+0x33563B76, 0x33763B76, 0x33563B77, 0x33563B76, 0x33763B77, 0x33763B76, 0x33563B77, 0x33563B76,
+0x33763B77, 0x33763B76, 0x33763B77, 0x33763B76, 0x33763B77, 0x33763B76, 0x33763B77, 0x33763B76,
+0x33763B77, 0x33763B76, 0x33763B77, 0x33763B97, 0x33763B77, 0x33763B76, 0x33763B97, 0x33763396,
+0x33763B97, 0x33763396, 0x33763B97, 0x33763396, 0x33763B97, 0x33763396, 0x33763B97, 0x33763396,
+0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763396, 0x33763B97, 0x33763396,
+0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397,
+0x33763B97, 0x33763B97, 0x33763B97, 0x33963B97, 0x33963397, 0x33963397, 0x33963397, 0x33963397,
+0x33963B97, 0x33763B97, 0x33763B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33763B97,
+0x33763B97, 0x33963B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97,
+0x33763B97, 0x33763B97, 0x33763B97, 0x33763397, 0x33763B97, 0x33763397, 0x33763B77, 0x33763376,
+0x33763B77, 0x33763376, 0x33763B77, 0x33563B76, 0x33563B77, 0x33563B76, 0x33563B76, 0x33563376,
+0x33563B56, 0x33563B56, 0x33563B56, 0x33353356, 0x33353B56, 0x33353B56, 0x33353B56, 0x33353356,
+0x33153B36, 0x33153336, 0x33153B36, 0x33153335, 0x33153335, 0x33153335, 0x33153335, 0x2B143315,
+0x33153315, 0x32F43315, 0x32F43315, 0x2AF43315, 0x32F43315, 0x2AF432F4, 0x2AF432F5, 0x2AD432F4,
+0x32B32AB2, 0x32B32AB2, 0x32B32AB2, 0x32D32AB3, 0x32D32AD3, 0x32D42AB3, 0x32D42AD3, 0x32D42AD3,
+0x32D42AD3, 0x32D42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F42AD4, 0x32F42AF4, 0x33142AF4, 0x33142AF4,
+0x33152AF4, 0x33153314, 0x331532F4, 0x33153314, 0x33153314, 0x33153314, 0x33153314, 0x33353314,
+0x33353315, 0x33353335, 0x33353335, 0x33353335, 0x33353335, 0x33563335, 0x33363335, 0x33563335,
+0x33563335, 0x33563355, 0x33563335, 0x33563355, 0x33563335, 0x33563356, 0x33563355, 0x33563356,
+0x33563356, 0x33763356, 0x33563356, 0x33763356, 0x33563355, 0x33763356, 0x33763356, 0x33763356,
+0x33763356, 0x33763376, 0x33763356, 0x33763376, 0x33763356, 0x33763376, 0x33763356, 0x33763376,
+0x33763356, 0x33763376, 0x33763356, 0x33763376, 0x33763376, 0x33963376, 0x33763376, 0x33963376,
+0x33763356, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33963376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763376, 0x33963376, 0x33763376, 0x33963376, 0x33763376, 0x33963376,
+0x33962B76, 0x33973376, 0x33763376, 0x33973376, 0x33763376, 0x33963376, 0x33763376, 0x33973376,
+0x33963376, 0x33963376, 0x33962B76, 0x33973376, 0x33962B76, 0x33973396, 0x33962B76, 0x33973376,
+0x33763376, 0x33963376, 0x33963376, 0x33973376, 0x33963376, 0x33963396, 0x33962B76, 0x33973396,
+0x33963376, 0x33973376, 0x33963376, 0x33973376, 0x33973376, 0x3B973396, 0x33963376, 0x33973376,
+0x33973376, 0x33973376, 0x33973376, 0x33973376, 0x33973376, 0x33973376, 0x33763376, 0x33973376,
+0x33973376, 0x33973376, 0x33763376, 0x33973376, 0x33763376, 0x33973376, 0x33763376, 0x33763376,
+0x33763376, 0x33763376, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33563356, 0x33563356,
+0x33563356, 0x33562B35, 0x33563335, 0x33563355, 0x33563335, 0x33563335, 0x33363335, 0x33363335,
+0x33362B15, 0x33363335, 0x33352B15, 0x33363335, 0x33153315, 0x33353315, 0x33152B14, 0x33152B14,
+0x33152B14, 0x33152AF4, 0x33152AF4, 0x33152AF4, 0x32F42AF4, 0x32F42AF4, 0x32F42AF4, 0x32F42AF4,
+0x2AB332B3, 0x2AB332B3, 0x2AB332D3, 0x32D332D3, 0x2AD332D3, 0x32D332D4, 0x2AD332F4, 0x32D432F4,
+0x32D332D4, 0x32D432F4, 0x32F432F4, 0x32F432F4, 0x32F432F4, 0x32F43315, 0x32F43315, 0x33143315,
+0x33143315, 0x33153315, 0x33143315, 0x33153335, 0x33153335, 0x33153335, 0x33153335, 0x33153B35,
+0x33353335, 0x33353B36, 0x33353B36, 0x33353356, 0x33353356, 0x33563B56, 0x33363B56, 0x33563B56,
+0x33563356, 0x33563B56, 0x33563B56, 0x33563B76, 0x33563B56, 0x33563B76, 0x33563B76, 0x33563B76,
+0x33563376, 0x33563B76, 0x33563376, 0x33563B76, 0x33563B76, 0x33763B77, 0x33563B76, 0x33763B77,
+0x33763376, 0x33763B77, 0x33763376, 0x33763B77, 0x33763376, 0x33763B77, 0x33763376, 0x33763B77,
+0x33763B77, 0x33763B97, 0x33763B77, 0x33763B97, 0x33763376, 0x33763B97, 0x33763397, 0x33763B97,
+0x33763B77, 0x33763B97, 0x33763397, 0x33763B97, 0x33763397, 0x33763B97, 0x33763B97, 0x33763B97,
+0x33763397, 0x33763B97, 0x33763397, 0x33763B97, 0x33763397, 0x33763B97, 0x33763397, 0x33963B97,
+0x33963397, 0x33963B97, 0x33763397, 0x33963B97, 0x33763397, 0x33963B97, 0x33763B97, 0x33963B97,
+0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397, 0x33963397,
+0x33763B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963397, 0x33963BB7, 0x33963397, 0x33963397,
+0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33963B97, 0x33973B97, 0x33963B97, 0x33963B97, 0x33763B97, 0x33963B97, 0x33763B97, 0x33963B97,
+0x33763B97, 0x33963B97, 0x33763397, 0x33763B97, 0x33763397, 0x33763B97, 0x33763397, 0x33763397,
+0x33763B77, 0x33763B77, 0x33563377, 0x33763377, 0x33563376, 0x33563B77, 0x33563376, 0x33563B77,
+0x33563356, 0x33563356, 0x33563356, 0x33563B56, 0x33563356, 0x33563356, 0x33353356, 0x33353356,
+0x33353336, 0x33353336, 0x33353336, 0x33353336, 0x33153335, 0x33153335, 0x33153335, 0x33153335,
+0x33153315, 0x33153315, 0x2AF43315, 0x32F43315, 0x2AF43314, 0x2AF43315, 0x2AF43314, 0x2AF432F4,
+0x32B32AB3, 0x32D32AB3, 0x32D32AB3, 0x32D32AD3, 0x32D42AD3, 0x32D42AD3, 0x32F42AD3, 0x32F42AD3,
+0x32D432D3, 0x32F432D3, 0x32F432D4, 0x32F432F4, 0x331532F4, 0x331532F4, 0x33153314, 0x33153314,
+0x33153314, 0x33153314, 0x33353315, 0x33353314, 0x33353315, 0x33353314, 0x3B353315, 0x33353335,
+0x3B353335, 0x33353335, 0x33563335, 0x33553335, 0x3B563335, 0x33563335, 0x3B563356, 0x33563355,
+0x33563355, 0x33563355, 0x3B763356, 0x3B763356, 0x33763356, 0x33763356, 0x3B763356, 0x33763356,
+0x33763356, 0x33763356, 0x3B763356, 0x33763356, 0x3B763376, 0x33763376, 0x33763376, 0x33763376,
+0x3B763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x3B763376, 0x33763376,
+0x3B763376, 0x33763376, 0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376,
+0x3B973376, 0x33963376, 0x3B973376, 0x33963376, 0x33963376, 0x33963376, 0x3B973376, 0x33963376,
+0x33963376, 0x33963376, 0x3B973376, 0x33963376, 0x33963376, 0x33963376, 0x3B973376, 0x33963376,
+0x33973396, 0x33963396, 0x33973396, 0x3B973376, 0x3B973376, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973376, 0x3B973396, 0x3B973396, 0x33963376, 0x3B973376, 0x3B973396, 0x3B973376, 0x3B973376,
+0x3B973396, 0x3B973396, 0x3B973396, 0x33963396, 0x3B973376, 0x33B73396, 0x33973396, 0x33973396,
+0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973396, 0x33973376, 0x3B973376, 0x33973376, 0x3B973376, 0x33973376, 0x3B973376, 0x33963376,
+0x33973376, 0x33963376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763376,
+0x33763356, 0x33763356, 0x33763356, 0x33563355, 0x33563355, 0x33563355, 0x33563355, 0x33563335,
+0x33363335, 0x33363335, 0x33363335, 0x33353335, 0x33353315, 0x33352B15, 0x33352B15, 0x33153315,
+0x33153315, 0x33152B14, 0x33152B14, 0x33152AF4, 0x33152AF4, 0x32F52AF4, 0x32F42AF4, 0x32F42AF4,
+0x32B332D3, 0x32D332D3, 0x32D332D4, 0x32D332F4, 0x32D432F4, 0x32D432F4, 0x32D432F4, 0x32F432F4,
+0x32F432F4, 0x32F432F4, 0x32F432F4, 0x32F43315, 0x33143315, 0x33143315, 0x33153B15, 0x33153B35,
+0x33153B35, 0x33153335, 0x33153B35, 0x33353B35, 0x33353B35, 0x33353B35, 0x33353B36, 0x33353B56,
+0x33353B56, 0x33353B56, 0x33553B56, 0x33553B56, 0x33563B56, 0x33563B56, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33563B76, 0x33763B76, 0x33763B77, 0x33763B76,
+0x33563B76, 0x33763B76, 0x33763B77, 0x33763B76, 0x33763B77, 0x33763B97, 0x33763B97, 0x33763B97,
+0x33763B97, 0x33763B97, 0x33763B77, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97,
+0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33763B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33763B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33963B97, 0x33963BB7, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963BB7,
+0x33963B97, 0x33963B97, 0x33963BB7, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33963BB7, 0x33963B97, 0x3B973BB7, 0x33963B97, 0x33963B97, 0x33963BB7, 0x33973BB7, 0x33963BB7,
+0x3B973BB7, 0x33963BB7, 0x33963BB7, 0x33963BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x33973BB7,
+0x3B973BB7, 0x33973BB7, 0x3B973BB7, 0x33973BB7, 0x3B973BB7, 0x33973BB7, 0x33973BB7, 0x33963B97,
+0x33973B97, 0x33963B97, 0x33973B97, 0x33963B97, 0x33973B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33763B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B77, 0x33763B77, 0x33763B77, 0x33763B77,
+0x33563B77, 0x33763B77, 0x33563B77, 0x33563B76, 0x33563B56, 0x33563B56, 0x33563B56, 0x33563B56,
+0x33363B56, 0x33353B56, 0x33353B56, 0x33353336, 0x33353336, 0x33353335, 0x33353336, 0x33153335,
+0x33153335, 0x33153335, 0x33153335, 0x33153315, 0x32F53315, 0x32F43315, 0x32F43315, 0x2AF43315,
+0x32D32AB3, 0x32D32AD3, 0x32F32AD3, 0x32F42AD3, 0x32D42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F42AD3,
+0x32F42AF3, 0x331432F4, 0x33142AF4, 0x331532F4, 0x33152AF4, 0x33153314, 0x33153314, 0x33153314,
+0x33153314, 0x33353314, 0x33353315, 0x33353335, 0x33353335, 0x33353335, 0x33353335, 0x3B563335,
+0x33563335, 0x33563335, 0x33563335, 0x33563335, 0x33563355, 0x33563356, 0x33563355, 0x33563356,
+0x33563356, 0x33763356, 0x33563356, 0x33763356, 0x33763356, 0x33763356, 0x33763356, 0x33763356,
+0x33763375, 0x33963376, 0x33763376, 0x33963376, 0x33763376, 0x33963376, 0x33963376, 0x3B963376,
+0x33763376, 0x33963376, 0x33763376, 0x3B963376, 0x33963376, 0x33963376, 0x33963376, 0x33963376,
+0x33763376, 0x3B973376, 0x33963376, 0x33973376, 0x33973376, 0x3B973396, 0x33973376, 0x33973376,
+0x3B963376, 0x3B963396, 0x3B963376, 0x3B963396, 0x33963376, 0x33963376, 0x33963376, 0x33963376,
+0x33963376, 0x33973376, 0x33973376, 0x3B973396, 0x33963376, 0x3B973396, 0x33973376, 0x33973376,
+0x33973396, 0x33973396, 0x33973376, 0x3B973396, 0x33973376, 0x3B973396, 0x3B973396, 0x3B973396,
+0x33973376, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973376, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3BB73397, 0x3B973396, 0x3BB73397,
+0x3B973396, 0x3BB73397, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973396, 0x3B973396, 0x33973376, 0x3B973396, 0x33973376, 0x3B973396, 0x33973376, 0x33973376,
+0x33973376, 0x33973376, 0x33763376, 0x33973376, 0x33763376, 0x33763376, 0x33763356, 0x33763376,
+0x33763356, 0x33763376, 0x33563356, 0x33763356, 0x33563355, 0x33563356, 0x33563355, 0x33563355,
+0x33563335, 0x33563335, 0x33363335, 0x33363335, 0x33352B15, 0x33363335, 0x33352B15, 0x33352B15,
+0x33353315, 0x33353315, 0x33152B14, 0x33152B14, 0x33152AF4, 0x33152B14, 0x33152AF4, 0x33152AF4,
+0x2AD332D3, 0x32D332F4, 0x32D332F4, 0x32D332F4, 0x32D332F4, 0x32D432F4, 0x32F432F4, 0x32F432F4,
+0x32F43314, 0x33143314, 0x33143314, 0x33143315, 0x33143315, 0x33153335, 0x33143315, 0x33153B35,
+0x33153335, 0x33153B35, 0x33353335, 0x33353B36, 0x33353B36, 0x33353B56, 0x33353B56, 0x33553B56,
+0x33353B56, 0x33553B56, 0x33353B56, 0x33553B56, 0x33563B56, 0x33563B76, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33763B77, 0x33563B76, 0x33763B77, 0x33563B76, 0x33763B77, 0x33763B77, 0x33763B77,
+0x33763B96, 0x33763B96, 0x33763B96, 0x33963B97, 0x33763B96, 0x33963B97, 0x33763B96, 0x33963B97,
+0x33763396, 0x33963B97, 0x33963B96, 0x33963B97, 0x33963B96, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33763B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33963B97, 0x3B963BB7, 0x33963B97, 0x33963BB7, 0x33963B97, 0x33963BB7, 0x33963B97, 0x33963B97,
+0x33963B97, 0x33963B97, 0x33963B97, 0x33973BB7, 0x33963B97, 0x33963B97, 0x33963B97, 0x33963B97,
+0x33963397, 0x33963BB7, 0x33963B97, 0x33973BB7, 0x33963B97, 0x33973BB7, 0x33973BB7, 0x33973BB7,
+0x33963B97, 0x3B973BB7, 0x33963BB7, 0x33973BB7, 0x33963B97, 0x3B973BB7, 0x33963B97, 0x3B973BB7,
+0x33973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x33963BB7, 0x33973BB7, 0x33963B97, 0x3B973BB7,
+0x33973BB7, 0x3B973BB7, 0x33973BB7, 0x3B973BB7, 0x33973B97, 0x3B973BB7, 0x33973BB7, 0x3B973BB7,
+0x33973BB7, 0x3B973BB7, 0x33973BB7, 0x3B973BB7, 0x33973BB7, 0x3B973BB7, 0x33973B97, 0x33973BB7,
+0x33973BB7, 0x33973BB7, 0x33973B97, 0x33973BB7, 0x33963B97, 0x33973B97, 0x33963B97, 0x33973B97,
+0x33763B97, 0x33973B97, 0x33763B97, 0x33973B97, 0x33763B97, 0x33763B97, 0x33763377, 0x33763B77,
+0x33763377, 0x33763B77, 0x33563B76, 0x33563B76, 0x33563376, 0x33563B76, 0x33563B56, 0x33563B76,
+0x33363B56, 0x33563B56, 0x33353356, 0x33353356, 0x33353336, 0x33353356, 0x33153336, 0x33353336,
+0x33153335, 0x33353335, 0x33153335, 0x33153335, 0x33153315, 0x33153335, 0x2AF43315, 0x2B143315,
+0x32F42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F432D4, 0x32F42AD3, 0x32F432D4, 0x32F432F4,
+0x331432F4, 0x331432F4, 0x33153314, 0x33153314, 0x33153314, 0x33153314, 0x33353315, 0x33153315,
+0x33353315, 0x33353335, 0x3B353335, 0x33353335, 0x3B563335, 0x3B553335, 0x3B563335, 0x3B563335,
+0x3B563355, 0x3B563355, 0x3B563355, 0x3B563355, 0x3B763356, 0x3B763356, 0x3B763356, 0x3B763356,
+0x3B763356, 0x33763356, 0x3B763376, 0x3B763376, 0x3B763376, 0x3B763376, 0x3B773376, 0x3B763376,
+0x3B963376, 0x3B963376, 0x3B963376, 0x3B963396, 0x3B963396, 0x3B963396, 0x3B963396, 0x3B963396,
+0x3B963376, 0x3B963396, 0x3B963396, 0x3B963396, 0x3B963396, 0x3B963396, 0x3B973396, 0x3B963396,
+0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396,
+0x3B973396, 0x3B963396, 0x3BB73B96, 0x3BB73396, 0x3B973396, 0x3BB73396, 0x3B973396, 0x3B963396,
+0x3B973396, 0x3B973396, 0x3BB73396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3BB73396,
+0x3BB73396, 0x33B73396, 0x3BB73396, 0x3BB73396, 0x3BB73396, 0x3BB73396, 0x3BB73B97, 0x3B973B96,
+0x3B973B97, 0x3B973396, 0x3B973B96, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973B96, 0x3BB73396,
+0x3BB73B97, 0x3BB73396, 0x3BB73B97, 0x3BB73396, 0x3BB73396, 0x3BB73396, 0x3BB73396, 0x3BB73396,
+0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3B973B97, 0x3BB73396, 0x3BB73B97, 0x3B973B97,
+0x3BB73B97, 0x3BB73397, 0x3BB73B97, 0x3BB73397, 0x3BB73397, 0x3BB73396, 0x3BB73397, 0x3BB73396,
+0x3BB73397, 0x3BB73396, 0x3BB73397, 0x3BB73396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973396,
+0x33973396, 0x3B973396, 0x3B973396, 0x3B973376, 0x3B973396, 0x33763376, 0x3B773376, 0x33763376,
+0x3B773376, 0x33763376, 0x33763376, 0x33763356, 0x3B763356, 0x33763356, 0x33563356, 0x33563355,
+0x3B563356, 0x33563355, 0x33563335, 0x33563335, 0x33563335, 0x33363335, 0x33363335, 0x33353335,
+0x33353335, 0x33353315, 0x33353315, 0x33353315, 0x33153315, 0x33152B14, 0x33152B14, 0x33152AF4,
+0x32D332F4, 0x32F332F4, 0x32F332F4, 0x2AD332F4, 0x32F432F4, 0x32F432F4, 0x32F432F4, 0x32F43314,
+0x33143315, 0x33143315, 0x33143335, 0x33153335, 0x33153B35, 0x33153B35, 0x33153B35, 0x33353B35,
+0x33353B36, 0x33353B35, 0x33353B56, 0x33353B56, 0x33353B56, 0x33553B56, 0x3B553B56, 0x33553B56,
+0x3B563B76, 0x33563B76, 0x3B563B76, 0x33563B76, 0x3B763B77, 0x33763B76, 0x3B763B77, 0x33763B76,
+0x33763B77, 0x33763B76, 0x33763B77, 0x33763B97, 0x3B763B97, 0x33763B97, 0x3B763B97, 0x33763B97,
+0x33963B97, 0x33963B96, 0x3B963B97, 0x33963B97, 0x3B963B97, 0x33963B97, 0x3B963BB7, 0x3B963BB7,
+0x33963B97, 0x33963BB7, 0x3B963BB7, 0x33963BB7, 0x3B963BB7, 0x33963BB7, 0x3B963BB7, 0x33963BB7,
+0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x33963BB7, 0x3B973BB7, 0x33963BB7,
+0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B973BB7,
+0x3B973BB7, 0x3B963BB7, 0x3B973BB7, 0x3B963BB7, 0x3B963BB7, 0x3B973BB7, 0x3B973BB7, 0x3BB73BB7,
+0x33B73BB7, 0x33B73BB7, 0x3B973BB7, 0x33B73BB7, 0x33B63BB7, 0x3B973BB7, 0x3B9743B7, 0x3BB63BB7,
+0x3B9743B7, 0x3B973BB7, 0x3B9743B7, 0x3BB63BB7, 0x3B973BB7, 0x3B973BB7, 0x3B963BB7, 0x3BB73BB7,
+0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x33963BB7, 0x3B973BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7,
+0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3BB73BB7, 0x3BB743B8, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB8, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x33973BB7,
+0x33973BB7, 0x33973B97, 0x33973B97, 0x33963B97, 0x33973BB7, 0x33763B97, 0x33763B97, 0x33763B97,
+0x33763B97, 0x33763B97, 0x33763B77, 0x33763B76, 0x33763B77, 0x33763B76, 0x33563B76, 0x33563B76,
+0x33563B76, 0x33563B76, 0x33563B56, 0x33563B56, 0x33363B56, 0x33353B56, 0x33353336, 0x33353336,
+0x33353B36, 0x33353B35, 0x33353B36, 0x33353335, 0x33153335, 0x33153335, 0x33153335, 0x2B143315,
+0x32F42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F42AD3, 0x32F432F4, 0x33142AF4, 0x331432F4,
+0x33142AF4, 0x33153314, 0x331432F4, 0x33353314, 0x33153314, 0x33353314, 0x33353314, 0x3B353335,
+0x33353315, 0x3B363335, 0x3B353335, 0x3B563335, 0x3B563335, 0x3B563355, 0x3B563335, 0x3B563355,
+0x33563356, 0x3B763356, 0x3B763356, 0x3B763356, 0x33763356, 0x33763356, 0x33763356, 0x33763376,
+0x33763376, 0x3B963376, 0x33963376, 0x3B963376, 0x33963376, 0x3B963376, 0x3B963376, 0x3B963396,
+0x3B963376, 0x3B963396, 0x3B963396, 0x3B973396, 0x3B963396, 0x3B973396, 0x3B963396, 0x3B973396,
+0x3B963396, 0x3B973396, 0x3B963396, 0x3BB73396, 0x3B973396, 0x3BB73396, 0x3B973396, 0x3BB73396,
+0x3B973396, 0x3BB73396, 0x3B973396, 0x3BB73396, 0x3B973396, 0x3BB73B96, 0x3BB73396, 0x3BB73396,
+0x3B973396, 0x3BB73B97, 0x3B973396, 0x3BB73B97, 0x3B973396, 0x3BB73397, 0x3BB73396, 0x3BB73397,
+0x3BB73397, 0x3BB733B6, 0x3B973B96, 0x3B973B97, 0x3BB73396, 0x3B973BB6, 0x43973B97, 0x3BB73376,
+0x33963396, 0x3BB733B7, 0x3BB73376, 0x3BB73397, 0x33B633B6, 0x43973396, 0x3B763B76, 0x3BB63BB6,
+0x3B963BB6, 0x3B983397, 0x3BB73B97, 0x3BD73396, 0x3BB73396, 0x3BB73B97, 0x3BB63396, 0x3BB73396,
+0x3BB73396, 0x3BB73BB7, 0x3BB73396, 0x3BB73BB7, 0x3BB73397, 0x3BB73BB7, 0x3BB73397, 0x3BB73BB7,
+0x3BB73396, 0x3BB73BB7, 0x3BB73397, 0x3BB73BB7, 0x3BB73397, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97,
+0x3BB73396, 0x3BB73BB7, 0x3BB73397, 0x3BB73397, 0x3BB73397, 0x3BB73BB7, 0x3BB73396, 0x3BB73397,
+0x3BB73396, 0x3BB73397, 0x3BB73396, 0x3BB73397, 0x3B973396, 0x3BB73396, 0x3BB73396, 0x3BB73396,
+0x3B973396, 0x3B973396, 0x3B973376, 0x3B973396, 0x33973396, 0x3B973396, 0x33963376, 0x33973376,
+0x33763376, 0x33763376, 0x33763376, 0x33763376, 0x33763356, 0x33763376, 0x33763356, 0x3B763356,
+0x33563356, 0x33563356, 0x33563335, 0x33563355, 0x33563335, 0x3B363335, 0x33353335, 0x33353335,
+0x33353335, 0x33353335, 0x33353315, 0x33353315, 0x33153314, 0x33153314, 0x33152AF4, 0x33153314,
+0x2AD332F4, 0x32F432F4, 0x32F432F4, 0x32F432F4, 0x32F432F4, 0x32F43314, 0x32F43314, 0x33143315,
+0x33143315, 0x33143B35, 0x33143315, 0x33153B35, 0x33153B35, 0x33353B35, 0x33353B35, 0x33353B35,
+0x33353B36, 0x33353B56, 0x33353B56, 0x33553B56, 0x33553B56, 0x3B563B56, 0x33563B56, 0x33563B76,
+0x33563B76, 0x33763B77, 0x33563B76, 0x33763B77, 0x33563B76, 0x33763B77, 0x33763B77, 0x33763B97,
+0x33763B96, 0x33963B97, 0x33763B96, 0x33963B97, 0x33963B97, 0x3B963B97, 0x33963B97, 0x3B963BB7,
+0x33963B97, 0x3B963BB7, 0x33963B97, 0x3B963BB7, 0x33963B97, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7,
+0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7,
+0x3B963BB7, 0x3BB73BB7, 0x3B963BB7, 0x3BB73BB7, 0x3B963BB7, 0x3BB73BB7, 0x3B963BB7, 0x3BB73BB7,
+0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3BB73BB7, 0x3B973BB7, 0x3BB73BB7,
+0x33973BB8, 0x3BB63BB7, 0x3B973BB7, 0x3B974398, 0x3BD73BB7, 0x3BB73BB7, 0x3B774397, 0x3B9743B8,
+0x43B643B7, 0x4B963B76, 0x4B345396, 0x43755396, 0x53B54BB5, 0x5B7463B5, 0x4B955B75, 0x33B643D7,
+0x3BD73B96, 0x3B9843B8, 0x33963B77, 0x33B643F8, 0x33B73BB7, 0x3BB73BB7, 0x3BB63BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BD8, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BD8, 0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BD8, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BD8, 0x3B973BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7, 0x3BB73BB7, 0x3B973BB7, 0x3BB73BB7, 0x3B973BB7, 0x3B973BB7,
+0x3B973BB7, 0x3B973BB7, 0x3B973B97, 0x33973BB7, 0x33963B97, 0x33963B97, 0x33963397, 0x33963BB7,
+0x33963B97, 0x33963B97, 0x33763B97, 0x33763B97, 0x33763B77, 0x33763B97, 0x33563B76, 0x33763B77,
+0x33563B76, 0x33563B76, 0x33563B56, 0x33563B76, 0x33363B56, 0x33363B56, 0x33353B56, 0x33353B56,
+0x33353B36, 0x33353B56, 0x33353335, 0x33353B36, 0x33153335, 0x33153B35, 0x33143315, 0x33143315,
+0x32F42AD3, 0x32F42AD3, 0x32F432F4, 0x32F432F4, 0x32F432F4, 0x331432F4, 0x33153314, 0x33353314,
+0x3B353314, 0x3B353314, 0x3B353314, 0x3B353314, 0x3B353335, 0x3B353335, 0x3B353335, 0x3B353335,
+0x3B563335, 0x3B563335, 0x3B563335, 0x3B563355, 0x3B563355, 0x3B563355, 0x3B763356, 0x3B763355,
+0x3B763356, 0x3B763356, 0x3B763376, 0x3B763376, 0x3B763376, 0x3B763376, 0x3B973376, 0x3B763376,
+0x3B963396, 0x3B963396, 0x3B963396, 0x3B963396, 0x3B973396, 0x3BB73396, 0x3BB73B96, 0x3BB73396,
+0x3BB73B96, 0x3BB73396, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96,
+0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96,
+0x3BB73BB6, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73396, 0x3BB73B96, 0x3BB73B96,
+0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97,
+0x3BB73B97, 0x3BB73B96, 0x3BB733B6, 0x3BB73B97, 0x33B83BB7, 0x3BB73397, 0x43563B76, 0x43554376,
+0x53754375, 0x63345355, 0x8B737B12, 0x6B328393, 0x41494A2D, 0x49064926, 0x5B111865, 0x33B73B95,
+0x33973BD7, 0x3BB83B97, 0x43D83BB7, 0x3BB73396, 0x3BB73BB7, 0x3BB733B7, 0x3BB73BB7, 0x3BB83B97,
+0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97,
+0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97,
+0x3BB73B97, 0x3BB73B96, 0x3BB73B97, 0x3B973B96, 0x3B973396, 0x3B973396, 0x3B973396, 0x3BB73396,
+0x3B973B96, 0x3B963396, 0x3B973396, 0x33963376, 0x3B973376, 0x33763376, 0x3B763376, 0x33763376,
+0x3B763356, 0x33763356, 0x33763356, 0x3B763356, 0x3B563356, 0x33563335, 0x3B563335, 0x3B553335,
+0x3B563335, 0x33353335, 0x3B353335, 0x33353335, 0x3B353315, 0x33353315, 0x33153315, 0x33153314,
+0x32F432F4, 0x32F432F4, 0x32F432F4, 0x32F43314, 0x32F43B15, 0x33143315, 0x33143B35, 0x33353B35,
+0x33153B35, 0x33143B35, 0x33153B35, 0x33353B35, 0x33353B36, 0x33353B35, 0x3B353B56, 0x3B353B56,
+0x3B353B56, 0x3B553B56, 0x3B563B56, 0x3B553B56, 0x3B563B76, 0x3B563B76, 0x3B563B76, 0x3B563B76,
+0x3B763B77, 0x3B763B76, 0x3B763B77, 0x33763B77, 0x33763B77, 0x33763B97, 0x3B763B97, 0x3B763B97,
+0x3B963B97, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3BB63BB7, 0x3BB73BB7, 0x3BB63BB7,
+0x3BB73BB7, 0x3BB63BB7, 0x3BB73BB7, 0x3BB63BB7, 0x3BB73BB7, 0x3BB63BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7,
+0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x43B743B7, 0x3BB743B7, 0x3BB743D7, 0x3BB743B7, 0x43B643B7, 0x5B9453B6, 0x73946B94, 0x7BB47374,
+0x8B738BB4, 0x8B118B52, 0x8A8E92CF, 0x30035928, 0x61054865, 0x506168E3, 0x10643062, 0x43B663D5,
+0x3BD83B97, 0x3BB743B8, 0x33B73BD8, 0x3BB743D8, 0x3BB743D8, 0x3BB73BB8, 0x3BB843D8, 0x3BB743B8,
+0x3BB743B8, 0x3BB743B7, 0x3BB743B8, 0x3BB743B8, 0x3BB743B8, 0x3BB743B7, 0x3BB743B8, 0x3BB743B8,
+0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8,
+0x3BB743B8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8, 0x3BB743B7,
+0x3BB743D8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8, 0x3BB73BB7, 0x3BB743B8, 0x3BB73BB7,
+0x3BB743B7, 0x3BB73BB7, 0x3B9743B7, 0x3B973BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7, 0x3B973BB7,
+0x3B963BB7, 0x3B963BB7, 0x33963BB7, 0x33963B97, 0x33763B97, 0x33763B97, 0x33763B77, 0x33763B77,
+0x33763B77, 0x33763B76, 0x33763B77, 0x33563B76, 0x33563B56, 0x33563B56, 0x3B553B56, 0x33553B56,
+0x33353B56, 0x33353B56, 0x33353B56, 0x33353B56, 0x33353B35, 0x33353B35, 0x33153B35, 0x33153B35,
+0x32F42AD3, 0x32F42AD3, 0x32F42AF3, 0x33142AF4, 0x33142AF4, 0x33153314, 0x33153314, 0x3B353314,
+0x33153314, 0x3B353314, 0x33353314, 0x3B353315, 0x33353315, 0x3B353335, 0x3B353335, 0x3B563335,
+0x3B563335, 0x3B563355, 0x3B563355, 0x3B563355, 0x3B563355, 0x3B763356, 0x3B763355, 0x3B763356,
+0x3B763355, 0x3B763376, 0x3B763376, 0x3B963376, 0x3B763376, 0x3B963376, 0x3B963376, 0x3B963376,
+0x3B963376, 0x3B973396, 0x3B973396, 0x3BB73396, 0x3BB73396, 0x3BB73B96, 0x3BB73396, 0x3BB73B96,
+0x3BB73396, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB6, 0x3BB73396, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97,
+0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x3BB73BB6,
+0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x43B73B96, 0x3BB73BB7, 0x43B73B96, 0x3BB733B7, 0x422E4354, 0x8A8D622C, 0xAB0E92CD, 0xBAEDB30E,
+0xB1A8B22A, 0xA9E9A947, 0x4843924A, 0x60634001, 0x70816841, 0x79448903, 0x102138C1, 0x6BD5318A,
+0x43F84396, 0x3BB73B96, 0x33B73BD7, 0x43D73BB7, 0x3BB73B97, 0x3BB83BB7, 0x3BB833B7, 0x43B83BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x43D73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7,
+0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3B973396, 0x3B973B97,
+0x3B973396, 0x3BB73396, 0x3B973396, 0x3B973376, 0x3B973376, 0x3B973376, 0x33763376, 0x33763376,
+0x33763376, 0x3B763376, 0x33763356, 0x33763356, 0x33563356, 0x3B563356, 0x33563335, 0x3B563355,
+0x3B563335, 0x3B563335, 0x33353335, 0x33353335, 0x33353335, 0x33353315, 0x33153314, 0x33353314,
+0x32F432F4, 0x32F432F4, 0x32F43314, 0x33143315, 0x33143315, 0x33143B35, 0x33143B35, 0x33353B35,
+0x33143B35, 0x33353B35, 0x33353B35, 0x33353B56, 0x33353B35, 0x3B353B56, 0x33353B56, 0x33553B56,
+0x33553B56, 0x33563B76, 0x33563B56, 0x33563B76, 0x33563B76, 0x3B763B76, 0x33763B76, 0x33763B76,
+0x33763B76, 0x33763B96, 0x33763B96, 0x33763B97, 0x33763B97, 0x3B963B97, 0x33763B97, 0x3B963B97,
+0x3B963B97, 0x3B963BB7, 0x3B963B97, 0x3BB73BB7, 0x3B963BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB743D7, 0x3BB73BB7, 0x3BB743D7, 0x3BB73BB7, 0x3BB743D7,
+0x3BB73BB7, 0x3BB743B8, 0x3BB73BB7, 0x3BB73BD8, 0x3BB73BB7, 0x3BB73BD8, 0x3BB73BD8, 0x3BB743D8,
+0x3BB73BD8, 0x3BB743D8, 0x3BB73BD8, 0x3BB743D8, 0x3BB73BD8, 0x3BB743D8, 0x3BB73BD8, 0x3BB743D8,
+0x3BB743D7, 0x3BB743D8, 0x3BB743B8, 0x3BB73BD8, 0x420D5BD6, 0x68E540C6, 0x70207083, 0x90417800,
+0xC986B0C3, 0x9946C9E8, 0x79C75883, 0xB26A9A09, 0xC2C9BA89, 0x92A7A206, 0x5AA7B4CE, 0x314930A4,
+0x3B955BF5, 0x3BD743B7, 0x3BD73BD8, 0x3BB643D7, 0x3BB743D7, 0x3BB743D8, 0x3BB73BD8, 0x3BB743D8,
+0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BD743D8,
+0x3BB743D8, 0x3BD743D8, 0x3BB743D8, 0x3BD743D8, 0x3BB743D8, 0x3BD743D8, 0x3BB743D8, 0x3BD743D8,
+0x3BB743D8, 0x3BD743D8, 0x3BB73BD8, 0x3BD743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB73BD8, 0x3BB743D8,
+0x3BB743B8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8, 0x3BB743B8, 0x3BB743D8,
+0x3BB73BB7, 0x3BB743B8, 0x3BB73BB7, 0x3BB743B8, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3BB73BB7,
+0x3B963BB7, 0x3B963BB7, 0x3B973BB7, 0x3B973B97, 0x33963B97, 0x33963B97, 0x33763B97, 0x33763B97,
+0x33763B77, 0x33763B77, 0x33563B77, 0x33763B77, 0x33563B76, 0x33563B77, 0x33563B56, 0x33563B56,
+0x33353B56, 0x33353B56, 0x33353B56, 0x33353B56, 0x33353B35, 0x33353B35, 0x33153B35, 0x33353B35,
+0x331432F4, 0x33142AF4, 0x331532F4, 0x33153314, 0x3B353314, 0x33353314, 0x3B353314, 0x3B353314,
+0x3B353334, 0x3B353334, 0x3B353335, 0x3B553335, 0x3B553335, 0x3B553335, 0x3B563355, 0x3B563355,
+0x3B563355, 0x3B763355, 0x3B763356, 0x3B763355, 0x3B763356, 0x3B763376, 0x3B763376, 0x3B763376,
+0x3B963376, 0x3B963376, 0x3B963376, 0x3B963396, 0x3B973B96, 0x3B973B96, 0x3B973B96, 0x3BB73B96,
+0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x3BB73BB6, 0x3BB73B96,
+0x3BB73BB6, 0x3BB73B96, 0x3BB73BB6, 0x3BB73BB6, 0x3BB73B97, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7,
+0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7,
+0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7,
+0x3BD73BD7, 0x3BD83BB7, 0x3BD83BB7, 0x3BD73BB7, 0x5BD63BB6, 0x59075AAF, 0xB9E799A7, 0xA124A986,
+0x80A390A2, 0x820B7106, 0xAB4EAB8F, 0xAA29AA6A, 0x60C199E7, 0x8BC85140, 0x7C298468, 0x28A35A66,
+0x5BF631EB, 0x339743B6, 0x3BD743F8, 0x43D73BB6, 0x43D73BB6, 0x3BD83BB7, 0x3BD83BB7, 0x3BD73BD6,
+0x43D73BD7, 0x43D73BB7, 0x43D73BD7, 0x43D73BB7, 0x43D73BB7, 0x3BD73BB7, 0x43D73BB7, 0x43D73BB7,
+0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7,
+0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7,
+0x43D83BB7, 0x43D83BB7, 0x43D83BD7, 0x3BD73BB7, 0x43D83BB7, 0x3BD73BB7, 0x43D83BB7, 0x3BB73BB7,
+0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97,
+0x3BB73B96, 0x3BB73B96, 0x3BB73B97, 0x3B973396, 0x3B973B96, 0x3B973396, 0x3B973396, 0x3B973376,
+0x3B973376, 0x33763376, 0x3B763376, 0x3B763376, 0x3B763376, 0x3B763356, 0x3B763356, 0x3B763355,
+0x3B563355, 0x33563355, 0x3B563335, 0x3B553335, 0x3B563335, 0x33353335, 0x3B353335, 0x3B353335,
+0x32F43315, 0x33143314, 0x33143B15, 0x33143B35, 0x33353B35, 0x33353B35, 0x33353B35, 0x33353B35,
+0x33353B55, 0x33353B55, 0x33353B36, 0x33353B55, 0x3B553B56, 0x3B553B56, 0x3B553B76, 0x33563B76,
+0x3B563B76, 0x3B563B76, 0x3B763B76, 0x3B763B76, 0x3B763B76, 0x33763B96, 0x3B763B97, 0x33763B96,
+0x3B963B97, 0x3B963B97, 0x3B963B97, 0x3B963B97, 0x3B963B97, 0x3B963BB7, 0x3B9743B7, 0x3BB73BB7,
+0x3B9743B7, 0x3BB743B7, 0x3BB743B7, 0x3BB743B7, 0x3BB743B7, 0x3BB743B7, 0x3BB743D7, 0x3BB743B7,
+0x3BB743D7, 0x3BB743B7, 0x3BB743D7, 0x3BB743B7, 0x3BB743B8, 0x3BB743B7, 0x3BB743B8, 0x3BB743B7,
+0x3BB743D8, 0x3BB73BB7, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8,
+0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743D8, 0x3BD743D8, 0x3BB743D8,
+0x3BD743D8, 0x3BB743D7, 0x3BD743D8, 0x3BB743D7, 0x3BD743D8, 0x3BD73BD7, 0x3BD743D8, 0x3BD73BD7,
+0x3BD73BF8, 0x3BD73BD8, 0x3BD83BD8, 0x3BD73BD8, 0x43B63BF8, 0x731063B5, 0x89256084, 0xA1869925,
+0x7147A208, 0x28A78BB2, 0x584150A4, 0x68007862, 0x48606880, 0x7C479C4A, 0x74267C87, 0x3101944A,
+0x428E20A4, 0x43D753D6, 0x3BD743D7, 0x3BB643F7, 0x3BD743D7, 0x3BD73BD8, 0x3BD73BD8, 0x3BD73BD7,
+0x3BD743F7, 0x3BD743D7, 0x3BD743D8, 0x3BD743D7, 0x3BD743D8, 0x3BD743D7, 0x3BD743D8, 0x3BD743D8,
+0x3BD743F8, 0x3BD743D8, 0x3BD743F8, 0x3BD743D8, 0x3BD743D8, 0x3BD73BD7, 0x3BD743D8, 0x3BD73BD7,
+0x3BD743F8, 0x3BD743D8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD73BD7, 0x3BD743F8, 0x3BD743D8,
+0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BB743D8,
+0x3BD743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8, 0x3B9743B7,
+0x3BB743B7, 0x3BB73BB7, 0x3BB743B8, 0x3B973BB7, 0x3B973BB7, 0x3B973BB7, 0x3B973B97, 0x33963B97,
+0x3B963B97, 0x33763B97, 0x33763B97, 0x33763B97, 0x33763B77, 0x33763B77, 0x3B763B76, 0x33563B76,
+0x3B563B76, 0x33553B56, 0x3B553B56, 0x33553B56, 0x33353B56, 0x33353B55, 0x3B353B56, 0x33353B35,
+0x331432F4, 0x33153314, 0x33153314, 0x3B353314, 0x33353314, 0x3B353314, 0x3B353314, 0x3B353314,
+0x3B353334, 0x3B553335, 0x3B353335, 0x3B563335, 0x3B553335, 0x3B763355, 0x3B563355, 0x3B563355,
+0x3B763355, 0x3B763356, 0x3B763356, 0x3B963376, 0x3B763376, 0x3B963376, 0x3B963376, 0x3B963396,
+0x3B963375, 0x3B963396, 0x3B963B96, 0x3B963B96, 0x3B963B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB6,
+0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB6, 0x3BB73BB7,
+0x3BB73BB6, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x43D73BB7,
+0x3BB73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7,
+0x3BD73BB7, 0x3BD73BB7, 0x3BD73BB7, 0x43D73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7,
+0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7,
+0x3BD833B7, 0x43D73BB6, 0x3BB83BB7, 0x3BD73BB7, 0x3BD733B6, 0x537443D6, 0x58E67310, 0x91458105,
+0x516981C8, 0x4A6E84B7, 0x80A158C4, 0x992290C1, 0xBC4B7921, 0x7C259C88, 0x84A77C86, 0x62C57C27,
+0x18243903, 0x53F65373, 0x3BD73B96, 0x3BD73BD7, 0x3BD73BD7, 0x3BF833D7, 0x3BD733D7, 0x3BF73BD6,
+0x3BD73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7,
+0x3BD73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7,
+0x3BF73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF73BD7, 0x3BF73BD7,
+0x3BD733B7, 0x3BF83BD7, 0x3BD73BD7, 0x3BD83BD7, 0x3BD73BD7, 0x3BD83BD7, 0x3BD73BD7, 0x3BD83BD7,
+0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73B97,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73B97, 0x3B973396, 0x3BB73B97, 0x3B973396, 0x3B973396,
+0x3B973396, 0x3B973376, 0x33763376, 0x33763376, 0x33763376, 0x3B763376, 0x33763376, 0x3B763376,
+0x3B563355, 0x3B763356, 0x33563355, 0x33563335, 0x3B563335, 0x3B563335, 0x33353335, 0x33353335,
+0x33143315, 0x33143B35, 0x33143B35, 0x33353B35, 0x33353B35, 0x33353B35, 0x33353B35, 0x33353B35,
+0x33353B55, 0x3B553B55, 0x33353B56, 0x3B553B56, 0x3B553B56, 0x33553B76, 0x33563B56, 0x3B563B76,
+0x33563B76, 0x3B763B76, 0x3B763B76, 0x33763B97, 0x33763B96, 0x3B963B97, 0x33963B97, 0x3B963BB7,
+0x3B963B96, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963BB7, 0x3BB63BB7, 0x3BB63BB7, 0x3BB743D7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB743D7, 0x3BB743D7, 0x3BB743D7, 0x3BB743D7, 0x3BB743D7,
+0x3BB743D7, 0x3BD743D8, 0x3BB743D7, 0x3BD743D8, 0x3BB743D7, 0x3BB743D8, 0x3BB743D8, 0x3BD743D8,
+0x3BB743D7, 0x3BD743D8, 0x3BB743D7, 0x3BB743D8, 0x3BB73BD7, 0x3BD743D8, 0x3BB743D7, 0x3BD743D8,
+0x3BB743D7, 0x3BD743D8, 0x3BB743D7, 0x3BD743D8, 0x3BD73BD7, 0x3BD743F8, 0x3BD73BD7, 0x3BD73BD8,
+0x3BD73BD7, 0x3BD73BD8, 0x3BD73BD7, 0x3BD73BD8, 0x3BD73BD8, 0x3BD743F8, 0x3BD73BD8, 0x3BD743F8,
+0x3BB73BD8, 0x3BD643D7, 0x3BB743D8, 0x3BD73BD8, 0x3BD64418, 0x43D63BF7, 0x6AF05BB4, 0x712658E6,
+0x49EC71EA, 0x3A906478, 0x99238A2A, 0x9921A923, 0xDDAE7920, 0x9528C5ED, 0x84A77425, 0x946A7C26,
+0x410638C1, 0x63F51065, 0x3B964BD7, 0x3BF743F7, 0x33D83BF8, 0x3BF73BF8, 0x3BF73BF7, 0x43F743F7,
+0x3BF743F8, 0x3BF743F8, 0x3BD743F8, 0x3BF743F8, 0x3BD73BF8, 0x3BF743F8, 0x3BD73BF8, 0x3BF743F8,
+0x3BD73BF8, 0x3BF73BF8, 0x3BD73BF8, 0x3BD73BF8, 0x3BD73BF8, 0x3BF743F8, 0x3BD73BF8, 0x3BF743F8,
+0x3BD73BF8, 0x3BF73BF8, 0x3BD73BF8, 0x3BF73BF8, 0x3BD73BF8, 0x3BF73BF8, 0x3BD73BF8, 0x3BD73BF8,
+0x3BD73BD8, 0x3BD743F8, 0x3BD73BD8, 0x3BD73BF8, 0x3BD73BF8, 0x3BD743F8, 0x3BD73BD8, 0x3BD73BF8,
+0x3BD73BD8, 0x3BD743F8, 0x3BB743D8, 0x3BD743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743B8, 0x3BB743D8,
+0x3BB743D7, 0x3BB743D7, 0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7, 0x3B973BB7, 0x33973BB7, 0x3B973BB7,
+0x33963B97, 0x33963B97, 0x33763B97, 0x33763B97, 0x33763B77, 0x33763B97, 0x33763B76, 0x33763B76,
+0x33563B76, 0x33563B76, 0x33553B56, 0x33563B56, 0x33553B56, 0x33553B56, 0x33353B56, 0x33353B56,
+0x33153314, 0x33353314, 0x3B353314, 0x3B353314, 0x3B353335, 0x3B353334, 0x3B553335, 0x3B553335,
+0x3B553335, 0x3B553335, 0x3B563355, 0x3B563355, 0x3B763355, 0x3B763355, 0x3B763356, 0x3B763355,
+0x3B763376, 0x3B763376, 0x3B963376, 0x3B963376, 0x3B963376, 0x3B963396, 0x3BB73396, 0x3BB73B96,
+0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB7, 0x3BB73BB6, 0x3BB73BB7, 0x3BB73BB6,
+0x3BB73BB7, 0x3BB73BB6, 0x43D73BB7, 0x3BB73BB7, 0x43D73BB7, 0x3BD73BB7, 0x43D73BB7, 0x3BB73BB7,
+0x43D73BD7, 0x3BD73BB7, 0x43D73BB7, 0x3BD73BB7, 0x43D73BB7, 0x3BD73BB7, 0x43D73BD7, 0x43D73BB7,
+0x3BD73BB7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7,
+0x43D73BB7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7,
+0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BF83BD7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF73BD7,
+0x3BF73BD7, 0x3BD73BD7, 0x3BF83BD7, 0x3BF733D7, 0x3BD63BD6, 0x3BF633F6, 0x5BB543B6, 0x40E76AF0,
+0x52D03948, 0x32D243F7, 0xA16669A9, 0x9901A0E2, 0xD5CE7140, 0x7CA794E8, 0x8D2984E8, 0x8C8A6405,
+0x48E361E4, 0x20E730A4, 0x43D76416, 0x33D73BF7, 0x3BF833F8, 0x3BD733D7, 0x3BF733F7, 0x43D83BD7,
+0x3BF83BD7, 0x3BF83BD7, 0x3BF83BF7, 0x3BF73BD7, 0x3BF83BF7, 0x3BF83BD7, 0x3BF83BF7, 0x3BF83BD7,
+0x3BF83BD7, 0x3BF83BD7, 0x3BF83BF7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF83BD7, 0x43F83BF7, 0x43F83BD7,
+0x3BF83BF7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF83BD7, 0x3BF83BF7, 0x3BF73BD7,
+0x3BF83BF7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF83BD7, 0x3BF83BD7, 0x3BF73BD7, 0x3BF83BD7, 0x3BF73BD7,
+0x3BF83BD7, 0x3BD83BD7, 0x3BD83BD7, 0x3BD83BD7, 0x43D83BD7, 0x3BD73BB7, 0x43D83BB7, 0x3BB73BB7,
+0x3BD73BB7, 0x3BB73BB6, 0x3BB73BB7, 0x3BB73B97, 0x3BB73B97, 0x3BB73B97, 0x3BB73BB7, 0x3BB73396,
+0x3BB73396, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973376, 0x3B963376, 0x3B963376, 0x3B763376,
+0x3B763356, 0x3B763355, 0x3B563356, 0x3B563355, 0x3B563355, 0x3B563355, 0x3B563335, 0x3B553335,
+0x33143B35, 0x33353B35, 0x33353B35, 0x33353B35, 0x3B353B55, 0x33353B55, 0x3B353B55, 0x3B553B55,
+0x3B553B56, 0x3B553B56, 0x3B553B76, 0x3B553B76, 0x3B763B76, 0x3B563B76, 0x3B763B76, 0x3B763B76,
+0x3B763B97, 0x3B763B96, 0x3B963B97, 0x3B963B97, 0x3B963B97, 0x3B963BB7, 0x3B963BB7, 0x3BB63BB7,
+0x3BB743B7, 0x3BB743B7, 0x3BB743B7, 0x3BB743B7, 0x3BB743D7, 0x3BB743B7, 0x3BB743D7, 0x3BB743D7,
+0x3BB743D7, 0x3BB743D7, 0x3BD743D8, 0x3BB743D7, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BB743D7,
+0x3BD743F8, 0x3BB743D8, 0x3BD743D8, 0x3BD743D7, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8,
+0x3BD743F8, 0x3BD743D8, 0x3BD743F8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743F8, 0x3BD743D8,
+0x3BD743D8, 0x3BD743D8, 0x3BD743F8, 0x3BD743D8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8,
+0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BD743F8,
+0x3BF74417, 0x43D843F8, 0x3BF743F8, 0x3BF73BF8, 0x3BF743F7, 0x3BF74417, 0x43D64418, 0x4A6F6BD6,
+0x63D52129, 0x2A921293, 0x91A861EC, 0x9901A104, 0xBD4C79A0, 0x7C869D09, 0x956B8D29, 0x73E77427,
+0x40C093A9, 0x20435104, 0x5C16422D, 0x3C1743D6, 0x3BF83BF8, 0x3BD743F8, 0x3BF73BF8, 0x43D743F8,
+0x3BF743F8, 0x3BD73BF8, 0x3BF73BF8, 0x3BD73BF8, 0x3BF843F8, 0x3BF743F8, 0x3BF743F8, 0x3BF73BF8,
+0x3BF743F8, 0x3BF73BF8, 0x3BF743F8, 0x3BF73BF8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8,
+0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8,
+0x3BF84418, 0x3BF73BF8, 0x3BF743F8, 0x3BF73BF8, 0x3BF743F8, 0x3BF73BF8, 0x3BF743F8, 0x3BD73BF8,
+0x3BD843F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743D8, 0x3BD743F8, 0x3BD743D8, 0x3BD743D8, 0x3BB743D8,
+0x3BB743D8, 0x3BB743D7, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8, 0x3BB743B7, 0x3BB743D8, 0x3BB73BB7,
+0x3BB73BB7, 0x3B973BB7, 0x3B973BB7, 0x3B963B97, 0x3B963B97, 0x33763B97, 0x33963B97, 0x33763B96,
+0x3B763B76, 0x3B763B76, 0x3B563B76, 0x3B763B76, 0x3B563B76, 0x3B553B76, 0x3B563B56, 0x33553B56,
+0x33153314, 0x3B353314, 0x3B353314, 0x3B353334, 0x3B353334, 0x3B553335, 0x3B553334, 0x3B553335,
+0x3B553335, 0x3B563355, 0x3B563355, 0x3B763355, 0x3B763355, 0x3B763376, 0x3B763356, 0x3B963376,
+0x3B763376, 0x3B963B76, 0x3B963376, 0x3B973376, 0x3B973376, 0x3BB73396, 0x3BB73396, 0x3BB73B96,
+0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BD73BB7,
+0x3BD73BB7, 0x43D73BB7, 0x3BD73BB7, 0x43D73BD7, 0x3BD73BB7, 0x43D73BD7, 0x3BD73BD7, 0x43D73BD7,
+0x3BD73BD7, 0x3BD73BD7, 0x3BD73BB6, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7,
+0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7,
+0x3BD73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x43F73BD7, 0x3BD73BD7, 0x43F73BD7,
+0x3BF73BD7, 0x3BF83BF7, 0x3BF73BD7, 0x3BF83BF7, 0x3BF73BD7, 0x3BF83BF7, 0x3BF73BD7, 0x3BF73BF7,
+0x3BF73BF7, 0x43D83BD7, 0x43D743B7, 0x3BF73BF6, 0x3BF83BD7, 0x43F83BF8, 0x43D73BD7, 0x5C184396,
+0x53B5010A, 0x22930A73, 0x696841ED, 0x80C18925, 0xC58D6160, 0x7CA78CC8, 0x74678509, 0x8CA963E5,
+0x5180C5CD, 0x490448E1, 0x52EF1001, 0x43F75416, 0x43D743B6, 0x3BF83BF7, 0x3BD83BD7, 0x43F83BF7,
+0x3BF83BF7, 0x43F83BF7, 0x3BF73BF7, 0x3BF83BF7, 0x3BF83BF7, 0x43F83BF7, 0x3BF83BF7, 0x43F83BF7,
+0x3BF83BF7, 0x43F83BF7, 0x3BF83BF7, 0x43F83BF7, 0x3BF83BD7, 0x43F83BF7, 0x43F83BD7, 0x43F83BF7,
+0x3BF83BD7, 0x43F83BF7, 0x3BF83BD7, 0x43F83BF7, 0x3BF83BD7, 0x43F83BF7, 0x3BF83BD7, 0x43F83BF7,
+0x3BF83BF7, 0x3BF83BF7, 0x3BF83BD7, 0x43F83BF7, 0x3BF73BF7, 0x3BF83BF7, 0x3BF73BD7, 0x3BF83BF7,
+0x3BF73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BD7,
+0x3BD73BD7, 0x3BD73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7, 0x3BB73B97, 0x3BB73BB7,
+0x3BB73397, 0x3BB73397, 0x3B973396, 0x3B973396, 0x3B973396, 0x3B973376, 0x33963376, 0x3B963376,
+0x3B763376, 0x3B763376, 0x3B763356, 0x3B763356, 0x3B563356, 0x3B563355, 0x3B563355, 0x3B563355,
+0x33143B35, 0x33353B35, 0x33353B35, 0x33353B55, 0x33353B55, 0x3B553B55, 0x33353B55, 0x3B553B56,
+0x3B553B56, 0x3B563B76, 0x3B553B76, 0x3B763B76, 0x3B763B76, 0x3B763B76, 0x3B763B76, 0x3B963B97,
+0x3B763B76, 0x3B763B97, 0x3B963B97, 0x3B963B97, 0x3B963B97, 0x3BB73BB7, 0x3B963BB7, 0x3BB73BB7,
+0x3BB743B7, 0x3BB743D7, 0x3BB73BB7, 0x3BB743D7, 0x3BB743D7, 0x3BB743D7, 0x3BB743D7, 0x3BD743D8,
+0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743F8, 0x3BD743D8, 0x3BD743F8,
+0x3BD743F7, 0x3BD743F7, 0x3BD73BD7, 0x3BD743F7, 0x3BD73BD8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8,
+0x3BD73BD8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BF743F8, 0x3BD743F8, 0x3BD743F8,
+0x3BD743F8, 0x3BF743F8, 0x3BD743F8, 0x3BF743F8, 0x3BD743F8, 0x3BF743F8, 0x3BD743F8, 0x3BF743F8,
+0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8,
+0x3BF73C18, 0x43D843F8, 0x43D743D8, 0x3BF743F7, 0x3BD83BF8, 0x3BD84419, 0x3BB743F8, 0x43D74C39,
+0x32F34354, 0x1A731273, 0x4129320F, 0x79237947, 0xACCB5920, 0x7C8694C8, 0x7CA884E9, 0x84876BE5,
+0xD62EBDCB, 0x49015160, 0x184340E3, 0x53D56393, 0x43D74BD7, 0x3C184418, 0x43D843F8, 0x3BF843F8,
+0x3BF74418, 0x3BF84418, 0x3BF74418, 0x3BF74418, 0x3BF74418, 0x3BF84418, 0x3BF74418, 0x3BF74418,
+0x3BF74418, 0x3BF84418, 0x3BF743F8, 0x43F84418, 0x3BF74418, 0x43F84418, 0x3BF743F8, 0x3BF74418,
+0x3BF743F8, 0x43F84418, 0x3BF743F8, 0x43F84418, 0x3BF743F8, 0x43F84418, 0x3BF743F8, 0x43F84418,
+0x3BF743F8, 0x3BF74418, 0x3BF743F8, 0x3BF74418, 0x3BF743F8, 0x3BF74418, 0x3BF743F8, 0x3BF74418,
+0x3BF73BF8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BD73BF8, 0x3BD743F8, 0x3BD73BD8, 0x3BD73BD8,
+0x3BD73BD8, 0x3BD743D8, 0x3BD743D8, 0x3BB743D8, 0x3BB743B8, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8,
+0x3BB73BB7, 0x3BB73BB7, 0x33973BB7, 0x3B973BB7, 0x33963BB7, 0x3B973B97, 0x33963B97, 0x33963B97,
+0x3B763B96, 0x3B763B97, 0x33763B76, 0x3B763B76, 0x3B563B76, 0x3B563B76, 0x33563B76, 0x3B563B76,
+0x3B353314, 0x3B353334, 0x3B353335, 0x3B553335, 0x3B553335, 0x3B553335, 0x3B553B55, 0x3B553B55,
+0x3B563B55, 0x3B763B55, 0x3B763B55, 0x3B763375, 0x3B763B75, 0x3B763376, 0x3B963376, 0x3B963376,
+0x3B963B76, 0x3B963B76, 0x3B973B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB6, 0x3BB73B96,
+0x3BB73BB7, 0x3BB73BB6, 0x43D73BB7, 0x43D73BB7, 0x43D73BB7, 0x43D73BB7, 0x43D73BD7, 0x43D73BB7,
+0x43D73BD7, 0x43D73BB7, 0x43D73BD7, 0x43D73BD7, 0x3BD73BD7, 0x3BD73BD7, 0x43F83BD7, 0x43F83BD7,
+0x43F73BD7, 0x3BD73BD7, 0x43F73BD7, 0x3BD73BD7, 0x43F73BD7, 0x3BD73BD7, 0x43F73BD7, 0x3BD73BD7,
+0x43F73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7,
+0x43F83BF7, 0x43F73BD7, 0x43F83BD7, 0x43F73BD7, 0x43F83BD7, 0x43F73BD7, 0x43F83BF7, 0x43F73BF7,
+0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x3BF83BD7,
+0x44183BF7, 0x43F83BF8, 0x3C183BF8, 0x43F73BF7, 0x44183BD7, 0x3BF83BD8, 0x44383C18, 0x43F733D6,
+0x43954BF6, 0x125201CF, 0x31AC2250, 0x68E35926, 0xB4EC5940, 0x84C88447, 0x7CA884C8, 0xA58A63A4,
+0xC60BBE4B, 0x38E0BD4B, 0x386340A0, 0x73D42065, 0x43F753F5, 0x43F83BD7, 0x43F73BF7, 0x3C183BF7,
+0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x44183BF8, 0x43F83BF7, 0x44183BF8, 0x43F83BF7,
+0x44183BF8, 0x43F843F7, 0x43F843F7, 0x43F843F7, 0x43F843F8, 0x43F843F7, 0x43F843F8, 0x43F843F7,
+0x43F843F8, 0x43F843F7, 0x43F843F8, 0x43F843F7, 0x43F843F8, 0x43F843F7, 0x43F843F8, 0x43F843F7,
+0x43F83BF8, 0x43F83BF7, 0x44183BF8, 0x43F83BF7, 0x44183BF8, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7,
+0x44183BF7, 0x3BF83BF7, 0x3BF83BF7, 0x3BF83BF7, 0x3BF83BF7, 0x3BF83BD7, 0x3BF83BF7, 0x3BF73BD7,
+0x3BD73BD7, 0x3BD73BD7, 0x43D83BD7, 0x43D83BB7, 0x43D83BB7, 0x43B73BB7, 0x43B73BB7, 0x3BB73BB7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73396, 0x3BB73B97, 0x3BB73396, 0x3B973396, 0x3B963396,
+0x3B963376, 0x3B963B76, 0x3B763B76, 0x3B763356, 0x3B763B56, 0x3B763355, 0x3B763356, 0x3B563355,
+0x3B353B35, 0x3B353B35, 0x3B353B55, 0x3B553B55, 0x3B553B56, 0x3B553B55, 0x3B553B76, 0x3B553B76,
+0x3B764376, 0x3B763B76, 0x3B764376, 0x3B763B96, 0x3B763B96, 0x33763B96, 0x3B963B97, 0x3B963B97,
+0x3B763B97, 0x3B963B97, 0x3B973BB7, 0x3BB73BB7, 0x3BB743B7, 0x3BB73BB7, 0x3BB743B7, 0x3BB743D7,
+0x3BB743D7, 0x3BB743D7, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D7, 0x43D743D8, 0x43D743D8,
+0x43D743F8, 0x3BD743D8, 0x3BD743D8, 0x3BD743D8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8,
+0x3BD743F8, 0x3BD743F7, 0x3BF743F8, 0x3BD743F8, 0x3BF743F8, 0x3BD743F8, 0x3BF743F8, 0x3BD743F8,
+0x3BF743F8, 0x3BF743F8, 0x43F743F8, 0x3BF743F8, 0x43F743F8, 0x3BF743F8, 0x43F743F8, 0x3BF743F8,
+0x3BF743F8, 0x3BF743F8, 0x43F743F8, 0x3BF743F8, 0x43F743F8, 0x3BF743F8, 0x3BF74418, 0x3BF743F8,
+0x3BF84418, 0x3BF743F8, 0x3BF84418, 0x3BF743F8, 0x3BF84418, 0x3BF743F8, 0x3BF84418, 0x3BF743F8,
+0x43F84418, 0x3BF843F8, 0x3BF84418, 0x3BF74418, 0x441843F7, 0x3BF83BF8, 0x3BF74418, 0x3BF64417,
+0x54176CDA, 0x0A1101D0, 0x29ED1251, 0x61035148, 0x9BC85900, 0x7C8794A9, 0x7C888D0A, 0x95286BE5,
+0xB5E8B609, 0xACCAB5AA, 0x48A24080, 0x28A64084, 0x53F66C15, 0x43F743F7, 0x44174418, 0x3BF83C18,
+0x44184418, 0x43F74418, 0x43F84418, 0x43F843F8, 0x44184418, 0x43F74418, 0x43F84C18, 0x43F84418,
+0x43F84C18, 0x43F843F8, 0x43F84418, 0x43F843F8, 0x43F84C18, 0x43F843F8, 0x44184C18, 0x43F84C18,
+0x43F84418, 0x43F843F8, 0x43F84418, 0x43F843F8, 0x43F84C18, 0x43F843F8, 0x43F84418, 0x43F84418,
+0x43F84418, 0x43F84418, 0x44184418, 0x43F84418, 0x44184418, 0x43F84418, 0x43F84418, 0x43F84418,
+0x44184418, 0x3BF84418, 0x43F84418, 0x3BF743F8, 0x3BF84418, 0x3BF743F8, 0x3BF74418, 0x3BF743F8,
+0x3BD743F8, 0x3BD743D8, 0x43D843F8, 0x3BD743D8, 0x43D743D8, 0x3BB743D8, 0x3BB743D8, 0x3BB743B8,
+0x3BB743D8, 0x3BB743B7, 0x3BB743D8, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3B963BB7, 0x3B963BB7,
+0x3B963B97, 0x3B963B97, 0x3B764397, 0x3B763B76, 0x3B763B77, 0x3B563B76, 0x3B563B76, 0x33563B76,
+0x3B353334, 0x3B553335, 0x3B353335, 0x3B553335, 0x3B553335, 0x3B563335, 0x3B563B55, 0x3B563B55,
+0x3B763B55, 0x3B763375, 0x3B763375, 0x3B763B76, 0x3B963376, 0x3B973396, 0x3B963376, 0x3B973396,
+0x3B963396, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB6, 0x3BB73BB6, 0x3BB73BB6, 0x3BD73BB6,
+0x43B73BB7, 0x43D73BB7, 0x43D73BB7, 0x43D73BD7, 0x43D73BB7, 0x43D73BD7, 0x43D73BD7, 0x43D73BD7,
+0x3BD73BD7, 0x3BF73BD7, 0x3BF73BD7, 0x43F73BD7, 0x3BF73BD7, 0x43F73BD7, 0x3BF73BD7, 0x43F73BD7,
+0x3BF73BD7, 0x43F83BD7, 0x3BF73BD7, 0x43F83BD7, 0x43F83BD7, 0x43F83BF7, 0x43F83BD7, 0x43F83BF7,
+0x3BF73BD7, 0x43F83BF7, 0x3BF83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x3BF83BD7, 0x44183BF7,
+0x3BF73BD7, 0x3BF73BF7, 0x3BF73BF7, 0x43F73BF7, 0x43F73BF7, 0x44183BF7, 0x43F73BF7, 0x43F83BF7,
+0x43F73BF7, 0x44183BF7, 0x3BF73BF7, 0x44183BF7, 0x3BF73BF7, 0x44183BF7, 0x43F73BF7, 0x43F73BF7,
+0x43F83BD7, 0x43F843F7, 0x44183BF7, 0x43F73BF7, 0x44183BF7, 0x44183BD7, 0x44173BF7, 0x44173BF7,
+0x4BD664D9, 0x09F13355, 0x2A500211, 0x61254107, 0x72A550C1, 0x84A894AA, 0x7C8884C9, 0x95695BC4,
+0xADC8B62A, 0xBDCBA588, 0x40808B45, 0x30443861, 0x74552907, 0x44174BF6, 0x3C173BF7, 0x44183BF7,
+0x43F843F8, 0x44183C17, 0x44173BF7, 0x4BF943F8, 0x3C183BF8, 0x44173BF7, 0x43F843F7, 0x441843F8,
+0x441843F8, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x44184417,
+0x441843F7, 0x44184417, 0x441843F7, 0x44184417, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7,
+0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7,
+0x43F843F7, 0x44183BF7, 0x43F83BF7, 0x44183BF7, 0x43F73BF7, 0x43F73BF7, 0x43F73BD7, 0x43F73BF7,
+0x3BF73BD7, 0x43F83BD7, 0x3BF73BD7, 0x3BF73BD7, 0x43D73BB7, 0x43D73BD7, 0x43D73BD7, 0x43D73BB7,
+0x3BD73BB7, 0x3BB73BB7, 0x3BB73BB6, 0x3BB73BB7, 0x3BB73B97, 0x3BB73B97, 0x3B973396, 0x3B973396,
+0x3B963396, 0x3B973396, 0x3B963376, 0x3B963B76, 0x3B763375, 0x3B763B76, 0x3B763355, 0x3B763355,
+0x33353B55, 0x3B553B55, 0x33353B55, 0x3B553B55, 0x3B553B56, 0x3B563B56, 0x3B563B76, 0x3B563B76,
+0x3B763B76, 0x3B763B76, 0x3B763B76, 0x3B763B96, 0x33763B97, 0x3B963B97, 0x33963B97, 0x3B963BB7,
+0x3B963B97, 0x3B963BB7, 0x3B963BB7, 0x3BB743B7, 0x3BB63BB7, 0x3BB743D7, 0x3BB63BB7, 0x3BB743D7,
+0x3BD743D7, 0x3BD743D8, 0x3BD743D8, 0x43D743F8, 0x3BD743D7, 0x43D743F8, 0x3BD743F8, 0x3BD743F8,
+0x3BD743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8,
+0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8,
+0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF74418, 0x3BF743F8, 0x3BF84418,
+0x3BF743F8, 0x3C174418, 0x3BF74418, 0x3BF74418, 0x3BF74418, 0x3BF74418, 0x3BF743F8, 0x43F74418,
+0x3BF74418, 0x3BF74418, 0x3BF74418, 0x44174418, 0x3BF74418, 0x44174418, 0x3BF74418, 0x43F74418,
+0x43F74418, 0x43F74C18, 0x43F74418, 0x43F74418, 0x44184418, 0x44184418, 0x43F74418, 0x43D64C18,
+0x4BF66CFA, 0x01B05C59, 0x22500A53, 0x59044969, 0x6A245903, 0x848894AA, 0x7CA984EA, 0x7C8663E5,
+0xADE9BE4C, 0xAD88A5A7, 0x59A0C56B, 0x382248A1, 0x396938C5, 0x4BF67457, 0x44584C38, 0x43F743F8,
+0x44184C18, 0x44174438, 0x43F74C18, 0x4BF84BF9, 0x3C184418, 0x44174418, 0x43F84418, 0x44184C19,
+0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x43F74C18,
+0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18,
+0x43F74418, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x43F74418, 0x44184C18,
+0x43F74C18, 0x44184C18, 0x43F74418, 0x44184C18, 0x43F74418, 0x43F74418, 0x3BF743F8, 0x3BF743F8,
+0x3BF743F8, 0x3BF743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743D8, 0x43D743F8,
+0x3BB743D8, 0x3BB743D8, 0x3BB743D7, 0x3BB743D7, 0x3BB743B8, 0x3BB743B8, 0x3B973BB7, 0x3B973BB7,
+0x3B963BB7, 0x3B963BB7, 0x3B963B97, 0x3B763B96, 0x3B763B96, 0x3B763B96, 0x3B763B76, 0x3B763B76,
+0x3B553335, 0x3B553355, 0x3B553335, 0x3B553355, 0x3B553B55, 0x3B763B55, 0x3B763B55, 0x3B763B55,
+0x3B763B76, 0x3B763B75, 0x3B963B76, 0x3B963B76, 0x3B963B96, 0x3B963B96, 0x3BB73396, 0x3BB73396,
+0x3BB73B96, 0x3BB73B96, 0x43B73BB6, 0x3BB73B96, 0x3BB73BB6, 0x3BB73BB6, 0x43D73BB6, 0x43D73BB6,
+0x43D83BD7, 0x43D73BD7, 0x43D83BD7, 0x43D73BD7, 0x43F73BD7, 0x43D73BD7, 0x43F73BD7, 0x43F73BD7,
+0x43F73BD7, 0x43F73BD7, 0x43F73BF7, 0x43F73BD7, 0x43F83BF7, 0x43F73BD7, 0x43F83BF7, 0x43F83BF7,
+0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7,
+0x43F83BF7, 0x43F83BF7, 0x43F843F7, 0x43F83BF7, 0x441843F7, 0x43F83BF7, 0x43F843F7, 0x43F83BF7,
+0x44183BF7, 0x44183BF7, 0x44183BF7, 0x43F83BF7, 0x44183BF7, 0x43F83BF7, 0x441843F7, 0x43F843F7,
+0x44183BF7, 0x44183BF7, 0x44183BF7, 0x44183BF7, 0x441843F7, 0x44183BF7, 0x44184418, 0x44183BF7,
+0x44184417, 0x441843F7, 0x44184417, 0x441843F7, 0x44183C18, 0x44383BF7, 0x44184418, 0x44174417,
+0x4BF664DA, 0x33564BF7, 0x223001AF, 0x51064169, 0x61C35904, 0x84A89489, 0x8CEA84C9, 0x63E463E5,
+0xADE8BE6B, 0xB5C8ADE8, 0x8B44B569, 0x50626162, 0x38844883, 0x741749ED, 0x43F84BD6, 0x44184C18,
+0x4C184417, 0x44183C17, 0x4C1843F7, 0x4BF84BF7, 0x441843F8, 0x441743F7, 0x44383C17, 0x4C1943F8,
+0x441843F8, 0x441843F7, 0x44184418, 0x441843F7, 0x4C184418, 0x441843F7, 0x44184418, 0x441843F7,
+0x44184418, 0x441843F7, 0x4C184418, 0x44184418, 0x44184418, 0x441843F7, 0x4C184418, 0x441843F7,
+0x44184418, 0x441843F7, 0x44184418, 0x441843F7, 0x44184418, 0x441843F7, 0x44184418, 0x441843F7,
+0x44184418, 0x441843F7, 0x44184418, 0x441843F7, 0x441843F7, 0x44183BF7, 0x44183BF7, 0x43F83BF7,
+0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x3BF83BF7, 0x43F83BF7, 0x3BD73BD7, 0x43D83BD7, 0x43D83BD7,
+0x43D83BD7, 0x43D73BB7, 0x43D73BD7, 0x3BB73BB7, 0x43D73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73B97,
+0x3BB73B96, 0x3BB73B96, 0x3B973B96, 0x3B963396, 0x3B963B76, 0x3B963B76, 0x3B763B76, 0x3B763375,
+0x3B553B56, 0x3B553B55, 0x3B553B56, 0x3B553B76, 0x3B554376, 0x3B763B76, 0x3B764376, 0x3B764376,
+0x3B763B96, 0x3B763B96, 0x3B963B96, 0x3B963B96, 0x3B963B97, 0x3B963BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB643B7, 0x3BB643B7, 0x3BB743B7, 0x3BB643B7, 0x3BD743D7, 0x3BB743D7, 0x43D743D7, 0x3BD743D7,
+0x43D743F8, 0x43D743D8, 0x43D743F8, 0x43D743F8, 0x43F743F8, 0x43D743F8, 0x43F743F8, 0x43F743F8,
+0x3BF743F8, 0x3BF743F8, 0x43F743F8, 0x3BD743F8, 0x43F74418, 0x43F743F8, 0x43F74418, 0x43F743F8,
+0x43F74418, 0x43F743F8, 0x43F74418, 0x43F743F8, 0x43F84418, 0x43F74418, 0x43F84418, 0x43F74418,
+0x43F84418, 0x43F74418, 0x43F84418, 0x43F74418, 0x43F84418, 0x43F84418, 0x43F84C18, 0x43F74418,
+0x43F84418, 0x43F84418, 0x44184C18, 0x43F84418, 0x44184C18, 0x43F84418, 0x44184C18, 0x43F84418,
+0x44184C18, 0x44184418, 0x44184418, 0x44184418, 0x44184418, 0x44184418, 0x44184418, 0x44184418,
+0x44184438, 0x44174C18, 0x44184C18, 0x44184418, 0x44184439, 0x44184418, 0x44174C18, 0x54794C18,
+0x44175459, 0x54594BF7, 0x220F01F0, 0x5127418A, 0x51426125, 0x84A89CCB, 0x8D0A84CA, 0x63C36C06,
+0xADC8A5A9, 0xADC8BE2A, 0xBD4BB5A9, 0x81C55900, 0x58E55882, 0x5A2E3845, 0x53F77417, 0x44174C18,
+0x44174C18, 0x44184418, 0x4C184C18, 0x4BF74C17, 0x43F84C18, 0x44174C18, 0x44374438, 0x43F84C19,
+0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18,
+0x44184C18, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18,
+0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C18, 0x44184C18,
+0x44184C38, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x43F84418, 0x44184418, 0x43F84418,
+0x43F84418, 0x43F743F8, 0x43F74418, 0x3BF743F8, 0x3BF84418, 0x3BD743F8, 0x43D743F8, 0x3BD743D8,
+0x43D743F8, 0x43D743D8, 0x43D743F8, 0x3BB743D8, 0x3BB743D8, 0x3BB743B8, 0x3BB743B8, 0x3BB73BB7,
+0x3BB743B7, 0x3BB63BB7, 0x3B9643B7, 0x3B963BB7, 0x3B964397, 0x3B763B96, 0x3B763B96, 0x3B763B96,
+0x3B553335, 0x3B553355, 0x3B553335, 0x3B763B55, 0x3B763355, 0x3B763B55, 0x3B763355, 0x3B963B76,
+0x3B763375, 0x3B963B76, 0x3B963B76, 0x3B963B96, 0x3B963396, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96,
+0x3BB73B96, 0x3BB73BB6, 0x3BB73BB6, 0x3BD73BB6, 0x43D73BB6, 0x43D73BD7, 0x43F73BD7, 0x43F73BD7,
+0x3BD73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BF7, 0x43F73BD7, 0x43F83BF7, 0x43F73BF7, 0x44183BF7,
+0x43F73BF7, 0x441843F7, 0x43F743F7, 0x43F743F7, 0x43F73BF7, 0x43F843F7, 0x43F83BF7, 0x441843F7,
+0x43F843F7, 0x441843F7, 0x43F843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7,
+0x43F843F7, 0x441843F7, 0x43F843F7, 0x441843F7, 0x43F843F7, 0x4C1843F7, 0x43F843F7, 0x441843F7,
+0x441743F7, 0x441843F7, 0x441743F7, 0x441843F7, 0x441843F7, 0x4C1843F7, 0x441843F7, 0x441843F7,
+0x441843F7, 0x4C184418, 0x441843F7, 0x44184417, 0x441843F7, 0x44184417, 0x441843F7, 0x44184417,
+0x441843F7, 0x44384417, 0x44184417, 0x44184417, 0x44183C17, 0x441843F7, 0x4C3843F7, 0x64FB43D6,
+0x44183BF7, 0x4C174C38, 0x096D3355, 0x4107420D, 0x51015905, 0x84C994AA, 0x952B7CC9, 0x6C056BE5,
+0xB60A9507, 0xB629B609, 0xCE2DA5A8, 0x69419B86, 0x506181E5, 0x486460A3, 0x6BF762B0, 0x4C3843D6,
+0x44184417, 0x4C184417, 0x44374417, 0x44373C37, 0x4BF84BF7, 0x44384418, 0x44174417, 0x44194418,
+0x44384418, 0x44384417, 0x44384417, 0x44384417, 0x44184417, 0x44384417, 0x44384417, 0x44384417,
+0x44184417, 0x44384417, 0x44184417, 0x44384417, 0x44184417, 0x44384417, 0x44384417, 0x44384417,
+0x44184417, 0x44384417, 0x44184417, 0x44384417, 0x44184417, 0x44384417, 0x44184417, 0x44384417,
+0x44184417, 0x4C184418, 0x44184417, 0x44184417, 0x441843F7, 0x44184417, 0x441843F7, 0x441843F7,
+0x43F83BF7, 0x44183BF7, 0x44183BF7, 0x43F73BF7, 0x3BF73BF7, 0x43F83BF7, 0x3BF73BD7, 0x3BD73BD7,
+0x43D73BD7, 0x43D73BD7, 0x43D73BD7, 0x3BD73BD7, 0x3BD73BB7, 0x3BD73BB7, 0x3BB73BB7, 0x3BB73BB7,
+0x3BB73B96, 0x3BB73B96, 0x3BB73396, 0x3BB73B96, 0x3B973396, 0x3B973396, 0x3B963376, 0x3B963376,
+0x3B553B55, 0x3B553B76, 0x3B553B56, 0x3B753B76, 0x3B553B76, 0x3B764376, 0x3B763B76, 0x3B963B96,
+0x3B763B96, 0x3B963B96, 0x3B963B96, 0x3B964397, 0x3B963BB7, 0x3BB643B7, 0x3BB63BB7, 0x3BB743B7,
+0x3BB743B7, 0x3BB743D7, 0x3BB743D7, 0x3BD743D7, 0x3BD743D7, 0x43D743F8, 0x3BD743F8, 0x43F743F8,
+0x3BD743F7, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x3BF743F8, 0x43F74418, 0x43F743F8, 0x43F74418,
+0x43F74418, 0x44184418, 0x43F74418, 0x43F74418, 0x43F74418, 0x43F74418, 0x43F74418, 0x44184C18,
+0x43F74418, 0x44184C18, 0x43F74418, 0x44184C18, 0x43F74418, 0x44184C18, 0x44184C18, 0x44184C18,
+0x43F84C18, 0x44184C18, 0x43F84C18, 0x43F84C18, 0x43F84C18, 0x44184C18, 0x43F84C18, 0x44184C18,
+0x43F74C18, 0x44174C18, 0x43F74C18, 0x44174C18, 0x43F74C18, 0x44184C18, 0x44174C18, 0x44184C18,
+0x44184418, 0x44184C38, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C18,
+0x44184418, 0x44184438, 0x44174C18, 0x44184C38, 0x44184418, 0x44184C38, 0x4C174418, 0x651B43F7,
+0x3BF74438, 0x43F74C38, 0x11CE5C79, 0x392939EE, 0x50E15906, 0x8CC9946A, 0x952B8CEA, 0x6C056C06,
+0xB5EA7C25, 0xB609C66B, 0x9D07ADE9, 0x6160CD6C, 0xAACA7983, 0x69056040, 0x6B313865, 0x44176437,
+0x44184C38, 0x44184C39, 0x44174438, 0x44374458, 0x4C184C18, 0x44384C38, 0x44174C38, 0x44384C39,
+0x44184438, 0x44384C38, 0x44184C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44184C38, 0x44384C38,
+0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44184C38, 0x44384C38, 0x44184C38, 0x44384C38,
+0x44184C38, 0x44384C38, 0x44184C38, 0x44384C38, 0x44184C38, 0x44384C38, 0x44184C38, 0x44184C38,
+0x44184C38, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C18,
+0x43F74C18, 0x44184418, 0x3BF74418, 0x3BF74418, 0x3BF743F8, 0x3BF84418, 0x3BF74418, 0x3BF743F8,
+0x3BD743F8, 0x43D743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743D8, 0x3BD743D8, 0x3BB743D7, 0x3BB743D7,
+0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3B973BB7, 0x3B963BB7, 0x3B963BB7, 0x3B963B97, 0x3B963B97,
+0x3B553B55, 0x3B753B55, 0x3B763B55, 0x3B763B55, 0x3B763B75, 0x3B763B75, 0x3B963B76, 0x3B963B76,
+0x3B973B76, 0x3B963396, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB63B96, 0x43B73BB6, 0x43B73BB6,
+0x43D73BB6, 0x43B73BB6, 0x43D73BD7, 0x43D73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7,
+0x43F83BD7, 0x43F73BD7, 0x43F83BF7, 0x43F83BF7, 0x43F83BF7, 0x43F73BF7, 0x441843F7, 0x43F743F7,
+0x441843F7, 0x43F743F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7, 0x44184417, 0x441843F7,
+0x4C1843F7, 0x441843F7, 0x4C1843F7, 0x441843F7, 0x4C1843F7, 0x441843F7, 0x4C1843F7, 0x441843F7,
+0x4C1843F7, 0x441843F7, 0x4C1843F7, 0x441843F7, 0x4C1843F7, 0x4C1843F7, 0x4C184417, 0x4C1843F7,
+0x4C184417, 0x4C1843F7, 0x4C184417, 0x4C1843F7, 0x4C1843F7, 0x44184417, 0x4C184417, 0x4C184417,
+0x44184417, 0x44384417, 0x44384417, 0x44184417, 0x44384417, 0x44384417, 0x44384418, 0x44184417,
+0x44384418, 0x44384417, 0x44384418, 0x44384417, 0x44384418, 0x44384417, 0x4C184417, 0x64DA4417,
+0x44383C17, 0x43F74417, 0x4BB64C38, 0x41EC116C, 0x590250E5, 0x8CEA83C8, 0x952B84C9, 0x6C056C26,
+0xB62B6C03, 0xBE09B609, 0x8C64A588, 0xCD4CD64D, 0x6041A309, 0x60627924, 0x38A460E4, 0x5C166B92,
+0x44394C17, 0x44194418, 0x44384418, 0x44384417, 0x44394438, 0x44383C38, 0x4C384418, 0x44384418,
+0x44384438, 0x44384418, 0x44384438, 0x44384418, 0x44384438, 0x44384418, 0x44384438, 0x44384418,
+0x4C384438, 0x4C384438, 0x4C384438, 0x44384418, 0x4C384438, 0x44384418, 0x4C384438, 0x44384418,
+0x4C384438, 0x44384418, 0x4C384438, 0x44384418, 0x4C384438, 0x44384418, 0x4C384438, 0x44384418,
+0x4C384438, 0x44384418, 0x44384418, 0x4C184417, 0x4C184417, 0x44184417, 0x4C184417, 0x441843F7,
+0x44184418, 0x441843F7, 0x44184418, 0x43F83BF7, 0x44183BF7, 0x43F83BF7, 0x44183BF7, 0x43F73BF7,
+0x43F83BF7, 0x43F73BD7, 0x43F73BD7, 0x3BD73BD7, 0x43D83BD7, 0x43D73BD7, 0x43D73BD7, 0x3BD73BB7,
+0x43D73BB7, 0x3BB73BB6, 0x3BB73BB6, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3BB73B96, 0x3B963396,
+0x3B553B76, 0x3B754376, 0x3B754376, 0x3B753B76, 0x3B763B96, 0x3B763B96, 0x3B763B96, 0x3B963B96,
+0x3B963BB7, 0x3B963BB7, 0x3BB643B7, 0x3BB643B7, 0x3BB743B7, 0x3BB643B7, 0x3BB643D7, 0x3BB643D7,
+0x43B743D7, 0x43B743D7, 0x43D743F8, 0x43D743F8, 0x43F743F8, 0x43F743F8, 0x43F743F8, 0x43D743F8,
+0x43F74418, 0x43F743F8, 0x43F74418, 0x43F743F8, 0x43F84418, 0x43F74418, 0x44174C18, 0x43F74418,
+0x44174C18, 0x44174418, 0x44184C18, 0x44184C18, 0x44184C18, 0x44174C18, 0x44184C18, 0x44184C18,
+0x44184C18, 0x43F74C18, 0x44184C18, 0x43F74C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18,
+0x44184C18, 0x43F74C18, 0x44184C18, 0x43F74C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18,
+0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C38, 0x44184C38,
+0x44184C38, 0x44384C38, 0x44384C38, 0x44184C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44184C38,
+0x44184C39, 0x44384C38, 0x44384C38, 0x44384C38, 0x44184C39, 0x44174C38, 0x44174C38, 0x5C995C79,
+0x44584438, 0x4C384418, 0x54385438, 0x3A0D3292, 0x59025106, 0x8CCA7B87, 0x950B8CCA, 0x6C057C68,
+0x95696C05, 0xBE4BBE4B, 0xCEAD8CA5, 0xDE4FE70F, 0x89C650A0, 0x91A6A228, 0x50A36882, 0x73F430C6,
+0x4C385C16, 0x44194C39, 0x4C384C39, 0x44384C38, 0x44584459, 0x44384459, 0x4C384C39, 0x44384439,
+0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38,
+0x44384C59, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C59, 0x44384C38, 0x44384C59, 0x44384C38,
+0x44384C59, 0x44384C38, 0x44384C59, 0x44384C38, 0x44384C59, 0x44384C38, 0x44384C59, 0x44384C38,
+0x44384C38, 0x44384C38, 0x44384C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C18,
+0x44184C38, 0x44184C18, 0x44184C18, 0x43F84418, 0x44184C38, 0x43F74418, 0x43F84418, 0x43F74418,
+0x3BF74418, 0x3BD743F8, 0x3BF743F8, 0x3BD743F8, 0x43D743F8, 0x3BD743D8, 0x3BD743D8, 0x3BB743D7,
+0x3BD743D8, 0x3BB743D7, 0x3BB743D7, 0x3BB63BB7, 0x3BB743B7, 0x3BB63BB7, 0x3B963BB7, 0x3B963BB7,
+0x3B553B55, 0x3B763B55, 0x3B763B55, 0x3B763B75, 0x3B763375, 0x3B963B76, 0x3B963B76, 0x3B963B96,
+0x3B963396, 0x3BB73B96, 0x3BB73B96, 0x3BB73BB6, 0x3BB73B96, 0x43D73BB6, 0x43B73BB6, 0x43D73BB6,
+0x43D73BD7, 0x43D73BD7, 0x43D73BD7, 0x43F73BD7, 0x43F73BD7, 0x43F83BF7, 0x43F73BF7, 0x43F73BF7,
+0x43F73BF7, 0x441843F7, 0x441743F7, 0x441743F7, 0x441843F7, 0x4C1843F7, 0x441843F7, 0x4C1843F7,
+0x441843F7, 0x4C184417, 0x44184417, 0x4C184417, 0x44184417, 0x4C184417, 0x44184417, 0x4C184417,
+0x44184417, 0x4C184417, 0x44184417, 0x4C184417, 0x44184417, 0x4C184417, 0x44184417, 0x4C184417,
+0x4C184417, 0x4C384417, 0x44184417, 0x4C184417, 0x4C184417, 0x4C384417, 0x4C184417, 0x4C384417,
+0x4C184417, 0x4C384417, 0x4C184417, 0x44384417, 0x44384417, 0x44384417, 0x44384417, 0x4C384438,
+0x44384417, 0x44384417, 0x44384417, 0x44384438, 0x44384417, 0x44384438, 0x44384417, 0x44384438,
+0x44384418, 0x44384438, 0x44384417, 0x44384438, 0x4C384417, 0x44384417, 0x43F74C38, 0x4C1764FA,
+0x44384437, 0x4C384438, 0x4C184418, 0x29EE5438, 0x51034927, 0x9CEB6AE5, 0x8D0A8489, 0x6C267C88,
+0x84C76C25, 0xADA9BE4C, 0xC68DCEAD, 0xD62DADE9, 0x89839B27, 0x994588C2, 0x61068987, 0x38E74043,
+0x5C167414, 0x4C384BF7, 0x4C394418, 0x44594418, 0x44583C38, 0x4C394438, 0x44384418, 0x44584438,
+0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438,
+0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438,
+0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438,
+0x44384438, 0x4C384438, 0x44384417, 0x4C384438, 0x4C384417, 0x4C384418, 0x4C184417, 0x4C384417,
+0x4C1843F7, 0x4C184417, 0x44184417, 0x44184417, 0x44184417, 0x44184417, 0x441843F7, 0x441843F7,
+0x44183BF7, 0x44183BF7, 0x43F73BF7, 0x43F73BF7, 0x43F73BD7, 0x43F73BF7, 0x43D73BB7, 0x43D73BD7,
+0x3BD73BB7, 0x43D73BB7, 0x3BB73BB7, 0x3BB73BB7, 0x3BB73BB6, 0x3BB73BB7, 0x3BB73B96, 0x3BB73B96,
+0x3B553B76, 0x3B764376, 0x3B763B76, 0x3B764396, 0x3B763B96, 0x3B963B96, 0x3B963B97, 0x3B964397,
+0x3B963BB7, 0x3BB643B7, 0x3BB643B7, 0x3BB743B7, 0x3BB643B7, 0x3BB743D7, 0x3BB743D7, 0x3BD743D7,
+0x3BD743D7, 0x43D743F8, 0x43D743F8, 0x43F743F8, 0x43F743F8, 0x43F74418, 0x43F743F8, 0x43F74418,
+0x43F74418, 0x44184C18, 0x43F74418, 0x44174C18, 0x44174C18, 0x44184C18, 0x44174C18, 0x44174C18,
+0x44174C18, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38,
+0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38,
+0x44184C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38,
+0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C58,
+0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38, 0x44384C38,
+0x44384459, 0x44384C58, 0x44384C38, 0x44384C58, 0x44184C38, 0x4C384C59, 0x4C374C18, 0x4C3764FA,
+0x44384C38, 0x44384458, 0x44184C59, 0x3AD25479, 0x490451CB, 0x9CCB6285, 0x84C98CCA, 0x63E68CEA,
+0x63C46C06, 0xCECEC68D, 0xADA9BE0B, 0xC62BB609, 0x5020A3E8, 0x98C2A163, 0x81A89146, 0x30446927,
+0x7C153949, 0x4C175C37, 0x44384C38, 0x44384439, 0x44384458, 0x4C384C39, 0x44384C39, 0x44584459,
+0x44384458, 0x44384C58, 0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58,
+0x44384C58, 0x44384C59, 0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58,
+0x44384C38, 0x44384C59, 0x44384C38, 0x44384C58, 0x44384C58, 0x44384C59, 0x44384C58, 0x44384C58,
+0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58, 0x44184C38, 0x4C384C38, 0x44184C38, 0x4C384C38,
+0x44184C18, 0x4C184C38, 0x44174C38, 0x44184C38, 0x44184C18, 0x44184C38, 0x44184C18, 0x44184C18,
+0x3BF74418, 0x44174418, 0x3BF74418, 0x3BF743F8, 0x3BF743F8, 0x3BD743F8, 0x3BD743D8, 0x3BD743F8,
+0x3BD743D8, 0x3BD743D8, 0x3BB743D7, 0x3BB743D7, 0x3BB73BB7, 0x3BB743D7, 0x3BB73BB7, 0x3BB73BB7,
+0x43763B75, 0x3B763B75, 0x3B963B75, 0x3B963B75, 0x3B963B76, 0x3B963B96, 0x43973B96, 0x3BB73B96,
+0x3BB73B96, 0x3BB73B96, 0x43B73BB6, 0x43B73BB6, 0x43D73BB6, 0x43D73BB6, 0x43D73BD6, 0x43D73BD6,
+0x43F73BD7, 0x43F73BD7, 0x43F73BF7, 0x43F73BF7, 0x43F743F7, 0x43F743F7, 0x441843F7, 0x441843F7,
+0x4C1843F7, 0x4C1843F7, 0x441843F7, 0x4C1843F7, 0x4C184417, 0x4C1843F7, 0x4C184418, 0x4C184417,
+0x4C184417, 0x4C184417, 0x4C384418, 0x4C384418, 0x4C384418, 0x4C384418, 0x4C384418, 0x4C384418,
+0x4C384417, 0x4C384417, 0x4C384417, 0x4C384417, 0x4C384417, 0x4C384417, 0x4C384417, 0x4C384417,
+0x44384417, 0x44384417, 0x4C584437, 0x44384437, 0x44384437, 0x44384437, 0x44384438, 0x44384417,
+0x44384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438, 0x44384438,
+0x44584438, 0x44384438, 0x44584438, 0x44384438, 0x44584438, 0x44384438, 0x44584438, 0x44384438,
+0x44594438, 0x4C384438, 0x4C584438, 0x4C384438, 0x44384438, 0x4C384438, 0x4C374C37, 0x4C1764FA,
+0x4C794437, 0x44383C37, 0x44394458, 0x53D64459, 0x414641CD, 0x9CCB5203, 0x8D0B8CA9, 0x6BE784CA,
+0x84C96BE7, 0xBE4CB62C, 0xADA8A568, 0xBE4BADE8, 0x58C0A447, 0xA8E29942, 0x892598C2, 0x494A722C,
+0x41493044, 0x54387457, 0x44584437, 0x44384438, 0x44584458, 0x4C394438, 0x44584438, 0x4C584438,
+0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438,
+0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438,
+0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438,
+0x4C384438, 0x44384438, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C384418,
+0x4C384418, 0x4C184418, 0x4C384418, 0x4C184417, 0x4C184417, 0x44184417, 0x4C184417, 0x441843F8,
+0x441843F7, 0x44183BF7, 0x441843F7, 0x43F73BF7, 0x43F83BF7, 0x43F73BD7, 0x43F73BD7, 0x43D73BD7,
+0x43D83BD7, 0x43D73BD7, 0x43D73BD7, 0x3BD73BB7, 0x43D73BB7, 0x3BB73BB6, 0x3BB73BB6, 0x3BB73BB6,
+0x3B764396, 0x3B764396, 0x3B764396, 0x3B763B96, 0x3B9643B6, 0x3B9643B7, 0x3B9643B7, 0x3BB643B7,
+0x3BB743B7, 0x3BB743B7, 0x43B743D7, 0x3BB643D7, 0x43D743D7, 0x43D743D7, 0x43D743F7, 0x43D743F7,
+0x43F743F7, 0x43F743F7, 0x43F74418, 0x43F743F8, 0x43F74418, 0x43F74418, 0x43F74418, 0x43F74418,
+0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x44184C18, 0x4C184C38, 0x44184C38,
+0x44184C38, 0x44184C38, 0x4C384C38, 0x44184C38, 0x4C384C38, 0x44184C38, 0x4C384C38, 0x44184C38,
+0x4C384C38, 0x44184C38, 0x4C384C38, 0x44184C38, 0x4C384C38, 0x44184C38, 0x4C384C38, 0x44384C38,
+0x44384C58, 0x44384C58, 0x44384C58, 0x44384C38, 0x44384C58, 0x44384C58, 0x44384C58, 0x44384C58,
+0x44384C59, 0x44384C38, 0x44384C59, 0x44384C38, 0x44384C59, 0x44384C38, 0x44384C59, 0x44384C59,
+0x44584C59, 0x44384C59, 0x44584C59, 0x44384C59, 0x44584C59, 0x44384C59, 0x44584C59, 0x44384C59,
+0x44584C59, 0x44384C59, 0x4C384C58, 0x44384C59, 0x44384C59, 0x44384C59, 0x54785459, 0x441764DA,
+0x4C584C38, 0x44584458, 0x44384C59, 0x5C784C59, 0x39A93A0F, 0x9CCB41A3, 0x84C994EB, 0x6C078D0B,
+0x7448954D, 0xB64B84A6, 0xBE09B5C9, 0xB60ABE6A, 0x71E0DE6E, 0x98808901, 0x9125A903, 0x6A8F616A,
+0x28664929, 0x747739AC, 0x4C775457, 0x44584438, 0x44594C79, 0x4C384C39, 0x4C584C59, 0x4C384C58,
+0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x44384C59, 0x44384C59,
+0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59,
+0x44384C59, 0x44384C59, 0x44384C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x44384C59, 0x44384C59,
+0x44384C59, 0x44384C59, 0x44384C59, 0x44384C59, 0x4C384C59, 0x44384C59, 0x4C384C59, 0x4C384C39,
+0x4C384C59, 0x4C384C38, 0x4C384C39, 0x44184C38, 0x44184C38, 0x44184C38, 0x4C184C38, 0x44184C18,
+0x44184418, 0x44184418, 0x44184418, 0x43F74418, 0x43F74418, 0x3BF743F8, 0x3BF743F8, 0x43D743F8,
+0x43D743F8, 0x43D743F8, 0x43D743F8, 0x3BD743D8, 0x3BD743D7, 0x3BB743D7, 0x3BB743D7, 0x3BB643B7,
+0x3B763B75, 0x3B963B75, 0x3B963B75, 0x3B963B96, 0x3B963B96, 0x43B73B96, 0x3B973B96, 0x43B73B96,
+0x43B63B96, 0x43B73BB6, 0x43B73BB6, 0x43D73BB6, 0x43D73BB6, 0x43F73BD7, 0x43F73BD7, 0x43F73BD7,
+0x43F73BD7, 0x44173BF7, 0x43F73BF7, 0x44173BF7, 0x43F743F7, 0x441743F7, 0x441743F7, 0x441843F7,
+0x441843F7, 0x4C184417, 0x44184417, 0x4C184417, 0x4C184417, 0x4C384417, 0x4C384417, 0x4C384417,
+0x44384417, 0x4C384437, 0x44384417, 0x4C384437, 0x44384417, 0x4C384437, 0x44384417, 0x4C384437,
+0x44384417, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C384438, 0x44384417, 0x4C384438,
+0x44384438, 0x4C384438, 0x44384438, 0x44384438, 0x44384438, 0x4C384438, 0x44384438, 0x4C384438,
+0x44384438, 0x4C384438, 0x44384438, 0x4C584438, 0x44384438, 0x4C584438, 0x4C384438, 0x4C584438,
+0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438,
+0x4C384438, 0x4C584438, 0x4C384437, 0x4C584438, 0x44384438, 0x4C584C58, 0x651B4417, 0x4C584C37,
+0x4C584C37, 0x44584458, 0x44394438, 0x54794458, 0x3A0D4B34, 0x9CCB3183, 0x8CCA8CA9, 0x950BA5AD,
+0x6BE663E6, 0xBE6C6C24, 0xB5E9ADC9, 0xADA8B608, 0x69E1B56A, 0x90C27901, 0x89048881, 0x59EC6988,
+0x316C4A4F, 0x49AA2844, 0x54377477, 0x4C584437, 0x44593C58, 0x4C584457, 0x4C384C37, 0x4C594C38,
+0x4C584438, 0x4C584458, 0x4C584438, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584438, 0x4C584458,
+0x4C584458, 0x4C584458, 0x4C584458, 0x4C584458, 0x44584438, 0x4C584458, 0x44584438, 0x4C584458,
+0x44584438, 0x4C584458, 0x44584438, 0x4C584458, 0x44584438, 0x4C584458, 0x44584438, 0x4C584458,
+0x44584458, 0x4C584458, 0x4C584438, 0x4C584438, 0x4C584437, 0x4C584438, 0x4C584437, 0x4C584438,
+0x4C384438, 0x4C384C38, 0x44384438, 0x4C384438, 0x44384417, 0x44384438, 0x4C184417, 0x4C384417,
+0x44184417, 0x44184417, 0x44184417, 0x441843F7, 0x43F83BF7, 0x43F83BF7, 0x43F73BF7, 0x43F73BF7,
+0x43F73BD7, 0x43F73BD7, 0x43D73BD7, 0x43F73BD7, 0x43D73BB7, 0x43D73BB7, 0x3BD73BB6, 0x3BB73BB6,
+0x3B763B96, 0x3B963B96, 0x3B963B96, 0x3B9643B6, 0x3B9643B6, 0x3B9643B7, 0x3B9643B7, 0x3BB743B7,
+0x3BB643B7, 0x43B743D7, 0x3BB743D7, 0x43D743D7, 0x3BD743D7, 0x43D743F7, 0x43F743F7, 0x43F743F8,
+0x3BF74418, 0x44174418, 0x3BF74418, 0x44174418, 0x43F74418, 0x44174C18, 0x44174C18, 0x44184C38,
+0x44174C18, 0x44184C38, 0x44184C38, 0x44184C38, 0x44184C38, 0x4C384C38, 0x44174C38, 0x44384C38,
+0x44384C38, 0x44384C58, 0x44374C38, 0x44384C38, 0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58,
+0x44384C38, 0x4C384C58, 0x44384C58, 0x4C384C59, 0x44384C38, 0x44384C58, 0x44384C38, 0x44384C58,
+0x44384C38, 0x44384C58, 0x44384C58, 0x44384C59, 0x44384C38, 0x44384C59, 0x44384C58, 0x44384C59,
+0x44384C58, 0x44384C59, 0x44384C58, 0x44384C59, 0x44384C58, 0x44384C59, 0x44384C58, 0x44384C59,
+0x44384C59, 0x4C584C59, 0x44384C58, 0x44384C59, 0x44384C58, 0x4C584C59, 0x44384C59, 0x4C584C59,
+0x44384C59, 0x4C584C58, 0x4C384C58, 0x4C584C58, 0x44384C59, 0x44384C79, 0x6D3B4C38, 0x4C574C17,
+0x44384C58, 0x44594C79, 0x44584459, 0x4C584C58, 0x29ED647A, 0x948C3184, 0xADEE94EB, 0x63C59D4B,
+0x6C267427, 0xADEA7425, 0xB609B60A, 0xA568B629, 0x7AC4AD09, 0x808270E1, 0x788188A1, 0x518A68C5,
+0x325042B3, 0x30854169, 0x7457420D, 0x4C585C58, 0x44584C59, 0x4C574C78, 0x4C384C58, 0x4C584C59,
+0x4C584C58, 0x4C584C79, 0x4C584C58, 0x4C584C79, 0x4C584C58, 0x4C584C79, 0x4C584C58, 0x4C584C79,
+0x44584C79, 0x44584C79, 0x44584C58, 0x44584C79, 0x44584C58, 0x44584C79, 0x44584C58, 0x44584C79,
+0x44584C58, 0x44584C58, 0x44584C58, 0x44584C79, 0x44584C58, 0x44584C79, 0x44584C58, 0x44584C79,
+0x44584C79, 0x44584C79, 0x44584C58, 0x4C584C58, 0x44584C58, 0x4C584C58, 0x44384C58, 0x4C384C58,
+0x44384C58, 0x44384C59, 0x44384C58, 0x44384C58, 0x44384C38, 0x44384C58, 0x44184C38, 0x44184C38,
+0x44184C38, 0x44184C38, 0x44174438, 0x44184C38, 0x43F74418, 0x43F74418, 0x43F74418, 0x43F74418,
+0x43F743F8, 0x43F743F8, 0x3BD743F8, 0x3BD743F8, 0x3BD743D7, 0x3BD743D7, 0x3BD743D7, 0x3BB743D7,
+0x3B963B96, 0x3B963B95, 0x43B63B96, 0x43B63B96, 0x43B63B96, 0x43B73B96, 0x43B73B96, 0x43B73B96,
+0x43D73BB6, 0x43D73BB6, 0x43D73BD7, 0x43D73BB6, 0x43F73BD7, 0x43F73BD7, 0x43F83BF7, 0x43F83BF7,
+0x44183BF7, 0x44173BF7, 0x44183BF7, 0x44183BF7, 0x441843F7, 0x44184417, 0x4C384417, 0x4C184417,
+0x4C384418, 0x4C384417, 0x4C384438, 0x44384418, 0x4C384438, 0x4C384437, 0x4C384438, 0x4C384437,
+0x4C384438, 0x4C384437, 0x4C384438, 0x4C384437, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438,
+0x4C584438, 0x4C384438, 0x4C594438, 0x4C584438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438,
+0x4C584438, 0x4C384438, 0x4C594438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C594438, 0x4C384438,
+0x4C594438, 0x4C584438, 0x4C594438, 0x4C584438, 0x4C594438, 0x4C584438, 0x4C594438, 0x4C584438,
+0x4C594C58, 0x4C584438, 0x4C594438, 0x4C584438, 0x4C594438, 0x4C584438, 0x4C594C58, 0x4C594438,
+0x4C584458, 0x4C584438, 0x4C584C58, 0x4C584458, 0x4C794438, 0x4C584438, 0x651B4C58, 0x4C584C37,
+0x4C584C57, 0x44594459, 0x4C584459, 0x4C374457, 0x3AF15459, 0xAD502123, 0x84A9A56E, 0x7406A58C,
+0x74476C26, 0x8D076C05, 0xB629B64A, 0x9D07A587, 0x9BA7B56B, 0x70205840, 0x88617800, 0x69AA80C4,
+0x1A933292, 0x396A322F, 0x5A2D3065, 0x54177456, 0x4C794C58, 0x44594458, 0x4C794458, 0x4C784458,
+0x4C794458, 0x4C584458, 0x4C794C58, 0x4C584458, 0x4C794C58, 0x4C584458, 0x4C794C58, 0x4C584458,
+0x4C794458, 0x4C584458, 0x4C794458, 0x4C584458, 0x4C794458, 0x4C584458, 0x4C794458, 0x4C584458,
+0x4C584458, 0x4C584458, 0x4C794458, 0x4C584458, 0x4C794458, 0x4C584458, 0x4C794458, 0x4C584458,
+0x4C794458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584438,
+0x4C584458, 0x44584438, 0x44584438, 0x4C384438, 0x4C584438, 0x44384438, 0x4C384438, 0x44384418,
+0x4C384418, 0x44384417, 0x44384418, 0x44184417, 0x44184418, 0x44183BF7, 0x441843F7, 0x43F83BF7,
+0x43F83BF7, 0x43F73BF7, 0x43F83BF7, 0x43F73BD7, 0x43D73BD7, 0x43D73BB6, 0x43D73BD7, 0x43B73BB6,
+0x3B964396, 0x3B9643B6, 0x3BB643B7, 0x3BB643B7, 0x43B643B7, 0x43B643B7, 0x43B643B7, 0x43B643B7,
+0x43D643D7, 0x43D643D7, 0x43D743D7, 0x43D743D7, 0x43F743F7, 0x43F743F8, 0x43F74418, 0x43F74418,
+0x44174418, 0x44174418, 0x44174418, 0x44174418, 0x44184C18, 0x44184C38, 0x44184C38, 0x44184C18,
+0x4C384C38, 0x4C384C38, 0x44384C38, 0x44384C38, 0x44384C58, 0x44384C58, 0x4C384C58, 0x44384C58,
+0x4C384C58, 0x44384C58, 0x4C384C58, 0x44384C58, 0x4C384C58, 0x44384C58, 0x4C384C58, 0x44384C58,
+0x44384C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59,
+0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59,
+0x4C584C59, 0x44384C59, 0x4C584C59, 0x44384C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C384C59,
+0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59,
+0x4C584C79, 0x4C384C59, 0x4C584C59, 0x44584C59, 0x4C594C79, 0x4C784C79, 0x653B4C38, 0x4C584C38,
+0x44584C58, 0x44594C79, 0x4C584C79, 0x4C575478, 0x5C365459, 0x7BEC6BB0, 0x84C98CAB, 0x6C05ADCD,
+0x6C267447, 0x74457447, 0xADE8BE6C, 0xB5CAA568, 0x93A7D68F, 0x912468A0, 0xA9A6A986, 0x6107A166,
+0x0A9432D3, 0x31CE2252, 0x30654929, 0x74575A8F, 0x4C585C58, 0x44594C59, 0x44794C7A, 0x44784498,
+0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79,
+0x4C584C79, 0x44584C79, 0x4C584C79, 0x44584C79, 0x4C584C79, 0x44584C79, 0x4C584C79, 0x44584C79,
+0x44584C79, 0x44584C59, 0x4C584C79, 0x44584C79, 0x4C584C79, 0x44584C79, 0x4C784C79, 0x4C584C79,
+0x44584C79, 0x44584C59, 0x44584C79, 0x44584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x44584C58,
+0x44584C59, 0x44584C58, 0x44584C59, 0x44384C59, 0x44384C59, 0x44384C59, 0x44384C59, 0x44384C38,
+0x4C384C39, 0x44184C38, 0x44384C38, 0x44184C38, 0x44184C39, 0x44184418, 0x44184418, 0x43F74418,
+0x43F74418, 0x43F743F8, 0x43F743F8, 0x43D743F8, 0x43D743F8, 0x43D743D7, 0x43D743D7, 0x3BB643D7,
+0x3B963B76, 0x3BB63B96, 0x3BB63B96, 0x43B73BB6, 0x43B73B96, 0x43B74396, 0x43B63BB6, 0x43D743B6,
+0x43D73BB6, 0x43D73BD7, 0x43D73BD6, 0x43F743D7, 0x43F743D7, 0x43F743F7, 0x43F73BF7, 0x44173BF7,
+0x44173BF7, 0x44174417, 0x441843F7, 0x4C184417, 0x4C184417, 0x4C384417, 0x4C184417, 0x4C384417,
+0x4C384417, 0x4C384437, 0x4C384437, 0x4C384437, 0x4C384437, 0x4C584438, 0x4C384437, 0x4C584438,
+0x4C384437, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438,
+0x4C584438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438,
+0x4C584438, 0x4C584C38, 0x4C584438, 0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584438, 0x4C584C58,
+0x4C584458, 0x4C584458, 0x4C584458, 0x4C584C58, 0x4C584458, 0x4C584C58, 0x4C584458, 0x4C584C58,
+0x4C584458, 0x4C584C58, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584C58,
+0x4C594458, 0x54584C58, 0x4C584C58, 0x44784458, 0x44584458, 0x4C594458, 0x54785CFA, 0x4C374C57,
+0x44584457, 0x4C594459, 0x4C784458, 0x4C174C57, 0x855B6D3B, 0x5AEA29AA, 0x84E984CB, 0x7446ADED,
+0x6C466C46, 0x6C056C46, 0xADC9A5CA, 0xC66CADE9, 0x8B45B5CB, 0x91257943, 0x704178C2, 0x50C67882,
+0x0AD52250, 0x22720A94, 0x496931AC, 0x62AE3064, 0x4C586C77, 0x4C584C58, 0x4C993C58, 0x4C983C57,
+0x4C784458, 0x4C784458, 0x4C784458, 0x4C784458, 0x4C784458, 0x4C794458, 0x4C784458, 0x4C794458,
+0x4C784458, 0x4C794458, 0x4C584458, 0x4C794458, 0x4C784458, 0x4C794458, 0x4C784458, 0x4C584458,
+0x4C784458, 0x4C794458, 0x4C784458, 0x4C794458, 0x4C584458, 0x4C794458, 0x4C584458, 0x4C584458,
+0x4C784458, 0x4C784458, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584C58, 0x4C584458, 0x4C584C58,
+0x4C584438, 0x4C584458, 0x4C584438, 0x4C584438, 0x4C384438, 0x4C584438, 0x4C384438, 0x4C584438,
+0x4C384437, 0x4C384438, 0x44384417, 0x44384417, 0x4C184417, 0x4C184417, 0x441843F7, 0x441743F7,
+0x44173BF7, 0x44183BF7, 0x43F83BF7, 0x43F843F7, 0x43F73BD7, 0x43F743D7, 0x43D73BD7, 0x43D73BD7,
+0x3B964397, 0x3BB643B7, 0x3BB643B6, 0x43B643D7, 0x439643B7, 0x43B74BB7, 0x43B643B7, 0x43D643D7,
+0x3BD743F7, 0x43D743F7, 0x43D743F7, 0x43F743F8, 0x43F743F8, 0x43F74418, 0x43F74418, 0x44174418,
+0x44174418, 0x44174C38, 0x44174C18, 0x44184C38, 0x44184C38, 0x4C174C38, 0x4C174C38, 0x4C384C38,
+0x4C384C38, 0x4C384C58, 0x44384C58, 0x4C384C58, 0x44384C58, 0x4C384C58, 0x4C384C58, 0x4C584C58,
+0x4C384C58, 0x4C584C58, 0x4C384C58, 0x4C584C58, 0x4C384C58, 0x4C584C58, 0x4C384C58, 0x4C584C58,
+0x4C384C58, 0x4C584C58, 0x4C384C58, 0x4C584C58, 0x4C584C58, 0x4C584C59, 0x4C584C58, 0x4C584C59,
+0x4C384C58, 0x4C585459, 0x4C584C58, 0x4C584C59, 0x4C584C58, 0x4C584C59, 0x4C584C59, 0x4C584C59,
+0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79,
+0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79,
+0x4C584C59, 0x4C584C79, 0x4C584C79, 0x44784C79, 0x4C794C79, 0x44584458, 0x4C586D5C, 0x54985458,
+0x4C784C58, 0x4C58547A, 0x44374C78, 0x7D9C5CB9, 0x54365C78, 0x21865B72, 0x84A884CC, 0x7C87BE6F,
+0x6C467447, 0x6C256C47, 0xB62B9508, 0xA568ADEA, 0x8365AD8A, 0x70216080, 0x70817081, 0x48859987,
+0x02D63292, 0x12940296, 0x314A3292, 0x38A45127, 0x74976331, 0x54585C58, 0x44784C99, 0x44784C98,
+0x4C784C99, 0x4C784C99, 0x4C784C99, 0x4C784C99, 0x4C784C79, 0x4C794C79, 0x4C784C79, 0x4C784C79,
+0x4C784C79, 0x4C794C79, 0x4C784C79, 0x4C784C79, 0x4C784C79, 0x4C784C79, 0x4C784C79, 0x4C584C79,
+0x4C584C79, 0x4C784C79, 0x4C784C79, 0x4C784C79, 0x4C584C79, 0x4C784C79, 0x4C584C79, 0x4C584C79,
+0x4C784C79, 0x4C784C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79,
+0x4C584C58, 0x4C584C79, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C384C59, 0x4C384C59,
+0x44384C58, 0x44384C58, 0x44384C38, 0x44384C38, 0x44184C38, 0x44184C38, 0x44174C18, 0x44174C18,
+0x44174418, 0x43F74418, 0x43F74418, 0x43F74418, 0x43F743F8, 0x43F743F8, 0x43D743F8, 0x43D743F8,
+0x43B63B96, 0x3BB63B96, 0x43D63BB6, 0x43B73BB6, 0x43B73BB6, 0x43B74396, 0x43D743B6, 0x43D73BD6,
+0x43F73BD6, 0x43F73BD7, 0x43F743F7, 0x43F73BF7, 0x441843F7, 0x441843F7, 0x441843F7, 0x441843F7,
+0x4C184417, 0x4C184417, 0x4C384418, 0x4C384417, 0x4C384418, 0x4C384417, 0x4C384438, 0x4C384437,
+0x4C584C38, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584438,
+0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584438,
+0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584C58, 0x4C594C58, 0x4C584C58, 0x4C594C58, 0x4C584C58,
+0x4C594C58, 0x4C584C58, 0x4C594C58, 0x4C584C58, 0x4C594C58, 0x4C584C58, 0x4C594C58, 0x4C584458,
+0x4C794C58, 0x4C584458, 0x4C794C58, 0x4C584458, 0x4C794C58, 0x4C584458, 0x4C794C58, 0x4C584458,
+0x4C794458, 0x4C794458, 0x4C794458, 0x4C794458, 0x4C794458, 0x4C794458, 0x4C794458, 0x4C794458,
+0x4C794C58, 0x4C794458, 0x4C794478, 0x4C794C58, 0x4C994458, 0x4C784478, 0x4C58653B, 0x4C574C78,
+0x54784C58, 0x4C784C58, 0x759C4C58, 0x4C37651A, 0x54584C58, 0x11476456, 0x94EA950F, 0x8CC8DF72,
+0x74877446, 0x74466426, 0xADCA7444, 0x94E89D68, 0x624294C9, 0x706158C0, 0xA1657840, 0x40A678C3,
+0x031722B3, 0x12F702F7, 0x32711273, 0x59054107, 0x7B3138A4, 0x5C387457, 0x4C984C58, 0x4C984C78,
+0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C794C78, 0x4C794C78,
+0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78,
+0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794C78,
+0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C794478, 0x4C794C78, 0x4C794458, 0x4C794458, 0x4C584458,
+0x4C794C58, 0x4C584458, 0x4C794C58, 0x4C584458, 0x4C594C58, 0x4C594C58, 0x4C594C58, 0x4C584438,
+0x4C584438, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C384438, 0x4C184418, 0x4C384418, 0x44184417,
+0x44184417, 0x44184417, 0x44184417, 0x43F843F7, 0x43F843F7, 0x43F83BF7, 0x43F843F7, 0x43D73BD7,
+0x439643B7, 0x3BB643B7, 0x3BD643D7, 0x3BB643D7, 0x43B743D7, 0x43B743D7, 0x43D743D7, 0x43D743D7,
+0x43F743F7, 0x43F743F8, 0x43F74C18, 0x43F74418, 0x44174418, 0x44174418, 0x44184C18, 0x44184C18,
+0x44184C38, 0x44184C38, 0x4C384C38, 0x44184C38, 0x4C384C39, 0x4C384C38, 0x4C384C58, 0x4C384C58,
+0x4C584C59, 0x4C384C58, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59,
+0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C584C79, 0x4C584C59,
+0x4C584C79, 0x4C584C59, 0x4C585479, 0x4C584C79, 0x4C584C79, 0x4C584C59, 0x4C585479, 0x4C584C79,
+0x4C585479, 0x4C584C79, 0x4C585479, 0x4C584C59, 0x4C584C79, 0x4C584C79, 0x4C585479, 0x4C584C79,
+0x4C784C79, 0x4C584C79, 0x4C784C79, 0x4C584C79, 0x4C784C79, 0x4C584C79, 0x4C784C79, 0x4C784C79,
+0x4C784C79, 0x4C784C79, 0x4C784C79, 0x4C584C79, 0x4C794C79, 0x4C784C79, 0x4C794C79, 0x4C784C79,
+0x4C794C99, 0x44994C99, 0x4C794C99, 0x4C785479, 0x4C785479, 0x44574C58, 0x4C786D5C, 0x4C785499,
+0x4C585499, 0x5CD94C37, 0x5498759D, 0x4C784C57, 0x54B94C99, 0x222B64B9, 0xDF145B29, 0x9D09DF12,
+0x74677C47, 0x6C466C47, 0x95287465, 0x8CC89508, 0x49409489, 0x88E35860, 0x9103A965, 0x41086883,
+0x0B9922D4, 0x02750B18, 0x1A520AB6, 0x49064A0D, 0x48A46105, 0x6C17626F, 0x4C786479, 0x4C785479,
+0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C794C99, 0x4C794C79,
+0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99,
+0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99,
+0x4C995499, 0x4C794C99, 0x4C995499, 0x4C794C99, 0x4C794C99, 0x4C794C79, 0x4C794C79, 0x4C784C79,
+0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C594C79, 0x4C584C59, 0x4C584C59, 0x4C584C59,
+0x4C584C59, 0x4C384C58, 0x4C384C59, 0x44384C59, 0x4C384C39, 0x44184C38, 0x44184C38, 0x44184C38,
+0x44184C38, 0x44174418, 0x44174438, 0x43F74418, 0x43F84418, 0x43F743F8, 0x43F743F8, 0x43D743F8,
+0x43B63B96, 0x43B63BB6, 0x43D63BB6, 0x43D73BB6, 0x43B73BB7, 0x43D743B7, 0x43D743B6, 0x43F743D6,
+0x43F73BD6, 0x441743F7, 0x43F743F7, 0x441743F7, 0x441743F7, 0x4C184417, 0x4C184417, 0x4C384417,
+0x4C184417, 0x4C384417, 0x4C384417, 0x4C384438, 0x4C384438, 0x4C584438, 0x4C584438, 0x4C584438,
+0x4C584438, 0x4C584438, 0x4C584438, 0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584C38, 0x4C584C58,
+0x4C584438, 0x4C584C58, 0x4C584C58, 0x4C584C58, 0x4C584C58, 0x4C584C58, 0x4C584C58, 0x4C584C58,
+0x4C584C58, 0x4C594C58, 0x4C584C58, 0x4C794C58, 0x4C784C58, 0x4C794C58, 0x4C784C58, 0x4C794C58,
+0x4C784C58, 0x4C784C58, 0x4C784C58, 0x4C784C58, 0x4C784C58, 0x4C784C58, 0x4C784C58, 0x4C784C58,
+0x4C784478, 0x4C794C78, 0x4C794478, 0x4C794C78, 0x4C784478, 0x4C794C78, 0x4C794478, 0x4C794C78,
+0x4C784478, 0x4C794C78, 0x4C784478, 0x4C794C78, 0x4C794C78, 0x4C794C78, 0x4C794C78, 0x4C794C78,
+0x4C984C78, 0x4C994C78, 0x4C994499, 0x54794C78, 0x54784C58, 0x5CFA5498, 0x4C984CB8, 0x54584C78,
+0x54784C58, 0x651A759C, 0x54994C57, 0x4C784C78, 0x4C994478, 0x32F04C98, 0xDE942164, 0xA56BDF13,
+0x7C677405, 0x6C666C46, 0x7CA77445, 0x7C4674A7, 0x48C09449, 0x99059164, 0x808290A2, 0x416A7946,
+0x13DA1B15, 0x02950275, 0x12B502D5, 0x318C2231, 0x60A350C4, 0x39294064, 0x54597498, 0x54995499,
+0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78,
+0x4C994C98, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78,
+0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78,
+0x54994C78, 0x54994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C794C78, 0x4C794C78,
+0x4C794458, 0x4C794458, 0x4C784C58, 0x4C794C58, 0x4C584458, 0x4C584C58, 0x4C584458, 0x4C584C58,
+0x4C584458, 0x4C584C58, 0x4C584438, 0x4C584438, 0x4C384437, 0x4C384438, 0x4C384418, 0x4C384418,
+0x44384417, 0x44384417, 0x44184417, 0x441843F7, 0x43F743F7, 0x441843F7, 0x43F843F7, 0x43F843F7,
+0x3B9643B7, 0x43B643B7, 0x3BB643D7, 0x43D743D7, 0x43B743D7, 0x43D743D8, 0x43D743D7, 0x43F743F7,
+0x43F743F7, 0x44174418, 0x43F74418, 0x44174C18, 0x44174C18, 0x44174C38, 0x44174C38, 0x4C384C38,
+0x44174C38, 0x4C384C38, 0x4C384C38, 0x4C384C38, 0x4C384C38, 0x4C584C58, 0x4C584C58, 0x4C584C79,
+0x4C584C58, 0x4C584C59, 0x4C584C58, 0x4C584C79, 0x4C584C59, 0x4C584C79, 0x4C585459, 0x4C585459,
+0x4C584C58, 0x4C584C79, 0x4C584C79, 0x4C585479, 0x4C584C79, 0x4C585479, 0x4C584C79, 0x4C585479,
+0x4C585479, 0x4C585479, 0x4C585479, 0x4C585479, 0x4C584C79, 0x4C785479, 0x4C784C79, 0x4C785479,
+0x4C784C79, 0x4C785479, 0x4C784C79, 0x4C785479, 0x4C784C79, 0x4C785479, 0x4C784C79, 0x4C785479,
+0x4C784C79, 0x4C784C79, 0x4C784C99, 0x4C784C99, 0x4C784C99, 0x4C784C99, 0x4C784C99, 0x4C784C99,
+0x4C784C99, 0x4C795499, 0x4C784C99, 0x4C795499, 0x4C784C99, 0x4C795499, 0x4C784C99, 0x4C785499,
+0x4C984C99, 0x4C994C99, 0x44994CB9, 0x4C994CB9, 0x54775C99, 0x6D5B5478, 0x54B84C78, 0x54784C78,
+0x757C6CFB, 0x54985478, 0x4C585479, 0x4C985499, 0x44984CB9, 0x543554B9, 0xA4CF1925, 0xB5CDEF55,
+0x74467C26, 0x74A77467, 0x74667467, 0x8CA87CA8, 0x6920C54E, 0x98629924, 0x786298A2, 0x420D6127,
+0x033733F8, 0x02D602B6, 0x0A940AF6, 0x2A501294, 0x404238E7, 0x20A64085, 0x5CBA3AF2, 0x4C795499,
+0x4C985499, 0x4C985499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499,
+0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499,
+0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499,
+0x4C795499, 0x4C795499, 0x4C995499, 0x4C995499, 0x4C784C99, 0x4C795499, 0x4C784C99, 0x4C795499,
+0x4C784C99, 0x4C794C79, 0x4C784C79, 0x4C795479, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79,
+0x4C584C79, 0x4C584C79, 0x4C584C58, 0x4C584C59, 0x4C384C58, 0x4C584C59, 0x4C384C38, 0x4C384C59,
+0x44384C38, 0x44384C38, 0x44174438, 0x44174C18, 0x43F74C18, 0x43F74C18, 0x43F74418, 0x43F74418,
+0x43B743B6, 0x43B63BB6, 0x43D73BB6, 0x43D73BB6, 0x43D743D7, 0x43D73BD7, 0x43F743D7, 0x43F743F7,
+0x441743F7, 0x441743F7, 0x441843F7, 0x441843F7, 0x4C384417, 0x4C184417, 0x4C384417, 0x4C384417,
+0x4C384438, 0x4C384438, 0x4C384C38, 0x4C584438, 0x4C584438, 0x4C584438, 0x4C584C58, 0x4C584C58,
+0x4C594C58, 0x4C584C58, 0x4C794C58, 0x4C594C58, 0x4C794C58, 0x4C594C58, 0x54594C58, 0x4C594C58,
+0x4C794C58, 0x4C794C58, 0x4C794C58, 0x4C794C58, 0x4C794C58, 0x4C794C58, 0x54794C58, 0x4C794C58,
+0x4C794C78, 0x4C794C58, 0x4C794C78, 0x4C794C58, 0x4C794C78, 0x4C794C78, 0x4C994C78, 0x4C794C78,
+0x4C794C78, 0x4C794C78, 0x4C794C78, 0x4C794C78, 0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C994C78,
+0x4C994C78, 0x4C794C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78,
+0x4C994C78, 0x4C994C78, 0x4C994C99, 0x4C994C78, 0x4C994C99, 0x4C994C78, 0x4C994C99, 0x4C994C78,
+0x4C994C98, 0x4C994C78, 0x4CB94499, 0x4C994499, 0x5CB84C77, 0x757B4C56, 0x54575457, 0x759D4C78,
+0x4C5764FA, 0x4C985498, 0x54BA4C78, 0x4C984C57, 0x54D94477, 0x64B84C98, 0x734C29C9, 0xBE2FE736,
+0x7C667426, 0x7CA87466, 0x74887487, 0xC60E84C8, 0x7100B44A, 0x98418880, 0x9926A041, 0x4B54518A,
+0x02D71B36, 0x137902D6, 0x025202B5, 0x09AE12B3, 0x5B101109, 0x74D87C96, 0x54995C98, 0x54BA4498,
+0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98,
+0x54994C98, 0x4C994C78, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98,
+0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98,
+0x54994C98, 0x54994C78, 0x54994C78, 0x54994C78, 0x4C994C98, 0x4C994C78, 0x4C994C99, 0x4C994C78,
+0x4C994C99, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C794C78, 0x4C794458, 0x4C794458, 0x4C794458,
+0x4C794C58, 0x4C584C58, 0x4C794C58, 0x4C584C58, 0x4C584C58, 0x4C584438, 0x4C584438, 0x4C384438,
+0x4C384438, 0x4C384418, 0x4C384418, 0x44184417, 0x4C184418, 0x441843F7, 0x441843F7, 0x43F743F7,
+0x43D74BD7, 0x43D64BD7, 0x43D74BF7, 0x43D743D7, 0x43D743F8, 0x43D743F8, 0x43F74C18, 0x43F74418,
+0x44174C18, 0x44174C18, 0x44174C18, 0x44174C18, 0x44184C38, 0x44174C38, 0x44184C38, 0x4C384C38,
+0x4C384C38, 0x4C384C58, 0x4C384C59, 0x4C584C58, 0x4C584C79, 0x4C584C59, 0x4C584C59, 0x4C584C59,
+0x4C584C79, 0x4C584C79, 0x4C585479, 0x4C584C79, 0x4C585479, 0x4C585479, 0x4C595479, 0x4C585479,
+0x4C785479, 0x4C785479, 0x4C795479, 0x4C785479, 0x4C795479, 0x4C785479, 0x4C795479, 0x4C795479,
+0x4C795499, 0x4C795479, 0x4C795499, 0x4C795479, 0x4C795499, 0x4C784C99, 0x4C794C99, 0x4C784C99,
+0x4C795499, 0x4C795479, 0x4C795499, 0x4C795499, 0x4C995499, 0x4C794C99, 0x4C995499, 0x4C995499,
+0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499,
+0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499, 0x4C995499,
+0x4C985499, 0x4C995499, 0x4CB94CB9, 0x4CB84CB9, 0x4C7754D9, 0x757B5C98, 0x6D1A5C77, 0x54987DDD,
+0x5CB95C99, 0x4C985498, 0x4C7954BA, 0x4C985499, 0x4C7854B8, 0x5C975499, 0x4A495310, 0xD6D2DEF6,
+0x84A77C27, 0x6C467CC7, 0x6C4774A8, 0xD64F7C66, 0x9100B367, 0xB0E3A0E2, 0xA1C9C125, 0x3375420D,
+0x0B381B37, 0x02B51379, 0x0A720232, 0x337501D0, 0x64B86CF9, 0x54985C98, 0x4CB854B9, 0x4C9954B9,
+0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9,
+0x4C9954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9,
+0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C995499, 0x4C9954B9, 0x4C9954B9,
+0x54995499, 0x4C995499, 0x54995499, 0x4C995499, 0x4C9954B9, 0x4C995499, 0x4C9954B9, 0x4C995499,
+0x4C995499, 0x4C794C99, 0x4C794C99, 0x4C794C99, 0x4C794C99, 0x4C784C79, 0x4C784C79, 0x4C584C79,
+0x4C784C79, 0x4C584C79, 0x4C784C79, 0x4C584C59, 0x4C584C59, 0x4C584C59, 0x4C384C58, 0x44384C58,
+0x4C384C59, 0x4C384C38, 0x4C384C39, 0x44184C38, 0x44184C38, 0x44174C18, 0x44174C18, 0x43F74418,
+0x4BF74BF7, 0x4BF74BD6, 0x43D643D6, 0x43D743D6, 0x43F743D7, 0x43F843F7, 0x441743F7, 0x441743F7,
+0x441743F7, 0x4C184417, 0x4C184417, 0x4C384417, 0x4C184417, 0x4C384417, 0x4C384417, 0x4C384437,
+0x4C384417, 0x4C584C38, 0x4C584C38, 0x4C584C58, 0x4C584437, 0x4C584C58, 0x4C584438, 0x4C584C58,
+0x4C584C58, 0x4C584C58, 0x4C784C58, 0x4C794C58, 0x4C794C58, 0x54794C58, 0x4C794C78, 0x4C584C58,
+0x4C784C58, 0x54784C78, 0x4C784C78, 0x54794C78, 0x4C784C78, 0x54784C78, 0x4C784C78, 0x4C784C78,
+0x4C784C78, 0x54794C78, 0x4C784C78, 0x4C784C78, 0x4C984C78, 0x4C994C78, 0x4C994C78, 0x4C994C98,
+0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78,
+0x4C994C78, 0x4C994C78, 0x4C994C78, 0x54994C78, 0x4C994C78, 0x54994C98, 0x4C994C98, 0x54994C98,
+0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x54994C98, 0x54994C98,
+0x54984C98, 0x54995499, 0x4CB94499, 0x549854B9, 0x4C774C97, 0x64B8757A, 0x6D3B7D9C, 0x5CD954B9,
+0x5CFA54D9, 0x5CDA54D9, 0x5CDA54B9, 0x5CDA5CD9, 0x651A5CD9, 0x6CD95CFA, 0x4A8B7476, 0xD6B2DEF7,
+0x7C878468, 0x74666C45, 0x6C266C26, 0xD62F63C4, 0xA921A243, 0xC924C103, 0x7968B104, 0x1B7732B2,
+0x0AD50B16, 0x02110273, 0x1251018E, 0x5CDA5CFB, 0x54B84C98, 0x54B85498, 0x54994C98, 0x54B95499,
+0x54B94C98, 0x54B95498, 0x54B94C98, 0x54B95498, 0x54B94C98, 0x54995499, 0x54B94C98, 0x54B95499,
+0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98,
+0x54994C98, 0x54995499, 0x54994C98, 0x54995499, 0x54994C98, 0x54995499, 0x54994C98, 0x54994C98,
+0x54B94C98, 0x54B95498, 0x54B94C98, 0x54995499, 0x54994C98, 0x54994C98, 0x4C994C98, 0x54994C98,
+0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C994C78, 0x4C794C78, 0x4C794C78,
+0x4C784C58, 0x4C784C58, 0x4C584458, 0x4C584458, 0x4C584458, 0x4C584C58, 0x4C584438, 0x4C584438,
+0x4C384437, 0x4C584438, 0x4C384437, 0x4C384437, 0x44384417, 0x44384417, 0x44184417, 0x44184417,
+0x4C175438, 0x4C175417, 0x4BD75417, 0x43D74BF7, 0x43D74BF7, 0x43F74C18, 0x44174418, 0x44174C18,
+0x44174C18, 0x44174C38, 0x44174C38, 0x4C384C38, 0x4C384C38, 0x4C384C38, 0x4C384C38, 0x4C384C58,
+0x4C584C58, 0x4C585459, 0x4C584C58, 0x4C584C58, 0x4C584C58, 0x4C585479, 0x4C584C58, 0x4C585479,
+0x4C585479, 0x4C585479, 0x4C585479, 0x4C585479, 0x4C785479, 0x4C785479, 0x4C785479, 0x4C785479,
+0x4C785479, 0x4C785499, 0x4C785479, 0x4C785499, 0x4C785479, 0x4C785479, 0x4C785499, 0x4C785499,
+0x4C785499, 0x4C785499, 0x4C785499, 0x4C785499, 0x4C784C99, 0x4C985499, 0x4C985499, 0x4C985499,
+0x4C985499, 0x4C985499, 0x4C985499, 0x4C985499, 0x4C985499, 0x4C985499, 0x4C985499, 0x4C985499,
+0x4C985499, 0x4C985499, 0x4C985499, 0x4C995499, 0x4C985499, 0x4C9954B9, 0x4C985499, 0x4C995499,
+0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9854B9,
+0x54B954B9, 0x54995499, 0x4CB954BA, 0x54985478, 0x4C565CD9, 0x755AB71F, 0x54785C78, 0x54985C99,
+0x4CB854B9, 0x549854B9, 0x54985499, 0x54995C99, 0x547854B9, 0x5C775C99, 0x3A6B7498, 0xCE30D6B6,
+0x742552C1, 0x64257446, 0x6C056C25, 0xB50A63A4, 0xC122A1C2, 0xB8E3C8E2, 0x5148A1A7, 0x0B373335,
+0x021102B4, 0x018F0A52, 0x64FB4BF8, 0x54995499, 0x4CB854B9, 0x549954B9, 0x549954B9, 0x54995CB9,
+0x549854B9, 0x549954B9, 0x549854B9, 0x549954B9, 0x54B954B9, 0x549954B9, 0x549954B9, 0x549954B9,
+0x4C9854B9, 0x549954B9, 0x4C9854B9, 0x549954B9, 0x4C9854B9, 0x549954B9, 0x4C9854B9, 0x549954B9,
+0x549954B9, 0x549954B9, 0x549954B9, 0x549954B9, 0x549954B9, 0x549954B9, 0x549954B9, 0x549954B9,
+0x54B954B9, 0x549954B9, 0x549854B9, 0x549954B9, 0x4C9954B9, 0x549954B9, 0x4C9954B9, 0x549954B9,
+0x4C985499, 0x4C995499, 0x4C985499, 0x4C995499, 0x4C995499, 0x4C795499, 0x4C784C99, 0x4C784C99,
+0x4C785479, 0x4C785479, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C79, 0x4C584C59, 0x4C584C79,
+0x4C384C58, 0x4C384C58, 0x44384C58, 0x44384C58, 0x44384C38, 0x44384C38, 0x44184C38, 0x44184C38,
+0x4BF75417, 0x54174BF6, 0x54175417, 0x4BF74BF6, 0x43F743D7, 0x441843F7, 0x4C184417, 0x4C174417,
+0x4C384417, 0x4C184417, 0x4C384417, 0x4C384417, 0x4C384C38, 0x4C384C38, 0x4C584C38, 0x4C584C38,
+0x4C584C38, 0x4C584C38, 0x54794C58, 0x4C584C58, 0x54784C58, 0x4C784C58, 0x4C794C58, 0x4C794C58,
+0x54794C78, 0x54794C58, 0x54794C78, 0x54794C78, 0x54994C78, 0x54794C78, 0x54994C78, 0x54994C78,
+0x54994C78, 0x54994C78, 0x54994C78, 0x54994C78, 0x54994C78, 0x54994C78, 0x4C994C78, 0x4C994C78,
+0x54994C78, 0x4C994C78, 0x4C994C98, 0x4C994C78, 0x4C994C98, 0x4C994C78, 0x4C994C98, 0x4C994C98,
+0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x4C994C98,
+0x54B94C98, 0x4C994C98, 0x54B94C98, 0x54994C98, 0x54B94C98, 0x54994C98, 0x54B94C98, 0x54B94C98,
+0x54B94C98, 0x54994C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98,
+0x549854B8, 0x54B94C99, 0x549854B8, 0x5C9954B9, 0x33125436, 0x54783373, 0x5CD95497, 0x54995498,
+0x54B94CB8, 0x54984C98, 0x5C995498, 0x54995499, 0x54995498, 0x5C9954B9, 0x532F6498, 0xE714AD71,
+0x6C267426, 0x744663E5, 0x6C256C25, 0xA40863A4, 0xC0E290C0, 0xA924C0C1, 0x424F6147, 0x0AD622D5,
+0x01B00A53, 0x64DB1272, 0x5C9A549A, 0x5C995C99, 0x54B95498, 0x4CD94CB9, 0x54BA4CB9, 0x54B95499,
+0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498,
+0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498,
+0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498,
+0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B954B9, 0x54B95498, 0x54B94C98, 0x54B94C98,
+0x54B94C99, 0x54994C99, 0x54994C99, 0x54994C98, 0x54994C98, 0x4C994C98, 0x4C994C98, 0x4C994C78,
+0x4C994C78, 0x4C794C78, 0x4C794C78, 0x4C794C58, 0x4C794C58, 0x4C584C58, 0x4C784C58, 0x4C584C58,
+0x4C594C58, 0x4C584438, 0x4C584438, 0x4C384438, 0x4C384438, 0x4C384417, 0x4C384417, 0x4C184417,
+0x54175438, 0x54375417, 0x54375C58, 0x4C175417, 0x43F74C18, 0x44174C18, 0x44174C38, 0x44174C18,
+0x4C384C38, 0x44184C38, 0x4C384C38, 0x4C384C38, 0x4C384C58, 0x4C384C58, 0x4C384C59, 0x4C384C59,
+0x4C585459, 0x4C584C58, 0x54795479, 0x4C585479, 0x4C785479, 0x4C785479, 0x4C795479, 0x4C785479,
+0x54785479, 0x54785479, 0x54795499, 0x4C785499, 0x54995499, 0x4C785499, 0x54995499, 0x54995499,
+0x54995499, 0x54995499, 0x54995499, 0x4C995499, 0x54995499, 0x4C995499, 0x4C9954B9, 0x4C995499,
+0x54995499, 0x4C995499, 0x4C9954B9, 0x4C995499, 0x4C9954B9, 0x4C995499, 0x4CB954B9, 0x4C9954B9,
+0x4C9954B9, 0x4C995499, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9,
+0x4C9954B9, 0x4C9854B9, 0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9,
+0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C9954B9,
+0x4CB854B9, 0x4C9854B9, 0x54B854B9, 0x54575CB9, 0x3B53859C, 0x549864D9, 0x54B85CD9, 0x54B95478,
+0x54B854D9, 0x549854B9, 0x5CB95CB9, 0x54995CBA, 0x54B954BA, 0x54995499, 0x64345C99, 0xEF14946F,
+0x6C267C48, 0x6C057C47, 0x74467426, 0x6A2273C6, 0xB8E3B184, 0x9186B0E2, 0x32B23949, 0x02121AB5,
+0x3355014F, 0x54B9651B, 0x547954BA, 0x5C9864B9, 0x54B95CB9, 0x4CB954DA, 0x54B954DA, 0x54B95CB9,
+0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9,
+0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9,
+0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9,
+0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x4C9954B9,
+0x54B954BA, 0x549954B9, 0x549954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C985499,
+0x4C995499, 0x4C795499, 0x4C795499, 0x4C785479, 0x4C785479, 0x4C584C79, 0x4C584C79, 0x4C584C59,
+0x4C585479, 0x4C584C59, 0x4C584C59, 0x4C384C58, 0x4C384C58, 0x4C384C38, 0x4C384C38, 0x44184C38,
+0x5C585437, 0x64995C78, 0x5C586478, 0x54375417, 0x4C174BF7, 0x4C184417, 0x44174417, 0x4C374417,
+0x4C384417, 0x4C384437, 0x4C384437, 0x4C584C37, 0x4C584C37, 0x4C584C58, 0x4C584438, 0x4C584C58,
+0x4C584C58, 0x54584C58, 0x54994C78, 0x54785478, 0x54784C57, 0x54784C58, 0x54794C78, 0x54795478,
+0x54784C78, 0x54784C58, 0x54784C78, 0x54784C78, 0x54984C78, 0x54994C78, 0x54984C78, 0x54994C78,
+0x54984C98, 0x54994C98, 0x54984C98, 0x54994C98, 0x54994C98, 0x54994C98, 0x54994C98, 0x54B94C98,
+0x4C994C98, 0x54994C98, 0x4C994C98, 0x54994C98, 0x54994C98, 0x54994C98, 0x54994C98, 0x54994C98,
+0x54994C98, 0x54994C98, 0x54994C98, 0x54994C98, 0x54994C98, 0x54B94C98, 0x54B94C98, 0x54B94C98,
+0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98,
+0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98,
+0x54B94C98, 0x54D954B8, 0x54984CB8, 0x961E5457, 0x5CB95C98, 0x5CB85498, 0x54B854B8, 0x54D954B9,
+0x54B84CB8, 0x5CB954B8, 0x54B95498, 0x54B95499, 0x54D954B9, 0x54B95499, 0x6CB654B9, 0xD6938C6F,
+0x6BC58468, 0x6C267446, 0x74266425, 0x59207BE8, 0xA8C3A143, 0x59079145, 0x12933A90, 0x018E0231,
+0x651A4C58, 0x4CB84C98, 0x54D954D9, 0x54D95498, 0x54D94CB8, 0x54B954B8, 0x5CB85498, 0x54D854B8,
+0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B9, 0x54B954B9,
+0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8,
+0x54B954B8, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9,
+0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B9, 0x54B954B8, 0x54B954B9,
+0x54B94C98, 0x54B95498, 0x54B94C98, 0x54B95498, 0x54994C98, 0x54994C98, 0x4C994C98, 0x54994C98,
+0x4C994C98, 0x4C994C78, 0x4C994C78, 0x4C794C78, 0x4C794C78, 0x4C794C58, 0x4C784C58, 0x4C784C58,
+0x4C584C58, 0x4C584C58, 0x4C584438, 0x4C584C58, 0x4C584438, 0x4C384C38, 0x4C384437, 0x4C384417,
+0x5C775C58, 0x6CB96C99, 0x64786CB9, 0x54375C58, 0x4C175438, 0x44174C38, 0x44174C38, 0x4C374C38,
+0x4C374C38, 0x4C384C58, 0x4C384C58, 0x4C584C58, 0x4C584C58, 0x4C584C79, 0x4C584C58, 0x4C584C79,
+0x4C585479, 0x4C585478, 0x54995499, 0x54785C99, 0x54785478, 0x54785478, 0x54785479, 0x54785499,
+0x54785499, 0x54785499, 0x54785499, 0x4C785499, 0x4C785498, 0x54985499, 0x4C985499, 0x54985499,
+0x549854B9, 0x549854B9, 0x549854B9, 0x549854B9, 0x4C9854B9, 0x4C9854B9, 0x4C9854B9, 0x4C9854B9,
+0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x4C9954B9, 0x549954B9, 0x4C9954B9, 0x4C9954B9,
+0x4C9854B9, 0x549954B9, 0x4C9854B9, 0x549954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9,
+0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9,
+0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954D9, 0x54B954B9, 0x54B954D9,
+0x54B954B9, 0x54B854B8, 0x54785CFA, 0x5C778DFD, 0x54B95CB9, 0x54B85CB9, 0x54D954D9, 0x54B954B9,
+0x54B854D9, 0x54B95CD9, 0x54B95CD9, 0x54D954D9, 0x549854B9, 0x54B95CDA, 0x649654BA, 0xCE748450,
+0x63A49D0C, 0x74467447, 0x74076C26, 0x404083C9, 0x90C4A165, 0x41AB7148, 0x021132B3, 0x5CFA0A10,
+0x54D964FA, 0x54D954F9, 0x4CB854D9, 0x54B85CF9, 0x54D954D9, 0x54B854D9, 0x5CB85CB9, 0x54D85CD9,
+0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B95CD9, 0x54B95CDA,
+0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9,
+0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9,
+0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B954B9,
+0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x549954B9, 0x549954B9, 0x4C9954B9, 0x4C9954B9,
+0x4C9954B9, 0x4C995499, 0x4C995499, 0x4C795499, 0x4C785499, 0x4C785479, 0x4C784C79, 0x4C785479,
+0x4C584C79, 0x4C584C79, 0x4C584C59, 0x4C584C79, 0x4C584C59, 0x4C384C58, 0x4C384C38, 0x4C384C38,
+0x5C375416, 0x64785C37, 0x64996498, 0x5C385C58, 0x4C384C17, 0x4C384417, 0x4C384417, 0x4C384C17,
+0x4C384C38, 0x4C384C37, 0x4C584C38, 0x4C584C38, 0x4C584C58, 0x4C584C58, 0x4C794C58, 0x4C794C58,
+0x54784C58, 0x54784C58, 0x5CB95478, 0x5CB954B9, 0x54995478, 0x54784C78, 0x5C995478, 0x54995479,
+0x5CB95498, 0x5C995499, 0x54995498, 0x5CB95498, 0x54B95498, 0x54994C98, 0x54994C98, 0x54B94C98,
+0x54B94C98, 0x54994C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x4CB94C98, 0x54B94C98, 0x4CB94C98,
+0x54B94CB8, 0x54B94C98, 0x54B94CB8, 0x54B94C98, 0x54B94CB8, 0x54B94C98, 0x54B94CB9, 0x54B94C98,
+0x54B954B9, 0x54B94C98, 0x54B94CB9, 0x54B94C98, 0x54B94CB9, 0x54B94CB9, 0x54B954B9, 0x54B94CB9,
+0x54B94CB9, 0x54B94CB9, 0x54B954B9, 0x54B94CB9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B94CB9,
+0x54D954B9, 0x54B954B9, 0x54D954B9, 0x54B954B9, 0x54D954B9, 0x54D954B9, 0x54D954B9, 0x54D954B9,
+0x54B954B9, 0x549854B9, 0x85FE5477, 0x5CF95497, 0x5CD954D8, 0x5CD954B9, 0x54B95498, 0x54B954D9,
+0x5CB954B9, 0x54D954B8, 0x54DA54B9, 0x54D94CB9, 0x5CB85CD9, 0x54D954B8, 0x64D854D9, 0xBE147431,
+0x63E5A5AE, 0x74266C06, 0x84287426, 0x50C15A24, 0x898880E3, 0x3A913109, 0x3355014D, 0x5CD9653B,
+0x54B954B8, 0x54DA54D9, 0x54B854D9, 0x54D954F8, 0x54DA54D9, 0x54D954D9, 0x5CD954D9, 0x54D954B9,
+0x5CD954B9, 0x5CD954B9, 0x5CD954D9, 0x5CD954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x5CD954B9,
+0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9,
+0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9,
+0x54D954D9, 0x54D954B9, 0x54D954D9, 0x54D954B9, 0x54D954B9, 0x54B954B8, 0x54D954B9, 0x54B954B9,
+0x5CB954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B954B9, 0x54B94C98, 0x54B94CB9, 0x54B94C99,
+0x54B94C99, 0x54994C98, 0x54994C99, 0x4C994C78, 0x54994C78, 0x4C794C78, 0x4C794C78, 0x4C794C58,
+0x4C794C58, 0x4C784C58, 0x4C794C58, 0x4C584C58, 0x4C594C58, 0x4C584C38, 0x4C584C38, 0x4C384C38,
+0x54165417, 0x54175417, 0x64786478, 0x54375C78, 0x4C375438, 0x4C384C38, 0x4C384C38, 0x4C374C38,
+0x4C585458, 0x4C384C58, 0x4C584C58, 0x4C584C58, 0x4C584C79, 0x4C584C79, 0x4C585479, 0x4C584C79,
+0x54785479, 0x4C785479, 0x54995499, 0x5CD95CBA, 0x54985C99, 0x4C785479, 0x54995C99, 0x54995CB9,
+0x5CB95CB9, 0x5CB95CD9, 0x54B95CB9, 0x5CD95CDA, 0x54B95CDA, 0x54B95CB9, 0x549854B9, 0x4C9954B9,
+0x54B954B9, 0x549954B9, 0x549954B9, 0x4C9954B9, 0x54B954B9, 0x4CB954B9, 0x4CB954B9, 0x4CB954B9,
+0x4CB954B9, 0x4CB954B9, 0x54B954B9, 0x4CB954B9, 0x54B954D9, 0x54B954B9, 0x54B954D9, 0x54B954B9,
+0x54B95CD9, 0x54B954B9, 0x54B954D9, 0x54B954B9, 0x54B954D9, 0x54B954B9, 0x54B954DA, 0x54B954D9,
+0x54B954D9, 0x54B954D9, 0x54B954DA, 0x54B954B9, 0x54B954DA, 0x54B954DA, 0x54B954DA, 0x54B954D9,
+0x54D95CDA, 0x54B95CDA, 0x54D95CDA, 0x54B954DA, 0x54D954DA, 0x54B954DA, 0x54D954DA, 0x54D954DA,
+0x5CD95CD9, 0x54785CDA, 0x547785DD, 0x54B85CD9, 0x54D95CD9, 0x54B95CDA, 0x54D95CFA, 0x5CD954D9,
+0x5CB95CDA, 0x54D95CD9, 0x54DA5CDA, 0x54D954F9, 0x5CD85CD9, 0x54D95CD9, 0x64B85CDA, 0x8CF17CB5,
+0x5B63BE72, 0x74267427, 0x8C497C27, 0x48C24100, 0x50E77105, 0x018E4291, 0x64FA5438, 0x5CD95CD9,
+0x5CD95CD9, 0x54D95CDA, 0x5CD95CB9, 0x54B85CF9, 0x54DA5CDA, 0x54D954DA, 0x54D95CFA, 0x54B95CDA,
+0x54D95CDA, 0x54D95CD9, 0x54D95CFA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CFA, 0x54D95CD9,
+0x54D95CDA, 0x54D95CD9, 0x54D95CFA, 0x54D95CDA, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9,
+0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9,
+0x54D95CFA, 0x54D95CD9, 0x54D95CFA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54B95CDA,
+0x54B95CDA, 0x54B95CB9, 0x54B95CDA, 0x54B954B9, 0x54B95CD9, 0x54B954B9, 0x54B954BA, 0x54B954B9,
+0x54B954B9, 0x4C9954B9, 0x4C9954B9, 0x4C995499, 0x549954B9, 0x4C995499, 0x4C795499, 0x4C785479,
+0x4C785479, 0x4C784C79, 0x4C784C79, 0x4C584C59, 0x4C584C79, 0x4C385459, 0x4C585459, 0x4C384C58,
+0x4C174BF6, 0x54374C17, 0x54384C17, 0x54384C37, 0x4C384C17, 0x4C384C37, 0x4C384C37, 0x4C384C37,
+0x4C584C37, 0x4C584C58, 0x4C584C58, 0x4C584C58, 0x54784C58, 0x54794C58, 0x54784C58, 0x54794C58,
+0x54784C58, 0x54785478, 0x54984C78, 0x5CB95499, 0x54984C78, 0x54994C78, 0x54995498, 0x54B95498,
+0x5CB95498, 0x64FA5CD9, 0x5CB95CD9, 0x5CD954B9, 0x5CD954B9, 0x54B954B9, 0x54994C98, 0x54B94C98,
+0x54B84C98, 0x54B94CB8, 0x54B94CB8, 0x54B95498, 0x54B94C98, 0x54B95498, 0x54B94C98, 0x54B95498,
+0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8,
+0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54D954B8, 0x54B954B8, 0x54B954B8,
+0x54D954B8, 0x54D954B9, 0x54D954B8, 0x54D954B9, 0x54D954B8, 0x54D954B9, 0x54D954B8, 0x54D954B9,
+0x5CD954B9, 0x5CD954B9, 0x54D954B9, 0x54D954B9, 0x54D94CB9, 0x54D954B9, 0x54D954B9, 0x5CD954D9,
+0x5CD954B8, 0x7DDD5498, 0x5CD95498, 0x5CB954B8, 0x5CD954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9,
+0x5CD954B9, 0x5CD954B9, 0x54D954B9, 0x54D954D9, 0x54D954D8, 0x5CFA54B8, 0x64B854B9, 0x63F06C97,
+0x6363C6D4, 0x74276BE5, 0x73877427, 0x50E440A0, 0x41EC38E5, 0x5C7A094C, 0x5CDA64DB, 0x54F854D8,
+0x54D954B8, 0x54D954B9, 0x54D954B9, 0x54D954D9, 0x54D954B9, 0x54D954D9, 0x5CD954D9, 0x5CD954D9,
+0x5CD954B8, 0x54FA54D9, 0x54D954D9, 0x54D954D9, 0x54D954D9, 0x54D954B9, 0x54F954D9, 0x5CD954D9,
+0x5CF954B8, 0x54D954B8, 0x54D954D9, 0x54FA54D9, 0x54D954B8, 0x5CDA54D9, 0x54D94CB9, 0x5CD95CD9,
+0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954B9, 0x5CD954D9, 0x54D954D9, 0x5CD954D9,
+0x5CD954D9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9, 0x5CD954B9, 0x54D954B9, 0x54D954B9,
+0x54D954B8, 0x54D954B9, 0x54D954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B9, 0x54B95499,
+0x54B94C98, 0x54B94C98, 0x54B94C98, 0x54B94C98, 0x4C994C98, 0x54994C98, 0x4C994C98, 0x4C794C78,
+0x4C794C78, 0x54794C58, 0x4C784C58, 0x4C584C58, 0x4C784C58, 0x4C584C58, 0x4C584C58, 0x4C584C58,
+0x4C174C17, 0x4C174C38, 0x4C375438, 0x4C375458, 0x4C375438, 0x4C385458, 0x4C375458, 0x4C585458,
+0x4C584C58, 0x4C584C58, 0x4C584C58, 0x4C585479, 0x4C585479, 0x4C585479, 0x4C785479, 0x54785479,
+0x54785478, 0x54785479, 0x54785499, 0x54B95CB9, 0x549854B9, 0x54985499, 0x54985499, 0x54B954B9,
+0x5CB85CB9, 0x5CD964D9, 0x5CB95CD9, 0x5CB95CB9, 0x54B95CD9, 0x54B95CB9, 0x54B954B9, 0x54B954B9,
+0x54B854B9, 0x54B854B9, 0x54B854B9, 0x54B954B9, 0x54B854B9, 0x54B954B9, 0x54B954B9, 0x54B95CD9,
+0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9,
+0x54B95CB9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9,
+0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54D95CD9, 0x54D95CD9, 0x54D95CD9,
+0x54B95CD9, 0x54D95CD9, 0x54D95CDA, 0x54D95CDA, 0x54B95CDA, 0x54D95CFA, 0x54D95CD9, 0x5CB85CD9,
+0x54975CD9, 0x64F97DDD, 0x54B95CB9, 0x5CD95CDA, 0x54D95CDA, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA,
+0x54D95CD9, 0x54D95CDA, 0x54D95CDA, 0x54D95CFA, 0x54D954F9, 0x5CD95CD9, 0x5CB85CB9, 0x5C3364B9,
+0x6364C6B5, 0x74067C26, 0x49E28449, 0x410548E2, 0x19CC18E7, 0x64BA6C99, 0x5CDA5C9A, 0x54D85CF9,
+0x54D95CF9, 0x54D95CFA, 0x54D95CFA, 0x54D95CFA, 0x54D95CF9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA,
+0x54D95CD9, 0x54D95CFA, 0x54D95CFA, 0x54D95CFA, 0x54D95CF9, 0x54D95CDA, 0x54D95CF9, 0x54D95CFA,
+0x54B8651A, 0x5CD9651A, 0x54D95CDA, 0x54B95CFA, 0x5CF95CF9, 0x54B95CD9, 0x54FA54FA, 0x5CB95CD9,
+0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA,
+0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CDA, 0x54D95CD9, 0x54D95CD9, 0x54D95CD9, 0x54D95CD9,
+0x54D95CD9, 0x54D95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CB9, 0x54B95CD9, 0x54B95CD9, 0x54B95CB9,
+0x54B854B9, 0x54B854B9, 0x54B954B9, 0x4CB954B9, 0x4C9954B9, 0x4C995499, 0x4C995499, 0x4C795499,
+0x4C785499, 0x4C785479, 0x4C785479, 0x4C585479, 0x4C585479, 0x4C585479, 0x4C584C79, 0x4C584C79,
+0x4C174C17, 0x4C174C17, 0x54384C17, 0x4C384C17, 0x54384C37, 0x4C384C37, 0x4C584C38, 0x4C584C37,
+0x4C584C58, 0x4C584C58, 0x54794C58, 0x54794C58, 0x54794C58, 0x54794C58, 0x54794C78, 0x54794C78,
+0x54994C78, 0x54784C78, 0x54995478, 0x5CB95498, 0x54B954B9, 0x54994C98, 0x54995498, 0x54B95498,
+0x5CB95498, 0x5CB95CB9, 0x5CB95CB9, 0x5CB954B8, 0x5CB954B9, 0x54B95498, 0x5CB954B8, 0x54B954B9,
+0x54B954B8, 0x54B954B8, 0x5CB954B9, 0x54B95498, 0x5CD954B9, 0x5CB954B9, 0x5CD954B9, 0x5CB954B9,
+0x5CB954B9, 0x54B954B8, 0x5CB954B9, 0x54B954B8, 0x5CD954B9, 0x5CB954B9, 0x5CD954B9, 0x5CB954B9,
+0x5CD954B9, 0x5CB954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CB954B9, 0x5CD954D9, 0x5CD954B9,
+0x5CD954D9, 0x5CD954B9, 0x5CD954D9, 0x5CD954B9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9,
+0x5CD954D9, 0x5CD954B9, 0x5CF954D9, 0x54D954D9, 0x5CFA54D9, 0x54B954B8, 0x5CFA54D9, 0x5CD954D9,
+0x7DFD5CD8, 0x54B85CD9, 0x5CFA54D9, 0x5CD954B9, 0x5CDA54D9, 0x54D954D9, 0x5CFA54D9, 0x5CF954D9,
+0x5CFA54D9, 0x5CD954D9, 0x5CFA54D9, 0x54F954D9, 0x5CFA54F9, 0x5CD954D9, 0x5CD954D8, 0x6CB55CB8,
+0x74079D70, 0x7C067425, 0x30C08BE8, 0x20C54103, 0x753A0928, 0x5CB964B9, 0x54FA5CFB, 0x54F954D8,
+0x5CFA54F9, 0x54F954D9, 0x5CFA54D9, 0x5CFA54D9, 0x5CFA54D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9,
+0x5CFA54F9, 0x5CD954D9, 0x54FA54D9, 0x54F954D9, 0x5CF954F9, 0x5CD954D9, 0x5CFA5CD9, 0x54F954D9,
+0x5D1A54D9, 0x54B854B8, 0x5CFA5CF9, 0x5CD954B8, 0x5CD854B7, 0x54F95CD9, 0x5CFA54F9, 0x5CF954B9,
+0x5CFA54D9, 0x5CF954D9, 0x5CFA54D9, 0x5CF954D9, 0x5CFA54D9, 0x5CF954D9, 0x5CFA54D9, 0x5CF954D9,
+0x5CFA54D9, 0x5CF954D9, 0x5CFA54D9, 0x5CF954D9, 0x5CFA54D9, 0x5CF954D9, 0x5CFA54D9, 0x54D954D9,
+0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954B9, 0x5CD954D9, 0x5CD954B9, 0x5CD954B9, 0x54B954B9,
+0x54D954B9, 0x54B954B8, 0x54B954B9, 0x54B94C98, 0x54B94C98, 0x54994C98, 0x54B94C99, 0x54994C78,
+0x54994C79, 0x54994C78, 0x54994C78, 0x4C794C58, 0x4C794C58, 0x4C794C58, 0x4C794C58, 0x4C584C58,
+0x4C175438, 0x4C174C38, 0x4C385438, 0x4C375438, 0x4C385438, 0x4C385458, 0x4C585458, 0x4C585458,
+0x4C585479, 0x4C585479, 0x4C785479, 0x4C785479, 0x54795479, 0x54795479, 0x54785499, 0x54795499,
+0x54985499, 0x54985499, 0x54995C99, 0x54995C99, 0x549954B9, 0x549954B9, 0x54995CB9, 0x549854B9,
+0x5CB95CB9, 0x5CB95CB9, 0x5CB95CD9, 0x54B85CB9, 0x5CB95CD9, 0x54B95CB9, 0x54B95CD9, 0x54B95CDA,
+0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CB9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9,
+0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x5CD95CDA, 0x54B95CD9, 0x5CD95CDA, 0x54B95CD9,
+0x5CD95CDA, 0x54B95CD9, 0x5CD95CDA, 0x54B95CD9, 0x5CD95CDA, 0x54B95CD9, 0x54D95CDA, 0x54D95CDA,
+0x54D95CDA, 0x54D95CD9, 0x5CD95CFA, 0x54D95CDA, 0x5CD95CFA, 0x54D95CDA, 0x5CD95CFA, 0x54D95CDA,
+0x5CD95CDA, 0x54D95CDA, 0x54D95CFA, 0x54D95CFA, 0x54D95D1A, 0x651A5CFA, 0x54B864FA, 0x54B85CF9,
+0x5CD87DDD, 0x5CF95CD9, 0x54D95CFA, 0x54D95CFA, 0x54D95CFA, 0x54D95CFA, 0x54F95CFA, 0x54D95CFA,
+0x5CF95CFA, 0x5CD95CFA, 0x54F95CFA, 0x54D95CFA, 0x54F95D1A, 0x54F95D1A, 0x5CF95CF9, 0x6CF65CD9,
+0x9D2C742D, 0x84276BE6, 0x38E26A85, 0x10E628C4, 0x5CD97D5A, 0x5CD964FA, 0x54FA54FA, 0x54F95D19,
+0x54F95D1A, 0x54F95CFA, 0x54F95CFA, 0x54F95CFA, 0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA, 0x54F95CFA,
+0x54F95D1A, 0x5CD95CFA, 0x54FA5CFA, 0x54F95CFA, 0x5CF95CFA, 0x5CF95CF9, 0x5CF964FA, 0x54F95CFA,
+0x5CFA54FA, 0x5CF9651A, 0x5CD8651A, 0x7DBB5CB8, 0x64F9967E, 0x5CF954B9, 0x5CF95D1A, 0x54FA54FA,
+0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA,
+0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA, 0x54F95CFA, 0x54F95CFA, 0x54D95CFA,
+0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x54D95CDA, 0x54D95CFA, 0x54D95CD9, 0x54D95CDA, 0x54B95CDA,
+0x54D95CD9, 0x54B954D9, 0x54B954DA, 0x54B954B9, 0x54B954B9, 0x4C9954B9, 0x54B954B9, 0x4C995499,
+0x54995499, 0x4C795499, 0x4C795499, 0x4C795479, 0x4C785479, 0x4C585479, 0x4C785479, 0x4C584C79,
+0x4C384C17, 0x54384C37, 0x4C384C17, 0x54384C37, 0x4C384C37, 0x4C584C37, 0x4C584C37, 0x54584C58,
+0x4C584C58, 0x54794C58, 0x54784C58, 0x54794C58, 0x54784C58, 0x54794C78, 0x54794C78, 0x54994C78,
+0x54994C78, 0x54995498, 0x54994C98, 0x54995498, 0x54994C98, 0x54B95498, 0x54B95498, 0x54995498,
+0x5CB95498, 0x5CB95498, 0x5CB954B8, 0x5CB954B8, 0x5CB954B8, 0x5CB954B9, 0x54B954B8, 0x5CD954B9,
+0x5CB954B8, 0x5CD954B9, 0x5CB954B8, 0x5CB954B9, 0x5CD954B9, 0x5CB954B9, 0x5CB954B8, 0x5CD954B9,
+0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9,
+0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9, 0x5CD954B9,
+0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9,
+0x5CD954D9, 0x5CD954D9, 0x54F954D9, 0x5CF954D9, 0x5CF954D9, 0x54B954B8, 0x5CF954B8, 0x7DFD54B8,
+0x5CF95CF9, 0x5CFA5CF9, 0x5D1A54B8, 0x5CFA54D9, 0x54F954D9, 0x5CFA54D9, 0x54F954F9, 0x5CF954F9,
+0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CFA54D9, 0x54F954F9, 0x54F954F9, 0x5CF954F9, 0x6D1754D9,
+0x9D4F534B, 0x84296BC7, 0x39253901, 0x85381106, 0x5CF95CB7, 0x5D1A54D9, 0x54F954F9, 0x551954F9,
+0x5CFA54F9, 0x5CFA54F9, 0x5CF954F9, 0x5D1A54F9, 0x5CF954F9, 0x5CFA54F9, 0x5CF954F9, 0x5CFA54F9,
+0x54FA54F9, 0x5CF954F9, 0x5CFA54F9, 0x5CFA54F9, 0x5CF954F8, 0x5CF95CD9, 0x5CF954F9, 0x5CF954F9,
+0x54F954F9, 0x5CFA4CB9, 0x5CB75CD8, 0xD7FF8599, 0x54D86518, 0x5CFA5D1A, 0x5D1A54B8, 0x54FA551A,
+0x54F954F9, 0x5CF954F9, 0x54F954F9, 0x5CF954F9, 0x5CF954F9, 0x5CFA54F9, 0x5CF954F9, 0x5CFA54F9,
+0x5CF954D9, 0x5CFA5CD9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9,
+0x5CF954D9, 0x5CF954D9, 0x54F954D9, 0x5CF954D9, 0x5CD954D9, 0x5CD954D9, 0x54D954B9, 0x5CD954B9,
+0x54D954B8, 0x54D954B9, 0x54B954B9, 0x54B954B9, 0x54B94CB8, 0x54B95498, 0x54B94C98, 0x54995498,
+0x54994C98, 0x54994C98, 0x54994C78, 0x54994C78, 0x4C794C58, 0x54794C58, 0x54784C58, 0x54794C58,
+0x4C375438, 0x4C385458, 0x4C375438, 0x54385458, 0x4C385458, 0x4C585458, 0x4C585458, 0x4C585478,
+0x4C585479, 0x4C585479, 0x4C785479, 0x54785479, 0x54785499, 0x54795499, 0x54785499, 0x54995499,
+0x549854B9, 0x549954B9, 0x549954B9, 0x549954B9, 0x54B954B9, 0x549854B9, 0x54B854B9, 0x54B95CB9,
+0x5CB95CD9, 0x5CB95CB9, 0x5CB95CD9, 0x5CB95CD9, 0x5CB95CB9, 0x54B95CDA, 0x54B95CD9, 0x54B95CD9,
+0x54B95CB9, 0x5CB95CD9, 0x5CB95CD9, 0x5CD95CDA, 0x5CD95CD9, 0x5CB95CDA, 0x5CB95CD9, 0x5CD95CDA,
+0x54D95CD9, 0x5CD95CDA, 0x54D95CD9, 0x5CD95CDA, 0x54D95CD9, 0x5CD95CDA, 0x54D95CD9, 0x5CD95CDA,
+0x54B95CD9, 0x5CD95CD9, 0x54D95CD9, 0x5CD95CDA, 0x54D95CD9, 0x5CD95CDA, 0x54D95CD9, 0x5CD95CDA,
+0x54D95CFA, 0x5CD95CFA, 0x54D95CFA, 0x5CD95CFA, 0x54D95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA,
+0x5CD95CFA, 0x5CD95CFA, 0x54F95CFA, 0x54F95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CF9, 0x5CF975BC,
+0x54D95CF9, 0x5CF95CFA, 0x54D95D1A, 0x5D1A5CFA, 0x54F95CFA, 0x54F95CFA, 0x54F95D1A, 0x54F95D1A,
+0x54F95D1A, 0x5CF95CFA, 0x54F95CFA, 0x54F95CFA, 0x54F95D1A, 0x54F95D1A, 0x55195D1A, 0x64F75CF9,
+0x84AF6C30, 0x63077C0A, 0x108430E3, 0x64D87CF7, 0x5CFA64FA, 0x4CD95D1A, 0x5D195D1A, 0x54F954F9,
+0x54F95D1A, 0x5CF95D1A, 0x54F95D1A, 0x5CF95D1A, 0x54F95D1A, 0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA,
+0x54F95D1A, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95CFA, 0x5CF964F9, 0x55195D1A, 0x5CF95D1A,
+0x54F95D1A, 0x5CF9653B, 0x8DDA6497, 0x8DB9E7FF, 0x54D964F8, 0x5CFA5D1A, 0x5CF9651A, 0x551A54FA,
+0x54F95CFA, 0x54F95D1A, 0x54F95D1A, 0x54F95D1A, 0x54F95D1A, 0x5CF95D1A, 0x54F95CFA, 0x5CF95CFA,
+0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CD95CFA, 0x5CF95CFA,
+0x54F95CFA, 0x54F95CFA, 0x54F95CFA, 0x54D95CFA, 0x54D95CFA, 0x54D95CFA, 0x54D95CD9, 0x54D95CDA,
+0x54D95CD9, 0x54D95CD9, 0x54B95CD9, 0x54B954DA, 0x54B954D9, 0x54B954B9, 0x54B954B9, 0x549954B9,
+0x549954B9, 0x54995499, 0x4C985499, 0x54995499, 0x4C785479, 0x4C785479, 0x4C785479, 0x4C585479,
+0x54384C37, 0x54384C37, 0x54584C37, 0x54584C37, 0x54584C38, 0x54584C38, 0x54784C58, 0x54784C58,
+0x54794C78, 0x54784C58, 0x54794C78, 0x54994C78, 0x54995478, 0x54994C98, 0x54995498, 0x54B95498,
+0x54B954B9, 0x54B95498, 0x54B954B8, 0x54B95498, 0x5CB954B8, 0x54B954B8, 0x5CB954B8, 0x54B954B9,
+0x5CD954B9, 0x5CD954B9, 0x5CD95CB9, 0x5CD954B9, 0x5CD95CB9, 0x5CD95CB9, 0x5CD95CD9, 0x5CD954B9,
+0x5CD954B9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD954B9, 0x5CD954D9, 0x5CD954B9,
+0x5CD954D9, 0x5CD954B9, 0x5CD954D9, 0x5CD954B9, 0x5CDA5CD9, 0x5CD954D9, 0x5CD95CD9, 0x5CD954D9,
+0x5CD954D9, 0x5CD954B9, 0x5CFA54D9, 0x5CD954D9, 0x5CFA54D9, 0x5CD954D9, 0x5CFA54D9, 0x5CD954D9,
+0x5CFA54D9, 0x5CFA54D9, 0x5CFA54F9, 0x5CFA54D9, 0x5CFA54F9, 0x5CFA54D9, 0x5CFA54F9, 0x5CFA54D9,
+0x5CFA5CF9, 0x5CFA5CD9, 0x5CFA5CF9, 0x5CFA5CD9, 0x5D1A54D9, 0x5CFA54D8, 0x7DDD54B8, 0x5CF96519,
+0x5D1A5CF9, 0x5CF954D9, 0x5D1A54F9, 0x54F95D1A, 0x5CFA54F9, 0x5CFA54F9, 0x5D1A5CF9, 0x5D1954F9,
+0x5D1A54F9, 0x5CFA54F9, 0x5CFA5CF9, 0x5CFA5CD9, 0x5D1A54F9, 0x5D1A5519, 0x5D1A54F9, 0x64F854F9,
+0x4ACB7D36, 0x290241C4, 0x84F718E5, 0x64F964D8, 0x5CFA5CF9, 0x54F954F9, 0x5D1A5CF9, 0x5D1A54F9,
+0x5D1A54F9, 0x5CFA54F9, 0x5D1A5CF9, 0x5CF954F9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9,
+0x5D1A5CF9, 0x5D1A5D19, 0x5D195CF9, 0x5D195CF9, 0x651A5CF9, 0x5D1A5CF9, 0x5D1A5519, 0x5CFA5CF9,
+0x5D1A5CF9, 0x64B75CD8, 0xE7FF95D9, 0x5CB7963B, 0x651A5CF9, 0x5CF95CF9, 0x5D1A5D19, 0x5CFA54F9,
+0x5D1A5CF9, 0x5CF954F9, 0x5D1A5CF9, 0x5CF954F9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9,
+0x5D1A5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CD9,
+0x5CFA5CF9, 0x5CFA54F9, 0x5CFA54F9, 0x5CFA54D9, 0x5CFA54F9, 0x5CF954D9, 0x5CFA54D9, 0x5CD954D9,
+0x5CD954D9, 0x5CD954B9, 0x5CD954D9, 0x5CD954B9, 0x5CD954B9, 0x54B954B8, 0x54B954B8, 0x54B95498,
+0x54B954B8, 0x54B94C98, 0x54B95498, 0x54994C98, 0x54994C98, 0x54794C78, 0x54794C78, 0x54794C58,
+0x54385458, 0x54385458, 0x4C585458, 0x4C585458, 0x54585479, 0x4C585479, 0x54785479, 0x4C785479,
+0x54785499, 0x54785479, 0x54795499, 0x54995499, 0x54995CB9, 0x549954B9, 0x549954B9, 0x549954B9,
+0x54B95CD9, 0x54B954B9, 0x54B95CD9, 0x54B95CB9, 0x54B95CB9, 0x54B95CD9, 0x5CD95CD9, 0x54B95CD9,
+0x5CD95CDA, 0x5CB95CD9, 0x5CD95CDA, 0x5CD95CD9, 0x5CD95CDA, 0x5CD95CD9, 0x5CD964FA, 0x5CD95CDA,
+0x5CD964FA, 0x5CD964FA, 0x5CD964FA, 0x5CD95CDA, 0x5CD95CFA, 0x5CD95CDA, 0x5CD95CDA, 0x5CD95CDA,
+0x5CD95CFA, 0x5CD95CDA, 0x5CD95CFA, 0x5CD95CDA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CDA,
+0x5CD95CDA, 0x5CD95CDA, 0x5CD95CFA, 0x5CD95CFA, 0x5CF95CFA, 0x5CD95CFA, 0x5CF95CFA, 0x5CD95CFA,
+0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95D1A, 0x5CF95CFA, 0x5CF95D1A, 0x5CF95CFA,
+0x5CF9651A, 0x5CF95CFA, 0x5CF9651A, 0x5CF95CFA, 0x5CF95CF9, 0x54B864FA, 0x5CF97DFD, 0x5CF95CF9,
+0x5CF95CFA, 0x5D19651A, 0x5CF95CFA, 0x5CFA5CFA, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95D1A,
+0x5D195D1A, 0x5CF95D1A, 0x5CF9651A, 0x5CF95CFA, 0x5CF95D1A, 0x5D1A5D1A, 0x5CF95D1A, 0x5CF95D1A,
+0x6C536CF7, 0x102128E4, 0x7CF98CB6, 0x5CFA64D9, 0x5CFA651A, 0x5D195D1A, 0x5CF9651A, 0x5CF9653B,
+0x5D1A651A, 0x5CF9651A, 0x5D1A651A, 0x5D19651A, 0x5D19651A, 0x5D19651A, 0x5D1A651A, 0x5D19651A,
+0x5D19651A, 0x5D1A5D3A, 0x64F9651A, 0x5CF96519, 0x5D1A651A, 0x5D1A651A, 0x5D19651A, 0x5CFA651A,
+0x64F9651A, 0x9E1B64B7, 0xA65BE7FF, 0x64F964B7, 0x5CFA651A, 0x6519651A, 0x5CF9651A, 0x5D19653A,
+0x5D19651A, 0x5D19651A, 0x5D19651A, 0x5D19651A, 0x5D19651A, 0x5D19651A, 0x5CF9651A, 0x5D19651A,
+0x5CFA651A, 0x5CF9651A, 0x5CFA651A, 0x5CF9651A, 0x5CFA651A, 0x5CF9651A, 0x5CF9651A, 0x5CF95CFA,
+0x5CF9651A, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95CFA, 0x5CF95D1A, 0x54F95CFA, 0x54F95CFA, 0x54D95CFA,
+0x5CD95CFA, 0x5CD95CDA, 0x5CD95CFA, 0x54D95CDA, 0x54D95CDA, 0x54B95CD9, 0x54B95CD9, 0x54B95CB9,
+0x54B95CD9, 0x54B954B9, 0x54B954B9, 0x549954B9, 0x549954B9, 0x54795499, 0x54795499, 0x54795479,
+0x54384C37, 0x54584C37, 0x54584C37, 0x54584C58, 0x54584C58, 0x54784C58, 0x54784C58, 0x54794C78,
+0x54784C58, 0x54995478, 0x54984C78, 0x54995478, 0x54995478, 0x54B95498, 0x54994C98, 0x54B95498,
+0x54B954B8, 0x54B954B8, 0x54B954B8, 0x5CB954B8, 0x5CD954B8, 0x5CD954B9, 0x5CD954D9, 0x5CD95CB9,
+0x5CD954B9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CB9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9,
+0x5CF954D9, 0x5CD95CD9, 0x5CD954D9, 0x5CD954D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9,
+0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CF954D9, 0x5CD954D9, 0x5CD954D9, 0x5CF954D9, 0x5CD954D9,
+0x5CD954D9, 0x5CD954D9, 0x5CF954D9, 0x5CFA54F9, 0x5CFA54F9, 0x5CFA54F9, 0x5CFA54F9, 0x5CFA54F9,
+0x5CFA54D9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CD9, 0x5CFA54D9, 0x5CFA5CF9,
+0x5CFA54D9, 0x5D1A54D9, 0x5CF95CF9, 0x651A5CD9, 0x65195CF9, 0x7DFD5CD8, 0x5CF954D8, 0x65195CF9,
+0x5CFA5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D195CF9, 0x5D1A5CF9,
+0x5D195519, 0x5D1A54F9, 0x651A5CF9, 0x5CFA5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x651A5D1A,
+0x85585CF8, 0x20A541EA, 0x7D195B31, 0x64FA64D9, 0x5D1A5CF9, 0x651A5CF9, 0x64FA5CF9, 0x64FA5CF9,
+0x5D1A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x651A5CF9, 0x651A5D19, 0x651A6519, 0x65195CF9, 0x651A5CF9,
+0x65195CF9, 0x651A5CFA, 0x65195CF9, 0x651A64F9, 0x5D3A5D1A, 0x653B5D1A, 0x64F964F9, 0x653A5D19,
+0x64B75D19, 0xEFFF9DFA, 0x64B6A67C, 0x651A64F9, 0x5D1A5CF9, 0x651A5D1A, 0x651A5D19, 0x65195CF9,
+0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x651A5CF9,
+0x5D1A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x5CFA5CF9, 0x5D1A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x651A5CF9,
+0x5D1A5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA54F9, 0x5CF954F9, 0x5CF954D9,
+0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x54D954B9, 0x54D954B9, 0x54B954B8, 0x5CB954B9,
+0x54B954B8, 0x54B954B8, 0x54B94C98, 0x54B95498, 0x54994C98, 0x54995498, 0x54994C78, 0x54794C78,
+0x4C385458, 0x4C585458, 0x4C585458, 0x54585478, 0x4C585458, 0x54585479, 0x4C785479, 0x54785479,
+0x54785478, 0x54785499, 0x54985499, 0x54995C99, 0x54995499, 0x54B95CB9, 0x549954B9, 0x54B954B9,
+0x54B854B9, 0x54B95CD9, 0x54B954D9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54D95CD9, 0x5CD95CD9,
+0x5CD95CDA, 0x5CD964FA, 0x5CD95CFA, 0x5CD95CDA, 0x5CD95CD9, 0x5CD964FA, 0x5CD95CFA, 0x5CD95CD9,
+0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CF95CFA,
+0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA,
+0x5CD95CFA, 0x5CD95CFA, 0x5CF95CFA, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95D1A, 0x5CF95D1A,
+0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CFA5CFA, 0x5CF95D1A, 0x5CF95CFA, 0x5CF95CFA, 0x5CFA651A,
+0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x651A651A, 0x54B86519, 0x651A861E, 0x651964F9, 0x5CF9653A,
+0x5CFA651A, 0x5CFA651A, 0x5D1A651A, 0x5CFA651A, 0x5D1A651A, 0x5D1A651A, 0x5D19651A, 0x5D19651A,
+0x5D195D1A, 0x5D195D1A, 0x5D19651A, 0x64FA651A, 0x5D19651A, 0x5D1A651A, 0x5D1A651A, 0x5D1A651A,
+0x6CD8651A, 0x21079D18, 0x8D391908, 0x64FA753B, 0x5D19651A, 0x6519651A, 0x651A651A, 0x64F96D1A,
+0x5D19651A, 0x5D1A651A, 0x5D19651A, 0x64FA651A, 0x651A651A, 0x6519651A, 0x6519651A, 0x6519651A,
+0x6519651A, 0x6519651A, 0x6519651A, 0x651A6D1A, 0x5D1A653A, 0x5CF9653B, 0x6D1A64FA, 0x64F9653A,
+0x95FB64D8, 0xB69CEFFF, 0x64F874F7, 0x5D1A651A, 0x5D19651A, 0x5D1A651A, 0x6519651A, 0x64F96D1A,
+0x5D19651A, 0x5D1A651A, 0x5D1A651A, 0x651A651A, 0x5D1A651A, 0x651A651A, 0x651A651A, 0x651A651A,
+0x5D1A651A, 0x651A651A, 0x5D19651A, 0x5D1A651A, 0x5D19651A, 0x5D1A651A, 0x5D19651A, 0x5D1A651A,
+0x5CFA651A, 0x5CFA651A, 0x5CF9651A, 0x5CFA651A, 0x5CF95D1A, 0x5CF95CFA, 0x54F95CFA, 0x5CF95CFA,
+0x5CD95CFA, 0x5CD95CFA, 0x54D95CFA, 0x5CD95CFA, 0x54D95CFA, 0x54D95CDA, 0x54B95CD9, 0x54B95CD9,
+0x54B954D9, 0x54B95CD9, 0x54B854B9, 0x54B954B9, 0x549854B9, 0x549954B9, 0x54985499, 0x54995499,
+0x54584C38, 0x54584C58, 0x54584C58, 0x54584C58, 0x54794C58, 0x54784C58, 0x54794C58, 0x54795478,
+0x54995478, 0x54995478, 0x54B95498, 0x54B95498, 0x5CB95498, 0x5CB954B8, 0x5CB954B8, 0x54B95498,
+0x54D954B9, 0x54D954B9, 0x5CD954B9, 0x5CD954D9, 0x5CD954D9, 0x5CD954B9, 0x5CD95CD9, 0x5CD95CB9,
+0x5CFA5CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CF95CD9, 0x5CD95CD9, 0x5CF95CD9, 0x5CD95CD9,
+0x5CFA5CD9, 0x5CF954D9, 0x5CFA5CD9, 0x5CFA5CD9, 0x5CFA5CD9, 0x5CFA54D9, 0x5CFA5CF9, 0x5CFA5CF9,
+0x5D1A5CF9, 0x5CF95CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9,
+0x5D1A5CF9, 0x5CF95CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9,
+0x651A5CF9, 0x5CFA5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9,
+0x653A5CF9, 0x651A5CF9, 0x653A5CF9, 0x64F95CF9, 0x85FD64F9, 0x64F964F9, 0x651A653A, 0x651A5CF9,
+0x651A64F9, 0x651A64F9, 0x651A64F9, 0x651A5D19, 0x651A5D19, 0x651A64F9, 0x651A6519, 0x651A6519,
+0x5D3A5D19, 0x651A5D19, 0x651A5D19, 0x651A64F9, 0x651A6519, 0x651A6519, 0x651A64F9, 0x651A64F9,
+0x6CF9651A, 0x52CE8518, 0x84741084, 0x5D1A6CD8, 0x651A5CF9, 0x651A64F9, 0x651A651A, 0x651A6519,
+0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A64F9, 0x651A64F9, 0x651A6519, 0x651A6519,
+0x651A6519, 0x6D1964F9, 0x651A6519, 0x651A651A, 0x651A651A, 0x653A651A, 0x64F9651A, 0x64B76D39,
+0xE7FF95DA, 0x6CD7BEFF, 0x64F96CF8, 0x653A653A, 0x651A6519, 0x651A5D19, 0x651A651A, 0x651A6519,
+0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A64F9, 0x651A64F9, 0x651A6519, 0x651A6519,
+0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A64F9, 0x651A5CF9,
+0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x5CF95CF9, 0x5CFA5CF9, 0x5CFA5CF9,
+0x5CFA5CF9, 0x5CFA5CD9, 0x5CFA5CD9, 0x5CF954D9, 0x5CF95CD9, 0x5CD954D9, 0x5CD954D9, 0x5CD954B9,
+0x5CD954B9, 0x54D954B9, 0x54D954B9, 0x54B954B8, 0x54B954B9, 0x54B95498, 0x54B95498, 0x54994C98,
+0x4C585458, 0x4C585458, 0x54585479, 0x54585479, 0x54785499, 0x54785499, 0x54795499, 0x54985499,
+0x54995C99, 0x54995C99, 0x54B95CB9, 0x54B95CB9, 0x54B95CB9, 0x54B95CB9, 0x5CB95CD9, 0x54B95CB9,
+0x54D95CDA, 0x54D95CD9, 0x5CD95CDA, 0x5CD95CFA, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CDA, 0x5CD95CDA,
+0x5CD964FA, 0x5CD964FA, 0x5CD964FA, 0x5CD964FA, 0x5CF964FA, 0x5CD964FA, 0x5CF964FA, 0x5CF964FA,
+0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF9651A, 0x5CF95CFA, 0x5CF9651A, 0x5CF95CFA,
+0x5CF9651A, 0x5CF95D1A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5D19651A,
+0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5D19651A, 0x5CF9651A, 0x5D19651A, 0x5D19651A, 0x5D19651A,
+0x651A651A, 0x5D19651A, 0x651A651A, 0x5D19651A, 0x651A651A, 0x5D19651A, 0x651A651A, 0x5D19651A,
+0x5CF9651A, 0x655A64F9, 0x64F964F9, 0x65196D3A, 0x64F985DD, 0x65196D1A, 0x64F9651A, 0x65196D3A,
+0x651A6D3A, 0x651A651A, 0x651A6D1A, 0x651A651A, 0x651A651A, 0x651A651A, 0x651A6D3A, 0x65196D1A,
+0x5D3A653A, 0x6519653A, 0x651A6D3A, 0x651A6D1A, 0x651A6D3A, 0x6519653A, 0x651A6D1A, 0x651A6D1A,
+0x6CF96D1A, 0x84F77519, 0x528C3988, 0x651A855A, 0x65196D3A, 0x651A6D1A, 0x651A6D3A, 0x6519653A,
+0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x65196D3A,
+0x651A6D3A, 0x6D196D3A, 0x651A6D3A, 0x653A653A, 0x651A6D3A, 0x65196D3A, 0x6D196D1A, 0x95BA6CD8,
+0xCF5FEFFF, 0x64F874F8, 0x6D3A6D3A, 0x651A651A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x65196D3A,
+0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D1A, 0x65196D1A, 0x651A6D3A, 0x651A6D3A,
+0x651A6D3A, 0x6519653A, 0x651A6D3A, 0x6519653A, 0x6519651A, 0x6519651A, 0x6519651A, 0x6519651A,
+0x651A651A, 0x651A651A, 0x651A651A, 0x5D19651A, 0x5CF9651A, 0x5CF9651A, 0x5CFA651A, 0x5CF9651A,
+0x5CFA651A, 0x5CF964FA, 0x5CF95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CDA,
+0x54D95CDA, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B954B9, 0x54B954B9, 0x549954B9,
+0x54584C57, 0x54784C58, 0x54784C57, 0x54784C58, 0x54784C78, 0x54995478, 0x54995478, 0x54995498,
+0x54985498, 0x5CB95498, 0x54B95498, 0x5CB95498, 0x54B95498, 0x5CB954B8, 0x5CB954B8, 0x5CD954B8,
+0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954B9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9,
+0x5CF95CD9, 0x64F95CD9, 0x5CF95CD9, 0x5CF95CD9, 0x5CF95CD9, 0x5CF95CF9, 0x5CF95CF9, 0x5CF95CF9,
+0x5CF95CF9, 0x5CF95CF9, 0x5CF95CF9, 0x5CFA5CF9, 0x5CF95CF9, 0x5CFA5CF9, 0x5CF95CF9, 0x5CFA5CF9,
+0x5CF95CF9, 0x5CFA5CF9, 0x5CF95CF9, 0x5CFA5CF9, 0x5CF95CF9, 0x651A5CF9, 0x5CF95CF9, 0x651A5CF9,
+0x5D1A5CF9, 0x651A5CF9, 0x5D1A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5CF9, 0x651A5D19,
+0x65195CF9, 0x651A5CF9, 0x651A5D19, 0x651A6519, 0x651A5D19, 0x651A6519, 0x651A6519, 0x651A6519,
+0x653A5D19, 0x65196519, 0x653A5CF9, 0x7DDD5CD8, 0x65196D3A, 0x651A6519, 0x653A6519, 0x653A6519,
+0x651A6519, 0x651A6519, 0x653A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x653A6519, 0x653A6519,
+0x653A5D19, 0x653A5D19, 0x653A6519, 0x651A6519, 0x653A6519, 0x653A6519, 0x651A6519, 0x6D1A6519,
+0x6D196D19, 0x7D386D39, 0x31C9636F, 0x6D198559, 0x6D3A6519, 0x6D1A6D1A, 0x653A6519, 0x653A651A,
+0x653A6519, 0x653A651A, 0x653A6519, 0x653A6519, 0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519,
+0x653A651A, 0x6D396519, 0x653A6519, 0x653A653A, 0x6D1A651A, 0x6D196D19, 0x64D76539, 0xE7FF8DBA,
+0x7CF7D79F, 0x6D5A6CF8, 0x651A651A, 0x653A653A, 0x653A653A, 0x6D396519, 0x653A6519, 0x653A651A,
+0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519,
+0x653A6519, 0x653A6519, 0x653A6519, 0x653A6519, 0x653A6519, 0x653A6519, 0x653A6519, 0x653A6519,
+0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A5CF9, 0x5D1A5CF9, 0x5CF95CF9,
+0x5CF95CF9, 0x5CFA5CF9, 0x5CF95CF9, 0x5CFA5CD9, 0x5CF954D9, 0x5CF954D9, 0x5CD954D9, 0x5CD954D9,
+0x5CD954B9, 0x5CD954B9, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B954B8, 0x54B94C98, 0x54B95498,
+0x4C585478, 0x54785478, 0x54785478, 0x54785479, 0x54785499, 0x54985499, 0x54985499, 0x54995C99,
+0x54985CB9, 0x54B95CB9, 0x54B85CB9, 0x54B95CB9, 0x54B95CB9, 0x5CB95CD9, 0x5CD95CD9, 0x5CD95CD9,
+0x54D95CD9, 0x5CD95CD9, 0x5CD95CF9, 0x5CD95CFA, 0x5CD95CFA, 0x5CD964FA, 0x5CD95CFA, 0x5CD964FA,
+0x5CF964F9, 0x5CF964FA, 0x5CF9651A, 0x5CF964FA, 0x5CF95CFA, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A,
+0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A,
+0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5D19651A, 0x5D1A651A, 0x5D19651A, 0x64FA651A,
+0x64F9651A, 0x64FA651A, 0x651A651A, 0x651A651A, 0x5D1A651A, 0x651A651A, 0x651A651A, 0x651A651A,
+0x6519653A, 0x651A653A, 0x651A653A, 0x651A653A, 0x6519653A, 0x651A653A, 0x651A653A, 0x651A6D3A,
+0x65196D3A, 0x65196D5A, 0x64F96D3A, 0x6D3A861D, 0x651964F9, 0x64F96D3A, 0x651A6D3A, 0x651A6D3A,
+0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x653A6D3A, 0x651A6D3A, 0x653A6D3A, 0x651A6D3A,
+0x651A6D3A, 0x651A6D3A, 0x653A6D3A, 0x65196D3A, 0x65396D3A, 0x653A6D3A, 0x651A6D3A, 0x651A6D3A,
+0x65196D3A, 0x6D18651A, 0x29C99537, 0x75396434, 0x65196D39, 0x6D1A6D1B, 0x653A653A, 0x653A6D3A,
+0x653A6D3A, 0x653A6D3A, 0x65396D3A, 0x653A6D3A, 0x65196D3A, 0x651A6D3A, 0x65196D3A, 0x651A6D3A,
+0x653A6D3A, 0x65396D3A, 0x653A6D3A, 0x653A6D3A, 0x6D3A6D3A, 0x6D18753A, 0x8DBA6CF8, 0xDFBFE7FF,
+0x6CF78579, 0x6D3A7539, 0x655A6D3A, 0x6D5A6D3A, 0x653A6D3A, 0x6D396D3A, 0x65396D3A, 0x653A6D3A,
+0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x65196D3A, 0x651A6D3A,
+0x65396D3A, 0x653A6D3A, 0x65396D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x65396D3A, 0x653A6D3A,
+0x651A6D3A, 0x651A6D3A, 0x6519653A, 0x6519653A, 0x6519653A, 0x651A651A, 0x5D19651A, 0x5CF9651A,
+0x5CF9651A, 0x5CF9651A, 0x5CF95D1A, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CD95CFA, 0x5CD95CDA,
+0x5CD95CDA, 0x5CD95CDA, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B95CD9, 0x54B854B9, 0x54B854B9,
+0x54784C58, 0x54784C78, 0x54995478, 0x54995478, 0x54995478, 0x54995478, 0x5C995498, 0x5CB95498,
+0x54B95498, 0x54B954B8, 0x5CB954B9, 0x5CB954B8, 0x5CD95CB9, 0x5CD954B9, 0x5CD95CD9, 0x5CD95CD9,
+0x5CD95CD9, 0x5CD95CB9, 0x5CFA5CD9, 0x5CD95CD9, 0x64FA5CD9, 0x5CFA5CD9, 0x64FA5CF9, 0x64FA5CD9,
+0x64FA5CF9, 0x64FA5CF9, 0x64FA5CF9, 0x64F95CF9, 0x651A5CF9, 0x65195CF9, 0x651A5CF9, 0x651A5CF9,
+0x651A64F9, 0x651A5CF9, 0x651A64F9, 0x651A5CF9, 0x651A64F9, 0x651A5CF9, 0x651A64F9, 0x651A64F9,
+0x651A64F9, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519,
+0x651A6519, 0x651A64F9, 0x651A6519, 0x651A6519, 0x653A6519, 0x653A6519, 0x653A6519, 0x651A6519,
+0x651A651A, 0x651A6519, 0x6D3A651A, 0x653A6519, 0x651A6519, 0x651A6519, 0x6D3A651A, 0x6D3A651A,
+0x651A653A, 0x6D5A6539, 0x85FD64F9, 0x64F96D3A, 0x6D3A6519, 0x653A6519, 0x651A651A, 0x653A653A,
+0x6D3A651A, 0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A653A, 0x653A6519, 0x6D3A653A, 0x653A651A,
+0x6D3A651A, 0x6D3A6519, 0x6D3A6519, 0x6D3A6539, 0x653A6539, 0x653A6539, 0x6D3A6539, 0x6D3A6519,
+0x6D5A6519, 0x6D1A651A, 0x84F77CF8, 0x8D7919CB, 0x6D3A6D19, 0x653A6519, 0x653A6539, 0x6D3A651A,
+0x653A6539, 0x653A6539, 0x653A6539, 0x653A6539, 0x6D3A6539, 0x653A6539, 0x6D3A6539, 0x6D3A6539,
+0x6D3A653A, 0x6D3A653A, 0x6D3A653A, 0x6D3A6539, 0x6D3A6539, 0x75386518, 0xDFFF8558, 0x8D98DFDF,
+0x6D5A64D7, 0x65196D3A, 0x6D5A653A, 0x6D196519, 0x6D3A6D19, 0x6D3A6539, 0x6D3A653A, 0x653A6539,
+0x6D3A653A, 0x653A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519,
+0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519, 0x653A6519,
+0x6D3A6519, 0x653A6519, 0x6D3A651A, 0x651A6519, 0x653A651A, 0x651A6519, 0x651A6519, 0x651A5D19,
+0x651A5D19, 0x651A5D19, 0x651A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CDA5CD9,
+0x5CFA5CD9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x54D954B9, 0x54D954B9, 0x54D954B8,
+0x54785479, 0x54785499, 0x54985499, 0x54985499, 0x54995C99, 0x54995C99, 0x54995CB9, 0x5CB95CB9,
+0x54B95CB9, 0x54B95CB9, 0x54B95CD9, 0x5CB95CD9, 0x5CD95CDA, 0x5CD95CD9, 0x5CD964FA, 0x5CD964FA,
+0x5CD964FA, 0x5CD95CDA, 0x5CF964FA, 0x5CD964FA, 0x5CF964FA, 0x5CF964FA, 0x64F964FA, 0x5CF964FA,
+0x64F9651A, 0x64F9651A, 0x64F9651A, 0x6519651A, 0x6519651A, 0x5D19651A, 0x6519651A, 0x6519651A,
+0x6519651A, 0x6519651A, 0x6519651A, 0x64F9651A, 0x64FA651A, 0x6519651A, 0x6519651A, 0x6519651A,
+0x65196D1A, 0x6519653A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x6519653A, 0x651A6D3A, 0x6519653A,
+0x651A6D1A, 0x651A6D1A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x65196D3A, 0x65196D3A, 0x651A6D3A,
+0x65196D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x65196D3A, 0x6D396D3A, 0x6D39753A,
+0x65396D3A, 0x65196D3A, 0x6D3A861D, 0x6D196D1A, 0x65196D3A, 0x653A6D5A, 0x653A6D3B, 0x653A6D3A,
+0x653A6D3A, 0x653A6D3A, 0x6D3A6D3A, 0x653A6D3A, 0x653A6D5A, 0x653A6D3A, 0x6D3A6D3A, 0x65196D3A,
+0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x65396D3A, 0x653A6D5A, 0x65396D5A, 0x653A6D5A, 0x65396D3A,
+0x655A6D5A, 0x651A6D5B, 0x855A751A, 0x6C3442CF, 0x6D3A753A, 0x653A6D5A, 0x653A6D5A, 0x6D3A6D3A,
+0x653A6D3A, 0x653A6D5A, 0x653A6D5A, 0x653A6D5A, 0x653A6D5A, 0x653A6D5A, 0x655A6D5A, 0x655A6D5A,
+0x655A6D5A, 0x653A6D5B, 0x6D3A6D3A, 0x6D396D3A, 0x6D5A6D5A, 0x85786D18, 0xE7DFE7DF, 0x6CF69DFA,
+0x653A755A, 0x6D5A6D5B, 0x65396D3A, 0x6D39755A, 0x6D396D3A, 0x653A6D5A, 0x6D3A6D5A, 0x65396D5A,
+0x6D3A6D5A, 0x653A6D5A, 0x653A6D5A, 0x653A6D5A, 0x653A6D5A, 0x653A6D3A, 0x6D3A6D5A, 0x6D3A6D5A,
+0x6D3A6D3A, 0x653A6D3A, 0x6D3A6D3A, 0x653A6D3A, 0x6D3A6D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A,
+0x6D3A6D3A, 0x653A6D3A, 0x653A6D3A, 0x65196D3A, 0x65196D3A, 0x65196D3A, 0x653A6D3A, 0x651A6D3A,
+0x6519653A, 0x5D19653A, 0x5D19651A, 0x5D19651A, 0x5CFA651A, 0x5CF9651A, 0x5CF9651A, 0x5CF964FA,
+0x5CD95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x54D95CDA, 0x54D95CFA, 0x54B95CD9, 0x54D95CD9, 0x54B95CD9,
+0x54784C58, 0x54995478, 0x54985478, 0x54995478, 0x54985498, 0x5C995498, 0x5CB95498, 0x5CB95498,
+0x5CB954B8, 0x5CB954B9, 0x5CD954B9, 0x5CD95CB9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9,
+0x5CF954D8, 0x5CF95CD9, 0x5CF95CD9, 0x64F95CD9, 0x64F95CF9, 0x64F95CF9, 0x64F95CF9, 0x651A5CF9,
+0x64FA5CF9, 0x651A64F9, 0x65195CF9, 0x651A64F9, 0x651964F9, 0x651964F9, 0x651964F9, 0x65196519,
+0x65196519, 0x651A5D19, 0x65196519, 0x6D1A6519, 0x651A64FA, 0x651A651A, 0x65395D19, 0x651A6519,
+0x65396519, 0x653A6519, 0x651A5D19, 0x653A6519, 0x65196519, 0x6D3A6519, 0x653A5D19, 0x651A6519,
+0x651A6519, 0x653A6519, 0x653A6519, 0x653A5D3A, 0x65396519, 0x6D396519, 0x6D3A6519, 0x653A6519,
+0x6D3A6519, 0x655A5D19, 0x653A653A, 0x653A651A, 0x651A653A, 0x65396D3A, 0x7DBB6519, 0x74D84372,
+0x65196D39, 0x861D5CF8, 0x6D3A6519, 0x6D196D39, 0x6D3A6539, 0x6D3A6539, 0x6D3A6519, 0x6D3A6519,
+0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D5A653A,
+0x6D3A653A, 0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D5A6539,
+0x655A6539, 0x6D5A6539, 0x74F96D3A, 0x53317C76, 0x6D5A7539, 0x6D3B651A, 0x655A6539, 0x6D5A6539,
+0x6D5A6539, 0x6D3A6539, 0x6D3A6D39, 0x6D3A6D3A, 0x6D5A653A, 0x6D5A653A, 0x655A6539, 0x655A6539,
+0x6D5A6539, 0x6D3A6D5A, 0x6D3A653A, 0x6D5A6D3A, 0x6D386D59, 0xDFDF8577, 0xA61AE7DF, 0x6D5A6CF7,
+0x6D5A6539, 0x6D5A653A, 0x6D5A6539, 0x6D3A6D39, 0x6D5A6539, 0x6D3A6539, 0x6D5A6539, 0x6D5A6539,
+0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D5A6539, 0x6D5A6539,
+0x6D3A6539, 0x6D3A6539, 0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539,
+0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6519, 0x6D3A6539, 0x6D3A6519, 0x65396519, 0x653A6519,
+0x653A5D19, 0x653A5D19, 0x651A5D19, 0x651A5D19, 0x5D1A5CF9, 0x5D1A5CF9, 0x5D1A5CF9, 0x5CFA5CF9,
+0x5CF954D9, 0x5CFA5CD9, 0x5CD954D9, 0x5CD954D9, 0x5CD954D9, 0x5CD954B9, 0x54D954B9, 0x54D954B9,
+0x54785478, 0x54785C99, 0x54985499, 0x54995C99, 0x54985CB9, 0x54995CB9, 0x54B95CB9, 0x54B95CB9,
+0x54B95CD9, 0x5CB95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD964FA, 0x5CD95CFA, 0x5CD964F9,
+0x5CF95CF9, 0x5CF964FA, 0x5CF964FA, 0x5CF964F9, 0x5CF96519, 0x64F9651A, 0x64F96519, 0x64F9651A,
+0x651A651A, 0x6519651A, 0x6519651A, 0x651A6D1A, 0x6519651A, 0x65196D1A, 0x6519651A, 0x65196D3A,
+0x6519653A, 0x651A6D3A, 0x6519653A, 0x6D196D3A, 0x651A6D1A, 0x65396D3A, 0x65396539, 0x65196D3A,
+0x65396D39, 0x65396D3A, 0x653A653A, 0x65196D5A, 0x6D3A6D19, 0x65196D5A, 0x653A653A, 0x65196D3A,
+0x65396D3A, 0x653A6D3A, 0x653A655A, 0x653A655A, 0x6539655A, 0x6D396D3A, 0x65396D5A, 0x65396D5A,
+0x65396D3A, 0x5D39655A, 0x65196539, 0x653A6D3A, 0x6D3A651A, 0x75396D19, 0x330F7D79, 0x74B60045,
+0x65187539, 0x65198E3D, 0x6D596D5A, 0x65196D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x653A6D3A, 0x6D3A6D3A,
+0x653A6D5A, 0x6D3A6D5A, 0x653A6D5A, 0x6D3A6D5A, 0x653A6D5A, 0x6D3A6D5A, 0x653A6D5A, 0x6D5A6D5A,
+0x653A6D5A, 0x6D3A6D5A, 0x653A6D5A, 0x6D3A6D5A, 0x653A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A6D5A,
+0x65396D5A, 0x655A6D7A, 0x753A6D3A, 0x53728D19, 0x757A6CB7, 0x651A6D3A, 0x6D5A6D5A, 0x6D396D3A,
+0x65396D7A, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A6D3A, 0x6D5A6D5A, 0x6D5A6D5A, 0x655A6D5A, 0x655A6D5A,
+0x6D3A6D5A, 0x6D5A6D5A, 0x6D7B757B, 0x6D5A6D3A, 0x75376D39, 0xE7FFD79F, 0x74D6BEBC, 0x6D3A755A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D3A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A6D5A,
+0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A,
+0x65396D5A, 0x6D3A6D5A, 0x65396D5A, 0x6D3A6D5A, 0x65396D5A, 0x65396D3A, 0x65396D3A, 0x65396D3A,
+0x65396D3A, 0x65396D3A, 0x6519653A, 0x6519653A, 0x5D19651A, 0x5D19651A, 0x5D19651A, 0x5CF9651A,
+0x5CF95CFA, 0x5CF95CFA, 0x5CD95CFA, 0x5CD95CFA, 0x54D95CFA, 0x5CD95CDA, 0x54B95CD9, 0x54B95CD9,
+0x54995478, 0x54995478, 0x5C995498, 0x5CB95498, 0x5CB954B9, 0x5CB954B8, 0x5CD954B9, 0x5CB954B9,
+0x5CD954B9, 0x5CD954B9, 0x5CD95CD9, 0x5CD95CD9, 0x64FA5CD9, 0x5CF95CD9, 0x64F95CD9, 0x64F95CD9,
+0x64FA5CF9, 0x64F95CF9, 0x65195CF9, 0x65195CF9, 0x651A5CF9, 0x651A64F9, 0x651A64F9, 0x651964F9,
+0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A6519,
+0x653A6519, 0x653A6519, 0x65396519, 0x65196519, 0x6D3A651A, 0x653A6519, 0x6D3A6539, 0x653A6519,
+0x6D396539, 0x6D3A6539, 0x65196519, 0x6D3A6519, 0x6D3A6D19, 0x65196519, 0x6D3A6539, 0x6D5A6519,
+0x6D3A6519, 0x653A6539, 0x655A6539, 0x655A6539, 0x6D3A6539, 0x6D3A6519, 0x6D3A6539, 0x655A6539,
+0x6D5A6D3A, 0x655A6559, 0x6D5A6539, 0x6D396D39, 0x6D5A6559, 0x4B917D7A, 0xEFFFB67B, 0x85990147,
+0x85FC6D38, 0x6D396539, 0x6D3A6D3A, 0x6D3A6D39, 0x6D5A6D39, 0x6D5A6539, 0x6D5A6539, 0x6D5A653A,
+0x6D5A6539, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539,
+0x6D5A6D3A, 0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539,
+0x6D5A6D39, 0x6D5A6D59, 0x755A6D3A, 0x74D77559, 0x853942F0, 0x6D7A7539, 0x6D186D59, 0x6D3A7539,
+0x6D7B653A, 0x6D5A6D5A, 0x6D5A6539, 0x6D5A6519, 0x6D5A6D5A, 0x6D5A6D59, 0x6D5A6D39, 0x6D5A6D3A,
+0x6D5A6D5A, 0x6D3A6D39, 0x6D5A6D19, 0x6D396D7A, 0xCF5F7D17, 0xBEDDE7FF, 0x75596CD6, 0x6D3A6D39,
+0x6D5A6D3A, 0x6D5A6D5A, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D3A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539,
+0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6D5A, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539,
+0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539,
+0x6D3A653A, 0x653A6519, 0x653A6519, 0x651A6519, 0x651A6519, 0x651A6519, 0x651A5D19, 0x5CFA5CF9,
+0x651A5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CD9, 0x5CFA5CF9, 0x5CD95CD9, 0x5CD95CD9, 0x5CD954B9,
+0x54995C99, 0x54995C99, 0x54995CB9, 0x54995CB9, 0x5CB95CD9, 0x54B95CB9, 0x5CD95CD9, 0x5CB95CD9,
+0x5CD95CD9, 0x5CD95CD9, 0x5CD964FA, 0x5CD964FA, 0x5CF964FA, 0x5CF964FA, 0x5CF964FA, 0x5CF964FA,
+0x64F9651A, 0x64F9651A, 0x64F9651A, 0x6519651A, 0x6519651A, 0x6519651A, 0x65196D1A, 0x65196D1A,
+0x651A6D3A, 0x651A6D3A, 0x651A6D3A, 0x65196D3A, 0x65196D3A, 0x65196D3A, 0x651A6D3A, 0x65196D3A,
+0x651A6D3A, 0x653A6D3A, 0x65396D3A, 0x65396D3A, 0x653A6D3A, 0x65396D3A, 0x65396D3A, 0x65196D3A,
+0x6D5A6D5A, 0x65196D5A, 0x6D5A6D3A, 0x65396D5A, 0x6D396D3A, 0x6D3A6D3A, 0x6D5A6D5A, 0x65196D3A,
+0x6D396D3A, 0x65396D3A, 0x65396D5A, 0x65396D5A, 0x6D396D5A, 0x65396D3A, 0x653A6D3A, 0x65396D5A,
+0x65196D5B, 0x655A6D5A, 0x6D396D5A, 0x6D396D59, 0x75396D5A, 0x00236C34, 0xBE3852AB, 0x75377CB4,
+0x6D3985FC, 0x6D396D5A, 0x6D39755A, 0x6D3A755A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D3A755A, 0x6D5A6D5A, 0x6D3A757B, 0x859A6D5A, 0x8CF742D0, 0x6D597D39, 0x967E7559, 0x74F8857A,
+0x757A755A, 0x6D5A6D5A, 0x6D7A757B, 0x65396D7A, 0x6D5A6D5A, 0x6D59755A, 0x6D5A755A, 0x6D5A755A,
+0x6D39755A, 0x755A757B, 0x6D5A755A, 0x75386D39, 0xE7DFCF3F, 0x7D17CF3E, 0x6D597559, 0x755A755A,
+0x6D5A755A, 0x6D5A6D7A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D7A, 0x6D5A757B, 0x6D5A6D7A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x65396D5A, 0x6D3A6D5A, 0x65396D5A,
+0x6D3A6D5A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x651A6D3A, 0x6519653A, 0x651A6D1A, 0x5CF9651A,
+0x5CFA651A, 0x5CF9651A, 0x5CFA651A, 0x5CF964FA, 0x5CF9651A, 0x5CD95CFA, 0x5CD95CFA, 0x5CD95CDA,
+0x54985478, 0x5C995498, 0x54995498, 0x5CB95498, 0x5CB954B8, 0x5CB954B8, 0x5CD954B8, 0x5CD95CB9,
+0x5CD954B9, 0x5CD95CD9, 0x5CF95CD9, 0x5CF95CD9, 0x5CF95CD9, 0x64F95CD9, 0x64F95CF9, 0x65195CF9,
+0x64F95CF9, 0x651A64F9, 0x651A5CF9, 0x651A64F9, 0x651964F9, 0x651A6519, 0x651A6519, 0x651A6519,
+0x653A6519, 0x6D3A6519, 0x651A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519,
+0x653A6519, 0x653A651A, 0x653A653A, 0x65596539, 0x6D396539, 0x6D3A6539, 0x6D3A6519, 0x6D3A651A,
+0x653A6519, 0x6D3A653A, 0x655A653A, 0x655A5D3A, 0x6D3A655A, 0x6D5B6519, 0x653A5D19, 0x6D3A6519,
+0x6D5A6539, 0x6D5A6539, 0x6D596539, 0x6D3A6D39, 0x6D3A6539, 0x6D5A6D39, 0x6D5A653A, 0x6D5A6539,
+0x6D3A6D3A, 0x6D5A6D3A, 0x6D596519, 0x75796D38, 0x8D797559, 0x7BF010E6, 0x52AA18A2, 0x961B84D5,
+0x6D5A7559, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6539, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D3A,
+0x6D5A6D3A, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D3A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D59, 0x6D5A6D3A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D396D59, 0x6D7A6D5A, 0x757A6539, 0x7D196D5A, 0x42AE84D7, 0x7559857A, 0xBFBF6D59, 0xA61BD7DF,
+0x75387517, 0x757A7559, 0x6D7A6D5A, 0x757A6D7A, 0x6D5A6D59, 0x755A6D59, 0x755A6D5A, 0x755A753A,
+0x757A7579, 0x6D3A6D39, 0x755A6D3A, 0xB6BC74F7, 0xE7DFE7DF, 0x75597D17, 0x6D7A6D59, 0x6D3A757A,
+0x6D5A6D5A, 0x755A6D5A, 0x6D5A6D5A, 0x755A6D5A, 0x6D5A6D5A, 0x755A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D3A,
+0x6D5A6D3A, 0x6D5A6D3A, 0x6D5A6D3A, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6539,
+0x6D3A6539, 0x6D3A6539, 0x6D3A6519, 0x6D3A6519, 0x653A6519, 0x651A6519, 0x651A6519, 0x651A64F9,
+0x64FA5CF9, 0x651A5CF9, 0x5CF95CF9, 0x5CF95CF9, 0x5CF95CF9, 0x5CF95CD9, 0x5CF954D9, 0x5CFA54D9,
+0x54985C99, 0x54985CB9, 0x54985CB9, 0x54B95CB9, 0x54B95CD9, 0x5CB95CD9, 0x5CD95CD9, 0x5CD95CDA,
+0x5CD95CFA, 0x5CD964FA, 0x5CF964FA, 0x5CF964FA, 0x5CF964FA, 0x5CF964FA, 0x5CF9651A, 0x6519651A,
+0x64F9651A, 0x6519651A, 0x6519651A, 0x651A6D1A, 0x6519651A, 0x65196D3A, 0x65196D3A, 0x65196D3A,
+0x653A6D3A, 0x653A6D3A, 0x65196D3A, 0x651A6D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x65396D3A,
+0x653A6D3A, 0x653A6D3B, 0x65396D3A, 0x65596D5A, 0x65396D59, 0x6D396D5A, 0x65396D3A, 0x653A6D3B,
+0x653A6D5B, 0x6D3A6D3B, 0x65396D3A, 0x6D596D5A, 0x7539755A, 0x6D5A753A, 0x6D5A653A, 0x6D3A755A,
+0x6D3A6D5A, 0x6D3A6D5A, 0x6D396D5A, 0x6D39755A, 0x6D3A755A, 0x6D3A6D5B, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D5B, 0x6D3A757B, 0x755A6D5A, 0x75387559, 0x322B74B6, 0xC5D720E5, 0x4A694185, 0x751819A8,
+0x6D3A7559, 0x6D5A757B, 0x6D5A6D5A, 0x6D3A757B, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A6D5A, 0x6D5A755B,
+0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A,
+0x6D5A6D7A, 0x6D5A757A, 0x6D5A6D7A, 0x6D5A755A, 0x6D5A757A, 0x6D5A755A, 0x6D5A757A, 0x6D5A755A,
+0x757A755A, 0x6D5A757B, 0x757A6D5A, 0x7519755B, 0x5B51957A, 0x85597C76, 0x6D39755A, 0xE7FFC73F,
+0x8558CF5F, 0x75597D39, 0x6D7A6D5A, 0x6D59759B, 0x6D59757A, 0x6D5A757B, 0x755A755B, 0x755A7D5B,
+0x75597559, 0x757A757A, 0x6D187D9B, 0xE7FFAE5B, 0x9577E7BF, 0x757A7D59, 0x6D5A6D7A, 0x6D39759B,
+0x6D5A757B, 0x6D5A757B, 0x6D5A757B, 0x6D5A757B, 0x6D5A757A, 0x6D5A757B, 0x6D5A757B, 0x6D5A757B,
+0x6D5A757A, 0x6D5A757B, 0x6D5A757A, 0x6D5A757B, 0x6D5A757A, 0x6D5A757B, 0x6D5A757A, 0x6D5A757B,
+0x6D5A757A, 0x6D5A757B, 0x6D5A757A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A,
+0x6D5A755A, 0x6D5A755B, 0x6D5A6D5A, 0x6D3A755A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D3A, 0x6D3A6D3A, 0x653A6D3A, 0x651A6D3A, 0x651A6D3A, 0x651A6D1A,
+0x6519651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA, 0x5CF95CFA,
+0x5CB95498, 0x5CB95498, 0x5CB954B8, 0x5CB954B8, 0x5CD95CB9, 0x5CD95CD9, 0x5CD95CD9, 0x5CF95CD9,
+0x64F95CD9, 0x64F95CD9, 0x64FA5CF9, 0x64FA5CF9, 0x64F95CF9, 0x64F95CF9, 0x651A64F9, 0x651A64F9,
+0x651A64F9, 0x651A6519, 0x651A6519, 0x653A6519, 0x6D3A6519, 0x653A6519, 0x6D3A6519, 0x6D3A6519,
+0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539,
+0x6D3A6539, 0x6D3A651A, 0x655A653A, 0x655A6559, 0x6D5A6539, 0x6D3A6539, 0x6D3A6539, 0x655A653A,
+0x6D5B653A, 0x753A6D3A, 0x859A7539, 0x7CD68537, 0x84F76C33, 0x755A8579, 0x6D5A6D5A, 0x6D5A6D39,
+0x6D5A6539, 0x6D5A653A, 0x6D5A6D39, 0x6D3A6D39, 0x6D5A6D39, 0x6D5B6D3A, 0x6D5A653A, 0x6D5A6539,
+0x6D5A653A, 0x6D3A6D5A, 0x755A6D5A, 0x85786D17, 0x00025BB0, 0x93CE3965, 0x4A2830C2, 0x7D5900E6,
+0x759B6D39, 0x6D3A6519, 0x755A6D5A, 0x757A6D39, 0x755A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x757A6D5A, 0x6D7A6D59, 0x757A6D5A, 0x6D7A6D59, 0x757A6D59, 0x6D7A6D59, 0x757A6D5A, 0x6D7A6D59,
+0x757A6D5A, 0x6D7A6D59, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x755A6D59, 0x757A6D5A, 0x755A6D59,
+0x759B6D3A, 0x6D7A6D5A, 0x755A6D5A, 0x7D7A6D39, 0x74757D58, 0xA5594A6D, 0x755A7539, 0xBEBD74F7,
+0xE7DFDFBF, 0x7D58AE9C, 0x757A7559, 0x759A6D59, 0x757A6D7A, 0x6D7A6D5A, 0x757A6D5A, 0x755A755A,
+0x757A7559, 0x755A6D5A, 0x95BA7559, 0xEFDFE7BF, 0x7518A63B, 0x757A7579, 0x759B6D5A, 0x759A6D39,
+0x757A755A, 0x757A6D5A, 0x757A755A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A755A, 0x757A6D5A,
+0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A,
+0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x755A6D5A, 0x755A6D5A, 0x755A6D5A, 0x755A6D5A, 0x755A6D5A,
+0x755A6D5A, 0x755A6D5A, 0x755A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D39, 0x6D3A6D39, 0x6D3A6539, 0x6D5A6539, 0x6D3A6519, 0x6D3A6539, 0x6D3A6519, 0x651A6519,
+0x651A6519, 0x651A6519, 0x651A6519, 0x64F95CF9, 0x651A5CF9, 0x5CFA5CF9, 0x5CFA5CF9, 0x5CFA5CF9,
+0x54B95CB9, 0x54B95CB9, 0x5CB95CD9, 0x5CB95CD9, 0x5CD95CDA, 0x5CD964FA, 0x5CD964FA, 0x5CD964F9,
+0x64F964FA, 0x5CF964FA, 0x64F964FA, 0x64F964FA, 0x64F9651A, 0x64F9651A, 0x65196D1A, 0x6519651A,
+0x65196D3A, 0x65196D3A, 0x65196D3A, 0x65196D3A, 0x653A6D3A, 0x653A6D3A, 0x653A6D3A, 0x65396D3A,
+0x6D3A6D3A, 0x65396D5A, 0x6D3A6D5A, 0x65396D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A,
+0x6D3A6D5A, 0x6D3A6D3B, 0x6D3A6D5B, 0x65596D5A, 0x6D596D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x655A6D5A,
+0x6D396D5A, 0x7D177D59, 0x42AC6C33, 0x31A731C8, 0x2126422A, 0x3ACE1927, 0x7D9A8579, 0x75397539,
+0x6D5A755A, 0x6D5A6D5B, 0x6D5A6D5A, 0x6D39755A, 0x6D5A755A, 0x6D5B757B, 0x6D5A6D7B, 0x6D59757A,
+0x6D5A6D7A, 0x6D5A759B, 0x6D39757B, 0xA63A7D58, 0xE73BBE7A, 0xD594FF3B, 0x39667289, 0x7D7963D1,
+0x6D5A757A, 0x757A757B, 0x6D5A755A, 0x6D5A755A, 0x6D5A757B, 0x6D5A757B, 0x6D5A757B, 0x6D5A757B,
+0x6D7A757A, 0x6D7A757A, 0x6D7A757A, 0x6D7A757A, 0x6D5A757A, 0x6D7A757A, 0x6D7A757A, 0x6D5A757A,
+0x757A757B, 0x6D7A757A, 0x757A757B, 0x757A757A, 0x757A757B, 0x757A757A, 0x757A757B, 0x755A757A,
+0x6D5B757B, 0x759A6D5A, 0x755A757A, 0x75597D7B, 0x95997D59, 0x526C41CA, 0x755A8D9A, 0x7CF7857A,
+0xE7DFB69C, 0xCF7FE7FF, 0x75179E1B, 0x75597D79, 0x757A757B, 0x757A757B, 0x757A757B, 0x757A757A,
+0x757A757A, 0x7559759B, 0xD79F8559, 0xB67BEFFF, 0x757A7D18, 0x6D7A757A, 0x759B757B, 0x757A757A,
+0x757A757A, 0x757A757B, 0x757A757B, 0x757A757A, 0x757A757B, 0x757A757B, 0x757A757B, 0x755A757A,
+0x757A757B, 0x755A757A, 0x757A757B, 0x757A757A, 0x757A757B, 0x755A757A, 0x755A757A, 0x755A757A,
+0x757A757B, 0x757A757B, 0x755A757B, 0x755A757B, 0x755A757B, 0x755A757B, 0x755A757B, 0x755A757B,
+0x755A757B, 0x6D5A757A, 0x755A757B, 0x6D5A755A, 0x6D5A755B, 0x6D5A6D7A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A755A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D3A, 0x6D3A6D5A, 0x653A6D3A, 0x65196D3A,
+0x65196D3A, 0x6519653A, 0x6519651A, 0x5CF9651A, 0x5CF9651A, 0x5CF9651A, 0x5CFA651A, 0x5CF95CFA,
+0x5CB954B8, 0x5CB954B8, 0x5CD954B8, 0x5CD95CB9, 0x5CD95CD8, 0x5CF95CD9, 0x5CF95CD9, 0x5CF95CD9,
+0x64F95CD9, 0x64F95CF9, 0x64F95CF9, 0x651A64F9, 0x651964F9, 0x651A64F9, 0x65196519, 0x651A6519,
+0x6D396519, 0x6D3A6519, 0x6D396519, 0x6D3A6519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539,
+0x6D3A6539, 0x6D3A6539, 0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D5A6539, 0x6D3A6539, 0x6D5A6539,
+0x6D5A6539, 0x6D5B6D3A, 0x6D5A653A, 0x6D5A6D39, 0x6D5A6539, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D5A6539,
+0x859A6D39, 0x5AEC7C74, 0x52066B0B, 0xBD538BED, 0xB512DE57, 0x4A286ACA, 0x4B2F0883, 0x7D5A8D9A,
+0x6D5A6D39, 0x6D7B6D5A, 0x6D5A653A, 0x755A6D5A, 0x755A6D5A, 0x6D5B6D5A, 0x6D5A6D5A, 0x757A6D59,
+0x6D5A6D79, 0x757A6D7A, 0x75396D5A, 0xE7BF9598, 0xEED9F77C, 0xCD12D593, 0x3104936B, 0x85597C74,
+0x757A7559, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A755A,
+0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A755A, 0x757A6D5A, 0x757A755A,
+0x757A6D59, 0x757A755A, 0x757A6D59, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A755A,
+0x757B6D7A, 0x757A757A, 0x757A7579, 0x757A757A, 0x8D797579, 0x528D9495, 0x7D7A7CD7, 0x7D7A7559,
+0xA63B7517, 0xE7BFDF9F, 0xCF1DE7DF, 0x7D598557, 0x757B755A, 0x7D9B757A, 0x759A7579, 0x759B6D59,
+0x6D7A6D7A, 0x7D59757A, 0xE7FFC6FD, 0x7D18BEFE, 0x757A7559, 0x757B757A, 0x757A757A, 0x759A757A,
+0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A,
+0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A,
+0x757A757A, 0x757A757A, 0x757A6D5A, 0x757A755A, 0x757A6D5A, 0x757A755A, 0x757A6D5A, 0x757A755A,
+0x755A755A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x6D5A6D5A, 0x755A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6D5A6D59, 0x6D5A6D39, 0x6D5A6539, 0x6D5A6D39, 0x6D3A6539, 0x6D5A6539, 0x6D3A6539, 0x6D3A653A,
+0x6D3A6539, 0x65396519, 0x65196519, 0x65196519, 0x65195CF9, 0x651A5CF9, 0x5CF95CF9, 0x5CF95CF9,
+0x54B95CB9, 0x5CB95CD9, 0x5CD95CD9, 0x5CD95CDA, 0x5CD95CF9, 0x5CD964FA, 0x5CF964F9, 0x5CF964FA,
+0x5CF964F9, 0x64F964FA, 0x64F964F9, 0x6519651A, 0x6519651A, 0x65196D1A, 0x65196D3A, 0x651A6D3A,
+0x65196D3A, 0x6D396D3A, 0x65396D3A, 0x6D3A6D3A, 0x65396D5A, 0x6D3A6D5A, 0x65396D5A, 0x6D3A6D5A,
+0x6D396D5A, 0x6D3A6D5A, 0x6D396D5A, 0x6D5A6D5A, 0x6D396D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D5A6D5A,
+0x6D596D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A755A, 0x6D59757A, 0x6D5A757B, 0x6D396D3A, 0x75597559,
+0x4AEE8558, 0x9C2F5AAC, 0x494293AC, 0x72C86A46, 0x832A7287, 0x62479BCD, 0x18C462CA, 0x85382169,
+0x7539857A, 0x6D7A755A, 0x6D7A757B, 0x755A757B, 0x755A757B, 0x6D5A757B, 0x6D7A757B, 0x7559757A,
+0x6D59757A, 0x755A757B, 0x7D38755A, 0xEF7DB61A, 0xDDF4FF1A, 0x6A26BCAF, 0x31254923, 0x857A3A4C,
+0x757A7D7A, 0x757A757B, 0x757A757A, 0x757A757B, 0x757A757A, 0x757A757B, 0x757A757A, 0x757A757B,
+0x757A757B, 0x757A757B, 0x757A757B, 0x757A757B, 0x757A757B, 0x757A757B, 0x757A757B, 0x757A757B,
+0x757A757A, 0x757A757A, 0x757A757A, 0x757A7D9B, 0x757A757A, 0x757A7D9B, 0x757A757A, 0x757A757A,
+0x757A757B, 0x757A7D9B, 0x757A7D9A, 0x757B7D9B, 0x8579757A, 0x4ACE9D59, 0x8D9A5371, 0x755A7D5A,
+0x75387D7A, 0xDFBF9DB9, 0xEFDFE7BE, 0xAE5BE7DF, 0x75397D38, 0x757A7D9B, 0x759A7D9A, 0x6D7A7DBB,
+0x759A75BB, 0x9E1B7D79, 0xCF5FE7FF, 0x7D7A7D18, 0x757A7D9A, 0x757A7D9B, 0x757A7D9B, 0x757A7D9A,
+0x757A7D9A, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9A, 0x757A7D9B, 0x757A7D9A, 0x757A7D9B,
+0x757A759A, 0x757A7D9B, 0x757A759A, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A759A, 0x757A7D9B,
+0x757A7D9B, 0x757A7D9B, 0x757A759B, 0x757A7D9B, 0x757A759B, 0x757A7D9B, 0x757A757B, 0x757A757B,
+0x755A757B, 0x757A757B, 0x757A757B, 0x757A757B, 0x6D5A757B, 0x6D5A757B, 0x6D5A757B, 0x6D5A757B,
+0x6D5A6D7A, 0x6D5A757A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x65396D5A, 0x653A6D5A,
+0x65396D5A, 0x65396D3A, 0x65196D3A, 0x65196D3A, 0x6519651A, 0x5D1A651A, 0x5CF9651A, 0x5CF9651A,
+0x5CD954B8, 0x5CD95CB8, 0x5CD95CD9, 0x5CD95CD9, 0x64FA5CF9, 0x64F95CD9, 0x64F95CF9, 0x64F95CF9,
+0x651A64F9, 0x65195CF9, 0x651964F9, 0x651A64F9, 0x651A6519, 0x653A6519, 0x6D3A6539, 0x6D3A6539,
+0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6D39, 0x6D3A6539,
+0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D5A, 0x6D5A6D39,
+0x6D5A6D59, 0x6D5A6D59, 0x755A6D3A, 0x755A6D3A, 0x755A6D39, 0x6D5B6D5A, 0x755A755A, 0x85377538,
+0x4208636E, 0xCDB49C4F, 0x5983C531, 0x51847AA8, 0x518451A5, 0x72A951C5, 0x5A696288, 0x298818A3,
+0x857A8D38, 0x757B7559, 0x6D7A6D5A, 0x757A6D5A, 0x757B755A, 0x757B6D5A, 0x757A6D7A, 0x75797559,
+0x755A7579, 0x755B759B, 0x85177D7A, 0xF77DBE39, 0xBCB0F6B8, 0x41228B6A, 0x39673923, 0x74970003,
+0x757A755A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A,
+0x757A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A,
+0x759A757A, 0x759A7579, 0x759A757A, 0x759A7579, 0x759A757A, 0x759A757A, 0x757A757A, 0x757A7579,
+0x7D9A757A, 0x759A7579, 0x759A757A, 0x7D7B757A, 0x859B757B, 0x85187D5A, 0x959942CE, 0x7D7A7D59,
+0x7D9A757A, 0x85787D58, 0xDF9FCF3E, 0xEFBFE77E, 0x9DB9DF9F, 0x7D9A7517, 0x759A757A, 0x75997599,
+0x859A7579, 0xD7DF8D98, 0x7D38CFBF, 0x7D7A7D99, 0x7D9B757A, 0x759A757A, 0x7D9A757A, 0x7D9A757A,
+0x7D9A757A, 0x7D9A757A, 0x7D9A757A, 0x7D9A757A, 0x7D9A757A, 0x759A757A, 0x7D9A757A, 0x759A757A,
+0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A,
+0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x757A757A, 0x757A757A,
+0x757A757A, 0x757A755A, 0x757A757A, 0x757A757A, 0x757A755A, 0x757A6D5A, 0x757A755A, 0x757A6D5A,
+0x757A6D5A, 0x6D7A6D5A, 0x6D5A6D59, 0x6D5A6D59, 0x6D5A6D5A, 0x6D5A6559, 0x6D5A6539, 0x6D5A6539,
+0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x653A6519, 0x653A6519, 0x651A6519, 0x651A6519, 0x651A5CF9,
+0x5CD95CD9, 0x5CD95CD9, 0x5CD964FA, 0x5CD964F9, 0x64F9651A, 0x5CF964F9, 0x64F9651A, 0x64F9651A,
+0x64F9651A, 0x6519651A, 0x65196D1A, 0x65196D3A, 0x65196D3A, 0x65396D3A, 0x65396D3A, 0x65396D3A,
+0x6D396D3A, 0x6D396D3A, 0x6D3A6D3A, 0x6D3A6D3A, 0x6D3A6D5A, 0x6D396D5A, 0x6D3A6D5A, 0x6D3A6D5A,
+0x6D5A755A, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A755A, 0x6D5A757B, 0x6D5A755A,
+0x6D5A757A, 0x6D5A757A, 0x755A757B, 0x755A755A, 0x6D5A755A, 0x6D3A757B, 0x7D597D5A, 0x5B6E8D57,
+0x72E95228, 0xFF39EE97, 0x82E9B46F, 0x93ACAC2E, 0x39036227, 0x30E23923, 0x62896269, 0x18C34165,
+0x85384ACD, 0x755A857A, 0x757B757B, 0x755A757A, 0x755A757A, 0x6D7A757B, 0x757A759B, 0x75797D7A,
+0x755A7D9A, 0x757B6D5A, 0x95787D39, 0xF75CE79E, 0xA42EE657, 0x310251A4, 0x422B3125, 0x8D9A5B92,
+0x757A7D7A, 0x757A759B, 0x757A7D9B, 0x757A759A, 0x757A7D9B, 0x757A759A, 0x757A7D9B, 0x757A7D9B,
+0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B,
+0x759A7D9A, 0x759A7D9A, 0x759A7D9A, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A,
+0x7D7A7D9A, 0x759A7D9A, 0x759A75BB, 0x7D7B7D9B, 0x755A7D9C, 0x85BB7DBC, 0x84B55330, 0x7D7A8579,
+0x757A7D9B, 0x7D797D9B, 0xBF1D8558, 0xE77EE7BF, 0xEFBFEF9E, 0x8D78CF1E, 0x7D797D79, 0x7D997DBA,
+0x8558859A, 0xDFDFD77F, 0x75597D38, 0x7D9A7D9A, 0x759A7D9A, 0x759A759B, 0x7D9A7DBB, 0x7D9A7D9A,
+0x7D9A7D9B, 0x759A7D9B, 0x7D9A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A,
+0x759A7D9B, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A, 0x759A7D9A, 0x759A7D9A,
+0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B,
+0x757A7D9B, 0x757A7D7B, 0x757A7D9B, 0x757A759B, 0x757A757B, 0x757A757B, 0x757A757B, 0x6D7A757A,
+0x6D7A757B, 0x6D7A757A, 0x6D5A757A, 0x6D5A6D7A, 0x6D5A757B, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D5A6D5A,
+0x6D3A6D5A, 0x65396D5A, 0x6D3A6D5A, 0x653A6D3A, 0x653A6D3A, 0x651A6D3A, 0x651A6D3A, 0x6519653A,
+0x5CD954B8, 0x5CD95CD9, 0x5CF95CD9, 0x64F95CD9, 0x64F95CF9, 0x64F95CF9, 0x64F95CF9, 0x651A5CF9,
+0x651964F9, 0x651A6519, 0x651A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519,
+0x6D3A6519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6D39, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D39, 0x755A6D39,
+0x755A6D5A, 0x755A6D5A, 0x755A6D5A, 0x755A6D59, 0x755A6D59, 0x757A6D5A, 0x755A6D5A, 0x757A6D5A,
+0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x755A755A, 0x757B755A, 0x755A6D5A, 0x7CD67D79, 0x94719535,
+0xA46F6AC9, 0xEEB7F719, 0xF697AC8F, 0xAC90D593, 0x41646267, 0x312428E2, 0x49C62081, 0x29044185,
+0x745408A4, 0x857A8538, 0x759B755A, 0x757A755A, 0x757A7559, 0x757B757A, 0x759A6D7A, 0x7D7A757A,
+0x7DBB6D58, 0x7D7A759B, 0xBEBC8537, 0xDF3CDF7D, 0x736BD6B9, 0x314518A1, 0x95782167, 0x7D7A8DDA,
+0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x7D9A757A, 0x759A757A, 0x7D9A757A,
+0x759A757A, 0x7D9A757A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A,
+0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A,
+0x7D9A757A, 0x7D9A7D7A, 0x75BB759A, 0x7D9B759A, 0x7DBB757A, 0x8599759A, 0x5B517433, 0x7D9B8D9A,
+0x7D9A7D7A, 0x759A75BB, 0x7D587559, 0xE7BFA65B, 0xE77EDF5D, 0xE7BFEFBF, 0x8598A61A, 0x859A7558,
+0xC73E7D36, 0x74B6E7FF, 0x7DBA7D79, 0x85DB7579, 0x7D9A7579, 0x75BB759A, 0x7DBA759A, 0x7D9A7D9A,
+0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A,
+0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A,
+0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A,
+0x759A757A, 0x759A757A, 0x759A757A, 0x759A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A755A,
+0x757A6D59, 0x757A755A, 0x757A6D7A, 0x757A6D5A, 0x6D7A6D5A, 0x6D5A6D5A, 0x6D5A6539, 0x6D5A6D39,
+0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6519, 0x651A6519, 0x651A6519,
+0x5CD95CD9, 0x5CD964F9, 0x5CD964F9, 0x5CF964F9, 0x5CF964F9, 0x64F9651A, 0x64F9651A, 0x6519651A,
+0x6519651A, 0x65196D3A, 0x65196D3A, 0x65196D3A, 0x6D396D3A, 0x6D3A6D3A, 0x6D396D3A, 0x6D3A6D3A,
+0x6D3A6D3A, 0x6D3A6D5A, 0x6D396D5A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A755A, 0x6D5A755A,
+0x6D5A757A, 0x755A757B, 0x6D5A757A, 0x755A757A, 0x755A757A, 0x757A757A, 0x755A757A, 0x755A757A,
+0x755A755B, 0x6D7A757A, 0x755A757B, 0x755A7D7B, 0x757A757A, 0x7559759B, 0x7C748579, 0x7B4C9472,
+0xC55293AD, 0xE697F719, 0xC511CD93, 0xAC6FCD52, 0x398451E6, 0x28E32903, 0x28A23925, 0x31443903,
+0x29873987, 0x7D189579, 0x755A7D9A, 0x7D7A7D7A, 0x757A7D9A, 0x757B7D9B, 0x759A759B, 0x7D7A7D9A,
+0x75797D79, 0x7D187D59, 0xDF7EAE1A, 0xD73BDF7D, 0xD71AD6FA, 0x2146A534, 0x85798D38, 0x75BA759A,
+0x759A75BA, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B,
+0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB,
+0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x7D9A7DBB,
+0x759A7DBB, 0x7D9A7D9B, 0x759A7DBB, 0x75BA7DBB, 0x759A7DBB, 0x85DA7DBA, 0x52EF9D79, 0x7DBB95DB,
+0x7D9A7DBB, 0x759B7DDB, 0x759A7DBB, 0x95D97D78, 0xDF5DDF9F, 0xEFBFDF1C, 0xC71EEFDF, 0x7D378D99,
+0xE7FFC71E, 0x85387CD5, 0x7D798579, 0x757985BA, 0x759A7DBA, 0x75BA7DBB, 0x759A7DBB, 0x7D9A7DBB,
+0x759A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB,
+0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB,
+0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7DBB,
+0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B,
+0x757A757A, 0x757A757A, 0x6D7A757A, 0x6D7A757B, 0x6D7A757A, 0x6D5A757B, 0x6D5A755A, 0x6D5A755A,
+0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x65396D5A, 0x653A6D3A, 0x65196D3A, 0x65196D3A,
+0x64F95CD9, 0x64F95CD9, 0x64F95CF9, 0x64F95CF9, 0x651A5CF9, 0x651A5CF9, 0x651A64F9, 0x651A6519,
+0x6D1A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6D39, 0x6D3A6539,
+0x6D5A6539, 0x6D5A6539, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D5A, 0x755A6D59, 0x755A6D5A, 0x757A6D59,
+0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A755A, 0x757A6D59, 0x757A757A, 0x757A6D59,
+0x7D5B755A, 0x757A6D7A, 0x757A6D7A, 0x757A755A, 0x759B755A, 0x7D5A6D7A, 0x63908D58, 0x6A685228,
+0xBCD0BCF0, 0xEEB7B4F0, 0x8B2A9C0C, 0x9BCDA3CC, 0x41C54143, 0x290341C6, 0x31043104, 0x28C220A1,
+0x5AAC20C3, 0x95BA9557, 0x7DBB859A, 0x757A759A, 0x7D9A7D9A, 0x759B757A, 0x759B759B, 0x7D7A757A,
+0x85387D79, 0xC67C9557, 0xE77DE75D, 0xC6BADF7C, 0xB5F7CED9, 0x9D77A575, 0x7D9B8D9A, 0x75BA6D79,
+0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7DBA759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A,
+0x7DBB759A, 0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBB759A, 0x7DBB759A, 0x7DBB759A, 0x7DBB759A,
+0x7DBA759A, 0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBA759A, 0x7DBA759A, 0x7DBB759A, 0x75BA759A,
+0x75BB75BA, 0x7D9B759B, 0x7D9A7D7A, 0x7DBA75B9, 0x7D9B7D7A, 0x7D9A759A, 0x5B92959A, 0x859A8558,
+0x7D9B7D7A, 0x7DBA759A, 0x7DBA759A, 0x85997D99, 0xC6FE8558, 0xCEFDDF9F, 0xEFDFE79F, 0xDF5EDF7F,
+0x8CF5EFDF, 0x95B97CB4, 0x8DB9AE7C, 0x85DB7D79, 0x7DBB75BA, 0x7DBA75BA, 0x7DBB7D9A, 0x7DBB759A,
+0x7DBB7D9A, 0x7DBA759A, 0x7DBB7D9A, 0x7DBA759A, 0x7DBB7D9A, 0x7DBA759A, 0x7DBB7D9A, 0x7DBA759A,
+0x7DBB759A, 0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBA759A, 0x7DBA759A, 0x7DBA759A, 0x7DBA759A,
+0x7DBA759A, 0x7DBA759A, 0x7DBA759A, 0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBA759A, 0x7DBA759A,
+0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9B759A, 0x7D9A759A, 0x7D9A757A, 0x759A757A,
+0x757A757A, 0x757A757A, 0x757A757A, 0x757A6D5A, 0x757A755A, 0x757A6D5A, 0x755A6D5A, 0x6D5A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D3A, 0x6D5A6539, 0x6D5A6539, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539,
+0x5CF964FA, 0x5CF964FA, 0x64F964FA, 0x64F9651A, 0x64F9651A, 0x6519651A, 0x65196D1A, 0x65196D3A,
+0x651A6D3A, 0x6D3A6D3A, 0x6D3A6D3A, 0x6D3A6D3A, 0x6D3A6D3A, 0x6D3A6D3A, 0x6D3A6D5A, 0x6D3A6D5A,
+0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A755A, 0x6D5A757B, 0x6D5A757A, 0x755A757A, 0x757A757A,
+0x755A757A, 0x755A757B, 0x757A757B, 0x757A757A, 0x757A757B, 0x757A757A, 0x757A757A, 0x757A757A,
+0x7D7A7D7B, 0x757A759A, 0x757A759B, 0x757A7D7A, 0x755A7D9B, 0x7D9A757A, 0x5B0E9599, 0x62053904,
+0x9C0CAC2E, 0xE6765A04, 0x59E4834A, 0x8B299BAB, 0x41644964, 0x524841A5, 0x30E330C3, 0x28C13923,
+0x20E43124, 0x42EE31A8, 0x6CD76455, 0x8DBA857A, 0x859A8D9A, 0x759A7D9B, 0x7D7A7D9B, 0x85788579,
+0xC6FDAE7B, 0xEF9EE75E, 0xC678E75C, 0xD71CA5B6, 0x9D34D6DB, 0x63F2ADF9, 0x757A859A, 0x759A7DFB,
+0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB,
+0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB,
+0x7D9A7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x75BA7DBB,
+0x75DA7DDB, 0x7D9B7DBB, 0x859A859B, 0x7DB97DDA, 0x7D9B859B, 0x759A7DDB, 0x8D79859A, 0x95B95BD2,
+0x7D9A8DBB, 0x7DBA7DBB, 0x7DBA7DBA, 0x7D9A7DDB, 0x8579859A, 0xBEBD9DFB, 0xD73EA5B9, 0xEFBEF7DF,
+0x8CF5B5F9, 0xB69CDFBF, 0xA65BBE9C, 0x7DBA8579, 0x7DBA7DDB, 0x7DBA7DDB, 0x7DBB7DBB, 0x7DBA7DBB,
+0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB,
+0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB,
+0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBA7DBB,
+0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7D9B, 0x759A7D9B, 0x759A7D9B, 0x757A7D9B,
+0x757A7D9B, 0x757A7D9A, 0x757A7D7A, 0x757A757B, 0x757A757B, 0x757A757B, 0x755A757B, 0x6D5A757B,
+0x6D5A755A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x65396D5A,
+0x5CF95CD8, 0x64F95CD9, 0x64F95CD9, 0x64F964F9, 0x651964F9, 0x6D1A6519, 0x6D196519, 0x6D3A6519,
+0x6D3A6519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6D39, 0x6D3A6539, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D3A,
+0x755A6D5A, 0x755A6D5A, 0x755A6D59, 0x757A6D5A, 0x757A6D5A, 0x757A6D5A, 0x757A6D59, 0x757A6D59,
+0x757A7559, 0x757A755A, 0x757A755A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A,
+0x757A757A, 0x7D9A757A, 0x757B757A, 0x7D9A757A, 0x759A759A, 0x859A757A, 0x3A2A8537, 0x51A528E3,
+0x6A877B09, 0xC5314942, 0x412272E8, 0x7AA7938A, 0x49844984, 0x51E651E6, 0x30C249C6, 0x312328C1,
+0x398628E3, 0x4AAC5AAB, 0x5BB23ACE, 0x63B25350, 0x8D597454, 0x7D9985BA, 0x85987D79, 0xD77EAE7A,
+0xCEDBD73D, 0xC659C679, 0xB5F79D33, 0xDF3DCEFB, 0xADF99555, 0x6C749597, 0x7DBB6CD7, 0x7DBB759A,
+0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBB759A, 0x7DBA759A, 0x7DBB759A,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A,
+0x7DBA75BA, 0x7DBA7DBA, 0x7DBA7D9A, 0x7DBB7DBA, 0x859B7D7A, 0x7DDA759A, 0x8DDA75B9, 0xA59A530F,
+0x7DBB857A, 0x7DBB7DBB, 0x7DBA7D9A, 0x7DBA759A, 0x7DBA7DBA, 0x857A7D7A, 0x95BA859A, 0xADD7A5D7,
+0x31EA4ACC, 0xC6BD7412, 0xBEDDCF1E, 0x85BB859A, 0x7DBA7D9A, 0x7DBB7DBA, 0x7DBB75BA, 0x7DDA7DBA,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBA759A, 0x7DBB759A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBB759A, 0x7DBB7D9A,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBA759A, 0x7D9A759A, 0x7DBA759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A,
+0x759A759A, 0x759A759A, 0x759A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A6D5A, 0x757A6D5A,
+0x6D7A6D5A, 0x6D5A6D5A, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6539, 0x6D3A6539,
+0x5CF964F9, 0x64F964FA, 0x64F964FA, 0x64F9651A, 0x65196D1A, 0x651A6D3A, 0x6D196D3A, 0x6D196D3A,
+0x6D396D3A, 0x6D3A6D3A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D5A755A,
+0x755A755A, 0x755A755A, 0x755A757A, 0x755A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A757A,
+0x757A757A, 0x757A7D7A, 0x757A7D9A, 0x757A7D9B, 0x757A7D9A, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B,
+0x759A7D9A, 0x757A7D9A, 0x759A7D9B, 0x757A7D9B, 0x759A759A, 0x7D797D9B, 0x3A2A9599, 0x5A063124,
+0x5A055A06, 0x9BEC6A46, 0x30E16AA8, 0x62058B4A, 0x412359A5, 0x51E66268, 0x41647B0B, 0x28E228C2,
+0x41853944, 0xAD355A49, 0x5391A5B9, 0x7C7484B6, 0x4B0F63B2, 0x85788D78, 0xB6BCA63B, 0xD71BDF9E,
+0xD6FAC679, 0x6B8DA575, 0xDF5CEFBE, 0xC6BBCE9A, 0x63B08CF4, 0x74F66412, 0x7D9A8599, 0x7DBB85BB,
+0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB,
+0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB,
+0x7D9A7DBB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA85BB, 0x7DBB85BB, 0x7DBA85BB, 0x7DBA85BB,
+0x7DBA7DBB, 0x7DBA85BB, 0x7DBA85BA, 0x7DBB7DDB, 0x85BB85BB, 0x75BA7DDB, 0x8DDA7DDA, 0x5B106B92,
+0x859A9DDB, 0x7DBB85BB, 0x7DBA85BB, 0x75BA85FC, 0x75BA7DDB, 0x85BB85DB, 0x85797D9C, 0xE7BFBEBB,
+0x29C96BD0, 0x5B704AAD, 0xAE5BADFA, 0x7DBA95FB, 0x7DBA85BA, 0x7DBB7DBB, 0x7DBB7DBB, 0x7DBA85DB,
+0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA7DBB, 0x7DBB7DBB,
+0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA7DBB, 0x7DBB7DBB, 0x7DBA7DBB, 0x7DBB7DBB,
+0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7DBA7DBB,
+0x7D9A7DBB, 0x7DBA85BB, 0x7D9A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x759A7D9B,
+0x759A7DBA, 0x759A7DBB, 0x759A7D9A, 0x757A7D9B, 0x757A759A, 0x757A7D9B, 0x757A757B, 0x757A757B,
+0x6D7A757A, 0x6D5A757B, 0x6D5A757A, 0x6D5A755A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D3A6D5A,
+0x651A5CF9, 0x651A64F9, 0x651A64F9, 0x651A64F9, 0x6D1A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6D19,
+0x6D3A6539, 0x6D5A6539, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D3A, 0x6D5A6D39, 0x6D5A6D59, 0x6D7A6D59,
+0x755A755A, 0x755A6D5A, 0x757A755A, 0x757A755A, 0x757A755A, 0x757A6D59, 0x757A757A, 0x757A757A,
+0x7D9A757A, 0x759A757A, 0x7D9A757A, 0x759A757A, 0x7D9A757A, 0x759A757A, 0x7D9A757A, 0x7D9A757A,
+0x7D9A759A, 0x7D9A759A, 0x7D9B759A, 0x7D9A757A, 0x759A759A, 0x8599759A, 0x4A8C95B9, 0x59E63124,
+0x38E228A1, 0x7AC861E5, 0x39016AA7, 0x620672A7, 0x414451A5, 0x39036268, 0x41244165, 0x39233964,
+0x49854164, 0x5A6A4985, 0x95FA9DB8, 0x959A6C75, 0x8D788DB9, 0xCF1D536F, 0xC6BBD75E, 0xD6DBCEBB,
+0xBEBAC6DA, 0xDF3C638D, 0xD6FBD73C, 0xADF7D71B, 0x2A4ABE9A, 0x85B99E3A, 0x85BA85B9, 0x7D9A85FB,
+0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA,
+0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7DBA,
+0x7DBB7DBA, 0x7DBA7DBA, 0x7DDB7DBA, 0x7DDB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x7DBA7DBA,
+0x85BB7DBA, 0x85BA7DBA, 0x85BA7DBA, 0x7DBB7DBA, 0x85BB7D9B, 0x7DBA7DBB, 0x8DDA7DBA, 0x39AB8476,
+0x9DBA8CD6, 0x861C7D9A, 0x7D9A7DB9, 0x75BB75BA, 0x7DDB75DB, 0x85BA7DBA, 0x857A7D9B, 0xEFDFC6DC,
+0x428C8CF5, 0x42AD532F, 0x64545370, 0x85DB85BA, 0x85DA7DBA, 0x7DBB7DBA, 0x85BB7DBB, 0x85DA7DBA,
+0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA,
+0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA,
+0x7DDB7DBA, 0x7DDB7DBA, 0x7DDB7DBA, 0x7DBA7DBA, 0x7DBB7DBA, 0x7DBA7DBA, 0x7DBB7DBA, 0x7DBA7DBA,
+0x85BB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7D9A759A,
+0x7DBA759A, 0x7DBA759A, 0x7D9A759A, 0x759A759A, 0x759A757A, 0x757A757A, 0x757B757A, 0x757A757A,
+0x757A757A, 0x757A6D7A, 0x757A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6539,
+0x64F9651A, 0x6519651A, 0x65196D1A, 0x65196D3A, 0x651A6D3A, 0x65396D3A, 0x6D3A6D3A, 0x6D3A6D3A,
+0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A755A, 0x6D5A755A, 0x6D5A757A, 0x755A757A,
+0x755A757B, 0x755A757A, 0x757A7D7B, 0x757A757B, 0x757A7D7A, 0x757A757A, 0x757A7D9B, 0x757A759A,
+0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B,
+0x7D9A7D9B, 0x7D9A7D9A, 0x7D9A7DBB, 0x759A7D9B, 0x759A7DBB, 0x7D797D9A, 0x424A9DDA, 0x39233966,
+0x30E228C2, 0x6A464943, 0x38E16A88, 0x61C559C5, 0x51C659C6, 0x28C24965, 0x4144832C, 0x41434985,
+0x518451C5, 0x49E759A5, 0x95BA8CD5, 0x9DFB9DDA, 0x9E1A8D99, 0xDF3DD71D, 0x8CD39D35, 0xC69AD6DC,
+0x7C929D96, 0xDF7D29A7, 0xCEFBDF5D, 0x7C71D6FB, 0x21E9ADF8, 0x9E5B4B70, 0x7D589E1B, 0x85FB330F,
+0x7DBB85BB, 0x7DBA7DBB, 0x7DBB85BB, 0x7DBA7DBB, 0x7DBB85BB, 0x7DBA7DBB, 0x7DBB85BB, 0x7DBA7DBB,
+0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB,
+0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x85BB85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB,
+0x85BB85DB, 0x7DBA85DB, 0x85BA85DB, 0x7DBB85DB, 0x7D9B85BB, 0x7DDB85DB, 0x8DBA85DA, 0x5AEFA5BA,
+0xADB962EE, 0x7D998DBA, 0x85FA85BA, 0x7DDB85DB, 0x85DB7DDB, 0x7D9985DA, 0x859985BB, 0xE79ED73E,
+0xAE3AA597, 0x9DD9D73E, 0x8D999DDA, 0x7DDB85DB, 0x85BA85DB, 0x7DBB85DB, 0x85BB85DB, 0x7DBA85DB,
+0x85BB85DB, 0x7DBA85DB, 0x85BB85DB, 0x7DBA85DB, 0x85BB85DB, 0x7DBA85DB, 0x85BB85DB, 0x7DBA85DB,
+0x85BB85DB, 0x7DBA85DB, 0x85BB85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB,
+0x7DDB85DB, 0x7DDA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB,
+0x7DBB85DB, 0x7DBA85DB, 0x7DBB85BB, 0x7DBA7DBB, 0x7DBB85BB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB,
+0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x759A7D9B, 0x757A7D9B, 0x757A7D9B, 0x757A7D9B,
+0x757A7D9B, 0x6D7A759B, 0x6D7A757B, 0x6D5A757B, 0x6D5A757B, 0x6D5A6D7A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x65195CF9, 0x651A6519, 0x651A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6519, 0x6D3A6539, 0x6D3A6D39,
+0x6D5A6539, 0x6D5A6D3A, 0x6D5A6D39, 0x755A6D5A, 0x755A6D59, 0x755A6D5A, 0x757A6D5A, 0x757A6D5A,
+0x757A755A, 0x757A755A, 0x757A757A, 0x757A757A, 0x759A757A, 0x7D9A757A, 0x759A757A, 0x7D9A757A,
+0x759A757A, 0x7D9A757A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A757A, 0x7D9A757A, 0x7D9A757A,
+0x7D9A759A, 0x7D9A7D9A, 0x7DBB759A, 0x7DBB759A, 0x7DBB7579, 0x8599759A, 0x426B95B9, 0x28813144,
+0x39232081, 0x59C538C1, 0x41225A26, 0x6A474943, 0x49A559E6, 0x20813923, 0x38E351C6, 0x51E630E2,
+0x72A851C4, 0x49A74984, 0x53505B4F, 0xB61B7433, 0xE7BFBE9B, 0xDF1CDF1C, 0xB6389D55, 0xAE187CD2,
+0x11047C71, 0xE7BF52EC, 0xCEBAD71C, 0x5B2DA595, 0x74326C10, 0x74530063, 0x00445370, 0x85DB5C54,
+0x7DBB7DBA, 0x85BB7DBA, 0x7DBB7DBA, 0x85BB7DBA, 0x7DBB7DBA, 0x85BB7DBA, 0x7DBB7DBA, 0x85BB7DBA,
+0x7DBB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA,
+0x7DDB7DBA, 0x7DDB7DBA, 0x7DDB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x7DDB7DBA,
+0x7DDB7DBB, 0x85DB7DBB, 0x85BA7DBA, 0x85DB7DBA, 0x85BB7DBB, 0x85FB7DDB, 0x7DBA75BA, 0x94D695FB,
+0x732E62CC, 0x8DBA9DB9, 0x85BA85BA, 0x859A85DB, 0x8DBA85BA, 0x8DFB85DA, 0x95B98DDB, 0xEFBFDF5E,
+0xCF5EA5D8, 0x8D57CF3E, 0x8DBA8D99, 0x7DDB85DB, 0x85BA7DBA, 0x85DB7DBA, 0x85BB7DBB, 0x85DB7DBB,
+0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA,
+0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA,
+0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA,
+0x85BB7DBA, 0x85BB7DBA, 0x7DBB7DBA, 0x7DDB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBB7D9A, 0x7DBB7D9A,
+0x7DBB759A, 0x7DBB7D9A, 0x7DBA759A, 0x7D9B759A, 0x759A759A, 0x7D9B759A, 0x759A757A, 0x757A757A,
+0x757A757A, 0x757A757A, 0x757A757A, 0x757A6D7A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A, 0x6D5A6D5A,
+0x6519651A, 0x65196D1A, 0x65196D3A, 0x6D396D3A, 0x65396D3A, 0x6D3A6D3A, 0x6D396D5A, 0x6D3A6D5A,
+0x6D5A6D5A, 0x6D5A755A, 0x6D5A755A, 0x755A757B, 0x755A757A, 0x757A757A, 0x757A757A, 0x757A757B,
+0x757A757B, 0x757A7D7B, 0x757A7D9A, 0x757A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9A, 0x759A7D9B,
+0x759A7D9A, 0x759A7D9B, 0x759A7D9B, 0x7D9A7DBB, 0x759A7DBB, 0x7D9A7D9B, 0x7D9A7D9B, 0x7D9A7D9B,
+0x759A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7DBA7DBB, 0x7DBA7DBA, 0x859A7DBB, 0x636F9DDA, 0x28E220C3,
+0x310228A2, 0x49634103, 0x41236247, 0x6A474102, 0x49A551C5, 0x18404164, 0x624838E3, 0x5A074144,
+0x836B38E1, 0x4A086A48, 0x84D58CD5, 0xBE3A9516, 0xCEDABE39, 0xDF3CCE7A, 0x8D1494F4, 0x95559576,
+0x216510E4, 0xBE39F7FF, 0x9D34AD96, 0x52EC8C93, 0x532E3A4B, 0x11062147, 0x430F0064, 0x85DB9E1C,
+0x7DBA85BB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB,
+0x7DBA85BB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB,
+0x7DBA85DB, 0x7DDB85DB, 0x7DDB85DB, 0x85DB85DB, 0x7DBB85DB, 0x85DB85DB, 0x7DBB85DB, 0x85DB85DB,
+0x7DBB85DB, 0x85DB85DB, 0x85BA85DB, 0x85DB85DB, 0x85DB85DB, 0x7DDB85DB, 0x7DBA7DDB, 0xA5B98DBA,
+0x626A8BAF, 0x9DDA8453, 0x8DBA8D9A, 0x95FB95DC, 0x95FB9DFB, 0x963C961C, 0x9DDA9E3C, 0xE79EE79F,
+0xCF7FA5B8, 0x8537CF3F, 0x85DA95DA, 0x7DDB85DB, 0x85BA85DB, 0x85BB85DB, 0x85BB85DB, 0x7DDB85DC,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x7DBB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB,
+0x7DBB85DB, 0x85DB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x85DB85DB, 0x7DBB85DB, 0x85DB85DB,
+0x7DBB85DB, 0x85DB85DB, 0x7DBB85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBB85DB,
+0x85BB85DB, 0x7DBB85DB, 0x7DBA85DB, 0x7DDB85DB, 0x7DBB7DBB, 0x7DBB85DB, 0x7DBA85BB, 0x7DBB85BB,
+0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x759A7DBB, 0x759A7D9B, 0x757A7D9B,
+0x757A7D9B, 0x757A7D9B, 0x757A759B, 0x757A759B, 0x6D5A757B, 0x6D5A757B, 0x6D5A757A, 0x6D5A755A,
+0x653A6519, 0x653A6519, 0x6D3A6519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6539, 0x6D5A6D39, 0x6D5A6D39,
+0x6D5A6D59, 0x6D7A6D59, 0x755A6D5A, 0x757A6D5A, 0x757A755A, 0x757A7559, 0x757A757A, 0x757A757A,
+0x757A757A, 0x759A757A, 0x7D9B757A, 0x7D9A757A, 0x7D9A757A, 0x7D9A757A, 0x7D9A759A, 0x7D9A759A,
+0x7D9A759A, 0x7D9A759A, 0x7DBB7D9A, 0x7DBA7D9A, 0x7DBB7D9A, 0x7DBA7D9A, 0x7DBB7D9A, 0x7DBA7D9A,
+0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBA7DBA, 0x85BA7D9A, 0x638F95B9, 0x39241061,
+0x28C21881, 0x494330E2, 0x41236A68, 0x7AA830A0, 0x5A274143, 0x20813964, 0x412330E2, 0x62273903,
+0x8B8C4123, 0x3146732B, 0x95776BF1, 0xCEBADF5C, 0xCEB9CEFA, 0xDEFCCEB9, 0x74116BAF, 0x74103229,
+0xC67A73F0, 0xADD7B638, 0xC67A8CD3, 0x32096BD0, 0x32092187, 0x00E52187, 0x9E1B6412, 0x859A8DBA,
+0x85DB85BA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA,
+0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA,
+0x85DB7DBA, 0x85DB7DBA, 0x85DB85DB, 0x85DB7DDA, 0x85DB85DB, 0x85DB7DDA, 0x85DB85DB, 0x85DB7DDA,
+0x85DB85BB, 0x85DB85BB, 0x85DB85BA, 0x85DB7DDA, 0x85FB7DDA, 0x85DB7DBA, 0x85FB7DDA, 0xA5FA7DB9,
+0x728A9431, 0xBDD85A49, 0x9E1CA5FB, 0x9E3C9E1C, 0x9E3C961B, 0x961B963B, 0x9DFA8DDA, 0xF7BFE79F,
+0xD77F9D97, 0x8537CF5F, 0x8DFC8599, 0x85DB7DDB, 0x8DDA85DA, 0x8DDB85BA, 0x85DB85BB, 0x85DB7DDB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85BB, 0x85DB85BA, 0x85DB85DB, 0x85DB85DB,
+0x85DB85BB, 0x85DB85BA, 0x85DB85BB, 0x85DB85BA, 0x85DB85BB, 0x85DB85BA, 0x85DB85BB, 0x85DB85BA,
+0x85DB85BB, 0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA,
+0x85DB85BB, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85DB7DBA,
+0x7DBB7DBA, 0x7DBA7DBA, 0x7DBB7DBA, 0x7DBB7D9A, 0x7DBB7D9A, 0x7DBB759A, 0x7D9B759A, 0x7D9A759A,
+0x7D9A759A, 0x759A759A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A6D7A, 0x757A6D7A, 0x6D5A6D5A,
+0x65196D3A, 0x65396D3A, 0x6D3A6D3A, 0x6D396D5A, 0x6D3A6D3A, 0x6D3A6D5A, 0x6D3A6D5A, 0x6D596D5A,
+0x6D5A757A, 0x6D7A757A, 0x755A757A, 0x757A757A, 0x757A757B, 0x757A757A, 0x757A7D9B, 0x757A7D9A,
+0x757A7D9B, 0x759A7D9B, 0x759A7D9B, 0x759A7D9B, 0x7D9A7D9B, 0x7D9A7D9B, 0x7D9A7DBB, 0x7D9A7DBB,
+0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A85BB, 0x7D9A7DBB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB,
+0x7DBB85BB, 0x7DBA85BB, 0x7DBB85BB, 0x7DBA85BB, 0x85BB85BB, 0x859A85BB, 0x32099DFA, 0x290320C3,
+0x28E21861, 0x494330E2, 0x38E26A68, 0x830A38C1, 0x52064102, 0x20A14164, 0x49854985, 0x51E64144,
+0x62885A27, 0xCE79A4B2, 0x8D15C6BB, 0xD6D9B5D6, 0xC699D6FA, 0xDF5DCE9A, 0x19453209, 0xE79EB618,
+0xCEDADF3D, 0xC69ABE38, 0xD75ED71C, 0x21C86BF1, 0x194629C8, 0x64521987, 0x85DA9E3B, 0x85BA8DDB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85FB,
+0x85BB8DDC, 0x85DB8DDB, 0x85DA8DFB, 0x85DA85FB, 0x85FB85FB, 0x85DA8DDB, 0x85DA8DDB, 0x9DFA8E1B,
+0x6229B577, 0x72CB7AAA, 0xADFBC63B, 0x961C9E1C, 0x961B9E3C, 0x8DFB8DFB, 0x9DDA95DB, 0xEF9FEF9F,
+0xBEBC9D98, 0x8537D77F, 0x85DB961C, 0x85FB85FB, 0x85DA8DFB, 0x85DB8DDB, 0x85DB8DDC, 0x85FB85FC,
+0x85DB8DFC, 0x85DB8DFB, 0x85DB8DFC, 0x85DB8DFB, 0x85DB8DDB, 0x85DB85DB, 0x85DB8DDB, 0x85DB8DFB,
+0x85DB8DFC, 0x85DB85DB, 0x85DB8DDB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB8DDB, 0x85DB85DB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB,
+0x85DB85DB, 0x85BB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x7DBA85DB, 0x85BB85DB, 0x85BA85DB,
+0x7DBA85DB, 0x7DBA85DB, 0x7DBB85BB, 0x7DBA7DBB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB,
+0x759A7D9B, 0x759A7D9B, 0x757A7D9B, 0x757A759A, 0x757A7D9B, 0x757A759B, 0x757A759B, 0x6D5A757B,
+0x65396519, 0x6D3A6539, 0x6D3A6539, 0x6D3A6D39, 0x6D5A6D39, 0x6D5A6D39, 0x6D5A6D59, 0x755A6D59,
+0x757A6D59, 0x757A6D59, 0x757A6D59, 0x757A757A, 0x757A757A, 0x757A757A, 0x7D7A757A, 0x7D9A757A,
+0x759A757A, 0x7D9A757A, 0x7D9A759A, 0x7D9A757A, 0x7D9A759A, 0x7D9A7D9A, 0x7DBA7D9A, 0x7DBB7D9A,
+0x7DBA7D9A, 0x7DBA7D9A, 0x7DBA7D9A, 0x7DBA7D9A, 0x7DBA7D9A, 0x7DBB7DBA, 0x7DBA7D9A, 0x7DBB7D9A,
+0x7DBB7D9A, 0x85BB7DBA, 0x7DBB7DBA, 0x85BB7DBA, 0x7DBB7D9A, 0x85BA7DBA, 0x21A895DA, 0x208118C3,
+0x28C21881, 0x498428C1, 0x410251C5, 0x7AE938E1, 0x52063922, 0x28E23143, 0x6AA94184, 0x41443923,
+0xE6D96B0A, 0xEF9DDEFA, 0x6BF01124, 0xCE99BE58, 0xBE38D6FA, 0xADF8BE9A, 0xE7BE7430, 0x9D55D6FB,
+0xCEFBD73C, 0xC6BAC6B9, 0xC71C9DB7, 0x19676C11, 0x326B1986, 0x8DFA9E5A, 0x85DB7DDA, 0x85DB7DBA,
+0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA,
+0x85DB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85DA, 0x85DB85BA, 0x85DB85DA, 0x85DB85BA, 0x85DB85DA,
+0x85DB85BA, 0x85DB85DA, 0x85DB85BA, 0x85DB85DA, 0x85DB85BA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DB,
+0x85DB85BB, 0x85DB85DA, 0x85DA85BA, 0x8DDB85DA, 0x8DDB85BA, 0x9DFC8DDB, 0x9E1C95FB, 0xA61B961B,
+0x5A6ABE5B, 0x72487ACA, 0xC65A72EC, 0x961C9DFA, 0x8E1B85FA, 0x8E1B7DDA, 0xA5FA85B9, 0xF7BFE79F,
+0x9DD99D97, 0x8D58D79F, 0x85DC8DBA, 0x85FB7DDB, 0x8DDB85DA, 0x8DDB85DA, 0x85DB85BA, 0x85FC7DDB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DA,
+0x85DB85DA, 0x85DB85DB, 0x85DB85BA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DB,
+0x85DB85BA, 0x85DB85DA, 0x85DB85BA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA, 0x85DB85BA, 0x85DB85BA,
+0x85DB85BA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA,
+0x85BB7DBA, 0x85DB7DBA, 0x7DBB7DBA, 0x85BB7DBA, 0x7DBA7D9A, 0x7DBB7DBA, 0x7DBA7D9A, 0x7DBB759A,
+0x7DBA759A, 0x7D9A759A, 0x759A757A, 0x7D9A759A, 0x759A757A, 0x757A757A, 0x757A757A, 0x757A757A,
+0x65396D3A, 0x6D396D5A, 0x6D396D5A, 0x6D3A6D5A, 0x6D596D5A, 0x6D5A755A, 0x6D5A757A, 0x755A757A,
+0x757A757A, 0x757A757A, 0x757A757A, 0x757A7D9B, 0x757A7D9A, 0x757A7D9A, 0x757A7D9A, 0x7D7A7D9B,
+0x759A7D9A, 0x759A7D9B, 0x759A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7DBA85BB,
+0x7D9A7DBB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85DB, 0x7DBA85BB, 0x7DBA85BB,
+0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85DB, 0x7DBA85BB, 0x859A85DB, 0x63B09DFA, 0x18A11082,
+0x28E220A1, 0x51A528A1, 0x494351A5, 0x6A6738C1, 0x52055184, 0x29024184, 0x49C528C1, 0x31236AC9,
+0xBDD5C5D6, 0xD71BEF9D, 0xCEFBC699, 0xDF1CE75D, 0xC6BACEDB, 0xCEFBB618, 0xC6B9D75C, 0x84B29D55,
+0xB617DF3C, 0xC6DAADD6, 0x63CFB659, 0x19A742AB, 0x95B80946, 0x85DA8DFA, 0x7DBA85FB, 0x85DB85FB,
+0x85BA85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85BA85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB,
+0x85DB85DB, 0x85DB8DFB, 0x85DB85DB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB85DB, 0x85DB8DFB,
+0x85DB8DDB, 0x85DB8DFB, 0x8DDB8DFB, 0x95FB95FB, 0x95FB961C, 0x9E1C9E1C, 0x9DFCA61C, 0x9E1B9E3C,
+0xAD97AE3B, 0x7A885A28, 0x8BCF61E6, 0x8DBAB63B, 0x7DBA8DFB, 0x85FB85FB, 0xA63B8DBA, 0xEFBFEFBF,
+0x95789D77, 0x8D37DF9F, 0x85DB95DB, 0x85DB8DFC, 0x85DA8DFB, 0x8DDB8DFB, 0x85DB8DDB, 0x85FB8DFC,
+0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB,
+0x85DB8DFB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB8DFB,
+0x85DB8DDB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB8DFB, 0x85DB85DB, 0x85DB8DDB,
+0x85DB85DB, 0x85DB8DDB, 0x85BA85DB, 0x85DB85DB, 0x85BB85DB, 0x85DB85DB, 0x85BB85DB, 0x85BB85DB,
+0x7DBA85BB, 0x7DBB85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85BB, 0x7DBB85BB, 0x7D9A7DBB, 0x7DBA7DBB,
+0x7D9A7DBB, 0x759A7DBB, 0x759A7D9B, 0x759A7DBB, 0x759A7D9B, 0x757A7D9B, 0x757A759A, 0x757A757B,
+0x6D3A6539, 0x6D3A6539, 0x6D5A6D39, 0x6D5A6D59, 0x755A6D59, 0x755A6D59, 0x757A6D59, 0x757A6D59,
+0x757A757A, 0x757A757A, 0x757A757A, 0x759A757A, 0x7D9A757A, 0x7D7A757A, 0x7D9A757A, 0x7D9A759A,
+0x7D9A759A, 0x7D9A759A, 0x7DBB7D9A, 0x7DBA7D9A, 0x7DBA7D9A, 0x7DBA7D9A, 0x85BB7D9A, 0x85BA7D9A,
+0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA,
+0x85BB7DBA, 0x85BA7DBA, 0x85DB7DBA, 0x85DA7DBA, 0x85DB7DBA, 0x85DA7DBA, 0x745295DA, 0x18A10841,
+0x28E21860, 0x51E528C1, 0x51634963, 0x620538C0, 0x51C551C4, 0x31433943, 0x5A6728C1, 0x942F9C6F,
+0xE6FA9470, 0xDF3CDF1A, 0xC6DBA596, 0xCEFBC69A, 0xD73DB639, 0x84F37CB2, 0x534CD75C, 0x426AC6DA,
+0x8C92E79D, 0xEFFF8471, 0x192584B2, 0x198721C7, 0x961B6433, 0x8DFC85BA, 0x8DFB85BA, 0x85FB7DBA,
+0x85DB85DA, 0x85DB85DA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA,
+0x8DDB85DB, 0x85DB85DA, 0x8DDB85DB, 0x85DB85DA, 0x8DDB85DB, 0x85DB85DA, 0x8DDB85DB, 0x85DB85DA,
+0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x85FB85DA,
+0x8DFB85FB, 0x8DFB85FA, 0x961C8DFB, 0x9E1C95FB, 0x9E1C9E1B, 0x9E1C9E1B, 0x9E1C9DFB, 0x961B95FB,
+0xAE5B8DD9, 0x624894D4, 0x6A277A67, 0xADFA9472, 0x8DFC8DDA, 0x8E1B85FB, 0xAE7B8DDA, 0xF7DFEFFF,
+0x8D378D16, 0x8D37DF9F, 0x8DDC95FB, 0x8DFB85DB, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB8DDB, 0x85FB85DB,
+0x8DFB85FB, 0x8DFB85DB, 0x8DFB8DDB, 0x8DFB85DB, 0x8DFB85DB, 0x8DFB85DA, 0x8DFB85DB, 0x8DDB85DA,
+0x8DFB85DB, 0x8DFB85DA, 0x8DFB85DB, 0x8DDB85DA, 0x8DDB85DA, 0x8DDB85DA, 0x8DDB85DA, 0x8DDB85DA,
+0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DDB85DA, 0x85DB85DA, 0x8DDB85DA, 0x85DB85DA,
+0x8DDB85DB, 0x85DB85DA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DA, 0x85DB85BA, 0x85DB85BA, 0x85DB85BA,
+0x85DB85BA, 0x85DB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x7DBA7DBA,
+0x7DBB7D9A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x7D9A759A, 0x759A759A, 0x759A757A, 0x757A757A,
+0x6D3A6D5A, 0x6D3A6D5A, 0x6D5A755A, 0x6D5A757A, 0x755A757A, 0x755A757A, 0x757A757A, 0x757A757A,
+0x757A7D9B, 0x757A7D9A, 0x757A7D9A, 0x757A7D9A, 0x759A7D9B, 0x7D7A7D9A, 0x7D9A7D9B, 0x7D9A7DBB,
+0x7D9A7DBB, 0x7D9A7DBB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85BB, 0x85BA85BB, 0x7DBA85BB,
+0x7DBA85DB, 0x7DBA85DB, 0x85BB85DB, 0x85BA85DB, 0x85BB85DB, 0x85BA85DB, 0x85BB85DB, 0x85BA85DB,
+0x85BB85DB, 0x85BA85DB, 0x85DB85DB, 0x85DA85DB, 0x85DB85DB, 0x85BA85DB, 0x324BA63C, 0x10602104,
+0x31031861, 0x5A0628E1, 0x51A44123, 0x59E54102, 0x41636205, 0x39643944, 0xF77B41A5, 0xC5F5B573,
+0xEF7CAD33, 0xC6DADF3B, 0xBE7AA5B7, 0xA5D7CEDB, 0xCEFCADF8, 0x95956C31, 0x7450428A, 0x6C106C10,
+0x73CFF7FF, 0x5B2D3A4A, 0x21862166, 0x4B901987, 0x7DBA9E5C, 0x85DB8DFC, 0x8DDB8DDB, 0x85FB85FB,
+0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB,
+0x85DB8DFB, 0x85DB8DFB, 0x8DFB8DFC, 0x85FB8DFB, 0x85DB8DFB, 0x85FB8DFB, 0x8DFB8DFC, 0x85FB8DFB,
+0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x8DFB8E1B,
+0x8E1B8E1C, 0x8E1B961C, 0x961C963C, 0x961B961C, 0x95FB9E1C, 0x95FB961B, 0x95FB9DFB, 0x8DFA95FB,
+0x8DD9961B, 0x9CB3A5FA, 0x7A477268, 0xA5154965, 0x8DDCA5FB, 0x85DA8DFC, 0xB6BC8DDA, 0xEFDFEF9E,
+0x84F68D16, 0x8D37E7BF, 0x8DDB9DFC, 0x8DFA8DFB, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x85FB8DFC,
+0x8DFB8E1C, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB,
+0x8DDB8DFC, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB85DB, 0x85DB8DDB, 0x85DB8DDB,
+0x85DB85DB, 0x85DA85DB, 0x85BA85DB, 0x85BB85DB, 0x85BB85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB,
+0x7DBB85BB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x759A7D9B, 0x757A7D9B,
+0x6D5A6539, 0x6D5A6D39, 0x755A6D59, 0x755A6D59, 0x757A6D59, 0x757A6D59, 0x757A7579, 0x757A757A,
+0x757A7579, 0x7D7A757A, 0x7D7A757A, 0x7D9A757A, 0x7D9A759A, 0x7D9A759A, 0x7DBA759A, 0x7DBB7D9A,
+0x7DBA759A, 0x7DBB7D9A, 0x7DBA7D9A, 0x7DBB7DBA, 0x7DBA7D9A, 0x85BB7DBA, 0x85BA7D9A, 0x85BA7DBA,
+0x85BA7DBA, 0x85BB7DBA, 0x85BA7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA,
+0x85BB85BA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85BB85BA, 0x8DDB85BB, 0x112695DA, 0x188110A2,
+0x28E21881, 0x49A420A0, 0x59C44142, 0x59C44963, 0x498451A4, 0x20A13943, 0xEF3A20E1, 0xE71A840E,
+0xDF5CD6D9, 0xB69ABEB9, 0xC6BB9D96, 0x9D75B659, 0x7C31C679, 0x6BF00083, 0xE7BE4289, 0xD75D5B6E,
+0x21874B0C, 0x426A1966, 0x21872166, 0x9E5C4B4F, 0x85FC85DA, 0x85DB85DB, 0x85DB85DB, 0x8DFB85FB,
+0x85DB85DA, 0x8DFB85DA, 0x85DB85DA, 0x8DFB85DB, 0x8DFB85DA, 0x8DFB85DB, 0x8DFB85DA, 0x8DFB85DB,
+0x8DFB85DA, 0x8DFB85DB, 0x8DFB85DB, 0x8DFB85FB, 0x8DFB85DB, 0x8DFB85FB, 0x8DFB85DB, 0x8DFB85FB,
+0x8DFB85DB, 0x8DFB8DDB, 0x8DFB85DB, 0x8DFB8DFB, 0x8DFB85DB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8E1C8DFB,
+0x8DFB8DFB, 0x961C8DFB, 0x8E1C8E1B, 0x8DFB8DFB, 0x8DFB8DDB, 0x8E1B85FA, 0x8DFB8DDA, 0x8E1B8DFB,
+0x8DFA85DA, 0xAE1A95DA, 0x6A687B6E, 0x5A0861C5, 0x9DBBA558, 0x95FB95BA, 0xB6DD8DDA, 0xF7DFE79E,
+0x85378516, 0x8D37DF9F, 0x8DFB95FB, 0x8DFB8DFA, 0x8DFB85FA, 0x8DFC85FB, 0x8DFB8DDB, 0x8DFB8DFB,
+0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB,
+0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB,
+0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB85DB, 0x8DFB8DDB, 0x8DFB85DB, 0x8DFB8DDB, 0x8DFB85DB, 0x8DFB85DB,
+0x8DDB85DB, 0x8DFB85DB, 0x85DB85DA, 0x8DFB85DB, 0x85DB85DA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DA,
+0x85DB85BA, 0x85DB85BA, 0x85DB7DBA, 0x85DB85BA, 0x85BB7DBA, 0x85BB7DBA, 0x85BA7DBA, 0x85BA7DBA,
+0x7DBB7DBA, 0x7DBB7DBA, 0x7DBA7D9A, 0x7DBB759A, 0x7D9A759A, 0x7D9A759A, 0x759A759A, 0x7D9A759A,
+0x6D596D5A, 0x6D5A755A, 0x6D5A757A, 0x755A757A, 0x757A757A, 0x757A757A, 0x757A757A, 0x757A7D9A,
+0x757A7D9A, 0x7D7A7D9A, 0x757A7D9A, 0x7D9A7D9B, 0x7D9A7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x7DBB85BB,
+0x7D9A7DBB, 0x7DBB85BB, 0x7DBA85BB, 0x7DBA85DB, 0x7DBA85BB, 0x85BB85BB, 0x7DBA85BB, 0x85BA85DB,
+0x7DBA85BB, 0x85BA85DB, 0x85BA85DB, 0x85BA85DB, 0x85BA85DB, 0x85DB85DB, 0x85BA85DB, 0x85DB85DB,
+0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DA85DB, 0x00C5A65C, 0x10611082,
+0x28C22081, 0x416330E2, 0x518459E5, 0x494351A5, 0x51A459C5, 0x20813103, 0xDEF93964, 0xDEFAAD94,
+0xD75CC658, 0x84F4A5F8, 0xB659C6BB, 0xB5F76BCF, 0x10E38471, 0x29C94AED, 0x9534ADF8, 0x29E87C32,
+0x21C72187, 0x3A4A29C8, 0x53901947, 0x8DDAA65C, 0x7DBA8DFB, 0x8E1B8DFB, 0x8DFC85DB, 0x8DDB8DFC,
+0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB,
+0x85FB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8E1C, 0x85FB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8E1C,
+0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB8DFC, 0x8DFB961C,
+0x8DFB95FB, 0x8DFB95FC, 0x85FB8DFB, 0x8DFB8E1C, 0x8DFB8DFB, 0x861B8E1B, 0x8DFB8E1B, 0x8DFB961C,
+0x8E1B8E1B, 0x9DDA95FC, 0x6AEBB5F9, 0x6A4859A5, 0xB5FA5A8B, 0x95BAA5DA, 0xBEFD95BA, 0xDF5DF7DF,
+0x8D9884F6, 0x8D37DF9F, 0x8DFB95FB, 0x8DFA961B, 0x8DFB8E1B, 0x8DFB8E1C, 0x8DFB95FC, 0x8DFB961C,
+0x8DFB8DFC, 0x8DFB961C, 0x8DFB8DFC, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB961C, 0x8DFB8DFC, 0x8DFB961C,
+0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFC,
+0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DDB8DFB, 0x8DFB8DFB,
+0x8DDB8DFB, 0x8DFB8DFB, 0x85DB8DFB, 0x85FB8DFC, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB,
+0x85DB85DB, 0x85DB85DB, 0x85BA85DB, 0x85DB85DB, 0x85BA85DB, 0x85BA85DB, 0x7DBA85DB, 0x85BA85DB,
+0x7DBA85DB, 0x7DBA85DB, 0x7DBA85BB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7D9A7DBB, 0x759A7DBB, 0x759A7DBB,
+0x755A6D39, 0x755A6D59, 0x757A6D5A, 0x757A6D59, 0x757A757A, 0x757A7579, 0x7D9A757A, 0x759A757A,
+0x7D9A757A, 0x7D9A757A, 0x7D9B7D7A, 0x7D9A7D9A, 0x7DBB7D9A, 0x7DBB7D9A, 0x85BB7D9A, 0x7DBA7DBA,
+0x7DBB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB7DBA, 0x85DB85BA, 0x85DB85BA,
+0x85DB85BA, 0x85DB85BA, 0x85DB85BA, 0x85DB85BA, 0x85DB85BA, 0x85DB85BA, 0x85DB85DA, 0x85DB85DA,
+0x85DB85DA, 0x85DB85DA, 0x85FB85DB, 0x85FB85DA, 0x85DB85DA, 0x8DFB85BA, 0x534F95FA, 0x10810041,
+0x31031020, 0x49A420A0, 0x59A451C4, 0x41024943, 0x412359A4, 0x186128A1, 0xB5946B2B, 0xD71ACE98,
+0xC6DAC699, 0xADF88CF4, 0x4ACCAE18, 0x7C51D6FB, 0x84B308E3, 0x29E91947, 0x6BCF9D96, 0x29C8534D,
+0x29C731E8, 0x09261987, 0xA65C74F6, 0x95FB8DDA, 0x95FB8DDB, 0x8DFB8DFB, 0x8DFB85DA, 0x8DFB85DA,
+0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB,
+0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8E1B85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x961C8DFB, 0x8E1B8DFB, 0x8DFB8DFB, 0x8E1B8DFB,
+0x8E1B8DFB, 0x8DFB8DDB, 0x8DFC85FB, 0x95FB8DFB, 0x95FB8DDB, 0x8E1B85FB, 0x8E1B8DFB, 0x8DFC8DFB,
+0x8DFC85FB, 0x95FB8DFB, 0xB65A9DFA, 0x5206632B, 0x62EC5A07, 0x9DFBADFA, 0xCF3E95B9, 0xD73DE7BF,
+0x9E1A74D5, 0x8D57D79F, 0x8DFB95FA, 0x8E1B8DFA, 0x8E1C8E1B, 0x8E1C861B, 0x95FB8DFB, 0x8E1B8DFB,
+0x961C8DFB, 0x8E1B8DFB, 0x961C8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8E1B8DFB, 0x961C8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85FB, 0x8DFB85DB, 0x8DFB85DB,
+0x8DFB85DB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DA, 0x85DB85DA, 0x85DB85BA, 0x85DB85BA, 0x85DB7DBA,
+0x85DB7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x7DBA7DBA, 0x7DBB7DBA, 0x7DBA7D9A, 0x7D9A7D9A, 0x7D9A759A,
+0x6D59755A, 0x755A757A, 0x757A757A, 0x757A757A, 0x757A7D9B, 0x757A7D9A, 0x757A7D9A, 0x759A7D9A,
+0x7D7A7D9B, 0x7D9A7D9B, 0x7D9A7D9B, 0x7D9A7DBB, 0x7D9A85BB, 0x7DBA85BB, 0x7DBB85BB, 0x7DBA85DB,
+0x7DBA85DB, 0x7DBA85DB, 0x85DA85DB, 0x85DA85DB, 0x85BA85DB, 0x85DA85DB, 0x85DB85DB, 0x85DA85DB,
+0x85DB85DB, 0x85DA85DB, 0x85DB8DDB, 0x85DB85DB, 0x85DB8DDB, 0x85DB85DB, 0x85DB8DFB, 0x85DB8DFB,
+0x85DB8DFB, 0x85DA8DFB, 0x85DB8DFB, 0x85DA8DFB, 0x8DDB8DFB, 0x85DB8DFC, 0xAE3A95DA, 0x084010C4,
+0x31031840, 0x41642060, 0x518351A5, 0x39014943, 0x38E159E5, 0x6B0B2081, 0x52A9C617, 0xADF6AD94,
+0xBE59BE58, 0xCEFC9D35, 0xEFBF9515, 0x08839D15, 0x29E85B4D, 0x4AAC29A8, 0x322863AE, 0x21C721A7,
+0x11462187, 0x95B92A4B, 0x8DFB9E3C, 0x8DFB8DFB, 0x8DDB95FB, 0x8DFB8DDB, 0x8DFB8E1B, 0x8DFB8DFB,
+0x8DFB8DFC, 0x8DFB8E1B, 0x8DFB8E1C, 0x8DFB8E1B, 0x8DFB8E1C, 0x8DFB8DFB, 0x8DFB961C, 0x8DFB8E1C,
+0x8DFB8E1C, 0x8DFB8E1B, 0x8DFB8E1C, 0x8DFB8E1C, 0x8DFB961C, 0x8DFB8E1C, 0x8DFB961C, 0x8DFB8E1C,
+0x8DFB961C, 0x8DFB8E1C, 0x8DFB961C, 0x8DFB8E1C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C,
+0x8E1B8E1C, 0x95FB961C, 0x8E1B961C, 0x95FB961C, 0x95FB9DFC, 0x8E1B961C, 0x8DFB961C, 0x8DFB961C,
+0x8E1C961C, 0x95FB95FC, 0x9DF9961B, 0x6B6CB659, 0x49C65A47, 0xB63A6B8F, 0xD73EA5B9, 0xC69CEFDF,
+0xA65B7CD5, 0x8D77DFBF, 0x8E1B961B, 0x8E1A961B, 0x8E1B961B, 0x8DFC961C, 0x95FB961C, 0x8DFB961B,
+0x8E1B961C, 0x8E1B961C, 0x8E1B961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C,
+0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C,
+0x8DFB961C, 0x8DFB8E1C, 0x8DFB961C, 0x8DFB961C, 0x8DFB95FC, 0x8DFB8DFB, 0x8DFB961C, 0x8DFB8E1C,
+0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB8E1C, 0x8DFB8DFC, 0x8DFB8DFC, 0x8DFB8DFC, 0x8DFB8DFC,
+0x8DFB8DFC, 0x85FB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DDB, 0x85DB85DB, 0x85DB85DB, 0x85DA85DB,
+0x85DB85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBB85BB, 0x7DBA7DBB, 0x7D9A7DBB, 0x7D9A7DBB,
+0x75796D59, 0x757A6D59, 0x757A6D79, 0x757A757A, 0x757A7579, 0x7D9A757A, 0x7D9A757A, 0x7D9A759A,
+0x7D9A759A, 0x7DBB759A, 0x7DBB7D9A, 0x7DBA7D9A, 0x7DBA7D9A, 0x85BB7DBA, 0x85BB7D9A, 0x85DB7DBA,
+0x85BA7DBA, 0x85DB7DBA, 0x85DA7DBA, 0x85DB7DBA, 0x85DB85BA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA,
+0x85DB85DA, 0x85FB85DA, 0x85DB85DA, 0x85FB85DA, 0x85DB85DA, 0x8DFB85DA, 0x85DB85DA, 0x8DFB85DA,
+0x85DB85DA, 0x8DDB85DA, 0x85DB85DB, 0x8DDB85DA, 0x8DDB8DBA, 0x85FC85FB, 0xA65B8DFB, 0x104110E4,
+0x28C20800, 0x30C228A2, 0x49434143, 0x72A84122, 0x20607B09, 0x314428E2, 0x632C4A68, 0xCEFADF5B,
+0xBE38B637, 0xADF89D75, 0x9D76D75D, 0x320908C4, 0x32097C92, 0x29A729C8, 0x21A621A6, 0x19671986,
+0x6C950967, 0x9E1BA65C, 0x8E1B85DA, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB,
+0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8E1B8DFB, 0x8DFB8DFB, 0x8E1B8DFB, 0x8E1B8DFB, 0x8E1B8DFB, 0x8E1B8DFB, 0x961B8DFB,
+0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961C8DFB,
+0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB,
+0x8DFB8DFB, 0x961C8DFC, 0x9DFA95DA, 0xAE5A9E1A, 0x41A56B4C, 0x7BAD5226, 0xDF7EB5F7, 0xBE5BE7BF,
+0xBEFD74B4, 0x9577D79F, 0x8E1B961A, 0x961B8E1B, 0x95FB8DFA, 0x95FC95DB, 0x8E1B8DFB, 0x961B8E1A,
+0x95FB8DFB, 0x961C8DFB, 0x95FB8DFB, 0x95FB8DFB, 0x95FB8DFB, 0x961C8DFB, 0x95FB8DFB, 0x961C8DFB,
+0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x8DFB8DFB, 0x961B8DFB, 0x8E1B8DFB, 0x8E1B8DFB,
+0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961C8DFB,
+0x8DFB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB85DB, 0x8DFB85DB, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA,
+0x85DB7DBA, 0x85DB85BA, 0x85BA7DBA, 0x85BB7DBA, 0x7DBB7DBA, 0x7DBB7DBA, 0x7DBA7D9A, 0x7DBA7D9A,
+0x7579757A, 0x757A757A, 0x757A7D9A, 0x757A7D9A, 0x757A7D9A, 0x7D9A7D9A, 0x7D9A7D9A, 0x7D9A7D9B,
+0x759A7D9A, 0x7D9A7DBB, 0x7D9A7DBB, 0x7DBA85BB, 0x7DBA85BB, 0x7DBA85DB, 0x7DBA85BB, 0x85BB85DB,
+0x7DBA85BB, 0x85BA85DB, 0x85DA85DB, 0x85DA85DB, 0x85DA85DB, 0x85DA85FB, 0x85DA85FB, 0x85DB8DFB,
+0x85DA85FB, 0x85DB8DFB, 0x85DA85FB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85FB8DFB,
+0x8DDB8DFB, 0x8DDB8DFB, 0x85FB8DFB, 0x8DDB8DFB, 0x8DDA95FB, 0x861C8DFC, 0x9E1A8DFB, 0x084131E9,
+0x18610821, 0x30E23924, 0x30A138E2, 0x93ED6A67, 0x20A130E1, 0x20E320A1, 0x845131A6, 0xCEFBCEFB,
+0xCEFBCEDA, 0xADF89D34, 0x1125ADD8, 0x6C11320A, 0x29C829C8, 0x21C73208, 0x19462186, 0x63F12187,
+0x9E3BA65C, 0x8DDA95FB, 0x8DFB961B, 0x8E1B8DFB, 0x8DFB8DFC, 0x8DFB961C, 0x8DFB8DFC, 0x8DFB961C,
+0x8DFB8DFC, 0x8DFB961C, 0x8DFB8DFC, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C,
+0x8DFB961C, 0x8E1B961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8E1B961C, 0x8DFB961C, 0x8E1B961C,
+0x8DFB961C, 0x8E1B961C, 0x8DFB961C, 0x8E1B961C, 0x8DFB961C, 0x8E1B961C, 0x8DFB961B, 0x8E1B961C,
+0x95FB961C, 0x95FB961C, 0x95FB961C, 0x961B961C, 0x95FB961B, 0x961B961C, 0x961B961C, 0x961B961C,
+0x961B963B, 0x961C963D, 0x95FB9DFB, 0x9E1B963C, 0x9491B65A, 0x944E49E5, 0xF7FE7BAD, 0xB619EFBF,
+0xCF5E84D4, 0x9598DF9F, 0x8DFB9E3B, 0x961B963C, 0x95FA961B, 0x95FC9DFC, 0x8E1B961C, 0x961A963B,
+0x95FB961C, 0x961B961C, 0x95FB961C, 0x961B961C, 0x95FB961C, 0x961B961C, 0x95FB961C, 0x961B961C,
+0x8DFB961C, 0x8E1B961C, 0x8DFB961C, 0x8E1B961C, 0x8DFB961C, 0x8E1B961C, 0x8E1B961C, 0x8E1B961C,
+0x8DFB961C, 0x8E1B961C, 0x95FB961B, 0x95FB961C, 0x8DFB961B, 0x95FB961C, 0x8DFB961C, 0x8DFB961C,
+0x8DFB95FC, 0x95FB961C, 0x8DFB95FC, 0x95FB961C, 0x8DFB95FC, 0x95FB961C, 0x8DFB95FC, 0x95FB961C,
+0x8DFB95FB, 0x8DFB961C, 0x8DFB8DFB, 0x8DDB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DA85FB, 0x85DB85DB,
+0x85DB85DB, 0x85DB85DB, 0x85BA85DB, 0x85BA85DB, 0x7DBA85DB, 0x7DBA85DB, 0x7DBA85BB, 0x7DBA85BB,
+0x757A757A, 0x759A757A, 0x7D9A757A, 0x7D7A757A, 0x7D9A7D7A, 0x7D9A757A, 0x7D9A7D7A, 0x7D9A7D7A,
+0x7DBA7D9A, 0x7DBA7D9A, 0x85BB7DBA, 0x85BB7DBA, 0x85BB7DBA, 0x85BA7DBA, 0x85DB85BA, 0x85DB85BA,
+0x85DB85BA, 0x85DB85BA, 0x85DB85BA, 0x85DB85DA, 0x8DDB85DA, 0x85DB85DA, 0x8DFB85DA, 0x8DFB85DA,
+0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DB, 0x8DFB85DA, 0x8DFB85DB, 0x8DFB85DB,
+0x8DFB85DA, 0x8DFB8DDB, 0x8DFB85FB, 0x8DFB85DB, 0x8DDB8DDA, 0x8DFC85FB, 0xA65C85FB, 0x00213A6B,
+0x10400841, 0x5A063102, 0x390130A0, 0x28A030E0, 0x18811840, 0x292418C2, 0xA55552AA, 0xAE18B618,
+0xCEDBADF7, 0xBE598D34, 0x84B384B2, 0x21A76BF0, 0x29E829C7, 0x21A729C7, 0x7C73324A, 0xA61BA5D9,
+0x95FB95FB, 0x961B8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8E1C8DFB, 0x8E1B8DFB, 0x8E1C8DFB, 0x961C8DFB,
+0x961B8DFB, 0x8E1B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB,
+0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8E1B, 0x961B961B, 0x961B8E1B,
+0x961C8DFB, 0x961C8DFB, 0x961C95FB, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B,
+0x961B961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961C961B, 0x963B961B,
+0x963B8E1A, 0x961C8E1B, 0x961C95FC, 0x961C8DFB, 0xAE5A9DFA, 0x8C0D9D54, 0xBD50ACAD, 0xADD7F7FD,
+0xDF9F8D16, 0x9578DF7F, 0x95FB95FA, 0x961C8E1C, 0x961B961A, 0x961C961B, 0x963C8E1C, 0x961B961B,
+0x961C961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961C961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B,
+0x961B961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961B961B, 0x961C8DFB,
+0x961B961B, 0x961B8E1B, 0x961B961B, 0x961B8E1B, 0x961B8DFB, 0x961B8DFB, 0x961C8DFB, 0x961C8DFB,
+0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB,
+0x961B8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB85DA, 0x8DFB85DA, 0x85DB85DA,
+0x8DDB85DA, 0x85DB85DA, 0x85DB85DA, 0x85DB85DA, 0x85DB85BA, 0x85BA7DBA, 0x85DB7DBA, 0x7DBA7DBA,
+0x7D7A7D7B, 0x757A7D7B, 0x7D7A7D9B, 0x7D7A7D9B, 0x7D7A7D9B, 0x7D9A7D9B, 0x7D9A859B, 0x7D9A859B,
+0x7DBA85BB, 0x7DBA85BB, 0x85BB85DB, 0x85BA85DB, 0x85BA85DB, 0x85BA85DB, 0x85DB85DB, 0x85DA85DB,
+0x85DB8DDB, 0x85DB8DDB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x8DFB8DFB, 0x85FB8DFB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8DFB95FB, 0x8DFB8E1C, 0x8DFB8E1C, 0x8DFB95FB, 0x85DB8E1C, 0x961B8DFB, 0x006263B1,
+0x084152CC, 0x62A920A2, 0x49836226, 0x20C128A0, 0x210328E2, 0x318620E3, 0xDF5C8C92, 0x8D34B659,
+0xBE79A5B7, 0x84D28CD3, 0x42AA7C71, 0x29E73A49, 0x32083A08, 0x112531E8, 0xB67B4AED, 0x95DBA61B,
+0x8DFA9E1C, 0x961B961B, 0x961B961B, 0x8DFB963C, 0x8DFB961C, 0x8E1B961C, 0x8E1B961C, 0x8E1B961C,
+0x8E1B961C, 0x8E1B961C, 0x8E1B961C, 0x8E1B961C, 0x8E1B961C, 0x8E1B961B, 0x961B961C, 0x961B961B,
+0x961B961C, 0x8E1B961C, 0x961B961C, 0x8E1B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C,
+0x961B961C, 0x961B961C, 0x961B961C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C,
+0x961B961C, 0x961B961C, 0x961B961C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C,
+0x8E1A963B, 0x961B963B, 0x961C963C, 0x961B963C, 0x95FA9E3C, 0xA574AE19, 0xA48C8389, 0xBDF5CE55,
+0xE79FA576, 0x9558E79F, 0x9E3C9E1C, 0x8DFB9E5D, 0x963B963B, 0x961B963B, 0x961C961D, 0x961B961C,
+0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C,
+0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B961C, 0x961B9E1C, 0x961B961C,
+0x961B963C, 0x961B963C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x8E1B961C,
+0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x95FB961C, 0x95FB961C, 0x95FB961C, 0x95FB961C,
+0x8E1B961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB8DFC, 0x8DFB8DFB, 0x8DFB8E1C, 0x85FB8DFB,
+0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DDB, 0x85BA85DB, 0x85DB85DB, 0x7DBA85DB,
+0x759A757A, 0x7D9A757A, 0x759A757A, 0x7D9B757A, 0x7D9A759A, 0x7D9B7D9A, 0x7D9B7D9A, 0x7DBB7D9A,
+0x7DBA7D9A, 0x85BB7DBA, 0x85BA7DBA, 0x85DB7DBA, 0x85BB7DBA, 0x85DB85BA, 0x85DB85BA, 0x85DB85DA,
+0x8DDB85BA, 0x8DDB85DA, 0x8DDB85DA, 0x8DDB85DA, 0x8DDB85DA, 0x8DFB85DB, 0x8DFB85DA, 0x8DFB8DDB,
+0x8DFB8DDB, 0x8DFB8DDB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x95FB8DFB, 0x8DFC8DFB, 0x8E1B8DFB, 0x95FB8DDA, 0x8E1C8DDB, 0x95FB8E1B, 0x322AA61A,
+0x008321C8, 0x734C0020, 0x520649E6, 0x738C1060, 0x21242123, 0x29862985, 0x84B252EB, 0xCF3CADF7,
+0xA5F8BE9A, 0x74507C92, 0x2A073AAA, 0x31C729C7, 0x216629A6, 0x112510E3, 0xA5FA00A4, 0x95FC95FB,
+0x95FB8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961C8DFB, 0x961C8E1B,
+0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B,
+0x961B8DFB, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B8DFB, 0x961B961B, 0x961B95FB, 0x961B961B,
+0x961B95FB, 0x961C961B, 0x961B95FB, 0x961C961B, 0x961B95FB, 0x961B961B, 0x961B95FB, 0x961B961B,
+0x961B961B, 0x961C961B, 0x961B961B, 0x961C961B, 0x961B961B, 0x963B961B, 0x961B961B, 0x963B961B,
+0x963B8E1A, 0x963B961B, 0x963B8E1A, 0x961B8E1B, 0x9E1B8DFA, 0xA63A961A, 0x83ECB617, 0xDE549C2B,
+0xEFBEBDD4, 0x9D78E75E, 0x963C95FB, 0x9E5C8DFB, 0x8E3B8E3B, 0x961B8E1A, 0x961C95FB, 0x963B961B,
+0x961B961B, 0x963B961B, 0x961B961B, 0x963B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B,
+0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B95FB, 0x961B961B,
+0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961C961B, 0x961B961B, 0x961C95FB,
+0x961B95FB, 0x961B961B, 0x961B8DFB, 0x961B961B, 0x961B8DFB, 0x961C8DFB, 0x95FB8DFB, 0x961C8DFB,
+0x95FB8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x8DFB8DFB, 0x8E1C8DFB, 0x8DFB8DFB, 0x8DFB8DDB,
+0x8DFB85DB, 0x8DFB85DB, 0x85DB85DA, 0x85DB85DA, 0x85DB85BA, 0x85DB85BA, 0x85DB7DBA, 0x85BB7DBA,
+0x757A7D9A, 0x759A7D9B, 0x759A7D9A, 0x7D9A7DBB, 0x7D9A7D9B, 0x7DBA7DBB, 0x7DBA7DBB, 0x7DBB85BB,
+0x7DBA85BB, 0x85BA85DB, 0x85BA85DB, 0x85BA85DB, 0x85BA85DB, 0x85DA85DB, 0x85DA85DB, 0x85DB8DFB,
+0x85DB8DDB, 0x8DDB8DFB, 0x8DDB8DDB, 0x8DDB8DFB, 0x8DDB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB95FC,
+0x8DFB8DFB, 0x8DFB95FC, 0x8DFB95FC, 0x8DFB961C, 0x8DFB95FC, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C,
+0x8DFB961B, 0x95FB961C, 0x8DFB961C, 0x8E1B8E1C, 0x95FB961B, 0x8DFB961C, 0x8DDB961C, 0xAE5B9DDA,
+0xAE5BAE7C, 0x634E9D77, 0x20E339E8, 0x632B18C3, 0x21652145, 0x298631C7, 0xDF9D7C71, 0x9D75ADF7,
+0x9D96ADF8, 0x7CB27451, 0x21A6532D, 0x216631E8, 0x10C32966, 0x19662146, 0x53B11968, 0x961CA63C,
+0x963B961C, 0x8DFB961C, 0x961B963C, 0x8E1B961C, 0x961B961C, 0x961C963C, 0x961B961C, 0x961B963C,
+0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961B, 0x961B963C, 0x961B961B, 0x961B963C,
+0x961B961B, 0x961B963C, 0x961B961B, 0x961B963C, 0x961B961B, 0x961B963C, 0x961B9E1C, 0x961B9E3C,
+0x961B961C, 0x961B9E1C, 0x961B961C, 0x961B9E3C, 0x961B9E1C, 0x961B9E3C, 0x961B9E1C, 0x961B9E3C,
+0x961B963C, 0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x963B9E3C,
+0x963B9E3B, 0x963B963C, 0x963A963B, 0x963B965B, 0x9E3B9E3B, 0x95FA963C, 0xF7FEC6BC, 0x7B28BD31,
+0xFF9CCDB3, 0x9536F79E, 0x961BA63B, 0x8DFAA67D, 0x8E3B965C, 0x9E1B9E3B, 0x961B9E1C, 0x963B9E3C,
+0x961B9E3B, 0x963B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B963C, 0x961B9E3C,
+0x961B9E1C, 0x961B9E3C, 0x961B9E1C, 0x961B9E3C, 0x961B9E1C, 0x961B9E3C, 0x961B9E1C, 0x9E1B9E1C,
+0x961B9E3C, 0x961B9E3C, 0x961B961B, 0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x961B961C,
+0x961B963C, 0x961B963C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x95FB961C, 0x95FB961C,
+0x95FB961C, 0x95FB961C, 0x95FB961C, 0x8E1B961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB8DFC,
+0x85FB8DFB, 0x85FB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB85DB, 0x85DB85DB, 0x85DB85DB, 0x85BA85DB,
+0x7D9A757A, 0x7D9A759A, 0x7D9A7D9A, 0x7D9A7D9A, 0x85BA7D9A, 0x85BA7D9A, 0x85BB7DBA, 0x85BB7DBA,
+0x85BB7DBA, 0x85DB7DBA, 0x85DB85BA, 0x85DB85BA, 0x85DB85DA, 0x85DB85DA, 0x8DFB85DA, 0x8DFB85DA,
+0x8DFB85DB, 0x8DFB85DA, 0x8DFB8DDB, 0x8DFB8DDA, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8E1B8DFB,
+0x961B8DFB, 0x8E1B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB, 0x961C8DFB, 0x961B8DFB,
+0x961B8E1B, 0x95FC8DFB, 0x961C8DFC, 0x8E1B8E1B, 0x9E1B8DDA, 0x963C8DDA, 0x9E3C8DDB, 0x9E1B961B,
+0x9E3C95FB, 0xAE3B9DFA, 0xBE5AB65A, 0x636D10E4, 0x29C7532C, 0x29E829E7, 0x7C718CF3, 0xADF79D95,
+0x9DB7AE18, 0x534D536E, 0x4AEC3249, 0x298721A7, 0x18C431C8, 0x21872987, 0x328C1987, 0x8DFBA69C,
+0x961B8DFB, 0x963C961B, 0x95FB961B, 0x9E3C8DFB, 0x961C8E1B, 0x961B8E1B, 0x961C8E1B, 0x961B8E1B,
+0x961C961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B,
+0x963B961B, 0x963B961B, 0x963B961B, 0x963B961B, 0x963B961B, 0x963B961B, 0x963C961B, 0x963B961B,
+0x963B961B, 0x963B961B, 0x963C961B, 0x963B961B, 0x963C961B, 0x963B961B, 0x963C961B, 0x963B961B,
+0x963C961B, 0x963B961B, 0x963C961B, 0x963B961B, 0x963C961B, 0x963B961B, 0x963B961B, 0x9E3B963B,
+0x9E3B961B, 0x963B963B, 0x963B961B, 0x965B8E3B, 0x961B961A, 0x9E1B963B, 0xEFDFBEBC, 0xACF3DEFB,
+0x83094943, 0xA596E6DA, 0x9E3CA61A, 0x9E3C95FB, 0x963B963B, 0x9E1B961B, 0x9E3C9E1C, 0x963B963B,
+0x9E3B961B, 0x963B961B, 0x9E3B961B, 0x963B961B, 0x9E3B963B, 0x9E3B963B, 0x9E3B961B, 0x9E3B963B,
+0x9E3B961B, 0x963B961B, 0x9E3B961B, 0x963B961B, 0x9E3B961B, 0x9E1B961B, 0x9E1B9E1B, 0x9E3B9E1B,
+0x9E3B961B, 0x963B961B, 0x963B961B, 0x963B961B, 0x963C961B, 0x963B961B, 0x963B961B, 0x963C961B,
+0x963B961B, 0x963B961B, 0x961B961B, 0x961B961B, 0x961C961B, 0x961B961B, 0x961C961B, 0x961B8E1B,
+0x961B95FB, 0x961C95FB, 0x961C95FB, 0x961B8DFB, 0x961C8DFB, 0x961C8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8DFB85FA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB85DA, 0x85DB85DA, 0x8DDB85DA, 0x85DB85DA,
+0x7D9A7D9A, 0x7D9A7D9A, 0x7D9A859A, 0x7D9A85BA, 0x7D9A85BA, 0x85BA85BA, 0x85BA85DB, 0x85BA85DB,
+0x85DB85DB, 0x85DB85DB, 0x85DB8DDB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85FB8DFB,
+0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB95FC, 0x8DFB8DFB, 0x8DFB961C, 0x8DFB961B, 0x8DFB961C, 0x8E1B961C,
+0x8E1B961C, 0x8E1B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x961B961C,
+0x961B963B, 0x95FB961C, 0x8E1C961C, 0x8E1B963C, 0x95FB9E3C, 0x961B961B, 0x8DFB963C, 0x961B963B,
+0x8DFC963D, 0x961B961C, 0xAE7BA61B, 0x29E829E9, 0x3A695B4D, 0x3A6A29C7, 0xCEFBA5B6, 0xBE79E79D,
+0x84D36BEF, 0x7CB2532D, 0x4B0DA5F8, 0x31E921A8, 0x190631A8, 0x218731C8, 0x01472A09, 0x963BA69C,
+0x961B9E3C, 0x961B963C, 0x961B961C, 0x961B9E3C, 0x961B963C, 0x961B963C, 0x961B963C, 0x961B963B,
+0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x963B9E3C, 0x963B9E3C,
+0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C,
+0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C,
+0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C,
+0x9E1C9E3C, 0x963B9E3C, 0x965B9E5C, 0x963B965B, 0x9E3B9E5B, 0x9E1A9E3C, 0xE7DFC6DD, 0xB5D8BE7B,
+0x6206E678, 0x9C916A89, 0xB619C659, 0x9E1BAE1B, 0x963B9E5C, 0x9E1B9E3B, 0x963C9E3C, 0x963B9E3C,
+0x9E3B9E5C, 0x963B9E5C, 0x963B9E3C, 0x963B9E3C, 0x9E3B9E5C, 0x963B9E5C, 0x963B9E3C, 0x963B9E3C,
+0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x9E3B9E3C, 0x9E3B9E3C, 0x9E3BA63C, 0x9E3BA63C,
+0x9E3B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3B, 0x963B9E3C, 0x963B9E3C, 0x961B9E3C, 0x961B963C,
+0x963B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C, 0x961B9E3C, 0x961B963C,
+0x961B9E3C, 0x961B961C, 0x961B961C, 0x95FB961C, 0x961B961C, 0x8E1B961C, 0x8DFB961C, 0x8DFB961C,
+0x8DFB95FB, 0x8DFB8E1B, 0x8DFB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85DB8DFB, 0x85DB8DFB, 0x85DB8DFB,
+0x7D9A7D9A, 0x7D9A7D9A, 0x7D9A7D99, 0x85BA7D9A, 0x85BA7D9A, 0x85BB85BA, 0x85BA85BA, 0x85DB85BA,
+0x85DB85BA, 0x85DB85DB, 0x85DB85DA, 0x85DB85DA, 0x8DFB85DA, 0x8DFB85DB, 0x8DFB85DB, 0x8DFB8DFB,
+0x8DFB8DFB, 0x8E1B8DFB, 0x8DFB8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8E1B,
+0x961B8E1B, 0x963B961B, 0x961B8E1B, 0x963B8E1B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B,
+0x963B8E1A, 0x9E1C961B, 0x961C961B, 0x963B8E1B, 0x961B961A, 0x961B961B, 0x961C961B, 0x963C961B,
+0x8E1C8E1B, 0x965C8E3C, 0xA63B961B, 0x2A095BD0, 0x29E83A69, 0xE79E530C, 0xADF7DF7D, 0x29C7428A,
+0xA5D79D75, 0x957663CF, 0x21C8430C, 0x320A29E9, 0x19262167, 0x29C83209, 0x118821C8, 0x9E5C8577,
+0x961B961B, 0x9E3C961B, 0x961B8DFA, 0x961B961B, 0x963B961B, 0x963B961B, 0x963B961B, 0x963C961B,
+0x963C961B, 0x963C961B, 0x963C961B, 0x9E3C963B, 0x961B961B, 0x963C961B, 0x963C961B, 0x963C961B,
+0x963B961B, 0x963C961B, 0x963C961B, 0x9E3C963B, 0x963C961B, 0x9E3C963B, 0x9E3C961B, 0x9E3C963B,
+0x963B961B, 0x9E3C963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3C963B, 0x9E3B963B, 0x9E3C963B,
+0x9E3B963B, 0x9E3C963B, 0x9E3B963B, 0x9E3C963B, 0x9E3B963B, 0x9E3C963B, 0x9E3B963B, 0x9E3C963B,
+0x9E1C9E1C, 0x9E3C9E1B, 0x965C963B, 0x9E5B963B, 0x9E1B9E1B, 0x9E1B9E1B, 0xE7DFC6DD, 0xA619A63A,
+0xFFBECEDB, 0x61A6832C, 0xDDB59B2A, 0xAE1BC619, 0x961B9E3B, 0x9E5C9E3B, 0x9E7C8E1A, 0x9E3B9E1A,
+0x9E3B963B, 0x9E5B963B, 0x9E3B963B, 0x9E5B963B, 0x9E3B963B, 0x9E5B963B, 0x9E3B963B, 0x9E5B963B,
+0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B961B, 0x9E3B9E3B, 0x9E3B9E3B, 0x9E3B9E3B,
+0x9E3B9E3B, 0x9E3B9E3B, 0x963B961A, 0x9E3B961B, 0x9E3B961B, 0x9E3B963B, 0x9E3B961B, 0x9E3B963B,
+0x963B961B, 0x9E3B961B, 0x963B961B, 0x963B961B, 0x961B95FB, 0x961B961B, 0x961B961B, 0x961B961B,
+0x961C961B, 0x961C961B, 0x961B961B, 0x961C961B, 0x961B961B, 0x961C95FB, 0x95FB8DFB, 0x961C8DFB,
+0x961B8DFB, 0x8DFB8DFB, 0x8DFB8DDB, 0x8DFB8DFB, 0x8DFB85DA, 0x8DFB85DB, 0x8DDB85DA, 0x85DB85DA,
+0x7D9A859A, 0x7D9A859A, 0x7D9A85BA, 0x85BA85BB, 0x85BA85BB, 0x85DB8DDB, 0x85BA8DDB, 0x85DB8DDB,
+0x85DA85DB, 0x85DB8DFB, 0x85DB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFC, 0x8DFB8DFC, 0x8DFB961C,
+0x8DFB961B, 0x8E1B961B, 0x8E1B961B, 0x961B961C, 0x961B961C, 0x963B963C, 0x963B963C, 0x963B963C,
+0x963B963C, 0x963B963C, 0x963B963C, 0x963B963C, 0x961B9E3C, 0x963B9E3C, 0x961B9E3C, 0x963B9E3C,
+0x963B9E3B, 0x961C9E3C, 0x961B9E3C, 0x963B963C, 0x961B9E3B, 0x963B9E3C, 0x963B9E3C, 0x963C9E3C,
+0x963C963C, 0x961B963C, 0x9E3B9E5C, 0x4B0DA63B, 0x74303A6A, 0xBE38D71C, 0x6C1084B3, 0xCEFBB618,
+0x9D96CEFB, 0x536D63AE, 0x2209326A, 0x7C73322A, 0x11051947, 0x29E831E9, 0x11882A0A, 0x9E5B7CF6,
+0x963B9E5C, 0x961B961B, 0x961B9E5C, 0x9E3B9E5C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C,
+0x963B9E3C, 0x963C9E3C, 0x963B963C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C,
+0x963B9E3C, 0x963C9E5C, 0x963B9E3C, 0x963C9E5C, 0x963B9E3C, 0x963C9E5C, 0x963B9E3C, 0x963B9E5C,
+0x963B9E3C, 0x9E3B9E5C, 0x963B9E5C, 0x963B9E5C, 0x963B9E3C, 0x963B9E5C, 0x963B9E3C, 0x963B9E5C,
+0x963B9E3C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3C9E5C,
+0x9E1C9E3D, 0x9E3BA63C, 0x965B9E5C, 0x9E3B9E5C, 0x9E1BA63B, 0x9E1B9E3C, 0xDFDFCEFD, 0x9E1AA65B,
+0xF79EC6FC, 0xABEFFFBF, 0x72067185, 0xBE3A9C51, 0x9E5BAE5B, 0x9E1BA65C, 0x963B9E7C, 0xA63B9E3B,
+0x9E3B9E5B, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C,
+0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E3C, 0x9E3B9E3C, 0x9E3BA63C, 0x9E3BA63C,
+0x9E3B9E3C, 0x9E3B9E3C, 0x961B9E3B, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x961B9E3C, 0x9E3B9E3C,
+0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x963B9E3C, 0x961B9E1C, 0x961B9E3C, 0x961B9E1C, 0x961B9E3C,
+0x961B9E1C, 0x961B9E3C, 0x95FB961C, 0x961B961C, 0x961B961C, 0x961B961C, 0x95FB961C, 0x961B961C,
+0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB961C, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DDB8DFB, 0x85DB8DFB,
+0x85BA7D9A, 0x85BB7D9A, 0x85BB85BA, 0x85DB85BA, 0x85DB85BA, 0x85DB85DA, 0x8DDB85DA, 0x85DB85DA,
+0x8DFB85DB, 0x8DFB85DB, 0x8DFB8DFB, 0x8E1B8DFB, 0x8E1B8DFB, 0x8E1B8DFB, 0x961B8DFB, 0x961B8DFB,
+0x961B8E1B, 0x963B8E1B, 0x963B961B, 0x963B961B, 0x963B961B, 0x963B963B, 0x9E3C963B, 0x9E3B963B,
+0x9E5B963B, 0x9E5B963B, 0x9E5B963B, 0x9E5B963B, 0x9E5B963B, 0x9E5B963B, 0x9E5B963B, 0x9E5B963B,
+0x9E5B963B, 0x9E3C963B, 0x9E5C9E3B, 0x9E5B963B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5C963C,
+0x9E3B9E3B, 0x9E5B9E5C, 0xA65B9E1A, 0x8D56A65A, 0xBE59ADF8, 0xB5F69D54, 0xC6DABE58, 0xBE7ACF1C,
+0xA5968CD3, 0x42AA4B0B, 0x42EC21E7, 0x19469576, 0x426B29C8, 0x21A88CF4, 0x21C92A0A, 0xAE7D5391,
+0x963B961B, 0x963B9E5B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B,
+0x9E5C963B, 0x9E3C963B, 0x9E3C963B, 0x9E3C963B, 0x9E3C963B, 0x9E3B963B, 0x9E5C963B, 0x9E5C963B,
+0x9E5C963B, 0x9E5C963B, 0x9E5C963B, 0x9E5C963B, 0x9E5C963B, 0x9E5C963B, 0x9E5C963B, 0x9E5C963B,
+0x9E5C963B, 0x9E5B963B, 0x9E5C9E3B, 0x9E5B963B, 0x9E5B9E3B, 0x9E5B963B, 0x9E5B963B, 0x9E5B963B,
+0x9E3B9E3B, 0x9E5B963B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5C9E3B,
+0x9E5C963C, 0x9E5B9E3B, 0x9E5C9E3C, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E1A9E3C, 0xE7BFCF1C, 0x9E3B9E1A,
+0xEF9FCEFD, 0xBD77E73E, 0x8BB0C577, 0x62AC6AAB, 0xBE5C94F5, 0xA63CA5FB, 0x9E9C9E3B, 0x963B965C,
+0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B,
+0x9E5C9E3B, 0x9E5B963B, 0x9E5C9E3B, 0x9E5B963B, 0x9E5B9E3B, 0x9E3B9E3B, 0xA63B9E3B, 0xA63B9E3B,
+0xA63B9E3B, 0x9E3B9E3B, 0x9E3B9E3B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B963B, 0x9E3B9E3B,
+0x9E3B963B, 0x9E3B963B, 0x9E3B961B, 0x9E3B961B, 0x9E3B961B, 0x9E3B961B, 0x9E1B961B, 0x9E3B961B,
+0x961B961B, 0x961B961B, 0x961B961B, 0x961B95FB, 0x961B961B, 0x961B95FB, 0x961B95FB, 0x961B8DFB,
+0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x8DFB8DFA, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB8DFB, 0x8DFB85DA,
+0x7DBA85BB, 0x85BA85BB, 0x85BA85DB, 0x85DB85DB, 0x85FB8DFB, 0x85FB8DFB, 0x8DFB8DFB, 0x85FB8DFB,
+0x8DFB8E1B, 0x8DFB961B, 0x8DFB961B, 0x8DFB961B, 0x961B961C, 0x961B961B, 0x961B961B, 0x961B963B,
+0x961B9E3C, 0x963B963B, 0x963B9E3C, 0x963B9E3C, 0x963B9E5C, 0x965B9E5C, 0x9E5B9E5C, 0x9E5B9E5C,
+0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5CA65C, 0x9E5BA65C,
+0x9E5BA67C, 0x9E5CA65C, 0x9E5CA65C, 0x9E5BA65C, 0x9E5CA65C, 0x9E5BA65C, 0x9E5CA67C, 0x9E5C9E5C,
+0xA65BA65C, 0xA65BA65B, 0xA65BA65B, 0xCF3EAE5B, 0xC679CEFC, 0xC698CE99, 0xC6B9C678, 0x7431A5B7,
+0x84919D75, 0x5BAE3A49, 0xB67984D3, 0x29E81146, 0x6C113229, 0x3A6ABE5A, 0x2A0A322B, 0xAE9D21EB,
+0x9E5CA67D, 0x9E5B9E5C, 0x9E3B9E5C, 0x9E3B9E3B, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C,
+0x9E5C9E5C, 0x9E5B9E5C, 0x9E5C9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C,
+0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5BA65C, 0x9E5B9E5C, 0x9E5BA65C, 0x9E5B9E5C,
+0x9E5B9E5C, 0x9E5B9E5C, 0x9E5BA65C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E3B9E5C,
+0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E5BA65C, 0x9E5B9E5C, 0x9E5BA65C, 0x9E5B9E5C,
+0x9E5B9E5C, 0x9E5B9E5B, 0x9E3C9E5C, 0x9E3BA65C, 0x9E5BA65C, 0x9E1A9E5C, 0xDF9ED75D, 0x9E3BA63A,
+0xEFBFCEDD, 0xA577E79F, 0xBE3ABE1B, 0xCE59D65A, 0x8474A557, 0xB65CADDA, 0x963AA63B, 0x9E5C9E5C,
+0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E5C,
+0x9E3B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E3B9E5C, 0x9E5BA65C, 0x9E3BA65C, 0x9E3BA65C, 0xA63BA65C,
+0xA63BA65C, 0x9E3BA63C, 0x9E3BA65C, 0x9E3BA65C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3BA65C, 0x9E3B9E5C,
+0x9E3B9E3C, 0x9E3B9E3B, 0x9E3B9E3C, 0x963B9E3C, 0x9E3B9E5C, 0x963B9E3C, 0x961B9E3C, 0x963B9E3C,
+0x961B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B9E1C, 0x961B961C, 0x961B961C, 0x961B961C,
+0x95FB961B, 0x961B961B, 0x8DFB961B, 0x8DFB961B, 0x8DFB961C, 0x8DFB961B, 0x8DFB8E1B, 0x8DFB8E1B,
+0x85BA7D9A, 0x85DA85BA, 0x85DA85BA, 0x8DFB85DA, 0x8DFB85DA, 0x8DFB8DFA, 0x8DFB8DFA, 0x8DFB8DFA,
+0x8DFB8DDA, 0x961B8DFA, 0x961B8DFA, 0x961B95FB, 0x961B95FA, 0x963B961B, 0x963B961B, 0x9E3B961B,
+0x9E3B963B, 0x9E5B963B, 0x9E5B963B, 0x9E5B9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E7C9E5B,
+0x9E7C9E5B, 0x9E7C9E5B, 0x9E7C9E5B, 0xA67C9E5B, 0x9E7C9E5B, 0xA67C9E5B, 0x9E7C9E5B, 0xA67C9E5B,
+0x9E7C9E5B, 0xA67C9E5C, 0xA67C9E5B, 0xA67CA65B, 0x9E5C9E5B, 0xA67C9E5B, 0xA65C9E5B, 0xA65C9E5B,
+0xA65C9E3B, 0xA65BA65B, 0xA63BA65B, 0xBE9BA63A, 0xD71BBE9A, 0xC698CED9, 0x84D2A5B5, 0xD73C9554,
+0x428A84D2, 0xB6586C0F, 0x3AAA9DB6, 0x320919A7, 0x6BF02A08, 0x530DDF9E, 0x21A94B0D, 0x957919AA,
+0x9E5C9E3B, 0x9E5B961B, 0x9E3B9E5B, 0x9E5C9E5B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B,
+0x9E5C9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E5C9E5B, 0x9E5C9E3B, 0x9E5C9E5B, 0x9E5C9E3B, 0x9E5C9E5B,
+0x9E5C9E5B, 0x9E5C9E5B, 0x9E5C9E3B, 0x9E5C9E5B, 0x9E5C9E3B, 0xA65C9E5B, 0x9E5C9E3B, 0xA65C9E5B,
+0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E5C9E3B,
+0x9E3B9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B,
+0x9E5B9E3B, 0x9E5B9E5B, 0x9E5C965B, 0xA65C9E3B, 0x9E5B9E3B, 0xA61A9E5B, 0xDF5ED75D, 0xA63B9E1A,
+0xE79ED73D, 0x9D77DF7F, 0xA63BA63B, 0xAE5AA63A, 0xBE7BA63A, 0x9D156B6E, 0xA63AB67B, 0xA65CA65B,
+0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E5B9E3B,
+0x9E5C9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E5C9E3B, 0x9E5B9E3B, 0x9E3B9E3B, 0xA63B9E3B, 0xA65CA63B,
+0xA63BA63B, 0xA65B9E3B, 0x9E3B9E3B, 0x9E5C9E3B, 0x9E3B9E3B, 0x9E5C9E3B, 0x9E3C9E3B, 0x9E5B9E3B,
+0x9E5C9E3B, 0x9E5C9E3B, 0x9E3B9E3B, 0x9E5C9E3B, 0x9E3B9E3B, 0x9E3B9E3B, 0x9E3B961B, 0x9E3B9E3B,
+0x9E3B961B, 0x9E3B963B, 0x963B961B, 0x9E3B961B, 0x963B961B, 0x961B961B, 0x961B95FB, 0x961B961B,
+0x961B8DFA, 0x961B961B, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x961B8DFB, 0x8DFB8DFB, 0x8DFB8DFB,
+0x8DDA8DDB, 0x8DFA95FB, 0x8DFA95FB, 0x961B961B, 0x8DFA95FB, 0x961A961B, 0x961A961B, 0x961A961B,
+0x961A961B, 0x961B9E1B, 0x961B9E1B, 0x9E1B9E3B, 0x9E1B9E3B, 0x9E3B9E3B, 0x9E3B9E3B, 0x9E3B9E3B,
+0x9E3B9E5C, 0x9E5B9E5C, 0x9E5B9E5C, 0x9E5BA65C, 0x9E5BA65C, 0x9E7CA67C, 0x9E5BA67C, 0x9E7CA67C,
+0x9E7BA67C, 0xA67CA67C, 0xA67BA67C, 0xA67CA69C, 0xA67BA67C, 0xA67CAE7C, 0xA67CA67C, 0xA67CAE7C,
+0xA67CA69C, 0xA67CA69C, 0xA67BA67C, 0xA67CAE7C, 0xA67CA67C, 0xA67CA69D, 0xA67BA69C, 0xA67CAE7C,
+0xA65BAE9D, 0xA65BAE9C, 0xAE7BA67C, 0xCF3DB69C, 0xADD7BE7A, 0x951294F3, 0xCF1BADF6, 0x5B6DC6BA,
+0xCEFB5B4D, 0x532CDF7D, 0x29E77C72, 0x4AEC29C8, 0x8D1429C8, 0x5B8E9D96, 0x42CC7431, 0x63D21948,
+0x961BB6DE, 0x9E7CA69D, 0x9E5BA65C, 0x9E5BA69C, 0x9E5BA65C, 0x9E5CA67C, 0x9E5BA65C, 0x9E5CA67C,
+0x9E5BA65C, 0x9E5CA65C, 0x9E5BA65C, 0xA65CA67C, 0x9E5BA65C, 0xA65BA67C, 0x9E5BA65C, 0xA65BA67C,
+0x9E5BA65C, 0xA65BA67C, 0x9E5BA65C, 0xA65BA67C, 0x9E5BA65C, 0xA65BA65C, 0x9E5BA65C, 0xA65CA65C,
+0x9E5BA65C, 0x9E5CA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5CA65C, 0x9E5BA65C, 0x9E5CA65C,
+0x9E5BA65C, 0x9E5CA65C, 0x9E5BA65C, 0x9E5CA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C,
+0x9E5BA65C, 0x9E5BA67B, 0x9E5B9E5C, 0x9E5BA65C, 0x9E5BA65C, 0xA63AA67C, 0xD71DDF7F, 0xA65BAE3B,
+0xE79ED73D, 0x9DB8E79F, 0x9E5BAE7C, 0x9E5BA67C, 0xAE3AA65C, 0x2105C63A, 0xB65BA556, 0xA65BA61B,
+0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E3BA65C, 0x9E5BA65C,
+0x9E3BA65C, 0x9E5BA65C, 0x9E3BA65C, 0x9E5BA65C, 0x9E3BA65C, 0xA63BA65C, 0xA63BA65C, 0xA65BA65C,
+0xA63BAE5C, 0xA63BA65C, 0xA63BA65C, 0x9E5BA65C, 0x9E3BA65C, 0x9E5CA65C, 0x9E3BA65C, 0x9E5BA65C,
+0x9E5BA65C, 0x9E5CA65C, 0x9E3BA65C, 0x9E5BA65C, 0x9E3BA65C, 0x9E3BA65C, 0x9E3B9E5C, 0x9E3BA65C,
+0x9E3B9E5C, 0x9E3B9E5C, 0x963B9E3C, 0x963B9E3C, 0x961B9E3B, 0x961B9E3C, 0x961B9E1C, 0x961B9E3C,
+0x961B961B, 0x961B963C, 0x961B961C, 0x961B961C, 0x8DFB961B, 0x8E1B961C, 0x8DFB961C, 0x8DFB961C,
+0x9E1B9DFA, 0x9E3B9E1A, 0xA63B9E1B, 0xA63B9E1B, 0xA65BA63B, 0xA65B9E3B, 0xA65BA63B, 0xA65BA63B,
+0xA65C9E3B, 0x9E5B9E3B, 0xA65C9E3B, 0x9E3B9E3B, 0xA65B9E3B, 0xA65B9E3B, 0xA65B9E5B, 0xA65B9E3B,
+0xA67C9E5B, 0xA65C9E5B, 0xA67C9E5B, 0xA67CA65B, 0xA67CA65B, 0xA67CA65B, 0xA67CA67B, 0xA67CA67B,
+0xA69CA67C, 0xA69CA67C, 0xAE9CA67C, 0xAE9CA67C, 0xAE9CA67C, 0xAE9CA67C, 0xAE9CA67C, 0xAE9CA67C,
+0xAE9CA69C, 0xA69CA67C, 0xAE9CA67B, 0xAE7CAE7B, 0xA69DA67C, 0xA69CA67C, 0xAE9CA69B, 0xAE7CAE7C,
+0xAE9CA65B, 0xAEBD9E7B, 0xA67BA6BC, 0xD75EAE7A, 0xADF79535, 0xBE99AE37, 0xADF7BE99, 0xBE598491,
+0xC6DBD75C, 0x5B6E3A69, 0x11259535, 0x74316BF0, 0xBE791966, 0x95349534, 0xB65AC6DB, 0x19A95B6F,
+0xA67CB6DD, 0xA69C9E7C, 0xA67CA67C, 0xA67C9E3B, 0xA67CA67B, 0xA67CA65B, 0xA67CA67C, 0xA67CA65C,
+0xA67CA65C, 0xA67CA65C, 0xA67CA65C, 0xA67CA65B, 0xA67CA65B, 0xA67CA65B, 0xA67CA65B, 0xA67CA65B,
+0xA67CA65B, 0xA67CA65B, 0xA67CA65B, 0xA67BA65B, 0xA67CA65B, 0xA67CA65B, 0xA67CA65B, 0xA65CA65B,
+0xA67CA65B, 0xA67CA65B, 0xA67CA65B, 0xA65CA65B, 0xA65CA65B, 0xA65CA63B, 0xA65CA65B, 0xA65CA63B,
+0xA65CA65C, 0xA65C9E5B, 0xA65CA65B, 0xA65C9E5B, 0xA65CA65B, 0xA65C9E5B, 0xA65CA65B, 0xA65C9E5B,
+0xA65C9E5B, 0xA65C9E5B, 0xAE5CA63B, 0xA65CA63C, 0xA67C9E5B, 0xA65A9E5B, 0xCEFDDF9F, 0xAE5BA63A,
+0xEFDFD71C, 0x9D97E77E, 0xAE7CA63A, 0xAE5D9E1B, 0xAE7CA63B, 0x8432B65B, 0xD6BB39A7, 0xA65BAE5B,
+0xA65CA65B, 0xA65C9E3B, 0xA65C9E5B, 0xA65C9E3B, 0xA65C9E5B, 0xA65C9E3B, 0xA65C9E5B, 0xA65C9E3B,
+0xA65CA63B, 0xA65C9E3B, 0xA65C9E3B, 0xA65C9E3B, 0xA65C9E3B, 0xA65B9E3B, 0xA65CA63B, 0xAE5CA63B,
+0xA65BA63B, 0xA65BA63B, 0xA65CA63B, 0xA65C9E3B, 0xA65C9E3B, 0xA65C9E3B, 0xA65C9E3B, 0xA65CA63B,
+0xA65C9E5B, 0xA65C9E3B, 0xA65C9E5B, 0xA65C9E3B, 0xA65C9E5B, 0xA65C9E3B, 0xA65C9E5B, 0x9E5C9E3B,
+0x9E5C9E3B, 0x9E5B9E3B, 0x9E5B9E3B, 0x9E3B963B, 0x9E3C963B, 0x9E3B963B, 0x9E3B961B, 0x963B961B,
+0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B961B, 0x961B8E1B, 0x961B8DFB, 0x8E1B8DFB,
+0xA63BAE3B, 0xA63BAE3B, 0xAE3BAE5B, 0xAE3BAE3B, 0xAE3BAE5B, 0xAE3BAE5B, 0xAE5BB65B, 0xAE5BAE5B,
+0xAE7CAE7C, 0xAE7CAE7C, 0xAE7CAE7C, 0xAE7BAE7C, 0xAE7BAE7C, 0xAE5BAE7C, 0xAE7BB67C, 0xAE7BAE7C,
+0xAE7CAE7C, 0xA67CAE7C, 0xAE7CAE7C, 0xAE7CAE7C, 0xAE7CAE7C, 0xA67CAE7C, 0xAE7CAE9C, 0xAE7CAE9C,
+0xAE7CAE9C, 0xAE7CAE9C, 0xAE7CAE9C, 0xAE7CAE9C, 0xAE9CAE9C, 0xAE7CAE9C, 0xAE9CAE9C, 0xAE7CAE9C,
+0xAE9CAE9C, 0xAE9CAE9D, 0xAE9BAEBC, 0xAE7CAE9C, 0xAE9DAE9D, 0xAE9CAEBD, 0xAE9CAEBC, 0xAE9CB69C,
+0xAEBCB6BD, 0xA69CAEDD, 0xAEBCAEDD, 0xBE9AB69B, 0xCEFBB618, 0xB658AE18, 0xBE9AB638, 0xA596CEDB,
+0x84D37430, 0x8D144B0C, 0x1145532D, 0x3A49CEDB, 0xEFDF636E, 0x42AA7410, 0x74317C51, 0x324AB639,
+0xBF3E6C53, 0xA67CAE9C, 0xAE9CAE9C, 0xA67CAE7C, 0xA67CAE9C, 0xA67CAE9C, 0xA67CAE9C, 0xA67CAE7D,
+0xAE7CAE9D, 0xAE7CAE7C, 0xAE7CAE7C, 0xA67CAE7C, 0xAE7CAE7C, 0xAE7BAE7C, 0xAE7BAE7C, 0xAE7BAE7C,
+0xAE7CAE9C, 0xAE7BAE9C, 0xAE7CAE9C, 0xAE7BAE9C, 0xAE7BAE9C, 0xAE7BAE7C, 0xAE7BAE7C, 0xAE7CAE7C,
+0xA67CAE7C, 0xA67BAE7C, 0xA67CAE7C, 0xA65CAE7C, 0xA67CAE7C, 0xA65CAE7C, 0xA65CAE7C, 0xA65CAE5C,
+0xA65CAE7C, 0xA65BA67C, 0xA67CA67C, 0xA65BA67C, 0xA67CA67C, 0xA65BA67C, 0xA67CAE7C, 0xA65CAE7C,
+0xA65CAE7C, 0xA65CA67C, 0xAE5CAE7C, 0xA65CAE5D, 0xA67CA67C, 0xA65AA67C, 0xC6DCE7BF, 0xAE3AAE5B,
+0xE77EDF5E, 0xA597E77E, 0xAE7CB67C, 0xA65CAE7D, 0xA65BAE7D, 0xC6BCB67C, 0x94315209, 0xA65CBE7B,
+0xA65CAE5C, 0xA65CA65C, 0xA65CA67C, 0xA65CA65C, 0xA65CA67C, 0xA65CA65C, 0xA65CA67C, 0xA65BA65C,
+0xA65CA65C, 0xA65BA65C, 0xA65CA65C, 0xA65BA65C, 0xA65BA65C, 0xA65BA65C, 0xA63BAE5C, 0xA65BAE5C,
+0xA63BAE5C, 0xA63BAE5C, 0xA65BAE5C, 0xA65BA65C, 0xA63BA65C, 0xA65BA65C, 0xA65CA65C, 0xA65BA65C,
+0xA65CA67C, 0xA65BA65C, 0xA65BA67C, 0xA65BA65C, 0xA65CA65C, 0xA65BA65C, 0xA65CA65C, 0x9E5BA65C,
+0x9E5BA65C, 0x9E5BA65C, 0x9E5BA65C, 0x9E5C9E5C, 0x9E3C9E5C, 0x9E3B9E5C, 0x9E3B9E5C, 0x9E3B9E3C,
+0x963B9E3C, 0x963B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B9E3C, 0x961B963C, 0x961B963C, 0x8E1B961C,
+0xAE3BAE1A, 0xB65BAE3B, 0xAE3AAE3A, 0xB65BAE3A, 0xB65BB65B, 0xB65BB65B, 0xB65BAE5A, 0xB67BB65B,
+0xB67BAE5B, 0xB67CB67B, 0xB65BA61A, 0xB69CB67B, 0xBE7CB67B, 0xBE7CB67B, 0xBE9CB67B, 0xB69CB67B,
+0xB69CAE7B, 0xB69CB67C, 0xB69CB69B, 0xB69CAE9B, 0xB69CAE7B, 0xB69CAE9B, 0xAE9CAE7B, 0xB69CAE7B,
+0xB69CAE9B, 0xB69CAE9C, 0xB69CAE7B, 0xAE9CAE7B, 0xAE9CAE7B, 0xAE9CAE9C, 0xAE9CAE7B, 0xAE9CAE9C,
+0xAE9CAE7B, 0xAE9CAE9C, 0xAE9CAE9B, 0xB69CAE9C, 0xAE9CAE7C, 0xAEBCAE9C, 0xAE9CAE9C, 0xB6BCAE9C,
+0xAEBCAE9C, 0xAEBCAEBC, 0xB6BCAE9C, 0xC6FCB69B, 0xDF7DD75D, 0xDF5CD71C, 0x9D75BE99, 0xB6389555,
+0x6BEFBE99, 0x849242CB, 0x6BEF21A6, 0x19659D95, 0xE79EC6BA, 0xDF5D3A49, 0x11047450, 0x6BF03229,
+0x534F2A4A, 0xAE9CBEDD, 0xAEBCAE7B, 0xAE9CAE9C, 0xAE9CA67C, 0xAE9CAE9C, 0xAE9CA67C, 0xAE9CAE9C,
+0xAE9CAE7B, 0xAE9CAE7B, 0xAE9CAE7B, 0xAE9CAE9C, 0xAE9CAE7B, 0xAE9CAE9C, 0xAE9CAE9C, 0xAEBCAE9C,
+0xAE9CAE9B, 0xAE9CAE9C, 0xAE9CAE9B, 0xAE9CAE9B, 0xAE9CAE9B, 0xAE9CAE9B, 0xAE9CAE7B, 0xAE9CAE7B,
+0xAE7CA67B, 0xAE9CA67B, 0xAE7CA65B, 0xAE7CA67B, 0xAE7CA65B, 0xAE7CA65C, 0xAE7CA65B, 0xAE7CA65C,
+0xA67CA67B, 0xAE7CA67B, 0xA67CA65B, 0xA67CA65B, 0xAE7CA67B, 0xAE7CA67C, 0xA67CA65B, 0xAE7CA65B,
+0xA67CA65B, 0xA69CA67C, 0xAE5CA65B, 0xAE7CAE5C, 0xA67CA67B, 0xAE7BA67B, 0xC6BDDF9F, 0xB67BAE5B,
+0xE79ECF1C, 0x9D97DF7E, 0xAE7CAE7B, 0xAE7CA65C, 0xA65CA65B, 0xB67BAE9C, 0x2905A515, 0xB67CB5D9,
+0xA67CA65B, 0xA67CA65C, 0xA67CA65B, 0xA65CA67C, 0xA65CA65B, 0xA67CA65B, 0xA65C9E5B, 0xA65CA65B,
+0xA65CA63B, 0xA65CA63B, 0xA65BA63B, 0xA65BA65B, 0xA65BA63B, 0xA65CA65B, 0xA65CA63B, 0xAE5CA65B,
+0xAE5CA63B, 0xAE5CA63B, 0xAE5BA63B, 0xAE5CA65B, 0xA65CA63B, 0xA65CA65B, 0xA65CA65B, 0xA65CA65B,
+0xA65CA63B, 0xAE7CA65B, 0xA65BA65B, 0xAE5CA65B, 0xAE7CA65B, 0xA65CA65B, 0xA65CA65B, 0xA65CA65B,
+0xA67C9E3B, 0xA65CA65B, 0xA65C9E3B, 0xA65C9E5C, 0x9E3C9E3B, 0x9E3C9E3B, 0x9E5C9E3B, 0x9E5C9E3B,
+0x9E5C9E3B, 0xA67C9E3B, 0x9E3B961B, 0x9E5C963B, 0x9E1B9E3B, 0x9E5C963B, 0x9E3C961B, 0x963C963B,
+0xB65BBE5B, 0xBE7BBE7B, 0xB65ABE7B, 0xBE7BBE7B, 0xBE7BBE7C, 0xBE7BBE7B, 0xBE7BBE7B, 0xBE9BC69C,
+0xBE9BC69C, 0xB65BBE7B, 0xBE7BB63B, 0xBEBCC69C, 0xBE9BC6BC, 0xBE9CC6BC, 0xC69CC6BC, 0xBE9CC69C,
+0xBE9CBE9C, 0xBEBCC6BC, 0xBEBCC6BC, 0xBE9CC6BC, 0xBE9BBEBC, 0xBEBCBEBC, 0xBEBCBEBC, 0xBEBCBEBC,
+0xBEBCBEBC, 0xBEBCBEBC, 0xB69CBEBC, 0xB6BCBEBC, 0xB69CBEBC, 0xB6BCBEBD, 0xB6BCBEBD, 0xB6BCB6BD,
+0xB6BCB6BC, 0xB6BCBEBC, 0xB69CB6BC, 0xB6BCB6BC, 0xAE9CB6BC, 0xB6BCB6BD, 0xB6BCB6BD, 0xB6BCB6DD,
+0xB6BCB6DC, 0xB6BCB6DD, 0xB6BCB6BD, 0xC6DCBEBC, 0xCEFBC69B, 0xBE38D6FB, 0xBE79ADD6, 0xB659BE79,
+0x29E77410, 0x428A6BEF, 0xE7DE42CA, 0x5B6D3A69, 0xC6BAEFFF, 0xD75D7C51, 0x9D55BE79, 0x3A4A10C4,
+0xAE5A4AED, 0xB6BCBEDD, 0xB6BCB69C, 0xB6BCAE9C, 0xAE9CB6BC, 0xAEBCB6BD, 0xAE9CB6BC, 0xAE9CB6BD,
+0xAE9CB6BC, 0xAE9CB6BC, 0xAE9CB6BC, 0xB6BCB6BD, 0xAE9CB6BC, 0xB6BCB6BD, 0xAE9CB6BC, 0xB6BCB6BD,
+0xAEBCB6BC, 0xAEBCB6BC, 0xAEBCB6BC, 0xAEBCB6BD, 0xAE9CB6BC, 0xAE9CB6BC, 0xAE9CB6BC, 0xAE9CB6BC,
+0xAE9CB6BC, 0xAE9CB6BC, 0xAE9CB6BC, 0xAE9CB6BC, 0xAE9CB69C, 0xAE9CB69C, 0xAE7CAE9C, 0xAE9CB69C,
+0xAE7BAE9C, 0xAE7CAE9C, 0xA67CAE7C, 0xAE7CAE9C, 0xAE7CAE7C, 0xAE7CAE9C, 0xAE7BAE9C, 0xAE7CAE9C,
+0xAE7CAE7C, 0xA69CAE9C, 0xAE7CAE9C, 0xB67CB67C, 0xA67BAE9C, 0xAE7BAE9C, 0xBE9CE7BF, 0xB69BB67C,
+0xE79ED73D, 0x9D97E79F, 0xAE7BB69C, 0xAE7CB69C, 0xAE7CB69D, 0xBEBCA67C, 0x1062DEDC, 0xC6BC528C,
+0xA67CB67C, 0xA67CAE7C, 0xA65BAE5C, 0xA65CAE7C, 0xA65BAE7C, 0xA67CAE7C, 0xA65BAE7C, 0xA65CAE7C,
+0xA65BAE7C, 0xA65CAE7C, 0xA65BAE7C, 0xA67BAE7C, 0xA65BAE7C, 0xA65CAE7C, 0xA65BAE7C, 0xA63CAE5C,
+0xAE5BAE5C, 0xAE7CAE7C, 0xAE5BAE7C, 0xAE5BAE5C, 0xAE7BAE7C, 0xAE7CAE7C, 0xA65BAE7C, 0xA65CAE7C,
+0xA65CAE7C, 0xAE7CAE7C, 0xAE7BAE7C, 0xAE7BAE7C, 0xAE7BAE7C, 0xAE7CAE7C, 0xA67CAE7C, 0xA67CAE7D,
+0xA67CAE7C, 0xA67CAE7C, 0xA67CAE7C, 0xA65CAE7C, 0xA67CA67C, 0xA67CAE9D, 0xA65BAE7C, 0xA65BA65C,
+0xA63BA65C, 0xA65BA63B, 0xA65CA65B, 0x9E5BA67C, 0xA65CA65C, 0x9E3BA65C, 0x9E3BA67C, 0x961B961B,
+0xBE7BBE7B, 0xC69CBE7B, 0xBE9BBE7B, 0xC69BBE7B, 0xC69CBE7B, 0xC69BBE7B, 0xC6BCC69B, 0xC6BCC69B,
+0xC6DCC6BC, 0xAE1AB65A, 0xBE9CAE1A, 0xC6DCBE9C, 0xC6BCC69C, 0xC6BCC69B, 0xCEDCC6BC, 0xC6BCC69C,
+0xC6BCC6BC, 0xC6BCC6BC, 0xC6DCC6BC, 0xC6BCC6BC, 0xC6DCC6BC, 0xC6DCC6BC, 0xC6DCC6BC, 0xC6DDBEBC,
+0xC6DDC6BC, 0xC6BCBEBC, 0xC6BCBEBC, 0xC6BCBEBC, 0xC6DDBEBC, 0xC6DDBEBC, 0xC6DDBEBC, 0xBEBCBEBC,
+0xBEBCBEBC, 0xBEBCB69B, 0xBEBCBEBC, 0xBEBCB69C, 0xBEBCB69C, 0xBEBCB69C, 0xBEBCB6BC, 0xB69CB69C,
+0xB6BCB69C, 0xB6BCB69C, 0xBEBCB6BC, 0xC6DCB69B, 0xC6BACEFB, 0xB617BE58, 0xCEFBBE79, 0x84D3BEBA,
+0x741029E7, 0xADF7C699, 0x63AEEFFF, 0xCEFB1145, 0x8CF3BE99, 0x8CF49D75, 0xAE1884D3, 0x1967BE9A,
+0x2A2A1146, 0xBEBDC6FD, 0xB6BDB6BC, 0xB6BCB6BC, 0xB6BDAEBC, 0xB6BCAE9C, 0xB6BDB6BC, 0xB6BDAEBC,
+0xB6BDB6BC, 0xB6BDB6BC, 0xB6BDB6BC, 0xB6BDB6BC, 0xB6BDB6BC, 0xB6BDB6BC, 0xB6DDB6BC, 0xB6BDB6BC,
+0xB6DDB6BC, 0xB6BDB6BC, 0xB6DDB6BC, 0xB6BDB6BC, 0xB6DDB6BC, 0xB6BDB6BC, 0xB6DDB6BC, 0xB6BDB6BC,
+0xB6BDB6BC, 0xB6BDAEBC, 0xB6BDAEBC, 0xB6BDAE9C, 0xB6BDAE9C, 0xB69CAE9C, 0xB69CAE9C, 0xAE9CAE9C,
+0xAEBCAE9C, 0xAE9CAE9C, 0xAEBCAE9C, 0xAE9CAE7C, 0xAE9CAE9C, 0xAE9CAE7C, 0xAE9CAE7C, 0xAE7CAE7B,
+0xB69CAE7C, 0xAE9CAE7C, 0xB69CAE9C, 0xB67CB65C, 0xAE9CB69C, 0xB67BAE9B, 0xC69CDF9F, 0xBE9BB67B,
+0xEFBED73D, 0xA597E77E, 0xAEBCB69B, 0xAE9CAE9C, 0xAEBDAE7C, 0xB67BAE9C, 0x41C8D6DC, 0xBDD91021,
+0xAE7CB67B, 0xAE7CAE7B, 0xAE7CAE7C, 0xAE7CAE5B, 0xAE7CAE7B, 0xAE7CA65B, 0xAE7CA65B, 0xAE7CA65B,
+0xAE7CA65C, 0xAE7CA65B, 0xAE7CA67C, 0xAE7CA65B, 0xAE7CA67B, 0xAE7CA65B, 0xAE7CAE7C, 0xAE7CA67C,
+0xAE7CAE5C, 0xAE7CA65B, 0xAE7CAE7C, 0xAE7CAE7B, 0xAE7CA65B, 0xAE9CA65B, 0xAE9CAE7C, 0xAE9CA67C,
+0xAE7CAE7C, 0xAE7CAE7C, 0xAE9CAE7C, 0xAE7CAE7C, 0xAE9CAE7C, 0xAE7CA67B, 0xAE9CAE7C, 0xAE7CA67C,
+0xAE9CA67C, 0xAE9CA67B, 0xAE9CA67B, 0xAE7CA65B, 0xA67CA65B, 0xA65BA65B, 0xAE5BA65B, 0xAE7BA65B,
+0xAE5BA63A, 0xAE7BA63A, 0xAE5BA65B, 0xAE5BA63A, 0xA65BA65B, 0xA65BA65B, 0xA63B9E1B, 0xA65C9E3B,
+0xC69BC69C, 0xC69BC69C, 0xC69BCEBC, 0xC69BC6BC, 0xC69BCEBC, 0xC6BBCEBC, 0xC6BBCEBC, 0xC6BBCEBC,
+0xC6BCC6DC, 0xB63ABE5B, 0xBE7BBE7B, 0xCEDCBE7B, 0xCEDCCEDD, 0xC6BCCEDC, 0xCEDCCEDC, 0xCEDCCEDD,
+0xCEDCCEDD, 0xCEBCCEDC, 0xCEDCCEDD, 0xCEDCCEDD, 0xCEDCCEFD, 0xCEDCCEDD, 0xC6DCCEDD, 0xC6DCCEDD,
+0xCEDCCEDD, 0xC6DCCEDD, 0xCEDCCEDD, 0xC6DCCEDD, 0xC6DCCEFD, 0xC6BCCEDD, 0xC6DCCEDD, 0xC6DCCEDD,
+0xC6FCCEFD, 0xC6DCCEFD, 0xC6DCCEFD, 0xC6DCC6DD, 0xC6DCC6FD, 0xC6DCC6DD, 0xC6DCC6DD, 0xBEBCC6BC,
+0xBE9CBEBC, 0xB69CBEBC, 0xBE9BBEBC, 0xC6DBC6BC, 0x9D75D71C, 0xCF1BBE79, 0xC6DADF5C, 0x4B0C42CB,
+0xDF7D9D35, 0xDF7DDF7D, 0x21C67C51, 0xD75D6BCF, 0x9D75A5B6, 0x4AEC9535, 0xB659E79F, 0x3A6A4ACC,
+0x19882188, 0xBEBCB65B, 0xBEDDBEBC, 0xB6BCB6BD, 0xB6BCBEDD, 0xB6BCBEBD, 0xB6BCBEDD, 0xB6BDBEDD,
+0xB6DDBEDD, 0xB6BDBEDD, 0xB6DDBEDD, 0xB6BDBEDD, 0xB6DDBEDD, 0xB6DDBEDD, 0xB6DDBEDD, 0xB6BDBEDD,
+0xBEDDBEDD, 0xB6BDBEDD, 0xB6DDBEDD, 0xB6DDBEDD, 0xB6DDBEDD, 0xB6DDBEDD, 0xB6DDBEDD, 0xB6DDBEDD,
+0xB6DDBEDD, 0xB6BDBEDD, 0xB6BDBEDD, 0xB6BCBEBD, 0xB6BCBEDD, 0xB6BCB6BD, 0xB6BCB6BD, 0xAE9CB6BD,
+0xB6BCB6BD, 0xB6BCB6BD, 0xB6BCB6BD, 0xAE9CB6BD, 0xB6BCB6BD, 0xAE9CB6BD, 0xAE9CB6BD, 0xB69CB69D,
+0xB69CBE9D, 0xAE9CB6BD, 0xB69CB6BD, 0xBE7CBE9D, 0xB69CBEBD, 0xB69BBEDC, 0xBE7CE7BF, 0xBEBBBE9C,
+0xE79EDF5E, 0xA597EF9E, 0xAEBCBEDC, 0xB69CB6BD, 0xB6BDB6BD, 0xB67BB6BD, 0x628ADEDC, 0x93F12842,
+0xAE9CC6BC, 0xAE9CB69C, 0xAE7CB69C, 0xAE7CB67C, 0xAE7CB69C, 0xAE7CAE9C, 0xAE7CAE9C, 0xAE7CAE7C,
+0xAE7CAE7C, 0xA67CAE7C, 0xAE7CAE9C, 0xA67CAE7C, 0xAE7CAE9C, 0xAE7CAE7C, 0xAE7CAE9C, 0xAE7CAE7C,
+0xAE7CAE7C, 0xAE5BAE9C, 0xAE9CAE7C, 0xAE7CB69C, 0xAE9CB6BD, 0xAE9CB6BC, 0xAE9CB6BD, 0xAE9CAE9C,
+0xAE9CB6BD, 0xAE9CB69D, 0xAE9CB69D, 0xAE9CAE9D, 0xAE9CB6BD, 0xAE9CAE9D, 0xAE9CB6BD, 0xAE9CAE9C,
+0xAE7CAE9D, 0xAE7BAE9C, 0xAE7CAE9C, 0xAE7BAE7C, 0xAE7BB69C, 0xAE5AAE5B, 0xB69BB67B, 0xB69BB69C,
+0xC6FDCEFD, 0xC71DCF1D, 0xB67BC6DD, 0xAE5BAE5A, 0xAE5BB65B, 0xB69CBEBD, 0xA61AAE5B, 0xA63AA63B,
+0xC69BBE7B, 0xC6BBC69B, 0xC6BBC69B, 0xCEBCC69B, 0xCEBCC69B, 0xCEDCC6BB, 0xCEBBC6BB, 0xCEBCC6BB,
+0xCEDCC6BB, 0xB619BE7B, 0xBE5BB63A, 0xCEDCBE7B, 0xCEFCCEDC, 0xCEDCCEDC, 0xCEDCCEDC, 0xD6FDCEDC,
+0xD6FCCEDC, 0xD6DCCEDC, 0xD6FCCEDC, 0xD6FCCEFC, 0xD6DCCEDC, 0xD6FCCEDC, 0xD6FCCEDC, 0xD6FDCEDC,
+0xD6DCCEDC, 0xD6FCCEDC, 0xD6FCCEDC, 0xD6FCCEDC, 0xCEFCCEDC, 0xCEFCCEDC, 0xCEFDCEDC, 0xD6FDCEDC,
+0xCEFCCEFC, 0xCEFDCEFC, 0xCEFDCEFC, 0xCEFDCEFC, 0xCEFCCEDC, 0xCEFDC6FC, 0xCEFDC6FC, 0xCEFDC6DC,
+0xC6DCC6DC, 0xC6DCC6DC, 0xC6BCC6BC, 0xCEDCBEBB, 0xC6BAD73C, 0x8CD39554, 0xBE99BE79, 0xE7FFD77D,
+0xE7BED75C, 0x7430A5D6, 0x29E73A69, 0xADF7DF7D, 0xAE18A5D7, 0xC6DB6C10, 0x8CD4D75D, 0x4ACC7C92,
+0x19882187, 0xD75F6BF1, 0xBEBCBEDC, 0xBEDDBEDD, 0xBEDCB6BC, 0xBEDDBEBC, 0xBEDCBEBC, 0xBEDDBEDC,
+0xBEDDBEBC, 0xBEDDBEDC, 0xBEDDBEBC, 0xBEDDBEDC, 0xBEDDBEDC, 0xBEDDBEDC, 0xBEDDBEDC, 0xBEDDBEDC,
+0xBEDDBEDC, 0xBEDDBEDC, 0xBEDDBEDC, 0xBEDDBEDC, 0xBEDDBEBC, 0xBEDDBEDC, 0xBEDDBEBC, 0xBEDDB6DD,
+0xBEDDB6BC, 0xBEDDB6DC, 0xBEDDB6BC, 0xBEDDB6BC, 0xBEDDB6BC, 0xBEDDB6BC, 0xB6DCB6BC, 0xBEDDB6BC,
+0xB6BDB6BC, 0xB6DDB6BC, 0xB6BCB6BC, 0xB6BDB6BC, 0xB6BCB69C, 0xB6BDB6BC, 0xB6BCB69C, 0xB6BCB6BC,
+0xB6BCB69C, 0xB6DCAEBC, 0xB6BCAEBC, 0xBEBCB6BC, 0xB6BCB6BC, 0xBEBCB6DC, 0xBE9CDF9F, 0xBEDCB6BB,
+0xEF9ED73D, 0xAD97E77E, 0xB6DCBEDB, 0xBEBDB6BC, 0xB6BDB6BC, 0xC69BB6BC, 0x7249E6BB, 0x7A6B4862,
+0xB6BDCEBC, 0xB6BCAE9C, 0xB69CB69C, 0xB69CAE9C, 0xAE9CAE7B, 0xAE9CAE9C, 0xAE9CAE7B, 0xAE9CAE7B,
+0xAE9CAE7C, 0xAE9CAE9C, 0xAE9CA67C, 0xAE9CAE7C, 0xAE9CAE7C, 0xAE9CAE9C, 0xAE9CAE7B, 0xB69CAE9C,
+0xB6BCAE9C, 0xB6BCB69C, 0xB6BCAE9C, 0xB69CAE9C, 0xB69CAE9C, 0xB6BCAE9C, 0xB6BCAE9C, 0xB6BDAE9C,
+0xB6BCAEBC, 0xB6BDAEBC, 0xB6BCAEBC, 0xB6BDAEBC, 0xAEBDAE9C, 0xB6BDAEBC, 0xB69CAE9C, 0xB6BCAE9C,
+0xAE9CAE9C, 0xAE9CAE9B, 0xB69CAE9B, 0xB69CAE7B, 0xB67BAE5A, 0xC6FCBE9B, 0xD73DC6FC, 0xD73DCF3D,
+0xDF3DD75D, 0xD75ED73D, 0xCEFDCF3D, 0xB65AB65A, 0xBE9CB65A, 0xBE9CBEBC, 0xB67BB69B, 0xB67BAE3A,
+0xC69BC69B, 0xCEBBCEBB, 0xCEBBCEBB, 0xCEBBCEBC, 0xCEBBCEBC, 0xCEBBCEDC, 0xCEBBCEDC, 0xCEDCD6DC,
+0xCEDCCEDC, 0xADF9C69C, 0xB63AB61A, 0xC69BC69C, 0xCEDCCEBC, 0xCEFCD6FC, 0xD6FCD6FC, 0xD6FCD6FD,
+0xD6FCD6FC, 0xD6DCD6FD, 0xD6FCD6FC, 0xD6FCDF1D, 0xD6FCD6FD, 0xD6FCD6FD, 0xD6FCD6FD, 0xD6FCD6FD,
+0xD6FCD6FC, 0xD6FCDEFD, 0xD6FCD6FC, 0xD6FCD71D, 0xD6FCD6FC, 0xD6FCDF1D, 0xD6FCDF1D, 0xD6FCDF1D,
+0xD6FCD6FD, 0xD6FCD71D, 0xD6FCD6FD, 0xD6FCD71D, 0xCEFCD6FC, 0xCEFCD71D, 0xCEDCD6FD, 0xCEDCD6FD,
+0xCEFCD6FD, 0xCEFCD71D, 0xCEDCCEFD, 0xCEDCCEDC, 0xCEFBD73C, 0x9534A575, 0x743063AE, 0x95759D95,
+0x7450DF9D, 0x42AA3A6A, 0x8D133208, 0x84B2CF1B, 0x530C5B4D, 0xD73DCF1C, 0xC6BBCEDC, 0x21665B2E,
+0x218829A8, 0xB63A1967, 0xBEBCC6FD, 0xBEBCC6FD, 0xBEDCC6DD, 0xBEDCC6DC, 0xBEBCC6DC, 0xBEDCC6DD,
+0xBEDCC6DD, 0xBEDCC6DD, 0xBEDCC6DD, 0xBEDDC6FD, 0xBEDCC6DD, 0xBEDCC6DD, 0xBEDCC6DD, 0xBEDCC6DD,
+0xBEDCC6DD, 0xBEDCC6DD, 0xBEDCC6DD, 0xBEDDC6FD, 0xBEDCC6DD, 0xBEDDC6FD, 0xBEDDC6DD, 0xBEDDC6FD,
+0xBEDCC6DD, 0xBEDCC6DD, 0xBEDCBEDD, 0xBEDCC6FD, 0xBEDCBEDD, 0xBEDCBEDD, 0xBEDCBEDD, 0xBEDCBEDD,
+0xBEBCBEDD, 0xBEDCBEDD, 0xB6BCBEDD, 0xBEDCBEDD, 0xB6BCBEDD, 0xBEDCBEDD, 0xB6BCBEDD, 0xBEDCBEDD,
+0xB6DCBEDD, 0xB6DCBEFD, 0xB6DCBEFD, 0xBEBCC6DD, 0xB6DCBEDD, 0xBEDCBEFD, 0xBEBCDF9F, 0xBEDCC6FC,
+0xEF9EDF5D, 0xADB7EF7E, 0xB6DCC6FC, 0xBEBDC6DD, 0xBEBDBEBD, 0xCE9BC6DD, 0x8228F6BB, 0x92AB7104,
+0xB6DDDEDC, 0xB6BCBEBD, 0xB69CBEBD, 0xB69CBEBD, 0xB69CB6BD, 0xB69CB6BD, 0xB69CB69C, 0xB69CB69C,
+0xAE9CB69C, 0xAE9CB6BC, 0xAE9CB69C, 0xAE9CB6BC, 0xB69CB69C, 0xB69CB6BD, 0xB69CB6BC, 0xB69CBEBC,
+0xB69CB69C, 0xBEBCBEBC, 0xB69BBEBC, 0xBEBCBEBC, 0xB69CBE9C, 0xB69CBEBC, 0xB6BCBEBC, 0xBEBCBEDD,
+0xB6BCBEDD, 0xB6BCBEDD, 0xB6BCB6DD, 0xB6DDB6DD, 0xB6BCB6DD, 0xB6BCBEDD, 0xB69CB6BC, 0xB69CBEBC,
+0xB69BBEBC, 0xBEDCC6FD, 0xB69BBEBC, 0xC6DCBE9C, 0xCEFCCEFC, 0xDF5DDF5E, 0xD73DDF5D, 0xDF3DDF3D,
+0xDF1CDF3C, 0xD71CDF1D, 0xDF5EDF5E, 0xBE5AC6BC, 0xBE9BC69C, 0xBE9BC6BC, 0xC6DCC6BC, 0xC6DCC6DC,
+0xCEBBC69A, 0xCEBBC69B, 0xCEBBCE9B, 0xCE9BCE9B, 0xCEBBCE9B, 0xCEBBCE9B, 0xD6DCCEBB, 0xCEDCCEBB,
+0xC67BCEBB, 0xBE7BBE5A, 0xBE3ABE7A, 0xC67BBE3A, 0xCEDCC69B, 0xD6DCCEDC, 0xD6FDD6FC, 0xD6FCCEDC,
+0xD6FCD6FC, 0xD6FCCEDC, 0xD71DD6FC, 0xD6FCD6FC, 0xD71DD6FC, 0xD6FCD6FC, 0xD6FCD6FC, 0xD6FCD6FC,
+0xD71CD6FC, 0xD71CD6FC, 0xD71CD6FC, 0xD71CD6FC, 0xD71CD6FC, 0xDF1DD6FC, 0xDF1DD6FC, 0xDF1DD6FC,
+0xDF1DD71C, 0xDF1DD6FC, 0xDF1DD71C, 0xDF1DD71C, 0xDF1DD71C, 0xD71DD71C, 0xD71DD6FC, 0xD6FDD6FC,
+0xD6FDD6FC, 0xD6FDD6FC, 0xD71DCEFC, 0xD6FCCEDB, 0xDF5CCEDB, 0xDF5CD73C, 0xDF7DDF9D, 0xCF1BB658,
+0x32497CB2, 0x32493269, 0xE7BE3A8A, 0x95559DB6, 0xE7BE7451, 0xBE59C6DB, 0xADB7CEFB, 0x3A2A94F4,
+0x21A81946, 0x6BF121A8, 0xCF1DCF5E, 0xC6FDC6FC, 0xC6FDC6DC, 0xCEFCC6DC, 0xCEDDC6DC, 0xC6DDC6DC,
+0xC6FDC6DC, 0xC6DDC6DC, 0xC6FDC6DC, 0xC6DDC6DC, 0xC6DDC6DC, 0xC6DCBEDC, 0xC6DDC6DC, 0xC6DCBEDC,
+0xC6DDBEDC, 0xC6DDBEBC, 0xC6DDC6DC, 0xC6DDBEDC, 0xC6FDBEDC, 0xC6DDBEDD, 0xC6FDBEDD, 0xC6FDBEDC,
+0xC6DDBEDC, 0xC6DDBEDC, 0xC6FDBEDC, 0xC6FDBEDC, 0xC6FDBEDC, 0xBEDDBEDC, 0xBEFDBEDC, 0xBEDDBEDC,
+0xC6DDBEDC, 0xBEDDBEDC, 0xBEFDBEDC, 0xBEDDBEDD, 0xBEFDBEDD, 0xBEDDBEDD, 0xBEFDBEDC, 0xBEDDBEDC,
+0xBEFDBEDD, 0xBEDDBEDD, 0xC6FDBEDD, 0xC6DDBEBD, 0xC6FDBEDC, 0xC6FDBEDC, 0xC6BDD77F, 0xC6DCC6DC,
+0xEF9ED73D, 0xADB7E75D, 0xBF1DBEFC, 0xC6DDBEDD, 0xC6DDC6DD, 0xD69CBEBC, 0x8945FE7A, 0xD4729186,
+0xBEDDD6BC, 0xBEDDB6BC, 0xBEDDBEBC, 0xBEBDB6BC, 0xBEBDB6BC, 0xB6BDB6BC, 0xB6BDB6BC, 0xBEBDB69C,
+0xBEBCB69C, 0xB6BCB69B, 0xBEBCB69C, 0xB6BCB69C, 0xBEBDB6BC, 0xBE9CB69C, 0xBEBCB69B, 0xBEBCBE9B,
+0xC6BCBE9B, 0xBE9BBE9B, 0xC6BCBE9B, 0xCEFDC6DC, 0xD73ECF1D, 0xCEFDCF1D, 0xC6BCC6BC, 0xBEBCBE9B,
+0xBEDCBEBC, 0xBEDCBEBC, 0xBEDDB6DC, 0xB6DDB6BC, 0xBEDDB6DD, 0xBEBCB6BC, 0xBEDCBEBC, 0xBE9BBEBB,
+0xC6BCBE9B, 0xD71DCEFD, 0xCEDCCEFD, 0xD71DC6BB, 0xDF5DD73D, 0xE75DDF5D, 0xE73DDF3C, 0xE75DE73C,
+0xEF7DE75D, 0xE75DE75D, 0xE75EDF5D, 0xC69BC6BB, 0xC67BC69B, 0xCEBCC69B, 0xCEBCC69B, 0xC69BC6BB,
+0xC69BCE9B, 0xCE9BCEBB, 0xCEBBCEBB, 0xCE9BCEBB, 0xCEBBCEBC, 0xCEBBCEBC, 0xCEBBD6DC, 0xCEBBD6DC,
+0xC69BCEBC, 0xBE3AC69B, 0xC67BBE5A, 0xBE5ACEBC, 0xCEDCCEBC, 0xD6FCD6FD, 0xD6FCD6FD, 0xD6DCD6FD,
+0xD6FCD71D, 0xD6FCD6FD, 0xD71CD71D, 0xD6FCDF1D, 0xD6FCDF1D, 0xD6FCDF1D, 0xD71CDF1D, 0xD71CDF1D,
+0xD71CDF1D, 0xD71CDF1C, 0xD71CDF3D, 0xD71CDF1D, 0xDF1CDF3D, 0xD6FCDF1D, 0xDF1CDF1D, 0xDF1CDF1D,
+0xDF1DDF1D, 0xDEFCDF1D, 0xDF1CDF1D, 0xD71CDF1D, 0xDF1CDF1D, 0xDF1CDF1D, 0xDF1DDF1D, 0xDF1DDF1D,
+0xDF1DDF3D, 0xD6FCDF1D, 0xD71DDF1D, 0xD73CD71D, 0xCEDBD6FB, 0xDF7DDF3C, 0x9D75CEFB, 0x3A697430,
+0x19862186, 0x5B6D21A7, 0x6C10C6DA, 0x63AEB638, 0xBE798492, 0xB6188492, 0xB618D71C, 0xADD79D14,
+0x19467411, 0x3A4A2167, 0xCEFDE7BF, 0xCF1DCF1D, 0xCF1DD71D, 0xCEFCD71D, 0xCEFCD71D, 0xCEFCCEFD,
+0xCEFDCF1D, 0xCEFCCF1D, 0xCEFDCF1D, 0xCEFCCF1D, 0xCEFCCF1D, 0xCEFCCEFD, 0xCEFCCF1D, 0xC6FCCEFD,
+0xC6DCCEFD, 0xC6DCCEFD, 0xC6DCCEFD, 0xC6DCCEFD, 0xC6DCCEFD, 0xC6DCCEFD, 0xC6DCC6FD, 0xC6DCC6DD,
+0xC6DCCEFD, 0xC6DCC6FD, 0xC6FDCEFD, 0xC6DCC6FD, 0xC6FDCEFD, 0xC6DCC6FD, 0xC6FCC6FD, 0xC6DCC6FD,
+0xC6FCC6FD, 0xC6DDC6FD, 0xC6FDC6FD, 0xC6DDC6FD, 0xC6FDC6FD, 0xC6FDC6FD, 0xC6FDC71D, 0xBEFDC6FD,
+0xC6FDC6FD, 0xBEFDC6FD, 0xC6FDC71E, 0xC6DDCEFD, 0xC71DC6FD, 0xC6FDC6FD, 0xC6BCDF7F, 0xC6DCCEFD,
+0xE79EDF5E, 0xA5B7EF7E, 0xBEFDC71D, 0xC6DDC6FD, 0xC6FDC6FD, 0xDE9CC6FE, 0x88E3FD76, 0xF59688E3,
+0xBEDCDEDC, 0xBEDCC6DD, 0xC6DCC6DD, 0xBEBCC6DD, 0xBEDCC6DD, 0xBEBCBEDD, 0xBEBCBEBD, 0xBEBCBEBD,
+0xBEBCC6BC, 0xBEBCC6BC, 0xBEBCC6BC, 0xBEBCC6BC, 0xBEBCC6BC, 0xC6BBC6BC, 0xCF1DCEFD, 0xD75EDF5E,
+0xDF5ED73E, 0xC6BBD73E, 0xD71DCEBC, 0xE77EE79F, 0xE79EE77E, 0xDF3DE79F, 0xD71DD71D, 0xD71DD71D,
+0xC6DCCEDC, 0xBEDCC6DC, 0xBEDCC6DD, 0xBEDCBEDD, 0xBEDCBEDD, 0xBEBCC6DD, 0xCEFDC6FD, 0xC6BBCEFD,
+0xC69BCEFC, 0xDF3DD6FD, 0xE75EE77E, 0xDF3DDF3D, 0xE75DE77E, 0xE75DE75D, 0xEF7DEF7D, 0xEF5DEF7D,
+0xE73CF77D, 0xE75DEF5D, 0xDF1CE75D, 0xC69BC67B, 0xC67BC67B, 0xBE5AC67B, 0xC65BC65B, 0xC67BC65A,
+0xCEBBC69B, 0xCEBBC69B, 0xC69BC69B, 0xCEBBC69B, 0xCEBCCEBB, 0xCEDCCEBB, 0xCEBCCEBB, 0xCEDCCEBB,
+0xCEDCC6BB, 0xD6DCCEDC, 0xCEBCCEBB, 0xCEBCC6BB, 0xD6DCCEDB, 0xD6FCCEDB, 0xD6FCD6DB, 0xD6FCD6FC,
+0xD6FCCEDC, 0xD6FCD6FC, 0xD6FCD6FC, 0xD6FCD6FC, 0xD71CD6FC, 0xD71DD6FC, 0xD71CD6FC, 0xDF1DD6FC,
+0xD71CD6FC, 0xDF3CD71C, 0xD71CD71C, 0xD71CD71C, 0xDF1CD71C, 0xDF1CD71C, 0xDF1CD71C, 0xDF1CD71C,
+0xDF1CD71C, 0xDF1CD6FC, 0xDF1CD71C, 0xDF1CDF1C, 0xDF1CD71C, 0xDF1DD71C, 0xDF1DD71C, 0xDF1DDF1C,
+0xDF1DDF1C, 0xDF3DD6FC, 0xD71CD71C, 0xDF1CD71C, 0xDF3CD6FB, 0xDF3CDF5C, 0x74307430, 0x84B263AE,
+0xBE599534, 0xEFFFDF7D, 0x3228AE17, 0x428AA5B6, 0xAE179534, 0xBE79BE79, 0xA5B6BE79, 0x7C517C71,
+0x5B2E7C31, 0x11051946, 0xD73DD73D, 0xD73DCEFD, 0xD71DCF1C, 0xD71DD71C, 0xD71DCF1C, 0xD71DD71D,
+0xD71DCF1C, 0xD71DCEFC, 0xD71DCF1C, 0xD71DD71C, 0xD71DCEFC, 0xD71DCEFC, 0xD71DCEFC, 0xD71DCEFC,
+0xD71DCF1C, 0xD71DCEFC, 0xCF1DCEFC, 0xCF1DCEFC, 0xCEFDC6FC, 0xCEFDC6FC, 0xCEFDC6FC, 0xCEFDC6FC,
+0xCEFCC6FC, 0xCEFDC6FC, 0xCEFDC6DC, 0xCEFDC6DC, 0xC6FDC6DC, 0xC6FDC6FC, 0xC6FCC6DC, 0xC6FDC6DC,
+0xC6FDC6FC, 0xC6FDC6DC, 0xC6FDC6DC, 0xC6FDC6DC, 0xC6FDC6DC, 0xC6FDC6DC, 0xC6FCBEDC, 0xC6FDBEFC,
+0xC6FDC6FC, 0xC6FDBEFC, 0xC6FCBEDC, 0xC6FDC6DC, 0xBEDCC6FC, 0xC6FCC71C, 0xC6DCD73D, 0xC6FCC6FC,
+0xE79ED75D, 0xA5D7DF7E, 0xBF1CC71C, 0xC6FDBEFC, 0xC6FDBEDC, 0xE6DCBEFD, 0x98C2E40F, 0xFE9A78C2,
+0xC6DCD6BB, 0xDF7EC6FC, 0xD73EDF7E, 0xC6DCC6FC, 0xC6DCBE9B, 0xBEBCC6BC, 0xCEFDBEBC, 0xC6DCC6FC,
+0xCEDCC6BB, 0xDF5ECF1C, 0xC6BCCF1C, 0xCEDCBE9B, 0xDF5ECEDC, 0xDF5DDF5D, 0xE79EDF5D, 0xE79EDF7D,
+0xE75EE77E, 0xDF1DDF3D, 0xE77EDF3D, 0xE77EE77E, 0xE77EE75D, 0xE77EE75D, 0xEF7EE77E, 0xE77EE75E,
+0xD73DDF5D, 0xC6DCCEFC, 0xC6BCBEBB, 0xC6DCBEDC, 0xC6BCBEBC, 0xCEDCBEBB, 0xE79FDF5E, 0xE77EE79E,
+0xE75DE77E, 0xE75DDF1C, 0xE75DE75D, 0xE75DE73D, 0xE75DE75D, 0xEF7DE75D, 0xEF7DE75C, 0xF77DEF7D,
+0xEF5DEF5D, 0xEF5DE75C, 0xD6FCCE9A, 0xC65ACEBB, 0xC67BC67B, 0xBE3ABE5A, 0xBE3ABE19, 0xC67BBE5A,
+0xC69BCE9B, 0xCEBBCEBC, 0xC69BCEBB, 0xCEBBCEBC, 0xCEBBCEBC, 0xCEBCCEDC, 0xCEBBCEDC, 0xCEDCD6DC,
+0xCEDCCEDC, 0xCEDCD6FD, 0xCEDCD6DC, 0xCEDCD6DC, 0xCEDCD6DC, 0xD6FCD6FC, 0xD6FCD6FC, 0xD6FCDEFD,
+0xD6FCD6FC, 0xD6FCD71D, 0xD6FCD71D, 0xD6FCDF1D, 0xD6FCDF1D, 0xD6FCDF1D, 0xD6FCDF1C, 0xDF1CDF1D,
+0xD71CDF1D, 0xD71CDF1D, 0xD71CDF1C, 0xDF1CDF3D, 0xD71CDF3D, 0xD71CDF1D, 0xD71CDF1C, 0xDF1CDF3D,
+0xDF1CDF1D, 0xDF1CDF3D, 0xDF1CDF3D, 0xDF1CDF3D, 0xDF1CDF3D, 0xDF1DDF3D, 0xDF1CDF3D, 0xDF1CDF3D,
+0xDF1CDF1C, 0xDF1CDF1D, 0xDF3CDF3D, 0xD6FCDF3D, 0xD6FBDF1C, 0xC6BADF1C, 0xCEFBCEDB, 0xA596DF5D,
+0xD73CDF7D, 0xCEFBDF5D, 0x63AE3208, 0x7450A596, 0xBE79BE79, 0xBE59BE59, 0xA5B6BE59, 0xADF7A5B6,
+0x7C318CD3, 0x21676BAF, 0xDF7E9515, 0xD71DDF3E, 0xD71CDF3D, 0xD71CDF3D, 0xD71DDF3D, 0xD71DDF3D,
+0xD73CDF3D, 0xD71CDF3D, 0xD71CDF3D, 0xDF3DDF3D, 0xD71CDF3D, 0xD71CDF3D, 0xD71CDF3D, 0xD71DDF3D,
+0xD71DDF3D, 0xD71DDF3D, 0xD71CD73D, 0xD71CD73D, 0xD71DD73D, 0xD73DD73D, 0xD71DD73D, 0xD73DD73D,
+0xCF1CD73D, 0xCF1DD71D, 0xCF1CD71D, 0xCF1DD71D, 0xCEFCCF1D, 0xCEFCD71D, 0xCEFCCF1D, 0xCEFCCF1D,
+0xC6FCCEFC, 0xC6FCCEFD, 0xC6FCCEFD, 0xC6FCCEFD, 0xC6FCCEFD, 0xC6FCCEFD, 0xC6FCCEFD, 0xC6FCCF1C,
+0xC6DCCEFC, 0xCEFCCEFC, 0xCF1CCF1C, 0xCF1CD71D, 0xCEFCD73D, 0xCEFCD73D, 0xCEFCDF3D, 0xCF1CD73D,
+0xE79EDF5D, 0xA5B7E79F, 0xC6FCCF1D, 0xC71DCF1D, 0xBEDBCF1D, 0xEEFCC71D, 0xA8E2CAAA, 0xFEDBA269,
+0xD71CD69A, 0xE7BFE79E, 0xE77EEFBF, 0xDF3DE77E, 0xD73DDF5E, 0xD71DD73D, 0xDF7EDF5E, 0xDF3DE77F,
+0xDF5DE75E, 0xE79EE77E, 0xDF3DE77E, 0xE75EE75E, 0xE79EE77E, 0xE77EEF9E, 0xEF9EEF9E, 0xE77DEF9E,
+0xE77DEF7E, 0xE75DEF7E, 0xE77DEF7D, 0xEF9DEF9E, 0xEF7DEF7D, 0xEF7EF79E, 0xE75DEF7E, 0xE75DE75D,
+0xDF5DE77E, 0xD6FCDF3D, 0xCF1DD71D, 0xCF1DD71D, 0xC6BBCEFD, 0xD71DCEBC, 0xEFBFE79F, 0xEF9EEF9F,
+0xE75DEF9E, 0xE75DE75D, 0xE75DEF7E, 0xEF5DEF7E, 0xEF7DEF7E, 0xEF7DF79E, 0xEF7DEF7E, 0xEF5DF77E,
+0xEF7DEF7E, 0xE75DEF7D, 0xD71CCE9A, 0xD6FCDF1C, 0xC69BD6DC, 0xBE19C65B, 0xB5F9B5F9, 0xC65BBE3A,
+0xC69BC69B, 0xC69BC69B, 0xCEBCC69B, 0xCEBCC6BB, 0xCEBCC6BB, 0xCEBCC6BB, 0xCEDCCEBB, 0xCEDCCEBB,
+0xD6DCCEBB, 0xD6DCCEDC, 0xD6DDCEDC, 0xD6DCCEDC, 0xD6FCCEDC, 0xD6FCCEDB, 0xD6FCD6FC, 0xD6FCD6DC,
+0xD6FCD6DC, 0xD6FDD6DC, 0xDEFDD6FC, 0xD6FDD6FC, 0xD6FDD6FC, 0xD6FCD6DC, 0xDF1DD6FC, 0xDF1DDEFC,
+0xDF1DD71C, 0xD71CD6FC, 0xDF1DD6FC, 0xDF1DD71C, 0xDF3DDF1C, 0xDF1DD6FC, 0xDF1DDEFC, 0xDF3DDF1C,
+0xDF3DDF1C, 0xDF3DDF3D, 0xDF3DD71C, 0xDF3DD71C, 0xDF3DD71C, 0xDF3DDF3C, 0xDF3DDF3C, 0xDF3DD71C,
+0xDF5DDF1C, 0xDF3CDF3C, 0xDF3DD73C, 0xCEDBD71C, 0xD71CBE79, 0xADB6BE38, 0x31E73A28, 0x8492428A,
+0xCEBADF5D, 0x7410CEDA, 0xB6187430, 0x9534A5B6, 0xADD7A5B6, 0xC679B617, 0xBE79BE58, 0xA596ADD6,
+0x8CD47C51, 0x3A097410, 0xEFBF5B2E, 0xDF5DD71C, 0xDF3DDF3D, 0xDF3DDF1C, 0xDF3DDF1C, 0xDF3DD73C,
+0xDF3DDF3D, 0xDF3DD71C, 0xDF3DD71C, 0xDF3DD71C, 0xDF3DDF3D, 0xDF3DD71C, 0xDF3DDF3D, 0xDF3DD71C,
+0xDF3DD71C, 0xD73DD71C, 0xDF3DD73C, 0xD73DD71C, 0xDF3DD73C, 0xD73DD71C, 0xD73DD73D, 0xD73DD71C,
+0xDF3DD73D, 0xD73DD71D, 0xD73DD71D, 0xD73DD71D, 0xD73DD71D, 0xD73DD71C, 0xD73DD71D, 0xD71DD71C,
+0xD73DCF1C, 0xD73DCF1C, 0xD73DCF1D, 0xD71DCF1C, 0xCF1DCF1C, 0xCF1DCEFC, 0xCF1CCF1C, 0xCEFCCEFC,
+0xD71CCEFB, 0xDF3DD71C, 0xE79EDF5D, 0xEF9EE77D, 0xE77EE77D, 0xDF5DE77D, 0xEF7EE75D, 0xE77DE77D,
+0xEF9EE75D, 0xADB7E77E, 0xCEFDCEFC, 0xC6FCC6DC, 0xCEFCC71C, 0xFF1BCEDB, 0xA8C2A0E2, 0xF6FBBBCE,
+0xEF9EE73C, 0xEF9EEFBE, 0xEF9EE77D, 0xEF7EEF7D, 0xEF7EE77D, 0xE75DE75D, 0xEF9EE77D, 0xEF7EEF7D,
+0xEF9EEF9E, 0xEF7EEF7D, 0xEF7EE75D, 0xEF9EE77D, 0xEF9EEF9E, 0xEF7EEF7D, 0xF79EEF9E, 0xEF7DEF7D,
+0xEF7DE77D, 0xEF9EE77D, 0xF79EEF7D, 0xEF9DEF7D, 0xEF9DEF7D, 0xEF9EEF7D, 0xE73CE73C, 0xEF7DE73C,
+0xE77EE77D, 0xE75DE75D, 0xE77EDF5E, 0xDF5EDF5D, 0xCEBBCEDC, 0xE75ECEBB, 0xEF9EE77E, 0xEF9EE75D,
+0xEF7DE77D, 0xE75DE75D, 0xEF7DE77D, 0xEF7DE77D, 0xEF9EE77D, 0xEF5DE75D, 0xE75DE75D, 0xEF7DE75D,
+0xEF7EE75D, 0xE75DE73C, 0xDF1CC659, 0xD6FCCEDB, 0xD6DCD6FC, 0xC67BCE9B, 0xB5F9B619, 0xBE3AB5F9,
+0xC69BC69B, 0xC69BC69B, 0xC69BCEBC, 0xC69BCEBC, 0xC6BBCEBC, 0xC6BBCEBC, 0xCEBCCEBC, 0xCEBCCEBC,
+0xCEBBD6DC, 0xCEDCD6DC, 0xCEDCD6DD, 0xCEDCD6DC, 0xD6DCD6DC, 0xD6FCD6FC, 0xD6FCD6FD, 0xD6DCD6FD,
+0xD6DCD6FD, 0xD6FCD6FD, 0xD6FDDF1D, 0xD6FCDEFD, 0xD6FCDEFD, 0xD6FCDEFD, 0xDEFDDEFD, 0xDF1DDF1D,
+0xD71CDF1D, 0xD6FCDF1D, 0xDF1CDF1D, 0xDF1CDF1D, 0xDF1DDF1D, 0xDEFCDF1D, 0xDF1DDF1D, 0xDF1DDF1D,
+0xDF3DDF3D, 0xD71CDF3D, 0xD71CDF3D, 0xDF3DDF3D, 0xDF3DDF3D, 0xDF3DDF5D, 0xDF3DDF5D, 0xD71CDF3D,
+0xDF3CDF3D, 0xDF3CDF3D, 0xDF5DE75D, 0xD6FBDF5D, 0x8CF3B5F8, 0x7C71A596, 0xEFDEB5F8, 0xD71BDF5D,
+0xBE79BE38, 0x95349D55, 0x6BCF7C31, 0x9534638E, 0xD6FBC67A, 0xC679CE9A, 0xD6FBCEBA, 0x6B8EA596,
+0xCEDBADB7, 0x21668CB3, 0xEFBF4A6B, 0xDF1CDF3D, 0xDF3CE73D, 0xDF3CE73D, 0xDF3DE73D, 0xDF3DDF3D,
+0xDF3DDF3D, 0xDF1CDF3D, 0xDF3DDF3D, 0xDF3DDF3D, 0xDF3DE73D, 0xDF1CDF3D, 0xDF3DE73D, 0xDF1CDF3D,
+0xDF3CDF3D, 0xDF3CDF3D, 0xDF3DDF3D, 0xDF3CDF3D, 0xDF3DDF5D, 0xDF3CDF3D, 0xDF3DDF5D, 0xDF3CDF3D,
+0xDF3DDF3D, 0xDF3DDF3D, 0xDF3DDF5D, 0xD73DDF3D, 0xDF3DDF5D, 0xDF3DDF3D, 0xDF3DDF3E, 0xD73DDF3D,
+0xD73DDF3D, 0xD73DDF3D, 0xD73DDF5D, 0xD73DDF3D, 0xD73DDF5D, 0xD73DD73D, 0xD71CD73D, 0xD73CD73D,
+0xE75DE77D, 0xEF7DEF7E, 0xEF9EEF9E, 0xEF7DF79E, 0xF79EF7BE, 0xEF9DF7BE, 0xF79EF79E, 0xEF9EF7BE,
+0xEF7EF79E, 0xB5D8EF7E, 0xDF3EE75E, 0xCEDCD71E, 0xD6FBCEFC, 0xF5F6E6FB, 0x9840A0A2, 0xEF3CEDB6,
+0xEF9EF79E, 0xEF9DF79E, 0xF79EF7BE, 0xEF7DF79E, 0xEF9DF79E, 0xEF7DEF7D, 0xEF7DEF7E, 0xEF9EF79E,
+0xEF9EF79E, 0xEF7DF79E, 0xEF7DF79E, 0xEF7DEF9E, 0xEF7DF79E, 0xF79EF79E, 0xEF9EF7BE, 0xEF7DF77E,
+0xE75CEF7D, 0xEF7DEF7D, 0xEF9DF7BE, 0xEF7DF79D, 0xEF7DF7BE, 0xEF7DF79E, 0xDF1BE73C, 0xEF7DEF5D,
+0xEF5DEF7D, 0xEF7EEF7E, 0xE79EEF9E, 0xE75EEF7E, 0xD6FCDF1D, 0xEF9EDF3D, 0xEF7DEF9E, 0xEF7DEF7E,
+0xE75DEF5D, 0xE75DEF7D, 0xE77DEF7D, 0xEF7DEF9E, 0xE77DEF7D, 0xDF3CE75D, 0xDF3CE75D, 0xE75DE73D,
+0xE73DEF7E, 0xDF3CE71D, 0xD6DBCE7A, 0xCEDBD6BB, 0xCEBBD6DC, 0xC65ACE9B, 0xB5D9BE1A, 0xB63AB61A,
+0xC69BBE7B, 0xC69BBE7B, 0xC69BBE9B, 0xC69BC69B, 0xC69BBE9B, 0xCEBCC69B, 0xC6BBC69B, 0xCEBCC6BB,
+0xCEBCC6BB, 0xCEDCCEBB, 0xCEDCCEBC, 0xD6DCCEDC, 0xCEDCCEDB, 0xD6FCCEDB, 0xD6FCCEDC, 0xD6FCCEDC,
+0xD6DCD6DC, 0xD6FDD6DC, 0xD6FCD6DC, 0xD6FDD6FC, 0xD6FCD6DC, 0xD6FCD6FC, 0xDF1DD6FC, 0xDF1DD6FC,
+0xDF1DD6FC, 0xDF1DD6FC, 0xDF1DD71C, 0xDF1DD71C, 0xDEFCD6FC, 0xDF1DD6FC, 0xDF1DDEFC, 0xDF3DDF1C,
+0xDF3DD71C, 0xDF1DD71C, 0xDF1DD71C, 0xDF3DD71C, 0xDF3DDF3C, 0xDF3DDF3C, 0xDF3CD71C, 0xDF3DD71C,
+0xDF3DDF1C, 0xE75DDF3C, 0xDF5DDF3C, 0xD71CDF3C, 0x63AEC6BA, 0xA5B66BEF, 0xADB6A5B6, 0xB638ADF6,
+0x9D75B638, 0x32287C71, 0x9D557C71, 0xB638CEDB, 0xCEBBBE59, 0xB5B7DF1C, 0x632D634D, 0x21254249,
+0xE77EB5F7, 0x52ACF7FF, 0xF7DF1925, 0xE73DDF3D, 0xE73CDF3C, 0xE73DDF3C, 0xDF3DDF3C, 0xDF3DDF3C,
+0xE73DDF1C, 0xE73DDF3C, 0xDF3CDF1C, 0xE73DDF3C, 0xE73DDF3C, 0xE73DDF3C, 0xE73DDF3C, 0xDF3DDF3C,
+0xDF3CDF3C, 0xDF3DDF3C, 0xDF3CDF3C, 0xDF3DDF3C, 0xDF5DDF3C, 0xDF5DDF3C, 0xDF5DDF3C, 0xDF5DDF3C,
+0xDF3DDF1C, 0xDF3DDF1C, 0xDF3DDF1C, 0xDF3DDF3C, 0xDF3DDF1C, 0xDF3DDF1C, 0xDF3DDF3C, 0xDF3DDF3D,
+0xDF3DDF3C, 0xDF3DDF3C, 0xDF3DD71C, 0xDF3DDF3D, 0xDF3DD71C, 0xDF3DDF1C, 0xDF3CD71C, 0xE77DDF3D,
+0xEF7DE77D, 0xF77DEF7D, 0xEF9DEF7D, 0xEF7DEF7D, 0xEF9DEF7D, 0xEF9DEF7D, 0xEF9DEF7D, 0xEF7DEF7D,
+0xEF7EEF7D, 0xC619E75D, 0xEF9FF79F, 0xDF5EDF5E, 0xE73BD73C, 0xD40EFF1A, 0x9881A0A1, 0xF77EFEFB,
+0xEF9DEF7D, 0xEF7DEF7C, 0xEF9DEF9D, 0xF7BEEF7D, 0xEF7DEF7C, 0xEF7DE75C, 0xF79DEF7D, 0xF79EEF7D,
+0xEF7DEF7D, 0xF79EEF7D, 0xEF9DEF9D, 0xF79EEF7D, 0xEF7DEF7D, 0xF79EEF7D, 0xE75DE75D, 0xE73CE73C,
+0xE75DDF1C, 0xEF7DE75D, 0xEF7DE77D, 0xEF9EEF7D, 0xEF7DEF9D, 0xEF9EEF9D, 0xE71CE73C, 0xE73DDF3C,
+0xEF5DE75C, 0xEF7EEF5D, 0xEF7EEF7D, 0xE77EE75D, 0xE75DDF3D, 0xEF9EE77D, 0xE75DE75D, 0xEF5DEF5D,
+0xE77DE75C, 0xE75DE75D, 0xE77DE75C, 0xE77DE77D, 0xE75DDF3C, 0xE73DDF3C, 0xDF3DDF3C, 0xE73DDF1C,
+0xD6DCDF1C, 0xD6DCD6DB, 0xC659BE39, 0xD6DBCE9A, 0xD6DCCEBB, 0xCE9BCEBB, 0xBE3ABE3A, 0xBE3AB63A,
+0xBE7BC69B, 0xC69BC69B, 0xC69BC69B, 0xC69BC69C, 0xC69BC69B, 0xC69BCEBC, 0xC69BCEBC, 0xC6BBCEBC,
+0xCEBBCEBC, 0xCEBCCEDC, 0xCEBCCEBC, 0xCEDCD6DC, 0xCEDBD6DC, 0xCEDCD6FC, 0xCEDCD6FC, 0xD6FCD6FD,
+0xD6DCD6FD, 0xD6FCD6FD, 0xD6DCD6FC, 0xD6FCD6FD, 0xD6FCD6FD, 0xD6FCDF1D, 0xD6FCDF1D, 0xD6FCDF1D,
+0xD71CDF1D, 0xD71DDF1D, 0xD71CDF1D, 0xD6FCDF1D, 0xD6FCDEFC, 0xDF1CDF1D, 0xDF1CDF1D, 0xDF1DDF3D,
+0xD71CDF1D, 0xDF1DDF3D, 0xD71CDF3D, 0xDF1CDF3D, 0xDF3CDF3D, 0xDF1CDF3D, 0xD71CDF3D, 0xDF1CDF3D,
+0xDF3DDF3D, 0xDF3CE75D, 0xDF3CDF3C, 0xCEFBDF3D, 0xBE7AC67A, 0x9534C69A, 0x95138CD3, 0xA595A596,
+0x9D55ADB6, 0xBE998CB3, 0x9D549D75, 0xBE59ADB7, 0x8472B5D8, 0x39E95B0D, 0x632E4209, 0x5ACC738F,
+0xE77E8432, 0x7C31EF9F, 0xF7FF2967, 0xDF1CE73D, 0xDF3CE73D, 0xE73CE73D, 0xDF3CE73D, 0xDF3DE73D,
+0xDF3CE73D, 0xE73DE73D, 0xDF3CE75D, 0xE73DE75D, 0xDF3CE73D, 0xDF3CE73D, 0xDF3CE75D, 0xDF3CE75D,
+0xDF3CE75D, 0xDF3CE75D, 0xDF3CE75D, 0xDF3CE75D, 0xDF3CE73D, 0xDF3CE73D, 0xDF3CE73D, 0xDF3CE73D,
+0xDF3CE75D, 0xDF3CE73D, 0xDF3CE73D, 0xE75DE75D, 0xDF3DE75D, 0xE73DE75D, 0xDF3CE75D, 0xE73DE75D,
+0xDF3CE73D, 0xDF3CE75D, 0xDF3CE73D, 0xE73DE75D, 0xDF3CE73D, 0xDF3CE73D, 0xDF3CE73D, 0xEF9EEF7E,
+0xEF7DEF9E, 0xEF7DF79E, 0xEF9DF7BE, 0xF79DF7BE, 0xEF7DF79E, 0xEF9DEF9E, 0xEF7DF79E, 0xEF9DF79E,
+0xEF7DF77E, 0xBE18EF7E, 0xEF5EF79F, 0xE75DE75E, 0xF75BE77D, 0xB267FF7B, 0xB185A060, 0xE75DFF5D,
+0xEF9DEF9E, 0xEF5DEF7D, 0xEF5DEF7D, 0xEF7DEF7D, 0xEF5DEF7D, 0xEF7DEF7D, 0xEF9DF79E, 0xEF7DF79E,
+0xEF7DF79E, 0xEF9DF79E, 0xEF7DF79E, 0xEF9DF79E, 0xEF9DEF9E, 0xE75DEF7E, 0xDEFCE73D, 0xDEFCE71C,
+0xE73CE73D, 0xE75DE75D, 0xEF7DEF7D, 0xEF7DEF7E, 0xE75CEF7D, 0xEF7DEF7E, 0xE73CEF5D, 0xE73CE75D,
+0xEF5DEF5D, 0xEF7DEF7D, 0xE75DEF7E, 0xE75DEF7E, 0xE75DEF7E, 0xE75DEF9E, 0xE73CEF5D, 0xE71CEF5D,
+0xE77DEF5D, 0xE75DEF7E, 0xE75DE77D, 0xE75DEF7D, 0xE73CE75D, 0xDF1CE73D, 0xDEFCDF1C, 0xDF1CDF1C,
+0xD6FCDF1C, 0xDEFCDF1C, 0xC659D6BB, 0xDEFCD6FC, 0xD6DBD6DB, 0xCE9BD6DC, 0xBE3AC67B, 0xADD9BE1A,
+0xC69BBE7B, 0xC69BBE7B, 0xC69BBE7B, 0xC69BBE7A, 0xC69BC69B, 0xCEBBC69B, 0xCEBBC6BB, 0xCEBBC69B,
+0xCEBBCEBB, 0xCEBCC69B, 0xCEBCCEBC, 0xCEBCC6BC, 0xCEDCCEBC, 0xCEDCCEDB, 0xCEDCCEDC, 0xCEDCCEDC,
+0xD6FCCEDC, 0xD6DCCEDC, 0xD6FCCEDC, 0xD6FCCEDC, 0xD6FCD6FC, 0xD6FCCEFC, 0xD71CD6FC, 0xD71CD6FC,
+0xD71DD6FC, 0xD71DD6FC, 0xD71DD6FC, 0xD6FCD6FC, 0xD71CD6FC, 0xD71CD6FC, 0xDF1DD71C, 0xDF1DD71C,
+0xDF1CD71C, 0xDF1CD71C, 0xDF1CD71C, 0xDF3DD6FC, 0xDF3DDF1C, 0xDF1CD71C, 0xDF1CD71C, 0xDF1DD71C,
+0xDF3DD71C, 0xDF1DD71C, 0xDF3DD71C, 0xD71CDF3C, 0x9534ADD7, 0x74317430, 0x9D758D14, 0xCEDAADF6,
+0xAD96BE79, 0x95149D54, 0x94F494F3, 0x73F08CB2, 0x845273F0, 0x8C937C32, 0x84328CB4, 0x6B6F8473,
+0xF7BF5B0D, 0xCE9AE75D, 0xEF9E73AF, 0xE75DDF1C, 0xE73DE73C, 0xE73CE73C, 0xE75DDF3C, 0xDF3DDF3D,
+0xE73DDF3C, 0xE73DDF3C, 0xE75DDF3D, 0xE73DDF3C, 0xE73DDF3C, 0xE73DDF3C, 0xE75DDF3C, 0xE73DDF3C,
+0xE73DDF3C, 0xE73DDF3C, 0xE73DDF3C, 0xE73DDF3C, 0xE75DDF3C, 0xE73DDF3C, 0xE75DDF3C, 0xE73DDF3C,
+0xE73DDF3C, 0xE73DDF1C, 0xE75DE73C, 0xEF7DE75D, 0xEF7EE75D, 0xE75DE75D, 0xE75DE73D, 0xE75DE73D,
+0xE75DDF3C, 0xE75DDF3C, 0xE75DE73C, 0xE73DDF3C, 0xE75DE73D, 0xE75DE73D, 0xEF7EE75D, 0xF79EEF7D,
+0xF79EEF9E, 0xF77EEF7D, 0xEF9DEF7D, 0xEF7DEF7D, 0xEF7DEF7D, 0xEF9EEF7D, 0xF79EEF9E, 0xEF9EEF7D,
+0xEF9DE77D, 0xB5F7E77D, 0xE73DE73D, 0xDF3DDF1C, 0xF73BDF3C, 0x9942FEB7, 0xD2CBA080, 0xE75DFF5D,
+0xEF9EE75D, 0xEF7DE77D, 0xEF9EEF9D, 0xEF7DE75C, 0xEF9EEF7D, 0xF79EEF7D, 0xEF9EEF9D, 0xF79EEF7D,
+0xF79EEF9D, 0xF79EEF7D, 0xF79EEF9D, 0xEF7DEF7D, 0xEF9DE77D, 0xDF3CE75C, 0xDF1CDF1C, 0xDF1CD6DB,
+0xE73DE73C, 0xE75DE73C, 0xEF7DE75D, 0xE73DE75D, 0xEF5DE75D, 0xEF5DE75D, 0xE73DE73C, 0xEF7DE73D,
+0xEF7DEF5D, 0xEF5DE75C, 0xEF7DE75D, 0xE75DE75D, 0xE75DE75D, 0xE75DE73C, 0xE75DE75D, 0xE73DDF1C,
+0xEF5DE75D, 0xE75DE73D, 0xEF5DE75D, 0xE73CE73C, 0xDF1CDF1C, 0xD6DBD6DB, 0xD6DCD6BB, 0xD6DCD6DB,
+0xDEFCD6BB, 0xD6FCD6DB, 0xC659CEBA, 0xD6DBD6DB, 0xD6BBD6DB, 0xC67ACE7A, 0xBE5ABE5A, 0xB63AB63A,
+0xBE7BC67B, 0xC67BC69B, 0xC67BC69B, 0xC69BC69B, 0xC69BCEBC, 0xC6BBCEBC, 0xC6BBCEBC, 0xC6BBCEBC,
+0xCEBBCEBC, 0xCEBBCEBC, 0xCEBCD6DC, 0xCEBCCEDC, 0xCEDCCEDD, 0xCEDBCEDC, 0xCEDCCEDC, 0xCEDCD6DC,
+0xCEDCD6FC, 0xCEDCCEDC, 0xCEFCD6FC, 0xCEFCD6FC, 0xCEFCD6FD, 0xCEDCD6FC, 0xD6FCD6FC, 0xD6FCD71C,
+0xD6FCD71D, 0xD6FCD6FD, 0xD71CDF1D, 0xD6FCD6FD, 0xD71CD71C, 0xD71CD71C, 0xD71CDF3D, 0xD71CDF3D,
+0xDF1CDF1D, 0xD6FCDF1D, 0xD6FCDEFC, 0xDF3DDF1D, 0xDF1CDF1D, 0xDF1CDF3D, 0xDF1CDF3D, 0xDF1CDF3D,
+0xDF3DE75E, 0xDF3CDF1D, 0xDF3CDF3D, 0xDF3CDF5D, 0xB639CEDC, 0xBE79BE59, 0xC6BACEFB, 0xBE59C69A,
+0xA555B5F7, 0xCE79BDF7, 0xF7FFDF1C, 0xEF7EEF9E, 0x94B3D6BB, 0xAD76A535, 0x5B0DA515, 0x31C839C9,
+0xEF9E8451, 0xE75DE73D, 0xE75DEF9F, 0xDF3CE73D, 0xE73CE73D, 0xDF3CE73D, 0xDF3CE75D, 0xDF3CE73D,
+0xE73DE75D, 0xE73DE75D, 0xE75DEF7D, 0xDF3CE75D, 0xE73DE75D, 0xDF3DE75D, 0xE75DE75D, 0xDF3DE75D,
+0xDF3CE75D, 0xDF3CE73D, 0xE73DE75D, 0xE73DE75D, 0xE73DE75D, 0xDF3CE73D, 0xE73DE73D, 0xE73DE73D,
+0xE73CE73D, 0xE75DE75D, 0xEF7DEF7E, 0xE77DEF7E, 0xEF7EF79E, 0xEF7DEF9E, 0xE75DEF7E, 0xEF5DEF7E,
+0xE77DEF5D, 0xEF7DEF7E, 0xEF7DEF9E, 0xE75DEF7D, 0xEF7DEF7D, 0xEF7DEF7E, 0xEF9EF79E, 0xEF9EF79E,
+0xEF9EEF9E, 0xEF7EF79E, 0xEF7DF79E, 0xEF7DEF7E, 0xEF5DF77E, 0xEF7DEF7E, 0xEF7EF7BE, 0xEF7DF79E,
+0xEF9DEF7D, 0xADD7E79D, 0xE73DE75D, 0xDF3CE75D, 0xFF3BE75D, 0x98E0FD72, 0xEC30A0E2, 0xE75DFF3D,
+0xEF9DEF7E, 0xE73DEF7E, 0xDF1CE75D, 0xE75DE71C, 0xE77DEF9E, 0xE77DEF7E, 0xEF9EEF9E, 0xEF5DF79E,
+0xEF9EF79E, 0xEF7DF79E, 0xEF9EF79E, 0xDF3CEF7D, 0xE75DE77D, 0xD6DBDF3C, 0xD6FCDF1C, 0xD6FCD6DC,
+0xE73DE71C, 0xEF5DEF5E, 0xEF5DEF5E, 0xE73DEF5D, 0xEF5DEF5D, 0xE73DEF5E, 0xE73DE73D, 0xEF5DE75D,
+0xE75DEF7E, 0xE73CEF3D, 0xEF5DEF7E, 0xE75DEF5D, 0xDF3CE75D, 0xE73DDF1C, 0xDF1CE73D, 0xE73DDEFC,
+0xEF5DEF7E, 0xE73DEF5D, 0xE73DEF5D, 0xDEFCE71D, 0xD6DBDEDC, 0xDEFCDEFC, 0xD6BBDEDC, 0xCEBBD6DC,
+0xD6FCD6DC, 0xCEBAD6BB, 0xC639D6BA, 0xD6BBDF1C, 0xCE9BD6DB, 0xCE9BCE9B, 0xC67ACE9B, 0xB61ABE5B,
+0xBE7BBE7B, 0xBE9BBE7B, 0xC67BBE7A, 0xC69BBE7A, 0xC69BBE7B, 0xC69BBE9B, 0xC6BCC69B, 0xCEBCC69B,
+0xC6BBC69B, 0xC67BC6BB, 0xCEBCC69B, 0xCEBCCEDC, 0xCEDCCEBC, 0xCEDCCEBB, 0xCEDCCEBB, 0xD6FCCEDC,
+0xD6DCCEDC, 0xD6FCCEDC, 0xD6FCCEDC, 0xD6FCCEFC, 0xD6FCCEDB, 0xD6FCD6FB, 0xD6FCCEDB, 0xD6FCD6FB,
+0xD6FCD6FC, 0xD6FCD6FC, 0xD71CCEDB, 0xD6FCCEDB, 0xD6FCCEDB, 0xD6FCD6FC, 0xD6FCD6FC, 0xD6FCD6FC,
+0xDF1CD6FC, 0xD6DCD6FC, 0xD6FCCEDB, 0xDF1DD6FC, 0xDF1CD6FC, 0xE73DDF1C, 0xE73DDF3C, 0xE73DDF3D,
+0xE75DDF3D, 0xDF3CDF1C, 0xDF3CDF3C, 0xDF3DE77E, 0xBE5ABE5A, 0xBE59BE59, 0xD71CBE59, 0xEFDFDF7E,
+0xF7DFF7DF, 0xFFBEFFBF, 0xFF9EFFDE, 0xFFDEFFDE, 0x49A7A4B2, 0x52286ACB, 0x42082924, 0x84104A6A,
+0xE73DADB6, 0xE73DE75D, 0xE73DDF1C, 0xE73DDF3C, 0xE73DDF1C, 0xE73DDF1C, 0xE73DDF3C, 0xE73DDF3C,
+0xE75DDF3C, 0xEF5DE73C, 0xEF7DE77D, 0xE73CE75D, 0xE73CDF3C, 0xE75DDF3C, 0xE75DDF3C, 0xE73DDF3C,
+0xE75DDF1C, 0xE75DE75D, 0xE75DE75D, 0xE73DE73D, 0xE73DE73D, 0xE73DE73C, 0xE75DDF3C, 0xE75DDF3C,
+0xE75DDF3C, 0xEF7DE75C, 0xEF7DE75D, 0xEF5DE75D, 0xEF7DEF7D, 0xEF5DEF7D, 0xEF5DE75C, 0xEF5DE75D,
+0xEF7DE73C, 0xEF9DEF7D, 0xEF9DEF7D, 0xEF9DEF7D, 0xEF7DEF5C, 0xEF7DEF7D, 0xEF9EEF7D, 0xEF9EEF7D,
+0xE75DE73D, 0xEF7EE75D, 0xEF7EE77D, 0xEF5DE75D, 0xEF7DEF7D, 0xEF5DE75D, 0xF79EEF7D, 0xEF5DEF7D,
+0xEF7EE73D, 0xB5D7EF7D, 0xE75DE75D, 0xE73DDF1C, 0xFF1BE73C, 0xB961EBAA, 0xFE179922, 0xEF5DFF3C,
+0xE75CEF7D, 0xE73DE73C, 0xDEDBDF1C, 0xE75DDF1C, 0xE75DE73C, 0xEF7EE75D, 0xEF7DE75D, 0xEF7EEF5D,
+0xEF5DE75C, 0xEF9EEF7D, 0xE73CE75D, 0xDEFCDEFB, 0xD6FCD6DB, 0xD6FCD6FB, 0xD6FCD6FB, 0xDEFCD6FC,
+0xE73DDEFB, 0xE73DE73C, 0xEF5DE73C, 0xE73DE73D, 0xE73DDF1C, 0xE73DE73C, 0xE73CDF1C, 0xE75DE73C,
+0xE75DE75D, 0xE71CDF1C, 0xE71CDF1C, 0xE75DDF1C, 0xE73DDF1C, 0xDEFCDEFC, 0xDEDCD6DB, 0xE73DD6FC,
+0xE75DE75D, 0xE73DE73C, 0xDF1CDF1C, 0xD6DCDEFC, 0xD6DCD6DB, 0xDEFCD6DB, 0xDEFCD6FC, 0xD6BBD6BB,
+0xD6BBD6DC, 0xCEBBCEBB, 0xBE18CE9A, 0xD6BCD6BB, 0xCE9BC69A, 0xCE9BC67B, 0xC65AC65A, 0xBE3BBE1A,
+0xBE7BBE9B, 0xBE9BBE7B, 0xBE7BC67B, 0xC69BCEBC, 0xC69BC6BC, 0xC6BCCEBC, 0xC69BC69B, 0xCEBCCEDC,
+0xC6BBCEDC, 0xC6BBCEDC, 0xCEBBCEDC, 0xCEBCCEDC, 0xCEBCCEDC, 0xCEDCD6DC, 0xCEDCD6DC, 0xCEDBD6FC,
+0xCEDCD6DC, 0xD6FCD6FD, 0xCEDCD6FC, 0xD6FCD6FC, 0xD6FCD6FC, 0xD6FCD71C, 0xD6FCD6FC, 0xD6FCDEFC,
+0xD6DCD6FC, 0xD6FCDF1D, 0xD6FCD71C, 0xD6FCD71C, 0xD71CDF3D, 0xD6FCDF1D, 0xD71CDF1D, 0xD6FCDF1D,
+0xDEFCDF3D, 0xCEBBDEFC, 0xCEBBCE9B, 0xD6FCD6FC, 0xDF1CDEFC, 0xE73DE73D, 0xDF3CE73D, 0xE71DE73D,
+0xDEFCDEFD, 0xDF1CE73D, 0xDF3DE75D, 0xD6BCEF9F, 0xBE1ABDF9, 0xBE3ABE1A, 0x7C32A557, 0x6B706B90,
+0xB5978412, 0xE6DBEF3E, 0x8BEFC5B7, 0x39445A48, 0x41654144, 0x31244986, 0xF7DFEF5C, 0xEF7EF79E,
+0xE75DEF7E, 0xE73DE73D, 0xDF3CE75D, 0xDEFCE75D, 0xE75DE73D, 0xEF7EEF9E, 0xE73CE75D, 0xE73CE75D,
+0xE75DEF5D, 0xE75DEF5D, 0xE75DEF5D, 0xE75CEF5D, 0xE75DE77D, 0xE75DEF7D, 0xE75DE77D, 0xE73DE75D,
+0xE75DE73D, 0xE75DEF7E, 0xE75DE75D, 0xE73DEF5E, 0xE73CE73D, 0xE75DEF5D, 0xE75DEF7E, 0xE75DE75D,
+0xE75CE75D, 0xE75DEF5D, 0xE75CEF5D, 0xE75DEF5D, 0xEF7DEF7D, 0xEF5DEF7E, 0xE75DEF5D, 0xE73CEF5D,
+0xE73CE73C, 0xEF7DEF7D, 0xEF7DF79E, 0xEF7DF77E, 0xEF7DF79E, 0xEF7DF79E, 0xEF7DEF7D, 0xEF5DEF7E,
+0xE75DE75D, 0xE77DEF5E, 0xE75DEF7E, 0xE75DEF7E, 0xE75CEF7D, 0xE75DEF5D, 0xE73CEF5D, 0xE73CE73D,
+0xEF7DEF5D, 0xB5B7EF7E, 0xE73CE75D, 0xE73CE73D, 0xFED8F75B, 0xB0C0D204, 0xFF1BB2A8, 0xEF5DF6FB,
+0xE73CEF5D, 0xE73CE75D, 0xDEFCE73C, 0xE73CE73D, 0xE75DEF5D, 0xEF5DEF7E, 0xEF5DEF7E, 0xEF7DEF7E,
+0xEF5DEF5D, 0xEF5DEF7E, 0xDF3CEF5D, 0xDEFCE71D, 0xDEFCDEFC, 0xD6FCDF1D, 0xD71CDF1C, 0xDF3CE73D,
+0xE73DE75D, 0xE73CE75D, 0xE73CE75D, 0xE73DE73D, 0xDF1CE73D, 0xDF3CE73D, 0xE73CE73D, 0xE75DE75D,
+0xE75DEF7E, 0xE71CE73D, 0xDF1CE73D, 0xDEFCE71C, 0xDF1CE71C, 0xD6DBDEFC, 0xD6BBD6DC, 0xDF1CD6DC,
+0xDF3CE73D, 0xDEFCE71D, 0xD6DCDEFC, 0xD6DCDEFC, 0xD6BBDEDC, 0xD6DBD6BC, 0xD6DBDEDC, 0xDEFCDEFC,
+0xD6BBDEDC, 0xD6DBDEFC, 0xB5F7D6FB, 0xCE9BD6DC, 0xC67ACE9B, 0xCEBBCE9B, 0xC659CE9A, 0xBE3BC65B,
+0xBE7BBE7B, 0xBE7BBE9B, 0xC67BBE7B, 0xC67BC67A, 0xC67BBE5A, 0xC69BBE7A, 0xC69BC67A, 0xC67BC67A,
+0xC69CBE7B, 0xC69BC6BB, 0xCEBBC69B, 0xCEDCC6BB, 0xCEBCC6BB, 0xCEBCC6BC, 0xD6FCCEDC, 0xCEDBCEDB,
+0xD6FCCEDB, 0xD6FCCEDC, 0xD6FCCEDC, 0xD6FCCEDC, 0xD6FCD6FC, 0xD6FCD6FC, 0xDF1DD6FC, 0xD6FCD6FC,
+0xDF1DD6FC, 0xD6FCD6FC, 0xD6FCD6DC, 0xDF1DD6FC, 0xDF1DDF3D, 0xDF1DD6FC, 0xDF1DDF1D, 0xD6FCD6FC,
+0xE75DE75D, 0xDF1CDF1C, 0xD6FCD6DB, 0xDF1CD6DB, 0xDF1CD6FB, 0xDF3CDF1C, 0xE73CDF1C, 0xE73CDF1C,
+0xE75DDF1C, 0xE75DDF1C, 0xE75EE75D, 0x424CF7DF, 0x39EC31AA, 0x3A0C31CB, 0x424D4A6D, 0x39CC3A0C,
+0x18C62989, 0x4A0A18C5, 0xAD147BAF, 0x6AA9A4D2, 0x59E75A07, 0x49E849A6, 0xD6BBF79E, 0xDF1ED6BC,
+0xE75EE77E, 0xDF3DDF3D, 0xDF3DDF3D, 0xDF1CDF1C, 0xE77EDF3D, 0xE77DE77D, 0xDF1CDF3C, 0xDF1CD6FC,
+0xE75DDF3C, 0xE75DE73D, 0xE75DE75D, 0xE75DE73C, 0xEF7DE75D, 0xE75DE75D, 0xEF7EE75D, 0xE73DE75D,
+0xE75DDF3C, 0xE75DE75D, 0xE75DDF3C, 0xE73DE73C, 0xE73DDF1C, 0xE73DDF1C, 0xE73DDF3C, 0xE75DE73D,
+0xEF7EE77D, 0xE75DE75D, 0xE77DE75D, 0xEF5DE75D, 0xEF7EE75D, 0xEF5DE75D, 0xEF5DE75D, 0xE73DE73C,
+0xE73DE73C, 0xEF9EE75D, 0xEF9EEF9E, 0xF79EEF7D, 0xF79EEF7D, 0xEF7DEF7D, 0xEF9EEF7D, 0xEF7DEF7D,
+0xEF5DE75D, 0xEF5DE75D, 0xEF7DE75D, 0xE75DE75D, 0xE73DE73D, 0xE73DDF1C, 0xE75DE73D, 0xEF5DE73C,
+0xEF9EE75C, 0xADD7E77D, 0xE73CDF3C, 0xEF5BDF1C, 0xFDD1F757, 0xC0A1C0E0, 0xFF5DDC91, 0xE75DDEDB,
+0xE75DE73C, 0xE73DE73C, 0xE73DDF1C, 0xE73DDF1C, 0xE75DE75D, 0xE75DE75D, 0xEF7DE75D, 0xE75DE75C,
+0xEF7DE75D, 0xE75DE75D, 0xE73CE73C, 0xDF1CDF1C, 0xE73CDF1C, 0xE73DDF3C, 0xDF3CDF1C, 0xE75DDF1C,
+0xDF3DDF3C, 0xDF1CD71C, 0xDF1CDF1C, 0xDF1DD6FC, 0xDF1CDF1C, 0xDF3DDF1C, 0xE77DDF3D, 0xE75DE75D,
+0xE75CE75D, 0xE73CDF1C, 0xE73CDF3C, 0xDEFCDF1C, 0xDF1CD6FB, 0xD6FBD6FB, 0xD6DCD6FB, 0xD6FCCEDB,
+0xDEFCD6FC, 0xD6DBD6DB, 0xD6DCCEBB, 0xCEBBCEBB, 0xCE9BCE9B, 0xCEBBCE7B, 0xCEBBCE9B, 0xDEFCCEBB,
+0xD6DBD6DB, 0xD6DBCEDB, 0xB5F7CEB9, 0xCE9BCE9A, 0xC67AC67A, 0xD6FBCE9A, 0xD6DBD6DA, 0xCEBCCEBB,
+0xB63ABE5B, 0xBE7BC69C, 0xC67BCE9B, 0xC69BC67A, 0xCEBBCEBB, 0xCE9BCE9B, 0xD71CD71D, 0xCEBBD6DB,
+0xC67BCEBC, 0xC67AC6BB, 0xC6BBC6BB, 0xCEDCCEDB, 0xCEDCD6DC, 0xCEBCD6DD, 0xCEDCD6DC, 0xCEDBD6DC,
+0xCEDCD6FC, 0xCEDCD6FC, 0xD6FCD6FD, 0xCEDCD6FC, 0xD6FCD6FD, 0xD71CD6FD, 0xDF1DDF3D, 0xDF3DDF3D,
+0xE75EE77E, 0xD6DCDF1D, 0xCE9BD6BB, 0xD6DCD6FC, 0xD6DCDF1D, 0xD6FCD6DC, 0xD6DCDEFD, 0xDF1CD6FC,
+0xE73DE75D, 0xE73DE75D, 0xDEFCE73D, 0xDEFCDEFC, 0xDF1CDF1C, 0xDF1CE73D, 0xE73CE73C, 0xE73CE73D,
+0xE75DE73D, 0xE77DEF7D, 0xDF3EEF9F, 0x298AD6BD, 0x39CC39EC, 0x422D39CD, 0x39ED422E, 0x39ED39CD,
+0x39CA420D, 0x210639A9, 0x102120C4, 0x31241841, 0x41864186, 0x83F049C7, 0xDEFDEF5E, 0xD6FDDEFD,
+0xDF3DDF3E, 0xCEBBDF1D, 0xD71CDEFC, 0xD6FCDEFC, 0xDF3DE73D, 0xDEFCDF3D, 0xDF1CDF1C, 0xDF3CDF3D,
+0xE75DE73D, 0xE73DE75E, 0xDF3CE75D, 0xDF3CE73D, 0xE75DE73D, 0xE75DE75D, 0xE75DEF5D, 0xE73DEF5D,
+0xE75DE75D, 0xDF3CE75D, 0xE73DE75D, 0xDF3CE75D, 0xDF1CE75D, 0xD6DBDEFC, 0xDF1CDF1C, 0xE75DE75D,
+0xE77DEF7E, 0xE77DEF7E, 0xE77DEF7E, 0xE75DEF7E, 0xE75DEF5D, 0xE73DEF5D, 0xE75DEF5D, 0xE73DEF5D,
+0xE73DE73D, 0xEF5DEF5D, 0xEF7DEF7E, 0xEF7DEF7E, 0xEF9EF79E, 0xEF7DEF9E, 0xEF7DEF7E, 0xEF5DEF7E,
+0xEF5DEF7D, 0xE75DEF5D, 0xEF5DEF7E, 0xE75DEF5D, 0xE73DE75D, 0xDF1CE71D, 0xE75DE75E, 0xDF1CE73D,
+0xEF9DE75D, 0xADD7EF9E, 0xDF3CDF3C, 0xE71ADF1C, 0xCBE8FF76, 0xC103C8E0, 0xDEFCFE7A, 0xDF5DD6FC,
+0xEF7DE75D, 0xDEFCE73D, 0xDF1CDEFC, 0xDF1CE71D, 0xE75DE75D, 0xE75DE75D, 0xE75DEF5D, 0xDF1CE73D,
+0xE75DE73D, 0xE73DEF5D, 0xDF1CE73D, 0xE73CE73D, 0xE73CE73D, 0xE75DEF5D, 0xE73DE75D, 0xDF1CE73D,
+0xDF3CE73D, 0xD71CDF3C, 0xDF1CE73D, 0xDF1CDF1C, 0xDF1CDF1D, 0xDF3CDF1C, 0xE75DE77E, 0xDF3CE75D,
+0xDF1CE75D, 0xDF3CDF1C, 0xE75DE75D, 0xDF1CE75D, 0xDF1CDF3C, 0xD71CDF1C, 0xD6DCDF1D, 0xCEBBCEDB,
+0xD6DCDEFC, 0xCEBBD6DC, 0xCEBBD6BC, 0xCE7BD69B, 0xC67ACE9B, 0xC67ACE7B, 0xCE9ACE9B, 0xCEDBCEBB,
+0xD6BBD6DC, 0xCEDBCE9B, 0xB5F7CE9A, 0xCE7ACE9A, 0xCE9AD6BB, 0xDEFCD6DB, 0xD6FADF1B, 0xD6DCD6FC,
+0xBE5BBE3A, 0xCEBCBE19, 0xD6FCCEBB, 0xDEFCCEBB, 0xDF1CDF3C, 0xDF1CD6FB, 0xE75DDF1C, 0xDEFBDF1B,
+0xC69AD6DB, 0xC67ABE59, 0xD6FCC69B, 0xE75ED71C, 0xDF5DDF3C, 0xD6FCDF1D, 0xD6BCCEBB, 0xDEFDD6BC,
+0xD6FCCEBB, 0xD6DCCEDB, 0xD6FCCEDB, 0xD6FCCEDC, 0xD6FCD6FC, 0xDF1DD6FC, 0xD6FCD71C, 0xDF1DD6FC,
+0xD6FCCEDB, 0xD6DCCEBB, 0xCEBCCEBB, 0xDF1DDEFC, 0xD6BBD6BB, 0xD6DCD6BB, 0xCEBBCEBB, 0xE73DD6DC,
+0xE73CDF3C, 0xE75DE73C, 0xDF1CDF3C, 0xE73CDF1C, 0xDF1CDF1C, 0xDF1CDF1C, 0xE73CDF1C, 0xE73CDF1C,
+0xDEFCE73C, 0xE75DDF3C, 0xF7DFDF1D, 0x298A52CE, 0x212A2149, 0x3A0D298B, 0x422E3A0D, 0x298A31AC,
+0x21272108, 0x210618C6, 0x21062126, 0x18832105, 0x08011021, 0xD69A1042, 0xDEFCDF1C, 0xDEFCD6DC,
+0xD6FCDF1C, 0xD6DCCEDB, 0xD6DCCEBB, 0xD6FCCEDB, 0xD6DCCEDB, 0xD6DBCEDB, 0xDF1CD6DB, 0xE75DDF3D,
+0xE75DDF3D, 0xDF3DDF3D, 0xDF1CD6FC, 0xDF1CD6FC, 0xE73DDF1C, 0xE75DDF3C, 0xE73DE73C, 0xE75DE73C,
+0xE73CE75C, 0xE73DDF1C, 0xE75DDF3C, 0xE75DDF3C, 0xE73CDF3C, 0xDEFCD6FB, 0xDF1CD6FB, 0xE75DDF3C,
+0xEF7DE75D, 0xEF7EE77D, 0xE77DE75D, 0xE75DE75D, 0xE73DDF3C, 0xE73DDF3C, 0xE75DDF3C, 0xE75DE75D,
+0xEF5DE75D, 0xEF5DE75D, 0xEF7DE75D, 0xEF7EE75D, 0xEF7EE75D, 0xEF7DEF7D, 0xE73DE73C, 0xE75DE73D,
+0xEF7DE75D, 0xEF5DE75C, 0xEF5DE75C, 0xE75DE75D, 0xDF1CDF1C, 0xDF1DDF1C, 0xE75EDF3D, 0xD6FCDF1C,
+0xEF7DE73C, 0xADB7E75D, 0xD71CD6FB, 0xEED9D6DB, 0xB1E2FE53, 0xEB4DC143, 0xD6BCFEBC, 0xDF3CCEDC,
+0xEF7EDF3C, 0xDEFCDF3D, 0xDF1CD6DB, 0xDF1DDEFC, 0xE75DDF3C, 0xE75DE73C, 0xE75CDF3C, 0xDF1CDF1C,
+0xDF1CD6FB, 0xE73DDF1C, 0xE73CDF3C, 0xEF5DE71C, 0xE71CDF1C, 0xE73DDF1C, 0xE71DDF3C, 0xDEFCDEFC,
+0xDF1CD6DB, 0xDEFCDEFB, 0xDF1CDEFC, 0xDEFCDEFC, 0xDF1CDEFB, 0xE71CDEFC, 0xE73CE71C, 0xE73CE71C,
+0xDF1CDF3C, 0xE73DDEFC, 0xE73DDF1C, 0xDF1CDF3C, 0xDF1CD71B, 0xD71CD6FC, 0xD6FCD71C, 0xD6DCCEDB,
+0xD6DBD6BB, 0xD6BBD6BB, 0xD6BBCE9B, 0xCE9BCE9B, 0xCE9BC67A, 0xC67AC67A, 0xCE9BC65A, 0xCEBBCEBB,
+0xCE9BC67A, 0xCEDBC67A, 0xBDF8C659, 0xCE7AC659, 0xCE9BC69A, 0xDEFCCEDB, 0xD6DAD6DA, 0xCEDBCEBA,
+0xBE5ABE3B, 0xC69BB5F9, 0xD6FCDF3D, 0xD6FCE73E, 0xCE9AD6DC, 0xE75DE75D, 0xD6FBD6DB, 0xDEFBE73C,
+0xDF1CDF1C, 0xD6DBDEFC, 0xD6FCD6DC, 0xC65ACEBB, 0xCEDBCE9A, 0xE73DE73D, 0xD6DCE71D, 0xCE9BD6BC,
+0xCEDCD6DC, 0xCEDCD6FC, 0xCEBBCEDC, 0xD6FCD6FC, 0xD6FCDF1D, 0xDF1DDF1D, 0xCEBBDF1D, 0xD6DCD6BC,
+0xD6FCD6DC, 0xD6FCD6FC, 0xD6FCDF1D, 0xD6DCDF1D, 0xDEFCDEFC, 0xD6DCDF1D, 0xCE9BD6BB, 0xDEFCD6DC,
+0xD6FBDEFC, 0xDF1CDF1C, 0xDF1CE73D, 0xDF1CDF1C, 0xDF1CDF1C, 0xDF1CDF1C, 0xDF1CDF3C, 0xDEFCE71C,
+0xDEFCDF1C, 0xDF1DE73D, 0xADB9E73E, 0x39EC39EB, 0x296B420D, 0x3A0D422E, 0x318B39ED, 0x298A31AB,
+0x212731AA, 0x21062948, 0x10A418C6, 0x10A418A5, 0x106318A4, 0xD69A0802, 0xD6FCE73D, 0xD6FCDEFC,
+0xD6FCD6BB, 0xD6FCD6FC, 0xD6DCD6FC, 0xD6FCD6DC, 0xD6FCD6FC, 0xD6FCDF1D, 0xD6DBD6FC, 0xDEFCDF1C,
+0xD71CDF1D, 0xDF1CDF1D, 0xD71CDF1D, 0xD6FCDF1C, 0xDF1CDF3D, 0xE73DE73D, 0xE73CE75D, 0xEF5DEF5D,
+0xE73CEF7E, 0xE73DE73D, 0xE73CE75D, 0xE75DE75D, 0xDF3CE75D, 0xDF1CDF1C, 0xD6FBDF1C, 0xE73DE73D,
+0xE75DEF5D, 0xE75DEF7E, 0xE75DE77D, 0xE73CE75D, 0xDF1CE73D, 0xDF1CE73D, 0xDF3CE73D, 0xE75DE75D,
+0xEF7DEF7E, 0xE75DEF7E, 0xE75DE75D, 0xE75DEF7E, 0xE75DE75D, 0xE73DEF5D, 0xDF1CE73D, 0xE73DE73D,
+0xEF5DEF7D, 0xE75CEF7D, 0xE75DEF5D, 0xE75DEF7D, 0xD6FCE73D, 0xDEFCDEFC, 0xD6FCDF1D, 0xDEFCDF1D,
+0xEF7DE73D, 0xAD96EF7E, 0xCEDBD6DB, 0xF698D6DA, 0xC1A2F44D, 0xFD76C1C6, 0xCE7BEE5B, 0xCEDBD6DC,
+0xE75DDF1C, 0xDEFCE73D, 0xDF1CDF1C, 0xDF1CDF1C, 0xDF3CE75D, 0xE73CE75D, 0xDF3CE73D, 0xDF1CE73D,
+0xDEFCE73D, 0xE73DE73D, 0xE75DEF7E, 0xE73DEF3D, 0xDF1CE73D, 0xDEFCE71C, 0xDEFCDEFC, 0xD6DCDEFC,
+0xD6DBD6DC, 0xD6DBDEFC, 0xDEFCDEFC, 0xDEFCE71D, 0xDEFCDEFC, 0xDEFCE71C, 0xDEFCE71C, 0xE71CE71C,
+0xDEFCE73D, 0xDF1CE71C, 0xDF1CDF1C, 0xDEFCDF1C, 0xD6DBDF1C, 0xCEDBD6DC, 0xD6FCD6FC, 0xD6FCD6FC,
+0xD6DCDEFC, 0xD6DCDEFC, 0xD6DCDEDC, 0xD6DCDEFC, 0xCEBBD6BC, 0xCE9BD6DC, 0xCEBBCEBC, 0xC65ACE9B,
+0xC65AC65A, 0xBE5AC67B, 0xB5D7C639, 0xC67AC63A, 0xC67AC67B, 0xD6DCD6DC, 0xD6BBD6DB, 0xCEBBD6DB,
+0xADD9A5B8, 0xADF9A598, 0xCE9BCEBC, 0xC67ACEDB, 0xB619B5F8, 0xD6FCCEBB, 0xD6DBC679, 0xE73DDF1C,
+0xE77EDF3D, 0xCE9BCEDB, 0xCEDBC67A, 0xBE39C69B, 0xC65AB619, 0xCEBCC67A, 0xCEBCCEBB, 0xD6DCCE9B,
+0xD6DCCEDB, 0xCEBBCEBB, 0xCE9BCE9A, 0xD6DCCEBB, 0xDEFCD6FC, 0xDEFCD6DC, 0xD6DCD6FC, 0xCE9BCE9A,
+0xD6DCCEBB, 0xD6FCCEBB, 0xE73DDF1D, 0xDF1CDF3D, 0xDF1DDEFC, 0xDEFCDF1C, 0xD6BBCEBB, 0xD6BBCEBB,
+0xD6FCD6DB, 0xDF3CD6FB, 0xDF3DDF3D, 0xDF1CD6FC, 0xD6FCD6FC, 0xD6FCD6FC, 0xDF1DD6FC, 0xD6FCD6FC,
+0xDEFDD6DC, 0xD6FDD6DC, 0x424CE75F, 0x426E3A0C, 0x422E3A0D, 0x422D424E, 0x422D31CB, 0x31CB39EB,
+0x29682989, 0x18E618E6, 0x18E51906, 0x18A410C4, 0x10431043, 0xBDF80001, 0xDF1CDF3D, 0xD6DBD71C,
+0xDF1DCEDB, 0xCEBBCEBB, 0xD6FCD6DC, 0xD6FCD6DC, 0xE73DDF1C, 0xDF1DDF1D, 0xD6FCD6FC, 0xD6FCD6DB,
+0xD6DCCEDB, 0xD6FCCEDB, 0xDF1DD6FC, 0xDF1CD6FC, 0xDF3DDF1C, 0xE73DDF1C, 0xE73DDF1C, 0xEF5DE73D,
+0xE75DE75D, 0xE73DDF3C, 0xE75DDF3C, 0xE75DDF3C, 0xE75DE73C, 0xDEFCD6DB, 0xDEFCDEFC, 0xDF3CDF1C,
+0xEF5DE73D, 0xE75DE75D, 0xEF5DE75D, 0xE73CDF3C, 0xDF1CDF1C, 0xDF1CDEFC, 0xE73DDF1C, 0xE73DDF1C,
+0xE75DE73C, 0xE73DE73C, 0xE75DE73C, 0xE73CE73C, 0xE75DE73C, 0xE73CE73C, 0xE73CE73C, 0xE75DE73C,
+0xEF5DE75C, 0xEF5DE73C, 0xE75DE75C, 0xE75DE73C, 0xDF1CDF3D, 0xD6DCD6DB, 0xCE9BCEBB, 0xD6BBC69A,
+0xEF9EDF1C, 0xADB6E77D, 0xCEDBC6BA, 0xFE96CE98, 0xD1E6CA26, 0xF619C30B, 0xCEBCDE7B, 0xD6DBC69B,
+0xDF1CD6DB, 0xDEFCDEFC, 0xDF1DDF1C, 0xDEFCD6FB, 0xE73DDF1C, 0xDF1CDF1C, 0xDF1CDF1C, 0xDF1CDF1C,
+0xDF1DDF3C, 0xDF3DD71C, 0xE73DDF3C, 0xDF1CDEFC, 0xDF1CDF1C, 0xD6DCD6DB, 0xD6DCD6DB, 0xCEBBCEBB,
+0xCEBCCEBB, 0xCEBCCE9B, 0xD6FDCEDC, 0xDEFDD6DC, 0xDEFCD6DC, 0xDEFCD6DC, 0xDEFCDEFC, 0xDEFCDEDC,
+0xDF1CD6FC, 0xDEFCDEDC, 0xDEFCDEFC, 0xDEFCD6DB, 0xD6DCDEFC, 0xCEBBCEBB, 0xCE9BCE9A, 0xCE9BC69A,
+0xCE7BC67A, 0xCE7BC67A, 0xC67BC67A, 0xC67BC65A, 0xC69BC67B, 0xC69CC67B, 0xC67BC69B, 0xB619B63A,
+0xBE5AB619, 0xB5F9B63A, 0xB5D8B5F8, 0xBE3AB5D8, 0xC67BBE5A, 0xCE9BC67B, 0xCE9BC67A, 0xBE7AC67A,
+0x9D579537, 0xADB89D78, 0xC67BBE1A, 0xB619BE3A, 0xB5F9BE3A, 0xB619BE39, 0xD71CCE9B, 0xDF1CDF1C,
+0xD6FCE75D, 0xCEBBC65A, 0xD6FCDF1D, 0xBE59CEDC, 0xB639BE39, 0xCEBBC67A, 0xCEDBD6FC, 0xD6DCD6DC,
+0xCEBBD6FC, 0xCE9BCE9B, 0xCE9ACEBB, 0xCEBBCEBB, 0xD6DCDEFC, 0xD6DCD6DC, 0xD6FCDEFD, 0xCE9BD6DC,
+0xCEBBD6DC, 0xCE9BCE9B, 0xDF3DDEFD, 0xDF1CE75D, 0xDF3DDF1D, 0xDEFCE73D, 0xDEFCDF1C, 0xD6DBDEFC,
+0xD6DBD6DC, 0xD6DCD6FC, 0xD6DCDEFC, 0xCEBBD6DC, 0xCEBBD6DC, 0xCEBBCEBC, 0xD6DCD6DC, 0xCEDCD6DC,
+0xCEBCD6BC, 0xD6DDD6BD, 0x31CBA559, 0x31EC3A0D, 0x3A0D424F, 0x39EC420E, 0x31CB420D, 0x298931AB,
+0x29882989, 0x21272148, 0x18E52947, 0x18C41084, 0x188320C5, 0xE75D0001, 0xDF3DDF5D, 0xD6FCD6FC,
+0xCEDCD6FC, 0xD6FCD6FC, 0xD6DCD6FC, 0xD6FCE75E, 0xD6FCDEFC, 0xD6DBDEFC, 0xD6FCD6FC, 0xDF1CDF1D,
+0xD6DBDF1C, 0xCE9BD6BB, 0xD6DBD6BC, 0xDEFCDEFC, 0xDF1CDF1D, 0xDEFCDF1D, 0xDF3CDF1D, 0xDF1CE73D,
+0xE75DE73D, 0xDF1CE75D, 0xE75DE73D, 0xE75DEF7D, 0xE73DE75D, 0xDF1CDEFC, 0xDF1CE73D, 0xDEFCE73D,
+0xE73CE73D, 0xE73CEF5D, 0xE73DEF5D, 0xDF1CE73D, 0xDEFCDF1C, 0xDEFCDEFC, 0xDF1CDF1C, 0xDF1CDF1C,
+0xE71CE73D, 0xE75DE73D, 0xE75DEF7D, 0xE75DEF5D, 0xE75DEF7D, 0xE73CE75D, 0xE75DEF5D, 0xE75DEF5D,
+0xE75CEF7D, 0xE73CEF5D, 0xE75DEF5D, 0xE73DE75D, 0xDF1CE73D, 0xD6FCDF1D, 0xD6DCDEFD, 0xCE7AD6BB,
+0xEF9EDF1D, 0xADB6EF9E, 0xCEB9CEBB, 0xFE75DEB6, 0xB0E3A8E1, 0xE69BFDD7, 0xD6FCDEDC, 0xD6DBDF1C,
+0xD6DBD6DB, 0xCEBAD6DB, 0xDEFCDF1D, 0xDEFCDEFC, 0xDEFCDF1C, 0xDEFCDF1C, 0xD6FCDF1C, 0xD6DBDEFC,
+0xD6FCD6FC, 0xD6DBD6FC, 0xD6DBD6FC, 0xD6DBD6DB, 0xD6DBD6DB, 0xCEDBD6DC, 0xCEBBD6DC, 0xC69BCE9B,
+0xBE7BC67B, 0xC67BC67B, 0xCE9BCEBC, 0xCE9CCE9C, 0xD6DCD6DD, 0xD6FCD6FD, 0xD6FCDF1D, 0xD6FCDEFD,
+0xDEFCDEFD, 0xD6DCDEFC, 0xD6FCDF1C, 0xD6FCDEDC, 0xD6DBDEFC, 0xD6BBD6DC, 0xD6BBD6DB, 0xCE7AD6BB,
+0xCE7BCE7B, 0xCE9BCE9B, 0xC65ACE9B, 0xBE5AC65B, 0xB5F9BE5B, 0xB61AB5FA, 0xB61ABE3B, 0xAE19B61A,
+0xB61AB5FA, 0xADD9AE1A, 0xB5F9B5F9, 0xB5D9AD98, 0xB5FAB5FA, 0xB619B61A, 0xBE5ABE3A, 0xB63AC67B,
+0xADD9A5B8, 0xB63AB63A, 0xBE5BB5F9, 0xC6BCBE5A, 0xBE5ABE5A, 0xCE9BC6BB, 0xCEDCBE39, 0xD6DCCEBB,
+0xCEBBD6DB, 0xCEBBD6DB, 0xCEBCCEBB, 0xCEBCC6BB, 0xBE7ABE5A, 0xC69ABE7A, 0xC69ABE79, 0xCEBAC699,
+0xD6DCCEBB, 0xCEBBCEBB, 0xD6DCCEBB, 0xDF1CD6DB, 0xDF1CD6FC, 0xDEFCD6DC, 0xD6BBD6DB, 0xD6BBD6DB,
+0xCEBBCEBB, 0xC67AC67A, 0xDF1CCEBB, 0xDF1CDF1C, 0xDF1CD6FB, 0xDF3DDF1C, 0xDF1CDF1C, 0xDEFCD6FC,
+0xD6DCD6DB, 0xD6DCCEDB, 0xD6DCCEDB, 0xC67BCE9B, 0xC65ABE5A, 0xC65ABE5A, 0xC67ABE5A, 0xCE9BC67B,
+0xCE9BC69B, 0xD6DDC69B, 0x39EC5B0F, 0x31CC31CB, 0x3A0D31EC, 0x39EC31EC, 0x318A31AB, 0x298A298A,
+0x29892169, 0x21062148, 0x10C510C5, 0x212518E5, 0x106218C4, 0xEF7E0000, 0xD6FCCEDB, 0xCEDCCEDB,
+0xD6DCCEDC, 0xCEBBCEBB, 0xDEFCD6DB, 0xDEFCD6FC, 0xD6DBD6DB, 0xD6DCD6BB, 0xDEFCD6DB, 0xE71CDEFB,
+0xDF1CDF3C, 0xD6DBD6DB, 0xD6FCD6DB, 0xDEFCD6DB, 0xDF1DD6FC, 0xDF1CDF1C, 0xD6DCD6DB, 0xE73DDEFC,
+0xDF1CD6DB, 0xDF1CDEFC, 0xE73DDEFC, 0xE75DE73D, 0xDF1CDF1C, 0xDF1DDEFC, 0xDF1CDF1C, 0xDEFCD6FB,
+0xE73CDF1C, 0xE73DE73C, 0xE73DDF3C, 0xDEFCDF1C, 0xDEFCD6FB, 0xDEFCD6DB, 0xDEFCDEFC, 0xDF1CDEFB,
+0xE73CDEFB, 0xEF5DE73C, 0xEF7DE75C, 0xEF7DEF7D, 0xEF7DE77D, 0xEF5DEF5D, 0xE73CE73C, 0xEF7DE75C,
+0xE75DE75C, 0xE75DE73C, 0xE73CDF3C, 0xE71CDF1C, 0xDEFCDF1C, 0xDEFCD6FB, 0xDEFCD6FC, 0xDEFCD6FC,
+0xE77EDF3D, 0xB5B7E77D, 0xD6B9CEBB, 0xE54EEF15, 0x98C29080, 0xE6FCFF1C, 0xDF1CDF3D, 0xE75CDF3C,
+0xE75DE73C, 0xD6BBDF1C, 0xD6BBCE9A, 0xD6DBD6DB, 0xCE7AD69B, 0xD6BBCEBB, 0xCE9BCEBB, 0xCEBBCEBB,
+0xCEDBCEBB, 0xCEBBCEBA, 0xCEBBC6BA, 0xD6DBCEBA, 0xCEDBC69A, 0xCEDCCEDB, 0xC69BC6BB, 0xBE9BBE7A,
+0xB63AB65A, 0xB63AAE19, 0xB619AE19, 0xBE3AAE19, 0xBE5AB63A, 0xC69BBE7B, 0xC69BC69B, 0xCEBCC69B,
+0xCEBBCEDB, 0xD6DCCEBB, 0xCEBBCE9B, 0xD6BBD6DB, 0xD6BBCEBA, 0xD6DBCEBA, 0xDEFCD6DB, 0xD6FCD6FC,
+0xD6DCD6DB, 0xD6DCCEBB, 0xC67BC67A, 0xBE3ABE3A, 0xB5F9ADD8, 0xADD9ADD9, 0xA598A598, 0xA5B99D78,
+0xA5B9A598, 0xA5B89D98, 0xADD89D77, 0xA5779D36, 0xA5999D77, 0xA5B9A598, 0xADD9A598, 0xADF9ADF9,
+0xBE7BB63A, 0xC69BBE5B, 0xC67AC67B, 0xCEDCCEDC, 0xCEBCD6FD, 0xBE5ACE9C, 0xC67BC67B, 0xD6DBCE9B,
+0xD6DBDEFC, 0xD6BBD6DB, 0xC65BCE9B, 0xBE7BCE9C, 0xC69BC65A, 0xC69ACEBB, 0xBE79C6BA, 0xC679C69A,
+0xC67AC65A, 0xC69ACE7B, 0xCEBBCEBB, 0xD6FCD6DC, 0xD6FCDF1D, 0xD6DBD6DC, 0xCE9BD6DC, 0xD6DCD6DC,
+0xD6DBD6DC, 0xCEDBD6DB, 0xDF1CDEFC, 0xDEFCDF1C, 0xD6FBDF1C, 0xD6FCDEFC, 0xD6FBDEFC, 0xD6FCDEFC,
+0xD6DCD6FC, 0xD6DCD6FC, 0xCEDBD6DC, 0xCE9BD6DC, 0xBE5AC67B, 0xBE19C63A, 0xB619BE19, 0xBE39BE3A,
+0xBE5ABE3A, 0xCEBDC65B, 0x31CB422C, 0x424E31CC, 0x3A0D424E, 0x31AB39EC, 0x298A31AB, 0x2969318A,
+0x29692969, 0x29483169, 0x19062147, 0x10C41905, 0x108318C4, 0xC6590001, 0xC6BBD71D, 0xC69BCEBC,
+0xCEBBCE9B, 0xCEBBCEBB, 0xDF1CDEFC, 0xDF1DE73D, 0xDEFCDF1D, 0xDF1CDF1C, 0xDF3CE73D, 0xDF1CE73D,
+0xE73CE73D, 0xDEFCE73D, 0xD6DBDEFC, 0xD6DCD6DC, 0xD6DBD6DC, 0xD6DCDEFC, 0xCEBBD6DC, 0xDF1CDEFC,
+0xD6FBD6FC, 0xDEFCDF1C, 0xDF1CDEFC, 0xE73DE73D, 0xDEFCE73D, 0xD6FCDEFC, 0xD6FCDEFC, 0xDF1CDF1D,
+0xDF1CE71C, 0xE73CE73D, 0xDF1CE73D, 0xD6FBDF1C, 0xD6FBDEFC, 0xE73DDF1C, 0xDF3CE75D, 0xDF1CE73C,
+0xEF7DEF7D, 0xEF7DEF7D, 0xEF7DEF7D, 0xEF7DEF9D, 0xEF7DEF7D, 0xE75CEF7D, 0xE73CE75C, 0xE75DEF5D,
+0xE75DEF7D, 0xE73CE75D, 0xDF1CE75D, 0xDF1CDF1C, 0xD6FCDF1D, 0xD6DCDEFC, 0xD6DBDEDC, 0xD6DCDEFC,
+0xEF7EE73D, 0xAD97EF9E, 0xDEB9D6BC, 0xD46AF6B4, 0xA165A0E1, 0xD71CFEFC, 0xDF3CD6DB, 0xE75CE73C,
+0xE73CEF5D, 0xD6DBE73D, 0xD6DBD6BB, 0xDEDCD6DB, 0xC67AD6BB, 0xC65ACE7A, 0xCE9BCE9B, 0xC69BD6BC,
+0xC6BBCEBB, 0xC6BBCEDB, 0xCEDBCEDB, 0xCEDCD6FC, 0xC6BBCEDC, 0xC69BCEBC, 0xBE7BC67B, 0xBE7BBE7B,
+0xAE1ABE5B, 0xADF9B61A, 0xA5D9ADFA, 0xADF9ADF9, 0xA5D8ADF9, 0xADD9ADD9, 0xADF9B5F9, 0xB63AB61A,
+0xBE3ABE3A, 0xC67AC67B, 0xC67BC67B, 0xC67ACE9B, 0xC69ACE9B, 0xCE9ACE9B, 0xC69ACE9B, 0xCE9BCE9B,
+0xC67ACE9B, 0xBE5AC67B, 0xB5F9BE3A, 0xADB8B5F9, 0xA5B9ADD9, 0x9D98A5B9, 0x9D58A599, 0x9D789D58,
+0x95779DB9, 0x95789D99, 0xADB89537, 0x9D57A557, 0x95379D78, 0x9D589D58, 0x9D579D78, 0x9DB8A599,
+0xCEBBBE5A, 0xCE9BBE39, 0xCE7BCEBB, 0xC67ACE9B, 0xC67BBE5A, 0xC65ABE39, 0xC65ABE3A, 0xD6BBCE9B,
+0xDF1BD6FB, 0xCE9BCE9A, 0xC63BBE3A, 0xBE3ABE3B, 0xBE5ABE3A, 0xC69BC67A, 0xCEBBC69B, 0xCE9BC69B,
+0xC67ABE5A, 0xC65ABE3A, 0xC67AC67A, 0xCE9BC65A, 0xCEBBCE9B, 0xCE9BC67A, 0xD6DCCEBB, 0xD6DCCEBB,
+0xD6FCD6DC, 0xCEBBCEBB, 0xD6DCCEDB, 0xD6FCCEDB, 0xD6FCD71C, 0xD6DCCEDB, 0xD6DCCEBB, 0xD6DCCEBB,
+0xDEFDD6FC, 0xD6DCD6DC, 0xD6DCD6BB, 0xD6BCCEBB, 0xCEBBCEBB, 0xC65AC67A, 0xC65ABE39, 0xC67ABE3A,
+0xCEBBBE7A, 0xC65CC6BC, 0x29AA29AA, 0x3A0C29AA, 0x39EC39EC, 0x31AB31CC, 0x318A298A, 0x29692969,
+0x29482969, 0x210720E7, 0x21472127, 0x18E51906, 0x08630863, 0x73B00001, 0xCEBBD71D, 0xC67BC67A,
+0xCEBBC67A, 0xCE9BC69A, 0xDF3DD6DB, 0xDF1DDF1C, 0xDEFCDEFC, 0xDEFCD6DB, 0xE75DDF1C, 0xDF1CDF3C,
+0xE71CDF1C, 0xDEFCD6DB, 0xDF1CDF1C, 0xD6DCD6DB, 0xD6DCD6DC, 0xD6FCCEDB, 0xD6DCCEDC, 0xD6DCCEBB,
+0xDF1CD6FC, 0xD6DBD6DC, 0xDEFCD6DB, 0xDEFCD6DC, 0xD6DCD6DC, 0xD6FCCEBB, 0xD6FCD6DC, 0xDEFCD6DC,
+0xE73DDF1C, 0xE73DDF1C, 0xDEFCDF1C, 0xD6FCD6DB, 0xD6DCD6DC, 0xE73DD6FC, 0xE75DDF3D, 0xE73DE73D,
+0xEF5DE73C, 0xE77DE75D, 0xEF7DE75D, 0xE75DE75D, 0xEF7DE75D, 0xE75DE75D, 0xE75DE73C, 0xEF5DE73C,
+0xE77EE75D, 0xE73DE75D, 0xDF1CDF1C, 0xDF1DD6FB, 0xD6FCD6FC, 0xD6DCD6BB, 0xD6BCCEBB, 0xD6BBCE9B,
+0xEF9EDF1C, 0xA597E77E, 0xE6DAC67A, 0xC368EE12, 0xA9C790A0, 0xD71CF6FB, 0xDF3CCEDB, 0xE73CDF3C,
+0xDF1CDF1C, 0xC659D6DB, 0xDEFCC639, 0xD6DCD6BB, 0xCE7BCE9A, 0xC65AC63A, 0xC67BC65A, 0xBE5AC65A,
+0xBE5ABE3A, 0xBE5AB63A, 0xBE5AB63A, 0xB65AB63A, 0xB61AB63A, 0xADFAADF9, 0xA5D9A5D9, 0x9D999D99,
+0xA5D9A5B9, 0xA5D9A5D9, 0xA5DAA5D9, 0xAE1AA5F9, 0xADFAADD9, 0xADFAA5D9, 0xADFAADD9, 0xADF9A5D9,
+0xB61AADF9, 0xADFAAE19, 0xBE3AB61A, 0xBE5BB63A, 0xBE3ABE3A, 0xBE5AB63A, 0xC67BBE5A, 0xC67BBE5A,
+0xCEBCC67B, 0xC69BCEBC, 0xB63AC69B, 0xADD9ADD9, 0xA5B9A5D9, 0x9D799D79, 0x9D799559, 0x95799559,
+0x95788D37, 0x8D378D58, 0xADFA9557, 0x9D578CF5, 0x95389537, 0x95598D38, 0x9D799538, 0x9D999D99,
+0xCEBCBE5A, 0xC67AC67A, 0xADB78C73, 0xBE3AC67B, 0xB5D9C65B, 0xADB8B5FA, 0xB5D9AD98, 0xC65ABE1A,
+0xBE59C67A, 0xBE3AC65A, 0xC65CBE3B, 0xB61BBE3B, 0xB5F9BE3B, 0xBE5ABE3A, 0xCEBCC67B, 0xBE5BC67C,
+0xBE3ABE5B, 0xC69BC65B, 0xCEDCD6FD, 0xBE5AC69B, 0xC69BC65A, 0xC69BCE9B, 0xCE9BD6BC, 0xCEBBCE9B,
+0xD6FCD6FC, 0xD6FCD6FC, 0xD6DBDF1D, 0xCEBBD6BB, 0xCEBBD6DC, 0xCE9BCE9B, 0xCEBBCEBB, 0xCE9BCEBB,
+0xCEBBCE9B, 0xCEBBD6BC, 0xD6DCD6DC, 0xD6DCD6FD, 0xDF1DDF3D, 0xD6FCDF1D, 0xCEBBD6DC, 0xC69BCEBC,
+0xC6BCC69B, 0xADB9CEBD, 0x31CB2969, 0x31AB31CB, 0x31AB31AB, 0x298A39CB, 0x2989298A, 0x29692969,
+0x29483169, 0x21272948, 0x19072127, 0x21272127, 0x18A53188, 0x94D50003, 0xBE5AC65B, 0xC67BCE9B,
+0xCE9BCE9B, 0xCEBBCE9B, 0xDF3DDF1D, 0xDEFCE73D, 0xD6DBDEFC, 0xD6DBD6DC, 0xDF3DE71D, 0xDF1CE73D,
+0xDF1CDF1C, 0xD6FCDF1C, 0xD6DCD6FC, 0xD6DCD6DC, 0xCEDCD6FD, 0xD6FCD6DC, 0xCEDBD6FD, 0xCE9BCEBB,
+0xCEBBCEBB, 0xD6DCD6DC, 0xD6FCDEFD, 0xCEBBD6DC, 0xCEBBD6BC, 0xCE9BCE9B, 0xCEBBCEBC, 0xD6FCD6DC,
+0xDF1CE73D, 0xDEFCDF1D, 0xD6DBDEFC, 0xD6DCD6DC, 0xD6FCDF1D, 0xDF3DDF1D, 0xDF3DDF3D, 0xDF3CE75D,
+0xE75DE75D, 0xE75DE75D, 0xE77DEF7E, 0xE75DEF7E, 0xE75DE75D, 0xE73DE75D, 0xE75DE75D, 0xE73DE75D,
+0xE75DE75E, 0xDF1CE75E, 0xCEBBDEFC, 0xD6FCD6DC, 0xCEBCD6DC, 0xCEBBD6BC, 0xCE9BCEBC, 0xC67ACE9B,
+0xEF9EE73D, 0xADB7EF9F, 0xDEBACEBC, 0x68C0BC6D, 0xB2CBA185, 0xC6BBEEBB, 0xCEBBD71C, 0xDF3CDF3D,
+0xD6DBDF1C, 0xC659D6BB, 0xCE7ACE9A, 0xCE9BD6BB, 0xCE7ACE9B, 0xBE3AD69C, 0xBE3ACE7B, 0xB61AC65B,
+0xB61ABE3A, 0xADD9ADFA, 0xADD9ADDA, 0xA5B9ADDA, 0xA599ADDA, 0x9D99A5B9, 0x9D99A5B9, 0x9D999D99,
+0x9D789D78, 0x95789D99, 0x95789D78, 0x9D989D99, 0xA5FAADDA, 0x9DB9A5FA, 0xA5D9A5DA, 0xAE1AAE1B,
+0xAE1AB63B, 0xB63AB63B, 0xB63AB63B, 0xB65BB63B, 0xBE5BBE5B, 0xBE5BBE7B, 0xBE5BBE7C, 0xB63ABE5B,
+0xB63AB63A, 0xAE1ABE5B, 0x9D99ADFA, 0x9D799D99, 0x8D189579, 0x84F78D18, 0x84D784F8, 0x7CD784F8,
+0x7CF78518, 0x84F78518, 0xA5998CF7, 0x8CF69D57, 0x84F88CF7, 0x84F88D18, 0x84D884D8, 0x7CB68CF8,
+0x9D989D98, 0xA5B8A5B8, 0x84747C53, 0xA5B99D98, 0xA5B99D78, 0xA5999D99, 0xB61A9D98, 0xADD9A5B9,
+0xA5B8A5B8, 0xADD9A5D9, 0xA5B9A5B9, 0xA599A599, 0xA5B9A599, 0xB61BA5B9, 0xB63BADFA, 0xBE3CBE5C,
+0xB63AB65B, 0xBE9BB63A, 0xCEDCC69B, 0xCEBCC6BC, 0xC69BBE7A, 0xC69BC67B, 0xCEDCCEBB, 0xCEBBC69B,
+0xCEBBCEBB, 0xC69BC69B, 0xC67AC67A, 0xC69BC67A, 0xC69BC69A, 0xC67BC67A, 0xC69BC67A, 0xBE7ABE7A,
+0xBE5ABE3A, 0xC67ABE5A, 0xC69BBE5A, 0xCEBCC69B, 0xD6DCCEBB, 0xD6FDCEDC, 0xC6BCC6BC, 0xC69CC69B,
+0xBE9CBE7B, 0x9D39BE5C, 0x31CB1929, 0x318A31AB, 0x318A298A, 0x296A298A, 0x29692149, 0x29692148,
+0x21272147, 0x20E62106, 0x18C518C5, 0x18C510C5, 0x18851084, 0x31C90023, 0xAE19BE5A, 0xB63AADF9,
+0xBE5AB639, 0xCEDCC67A, 0xDF3DD71C, 0xDEFCD6FC, 0xD6DCCEBB, 0xDF1DD6FC, 0xDF3DDF1C, 0xDF1CDF1C,
+0xDF1CD6FC, 0xD6FCD6FC, 0xCEBCCEDB, 0xCEDCCEBB, 0xCEBCCEBB, 0xD6FCCEBB, 0xD6DCCEFC, 0xCEBBCEBB,
+0xC69BC67A, 0xCE9BC67A, 0xCEDCCE9B, 0xCEBCCEBB, 0xCE9BC69B, 0xC69BC67B, 0xC69BC67A, 0xCEBBC69B,
+0xD6FCCEDB, 0xD6FCD6FC, 0xCEBBCEBB, 0xCEBBC6BB, 0xCEBBC6BB, 0xDF1DD6FC, 0xDF1CD6FC, 0xE73DDF3D,
+0xE73DDF3D, 0xDF1CDF1C, 0xDF1CD6FC, 0xDF1DD6FC, 0xDF1DDF1C, 0xDF1DD6FC, 0xDF3DDF1C, 0xDF1CDF1C,
+0xDEFCD6DC, 0xD6FCD6FC, 0xCE9BCEBB, 0xCEBBC67A, 0xC69BBE7A, 0xC69CC69B, 0xBE7BBE7B, 0xBE5ABE5B,
+0xEF7EDF1C, 0xA577E73D, 0xDEFBBE5A, 0x5100A46E, 0xAB6D4000, 0xCEBBE6DB, 0xCEDCC69B, 0xDEFCD6FC,
+0xC67ACEBB, 0xBDF9C65A, 0xB5B7BE19, 0xCE7BC63A, 0xC63ABE19, 0xBE1ABE1A, 0xBE5BB619, 0xB63BBE3A,
+0xADDAADFA, 0xA5BAA5BA, 0xA5BA9D99, 0xA5BA9DB9, 0x9DBA9D99, 0xA5BA9DBA, 0x9D799D99, 0x9D599558,
+0x95789578, 0x95388D57, 0x95588D37, 0x95589558, 0x95589538, 0x9D999558, 0x9DB99599, 0xA5B99D99,
+0xA5B9A5B9, 0xA5DAA5B9, 0xA5B99D98, 0xADDAA5D9, 0xB61BA5D9, 0xAE1BAE1B, 0xA5B9A5D9, 0x9D999D99,
+0x8D579578, 0x95588D57, 0x7CD67CB5, 0x7CD77CF7, 0x749674B6, 0x74766C76, 0x6C566455, 0x6C566C56,
+0x6C566455, 0x74766C76, 0x95177454, 0x7C538D16, 0x74567475, 0x7C977476, 0x74767476, 0x74967476,
+0x9D789537, 0xA5D99538, 0x9D989D98, 0x9D999D99, 0x8D589DBA, 0x84F78D18, 0x6C339579, 0x9D99A5B9,
+0x9DB9A5DA, 0xAE1BA5FA, 0xA5B9B63B, 0xA598ADDA, 0x9D77A598, 0x95168CF6, 0xA598ADB9, 0xADD9B63B,
+0xA5D9ADFA, 0xAE1AADFA, 0xB63AB63A, 0xB65ABE5B, 0xB63ABE5B, 0xB63AB63A, 0xBE7ABE7B, 0xBE7ABE7B,
+0xC69BC69B, 0xCEBBCEBC, 0xC69BCEBC, 0xC65AC67B, 0xBE5AC65A, 0xBE5AC65A, 0xBE7BC67B, 0xBE7BC69B,
+0xB61ABE3A, 0xAE19B61A, 0xB619B61A, 0xBE3ABE5A, 0xBE9BC69C, 0xBE7BC69C, 0xB61ABE5B, 0xADF9B61A,
+0xA5D9ADF9, 0x9538ADFB, 0x21292129, 0x2148296A, 0x29692969, 0x2989318A, 0x29692969, 0x21482969,
+0x19072127, 0x21062127, 0x29472947, 0x18E52926, 0x084318A5, 0x5B0E0022, 0xB63AC69C, 0xBE7BB63B,
+0xBE5ABE5A, 0xCEBBC69B, 0xCEDBD6DC, 0xD6FCD6FC, 0xD6DCD6DC, 0xDF1DDF1D, 0xDF1CDF3D, 0xD6FCDF1D,
+0xD6FCD71D, 0xCEFCD6FC, 0xCEDCD6FD, 0xC6BBCEBC, 0xCEBCCEDD, 0xCEDCCEDC, 0xCEDBD6DC, 0xCEBBD6DC,
+0xCEBBD6DC, 0xC69BCEBC, 0xCEBCCEBC, 0xCEFCD6FD, 0xCEDCD6FD, 0xCEDCD6FD, 0xC6BBCEDC, 0xC6BBCEBC,
+0xCEBBCE9B, 0xCEDCD6DC, 0xC69BCEBC, 0xC69BCEBC, 0xBE7AC67B, 0xCEBBCEBC, 0xCEBBCEBB, 0xD71CD71D,
+0xD6FCD6FC, 0xCEDCD6FC, 0xC69BCEBC, 0xC69BCEBB, 0xC67ACE9B, 0xC67ACE9B, 0xC67AC69B, 0xC67ACE9B,
+0xC67ACE7B, 0xCE9BCE9B, 0xC69BCEBC, 0xBE5AC67B, 0xB63ABE5A, 0xB65BBE5B, 0xB63ABE5B, 0xADF9B63B,
+0xF79EDEFC, 0xA577EF9F, 0xCEBBB63B, 0x51409C4D, 0x69E74020, 0xC67BEEFD, 0xC6BBC69C, 0xCE9BCEBC,
+0xB5F9C67B, 0xA556C65A, 0x94F5A556, 0xB5F9AD78, 0xADB8AD98, 0xADD9B5D9, 0xB61AADD9, 0xADFAB61A,
+0xA5BAADDA, 0x9DBAA5BA, 0x9D99A5BA, 0x9D799D9A, 0x9D999D79, 0x9D799D9A, 0x9D589D79, 0x9D589D78,
+0x95589D58, 0x9D789D78, 0x9D999D99, 0xA5DAA5DA, 0x9578A5DA, 0x95789558, 0x95789D99, 0x9D999D99,
+0xA598A5B9, 0xADD9ADFA, 0xADD9A5B9, 0x9D98B5FA, 0xA5B9A5B9, 0xA5B9A5DA, 0x9D78A5B9, 0x8D179558,
+0x84F78CF7, 0x7CB684D6, 0x7CD684D6, 0x74757496, 0x6C557475, 0x74967476, 0x6C967497, 0x6C767497,
+0x74976C36, 0x6C357476, 0x8CF67C55, 0x74339516, 0x6C557454, 0x6C567476, 0x74567456, 0x74757476,
+0x8CF784D6, 0x63B17454, 0x7CB57C95, 0x8D177CD6, 0x95598D58, 0x8D3884F7, 0x114984F7, 0x8D178D17,
+0x95588D37, 0xA5DA9558, 0xAE1AAE1B, 0x8CF5A598, 0x638E7430, 0x3A2829C7, 0x638E530C, 0xADD88472,
+0xA5B99D98, 0xA5D9A5B9, 0xADD9A598, 0xB63AADF9, 0xB63AAE1A, 0xB63AB65A, 0xB619ADF9, 0xC69BB639,
+0xCEBBC69B, 0xC67AC67B, 0xCEBBC67B, 0xCEBBC69B, 0xC69BC69B, 0xBE5BBE5A, 0xB63AB63A, 0xADF9ADF9,
+0xAE3AAE1A, 0xAE1AAE1A, 0xAE1AAE19, 0xADF9ADF9, 0xADF9A5D9, 0xAE1AA5D9, 0xAE1AADF9, 0xAE1AA5FA,
+0xB63AAE19, 0xBE5CADF9, 0x21491928, 0x19061907, 0x21471906, 0x31892947, 0x21482968, 0x21472127,
+0x31882147, 0x29472967, 0x18E52106, 0x088310A3, 0x10630863, 0x29A80863, 0xBE7BCEFD, 0xBE7BB63A,
+0xC6BCBE9B, 0xC69BC69B, 0xCEBBC69B, 0xD6DCCE9B, 0xD6DCCEDB, 0xD6FCCEDC, 0xD6DCD6FC, 0xCEBBCEBB,
+0xCEDCC69B, 0xCEBCC6BC, 0xBE7BC69B, 0xC69BBE5A, 0xC69CC69B, 0xC67BC67B, 0xCE9BC67A, 0xC69BC69A,
+0xC6BBC69B, 0xCEBCC69B, 0xCEDCCEBC, 0xCEBCC6BB, 0xC6BCC6BB, 0xC67BBE7B, 0xBE7BBE7A, 0xC69BBE7A,
+0xC67BBE7A, 0xC69BC67B, 0xC67BBE7B, 0xBE5BBE5A, 0xBE7BBE5B, 0xBE5ABE5A, 0xC67ABE5A, 0xC67ABE5A,
+0xCEBBC67A, 0xCEBBCE9B, 0xC69BC69B, 0xC67BC65A, 0xC67BBE5A, 0xC65ABE5A, 0xC67BBE5A, 0xCE9BC67A,
+0xCE7AC67A, 0xCEBBC67A, 0xCEDCCEDC, 0xB63ABE5A, 0xB61AAE19, 0xADFAA5F9, 0xA5FAA5FA, 0x9D989DB9,
+0xEF9ECEDB, 0xA597E77D, 0xB5F89D99, 0x71C18B89, 0x50825880, 0xB65BCE39, 0xBE9BB65A, 0xC69CC6BB,
+0xB5F9BE5A, 0xAD98B5F9, 0x94D59D16, 0xAD988CB4, 0x9D3694F5, 0x9D37A577, 0xA598ADD9, 0x9DB8A5B9,
+0xA5B99DB9, 0x9DB99DB9, 0x95799599, 0x9D999578, 0x95789578, 0x95579557, 0xADD99557, 0xB63AADF9,
+0xCEBCBE7B, 0xD71DCEDC, 0xD6FDCEFD, 0xD6FDCEDC, 0xBE5BC67B, 0xBE7BB63A, 0xBE5BBE7B, 0xB63AB619,
+0xC69BB639, 0xCEFDCEDC, 0xCEFDCEDC, 0xADD9BE7B, 0x9D789D57, 0x95789557, 0x8D178D37, 0x84F684D6,
+0x951784D5, 0x8CD684D5, 0x8D178D37, 0x84D67CB5, 0x8CF784F6, 0x8D3884F7, 0x8D188D58, 0x7C967CB6,
+0x749774B7, 0x74766C56, 0x8CF67434, 0x7C949536, 0x85177CD5, 0x74967CD6, 0x7CB77496, 0x74757475,
+0x9D799558, 0x00C68CF6, 0x9537A5DA, 0x84F79558, 0x7CD68CF7, 0x851784F7, 0x84D684F6, 0x84F68D17,
+0x8D378D38, 0x8D179538, 0xA5989D78, 0x530C7C52, 0x52EB52EB, 0x3A273A07, 0x31C73A07, 0xADB74A8A,
+0xADF9ADF9, 0xB63AB63B, 0xADFAB61A, 0xADD9B61A, 0xA5B8ADD9, 0xADF9ADF9, 0xB63AB61A, 0xBE7BBE5B,
+0xC69BC69B, 0xBE3AC67B, 0xC67BC65A, 0xC67BC69B, 0xC67BC69B, 0xC67BC67B, 0xBE7BC69B, 0xB63ABE5B,
+0xBE7BBE7C, 0xB65BBE7C, 0xAE19B65A, 0x9D98A5D9, 0x9DB8A5B9, 0x9DB9A5B9, 0xA5D9A5D9, 0xA5B9A5DA,
+0xA5D8A5D9, 0xBE5CADFA, 0x21482989, 0x10C52968, 0x21052106, 0x21472106, 0x21272968, 0x21472147,
+0x21062127, 0x106318C5, 0x18C410A4, 0x088318C4, 0x086210A3, 0x19460863, 0xADF9C67B, 0xB65BBE7B,
+0xBE7BBE7B, 0xBE5AC67B, 0xC69BC69B, 0xC67ACE9B, 0xC67ACE9B, 0xCE9BCE9B, 0xBE7ACEBB, 0xB639BE5A,
+0xB619B63A, 0xAE19B61A, 0xB63AB63A, 0xBE7BB65A, 0xBE7BBE7B, 0xBE5AC67B, 0xC69BC67B, 0xC69BCEBC,
+0xBE3AC67B, 0xAE19B63A, 0xADF9B61A, 0xAE19B61A, 0xAE19B63A, 0xB639B63A, 0xB639B63A, 0xB63AB65A,
+0xB63ABE7B, 0xB63AB63A, 0xADF9B63A, 0xB63AB61A, 0xB65ABE5B, 0xBE5ABE5B, 0xBE7BC69B, 0xB639BE5A,
+0xB619B61A, 0xB619BE3A, 0xB619B61A, 0xBE3ABE3A, 0xBE5AC65B, 0xC65BC67B, 0xC69BC67B, 0xCEDCCEBC,
+0xD6DCD6DC, 0xD71DD6FD, 0xCEDCDF3D, 0xB63AC67B, 0xADF9B61A, 0x9DB9A5D9, 0x9D999DB9, 0x95579599,
+0xEF9ED6FC, 0x9D77E79E, 0xA5959537, 0xD4EBB4CC, 0x50617100, 0xAD988BB0, 0xB5B9B598, 0xB5D8BDD9,
+0xB5F9B5F9, 0xADB8AD98, 0x9D369D37, 0xADB8A557, 0x95159D16, 0x951694F6, 0xA5B89D78, 0x9578A598,
+0x9D789D78, 0x9D989D99, 0x95789D98, 0xA5D99DB9, 0xBE7BB65B, 0xBE7BBE7B, 0xD71ECEDD, 0xDF3DDF5E,
+0xDF1DDF1D, 0xE77EE75D, 0xDF3DEF9E, 0xC67AD6BC, 0xCEBBCE9B, 0xCEBBCEDC, 0xCEDCCEDC, 0xC6BBCEDC,
+0xD6FCCEDC, 0xCEDCD6FD, 0xCEDCD6FD, 0xADF9BE5B, 0xAE19ADF9, 0xB65BBE5B, 0xA5B8B61A, 0xBE5BADFA,
+0xBE5BBE5B, 0xDF3ED6FD, 0xD6FDDF3E, 0xBE5BD6FD, 0xBE7CC69C, 0xBE5CBE7C, 0xADFABE7C, 0x84F79558,
+0x85188D18, 0x8D388D18, 0xA5B9A5BA, 0x9D769D77, 0x9DB99D98, 0x9DBA9DBA, 0xADFBAE1C, 0xAE1AA61B,
+0xB61AA5D9, 0x7433B63A, 0x9D98AE1A, 0xADDAAE1A, 0xA5D9ADF9, 0xAE1AA5D9, 0xA5D99557, 0xADFAA5D9,
+0x9DB99DD9, 0x9D989D98, 0xBE5AA5D8, 0x42287410, 0x73AD52AA, 0x39E74227, 0x31864228, 0x5B0C39E7,
+0xCE9C8CD3, 0xCEBCC67B, 0xBE5BBE5B, 0xBE5BB61A, 0xBE7ABE3A, 0xC67BB639, 0xC69CC69B, 0xCEBCBE7B,
+0xC69BBE7A, 0xC65AC69B, 0xC67BBE39, 0xCEFCBE9A, 0xCEBBCEBB, 0xC69BC69B, 0xBE7BC69B, 0xC69BC6BB,
+0xCEBCBE5A, 0xC6BBC6DB, 0xBE9BC6BB, 0xADD9B63A, 0x9DB89D98, 0x95789577, 0x9D989578, 0xA598A5B9,
+0x9D779D97, 0xBE7CA5B9, 0x19075B2F, 0x190618E6, 0x21260883, 0x21062146, 0x21462126, 0x088418E5,
+0x21060022, 0x20E60023, 0x20E52947, 0x18C410A4, 0x10A310A3, 0x08A40042, 0xB5FAC6BC, 0xBE5CB63A,
+0xAE1AB65B, 0xBE7BB65B, 0xBE7BB65A, 0xBE5BBE5B, 0xBE5ABE5A, 0xBE5ABE7B, 0xB639B639, 0xAE1AAE19,
+0xB65AAE19, 0xBE5BB65B, 0xBE5BAE1A, 0xBE9BB65A, 0xBE7BB65A, 0xC69CB63A, 0xC69CBE5A, 0xC69BBE7B,
+0xBE3BBE5B, 0xADD9B63A, 0xA5D9A5F9, 0xA5B99D98, 0xA5B9A5B9, 0xADF9A5B8, 0xAE19AE19, 0xAE3AADF9,
+0xAE19A5F9, 0xAE1AA5F9, 0xA5D99DB8, 0xA5D99DD8, 0xA5D99DB8, 0xA5D9A5F9, 0xAE1AA5F9, 0xB63AADF9,
+0xB61AADF9, 0xADFAB63A, 0xBE3BB61A, 0xBE5ABE5B, 0xCEDCBE5A, 0xD6DCCEBC, 0xC67BC67B, 0xBE7AB619,
+0xC67BBE5A, 0xCEBCCEBB, 0xD71DCEFC, 0xBE5BC6BC, 0xA5D9ADFA, 0x9DB9A5FA, 0x95789598, 0x95379578,
+0xEF9ECEBB, 0x9D97E79E, 0xB5D69577, 0xD52BBD6D, 0x50207120, 0xE5FA71E9, 0xC4F5DDB8, 0xDE1ABC94,
+0xADDABE1A, 0xADB99D57, 0x94D59515, 0xBE3AB619, 0xA5769555, 0xA5789516, 0xADDAA598, 0x9D789D98,
+0xADF9A598, 0xB63AAE19, 0xC69BB659, 0xCEDCBE7A, 0xDF1DD71D, 0xE75EDF3D, 0xD6FDD71D, 0xDEFCD6FC,
+0xE71DDEDB, 0xE73DDF3C, 0xE73DDF3D, 0xD6DCD6FC, 0xC67BC65A, 0xC69BBE7A, 0xC6BBC69A, 0xC69BC69B,
+0xCE9BC69B, 0xD6DCCEBB, 0xBE7BC69B, 0xBE3BBE3A, 0xC6BCB63A, 0xD71DCEDC, 0xE75EDF3D, 0xE75DDF3D,
+0xCEBBDF3D, 0xE73EDF3D, 0xE73DE73D, 0xD6DCDF1C, 0xCEDCCEDB, 0xCEBCCEBB, 0xBE5BBE7B, 0xB65BB65A,
+0xAE1BB63B, 0xB63BADFA, 0xADB8A5D9, 0xA5969D55, 0xA5D9AE19, 0xBE5BAE1A, 0xB61AB63B, 0xC69CBE5B,
+0x5B0D4A8B, 0x7C525B0D, 0x9D56C65A, 0x4AAC632E, 0xADB75B2E, 0x8CD4B5F9, 0x8CB38C93, 0xCEFCB5F8,
+0xBE5BC6BC, 0xC6BBC6BC, 0xD6DBD6FC, 0x420773AE, 0x52A95AEA, 0x39E63185, 0x31A62924, 0x21255AEB,
+0xD6DC630D, 0xD6DCCE9B, 0xCEBBCEBC, 0xCEBBD6DC, 0xC67ACEDC, 0xC69BCE9B, 0xC67BC67A, 0xCE9CCE9C,
+0xC69BCEBB, 0xCEBCD6DC, 0xBE7AC69B, 0xBE7AC6BB, 0xC69BC69B, 0xBE5AC67B, 0xB65ABE7B, 0xB63AC69B,
+0xC69BC65B, 0xC69AC69B, 0xBE7AC67A, 0xBE7BCE9B, 0xAE1ABE7B, 0xAE3AB65B, 0xBE7BAE3A, 0xBE5BBE7B,
+0xB63AC69C, 0xC69CBE5B, 0x21688495, 0x08A42127, 0x10A40863, 0x210620E5, 0x108318E5, 0x00220863,
+0x10A42988, 0x21272927, 0x18A520E6, 0x108218A4, 0x004118A3, 0x088410A4, 0xBE3BD6FD, 0xADF9BE3B,
+0xADD9ADFA, 0xA5D8B61A, 0xAE19AE19, 0xBE5BB63A, 0xBE5ABE7A, 0xC69CBE5A, 0xB639BE9B, 0xB63AB65B,
+0xB63ABE5A, 0xB61AB63A, 0xB63AB61A, 0xB65AB65B, 0xB65ABE7B, 0xAE3AB65B, 0xB61ABE7C, 0xB61AB61A,
+0xADF9B63B, 0xB63AB61A, 0xA5F9ADFA, 0xB67BB67B, 0xB67BBE9C, 0xB63AB63B, 0xB65AB65B, 0xBE9BBE9B,
+0xB67BBE9C, 0xBE9BBE9C, 0xB67BBE7B, 0xB67BBE9C, 0xAE1AB63B, 0xA5F9ADFA, 0xA5F9A5DA, 0xB67BB63B,
+0xBE7BBE9C, 0xBE9BBE7C, 0xC69BC6BC, 0xCE9BCEBC, 0xD6FCD6DC, 0xD6FCD6FD, 0xC69BCEDC, 0xC69BCEBB,
+0xBE5AC69B, 0xBE5AC65A, 0xBE5AC67B, 0xBE9BC67B, 0xBE7CBE7C, 0xAE1ABE7C, 0xAE1AB63B, 0x9D78A5DA,
+0xE77ED6DC, 0xA5B7EF9E, 0xC658B63B, 0xC52BD652, 0x92A7C44B, 0xB4735926, 0x720AA3F1, 0xC45381EA,
+0xBE1ADE5B, 0xA578B5D9, 0x8CB49D16, 0xADF9ADB8, 0x95158CD4, 0xADB99D37, 0xBE3ABE3B, 0xBE7CADD9,
+0xDF3DCEDD, 0xCEFCDF5E, 0xD6DBD6DC, 0xD6FCD71D, 0xD6BBD6DC, 0xDEDCE71C, 0xCEDCD6DC, 0xD6DBDEFC,
+0xDEFBDEDC, 0xDEFCDF1C, 0xDF1DDF1C, 0xD6FDE71D, 0xCEBBD6DD, 0xC69ACE9B, 0xC6BBCEBB, 0xC6BBCEBC,
+0xC69BC69B, 0xC67BCEBC, 0xA5B8B61A, 0xADD9ADD9, 0xBE5ABE3B, 0xD6DCCEBC, 0xDF3CDF3D, 0xE73CEF5D,
+0xD6BBE75D, 0xE71CE73D, 0xE73CEF3D, 0xDEFCE73D, 0xCEBBD6FC, 0xC69BCE9B, 0xBE3AC65B, 0xB61ABE3A,
+0xADFAB61B, 0xA5D9B61B, 0xADD8A5D9, 0xA5769D35, 0xADF9ADF9, 0xBE5BBE5B, 0xA5D8ADFA, 0xBE7BBE3A,
+0x29443144, 0x31652945, 0x31656B4C, 0x39E73165, 0x316531A6, 0x18E32965, 0x10A22103, 0x6B4D2124,
+0xB5D794F3, 0x8451B5D7, 0x738D6BAE, 0x5ACA5AEA, 0x4A6839E6, 0x318539E6, 0x42272964, 0x39C739E6,
+0xE73C6B6D, 0xBE18CE59, 0xBDF8C659, 0xCEBBBE38, 0xCEDBB5D7, 0xC659CEDB, 0xCEDBCEBA, 0xCEBBC69A,
+0xCE9BC67A, 0xCEBBC67B, 0xCEFDCEFD, 0xCEBCCEDC, 0xC67BCEBB, 0xC69BC69A, 0xBE7BBE5A, 0xBE5BB63A,
+0xB5989D16, 0xCEBBCE9B, 0xCE9BCE9B, 0xD6DCBE19, 0xB63ACEBB, 0x95567C52, 0xC6BCBE9B, 0xCEDCCEFC,
+0xD71DC6BB, 0xCEBCBE7A, 0x21479D77, 0x10A42147, 0x086310A4, 0x31870842, 0x00220022, 0x29880043,
+0x29881906, 0x18E62126, 0x18A420E5, 0x10830862, 0x10830841, 0x10C40021, 0xBE1AD6FD, 0xBE3AB619,
+0xB63AB619, 0xB61AAE19, 0xB63AADF8, 0xBE5AB639, 0xC69ABE59, 0xB61ABE5A, 0xB65ABE7A, 0xCEFCB67A,
+0xD71CCF1C, 0xD71DD6FC, 0xC67BCEDC, 0xB63ABE5A, 0xADF9AE39, 0xAE3AAE19, 0xA5FAA5D9, 0xA5F99DD9,
+0xADF9A5B8, 0xAE19AE19, 0xB65AB65A, 0xC6DBBEDB, 0xCEFCCF1C, 0xAE19AE19, 0xB63AAE1A, 0xB63AAE39,
+0xB65AB63A, 0xB63AB63A, 0xB61AB63A, 0xB65AB65A, 0xBE5BBE7B, 0xBE7BB63A, 0xBE7BBE7B, 0xBE7BBE5B,
+0xBE5ABE7B, 0xC67BB65A, 0xCEBBB639, 0xDF3DDF3C, 0xD6FCD6FB, 0xCEDBD6FC, 0xC69BCEBB, 0xB639BE7A,
+0xBE7AB619, 0xBE5ABE5A, 0xC67ABE39, 0xBE7AC67A, 0xC67BBE5A, 0xCEDCC69B, 0xD71DCF1D, 0xD6DCC69B,
+0xEF9EDF1D, 0xADB7E77E, 0xD6DBCE9C, 0xC590DEB7, 0xFF17A44B, 0xBD77E6BA, 0xFEDCCDD8, 0x60629A4A,
+0xE6BB5987, 0xB5B8BDD8, 0xA578A537, 0xBE5AC69C, 0xADB88CD4, 0xBE1ABE19, 0xC67BCE9B, 0xDF1ECEDD,
+0xD6FDD6FD, 0xC67ACEBC, 0xCEBCCEBB, 0xDF1DDF3D, 0xD6DCD6FC, 0xCE9BD6BB, 0xCEBBC67A, 0xCE9AC69A,
+0xD6DBCEBA, 0xD6DBD6DB, 0xCE9ACEBA, 0xBE39BE59, 0xBE3ABE39, 0xBE5ABE39, 0xBE5ABE39, 0xB63AB619,
+0xB65AB639, 0xAE3AB65A, 0xA5B9A5D9, 0x9DB99D98, 0xA5B99D98, 0xC65AB619, 0xD6DBC67A, 0xDF1CDEFC,
+0xCE9AD71C, 0xD6BBD6BB, 0xDEDCD6DB, 0xCEBBCEBB, 0xC67BC69B, 0xBE3ABE3A, 0xADD9B5F9, 0x9D999D98,
+0x9D999D78, 0x9D999578, 0x9D979D98, 0x9D569D35, 0xA5B99D77, 0xA5D99D98, 0xA5B9A5B9, 0xC6BCADF9,
+0x292341A5, 0x20E241A6, 0x39853144, 0x31643964, 0x29433985, 0x29433144, 0x316420E2, 0x21032924,
+0x422820E3, 0x31A55289, 0x31A53165, 0x31844A27, 0x29633984, 0x31844206, 0x18E22944, 0x21033165,
+0x5ACA20E3, 0x31A65AAA, 0x5289528A, 0x52CA4248, 0x6B8E31C7, 0x3A089CF4, 0xD6FBE73C, 0xD6DAD6DA,
+0xADB7D6DB, 0xC67ABE39, 0xA576ADD7, 0xCEBBBE19, 0xD6FCD6DC, 0xCE7AD6BB, 0xDF1CD6DB, 0xBE39B5D8,
+0xBDD8B5B7, 0xA555D69A, 0x738E9CD3, 0x8C52630D, 0x4AAB7BF0, 0x5B4D530C, 0x9D56636E, 0xC69BA556,
+0xCEBBCEBC, 0xCEDCCEDC, 0x18E6BE1A, 0x31C82967, 0x10832106, 0x108310A4, 0x18E50022, 0x298839C9,
+0x19062988, 0x18C52106, 0x18A41084, 0x08621063, 0x08821062, 0x19050862, 0xDF5EEF7F, 0xDF3DE73D,
+0xCEFCDF3D, 0xCEFDD6DC, 0xD73DD71D, 0xDF5DDF7E, 0xDF5DDF3D, 0xCEDDD6FD, 0xCEFCD71E, 0xD73DD71D,
+0xD6FBDF3C, 0xD6DCDF1D, 0xD71DD6DC, 0xD6FCD6FC, 0xC6BBCEDC, 0xA5F9BE7B, 0xA5F9ADFA, 0xBE9BAE1A,
+0xCEDCCEFD, 0xCEDCCEBC, 0xD73DD73E, 0xCF1CCEFC, 0xD73DCEFC, 0xBE9BD71D, 0xB65AC69C, 0xBE9BC6BC,
+0xC69BC69B, 0xC6BCC6BC, 0xCEDCD6FD, 0xD71DDF3E, 0xCEDCCEDC, 0xC69BCEBC, 0xBE5AC69B, 0xCEDCC69B,
+0xCEDCCEFC, 0xCEBBCEDC, 0xDF3CD71C, 0xE77EDF3D, 0xD6FCE75D, 0xD6FCDF1D, 0xCEFCDF1D, 0xD71DD6DC,
+0xCEFCD71D, 0xD6FCD6FD, 0xCEDBD6DC, 0xCE9BD6DC, 0xCEBBCEBC, 0xD6FCD6DC, 0xD6FCDF1D, 0xCEBBDF1D,
+0xEF9EE71D, 0xADB7E77E, 0xD6FCD6FD, 0xCE55DEFA, 0xD67383CA, 0xDE96DE75, 0xFF18E6B7, 0x60608183,
+0xE67682A7, 0xC5F7D657, 0x9D169CD4, 0xADB8CEBC, 0xADB88CB4, 0xCE9AC63A, 0xBE39CE9B, 0xC65AD6BC,
+0xC67ACE7B, 0xBE3ABE3A, 0xCEBCC65A, 0xCE9BD6DC, 0xCE7BCE7B, 0xCEDCD6BC, 0xCEFCCEBB, 0xCEFCCEDB,
+0xDF1CDF1C, 0xD71CDF3C, 0xD6FCDEFC, 0xD6DCD6FC, 0xD6FCDF1D, 0xC69BD6BC, 0xC67AC67B, 0xBE5AC65B,
+0xAE3AB65A, 0xB65AB65A, 0xB65BB67B, 0xAE1AB65B, 0xB63AB61A, 0xBE7BC69C, 0xC67AC65B, 0xC67ACE9B,
+0xBE18CE9B, 0xCE7ACE7A, 0xC65AD69B, 0xC67AC65A, 0xB619C65A, 0xB5F9B61A, 0xA578ADD9, 0x95579D78,
+0x95379D58, 0x95578D17, 0x95369536, 0xBE39A576, 0xBE9CC69C, 0xA5D9B61A, 0x9D98ADD9, 0xBE7BA5B8,
+0x20E22943, 0x41C641E6, 0x29432923, 0x31633184, 0x21023184, 0x21023163, 0x29233184, 0x18A12944,
+0x20C21081, 0x292339A5, 0x292320E2, 0x39A43984, 0x41E52922, 0x42062923, 0x21032923, 0x210320E2,
+0x4A272103, 0x41E631A5, 0x31C53A06, 0x420731C5, 0x29653185, 0x31A62124, 0xA5338C50, 0x7BAD9CB1,
+0x52AA6B4C, 0x5AEA52CA, 0x29652985, 0x4A4931A6, 0x6B4C73CE, 0x630A73CD, 0x83CE7BAD, 0xA5139491,
+0x4A476B6C, 0x4A064A26, 0x62CA5288, 0x8C3083EE, 0x52AA9CF2, 0x52AA4A89, 0x8C73634D, 0xD6BCBDF9,
+0xC67BCEBB, 0xCEDCC67A, 0x2148D6DE, 0x21262167, 0x31882968, 0x10841905, 0x31A82967, 0x21272147,
+0x19061905, 0x18C418E5, 0x106310A3, 0x10620841, 0x08620841, 0x31870021, 0xE71CEF9E, 0xEF7DDF1B,
+0xE75DDF3C, 0xD6FCDF1C, 0xDF3DDF3D, 0xDF1CDF1D, 0xBE38D6FB, 0xDEFDDF1D, 0xDF1DD6DC, 0xD6FCD6FC,
+0xDF1DD71C, 0xDEDDD6BB, 0xD6DCD6DC, 0xCEBBD6FC, 0xC69ACEBB, 0xC6BCC6BB, 0xC6BBBE7A, 0xD6FCC6DB,
+0xCEDCCEDC, 0xCEDCCEDB, 0xCEDCCEDC, 0xCE9CCEBB, 0xC65BBE5A, 0xC6BCC67B, 0xC69BBE7B, 0xC6BBBE7B,
+0xCEDCC6BB, 0xCEFCC6BB, 0xCEDCCEFC, 0xD6FCCEDC, 0xD6FCD6FC, 0xD6FCCEDB, 0xD6FCD71C, 0xD71CCEFB,
+0xD71DCEFB, 0xD71CCEFC, 0xDF5ED6FC, 0xBE39CEBB, 0xD6FCCE9B, 0xCEDCCEDC, 0xCEDCCEBB, 0xD71DCEDC,
+0xCEDCCEDC, 0xD6FCDF3E, 0xD6DCCEDB, 0xD6DCCEDC, 0xCEDCCEDC, 0xD6FCCEDC, 0xCEBCCEBB, 0xCE9AD6BB,
+0xEF9DDF1B, 0xAD96E77D, 0xC6BBC6BA, 0xCEB9C699, 0x83A9C635, 0xDDCADE2D, 0xC487E62C, 0x92A19260,
+0xCD8AD58A, 0xC5F3C5AE, 0xADB894B2, 0x8CB4B5F9, 0xBE18A535, 0xC67ACE9A, 0xBE39AD97, 0xC69BBE19,
+0xC67BC67B, 0xC65BC65B, 0xBE5ABE3A, 0xCEBBBE9A, 0xCEBCCEBB, 0xD6DCCEBB, 0xC6BBC69A, 0xD71DC69B,
+0xD6FCD6FC, 0xD6FCD6FC, 0xD6FCD6DB, 0xDF1DD6FC, 0xD6DCD6FC, 0xCE9BCE9B, 0xCEDCC69B, 0xCEDCCEDC,
+0xC69BBE9B, 0xC69BBE7B, 0xC6BBBE9A, 0xC6BBC6BB, 0xCEDCBE9A, 0xCEDCCEDC, 0xD6DCCEBC, 0xC67BC67B,
+0xC659CE9B, 0xDEFCD6DB, 0xD6DCDEFC, 0xD6FCCEBB, 0xCEDBCEDB, 0xCEDCCEBB, 0xC67BC69B, 0xC67BBE7A,
+0xBE5BBE7B, 0xBE7BBE3A, 0xCEBBC69B, 0xC638A534, 0xD71DD71C, 0xCEDDCEDC, 0xC6BCBE7B, 0xC65AC69B,
+0x29033123, 0x39A54A06, 0x29433144, 0x21223984, 0x29432922, 0x21023164, 0x21033184, 0x20E23164,
+0x18811881, 0x290349E6, 0x20C22923, 0x29023144, 0x21022902, 0x41C53144, 0x29022923, 0x31643144,
+0x39A43164, 0x292339A5, 0x31842922, 0x31A539E6, 0x29442944, 0x31443124, 0x41A541A5, 0x62C95A47,
+0x4A473985, 0x31A44206, 0x31A53184, 0x31643185, 0x29433185, 0x52263984, 0x52266AE9, 0x52676288,
+0x5AA75287, 0x49C45246, 0x5A466AC8, 0x62EA5A68, 0x52685248, 0x4A486B4C, 0xB5965AAA, 0xD6DCE71D,
+0xCE9BD6DC, 0xCE9BD6FC, 0x2148D6BE, 0x29682968, 0x21062127, 0x19052106, 0x29883188, 0x19062148,
+0x21262126, 0x18C42946, 0x10A318A4, 0x08621062, 0x08410862, 0x31861062, 0xD699C618, 0x6B6C9470,
+0x73AE83EF, 0xCE589CB2, 0xAD95BDD6, 0xC638BDD7, 0x840FAD34, 0xCE79A514, 0xDEFBDEFC, 0xDF1CDEFC,
+0xDEFCD6DB, 0xDEFCDEFC, 0xD6BBE71D, 0xDEDBE6FC, 0xDEFBDEFB, 0xD6FBDEDC, 0xDF1CDF1C, 0xD6FBDEFB,
+0xBE18C639, 0xA575BE18, 0x73EFB5B7, 0xB5D88C93, 0xBE19CE7B, 0xDF1CE75E, 0xD6FCDF3D, 0xC6BBD71D,
+0xBE7AC69B, 0xBE7AC67A, 0xC67AC67A, 0xC67AC67A, 0xD71CCE9A, 0xDF5DE77E, 0xDF1BDF3D, 0xD6FBD6FB,
+0xCEDBD6DB, 0xC659BE18, 0xD6DBD6DB, 0x8C72AD36, 0xD6DCC5F9, 0xCEBBCE9B, 0xC67ACE9B, 0xCEBBD6DC,
+0xC639D6FC, 0xAD967C10, 0xAD96C638, 0x7BEF9472, 0xD6DBBE18, 0xD6FCD6FC, 0xD6DBD6DC, 0xCE79D6DB,
+0xEF9DE73C, 0xB5D7F79E, 0xCEFBCEDB, 0xCEB9CEDB, 0xA4CDE6FA, 0xCD2593E4, 0xDD07CCE5, 0x92809A80,
+0xCD88A3E2, 0xB52DBD29, 0x9CF3A511, 0x6B6E9CD4, 0xE73CCE59, 0xE75CEFBE, 0xEF7DEF7D, 0xE77DE75C,
+0xCE7AD6BB, 0xD6DCE71C, 0xCEDBCEDB, 0xD71CDF1C, 0xC69BD6DC, 0xC69BC69B, 0xCE9BD6DC, 0xCE9BCEBB,
+0xCEDBD6DC, 0xD6FCD6FC, 0xCEBBD6DC, 0xC67ACE9B, 0xC67AC67A, 0xC69BCEBB, 0xBE7AC69B, 0xBE5AC67B,
+0xBE3AC65B, 0xBE3ABE5A, 0xBE39BE3A, 0xBE5AC67A, 0xC67AC67A, 0xC67BC69B, 0xC65BCE9C, 0xC67BC65B,
+0xCE9AD6FC, 0xE73DE73D, 0xD6DBE73D, 0xCEDBD6DC, 0xC6BBCEDB, 0xCEBBCEBC, 0xC67ACE9B, 0xCEBBCEBB,
+0xCEBBCEBB, 0xCEBCCEDC, 0xCE9ACEBB, 0xBDD7AD55, 0xBE5ACE7A, 0xBE3AC65B, 0xB5F9B5F9, 0xB5D8BE19,
+0x318518C2, 0x39A52103, 0x31642943, 0x21222943, 0x21022963, 0x21232123, 0x20E22123, 0x10811081,
+0x39851061, 0x29243165, 0x29242103, 0x20E22923, 0x292320E2, 0x39852923, 0x31443964, 0x49E63985,
+0x39844A06, 0x21022102, 0x29432943, 0x39853164, 0x31443164, 0x52483124, 0x52065206, 0x62886AA8,
+0x41E63963, 0x298331A3, 0x31632983, 0x29032923, 0x41E53164, 0x62A75246, 0x5A4662A7, 0x49E562A7,
+0x62E85287, 0x41834A05, 0x6AA96AA7, 0x41C549C5, 0x41E641E6, 0x41E64A47, 0x738E39C6, 0xAD77AD76,
+0xDEFCD6BB, 0xD6DCB5D7, 0x2969CE9D, 0x29682148, 0x20E72128, 0x10A418E5, 0x29682147, 0x21282148,
+0x29683188, 0x18E51084, 0x086210C3, 0x08620862, 0x08620862, 0x29250862, 0x62EA4A48, 0x4A265267,
+0x62E94A05, 0x6B2A5247, 0x62E95A87, 0x7B8C5267, 0x5A8862A8, 0x5A885247, 0x736B4A26, 0x94D16B6B,
+0x9D12634B, 0x9491D6B9, 0xAD13840F, 0xA4D29CB1, 0x9470736C, 0xC5F78C0F, 0xCE17AD13, 0xA4F2A512,
+0x9491738C, 0x73ACAD53, 0x52684A47, 0x4A275288, 0x62EA4A27, 0x8C4F9491, 0x8450B5B5, 0xEF9E8C91,
+0xDF3DDF5D, 0xDF1DDF3D, 0xE75DE75E, 0xDF1CD6FC, 0xE71CDF1C, 0xE75CE73C, 0xEF7DDF1B, 0xCE59CEB9,
+0xAD34D6BA, 0x6B4C4207, 0x8C508C50, 0x62CA8C2F, 0x94719471, 0x9CD27BCE, 0xBDF8AD55, 0xCE59CE59,
+0x5A898C2F, 0x41E54206, 0x5A684A27, 0x5AA95AA8, 0x7B8C5AA8, 0x94509CF1, 0x9CB1840F, 0x5AA962CA,
+0xEF7DD6B9, 0xB5B7E75D, 0xA5349CD3, 0x840E8CB1, 0xA4AFA511, 0xB4CA9C6B, 0xDD0ABCA8, 0xAA439A01,
+0xD5AA82C0, 0xCD8CE64D, 0x5A86BD6F, 0x6AEB62C8, 0x8C2F734C, 0xAD7394B0, 0xAD32842E, 0xAD7373CC,
+0xCE1683ED, 0xBD959CB1, 0xCE79D6B9, 0xC658BE17, 0xD6DCCE7A, 0xDF1DCEBB, 0xE77EE75D, 0xCE9BD6FD,
+0xCEBBCEBB, 0xD6BCCE9B, 0xD6DCCEDC, 0xCEBBCEBB, 0xC69BC67A, 0xBE7BC69B, 0xB65AB63A, 0xB65AB639,
+0xADFAADF9, 0xB61AADD9, 0xB61AADFA, 0xB61AADF9, 0xB5F9ADD9, 0xBE3AB5F9, 0xC65ABE3A, 0xD6DCC67B,
+0xD6BADF1C, 0xE73CDF3C, 0xD6DBDEFC, 0xC69ACE9A, 0xC69BC67A, 0xC67BC67A, 0xC65BBE3A, 0xC69BC65B,
+0xBE7ABE7A, 0xBE5AB639, 0xB5F8AE18, 0x9D14A575, 0xADB8A596, 0xADB8A5B8, 0xA598A598, 0xCEDCADF9,
+0x318418A2, 0x29432923, 0x29432943, 0x21022943, 0x29632923, 0x29642923, 0x108118C2, 0x10A220E3,
+0x29441082, 0x10A218C2, 0x21033165, 0x18C218E2, 0x18A120E2, 0x31233164, 0x31233123, 0x39845207,
+0x316441A5, 0x31642903, 0x18C13144, 0x42072903, 0x292339A5, 0x49E63985, 0x626751E6, 0x49E56287,
+0x39C441C5, 0x296239C4, 0x39A44A26, 0x20C120E2, 0x4A263144, 0x52245A87, 0x52245A45, 0x5A675A66,
+0x52674A05, 0x416351E5, 0x62475A26, 0x41846288, 0x398441C5, 0x314341A4, 0x31653964, 0x39C841C8,
+0x9CD38411, 0x7C105289, 0x29498C54, 0x21272969, 0x19072949, 0x088418E6, 0x31CA2148, 0x31AA39EC,
+0x10842107, 0x18C42947, 0x088218C4, 0x08621083, 0x08620862, 0x29451042, 0x5AA9734C, 0x52465A47,
+0x4A055205, 0x524541A3, 0x5AA75A66, 0x62A85A67, 0x5A4662A8, 0x6AE862A8, 0x4A456B08, 0x41E439A4,
+0x4A464A66, 0x318462E9, 0x52475247, 0x41C54A06, 0x62A96AC9, 0x52275A48, 0x5A685A68, 0x62C86AE9,
+0x5A8862C9, 0x5AA883AC, 0x52675246, 0x5A8749E5, 0x5AA84A05, 0x42055AA8, 0x4A6841C5, 0xB5D64A48,
+0xCEBADF1C, 0xCE59DEFC, 0xB5B6D69A, 0x9491A4F3, 0x630B83EF, 0x8C506B4C, 0x94709470, 0x52686B2B,
+0x62CA62CA, 0x5AA862CA, 0x5A886AC9, 0x52476288, 0x5A885227, 0x5AA96B0A, 0x5AA941E6, 0x83EF738E,
+0x52265A68, 0x41834A05, 0x62876287, 0x5A875246, 0x524662A7, 0x62A85A67, 0x5A6862C9, 0x4A265A67,
+0xF7BED6B9, 0xB597EF7F, 0x734C62CB, 0x5AC8734B, 0x736A8C0D, 0x72E77329, 0x79808B05, 0xA1E39101,
+0x9406ABC8, 0x8BA49BE6, 0x7B65D5CC, 0x730A7308, 0x62EA6ACA, 0x5AE86B2A, 0x62E86B29, 0x63086308,
+0x7B6A83AB, 0x6B097309, 0x7BAD9C70, 0x9470732B, 0xD699BDB5, 0xDF1BD69A, 0xEF5CE6FB, 0xCEDCDF3D,
+0xCEBCDEFD, 0xCEBCCEBC, 0xD6FCD6FD, 0xCEDCD6FC, 0xCEDCD6FD, 0xBE7BC69B, 0xC69BC69C, 0xBE5AC69B,
+0xB63BBE7B, 0xBE5BBE5B, 0xB63BBE5B, 0xBE5BBE5B, 0xBE5BC67C, 0xCEBCCE9C, 0xCEBCCEBC, 0xD6DCD6FC,
+0xCE79DF1C, 0xD6DBDEFC, 0xCEBBD6DC, 0xC67ACEBB, 0xC67BC69B, 0xC65AC69B, 0xC63AC65B, 0xC65BC65B,
+0xB619C65A, 0xB65ABE5A, 0xBE59C69B, 0xA555B5D7, 0xC67BCE9B, 0xC6BCCEBC, 0xBE7BCEDC, 0xB65ABE7B,
+0x39852102, 0x21032923, 0x29432923, 0x29432943, 0x29432122, 0x18E22922, 0x108118E2, 0x18A20861,
+0x18C218C2, 0x18A21903, 0x212318C2, 0x18C210A1, 0x210310A1, 0x29233164, 0x39843143, 0x41A449E5,
+0x39845268, 0x29033143, 0x20E32103, 0x29241081, 0x39842944, 0x524739A5, 0x4A0541C4, 0x41C549E5,
+0x39A539A4, 0x39A42963, 0x31633183, 0x29242923, 0x49E63164, 0x49E44A05, 0x41C34182, 0x49C55A46,
+0x39A53984, 0x49843123, 0x5A065A26, 0x418451E6, 0x39843143, 0x4A0641E5, 0x398539A4, 0x31A63185,
+0x5AC9630B, 0x73AD5AE9, 0x29689D15, 0x21472988, 0x21272128, 0x108418E5, 0x39EB1927, 0x21282949,
+0x29472147, 0x18C418E5, 0x10831083, 0x08620862, 0x084218C4, 0x39860841, 0x5A685248, 0x5A475A67,
+0x49E65226, 0x62876B09, 0x5A873983, 0x62875226, 0x5A675A46, 0x72E86AE8, 0x5A876AE8, 0x39834A25,
+0x62C739A2, 0x62C85AA7, 0x62A75A87, 0x5A265A66, 0x62A85A87, 0x49C65206, 0x6AE94A26, 0x524662C8,
+0x5A875266, 0x49E55226, 0x62E85A87, 0x5A6662E8, 0x62A85266, 0x52474A05, 0x39C63143, 0x4A484207,
+0x52685AEA, 0x39A55AA9, 0x41E64A26, 0x52474A06, 0x5AA85267, 0x39845246, 0x5A8739C4, 0x5A675AC7,
+0x5A675A67, 0x62A75225, 0x6AC862A7, 0x6AE96288, 0x5A675226, 0x526662C8, 0x62E84A25, 0x6B4A5AA8,
+0x5AA75AC7, 0x5A875286, 0x41A34A05, 0x6B0841C4, 0x6AE86B07, 0x62C85A86, 0x52065246, 0x62C762C7,
+0xEFBECE98, 0xB597EF5E, 0x6AC86289, 0x8C0C6AE8, 0x5AA683CA, 0x5A464204, 0x81218265, 0xA9E598E1,
+0x73477A85, 0x93A56AA4, 0xACA4EEEB, 0x62A95A63, 0x52875AA8, 0x62E96B2A, 0x4A664A46, 0x5A665286,
+0x522562E7, 0x62A74A04, 0x7B4A6AE8, 0x7B087B29, 0x83AB72E8, 0xAD12732A, 0xACF2A4B0, 0xDF3CD6B9,
+0xD6FCD6FB, 0xCEBCCEBB, 0xC69BC69B, 0xC6BBC69A, 0xC69BBE9B, 0xBE7BC69B, 0xC69BBE7A, 0xCEBCC69B,
+0xD6FDCEDC, 0xC69CC69C, 0xCEBCC69B, 0xCEBCC69B, 0xC69BC69B, 0xCEBCCEBB, 0xCEBBCEBB, 0xCEBBCEBB,
+0xB5B8C67A, 0xC65BBE39, 0xC69BBE3A, 0xC69BCEBC, 0xBE7BC69B, 0xBE5BC6BB, 0xCE9BC67B, 0xCE9BC69B,
+0xCEBBC67A, 0xCEBCCEDC, 0xC69AC6BB, 0xA534BE17, 0xBE5ACE9A, 0xC69BC65A, 0xC69BBE7B, 0xC67BBE5A,
+0x31442903, 0x29033124, 0x18C220E2, 0x21023164, 0x31642943, 0x294318A1, 0x108120E2, 0x10811082,
+0x10A22944, 0x10A218E3, 0x10C21081, 0x18C218E3, 0x210220E3, 0x31643184, 0x49E641C6, 0x49E649C5,
+0x312341C6, 0x29242924, 0x18C328E4, 0x21031082, 0x29433144, 0x524649E6, 0x526641E5, 0x41C55246,
+0x39A52923, 0x316339A5, 0x29223163, 0x29232923, 0x41C541A5, 0x49C45206, 0x41A35245, 0x312349C5,
+0x398449E6, 0x49C56AA9, 0x62885A06, 0x418449A5, 0x41E541A4, 0x4A0541C4, 0x39A44A06, 0x4A2718A1,
+0x528862EA, 0x52885AC8, 0x39C9738F, 0x21482968, 0x21272128, 0x10C41905, 0x31CA2968, 0x298931AA,
+0x18E62948, 0x18C42106, 0x086210A4, 0x18C40863, 0x08621084, 0x29451042, 0x52265AA9, 0x52265A47,
+0x5A475A47, 0x49C55226, 0x62C84184, 0x49C549C5, 0x5A465A26, 0x62876AA8, 0x52255A87, 0x41E462A8,
+0x5A865245, 0x6AC85246, 0x41835225, 0x62875A66, 0x49C462A8, 0x49E649E6, 0x62A862A8, 0x62C75AA7,
+0x4A047B6A, 0x41A45205, 0x6AE95246, 0x4A055A66, 0x522562A7, 0x41C55A67, 0x31843143, 0x39A539C6,
+0x4A2639A5, 0x41C541C5, 0x41C441E5, 0x49E549C5, 0x5A6662A8, 0x522562A7, 0x52655A66, 0x62C762C7,
+0x52265226, 0x5A6662A7, 0x73495A66, 0x62A872E9, 0x52266288, 0x62E762C7, 0x528662E8, 0x6B096B2A,
+0x524641E5, 0x62E862E8, 0x5A8649E4, 0x5A8662A7, 0x62C67349, 0x4A055A86, 0x49E55226, 0x5AA7838A,
+0xEFBECE98, 0xB556F7BF, 0x5A465A68, 0x7B897B49, 0x62C67B48, 0x5A264A25, 0x914389E5, 0xA1E5A944,
+0x62E77A87, 0x7AE172C6, 0xEEABE648, 0x52674160, 0x52A75267, 0x528762E9, 0x42055287, 0x6B085A66,
+0x41C362A7, 0x526541A3, 0x6AA65A45, 0x830782E7, 0x5A047B07, 0x7B4972E8, 0x730A834A, 0xC6588C70,
+0xC67ACEDB, 0xC6BBCEBB, 0xBE7BC67A, 0xBE7AC69B, 0xC6BBC69B, 0xCE9BC67B, 0xCE9ACE7B, 0x8C72BE19,
+0xADB6B5B7, 0xD6FCD6BB, 0xCE9AC67A, 0xC69BC67B, 0xBE39C69B, 0xC67AC69B, 0xCE9AC67A, 0xCEBBDF3D,
+0xC69BCEBB, 0xC67ACEBB, 0xBE39B5D8, 0xC67AC67A, 0xC69BCEBC, 0xBE39C65A, 0xC65AC65A, 0xC619CE7B,
+0xD69AD6BB, 0xCE9AD6BB, 0xC638C65A, 0x9CB2BDD6, 0xC679D69A, 0xCE9BCE9B, 0xC67AD6BC, 0xBE39C67A,
+0x314420E3, 0x210318C2, 0x20C22903, 0x31642923, 0x31443164, 0x292318A1, 0x10812103, 0x10411061,
+0x20E32944, 0x20E31081, 0x108218C2, 0x18E30860, 0x316418E2, 0x39A52923, 0x41A541C6, 0x4A073103,
+0x21033164, 0x21032903, 0x29041061, 0x31650840, 0x39A52944, 0x41E53183, 0x52674A46, 0x41C42921,
+0x39A52943, 0x31433984, 0x39A42922, 0x39A52943, 0x5A684A06, 0x52264A05, 0x39833982, 0x312328E2,
+0x524741C5, 0x49A45247, 0x62885206, 0x41633922, 0x41E55226, 0x316339C4, 0x41C53984, 0x42064A26,
+0x5A8839C5, 0x31645267, 0x422B3187, 0x29482948, 0x18E62127, 0x10A41905, 0x422B2147, 0x29482969,
+0x29482127, 0x10A418C5, 0x08431083, 0x19050883, 0x08421083, 0x20C31062, 0x5A685268, 0x49C53963,
+0x4A065A67, 0x49E541C5, 0x5A672902, 0x6AE88BEC, 0x5A6649E4, 0x520562C7, 0x52665245, 0x5A865265,
+0x4A0541E4, 0x5A4741A4, 0x41A449C5, 0x522649E5, 0x52265A67, 0x4A264A26, 0x4A255246, 0x6B075265,
+0x4A048C2C, 0x41A35A86, 0x6B0A5266, 0x524641C4, 0x52265A87, 0x39634A06, 0x4A474206, 0x31643184,
+0x41E62102, 0x39843143, 0x39843984, 0x41843143, 0x62A85A67, 0x49E55226, 0x49E45225, 0x62A862A7,
+0x522641E5, 0x62C86B09, 0x52255A86, 0x732A5245, 0x62C84A05, 0x5AC762E8, 0x420541E4, 0x4A476309,
+0x41C439C4, 0x5AA75A87, 0x5A874A46, 0x6B295AA7, 0x62C75285, 0x4A065AC8, 0x52673143, 0x4A2562E8,
+0xEF9ECE78, 0xBD97E71D, 0x4A254A07, 0x7B8962C7, 0x62E76307, 0x62065266, 0xA94399E5, 0xA247A9A4,
+0x4A4559E5, 0x93A38385, 0xC509B485, 0x5A8849C2, 0x5AC839E5, 0x5A874A46, 0x31424A26, 0x72E862A6,
+0x41A36287, 0x52253141, 0x72C75A65, 0x83487B07, 0x5A2472E6, 0x730862C6, 0x6AC97308, 0x9D3473AD,
+0xCEDCBE59, 0xCEBBC6BB, 0xC6BBCEDB, 0xCEDCC69C, 0xD6FCCEDC, 0xE73CDF1C, 0xC638E73C, 0x630B7BCE,
+0x5AC95AE9, 0xA553632B, 0xCE79C658, 0xCE9BD6FB, 0xCE9BC67A, 0xC67ACEBB, 0xE77DA575, 0x9D34C678,
+0xBE178CB1, 0x9CF39D13, 0x6B8D7C0F, 0x84306B8D, 0xCE7A8450, 0xB5F7BE38, 0xA515B5B7, 0xBD96AD55,
+0x8C0F9C70, 0x9CD27BAE, 0xAD54B5D6, 0x9C6F9C70, 0x9491AD33, 0x9CD2CE78, 0xA5348C70, 0x94B2738D,
+0x31243965, 0x188120A2, 0x20A21861, 0x20E23144, 0x18813144, 0x18A13164, 0x29033965, 0x18A21882,
+0x28E32904, 0x18811861, 0x106118A2, 0x18C21881, 0x18813145, 0x41C63144, 0x312341A6, 0x41C63103,
+0x31643985, 0x29243144, 0x20C320C3, 0x29031882, 0x290220C2, 0x41C44A06, 0x49E54A05, 0x31434183,
+0x31433984, 0x314349E6, 0x4A4720E2, 0x31433144, 0x52265247, 0x49E549E5, 0x29223163, 0x49E62902,
+0x4A063984, 0x41843964, 0x52066268, 0x5A673943, 0x41C549C5, 0x314441C5, 0x41E62923, 0x4A063964,
+0x524749E6, 0x31644A05, 0x29484209, 0x29482929, 0x18E62128, 0x10E41905, 0x39EA2967, 0x2948318A,
+0x21272948, 0x18C418C5, 0x08631063, 0x18E52927, 0x084220E5, 0x18A21082, 0x52475A68, 0x49E549E5,
+0x41E55247, 0x31225A88, 0x7B6B3964, 0x7308D614, 0x8BEC7308, 0x52456AE8, 0x4A255225, 0x4A455266,
+0x41C541E5, 0x52266288, 0x41C549E6, 0x52465226, 0x41C45246, 0x5A8741C5, 0x41C341E4, 0x6B276B28,
+0x526562C7, 0x31625A86, 0x734A4A25, 0x4A255226, 0x4A055226, 0x52674A05, 0x39C45AA8, 0x31A539A5,
+0x420739A5, 0x31642923, 0x39A441E6, 0x5A673123, 0x62C862A9, 0x49E549E5, 0x39833963, 0x524662C8,
+0x39845247, 0x62C85226, 0x62C86B08, 0x6B095226, 0x41E44A05, 0x52665AC7, 0x52674A45, 0x420639C5,
+0x41C43984, 0x4A255AC8, 0x4A264A26, 0x5AA762E9, 0x52A65AA7, 0x210241E5, 0x5AA92924, 0x39C46B29,
+0xF79EC637, 0xB576F79F, 0x420539A6, 0x63076B49, 0x526562E7, 0x494262E8, 0xCA68A1E6, 0x7163BA88,
+0x41C26A67, 0xB4A5ACE7, 0x7AC39BA4, 0x41E65A25, 0x42054226, 0x4A055267, 0x62C85247, 0x52056AC8,
+0x292141C4, 0x63085246, 0x5A666B09, 0x73076AC7, 0x62C67307, 0x73287308, 0x62A87309, 0xAD956B4B,
+0xCE9BD6DC, 0xC6BBCEBB, 0xCEDCCEDC, 0xC67BC67B, 0xD6FCD6DD, 0xCE78DF1C, 0x5A888C2F, 0x52675247,
+0x52A75266, 0x52874A46, 0x630B840E, 0xCE79AD54, 0xCE99E73C, 0xB5D6DEDB, 0xAD53AD34, 0x5288840E,
+0x94B0630A, 0x630A632B, 0x4A476B2B, 0x42074A27, 0x630A5268, 0x6B6C840F, 0x6B4C630B, 0x628A7B4D,
+0x6AA96AA9, 0x62CA6ACA, 0x6B0A6B2B, 0x9C6E8BCC, 0x5AA962A8, 0x62C983AD, 0x62CA5A89, 0x5AA95A89,
+0x52065247, 0x524849C6, 0x520749E6, 0x41A549E6, 0x49C641A5, 0x49C641C5, 0x49E65247, 0x41A63985,
+0x416530E3, 0x28C33103, 0x20813965, 0x20A21861, 0x29033124, 0x5A691881, 0x31034185, 0x39442081,
+0x29022902, 0x29032902, 0x20C22923, 0x314428C2, 0x41843944, 0x39435226, 0x49A45226, 0x394349C4,
+0x41A541C5, 0x398541A5, 0x292320E2, 0x31642943, 0x49E641C5, 0x398449E5, 0x39C53163, 0x31643164,
+0x39643123, 0x31233123, 0x416449E6, 0x522741A4, 0x41A541C5, 0x290320A2, 0x20E218A1, 0x31222922,
+0x396341A5, 0x5AA841C4, 0x20E74A29, 0x20E8318A, 0x210618E7, 0x10A410C4, 0x422B2106, 0x31693189,
+0x21062948, 0x10A418C5, 0x18A40863, 0x21261905, 0x086210A4, 0x31650820, 0x41E641E6, 0x39A439A4,
+0x31633183, 0xA4D083EC, 0x49E441E5, 0x93EBA4CE, 0x49A3B530, 0x52255245, 0x52465245, 0x4A655AA6,
+0x4A253162, 0x41E54A05, 0x41E44A25, 0x4A253182, 0x4A254A45, 0x52463983, 0x5A664A04, 0x62A56AE6,
+0x4A0441E3, 0x4A252920, 0x5AC741E3, 0x4A0539A3, 0x42054A45, 0x9CAF41E4, 0x29224A25, 0x21032944,
+0x4A474A67, 0x41E62943, 0x316439C5, 0x52673184, 0x52474A26, 0x39834A06, 0x39A439C4, 0x62E95287,
+0x41A44A06, 0x6AE841A3, 0x62A762C7, 0x41A45247, 0x31023143, 0x52665A87, 0x4A055266, 0x39A441E5,
+0x31632922, 0x62E94A66, 0x4A263184, 0x52866329, 0x424552A5, 0x18E231A4, 0x52A92103, 0x29634A87,
+0xEFBDBE36, 0xB597EF7F, 0x4A4641E6, 0x52A53A03, 0x5AC65AE6, 0x7A876B07, 0x78A17903, 0x61A38A06,
+0x41E049E4, 0xCD85FF8D, 0x49C16AA0, 0x52885287, 0x39E54226, 0x4A2639C4, 0x52464225, 0x524649E5,
+0x294241E4, 0x634A52C8, 0x4A0652A8, 0x39A441E5, 0x62C75245, 0x6AE76B28, 0x5A8662A6, 0x83ED62C7,
+0xCE9AB596, 0x73CF8471, 0xDF5DB5F7, 0xD6DDCEBB, 0xD6DBCEBC, 0x5AE9C637, 0x5A865265, 0x52255A66,
+0x83EB4A24, 0x52874204, 0x4A26736B, 0x52884A47, 0xBD94AD52, 0x83CC83CD, 0x62A77309, 0x62A762A7,
+0x8C0E5266, 0x5AC87BCC, 0x52465AA7, 0x52055246, 0x5A875A66, 0x5A6762C8, 0x52474A46, 0x6A886288,
+0x6A686247, 0x6AA96A88, 0x5A476288, 0xB4F07B4A, 0x62C962C8, 0x6AC96AC9, 0x62886288, 0x6AA96288,
+0x5A275206, 0x52075A48, 0x62895A27, 0x51E65A27, 0x62886268, 0x62886288, 0x62A872EA, 0x62895A27,
+0x72CA6AA9, 0x72CA6A8A, 0x6AC96AA9, 0x6AC972EA, 0x6AC962A9, 0x62686AAA, 0x62885A07, 0x5A4772AA,
+0x52266288, 0x52065A88, 0x49E66ACA, 0x62475206, 0x5A266247, 0x41435A27, 0x49A451E5, 0x51E56226,
+0x41A549C5, 0x39643964, 0x4A063123, 0x28C130E2, 0x49C56AEA, 0x39843964, 0x39842902, 0x21023143,
+0x208128E3, 0x28C23945, 0x49C53964, 0x49C551E6, 0x31445A47, 0x292420A2, 0x29231861, 0x49E43122,
+0x4A0549E5, 0x5AA83141, 0x31684A29, 0x2949318A, 0x21472969, 0x10A42126, 0x422C18E6, 0x318A2949,
+0x10A52107, 0x10C418E5, 0x20E51063, 0x18E531A9, 0x08420863, 0x31C50841, 0x4A2639C5, 0x31434A07,
+0x4A462922, 0x7BAB41E5, 0x7B6AE6D8, 0xC592A46E, 0x49A35A04, 0x628672C7, 0x52255246, 0x52655245,
+0x52663983, 0x526741E5, 0x41E462E9, 0x41E44A25, 0x31635266, 0x4A0539A4, 0x62865226, 0x62A56AA6,
+0x41A25A86, 0x52455225, 0x528641C4, 0x31834A05, 0x42045266, 0x7BCB3982, 0x21025246, 0x20E33144,
+0x31A54206, 0x31A43184, 0x41E539A4, 0x39C54A06, 0x4A0641E5, 0x29225247, 0x29225247, 0x52874A26,
+0x312239A4, 0x6AE75225, 0x52257308, 0x49E55A47, 0x39835206, 0x41C44A05, 0x5266734A, 0x31634A26,
+0x41E43984, 0x62C86B29, 0x52673984, 0x5AA762C8, 0x52A65265, 0x29225267, 0x41C53144, 0x2961734A,
+0xEFBDC636, 0xB597F77F, 0x4A872924, 0x52C65AE7, 0x52654224, 0x72467308, 0x602070C2, 0x59C46123,
+0x84055202, 0xEEC9EF09, 0x520472E3, 0x5AC94206, 0x42055AC8, 0x39A44A47, 0x31A45287, 0x42054A06,
+0x298331A4, 0x630A4A67, 0x39E552A8, 0x31A42964, 0x734941C4, 0x5A866AC7, 0x524562A7, 0x5A466286,
+0xAD545248, 0x52C97BCE, 0xBE384A69, 0xCEBCD6FC, 0xD6FBDEFC, 0x5AC79CF2, 0x62A65244, 0x62866AC7,
+0x738A49C4, 0x41E439A4, 0x39A3736A, 0x39C441C4, 0x8C0D3983, 0x62875A46, 0x72C772C8, 0x72C78369,
+0x7B8B5A67, 0x4A057B8B, 0x41C35225, 0x5A456287, 0x62866AC7, 0x6AE87308, 0x62876AE8, 0x59E551E5,
+0x59C56A47, 0x6AA972A9, 0x5A475A27, 0xB4CF93CC, 0x5A675A46, 0x628772E9, 0x62885A47, 0x5A266248,
+0x49C551C5, 0x5A275206, 0x5A0751E6, 0x49C551E6, 0x5A065206, 0x5A275206, 0x62476AA8, 0x62686247,
+0x6AA95A27, 0x622772C9, 0x6AA96A88, 0x62686AC9, 0x72A85A26, 0x62476267, 0x6A676A67, 0x72A872A8,
+0x72C96A88, 0x6A6772C8, 0x6A688B6B, 0x72A972A8, 0x7ACA6A67, 0x72C972A9, 0x7AE972A8, 0x41226246,
+0x62476247, 0x5A066267, 0x62476288, 0x5A065A26, 0x49A45A26, 0x49C549A4, 0x49C53122, 0x28E23143,
+0x30E328E2, 0x312428E2, 0x31023943, 0x39423943, 0x28E23943, 0x20C320A2, 0x41A51061, 0x41C32921,
+0x5A645224, 0x4A657BA9, 0x39A862EA, 0x318A2968, 0x10A52988, 0x21270063, 0x4A4D2148, 0x39CB39EC,
+0x29471907, 0x10A418C4, 0x29261084, 0x08632947, 0x10830863, 0x31840861, 0x4A474A47, 0x398562EA,
+0x31633143, 0x41C441E5, 0xC5727309, 0x8B8A940C, 0x72C84983, 0x62458B8A, 0x6AE85225, 0x41E541C4,
+0x4A462922, 0x41C44A26, 0x31425A87, 0x4A044204, 0x41C441E4, 0x39633163, 0x5A4549E4, 0x62A56285,
+0x5A6562A5, 0x41C362E7, 0x5AA84A46, 0x316339A3, 0x31424205, 0x736B41C4, 0x29225AA8, 0x31444A26,
+0x39E63184, 0x31843184, 0x524731A4, 0x31643163, 0x41E53984, 0x39843984, 0x290241E5, 0x4A064206,
+0x5A872922, 0x62C66B28, 0x5A655244, 0x39835225, 0x52463143, 0x524541E4, 0x31635AA7, 0x31644A47,
+0x62C841C5, 0x62A87B6A, 0x6AE95A46, 0x8BCB6AE8, 0x73277B68, 0x73097B49, 0x49835206, 0x6AE76AA6,
+0xF77C944E, 0xB5B6EF5D, 0x31A42144, 0x52665AC7, 0x5AA84225, 0x59635226, 0x708170A1, 0x62056123,
+0xD62A3940, 0xE6A9DE66, 0x52266AC4, 0x4A4752A8, 0x398439C4, 0x4A2739A5, 0x296339C5, 0x31832943,
+0x4A6618E1, 0x5AC94226, 0x4A674A67, 0x21022142, 0x628739A3, 0x7B296AC6, 0x49C44A25, 0x624651E4,
+0x49E65226, 0x42054A26, 0x840F2963, 0xD6BCCE9A, 0xAD55D6DC, 0x5AC86B6C, 0x6AE75244, 0x6AC87308,
+0x7B8B41A3, 0x4A062922, 0x39A47BAC, 0x398439A4, 0x944E3983, 0x52255245, 0x83496286, 0x72C77B28,
+0x732A49C4, 0x5A67736A, 0x5A4662E8, 0x6AC87308, 0x72E97B4A, 0x62A862C7, 0x62686287, 0x518551E6,
+0x59A55184, 0x62475A06, 0x6AA85A47, 0xACD07329, 0x52466287, 0x52055205, 0x49E549E5, 0x62675205,
+0x51E651C6, 0x49A559E6, 0x51C659E7, 0x51C65A07, 0x5A266227, 0x5A066227, 0x59E672A9, 0x59E572A9,
+0x62476A68, 0x62476227, 0x62476A67, 0x72A86206, 0x62256A87, 0x62056A67, 0x6A466A47, 0x72A87AA8,
+0x72887288, 0x59C482E9, 0x72A882E9, 0x7AC87AA8, 0x72887A88, 0x6A477268, 0x7AC872A9, 0x62267288,
+0x72A87288, 0x6AA872A9, 0x72887AEA, 0x59C47AC9, 0x832A6246, 0x72E9832A, 0x836C7AEA, 0x6AC96AA9,
+0x6A8872EA, 0x62886AC9, 0x628872E9, 0x51E572C9, 0x5A476247, 0x418549E6, 0x39424185, 0x83885A65,
+0x7B478368, 0x62E562C4, 0x31A68C2D, 0x39CA39C9, 0x08852128, 0x31A931C9, 0x31AA0865, 0x294941EC,
+0x10C42107, 0x108318C5, 0x31A82106, 0x08842948, 0x082110A4, 0x398418C2, 0x4A464A27, 0x314341C5,
+0x41C541A5, 0x52255A67, 0x51E451E4, 0x7AE8C551, 0x5A0459A4, 0x62666225, 0x418351E4, 0x41C449E5,
+0x41634184, 0x418341A4, 0x52255A26, 0x41E45245, 0x41A45246, 0x41A428C1, 0x5A246246, 0x62857B28,
+0x62A67328, 0x52865225, 0x4A2649E5, 0x20C03984, 0x4A265A88, 0x83CD41C5, 0x20C15247, 0x4A063984,
+0x316439C5, 0x420639C5, 0x31644206, 0x398441E6, 0x4A0641C5, 0x292341C5, 0x292362C9, 0x4A2641A5,
+0x41C43163, 0x4A245AA7, 0x62E75A65, 0x41C35A66, 0x5A865225, 0x52655265, 0x39A362C8, 0x39435A88,
+0x7B6A5226, 0x62866AE8, 0x49C449C5, 0x83488329, 0x8BC9AC6C, 0x72C79BEB, 0x7AC88B0A, 0x83489BCA,
+0xEF5BA4B0, 0xB5B6F79E, 0x29632964, 0x4A053163, 0x41E62943, 0x598541A5, 0x704178A2, 0x59E36965,
+0xF70C6260, 0xB524E687, 0x4A076AE6, 0x4A465267, 0x31432902, 0x41E641C6, 0x18E13184, 0x21222943,
+0x4A464205, 0x62E839A4, 0x41C44A26, 0x39A33984, 0x626541A4, 0x5A456AC7, 0x52474184, 0x41645A06,
+0x4A0551E6, 0x41E441A3, 0x4A4839A4, 0xDF1CDEFB, 0x5AAAE71C, 0x6B28630A, 0x7B696AE7, 0x6B085A46,
+0x736B4A05, 0x41E541C5, 0x39C47BAC, 0x42053184, 0x8C0D4A05, 0x52255225, 0x73086287, 0x62866AA7,
+0x62C849E5, 0x5A6783AC, 0x5A4662A8, 0x6AA87B29, 0x5A4672C8, 0x5A466AC8, 0x62886288, 0x51A559E6,
+0x59C54964, 0x5A2759E6, 0x62886268, 0xB5106A87, 0x49E45205, 0x41835A26, 0x49C449A4, 0x5A255A05,
+0x51C65A06, 0x51A651C5, 0x5A0751C6, 0x51A551E6, 0x5A0651E5, 0x622759E5, 0x51C55A26, 0x51A56227,
+0x59E66267, 0x62066A47, 0x62465A05, 0x72876A46, 0x62466246, 0x72676225, 0x72876205, 0x7A876A46,
+0x72676A46, 0x6A267287, 0x7AA872A7, 0x726782E9, 0x518472A8, 0x72886226, 0x72886246, 0x72A87288,
+0x6A676A87, 0x72476206, 0x72876A47, 0x7AE96A67, 0x830A6A87, 0x7AA86226, 0x72A87AC9, 0x7AA972A8,
+0x6A477267, 0x7B0972A8, 0x9BEC72C7, 0x82E972A8, 0x8B6B832A, 0x836A7B29, 0x8BAAA48E, 0x9BEA9C4B,
+0x8B888B88, 0x8BE993E9, 0x41E694AE, 0x39CB31A8, 0x31CB18E8, 0x10A531AA, 0x4A8C0002, 0x10A631CA,
+0x08630022, 0x210618C5, 0x31A931C9, 0x08631906, 0x08410062, 0x5A471860, 0x62883943, 0x398320C0,
+0x396320C0, 0x5A265A66, 0x41415204, 0x6A6672C7, 0x62256245, 0x5A2549C3, 0x52264183, 0x52263983,
+0xAC6EE696, 0x59E551C4, 0x6A874962, 0x49E45225, 0x49C441C4, 0x51E528C0, 0x8B6A6225, 0x72C76AA6,
+0x62A73941, 0x528741C3, 0x4A2720E1, 0x18A12943, 0x4A0641C5, 0x7B4B49C5, 0x29225267, 0x41A541E5,
+0x20E32923, 0x31843985, 0x420639A5, 0x39C52963, 0x52472943, 0x312341E6, 0x292341E6, 0x62EA41C5,
+0x31423163, 0x5A8662E7, 0x6AE73961, 0x52454A25, 0x4A453141, 0x62C64A44, 0x62C75265, 0x51E56287,
+0x6B0862C6, 0x51E47B48, 0x51E53122, 0xC50E8B89, 0x6A649BC9, 0x8B4872A5, 0x8B299BAB, 0x62459BCA,
+0xF79DB572, 0xB5B7E77D, 0x31634A47, 0x39A43163, 0x42062964, 0x516439A4, 0x80E37903, 0x51A169A6,
+0xCDE68340, 0x7B81DE89, 0x39A47BA9, 0x4A264A46, 0x29432964, 0x41E631A5, 0x18C13184, 0x18A12102,
+0x41E539C4, 0x52664A05, 0x52055A66, 0x41A33162, 0x6AE84183, 0x5A665A86, 0x41C64A25, 0x28E341A5,
+0x4A2639C5, 0x31A42962, 0x31C52983, 0xA513842F, 0x39A483EE, 0x73496308, 0x73696B07, 0x62E84A45,
+0x736A39A3, 0x31432122, 0x29226B6B, 0x39A42922, 0x83CC3183, 0x4A0541C3, 0x5A665225, 0x62A75A46,
+0x6AE84A05, 0x6AE9942D, 0x5A665A86, 0x6AC85A25, 0x72E86286, 0x522649A4, 0x5A476287, 0x5A275206,
+0x49844143, 0x5A2651C5, 0x49844163, 0xACB06267, 0x73086266, 0x8B8A7B28, 0x838A7308, 0xA46C9C2B,
+0x49645A07, 0x51A559E6, 0x498459E6, 0x59E659C6, 0x51C559C5, 0x620651C5, 0x61E66A68, 0x61E67289,
+0x59E56206, 0x59A46A27, 0x620559C4, 0x6A676A26, 0x62256A67, 0x72467247, 0x6A267226, 0x6A057226,
+0x72677267, 0x61C47A87, 0x728761E5, 0x72667246, 0x72877267, 0x6A476A26, 0x72477AA8, 0x6A2682C9,
+0x72677267, 0x72887A88, 0x7AA87A67, 0x72A76A26, 0x83097287, 0x7AA882E9, 0x7AA87AA8, 0x7A877AA8,
+0x72468288, 0x728782C8, 0x8B297AA7, 0x82C96A06, 0x7AC882C9, 0x7AE77AA7, 0x8B88A42C, 0x83478B68,
+0xA44B8B47, 0x734893CA, 0x4A687B8B, 0x31AA39C9, 0x3A0C318B, 0x08642969, 0x424B10C6, 0x08442127,
+0x31A82127, 0x298831A9, 0x21473189, 0x006310A4, 0x10410883, 0xA42E3902, 0x9C2D9C0E, 0x838A8BAB,
+0x838B7B4A, 0x8308938B, 0x83287286, 0x72657265, 0x72A66204, 0x59E46245, 0x51E55A05, 0x41624983,
+0xDD938B2A, 0x934AC4F0, 0x6A257A67, 0x6A8651A3, 0x6A874163, 0x72A772A8, 0x72457A86, 0x49A251C2,
+0x7B6A51E4, 0x49E541A4, 0x41C53123, 0x20C13964, 0x5A674184, 0x7B4A6A88, 0x290149C5, 0x314349E6,
+0x316420C2, 0x29023985, 0x31433143, 0x39A43163, 0x49E63102, 0x31234184, 0x39A43984, 0x520641C5,
+0x522541A4, 0x5A456267, 0x7B495204, 0x62A66286, 0x49E35A45, 0x7B6941A2, 0x7B286AE7, 0x6A867B29,
+0x6AE76AE7, 0x83697B28, 0x83AA3101, 0xBC8CC52F, 0x72658B07, 0x8B0782E6, 0x69E37A86, 0x62457225,
+0xEF7BAD11, 0xB5B6EF7D, 0x41C45247, 0x41A549C5, 0x39A53964, 0x38E23123, 0x50205020, 0x49A15144,
+0xCDC5A463, 0x5220ACE6, 0x4A476B07, 0x290241C5, 0x212331A5, 0x39C541E6, 0x29232943, 0x28E23985,
+0x29423964, 0x62E85225, 0x52256286, 0x62876266, 0x73296287, 0x52256286, 0x28E24A05, 0x188120A2,
+0x294220E2, 0x39E539C5, 0x3A0539C5, 0x62E95AC9, 0x736A62E9, 0x736983CB, 0x6B2862A6, 0x4A4541E4,
+0x738B3163, 0x29432922, 0x2102738C, 0x39C52923, 0x6B4A3183, 0x524641C4, 0x41834A05, 0x62C85226,
+0x6B085A46, 0x6287942D, 0x52245A66, 0x52056267, 0x628672E8, 0x5A4651E5, 0x5A664983, 0x5A265205,
+0x51C451A4, 0x72C872A7, 0x93AC8B8B, 0xA48EA46E, 0xBD519C2D, 0xB4EE9C2C, 0xB50FA44C, 0xACACBD2F,
+0x51A56227, 0x59E651C5, 0x59E66227, 0x6A4751C5, 0x6A474964, 0x7AA85A05, 0x72886205, 0x72686206,
+0x6A476206, 0x722761E6, 0x72677267, 0x8B297287, 0x6A267287, 0x72267A67, 0x82A87226, 0x7A8782C8,
+0x8AE882C8, 0x7A877266, 0x6A266A05, 0x72666A05, 0x61C46A25, 0x72676A26, 0x6A267246, 0x72266A26,
+0x7A677A87, 0x72466A05, 0x7A667226, 0x72467A87, 0x8B097246, 0x7AA77A87, 0x7A8782C8, 0x7A677246,
+0x7A677A47, 0x7AA87AA8, 0x82A882C9, 0x8AE96A06, 0x82C98288, 0x7A877267, 0x93897285, 0x8B677AC5,
+0xA44B9C09, 0x838C942C, 0x4A4B6AEC, 0x318A39CA, 0x29892989, 0x10A51907, 0x424B18E6, 0x21282127,
+0x18C618E7, 0x08630823, 0x18A40843, 0x212610A4, 0x08011084, 0xAC0E4143, 0x9BECB48F, 0xA3ECA42C,
+0xB44D9BAA, 0x9B6AA3CB, 0xA3CB9B8A, 0x8B08A3AA, 0x7A666A04, 0x9B8A9BAA, 0x9B8B938A, 0x9BAB9BAB,
+0x9B6A9B69, 0x8B08A3CB, 0x8286A36A, 0x93298266, 0xABEC8AC8, 0x8B089B6A, 0x83079B69, 0x62856A84,
+0x72A74961, 0x62676AA7, 0x6AA86267, 0x41634163, 0x62675205, 0x49836246, 0x39625205, 0x4A054A04,
+0x52265A87, 0x41435205, 0x52254183, 0x5A465225, 0x7B2A49A3, 0x31014162, 0x39623942, 0x520549E4,
+0x6A4651A3, 0x728751C4, 0x83096245, 0x93CB8349, 0x49A372E7, 0x8B8A5A24, 0xA42D8349, 0x6A667AE7,
+0x622572C8, 0x72A68B89, 0x7286A44D, 0xC4AC8B47, 0x9B488B07, 0x93087A65, 0xA38A9308, 0x7AC87245,
+0xFFBCCDD4, 0xC616EF5B, 0x628662A7, 0x49A45A25, 0x41643902, 0x410230E1, 0x48604020, 0x41604143,
+0xCD64C566, 0x41A0AC86, 0x39C562E8, 0x20C239A5, 0x41E52923, 0x4A065A67, 0x314420E2, 0x20E239A5,
+0x31421880, 0x5A455266, 0x51E46AA7, 0x72C76245, 0x7B294983, 0x49A35A45, 0x31224A04, 0x18801860,
+0x294218C1, 0x31A439C4, 0x42063184, 0x526841E6, 0x8BCC6AE9, 0x7349942C, 0x6B0862E7, 0x5AA839C3,
+0x630B20E1, 0x31852103, 0x2103738D, 0x318418C1, 0x734A3163, 0x4A0439A3, 0x398341C3, 0x5A465246,
+0x5A254A05, 0x5A259C4E, 0x62665204, 0x72A76A86, 0x83488369, 0x9BEC8349, 0xAC8DA42C, 0xBCEFAC8D,
+0xC50FB4AD, 0xCD70C52F, 0xBCEFC550, 0xAC8DB4EF, 0xB4EF93EB, 0x940B6AE6, 0x942B8BEA, 0x8BEA7B88,
+0x51C551C6, 0x496459E6, 0x62066207, 0x496451A5, 0x6A6772A8, 0x72876206, 0x72876A26, 0x62066A06,
+0x82C96A27, 0x72277A47, 0x8B097A68, 0x9BAC7A87, 0x7AA87AC8, 0x82C87226, 0x8B297A67, 0x82E87246,
+0x934A82C8, 0x82A79B4A, 0x7A878AC8, 0x72668AE8, 0x7A878B09, 0x82C88AC8, 0x82A78287, 0x82C882A8,
+0x82877A66, 0x82C87A46, 0x82867A66, 0x8AA79B49, 0x93299308, 0x82C782C7, 0x7A668AE8, 0x7A667A66,
+0x72268268, 0x82A782A8, 0x8AE99309, 0x7A268AA8, 0x8AC88AC8, 0x7A6582A7, 0x9B89ABCB, 0xB48C8B06,
+0x7B689C2A, 0x3146730A, 0x41EC3989, 0x2969422C, 0x31A939CA, 0x18E62127, 0x31CA10A5, 0x31AA31AA,
+0x294831AA, 0x29472948, 0x18E52106, 0x21062127, 0x100018A4, 0x8B297268, 0xA3ECAC0D, 0x82E78B48,
+0xB3EB9B49, 0x9B28A38A, 0x9B4992C8, 0x9B499B29, 0xA36AABCB, 0x82867225, 0x9B699329, 0x8B0882A7,
+0xA38A8AC7, 0x7A2569C4, 0x92A7AB6A, 0x9B488AA6, 0x93498AE8, 0x9B488AE8, 0x9BC98AE7, 0x5A436AA5,
+0x938A7286, 0xA40CA3EC, 0x9BECA40D, 0x9BEC9BCD, 0x9BECA42D, 0x9BEC93AB, 0x8BEC9C2D, 0x940C940D,
+0x93EBACCF, 0x9C0C9C0D, 0x9C0CA42D, 0xAC4DB48F, 0x938AAC2D, 0x93AA938A, 0xA42C8349, 0x9BCB9BEC,
+0xA3CCABED, 0xA3ECA3CC, 0xAC4DA3EC, 0xA40C8B49, 0x93AA93AA, 0xA42CA42C, 0xAC4DAC2D, 0x9BCBA3EC,
+0x9C0C9BEC, 0x9389B46D, 0xAC6CAC6D, 0x9B889368, 0x9B889B88, 0x8B289B69, 0x82E782C7, 0xAC8E9349,
+0x83ECACD0, 0x9C8EAD11, 0x83688BEA, 0x83098B6A, 0x72878B6A, 0x49227288, 0x40A04020, 0x8C065A04,
+0xD5C5EE89, 0x49E17B02, 0x20E17329, 0x29023984, 0x41C43143, 0x41C45226, 0x31433964, 0x41A441A5,
+0x52253963, 0x62657B6A, 0x62246A65, 0x62446A66, 0x6A665A04, 0x730872A7, 0x6AC772E8, 0x31015A46,
+0x314320C0, 0x39A439A4, 0x39A539C5, 0x29032923, 0x83AC6B0A, 0x7B69940D, 0x73497308, 0x52464A05,
+0x62EA20E1, 0x39852903, 0x18817B8D, 0x39A41860, 0x8C0C4A05, 0x39825A66, 0x5A4541A3, 0x83AB7B49,
+0x9C6D940D, 0xACCFBD11, 0xC550AC8E, 0xC571CD92, 0xCD91CD70, 0xC550CD91, 0xC550D591, 0xCD70CD70,
+0xBCEEC52F, 0x9C0B9BEA, 0xACAD9BEA, 0x9C4BA44C, 0x8BCA8368, 0x83895203, 0x83897B48, 0x7B697B48,
+0x49844984, 0x49644143, 0x51854963, 0x7AA94963, 0x518459E5, 0x72677AC8, 0x72874942, 0x726751A4,
+0x59845163, 0x722661E5, 0x72677246, 0x6A066A46, 0x728759C4, 0x722661C4, 0x82E859A3, 0x72667266,
+0x7AA75182, 0x934A7A66, 0x8B088B09, 0x82E882C7, 0x8B088B08, 0x828782A7, 0x93299349, 0x8AE77245,
+0x8AA78AE8, 0x9B298286, 0x9B298286, 0x9B298AA6, 0xA3699B28, 0x82C79B69, 0x8B089349, 0x8AC882A7,
+0x8AA89B29, 0x9B699B6A, 0x9B698AC7, 0x9B0892E8, 0xA3699B28, 0xABCAA368, 0xA3889B47, 0x9BE8AC29,
+0x62A8CDD1, 0x316920A3, 0x21092109, 0x088510C6, 0x422A2147, 0x18E61906, 0x420B10A5, 0x318A3A0C,
+0x296829AA, 0x21472147, 0x31882147, 0x10A531A8, 0x08000842, 0xA40B8349, 0xBCCEAC6C, 0xA3EB8B28,
+0xABEBB42C, 0xA38AA369, 0x9B089B49, 0x82459308, 0x82A79308, 0x82866182, 0xA3EB9369, 0x93498B28,
+0x7A459B69, 0x8A667A25, 0x9B2892C7, 0x9389ABEA, 0x8328A44C, 0x9B899BCA, 0x7AA59368, 0x72C67B06,
+0x9BAA8B69, 0xA3EBAC2C, 0x9BCBA42C, 0xA3EC9BEB, 0xB44DA40C, 0x9BABAC0C, 0x9BCBA3EB, 0x93AAAC6D,
+0x9C0B93EA, 0xAC2CAC4C, 0xB44DA40C, 0xB40CA3EB, 0x9B49B40C, 0xABEA9B68, 0xB42CAC0B, 0x9B499B89,
+0x9B8A8AE7, 0x9B6A9329, 0x8B288308, 0xA40B9BEA, 0x9C0B6A44, 0xB4AEA42B, 0xA40BBCCE, 0x93CA9BEA,
+0xA46C9C2B, 0x9BCA8B48, 0x93EAAC8D, 0x9BE993A8, 0x83669C29, 0x7B077B26, 0x7B077AE7, 0x8C0A62A5,
+0x83CA8BEA, 0x73476B67, 0x938893E9, 0xA3EB8B07, 0xA3EB93A9, 0x6163A3AC, 0x71C350C0, 0xCDEA93C7,
+0xF708DE85, 0x7B479C46, 0x5265946D, 0x5A865A86, 0x5AC752A6, 0x41C45A86, 0x41C539A4, 0x628749E4,
+0x72A672E7, 0x72A58348, 0x93C98367, 0x8B89A44B, 0x72C77B07, 0x7B086A86, 0x7AE8836A, 0x832A72A7,
+0x836A72E8, 0x52466AC7, 0x21022942, 0x29232122, 0x83ED5AE9, 0x6AC783AB, 0x7B086AC6, 0x62666285,
+0x7B4A28C0, 0x418428C1, 0x30E17B6B, 0x942D49E4, 0xBD71B510, 0xB50FC591, 0xCDB1BD4F, 0xC571CDB2,
+0xC591C570, 0xC571C571, 0xB4CEA46C, 0xB4CE9C4B, 0xA44B9C0A, 0xBD2FB4EE, 0x9C0A9C2A, 0x93CA8BA8,
+0x5A447B47, 0x49C25203, 0x83685A64, 0x8BC97B68, 0x62656AA5, 0x93CA4981, 0x8B897307, 0x9BEBB4CE,
+0x498451A5, 0x49644143, 0x59C551A5, 0x62065184, 0x61E57287, 0x59A47AC9, 0x72A759C4, 0x72A86206,
+0x51837AC8, 0x7A877A88, 0x72676A06, 0x62257AA8, 0x62464963, 0x6A267267, 0x72867287, 0x6204936A,
+0x6A258B49, 0x82A78AE8, 0x7A877A66, 0x9BCB82C7, 0x8B287A86, 0x82A78286, 0x8B088AC7, 0x82C68AE8,
+0x8AE87225, 0x8AC79B49, 0x93089B29, 0x9B087A04, 0x9B488265, 0x7A869B49, 0x72049308, 0x93299B49,
+0x826692E8, 0x9B4992E8, 0xB3EA92E7, 0x9307A38A, 0x9B479B48, 0xB3E9B3EA, 0x9B889B47, 0x93E9A409,
+0x18827B6A, 0x39CB2927, 0x294A41ED, 0x216818E7, 0x18E51906, 0x08840843, 0x31CA18C5, 0x298A31AB,
+0x2989298A, 0x29682969, 0x29472968, 0x08632127, 0x10000842, 0x9BA98329, 0x9BCAB48D, 0xA3EB82C7,
+0x9B69D510, 0x93079B69, 0x9B49A349, 0x826592E8, 0x82869B29, 0x72448286, 0x7AE79349, 0x8B0782E7,
+0x8AC78AE7, 0xA36A8A66, 0x93489B49, 0x72E58306, 0x7B6762A4, 0x8B478B89, 0x6223A3EA, 0x72C58B88,
+0x7AE76A85, 0x93897265, 0x9C0A93CA, 0x8B289369, 0xAC0BA3AA, 0x8B07ABEB, 0x9B89ABEB, 0x93899BAA,
+0x93A98327, 0xA3EAAC6C, 0x9BAAA3EB, 0xBC8DA3AA, 0xBC2BABAA, 0xA3A9D4EE, 0xA3C9B44C, 0x9B499B69,
+0xA3CAA3CA, 0x9369AC2C, 0xC54F8308, 0x7B06B4CD, 0xC54F7AE6, 0xD5B1B4AD, 0x8348BCEF, 0x6AA48368,
+0x7366944A, 0x8BA98347, 0x9C6BA4AD, 0x940993C9, 0x6B457BA7, 0x6AE57B67, 0x8BC972E5, 0x73066A84,
+0x93EA72A6, 0x83A8942B, 0x9327A40A, 0x9BEA8B07, 0x9BEA93E9, 0x4860A3AC, 0x69A14820, 0xD6499BC5,
+0xE6C7E6A5, 0x83898364, 0x7367944B, 0x62E66B27, 0x63266306, 0x41E35265, 0x62E74A65, 0x8C0A8C2B,
+0x8BA98BCA, 0x942A8347, 0xACCCB4EC, 0x940A9C4B, 0x52237B27, 0x6AA65A03, 0x7B4893EB, 0x83698328,
+0x940B8B89, 0x7348940B, 0x21413162, 0x21422983, 0x6B6A4A66, 0x6B077348, 0x83898BCA, 0x8BA972E7,
+0xBD92940C, 0xB530BD71, 0x9C6DBD71, 0xA4CEA4AE, 0xA4CDB52F, 0x942AACCD, 0x8BC9A48C, 0xA46C9C4B,
+0x940A9C2B, 0x8BA99C0B, 0x6AE58368, 0x8BE98368, 0x8BC9940A, 0xBD6FB52E, 0x72E59C4B, 0x5A446AA5,
+0x49E36285, 0x5A455A45, 0x62C562A6, 0x6B067327, 0x62855A44, 0x8BCA6A86, 0x72E693EA, 0x8B8A938A,
+0x498449C5, 0x498451C5, 0x51A459E5, 0x62066206, 0x61E559C4, 0x62256246, 0x72A751C3, 0x7AE851C4,
+0x62054962, 0x726672A7, 0x6A466A66, 0x6A466A66, 0x62466A67, 0x82C86205, 0x62047AE8, 0x83286A65,
+0x6A666A65, 0x82C78B49, 0x82C77245, 0x83087AE7, 0x728672A6, 0x8AC78B28, 0x7A8682A6, 0x7AA68B48,
+0x72257266, 0x8AC78286, 0x8A869B29, 0x92E88AC7, 0x92E89328, 0x82868AE7, 0x82A782A6, 0x9B699328,
+0x9B498AE8, 0x8AA67A65, 0x8AA6A348, 0x9B497A24, 0xB42B9B89, 0x9B88B42A, 0x8AE69B88, 0xB4EFB4AC,
+0x20E53144, 0x4A2E2949, 0x39CC296A, 0x190731CA, 0x08640885, 0x00020022, 0x31C90002, 0x31CC39EB,
+0x29692149, 0x31892127, 0x29482988, 0x106318E5, 0x10001062, 0x9B898349, 0x9368A3EA, 0x8B089B89,
+0xA3AAB40C, 0x8AC79348, 0x92E89B28, 0x92E77A45, 0x934882C6, 0x9B898B27, 0x83289389, 0x8B488348,
+0x7A6582E7, 0x9B497A45, 0x83479368, 0x8C4A8BE9, 0x83E9844A, 0x9C0A7B68, 0x7B4793C9, 0x5A847B88,
+0x7B686AE6, 0x73065A43, 0x9C2A83A8, 0x93A993E9, 0xA3EAAC2B, 0xA3EBA3EA, 0xA3CAAC2B, 0xB48CA40A,
+0xAC8C9C2A, 0xA40BB4CD, 0xBCEEA42B, 0xAC4BA46C, 0x8B06BCEE, 0xAC8B9BE9, 0x9C2AA46B, 0x9C0A9C2A,
+0xAC6BAC8B, 0x7B069C2A, 0x8BE98388, 0x8C09A4AC, 0xBD6F9CAB, 0xA4AC9C6B, 0x944A8C2A, 0x84288409,
+0x950B7407, 0x946A8C69, 0x9CCCA4EC, 0x8C6A8409, 0x73C773E7, 0x84088CCB, 0x9BE983A7, 0x82868B06,
+0x48C06162, 0x722461A2, 0xB3C98A85, 0x9C6B9BE9, 0x9C8B8C69, 0x38208B49, 0x8AA54040, 0xC5E69C24,
+0xC5C5DEA6, 0x8C097B84, 0x8C8A7C08, 0x63466B86, 0x7BC87C09, 0x73A85B05, 0x84498429, 0x84498C8A,
+0x7BE8842A, 0x84087BE8, 0x84088C49, 0x8C297BA7, 0x6B4673A7, 0x7BC873A8, 0x9CCC948B, 0x8C0A948B,
+0x8C2A7BE9, 0x8C4B8C6B, 0x73A96327, 0x63486388, 0x7BCA6348, 0x73877BE9, 0x7BA88C8B, 0x7BC96B66,
+0x9CAC8429, 0x840A840A, 0x6B68840A, 0x73A87387, 0x73A87BE9, 0x83E96B66, 0x73876B46, 0x8C2A8409,
+0x7B8783C8, 0x6B2562E4, 0x6B056B46, 0x73677367, 0x944B8C4A, 0x9C8CA4ED, 0x62A57B88, 0x522462A5,
+0x7B6A62C7, 0x6AE85A86, 0x73485A85, 0x5A8562E6, 0x6B075AA6, 0x7B6862E6, 0x6AA66285, 0x72E76286,
+0x49A551E6, 0x51A44984, 0x62065184, 0x51836A47, 0x6A6659C4, 0x62456246, 0x626659E4, 0x41426AA7,
+0x62665A04, 0x62056A26, 0x59E459C4, 0x622661E5, 0x498372A8, 0x7AC86A26, 0x62046205, 0x83487AC7,
+0x72E76A86, 0x72668328, 0x620482C8, 0x834872A6, 0x8B496A86, 0x82C77A86, 0x82E77A66, 0x72A6938A,
+0x82E86A45, 0x7A668AE8, 0x92E892E8, 0x72259B29, 0xA3AB8286, 0x8AC78AA7, 0x82A79B6A, 0x93497A86,
+0x934982A7, 0x8B07A3CB, 0x9308ABAA, 0x8AE79B28, 0x93689B89, 0xABE98B26, 0xC4CE8AC5, 0x730AA42D,
+0x18E718C4, 0x420D420D, 0x3A0C39ED, 0x31AA31AA, 0x31A939EB, 0x31882947, 0x29682947, 0x39EC4A6D,
+0x296A318B, 0x29682969, 0x18C52107, 0x084320E6, 0x31231042, 0x938993CC, 0x8307A3EA, 0x934882C6,
+0x9BAAA3AA, 0x9BCA8B08, 0x8AE79328, 0x83279BA9, 0x8B689BA9, 0x83478B27, 0x838872E6, 0x6AC68368,
+0x83279C0B, 0x83688328, 0x9CAB8368, 0x84498409, 0x5B258C8B, 0x942A9C8C, 0x8C4A8C0A, 0x8C6B6B67,
+0x738883E9, 0x6B0583C9, 0x83E88C09, 0x8B889409, 0xAC8C93A9, 0xA44BA42B, 0xA44BAC4B, 0x8BC9BD0D,
+0x9C6B8C0A, 0x9C4B7306, 0x9C6B940A, 0x8C0A9C8C, 0x7B47A48C, 0x9C8B9C8B, 0x8C4AAD0D, 0x6B4683C9,
+0x946A944A, 0x83E883C8, 0x8C6A83E9, 0x7C08A50C, 0x9CECA50D, 0x7BE88C4A, 0x84498409, 0x84898449,
+0x8CEA7C68, 0x844994EB, 0x94AB7C08, 0x7429848B, 0x7C087C29, 0x7BC78C4A, 0x59E18BC8, 0x59405100,
+0x48E069A3, 0x384040A0, 0x9AA581C2, 0xACABBC4B, 0x8C2994CB, 0x48A09B89, 0xA3C85901, 0xCE48A464,
+0x9CC3BDA4, 0xA52C9CA8, 0x7C699D0C, 0x848A8449, 0x8C8A9D0C, 0x8CAA94AB, 0x84898CA9, 0x8CCB7C28,
+0x7C69950C, 0x6BE78CAB, 0x8CAA8C8A, 0x8CCA8449, 0x94EB8449, 0x8CAA9D2D, 0x9D2C94EC, 0x7C088C8A,
+0x8449844A, 0x8CAB844A, 0x952D848B, 0x8CAC8CAC, 0x8CAB8C8B, 0x8CAA7C29, 0x6BC78C8A, 0x7C29846A,
+0x7C288C8A, 0x74088C8A, 0x846A7C08, 0x84497C29, 0x63458CAB, 0x7C287C29, 0x7BE873C8, 0x63468429,
+0x7BE8842A, 0x7C088429, 0x63667C09, 0x7BE97BE8, 0x7388842A, 0x840AAD2F, 0x62E67B89, 0x62E76B28,
+0x63085A66, 0x526562E8, 0x6B486307, 0x73A96307, 0x6B486327, 0x52855264, 0x62C662A6, 0x49E35245,
+0x51C551E5, 0x49A43943, 0x6A884163, 0x5A054984, 0x62455A05, 0x51C36AA6, 0x49E46286, 0x31216286,
+0x83495A65, 0x622551A3, 0x62256A66, 0x938B93CB, 0x51A44121, 0x8B297287, 0x83086204, 0x7B089BEB,
+0x72C75204, 0x82E86225, 0x72867286, 0x7B2872C7, 0x72C77B08, 0x934A8308, 0x724682C7, 0x6A6572A7,
+0x7AE849A3, 0x7AA76A45, 0x9B6A6A24, 0x82A77AA6, 0x930882E7, 0x82A78AE7, 0x72259349, 0x724682C7,
+0x830882C7, 0x62657B27, 0x72666A66, 0x82C79B8A, 0x6A658328, 0xABEA8307, 0x93497A63, 0x3987730A,
+0x214810A4, 0x420E4A8F, 0x3A0D31CC, 0x31A9422C, 0x21272948, 0x21262967, 0x19060863, 0x39CC4A6E,
+0x39EC422D, 0x31892149, 0x21072968, 0x18C42106, 0x62CA0841, 0x8B8972E8, 0x8B6993EA, 0xAC4C7AC6,
+0x93CA8B89, 0x8BC98BE9, 0x836772E5, 0x9C8BA4AC, 0x8C09A50D, 0x734683E9, 0x6B267BC8, 0x6B0683E9,
+0x8C2B4A22, 0x9CED83E9, 0x7C29848A, 0x846A7C08, 0x7C49848A, 0x7C097408, 0x74097429, 0x94EC846A,
+0x73C87C29, 0x73A752C4, 0x7C087C08, 0x7B876305, 0x5A8383C8, 0x944A83E8, 0x83C89CAB, 0x73C873A7,
+0x73A87BE9, 0x5AE56326, 0x9D0C7C09, 0x73C75304, 0x7C095B25, 0x6BA76386, 0x84AB63A7, 0x5B057C4A,
+0x7BE76B66, 0x8CAA8CAA, 0x7C696BE7, 0x8CCB6BC7, 0xA56D6BC7, 0x7C286385, 0x7C896385, 0x8D0B84AA,
+0x84898CAA, 0x952C7428, 0x9D2C63A6, 0x6BA78CCB, 0x7BA86346, 0x59817AE7, 0x51C159C1, 0x9C6A8BC8,
+0x9C8B83E8, 0x93C88C4A, 0x796092A4, 0xB307A223, 0x83E99C6A, 0x508071E4, 0xA48938C0, 0xCE089C84,
+0x8C42D669, 0x94EB8446, 0x7C6984AA, 0x7C487428, 0x94EB8CCA, 0x84698CAA, 0x950B8468, 0x846A7429,
+0x8CEA84CA, 0x8CAA84AA, 0x8CCA8CCA, 0x8CAA8CEA, 0x950B8CEA, 0x8CAA8CEA, 0x950C8CEB, 0x7C087408,
+0x7C2973E8, 0x7C4984AA, 0x7C696BE6, 0x7C8A84CA, 0x74276BE7, 0x84897C68, 0x742863A5, 0x73E7848A,
+0x952B7C68, 0x848984A9, 0x7C696C07, 0x7C697407, 0x740884CA, 0x73C75B65, 0x7C286BC7, 0x5B456BA7,
+0x6BC87C4A, 0x6BE97409, 0x5B467C4A, 0x63876387, 0x6BA863A7, 0x63266BA8, 0x73C95AE5, 0x52857BEA,
+0x5AC55AE6, 0x6B474A64, 0x7BE9844A, 0x73C87C09, 0x5B066387, 0x52E66367, 0x8C6C6347, 0x840B73A9,
+0x30E27B4B, 0x49A55A06, 0x49C449A4, 0x5A056226, 0x62865A05, 0x5A657308, 0x5AA66AE8, 0x52665AA6,
+0x73286286, 0x5A046A86, 0x62455A04, 0x5A04834A, 0x6AA75A05, 0x62256A26, 0x51C37AE8, 0x7B299C0C,
+0x6AC76265, 0x72A67AE8, 0x6A866225, 0x73088349, 0x51E39C4D, 0x72A782E8, 0x9BEC7266, 0x52045A05,
+0x6A866245, 0x7AE77AA7, 0x93697AA7, 0x7A8682C7, 0x72658B08, 0x93497A66, 0x8B088B29, 0x726682C7,
+0x83497AC7, 0x73487307, 0x93AB2880, 0x83078308, 0x6265838A, 0x7AE77B08, 0xA44D7284, 0x21066AEC,
+0x426D1085, 0x3A0E4A6F, 0x2149422E, 0x00230885, 0x00010002, 0x00020822, 0x29890002, 0x3A0D4A4E,
+0x424D39EC, 0x18E7422C, 0x31C92969, 0x21463188, 0x39C518C3, 0x9C4C6AC8, 0x73078BEB, 0xAC8C8348,
+0x8BE993EA, 0x84099C6C, 0x84097B87, 0xAD8F8409, 0xA54E7C09, 0x73C894CC, 0x73E87BE8, 0x8C8B6B87,
+0x6B673180, 0x73E86366, 0x4AE484AB, 0x740873E8, 0x7C8A7408, 0x6C086BE8, 0x63C863C8, 0x52E46BC8,
+0x8CCC7C4A, 0x844A52E5, 0x7C497C29, 0x7C087C09, 0x73E87BE8, 0x74088C8B, 0x53046346, 0x53045304,
+0x53054263, 0x426294CC, 0x63A652E4, 0x74495304, 0x4AC48CCC, 0x74295B26, 0xA5AF84AB, 0x6BA65B25,
+0x73E76366, 0x63C68469, 0x7CAA7C69, 0x746963A6, 0x8CEB7409, 0x74276BE7, 0x6C077C48, 0x74488CEB,
+0x94EB6BC7, 0x6BE76C08, 0x74086BC7, 0x7BE99CEC, 0x49C27368, 0x40A048C0, 0x73067AE7, 0xAD6D8C29,
+0x84689D2C, 0x62C194A9, 0xC3C9AC29, 0xB224B9E4, 0x940AA3C9, 0x40606963, 0xACEA51C1, 0xACE49423,
+0x7381B566, 0x8CAB6343, 0x6BE78C8B, 0x848A8469, 0x9D4C8469, 0x8CCA848A, 0x8CCA9D6D, 0x6BE87C29,
+0x952B952B, 0x8CCA950B, 0x74287C69, 0x8CEA8CEB, 0x8CCA8CEA, 0x7C69A5CE, 0x84698CCA, 0x73E873C7,
+0x7C498CAB, 0x7C6973E7, 0x7C897C48, 0x7C897C89, 0x74687C69, 0x7427954C, 0x7C897C68, 0x74077C29,
+0x952B84A9, 0x74488CEA, 0x9D6C84AA, 0x7C697428, 0x84EA8CEB, 0x848A9D4D, 0x74487C48, 0x7C4973E8,
+0x32016367, 0x53466BC8, 0x8CEC63A8, 0x5B865B87, 0x6BE95326, 0x42A363A7, 0x74096BC8, 0x73E96BA8,
+0x6B875B26, 0x74095B25, 0x6BA76BA7, 0x638773E9, 0x532563A7, 0x63675B26, 0x52E64A85, 0x6B896368,
+0x62A85206, 0x6AE93943, 0x72E94163, 0x41A349C4, 0x62A75A66, 0x6B285244, 0x62C75265, 0x4A456307,
+0x944D3982, 0x8BEC5224, 0x62A749E3, 0x940C6AC7, 0x41A349C3, 0x622672E8, 0x5A455A05, 0x41A2838A,
+0x5A456AE7, 0x9C0C6AA6, 0x6A868349, 0x93EC7B29, 0x6A866AC7, 0x72A76AA7, 0x72A772A7, 0x62455A45,
+0x6A8649C3, 0x8B697B28, 0x8B4872C7, 0x7AA67286, 0x62038B28, 0x8B496A65, 0x9BAB7AE7, 0x9BCB7AA7,
+0x7B078B69, 0x8BA972E6, 0x93AB6266, 0x732872E7, 0x62E75244, 0x52446B07, 0x738B6307, 0x21282967,
+0x4A6E1907, 0x422E3A2E, 0x18E71929, 0x21261927, 0x106318E4, 0x00020021, 0x422C0002, 0x420E52AF,
+0x39EC39EC, 0x426C31EB, 0x08842147, 0x298710E4, 0x39E710C3, 0x41E36B29, 0x63075285, 0x8BEA7327,
+0x6B2783E9, 0x5AC58C6B, 0x73C9840A, 0x5B266387, 0x6BA87C2A, 0x6B875305, 0x950C6BA7, 0x7C2952E4,
+0x5B065B26, 0x6BA773C8, 0x5B468CEC, 0x4A836387, 0x5B256BA7, 0x5326744A, 0x32014AE5, 0x7BE97BE9,
+0x5B266387, 0x52E4844A, 0x6BA74AA3, 0x6B8752E4, 0x7C2973C7, 0x4AC36BC7, 0x74496BC7, 0x84AB7449,
+0x4AC463A7, 0x952D6BE8, 0x74496C08, 0x63C77CAA, 0x7C6B63C8, 0x63674AC4, 0x846A73E8, 0x5B058C8B,
+0x74285B25, 0x84CA6BE7, 0x63C6B670, 0x53456C28, 0x7C6A7449, 0x74287C89, 0x84AA7448, 0x63A77469,
+0x52E56387, 0x63C76BC8, 0x6BA784CB, 0x7B48946B, 0x38A04120, 0x93EA51A2, 0x9CCD6B06, 0x8C6B7BE9,
+0x84478C69, 0xEF4FF7B0, 0x9B678C06, 0xA9A3C2A7, 0xCCCE9AE6, 0x38204880, 0x9C896AA5, 0x9C43A465,
+0xA5097BA2, 0x842A8C49, 0x7C09844A, 0x9D2C84A9, 0x8CCA94EB, 0x7C487C69, 0x848A6386, 0x8CA98489,
+0x9D4B950A, 0x8CCA8CEA, 0x848A950B, 0x952B7C68, 0xA5CD7C88, 0x63657C48, 0x6B876BA6, 0x7BE86346,
+0x7C496BA7, 0x7C487408, 0x950B6BA6, 0x6BC76386, 0x74076BC7, 0x74077C48, 0x74077C68, 0x84AA8CCA,
+0x84AA8CEB, 0x84AA84AA, 0x950C8CEB, 0x8CCB6C07, 0x7C695B85, 0x8CCB6386, 0x5B45952C, 0x6BC86386,
+0x3A225B46, 0x63875B66, 0x6BE842C4, 0x63A763C7, 0x63C75BA7, 0x6C084B44, 0x744A7C8A, 0x63C763C7,
+0x74496BE8, 0x8CEB4B03, 0x74494AE3, 0x53467CAB, 0x53455325, 0x5B675B67, 0x52C652E6, 0x63885B48,
+0x41A45226, 0x41C45A47, 0x49C45A26, 0x4A0449C4, 0x5A865245, 0x39C27BAA, 0x52866B08, 0x4204840C,
+0x7BEB41E4, 0x62C65AA6, 0x62C662C7, 0x7B8A7349, 0x41A341C3, 0x62666AA7, 0x62C76287, 0x62E78C0C,
+0x62867329, 0x838A6266, 0x5A047AE8, 0x5A455204, 0x940C6266, 0x62466AA7, 0x73088B8B, 0x52245A45,
+0x6AC7940C, 0x62A55A65, 0x72C77B28, 0x8B487286, 0x8B698B49, 0x7B487B07, 0x72C76224, 0x93CB8309,
+0x7B6893EB, 0x8BCA7B28, 0x5A859C4D, 0x73895244, 0x9CAE7349, 0x29619CAE, 0x5B0B6329, 0x19082988,
+0x424D2949, 0x29AB424E, 0x29AA296A, 0x212631A9, 0x18E420E5, 0x18E520E5, 0x4A6D0003, 0x422E5AD1,
+0x31AA3A0D, 0x19072169, 0x08640864, 0x10A331A8, 0x08810862, 0x528583EC, 0x63485AC7, 0x8C2AAD2F,
+0x84097388, 0x73C96306, 0x4AA48C8C, 0x52E67C0A, 0x74094A84, 0x53057C2A, 0x7C6A73E8, 0x63666BC8,
+0x7C0A94CD, 0x52C44263, 0x7C4A6BA8, 0x52E56BA8, 0x636673C8, 0x6BE96BA8, 0x4A847C2A, 0x73A86B47,
+0x63875B06, 0x5B05B611, 0x42424A63, 0x5B0552C5, 0x63878429, 0x63A66BA7, 0x4AE46BE8, 0x53456C08,
+0x84AB7429, 0x53256BA7, 0x63E76BE8, 0x74497C8A, 0x636784AC, 0x6BA88C8C, 0x844A7C09, 0x9D0D8429,
+0x952D6B87, 0x6C078CEB, 0x8D0C7C69, 0x7C8A7449, 0x42A35B46, 0x7C69848A, 0x84AA8CCB, 0x63A78CAB,
+0x4A844A84, 0x7BA85AC5, 0x83A88409, 0x61C3938A, 0x726648C0, 0x73876AA5, 0x6B48840B, 0x7BC97389,
+0xDE9083E8, 0xE6EEE68D, 0x82E5B58C, 0xB205BA86, 0xAB89C3AA, 0x30204860, 0x8C07940A, 0xAC86B4E8,
+0x9CA87321, 0x9D0D94AB, 0x8C8B840A, 0x8469A54D, 0x84498449, 0x7C49846A, 0xB6104A83, 0x846894CB,
+0x9D4CA54C, 0x8CCA8C8A, 0x7C49A58E, 0x84A97428, 0x8CCA63A6, 0x73E76BE7, 0x8C8B844A, 0x6B877C09,
+0x74087C09, 0x6BA6846A, 0x73E77C08, 0x6BC78469, 0x73E78449, 0x8CEB8C8A, 0x84899D2C, 0x7C6A7C49,
+0x74288CCB, 0x7C49952C, 0x950C7C49, 0x74288CEB, 0x63A66BE7, 0x7408846A, 0x6BC68CAA, 0x74088469,
+0x73E8846A, 0x848A84AB, 0x6BE85B66, 0x742863C7, 0x42C37449, 0x63E763C7, 0x63A7952D, 0x63C75345,
+0x7449744A, 0x74496C28, 0x4B045B66, 0x53254AE4, 0x63A76BE8, 0x32025346, 0x4AA552E6, 0x3A436BCA,
+0x52873162, 0x41C439A3, 0x5A8741C4, 0x62E84A04, 0x62E75AC6, 0x4A4462E7, 0x52864203, 0x6B4939C3,
+0x5B0829A2, 0x4A455B07, 0x7BCA6B48, 0x52656B48, 0x4A244224, 0x5AA65A86, 0x4A244A24, 0x73696B48,
+0x7B8A5265, 0x6AA762C7, 0x5204944D, 0x52455225, 0x52245AA6, 0x41A2A4AE, 0x73486AE7, 0x73486B07,
+0x734883AA, 0x62C66B28, 0x73076B07, 0xA48D6AA6, 0x7307A46C, 0x7B699C6D, 0x312041C2, 0x8BAB5A04,
+0x6B075265, 0x52C64A23, 0x52E67C0A, 0x42045307, 0x8C2C6307, 0x29423182, 0x298752CA, 0x296A31A9,
+0x424D2149, 0x298A3A0C, 0x298929AA, 0x21472127, 0x31672126, 0x10832125, 0x5AEF0002, 0x31CC4AAF,
+0x21281908, 0x18E71907, 0x31890885, 0x10842927, 0x00201082, 0xA52F8C6D, 0x73CA842B, 0x41C36B48,
+0x4A646327, 0x9D0E6327, 0x6B886327, 0x6327844B, 0x94ED73C9, 0x846B742A, 0x6BC95305, 0x52E542A3,
+0x31C16BE9, 0x5B065305, 0x53065B46, 0x42A47C8B, 0x52C452E5, 0x52A5846B, 0x63674AC5, 0x74096387,
+0x6BA76366, 0x5B267C4A, 0x7BE97C2A, 0x844A6326, 0x4AA352E4, 0x7C497408, 0x74295B45, 0x94EC63A7,
+0x7C4A5304, 0xA56E8CAB, 0x848A6BC7, 0x740863A6, 0x7C4A63A7, 0x426373E8, 0x6367848B, 0x8C8B5B45,
+0x74096387, 0x950C6BE8, 0x74096BE8, 0x7C497429, 0x7C6A7409, 0x74086BE7, 0x848A6BC7, 0x7BE9848B,
+0x73276B67, 0x82C76A65, 0x8AA6A3EA, 0x68A160A0, 0x8B087A05, 0x9CAC6AE6, 0x4A236B68, 0x5AC56B28,
+0xA48ACE11, 0x83647302, 0x9B887B25, 0xBAC7AAC6, 0x71E49AC7, 0x40A050E1, 0x9CCA83C9, 0x62A09CA8,
+0x83E55A40, 0xAD8E7BC6, 0x8CAA8C8A, 0x94CA950B, 0x9CED94AB, 0x73C794EC, 0x94EC5B25, 0x8CAA8CCA,
+0x950B5324, 0x6366846A, 0x73A78449, 0x8469950B, 0x8C8A8489, 0x73C78CAA, 0x8CAB950C, 0x8C8A950C,
+0x848B5326, 0x73C76366, 0x7C288CAA, 0x7C088CAA, 0x848A73E7, 0x84697C48, 0x6BC784AA, 0x8CAB6BC7,
+0x94EB7C49, 0x7C2873E7, 0x94CA5B44, 0x8C8A8469, 0x8CAA6BC6, 0x73E66BC6, 0x8468952B, 0x7C698488,
+0x74495345, 0x63A68D0B, 0x84AB63A6, 0x84CAA5AD, 0x4B045345, 0x74287C69, 0x6BC85304, 0x6BE85304,
+0x746A63A7, 0x63C76C08, 0x534663C8, 0x6BC84B05, 0x63A84AE4, 0x5B674B05, 0x53474AE5, 0x4AE542A5,
+0x42254205, 0x4A2562E9, 0x52864A25, 0x4A456B29, 0x73896307, 0x5AA67BAA, 0x29616307, 0x52C66B28,
+0x3A2431C3, 0x18E04204, 0x73CA7BEB, 0x4A656B69, 0x6B695286, 0x6B285245, 0x424539A3, 0x29826B8A,
+0x73695AC7, 0x83CB6AE8, 0x524583CB, 0x62E76B08, 0x7BEA7B89, 0x73695265, 0x83EA6307, 0x8C4C7369,
+0x52656B48, 0x7BCA5A86, 0x52447B8A, 0x6B075224, 0x6B275A85, 0x62C67B89, 0x7B8A7349, 0x7BAAA4AF,
+0x5B0783EC, 0x194031C3, 0x5B6742C5, 0x4244846C, 0x42043161, 0x18C118A0, 0x3189422A, 0x31AA31CB,
+0x31AA31AA, 0x39EB39CB, 0x296831AA, 0x296831A9, 0x08632106, 0x00220822, 0x5B0F0843, 0x31AB422D,
+0x31AA422C, 0x29682989, 0x39AA4A4C, 0x08431044, 0x08600862, 0x6B486B49, 0x6BA952C6, 0x7BAA5AA7,
+0x31E23181, 0x52A57BCA, 0x42649D0E, 0x426429A1, 0x638894CD, 0x740A6388, 0x6BC9C673, 0x4AC44AA4,
+0x6BE96388, 0x4AC45B26, 0x84AC4283, 0x5B674B06, 0x52C54A84, 0x5B066347, 0x3A635306, 0x5B665306,
+0x8CCB5305, 0x52C473E9, 0x5B066306, 0x6BA87C0A, 0x7C49844A, 0x63457C29, 0x6BC76366, 0x4AA45B25,
+0x73E873E8, 0x94CB94AB, 0x6BC75B05, 0x7C4A6BC7, 0x950C846A, 0x8CAB846A, 0x7C6A42A3, 0x9D4E8CAC,
+0x8CEC950D, 0x5B466387, 0x846A73E8, 0x5B257C29, 0x5B4673E8, 0x7C495B46, 0x7C295305, 0x73C97BE9,
+0x62A57BC9, 0x82669349, 0xA308FE13, 0xECD1CB8C, 0x6A85A329, 0x6B67942B, 0x7BC9A4ED, 0x4A236B48,
+0x83667B67, 0x93E993C8, 0x82E672C5, 0x9A65A307, 0x40A09B09, 0x49417A46, 0x8428946B, 0x6B0183C5,
+0x9CA883A4, 0x63458C69, 0x7C288429, 0x63458449, 0xA50E6B47, 0x73C794AB, 0x8CAB8C6A, 0x7C499D0C,
+0x5B258CCB, 0x8C8B7C09, 0x7C0852C4, 0x8C8994CB, 0x7C28A54C, 0x6BA7844A, 0x8CAB8CAB, 0x7C29844A,
+0x7C0A73E9, 0x63667BE9, 0x94CB8CAB, 0x63665B25, 0x8469848A, 0x8CCA8469, 0x952C7C28, 0x9D4D94EC,
+0x6BA6846A, 0x94CA6BA6, 0x73E66BA6, 0x73E773C7, 0x8CCA8469, 0x94EA8469, 0x84889D2B, 0x74278CA9,
+0x8D2B6BC6, 0x63A68CEB, 0x9D4D5325, 0x63858CAA, 0x6BC77408, 0x7C497408, 0x5B456BC8, 0x53256BA7,
+0x4AC47C4A, 0x5B467C4A, 0x73E95B46, 0x7C2A4AC4, 0x53266367, 0x7C6B742A, 0x42C442A4, 0x53464B06,
+0x41E44A46, 0x4A664A45, 0x4A664A45, 0x63284204, 0x842B6307, 0x632752C6, 0x5AC66B28, 0x73895265,
+0x42453A24, 0x7BCB39E3, 0x52A64A44, 0x52A66B48, 0x5AC74244, 0x4A664A65, 0x6B8A3A04, 0x5B084AA6,
+0x528639E3, 0x5AC752A6, 0x632852A6, 0x52A66B69, 0x840B4224, 0x426452E6, 0x3A23B5F1, 0x73CA52E5,
+0x52666B69, 0x7BCB39C3, 0x83EB7369, 0x9CCE52A5, 0x63486348, 0x7BCB5286, 0x39A32961, 0x52A731A3,
+0x4A2552A6, 0x530731E3, 0x4AE642A4, 0x4A854284, 0x39E34244, 0x21454226, 0x31CB3A0A, 0x29AA29AA,
+0x318A298A, 0x31AA2949, 0x31892989, 0x00222107, 0x08420001, 0x00010000, 0x52CF0843, 0x3A2D3A0D,
+0x2969298A, 0x422B31EA, 0x084318C5, 0x10630843, 0x18C20021, 0x42646B8A, 0x52C64AA5, 0x422473CA,
+0x73CA31C2, 0x52A55B07, 0x4AA45B67, 0x7C6A952D, 0x63875B46, 0x74097429, 0x63476387, 0x6BA86BA8,
+0x8CED3A63, 0x5304A58E, 0x63874AC4, 0x63A85B87, 0x844A52E5, 0x74296387, 0x42637409, 0x73E83201,
+0x9D2D5304, 0x42634AE4, 0xA54F5B06, 0x846B6347, 0x5B0484AB, 0x84696365, 0x5B464AE4, 0x6BA86366,
+0x7C49848A, 0x8CAB7C49, 0x7C295B05, 0x73E86BC7, 0x7BE86BA7, 0xB6315B45, 0x6BE84AE4, 0x8CAC8CED,
+0x6388848B, 0x6BA84AA4, 0x5B268C8B, 0x8CCB5B25, 0x5B467C6A, 0x53255B46, 0x5AE55B26, 0x8CAC6367,
+0x6B477C29, 0x82C672A6, 0xE54F9B47, 0xFEF8FE35, 0x8389C50F, 0x73685264, 0x7BA87BC9, 0x6B467BC8,
+0x8C097B87, 0x9C8D7BA9, 0x6AA7944D, 0x9B68B48D, 0x6A25ABEC, 0x72E77AC7, 0x73659CCC, 0xB50883C4,
+0x8C46ACE7, 0x8C6A8C68, 0x842AAD6F, 0x844A5304, 0xAD2E948B, 0x73E79D0C, 0x84496365, 0x73C85304,
+0x6B876387, 0x73E87C49, 0x73E87C49, 0x8CAA94EB, 0x73E88CAA, 0x6B88844A, 0x5B0673E9, 0x8C8B94CC,
+0x5B055AE5, 0x6B666346, 0x8C8A73C8, 0x4A6373C8, 0x63468CAB, 0x5B045B25, 0x8CAA8449, 0x73C77C08,
+0x6BA67C28, 0x8CCA8CAA, 0x84696BC6, 0x7C2873E7, 0x950C8469, 0x94EB7C28, 0x7407A58D, 0x6BA66BC6,
+0x7C284AC3, 0x6BC784AA, 0x7C297C28, 0x74076365, 0x5B256366, 0x6BC76BE7, 0x63865B66, 0x74085325,
+0x53055B45, 0x638731E1, 0x4AA45B26, 0x6BC852E4, 0x63684AA4, 0x42844AE5, 0x4AE54AE4, 0x63A85326,
+0x41E45266, 0x39E452A7, 0x5B074A65, 0x4A455AE7, 0x5AC68C4C, 0x42036307, 0x6B4962E7, 0x31825AE7,
+0x21414A45, 0x52A6948E, 0x73AA4203, 0x3A035285, 0x4244842C, 0x4A456329, 0x52C86B6A, 0x29822101,
+0x6B696B6A, 0x296231A3, 0x42446308, 0x3A036328, 0x6B686B89, 0x5B2739E2, 0x7C4C6B89, 0x42246BA9,
+0x31A37BEC, 0x31A33162, 0x5AC65245, 0x4A6473A9, 0x5B084A65, 0x424552C7, 0x31A339E4, 0x42452962,
+0x7BCB5245, 0x63A93A04, 0x42A56BCA, 0x3A0252A5, 0x6BAA4264, 0x3A284247, 0x31AB39EB, 0x298931AA,
+0x2949318A, 0x18C62128, 0x084418E7, 0x08420823, 0x08210842, 0x00010841, 0x4A6D52AD, 0x31AC422D,
+0x422C39EC, 0x006331A9, 0x08420863, 0x08221084, 0x10C20843, 0x7C0A4A65, 0x63885B27, 0x52C67C0B,
+0x73C97BEB, 0x4A846B48, 0x6BE8950E, 0x63863A42, 0x6BE87C6A, 0x5B874283, 0x42636347, 0x3A0273C9,
+0x7C4A4AC5, 0x6366848B, 0x42836B87, 0x742963A8, 0x5B256BA7, 0x6BC85B26, 0x42436388, 0x53046B67,
+0x5B457C49, 0x6BC88CEC, 0x6B884243, 0x6BA84AA5, 0x6BC873C9, 0x950B8CAB, 0x63667C28, 0x63666366,
+0x73E77C28, 0x8CAB94EC, 0x52C47C09, 0x7C2A94ED, 0x636773A8, 0x846A846B, 0x4AC552E5, 0x5B47740A,
+0x4AC56388, 0x7BEA52A5, 0x5B056B47, 0x7C297C09, 0x638773E8, 0x74093A22, 0x52C59D2E, 0x6B884A84,
+0x844A6BC8, 0x8B887327, 0xC50D93A8, 0x9C2C6A85, 0x8C0A940B, 0x6B4783A9, 0x73877BA8, 0x8C4A946B,
+0x5AA46B67, 0x948E5AA6, 0x5A86A510, 0x83689C2C, 0x7B288328, 0x7BA8942B, 0x7BC6948A, 0x7B628BC4,
+0x94A783E4, 0x94CB8407, 0xAD6F73A8, 0x94CC73C8, 0x6B88946C, 0x846A7C09, 0x8CAB6366, 0x6B878CAB,
+0x94EC7C2A, 0x7C496346, 0x8CAA846A, 0x9D2C94EB, 0x7408846A, 0x5B0694CD, 0x42436BA9, 0x94AC94CD,
+0x7BE96B47, 0x8C8B6B46, 0x5B257C09, 0x52E47C29, 0x52E58C8B, 0x73C86B67, 0x73C78CAB, 0x84498408,
+0x6BA68449, 0x63656386, 0x94EB94CB, 0x73E79D0C, 0x8CCA8449, 0x8CCA73E7, 0x952C9D4D, 0x94EB7C07,
+0x7C2873E8, 0x6BC77C08, 0x7C496B87, 0x63866BA6, 0x6BC76B87, 0x6BE894EC, 0x4AE48CEC, 0x8CCB7429,
+0x84AB6BC8, 0x4AA48CCC, 0x5B2652E5, 0x63466326, 0x63686368, 0x53266BA8, 0x32014AC4, 0x53464AC5,
+0x4A255266, 0x5AC74225, 0x420452A6, 0x4A454A45, 0x63085AC7, 0x5AC74A44, 0x630852A6, 0x6B8A3A04,
+0x42254224, 0x63088C4D, 0x5AE74A85, 0x5B0773CA, 0x3A2552C6, 0x210131A3, 0x52883183, 0x62E918E1,
+0x5B0931A4, 0x31C46329, 0x73AB2982, 0x422452E7, 0x3A0294EE, 0x4A654244, 0x19016B6A, 0x52A831A3,
+0x7C0C31A3, 0x52A76349, 0x212131A3, 0x6B694A64, 0x63296328, 0x18E052A6, 0x4A654264, 0x8C6E4265,
+0x73CABE13, 0x428431C2, 0x42656BA9, 0x63674AA5, 0x29821100, 0x31E91944, 0x298A31EA, 0x318A2969,
+0x29682968, 0x21272147, 0x108410C4, 0x08620862, 0x08620021, 0x08420020, 0x4A6D5B0E, 0x3A0C39EC,
+0x296939EB, 0x10A51084, 0x08430863, 0x18C50843, 0x086110A4, 0x6367740B, 0x9D4E63A7, 0x7C2B7C2A,
+0x52C55B06, 0x846B6347, 0x7C4A6BA7, 0x6BA84243, 0x7C4A73E9, 0x31E14283, 0x5B265B25, 0x8C8C4AA4,
+0x63673A22, 0x7C6A8CCB, 0x42837408, 0x7C6A5B66, 0x4AC35B66, 0x73C95305, 0x4AA55B47, 0x8CAB5B05,
+0x73C86346, 0x5B258CAB, 0x73C84AA3, 0x6B6852C5, 0x63474AC5, 0x74078449, 0x846A6BC7, 0x6B867C49,
+0x63868489, 0x844A6386, 0x6B8852E5, 0x6BA84A84, 0x73C87409, 0x4A845B26, 0x426452E6, 0x4243848C,
+0x52C53A22, 0x846B8CAC, 0x7BE952E4, 0x5B0673C8, 0x3A425B26, 0x31C06366, 0x5B267C29, 0xA54F3A22,
+0x8C8B6BC8, 0x73676305, 0xAD0E62E5, 0x948C4A22, 0x946B83E9, 0x8C6A83E9, 0x8C6A94AB, 0xA4ED8C4A,
+0x7BE973C8, 0x9D0E94CD, 0x9CCD7BEA, 0xA4AC946B, 0x5AC4946B, 0x9D0C7BE8, 0x63448469, 0xA52A73C5,
+0x73C652E1, 0x84497C48, 0x8C8A7C29, 0x6BC76BC7, 0x5B2752C5, 0x7C2A8C8B, 0x8C8B6367, 0x7C497C29,
+0x846A7C49, 0x53055305, 0x7C496386, 0x7C2A6BA7, 0x7C097408, 0x52C59D0D, 0x5B066BA8, 0x4AA46347,
+0x4A845B26, 0x63676367, 0x63667C29, 0x6366ADAF, 0x636752E4, 0x52C54A84, 0x632673E9, 0x6B868429,
+0x73E86B86, 0x7BE852E4, 0x84498469, 0x73E794CB, 0x8CCB7408, 0xA58E5B65, 0x950A6BE6, 0x8469952B,
+0x4AC373E7, 0x6BE7848A, 0x6BC773E7, 0x6BE86BC7, 0x6BA76BC7, 0x7C497C49, 0x6346846A, 0x6BA77C69,
+0x8CCB6366, 0x63474AC4, 0x6367846A, 0x5B275B26, 0x52C65B27, 0x63884AA5, 0x52E54AE5, 0x636731E1,
+0x29415266, 0x42044A25, 0x6308738A, 0x39C339C3, 0x52865286, 0x31824A25, 0x42254A25, 0x52C77C2C,
+0x6B494A45, 0x52A65AA7, 0x31C33A04, 0x5B0852C7, 0x73CA2962, 0x31A32962, 0x29222101, 0x39C520C2,
+0x19013184, 0x42254A66, 0x52C74225, 0x52E72962, 0x63486348, 0x4A664A86, 0x52882122, 0x39A45288,
+0x42255267, 0x4A45840C, 0x4A256309, 0x5AE673A9, 0x63085AC7, 0x4A854205, 0x4A6452C6, 0x63486B69,
+0x3A23842C, 0x52E63A23, 0x31E34AA6, 0x6B883A03, 0x0060848C, 0x3A2A2145, 0x29692989, 0x31893149,
+0x21473169, 0x21062927, 0x086218C4, 0x08421062, 0x00410842, 0x4AAA0020, 0x422B632E, 0x31AB420C,
+0x21073169, 0x29673168, 0x31A82947, 0x29464A4B, 0x21242106, 0x5B46D6F6, 0x7C4A5305, 0x530594ED,
+0x7C4A848B, 0x7C2A6346, 0xBE1173A8, 0x7C2B5B27, 0x950D846B, 0x3A22844B, 0x846B73C9, 0x5B27844B,
+0x740A6368, 0x950C5B46, 0x52E56B87, 0x42C45B46, 0x7C4A5305, 0x52C57C09, 0x53066B89, 0x52C56B88,
+0x73E873E9, 0x846A7C49, 0x6BC76366, 0x5B2773A8, 0x52E552C6, 0x73C752C4, 0x6BC78CAA, 0x84697C49,
+0x9D4D9D4D, 0x7C4A9D0D, 0x42636BA8, 0x4AA46BA9, 0x6BC85B26, 0x6BA84AA4, 0x3A0373CA, 0x426394CD,
+0x740A73C9, 0x4AA46B67, 0x8449844A, 0x73E96B87, 0x6B878CAC, 0x8C8B73E9, 0x6B87B5CF, 0xBE126327,
+0x6BA76367, 0x52A48C4A, 0x73C87388, 0x6BA79D2E, 0x8409A50D, 0xA52D948B, 0xAD6EBDD0, 0x946BA4ED,
+0x5B0673C8, 0x8C6B5B06, 0xA54E8C6B, 0xAD4EAD4E, 0x8C6A7BE8, 0x8CAA8428, 0x84899D0B, 0x7C289D2B,
+0x84896BC6, 0x7C08A58E, 0xADCE848A, 0x8CAA950B, 0x7C2B846B, 0x6BC86B88, 0x4A8473A9, 0x94EC6B87,
+0x84AB846A, 0x3A217C29, 0x846A848B, 0x5B066327, 0xA54E7C09, 0x632673C9, 0x4A646B68, 0x73C994AD,
+0x5B2652E5, 0x4AA45AE5, 0x5B4673E9, 0x5B4673E8, 0x4AA473E9, 0x73C95B27, 0x5AE55AE5, 0x5AE48C4A,
+0x5AE47C09, 0x8C6A6B87, 0x84497C08, 0x84298C8A, 0x848A846A, 0x84898449, 0x53237C48, 0x7C48ADCD,
+0x7C29950C, 0x5B458CAB, 0x63A67C49, 0x94EC73E8, 0x6BE8846A, 0x6BC7846A, 0x84698449, 0x7C2994EC,
+0x6BC88C8B, 0x846B844A, 0x63477C0A, 0x42646BA8, 0x42646B88, 0x42844AA5, 0x4AC56B89, 0x42837C2A,
+0x42044A45, 0x31A34A66, 0x4A866B69, 0x39E44244, 0x5AE831A2, 0x39A339C3, 0x8C8E31C3, 0x42243A24,
+0x62E752A6, 0x4A662941, 0x31A32982, 0x39E34266, 0x52C71900, 0x31A331C2, 0x5AA84A66, 0x10812102,
+0x42052122, 0x6B6952C7, 0x21428C6D, 0x29835B09, 0x52863A25, 0x294152E7, 0x316339E4, 0x52873183,
+0x31835AC8, 0x5AE73182, 0x42242962, 0x5AE66347, 0x5AE84A65, 0x31C34225, 0x5AE63A23, 0x29822161,
+0x4224842C, 0x4AA51920, 0x5B486BAA, 0x31C24AA5, 0x42666389, 0x31EA4249, 0x214829A9, 0x318A2949,
+0x21272948, 0x21262106, 0x108318C4, 0x08410842, 0x00200841, 0x5B0A08A0, 0x29896BAF, 0x318B296A,
+0x20E72108, 0x210618C5, 0x31882967, 0x108418C4, 0x18E410A4, 0x29C03203, 0x952DA5AF, 0x6BE884CB,
+0x94EC73E8, 0x73E96BA7, 0x9CED29A0, 0x52E66B89, 0xA56F5B27, 0x4A84A58F, 0x9D2F5B47, 0x2962846D,
+0x638873EB, 0x84AC63A7, 0x8CAC6387, 0x6BE95B46, 0x7C2A63A8, 0x8C8C31C1, 0x5AE74AA5, 0x842A52C5,
+0x844A7C09, 0x8C8A6BA7, 0x7C0873E7, 0x844A73E8, 0x7C2973C8, 0x844952E4, 0x84498C8A, 0x7C497C29,
+0x52C494EC, 0x7C0A846B, 0x63674A84, 0x636673C8, 0x52C45B26, 0x63674263, 0x6B8852E6, 0x7C496386,
+0x5B056BC7, 0x5AE452C4, 0x8428A56D, 0x73C87C29, 0x94EC9D0C, 0xCE936387, 0x63479D0D, 0xA5509D0F,
+0x7C29ADB0, 0x842994EC, 0x7C296345, 0x94AB6B86, 0x84298429, 0xB58F7BC8, 0xB58F9CEC, 0xA50DAD6E,
+0x7C0973C8, 0x94CC73A8, 0x9CED844A, 0xA52DC651, 0x7BE8B58F, 0xADAE6366, 0x94CB9D0B, 0x7C287C48,
+0x73E86BC7, 0x846994EB, 0x94EB94EB, 0x7C288489, 0x7C2A6387, 0x73C93A22, 0x5B084245, 0x94CC6BA9,
+0x63678C8B, 0x42427C2A, 0xC63352C4, 0x4244B5D1, 0x6B6752A4, 0x9CEE5B26, 0x6B895B07, 0x4243ADB1,
+0x6326A54F, 0x6BA86346, 0x94ED6BA8, 0x63675305, 0x63276387, 0x63686BA8, 0x63064A84, 0x94CC73C8,
+0x84098C6A, 0x8C8A8449, 0x842973C7, 0x94AB94CB, 0x8CAB9D0C, 0x73E8846A, 0x84898469, 0x6BA6A58D,
+0xA56E6386, 0x5B2473E7, 0x844A4AC3, 0x846A6BC8, 0x844A7C29, 0x848A7C29, 0x84498469, 0x844A94AB,
+0x94ED73E9, 0x8C8C7409, 0x844B4A84, 0x52E56367, 0x5B474AA4, 0x4AC56BA8, 0x634852E6, 0x53063A43,
+0x52A652C7, 0x42254225, 0x52A652A6, 0x42245B08, 0x63285286, 0x634939C3, 0x5AE86B4A, 0x39E36B6A,
+0x52A58C6C, 0x42246B69, 0x31A33183, 0x42456329, 0x31C352C7, 0x31A24224, 0x21425286, 0x39A42943,
+0x528639C4, 0x94AE6B49, 0x4A6739E4, 0x2122738C, 0x21412122, 0x18C039A3, 0x31A33183, 0x212139C4,
+0x52665AA8, 0x63282100, 0x8C6D7BAB, 0x8C8C4A64, 0x5AE862E8, 0x842C4A86, 0x8C8C842B, 0x52E76B89,
+0x42449CEF, 0x4AA63A04, 0x42646348, 0x42246348, 0x4A877C0C, 0x2988424A, 0x21482148, 0x318939AA,
+0x21072969, 0x18C520E6, 0x086218A4, 0x08420863, 0x00200861, 0x73EC636A, 0x39EA52AB, 0x296A31CB,
+0x2968296A, 0x18E52127, 0x18C418A5, 0x18E418C4, 0x10A21084, 0xA56E73CB, 0x848A5B46, 0x63A78CEC,
+0x52C594CC, 0x6BA86B67, 0x842B842B, 0x42444A85, 0x846C6BA9, 0x6BA831E2, 0x29A13202, 0x10E02141,
+0x32023A24, 0x4AE55306, 0x5B47846C, 0x6BC85306, 0x52C56BC9, 0x632852A5, 0x634852C7, 0x63076B48,
+0x5B0594AC, 0xA54D7C29, 0x73C68C8A, 0x8C8B8429, 0x94EB6325, 0x5B057C29, 0x7C295B05, 0x63668CAB,
+0xB5F17C29, 0x3A028C6C, 0x8C8B52C5, 0x52E48C8B, 0x842A7C09, 0x844A73A8, 0x6325842A, 0x73E76345,
+0x6B878C6A, 0x94AB8429, 0x63658448, 0x7C097BC8, 0x8CAB6B87, 0xA56F94AC, 0x9D2EBE11, 0x844C73AA,
+0xA56E8C8C, 0x846A844A, 0x6BA6AD8E, 0x73A773E8, 0x7C09948B, 0xAD6E8C6B, 0x948B9CEC, 0xA52CA50C,
+0x63466B87, 0x8CAB8CAB, 0xAD4E8C8B, 0x8C6A6B67, 0x63468C4A, 0x8C8B6346, 0x8449B5F0, 0x84496BA6,
+0x6BC773C8, 0x73E88C8A, 0x7C285B25, 0x8CAAA58E, 0x6BA773E8, 0x73C973A8, 0x4A4639E4, 0x63484A65,
+0x6B686B89, 0x52C55B07, 0xC6338C6C, 0x39E383EC, 0x4A646B48, 0x52C64224, 0x39E35AE7, 0x73CA52C6,
+0x6B8894CD, 0x5B067C0A, 0x7C0A73C9, 0x31C173EA, 0x5B0731C2, 0x5B0652C5, 0x844B7C0A, 0x63268C6B,
+0x73C89CED, 0x73C78C4A, 0x9D0C7BE8, 0x8CAB6B66, 0x4A627BC8, 0x73E894EC, 0x73C7844A, 0x73C76BA7,
+0x84496BA7, 0x52E48CAB, 0x7C2A6BA7, 0x7C0973E9, 0x6BA77C29, 0x94CB6BA7, 0x846A6B86, 0x9D0E844A,
+0x5B26844B, 0x52C58C6C, 0x73C96367, 0x6BC86B88, 0x848B7C0A, 0x42A45B47, 0x53067C2B, 0x4AC64AA5,
+0x634929A2, 0x5B082961, 0x4A654A65, 0x42251900, 0x52A64AA6, 0x7BEB4A85, 0x21217C2D, 0x29824225,
+0x52A573EA, 0x52A65B07, 0x5B084265, 0x5AE852E7, 0x19002121, 0x4A462141, 0x31C32982, 0x842C3A04,
+0x6B696328, 0x4A4531A2, 0x632A52A7, 0x6B8B73CC, 0x5B0873AB, 0x41E46328, 0x52864A45, 0x42045266,
+0x39E352A6, 0x634952A6, 0x52C74A65, 0x31C273C9, 0x31A33A24, 0x4A864245, 0x31C25B27, 0x5B07848D,
+0x52C631C2, 0x42253A24, 0x6BA931E2, 0x39E44265, 0x52C94AA7, 0x214831C8, 0x29682127, 0x31892969,
+0x19062127, 0x18C410C5, 0x10631083, 0x08620842, 0x08800020, 0x7C2C6BC9, 0x39EA4AA9, 0x296A31AA,
+0x210618E6, 0x10A410C5, 0x10A41084, 0x10A42125, 0x10810042, 0x8CCC8CAD, 0xADD05B45, 0x73EA5B26,
+0x5AC74224, 0x5AC65286, 0x4A656327, 0x63695AE7, 0x52C56347, 0x6BC91940, 0x428363A8, 0x5B274284,
+0x42644AC5, 0x3A433A43, 0x42634284, 0x52C63A63, 0x4A854AC5, 0x5AE74224, 0x6B894A65, 0x52655286,
+0x5AE56347, 0x842A4222, 0x8C8A6B86, 0x6B879CEC, 0x73A77C08, 0x7C096B86, 0x9D2E8CAC, 0x7C096BA7,
+0x9D0D6345, 0x63274243, 0x6B8752E5, 0x42626B86, 0x73C84AA3, 0x7C294A83, 0x52C473A7, 0x8C6A7BE8,
+0x73E86345, 0x6B867C09, 0x632552C3, 0x63268429, 0x63466346, 0xBE3194CC, 0xB5CFA56D, 0x8C8B7C09,
+0x8C8A7BE8, 0x7BE8ADAE, 0x6B66BE10, 0x94EC8C6A, 0x94AB73A7, 0xB5CF7C28, 0xAD8E9CEC, 0x63458C49,
+0x6BC77C29, 0x94EC7C28, 0x9D0D9D2D, 0x6B6694CC, 0x52C452A3, 0x8C8B52E4, 0x5B058C8A, 0x848A6BC7,
+0x94CC6366, 0x4A835B26, 0x4AA36BA7, 0x8449846A, 0x84495B24, 0x73887C09, 0x5AE82100, 0x42045AC7,
+0x52865286, 0x41E33181, 0x31612961, 0x39C3738A, 0x31A25AE6, 0x4A665AE7, 0x4A654AA6, 0x5B074244,
+0x6B8873C9, 0x52A45B46, 0x7C0A52C5, 0x52A64A85, 0x63484264, 0x63474AA4, 0x52E56BA8, 0x63675B06,
+0x636673E8, 0xA54D8CAB, 0x84298449, 0x63467C08, 0x6B876346, 0x7BE973E9, 0x73A86326, 0x6B8752E4,
+0x73C86366, 0x8C8A844A, 0x63666366, 0x7C4A52C4, 0x8C8B5B26, 0x73C76BA7, 0x6BA73A21, 0x73A88C8B,
+0x42638CCC, 0x4A854AA4, 0x5B076368, 0x73E96367, 0x8CAC73E9, 0x6BC94283, 0x21405B47, 0x428531E2,
+0x6B8A39E3, 0x422552A7, 0x31A25AE7, 0x296241E4, 0x31E33183, 0x7C2C636A, 0x21213A05, 0x39E331A3,
+0x3A037BEB, 0x39E26348, 0x39E24244, 0x8C8D4A65, 0x7C0C7BCB, 0x42452942, 0x52A65B08, 0x73CA94AE,
+0x3A037BEB, 0x632941E4, 0x21014205, 0x5AE84226, 0x6B496308, 0xA5107BCB, 0x736A9CAF, 0x8C4C9CCF,
+0x3A034A45, 0x5B0752A6, 0x52C67C0C, 0x3A024244, 0x4A8652A6, 0x5B0852C7, 0x3A034AA5, 0x31A29D0F,
+0x52E73A04, 0x52C76369, 0x424452C6, 0x424652C7, 0x4A8A39E5, 0x190731A8, 0x29892969, 0x31AA3189,
+0x18C52107, 0x10C418C5, 0x106318A4, 0x08211063, 0x4A860020, 0x740A7C4B, 0x29684269, 0x31AA31CB,
+0x19063189, 0x29672947, 0x318831A9, 0x08422106, 0x08401083, 0x63A75B48, 0x950D7409, 0x21604264,
+0x52874A45, 0x41E44A46, 0x7BEB5286, 0x5B278C8D, 0x4AC56347, 0x52E64AA5, 0x6BC86BC9, 0x5326846B,
+0x29C27C0B, 0x3A2352C6, 0x634731E2, 0x6BA95306, 0x5B0752C6, 0x52A64A65, 0x52A66308, 0x420483EB,
+0x73C96B28, 0x7BEA5AE7, 0xA52D6B67, 0x6B87842A, 0x6B867C08, 0x844A73C8, 0x73E96BA8, 0x7C096346,
+0x6B8752A3, 0x7C2A94CD, 0x9D4D7BE9, 0x73E86346, 0x73C8844A, 0x52A38C6A, 0x8C6A5AE4, 0x6B677BC8,
+0x844973C8, 0x73C873C8, 0x73877387, 0x840A8C4A, 0x5B059CED, 0x8449AD6E, 0x9D4CB5AE, 0x6B86B5AF,
+0x6B86AD6E, 0xB5CFB5EF, 0xA54D94CB, 0x8C8B9CED, 0x9D0C6346, 0xC6517C29, 0xAD6E9D2C, 0x73A773C8,
+0x6345ADAE, 0x94CB5B25, 0x8CAB9D0D, 0x73A773C8, 0x7C29844A, 0x634673C8, 0x6BA86367, 0x848B848B,
+0x52E56326, 0x63476B88, 0x5B266367, 0x7C096B87, 0x73A77BE8, 0x94AD7367, 0x10603162, 0x63085267,
+0x39C383EC, 0x3162B572, 0x41E383EB, 0x52867BCB, 0x6307840B, 0x7BCA39E3, 0x4AA5A52F, 0x7C2B4A85,
+0x6B884AA5, 0x94CC5B06, 0x52A573CA, 0x29814204, 0x73A952C6, 0x5B0552E5, 0x63677C2A, 0x5B064A84,
+0x6BA78C8B, 0x848A4242, 0x6345AD8F, 0x52E473C8, 0x7C0973C8, 0x73C96B67, 0x6B678C4B, 0x7BE97388,
+0x73C86B67, 0x6BA77BE8, 0x52E56326, 0x6BA87C2A, 0x848B73A8, 0x7C296B66, 0x6B87844A, 0x6BA87BE9,
+0x73E973A8, 0x6BA94264, 0x63277C0B, 0x7C2A3A03, 0x63886347, 0x742A5B47, 0x42644AA5, 0x52C652E6,
+0x5AC74A65, 0x39A35286, 0x41E35265, 0x39E45AC7, 0x5B0839E3, 0x63696369, 0x19013A05, 0x18C02141,
+0x39C49D10, 0x52863A04, 0x4A846BA9, 0x844B4AA4, 0x8C8E4223, 0x31A32141, 0x6BAA3A04, 0x3A043A24,
+0x5AC74244, 0x5AE839E3, 0x31A33A05, 0x39E44A66, 0xA51052A6, 0x52864204, 0x83EB6B29, 0x7BEB8C6C,
+0x5AE773CA, 0x73EA29A1, 0x5B086368, 0x5B2752E6, 0x63495B07, 0xAD916B89, 0x8C8D4224, 0x29823A04,
+0x52C752C7, 0xA5507C0C, 0x5B078C8D, 0x420539E3, 0x42094A48, 0x21282147, 0x31A92168, 0x294831A9,
+0x18C518C6, 0x10831083, 0x08620842, 0x00200841, 0x6BA92983, 0x84AD84AB, 0x31C973CE, 0x29692168,
+0x29681907, 0x18E62147, 0x29471906, 0x10840022, 0x08610843, 0x63686349, 0x5B26A56F, 0x844C31E2,
+0x422594EF, 0x39A42942, 0x6B494A45, 0x73EA52C6, 0x5B466387, 0x31E25B47, 0x740A6BC9, 0x53064263,
+0x29A16368, 0x21606368, 0x5B0763A8, 0x94EE31E2, 0x63285B27, 0x52A66B89, 0x62E84A45, 0x8C4D7BCB,
+0x52866348, 0x4A6552A6, 0x63065AE6, 0x84097BE9, 0x9CEC6325, 0x6B6673E8, 0x842A73C8, 0x7BE99D0D,
+0x63476346, 0x844B5B06, 0x73E87C29, 0x7BC952C4, 0x7C0952C5, 0xA54D7BC8, 0x9CCC73A7, 0x840A7BA8,
+0x63257BC8, 0x8C2A7BC8, 0x4A6294CB, 0x8C6B5AC4, 0x8C8B7BE8, 0xADAF9D0C, 0xADAE94EB, 0x94CB8469,
+0x5AE46366, 0xA54EA54D, 0x73A794CB, 0x7BC8844A, 0xADAF7C08, 0xA54D8C8A, 0x9CEC8428, 0x6BA7844A,
+0x74088CCB, 0x9D2D8CEB, 0x6BA78CAB, 0x6BA794EC, 0x73A86367, 0x6BA852C4, 0xB5F16BA8, 0x9D0D6367,
+0x94ED29C0, 0x73A952E6, 0x7C0A6368, 0x73A873C8, 0x63276B67, 0x7BA96327, 0x5246736A, 0x8C0C6B08,
+0x83AB8C0C, 0x83AC83CC, 0x73896B28, 0x52658C2C, 0x52855AC6, 0x94AD52A5, 0x94EC7C29, 0x6BA852C4,
+0x63877409, 0x5B0652C4, 0x42246347, 0x4A6539E3, 0x4A855B07, 0x6B886387, 0x634773E9, 0x3A235B27,
+0x74096367, 0x846A848A, 0x846A6BC7, 0x844A6387, 0x7C094A83, 0x4A637BE9, 0x73C994AC, 0x94AC7C09,
+0x63466346, 0x63257408, 0x63466366, 0x6BA87C29, 0x7C2A6367, 0x7C2A6B87, 0x73E97C4A, 0x73E95B26,
+0x63676BC8, 0x4A856347, 0x4A656328, 0x5B275B27, 0x3A2352E6, 0x52E57409, 0x5B067C2A, 0x52C65B27,
+0x39C34A45, 0x42045246, 0x62E85245, 0x18E083EC, 0x6BAA6B8A, 0x5B2831A3, 0x39E431A3, 0x52A73183,
+0x5AE839C4, 0x52C64A66, 0x52A42981, 0x42434243, 0x63286B48, 0x296131A3, 0x73CB4A66, 0x31C34A86,
+0x42454A65, 0x29616308, 0x52A75287, 0x296231A3, 0x73CA7C0B, 0x4203AD71, 0x842C4A45, 0xAD705AA6,
+0x63894264, 0x8CAD6368, 0x52C631E3, 0x94EE4244, 0x4A854A64, 0x29824245, 0x5AE72121, 0x6BAA6329,
+0x73EB52A7, 0x29812141, 0x4A655AE7, 0x7BEC8C6D, 0x3188526A, 0x19062927, 0x31AA31AA, 0x19073189,
+0x10A518E6, 0x10A318A4, 0x10621083, 0x00200862, 0x73EA634A, 0x63893A43, 0x31A95B2C, 0x296931AA,
+0x18E62969, 0x108410A5, 0x18C418A5, 0x10832106, 0x08611063, 0x52E739E4, 0x21405B27, 0x6BA93A03,
+0x5AE76327, 0x292139E4, 0x4A8562E8, 0x73E97BEB, 0x6BC86346, 0x32032980, 0x3203846C, 0x42435B07,
+0x5B275B27, 0x8CED848C, 0x52C56368, 0x9D0F5B27, 0x7C2B5B07, 0x52A673AA, 0x42246B29, 0x840C6B08,
+0x840C83EB, 0x6B69842C, 0x4223AD50, 0x94AB7BC9, 0x7BE87BC8, 0x73A773C8, 0x73A87BE8, 0x4AA494CC,
+0x5AE6842A, 0x844B5B07, 0x73C852A4, 0x7BEA6B67, 0x63066B48, 0x9CCC8C6B, 0x946BA4EE, 0x948C7388,
+0x9CCC8C4B, 0xB5B07368, 0xA50C8C4A, 0x7BE99CAC, 0xC6728C8B, 0x848A842A, 0xADAE9D2C, 0xA56E8C8A,
+0x73C87BE8, 0xA58E94CB, 0x63269D0D, 0x7C0994AC, 0x4282844A, 0x8C8A8C8B, 0x63267BE8, 0x636673A8,
+0xA58E8C8B, 0x94EC7C29, 0x7C097C09, 0x6B87B5D0, 0x844A4A63, 0x7C2A5B26, 0x5B267C2A, 0x7C2A9D2E,
+0x73A86326, 0x63079CEE, 0x5AE66B48, 0x6B486B68, 0x4A2483EB, 0x736A62E7, 0x62A762A7, 0x944DA4D0,
+0x5A6749E4, 0x732A5A47, 0xA4EE7B8A, 0x52849CAD, 0x5AE67389, 0x7C0939E2, 0x73C6ADAE, 0x63866BA7,
+0x63877C29, 0x94CC73E9, 0x4A8552C6, 0x19005AE7, 0x6B8852C6, 0x5B465B26, 0x29C1A590, 0x5B675B27,
+0x8CAB4AA4, 0x74089D2D, 0x8CAB950D, 0x7C295305, 0x7C096BA8, 0x842A7BC9, 0x63267BC9, 0x5AE58C8C,
+0x6B88842B, 0x6BA773A8, 0x6366846A, 0x844A6346, 0x4A84844B, 0x5B265B06, 0x73C873E9, 0x63466346,
+0x5B265B26, 0x94CD6B68, 0x63286348, 0x52E652A6, 0x63475B07, 0x5B465B26, 0x63675B27, 0x3A036BA9,
+0x5A864A24, 0x5A872921, 0x6B285A86, 0x4A4541E4, 0x42456B69, 0x4A863A24, 0x212131C3, 0x42252982,
+0x842D4A66, 0x5AC75B08, 0x7BCA6327, 0x31A22961, 0x39E34A45, 0x212131C3, 0x4A862982, 0x298173CA,
+0x3A2329A2, 0x9D0F5B27, 0x5AE75B07, 0x4A464245, 0x39E33A24, 0x94AD4A85, 0x6B686327, 0x7C2A5AE5,
+0x6BC93A63, 0x320284AC, 0x7C2B2160, 0x63486368, 0x52A64244, 0x39C34A86, 0x296231A2, 0x4A252121,
+0x3A034AA6, 0x6327A54F, 0x63286B68, 0x4A675AE7, 0x316931C8, 0x21471906, 0x31CA2969, 0x10C62127,
+0x10A410C5, 0x086310A4, 0x10821082, 0x39E50020, 0x7C2B52C6, 0x3A0463A8, 0x21274269, 0x21482148,
+0x31A9424B, 0x21472147, 0x210618E5, 0x10632105, 0x08420843, 0x19004246, 0x4A664265, 0x7C2C52C7,
+0x5B0673C9, 0x4A665AE7, 0x63284A85, 0x9D2E844B, 0x5B2584AA, 0x63486B88, 0x52E77C4C, 0x7BEA4A85,
+0x636852E6, 0x844B3A43, 0x73C9846B, 0x8C8D6347, 0x6B888C8C, 0x738A73CA, 0x5A866B49, 0x528539A2,
+0x5AC639C2, 0x7BEA6327, 0x9CCE5AE6, 0x73C8948C, 0x842A8CAB, 0x9D0C7C29, 0x5B2594CB, 0x8C8B94EC,
+0x39E36347, 0x39C273AA, 0x5B065B06, 0x63487C2A, 0x6B686347, 0x73896327, 0x946C4A24, 0x946B62E5,
+0x8C4B7BE9, 0xBDD26B48, 0xA50D842A, 0x946B94AC, 0x9D0C8C8B, 0x7C4A8CAB, 0x7C48952B, 0x73E88CEB,
+0x5AE56346, 0xA56E7408, 0x8C6AA58E, 0xAD90AD8F, 0x73E973E9, 0x5B256346, 0x4221A56E, 0x844A4242,
+0x9D4DADCF, 0x9D2D5304, 0xB5D05B05, 0x94CC9D2D, 0x8CAB6BA7, 0xA54E52E5, 0x6B885305, 0x5B46950D,
+0x842A8449, 0x842B73A9, 0x948C4A85, 0x8C2C948D, 0x8C2D738A, 0x83CC7BAB, 0x394241C4, 0x7B6A7B8A,
+0x83CB83AA, 0x8BEC5A87, 0x6B2783CA, 0x8C4B73A8, 0x63267BE9, 0x6B666326, 0x6BC66364, 0x844994CB,
+0x7C296366, 0x73E95B26, 0x7BEB6368, 0x63487BEB, 0x73C84283, 0x9D6F73E9, 0x6368A58F, 0x5B673222,
+0x7C4A4B05, 0x74296BC7, 0x9D4E7408, 0x844A5B66, 0x42625B05, 0x94CC52C4, 0x63479D0D, 0x7BE973C8,
+0x73E96B68, 0x7C296366, 0x63468CAA, 0x7C2A73C8, 0x6B886387, 0x6B886BC8, 0x5305848B, 0x6BC8950D,
+0x4AA46387, 0x4A643A43, 0x31A24265, 0x42243A24, 0x52E64264, 0x530563A8, 0x5B066367, 0x844C4243,
+0x7B8A41A2, 0x62875A46, 0x7BAA6AC7, 0x8C4D7B8A, 0x29614225, 0x4A652982, 0x29623A04, 0x7BEC4225,
+0x39E35AE8, 0x73AA6B49, 0x39C25AC6, 0x39E331A2, 0x29626329, 0x18E039E4, 0x29812961, 0x52C66328,
+0x10E07BEB, 0x950E9CEE, 0x52E68C8D, 0x424531C3, 0x21206B69, 0x73A96B89, 0x6B882100, 0x4AA49D0E,
+0x63873A23, 0x32029D4F, 0x6BA94244, 0x29A152C6, 0x5AE77C0B, 0x4A455AC7, 0x31A34A66, 0x18C05AA8,
+0x39E37BEB, 0x52A56B48, 0x4A443161, 0x42266B49, 0x296939C9, 0x29482948, 0x29692989, 0x19062148,
+0x19052126, 0x18E418C4, 0x086110A3, 0x52C80840, 0x73C91900, 0x42465307, 0x29684229, 0x19062969,
+0x21063189, 0x21262947, 0x29473188, 0x10842106, 0x08411063, 0x39E45B0A, 0x63292962, 0x4A865B09,
+0x3A02A54F, 0x39E34A65, 0x73CA5B07, 0x74094264, 0x3A22846A, 0x5B0752E6, 0x298152C6, 0x73EA9CCE,
+0x53064244, 0x73E86B87, 0x3A024263, 0x846C4244, 0x3A0173A8, 0x5AC6842B, 0x7369738A, 0x840AB571,
+0x52847369, 0x63478C6C, 0x63477BEA, 0x63267BEA, 0x73A85AE6, 0x6B8794CC, 0x7C2973C8, 0x5B068C6B,
+0x42458C6D, 0x4A654A66, 0x52C65B07, 0x7C0B6B89, 0x39E26B48, 0x21006B49, 0x8C2C5AC7, 0x7BE85AC5,
+0x842A840A, 0xCE745265, 0x6B67A4EE, 0x94AC9CED, 0x8CABA54E, 0x5B454A83, 0x950BADCF, 0x5B459D2C,
+0x7C0A6B88, 0x7408A56E, 0x9D2DBE10, 0x8C8B5AE5, 0x4AA46B88, 0x4A838CAC, 0x844A73A8, 0x6BA75B26,
+0x74089D2D, 0x846A6366, 0x7C4A73E8, 0x9D2D94EC, 0x6B879D0D, 0xBE327C0A, 0x94ED6BA8, 0x848B5B06,
+0x94CC844A, 0x842B8C6C, 0x5AE68C6C, 0x8C4D7369, 0x526662C7, 0x62A86AE9, 0x7B6BA4B0, 0x62A751E5,
+0x6B088BEC, 0x49E44183, 0xB56F942C, 0x6B27A4EE, 0x73A8842A, 0x7BE97BEA, 0x73E75AE4, 0x844994CB,
+0x844A73E8, 0x42635B05, 0x73AA5B07, 0x63684224, 0x638773C8, 0x7C2A7C2A, 0x5B677C2A, 0x63A784AC,
+0x5B665B46, 0x74295B46, 0x74299D4E, 0x848A8CAB, 0x3A216346, 0x73C873C8, 0x9D0D842A, 0x6B887BC9,
+0x8CAC4A84, 0x94EC8C8B, 0x846A73E8, 0x5B264A83, 0x73E96B88, 0x4AC47C2A, 0x5B4673C8, 0x9D6E9D4F,
+0x6BE97C4A, 0x848C7C2B, 0x31E26328, 0x4AA54A86, 0x530552E6, 0x7C4A6367, 0x42645306, 0x52A54A65,
+0x73295A65, 0x52056AE8, 0x62C78C0C, 0x5AA7A50F, 0x29612941, 0x63494244, 0x29832962, 0x52866308,
+0x6B492982, 0x42245B07, 0x318252C6, 0x4A455AC6, 0x528639C3, 0x42453A04, 0x424531A3, 0x4A853A24,
+0x3A036348, 0x42446388, 0x31E31900, 0x73EB3A03, 0x3A033A03, 0x6BA97C0A, 0x9D0F4264, 0x5B264243,
+0x950D5306, 0x42638CCC, 0x5B074AA5, 0x5B075B27, 0x738973CA, 0x41E4738A, 0x83EC41E4, 0x6B294A46,
+0x7BEA6B69, 0x63264A84, 0x63285285, 0x6B8C6349, 0x29482987, 0x21272107, 0x29692948, 0x29882148,
+0x21062147, 0x108310A3, 0x08400861, 0x42250880, 0x31C26BCA, 0x5B2A4AC6, 0x31A96B8E, 0x298829A9,
+0x29672147, 0x31892147, 0x31682968, 0x21262967, 0x08420863, 0x4A865B09, 0x21422141, 0x190131A3,
+0x42643A04, 0x31C24A85, 0x5B063A02, 0x52C66B88, 0x5AE65B26, 0x29818C8C, 0x4A438CAC, 0x6B686B88,
+0x73E94AA5, 0x94EC846A, 0x8CAC5B25, 0x5AE67C0A, 0x7BE952C4, 0x7BEA8C6B, 0x39A25265, 0x9CCD8C4C,
+0x6B678C8C, 0x73C97BE9, 0x5AE75B07, 0x5AE67BEA, 0x842A4A84, 0x6BA87BE9, 0x844A6BA8, 0x7BEA3A23,
+0x422552A6, 0x632952C7, 0x5AE74265, 0x18E073CA, 0x52864264, 0x316339C3, 0x526639C5, 0x62E58C6B,
+0x94AC8C4A, 0x948D7BA9, 0x7388A50E, 0xA54E6B67, 0x5B265B26, 0x8CEC7409, 0xA5CE952C, 0x4AC37407,
+0x8C6B9D0D, 0x7C29ADAF, 0x9D2D846A, 0x52A57C09, 0x5B066347, 0x63675305, 0xA54E4242, 0x7C2A6346,
+0x31E08CCC, 0x52C46366, 0x73C86346, 0x8C8B94CC, 0x52A47C09, 0x844AC693, 0xA56F6B87, 0x7C09A56F,
+0x8C8B8C8A, 0x73888C4A, 0x83E9842A, 0x5245840B, 0x942D6B08, 0x838C8BED, 0x62A949C6, 0x49C45206,
+0x7B6A944E, 0x62A74A05, 0xAD0F4A03, 0x8C4C62C6, 0x8C6C52A5, 0x7BCA6328, 0x5AE573A9, 0x6B886B87,
+0x844A4AA4, 0x7BE98CAC, 0x5AE78C8D, 0x6B686B88, 0x7C294AC4, 0x848C6367, 0x63A84284, 0x848A42A3,
+0x5B665325, 0x6BC863A7, 0x7C6A7408, 0x73E884AB, 0x63866366, 0x9D2D6BA7, 0x846B5B25, 0x5AE55B05,
+0x842A8CAC, 0x5B268CAC, 0x63266367, 0x5B266346, 0x4AA46367, 0x6BA77C6A, 0x6BA86BE8, 0x6BC96387,
+0x7C2A5B47, 0x5B06950E, 0x31E252E6, 0x5B065B27, 0x63876387, 0x94ED4AA4, 0x4A6452E5, 0x4A856327,
+0x5A667308, 0x49E45A46, 0x8C4D5A86, 0x42248C2D, 0x31824A25, 0x298273AA, 0x5AE839E4, 0x4A654225,
+0x4A6573AA, 0x39C3840C, 0x4A663182, 0x5AE74A66, 0x31C34A66, 0x3A043182, 0x31C352A6, 0x3A044A86,
+0x844D52C7, 0x3A4452E7, 0x63684AA5, 0xADB15AE7, 0x29A131C2, 0x5B279D0F, 0x31C2AD91, 0x9D2E3A03,
+0x5B674A85, 0x530673C9, 0x29A231C2, 0x3A034225, 0x31A252A6, 0x52877BAB, 0x5AA78C2D, 0x4A466B09,
+0x52856B28, 0x63077BCA, 0x52A65264, 0x4A694226, 0x29483188, 0x21072127, 0x29482969, 0x21472968,
+0x084218E5, 0x086218A3, 0x08400862, 0x21202963, 0x63686BAA, 0x52E83A24, 0x39E94229, 0x3A0A31C9,
+0x21472988, 0x31892949, 0x31883168, 0x10843188, 0x08411084, 0x5B08AD73, 0x39E339E4, 0x31E43183,
+0x5B2852A7, 0x5B284265, 0x63686348, 0x3A237BEB, 0x846C52C6, 0x7C0A6368, 0x5AE58C8C, 0x52844A64,
+0x73E994AD, 0x844A6B87, 0x7C2A5B26, 0x63269D0E, 0x7BE95AE5, 0x6B68BDF2, 0x39C2738A, 0x8C4B6B48,
+0x6346A52E, 0x7C0A842B, 0x31A12940, 0x31C239E3, 0x636752A5, 0x63275AE7, 0x7C2A52C5, 0x6BAA4A64,
+0x634931C3, 0x422539E5, 0x19012963, 0x424473AB, 0x4A6552C7, 0x39E52101, 0x39A43144, 0x6B678C2B,
+0x8C6B4A43, 0x52A54224, 0x94AC6B48, 0x52A47BE9, 0x950D94CD, 0xADF05B06, 0x84CA848A, 0x952C7428,
+0x9D2E94ED, 0x5B046326, 0x8CCC3A01, 0x31C17BE9, 0x52C5844B, 0x42427C09, 0x7C096B87, 0x636773C9,
+0x73C86347, 0x5B25A56F, 0x5B056346, 0x844A94EC, 0x7C096B67, 0x6346A56F, 0xADB094CD, 0x634673C8,
+0x9D0CA52D, 0x7BC8A50D, 0x8C2A5263, 0x73696B28, 0x62E76B28, 0x732B83AC, 0x5A6941A6, 0x39646ACA,
+0x62A7732A, 0x5A867B8B, 0x6B08AD10, 0x738A4A25, 0x738A6308, 0x4A456329, 0x948E840C, 0x42034A44,
+0x5AE64A64, 0x7BEA7BE9, 0x73A95AE6, 0x52E58C6C, 0x52E552A4, 0x63886367, 0x63884AA5, 0x74285B25,
+0x53055B46, 0x73E87409, 0x5B66846B, 0x6BC76BC8, 0x6BA79D2D, 0x8CAB73C8, 0x73E86BA7, 0x6B674202,
+0x8C6B7C0A, 0x6B87B5D1, 0x7C095B06, 0x6367842A, 0x63464263, 0x6BC77C29, 0x63676BE8, 0x63A8740A,
+0x5306740A, 0x6BA87C2A, 0x5B0673C9, 0x5B057C0A, 0x6BA752E5, 0x7C2A6BA8, 0x52C66B88, 0x63484A85,
+0x41C37349, 0x5AA74A25, 0x6B285AC6, 0x73AA3181, 0x39E339C3, 0x39E373AA, 0x42256B69, 0x52C64204,
+0x5AE6842B, 0x4A666B69, 0x4A664A86, 0x4A662142, 0x29822982, 0x52C63A23, 0x6B8952E6, 0x31C36349,
+0x31A33A04, 0x52C731C3, 0x5B075B07, 0x7C2B4AC5, 0x21403A02, 0xA5506348, 0x31E32982, 0x6BA96BA9,
+0x5B077C0A, 0x63688CCD, 0x7C0C4A85, 0x210073CB, 0x7BCA6B68, 0x8C2D5265, 0x6B296B28, 0x52461060,
+0x73894A85, 0x6B28840B, 0x6B494203, 0x39C86B4C, 0x29682147, 0x21072127, 0x29482947, 0x18E52127,
+0x08620022, 0x08410841, 0x08400841, 0x39E31901, 0x42445B27, 0x31C408C0, 0x31C84228, 0x420B39EA,
+0x31AA31CA, 0x29282969, 0x31882968, 0x084210A4, 0x10A20862, 0x422531C4, 0x63488C6D, 0x632852C6,
+0x52E752E7, 0x21202982, 0x63282981, 0x63292142, 0x636810A0, 0x5B266347, 0x6B8873C9, 0x5AE731C2,
+0x844B4264, 0x73C86B67, 0x73C88CCC, 0x7C0A6347, 0x6B476346, 0x7BCAA54F, 0x6B286B68, 0x844A3180,
+0x73A97409, 0x844C4AA5, 0x63482981, 0x5AE68C8D, 0x5B275B06, 0x52C794EE, 0x7C2B5B06, 0x3A246369,
+0x73EB5AE7, 0x212210C0, 0x21224246, 0x52E82121, 0x5AE82141, 0x296331C4, 0x4A2639C5, 0x6B485AC6,
+0x52E64A64, 0x5B082141, 0x4A8473A9, 0x846B52A4, 0x8CAB5324, 0x6BE863A8, 0x6385A5AE, 0x9D4D8D0B,
+0x73C873E8, 0x6BC74262, 0x52E4A58E, 0x52C5846B, 0x844A3A22, 0x6365950C, 0x7C096366, 0x73C9846B,
+0x94EC6366, 0x7C297C49, 0x7BE8846A, 0x6B87844A, 0x8C8B7C29, 0x634652C4, 0x63269D0D, 0xB5D06346,
+0x4A62A56D, 0x7C0994AB, 0x8C6B7BC8, 0x6B286327, 0x7BAA7389, 0x7B6C8C4D, 0x28E328E2, 0x5A6849E6,
+0x6B0A6AE9, 0x5A877B8A, 0x62E862E7, 0x6B2A6B29, 0x734A5286, 0x6B0A6B4A, 0x5AC862E9, 0x946D83EC,
+0x842C73AA, 0x5AC57BE9, 0x840B6B88, 0x5B06842B, 0x42427C2A, 0x8CAD6367, 0x6B884264, 0x5B257409,
+0x53055B66, 0x74096BC8, 0x73E85305, 0x74093201, 0x846A6BC7, 0x6BC76366, 0x4A8373C8, 0x73884A84,
+0x52C56346, 0x3A02844B, 0x73A894CC, 0x63476347, 0x7C295B26, 0x742973E8, 0x84AB6BE8, 0x742A84AC,
+0x7C6B5326, 0x5B264263, 0x63676367, 0x63876366, 0x63876366, 0x42426387, 0x52A56B88, 0x4A655AE6,
+0x52255A86, 0x63084A25, 0x298152A6, 0x63284204, 0x42046329, 0x31A25AE7, 0x5AC739A3, 0x29614A66,
+0x73A95B06, 0x4A857389, 0x39E44225, 0x6B6A52A8, 0x31E352C7, 0x42852961, 0x5B283A24, 0x3A044A66,
+0x29A24266, 0x216152C7, 0x3A036349, 0x5B076BAA, 0x3A2352E6, 0x10C094CE, 0x3A245B08, 0x52C56368,
+0x422473AA, 0x7C0B73CA, 0x5AE85AE7, 0x29625266, 0x5AE67BCA, 0x7BAA5265, 0x7BCB5265, 0x39C35AA7,
+0x6B4839C3, 0x62E64A24, 0x63087389, 0x2988632D, 0x29882968, 0x21062147, 0x21272927, 0x18E52947,
+0x00410863, 0x08410862, 0x10A10841, 0x42652142, 0x42642140, 0x21624A86, 0x422939E6, 0x31CA4A6C,
+0x39EA424C, 0x31CA39CB, 0x18C42106, 0x08621063, 0x18E30841, 0x31A339C5, 0x632839E3, 0x39E3738A,
+0x42453A24, 0x21212121, 0x21423183, 0x296331C4, 0x52E64225, 0x4A8552A5, 0x73CA5AE6, 0x52A66B49,
+0x94ED52C6, 0x73A88C6B, 0x42426BA8, 0x7C0A6B47, 0x9CED6B68, 0x7C2B73CA, 0x73897BCA, 0x6B88840A,
+0x320294CD, 0x6B896B88, 0x39E36B6A, 0xB5D139E3, 0xD6F56347, 0x42456328, 0x846D6B69, 0x52E72141,
+0x52C752C7, 0x19015AC8, 0x21624A87, 0x634A3A05, 0x08801901, 0x52C86329, 0x42042943, 0x6B888C6D,
+0x73EA6368, 0x42452141, 0x73C88C8C, 0x52E45AE5, 0x74087408, 0x6BE96367, 0x8CEB94EC, 0x6BE7B610,
+0x5B457C29, 0x9D0C8449, 0x742994EC, 0xA58F5B46, 0xA54E6326, 0x740773C7, 0x6BA77C28, 0x52A473A8,
+0x5B047C09, 0x9D0D844A, 0x8C8B7C09, 0x94CC7C09, 0x52E48C8B, 0x5AE56B88, 0x52E59D2E, 0x6BA8844B,
+0x73C78449, 0x5AE573A8, 0x5AE58C6B, 0x7BCA946C, 0x7BCA7368, 0x526662E8, 0x39A57B6C, 0x31634A07,
+0x6B2983AC, 0x6B289CAF, 0x4A257BAA, 0x736A5A87, 0x5AC739A3, 0x4A0641E5, 0x5246734B, 0x6B083983,
+0x52655A87, 0xA52E7389, 0x5AC67BEA, 0x94CE39C2, 0x63678C6B, 0x73C9846B, 0x5B077C0B, 0x846A73E9,
+0x636673E8, 0x4AA47C4A, 0x7C4A8CAC, 0x63667C29, 0x73E87C09, 0x638794CC, 0x6B886326, 0x5AE673A9,
+0x9D0DAD90, 0x8C6B5B06, 0x634773A8, 0x844B6B88, 0x52E57BE9, 0x5304846A, 0x63A7848A, 0x42A47C4A,
+0x7C8C7C4B, 0x42835306, 0x42636BA8, 0x6BA89D2E, 0x848B5B05, 0x424373C9, 0x422373A9, 0x5B0673A9,
+0x526541E3, 0x4A655286, 0x29A13A23, 0x31A25B27, 0x4A654A85, 0x5AA64A65, 0x39E439C3, 0x31C3738A,
+0x634831C2, 0x52C65B07, 0x6BAA52A6, 0x4AA56369, 0x21811940, 0x5B074264, 0x29A33A04, 0x4A8631E3,
+0x63287C2C, 0x52E68CAD, 0x636931C2, 0x63294245, 0x4A6639E4, 0x6B893A24, 0x424452E7, 0x5AE694CD,
+0x316239C3, 0x424439E3, 0x42054A66, 0x420473AC, 0x6B685285, 0x526539E3, 0x6B286B48, 0x6B287389,
+0x31824A45, 0x4A247369, 0xAD7362E7, 0x29683A08, 0x29A929A8, 0x21271906, 0x21272127, 0x18E51906,
+0x10A310A4, 0x00200861, 0x18E30000, 0x42452962, 0x7C2B3A03, 0xAD926B89, 0x73EF4A88, 0x39CA5B0E,
+0x29A75AEC, 0x18E52967, 0x18E40882, 0x18C30841, 0x42071082, 0x52876B6B, 0x52876349, 0x42054A66,
+0x294310A0, 0x21223A05, 0x18E131A3, 0x29634A67, 0x5B0852C7, 0x5AE76B8A, 0x29604AA6, 0x422473CB,
+0x73A831C1, 0x7BC9842A, 0x9D0D52C4, 0x8C6B73A8, 0x8C8C6306, 0x52A56368, 0x73896307, 0x52E55B06,
+0x6B8894ED, 0x7BEB31E2, 0x298273AB, 0x8CCC3A43, 0x6BA8A56E, 0x52E79D4F, 0x422473EB, 0x842C1920,
+0x5AC918E0, 0x52A80880, 0x52C71920, 0x73ED2162, 0x21431922, 0xA5510880, 0x842C0880, 0x39E18CAD,
+0x63A8A58F, 0x3A4329C1, 0x8CCC846B, 0x5B266366, 0x63676BC7, 0x8CED29C1, 0xADD0BE52, 0x5B465B45,
+0x5305848B, 0x94CB9D4D, 0xA56D9D2C, 0x950D7C6A, 0x8CAB5AE5, 0x7C286BA6, 0x73E87C48, 0x6B879D0D,
+0x6BA773E8, 0xA56E94EC, 0x8C8A8449, 0x6B6673E8, 0x844A8429, 0x7BE97C09, 0x94AC5AE5, 0x636752E5,
+0x73E88469, 0x52856BA9, 0x7BEA6327, 0x7BCA6B89, 0x6B68842B, 0x7BAB7389, 0xAD325246, 0x4A2641E5,
+0x52456309, 0x8C4C5AC7, 0x840B5AA5, 0x946D4A45, 0x5AA67369, 0x316341E4, 0x736A3982, 0x7BAA6B48,
+0x52465AA8, 0x7BA95285, 0x840B840A, 0x6B686307, 0x73A8A52F, 0x6BA8844B, 0x8C8C52A5, 0x4A836B87,
+0x530494EC, 0x63466BA7, 0x6BA85B05, 0x6BA76366, 0x6B876BA7, 0x842A6346, 0x63276B67, 0x94AD6327,
+0x9CCD39E2, 0x9CED6346, 0x840973A8, 0x8C4B8C6B, 0x7C0973A8, 0x6BA77C29, 0x5B464AA3, 0x6387952D,
+0x63A83A42, 0x53254283, 0x6BC84263, 0x530594EC, 0x73C952E5, 0x5B264AA4, 0x842A7C2A, 0x4A836326,
+0x42255266, 0x422452A7, 0x32034244, 0x42653A24, 0x63084A66, 0x5AC74A45, 0x39C34A46, 0x298139E4,
+0x42453182, 0x73CA6348, 0x634852E6, 0x63683203, 0x52E66BCA, 0x42656368, 0x19405B08, 0x4A862962,
+0x424539E4, 0x5B072961, 0x52866308, 0x52876349, 0x212131C4, 0x31C34225, 0x52C652A6, 0x4AA57C0A,
+0x39C35286, 0x4203840C, 0x5AA74225, 0x31A24A25, 0x52856B48, 0x52A67BCB, 0x422383EB, 0x738962E7,
+0x63086308, 0x31216B09, 0x840D83CC, 0x296831A8, 0x21472989, 0x29682106, 0x294731A9, 0x19052127,
+0x18E418C4, 0x08400862, 0x31840000, 0x844C6B6A, 0x6B898C6D, 0x5B087BEB, 0x4A897BED, 0x39C84A6B,
+0x00604A8A, 0x00200041, 0xDF1AD6B9, 0x00202103, 0x4A481081, 0x422639C5, 0x296239C4, 0x39E45B09,
+0x18C14A68, 0x42055AE9, 0x42256309, 0x634A18E0, 0x5AE831A4, 0x52E73A04, 0x4A8594EF, 0x42235B08,
+0x63264243, 0x63478C4B, 0x8CCC6346, 0x634773A8, 0x7BEA6307, 0x5AC66327, 0x5AA67BA9, 0x6BA9844B,
+0x846B846C, 0xA5504AA5, 0x08A05AE8, 0x9D4E6367, 0x42438CAB, 0x3A246348, 0x6B898CAE, 0x7C2C39E3,
+0x42462122, 0x088010A0, 0x31C373CC, 0x6BAB1900, 0x19014A88, 0x844C31A3, 0x52E5B613, 0x7408846B,
+0x8CEC7408, 0x63A74AC4, 0x950D6BA8, 0x5B664AC4, 0x74097409, 0xBE52A56F, 0x8CCC84AC, 0x3A625305,
+0x84AB6BC8, 0x8CCA94CB, 0xA5AEA56D, 0x8CCC6BC7, 0x7C296346, 0x8CCB9D0D, 0x6BA68CAA, 0x8C6A8C4A,
+0x84298429, 0x73C8B5D0, 0x846A7BE8, 0x73E98C6B, 0x5B058409, 0x7BC99D0D, 0x94AC7BE9, 0x7C09840A,
+0x8429A54D, 0x8C6C8C4B, 0x73CA6B68, 0x6B4862E7, 0x39E2B5B1, 0x6B696B48, 0x946E3982, 0x42058C2E,
+0x63086B09, 0x6B485265, 0x73C9840A, 0x5AC67BCA, 0x4A65840B, 0x4A25736A, 0x5AC662C7, 0x7BAA8C4C,
+0x5A676B0A, 0x528562A7, 0xA50F4203, 0x62E75265, 0x73C86307, 0x5B266B67, 0x52C54A84, 0x52C473E9,
+0x8C8B94CC, 0x53056BA8, 0x74095B05, 0x7C294A83, 0x7C29846A, 0x842A73A8, 0x73A89CED, 0x73A96307,
+0x844B7BEA, 0x8C6B6306, 0x842973C8, 0x842A6326, 0x73A88C6C, 0x42637BE9, 0x6BA76346, 0x638773E9,
+0x5B467C4A, 0x63A75B46, 0x7C2A848B, 0x52C56347, 0x6B886347, 0x63676BA8, 0x6B87844B, 0x7BC86B47,
+0x31C339E4, 0x52C74245, 0x21815327, 0x4A662181, 0x29424A66, 0x52863182, 0x31A34245, 0x424531C3,
+0x52C63A24, 0x73CA6B8A, 0x3A446BAA, 0x42852A02, 0x3A6429E2, 0x63A95B47, 0x4AE64AE6, 0x4AA64264,
+0x39C431E3, 0x6B098C4D, 0x62C739A3, 0x5AC74A45, 0x3A042982, 0x5B072981, 0x63494245, 0x52A673C9,
+0x4A654A65, 0x31C25AE7, 0x5B0852C7, 0x3A033A04, 0x4A455AE6, 0x738A5286, 0x5AC639E3, 0x52864204,
+0x4A65A590, 0x4A0620E1, 0x42074A46, 0x298931A8, 0x21482989, 0x29272106, 0x296718E5, 0x29461905,
+0x31872105, 0x08820862, 0x738B0860, 0xB5B18CAD, 0x6B891900, 0x52C67389, 0x42677C4D, 0x52A92984,
+0x002010C1, 0x94B00000, 0xCE95DF58, 0x634AD6D7, 0x42060000, 0x630A20E1, 0x21014A47, 0x5B496369,
+0x212310C1, 0x73AB2122, 0x73AA52A6, 0x5B084AA6, 0x4A8708A0, 0x94AE31A2, 0x21404AA5, 0x3A236348,
+0x846B4AA4, 0x634673C8, 0x94ED8CAC, 0x8C8D5B06, 0x630831C2, 0x62E66B48, 0x42248C4B, 0x5B06A54F,
+0xAD904A84, 0x4244AD90, 0x29A15B48, 0x6B876BA8, 0x5B076BA8, 0x52A74A86, 0x4A65844C, 0x52A55B27,
+0x3A044244, 0x73AC10A0, 0x31C43A05, 0x4A865B49, 0x4AA53A64, 0x740A73EA, 0x638763A8, 0x6386848B,
+0x742984CC, 0x31E09D6E, 0x6BC96BA8, 0x42434A84, 0xBE315B45, 0x848B4AE4, 0x530584AB, 0x744842C2,
+0xA5AF6C08, 0x63A663A6, 0x8CEA954C, 0x4261AE0F, 0x7C49A5CE, 0x842AA58F, 0x73E87409, 0x9D0D7C29,
+0xAD6E7C29, 0x6346A52D, 0x948B6326, 0x844B6B88, 0x73C88CAB, 0x7BC94222, 0x73886B47, 0x842A4243,
+0x8C8B6325, 0x63277C29, 0x8C6D4A85, 0x62E78C4C, 0x5AE66347, 0x73895AC6, 0x42054A65, 0x3142A531,
+0x7369738A, 0x39C273AA, 0x73E88C8A, 0x844C848B, 0x63487C0A, 0x52862982, 0x9D0E6327, 0x52656B68,
+0x734A7BAB, 0x7B8A8C2C, 0x842B52A5, 0x9CEE7BEA, 0x4A635B05, 0x848B7C49, 0x52E54A83, 0x73C95B26,
+0x6326844B, 0x42A46BC8, 0x7C4A6BE9, 0x7C296387, 0x844A6BA7, 0x7BC952A4, 0x73687BC9, 0x52A57389,
+0x63059CCC, 0x73A87BC8, 0x31C07C29, 0x948C52C4, 0x73886B47, 0x6B887BC9, 0x5B266B87, 0x5B057C29,
+0x740A4AA4, 0x63A84284, 0x6BA85B67, 0x73EA3202, 0x5B264243, 0x63466387, 0x63467409, 0x842B73A8,
+0x39E431C4, 0x29A22982, 0x21613A45, 0x21212141, 0x29632963, 0x31A34A46, 0x52A74246, 0x5B074A86,
+0x31E34265, 0x52E71900, 0x4AC64AA6, 0x194031E3, 0x42643A64, 0x5B485B27, 0x4AC66BA9, 0x3A244265,
+0x5AE82921, 0x31225A66, 0x6AE85A46, 0x39C25245, 0x42654A65, 0x5AE74245, 0x6B694204, 0x632739C2,
+0x31A22982, 0x4A853A04, 0x94CE39E3, 0x8C6C844C, 0x3A0331C2, 0x52866B49, 0x52A64204, 0x4204840C,
+0x19206347, 0x39A518A0, 0x39A55AA8, 0x29472925, 0x29683188, 0x18E520E6, 0x18E52927, 0x10C418E5,
+0x18E439C8, 0x00210862, 0x5AC718A1, 0x6B8873AA, 0x4A854A85, 0x73EA52A5, 0x42654A85, 0x5B0A844E,
+0x52EA7BEE, 0x10C02943, 0xB5F2ADB1, 0x5AE8AD71, 0x1080630A, 0x6B2A18A1, 0x52C72943, 0x742B740A,
+0x08402964, 0x5AC718C1, 0x844C6B49, 0x5B278C6D, 0x18E010A0, 0xAD51844D, 0x73A92120, 0x7C4B844C,
+0x6BA88CCC, 0xB5F16B87, 0x6BC8844B, 0x94CE5B06, 0x4A244224, 0x842A8C2B, 0x7C0B6B28, 0x7409846B,
+0xC65339E1, 0x5B277BEA, 0x8CAC3A23, 0x73E973C8, 0x3A237C0A, 0x5B0852A7, 0x5B077BEB, 0x42247C0B,
+0x29827BEB, 0x212273AB, 0x4A664205, 0x6BC98C6D, 0x8CCC31E1, 0x52E57C2A, 0x9D6E5B67, 0x950D5305,
+0x6BC87C6B, 0x6BC7B610, 0x9D4F3A22, 0xBE5273E9, 0xBE716386, 0xA5CF5304, 0x32207C69, 0x6C077C69,
+0x6BE75B66, 0x74283A42, 0x954B63C6, 0x4AC2952B, 0x952C952B, 0xAD8F73A8, 0x63867C09, 0xADAE94EC,
+0x8CAB8C8A, 0x528473A8, 0x8C6B7BA8, 0x73E952A5, 0x844A7C2A, 0x5AE57BC9, 0x6B676B27, 0x6B476306,
+0x63257BE9, 0x73888C6B, 0x6B896348, 0x840B8C4D, 0x738873C9, 0x5AC6A50F, 0x4A6552A6, 0x4A658C4D,
+0x52A57389, 0x632762E7, 0x950C4A62, 0x846B94CD, 0x5B058CAB, 0x422439E3, 0x7C2A6347, 0x52A552C5,
+0x39C36308, 0x7BAA9C8E, 0x5B06946D, 0x842AA50E, 0x844A842A, 0x8CEB7C29, 0x63465B05, 0x3A025B26,
+0x52C55AE6, 0x84AC5306, 0x742A42A4, 0x5B054AA4, 0x7C299D0C, 0x73877BE9, 0x7347946B, 0x4A648C4C,
+0x73878C6B, 0x73887BC9, 0x63677BE9, 0x52C55B26, 0x7BCA5AA5, 0x52A49CAD, 0x52E57C09, 0x5B0573C8,
+0x7C4A5B06, 0x4AC53A23, 0x740A4AE5, 0x6B8852E6, 0x52E56B88, 0x5B4573E8, 0x63675B06, 0x52A56B67,
+0x52C729A2, 0x31C32161, 0x10A029A3, 0x214218E1, 0x39C42121, 0x29833183, 0x4A654245, 0x42244A85,
+0x31C32140, 0x29614A85, 0x94EF846C, 0x21613A44, 0x3A0431E3, 0x52A66369, 0x31824224, 0x5A872141,
+0x6267944D, 0x52254183, 0x39A339A3, 0x39E339E3, 0x42453A04, 0x42244265, 0x294131C3, 0x63484264,
+0x63086B69, 0x39E431A3, 0x52862961, 0x8C6D7BEB, 0x632873EA, 0x4A4539E3, 0x42244A45, 0x6B897BCB,
+0x4A844264, 0x7BCBB5B1, 0x4A065AC7, 0x28C33124, 0x39E82924, 0x21062106, 0x210520C5, 0x21042986,
+0x106139C6, 0x21020020, 0x42045287, 0x52A631A2, 0x3A045286, 0x94AC39E1, 0x844D8CAD, 0x08610000,
+0x21452986, 0x42263185, 0x5AE71900, 0x6B6A5AE7, 0x42063A05, 0x39C53184, 0x422452A7, 0x94ED8CCC,
+0x292339E5, 0x41E418C0, 0x8C4C6B68, 0x214094CD, 0x10C010C0, 0xAD51DED7, 0x94AD3A02, 0x4263846B,
+0xADD0846B, 0x9D2E6367, 0x63A77C6B, 0x4AC47429, 0x7C2B6BC9, 0x94AC840A, 0x21205B07, 0x8C8C6367,
+0xAD6F8C8B, 0x3A02ADB0, 0x428452E5, 0xBDF194EC, 0x840B4A63, 0x5B2773C9, 0x4243846B, 0x6B48842B,
+0x73AB39C3, 0x4A8731A3, 0x630839A3, 0x73A95AC6, 0x73A78CAB, 0x9D2D39E0, 0x9D6FA5AF, 0x9D4E4AC4,
+0x7C4A84AB, 0xA58E950C, 0x8CCC4AC4, 0x6BA7C693, 0xB63084CA, 0x9D8E8CEB, 0x954C42E3, 0x7C6984CA,
+0x846A5B46, 0x74283A62, 0x74675B84, 0x84887C67, 0x950B7CA9, 0x9D4D6BC7, 0x950B6385, 0x7C277C27,
+0x8CAB5303, 0x7BC973C9, 0x840A4A63, 0x63684A64, 0x9D0E73E9, 0x52C552E6, 0x63266347, 0x73A86327,
+0x6B867C08, 0x8C6B8429, 0x5AE7846C, 0x840A6B88, 0x9D2E7C09, 0x42247388, 0x6B8973A9, 0x73C952C5,
+0x7BEA4A43, 0x52C4844B, 0x5B257C29, 0x5B4694EC, 0x52C4950C, 0x5B069D2D, 0x7C0A3A02, 0x4A646B88,
+0x63286368, 0x52A55285, 0x94CD842B, 0x8C6B7C09, 0x4A638C6B, 0x73E87408, 0x6B476B87, 0x9CED7C0A,
+0x4223842A, 0x6BC973E9, 0x5B266C09, 0x7C293A42, 0x52E47C29, 0xB58F7BE8, 0x7BA9948C, 0x6B679CED,
+0x6B877C09, 0x52A552A4, 0x52A48CAC, 0x63275B26, 0x5AA5842B, 0x7BC95284, 0x7C0994EC, 0x6B675B25,
+0x6B877C09, 0x63875326, 0x73E97C6B, 0x52C55B66, 0x5B2652E5, 0x42835305, 0x5B063A02, 0x63068C8B,
+0x424531E3, 0x31E33A24, 0x21432142, 0x31A42102, 0x29832142, 0x214231A4, 0x52E752A7, 0x63896328,
+0x3A2331C2, 0x636939E3, 0x5AE731C3, 0x31A273AA, 0x52C739E4, 0x29412942, 0x318339A4, 0x41E541C4,
+0x5A254163, 0x62A74163, 0x316341A4, 0x41E441E4, 0x29632942, 0x63294A66, 0x63493A04, 0x63276B48,
+0x31A339E4, 0x210131A3, 0x6B493182, 0x6B693162, 0x5B075AC7, 0x6B885B07, 0x18E03182, 0x840C7BCB,
+0x39E25286, 0x9CEE94CD, 0x5A87948E, 0x61E7B491, 0x398549A6, 0x20E52926, 0x29053947, 0x19034A28,
+0x084039A6, 0x52C718E1, 0x4A4562C8, 0x5AE84A25, 0x39E3948F, 0x73C810A0, 0x31C473CA, 0x5AEB2103,
+0x18E4630D, 0x18E16B6D, 0x41E47BCC, 0x632839A3, 0x4A4618C0, 0x5AC81040, 0x5AE68C4D, 0x42637C29,
+0x18C25287, 0x4A4520E1, 0xB5B0A50F, 0x18E07BEA, 0x4A664204, 0xA5506B49, 0xDEF59CCD, 0x7C297C0A,
+0x9D0D73C8, 0xC693A56F, 0x8CEC7C4A, 0x952D84AB, 0x7C4A9D2E, 0x8C8C6B67, 0x5AE639C2, 0x94ED6B88,
+0x8409BDF1, 0x5B46D6F5, 0x5B466367, 0xD6B473A8, 0x73C96306, 0x42439D2E, 0x73C86B88, 0x5AE7842B,
+0x210073AA, 0x5AE718C0, 0x4A043162, 0x948C8C4C, 0x63057367, 0x9CEC8C4A, 0x4AA46BA7, 0xBE3173E9,
+0x84AB6366, 0x42A3950D, 0xADD04263, 0x8489848A, 0x7C6984AA, 0x7C6984AB, 0xA5CE4AE3, 0x74087C69,
+0x952C7429, 0x74268CCA, 0x956B7447, 0x9D8C9D8C, 0x63C6954C, 0xADCE5303, 0x84A98CEB, 0x6BC66384,
+0x7C498CEB, 0x946B6B87, 0x840A6B47, 0x8CAC5284, 0xA56F4243, 0x4A846BA8, 0x73C973A8, 0x8C6B842B,
+0x8449B5AF, 0x844BB5B0, 0x5AE67C2B, 0xA52E73C9, 0x8CAB6B87, 0x94AD7BEA, 0x52E56B88, 0x63666326,
+0x7BE95284, 0x74087BE9, 0x636594CB, 0x8CCB848A, 0x5304ADCE, 0x52C47C29, 0x52C59D0E, 0x63687C2B,
+0x8C6C6B89, 0x63276307, 0x63276328, 0x84096305, 0x7BE9840A, 0x7C296B86, 0x4A637BC9, 0xB5B04A63,
+0x52A47BC9, 0xADD094ED, 0x4AA45326, 0x5B2652E5, 0x52E45B05, 0xA54D52C4, 0x7BC9948C, 0x632652A4,
+0x846B9D0D, 0x63477BEA, 0x6B88842A, 0x846C5B26, 0x5285948D, 0x5B266306, 0x848B94ED, 0x7BE873C8,
+0x5B056B66, 0x53057C4A, 0x5B667409, 0x5B256386, 0x5B265B05, 0x3A425305, 0x31E14A64, 0x63466B67,
+0x21614AA6, 0x31832981, 0x420631A4, 0x21022123, 0x088018E1, 0x3A251941, 0x6BA94AE6, 0x73CA31E3,
+0x5B076BCA, 0x426429A1, 0x63693A23, 0x31A373CA, 0x42053183, 0x41E539C4, 0x62E939A4, 0x312239C4,
+0x51C45A25, 0x290149C4, 0x39A43163, 0x41E55287, 0x31842101, 0x31A43A05, 0x39C42983, 0x4A655AE7,
+0x42253A04, 0x39A44205, 0x4A242941, 0x63085AC7, 0x10C02140, 0x31E252E6, 0x214129A2, 0x4A452982,
+0x420462E8, 0x9D0F4244, 0x6A869CEE, 0xC3F0C450, 0x6A48BC50, 0x39853103, 0x52485207, 0x18E239A5,
+0x29024A27, 0x6B485AE7, 0x39A2A50F, 0x6B295286, 0x2100842C, 0x6B486B68, 0x31A531A4, 0x9CD23A07,
+0x3A063A27, 0x6B6B948F, 0x398420E1, 0x5286948E, 0x6B48948D, 0x5AC70820, 0x7BE96306, 0x5286844B,
+0x5AA94A67, 0x6B292901, 0xA52EA52E, 0x4A446347, 0x73AA39C3, 0x4A248C4D, 0x94AB8C6B, 0x5AE49D2C,
+0x73C88C8B, 0x73C994CD, 0x9D6E42A3, 0x950CA5AE, 0x6BA79D4D, 0x7C2A950D, 0x63064243, 0xB5B052C5,
+0x84089CEB, 0xCED46BA7, 0x7C4A7C4A, 0xCE5373A8, 0xC65373A9, 0x6BC8A58E, 0x63466366, 0x94AD73A8,
+0x42246B48, 0x840B52C6, 0x5AA66B28, 0xAD0F9CCE, 0x5AC552A4, 0xAD6EC631, 0x4AC394EB, 0x94CC5B25,
+0x6BC76366, 0x5B257C6A, 0x5B459D4E, 0x7407BE71, 0xA5CE5343, 0x6386954D, 0x84AA6C07, 0x952C7407,
+0x9D4B9D6C, 0x95096BE5, 0x8D097446, 0xBE6FBE8F, 0x63C66C06, 0xA5CD8D0A, 0x5B657C69, 0x5B254AE3,
+0x848A7C69, 0x8C4A8CAB, 0x948C8409, 0x8CAC842A, 0xA58F6366, 0xA5AF7C4A, 0x9D0CA58E, 0xA54D9D2D,
+0x948B9D2C, 0x94ACB58F, 0x9D2E6367, 0x73C88CAC, 0x52E46BC8, 0x73C87C2A, 0x6BA7A56E, 0x6B866BC7,
+0x63466B86, 0x84897428, 0x9D4B63A5, 0x63656385, 0x8469952B, 0x844B7409, 0x5B277C2A, 0x634731E2,
+0x52A56388, 0x632673A8, 0x63474263, 0x52A452A4, 0x7BE952C5, 0x94CB7408, 0x3A026B87, 0x6B676306,
+0x214073C9, 0x4263B612, 0x4AC46BE9, 0x74094263, 0x846A52E5, 0x7C098C8A, 0x5AE56326, 0x5B2573A7,
+0x74096BC7, 0x7C2A6347, 0x42425B26, 0x63475B46, 0x6B8839E2, 0x52E56367, 0x63675B46, 0x7C095B25,
+0x52C45B04, 0x63875305, 0x63867C8A, 0x63667428, 0x428363A7, 0x5B275B47, 0x4A845306, 0x73C873C8,
+0x31E36B69, 0x31A339E4, 0x29644226, 0x3A063184, 0x6BAB4246, 0x4AA652C7, 0x7C2B6BAA, 0x94CE2140,
+0x3A647C4C, 0x63685B27, 0x6BAA4A85, 0x39E52121, 0x41E54A26, 0x31634A26, 0x31434A06, 0x31435227,
+0x7B2A6267, 0x4A0562A8, 0x41E53184, 0x39A44A26, 0x52683143, 0x10801040, 0x318420E2, 0x6B8A5AC8,
+0x52C74A66, 0x6B6B5287, 0x7BAB736A, 0x73AB7BAB, 0x4AA55AE7, 0x3A436367, 0x19203A23, 0x4A4539C4,
+0x39A320E0, 0x6B896B69, 0x72E783EA, 0x9AEAB3AD, 0x832A71E6, 0x41E46AC8, 0x52463963, 0x62E8736A,
+0x39A339A4, 0xAD4F7BAA, 0x39C383CA, 0x5AC762E8, 0x42035286, 0x52866328, 0x31855AEA, 0x4A677BEE,
+0x8CAE5B08, 0x52664A45, 0x736B41A5, 0x7389944E, 0x8C6C6B68, 0x63076B28, 0x738841E2, 0x6B694A65,
+0x08202922, 0xA4CF39A4, 0x73877BA8, 0x6B687BC9, 0x4A24840B, 0x52858C0C, 0xAD6D9CAC, 0x9D0C9D0C,
+0x52836B25, 0x52C54A84, 0x84CB7409, 0x952D7429, 0x6BC79D0D, 0x8CACADB0, 0x4222844B, 0xB5AFAD6F,
+0x7BE794AB, 0xD6F53A02, 0x42428CCC, 0xB5B18C6B, 0x948CC612, 0xA56EA56E, 0x5B265B06, 0x6306C632,
+0x73C973C9, 0x424373A9, 0x52645AA6, 0x6B4720C0, 0x948B9CAC, 0x9CCC8C2A, 0x742873C7, 0x73C873E8,
+0x7C295B05, 0x9D2D73E8, 0xADF052E4, 0x84C98CCA, 0x6C065B84, 0x5B66ADEF, 0x74084282, 0x952B7C49,
+0x84889D2B, 0xBE6E84A7, 0x8D0A5B63, 0x7C88950A, 0xA5EE5B65, 0x6C068CEA, 0x5B657C89, 0x63877409,
+0x6BE763A6, 0x7C297C08, 0x83E97367, 0x73E973A8, 0x32214283, 0x5B654282, 0x848A4AC3, 0x7C287C08,
+0x8C4AAD8E, 0x7BE9840A, 0xAD8F94CD, 0x84497C29, 0x846A52E4, 0x94CC6347, 0x6BA773C8, 0x6BC79D2D,
+0x8CCBAD8F, 0x74278C8A, 0xB62E7426, 0x742763A5, 0x63858CCA, 0xA58F6346, 0x4A846368, 0x530629A1,
+0x424431E2, 0x52E5844B, 0x52E55AE5, 0x3A226B68, 0x52C452C5, 0x7C088CAB, 0x7C098C6A, 0x5AE56B67,
+0x4A846306, 0x7C2ABE12, 0x73E97C2A, 0x52E54AA4, 0x73E95B06, 0x7C097BE9, 0x63269CCC, 0x8CCB73C8,
+0x73E86BA7, 0x8CAC5B26, 0x63877C09, 0x636773E9, 0x6BA84A84, 0x63867C09, 0x6BC86BA8, 0x846A52A4,
+0x6B866B46, 0x6BA76B87, 0x63C7846A, 0x52E56BC8, 0x63874284, 0x4AE552E6, 0x4A846BA9, 0x5B0573A8,
+0x4A664245, 0x29632983, 0x29433A05, 0x31C431A4, 0x52A75B09, 0x42654AA6, 0x4AA54265, 0x8CAD3A23,
+0x42A4742A, 0x3A23952E, 0x29823A44, 0x18C11901, 0x39A53A05, 0x420639C5, 0x294339E5, 0x318331A4,
+0x62C83983, 0x4A462921, 0x62E952A8, 0x6B0A4A06, 0x29034A06, 0x20C21040, 0x420639A5, 0x31825266,
+0x19005B28, 0x42052983, 0x526639A3, 0x5AC75AC7, 0x5B0652C6, 0x5B67848B, 0x3A244264, 0x39E410E0,
+0x6B497BCB, 0x6B497BEC, 0x5AA54A85, 0x836993EB, 0x942B5A24, 0x52A55AC5, 0xC5F252A5, 0x4A249CAE,
+0x946D6B28, 0x4A6452A5, 0x41E4840B, 0x946D5AA6, 0x7BCA5265, 0x5AC762E7, 0x6B6A8C8E, 0xAD905B27,
+0x6327848C, 0x840B4243, 0x7BAB5266, 0x8C2B94AD, 0x4223AD90, 0x5AC64203, 0x7BA95284, 0x420452C6,
+0x5AA82901, 0xB59162E7, 0x7BA85264, 0x5AA5840A, 0x5AC65285, 0x840A842B, 0x52A2A52D, 0x8408AD8D,
+0x7BA86B45, 0x63476326, 0x5B465B46, 0xBE324AC4, 0x6BA85B25, 0x9D2E6366, 0x63268CAC, 0x8429B5D0,
+0x8C6A9CCB, 0x63676367, 0x4AA5CED4, 0x63276B88, 0xA50EC653, 0x842A6B87, 0x7C0A8C8C, 0x5284844B,
+0x6BA873E9, 0x63477C2A, 0x5AA6C612, 0x948C6306, 0x7BA87BC9, 0x73A8842A, 0x63865B45, 0x7C096366,
+0x846A7C08, 0x7C494AA2, 0x63A7B5F0, 0x84C97C68, 0x9D6C5B84, 0x9D6E5345, 0x63666386, 0xADAE950B,
+0x950A7C47, 0x8CA96384, 0x428263A5, 0x53247C89, 0x42C28D0B, 0x6BE684C9, 0x74495B65, 0x63A85305,
+0x7468956C, 0x42417447, 0x6B477BE8, 0x39E16346, 0x7C496346, 0x7C294AA3, 0x84696BC7, 0x8CCB6386,
+0x842A8C8A, 0x5AE66306, 0x8C8B7C2A, 0x7C088469, 0x7C096BA7, 0x6B686B67, 0x4AA47C2A, 0x6BA7A56D,
+0x9D2D7C29, 0x846952E3, 0x950A5B64, 0xA58C8CE9, 0x3A215B24, 0x94CC8CAB, 0x42434242, 0x52E57C4A,
+0x52853A03, 0x4A4373A8, 0x4A844AA4, 0x7BEA6347, 0x42635B27, 0x638552E4, 0x7C49A56D, 0x52C46346,
+0x8C8C6B47, 0x9D0E73C9, 0x63475305, 0x52C56347, 0x73C94AC5, 0x7BE98CAC, 0x73A8A52E, 0x9D2C6BA7,
+0x73E75303, 0x94AC6BA8, 0x7BE87C29, 0x6B874242, 0x7C4B6388, 0x52E463A7, 0x7C4A6387, 0x73C85B25,
+0x7BE94A63, 0x6BA76346, 0x74496C08, 0x5B265B66, 0x5B275B27, 0x53065B47, 0x4A844AA5, 0x5AE56326,
+0x4A464A66, 0x29424225, 0x3A042942, 0x31C43A05, 0x3A044A87, 0x4AA64265, 0x21402982, 0x8CCD5B27,
+0x8CED7409, 0x29E26BEA, 0x19213A24, 0x21432122, 0x21232102, 0x21023184, 0x21222963, 0x42052101,
+0x31A231A3, 0x4A465AC8, 0x42054A26, 0x41C46B09, 0x31433964, 0x314341A5, 0x42055268, 0x4A865267,
+0x18E073CB, 0x42042941, 0x42045266, 0x39C339A3, 0x63685B07, 0x5326952E, 0x42856368, 0x29612121,
+0x6B694204, 0x4A663183, 0x42644A85, 0x7BA9842B, 0x4A646B47, 0x8C8C842A, 0xD6B473A9, 0x7BA96306,
+0x83EAAD2F, 0x528541E3, 0x526562E7, 0xAD30A4EF, 0x7BAA3181, 0x6B485AC6, 0x8C4C4204, 0x9D0DC653,
+0x42436BA8, 0x8C4B5AE5, 0x5AC78C0C, 0x6B8862E7, 0x5AC641E2, 0x5AE63182, 0x73687BCA, 0x840C6B08,
+0x5266734A, 0x83EA5245, 0x83E95AC5, 0x31808C2A, 0x6B277BCA, 0xAD4EB5B1, 0x94CA8C8A, 0xA52CA54C,
+0x8409946A, 0xA56F39E1, 0x6BC83A42, 0x844B2980, 0x7C096306, 0x94ED8CAC, 0xA56E8C8B, 0x5B0452C4,
+0x63255283, 0x63475B06, 0x7C2BC653, 0x5B069D0E, 0x7C0AD694, 0x844B7BCA, 0x6B6873A9, 0x73C8B5F1,
+0x7C098CAC, 0x842A6346, 0x42022960, 0x5AC46B47, 0xAD6F7BE9, 0x7C098C2A, 0x8CAB7C09, 0x73C873C8,
+0x846A7BE8, 0xBE31AD8E, 0x29A05B26, 0x84A95B44, 0x84889D6C, 0x74097C4A, 0x846A6BA8, 0x638594CB,
+0x63449D2C, 0x84694AA2, 0x3A21848A, 0x952C7408, 0x4B037C69, 0x63C66BE7, 0x4262A58E, 0x21A05B26,
+0xAE0E7448, 0x63854AC2, 0x4A837C28, 0x7C2A4A84, 0x4242AD8F, 0x8CCC6B67, 0x740894CC, 0x73E87408,
+0xA52E7BE9, 0x8C6C83EA, 0x5B257C0A, 0xB5CFAD8E, 0x6BA87BE8, 0x7BEA73A9, 0x94CC73C9, 0x63673A22,
+0x8C8B6346, 0x7C487C29, 0x5B443A21, 0x63648CC9, 0x8CAC6346, 0x63459D0D, 0x52E56346, 0x73E98C8B,
+0x63285265, 0x73A852A5, 0x4AA46B88, 0x5AE74224, 0x52C4842B, 0x73C75B05, 0x9D2D94CB, 0x6B8831E1,
+0xA4EE840B, 0x7C0A5AE6, 0x73C9A52F, 0x5AE66B88, 0x9D2F844C, 0x52A46B88, 0x5B057BE9, 0x7C287C08,
+0x94EB6365, 0x73C85AE5, 0x634562E5, 0x5B055AE5, 0x6BE96BA8, 0x63A74AE4, 0x74094AE5, 0x6BA76BC8,
+0x52A46346, 0x84AB5B05, 0x6BC87408, 0x5B476347, 0x4AC54AA5, 0x4AE54AA4, 0x4AA56388, 0x6B476B48,
+0x42054245, 0x31A32962, 0x63693203, 0x4265742C, 0x42452162, 0x3A244AA6, 0x29A22161, 0x5B674AA5,
+0x8CED744A, 0x3A4442A4, 0x3A053203, 0x39C52142, 0x21231902, 0x29432984, 0x3A042141, 0x63693A04,
+0x4AA6848D, 0x52863A04, 0x5AC74A45, 0x4A256308, 0x948E4224, 0x41E54A46, 0x52462922, 0x63085AC7,
+0x3A0394EE, 0x4A454A65, 0x5A864204, 0x422439C3, 0x42844AC5, 0x29C15306, 0x4AC65B88, 0x39C31920,
+0x73896328, 0x4A8631A2, 0x31C26B89, 0x632652A5, 0x52A56367, 0x946C6B67, 0x840A7BC9, 0x73696307,
+0x62E7B591, 0x5AC66307, 0x62E75285, 0x946DB571, 0x5AE62940, 0xB5B05284, 0xA50F7389, 0x39E37389,
+0x29A152E6, 0x94AD29A0, 0x42035AE6, 0x52A54A43, 0x210031A1, 0x840C5AC7, 0x4A244203, 0x6307C613,
+0x7BCA4203, 0x318173A9, 0x7BC96327, 0xB590842A, 0x4202A54F, 0x7BE87387, 0x9D2B8CAA, 0xA54D94AA,
+0x5B05B5EF, 0x9D4E7C4A, 0x848B5305, 0x63482140, 0x31E173E9, 0x9D4E6367, 0x7C6A3A62, 0x73C77C49,
+0xA54E6B87, 0x52C552E5, 0xB5F28C8C, 0x63674243, 0x4243ADB0, 0x840B73CA, 0x7C0A31A1, 0x73E952C4,
+0x9CED844A, 0x73C94AA4, 0x63475AC5, 0x6B866B86, 0x5B057C28, 0xCE73B5B0, 0x844AA56E, 0x52C5844A,
+0x94AB844A, 0x52C4D6D3, 0x846A4262, 0x9D6C7407, 0x5323952A, 0x8C8B7C29, 0x4A63ADB0, 0x94CB8C8A,
+0x73C86366, 0x63465B45, 0x8CCB6BC7, 0x3A4294EC, 0x740884AA, 0x532463A6, 0x7C498CCB, 0x5B859D6D,
+0x74486406, 0x5B6663C7, 0x428273E7, 0x6BA94AA4, 0x7C2A950D, 0x5AE67BEA, 0x848A846A, 0x52C56386,
+0x9CCD6326, 0xBDD04202, 0x9CEB5B25, 0x8429A56D, 0x5B0631C1, 0x73A873A8, 0x94EC844A, 0x63474223,
+0x8C8A8449, 0x6345ADAE, 0x6BA76345, 0x5B256365, 0x9CED6326, 0x7C097C09, 0x42644242, 0x4A8539E2,
+0x83EA6347, 0x840A6B47, 0x42434263, 0x3A034224, 0x73C86367, 0x636773E9, 0x73C85B05, 0x6BA85B25,
+0x9CCE6327, 0x6B884A64, 0x73AA52C5, 0x844B5B07, 0x4A8573C9, 0x214052A5, 0x8C6A4A63, 0x6BA76366,
+0x6B878449, 0x5AE66327, 0x6B26842A, 0x6B887388, 0x5B676368, 0x63A73A82, 0x5B464AE4, 0x5B469D4D,
+0x52845AE5, 0x846B6B87, 0x53056386, 0x63484263, 0x740A5B48, 0x53055305, 0x52A56367, 0xAD4F73E9,
+0x31A439C4, 0x31E339C4, 0x5B683A24, 0x21813A24, 0x31C329A2, 0x31C36349, 0x29A239E4, 0x4AC64A85,
+0x740A9D6F, 0x52E73A03, 0x422510C0, 0x296431A4, 0x4A672944, 0x39E56B4B, 0x73EB4225, 0x6BCA6BAA,
+0x42653A24, 0x420439C3, 0x62C662C7, 0x42034203, 0x31C252A6, 0x73AB5B08, 0x4A455286, 0x31A24A45,
+0x4A853A03, 0x73896307, 0x5AA64A24, 0x5AE67369, 0x4AC552E6, 0x21813223, 0x63AA4285, 0x6B6A2982,
+0x29407BEB, 0x94EE3A03, 0x636873CA, 0x5AE67BCA, 0x4223844C, 0x63064203, 0x8C4C8C4C, 0x4A2462C6,
+0x94AD2940, 0x6B484A23, 0x4A655285, 0x6B2841E4, 0x62E762E7, 0x83E9840A, 0x7BA9B570, 0x42047349,
+0x21805AE7, 0x42234A64, 0x5AE5842B, 0x52A54A64, 0x7BEB2940, 0x41E35266, 0x738941E3, 0x5AC68C4C,
+0x41E27BA9, 0x6326BDB1, 0x948CAD2F, 0x6B2683EA, 0x4A638C6C, 0x7BE752C4, 0x8C69A54C, 0xAD8E6B45,
+0x73E894CB, 0x63A8950D, 0x5B265305, 0x296152A6, 0x7C0A8C6D, 0x6BE852C4, 0x32217C49, 0x6387A5AF,
+0xCEB38C8B, 0x9CEC7C09, 0xDF36948C, 0x9D2E6367, 0x6368BE12, 0x18C05285, 0x52A47BCA, 0x63677C2A,
+0x8C4B52C5, 0x7C0A73E9, 0x6B887389, 0x84698C8B, 0x94CB73E7, 0xA52E73A8, 0x73C8B5D1, 0x73C88C4B,
+0x9D2D6326, 0x8C8A5AE5, 0x3A2152C4, 0x4AC29D4C, 0x53246BC6, 0x63476BA8, 0x7C0952C5, 0x94ABA52D,
+0x9CED7C09, 0x6B875B26, 0x73E8842A, 0x73E8844A, 0x52E473C7, 0x5B254A83, 0x84AA9D4D, 0x74277428,
+0x84EB5BA5, 0x63A84AE4, 0x3A41950C, 0x63684243, 0x63264AA4, 0x7BEAA50F, 0x94CB8429, 0x52E5B5D0,
+0x842A7BCA, 0x8C4A6B47, 0x84699CEB, 0x52A3AD4E, 0x7BE95AE5, 0x84099CCD, 0x6B879CCC, 0x528583EB,
+0x84297BE9, 0x9D0DA54E, 0x7C0A7C0A, 0x63468C6B, 0x9CEE7BA9, 0x73A88C4B, 0x6B685AC5, 0x63274A44,
+0x52847BA9, 0x5B266327, 0x31C252C6, 0x39E373CB, 0x63464A63, 0x6B887BEA, 0x52E54244, 0x6BA84222,
+0x7BEAAD4F, 0x94AD6327, 0x42243162, 0x5AE7840C, 0x42431900, 0x3A01844B, 0x8CAB52C4, 0x42226346,
+0x52A57388, 0x41E35265, 0x83EA7BCA, 0x73A983EA, 0x4AC552A5, 0x63A75305, 0x53454AC4, 0x63868D0C,
+0x63666326, 0x5B267C0A, 0x42A46367, 0x53064284, 0x42A45306, 0x5B464AC4, 0x4AA45B26, 0xBDD16327,
+0x39C42963, 0x3A242962, 0x428529C2, 0x29C229C1, 0x39E43A23, 0x31A33A04, 0x3A041920, 0x4AC64285,
+0x29816388, 0x52C74AA5, 0x4A4639E4, 0x29232963, 0x31842102, 0x4A6739E5, 0x5AE75AE7, 0x4AA64244,
+0x29823A44, 0x52664A45, 0x7BCA6B28, 0x4A6431A2, 0x4AC56368, 0x31A33A04, 0x42044224, 0x42036308,
+0x29A13A23, 0x73A95B06, 0x8C4D4A24, 0x6B685285, 0x3A446388, 0x32241961, 0x31E329E3, 0x4A8610E0,
+0x5AC64224, 0x4AC4C673, 0x4AA56387, 0x52A64AA5, 0x39E36327, 0x8C2C41E3, 0x73CA6348, 0x41A17B89,
+0x94CC7BC8, 0x94CC73A7, 0x73889CEC, 0x292141E3, 0x52655245, 0x73677387, 0x9CAD83EA, 0x52858C2B,
+0x6BA973E9, 0x63276347, 0x7BC96306, 0x63478C8C, 0x840B6307, 0x73894A23, 0x5AA55AE6, 0x528494CD,
+0xCE5339C1, 0x73A873C9, 0x73A9844B, 0x73884A63, 0x4A237388, 0xB5CF5B24, 0x94CBA56D, 0xA52D6B45,
+0x8CAB5B04, 0x4263848B, 0x4A844263, 0x420473A9, 0x8C4B6B68, 0x7C293A01, 0x42837C49, 0x9D4E6BE8,
+0x8C8C3201, 0x8449A52D, 0xB5F1ADAF, 0xBE328CCC, 0x94ED950D, 0x4A4431A1, 0x94CC5AE5, 0x73E86387,
+0x7BC818E0, 0x7C0A94CC, 0x8C4B7BC9, 0x5B034261, 0xA54D7C28, 0x9CAD5AE5, 0xAD6F52C5, 0x73A85B05,
+0x63469D0D, 0x52C44242, 0x73E873E8, 0x74078CCA, 0x5B255303, 0x5B264AC4, 0xA56E73C8, 0x5B05A54E,
+0xA52D846A, 0x6B676346, 0x8C6A6B87, 0x7C295B25, 0x5AE46BA6, 0x846B3A42, 0x74088CCB, 0xAE0F84AA,
+0x32416C07, 0x3A425325, 0x4AC44AE5, 0x7C0A4AC4, 0xA50E4AA4, 0x7388BDB0, 0x948B948A, 0x7C09C651,
+0x7BA89CED, 0x7BC79CEC, 0x844973C7, 0x83E894AB, 0x63067BE9, 0x83C8B58F, 0xA52EB5B0, 0x7BAA7BCA,
+0x62E66B68, 0x842B6B67, 0x4A6552C5, 0x42237BCA, 0x7368948D, 0x6B4883EA, 0x738973A9, 0x4A436B67,
+0x8C4B6306, 0x63263A22, 0x42444A84, 0x4A855B07, 0x6B472980, 0x73897388, 0x4A65840B, 0x7BC96B68,
+0x5AC5AD4F, 0x7BEB6B88, 0x4A4539C3, 0x52855AA7, 0x6B884264, 0x42225B26, 0x630673A8, 0x31A24263,
+0x62E862E7, 0x39A3840C, 0x62C75266, 0x42247389, 0x5B274A64, 0x63874AA4, 0x4AC34AC3, 0x84AA6BE7,
+0x846A6BA7, 0x53065B26, 0x4AE56387, 0x6BA85B26, 0x53056387, 0x4AE45325, 0x52E55B46, 0xC6526367,
+0x5AA739A4, 0x42644A65, 0x4AC64285, 0x4AE64AC5, 0x52C75B28, 0x18C03183, 0x5AE82982, 0x424529A3,
+0x52865B08, 0x4A656308, 0x39E45287, 0x39A43143, 0x294239A4, 0x39E44206, 0x422439C4, 0x298131A2,
+0x42045286, 0x52665266, 0x4A455A66, 0x52C66B48, 0x3A435B47, 0x634952E7, 0x31824245, 0x634852A6,
+0xA54F6B89, 0x4A64C632, 0x7BCA4203, 0x39E3842C, 0x42A652C6, 0x29C229A2, 0x21A231E3, 0x29821900,
+0x840A62E7, 0x84CBC6B3, 0x31E16367, 0x4A446327, 0x29614203, 0xA4EF4A24, 0x8C8C5B07, 0x6305944B,
+0xA54EC631, 0xC6316B87, 0x42436B67, 0x946D5285, 0x41E341A3, 0x6B4683E9, 0x6B079C6C, 0x52646B07,
+0x424294CD, 0x844B3A22, 0x846B6B67, 0x73C9E757, 0x73885285, 0x63067368, 0x5AC562C6, 0x8C6B9D0E,
+0x7BE931A1, 0x5AE573A8, 0x42226B68, 0x8C6B6B47, 0x7BC9842B, 0x8C896325, 0x8449B5AE, 0x8C8B8409,
+0x31E05AE5, 0x42028C8B, 0x5B068C4B, 0x41E32100, 0x7BC941E3, 0x52C3A52D, 0x63666345, 0xA56E6BA7,
+0x31E16327, 0xCE918C69, 0x63466B86, 0x7429BE52, 0xA58F3A23, 0x8C6B4A43, 0x6BA76306, 0x4A837C2A,
+0x84294202, 0x636773A7, 0x73A97368, 0x94EB52C4, 0x73C87C08, 0x6B6873A9, 0x8C6B4A63, 0x52A39CCD,
+0x94CB7BE8, 0x3A214242, 0x9D4D94CC, 0x8CCA6BA6, 0x8C8C6366, 0x52E65B27, 0x94CB844A, 0x7C296346,
+0x846A6B87, 0x8C6BADB0, 0x94AB9D0D, 0xA54D8C8B, 0x632594AB, 0x4AA3842A, 0x94EC94CC, 0x954C9D4D,
+0x3A417429, 0x5B464283, 0x52E52160, 0x7C2A6BA8, 0x94CC8C6B, 0xAD2DA50D, 0xA52D9CAC, 0x4A8294CC,
+0x52A48C6B, 0x9CEC8C4A, 0x6B467C08, 0xA4CC83E9, 0x5AA47BC9, 0xA4ED7B88, 0x8C4B7BC9, 0x7BAA9CAE,
+0x52657349, 0x6B6883EA, 0x52A66B48, 0x948DB591, 0x6B4883CA, 0xBDB1D674, 0x8C4C62A6, 0x5264944C,
+0x5AC57388, 0x52E54A83, 0x4A6531A1, 0x3A236B89, 0x842A4A64, 0x6307A4EE, 0x5AC762E8, 0x8C4B5AC6,
+0x840A7388, 0x52A55AC5, 0x526639C3, 0x52A662E8, 0x8CCC6348, 0x7C2A7BE9, 0x42227C0A, 0x39E34A85,
+0x39A341E4, 0x39A35246, 0x39A349E5, 0x736920C0, 0x5B076B48, 0x5B263A02, 0x5B456BC7, 0x84AA5B65,
+0x950C8CCB, 0x4AC44243, 0x42636BA8, 0x63876388, 0x42836387, 0x63875B66, 0x5B066BC9, 0x94CC52C5,
+0x738A31A2, 0x5B276BCA, 0x5B485307, 0x4AC65347, 0x6B694AC6, 0x31A431A3, 0x5B084AA7, 0x31C43A04,
+0x422531C3, 0x62E852A7, 0x294231A3, 0x42053183, 0x31832121, 0x39C439C4, 0x5AC82121, 0x42047C0C,
+0x4A464A46, 0x52675267, 0x4A2552A6, 0x39E331A3, 0x29A12981, 0x52E85B28, 0x21414265, 0x73AA1900,
+0x948D94EE, 0x6B4773C9, 0x52A54A64, 0x4AA629A1, 0x29C231E3, 0x19211921, 0x08E031E3, 0x42244AC6,
+0xAD6F4A23, 0x7C49C6B2, 0x294029A0, 0x4A426B26, 0x4A645B26, 0x8C2B4A24, 0x9CEC842A, 0x5283A52D,
+0x4A446326, 0xD6955265, 0x73886B88, 0xB571948C, 0x49E43982, 0x83EA6306, 0x52449C8C, 0x6B276B07,
+0x4A833A01, 0xBE324242, 0xBE52848B, 0x2140C672, 0x83EA39E1, 0x83CAA4EE, 0x4A4439A1, 0x9CED4243,
+0x6B474222, 0x846B6326, 0x3180844A, 0xB5B031C0, 0x840A9CCD, 0x84495B05, 0x8C6A7C49, 0x526352A4,
+0x7C098C8B, 0x52848C4B, 0x73888C4B, 0x948C4A43, 0x6B4752A5, 0x63257C08, 0x6B675AE4, 0x5B056346,
+0x73E99D4F, 0x7C077C08, 0x848A6365, 0x8CCC6BC8, 0xB6113A42, 0x7C0952E4, 0x63268C6B, 0x8CCC4AA4,
+0x6B8694CB, 0x6B878CAB, 0x73884A64, 0x846AC651, 0x6B876BA7, 0xC6136307, 0x8C8A5B25, 0x73E873C7,
+0x846A73E7, 0x63666BC7, 0x8CCB5B45, 0x7C4994EB, 0x52E67C29, 0x3A026388, 0x9D0C4AC4, 0x7C096BC8,
+0x8CAB8CAA, 0x63467409, 0xAD6FA52E, 0x632573A8, 0x5AE46B45, 0x846A6346, 0x52E373E8, 0x7C6963C6,
+0x7C485B44, 0x848A8489, 0x52C45305, 0x846A4AC4, 0x94AB4282, 0x84099CCC, 0x5AC55AC5, 0x7C2973C8,
+0x7C09844A, 0x8C8A73C7, 0x7BE97BE8, 0x6B079CCD, 0x7368A4EE, 0xB52E7B67, 0x948C6B46, 0x8C4C9CCE,
+0x6B487BCB, 0x52855264, 0x42036307, 0xBDF294AD, 0x9CCF738A, 0xA4CF62C7, 0x396262A7, 0x73285A86,
+0x5AA583EA, 0x6B676347, 0x7BCA52A5, 0x31A15B07, 0x6B474A63, 0xCE348C4B, 0x5AC64A65, 0x52846B68,
+0x6326948B, 0x73A96367, 0x528639C2, 0x5AC631A2, 0x7C2A6BA8, 0x7C0A5305, 0x632752C4, 0x3A0352C5,
+0x316341C4, 0x39C43182, 0x41C42921, 0x948D18A0, 0x7C2B6B68, 0x426352C6, 0x9D4C6BA6, 0x7C495345,
+0x8CCB8CCA, 0x42A45B46, 0x5B2663A7, 0x5B2663A7, 0x5B4752E5, 0x52E55B67, 0x42433A43, 0x7C2A4AA4,
+0x73EA5AE7, 0x52E6844C, 0x4AC63A44, 0x21814285, 0x42654AA6, 0x39E43A04, 0x3A054A46, 0x31A42963,
+0x420541E5, 0x39C43163, 0x29622962, 0x31A339C3, 0x42254A46, 0x42054225, 0x39A439A3, 0x29623183,
+0x52873183, 0x29634206, 0x318239C3, 0x29412121, 0x42245285, 0x5AE86329, 0x42446349, 0x29A131C2,
+0x52855285, 0x7C2B6328, 0x31E26B68, 0x29C22161, 0x428629C3, 0x11003205, 0x29C21920, 0x216094EE,
+0x9CCD39C2, 0x3A21ADD0, 0x41E32940, 0x9CAB7367, 0x5B0673C9, 0x8C0B49E3, 0x6B468C0A, 0x6B666B66,
+0x528652A5, 0x8C4D5245, 0x42435285, 0x62E6946C, 0x6B284A25, 0x630662E6, 0x49E27B89, 0x73A97369,
+0x42626B67, 0x9D2E844B, 0x42635B05, 0x21403A02, 0x73886306, 0x73489C6C, 0x6B275264, 0x7C2A842A,
+0x842A73A9, 0x7C2A6B67, 0xB5AF8C8B, 0x9CCD4A63, 0x94AC8C2B, 0x9D2D6B87, 0x8C8A6325, 0x7368A4EE,
+0x7BC8840A, 0x9CAD83EA, 0x630662E6, 0x842AAD6F, 0x73C89D0E, 0x84498429, 0x73A86306, 0x42426346,
+0x846B6347, 0x6B866B87, 0x6BC84A62, 0x848B740A, 0xA58F5B46, 0x6BA74A83, 0xA56F52E5, 0x5B2694CD,
+0x6BC7AD8F, 0x94EC7C49, 0x5AE56326, 0x3A21A54E, 0x63668C8B, 0x63276B88, 0x848A7C09, 0x63868C8A,
+0x63A66366, 0x74294AA3, 0x7C6973C7, 0xC6926BC7, 0x4AA4848B, 0x21605B27, 0x84AB8CCC, 0x8C8B5B26,
+0x3A019D2E, 0xC6726BA7, 0xB5AF8429, 0x6346844A, 0x63058C2A, 0x3A014242, 0x73E79D4D, 0x6C073A21,
+0x5B245304, 0x6B86A56D, 0x4A834A83, 0x4242844A, 0x7C096B87, 0x948B6B46, 0x7BA88C2A, 0x42219CCD,
+0x5B056326, 0x7C2973C8, 0x5AA5AD6F, 0x62865245, 0x62C683AA, 0x6AE59C6C, 0x4A4483EA, 0x4A4562E7,
+0x6B0883CB, 0x52647369, 0x4A246B28, 0x948DA4EF, 0x41E4840C, 0x9C8E5A66, 0x6AE96AC9, 0x6B085A26,
+0x5AA649C3, 0x840B7389, 0x5AE76308, 0x5B076B6A, 0xA52D4A63, 0xCE335A85, 0x52A55285, 0x73A77BEA,
+0x7C097BC8, 0x740A52A4, 0x4A6452C5, 0x63484A44, 0x846B52E6, 0x426352E5, 0x5B0673C9, 0x4A8552A5,
+0x4A0539A3, 0x4A2518A0, 0x20E04A05, 0x83EB946D, 0x5AE75285, 0x4A435AE7, 0x7C487BE8, 0x63A763A7,
+0x740884AB, 0x3A83742A, 0x4AC44AC4, 0x3A026347, 0x52C55B07, 0x53064264, 0x3A4452C6, 0x52E552E6,
+0x5B275B26, 0x3A035B27, 0x5B0831E3, 0x320429A2, 0x31E45B49, 0x3A044265, 0x29432983, 0x296318E1,
+0x31832943, 0x630939C4, 0x318231A3, 0x6B6931C3, 0x21416328, 0x4A6631A3, 0x41E52121, 0x292239A4,
+0x29622142, 0x39E43204, 0x31A33A24, 0x41E42941, 0x7BAB7B8A, 0x6B8A39C3, 0x6B89AD91, 0x4A444243,
+0x4A443A03, 0x52C64A64, 0x42445B06, 0x3A453A24, 0x5B294AC7, 0x10E021A3, 0x6BAA3A45, 0x29816BEA,
+0x6B2852A6, 0x4A854244, 0x62C74204, 0x4A035A85, 0x42046B28, 0x8BCA5A65, 0x31817368, 0x94AD94AD,
+0x52866B69, 0x73695AC6, 0x31824A44, 0x62E78C2C, 0x52445A86, 0x6B465284, 0x52645243, 0x83EA6B48,
+0x4A8452A4, 0x52E58CCC, 0xADB1A590, 0x6B883202, 0xAD0F5264, 0xACEE942B, 0x7B8962C6, 0x424394CD,
+0x7BEA73A8, 0x6B871900, 0x8CAB7C29, 0x73886B67, 0x9CCD2940, 0x63477C09, 0x632673C8, 0xB5905284,
+0x63065AE5, 0x8C2B7BC9, 0xC6326306, 0x7408B610, 0x73C73200, 0x8C698469, 0x62E64A83, 0x73C86B67,
+0x8CAC4AA4, 0x5B467409, 0x42834262, 0x53066BC9, 0x846A4283, 0x42428CAB, 0x9D0E4A84, 0x4AC5740A,
+0x94EC5B46, 0x848A7C69, 0x6BA7846A, 0x73C77C08, 0x5B04848A, 0x846B5B26, 0x6BC784AA, 0x848B6BE8,
+0x3A427408, 0x63A67408, 0x848A6BE7, 0x84AB6386, 0x950E3201, 0x5B4773EA, 0x42626BC8, 0x42834283,
+0x4AC54283, 0xA56E6BC7, 0xA50D948A, 0x6B67948B, 0x7368946C, 0x94ED4A63, 0x73E8846A, 0x63C75B85,
+0x8CAB5B24, 0x6B889D0D, 0xDEF53A01, 0x42636347, 0x52C46BA7, 0x8C4B842A, 0x840973A7, 0x42227387,
+0x8CCC846A, 0x52A46366, 0x6B4931A2, 0x5A2649E4, 0xA4AE6AC7, 0x6AE68389, 0x5A85840B, 0x52446306,
+0x5A6662A6, 0x63085245, 0x52866B28, 0x62E7B591, 0x738A5265, 0x734941E3, 0x418341A3, 0x5A475A47,
+0x49E47B29, 0x63085AA7, 0x5A8739A3, 0x42035286, 0xBDF052C3, 0xB59139A1, 0x634739E2, 0x6B868C8A,
+0x7C2A4AA3, 0x5B266BA8, 0x52A44AA4, 0x52E65B26, 0x6BA95306, 0x4AA529A1, 0x4AA56368, 0x6BA85B06,
+0x63074203, 0x298131A2, 0x5AC74245, 0x62E683EA, 0x52A54A84, 0x42026327, 0x63658429, 0x53254AE4,
+0x52E57C4A, 0x5B6684AB, 0x53254B04, 0x42443A22, 0x21615AE7, 0x636829A1, 0x4A854265, 0x4A854284,
+0x3A434284, 0x52C652C6, 0x4A864A86, 0x424531C4, 0x42863A25, 0x3A254AA6, 0x212331A4, 0x39A42943,
+0x31A42943, 0x52874A67, 0x29824A66, 0x42445AE7, 0x73EB6B69, 0x4A455AE7, 0x29223163, 0x39A43144,
+0x31E35AE8, 0x4AC75B29, 0x39C36B6A, 0x5A864A25, 0x398262A7, 0x39C33983, 0xC633B591, 0x6B889D2E,
+0x29405285, 0x63484A65, 0x636852A5, 0x29A273CA, 0x29A431E4, 0x29832142, 0x218231E4, 0x5B074264,
+0x62E839C3, 0x39E339E4, 0x7BCB4205, 0x940C7B6A, 0x49E483AC, 0x62C662A6, 0x946D7369, 0xA5305AA6,
+0x42237BCA, 0x63075245, 0x63085286, 0x62E85AA7, 0x528562A7, 0x6B46840A, 0x62E762A6, 0xA50E62C6,
+0x7C0A6B68, 0x5306A54F, 0x5B47ADB1, 0x31E26B89, 0x9CAD5264, 0xBD708389, 0x948C7B69, 0x31E15B07,
+0x52A56B47, 0x73E85B26, 0x950C6BA7, 0x42027367, 0x7BC93160, 0x4A845AC5, 0x842A5AE5, 0x63063160,
+0x7BC831A1, 0x62E683CA, 0xBE115285, 0x42A2BE31, 0xADCE6BC7, 0x94EBBE50, 0x6B68A52E, 0x9D0D840A,
+0x5AE57C0A, 0x8CAC94ED, 0x63877C2A, 0x846C844B, 0x8CAA6BA8, 0x42428CAB, 0xA5506368, 0x31E16348,
+0xA5AF6BC9, 0x6BE7A5CE, 0x4A628C8B, 0x8CCA4A82, 0x6BA78CCB, 0x5B4673C8, 0x63A67408, 0x3A426BC8,
+0x74295B26, 0x8489848A, 0x6BE7846A, 0x4AC35B25, 0xBE527C2A, 0x5B47848C, 0x4AC46387, 0x530552E5,
+0x4AA46388, 0x950C846A, 0x9CECAD4D, 0x9CCC8409, 0x52649C8D, 0xA58F7BEA, 0x636694CC, 0x5B6584AA,
+0x3A226BA7, 0x9CEE7BA9, 0x73A87BA8, 0x94CDA52F, 0x6B8794EC, 0x63267BC9, 0x8C49B56F, 0x6B677388,
+0x4AA394EC, 0x4AA46B87, 0x63095AC7, 0x52067B4B, 0x5A454183, 0x62A66286, 0x83EB7B8A, 0x62E662C6,
+0x62C77B69, 0x63088C2D, 0xA4EF7BAB, 0x948D6B08, 0xA4EF9CCE, 0xA4CF3141, 0x49E472E9, 0x39435A47,
+0x5A455A05, 0x5AA741A4, 0x5AA75A67, 0x4A445AC7, 0x8C4994AB, 0x83EB5264, 0x5B066B69, 0x846952E4,
+0x73C86B87, 0x52E47C2A, 0x4AA352E4, 0x42636347, 0x32025B27, 0x5B4731E2, 0x4A845AE7, 0x846B6367,
+0x6B486B48, 0x3A236B68, 0x42244A65, 0x5AE56B27, 0x73A94203, 0x7BA95285, 0x7BE7948B, 0x42A46366,
+0x5B677409, 0x63A75305, 0x4AE44B04, 0x634829A1, 0x31C35AE8, 0x42853A24, 0x3A034AA6, 0x4AA53A24,
+0x0001FF1F, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFE41B4, 0x0004FFFF, 0xFFFFF743, 0x400004FE, 0xFFFFF7FF,
+0xDF170004, 0x240128BC, 0x002C0000, 0x00001C00, 0x08000018, 0x00040400, 0x0F001004, 0x00210008,
+0x040F0034, 0x84000800, 0x007C0500, 0x0B008000, 0x20000004, 0x00040F00, 0x00BB0F69, 0x001B0208,
+0x00012400, 0x080F000A, 0x1C000500, 0x00040F00, 0x00E0040C, 0x00010805, 0xF730004C, 0x0018FFFF,
+0x0C003B0F, 0xA1001F0F, 0x0F00DE00, 0x0F1100B8, 0x0F150028, 0x0F11004C, 0x19FF0024, 0x00028600,
+0x330F041E, 0x4400B301, 0x00040803, 0x0000D600, 0x08000508, 0x00040400, 0x08002008, 0x2000000C,
+0x010E0000, 0x2E00040F, 0x00057800, 0x080F04D8, 0x64000000, 0x016E0500, 0x0702F204, 0x7C0F0008,
+0x400F0D00, 0x200F0D00, 0x60010D00, 0x00980F00, 0x00180900, 0x0F00BC00, 0x01440004, 0xF00000FC,
+0x00040000, 0x03006404, 0x8C0004FC, 0x00C00101, 0xAE00050F, 0x0000CA00, 0xC90F0004, 0x30041900,
+0x018A0100, 0x0F011A04, 0x0F3C0008, 0x0F190090, 0x0145002C, 0x820F00E0, 0xF00F0502, 0x6C013C00,
+0x00540700, 0x0300D401, 0x0C01027A, 0x00050F00, 0x00DE03BF, 0x0C024E00, 0x0E000004, 0x03800101,
+0x0C00F607, 0x100F0024, 0x7B004D00, 0x00640F00, 0x00200F09, 0x00240011, 0x4500040F, 0x09009C0F,
+0x31001C0F, 0x00018400, 0x88000048, 0x00080001, 0x00000400, 0x180000CC, 0x06A80100, 0x0001C003,
+0x040F0014, 0xC207A400, 0x00DE0000, 0x0F000400, 0x0FA400CA, 0x0DCE00B7, 0xBC07019C, 0x00FD0F01,
+0x034400A3, 0x00000404, 0xE20000C2, 0x00040400, 0x0100100F, 0x08037804, 0x9C000034, 0x002C0003,
+0x0600080F, 0x0F001D01, 0x04430005, 0x080F00AC, 0x960F2500, 0x560F4300, 0x70013700, 0x07920301,
+0x04005600, 0x180100E8, 0x027E0F00, 0x00D200AE, 0x2200CA0F, 0x0400FA04, 0x49000008, 0x00040F00,
+0xA00145FF, 0x015C0701, 0x07028204, 0x0B0F0013, 0xDE13A800, 0xD004035C, 0x00080004, 0x0256DE10,
+0x02FFF720, 0x00DA0500, 0x0014DF10, 0x04000E00, 0x0C000008, 0xFFFF3100, 0x03002CFF, 0x070C000C,
+0x012A0000, 0x0C00140C, 0x70000010, 0x00140100, 0x0B005804, 0x7E040008, 0x00080F01, 0x00FC0041,
+0x0F007C01, 0x00080005, 0x040F00C4, 0xF40F0900, 0xC8040605, 0x005C0F00, 0x001B0108, 0x0F002804,
+0x00040008, 0xFC0100A4, 0x6CF71600, 0x00900401, 0x01001800, 0x050F0044, 0xCE00AA00, 0x00C10100,
+0x01010204, 0x0502000D, 0x025E0C00, 0x1F028605, 0x5714FEFF, 0xB301660F, 0x0F015002, 0x0C290006,
+0x4C0F018C, 0x3C0F2900, 0xDF207700, 0x020002FF, 0x8C000090, 0xFFFE4004, 0x0374FFFE, 0xDFFFDE31,
+0x10000008, 0x00180100, 0x00029E00, 0x2B020004, 0x177C0100, 0x0002BA00, 0x2001002C, 0x05480000,
+0x0410A600, 0x10030004, 0x002F0100, 0x00003804, 0x20030008, 0x00180400, 0x0F025E00, 0x04090004,
+0x080F0028, 0x1D010A00, 0x00050F00, 0x03520123, 0x00009800, 0x080F003F, 0x1C000500, 0x00040F00,
+0x01080008, 0x0500040F, 0x0F003701, 0x00050058, 0x2800010C, 0x00040F01, 0x05600108, 0x00068A03,
+0x2C000282, 0x00140301, 0x0F005B01, 0x00AF0005, 0xC60C013A, 0x02560000, 0x00001405, 0x0200013E,
+0x00040001, 0x0796EF11, 0x0F000A00, 0x045B0004, 0x080F0078, 0x8E0F0500, 0x6E0F5B00, 0xD0043700,
+0x00520F00, 0x00200005, 0x00000400, 0xEE0F0184, 0xB0050C08, 0x00090F01, 0x00DA009B, 0x00000403,
+0x7A00035C, 0x02920002, 0xDFFFDF32, 0x0AF00114, 0xFFEFFFEF, 0x9BD77FE7, 0x97A61AB6, 0xD585368D,
+0xD574F574, 0xD574D56C, 0x0000086C, 0xD58A0004, 0xD674B574, 0x0874B574, 0x74D54F00, 0x000474D6,
+0x74F68F03, 0x7CF674D5, 0x000874D5, 0x74F58403, 0x74F67CF6, 0x00087CF6, 0x1674F680, 0x1674F675,
+0x8F00047D, 0x7D177516, 0x7D167516, 0x53030008, 0x7D167D17, 0x00001C37, 0x37130028, 0x361A0010,
+0x24000008, 0x00040700, 0x377D3631, 0x08040002, 0x000E0200, 0x8C000606, 0x7D577D36, 0x7D577D37,
+0x57210008, 0x4500027D, 0x577D3785, 0x57B60004, 0x5785577D, 0x5785787D, 0x00087885, 0x10588522,
+0x00140000, 0x0200040F, 0x00207713, 0x4A000802, 0x85788577, 0x77820004, 0xBC85368D, 0x00EFDFBE,
+0x066C000A, 0x0001A000, 0x08000504, 0x00040000, 0x9B02710F, 0x0000AE0D, 0x1500027E, 0x00080300,
+0x0008BE12, 0xFFF707F0, 0x7FF7FFEF, 0xD5A5FAD7, 0x125C1274, 0x1364345C, 0x755C3454, 0x54730002,
+0x54755C75, 0x00045495, 0x54755C4E, 0x61000476, 0x955C965C, 0x0002965C, 0x02000804, 0x0604000E,
+0x5CB64200, 0x00045C96, 0x00089517, 0xB65CB648, 0x0000105C, 0x10000024, 0x00180000, 0xB65CB647,
+0x00000864, 0x0407000C, 0x64D64C00, 0x00045CB6, 0x0014D71F, 0x64D68400, 0x64D75CD6, 0x000464D6,
+0xD664F746, 0x13000464, 0x21000CD7, 0x000264F7, 0x00066C11, 0x52000C02, 0x1764F764, 0x1500046D,
+0x4C000818, 0x6D186517, 0xF72B0004, 0x43001464, 0x176D186D, 0x18150004, 0x38D10008, 0x386D186D,
+0x386D1875, 0x386D176D, 0x37110002, 0x38240006, 0x4000086D, 0x75586D38, 0x16800004, 0x7375166D,
+0x72E79F6C, 0x04220002, 0x00000400, 0x040001AF, 0x027E0F00, 0x087C0BB0, 0x0100D600, 0x0FF10764,
+0x32A61AE7, 0x1253D15C, 0x335C3454, 0x545C5454, 0x555C7554, 0x554C3554, 0x354C554C, 0x0008564C,
+0x51000C00, 0x4C764C55, 0x02001055, 0x75110008, 0x76240010, 0x6000084C, 0x4C764C76, 0x00064C56,
+0x06547621, 0x000C0200, 0x4C764C50, 0x00045496, 0x08549626, 0x000C0000, 0xB6549642, 0xBF000454,
+0x54965CB7, 0x5CB65CB7, 0x04965CB7, 0x18000000, 0x5CB66000, 0x5CB65CD7, 0xD7120266, 0x5A000256,
+0x00040502, 0xD664F761, 0x5264F75C, 0x625C1302, 0x00080F02, 0x00140001, 0x00003401, 0x48000030,
+0x00080A00, 0x025CD72F, 0xD8420D00, 0x2454D75C, 0x08B71100, 0x5CF89300, 0x5CD85CD7, 0x18F85CD7,
+0x00100400, 0x00002800, 0x08080018, 0x00380200, 0x0200060C, 0xD7220048, 0x8300085C, 0x6D376517,
+0xCF1D74B5, 0x86000500, 0x01A50007, 0x00042602, 0x040F000A, 0x5400B000, 0x00040003, 0xF0027A01,
+0xE7DFEF0C, 0x53B18536, 0x54534BD1, 0x54754C33, 0x4C144C34, 0x43D443F3, 0x3BD43BB3, 0xD4210004,
+0xA100023B, 0xD43BD443, 0xF53BD443, 0x0004F43B, 0x15441540, 0x1300043C, 0xA0000835, 0x44354436,
+0x3C354436, 0x00024456, 0x00063611, 0x40000A00, 0x44564476, 0x77400004, 0x0444764C, 0x54974800,
+0x00044C96, 0x9754B753, 0x0002B754, 0x8254D720, 0x5CB72001, 0xBA010002, 0xD7644501, 0x0004F85C,
+0x0264F820, 0x6518A200, 0x651864F8, 0x6D186518, 0x38400004, 0x0465186D, 0x6D394000, 0x00046D38,
+0x386D5984, 0x386D586D, 0x0000086D, 0x39310014, 0x0024386D, 0x01003404, 0x654104B0, 0x041864F7,
+0x00500000, 0xF85CF740, 0x00000464, 0xD8510070, 0xB75CD85C, 0xB7A00004, 0xB854B75C, 0xB754B75C,
+0x0500A45C, 0xC0060004, 0x764C3000, 0x2000D44C, 0x00EA4C76, 0x40000400, 0x44564435, 0x080000FC,
+0x3C352001, 0x04020110, 0x3C153000, 0x92012836, 0x153BF53C, 0x153BF444, 0x4001443C, 0x3BD43BF4,
+0x05F10004, 0x33D33BD4, 0x33B43BD4, 0x33B33BB4, 0x653833B3, 0x6C946CD6, 0x6A0A019A, 0x02820F02,
+0x125803B3, 0x010D5C00, 0x07F100E4, 0x708536E7, 0xF34BD243, 0x134C144B, 0xB23BD344, 0xB33BB333,
+0x0004D333, 0x1A3BD322, 0x01260401, 0x00013602, 0x42000282, 0x3C152201, 0x35260002, 0x91016A3C,
+0x3C564456, 0x3C363C57, 0x11000857, 0x45000856, 0x44764477, 0x4CC00004, 0x4C974476, 0x4C974C76,
+0x02974C96, 0x97544600, 0x0004B74C, 0x82B85420, 0x00040102, 0x8254D720, 0x044C0002, 0x21000405,
+0x0226F864, 0xF7651842, 0x0000045C, 0x1833023A, 0x028E3865, 0x0006D602, 0x0A01028E, 0x02720100,
+0x027A3811, 0x01027E02, 0x65200028, 0x12002E17, 0x02004065, 0x7A020048, 0x5CF73202, 0x0004C4F7,
+0x544104CC, 0x04B75CD8, 0x031A0200, 0x01027A01, 0x971000A8, 0xB80000AC, 0x00C40100, 0x974C7733,
+0x77800356, 0x7744564C, 0x043C5644, 0x3C572200, 0x56910104, 0x563C363C, 0x363C3544, 0x15300002,
+0x0128363C, 0x02013403, 0xF5A00140, 0xD43C153B, 0xF43BF533, 0x00000833, 0xB3A00166, 0x17445533,
+0x3A647465, 0x04077EAE, 0x2A0010AA, 0x00040004, 0x0F028F0A, 0xF0AE000E, 0xF7FFF702, 0x5390AE5A,
+0x4BF34391, 0x44144413, 0x02763BD3, 0xB33BD461, 0x7A3BD433, 0x039C0402, 0xF4F43B21, 0xB8D41104,
+0x013A0103, 0x1203CC00, 0x0203D444, 0x362003E0, 0x01016E3C, 0x7A000276, 0x57448002, 0x573C773C,
+0x0008773C, 0x3C774494, 0x44774478, 0x00044C97, 0x984C9731, 0x974001C2, 0x0454B84C, 0x4CB72000,
+0xEA000276, 0x00080001, 0xD754D841, 0x53000454, 0xF854D85C, 0x0000025C, 0x5C550504, 0x65185CF8,
+0x04010004, 0xFC191105, 0x65383004, 0x03095C39, 0xF0030500, 0x05000104, 0x10000C03, 0x02050065,
+0x3A010004, 0x02820305, 0x185D1840, 0x00000465, 0x680002D6, 0x6EF71300, 0x54D84000, 0x00045CD8,
+0x31028202, 0x16B754D8, 0x54B82003, 0x974200A8, 0x044CB84C, 0x033E0100, 0xA200C801, 0x4C984477,
+0x44774477, 0x00043C77, 0x0200F802, 0x5713010C, 0x8402038E, 0x01240002, 0x153C3651, 0x0286163C,
+0x083BF524, 0x01540000, 0x3BF501F0, 0x3BF433D4, 0x54B733B3, 0x645364B6, 0x077EE79F, 0x0F09EE06,
+0x0C97027E, 0xC40000AA, 0x00040400, 0x10033200, 0x0013CAFE, 0x05F10EEA, 0xF1EFFFEF, 0x90434F63,
+0xD24BF343, 0x923BB243, 0x923BB23B, 0x820804F8, 0x028A0002, 0x011AF411, 0x00077A04, 0x040003B4,
+0x04FC0200, 0x03DC1611, 0x01000602, 0xFC0304F8, 0x01780003, 0x563C7733, 0x9A010286, 0x97442001,
+0x442301A4, 0x42028A97, 0x4CB74C97, 0x86020004, 0x4C974002, 0x000454D8, 0xF254B720, 0x02820201,
+0x01095803, 0xAC04027E, 0x02820004, 0x02000C00, 0x500004FC, 0x86391102, 0x04F80002, 0x02000400,
+0x7A03077E, 0x9A6D1202, 0x00180007, 0x04000403, 0xC601027C, 0x00480007, 0x01000402, 0x00010504,
+0x028A0005, 0x01030203, 0x90010588, 0xB74C4100, 0x0500B754, 0x3400B403, 0xC84C9744, 0xD8771300,
+0x02820000, 0x22037600, 0x00F83C77, 0x02050402, 0x7E020114, 0x3C364002, 0x027E3436, 0x07863610,
+0x20000403, 0x00023BF5, 0x0003E000, 0xD4A10004, 0xB644143B, 0x155C755C, 0x00069A85, 0xB3001092,
+0x2EB00101, 0x0010A800, 0x11010514, 0x00050F00, 0xFFF7E1AD, 0x4FCF1EEF, 0x91437143, 0x914BD343,
+0xD382027C, 0xB33BB243, 0xF433B23B, 0x05000009, 0x0109F601, 0xA40004FC, 0x07760008, 0x11012C00,
+0x02013A15, 0x365103C4, 0x373C163C, 0x36240282, 0x0006763C, 0x7E0004F4, 0x10781002, 0x7A3C1104,
+0x983C3202, 0x00042444, 0xFC000504, 0x00040004, 0x61044804, 0x4CB84CB8, 0x000454B8, 0x54B85443,
+0x0004FCB8, 0xD871047C, 0xD85CF85C, 0x0776F85C, 0x00099800, 0x2E0009FE, 0x027A0602, 0x42025E00,
+0x6D186D19, 0x76010282, 0x04F80107, 0x2209FC00, 0x0A047559, 0x00028A04, 0x30000008, 0x002C0000,
+0x0202B600, 0x4C000A48, 0x00580000, 0x01050403, 0x820302EA, 0x865C1002, 0x027E0002, 0x0500D710,
+0x82D84C23, 0x4CB83502, 0x310504B7, 0xFC974C98, 0x00E00104, 0x00035E01, 0x820004FC, 0x00080002,
+0x00010600, 0x04000286, 0x01200000, 0x00028603, 0x0000063C, 0x00080005, 0x0A104412, 0x10015C01,
+0xA2078043, 0x5C754C55, 0xCF3E53F2, 0x0263EFFF, 0x03172E01, 0x12020E32, 0x00060F00, 0x0500058D,
+0x000AAE03, 0x3C0004FC, 0x00180003, 0x01000400, 0xEFD009F8, 0x32EEAE5A, 0x3B714351, 0x33923BB3,
+0xD32004FA, 0x20000843, 0x09FC3BB3, 0x03000400, 0x8A000504, 0xD4332207, 0x33210500, 0x8108A8F4,
+0x3BF533F4, 0x3C153415, 0x3C520004, 0x34153C36, 0x364003D8, 0x043C5734, 0x016E0000, 0x00000404,
+0x04000410, 0x041C0005, 0x06000403, 0x44000786, 0x01CA0104, 0x00045400, 0xE20004FC, 0x01E60006,
+0x00050002, 0x00030282, 0x04980005, 0x01021A00, 0x82010C22, 0x0A000302, 0x1309FC00, 0x2209E817,
+0x02806537, 0x00000602, 0x04000C82, 0x0A000300, 0x00050801, 0x8201027E, 0x04FC020C, 0x010C7E00,
+0xFC010A50, 0x6C641504, 0xF7542300, 0x0E00027A, 0x04F8000D, 0x027AD711, 0x00050009, 0xC8030778,
+0x05000505, 0x01086E02, 0xF40005F4, 0x01040400, 0x02027602, 0x0C00077A, 0x3C153000, 0x18027E35,
+0x000C863C, 0xFE0004FC, 0x3BD38008, 0x54335455, 0x130A5C12, 0x0304EC05, 0xC40001C8, 0x027C0F01,
+0x00A00F8D, 0x027A0007, 0x00001E01, 0xEF9100CE, 0x32AD9D77, 0x33513B30, 0x3320027E, 0x00028692,
+0x000F027A, 0x7A04040A, 0x01320007, 0x02050200, 0xBC00077E, 0x01500008, 0x02000404, 0x76030500,
+0x09F80001, 0x020A0001, 0x97200500, 0x050C7644, 0x44100A00, 0x04000500, 0x044C0200, 0x05095800,
+0x7E020964, 0x09800107, 0x000E8800, 0xFC000500, 0x00040004, 0x040EA000, 0xC202027E, 0x02520004,
+0x01000403, 0xF800134C, 0x02760004, 0x58755942, 0x0600046D, 0x9802078E, 0x0F340202, 0x00028602,
+0xFC000044, 0x00580204, 0x020F6802, 0x4A0004FC, 0x11360111, 0x05005410, 0x00000402, 0x2A04028A,
+0x54982208, 0xC4000AC4, 0x09FC0100, 0x44774C30, 0xFC000AE4, 0x0A040205, 0x02050400, 0x7A000C8E,
+0x0A0C0002, 0x13000800, 0x050C8256, 0x44160282, 0xF4C20DD2, 0x143BD33B, 0xD2545444, 0x7EA5F953,
+0x01B00107, 0x9E00050F, 0x03026A05, 0x000900BA, 0x09F80105, 0x7E8D5620, 0x3350D002, 0x33923B92,
+0x3BB23BB3, 0x829243B3, 0x0EF80107, 0x7E33D420, 0x0004040C, 0x04FCD417, 0x00028601, 0x86030DAC,
+0x03C8020C, 0x0008D002, 0x82020DDC, 0x0166010C, 0x000C4410, 0x00017E02, 0xFA030E10, 0x117E0104,
+0x09387711, 0x02028E00, 0xFC0009FC, 0x0F000204, 0x06E2B710, 0x01027E02, 0x020001F6, 0x0282070C,
+0x027A5C10, 0x03022A02, 0x82010C86, 0x0ED4000C, 0x0104E403, 0x66000C66, 0x076A0002, 0x00028A00,
+0x0C000004, 0x0C7A0000, 0x0502A603, 0x7E0209FE, 0x00500607, 0x00050401, 0xF2000568, 0x05000007,
+0x000F0007, 0x7E000594, 0x00A80002, 0x200C7600, 0x0EF84CB7, 0x00000A00, 0x560000C8, 0x0FE00003,
+0x0000E600, 0x76110FF0, 0x04000F04, 0x010C020A, 0x02101C06, 0x1000012C, 0x063C020F, 0x000C7602,
+0x04010282, 0xF43BA10F, 0xF343F343, 0xDF4B704B, 0xF000167A, 0x06AC0104, 0x0C01C803, 0x170301D8,
+0x00070F00, 0xD9F7839D, 0x2F2A6CA5, 0x027E303B, 0x05049310, 0x86B23B20, 0x0EF80002, 0x2BB33330,
+0x04080C72, 0x09FC0A0A, 0x00050402, 0x040013F8, 0x03C80000, 0x100F0001, 0x4312F03C, 0x44563C56,
+0x8A03117A, 0x027E0410, 0x56449730, 0x04031176, 0x01BA0000, 0x00027E08, 0x000806DA, 0x027A0105,
+0x09FC5411, 0x01020E00, 0x76000A00, 0x09AC010C, 0x010F0400, 0xBE00027A, 0x027E0404, 0x046D5920,
+0x6538240F, 0x59710272, 0x596D596D, 0x0A0C3975, 0x04028204, 0x00060286, 0x0042000A, 0x01005806,
+0x5C520A68, 0x64F95CF8, 0x040802F6, 0x0F98000F, 0x00000400, 0x04000282, 0x11860000, 0x0000C602,
+0xD8030006, 0x0A000114, 0x03037600, 0x08010282, 0x18561110, 0x01180010, 0x00000400, 0x86031404,
+0x40341011, 0x09F80006, 0x54441520, 0x07820006, 0x143BF380, 0xB443B14C, 0x0404FE7C, 0x5F0F09F8,
+0xDC029D02, 0x00B6013B, 0x01076A00, 0xDE12173C, 0x00F00D40, 0xDFF7FFF7, 0x6CC6DCEF, 0x1032CE2A,
+0xF43B7133, 0x05000004, 0x0109F800, 0x33100782, 0xB42214FC, 0x0213FC33, 0x12020A00, 0x0A000210,
+0x0A00F410, 0x1004FC00, 0x00013033, 0x7E010EFE, 0xFC3C1B02, 0x0F000104, 0x00090000, 0x040009FC,
+0x01920000, 0x000B8E00, 0x77310420, 0x0A007744, 0x210E3C00, 0x04FC4497, 0x000F0403, 0x820001D6,
+0x046C0011, 0x000A0002, 0x04000BFE, 0x07120114, 0x5CF85C30, 0x0402111E, 0x13BC0205, 0x00113A00,
+0x04030A00, 0x0F040000, 0x13E86510, 0x01000401, 0x1808027A, 0x02760005, 0x0502AE01, 0x4C000502,
+0x00440000, 0x04005800, 0xD7100064, 0x7E0502F6, 0x00900011, 0x02027600, 0x32020004, 0x02700003,
+0x0000B800, 0x04020008, 0x04FC0400, 0x01027603, 0xF8020A00, 0x08920000, 0x00050401, 0x3C411408,
+0x04363435, 0x3415A000, 0x34153C35, 0x33F53416, 0x76000DCA, 0xF501F011, 0xF533F53B, 0xF33BD33B,
+0x5043B243, 0x80C6FC43, 0x01C80202, 0x0406BC00, 0x00000A08, 0x00040005, 0x0F01DC01, 0x019A0005,
+0xB2001172, 0xDFEFA100, 0xAE2A2BEF, 0x722B102A, 0x7260027E, 0x923B9333, 0x0000043B, 0x04000C72,
+0x02760200, 0x02077E00, 0xFC040F00, 0x062A0004, 0x01118600, 0x720003B0, 0x0DBC0002, 0x0012C803,
+0x66040656, 0x106E0401, 0x000DFA00, 0x04020004, 0x14000214, 0x020E2401, 0x7A03027E, 0x09F80111,
+0x0413FC00, 0x54210004, 0x000002D8, 0x7A000970, 0x00040002, 0x010F0400, 0x82011ADA, 0x027A0202,
+0x0004B400, 0x040204BC, 0x04D80000, 0x00000400, 0x0006026E, 0x0EFC0905, 0x00079A01, 0x04000024,
+0x02860000, 0x00003A02, 0x1821027E, 0x0004F85D, 0xFE010564, 0x02820813, 0x02030200, 0x12000598,
+0x0D1E0003, 0x07000400, 0x8201027E, 0x0352010C, 0x0204FC01, 0xF4010AEC, 0xFE3C1000, 0x0B0C0300,
+0x00178E01, 0x04020892, 0x0DB20200, 0x05001511, 0x00190C01, 0x3CB10F04, 0x43F43BF5, 0x43913BB2,
+0x0C7C4B90, 0x00270A01, 0x040F01B3, 0x240C9F00, 0x08480003, 0x09F8FE10, 0xEFFFF7C0, 0x328D3ACC,
+0x33512ACE, 0x00077E71, 0x08000284, 0x07820000, 0x0009FC01, 0x04000282, 0x02860200, 0x00117E00,
+0x0400028A, 0x05080000, 0x1A3AF411, 0x2003B000, 0x03BC3C15, 0x0004F800, 0x36310004, 0x09F0363C,
+0x00106204, 0x0C000176, 0x04040000, 0x00000403, 0xA2020C8E, 0x00060101, 0x00118600, 0xB8281340,
+0x0105044C, 0xEA00028E, 0x78541010, 0x54D7200E, 0x7A00020A, 0x09A40002, 0x000C7E02, 0xA800027E,
+0x1B360609, 0x02079200, 0xE0040C52, 0x1FE60109, 0x000C8C01, 0xF4031B8E, 0x051C0013, 0x11000403,
+0x04190018, 0x5C001B7A, 0x05080000, 0x02000802, 0xF6001968, 0x027A0216, 0x00027600, 0x00050590,
+0x05AC010F, 0x00117E02, 0xB7100286, 0x5A000ACC, 0x00D60117, 0x00027E00, 0x7A0005F8, 0x00F8000C,
+0x00010804, 0xA404010C, 0x0016110D, 0x05000014, 0x01104002, 0x3B1009FC, 0xF2000154, 0x3B926008,
+0x9DB83B4F, 0xF80004F0, 0x01C80009, 0x08000800, 0x14000282, 0x00100800, 0x98000C0F, 0xEFFFF7A6,
+0x2A4C7CB4, 0x7E102AAD, 0x0EF80302, 0x150A0400, 0x110282B3, 0x131DF4D3, 0x0318FCD3, 0x3B110B1A,
+0xF8060C7E, 0x1404081D, 0x00190801, 0x8A020B66, 0x8E571002, 0x0A000302, 0x030DF800, 0x28010778,
+0x027A0313, 0x0310BE00, 0x000104F4, 0x1DFE0119, 0x0001EE00, 0x860006EA, 0x1D78001F, 0x011FA400,
+0x76050212, 0x64F72411, 0xF820027E, 0x0522746C, 0x5E00027A, 0x1DFC0111, 0x4709EC01, 0x396D3875,
+0x08000004, 0x00180114, 0x00029601, 0x380022BC, 0x00400000, 0x01028605, 0x00010058, 0x0C82000F,
+0x00050C01, 0x0400057C, 0x12060000, 0x01078800, 0x82030004, 0x027C0016, 0x00077C02, 0x4A001B7E,
+0x00D80003, 0x221E0800, 0x1B864477, 0x0000F800, 0xF4000004, 0x0A571109, 0x011C021F, 0x30062C00,
+0x02154435, 0x163C2000, 0x44400644, 0x04143BF4, 0xF443920F, 0x503B9243, 0xFE3AEE3B, 0x02580F04,
+0x00AB0D98, 0x04032405, 0x08000A00, 0xFFF7C000, 0x0AD75EEF, 0x8E226C22, 0x04F45122, 0x3B923B40,
+0x01000872, 0x93220004, 0x000A0833, 0x0000167E, 0x00040005, 0x00050403, 0x3310168E, 0x1E001518,
+0x0B240010, 0x01063200, 0x44420786, 0x72353C15, 0x20760020, 0x4C564460, 0x86564435, 0x564C301F,
+0x021F8E44, 0x9A030004, 0x1D2C000B, 0x4C975431, 0x4C010BB6, 0x1D500013, 0x04E8B711, 0x00026A02,
+0x54042076, 0xC4D71022, 0x20760022, 0x10021600, 0x0124FA64, 0xF60104B4, 0x04D00124, 0x00026E01,
+0x38400EE8, 0x046D3875, 0x24B60200, 0x3124BA00, 0xC2797558, 0x75388024, 0x75387559, 0x00087558,
+0x00085810, 0x75586D43, 0x0224DE58, 0x28020034, 0x250E0005, 0x00028E00, 0x9A000004, 0x05500002,
+0x11051004, 0x001E10D7, 0x0A001E14, 0xDCD71103, 0x00B40322, 0x00033001, 0xC8000D36, 0x214E0000,
+0x021ED000, 0x080023EC, 0x216E001E, 0x02010000, 0x92000110, 0x00040120, 0x31013001, 0x02144435,
+0x44358000, 0x44143C14, 0x21EA43F4, 0xF443F4C2, 0x303BD343, 0x11433033, 0x0009FC64, 0xFC0009F8,
+0x01CC0404, 0x0D001000, 0x110F01E9, 0xCA009600, 0xEFFF8500, 0x2A6C4B2F, 0x027E2AAE, 0x0309F800,
+0x7E00077A, 0x05000202, 0x001E000A, 0x04070278, 0x14435200, 0x2C441544, 0xB301F001, 0x5133723B,
+0x1023102B, 0xF022F02B, 0x0622EF22, 0x00080600, 0x00000E02, 0x11800006, 0x1022F023, 0x0C1AF023,
+0x0C101000, 0xF02B3000, 0x13003422, 0x02003C10, 0x48000008, 0x2B102100, 0x33100002, 0xEF200006,
+0x0100062A, 0x10000004, 0x0F334100, 0x0008302B, 0x312B1051, 0x000C3033, 0x10333131, 0x18000008,
+0x00040000, 0x30333131, 0x08040002, 0x33514000, 0x000C3330, 0x00000804, 0x0400000C, 0x00100000,
+0x0F000404, 0x00000010, 0x33120060, 0x51140020, 0x2B870008, 0x2B313351, 0x08513351, 0x000C0000,
+0x4800040A, 0x2B513352, 0x72310004, 0x00105233, 0x00012600, 0x08070018, 0x5A331000, 0x00100400,
+0x50335133, 0x30800010, 0x6C3B5033, 0x7ED71D2A, 0x026E0F07, 0x033404AB, 0x00031F00, 0x7E01000C,
+0x9BF7B00C, 0xCE19E9BE, 0x722AEF32, 0x0904F833, 0x8A070A00, 0x0F020002, 0x0409F000, 0x04020004,
+0x0C86000A, 0x43F404F1, 0x3BB33BF4, 0x22F02B31, 0x22AF1AAF, 0x22AE1A8E, 0x910004AE, 0x22AE22CF,
+0x22AE22AF, 0x000014AE, 0x04000018, 0x00100400, 0x03002402, 0x2601002C, 0x001A0000, 0x00002C0A,
+0x8D420030, 0x0422AE22, 0x228E3000, 0x0F004C8E, 0x01040004, 0x22320050, 0x00462ACF, 0x53000604,
+0x22AE2ACE, 0x00005ECE, 0x10010008, 0x00140000, 0x12000400, 0x00001C22, 0xCF830018, 0xCF22CE2A,
+0x082ACE2A, 0xEF228300, 0xEF22CE2A, 0x0010CF2A, 0x001CCF10, 0x000E2210, 0x00002400, 0x04020018,
+0x2AEF6100, 0x22EF2AEF, 0x0A000006, 0x000C0200, 0x22001001, 0x00162B10, 0x0018F012, 0x00102A10,
+0x0B00040F, 0x0F2B0F70, 0x102AEF2B, 0x2BA3033E, 0x2B302B10, 0x330F2B0F, 0x40037A0F, 0x42EE32CE,
+0xF4041B76, 0x01C00022, 0x00043A00, 0x920F01C4, 0xD400AB02, 0x430D6205, 0x2AAE32AE, 0x7A010EF8,
+0xC43B1011, 0x000A0004, 0x7E3BB323, 0xB33B3011, 0x0026803B, 0x76000B0A, 0x02760025, 0x00140C00,
+0x7A04061C, 0xCF0AF702, 0xAE22CF22, 0x8D2A8D2A, 0x6C224C2A, 0x2B1A2B22, 0x4C222B22, 0x2C222B22,
+0x14040004, 0x00080400, 0x00002000, 0x0408000C, 0x222C4200, 0x0010220B, 0x15000804, 0x0000100A,
+0x2B42004C, 0x24220B22, 0x1A0B2300, 0x1A100010, 0x2B110014, 0x0B100074, 0x0400000C, 0x2B223500,
+0x01002022, 0x24020084, 0x00540000, 0x01002400, 0x40030062, 0x082B1100, 0x004C0300, 0x01003800,
+0x10000030, 0x00A00000, 0x51000806, 0x2A2C222C, 0x1500042B, 0x2000084C, 0x000C224B, 0x082A4C28,
+0x224BA200, 0x2A4C2A6C, 0x224C2A6C, 0x10010018, 0x00140000, 0x00000401, 0x20030014, 0x00240000,
+0x11000407, 0xC0000C6C, 0x226C2A6D, 0x226C2A8D, 0x2A6B2A6C, 0x50010012, 0x7B323001, 0x020274BE,
+0x000F0004, 0xC002A714, 0x00060200, 0xB0033801, 0xBCF7FFF7, 0xAE222CBE, 0x7E33102A, 0x33713107,
+0x0009FC72, 0x7A000508, 0x33924007, 0x27F433B3, 0x08000C00, 0xD3C00500, 0xD33BF333, 0x7143F433,
+0x3822CF33, 0xAE0BF504, 0x4C2AAE22, 0x6B222C22, 0x52532E32, 0x199D7774, 0x3DC6BCAE, 0x7EE77ED7,
+0x170004DF, 0x08000CDF, 0x0C050018, 0x2C5E1600, 0x00140500, 0x00003404, 0x0400001C, 0x00100400,
+0x4900080F, 0x0900680F, 0x08001C00, 0x880F0004, 0x2C040D00, 0x00280F00, 0x0020040D, 0x01047D16,
+0x000CDF10, 0x01367D10, 0xE79FDF30, 0xB60231F0, 0x00060F01, 0x0C7600B2, 0xB000C904, 0x8D5C12EF,
+0x522ACF22, 0x7A43923B, 0x00040007, 0x4013F800, 0x3BB33372, 0x7A000EFC, 0x33927302, 0x33933B93,
+0x110004B4, 0x402B90F4, 0x33923BF3, 0xEEE0067A, 0x6C2ACE2A, 0x4F2A4C22, 0x1E9D984B, 0x02054ECF,
+0xAC0052AE, 0x00630408, 0xFF00080F, 0x04320136, 0xAA014D0F, 0x0000C200, 0x380513F0, 0xBFF7B008,
+0xCF224CE7, 0x722AEF2A, 0x05027A3B, 0x00050500, 0x27F80014, 0x00208A00, 0x04000EF8, 0x1182000F,
+0x43F404F0, 0x2AF03B72, 0x22EF2310, 0x226C22CD, 0x9D773ACD, 0x021C96BF, 0xF7131448, 0xFF32372A,
+0x08AEF7DF, 0x00146400, 0x36000078, 0x00080F06, 0xD80012FF, 0x01280009, 0x0F000800, 0x0FAA026D,
+0x030700BD, 0xE6003CEA, 0x8D36C000, 0x2B0F2AAD, 0x3B513B71, 0x1B783B71, 0x070A0601, 0x000018FC,
+0x257A010A, 0x10230400, 0xF22F8233, 0x3143D401, 0xF02AF033, 0x6C22AE32, 0x9B434F22, 0x0004F4B6,
+0x7101004C, 0x055C0000, 0x01000400, 0x050F000D, 0x00FEFF00, 0x1A00048C, 0x3A380507, 0x3ACDEF60,
+0x443022EE, 0xFC3B1210, 0x0A000804, 0x000C8200, 0x00000004, 0xFC931505, 0x10FC0031, 0xAD2AEE93,
+0x5A32CD2A, 0x3D0EDFAE, 0x28F7BE20, 0x28DE1141, 0x0060005A, 0x0003BC00, 0x68000292, 0x00040005,
+0x00000C00, 0x900F0004, 0x48041D02, 0x00080400, 0x1D00400F, 0x0400300C, 0x080F0048, 0x500F2500,
+0x20080D00, 0x00F00F00, 0x00400821, 0xC8000C0F, 0xE0072A02, 0x9CFFFFFF, 0x302A6CC6, 0x722B5033,
+0x0C7A5133, 0x11167A01, 0x012A7693, 0x100009F8, 0x19080300, 0x30207A01, 0x5C3B933B, 0x2AEE5713,
+0x8452226C, 0x02D60035, 0x0011CA00, 0x360F0008, 0xDB0FC801, 0xC60F6200, 0xCE00BB02, 0x04900000,
+0xB1073400, 0xF7DFF7DE, 0x32EF53B1, 0x7E912B30, 0x02820102, 0x18FC3311, 0x0018F403, 0x932004FC,
+0x000C8E43, 0xB2C031FC, 0x31339233, 0xEE2B112B, 0x762AAC2A, 0xF7DE2207, 0xF0004614, 0x09DC0004,
+0x00019F04, 0x8A00045C, 0x00040002, 0x00006C00, 0x1C040004, 0x00080F00, 0x58002AFF, 0x01400F01,
+0xDFF7D3B8, 0x8EE7BFF7, 0x3133112A, 0x7A337133, 0x723B3816, 0x200A003B, 0x027E3B72, 0x000F0802,
+0x30C00784, 0xEF2B312B, 0xDF3AEE2A, 0xCAF7FFDF, 0x02620002, 0x000EEE01, 0x060009F0, 0x0008005B,
+0xB801230F, 0xFF00CB0F, 0x02360440, 0x540EA402, 0x2AEF8D15, 0x0404FC31, 0x00000008, 0x19080114,
+0x0004FE00, 0x86040A0E, 0x1ADE0011, 0x2F2AEE70, 0xFFE7FF43, 0x38010EE4, 0x04FC0028, 0x01054C00,
+0xAF000008, 0x02820F01, 0x0010FFFF, 0x86000225, 0xF7FFE002, 0x3ACDEFFF, 0x2B313310, 0x3B513B52,
+0x7231117E, 0x0008713B, 0x002F7A00, 0xFC010A04, 0xF8431227, 0x33B3A018, 0x33302B51, 0x434E330E,
+0x6E082184, 0x027A0107, 0x0F027603, 0x36FF076A, 0x0F01A400, 0x00C30004, 0x04000844, 0x5EBF1100,
+0x2ACDD13E, 0x33523350, 0x3B523331, 0x04713351, 0x02820000, 0x0218FC00, 0x92302A7E, 0x118A513B,
+0x62B42B21, 0x3330211F, 0xE4002402, 0x0CC0000E, 0x0054EC09, 0x1C00027A, 0x01360150, 0x01028E03,
+0x1100029A, 0x00100C00, 0x0F001400, 0xEBFF0004, 0x70050002, 0x33505BF2, 0x7E513371, 0x04F80102,
+0x02050000, 0xF0001404, 0x0C760118, 0x43D33B30, 0x72B01678, 0x3033722B, 0x9F2A8D33, 0x2B7CFFDF,
+0x05027E01, 0x8003025E, 0x0282023A, 0xFF02570F, 0x01FD0FEB, 0x02260010, 0x80073E00, 0xD77FF7DF,
+0x2B502ACE, 0x0008242A, 0x05080005, 0x0104FC00, 0x00F10004, 0x713B923B, 0x9233B22B, 0x3033922B,
+0x762AAD2B, 0x16BA0144, 0x322EBE10, 0x000C7000, 0x0801028E, 0x0058000A, 0x0F0C8E03, 0x0F100086,
+0xEFFF0023, 0xF7FFF785, 0x33307CF6, 0x11050092, 0x00167E71, 0x711004FE, 0x33400772, 0x7A723B73,
+0x36FC0025, 0x33923383, 0x33103392, 0x0028FE53, 0x400807BE, 0x027A0002, 0x08000400, 0x0C0F0014,
+0x09FFFF00, 0x01162600, 0xE7201132, 0x001DF00E, 0xF80128E0, 0x04F80009, 0x02000400, 0x7E000A00,
+0x00040002, 0xA0050000, 0x2B913BD3, 0x2ACD3351, 0x2184EFFF, 0x0007BA00, 0xFC010540, 0x09D80413,
+0x03026F04, 0x24010010, 0x00140400, 0xFF079E0F, 0xF78105FF, 0x330FAE5B, 0xF8713BB2, 0x82511018,
+0x14040002, 0x320F0802, 0x7E3B933B, 0x0F000107, 0x33713B92, 0x332F3391, 0x28FE9DFA, 0x005EE802,
+0x61070262, 0x000B0602, 0x06028203, 0x0A0F0011, 0x00DEFF00, 0x8805021A, 0x09AC0009, 0x0E96F712,
+0x00072200, 0x1001001C, 0xFFF79002, 0x5153F2F7, 0x76339233, 0x2DE6011B, 0x0C513B20, 0x713B6000,
+0x7133503B, 0x0002027E, 0xFC331014, 0x33725031, 0x76503371, 0x003B0111, 0x0E00050F, 0x020A1601,
+0x740002A6, 0x0CA60000, 0x00007800, 0x3C0F0004, 0x240F0D00, 0xD2040200, 0x00080402, 0x04004504,
+0x080F0010, 0x40041D00, 0x62320300, 0x08007400, 0x3C000004, 0x00100001, 0x0000B800, 0x0C00002B,
+0x00040400, 0x00001000, 0x040400D4, 0x00180800, 0x0F003004, 0x00050008, 0x38001F70, 0x00440000,
+0x08003804, 0x18000008, 0x00040000, 0x00008000, 0x48010008, 0x00DC0000, 0x01000400, 0x050F0011,
+0xEA019900, 0x00BA0000, 0x03028200, 0xC0080702, 0xD77E4000, 0x27E03310, 0x0030BC00, 0x7A000272,
+0x0004011B, 0x40140201, 0x33733B93, 0xF2000F0C, 0x05040018, 0x1A331061, 0x54F7FF9E, 0x00450800,
+0x11000C0F, 0x00008403, 0x2F0F016A, 0x240F1100, 0xAC057100, 0x00BC0000, 0x0002A603, 0x00040098,
+0x00080401, 0x0F001400, 0x034A0004, 0x640F0080, 0x5D0F4A00, 0x44004200, 0x01260103, 0x0000C203,
+0x69010010, 0x028E0200, 0xEFFFF790, 0x335184F6, 0x117C43D4, 0x51335040, 0x0100043B, 0x0400027E,
+0x1B820014, 0x8A923321, 0x0C780025, 0xFA33B320, 0x18F20037, 0x4E70FF15, 0x0F004C01, 0x00040005,
+0x04050078, 0x00800000, 0x0005100B, 0xDC01001C, 0x03160003, 0x05009002, 0x1C000F40, 0x00040000,
+0x00020200, 0x040F0008, 0xBB004500, 0x005C0F00, 0x001C0005, 0x0C00A005, 0xB003027E, 0x00240100,
+0x0800050F, 0x0000C000, 0x640F0004, 0x00000A00, 0x00040F01, 0x00570100, 0x01013407, 0x78030048,
+0x01C80000, 0x01001000, 0x050F0024, 0xFA008A00, 0x00A10D00, 0x00020E00, 0xF7500015, 0x330FEFFF,
+0x7A0359C0, 0x7A3B1007, 0x3B725016, 0x86723352, 0x713B3307, 0x010C7A3B, 0xD4600EFC, 0x5833513B,
+0x0018F485, 0xFE0F003B, 0x7C001100, 0x00040000, 0x04003000, 0x380401CA, 0x00180500, 0x0F001D01,
+0x00840005, 0xF2010128, 0x08BA0201, 0x0F00A604, 0x005600BC, 0xFA030080, 0x01380802, 0x5600800F,
+0x0F00F104, 0x01230008, 0x2002013A, 0x00410044, 0x0400C204, 0x01F01DA4, 0xF7FFF7DE, 0x3351A63B,
+0x2B523BD3, 0x3B512B31, 0x820237DA, 0x37FA0307, 0x33723330, 0x0C00028A, 0x25820028, 0x5133B354,
+0x2F567F33, 0x0F005100, 0x130C0004, 0x010A70FE, 0x4A000027, 0x03CC0701, 0x04090400, 0x080F0292,
+0x41010E00, 0x00050F00, 0x009C0048, 0x0E005F00, 0x5E010008, 0x027C0017, 0x02000402, 0xBC01014C,
+0x00300000, 0x00000404, 0x04000038, 0x04C40700, 0x04016C05, 0x080F0024, 0x3C030900, 0x01080F00,
+0x001A0100, 0x062E3A00, 0x84026A74, 0x05000F00, 0x00C00194, 0x0000FB0B, 0x04000014, 0x00170000,
+0x4BF3EF30, 0x52933BB8, 0x5033512B, 0x303B503B, 0x82000500, 0x04721007, 0x00040028, 0x73191001,
+0x3BD33BB3, 0x74D33BB4, 0x11760044, 0x0F003F00, 0x042A0004, 0x450F0084, 0x3D0F2A00, 0xA4034C00,
+0x04700000, 0x0F000400, 0x0306006E, 0x200F0028, 0x190F0600, 0x42032500, 0x026E0F04, 0x00E60C94,
+0x00011603, 0xC205013A, 0x00140000, 0x9100D603, 0xCF7FEFFF, 0x33B43371, 0x403D4293, 0x3B303B30,
+0x0A000A00, 0x077E020A, 0x00028200, 0x8A0004FC, 0x3392702F, 0x33933BD4, 0x00077E79, 0x1A001DF4,
+0x0004015A, 0x0D00730C, 0xF4070010, 0x04140004, 0x04000404, 0x100403EC, 0x00080F00, 0x004C0D01,
+0x04001103, 0x0F03002C, 0x00070F00, 0x01180026, 0x04000400, 0x080F0050, 0x38000100, 0x00040001,
+0x0004F404, 0x71040024, 0x000C0100, 0x04015003, 0x500000D0, 0x00040000, 0x00002400, 0x04040020,
+0x00100000, 0x0000040C, 0x04000058, 0x00300000, 0x0C002804, 0x92000008, 0x0024044C, 0x00004000,
+0x08000020, 0x00700400, 0x0F000C01, 0x009B0005, 0xB2000132, 0xF701F000, 0x7D17EFFF, 0x3BF53BB3,
+0x2B303B93, 0x7E503B71, 0x003B1002, 0x027E0214, 0x00027A00, 0x0400077E, 0x3B712028, 0x724645E6,
+0xFCBF1F33, 0x010A050E, 0x0F004C00, 0x09140004, 0x88040034, 0x003C0F00, 0x00270F14, 0x01FE0565,
+0x1000B00F, 0x0F024A00, 0x0F3D00A8, 0x0F190080, 0x0F3D007C, 0x00330050, 0x04010116, 0x01420300,
+0x011B3600, 0xE712319E, 0x46000258, 0x9650112F, 0x027E0142, 0x10190800, 0x00190033, 0x82000786,
+0x348E0002, 0x2245D200, 0x0EFC3351, 0x00040C00, 0x9E0F0894, 0xBC040D00, 0x0A700403, 0x00008400,
+0x8600014E, 0x00040002, 0x00004004, 0x0C000090, 0x00080400, 0x0003DC05, 0x040400B0, 0x00210000,
+0x0C000C00, 0x14000008, 0x00040800, 0x0D00200F, 0x00002C08, 0x3007000C, 0x08560400, 0x00000804,
+0xE9000088, 0x0098003D, 0x02292402, 0xBC0014CC, 0x00040400, 0x00003F00, 0x08000028, 0x00E00100,
+0x00005400, 0x04020A36, 0x00170000, 0x018D3C01, 0x1C000009, 0x00090000, 0x04000800, 0x10040004,
+0x00080700, 0x00008000, 0x38000060, 0x00080001, 0x0B48DE10, 0x00003003, 0x70040010, 0x00330000,
+0x9300040F, 0x01011A00, 0xC60000AA, 0x00090100, 0xFFFFFFA0, 0xB39E3BEF, 0xCE44153B, 0x33302022,
+0x8200027A, 0x257E000C, 0x00168A00, 0x70003704, 0x280C002A, 0x001E1000, 0x14464FD8, 0xFEE7FF54,
+0x0047040A, 0x0700080F, 0x01028000, 0x30011BE0, 0xDF9E416E, 0x0004E79F, 0xE79FE761, 0x029FE79E,
+0xDF9E8800, 0xE79EE7BF, 0x0008E7BF, 0xBFE7BF61, 0x06DFBFE7, 0x00080600, 0x83001400, 0x9FE7BFE7,
+0x9FE7BFDF, 0x22000008, 0x28BE1300, 0x00080400, 0x00004800, 0x08040020, 0x00480D00, 0x04003003,
+0x28040018, 0x00080000, 0x04005000, 0x0C010018, 0x7FE73100, 0x0419E8DF, 0x3C0808AE, 0x00F50F01,
+0x0CA20400, 0xA100F203, 0x7EEFFFF7, 0x7EDF5DDF, 0x3E365EDF, 0x7EDF7E64, 0x04E79FDF, 0x01080100,
+0x02011001, 0xD80100FC, 0x00100300, 0x0000C000, 0x9F300080, 0x71E0FFE7, 0x01006A01, 0x800F01C0,
+0x29010C00, 0x00050F00, 0x032C017A, 0x000D9404, 0x4A0000BE, 0x68D40001, 0x500FD200, 0x14EFFFF7,
+0x504BD454, 0x33302B31, 0x1213F830, 0x10028633, 0x22050052, 0x0C8A503B, 0x002D0801, 0xF5600A00,
+0xF63BD433, 0x0F039274, 0x01170282, 0x03F00080, 0x1DEFFFF7, 0xF17D16C7, 0x535C5353, 0x535C745C,
+0x0008545C, 0x5C5364B3, 0x5C536454, 0x64546474, 0x5C360004, 0x00026474, 0x74649585, 0x7464955C,
+0x10000464, 0x42000C6C, 0x6C956495, 0xB5750004, 0xB564956C, 0x0004B56C, 0x6CD507F2, 0x6CD56CB5,
+0x6CD66CD5, 0x6CD66CB5, 0x74F66CD5, 0x74D66CD5, 0xF6310008, 0x0010D66C, 0x00000802, 0xF64A000C,
+0x0874F66C, 0x75162300, 0x44010014, 0x00380200, 0xF66CD652, 0x0AF0166C, 0x0401D600, 0x50030140,
+0x00DC0001, 0x0005CC04, 0x2200001F, 0x00040002, 0x00105400, 0x94712BCE, 0x704B5074, 0x00049143,
+0xB14B91C0, 0xD24BB14B, 0xF24BD24B, 0x92000453, 0x5C1353F2, 0x54135413, 0x14010C33, 0x0400EC5C,
+0x800000D4, 0x6CB5A000, 0x6C9474D5, 0xEFFFBEBC, 0xD4013D3A, 0x0B700102, 0x00007400, 0x04000068,
+0x00840000, 0x0F007C00, 0x008F0004, 0xB60400AE, 0x000C0105, 0xF7FFFF60, 0xD4B3CF3F, 0x10432069,
+0x3B10117A, 0x040204FC, 0x07760005, 0x00077E01, 0x00003C04, 0x0233100F, 0x3C36510A, 0xF2D93BD4,
+0x00EE0050, 0x00004403, 0x040F000B, 0xB6000A00, 0x9597A006, 0x54545BF2, 0x54955C95, 0xB6327044,
+0x70469554, 0x54955C33, 0x5C1272B2, 0xB621704A, 0x00703254, 0x5C227036, 0xA06FDAD6, 0xD75CD764,
+0xD85CB764, 0x0002D764, 0x114D6A03, 0x006DDCD7, 0x04044FE0, 0x5C220200, 0x1864F840, 0x034D166D,
+0x6D320008, 0x68F46518, 0x68F41810, 0x02000403, 0x392159FC, 0x2159F06D, 0x00085965, 0x005A0201,
+0x6DA15A06, 0x6D596D7A, 0x6D59757A, 0x00000479, 0xF6304D86, 0x56E4DC6C, 0x0000E402, 0x7E0303BE,
+0x00110202, 0x0000060A, 0x12013A74, 0xDFEFD000, 0x704B2EE7, 0xF34BB24B, 0x2A43F34B, 0x4C15715C,
+0x4C354C14, 0x71719E14, 0x4C555455, 0x0C765476, 0x4E520201, 0x02533A04, 0x1E0055AC, 0x50880053,
+0x58755971, 0xD57D5775, 0x680603F2, 0x000A0002, 0x00017C00, 0x6C010004, 0x00050F00, 0x03B4008B,
+0x0359D801, 0xFC0100A7, 0x06280004, 0x6003A200, 0x3BF47CF7, 0x4C444436, 0x204C9206, 0x32023351,
+0x02000400, 0x0C021908, 0x3371400F, 0x02803BB3, 0x6C6A5B10, 0x03018600, 0x56030ED4, 0x00070F00,
+0xFFF7C107, 0xB09DB7F7, 0x54543253, 0x6BB4344C, 0xF33BF471, 0xF344143B, 0xA0005DC0, 0xDC14114D,
+0x4EE0004E, 0xE8441420, 0x5028004E, 0x51000404, 0x44354455, 0x00502C35, 0x55125030, 0x44105038,
+0x55130008, 0x76325038, 0x6E247644, 0x6E244412, 0x024F5C02, 0x440070B2, 0x4C964450, 0x000454B7,
+0x014F8000, 0x4C01521A, 0x55380250, 0x004FA402, 0x04005540, 0xC4F81100, 0x505C0068, 0x20001800,
+0x504C5CD7, 0x5E64D560, 0x00F7FFD7, 0xE69E130A, 0x01FA0065, 0x020B0002, 0xFD040608, 0x04980200,
+0xD1037000, 0x53B0EFFF, 0x43914B90, 0x44354BF4, 0x0000B055, 0x55304FD4, 0x000C5644, 0x00526201,
+0xFC00707E, 0x44553150, 0x00000276, 0xCC007176, 0x00140000, 0xC1501C00, 0x4C554C75, 0x6D3854D7,
+0x8D976D16, 0xB0020802, 0x05000606, 0x000A1000, 0x7D040014, 0x00080F00, 0x0132018A, 0x0100A204,
+0xFC000282, 0xE7FF4009, 0x5D6443B2, 0x6C333120, 0x33303048, 0x120EFA31, 0x042A7E3B, 0x0C020508,
+0x11860019, 0x5733B376, 0xFD3BD344, 0x5004040C, 0x00080F00, 0xFFF7A00B, 0x12538FE7, 0xB24C1354,
+0xB401463E, 0x52AE0071, 0x0043B600, 0x3C002D4C, 0x0004044B, 0x000CE000, 0xB20066B6, 0x6F660252,
+0x005CB800, 0x08005F44, 0x61C20000, 0x00553800, 0x04005F3C, 0x6FAE0000, 0x005E3000, 0x04025F48,
+0x5F400200, 0x02545401, 0xEE0570C2, 0x60FA006F, 0x06000401, 0x560070CA, 0x52E60055, 0x00000803,
+0xB00054A6, 0x00080063, 0x005CDE00, 0x540002C2, 0x64F73352, 0x0028E894, 0x160000E7, 0x0008000C,
+0x04015000, 0x1000064C, 0x00040400, 0xA3001801, 0x3DF7FFFF, 0x713AEECF, 0x72F0143B, 0x0754F800,
+0x7A0154F0, 0x54F00070, 0x00000400, 0x040154F4, 0x5C760100, 0x11577A00, 0xC2708615, 0x3BF33C15,
+0x6D385CD7, 0xB6DC6CF6, 0x6404385C, 0x05000500, 0x04045A03, 0x080F0018, 0xAC008400, 0x05000F04,
+0x04FE0000, 0xD49E3C70, 0xB4443543, 0x33314E60, 0x02863331, 0x0A003B10, 0x11000400, 0x000C8E31,
+0x0400027E, 0x0C860000, 0x563BD482, 0x3D3BD33C, 0x040888CF, 0xF60F0400, 0xF7700E00, 0x434FA5D9,
+0x6E324BB1, 0x1348B201, 0x0139BE3B, 0xB4116E3C, 0x400057BE, 0x17020050, 0x13000402, 0x0057BEF5,
+0x78020CEE, 0x00060202, 0x225F4002, 0x65963C35, 0x005B9E02, 0x3C020280, 0x594C0063, 0x045F3C00,
+0x60000004, 0x0004015E, 0x0161C603, 0x4400027E, 0x00040469, 0x015CD601, 0x86035718, 0x027A0102,
+0x0059B400, 0x54500010, 0x54975496, 0x54407860, 0x80AE7B5C, 0xDADE1004, 0x05F4032D, 0x01020200,
+0x020400F8, 0x00080302, 0x00050000, 0xFF810004, 0x2F7C94EF, 0x8C33713B, 0x030A0205, 0x0473D401,
+0xF800009C, 0x00040363, 0x12027600, 0x00576E44, 0x6E000286, 0x00EE0261, 0x620B9600, 0x6D185CD7,
+0x1CEC6CB5, 0x0006B200, 0x780047A8, 0x00800000, 0x0F018000, 0x00010302, 0x040F0020, 0x98007F00,
+0x00040003, 0x00009A02, 0x000000C0, 0x54352005, 0x311306D6, 0x720053C8, 0x167E0002, 0x02000800,
+0x7A02050A, 0x0A0C0202, 0xD43393A1, 0xB344773B, 0x04D75E3B, 0x01720304, 0x0F005002, 0xB0080006,
+0xD5F7FFF7, 0x914B5084, 0x4243B343, 0x33933000, 0x003240B3, 0x3401643C, 0x76C8004B, 0x11783402,
+0x086CD0F5, 0xEC005A38, 0x693C026C, 0x00027A04, 0x7200019E, 0x5F400202, 0x00000A02, 0xBA00027E,
+0x684C0260, 0x0061BA01, 0xE4027258, 0x5BEE015B, 0x00027A0A, 0x76000266, 0x00080002, 0x00000400,
+0x100004F4, 0x00080000, 0xB0000404, 0x54975497, 0x54965CB8, 0xDE555476, 0x0FF0036A, 0x0300E604,
+0x0F04013E, 0x00080D00, 0x60078000, 0x437132AD, 0x5EEC3B92, 0x0268F000, 0xDA00714A, 0x00A0045A,
+0x03000800, 0x44305EF4, 0x5B044456, 0x10050C01, 0x0204FC3C, 0xCA007428, 0x6518607B, 0xA61A64B6,
+0xDF2002FE, 0x020280FF, 0x710503FA, 0x01840F00, 0x00310515, 0x6200090F, 0x02050001, 0x3A010B18,
+0x00100101, 0xF3027E00, 0xF3BF1E00, 0xB24C7643, 0xEF33313B, 0x1033302A, 0x8A0013FC, 0x02820156,
+0x100F0200, 0x000A0C33, 0x71C2168A, 0xD4337133, 0xF444573B, 0x0ECF3D43, 0x03800006, 0x0F028A01,
+0x400D00D5, 0x0E84D4F7, 0x332325C6, 0x004144B3, 0xBA004B40, 0x00040052, 0x0057C202, 0x8A005538,
+0x5F380002, 0x00000400, 0x40040772, 0x5F3C0664, 0x00041800, 0xA4005B92, 0x02820006, 0x02000800,
+0x3C0461C2, 0x5E48025E, 0x0060D201, 0x040270CE, 0x028A0100, 0x006BD200, 0x12000200, 0x5BFE0002,
+0x005C0602, 0x58016458, 0xDE441078, 0x02860070, 0x76549740, 0x0068B04C, 0x9664028A, 0xF24C5454,
+0x00725C53, 0xF00000E7, 0x01440000, 0x00000400, 0x04000010, 0x0A180000, 0x04000800, 0xDFD20004,
+0x97F7FFFF, 0x303AEF95, 0x76441433, 0x88017568, 0x05A00000, 0x0A00A006, 0x363000B8, 0x0504373C,
+0x34353C50, 0x08663C56, 0x20602800, 0x0D703BD3, 0xBF647440, 0x0A0076DF, 0x80010A68, 0x027E0F00,
+0x01170393, 0x0304FC06, 0xF7500011, 0x7D37EFFF, 0x51130D82, 0x311B027A, 0x0004077A, 0x0008000A,
+0x80028200, 0x3BD43372, 0x44144C98, 0x44020B8C, 0x02820000, 0x0F000A02, 0x610A0006, 0xADADF8F7,
+0x4DBE503A, 0x004DAE02, 0x8A004B40, 0x33B42207, 0x3C025038, 0x66B60264, 0x02050000, 0x04007838,
+0x6572000A, 0x00027604, 0x00006800, 0x02760005, 0x00027E00, 0x38020004, 0x69440004, 0x00044C00,
+0x040301DE, 0x01F20100, 0x2060E200, 0x047C3C77, 0x01000401, 0xFE00644C, 0x735C006A, 0x01026C01,
+0x0A006E58, 0x61DA0000, 0x00028200, 0xFC006DA8, 0x54B8D109, 0x54B74C77, 0x4BF34414, 0x641C4B90,
+0x00E20F59, 0x07720109, 0x50002108, 0x0F4B2FF7, 0x01077E33, 0x000102EE, 0x04F00003, 0x04080E00,
+0xB000616E, 0x07820000, 0x00000800, 0x361100C0, 0x5A007418, 0x7B9E0108, 0x60028600, 0x965C964C,
+0x68DEF664, 0x0F005C08, 0x00A2000C, 0x260805BC, 0x03A40001, 0x33DFFF84, 0x55547554, 0x2004FC4C,
+0x02823310, 0x015B6601, 0x5115028A, 0x82002808, 0x078A0002, 0xB73BF482, 0xFD44344C, 0x0C0606C6,
+0x190F03F8, 0xF7700801, 0x32EF2A4B, 0x75B82B0F, 0x002AC202, 0xF4004140, 0x4DC60109, 0x005F3403,
+0x40010504, 0x61CA006E, 0x01693C04, 0x820076EE, 0x00040002, 0x0004FC02, 0x1400041C, 0x0A00026D,
+0x05028E00, 0xC200044C, 0x6850016A, 0x02046C00, 0xDE02027E, 0x01FA016F, 0x05044414, 0x00050006,
+0x9611028E, 0x1A006616, 0xA8971575, 0x0294006D, 0xF3549680, 0xB143B143, 0x0106FE53, 0x70030968,
+0x047C0004, 0x00000404, 0x400300F4, 0x290C0133, 0x40039200, 0xCEDCF7DF, 0xB32049C2, 0x025ED43B,
+0x90000080, 0x00040800, 0x0063E400, 0xC402027E, 0x3C563100, 0x00651416, 0x6A0068F0, 0x03760208,
+0xB64C7581, 0xFD54335C, 0x0F007CBE, 0x00960EE8, 0x040F0112, 0x000E0100, 0xA65B8005, 0x64B75454,
+0x07783B92, 0x7E3B3128, 0x077E0302, 0x01320400, 0x00002800, 0x3B71B50A, 0x3BB33B52, 0x4C3554D8,
+0x0D0112BC, 0x790F0054, 0x14000100, 0x1AF76100, 0xCE222BAE, 0x340066CA, 0x38931178, 0x0F040050,
+0x000C7E02, 0x04000500, 0x02820100, 0x02655E00, 0x34016438, 0x078A0064, 0x00027C00, 0x04030276,
+0x06AA0100, 0x0601BA04, 0x5720043C, 0x00044C44, 0x6C000BE2, 0x00040004, 0x01028205, 0x040C0482,
+0x07820205, 0x6BD67711, 0x00027000, 0x08040500, 0x000C0000, 0x7143F482, 0x1943503B, 0x04445A9E,
+0xCF000206, 0x00040C00, 0x05028E00, 0xF7900014, 0x63F1F7FF, 0x2AEF3ACE, 0x98201216, 0x0000904C,
+0x900407F8, 0x00100000, 0x00027A00, 0x57200004, 0x0005C03C, 0x7E000C76, 0x05D00007, 0x1105E000,
+0x8163E856, 0x54964414, 0x64535C95, 0x5D0502FE, 0x00090F00, 0x011E09A1, 0x21034806, 0x863674EF,
+0xF82AF020, 0x0284001D, 0x09000402, 0x02000504, 0x063B100A, 0x1DFC0028, 0x933331A2, 0x7554D73B,
+0x92A61954, 0x05500001, 0x1202820F, 0xD01D0401, 0x222B8CD4, 0x22AE2AAD, 0x3B923310, 0x005038D4,
+0x33215A44, 0x02118E92, 0x10000A04, 0x05000005, 0x080A0801, 0x40040504, 0x7844006E, 0x01770A00,
+0x2C006814, 0x04FC0004, 0x0001B602, 0x04000450, 0x0A080000, 0x00000402, 0x08010C96, 0x0510010A,
+0x0201FE00, 0x0C000504, 0x00040102, 0x00143401, 0x04010500, 0x144C1200, 0x72A80105, 0x720F2002,
+0x50335154, 0x7C32CD43, 0x027E040E, 0x0505F40F, 0x00016401, 0x060012D6, 0x4BE7703D, 0x312ACE2A,
+0x0009FC33, 0x12020312, 0x0D220108, 0x106EEC02, 0x00000C34, 0xBC0005B4, 0x07720000, 0x007B9600,
+0x35137196, 0x15C26DF0, 0x1443F43C, 0x33549544, 0x6C95B854, 0x02780F1A, 0x00B40FA1, 0x0AD00007,
+0x74C6FD99, 0xF4651854, 0x0C7AF04B, 0x00168400, 0x51200282, 0x0005043B, 0x04020782, 0x18721100,
+0x33728F14, 0x54B654F8, 0x03949598, 0xF5F7B022, 0xAE19EA8C, 0x10226E32, 0x024DBA2B, 0x80006440,
+0x0C860007, 0x005F3800, 0x440204FE, 0x0A04005F, 0x22140A00, 0x118233D4, 0x000F0402, 0x82060506,
+0x027C0007, 0x00050402, 0xCE007D50, 0x01D60101, 0x04694800, 0x50010272, 0x027A0078, 0x01050801,
+0x7A010504, 0x000A0002, 0x070A0C07, 0x0A00027A, 0x4C00FF14, 0x44774CB8, 0x44354CB8, 0x32CE3B51,
+0x00EC7C94, 0x01580019, 0x57F7FFC0, 0xEF226C8D, 0x7743F42A, 0x03027A4C, 0x520009F0, 0x0090006C,
+0x01028202, 0xB4048566, 0x6C8E0000, 0x02050000, 0x353009F8, 0x05F8163C, 0x4C344C71, 0x4BF15475,
+0xC90F58C4, 0x1A0F0701, 0x9C049200, 0x00AD0403, 0xF122B401, 0x8D77EF01, 0x651864D6, 0x3B112AF0,
+0x33103310, 0x000EFC0F, 0x0400027E, 0x02820600, 0x05023010, 0xB2000402, 0x513B313B, 0xD654B733,
+0x1474F55C, 0x00580004, 0x00050000, 0x5C040004, 0x00080F00, 0x04340501, 0xA598F7AA, 0x2ACE19CA,
+0x8230228D, 0x0A000302, 0x00050001, 0x440189BA, 0x0C8E0078, 0x026CE800, 0x4400733C, 0x02860F7D,
+0x07920001, 0x01028602, 0xCE00118C, 0x01E20075, 0x000A0807, 0x0C020296, 0x02860005, 0x0006FE00,
+0x0C000008, 0x10761105, 0x0796020A, 0x0011A204, 0x14007C9C, 0x4CB7A20F, 0x2ACE3351, 0xCEFD328C,
+0xD80005EC, 0x00C80000, 0x00000400, 0x0408000C, 0x01080000, 0xA2001805, 0x8CEFFFF7, 0xEF228D2A,
+0x7A625622, 0x02027401, 0x0C000080, 0x05A40405, 0x0000B402, 0x00010344, 0x6C920005, 0x02803C10,
+0x0080A600, 0xF4A00280, 0xF2543443, 0xFF74D54B, 0x02005EEF, 0x0A06006E, 0x00100200, 0x9C00060F,
+0x020B3E03, 0xDFC000B6, 0xF76474DF, 0xF054966C, 0xFC32F032, 0x02760009, 0x00000400, 0x7E061E00,
+0xF6511002, 0x32040104, 0xA0000A00, 0x33314352, 0x5CD65CB7, 0x23006474, 0x0A004802, 0x14041016,
+0x00080F00, 0xF7DFD005, 0x1A0BADFA, 0x22AE32EE, 0x3CB22B30, 0x8C300064, 0x00027E00, 0x7A000008,
+0x00040102, 0x00167E00, 0x0000050C, 0x0004000F, 0x0776F002, 0xAE01027E, 0x13240001, 0x0115B603,
+0x50007230, 0x00040809, 0x0004F800, 0x080001F2, 0x02720000, 0x05000405, 0x7A0183FE, 0x82680402,
+0x00051402, 0x44200500, 0x76189EB8, 0xCE22AF4C, 0xFE430E32, 0x02620206, 0x0E02040F, 0xBE9BF7C0,
+0x22AE224C, 0x4C973372, 0x030F8457, 0x0A0182D0, 0x0AA00108, 0x000AB000, 0x08000822, 0x02860300,
+0x010AD000, 0xFC008976, 0x02820004, 0x153BF590, 0xD14C134C, 0x25F7BC53, 0x05014D0F, 0x9600180F,
+0x32013401, 0x9CF7FFF7, 0x482E020D, 0xD69E3AE0, 0x916D1764, 0x102ACF3B, 0x0232EF33, 0x05040005,
+0x04000800, 0x08021408, 0x1E04000F, 0x000A0001, 0x3BB2190C, 0x44143B31, 0x5C946538, 0x066AC75F,
+0x01004C01, 0x0D0F36AC, 0xBA000901, 0x00040001, 0x60003400, 0xB65AEFDF, 0x61A01A2A, 0xCE2AEF20,
+0x33D42048, 0xD0007D40, 0x00040048, 0x01078602, 0x33100A00, 0x8E0075BE, 0x1B860007, 0x20078C00,
+0x8AF43C15, 0x02078400, 0x96027C0C, 0x0F080074, 0x00050403, 0x4C0001C6, 0x028E0018, 0x05050400,
+0x56200008, 0x04028834, 0x0A020484, 0x05080002, 0x00050400, 0x940304F0, 0x1BAA0307, 0x82029600,
+0x2B514CB7, 0x1A0A22AE, 0x4000725C, 0x00040001, 0x0500E40F, 0x00001C00, 0x080100E0, 0xB0EFB006,
+0x8E228C5B, 0x7744351A, 0x0004EC4C, 0x80000782, 0x02720100, 0x1209F804, 0x0009F834, 0x040004FE,
+0x880C0000, 0x0204FC01, 0x7E0077E8, 0xFA3C1007, 0x538F2011, 0x760F22F6, 0x180F0500, 0x2A009900,
+0x0B42040C, 0x8100B801, 0x177516EF, 0xCF6D1765, 0x760109FC, 0x0F060102, 0x010F0403, 0x0000117E,
+0x0004000A, 0x110A0000, 0x00398631, 0xB3700A14, 0xF66D3843, 0x0E143A64, 0x00004900, 0x08000B72,
+0x00040F00, 0x02820014, 0x4066DC00, 0x32EE224B, 0x93110BA2, 0x00068FBE, 0x0782060A, 0x00027A00,
+0x00000004, 0x00040005, 0x070A080F, 0x03028200, 0x72001E0C, 0x077A0102, 0x00045C00, 0x660001F2,
+0x027C0002, 0x03020600, 0x94000004, 0x098C0004, 0x0304F000, 0x68000004, 0x02760078, 0x0113AC00,
+0x4C9F18AC, 0x22AF4C76, 0x2A2B2AAD, 0x001509FC, 0x0301027E, 0xDFF79001, 0xCE222BEF, 0x8C2B312A,
+0x0F900019, 0x00000800, 0x860202F2, 0x05A00300, 0x0400A803, 0x80000286, 0x7A561202, 0x8BE8030C,
+0x343BF470, 0xB843914C, 0x570181D6, 0x00050F00, 0x027E04AB, 0x0145A000, 0xF7D02646, 0x5CB5CF3D,
+0x54136D78, 0x330F32CF, 0x0404027E, 0x86301100, 0x20860002, 0x041E0000, 0x00000004, 0x23080005,
+0x963B3120, 0x6D38612A, 0x75166517, 0x4801019A, 0x2A5E0319, 0x0C01230F, 0x31027A01, 0xBAFFFFFF,
+0xFDF7B098, 0x0F224BCE, 0xF02ACE33, 0x021B7A2A, 0x04000C8A, 0x0504020F, 0x00077C00, 0x04020F08,
+0x04FC0000, 0x00028200, 0x18020004, 0x078A0713, 0x037ADA00, 0x4A0083A2, 0x0BCA0004, 0x0410CE00,
+0xD2000BDA, 0x0A00001A, 0x02000400, 0x84000500, 0x078A0013, 0x00000800, 0x0400079A, 0x16A20000,
+0x0120B202, 0x44B20286, 0x3BF44476, 0x226C1AAE, 0x19E87452, 0x0004E000, 0xE30F0004, 0xF4000100,
+0x01600004, 0x00028200, 0x572027F4, 0x11077E8D, 0x00030614, 0x7C00115E, 0x030A0002, 0x02050C00,
+0xA8000004, 0x027A0000, 0x02000800, 0xF62005C4, 0x200FCC3B, 0x7A623435, 0x8019EC00, 0x3BD33C14,
+0x43703BD2, 0x740F8E52, 0x140F0100, 0x0004A400, 0xFFF7C10A, 0x588D77F7, 0x106D7975, 0x0C7C0F33,
+0x02761010, 0x00000403, 0x040009FC, 0x0A080000, 0x0004F000, 0x0400167A, 0x167E0000, 0xA1551400,
+0x54963331, 0x64D56D79, 0x091ADFBF, 0x0F005404, 0x00100113, 0x270501A2, 0x5FF75000, 0x4A2A6CD7,
+0x3331316F, 0x023C7872, 0x8E01027A, 0x0A040102, 0x00028400, 0x04000500, 0x027A0000, 0x00000400,
+0x82020A08, 0x07860102, 0x0289CA00, 0x3C000004, 0x00040109, 0x000A1002, 0x04021354, 0x02020000,
+0x0001FE00, 0x0C0204FC, 0x160E0205, 0x01028200, 0x0200027A, 0x8C6C0005, 0x93EE3C10, 0x40027E02,
+0x54B74457, 0x2B305AD2, 0x00E45E22, 0x05207400, 0x090F00B7, 0x0C000A00, 0xEEEF3001, 0x02701E3A,
+0x8C00117A, 0x03020223, 0x03008800, 0x22000594, 0x78F0000D, 0x00082A03, 0x37300286, 0x0C7C1644,
+0x00125601, 0x142000DA, 0x227CD844, 0x006E6C94, 0x02093600, 0x060F000A, 0xFA00A500, 0x04800001,
+0x0000CA00, 0xBFC018F8, 0x586CD5DF, 0xCE5CD675, 0xFC32EF2A, 0x00040009, 0x02050200, 0x0408050C,
+0x0A040A05, 0xA6078E00, 0x3BD33331, 0x6D167599, 0x2E169E1A, 0x0E01180F, 0x01223403, 0x0C0121BC,
+0x00860000, 0xADD77E40, 0x1100722A, 0x021E1431, 0x86000504, 0x05080002, 0x020EFC00, 0x0C002592,
+0x0004011E, 0x04169200, 0x0801874C, 0x7C100281, 0x0009FC00, 0x86008C50, 0x000C0007, 0x0201D000,
+0x04000004, 0x04680005, 0x00000800, 0x57240500, 0x0209883C, 0x14020292, 0x07180000, 0x00112200,
+0x0800029E, 0x3C57B000, 0x3C154C77, 0x2ACD22CF, 0x013A644F, 0xFC0055D0, 0x00040004, 0x0000E80C,
+0x040404FC, 0x001C0000, 0x9BEFDF50, 0x125E8DBE, 0x03077E02, 0x80020262, 0x04FC0200, 0x02009000,
+0x0600009E, 0x00B80100, 0x13FC3410, 0x1300CC00, 0x800AE035, 0x33B23C14, 0x3B2E43B2, 0x760F17E6,
+0x6A000100, 0x00040F00, 0x00CC00A1, 0x00028A00, 0xF7C33E6C, 0x717D796C, 0xCF331033, 0x7E3B1032,
+0x050A0002, 0x0205040F, 0x310A0000, 0x14723330, 0x08311028, 0x182B7000, 0xF675576D, 0x0034847C,
+0x0C0F02D6, 0xAA001501, 0x0A840001, 0x0428BF10, 0x40003500, 0xEEDFDFF7, 0x2B100800, 0x7A0048F6,
+0x0A08060C, 0x00376600, 0x7A020502, 0x05040902, 0x028D8601, 0x10020782, 0x0E30001E, 0x030F0C03,
+0xDC009158, 0x05000101, 0x01096800, 0x78040C8A, 0x07760209, 0x00027401, 0x1C000A04, 0x00080011,
+0x000A1406, 0x4C969678, 0x2B0F3393, 0xAE392A8D, 0xAF00117A, 0x00040F00, 0x18F8000E, 0x330F5B61,
+0xE8562310, 0x0066000E, 0x00000404, 0xEC0204FC, 0x081E000E, 0x0000A000, 0xEC00082A, 0x00040218,
+0x7633F522, 0x7BA2001B, 0x923BF472, 0x903B703B, 0x750F1BF6, 0x210F0E00, 0xF8039100, 0x1CA00104,
+0xA11DBA00, 0x6D1874D6, 0x22CE64D6, 0x027E330F, 0x00028201, 0x1022048A, 0x00078A33, 0x04021188,
+0x078A020A, 0x010F0405, 0x3192190A, 0x384BF32B, 0xBC6CB575, 0x4E042914, 0x01090F02, 0x02FA0008,
+0x00027E00, 0x82000928, 0x002B0002, 0x30000C02, 0x200EE7DF, 0x7223237A, 0xFC020504, 0x0C860004,
+0x02000400, 0x88000A00, 0x02820002, 0x000A0806, 0x0400027E, 0x06AC0000, 0x06000402, 0x04031696,
+0x06E20705, 0x02047400, 0xF8000484, 0x04880004, 0x00000800, 0x96000004, 0x02220007, 0x20029600,
+0x14403C76, 0x700C2E00, 0x23104456, 0x7C6B330F, 0x00DC000C, 0x006EB003, 0x040800B4, 0x00D00000,
+0x00000404, 0x580000E0, 0xDFDF8001, 0x2B3032AD, 0x00542B92, 0x10006802, 0x07030277, 0x7606008C,
+0x00A80002, 0x00000401, 0x3C120EF4, 0x30020856, 0x33B37083, 0x330F3371, 0x0018F876, 0x840029B4,
+0x00790800, 0xA2000C0F, 0x00012200, 0xB4000004, 0xC6DCA009, 0x6D186CB6, 0x2ACF4C14, 0x104013FC,
+0x763B0F3B, 0x00040402, 0x00077E00, 0x04020276, 0x07720200, 0x003B5221, 0x1408010F, 0x642A8600,
+0x6CF73B51, 0x29167537, 0x1501110F, 0x0101AE00, 0x820138B8, 0x11BA0207, 0xFFF7FF50, 0x02D670E7,
+0xC6722B22, 0x1408008E, 0x0093C200, 0x08059DC6, 0x1410000A, 0x00000402, 0x1000837E, 0x027E001E,
+0x0B000400, 0x8200027E, 0x00040411, 0x0001FA01, 0x7C020266, 0x09880104, 0x010C1600, 0x90000004,
+0x3C573009, 0x0004A878, 0x3C110500, 0x34010C82, 0x44579028, 0x2B313BF5, 0x76D52AEE, 0x01FC0F22,
+0x08520018, 0x0F8D3780, 0x152B5133, 0x020EF83C, 0x56120004, 0x441022D4, 0x88022D9C, 0x02820100,
+0x0000A401, 0x82022DC8, 0x033E0002, 0x008D1C00, 0xF4840286, 0x71337243, 0xA832CD3B, 0x01320103,
+0x1501630F, 0x8400280F, 0x00027A00, 0x7E000004, 0xEFFF8002, 0x5CD68537, 0x027E6D58, 0x7109FE00,
+0x3B0F32EF, 0x040F32EF, 0x078A0314, 0x11258E01, 0x002D0C10, 0x9E000A00, 0x18FA0016, 0x5EF07111,
+0xA2078E00, 0x4BF43331, 0x6CF76518, 0x12A095D9, 0x01056002, 0x9C051956, 0x01400130, 0x00026A03,
+0x7E02007C, 0x01210302, 0x01001803, 0xF740000E, 0x8250EFFF, 0x52336102, 0x9333B333, 0x93208C4C,
+0x0094DA33, 0x0800209E, 0x1904000A, 0x01140C03, 0x8A002314, 0x0004000C, 0x05119206, 0x1C001418,
+0x0C92021E, 0x038EDE00, 0x00000980, 0x00040005, 0x0005040A, 0x040004A0, 0x02A20000, 0x1C345721,
+0x3644300F, 0x60840E34, 0x2B102B72, 0x26642AAD, 0x03085E05, 0xC80000B0, 0x00D80000, 0x0000CC00,
+0x100105C0, 0x1F500300, 0xFFFFFEA5, 0x923B2FF7, 0x58239333, 0x0266000A, 0x0327D001, 0xAC01077A,
+0x0272010F, 0x0100A403, 0x341014C8, 0x3611881C, 0xBA00A262, 0x3BD47085, 0x32EE3331, 0x026CC832,
+0x7C034260, 0x012C0100, 0xAF00050F, 0xD79FEFC1, 0x65176474, 0x32D05455, 0x3109FCD0, 0x82EE3B0F,
+0x0C800002, 0x00000400, 0x82000500, 0x05000216, 0x10118200, 0x01259631, 0x86001908, 0x19080134,
+0x33313BA4, 0x5CD664F8, 0x1A9F6494, 0x042A0327, 0x00019200, 0x290F0004, 0xF7611A01, 0x4391EFFF,
+0x0052E251, 0x7A002D20, 0x00040007, 0x04231002, 0x7200027E, 0x07820202, 0x071B9000, 0x0C030504,
+0x050A008B, 0x06044800, 0x66010004, 0x904C0209, 0x04050C00, 0x00010004, 0x048C0005, 0x01050402,
+0x080304A8, 0x023A000A, 0x31445680, 0xB033102B, 0x0A026853, 0xD80100C6, 0x12720100, 0x0119F402,
+0x23010010, 0x000A0200, 0x2FBE9B80, 0x152B9233, 0x00117234, 0x8C020060, 0x3C56370F, 0x00166E56,
+0x2A0413EA, 0x0AB8030D, 0x308D1400, 0x7633B444, 0x0FE00035, 0x10337282, 0xBB3ACE33, 0x000064C6,
+0x5E020086, 0x00690100, 0xA400050F, 0x000C7601, 0xF7C103A8, 0x95F9F7FF, 0x64F75C96, 0xFCCF3B51,
+0xFAF0110E, 0x04F80004, 0x010A0006, 0x04010286, 0x0A040505, 0x001DFA01, 0x18001406, 0x02820046,
+0x60988800, 0x5C956D38, 0x0C8674F6, 0x00062400, 0x2A000414, 0x006C0401, 0x00001000, 0x330F0004,
+0xF7C21201, 0x53F2EFFF, 0x33723330, 0x54D33393, 0x34A80091, 0x10078002, 0x00192233, 0x08000500,
+0x028E020A, 0x00078600, 0x8A0B20A2, 0x29B20002, 0x01050201, 0x3C000464, 0xA4400390, 0x00048002,
+0x04000290, 0x00080105, 0x01110600, 0x04040C9A, 0x04361305, 0x2BB37005, 0x2ACE2B51, 0x0131F05B,
+0x30000354, 0x00C80015, 0x0000DC00, 0xEC000004, 0x00100405, 0x9100DC07, 0x53EFFFF7, 0xD4339164,
+0x01006C33, 0x6A050272, 0x0D160107, 0x04027600, 0x080090D0, 0x04FC0100, 0x02723C10, 0x05077A00,
+0x4371035E, 0x331022F0, 0x06AA3AED, 0x00050001, 0x78000150, 0x006C0700, 0xA9000B0F, 0x5C75EFB0,
+0x64965CD7, 0x3AEF2ACF, 0xEF110276, 0x10200504, 0x00027E3B, 0x10200C8E, 0x04050033, 0x080004FC,
+0x14080000, 0x02803110, 0x00280C03, 0x7220027E, 0x7185E243, 0x6D184C55, 0x1A996475, 0x01130838,
+0x0801A200, 0x0C0F0010, 0xEF101200, 0x711001C0, 0x332098DE, 0x032592D4, 0x82021E1C, 0x0C7E000C,
+0x00027E03, 0x92011186, 0x027C002A, 0x0101BE01, 0xFE000F10, 0x3BF52004, 0x140104FC, 0x140C000F,
+0x00078203, 0x7E00026E, 0x00040007, 0x000F1401, 0x0405027A, 0x077E0005, 0x0004AC00, 0x82000008,
+0x44565211, 0x52712B73, 0x027E0167, 0x0400BC08, 0xE00F0206, 0xEF910200, 0x3330D7DF, 0x33D443F4,
+0xCC000064, 0x5244130C, 0x0008042F, 0x00028601, 0x7E00A24E, 0x1B6E0102, 0x018BD003, 0x3CE200CA,
+0x3C143C15, 0x2B724415, 0x2A8D3311, 0x0D3D6098, 0x8E080082, 0x000C0F00, 0x01320099, 0xF1013E00,
+0xBDF7DF02, 0xD84C34BE, 0xAF43725C, 0xEE32EE32, 0x0504EF32, 0x060F0400, 0x8A030A00, 0x05000102,
+0x00281000, 0x0C00320C, 0x0F04000A, 0x00078E00, 0x8A00349E, 0x2B31B298, 0x54963352, 0x545464D7,
+0x10331E3B, 0x004892EF, 0xFE192D66, 0x780044E8, 0x012C0F00, 0x016A000E, 0xEFFFF790, 0x33506C94,
+0x1E103BD3, 0x00118A02, 0x540275DE, 0x119E0082, 0x0014100A, 0x14000504, 0x078A0023, 0x000A0000,
+0x08000C8E, 0x028A0000, 0x00045C02, 0xDE00028E, 0x1ADA0210, 0x01049801, 0x8A000204, 0x02960002,
+0x00050C00, 0x5735000C, 0x250E353C, 0x9233F473, 0x3633302B, 0xFE00A44C, 0x09E80006, 0x0004F000,
+0xCC000008, 0x000C0000, 0x01000400, 0xB80000D4, 0x00090000, 0xEFFFF790, 0x3BD38599, 0x057A33B4,
+0x00116200, 0x36400058, 0x023C1644, 0x00880200, 0x00007200, 0x220018E0, 0x95D00100, 0x41027200,
+0x143C1534, 0xD42028D4, 0x8100BC33, 0x23103C14, 0x224B2AEF, 0xDA00245E, 0x3BE0031C, 0x0F006300,
+0x01AB0004, 0xF7500282, 0x6CB6EFFF, 0xF0603D54, 0xEF32CF32, 0x21137C3A, 0x0F0432EF, 0x000C7E01,
+0x1000027A, 0x11860F05, 0x3E920004, 0x01281402, 0x10004124, 0x3372A15F, 0x5C965CD7, 0xB67B5C54,
+0x1C079C00, 0x012E0F09, 0x01CA001E, 0xEFFFF761, 0x087174F5, 0x04F8000F, 0x12027E01, 0x020C8A3B,
+0x8E030A0C, 0x2D20050C, 0x0606B600, 0x7A000C86, 0x3BF52002, 0x04011348, 0x0BEE0305, 0x0B020A01,
+0x30060C8A, 0x077E0228, 0x00023200, 0x578A1134, 0xB32B9344, 0x742AEE3B, 0x027A0027, 0x0200D00F,
+0x0200B402, 0xEF30001B, 0x253643B3, 0x56443640, 0x0202624C, 0xD80009FC, 0x02860018, 0x00027C00,
+0x98000004, 0x00040000, 0x0200AA00, 0x3E000004, 0x1B720003, 0x97000E00, 0x33D33C35, 0x1A2C1AAE,
+0x000A7C90, 0x820002EA, 0x00650207, 0xA500060F, 0xF0027E01, 0xF7FFFF03, 0x4C15C77F, 0x3C144C96,
+0x3AEF22AF, 0x02EF32CE, 0x82321005, 0x00040202, 0x00230802, 0x82040286, 0x05000202, 0x083B3022,
+0x1B8E020A, 0x30119200, 0x8A713330, 0x5F100002, 0x54B73381, 0x4C345496, 0x0005047C, 0xA000012A,
+0x04280053, 0x00043C00, 0x42000130, 0x00080001, 0x0900040F, 0x01003800, 0x01F008F2, 0x37F7FFF7,
+0xB43B9285, 0xD433F533, 0xB233D333, 0x82033C20, 0x0C920602, 0x00078A00, 0x8E020792, 0x0508010C,
+0x009B6407, 0xCE000508, 0x00040201, 0x00047C00, 0x0800364E, 0x02020005, 0x04000804, 0x04040296,
+0x3C563005, 0x61A58C16, 0x7133B43C, 0x2EF25433, 0x00013401, 0xF6030484, 0x00C80038, 0x01000404,
+0x7E0300CC, 0x00140002, 0xDDEFDF60, 0xC833B3BE, 0xB2520018, 0x07FE3511, 0x03028603, 0x88020306,
+0x00940000, 0x0200A000, 0x78020004, 0x00060007, 0x33F501F0, 0x2BD43C56, 0x026D2BB3, 0x09C90A2B,
+0x0F78C6DC, 0x001E4C00, 0x88000068, 0x00080000, 0xB000040F, 0x755AEF90, 0x44562BD4, 0x026A2331,
+0x7E32F020, 0x32EE5311, 0x04F03B10, 0x04FC040A, 0x020A0808, 0x76022310, 0x027A000C, 0x00000400,
+0x1C021182, 0x3B926073, 0x3BD42B72, 0x132242CE, 0x003AA444, 0x7E010126, 0x00090002, 0x0001A200,
+0x040F0008, 0x2C041100, 0xFFF77100, 0x928D78F7, 0x002CF83B, 0x60009660, 0x140C03A5, 0x03050405,
+0x82000500, 0x027E030C, 0x000F0407, 0xE8001344, 0x04680001, 0x0101F600, 0x12010004, 0x0C020002,
+0x00028402, 0x0400027E, 0x09AC0100, 0x02161E01, 0xF66013A0, 0x5133D433, 0x04175833, 0xCC0000B3,
+0x05000800, 0x04026E00, 0x6204001C, 0x033A0003, 0x36647551, 0x31CC3744, 0x00027E00, 0xEA00005C,
+0x02DE0002, 0x00000800, 0x90040084, 0x44164000, 0x00043BF5, 0xCC3BF622, 0x1601F1AE, 0xD534153C,
+0x731B532B, 0x4D13311B, 0x7E0A2B02, 0x1E740207, 0x05011404, 0x090F0071, 0xF7D0AA00, 0x1B52E7FF,
+0x2B9223F5, 0x126D0A4D, 0xF0808B9A, 0x0F2AEF32, 0x8A2AEF33, 0x0A000602, 0x030C9600, 0x33120504,
+0x8E000008, 0x19120011, 0x00411E00, 0x10000004, 0x0F0C023C, 0xB2642000, 0x33932B72, 0x4C964CB7,
+0x96B94413, 0x12B0032F, 0x0001AA00, 0x080004D8, 0x01380F00, 0x016A000E, 0x00000400, 0x4C000029,
+0x928D5009, 0xF03C143B, 0x33B32027, 0x1C02280C, 0xB06A001E, 0x000A0402, 0x9A010014, 0x1410001B,
+0x00000404, 0x3B120504, 0x4C00027E, 0x04640009, 0x030A0802, 0x74039A3C, 0x02860013, 0x001D7804,
+0x18040C0A, 0x25C2000A, 0xB42BD561, 0x7E3B2F33, 0x008A0009, 0x010E8001, 0x9C0300C0, 0x000C0000,
+0x00028E02, 0xEE020298, 0x514000B0, 0xD3D79F71, 0x773C3543, 0xCE00AEAC, 0x3435402C, 0x005C3436,
+0x109ABC00, 0x0018E035, 0xE4030004, 0x027E0218, 0xF2027600, 0x15343609, 0x9323F42C, 0x32137313,
+0x7213930B, 0x4C0AF013, 0x5601EA02, 0x0223748D, 0x86030081, 0x000D0411, 0xA700080F, 0xFFF709F0,
+0xB4961AF7, 0x111C161B, 0x6D126D1B, 0x6E126C12, 0xAE1A6D1A, 0x91DACE22, 0x02823310, 0x01190004,
+0x94000008, 0x1E100725, 0x020F0400, 0x31200004, 0x004D9633, 0x14002586, 0x00040023, 0x207D2400,
+0xB6203393, 0x9943F430, 0x6C000282, 0x11EC0034, 0x0F03C401, 0x1022063E, 0x205092F7, 0xB91C3372,
+0x933BF530, 0x3B211180, 0x00B2E8B3, 0xD6000282, 0x07820498, 0x0019140A, 0x0400094C, 0x027A0000,
+0x00000400, 0x7C000506, 0x070A0007, 0x02000408, 0x06040504, 0x04AC0200, 0x363C56A0, 0xF633F544,
+0x5433933B, 0x01E70F17, 0x02820300, 0x02001A08, 0xDFA00284, 0xBAEFFFFF, 0x77441495, 0x00004A4C,
+0x08010276, 0x14780100, 0x35255E00, 0xD8143C35, 0x031E0022, 0x963C3620, 0xF50BF702, 0x9323D52B,
+0x7313931B, 0x730B930B, 0x730B9403, 0x4D1BB40B, 0x0A026C02, 0x0802FE0A, 0x0C0F006D, 0x1C00AA00,
+0xFF0DF01A, 0x933BF2DF, 0x6D1BF50B, 0x8D128D02, 0x4D1A8D12, 0x4D1A4D12, 0x8D1A8E1A, 0x6022AE1A,
+0x04F80094, 0x00000404, 0x040409F8, 0x09FC0000, 0x00000C00, 0x0C000F08, 0x0F080032, 0x00078200,
+0x24020F0C, 0x5F1C005F, 0xCC339320, 0x3BF44149, 0x14107D59, 0x0F360400, 0x00181CBC, 0x580001CA,
+0x04600004, 0x9006D601, 0x7CEFFFF7, 0xF543B3AE, 0x4007223B, 0x2B932BB3, 0x1000027A, 0xC2F41119,
+0x078A0643, 0x08141800, 0x92000A08, 0x0952000C, 0x0201EA00, 0x8A060280, 0x00100002, 0x04070A00,
+0x82020008, 0x029A0002, 0x00021200, 0xF5410032, 0x583B923B, 0x01EE0026, 0x00027208, 0xD803000C,
+0x00AC0005, 0x07000400, 0xEF300AE8, 0x485E5455, 0x0036BC04, 0x0C000D02, 0x3C16310A, 0x11B62EF6,
+0x002CD035, 0x36E00574, 0xF5345634, 0x9323F523, 0x720B9313, 0x60027A03, 0x0B930B93, 0x00060BB4,
+0x8E03307D, 0xF1022B02, 0x6C002076, 0x008F0000, 0xAC00040F, 0xB75FEFB0, 0x1BD41B50, 0x0A8E0B72,
+0x8D60027E, 0x6D1A8E12, 0x4005041A, 0x1A6D1A6D, 0xAE20028A, 0x002F8A22, 0x7000116A, 0x02720007,
+0x0309FC02, 0xF4011404, 0x0C82000E, 0x00050004, 0x1C005A28, 0x28180055, 0x313B73D4, 0x77339433,
+0x14445744, 0x0282373C, 0x1120EE03, 0x0F24C2DF, 0x000D013E, 0x7E010166, 0x00290002, 0x3001EE02,
+0xEEB6BDEF, 0xBD1C004D, 0x02077600, 0x7A000282, 0x28240002, 0x00050200, 0x04000A00, 0x0A040200,
+0x00027A00, 0x08010F0C, 0x0A100900, 0x00026200, 0x08020274, 0x09880100, 0x030A1001, 0x10002334,
+0x163C4114, 0x9BAA563C, 0x1AF8B610, 0x00008000, 0x040F0088, 0x82010C00, 0x94AA0002, 0x5455B650,
+0xBB3654B8, 0x0020C200, 0xE600433E, 0x02820102, 0x18E44411, 0x70B26E00, 0xF534363C, 0xF01BB423,
+0x02720004, 0xB303B3A0, 0x9403930B, 0x040B930B, 0x0BB4C100, 0x02D013B3, 0x122B028D, 0x0380BF1D,
+0x0C007A0F, 0x9D001F0F, 0xFFEFDFE0, 0x514CB5E7, 0xAF1B9213, 0x7E0A6D02, 0x07840007, 0x6D1A6ED1,
+0x8D1A6E12, 0x8D1AAE12, 0x000C8E1A, 0x5A126D20, 0x2AEF309A, 0x01488E30, 0x78009CAE, 0x4B140099,
+0x100A0000, 0x0022AA30, 0x8A007D18, 0x5A180111, 0x009C0A02, 0x7360209E, 0x9333933B, 0x4308FC33,
+0x6CD63BF3, 0x82010504, 0x02560002, 0x0F000400, 0x00090134, 0x040004FC, 0x017C0400, 0x000A3800,
+0x1EA04B9C, 0x144BD3BF, 0x35445644, 0x00966644, 0x94000282, 0x05080011, 0x08028002, 0x38010A08,
+0x0A0C004B, 0x0416A203, 0x00010296, 0x13640105, 0x02276400, 0x06020288, 0x02260200, 0x00029600,
+0x36810736, 0x7144153C, 0xD8BEFE3B, 0x00AD0C2D, 0x00029203, 0x04000326, 0x00A80000, 0x00027E01,
+0x01F00A22, 0x9674F6E7, 0x1454D854, 0xF53C353C, 0x16341633, 0xD400A726, 0xA9B00127, 0x341605F1,
+0x34363415, 0x13B41BF4, 0x0B730B72, 0x0BB30392, 0x04FC0BB3, 0x00730320, 0x027E0105, 0x52139460,
+0x9A0B7203, 0x74CC1401, 0x00800323, 0x0008BE00, 0x04000070, 0x00130300, 0xA300070F, 0xDFFFF7E0,
+0x13931B30, 0x0A6D1B72, 0x6E6D128E, 0x00040002, 0x126E1230, 0x8D400272, 0x86128E12, 0x1A8E5002,
+0x188E1AAE, 0x6E125005, 0x521A8E12, 0x0C66019F, 0x304D9604, 0x9C333033, 0x0504005C, 0x23103113,
+0x61002000, 0x3B523B52, 0x50304373, 0x33932B30, 0xD33249BC, 0x39A0953B, 0x1ABCF710, 0x1C0B420F,
+0x0301EA03, 0xEFB0028E, 0x5414C73E, 0x54975455, 0x02764456, 0x02118400, 0xB310168A, 0xA0003E9E,
+0x34A6001B, 0x00000C01, 0x040004F8, 0x05040400, 0x00078600, 0x58000004, 0x02700207, 0x00000602,
+0x0401071E, 0x111A0905, 0x30140800, 0xC6133BF4, 0x01E20FB5, 0x020A040A, 0xA0021A04, 0xD79FF7FF,
+0x64F85C74, 0x1B4654B7, 0x7E3C5720, 0x7E361002, 0x5734C01B, 0xF62C3634, 0x9423B42B, 0x0266531B,
+0x0BD40340, 0x20076AB4, 0x0282B403, 0x039303A3, 0x0B940BB4, 0x04731394, 0x03317000, 0x0A4C0AF0,
+0x090B40D8, 0xBA0F0080, 0x2D090D03, 0x000D0F00, 0xFFF7D285, 0xF08DF9EF, 0xAE139202, 0xF8126D0A,
+0x1A6D5309, 0x7E8E126D, 0x0A100002, 0x42028200, 0x128E128E, 0x8A040282, 0x128E6002, 0x22CF1AAF,
+0x9600A1C4, 0x3350516B, 0xA2503350, 0x1186022A, 0x00208E01, 0x3B200510, 0x116E1C31, 0x94821833,
+0xF43BD333, 0xF343B343, 0x00050453, 0x460F04CC, 0x7A031201, 0x01E20002, 0x00325200, 0xDF200034,
+0x82649AEF, 0x4C755C33, 0x4C7654D8, 0x0600027E, 0x07820000, 0x01078A00, 0x2C000506, 0x0282003C,
+0x08000801, 0x8E000C92, 0x00040202, 0x08050400, 0x8A020004, 0x00060802, 0x30C38400, 0xF8F94415,
+0x0088071A, 0x04008400, 0x0C0001D5, 0x009C0000, 0x0004FC00, 0x1001027E, 0x015A0000, 0x64B69570,
+0x44565CF7, 0x37C004FC, 0x163C5734, 0xD434162C, 0xD41BD41B, 0x0C5A0009, 0x02026A03, 0x0320076E,
+0x1104F894, 0x01077A03, 0x26000500, 0x0A0E0000, 0xAE02F060, 0xD6126C02, 0x2446003A, 0x01006805,
+0x82040DC8, 0x00080F00, 0xFFF7B2A6, 0x7222EEE7, 0x6D0B511B, 0x2109EE12, 0x0504226D, 0x1A8E1230,
+0xFC01027C, 0x7E121404, 0x02820302, 0x1AAF1290, 0x1AAF1AAE, 0x00081A8E, 0xAF1A8F80, 0x0F22EF1A,
+0x0002822B, 0x00000EF4, 0x027E000F, 0x005F2000, 0x04003214, 0x5F1C0000, 0x108EA600, 0x51C6A093,
+0x1343B343, 0x0002825C, 0x390F0C86, 0xFA031501, 0x002F0001, 0x0001DE00, 0x5C0002BA, 0xD79FA013,
+0x5C966475, 0x4C765CD8, 0xD43066FA, 0x04F8B43B, 0x01141403, 0x7E000282, 0x00140002, 0x022F9E01,
+0x7E060272, 0x05040107, 0x00B33001, 0x74000282, 0x00080402, 0x1D801512, 0x01050800, 0xF311B96C,
+0x98038A44, 0x00850028, 0x0500040F, 0x0119E803, 0xEF90001F, 0x64F76CD6, 0x33F56539, 0xD5A0114E,
+0x941B9423, 0xB30B731B, 0x10076813, 0x6004F4B3, 0x9403B403, 0x04ECB503, 0x0B940B41, 0x00000895,
+0x94100A00, 0x0B12050C, 0x9A000F00, 0x0B116007, 0x5C9412CE, 0x800002DC, 0x005A0102, 0x0F07DC00,
+0x030E3ADA, 0x070F002A, 0x34017000, 0x00880003, 0x0301C600, 0xC6010DAC, 0xFFFFE106, 0xCFA6FEEF,
+0x100B1012, 0x4C0A4C13, 0x4C200C6E, 0x000A0012, 0x8D4009F4, 0x04126D12, 0x05000200, 0x000C9600,
+0x8C000782, 0x04FC0002, 0x0286AE10, 0xF1000403, 0xAE128E02, 0xCF12AE12, 0xF01ACF1A, 0x51233022,
+0x7AA6512B, 0x000C8E00, 0x96002F9A, 0x0C8A0002, 0x004DA602, 0x714009A6, 0x824BB133, 0x02460002,
+0x00043000, 0x0C00009B, 0x01640000, 0x00001000, 0x0C010262, 0x00190000, 0x0000040B, 0x0400001C,
+0x00200000, 0x40028200, 0x6C94DFBF, 0x97200282, 0x0069A454, 0x8E001E20, 0x00040007, 0x01050E00,
+0x33100C9E, 0x04031D42, 0xBE7C0100, 0x00503C00, 0x8A001424, 0x0CA60002, 0x20B6D513, 0x0011A200,
+0x7E000014, 0x029C0002, 0x80146800, 0x54B73C15, 0x7D574C54, 0x340109FC, 0x01400301, 0x03008401,
+0x0C000484, 0x01640400, 0xA000C005, 0xB6BEDDEF, 0x155D3964, 0x074AB42C, 0x600C4E03, 0x03930B94,
+0x04F80B93, 0x31000400, 0x10B403B3, 0x03733100, 0x10116A74, 0x30078093, 0x000B940B, 0x0B72200A,
+0x93800002, 0x1003520B, 0x52126C03, 0x027E006F, 0x02000400, 0x0000F168, 0x00740401, 0x0F01230B,
+0x0085000F, 0x9C01027E, 0x00C60200, 0x70000B01, 0xF04414E7, 0x7A1B310A, 0x0EEC000C, 0x00028400,
+0x040009F8, 0x0F0C0000, 0x11000802, 0x0109FC8E, 0x0801027E, 0x1AAF260A, 0xCF20027E, 0x40027A1A,
+0x1ACF12AF, 0x06000004, 0x00100000, 0x00A99800, 0x72102086, 0x3310872C, 0x04000500, 0x05040100,
+0x302A4601, 0x82913BB2, 0x2A920102, 0x0001BE01, 0x3C03009C, 0x00100004, 0x0F009C01, 0x00110005,
+0xDF9211CE, 0x6CF86475, 0x4C776519, 0xB35004FE, 0xB343D333, 0x2C04141A, 0x0A08002D, 0x00000403,
+0xCA001190, 0x02660029, 0x00000402, 0x2C00AD02, 0x3ECA0023, 0x000A2000, 0x8400000C, 0x02800018,
+0xA133F600, 0x54B74C98, 0xC73E5454, 0x027EF7FF, 0x0F009400, 0x080000A8, 0x820000B4, 0x0D220002,
+0xD774D680, 0xB44CD85C, 0x00026A13, 0x942009E0, 0x00000603, 0x08060272, 0x028E0200, 0x04FC9411,
+0x930B9451, 0x11709213, 0x21028201, 0x05047213, 0x31035268, 0x7E3B700B, 0x006C0807, 0x0F008F00,
+0x008B0004, 0x280500AE, 0x03BC0003, 0x20013E01, 0x41BDFFDF, 0xEFDF05F0, 0x0A6DDFFF, 0x12EF12F0,
+0x124D0A4D, 0x124C1A6D, 0x00081A6D, 0x0004F802, 0x040004FC, 0x078A0000, 0x01000402, 0x08010282,
+0x12AE230A, 0x12100504, 0x7A00028A, 0x00040002, 0x13027A00, 0x00028ACF, 0xAF100010, 0x1AB00512,
+0x23502330, 0x2B712B71, 0x19103392, 0x82000400, 0x33912B92, 0x434F3B90, 0x26009396, 0x782C0218,
+0x0000A800, 0xC2000004, 0x00B80001, 0x12015A0F, 0x0BE8F710, 0xF86C9580, 0xF46D3964, 0x002D1E3B,
+0x00004DC0, 0x52BE0005, 0x0020A208, 0x94001E18, 0x00080007, 0x00000400, 0x24020A10, 0x02920114,
+0x0B48CE00, 0x14900004, 0xF83C3534, 0xB564D75C, 0xF0004454, 0x0326001D, 0x0404F407, 0xC4000484,
+0x00AC0573, 0xA1002402, 0x75CF9FF7, 0xB85CF85C, 0x04E45244, 0x00027602, 0x0406028A, 0x02660100,
+0x01050E00, 0x9E000510, 0x0B723102, 0x420F0C72, 0x03930373, 0x7382027E, 0xF00B520B, 0x7A963A12,
+0x011C0016, 0x00000400, 0x7C040120, 0x00780500, 0x9A00090F, 0x6001DE03, 0xAE7D36EF, 0x0EF8CF1A,
+0x00027E03, 0xFC010A04, 0x0EEC0113, 0x761A8D20, 0x00040407, 0x20027E02, 0x0C8A1AAF, 0x04027600,
+0x6A010004, 0x02760302, 0x02027E00, 0xF0110004, 0xCF20027C, 0xF202DE12, 0xCF12EF0C, 0xEF1AEF12,
+0x1023101A, 0x722B5223, 0xB22B922B, 0x7033B22B, 0xBF3B2F33, 0x18012D24, 0x015A0019, 0x0F000400,
+0x701E0149, 0x9CF7FFF7, 0x226CF7B6, 0x3BD420B6, 0x3C00027E, 0x0282005F, 0x00077E00, 0x84020272,
+0x000A00AA, 0x00052202, 0x5000000A, 0x43D5205A, 0x6600554C, 0x077A0007, 0x00000803, 0x01F0B20A,
+0x5534143C, 0xF534143C, 0x194C763B, 0x7C64B665, 0x9702A0B2, 0x025E0200, 0x07000C02, 0x12010006,
+0x00100702, 0xB9F7FFA0, 0xF854B68D, 0xD21BB454, 0x027E0209, 0x0500B410, 0x00028E05, 0x040013DC,
+0x13B42400, 0x931013E8, 0x0B211B6A, 0x0018F873, 0x92100518, 0x0B40078A, 0x7CCF1352, 0x61DA030C,
+0x00012000, 0x7E000004, 0x006F0802, 0x87000C0F, 0x08011A00, 0x7C0000B2, 0x027E0007, 0x6118F801,
+0x8D226CE7, 0x04FECF0A, 0x6C126C40, 0x02050012, 0x04000782, 0x0004000A, 0x0F0C8D17, 0x000A0801,
+0x0C00027E, 0x0004010F, 0x01028203, 0xFC000504, 0x028A0004, 0x0212CF20, 0x02720100, 0xF0027600,
+0x0ACF1202, 0x12F012F0, 0x12EF1B10, 0x12CF1AEF, 0x02921AD0, 0x101310E2, 0x0F12EF13, 0x8D12EF13,
+0x28D79F1A, 0x00980032, 0x04059400, 0xA400014A, 0x000C0400, 0x0A00080F, 0xC1021200, 0xD8EFFFF7,
+0x58753795, 0x515CF86D, 0x2C001910, 0x5048002D, 0x5CCAF315, 0x000A0E02, 0x7E00D396, 0x05000002,
+0x10000400, 0x01AA94F5, 0x10060A14, 0x3BF4800A, 0x34143414, 0x0A263434, 0x30669E00, 0x62DF64B6,
+0x0068025C, 0x00083201, 0x04000150, 0x00980000, 0x00000800, 0xB0000164, 0x000C0000, 0xC1021A01,
+0x33EFFFF7, 0xD754D74C, 0x730B5244, 0xF8000272, 0xD8B41109, 0x09DC0009, 0x01025E00, 0x6E010008,
+0x0B933107, 0x601B6A72, 0x0B720B73, 0x09F61373, 0xB30B7251, 0x0F0E720B, 0x310B9460, 0x2C6D1713,
+0x0058030B, 0x00008001, 0x1000006C, 0x00080000, 0x00007401, 0x040F0089, 0x42008F00, 0x063E0901,
+0x2BAE9CB1, 0x8E0A8E0A, 0x4D124D0A, 0x4C201DF8, 0x20027E12, 0x11821A4D, 0x00027E00, 0x040C1908,
+0x0F040005, 0x0005040C, 0x040609F6, 0x02800000, 0xEF12CF80, 0x1012EF12, 0x00027C13, 0xEF110004,
+0x10600508, 0x111B101B, 0xE0027E1B, 0x0B101330, 0x0AF00AF0, 0x1A4C12CF, 0x014CC71E, 0x0F9D9A03,
+0x01200146, 0xF7D00182, 0x74D5EFFF, 0x6D7A6D18, 0x2B724C35, 0xD320209A, 0x11000233, 0x0048C2F3,
+0x0400281C, 0x09FE0000, 0x002FA600, 0xBA000004, 0x0008002F, 0x0220CA00, 0x6C000004, 0x00040027,
+0xD4077600, 0x2C142BF4, 0x443623B3, 0x64D76519, 0x001FF698, 0xC20005A6, 0x00A40F08, 0x07820000,
+0x00020E00, 0x6200001B, 0xA67B91A3, 0x44F74C54, 0xE0732C36, 0x05000013, 0x02509311, 0x00115E02,
+0x04001B56, 0x05000000, 0x01027E01, 0x731304F4, 0x52200500, 0xB011760B, 0x03730B72, 0x13930BB5,
+0x209F1B10, 0x01BC0001, 0x03000400, 0x680001C0, 0x00040000, 0x00007404, 0x040F000C, 0xA2088300,
+0x000C0000, 0x0301AE00, 0xF7B00B4A, 0x124C3B4F, 0x0A6D0A8E, 0x09FC0A2C, 0x20050000, 0x02821A4C,
+0x000F0402, 0x00000286, 0x00080405, 0x000A0402, 0x8200078E, 0x00040307, 0x0004FC00, 0x7E010004,
+0x12AE810C, 0x12CF12AF, 0x02821AF0, 0xFCEF0A21, 0x04F00004, 0x8A0AF022, 0x000C0002, 0xEF12EF60,
+0x8413510A, 0x1B32B002, 0x0AAF0AF1, 0x122B128E, 0x00DF9EDD, 0x62000A98, 0x00040401, 0x006AC603,
+0x5A0F00B4, 0xD0000901, 0x0F080000, 0x1CF7FF60, 0xBE64B5CF, 0x33B3A0C2, 0x34152BB3, 0x33F42BD3,
+0xF4600004, 0xD433F433, 0x7000062B, 0x2BF433F5, 0x40F433F5, 0x2B05F028, 0x2BD42BF4, 0x2BD42BF5,
+0x23B42BD4, 0x1BB323D4, 0x1E931BB4, 0x931B8111, 0x7213521B, 0x0E7C5113, 0x971373A0, 0x9454F844,
+0x2CCF5F5C, 0x01340017, 0x0004E800, 0x04000070, 0x00940400, 0x20000C00, 0x0280F7FE, 0x0132EA00,
+0xF7900004, 0x6494E7FF, 0x3CD84496, 0x72021DC8, 0x1DD00002, 0x0209D600, 0xDA010272, 0x04F40013,
+0x0118F002, 0x731504F8, 0x526004FC, 0x720B520B, 0x530A380B, 0x139303B4, 0x002374D2, 0x24000108,
+0x00700010, 0x00000400, 0x14000080, 0x00080000, 0x9F00040F, 0x6000C200, 0x120BD79F, 0x0EFA0A6D,
+0x077A4D12, 0x030A0403, 0x1A540500, 0x1A8D126D, 0x0804140C, 0x1410020F, 0x000F0002, 0x82030282,
+0x0F040207, 0x11821A10, 0x0762CF10, 0x10000400, 0x0004F412, 0x0000077A, 0x00040205, 0x10131151,
+0x05003013, 0x3212F080, 0x1112F11B, 0x62028213, 0x11EB0A6D, 0x0B62B6BC, 0x00015205, 0x82030286,
+0x015E0F02, 0x00300012, 0x37EF03F6, 0xF84C557D, 0x5233F454, 0x7213311B, 0x521B511B, 0x13100002,
+0x04020014, 0x13323700, 0x00000252, 0x840306F2, 0x74131204, 0x13B32018, 0x8E000220, 0x555A5004,
+0xE0F64CB7, 0x06F60565, 0x0029FE00, 0x940C013C, 0x029A0000, 0x0100BC00, 0xF7A3001C, 0x3BD2C77F,
+0x245644B7, 0x02115E73, 0xB4220EF0, 0x000F0C0B, 0x0400005E, 0x1DF00000, 0x10000400, 0x12027A92,
+0x0009F813, 0x00F00286, 0x13730B52, 0x0B730B52, 0x13F513D4, 0xEEBD1372, 0x006F0134, 0x01006000,
+0x05070009, 0x00140F00, 0x001F0701, 0x70000B0F, 0x0300A201, 0x0C010636, 0x05C20400, 0x6C94EFD3,
+0x0A6D0A0B, 0x126D0A4C, 0x04FC0A4C, 0x044C1220, 0x078E000F, 0x086C1A21, 0x05000114, 0x00000A01,
+0xFC00028E, 0x1B920504, 0x000F0803, 0xF80013FA, 0x00040204, 0x00118E01, 0x1A100506, 0x08010782,
+0x09F80105, 0xEF12F030, 0x0A400A08, 0x04EF1310, 0x079A0100, 0x02131120, 0x0AD0A200, 0x0A8D0A8E,
+0xA65A09EA, 0xA4010A08, 0x00B00000, 0x0F0E7000, 0x00100140, 0x180001F2, 0x0F460004, 0xD7BF07F2,
+0x3C5643B2, 0x0B1144B8, 0x0B511352, 0x13311331, 0x0B311332, 0x3121026E, 0x1004580B, 0x00045C13,
+0x08040968, 0x0B532000, 0x82000978, 0x0B732002, 0x7230072E, 0x0990B303, 0x0B5213A0, 0x44D82C56,
+0x987B4C75, 0xE0FF1200, 0x009C0065, 0x000AA800, 0x72000097, 0x007C0002, 0x00000400, 0x10022C90,
+0x001E0100, 0x7558EF73, 0x34973435, 0xE201026E, 0x1DDA000E, 0x01027400, 0xF0001DE0, 0x620B1004,
+0x165E0002, 0x80037220, 0x02720200, 0x00001000, 0xAC020098, 0x1C157100, 0x239313D4, 0x0248E8FF,
+0x80001CAA, 0x007C0000, 0x00000400, 0x10080078, 0x00140000, 0x9700040F, 0xFFF7DF70, 0x2C11EAEF,
+0xFC00077A, 0x0C7C0004, 0x1A4C1A41, 0x10027E4D, 0x0111866C, 0x00000A04, 0x02820005, 0x02168E00,
+0x04000004, 0x05040A0F, 0x077EAF11, 0x000C7E00, 0x72000004, 0x66AF1111, 0x0508000C, 0x0C8CD010,
+0x51050C00, 0xF012D01A, 0x02078612, 0x1B27027E, 0x400282F0, 0x026E0ACF, 0x4E000282, 0x0460005B,
+0x00015608, 0x560F0166, 0xDE001301, 0xEFFFA034, 0x3C368578, 0x1BD43497, 0x514001C2, 0xEC13320B,
+0x50311104, 0x54721004, 0x027E0104, 0x00046000, 0xE20301EA, 0x53137010, 0x920B930B, 0x11027E0B,
+0x000C1074, 0x93A10212, 0xD80B5313, 0x3444B73C, 0x010BFC44, 0xE6000083, 0x00090002, 0x00009408,
+0x10010270, 0x0A1C0000, 0x7003DA04, 0x5633B3E7, 0x4234772C, 0x116E0107, 0x030A0400, 0xF000076E,
+0x00040204, 0x02007000, 0x0E0004F4, 0xA4531103, 0x028A0100, 0xA2029A00, 0xB40B5213, 0xF4245613,
+0x4ECCBA23, 0x0818EC01, 0x88000118, 0x00040F00, 0x00B60193, 0x03045000, 0x100306CE, 0xF9F7A000,
+0x2C09CA9D, 0x4C0A4D0A, 0x000A027C, 0x02860005, 0x00140803, 0x040409FC, 0x0C8A0000, 0x01000400,
+0x00000A08, 0x2320000F, 0x00000800, 0x04000282, 0x16960100, 0x070F0400, 0x82030004, 0x82D01302,
+0x07880202, 0x1012EF31, 0x03F00282, 0x13310B10, 0x1B510B10, 0x026E02CF, 0x11EB0A2C, 0x09CA8D77,
+0x001DE200, 0x4C012242, 0x06FA0109, 0x09016A0F, 0x0101FE03, 0x01F02AD2, 0xCF5FF7FF, 0x2C5733D4,
+0x0B712C56, 0x0B520351, 0x321104FC, 0xFC00050C, 0x04640004, 0x01DE7213, 0x02000801, 0x13410488,
+0x70921373, 0x0212001D, 0x1004A000, 0x810E7C92, 0xB71BB413, 0x983C343C, 0x160418F8, 0x63CC0003,
+0x00007000, 0xF0070004, 0x23CC0004, 0x00028001, 0xFFB1A124, 0xB39E1BEF, 0xD4247723, 0x0EFC7313,
+0x00026E00, 0x04010EE0, 0x04EC0100, 0x00056C02, 0x06020276, 0x00980003, 0x4013E800, 0x03520B73,
+0x52200008, 0x80009E13, 0x34552435, 0xC7DF2392, 0xB4001978, 0x00040401, 0x07010C01, 0x100101D0,
+0x00050F00, 0x01360092, 0x010E6A00, 0xEF9200AD, 0x0A0B32EE, 0x0A2C0A4D, 0x4C1004F4, 0x00020008,
+0x027E0105, 0x01118A00, 0x0800140C, 0x041A1614, 0x07820005, 0x00050400, 0x040209FC, 0x0A0C0200,
+0x0104FC01, 0xCF241B8E, 0x2005041A, 0x116E1AAF, 0x00078400, 0xF022117A, 0x00027C1A, 0x7E010006,
+0x101B6002, 0x30133013, 0x13B20282, 0x12F01331, 0x0A2C0A4E, 0x6ACE09CA, 0x0700AA01, 0xB201F2D8,
+0x00050F00, 0xB7EF8113, 0x7723F55C, 0x076E922C, 0x10077A02, 0x01078252, 0xEC000004, 0x00040609,
+0x02070200, 0x0000050C, 0x1D700205, 0x00072402, 0x77700286, 0xD23C762C, 0x0E7C7F3B, 0x10007A00,
+0x0E0782F7, 0xAA041E00, 0x01580000, 0x92000C01, 0xD2EFFFF7, 0x362C363B, 0x000A4C1C, 0x82000C82,
+0x00040702, 0x010EEC00, 0x820318DC, 0x05980002, 0x00057E01, 0x9000028E, 0x86321000, 0xB7136016,
+0xB634143C, 0x7E001F28, 0x05000100, 0x07000901, 0x70010005, 0x00100700, 0x83000B0F, 0x0000A600,
+0x0800033C, 0x01260000, 0xD303B800, 0xD75FEFFF, 0x124D09CA, 0x128D0A2C, 0x4000024C, 0x124D122C,
+0x10010004, 0x0C8A0405, 0x06209400, 0x10010004, 0x2096021E, 0x00050401, 0x0400140C, 0x1DFE0000,
+0x0004FC00, 0x08010504, 0x028E001E, 0x00000400, 0xCE30168A, 0x0002EF0A, 0x000C8E01, 0x08000C92,
+0x0F24000A, 0xF2000C00, 0x300B0F06, 0x310AEF0B, 0x11131013, 0x2D0AAF1B, 0xCA020B02, 0x25A09309,
+0x012A9A01, 0x570F00B4, 0xA0001001, 0x00DC0004, 0xB00A0400, 0x2373A6BE, 0x13F41C15, 0x74720331,
+0x51137102, 0x3213520B, 0x02050C0B, 0x5C000E58, 0x680B100E, 0x04660004, 0x00051800, 0x92110972,
+0xA401050C, 0x072A0004, 0x0B930392, 0x34552476, 0x0D165453, 0x00008304, 0x94000F04, 0x00040000,
+0x00007000, 0x14040018, 0x079E0100, 0xEFFFF7A1, 0x1B51B73E, 0x52F513F4, 0x03522402, 0x080C04EC,
+0x00800600, 0x02009C00, 0x9000030A, 0x7200F000, 0x310B320B, 0x350B320B, 0xF33C962C, 0x16F8FD3B,
+0x0004EC03, 0xC8000070, 0x00740001, 0x01000C00, 0x0D010084, 0x00050F00, 0x09260199, 0xF7FFF790,
+0x120C6C53, 0x0EF80A6D, 0x000C7200, 0x0C000504, 0x25820000, 0x02118A00, 0x08000004, 0x2316010A,
+0x010F0800, 0x04020004, 0x0504090A, 0x7AAE1A20, 0x00040702, 0x0282CF11, 0x00078200, 0x8600027E,
+0x0AEF200C, 0x0400140C, 0x05040500, 0x1AD01A50, 0x14201AF0, 0x0020FA00, 0x11C8027E, 0xF01B111B,
+0x0B024D12, 0x2811EA0A, 0x015C0FB4, 0xF7DFA11D, 0x2B72E7FF, 0x14151BD4, 0x00010272, 0x0B52310A,
+0x000EF072, 0x7003078A, 0x04740002, 0x00000403, 0xF4000012, 0x02120015, 0x00051C00, 0x93A01B02,
+0x560BF503, 0x5C1B911C, 0x0101EAA6, 0x8901025A, 0x01F40B00, 0x010F7400, 0x05050018, 0xFFF7B000,
+0xB354B6E7, 0xB31C3613, 0x0007CE03, 0x58010F44, 0x04F40005, 0x000E0B10, 0x0304E400, 0x0A0304F8,
+0x88521108, 0x0D060000, 0x3000A801, 0x3E13520B, 0x44B86A0D, 0x4C344496, 0x660502FE, 0x00090F00,
+0x03A4049E, 0x01014E00, 0xEF650344, 0x124D19EA, 0x130EF88E, 0x110EF82C, 0x0002924C, 0x1000028E,
+0x0286000F, 0x0A084D17, 0x0A078600, 0x8A021E10, 0x1692000C, 0x011E1000, 0x7E00028A, 0x00040102,
+0x00028200, 0xCF31140E, 0x0F10D012, 0x1692AF11, 0x501B8E00, 0x12D012F0, 0x120A10F0, 0x000C861A,
+0x31400F14, 0x9E0AEF13, 0x022D7011, 0x09CA0A4C, 0x0029EC32, 0xE20E0F00, 0x017C0D01, 0x01021400,
+0x300005D4, 0x001E0000, 0x64D7E7E1, 0x13F50B73, 0x0B300B51, 0x00520B30, 0x0504000F, 0x00000400,
+0x14000C96, 0x9E51110A, 0x0C920007, 0x13027E00, 0x01051853, 0x13200008, 0x60022832, 0x15143603,
+0x0E7CD20C, 0x0109DC00, 0x860106FE, 0x14A40002, 0x00263603, 0x50000078, 0x00040101, 0xB0FAEC03,
+0xDFFFF7FF, 0x13D41310, 0x809203B3, 0x93134002, 0x05583213, 0x021DD401, 0xE402027A, 0x05720004,
+0x03007A00, 0x13130008, 0x0B210822, 0xC2000251, 0x23D41352, 0x44564CD8, 0xEFFF8DFB, 0x6C014230,
+0x0BC00300, 0x0F000C01, 0x00100118, 0x040F010B, 0xB6017700, 0x00C20000, 0xB200BA00, 0x0B9DD9F7,
+0x4D1AAF12, 0x6E1A8D0A, 0x02720007, 0x0F086D11, 0x0409F800, 0x00000004, 0x208E010A, 0x050A0001,
+0x14010C7A, 0x09FC011E, 0x00230C00, 0x12112808, 0x0400027A, 0x07820414, 0x10CE1225, 0x0A04011E,
+0x010A1401, 0x0800050C, 0x027E010F, 0xF01AF140, 0x00027212, 0x3080169A, 0x310B0F1B, 0x1013101B,
+0x0A6E7000, 0x0A0A0A6C, 0x00336CF0, 0x430F00AC, 0xDC001001, 0x02820100, 0xF0002C02, 0xAEBDF700,
+0x0B941332, 0x13511372, 0x13511331, 0x8602118A, 0x0A0E0002, 0x00028600, 0x080201EE, 0x02820000,
+0x7C137323, 0x0206020E, 0x0C0E1310, 0xF503B5B2, 0x3713B30B, 0xBFF7FF5D, 0x06060054, 0x02820300,
+0x00001105, 0xA804071E, 0xFFF7B100, 0x538598F7, 0xB303B413, 0x2002800B, 0x22C2530B, 0x0404E000,
+0x8A000286, 0x00100002, 0x00000803, 0x9600056C, 0x08220100, 0x10008000, 0x8000980B, 0x4CF80B31,
+0x54354CB7, 0x2E01117A, 0x006D0504, 0x04000907, 0x13070074, 0x000B0F00, 0xECF71384, 0x03CA0022,
+0x70012E00, 0xEFF7FFFF, 0xE21A8F32, 0xF82C122C, 0x0A02020E, 0x0A0A0A14, 0x1204FC01, 0x13029A12,
+0x0014086D, 0xFC000F04, 0x1B960104, 0x14041212, 0x11280A00, 0x110F04AE, 0x00140CAE, 0x7E000010,
+0x14120007, 0x00000800, 0x08050C7A, 0xCE1A2000, 0x04070F0A, 0x190C0005, 0x01050002, 0x13100C92,
+0x8200000C, 0x0AEF9002, 0x0A6C0AAE, 0x628F0A2B, 0x04D40359, 0x050E7800, 0x7A07015E, 0x019E0001,
+0x0105DC00, 0xDC02001C, 0x00E60000, 0x0ACFE730, 0x3111074E, 0x06011402, 0x05080100, 0x0F105111,
+0x00027E00, 0x0C00047C, 0x01EE0005, 0x02000C00, 0xFE000980, 0x0B522010, 0xD4520500, 0x2F0B9303,
+0x5B011AF8, 0x00050C00, 0x0502F200, 0xD4030014, 0x4FE400B9, 0x30DFFF71, 0x940B5223, 0xCC00193E,
+0x04F4000E, 0x02006006, 0xF402000A, 0x02FA0004, 0x00001002, 0x76000088, 0x0B313100, 0x9000A072,
+0x1B920B31, 0x5CD75518, 0x000F7A16, 0xF00745E4, 0x00740500, 0x9E00090F, 0x6101A605, 0x3EFFFFFF,
+0x04902DD7, 0x00024C00, 0x4C20026C, 0x0009FC12, 0x7200027E, 0x05080107, 0x080F0405, 0xF8000A04,
+0x19080409, 0x000F0402, 0xFC002818, 0x00040104, 0x02259207, 0x82040276, 0x0A08020C, 0x10141000,
+0x001B9EF0, 0x1B101E18, 0x00000274, 0x1920020A, 0x0009FC00, 0x90000508, 0x1B51A016, 0x0AAE1310,
+0x122B0A8D, 0x5A00DABC, 0x2096040C, 0x0F070201, 0x0005017A, 0x040001A6, 0x00200000, 0x2B71E730,
+0x11200BC4, 0x1105020B, 0x00078231, 0x04010776, 0x0A0A0000, 0x000A1000, 0x04010C9C, 0x72321000,
+0xB0131002, 0x0E7C0002, 0x60000401, 0x71039303, 0x2CF2D10B, 0x0E11FE0F, 0x00006F00, 0x60010004,
+0xFEEF9001, 0x5312CFAE, 0x4403740B, 0x02680005, 0x00000800, 0x5800005A, 0x000C010A, 0x01205E00,
+0x06000500, 0x0A900403, 0x00000804, 0x31B00014, 0xB70B1113, 0x75551844, 0x99C43E54, 0x0F005B00,
+0x01B00004, 0xB800809C, 0x01A20008, 0x7473F770, 0x22CF1A4C, 0x4B12027A, 0x060304FA, 0x00120000,
+0x00028600, 0x04000008, 0x028E0100, 0x06028A05, 0x0C000C8A, 0x053E0005, 0x000F0402, 0x080A0296,
+0x8AAF100A, 0x0A040102, 0x03191404, 0x18020A0C, 0x8612121E, 0x05000002, 0x200F0400, 0x0C9612F0,
+0x00027E00, 0x11400004, 0x040B1013, 0x12EF6100, 0x122C128D, 0xB400A546, 0x083A0000, 0x07642004,
+0x00000190, 0x048C0005, 0x03077E01, 0xF400071A, 0x4433803D, 0x0B100AF0, 0x11DE0B31, 0x00050002,
+0x8600190C, 0x8E511107, 0x04F80002, 0x00000404, 0x8A020296, 0x0CB20004, 0x800E8000, 0x03720B72,
+0x963A0B0F, 0x6D07148C, 0x000B0F00, 0x05A40305, 0x612A7200, 0x12F043D1, 0x0A480B12, 0x1E440B10,
+0x00005802, 0x040504EC, 0x0A7A0000, 0x10008400, 0x0302760B, 0x2602007C, 0x31133008, 0x7005A20B,
+0x55191331, 0x68D554F7, 0x87540146, 0x0500770F, 0xA000180F, 0x4001CA00, 0x2BEFFFF7, 0x2212D2EE,
+0x2B2004E8, 0x0009FC12, 0x6E000004, 0x00080402, 0x06000C00, 0x08000004, 0x106C100A, 0x00040119,
+0x02231400, 0x8E100F08, 0x12103EA2, 0x0A000504, 0x23140200, 0x002A9603, 0x92010A0C, 0x027A0120,
+0x111E1801, 0x000006D0, 0x7A000C8E, 0x02760202, 0x01050600, 0x8E000A08, 0x101B1016, 0x0004000A,
+0x94022C00, 0x1AEF0AF0, 0x122C1AAE, 0x00078670, 0x600000BC, 0x00080318, 0x08017E0D, 0xEF710018,
+0x0AAE7538, 0x027A0AF0, 0x004E1310, 0x40000400, 0x13311352, 0x08020282, 0x046C0000, 0x10097A00,
+0x10050C51, 0x31070013, 0x82321B53, 0x00240009, 0xAD0B3160, 0x7CE7FF12, 0x02DE0005, 0x0B006C0D,
+0x28000011, 0x5C620100, 0x128DD770, 0x0B320B10, 0x4A000A50, 0xD871102A, 0x18D8011D, 0x01027E04,
+0x66000290, 0x00040300, 0x00001802, 0x31100AA4, 0xFC011EA0, 0x3435730E, 0x5CB654F8, 0x0B76C67B,
+0x0F0F006B, 0xB600A000, 0x01460106, 0x0101A200, 0x6C633594, 0xAE230F1A, 0x411DF41A, 0x4C122C12,
+0xFC0013F8, 0x00040813, 0x01079602, 0x9A000292, 0x0F08030C, 0x000F0400, 0x9E020500, 0x398C0039,
+0x00372C00, 0x04000008, 0x0A020032, 0x92128E21, 0x0C8A011B, 0xAF12AF60, 0x0212AF1A, 0x0A0C0100,
+0x30280000, 0x0C0AAF12, 0x05040200, 0x131B9600, 0x001E18D0, 0x90000A00, 0x1BA60002, 0x51133140,
+0x6219241B, 0x120C1ACF, 0x1E188D57, 0x0306E201, 0xF8000180, 0x0E780204, 0x04192402, 0xE8000010,
+0xF7DEC200, 0x8DD9EFFF, 0x02AE0A6D, 0x19600B10, 0x11131130, 0x04090A0A, 0x02660100, 0x20048800,
+0x07A65113, 0xAC520B21, 0x04B4001B, 0x2138EE00, 0x04800AAD, 0x0F006E03, 0x000C0007, 0x10000158,
+0x16E72134, 0xD00202F6, 0xCA721013, 0x0266000E, 0x0104E800, 0xE8000004, 0x001C0009, 0x04000800,
+0x0600057C, 0x05040003, 0x320B3232, 0x0B800328, 0x3CB70B31, 0xC41354D8, 0xF4EF1294, 0x007E0F1D,
+0x001F0F0C, 0x019A0094, 0x72065001, 0x0F3B50EF, 0x76231023, 0x09F80020, 0x63000401, 0x4D124C1A,
+0x00042C1A, 0x04000C00, 0x00000004, 0x0004000F, 0x02077E02, 0x040004F8, 0x0004040A, 0x000A0802,
+0x00000CCE, 0x00040605, 0x01231804, 0x86010500, 0x0A000002, 0x010F0C00, 0x08030004, 0x0270000A,
+0xF012F160, 0x7613110A, 0x13102402, 0x8C001918, 0x078E0002, 0xAE1ACF60, 0xFC224C22, 0x02620030,
+0x0F000400, 0x7012016F, 0x2CAE7CEF, 0xDA0AAE0A, 0x13112016, 0x00000952, 0x0A080005, 0x10208E02,
+0x0101EE31, 0x1C000004, 0x6E51100F, 0x20AA0025, 0x95050000, 0xF00B7113, 0x6C0ACE02, 0x0F18F812,
+0x00120071, 0xFF8204FE, 0xAF126CE7, 0xD002F00A, 0x025A0613, 0x0004F40C, 0x90020020, 0x00240214,
+0x0C763112, 0x1B321330, 0x936600AC, 0x764CF81B, 0x08A6404C, 0x8B0F0376, 0x280F1500, 0x4A007B00,
+0x027E011D, 0xB0009700, 0x6CC71EF7, 0xCE233012, 0xD00A2C1A, 0x04FA0022, 0x000EE802, 0x040409F8,
+0x09FC0000, 0x00000C00, 0x08040782, 0x0F080100, 0x02861A12, 0x00050000, 0x0C000004, 0x02920605,
+0x01028A02, 0x1401140C, 0x078A0019, 0x0A000400, 0xFC00028A, 0x00040404, 0x00050406, 0xF000027E,
+0x12EF2004, 0x11101696, 0x13D004FC, 0x1AF01B30, 0x23101B10, 0xB69C1A4C, 0xC401B448, 0x1D66010A,
+0x0B1B060E, 0xF790050C, 0x0A0BAE9B, 0x0AEF024C, 0xD6000A4C, 0x05080001, 0x00000804, 0x10060796,
+0x0A100005, 0x31028200, 0x2C111351, 0x0B317123, 0x0A8D02CE, 0x0027742E, 0x3500205C, 0x00040F01,
+0x077E000B, 0x70230000, 0x0A4C9E5A, 0xE011028E, 0x02520009, 0x02114A03, 0xF004027E, 0x07EE0004,
+0x00000C00, 0x040204F4, 0x03160000, 0x22008400, 0x00A01331, 0xB7343570, 0x3E44553C, 0xD0062872,
+0x00810F0A, 0x001E0F0B, 0x8A780096, 0xCF6C5460, 0xF8233022, 0x04F80013, 0x2A6E2D13, 0x00000C00,
+0x080C026E, 0x00140000, 0x01000402, 0x00000F08, 0x1908000A, 0x02412001, 0x7E02027A, 0x0C8A020C,
+0x003E9A00, 0x1C00026E, 0x00080014, 0x02000402, 0x0C001E10, 0x050C0000, 0x001B7A00, 0x08001408,
+0x026E0200, 0x000C7E00, 0x92001696, 0x2FA6002F, 0xCF1B1040, 0x00140C12, 0x30822AA2, 0x8E1B0F1B,
+0x7C853722, 0x040C0136, 0x0F06EE02, 0x800B0174, 0xCAB69CF7, 0xCF0A4C09, 0x0B2116D2, 0x03045831,
+0xE6040502, 0x077A0106, 0x000A1005, 0x13100782, 0x3186232C, 0x8E02CF13, 0xC40A2B02, 0x00740196,
+0x0B006E0F, 0x70001E02, 0x4D3B2FEF, 0x5E028F02, 0x04D80002, 0x00026A00, 0xD4012ACA, 0xE8131018,
+0x0A6E0009, 0x01000403, 0x5211120E, 0xFC02199C, 0x03140009, 0x50028202, 0x3C763CB7, 0x021BF675,
+0x060F0056, 0x0000B000, 0x0004000A, 0x70062401, 0x30222CEF, 0xD61AEE2B, 0x09E00004, 0x7E1A2C20,
+0x000E021B, 0x0700060F, 0x04051000, 0x04004618, 0x00040C14, 0x01321801, 0x7A001414, 0x141C0002,
+0x040A0C02, 0x10001914, 0x20A60014, 0x00281C02, 0x04041408, 0x050A0400, 0x021B9C00, 0x92001BA6,
+0x00040007, 0x07921011, 0x2C12F020, 0x16571003, 0x22E00323, 0x01019102, 0x8A0F0216, 0xE8000002,
+0x6E480005, 0xCAB67B80, 0xCF022B09, 0x0001D40A, 0x00000504, 0x00040005, 0x02046402, 0x10000792,
+0x01F80000, 0x510B3090, 0x510B100B, 0x07921113, 0x024D1370, 0x09C9024C, 0x54002274, 0x00680005,
+0x02005400, 0x060F0076, 0x24000300, 0xF7DEA100, 0x01C9DFBF, 0x02AE0A8E, 0x74012D3C, 0x04E0001E,
+0x00028A00, 0x04020008, 0x04EC0000, 0x06000406, 0x31200584, 0xB0000C0B, 0x0B110B11, 0x3C971BB3,
+0x3E5C33F3, 0x14C8006F, 0x0F197801, 0x0F0D0080, 0x0F030096, 0x81820016, 0x8E9598F7, 0xAD230F2A,
+0xF4002572, 0xF42C1031, 0x76121109, 0x1B7A001B, 0x0200040F, 0x000F2801, 0x12120C82, 0x36002A92,
+0x02820014, 0x00118201, 0x040143A6, 0x0C7A0200, 0x020F0C00, 0xF0000782, 0x00040A04, 0x01027E01,
+0x10020F18, 0x34A20414, 0x212D3400, 0x02821AEF, 0x00191C01, 0x1113140C, 0x31803238, 0x4D1AEF1B,
+0xBEBEDD1A, 0x0B8E035C, 0x0002760F, 0x90016C0D, 0xCAA61AF7, 0xCE0A6D09, 0x0014500A, 0xE2011954,
+0x10132020, 0xF4010A0C, 0x050E022A, 0x10028E00, 0x1004FC31, 0x00050A0B, 0xF0700500, 0xEB022C0A,
+0x4AE87409, 0x0F005503, 0x010F01FE, 0xF7804BC4, 0x09EB6C52, 0xEA11024D, 0x027E0204, 0x040F6C03,
+0x0A041166, 0x006A002B, 0x00028E01, 0xF200058A, 0x320B3002, 0x001DF00B, 0x118F0014, 0x3534770B,
+0x7543D32C, 0xA4031614, 0x00070F00, 0x1798008B, 0x10050000, 0x71B146FE, 0x0F2ACF3B, 0x1A22EF23,
+0xCF1A2016, 0x22214346, 0x000008AE, 0x040F000C, 0xCE800300, 0xCE22CF1A, 0x081ACF1A, 0x022C0000,
+0xCF1ACF86, 0xEF1ACF22, 0x0300041A, 0x14050016, 0x397A0000, 0x00002000, 0xF0300008, 0x206AEF1A,
+0x00000407, 0x040509D6, 0x37180000, 0x22F01A40, 0x1009EAEF, 0x40349A13, 0x12D01B11, 0x31200008,
+0x4134AC1B, 0x2B0F1B10, 0x6401C842, 0x00CA0013, 0x03049600, 0x770F028A, 0x2E000001, 0x00260002,
+0x0B855751, 0x23728D12, 0x0007CA00, 0x86001450, 0x00080402, 0x00028E00, 0x8602051A, 0x05080002,
+0x05003011, 0x8E133194, 0xAA0A4C02, 0x3A145F11, 0x00057401, 0x6B0F0054, 0x13050000, 0x05000000,
+0x0AEFFF30, 0x02120B52, 0xE400025E, 0x0ED00404, 0x0422CE00, 0x18000F6C, 0x09EC0200, 0x00007A00,
+0x7C0002FE, 0x0C800000, 0x80058800, 0x13730B11, 0x2BF52456, 0x54002FF0, 0x00EA000A, 0x00007C00,
+0x6D050004, 0x00090F00, 0x15A201A6, 0xD17B7E01, 0x230F332F, 0x23102330, 0x23102B31, 0x00E6AC11,
+0x0F4F7694, 0x082B1023, 0x2B120A00, 0x5C050020, 0x302321EA, 0x3800EA74, 0x00140100, 0xEA7C2317,
+0x00001C03, 0x10113BEE, 0x6C00000C, 0x00040000, 0x10001200, 0x50003811, 0x11231023, 0x02000E23,
+0x9001003C, 0x00940000, 0x70001800, 0x3023102B, 0x4E230F23, 0x22AE51E7, 0x60DF1A4C, 0x0C7405A4,
+0x1105000F, 0x6C95EF81, 0x12AF124D, 0x0102CAF0, 0xFC0002CE, 0x0E1B1004, 0x05040205, 0x05027E06,
+0x0BB0000A, 0x12F01B31, 0x124C0A8E, 0x01FA4B0F, 0x0F013001, 0xB11501EE, 0xC9A619F7, 0xAF0A4D09,
+0x501B720A, 0x04FC0205, 0x028E1B10, 0x000A1000, 0x7401026E, 0x0018000F, 0x0804F800, 0x80000004,
+0x00100105, 0xD40B1180, 0x9224361B, 0x0234EE1B, 0x6C003F8E, 0x027E0F57, 0x257200AF, 0x084EFE10,
+0xEFFFF7E0, 0x224B5BF1, 0x228D226C, 0x048E1A8D, 0x4FDC0000, 0x226D2241, 0x0000048D, 0x0C000018,
+0x00080F00, 0x00140101, 0x00281A12, 0x00002400, 0x8D100004, 0x04000010, 0x00400300, 0x00001400,
+0x18000004, 0x00040C00, 0x00286D10, 0x0A00040B, 0x90010024, 0x2203F000, 0x228E226D, 0x22AD1A4C,
+0x226C228C, 0x224B226B, 0x01230812, 0x1400DC30, 0x020F0B2D, 0x000E2003, 0x1A08022E, 0x05E80000,
+0x703B7020, 0x11C6000A, 0x002FF602, 0x5C000276, 0x0004001E, 0x0011EE00, 0xFA010478, 0x196C0025,
+0x010E7A00, 0x36002B06, 0x0A0B421C, 0x9FCCAE19, 0x0F005800, 0xB01201FE, 0x0EEFFFF7, 0x4C124C3B,
+0x4A1B3102, 0x1974020F, 0x00563210, 0x000CE601, 0xE0000010, 0x00740009, 0x00028A00, 0xFC020008,
+0x03100004, 0xD12E0000, 0x0AF11331, 0x03510B11, 0x1BF41BF4, 0x00436AF3, 0x020000D0, 0x00800003,
+0x00000400, 0x040F0010, 0x2201A700, 0x00BF0006, 0xFFF703F1, 0x5BAE7AEF, 0x7CAE5BAE, 0x5CA65BAE,
+0x7CA65BAE, 0x5B20000E, 0x2F0014A6, 0x0008AE5B, 0x00260206, 0x05000606, 0x7B110030, 0x3B130014,
+0x08040010, 0xA65B2200, 0x08090018, 0x00240000, 0x0C000405, 0x90000020, 0x00840300, 0xAE5BAEB1,
+0xAE7AAE3A, 0xC6FDA639, 0x5600317A, 0x04F40F20, 0x00E00011, 0x50000404, 0xF022AEEF, 0x400F581A,
+0x130F1B10, 0x7E031448, 0x7A131007, 0x000C0007, 0x01000803, 0x3140027E, 0x2E0AF01B, 0x0F780007,
+0x007F5800, 0x49020278, 0x01FA0F00, 0x5EF77214, 0x8D11EBCF, 0x000CEE0A, 0xEC020262, 0x055A0304,
+0x0116F604, 0x1E010A7C, 0x029A0100, 0x01027C00, 0xFC000286, 0x0D28002D, 0x0B930B92, 0x135213D4,
+0x89548E3C, 0x00043601, 0x8B0200FC, 0x00060F00, 0x027E00A8, 0x0500DF10, 0x0000C400, 0x040F1340,
+0x64010100, 0x1CC20004, 0x0116A401, 0x0A01AC0A, 0x00180400, 0x0000340C, 0x04040018, 0x001C0C00,
+0x00001008, 0x10080024, 0x000C0F00, 0x00280C05, 0x10001000, 0x0279E2EF, 0xC00023BC, 0x18EA020A,
+0x0100C500, 0x09010FCA, 0x04240000, 0x05169600, 0xAA00022A, 0x5EF77002, 0x31126DD7, 0x0302801B,
+0x5C0120E2, 0x050E0023, 0x09050000, 0x0B100004, 0x06002FFA, 0x1331913A, 0x22EF12EF, 0x52F61A6D,
+0x0070008E, 0x01098404, 0x050F0069, 0xDF700800, 0x2B7CD5EF, 0x1E70AE0A, 0x1032CC00, 0x0009D013,
+0x62000F74, 0x04EC0002, 0x00050000, 0x6E010008, 0x960B1202, 0x00200002, 0x01059401, 0x6A000578,
+0x0B117012, 0x13D40393, 0x20287271, 0x22F6DFEF, 0xB80EFC0F, 0x00019E05, 0x44002082, 0x0008031D,
+0x0001BA00, 0x5D0F0004, 0x1B0F0801, 0xAC035E00, 0x02A80000, 0x000E0701, 0x42020010, 0x008B0F03,
+0x71460014, 0x1AAEA530, 0xD0102D54, 0x12110CDE, 0x5C0001DE, 0x00040028, 0x002FEA00, 0x0C000004,
+0x021B1100, 0xF0133002, 0x00142212, 0x0F523C98, 0xBF224C23, 0x6D0FD2B0, 0x0A011400, 0x4CEF9003,
+0xCF1AAF22, 0x361B310A, 0xDC10111C, 0x05600213, 0x00027200, 0xF602027E, 0x00060204, 0x02001400,
+0x8A020302, 0x13314102, 0x000A1B11, 0x0BB40B51, 0x31F00B72, 0x010D6C04, 0x890F0CFE, 0x2A0F1700,
+0xDA009D00, 0x027E0F01, 0x0144097D, 0x0F067E03, 0x000D00A4, 0xCC01281C, 0x01B80000, 0x50050000,
+0xAE5BF1EF, 0x310C4E1A, 0x78CF12F0, 0x07820041, 0x0300040F, 0x03028200, 0x13630CA6, 0x22CE1B31,
+0x002AF6B0, 0x5C000074, 0x00900105, 0x0000880B, 0x20000518, 0x05240300, 0x9E1BF750, 0x1732124D,
+0x0119C400, 0x0B1004E8, 0x6C0304FA, 0x04E0000F, 0x1007E600, 0x021C620B, 0x28040014, 0x02860200,
+0x00126A00, 0x71700018, 0x100B720B, 0x5C621E13, 0x0300C400, 0x800123F0, 0x00050F00, 0x7E008FFF,
+0x00040002, 0x00021200, 0x6C400844, 0x4A2B302A, 0x1964001E, 0x00077600, 0x68030262, 0x078A0328,
+0x010A0400, 0x080101FA, 0x00240005, 0x311B107A, 0x9B1A6D23, 0x0A039BBC, 0x02010002, 0x00006000,
+0x04040008, 0x02820000, 0x90000C01, 0xAF4371EF, 0xEF23101A, 0x00050012, 0x7E0104E4, 0x0F6C0102,
+0x0004EC05, 0xDC000286, 0x0008012D, 0x00051C00, 0x80010004, 0x058C0000, 0x010A1000, 0x9122262A,
+0x01216A33, 0x050F0058, 0x079BFF00, 0xF7400494, 0xE84CAE5B, 0x5C1B104D, 0x16D60423, 0x00286802,
+0x5C030294, 0x3EFE0119, 0x95051404, 0x133012F0, 0x1AEF1B11, 0x005E62CE, 0x620104FC, 0x02820002,
+0x0005000B, 0x1C000219, 0x08160000, 0x7FEFFF81, 0x10124CD7, 0x0114AC23, 0x56000262, 0x02DE0249,
+0x02028800, 0xE00009E8, 0x00140204, 0x1104F402, 0x0046FE30, 0xFA00000C, 0x28AA0102, 0x13510361,
+0x289C128E, 0x0060006F, 0x0C0D0400, 0x180102F2, 0x00050F00, 0x260084FF, 0x0AD80302, 0x91EFFF91,
+0xF02AF053, 0x3EE2CF22, 0x00028000, 0x76010C88, 0x2D740002, 0x04327400, 0x08072868, 0x16EE0000,
+0x5722CE40, 0x02137285, 0x620001E3, 0x00040002, 0x02020A00, 0x060A0012, 0x001C0100, 0xF7FFFF70,
+0x2ACF74B4, 0x3020174E, 0x0202621B, 0x113004D8, 0x1E741113, 0x00000400, 0x72011478, 0x0A900019,
+0x00001800, 0x920023E4, 0x0008000A, 0xB1027E01, 0xF0135112, 0xCF0B1102, 0xEE330E0A, 0x00CC0336,
+0x0F006E0A, 0x8AFF000E, 0x0004FC00, 0x30010226, 0xBFF78004, 0xF01A6DDF, 0x3060F022, 0x12CF1270,
+0x1B0F0ACE, 0x00002AEE, 0x00040805, 0x0201FA02, 0x78000500, 0x23680023, 0x16EA6C10, 0x0004EC07,
+0x660104E0, 0x14680302, 0x01006000, 0x10000004, 0x0A6C0000, 0x60021500, 0xEF226CE7, 0x23AA1022,
+0x09FC1310, 0x00000401, 0x13100508, 0x6800075E, 0x13E00002, 0x04050002, 0x94000074, 0x001A000F,
+0x003D0800, 0x32000014, 0x0AD04305, 0xDD2C126E, 0x000D7A01, 0x6C01005B, 0x00090000, 0xFF00040F,
+0x020E0490, 0x51500401, 0x22F022AE, 0x20417AD0, 0x23500ACE, 0x00235C00, 0x08060500, 0x01F60000,
+0x00000402, 0xBE000226, 0x23514104, 0x16EC1AAE, 0x010F7401, 0xF60F0276, 0xF2000801, 0x0CF60002,
+0x118D2C00, 0x0007EC6D, 0x31301EB4, 0x3F4AF013, 0x020C6E00, 0xDC011C4A, 0x07660109, 0x0128E000,
+0x02000590, 0x00040508, 0x000F7A01, 0x8E663A7C, 0x0F12AF02, 0x0416F633, 0x8200007B, 0x000C0402,
+0xFF00080F, 0x0232008C, 0xB255D001, 0xEF1A6CDF, 0x8F233122, 0x701AD012, 0x2362003C, 0x00286800,
+0x820220EE, 0x05080402, 0x00029400, 0x9A00000C, 0x1B0F410C, 0x90521A8D, 0x0002CA03, 0xF20004FC,
+0x00580001, 0x00000800, 0x08010560, 0x07E60300, 0x700CEA01, 0x4FEFFFFF, 0xFE1ACF3B, 0x04D40404,
+0x0009DA02, 0x5C0202D6, 0x02E60105, 0x00027E02, 0xF0002152, 0x0806033C, 0x00007E00, 0xF0950028,
+0xCE02AE12, 0x7F09CA0A, 0x7400B2B6, 0x027A0400, 0x04000804, 0x080F007C, 0xB38DFF00, 0x8E6CD5EF,
+0xAE2B301A, 0x841AF012, 0x7012144B, 0x0F0C0032, 0x063EF600, 0x88043278, 0x05000004, 0xEE23104A,
+0x0F09FC2A, 0x000D01EA, 0x3E200282, 0x0104FECF, 0x4C011E60, 0x0250000A, 0x0304F000, 0xE8010004,
+0x000C0750, 0x00027A03, 0x2A000030, 0x00040000, 0x001E7200, 0x50017A58, 0x0073058C, 0x05028200,
+0x090F000D, 0x008FFF00, 0xBE101E1A, 0xF7210738, 0x300E8C9F, 0xE6CE1AEF, 0x82121225, 0x04F80002,
+0x00050400, 0x0C000004, 0x00040200, 0x0204F800, 0xD0105A98, 0x23413A0E, 0x64781A8D, 0x01ED0028,
+0x0104FC00, 0x14000478, 0x001100A1, 0x05000403, 0xF0010216, 0x3766003B, 0xCE6C9461, 0xE4231122,
+0x0F500804, 0x00147403, 0x04010514, 0x00100500, 0x02058002, 0x98021494, 0x0A8E811E, 0x0A2B024C,
+0x1B74226B, 0x000A7C07, 0x8400006C, 0x0088000F, 0x03000400, 0x070F0083, 0x0385FF00, 0xEF850232,
+0x22EF4390, 0x7EEF2330, 0x02820602, 0x00078206, 0x0C000C8E, 0x02820005, 0x522D8000, 0x231012CF,
+0x013264EF, 0xE300F5A0, 0x01F20501, 0x090E8C0F, 0xEFFFF790, 0x23101A6C, 0x05481B11, 0x0204D402,
+0x7A0104EC, 0x37D00307, 0x05041011, 0x0002A200, 0xEA00006C, 0x37E0000C, 0x002D9800, 0xAE80028C,
+0x2C022D0A, 0x3D09A90A, 0x00780003, 0x00000408, 0xF6080282, 0x001C0807, 0xFF000C0F, 0x0C0A007C,
+0x304AF800, 0x468D95B8, 0x6E1B1028, 0xFEAD112D, 0x86B01043, 0x41760007, 0x003C7803, 0x08003502,
+0x00040405, 0x61029601, 0xAE1B101A, 0x3B6E1222, 0x077CB400, 0x7E001E66, 0x0EEC0002, 0x0809F403,
+0x6C000212, 0x8DD9400A, 0x5D4E1AAD, 0x0009CA00, 0x04060262, 0x025C0000, 0x01000401, 0x04024962,
+0x05780005, 0x30001401, 0xAE0AAF12, 0x2B84000C, 0x72126D20, 0xF4DC104E, 0x04FC0316, 0x00025A04,
+0x70085A4E, 0x00180400, 0xFF00080F, 0xD77E8088, 0x2310226C, 0x2B5A2351, 0xCE12AE60, 0x821ACE1A,
+0x0282000C, 0x00027601, 0x040739FA, 0x02820000, 0x005D2600, 0xE2000A0E, 0xC6FD2034, 0xD80034E2,
+0x09D8000E, 0x0001E601, 0x0901027E, 0x00050B00, 0x72001804, 0xEF3B30EF, 0x5423311A, 0x04F4010A,
+0x03195C00, 0x940109E4, 0xF41A1302, 0x6C131404, 0x00080205, 0x2009F802, 0x2E5812CF, 0xF411EA20,
+0x00620455, 0x0F057805, 0x9BFF1B7E, 0x801B7200, 0x32CDE7FF, 0x2B3122EE, 0xAE2004FC, 0x0027C812,
+0x78000A04, 0x2808003C, 0x01001000, 0x88012FFE, 0x0020004B, 0x02028000, 0x30410004, 0xD622EF23,
+0x3BC20081, 0x04000401, 0x08040206, 0x021E0000, 0x00048C00, 0x0C020004, 0x04FE0000, 0x6DC6FE40,
+0x0225B212, 0x5A0204D4, 0x05500002, 0x01000400, 0xFC0216F6, 0x62760164, 0x02002404, 0x9C000504,
+0x47300002, 0xCA1A4B30, 0xEF10027E, 0xEC041178, 0x00600009, 0x00007800, 0x0400006C, 0x00100000,
+0xFF00040F, 0x15B0008D, 0x5C13E780, 0x22EF22CE, 0x017390EF, 0x76013C6C, 0x0A080002, 0x05168800,
+0xF4004188, 0x00040206, 0x0004FC00, 0x10600280, 0x8D23301B, 0x0F57F622, 0x0B0D396C, 0xF770020E,
+0x22EF6433, 0x14601B30, 0x0104FC01, 0xF00004F8, 0x05520004, 0x00028E04, 0x0C030010, 0x050C0000,
+0x003CF403, 0xEF600078, 0xEA228D22, 0x00ACC019, 0x5C000574, 0x00040000, 0x00026A00, 0x0800027E,
+0x00040F00, 0xF76097FF, 0x6C74EFFF, 0x122A6E8D, 0x403F0622, 0x12AF128F, 0x64000004, 0x35020804,
+0x0039FE00, 0x080004FC, 0x02860000, 0x61000800, 0x230F1AEF, 0x1AF81A6C, 0x000C0501, 0x8C00077E,
+0x020E0004, 0x06020A00, 0x0A000008, 0x256E0100, 0x80279801, 0x222CE7FF, 0x233122F0, 0x62000F44,
+0x0CD60402, 0x01000803, 0x0C024BE6, 0x04F40000, 0x005D8601, 0x82000A88, 0x0AA40002, 0x1A8D2350,
+0x89CA1A2B, 0x00027E00, 0xFE41026A, 0x82F7DDF7, 0x148001C4, 0x00000A01, 0x90010017, 0x00090205,
+0xFF00060F, 0x04FC0083, 0x7CF5EF92, 0x23301A6C, 0x78901B31, 0x013EF200, 0x12110778, 0x04020782,
+0x0C8E0105, 0x0069A006, 0x8200027A, 0x1ACF7002, 0x22CF2310, 0x0163E054, 0x7204EBAC, 0x0E780002,
+0x08000C00, 0x800301F4, 0x00130202, 0x95B9F772, 0x2311228E, 0x72002860, 0x00040107, 0x00535201,
+0x7A020F5C, 0x00140102, 0x03027201, 0x1A100010, 0xEA001E94, 0x1AAD411B, 0x6EF832EE, 0x0B0A4C04,
+0x6C0909F0, 0x00720200, 0xFF00060F, 0x13E00069, 0x00017F01, 0x900001AE, 0x0424010E, 0x5033A201,
+0x73E7FFF7, 0x3146CE6C, 0x88CF230F, 0x3A06025F, 0x000A0600, 0x08024B84, 0x4B840200, 0x00079200,
+0x08000004, 0x02A0000A, 0x000A1400, 0x6D2022B8, 0x04C8B01A, 0x76010EF6, 0x00680002, 0x000EF403,
+0x14010078, 0x02220300, 0x70021A01, 0x0EE7FFEF, 0xFE2B0F33, 0x0ACE3009, 0x03536ACF, 0x5A0004DC,
+0x28740007, 0x00027A00, 0x10001E7C, 0x00680000, 0xB0000802, 0x233112F0, 0x22EF1AEF, 0x0494124B,
+0x2DE20083, 0x00970C01, 0x04040054, 0x00700000, 0x04000C00, 0x10000074, 0x00040F00, 0x920070FF,
+0x01860101, 0x01021A03, 0xFC000010, 0x13E73004, 0x00BBAE5C, 0xF20239EC, 0x7D90003E, 0x00508C00,
+0x7E01026A, 0x05000002, 0x000C7603, 0x04000014, 0x8EAF1005, 0x4B8C0111, 0xF0231050, 0x436A4F22,
+0x01026E07, 0x050F0068, 0x78010400, 0xFF00F000, 0xBEFDF7FF, 0x1AEF1A6D, 0x0ACF1B11, 0x3F4A1B10,
+0x020F7400, 0x6A000264, 0x027E0207, 0x1073F001, 0x00077E12, 0xEA001490, 0x2310A402, 0x228D1AEE,
+0xC71E32EE, 0x670032D8, 0x00540300, 0x0F000B00, 0x85FF0004, 0x0001A208, 0x1000091A, 0x444A0005,
+0xEFDFBF40, 0x401B003A, 0x1ACF2310, 0xFC03853A, 0x821A1004, 0x028E0507, 0x05081210, 0x04000400,
+0xFC00418C, 0x12AF4004, 0x3CEC0A8E, 0xAE2AEF51, 0xA94AD922, 0x0009F800, 0x080401FF, 0x000C0000,
+0x0A000404, 0x18000080, 0x63F273CE, 0x2B3122AE, 0x015AD8B0, 0xFC0007CA, 0x50D8017D, 0x01027200,
+0x92030282, 0x031C005D, 0x682B5120, 0x1A8C500A, 0x6E9732CD, 0xFFF73400, 0x0FAD66FF, 0x7CFF04E8,
+0x0F01F204, 0x00090008, 0x1A0018EC, 0x9DF96035, 0x22CE228D, 0x8F263C42, 0x40027E12, 0x126E1A8F,
+0x8F400C86, 0x04128E12, 0x02940000, 0x034E0E05, 0x9E000212, 0x508C000C, 0x0F2B1061, 0x8C1A2B33,
+0x00710F04, 0x001C0C09, 0x30514000, 0x6433102A, 0x6AAF1023, 0x054A0071, 0x01027E01, 0x64024BD8,
+0x7A1A1014, 0x009C003F, 0x113D2402, 0x1004F8AE, 0x10FB10B8, 0x000C72F7, 0x080055D0, 0x005B0C00,
+0xFF00100F, 0x04240084, 0x0001AE00, 0x0C003892, 0x86F60000, 0x8D3B4F70, 0x301ACE1A, 0x04022C78,
+0x31238400, 0x101AF023, 0x3ED43123, 0x10000805, 0x00002011, 0x2312414C, 0x11207AFE, 0x9061EA23,
+0x22F02311, 0x1A2B2AEF, 0x0388D4B8, 0xFC0F07D6, 0x12000104, 0x05000102, 0x02002400, 0xF7600004,
+0x224BA618, 0x1002FAEE, 0x112AB61B, 0x00007830, 0x80000C56, 0x00080100, 0x07D82210, 0xEF2B1060,
+0xAC22CF22, 0x226D4053, 0xE0A25C13, 0x120F6601, 0x00B9E4F7, 0xCC0011EE, 0x64BF1F00, 0x97002367,
+0x00040F00, 0x5D6065FF, 0xEA5B90DF, 0xA004FC19, 0x1ACE22EE, 0x22AE22AE, 0x000622CF, 0x00000400,
+0x08048F20, 0x228E4200, 0x001022AE, 0xAE22CE71, 0xAD22CE1A, 0xAF100026, 0x2290446E, 0x22AF1A8E,
+0x222C228D, 0x6A0152DA, 0x01CC0F48, 0x02820115, 0x0ADF9F60, 0x562ACE22, 0x1AAE6000, 0x1A8D22EE,
+0x8400000A, 0x22CE5100, 0x66AF22AE, 0x928D1200, 0x502A603F, 0x9D7D1743, 0x6C0072BE, 0x1B62030C,
+0x0F02CE05, 0x0F140A74, 0x0F15009B, 0x48FF0028, 0x00042800, 0x7A0009F4, 0xDF02F107, 0x52DF1DF7,
+0xB58D167C, 0xF585167C, 0xF584F67C, 0x15800002, 0x157CF585, 0x1484F585, 0x00120000, 0x00001000,
+0x16400008, 0x0C84F585, 0x00040300, 0xA0000C01, 0x7CF67D16, 0x7CF57D16, 0xA2489597, 0x0004F400,
+0x08000212, 0x01C20000, 0x00000804, 0x0404000C, 0x00800000, 0xF1000C09, 0xCEFDF700, 0x84F67493,
+0x84F68516, 0x8D167CD5, 0x8000007C, 0x00040100, 0x7784F590, 0x7B9DD88D, 0x44369FB6, 0x013D4806,
+0x62040FB4, 0x502E007B, 0x00084400, 0xDA004454, 0x005E0400, 0xFF00080F, 0x077A0086, 0x00022605,
+0x50000448, 0x00040004, 0x040F0400, 0x100C0004, 0x00180F00, 0x00280005, 0x00000400, 0xFF1011CA,
+0xF6020CD0, 0x02660801, 0x0F001202, 0x04080006, 0x080F005C, 0x41020B00, 0x00680100, 0x00026A00,
+0x660311E4, 0x00380200, 0x0016CA01, 0x290200D8, 0x00060F00, 0xD00086FF, 0x1894014F, 0x0206FE01,
+0x22001884, 0x00040116, 0x0F01B500, 0x0F010018, 0x02030014, 0x1C0301F8, 0x01FA0000, 0x00000404,
+0x040F0047, 0x30030600, 0x00700000, 0x00003000, 0xBE010008, 0x00180004, 0x00003500, 0x040C0008,
+0x14300700, 0x0000BC04, 0x8003003C, 0x13F80202, 0x0F034A00, 0x94FF0786, 0x0001DE00, 0x040F01EA,
+0x90007500, 0x00040000, 0x0F026603, 0x00010097, 0x0405026E, 0x002C0300, 0x04002804, 0x10040018,
+0x00080F00, 0x28018DFF, 0x0E320204, 0x000A0400, 0x480001AE, 0x00040004, 0x0F048C01, 0x00080444,
+0x34000024, 0x00080000, 0x00000404, 0x04000010, 0x00480000, 0x01004004, 0x050F000C, 0x2E000400,
+0x00300002, 0x00000800, 0x27010004, 0x02520000, 0x04075A03, 0x08040058, 0x00240000, 0x0400040C,
+0x7000001C, 0x05100100, 0x00450203, 0x50010018, 0x00050F00, 0x80028FFF, 0x01A70F02, 0x020A0000,
+0x0000170F, 0x0900130F, 0x01021E00, 0x90020020, 0x000B0107, 0x1E00050F, 0x1800780F, 0x00026600,
+0x64010004, 0x02B60300, 0x05008400, 0x19010014, 0x00050F00, 0xAA0086FF, 0x00040001, 0x0001AE04,
+0x9000000C, 0x00040004, 0x0201B40F, 0x04021A0B, 0x7C000038, 0x00300004, 0x00001000, 0x10010004,
+0x002C0000, 0x00000400, 0x040F0019, 0xB0040400, 0x00780004, 0x00002304, 0x04080040, 0x00180400,
+0x03000809, 0x80080058, 0x00340960, 0x09002003, 0x0D0F0034, 0x0883FF00, 0xA10001FA, 0x00100001,
+0x00000400, 0x040F000C, 0x2A0F5200, 0x4E040402, 0x00840F02, 0x00340019, 0x0F003005, 0x05040058,
+0x090F0020, 0x0C78FF00, 0xBA0306B6, 0x05040001, 0x0901D20F, 0x00001C00, 0xC40F02AA, 0x400D0504,
+0x01F20F00, 0x00400404, 0x03053401, 0x5C000A70, 0x00040000, 0x0500600F, 0x04004B09, 0x080300C0,
+0x00380000, 0x09000400, 0x0D0F0024, 0x038CFF00, 0xA5050272, 0x00100301, 0x0501FE00, 0x090F0014,
+0x280F0800, 0x180F0500, 0x4B0F0500, 0x1B0D0800, 0x00440F00, 0x00AC070E, 0x0E002C0F, 0x0F005E0D,
+0x018D0011, 0xE20000D2, 0x00040000, 0x04101200, 0x9C030008, 0x03B404B7, 0x02002800, 0x76030004,
+0x00280515, 0x02151A00, 0x940000E6, 0x00240003, 0x00003400, 0x1602000C, 0x00060F00, 0x00940977,
+0x0F044C03, 0x0129009E, 0x410F00EC, 0x3C0F2900, 0x68071100, 0x00700801, 0x0000CC04, 0x4700055C,
+0x00100F00, 0x018C0005, 0x0F002000, 0x00250004, 0x78000060, 0x00600C00, 0x0F001408, 0x0225005C,
+0x4A000038, 0x000A0200, 0x00000602, 0xA4000072, 0x00180D60, 0x01001F02, 0x0B011778, 0x011A0300,
+0x0F000C01, 0x0C040005, 0x270F0044, 0x170F0400, 0x002BFF00, 0x1E0401B0, 0x01490002, 0x5501740F,
+0x3400680F, 0x01040807, 0x560000C6, 0x00140302, 0x00001001, 0x04030514, 0x00100000, 0x08000404,
+0x080500EA, 0x00380009, 0x03004000, 0xFD1108E4, 0x2A00588A, 0x00040F00, 0x7E0448FF, 0x01980002,
+0x00016600, 0x08000010, 0x00100100, 0x00018C03, 0x040F0010, 0x50002D00, 0x02720500, 0x0F01E800,
+0x0F2D0051, 0x00020040, 0xB20F0066, 0x9A0F2105, 0x78010100, 0x01020F1D, 0x00B10F38, 0x00150F02,
+0x01B801F4, 0xA3010C0F, 0x02182001, 0xC800A814, 0x00C50004, 0x0815AE05, 0x4A0002E8, 0x00040402,
+0x04002500, 0xE8010004, 0x026C0044, 0x03001103, 0x12050034, 0x00340001, 0x0F001B03, 0x43FF0007,
+0x0401C003, 0x640001BC, 0x017C0001, 0x00041200, 0x10000004, 0x00040F00, 0x004C0031, 0x04000400,
+0x6400004C, 0x000C0400, 0x2F00080F, 0x00004E00, 0x080005BA, 0x004E0000, 0x09000804, 0x4A00050C,
+0x00040402, 0x00002500, 0x04030004, 0x02800018, 0x00009E05, 0x82030024, 0x00230007, 0xFF00040F,
+0x01C00062, 0x0F019005, 0x0F340181, 0x063D0050, 0x3E050097, 0x034C0302, 0x08001A04, 0x8A000292,
+0x00100002, 0x07008601, 0x100004E4, 0x00EE0000, 0x00038000, 0x3C010004, 0x30A40000, 0x008AD403,
+0x14010020, 0x00050F00, 0x7C0045FF, 0x00040001, 0x00016804, 0x0400000C, 0x00100000, 0x0F000400,
+0x002D0177, 0x0400004C, 0x004C0000, 0x04020005, 0x6A03045E, 0x00640F04, 0x0EEE002D, 0x0300440F,
+0x08007600, 0x1008001A, 0x000C0800, 0x0400A200, 0x30020004, 0x07C40000, 0x0700580F, 0x0F002402,
+0x98FF0006, 0x0F01EC08, 0x013B01B6, 0xF8032BB4, 0x00660204, 0x00023A02, 0xD0013134, 0x04EC0304,
+0x022B6A00, 0x80020004, 0x000C0000, 0x00003000, 0x12000004, 0x00300000, 0x05028204, 0x28040014,
+0x00210003, 0xFF00040F, 0x01AE0045, 0x00017000, 0x6300049C, 0x01840401, 0x00000800, 0x040F0010,
+0x48002D00, 0x15F20000, 0x03006001, 0x7000020C, 0x00180200, 0x2D005E0F, 0x00004000, 0x3E000266,
+0x000C0002, 0x00005A00, 0x04020008, 0x00640000, 0x0029B203, 0x6E0B0011, 0x002C0005, 0x00000400,
+0x0401001B, 0x00200300, 0x00001400, 0x14010004, 0x00050F00, 0x6C0551FF, 0x01800301, 0x3D01730F,
+0x00020600, 0x24000064, 0x00040002, 0x04000C00, 0x0C080064, 0x00140400, 0x1B00080F, 0x0037CE00,
+0x400509DC, 0x050C0056, 0x002E6203, 0xFC00007A, 0x7714002D, 0x11EA9201, 0x013586E7, 0xB6004458,
+0x007E0002, 0x00009200, 0x6E00050C, 0x2BD8006D, 0x030A4C01, 0x58010328, 0x008F0F00, 0x002E0F1B,
+0x88001FFF, 0x01680001, 0x399CDF10, 0x0301BC00, 0xBC020674, 0x014F0F01, 0x0048002F, 0x00072404,
+0x52000068, 0x01F80000, 0x0F000801, 0x003002F2, 0xE40305C0, 0x9FF78204, 0xDFD7BFDF, 0x0006FFDF,
+0x519AF710, 0x01006600, 0xEF7C0004, 0x64B5B6DD, 0x44786CB5, 0x00009203, 0xDF40332A, 0xAE3ABF1E,
+0x19200535, 0x0F00A601, 0x013000A2, 0x050F0080, 0x620DFF00, 0xD6DDCEBB, 0x5302D6FD, 0x3D012B0F,
+0x80028200, 0xD6BCF7FF, 0xDEFED6BC, 0xD80101F0, 0x00650F01, 0x04B00336, 0xD1114800, 0x976518EF,
+0x973C9744, 0x9634B83C, 0x01993C4C, 0x22012B68, 0xBEEF917E, 0x555497A6, 0x72CFDF54, 0x04E0073D,
+0x90A78A00, 0x6DBAD7FF, 0x3CD72C96, 0x01A0F0B5, 0xD6080384, 0x00AB0F02, 0x00490F36, 0x0E0003FF,
+0xEFBF9302, 0x00240023, 0x66BF1907, 0x001400B6, 0x0F023601, 0x00300132, 0xDD4006E0, 0x62FFFFF7,
+0x31CA2000, 0xF002423A, 0x0064001F, 0x30005F0F, 0x001B5A00, 0x040004A4, 0xE701F800, 0x3CB86D39,
+0x3D1A44FA, 0x4D393D7C, 0x5FFDEFFF, 0x02800100, 0xBF5C9730, 0x2C00A5D0, 0x001C0400, 0xA102B800,
+0x194CD7DF, 0xB73D3A3D, 0xBA68D63C, 0x0F027C00, 0x043500FE, 0x080F0067, 0x620EFF00, 0x08A70885,
+0x06C82169, 0x37021A0F, 0x01017602, 0xF77001CC, 0x08660025, 0x028E4A4D, 0x00001600, 0x680F0014,
+0x40013300, 0x08340208, 0xC71DF7C0, 0xAF5FB6FE, 0x351A659B, 0x00AB38F9, 0x60000016, 0x35700002,
+0xA69DEF71, 0x54135434, 0x62010780, 0x007E0007, 0xA20A1801, 0xF87D79E7, 0xBA3CB844, 0x3AB4FF75,
+0x00BFD200, 0x3E0000A3, 0x00080300, 0xFF00070F, 0xF7DEC44A, 0xEFBFF7DF, 0x088708A7, 0x021E298B,
+0x0F019C00, 0x00350174, 0xFEAF0054, 0x45F7DFF7, 0x4D108800, 0x41050042, 0x00028200, 0xB20102D0,
+0xFFEF9000, 0x1A6D9ADF, 0xD44D193D, 0x0016035F, 0x7004F000, 0xDFE7FFF7, 0xF0D7BFD7, 0x00DE093F,
+0xD7FFF782, 0x45194456, 0x01B9E4DB, 0x2400A6F6, 0x004C0108, 0xFF02820F, 0x04F60055, 0xC900665F,
+0x05006A10, 0x0026684A, 0x4A6E0888, 0xE40401DC, 0x00080F01, 0x0264002B, 0x03000400, 0xF7900256,
+0x759ADFFF, 0x4D193CF9, 0x180092B6, 0x00040000, 0x0102A200, 0x0E000F00, 0x09E00105, 0x00080402,
+0xFFA05E38, 0x964CB7A6, 0xFFB7BF44, 0x010778E7, 0x0C014F58, 0x00960054, 0x00003C00, 0x40010340,
+0x00110000, 0x020A5001, 0xBC0030D2, 0x3B9C0044, 0x0300D208, 0x2A010084, 0x003C0000, 0x00001000,
+0x0C000056, 0x53E20000, 0x02001002, 0x90010B66, 0x02E20112, 0x02001E00, 0x0A010014, 0x00A40000,
+0x02006800, 0x04010336, 0x0044009A, 0x00005500, 0x04010034, 0x00200000, 0x03000400, 0x38000AC8,
+0x00040400, 0x0000AC00, 0x18000004, 0x009C010B, 0x04407C01, 0x820000F0, 0x01F00000, 0x001F3002,
+0x24010034, 0x08C60000, 0x00005000, 0x20010004, 0x34DF1001, 0x038E0106, 0x00003200, 0x2C000104,
+0x00080000, 0x045E9C00, 0x14000E50, 0x00400000, 0x00001800, 0x100000A4, 0x001C0000, 0x01002400,
+0x050000B0, 0x00040000, 0x0200CC02, 0xB4030158, 0x5CDE1300, 0x00AC0024, 0x86F7DF80, 0x8B008808,
+0x00004C29, 0x480013AC, 0x00E80000, 0x008CBE11, 0x00180602, 0x4B000058, 0x00240000, 0x04003400,
+0x28000010, 0x00180000, 0x00003400, 0x88040018, 0x01700000, 0x0200F600, 0xDF8000C0, 0xA80025F7,
+0x12422C10, 0x00040200, 0x0F003400, 0x003B0004, 0x3400006A, 0x759940F4, 0x0500451A, 0x00005E07,
+0xEF110EE0, 0xDE03117C, 0x00AE0001, 0x90116E00, 0x9EFFE7FF, 0x4CD744F8, 0x124E96FF, 0x04009AEF,
+0x400100D2, 0x00300000, 0x0011CE00, 0x0800003E, 0x01360300, 0x0000E604, 0x2801010E, 0x00050F00,
+0x00940104, 0x00001C04, 0x5200F6AE, 0x00040301, 0x00003C01, 0x2004019A, 0x01A00200, 0x02121E01,
+0x2A02008A, 0x01560202, 0x0102A202, 0x30030034, 0x005C0000, 0x00018604, 0x0604BB22, 0x001F0002,
+0x0100E002, 0xC200066E, 0xC8FF1100, 0x006C01A4, 0x00001401, 0x18010064, 0x00280200, 0x03003200,
+0x1600037A, 0x5CF71000, 0xF7FF2203, 0x66000108, 0x008E0500, 0x01003800, 0x9A00029A, 0x5F340000,
+0x00003A01, 0x4A0300D0, 0x00500048, 0x02009404, 0x70010036, 0x00560100, 0x01002C00, 0x82034D7A,
+0x00100002, 0x00000400, 0x86600022, 0x6A08C900, 0x0100C221, 0x0A010012, 0x00800001, 0x01005000,
+0xBC000012, 0x00680000, 0x00000403, 0x68060014, 0x006A0200, 0x00001400, 0x34070004, 0x00780000,
+0x90001300, 0x46F7FFFF, 0x6D006700, 0x04000D4A, 0x0C000020, 0x00040F00, 0x00520033, 0x00012800,
+0xFF265D9A, 0x010500E7, 0xF7E100A2, 0xB71DF7FF, 0xAF3FB75F, 0xB71EB75F, 0x020C805F, 0x03F004B8,
+0xAF1ED77F, 0x6E3EA77F, 0x3CB83CF9, 0xAF9F9F5F, 0xC1E8B73E, 0x00039800, 0xA60301F2, 0xFFEFA044,
+0x5FD7FFDF, 0x9FAF3FAF, 0xDF100195, 0x94040F3E, 0xFFDF20A8, 0xC20F03A0, 0x94000900, 0x004C0000,
+0xF1023601, 0xD6DDF702, 0x31ED73D3, 0x190A10E9, 0x63312149, 0x1472ADBA, 0xD6FCFF93, 0xA576B5B8,
+0x0048E75E, 0xD6DCF782, 0xAD76AD97, 0x01660EBF, 0x5E02239C, 0x00480001, 0x77DF3D80, 0x3EAD78AD,
+0x0101C6E7, 0x9602005C, 0xF702F001, 0x94D7F7DF, 0x1909426E, 0x216A10E8, 0xB5DA5310, 0xDFA0035A,
+0x98DEDCF7, 0x7DAD77B5, 0x800040E7, 0xC63AFFDF, 0xA556AD99, 0x79C00266, 0x494AAEAD, 0x6D190821,
+0x2A8C9542, 0x024C0000, 0xE0008C00, 0x7C14EF7F, 0x11083A2D, 0x5AEF1949, 0x001AAD79, 0x00010C00,
+0x18000548, 0x00800002, 0xF0011403, 0xADBAF702, 0x19895B51, 0x19491149, 0x94F64AAE, 0x028AF7FF,
+0x0004B800, 0x740096A4, 0xF7DF8001, 0xAD79BDD9, 0x025AB5BA, 0xB2DF1EE2, 0xE829AB6B, 0x6E214910,
+0x6C84344A, 0xEADE1100, 0x83960003, 0xB59808F0, 0xB5DBB599, 0x08C8A59A, 0x196B00A8, 0xB5B9BE5D,
+0xB599B599, 0x42010E1D, 0xBEF7FFF7, 0x02F003B2, 0xB2BE3BF7, 0x2929AA6B, 0x6D192919, 0x9F847542,
+0x000090EF, 0xDA020004, 0x040C0000, 0x00000A02, 0x01F000B4, 0x9D38EFDF, 0x194952EF, 0x216A1928,
+0x8CD6426E, 0x04001458, 0x00466000, 0x424C08A8, 0x2C0003A8, 0x016E0200, 0x02014400, 0x060F000A,
+0x4E013100, 0xFFF73900, 0x000500E7, 0xEF6101A2, 0x4C966CF6, 0x210002B7, 0x05066D17, 0xF103C800,
+0xA61AF705, 0x44D85475, 0x453A451A, 0x3CD84D5B, 0x445444D7, 0x03A3745E, 0x34000048, 0xE706F005,
+0x6D17A69C, 0x54D74C96, 0x54B74CB6, 0x65174C75, 0xE7FFA6DD, 0xEE000284, 0x02F60016, 0x0F000400,
+0xF30F00BC, 0xFDFFDF15, 0x4531AAD6, 0xA808A800, 0x6808A900, 0x6708C900, 0x86004600, 0xFFBDF908,
+0x038454F7, 0xB8004400, 0x9A0116AD, 0x237BF2F7, 0x5A002300, 0x000056CE, 0xFF9001D6, 0x249D16F7,
+0x17002500, 0x32030246, 0x01860007, 0x256BB140, 0xF0015E00, 0xA8008809, 0x88008708, 0xA6004508,
+0xFFBE3B08, 0x248413FF, 0x5A000308, 0xD102FEC6, 0x424DF7DF, 0x00450025, 0x2129EFBF, 0x92002825,
+0x08A708C8, 0x00440066, 0xF0028494, 0x6B92F704, 0x00670026, 0x00A80087, 0x088708C7, 0x10A70045,
+0x7E000044, 0x01100102, 0xF2008F04, 0xAD78F707, 0x08661086, 0x00C80087, 0x008700C7, 0x088608A7,
+0x10340045, 0x016C00FA, 0xD1002803, 0x08461086, 0xF7FF0046, 0x00254AAE, 0xA0007086, 0x086708A8,
+0x00240887, 0x02AE8C95, 0x70009401, 0x24FFDFFF, 0x9A106608, 0xE900F004, 0xC800E900, 0x65006600,
+0x24086608, 0x02FE7700, 0xE101A400, 0x9DF7FFFF, 0x661928CE, 0x87006608, 0x00488708, 0x25088760,
+0xF85AEF00, 0x006B0000, 0x04018000, 0xDC000004, 0xD107F002, 0x6600866B, 0xA708C700, 0x6708A800,
+0x6610C800, 0xD2004600, 0x00029873, 0x4D200122, 0x00007842, 0x040F0038, 0x82003B00, 0x01260000,
+0x20050001, 0x0A0099DF, 0x0A005514, 0xEFFE00F2, 0x64B5EFFF, 0x44964C55, 0x44F95519, 0x000C689A,
+0x06F30598, 0x549DF9EF, 0xD844B74C, 0x3A453A3C, 0xD83CD93D, 0x1D4C753C, 0x000676C7, 0x0CF20020,
+0xB6CFDFE7, 0xF83CF84C, 0x9644D83C, 0x974CB744, 0xF94CB84C, 0xD63CD83C, 0x5CBFBF44, 0x03780200,
+0x0E00CA0F, 0xF7DFF760, 0x402694D6, 0x0808F001, 0x00860065, 0x3A4D29EB, 0x00461949, 0x10C80066,
+0x84760025, 0x01C29518, 0x042CFA10, 0x90055000, 0x667C13F7, 0xBD004508, 0x0004E4D6, 0x7A004A32,
+0x00DC0002, 0x80068E00, 0x0866A537, 0xA5380046, 0x4A0100F0, 0xBFF77001, 0x6610C7EF, 0xA0024C00,
+0x29EA0044, 0x218942AD, 0x01AC0045, 0x180025C2, 0x869D1895, 0x3A086608, 0x2002DABE, 0x029C426D,
+0x190A21F0, 0x08660887, 0x320B0065, 0x08A629CA, 0x10C70086, 0x63710024, 0x31EBEFFF, 0x08880046,
+0x08E70066, 0x29CA2A2B, 0x08870045, 0x000508A8, 0x097C9D57, 0x0A08FE11, 0xF001F200, 0xAFF7DF0D,
+0x67002552, 0x46086608, 0x2B192808, 0x4529AA3A, 0xC7002500, 0x28004610, 0x0203D819, 0x6E0000B4,
+0x080FF004, 0x0A008719, 0x67426F11, 0x4508A700, 0x4C08E700, 0x6619693A, 0xA8086600, 0xCF002510,
+0x11028252, 0xF007E6DF, 0x24082409, 0x86006600, 0xC908E900, 0x6500A800, 0x44084500, 0x97000200,
+0x005568AD, 0xD2600594, 0xC8000573, 0x70012E10, 0x3A2C1107, 0x448631CB, 0x86087201, 0xFE088608,
+0x0000D8DE, 0x20000684, 0x056C0001, 0x212905F0, 0x00A70887, 0x00440087, 0x320C1969, 0x004529CB,
+0x00020866, 0xFF214894, 0xA80047F7, 0xF53C4C00, 0x0001B500, 0x080007CA, 0x00040F00, 0x00860036,
+0x020A000F, 0xB0074400, 0x3ACFFFCF, 0xBB451A55, 0xCAE7FF65, 0x03120001, 0xDFBF03F0, 0xBFDFC79F,
+0x451986BF, 0x9F9F3CD9, 0xBF7FB7FF, 0x9A010F1E, 0xF711F00B, 0xC79FE7FF, 0x4D3A4456, 0x55393CD8,
+0xC7FF96DF, 0xC7BFC7FF, 0x5D5A9EFF, 0x45393CD8, 0xAEFF4496, 0x85A002C2, 0x0F03F407, 0xD00400C9,
+0x2694F5F7, 0x4610A900, 0xDD424D08, 0x000078D6, 0x02F00004, 0x7C13EFDF, 0x08880045, 0x29ED0088,
+0x088708C8, 0x000172B9, 0xF7300041, 0x01DE7C34, 0x38CE9C20, 0x0011001C, 0x02020200, 0xDFA10008,
+0x46A558F7, 0x38086708, 0x010010A5, 0x56001AB0, 0x0067610B, 0xA5B910E8, 0x38006688, 0xF701F003,
+0x08878455, 0x004608A7, 0x08C93A4E, 0xE03B0045, 0x8AFF106A, 0x00A89304, 0x088810EA, 0xF2D60067,
+0xEFFF5104, 0x2865AD99, 0x02280004, 0xE8088750, 0x052C7C10, 0x1005F800, 0x62050EFF, 0x000508C8,
+0x0080DF5F, 0xC0077E00, 0x3A0CF7DF, 0x10A80046, 0x84550846, 0x200001EE, 0xFFDFC202, 0x10C7AD79,
+0x08C70887, 0x013E08A6, 0xD0009C02, 0x08C91128, 0x00A808C9, 0x426E0087, 0x01C0427F, 0xF3A40B3C,
+0xA808467B, 0x14004610, 0xF1166A7C, 0x7CCE5B09, 0x7DC69DCE, 0xC900C8BE, 0x3F198B08, 0x7BCE7CDF,
+0xBECE7ACE, 0xC0BBCAF7, 0x267392F7, 0x2510C900, 0x9F6B9200, 0x6C000846, 0x5CF7C301, 0x66298AC6,
+0x2408A700, 0x87AC1E00, 0x0003A200, 0x65900154, 0x67086708, 0xF708A800, 0xBE0000E0, 0xFFEF708A,
+0x69B5DAFF, 0x7F05CC29, 0x00A929AB, 0x006D0088, 0x000B5105, 0x0296000A, 0x85DB2C00, 0x6D9AD7FF,
+0x659A3CD9, 0xAC0004BC, 0x80EF1101, 0x764C510C, 0xEEC7FF3C, 0x0C5E02AF, 0x80018200, 0x1A3C97D7,
+0xBE445645, 0x26000770, 0x0C800000, 0xDFFFE7B0, 0x4497B73F, 0x44974D19, 0x3E01BC98, 0x0B2A0114,
+0x00017400, 0x08000068, 0x00040000, 0xB0000C05, 0xFDFFFFF7, 0xA80024CE, 0x36002610, 0x012A0002,
+0x11044800, 0xE0018EDE, 0x08A7E77F, 0x00A800A9, 0x002510E9, 0x054EB5DA, 0x800A9800, 0x088873F4,
+0xCE7D0046, 0xF60004E4, 0x00040001, 0x0004EC00, 0x58110010, 0x78200500, 0x000044A5, 0xE8200172,
+0x20041C18, 0x047C3A2D, 0x02001000, 0x00F00212, 0xE75FFFFF, 0x08A810C8, 0x00E900A9, 0xBE5A0086,
+0xFFF7D098, 0x883A8EF7, 0x6708A900, 0x26B5FB00, 0x06AC0000, 0xC0003200, 0x0066D6DD, 0x008808A9,
+0x088608C8, 0x18000A1C, 0x04C00000, 0x14FFFF40, 0x2007CE7C, 0x04D4424D, 0x0988DE11, 0xC47C1320,
+0x10A72106, 0x3E0009F0, 0x00160001, 0x30010000, 0xC43A2DF7, 0x3A0C2004, 0xD6000AB6, 0xEFFFC409,
+0x00E81128, 0x006600C9, 0x00AC6BD3, 0x40000800, 0xBE1BF7DF, 0x25220568, 0x0009C400, 0x86000110,
+0xEFFF8000, 0x00A80086, 0x0518218B, 0x00014000, 0xDFB018B0, 0x05ADBAF7, 0x6510A800, 0x96901E00,
+0x01027C00, 0xFA005A38, 0x6BB12002, 0xC6200282, 0x00003010, 0xBEC0016C, 0xCBF7FFEF, 0x8708A829,
+0x5031EC08, 0xCB020000, 0x00007001, 0xF7611060, 0x00266350, 0x13030EA8, 0x000A008D, 0x38000FA0,
+0x01540000, 0x00000400, 0x040F0074, 0x52002F00, 0x05000F00, 0x005B0002, 0xE7FFF790, 0x44F96D39,
+0x1B98659B, 0x0001EC00, 0xE6010015, 0xB7A67905, 0xFF4CB64C, 0x819A64CF, 0x3A6517E7, 0x5F3CB845,
+0x04000512, 0x02020009, 0x93000401, 0xB7CFFFEF, 0xF7453A44, 0x0305484C, 0x070F0047, 0xF7820600,
+0x08C82169, 0xB4580046, 0x16FA0104, 0x0200F200, 0xDFC30054, 0xC90087EF, 0x8800C808, 0x42B5DA08,
+0x55F73000, 0x220A1C84, 0x0478CE9D, 0x03002C00, 0xFF91001A, 0xA559FFFF, 0x08660046, 0xF7A0004C,
+0x8474FFFF, 0x08670867, 0x020172AB, 0x6E00092C, 0x002D0401, 0x0067F7B1, 0x00E908C9, 0xC67B0066,
+0xF7900013, 0x00C942AF, 0x424D08A8, 0x06020262, 0x06C00157, 0x6351F7B0, 0x08EA0088, 0xA5380067,
+0x4401026A, 0x00480001, 0xFFFFF794, 0x08A810E8, 0x00820046, 0x25E73F82, 0xA710C800, 0x0002BE08,
+0x400001DE, 0x001E0300, 0x31EBF781, 0x002508A8, 0x00034699, 0x07800062, 0xA808E911, 0x34218A00,
+0x00240301, 0xA0008701, 0x73B3F7DF, 0x08670887, 0x003E7BF4, 0x0000E402, 0x866202F8, 0xAC08A900,
+0x04005C29, 0x45110296, 0x5F1103B8, 0xCC04AA88, 0x004C011F, 0xF7FFF7B0, 0x08875B50, 0x74120086,
+0x59000060, 0xA5787100, 0x08870046, 0x0000706A, 0xB6000010, 0x00CC0603, 0x6852D063, 0x8010CA00,
+0x001F0007, 0x010FC404, 0x050F000C, 0x96002F00, 0x006E0000, 0x020A000F, 0x6007E802, 0x59DFFFF7,
+0x0280D96D, 0x0305CA00, 0xFE10102E, 0x9E40DC00, 0x80964CD7, 0xFFEF3202, 0xA00EE3FF, 0xAF3FEFFF,
+0x44D844B7, 0x052C867D, 0x0007AE00, 0xD200005C, 0x00600100, 0xAF1EE780, 0x3CB73CD8, 0x0120ACFD,
+0xC0020402, 0x00240000, 0x00000A00, 0x0C01019A, 0x00780100, 0xEEC63B20, 0x3A0C200B, 0x4600016E,
+0x00080004, 0x0109D600, 0xFFD40280, 0x9D17F7FF, 0x08E90045, 0xB5BA0046, 0x148000C4, 0x45008774,
+0x74CE9D00, 0x001400A2, 0x01000401, 0xDF40004C, 0x1C9D38F7, 0x6C77100A, 0xFFFFB007, 0x8808A6F7,
+0x7F084708, 0x020238EF, 0x2C0001CA, 0x00A80000, 0x20020200, 0x02829D58, 0x00006620, 0x0090000A,
+0x88428E71, 0xB9006600, 0x80000BDA, 0x002C0003, 0x85001800, 0x0046CE9C, 0x006608C9, 0x7E0000B8,
+0x00C90002, 0x7C12F783, 0x00660066, 0x200530D9, 0x0A3852EF, 0x01004002, 0x920101F6, 0x00D00204,
+0x60051200, 0x08A70045, 0x005A2107, 0x73025000, 0x00A91928, 0x2A570067, 0x006C000D, 0x00000400,
+0xBF200057, 0x130A5EEF, 0x0313EC8A, 0xF76100B8, 0x00880887, 0x0011806B, 0xC400011E, 0x84752000,
+0x14220AC8, 0x0200987C, 0x44000130, 0x000A0000, 0x62001400, 0x08A80866, 0x02B20065, 0x08F7BF40,
+0x02087219, 0x2200082E, 0x00580200, 0x00004800, 0xDFA00654, 0xA90868F7, 0x6C00A808, 0x020E383A,
+0xD800001C, 0x00500001, 0x0F009400, 0x00330004, 0x000F014E, 0x2A000205, 0x05000101, 0x004CDA20,
+0x006E0005, 0x60007A05, 0xD79F1FEF, 0x0280B744, 0x01024C01, 0xE7600018, 0x3CF9659A, 0x010014D8,
+0x6E050728, 0x06740101, 0x62BA6400, 0x3CF8557A, 0xAE226D58, 0x0F004E00, 0x00030004, 0x0F710FEC,
+0x2608675B, 0x0C4EDE00, 0x00002608, 0x0400011A, 0xF7FFA400, 0x08C81108, 0xB5BA0867, 0x558201CA,
+0x66008784, 0x26C69C00, 0x00340501, 0x61028201, 0x0066A558, 0x01D60886, 0xBE1BF730, 0xD0210A40,
+0x0100B252, 0x2C000558, 0x000E0000, 0x00F0BD12, 0x1908F781, 0x004608A9, 0x800F4A5B, 0x428FF7DF,
+0x08860087, 0x28040934, 0x002C0000, 0x00022C00, 0x292B0F98, 0xA0007019, 0x97FFFFFF, 0x660887AD,
+0x094EB500, 0xEFDFFF91, 0x08A70886, 0x010C10E7, 0x03004100, 0x70000004, 0x00480102, 0x5310F790,
+0x002508A7, 0x0012D6BD, 0x28FFFF40, 0x1507EC19, 0x036958BF, 0x0700002F, 0x69F77300, 0x6610A821,
+0x0014D008, 0xFF800012, 0x0867FFDF, 0x006B08A9, 0x00100119, 0x20009600, 0x0D10298A, 0x01014400,
+0x18000060, 0x00D80000, 0x00172200, 0xF7900322, 0x006794B8, 0x9D580066, 0xFF700138, 0x670046DE,
+0x05DC6D08, 0x00101803, 0x0400002F, 0x02140300, 0x8C76FF70, 0x00A70888, 0x16000780, 0x00EC0E00,
+0x0F001602, 0x00250006, 0x6A0000A2, 0x04A00200, 0x0014000D, 0x0001069E, 0x3CD83105, 0x000A009B,
+0x340001FA, 0x0BB40000, 0xD79EFE70, 0xFF4C764C, 0x32020864, 0xFFF7C041, 0x1A44F9E7, 0xFF765D3D,
+0x13F0FFD7, 0x00283400, 0x04001174, 0x00100200, 0x973FDF61, 0x20D644D8, 0x00FE01BA, 0x0301FE01,
+0xC3010080, 0x08600000, 0x6003A400, 0x18E7F7DF, 0x06B408A8, 0x00001701, 0xFA010088, 0x064E0005,
+0x00056C00, 0x5020066A, 0x2001B85B, 0x0090BDDA, 0x82009800, 0x00877C14, 0xCEBD0065, 0xA6030040,
+0x26F71001, 0xFFFF8272, 0x00669D38, 0x0A000065, 0x87741380, 0xBB004608, 0x000028AD, 0x3C000150,
+0x00660000, 0x00008800, 0xDF930058, 0x4773B2F7, 0x3A084600, 0x8E2002CA, 0x00119A42, 0xB402091E,
+0x00700000, 0x20024E00, 0x09D6F7DF, 0x0490CC11, 0x04001E01, 0xF73001E6, 0x111ACE9B, 0x647C5320,
+0xCE9C2004, 0xD32002A6, 0x00000C6B, 0x6600021E, 0x00040602, 0x82003800, 0x0046AE1B, 0x94B60087,
+0x29810058, 0x87008819, 0x5AF7DF08, 0x00F80129, 0x01009C00, 0xF76100AC, 0x00874AAE, 0x01057005,
+0x4E010080, 0x08865202, 0x008B08A8, 0x00800005, 0xF7FFF780, 0x08C90066, 0x0004B04D, 0xFA040418,
+0x1F9C0003, 0x80038A00, 0x1FF7DFF7, 0x670868DF, 0xF7710FBC, 0x94D7FFFF, 0x10180046, 0x00001C00,
+0x44020069, 0x000A0000, 0xB2586400, 0x5FF7FFF7, 0x870025E7, 0x00424C00, 0x00780005, 0x00012800,
+0x25010004, 0x00050F00, 0x004E0132, 0x0414000C, 0xF797005A, 0x6D59E7FF, 0x659A44F9, 0x1C000DA6,
+0x1FE77000, 0x9644D7A7, 0x000A0054, 0x9600000F, 0xFF02F005, 0x3B3CB8D7, 0xFB6DFC35, 0xDA85FB7D,
+0xBA85DA85, 0x04F00006, 0xD985FA7D, 0xDA85DA7D, 0xDA8DDA7D, 0x186DFC7D, 0x984C9645, 0x016E01D5,
+0x0103740B, 0x05000048, 0xDFFF8000, 0xA80044FF, 0x01DCEB08, 0x00011A07, 0xBC020064, 0x01CA0001,
+0x66A57962, 0x80084600, 0x0738000C, 0xD8843420, 0x0F000003, 0x04004301, 0x52000005, 0x79FF3001,
+0x1010C4AD, 0x310A4C78, 0x7252CFF7, 0x15AA0006, 0x01002400, 0x88000020, 0x00040202, 0x73005A00,
+0x0867A558, 0x003B0046, 0x4A8F640A, 0x00250888, 0x3300017A, 0x00040100, 0xEADFF721, 0xA4EC1001,
+0x00110000, 0x00004803, 0x7B80000B, 0x670047CE, 0x5E845400, 0xA5782202, 0xD20011E6, 0x0845C010,
+0x08450866, 0x08450846, 0x000C0865, 0x650865E0, 0xC7006500, 0xA808C800, 0xC4635108, 0xF7FF8200,
+0x08A91949, 0x050010C8, 0x00004C00, 0x08030078, 0x0FF73000, 0x02033A53, 0x14010836, 0xFFFF8700,
+0xC80086F7, 0x05008A08, 0x46D6FC60, 0x3A00A800, 0x0846300B, 0x10007046, 0x7007FE00, 0x00640085,
+0xA8440885, 0xA8009011, 0xC908A910, 0x7029AB10, 0x6B928A00, 0x08670888, 0x035ACEBE, 0x02005C03,
+0xF7510007, 0x08C80866, 0x10032080, 0x01280400, 0x0F000F02, 0x002B0006, 0x7E000206, 0x05000102,
+0x0014000B, 0x1802001C, 0x6D584000, 0x11803CF8, 0x0310DA02, 0xEF540030, 0x44D79EFE, 0x26010A00,
+0x7EF7A001, 0x3B44D8CF, 0xB83D1935, 0x4421284A, 0x500002B7, 0x3CB744B8, 0xD1000AD7, 0xB744B74C,
+0x183CF83C, 0x5F449545, 0x0302CCB7, 0x50031A4E, 0x9B6A0100, 0x00000C00, 0xDF71004C, 0x870024F7,
+0x0EA06D00, 0x00001401, 0x040700E7, 0x013C0063, 0x07549911, 0x02028000, 0x3420013E, 0x0015627C,
+0x2D000A00, 0x00140200, 0x00004C00, 0x58100534, 0x00300C80, 0x0696A558, 0x84426C20, 0x22BF1010,
+0x04600208, 0x00023A03, 0x000000F0, 0xF7FF5305, 0x0025B5D9, 0x00100005, 0x22426E20, 0x024C000C,
+0x00092003, 0x16000030, 0x66F75203, 0x00008700, 0x04A00205, 0x20007404, 0x0EACC67B, 0x10845420,
+0xA577200F, 0xC8500AA8, 0x8600A700, 0x001014CA, 0x4800079A, 0x0008000C, 0x86088640, 0x11139800,
+0x00161AC7, 0xFF8000AC, 0xA71129EF, 0x5008C700, 0x060C0000, 0x01037200, 0xD3000018, 0xEEEF9200,
+0x47088852, 0xD2E77F00, 0x001300CA, 0xA6EFDF53, 0x0CAEA708, 0x50D74C01, 0x65C67AF7, 0x000CC200,
+0x6A00088C, 0x0887200C, 0x8710171C, 0x600316F2, 0x00655316, 0x78670087, 0x63717014, 0x00460068,
+0x0612DEFF, 0xDC001316, 0x07AE0000, 0x0001A002, 0x08201E62, 0x0005502C, 0x04000071, 0x01000000,
+0x0F000800, 0x01360004, 0x000F01E2, 0x581F0805, 0x42010500, 0xB7A6FFEF, 0xCA020A00, 0xFF1DF101,
+0xD79FFFFF, 0x3D3A44B8, 0x763D65DC, 0x7E3D7E3D, 0x761C7E3C, 0x7E1C7E1D, 0x761C7E1D, 0x7E1C863C,
+0x761C7E1C, 0x761B7E5D, 0x2EBF7DDA, 0x00BF0219, 0x02007C01, 0x0601000B, 0x01F20000, 0x53017200,
+0x08C80025, 0x050D96AB, 0xDE010024, 0x03800239, 0x58F7DF40, 0x0609D49D, 0x13200F00, 0x0004B67C,
+0x49010F00, 0x069E0000, 0x01000900, 0x1860012E, 0x6700669D, 0x2008F408, 0x0500FFFF, 0x5F002530,
+0x1C010500, 0x00250000, 0x00000406, 0x36200080, 0x1004689D, 0x8213D45B, 0x6EFFFFFF, 0x4600684A,
+0xB0010212, 0x1C460205, 0x00003200, 0xCC101404, 0x6C030448, 0x02C20000, 0x70001800, 0x0047CE9C,
+0xDC330087, 0xFF01F118, 0x0066AD77, 0x428F00A8, 0x6BB26BD3, 0x02B26B92, 0x9207F000, 0xB26BB36B,
+0xB16BD36B, 0x9173D26B, 0xB273F36B, 0xF66BB263, 0x4003549C, 0x1128F7FF, 0xCA0202AC, 0x027E0002,
+0xA600FC05, 0xEEF7FFFF, 0x0610A852, 0x00B69F00, 0xF7FFF743, 0x00050085, 0x2C00031C, 0xD6FCA000,
+0x00880066, 0x73F431CD, 0xB2600064, 0xB36BB273, 0x1100706B, 0xC00074B3, 0x63B16BD2, 0x6BD26BD2,
+0x7C336B72, 0xD3200070, 0x13103473, 0x001034FE, 0xC0000040, 0x00040400, 0x65001001, 0x470887F7,
+0x28006E00, 0x0F001C04, 0x00330008, 0x66000132, 0x04E80100, 0x0114000F, 0x00042200, 0x00030F00,
+0x0030010A, 0x00010002, 0x00050500, 0x0232000F, 0xFFFFDFC1, 0x1A3C77E7, 0xFF8EBD3D, 0x021B6CD7,
+0x00000A00, 0x14080414, 0x00000C02, 0x64030006, 0x01360403, 0x00005800, 0xF4000004, 0x004C0003,
+0x29F7BF80, 0xC8008721, 0x0012A808, 0x50012336, 0x0034031D, 0x0009B000, 0x92700D9C, 0x4508A863,
+0x1DB4FA00, 0x1000A600, 0x400280F7, 0xC63B0066, 0x46000048, 0x00080002, 0x00004C00, 0x35200030,
+0x11141C84, 0x2009F479, 0x0E9E7413, 0x000C9A11, 0x00002800, 0x2C000020, 0x07DA0000, 0x9201F200,
+0x5B30F7DF, 0x00470087, 0x7014005B, 0x87428DFF, 0x1E000408, 0x02160300, 0x61026E04, 0xA80865F7,
+0x277CCC00, 0x0000C800, 0x4C000048, 0xF7BFA001, 0x0026CE7C, 0x84730087, 0x9B2009F4, 0x200210CE,
+0x000C63B3, 0x0501F200, 0x06010004, 0x09560017, 0x0104EC00, 0xD3000004, 0x48EF7001, 0xE900C819,
+0x00166610, 0x10000094, 0x00540001, 0x90000C00, 0x530EF7FF, 0x00460886, 0x021E049F, 0xDE020184,
+0x8A00220C, 0xB4030A00, 0x00463104, 0x0113CE89, 0x34030054, 0x00400001, 0x02000401, 0xC4010A08,
+0x00D200F3, 0x2894F720, 0x95372205, 0x81000168, 0x18460100, 0x01149C00, 0xDF900B9C, 0x27E73FF7,
+0x2D10C900, 0x7E001900, 0x00780403, 0x0F002B02, 0x00340006, 0x000F00E2, 0x6000020F, 0x0A000100,
+0x1180FA10, 0x032DE403, 0x00000142, 0x14000305, 0x01002700, 0xEF710004, 0x3CF95D39, 0x16926579,
+0x02001101, 0xFA000005, 0x000A0100, 0x000B0E04, 0x1101012A, 0x004C0100, 0x00029E04, 0xF601001E,
+0x001B0000, 0xA8633080, 0x5B002608, 0x050126C6, 0xFE030040, 0x00200011, 0xC8F7FF40, 0x15190008,
+0x201400D9, 0x09E494F7, 0x0016AE00, 0xD4000020, 0x00380400, 0x52F7BF80, 0x67006763, 0x400A0000,
+0xC65CF7DF, 0x6E170C12, 0x28000DF4, 0x00040000, 0x00003800, 0x86610768, 0x4610C908, 0x5018D400,
+0x8EF7DFFF, 0x000CE84A, 0x200101CE, 0x01860000, 0x00000903, 0xAC200280, 0x00059029, 0x08060280,
+0xCE5B2000, 0x800006F6, 0x00E00002, 0x88088764, 0x4010A808, 0x00980000, 0x02003F00, 0x0A0002EA,
+0xBDD92000, 0xD60320EE, 0x28F76009, 0xC800A911, 0x1B0016D2, 0x006C0300, 0x00003400, 0xCE2000A0,
+0x10059852, 0x0302BABF, 0x0000001E, 0x00A8150A, 0x0024000A, 0x6AF7DF40, 0x00147E29, 0x2500037A,
+0x003C0200, 0x02014600, 0xFF90093E, 0xB4BDF9FF, 0x1D8C9494, 0xFF7933EF, 0x0025DF1F, 0x1B5E10E8,
+0x00007403, 0x4400003C, 0x8C752000, 0x00021A6C, 0x004C0019, 0x0F001801, 0x00360005, 0x64030052,
+0xFFF78503, 0xF96D99DF, 0x28003A3C, 0x00041C00, 0xFF710EE8, 0xD96D38DF, 0x0F007B44, 0x0021AC00,
+0x80000034, 0x9EDF8416, 0x44754CD7, 0x09CCCFFF, 0xFFFFDEA0, 0xD88E7DEF, 0x143CB644, 0x00A30028,
+0x0104B600, 0x5C0217D6, 0xFFE79208, 0xFEA6FFD7, 0x48CF5EAE, 0x01920104, 0xE7FFF750, 0x0A2A7DFA,
+0x467DFB23, 0x0039002D, 0xFFBFFFB0, 0x0046D6BD, 0x29890088, 0x3E02002C, 0x015E0001, 0x00007C00,
+0xDF300098, 0x13A617F7, 0x00860044, 0x301E00D9, 0xCCBE3BFF, 0x6351200D, 0x8C000136, 0x00360004,
+0x50000801, 0xA7F7FFF7, 0x1013AA08, 0x10F48A58, 0x000934FF, 0x1E1104E0, 0x60040182, 0x002E0200,
+0x70055800, 0x00678454, 0x002708AA, 0x03120014, 0x0F00F710, 0x05000510, 0x0003FC03, 0xA5010054,
+0x65F74000, 0x05008800, 0x0116EF10, 0x000F7002, 0xDF4000A0, 0xBCCE7CFF, 0x80531114, 0xF7FF400C,
+0x081852EF, 0x989CF820, 0x00600000, 0x00000800, 0x0C020044, 0xDF1E8000, 0x00450003, 0x008010A6,
+0x30015600, 0x80A71148, 0x04B80302, 0x00006800, 0x08000054, 0xF7FF8000, 0x088852CF, 0x1B520006,
+0x00010401, 0xCC000588, 0x0A000314, 0x00004200, 0xB5800124, 0x6700668C, 0x60633200, 0x27CC0001,
+0x00064000, 0x74000018, 0x018E0000, 0x45002451, 0x0D500308, 0x20031E00, 0x2078216A, 0x78CEDC20,
+0x03460003, 0x03004600, 0xFE0000CC, 0xA8EF3000, 0x0019CE08, 0xB8001400, 0x008C0000, 0x00004C00,
+0x94010004, 0x00050F00, 0x0052002E, 0x10004501, 0x022580F7, 0xB2042D00, 0x00720000, 0xFFEFFFA0,
+0xDA6D38E7, 0x006D9B4C, 0x002A0119, 0x43000502, 0x97A6FFEF, 0xCC000A00, 0x01C80003, 0x6113E200,
+0x4D194C96, 0x024C5518, 0x00002802, 0xBA000006, 0xFFEFB001, 0x976D58DF, 0xBF443444, 0x01011ADF,
+0x00F000C2, 0x58EFFFEF, 0x3B44D875, 0xD83D3B3D, 0x2075583C, 0x00180123, 0x82015A00, 0xC831ABFF,
+0x54086608, 0x9E01247A, 0x0142000C, 0x40004F00, 0xEF7FF7FF, 0xA8001066, 0xB5F9221A, 0xF80003D8,
+0x0045501C, 0x5A6610E8, 0x01BE0101, 0x00004A00, 0xFFC20004, 0x679D37FF, 0x67008800, 0x06A59900,
+0x8CB42007, 0x07202026, 0x00008819, 0x26000050, 0x00040000, 0x9300F000, 0x0886DF1E, 0x08A90888,
+0x72050087, 0x428EF7FF, 0xF6260087, 0x002D0010, 0x7005BC04, 0x65F7FFF7, 0x8008A900, 0x020E000C,
+0x30014805, 0x00FFFFFF, 0x0066120F, 0xC2FF120F, 0x10C93010, 0x000A7226, 0x9C000108, 0x2ADA0000,
+0x5001DE00, 0x6AF7FFF7, 0x21206821, 0x0080AD9A, 0xF7FFFF50, 0x23200907, 0x030F8600, 0x9004006D,
+0x80F71004, 0x08694302, 0x0D3A0027, 0x10001F02, 0x001C06F7, 0x840018BE, 0x00440000, 0x2000D400,
+0x05C00045, 0x0CBDFA20, 0x00180000, 0x00002B00, 0xE000001C, 0x4A8D6200, 0x08461087, 0x80000A9C,
+0xADDA2002, 0x28201B92, 0x00078219, 0x2C000020, 0x00040100, 0xA200A000, 0xA84AAFEF, 0x8710C908,
+0x1E008D00, 0x0100C000, 0x050F001D, 0x96013500, 0x01DC0000, 0x701DBA00, 0xD9759ADF, 0xFD4D393C,
+0xD2DF1107, 0x01DA0118, 0x13140001, 0x010A00D9, 0x540200A2, 0xFFEF4513, 0x0A00D89E, 0xE4C8DE13,
+0xBEE7FFB0, 0xDA44B8AE, 0xFF5D1844, 0xC4002FB2, 0x00040200, 0x502FDE00, 0xB844B865, 0x05AB2844,
+0x01F000BE, 0x96C7DFEF, 0x3C451A44, 0x3B351B3D, 0x9F447545, 0x8E002864, 0x00040100, 0x24EF9F40,
+0x2022E200, 0x1C967C34, 0x00236002, 0xDF400152, 0xC4D6DEF7, 0x00A94017, 0x186608E9, 0x010ED400,
+0xF79200C8, 0x006652EE, 0x4A8E0888, 0xD2000266, 0x000A0003, 0xD0D6DE20, 0x192C0018, 0x1E007912,
+0xFFFFFF50, 0x0E161949, 0x1D388A10, 0x02091201, 0xFF400058, 0x2ED71EF7, 0x08A82016, 0x000010C0,
+0x00F00019, 0x58426D20, 0x0066000F, 0x0101B000, 0x70010114, 0x1AFF100A, 0xCC00200E, 0xFF10361A,
+0x820403B2, 0x05000002, 0x010F0002, 0xF751094C, 0x73F3F7FF, 0x9C002148, 0xFFEF4014, 0xC2A0BEF7,
+0xB401CA00, 0xABF7FFF7, 0x87084731, 0xF03A2C08, 0xF7FF4009, 0x05001948, 0x00009000, 0xD8000050,
+0x00080000, 0x7103E200, 0x52EFF7DF, 0x00270868, 0x0014000A, 0x00025A00, 0xA9333200, 0x0DA88B08,
+0x500F1803, 0x25ADD9F7, 0x25123400, 0x0256AD99, 0x30018602, 0x6E4AAEF7, 0x18E8201B, 0x5C000060,
+0x1E140000, 0x10426D20, 0x214A210B, 0x1A010084, 0x28AE0403, 0x4C52EF20, 0x08A9310A, 0x000F00A9,
+0xBA00010C, 0x00380001, 0x00008000, 0x040F000C, 0x4E002F00, 0xFF04F000, 0xDFDF9FF7, 0x7BCFFFCF,
+0x5A451A65, 0x9FCFFF4D, 0x217A9FCF, 0xF10ED200, 0xD7DFDF00, 0x5559CFFF, 0x559B453A, 0xD7BFCFFF,
+0x03F00018, 0xBFE7BFF7, 0xBFCFFFD7, 0xD844F986, 0xFFAFBF4C, 0x16849FD7, 0xD6015202, 0xBCE7FFFF,
+0x1944B87D, 0xFE4CB64D, 0x901686A6, 0x5CF7AEFE, 0x44D84CF9, 0x0134AC9A, 0xCE0117DC, 0xEF02F100,
+0x44D8B75F, 0x3D5C453B, 0x3D1B3D3C, 0xAF1E4CD8, 0xD5020234, 0xFFF75000, 0x72BE1AFF, 0x0066501A,
+0x3AB8218A, 0x0144011B, 0x51DF1E40, 0x94224C63, 0x42900067, 0x08660087, 0x700A00B9, 0xBFFFFFFF,
+0xDC0866EF, 0x39EC3010, 0x001052DE, 0xF7C129DE, 0x10878C95, 0x08890888, 0x4C8608C8, 0x00F0011E,
+0xF7FFFF40, 0x43278AC7, 0x94008608, 0xA8000726, 0x6BB12004, 0x8740160A, 0x4242AF00, 0x947B1009,
+0x23000106, 0x0004A200, 0x990201B2, 0x05EA0100, 0x20028200, 0x050045FF, 0x021E4601, 0x200006B6,
+0x000A0000, 0x400C8000, 0x8C550067, 0x3A000280, 0xF7FFD002, 0x0026424D, 0x004510A8, 0x813E5B0F,
+0x0FC80000, 0x8C74EFB0, 0x10880886, 0x18E70867, 0x6003010C, 0x07F73100, 0x02177811, 0x080108B2,
+0x00560006, 0x0002FA02, 0x26220F00, 0x000A2A00, 0x26000047, 0x00661205, 0xA4F71219, 0x0A84001C,
+0x20002C00, 0x012473D3, 0x4D006641, 0x01151042, 0x5860013A, 0xA710E7A5, 0x1034B008, 0x040FFC7F,
+0xF7E2CB96, 0x18E7F7FF, 0x08870887, 0x7C131087, 0x7010CC7F, 0x78F7DFF7, 0x0A18E8A5, 0x3A0E5F06,
+0x006810AA, 0x820F000F, 0xF2002F02, 0x00C60000, 0xF23BC800, 0xB9445502, 0x5B2CB83C, 0x3A3D3B3D,
+0xD634F835, 0xC648D53C, 0x4C76EFB0, 0x34D93CB8, 0x353B3D5B, 0x97400722, 0x0364F744, 0x3A04F00C,
+0xD93C769E, 0x3A351A3C, 0x19353935, 0x562CB835, 0xDD6E5E44, 0x09F0F710, 0xF00CC800, 0x96963B0A,
+0xD8453A3C, 0x7A3CB83C, 0x595D9B55, 0xD744D755, 0x964D193C, 0x09E4BA44, 0x02010C00, 0x74000153,
+0x56D7E005, 0x1B451A44, 0x1A355C35, 0xDF4C5545, 0xDA010534, 0x009C0101, 0xF7FFF750, 0x27B8C65B,
+0x80020E00, 0x10E70046, 0x006710E8, 0xA78015DA, 0xDA000408, 0x9894F8AD, 0x00DA1104, 0x00C8000A,
+0xA003B600, 0x0065BE7B, 0x088808A7, 0x36160005, 0x27D44A10, 0x088608C1, 0x95180066, 0x006508A6,
+0x00050077, 0x52002796, 0x29892005, 0x672011E4, 0x2009AC00, 0x0BDA1109, 0x6029E800, 0x9D580046,
+0x00689D38, 0x86BE3A20, 0xFFFF8300, 0x0885428C, 0x02760023, 0x00077E04, 0xF763021A, 0x08870865,
+0x020280CB, 0x7E000934, 0x05000002, 0xA7002560, 0x90841310, 0x11AE0104, 0xDFF702F0, 0x055AEFF7,
+0x6610A700, 0x46002608, 0x5C190A00, 0x0867701C, 0x08261088, 0x010040AA, 0xC4000114, 0xF7DF4100,
+0x02801908, 0x00245002, 0x0401068B, 0x01EE0100, 0x5B0EF730, 0xF2001EC6, 0x04FC002D, 0x00006C01,
+0x3E030584, 0x00400020, 0x0208A200, 0x34E00A58, 0x68002684, 0x27088808, 0xE9002600, 0x1200DE18,
+0x30285246, 0xF0E77F10, 0x00D00202, 0x00003000, 0x0B200504, 0x0026A03A, 0x66800AA8, 0xC7214908,
+0xBC002610, 0x00256016, 0xF7DF39EC, 0x0000033A, 0x00360014, 0x00006400, 0x90000004, 0x00040000,
+0x0F01C902, 0x00260006, 0x3D0004B4, 0x97EF2000, 0x32010268, 0x1624002A, 0x163CD631, 0x05F00EC4,
+0x5CF8E7FF, 0x3CD93CD8, 0x44F934D8, 0x44F93CB8, 0x6CF83C77, 0xF94004D4, 0x78447795, 0x3CF8B52A,
+0x34D744F8, 0x3C563D19, 0x0113D25F, 0x08F0255C, 0x59B79FE7, 0xF93CB855, 0xF93CD93C, 0xD744F844,
+0xF744B83C, 0x18AF3F54, 0x006F000F, 0xF5000405, 0xEFFFEF00, 0x4CB78DFA, 0x451A4519, 0x85BA4497,
+0x9804A8C6, 0x00080000, 0x5B10F730, 0x800029BA, 0x08A82027, 0x00F40006, 0x29690046, 0xF7DFDF3F,
+0x00038434, 0x00980824, 0x0055002D, 0x201A3001, 0x247E29AA, 0x1122E200, 0xB21800A8, 0xDF3F10C7,
+0x0023BE3C, 0xF4360044, 0x02E2011C, 0x20056A00, 0x2C208CB6, 0x000B6000, 0x01F12C90, 0x00250847,
+0xCE9E2129, 0x7413F7FF, 0x00470889, 0xFF90043A, 0x3A2AFFFF, 0x08430023, 0x63000176, 0x00040600,
+0x43FFDF82, 0x48002400, 0x01231421, 0xB0000020, 0xFFFFB000, 0x65C63AFF, 0xF2000308, 0x0000147B,
+0x04020BD4, 0xBDDA4005, 0x01E610C7, 0x680868E1, 0x68088908, 0x46084708, 0xFA9CD700, 0x00380012,
+0x93000400, 0x85FFFFFF, 0x45004608, 0x0004C800, 0x710602E6, 0x4AFF8300, 0x24084542, 0x355ABF00,
+0x60024200, 0x0024FFDF, 0x0ACA0846, 0x01020E04, 0x4C000008, 0xDFF7C100, 0x06296AD6, 0x89084800,
+0x05FE8808, 0x45006651, 0x20961300, 0x02003A02, 0x30040059, 0x9CF74000, 0x36EA10A7, 0xA0064000,
+0x10880887, 0x10860846, 0x05628C74, 0x24004560, 0x7E39EA00, 0x00320202, 0x01000602, 0x0B020038,
+0x00060F00, 0x05C80024, 0xF0173402, 0x1DF7FF05, 0x7FC75FC7, 0x3FC75FBF, 0x5EC75FC7, 0x1DCF7EC7,
+0xD0093ACF, 0xC6FDFFFF, 0xC75EC73E, 0xBF5EC79F, 0x2100025F, 0x076A5EC7, 0x3EE79EC0, 0x5FC75FC7,
+0x3EC77FBF, 0x200038BF, 0x0868BF3E, 0x00016E00, 0x80010D60, 0xEF01F203, 0xCFBFE7FF, 0x85DBA67D,
+0x85DA757A, 0xA67EA6BC, 0x103A0134, 0x0103BC00, 0xF60000CE, 0xFFF7A003, 0x59A69CEF, 0xBD6D5875,
+0x12002830, 0x021E0100, 0x0101B601, 0x780203FA, 0x9D37E209, 0x3A2C6371, 0x428D3A2C, 0xD6FD8454,
+0xFC82009C, 0xF9C61AD6, 0x78EF5FBD, 0x01050200, 0xE0007C01, 0xF2D6FDF7, 0x8A424D73, 0x5031CB29,
+0x22B89863, 0xE79FF781, 0xB619B619, 0x8103FA5E, 0x6330FFDF, 0x63516391, 0x00F0005A, 0xB1BE1AF7,
+0x0A3A2B6B, 0x534AAC32, 0x0CD6BD84, 0x072E0004, 0x27008831, 0xD00006E8, 0xCEBB5100, 0x66D8BE3A,
+0x06DA0023, 0x0001BC00, 0x08000758, 0xBDF96000, 0xC65BBE1A, 0x84000526, 0x00820000, 0x90019600,
+0xF79FFFDF, 0xC65AB5D8, 0x0129E61C, 0x04001844, 0x190C0005, 0xF7FF01F0, 0x73D2C69C, 0x3A2C424C,
+0x6BB1424C, 0x0014ADD9, 0x03007201, 0x600000F4, 0xC65A5100, 0x3AF9BDF9, 0x004C020C, 0x03006800,
+0xF752028E, 0xBE1AD6DC, 0xBC000FF0, 0x00740100, 0xBE1AF750, 0x172AB5FA, 0x0219E600, 0x8800002C,
+0x01900000, 0xC0016400, 0x8455DF1E, 0x31EB4AAE, 0x6370320B, 0xAC0005FE, 0x01800000, 0x00003C00,
+0x0C050004, 0x0B060000, 0x7BEF00F0, 0x4C73F2C6, 0x4C3A0B42, 0xB9635042, 0x000220B5, 0xF8520044,
+0x7ABE3AB5, 0x9201088C, 0x00600001, 0x00035201, 0x040F0009, 0x80002C00, 0x00F60002, 0x01000401,
+0xA20001FE, 0x00760000, 0x00000400, 0x610100A2, 0x001A0000, 0x04000402, 0x0E020082, 0x0DCC0200,
+0x01000C00, 0x30040018, 0x013A0000, 0x09003803, 0x140013DC, 0x001C0100, 0x0003A000, 0xB800000D,
+0x07860020, 0x0020A200, 0x1800087A, 0x00040000, 0x000DF403, 0x0400002C, 0x002B0100, 0x01006C07,
+0x050B0010, 0x007C0500, 0x00002803, 0x040000C8, 0x00270100, 0x04005400, 0xFFA00004, 0x4A6DFFDF,
+0x00250046, 0x011872D6, 0x0C0001FA, 0x00F00005, 0x00002C02, 0xC9372058, 0x1384A810, 0x01001C05,
+0x050B0021, 0x00580000, 0x0904A803, 0x18030196, 0x01E20000, 0x0000C400, 0x68050004, 0x01320000,
+0x00002000, 0x4F030004, 0x003C0000, 0x03070E00, 0x5001000F, 0x000C0401, 0x00000805, 0x22000030,
+0x0011050C, 0x0101B801, 0x600000C4, 0x01040000, 0x01000400, 0x2800001F, 0x00300300, 0x01007805,
+0x42020019, 0x0028050D, 0x0200BC08, 0x26010098, 0x00F40004, 0x04014001, 0x3C030044, 0x00070F00,
+0x00820037, 0x0000F200, 0xA20400FA, 0x08540100, 0x02006300, 0x0A00008A, 0x16120500, 0x01009200,
+0x05000011, 0x36600000, 0x00002403, 0x4C000040, 0x00040400, 0x00005400, 0x2700000C, 0x00580100,
+0x04025A04, 0x3C000256, 0x001D0100, 0x0103D804, 0x4E000026, 0x014A0100, 0x00006800, 0x4808014E,
+0x00500000, 0x00000404, 0x0400001C, 0x00280000, 0x00004701, 0x46030122, 0x00240001, 0x01009000,
+0x180B001C, 0x00140000, 0x40055800, 0xD6FDF7FF, 0x54002F7E, 0x01620034, 0x00000401, 0x30000AD7,
+0xFFF75000, 0x085B31F7, 0x73D3200A, 0x68080018, 0x000C0100, 0x00006803, 0x0400000C, 0x00800400,
+0x01007802, 0x3A01005E, 0x00840002, 0x00000400, 0x1C000020, 0x00040400, 0x04008400, 0x200000EE,
+0x00440000, 0x01000401, 0xC0020528, 0x00780004, 0x00003800, 0x38050018, 0x013C0000, 0x00035A00,
+0x08040019, 0x000C0000, 0x08000400, 0xA003003C, 0x00680000, 0x04006000, 0x08000040, 0x00140000,
+0x00002F00, 0x5C0000A6, 0x000C0001, 0x04001800, 0x98040004, 0x00280400, 0x00002000, 0x48000004,
+0x00080000, 0x00002804, 0x04000098, 0x00140000, 0x2D00040F, 0x0328B400, 0x4B030344, 0x00660000,
+0x02000B01, 0x7E06018E, 0x00150002, 0x00001400, 0x0E000008, 0x04BC0201, 0x02000E03, 0x96040007,
+0x00DE0400, 0x0A001602, 0x14010060, 0x01420B00, 0x01003804, 0x050F001C, 0x9C000800, 0x002C0000,
+0x0C000400, 0x14080027, 0x000C0C00, 0x00003800, 0x18000030, 0x00040000, 0x7118D400, 0x08A70867,
+0x92BF08A6, 0x2EFE0038, 0x00002000, 0x95200182, 0x11255684, 0x011DF045, 0x050F0014, 0x4C000800,
+0x001F0800, 0x00001000, 0x14080004, 0x000C0400, 0x00008404, 0xD2040010, 0x00080001, 0x04003000,
+0x1C000004, 0x00040400, 0x04001400, 0x080F000C, 0x30041100, 0x00680800, 0x08003804, 0x28000014,
+0x00040000, 0x05001C08, 0xE0000020, 0x00040001, 0x03001D04, 0x30040008, 0x00280500, 0x0F001803,
+0x052F0007, 0x120312B8, 0x00620802, 0x00011E00, 0x1400030C, 0x02520000, 0x00000800, 0x8E000072,
+0x00040000, 0x00001404, 0x10000018, 0x097C0000, 0x00003400, 0x1C00000C, 0x003C0000, 0x00003000,
+0x04080020, 0x00140C00, 0x00003000, 0x24040038, 0x00200000, 0x00001400, 0x44040010, 0x00140000,
+0x00005400, 0x18080004, 0x00280000, 0x00001C00, 0x0C0003D4, 0x001C0000, 0x02000404, 0x54030018,
+0x04180304, 0x00070E00, 0xDF400004, 0xDA10C7F7, 0x00263330, 0x00341276, 0x1E4019EA, 0x8E3A6DD7,
+0x48251115, 0x00480036, 0x00005400, 0x04000048, 0x000C0400, 0x00001800, 0x08040010, 0x000C0000,
+0x0800A800, 0x14000084, 0x00200400, 0x00003800, 0x0400000C, 0x00240400, 0x02002000, 0x0E020034,
+0x00100007, 0x00002800, 0x280D0008, 0x00150000, 0x0203F201, 0x28040009, 0x000E0200, 0x0000E002,
+0x10000140, 0x003C0200, 0x000AA002, 0x04000028, 0x00140000, 0x00000404, 0x04000010, 0x007C0000,
+0x05003004, 0x11000154, 0x027E0300, 0x0000A804, 0x30000038, 0x00040000, 0x00000C00, 0x0C000023,
+0x00080000, 0x3300040F, 0x0F005604, 0x0019004E, 0x04000082, 0x003C0800, 0x00001000, 0x08010106,
+0x004D0B00, 0x08001400, 0x38080013, 0x00180800, 0x0F000C00, 0x0009001C, 0x040C0020, 0x005C0400,
+0x00000800, 0x40000004, 0x00040000, 0x0000280C, 0x20000010, 0x027E0100, 0xF0072400, 0x2129F704,
+0x10C90047, 0x00660047, 0x3A4C2189, 0x11073A4C, 0x6C001E18, 0x8C942225, 0x3400114E, 0x00040F00,
+0x00600019, 0x08003000, 0x14000080, 0x00040000, 0x00001800, 0x0C080004, 0x00100000, 0x0F000400,
+0x00150014, 0x040F002C, 0x4C000D00, 0x00040400, 0x00002C00, 0x0800000C, 0x00040000, 0x05009800,
+0x6A030010, 0x00180002, 0x0000040C, 0x04000024, 0x00180400, 0x04000C08, 0x080F0014, 0x2E002F00,
+0x00460002, 0x01009604, 0x96000066, 0x08500300, 0x00001008, 0x34010028, 0x05280303, 0x00001C05,
+0x34000458, 0x03A00000, 0x00000803, 0x30000050, 0x03440400, 0x00002C00, 0x40010004, 0x00300000,
+0x03002C00, 0x28000008, 0x00040000, 0x03003401, 0x90000078, 0x00040003, 0x07003001, 0x24040070,
+0x00180000, 0x07000C01, 0x10000048, 0x00040C00, 0x0400E004, 0x9E000060, 0x00880014, 0x60002804,
+0x7C33F7FF, 0x252A0866, 0x6600A740, 0x003AFE00, 0x6A402C5E, 0x76D6BD29, 0x0A9C0310, 0x0000A80B,
+0x50040040, 0x00480000, 0x00000C00, 0x08000090, 0x00F00000, 0x0000B800, 0x04040018, 0x00300000,
+0x00000404, 0x18040024, 0x00080800, 0x04002000, 0x0C000010, 0x00040000, 0x00001000, 0x04010030,
+0x01580300, 0x00000C00, 0x0400001C, 0x000C0000, 0x00007800, 0x04000028, 0x00100400, 0x00001C00,
+0x08000084, 0x00180400, 0x031FE001, 0x14040148, 0x086A0000, 0x03001801, 0x300000E0, 0x00040400,
+0x00002400, 0x10000004, 0x00580000, 0x00000800, 0x0C000004, 0x00040F00, 0x00DA0F3C, 0x01DA0305,
+0x00006E01, 0x04000024, 0x000D0000, 0x00000804, 0x0400000C, 0x00100700, 0x0000A204, 0x040000BA,
+0x001F0000, 0x04001404, 0x14000008, 0x00040400, 0x0100140F, 0x00015200, 0x40040020, 0x00100400,
+0x01001400, 0x70070004, 0x00100000, 0x00004400, 0x0C000004, 0x00040F00, 0x002C0211, 0x030D6400,
+0x03F006F6, 0x79FFFFF7, 0xAB5B31A5, 0x29194929, 0x14424D19, 0x1182DF7C, 0x001BFE01, 0x0400002C,
+0x00580F00, 0x00240411, 0x04003004, 0x100400C0, 0x00200400, 0x1100080F, 0x1A00340F, 0x0C01100B,
+0x88050130, 0x00280C00, 0x03008900, 0x0B0003EE, 0x00040000, 0x00007800, 0x0C000004, 0x00040400,
+0x0400100C, 0x080F0018, 0xA2003400, 0x0300030F, 0x0100BA00, 0x2801006E, 0x01A20703, 0x00028A00,
+0x040000AA, 0x002C0300, 0x0000D600, 0x86040004, 0x000C0000, 0x00003C00, 0x04000008, 0x03800000,
+0x00005000, 0x0800000C, 0x001C0800, 0x00001400, 0x9C040004, 0x000C0004, 0x00004800, 0x04000024,
+0x00300000, 0x00001000, 0x1C000008, 0x00040000, 0x00001800, 0x08000030, 0x00100000, 0x00002000,
+0x1000046C, 0x000C0000, 0x00000400, 0x1C010020, 0x016A0300, 0x00001C00, 0x1C000004, 0x00180000,
+0x03000402, 0xF80015EC, 0x00E80100, 0x0204E800, 0x74001384, 0x0004040E, 0x04003400, 0x8804041C,
+0x00140000, 0x00000400, 0x04000054, 0x00500000, 0x00001004, 0x28000008, 0x00180400, 0x00001C04,
+0x04040008, 0x00200400, 0x0000A800, 0x18000030, 0x00300000, 0x00000400, 0x0400000C, 0x000C0000,
+0x00002804, 0x28000010, 0x00100000, 0x03000801, 0x2401017C, 0x01940300, 0x00001C00, 0x70040028,
+0x00100001, 0x00000400, 0x04040014, 0x003C0000, 0x00007400, 0x14040004, 0x00440400, 0x01001000,
+0x50000020, 0x00600300, 0x00001405, 0xF4000148, 0x01280401, 0x00002403, 0x04000030, 0x00440400,
+0x0F000C00, 0x0E2B0004, 0x7E02004A, 0x00560002, 0x03008E05, 0x2C0E007E, 0x00260000, 0x0006AA02,
+0x3008001C, 0x010A0400, 0x00000800, 0x2A02001C, 0x0B2E0200, 0x0F000C04, 0x080D0008, 0x44080050,
+0x00720000, 0x0600100A, 0x1804004A, 0x00080400, 0x02001A06, 0x6600000A, 0x000A0202, 0x02000602,
+0x6A020028, 0x00060200, 0x06005E00, 0x26020BC2, 0x00060F00, 0x006C0233, 0x08004C06, 0x0C050010,
+0x01FA0000, 0x0F002306, 0x000E000A, 0x04000038, 0x01680000, 0x0E002D0F, 0x0401C80F, 0x03004001,
+0x44050282, 0x00880700, 0x05011808, 0x090F0020, 0xDC072F00, 0x004D0802, 0x04006E04, 0x1C000008,
+0x00A20000, 0x00000400, 0x04000014, 0x00140000, 0x00000404, 0x1C000010, 0x00100400, 0x00000C08,
+0x10080014, 0x002C0000, 0x0F001400, 0x08110004, 0x4400002C, 0x00040000, 0x08003804, 0x1400000C,
+0x00100F00, 0x0024000D, 0x07000405, 0x3808015A, 0x00700800, 0x08002C00, 0x1000001C, 0x00040F00,
+0x00240C01, 0x0800440C, 0x2C000034, 0x00040000, 0x00001404, 0x0400000C, 0x00100000, 0x04003800,
+0x1000000C, 0x00040F00, 0x00C80312, 0x03003805, 0x3C0F0010, 0x30050D00, 0x00290300, 0x0300100C,
+0x070D0017, 0x00280F00, 0x00390D15, 0xFF00110F, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFF5084, 0x00FFFFFF, 0x00000000
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSETS_RGB565_H */
@@ -1,76841 +0,0 @@
-/**
-  ******************************************************************************
-  * @file    LCD_DSI/LCD_DSI_VideoMode_SingleBuffer/CM7/Inc/image_320x240_argb8888.h
-  * @author  MCD Application Team
-  * @brief   This file contains ARGB8888 image 320x240.
-  ******************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2019 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  ******************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __IMAGE_320x240_ARGB8888_H
-#define __IMAGE_320x240_ARGB8888_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Includes ------------------------------------------------------------------*/
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-
-const uint32_t image_320x240_argb8888[76800] =
-{
-0xFF254888,
-0xFF254888,
-0xFF254888,
-0xFF264989,
-0xFF264989,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF254B8A,
-0xFF254B8A,
-0xFF254B8C,
-0xFF254B8C,
-0xFF254B8C,
-0xFF264C8D,
-0xFF264C8D,
-0xFF254C8D,
-0xFF264D90,
-0xFF254E90,
-0xFF254E90,
-0xFF264F91,
-0xFF264F91,
-0xFF264F91,
-0xFF264E93,
-0xFF274F94,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF295196,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2B5198,
-0xFF2A5298,
-0xFF2A5298,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2B559D,
-0xFF2B559D,
-0xFF28549B,
-0xFF29559C,
-0xFF2A569F,
-0xFF2A569F,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2959A3,
-0xFF2959A3,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2C62AC,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2E64AE,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2D61AD,
-0xFF2C60AC,
-0xFF2C60AC,
-0xFF2C60AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2858A4,
-0xFF2858A4,
-0xFF2957A4,
-0xFF2957A2,
-0xFF2957A2,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF29559E,
-0xFF29559E,
-0xFF28549D,
-0xFF28549D,
-0xFF27539C,
-0xFF27539C,
-0xFF27539C,
-0xFF27539C,
-0xFF2A529A,
-0xFF295199,
-0xFF295199,
-0xFF295199,
-0xFF295199,
-0xFF285098,
-0xFF285098,
-0xFF285098,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF274F95,
-0xFF274F95,
-0xFF274F95,
-0xFF274F95,
-0xFF254888,
-0xFF264989,
-0xFF264989,
-0xFF264989,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF284B8B,
-0xFF264C8B,
-0xFF264C8B,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264C8D,
-0xFF274D8E,
-0xFF264D8E,
-0xFF264D90,
-0xFF254E90,
-0xFF264F91,
-0xFF264F91,
-0xFF264F91,
-0xFF275092,
-0xFF274F94,
-0xFF274F94,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF295196,
-0xFF295196,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5399,
-0xFF2B5399,
-0xFF2B539B,
-0xFF2B539B,
-0xFF29539B,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF28549B,
-0xFF29559C,
-0xFF2A569F,
-0xFF2A569F,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2959A3,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2C5CA6,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2D63AD,
-0xFF2E64AE,
-0xFF2E64AE,
-0xFF2E64AE,
-0xFF2E64AE,
-0xFF2F65AF,
-0xFF2F65AF,
-0xFF2E64AE,
-0xFF2E64AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2D61AD,
-0xFF2C60AC,
-0xFF2C60AC,
-0xFF2C60AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2A58A5,
-0xFF2A58A5,
-0xFF2957A2,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF29559E,
-0xFF29559E,
-0xFF28549D,
-0xFF28549D,
-0xFF28549D,
-0xFF28549D,
-0xFF2B539B,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF295199,
-0xFF295199,
-0xFF295199,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF274F95,
-0xFF274F95,
-0xFF274F95,
-0xFF264989,
-0xFF264989,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF284B8B,
-0xFF284B8B,
-0xFF284B8B,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264C8D,
-0xFF274D8E,
-0xFF274D8E,
-0xFF264D8E,
-0xFF274E8F,
-0xFF264D90,
-0xFF274E91,
-0xFF274E91,
-0xFF274E91,
-0xFF284F92,
-0xFF284F92,
-0xFF295095,
-0xFF295095,
-0xFF295095,
-0xFF295095,
-0xFF295095,
-0xFF295095,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5097,
-0xFF2A5097,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5399,
-0xFF2B5399,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF29559E,
-0xFF28579F,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2D62AE,
-0xFF2D62AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF3061AE,
-0xFF3061AE,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2F60AD,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2C60AC,
-0xFF2C60AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2957A2,
-0xFF2957A2,
-0xFF2957A2,
-0xFF2856A1,
-0xFF28579F,
-0xFF28579F,
-0xFF2B57A0,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF285098,
-0xFF285098,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF274F95,
-0xFF274F95,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF284B8B,
-0xFF284B8B,
-0xFF284B8B,
-0xFF284B8B,
-0xFF264C8D,
-0xFF264C8D,
-0xFF274D8E,
-0xFF274D8E,
-0xFF274D8E,
-0xFF284E8F,
-0xFF274E8F,
-0xFF274E8F,
-0xFF274E91,
-0xFF274E91,
-0xFF284F92,
-0xFF284F92,
-0xFF295093,
-0xFF295093,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2B5399,
-0xFF2C549A,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2A569D,
-0xFF28579F,
-0xFF2958A0,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF3061AE,
-0xFF3061AE,
-0xFF3061AE,
-0xFF3061AE,
-0xFF3061AE,
-0xFF3061AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2959A5,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2957A2,
-0xFF2957A2,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF29539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF295199,
-0xFF295199,
-0xFF295197,
-0xFF295197,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF285096,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF284B8B,
-0xFF284B8B,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264C8D,
-0xFF264D90,
-0xFF264D90,
-0xFF264D90,
-0xFF274E91,
-0xFF274E91,
-0xFF284F92,
-0xFF284F92,
-0xFF284F92,
-0xFF284F94,
-0xFF295095,
-0xFF295095,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5AA5,
-0xFF2C5AA5,
-0xFF2C5AA5,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA9,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2D61AD,
-0xFF2D61AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2A5EA9,
-0xFF2A5EA9,
-0xFF2A5EA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2A5BA7,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2B59A4,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2957A2,
-0xFF2957A2,
-0xFF2958A0,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF29559E,
-0xFF29539D,
-0xFF29539D,
-0xFF29539B,
-0xFF29539B,
-0xFF28529A,
-0xFF28529A,
-0xFF28529A,
-0xFF28529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF295197,
-0xFF295197,
-0xFF295197,
-0xFF295197,
-0xFF294F96,
-0xFF294F96,
-0xFF274A8A,
-0xFF274A8A,
-0xFF274A8A,
-0xFF284B8B,
-0xFF284B8B,
-0xFF284B8B,
-0xFF264C8D,
-0xFF274D8E,
-0xFF274D8E,
-0xFF274D8E,
-0xFF264D90,
-0xFF264D90,
-0xFF274E91,
-0xFF274E91,
-0xFF284F92,
-0xFF284F92,
-0xFF295093,
-0xFF295093,
-0xFF295095,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2D539A,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2C549C,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2E5CA7,
-0xFF2E5CA7,
-0xFF2E5CA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EAA,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF3064B0,
-0xFF3064B0,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2B59A4,
-0xFF2B59A4,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A549E,
-0xFF2A549E,
-0xFF2A549C,
-0xFF2A549C,
-0xFF29539B,
-0xFF29539B,
-0xFF29539B,
-0xFF29539B,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A5298,
-0xFF2A5298,
-0xFF2A5298,
-0xFF295197,
-0xFF2A5097,
-0xFF2A5097,
-0xFF284B8B,
-0xFF284B8B,
-0xFF284B8B,
-0xFF284B8B,
-0xFF294C8C,
-0xFF294C8C,
-0xFF274D8E,
-0xFF274D8E,
-0xFF264D90,
-0xFF264D90,
-0xFF274E91,
-0xFF274E91,
-0xFF274F94,
-0xFF274F94,
-0xFF285095,
-0xFF285095,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2B5399,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5CA7,
-0xFF2E5CA7,
-0xFF2E5CA7,
-0xFF2F5DA8,
-0xFF2F5DA8,
-0xFF2F5DA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2E62AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2A5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2959A5,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A59A1,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF29589E,
-0xFF29589E,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF29559E,
-0xFF29559C,
-0xFF29559C,
-0xFF2A549C,
-0xFF29539B,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2B519A,
-0xFF2B519A,
-0xFF2A5097,
-0xFF2A5097,
-0xFF284B8B,
-0xFF284B8B,
-0xFF294C8C,
-0xFF294C8C,
-0xFF294C8C,
-0xFF294C8C,
-0xFF284E8F,
-0xFF284E8F,
-0xFF274E91,
-0xFF274E91,
-0xFF274E91,
-0xFF284F92,
-0xFF274F94,
-0xFF285095,
-0xFF285095,
-0xFF295196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2B579E,
-0xFF2B579E,
-0xFF2C589F,
-0xFF2C589F,
-0xFF2C58A1,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5CA7,
-0xFF2F5DA8,
-0xFF2F5DA8,
-0xFF2F5DA8,
-0xFF305EA9,
-0xFF305EA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FAB,
-0xFF2F5FAB,
-0xFF3060AC,
-0xFF3060AC,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A5AA6,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A58A3,
-0xFF2A59A1,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF29589E,
-0xFF29589E,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF29559C,
-0xFF29559C,
-0xFF2A549C,
-0xFF29539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2A529A,
-0xFF2B519A,
-0xFF2B519A,
-0xFF2A5097,
-0xFF2A5097,
-0xFF294C8C,
-0xFF294C8C,
-0xFF274D8E,
-0xFF274D8E,
-0xFF284E8F,
-0xFF284E8F,
-0xFF284D91,
-0xFF284D91,
-0xFF284F92,
-0xFF284F92,
-0xFF284F94,
-0xFF295095,
-0xFF285095,
-0xFF295196,
-0xFF295197,
-0xFF295197,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5399,
-0xFF2B5399,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AC,
-0xFF3060AC,
-0xFF3060AC,
-0xFF3161AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2D65B0,
-0xFF2D65B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2E63AF,
-0xFF2E63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5BA9,
-0xFF2C5BA9,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5AA2,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF28579F,
-0xFF28579F,
-0xFF28579F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF29559E,
-0xFF29559E,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2A529A,
-0xFF2A529A,
-0xFF2B519A,
-0xFF2B519A,
-0xFF294C8C,
-0xFF274D8C,
-0xFF274D8E,
-0xFF284E8F,
-0xFF284E8F,
-0xFF284E8F,
-0xFF294E92,
-0xFF294E92,
-0xFF284F92,
-0xFF284F92,
-0xFF295095,
-0xFF295095,
-0xFF285095,
-0xFF295196,
-0xFF295197,
-0xFF295197,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2B5399,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2E569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AC,
-0xFF3060AC,
-0xFF3060AC,
-0xFF3060AC,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3162AE,
-0xFF3162AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2B5FAA,
-0xFF2B5FAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5BA9,
-0xFF2C5BA9,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2958A0,
-0xFF2958A0,
-0xFF28579F,
-0xFF28579F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A569F,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2C549C,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2A529A,
-0xFF2B519A,
-0xFF2B519A,
-0xFF284E8F,
-0xFF274E8F,
-0xFF274E8F,
-0xFF274E8F,
-0xFF274E91,
-0xFF284F92,
-0xFF284F92,
-0xFF284F92,
-0xFF295095,
-0xFF295095,
-0xFF295095,
-0xFF295095,
-0xFF295197,
-0xFF295197,
-0xFF295197,
-0xFF2A5298,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2B5399,
-0xFF2B5399,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2D57A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5BA3,
-0xFF2B5BA3,
-0xFF2B5BA3,
-0xFF2C5CA4,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF3062AB,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F60AC,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3162AE,
-0xFF3162AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3267B3,
-0xFF3267B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F67B2,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF2F64B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2C60AB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2B57A0,
-0xFF2A569F,
-0xFF2B559F,
-0xFF2B559F,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF274E8F,
-0xFF274E8F,
-0xFF274E8F,
-0xFF284F90,
-0xFF284F92,
-0xFF284F92,
-0xFF295093,
-0xFF295093,
-0xFF295095,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF295197,
-0xFF2A5298,
-0xFF2A5298,
-0xFF2A5298,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2B5BA3,
-0xFF2C5CA4,
-0xFF2C5CA4,
-0xFF2C5CA4,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2E66B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF2E66B1,
-0xFF3065B1,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2D61AC,
-0xFF2C60AB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2A5AA4,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2958A0,
-0xFF2B57A0,
-0xFF2B57A0,
-0xFF2B559F,
-0xFF2B559F,
-0xFF2B559D,
-0xFF2A549C,
-0xFF2C549C,
-0xFF2B539B,
-0xFF2B539B,
-0xFF2B539B,
-0xFF275092,
-0xFF275092,
-0xFF275092,
-0xFF275092,
-0xFF295093,
-0xFF295093,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559D,
-0xFF2D559D,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2C589F,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2B5AA2,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3263AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF2F69B3,
-0xFF2F69B3,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2E66B1,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3066B0,
-0xFF3066B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2E62AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2D61AC,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2B5CA8,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2B59A4,
-0xFF2A58A3,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2B57A0,
-0xFF2B57A0,
-0xFF2B57A0,
-0xFF2B57A0,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF2A549C,
-0xFF275092,
-0xFF275092,
-0xFF275092,
-0xFF285193,
-0xFF295093,
-0xFF2A5194,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5198,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2C5299,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2E549B,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2E569E,
-0xFF2E569E,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2E5AA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3364B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3068B2,
-0xFF3068B2,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF326AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF316BB5,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF2F67B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3167B1,
-0xFF3066B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF2F63AF,
-0xFF2F63AF,
-0xFF2F63AE,
-0xFF2F63AE,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2E62AD,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2C5DA9,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2B5BA5,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2A5AA4,
-0xFF2C5AA5,
-0xFF2B59A4,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2A59A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C58A1,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2A549C,
-0xFF2A549C,
-0xFF274F94,
-0xFF274F94,
-0xFF285095,
-0xFF285095,
-0xFF295196,
-0xFF295196,
-0xFF2A5297,
-0xFF2A5297,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2C589F,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A2,
-0xFF2E5AA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3064AD,
-0xFF3064AD,
-0xFF3064AD,
-0xFF3064AD,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3263AF,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3465B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3465B1,
-0xFF3465B1,
-0xFF3465B1,
-0xFF3566B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF306AB4,
-0xFF306AB4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3266B2,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF2F63AF,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5EAA,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2B5BA7,
-0xFF2C5AA5,
-0xFF2C5AA5,
-0xFF2B59A4,
-0xFF2B59A4,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2D59A2,
-0xFF2C58A1,
-0xFF2D59A2,
-0xFF2C58A1,
-0xFF2D57A1,
-0xFF2C56A0,
-0xFF2C569E,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF274F94,
-0xFF285095,
-0xFF285095,
-0xFF285095,
-0xFF295196,
-0xFF2A5297,
-0xFF2A5297,
-0xFF2B5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2D559B,
-0xFF2B569B,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2C589F,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2E5AA3,
-0xFF2E5AA3,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3165AE,
-0xFF3165AE,
-0xFF3165AE,
-0xFF3165AE,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3465B1,
-0xFF3465B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3566B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B4,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3367B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF326AB4,
-0xFF346AB4,
-0xFF326AB4,
-0xFF356BB5,
-0xFF336BB5,
-0xFF346AB4,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF3169B3,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF306AB4,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF316BB5,
-0xFF306AB4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3169B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B2,
-0xFF3166B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF2F63AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2E5FAB,
-0xFF2D5EAA,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2D5DA9,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2D5BA6,
-0xFF2C5AA5,
-0xFF2C5AA5,
-0xFF2C5AA5,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D57A1,
-0xFF2C56A0,
-0xFF2C569E,
-0xFF2B559D,
-0xFF2B559D,
-0xFF2B559D,
-0xFF284F94,
-0xFF295095,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2B5297,
-0xFF2C5398,
-0xFF2C5299,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2E549B,
-0xFF2D559B,
-0xFF2B569B,
-0xFF2B589C,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2E58A2,
-0xFF2E58A2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2E5AA3,
-0xFF2E5AA3,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF3169B3,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF316BB4,
-0xFF326AB4,
-0xFF316BB4,
-0xFF326AB4,
-0xFF316BB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF316BB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF316BB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF306AB4,
-0xFF306AB4,
-0xFF306AB4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3068B3,
-0xFF3267B3,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF2F64B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064AF,
-0xFF2F63AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3061AD,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF2F60AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2C5CA8,
-0xFF2B5BA7,
-0xFF2B5BA5,
-0xFF2B5BA5,
-0xFF2B59A4,
-0xFF2B59A4,
-0xFF2B5AA2,
-0xFF2B5AA2,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A0,
-0xFF2C589F,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2C569E,
-0xFF2A5196,
-0xFF2A5196,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2B5297,
-0xFF2B5297,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2D539A,
-0xFF2E549B,
-0xFF2D559B,
-0xFF2C579C,
-0xFF2B589C,
-0xFF2C589F,
-0xFF2C589F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2E58A0,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A3,
-0xFF2F59A3,
-0xFF2E5AA3,
-0xFF2E5AA3,
-0xFF2E5AA3,
-0xFF2E5AA3,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2E5CA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF326CB5,
-0xFF326CB5,
-0xFF316BB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF316BB4,
-0xFF316BB4,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF316BB5,
-0xFF326CB6,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF316BB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3061AD,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA9,
-0xFF2C5CA8,
-0xFF2D5DA9,
-0xFF2C5CA8,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2C5AA5,
-0xFF2C5AA5,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2D59A2,
-0xFF2D59A2,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D579F,
-0xFF2C569E,
-0xFF2D579F,
-0xFF2D579F,
-0xFF2B5297,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2B5398,
-0xFF2A5297,
-0xFF2B5399,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2C569E,
-0xFF2C589F,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2E5AA3,
-0xFF2E5AA3,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2F5DA8,
-0xFF2F5DA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF3169B3,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF336BB6,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3368B4,
-0xFF3469B5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3065B1,
-0xFF3065B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2D5DA7,
-0xFF2E5EAA,
-0xFF2D5DA9,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF2D59A0,
-0xFF2C589F,
-0xFF2C589F,
-0xFF2C589F,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2B5398,
-0xFF2B5398,
-0xFF2C549A,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2D589D,
-0xFF2D579F,
-0xFF2C589F,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF305AA2,
-0xFF305AA2,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2F5EA6,
-0xFF2F5DA8,
-0xFF305EA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3363AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3263AF,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3469B5,
-0xFF356AB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3266B2,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3161AB,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EAA,
-0xFF2D5DA9,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2C5CA6,
-0xFF2C5CA6,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2D5499,
-0xFF2C5499,
-0xFF2C5499,
-0xFF2C549A,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2C579C,
-0xFF2D589D,
-0xFF2D589D,
-0xFF2E599E,
-0xFF2D579F,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF305AA2,
-0xFF305AA2,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF305CA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2F5EA6,
-0xFF2F5EA6,
-0xFF2F5EA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3165AE,
-0xFF3165AE,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF316BB4,
-0xFF316BB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3169B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3166B2,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2D5DA7,
-0xFF2C5CA6,
-0xFF2D5BA6,
-0xFF2D5BA6,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2E5AA1,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2C5398,
-0xFF2D5499,
-0xFF2D5499,
-0xFF2D559A,
-0xFF2D559A,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2F579D,
-0xFF2D589D,
-0xFF2D589D,
-0xFF2E599E,
-0xFF2F5A9F,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF305AA2,
-0xFF305AA2,
-0xFF305AA2,
-0xFF2F5BA4,
-0xFF2F5BA4,
-0xFF305CA5,
-0xFF305CA5,
-0xFF2F5EA6,
-0xFF2F5EA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3161AB,
-0xFF3262AC,
-0xFF3262AC,
-0xFF3363AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3165AE,
-0xFF3266AF,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF316DB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF346EB8,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF346CB7,
-0xFF346CB7,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3166B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3364B0,
-0xFF3364B0,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3161AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2D5DA7,
-0xFF2E5CA7,
-0xFF2E5CA7,
-0xFF2E5DA5,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5BA3,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF2D59A0,
-0xFF2D59A0,
-0xFF2D5499,
-0xFF2D5499,
-0xFF2D5499,
-0xFF2D5499,
-0xFF2C5499,
-0xFF2D559A,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2C579C,
-0xFF2C579C,
-0xFF2D589D,
-0xFF2D589D,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2E5AA1,
-0xFF2F59A1,
-0xFF2E58A0,
-0xFF3159A1,
-0xFF325AA2,
-0xFF325AA2,
-0xFF305AA2,
-0xFF305AA2,
-0xFF305AA2,
-0xFF315BA3,
-0xFF305CA5,
-0xFF305CA5,
-0xFF305CA5,
-0xFF305CA5,
-0xFF2F5EA6,
-0xFF2F5EA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3165AE,
-0xFF3165AE,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF316DB5,
-0xFF316DB5,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF306FB6,
-0xFF3170B7,
-0xFF3170B7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB7,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF316DB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF316BB5,
-0xFF316BB5,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3267B3,
-0xFF3267B3,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3167B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3364B0,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61A8,
-0xFF2E60A7,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5BA3,
-0xFF2C5BA3,
-0xFF2E559A,
-0xFF2E559A,
-0xFF2D5499,
-0xFF2E559A,
-0xFF2D559A,
-0xFF2D559A,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2C579C,
-0xFF2D589D,
-0xFF2D589D,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2E5AA1,
-0xFF2F5BA2,
-0xFF3159A1,
-0xFF325AA2,
-0xFF325AA2,
-0xFF325AA2,
-0xFF305AA2,
-0xFF305AA2,
-0xFF315BA3,
-0xFF315BA3,
-0xFF305CA5,
-0xFF305CA5,
-0xFF305CA5,
-0xFF315DA6,
-0xFF2F5EA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3165AE,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3367B0,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB8,
-0xFF336FB8,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3368B4,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3167B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3364B0,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3263AF,
-0xFF3162AE,
-0xFF3162AE,
-0xFF3061AD,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61A8,
-0xFF2E60A7,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2E5EA8,
-0xFF2F5EA6,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2D5CA4,
-0xFF2D5CA4,
-0xFF2C5BA3,
-0xFF2E559A,
-0xFF2E559A,
-0xFF2D559B,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2F579D,
-0xFF2F579D,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2E58A0,
-0xFF2E58A0,
-0xFF2D59A0,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF3159A1,
-0xFF3159A1,
-0xFF305AA2,
-0xFF305AA2,
-0xFF305AA2,
-0xFF315BA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA5,
-0xFF305CA5,
-0xFF2F5EA6,
-0xFF2F5EA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3362AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF326CB5,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF3470B8,
-0xFF336FB7,
-0xFF326EB6,
-0xFF326EB6,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3271B8,
-0xFF3170B7,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3271B8,
-0xFF336FB7,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3170B7,
-0xFF3271B8,
-0xFF3372B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF326EB7,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3068B3,
-0xFF3068B3,
-0xFF3268B2,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B1,
-0xFF3165B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3264AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2D5DA5,
-0xFF2D5DA5,
-0xFF2E5DA5,
-0xFF2D5CA4,
-0xFF2E559A,
-0xFF2E559A,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2F579D,
-0xFF2F579D,
-0xFF30589E,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF2F59A1,
-0xFF305AA2,
-0xFF305AA2,
-0xFF305AA2,
-0xFF315BA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA6,
-0xFF315DA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3363AB,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3367B0,
-0xFF3367B0,
-0xFF3367B2,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF326CB5,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF326EB6,
-0xFF336FB7,
-0xFF336FB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3170B7,
-0xFF3271B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3372B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF326EB7,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF336DB7,
-0xFF326CB6,
-0xFF326CB6,
-0xFF346CB7,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF326AB5,
-0xFF326AB5,
-0xFF326AB5,
-0xFF3169B4,
-0xFF3169B4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B2,
-0xFF3165B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3264AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2D5DA5,
-0xFF2E5DA5,
-0xFF2E5DA5,
-0xFF2D559B,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2F579D,
-0xFF2D589D,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2F5A9F,
-0xFF2F59A1,
-0xFF2F59A1,
-0xFF2E5AA1,
-0xFF2E5AA1,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305AA2,
-0xFF305AA2,
-0xFF315BA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA6,
-0xFF2F5EA6,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3464AC,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3464AE,
-0xFF3464AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3266AF,
-0xFF3266AF,
-0xFF3367B0,
-0xFF3367B0,
-0xFF3367B0,
-0xFF3367B0,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF346AB4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF356FB8,
-0xFF356FB8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF336FB8,
-0xFF336FB8,
-0xFF326EB7,
-0xFF336DB7,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3268B2,
-0xFF3268B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AD,
-0xFF2F63AC,
-0xFF2F63AC,
-0xFF2F63AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2E5EA8,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2D5DA5,
-0xFF2D5DA5,
-0xFF2E569C,
-0xFF2E569C,
-0xFF2F579D,
-0xFF30589E,
-0xFF2E599E,
-0xFF2F5A9F,
-0xFF2F5A9F,
-0xFF305BA0,
-0xFF305AA2,
-0xFF305AA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315BA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF305FA5,
-0xFF305FA7,
-0xFF305FA7,
-0xFF3160A8,
-0xFF3160A8,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3261A9,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AE,
-0xFF3565AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3367B0,
-0xFF3367B0,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3569B4,
-0xFF3569B4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346EB7,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3271B8,
-0xFF3271B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3372B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336FB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336BB6,
-0xFF336BB6,
-0xFF346CB7,
-0xFF346CB7,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AD,
-0xFF3064AD,
-0xFF3064AD,
-0xFF3064AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3060AA,
-0xFF3060AA,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA9,
-0xFF2F5FA7,
-0xFF2E5EA6,
-0xFF2E5EA6,
-0xFF2D5DA5,
-0xFF2D589D,
-0xFF2D589D,
-0xFF2E599E,
-0xFF2F5A9F,
-0xFF2F5A9F,
-0xFF305BA0,
-0xFF305BA0,
-0xFF305BA0,
-0xFF305AA2,
-0xFF305AA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF305FA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3160A8,
-0xFF3060A8,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3367B0,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336EB4,
-0xFF336EB4,
-0xFF336EB4,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF336FB5,
-0xFF336FB5,
-0xFF336FB5,
-0xFF336FB5,
-0xFF336FB5,
-0xFF336FB5,
-0xFF3470B6,
-0xFF3571B7,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF3470B9,
-0xFF336FB8,
-0xFF336FB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF326CB6,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF326AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2D5FA8,
-0xFF2D5FA8,
-0xFF2E599E,
-0xFF2E599E,
-0xFF2F5A9F,
-0xFF305BA0,
-0xFF305BA0,
-0xFF305BA0,
-0xFF305BA0,
-0xFF305BA0,
-0xFF305AA2,
-0xFF305AA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF325EA5,
-0xFF325EA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3362AA,
-0xFF3362AA,
-0xFF3463AB,
-0xFF3463AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3668B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3468B1,
-0xFF346AB4,
-0xFF346AB4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF336FB5,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3470B6,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3672B8,
-0xFF3470B6,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF3571B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3571BA,
-0xFF3470B9,
-0xFF336FB8,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF336DB7,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3569B4,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3064AF,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2D5A9E,
-0xFF2E5B9F,
-0xFF2F5CA0,
-0xFF2F5CA0,
-0xFF2F5CA0,
-0xFF2F5CA0,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF305FA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3162A7,
-0xFF3162A7,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3462AD,
-0xFF3462AD,
-0xFF3464AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3468B1,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B4,
-0xFF3569B4,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346FB5,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3671B7,
-0xFF3570B6,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3470B6,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3672B8,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3574BB,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3473BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3771BA,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3872BC,
-0xFF3872BC,
-0xFF3872BC,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3872BC,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3472BB,
-0xFF3371BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF3470B9,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3470B9,
-0xFF356FB9,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF336DB7,
-0xFF336DB6,
-0xFF326CB5,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3468B3,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2E60A9,
-0xFF2E5B9F,
-0xFF2E5B9F,
-0xFF2F5CA0,
-0xFF2F5CA0,
-0xFF2F5CA0,
-0xFF2F5CA0,
-0xFF2F5BA2,
-0xFF2E5AA1,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF325EA5,
-0xFF325EA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3162A7,
-0xFF3263A8,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3563AE,
-0xFF3464AE,
-0xFF3464AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3668B1,
-0xFF3468B1,
-0xFF3569B2,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB5,
-0xFF356BB5,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3571B7,
-0xFF3571B7,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3773BB,
-0xFF3773BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773B9,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3872BC,
-0xFF3771BA,
-0xFF3773BB,
-0xFF3773B9,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3574BB,
-0xFF3574BB,
-0xFF3574BB,
-0xFF3874BC,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3574BB,
-0xFF3675BA,
-0xFF3574B9,
-0xFF3872BB,
-0xFF3973BC,
-0xFF3C72BC,
-0xFF3B73BD,
-0xFF3974BA,
-0xFF3874BA,
-0xFF3A75BB,
-0xFF3973BC,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3A72BC,
-0xFF3973BC,
-0xFF3874BA,
-0xFF3874BA,
-0xFF3773BB,
-0xFF3872BB,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3973BD,
-0xFF3A74BE,
-0xFF3A74BE,
-0xFF3A74BE,
-0xFF3A74BE,
-0xFF3A74BE,
-0xFF3874BD,
-0xFF3975BE,
-0xFF3975BE,
-0xFF3975BE,
-0xFF3975BE,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3874BD,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3773BC,
-0xFF3672BB,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3672BB,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3571BA,
-0xFF3672BB,
-0xFF3571BA,
-0xFF356FB9,
-0xFF356FB9,
-0xFF346EB8,
-0xFF336FB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB8,
-0xFF346EB7,
-0xFF346EB8,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF356BB5,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3369B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3367B2,
-0xFF3266B1,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3165B0,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3163AC,
-0xFF3062AB,
-0xFF3062AB,
-0xFF2F61AA,
-0xFF2F61AA,
-0xFF2E60A9,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF305FA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362AA,
-0xFF3463AB,
-0xFF3463AB,
-0xFF3463AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3464AC,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AF,
-0xFF3565AF,
-0xFF3565AF,
-0xFF3666B0,
-0xFF3666B0,
-0xFF3666B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3569B2,
-0xFF366AB3,
-0xFF3569B2,
-0xFF3569B2,
-0xFF356BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF376DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF356EB5,
-0xFF346FB5,
-0xFF346FB5,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3874BA,
-0xFF3874BA,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BD,
-0xFF3674BF,
-0xFF3674BD,
-0xFF3675BA,
-0xFF3875B8,
-0xFF3A72BC,
-0xFF3A72BD,
-0xFF3C71BF,
-0xFF3A72BD,
-0xFF3672B8,
-0xFF3976B9,
-0xFF3975BB,
-0xFF3772B8,
-0xFF3D73BD,
-0xFF3E73BF,
-0xFF3470B9,
-0xFF3A76BF,
-0xFF3873B9,
-0xFF3571B7,
-0xFF3776BD,
-0xFF3574BB,
-0xFF3871B8,
-0xFF3B74BB,
-0xFF3573BC,
-0xFF3676BD,
-0xFF3478B9,
-0xFF3576B8,
-0xFF3871B8,
-0xFF3E72BD,
-0xFF3F6FBB,
-0xFF3D6FB8,
-0xFF3A75B9,
-0xFF3574B7,
-0xFF3B76B8,
-0xFF3770B7,
-0xFF3871C0,
-0xFF3A71C1,
-0xFF3E73BF,
-0xFF3B74BB,
-0xFF3271B4,
-0xFF3778BA,
-0xFF3574BB,
-0xFF3874BD,
-0xFF3A72BC,
-0xFF3A73BA,
-0xFF3873B5,
-0xFF3774B5,
-0xFF3874BA,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3271B8,
-0xFF3470B8,
-0xFF3470B8,
-0xFF356FB8,
-0xFF346FB5,
-0xFF346EB7,
-0xFF346EB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF336FB7,
-0xFF346EB7,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF336DB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF326AB4,
-0xFF326AB4,
-0xFF3369B3,
-0xFF3369B3,
-0xFF3369B3,
-0xFF346AB4,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3566B2,
-0xFF3566B2,
-0xFF3567B0,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3264AD,
-0xFF3264AD,
-0xFF3363AD,
-0xFF3363AD,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3161A9,
-0xFF3060A8,
-0xFF2F5BA2,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF325EA5,
-0xFF325EA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463AB,
-0xFF3463AB,
-0xFF3564AC,
-0xFF3564AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3666AE,
-0xFF3565AF,
-0xFF3666B0,
-0xFF3666B0,
-0xFF3666B0,
-0xFF3767B1,
-0xFF3767B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3769B2,
-0xFF3769B2,
-0xFF386AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF356BB5,
-0xFF356BB5,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF356DB7,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF356DB7,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3874BA,
-0xFF3874BA,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BD,
-0xFF3873BF,
-0xFF3674BD,
-0xFF3675B8,
-0xFF3875B8,
-0xFF3974BA,
-0xFF3A72BD,
-0xFF3C71BF,
-0xFF3A72BD,
-0xFF3874BC,
-0xFF3A79C0,
-0xFF3473B8,
-0xFF3B76BC,
-0xFF3F70BC,
-0xFF3E6FBB,
-0xFF3F75BF,
-0xFF3D73BB,
-0xFF4173B8,
-0xFF4475B8,
-0xFF3A6BAE,
-0xFF4873B7,
-0xFF5270B0,
-0xFF4C68A7,
-0xFF4B6EAE,
-0xFF466FAD,
-0xFF4974AB,
-0xFF5378AD,
-0xFF5C75AB,
-0xFF5A6FA6,
-0xFF566EAA,
-0xFF4F72B2,
-0xFF4077B8,
-0xFF3576B8,
-0xFF3572B5,
-0xFF3E79BF,
-0xFF3B74C3,
-0xFF3A73C4,
-0xFF366EB9,
-0xFF3772B8,
-0xFF3E7DC0,
-0xFF3475B7,
-0xFF3776BD,
-0xFF3775BE,
-0xFF3A74BD,
-0xFF3A75BB,
-0xFF3A75B7,
-0xFF3976B9,
-0xFF3975BD,
-0xFF3975BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3571B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3372B9,
-0xFF3571B9,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF336FB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF326AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF346AB4,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3667B3,
-0xFF3566B2,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3464AE,
-0xFF3464AE,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3261A9,
-0xFF3261A9,
-0xFF2F5BA2,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF325EA5,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463AB,
-0xFF3564AC,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3666B0,
-0xFF3767B1,
-0xFF3767B1,
-0xFF3767B1,
-0xFF3668B1,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3569B2,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF376DB7,
-0xFF376DB7,
-0xFF376DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF366EB8,
-0xFF376FB9,
-0xFF376FB9,
-0xFF366EB8,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3874BA,
-0xFF3874BA,
-0xFF3874BA,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A74BD,
-0xFF3B73BD,
-0xFF3B74BB,
-0xFF3975BB,
-0xFF3976B9,
-0xFF3776BB,
-0xFF3975BB,
-0xFF3B73BD,
-0xFF3B73BE,
-0xFF3876C1,
-0xFF3274C0,
-0xFF3274BE,
-0xFF3A76BF,
-0xFF3F6FB7,
-0xFF3F69B1,
-0xFF4670B8,
-0xFF426AB0,
-0xFF476DAE,
-0xFF4D6CAC,
-0xFF566BAC,
-0xFF6165A2,
-0xFF7A6397,
-0xFF866B98,
-0xFF8474A3,
-0xFF6E6592,
-0xFF50456D,
-0xFF3E2948,
-0xFF4C2538,
-0xFF472233,
-0xFF1F0F2A,
-0xFF55628C,
-0xFF4072AD,
-0xFF3477BD,
-0xFF3B7BC3,
-0xFF3270B9,
-0xFF3B74C1,
-0xFF3B74C1,
-0xFF3A76BF,
-0xFF3E7AC2,
-0xFF3874BC,
-0xFF3975BD,
-0xFF3B77C0,
-0xFF3A76BF,
-0xFF3877BE,
-0xFF3877BE,
-0xFF3A76BE,
-0xFF3B75BE,
-0xFF3C74C1,
-0xFF3C74C1,
-0xFF3A74BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3873B9,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3671B7,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF336FB7,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF3569B4,
-0xFF3569B4,
-0xFF3468B3,
-0xFF3468B3,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3365AE,
-0xFF3365AE,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3262AA,
-0xFF3262AA,
-0xFF3262AA,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF325EA5,
-0xFF325EA5,
-0xFF325EA5,
-0xFF335FA6,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AC,
-0xFF3564AC,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3767AF,
-0xFF3767AF,
-0xFF3767B1,
-0xFF3767B1,
-0xFF3767B1,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF376DB7,
-0xFF376DB7,
-0xFF376DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF366EB8,
-0xFF366EB8,
-0xFF376FB9,
-0xFF376FB9,
-0xFF376FB9,
-0xFF376FB9,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3975BB,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3A75BB,
-0xFF3E74BA,
-0xFF3E74BA,
-0xFF3B76BC,
-0xFF3A76BC,
-0xFF3A76BC,
-0xFF3A76BC,
-0xFF3B75BE,
-0xFF3C74BE,
-0xFF3E74BC,
-0xFF4675B9,
-0xFF5276B4,
-0xFF5871A9,
-0xFF636EA4,
-0xFF7172A8,
-0xFF6F6AA0,
-0xFF7E74A8,
-0xFF8672A3,
-0xFF886C9C,
-0xFF8C6695,
-0xFF90608A,
-0xFF905778,
-0xFF8D5270,
-0xFF582242,
-0xFF2F0016,
-0xFF460C22,
-0xFF64202B,
-0xFF6C1B18,
-0xFF540D07,
-0xFF300C0E,
-0xFF110E23,
-0xFF5C78AA,
-0xFF4576B9,
-0xFF3771BA,
-0xFF3B79C2,
-0xFF3C76BF,
-0xFF3D77C0,
-0xFF3878C0,
-0xFF3575BD,
-0xFF3C78C0,
-0xFF3A74BD,
-0xFF3C76C0,
-0xFF3A76BF,
-0xFF3876BF,
-0xFF3777BF,
-0xFF3B77C0,
-0xFF3C75C2,
-0xFF3D75C2,
-0xFF3C74C1,
-0xFF3B75BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3672BA,
-0xFF3571B9,
-0xFF3470B8,
-0xFF3470B8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF356BB5,
-0xFF356BB5,
-0xFF3569B4,
-0xFF3569B4,
-0xFF3569B4,
-0xFF3569B4,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF305CA3,
-0xFF305CA3,
-0xFF305CA3,
-0xFF315DA4,
-0xFF315DA4,
-0xFF325EA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3465AA,
-0xFF3465AA,
-0xFF3464AC,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3767AF,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF386AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF356EB5,
-0xFF356EB5,
-0xFF356EB5,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3975BD,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3B76BC,
-0xFF3C75BA,
-0xFF3E74BA,
-0xFF3B75BE,
-0xFF3C74BE,
-0xFF3F73BC,
-0xFF3E74BE,
-0xFF3876C1,
-0xFF3C75BA,
-0xFF476BA7,
-0xFF3E4474,
-0xFF644766,
-0xFF875169,
-0xFF9A5B70,
-0xFFAC6376,
-0xFFB56372,
-0xFFBD5B6A,
-0xFFBC4656,
-0xFFB53544,
-0xFFAC2939,
-0xFFAC3C4A,
-0xFF954955,
-0xFF470715,
-0xFF440007,
-0xFF640C18,
-0xFF6D0A0D,
-0xFF760F0A,
-0xFF8B2018,
-0xFF7C281D,
-0xFF3F1B0D,
-0xFF0F0506,
-0xFF383153,
-0xFF6B78AF,
-0xFF4575B7,
-0xFF3F7EC3,
-0xFF3972B7,
-0xFF3A75BB,
-0xFF3A7AC4,
-0xFF3375BF,
-0xFF3B76BC,
-0xFF3E77BC,
-0xFF3D75BF,
-0xFF3B75BF,
-0xFF3A76BF,
-0xFF3876C1,
-0xFF3977C2,
-0xFF3B76C2,
-0xFF3D75C2,
-0xFF3D75C2,
-0xFF3C76C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3872BB,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF336BB5,
-0xFF336BB5,
-0xFF356BB5,
-0xFF356BB5,
-0xFF366AB5,
-0xFF366AB5,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AF,
-0xFF3466AD,
-0xFF3466AD,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3363AB,
-0xFF3363AB,
-0xFF3363AB,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF315DA4,
-0xFF325EA5,
-0xFF335FA6,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3566AB,
-0xFF3566AB,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3767AF,
-0xFF3767AF,
-0xFF3767AF,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3769B2,
-0xFF3769B2,
-0xFF386AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF376BB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF356EB5,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3A73BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BD,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3C76BF,
-0xFF3C76C0,
-0xFF3F75BF,
-0xFF3D75C0,
-0xFF3878C2,
-0xFF3C77BD,
-0xFF5579B5,
-0xFF404370,
-0xFF42162F,
-0xFF6D1D2A,
-0xFF730E14,
-0xFF770304,
-0xFF790000,
-0xFF940A08,
-0xFFB21617,
-0xFFCD3134,
-0xFFCC3B42,
-0xFF9E2931,
-0xFF5B0E14,
-0xFF7F3A3F,
-0xFF9B4047,
-0xFFB64C50,
-0xFFBE4F48,
-0xFFC65A4D,
-0xFF9E3F2B,
-0xFF98573B,
-0xFFAF9972,
-0xFF5C5539,
-0xFF2B141C,
-0xFF32284B,
-0xFF5B7BAE,
-0xFF3D73B1,
-0xFF3E75B8,
-0xFF3E79BF,
-0xFF3777BF,
-0xFF3979C1,
-0xFF3E79BD,
-0xFF3C75B8,
-0xFF3E77BE,
-0xFF3D75BF,
-0xFF3B77C0,
-0xFF3977C2,
-0xFF3A78C3,
-0xFF3A78C1,
-0xFF3C78C1,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3D77C0,
-0xFF3C78C0,
-0xFF3D77C0,
-0xFF3C78C0,
-0xFF3D77C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF346CB6,
-0xFF346CB6,
-0xFF346CB6,
-0xFF366CB6,
-0xFF366CB6,
-0xFF376BB6,
-0xFF366AB5,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3466AD,
-0xFF3466AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF3464AC,
-0xFF305FA5,
-0xFF305FA5,
-0xFF305FA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3465AA,
-0xFF3566AB,
-0xFF3566AB,
-0xFF3566AB,
-0xFF3565AD,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3767AF,
-0xFF3567AE,
-0xFF3668AF,
-0xFF3668AF,
-0xFF3769B0,
-0xFF3769B0,
-0xFF3769B0,
-0xFF3769B2,
-0xFF3769B2,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF356EB5,
-0xFF356EB5,
-0xFF356EB5,
-0xFF356EB5,
-0xFF356EB5,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3B74BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF3978BD,
-0xFF397ABC,
-0xFF397ABE,
-0xFF3A78C1,
-0xFF3A78C3,
-0xFF3A78C1,
-0xFF3A78C1,
-0xFF3979C1,
-0xFF3A79C0,
-0xFF3A75BB,
-0xFF5779B6,
-0xFF605782,
-0xFF57213B,
-0xFFA03640,
-0xFFBA3A39,
-0xFFB33332,
-0xFFA42423,
-0xFF961615,
-0xFF811218,
-0xFF742238,
-0xFF82425A,
-0xFFAF7281,
-0xFFAF6870,
-0xFFAF4F53,
-0xFFB04648,
-0xFFA03F39,
-0xFF631604,
-0xFF582A06,
-0xFF8C7B45,
-0xFF869047,
-0xFF7B8445,
-0xFF614D32,
-0xFF281519,
-0xFF333E5A,
-0xFF5A7EB0,
-0xFF4479BB,
-0xFF3270B9,
-0xFF427EC4,
-0xFF3A77BA,
-0xFF3976B9,
-0xFF407BBD,
-0xFF4077BA,
-0xFF3E77BC,
-0xFF3A78C1,
-0xFF3979C3,
-0xFF3A78C1,
-0xFF3A79C0,
-0xFF397ABC,
-0xFF3B7ABD,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B77BF,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3B73BD,
-0xFF3B73BD,
-0xFF3B73BD,
-0xFF3B73BD,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF346EB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF366CB6,
-0xFF366CB6,
-0xFF366CB4,
-0xFF356BB3,
-0xFF356BB3,
-0xFF356BB3,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3468B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567AE,
-0xFF3466AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3565AD,
-0xFF305FA5,
-0xFF305FA5,
-0xFF305FA5,
-0xFF3160A6,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3566AB,
-0xFF3566AB,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3668AF,
-0xFF3668AF,
-0xFF3769B0,
-0xFF386AB1,
-0xFF386AB1,
-0xFF386AB1,
-0xFF386AB3,
-0xFF366AB3,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3972B9,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3B74BB,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF397ABE,
-0xFF377AC0,
-0xFF377AC0,
-0xFF3A79C0,
-0xFF3A79C0,
-0xFF3979C1,
-0xFF3979C3,
-0xFF3A78C1,
-0xFF3979C1,
-0xFF377BC4,
-0xFF3E75B8,
-0xFF5D73AC,
-0xFF776289,
-0xFF5C0F21,
-0xFF902328,
-0xFF9C2527,
-0xFFA53132,
-0xFFA43D40,
-0xFF722A38,
-0xFF8D7295,
-0xFF291337,
-0xFF4C1221,
-0xFF5D070A,
-0xFF780C0C,
-0xFF6F0200,
-0xFF670E00,
-0xFF470C00,
-0xFF9A874F,
-0xFF7F8A3C,
-0xFF799036,
-0xFF758431,
-0xFF938852,
-0xFF34220A,
-0xFF1C141F,
-0xFF455177,
-0xFF4F79B5,
-0xFF417ABF,
-0xFF3C77BB,
-0xFF3D7ABD,
-0xFF3F7CBD,
-0xFF3A77B8,
-0xFF3C77B9,
-0xFF3C79BC,
-0xFF3979C1,
-0xFF377AC1,
-0xFF3979C0,
-0xFF397ABC,
-0xFF397ABA,
-0xFF3A7BBB,
-0xFF3B7ABD,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3B7ABF,
-0xFF3D79BF,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3C7BC0,
-0xFF3D79BF,
-0xFF3B7ABF,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3D79BF,
-0xFF3B7ABF,
-0xFF3D79BF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3C7BC0,
-0xFF3B7CC0,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3A79BE,
-0xFF397ABE,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79C0,
-0xFF3A79C0,
-0xFF3D79C1,
-0xFF3B7AC1,
-0xFF3D79C1,
-0xFF3B7AC1,
-0xFF3C78C0,
-0xFF3A79C0,
-0xFF3D79C1,
-0xFF3A79C0,
-0xFF3C78C0,
-0xFF3A79C0,
-0xFF3D79C1,
-0xFF3B7AC1,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3C74BE,
-0xFF3C74BE,
-0xFF3B73BD,
-0xFF3B73BD,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF356FB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF356DB7,
-0xFF356DB7,
-0xFF376DB7,
-0xFF366CB6,
-0xFF366CB4,
-0xFF366CB4,
-0xFF356BB3,
-0xFF356BB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567AE,
-0xFF3567AE,
-0xFF3666AE,
-0xFF3666AE,
-0xFF3565AD,
-0xFF3565AD,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3566AB,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3666AE,
-0xFF3767AF,
-0xFF3668AF,
-0xFF3769B0,
-0xFF3769B0,
-0xFF3769B0,
-0xFF366BB1,
-0xFF366BB1,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF366FB6,
-0xFF366FB6,
-0xFF356EB5,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3570B6,
-0xFF366FB4,
-0xFF3770B5,
-0xFF3871B6,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3972B7,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3974B8,
-0xFF3974B8,
-0xFF3A75B9,
-0xFF3A75B9,
-0xFF3A75B9,
-0xFF3A75B9,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C78BE,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79C0,
-0xFF3978C5,
-0xFF3A78C3,
-0xFF3D78BA,
-0xFF3E7AB9,
-0xFF3D79C1,
-0xFF3C77C3,
-0xFF3C78C1,
-0xFF3A79C0,
-0xFF3778BC,
-0xFF3B78B9,
-0xFF4679BA,
-0xFF556EA4,
-0xFF766287,
-0xFF571C30,
-0xFF852129,
-0xFF8F262A,
-0xFF8A3C49,
-0xFF532C47,
-0xFF8596C4,
-0xFF474C74,
-0xFF5F1923,
-0xFF85140C,
-0xFF93190E,
-0xFF982513,
-0xFF802709,
-0xFFC08B57,
-0xFF9F9445,
-0xFF788529,
-0xFF809435,
-0xFF85953D,
-0xFF81853B,
-0xFF63582A,
-0xFF3D211E,
-0xFF150520,
-0xFF59709C,
-0xFF4D7BB6,
-0xFF3A75B9,
-0xFF3A79C0,
-0xFF3F7CBD,
-0xFF3B78B9,
-0xFF3B7CC0,
-0xFF377AC0,
-0xFF377AC1,
-0xFF377BC2,
-0xFF377CBD,
-0xFF377BBA,
-0xFF397BB8,
-0xFF3B7BBB,
-0xFF3B7ABD,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3C7BC0,
-0xFF3B7CC0,
-0xFF3B7ABF,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3B7CC0,
-0xFF3A7BBF,
-0xFF387BBF,
-0xFF3B7CC0,
-0xFF397CC0,
-0xFF3B7CC0,
-0xFF397CC0,
-0xFF3A7BBF,
-0xFF3A7BBF,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3A7BBF,
-0xFF3A7BBF,
-0xFF3A7BBF,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF397CC0,
-0xFF3A7BBF,
-0xFF387BBF,
-0xFF3A7BBF,
-0xFF387BBF,
-0xFF3A7BBF,
-0xFF387BBF,
-0xFF3B7CC0,
-0xFF397CC0,
-0xFF3B7CC0,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF397CC0,
-0xFF3B7CC0,
-0xFF3A7BBF,
-0xFF3979C0,
-0xFF3A7AC1,
-0xFF3C7BC2,
-0xFF3B7BC2,
-0xFF3B7AC1,
-0xFF3979C0,
-0xFF3A79C0,
-0xFF3A7AC1,
-0xFF3B7AC1,
-0xFF3A7AC1,
-0xFF3B7AC1,
-0xFF3A7AC1,
-0xFF3B7AC1,
-0xFF3A7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3A79C0,
-0xFF3A79C0,
-0xFF3A79C0,
-0xFF3A79C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3C74BE,
-0xFF3C74BE,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF346EB7,
-0xFF346EB7,
-0xFF366EB8,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356DB7,
-0xFF356EB5,
-0xFF346DB4,
-0xFF346DB4,
-0xFF366CB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366AB3,
-0xFF3569B2,
-0xFF3468B1,
-0xFF3468B1,
-0xFF3769B2,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567B0,
-0xFF3567AE,
-0xFF3466AD,
-0xFF3261A7,
-0xFF3261A7,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3767AF,
-0xFF3767AF,
-0xFF3769B0,
-0xFF3769B0,
-0xFF386AB1,
-0xFF386AB1,
-0xFF366BB1,
-0xFF366BB1,
-0xFF366AB3,
-0xFF366AB3,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386EB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3871B6,
-0xFF3871B6,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A75B9,
-0xFF3A75B9,
-0xFF3A75B9,
-0xFF3A75B9,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C78C0,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7AC1,
-0xFF3979C3,
-0xFF3A78C1,
-0xFF3D78BA,
-0xFF3E7AB9,
-0xFF3D79BF,
-0xFF3A78C1,
-0xFF3A78C1,
-0xFF3A79C0,
-0xFF4080C0,
-0xFF3879B9,
-0xFF367ABB,
-0xFF457BB7,
-0xFF5973A4,
-0xFF6D5F82,
-0xFF5B1B2C,
-0xFF742634,
-0xFF6E3A50,
-0xFF483E61,
-0xFF5D8AC3,
-0xFF385382,
-0xFF86424D,
-0xFF9D241B,
-0xFFA82216,
-0xFF9E240D,
-0xFF752200,
-0xFFE2B675,
-0xFFC1BD64,
-0xFF96A844,
-0xFF728627,
-0xFF84973E,
-0xFF748330,
-0xFF959056,
-0xFF3B1606,
-0xFF462230,
-0xFF0C0928,
-0xFF647FAE,
-0xFF4A7ABA,
-0xFF3874BA,
-0xFF3C7CBC,
-0xFF3B7CBC,
-0xFF387DC2,
-0xFF367CC4,
-0xFF377BC4,
-0xFF377CC1,
-0xFF377EBE,
-0xFF387EBC,
-0xFF3C7CBC,
-0xFF3F7CBF,
-0xFF3D7CC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3A7BBF,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF387BBF,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF387BBF,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3C7DC1,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3C7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF387BBF,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF387BBF,
-0xFF3A7AC1,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF366EB8,
-0xFF356DB7,
-0xFF356EB5,
-0xFF356EB5,
-0xFF346DB4,
-0xFF346DB4,
-0xFF366CB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3569B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3567AE,
-0xFF3567AE,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3566AB,
-0xFF3566AB,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3868B0,
-0xFF3868B0,
-0xFF3769B0,
-0xFF3769B0,
-0xFF386AB1,
-0xFF386AB1,
-0xFF366BB1,
-0xFF366BB1,
-0xFF366AB3,
-0xFF376BB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386EB6,
-0xFF386EB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CBE,
-0xFF3B7CBE,
-0xFF3E7AC0,
-0xFF3C7BC0,
-0xFF3B7CBE,
-0xFF397CC0,
-0xFF387DC2,
-0xFF397CC0,
-0xFF3C7CBA,
-0xFF3A7AB7,
-0xFF3880BA,
-0xFF387DB8,
-0xFF4278B4,
-0xFF5B74AA,
-0xFF6F5D83,
-0xFF3F1C3A,
-0xFF3D2945,
-0xFF4F5881,
-0xFF4781C1,
-0xFF345892,
-0xFF6A344B,
-0xFF9F2D2D,
-0xFFAB1C16,
-0xFF9E1E05,
-0xFF722900,
-0xFFD4B86F,
-0xFF9BA149,
-0xFF7D9535,
-0xFF8AA146,
-0xFF8DA44C,
-0xFF6A822E,
-0xFF8E9353,
-0xFF623F23,
-0xFF4B1B19,
-0xFF371724,
-0xFF211A3B,
-0xFF6482B8,
-0xFF447ABA,
-0xFF3F81BE,
-0xFF347BBB,
-0xFF357DC5,
-0xFF377CC7,
-0xFF387BC2,
-0xFF377AC0,
-0xFF367DBD,
-0xFF387DBE,
-0xFF3F7BC1,
-0xFF3F79C2,
-0xFF3D7CC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3A7AC1,
-0xFF3A7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3B77BF,
-0xFF3B77BF,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3A76BC,
-0xFF3A76BC,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF356FB8,
-0xFF3570B6,
-0xFF346FB5,
-0xFF346FB5,
-0xFF356EB5,
-0xFF366CB4,
-0xFF366CB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3569B2,
-0xFF3769B2,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3668B1,
-0xFF3567B0,
-0xFF3362A8,
-0xFF3362A8,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3766AC,
-0xFF3766AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3868B0,
-0xFF3969B1,
-0xFF386AB1,
-0xFF386AB1,
-0xFF386AB1,
-0xFF396BB2,
-0xFF376CB2,
-0xFF376CB2,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366CB4,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386EB6,
-0xFF386EB6,
-0xFF386EB6,
-0xFF386EB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CBE,
-0xFF3C7EBB,
-0xFF3C7DBD,
-0xFF3D7CC1,
-0xFF3F7BC3,
-0xFF3D7CBF,
-0xFF3A7EBD,
-0xFF397EBF,
-0xFF397EBF,
-0xFF3C7CBC,
-0xFF3D7FBC,
-0xFF3B81BD,
-0xFF377EBC,
-0xFF3A7EBF,
-0xFF4678B7,
-0xFF6778B0,
-0xFF4D4F7F,
-0xFF1D2248,
-0xFF607BAA,
-0xFF115199,
-0xFF285397,
-0xFF5E3A5E,
-0xFF91343F,
-0xFFA21D1E,
-0xFF9A200B,
-0xFF743200,
-0xFFBFAB62,
-0xFF98A24B,
-0xFF7B9436,
-0xFF8BA449,
-0xFF97AF59,
-0xFF6D8633,
-0xFF76803B,
-0xFF8D7243,
-0xFF451700,
-0xFF4E1E1A,
-0xFF260717,
-0xFF3F446A,
-0xFF5D81B3,
-0xFF3C79B2,
-0xFF3C81C2,
-0xFF397CC3,
-0xFF3A7CC6,
-0xFF3B7BC2,
-0xFF387BC1,
-0xFF377CBF,
-0xFF397CC0,
-0xFF3F7BC3,
-0xFF3F79C2,
-0xFF3B7CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3A7DC1,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3B7EC2,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3B7EC2,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF397CC0,
-0xFF397CC0,
-0xFF397CC0,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3B7BC2,
-0xFF3C7BC2,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3B7AC1,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3C78BE,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3B77BD,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3670B9,
-0xFF356FB8,
-0xFF3570B6,
-0xFF3570B6,
-0xFF346FB5,
-0xFF346FB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF376BB4,
-0xFF376BB4,
-0xFF386CB5,
-0xFF386CB5,
-0xFF376BB4,
-0xFF366AB3,
-0xFF386AB3,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3668B1,
-0xFF3463A9,
-0xFF3463A9,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3566AB,
-0xFF3566AB,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3868B0,
-0xFF3868B0,
-0xFF386AB1,
-0xFF386AB1,
-0xFF386AB1,
-0xFF386AB1,
-0xFF376CB2,
-0xFF376CB2,
-0xFF376CB2,
-0xFF376CB2,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386EB6,
-0xFF366FB6,
-0xFF366FB6,
-0xFF386EB6,
-0xFF386EB6,
-0xFF396FB7,
-0xFF396FB7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3972B9,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3873B9,
-0xFF3C75BC,
-0xFF3C75BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C7BBE,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3A79BC,
-0xFF3A79BC,
-0xFF3A79BC,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DBF,
-0xFF3A7EBD,
-0xFF3C7DBD,
-0xFF407BC1,
-0xFF417AC1,
-0xFF4278BE,
-0xFF3F7ABC,
-0xFF3B7DBA,
-0xFF397DBC,
-0xFF3C7CC3,
-0xFF3C7CC4,
-0xFF3D7DC5,
-0xFF3D7DC5,
-0xFF3D7DC4,
-0xFF3F78BD,
-0xFF4874BB,
-0xFF5D80C2,
-0xFF062156,
-0xFF4E75AE,
-0xFF0E509E,
-0xFF1E4F9B,
-0xFF463D6C,
-0xFF672B44,
-0xFF8E242E,
-0xFF83190B,
-0xFF693003,
-0xFFC4B16C,
-0xFF909A43,
-0xFF7E9739,
-0xFF8BA54A,
-0xFF768F3B,
-0xFF677E2E,
-0xFF899448,
-0xFFC8BC72,
-0xFF513200,
-0xFF4F1F09,
-0xFF4C1E20,
-0xFF18020E,
-0xFF545B78,
-0xFF5681B4,
-0xFF427EBD,
-0xFF4279BC,
-0xFF427BC0,
-0xFF3B7EC2,
-0xFF397EC3,
-0xFF3C7CC4,
-0xFF3D7BC4,
-0xFF3E7DC4,
-0xFF3E7DC4,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3A7BBF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78C0,
-0xFF3C78C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3672BA,
-0xFF3670B9,
-0xFF3670B9,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF3570B6,
-0xFF386EB6,
-0xFF386EB6,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF376BB4,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3769B2,
-0xFF3769B2,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3766AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3969B1,
-0xFF3969B1,
-0xFF396BB2,
-0xFF396BB2,
-0xFF396BB2,
-0xFF396BB2,
-0xFF376CB2,
-0xFF386DB3,
-0xFF386DB3,
-0xFF386DB3,
-0xFF376DB5,
-0xFF386EB6,
-0xFF386EB6,
-0xFF386EB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF386EB6,
-0xFF396FB7,
-0xFF396FB7,
-0xFF396FB7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3C75BC,
-0xFF3C75BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3C7BBE,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABD,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DBF,
-0xFF3B7FC0,
-0xFF3D7EC0,
-0xFF3F7BC1,
-0xFF4179C3,
-0xFF417AC1,
-0xFF407BBD,
-0xFF3D7DBB,
-0xFF3C7DBD,
-0xFF3B7BC2,
-0xFF3B7BC5,
-0xFF407ECB,
-0xFF3C7AC5,
-0xFF3D7CC3,
-0xFF3978BD,
-0xFF4482CB,
-0xFF447AC0,
-0xFF406AA6,
-0xFF315F9D,
-0xFF0B4A99,
-0xFF194E9C,
-0xFF2F3E77,
-0xFF45274B,
-0xFF7A2837,
-0xFF7E261C,
-0xFF592400,
-0xFFB09B5A,
-0xFF8F9741,
-0xFF7A9335,
-0xFF849E45,
-0xFF7C9541,
-0xFF657B29,
-0xFF87933D,
-0xFFB8B858,
-0xFFD8C775,
-0xFF4F2900,
-0xFF4E1F0B,
-0xFF431A16,
-0xFF1D0B19,
-0xFF606F98,
-0xFF5178AF,
-0xFF4B79B7,
-0xFF447BBC,
-0xFF3D7EC0,
-0xFF3B80C5,
-0xFF3E7DC4,
-0xFF407CC4,
-0xFF3D7DC4,
-0xFF3C7FC5,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3F7EC3,
-0xFF3E7FC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3E7DC2,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3A79BE,
-0xFF3A79BE,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672BA,
-0xFF3771BA,
-0xFF3771BA,
-0xFF3671B7,
-0xFF3671B7,
-0xFF3570B6,
-0xFF3570B6,
-0xFF366FB6,
-0xFF386EB6,
-0xFF386EB6,
-0xFF376DB5,
-0xFF376DB5,
-0xFF376DB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366AB3,
-0xFF386AB3,
-0xFF386AB3,
-0xFF3564AA,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3766AC,
-0xFF3766AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF396AAF,
-0xFF396AAF,
-0xFF3A6AB2,
-0xFF3A6AB2,
-0xFF396BB2,
-0xFF3A6CB3,
-0xFF396BB2,
-0xFF396BB2,
-0xFF386DB3,
-0xFF386DB3,
-0xFF386DB3,
-0xFF396EB4,
-0xFF386EB6,
-0xFF386EB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF396FB7,
-0xFF396FB7,
-0xFF396FB7,
-0xFF3A70B8,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3F7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3D7CC1,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7FC3,
-0xFF3C7FC3,
-0xFF3E7EC5,
-0xFF3D7DC5,
-0xFF3B7EC4,
-0xFF3A7FC2,
-0xFF3D7EBE,
-0xFF3E7FBF,
-0xFF407CC2,
-0xFF4180C7,
-0xFF3D7DC7,
-0xFF3C7FC6,
-0xFF3E81C5,
-0xFF4084C3,
-0xFF387CB9,
-0xFF417FBA,
-0xFF4C7FB8,
-0xFF3F71AE,
-0xFF003981,
-0xFF0F4791,
-0xFF234987,
-0xFF33325E,
-0xFF612638,
-0xFF691C14,
-0xFF602A04,
-0xFFB69D5D,
-0xFF878C3A,
-0xFF81983E,
-0xFF829A46,
-0xFF7B933F,
-0xFF657922,
-0xFFA1B14F,
-0xFFC3CB5B,
-0xFFC3C055,
-0xFFBDAA5D,
-0xFF3C1A00,
-0xFF441406,
-0xFF360B14,
-0xFF270F29,
-0xFF757AA2,
-0xFF547DB3,
-0xFF427EBD,
-0xFF3C7DC1,
-0xFF3E7EC5,
-0xFF407FC2,
-0xFF3E7EBE,
-0xFF3B7EC2,
-0xFF3C81C4,
-0xFF3E7FC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF407FC4,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF407FC4,
-0xFF407FC4,
-0xFF427EC4,
-0xFF3F7EC3,
-0xFF417DC3,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF437FC5,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF407FC4,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3F7EC3,
-0xFF3E7FC3,
-0xFF3C7FC3,
-0xFF3C7FC3,
-0xFF3C7FC3,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3B7EC2,
-0xFF3A7DC1,
-0xFF3A7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3B7CC0,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3E78C1,
-0xFF3E78C1,
-0xFF3E78C1,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773BB,
-0xFF3773BB,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3672B8,
-0xFF3671B7,
-0xFF3770B7,
-0xFF396FB7,
-0xFF396FB7,
-0xFF396FB7,
-0xFF386EB6,
-0xFF386EB6,
-0xFF386CB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF386CB5,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3665AB,
-0xFF3766AC,
-0xFF3766AC,
-0xFF3766AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3869AE,
-0xFF396AAF,
-0xFF396AAF,
-0xFF396AAF,
-0xFF396AAF,
-0xFF3A6AB2,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF386DB3,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF386EB4,
-0xFF386EB6,
-0xFF366FB6,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF396FB7,
-0xFF396FB7,
-0xFF3A70B8,
-0xFF3B71B9,
-0xFF3972B9,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3B74BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7BC1,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3D7CC1,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7EC0,
-0xFF3E7DC0,
-0xFF3C7DBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3E7FC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7DC4,
-0xFF3B7EC4,
-0xFF3A7FC4,
-0xFF3A7FC2,
-0xFF3B7FC0,
-0xFF3E7EBE,
-0xFF3D7ABD,
-0xFF4382C7,
-0xFF397CC3,
-0xFF3B7EC4,
-0xFF3B7FC0,
-0xFF397DBA,
-0xFF3C81BC,
-0xFF3E7FB7,
-0xFF6499CF,
-0xFF5183BE,
-0xFF01377D,
-0xFF0A428C,
-0xFF104589,
-0xFF283C6F,
-0xFF53273E,
-0xFF621F19,
-0xFF531E00,
-0xFF997B45,
-0xFF919447,
-0xFF7D943C,
-0xFF889F4F,
-0xFF7A913F,
-0xFF667D25,
-0xFF96A844,
-0xFFB2BF49,
-0xFFB5BD46,
-0xFFB6B44F,
-0xFFAD9950,
-0xFF3D0F00,
-0xFF4A130E,
-0xFF3B0F1C,
-0xFF271430,
-0xFF6A7FAA,
-0xFF507FB5,
-0xFF417DBC,
-0xFF3F80C2,
-0xFF4081C1,
-0xFF3E80BD,
-0xFF3A7FC0,
-0xFF3D80C4,
-0xFF4180C5,
-0xFF4180C5,
-0xFF4180C5,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF427EC6,
-0xFF427EC6,
-0xFF4180C5,
-0xFF3F80C4,
-0xFF407FC2,
-0xFF407FC2,
-0xFF4380C3,
-0xFF437FC5,
-0xFF407FC4,
-0xFF407FC4,
-0xFF437FC5,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF437FC5,
-0xFF437FC5,
-0xFF437FC5,
-0xFF427EC4,
-0xFF437FC5,
-0xFF437FC5,
-0xFF4480C6,
-0xFF4480C6,
-0xFF437FC5,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF437FC5,
-0xFF437FC5,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF427EC4,
-0xFF437FC5,
-0xFF437FC5,
-0xFF437FC5,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF4180C5,
-0xFF4180C5,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF4180C5,
-0xFF4180C5,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF407FC4,
-0xFF3F80C4,
-0xFF3F80C4,
-0xFF3F80C4,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3B7ABF,
-0xFF3E7AC2,
-0xFF3E7AC2,
-0xFF3D79C1,
-0xFF3D79C1,
-0xFF3E78C1,
-0xFF3E78C1,
-0xFF3E78C1,
-0xFF3E78C1,
-0xFF3D77C0,
-0xFF3D77C0,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3A76BE,
-0xFF3B75BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3A76BE,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3975BD,
-0xFF3874BC,
-0xFF3874BC,
-0xFF3773B9,
-0xFF3773B9,
-0xFF3672B8,
-0xFF3772B8,
-0xFF3871B8,
-0xFF3A70B8,
-0xFF3A70B8,
-0xFF3A70B8,
-0xFF3A70B8,
-0xFF396FB7,
-0xFF396DB6,
-0xFF386CB5,
-0xFF396DB6,
-0xFF386CB5,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF376BB4,
-0xFF366AB3,
-0xFF366AB3,
-0xFF3566AB,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3868B0,
-0xFF3969B1,
-0xFF3A6AB2,
-0xFF3A6AB2,
-0xFF3A6AB2,
-0xFF3969B1,
-0xFF3A6CB3,
-0xFF386DB3,
-0xFF386DB3,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF386EB4,
-0xFF396FB7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3770B7,
-0xFF3671B7,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3972B7,
-0xFF3972B7,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3D76BD,
-0xFF3E77BE,
-0xFF3D78BE,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3F7AC0,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3F7ABE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3D7ABD,
-0xFF3E7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF3E7FC3,
-0xFF3C7DBF,
-0xFF3A7EBF,
-0xFF3C7DBF,
-0xFF3A7EBF,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3E7DC0,
-0xFF407FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF3F80C2,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF4180C5,
-0xFF4081C5,
-0xFF3C7CC3,
-0xFF3F80C4,
-0xFF3F7EC1,
-0xFF4080C0,
-0xFF3E7EBC,
-0xFF427FB8,
-0xFF689DD1,
-0xFF487BB4,
-0xFF386AB3,
-0xFF073C8C,
-0xFF04428F,
-0xFF274782,
-0xFF45233E,
-0xFF632526,
-0xFF531B0A,
-0xFF755429,
-0xFF989953,
-0xFF839644,
-0xFF859B50,
-0xFF7B9345,
-0xFF617B24,
-0xFF96AC4A,
-0xFFB9CA58,
-0xFFAEBB45,
-0xFFABB542,
-0xFFBFBB58,
-0xFF8E6B2B,
-0xFF431200,
-0xFF3E0E0E,
-0xFF2C091D,
-0xFF2C223B,
-0xFF7789AF,
-0xFF4C7DB5,
-0xFF3F81BE,
-0xFF3B81BF,
-0xFF3C82C0,
-0xFF3C80C1,
-0xFF4081C5,
-0xFF437FC7,
-0xFF437FC5,
-0xFF4081C3,
-0xFF4081C1,
-0xFF4181BF,
-0xFF4380C1,
-0xFF467EC9,
-0xFF457ECB,
-0xFF3F7FC6,
-0xFF3D81C2,
-0xFF3F80C0,
-0xFF4080C0,
-0xFF437EC0,
-0xFF447FC3,
-0xFF437FC7,
-0xFF4180C7,
-0xFF4480C6,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4380C3,
-0xFF427FC2,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3D79BF,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3F7AC0,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D76BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3872BB,
-0xFF3772B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3770B7,
-0xFF3770B7,
-0xFF396FB5,
-0xFF396FB5,
-0xFF386EB4,
-0xFF386EB4,
-0xFF396EB4,
-0xFF386DB3,
-0xFF386DB3,
-0xFF386DB3,
-0xFF376CB2,
-0xFF376CB2,
-0xFF3667AC,
-0xFF3667AC,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF396AAF,
-0xFF396AAF,
-0xFF3969B1,
-0xFF3A6AB2,
-0xFF3B6BB3,
-0xFF3B6BB3,
-0xFF3A6AB2,
-0xFF396BB2,
-0xFF386DB3,
-0xFF386DB3,
-0xFF386DB3,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF386EB4,
-0xFF386EB4,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3D78BE,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF407BBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3E7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3F7EC3,
-0xFF3E7FC3,
-0xFF3F7EC3,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7EC2,
-0xFF3F7EC3,
-0xFF3E7FC3,
-0xFF3D7EC0,
-0xFF3B7FC0,
-0xFF3D7EC0,
-0xFF3C80C1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3F80C2,
-0xFF3E7FC1,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF407FC2,
-0xFF4080C0,
-0xFF4380C1,
-0xFF447FC1,
-0xFF437EC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4180C3,
-0xFF407FC2,
-0xFF3F80C4,
-0xFF4081C5,
-0xFF3E7FC3,
-0xFF4182C6,
-0xFF4380C3,
-0xFF417EBF,
-0xFF4480BF,
-0xFF407BB7,
-0xFF669BD1,
-0xFF4D80B9,
-0xFF5686CE,
-0xFF003381,
-0xFF084797,
-0xFF224887,
-0xFF452C4A,
-0xFF581F25,
-0xFF581F16,
-0xFF6B4725,
-0xFF949551,
-0xFF819443,
-0xFF859B50,
-0xFF80984C,
-0xFF637C28,
-0xFF7B9333,
-0xFFB9CB5D,
-0xFFB0BF48,
-0xFFA1B437,
-0xFFAFB344,
-0xFFC2AC56,
-0xFF5E3501,
-0xFF481407,
-0xFF370510,
-0xFF3B1725,
-0xFF382E49,
-0xFF6F87B7,
-0xFF4B7CB7,
-0xFF4583C0,
-0xFF468AC9,
-0xFF3B7CBE,
-0xFF407FC2,
-0xFF4580C6,
-0xFF4481C4,
-0xFF4182C2,
-0xFF4183C0,
-0xFF4481C0,
-0xFF467FC2,
-0xFF497DC8,
-0xFF487DC9,
-0xFF4180C7,
-0xFF3E81C5,
-0xFF4081C1,
-0xFF4181BF,
-0xFF4380BF,
-0xFF4580C4,
-0xFF4480C8,
-0xFF4480C8,
-0xFF4480C6,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF427FC2,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3E7DC2,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F78BF,
-0xFF3F78BF,
-0xFF3E77BE,
-0xFF3E77BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3973BC,
-0xFF3973BC,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3871B8,
-0xFF3871B8,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF386DB3,
-0xFF386DB3,
-0xFF386DB3,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3768AD,
-0xFF3768AD,
-0xFF3869AE,
-0xFF3869AE,
-0xFF396AAF,
-0xFF396AAF,
-0xFF396AAF,
-0xFF396BB2,
-0xFF396BB2,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF386EB4,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF3871B6,
-0xFF3871B6,
-0xFF3972B7,
-0xFF3972B7,
-0xFF3772B8,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3F7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF427FC2,
-0xFF407FC2,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F80C2,
-0xFF407FC2,
-0xFF3F80C2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4181C1,
-0xFF4282C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4081C5,
-0xFF4182C6,
-0xFF3F80C4,
-0xFF4384C8,
-0xFF4481C4,
-0xFF427FC0,
-0xFF4783C2,
-0xFF4580BC,
-0xFF629AD5,
-0xFF457BB7,
-0xFF4D80C2,
-0xFF346AB2,
-0xFF003581,
-0xFF1F4381,
-0xFF433050,
-0xFF55212D,
-0xFF5D2321,
-0xFF5F361A,
-0xFF949551,
-0xFF809641,
-0xFF839A4C,
-0xFF889E53,
-0xFF68802C,
-0xFF667E1E,
-0xFFBED060,
-0xFFADBD43,
-0xFFAFBF43,
-0xFFB2B945,
-0xFFB9AF4D,
-0xFF886722,
-0xFF6A2E16,
-0xFF4F0A0D,
-0xFF4D1119,
-0xFF350E23,
-0xFF4D406B,
-0xFF7682BC,
-0xFF5079B7,
-0xFF447DC0,
-0xFF4A85C7,
-0xFF4580C2,
-0xFF4581C0,
-0xFF4581C0,
-0xFF4182C2,
-0xFF4182C2,
-0xFF4580C2,
-0xFF487FC2,
-0xFF4B7EC0,
-0xFF4B7DC2,
-0xFF4580C6,
-0xFF4480C6,
-0xFF4481C2,
-0xFF4282BF,
-0xFF3F84BF,
-0xFF4283C3,
-0xFF4681C7,
-0xFF4680C9,
-0xFF4580C6,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3D7EC2,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7DC1,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3873B9,
-0xFF3972B9,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3A70B8,
-0xFF396FB7,
-0xFF396FB5,
-0xFF396FB5,
-0xFF386EB4,
-0xFF386EB4,
-0xFF386EB4,
-0xFF386EB4,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF396AAF,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF396BB2,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF3B6DB4,
-0xFF3B6DB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF3A6FB5,
-0xFF3A6FB5,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3A70B6,
-0xFF3A70B6,
-0xFF3871B6,
-0xFF3972B7,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3873B9,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3E79BD,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF3E7BBE,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF407DC0,
-0xFF407DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3C7BBE,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF4380C3,
-0xFF4380C3,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF407FC2,
-0xFF427FC2,
-0xFF4180C3,
-0xFF4380C3,
-0xFF4180C3,
-0xFF4380C3,
-0xFF4180C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4182C6,
-0xFF4182C6,
-0xFF3F80C4,
-0xFF4382C5,
-0xFF4380C1,
-0xFF4582C1,
-0xFF4680BF,
-0xFF558FCE,
-0xFF4E88C7,
-0xFF4680BF,
-0xFF487EBE,
-0xFF5289CC,
-0xFF003B81,
-0xFF1E427E,
-0xFF3B2F53,
-0xFF522738,
-0xFF602328,
-0xFF562810,
-0xFF9B9A57,
-0xFF829843,
-0xFF82994B,
-0xFF8CA355,
-0xFF6A812F,
-0xFF657A1D,
-0xFFA3B547,
-0xFFADBC45,
-0xFFB7C54C,
-0xFFB0B942,
-0xFFB3B548,
-0xFFBFAA57,
-0xFF5B2100,
-0xFF82382B,
-0xFF530D0B,
-0xFF591B28,
-0xFF350723,
-0xFF5C4772,
-0xFF6E7FB7,
-0xFF537CBC,
-0xFF4B82C3,
-0xFF4481C2,
-0xFF4581C0,
-0xFF4481C0,
-0xFF4282C2,
-0xFF4383C3,
-0xFF4681C5,
-0xFF4780C3,
-0xFF4981BE,
-0xFF4980C0,
-0xFF487EC4,
-0xFF467FC6,
-0xFF4580C2,
-0xFF4282BF,
-0xFF3F84BF,
-0xFF4084C1,
-0xFF4581C7,
-0xFF4680C9,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4683C6,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7FC1,
-0xFF3E7FC1,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3F7BC1,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF407BC1,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3F7AC0,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C76BF,
-0xFF3C76BF,
-0xFF3B75BE,
-0xFF3B75BE,
-0xFF3A74BD,
-0xFF3A74BD,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A73BA,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3A70B8,
-0xFF3A70B8,
-0xFF3A70B6,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF386EB4,
-0xFF386EB4,
-0xFF3968AE,
-0xFF3968AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF3869AE,
-0xFF396AAF,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF396BB0,
-0xFF3A6CB1,
-0xFF3A6CB3,
-0xFF3A6CB3,
-0xFF386DB3,
-0xFF396EB4,
-0xFF396EB4,
-0xFF3A6FB5,
-0xFF396EB4,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3A70B6,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3D78BC,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3F7ABE,
-0xFF3E7BBE,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3E7BBE,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF407FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF407DC0,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF4580C4,
-0xFF4580C4,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC3,
-0xFF447FC1,
-0xFF4380C1,
-0xFF447FC1,
-0xFF4380C1,
-0xFF447FC1,
-0xFF4380C1,
-0xFF447FC1,
-0xFF4380C1,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4481C2,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4282C2,
-0xFF4383C3,
-0xFF4582C3,
-0xFF4481C2,
-0xFF4281C4,
-0xFF4382C5,
-0xFF4182C4,
-0xFF4283C5,
-0xFF4180C3,
-0xFF4281C4,
-0xFF427FC0,
-0xFF4885C4,
-0xFF417BBA,
-0xFF639FDD,
-0xFF3E7EBE,
-0xFF4582C3,
-0xFF4C86C5,
-0xFF4980C0,
-0xFF366DB0,
-0xFF082C68,
-0xFF44436D,
-0xFF422039,
-0xFF5E222A,
-0xFF521F0A,
-0xFF9A9958,
-0xFF859B46,
-0xFF839A4C,
-0xFF90A759,
-0xFF6A802E,
-0xFF6C7F25,
-0xFF96A23C,
-0xFFB6C252,
-0xFFB7C54C,
-0xFFB7C54C,
-0xFFACB945,
-0xFFCDC767,
-0xFFA07236,
-0xFF6B2605,
-0xFF883F30,
-0xFF560B08,
-0xFF63161C,
-0xFF460C22,
-0xFF675784,
-0xFF6A7EB9,
-0xFF477AB9,
-0xFF4586C8,
-0xFF4382C5,
-0xFF4582C5,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4383C3,
-0xFF4284C1,
-0xFF4085BE,
-0xFF4384BE,
-0xFF4A7FC3,
-0xFF4A7FC5,
-0xFF4681C5,
-0xFF4383C1,
-0xFF4583BE,
-0xFF4583C0,
-0xFF4382C7,
-0xFF4282C9,
-0xFF4483C6,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3D7EC2,
-0xFF3D7EC2,
-0xFF3E7DC2,
-0xFF3D7CC1,
-0xFF3C7BC0,
-0xFF3B7ABF,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3770B7,
-0xFF3968AE,
-0xFF3A69AF,
-0xFF396AAF,
-0xFF396AAF,
-0xFF396AAF,
-0xFF396AAF,
-0xFF3A6BB0,
-0xFF3A6CB1,
-0xFF3A6CB1,
-0xFF3A6CB1,
-0xFF3B6DB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF3A6FB5,
-0xFF3A70B6,
-0xFF396FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3A70B6,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3E77BC,
-0xFF3E77BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF4380C3,
-0xFF4380C3,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF447FC3,
-0xFF447FC3,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4681C5,
-0xFF4681C5,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C4,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4380C3,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4282C2,
-0xFF4383C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4382C5,
-0xFF4382C5,
-0xFF4182C4,
-0xFF4283C5,
-0xFF4382C5,
-0xFF4383C3,
-0xFF4380BF,
-0xFF4884C2,
-0xFF407BB7,
-0xFF65A1DF,
-0xFF4283C5,
-0xFF3E7FC1,
-0xFF4582C1,
-0xFF457FBE,
-0xFF568BCD,
-0xFF133977,
-0xFF333D6E,
-0xFF3B2647,
-0xFF5A202C,
-0xFF511D08,
-0xFF918D4E,
-0xFF899C4B,
-0xFF869B50,
-0xFF92A75A,
-0xFF6A802E,
-0xFF6E8128,
-0xFF768423,
-0xFFB3C054,
-0xFFC0CD57,
-0xFFB3C148,
-0xFFAABC46,
-0xFFA2A33B,
-0xFFCDAE5E,
-0xFF662E00,
-0xFF772F19,
-0xFFAB5852,
-0xFF5E0500,
-0xFF6E2127,
-0xFF380C27,
-0xFF6C658F,
-0xFF6185B9,
-0xFF4681BD,
-0xFF4683C6,
-0xFF4483C8,
-0xFF4682C8,
-0xFF4683C6,
-0xFF4283C5,
-0xFF4084C1,
-0xFF3F86BE,
-0xFF4284BE,
-0xFF4881C4,
-0xFF4881C6,
-0xFF4483C6,
-0xFF4484C4,
-0xFF4783C1,
-0xFF4783C1,
-0xFF4384C8,
-0xFF4184C8,
-0xFF4384C6,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4683C6,
-0xFF4683C6,
-0xFF4683C6,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3D7EC0,
-0xFF3D7EC2,
-0xFF3E7FC3,
-0xFF407FC4,
-0xFF3F7EC3,
-0xFF3E7DC2,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3A73BA,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3871B8,
-0xFF3871B8,
-0xFF3770B7,
-0xFF3770B7,
-0xFF396AAF,
-0xFF396AAF,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF3A6CB1,
-0xFF3A6CB1,
-0xFF3B6DB2,
-0xFF396EB2,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396EB4,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3B71B7,
-0xFF3A70B8,
-0xFF3871B8,
-0xFF3871B6,
-0xFF3972B7,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75B8,
-0xFF3C75B8,
-0xFF3C75B8,
-0xFF3D76B9,
-0xFF3D76B9,
-0xFF3E77BA,
-0xFF3D76BB,
-0xFF3E77BC,
-0xFF3E77BC,
-0xFF3E77BC,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF407DC0,
-0xFF417EC1,
-0xFF417EBF,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4481C2,
-0xFF4282C2,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4382C5,
-0xFF4283C5,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4283C5,
-0xFF4283C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4683C2,
-0xFF4682C0,
-0xFF4883BF,
-0xFF5E9AD8,
-0xFF4081C1,
-0xFF4286C7,
-0xFF4484C4,
-0xFF417DBC,
-0xFF5085C7,
-0xFF4B74B2,
-0xFF152E66,
-0xFF433B62,
-0xFF551F2C,
-0xFF561F0B,
-0xFF847B42,
-0xFF8C9C51,
-0xFF889A50,
-0xFF91A659,
-0xFF718735,
-0xFF6B822A,
-0xFF6B811F,
-0xFFB4C75C,
-0xFFB6C351,
-0xFFB9C24D,
-0xFFAAB441,
-0xFF898C21,
-0xFFD6CC6B,
-0xFFCCA965,
-0xFFA5614A,
-0xFF5E0807,
-0xFF7B2524,
-0xFF5F0D0F,
-0xFF661F25,
-0xFF3B1222,
-0xFF6F7597,
-0xFF5A82B3,
-0xFF4984C0,
-0xFF4285C9,
-0xFF4484CC,
-0xFF4583CC,
-0xFF4584C9,
-0xFF4484C4,
-0xFF4485BF,
-0xFF4385C1,
-0xFF4286C7,
-0xFF4186C9,
-0xFF4186C7,
-0xFF4286C5,
-0xFF4883C5,
-0xFF4883C7,
-0xFF4485C7,
-0xFF4286C7,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3C7BC0,
-0xFF3C7BC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3772B8,
-0xFF3772B8,
-0xFF396AAF,
-0xFF3A6BB0,
-0xFF3B6CB1,
-0xFF3B6CB1,
-0xFF3B6CB1,
-0xFF3B6CB1,
-0xFF3A6CB1,
-0xFF3B6DB2,
-0xFF396EB2,
-0xFF3A6FB3,
-0xFF3A6FB5,
-0xFF3A6FB5,
-0xFF396FB5,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3B71B7,
-0xFF3972B9,
-0xFF3972B9,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75B8,
-0xFF3D76B9,
-0xFF3D76B9,
-0xFF3D76B9,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3E77BC,
-0xFF3E77BC,
-0xFF3F78BD,
-0xFF3F78BD,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF407BBF,
-0xFF407BBF,
-0xFF3E7BBE,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF407DC0,
-0xFF407DC0,
-0xFF407DC0,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF427FC2,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4384C4,
-0xFF4384C6,
-0xFF4283C5,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4485C7,
-0xFF4283C5,
-0xFF4585C5,
-0xFF4484C2,
-0xFF4985C4,
-0xFF4480BC,
-0xFF548CC9,
-0xFF5894D0,
-0xFF4183C0,
-0xFF4589C8,
-0xFF4182C4,
-0xFF4B88C9,
-0xFF4C83C4,
-0xFF5484C4,
-0xFF2C508E,
-0xFF3B4270,
-0xFF4E1F2F,
-0xFF572212,
-0xFF7A6E3A,
-0xFF919C57,
-0xFF87974E,
-0xFF91A357,
-0xFF798E3F,
-0xFF6C842E,
-0xFF678022,
-0xFF98AF47,
-0xFFBDC95B,
-0xFFC2CA5A,
-0xFF8B9324,
-0xFFCED669,
-0xFFE0E378,
-0xFFE1CC7B,
-0xFF521300,
-0xFF903731,
-0xFFA34442,
-0xFF933535,
-0xFF630D0C,
-0xFF53161D,
-0xFF2D152B,
-0xFF747EA2,
-0xFF5880B4,
-0xFF4A84C3,
-0xFF4584CB,
-0xFF4583CC,
-0xFF4783CB,
-0xFF4784C7,
-0xFF4784C3,
-0xFF4486C3,
-0xFF4087C7,
-0xFF3E88C7,
-0xFF4087C7,
-0xFF4286C7,
-0xFF4784C7,
-0xFF4784C7,
-0xFF4286C7,
-0xFF4186C7,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4384C4,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4382C5,
-0xFF4281C4,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3E7FC1,
-0xFF3D7EC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3D7CC1,
-0xFF3D7CC1,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3873B9,
-0xFF3A6BB0,
-0xFF3A6BB0,
-0xFF3B6CB1,
-0xFF3B6CB1,
-0xFF3B6DB2,
-0xFF3B6DB2,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF396EB2,
-0xFF396EB2,
-0xFF396FB5,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3A70B6,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3972B7,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75B8,
-0xFF3D76B9,
-0xFF3D76B9,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3F78BB,
-0xFF3F7ABE,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3F7ABE,
-0xFF407BBF,
-0xFF407BBF,
-0xFF3F7CBF,
-0xFF3E7BBE,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF407DC0,
-0xFF417EC1,
-0xFF417EC1,
-0xFF407DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427FC2,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF427FC0,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4484C4,
-0xFF4784C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4384C4,
-0xFF4384C4,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C7,
-0xFF4286C7,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4384C4,
-0xFF4687C7,
-0xFF4383C3,
-0xFF4383C1,
-0xFF4B87C6,
-0xFF437FBB,
-0xFF679FDC,
-0xFF4681BD,
-0xFF4686C3,
-0xFF4185C2,
-0xFF4286C5,
-0xFF4586C8,
-0xFF4984C6,
-0xFF4B80C2,
-0xFF5687CA,
-0xFF283C6F,
-0xFF4B283E,
-0xFF4F2016,
-0xFF6C5E2F,
-0xFF979C59,
-0xFF88954D,
-0xFF8FA155,
-0xFF7E9547,
-0xFF6B832F,
-0xFF6D862B,
-0xFF839937,
-0xFFBCCB62,
-0xFFABB74B,
-0xFFCED971,
-0xFFC8D36A,
-0xFFB1BE4A,
-0xFFD1C766,
-0xFFA1693A,
-0xFF8A2F1C,
-0xFF8C1A10,
-0xFF9B2929,
-0xFF8D333D,
-0xFF631F2E,
-0xFF410B1B,
-0xFF381C35,
-0xFF7982AB,
-0xFF5E83B8,
-0xFF4A80BE,
-0xFF4986C7,
-0xFF4782C6,
-0xFF4A86CC,
-0xFF4282C9,
-0xFF4489CC,
-0xFF4188C6,
-0xFF4189C4,
-0xFF4387C8,
-0xFF4586CA,
-0xFF4685C8,
-0xFF4586C8,
-0xFF4188C8,
-0xFF4188C8,
-0xFF4387C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF427FC2,
-0xFF407FC2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3E7FC1,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3C7BBE,
-0xFF3E7DC0,
-0xFF407DC0,
-0xFF3E7BBE,
-0xFF3D79BF,
-0xFF3E7AC0,
-0xFF3F7BC1,
-0xFF3E7AC0,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3974BA,
-0xFF3B6CB1,
-0xFF3B6CB1,
-0xFF3C6DB2,
-0xFF3B6DB2,
-0xFF3B6DB2,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF396FB5,
-0xFF3A70B6,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3C72B8,
-0xFF3A73B8,
-0xFF3A73B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3D76B9,
-0xFF3D76B9,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3F78BB,
-0xFF3F78BB,
-0xFF3E79BB,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF3F7ABE,
-0xFF407BBF,
-0xFF417CC0,
-0xFF407DC0,
-0xFF3F7CBF,
-0xFF407DC0,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4580C2,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4484C4,
-0xFF4683C4,
-0xFF4484C4,
-0xFF4683C4,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4683C4,
-0xFF4484C4,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4586C6,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4387C8,
-0xFF4387C8,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4384C4,
-0xFF4787C7,
-0xFF4787C5,
-0xFF4581BF,
-0xFF4A86C2,
-0xFF639BD6,
-0xFF4984BE,
-0xFF4785C2,
-0xFF4688C5,
-0xFF4187C5,
-0xFF4286C5,
-0xFF4A87CA,
-0xFF4782C6,
-0xFF4F8ACE,
-0xFF3A5992,
-0xFF4C3758,
-0xFF482221,
-0xFF5F5025,
-0xFF999A58,
-0xFF8D9951,
-0xFF87994D,
-0xFF869C51,
-0xFF667E30,
-0xFF6A812F,
-0xFF677B22,
-0xFFBECF69,
-0xFFCDDA70,
-0xFFB9C15A,
-0xFFACB84C,
-0xFFB0C24A,
-0xFFC6C55B,
-0xFFA67D3D,
-0xFF560300,
-0xFFA42919,
-0xFF991813,
-0xFF922930,
-0xFF883644,
-0xFF65243A,
-0xFF330823,
-0xFF39284A,
-0xFF7A83AE,
-0xFF5A83B9,
-0xFF4983C2,
-0xFF4784C3,
-0xFF4586C8,
-0xFF4285CB,
-0xFF4186C9,
-0xFF4189C4,
-0xFF4288C4,
-0xFF4685C8,
-0xFF4884CA,
-0xFF4685C8,
-0xFF4387C6,
-0xFF4289C7,
-0xFF4289C7,
-0xFF4387C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4582C5,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4481C4,
-0xFF4380C3,
-0xFF4380C3,
-0xFF4180C3,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3F80C2,
-0xFF3E7FC1,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3E7DC0,
-0xFF407DC0,
-0xFF3E7BBE,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3E79BF,
-0xFF3D78BE,
-0xFF3D78BE,
-0xFF3C77BD,
-0xFF3C77BD,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3B76BC,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3A75BB,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3B70B4,
-0xFF3A71B4,
-0xFF3B71B7,
-0xFF3B71B7,
-0xFF3C72B8,
-0xFF3C72B8,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3D76B9,
-0xFF3D76B9,
-0xFF3D78BA,
-0xFF3D78BA,
-0xFF3E79BB,
-0xFF3E79BB,
-0xFF3E79BB,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF3E7BBC,
-0xFF3F7CBD,
-0xFF3F7CBD,
-0xFF407DBE,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF447FC1,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4580C2,
-0xFF447FC1,
-0xFF4681C3,
-0xFF4782C4,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4484C2,
-0xFF4385C2,
-0xFF4484C2,
-0xFF4486C3,
-0xFF4585C3,
-0xFF4587C4,
-0xFF4686C4,
-0xFF4587C4,
-0xFF4585C3,
-0xFF4486C3,
-0xFF4686C4,
-0xFF4587C4,
-0xFF4686C4,
-0xFF4486C3,
-0xFF4585C3,
-0xFF4486C3,
-0xFF4585C5,
-0xFF4485C5,
-0xFF4686C6,
-0xFF4586C6,
-0xFF4686C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4387C6,
-0xFF4488C9,
-0xFF4488C9,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4485C5,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4985C3,
-0xFF4783BF,
-0xFF679FDA,
-0xFF4782BC,
-0xFF4785C2,
-0xFF498BC8,
-0xFF4187C3,
-0xFF4187C5,
-0xFF4889CB,
-0xFF4483C8,
-0xFF498ACE,
-0xFF517BB7,
-0xFF433B6A,
-0xFF3E2633,
-0xFF52441D,
-0xFF9A9956,
-0xFF8C964D,
-0xFF8EA056,
-0xFF899D55,
-0xFF697F37,
-0xFF6C803B,
-0xFF859849,
-0xFFB5C966,
-0xFFBBCB5E,
-0xFFA9B144,
-0xFFADB643,
-0xFFACC043,
-0xFFC0CA59,
-0xFFA58C3C,
-0xFF5B1700,
-0xFFA22A11,
-0xFFAA1C12,
-0xFF9E1912,
-0xFF872228,
-0xFF794569,
-0xFF472852,
-0xFF330826,
-0xFF412848,
-0xFF768CBE,
-0xFF5387C3,
-0xFF4486C0,
-0xFF4189C3,
-0xFF4589C6,
-0xFF4387C4,
-0xFF4389C7,
-0xFF4488C7,
-0xFF4986C9,
-0xFF4A85C9,
-0xFF4687C9,
-0xFF4488C7,
-0xFF4488C5,
-0xFF4688C5,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4883C5,
-0xFF4883C5,
-0xFF4883C5,
-0xFF4883C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4681C5,
-0xFF4582C5,
-0xFF4180C3,
-0xFF4081C3,
-0xFF4081C3,
-0xFF4081C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3C7BBE,
-0xFF3C7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3C78BE,
-0xFF3C78BE,
-0xFF3D78BC,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3A75B9,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3C6EB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3B72B5,
-0xFF3B72B5,
-0xFF3C72B8,
-0xFF3C72B8,
-0xFF3D73B9,
-0xFF3D73B9,
-0xFF3B74B9,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3C75BA,
-0xFF3D76BB,
-0xFF3D76BB,
-0xFF3E77BC,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3D78BA,
-0xFF3E79BB,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF407BBD,
-0xFF3F7CBD,
-0xFF3F7CBD,
-0xFF3F7CBD,
-0xFF407DBE,
-0xFF407DBE,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF447FC1,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4580C2,
-0xFF4580C2,
-0xFF4681C3,
-0xFF4782C4,
-0xFF4681C3,
-0xFF4681C3,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4883C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4686C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4486C3,
-0xFF4486C3,
-0xFF4486C3,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4587C4,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4488C9,
-0xFF4488C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4485C5,
-0xFF4989C7,
-0xFF4686C3,
-0xFF4B89C6,
-0xFF4F8CC5,
-0xFF5F9AD4,
-0xFF4782BC,
-0xFF4985C3,
-0xFF498BC8,
-0xFF4288C3,
-0xFF4189C4,
-0xFF4588CC,
-0xFF4285C9,
-0xFF468ACB,
-0xFF5B8DCA,
-0xFF343F77,
-0xFF3D334C,
-0xFF3E3514,
-0xFFA09C5C,
-0xFF909A53,
-0xFF86984E,
-0xFF8CA058,
-0xFF6D813A,
-0xFF93A867,
-0xFF768B40,
-0xFF7F9332,
-0xFFB9C95C,
-0xFFB0B848,
-0xFFBAC34C,
-0xFFB9CE4F,
-0xFFB7C450,
-0xFFD9CB73,
-0xFF723B03,
-0xFF8B1D02,
-0xFF9A1005,
-0xFFAA1E11,
-0xFF932526,
-0xFF5D2B4E,
-0xFF6C527F,
-0xFF4A2449,
-0xFF2B0D31,
-0xFF34335D,
-0xFF738EBD,
-0xFF4F87BA,
-0xFF478DC1,
-0xFF4385BF,
-0xFF458AC5,
-0xFF438ACA,
-0xFF4489CA,
-0xFF4986C7,
-0xFF4A86C5,
-0xFF4787C7,
-0xFF4788C8,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4986C7,
-0xFF4885C6,
-0xFF4986C7,
-0xFF4885C6,
-0xFF4984C6,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4782C6,
-0xFF4683C6,
-0xFF4281C4,
-0xFF4182C4,
-0xFF4182C4,
-0xFF4081C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3D7CBF,
-0xFF3D7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3F7BC1,
-0xFF3E7AC0,
-0xFF3E7AC0,
-0xFF3D79BF,
-0xFF3D79BF,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3C77BB,
-0xFF3B76BA,
-0xFF3B76BA,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3B70B4,
-0xFF3B70B4,
-0xFF3A71B4,
-0xFF3A71B4,
-0xFF3C73B6,
-0xFF3C73B6,
-0xFF3C72B8,
-0xFF3D73B9,
-0xFF3D73B9,
-0xFF3D73B9,
-0xFF3E74BA,
-0xFF3E74BA,
-0xFF3E75B8,
-0xFF3E75B8,
-0xFF3F76B9,
-0xFF3F76B9,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF3F78BB,
-0xFF3E79BB,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF407BBD,
-0xFF3F7CBD,
-0xFF3F7CBD,
-0xFF3F7CBD,
-0xFF407DBE,
-0xFF407DBE,
-0xFF3E7EBE,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4485C5,
-0xFF4485C5,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4688C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4889C9,
-0xFF4384C4,
-0xFF498BC8,
-0xFF4787C4,
-0xFF4583C0,
-0xFF66A3DC,
-0xFF4A85BF,
-0xFF4C87C1,
-0xFF4B87C3,
-0xFF4789C5,
-0xFF4389C5,
-0xFF438AC8,
-0xFF4388CB,
-0xFF4487CB,
-0xFF4589C6,
-0xFF558DCA,
-0xFF4A66A7,
-0xFF3A4267,
-0xFF363219,
-0xFF9A985D,
-0xFF8C9752,
-0xFF899B51,
-0xFFA5B76D,
-0xFF8FA35B,
-0xFF697F37,
-0xFF687F31,
-0xFF718526,
-0xFFBDCE64,
-0xFFB1BE4C,
-0xFFB5C048,
-0xFFB4C545,
-0xFFAEB742,
-0xFFBBAF59,
-0xFF6A3D06,
-0xFF80210D,
-0xFF90170F,
-0xFF901408,
-0xFF89211E,
-0xFF6C3145,
-0xFF573D64,
-0xFF4F4A82,
-0xFF342D60,
-0xFF290B27,
-0xFF47334E,
-0xFF7691BE,
-0xFF5286BF,
-0xFF4885BE,
-0xFF4789C6,
-0xFF418BCC,
-0xFF418BCA,
-0xFF458AC3,
-0xFF4A88C1,
-0xFF4A88C3,
-0xFF4A87C6,
-0xFF4B88C9,
-0xFF4988CB,
-0xFF4788C8,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF468AC7,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4789C6,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4986C7,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF3E7DC0,
-0xFF407DC0,
-0xFF407DC0,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D78BC,
-0xFF3D76BB,
-0xFF3C75BA,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3A6FB3,
-0xFF3B70B4,
-0xFF3B70B4,
-0xFF3C71B5,
-0xFF3B72B5,
-0xFF3B72B5,
-0xFF3C73B6,
-0xFF3C73B6,
-0xFF3D73B9,
-0xFF3D73B9,
-0xFF3E74BA,
-0xFF3E74BA,
-0xFF3E74BA,
-0xFF3E74BA,
-0xFF3F76B9,
-0xFF3F76B9,
-0xFF4077BA,
-0xFF4077BA,
-0xFF3F78BB,
-0xFF3F78BB,
-0xFF3F78BB,
-0xFF3F78BB,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF407BBD,
-0xFF407BBD,
-0xFF3F7CBD,
-0xFF407DBE,
-0xFF407DBE,
-0xFF407DBE,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF4080C0,
-0xFF4080C0,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF3F7FBF,
-0xFF4080C0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4889C9,
-0xFF4687C7,
-0xFF488AC7,
-0xFF4587C3,
-0xFF4886C3,
-0xFF6AA8E3,
-0xFF4580BA,
-0xFF4C89C2,
-0xFF4B89C4,
-0xFF4688C4,
-0xFF458BC9,
-0xFF448BCB,
-0xFF4388CB,
-0xFF4589CA,
-0xFF4789C3,
-0xFF4C88C4,
-0xFF608BD0,
-0xFF283F6B,
-0xFF2E2F21,
-0xFF959360,
-0xFF909C5A,
-0xFFACC176,
-0xFF97A85A,
-0xFF66782C,
-0xFF6E8439,
-0xFF6D8635,
-0xFF6D8227,
-0xFFABBD57,
-0xFFB1C24F,
-0xFFB4C448,
-0xFFB5C447,
-0xFFA9B040,
-0xFFA99F4A,
-0xFF815A23,
-0xFF6F1908,
-0xFF821210,
-0xFF8B1209,
-0xFF7D100B,
-0xFF651822,
-0xFF533051,
-0xFF415496,
-0xFF304888,
-0xFF422949,
-0xFF321028,
-0xFF424067,
-0xFF748BBD,
-0xFF5986BF,
-0xFF4D89C7,
-0xFF458ACB,
-0xFF428CCB,
-0xFF458CC4,
-0xFF488BC2,
-0xFF4989C6,
-0xFF4B88C7,
-0xFF4989C9,
-0xFF4889C9,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF4589C6,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF4589C6,
-0xFF4589C6,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C7,
-0xFF4687C7,
-0xFF4787C7,
-0xFF4687C7,
-0xFF4787C7,
-0xFF4586C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4382C5,
-0xFF4281C4,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF407FC2,
-0xFF407DC0,
-0xFF407DC0,
-0xFF407DC0,
-0xFF407DC0,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF3E7BBE,
-0xFF3E7BBE,
-0xFF3F7ABE,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3D78BC,
-0xFF3E79BD,
-0xFF3E79BD,
-0xFF3E77BC,
-0xFF3D76BB,
-0xFF3A71B4,
-0xFF3A71B4,
-0xFF3A71B4,
-0xFF3B72B5,
-0xFF3B72B5,
-0xFF3C73B6,
-0xFF3C73B6,
-0xFF3D74B7,
-0xFF3D74B7,
-0xFF3D74B7,
-0xFF3D73B9,
-0xFF3E74BA,
-0xFF3E74BA,
-0xFF3F75BB,
-0xFF3F75BB,
-0xFF3F75BB,
-0xFF4077BA,
-0xFF4077B8,
-0xFF4077B8,
-0xFF4178B9,
-0xFF4079BC,
-0xFF4079BC,
-0xFF4079BC,
-0xFF4079BC,
-0xFF407BBD,
-0xFF407BBD,
-0xFF407DBE,
-0xFF407DBE,
-0xFF407DC0,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF3F7FBF,
-0xFF3F80C0,
-0xFF4080C0,
-0xFF4080C0,
-0xFF4080C0,
-0xFF4080C0,
-0xFF4181C1,
-0xFF4181C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4989C9,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C6,
-0xFF4989C6,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4788C8,
-0xFF4A8BCB,
-0xFF4789C6,
-0xFF4688C4,
-0xFF4C8AC7,
-0xFF62A0DB,
-0xFF4D88C2,
-0xFF4B88C1,
-0xFF4B89C2,
-0xFF4789C5,
-0xFF458ACD,
-0xFF448ACF,
-0xFF458ACD,
-0xFF4789C6,
-0xFF498AC0,
-0xFF4987C0,
-0xFF548BCE,
-0xFF385C8C,
-0xFF212620,
-0xFFACAA81,
-0xFFA3B173,
-0xFF81964B,
-0xFFA5B364,
-0xFF748332,
-0xFF6F8636,
-0xFF6E8734,
-0xFF6B832D,
-0xFF8AA03C,
-0xFFB5CC57,
-0xFFB2C649,
-0xFFA5B23E,
-0xFF9DA039,
-0xFFB6AE59,
-0xFF977339,
-0xFF5B0A00,
-0xFF730302,
-0xFF7F0000,
-0xFF890C08,
-0xFF861B21,
-0xFF693452,
-0xFF305397,
-0xFF18519E,
-0xFF37467F,
-0xFF3C2B55,
-0xFF300E2F,
-0xFF5B456B,
-0xFF748ABC,
-0xFF5283BE,
-0xFF4D89C8,
-0xFF478BCA,
-0xFF468AC9,
-0xFF458BC9,
-0xFF458ACB,
-0xFF468CCA,
-0xFF458DC7,
-0xFF468CC7,
-0xFF478BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4589C6,
-0xFF4789C6,
-0xFF4488C5,
-0xFF4687C7,
-0xFF4488C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4586C6,
-0xFF4586C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4382C5,
-0xFF4281C4,
-0xFF4180C3,
-0xFF4180C3,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF407DC0,
-0xFF407DC0,
-0xFF407DC0,
-0xFF3F7CBF,
-0xFF3F7CBF,
-0xFF407BBF,
-0xFF3F7ABE,
-0xFF3E79BB,
-0xFF3E79BB,
-0xFF4079BC,
-0xFF4079BC,
-0xFF3F78BB,
-0xFF3E77BA,
-0xFF3C71B5,
-0xFF3B72B5,
-0xFF3B72B5,
-0xFF3C73B6,
-0xFF3C73B6,
-0xFF3D74B7,
-0xFF3D74B7,
-0xFF3D74B7,
-0xFF3D74B7,
-0xFF3F74B8,
-0xFF3F74BA,
-0xFF3F74BA,
-0xFF3F75BB,
-0xFF3F76B9,
-0xFF3F76B9,
-0xFF3F76B9,
-0xFF4077B8,
-0xFF3F79B9,
-0xFF4178B9,
-0xFF407ABA,
-0xFF4079BC,
-0xFF417ABD,
-0xFF417ABD,
-0xFF407BBD,
-0xFF407BBD,
-0xFF417CBE,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427FC2,
-0xFF4080C0,
-0xFF3F7FBF,
-0xFF4080C0,
-0xFF4181C1,
-0xFF4181C1,
-0xFF4181C1,
-0xFF4181C1,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4782C4,
-0xFF4782C4,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4686C6,
-0xFF4787C7,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4688C5,
-0xFF4688C5,
-0xFF4686C4,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4888C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4A8ACA,
-0xFF4A8ACA,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4989C7,
-0xFF4B88C7,
-0xFF4989C6,
-0xFF4989C6,
-0xFF468AC7,
-0xFF468AC7,
-0xFF478BCA,
-0xFF478BCA,
-0xFF478BCA,
-0xFF4B8DCA,
-0xFF4383C0,
-0xFF67A5E0,
-0xFF4A85BF,
-0xFF4E8BC4,
-0xFF4889BF,
-0xFF468BC6,
-0xFF468BCE,
-0xFF4489CE,
-0xFF488CCD,
-0xFF4789C5,
-0xFF4C8BC0,
-0xFF4D8AC1,
-0xFF4B87C6,
-0xFF5D87B9,
-0xFF6B747D,
-0xFF7F7F63,
-0xFF86955A,
-0xFF869B4C,
-0xFFABBA69,
-0xFF6F812D,
-0xFF6F8634,
-0xFF6E8734,
-0xFF6E8733,
-0xFF728B2D,
-0xFFB6CE5C,
-0xFFA9BD44,
-0xFF9FAB3B,
-0xFFB7BC55,
-0xFFD3CF76,
-0xFF957538,
-0xFF651401,
-0xFF922425,
-0xFFAA302B,
-0xFFAF342F,
-0xFF9E2A2D,
-0xFF62233E,
-0xFF2E569B,
-0xFF0551A5,
-0xFF1B4994,
-0xFF313B76,
-0xFF452348,
-0xFF350E2D,
-0xFF58517A,
-0xFF748CBC,
-0xFF5586C0,
-0xFF4A8AC8,
-0xFF498ACA,
-0xFF468BCC,
-0xFF438DCE,
-0xFF428ECA,
-0xFF428FC5,
-0xFF438FC3,
-0xFF478CC7,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF468AC7,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF478BC8,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF468AC7,
-0xFF478BC8,
-0xFF478BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4789C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C6,
-0xFF4589C8,
-0xFF4589C8,
-0xFF4488C7,
-0xFF4488C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4687C7,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4483C6,
-0xFF4382C5,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4281C4,
-0xFF4180C3,
-0xFF407FC2,
-0xFF407FC2,
-0xFF3F7EC1,
-0xFF3F7EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF407DC0,
-0xFF407DC0,
-0xFF407DC0,
-0xFF3F7CBF,
-0xFF417CC0,
-0xFF407BBF,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF4079BC,
-0xFF4079BC,
-0xFF3F78BB,
-0xFF3E77BA,
-0xFF3E70B7,
-0xFF3C71B7,
-0xFF3B72B5,
-0xFF3C73B6,
-0xFF3B75B5,
-0xFF3B75B5,
-0xFF3C75B8,
-0xFF3E75B8,
-0xFF3F74B8,
-0xFF4274B9,
-0xFF4274B9,
-0xFF4375BA,
-0xFF4176BA,
-0xFF4077B8,
-0xFF4178B8,
-0xFF3F79B8,
-0xFF3F79B9,
-0xFF3F7ABC,
-0xFF4079BC,
-0xFF3F7ABC,
-0xFF3F7ABC,
-0xFF407BBD,
-0xFF417CBE,
-0xFF427DBF,
-0xFF427DBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF4080C0,
-0xFF4080C0,
-0xFF4181C1,
-0xFF4380BF,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4783C2,
-0xFF4783C2,
-0xFF4783C2,
-0xFF4783C2,
-0xFF4783C2,
-0xFF4783C2,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4A87C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488AC7,
-0xFF488AC7,
-0xFF498BC8,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498ACA,
-0xFF4A8ACA,
-0xFF4C89C8,
-0xFF4D89C8,
-0xFF4C8AC7,
-0xFF498BC7,
-0xFF468CC8,
-0xFF438EC8,
-0xFF468DCB,
-0xFF438AC8,
-0xFF478DCB,
-0xFF468AC9,
-0xFF5F9FDC,
-0xFF4F8DC8,
-0xFF4F8AC4,
-0xFF4886BF,
-0xFF478CC3,
-0xFF458BC6,
-0xFF478ACE,
-0xFF4689CD,
-0xFF468BC6,
-0xFF4B8CC4,
-0xFF4F8BC1,
-0xFF4B82BA,
-0xFF72A8E4,
-0xFF81A9DA,
-0xFF2C3852,
-0xFF595C53,
-0xFF8B9D61,
-0xFF849C46,
-0xFFACC06B,
-0xFF738732,
-0xFF728B37,
-0xFF6C8935,
-0xFF6C8935,
-0xFF688227,
-0xFFAABD54,
-0xFFAABB49,
-0xFFB1BF4D,
-0xFFC2CE60,
-0xFFB9BD5E,
-0xFF896B2B,
-0xFF802918,
-0xFF932528,
-0xFF821B16,
-0xFF6F0704,
-0xFF7D1015,
-0xFF551633,
-0xFF284A8A,
-0xFF0957AC,
-0xFF0B51A9,
-0xFF1F4B96,
-0xFF393768,
-0xFF482B49,
-0xFF350F26,
-0xFF655570,
-0xFF6D8FBF,
-0xFF4D8BC6,
-0xFF4A8AC7,
-0xFF468AC7,
-0xFF408AC9,
-0xFF4692CE,
-0xFF3F8CC2,
-0xFF4692C6,
-0xFF478DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF468AC7,
-0xFF478CC7,
-0xFF478CC7,
-0xFF478CC7,
-0xFF478CC7,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4789C6,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4889C9,
-0xFF4889C9,
-0xFF4788C8,
-0xFF4788C8,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4380C1,
-0xFF4080C0,
-0xFF4181C1,
-0xFF3F80C0,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF407DC0,
-0xFF407DC0,
-0xFF417CC0,
-0xFF417CC0,
-0xFF417CC0,
-0xFF407BBF,
-0xFF3F7ABE,
-0xFF3E79BD,
-0xFF3F71B8,
-0xFF3D72B8,
-0xFF3D74B7,
-0xFF3B74B7,
-0xFF3C76B6,
-0xFF3B77B6,
-0xFF3D76B9,
-0xFF3F76B9,
-0xFF4075B9,
-0xFF4274B9,
-0xFF4475BA,
-0xFF4375BA,
-0xFF4176B8,
-0xFF4077B8,
-0xFF3F79B8,
-0xFF407AB9,
-0xFF3F7BBA,
-0xFF3F7ABC,
-0xFF407BBD,
-0xFF407BBD,
-0xFF407BBD,
-0xFF417CBE,
-0xFF427DBF,
-0xFF427DBF,
-0xFF417EBF,
-0xFF417EBF,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4181C1,
-0xFF4181C1,
-0xFF4380BF,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4783C2,
-0xFF4783C2,
-0xFF4884C3,
-0xFF4884C3,
-0xFF4985C3,
-0xFF4886C3,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4989C7,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498ACA,
-0xFF498BC8,
-0xFF4A8AC8,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4A8CC8,
-0xFF478DC8,
-0xFF468EC9,
-0xFF458DC8,
-0xFF488FCD,
-0xFF4187C5,
-0xFF468AC7,
-0xFF68A8E5,
-0xFF4B89C4,
-0xFF4B88C1,
-0xFF5391CA,
-0xFF458AC1,
-0xFF4990C8,
-0xFF4D8ED0,
-0xFF498ACA,
-0xFF498BC5,
-0xFF4485BB,
-0xFF5A96CC,
-0xFF7AB3EA,
-0xFF568EC7,
-0xFF5886B8,
-0xFF556B92,
-0xFF243235,
-0xFF849760,
-0xFF839742,
-0xFFBCCE78,
-0xFF7F933C,
-0xFF708935,
-0xFF6E8B37,
-0xFF6B8834,
-0xFF6B852C,
-0xFF90A23E,
-0xFFB7C75C,
-0xFFADBE4E,
-0xFFA3B046,
-0xFFABB054,
-0xFF876E2E,
-0xFF631000,
-0xFF730609,
-0xFF740E09,
-0xFF77110D,
-0xFF962D34,
-0xFF4B102E,
-0xFF2B5094,
-0xFF0459B3,
-0xFF0050B0,
-0xFF0E50A7,
-0xFF325090,
-0xFF332B54,
-0xFF532436,
-0xFF3E1324,
-0xFF5F6386,
-0xFF7193C3,
-0xFF5886C1,
-0xFF508CCA,
-0xFF4B91CD,
-0xFF438FC9,
-0xFF4692C6,
-0xFF458EC3,
-0xFF4990C8,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488DC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488AC7,
-0xFF488AC7,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498ACA,
-0xFF498ACA,
-0xFF4889C9,
-0xFF4889C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4787C7,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4481C2,
-0xFF4380C1,
-0xFF4181C1,
-0xFF4081C1,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF407FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417CC0,
-0xFF417CC0,
-0xFF417CC0,
-0xFF417CC0,
-0xFF407BBF,
-0xFF3F7ABE,
-0xFF3E73B7,
-0xFF3E73B7,
-0xFF3D74B7,
-0xFF3C75B8,
-0xFF3C76B6,
-0xFF3C78B7,
-0xFF3D76B9,
-0xFF3F76B9,
-0xFF4075BB,
-0xFF4176BC,
-0xFF4375BC,
-0xFF4476BB,
-0xFF4277B9,
-0xFF4178B9,
-0xFF407AB9,
-0xFF407AB9,
-0xFF407CBB,
-0xFF407BBD,
-0xFF417CBE,
-0xFF417CBE,
-0xFF427DBF,
-0xFF427DBF,
-0xFF417EBF,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4784C5,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4987C4,
-0xFF4987C4,
-0xFF4986C5,
-0xFF4787C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF478BC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF4A8CC9,
-0xFF488CC9,
-0xFF478DC9,
-0xFF478FC9,
-0xFF488ECA,
-0xFF498DCA,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF468AC7,
-0xFF4B91CD,
-0xFF488EC9,
-0xFF4A8FC8,
-0xFF67A8E2,
-0xFF4687C1,
-0xFF4D8EC6,
-0xFF498AC0,
-0xFF4B8CC4,
-0xFF4D8EC6,
-0xFF4C8CC9,
-0xFF4C8DC7,
-0xFF4B8CC4,
-0xFF70B1E7,
-0xFF67A4DA,
-0xFF4887BD,
-0xFF498BC5,
-0xFF4D88C0,
-0xFF668CBB,
-0xFF102A37,
-0xFF94A37A,
-0xFF939E52,
-0xFFE5EF99,
-0xFF8C9A42,
-0xFF738B35,
-0xFF718F39,
-0xFF6A8733,
-0xFF6F8930,
-0xFF768B26,
-0xFFAABB51,
-0xFF9FAE47,
-0xFF929D3F,
-0xFF999C4B,
-0xFF5F4610,
-0xFF611807,
-0xFF720A09,
-0xFF800B04,
-0xFFA02D28,
-0xFF80181F,
-0xFF431434,
-0xFF24569F,
-0xFF0060BF,
-0xFF045DC1,
-0xFF0D5CBB,
-0xFF114FA2,
-0xFF324A86,
-0xFF42223A,
-0xFF561E29,
-0xFF401425,
-0xFF796686,
-0xFF798CC4,
-0xFF5986C7,
-0xFF4D8BC6,
-0xFF488FC7,
-0xFF4A91C7,
-0xFF4B92C8,
-0xFF4A8FC8,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498EC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF478BC8,
-0xFF478BC8,
-0xFF478BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488AC7,
-0xFF498ACA,
-0xFF498ACA,
-0xFF4A8ACA,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4686C4,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4582C3,
-0xFF4383C3,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4181C1,
-0xFF4181C1,
-0xFF4181C1,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427DC1,
-0xFF427DC1,
-0xFF417CC0,
-0xFF407BBF,
-0xFF3E73B7,
-0xFF3E73B7,
-0xFF3E75B8,
-0xFF3E75B8,
-0xFF3D77B7,
-0xFF3C78B7,
-0xFF3E77BA,
-0xFF3E77BA,
-0xFF4076BC,
-0xFF4176BC,
-0xFF4277BD,
-0xFF4277BD,
-0xFF4279BC,
-0xFF407ABA,
-0xFF407ABA,
-0xFF407CBB,
-0xFF407CBB,
-0xFF417CBE,
-0xFF427DBF,
-0xFF437EC0,
-0xFF437EC0,
-0xFF437EC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4987C4,
-0xFF4A88C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4C8CCA,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF4A8FCA,
-0xFF498FCA,
-0xFF4691CA,
-0xFF4691CB,
-0xFF4690CD,
-0xFF498FCB,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF4D8DCA,
-0xFF4C8EC8,
-0xFF4588BF,
-0xFF478ABF,
-0xFF67AAE1,
-0xFF4A8DC4,
-0xFF4E91C8,
-0xFF4E8FC5,
-0xFF518FC8,
-0xFF4E8BC4,
-0xFF4685BB,
-0xFF5D9CD2,
-0xFF71B2EA,
-0xFF4F90C6,
-0xFF4788BE,
-0xFF4D90C7,
-0xFF4890CB,
-0xFF5095CE,
-0xFF5E96C9,
-0xFF22465E,
-0xFF566347,
-0xFFE1E3A4,
-0xFFDCE191,
-0xFF9AA44D,
-0xFF768832,
-0xFF748D39,
-0xFF6C8A34,
-0xFF6E8B31,
-0xFF728B26,
-0xFF92A742,
-0xFF8EA241,
-0xFF8D9943,
-0xFF918E49,
-0xFF4A2A00,
-0xFF590A00,
-0xFF8C1E1D,
-0xFFA72A24,
-0xFF98211D,
-0xFF6C0D15,
-0xFF411F40,
-0xFF1B59A4,
-0xFF0870CF,
-0xFF025EC1,
-0xFF004CAC,
-0xFF0352AE,
-0xFF164891,
-0xFF453F6B,
-0xFF491F33,
-0xFF601E28,
-0xFF4D1425,
-0xFF5D4C78,
-0xFF7083BB,
-0xFF5B8CC6,
-0xFF4E8FC9,
-0xFF4C8EC8,
-0xFF488DC6,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498ACA,
-0xFF498ACA,
-0xFF4A8ACA,
-0xFF4A8ACA,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4989C9,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C7,
-0xFF4787C7,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4683C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4181C1,
-0xFF4380C3,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF427DC1,
-0xFF427DC1,
-0xFF427DC1,
-0xFF417CC0,
-0xFF3F74B8,
-0xFF3F74B8,
-0xFF3E75B6,
-0xFF3F76B7,
-0xFF3E78B8,
-0xFF3E78B8,
-0xFF3F78BB,
-0xFF3F78BB,
-0xFF4177BD,
-0xFF4177BD,
-0xFF4177BD,
-0xFF4278BE,
-0xFF4279BC,
-0xFF417BBB,
-0xFF417BBB,
-0xFF407CBB,
-0xFF417DBC,
-0xFF417EBD,
-0xFF427FBE,
-0xFF427FBE,
-0xFF427FBE,
-0xFF427FBE,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4986C7,
-0xFF4986C7,
-0xFF4787C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4C89C8,
-0xFF4C89C8,
-0xFF4C89C8,
-0xFF4C89C8,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC9,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4C8CCA,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498EC9,
-0xFF498EC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A91C9,
-0xFF4992C9,
-0xFF4991CB,
-0xFF4792CC,
-0xFF4692CE,
-0xFF4791CE,
-0xFF4B8FCC,
-0xFF4E8ECB,
-0xFF4F8BC7,
-0xFF508DC4,
-0xFF5392C7,
-0xFF5A9DD1,
-0xFF5298CC,
-0xFF4A90C4,
-0xFF4E8FC7,
-0xFF4D8BC4,
-0xFF518CC6,
-0xFF528DC5,
-0xFF77B5E8,
-0xFF62A1D4,
-0xFF4E8CC5,
-0xFF4F90CA,
-0xFF4D90C5,
-0xFF488FC5,
-0xFF4490CA,
-0xFF4792CC,
-0xFF5095CC,
-0xFF305E7F,
-0xFF232D22,
-0xFFDBD4A8,
-0xFFE2E39D,
-0xFFA6AE59,
-0xFF798531,
-0xFF7A8E37,
-0xFF6C8D34,
-0xFF6B8E32,
-0xFF748D31,
-0xFF7E953A,
-0xFF799639,
-0xFF768834,
-0xFF958A4C,
-0xFF4B1700,
-0xFF932E24,
-0xFF9F2124,
-0xFF971714,
-0xFF82100F,
-0xFF7C2B34,
-0xFF402C4F,
-0xFF1F64AF,
-0xFF0E7AD5,
-0xFF004FAC,
-0xFF0050AC,
-0xFF0559B3,
-0xFF1054A9,
-0xFF21478E,
-0xFF312F5E,
-0xFF531927,
-0xFF5F1418,
-0xFF470E21,
-0xFF3B254B,
-0xFF7794CC,
-0xFF508ACA,
-0xFF5292CF,
-0xFF4E90CC,
-0xFF4C91CC,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488AC7,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C6,
-0xFF4686C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4282C2,
-0xFF4282C2,
-0xFF4380C1,
-0xFF4380C1,
-0xFF4380C1,
-0xFF427FC0,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF417EC1,
-0xFF3F74B8,
-0xFF3F74B6,
-0xFF3E75B6,
-0xFF3F76B7,
-0xFF4077B8,
-0xFF3E78B8,
-0xFF3F78BB,
-0xFF3F78BB,
-0xFF4278BE,
-0xFF4278BE,
-0xFF4278BE,
-0xFF4079BE,
-0xFF417ABD,
-0xFF417CBE,
-0xFF417DBC,
-0xFF417DBC,
-0xFF417EBD,
-0xFF427FBE,
-0xFF427FBE,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4986C7,
-0xFF4986C7,
-0xFF4A87C8,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4C89C8,
-0xFF4C89C8,
-0xFF4C89C8,
-0xFF4D8AC9,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4C8CCA,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4C8CCA,
-0xFF4C8CCA,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4C8CCA,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498EC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90C9,
-0xFF4B92C8,
-0xFF4B92CA,
-0xFF4A92CC,
-0xFF4893CD,
-0xFF4793CF,
-0xFF4793CF,
-0xFF4893CD,
-0xFF4C91CC,
-0xFF5592C9,
-0xFF528EC2,
-0xFF4E8CBF,
-0xFF6BAADD,
-0xFF4B8DBF,
-0xFF5295C9,
-0xFF4A8BC1,
-0xFF508EC7,
-0xFF659DD8,
-0xFF74AFE7,
-0xFF4D8CBF,
-0xFF5092C4,
-0xFF4F8DC8,
-0xFF4A8AC7,
-0xFF4F92C9,
-0xFF4C93C9,
-0xFF4994CB,
-0xFF4491C9,
-0xFF4B93CD,
-0xFF5286AE,
-0xFF192227,
-0xFFA49B7E,
-0xFFE9E9AD,
-0xFFB3BA6A,
-0xFF7C8532,
-0xFF798C33,
-0xFF6F8D33,
-0xFF73963C,
-0xFF718D38,
-0xFF748E37,
-0xFF78953B,
-0xFF8A9546,
-0xFFC2A86F,
-0xFF692403,
-0xFF96241A,
-0xFF990E11,
-0xFF9C1210,
-0xFF7F0E12,
-0xFF602333,
-0xFF3F416A,
-0xFF2F7BC7,
-0xFF0066C1,
-0xFF0053B0,
-0xFF0058B2,
-0xFF075CB6,
-0xFF0652A8,
-0xFF114EA1,
-0xFF2E4885,
-0xFF3B1D35,
-0xFF400B13,
-0xFF3C0F23,
-0xFF231435,
-0xFF3B5A90,
-0xFF5B97D5,
-0xFF4D8FCC,
-0xFF4B90CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B8FCC,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4A8ECB,
-0xFF4B8DCA,
-0xFF4B8DCA,
-0xFF4C8ECB,
-0xFF4C8ECB,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C8,
-0xFF4888C8,
-0xFF4986C7,
-0xFF4986C7,
-0xFF4986C7,
-0xFF4986C7,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4380C1,
-0xFF4380C3,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF427FC2,
-0xFF417EC1,
-0xFF4176B8,
-0xFF4176B8,
-0xFF4176B8,
-0xFF4077B7,
-0xFF4077B7,
-0xFF4178B8,
-0xFF3F79B9,
-0xFF3F78BB,
-0xFF417ABF,
-0xFF417ABF,
-0xFF417ABF,
-0xFF427BC0,
-0xFF437CBF,
-0xFF427DBF,
-0xFF437FBE,
-0xFF417EBD,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4380BF,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4D8AC9,
-0xFF4D8AC9,
-0xFF4D8AC9,
-0xFF4D8AC9,
-0xFF4D8AC9,
-0xFF4D8AC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4C8CC9,
-0xFF4B8DC9,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CA,
-0xFF4E91C8,
-0xFF4C91C8,
-0xFF4B91CC,
-0xFF4A92CD,
-0xFF4893CD,
-0xFF4893CD,
-0xFF4793CD,
-0xFF4893CA,
-0xFF4A8EBF,
-0xFF5694C3,
-0xFF4D8AB9,
-0xFF72ACDE,
-0xFF548CBF,
-0xFF518ABF,
-0xFF5190C6,
-0xFF72B3EB,
-0xFF66A1DB,
-0xFF4B88BF,
-0xFF5395C7,
-0xFF4D90C4,
-0xFF4E8ECB,
-0xFF5494D1,
-0xFF4A8DC4,
-0xFF4C92C6,
-0xFF488FC3,
-0xFF5097CB,
-0xFF4D94CC,
-0xFF6396C3,
-0xFF2F3A4E,
-0xFF6F695D,
-0xFFE7E9B7,
-0xFFBCC479,
-0xFF768530,
-0xFF788D32,
-0xFF769035,
-0xFF79973F,
-0xFF739340,
-0xFF748F3E,
-0xFF839A42,
-0xFFC4C172,
-0xFFB98A52,
-0xFF741E00,
-0xFF8C1205,
-0xFF990908,
-0xFFA5090A,
-0xFF9A2430,
-0xFF573452,
-0xFF4B6AA0,
-0xFF1865B7,
-0xFF005ABB,
-0xFF005BBB,
-0xFF0E6DC9,
-0xFF0258AD,
-0xFF004896,
-0xFF1655A2,
-0xFF083473,
-0xFF0F224A,
-0xFF566181,
-0xFF7C94BA,
-0xFF7399C6,
-0xFF5993C5,
-0xFF4D92C9,
-0xFF4992C9,
-0xFF4F97D1,
-0xFF4C93CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF498EC9,
-0xFF498EC9,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4683C4,
-0xFF4582C3,
-0xFF4481C2,
-0xFF4380C1,
-0xFF4380C1,
-0xFF427FC0,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4479BB,
-0xFF447ABA,
-0xFF447ABA,
-0xFF447ABA,
-0xFF447ABA,
-0xFF437ABA,
-0xFF437ABB,
-0xFF417BBB,
-0xFF427BBE,
-0xFF427BC0,
-0xFF427BC0,
-0xFF417CC0,
-0xFF437EC0,
-0xFF437EC0,
-0xFF4380BF,
-0xFF427FBE,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4888C6,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4B8BC9,
-0xFF4E8BCA,
-0xFF4E8BCA,
-0xFF4E8BCA,
-0xFF4E8BCA,
-0xFF4E8BCA,
-0xFF4E8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4D8DCA,
-0xFF4C8ECA,
-0xFF4D8FCB,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CB,
-0xFF4F90C8,
-0xFF4E91C8,
-0xFF4C91CA,
-0xFF4B91CC,
-0xFF4A92CD,
-0xFF4994CE,
-0xFF4994CD,
-0xFF4995C9,
-0xFF5298C9,
-0xFF4E8EBC,
-0xFF5892C0,
-0xFF77ADDC,
-0xFF578BBD,
-0xFF6BA2D8,
-0xFF7AB9EF,
-0xFF5192CA,
-0xFF5391CA,
-0xFF5796CC,
-0xFF4E91C5,
-0xFF4E91C6,
-0xFF5292CF,
-0xFF4D8DCA,
-0xFF5192CA,
-0xFF4E91C6,
-0xFF4E92C3,
-0xFF4C8FC3,
-0xFF4F92C9,
-0xFF5F92C1,
-0xFF4F5E7D,
-0xFF4B4B4B,
-0xFFDADDB2,
-0xFFD5DC96,
-0xFF768532,
-0xFF81963B,
-0xFF7C973A,
-0xFF6D8B31,
-0xFF72923F,
-0xFF6E8B39,
-0xFF778B32,
-0xFFD7CA7C,
-0xFFB16B37,
-0xFF912204,
-0xFFA41A0D,
-0xFFB81E1C,
-0xFFC32323,
-0xFFA63A4A,
-0xFF423F6C,
-0xFF316CB0,
-0xFF1363B8,
-0xFF0B66C3,
-0xFF0C6BC7,
-0xFF0054AC,
-0xFF004290,
-0xFF0B4F98,
-0xFF00387F,
-0xFF336DAC,
-0xFF6A9CCD,
-0xFF6396C3,
-0xFF5692C4,
-0xFF5092C4,
-0xFF5295C9,
-0xFF4E95C9,
-0xFF4D96CD,
-0xFF4A92CC,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8ECB,
-0xFF498DCA,
-0xFF498DCA,
-0xFF488CC9,
-0xFF488CC9,
-0xFF488CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4986C7,
-0xFF4986C7,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4885C6,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4784C5,
-0xFF4683C4,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4380C1,
-0xFF4380C1,
-0xFF427FC0,
-0xFF427FC0,
-0xFF4C7FC0,
-0xFF4A7DBC,
-0xFF497CBB,
-0xFF487BBA,
-0xFF477AB9,
-0xFF4379B7,
-0xFF4379B9,
-0xFF437ABB,
-0xFF437CBF,
-0xFF437CBF,
-0xFF427DC1,
-0xFF427DC1,
-0xFF437EC0,
-0xFF4380C1,
-0xFF4380BF,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4885C4,
-0xFF4A87C6,
-0xFF4B88C7,
-0xFF4A87C6,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4888C5,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4D8DCA,
-0xFF4C8CC9,
-0xFF4B8BC8,
-0xFF4C8CC9,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4E8FC9,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4C8EC8,
-0xFF4C8EC8,
-0xFF4C8EC8,
-0xFF4C8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4C8EC8,
-0xFF4B90C9,
-0xFF4B90C9,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4B92CA,
-0xFF4B92CA,
-0xFF4B90C9,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF5293CB,
-0xFF4F90C6,
-0xFF5495CD,
-0xFF4D92CB,
-0xFF4993D0,
-0xFF4994CE,
-0xFF5196CD,
-0xFF4D93C6,
-0xFF4B93C5,
-0xFF4D8FBF,
-0xFF79AFDB,
-0xFF6497C4,
-0xFF81B4E9,
-0xFF6BA4DB,
-0xFF5996CD,
-0xFF5899CF,
-0xFF5A9BD1,
-0xFF5A9DD2,
-0xFF579DD1,
-0xFF579AD1,
-0xFF5899D3,
-0xFF5C9AD5,
-0xFF5D9BD4,
-0xFF5A9BD1,
-0xFF5B9DCF,
-0xFF61A0D3,
-0xFF61A0D6,
-0xFF699BCE,
-0xFF7A91BA,
-0xFF48505B,
-0xFFE1E1BD,
-0xFFD6D795,
-0xFF869143,
-0xFF7C9037,
-0xFF718C2F,
-0xFF6F8E31,
-0xFF6B8933,
-0xFF68842F,
-0xFF647B21,
-0xFFD6C577,
-0xFFA54A1B,
-0xFFAF230A,
-0xFFC62218,
-0xFFCB2320,
-0xFFB82221,
-0xFF7E2B3F,
-0xFF385694,
-0xFF156BBE,
-0xFF0F65B8,
-0xFF0759AB,
-0xFF004DA0,
-0xFF00408E,
-0xFF00327A,
-0xFF0F4A8C,
-0xFF5F9FDD,
-0xFF5698D2,
-0xFF5294C6,
-0xFF5294C4,
-0xFF5294C6,
-0xFF5294C8,
-0xFF5293C9,
-0xFF5293CB,
-0xFF5193CD,
-0xFF5294D0,
-0xFF5193CD,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5092CC,
-0xFF5092CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5193CD,
-0xFF5193CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF498EC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF498BC7,
-0xFF498BC7,
-0xFF488AC6,
-0xFF488AC6,
-0xFF488AC7,
-0xFF488AC7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4585C3,
-0xFF4585C3,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF4282C2,
-0xFF4181C1,
-0xFF5183C2,
-0xFF4D81BD,
-0xFF4C7EBB,
-0xFF4D81BD,
-0xFF4D7FBC,
-0xFF497CBB,
-0xFF477AB9,
-0xFF447ABA,
-0xFF457CBD,
-0xFF437CBF,
-0xFF437EC2,
-0xFF437EC0,
-0xFF4380C1,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4C89C8,
-0xFF4C89C8,
-0xFF4B88C7,
-0xFF4A87C6,
-0xFF4B89C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4D8EC8,
-0xFF4C8EC8,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4E8FC9,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4D8FC9,
-0xFF4D8FC9,
-0xFF4B90C9,
-0xFF4B90C9,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4B92CA,
-0xFF4B92CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CA,
-0xFF5093C8,
-0xFF5697CD,
-0xFF4F90C8,
-0xFF5193CD,
-0xFF4E96D1,
-0xFF4E96D0,
-0xFF4B8EC3,
-0xFF5193C5,
-0xFF5A99CC,
-0xFF4E8BBA,
-0xFFAEE2FF,
-0xFF77ABDA,
-0xFF558DC0,
-0xFF528EC4,
-0xFF5491C8,
-0xFF5192C8,
-0xFF4E94C8,
-0xFF4F95C9,
-0xFF4E93CA,
-0xFF4F92C9,
-0xFF5290C9,
-0xFF5492CB,
-0xFF5492CB,
-0xFF5492CB,
-0xFF5496CA,
-0xFF5190C5,
-0xFF5592C9,
-0xFF5A8DC2,
-0xFF7191C0,
-0xFF3E4D60,
-0xFFD4D3B4,
-0xFFCBC788,
-0xFF4C5709,
-0xFF71852E,
-0xFF6F892E,
-0xFF678428,
-0xFF69832A,
-0xFF6C842C,
-0xFF5E751B,
-0xFFB8A257,
-0xFFA3360D,
-0xFFC62712,
-0xFFCC1B11,
-0xFFBE1C19,
-0xFFA63235,
-0xFF562845,
-0xFF2E62AD,
-0xFF0764C1,
-0xFF0152A4,
-0xFF004290,
-0xFF044692,
-0xFF003179,
-0xFF467DC0,
-0xFF689FDF,
-0xFF518FCA,
-0xFF5194CB,
-0xFF4F95C9,
-0xFF4E96C8,
-0xFF4E95C9,
-0xFF4F94CB,
-0xFF5295CC,
-0xFF5394CE,
-0xFF5593CE,
-0xFF5394CE,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5193CD,
-0xFF5193CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF498BC7,
-0xFF498BC7,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4585C5,
-0xFF4585C5,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4484C4,
-0xFF4383C3,
-0xFF4383C3,
-0xFF5181BF,
-0xFF4C7EB9,
-0xFF4D7EB9,
-0xFF5183BE,
-0xFF5384BF,
-0xFF4F81BE,
-0xFF4A7EBA,
-0xFF477DBB,
-0xFF457CBD,
-0xFF437DBD,
-0xFF437EC0,
-0xFF4481C2,
-0xFF4481C2,
-0xFF4582C1,
-0xFF4682C1,
-0xFF4682C0,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4683C2,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4A88C5,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4C8AC7,
-0xFF4D8BC8,
-0xFF4E8CC9,
-0xFF4D8BC6,
-0xFF4C8AC5,
-0xFF4D8BC6,
-0xFF4C8DC7,
-0xFF4B8CC6,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4D8EC8,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4E8FC9,
-0xFF4E8FC9,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4E90CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C93CB,
-0xFF4B92CA,
-0xFF4B92CA,
-0xFF4B92CA,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4D92C9,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5396CB,
-0xFF4D90C5,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF5396CB,
-0xFF4E91C6,
-0xFF5698D2,
-0xFF5693CA,
-0xFF5587BA,
-0xFF306090,
-0xFF3870A1,
-0xFF538FC1,
-0xFF5593C2,
-0xFF5997C8,
-0xFF5493C9,
-0xFF4F92C9,
-0xFF4E95C9,
-0xFF4E96C8,
-0xFF5194C9,
-0xFF5192C8,
-0xFF5491C7,
-0xFF5592C9,
-0xFF5492CD,
-0xFF5293CD,
-0xFF5194CB,
-0xFF5192CA,
-0xFF5997D0,
-0xFF5C93CB,
-0xFF6691C4,
-0xFF4D657D,
-0xFFB3AF92,
-0xFFE8E3A3,
-0xFF778536,
-0xFF6B832D,
-0xFF6A8129,
-0xFF768A31,
-0xFF6F862C,
-0xFF6C832B,
-0xFF6A7926,
-0xFFA18241,
-0xFF951A00,
-0xFFC51B0C,
-0xFFC5190B,
-0xFFAB2420,
-0xFF692A3D,
-0xFF444677,
-0xFF225CAE,
-0xFF0657B3,
-0xFF07489C,
-0xFF00357F,
-0xFF145096,
-0xFF5E9BDE,
-0xFF5794D7,
-0xFF5691D3,
-0xFF5C94CF,
-0xFF5992C9,
-0xFF5693CA,
-0xFF5295CA,
-0xFF4C97CE,
-0xFF4B98D0,
-0xFF4F95D0,
-0xFF5294D0,
-0xFF5394CE,
-0xFF5394CC,
-0xFF5295CC,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5092CC,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5193CD,
-0xFF5092CC,
-0xFF5092CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4B90C9,
-0xFF4B90C9,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4A8FCA,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF498BC7,
-0xFF498BC7,
-0xFF498BC7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4686C4,
-0xFF4686C4,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4683C4,
-0xFF4683C4,
-0xFF5283BE,
-0xFF5081BB,
-0xFF5182BC,
-0xFF5788C2,
-0xFF5A88C3,
-0xFF5384BF,
-0xFF4E80BB,
-0xFF4D81BD,
-0xFF477EBE,
-0xFF457FBF,
-0xFF4581C0,
-0xFF4481C0,
-0xFF4582C1,
-0xFF4583C0,
-0xFF4682C0,
-0xFF4783C1,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4784C3,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4C8AC7,
-0xFF4E8CC9,
-0xFF518FCA,
-0xFF508EC9,
-0xFF4E8CC7,
-0xFF4D8BC6,
-0xFF4E8CC7,
-0xFF4C8DC7,
-0xFF4C8DC7,
-0xFF4D8DCA,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4D8EC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF508EC9,
-0xFF518FCA,
-0xFF4F90CA,
-0xFF4E8FC9,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF5091CB,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF5091CB,
-0xFF5091CB,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4E90CA,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4D94CC,
-0xFF4D94CC,
-0xFF4C93CB,
-0xFF4C93CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5093C8,
-0xFF4E94C8,
-0xFF4F96CE,
-0xFF4D94CA,
-0xFF5092C6,
-0xFF5594C9,
-0xFF5693CC,
-0xFF5089C0,
-0xFF83B2E6,
-0xFF386899,
-0xFF5E97CC,
-0xFF5291C4,
-0xFF5898C8,
-0xFF5395C7,
-0xFF4D8EC4,
-0xFF5396CD,
-0xFF4F96CA,
-0xFF5096C9,
-0xFF5295CA,
-0xFF5594C9,
-0xFF5693C9,
-0xFF5794CB,
-0xFF5495CF,
-0xFF5294D0,
-0xFF5095CE,
-0xFF5294CE,
-0xFF4F90CA,
-0xFF5691CB,
-0xFF5A8EC7,
-0xFF6486A2,
-0xFF908E77,
-0xFFECE3A8,
-0xFF7A883B,
-0xFF6D852F,
-0xFF768A35,
-0xFF6E822B,
-0xFF6E852B,
-0xFF748831,
-0xFF71792E,
-0xFF704711,
-0xFFB1301B,
-0xFFC01B15,
-0xFFB01910,
-0xFF953034,
-0xFF35254A,
-0xFF2E5493,
-0xFF1455A7,
-0xFF004197,
-0xFF002874,
-0xFF316AAD,
-0xFF619FDC,
-0xFF5597D3,
-0xFF5192D2,
-0xFF4F8FCD,
-0xFF5C94CD,
-0xFF5992C7,
-0xFF5794CA,
-0xFF5196CD,
-0xFF4D98CF,
-0xFF4D98CF,
-0xFF5196CF,
-0xFF5395CF,
-0xFF5495CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5294CE,
-0xFF5193CD,
-0xFF5193CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4C91CA,
-0xFF4C91CA,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4D8FCB,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF498BC7,
-0xFF498BC7,
-0xFF498BC7,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B8BC9,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4787C5,
-0xFF4787C5,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4885C4,
-0xFF4784C5,
-0xFF4683C4,
-0xFF5A88C3,
-0xFF5B8AC2,
-0xFF5F8EC6,
-0xFF6493CB,
-0xFF6390C9,
-0xFF5A88C3,
-0xFF5283BE,
-0xFF5183C0,
-0xFF4B81BF,
-0xFF4882C1,
-0xFF4682C1,
-0xFF4582C1,
-0xFF4582C1,
-0xFF4583C0,
-0xFF4783C1,
-0xFF4884C0,
-0xFF4785C2,
-0xFF4785C2,
-0xFF4785C2,
-0xFF4886C3,
-0xFF4886C3,
-0xFF4987C4,
-0xFF4987C4,
-0xFF4987C4,
-0xFF4A88C5,
-0xFF4A88C5,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4D8BC8,
-0xFF4C8AC7,
-0xFF4C8AC5,
-0xFF4D8BC6,
-0xFF518FCA,
-0xFF5391CC,
-0xFF518FCA,
-0xFF4E8CC5,
-0xFF4E8CC5,
-0xFF4F8DC6,
-0xFF4F8DC6,
-0xFF4E8CC5,
-0xFF508EC9,
-0xFF518FCA,
-0xFF518FCA,
-0xFF508EC9,
-0xFF508EC9,
-0xFF508EC7,
-0xFF4F8DC6,
-0xFF508EC7,
-0xFF518FC8,
-0xFF518FC8,
-0xFF4E8FC7,
-0xFF4E8FC7,
-0xFF4E8FC7,
-0xFF4F90C8,
-0xFF5091C9,
-0xFF5091C9,
-0xFF4E91C8,
-0xFF4E91C8,
-0xFF4E91C8,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF5093CA,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF5093CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4D94CA,
-0xFF4D94CA,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5095CC,
-0xFF4F94CB,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4F94CB,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5295CC,
-0xFF4F94CB,
-0xFF5198CC,
-0xFF5299CD,
-0xFF5197CB,
-0xFF5491C7,
-0xFF598CC1,
-0xFF90C2F7,
-0xFF5B92C8,
-0xFF5D96CB,
-0xFF5894C6,
-0xFF5795C6,
-0xFF5698CC,
-0xFF4E94C8,
-0xFF5399CD,
-0xFF5298CC,
-0xFF5096C9,
-0xFF5295C9,
-0xFF5496CA,
-0xFF5695CA,
-0xFF5695CA,
-0xFF5695CB,
-0xFF5395CF,
-0xFF5196CF,
-0xFF5398D1,
-0xFF5398D1,
-0xFF5294D0,
-0xFF5596D0,
-0xFF5A97D0,
-0xFF6B94B4,
-0xFF8E9082,
-0xFFD8D09F,
-0xFF858F46,
-0xFF677B26,
-0xFF758B36,
-0xFF6C862F,
-0xFF6A862F,
-0xFF718433,
-0xFF828043,
-0xFF562500,
-0xFFA72C1D,
-0xFFAB191A,
-0xFF9B282D,
-0xFF5A1F35,
-0xFF3D528B,
-0xFF12509B,
-0xFF064690,
-0xFF002F73,
-0xFF4D8BC8,
-0xFF62A3D9,
-0xFF4D94C8,
-0xFF4B94C7,
-0xFF569DD5,
-0xFF559AD1,
-0xFF5194C8,
-0xFF5599CA,
-0xFF5298CB,
-0xFF5198CC,
-0xFF5298CB,
-0xFF5497CB,
-0xFF5995CB,
-0xFF5995C9,
-0xFF5597C7,
-0xFF5498C7,
-0xFF5497CB,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5193CD,
-0xFF5193CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF488AC7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4989C7,
-0xFF4888C6,
-0xFF4888C6,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4885C4,
-0xFF4784C3,
-0xFF4683C2,
-0xFF5B8AC2,
-0xFF5E8DC3,
-0xFF6592C9,
-0xFF6996CD,
-0xFF6895CE,
-0xFF618EC7,
-0xFF5987C2,
-0xFF5385C0,
-0xFF4D83BF,
-0xFF4984C0,
-0xFF4783C1,
-0xFF4582C1,
-0xFF4583C0,
-0xFF4684C1,
-0xFF4884C0,
-0xFF4985C1,
-0xFF4985C3,
-0xFF4886C3,
-0xFF4886C3,
-0xFF4886C3,
-0xFF4987C4,
-0xFF4987C4,
-0xFF4A88C5,
-0xFF4A88C5,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4D8BC6,
-0xFF4E8CC7,
-0xFF5290CB,
-0xFF5593CE,
-0xFF5492CB,
-0xFF5290C9,
-0xFF508EC7,
-0xFF508EC7,
-0xFF4F8DC6,
-0xFF4F8DC6,
-0xFF508EC9,
-0xFF5290CB,
-0xFF5290CB,
-0xFF518FCA,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5290C9,
-0xFF518FC8,
-0xFF518FC8,
-0xFF518FC8,
-0xFF4F90C8,
-0xFF4E8FC7,
-0xFF4E8FC7,
-0xFF4F90C8,
-0xFF5091C9,
-0xFF5091C9,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4C93C9,
-0xFF4C93C9,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4F94CB,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5196CD,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5196CF,
-0xFF5398CF,
-0xFF4D93C6,
-0xFF5295C9,
-0xFF589BD0,
-0xFF5390C6,
-0xFF87BBED,
-0xFF5B8FC1,
-0xFF5693C9,
-0xFF5796CC,
-0xFF5694C7,
-0xFF5796C9,
-0xFF5497CC,
-0xFF569BD2,
-0xFF5095CC,
-0xFF5298CC,
-0xFF5497CC,
-0xFF5597CB,
-0xFF5597CB,
-0xFF5697CD,
-0xFF5697CF,
-0xFF5497CE,
-0xFF5297CE,
-0xFF5299CF,
-0xFF5295CC,
-0xFF5194CB,
-0xFF559AD3,
-0xFF5297D0,
-0xFF5496D2,
-0xFF6191B7,
-0xFF7F8883,
-0xFFD1CEA5,
-0xFF98A25D,
-0xFF647624,
-0xFF738936,
-0xFF708935,
-0xFF6B852E,
-0xFF768439,
-0xFF847846,
-0xFF3F0700,
-0xFFA02B24,
-0xFF941B24,
-0xFF70283E,
-0xFF46355F,
-0xFF2B5398,
-0xFF00408B,
-0xFF024184,
-0xFF5F9DD8,
-0xFF5D9CD1,
-0xFF5699CD,
-0xFF519BCC,
-0xFF4F9BCD,
-0xFF5198CC,
-0xFF4F95C8,
-0xFF549CCC,
-0xFF4F97C7,
-0xFF519ACD,
-0xFF5299CD,
-0xFF5399CC,
-0xFF5698CA,
-0xFF5A96CA,
-0xFF5A96C8,
-0xFF5698C8,
-0xFF5399CA,
-0xFF5598CC,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5193CD,
-0xFF5193CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CE,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4B90CB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF498BC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4989C7,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4986C5,
-0xFF4986C5,
-0xFF4885C4,
-0xFF4784C3,
-0xFF5683BA,
-0xFF5886BA,
-0xFF5E89BE,
-0xFF638EC3,
-0xFF6691C8,
-0xFF628FC8,
-0xFF5C8AC5,
-0xFF5687C2,
-0xFF4D83BF,
-0xFF4A85C1,
-0xFF4884C2,
-0xFF4884C2,
-0xFF4884C2,
-0xFF4884C2,
-0xFF4A85C1,
-0xFF4985C1,
-0xFF4A86C4,
-0xFF4A86C4,
-0xFF4A86C4,
-0xFF4A86C4,
-0xFF4A88C5,
-0xFF4A88C5,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4C8CC9,
-0xFF4C8AC5,
-0xFF4D8BC6,
-0xFF4E8CC7,
-0xFF4F8DC8,
-0xFF518FC8,
-0xFF5593CC,
-0xFF5896CF,
-0xFF5997D0,
-0xFF5290C9,
-0xFF518FC8,
-0xFF518EC7,
-0xFF508DC6,
-0xFF528FC8,
-0xFF5592CB,
-0xFF5591CD,
-0xFF5490CC,
-0xFF5491CA,
-0xFF5693CC,
-0xFF5794CD,
-0xFF5693CC,
-0xFF5492CB,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5694CD,
-0xFF5192CA,
-0xFF5293CB,
-0xFF5194CB,
-0xFF5093CA,
-0xFF4F92C9,
-0xFF4F92C9,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5194CB,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5093CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4E93CA,
-0xFF4E93CA,
-0xFF4D94CA,
-0xFF4D94CA,
-0xFF4D94CA,
-0xFF4D94CA,
-0xFF4D94CA,
-0xFF4D94CA,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5398D1,
-0xFF4F94CB,
-0xFF5899CF,
-0xFF5392C7,
-0xFF5490C2,
-0xFF83BFF1,
-0xFF5593C4,
-0xFF5D9DCD,
-0xFF5799CB,
-0xFF5698CC,
-0xFF5598CD,
-0xFF579ACF,
-0xFF5194C9,
-0xFF5196CD,
-0xFF569BD2,
-0xFF5396CB,
-0xFF5697CD,
-0xFF5796CC,
-0xFF5597CB,
-0xFF5598CD,
-0xFF5398D3,
-0xFF5197D2,
-0xFF5198CE,
-0xFF5399CC,
-0xFF599BCD,
-0xFF5594C7,
-0xFF5298CB,
-0xFF5198CE,
-0xFF5499D4,
-0xFF6598C3,
-0xFF73868C,
-0xFFBBC2A3,
-0xFFA9B978,
-0xFF657B28,
-0xFF6F8532,
-0xFF70842F,
-0xFF738634,
-0xFF7E8340,
-0xFF5B4722,
-0xFF4F1706,
-0xFF871E1A,
-0xFF8C2F41,
-0xFF37214F,
-0xFF38528F,
-0xFF002B6D,
-0xFF2D69A8,
-0xFF68A6E1,
-0xFF5A99CF,
-0xFF5796CB,
-0xFF5394CA,
-0xFF539AD2,
-0xFF539AD2,
-0xFF5899CF,
-0xFF5294C6,
-0xFF569FCC,
-0xFF529ACA,
-0xFF5499D2,
-0xFF5499D4,
-0xFF539AD0,
-0xFF549ACE,
-0xFF5699CD,
-0xFF5799CD,
-0xFF5699D0,
-0xFF5499D0,
-0xFF5598CD,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5399CD,
-0xFF5399CD,
-0xFF5399CD,
-0xFF5399CD,
-0xFF5399CD,
-0xFF5399CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5596CE,
-0xFF5495CD,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5095CC,
-0xFF5095CC,
-0xFF5095CE,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4C91CC,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC8,
-0xFF4A8CC9,
-0xFF498BC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4A87C6,
-0xFF4A87C6,
-0xFF4A86C5,
-0xFF4985C4,
-0xFF5281B9,
-0xFF5180B6,
-0xFF5281B9,
-0xFF5584BC,
-0xFF5B8AC2,
-0xFF5F8DC8,
-0xFF5B8CC6,
-0xFF5587C2,
-0xFF4D83BF,
-0xFF4C84C1,
-0xFF4A85C1,
-0xFF4985C3,
-0xFF4985C3,
-0xFF4985C3,
-0xFF4A85C1,
-0xFF4985C1,
-0xFF4B87C5,
-0xFF4A88C5,
-0xFF4B87C5,
-0xFF4A88C5,
-0xFF4A88C5,
-0xFF4B89C6,
-0xFF4B89C6,
-0xFF4C8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4C8CC9,
-0xFF4E8CC7,
-0xFF508EC9,
-0xFF508EC9,
-0xFF4F8DC8,
-0xFF508EC7,
-0xFF5391CA,
-0xFF5896CF,
-0xFF5C9AD3,
-0xFF5391CA,
-0xFF5290C9,
-0xFF508EC7,
-0xFF4F8DC6,
-0xFF5390C9,
-0xFF5492CB,
-0xFF5593CE,
-0xFF5492CB,
-0xFF5592CB,
-0xFF5895CC,
-0xFF5A97CE,
-0xFF5A97CE,
-0xFF5895CC,
-0xFF5695CB,
-0xFF5997D0,
-0xFF5C9AD3,
-0xFF5896CF,
-0xFF5697CF,
-0xFF5596CE,
-0xFF5295CC,
-0xFF5093CA,
-0xFF4F92C9,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF5093CA,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5093CA,
-0xFF5093CA,
-0xFF4E93CA,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4E95CB,
-0xFF4F94CB,
-0xFF4E95CB,
-0xFF4F94CB,
-0xFF4E95CB,
-0xFF4F94CB,
-0xFF4E95CB,
-0xFF5095CC,
-0xFF4F96CC,
-0xFF5095CC,
-0xFF4F96CC,
-0xFF5095CC,
-0xFF4E95CB,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5398CF,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5398CF,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5297CE,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5398CF,
-0xFF5297CE,
-0xFF5298CC,
-0xFF5398CF,
-0xFF549ACE,
-0xFF5396CD,
-0xFF589BD0,
-0xFF5A99CF,
-0xFF5490C4,
-0xFF7FB9EB,
-0xFF538FC1,
-0xFF589ACC,
-0xFF5096C7,
-0xFF5496C8,
-0xFF5598CC,
-0xFF5499D0,
-0xFF5095CC,
-0xFF589BD0,
-0xFF5598CD,
-0xFF5297CE,
-0xFF589BD2,
-0xFF5998CE,
-0xFF5897CD,
-0xFF5698CC,
-0xFF549ACE,
-0xFF5399D4,
-0xFF529AD4,
-0xFF529BCE,
-0xFF559BCC,
-0xFF5698C8,
-0xFF5999C9,
-0xFF569ACB,
-0xFF549ACE,
-0xFF5496D0,
-0xFF5F95C4,
-0xFF7695AA,
-0xFF8B9D8F,
-0xFFBCCE94,
-0xFF5C6F1D,
-0xFF728533,
-0xFF758735,
-0xFF748233,
-0xFF8A8A4C,
-0xFF3B1D01,
-0xFF4F1811,
-0xFF6D2026,
-0xFF521C36,
-0xFF434F89,
-0xFF013076,
-0xFF5083C4,
-0xFF659DD8,
-0xFF5998CD,
-0xFF589ACC,
-0xFF5998CD,
-0xFF5798CE,
-0xFF559AD5,
-0xFF559AD3,
-0xFF5495CB,
-0xFF599BCD,
-0xFF559CCA,
-0xFF5098CA,
-0xFF5698D2,
-0xFF5698D4,
-0xFF539AD2,
-0xFF539ACE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF5499D2,
-0xFF5698D2,
-0xFF5699CE,
-0xFF5699CE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF5499D0,
-0xFF549ACE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5499D0,
-0xFF549ACE,
-0xFF5798CE,
-0xFF5799CD,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF549ACE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699D0,
-0xFF5598CF,
-0xFF5697CF,
-0xFF5697CF,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5497CE,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5196CD,
-0xFF5294CE,
-0xFF5095CE,
-0xFF5294CE,
-0xFF5095CE,
-0xFF4F94CD,
-0xFF4F94CB,
-0xFF4F94CD,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4D92CB,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4F91CD,
-0xFF4F91CD,
-0xFF4F91CD,
-0xFF4E90CC,
-0xFF4D8FCB,
-0xFF4C8ECA,
-0xFF4C8ECA,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4B8DC9,
-0xFF4A8CC9,
-0xFF4A8CC9,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4A8AC8,
-0xFF4C89C8,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4B88C7,
-0xFF4A87C6,
-0xFF4986C5,
-0xFF4C80BC,
-0xFF4C80BA,
-0xFF4E82BE,
-0xFF5084C0,
-0xFF5185C1,
-0xFF5286C2,
-0xFF5086C2,
-0xFF4F85C1,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4B86C2,
-0xFF4B86C2,
-0xFF4B86C2,
-0xFF4B86C2,
-0xFF4A86C2,
-0xFF4A86C2,
-0xFF4A88C5,
-0xFF4888C5,
-0xFF4B89C6,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4C8AC7,
-0xFF4C8AC7,
-0xFF4D8BC8,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4F8DCA,
-0xFF508CC8,
-0xFF518EC7,
-0xFF518EC7,
-0xFF518EC7,
-0xFF518EC7,
-0xFF5390C9,
-0xFF5694CD,
-0xFF5896CF,
-0xFF5091C9,
-0xFF4F90C8,
-0xFF5091C9,
-0xFF5192CA,
-0xFF5492CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5394CC,
-0xFF5693C9,
-0xFF5B97CD,
-0xFF5F9BD1,
-0xFF5F9CD2,
-0xFF5D9AD0,
-0xFF5A97CD,
-0xFF5996CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5194CB,
-0xFF5093CA,
-0xFF5093CA,
-0xFF5194CB,
-0xFF4F95C9,
-0xFF4F95C9,
-0xFF5096CA,
-0xFF5096CA,
-0xFF5096CA,
-0xFF5096CA,
-0xFF5194C9,
-0xFF5194C9,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5096CA,
-0xFF5295CA,
-0xFF5096CA,
-0xFF5295CA,
-0xFF5197CB,
-0xFF5396CB,
-0xFF5197CB,
-0xFF5396CB,
-0xFF5197CB,
-0xFF5396CB,
-0xFF5197CB,
-0xFF5396CB,
-0xFF5197CB,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5596CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5699D0,
-0xFF5699D0,
-0xFF5499D0,
-0xFF5499D0,
-0xFF5297CE,
-0xFF5398CF,
-0xFF5399CD,
-0xFF5399CD,
-0xFF5699CE,
-0xFF5598CC,
-0xFF589BD0,
-0xFF5799CD,
-0xFF5998CB,
-0xFF5C9ACD,
-0xFF5593C6,
-0xFF7CBAED,
-0xFF5995C9,
-0xFF5C9ACD,
-0xFF5796CB,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699D0,
-0xFF5699D0,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5499D0,
-0xFF539AD0,
-0xFF539ACE,
-0xFF539BCD,
-0xFF549ACD,
-0xFF5699CD,
-0xFF5497CB,
-0xFF5B9DD1,
-0xFF5A97CE,
-0xFF6095C9,
-0xFF6A95C0,
-0xFF607E86,
-0xFFCADBA7,
-0xFF616D1B,
-0xFF6E7D2C,
-0xFF748535,
-0xFF79863E,
-0xFF77723B,
-0xFF411701,
-0xFF4D1B1E,
-0xFF3D1E30,
-0xFF403C61,
-0xFF0C2965,
-0xFF5D8CD2,
-0xFF689ADF,
-0xFF5D98D4,
-0xFF569ACB,
-0xFF559CC8,
-0xFF5699CD,
-0xFF5699CE,
-0xFF5499D0,
-0xFF5499D0,
-0xFF5699CE,
-0xFF5699CD,
-0xFF559BCE,
-0xFF559BCF,
-0xFF5499D0,
-0xFF5499D0,
-0xFF559AD1,
-0xFF559BCF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579AD1,
-0xFF589BD0,
-0xFF5799CD,
-0xFF579ACE,
-0xFF549BD1,
-0xFF539CD1,
-0xFF549BD1,
-0xFF559BCF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF559AD1,
-0xFF5499D0,
-0xFF5699CE,
-0xFF549ACE,
-0xFF549CCE,
-0xFF549CCE,
-0xFF559AD1,
-0xFF5699D0,
-0xFF5698CC,
-0xFF5B9DD1,
-0xFF5396CB,
-0xFF559BCF,
-0xFF569DD3,
-0xFF539AD0,
-0xFF549BD3,
-0xFF559CD2,
-0xFF5399CD,
-0xFF5399CD,
-0xFF559BCF,
-0xFF569BD2,
-0xFF5299D1,
-0xFF5299CF,
-0xFF5C9BD0,
-0xFF5A99CC,
-0xFF589ACE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5497CC,
-0xFF5596CE,
-0xFF5396CD,
-0xFF5495CD,
-0xFF5396CD,
-0xFF5095CC,
-0xFF5096CA,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4D94CC,
-0xFF4D94CC,
-0xFF4C93CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4A8FCA,
-0xFF4D8FCB,
-0xFF4C8ECA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4A8AC7,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4880BD,
-0xFF4981BE,
-0xFF4A82BF,
-0xFF4B83C0,
-0xFF4D85C2,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4D85C2,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4C87C3,
-0xFF4C87C3,
-0xFF4C87C3,
-0xFF4C87C3,
-0xFF4B87C3,
-0xFF4A88C3,
-0xFF4B89C6,
-0xFF4989C6,
-0xFF4989C6,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF508EC9,
-0xFF518EC7,
-0xFF518EC7,
-0xFF518EC7,
-0xFF518EC7,
-0xFF528FC8,
-0xFF5390C9,
-0xFF5593CC,
-0xFF5795CE,
-0xFF5293CB,
-0xFF5192CA,
-0xFF5091C9,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5194CB,
-0xFF5495CB,
-0xFF5693C9,
-0xFF5A96CA,
-0xFF5D99CD,
-0xFF5E9ACE,
-0xFF5B98CE,
-0xFF5996CC,
-0xFF5895CB,
-0xFF5895CB,
-0xFF5897CD,
-0xFF5796CC,
-0xFF5596CC,
-0xFF5495CB,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194C9,
-0xFF5096CA,
-0xFF5295CA,
-0xFF5096CA,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5699D0,
-0xFF5699D0,
-0xFF5499D0,
-0xFF5499D0,
-0xFF559AD1,
-0xFF5398CF,
-0xFF589ED2,
-0xFF549ACE,
-0xFF579ACE,
-0xFF5699CD,
-0xFF5698CC,
-0xFF5897CA,
-0xFF5997C8,
-0xFF5391C0,
-0xFF7BB9EA,
-0xFF609FD2,
-0xFF5695CA,
-0xFF5897CC,
-0xFF5A99CF,
-0xFF5899CF,
-0xFF5798D0,
-0xFF5699D0,
-0xFF5798D0,
-0xFF5699D0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF559AD1,
-0xFF559AD1,
-0xFF549BCF,
-0xFF549BCF,
-0xFF549BCF,
-0xFF549BCF,
-0xFF5699CD,
-0xFF5A9CD0,
-0xFF5A96CA,
-0xFF5C95CA,
-0xFF6196CA,
-0xFF5E879B,
-0xFFC4D5A8,
-0xFF666F20,
-0xFF768532,
-0xFF748233,
-0xFF838846,
-0xFF4D3F12,
-0xFF451A0A,
-0xFF452028,
-0xFF171C39,
-0xFF1A3967,
-0xFF6791CB,
-0xFF6598D9,
-0xFF5891D4,
-0xFF5A9AD7,
-0xFF569DCB,
-0xFF539CC7,
-0xFF559DCF,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF559BCF,
-0xFF559BCF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACE,
-0xFF579ACE,
-0xFF579ACE,
-0xFF549BCF,
-0xFF559CD2,
-0xFF559CD2,
-0xFF559CD2,
-0xFF569CD0,
-0xFF559BCF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF579ACF,
-0xFF579ACE,
-0xFF569CCF,
-0xFF569CCF,
-0xFF559BCF,
-0xFF559AD1,
-0xFF5DA0D5,
-0xFF5396CA,
-0xFF5C9FD3,
-0xFF589BD0,
-0xFF559AD1,
-0xFF559CD2,
-0xFF569DD3,
-0xFF5197CB,
-0xFF589CCD,
-0xFF5C9ED0,
-0xFF579ACE,
-0xFF5097CD,
-0xFF549DD4,
-0xFF579ED6,
-0xFF5799CD,
-0xFF5998CB,
-0xFF579ACE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CF,
-0xFF5596CE,
-0xFF5596CE,
-0xFF5396CD,
-0xFF5396CB,
-0xFF5197CB,
-0xFF5096CA,
-0xFF5096CA,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4E95CB,
-0xFF4E95CB,
-0xFF4D94CC,
-0xFF4D94CC,
-0xFF4D92CB,
-0xFF4D92CB,
-0xFF4D92CD,
-0xFF4D92CD,
-0xFF4C91CC,
-0xFF4B90CB,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4E8ECB,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4A8AC7,
-0xFF4981BE,
-0xFF4981BE,
-0xFF4A82BF,
-0xFF4B83C0,
-0xFF4C84C1,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4C87C3,
-0xFF4C87C3,
-0xFF4C88C4,
-0xFF4C88C4,
-0xFF4C88C4,
-0xFF4B89C4,
-0xFF4C8AC7,
-0xFF4A8AC7,
-0xFF4C8AC7,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF508EC9,
-0xFF518FCA,
-0xFF508EC7,
-0xFF518FC8,
-0xFF518FC8,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5694CD,
-0xFF5495CD,
-0xFF5293CB,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5293CB,
-0xFF5594CA,
-0xFF5693C9,
-0xFF5995CB,
-0xFF5A97CD,
-0xFF5A97CD,
-0xFF5A97CD,
-0xFF5996CC,
-0xFF5796CB,
-0xFF5695CA,
-0xFF5796CC,
-0xFF5695CB,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5497CE,
-0xFF5497CE,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5596CC,
-0xFF5497CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF549ACE,
-0xFF579DD1,
-0xFF5396CB,
-0xFF5497CC,
-0xFF5799CD,
-0xFF5A9CD0,
-0xFF599BCD,
-0xFF589ACC,
-0xFF5999C9,
-0xFF7DBDED,
-0xFF5C9BCE,
-0xFF5496C8,
-0xFF589ACE,
-0xFF5B9DD1,
-0xFF5899CF,
-0xFF579ACF,
-0xFF579AD1,
-0xFF559AD1,
-0xFF579ACF,
-0xFF559BCF,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CCF,
-0xFF569CCF,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF559CD0,
-0xFF559CD0,
-0xFF549DD0,
-0xFF559CD0,
-0xFF559DCF,
-0xFF589BCF,
-0xFF5799CB,
-0xFF5B99CC,
-0xFF5F99CB,
-0xFF6794A9,
-0xFF9CB18A,
-0xFF757F36,
-0xFF748630,
-0xFF788132,
-0xFF8C7F48,
-0xFF331900,
-0xFF44211B,
-0xFF241625,
-0xFF092648,
-0xFF71A5D4,
-0xFF6398CE,
-0xFF5A95CF,
-0xFF5CA0DD,
-0xFF539BD5,
-0xFF539CC9,
-0xFF559EC9,
-0xFF559DCF,
-0xFF559CD0,
-0xFF559CD0,
-0xFF559CD0,
-0xFF559CD0,
-0xFF559CD0,
-0xFF559CD0,
-0xFF569DD1,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CCF,
-0xFF569CCF,
-0xFF569CCF,
-0xFF569CCF,
-0xFF549DD0,
-0xFF559CD0,
-0xFF589BCF,
-0xFF589BCF,
-0xFF559CD2,
-0xFF549DD2,
-0xFF559CD2,
-0xFF559CD0,
-0xFF559DCF,
-0xFF559DCD,
-0xFF569CCD,
-0xFF589BCF,
-0xFF5C9BD1,
-0xFF5A9BD1,
-0xFF559DCF,
-0xFF529ED0,
-0xFF519ACF,
-0xFF59A0D6,
-0xFF5598CC,
-0xFF5496C8,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF5399CC,
-0xFF599BCB,
-0xFF5895C1,
-0xFF5A97C3,
-0xFF5B9DCF,
-0xFF559CD0,
-0xFF559ED3,
-0xFF559ED3,
-0xFF5399CD,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF559BCF,
-0xFF559BCF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5497CE,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5298CC,
-0xFF5197CB,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4F94CB,
-0xFF4F94CB,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4E93CC,
-0xFF4F91CB,
-0xFF4E90CA,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4D8FCB,
-0xFF4D8FCB,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4B83C0,
-0xFF4B83C0,
-0xFF4B83C0,
-0xFF4C84C1,
-0xFF4C84C1,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4B86C2,
-0xFF4C87C3,
-0xFF4C87C3,
-0xFF4C88C4,
-0xFF4C88C4,
-0xFF4C88C4,
-0xFF4B89C4,
-0xFF4C8AC7,
-0xFF4A8AC7,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4F8DCA,
-0xFF4E8CC9,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF508ECB,
-0xFF508EC9,
-0xFF508EC9,
-0xFF518FCA,
-0xFF5290CB,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5593CC,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5493C9,
-0xFF5794CB,
-0xFF5894CA,
-0xFF5895CB,
-0xFF5996CC,
-0xFF5996CC,
-0xFF5895CB,
-0xFF5695CA,
-0xFF5695CA,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF559BCF,
-0xFF589ED2,
-0xFF549ACE,
-0xFF599CD1,
-0xFF60A3D7,
-0xFF5B9DD1,
-0xFF5395C9,
-0xFF599BCD,
-0xFF5698CA,
-0xFF75B7E7,
-0xFF5799C9,
-0xFF5698CA,
-0xFF5A9ECF,
-0xFF599CD0,
-0xFF549ACD,
-0xFF599CD1,
-0xFF569CD0,
-0xFF569BD2,
-0xFF569BD2,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CCF,
-0xFF569CCF,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF589BD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF559CD0,
-0xFF559CD0,
-0xFF559ED1,
-0xFF539CCF,
-0xFF56A0D1,
-0xFF559DCF,
-0xFF569CCD,
-0xFF5B9DCF,
-0xFF5B9ACD,
-0xFF6E9EB5,
-0xFF6E8568,
-0xFF9BA767,
-0xFF6A7B2B,
-0xFF81873D,
-0xFF685127,
-0xFF3A1D0D,
-0xFF25161B,
-0xFF131E34,
-0xFF7BA8CF,
-0xFF5A9ACA,
-0xFF5E9CCF,
-0xFF5B9CD2,
-0xFF529DD4,
-0xFF529FD5,
-0xFF559FCE,
-0xFF57A0CD,
-0xFF569ED0,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD0,
-0xFF579DD0,
-0xFF579DD0,
-0xFF569ED0,
-0xFF539FD3,
-0xFF559ED1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF569DD1,
-0xFF559ED3,
-0xFF569DD3,
-0xFF569DD1,
-0xFF579DCE,
-0xFF579ECC,
-0xFF579DCE,
-0xFF599DCE,
-0xFF5D9CD2,
-0xFF5B9CD2,
-0xFF569ED0,
-0xFF539FD0,
-0xFF519DD1,
-0xFF57A0D5,
-0xFF5CA2D6,
-0xFF599DCE,
-0xFF5E9ECE,
-0xFF5C9BC7,
-0xFF5B96C0,
-0xFF7EB8E0,
-0xFF93CDF5,
-0xFF619ECA,
-0xFF5296C7,
-0xFF589FD3,
-0xFF59A0D4,
-0xFF579ED2,
-0xFF539CD1,
-0xFF57A0D5,
-0xFF569DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF589ED2,
-0xFF589ED2,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF589ED2,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699D0,
-0xFF5699D0,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5298CC,
-0xFF5298CC,
-0xFF5297CE,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5095CC,
-0xFF5095CC,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF4F94CD,
-0xFF5092CC,
-0xFF4F91CB,
-0xFF4F91CD,
-0xFF4F91CD,
-0xFF4F91CD,
-0xFF4E90CC,
-0xFF4E90CC,
-0xFF4D8FCB,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4C8CC9,
-0xFF4B8BC8,
-0xFF4B8BC8,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4C87C3,
-0xFF4C87C3,
-0xFF4D88C4,
-0xFF4C88C4,
-0xFF4D89C5,
-0xFF4D89C5,
-0xFF4D8BC6,
-0xFF4D8BC6,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4D8BC8,
-0xFF4E8CC9,
-0xFF4E8CC7,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF508EC9,
-0xFF518FCA,
-0xFF518FCA,
-0xFF518FCA,
-0xFF5091CB,
-0xFF5192CC,
-0xFF5091C9,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5493C9,
-0xFF5895CC,
-0xFF5895CC,
-0xFF5895CC,
-0xFF5895CC,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5796CC,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CCF,
-0xFF579DD0,
-0xFF5598CC,
-0xFF5497CB,
-0xFF5799CD,
-0xFF5D9FD1,
-0xFF5799CB,
-0xFF7BBDEF,
-0xFF5B9FD0,
-0xFF599DCE,
-0xFF5B9ED2,
-0xFF589ED1,
-0xFF5399CC,
-0xFF58A0D2,
-0xFF579DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF579DD0,
-0xFF579DD0,
-0xFF579DD0,
-0xFF579DD0,
-0xFF579DD1,
-0xFF579DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF56A0D1,
-0xFF549ECF,
-0xFF57A1D2,
-0xFF559FD0,
-0xFF579FD1,
-0xFF599FD0,
-0xFF589CCD,
-0xFF6CA2BE,
-0xFF556D5F,
-0xFF9EAA7C,
-0xFF707C3A,
-0xFF848549,
-0xFF3B230B,
-0xFF372325,
-0xFF142132,
-0xFF80A7C6,
-0xFF6096C4,
-0xFF5B9DCF,
-0xFF559BCE,
-0xFF59A2D5,
-0xFF539FD1,
-0xFF509CCE,
-0xFF52A0D0,
-0xFF54A1CF,
-0xFF569FD2,
-0xFF579ED2,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF58A0D2,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF579FD1,
-0xFF569FD4,
-0xFF569FD2,
-0xFF589ED1,
-0xFF589ECF,
-0xFF579FD1,
-0xFF579ED2,
-0xFF569FD2,
-0xFF579FD1,
-0xFF5A9ECD,
-0xFF5B9ECB,
-0xFF5B9DCD,
-0xFF5A9ECF,
-0xFF589ED2,
-0xFF589ED1,
-0xFF589ECF,
-0xFF589ECF,
-0xFF59A1D3,
-0xFF559ED1,
-0xFF4F98CF,
-0xFF589FD3,
-0xFF5D9DCB,
-0xFF5E96BB,
-0xFF8AB3CF,
-0xFFD8FFFF,
-0xFF69A3CB,
-0xFF5698C8,
-0xFF5BA2D6,
-0xFF589FD3,
-0xFF5397C8,
-0xFF5DA1D2,
-0xFF59A2D7,
-0xFF519CD3,
-0xFF559ED1,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF569ED0,
-0xFF579FD1,
-0xFF579FD1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF579DD1,
-0xFF579DD1,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699D0,
-0xFF5699D0,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CF,
-0xFF5497CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5196CD,
-0xFF5196CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5093CA,
-0xFF5092CC,
-0xFF5092CC,
-0xFF5092CC,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF4E90CA,
-0xFF4F90CA,
-0xFF4F90CA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4D8DCA,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4D85C2,
-0xFF4D85C2,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4F87C4,
-0xFF4D88C4,
-0xFF4D88C4,
-0xFF4C88C4,
-0xFF4D89C5,
-0xFF4D89C5,
-0xFF4E8AC6,
-0xFF4D8BC6,
-0xFF4D8BC6,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4E8CC9,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF518FCA,
-0xFF518FCA,
-0xFF518FCA,
-0xFF5290CB,
-0xFF5290CB,
-0xFF5290CB,
-0xFF5290CB,
-0xFF5192CC,
-0xFF5293CD,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5495CD,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5897CD,
-0xFF5996CD,
-0xFF5895CC,
-0xFF5996CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5796CC,
-0xFF5998CE,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF599AD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF599CD1,
-0xFF599CD1,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF589BD0,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD0,
-0xFF579DD0,
-0xFF5AA0D3,
-0xFF599CD0,
-0xFF5CA0D1,
-0xFF5A9CCE,
-0xFF5B9DCF,
-0xFF71B3E5,
-0xFF5C9ED0,
-0xFF579BCC,
-0xFF569CCD,
-0xFF569CCF,
-0xFF589ED1,
-0xFF5AA2D4,
-0xFF549CCE,
-0xFF549BCF,
-0xFF5AA1D5,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF569DD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF569DD1,
-0xFF58A0D2,
-0xFF559FD0,
-0xFF58A2D3,
-0xFF54A0D1,
-0xFF56A0D1,
-0xFF57A1D2,
-0xFF559DCD,
-0xFF65A0C0,
-0xFF658385,
-0xFF87957B,
-0xFF7A8052,
-0xFF66633A,
-0xFF2C1A16,
-0xFF141124,
-0xFF7A9DBD,
-0xFF629CC4,
-0xFF629ED0,
-0xFF5EA0D4,
-0xFF59A2D5,
-0xFF4E9ACC,
-0xFF58A2D3,
-0xFF59A3D2,
-0xFF519DCE,
-0xFF54A0D1,
-0xFF57A0D3,
-0xFF589FD3,
-0xFF58A0D2,
-0xFF58A0D2,
-0xFF58A0D2,
-0xFF58A0D2,
-0xFF58A0D2,
-0xFF58A0D2,
-0xFF579FD1,
-0xFF579FD1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589FD3,
-0xFF57A0D3,
-0xFF58A0D2,
-0xFF58A0D0,
-0xFF599FD2,
-0xFF599FD2,
-0xFF58A0D2,
-0xFF599FD0,
-0xFF5C9ED0,
-0xFF5C9ECE,
-0xFF5C9ECE,
-0xFF599FD0,
-0xFF57A1D2,
-0xFF57A1D2,
-0xFF5B9FD0,
-0xFF5C9ED0,
-0xFF5AA0D1,
-0xFF579FD1,
-0xFF5DA6D9,
-0xFF5CA0CF,
-0xFF5D92BA,
-0xFF8FBCDB,
-0xFFE0FFFF,
-0xFF8AB6D1,
-0xFF609BC5,
-0xFF559BCE,
-0xFF59A0D4,
-0xFF5AA0D3,
-0xFF5EA0D0,
-0xFF5CA0CF,
-0xFF539CD1,
-0xFF56A2D6,
-0xFF579ED2,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF579FD1,
-0xFF58A0D2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF599FD2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF5A9DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF569CD0,
-0xFF569CD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579AD1,
-0xFF579AD1,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CF,
-0xFF5598CF,
-0xFF5398CF,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5297CE,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5193CD,
-0xFF5092CC,
-0xFF5092CC,
-0xFF4F91CB,
-0xFF4F91CB,
-0xFF5091CB,
-0xFF5091CB,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4E8ECB,
-0xFF4D8DCA,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF4E8CC9,
-0xFF4E86C3,
-0xFF4E86C3,
-0xFF4F87C4,
-0xFF4F87C4,
-0xFF4E86C3,
-0xFF4F87C4,
-0xFF4D88C4,
-0xFF4E89C5,
-0xFF4D88C4,
-0xFF4E89C5,
-0xFF4D89C5,
-0xFF4E8AC6,
-0xFF4D8BC6,
-0xFF4D8BC6,
-0xFF4D8BC6,
-0xFF4E8CC7,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF518FCA,
-0xFF5290CB,
-0xFF5290CB,
-0xFF5391CC,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5192CA,
-0xFF5293CB,
-0xFF5394CC,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5396CB,
-0xFF5394CA,
-0xFF5394CA,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5897CD,
-0xFF5A99CF,
-0xFF5B9AD0,
-0xFF5B9AD0,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5B9AD0,
-0xFF5B9AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF579ACF,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF589ED2,
-0xFF589ED2,
-0xFF579DD1,
-0xFF579DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF589BCF,
-0xFF5B9FD0,
-0xFF589ACC,
-0xFF5D9FD1,
-0xFF5597C9,
-0xFF78BAEA,
-0xFF62A2D2,
-0xFF5A9CCE,
-0xFF5CA0D1,
-0xFF5CA2D5,
-0xFF549CCE,
-0xFF569ED0,
-0xFF579FD1,
-0xFF5AA2D4,
-0xFF5BA2D6,
-0xFF559CD0,
-0xFF579ED2,
-0xFF579ED2,
-0xFF579FD1,
-0xFF579FD1,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD0,
-0xFF58A0D0,
-0xFF58A0D0,
-0xFF58A0D0,
-0xFF599FD2,
-0xFF599FD2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF589ED1,
-0xFF58A0D2,
-0xFF56A0D1,
-0xFF58A2D3,
-0xFF57A1D2,
-0xFF56A0D1,
-0xFF57A1D2,
-0xFF56A0D1,
-0xFF5F9FC5,
-0xFF7EA7B9,
-0xFF475A58,
-0xFF423B28,
-0xFF2C2012,
-0xFF1A1D2E,
-0xFF839BBF,
-0xFF6A9DCA,
-0xFF5E9CCF,
-0xFF5F9DD0,
-0xFF5A9CD0,
-0xFF59A0D4,
-0xFF539DCE,
-0xFF599FD0,
-0xFF5BA2D0,
-0xFF579FD1,
-0xFF58A1D4,
-0xFF58A0D2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF5AA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5C9FD3,
-0xFF5AA0D3,
-0xFF5AA2D4,
-0xFF5AA2D4,
-0xFF5AA0D1,
-0xFF5CA0CF,
-0xFF5CA0CF,
-0xFF5CA0CF,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5EA0D4,
-0xFF5BA1D2,
-0xFF58A2D1,
-0xFF58A2D1,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5BA1D4,
-0xFF5CA2D3,
-0xFF5C9CCA,
-0xFF6096BC,
-0xFF96BAD2,
-0xFFE5FFFF,
-0xFF99C6E5,
-0xFF5D94BB,
-0xFF5E9ECE,
-0xFF5EA1D5,
-0xFF5CA0D1,
-0xFF599DCE,
-0xFF5EA2D3,
-0xFF5CA2D3,
-0xFF579ED2,
-0xFF589FD3,
-0xFF599FD2,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF599FD0,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF579DD1,
-0xFF579DD1,
-0xFF589ED2,
-0xFF579DD1,
-0xFF579DD1,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5095CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5093CA,
-0xFF5092CC,
-0xFF5092CC,
-0xFF5091CB,
-0xFF5091CB,
-0xFF4F8FCC,
-0xFF4F8FCC,
-0xFF508ECB,
-0xFF508ECB,
-0xFF4F8DCA,
-0xFF4F8DCA,
-0xFF4E86C3,
-0xFF4F87C4,
-0xFF4F87C4,
-0xFF5088C5,
-0xFF4F87C4,
-0xFF4D88C4,
-0xFF4E89C5,
-0xFF4E89C5,
-0xFF4F8AC6,
-0xFF4F8AC6,
-0xFF4F8BC7,
-0xFF4F8BC7,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF508EC9,
-0xFF518FCA,
-0xFF5290CB,
-0xFF5391CC,
-0xFF5492CD,
-0xFF5492CD,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CA,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5495CB,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5998CE,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9AD0,
-0xFF5C9BD1,
-0xFF5C9BD1,
-0xFF5C9BD1,
-0xFF5B9AD0,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5A9BD1,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF599AD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF569CD0,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF579DD1,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9FD0,
-0xFF589CCD,
-0xFF5EA0D2,
-0xFF5C9ED0,
-0xFF5597C9,
-0xFF7BBDED,
-0xFF5EA0D0,
-0xFF5B9BCB,
-0xFF5D9FCF,
-0xFF599CD0,
-0xFF589ED1,
-0xFF5CA2D5,
-0xFF59A1D3,
-0xFF579DD0,
-0xFF58A0D2,
-0xFF589ED2,
-0xFF59A0D4,
-0xFF599FD3,
-0xFF58A0D2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF5B9FD0,
-0xFF599FD0,
-0xFF59A1D1,
-0xFF58A2D1,
-0xFF5AA0D3,
-0xFF5AA0D3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF599FD2,
-0xFF58A0D2,
-0xFF5AA2D4,
-0xFF5AA2D4,
-0xFF58A0D2,
-0xFF58A0D2,
-0xFF5AA2D4,
-0xFF5DA0CB,
-0xFF689DBC,
-0xFF6D8899,
-0xFF251B1C,
-0xFF13040B,
-0xFF8694B1,
-0xFF7A9FCC,
-0xFF6198CE,
-0xFF5FA0D8,
-0xFF609FD4,
-0xFF5EA0D4,
-0xFF5BA1D4,
-0xFF5CA2D3,
-0xFF5EA2D1,
-0xFF5A9CCC,
-0xFF62A5D9,
-0xFF5B9ED2,
-0xFF5DA0D4,
-0xFF5BA1D4,
-0xFF5DA0D4,
-0xFF5AA0D3,
-0xFF5DA0D4,
-0xFF5BA1D4,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5EA0D2,
-0xFF5EA2D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5BA3D5,
-0xFF5BA3D5,
-0xFF5EA0D2,
-0xFF60A0D0,
-0xFF60A0CE,
-0xFF5EA0D0,
-0xFF5C9FD3,
-0xFF5BA1D5,
-0xFF5EA1D6,
-0xFF5BA1D4,
-0xFF5BA1D2,
-0xFF5BA1D2,
-0xFF5EA0D4,
-0xFF5EA0D4,
-0xFF5DA0D4,
-0xFF61A0CC,
-0xFF6193B8,
-0xFF9BC3DD,
-0xFFE6FFFF,
-0xFFA7CAE0,
-0xFF5F93B8,
-0xFF619FCE,
-0xFF5EA0D2,
-0xFF5C9FD3,
-0xFF5D9FD1,
-0xFF60A2D2,
-0xFF5B9FD0,
-0xFF5A9DD1,
-0xFF5FA3D4,
-0xFF5EA2D3,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF599FD3,
-0xFF599FD3,
-0xFF599FD3,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF589ED2,
-0xFF579DD1,
-0xFF579DD1,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF569CD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5495CB,
-0xFF5396CB,
-0xFF5197CB,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5193CD,
-0xFF5092CC,
-0xFF5192CC,
-0xFF5192CC,
-0xFF5090CD,
-0xFF5090CD,
-0xFF518FCC,
-0xFF518FCC,
-0xFF508ECB,
-0xFF508ECB,
-0xFF4E86C3,
-0xFF4F87C4,
-0xFF4D88C4,
-0xFF4E89C5,
-0xFF4E89C5,
-0xFF4E89C5,
-0xFF4F8AC6,
-0xFF4E8AC6,
-0xFF4E8AC6,
-0xFF4F8BC7,
-0xFF4F8BC7,
-0xFF508CC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF518FCA,
-0xFF4F8DC6,
-0xFF508EC7,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5394CC,
-0xFF5495CD,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5A99CF,
-0xFF5A99CF,
-0xFF5B9AD0,
-0xFF5B9AD0,
-0xFF5B9AD0,
-0xFF5B9AD0,
-0xFF5A99CE,
-0xFF5998CD,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACD,
-0xFF5B9ACD,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF599BCF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF5A9CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF599CD0,
-0xFF589ED1,
-0xFF589ED1,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF589ED1,
-0xFF589ED1,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5A9DD1,
-0xFF5C9FD3,
-0xFF599DCE,
-0xFF5DA1D2,
-0xFF5D9FD1,
-0xFF5C9ED0,
-0xFF5B9DCF,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF61A1D1,
-0xFF5B9BCB,
-0xFF7DBDED,
-0xFF5A9ACA,
-0xFF5D9DCD,
-0xFF5E9ECE,
-0xFF5EA0D0,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5AA0D3,
-0xFF5DA0D4,
-0xFF5BA1D4,
-0xFF5DA0D4,
-0xFF5AA0D3,
-0xFF5C9FD3,
-0xFF5AA0D3,
-0xFF5C9FD3,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5D9FD1,
-0xFF5CA0D1,
-0xFF5AA2D2,
-0xFF58A2D1,
-0xFF599FD0,
-0xFF5AA0D1,
-0xFF5DA1D2,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5FA1D3,
-0xFF5EA2D3,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5BA1D4,
-0xFF5BA1D4,
-0xFF5CA2D5,
-0xFF5EA2D1,
-0xFF609FC8,
-0xFF81A8C7,
-0xFF423D51,
-0xFF201327,
-0xFF5B698C,
-0xFF7BA0CD,
-0xFF659AD0,
-0xFF619FD8,
-0xFF5E9FD5,
-0xFF5DA0D4,
-0xFF5EA0D0,
-0xFF5FA1D1,
-0xFF5FA1D3,
-0xFF609FD2,
-0xFF619FD2,
-0xFF619FD2,
-0xFF5FA1D3,
-0xFF5EA2D3,
-0xFF5FA1D3,
-0xFF5EA2D3,
-0xFF5FA1D3,
-0xFF5EA2D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF62A2D2,
-0xFF60A2D2,
-0xFF61A1D1,
-0xFF5FA1D1,
-0xFF61A1D1,
-0xFF5FA1D1,
-0xFF5FA1D1,
-0xFF5FA1D1,
-0xFF5FA1D5,
-0xFF5FA1D3,
-0xFF61A1D1,
-0xFF62A0CF,
-0xFF63A0CF,
-0xFF61A1D1,
-0xFF5BA2D6,
-0xFF5BA4D9,
-0xFF5CA3D9,
-0xFF62A5DA,
-0xFF639FD3,
-0xFF609CCE,
-0xFF5FA3D4,
-0xFF5EA4D5,
-0xFF62A2D2,
-0xFF6195BC,
-0xFFA1C0D5,
-0xFFEBFFFF,
-0xFFACD1EC,
-0xFF6494B8,
-0xFF66A1CD,
-0xFF61A1D1,
-0xFF5FA1D5,
-0xFF5EA1D5,
-0xFF60A2D6,
-0xFF5FA3D4,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF61A1D1,
-0xFF60A0CE,
-0xFF5FA1D3,
-0xFF5DA1D2,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5EA0D2,
-0xFF5EA2D3,
-0xFF5FA1D3,
-0xFF5FA3D4,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF609FD2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5DA0D4,
-0xFF5DA0D4,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF579DD0,
-0xFF579DD0,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF5192CC,
-0xFF5091CB,
-0xFF5091CB,
-0xFF4F90CA,
-0xFF4F8FCC,
-0xFF4F8FCC,
-0xFF4F87C4,
-0xFF4F87C4,
-0xFF4E89C5,
-0xFF4E89C5,
-0xFF4E89C5,
-0xFF4F8AC6,
-0xFF4E8AC6,
-0xFF4F8BC7,
-0xFF4E8AC6,
-0xFF4F8BC7,
-0xFF4F8BC7,
-0xFF508CC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508EC9,
-0xFF518FCA,
-0xFF508EC7,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5492CB,
-0xFF5492CB,
-0xFF5593CC,
-0xFF5495CD,
-0xFF5495CD,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5394CC,
-0xFF5495CD,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9AD0,
-0xFF5C9BD1,
-0xFF5C9BD1,
-0xFF5C9BD1,
-0xFF5C9BD1,
-0xFF5B9AD0,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5B9ACD,
-0xFF5B9ACD,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF5A9CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF5A9DD1,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF599FD2,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5EA1D5,
-0xFF5B9FD0,
-0xFF5EA2D3,
-0xFF5B9FD0,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF63A3D3,
-0xFF5F9FCF,
-0xFF5898C8,
-0xFF80C0F0,
-0xFF63A3D3,
-0xFF5E9ECE,
-0xFF61A1D1,
-0xFF63A3D3,
-0xFF5D9DCD,
-0xFF5EA0D2,
-0xFF5DA0D4,
-0xFF5EA0D4,
-0xFF5DA0D4,
-0xFF5FA1D5,
-0xFF5EA1D5,
-0xFF5DA0D4,
-0xFF5DA0D4,
-0xFF5DA0D4,
-0xFF5EA1D5,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5DA1D2,
-0xFF5AA2D2,
-0xFF5AA2D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF61A0D3,
-0xFF61A0D3,
-0xFF61A0D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D5,
-0xFF5FA1D5,
-0xFF5FA1D5,
-0xFF5FA1D3,
-0xFF5FA1D1,
-0xFF6C9CC4,
-0xFF9BA1C1,
-0xFF24203B,
-0xFF151E3D,
-0xFF8CA8CF,
-0xFF73A5D8,
-0xFF609FD5,
-0xFF5EA0D4,
-0xFF5FA1D3,
-0xFF61A1CF,
-0xFF62A2D0,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF64A0D2,
-0xFF64A0D2,
-0xFF61A0D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF61A0D3,
-0xFF61A0D3,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF64A0D2,
-0xFF62A1D4,
-0xFF5EA4D7,
-0xFF5AA3D6,
-0xFF5CA3D7,
-0xFF5B9DD1,
-0xFF649BD1,
-0xFF6CA4D7,
-0xFF63A3D1,
-0xFF61A0CB,
-0xFF6499C1,
-0xFF98C1E1,
-0xFFE9FFFF,
-0xFFB7D2E7,
-0xFF6E9BBC,
-0xFF67A0CB,
-0xFF63A1D2,
-0xFF5FA1D3,
-0xFF61A0D3,
-0xFF5FA1D3,
-0xFF5FA2D6,
-0xFF5FA2D6,
-0xFF60A2D4,
-0xFF62A2D2,
-0xFF64A1D0,
-0xFF62A0CF,
-0xFF61A1D1,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA0D4,
-0xFF5DA0D4,
-0xFF5DA0D4,
-0xFF5DA0D4,
-0xFF5DA0D4,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF589ED1,
-0xFF5A9DD1,
-0xFF5B9CD2,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5394CC,
-0xFF5293CB,
-0xFF5293CD,
-0xFF5192CC,
-0xFF5091CB,
-0xFF5091CB,
-0xFF5091CB,
-0xFF5091CB,
-0xFF4D88C4,
-0xFF4E89C5,
-0xFF4F8AC6,
-0xFF4F8AC6,
-0xFF4E8AC6,
-0xFF4E8AC6,
-0xFF4F8BC7,
-0xFF4F8BC7,
-0xFF4E8CC7,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF4F8DC8,
-0xFF508CC8,
-0xFF518DC9,
-0xFF528ECA,
-0xFF528ECA,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5493C9,
-0xFF5493C9,
-0xFF5594CA,
-0xFF5594CA,
-0xFF5594CA,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5798CE,
-0xFF5798CE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF5799CD,
-0xFF5799CD,
-0xFF5799CD,
-0xFF5799CD,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5A9CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5A9ECF,
-0xFF5A9ECF,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5AA0D1,
-0xFF5CA0D1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5C9ED0,
-0xFF62A4D4,
-0xFF5C9ECE,
-0xFF5FA1D1,
-0xFF60A0D0,
-0xFF64A4D4,
-0xFF5E9ECE,
-0xFF5E9CCB,
-0xFF619FCE,
-0xFF7FBDEC,
-0xFF62A0D1,
-0xFF609ECF,
-0xFF66A6D6,
-0xFF60A0D0,
-0xFF5E9ECE,
-0xFF63A3D3,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF60A2D2,
-0xFF5CA3D1,
-0xFF5CA5D2,
-0xFF5DA4D2,
-0xFF5FA3D2,
-0xFF60A2D2,
-0xFF62A2D2,
-0xFF63A1D2,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF63A1D4,
-0xFF64A2D5,
-0xFF66A4D7,
-0xFF6B9ECB,
-0xFF84A2C6,
-0xFF4E5A74,
-0xFF131023,
-0xFF858CA6,
-0xFF6B9CC7,
-0xFF5DA0D4,
-0xFF5FA1D3,
-0xFF62A2D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A2D5,
-0xFF63A2D5,
-0xFF64A2D3,
-0xFF64A2D1,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D1,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D3,
-0xFF67A1CF,
-0xFF67A1CF,
-0xFF65A2D1,
-0xFF65A3D4,
-0xFF64A3D6,
-0xFF64A3D6,
-0xFF62A4D8,
-0xFF60A3D7,
-0xFF63A5D9,
-0xFF65A4D7,
-0xFF69A3D5,
-0xFF659DCE,
-0xFF70A6D2,
-0xFF6696BA,
-0xFF99BBD6,
-0xFFE5FFFF,
-0xFFBDE2FF,
-0xFF6B99BB,
-0xFF6A9FC7,
-0xFF649ECC,
-0xFF67A6D9,
-0xFF63A5D9,
-0xFF64A2D3,
-0xFF63A3D3,
-0xFF61A3D5,
-0xFF61A3D7,
-0xFF63A2D5,
-0xFF64A2D3,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF64A2D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D3,
-0xFF63A3D3,
-0xFF63A1D2,
-0xFF62A2D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF5FA1D1,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9FD0,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5B9DD1,
-0xFF5B9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF589BCF,
-0xFF589BCF,
-0xFF579ACE,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5093CA,
-0xFF5192CA,
-0xFF5192CA,
-0xFF4E89C5,
-0xFF4E89C5,
-0xFF4F8AC6,
-0xFF4F8BC7,
-0xFF4F8BC7,
-0xFF4F8BC7,
-0xFF508CC8,
-0xFF508CC8,
-0xFF508EC9,
-0xFF508EC9,
-0xFF518FCA,
-0xFF518FCA,
-0xFF528ECA,
-0xFF538FCB,
-0xFF538FCB,
-0xFF5491CA,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5492CB,
-0xFF5593CC,
-0xFF5594CA,
-0xFF5594CA,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF579ACF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF5799CD,
-0xFF5799CD,
-0xFF589ACE,
-0xFF589ACE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5B9DCF,
-0xFF5A9CD0,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9FD3,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9FD0,
-0xFF5CA0D1,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5D9FD1,
-0xFF5CA0D1,
-0xFF5D9FD1,
-0xFF5CA0D1,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5BA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D1,
-0xFF60A2D2,
-0xFF5D9FCF,
-0xFF5C9ECE,
-0xFF67A9D9,
-0xFF5D9DCD,
-0xFF5F9FCF,
-0xFF65A3D2,
-0xFF63A1D0,
-0xFF7CBAE9,
-0xFF62A0CF,
-0xFF64A2D3,
-0xFF63A1D2,
-0xFF61A1D1,
-0xFF5F9FCF,
-0xFF65A5D5,
-0xFF61A1D1,
-0xFF64A3D6,
-0xFF63A2D5,
-0xFF63A2D5,
-0xFF63A2D5,
-0xFF63A2D5,
-0xFF63A2D5,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF63A2D5,
-0xFF63A3D3,
-0xFF64A4D4,
-0xFF64A2D3,
-0xFF63A3D3,
-0xFF60A4D3,
-0xFF5EA5D3,
-0xFF60A4D3,
-0xFF61A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D3,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D5,
-0xFF64A2D5,
-0xFF65A1D5,
-0xFF66A2D6,
-0xFF659FD1,
-0xFF699FCE,
-0xFF70A0C8,
-0xFF819FBB,
-0xFF332F3D,
-0xFF505163,
-0xFF7DAAD1,
-0xFF62A4D4,
-0xFF64A4D2,
-0xFF66A3D2,
-0xFF68A2D4,
-0xFF66A2D6,
-0xFF64A4D4,
-0xFF61A3D3,
-0xFF63A3D3,
-0xFF63A3D1,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF64A3D6,
-0xFF65A3D4,
-0xFF68A3CF,
-0xFF69A2CF,
-0xFF67A4D1,
-0xFF66A4D5,
-0xFF63A5D7,
-0xFF63A5D9,
-0xFF65A3D6,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF67A4D3,
-0xFF64A1D0,
-0xFF6EA4D0,
-0xFF6A9AC0,
-0xFF94B8D8,
-0xFFE7FFFF,
-0xFFCEECFF,
-0xFF6D9BBF,
-0xFF689ECA,
-0xFF69A3D1,
-0xFF68A6D5,
-0xFF60A2D4,
-0xFF62A4D8,
-0xFF65A5D5,
-0xFF66A4D5,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF66A4D3,
-0xFF67A4D3,
-0xFF67A4D3,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5CA0D1,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF589BCF,
-0xFF589BCF,
-0xFF589BCF,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF599AD0,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5396CD,
-0xFF5295CC,
-0xFF5194CB,
-0xFF5194CB,
-0xFF5293CB,
-0xFF5293CB,
-0xFF4D8AC3,
-0xFF4E8BC4,
-0xFF4F8CC5,
-0xFF4F8CC5,
-0xFF4F8CC5,
-0xFF4F8DC6,
-0xFF4F8DC6,
-0xFF508EC7,
-0xFF518FC8,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5390C9,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5592CB,
-0xFF5492CB,
-0xFF5293C9,
-0xFF5594CA,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5799CD,
-0xFF589ACE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF599BCF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5D9CCF,
-0xFF5B9DCF,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF609FD2,
-0xFF5EA0D2,
-0xFF609FD2,
-0xFF5EA0D2,
-0xFF61A0D3,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA2D3,
-0xFF5FA1D3,
-0xFF5FA3D4,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF5FA1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF64A4D2,
-0xFF63A3D1,
-0xFF62A2D0,
-0xFF619FCE,
-0xFF66A4D3,
-0xFF609DCC,
-0xFF7EBBEA,
-0xFF6CA9D8,
-0xFF64A1D0,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF63A3D3,
-0xFF65A5D5,
-0xFF63A3D3,
-0xFF64A4D4,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D3,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF62A4D4,
-0xFF62A4D4,
-0xFF61A3D3,
-0xFF64A4D4,
-0xFF64A4D2,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF66A2D4,
-0xFF68A2D4,
-0xFF6CA4D5,
-0xFF69A1D0,
-0xFF6BA8D4,
-0xFF79A4C6,
-0xFF6A707E,
-0xFF323846,
-0xFF83ABCF,
-0xFF67A2CE,
-0xFF68A5D1,
-0xFF68A5D2,
-0xFF6DA2D8,
-0xFF69A2D7,
-0xFF63A5D5,
-0xFF60A7D3,
-0xFF63A5D5,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D7,
-0xFF66A4D5,
-0xFF67A4D0,
-0xFF67A4D0,
-0xFF67A4D1,
-0xFF66A6D6,
-0xFF63A7D8,
-0xFF64A6D8,
-0xFF68A4D6,
-0xFF6BA3D4,
-0xFF6AA2D1,
-0xFF67A2CE,
-0xFF6AA8CF,
-0xFF659BBF,
-0xFF92B6D6,
-0xFFE4FFFF,
-0xFFD6F6FF,
-0xFF789FBC,
-0xFF6D9EC6,
-0xFF6DA8D4,
-0xFF67A5D6,
-0xFF61A3D5,
-0xFF64A6D8,
-0xFF64A6D8,
-0xFF64A6D8,
-0xFF66A6D6,
-0xFF68A5D1,
-0xFF69A4D0,
-0xFF67A4D1,
-0xFF66A4D3,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF66A4D5,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A2D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF63A3D3,
-0xFF60A2D2,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5C9ED0,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5B9FD0,
-0xFF5B9FD0,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599CD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5697CD,
-0xFF5697CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5295CA,
-0xFF5194C9,
-0xFF4E8BC4,
-0xFF4F8CC5,
-0xFF508DC6,
-0xFF508DC6,
-0xFF508EC7,
-0xFF508EC7,
-0xFF508EC7,
-0xFF518FC8,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5491CA,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5693CC,
-0xFF5594CA,
-0xFF5394CA,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF589ACE,
-0xFF599BCF,
-0xFF599BCF,
-0xFF599BCF,
-0xFF589ACE,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF609FD2,
-0xFF5F9ED1,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5C9ED0,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF609FD2,
-0xFF5EA0D2,
-0xFF609FD2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF61A0D3,
-0xFF61A0D3,
-0xFF61A0D3,
-0xFF62A0D3,
-0xFF61A0D3,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF62A1D4,
-0xFF60A2D4,
-0xFF62A1D4,
-0xFF61A3D5,
-0xFF63A2D5,
-0xFF61A3D5,
-0xFF63A2D5,
-0xFF63A2D5,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF66A6D4,
-0xFF62A2D0,
-0xFF67A7D5,
-0xFF62A2D0,
-0xFF65A3D2,
-0xFF619FCE,
-0xFF83C0EF,
-0xFF68A5D4,
-0xFF619ECD,
-0xFF67A4D3,
-0xFF69A6D5,
-0xFF62A0CF,
-0xFF68A6D7,
-0xFF64A4D4,
-0xFF65A5D5,
-0xFF64A4D4,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF67A5D6,
-0xFF67A5D6,
-0xFF67A5D6,
-0xFF66A4D5,
-0xFF65A5D5,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF67A3D5,
-0xFF67A4D3,
-0xFF6AA4D2,
-0xFF67A4D3,
-0xFF60A2D4,
-0xFF6EA2CA,
-0xFF92A6BE,
-0xFF2B3A4F,
-0xFF6285A5,
-0xFF76A7CF,
-0xFF69A4CE,
-0xFF67A4D1,
-0xFF6AA1D7,
-0xFF69A2D7,
-0xFF62A6D3,
-0xFF61A8D4,
-0xFF64A6D6,
-0xFF66A6D6,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A5D6,
-0xFF67A5D6,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF66A6D4,
-0xFF64A6D6,
-0xFF66A6D6,
-0xFF68A4D6,
-0xFF6CA6D4,
-0xFF6EA4D2,
-0xFF6CA3CA,
-0xFF689EC0,
-0xFF8AB9D5,
-0xFFE0FEFF,
-0xFFDBF9FF,
-0xFF82ABC9,
-0xFF6B9DC2,
-0xFF6CA3CC,
-0xFF69A6D3,
-0xFF65A5D5,
-0xFF67A9DB,
-0xFF64A4D2,
-0xFF6CAAD9,
-0xFF66A6D6,
-0xFF66A6D4,
-0xFF68A5D1,
-0xFF6AA5D1,
-0xFF67A6D2,
-0xFF65A5D3,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF66A6D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF60A2D4,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5497CC,
-0xFF5497CC,
-0xFF5396CB,
-0xFF5396CB,
-0xFF5295CA,
-0xFF5295CA,
-0xFF4E8CC5,
-0xFF4F8DC6,
-0xFF508EC7,
-0xFF518FC8,
-0xFF518FC8,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5592CB,
-0xFF5592CB,
-0xFF5792CC,
-0xFF5794CD,
-0xFF5594CA,
-0xFF5495CB,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5B9ACF,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5E9DD2,
-0xFF5E9DD2,
-0xFF5E9DD2,
-0xFF5E9DD2,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF5EA0D0,
-0xFF5EA0D0,
-0xFF5EA0D0,
-0xFF5EA0D0,
-0xFF5FA1D1,
-0xFF5FA1D1,
-0xFF5FA1D1,
-0xFF5FA1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF62A0D1,
-0xFF61A1D1,
-0xFF62A0D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF65A1D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF67A5D6,
-0xFF67A5D6,
-0xFF67A7D5,
-0xFF63A3D1,
-0xFF67A6D2,
-0xFF69A8D4,
-0xFF63A0CD,
-0xFF7FBCE9,
-0xFF6EA8D6,
-0xFF629CCA,
-0xFF69A3D1,
-0xFF69A6D3,
-0xFF65A2D1,
-0xFF66A4D3,
-0xFF67A5D6,
-0xFF64A2D3,
-0xFF67A6D9,
-0xFF64A4D4,
-0xFF67A5D6,
-0xFF67A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF67A7D5,
-0xFF66A6D4,
-0xFF65A5D3,
-0xFF66A6D4,
-0xFF68A6D7,
-0xFF68A6D7,
-0xFF67A5D6,
-0xFF66A4D5,
-0xFF67A5D6,
-0xFF67A5D6,
-0xFF67A5D4,
-0xFF68A5D4,
-0xFF68A5D4,
-0xFF68A5D4,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF66A6D2,
-0xFF64A7D2,
-0xFF64A7D2,
-0xFF64A7D2,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF64A4D0,
-0xFF66A9D6,
-0xFF63A2D8,
-0xFF6EA3D7,
-0xFF7BA0CA,
-0xFF7E9BBD,
-0xFF203A5B,
-0xFF8AAED0,
-0xFF6EA3CF,
-0xFF66A4D5,
-0xFF67A4D3,
-0xFF66A4D3,
-0xFF62A6D3,
-0xFF63A7D4,
-0xFF68A4D6,
-0xFF69A5D7,
-0xFF66A6D4,
-0xFF64A7D4,
-0xFF64A7D4,
-0xFF64A7D4,
-0xFF64A7D4,
-0xFF64A7D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D7,
-0xFF67A7D7,
-0xFF67A7D5,
-0xFF68A6D5,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A6D5,
-0xFF66A6D4,
-0xFF66A6D2,
-0xFF6AA4CC,
-0xFF72A4C7,
-0xFF83AAC7,
-0xFFDEFEFF,
-0xFFE0FBFF,
-0xFF8DB0C6,
-0xFF689CC1,
-0xFF6BA8D5,
-0xFF6BA9D8,
-0xFF62A2D0,
-0xFF67A7D7,
-0xFF68A8D6,
-0xFF67A4D0,
-0xFF68A3CD,
-0xFF6AA5D1,
-0xFF68A5D1,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF68A5D4,
-0xFF68A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A5D5,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF61A3D3,
-0xFF60A2D2,
-0xFF60A2D2,
-0xFF60A2D2,
-0xFF5EA2D1,
-0xFF5EA2D1,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD2,
-0xFF5A9DD2,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5298CC,
-0xFF5298CC,
-0xFF5298CC,
-0xFF5298CC,
-0xFF508DC6,
-0xFF508EC7,
-0xFF528FC8,
-0xFF518FC8,
-0xFF5290C9,
-0xFF5290C9,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5391CA,
-0xFF5492CB,
-0xFF5592CB,
-0xFF5592CB,
-0xFF5693CC,
-0xFF5693CC,
-0xFF5794CD,
-0xFF5895CE,
-0xFF5695CB,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5697CD,
-0xFF5596CC,
-0xFF5596CC,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CCF,
-0xFF5E9DD2,
-0xFF5E9DD0,
-0xFF5E9DD2,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF609FD2,
-0xFF609FD2,
-0xFF609FD2,
-0xFF609FD2,
-0xFF609FD2,
-0xFF609FD2,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF5FA1D1,
-0xFF61A1D1,
-0xFF5FA1D1,
-0xFF62A2D2,
-0xFF60A2D2,
-0xFF62A2D2,
-0xFF62A2D0,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1CF,
-0xFF62A0CF,
-0xFF62A0D1,
-0xFF62A0D3,
-0xFF62A0D3,
-0xFF62A0D1,
-0xFF61A1D1,
-0xFF61A1CF,
-0xFF61A1CF,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D0,
-0xFF62A2D0,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A1D2,
-0xFF66A2D4,
-0xFF66A2D4,
-0xFF66A2D4,
-0xFF65A3D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF66A4D5,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF68A5D2,
-0xFF6EA4D2,
-0xFF6DA6D3,
-0xFF68A5D2,
-0xFF67A6D2,
-0xFF64A3CF,
-0xFF63A2CD,
-0xFF82BFEC,
-0xFF69A6D3,
-0xFF68A2D0,
-0xFF6AA4D2,
-0xFF6AA4D2,
-0xFF66A3D0,
-0xFF6AA7D6,
-0xFF68A5D4,
-0xFF68A6D7,
-0xFF67A5D6,
-0xFF66A6D6,
-0xFF68A6D7,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF68A6D5,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF67A7D5,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF66A6D4,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF67A5D6,
-0xFF66A4D3,
-0xFF67A5D6,
-0xFF67A5D4,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A5D4,
-0xFF67A5D4,
-0xFF67A6D2,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF65A8D3,
-0xFF65A8D3,
-0xFF67A7D3,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF68A6D5,
-0xFF67A7D3,
-0xFF64A9D3,
-0xFF66AAD7,
-0xFF65A7DB,
-0xFF68A4DA,
-0xFF6EA0D3,
-0xFF86ABD7,
-0xFF425979,
-0xFF6E88A9,
-0xFF72A5D0,
-0xFF69A7D6,
-0xFF69A7D6,
-0xFF67A7D5,
-0xFF64A8D5,
-0xFF64A8D5,
-0xFF69A6D5,
-0xFF6CA6D6,
-0xFF68A6D5,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF68A8D6,
-0xFF66A9D6,
-0xFF68A8D6,
-0xFF66A9D6,
-0xFF68A8D6,
-0xFF66A9D6,
-0xFF66A8D8,
-0xFF67A7D7,
-0xFF68A6D5,
-0xFF68A7D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF66A9D4,
-0xFF6CABD4,
-0xFF6BA0C2,
-0xFF85AECA,
-0xFFDFFBFF,
-0xFFE3FCFF,
-0xFF9CBCD3,
-0xFF709DBA,
-0xFF6CA7D1,
-0xFF63A5D5,
-0xFF66A8D8,
-0xFF6CACDA,
-0xFF63A3D1,
-0xFF66A5D1,
-0xFF6DA8D4,
-0xFF6CA7D1,
-0xFF6BA6D0,
-0xFF69A6D2,
-0xFF68A8D6,
-0xFF66A8D8,
-0xFF68A8D6,
-0xFF68A8D6,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A8D6,
-0xFF68A8D6,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF68A8D6,
-0xFF68A8D6,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF69A7D6,
-0xFF69A7D6,
-0xFF69A7D6,
-0xFF69A7D6,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF68A5D4,
-0xFF68A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D6,
-0xFF66A4D3,
-0xFF65A5D5,
-0xFF64A4D2,
-0xFF64A4D4,
-0xFF64A4D2,
-0xFF64A4D4,
-0xFF65A5D3,
-0xFF64A4D4,
-0xFF62A4D4,
-0xFF61A3D3,
-0xFF60A2D2,
-0xFF5FA3D2,
-0xFF5FA3D2,
-0xFF5EA2D3,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5C9FD3,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5C9DD3,
-0xFF5C9DD3,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF579ACF,
-0xFF5699CE,
-0xFF5699CE,
-0xFF5598CD,
-0xFF5598CD,
-0xFF5399CD,
-0xFF5497CC,
-0xFF5298CC,
-0xFF528DC7,
-0xFF528FC8,
-0xFF548FC9,
-0xFF5390C9,
-0xFF5390C9,
-0xFF5390C9,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5592C9,
-0xFF5592C9,
-0xFF5592C9,
-0xFF5693CA,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF599BCD,
-0xFF5A9CCE,
-0xFF5B9DCF,
-0xFF5B9DCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5F9FCF,
-0xFF5F9ED1,
-0xFF5F9FCF,
-0xFF609ED1,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF619FD2,
-0xFF619FD2,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF63A1D0,
-0xFF62A2D0,
-0xFF63A1D0,
-0xFF62A2D0,
-0xFF63A1D0,
-0xFF63A3D1,
-0xFF64A2D1,
-0xFF63A3CF,
-0xFF63A3D1,
-0xFF63A3D1,
-0xFF61A3D3,
-0xFF63A3D3,
-0xFF63A3D1,
-0xFF64A3CF,
-0xFF68A2D0,
-0xFF69A1D2,
-0xFF67A0D7,
-0xFF65A1D7,
-0xFF63A2D5,
-0xFF61A3D3,
-0xFF62A5D0,
-0xFF62A5D0,
-0xFF64A4D2,
-0xFF65A3D2,
-0xFF65A4D0,
-0xFF65A4D0,
-0xFF64A4D2,
-0xFF63A5D5,
-0xFF62A4D4,
-0xFF61A3D3,
-0xFF63A3D3,
-0xFF64A4D2,
-0xFF66A4D3,
-0xFF64A2D1,
-0xFF62A2D0,
-0xFF66A6D4,
-0xFF60A2D2,
-0xFF65A5D5,
-0xFF64A4D2,
-0xFF65A3D2,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF65A3D2,
-0xFF64A4D2,
-0xFF63A5D5,
-0xFF62A6D5,
-0xFF60A7D5,
-0xFF62A6D5,
-0xFF65A5D3,
-0xFF66A5D1,
-0xFF67A4D0,
-0xFF67A5CE,
-0xFF68A5D1,
-0xFF67A6D2,
-0xFF65A5D3,
-0xFF64A4D2,
-0xFF67A4D1,
-0xFF67A6D2,
-0xFF61A5D2,
-0xFF62A9D5,
-0xFF68A8D6,
-0xFF66A4D3,
-0xFF65A5D5,
-0xFF65A4D7,
-0xFF69A7DA,
-0xFF64A2D5,
-0xFF6CA9D8,
-0xFF65A4CF,
-0xFF66A5CE,
-0xFF7AB4DA,
-0xFF446E96,
-0xFF709AC2,
-0xFF71A8D1,
-0xFF66A3CF,
-0xFF619ECA,
-0xFF83C1EA,
-0xFF65A2CE,
-0xFF69A6D2,
-0xFF6BA8D4,
-0xFF66A3CF,
-0xFF69A6D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF68A8D4,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF68A8D6,
-0xFF68A8D4,
-0xFF68A8D6,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF68A8D4,
-0xFF69A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF67A7D3,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF68A8D4,
-0xFF66A9D4,
-0xFF65AAD4,
-0xFF63A7D4,
-0xFF69A9D7,
-0xFF6EA8D8,
-0xFF749FCA,
-0xFF7F91B5,
-0xFF516588,
-0xFF75A9CE,
-0xFF68A9D3,
-0xFF69A5D7,
-0xFF69A7DA,
-0xFF63A7D4,
-0xFF63A8D2,
-0xFF68A8D4,
-0xFF6AA9D4,
-0xFF68A7D2,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF66A5D1,
-0xFF6BA8D5,
-0xFF6AA7D4,
-0xFF6BA8D7,
-0xFF67A5D4,
-0xFF69A7D6,
-0xFF68A8D6,
-0xFF68A8D6,
-0xFF66A9D6,
-0xFF65A8D3,
-0xFF64A9D3,
-0xFF65A8D3,
-0xFF65A8D3,
-0xFF67A7D5,
-0xFF68A8D6,
-0xFF6AAAD8,
-0xFF66A6D4,
-0xFF69A7D6,
-0xFF67A5D4,
-0xFF6CA9D8,
-0xFF6DAAD7,
-0xFF6BAAD5,
-0xFF6CA4C7,
-0xFF85AEC4,
-0xFFDCF9FF,
-0xFFE8FDFF,
-0xFFA7C3D9,
-0xFF709EC0,
-0xFF6DA8D2,
-0xFF69A8D4,
-0xFF68A8D6,
-0xFF69A9D7,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF67A7D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A5D4,
-0xFF67A6D2,
-0xFF68A6D5,
-0xFF67A6D2,
-0xFF67A5D4,
-0xFF67A6D2,
-0xFF66A4D3,
-0xFF66A5D1,
-0xFF66A4D3,
-0xFF65A5D3,
-0xFF62A5D2,
-0xFF62A5D2,
-0xFF61A4D1,
-0xFF61A4D1,
-0xFF61A3D3,
-0xFF61A3D3,
-0xFF60A2D2,
-0xFF60A2D2,
-0xFF5FA1D1,
-0xFF5EA0D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5DA1D2,
-0xFF5C9FD3,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF589BCF,
-0xFF589BD0,
-0xFF589BD0,
-0xFF589BD0,
-0xFF579ACF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5699CE,
-0xFF5697CD,
-0xFF5598CD,
-0xFF528DC7,
-0xFF538EC8,
-0xFF548FC9,
-0xFF5590CA,
-0xFF5390C9,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5693CC,
-0xFF5693CA,
-0xFF5693CA,
-0xFF5693CA,
-0xFF5794CB,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5695CB,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5A99CF,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5B9DCF,
-0xFF5B9DCF,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9ECE,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF619FCE,
-0xFF62A0CF,
-0xFF62A0CF,
-0xFF62A0CF,
-0xFF62A0D1,
-0xFF63A1D4,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A3CF,
-0xFF64A3CF,
-0xFF64A4D0,
-0xFF64A4D2,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF64A4D0,
-0xFF66A3CF,
-0xFF68A3CF,
-0xFF69A1D0,
-0xFF69A0D6,
-0xFF66A2D8,
-0xFF65A3D6,
-0xFF62A5D2,
-0xFF62A5CF,
-0xFF62A5CF,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A4CF,
-0xFF66A5CE,
-0xFF65A5D1,
-0xFF62A5D2,
-0xFF63A5D5,
-0xFF66A8D8,
-0xFF67A7D5,
-0xFF64A3CF,
-0xFF65A2CF,
-0xFF6AA7D4,
-0xFF69A8D4,
-0xFF65A4D0,
-0xFF64A4D2,
-0xFF68A8D6,
-0xFF67A6D2,
-0xFF64A3CF,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF67A5D4,
-0xFF66A6D4,
-0xFF63A7D4,
-0xFF61A8D4,
-0xFF61A8D6,
-0xFF63A7D4,
-0xFF64A7D2,
-0xFF67A6D1,
-0xFF68A6CF,
-0xFF68A6CF,
-0xFF69A7D0,
-0xFF68A7D2,
-0xFF67A7D3,
-0xFF66A6D2,
-0xFF67A4D0,
-0xFF68A7D2,
-0xFF61A8D2,
-0xFF5EA7D0,
-0xFF63A3CF,
-0xFF65A4D0,
-0xFF68A6D5,
-0xFF67A7D5,
-0xFF61A1D1,
-0xFF6AA8D7,
-0xFF67A0CB,
-0xFF72A8CE,
-0xFF78ABCA,
-0xFF376481,
-0xFF000825,
-0xFF7198B9,
-0xFF6EA3CB,
-0xFF63A1CA,
-0xFF87C5EE,
-0xFF65A3CC,
-0xFF6BA9D2,
-0xFF6BA9D2,
-0xFF6AA7D3,
-0xFF67A4D0,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF69A7D6,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF69A9D5,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF67A7D3,
-0xFF68A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF68A8D4,
-0xFF64A7D2,
-0xFF68ABD5,
-0xFF67AAD4,
-0xFF66A5D1,
-0xFF75A8D5,
-0xFF85A1C8,
-0xFF556F92,
-0xFF6995B8,
-0xFF76ADD4,
-0xFF69A3D1,
-0xFF64A2D3,
-0xFF6AAAD6,
-0xFF6BACD6,
-0xFF66A5D0,
-0xFF68A5D1,
-0xFF6CABD6,
-0xFF66A5D0,
-0xFF6AA9D4,
-0xFF6CA9D5,
-0xFF6EA8D6,
-0xFF6DAAD7,
-0xFF67A4D3,
-0xFF6DAAD9,
-0xFF6AA8D7,
-0xFF6AA9D5,
-0xFF69A9D5,
-0xFF69A9D5,
-0xFF69AAD4,
-0xFF67AAD5,
-0xFF66A9D4,
-0xFF66A9D4,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6DABDA,
-0xFF70AEDD,
-0xFF66A4D3,
-0xFF6CA9D5,
-0xFF6CA4C9,
-0xFF77A5BF,
-0xFFD3F3FF,
-0xFFE6FFFF,
-0xFFB9D4E7,
-0xFF759AB5,
-0xFF70A7D0,
-0xFF6AA8D7,
-0xFF69A7D6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF66A5D1,
-0xFF66A5D1,
-0xFF66A5D1,
-0xFF66A6D4,
-0xFF63A6D3,
-0xFF64A4D2,
-0xFF62A5D2,
-0xFF62A4D4,
-0xFF61A3D3,
-0xFF61A3D3,
-0xFF60A2D2,
-0xFF60A2D2,
-0xFF5FA1D1,
-0xFF5EA0D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5DA1D2,
-0xFF5CA0D1,
-0xFF5CA0D1,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5A9DD1,
-0xFF599CD0,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF589BD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5798CE,
-0xFF5697CD,
-0xFF528FC8,
-0xFF5390C9,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5693CA,
-0xFF5794CB,
-0xFF5895CC,
-0xFF5895CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5D9CD1,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF5F9FCF,
-0xFF60A0D0,
-0xFF60A0D0,
-0xFF61A1D1,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A5D1,
-0xFF65A5D3,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF64A4D2,
-0xFF65A4CF,
-0xFF66A3CF,
-0xFF66A3CF,
-0xFF68A4D6,
-0xFF68A4D6,
-0xFF66A4D3,
-0xFF65A5D1,
-0xFF65A6D0,
-0xFF66A5D0,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A6CF,
-0xFF66A5CE,
-0xFF67A6D1,
-0xFF67A6D2,
-0xFF65A4D0,
-0xFF62A1CD,
-0xFF64A3CF,
-0xFF6AA7D3,
-0xFF6BA4D1,
-0xFF6BA4D1,
-0xFF68A3CF,
-0xFF65A2CE,
-0xFF68A7D2,
-0xFF67A6D1,
-0xFF66A5D0,
-0xFF6BA8D4,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF67A6D2,
-0xFF66A6D2,
-0xFF64A7D2,
-0xFF63A8D2,
-0xFF64A8D5,
-0xFF65A8D3,
-0xFF67A7D3,
-0xFF67A6D1,
-0xFF68A5D1,
-0xFF68A5D1,
-0xFF69A6D2,
-0xFF68A7D2,
-0xFF67A7D3,
-0xFF65A8D5,
-0xFF6AA9D5,
-0xFF67A8D2,
-0xFF62AAD2,
-0xFF64A9D2,
-0xFF68A8D4,
-0xFF6BA8D4,
-0xFF6BA9D0,
-0xFF67A7CD,
-0xFF67AAD4,
-0xFF69A8D1,
-0xFF81B1D7,
-0xFF4C6F8B,
-0xFFB6D0DF,
-0xFFEAFFFF,
-0xFF052A3D,
-0xFF82B1CD,
-0xFF6EA6CB,
-0xFF81BFE8,
-0xFF6AA8D1,
-0xFF69A7D0,
-0xFF6CA9D5,
-0xFF67A4D0,
-0xFF6BA8D4,
-0xFF6AA7D3,
-0xFF6AA7D4,
-0xFF6BA8D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A7D6,
-0xFF6AA8D7,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA7D4,
-0xFF69A8D4,
-0xFF6BAAD5,
-0xFF6AA9D4,
-0xFF6AA9D5,
-0xFF6EA9D5,
-0xFF76AAD2,
-0xFF709AC0,
-0xFF415F83,
-0xFF84A6CB,
-0xFF73A8D0,
-0xFF6EADD6,
-0xFF6EACD1,
-0xFF67A1C7,
-0xFF73A9D5,
-0xFF6EA7D4,
-0xFF68A6D5,
-0xFF69ACD9,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF69A6D2,
-0xFF6DAAD6,
-0xFF67A4D1,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF6BAAD5,
-0xFF6CAAD3,
-0xFF6EA9D1,
-0xFF6EA9D3,
-0xFF6CA9D5,
-0xFF6BA9D8,
-0xFF6BA9D8,
-0xFF6DACD7,
-0xFF6BA9D2,
-0xFF6CA6D4,
-0xFF6DA7D5,
-0xFF6AA5D1,
-0xFF6BA8D4,
-0xFF6EAEDC,
-0xFF6CA6CE,
-0xFF7AA3BF,
-0xFFCCEBFF,
-0xFFEBFFFF,
-0xFFBFDCEE,
-0xFF6E9CB6,
-0xFF75ABCF,
-0xFF6EA7D2,
-0xFF6DA7D5,
-0xFF6BA8D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A6D5,
-0xFF66A6D4,
-0xFF67A5D4,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF64A4D2,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF5FA1D1,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5B9DD1,
-0xFF5B9DD1,
-0xFF5B9DD1,
-0xFF5B9DD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5899CF,
-0xFF5798CE,
-0xFF5390C9,
-0xFF5491CA,
-0xFF5592CB,
-0xFF5592CB,
-0xFF5592CB,
-0xFF5693CC,
-0xFF5693CA,
-0xFF5794CB,
-0xFF5996CD,
-0xFF5996CD,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CE,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF609FD2,
-0xFF60A0D0,
-0xFF60A0D0,
-0xFF60A0D0,
-0xFF60A0D0,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF63A1D0,
-0xFF65A3D4,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A6D2,
-0xFF66A4D3,
-0xFF66A4D5,
-0xFF65A5D5,
-0xFF65A5D3,
-0xFF65A5D1,
-0xFF65A6D0,
-0xFF66A5D0,
-0xFF67A6D2,
-0xFF67A5D4,
-0xFF67A6D2,
-0xFF67A6D1,
-0xFF67A6D1,
-0xFF67A6D1,
-0xFF68A5D4,
-0xFF66A4D3,
-0xFF66A7D1,
-0xFF68A9D3,
-0xFF68A7D3,
-0xFF65A4D0,
-0xFF67A5D4,
-0xFF69A9D7,
-0xFF69A9D5,
-0xFF66A5D1,
-0xFF69A4D0,
-0xFF6CA5D2,
-0xFF6AA5D1,
-0xFF6BA8D4,
-0xFF6AA9D4,
-0xFF6BAAD5,
-0xFF68A5D1,
-0xFF67A4D0,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A7D3,
-0xFF67A8D2,
-0xFF67A7D3,
-0xFF67A8D2,
-0xFF68A7D2,
-0xFF69A6D2,
-0xFF68A5D1,
-0xFF67A6D1,
-0xFF67A6D2,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF69A9D7,
-0xFF63A3CF,
-0xFF64A7D1,
-0xFF67AAD4,
-0xFF6AA9D4,
-0xFF6AA8D1,
-0xFF6BA7CB,
-0xFF6BA7CB,
-0xFF6AAACE,
-0xFF72A8CC,
-0xFF6485A4,
-0xFF000519,
-0xFF505559,
-0xFFBCC7C9,
-0xFF7596A5,
-0xFF76A5BF,
-0xFF83BBE0,
-0xFF68A6CF,
-0xFF6BA9D2,
-0xFF69A7D0,
-0xFF6CA9D5,
-0xFF68A5D1,
-0xFF6DAAD6,
-0xFF6BA8D4,
-0xFF6BA8D5,
-0xFF6BA8D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA8D7,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6DAAD6,
-0xFF6FAAD6,
-0xFF6DA8D4,
-0xFF6BA9D2,
-0xFF6BAAD5,
-0xFF6CACD8,
-0xFF68A7D3,
-0xFF6CA9D5,
-0xFF82B2DA,
-0xFF41577C,
-0xFF889FC1,
-0xFF75A5CB,
-0xFF6DA9CE,
-0xFF6DA9CD,
-0xFF97CDF3,
-0xFF7EACD0,
-0xFF73A0C7,
-0xFF72A8D4,
-0xFF70ADD9,
-0xFF6AA7D3,
-0xFF6CA9D5,
-0xFF6DACD7,
-0xFF6EADD8,
-0xFF6CABD7,
-0xFF68A7D2,
-0xFF6BAAD5,
-0xFF6CAAD3,
-0xFF6FAAD2,
-0xFF70AAD2,
-0xFF70A9D4,
-0xFF6FAAD6,
-0xFF6FA9D7,
-0xFF6FA9D7,
-0xFF6DA8D0,
-0xFF6CA7CF,
-0xFF72ABD8,
-0xFF72ABD8,
-0xFF6EA9D5,
-0xFF6DABD4,
-0xFF6BA6CE,
-0xFF75A6C6,
-0xFFC8E4F9,
-0xFFE5FBFF,
-0xFFC9E6F8,
-0xFF7CA4BD,
-0xFF72AACD,
-0xFF6BA9D2,
-0xFF71AAD7,
-0xFF72ABD8,
-0xFF6CA9D6,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A7D6,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF65A5D3,
-0xFF65A5D5,
-0xFF65A5D5,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF63A2D5,
-0xFF60A2D4,
-0xFF61A0D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D4,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5B9DD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF5A9BD1,
-0xFF599AD0,
-0xFF599AD0,
-0xFF5899CF,
-0xFF5491C8,
-0xFF5491C8,
-0xFF5592C9,
-0xFF5693CA,
-0xFF5693CA,
-0xFF5693CA,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5A99CE,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9FCF,
-0xFF60A0D0,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A4D1,
-0xFF66A4D3,
-0xFF66A4D7,
-0xFF65A4D7,
-0xFF66A6D6,
-0xFF64A7D2,
-0xFF64A7D1,
-0xFF64A8CF,
-0xFF66A7D1,
-0xFF67A6D1,
-0xFF67A6D1,
-0xFF68A5D1,
-0xFF68A5D1,
-0xFF68A5D2,
-0xFF67A5D6,
-0xFF68A6D7,
-0xFF64A4D2,
-0xFF65A5D3,
-0xFF68A6D7,
-0xFF69A7D8,
-0xFF65A7D7,
-0xFF61A8D6,
-0xFF61A8D6,
-0xFF62A9D7,
-0xFF6AAADA,
-0xFF67A5D6,
-0xFF64A4D2,
-0xFF6BABD9,
-0xFF60A3CE,
-0xFF66A6D2,
-0xFF68A5D2,
-0xFF6BA5D3,
-0xFF6AA7D4,
-0xFF69A8D4,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D1,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D4,
-0xFF69A8D4,
-0xFF69A7D6,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF69A9D5,
-0xFF6BA8D7,
-0xFF68A5D4,
-0xFF6AA8D7,
-0xFF68A8D4,
-0xFF68A5D1,
-0xFF6AA8CF,
-0xFF6CA8CC,
-0xFF74ACCF,
-0xFF7AAAD0,
-0xFF8AADCD,
-0xFF111D33,
-0xFF7D7B86,
-0xFF1A1511,
-0xFF4F5352,
-0xFF839DAC,
-0xFF94C0DD,
-0xFF75ACD3,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF69A6D2,
-0xFF6DAAD6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6BA8D5,
-0xFF6BA8D5,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DABD4,
-0xFF71ABD3,
-0xFF6CA7CF,
-0xFF6CADD5,
-0xFF6AADD7,
-0xFF69A9D5,
-0xFF6FACD9,
-0xFF70AAD8,
-0xFF78A3CE,
-0xFF899CC4,
-0xFF415377,
-0xFF89B0D9,
-0xFF73A8D0,
-0xFF6CAAD1,
-0xFFC1F7FF,
-0xFFD7FBFF,
-0xFFA3C3DC,
-0xFF79A2C2,
-0xFF72A4C9,
-0xFF75ACD3,
-0xFF6EACD5,
-0xFF6BABD7,
-0xFF69ACD7,
-0xFF6DAED8,
-0xFF6EADD6,
-0xFF6CACD2,
-0xFF6DABD2,
-0xFF6DABD4,
-0xFF6FAAD4,
-0xFF6FAAD6,
-0xFF70A9D6,
-0xFF74A8D7,
-0xFF74A9D5,
-0xFF74AED4,
-0xFF72ACD2,
-0xFF70A9D4,
-0xFF6DA6D3,
-0xFF6BA9D8,
-0xFF71AAD5,
-0xFF74A1BE,
-0xFFB5D4E8,
-0xFFECFCFF,
-0xFFE6F9FF,
-0xFF7CA5C3,
-0xFF70A8CD,
-0xFF6FADD4,
-0xFF6DACD5,
-0xFF73AEDA,
-0xFF6BA6D2,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6BA8D5,
-0xFF6BA8D5,
-0xFF6BA8D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF68A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF65A3D4,
-0xFF63A3D3,
-0xFF63A1D2,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF609FD2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5C9ED0,
-0xFF5C9ED2,
-0xFF5B9DD1,
-0xFF5B9DD1,
-0xFF5A9CD0,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF599CD1,
-0xFF5592C9,
-0xFF5592C9,
-0xFF5693CA,
-0xFF5693CA,
-0xFF5794CB,
-0xFF5794CB,
-0xFF5796CC,
-0xFF5796CC,
-0xFF5897CD,
-0xFF5897CD,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5D9CD1,
-0xFF5D9CD1,
-0xFF5E9DD2,
-0xFF5E9DD2,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF609FD2,
-0xFF609FD2,
-0xFF60A0D0,
-0xFF61A1D1,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF65A3D4,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A6D2,
-0xFF68A5D2,
-0xFF68A5D4,
-0xFF67A5D8,
-0xFF67A5D8,
-0xFF66A6D6,
-0xFF65A8D3,
-0xFF64A9D2,
-0xFF64A9D0,
-0xFF66A7CF,
-0xFF67A8D0,
-0xFF69A7D0,
-0xFF69A6D2,
-0xFF69A6D2,
-0xFF68A7D3,
-0xFF68A6D7,
-0xFF67A7D7,
-0xFF66A8D8,
-0xFF67A7D7,
-0xFF69A5D7,
-0xFF69A5D7,
-0xFF68A6D5,
-0xFF68A7D2,
-0xFF6BA9D2,
-0xFF6FAAD2,
-0xFF72A7D1,
-0xFF71A6D2,
-0xFF6DA6D3,
-0xFF6CA9D6,
-0xFF63A6D1,
-0xFF6AAAD6,
-0xFF6EA8D6,
-0xFF6CA6D4,
-0xFF6AA7D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D3,
-0xFF6AA7D3,
-0xFF6AA8D1,
-0xFF6DA8D2,
-0xFF6DA8D2,
-0xFF6DA8D4,
-0xFF6BA8D5,
-0xFF6AA8D7,
-0xFF6AA8D7,
-0xFF68A8D6,
-0xFF69A9D5,
-0xFF69AAD4,
-0xFF6AA9D4,
-0xFF6CA9D8,
-0xFF6DA9DB,
-0xFF6DABDC,
-0xFF68A6D5,
-0xFF6BA8D4,
-0xFF71ACD4,
-0xFF6FA7CA,
-0xFF74A7C6,
-0xFF6F93B3,
-0xFF31455D,
-0xFF211B27,
-0xFFCABABB,
-0xFF402F28,
-0xFF4E4D4B,
-0xFF173142,
-0xFF78A3C3,
-0xFF71A8CF,
-0xFF6BA8D4,
-0xFF6FACD8,
-0xFF6CA9D5,
-0xFF6AA7D3,
-0xFF6CA9D5,
-0xFF70ADD9,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6DAAD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6FAAD4,
-0xFF6FA9D1,
-0xFF72ADD5,
-0xFF6DAED8,
-0xFF68ABD5,
-0xFF6AA9D4,
-0xFF72ADD9,
-0xFF70A8D7,
-0xFF77A3D0,
-0xFF93ADD2,
-0xFF596C8D,
-0xFF768EB2,
-0xFF86ACD1,
-0xFF6EA8D0,
-0xFF70A8CD,
-0xFFC2E4FD,
-0xFFE8FFFF,
-0xFFCBE9FF,
-0xFF86ABC6,
-0xFF77A5C7,
-0xFF71A9CE,
-0xFF69A7D0,
-0xFF6CADD7,
-0xFF6FB0D8,
-0xFF6CACD2,
-0xFF6EACD3,
-0xFF6EACD3,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF70AAD8,
-0xFF71AAD7,
-0xFF74A8D7,
-0xFF74A9D3,
-0xFF72AACF,
-0xFF71ABD0,
-0xFF72ACD4,
-0xFF72ADD9,
-0xFF75B0DC,
-0xFF6FA1C6,
-0xFFA9C8DD,
-0xFFEBFEFF,
-0xFFE5F7FF,
-0xFF92AEC3,
-0xFF78AACD,
-0xFF70AFDA,
-0xFF6CADD7,
-0xFF6AA9D4,
-0xFF73B1DA,
-0xFF6DA8D2,
-0xFF71ACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6BA8D5,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF69A6D3,
-0xFF69A6D5,
-0xFF69A6D5,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D6,
-0xFF66A4D5,
-0xFF66A4D5,
-0xFF65A3D4,
-0xFF64A2D3,
-0xFF64A2D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF5FA1D1,
-0xFF5EA0D2,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5C9ED0,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5B9DD1,
-0xFF5B9DD1,
-0xFF5A9DD2,
-0xFF5A9DD2,
-0xFF5A9DD2,
-0xFF5A9DD2,
-0xFF5594CA,
-0xFF5594CA,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5796CB,
-0xFF5796CB,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5B9ACD,
-0xFF5B9ACD,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5E9CCF,
-0xFF5E9CCF,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF609ED1,
-0xFF609ED1,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A5D7,
-0xFF68A6D9,
-0xFF67A7D7,
-0xFF65A8D5,
-0xFF65AAD3,
-0xFF65AAD1,
-0xFF68A9D1,
-0xFF68A9D1,
-0xFF6AA8D1,
-0xFF6AA7D3,
-0xFF69A8D4,
-0xFF69A7D6,
-0xFF66A8D8,
-0xFF66A8D8,
-0xFF62A6D5,
-0xFF6BABD9,
-0xFF6FA9D9,
-0xFF6FA5D3,
-0xFF78A9D2,
-0xFF85B1D4,
-0xFF84A9C4,
-0xFF7898B1,
-0xFF6C86A1,
-0xFF809DBB,
-0xFF87AFD3,
-0xFF76AAD2,
-0xFF6FADD6,
-0xFF67A8D2,
-0xFF6BA6D2,
-0xFF6DA8D4,
-0xFF69A8D4,
-0xFF68A8D6,
-0xFF68A8D6,
-0xFF6AA9D5,
-0xFF6BA8D4,
-0xFF6BA9D2,
-0xFF6DA8D2,
-0xFF6EA7D2,
-0xFF6DA8D4,
-0xFF6BA8D5,
-0xFF6BA9D8,
-0xFF6AAADA,
-0xFF69A9D7,
-0xFF69A9D5,
-0xFF6AA9D2,
-0xFF6BAAD3,
-0xFF69A9D5,
-0xFF69A9D7,
-0xFF6BABD9,
-0xFF68A7D3,
-0xFF70ABD7,
-0xFF73AAD1,
-0xFF6EA3C3,
-0xFF80ACC5,
-0xFF5A7789,
-0xFF00010C,
-0xFF412F2F,
-0xFF967973,
-0xFF311811,
-0xFF484244,
-0xFF031F34,
-0xFF7AABCB,
-0xFF6FA9D1,
-0xFF73B0DC,
-0xFF68A5D1,
-0xFF6AA7D3,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6CA9D5,
-0xFF6FACD8,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6DABD4,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF70ABD5,
-0xFF70ABD7,
-0xFF6EA8D6,
-0xFF73B0DD,
-0xFF6BABD7,
-0xFF6CADD7,
-0xFF6FADD6,
-0xFF71AAD5,
-0xFF70A6D4,
-0xFF7EAFD8,
-0xFF81AACA,
-0xFF748EA9,
-0xFF4C506B,
-0xFFA0ABC9,
-0xFF78A8D0,
-0xFF71ABD3,
-0xFF79A1C4,
-0xFFB9D7F1,
-0xFFE4F9FF,
-0xFFE4FBFF,
-0xFFB2D4ED,
-0xFF7DAAC7,
-0xFF74AACE,
-0xFF73AFD4,
-0xFF6CAAD1,
-0xFF72B0D7,
-0xFF70AED5,
-0xFF70AED7,
-0xFF6EADD8,
-0xFF6EADD9,
-0xFF6FACD9,
-0xFF71ACD8,
-0xFF74AAD8,
-0xFF74ABD4,
-0xFF73ADD3,
-0xFF72AED3,
-0xFF6EADD6,
-0xFF70ABD3,
-0xFF76AAD1,
-0xFF91B6D3,
-0xFFE8F8FF,
-0xFFECFAFF,
-0xFFA6C6DD,
-0xFF73A2C0,
-0xFF76AED3,
-0xFF6FACD8,
-0xFF6BABD9,
-0xFF72B2DE,
-0xFF6EA9D1,
-0xFF75B0D8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6DAAD7,
-0xFF6CA9D6,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D5,
-0xFF6AA7D4,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF64A4D2,
-0xFF63A3D1,
-0xFF62A2D0,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF61A1D1,
-0xFF60A0D0,
-0xFF5F9FCF,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD3,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5C9ED2,
-0xFF5B9ED2,
-0xFF5A9DD1,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5695CB,
-0xFF5796CC,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5C9BD0,
-0xFF5C9BD0,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF5F9DD0,
-0xFF609ED1,
-0xFF609ED1,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF68A6D5,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA7D3,
-0xFF6AA7D4,
-0xFF6AA6D8,
-0xFF69A7D8,
-0xFF69A7D8,
-0xFF68A8D6,
-0xFF66A9D3,
-0xFF66AAD1,
-0xFF69AAD0,
-0xFF6AA9D2,
-0xFF6AA9D4,
-0xFF6BA8D5,
-0xFF69A7D6,
-0xFF68A8D6,
-0xFF66A9D6,
-0xFF66A9D6,
-0xFF6AAAD6,
-0xFF6DA6D1,
-0xFF7BA7CE,
-0xFF7EA1C1,
-0xFF688299,
-0xFF435464,
-0xFF2F3942,
-0xFF31363C,
-0xFF41414B,
-0xFF1F232F,
-0xFF162538,
-0xFF3E5A72,
-0xFF82AECB,
-0xFF7CB1D3,
-0xFF72A6CE,
-0xFF71A7D3,
-0xFF6CA9D6,
-0xFF6BAAD6,
-0xFF6AAAD8,
-0xFF6AAAD8,
-0xFF6BAAD6,
-0xFF6CA9D5,
-0xFF6EA9D3,
-0xFF6FA8D3,
-0xFF6EA9D5,
-0xFF6DAAD7,
-0xFF6DABDA,
-0xFF6CACDC,
-0xFF6BABD9,
-0xFF6CABD7,
-0xFF6DABD2,
-0xFF6DABD2,
-0xFF6BACD6,
-0xFF6BABD7,
-0xFF70AFDB,
-0xFF6EABD8,
-0xFF70ABD7,
-0xFF6FA5CB,
-0xFF7CA8C3,
-0xFFA7C6D8,
-0xFFBDCCD1,
-0xFFEAE5E1,
-0xFFFFE5DA,
-0xFFDAB4A7,
-0xFF715047,
-0xFF362B2F,
-0xFF5D788D,
-0xFF7EB0D1,
-0xFF72ACD4,
-0xFF6CA9D5,
-0xFF70ADD9,
-0xFF71AEDA,
-0xFF6CA9D5,
-0xFF6FACD8,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6EACD5,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF71AFD8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD8,
-0xFF72ACDC,
-0xFF6FACDB,
-0xFF6BAAD6,
-0xFF72B1DA,
-0xFF70ABD3,
-0xFF75ACD5,
-0xFF76ACD8,
-0xFF74A9D1,
-0xFF78AACB,
-0xFF91B1CA,
-0xFF3B364D,
-0xFF504D68,
-0xFF8AB0D5,
-0xFF75ACD5,
-0xFF80ADD4,
-0xFF7A9EBE,
-0xFFB4CFE4,
-0xFFE4FBFF,
-0xFFE2FDFF,
-0xFFD0F1FF,
-0xFF9AC2DB,
-0xFF74A1BE,
-0xFF79AECE,
-0xFF73ABD0,
-0xFF73AED8,
-0xFF71AEDA,
-0xFF71AEDA,
-0xFF71AEDA,
-0xFF72ADD9,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD4,
-0xFF72B0D7,
-0xFF71B0D9,
-0xFF74ACCF,
-0xFF82A9C6,
-0xFFD6F1FF,
-0xFFEEFEFF,
-0xFFB9D0E2,
-0xFF77A2C2,
-0xFF77AFD4,
-0xFF73ADD3,
-0xFF70AED7,
-0xFF70AEDD,
-0xFF73B2DE,
-0xFF71ACD4,
-0xFF75AFD5,
-0xFF72ADD5,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6DAAD7,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D6,
-0xFF6BA8D5,
-0xFF6AA7D4,
-0xFF69A6D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF69A7D6,
-0xFF69A7D6,
-0xFF68A6D5,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF65A5D3,
-0xFF64A4D2,
-0xFF63A3D1,
-0xFF62A2D0,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF61A1D1,
-0xFF5F9FCF,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D4,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5D9FD3,
-0xFF5B9ED2,
-0xFF5B9ED2,
-0xFF5796CB,
-0xFF5796CB,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5897CC,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACD,
-0xFF5B9ACD,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF67A4D3,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D2,
-0xFF68A7D2,
-0xFF68A7D2,
-0xFF68A7D2,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF68A7D2,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA8D7,
-0xFF6AA8D9,
-0xFF6AA8D9,
-0xFF6AA8D7,
-0xFF6AA9D4,
-0xFF6AA9D2,
-0xFF69A9CF,
-0xFF6BAAD3,
-0xFF6BAAD6,
-0xFF68A6D5,
-0xFF6DABDA,
-0xFF6CAAD9,
-0xFF68A9D3,
-0xFF6BA9D2,
-0xFF72A8D4,
-0xFF87B2D5,
-0xFF7D8FA7,
-0xFF5B5B63,
-0xFF6F6460,
-0xFF524233,
-0xFF907F6F,
-0xFFBEAB9C,
-0xFFE1CBBE,
-0xFFB6A095,
-0xFF6A5951,
-0xFF484340,
-0xFF09131C,
-0xFF4B647A,
-0xFF8DB3D8,
-0xFF7AA9D5,
-0xFF71A7D3,
-0xFF6EABD7,
-0xFF6EADD9,
-0xFF6CACDA,
-0xFF69A9D7,
-0xFF6CABD7,
-0xFF70ABD5,
-0xFF70A9D4,
-0xFF72ABD8,
-0xFF70AAD8,
-0xFF6DABDA,
-0xFF6BABDB,
-0xFF6DABDA,
-0xFF6EABD7,
-0xFF71ADD2,
-0xFF71ADD2,
-0xFF6FAFD5,
-0xFF6CABD4,
-0xFF70AED7,
-0xFF71ACD6,
-0xFF71AAD7,
-0xFF77A7CB,
-0xFF95B4C8,
-0xFFE8F5FB,
-0xFFF8F1E9,
-0xFFF1DCCB,
-0xFFD7B29F,
-0xFFCBA290,
-0xFF956F62,
-0xFF302021,
-0xFF7D91A9,
-0xFF7FABD0,
-0xFF74ABD4,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF72ADD5,
-0xFF72ADD7,
-0xFF71AEDB,
-0xFF71AEDB,
-0xFF73AEDA,
-0xFF74AFD7,
-0xFF77AED5,
-0xFF77AED5,
-0xFF73AED8,
-0xFF73AED6,
-0xFF76AED3,
-0xFF88ACCC,
-0xFF9393AD,
-0xFF54516C,
-0xFF7E9CBE,
-0xFF7CACD2,
-0xFF7AABD4,
-0xFF7DADD5,
-0xFF77A2C4,
-0xFFA3C5DE,
-0xFFDFF6FF,
-0xFFE2F5FC,
-0xFFEAFBFF,
-0xFFCCE2EF,
-0xFF86AAC2,
-0xFF7AA8CA,
-0xFF77ADD9,
-0xFF72AFDC,
-0xFF73AEDA,
-0xFF78B3DD,
-0xFF74AED4,
-0xFF74B0D5,
-0xFF6CACD2,
-0xFF74B3DC,
-0xFF71B0D9,
-0xFF6DADD3,
-0xFF73B1D6,
-0xFF7AABC9,
-0xFFC7E1F2,
-0xFFEAFDFF,
-0xFFBFDEFA,
-0xFF77A2C4,
-0xFF79ADD2,
-0xFF75AFD5,
-0xFF74AFD7,
-0xFF74AFD9,
-0xFF74AFDB,
-0xFF74AFD9,
-0xFF74AFD7,
-0xFF74B0D5,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73ACD9,
-0xFF72ABD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A7D3,
-0xFF68A8D4,
-0xFF67A7D3,
-0xFF67A7D3,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF66A5D1,
-0xFF65A4D0,
-0xFF65A3D2,
-0xFF64A2D1,
-0xFF63A3D1,
-0xFF62A2D0,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5C9ED0,
-0xFF5C9ED0,
-0xFF5796CB,
-0xFF5897CC,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5998CD,
-0xFF5A99CE,
-0xFF5B9ACF,
-0xFF5B9ACF,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF69A8D3,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D4,
-0xFF6AA9D2,
-0xFF6AA9D2,
-0xFF6AA9D5,
-0xFF6AA8D7,
-0xFF6BA8D7,
-0xFF6BA8D7,
-0xFF6EA9D5,
-0xFF6EA9D3,
-0xFF70AED7,
-0xFF6CAAD3,
-0xFF6DACD8,
-0xFF6BA9D8,
-0xFF69A6D5,
-0xFF6CA7D3,
-0xFF6FA9CE,
-0xFF78AACB,
-0xFF83A7C7,
-0xFF4B6075,
-0xFF58555C,
-0xFF9A8780,
-0xFF93745F,
-0xFF4E2A10,
-0xFF6B4930,
-0xFF785841,
-0xFF6F4F3A,
-0xFF876653,
-0xFF997865,
-0xFF624B3D,
-0xFF615853,
-0xFF171B24,
-0xFF1A2C44,
-0xFF87A8C9,
-0xFF81AED5,
-0xFF72A7D1,
-0xFF6EA9D5,
-0xFF6EADD9,
-0xFF6DADDB,
-0xFF6FAEDA,
-0xFF73AEDA,
-0xFF70A9D4,
-0xFF72ABD8,
-0xFF71ACD8,
-0xFF6DABDA,
-0xFF6CACDA,
-0xFF6EADD9,
-0xFF6FADD6,
-0xFF72ACD2,
-0xFF72ACD1,
-0xFF6FADD2,
-0xFF6EACD3,
-0xFF72ADD7,
-0xFF73ACD9,
-0xFF72A8D4,
-0xFF7DA8CA,
-0xFFAEC1D0,
-0xFFF0EFED,
-0xFFF9E3D5,
-0xFFDFBFA8,
-0xFFBA957B,
-0xFF6A442F,
-0xFF462418,
-0xFF352629,
-0xFF374761,
-0xFF87AED5,
-0xFF76ABD5,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED6,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AEDA,
-0xFF74AFD9,
-0xFF75AFD7,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF74AFD9,
-0xFF74AFDB,
-0xFF72ACD4,
-0xFF83ADD3,
-0xFF9AA9CA,
-0xFF4E5977,
-0xFF506B89,
-0xFF8CB3D4,
-0xFF79A9D1,
-0xFF77AAD5,
-0xFF77ABD3,
-0xFF79A6C7,
-0xFF95B4C8,
-0xFFE2F6FF,
-0xFFE7F5F8,
-0xFFEDFAFF,
-0xFFE5FBFF,
-0xFFAACAE1,
-0xFF7AA5C7,
-0xFF78A8D0,
-0xFF7CB0D8,
-0xFF76ADD4,
-0xFF75AFD4,
-0xFF76B2D6,
-0xFF74B4D8,
-0xFF6FAFD3,
-0xFF73B3D9,
-0xFF75B1D6,
-0xFF77ACCC,
-0xFF9AC2DB,
-0xFFE8FFFF,
-0xFFD2ECFD,
-0xFF749FC1,
-0xFF7AAFD7,
-0xFF78AFD6,
-0xFF76B0D6,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D6,
-0xFF75AFD5,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF75B0DA,
-0xFF75B0DA,
-0xFF75B0DA,
-0xFF75B0DA,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73ACD9,
-0xFF73ACD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DACD7,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF67A7D3,
-0xFF67A7D5,
-0xFF67A7D5,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF66A5D1,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF60A2D4,
-0xFF5FA1D3,
-0xFF5FA1D3,
-0xFF5EA0D2,
-0xFF5D9FD1,
-0xFF5D9FD1,
-0xFF5897CA,
-0xFF5998CB,
-0xFF5A99CC,
-0xFF5A99CC,
-0xFF5B9ACD,
-0xFF5B9ACD,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF619FCE,
-0xFF62A0CF,
-0xFF62A0CF,
-0xFF62A0CF,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A4D0,
-0xFF66A5D1,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DABD4,
-0xFF6CAAD3,
-0xFF6BAAD5,
-0xFF6BAAD6,
-0xFF6CA9D6,
-0xFF6FA9D7,
-0xFF70A9D6,
-0xFF70A9D4,
-0xFF6DA8D2,
-0xFF6EABD7,
-0xFF6EACDB,
-0xFF6EABDA,
-0xFF73ACD9,
-0xFF74AAD0,
-0xFF7AA9C5,
-0xFF86A7BA,
-0xFF646F75,
-0xFF443F3C,
-0xFF9D8B7F,
-0xFFCFB4A1,
-0xFFC9A690,
-0xFF552F18,
-0xFF7C5842,
-0xFF54311E,
-0xFF583728,
-0xFF4F2F22,
-0xFF573A2C,
-0xFF705649,
-0xFF635147,
-0xFF554A46,
-0xFF1A1519,
-0xFF28323E,
-0xFF8BA9C5,
-0xFF83AFD4,
-0xFF76AAD2,
-0xFF73AEDA,
-0xFF6EADD9,
-0xFF6DACD8,
-0xFF6FACD8,
-0xFF72ADD7,
-0xFF73ACD7,
-0xFF72ADD9,
-0xFF6FACDB,
-0xFF6FADDC,
-0xFF6FAEDA,
-0xFF70AED7,
-0xFF75ACD3,
-0xFF75ADD0,
-0xFF74AED3,
-0xFF70ABD3,
-0xFF75B2E1,
-0xFF70AADA,
-0xFF7AAED6,
-0xFF7EA1BD,
-0xFFC0CAD4,
-0xFFF8EDEB,
-0xFFF5D8CA,
-0xFFBA947F,
-0xFF916D55,
-0xFF452612,
-0xFF3C251F,
-0xFF342D35,
-0xFF000120,
-0xFF7293BC,
-0xFF78ABD6,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF74B0D5,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF76B0D6,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF78AFD6,
-0xFF78B0D5,
-0xFF78B0D5,
-0xFF76B0D5,
-0xFF73B1D6,
-0xFF73B1D8,
-0xFF76AFDC,
-0xFF78AEDD,
-0xFF78AEDD,
-0xFF7FB2DF,
-0xFF81ACD6,
-0xFF80A2C7,
-0xFF425978,
-0xFF95B0CB,
-0xFF82ADCF,
-0xFF7BAFD6,
-0xFF79B0D7,
-0xFF7BB1D7,
-0xFF7CAACB,
-0xFF86ACC3,
-0xFFCDE9F7,
-0xFFE0F3FA,
-0xFFE7F2F8,
-0xFFEDF7FF,
-0xFFE1F3FF,
-0xFF9CB6CD,
-0xFF7AA3C3,
-0xFF7CB0D5,
-0xFF76B0D6,
-0xFF73B1D6,
-0xFF77B4D3,
-0xFF75B0D0,
-0xFF74AFD1,
-0xFF7EB1D0,
-0xFF90B4CC,
-0xFFD9F9FF,
-0xFFD3F7FF,
-0xFF7AA6C3,
-0xFF80B2D5,
-0xFF77AFD4,
-0xFF79B0D7,
-0xFF77B1D9,
-0xFF76B1D9,
-0xFF76B2D7,
-0xFF77B1D7,
-0xFF77B1D6,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF75AED9,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6EADD6,
-0xFF6EADD6,
-0xFF6EADD6,
-0xFF6DACD5,
-0xFF6CABD4,
-0xFF6CABD4,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF69AAD4,
-0xFF69AAD4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF64A4D2,
-0xFF64A4D2,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF62A2D2,
-0xFF61A1D1,
-0xFF61A1D1,
-0xFF5998CB,
-0xFF5A99CC,
-0xFF5B9ACD,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5F9ED1,
-0xFF5F9ED1,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF63A1D0,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A5D1,
-0xFF66A5D1,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EACD5,
-0xFF70ABD5,
-0xFF6EACD5,
-0xFF6DACD5,
-0xFF6DACD7,
-0xFF6EABD8,
-0xFF70ABD7,
-0xFF71AAD7,
-0xFF73A9D7,
-0xFF6FA8D3,
-0xFF6DAAD6,
-0xFF71AEDD,
-0xFF6EA8D6,
-0xFF74A7D2,
-0xFF7FACCD,
-0xFF87A7BC,
-0xFF5E6F76,
-0xFF4B423B,
-0xFF715C4B,
-0xFFEAD1BD,
-0xFFFFE7D1,
-0xFFAF8C76,
-0xFF815D47,
-0xFFAB8673,
-0xFF987464,
-0xFF5F4234,
-0xFF3B2015,
-0xFF3A2218,
-0xFF321C11,
-0xFF624B43,
-0xFF67534C,
-0xFF3D2C24,
-0xFF1E1A1B,
-0xFF465769,
-0xFF87A8C7,
-0xFF7FABD0,
-0xFF76ABD5,
-0xFF70ABD7,
-0xFF71B0DC,
-0xFF72ADD7,
-0xFF73ACD7,
-0xFF73ADD5,
-0xFF73ACD7,
-0xFF70ADDA,
-0xFF6FAEDA,
-0xFF70AFDB,
-0xFF71AFD8,
-0xFF76ADD4,
-0xFF76AED1,
-0xFF75B0D2,
-0xFF71ACD4,
-0xFF6BA8D7,
-0xFF77ADDC,
-0xFF7AA6C9,
-0xFF91ADC3,
-0xFFE7F0F7,
-0xFFF4EBE6,
-0xFFDFC9BC,
-0xFFA28573,
-0xFF4E3320,
-0xFF342113,
-0xFF2A2124,
-0xFF3E4557,
-0xFF587190,
-0xFF8AB1DA,
-0xFF78ADD5,
-0xFF74AFD7,
-0xFF74AFD9,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF7AB0D6,
-0xFF7AB0D4,
-0xFF79B1D4,
-0xFF77B1D6,
-0xFF73B3D7,
-0xFF73B3D9,
-0xFF77B0DD,
-0xFF79AFDD,
-0xFF7AB0DF,
-0xFF72ABD8,
-0xFF79B4E0,
-0xFF89B6DD,
-0xFF516580,
-0xFF8495AF,
-0xFF84ADCD,
-0xFF7AB0D6,
-0xFF79B0D7,
-0xFF74AED6,
-0xFF78B2D8,
-0xFF79AED0,
-0xFF7EA8C1,
-0xFFC1E1F0,
-0xFFE6F5FC,
-0xFFE9F1F4,
-0xFFEAF1F7,
-0xFFEBF7FF,
-0xFFC8E1F7,
-0xFF8AAFCA,
-0xFF7AABCC,
-0xFF79AFD1,
-0xFF7AB3D1,
-0xFF7BB2D0,
-0xFF7FB0CE,
-0xFF83ABC5,
-0xFFD2EEFF,
-0xFFE0FCFF,
-0xFF78A5C4,
-0xFF77ABD0,
-0xFF7BB1D3,
-0xFF7BB1D5,
-0xFF79B1D6,
-0xFF77B1D7,
-0xFF74B2D9,
-0xFF75B3D8,
-0xFF77B3D7,
-0xFF78B2D7,
-0xFF7AB2D7,
-0xFF7AB1D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF76AFDA,
-0xFF75AED9,
-0xFF75AED9,
-0xFF75AED9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF70AED7,
-0xFF6FAED7,
-0xFF70AED7,
-0xFF6EADD6,
-0xFF6EADD6,
-0xFF6DACD5,
-0xFF6CABD6,
-0xFF6CABD6,
-0xFF6DACD7,
-0xFF6CABD6,
-0xFF6BAAD5,
-0xFF69AAD4,
-0xFF69A9D5,
-0xFF68A8D4,
-0xFF68A8D4,
-0xFF69A9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A6D5,
-0xFF68A6D5,
-0xFF65A5D3,
-0xFF65A5D3,
-0xFF65A5D5,
-0xFF64A4D4,
-0xFF64A4D4,
-0xFF63A3D3,
-0xFF63A3D3,
-0xFF62A2D2,
-0xFF5998CB,
-0xFF5A99CC,
-0xFF5C9BCE,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9CCD,
-0xFF5E9CCD,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF64A1D0,
-0xFF64A1D0,
-0xFF65A2D1,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D2,
-0xFF69A6D2,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6DA8D4,
-0xFF6EA9D5,
-0xFF6EA9D3,
-0xFF6EA9D3,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6FAAD4,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF72ABD6,
-0xFF71ACD6,
-0xFF6EADD6,
-0xFF6EADD6,
-0xFF6FACD8,
-0xFF71ACD8,
-0xFF74AAD8,
-0xFF74AAD6,
-0xFF74ADD8,
-0xFF71AEDA,
-0xFF6FACD9,
-0xFF71AAD5,
-0xFF82B0D4,
-0xFF7B9AB6,
-0xFF97A8B2,
-0xFF908F8D,
-0xFF6F5B50,
-0xFFA88D7C,
-0xFFFAE4CF,
-0xFFEFD6C0,
-0xFFB1957F,
-0xFFF3D3BE,
-0xFFD6B5A2,
-0xFFAE9181,
-0xFF654F41,
-0xFF3E2D23,
-0xFF291C14,
-0xFF33241F,
-0xFF271410,
-0xFF4A3733,
-0xFF45322C,
-0xFF2A201F,
-0xFF0F1521,
-0xFF768AA2,
-0xFF87A8C7,
-0xFF7FACD3,
-0xFF74AAD6,
-0xFF77B2DE,
-0xFF72ADD7,
-0xFF75AFD7,
-0xFF75ACD3,
-0xFF75ACD5,
-0xFF73AEDA,
-0xFF71AEDA,
-0xFF71B0DB,
-0xFF72B0D9,
-0xFF77AED5,
-0xFF77AFD2,
-0xFF70ABCB,
-0xFF7BB7DB,
-0xFF77B2DE,
-0xFF78ACD4,
-0xFF85A7C2,
-0xFFC0D6E4,
-0xFFE1EFF2,
-0xFFDFE5E1,
-0xFFD8DACF,
-0xFF6F6C5D,
-0xFF1E1408,
-0xFF2D2825,
-0xFF242D3E,
-0xFF91ACC9,
-0xFF8EBDDB,
-0xFF76AED1,
-0xFF76B0D6,
-0xFF75B1D6,
-0xFF75B0D8,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF7BB0D8,
-0xFF7BB1D7,
-0xFF7BB1D7,
-0xFF78B2D7,
-0xFF74B4D8,
-0xFF73B4DA,
-0xFF75B3DA,
-0xFF77B2DC,
-0xFF76B1D9,
-0xFF7AB5DD,
-0xFF73B2D5,
-0xFF7FB0D0,
-0xFF7B89A4,
-0xFF5D6B88,
-0xFF8BB5DB,
-0xFF79B0D9,
-0xFF7CB1D9,
-0xFF7AB1D8,
-0xFF78B6DF,
-0xFF73B1D8,
-0xFF73ADD2,
-0xFF78ABC8,
-0xFFA9CCE0,
-0xFFE1F7FF,
-0xFFE5EEF5,
-0xFFEAEFF3,
-0xFFF3FAFF,
-0xFFE4F5FF,
-0xFFA8C4D9,
-0xFF86B0C9,
-0xFF77ACCB,
-0xFF80B3D2,
-0xFF81A7BC,
-0xFFC9E8FA,
-0xFFEAFFFF,
-0xFF7597B2,
-0xFF81AFD1,
-0xFF7EB4D8,
-0xFF7AAFCF,
-0xFF84B9D9,
-0xFF7BB1D5,
-0xFF78B2D7,
-0xFF75B3DA,
-0xFF74B4DA,
-0xFF76B4D9,
-0xFF78B4D8,
-0xFF7CB2D8,
-0xFF7CB2D8,
-0xFF7BB3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF78B2D7,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED6,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF70AED5,
-0xFF72ADD5,
-0xFF70AED5,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6EACD5,
-0xFF6FADD6,
-0xFF6EACD5,
-0xFF6DAAD6,
-0xFF6BAAD5,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF64A2D1,
-0xFF5B9ACD,
-0xFF5B9ACD,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF64A1D0,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF67A4D3,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6EA9D5,
-0xFF6FAAD6,
-0xFF6FAAD4,
-0xFF6FAAD4,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF70ABD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF73ACD7,
-0xFF74AAD8,
-0xFF72ABD8,
-0xFF6FADD6,
-0xFF6EADD6,
-0xFF6EADD8,
-0xFF71ACD6,
-0xFF75ABD7,
-0xFF75ABD7,
-0xFF73ACD7,
-0xFF72ADD7,
-0xFF73B0DC,
-0xFF74ABD2,
-0xFF84ABCC,
-0xFF7A8FA4,
-0xFF8D8C91,
-0xFF796860,
-0xFF927565,
-0xFFCAAB96,
-0xFFF6E0C9,
-0xFFE6D2BA,
-0xFFCBB19A,
-0xFFC4A48F,
-0xFFCAA794,
-0xFFAD8E7C,
-0xFF4E3B2C,
-0xFF3E3226,
-0xFF281F18,
-0xFF281D1B,
-0xFF352323,
-0xFF2A1615,
-0xFF332019,
-0xFF362923,
-0xFF363137,
-0xFF27303F,
-0xFF92ACC7,
-0xFF7CA4C7,
-0xFF7BAFD7,
-0xFF71AAD5,
-0xFF74AED6,
-0xFF79B0D7,
-0xFF79AFD5,
-0xFF77AED5,
-0xFF74AFD9,
-0xFF72AFDB,
-0xFF72B1DC,
-0xFF73B1DA,
-0xFF78AFD6,
-0xFF79AFD3,
-0xFF77AECD,
-0xFF78ADCC,
-0xFF7CAACE,
-0xFF80A4C4,
-0xFFADC2D3,
-0xFFE2F1F6,
-0xFFDDEDED,
-0xFFD7E6E1,
-0xFFD1DDD3,
-0xFFDAE2D7,
-0xFFA5A6A1,
-0xFF212830,
-0xFF8DA6C4,
-0xFF85B0D3,
-0xFF73B0CF,
-0xFF75B8D5,
-0xFF74B3D6,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF77B3D8,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF7BB2D9,
-0xFF79B3D9,
-0xFF78B4D9,
-0xFF76B5D8,
-0xFF76B5D8,
-0xFF76B5D8,
-0xFF7CB6DC,
-0xFF78B2D8,
-0xFF75B6D6,
-0xFF87BAD9,
-0xFF99ACCA,
-0xFF505F80,
-0xFF90B7DE,
-0xFF80B5DD,
-0xFF7DB3D9,
-0xFF7AB1D8,
-0xFF79B7DE,
-0xFF72B3DB,
-0xFF76B7DD,
-0xFF78B4D6,
-0xFF79ABC6,
-0xFF97BCCF,
-0xFFDFF2FF,
-0xFFE1ECF2,
-0xFFDEE3E7,
-0xFFEFF6FE,
-0xFFE9FBFF,
-0xFFC7E2F5,
-0xFF8AB2CB,
-0xFF80A5BF,
-0xFFC5E0F1,
-0xFFECFFFF,
-0xFF7C97AC,
-0xFF86A8C3,
-0xFF80ADCC,
-0xFF7EB0D1,
-0xFF81B4D3,
-0xFF77AECD,
-0xFF7BB3D6,
-0xFF78B4D8,
-0xFF75B5D9,
-0xFF75B5D9,
-0xFF76B4D9,
-0xFF79B3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF72ADD5,
-0xFF72ADD7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6BAAD5,
-0xFF6CA9D5,
-0xFF6BAAD5,
-0xFF6AA9D4,
-0xFF6AA9D4,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF68A6D5,
-0xFF67A5D4,
-0xFF67A5D4,
-0xFF66A4D3,
-0xFF66A4D3,
-0xFF65A3D2,
-0xFF5C9BCE,
-0xFF5D9CCF,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF609ECF,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF64A1D0,
-0xFF64A1D0,
-0xFF65A2D1,
-0xFF65A2D1,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF67A4D3,
-0xFF68A5D4,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6BAAD6,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6FAAD4,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF73AED6,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73ACD7,
-0xFF77ABDA,
-0xFF77ABDA,
-0xFF70AED7,
-0xFF6FAFD5,
-0xFF6FAED7,
-0xFF71AFD8,
-0xFF76ACD8,
-0xFF76ADD6,
-0xFF73ADD5,
-0xFF75B0DA,
-0xFF72B0D9,
-0xFF77ABD2,
-0xFF8BADC9,
-0xFF657181,
-0xFF564845,
-0xFF6B4E3E,
-0xFFC3A188,
-0xFFB99A7E,
-0xFFB79F83,
-0xFFEBD6BB,
-0xFF9D8169,
-0xFF87634D,
-0xFFA57B65,
-0xFF9F7A67,
-0xFF422B19,
-0xFF443727,
-0xFF443B34,
-0xFF291E1C,
-0xFF342222,
-0xFF331E1B,
-0xFF28160C,
-0xFF28170F,
-0xFF271B1B,
-0xFF56545F,
-0xFF99ABC1,
-0xFF91B4D2,
-0xFF82B3DB,
-0xFF7AB4DC,
-0xFF78B2D8,
-0xFF74ACD1,
-0xFF7CB2D6,
-0xFF7BB1D7,
-0xFF77B1D9,
-0xFF74B1DD,
-0xFF73B2DD,
-0xFF74B1DD,
-0xFF76B0D8,
-0xFF7AAED3,
-0xFF7EAFCD,
-0xFF81A6C0,
-0xFF96ACC4,
-0xFFC5D0E2,
-0xFFE6EDF3,
-0xFFE3ECE9,
-0xFFDFEFEC,
-0xFFC7D8D2,
-0xFFD0DAD2,
-0xFFB7BDB9,
-0xFFA7AFB2,
-0xFF9BAEBF,
-0xFF8DB5D9,
-0xFF7CB3DC,
-0xFF6FB1D1,
-0xFF6FB4D1,
-0xFF75B4D7,
-0xFF77B3D7,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF78B4D9,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D8,
-0xFF76B5D8,
-0xFF76B8DA,
-0xFF75B7DA,
-0xFF77B4E0,
-0xFF7CB2E0,
-0xFF7EB1DC,
-0xFF7DB3D7,
-0xFF77B7D2,
-0xFF77B7D2,
-0xFF7BB0D8,
-0xFF7CB1DB,
-0xFF74B3D6,
-0xFF7AB2D3,
-0xFF93B3D9,
-0xFF587295,
-0xFF88ACCC,
-0xFF83B0D1,
-0xFF7DB1D6,
-0xFF79B3D9,
-0xFF76B2D6,
-0xFF78B7D8,
-0xFF76B5D6,
-0xFF78B7D6,
-0xFF7BB4D1,
-0xFF7FB1CC,
-0xFF85ADC6,
-0xFFC3DFF4,
-0xFFE0F3FF,
-0xFFD0DEEB,
-0xFFE8F4FF,
-0xFFEEFCFF,
-0xFFE2F2FF,
-0xFFDAECF8,
-0xFFEEFEFF,
-0xFF8A9DAC,
-0xFF7D98AB,
-0xFF95B5CA,
-0xFFADD0E6,
-0xFF8CB4CE,
-0xFF80B1D1,
-0xFF80B8DB,
-0xFF77B6D9,
-0xFF76B6D9,
-0xFF77B6D9,
-0xFF79B5D9,
-0xFF7AB4D9,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D9,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2DA,
-0xFF78B2DA,
-0xFF78B2DA,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF74AED6,
-0xFF74AED6,
-0xFF72ADD5,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD9,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF6EABD7,
-0xFF70ABD7,
-0xFF6EABD7,
-0xFF6BAAD5,
-0xFF6BAAD5,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF5D9CCF,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5E9DD0,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF619FD0,
-0xFF619FD0,
-0xFF619FD0,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF63A1D0,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF67A4D3,
-0xFF68A5D4,
-0xFF69A6D5,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D5,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6FAAD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EACD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD8,
-0xFF71ACD6,
-0xFF71ACD8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF72ADD5,
-0xFF74AED6,
-0xFF78ACDB,
-0xFF78ADD9,
-0xFF74AFD7,
-0xFF72B0D7,
-0xFF72B0D9,
-0xFF74AFD9,
-0xFF77AED7,
-0xFF77AED7,
-0xFF76B0D8,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF7FB1D4,
-0xFF90B0C9,
-0xFF5B6370,
-0xFF34211B,
-0xFF62412E,
-0xFFA7856C,
-0xFF9F8064,
-0xFF573E20,
-0xFFE9D1B5,
-0xFF82664E,
-0xFF5E3C23,
-0xFF9D735B,
-0xFF8E654F,
-0xFF472C19,
-0xFF3E2C1E,
-0xFF40332A,
-0xFF554842,
-0xFF2B1814,
-0xFF311C17,
-0xFF362418,
-0xFF28170D,
-0xFF30211E,
-0xFF231D21,
-0xFF2C3343,
-0xFF455D75,
-0xFF5F88A8,
-0xFF6A9ABE,
-0xFF7FADCF,
-0xFF8BB8D9,
-0xFF86B1D3,
-0xFF83B1D3,
-0xFF7CB2D8,
-0xFF78B2D8,
-0xFF77B1D9,
-0xFF7AB0D6,
-0xFF7DAECE,
-0xFF81ADC6,
-0xFFA6CBDE,
-0xFFC5DFEE,
-0xFFE0E8F5,
-0xFFF2F3F8,
-0xFFE5E7E4,
-0xFFC9D0C9,
-0xFFA5B4B1,
-0xFFD5E5E4,
-0xFFCED8D7,
-0xFF9AA5A7,
-0xFFACBDC7,
-0xFF637F95,
-0xFF7FAFD5,
-0xFF74AFD9,
-0xFF7ABCDE,
-0xFF72B4D4,
-0xFF76B5D8,
-0xFF78B4D8,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF7AB4DA,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF78B4D9,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF79B5DA,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF7AB4D9,
-0xFF79B5D9,
-0xFF7AB4D9,
-0xFF79B5D9,
-0xFF7AB4D9,
-0xFF77B6D9,
-0xFF74B9D8,
-0xFF74B9DA,
-0xFF78B6DF,
-0xFF7CB2DE,
-0xFF80B1DA,
-0xFF80B2D5,
-0xFF7AB8D1,
-0xFF7AB7D3,
-0xFF80B1DA,
-0xFF7EB1DC,
-0xFF7AB9DC,
-0xFF77B3D5,
-0xFF82B2D6,
-0xFF89ADCF,
-0xFF5A7894,
-0xFF95B7D3,
-0xFF84B4DA,
-0xFF78B2D8,
-0xFF7BB6D8,
-0xFF7BB6D6,
-0xFF79B4D4,
-0xFF7BB6D6,
-0xFF7CB9D8,
-0xFF79B4D4,
-0xFF7CB1D0,
-0xFF83B0CD,
-0xFF9CBED9,
-0xFFBCD6ED,
-0xFFA1B6CB,
-0xFFD5E5F4,
-0xFFF0FBFF,
-0xFFEEF7FC,
-0xFFB4BECA,
-0xFF8F9FAF,
-0xFFDDF4FF,
-0xFFB8D3E6,
-0xFFB6D1E4,
-0xFFA8CBE1,
-0xFF7EACCD,
-0xFF7DB5D8,
-0xFF78B7DA,
-0xFF78B7DA,
-0xFF78B7D8,
-0xFF7AB6DA,
-0xFF7BB5DB,
-0xFF7BB5DB,
-0xFF7AB4DA,
-0xFF79B5D9,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF7AB6DA,
-0xFF7AB6DA,
-0xFF7AB6DA,
-0xFF7AB6DA,
-0xFF7AB6DA,
-0xFF7AB6DA,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF79B3D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2DA,
-0xFF78B2D8,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D9,
-0xFF76B0D8,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF74AED6,
-0xFF74AED6,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AEDA,
-0xFF72ADD9,
-0xFF72ADD9,
-0xFF71ACD8,
-0xFF71ACD8,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6CABD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF67A6D2,
-0xFF5E9CCD,
-0xFF5E9CCD,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF619DCF,
-0xFF619DCF,
-0xFF629FCE,
-0xFF629FCE,
-0xFF64A1D0,
-0xFF65A2D1,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF68A2D2,
-0xFF69A3D1,
-0xFF69A3D1,
-0xFF6AA4D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF6FAAD6,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71AAD5,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF73ADD5,
-0xFF73ADD5,
-0xFF73ACD7,
-0xFF74AED6,
-0xFF74ADD8,
-0xFF74AED6,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD5,
-0xFF76B0D8,
-0xFF75B0DA,
-0xFF76AFDA,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B3D8,
-0xFF74B0D5,
-0xFF75B1D6,
-0xFF7FB1D2,
-0xFF89A9C0,
-0xFF3B454F,
-0xFF2F1D19,
-0xFF503325,
-0xFF7E6350,
-0xFF6D513B,
-0xFF4B2B12,
-0xFFC2A48A,
-0xFF786048,
-0xFF3F250E,
-0xFF967258,
-0xFF79533C,
-0xFF513122,
-0xFF472F23,
-0xFF533F34,
-0xFF4F3B32,
-0xFF513A32,
-0xFF2F1810,
-0xFF2B1B0E,
-0xFF322419,
-0xFF2E201D,
-0xFF392F30,
-0xFF5A575E,
-0xFF4C5461,
-0xFF415973,
-0xFF587593,
-0xFF516983,
-0xFF5F748F,
-0xFF778CA9,
-0xFF8CABCA,
-0xFF85B6D6,
-0xFF7AB1D0,
-0xFF7DAECE,
-0xFF86B0C8,
-0xFFACCEDA,
-0xFFD6EFF4,
-0xFFD9EAF1,
-0xFFCFDADE,
-0xFFCACFD2,
-0xFFC6CAC9,
-0xFFA1A6A0,
-0xFFB7BDB9,
-0xFFD3DFDF,
-0xFFD9E6EC,
-0xFF9BAAB1,
-0xFFADBFCB,
-0xFF9BB2C2,
-0xFF6C8FA5,
-0xFF6C9DBE,
-0xFF7FB6DD,
-0xFF78B2D8,
-0xFF79B5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7DB5DA,
-0xFF7AB6DA,
-0xFF78B7D8,
-0xFF78B7D8,
-0xFF7BB6D8,
-0xFF7EB4D8,
-0xFF7FB4D6,
-0xFF7EB4D6,
-0xFF7BB6D6,
-0xFF7EB6D9,
-0xFF7FB0D9,
-0xFF80B3DE,
-0xFF76B5D8,
-0xFF76B8D8,
-0xFF79B9D4,
-0xFF8DBCD6,
-0xFF536482,
-0xFFA2B1D2,
-0xFF87B1D7,
-0xFF7DB5DA,
-0xFF7EB8DD,
-0xFF7CB4D9,
-0xFF7FB5D7,
-0xFF7EB4D6,
-0xFF7AB5D7,
-0xFF7AB6D8,
-0xFF7CB9D8,
-0xFF7DB5D6,
-0xFF7FB1D6,
-0xFF82AED5,
-0xFF88B2DA,
-0xFF94B6D2,
-0xFFA6BAC3,
-0xFFACBABD,
-0xFF4E5A66,
-0xFF303D4E,
-0xFF738297,
-0xFFC7D7EE,
-0xFFCFE4F9,
-0xFFBCDAF2,
-0xFF87B5D6,
-0xFF81B7DB,
-0xFF7FB5D7,
-0xFF7EB6D7,
-0xFF7BB7DC,
-0xFF7BB6DE,
-0xFF7BB7DC,
-0xFF7CB6DB,
-0xFF7DB8D8,
-0xFF7DB8D8,
-0xFF7BB6D8,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7BB5DA,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF79B3D9,
-0xFF79B3D8,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF77B1D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF74B0D5,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED8,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF6FADD6,
-0xFF6EACD5,
-0xFF6FADD6,
-0xFF6EACD5,
-0xFF6DAAD6,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6BA8D4,
-0xFF6BA8D5,
-0xFF6BA8D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF68A7D3,
-0xFF5F9DCE,
-0xFF5F9DCE,
-0xFF609ECF,
-0xFF619FD0,
-0xFF629ED0,
-0xFF629ED0,
-0xFF63A0CF,
-0xFF63A0CF,
-0xFF65A2D1,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF67A4D3,
-0xFF69A3D1,
-0xFF69A3D1,
-0xFF6AA4D2,
-0xFF6AA4D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF71AAD7,
-0xFF71AAD7,
-0xFF71AAD5,
-0xFF71AAD5,
-0xFF72ABD6,
-0xFF72ABD6,
-0xFF72ABD6,
-0xFF72ABD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF75B1D6,
-0xFF75B1D6,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF76B0D8,
-0xFF76B0D6,
-0xFF74B0D4,
-0xFF76B2D6,
-0xFF78B2D7,
-0xFF7EAFCF,
-0xFF92B2C9,
-0xFF3D4751,
-0xFF322320,
-0xFF5B4035,
-0xFF584131,
-0xFF5B402D,
-0xFF6A482F,
-0xFF9F7D64,
-0xFF6A543D,
-0xFF331D06,
-0xFF88664D,
-0xFF67432D,
-0xFF553528,
-0xFF402419,
-0xFF624A3E,
-0xFF553F34,
-0xFF786056,
-0xFF432D22,
-0xFF261609,
-0xFF2C1E13,
-0xFF382720,
-0xFF43312D,
-0xFF574747,
-0xFFAAA5AC,
-0xFFA2B4C8,
-0xFF56718C,
-0xFF8195AE,
-0xFF7C8DA7,
-0xFF627593,
-0xFF486380,
-0xFF85ADC6,
-0xFF85AFC7,
-0xFFA0C4DA,
-0xFFBAD7E7,
-0xFFDDF2F5,
-0xFFD6E5E2,
-0xFFC3CFCD,
-0xFFD4DFDB,
-0xFFA4ADA8,
-0xFF69726D,
-0xFFEEF7F2,
-0xFFE2EBE8,
-0xFFC8D2D4,
-0xFFC8D5DB,
-0xFF8A9CA6,
-0xFF617886,
-0xFF608194,
-0xFF78A0B9,
-0xFF7FB0CE,
-0xFF7FB5D7,
-0xFF7DB3D9,
-0xFF7EB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7BB7D9,
-0xFF7CB7D9,
-0xFF7EB6D7,
-0xFF7FB6D5,
-0xFF7FB6D5,
-0xFF7EB6D7,
-0xFF7CB7D9,
-0xFF7EB6DB,
-0xFF82B3DE,
-0xFF82B6DE,
-0xFF79B7DC,
-0xFF75B7D7,
-0xFF78BBD5,
-0xFF8ABCD5,
-0xFF677091,
-0xFF5C6083,
-0xFF9BB9DD,
-0xFF82B2D6,
-0xFF7DB5DA,
-0xFF80B8DD,
-0xFF81B6D8,
-0xFF81B6D8,
-0xFF81BBE0,
-0xFF78B7DA,
-0xFF78B9D9,
-0xFF77B6D7,
-0xFF7DB7DD,
-0xFF83B8E2,
-0xFF7DB1E0,
-0xFF82ADD0,
-0xFFBCD4DE,
-0xFFEAF9FC,
-0xFF697784,
-0xFF2C394A,
-0xFF465268,
-0xFF5D6C81,
-0xFFACBED4,
-0xFFACCAE4,
-0xFF8EBCDD,
-0xFF7FB5D7,
-0xFF81B6D6,
-0xFF80B7D6,
-0xFF7CB6DC,
-0xFF7BB6DE,
-0xFF7BB7DC,
-0xFF7DB7DC,
-0xFF7DB8D8,
-0xFF7DB8D6,
-0xFF7CB7D9,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF77B3D7,
-0xFF77B3D7,
-0xFF77B3D8,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B1D6,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CA9D6,
-0xFF6CA9D6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF69A8D4,
-0xFF69A8D4,
-0xFF609ECF,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF62A0D1,
-0xFF62A0CF,
-0xFF63A1D0,
-0xFF64A1D0,
-0xFF65A2D1,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF67A4D1,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF6BA5D3,
-0xFF6BA5D3,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6BA8D5,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DABD4,
-0xFF6DABD4,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF72ABD6,
-0xFF72ABD6,
-0xFF72ABD6,
-0xFF72ABD6,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF73ADD5,
-0xFF73ADD5,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF73AED6,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF7AB2D7,
-0xFF7AB1D8,
-0xFF78B2DA,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D7,
-0xFF78B4D8,
-0xFF75B1D5,
-0xFF79B3D8,
-0xFF7FB0D0,
-0xFF96B6CD,
-0xFF47515D,
-0xFF362827,
-0xFF593E33,
-0xFF2C1609,
-0xFF371D0C,
-0xFF623F29,
-0xFF7C5943,
-0xFF6B5540,
-0xFF371E0A,
-0xFF78553F,
-0xFF65402D,
-0xFF563629,
-0xFF43281F,
-0xFF644E43,
-0xFF361F17,
-0xFF482F28,
-0xFF3C231C,
-0xFF402E24,
-0xFF38261A,
-0xFF462E22,
-0xFF4C3126,
-0xFF4F322A,
-0xFF584C4E,
-0xFFA0B7C9,
-0xFF96BED8,
-0xFF708FAE,
-0xFF91B2D1,
-0xFF8FB6D3,
-0xFF88ADC7,
-0xFF536E7F,
-0xFFD0E3F1,
-0xFFDAECFA,
-0xFFC6D4DF,
-0xFFCFD8DF,
-0xFFD1DCDE,
-0xFFC9DDDC,
-0xFFBFD5D2,
-0xFF667570,
-0xFFDBE7E3,
-0xFFDAE6E6,
-0xFFD2DDDF,
-0xFFD7E3E3,
-0xFFADBDBC,
-0xFFBFD4D7,
-0xFF294751,
-0xFF9FC8DA,
-0xFF85B5CC,
-0xFF84B6D1,
-0xFF81B4D3,
-0xFF8ABFDE,
-0xFF7CB2D4,
-0xFF7DB5D8,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7DB7DC,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6D8,
-0xFF7FB7D8,
-0xFF7FB7D8,
-0xFF7CB8DA,
-0xFF7DB7DC,
-0xFF7FB4DE,
-0xFF80B5DD,
-0xFF7DB9DE,
-0xFF78B7D8,
-0xFF7DB9D5,
-0xFF8DB9D4,
-0xFF8B91B5,
-0xFF353456,
-0xFF8E9BBB,
-0xFF97B6D5,
-0xFF7EB2D7,
-0xFF84C0E4,
-0xFF7FB6D4,
-0xFF7CB3D1,
-0xFF77B6D9,
-0xFF76B7DD,
-0xFF78BADD,
-0xFF78B9D9,
-0xFF7FB8D6,
-0xFF81B7D9,
-0xFF7EB5DE,
-0xFF82AFD0,
-0xFFC6DCE7,
-0xFFEFFAFE,
-0xFF90A0AD,
-0xFF405161,
-0xFF56687C,
-0xFF3E5368,
-0xFF566F85,
-0xFF6488A2,
-0xFF85B7D8,
-0xFF81B9DC,
-0xFF81B8D6,
-0xFF81B8D7,
-0xFF7DB7DC,
-0xFF7DB7DD,
-0xFF7DB7DD,
-0xFF7FB7DC,
-0xFF80B8D9,
-0xFF80B8D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF78B4D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF75B0DA,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF73AED8,
-0xFF73AED8,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6FADD6,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6AA9D5,
-0xFF6AA9D5,
-0xFF619FD0,
-0xFF62A0D1,
-0xFF63A1D2,
-0xFF63A1D2,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF66A3D2,
-0xFF67A4D3,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF6BA5D3,
-0xFF6CA6D4,
-0xFF6AA7D4,
-0xFF6AA7D4,
-0xFF6BA8D5,
-0xFF6BA8D5,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6EABD7,
-0xFF6EACD5,
-0xFF6EACD5,
-0xFF6FADD6,
-0xFF71ACD6,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF74AED6,
-0xFF74AED6,
-0xFF73AED6,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF7AB2D7,
-0xFF7BB3D8,
-0xFF79B3DB,
-0xFF78B2DA,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF79B5D9,
-0xFF77B3D7,
-0xFF78B2D7,
-0xFF7FB0D0,
-0xFF98B8D1,
-0xFF3E4A56,
-0xFF3A2C2B,
-0xFF3C241A,
-0xFF29150A,
-0xFF341D0F,
-0xFF482714,
-0xFF6B4B36,
-0xFF684E3D,
-0xFF361C0B,
-0xFF5A3723,
-0xFF603B29,
-0xFF54362B,
-0xFF51392F,
-0xFF442D25,
-0xFF2C180F,
-0xFF7E655E,
-0xFF412821,
-0xFF462F27,
-0xFF412B1E,
-0xFF503524,
-0xFF513122,
-0xFF553329,
-0xFF4C3C3C,
-0xFF8499AA,
-0xFF93B8D3,
-0xFF99B8D7,
-0xFF9FC0DF,
-0xFF87AFC8,
-0xFF9FC2D5,
-0xFFD2E3ED,
-0xFFE2E9F1,
-0xFF9CA5AC,
-0xFF8E999F,
-0xFFCFDAE0,
-0xFFC3D2D5,
-0xFF9AB0AE,
-0xFF7D9391,
-0xFF243433,
-0xFFE0EEEF,
-0xFFDBE9EC,
-0xFFD2DDDF,
-0xFFD0DCDA,
-0xFF7F8D8D,
-0xFFA8BDC0,
-0xFF203C47,
-0xFF476C7F,
-0xFFA0CAE2,
-0xFF95BFD8,
-0xFF7EACC6,
-0xFF2D5E7C,
-0xFF89C0DF,
-0xFF7EB6D9,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB8DD,
-0xFF80B8DD,
-0xFF80B8DD,
-0xFF80B8DB,
-0xFF80B8D9,
-0xFF80B8D9,
-0xFF7DB9DB,
-0xFF7EB8DD,
-0xFF7FB4DC,
-0xFF7FB4DC,
-0xFF80BADF,
-0xFF7EBADC,
-0xFF7DB8D6,
-0xFF89B6D3,
-0xFFA4B4D6,
-0xFF5B5C7B,
-0xFF5D5B71,
-0xFFABB7CF,
-0xFF8BB6D6,
-0xFF7AB2D3,
-0xFF7FB5D1,
-0xFF85BDD8,
-0xFF80BADF,
-0xFF7FBBE0,
-0xFF7BB7DB,
-0xFF80BBDB,
-0xFF82B9D7,
-0xFF7FB4D3,
-0xFF80B6DC,
-0xFF86B2CF,
-0xFFD4E6F2,
-0xFFEAF3F8,
-0xFF9DAFBB,
-0xFFB0C5D6,
-0xFFCFE6F8,
-0xFFA1BAD0,
-0xFF9AB8D0,
-0xFF8DB4D1,
-0xFF84BADC,
-0xFF80BBDD,
-0xFF82B9D7,
-0xFF81B8D6,
-0xFF80B8DB,
-0xFF80B8DD,
-0xFF80B8DD,
-0xFF80B8DD,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7FB7DC,
-0xFF7FB7DC,
-0xFF7FB7DC,
-0xFF7EB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF79B5D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF78B4D9,
-0xFF77B3D8,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF75B0DA,
-0xFF75B0DA,
-0xFF75B0DA,
-0xFF74AFD9,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF71AFD8,
-0xFF70AED7,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6CABD7,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF6BAAD6,
-0xFF62A0CF,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF67A4D1,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF69A6D2,
-0xFF69A6D2,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6FAAD6,
-0xFF70ABD7,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF73ACD7,
-0xFF73ACD7,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF7AB1D8,
-0xFF7AB1D8,
-0xFF7AB1D8,
-0xFF7AB1D8,
-0xFF7AB1D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF79B3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF79B3DB,
-0xFF7AB4DC,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF76B0D5,
-0xFF7DB8DA,
-0xFF79B3D8,
-0xFF7FB0D0,
-0xFF9ABAD3,
-0xFF3F4B57,
-0xFF342927,
-0xFF271106,
-0xFF251309,
-0xFF372416,
-0xFF39190A,
-0xFF593827,
-0xFF5F4536,
-0xFF3E2312,
-0xFF4E2B18,
-0xFF6B4835,
-0xFF5B3F33,
-0xFF493328,
-0xFF3B271E,
-0xFF230F08,
-0xFF553C35,
-0xFF391E17,
-0xFF371E17,
-0xFF553D31,
-0xFF553924,
-0xFF72533F,
-0xFF4E3026,
-0xFF463639,
-0xFF5F6C7D,
-0xFF4E6881,
-0xFF7285A3,
-0xFFB2C3DD,
-0xFFC3D6E5,
-0xFFE4F5FD,
-0xFFE1E6EC,
-0xFFDFE2E7,
-0xFFA3ADAE,
-0xFFB6C8C8,
-0xFF809A9B,
-0xFFA9C3C4,
-0xFF7C8E8E,
-0xFF142223,
-0xFF516067,
-0xFFE9F6FE,
-0xFFDDE6EB,
-0xFFCFD7D9,
-0xFFABB4B3,
-0xFF596466,
-0xFF71828A,
-0xFF748796,
-0xFF000C1F,
-0xFF72889F,
-0xFF587088,
-0xFF000922,
-0xFF5E8BAA,
-0xFF82B8DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7EB8DD,
-0xFF7DB9DE,
-0xFF7DB9DE,
-0xFF7EB8DD,
-0xFF80B8DB,
-0xFF80B8D9,
-0xFF80B8D9,
-0xFF80B8DB,
-0xFF80B8DD,
-0xFF82B7DF,
-0xFF81B6DE,
-0xFF80BADF,
-0xFF80BCDE,
-0xFF7ABAD6,
-0xFF7FB6D4,
-0xFF9ABEDE,
-0xFF8F9BB5,
-0xFF695966,
-0xFF716573,
-0xFF9EB8D3,
-0xFF89B7D8,
-0xFF8AB9D7,
-0xFF84B5D5,
-0xFF88BADF,
-0xFF81B3D8,
-0xFF89B7D9,
-0xFF8AB8D9,
-0xFF88BBDA,
-0xFF8ABDDC,
-0xFF8DBEDF,
-0xFF90B5D0,
-0xFFE1EDFB,
-0xFFF1F8FF,
-0xFFA8BBC9,
-0xFFD1EBFA,
-0xFFCFEAFD,
-0xFF8AA9BE,
-0xFF92B6D0,
-0xFF8BB8D7,
-0xFF84BCDF,
-0xFF7DB9DB,
-0xFF82B9D7,
-0xFF83B8D7,
-0xFF82B8DA,
-0xFF82B8DE,
-0xFF82B8DE,
-0xFF82B8DE,
-0xFF81B9DE,
-0xFF7FBADC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB7DC,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7EB6DB,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF78B4D9,
-0xFF77B3D8,
-0xFF77B2DA,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6CA9D5,
-0xFF63A1D0,
-0xFF64A2D1,
-0xFF64A2D1,
-0xFF65A3D2,
-0xFF65A3D2,
-0xFF66A4D3,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF68A5D2,
-0xFF69A6D3,
-0xFF6AA7D4,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CA9D5,
-0xFF6CA9D5,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF70ABD7,
-0xFF71ACD8,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF74ADD8,
-0xFF75AED9,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7AB4DA,
-0xFF7BB5DB,
-0xFF7BB5DB,
-0xFF7BB5DA,
-0xFF79B4D6,
-0xFF7CB7D9,
-0xFF79B3D8,
-0xFF83B4D5,
-0xFF97B9D2,
-0xFF616F7C,
-0xFF201614,
-0xFF2D1B11,
-0xFF26150D,
-0xFF342216,
-0xFF3D2012,
-0xFF4C2C1D,
-0xFF64483A,
-0xFF412517,
-0xFF411E0B,
-0xFF6E4A3A,
-0xFF52362A,
-0xFF4B352A,
-0xFF3D2B21,
-0xFF1B0801,
-0xFF341D15,
-0xFF654A43,
-0xFF412821,
-0xFF5E4338,
-0xFF361A05,
-0xFF896E5B,
-0xFF644942,
-0xFF4C4044,
-0xFF8B97A7,
-0xFF859AAF,
-0xFF94A1B4,
-0xFFBCC5D4,
-0xFFBBC4C9,
-0xFFD1DAD9,
-0xFFCCCDD1,
-0xFFE2E6E9,
-0xFF939D9F,
-0xFF91A3A5,
-0xFF92AEAF,
-0xFF91ABAC,
-0xFF0F1D1E,
-0xFF232D2F,
-0xFFF3FFFF,
-0xFFBBC8D0,
-0xFFA8B1B6,
-0xFF9FA7AA,
-0xFF899297,
-0xFF525D63,
-0xFF3A4855,
-0xFF576776,
-0xFF1A2737,
-0xFF102133,
-0xFF000920,
-0xFF43627E,
-0xFF95C2E3,
-0xFF85BADC,
-0xFF81B7DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7FBADC,
-0xFF7FBADC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DE,
-0xFF7FB9DF,
-0xFF7FB9DF,
-0xFF7FB9DE,
-0xFF81B9DC,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B9DA,
-0xFF81B9DC,
-0xFF82B8DE,
-0xFF83BBE0,
-0xFF7EB8DD,
-0xFF7FBBDD,
-0xFF7CBBDA,
-0xFF7DB9D5,
-0xFF85B6D4,
-0xFFA2B8CF,
-0xFF89747D,
-0xFF674C53,
-0xFF84899C,
-0xFFA0BAD3,
-0xFF8DB1D1,
-0xFF8CB7D9,
-0xFF8EBADF,
-0xFF93BEE1,
-0xFF96BFDF,
-0xFF93BFDC,
-0xFF92C1DF,
-0xFF94C5E5,
-0xFF97C4E5,
-0xFF9CBCD5,
-0xFFE6F0FC,
-0xFFEBF2FA,
-0xFFA2B5C3,
-0xFFD2EFFF,
-0xFFCAE7F9,
-0xFF88A8BF,
-0xFF92BBD7,
-0xFF88BADB,
-0xFF7EB8DD,
-0xFF7FBBDD,
-0xFF83BAD9,
-0xFF84B9D8,
-0xFF84B9DB,
-0xFF84B8DD,
-0xFF84B8DF,
-0xFF83B9DF,
-0xFF82BADF,
-0xFF80BADF,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7EB9DB,
-0xFF7EB9DB,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7DB7DC,
-0xFF7CB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF79B5DA,
-0xFF78B4D9,
-0xFF78B3DB,
-0xFF77B2DA,
-0xFF77B2DA,
-0xFF77B2DA,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF71AFD8,
-0xFF71AFD8,
-0xFF70ADD9,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6EABD7,
-0xFF6DAAD6,
-0xFF6DAAD6,
-0xFF64A3CF,
-0xFF65A4D0,
-0xFF65A4D0,
-0xFF66A5D1,
-0xFF66A5D1,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A6D2,
-0xFF69A6D2,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA9D2,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6DABD4,
-0xFF6DABD4,
-0xFF6EACD5,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73ADD5,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D9,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7DB5D8,
-0xFF7DB5DA,
-0xFF7BB5DB,
-0xFF7CB6DC,
-0xFF7EB5DC,
-0xFF7DB5DA,
-0xFF80B8DB,
-0xFF7CB4D7,
-0xFF7BB3D8,
-0xFF85B6D7,
-0xFF97B9D2,
-0xFF60707D,
-0xFF160E0C,
-0xFF36251D,
-0xFF1F1108,
-0xFF29180E,
-0xFF381E11,
-0xFF472A1A,
-0xFF6D5042,
-0xFF412416,
-0xFF381706,
-0xFF775645,
-0xFF45291B,
-0xFF5A4437,
-0xFF402F25,
-0xFF211006,
-0xFF341E13,
-0xFF3C241A,
-0xFF3E231C,
-0xFF60453C,
-0xFF412517,
-0xFF877062,
-0xFF796660,
-0xFF2E292D,
-0xFF6C7E8C,
-0xFF95ADB9,
-0xFFE1EBED,
-0xFFCFD5D1,
-0xFFD4DED6,
-0xFFCAD4CC,
-0xFFD1D7D5,
-0xFFDADFE2,
-0xFF6D787E,
-0xFF738289,
-0xFF37464B,
-0xFF738184,
-0xFF758082,
-0xFFC4CED0,
-0xFFBBC6CA,
-0xFFAEB9BD,
-0xFF919A9F,
-0xFFC4CFD5,
-0xFF6C7D87,
-0xFF30404D,
-0xFF23313E,
-0xFF313F4A,
-0xFF21323C,
-0xFF031A28,
-0xFF61849A,
-0xFF97C0DE,
-0xFF8CB8DB,
-0xFF80B0D4,
-0xFF82B8DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADF,
-0xFF83B8E0,
-0xFF83B8E0,
-0xFF83B9DF,
-0xFF83B9DD,
-0xFF83B9DB,
-0xFF82BBD9,
-0xFF80BBD9,
-0xFF80BBDB,
-0xFF7FBADA,
-0xFF81BCDE,
-0xFF7EB9DB,
-0xFF7FBADA,
-0xFF81BCDA,
-0xFF83BCD9,
-0xFF82B8D4,
-0xFFA0BCD2,
-0xFF988892,
-0xFF705053,
-0xFF60494F,
-0xFFBDB9C7,
-0xFFAABFDE,
-0xFF9CC0E4,
-0xFF9CC2E6,
-0xFF9DC4E5,
-0xFF99C2DE,
-0xFF9AC6E1,
-0xFF98C7E5,
-0xFF94C3E1,
-0xFF90BBDB,
-0xFF9EBCD6,
-0xFFEDF5FF,
-0xFFF4F8FF,
-0xFF9EB4C1,
-0xFFD0EDFD,
-0xFFD1EEFF,
-0xFF85A7C0,
-0xFF88B3D3,
-0xFF88BCE1,
-0xFF80BCE0,
-0xFF7FBBDD,
-0xFF83BAD9,
-0xFF86B9D8,
-0xFF87B9DA,
-0xFF87B9DC,
-0xFF87B9DE,
-0xFF85B9E0,
-0xFF81BBE0,
-0xFF81BBE0,
-0xFF83BBDE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF83B9DD,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B8DB,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF77B2DA,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED8,
-0xFF73AED8,
-0xFF70AED7,
-0xFF70AED7,
-0xFF70AED7,
-0xFF6FADD6,
-0xFF6FACD8,
-0xFF6EABD7,
-0xFF64A3CF,
-0xFF65A4D0,
-0xFF66A5D1,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A7D3,
-0xFF68A7D3,
-0xFF69A8D3,
-0xFF69A6D2,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6DABD4,
-0xFF6DABD4,
-0xFF6EACD5,
-0xFF6FADD6,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD7,
-0xFF73AED8,
-0xFF73AED6,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF7AB4DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF7EB6DB,
-0xFF7CB6DB,
-0xFF7EB6DB,
-0xFF7EB6D9,
-0xFF7DB5D8,
-0xFF80B8DB,
-0xFF7DB5DA,
-0xFF83B4D5,
-0xFF99BDD5,
-0xFF2E404E,
-0xFF1D1717,
-0xFF2D1F16,
-0xFF180B03,
-0xFF291B10,
-0xFF321B0D,
-0xFF482B1D,
-0xFF66493B,
-0xFF3C1C0F,
-0xFF371605,
-0xFF826351,
-0xFF3A200F,
-0xFF554233,
-0xFF3B2D22,
-0xFF23150A,
-0xFF432F24,
-0xFF4A3226,
-0xFF3F271D,
-0xFF553D33,
-0xFF584235,
-0xFF645246,
-0xFFA19692,
-0xFFCDCED0,
-0xFFC1D4DB,
-0xFF8DA4AA,
-0xFFAFB8B5,
-0xFFD4DAD0,
-0xFFD3DDD2,
-0xFFC8D4CA,
-0xFFC8D2D1,
-0xFFE0EBED,
-0xFF313E44,
-0xFF1A272D,
-0xFFB6BFC4,
-0xFFE9F3F5,
-0xFFDAE5E7,
-0xFFCDD9D9,
-0xFFBBC5C4,
-0xFFC9D5D5,
-0xFFD1E0E3,
-0xFFDAEBF3,
-0xFF687B89,
-0xFF253847,
-0xFF253640,
-0xFF172933,
-0xFF153039,
-0xFF678B99,
-0xFF96C4DE,
-0xFF87BAD9,
-0xFF86B7D8,
-0xFF86B6DA,
-0xFF82B8DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF82BADD,
-0xFF83BBDE,
-0xFF84BADE,
-0xFF85B9E0,
-0xFF87B8E0,
-0xFF85B9DE,
-0xFF84BADC,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF83BCDA,
-0xFF83BCDA,
-0xFF83BCDA,
-0xFF84BDDB,
-0xFF85BADC,
-0xFF85BADA,
-0xFF87B9DA,
-0xFF87BAD9,
-0xFF8DC0DD,
-0xFF9DBDD4,
-0xFFB0ADB8,
-0xFF604347,
-0xFF7B5552,
-0xFF755B5E,
-0xFFC4C5D9,
-0xFFAABFDE,
-0xFF9DC0E0,
-0xFF99C4E4,
-0xFF98C6E0,
-0xFF92C1DB,
-0xFF8DBEDC,
-0xFF8EBFDD,
-0xFF8EB9D9,
-0xFFA0BCD4,
-0xFFEAF0FC,
-0xFFF1F5FE,
-0xFF9CB2C0,
-0xFFBAD7E9,
-0xFFD0EDFF,
-0xFF86A8C1,
-0xFF93C0E1,
-0xFF84BAE0,
-0xFF7FBBDF,
-0xFF81BDDF,
-0xFF84BBD9,
-0xFF87BAD9,
-0xFF88BADB,
-0xFF88BADD,
-0xFF88BADF,
-0xFF87BBE0,
-0xFF83BDE2,
-0xFF83BDE2,
-0xFF84BCDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF85BBDF,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF84BADE,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF7FB7DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7DB8DA,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF7AB4DA,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF77B2DA,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF74AFD9,
-0xFF73AED8,
-0xFF71AFD8,
-0xFF71AFD8,
-0xFF71AFD8,
-0xFF70AED7,
-0xFF6FACD8,
-0xFF6FACD8,
-0xFF66A5D1,
-0xFF66A5D1,
-0xFF67A6D1,
-0xFF67A6D1,
-0xFF68A7D2,
-0xFF68A7D2,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA9D2,
-0xFF6BA9D2,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6FAAD4,
-0xFF6FAAD4,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD4,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD5,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF7AB1D8,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB5D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF7FB7DC,
-0xFF7FB7DC,
-0xFF7FB7DC,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF7FB7DC,
-0xFF83B4D5,
-0xFF9ABED8,
-0xFF233644,
-0xFF1E1A19,
-0xFF1D1008,
-0xFF1B1108,
-0xFF261A0E,
-0xFF301A0C,
-0xFF4C3022,
-0xFF5A3A2D,
-0xFF422112,
-0xFF3D1C0B,
-0xFF7A5B47,
-0xFF3E2511,
-0xFF523F2E,
-0xFF37291C,
-0xFF291B10,
-0xFF443224,
-0xFF6A5447,
-0xFF3C261B,
-0xFF3D2920,
-0xFF716356,
-0xFFE2DACF,
-0xFFE1E0DB,
-0xFFEDF3F1,
-0xFF182828,
-0xFF6D7F81,
-0xFFC0CACB,
-0xFFCAD0CE,
-0xFFD6E0D8,
-0xFFBDC8C2,
-0xFFC4D2D5,
-0xFFADBCC1,
-0xFF798788,
-0xFFE7F5F5,
-0xFFD6E1E3,
-0xFF9FAAAC,
-0xFFDDE9E9,
-0xFFD0DFDC,
-0xFFCAD6D2,
-0xFFC7D7D4,
-0xFFA1B9BD,
-0xFFC8E1E8,
-0xFF6B818C,
-0xFF172D38,
-0xFF1A3139,
-0xFF314D58,
-0xFFA0CADA,
-0xFF89BDD3,
-0xFF83BCD9,
-0xFF80BBDB,
-0xFF81B8D7,
-0xFF84B9D9,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDF,
-0xFF85B9DE,
-0xFF87B9DE,
-0xFF85BADC,
-0xFF85BADA,
-0xFF85BADA,
-0xFF87BAD9,
-0xFF87BAD9,
-0xFF87BAD9,
-0xFF89BADA,
-0xFF8DBBDC,
-0xFF92BDE0,
-0xFF98BEE2,
-0xFF9CC0E4,
-0xFF9DC1E5,
-0xFF9BC4E4,
-0xFFA0C2DD,
-0xFFC0CDE0,
-0xFF584D55,
-0xFF825C53,
-0xFF73483F,
-0xFF7A6164,
-0xFFC7C9D8,
-0xFF9CBED9,
-0xFF8FC2E1,
-0xFF88C0D9,
-0xFF8AC4DC,
-0xFF80BCD8,
-0xFF89C0DE,
-0xFF8BB8D5,
-0xFFA1C0D5,
-0xFFEDF6FF,
-0xFFF4F8FF,
-0xFF9DB3C1,
-0xFF9EBBCD,
-0xFFDAF3FF,
-0xFF88A8C1,
-0xFF8DB9DC,
-0xFF86BCE2,
-0xFF82BCE1,
-0xFF83BEE0,
-0xFF86BBDA,
-0xFF88BBDA,
-0xFF89BADB,
-0xFF89BADB,
-0xFF89B9DD,
-0xFF86BADF,
-0xFF82BCE1,
-0xFF82BCE1,
-0xFF85BBDF,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF85BADC,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6DB,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7CB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED6,
-0xFF73AED6,
-0xFF73AED8,
-0xFF72ADD7,
-0xFF67A6D2,
-0xFF67A6D2,
-0xFF68A7D2,
-0xFF68A7D2,
-0xFF69A8D3,
-0xFF69A8D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6DABD4,
-0xFF6DABD4,
-0xFF6DABD4,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF72ADD7,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF74AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD5,
-0xFF76B0D6,
-0xFF78AFD6,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF7FB7DC,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7D8,
-0xFF81B9DA,
-0xFF80B8DD,
-0xFF81B3D4,
-0xFF97BCD6,
-0xFF627584,
-0xFF0E0E0E,
-0xFF1D130A,
-0xFF1C1209,
-0xFF281C10,
-0xFF261304,
-0xFF513728,
-0xFF523223,
-0xFF4C2B1A,
-0xFF371603,
-0xFF6B4C38,
-0xFF4C311C,
-0xFF56412E,
-0xFF3B2D20,
-0xFF2C2014,
-0xFF261607,
-0xFF4A382A,
-0xFF68564A,
-0xFF342319,
-0xFFC5BBB1,
-0xFFBDBBAF,
-0xFFEDF2EB,
-0xFFD9E4E0,
-0xFFC0D0CF,
-0xFFD0E0E0,
-0xFFDFEAEE,
-0xFFDBE5E7,
-0xFFCFDBD9,
-0xFFC9D7D7,
-0xFFAFC1C5,
-0xFFCBDEE2,
-0xFFD6E9E5,
-0xFFC5D6D0,
-0xFF9BA9A9,
-0xFF879596,
-0xFFDBE7E5,
-0xFFB8C4C2,
-0xFFADB9B5,
-0xFFCADAD9,
-0xFFB1C9CB,
-0xFF637C81,
-0xFF3E555B,
-0xFF1C343E,
-0xFF0A2632,
-0xFF93B8CA,
-0xFF8BBDD6,
-0xFF81BAD8,
-0xFF81BCDC,
-0xFF7BB6D6,
-0xFF83BEDE,
-0xFF84BCDD,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF86BCDE,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF89BCDB,
-0xFF8CBDDD,
-0xFF8FBEDC,
-0xFF92BFDE,
-0xFF95C0E2,
-0xFF98C0E3,
-0xFF9DC1E5,
-0xFF9FC1E6,
-0xFFA2C0E6,
-0xFFA0C0E6,
-0xFF9CC3E4,
-0xFF9EC3E0,
-0xFFA9C5DB,
-0xFFABB3BE,
-0xFF5B423E,
-0xFF7C5246,
-0xFF643C32,
-0xFF8F7B7C,
-0xFFB3C5D9,
-0xFF8BB8D5,
-0xFF87BDD9,
-0xFF7DB9D5,
-0xFF7FBCDB,
-0xFF86BFDD,
-0xFF88B7D3,
-0xFFA9C8DC,
-0xFFEEF7FE,
-0xFFF0F7FD,
-0xFF96ABBC,
-0xFF95B0C5,
-0xFFDCF2FF,
-0xFF8BA7BF,
-0xFF8FBBDE,
-0xFF87BBE2,
-0xFF86BCE2,
-0xFF86BCDE,
-0xFF87BCDB,
-0xFF89BCDB,
-0xFF8ABBDC,
-0xFF8ABBDC,
-0xFF8ABADE,
-0xFF89BBDE,
-0xFF85BDE0,
-0xFF83BEE0,
-0xFF86BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF87BCDE,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF83B9DD,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF81B7DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF73AED8,
-0xFF73AED8,
-0xFF69A6D2,
-0xFF69A6D2,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA9D2,
-0xFF6BA9D2,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6FAAD4,
-0xFF6FAAD4,
-0xFF6FAAD2,
-0xFF70ABD3,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED6,
-0xFF75AFD7,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF79B1D6,
-0xFF79B1D6,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF78B2D7,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D7,
-0xFF7DB5D8,
-0xFF7EB4D8,
-0xFF7EB4D8,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF80B8DD,
-0xFF86B8D9,
-0xFF95BAD5,
-0xFF728896,
-0xFF080A09,
-0xFF1C130A,
-0xFF170D04,
-0xFF281C10,
-0xFF2C1B0B,
-0xFF553E2C,
-0xFF4E2F1D,
-0xFF4E2D1A,
-0xFF391805,
-0xFF5F402C,
-0xFF563A25,
-0xFF4D3624,
-0xFF39291C,
-0xFF34281C,
-0xFF281B0A,
-0xFF594C3B,
-0xFF9C8E81,
-0xFF94877E,
-0xFF988F86,
-0xFFE2DFD6,
-0xFFDEE3DC,
-0xFFDAE6E2,
-0xFFA3B5B7,
-0xFFC6D9DD,
-0xFFC5D4D7,
-0xFFCFDEE1,
-0xFFB6C8CC,
-0xFFD2E5E9,
-0xFF82979A,
-0xFF869C9A,
-0xFFD7ECE7,
-0xFF546962,
-0xFFC8DCDB,
-0xFF3E4E4E,
-0xFFEAF4F3,
-0xFF879190,
-0xFF848F91,
-0xFFEFFDFF,
-0xFF869598,
-0xFF132527,
-0xFF24393E,
-0xFF15313C,
-0xFF61879E,
-0xFF92C1DF,
-0xFF84B8DD,
-0xFF87BDE3,
-0xFF85B7DA,
-0xFF89BEDE,
-0xFF7EB9DB,
-0xFF80BCDE,
-0xFF83BBDC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BDDC,
-0xFF87BEDD,
-0xFF88BFDE,
-0xFF89BEDD,
-0xFF8CBFDE,
-0xFF8FC0E0,
-0xFF92C0E1,
-0xFF96C1E1,
-0xFF99C2E2,
-0xFF9CC3E4,
-0xFF9EC2E4,
-0xFF9EC2E4,
-0xFF9EC0E3,
-0xFF9EC0E3,
-0xFF9CC0E2,
-0xFF96C1E1,
-0xFF94C1DE,
-0xFF90BAD2,
-0xFFADCADA,
-0xFF9A9DA6,
-0xFF5F4745,
-0xFF804F3E,
-0xFF6C4234,
-0xFF958E96,
-0xFFAABED6,
-0xFF8FBADA,
-0xFF89BFE3,
-0xFF86C1E3,
-0xFF88C1DF,
-0xFF8BBDD6,
-0xFFACCDDE,
-0xFFF4FFFF,
-0xFFF3FBFE,
-0xFF8FA4B5,
-0xFF89A4B9,
-0xFFDFF4FF,
-0xFF8DA7C0,
-0xFF93BEE1,
-0xFF8ABBE3,
-0xFF88BDDF,
-0xFF88BDDD,
-0xFF8ABDDC,
-0xFF8ABDDC,
-0xFF8ABCDD,
-0xFF8ABCDF,
-0xFF8BBCDD,
-0xFF8ABCDF,
-0xFF87BDE1,
-0xFF86BEE1,
-0xFF89BEE0,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF89BBDC,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF89BBDE,
-0xFF88BADD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF74AFD7,
-0xFF74AFD7,
-0xFF6AA7D3,
-0xFF6AA7D3,
-0xFF6BA8D4,
-0xFF6BA8D4,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6DABD4,
-0xFF6DABD4,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD3,
-0xFF71ACD4,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF73AED6,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF75AFD7,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF7AB2D7,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF79B3D8,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DA,
-0xFF81B9DA,
-0xFF81B7D9,
-0xFF84BADC,
-0xFF81B7DD,
-0xFF84B6D7,
-0xFFA0C5E0,
-0xFF314858,
-0xFF1D2122,
-0xFF120B03,
-0xFF140A01,
-0xFF2E2015,
-0xFF2A1909,
-0xFF5A4331,
-0xFF422311,
-0xFF563522,
-0xFF3D1E0A,
-0xFF5D3E2A,
-0xFF5C3D28,
-0xFF452C18,
-0xFF3A281C,
-0xFF3B2F23,
-0xFF3E3222,
-0xFFF8EDDB,
-0xFFB2AB9B,
-0xFFC4BEB2,
-0xFFA7A39A,
-0xFFEDEEE8,
-0xFFD9E6DF,
-0xFFCADDDB,
-0xFFA0B3B7,
-0xFFBACDD3,
-0xFFC8DADE,
-0xFFA7B9BB,
-0xFFA9BBBF,
-0xFFCDE0E4,
-0xFF6B8387,
-0xFF99B1B1,
-0xFF3C514C,
-0xFF758A85,
-0xFF6B7F80,
-0xFF6F8185,
-0xFFF5FFFF,
-0xFF707B7D,
-0xFF39464C,
-0xFF59666C,
-0xFF212C30,
-0xFF202F34,
-0xFF193038,
-0xFF4F7081,
-0xFF9AC9E5,
-0xFF7FB5D9,
-0xFF87BCE4,
-0xFF85B9E0,
-0xFF8ABADE,
-0xFF89BBDE,
-0xFF81BCDE,
-0xFF82BDDF,
-0xFF84BCDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF86BCDE,
-0xFF86BCDE,
-0xFF86BCDE,
-0xFF86BCDE,
-0xFF86BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF89BEE0,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8BC0DF,
-0xFF8CC1E0,
-0xFF8FC2E1,
-0xFF91C2E2,
-0xFF91C4E3,
-0xFF92C3E3,
-0xFF95C2E3,
-0xFF98C1E1,
-0xFF96BFDF,
-0xFF96BFDF,
-0xFF94BFDF,
-0xFF93BEDE,
-0xFF96BDDE,
-0xFF94BDDD,
-0xFF8FBEDC,
-0xFF8CBFDA,
-0xFF8FC1DA,
-0xFF90BAD0,
-0xFFA5BBD0,
-0xFF9A97A0,
-0xFF734B3F,
-0xFF7A4B39,
-0xFF492D2A,
-0xFFA5A1AF,
-0xFFA4BDDC,
-0xFF90BCE3,
-0xFF8BBDE0,
-0xFF89BCDB,
-0xFF87B7CE,
-0xFFB3D7E5,
-0xFFE8F3F5,
-0xFFF1FBFD,
-0xFF8BA2B4,
-0xFF84A0B6,
-0xFFE1F6FF,
-0xFF8EA6BE,
-0xFF96BEE1,
-0xFF8ABCE1,
-0xFF8BBDDE,
-0xFF8ABDDA,
-0xFF8BBEDD,
-0xFF89BEDE,
-0xFF8BBDE0,
-0xFF8BBDE0,
-0xFF8CBDDE,
-0xFF8BBDDE,
-0xFF89BEE0,
-0xFF88BEE0,
-0xFF8ABFDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF8ABCDF,
-0xFF8ABCDF,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF86BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DC,
-0xFF82B8DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF77B3D8,
-0xFF76B2D7,
-0xFF76B1D9,
-0xFF76B1D9,
-0xFF75B0D8,
-0xFF75B0D8,
-0xFF6AA8D1,
-0xFF6BA9D2,
-0xFF6BA9D2,
-0xFF6CAAD3,
-0xFF6FAAD4,
-0xFF6FAAD4,
-0xFF6FAAD2,
-0xFF70ABD3,
-0xFF70ABD3,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF72ADD5,
-0xFF74AED4,
-0xFF74AED4,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF77AED5,
-0xFF77AED5,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB5D9,
-0xFF7FB5D9,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6D8,
-0xFF80B6D8,
-0xFF80B6D8,
-0xFF80B6D8,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84B8DD,
-0xFF84B8DD,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82BADD,
-0xFF82BADD,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF85BADC,
-0xFF82B8DA,
-0xFF83B9DF,
-0xFF89BADB,
-0xFF95BDD7,
-0xFF0D2434,
-0xFF121617,
-0xFF150E06,
-0xFF1C1209,
-0xFF2C1E13,
-0xFF261505,
-0xFF4A3522,
-0xFF482915,
-0xFF583724,
-0xFF4B2C18,
-0xFF563723,
-0xFF563722,
-0xFF4D3221,
-0xFF3A281E,
-0xFF21140B,
-0xFF281F0E,
-0xFFEDE6D4,
-0xFF858273,
-0xFFE4E4D8,
-0xFFD8DBD2,
-0xFFDFEAE4,
-0xFFBED7D4,
-0xFFB4D0D1,
-0xFFA0B5BA,
-0xFFC3D6DA,
-0xFFB8CCCD,
-0xFF9DAFAF,
-0xFFC6D2D2,
-0xFF798788,
-0xFF00111A,
-0xFF667D85,
-0xFF425252,
-0xFFE7F5F5,
-0xFF5D6E75,
-0xFFD7EAF1,
-0xFF526569,
-0xFF1F3236,
-0xFF1E2D34,
-0xFF424C55,
-0xFF242D34,
-0xFF1E2F39,
-0xFF4A697D,
-0xFF9FCBE4,
-0xFF86BDDC,
-0xFF85C0E2,
-0xFF85BBDD,
-0xFF86BBDD,
-0xFF88BCE1,
-0xFF84BADE,
-0xFF89BFE1,
-0xFF87BDDF,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8EC0E1,
-0xFF8FC0E0,
-0xFF8FC0DE,
-0xFF92C0E1,
-0xFF93C1E2,
-0xFF8EC3E3,
-0xFF8DC2E2,
-0xFF8EC0E1,
-0xFF8EBFDF,
-0xFF8DBEDE,
-0xFF8CBFDE,
-0xFF8AC0DC,
-0xFF8AC0DC,
-0xFF8DBEDC,
-0xFF8DBEDC,
-0xFF8CBFDE,
-0xFF8AC0DC,
-0xFF8ABDD8,
-0xFF8FBED8,
-0xFF94BBDA,
-0xFFAFC1D7,
-0xFF7F7073,
-0xFF6D4B41,
-0xFF673B2E,
-0xFF5D3F3D,
-0xFFA9ADC8,
-0xFF9BB5DA,
-0xFF96B8DB,
-0xFF95BEDC,
-0xFF91BDD6,
-0xFFB7DBEB,
-0xFFEAF5F9,
-0xFFF2FBFF,
-0xFF87A2B5,
-0xFF86A5BA,
-0xFFE0F5FF,
-0xFF8CA5BB,
-0xFF96BFDF,
-0xFF8BBDE0,
-0xFF8DBEDC,
-0xFF8CBED9,
-0xFF8AC0DC,
-0xFF89C0DF,
-0xFF8ABFE1,
-0xFF8ABFE1,
-0xFF8DBEDF,
-0xFF8DBEDE,
-0xFF8CBEDF,
-0xFF8ABFDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8BBDDE,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF80B6D8,
-0xFF80B6D8,
-0xFF7FB7D8,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF78B2D8,
-0xFF77B1D7,
-0xFF76B2D7,
-0xFF76B2D7,
-0xFF6BA9D2,
-0xFF6CAAD3,
-0xFF6CAAD3,
-0xFF6DABD4,
-0xFF70ABD5,
-0xFF70ABD5,
-0xFF70ABD3,
-0xFF71ACD4,
-0xFF71ACD4,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73AED6,
-0xFF74AED4,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF76B0D6,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF78AFD6,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF7AB1D8,
-0xFF7AB1D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7EB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF81B7DB,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF85B9DE,
-0xFF85BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83BBDE,
-0xFF83BBDC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF82B8DC,
-0xFF88B9DA,
-0xFFA0C8E2,
-0xFF001928,
-0xFF0A1010,
-0xFF140D05,
-0xFF1E1109,
-0xFF2A190F,
-0xFF2C1B0B,
-0xFF402B18,
-0xFF5A3B27,
-0xFF53321F,
-0xFF533422,
-0xFF482917,
-0xFF5A3926,
-0xFF533626,
-0xFF321E17,
-0xFF1F120A,
-0xFF342D1D,
-0xFFE2DFCE,
-0xFFADAFA1,
-0xFFDBE1D5,
-0xFFC1CBC2,
-0xFFDAEBE5,
-0xFFA2BEBF,
-0xFF829FA3,
-0xFFC2D7DC,
-0xFFBACCD0,
-0xFF677679,
-0xFFB2C0C1,
-0xFF7F8B89,
-0xFF0F1D1E,
-0xFF485A66,
-0xFF283B49,
-0xFFAEBDC0,
-0xFF99A7A8,
-0xFF74858D,
-0xFF2B3E45,
-0xFF1E3137,
-0xFF26393F,
-0xFF273840,
-0xFF384953,
-0xFF142634,
-0xFF587185,
-0xFFA3C8E3,
-0xFF8BB9DA,
-0xFF87BCDE,
-0xFF81B7D9,
-0xFF87BCDC,
-0xFF8CC1E1,
-0xFF84BADE,
-0xFF8BC1E5,
-0xFF88BDDF,
-0xFF89BBDC,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DC0DF,
-0xFF8EBFDF,
-0xFF8EBFDD,
-0xFF91BEDF,
-0xFF8FBDDE,
-0xFF8ABFDF,
-0xFF89C0DF,
-0xFF8ABFDF,
-0xFF8CBEDF,
-0xFF8DBEDF,
-0xFF8ABFDE,
-0xFF88C1DE,
-0xFF88C1DC,
-0xFF8AC0DC,
-0xFF8DC0DD,
-0xFF8DC0DF,
-0xFF8BC0DF,
-0xFF8BC0DF,
-0xFF90C2E3,
-0xFF8FBDE1,
-0xFF99BAD9,
-0xFFB3BCCB,
-0xFF695D5D,
-0xFF573325,
-0xFF6F4A41,
-0xFF5C505C,
-0xFFB9C0DA,
-0xFF9FB8D6,
-0xFF94B7D5,
-0xFF8FB7D0,
-0xFFC0DFF1,
-0xFFF0FBFF,
-0xFFE0EBF1,
-0xFF7F9EB2,
-0xFF8EB1C7,
-0xFFDEF3FF,
-0xFF8DA6BA,
-0xFF95BEDC,
-0xFF8CBEDF,
-0xFF91C0DC,
-0xFF8DBFD8,
-0xFF8BC1DD,
-0xFF8AC1E0,
-0xFF8AC0E4,
-0xFF8BC0E2,
-0xFF8EBFE0,
-0xFF90BEDF,
-0xFF8EBFDF,
-0xFF8DC0DF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF89BEDE,
-0xFF88BDDD,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4DA,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF78B2D8,
-0xFF77B3D8,
-0xFF77B3D8,
-0xFF6EA9D3,
-0xFF6FAAD4,
-0xFF6FAAD4,
-0xFF70ABD5,
-0xFF71ACD6,
-0xFF71ACD6,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF74AED6,
-0xFF74AED6,
-0xFF74AED4,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF78AFD6,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF7AB1D8,
-0xFF7BB2D9,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7EB6DB,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7CB7D9,
-0xFF7CB7D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B8DA,
-0xFF83B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF84BBDA,
-0xFF84BCDD,
-0xFF84BCDD,
-0xFF85BBDD,
-0xFF85BCDB,
-0xFF86BBDB,
-0xFF85BADC,
-0xFF83B9DD,
-0xFF8BBCDD,
-0xFF99C1DB,
-0xFF4D6776,
-0xFF000908,
-0xFF120E05,
-0xFF150600,
-0xFF311F15,
-0xFF261406,
-0xFF493423,
-0xFF583925,
-0xFF563320,
-0xFF4B2C1A,
-0xFF412210,
-0xFF593623,
-0xFF422213,
-0xFF2A160F,
-0xFF190C06,
-0xFF70685B,
-0xFFB4B2A3,
-0xFFCFD3C5,
-0xFFD8E2D9,
-0xFFC6D5CE,
-0xFFC5D8D6,
-0xFF8CA1A4,
-0xFFABBFC6,
-0xFFB3C4CB,
-0xFF4C5A5D,
-0xFFD8E0E3,
-0xFF7E888A,
-0xFF0D1F1F,
-0xFF829599,
-0xFF1B2B3B,
-0xFF2B3B4B,
-0xFFA0B2B6,
-0xFF667A79,
-0xFF556A6F,
-0xFF273A40,
-0xFF323F45,
-0xFF27363B,
-0xFF1F333C,
-0xFF072432,
-0xFF799FB6,
-0xFF9FCBE6,
-0xFF8CBBD9,
-0xFF91BFE0,
-0xFF8FBCDD,
-0xFF8FBDDE,
-0xFF8FC0E0,
-0xFF89BEDE,
-0xFF87BCDC,
-0xFF8ABFDF,
-0xFF8ABCDD,
-0xFF8BBDDE,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8BC0E0,
-0xFF8BC0E0,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8DC0DF,
-0xFF8BC0DF,
-0xFF8BC1DD,
-0xFF8FBDDE,
-0xFF8FBDDF,
-0xFF8ABFE1,
-0xFF89BFE1,
-0xFF8EBEE2,
-0xFF91BDE0,
-0xFF92BDE0,
-0xFF90BEDF,
-0xFF8AC1DF,
-0xFF8AC3E0,
-0xFF8BC0DF,
-0xFF8DC0DF,
-0xFF8EBFE0,
-0xFF8DBFE2,
-0xFF8ABEE3,
-0xFF8CBEE3,
-0xFF91BFE3,
-0xFF96BFDF,
-0xFF9CC0D8,
-0xFFB7CBD4,
-0xFF69655C,
-0xFF554233,
-0xFF594338,
-0xFF655C5D,
-0xFFACC0D8,
-0xFF9CBFDD,
-0xFF98B8CF,
-0xFFCBE5F6,
-0xFFEDF7FF,
-0xFFD8E6F1,
-0xFF779AAE,
-0xFF9CC0D6,
-0xFFDCF3FF,
-0xFF8FAABB,
-0xFF93BFDC,
-0xFF8DBFE0,
-0xFF92C1DB,
-0xFF8FC1DA,
-0xFF8CC2DE,
-0xFF8AC3E1,
-0xFF8AC2E5,
-0xFF8CC0E5,
-0xFF8FC0E1,
-0xFF91BFE0,
-0xFF91C0DE,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF89BEE0,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF8ABCDF,
-0xFF88BDDF,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF87BCDE,
-0xFF86BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF79B3D8,
-0xFF79B3D9,
-0xFF79B3D9,
-0xFF6FAAD2,
-0xFF6FAAD2,
-0xFF70ABD3,
-0xFF71ACD4,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF72ADD5,
-0xFF73AFD4,
-0xFF75AFD7,
-0xFF75AFD5,
-0xFF75AFD5,
-0xFF75AFD4,
-0xFF76B0D6,
-0xFF76B0D5,
-0xFF76B0D6,
-0xFF77B1D7,
-0xFF79B0D7,
-0xFF79B0D7,
-0xFF7AB1D8,
-0xFF7AB1D8,
-0xFF7BB2D9,
-0xFF7BB3D8,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7DB8DA,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF81B9DA,
-0xFF81B9DC,
-0xFF81B9DA,
-0xFF82B8DC,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF86BBDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF85BBDD,
-0xFF84BCDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF8ABCDD,
-0xFF88BADB,
-0xFF87BDE3,
-0xFF85BADC,
-0xFF8DB9D6,
-0xFFABC8DA,
-0xFF0F171A,
-0xFF0D0802,
-0xFF120500,
-0xFF33221A,
-0xFF1D0B00,
-0xFF452F21,
-0xFF513122,
-0xFF502F1C,
-0xFF462715,
-0xFF3C1F0D,
-0xFF583925,
-0xFF381D0C,
-0xFF220F09,
-0xFF6B605C,
-0xFFC5C1B6,
-0xFF55574A,
-0xFFA7AFA4,
-0xFFB0BDB4,
-0xFFBAC9C4,
-0xFFBBCBCA,
-0xFF96A5AA,
-0xFFCDDEE5,
-0xFF91A0A7,
-0xFFEBF8FE,
-0xFF99A0A8,
-0xFF091217,
-0xFF53686B,
-0xFF263E42,
-0xFF243443,
-0xFF495764,
-0xFF5E7273,
-0xFF2F4543,
-0xFF1D3235,
-0xFF23383D,
-0xFF1D3037,
-0xFF142833,
-0xFF294654,
-0xFF92B8CB,
-0xFF96C5E1,
-0xFF88BDDD,
-0xFF8CBEDF,
-0xFF8FBDDE,
-0xFF92BDDD,
-0xFF8FBCDB,
-0xFF89BADA,
-0xFF8EC0E1,
-0xFF8ABFDE,
-0xFF8BC0DF,
-0xFF8CBEDF,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8CBEDF,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8BC0E0,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF8BC0E0,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8BC0E0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFDF,
-0xFF8EBFE0,
-0xFF8EBFDF,
-0xFF8EBFE0,
-0xFF8DC0DF,
-0xFF8BC0DF,
-0xFF8CC1E0,
-0xFF91BFE0,
-0xFF92C0E2,
-0xFF8DC2E2,
-0xFF8FC1E2,
-0xFF91BFE1,
-0xFF93BEE1,
-0xFF95BDE1,
-0xFF92BFE0,
-0xFF8EC1E0,
-0xFF8DC2E1,
-0xFF8EC1E0,
-0xFF8FC0E0,
-0xFF91BFE0,
-0xFF8EBFE0,
-0xFF8FC1E6,
-0xFF90C2E7,
-0xFF8FBCE3,
-0xFF92BEE1,
-0xFF92BFDC,
-0xFF9ABFD1,
-0xFFB5C8CC,
-0xFF6B6C64,
-0xFF564535,
-0xFF4B3A30,
-0xFF676E76,
-0xFFB4C7D8,
-0xFF9FB6C6,
-0xFFD3E6F5,
-0xFFEEFAFF,
-0xFFC5D5E4,
-0xFF7596A9,
-0xFFA6CBDD,
-0xFFDBF5FF,
-0xFF91AEBE,
-0xFF93C1DB,
-0xFF8EC1E0,
-0xFF90C2DB,
-0xFF8FC1D8,
-0xFF8EC1DC,
-0xFF8CC1E0,
-0xFF8EC0E5,
-0xFF8EC0E5,
-0xFF8FC0E0,
-0xFF91C0DE,
-0xFF91C0DC,
-0xFF91C0DC,
-0xFF90C1E1,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF90C1E2,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DC0DF,
-0xFF8DBFE0,
-0xFF8DC0DF,
-0xFF8EBFE0,
-0xFF8DC0DF,
-0xFF8DBEDF,
-0xFF8CBEDF,
-0xFF8DBEDF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8EBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEE1,
-0xFF8BBDE0,
-0xFF8BBDE0,
-0xFF8BBDE0,
-0xFF8BBDE0,
-0xFF8BBDE0,
-0xFF8BBDE0,
-0xFF89BEDE,
-0xFF8ABCDF,
-0xFF88BDDD,
-0xFF87BCDE,
-0xFF86BCDE,
-0xFF86BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7CB6DB,
-0xFF7CB6DB,
-0xFF7BB5DA,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF7AB4D9,
-0xFF70ACD1,
-0xFF70ACD1,
-0xFF70ACD1,
-0xFF71ADD2,
-0xFF72AED3,
-0xFF73AFD4,
-0xFF75AFD5,
-0xFF74AED3,
-0xFF75AFD5,
-0xFF75AFD4,
-0xFF76B0D5,
-0xFF76B1D3,
-0xFF79B1D6,
-0xFF79B1D4,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF78B2D7,
-0xFF78B2D7,
-0xFF79B3D8,
-0xFF7AB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF81B7DB,
-0xFF80B8DB,
-0xFF80B8D9,
-0xFF80B8D9,
-0xFF80B8D9,
-0xFF81B9DA,
-0xFF82B8DA,
-0xFF82B9D8,
-0xFF82B8DA,
-0xFF83BAD9,
-0xFF84BADC,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF86BCDE,
-0xFF86BCDE,
-0xFF89BBDC,
-0xFF8CBADB,
-0xFF8DBADB,
-0xFF8BBCDD,
-0xFF86BEE3,
-0xFF84BCE1,
-0xFF8DC0DF,
-0xFFA7CADE,
-0xFF141D24,
-0xFF0E0808,
-0xFF0D0200,
-0xFF271813,
-0xFF291610,
-0xFF2D160E,
-0xFF482C20,
-0xFF482819,
-0xFF412412,
-0xFF6E533E,
-0xFF7E654F,
-0xFF210E00,
-0xFF291C13,
-0xFF2F2822,
-0xFF4E4F49,
-0xFF5F665F,
-0xFFDEEBE4,
-0xFFCDDCD5,
-0xFFBBC7C3,
-0xFFB9C5C3,
-0xFFA1AFB0,
-0xFFAEBDC2,
-0xFFDAEBF2,
-0xFF9DAEB8,
-0xFF0A1B25,
-0xFF30414B,
-0xFF80949B,
-0xFF2D4247,
-0xFF293C42,
-0xFF243638,
-0xFF253737,
-0xFF213333,
-0xFF1F3135,
-0xFF152B36,
-0xFF102F41,
-0xFF6D93AA,
-0xFFA5CDE6,
-0xFF97C3DC,
-0xFF8ABCD7,
-0xFF8EC1E0,
-0xFF8DC0DF,
-0xFF8DBEDE,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8DBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8DBEDF,
-0xFF8CBEDF,
-0xFF8DBEDF,
-0xFF8DBFE0,
-0xFF8EBFE0,
-0xFF8DBFE0,
-0xFF8DC0DF,
-0xFF8DC0DF,
-0xFF8DC0DF,
-0xFF8DC0DF,
-0xFF8DC0DF,
-0xFF8DC0DF,
-0xFF8EBFDF,
-0xFF8DC0DF,
-0xFF8FC0E0,
-0xFF8EC1E0,
-0xFF8FC0E0,
-0xFF8EC1E0,
-0xFF8FC0E0,
-0xFF8EC1E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF92C0E1,
-0xFF93C0E1,
-0xFF93C0E1,
-0xFF92C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF91C0DE,
-0xFF8FC0E0,
-0xFF90C1E9,
-0xFF91C1E7,
-0xFF95BEDC,
-0xFF99BED8,
-0xFF9CC5DB,
-0xFFACC8D6,
-0xFF6C6C6A,
-0xFF433528,
-0xFF554536,
-0xFF7C736A,
-0xFFB6BFC4,
-0xFFDCEEFA,
-0xFFEDFAFF,
-0xFFBACBDD,
-0xFF7B98A6,
-0xFFBEE0EC,
-0xFFDCF6FF,
-0xFF8FAEC0,
-0xFF94C3DD,
-0xFF8DC3DF,
-0xFF91C4DF,
-0xFF90C2D9,
-0xFF93C1D9,
-0xFF94C0DD,
-0xFF96BDE4,
-0xFF93BFE4,
-0xFF8FC2DF,
-0xFF8DC3DB,
-0xFF90C2D9,
-0xFF90C2D9,
-0xFF92C1DF,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EC1E0,
-0xFF8EC1E0,
-0xFF8EC1E0,
-0xFF8EC1E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF8FC0DE,
-0xFF91BFE0,
-0xFF8FC0DE,
-0xFF91BFE0,
-0xFF8FC0E0,
-0xFF91BFE0,
-0xFF8FC0E0,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF91BFE0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8DBEDF,
-0xFF8CBFDE,
-0xFF8DBEDF,
-0xFF8BBEDD,
-0xFF8BBDDE,
-0xFF88BDDD,
-0xFF8ABCDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BBDB,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7DB5D8,
-0xFF7CB4D7,
-0xFF73ADD3,
-0xFF72AED3,
-0xFF73ADD3,
-0xFF73AFD4,
-0xFF75AFD5,
-0xFF76B0D5,
-0xFF76B0D6,
-0xFF75AFD4,
-0xFF78AFD6,
-0xFF76B0D5,
-0xFF78B0D5,
-0xFF79B1D6,
-0xFF79B1D6,
-0xFF7AB2D5,
-0xFF7BB1D7,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF79B3D8,
-0xFF79B3D8,
-0xFF7AB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7DB5D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7D9,
-0xFF81B9DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B9D8,
-0xFF83BAD9,
-0xFF83BAD9,
-0xFF83BAD9,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF84BBDA,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF85BCDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF8ABCDD,
-0xFF8BBCDC,
-0xFF8ABCDD,
-0xFF87BDDF,
-0xFF87BEDD,
-0xFF8ABCDD,
-0xFF8DBBDC,
-0xFF92BDDD,
-0xFF8CBADB,
-0xFF85BDE2,
-0xFF87C1E6,
-0xFF88BDDD,
-0xFF9CC2D9,
-0xFF313D49,
-0xFF0B090C,
-0xFF080202,
-0xFF1A0F0B,
-0xFF36231D,
-0xFF351C15,
-0xFF391D11,
-0xFF341707,
-0xFF684D38,
-0xFF957F68,
-0xFF2D1B07,
-0xFF241707,
-0xFF1A1108,
-0xFF201D18,
-0xFF333532,
-0xFF828B8A,
-0xFFCDDCD9,
-0xFFCEDEDB,
-0xFFCAD9D6,
-0xFFD2DEDC,
-0xFF95A3A3,
-0xFFB1C0C3,
-0xFFA9BAC1,
-0xFF14272E,
-0xFF2F414D,
-0xFF6F818D,
-0xFF24373E,
-0xFF283B41,
-0xFF2A3E3D,
-0xFF253938,
-0xFF1B2F30,
-0xFF172A30,
-0xFF1E303A,
-0xFF637D8E,
-0xFFA4C9E3,
-0xFF9AC7E4,
-0xFF8FBEDA,
-0xFF8CBBD7,
-0xFF90C1DF,
-0xFF8EBFDD,
-0xFF8ABDDC,
-0xFF8FC2E1,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8DBFE0,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E0,
-0xFF8FC0E1,
-0xFF8FC0E0,
-0xFF8FC0E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EC1E0,
-0xFF8EC1E0,
-0xFF8EC1E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2DE,
-0xFF94C4DB,
-0xFF92C4DF,
-0xFF91C3E8,
-0xFF92C2E8,
-0xFF96BFDF,
-0xFF96BFDD,
-0xFF91C3E4,
-0xFF9AC3DF,
-0xFFB4C8D3,
-0xFF93948F,
-0xFF493A27,
-0xFF988871,
-0xFF7B7567,
-0xFFFAFFF9,
-0xFFEBF6FC,
-0xFFB2C4D2,
-0xFF8198A6,
-0xFFD2ECFB,
-0xFFDBF2FF,
-0xFF94B3C7,
-0xFF96C4DE,
-0xFF8CC1E0,
-0xFF8EC4E0,
-0xFF92C4DF,
-0xFF95C2D9,
-0xFF98C0DA,
-0xFF98BEE3,
-0xFF95BFE5,
-0xFF90C3E2,
-0xFF8DC5DE,
-0xFF91C3DA,
-0xFF93C3DA,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF8FC2E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF91C0DE,
-0xFF92C1DF,
-0xFF91C0DE,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE0,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF91BFE1,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8DBEDE,
-0xFF8CBFDE,
-0xFF8BBEDD,
-0xFF8BBDDE,
-0xFF8ABCDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF86BBDB,
-0xFF85BCDB,
-0xFF84BBDA,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7DB5D8,
-0xFF78AFD8,
-0xFF75AFD7,
-0xFF77AED7,
-0xFF76B0D8,
-0xFF78AFD8,
-0xFF79B0D7,
-0xFF78AFD8,
-0xFF78AFD6,
-0xFF7AAFD9,
-0xFF79B0D7,
-0xFF7AAFD7,
-0xFF7BB0D8,
-0xFF7BB0D8,
-0xFF7CB2D8,
-0xFF7DB1D9,
-0xFF7CB2D8,
-0xFF7CB4D9,
-0xFF7CB4D7,
-0xFF7DB5D8,
-0xFF7DB5D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF80B6D8,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B8DA,
-0xFF83B8DA,
-0xFF84B9DB,
-0xFF83B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9D9,
-0xFF85BADA,
-0xFF85BADA,
-0xFF85BADA,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF89BBDC,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF88BDDC,
-0xFF8BBEDD,
-0xFF8CBDDE,
-0xFF8CBDDE,
-0xFF89BEE0,
-0xFF88BFDE,
-0xFF8BBDDE,
-0xFF8EBCDD,
-0xFF90BBDB,
-0xFF8DBADB,
-0xFF8AC0E4,
-0xFF87BFE2,
-0xFF8ABFDF,
-0xFFA1C9E2,
-0xFF40505F,
-0xFF02050A,
-0xFF090909,
-0xFF0D0802,
-0xFF322117,
-0xFF563F2F,
-0xFF331702,
-0xFF3A1E08,
-0xFF351C06,
-0xFF261400,
-0xFF170B00,
-0xFF191106,
-0xFF201B15,
-0xFF272622,
-0xFF535756,
-0xFFA0AAAB,
-0xFFB6C5C8,
-0xFFACC0C1,
-0xFFAFC1C1,
-0xFFC9D9D9,
-0xFF93A6A4,
-0xFFBACCCC,
-0xFF849899,
-0xFF829599,
-0xFF6F8185,
-0xFF24363A,
-0xFF2C3B40,
-0xFF2B3A3D,
-0xFF2B3B3B,
-0xFF233537,
-0xFF374B52,
-0xFF768C9A,
-0xFFA7BDD4,
-0xFFA4C2DC,
-0xFF98C1DD,
-0xFF90BFDB,
-0xFF92C1DF,
-0xFF94C3E1,
-0xFF8FC0DE,
-0xFF8EBFDD,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1DF,
-0xFF92C0E1,
-0xFF92C1DF,
-0xFF92C0E1,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF92C4DF,
-0xFF92C5DA,
-0xFF90C4D9,
-0xFF91C2E0,
-0xFF92C3E4,
-0xFF95C1E6,
-0xFF94C2E6,
-0xFF91C1E5,
-0xFF94C1E2,
-0xFF9BC0DB,
-0xFFAEC8D7,
-0xFFA1AAA7,
-0xFF88806B,
-0xFFAD976E,
-0xFFBBA981,
-0xFFFEFFF3,
-0xFFAAB9BE,
-0xFF92A3B5,
-0xFFDEF0FF,
-0xFFE1F1FF,
-0xFF94ACC4,
-0xFF98BFDC,
-0xFF90BEE0,
-0xFF91C3E6,
-0xFF91C2E3,
-0xFF94C4DB,
-0xFF95C3DB,
-0xFF95C2E1,
-0xFF94C2E4,
-0xFF91C3E8,
-0xFF8FC4E6,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF91C2E0,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8DBEDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF85BADA,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF80B8DB,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF7EB6D9,
-0xFF78AEDA,
-0xFF78AEDA,
-0xFF78AEDA,
-0xFF78AEDA,
-0xFF78AFD8,
-0xFF79B0D9,
-0xFF79B0D9,
-0xFF7AAFD9,
-0xFF7BB0DA,
-0xFF7BB0DA,
-0xFF7BB0DA,
-0xFF7CB1DB,
-0xFF7CB1D9,
-0xFF7CB1D9,
-0xFF7DB1D9,
-0xFF7DB3D9,
-0xFF7EB4D8,
-0xFF7EB6D9,
-0xFF7EB6D9,
-0xFF7FB7DA,
-0xFF7FB7DA,
-0xFF80B8DB,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF86BBDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF89BBDC,
-0xFF88BDDD,
-0xFF8ABCDD,
-0xFF88BDDD,
-0xFF8ABCDD,
-0xFF88BDDD,
-0xFF8ABCDD,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8BBEDD,
-0xFF8BBEDD,
-0xFF8FBDDF,
-0xFF8DBEDF,
-0xFF8ABFE1,
-0xFF8ABFE1,
-0xFF8BC0E0,
-0xFF8EBFDD,
-0xFF92BEDB,
-0xFF90BDDC,
-0xFF8DC2E4,
-0xFF86BCE0,
-0xFF89BEDE,
-0xFF98C2DB,
-0xFF5E7585,
-0xFF000C14,
-0xFF4D565B,
-0xFF060805,
-0xFF1C130A,
-0xFF685648,
-0xFF5D4430,
-0xFF482F1B,
-0xFF251400,
-0xFF251909,
-0xFF221C10,
-0xFF221F18,
-0xFF1B1A16,
-0xFF313330,
-0xFF888E8E,
-0xFFDEEAEA,
-0xFFB5C7C9,
-0xFF90A5A8,
-0xFFA2B5B9,
-0xFFBBCFD0,
-0xFF869A99,
-0xFF869A99,
-0xFF778B8A,
-0xFF415554,
-0xFF384848,
-0xFF2E3C3D,
-0xFF323D3F,
-0xFF354042,
-0xFF2D3B3C,
-0xFF15272B,
-0xFF4A5D6B,
-0xFFB4CDE1,
-0xFFA1BFDB,
-0xFF99BCDC,
-0xFF96C2DF,
-0xFF8FBEDA,
-0xFF91C0DE,
-0xFF93C2E0,
-0xFF8FC0DE,
-0xFF91C2E0,
-0xFF92C3E3,
-0xFF8FC0E0,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8FC1E2,
-0xFF8FC1E2,
-0xFF8FC1E2,
-0xFF90C1E2,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF93C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF92C4DD,
-0xFF90C4D9,
-0xFF90C4D9,
-0xFF91C3DC,
-0xFF92C3E1,
-0xFF93C4E5,
-0xFF93C4E5,
-0xFF92C3E4,
-0xFF94C2E3,
-0xFF97C4E5,
-0xFF95BDD7,
-0xFFA6C2CE,
-0xFFA6B0A7,
-0xFF7D6E47,
-0xFFA89263,
-0xFFCDC7A7,
-0xFFBCC0B2,
-0xFFA4ABB1,
-0xFFE6F1FF,
-0xFFE4F1FF,
-0xFF97ABC4,
-0xFF9BBFDF,
-0xFF9AC6E9,
-0xFF99C7EB,
-0xFF8FC0E1,
-0xFF91C5DD,
-0xFF91C5DB,
-0xFF94C3DD,
-0xFF94C3E1,
-0xFF92C2E8,
-0xFF92C2E8,
-0xFF94C2E3,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF95C2E1,
-0xFF94C3E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF90C1E2,
-0xFF90C1E1,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EBFE0,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8ABFDF,
-0xFF8ABFDF,
-0xFF89BEDE,
-0xFF88BDDF,
-0xFF88BDDF,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF81B9DC,
-0xFF81B9DC,
-0xFF80B8DB,
-0xFF7FB7DA,
-0xFF75AFD7,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF76B0D8,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF77B1D9,
-0xFF7AB1DA,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7CB3DA,
-0xFF7CB3DA,
-0xFF7DB2DA,
-0xFF7EB4DA,
-0xFF7FB5D9,
-0xFF7FB5D7,
-0xFF80B6D8,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B8DA,
-0xFF83B8DA,
-0xFF84B9D9,
-0xFF84B9D9,
-0xFF84B9D9,
-0xFF85BADA,
-0xFF85BADA,
-0xFF85BADA,
-0xFF88BADB,
-0xFF88BADB,
-0xFF88BADB,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8BBCDD,
-0xFF8BBDDE,
-0xFF8CBDDE,
-0xFF8BBDDE,
-0xFF8CBDDE,
-0xFF8BBDDE,
-0xFF8CBDDE,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8CBEDF,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF90BEE0,
-0xFF90BEE0,
-0xFF8DBFE2,
-0xFF8BC0E2,
-0xFF8BC0E0,
-0xFF8EC1DE,
-0xFF90BDDA,
-0xFF93C0DF,
-0xFF8BBDDE,
-0xFF8DC2E4,
-0xFF92C4E5,
-0xFF93BFDC,
-0xFFA6C2D7,
-0xFF2E4452,
-0xFF233947,
-0xFF001018,
-0xFF000405,
-0xFF716A64,
-0xFF4B3D32,
-0xFF4F4134,
-0xFF160C00,
-0xFF757165,
-0xFF24251D,
-0xFF1E231D,
-0xFF2A302E,
-0xFF262F2C,
-0xFF535D5C,
-0xFF859491,
-0xFFACBFBD,
-0xFFD0E6E4,
-0xFFC0D5D8,
-0xFFA8BDC2,
-0xFF7D9293,
-0xFF718785,
-0xFF3F5553,
-0xFF2B3F3D,
-0xFF2A3A39,
-0xFF2D3939,
-0xFF2E3839,
-0xFF232D2E,
-0xFF111C1E,
-0xFF132229,
-0xFF001523,
-0xFFA3BFD7,
-0xFF9BBEDE,
-0xFF96BEE2,
-0xFF93C0DF,
-0xFF90BFDD,
-0xFF90BFDD,
-0xFF91C0DE,
-0xFF91C2E0,
-0xFF8FC0DE,
-0xFF90C1E1,
-0xFF92C3E3,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF91C2E2,
-0xFF91C2E2,
-0xFF91C2E2,
-0xFF91C2E2,
-0xFF91C2E2,
-0xFF92C0E1,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF93C2DE,
-0xFF93C2DE,
-0xFF93C2DE,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF93C2DE,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4DE,
-0xFF93C6DB,
-0xFF93C5DC,
-0xFF93C5E0,
-0xFF92C5E0,
-0xFF92C6DC,
-0xFF92C6DB,
-0xFF91C5DD,
-0xFF94C3DF,
-0xFF93BFDC,
-0xFF9BC4E0,
-0xFF96C2DB,
-0xFFA4C6D2,
-0xFFBAC5BD,
-0xFF827C62,
-0xFF9D875E,
-0xFFDBC8A0,
-0xFFC1BCA8,
-0xFFF2F7F3,
-0xFFE6EEF9,
-0xFF9BADC5,
-0xFF98BFDE,
-0xFF97C5E7,
-0xFF91BEDF,
-0xFF99C8E6,
-0xFF8EC8E0,
-0xFF8EC8DE,
-0xFF92C4DB,
-0xFF95C3DD,
-0xFF94C2E3,
-0xFF94C2E3,
-0xFF95C4E0,
-0xFF95C4DE,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C2DF,
-0xFF95C2DF,
-0xFF96C2DF,
-0xFF96C2DF,
-0xFF96C2DF,
-0xFF96C2DF,
-0xFF96C3E0,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF94C2E3,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF8EBFE0,
-0xFF8DBFE0,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF89BEDE,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF81B7D9,
-0xFF76B0D6,
-0xFF76B0D6,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF77B1D7,
-0xFF78B2D8,
-0xFF79B3D9,
-0xFF7BB2D9,
-0xFF7BB2D9,
-0xFF7CB4D9,
-0xFF7CB4D9,
-0xFF7DB5DA,
-0xFF7DB5DA,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF7EB6DB,
-0xFF80B6DA,
-0xFF80B6D8,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF84B9D9,
-0xFF85BADA,
-0xFF85BADA,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF88BADB,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF89BBDC,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8BBDDE,
-0xFF8CBDDE,
-0xFF8CBDDE,
-0xFF8CBDDE,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8DBEDF,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E0,
-0xFF8EC1DE,
-0xFF8FC0DE,
-0xFF91BFE0,
-0xFF91BFE1,
-0xFF8EC0E5,
-0xFF8CC1E3,
-0xFF8CC1E1,
-0xFF8EC1DE,
-0xFF93C0DD,
-0xFF93C0DD,
-0xFF94C2E3,
-0xFF8CBDDE,
-0xFF90C2E3,
-0xFF90BDDC,
-0xFF95B9D1,
-0xFFAACADF,
-0xFFACCFE5,
-0xFFAECADF,
-0xFF9BADBB,
-0xFF616A71,
-0xFF3B3C3E,
-0xFF201F1B,
-0xFF171812,
-0xFF61665F,
-0xFF1F2823,
-0xFF242F2B,
-0xFF2C3836,
-0xFF263232,
-0xFF7C8B88,
-0xFFE3F3F0,
-0xFFA9BCB6,
-0xFF9BAFAD,
-0xFFAABFC2,
-0xFF9DB5B9,
-0xFF71898B,
-0xFF809898,
-0xFF4D6565,
-0xFF233736,
-0xFF2D3D3D,
-0xFF222D2F,
-0xFF242C2F,
-0xFF10181B,
-0xFF1C252A,
-0xFF1D2B34,
-0xFF162D3D,
-0xFF55758C,
-0xFF9EC5E6,
-0xFF96C2E5,
-0xFF94C2E3,
-0xFF97C6E4,
-0xFF93C2E0,
-0xFF90BFDD,
-0xFF93C4E2,
-0xFF94C5E3,
-0xFF91C2E2,
-0xFF90C1E1,
-0xFF92C3E3,
-0xFF92C3E3,
-0xFF92C3E3,
-0xFF92C3E3,
-0xFF92C3E3,
-0xFF92C3E3,
-0xFF92C3E3,
-0xFF92C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF95C4E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C2DF,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF98C6DE,
-0xFF98C6DE,
-0xFF94C6E1,
-0xFF92C5E0,
-0xFF93C6D9,
-0xFF92C7D7,
-0xFF93C7DC,
-0xFF94C6DD,
-0xFF99C5DE,
-0xFF9DC9E4,
-0xFF93C4E4,
-0xFF93BFD8,
-0xFFBFD7E1,
-0xFFFAFFF6,
-0xFFB8A587,
-0xFF7F6542,
-0xFFCAB69B,
-0xFFFFF4E6,
-0xFFF3F3F5,
-0xFF95A5B5,
-0xFF9FC4DF,
-0xFF94C2E3,
-0xFFA0CBEB,
-0xFF90BDDA,
-0xFF90C8E1,
-0xFF8FC9DF,
-0xFF97C5DD,
-0xFF9AC4DD,
-0xFF98C3E3,
-0xFF97C4E3,
-0xFF96C5E1,
-0xFF94C6DF,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF97C3E0,
-0xFF97C3E0,
-0xFF97C3E0,
-0xFF97C3E0,
-0xFF97C3E0,
-0xFF99C2E0,
-0xFF99C2E0,
-0xFF99C2E0,
-0xFF97C4E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF94C3E1,
-0xFF94C2E3,
-0xFF94C3E1,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8EC0E1,
-0xFF8EC0E1,
-0xFF8DBFE0,
-0xFF8CBEDF,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF83B9DB,
-0xFF82B8DA,
-0xFF78B0D5,
-0xFF79B1D6,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF7AB2D7,
-0xFF7BB3D8,
-0xFF7BB3D8,
-0xFF7DB3D7,
-0xFF7DB3D7,
-0xFF7EB4D8,
-0xFF7EB4D8,
-0xFF7FB5D9,
-0xFF80B6DA,
-0xFF80B6DA,
-0xFF81B7DB,
-0xFF81B7DB,
-0xFF81B7D9,
-0xFF81B7D9,
-0xFF82B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF85BADA,
-0xFF85BADA,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF8BBCDD,
-0xFF8CBDDE,
-0xFF8CBDDD,
-0xFF8CBDDD,
-0xFF8DBEDE,
-0xFF8DBEDE,
-0xFF8DBEDE,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1DF,
-0xFF8FC2DD,
-0xFF90C2DD,
-0xFF93C0E1,
-0xFF93BFE2,
-0xFF90C0E6,
-0xFF8FC1E4,
-0xFF8DC2E1,
-0xFF8FC2DD,
-0xFF8FBDD7,
-0xFF97C3DE,
-0xFF90BDDC,
-0xFF97C5E6,
-0xFF8CBDDE,
-0xFF97C5E6,
-0xFF99C2DE,
-0xFF99C2DE,
-0xFF94BFDF,
-0xFF9CC5E5,
-0xFF9DC0DC,
-0xFFA8C4DA,
-0xFFB7CDDB,
-0xFFBACBD3,
-0xFF121D21,
-0xFF626E6E,
-0xFF576565,
-0xFF2B3939,
-0xFF304040,
-0xFF2B3D3D,
-0xFF8B9E9C,
-0xFF7A8D89,
-0xFFA3B4AC,
-0xFFACBFB9,
-0xFFB1C4C8,
-0xFF9EB5BB,
-0xFF566F73,
-0xFF4E676B,
-0xFF334C50,
-0xFF475C61,
-0xFF26373E,
-0xFF263039,
-0xFF333A42,
-0xFF131720,
-0xFF2C333B,
-0xFF223039,
-0xFF193340,
-0xFF2F5265,
-0xFFA8D4ED,
-0xFF8FBEDC,
-0xFF90BFDD,
-0xFF92C1DF,
-0xFF95C4E2,
-0xFF97C6E4,
-0xFF95C4E2,
-0xFF90BFDD,
-0xFF91C0DE,
-0xFF98C7E5,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF92C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C5DF,
-0xFF96C5DF,
-0xFF96C5DF,
-0xFF97C6E0,
-0xFF98C6E0,
-0xFF9AC3DF,
-0xFF9BC4E0,
-0xFF98C6E0,
-0xFF94C6DF,
-0xFF96C5DF,
-0xFF95C7DE,
-0xFF93CADF,
-0xFF95C9DE,
-0xFF94C4D8,
-0xFF95C3DA,
-0xFF98C7E3,
-0xFF99C1DA,
-0xFFC1D9E5,
-0xFFEFFAFE,
-0xFFE0E0E2,
-0xFFAE9F9A,
-0xFF502B19,
-0xFF825F4C,
-0xFFEBDED8,
-0xFFA7B2B8,
-0xFFA4C4D9,
-0xFF98C4E1,
-0xFF96BEE1,
-0xFF9CC7E9,
-0xFF95C7E2,
-0xFF95C7E0,
-0xFF9BC5DE,
-0xFF9EC3E0,
-0xFF9CC2E6,
-0xFF99C4E6,
-0xFF97C6E4,
-0xFF95C7E0,
-0xFF96C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF98C4DF,
-0xFF98C4DF,
-0xFF9AC3DF,
-0xFF9AC3DF,
-0xFF9BC4E0,
-0xFF9CC3E0,
-0xFF9CC3E0,
-0xFF9CC5E1,
-0xFF99C5E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF96C4DE,
-0xFF96C4DE,
-0xFF96C4DE,
-0xFF96C5DF,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C1E2,
-0xFF94C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF8FC0E1,
-0xFF8EBFE0,
-0xFF8EBFE0,
-0xFF8CBEDF,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8BBEDD,
-0xFF8BBEDD,
-0xFF8ABDDC,
-0xFF8ABDDC,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF85BADC,
-0xFF84B9DB,
-0xFF7AB0D4,
-0xFF7BB1D5,
-0xFF7BB1D5,
-0xFF7CB2D6,
-0xFF7CB2D6,
-0xFF7CB2D6,
-0xFF7DB3D7,
-0xFF7DB3D7,
-0xFF7FB4D6,
-0xFF7FB4D6,
-0xFF80B5D7,
-0xFF81B6D8,
-0xFF82B7D9,
-0xFF82B7D9,
-0xFF83B8DA,
-0xFF83B8DA,
-0xFF82B8DA,
-0xFF83B9DB,
-0xFF83B9DB,
-0xFF84BADC,
-0xFF84BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF8BBDDE,
-0xFF8BBEDD,
-0xFF8BBDDE,
-0xFF8CBFDE,
-0xFF8DBEDF,
-0xFF8DBEDE,
-0xFF8DBEDE,
-0xFF8DBEDE,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1DF,
-0xFF90C1E1,
-0xFF91C2E0,
-0xFF91C2E2,
-0xFF91C2E0,
-0xFF91C2E2,
-0xFF92C3E1,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF92C4DD,
-0xFF92C4DD,
-0xFF94C1E2,
-0xFF94C0E3,
-0xFF91C1E5,
-0xFF90C2E3,
-0xFF90C3E2,
-0xFF90C3DE,
-0xFF98C6E0,
-0xFF94C0DB,
-0xFF93C0DD,
-0xFF94C3E1,
-0xFF93C4E4,
-0xFF8EBFDF,
-0xFF94C3DF,
-0xFF93C2E0,
-0xFF93C3E7,
-0xFF8EC0E3,
-0xFF94C2E4,
-0xFF98C4E1,
-0xFF9DC1D9,
-0xFFB0CDDD,
-0xFF253B46,
-0xFF2A3C40,
-0xFF58676A,
-0xFF3D4D4D,
-0xFF26383A,
-0xFF3B4F50,
-0xFFA0B4B3,
-0xFFCADDDB,
-0xFFE0F1EB,
-0xFFBFCFCC,
-0xFF667A7B,
-0xFF84999E,
-0xFF4C6569,
-0xFF799598,
-0xFFA2BEC2,
-0xFF496068,
-0xFF223440,
-0xFF323E4A,
-0xFF2D3341,
-0xFF1C222E,
-0xFF2D363F,
-0xFF24323D,
-0xFF233E49,
-0xFF042838,
-0xFFA5D2E7,
-0xFF96C5DF,
-0xFF97C6E2,
-0xFF95C4E2,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF92C1DF,
-0xFF95C4E2,
-0xFF96C5E3,
-0xFF92C1DF,
-0xFF94C3E1,
-0xFF92C4DF,
-0xFF92C3E1,
-0xFF92C4DF,
-0xFF92C3E1,
-0xFF92C4DF,
-0xFF92C4DF,
-0xFF92C4DF,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF98C6E0,
-0xFF9CC5E3,
-0xFF9DC4E3,
-0xFF99C5E0,
-0xFF97C5DF,
-0xFF95C7E2,
-0xFF96CAE2,
-0xFF93CADF,
-0xFF94C8DD,
-0xFF99C8DC,
-0xFF9AC7DE,
-0xFF98C5E2,
-0xFF9CC1DB,
-0xFFC1D8E8,
-0xFFEAFAFF,
-0xFFBBCCDE,
-0xFFB9BBC7,
-0xFFE6CBC2,
-0xFF654133,
-0xFF67504A,
-0xFF9C9291,
-0xFFC5C8CD,
-0xFFB4C1D1,
-0xFFA6C0DB,
-0xFFA0C3E3,
-0xFF99C7E1,
-0xFF98C7E1,
-0xFF9CC4DE,
-0xFF9CC3E0,
-0xFF99C4E4,
-0xFF98C5E4,
-0xFF9AC6E1,
-0xFF99C7DF,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF99C7E1,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF9BC4E0,
-0xFF9CC5E1,
-0xFF9EC5E2,
-0xFF9EC5E2,
-0xFF9FC6E3,
-0xFF9FC6E3,
-0xFF9CC5E1,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF95C4E2,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF96C3E2,
-0xFF95C2E1,
-0xFF95C2E3,
-0xFF95C2E3,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF90C1E2,
-0xFF8FC0E1,
-0xFF8FC0E1,
-0xFF8EBFDF,
-0xFF8DBEDE,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8BBEDD,
-0xFF8BBEDD,
-0xFF8BBEDD,
-0xFF8BBDDE,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF86BBDD,
-0xFF85BADC,
-0xFF7EB2D7,
-0xFF7DB1D6,
-0xFF7EB3D5,
-0xFF7EB3D5,
-0xFF7EB3D5,
-0xFF7EB3D5,
-0xFF7FB4D6,
-0xFF80B5D7,
-0xFF82B4D7,
-0xFF83B5D8,
-0xFF84B6D9,
-0xFF85B7DA,
-0xFF85B7D8,
-0xFF85B7D8,
-0xFF85B7D8,
-0xFF86B8D9,
-0xFF85BADC,
-0xFF84BADC,
-0xFF85BBDD,
-0xFF85BBDD,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF88BDDD,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8CBEDF,
-0xFF8CBEDF,
-0xFF8CBFDE,
-0xFF8CBFDC,
-0xFF8CBFDE,
-0xFF8DC0DD,
-0xFF8EBFDF,
-0xFF8EBFDD,
-0xFF8EBFDD,
-0xFF8FC0DE,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF92C3E1,
-0xFF92C4DF,
-0xFF93C4E2,
-0xFF93C5E0,
-0xFF92C3E1,
-0xFF92C4DF,
-0xFF92C3E1,
-0xFF93C5E0,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3DF,
-0xFF93C5DC,
-0xFF95C5DC,
-0xFF97C2E2,
-0xFF97C2E5,
-0xFF95C3E5,
-0xFF93C4E4,
-0xFF92C5E2,
-0xFF93C5DE,
-0xFF96C4DC,
-0xFF97C3DC,
-0xFF97C3DE,
-0xFF96C3E0,
-0xFF95C4E2,
-0xFF93C4E2,
-0xFF93C4E2,
-0xFF93C4E4,
-0xFF93C5E6,
-0xFF8EC3E3,
-0xFF92C7E7,
-0xFF95C8E5,
-0xFF96C4DE,
-0xFFA1C7DC,
-0xFF5E7B89,
-0xFF2B424A,
-0xFF3B4D51,
-0xFF2C3B3E,
-0xFF546366,
-0xFFE1F3F5,
-0xFFDEF2F3,
-0xFFACC0C1,
-0xFF415353,
-0xFF283A3A,
-0xFF9FB1B3,
-0xFFA5B9BA,
-0xFF647C7C,
-0xFF93AFB0,
-0xFF496569,
-0xFF1F3741,
-0xFF2A3D4B,
-0xFF324251,
-0xFF242D3E,
-0xFF1B2330,
-0xFF37414B,
-0xFF283943,
-0xFF243C48,
-0xFF0F303F,
-0xFF85AEC0,
-0xFF9CCAE1,
-0xFF95C4DE,
-0xFF92C1DD,
-0xFF98C5E2,
-0xFF99C6E3,
-0xFF93C0DD,
-0xFF96C3E0,
-0xFF98C5E2,
-0xFF94C1DE,
-0xFF97C4E1,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF94C5E3,
-0xFF94C5E3,
-0xFF94C5E3,
-0xFF94C5E3,
-0xFF94C6E1,
-0xFF95C7E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF96C5E1,
-0xFF95C4E0,
-0xFF95C4E0,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF97C6E2,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF96C5E1,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7DF,
-0xFF99C6E3,
-0xFF9DC5E9,
-0xFF9EC4E9,
-0xFF9FC3E3,
-0xFF9CC5E1,
-0xFF95C8E3,
-0xFF92CAE3,
-0xFF95C9E1,
-0xFF9AC8E0,
-0xFF9EC6DF,
-0xFF9FC4DE,
-0xFF9CC5E3,
-0xFF9EC1DD,
-0xFFC6DDEF,
-0xFFE5FAFF,
-0xFFA5C8DB,
-0xFFA3C0CE,
-0xFFD5DDE0,
-0xFFFFF5F4,
-0xFF866765,
-0xFF63342E,
-0xFF9F6758,
-0xFFE1B6AD,
-0xFFC6C2D0,
-0xFFA9C1D9,
-0xFFA0CAE3,
-0xFF93C2DC,
-0xFF9DC9E2,
-0xFF9ECAE3,
-0xFF91C5DD,
-0xFF9BCDE4,
-0xFF9CC5DB,
-0xFF9FC5DC,
-0xFF9BC8DF,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9CC6DF,
-0xFF9DC7E0,
-0xFF9FC7E1,
-0xFF9FC7E1,
-0xFF9EC6E0,
-0xFF9DC5DF,
-0xFF9DC7E0,
-0xFF9CC6DF,
-0xFF9CC6DF,
-0xFF99C5DE,
-0xFF98C4DD,
-0xFF97C5DD,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF96C4DE,
-0xFF96C4DE,
-0xFF95C2DF,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF92C0E1,
-0xFF92C0E1,
-0xFF90C1E1,
-0xFF90C1E1,
-0xFF90C1DF,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF8DBEDE,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8BBEDD,
-0xFF8BBEDD,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF89BBDC,
-0xFF88BADB,
-0xFF86BBDB,
-0xFF86BBDB,
-0xFF7FB1D6,
-0xFF7DB1D6,
-0xFF80B2D5,
-0xFF7FB4D6,
-0xFF81B3D6,
-0xFF7FB4D6,
-0xFF82B4D7,
-0xFF82B7D9,
-0xFF85B7DA,
-0xFF86B8DB,
-0xFF86B8DB,
-0xFF87B9DC,
-0xFF87B9DA,
-0xFF87B9DA,
-0xFF88BADB,
-0xFF88BADB,
-0xFF85BADA,
-0xFF84BBDA,
-0xFF86BBDD,
-0xFF87BCDC,
-0xFF88BDDF,
-0xFF88BDDD,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF8CBEDF,
-0xFF8ABFDE,
-0xFF8CBEDF,
-0xFF8CBFDE,
-0xFF8DBFE0,
-0xFF8DC0DF,
-0xFF8DBFE0,
-0xFF8DC0DF,
-0xFF8EC1DE,
-0xFF8EC1DE,
-0xFF8EC1DE,
-0xFF8FC2DD,
-0xFF90C1DF,
-0xFF91C3DE,
-0xFF91C2E0,
-0xFF91C3DE,
-0xFF92C3E1,
-0xFF92C4DF,
-0xFF93C4E2,
-0xFF93C5E0,
-0xFF93C4E2,
-0xFF94C6E1,
-0xFF94C5E3,
-0xFF94C6E1,
-0xFF94C6E1,
-0xFF94C6DF,
-0xFF94C6E1,
-0xFF94C6DF,
-0xFF94C6E1,
-0xFF94C6DF,
-0xFF94C6E1,
-0xFF94C6DF,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF96C6DC,
-0xFF96C6DD,
-0xFF98C4E1,
-0xFF98C3E5,
-0xFF97C4E5,
-0xFF96C5E3,
-0xFF94C6DF,
-0xFF96C6DD,
-0xFF98C6DE,
-0xFF99C5DE,
-0xFF99C5E0,
-0xFF98C6E0,
-0xFF97C6E2,
-0xFF95C6E4,
-0xFF95C6E4,
-0xFF95C6E4,
-0xFF93C4E2,
-0xFF96C9E6,
-0xFF90C3E0,
-0xFF91C4DF,
-0xFF99C8E2,
-0xFF9DC7DD,
-0xFFA5C6D7,
-0xFF4B636F,
-0xFF3A4B52,
-0xFF778588,
-0xFFD5E3E4,
-0xFFBAC8C9,
-0xFF849696,
-0xFF6F8183,
-0xFFAFC2C6,
-0xFFCCDEE2,
-0xFFCCDCDC,
-0xFFA2B4B4,
-0xFF5C7270,
-0xFF526C6B,
-0xFF314D50,
-0xFF264148,
-0xFF2F4552,
-0xFF7D8E9E,
-0xFF1A2737,
-0xFF14202E,
-0xFF303C48,
-0xFF2B3C46,
-0xFF29414D,
-0xFF133342,
-0xFF799EB1,
-0xFF9FC9E1,
-0xFF9CCAE4,
-0xFF98C7E3,
-0xFF93C0DD,
-0xFF95C2DF,
-0xFF9DCAE7,
-0xFF94C2DC,
-0xFF9AC7E4,
-0xFF99C7E1,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E0,
-0xFF97C6E2,
-0xFF95C6E4,
-0xFF95C6E4,
-0xFF95C6E4,
-0xFF95C7E2,
-0xFF95C7E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF96C5E1,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF98C7E3,
-0xFF97C6E2,
-0xFF97C6E2,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF99C8E2,
-0xFF99C8E2,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9AC7E4,
-0xFF9CC7EA,
-0xFF9DC5E9,
-0xFFA0C4E4,
-0xFF9DC6E2,
-0xFF97C9E4,
-0xFF94CAE4,
-0xFF99C8E4,
-0xFF9BC7E2,
-0xFFA0C5DF,
-0xFFA0C5E0,
-0xFF9DC6E4,
-0xFF9EC1DD,
-0xFFC9DEEF,
-0xFFE3FAFF,
-0xFF9EC9DC,
-0xFF9BC4D6,
-0xFFC7DDE8,
-0xFFF6F5FB,
-0xFFFFF7FB,
-0xFFAD7F7F,
-0xFF703024,
-0xFF764034,
-0xFF9A878B,
-0xFFBCC5D4,
-0xFFADC9DF,
-0xFFA2CAE3,
-0xFFA4C9E4,
-0xFF99C3DC,
-0xFF98CCE2,
-0xFF93C7DC,
-0xFF9CC6DC,
-0xFFA2C8DF,
-0xFF9BC8DF,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9BC7E0,
-0xFF9AC6DF,
-0xFF9CC6DF,
-0xFF9DC7E0,
-0xFF9FC7E1,
-0xFF9FC7E1,
-0xFF9EC6E0,
-0xFF9DC5DF,
-0xFF9EC6E0,
-0xFF9DC7E0,
-0xFF9CC6DF,
-0xFF9CC6DF,
-0xFF9BC5DE,
-0xFF99C5DE,
-0xFF99C5E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF96C3E2,
-0xFF95C2E1,
-0xFF95C2E1,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF94C2E3,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C1E2,
-0xFF93C2E0,
-0xFF90C1DF,
-0xFF90C1E1,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF8DC0DF,
-0xFF8DC0DF,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8BBDDE,
-0xFF8BBDDE,
-0xFF8ABCDD,
-0xFF8ABCDD,
-0xFF87BCDC,
-0xFF87BCDC,
-0xFF7FB3D8,
-0xFF7EB4D8,
-0xFF80B4D9,
-0xFF80B6DA,
-0xFF82B6DB,
-0xFF81B7DB,
-0xFF83B7DC,
-0xFF83B9DD,
-0xFF84B9DB,
-0xFF84B9DB,
-0xFF85BADC,
-0xFF85BADC,
-0xFF85BADC,
-0xFF86BBDD,
-0xFF86BBDD,
-0xFF86BBDB,
-0xFF88BDDD,
-0xFF88BDDC,
-0xFF8BBDDE,
-0xFF8BBEDD,
-0xFF8CBEDF,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8DC0DF,
-0xFF8EBFDF,
-0xFF8DC0DD,
-0xFF8EBFDF,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF90C1DF,
-0xFF91C2E0,
-0xFF91C3DE,
-0xFF91C3DE,
-0xFF92C4DD,
-0xFF94C3DF,
-0xFF95C4DE,
-0xFF95C4E0,
-0xFF95C4DE,
-0xFF96C5E1,
-0xFF96C5DF,
-0xFF97C6E2,
-0xFF97C6E0,
-0xFF97C6E2,
-0xFF98C7E1,
-0xFF98C7E3,
-0xFF98C7E1,
-0xFF98C7E1,
-0xFF98C8DF,
-0xFF99C8E2,
-0xFF99C9E0,
-0xFF98C7E1,
-0xFF98C8DF,
-0xFF99C8E2,
-0xFF99C9E0,
-0xFF99C7E1,
-0xFF9AC8E0,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9AC9DD,
-0xFF9AC8DF,
-0xFF9BC7E2,
-0xFF9DC6E4,
-0xFF9BC7E4,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9BC9E3,
-0xFF99C8E2,
-0xFF99C8E6,
-0xFF99C8E4,
-0xFF9CC8E1,
-0xFF99C5DE,
-0xFFA1CDE6,
-0xFF9BC9E0,
-0xFF9BC5DB,
-0xFFA2C8DD,
-0xFFABCCDD,
-0xFF8DA8B3,
-0xFFAFC0C7,
-0xFFBEC9CB,
-0xFFA1ACA8,
-0xFFB3BEB8,
-0xFFBECDCA,
-0xFFC6D8D8,
-0xFFD0E5EA,
-0xFFB9CED3,
-0xFF8B9B9B,
-0xFFA1B1B0,
-0xFF4F6361,
-0xFF3D5653,
-0xFF213D3E,
-0xFF3F5B5F,
-0xFF98B1B8,
-0xFF152934,
-0xFF2B3B48,
-0xFF3E4C57,
-0xFF909EA7,
-0xFF24353F,
-0xFF2D4351,
-0xFF1C374A,
-0xFF55758E,
-0xFFAACFEA,
-0xFF96C2DD,
-0xFF96C4DE,
-0xFF9DCBE5,
-0xFF97C5DF,
-0xFF9AC6E1,
-0xFF9AC6DF,
-0xFF9BC7E2,
-0xFF99C5DE,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF98C7E1,
-0xFF99C8E4,
-0xFF99C8E4,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF98C7E3,
-0xFF99C6E3,
-0xFF99C6E3,
-0xFF9AC8E2,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF9AC8E0,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9BC9E1,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9BC9E3,
-0xFF9AC9E7,
-0xFF9BC8E5,
-0xFF9CC9E0,
-0xFF9CC9E0,
-0xFF9BC8E5,
-0xFF9BC8E5,
-0xFF9EC7E3,
-0xFF9EC8E1,
-0xFF9DC9E2,
-0xFF9CC8E3,
-0xFF9CC9E6,
-0xFF9DC1D7,
-0xFFD1E4EB,
-0xFFE4F8FF,
-0xFF9FC5D8,
-0xFF9EC4DB,
-0xFFD0E0EF,
-0xFFEEF0FC,
-0xFFEDE9F7,
-0xFFBAAFBD,
-0xFFC4B0BC,
-0xFF8C757F,
-0xFF6C555B,
-0xFF62555E,
-0xFF9AA0B0,
-0xFFB8CAE2,
-0xFFA6BFDE,
-0xFFA3C4E3,
-0xFF9BC8DF,
-0xFF9DD0E5,
-0xFF9BCDE6,
-0xFF97C6E0,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9CC9E0,
-0xFF9CC9E0,
-0xFF9DC7DF,
-0xFF9DC7DF,
-0xFF9FC7E0,
-0xFF9FC7E0,
-0xFFA1C6E0,
-0xFFA0C5DF,
-0xFFA1C6E0,
-0xFF9FC7E0,
-0xFF9EC6DF,
-0xFF9DC7DF,
-0xFF9DC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9CC6DF,
-0xFF9CC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF99C5DE,
-0xFF99C5DE,
-0xFF99C5DE,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF98C4DF,
-0xFF98C4DF,
-0xFF98C4DF,
-0xFF97C3DE,
-0xFF98C4DF,
-0xFF98C4DF,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF94C1DE,
-0xFF94C1DE,
-0xFF94C1DE,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF93C0DF,
-0xFF93C0DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF91C0DE,
-0xFF8FC0DE,
-0xFF8FC0DE,
-0xFF8EBFDD,
-0xFF8EBFDD,
-0xFF8DBEDE,
-0xFF8DBEDE,
-0xFF8DBEDE,
-0xFF8CBDDD,
-0xFF8BBEDD,
-0xFF8BBEDD,
-0xFF8ABDDC,
-0xFF8ABDDC,
-0xFF80B5D7,
-0xFF7FB5D7,
-0xFF81B6D8,
-0xFF82B8DA,
-0xFF83B8DA,
-0xFF82B8DA,
-0xFF84B9DB,
-0xFF84BADC,
-0xFF87BCDC,
-0xFF86BDDC,
-0xFF88BDDD,
-0xFF87BEDD,
-0xFF88BDDD,
-0xFF88BFDE,
-0xFF89BEDE,
-0xFF89BEDE,
-0xFF8CBFDE,
-0xFF8DBEDC,
-0xFF8EBFDD,
-0xFF8EBFDD,
-0xFF8EBFDD,
-0xFF8EBFDD,
-0xFF91C0DE,
-0xFF91C0DE,
-0xFF92C1DF,
-0xFF92C1DD,
-0xFF92C1DD,
-0xFF92C1DD,
-0xFF93C2DE,
-0xFF93C2DE,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF95C4E0,
-0xFF95C4DE,
-0xFF95C4DE,
-0xFF96C5DF,
-0xFF96C5DF,
-0xFF97C6E0,
-0xFF98C6E0,
-0xFF98C8DF,
-0xFF99C7E1,
-0xFF98C8DF,
-0xFF9AC8E2,
-0xFF99C9E0,
-0xFF9AC8E2,
-0xFF9ACAE1,
-0xFF9BC9E3,
-0xFF9ACAE1,
-0xFF9CCAE2,
-0xFF9BCBE2,
-0xFF9CCAE2,
-0xFF9BCBE2,
-0xFF9CCAE2,
-0xFF9CCAE2,
-0xFF9CCAE2,
-0xFF9DCBE3,
-0xFF9CCAE2,
-0xFF9CCAE2,
-0xFF9DC9E2,
-0xFF9CCAE2,
-0xFF9ECAE3,
-0xFF9DCBE3,
-0xFF9ECAE3,
-0xFF9DCBE2,
-0xFF9DCCE0,
-0xFF9ECBE0,
-0xFF9ECAE3,
-0xFFA0C9E5,
-0xFFA0CAE3,
-0xFF9ECAE3,
-0xFF9ECBE2,
-0xFF9ECBE2,
-0xFF9ECAE3,
-0xFF9ECAE3,
-0xFF9ECAE3,
-0xFF9ECAE3,
-0xFF9ECBE2,
-0xFF9DCBE3,
-0xFF9DCBE5,
-0xFF9ECAE5,
-0xFFA0C8E1,
-0xFFA3C9E0,
-0xFF9EC7DD,
-0xFFA3CCE0,
-0xFF9FC8DC,
-0xFFA5CADD,
-0xFFACCBDD,
-0xFFCEE9F4,
-0xFFCADBE2,
-0xFFC2CECE,
-0xFFC8D1CC,
-0xFFC9D3CA,
-0xFFBFCCC5,
-0xFFC2D5D1,
-0xFFA0B5BA,
-0xFF72878C,
-0xFF9AACAC,
-0xFF839390,
-0xFF344944,
-0xFF5E7471,
-0xFF7C9695,
-0xFFB4CECF,
-0xFF0F282D,
-0xFF283F45,
-0xFF30434A,
-0xFF6F8088,
-0xFFBBC9D2,
-0xFF3B4C56,
-0xFF314453,
-0xFF274054,
-0xFF213C57,
-0xFFB2D4F0,
-0xFFA2CBE7,
-0xFF9BC9E3,
-0xFF9AC8E2,
-0xFF9BC9E1,
-0xFF9BC7E0,
-0xFF9CC8E1,
-0xFF9AC6DF,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9BC9E3,
-0xFF9BC9E3,
-0xFF9BC8E5,
-0xFF9BC9E3,
-0xFF9BC8E5,
-0xFF9BC9E3,
-0xFF9BC9E3,
-0xFF9BC9E3,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9CC8E3,
-0xFF9BC9E1,
-0xFF9DC9E4,
-0xFF9CCAE2,
-0xFF9DC9E4,
-0xFF9DC9E2,
-0xFF9DC9E4,
-0xFF9DC9E2,
-0xFF9DC9E4,
-0xFF9DC9E2,
-0xFF9CC9E0,
-0xFF9BC9E0,
-0xFF9DC9E2,
-0xFF9CCAE2,
-0xFF9DC9E2,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9CCAE2,
-0xFF9ACAE1,
-0xFF9BCADE,
-0xFF9BCADE,
-0xFF9CC8E3,
-0xFF9EC7E3,
-0xFF9FC7E1,
-0xFF9FC7E1,
-0xFF9DC9E2,
-0xFF9CCAE2,
-0xFF9DCBE5,
-0xFF9EC1D5,
-0xFFD6E7EE,
-0xFFE1F2F9,
-0xFF9EC3D6,
-0xFFA1C5DD,
-0xFFC9D9E8,
-0xFFF2F8FF,
-0xFFE7F0FF,
-0xFFA2ADC1,
-0xFFB6C0D9,
-0xFFC0C5D9,
-0xFFD3CBD6,
-0xFFD0C9D1,
-0xFFA4AABA,
-0xFF838FA5,
-0xFFAEBAD4,
-0xFFB7CBE6,
-0xFFA1C4DA,
-0xFF98C5DA,
-0xFF98C7E1,
-0xFF9CCBE7,
-0xFF9CCAE2,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9DCAE1,
-0xFF9CC9E0,
-0xFF9EC8E0,
-0xFF9EC8E0,
-0xFF9FC7E0,
-0xFF9FC7E0,
-0xFFA2C7E1,
-0xFFA2C7E1,
-0xFFA2C7E1,
-0xFFA2C7E1,
-0xFFA1C6E0,
-0xFF9FC7E0,
-0xFF9FC7E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9CC8E1,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9BC7E0,
-0xFF9DC7E0,
-0xFF9DC7E0,
-0xFF9DC7E0,
-0xFF9DC7E0,
-0xFF9CC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6DF,
-0xFF9AC6E1,
-0xFF99C5E0,
-0xFF9BC7E2,
-0xFF9AC6E1,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF98C4DF,
-0xFF98C4DF,
-0xFF99C5E0,
-0xFF99C5E0,
-0xFF97C4E1,
-0xFF97C4E1,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2E1,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF94C1E0,
-0xFF91C0DE,
-0xFF91C0DE,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF8FC0DE,
-0xFF8FC0DE,
-0xFF8EBFDD,
-0xFF8EBFDD,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF8CBFDE,
-0xFF83B5D6,
-0xFF81B6D6,
-0xFF85B8D7,
-0xFF84B9D8,
-0xFF87BAD9,
-0xFF85BAD9,
-0xFF88BBDA,
-0xFF87BCDB,
-0xFF8ABDDC,
-0xFF89BEDD,
-0xFF8BBEDB,
-0xFF89BFDB,
-0xFF8CBFDC,
-0xFF8AC0DC,
-0xFF8CBFDC,
-0xFF8CBFDC,
-0xFF8FBEDA,
-0xFF8FBEDA,
-0xFF90BFDB,
-0xFF91C0DC,
-0xFF91C0DC,
-0xFF92C1DD,
-0xFF94C1DE,
-0xFF94C2DC,
-0xFF94C2DC,
-0xFF95C3DD,
-0xFF95C3DD,
-0xFF96C4DE,
-0xFF96C4DE,
-0xFF97C5DF,
-0xFF98C4DF,
-0xFF98C4DF,
-0xFF99C7E1,
-0xFF99C7DF,
-0xFF99C7DF,
-0xFF9AC8E0,
-0xFF9AC8E0,
-0xFF9BC9E1,
-0xFF9CC8E1,
-0xFF9BC9E0,
-0xFF9DC9E2,
-0xFF9CCAE1,
-0xFF9DC9E2,
-0xFF9DCBE2,
-0xFF9ECAE3,
-0xFF9DCBE2,
-0xFF9FCBE4,
-0xFF9ECCE3,
-0xFF9FCCE3,
-0xFF9FCDE4,
-0xFFA0CDE4,
-0xFF9FCDE4,
-0xFFA0CDE4,
-0xFFA0CDE4,
-0xFFA0CDE4,
-0xFFA1CEE5,
-0xFFA0CDE4,
-0xFFA0CDE4,
-0xFFA2CCE4,
-0xFFA0CDE4,
-0xFFA2CCE4,
-0xFFA0CDE4,
-0xFFA2CCE4,
-0xFFA0CDE4,
-0xFFA0CDE2,
-0xFFA0CDE2,
-0xFFA1CDE6,
-0xFFA3CDE6,
-0xFFA3CDE5,
-0xFFA4CDE3,
-0xFFA4CDE1,
-0xFFA4CDE3,
-0xFFA2CCE5,
-0xFFA0CCE7,
-0xFFA0CCE5,
-0xFFA0CDE4,
-0xFFA0CDE2,
-0xFFA2CCE2,
-0xFFA2CCE5,
-0xFFA3CBE5,
-0xFFA4C8E2,
-0xFFA8CCE4,
-0xFFA4CADF,
-0xFFA5CBE0,
-0xFFA7CDE0,
-0xFFA4C7DA,
-0xFFA9C9D8,
-0xFFBBD3DF,
-0xFFC4D5DC,
-0xFFD6E2E0,
-0xFFCFDAD2,
-0xFFC5D1C7,
-0xFFA9B9AE,
-0xFF859892,
-0xFF96ACAA,
-0xFFD3E8E9,
-0xFF899C9A,
-0xFF42524F,
-0xFF6C817C,
-0xFFB2C8C5,
-0xFF9FB8B5,
-0xFF3C5456,
-0xFF1F373B,
-0xFF2D4247,
-0xFF304349,
-0xFF6C7E82,
-0xFFE2F4F8,
-0xFF4E5F66,
-0xFF516570,
-0xFF213649,
-0xFF1F3751,
-0xFF8FADC9,
-0xFFA1C9E3,
-0xFFA0CCE5,
-0xFF99C5DE,
-0xFF9CC9E0,
-0xFFA1CBE3,
-0xFF9CC6DE,
-0xFFA3CDE5,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9DCAE1,
-0xFF9DCAE1,
-0xFF9DCAE1,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E4,
-0xFF9DC9E2,
-0xFF9DC9E4,
-0xFF9DC9E2,
-0xFF9ECAE3,
-0xFF9ECAE3,
-0xFF9FC9E2,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFFA1CBE4,
-0xFF9FCCE3,
-0xFFA1CBE4,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFFA0CAE3,
-0xFFA0CAE2,
-0xFFA0CAE3,
-0xFFA0CAE2,
-0xFFA0CAE3,
-0xFFA0CAE2,
-0xFF9FC9E1,
-0xFF9DCAE1,
-0xFF9FC9E1,
-0xFF9DCAE1,
-0xFF9FC9E1,
-0xFF9DCAE1,
-0xFF9FC9E1,
-0xFF9DCAE1,
-0xFF9FC9E1,
-0xFF9DCAE1,
-0xFF9FC9E2,
-0xFF9DC9E2,
-0xFF9FC9E2,
-0xFF9DC9E2,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9DF,
-0xFF9DCADD,
-0xFF9DCADD,
-0xFF9CCBDD,
-0xFF9BCBE1,
-0xFF9CCAE2,
-0xFF9FC9E1,
-0xFFA0C8E1,
-0xFFA0C9DF,
-0xFFA0CAE0,
-0xFFA0CAE2,
-0xFFA1C1D6,
-0xFFDDEBF6,
-0xFFDDEBF6,
-0xFFA2C2D7,
-0xFFA4C7DB,
-0xFFD6EAF3,
-0xFFE4F1F7,
-0xFFE3F1FE,
-0xFF9CAFC0,
-0xFFACC8DE,
-0xFFA6C6DB,
-0xFFABC6D7,
-0xFFAEC8D7,
-0xFFACC9DB,
-0xFFBCCFE0,
-0xFF6E6E7A,
-0xFF9FA1AE,
-0xFFB8CFE1,
-0xFFA2C5D9,
-0xFFA7CDE4,
-0xFFA0C8E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9EC8E0,
-0xFF9EC8E0,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9DC9E2,
-0xFF9FC9E2,
-0xFF9DC9E2,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFFA0C8E1,
-0xFF9FC7E0,
-0xFFA2C8DF,
-0xFFA2C8DF,
-0xFFA4C8E0,
-0xFFA5C9E1,
-0xFFA5C9E1,
-0xFFA4C8E0,
-0xFFA3C7DF,
-0xFFA2C8DF,
-0xFFA2C7E1,
-0xFFA0C8E1,
-0xFF9FC9E2,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFFA0C8E2,
-0xFFA0C8E2,
-0xFF9FC7E0,
-0xFF9EC8E0,
-0xFF9EC8E1,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9DC7E0,
-0xFF9CC6DF,
-0xFF9CC6DF,
-0xFF9CC6DF,
-0xFF9CC6DF,
-0xFF9AC6DF,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF95C2DF,
-0xFF92C1DD,
-0xFF93C2DE,
-0xFF93C2DE,
-0xFF93C2DE,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF92C1DF,
-0xFF92C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF8FC0DE,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF8EBFDF,
-0xFF8CB9D8,
-0xFF8CBBD7,
-0xFF8EBBD8,
-0xFF8FBED8,
-0xFF91BEDB,
-0xFF90BFD9,
-0xFF92BFDC,
-0xFF93C2DC,
-0xFF92BFDC,
-0xFF91C0DA,
-0xFF92C0DA,
-0xFF92C2D9,
-0xFF93C1DB,
-0xFF93C3DA,
-0xFF93C1DB,
-0xFF93C1D9,
-0xFF94C2DC,
-0xFF96C2DB,
-0xFF96C2DB,
-0xFF96C2DB,
-0xFF96C2DB,
-0xFF97C3DC,
-0xFF97C3DC,
-0xFF99C3DC,
-0xFF9AC4DD,
-0xFF9AC4DC,
-0xFF9AC4DC,
-0xFF9BC5DD,
-0xFF9BC5DD,
-0xFF9CC6DE,
-0xFF9CC6DE,
-0xFF9CC6DE,
-0xFF9EC8E1,
-0xFF9CC8E1,
-0xFF9CC8E1,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9ECBE2,
-0xFFA0CAE2,
-0xFF9ECBE2,
-0xFFA1CBE3,
-0xFF9FCCE3,
-0xFFA1CBE3,
-0xFFA0CDE4,
-0xFFA2CCE4,
-0xFFA0CDE4,
-0xFFA3CDE5,
-0xFFA1CEE5,
-0xFFA3CDE5,
-0xFFA2CFE4,
-0xFFA4CEE6,
-0xFFA2CFE4,
-0xFFA4CEE6,
-0xFFA4CEE4,
-0xFFA5CFE7,
-0xFFA5CFE5,
-0xFFA4CEE6,
-0xFFA4CEE4,
-0xFFA6CEE7,
-0xFFA5CFE5,
-0xFFA6CEE7,
-0xFFA5CFE5,
-0xFFA6CEE7,
-0xFFA5CFE5,
-0xFFA5D0E3,
-0xFFA3D0E5,
-0xFFA3D0E7,
-0xFFA5CFE7,
-0xFFA6CFE3,
-0xFFA8CEE1,
-0xFFA8CEE1,
-0xFFA9CFE4,
-0xFFA6CEE8,
-0xFFA3CFEA,
-0xFFA3CFE8,
-0xFFA3D0E7,
-0xFFA5D0E3,
-0xFFA6CFE1,
-0xFFA8CEE5,
-0xFFA9CDE7,
-0xFFADD1E9,
-0xFFA6CCE1,
-0xFFA8D1E7,
-0xFFA3CCE0,
-0xFFA5CEE0,
-0xFFABD0E0,
-0xFFB5D2E0,
-0xFFD1E9F3,
-0xFFBBCDD1,
-0xFFAEBCBC,
-0xFF8F9E97,
-0xFF91A197,
-0xFFADBEB6,
-0xFFCFE2DC,
-0xFFC2D6D4,
-0xFF5B6F6E,
-0xFF576A68,
-0xFFCCDFDD,
-0xFFDBEFED,
-0xFF516563,
-0xFF788D8E,
-0xFF273C3F,
-0xFF24393E,
-0xFF495C62,
-0xFF26383C,
-0xFF90A2A6,
-0xFF9DAFB1,
-0xFF5E7072,
-0xFF71848B,
-0xFF475A68,
-0xFF12273C,
-0xFF607A93,
-0xFFB3D8F2,
-0xFF99C5DE,
-0xFFA4D1E8,
-0xFFA0CDE4,
-0xFFA1CBE3,
-0xFFA0CAE2,
-0xFFA5CFE7,
-0xFFA0CAE2,
-0xFFA1CBE3,
-0xFFA1CBE3,
-0xFFA1CBE3,
-0xFFA1CBE3,
-0xFFA1CBE3,
-0xFF9FCCE3,
-0xFF9FCBE4,
-0xFFA1CBE4,
-0xFFA1CBE4,
-0xFFA1CBE3,
-0xFFA2CAE4,
-0xFFA1CBE3,
-0xFFA2CAE4,
-0xFFA1CBE3,
-0xFFA3CBE4,
-0xFFA2CCE4,
-0xFFA3CBE4,
-0xFFA2CCE4,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA3CBE4,
-0xFFA2CCE2,
-0xFFA2CAE3,
-0xFFA1CBE1,
-0xFFA2CAE3,
-0xFFA2CBE1,
-0xFFA2CAE3,
-0xFFA2CBE1,
-0xFFA4C9E3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA1CBE3,
-0xFFA2CAE3,
-0xFFA1CBE3,
-0xFFA2CAE3,
-0xFFA1CBE3,
-0xFFA2CAE3,
-0xFFA0CAE2,
-0xFFA1C9E2,
-0xFFA0CAE2,
-0xFFA1C9E3,
-0xFFA0CAE3,
-0xFFA1C9E3,
-0xFFA0CAE3,
-0xFFA1C9E3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE0,
-0xFFA1CAE0,
-0xFFA1CADE,
-0xFFA0CBDE,
-0xFF9ECBDE,
-0xFF9ECBE0,
-0xFFA0CAE2,
-0xFFA1C9E3,
-0xFFA1C9E2,
-0xFFA1CAE0,
-0xFFA2CBDF,
-0xFFA2CBE1,
-0xFFA4C5D8,
-0xFFDEEEFB,
-0xFFD4E4F3,
-0xFFA6C5DA,
-0xFFA8C9DC,
-0xFFD2E5EB,
-0xFFE7F5F8,
-0xFFE2F0F9,
-0xFFA0B5C6,
-0xFFAACEE4,
-0xFF9DCAE1,
-0xFFA3CDE3,
-0xFF9FC9DF,
-0xFFA4CAE1,
-0xFFADC8DB,
-0xFFC2C4D0,
-0xFF221F28,
-0xFF9FA9B5,
-0xFFB6CBDC,
-0xFFA3C2D7,
-0xFFA3C9E0,
-0xFFA1C9E2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFFA0C8E2,
-0xFFA0C8E2,
-0xFFA0C8E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFFA0C8E1,
-0xFFA2C7E1,
-0xFFA3C9E0,
-0xFFA4C8E0,
-0xFFA5C9E1,
-0xFFA7C9E2,
-0xFFA7C9E2,
-0xFFA6C8E1,
-0xFFA5C7E0,
-0xFFA3C7DF,
-0xFFA3C8E2,
-0xFFA3C8E2,
-0xFFA0C8E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFFA0CAE3,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA1C9E2,
-0xFFA1C9E2,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9EC8E1,
-0xFF9CC8E1,
-0xFF9CC8E3,
-0xFF9AC8E2,
-0xFF9AC8E2,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C4E1,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C2DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8FC0E0,
-0xFF8EBFDF,
-0xFF9CBFDB,
-0xFF9CC1DB,
-0xFF9EC2DC,
-0xFF9FC5DC,
-0xFFA0C4DE,
-0xFF9FC5DC,
-0xFFA0C4DE,
-0xFFA0C6DD,
-0xFFA3C7E1,
-0xFFA2C8DF,
-0xFFA3C7DF,
-0xFFA2C8DD,
-0xFFA4C8E0,
-0xFFA3C9DE,
-0xFFA4C8E0,
-0xFFA2C8DF,
-0xFFA1C9E2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC9E1,
-0xFF9FC7E0,
-0xFFA0C8E1,
-0xFFA0C9DF,
-0xFFA0C9DF,
-0xFFA1CAE0,
-0xFFA1CAE0,
-0xFFA1CAE0,
-0xFFA1CAE0,
-0xFFA1CAE0,
-0xFFA1CBE3,
-0xFFA2CCE4,
-0xFFA2CCE4,
-0xFFA2CCE4,
-0xFFA2CCE4,
-0xFFA2CCE2,
-0xFFA4CDE3,
-0xFFA3CDE3,
-0xFFA4CDE3,
-0xFFA3CDE3,
-0xFFA4CDE3,
-0xFFA4CEE4,
-0xFFA5CEE4,
-0xFFA4CEE4,
-0xFFA6CFE5,
-0xFFA5CFE5,
-0xFFA6CFE5,
-0xFFA6D1E4,
-0xFFA7D0E6,
-0xFFA6D1E4,
-0xFFA7D0E6,
-0xFFA7D0E4,
-0xFFA8D1E7,
-0xFFA8D1E5,
-0xFFA8D1E7,
-0xFFA8D1E5,
-0xFFAAD0E7,
-0xFFA8D1E5,
-0xFFAAD0E7,
-0xFFA8D1E5,
-0xFFAAD0E7,
-0xFFA8D1E5,
-0xFFA7D2E5,
-0xFFA7D1E7,
-0xFFA5D2E9,
-0xFFA7D1E7,
-0xFFA8D1E3,
-0xFFABD2E3,
-0xFFADD0E3,
-0xFFACD0E6,
-0xFFA9D1EB,
-0xFFA6D2ED,
-0xFFA6D2EB,
-0xFFA6D3E8,
-0xFFA8D3E4,
-0xFFABD2E3,
-0xFFADD0E6,
-0xFFADD0E6,
-0xFFA7CBE1,
-0xFFA7D2E5,
-0xFFA1D0E4,
-0xFFA8D8EC,
-0xFFA8D7E7,
-0xFFA4CEDC,
-0xFFB3D1DC,
-0xFFD5ECF4,
-0xFF96A8AC,
-0xFFADBDBD,
-0xFFB2C6C4,
-0xFFBED2D0,
-0xFFBFD5D2,
-0xFFAABEBC,
-0xFF849493,
-0xFFBBCBCB,
-0xFFD7EBEA,
-0xFFC7DBDA,
-0xFF3C504F,
-0xFF5A6E6F,
-0xFF94A7AB,
-0xFF12252B,
-0xFF6D8087,
-0xFF75868E,
-0xFF1D2E35,
-0xFFBDCCCF,
-0xFF94A6A6,
-0xFF91A4A2,
-0xFFC9DDDE,
-0xFFB7CBD2,
-0xFF5C6F7D,
-0xFF183346,
-0xFFB6DCF1,
-0xFFA2CFE6,
-0xFFA3D0E7,
-0xFFA5D2E9,
-0xFFA5CFE5,
-0xFFA5CFE5,
-0xFFA1CAE0,
-0xFFA6CFE5,
-0xFFA5CEE4,
-0xFFA5CEE4,
-0xFFA5CEE4,
-0xFFA4CEE4,
-0xFFA4CEE6,
-0xFFA4CEE6,
-0xFFA4CEE6,
-0xFFA4CEE6,
-0xFFA5CDE6,
-0xFFA5CEE4,
-0xFFA7CCE6,
-0xFFA5CEE4,
-0xFFA7CCE6,
-0xFFA5CEE4,
-0xFFA7CDE4,
-0xFFA5CEE4,
-0xFFA7CDE4,
-0xFFA6CFE5,
-0xFFA8CEE5,
-0xFFA6CFE3,
-0xFFA7CDE4,
-0xFFA5CEE2,
-0xFFA7CDE4,
-0xFFA6CFE3,
-0xFFA7CDE4,
-0xFFA5CEE2,
-0xFFA7CDE4,
-0xFFA5CEE2,
-0xFFA7CDE4,
-0xFFA5CEE2,
-0xFFA7CDE4,
-0xFFA4CDE1,
-0xFFA7CDE4,
-0xFFA5CEE2,
-0xFFA7CDE4,
-0xFFA7CDE2,
-0xFFA7CDE4,
-0xFFA6CCE1,
-0xFFA7CBE3,
-0xFFA6CCE3,
-0xFFA6CCE3,
-0xFFA4CDE3,
-0xFFA6CCE3,
-0xFFA4CDE3,
-0xFFA6CCE3,
-0xFFA4CDE3,
-0xFFA6CBE5,
-0xFFA4CCE5,
-0xFFA5CAE4,
-0xFFA3CBE4,
-0xFFA5CAE4,
-0xFFA3CBE4,
-0xFFA5CAE4,
-0xFFA3CBE4,
-0xFFA5CAE5,
-0xFFA3CBE5,
-0xFFA3CBE5,
-0xFFA3CBE5,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA2CAE3,
-0xFFA3CBE4,
-0xFFA3CCE2,
-0xFFA5CBE2,
-0xFFA7C9E2,
-0xFFA7C9E4,
-0xFFA6C9E9,
-0xFFA3CAE9,
-0xFFA1CBE3,
-0xFFA4CEE4,
-0xFFA3CCE0,
-0xFFA7C8D9,
-0xFFE0F2FF,
-0xFFCCDEEC,
-0xFFABC7DC,
-0xFFACC9DB,
-0xFFD5E4EB,
-0xFFEFF9FB,
-0xFFE7F1FA,
-0xFF9FB2C0,
-0xFFA8C9DC,
-0xFFA9CFE6,
-0xFFA0C5E2,
-0xFFA8CCEC,
-0xFFA3C8E3,
-0xFFAECCE4,
-0xFFBACBDF,
-0xFF808696,
-0xFF3C373E,
-0xFFD1D4DD,
-0xFFB3CEE1,
-0xFFA0C8E1,
-0xFFA3CBE4,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA1C9E2,
-0xFFA1C9E2,
-0xFFA3C8E3,
-0xFFA3C8E3,
-0xFFA3C8E3,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA1C9E2,
-0xFFA1C9E2,
-0xFFA1C9E2,
-0xFFA1C9E2,
-0xFFA3C9E0,
-0xFFA3C9E0,
-0xFFA4C8E0,
-0xFFA6C8E1,
-0xFFA6C8E1,
-0xFFA9C9E2,
-0xFFA9C9E0,
-0xFFA6C9DF,
-0xFFA5C7E0,
-0xFFA4C8E0,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA2CAE3,
-0xFFA1C9E2,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA1C9E2,
-0xFFA2CAE3,
-0xFFA4C9E3,
-0xFFA1C9E2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE2,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9CCAE2,
-0xFF9CCAE2,
-0xFF9BC9E1,
-0xFF9BC9E1,
-0xFF9AC8E0,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF99C7E1,
-0xFF98C6E0,
-0xFF98C6E0,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF97C5DF,
-0xFF96C3E0,
-0xFF96C3E0,
-0xFF95C4E0,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF94C3E1,
-0xFF93C2E0,
-0xFF93C2E0,
-0xFF91C2E0,
-0xFF90C1DF,
-0xFF90C1DF,
-0xFF8FC0DE,
-0xFF8FC0DE,
-0xFF8FC0DE,
-0xFFA9C5DD,
-0xFFA7C5DD,
-0xFFAAC6DC,
-0xFFA9C8DD,
-0xFFABC7DD,
-0xFFAAC6DC,
-0xFFA9C5DB,
-0xFFAAC6DC,
-0xFFACC8DE,
-0xFFACC8DD,
-0xFFACC8DD,
-0xFFACC8DD,
-0xFFADC9DE,
-0xFFADC9DE,
-0xFFADC9DE,
-0xFFAAC9DD,
-0xFFABCEE2,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFABCEE2,
-0xFFABCEE2,
-0xFFADCDE2,
-0xFFADCDE2,
-0xFFADCDE2,
-0xFFADCDE2,
-0xFFADCDE2,
-0xFFADCDE2,
-0xFFABCEE2,
-0xFFAACEE4,
-0xFFA9CFE4,
-0xFFA9CFE6,
-0xFFA9CFE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFA9CFE4,
-0xFFABCFE5,
-0xFFAAD0E5,
-0xFFAAD0E5,
-0xFFAAD0E5,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFABD1E4,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFABD1E6,
-0xFFABD1E4,
-0xFFACD0E6,
-0xFFACD1E4,
-0xFFACD0E6,
-0xFFABD1E6,
-0xFFACD0E6,
-0xFFABD1E6,
-0xFFABD1E6,
-0xFFABD1E6,
-0xFFABD1E4,
-0xFFA9D2E6,
-0xFFAAD3E9,
-0xFFAAD3E7,
-0xFFACD3E4,
-0xFFADD2E2,
-0xFFAED1E4,
-0xFFAED1E5,
-0xFFACD1EB,
-0xFFA9D3EC,
-0xFFAAD4EC,
-0xFFAAD5E8,
-0xFFABD5E5,
-0xFFADD4E5,
-0xFFAFD2E6,
-0xFFAFD2E8,
-0xFFAFD5E8,
-0xFFABD6E7,
-0xFFAAD9ED,
-0xFFA3D3E7,
-0xFFA9D8E8,
-0xFFADD7E5,
-0xFFB5D3DE,
-0xFFBCD3DB,
-0xFFADBFC3,
-0xFFCBDDDF,
-0xFFADC1C0,
-0xFFB5C9C8,
-0xFFB0C6C4,
-0xFFC0D4D3,
-0xFFCADADA,
-0xFFA4B4B4,
-0xFF6E8281,
-0xFF859B99,
-0xFF4A5E5F,
-0xFF90A4A5,
-0xFF516468,
-0xFF14272B,
-0xFFC7D8DF,
-0xFF37484F,
-0xFF5E6D72,
-0xFFECFBFE,
-0xFF6E817F,
-0xFF445755,
-0xFF768888,
-0xFF738589,
-0xFFB2C5CC,
-0xFF324957,
-0xFF68899C,
-0xFFBFE5FA,
-0xFFA8D1E7,
-0xFFA5CEE4,
-0xFFA7D0E6,
-0xFFA9D2E6,
-0xFFA6CFE5,
-0xFFA7D0E4,
-0xFFA7D0E6,
-0xFFA7D0E4,
-0xFFA7D0E6,
-0xFFA7D0E6,
-0xFFA7D0E6,
-0xFFA7CFE8,
-0xFFA7CFE8,
-0xFFA7D0E6,
-0xFFAAD0E7,
-0xFFAAD0E5,
-0xFFABCFE5,
-0xFFAAD0E5,
-0xFFAACEE4,
-0xFFA9CFE4,
-0xFFAACEE4,
-0xFFA9CFE4,
-0xFFAACEE4,
-0xFFAAD0E5,
-0xFFABCFE5,
-0xFFAAD0E3,
-0xFFAACEE4,
-0xFFA9CFE2,
-0xFFAACEE4,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFA9CFE4,
-0xFFA9CFE2,
-0xFFA9CFE4,
-0xFFAACFE2,
-0xFFAACEE4,
-0xFFAACFE2,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFA9CDE3,
-0xFFA8CEE3,
-0xFFA8CEE5,
-0xFFA8CEE3,
-0xFFA8CEE5,
-0xFFA8CEE5,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA8CCE6,
-0xFFA7CDE4,
-0xFFA8CCE6,
-0xFFA6CBE5,
-0xFFA7CBE5,
-0xFFA6CBE5,
-0xFFA6CBE5,
-0xFFA4CCE5,
-0xFFA4CDE3,
-0xFFA4CDE3,
-0xFFA4CDE3,
-0xFFA4CDE3,
-0xFFA4CCE5,
-0xFFA4CDE3,
-0xFFA4CCE5,
-0xFFA4CDE3,
-0xFFA4CCE5,
-0xFFA4CDE3,
-0xFFA6CCE3,
-0xFFA4CDE3,
-0xFFA6CCE3,
-0xFFA6CBE5,
-0xFFA6CBE5,
-0xFFA4CCE5,
-0xFFA4CDE3,
-0xFFA7CDE4,
-0xFFABCBE4,
-0xFFACCAE6,
-0xFFA8C9E8,
-0xFFA6CBE8,
-0xFFA3CDE6,
-0xFFA6D0E6,
-0xFFA3CCE0,
-0xFFA9CADB,
-0xFFE0F3FF,
-0xFFC8DBEA,
-0xFFADC9DE,
-0xFFADC8D9,
-0xFFDBE8F0,
-0xFFE8EFF5,
-0xFFE4EEF7,
-0xFFA2B4C2,
-0xFFB0CDDF,
-0xFFA9CDE5,
-0xFFA9CCEA,
-0xFFA8CBEB,
-0xFFA8CBE7,
-0xFFA7C9E2,
-0xFFB1CDE5,
-0xFFCAD7EA,
-0xFF4B4048,
-0xFF91878F,
-0xFFBBCEDF,
-0xFFA9CBE4,
-0xFFA5CAE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA5CAE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA5C8E4,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA2CAE3,
-0xFFA4CAE1,
-0xFFA2CBE1,
-0xFFA3C9E0,
-0xFFA4CAE1,
-0xFFA4CAE1,
-0xFFA5C9E1,
-0xFFA5C9E1,
-0xFFA6C8E1,
-0xFFA8C8E1,
-0xFFA9C9E2,
-0xFFA9C9E2,
-0xFFA8C8DF,
-0xFFA7C7E0,
-0xFFA6C8E1,
-0xFFA6CAE2,
-0xFFA6CAE2,
-0xFFA5CAE4,
-0xFFA4C9E3,
-0xFFA3C8E2,
-0xFFA3C8E2,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA4C9E3,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CBE4,
-0xFFA3CCE2,
-0xFFA3CCE2,
-0xFFA3CCE2,
-0xFFA3CBE4,
-0xFFA2CAE3,
-0xFFA1C9E2,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA1C9E3,
-0xFFA1C9E3,
-0xFFA0CAE3,
-0xFFA0CAE3,
-0xFF9ECBE2,
-0xFF9ECAE3,
-0xFF9ECAE3,
-0xFF9DC9E2,
-0xFF9DC9E2,
-0xFF9DC9E4,
-0xFF9DC9E4,
-0xFF9CC8E3,
-0xFF9CC8E3,
-0xFF9CC8E3,
-0xFF9BC7E2,
-0xFF9BC7E2,
-0xFF9AC6E1,
-0xFF9AC6E1,
-0xFF9AC6E1,
-0xFF9AC6E1,
-0xFF98C6E0,
-0xFF98C5E2,
-0xFF97C5DF,
-0xFF97C4E1,
-0xFF97C4E1,
-0xFF97C4E1,
-0xFF97C4E1,
-0xFF97C4E1,
-0xFF97C4E1,
-0xFF95C4E2,
-0xFF94C3DF,
-0xFF94C3E1,
-0xFF91C2E0,
-0xFF91C2E0,
-0xFF90C1DF,
-0xFFB0C6DB,
-0xFFAEC7DB,
-0xFFB2C8DD,
-0xFFB1CADE,
-0xFFB2C9DB,
-0xFFB0C7D9,
-0xFFB0C7D9,
-0xFFB2C9DB,
-0xFFB6CDDF,
-0xFFB5CCDE,
-0xFFB5CCDE,
-0xFFB4CBDB,
-0xFFB4CBDB,
-0xFFB5CCDC,
-0xFFB6CDDD,
-0xFFB6CDDD,
-0xFFB4CEDF,
-0xFFB4CEDF,
-0xFFB5CFE0,
-0xFFB6CFE3,
-0xFFACC5D9,
-0xFFB2CBDF,
-0xFFB6CFE3,
-0xFFB7D1E2,
-0xFFB7D1E2,
-0xFFB9D0E2,
-0xFFB7CEE0,
-0xFFB8CFE1,
-0xFFBBD2E4,
-0xFFBAD1E3,
-0xFFB9CFE4,
-0xFFB7D0E4,
-0xFFB4CFE2,
-0xFFB5D2E4,
-0xFFB5D1E6,
-0xFFB6D3E5,
-0xFFB6D3E5,
-0xFFB6D3E5,
-0xFFB3D2E4,
-0xFFB1D0E2,
-0xFFB3D2E4,
-0xFFB3D2E4,
-0xFFB3D2E4,
-0xFFB1D2E3,
-0xFFB2D1E3,
-0xFFB0D1E2,
-0xFFB0D1E2,
-0xFFB1D2E3,
-0xFFB2D3E6,
-0xFFB2D3E6,
-0xFFB2D3E6,
-0xFFB1D2E5,
-0xFFB1D2E5,
-0xFFB1D2E5,
-0xFFAED1E5,
-0xFFAED1E4,
-0xFFAFD2E6,
-0xFFAFD2E5,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFAED3E6,
-0xFFAED3E6,
-0xFFAFD2E5,
-0xFFAFD2E5,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFB0D3E6,
-0xFFB0D3E6,
-0xFFB0D3E6,
-0xFFB0D3E7,
-0xFFAED2E8,
-0xFFAED4E9,
-0xFFAFD5EA,
-0xFFAED4E7,
-0xFFAED4E7,
-0xFFAFD4E7,
-0xFFAFD3E9,
-0xFFB0D5E8,
-0xFFB0D5E7,
-0xFFAED5E6,
-0xFFADD6E8,
-0xFFADD6E8,
-0xFFAFD5E8,
-0xFFB1D5E5,
-0xFFB9D5E3,
-0xFFC7DDE8,
-0xFFDAEBF2,
-0xFFE0F0F0,
-0xFFD8E6E6,
-0xFFDDECE9,
-0xFFC4D4D3,
-0xFF9FAFAE,
-0xFF9BADAD,
-0xFFB2C4C4,
-0xFFC2D6D5,
-0xFF6B7F7D,
-0xFF475B5A,
-0xFF7F9392,
-0xFF243837,
-0xFF687C7B,
-0xFF9EB2B1,
-0xFF172B2A,
-0xFFC7D9D9,
-0xFFE2F4F4,
-0xFF394949,
-0xFFDBEBEB,
-0xFF7A8A8A,
-0xFF101F22,
-0xFF38454D,
-0xFF6B7C86,
-0xFF2F4958,
-0xFF4E6B7D,
-0xFFBCDBEF,
-0xFFAED1E5,
-0xFFAED1E5,
-0xFFB0D5E8,
-0xFFACD2E7,
-0xFFADD3E6,
-0xFFACD2E7,
-0xFFACD2E5,
-0xFFACD2E7,
-0xFFACD2E7,
-0xFFACD2E7,
-0xFFACD2E9,
-0xFFACD2E9,
-0xFFACD2E9,
-0xFFADD2E5,
-0xFFADD2E5,
-0xFFAED1E5,
-0xFFAED3E6,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFAFD2E6,
-0xFFAED3E5,
-0xFFB0D3E7,
-0xFFAFD4E6,
-0xFFB0D3E7,
-0xFFAFD4E6,
-0xFFAFD4E6,
-0xFFAFD4E6,
-0xFFAFD4E6,
-0xFFAED3E5,
-0xFFAED3E5,
-0xFFAED3E5,
-0xFFAED3E5,
-0xFFAED3E5,
-0xFFAED3E6,
-0xFFAED3E5,
-0xFFADD2E5,
-0xFFAED1E4,
-0xFFAED1E5,
-0xFFAED1E4,
-0xFFADD0E4,
-0xFFACD1E4,
-0xFFABD0E3,
-0xFFABD0E3,
-0xFFABCFE5,
-0xFFABD0E3,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFABCDE6,
-0xFFAACEE4,
-0xFFABCDE6,
-0xFFAACEE6,
-0xFFABCDE6,
-0xFFAACEE6,
-0xFFA9CFE4,
-0xFFA8CEE3,
-0xFFA8CEE3,
-0xFFA8CEE3,
-0xFFA8CEE3,
-0xFFA8CEE3,
-0xFFA7CDE4,
-0xFFA7CDE2,
-0xFFA9CFE6,
-0xFFA9CFE4,
-0xFFA9CFE6,
-0xFFA9CFE4,
-0xFFA9CDE3,
-0xFFA8CEE3,
-0xFFA9CDE3,
-0xFFA9CDE3,
-0xFFA8CCE4,
-0xFFA8CEE5,
-0xFFA6D0E6,
-0xFFA6D0E6,
-0xFFA8CEE5,
-0xFFAACCE5,
-0xFFADCBE7,
-0xFFADCCE8,
-0xFFA9CFE6,
-0xFFA6CFE3,
-0xFFA8CEE1,
-0xFFADCCE0,
-0xFFE1F6FF,
-0xFFC6D8EE,
-0xFFAFCCDE,
-0xFFB2CFDD,
-0xFFD5E6ED,
-0xFFE9F4F8,
-0xFFE5F2FB,
-0xFF9EB0BE,
-0xFFB3D0E2,
-0xFFABCEE4,
-0xFFABCDE6,
-0xFFABCDE8,
-0xFFABCDE6,
-0xFFA8CAE3,
-0xFFAED2EA,
-0xFFB5CCDE,
-0xFFA9A3AD,
-0xFF2B212A,
-0xFFB5BDD0,
-0xFFB4CCE4,
-0xFFAACCE5,
-0xFFA5CDE6,
-0xFFA8CDE7,
-0xFFA7CCE6,
-0xFFA6CBE5,
-0xFFA8CDE7,
-0xFFAACEE8,
-0xFFA6CBE5,
-0xFFA6CBE5,
-0xFFA6CBE5,
-0xFFA4CDE3,
-0xFFA4CDE3,
-0xFFA3CCE2,
-0xFFA3CCE2,
-0xFFA5CBE2,
-0xFFA5CBE2,
-0xFFA6CAE2,
-0xFFA6CAE2,
-0xFFA7C9E4,
-0xFFA6CAE2,
-0xFFA6CAE0,
-0xFFA5CBE0,
-0xFFA6CAE0,
-0xFFA5CBE0,
-0xFFA6CAE0,
-0xFFA6CAE0,
-0xFFA6CAE0,
-0xFFA7CBE3,
-0xFFA6CAE2,
-0xFFA6CAE4,
-0xFFA8CAE5,
-0xFFACCBE7,
-0xFFA8C8E1,
-0xFFABC9E3,
-0xFFABC9E3,
-0xFFA9C9E2,
-0xFFA9C9E2,
-0xFFAACAE1,
-0xFFABCBE4,
-0xFFABCBE4,
-0xFFA8CAE3,
-0xFFA8CAE3,
-0xFFA6CAE2,
-0xFFA6CAE2,
-0xFFA7CBE3,
-0xFFA7CBE3,
-0xFFA7CBE3,
-0xFFA7CBE3,
-0xFFA6CAE2,
-0xFFA7CBE3,
-0xFFA8CCE4,
-0xFFA8CCE2,
-0xFFA7CBE1,
-0xFFA7CBE1,
-0xFFA8CBE1,
-0xFFA8CBE1,
-0xFFA7CBE1,
-0xFFA9CDE3,
-0xFFA8CCE4,
-0xFFA7CBE3,
-0xFFA5CBE2,
-0xFFA6CBE5,
-0xFFA6CBE5,
-0xFFA5CAE4,
-0xFFA3C8E2,
-0xFFA7CDE4,
-0xFFA4CCE5,
-0xFFA3CBE4,
-0xFFA2CAE3,
-0xFFA2CAE3,
-0xFFA3CDE6,
-0xFFA1CBE4,
-0xFFA1CAE6,
-0xFF9FC8E4,
-0xFF9DC6E2,
-0xFF9DC6E2,
-0xFF9EC8E1,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9FC9E2,
-0xFF9EC8E1,
-0xFF9FC9E2,
-0xFF9EC7E3,
-0xFFA0CCE5,
-0xFF9AC6E1,
-0xFF99C5E0,
-0xFF9BC7E2,
-0xFF9CC8E3,
-0xFF9DC9E4,
-0xFF98C4DF,
-0xFF9BC7E4,
-0xFF9CC8E3,
-0xFF99C6E3,
-0xFF99C8E4,
-0xFF95C7E2,
-0xFF94C6E1,
-0xFFB8CBDC,
-0xFFB8CBDC,
-0xFFB9CCDD,
-0xFFBBCEDF,
-0xFFBACDDE,
-0xFFB8CBDA,
-0xFFB9CCDD,
-0xFFBACDDC,
-0xFFBDCEE0,
-0xFFBCCFDE,
-0xFFBDCEDE,
-0xFFBDD0DE,
-0xFFBECFDF,
-0xFFBED1DF,
-0xFFC0D1E1,
-0xFFC0D3E2,
-0xFFC0D3E2,
-0xFFBDD3E1,
-0xFFBACDDE,
-0xFFB8CBDC,
-0xFFB4C6DA,
-0xFFBBCEDF,
-0xFFBED1E2,
-0xFFC2D5E4,
-0xFFC1D4E3,
-0xFFC3D4E4,
-0xFFC2D3E3,
-0xFFC2D3E3,
-0xFFC5D6E6,
-0xFFC4D5E7,
-0xFFC1D2E4,
-0xFFC1D2E4,
-0xFFBED3E4,
-0xFFBED5E5,
-0xFFBFD4E5,
-0xFFBED5E5,
-0xFFC0D5E6,
-0xFFBFD6E6,
-0xFFBED5E5,
-0xFFBAD4E3,
-0xFFBDD4E4,
-0xFFBBD5E4,
-0xFFBCD6E5,
-0xFFBCD6E5,
-0xFFBCD6E7,
-0xFFBBD7E5,
-0xFFBBD6E7,
-0xFFBCD7E8,
-0xFFBBD6E7,
-0xFFBBD6E7,
-0xFFBBD6E7,
-0xFFBAD5E6,
-0xFFBAD5E8,
-0xFFBAD5E8,
-0xFFB8D5E7,
-0xFFB8D5E7,
-0xFFB8D5E7,
-0xFFB8D5E7,
-0xFFB7D6E8,
-0xFFB8D7E9,
-0xFFB7D6EA,
-0xFFB7D6EA,
-0xFFB5D6E9,
-0xFFB4D5E8,
-0xFFB6D5E7,
-0xFFB6D6E5,
-0xFFB6D5E7,
-0xFFB6D5E7,
-0xFFB5D4E6,
-0xFFB4D5E6,
-0xFFB4D5E6,
-0xFFB4D5E6,
-0xFFB3D4E7,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB3D6E9,
-0xFFB3D6E9,
-0xFFB3D6E9,
-0xFFB4D7EB,
-0xFFB4D7EA,
-0xFFB4D8E8,
-0xFFB3D7E7,
-0xFFB5D8EB,
-0xFFB4D7EA,
-0xFFB6D7EA,
-0xFFB6D6E5,
-0xFFB9D5E3,
-0xFFC5DBE6,
-0xFFC0D1D8,
-0xFFD2E0E1,
-0xFFD2DEDC,
-0xFFBCC8C4,
-0xFFA9B8B5,
-0xFFBFCFCC,
-0xFFBACECD,
-0xFFB8CCCB,
-0xFF6E817F,
-0xFF293C3A,
-0xFF697C7A,
-0xFF405351,
-0xFF435654,
-0xFFE6FAF8,
-0xFF374B49,
-0xFF586C6A,
-0xFFF0FFFF,
-0xFFC4D6D6,
-0xFF778989,
-0xFFD8EAEC,
-0xFFBDCCCF,
-0xFF9AA9AE,
-0xFF09161C,
-0xFF374850,
-0xFF485B69,
-0xFFB0CAD9,
-0xFFBCD7E8,
-0xFFB9D6E8,
-0xFFB2D3E6,
-0xFFB4D7EB,
-0xFFABD0E3,
-0xFFB2D7EA,
-0xFFB0D5E8,
-0xFFB0D5E8,
-0xFFB0D5E8,
-0xFFB0D5E8,
-0xFFB1D4E8,
-0xFFB0D4EA,
-0xFFB0D4EA,
-0xFFB0D4EA,
-0xFFB1D4E8,
-0xFFB1D4E7,
-0xFFB1D4E7,
-0xFFB1D4E7,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB1D4E7,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D6E6,
-0xFFB1D6E6,
-0xFFB2D6E6,
-0xFFB1D6E6,
-0xFFB2D6E6,
-0xFFB1D6E6,
-0xFFB2D5E8,
-0xFFB1D6E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB1D4E7,
-0xFFB1D4E7,
-0xFFB1D4E7,
-0xFFB1D4E7,
-0xFFB1D4E7,
-0xFFB0D3E6,
-0xFFB1D4E8,
-0xFFB0D5E8,
-0xFFAFD4E7,
-0xFFAFD4E7,
-0xFFAFD4E7,
-0xFFAFD4E7,
-0xFFAED3E6,
-0xFFAED3E6,
-0xFFAFD2E8,
-0xFFAFD2E8,
-0xFFAED1E7,
-0xFFAED1E7,
-0xFFAED1E7,
-0xFFAED1E7,
-0xFFAED1E7,
-0xFFAED1E7,
-0xFFACD1E4,
-0xFFABD1E4,
-0xFFACD1E4,
-0xFFAAD0E3,
-0xFFABCFE5,
-0xFFAAD0E5,
-0xFFABCFE5,
-0xFFAAD0E5,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFABD0E3,
-0xFFABD0E3,
-0xFFABD0E3,
-0xFFACCFE3,
-0xFFADCDE4,
-0xFFACCFE5,
-0xFFA8D1E5,
-0xFFA9D2E6,
-0xFFAAD0E5,
-0xFFACCFE5,
-0xFFB1CDE5,
-0xFFB2CEE6,
-0xFFADD0E6,
-0xFFAAD0E3,
-0xFFACD1E4,
-0xFFAECDE1,
-0xFFE2F4FF,
-0xFFC3D5EB,
-0xFFB0CDDF,
-0xFFB5D1DD,
-0xFFD4E7ED,
-0xFFE7F5F8,
-0xFFE5F2FB,
-0xFF9FB1BF,
-0xFFB5D2E4,
-0xFFADD0E4,
-0xFFAED1E7,
-0xFFADD0E6,
-0xFFB1D3EC,
-0xFFACD0E8,
-0xFFA5CEE2,
-0xFFBAD5E6,
-0xFFD9D9E3,
-0xFF160C15,
-0xFF524F60,
-0xFFCAD5E9,
-0xFFAFCEE3,
-0xFFA8CEE5,
-0xFFA8CEE5,
-0xFFA9CDE5,
-0xFFA9CBE4,
-0xFFA9CBE4,
-0xFFAACCE5,
-0xFFA8CCE4,
-0xFFA9CDE5,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA5CEE4,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA8CCE4,
-0xFFA8CCE4,
-0xFFA8CCE4,
-0xFFA9CBE4,
-0xFFA8CCE4,
-0xFFA8CCE2,
-0xFFA8CDE0,
-0xFFA8CDE0,
-0xFFA8CDE0,
-0xFFA9CEE1,
-0xFFA8CDE0,
-0xFFA8CCE2,
-0xFFA8CCE4,
-0xFFA8CCE4,
-0xFFA6CAE4,
-0xFFA6C8E3,
-0xFFA6C8E3,
-0xFFABCBE4,
-0xFFABCBE4,
-0xFFACCCE5,
-0xFFADCDE6,
-0xFFADCDE4,
-0xFFABCBE2,
-0xFFAACAE1,
-0xFFABCBE2,
-0xFFADCDE4,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFAACEE4,
-0xFFA9CDE5,
-0xFFA7CDE4,
-0xFFA8CCE4,
-0xFFA8CCE4,
-0xFFA8CCE4,
-0xFFAACCE5,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFABCEE2,
-0xFFABCEE2,
-0xFFABCEE2,
-0xFFABCEE2,
-0xFFAACDE1,
-0xFFABCEE2,
-0xFFAACDE3,
-0xFFAACDE3,
-0xFFAACEE6,
-0xFFAACEE6,
-0xFFA9CEE8,
-0xFFA8CEE5,
-0xFFA9CFE6,
-0xFFA9CFE6,
-0xFFA7CDE4,
-0xFFA7CDE4,
-0xFFA8CEE5,
-0xFFA9CEE8,
-0xFFA6CEE7,
-0xFFA3CBE4,
-0xFFA5CDE7,
-0xFFA7CFE9,
-0xFFAACFEA,
-0xFFA9CEE8,
-0xFFA7CCE6,
-0xFFA4CAE1,
-0xFFA3C8E2,
-0xFFA3C9E0,
-0xFFA6CAE2,
-0xFFA5C9E1,
-0xFFA0C6DD,
-0xFFA3C9E0,
-0xFFA2C8DF,
-0xFFA4CCE5,
-0xFFA4CCE5,
-0xFFA1C9E2,
-0xFFA2CAE4,
-0xFFA4CCE6,
-0xFFA2CAE4,
-0xFFA0C8E2,
-0xFFA2CCE5,
-0xFF9CC8E1,
-0xFF92C0DA,
-0xFF95C4DE,
-0xFFBECFDF,
-0xFFBECFDF,
-0xFFC0D1E1,
-0xFFC1D2E2,
-0xFFC0D1E1,
-0xFFBFD1DF,
-0xFFC0D1E1,
-0xFFC1D3E1,
-0xFFC1D1E1,
-0xFFC1D3E1,
-0xFFC2D2E1,
-0xFFC2D4E0,
-0xFFC4D4E3,
-0xFFC4D6E2,
-0xFFC6D6E5,
-0xFFC5D7E5,
-0xFFC4D7E5,
-0xFFC6D9E7,
-0xFFBACBDB,
-0xFFB0C1D1,
-0xFFB3C4D6,
-0xFFBFD0E2,
-0xFFC3D4E6,
-0xFFC8D9E9,
-0xFFC4D5E5,
-0xFFC7D7E6,
-0xFFC6D6E5,
-0xFFC6D6E5,
-0xFFC8D8E7,
-0xFFC8D8E8,
-0xFFC6D6E6,
-0xFFC7D7E7,
-0xFFC7D7E7,
-0xFFC6D7E7,
-0xFFC7D7E7,
-0xFFC6D7E7,
-0xFFC7D7E7,
-0xFFC7D8E8,
-0xFFC7D8E8,
-0xFFC4D7E6,
-0xFFC7D8E8,
-0xFFC6D9E8,
-0xFFC6D9E8,
-0xFFC6D9E8,
-0xFFC5D8E9,
-0xFFC3D9E7,
-0xFFC3D8E9,
-0xFFC4D9EA,
-0xFFC5D8E9,
-0xFFC5D8E9,
-0xFFC3D8E9,
-0xFFC3D8E9,
-0xFFC3D8E9,
-0xFFC2D7E8,
-0xFFC2D7E8,
-0xFFC2D7E8,
-0xFFC1D8EA,
-0xFFC1D8EA,
-0xFFC2D9EB,
-0xFFC2D9EB,
-0xFFC2D9EB,
-0xFFC1D8EA,
-0xFFC0D7E9,
-0xFFBDD7E8,
-0xFFBDD7E6,
-0xFFBDD7E6,
-0xFFBCD6E5,
-0xFFBCD6E5,
-0xFFBCD6E7,
-0xFFBAD5E6,
-0xFFBAD5E6,
-0xFFBAD5E6,
-0xFFBAD5E6,
-0xFFB8D5E5,
-0xFFB8D5E7,
-0xFFB9D6E8,
-0xFFB9D6E8,
-0xFFB8D5E7,
-0xFFB7D4E6,
-0xFFB6D3E5,
-0xFFB8D5E5,
-0xFFB7D4E4,
-0xFFB7D6E8,
-0xFFB6D5E7,
-0xFFB9D6E8,
-0xFFB9D5E3,
-0xFFBCD3E1,
-0xFFC7DBE4,
-0xFFCDDFE3,
-0xFFC7D5D6,
-0xFFC0CCCA,
-0xFFB7C3BF,
-0xFFC0D0CD,
-0xFFCBDEDA,
-0xFFC4DAD8,
-0xFF869A99,
-0xFF2C3C3B,
-0xFF738181,
-0xFFC6D6D5,
-0xFFAFBFBE,
-0xFFF1FFFF,
-0xFF617472,
-0xFF172929,
-0xFFCDDFDF,
-0xFFBFD3D2,
-0xFF8A9E9D,
-0xFF9DB1B2,
-0xFF8A9DA1,
-0xFF889B9F,
-0xFFADC0C6,
-0xFFC1D4DA,
-0xFF1A2C36,
-0xFF122835,
-0xFF2B4252,
-0xFFC8E2F3,
-0xFFBBD8EA,
-0xFFB7D6EA,
-0xFFB5D6E9,
-0xFFB6D9EC,
-0xFFB2D5E8,
-0xFFB3D6E9,
-0xFFB3D6E9,
-0xFFB3D6E9,
-0xFFB3D6E9,
-0xFFB6D7EA,
-0xFFB4D7EB,
-0xFFB4D7EB,
-0xFFB4D7EB,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB6D7EA,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB5D8EB,
-0xFFB7D8EB,
-0xFFB5D8EB,
-0xFFB7D8EB,
-0xFFB5D8EB,
-0xFFB7D8EB,
-0xFFB5D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB4D7EA,
-0xFFB4D7EA,
-0xFFB4D7EA,
-0xFFB4D7EA,
-0xFFB4D7EA,
-0xFFB3D6EA,
-0xFFB3D6EA,
-0xFFB3D6EA,
-0xFFB3D6EA,
-0xFFB2D5E9,
-0xFFB2D5E9,
-0xFFB1D4E8,
-0xFFB1D4E8,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFAFD4E7,
-0xFFB0D3E7,
-0xFFAFD4E7,
-0xFFB0D3E7,
-0xFFAFD4E7,
-0xFFAFD2E8,
-0xFFAED2E8,
-0xFFAFD2E8,
-0xFFAFD2E8,
-0xFFAFD2E6,
-0xFFAFD2E6,
-0xFFAED1E5,
-0xFFAED1E5,
-0xFFAED1E5,
-0xFFB0D0E5,
-0xFFB1D0E5,
-0xFFB2D1E6,
-0xFFAFD2E6,
-0xFFAED3E6,
-0xFFAFD2E6,
-0xFFB2D1E6,
-0xFFB6CEE6,
-0xFFB7D0E6,
-0xFFB4D3E7,
-0xFFAFD3E3,
-0xFFB3D4E5,
-0xFFB4CFE0,
-0xFFE4F3FF,
-0xFFC2D1E6,
-0xFFB5CFE0,
-0xFFB9D4DF,
-0xFFD6E7EE,
-0xFFE9F4F8,
-0xFFE7F1FA,
-0xFFA0B2BE,
-0xFFB5D5E4,
-0xFFAED5E6,
-0xFFB1D4E8,
-0xFFB0D3E9,
-0xFFADD1E9,
-0xFFAED4E9,
-0xFFAED4E7,
-0xFFB4D0DE,
-0xFFD8DCE5,
-0xFF42373F,
-0xFF14040F,
-0xFFBFBBCA,
-0xFFB9CFE4,
-0xFFABCFE5,
-0xFFACCFE5,
-0xFFADD0E6,
-0xFFAECEE5,
-0xFFACCCE3,
-0xFFADCDE4,
-0xFFABCEE4,
-0xFFABCEE4,
-0xFFAACEE4,
-0xFFAACEE4,
-0xFFA9CFE4,
-0xFFA9CDE3,
-0xFFA9CDE3,
-0xFFA9CDE3,
-0xFFA9CDE3,
-0xFFA9CDE5,
-0xFFA8CEE5,
-0xFFA9CDE5,
-0xFFA8CEE5,
-0xFFA8CEE5,
-0xFFA8CEE3,
-0xFFA8CEE3,
-0xFFA8CEE3,
-0xFFA9CFE4,
-0xFFA8CEE3,
-0xFFA8CEE5,
-0xFFA9CFE6,
-0xFFABCFE7,
-0xFFABCFE7,
-0xFFABCFE7,
-0xFFAACEE6,
-0xFFABCDE6,
-0xFFABCDE6,
-0xFFABCEE4,
-0xFFACCFE5,
-0xFFADD0E6,
-0xFFACCFE5,
-0xFFACCFE5,
-0xFFACCFE5,
-0xFFAACDE3,
-0xFFA9CDE3,
-0xFFAACEE4,
-0xFFABD1E6,
-0xFFABD1E6,
-0xFFA8D1E5,
-0xFFAAD0E7,
-0xFFACD2E9,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFADD1E7,
-0xFFACD0E6,
-0xFFABCFE5,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFACD0E6,
-0xFFABCFE7,
-0xFFAAD0E7,
-0xFFAAD0E7,
-0xFFA8D1E5,
-0xFFA8D1E5,
-0xFFA8D1E5,
-0xFFA7D0E4,
-0xFFA7D0E6,
-0xFFA8CEE5,
-0xFFA8CEE5,
-0xFFA6CCE1,
-0xFFA6CCE1,
-0xFFA7CBE1,
-0xFFA7CCDF,
-0xFFA7CADE,
-0xFFA8CBDE,
-0xFFA9CCE0,
-0xFFACCDE0,
-0xFFA9C8DC,
-0xFFACC8DD,
-0xFFAAC9DD,
-0xFFACCDE0,
-0xFFA9CADD,
-0xFFA8CBDF,
-0xFFA6C9DD,
-0xFFA9CCE0,
-0xFFA8CBE1,
-0xFFA6C9DF,
-0xFFA9CBE4,
-0xFFA5C9E1,
-0xFFA1C5DD,
-0xFFA0C6DD,
-0xFF9FC8DE,
-0xFFA2CCE2,
-0xFFC3D0E0,
-0xFFC2D2DF,
-0xFFC5D3E0,
-0xFFC6D4E1,
-0xFFC6D4E1,
-0xFFC6D4E1,
-0xFFC6D4E1,
-0xFFC7D5E2,
-0xFFC6D4E1,
-0xFFC6D4E1,
-0xFFC7D5E2,
-0xFFC8D6E1,
-0xFFC8D6E3,
-0xFFC8D6E1,
-0xFFC8D6E3,
-0xFFC6D6E3,
-0xFFC5D7E3,
-0xFFC4D6E4,
-0xFFB8C9D9,
-0xFFB5C6D6,
-0xFFBCCDDD,
-0xFFBCCDDD,
-0xFFBCCDDD,
-0xFFCBDBEA,
-0xFFC9D9E8,
-0xFFCADAE7,
-0xFFC9D9E6,
-0xFFC7D7E4,
-0xFFCBD9E6,
-0xFFCCD9E9,
-0xFFCCD9E9,
-0xFFCDDAEA,
-0xFFCDD9E9,
-0xFFCDD9E7,
-0xFFCDD9E7,
-0xFFCCD8E6,
-0xFFCDD9E7,
-0xFFCEDAE8,
-0xFFCDDBE8,
-0xFFCCDAE7,
-0xFFCDDBE8,
-0xFFCDDBE8,
-0xFFCDDAEA,
-0xFFCDDAEA,
-0xFFCADAE9,
-0xFFC9D9E8,
-0xFFCADAE9,
-0xFFCADAE9,
-0xFFCDDAEA,
-0xFFCDDAEA,
-0xFFCDDAEA,
-0xFFCADAE9,
-0xFFCCD9E9,
-0xFFCADAE9,
-0xFFCADAE9,
-0xFFCADAE9,
-0xFFCBDBEB,
-0xFFC9DAEA,
-0xFFCADAEA,
-0xFFC8D9E9,
-0xFFC9D9E9,
-0xFFC8D9E9,
-0xFFC9D9E9,
-0xFFC9DAEA,
-0xFFC9DCEA,
-0xFFC7DDEA,
-0xFFC9DCEA,
-0xFFC6DCE9,
-0xFFC8DBEA,
-0xFFC6DCEA,
-0xFFC5DBE9,
-0xFFC5DBE9,
-0xFFC5DBE9,
-0xFFC4DBE9,
-0xFFC3DAEA,
-0xFFC3DAEA,
-0xFFC3DAEA,
-0xFFC2D9E9,
-0xFFC0D7E7,
-0xFFBFD6E6,
-0xFFBDD4E2,
-0xFFBCD3E3,
-0xFFBCD6E7,
-0xFFBAD4E5,
-0xFFBBD5E4,
-0xFFBDD4E2,
-0xFFBFD5E0,
-0xFFC9DCE3,
-0xFFCEE0E4,
-0xFF9FADAE,
-0xFFBECDCA,
-0xFFD3E2DD,
-0xFFD8E8E5,
-0xFFC5D9D7,
-0xFF415755,
-0xFF4D6361,
-0xFF96A6A5,
-0xFFE2F0F0,
-0xFFDCECEB,
-0xFFE0F0EF,
-0xFF778786,
-0xFF243735,
-0xFF687A7A,
-0xFFDBEDED,
-0xFFA2B6B5,
-0xFF99ADAE,
-0xFF92A5A9,
-0xFF4C5F63,
-0xFFDFF2F8,
-0xFFB7CAD0,
-0xFF465960,
-0xFF3A4E57,
-0xFF1B2E3C,
-0xFF1C3240,
-0xFFB0CAD9,
-0xFFBBD6E7,
-0xFFB6D3E5,
-0xFFBAD9EB,
-0xFFB5D6E9,
-0xFFB8D9EA,
-0xFFB8D7E9,
-0xFFB8D7E9,
-0xFFB8D7E9,
-0xFFB9D8EA,
-0xFFB9D8EA,
-0xFFB9D8EA,
-0xFFB9D8EC,
-0xFFB9D8EC,
-0xFFB9D8EC,
-0xFFB8D9EC,
-0xFFB9D8EC,
-0xFFB8D9EC,
-0xFFB9D8EC,
-0xFFB8D9EC,
-0xFFB9D8EC,
-0xFFB8D9EC,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFBAD9ED,
-0xFFBAD9ED,
-0xFFBAD9ED,
-0xFFBAD9ED,
-0xFFBAD9ED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFBAD9ED,
-0xFFB9DAED,
-0xFFB9DAED,
-0xFFB9DAED,
-0xFFB8D9EC,
-0xFFB8D9EC,
-0xFFB8D9EC,
-0xFFB8D9EC,
-0xFFB7D8EB,
-0xFFB5D8EB,
-0xFFB7D7EC,
-0xFFB5D8EB,
-0xFFB7D7EC,
-0xFFB4D7EA,
-0xFFB6D6EB,
-0xFFB3D6E9,
-0xFFB3D6EA,
-0xFFB3D6E9,
-0xFFB2D5E9,
-0xFFB2D5E8,
-0xFFB3D6EA,
-0xFFB3D6EA,
-0xFFB5D5EA,
-0xFFB3D6EA,
-0xFFB4D4E9,
-0xFFB2D5E9,
-0xFFB4D4E9,
-0xFFB2D5E9,
-0xFFB4D4EB,
-0xFFB2D5E9,
-0xFFB4D4E9,
-0xFFB2D5E9,
-0xFFB4D4E9,
-0xFFB1D4E8,
-0xFFB3D3E8,
-0xFFB3D4E7,
-0xFFB6D2E7,
-0xFFB5D4E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB2D5E8,
-0xFFB5D4E8,
-0xFFBBD1E8,
-0xFFBBD1E6,
-0xFFB7D6E8,
-0xFFB3D4E5,
-0xFFB7D8E7,
-0xFFB7D2E3,
-0xFFE3F4FF,
-0xFFC1D0E3,
-0xFFB8D2E1,
-0xFFBED6E2,
-0xFFD9E8EF,
-0xFFEAF3F8,
-0xFFE9F0F8,
-0xFFA5B3BC,
-0xFFB8D8E5,
-0xFFB1D8E9,
-0xFFB4D7EB,
-0xFFB5D5EA,
-0xFFB3D6EC,
-0xFFB2D6EC,
-0xFFB4D7EA,
-0xFFB7CEDC,
-0xFFDAD9DF,
-0xFF655055,
-0xFF2A070E,
-0xFF957D8A,
-0xFFC5D6E6,
-0xFFB1D4E8,
-0xFFB0D0E5,
-0xFFB2D2E7,
-0xFFB2D1E6,
-0xFFB0CFE4,
-0xFFB0CFE4,
-0xFFB0D0E5,
-0xFFAFCFE4,
-0xFFADD0E4,
-0xFFADD0E6,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFACCFE5,
-0xFFACCFE5,
-0xFFAACEE6,
-0xFFA9CFE6,
-0xFFA9CFE6,
-0xFFA9CFE6,
-0xFFA9CFE6,
-0xFFA9CFE6,
-0xFFA9CFE4,
-0xFFA9CFE4,
-0xFFABD1E6,
-0xFFAAD0E5,
-0xFFA9CFE4,
-0xFFAACEE4,
-0xFFABCFE5,
-0xFFABCFE5,
-0xFFACCFE5,
-0xFFABCFE5,
-0xFFABCEE4,
-0xFFACD0E6,
-0xFFADD0E6,
-0xFFAACDE1,
-0xFFABCEE2,
-0xFFAFD2E6,
-0xFFAFD2E6,
-0xFFADD0E4,
-0xFFB0D3E7,
-0xFFAFD2E6,
-0xFFAFD4E7,
-0xFFB0D5E8,
-0xFFAED4E7,
-0xFFACD2E7,
-0xFFACD2E7,
-0xFFADD3E8,
-0xFFAFD3E9,
-0xFFAFD4E7,
-0xFFAFD3E9,
-0xFFAFD3E9,
-0xFFAED2E8,
-0xFFAED2E8,
-0xFFAED2E8,
-0xFFAED2E8,
-0xFFB0D4EA,
-0xFFAED2E8,
-0xFFAED2E8,
-0xFFAFD3E9,
-0xFFAFD3E9,
-0xFFAED1E7,
-0xFFAED1E7,
-0xFFAED2E8,
-0xFFACD2E7,
-0xFFAAD0E3,
-0xFFABD1E4,
-0xFFAAD0E3,
-0xFFAAD0E3,
-0xFFABD0E3,
-0xFFA9CEE1,
-0xFFACCFE2,
-0xFFADD0E3,
-0xFFABCFDF,
-0xFFACCBDD,
-0xFFACCCDB,
-0xFFB1CEDE,
-0xFFB4D1DF,
-0xFFB5D2E0,
-0xFFB6D2E0,
-0xFFC6DDEB,
-0xFFC8DEEC,
-0xFFC9E0EE,
-0xFFC9E3F2,
-0xFFBEDAE8,
-0xFFB4CFE0,
-0xFFAAC7D7,
-0xFFAFCCDE,
-0xFFAEC9DE,
-0xFFAFCADF,
-0xFFB9D5EA,
-0xFFB7D3E8,
-0xFFA9C8DD,
-0xFFA5C4D8,
-0xFFA5C5DA,
-0xFFA4C7DA,
-0xFFC5D1DF,
-0xFFC5D3DE,
-0xFFC7D3DF,
-0xFFC8D4E0,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFCAD6E2,
-0xFFCBD7E3,
-0xFFCBD8E1,
-0xFFCBD7E3,
-0xFFCBD8E1,
-0xFFCBD7E3,
-0xFFCBD7E3,
-0xFFC7D7E4,
-0xFFCBDBE8,
-0xFFBECEDD,
-0xFFB1C1D0,
-0xFFB7C7D6,
-0xFFBBCBDA,
-0xFFBFCFDE,
-0xFFCBD8E8,
-0xFFCEDCE9,
-0xFFD0DEE9,
-0xFFCFDDE8,
-0xFFCDDBE6,
-0xFFCFDBE7,
-0xFFD0DCEA,
-0xFFD0DCEA,
-0xFFD2DEEC,
-0xFFD2DCE8,
-0xFFD3DDE9,
-0xFFD2DCE8,
-0xFFD1DBE7,
-0xFFD2DCE8,
-0xFFD3DDE9,
-0xFFD4DEEA,
-0xFFD3DDE9,
-0xFFD2DCE8,
-0xFFD2DCE8,
-0xFFD2DCE8,
-0xFFD3DDE9,
-0xFFD3DDE9,
-0xFFD3DDE9,
-0xFFD3DDE9,
-0xFFD4DEEA,
-0xFFD4DCE9,
-0xFFD4DCE9,
-0xFFD4DCE9,
-0xFFD3DDE9,
-0xFFD4DCE9,
-0xFFD3DDE9,
-0xFFD3DDE9,
-0xFFD3DDE9,
-0xFFD4DEEA,
-0xFFD1DDE9,
-0xFFD3DDE9,
-0xFFD0DCE8,
-0xFFD2DBEA,
-0xFFD1DDEB,
-0xFFD4DDEC,
-0xFFD2DEEC,
-0xFFD1DFEA,
-0xFFCFE0EA,
-0xFFD1DFEA,
-0xFFCFE0EA,
-0xFFD1DFEC,
-0xFFCFDFEC,
-0xFFCEDEEB,
-0xFFCEDEEB,
-0xFFCEDEEB,
-0xFFCCDEEA,
-0xFFCCDEEA,
-0xFFCDDFEB,
-0xFFCDDFED,
-0xFFCDDFED,
-0xFFCBDDEB,
-0xFFCADCEA,
-0xFFC9DBE9,
-0xFFC8DAE8,
-0xFFC9DAEA,
-0xFFC6D9E8,
-0xFFC6D9E8,
-0xFFC5D8E6,
-0xFFC4D6E0,
-0xFFCADBE2,
-0xFFDAE9EC,
-0xFFC8D6D7,
-0xFF9BAAA7,
-0xFF8A9A97,
-0xFFBFD2D0,
-0xFFBED4D1,
-0xFFD9F2EF,
-0xFFE4FDFA,
-0xFFD9EDEB,
-0xFFE2F5F3,
-0xFFAABDBB,
-0xFF728583,
-0xFF3C4F4D,
-0xFF283C3A,
-0xFFDDF1F0,
-0xFFABBFBE,
-0xFFAABEBF,
-0xFFB0C4C5,
-0xFF6E8185,
-0xFFC8D9E0,
-0xFFDDEEF6,
-0xFF899AA2,
-0xFF82939B,
-0xFF495A64,
-0xFF21333F,
-0xFF1C2F3E,
-0xFF6B8091,
-0xFFD3EAFC,
-0xFFC0DBEC,
-0xFFBBD8E8,
-0xFFBFDCEE,
-0xFFBDDAEA,
-0xFFBCD9E9,
-0xFFBCD9E9,
-0xFFBDD8E9,
-0xFFBED9EA,
-0xFFBED9EA,
-0xFFBED9EA,
-0xFFBDDAEC,
-0xFFBDDAEC,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBEDBED,
-0xFFBCDBED,
-0xFFBEDBED,
-0xFFBCDBED,
-0xFFBEDBED,
-0xFFBCDBED,
-0xFFBEDBED,
-0xFFBEDBED,
-0xFFBEDBED,
-0xFFBEDBED,
-0xFFBEDBED,
-0xFFBEDBED,
-0xFFBEDBED,
-0xFFBCDBED,
-0xFFBEDBED,
-0xFFBCDBED,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBDDAEC,
-0xFFBBDAEC,
-0xFFBBDAEE,
-0xFFBBDAEE,
-0xFFBBDAEC,
-0xFFBBDAEC,
-0xFFBBDAEC,
-0xFFBBDAEC,
-0xFFBBDAEC,
-0xFFB9DAEB,
-0xFFBAD9ED,
-0xFFB9DAEB,
-0xFFBAD9ED,
-0xFFB9DAEB,
-0xFFBAD9ED,
-0xFFB8D9EA,
-0xFFB8D9EC,
-0xFFB8D9EA,
-0xFFB8D9EC,
-0xFFB8D9EA,
-0xFFB7D8EB,
-0xFFB7D8EB,
-0xFFB8D7EB,
-0xFFB7D8EB,
-0xFFB8D7EB,
-0xFFB6D7EA,
-0xFFB7D6EA,
-0xFFB6D7EA,
-0xFFB7D6EB,
-0xFFB6D7EA,
-0xFFB7D6EA,
-0xFFB6D7EA,
-0xFFB7D6EA,
-0xFFB6D7EA,
-0xFFB7D6EA,
-0xFFB7D6E8,
-0xFFB7D6E8,
-0xFFB6D7E8,
-0xFFB3D8E8,
-0xFFB4D9E9,
-0xFFB4D9E9,
-0xFFB7D8E9,
-0xFFBBD6E9,
-0xFFBBD6E9,
-0xFFB8D9EA,
-0xFFB4D8E6,
-0xFFB7DBE9,
-0xFFBAD7E7,
-0xFFE2F5FF,
-0xFFC0D3E4,
-0xFFBBD7E3,
-0xFFBDD8E1,
-0xFFDAE7EF,
-0xFFEDF2F8,
-0xFFECEFF6,
-0xFFA9B3BC,
-0xFFBDDBE6,
-0xFFB5DAEA,
-0xFFBBD7EC,
-0xFFBBD5EC,
-0xFFBAD9EE,
-0xFFB8D7EC,
-0xFFBAD7E9,
-0xFFC5D3E0,
-0xFFE9DAE1,
-0xFF72494D,
-0xFF4A0C11,
-0xFF7C4D57,
-0xFFD2D9E9,
-0xFFB5D8EB,
-0xFFB2D3E6,
-0xFFB5D4E8,
-0xFFB7D3E8,
-0xFFB4D3E7,
-0xFFB3D2E7,
-0xFFB2D2E7,
-0xFFB1D1E6,
-0xFFAFD2E6,
-0xFFAFD2E6,
-0xFFAED1E5,
-0xFFAED1E5,
-0xFFAED1E5,
-0xFFB0D0E5,
-0xFFAED1E5,
-0xFFADD1E7,
-0xFFADD1E7,
-0xFFACD2E7,
-0xFFACD2E7,
-0xFFACD2E7,
-0xFFACD2E7,
-0xFFADD1E7,
-0xFFADD1E7,
-0xFFADD1E7,
-0xFFAED2E8,
-0xFFAED2E8,
-0xFFAFD2E6,
-0xFFAFD2E6,
-0xFFAFD2E6,
-0xFFB2D2E7,
-0xFFB0D3E7,
-0xFFB3D3E8,
-0xFFB2D5E9,
-0xFFB4D4E9,
-0xFFB3D4E7,
-0xFFB3D4E7,
-0xFFB4D5E8,
-0xFFB3D4E7,
-0xFFB2D3E6,
-0xFFB3D4E7,
-0xFFB3D4E7,
-0xFFB3D4E7,
-0xFFB4D5E8,
-0xFFB2D5E8,
-0xFFB2D5E9,
-0xFFB2D5E9,
-0xFFB3D6EA,
-0xFFB4D7EB,
-0xFFB4D7EA,
-0xFFB3D6EA,
-0xFFB3D6EA,
-0xFFB2D7EA,
-0xFFB2D7EA,
-0xFFB1D7EC,
-0xFFB0D6EB,
-0xFFB0D6EB,
-0xFFB0D6EB,
-0xFFB2D7EA,
-0xFFB2D7EA,
-0xFFB2D5E9,
-0xFFB3D4E7,
-0xFFB3D4E7,
-0xFFB5D6E9,
-0xFFB3D6E9,
-0xFFAED1E4,
-0xFFAFD2E5,
-0xFFAFD2E5,
-0xFFB2D3E4,
-0xFFB2D3E4,
-0xFFAFCFDE,
-0xFFB4D1E1,
-0xFFB0CCDA,
-0xFFB4D0DC,
-0xFFBDD5E1,
-0xFFC4DCE6,
-0xFFCBE1EC,
-0xFFD2E6F1,
-0xFFD4E8F1,
-0xFFD5E7F1,
-0xFFDDEBF4,
-0xFFDAE8F1,
-0xFFD7E8F0,
-0xFFD8EAF4,
-0xFFD5E9F4,
-0xFFCDE0EE,
-0xFFB7CDDB,
-0xFFB2C8D6,
-0xFFB6CBDC,
-0xFFBED3E4,
-0xFFC2D7E8,
-0xFFBED3E4,
-0xFFBCD3E5,
-0xFFB7CEDE,
-0xFFAEC8D9,
-0xFFB4CEDD,
-0xFFC6D2DE,
-0xFFC7D4DD,
-0xFFC8D5DE,
-0xFFCBD5DF,
-0xFFCBD5DF,
-0xFFCCD6E0,
-0xFFCCD6E0,
-0xFFCBD5DF,
-0xFFCCD6E0,
-0xFFCCD6E0,
-0xFFCDD7E1,
-0xFFCED8E2,
-0xFFCED8E2,
-0xFFCFD9E3,
-0xFFCFD9E3,
-0xFFCDDAE3,
-0xFFCBD9E4,
-0xFFCCDCE9,
-0xFFC1D1E0,
-0xFFAFBFCE,
-0xFFB3C0D0,
-0xFFBAC7D7,
-0xFFC2CFDF,
-0xFFC6D4E1,
-0xFFC9D7E2,
-0xFFCFDCE5,
-0xFFD1DEE7,
-0xFFD1DEE7,
-0xFFD4DEE8,
-0xFFD4DEEA,
-0xFFD4DEEA,
-0xFFD5DFEB,
-0xFFD5DDE8,
-0xFFD6DEE9,
-0xFFD5DDE8,
-0xFFD4DCE7,
-0xFFD5DDE8,
-0xFFD7DFEA,
-0xFFD7DFEA,
-0xFFD6DEE9,
-0xFFD6DEE9,
-0xFFD6DEE9,
-0xFFD6DEE9,
-0xFFD6DEE9,
-0xFFD6DEE9,
-0xFFD6DFE8,
-0xFFD6DEE9,
-0xFFD7E0E9,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD7E0E9,
-0xFFD7DFEA,
-0xFFD8E0EB,
-0xFFD7DFEA,
-0xFFD7DFEA,
-0xFFD7DFEA,
-0xFFD5DFE9,
-0xFFD5DFE8,
-0xFFD5DFE9,
-0xFFD5DFE9,
-0xFFD5DFE9,
-0xFFD5DFE9,
-0xFFD5DFE9,
-0xFFD5DFE9,
-0xFFD2DFE8,
-0xFFD2DFE8,
-0xFFD2DFE8,
-0xFFD2DFE8,
-0xFFD2DEEA,
-0xFFD1DDE9,
-0xFFD1DDE9,
-0xFFD0DCE8,
-0xFFD1DDE9,
-0xFFD2DEEA,
-0xFFD2E0ED,
-0xFFD0DEEB,
-0xFFCEDEEB,
-0xFFCCDCE9,
-0xFFCAD8E1,
-0xFFCDDCE3,
-0xFFD6E4E7,
-0xFFD0DEDE,
-0xFF9FADAD,
-0xFF96A6A3,
-0xFF607371,
-0xFF748886,
-0xFF96AFAC,
-0xFF95AEAB,
-0xFFDDF3F0,
-0xFF738986,
-0xFF394D4B,
-0xFF415553,
-0xFF2C403E,
-0xFF90A4A2,
-0xFFCBDFDE,
-0xFF819594,
-0xFF55696A,
-0xFF506264,
-0xFFCDDFE3,
-0xFFD8E7EE,
-0xFFCCDBE2,
-0xFFC9D6DE,
-0xFF56636C,
-0xFF1F2D36,
-0xFF243441,
-0xFF203240,
-0xFF182B3A,
-0xFFB2C7D8,
-0xFFC3DDEC,
-0xFFBCD6E5,
-0xFFC4DEED,
-0xFFBDD7E6,
-0xFFC0DAE9,
-0xFFC0DAE7,
-0xFFC2D9E7,
-0xFFC2D9E7,
-0xFFC2D9E7,
-0xFFC2D9E7,
-0xFFC0DAE9,
-0xFFC0DAE9,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFC0DAEB,
-0xFFC0DAEB,
-0xFFC0DAEB,
-0xFFC0DAEB,
-0xFFBFDAEB,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFBFDAEB,
-0xFFC0DBEC,
-0xFFC0DBEE,
-0xFFC0DBEC,
-0xFFC0DBEE,
-0xFFBEDBED,
-0xFFBFDCEE,
-0xFFBFDCEE,
-0xFFBFDAED,
-0xFFBFDAEB,
-0xFFBFDAEB,
-0xFFBEDBEB,
-0xFFBEDBEB,
-0xFFBEDBEB,
-0xFFBEDBEB,
-0xFFBEDBEB,
-0xFFBEDBED,
-0xFFBDDAEA,
-0xFFBDDAEC,
-0xFFBBDBEA,
-0xFFBBDAEC,
-0xFFBBDBEA,
-0xFFBBDAEC,
-0xFFBBDBEA,
-0xFFBCD9EB,
-0xFFBCD9EB,
-0xFFBCD9EB,
-0xFFBCD9EB,
-0xFFBCD9EB,
-0xFFBAD9EB,
-0xFFBCD8ED,
-0xFFBAD9EB,
-0xFFBCD8ED,
-0xFFBAD9EB,
-0xFFBCD8ED,
-0xFFBAD9EB,
-0xFFBAD9EB,
-0xFFBAD9EB,
-0xFFBAD9EB,
-0xFFBAD9EB,
-0xFFBAD9EB,
-0xFFB9DAEB,
-0xFFB7DBEB,
-0xFFB6DBEB,
-0xFFB8DCEC,
-0xFFBADBEC,
-0xFFBED9EC,
-0xFFBDD8EB,
-0xFFBBDBEA,
-0xFFB7DBE9,
-0xFFBADBEA,
-0xFFBEDBEB,
-0xFFDDF2FF,
-0xFFC3D6E7,
-0xFFBFDBE7,
-0xFFBFDAE3,
-0xFFDBE8F0,
-0xFFEDF2F8,
-0xFFEEEFF4,
-0xFFAAB5BB,
-0xFFC0DDE5,
-0xFFB9DDE9,
-0xFFBFDAEF,
-0xFFC0D6ED,
-0xFFBCD7EC,
-0xFFBDD8ED,
-0xFFC0D9ED,
-0xFFCCD2E0,
-0xFFF7D4DA,
-0xFF844445,
-0xFF731D20,
-0xFF96575F,
-0xFFD9DBE8,
-0xFFB9DAED,
-0xFFB6D5E9,
-0xFFB8D7EB,
-0xFFBAD6EB,
-0xFFB9D5EA,
-0xFFB8D4E9,
-0xFFB5D4E9,
-0xFFB5D4E9,
-0xFFB4D4E9,
-0xFFB3D3E8,
-0xFFB3D3E8,
-0xFFB3D3E8,
-0xFFB3D3E8,
-0xFFB2D2E7,
-0xFFB2D2E7,
-0xFFB2D2E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFAFD4E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFB0D3E7,
-0xFFAFD2E6,
-0xFFB3D3E8,
-0xFFB4D5E8,
-0xFFB5D4E6,
-0xFFB5D4E6,
-0xFFB7D4E6,
-0xFFB7D4E6,
-0xFFB7D4E6,
-0xFFB6D3E5,
-0xFFB6D3E5,
-0xFFB8D5E7,
-0xFFBBD8E8,
-0xFFBBD6E7,
-0xFFB8D3E4,
-0xFFB9D4E5,
-0xFFBBD6E7,
-0xFFB8D3E4,
-0xFFBAD5E6,
-0xFFBBD6E7,
-0xFFB9D4E5,
-0xFFB9D4E5,
-0xFFB9D6E8,
-0xFFBAD7E9,
-0xFFBAD7E9,
-0xFFBBD8EA,
-0xFFB9D8EA,
-0xFFB8D7E9,
-0xFFB7D8E9,
-0xFFB5D8EB,
-0xFFB6D9EC,
-0xFFB5DAED,
-0xFFB5DAED,
-0xFFB4D9EC,
-0xFFB4D9EC,
-0xFFB6D9EC,
-0xFFB6D7EA,
-0xFFB6D5E7,
-0xFFB8D5E5,
-0xFFB8D5E5,
-0xFFB7D4E4,
-0xFFB9D6E8,
-0xFFB7D4E4,
-0xFFBEDBEB,
-0xFFBFDBE9,
-0xFFBBD7E5,
-0xFFB9D3E0,
-0xFFBAD1DF,
-0xFFC4DAE7,
-0xFFC9DDE8,
-0xFFCFE1EB,
-0xFFD7E8F0,
-0xFFDBEAF1,
-0xFFDBE8F0,
-0xFFDAE7ED,
-0xFFDCE7ED,
-0xFFDFE8ED,
-0xFFDDE5E8,
-0xFFDDE5E8,
-0xFFDAE3E8,
-0xFFD9E4EA,
-0xFFDDEAF2,
-0xFFDEECF7,
-0xFFC6D6E3,
-0xFFBCCCD9,
-0xFFC3D3E2,
-0xFFC2D2E1,
-0xFFC3D3E2,
-0xFFC2D2E1,
-0xFFC4D5E5,
-0xFFC8DAE8,
-0xFFC6D8E6,
-0xFFC7DAE8,
-0xFFC8D2DC,
-0xFFCAD4DD,
-0xFFCBD5DE,
-0xFFCCD5DE,
-0xFFCCD5DE,
-0xFFCDD6DF,
-0xFFCDD5E0,
-0xFFCCD4DF,
-0xFFCCD4DF,
-0xFFCDD5E0,
-0xFFCDD5E0,
-0xFFCED6E1,
-0xFFCFD7E2,
-0xFFD0D8E3,
-0xFFD0D8E3,
-0xFFCFD9E3,
-0xFFCCD8E4,
-0xFFC1CFDA,
-0xFFBFCDDA,
-0xFFC0CEDB,
-0xFFC2CEDC,
-0xFFBAC6D4,
-0xFFBECAD8,
-0xFFC3CFDB,
-0xFFC6D2DE,
-0xFFCED8E2,
-0xFFD2DCE6,
-0xFFD2DCE5,
-0xFFD5DEE7,
-0xFFD6DEE9,
-0xFFD5DDE8,
-0xFFD6DEE9,
-0xFFD5DFE9,
-0xFFD5DFE8,
-0xFFD4DEE7,
-0xFFD4DEE7,
-0xFFD5DFE8,
-0xFFD6E0E9,
-0xFFD8E1EA,
-0xFFD7E0E9,
-0xFFD7E0E9,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD7E0E9,
-0xFFD6DFE8,
-0xFFD6DFE6,
-0xFFD6DFE8,
-0xFFD7E0E7,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFDAE1E9,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFDBE2EC,
-0xFFDBE2EA,
-0xFFDBE2EC,
-0xFFDBE2EC,
-0xFFDAE3EC,
-0xFFDAE3EC,
-0xFFDAE3EC,
-0xFFDAE3EC,
-0xFFDAE3EC,
-0xFFDAE3EC,
-0xFFDAE3EC,
-0xFFD9E2EB,
-0xFFD8E0EB,
-0xFFD8E0EB,
-0xFFD7DFEA,
-0xFFD7DFEA,
-0xFFD7DFEA,
-0xFFD7DFEA,
-0xFFD7E1ED,
-0xFFD5DFEB,
-0xFFD4E0EC,
-0xFFD3E0E9,
-0xFFD0DDE5,
-0xFFD3E0E6,
-0xFFD1DCE0,
-0xFFDCE8E8,
-0xFFDDE9E9,
-0xFFDAE9E6,
-0xFFE3F3F2,
-0xFFDBEFED,
-0xFFB8CECC,
-0xFFCBE4E1,
-0xFF7F9593,
-0xFF2F4845,
-0xFF374D4B,
-0xFF324846,
-0xFF3E5452,
-0xFFE2F8F6,
-0xFFA3B7B6,
-0xFF96AAA9,
-0xFF798B8D,
-0xFFE4F6F8,
-0xFFCCDBDE,
-0xFFBDCAD0,
-0xFFD1DEE4,
-0xFFABB6BC,
-0xFF96A0A9,
-0xFF3B454E,
-0xFF1B2934,
-0xFF223241,
-0xFF243644,
-0xFF6A7D8C,
-0xFFD4EAF8,
-0xFFCAE1EF,
-0xFFC8DFED,
-0xFFC7DFEB,
-0xFFC7DDEA,
-0xFFC7DDEA,
-0xFFC9DDE8,
-0xFFC9DDE8,
-0xFFC8DBE9,
-0xFFC8DBE9,
-0xFFC6DCEA,
-0xFFC6DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC5DCEA,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC3DAE8,
-0xFFC3DAEA,
-0xFFC3DAEA,
-0xFFC3DAEA,
-0xFFC3DAEA,
-0xFFC4DBEB,
-0xFFC4DBEB,
-0xFFC2DCEB,
-0xFFC2DCEB,
-0xFFC2DCEB,
-0xFFC3DDEC,
-0xFFC3DDEE,
-0xFFC2DCEB,
-0xFFC2DCED,
-0xFFC1DCED,
-0xFFC1DCED,
-0xFFC1DDEB,
-0xFFC1DBEA,
-0xFFC1DBEA,
-0xFFC1DBEA,
-0xFFC1DBEA,
-0xFFC1DBEA,
-0xFFC0DCEA,
-0xFFC1DDEB,
-0xFFC1DDEB,
-0xFFC0DBEC,
-0xFFC0DCEA,
-0xFFC0DBEC,
-0xFFBFDCEA,
-0xFFBFDCEC,
-0xFFBFDCEA,
-0xFFBFDCEC,
-0xFFBFDCEA,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFC0DBEC,
-0xFFBFDCEC,
-0xFFC0DBEE,
-0xFFBFDCEC,
-0xFFC0DBEE,
-0xFFBFDCEC,
-0xFFC0DBEE,
-0xFFBFDCEC,
-0xFFBFDCEC,
-0xFFBFDCEC,
-0xFFBFDCEC,
-0xFFBFDCEC,
-0xFFBFDCEE,
-0xFFBFDCEE,
-0xFFBDDCEE,
-0xFFBDDCEE,
-0xFFBEDDEF,
-0xFFC0DDEF,
-0xFFC4DAEF,
-0xFFC3D9EE,
-0xFFC0DBEC,
-0xFFC1DEEE,
-0xFFBDDDEC,
-0xFFC2DDEE,
-0xFFDCEFFF,
-0xFFC6D7E9,
-0xFFC5DCEC,
-0xFFC4DAE7,
-0xFFDBE8F0,
-0xFFEAF1F7,
-0xFFEBEEF3,
-0xFFABB6BC,
-0xFFC2DFE7,
-0xFFBEE0EA,
-0xFFC2DBEF,
-0xFFC3D9EE,
-0xFFC6DCF1,
-0xFFC2DBEF,
-0xFFC0D9ED,
-0xFFD7D3E2,
-0xFFFFCFD6,
-0xFF87292A,
-0xFF9B3334,
-0xFFD58D91,
-0xFFDAD8E5,
-0xFFBCDBED,
-0xFFB9D8EA,
-0xFFBDDAEC,
-0xFFBDD8EB,
-0xFFBDD8EB,
-0xFFBCD7EA,
-0xFFBAD6EB,
-0xFFBAD6EB,
-0xFFB8D7EB,
-0xFFB8D7EB,
-0xFFB7D6EA,
-0xFFB7D6EA,
-0xFFB7D6EA,
-0xFFB7D6EA,
-0xFFB9D5EA,
-0xFFB8D5E7,
-0xFFB8D5E5,
-0xFFB8D5E5,
-0xFFB6D6E5,
-0xFFB8D5E7,
-0xFFB8D5E7,
-0xFFB8D5E7,
-0xFFB8D5E7,
-0xFFB9D6E8,
-0xFFBBD6E9,
-0xFFBAD5E6,
-0xFFBAD4E3,
-0xFFBAD4E3,
-0xFFBED5E3,
-0xFFBFD6E4,
-0xFFBFD6E4,
-0xFFBFD5E3,
-0xFFC1D7E5,
-0xFFC2D5E4,
-0xFFBFD2E0,
-0xFFBFD2E0,
-0xFFC3D6E4,
-0xFFCADCEA,
-0xFFCDDFED,
-0xFFD0E2F0,
-0xFFD4E6F4,
-0xFFD3E5F3,
-0xFFCBDDEB,
-0xFFC5D7E5,
-0xFFC3D6E5,
-0xFFC3D6E5,
-0xFFC0D6E4,
-0xFFC1D8E6,
-0xFFBED8E5,
-0xFFBDD9E7,
-0xFFBCD9E7,
-0xFFBADAE9,
-0xFFBAD9EB,
-0xFFB9DAED,
-0xFFB7DAED,
-0xFFB9DAED,
-0xFFBADBEC,
-0xFFBADAE9,
-0xFFBAD7E7,
-0xFFBCD8E6,
-0xFFBFD9E6,
-0xFFC0D7E5,
-0xFFBED4E1,
-0xFFBFD5E3,
-0xFFC1D4E3,
-0xFFCEE1F0,
-0xFFD1E3F1,
-0xFFCDDFED,
-0xFFCBDBE8,
-0xFFC9DAE4,
-0xFFD6E4ED,
-0xFFD9E6EE,
-0xFFDEE9EF,
-0xFFE2EBF2,
-0xFFE2E9EF,
-0xFFE3E8EC,
-0xFFE3E7EA,
-0xFFE7E8EC,
-0xFFE9EAEE,
-0xFFEAEBED,
-0xFFEBECEE,
-0xFFE8ECEF,
-0xFFE4E9ED,
-0xFFE3ECF1,
-0xFFE1EBF4,
-0xFFCAD7E0,
-0xFFC7D3DF,
-0xFFC7D3E1,
-0xFFC1CDDB,
-0xFFC7D3E1,
-0xFFC9D5E3,
-0xFFC6D2E2,
-0xFFC9D7E4,
-0xFFC9D7E4,
-0xFFC3D1DE,
-0xFFC8D2DB,
-0xFFC9D3DC,
-0xFFCBD4DD,
-0xFFCBD4DD,
-0xFFCBD4DD,
-0xFFCCD5DE,
-0xFFCCD4DF,
-0xFFCBD3DE,
-0xFFCDD5E0,
-0xFFCDD5E0,
-0xFFCED6E1,
-0xFFCED6E1,
-0xFFCFD7E2,
-0xFFCFD7E2,
-0xFFD0D8E3,
-0xFFCFD9E3,
-0xFFCAD6E2,
-0xFFC5D3DE,
-0xFFC5D1DF,
-0xFFBBC7D5,
-0xFFBCC8D6,
-0xFFC3CFDD,
-0xFFCAD6E2,
-0xFFC1CDD9,
-0xFFCCD6E0,
-0xFFD2DCE5,
-0xFFD6DFE8,
-0xFFD5DEE7,
-0xFFD5DEE7,
-0xFFD5DEE7,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD4DEE7,
-0xFFD5DFE8,
-0xFFD7E1EA,
-0xFFD8E1EA,
-0xFFD7E0E9,
-0xFFD7E0E9,
-0xFFD7E0E9,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD9E2E9,
-0xFFD9E2E7,
-0xFFD9E2E7,
-0xFFD9E2E7,
-0xFFD9E2E7,
-0xFFDAE3E8,
-0xFFDAE3E8,
-0xFFDAE3E8,
-0xFFDAE3E8,
-0xFFDCE5EA,
-0xFFDBE4E9,
-0xFFDBE2EA,
-0xFFDAE1E9,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDEE2EB,
-0xFFDEE2EB,
-0xFFDEE2EB,
-0xFFDDE1EA,
-0xFFDBE2EA,
-0xFFDBE2EA,
-0xFFDBE2EA,
-0xFFDBE2EA,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDBE2EC,
-0xFFDBE2EC,
-0xFFDCE3ED,
-0xFFDDE4EE,
-0xFFDDE4EE,
-0xFFDCE3ED,
-0xFFDCE3ED,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E2EB,
-0xFFD7E2E8,
-0xFFDBE6EA,
-0xFFD0DBDD,
-0xFFD0DBDD,
-0xFFDBE7E7,
-0xFFE2F1EE,
-0xFFCCDCDB,
-0xFF9AADAB,
-0xFF708483,
-0xFF384C4B,
-0xFF1A302E,
-0xFF1B312F,
-0xFF1F3533,
-0xFF586E6C,
-0xFFC3D7D6,
-0xFF6F8382,
-0xFFB1C5C4,
-0xFF647877,
-0xFF7F9191,
-0xFFBDCFCF,
-0xFF808F92,
-0xFFB5C3C6,
-0xFFD1DFE2,
-0xFFB3C1C4,
-0xFF96A1A5,
-0xFFAEB9BF,
-0xFF727F88,
-0xFF192734,
-0xFF1C2C39,
-0xFF374957,
-0xFFE0F3FF,
-0xFFCBDEEC,
-0xFFCEE1EF,
-0xFFCFE3EE,
-0xFFCFE1ED,
-0xFFCFE1EB,
-0xFFCFE0EA,
-0xFFCFE0E8,
-0xFFCFE0EA,
-0xFFCDDFE9,
-0xFFCDDFEB,
-0xFFCDDFEB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCBDFEA,
-0xFFCBDFEA,
-0xFFCBDFEA,
-0xFFCBDFEA,
-0xFFCBDFEA,
-0xFFCBDFEA,
-0xFFCADEE9,
-0xFFCADEE9,
-0xFFC9DCEA,
-0xFFC9DCEA,
-0xFFC9DCEA,
-0xFFC9DCEA,
-0xFFC9DCEA,
-0xFFC9DCEA,
-0xFFC7DDEA,
-0xFFC7DDEA,
-0xFFC6DCEA,
-0xFFC6DCEA,
-0xFFC7DDEB,
-0xFFC6DCEA,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC4DBE9,
-0xFFC5DCEA,
-0xFFC6DCE9,
-0xFFC6DCE9,
-0xFFC6DCE9,
-0xFFC6DCE9,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC3DDEA,
-0xFFC5DCEA,
-0xFFC3DDEC,
-0xFFC3DDEC,
-0xFFC3DDEC,
-0xFFC3DDEC,
-0xFFC3DDEC,
-0xFFC4DEED,
-0xFFC3DFED,
-0xFFC4DEED,
-0xFFC3DFED,
-0xFFC3DFED,
-0xFFC3DFEB,
-0xFFC3DFEB,
-0xFFC2DEEC,
-0xFFC2DDEE,
-0xFFC2DDEE,
-0xFFC2DDEE,
-0xFFC1DEEE,
-0xFFC2DFEF,
-0xFFC3DEEF,
-0xFFC7DCEF,
-0xFFC6DBEC,
-0xFFC2DCEB,
-0xFFC5E1EF,
-0xFFC2DEEC,
-0xFFC5DFEE,
-0xFFDBECFC,
-0xFFC7D8E8,
-0xFFC7DEEC,
-0xFFC6DCE7,
-0xFFDAE9F0,
-0xFFE9F2F7,
-0xFFE8EFF5,
-0xFFA9B6BC,
-0xFFC4E1E7,
-0xFFC0E0EB,
-0xFFC4DEEF,
-0xFFC5DCEE,
-0xFFC4DBEB,
-0xFFC6E0EF,
-0xFFC3DEF1,
-0xFFDFD4E4,
-0xFFFFACAF,
-0xFF8F1C19,
-0xFF871B19,
-0xFFF9B2B6,
-0xFFDAD7E0,
-0xFFC0DCEA,
-0xFFBFDBE9,
-0xFFC2DCEB,
-0xFFC3DAEA,
-0xFFC2D9E9,
-0xFFC2D9E9,
-0xFFBED8E9,
-0xFFBFD9EA,
-0xFFBED9EA,
-0xFFBDD8E9,
-0xFFBDD8E9,
-0xFFBDD6EA,
-0xFFBDD7E8,
-0xFFBDD6EA,
-0xFFBDD7E8,
-0xFFBFD6E4,
-0xFFBFD7E3,
-0xFFBFD7E3,
-0xFFBFD6E4,
-0xFFBFD6E4,
-0xFFBFD6E4,
-0xFFBFD6E6,
-0xFFBFD6E4,
-0xFFC0D5E6,
-0xFFC0D6E4,
-0xFFC2D5E3,
-0xFFC4D8E3,
-0xFFCADCE8,
-0xFFD2E4EE,
-0xFFD8E9F3,
-0xFFDAEBF5,
-0xFFD6E4EF,
-0xFFDCEAF5,
-0xFFD7E5F0,
-0xFFC9D6DF,
-0xFFC8D4E0,
-0xFFD7E4ED,
-0xFFE3F0F9,
-0xFFE5EFF9,
-0xFFE1EBF5,
-0xFFE7F1FB,
-0xFFE7F1FB,
-0xFFDEE8F2,
-0xFFD6E0EC,
-0xFFD5E1ED,
-0xFFD6E2EE,
-0xFFD4E2ED,
-0xFFC8DAE6,
-0xFFC6DAE5,
-0xFFC3D9E6,
-0xFFC2DAE6,
-0xFFC0DAE9,
-0xFFBFDBE9,
-0xFFBEDBEB,
-0xFFBDDAEA,
-0xFFBCD9E9,
-0xFFBFDBE9,
-0xFFBFD9E8,
-0xFFC0D8E4,
-0xFFC5DBE8,
-0xFFCCE0EB,
-0xFFCCDEE8,
-0xFFC8D9E3,
-0xFFCDDBE6,
-0xFFC8D4E0,
-0xFFD2DEEA,
-0xFFDCE6F0,
-0xFFE1EBF5,
-0xFFE3ECF5,
-0xFFDBE4EB,
-0xFFE0E7EF,
-0xFFE6EBF1,
-0xFFE5EAEE,
-0xFFE6E9EE,
-0xFFE9EAEE,
-0xFFECECEE,
-0xFFEEEEF0,
-0xFFEEECEF,
-0xFFEEECEF,
-0xFFEFEDEE,
-0xFFEAE8E9,
-0xFFE9E9EB,
-0xFFE7EBEE,
-0xFFE5EAEE,
-0xFFDCE3E9,
-0xFFC6CFD8,
-0xFFCAD4DE,
-0xFFC2CCD8,
-0xFFC5CFDB,
-0xFFC5CEDD,
-0xFFC0C9D8,
-0xFFC1CAD9,
-0xFFC3CCDB,
-0xFFC1CBD7,
-0xFFC5D1DD,
-0xFFCAD4DE,
-0xFFCBD5DF,
-0xFFCBD5DF,
-0xFFCBD5DF,
-0xFFCAD4DE,
-0xFFC9D3DD,
-0xFFCAD4DE,
-0xFFCCD6E0,
-0xFFCED8E2,
-0xFFCED8E2,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCFD9E5,
-0xFFD0DAE6,
-0xFFCDDAE3,
-0xFFCFDCE5,
-0xFFD2DCE8,
-0xFFD1DBE7,
-0xFFCED8E4,
-0xFFCCD6E2,
-0xFFCCD6E2,
-0xFFCDD7E3,
-0xFFD3DBE6,
-0xFFD3DCE5,
-0xFFD3DCE5,
-0xFFD4DDE4,
-0xFFD6DDE5,
-0xFFD7DEE6,
-0xFFD7DEE8,
-0xFFD6DFE8,
-0xFFD4DEE7,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD6E0E9,
-0xFFD6E0E9,
-0xFFD7E0E9,
-0xFFD7E0E9,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1E8,
-0xFFD9E2E9,
-0xFFDAE1E9,
-0xFFDAE3EA,
-0xFFD9E2E7,
-0xFFD9E4E8,
-0xFFD9E4E8,
-0xFFDAE5E9,
-0xFFD9E4E8,
-0xFFD9E4E8,
-0xFFD8E3E7,
-0xFFD8E3E7,
-0xFFDAE3E8,
-0xFFDAE3E8,
-0xFFDAE3E8,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDCE3E9,
-0xFFDCE3E9,
-0xFFDBE2E8,
-0xFFDBE2E8,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDBE2E8,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDDE4EC,
-0xFFDDE4EC,
-0xFFE0E4ED,
-0xFFDCE3EB,
-0xFFDAE1E9,
-0xFFDDE6ED,
-0xFFDBE4EB,
-0xFFD8E1E8,
-0xFFDBE4EB,
-0xFFDBE4E9,
-0xFFD8E2E4,
-0xFFDCE6E8,
-0xFFE0ECEC,
-0xFFDAE6E6,
-0xFF7B8989,
-0xFF758584,
-0xFF677777,
-0xFF829494,
-0xFF97A7A7,
-0xFFBBCBCB,
-0xFFE1F1F1,
-0xFFEFFFFF,
-0xFFB1C3C3,
-0xFF314343,
-0xFFA4B6B6,
-0xFF3E5050,
-0xFF97A9A9,
-0xFFAEC1BF,
-0xFFBED0D0,
-0xFFBCCCCC,
-0xFFC1D1D1,
-0xFFA4B4B4,
-0xFF7E8E8D,
-0xFF7B8B8B,
-0xFF7C8991,
-0xFF596571,
-0xFF1D2B36,
-0xFF0E1E2B,
-0xFFD7E7F4,
-0xFFD5E5F2,
-0xFFD2E2EF,
-0xFFD6E7F1,
-0xFFD5E3EC,
-0xFFD5E4EB,
-0xFFD6E3EB,
-0xFFD6E3EB,
-0xFFD5E3EC,
-0xFFD5E3EC,
-0xFFD5E3EE,
-0xFFD3E4EE,
-0xFFD5E3EC,
-0xFFD5E3EC,
-0xFFD4E2EB,
-0xFFD5E3EC,
-0xFFD5E3EC,
-0xFFD5E3EC,
-0xFFD5E3EC,
-0xFFD5E3EC,
-0xFFD4E2EB,
-0xFFD4E2EB,
-0xFFD4E2EB,
-0xFFD4E2EB,
-0xFFD4E2EB,
-0xFFD4E2EB,
-0xFFD4E2EB,
-0xFFD3E1EA,
-0xFFD2E3ED,
-0xFFD2E3ED,
-0xFFD1E2EC,
-0xFFD1E2EC,
-0xFFCFE1EB,
-0xFFCFE1EB,
-0xFFCFE1EB,
-0xFFCFE1EB,
-0xFFCDDFEB,
-0xFFCDDFEB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCCE0EB,
-0xFFCBDFEA,
-0xFFCBDFEA,
-0xFFCCE0EB,
-0xFFCBDFEA,
-0xFFCADDEB,
-0xFFCADDEB,
-0xFFCADDEB,
-0xFFCADDEB,
-0xFFC7DDEA,
-0xFFC8DEEB,
-0xFFC8DEEB,
-0xFFC7DDEA,
-0xFFC6DEEA,
-0xFFC5DDE9,
-0xFFC5DDE9,
-0xFFC6DEEA,
-0xFFC8E0EC,
-0xFFC7DFEB,
-0xFFC7DDEA,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC6DDEB,
-0xFFC7DEEC,
-0xFFC4DEEB,
-0xFFC5DCEA,
-0xFFC4DEEB,
-0xFFC4DEEB,
-0xFFC3DEE9,
-0xFFC4DFEA,
-0xFFC5E0EB,
-0xFFC6E0ED,
-0xFFC5DFEC,
-0xFFC4DEEB,
-0xFFC2DEEA,
-0xFFC2DEE9,
-0xFFC3DEE9,
-0xFFC7DDEA,
-0xFFC7DDEA,
-0xFFC9E1ED,
-0xFFBFDAE3,
-0xFFC6E3EB,
-0xFFC5E0E9,
-0xFFD7E9F5,
-0xFFC9DBE7,
-0xFFC7DFE9,
-0xFFC5DCE4,
-0xFFDAECF0,
-0xFFE4F2F5,
-0xFFE4F1F7,
-0xFFA7B8BF,
-0xFFC8E5EB,
-0xFFC0E1EA,
-0xFFC3DFED,
-0xFFC4DEED,
-0xFFC3DEE9,
-0xFFC4E0EB,
-0xFFC0E0EF,
-0xFFE8DBE5,
-0xFFEC8483,
-0xFF9C1710,
-0xFF7D1A15,
-0xFFFFD3D4,
-0xFFDBD8DF,
-0xFFC3D9E4,
-0xFFCBDFEA,
-0xFFD9EDF8,
-0xFFDEF0FC,
-0xFFD6E8F4,
-0xFFCCDEEA,
-0xFFC7D9E7,
-0xFFC4D6E4,
-0xFFC6D9E7,
-0xFFC5D8E6,
-0xFFC0D6E3,
-0xFFC5D8E7,
-0xFFCCDFED,
-0xFFCBDEED,
-0xFFC6D8E6,
-0xFFC6D7E1,
-0xFFCADBE3,
-0xFFD3E4EC,
-0xFFD9EAF4,
-0xFFD3E4EE,
-0xFFC7D8E2,
-0xFFC4D4E1,
-0xFFC9DAE4,
-0xFFD0DEEB,
-0xFFDBE9F4,
-0xFFDEEBF4,
-0xFFDCE9F1,
-0xFFE3EDF6,
-0xFFE6F1F7,
-0xFFE4EFF5,
-0xFFE6F1F7,
-0xFFE7F0F7,
-0xFFE3ECF3,
-0xFFDEE7EE,
-0xFFDDE4EA,
-0xFFE2E9F1,
-0xFFE9F0F6,
-0xFFEAF1F7,
-0xFFE8EDF3,
-0xFFE9EEF4,
-0xFFEAEFF5,
-0xFFE9EEF4,
-0xFFE9EEF4,
-0xFFEBEFF8,
-0xFFECF0F9,
-0xFFEAEEF7,
-0xFFE6EFF6,
-0xFFE0EDF5,
-0xFFD9E7F0,
-0xFFD0DEE9,
-0xFFC7D8E2,
-0xFFC4D7E5,
-0xFFC2D8E5,
-0xFFC4DAE8,
-0xFFC3DAE8,
-0xFFC2D9E7,
-0xFFC2D8E5,
-0xFFC4D7E5,
-0xFFC9DBE5,
-0xFFDFEDF8,
-0xFFE6F3FC,
-0xFFE9F3FC,
-0xFFE7F0F7,
-0xFFE9F0F8,
-0xFFE2E9F1,
-0xFFDEE5ED,
-0xFFE4E9EF,
-0xFFE8EDF3,
-0xFFE8EBF2,
-0xFFE7EAEF,
-0xFFE9ECF1,
-0xFFECEDF1,
-0xFFE9EAEE,
-0xFFECEBF0,
-0xFFEEEEF0,
-0xFFEDEBEE,
-0xFFEFEDF0,
-0xFFF4F0F1,
-0xFFF2EEEF,
-0xFFF2EEEF,
-0xFFEEECED,
-0xFFEBEBED,
-0xFFEBECF0,
-0xFFD0D3D8,
-0xFFD7DEE4,
-0xFFCFD8E1,
-0xFFC3CBD6,
-0xFFC9D1DE,
-0xFFC7CFDC,
-0xFFC3CADA,
-0xFFBEC5D5,
-0xFFBEC5D5,
-0xFFBFC8D7,
-0xFFC2CBDA,
-0xFFC3CCDB,
-0xFFC9D3DD,
-0xFFCAD4DE,
-0xFFCBD5DF,
-0xFFCBD5DF,
-0xFFCBD5DF,
-0xFFCBD5DF,
-0xFFCCD6E0,
-0xFFCDD7E1,
-0xFFCDD7E1,
-0xFFCED8E2,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCFD9E5,
-0xFFD0DAE6,
-0xFFCEDBE4,
-0xFFCFDCE5,
-0xFFD2DCE8,
-0xFFD2DCE8,
-0xFFD1DBE7,
-0xFFD0DAE6,
-0xFFD0DAE6,
-0xFFD0DAE4,
-0xFFD3DBE6,
-0xFFD3DCE5,
-0xFFD4DDE4,
-0xFFD5DEE5,
-0xFFD7DEE6,
-0xFFD7DEE6,
-0xFFD7DEE8,
-0xFFD6DFE8,
-0xFFD5DEE7,
-0xFFD4DEE7,
-0xFFD6DFE8,
-0xFFD6E0E9,
-0xFFD7E0E9,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD9E0EA,
-0xFFD8E1EA,
-0xFFD8DFE9,
-0xFFD7E0E9,
-0xFFD9E0E8,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDAE3EA,
-0xFFD9E4E8,
-0xFFDAE3E8,
-0xFFD9E4E8,
-0xFFDAE3E8,
-0xFFDAE5E9,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDBE4E9,
-0xFFDBE2E8,
-0xFFDAE3E8,
-0xFFDBE2E8,
-0xFFDBE4E9,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFDEE5EB,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDDE4EC,
-0xFFDEE5ED,
-0xFFDEE5ED,
-0xFFDDE4EC,
-0xFFDDE4EC,
-0xFFDDE4EA,
-0xFFDBE0E6,
-0xFFDEE3E9,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFDCE5EA,
-0xFFDDE6EB,
-0xFFDEE7EC,
-0xFFD7E0E5,
-0xFFD9E3E5,
-0xFFD7E1E3,
-0xFFD7E3E3,
-0xFFC9D5D5,
-0xFFCCDADA,
-0xFFD3E1E1,
-0xFFDDEBEC,
-0xFFA4B2B3,
-0xFFDFEDEE,
-0xFFD9E7E8,
-0xFFDDEBEC,
-0xFFCFDDDE,
-0xFF314141,
-0xFF657575,
-0xFF9FB1B1,
-0xFF768888,
-0xFFBBCECC,
-0xFFBCCFCD,
-0xFFBACAC9,
-0xFFBCCCCB,
-0xFFB9C9C8,
-0xFFA9B9B8,
-0xFFA5B5B2,
-0xFFADBDBC,
-0xFF8C979D,
-0xFF7C8690,
-0xFF66737C,
-0xFF212D39,
-0xFF94A0AC,
-0xFFE4F0FC,
-0xFFD9E5F1,
-0xFFD6E3EC,
-0xFFDAE4ED,
-0xFFDAE5EB,
-0xFFDBE4EB,
-0xFFDAE5EB,
-0xFFDAE5EB,
-0xFFD8E5ED,
-0xFFD8E5ED,
-0xFFD8E5ED,
-0xFFD9E6EE,
-0xFFDBE6EC,
-0xFFDBE5EE,
-0xFFDAE5EB,
-0xFFDAE4ED,
-0xFFDAE5EB,
-0xFFDBE5EE,
-0xFFDBE6EC,
-0xFFDBE5EE,
-0xFFDAE5EB,
-0xFFDAE4ED,
-0xFFDAE5EB,
-0xFFDBE5EE,
-0xFFDAE5EB,
-0xFFDAE4ED,
-0xFFD8E5ED,
-0xFFD8E5ED,
-0xFFD8E5ED,
-0xFFD7E4EC,
-0xFFD6E5EC,
-0xFFD6E5EC,
-0xFFD6E5EC,
-0xFFD5E4EB,
-0xFFD5E4EB,
-0xFFD7E5EE,
-0xFFD7E5EE,
-0xFFD5E6EE,
-0xFFD5E6EE,
-0xFFD5E6EE,
-0xFFD4E5ED,
-0xFFD4E5ED,
-0xFFD5E6EE,
-0xFFD3E4EC,
-0xFFD3E4EC,
-0xFFD2E3ED,
-0xFFD2E3ED,
-0xFFD1E2EC,
-0xFFD1E2EC,
-0xFFD2E3ED,
-0xFFD2E3ED,
-0xFFCFE1EB,
-0xFFCFE1EB,
-0xFFCFE1EB,
-0xFFCFE1EB,
-0xFFCDE1EA,
-0xFFCDE1EA,
-0xFFCDE1EA,
-0xFFCDE1EA,
-0xFFCBDFE8,
-0xFFCBDFE8,
-0xFFCADEE9,
-0xFFCADEE9,
-0xFFCBDFEA,
-0xFFCADEE9,
-0xFFCADEE9,
-0xFFC9DDE8,
-0xFFC9DFEA,
-0xFFC8DEE9,
-0xFFC8DEE9,
-0xFFC9DFEA,
-0xFFC9DFEA,
-0xFFC8DEE9,
-0xFFC8DFE7,
-0xFFC8DFE7,
-0xFFC8DCE5,
-0xFFC9DDE6,
-0xFFCADEE7,
-0xFFCBDFE8,
-0xFFCBE2E8,
-0xFFCEE2E9,
-0xFFD1E2EA,
-0xFFD2E3EB,
-0xFFD3E4EB,
-0xFFCDE0E6,
-0xFFD0E5EA,
-0xFFCCE1E6,
-0xFFD8E7EE,
-0xFFD3E0E8,
-0xFFD2E5EB,
-0xFFCFE2E6,
-0xFFDDEBEE,
-0xFFE7F2F6,
-0xFFE5F2F8,
-0xFFA6B7BF,
-0xFFCAE1E9,
-0xFFC4DFE8,
-0xFFC7E1EE,
-0xFFC8E3EE,
-0xFFC8E3EA,
-0xFFC0DBE2,
-0xFFC6E2ED,
-0xFFF2DDE4,
-0xFFCF5550,
-0xFFAD1F15,
-0xFFA44C48,
-0xFFFFDBDB,
-0xFFD5D3D6,
-0xFFD5E4E9,
-0xFFE4F1F7,
-0xFFEAF7FD,
-0xFFE9F4FA,
-0xFFE6F1F7,
-0xFFE3EDF6,
-0xFFDFE9F2,
-0xFFDCE9F1,
-0xFFDAE7EF,
-0xFFD6E4ED,
-0xFFD5E3EC,
-0xFFDDEAF3,
-0xFFE4F1FA,
-0xFFE2EFF8,
-0xFFDDE7F0,
-0xFFE0EBF1,
-0xFFE3ECF1,
-0xFFE6EFF6,
-0xFFE7F2F8,
-0xFFE4EDF6,
-0xFFDEE8F1,
-0xFFE0E9F2,
-0xFFE4EDF6,
-0xFFE4EDF6,
-0xFFEAF3FA,
-0xFFE9F0F6,
-0xFFE7EEF4,
-0xFFECF1F5,
-0xFFEDF2F6,
-0xFFEBF0F4,
-0xFFEBF0F3,
-0xFFE9EEF1,
-0xFFEAEFF2,
-0xFFEAEFF2,
-0xFFE8EDF0,
-0xFFE9EDF0,
-0xFFECF0F3,
-0xFFEEF2F5,
-0xFFEEF2F3,
-0xFFEBECEE,
-0xFFEEEFF1,
-0xFFF1F2F6,
-0xFFF0F1F5,
-0xFFEDEEF2,
-0xFFEAEBEF,
-0xFFE7EBEE,
-0xFFE6EBEF,
-0xFFE7EEF4,
-0xFFE1EAF1,
-0xFFDBE4ED,
-0xFFD7E1EA,
-0xFFD3E1EC,
-0xFFD2E3ED,
-0xFFD2E2EF,
-0xFFD0E2EE,
-0xFFCCDCE9,
-0xFFC7D8E2,
-0xFFC8D6DF,
-0xFFD6E3EC,
-0xFFE7F1FA,
-0xFFEDF6FD,
-0xFFEEF3F9,
-0xFFEDF2F6,
-0xFFEEF1F6,
-0xFFE9ECF1,
-0xFFE6E9EE,
-0xFFE8ECEF,
-0xFFECEDF2,
-0xFFEBECF0,
-0xFFEBECF0,
-0xFFECEDF1,
-0xFFEEEFF1,
-0xFFEFEFF1,
-0xFFF0F0F2,
-0xFFF1F1F3,
-0xFFEFEFF1,
-0xFFEFEFF1,
-0xFFF0EEF1,
-0xFFEFEDEE,
-0xFFF0EEF1,
-0xFFF1EFF2,
-0xFFECECEE,
-0xFFEBECF0,
-0xFFCBD0D4,
-0xFFDBE2E8,
-0xFFD8DFE7,
-0xFFD4DDE6,
-0xFFD0D8E3,
-0xFFCAD2DF,
-0xFFC2C9D9,
-0xFFBAC1D1,
-0xFFB6BDCD,
-0xFFB5BECD,
-0xFFBCC5D4,
-0xFFC3CCDB,
-0xFFC6D2DE,
-0xFFC6D2DE,
-0xFFC7D3DF,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFCAD6E2,
-0xFFCBD7E3,
-0xFFCBD7E3,
-0xFFCAD6E2,
-0xFFCBD7E3,
-0xFFCBD7E3,
-0xFFCCD8E4,
-0xFFCCD8E4,
-0xFFCCD8E4,
-0xFFCDD9E5,
-0xFFCDD9E5,
-0xFFCFD9E3,
-0xFFD0DAE4,
-0xFFD1DBE7,
-0xFFD2DCE8,
-0xFFD2DBEA,
-0xFFD2DBEA,
-0xFFD2DCE8,
-0xFFD2DCE6,
-0xFFD3DBE6,
-0xFFD3DCE5,
-0xFFD4DDE4,
-0xFFD5DEE5,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD6DEE9,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD7DDE9,
-0xFFD7DFEA,
-0xFFD9DFEB,
-0xFFD9DFEB,
-0xFFD9DFEB,
-0xFFD9DFEB,
-0xFFDBDFEA,
-0xFFD8DFE9,
-0xFFDADEE9,
-0xFFD8DFE9,
-0xFFDBDFEA,
-0xFFDCE0EB,
-0xFFDEE2ED,
-0xFFDDE4EC,
-0xFFDBE2EA,
-0xFFDAE3EA,
-0xFFDAE1E9,
-0xFFD9E2E9,
-0xFFDAE1E9,
-0xFFDAE3EA,
-0xFFDCE3EB,
-0xFFDDE4EC,
-0xFFDDE4EC,
-0xFFDDE4EC,
-0xFFDDE1EA,
-0xFFDBE2EA,
-0xFFDDE1EA,
-0xFFDCE3EB,
-0xFFDFE3EC,
-0xFFDEE5ED,
-0xFFDDE4EC,
-0xFFDEE7EE,
-0xFFDEE7EE,
-0xFFDCE5EC,
-0xFFDBE4EB,
-0xFFDBE4EB,
-0xFFDCE5EC,
-0xFFDDE6ED,
-0xFFDCE5EC,
-0xFFDDE6ED,
-0xFFDEE7EC,
-0xFFDFE8ED,
-0xFFDEE7EC,
-0xFFDDE6EB,
-0xFFDCE5EA,
-0xFFDCE5EA,
-0xFFDDE4EA,
-0xFFE0E8EB,
-0xFFDFE7EA,
-0xFFDEE6E9,
-0xFFDCE6E8,
-0xFFDDE7E9,
-0xFFDBE5E7,
-0xFFD0DADC,
-0xFFC3CED0,
-0xFFD5E0E2,
-0xFFBDC8CA,
-0xFFAAB5B7,
-0xFF3B4747,
-0xFF2F3B3B,
-0xFF475353,
-0xFF859393,
-0xFFDFEDEE,
-0xFFC9D7D8,
-0xFFCDDDDD,
-0xFF718181,
-0xFF778787,
-0xFFB0C0C0,
-0xFFA9B9B9,
-0xFF95A5A5,
-0xFFA6B6B6,
-0xFFA8B8B8,
-0xFFB5C3C3,
-0xFFC2D0D0,
-0xFFBCCBC8,
-0xFFBDCCC9,
-0xFFAEBDBA,
-0xFFA7B3B3,
-0xFF818C92,
-0xFF8E97A0,
-0xFF78828B,
-0xFF37414B,
-0xFF5E6872,
-0xFFEBF5FF,
-0xFFDAE4ED,
-0xFFE0EBF1,
-0xFFDDE6ED,
-0xFFDDE6EB,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDDE6ED,
-0xFFDCE7ED,
-0xFFDCE7ED,
-0xFFDDE6ED,
-0xFFDDE6EB,
-0xFFDDE6ED,
-0xFFDDE6EB,
-0xFFDCE5EC,
-0xFFDCE5EA,
-0xFFDDE6ED,
-0xFFDEE7EC,
-0xFFDDE6ED,
-0xFFDDE6EB,
-0xFFDDE6ED,
-0xFFDDE6EB,
-0xFFDDE6ED,
-0xFFDDE6EB,
-0xFFDDE6ED,
-0xFFDCE5EC,
-0xFFDCE5EC,
-0xFFDBE6EC,
-0xFFDBE6EC,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD8E5EB,
-0xFFD8E5EB,
-0xFFD7E6ED,
-0xFFD7E6ED,
-0xFFD7E6ED,
-0xFFD7E6ED,
-0xFFD9E6EE,
-0xFFD9E6EE,
-0xFFD9E6EF,
-0xFFD9E6EF,
-0xFFD8E5EE,
-0xFFD8E5EE,
-0xFFD8E6EF,
-0xFFD8E6EF,
-0xFFD7E5EE,
-0xFFD7E5EE,
-0xFFD6E4ED,
-0xFFD7E5EE,
-0xFFD7E5EE,
-0xFFD6E4ED,
-0xFFD6E4ED,
-0xFFD3E4EC,
-0xFFD3E4EC,
-0xFFD2E5EC,
-0xFFD2E5EC,
-0xFFD2E5EC,
-0xFFD2E4EE,
-0xFFD2E4EE,
-0xFFD1E3ED,
-0xFFD1E3ED,
-0xFFD0E2EC,
-0xFFCFE1EB,
-0xFFD0E2EC,
-0xFFD0E2EC,
-0xFFD0E3EA,
-0xFFCEE1E8,
-0xFFCEE1E8,
-0xFFCFE0E7,
-0xFFD1DEE4,
-0xFFD7E0E7,
-0xFFDCE3E9,
-0xFFE1E8EE,
-0xFFE4EDF2,
-0xFFE7F0F5,
-0xFFEAF2F5,
-0xFFEDF2F6,
-0xFFEAEFF3,
-0xFFE7EFF2,
-0xFFE7F1F3,
-0xFFE1EBED,
-0xFFE9ECF1,
-0xFFEAEDF2,
-0xFFE9F1F4,
-0xFFE6EEF1,
-0xFFE6EBEE,
-0xFFECF1F5,
-0xFFE8EFF7,
-0xFFAAB4BE,
-0xFFD1DFEA,
-0xFFCBDDE9,
-0xFFC8DEEB,
-0xFFC5DDE7,
-0xFFC9E2E6,
-0xFFCADFE2,
-0xFFCEDDE2,
-0xFFFFE1E1,
-0xFFA51F16,
-0xFFAB180E,
-0xFFC37C78,
-0xFFF2DDDC,
-0xFFE8E6E7,
-0xFFEBF3F5,
-0xFFF2F7FA,
-0xFFEDF2F5,
-0xFFEBEFF2,
-0xFFEDF1F4,
-0xFFEEF2F5,
-0xFFEBEFF2,
-0xFFEBF0F3,
-0xFFEAEFF2,
-0xFFE8EDF1,
-0xFFE7ECF0,
-0xFFE9EEF2,
-0xFFECF1F5,
-0xFFEEF1F6,
-0xFFECEFF4,
-0xFFEEF2F5,
-0xFFEEF2F5,
-0xFFEEF2F5,
-0xFFEBF0F3,
-0xFFEAEDF2,
-0xFFEAEFF3,
-0xFFEDF0F5,
-0xFFEFF2F7,
-0xFFEFF2F7,
-0xFFEFF2F7,
-0xFFF0F1F5,
-0xFFEFF0F4,
-0xFFF1F2F6,
-0xFFF1F2F4,
-0xFFF0F0F2,
-0xFFEDEEF0,
-0xFFEAEEEF,
-0xFFEAEEEF,
-0xFFECF0F1,
-0xFFEDF1F2,
-0xFFF0F1F3,
-0xFFF1F3F2,
-0xFFF0F2F1,
-0xFFEFF1F0,
-0xFFEFF1F0,
-0xFFEEF0EF,
-0xFFF1F2F4,
-0xFFF0F1F3,
-0xFFE7E8EA,
-0xFFE4E5E7,
-0xFFE9EAEC,
-0xFFEBEFF0,
-0xFFEBEFF2,
-0xFFE8EDF1,
-0xFFE6EBF1,
-0xFFE4EBF1,
-0xFFE4EDF6,
-0xFFE3EDF6,
-0xFFE1EBF5,
-0xFFDDEAF3,
-0xFFD3DDE6,
-0xFFCDD7E0,
-0xFFCED9DF,
-0xFFE2EBF2,
-0xFFE9F0F6,
-0xFFEDF2F6,
-0xFFEDEEF2,
-0xFFF0F1F5,
-0xFFEBEFF2,
-0xFFE9EDF0,
-0xFFE8ECEF,
-0xFFE8ECED,
-0xFFEAEEF1,
-0xFFEBEFF0,
-0xFFEBEFF0,
-0xFFECF0F1,
-0xFFEBEFF0,
-0xFFEFF0F2,
-0xFFEDEEF0,
-0xFFEBECEE,
-0xFFE8ECEF,
-0xFFE7EBEE,
-0xFFE8ECEF,
-0xFFECEDEF,
-0xFFEBEAEF,
-0xFFEDECF1,
-0xFFE7E8EC,
-0xFFE7EAEF,
-0xFFC6CBCF,
-0xFFD9E0E6,
-0xFFD5DCE4,
-0xFFD7DEE8,
-0xFFD9DFEB,
-0xFFD5DBE7,
-0xFFCED6E3,
-0xFFC6CDDD,
-0xFFBBC4D3,
-0xFFB3BCCD,
-0xFFB5BECF,
-0xFFBAC6D6,
-0xFFC5D1DD,
-0xFFC5D1DD,
-0xFFC5D1DD,
-0xFFC6D2DE,
-0xFFC7D3DF,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFCAD6E2,
-0xFFCAD6E2,
-0xFFCAD6E2,
-0xFFCBD7E3,
-0xFFCBD7E3,
-0xFFCCD8E4,
-0xFFCED8E2,
-0xFFCED8E2,
-0xFFCFD9E5,
-0xFFD0DAE6,
-0xFFD1DAE9,
-0xFFD1DAE9,
-0xFFD1DBE7,
-0xFFD2DCE8,
-0xFFD2DAE5,
-0xFFD3DCE5,
-0xFFD4DDE6,
-0xFFD5DEE5,
-0xFFD5DEE7,
-0xFFD5DEE7,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD6DCE8,
-0xFFD6DCE8,
-0xFFD7DDE9,
-0xFFD8DEEA,
-0xFFD9DFEB,
-0xFFD9DFEB,
-0xFFDBDFEB,
-0xFFDBDFEB,
-0xFFDADEE9,
-0xFFDADEE9,
-0xFFD9DDE8,
-0xFFDADEE9,
-0xFFDADEE9,
-0xFFDCE0EB,
-0xFFDDE1EC,
-0xFFDEE2ED,
-0xFFDBE2EA,
-0xFFDAE1E9,
-0xFFDAE1E9,
-0xFFDAE1E9,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDEE2EB,
-0xFFDEE2EB,
-0xFFDDE1EA,
-0xFFDDE1EA,
-0xFFDDE1EA,
-0xFFDEE2EB,
-0xFFDFE3EC,
-0xFFDEE5ED,
-0xFFDEE5ED,
-0xFFDDE6ED,
-0xFFDDE6ED,
-0xFFDBE4EB,
-0xFFDAE3EA,
-0xFFDAE3EA,
-0xFFDCE5EC,
-0xFFDEE7EE,
-0xFFDDE6ED,
-0xFFDEE7EE,
-0xFFDFE8ED,
-0xFFDFE8ED,
-0xFFDEE7EC,
-0xFFDDE6EB,
-0xFFDCE5EA,
-0xFFDBE4E9,
-0xFFDEE6E9,
-0xFFDEE6E9,
-0xFFDDE5E8,
-0xFFE0E8EB,
-0xFFDFE9EB,
-0xFFDFE9EB,
-0xFFDEE8EA,
-0xFFD5E0E2,
-0xFFB2BDBF,
-0xFF8E9C9D,
-0xFFA5B0B2,
-0xFF808E8F,
-0xFFB2BEBE,
-0xFFEEFAFA,
-0xFFDCE8E8,
-0xFFD5E3E3,
-0xFFB6C4C5,
-0xFFBDCDCD,
-0xFF99A9A9,
-0xFF95A5A5,
-0xFF748484,
-0xFF6B7B7B,
-0xFF607070,
-0xFF99A7A8,
-0xFFC0CECF,
-0xFFD4DFE1,
-0xFFC7D2D4,
-0xFFC3CED0,
-0xFFCBD5D6,
-0xFFD6E0E1,
-0xFFA5AFB0,
-0xFF697375,
-0xFFABB4BB,
-0xFFD0D9E2,
-0xFF8A939C,
-0xFF232C35,
-0xFF434C55,
-0xFFEEF7FF,
-0xFFDEE7EE,
-0xFFDDE4EA,
-0xFFDFE6EC,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE1E6EC,
-0xFFDFE6EC,
-0xFFDEE7EE,
-0xFFDEE7EC,
-0xFFDEE5EB,
-0xFFDFE6EC,
-0xFFDFE6EC,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDFE6EC,
-0xFFE0E7ED,
-0xFFDFE6EC,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDFE6EC,
-0xFFDFE6EC,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDDE7E9,
-0xFFDDE6EB,
-0xFFDCE7EB,
-0xFFDDE6EB,
-0xFFDCE7EB,
-0xFFDDE6EB,
-0xFFDCE7EB,
-0xFFDEE7EC,
-0xFFDCE7EB,
-0xFFDDE6EB,
-0xFFDCE7EB,
-0xFFDCE7EB,
-0xFFDCE7EB,
-0xFFDCE7ED,
-0xFFDCE7EB,
-0xFFDCE5EC,
-0xFFDDE6ED,
-0xFFDDE6ED,
-0xFFDEE7EE,
-0xFFDEE7EE,
-0xFFDDE6ED,
-0xFFDBE6EC,
-0xFFDBE6EC,
-0xFFDCE7ED,
-0xFFDBE6EC,
-0xFFDBE6EC,
-0xFFDCE7ED,
-0xFFDCE6EF,
-0xFFDCE7ED,
-0xFFDCE6EF,
-0xFFD9E6EC,
-0xFFD9E6EC,
-0xFFD8E7EC,
-0xFFD8E7EC,
-0xFFD8E7EC,
-0xFFD8E7EE,
-0xFFD8E7EE,
-0xFFD8E7EE,
-0xFFD8E7EE,
-0xFFD8E7EE,
-0xFFD7E6ED,
-0xFFD7E6ED,
-0xFFD7E6ED,
-0xFFD6E5EC,
-0xFFD5E4E9,
-0xFFD6E5EA,
-0xFFD9E7EA,
-0xFFE3EBEE,
-0xFFE7EBEE,
-0xFFEDECF1,
-0xFFEFEFF1,
-0xFFEEF2F3,
-0xFFEFF3F4,
-0xFFF2F2F4,
-0xFFF1F1F1,
-0xFFF3F3F5,
-0xFFF3F5F4,
-0xFFF1F5F6,
-0xFFEEF2F1,
-0xFFF2F0F3,
-0xFFF4F2F3,
-0xFFF3F4F6,
-0xFFF1F2F4,
-0xFFEFEFF1,
-0xFFEEEFF4,
-0xFFE9ECF3,
-0xFFB5B9C4,
-0xFFE4EAF6,
-0xFFDDE7F3,
-0xFFD3E3F0,
-0xFFCBDDE7,
-0xFFCBDEE2,
-0xFFD3DFDF,
-0xFFE0DCD9,
-0xFFF4BDB8,
-0xFFA41409,
-0xFF9C0900,
-0xFFEDB3B1,
-0xFFF1E7E6,
-0xFFF3F2F0,
-0xFFF2F4F3,
-0xFFF1F3F2,
-0xFFF2F2F2,
-0xFFF4F4F4,
-0xFFF4F4F4,
-0xFFF3F1F2,
-0xFFF0F0F0,
-0xFFF0F0F0,
-0xFFEFF1F0,
-0xFFEFEFEF,
-0xFFEEF0EF,
-0xFFEEEEF0,
-0xFFEEEEEE,
-0xFFF0F0F2,
-0xFFF2F2F4,
-0xFFF1F1F3,
-0xFFF1F1F3,
-0xFFF1F1F3,
-0xFFF0F1F3,
-0xFFEFF0F2,
-0xFFEFF0F2,
-0xFFEFF0F4,
-0xFFF0F1F3,
-0xFFF0F1F5,
-0xFFEFF0F2,
-0xFFF2F2F4,
-0xFFF4F4F6,
-0xFFF3F3F5,
-0xFFF2F2F4,
-0xFFF1EFF2,
-0xFFEEEEEE,
-0xFFE9EBEA,
-0xFFE7EBEA,
-0xFFE8ECEB,
-0xFFECF0EF,
-0xFFF1F3F2,
-0xFFF1F3F2,
-0xFFF0F2EF,
-0xFFEFF1EE,
-0xFFF2F4F1,
-0xFFEEF0ED,
-0xFFF0F2F1,
-0xFFEFF1F0,
-0xFFE3E5E4,
-0xFFE1E3E2,
-0xFFE9EBEA,
-0xFFEEEFF1,
-0xFFEBECEE,
-0xFFEBECF0,
-0xFFECEDF1,
-0xFFECEFF4,
-0xFFECF1F7,
-0xFFEAF1F7,
-0xFFE8EFF7,
-0xFFE6EDF5,
-0xFFDBE2EA,
-0xFFD9E0E6,
-0xFFDFE6EC,
-0xFFEDF2F6,
-0xFFECEFF4,
-0xFFECEDF1,
-0xFFEEEEF0,
-0xFFF0F1F3,
-0xFFE8E9EB,
-0xFFE8ECED,
-0xFFE8ECED,
-0xFFE7EBEC,
-0xFFE8ECED,
-0xFFEAEEEF,
-0xFFECF0F1,
-0xFFECF0F1,
-0xFFE8ECED,
-0xFFEAEEEF,
-0xFFE7EBEC,
-0xFFE3E8EB,
-0xFFE4E9EC,
-0xFFE2E7EA,
-0xFFE2E7EB,
-0xFFE6EBEE,
-0xFFEAEBF0,
-0xFFE7E8ED,
-0xFFE0E3E8,
-0xFFE2E7EB,
-0xFFC7CCD2,
-0xFFD3DAE0,
-0xFFCFD6DC,
-0xFFD3DAE2,
-0xFFD2D9E3,
-0xFFD0D6E2,
-0xFFCCD2DE,
-0xFFC4CCD9,
-0xFFB9C2D1,
-0xFFB3BCCD,
-0xFFB3BFCF,
-0xFFB9C5D5,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC4D2DF,
-0xFFC5D3E0,
-0xFFC5D3E0,
-0xFFC5D3E0,
-0xFFC5D3E0,
-0xFFC5D3DE,
-0xFFC6D4DF,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFCAD6E2,
-0xFFCAD6E2,
-0xFFCDD7E1,
-0xFFCED8E2,
-0xFFCFD9E5,
-0xFFD0DAE6,
-0xFFD0D9E8,
-0xFFD0D9E8,
-0xFFD0DAE6,
-0xFFD1DBE7,
-0xFFD1DBE5,
-0xFFD1DBE4,
-0xFFD2DCE5,
-0xFFD3DDE6,
-0xFFD3DDE7,
-0xFFD3DDE7,
-0xFFD3DDE9,
-0xFFD4DCE9,
-0xFFD6DCEA,
-0xFFD6DCEA,
-0xFFD7DDEB,
-0xFFD7DDEB,
-0xFFD8DEEA,
-0xFFD8DEEA,
-0xFFD8DEEA,
-0xFFD8DEEA,
-0xFFD7DDE9,
-0xFFD8DEEA,
-0xFFD8DFE9,
-0xFFD8DFE9,
-0xFFD9E0EA,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFDBE2EC,
-0xFFDBE2EC,
-0xFFDBE2EC,
-0xFFDBE2EC,
-0xFFDCE3ED,
-0xFFDCE3ED,
-0xFFDCE3ED,
-0xFFDBE2EC,
-0xFFDCE0E9,
-0xFFDCE0E9,
-0xFFDCE0E9,
-0xFFDDE1EA,
-0xFFDEE2EB,
-0xFFDFE3EC,
-0xFFDFE3EC,
-0xFFDEE5ED,
-0xFFDDE4EC,
-0xFFDCE5EC,
-0xFFDCE5EC,
-0xFFDBE4EB,
-0xFFDBE4EB,
-0xFFDBE4EB,
-0xFFDCE5EA,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDCE5EA,
-0xFFDCE5EA,
-0xFFDBE4E9,
-0xFFDCE5EA,
-0xFFDEE5EB,
-0xFFDFE6EC,
-0xFFDFE7EA,
-0xFFE1E9EC,
-0xFFE0EAEC,
-0xFFDFE9EB,
-0xFFDEE9EB,
-0xFFD7E2E4,
-0xFFCAD8DB,
-0xFF657477,
-0xFF707E81,
-0xFFA7B7B7,
-0xFFACBABA,
-0xFFAAB8B8,
-0xFFAFBEBB,
-0xFFB6C5C2,
-0xFFB5C8C6,
-0xFF99ACAA,
-0xFF7C8F8D,
-0xFF324543,
-0xFF819191,
-0xFF9BABAB,
-0xFFCEDCDF,
-0xFFB6C4C7,
-0xFFC1CCD0,
-0xFFCCD5DA,
-0xFFDDE4EA,
-0xFFB0B7BD,
-0xFF676C72,
-0xFF60656B,
-0xFF464950,
-0xFF1D2228,
-0xFFBABFC5,
-0xFFE9F0F8,
-0xFFF9FFFF,
-0xFF4F565E,
-0xFF20272F,
-0xFFF4FBFF,
-0xFFE0E7EF,
-0xFFE3E8EE,
-0xFFE2E7EB,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE2E7EA,
-0xFFE2E7EB,
-0xFFE0E8EB,
-0xFFDFE8ED,
-0xFFDFE8ED,
-0xFFDFE6EC,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE0E8EB,
-0xFFE0E8EB,
-0xFFE0E8EA,
-0xFFE0E8EB,
-0xFFDEE8EA,
-0xFFDFE7EA,
-0xFFDEE8EA,
-0xFFDFE7EA,
-0xFFDEE8EA,
-0xFFE1E9EC,
-0xFFE0EAEC,
-0xFFE1E9EC,
-0xFFDFE9EB,
-0xFFDFE9EB,
-0xFFDFE9EB,
-0xFFDFE8ED,
-0xFFE0EAEC,
-0xFFDFE6EC,
-0xFFDFE6EC,
-0xFFDFE6EC,
-0xFFDFE6EC,
-0xFFDFE6EC,
-0xFFE0E7ED,
-0xFFE0E7ED,
-0xFFE0E7ED,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDEE5EB,
-0xFFDFE6EC,
-0xFFDEE7EE,
-0xFFDEE7EC,
-0xFFDEE7EE,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDDE6EB,
-0xFFDDE6ED,
-0xFFDDE6ED,
-0xFFDEE7EE,
-0xFFDEE7EE,
-0xFFDDE6ED,
-0xFFDDE6ED,
-0xFFDDE6ED,
-0xFFDCE5EA,
-0xFFDBE4E9,
-0xFFDCE5EA,
-0xFFE0E9EE,
-0xFFE4EEF0,
-0xFFECF1F4,
-0xFFEFF0F2,
-0xFFF2F0F3,
-0xFFF2F0F1,
-0xFFF0F2F1,
-0xFFEEF2F1,
-0xFFF0F0F0,
-0xFFF1F0EE,
-0xFFF2F0F1,
-0xFFF2F2F0,
-0xFFEFF1F0,
-0xFFF1F3F0,
-0xFFF0F0F0,
-0xFFF2F1EF,
-0xFFEFF1F0,
-0xFFF0F0F0,
-0xFFF2F0F3,
-0xFFF0EEF3,
-0xFFEDEEF3,
-0xFFC1C1C9,
-0xFFF7F5FF,
-0xFFEFF1FE,
-0xFFE5EDF8,
-0xFFDDEAF2,
-0xFFDCEAEB,
-0xFFE6E5E1,
-0xFFFFE5DB,
-0xFFD18275,
-0xFFAC150A,
-0xFF9C110A,
-0xFFFFDFE0,
-0xFFF2F0F3,
-0xFFF0F0F0,
-0xFFF0F2EF,
-0xFFEFEFED,
-0xFFF1F0EE,
-0xFFF4F3F1,
-0xFFF2F1EF,
-0xFFF4F0EF,
-0xFFF6F5F3,
-0xFFF1F0EE,
-0xFFEDEDEB,
-0xFFEDECEA,
-0xFFEFEFED,
-0xFFF4F2F3,
-0xFFF4F3F1,
-0xFFF3F1F2,
-0xFFF3F1F2,
-0xFFF3F1F2,
-0xFFF2F0F1,
-0xFFF3F1F2,
-0xFFF4F4F4,
-0xFFF4F4F4,
-0xFFF1F1F1,
-0xFFF1F1F3,
-0xFFF2F2F2,
-0xFFF0F1F3,
-0xFFEFF0F2,
-0xFFF1F2F4,
-0xFFF2F3F5,
-0xFFEDEEF2,
-0xFFE9EAEE,
-0xFFE8E7EC,
-0xFFE7E7E9,
-0xFFE5E6E8,
-0xFFE6EAEB,
-0xFFE9EDEE,
-0xFFECF0F1,
-0xFFECF0EF,
-0xFFEBEFEE,
-0xFFEFF1F0,
-0xFFF1F3F2,
-0xFFF1F3F2,
-0xFFEDEFEE,
-0xFFF1F3F2,
-0xFFF1F3F2,
-0xFFE7E8EA,
-0xFFE3E4E6,
-0xFFE4E8E9,
-0xFFE7E8EA,
-0xFFEBEBED,
-0xFFECECEE,
-0xFFEEEEF0,
-0xFFEEEFF3,
-0xFFEFF0F4,
-0xFFECEFF4,
-0xFFEAEDF4,
-0xFFE8EDF3,
-0xFFE4E9EF,
-0xFFE5EAEE,
-0xFFECF1F5,
-0xFFEDF1F4,
-0xFFEAEEF1,
-0xFFE9EAEE,
-0xFFEEEEF0,
-0xFFEAEBED,
-0xFFEAEBED,
-0xFFEAEEEF,
-0xFFEAEEEF,
-0xFFE8ECED,
-0xFFE8ECED,
-0xFFEAEEEF,
-0xFFEBEFF0,
-0xFFE9EDEE,
-0xFFE6EAED,
-0xFFE8ECEF,
-0xFFE5EAED,
-0xFFE3E8EC,
-0xFFE4E9ED,
-0xFFE0E8EB,
-0xFFDDE4EA,
-0xFFE1E6EA,
-0xFFE0E3EA,
-0xFFD9DCE3,
-0xFFD7DAE1,
-0xFFD6DBE1,
-0xFFC5CACE,
-0xFFC7CCD0,
-0xFFCED3D7,
-0xFFD4D9DF,
-0xFFD5DAE0,
-0xFFD5DCE4,
-0xFFD3D9E5,
-0xFFCAD2DF,
-0xFFC1CAD9,
-0xFFBDC6D5,
-0xFFBAC6D6,
-0xFFB9C6D6,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC4D2DF,
-0xFFC4D2DF,
-0xFFC4D2DF,
-0xFFC4D2DF,
-0xFFC5D3DE,
-0xFFC6D4DF,
-0xFFC8D4E0,
-0xFFC8D4E0,
-0xFFC8D4E0,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFCDD7E1,
-0xFFCED8E2,
-0xFFCED8E4,
-0xFFCED8E4,
-0xFFCED7E6,
-0xFFCED7E6,
-0xFFCFD9E5,
-0xFFCFD9E5,
-0xFFD0DAE6,
-0xFFD0DAE4,
-0xFFD1DBE5,
-0xFFD1DBE4,
-0xFFD2DCE6,
-0xFFD2DCE6,
-0xFFD2DCE8,
-0xFFD3DDE9,
-0xFFD4DCE9,
-0xFFD4DCE9,
-0xFFD4DCE9,
-0xFFD5DDEA,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFD6DEE9,
-0xFFD7DFEA,
-0xFFD7E0E9,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD8E1EA,
-0xFFD9E2EB,
-0xFFD9E2EB,
-0xFFDAE1EB,
-0xFFDAE3EC,
-0xFFDBE2EC,
-0xFFDAE3EC,
-0xFFDAE1EB,
-0xFFD8DFE9,
-0xFFD8DFE7,
-0xFFD9E0E8,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDDE4EC,
-0xFFDDE4EC,
-0xFFDBE2EA,
-0xFFDBE4EB,
-0xFFDBE4EB,
-0xFFDCE5EC,
-0xFFDCE5EC,
-0xFFDBE4EB,
-0xFFDBE4E9,
-0xFFDCE5EA,
-0xFFDEE7EC,
-0xFFDEE7EC,
-0xFFDDE6EB,
-0xFFDCE5EA,
-0xFFDBE4E9,
-0xFFDAE3E8,
-0xFFDBE4E9,
-0xFFDCE5EA,
-0xFFDEE5EB,
-0xFFE2E9EF,
-0xFFE2EAED,
-0xFFE0E8EB,
-0xFFDCE6E8,
-0xFFDDE7E9,
-0xFFDBE6E8,
-0xFFD0DEDF,
-0xFFC0CFD2,
-0xFFC2D1D4,
-0xFFC0CFD2,
-0xFF98A8A8,
-0xFF879797,
-0xFF92A2A1,
-0xFFA3B2AF,
-0xFFA3B3B0,
-0xFFA7B7B4,
-0xFF9CACAB,
-0xFF869695,
-0xFFC1D1D0,
-0xFF9DABAC,
-0xFF9BA9AA,
-0xFFA8B6B9,
-0xFFC0CBD1,
-0xFFB2BBC2,
-0xFF868F98,
-0xFF5A616B,
-0xFF383C47,
-0xFF3C404B,
-0xFF666874,
-0xFF6C6E7A,
-0xFF585B64,
-0xFF82868F,
-0xFFECF1F7,
-0xFFE9F0F8,
-0xFF80878F,
-0xFF262D35,
-0xFFF7FEFF,
-0xFFE2E7ED,
-0xFFDEE3E7,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE0E7ED,
-0xFFE0E7ED,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE0E8EA,
-0xFFE0E8EA,
-0xFFE0E8EA,
-0xFFE0E8EA,
-0xFFE0E8EB,
-0xFFE0E8EB,
-0xFFE0E8EB,
-0xFFE0E8EB,
-0xFFE2E7EB,
-0xFFE0E8EB,
-0xFFE1E6EA,
-0xFFDFE7EA,
-0xFFE1E6EA,
-0xFFDFE7EA,
-0xFFE1E6EA,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE3E8EC,
-0xFFE5EAEE,
-0xFFE6EBEF,
-0xFFE3E8EC,
-0xFFE4E9ED,
-0xFFE5E8ED,
-0xFFE3E8EC,
-0xFFE3E8EE,
-0xFFE3E8EC,
-0xFFE3E8EE,
-0xFFE4E9ED,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E8EE,
-0xFFE3E8EC,
-0xFFE0E5EB,
-0xFFE1E6EA,
-0xFFE1E6EC,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE3E8EC,
-0xFFE8EDF1,
-0xFFEDF2F5,
-0xFFEDF1F2,
-0xFFEFF0F2,
-0xFFF2F0F3,
-0xFFF3F1F2,
-0xFFF2F4F3,
-0xFFF2F4F1,
-0xFFF4F4F4,
-0xFFF5F4F2,
-0xFFF4F2F3,
-0xFFF1F1EF,
-0xFFEFF1F0,
-0xFFF1F3F2,
-0xFFF2F2F2,
-0xFFF1F1F1,
-0xFFF0F0F0,
-0xFFF3F3F3,
-0xFFF1EFF2,
-0xFFEFEFF1,
-0xFFEEEFF3,
-0xFFC0C1C6,
-0xFFF3F1FC,
-0xFFEDEBF8,
-0xFFE4EBF5,
-0xFFE3ECF3,
-0xFFE4EEEF,
-0xFFF6ECE3,
-0xFFFFECDB,
-0xFFB34E3A,
-0xFFA40C00,
-0xFFB4302B,
-0xFFFFEBED,
-0xFFE8EBF0,
-0xFFEDF1F2,
-0xFFF2F4F3,
-0xFFEFEFEF,
-0xFFECECEC,
-0xFFEFEDEE,
-0xFFEFEDEE,
-0xFFEFEDEE,
-0xFFF2F0F1,
-0xFFF0EEEF,
-0xFFEDEDED,
-0xFFEEEEEE,
-0xFFF1F1F1,
-0xFFF3F3F3,
-0xFFF2F2F2,
-0xFFF2F0F1,
-0xFFF2F0F1,
-0xFFF3F1F2,
-0xFFF2F0F1,
-0xFFF2F0F1,
-0xFFF3F3F3,
-0xFFF2F2F2,
-0xFFF1F1F1,
-0xFFF1F1F1,
-0xFFF2F4F3,
-0xFFF0F2F1,
-0xFFEEF2F1,
-0xFFEEEFF1,
-0xFFE8ECEF,
-0xFFE5E6EA,
-0xFFE0E1E6,
-0xFFDFE0E5,
-0xFFE0E1E5,
-0xFFE6E7EB,
-0xFFE5E9EA,
-0xFFE7EBEE,
-0xFFE9EDEE,
-0xFFECEDEF,
-0xFFEDEFEE,
-0xFFEDEEF0,
-0xFFEDEFEE,
-0xFFEDEEF0,
-0xFFEBEDEC,
-0xFFEEEFF1,
-0xFFEFF0F2,
-0xFFE9EAEC,
-0xFFE5E6E8,
-0xFFE7E8EC,
-0xFFE6E7E9,
-0xFFEBEBED,
-0xFFEDEBEE,
-0xFFEDEDEF,
-0xFFEEEEF0,
-0xFFEDEEF2,
-0xFFECEDF1,
-0xFFE9ECF1,
-0xFFE9ECF1,
-0xFFE9ECF1,
-0xFFE9ECF1,
-0xFFECF0F3,
-0xFFE7EBEE,
-0xFFEAEBEF,
-0xFFE7E8EC,
-0xFFEAEAEC,
-0xFFE3E4E6,
-0xFFEAEBED,
-0xFFEAEEEF,
-0xFFEAEEF1,
-0xFFE8ECED,
-0xFFE8ECED,
-0xFFE9EDEE,
-0xFFEBECEE,
-0xFFE7EBEC,
-0xFFE8E9ED,
-0xFFE5E9EC,
-0xFFE1E4E9,
-0xFFDDE2E6,
-0xFFDDE2E8,
-0xFFDCE1E7,
-0xFFDCE1E7,
-0xFFDDE2E8,
-0xFFDCE1E7,
-0xFFDBDEE5,
-0xFFDCE1E7,
-0xFFDBE0E4,
-0xFFD0D5D9,
-0xFFC6CBCF,
-0xFFD6DBDF,
-0xFFDBE0E4,
-0xFFD5DADE,
-0xFFD7DCE2,
-0xFFD5D9E4,
-0xFFCCD2DE,
-0xFFC4CCD9,
-0xFFBCC8D6,
-0xFFB6C2D2,
-0xFFAFBCCC,
-0xFFC2D0DD,
-0xFFC2D0DD,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC4D2DD,
-0xFFC5D3DE,
-0xFFC7D3DF,
-0xFFC7D3DF,
-0xFFC8D5DE,
-0xFFC9D6DF,
-0xFFC9D6DF,
-0xFFC9D6DF,
-0xFFC9D6DF,
-0xFFC9D6DF,
-0xFFCCD6E0,
-0xFFCCD6E0,
-0xFFCCD6E2,
-0xFFCCD6E2,
-0xFFCDD6E5,
-0xFFCDD6E5,
-0xFFCCD8E6,
-0xFFCCD8E4,
-0xFFCDD9E5,
-0xFFCDDAE3,
-0xFFCEDBE4,
-0xFFCEDBE4,
-0xFFCEDAE6,
-0xFFCEDAE6,
-0xFFCFDBE9,
-0xFFD0DCE8,
-0xFFD2DCE8,
-0xFFD2DCE6,
-0xFFD2DCE6,
-0xFFD2DCE6,
-0xFFD2DCE6,
-0xFFD3DDE7,
-0xFFD3DDE7,
-0xFFD4DEE8,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD5DFE8,
-0xFFD5E0E6,
-0xFFD6E1E7,
-0xFFD6E1E7,
-0xFFD6E1E7,
-0xFFD6E0E9,
-0xFFD6E0E9,
-0xFFD7E0E9,
-0xFFD7E1EA,
-0xFFD8E1EA,
-0xFFD7E1EA,
-0xFFD6DFE8,
-0xFFD5DEE7,
-0xFFD6DFE6,
-0xFFD7E0E7,
-0xFFD8E1E8,
-0xFFD9E2E9,
-0xFFDAE3EA,
-0xFFDAE3EA,
-0xFFDBE4EB,
-0xFFDBE4EB,
-0xFFDBE2E8,
-0xFFDBE2E8,
-0xFFDCE3E9,
-0xFFDCE3E9,
-0xFFDBE2E8,
-0xFFDAE1E7,
-0xFFDBE2E8,
-0xFFDEE5EB,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDCE3E9,
-0xFFDBE2E8,
-0xFFDBE2E8,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFDBE2E8,
-0xFFDEE5EB,
-0xFFDDE4EA,
-0xFFDDE4EA,
-0xFFDBE5E7,
-0xFFDDE7E9,
-0xFFDEE9ED,
-0xFFD5E3E6,
-0xFFABBABD,
-0xFF92A4A6,
-0xFF76888A,
-0xFF758787,
-0xFF91A3A3,
-0xFF99ACAA,
-0xFFAEBEBB,
-0xFFCAD9D6,
-0xFFC3CFCD,
-0xFFA7B3B1,
-0xFF9EAAA8,
-0xFF96A2A2,
-0xFF949FA1,
-0xFF939EA0,
-0xFF8C979B,
-0xFF747D84,
-0xFF757E87,
-0xFF808893,
-0xFF818994,
-0xFF8C929E,
-0xFF8F95A3,
-0xFF828594,
-0xFF8B8E9D,
-0xFF696D79,
-0xFF5F636C,
-0xFFF3F8FE,
-0xFFE7ECF2,
-0xFFCDD2D8,
-0xFF72777D,
-0xFFEBF0F6,
-0xFFE3E6ED,
-0xFFE8EBF0,
-0xFFE6E7EB,
-0xFFE6E7EB,
-0xFFE6E7E9,
-0xFFE4E8E9,
-0xFFE3E8EB,
-0xFFE3E8EC,
-0xFFE1E8EE,
-0xFFE1E8EE,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE4E9ED,
-0xFFE4E9ED,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE4E7EC,
-0xFFE3E8EC,
-0xFFE4E7EC,
-0xFFE2E7EB,
-0xFFE3E6EB,
-0xFFE3E8EC,
-0xFFE4E7EC,
-0xFFE4E7EC,
-0xFFE4E8EB,
-0xFFE3E7EA,
-0xFFE2E6E9,
-0xFFE3E7EA,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE9EDF0,
-0xFFEAEEF1,
-0xFFE9EDF0,
-0xFFEAEEF1,
-0xFFEBECF0,
-0xFFE8ECEF,
-0xFFE6E9EE,
-0xFFE6EAED,
-0xFFE7EAEF,
-0xFFE8ECEF,
-0xFFE3E7EA,
-0xFFE4E8EB,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE4E7EC,
-0xFFE4E8EB,
-0xFFE5E8ED,
-0xFFE5E9EC,
-0xFFE6E9EE,
-0xFFE8ECEF,
-0xFFEBECF0,
-0xFFECEDF1,
-0xFFEFF0F4,
-0xFFF2F3F7,
-0xFFEFF3F6,
-0xFFF1F2F6,
-0xFFF2F0F5,
-0xFFF2F0F3,
-0xFFEFF0F2,
-0xFFEEF0EF,
-0xFFEFEFF1,
-0xFFF0EEEF,
-0xFFF4EFF3,
-0xFFEFEDEE,
-0xFFEEEFF1,
-0xFFF0F1F3,
-0xFFF3F3F5,
-0xFFF1F1F3,
-0xFFF1F1F3,
-0xFFF1F2F4,
-0xFFEBEFF0,
-0xFFEBF1EF,
-0xFFE8F1F0,
-0xFFB4BCBE,
-0xFFE8E8F0,
-0xFFE1E4ED,
-0xFFDEE5ED,
-0xFFDEE7EC,
-0xFFDEE8E9,
-0xFFF6E4DA,
-0xFFFFDAC1,
-0xFF9B280D,
-0xFFA61206,
-0xFFD45A57,
-0xFFFFECF1,
-0xFFE5EAF0,
-0xFFE7ECEF,
-0xFFECF2F2,
-0xFFECF0F1,
-0xFFEDEEF0,
-0xFFF2F2F4,
-0xFFF0F0F2,
-0xFFEBEBED,
-0xFFECEDEF,
-0xFFEEEFF1,
-0xFFEFF0F2,
-0xFFF1F2F4,
-0xFFF2F3F5,
-0xFFF1F2F4,
-0xFFF0F1F3,
-0xFFF1F1F3,
-0xFFF2F2F4,
-0xFFF2F2F4,
-0xFFF2F2F4,
-0xFFF2F2F2,
-0xFFF2F2F2,
-0xFFF2F2F2,
-0xFFF1F3F2,
-0xFFEFF1F0,
-0xFFECF0EF,
-0xFFECF0EF,
-0xFFECF2F0,
-0xFFE7EBEC,
-0xFFE0E5E8,
-0xFFE0E3E8,
-0xFFDDE0E7,
-0xFFDBDEE5,
-0xFFDEE1E8,
-0xFFE5E6EB,
-0xFFE6E7EB,
-0xFFE7E8ED,
-0xFFE8E9ED,
-0xFFECEBF0,
-0xFFEEEEF0,
-0xFFECEBF0,
-0xFFE8E8EA,
-0xFFEBEAEF,
-0xFFEBEBED,
-0xFFECEBF0,
-0xFFEAE9EE,
-0xFFE7E6EB,
-0xFFE6E7EB,
-0xFFE9EAEF,
-0xFFECEDF1,
-0xFFEDEDEF,
-0xFFECECEE,
-0xFFEBEBED,
-0xFFEBEBED,
-0xFFEBECEE,
-0xFFEBECEE,
-0xFFE8ECEF,
-0xFFE8ECEF,
-0xFFE9EDF0,
-0xFFE7EBEE,
-0xFFE6EAED,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE4E8EB,
-0xFFE4E5E9,
-0xFFE5E6EA,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFE9EAEF,
-0xFFE8E9ED,
-0xFFE9EAEE,
-0xFFE9EAEE,
-0xFFE8E7EC,
-0xFFE4E5E9,
-0xFFE3E2E8,
-0xFFE0E1E6,
-0xFFDDDEE3,
-0xFFD9DCE1,
-0xFFD6D9E0,
-0xFFD7DAE1,
-0xFFD9DCE5,
-0xFFD8DCE5,
-0xFFD5D9E2,
-0xFFD9DEE4,
-0xFFD9DEE4,
-0xFFD9DEE2,
-0xFFD2D7DB,
-0xFFC3C8CB,
-0xFFD9DDE0,
-0xFFD8DCDF,
-0xFFD6DADD,
-0xFFD4D7DC,
-0xFFCED2DB,
-0xFFC6CDD7,
-0xFFC2CAD7,
-0xFFBECAD8,
-0xFFBCC8D8,
-0xFFB8C5D5,
-0xFFBECEDB,
-0xFFBFCFDC,
-0xFFC2D0DD,
-0xFFC3D1DE,
-0xFFC2D0DD,
-0xFFC2D0DD,
-0xFFC4D2DD,
-0xFFC5D3DE,
-0xFFC7D3DF,
-0xFFC8D4E0,
-0xFFC9D5E1,
-0xFFCAD6E2,
-0xFFCAD6E2,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFC9D6DF,
-0xFFCCD6E0,
-0xFFCBD5DF,
-0xFFCBD5E1,
-0xFFCCD6E2,
-0xFFCED7E6,
-0xFFCFD8E7,
-0xFFCDD9E7,
-0xFFCCD8E6,
-0xFFCDD9E7,
-0xFFCDD9E5,
-0xFFCDD9E5,
-0xFFCDDAE3,
-0xFFCDDAE3,
-0xFFCDD9E5,
-0xFFCFDBE7,
-0xFFD0DCE8,
-0xFFCFDCE5,
-0xFFCFDCE5,
-0xFFCEDBE4,
-0xFFCEDBE4,
-0xFFCFDCE5,
-0xFFD0DDE6,
-0xFFD1DEE7,
-0xFFD2DFE8,
-0xFFD4DEE7,
-0xFFD1DEE6,
-0xFFD3DDE6,
-0xFFD3DDE6,
-0xFFD3DEE4,
-0xFFD4DFE5,
-0xFFD5E0E6,
-0xFFD5E0E6,
-0xFFD6E0E9,
-0xFFD6E0E9,
-0xFFD5DFE8,
-0xFFD6E0E9,
-0xFFD7E1EA,
-0xFFD7E1EA,
-0xFFD5DFE8,
-0xFFD4DEE7,
-0xFFD5E0E6,
-0xFFD6E1E7,
-0xFFD6E1E7,
-0xFFD7E2E8,
-0xFFD8E3E9,
-0xFFD8E3E9,
-0xFFD9E4EA,
-0xFFDAE3EA,
-0xFFDBE2EA,
-0xFFDBE2E8,
-0xFFDBE2EA,
-0xFFDAE1E7,
-0xFFD7DEE6,
-0xFFD6DDE3,
-0xFFDAE1E9,
-0xFFDFE6EC,
-0xFFDBE2EA,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFDCE3E9,
-0xFFDCE3E9,
-0xFFDCE3E9,
-0xFFDDE4EA,
-0xFFE0E5EB,
-0xFFE5E9F2,
-0xFFE1E6EC,
-0xFFDDE2E8,
-0xFFDFE7EA,
-0xFFDEE6E9,
-0xFFDBE5E7,
-0xFFDDE8EC,
-0xFFDCE7EB,
-0xFFCCD9DF,
-0xFFB6C5CA,
-0xFFBCCBCE,
-0xFFC0CFD2,
-0xFFCBDBDB,
-0xFFC8D8D7,
-0xFFC4D2D3,
-0xFFBFCBCB,
-0xFFB4BDBC,
-0xFFA4AAAA,
-0xFFB9BDBE,
-0xFFCBCFD0,
-0xFFDDE1E2,
-0xFFFBFFFF,
-0xFFEFF0F4,
-0xFFEFF0F4,
-0xFFD5D4DA,
-0xFF97979F,
-0xFFA5A5AD,
-0xFFACAFB8,
-0xFF9D9FAB,
-0xFF5E626D,
-0xFF353945,
-0xFF363A45,
-0xFF81868C,
-0xFFECF1F7,
-0xFFE2E7ED,
-0xFFE6EBF1,
-0xFFEDF2F8,
-0xFFE6EBF1,
-0xFFE1E4E9,
-0xFFE3E6EB,
-0xFFE5E6EA,
-0xFFE5E6EA,
-0xFFE5E6EA,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE2E7EA,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE5E8ED,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE6EBEE,
-0xFFE5E9EC,
-0xFFE3E8EB,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE4E9ED,
-0xFFE4E9ED,
-0xFFE4E9ED,
-0xFFE3E8EC,
-0xFFE2E7EA,
-0xFFE2E7EA,
-0xFFE3E7EA,
-0xFFE2E7EA,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE4E7EC,
-0xFFE3E6EB,
-0xFFE3E6EB,
-0xFFE3E6EB,
-0xFFE3E6EB,
-0xFFE3E6EB,
-0xFFE4E7EC,
-0xFFE4E7EC,
-0xFFE2E6E9,
-0xFFE3E7EA,
-0xFFE4E8EB,
-0xFFE7EBEE,
-0xFFE9EDF0,
-0xFFEBEFF2,
-0xFFEBEFF2,
-0xFFEBEFF2,
-0xFFEFF0F4,
-0xFFEFF0F4,
-0xFFEFF0F4,
-0xFFEDEEF2,
-0xFFEAEBEF,
-0xFFE9EAEE,
-0xFFEBECF0,
-0xFFECEDF1,
-0xFFE9EAEC,
-0xFFE9EDEE,
-0xFFEDEEF0,
-0xFFEEEFF1,
-0xFFEEEFF3,
-0xFFECEDEF,
-0xFFEBECEE,
-0xFFEBECEE,
-0xFFECECEE,
-0xFFECEDEF,
-0xFFEDEEF0,
-0xFFEFF0F2,
-0xFFF2F1F6,
-0xFFF2F2F4,
-0xFFF2F2F4,
-0xFFF1F2F4,
-0xFFEEF1F6,
-0xFFF0F1F6,
-0xFFF1F0F5,
-0xFFF0EFF4,
-0xFFEFF0F4,
-0xFFEEEFF1,
-0xFFEFEFF1,
-0xFFF0EEF1,
-0xFFEFEDF0,
-0xFFEDEBEE,
-0xFFEEEFF1,
-0xFFEEEFF1,
-0xFFF4F4F6,
-0xFFF2F0F3,
-0xFFF2F1F6,
-0xFFEFF0F2,
-0xFFE9EDEE,
-0xFFEBF1F1,
-0xFFE7F0EF,
-0xFFB1B9BB,
-0xFFE4E7EC,
-0xFFE4E7EE,
-0xFFE2E9EF,
-0xFFE0E8EB,
-0xFFE6EAEB,
-0xFFFFE6DB,
-0xFFFFAE91,
-0xFFA01B00,
-0xFFA41A0D,
-0xFFEF8784,
-0xFFFFE5E9,
-0xFFEAEDF2,
-0xFFE8EDF0,
-0xFFECF2F2,
-0xFFE9EDF0,
-0xFFE5E9EC,
-0xFFE6E7EB,
-0xFFE0E1E5,
-0xFFE0E1E5,
-0xFFE9EAEE,
-0xFFEBEFF2,
-0xFFEAEEF1,
-0xFFE9EDF0,
-0xFFEBEFF2,
-0xFFEEF2F5,
-0xFFF2F3F7,
-0xFFF0F1F5,
-0xFFEEEDF2,
-0xFFEFEFF1,
-0xFFF2F2F4,
-0xFFF3F3F3,
-0xFFF1F1F1,
-0xFFF0F2F1,
-0xFFEEF2F3,
-0xFFE9EDEE,
-0xFFE1E7E7,
-0xFFE5EBEB,
-0xFFE6ECEC,
-0xFFDFE4E7,
-0xFFD8DDE1,
-0xFFDBE0E6,
-0xFFDADFE5,
-0xFFD7DBE4,
-0xFFD9DEE4,
-0xFFE0E1E6,
-0xFFE6E7EC,
-0xFFECEBF1,
-0xFFECEBF1,
-0xFFEBEAEF,
-0xFFEBEAEF,
-0xFFEAE9EE,
-0xFFE8E7EC,
-0xFFE8E7EC,
-0xFFECEBF0,
-0xFFECEBF0,
-0xFFE8E7EC,
-0xFFE6E5EB,
-0xFFE6E5EB,
-0xFFE7E8ED,
-0xFFECEDF1,
-0xFFECEBF0,
-0xFFEAEAEC,
-0xFFE8E7EC,
-0xFFE9E9EB,
-0xFFEAEBEF,
-0xFFEBECF0,
-0xFFE9EAEE,
-0xFFE6EAED,
-0xFFE3E7EA,
-0xFFE1E5E8,
-0xFFDDE0E5,
-0xFFE4E7EC,
-0xFFE3E6EB,
-0xFFDEE1E6,
-0xFFDDDEE3,
-0xFFE7E8ED,
-0xFFEDEEF3,
-0xFFEBECF1,
-0xFFE8E9EE,
-0xFFE7E8ED,
-0xFFE7E8ED,
-0xFFE6E7EC,
-0xFFE4E3E9,
-0xFFDFE0E5,
-0xFFDAD9DF,
-0xFFD9DADF,
-0xFFDDDDE5,
-0xFFDFDFE7,
-0xFFDADAE2,
-0xFFD8D8E0,
-0xFFD7DAE3,
-0xFFD3D6DF,
-0xFFD5D8E1,
-0xFFD9DDE6,
-0xFFD2D7DD,
-0xFFD1D6DA,
-0xFFCED3D6,
-0xFFC2C7CA,
-0xFFDCE0E3,
-0xFFD6D9DE,
-0xFFD4D7DC,
-0xFFD1D4DB,
-0xFFCDD1DA,
-0xFFCBD2DC,
-0xFFC8D0DB,
-0xFFC3CDD9,
-0xFFBCC8D8,
-0xFFB7C4D5,
-0xFFBFD1DF,
-0xFFBCCEDC,
-0xFFC0D0DD,
-0xFFC0D0DD,
-0xFFC1CFDA,
-0xFFC2D0DB,
-0xFFC4D0DC,
-0xFFC5D1DD,
-0xFFC4D2DF,
-0xFFC5D3E0,
-0xFFC4D2DF,
-0xFFC5D3E0,
-0xFFC7D5E2,
-0xFFC7D5E2,
-0xFFC9D5E3,
-0xFFC9D5E1,
-0xFFC8D5DE,
-0xFFC9D6DE,
-0xFFC9D6DF,
-0xFFC2CEDA,
-0xFFCAD3E2,
-0xFFCED7E6,
-0xFFD3DCED,
-0xFFCED7E6,
-0xFFD1DAE9,
-0xFFD0DAE6,
-0xFFCFD9E5,
-0xFFCFD9E3,
-0xFFCFD9E3,
-0xFFD1DBE4,
-0xFFD3DDE6,
-0xFFD5DFE8,
-0xFFD3DDE7,
-0xFFD2DCE6,
-0xFFD2DCE6,
-0xFFD3DDE7,
-0xFFD4DEE7,
-0xFFD4DEE7,
-0xFFD4DEE7,
-0xFFD4DEE7,
-0xFFD3DCE5,
-0xFFD3DDE6,
-0xFFD5DEE5,
-0xFFD6DFE6,
-0xFFD5DEE5,
-0xFFD4DDE4,
-0xFFD5DEE5,
-0xFFD6DFE6,
-0xFFD8E1EA,
-0xFFD5DEE7,
-0xFFD9E2E9,
-0xFFD6DFE6,
-0xFFD5DEE5,
-0xFFD8E1E8,
-0xFFD3DCE3,
-0xFFD7E0E7,
-0xFFD5DEE5,
-0xFFD7E0E7,
-0xFFD7E0E7,
-0xFFD6DFE6,
-0xFFD6DFE8,
-0xFFD7E0E9,
-0xFFD8E1EA,
-0xFFD7E0E9,
-0xFFD9E0EA,
-0xFFDAE1E9,
-0xFFD8DFE9,
-0xFFD4DBE3,
-0xFFD2DBE4,
-0xFFD6DFE6,
-0xFFD9E2EB,
-0xFFDAE3EA,
-0xFFD8DFE9,
-0xFFDBE2EA,
-0xFFE0E4ED,
-0xFFE1E5EE,
-0xFFE2E7ED,
-0xFFE3E8EE,
-0xFFE4E9EF,
-0xFFE5E8F1,
-0xFFE5E7F3,
-0xFFE6E9F2,
-0xFFE2E5EA,
-0xFFDFE5E5,
-0xFFE1E7E7,
-0xFFE1E6E9,
-0xFFE9F0F6,
-0xFFDFE6EE,
-0xFFC5CCD6,
-0xFFC0C9D2,
-0xFFC1CAD1,
-0xFFBEC9CD,
-0xFFC2CDD1,
-0xFFD6E1E5,
-0xFFE5F0F6,
-0xFFF0F9FF,
-0xFFFAFDFF,
-0xFFFAF9FE,
-0xFFFFFAFE,
-0xFFFDF7F9,
-0xFFFFFBFC,
-0xFFFEF4F3,
-0xFFFFFBF9,
-0xFFFFFBF8,
-0xFFA99795,
-0xFF463636,
-0xFF6A5C5B,
-0xFF4F4544,
-0xFF2A2627,
-0xFF424244,
-0xFF4E4F53,
-0xFF7F8084,
-0xFFB3B7BA,
-0xFFE3E6EB,
-0xFFE9ECF1,
-0xFFE2E5EA,
-0xFFE1E6EA,
-0xFFE3E8EC,
-0xFFE2E7EB,
-0xFFE2E7EB,
-0xFFE3E6EB,
-0xFFE3E6EB,
-0xFFE3E6EB,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFE3E7EA,
-0xFFE6E7E9,
-0xFFE9E9EB,
-0xFFE9EAEC,
-0xFFEBECEE,
-0xFFEEEFF1,
-0xFFECF0F1,
-0xFFEBECEE,
-0xFFE4E8E9,
-0xFFE5E9EC,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE5E9EC,
-0xFFE6EAED,
-0xFFE5E9EC,
-0xFFE4E7EC,
-0xFFE4E7EC,
-0xFFE3E6EB,
-0xFFE6E9EE,
-0xFFEBECF1,
-0xFFE8EBF0,
-0xFFEAEBF0,
-0xFFEAEBF0,
-0xFFE9EAEF,
-0xFFE7E8ED,
-0xFFE9EAEF,
-0xFFE6E7EC,
-0xFFE6E7EC,
-0xFFE6E7EC,
-0xFFE6E9EE,
-0xFFE7EAEF,
-0xFFE5E8ED,
-0xFFE6E9EE,
-0xFFE4E8EB,
-0xFFE6EAEB,
-0xFFEAEBED,
-0xFFECEDEF,
-0xFFEDEEF0,
-0xFFECEDEF,
-0xFFEBECEE,
-0xFFEAEBED,
-0xFFEFEFF1,
-0xFFF0F0F2,
-0xFFEFEFF1,
-0xFFECECEE,
-0xFFEBEBED,
-0xFFECECEE,
-0xFFEDEDEF,
-0xFFEAEBED,
-0xFFE8E9EB,
-0xFFECEDEF,
-0xFFF0F0F2,
-0xFFF1F1F1,
-0xFFF1F1F3,
-0xFFF2F2F2,
-0xFFF2F2F2,
-0xFFF1F1F1,
-0xFFEFEDEE,
-0xFFF0F0F0,
-0xFFF1F1F1,
-0xFFEFEFEF,
-0xFFEFEFF1,
-0xFFF1F1F3,
-0xFFF1F2F4,
-0xFFF0F1F3,
-0xFFE7EAEF,
-0xFFE8EBF0,
-0xFFECEDF2,
-0xFFEDEEF2,
-0xFFEEEFF3,
-0xFFEEEFF3,
-0xFFEDEEF2,
-0xFFEDECF1,
-0xFFEFEFF1,
-0xFFEEEEF0,
-0xFFECECEE,
-0xFFEBEBED,
-0xFFF1EFF2,
-0xFFF5F3F4,
-0xFFF1EFF2,
-0xFFEAEAEC,
-0xFFEBEAEF,
-0xFFEDEEF3,
-0xFFEEEFF4,
-0xFFB7B8BD,
-0xFFEAEBEF,
-0xFFE8E9ED,
-0xFFE3E6EB,
-0xFFE6E7EB,
-0xFFEDE7E9,
-0xFFFFE4DA,
-0xFFF37857,
-0xFFBD2A08,
-0xFF9F2716,
-0xFFFFC2BD,
-0xFFFFE7E9,
-0xFFEEECF1,
-0xFFF1F1F3,
-0xFFE7E9E8,
-0xFFE8E9EB,
-0xFFE7E8EA,
-0xFFE4E5E7,
-0xFFDBDCDE,
-0xFFDFE3E6,
-0xFFE5E9EC,
-0xFFE7E8EC,
-0xFFEAEBEF,
-0xFFEDEEF2,
-0xFFEDEEF2,
-0xFFECEDF1,
-0xFFEEEDF2,
-0xFFEEEDF2,
-0xFFEFEDF2,
-0xFFEDEBEE,
-0xFFEEECED,
-0xFFF0F0F2,
-0xFFF1F1F3,
-0xFFECEDEF,
-0xFFE2E6E9,
-0xFFDDE1E4,
-0xFFDBE0E3,
-0xFFD9DEE2,
-0xFFD8E0E3,
-0xFFD8E0E3,
-0xFFD8DFE5,
-0xFFD8DFE5,
-0xFFD9E0E6,
-0xFFD9E0E6,
-0xFFDADFE5,
-0xFFE1E2E6,
-0xFFE8E7EC,
-0xFFE9E8ED,
-0xFFE8E7EC,
-0xFFEAE9EE,
-0xFFEDECF1,
-0xFFEAE9EE,
-0xFFE7E6EB,
-0xFFE5E4EA,
-0xFFE8E7ED,
-0xFFE8E9ED,
-0xFFE6E7EB,
-0xFFE4E5E9,
-0xFFE4E5E9,
-0xFFE6E7EB,
-0xFFE8E9ED,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFE5E6EB,
-0xFFE3E4E8,
-0xFFE6E5EB,
-0xFFE5E4EA,
-0xFFE5E4EA,
-0xFFE8E9EE,
-0xFFE3E4E9,
-0xFFE5E6EB,
-0xFFE1E1E9,
-0xFFDDDDE5,
-0xFFDDDDE5,
-0xFFDBDBE3,
-0xFFDBDEE7,
-0xFFE5E8EF,
-0xFFE8ECEF,
-0xFFE8ECEF,
-0xFFE6EAED,
-0xFFE2E5EA,
-0xFFE0E3E8,
-0xFFDEE1E8,
-0xFFDEDEE6,
-0xFFD8DBE2,
-0xFFDDDDE5,
-0xFFD8DBE2,
-0xFFD8DBE4,
-0xFFDCDFE8,
-0xFFDDE0E9,
-0xFFDADDE6,
-0xFFD6D9E0,
-0xFFD3D6DD,
-0xFFDBDEE7,
-0xFFD5D8E1,
-0xFFD1D8E0,
-0xFFD0D7DD,
-0xFFCED6D8,
-0xFFBBC3C5,
-0xFFD5D9E2,
-0xFFD2D6E1,
-0xFFCCD3DD,
-0xFFCAD1DB,
-0xFFCBD1DD,
-0xFFCCD2DE,
-0xFFC9CDD6,
-0xFFC2C9D3,
-0xFFBDC5D8,
-0xFFBAC5DB,
-0xFFBDD0DF,
-0xFFBED1DF,
-0xFFBDCDDC,
-0xFFC1D1DE,
-0xFFC1CFDC,
-0xFFC3D1DC,
-0xFFC7D3DF,
-0xFFC5D1DD,
-0xFFC7D5E2,
-0xFFC4D2DF,
-0xFFC7D5E2,
-0xFFC6D6E3,
-0xFFC4D2DF,
-0xFFC6D4E1,
-0xFFCCD8E6,
-0xFFCBD7E3,
-0xFFCDD9E5,
-0xFFC8D6E1,
-0xFFCBD7E3,
-0xFFC9D5E1,
-0xFFCDD9E5,
-0xFFCCD8E4,
-0xFFCCD8E6,
-0xFFCCD8E6,
-0xFFCDD9E7,
-0xFFCFD8E7,
-0xFFCFD8E7,
-0xFFD0DAE6,
-0xFFD1DBE5,
-0xFFD2DCE5,
-0xFFD1DCE2,
-0xFFD0DBE1,
-0xFFD1DBE4,
-0xFFD3DDE7,
-0xFFD4DEE8,
-0xFFD4DEE8,
-0xFFD3DDE6,
-0xFFD3DDE6,
-0xFFD5DEE7,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD6DFE6,
-0xFFD6DFE6,
-0xFFD7DEE6,
-0xFFD8DFE7,
-0xFFD7DEE6,
-0xFFD6DDE5,
-0xFFD5DEE7,
-0xFFD4DDE6,
-0xFFD8E1E8,
-0xFFD7E0E7,
-0xFFD7E0E7,
-0xFFD8E1E8,
-0xFFD6DFE6,
-0xFFD7E0E7,
-0xFFDBE4EB,
-0xFFD9E2E9,
-0xFFD8E1E8,
-0xFFD8E1E8,
-0xFFD9E2EB,
-0xFFD9E2EB,
-0xFFD8E1EA,
-0xFFD7DEE8,
-0xFFDEE5ED,
-0xFFDDE1EA,
-0xFFD7DBE4,
-0xFFCFD6DE,
-0xFFCCD3DB,
-0xFFCFD6DE,
-0xFFD4DBE3,
-0xFFD8DFE7,
-0xFFD8DFE7,
-0xFFDEE2EB,
-0xFFE2E6EF,
-0xFFE3E8EE,
-0xFFE3E6ED,
-0xFFE3E6EB,
-0xFFE4E7EC,
-0xFFE5E5ED,
-0xFFDFDFE9,
-0xFFE0E0EA,
-0xFFE3E7EA,
-0xFFE0E4E5,
-0xFFE6EAEB,
-0xFFE4E9ED,
-0xFFECF0FB,
-0xFFD5D8E7,
-0xFFB9BCCF,
-0xFFBFC4D8,
-0xFFBCC1D4,
-0xFFC2C8D8,
-0xFFA0A7B7,
-0xFF818898,
-0xFF676E81,
-0xFF6A6F82,
-0xFF7E808F,
-0xFFB6B4C1,
-0xFFEDE5F0,
-0xFFE5DAE2,
-0xFFC3B7B9,
-0xFF8B7D7C,
-0xFF594841,
-0xFF3C2821,
-0xFF402722,
-0xFF452C27,
-0xFF442F2A,
-0xFF312320,
-0xFFEEE8E8,
-0xFFFBFBFD,
-0xFFF2F3F7,
-0xFFEEF1F6,
-0xFFECEFF4,
-0xFFE8EDF1,
-0xFFE3E6EB,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE1E6EA,
-0xFFE4E9ED,
-0xFFDCE1E5,
-0xFFE3E6EB,
-0xFFE8EBF0,
-0xFFEDF0F5,
-0xFFECEFF4,
-0xFFE8EBF0,
-0xFFE5E9EC,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFEAEAEC,
-0xFFEBEBED,
-0xFFEBEBED,
-0xFFE9EAEC,
-0xFFE9EAEC,
-0xFFE8ECED,
-0xFFE9EAEC,
-0xFFE6EAEB,
-0xFFE8ECED,
-0xFFE9EDEE,
-0xFFE8ECEF,
-0xFFE7EBEE,
-0xFFE8ECEF,
-0xFFE8ECEF,
-0xFFE6E9EE,
-0xFFE4E7EC,
-0xFFE4E5EA,
-0xFFE9EAEF,
-0xFFEBECF1,
-0xFFE9EAEF,
-0xFFE8E9EE,
-0xFFEAEBF0,
-0xFFEAEBF0,
-0xFFE7E8ED,
-0xFFE4E5EA,
-0xFFE5E6EB,
-0xFFE9EAEF,
-0xFFEBECF1,
-0xFFE9ECF1,
-0xFFE8EBF0,
-0xFFE6E9EE,
-0xFFE7EAEF,
-0xFFE7EBEE,
-0xFFE7EBEC,
-0xFFE9EAEC,
-0xFFE9EAEC,
-0xFFE9EAEC,
-0xFFE9EAEC,
-0xFFEAEBED,
-0xFFEAEBED,
-0xFFEDEDEF,
-0xFFEFEFF1,
-0xFFEFEFF1,
-0xFFEDEDEF,
-0xFFEBEBED,
-0xFFECECEE,
-0xFFEBEBED,
-0xFFE9E9EB,
-0xFFE5E6E8,
-0xFFE8E9EB,
-0xFFEDEDEF,
-0xFFF1F1F1,
-0xFFF2F2F2,
-0xFFF1F1F1,
-0xFFF1EFF0,
-0xFFF1F0EE,
-0xFFF2F0F1,
-0xFFF1F1F1,
-0xFFF0F0F0,
-0xFFEEEEEE,
-0xFFEEEEEE,
-0xFFF0F0F2,
-0xFFEEEFF1,
-0xFFECEDF1,
-0xFFE7EBEE,
-0xFFE7EBEE,
-0xFFE8EBF0,
-0xFFEAEEF1,
-0xFFECEDF1,
-0xFFECEDF1,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFEBECF0,
-0xFFE9EAEC,
-0xFFE9E8ED,
-0xFFEBEBED,
-0xFFEBEBED,
-0xFFE8E8EA,
-0xFFE6E6E8,
-0xFFE7E7E9,
-0xFFEBEAEF,
-0xFFEEEFF4,
-0xFFEEEEF6,
-0xFFB4B7BE,
-0xFFE7E8EC,
-0xFFE6E7E9,
-0xFFE6E7EB,
-0xFFEAE9E7,
-0xFFF4EADE,
-0xFFFFDCC4,
-0xFFD3401F,
-0xFFB81700,
-0xFFB65243,
-0xFFFFE5E1,
-0xFFF0DEDE,
-0xFFEDEDEF,
-0xFFEBEBED,
-0xFFE7E7E9,
-0xFFE7E8EA,
-0xFFE8E9EB,
-0xFFE5E6E8,
-0xFFE0E1E5,
-0xFFE1E5E8,
-0xFFE4E8EB,
-0xFFE9EAEE,
-0xFFEBECF0,
-0xFFECEDF1,
-0xFFECEDF1,
-0xFFEDECF1,
-0xFFEDECF1,
-0xFFEEEDF2,
-0xFFEEEEF0,
-0xFFEDEBEE,
-0xFFEDEDED,
-0xFFEEEEF0,
-0xFFECEDEF,
-0xFFEAEBEF,
-0xFFE4E8EB,
-0xFFE0E3E8,
-0xFFDCE1E5,
-0xFFDADFE3,
-0xFFDCE1E5,
-0xFFDDE2E8,
-0xFFD9E1E4,
-0xFFDBE0E6,
-0xFFDBE3E6,
-0xFFE0E5EB,
-0xFFE1E6EA,
-0xFFE4E8EB,
-0xFFE8E9ED,
-0xFFE7E8EC,
-0xFFE5E6EA,
-0xFFE7E8EC,
-0xFFE7E8EC,
-0xFFE6E7EC,
-0xFFE6E7EC,
-0xFFE3E4E9,
-0xFFE4E5EA,
-0xFFE3E6EB,
-0xFFE2E6E9,
-0xFFE3E7EA,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE7EBEE,
-0xFFEAEEF1,
-0xFFE8ECEF,
-0xFFE5E6EB,
-0xFFE4E5E9,
-0xFFE5E6EB,
-0xFFE3E4E8,
-0xFFE0E1E6,
-0xFFE0E1E6,
-0xFFE1E2E7,
-0xFFE0E3EA,
-0xFFDBDEE5,
-0xFFD7DAE1,
-0xFFD7DAE3,
-0xFFD4D7E0,
-0xFFD5D9E4,
-0xFFDEE2EB,
-0xFFE2E5EA,
-0xFFE3E7EA,
-0xFFE0E3E8,
-0xFFDBE0E4,
-0xFFDADDE4,
-0xFFD9DDE6,
-0xFFDADDE6,
-0xFFD7DBE4,
-0xFFD9DBE7,
-0xFFD4D8E1,
-0xFFD4D6E2,
-0xFFD5D9E2,
-0xFFD8DBE4,
-0xFFD6DAE3,
-0xFFD7DBE4,
-0xFFDBDEE5,
-0xFFDADAE2,
-0xFFD4D7E0,
-0xFFD7DEE6,
-0xFFD3DCE1,
-0xFFD3DCDB,
-0xFFB7C0BF,
-0xFFD4D8E1,
-0xFFCFD3DF,
-0xFFCBD2DC,
-0xFFC8D1DA,
-0xFFCCD2DE,
-0xFFD1D5E0,
-0xFFCFD2D7,
-0xFFC8CDD3,
-0xFFC2C9D9,
-0xFFBFC7DC,
-0xFFBCCFE0,
-0xFFBCCFDE,
-0xFFC3D3E3,
-0xFFBECEDD,
-0xFFC3D1DE,
-0xFFC1CDDB,
-0xFFC5D1DD,
-0xFFC4D0DC,
-0xFFC1CDD9,
-0xFFC1CFDA,
-0xFFC4D2DD,
-0xFFC5D3DE,
-0xFFC4D0DC,
-0xFFC4D1DA,
-0xFFC6D0DA,
-0xFFC3CFDB,
-0xFFC3D0E0,
-0xFFC1D1E1,
-0xFFCAD8E5,
-0xFFC6D4DF,
-0xFFC7D5DE,
-0xFFC9D7E0,
-0xFFCAD8E3,
-0xFFCDDBE6,
-0xFFC9D7E4,
-0xFFCBD7E7,
-0xFFCCD8E8,
-0xFFCCD8E8,
-0xFFCFDBE7,
-0xFFD1DEE7,
-0xFFD3DEE4,
-0xFFD0DBE1,
-0xFFD0DAE3,
-0xFFD3DDE7,
-0xFFD4DEE8,
-0xFFD3DDE7,
-0xFFD3DDE7,
-0xFFD4DEE8,
-0xFFD5DEE7,
-0xFFD5DEE7,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD6DFE8,
-0xFFD7E0E9,
-0xFFDAE1EB,
-0xFFDCE3ED,
-0xFFDBE2EA,
-0xFFD9E0E8,
-0xFFDAE1EB,
-0xFFDAE1EB,
-0xFFD8DFE9,
-0xFFD7DEE8,
-0xFFD6DDE5,
-0xFFD7DEE6,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFE1E8F0,
-0xFFDCE3EB,
-0xFFD9E0E8,
-0xFFDCE3EB,
-0xFFDDE4EE,
-0xFFDBE2EC,
-0xFFD9E0EA,
-0xFFD9E0E8,
-0xFFE7EAF1,
-0xFFE5E8ED,
-0xFFE1E4E9,
-0xFFDCE1E5,
-0xFFD8DDE3,
-0xFFD7DCE2,
-0xFFD9DEE4,
-0xFFDDE2E8,
-0xFFD9DEE4,
-0xFFDDE0E5,
-0xFFE1E4E9,
-0xFFE1E5E8,
-0xFFE3E4E8,
-0xFFE3E4E8,
-0xFFE3E4E8,
-0xFFE4E5E9,
-0xFFE3E4E9,
-0xFFE7E8ED,
-0xFFDFE3E6,
-0xFFE5E9EA,
-0xFFE7ECF0,
-0xFFE5E9F2,
-0xFFF9FCFF,
-0xFF454962,
-0xFF313453,
-0xFF383C5F,
-0xFF373B5E,
-0xFF3B3F62,
-0xFF4A4E71,
-0xFF43476C,
-0xFF3F4369,
-0xFF35395E,
-0xFF2B304D,
-0xFF14162D,
-0xFF1E192D,
-0xFF473F4E,
-0xFF81767C,
-0xFFADA1A1,
-0xFFAB9C97,
-0xFF67544D,
-0xFF594039,
-0xFF563D38,
-0xFF4B3834,
-0xFF4A3E3E,
-0xFFF7F5FA,
-0xFFD3D6DF,
-0xFFD7DAE9,
-0xFFDEE4F2,
-0xFFE7EEF6,
-0xFFE4EBF1,
-0xFFE5EAF0,
-0xFFDFE6EC,
-0xFFE2E9EF,
-0xFFDDE4EA,
-0xFFE0E5EB,
-0xFFDEE3E9,
-0xFFE3E8EE,
-0xFFE8EDF3,
-0xFFEBF0F6,
-0xFFE8EDF1,
-0xFFE1E6EA,
-0xFFDDE2E6,
-0xFFDDE2E6,
-0xFFDFE2E7,
-0xFFE2E6E9,
-0xFFE7E8EC,
-0xFFE9EAEE,
-0xFFE7EBEE,
-0xFFE6EAED,
-0xFFE4E9EC,
-0xFFE6EAED,
-0xFFE6EAED,
-0xFFE6EAED,
-0xFFE9EDF0,
-0xFFEAEEF1,
-0xFFE8ECEF,
-0xFFEAEBEF,
-0xFFEDEEF2,
-0xFFEBECF0,
-0xFFE7E8EC,
-0xFFE3E7EA,
-0xFFE7EBEE,
-0xFFE8ECEF,
-0xFFE5E9EC,
-0xFFE4E8EB,
-0xFFE6EAED,
-0xFFE6EAED,
-0xFFE3E7EA,
-0xFFE2E5EA,
-0xFFE1E4E9,
-0xFFE1E4E9,
-0xFFE2E5EA,
-0xFFE3E6EB,
-0xFFE4E7EC,
-0xFFE7EAEF,
-0xFFE9ECF1,
-0xFFEAEEF1,
-0xFFEAEEF1,
-0xFFE9EDF0,
-0xFFE8ECEF,
-0xFFE7EBEE,
-0xFFE8ECEF,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFECEDF1,
-0xFFECEDF1,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFE9EAEE,
-0xFFE8E9ED,
-0xFFE6E7EB,
-0xFFE5E6EA,
-0xFFE6E7EB,
-0xFFEBECF0,
-0xFFF0F1F3,
-0xFFF2F3F5,
-0xFFF0F1F3,
-0xFFF1F1F3,
-0xFFF3F3F3,
-0xFFF1F1F3,
-0xFFF1F1F3,
-0xFFEFEFF1,
-0xFFEDEEF0,
-0xFFEEEFF1,
-0xFFEFF0F4,
-0xFFEEEFF3,
-0xFFECEDF1,
-0xFFE9EAEE,
-0xFFE9EAEC,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFEBECF0,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFE9EAEE,
-0xFFE8E9ED,
-0xFFE2E6E9,
-0xFFE4E5EA,
-0xFFE6E7EB,
-0xFFE8E9ED,
-0xFFE7E8EC,
-0xFFE8E9ED,
-0xFFEAEBEF,
-0xFFE8ECEB,
-0xFFEBF1F1,
-0xFFE7F0F5,
-0xFFAFB8BD,
-0xFFDEE6E8,
-0xFFE1E7E7,
-0xFFE2E6E9,
-0xFFECEADE,
-0xFFF7EBC1,
-0xFFFAB886,
-0xFFC51C00,
-0xFFC11404,
-0xFFDE918B,
-0xFFFDE9EA,
-0xFFE0DEDF,
-0xFFE4E9EC,
-0xFFE6E7EB,
-0xFFE7E8EC,
-0xFFE6E7EB,
-0xFFE5E6EA,
-0xFFE0E4E7,
-0xFFE1E4E9,
-0xFFE1E4E9,
-0xFFE3E6EB,
-0xFFE7EAEF,
-0xFFE8EBF0,
-0xFFE9EDF0,
-0xFFE8ECEF,
-0xFFEAEBEF,
-0xFFEBECF0,
-0xFFEAEBED,
-0xFFE9EAEC,
-0xFFECECEE,
-0xFFEDEEF0,
-0xFFEDEEF0,
-0xFFE9EAEC,
-0xFFE6E7E9,
-0xFFE5E6E8,
-0xFFE4E5E9,
-0xFFE0E4E7,
-0xFFDFE3E6,
-0xFFE1E5E8,
-0xFFE4E7EC,
-0xFFE2E7EA,
-0xFFE1E4E9,
-0xFFE0E5E8,
-0xFFE3E6EB,
-0xFFE4E9EC,
-0xFFE2E7EB,
-0xFFDFE7EA,
-0xFFDDE5E8,
-0xFFDCE4E7,
-0xFFDFE4E8,
-0xFFDEE3E7,
-0xFFDDE2E8,
-0xFFDFE4EA,
-0xFFDDE2E8,
-0xFFDEE3E7,
-0xFFDFE4E8,
-0xFFE1E6EA,
-0xFFE4E9ED,
-0xFFE7ECF0,
-0xFFE7ECEF,
-0xFFE6EBEE,
-0xFFE7ECEF,
-0xFFE2E8E8,
-0xFFE1E5E8,
-0xFFE3E7E8,
-0xFFE4E8EB,
-0xFFE3E7E8,
-0xFFE0E4E7,
-0xFFDADFE2,
-0xFFDBE0E3,
-0xFFDDE2E6,
-0xFFD8E0E3,
-0xFFD6DEE1,
-0xFFD7DEE4,
-0xFFD4DBE1,
-0xFFD2DBE2,
-0xFFD8DFE7,
-0xFFDADFE5,
-0xFFDADFE5,
-0xFFD8DDE3,
-0xFFD2D9E1,
-0xFFD3D7E0,
-0xFFD1D8E2,
-0xFFD3D7E2,
-0xFFD0D7E1,
-0xFFD1D5E1,
-0xFFCCD3DD,
-0xFFCED2DE,
-0xFFCED5DF,
-0xFFD0D4DF,
-0xFFCED5DD,
-0xFFD2D9E1,
-0xFFDADFE5,
-0xFFD8DBE2,
-0xFFD5D8DF,
-0xFFD4DBE1,
-0xFFD2DCDE,
-0xFFCFD8D3,
-0xFFB6BCBA,
-0xFFD2D5DA,
-0xFFCDD1DA,
-0xFFC9D0D6,
-0xFFC6CFD4,
-0xFFCDD4DA,
-0xFFD8DDE1,
-0xFFD9DDDC,
-0xFFD6DADB,
-0xFFD1D8E2,
-0xFFD0D8E5,
-0xFFB9CADC,
-0xFFB8C8D8,
-0xFFC3D0E1,
-0xFFC1CEDE,
-0xFFC6CFDE,
-0xFFC6D0DC,
-0xFFC2CCD6,
-0xFFC8D2DC,
-0xFFCAD4DE,
-0xFFCBD5DF,
-0xFFC9D3DC,
-0xFFCBD5DE,
-0xFFD6E0E9,
-0xFFD9E2E9,
-0xFFD0D9DE,
-0xFFCED7E0,
-0xFFC8D4E2,
-0xFFC3D0E0,
-0xFFC6D4DF,
-0xFFC3D1DA,
-0xFFC5D4DB,
-0xFFC9D8DF,
-0xFFC9D8DF,
-0xFFCFDDE6,
-0xFFCEDAE6,
-0xFFD0DCE8,
-0xFFD2DBEA,
-0xFFD0D9E8,
-0xFFCFD9E5,
-0xFFD1D9E4,
-0xFFD2DBE4,
-0xFFD1DAE3,
-0xFFD1DBE4,
-0xFFD2DCE6,
-0xFFD2DCE6,
-0xFFD1DBE5,
-0xFFD3DDE7,
-0xFFD5DFE9,
-0xFFD5DEE7,
-0xFFD2DBE4,
-0xFFD5DEE7,
-0xFFD4DDE6,
-0xFFD6DFE8,
-0xFFD9E2EB,
-0xFFDDE4EE,
-0xFFDCE3ED,
-0xFFDDE4EC,
-0xFFDFE6EE,
-0xFFE4EBF5,
-0xFFE4EBF5,
-0xFFD9E0EA,
-0xFFD4DBE5,
-0xFFCFD6DE,
-0xFFCDD4DC,
-0xFFD6DDE5,
-0xFFD6DDE5,
-0xFFDAE1E9,
-0xFFD5DCE4,
-0xFFD3DAE2,
-0xFFD7DEE6,
-0xFFD7DEE8,
-0xFFD4DBE5,
-0xFFD6DDE7,
-0xFFDEE2EB,
-0xFFE5E8ED,
-0xFFE6E7EB,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE1E4E9,
-0xFFDBDEE3,
-0xFFDBDEE3,
-0xFFDDE0E5,
-0xFFDEE1E6,
-0xFFDFE2E7,
-0xFFE3E4E8,
-0xFFE2E3E7,
-0xFFE3E4E6,
-0xFFE4E5E7,
-0xFFE7E7E9,
-0xFFE7E7E9,
-0xFFE5E6EA,
-0xFFE9EAEE,
-0xFFE8ECEF,
-0xFFE9EEF1,
-0xFFEDF2F8,
-0xFFE2E8F4,
-0xFFCFD4EA,
-0xFF2D3250,
-0xFF35395F,
-0xFF363964,
-0xFF363964,
-0xFF41446F,
-0xFF404370,
-0xFF3B3E6B,
-0xFF373969,
-0xFF3C3F6A,
-0xFF3C4063,
-0xFF363A55,
-0xFF35334B,
-0xFF242031,
-0xFF1E1621,
-0xFF0F060B,
-0xFF120606,
-0xFF322421,
-0xFF422E2D,
-0xFF44302F,
-0xFF473738,
-0xFF877E83,
-0xFFEBEAF2,
-0xFFDBDFEB,
-0xFFDADDEE,
-0xFFD8DEEE,
-0xFFDEE5EF,
-0xFFDFE6EC,
-0xFFDBE2E8,
-0xFFD1D8DE,
-0xFFD7DEE4,
-0xFFDAE1E7,
-0xFFD9DDE6,
-0xFFDADFE5,
-0xFFE1E6EC,
-0xFFE1E6EC,
-0xFFDFE4EA,
-0xFFDCE1E7,
-0xFFDBE0E6,
-0xFFDCE1E5,
-0xFFDFE4E8,
-0xFFE1E6EA,
-0xFFE1E6EA,
-0xFFE4E9ED,
-0xFFE5EAF0,
-0xFFE4E9ED,
-0xFFE2E7EB,
-0xFFE0E5E9,
-0xFFE0E5E9,
-0xFFE1E6E9,
-0xFFE2E6E9,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE6EAED,
-0xFFE9EAEE,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFE8E9ED,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE4E8EB,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFE3E7EA,
-0xFFE6E9EE,
-0xFFE1E4E9,
-0xFFD9DCE1,
-0xFFD9DCE1,
-0xFFDDE0E5,
-0xFFE1E4E9,
-0xFFE7EAEF,
-0xFFE9ECF1,
-0xFFE9EDF0,
-0xFFEAEEF1,
-0xFFEBEFF2,
-0xFFEAEEF1,
-0xFFEAEEF1,
-0xFFEAEEF1,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFE7E8EC,
-0xFFE9EAEE,
-0xFFE9EAEE,
-0xFFE8E9ED,
-0xFFE8E9ED,
-0xFFE8E9ED,
-0xFFE8E9ED,
-0xFFE7E8EC,
-0xFFE5E6EA,
-0xFFE6E7EB,
-0xFFE8E9ED,
-0xFFECEDF1,
-0xFFEDEEF0,
-0xFFEDEEF0,
-0xFFEFEFF1,
-0xFFF0F0F2,
-0xFFF0F0F2,
-0xFFF1F1F3,
-0xFFEFF0F2,
-0xFFEEEFF1,
-0xFFEDEEF2,
-0xFFEDEEF2,
-0xFFEDEEF2,
-0xFFECEDF1,
-0xFFEBECEE,
-0xFFEBECEE,
-0xFFEAEBED,
-0xFFEAEBED,
-0xFFEBECF0,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFE5E8ED,
-0xFFE3E6EB,
-0xFFE0E3E8,
-0xFFE1E4EB,
-0xFFE5E8EF,
-0xFFE6EBF1,
-0xFFE4E7EE,
-0xFFDEE2E5,
-0xFFE6EAE9,
-0xFFEBF1EF,
-0xFFE8F1F6,
-0xFFAEB9BD,
-0xFFDBE5E6,
-0xFFDCE5E4,
-0xFFDCE1E4,
-0xFFEBE4D4,
-0xFFFFEBB5,
-0xFFD27C43,
-0xFFC81A01,
-0xFFC6211B,
-0xFFFFCDD2,
-0xFFE1DEE5,
-0xFFD7DFE2,
-0xFFE2ECEE,
-0xFFE4E9ED,
-0xFFECEDF2,
-0xFFE6E7EC,
-0xFFE0E1E6,
-0xFFD9DCE1,
-0xFFDFE2E7,
-0xFFE0E3E8,
-0xFFE2E5EA,
-0xFFE5E8ED,
-0xFFE6E9EE,
-0xFFE7EBEE,
-0xFFE7EBEE,
-0xFFE9EAEE,
-0xFFE8E9ED,
-0xFFE5E6E8,
-0xFFE2E3E5,
-0xFFE5E6EA,
-0xFFE8E9ED,
-0xFFEAEBEF,
-0xFFE8E9ED,
-0xFFE4E5E9,
-0xFFE2E3E7,
-0xFFE4E5E9,
-0xFFE6E7EB,
-0xFFE2E3E7,
-0xFFE5E6EA,
-0xFFE8E9ED,
-0xFFE7EBEE,
-0xFFE6EAED,
-0xFFE3E6EB,
-0xFFE1E4E9,
-0xFFE0E3E8,
-0xFFDFE4E8,
-0xFFDEE6E9,
-0xFFDCE4E7,
-0xFFDBE3E6,
-0xFFDFE4EA,
-0xFFDEE3E9,
-0xFFDCE1E7,
-0xFFDDE2E8,
-0xFFDCE1E7,
-0xFFDCE1E5,
-0xFFDEE3E7,
-0xFFE1E6EA,
-0xFFE6EBEF,
-0xFFE7ECEF,
-0xFFE6EBEE,
-0xFFE3E9E9,
-0xFFE3E8EB,
-0xFFDDE3E3,
-0xFFDEE3E6,
-0xFFE3E9E9,
-0xFFE4E9EC,
-0xFFE5EBEB,
-0xFFE3E8EB,
-0xFFDDE2E5,
-0xFFDBE3E5,
-0xFFDCE4E7,
-0xFFD9E3E5,
-0xFFD9E2E7,
-0xFFD9E2E7,
-0xFFD3DCE3,
-0xFFCDD8DE,
-0xFFCED7DE,
-0xFFD7DBE4,
-0xFFD6DAE3,
-0xFFD5D9E2,
-0xFFD2D6DF,
-0xFFD1D5E0,
-0xFFCED5DF,
-0xFFCFD3DF,
-0xFFCBD1DD,
-0xFFC9CFDB,
-0xFFC8CEDA,
-0xFFC7CDD9,
-0xFFC7CED8,
-0xFFC8CFD9,
-0xFFCAD1D9,
-0xFFCED7DE,
-0xFFD3DAE2,
-0xFFD6D9E0,
-0xFFD4D7DE,
-0xFFCBD2DA,
-0xFFD1DBDD,
-0xFFC8D1CE,
-0xFFB9BFBD,
-0xFFCED1D6,
-0xFFCBD0D6,
-0xFFCED5DB,
-0xFFCBD4D9,
-0xFFD2D9DF,
-0xFFDCE1E4,
-0xFFDDE2DE,
-0xFFD9DEDA,
-0xFFD5DCE2,
-0xFFD4DDE4,
-0xFFBEC9DB,
-0xFFC0CCDC,
-0xFFBCC5D4,
-0xFFCDD7E3,
-0xFFD1D7E3,
-0xFFD8DFE9,
-0xFFD4D8E1,
-0xFFD9DEE4,
-0xFFE3E8EE,
-0xFFDCE1E7,
-0xFFDCE1E5,
-0xFFDDE2E5,
-0xFFE1E6E9,
-0xFFE8ECED,
-0xFFE2E6E5,
-0xFFDBDFE0,
-0xFFD7DEE4,
-0xFFC8D1D8,
-0xFFC2CBD2,
-0xFFC4CDD4,
-0xFFCDD6DF,
-0xFFD7E0E9,
-0xFFDAE4ED,
-0xFFE1ECF2,
-0xFFDEE7EE,
-0xFFE0E9F0,
-0xFFDFE6EE,
-0xFFD8DFE9,
-0xFFD4D8E4,
-0xFFD4D6E5,
-0xFFD7D9E8,
-0xFFD9DCEB,
-0xFFD2DAE5,
-0xFFD3DDE6,
-0xFFD2DCE5,
-0xFFD1DBE4,
-0xFFD2DBE4,
-0xFFD4DDE6,
-0xFFD4DDE6,
-0xFFD3DCE5,
-0xFFD8DFE9,
-0xFFD6DDE7,
-0xFFD8DFE9,
-0xFFDDE4EE,
-0xFFDCE3ED,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFDDE4EE,
-0xFFD4DBE5,
-0xFFD9E0EA,
-0xFFD1D8E2,
-0xFFD2D9E3,
-0xFFD1D8E2,
-0xFFD1D8E2,
-0xFFDEE2EB,
-0xFFDEE2EB,
-0xFFD6DAE3,
-0xFFD4D8E1,
-0xFFD5D9E2,
-0xFFD6DAE3,
-0xFFD3D7E2,
-0xFFD1D5E0,
-0xFFD8DCE7,
-0xFFE2E6EF,
-0xFFE6EAED,
-0xFFE6E7E9,
-0xFFE7E8EA,
-0xFFE8E9EB,
-0xFFE4E8EB,
-0xFFDFE3E6,
-0xFFDFE3E6,
-0xFFE2E6E9,
-0xFFE0E4E7,
-0xFFE0E4E7,
-0xFFDFE3E6,
-0xFFDFE3E6,
-0xFFE1E5E8,
-0xFFE3E7EA,
-0xFFE5E6E8,
-0xFFE4E5E7,
-0xFFE7E8EA,
-0xFFDEDFE3,
-0xFFE4E8EB,
-0xFFE4E9ED,
-0xFFE2E6F1,
-0xFFF5FBFF,
-0xFF585C77,
-0xFF2B2F52,
-0xFF262952,
-0xFF1F2350,
-0xFF2F3360,
-0xFF3B3F6C,
-0xFF3F426D,
-0xFF434671,
-0xFF343764,
-0xFF2B2F55,
-0xFF212443,
-0xFF22243D,
-0xFF1D1B31,
-0xFF211E33,
-0xFF282536,
-0xFF24222F,
-0xFF24212A,
-0xFF161118,
-0xFF120610,
-0xFF0C000A,
-0xFF150B14,
-0xFFD5D0D7,
-0xFFE5E5ED,
-0xFFDCDFE8,
-0xFFDBDDE9,
-0xFFD9DDE8,
-0xFFDEE5ED,
-0xFFD6DFE6,
-0xFFD1DAE1,
-0xFFD2DBE2,
-0xFFD1D8E0,
-0xFFD5DCE4,
-0xFFD3DAE4,
-0xFFD5DCE4,
-0xFFD5DCE4,
-0xFFD5DCE4,
-0xFFD4DBE3,
-0xFFD3DAE0,
-0xFFD6DDE3,
-0xFFDBE2E8,
-0xFFE3E8EE,
-0xFFE5EAF0,
-0xFFE3EAF0,
-0xFFE3EAF0,
-0xFFE1E8F0,
-0xFFDEE5EB,
-0xFFDBE2E8,
-0xFFDAE1E7,
-0xFFDAE1E7,
-0xFFDBE3E6,
-0xFFDFE4E8,
-0xFFE2E7EB,
-0xFFE5E8ED,
-0xFFE6E9EE,
-0xFFE7E8EC,
-0xFFE6E7EB,
-0xFFE9E8ED,
-0xFFE9EAEE,
-0xFFE7EBEE,
-0xFFE3E7EA,
-0xFFE1E5E8,
-0xFFE3E7EA,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE6EAED,
-0xFFE3E7EA,
-0xFFDADFE2,
-0xFFDBE0E3,
-0xFFDDE2E5,
-0xFFDFE4E7,
-0xFFE5EAED,
-0xFFE7EBEE,
-0xFFE8ECEF,
-0xFFECEDF1,
-0xFFEBEFF2,
-0xFFEBEFF2,
-0xFFEAEEF1,
-0xFFE9EDF0,
-0xFFE7EBEE,
-0xFFE5E9EC,
-0xFFE4E7EC,
-0xFFE5E8ED,
-0xFFE4E7EC,
-0xFFE3E6EB,
-0xFFE4E7EC,
-0xFFE6E9EE,
-0xFFE8EBF0,
-0xFFE9ECF1,
-0xFFEAEBF0,
-0xFFEBECF1,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFECEDF1,
-0xFFEDEEF2,
-0xFFEDEEF2,
-0xFFEDEEF2,
-0xFFEEEFF3,
-0xFFEFF0F4,
-0xFFECEDF1,
-0xFFE9EAEE,
-0xFFE7E8EC,
-0xFFE8E9EE,
-0xFFE9EAEE,
-0xFFEEEEF0,
-0xFFEDEDED,
-0xFFECECEC,
-0xFFECECEC,
-0xFFEBECEE,
-0xFFEBECEE,
-0xFFE8ECEF,
-0xFFE8ECEF,
-0xFFE1E4E9,
-0xFFE0E3EA,
-0xFFDEE3E9,
-0xFFE0E4ED,
-0xFFE5E9F2,
-0xFFE4EBF3,
-0xFFE0E4ED,
-0xFFD8DDE3,
-0xFFE7E8EA,
-0xFFEFF0F2,
-0xFFEBEEF3,
-0xFFAFB6BC,
-0xFFD7E1E3,
-0xFFD6E1E3,
-0xFFD5DDE0,
-0xFFEEDBCD,
-0xFFFFCC9D,
-0xFFB83E0D,
-0xFFCB2A18,
-0xFFEF6769,
-0xFFFFD8E7,
-0xFFD7D6E6,
-0xFFD4DDE6,
-0xFFDAE5E9,
-0xFFE3E8EE,
-0xFFEBEEF5,
-0xFFE5E8EF,
-0xFFDDE0E7,
-0xFFD8DBE2,
-0xFFDFE2E9,
-0xFFDDE2E8,
-0xFFDFE4EA,
-0xFFE3E8EC,
-0xFFE4E9ED,
-0xFFE6EAED,
-0xFFE6EAED,
-0xFFE6EAEB,
-0xFFE5E9EA,
-0xFFE2E6E7,
-0xFFDEE2E5,
-0xFFDDE0E5,
-0xFFDEE1E8,
-0xFFE2E5EA,
-0xFFE5E8ED,
-0xFFE6E7EC,
-0xFFE4E5EA,
-0xFFE7E6EC,
-0xFFEBEAF0,
-0xFFE4E3E9,
-0xFFE4E3E9,
-0xFFE5E4EA,
-0xFFE5E6EB,
-0xFFE6E7EC,
-0xFFE4E4EC,
-0xFFE1E1E9,
-0xFFDEDEE6,
-0xFFDBDEE3,
-0xFFDEE1E6,
-0xFFDDE0E5,
-0xFFDCDFE4,
-0xFFDFE2E7,
-0xFFE0E3E8,
-0xFFE0E1E6,
-0xFFDFE0E5,
-0xFFDFE0E5,
-0xFFE0E1E5,
-0xFFE2E1E6,
-0xFFE5E4E9,
-0xFFE7E6EB,
-0xFFE7E7E9,
-0xFFE6E6E8,
-0xFFE4E5E7,
-0xFFE3E7EA,
-0xFFDEE2E5,
-0xFFDFE2E7,
-0xFFE3E7EA,
-0xFFE3E6EB,
-0xFFE4E8EB,
-0xFFE2E7EB,
-0xFFDDE2E6,
-0xFFDBE3E6,
-0xFFDAE1E7,
-0xFFD8E1E6,
-0xFFD8E1E8,
-0xFFD8E3E9,
-0xFFD5DFE8,
-0xFFD2DCE5,
-0xFFD2DBE4,
-0xFFD6DAE3,
-0xFFD6D9E0,
-0xFFD5D8E1,
-0xFFD4D7E0,
-0xFFD4D6E2,
-0xFFD2D6E1,
-0xFFD1D3DF,
-0xFFCED2DD,
-0xFFCDD1DC,
-0xFFCED2DD,
-0xFFC9D0DA,
-0xFFC6CDD7,
-0xFFC7CED8,
-0xFFCCD3DB,
-0xFFCFD6DE,
-0xFFCED5DD,
-0xFFCDD1DC,
-0xFFCED2DD,
-0xFFC8D0DB,
-0xFFCFD8DF,
-0xFFC6CED0,
-0xFFBBC0C3,
-0xFFCACDD4,
-0xFFC9CDD6,
-0xFFCCD3DB,
-0xFFCBD4DB,
-0xFFD3DAE2,
-0xFFDBE0E4,
-0xFFDADEDD,
-0xFFD6DAD9,
-0xFFD1D9DC,
-0xFFD0D9DE,
-0xFFBCC7D9,
-0xFFBECADA,
-0xFFB3BCCD,
-0xFFC7D1DD,
-0xFFDEE4F0,
-0xFFD8DFE9,
-0xFFE3E7F0,
-0xFFD9DEE4,
-0xFFD6DBE1,
-0xFFD0D5DB,
-0xFFE4E9ED,
-0xFFE5EAED,
-0xFFD4D8D9,
-0xFFDADEDF,
-0xFFE4E6E5,
-0xFFDFE1E0,
-0xFFDFE3E6,
-0xFFDFE4E8,
-0xFFD7DEE4,
-0xFFD3DAE2,
-0xFFD2D9E1,
-0xFFD5DEE7,
-0xFFCDD6DD,
-0xFFC3CCD3,
-0xFFC9D2D7,
-0xFFD3DCE1,
-0xFFDFE6EC,
-0xFFE5E9F2,
-0xFFE1E3EF,
-0xFFD9DBE8,
-0xFFD5D4E6,
-0xFFD0D2E1,
-0xFFD1D9E4,
-0xFFD3DDE6,
-0xFFD3DDE6,
-0xFFD1DBE4,
-0xFFCFD8E1,
-0xFFCED7E0,
-0xFFD2DBE4,
-0xFFD6DFE8,
-0xFFDCE3ED,
-0xFFD8DFE9,
-0xFFD9E0EA,
-0xFFDDE4EE,
-0xFFDAE1EB,
-0xFFD2D9E3,
-0xFFCFD6E0,
-0xFFD4DBE5,
-0xFFD1D8E2,
-0xFFD8DFE9,
-0xFFD5DCE6,
-0xFFD9E0EA,
-0xFFDAE1EB,
-0xFFD7DEE6,
-0xFFDDE1EA,
-0xFFD8DCE5,
-0xFFDBDFE8,
-0xFFDCE0E9,
-0xFFDCE0E9,
-0xFFD8DCE5,
-0xFFD2D6DF,
-0xFFD0D4DF,
-0xFFD6DAE5,
-0xFFDEE1EA,
-0xFFDCDFE4,
-0xFFDBDFE2,
-0xFFDDE1E4,
-0xFFE1E5E8,
-0xFFE1E4E9,
-0xFFDEE3E7,
-0xFFDEE1E6,
-0xFFDFE4E8,
-0xFFDDE2E6,
-0xFFDDE2E6,
-0xFFDCE1E5,
-0xFFDDE2E6,
-0xFFDFE4E8,
-0xFFE0E5E9,
-0xFFDFE3E6,
-0xFFDDE1E4,
-0xFFDFE2E7,
-0xFFDEE1E6,
-0xFFDFE4EA,
-0xFFDCE3ED,
-0xFFE0E6F6,
-0xFFB2B8CE,
-0xFF353A58,
-0xFF393E64,
-0xFF3C416B,
-0xFF292D5A,
-0xFF3F4370,
-0xFF3B406A,
-0xFF393C65,
-0xFF30335C,
-0xFF2D3157,
-0xFF2C3053,
-0xFF313550,
-0xFF24263D,
-0xFF27283D,
-0xFF232136,
-0xFF16172B,
-0xFF151726,
-0xFF121423,
-0xFF151422,
-0xFF1A1422,
-0xFF140C19,
-0xFF030009,
-0xFFD3D2DA,
-0xFFE4E7EE,
-0xFFDBE0E6,
-0xFFD8DBE2,
-0xFFDADFE5,
-0xFFD0D7DF,
-0xFFD5DEE5,
-0xFFD2DBE2,
-0xFFD6DFE6,
-0xFFD5DCE6,
-0xFFD4DBE5,
-0xFFD1D8E2,
-0xFFD8DFE9,
-0xFFD5DCE4,
-0xFFD8DFE7,
-0xFFDAE1E9,
-0xFFD9E0E8,
-0xFFD6DDE3,
-0xFFD6DDE3,
-0xFFDADFE5,
-0xFFDCE1E7,
-0xFFDBE2EA,
-0xFFDAE3EA,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDCE3EB,
-0xFFDBE2EA,
-0xFFDAE1E7,
-0xFFDAE1E7,
-0xFFDFE4EA,
-0xFFE0E5E9,
-0xFFE4E7EC,
-0xFFE6E9EE,
-0xFFE7E8EC,
-0xFFE6E7EB,
-0xFFEAE9EE,
-0xFFECEDF1,
-0xFFEAEEF1,
-0xFFE5E9EC,
-0xFFE3E7EA,
-0xFFE5E9EC,
-0xFFE6EAED,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE7EBEE,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFDCE1E4,
-0xFFDDE2E5,
-0xFFDCE1E4,
-0xFFDBE0E3,
-0xFFE2E7EA,
-0xFFE5E9EC,
-0xFFEAEBEF,
-0xFFECEDF1,
-0xFFEBEFF2,
-0xFFE9EDF0,
-0xFFE8ECEF,
-0xFFE8ECEF,
-0xFFE6EAED,
-0xFFE4E8EB,
-0xFFE3E6EB,
-0xFFE2E5EA,
-0xFFE1E4E9,
-0xFFE1E4E9,
-0xFFE1E4E9,
-0xFFE4E7EC,
-0xFFE7EAEF,
-0xFFE9ECF1,
-0xFFEDEEF3,
-0xFFEEEFF3,
-0xFFECEDF1,
-0xFFE9EAEE,
-0xFFE8E9ED,
-0xFFEBECF0,
-0xFFEBECF0,
-0xFFEAEBEF,
-0xFFE8E9ED,
-0xFFEAEBEF,
-0xFFEAEBEF,
-0xFFE8E9ED,
-0xFFE5E6EA,
-0xFFE3E4E8,
-0xFFE5E6EA,
-0xFFE8E9ED,
-0xFFEEEEF0,
-0xFFEDEDED,
-0xFFECECEC,
-0xFFEBEBEB,
-0xFFEAEBED,
-0xFFEAEBED,
-0xFFE8ECEF,
-0xFFE7EBEE,
-0xFFE1E4EB,
-0xFFDBDEE5,
-0xFFD8DCE5,
-0xFFDBDFE8,
-0xFFDBE2EC,
-0xFFD9E0EA,
-0xFFD8DFE9,
-0xFFDCE0E9,
-0xFFE6E7EB,
-0xFFF1F1F3,
-0xFFEDEEF2,
-0xFFAFB4B8,
-0xFFD0DBDF,
-0xFFD1DCDE,
-0xFFD2D8D4,
-0xFFF5D4C3,
-0xFFF88A65,
-0xFFC43411,
-0xFFBF362C,
-0xFFFFB0B8,
-0xFFEBC8DC,
-0xFFCDCEE2,
-0xFFD0D8E3,
-0xFFD0DBDF,
-0xFFDDE2E8,
-0xFFE7EAF1,
-0xFFE4E7EE,
-0xFFDEE1E8,
-0xFFDDE0E7,
-0xFFE0E3EA,
-0xFFDCE1E7,
-0xFFDDE2E8,
-0xFFE3E8EC,
-0xFFE3E8EC,
-0xFFE4E8EB,
-0xFFE3E7EA,
-0xFFE3E7EA,
-0xFFE3E7E8,
-0xFFE2E6E9,
-0xFFDFE4E7,
-0xFFE0E5EB,
-0xFFDDE1EA,
-0xFFDFE4EA,
-0xFFE6E9F0,
-0xFFE9ECF1,
-0xFFE9EAEF,
-0xFFE8E7ED,
-0xFFEAE9EF,
-0xFFE7E6EC,
-0xFFE4E3E9,
-0xFFE0DFE5,
-0xFFDFDFE7,
-0xFFDFDFE7,
-0xFFDCDFE8,
-0xFFDADDE6,
-0xFFD8DBE4,
-0xFFD6D9E2,
-0xFFD9DCE3,
-0xFFD8DBE4,
-0xFFD7DAE1,
-0xFFDBDEE7,
-0xFFDEE1E8,
-0xFFE0E0EA,
-0xFFDFDFE7,
-0xFFDFDFE7,
-0xFFDFE0E5,
-0xFFE1E0E6,
-0xFFE2E1E7,
-0xFFE2E1E7,
-0xFFE2E1E6,
-0xFFE2E1E6,
-0xFFE3E2E7,
-0xFFE3E4E9,
-0xFFDEE1E6,
-0xFFDFE2E7,
-0xFFE0E3E8,
-0xFFDFE2E7,
-0xFFDFE2E7,
-0xFFDEE1E6,
-0xFFDCE1E5,
-0xFFDBE0E6,
-0xFFD6DDE3,
-0xFFD3DAE2,
-0xFFD2D9E1,
-0xFFD3DCE5,
-0xFFD5DEE7,
-0xFFD5DEE7,
-0xFFD6DDE7,
-0xFFD8DCE5,
-0xFFD9DCE5,
-0xFFD8DBE4,
-0xFFD8DAE6,
-0xFFD9DBE7,
-0xFFD8DCE8,
-0xFFD7DBE7,
-0xFFD6DAE6,
-0xFFD0D6E2,
-0xFFD1D7E3,
-0xFFCFD7E2,
-0xFFCCD4DF,
-0xFFCDD5E0,
-0xFFCDD6DF,
-0xFFC9D2DB,
-0xFFC3CCD5,
-0xFFC2C8D4,
-0xFFC5CDDA,
-0xFFC5CEDD,
-0xFFC1CBD7,
-0xFFC0C7CF,
-0xFFB6BBC1,
-0xFFC2C6D1,
-0xFFC9CDD9,
-0xFFC5CDD8,
-0xFFC7CFDA,
-0xFFCFD7E2,
-0xFFD5DCE4,
-0xFFD7DBDE,
-0xFFD4D9DC,
-0xFFCFD8DD,
-0xFFCCD7DD,
-0xFFA6B7CB,
-0xFFA9B8CB,
-0xFFA5B2C5,
-0xFFAFBCCC,
-0xFFCFD8E7,
-0xFFC8D2DE,
-0xFFD1DBE5,
-0xFFC3CDD7,
-0xFFB6C0CA,
-0xFFB7C1CA,
-0xFFD0D9E0,
-0xFFD4DDE2,
-0xFFC9D1D4,
-0xFFD3DBDE,
-0xFFE1E6E9,
-0xFFE3E7EA,
-0xFFE3E8EE,
-0xFFE7ECF2,
-0xFFD4DBE3,
-0xFFCCD3DB,
-0xFFC8D1D8,
-0xFFCED9DF,
-0xFFCCD6DF,
-0xFFBDC7D0,
-0xFFBBC5CE,
-0xFFC0CAD3,
-0xFFC8D0DB,
-0xFFCFD7E2,
-0xFFD1D7E3,
-0xFFCFD5E1,
-0xFFD2D6E2,
-0xFFD3D9E5,
-0xFFD2DBE4,
-0xFFD1DAE3,
-0xFFD1DAE3,
-0xFFCFD8E1,
-0xFFCDD4DC,
-0xFFCBD2DA,
-0xFFD0D7DF,
-0xFFD5DCE4,
-0xFFDCE0E9,
-0xFFDADEE7,
-0xFFDADEE7,
-0xFFDCE0E9,
-0xFFDADEE7,
-0xFFD5D9E2,
-0xFFD0D4DD,
-0xFFCFD3DC,
-0xFFCFD6E0,
-0xFFD3DAE4,
-0xFFD1D8E0,
-0xFFD8DFE7,
-0xFFE0E4ED,
-0xFFE2E6EF,
-0xFFE3E7F0,
-0xFFDDE2E8,
-0xFFDEE1E8,
-0xFFE0E3EA,
-0xFFE0E3EA,
-0xFFDADDE4,
-0xFFD4D7DE,
-0xFFD3D6DF,
-0xFFD4D7E0,
-0xFFD5D8E1,
-0xFFD8DBE2,
-0xFFD8DDE1,
-0xFFDCE1E5,
-0xFFE0E5E9,
-0xFFE2E7ED,
-0xFFDEE5EB,
-0xFFDDE2E8,
-0xFFDAE1E7,
-0xFFD8DFE5,
-0xFFD8DFE5,
-0xFFD8DFE7,
-0xFFD8DFE7,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDAE1E9,
-0xFFD8DFE7,
-0xFFD7DBE6,
-0xFFD9DDE9,
-0xFFD8DBEA,
-0xFFD9DEF1,
-0xFFE8ECFF,
-0xFF424765,
-0xFF3C4266,
-0xFF454C76,
-0xFF3A416F,
-0xFF3C4371,
-0xFF474B78,
-0xFF40456D,
-0xFF363A60,
-0xFF404467,
-0xFF3A3D5E,
-0xFF333856,
-0xFF29304A,
-0xFF272D43,
-0xFF1C1E33,
-0xFF1B1C30,
-0xFF1D2033,
-0xFF191C2B,
-0xFF161827,
-0xFF141321,
-0xFF110B19,
-0xFF0D0713,
-0xFF04010C,
-0xFFBDBDC5,
-0xFFE2E9EF,
-0xFFD9E3E5,
-0xFFDCE4E7,
-0xFFD3DAE0,
-0xFFD1DAE1,
-0xFFDAE3EC,
-0xFFD1DAE3,
-0xFFCFD8E1,
-0xFFD6DDE7,
-0xFFD7DEE8,
-0xFFD9DDE6,
-0xFFD9DDE6,
-0xFFDEE2EB,
-0xFFE1E5EE,
-0xFFE2E6EF,
-0xFFDFE3EC,
-0xFFDADFE5,
-0xFFD7DCE2,
-0xFFD8DDE3,
-0xFFD9DEE4,
-0xFFD3DAE2,
-0xFFD3DAE2,
-0xFFD4DBE3,
-0xFFD7DEE6,
-0xFFD9E0E8,
-0xFFDAE1E9,
-0xFFDDE1EA,
-0xFFDDE2E8,
-0xFFDDE2E8,
-0xFFDFE4EA,
-0xFFE1E4E9,
-0xFFE2E5EA,
-0xFFE4E5EA,
-0xFFE6E7EC,
-0xFFE9EAEF,
-0xFFEBECF1,
-0xFFE9EDF0,
-0xFFE7EBEE,
-0xFFE5E9EC,
-0xFFE4E8EB,
-0xFFE4E8EB,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE6EAED,
-0xFFE5E9EC,
-0xFFE4E8EB,
-0xFFDBDEE3,
-0xFFDCDFE4,
-0xFFDDE0E5,
-0xFFDBDEE3,
-0xFFE2E5EA,
-0xFFE1E5E8,
-0xFFE8E9ED,
-0xFFEAEBED,
-0xFFEBECEE,
-0xFFE9EAEC,
-0xFFE9EAEE,
-0xFFE9EAEE,
-0xFFE5E9EC,
-0xFFE2E6E9,
-0xFFDFE2E7,
-0xFFDFE2E7,
-0xFFDEE1E6,
-0xFFDEE1E6,
-0xFFDFE2E7,
-0xFFE1E4E9,
-0xFFE3E6EB,
-0xFFE5E8ED,
-0xFFE7E8EC,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE6E7E9,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE7E8EA,
-0xFFE6E7E9,
-0xFFE5E6E8,
-0xFFE5E6E8,
-0xFFE7E8EA,
-0xFFE9EAEC,
-0xFFECECEC,
-0xFFEBEBEB,
-0xFFEAEAEA,
-0xFFEAEAEA,
-0xFFE9EAEC,
-0xFFE8E9EB,
-0xFFE6EAED,
-0xFFE6EAED,
-0xFFE4E7EE,
-0xFFDDE0E7,
-0xFFD7DBE4,
-0xFFD5D9E2,
-0xFFD3D7E2,
-0xFFCED2DD,
-0xFFCCD3DD,
-0xFFD2D6DF,
-0xFFE2E5EC,
-0xFFEEF1F6,
-0xFFEAEFF2,
-0xFFACB6B7,
-0xFFC8D7DC,
-0xFFCDD9D9,
-0xFFD5D6C6,
-0xFFFFD2B8,
-0xFFCE4630,
-0xFFD53C2C,
-0xFFC76361,
-0xFFF8C3CB,
-0xFFDFCEDE,
-0xFFCFD5E5,
-0xFFCCD5DE,
-0xFFD3DCE1,
-0xFFD7DCE2,
-0xFFDEE1E6,
-0xFFDEE1E8,
-0xFFDADDE4,
-0xFFDFE2E9,
-0xFFDFE2E9,
-0xFFDDE0E5,
-0xFFDDE0E5,
-0xFFE0E3E8,
-0xFFE1E4E9,
-0xFFE1E4E9,
-0xFFE0E3E8,
-0xFFDEE3E7,
-0xFFDEE3E6,
-0xFFDEE3E7,
-0xFFDCE1E5,
-0xFFDFE6EC,
-0xFFDCE3EB,
-0xFFDCE3E9,
-0xFFE1E6EC,
-0xFFE4E7EC,
-0xFFE1E4E9,
-0xFFE1E2E6,
-0xFFE1E2E6,
-0xFFE3E4E9,
-0xFFDFE0E5,
-0xFFDCDCE4,
-0xFFD9DCE3,
-0xFFD6DAE3,
-0xFFD4D8E3,
-0xFFD0D7E1,
-0xFFCFD5E1,
-0xFFCED6E1,
-0xFFCFD7E2,
-0xFFCFD5E3,
-0xFFD0D6E2,
-0xFFD4DAE8,
-0xFFD7DDE9,
-0xFFD9DCEB,
-0xFFDADEEA,
-0xFFD9DBE8,
-0xFFDADCE8,
-0xFFDBDDE9,
-0xFFDCDFE8,
-0xFFDEDEE8,
-0xFFDDDDE5,
-0xFFDEDEE6,
-0xFFE0E0E8,
-0xFFDCDFE6,
-0xFFDDE0E7,
-0xFFDEDEE6,
-0xFFDEDEE6,
-0xFFDFDFE7,
-0xFFDDDDE5,
-0xFFDCDCE4,
-0xFFDCDFE6,
-0xFFDDE0E7,
-0xFFD8DBE2,
-0xFFD4D7DE,
-0xFFD0D5DB,
-0xFFCED2DB,
-0xFFCED2DB,
-0xFFCCD3DB,
-0xFFCAD1DB,
-0xFFCACED9,
-0xFFCBCFDA,
-0xFFCCD0DB,
-0xFFCAD0DC,
-0xFFC9CFDB,
-0xFFC7CDDB,
-0xFFC5CDDA,
-0xFFC5CDDA,
-0xFFC8D1E0,
-0xFFC7D0DF,
-0xFFC5D1E1,
-0xFFC6D2E2,
-0xFFC7D3E3,
-0xFFC3CFDD,
-0xFFBBC9D6,
-0xFFB6C2D0,
-0xFFBAC3D4,
-0xFFBCC8D8,
-0xFFB9C6D7,
-0xFFB2BECE,
-0xFFB6BECB,
-0xFFB3B9C5,
-0xFFB8BBCA,
-0xFFC0C6D6,
-0xFFC2CBDC,
-0xFFC3CCDD,
-0xFFC6CFE0,
-0xFFCAD2DF,
-0xFFCAD1DB,
-0xFFCAD1D9,
-0xFFC7D1DA,
-0xFFC0CDD6,
-0xFF91A3B7,
-0xFF9AABBF,
-0xFF9DACBF,
-0xFFAAB7C8,
-0xFFB6C2D2,
-0xFFC4D0DE,
-0xFFB7C3D1,
-0xFFB8C4D0,
-0xFFB7C3CF,
-0xFFB3BFCB,
-0xFFB9C3CD,
-0xFFBAC4CD,
-0xFFC9D2D9,
-0xFFD9E2E9,
-0xFFD9E0E6,
-0xFFDEE3E9,
-0xFFE2E7ED,
-0xFFD9DDE6,
-0xFFC6CAD3,
-0xFFD1D8E0,
-0xFFD7E0E9,
-0xFFD6E0E9,
-0xFFCCD9E2,
-0xFFBDCAD3,
-0xFFB6C3CC,
-0xFFB9C6CF,
-0xFFC1CED7,
-0xFFCED8E2,
-0xFFD2DCE5,
-0xFFD2DBE2,
-0xFFD2DBE2,
-0xFFD4DDE4,
-0xFFD4DDE6,
-0xFFCED7E0,
-0xFFCAD3DC,
-0xFFCBD4DD,
-0xFFCCD3DB,
-0xFFCBD2DA,
-0xFFCDD4DC,
-0xFFD1D8E0,
-0xFFD8DCE5,
-0xFFD7DBE4,
-0xFFD7DBE4,
-0xFFD8DCE5,
-0xFFDADEE7,
-0xFFDADEE7,
-0xFFD4D8E1,
-0xFFCFD3DC,
-0xFFD1D8E2,
-0xFFCFD6DE,
-0xFFCAD1D9,
-0xFFCED5DD,
-0xFFDADEE7,
-0xFFE1E6EC,
-0xFFE4E9EF,
-0xFFDFE4EA,
-0xFFDEE1E8,
-0xFFE2E5EC,
-0xFFE3E6ED,
-0xFFDEE1E8,
-0xFFDCDFE6,
-0xFFDDE0E7,
-0xFFDBDEE7,
-0xFFD6DAE3,
-0xFFD6DAE3,
-0xFFD6DBE1,
-0xFFD5DCE4,
-0xFFD6DDE5,
-0xFFD7DEE6,
-0xFFD5DCE4,
-0xFFD2D9E1,
-0xFFD0D7DF,
-0xFFCFD8DF,
-0xFFCFD8E1,
-0xFFCED7E0,
-0xFFCFD8E1,
-0xFFD1DAE3,
-0xFFD3DCE5,
-0xFFD3DBE6,
-0xFFD2DAE5,
-0xFFD0D6E2,
-0xFFCFD5E3,
-0xFFD0D5E8,
-0xFFD6DCF2,
-0xFFA3A8C6,
-0xFF313759,
-0xFF373F66,
-0xFF353C68,
-0xFF414876,
-0xFF383F6D,
-0xFF3D416E,
-0xFF373C64,
-0xFF3B3F64,
-0xFF323757,
-0xFF323554,
-0xFF2D324F,
-0xFF262D47,
-0xFF272F46,
-0xFF22273D,
-0xFF222439,
-0xFF252839,
-0xFF1A1D2C,
-0xFF0E101D,
-0xFF1A1A26,
-0xFF1A1722,
-0xFF18121C,
-0xFF000007,
-0xFFE9ECF3,
-0xFFDEE7EC,
-0xFFDDE8EC,
-0xFFD5DEE3,
-0xFFD7E0E7,
-0xFFD4DDE6,
-0xFFD1DAE3,
-0xFFD3DCE5,
-0xFFD7E0E9,
-0xFFD5DCE6,
-0xFFD5DCE6,
-0xFFE6EAF3,
-0xFFDBDFE8,
-0xFFD9DDE6,
-0xFFD9DDE6,
-0xFFD8DCE5,
-0xFFD6DBE1,
-0xFFD6DBE1,
-0xFFD9DEE4,
-0xFFDDE2E8,
-0xFFE0E5EB,
-0xFFDBE0E6,
-0xFFD6DBE1,
-0xFFD2D7DD,
-0xFFCED5DD,
-0xFFD2D6DF,
-0xFFD5D9E2,
-0xFFD9DDE6,
-0xFFDDE1EA,
-0xFFDDE2E8,
-0xFFDFE4EA,
-0xFFDFE2E9,
-0xFFDDE0E5,
-0xFFDDE0E7,
-0xFFE2E5EA,
-0xFFE5E6EB,
-0xFFE2E5EA,
-0xFFE2E5EA,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE1E5E8,
-0xFFE1E5E8,
-0xFFE5E9EC,
-0xFFE8ECEF,
-0xFFE7EBEE,
-0xFFE6E9EE,
-0xFFE3E6EB,
-0xFFD9DCE1,
-0xFFDFE2E7,
-0xFFE3E6EB,
-0xFFE1E4E9,
-0xFFE3E6EB,
-0xFFDCDFE4,
-0xFFE3E4E8,
-0xFFE6E7E9,
-0xFFE8E9EB,
-0xFFE7E8EA,
-0xFFE7E8EC,
-0xFFE7E8EC,
-0xFFE3E7EA,
-0xFFE0E4E7,
-0xFFDCDFE4,
-0xFFDCDFE4,
-0xFFDCDFE4,
-0xFFDDE0E5,
-0xFFDDE0E5,
-0xFFDEE1E6,
-0xFFDFE2E7,
-0xFFE0E4E7,
-0xFFE4E5E7,
-0xFFE3E4E6,
-0xFFE5E6E8,
-0xFFE9EAEC,
-0xFFEBECEE,
-0xFFE9EAEC,
-0xFFE8E9EB,
-0xFFE9EAEC,
-0xFFEBECEE,
-0xFFE9EAEC,
-0xFFE7E8EA,
-0xFFE6E7E9,
-0xFFE7E8EA,
-0xFFE8E9EB,
-0xFFE9EAEC,
-0xFFE9EAEC,
-0xFFEAEBED,
-0xFFE9EBEA,
-0xFFE9E9EB,
-0xFFE8E9EB,
-0xFFE8E9EB,
-0xFFE8E9EB,
-0xFFE5E9EC,
-0xFFE5E8ED,
-0xFFE2E5EC,
-0xFFE0E3EA,
-0xFFDCE0E9,
-0xFFDADEE7,
-0xFFD8DCE7,
-0xFFD5D9E4,
-0xFFD0D4DF,
-0xFFCCD0D9,
-0xFFDEE2EB,
-0xFFECF1F7,
-0xFFE9F1F3,
-0xFFADB7B8,
-0xFFC8D5DD,
-0xFFCDD6D1,
-0xFFDBD5B5,
-0xFFFFD0AA,
-0xFFAC1907,
-0xFFB41C17,
-0xFFFFBABC,
-0xFFEAD5DE,
-0xFFDBD8E3,
-0xFFD6DDE7,
-0xFFD9E0E6,
-0xFFD7DCDF,
-0xFFD6D9DE,
-0xFFD8DBE0,
-0xFFD7DADF,
-0xFFD3D6DB,
-0xFFDDE0E7,
-0xFFDBDEE3,
-0xFFDCDFE4,
-0xFFDEE1E6,
-0xFFDCDFE4,
-0xFFDDE0E5,
-0xFFDEE1E6,
-0xFFDDE0E7,
-0xFFDBE0E6,
-0xFFDADFE5,
-0xFFD8DDE3,
-0xFFD4DBE1,
-0xFFD5DEE3,
-0xFFD6DFE4,
-0xFFD6DFE4,
-0xFFD6DDE3,
-0xFFD6DBDF,
-0xFFD5DADE,
-0xFFD6DADD,
-0xFFD8DCDF,
-0xFFD5D8DD,
-0xFFD4D9DF,
-0xFFD5DAE0,
-0xFFD3DAE2,
-0xFFD0D9E2,
-0xFFCBD5DF,
-0xFFC8D2DC,
-0xFFC6D2DE,
-0xFFC2CEDC,
-0xFFC1CDDB,
-0xFFC0CCDC,
-0xFFC6CFDE,
-0xFFCBD4E5,
-0xFFCAD3E2,
-0xFFCAD3E4,
-0xFFCED5E5,
-0xFFD0D7E7,
-0xFFD3D9E7,
-0xFFD6DCEA,
-0xFFD9DFEB,
-0xFFD9DFEB,
-0xFFD8DFE9,
-0xFFD9DDE8,
-0xFFDADEE9,
-0xFFD9DDE8,
-0xFFDBDFE8,
-0xFFDBDEE7,
-0xFFDADDE4,
-0xFFDCDFE6,
-0xFFDADDE4,
-0xFFD8DBE2,
-0xFFDBDEE5,
-0xFFDBDBE3,
-0xFFD7DAE1,
-0xFFD6D9E0,
-0xFFD6D9E0,
-0xFFD4D7DE,
-0xFFD3D6DD,
-0xFFD0D4DD,
-0xFFCCD0D9,
-0xFFCACED9,
-0xFFCAD0DC,
-0xFFCDD3DF,
-0xFFCDD3DF,
-0xFFC9D1DE,
-0xFFC4CCD9,
-0xFFC1CAD9,
-0xFFC1CAD9,
-0xFFBBC7D7,
-0xFFB5C0D2,
-0xFFB1BECF,
-0xFFB5C2D5,
-0xFFB7C4D7,
-0xFFB3C2D5,
-0xFFB1C1D1,
-0xFFB2C2D2,
-0xFFB1BECF,
-0xFFB5C4D7,
-0xFFAEBFD1,
-0xFFACBCCC,
-0xFFAFBBC9,
-0xFFB7BECE,
-0xFFACB2C2,
-0xFFB4BBCD,
-0xFFB3BED2,
-0xFFB2BED4,
-0xFFB5C0D4,
-0xFFB6C1D3,
-0xFFBBC4D3,
-0xFFC1CBD7,
-0xFFC0CCDA,
-0xFFBAC8D5,
-0xFFA8B9CB,
-0xFFAABBCB,
-0xFFB8C8D8,
-0xFFB7C4D4,
-0xFFB5C1D1,
-0xFFC0CCDA,
-0xFFC1CDDB,
-0xFFC8D4E2,
-0xFFC0CCDA,
-0xFFBFCBD9,
-0xFFCBD7E3,
-0xFFC9D3DF,
-0xFFC2CAD5,
-0xFFD1D9E4,
-0xFFD2D9E3,
-0xFFD4D8E1,
-0xFFD6DBE1,
-0xFFD0D5DB,
-0xFFD7DBE4,
-0xFFCFD6E0,
-0xFFCFD7E2,
-0xFFCED8E2,
-0xFFCAD6E2,
-0xFFC9D5E1,
-0xFFC0CED7,
-0xFFC1D0D7,
-0xFFC1D0D7,
-0xFFC5D3D6,
-0xFFC3D1D2,
-0xFFC8D4D4,
-0xFFC7D3D1,
-0xFFCCD6D7,
-0xFFCFD8DF,
-0xFFD2D9E3,
-0xFFCFD6E0,
-0xFFCDD4DE,
-0xFFD1D8E0,
-0xFFD4DBE3,
-0xFFD6DDE5,
-0xFFDAE1E9,
-0xFFDDE1EA,
-0xFFDDE1EA,
-0xFFD9DDE6,
-0xFFDADEE7,
-0xFFD8DCE5,
-0xFFD4D8E1,
-0xFFD8DBE4,
-0xFFD3D7E0,
-0xFFD2D9E1,
-0xFFCFD6DE,
-0xFFC8CFD7,
-0xFFC8CFD5,
-0xFFD4D9DF,
-0xFFDDE2E8,
-0xFFDFE4EA,
-0xFFDFE4E8,
-0xFFDBE0E4,
-0xFFDDE2E6,
-0xFFDFE4EA,
-0xFFE0E5EB,
-0xFFDFE4EA,
-0xFFDDE2E8,
-0xFFDCE1E7,
-0xFFDBDFE8,
-0xFFD7DBE4,
-0xFFD4DBE3,
-0xFFD3DAE4,
-0xFFD3DAE4,
-0xFFD4DBE5,
-0xFFD3DAE4,
-0xFFCED5DF,
-0xFFC8CFD9,
-0xFFC5CED7,
-0xFFC4CCD7,
-0xFFC2CAD5,
-0xFFC2CAD5,
-0xFFC2CCD6,
-0xFFC5CFD9,
-0xFFC7D1DD,
-0xFFCAD2DD,
-0xFFCCD5DE,
-0xFFCAD2DD,
-0xFFCBD2E4,
-0xFFD3D9EF,
-0xFF5D6280,
-0xFF373D5F,
-0xFF323A61,
-0xFF313862,
-0xFF363D69,
-0xFF39406C,
-0xFF383D67,
-0xFF383D65,
-0xFF34385E,
-0xFF2D3154,
-0xFF2E3152,
-0xFF2B304E,
-0xFF282F4C,
-0xFF2A2F4C,
-0xFF262A43,
-0xFF1D1F34,
-0xFF131929,
-0xFF141A26,
-0xFF1B1F28,
-0xFF20232A,
-0xFF1D1C22,
-0xFF100D14,
-0xFF000005,
-0xFFECEFF6,
-0xFFD3DCE3,
-0xFFD3E0E8,
-0xFFD0DAE3,
-0xFFD0DAE4,
-0xFFD5DEE7,
-0xFFD3DCE5,
-0xFFCFD6DE,
-0xFFCFD6DE,
-0xFFD7DBE4,
-0xFFDADEE7,
-0xFFDCDFE8,
-0xFFDDE0E9,
-0xFFDBDEE5,
-0xFFD7DAE1,
-0xFFD6D9E0,
-0xFFD8DBE2,
-0xFFDADDE4,
-0xFFDADDE2,
-0xFFDDE0E5,
-0xFFE1E4E9,
-0xFFE4E7EC,
-0xFFE0E3E8,
-0xFFDADDE2,
-0xFFD5DAE0,
-0xFFD9DCE3,
-0xFFD9DEE4,
-0xFFD8DDE3,
-0xFFD9DEE4,
-0xFFDDE1EA,
-0xFFDFE3EC,
-0xFFDFE3EC,
-0xFFDCE1E7,
-0xFFD7DBE4,
-0xFFD7DCE2,
-0xFFDDE0E7,
-0xFFE3E6EB,
-0xFFDADDE2,
-0xFFDEE1E6,
-0xFFDFE2E7,
-0xFFDFE2E7,
-0xFFDFE2E7,
-0xFFE3E6EB,
-0xFFE6E9EE,
-0xFFE7EAEF,
-0xFFE3E6ED,
-0xFFDFE2E9,
-0xFFDDE0E7,
-0xFFE0E3EA,
-0xFFE2E5EC,
-0xFFDFE2E9,
-0xFFDBDEE5,
-0xFFDBDEE3,
-0xFFE2E3E7,
-0xFFE7E7E9,
-0xFFE8E9ED,
-0xFFE6E7EB,
-0xFFE6E7EB,
-0xFFE7E8EC,
-0xFFE1E4E9,
-0xFFDCDFE4,
-0xFFDCDFE4,
-0xFFDBDEE3,
-0xFFDADDE2,
-0xFFDCDFE4,
-0xFFDFE2E7,
-0xFFDDE0E5,
-0xFFDDE1E4,
-0xFFDFE3E6,
-0xFFE1E2E4,
-0xFFE6E6E6,
-0xFFEAEAEA,
-0xFFECECEC,
-0xFFEEEEEE,
-0xFFEFEFEF,
-0xFFEEF0EF,
-0xFFEEF0EF,
-0xFFEEF0EF,
-0xFFEEF0EF,
-0xFFEEEEEE,
-0xFFEBEBEB,
-0xFFE8E8E8,
-0xFFE8E8E8,
-0xFFEBEBEB,
-0xFFECEDEF,
-0xFFEAEBED,
-0xFFE8ECED,
-0xFFE7E8EC,
-0xFFE5E9EC,
-0xFFE5E9EC,
-0xFFE3E7EA,
-0xFFE0E3E8,
-0xFFE1E4E9,
-0xFFE0E3EA,
-0xFFDDE0E7,
-0xFFDBDEE5,
-0xFFDCDFE6,
-0xFFDCDFE8,
-0xFFDBDFE8,
-0xFFDBDFE8,
-0xFFDCE0E9,
-0xFFE5EAF0,
-0xFFEAEFF3,
-0xFFEBF0F4,
-0xFFB1B6BA,
-0xFFD1D8E2,
-0xFFD8D8D0,
-0xFFF1E4B0,
-0xFFE5A871,
-0xFF9B1300,
-0xFF9E1912,
-0xFFFFE6E9,
-0xFFE1DEE5,
-0xFFE5E8F1,
-0xFFDEE3E9,
-0xFFE4E8E9,
-0xFFE6EAE9,
-0xFFE7E8EA,
-0xFFEAEBEF,
-0xFFE3E4E8,
-0xFFD5D6DA,
-0xFFD2D3D8,
-0xFFD5D6DB,
-0xFFDCDDE2,
-0xFFD8D9DE,
-0xFFD6D6DE,
-0xFFD0D0D8,
-0xFFD4D7DE,
-0xFFD4D7E0,
-0xFFD3D7E0,
-0xFFCED2DB,
-0xFFD0D7DF,
-0xFFCFD6DE,
-0xFFD0D9DE,
-0xFFCFDADC,
-0xFFCDD8DA,
-0xFFCDD7D9,
-0xFFCDD7D9,
-0xFFD0D8DB,
-0xFFD1D9DC,
-0xFFD1D9DC,
-0xFFCDD6DB,
-0xFFD0D9DE,
-0xFFD2DBE2,
-0xFFD0DAE3,
-0xFFCAD7E0,
-0xFFC5D3DE,
-0xFFC3D1DC,
-0xFFC0D0DD,
-0xFFBCCCDB,
-0xFFB4C6D4,
-0xFFB1C2D2,
-0xFFB4C4D3,
-0xFFB4C4D4,
-0xFFB2C2D1,
-0xFFB3C3D3,
-0xFFB9C6D6,
-0xFFBAC7D7,
-0xFFBECAD8,
-0xFFC3CFDD,
-0xFFC6D2E0,
-0xFFC7D3E1,
-0xFFC8D4E0,
-0xFFCBD5E1,
-0xFFCDD7E1,
-0xFFD3DBE6,
-0xFFCDD6DF,
-0xFFD1D8E2,
-0xFFD4DBE3,
-0xFFD1D5DE,
-0xFFD1D5DE,
-0xFFD5DAE0,
-0xFFD2D7DD,
-0xFFD5D8DD,
-0xFFD5D8DD,
-0xFFD4D7DC,
-0xFFD6D9DE,
-0xFFDADDE2,
-0xFFDDE0E5,
-0xFFDCDFE6,
-0xFFD8DDE3,
-0xFFD7DBE4,
-0xFFD6DAE5,
-0xFFD1D8E2,
-0xFFD2D9E3,
-0xFFCAD2DD,
-0xFFC8D0DD,
-0xFFC0C9D8,
-0xFFBDC6D5,
-0xFFB0BCCC,
-0xFFB3BED0,
-0xFFB0BDD0,
-0xFFACB8CE,
-0xFFA7B6CB,
-0xFFA2B1C6,
-0xFFA2B1C8,
-0xFFA6B7CB,
-0xFFA5B6CA,
-0xFFA5B7CB,
-0xFFA0B5C8,
-0xFFA3B6C7,
-0xFFA3B0C0,
-0xFFAFBBC9,
-0xFF9FA8B7,
-0xFFA5AEBF,
-0xFFA0AFC4,
-0xFFA3B3CA,
-0xFFA5B5CC,
-0xFFA5B4C9,
-0xFFA8B5C6,
-0xFFADBACB,
-0xFFAFBFCF,
-0xFFADBECE,
-0xFFB5C5D4,
-0xFFC2D0DD,
-0xFFBDC9D7,
-0xFFC5D1DF,
-0xFFC2CCD8,
-0xFFC5CFDB,
-0xFFCDD7E3,
-0xFFD0DAE6,
-0xFFD3DCEB,
-0xFFCFD8E7,
-0xFFC9D2E1,
-0xFFC1CAD9,
-0xFFC5CDDA,
-0xFFCAD0DC,
-0xFFC9CFDB,
-0xFFD5D9E2,
-0xFFDADFE3,
-0xFFDADDE2,
-0xFFD2D7DD,
-0xFFD3D7E2,
-0xFFCBD1DF,
-0xFFC5CCDE,
-0xFFC7D0E1,
-0xFFC2CEDE,
-0xFFBFCBD7,
-0xFFC5D3DC,
-0xFFC7D4DA,
-0xFFC6D4D7,
-0xFFC6D4D5,
-0xFFC1CFD0,
-0xFFC5D1D1,
-0xFFC4CFD1,
-0xFFC2CBD2,
-0xFFC6CFD8,
-0xFFC8CEDA,
-0xFFC8D1DA,
-0xFFCDD4DE,
-0xFFCFD8DF,
-0xFFD3DAE4,
-0xFFD8DFE7,
-0xFFDAE1EB,
-0xFFD9E0E8,
-0xFFD6DAE3,
-0xFFD5D9E2,
-0xFFD4D8E1,
-0xFFD1D5DE,
-0xFFD5D9E2,
-0xFFD6DAE3,
-0xFFD4DBE3,
-0xFFD4DBE3,
-0xFFD1D8DE,
-0xFFD2D9DF,
-0xFFDADFE5,
-0xFFDDE2E8,
-0xFFDCE1E5,
-0xFFDBE0E4,
-0xFFDBE0E4,
-0xFFDADFE3,
-0xFFD9DEE4,
-0xFFD9DEE4,
-0xFFD9DEE4,
-0xFFD7DEE4,
-0xFFD9DEE4,
-0xFFD8DFE7,
-0xFFD6DDE7,
-0xFFD5DCE6,
-0xFFD4DBE5,
-0xFFD4DBE5,
-0xFFD4DBE5,
-0xFFD3DAE4,
-0xFFD0D7E1,
-0xFFCDD4DE,
-0xFFC7CDD9,
-0xFFC3CBD6,
-0xFFBEC6D1,
-0xFFBBC3CE,
-0xFFB9C1CE,
-0xFFBAC4D0,
-0xFFBCC6D2,
-0xFFBEC8D2,
-0xFFBDC7D0,
-0xFFC3CDD7,
-0xFFBFC8D9,
-0xFFD0D8EF,
-0xFF3C4360,
-0xFF343A5C,
-0xFF31395E,
-0xFF434B72,
-0xFF3F4670,
-0xFF3D426C,
-0xFF363B63,
-0xFF32375F,
-0xFF31355A,
-0xFF2D3154,
-0xFF2D304F,
-0xFF292C4B,
-0xFF272C4A,
-0xFF292D4A,
-0xFF2A2B47,
-0xFF272940,
-0xFF212639,
-0xFF1D2331,
-0xFF171E28,
-0xFF131720,
-0xFF191921,
-0xFF121119,
-0xFF000007,
-0xFFC5C9D2,
-0xFFD7E1EA,
-0xFFCAD7E0,
-0xFFCCD6E0,
-0xFFCAD2DD,
-0xFFCAD3DC,
-0xFFCDD6DF,
-0xFFCED5DD,
-0xFFCFD6DE,
-0xFFD8DCE5,
-0xFFDFE3EC,
-0xFFE1E4ED,
-0xFFE1E4ED,
-0xFFDFE2E9,
-0xFFDDE0E7,
-0xFFDDE0E7,
-0xFFE1E4EB,
-0xFFE4E7EC,
-0xFFE3E6EB,
-0xFFE1E4E9,
-0xFFE0E3E8,
-0xFFE5E6EA,
-0xFFE6E7EB,
-0xFFE1E4E9,
-0xFFDCDFE4,
-0xFFD9DCE3,
-0xFFD5DAE0,
-0xFFD4D9DF,
-0xFFD6DAE3,
-0xFFD6DAE3,
-0xFFD7DBE4,
-0xFFD7DBE4,
-0xFFD4DBE3,
-0xFFD4D8E1,
-0xFFD2D9E1,
-0xFFD9DDE6,
-0xFFDEE3E9,
-0xFFD7DCE2,
-0xFFDBDEE3,
-0xFFDCDFE6,
-0xFFDBDEE3,
-0xFFDCDFE6,
-0xFFE0E3EA,
-0xFFE3E6ED,
-0xFFE4E7EE,
-0xFFE2E5EE,
-0xFFDDE0E7,
-0xFFDADDE6,
-0xFFD9DEE4,
-0xFFDBDEE7,
-0xFFDADFE5,
-0xFFDCDFE8,
-0xFFE0E3EA,
-0xFFE0E1E5,
-0xFFE2E3E7,
-0xFFE5E6EA,
-0xFFE6E7EB,
-0xFFE5E6EB,
-0xFFE0E3E8,
-0xFFDCDFE4,
-0xFFD8DDE1,
-0xFFDBDEE5,
-0xFFDBDEE3,
-0xFFDEE1E6,
-0xFFE4E7EC,
-0xFFE6E9EE,
-0xFFE4E7EC,
-0xFFE0E4E7,
-0xFFDEE2E5,
-0xFFEBECEE,
-0xFFEEEEEE,
-0xFFEFEFEF,
-0xFFEDEFEE,
-0xFFEEEEEE,
-0xFFEEF0EF,
-0xFFEEF0EF,
-0xFFEEF0EF,
-0xFFEDEEF0,
-0xFFEDEFEE,
-0xFFECEEED,
-0xFFE9EBEA,
-0xFFE8E8E8,
-0xFFE7E7E7,
-0xFFE9E9E9,
-0xFFEBECEE,
-0xFFE9EDF0,
-0xFFE8ECEF,
-0xFFE5E8ED,
-0xFFE4E8EB,
-0xFFE5E8ED,
-0xFFE2E5EA,
-0xFFDEE1E6,
-0xFFDDE2E8,
-0xFFDFE2E9,
-0xFFDBE0E6,
-0xFFDADDE6,
-0xFFD8DCE5,
-0xFFD8DBE4,
-0xFFD7DBE4,
-0xFFD7DBE6,
-0xFFD8DCE5,
-0xFFE4E7EC,
-0xFFEDF0F5,
-0xFFECF1F7,
-0xFFADB4BC,
-0xFFD1D5E0,
-0xFFE0D9CF,
-0xFFF0D5A0,
-0xFFD38D52,
-0xFF9F1B02,
-0xFFA62F2B,
-0xFFFFDDE1,
-0xFFD9E2E9,
-0xFFD2D9DF,
-0xFFE3E8EC,
-0xFFE2E6E5,
-0xFFEAECE9,
-0xFFEAEBED,
-0xFFE6E7E9,
-0xFFE5E6EA,
-0xFFDADBDF,
-0xFFD4D5D9,
-0xFFDADBE0,
-0xFFD6D7DC,
-0xFFDBDBE3,
-0xFFD6D6DE,
-0xFFCBCED7,
-0xFFC9CCD5,
-0xFFC8CCD7,
-0xFFCDD1DD,
-0xFFCCD2DE,
-0xFFCFD5E1,
-0xFFC9D2DB,
-0xFFCBD5DE,
-0xFFCAD7DD,
-0xFFCAD7DD,
-0xFFCAD7DD,
-0xFFCED9DF,
-0xFFD0DBE1,
-0xFFD1DCE2,
-0xFFD1DBE4,
-0xFFCDDAE2,
-0xFFCBD8E1,
-0xFFC7D5E0,
-0xFFC4D2DF,
-0xFFBFCFDE,
-0xFFBCCEDC,
-0xFFBBCCDC,
-0xFFBACDDC,
-0xFFB8CBDC,
-0xFFB0C5D6,
-0xFFAEC1D2,
-0xFFADC0D1,
-0xFFACBFD0,
-0xFFAABDCE,
-0xFFA9BCCD,
-0xFFACBDCF,
-0xFFAEBFCF,
-0xFFAABBCB,
-0xFFAABACA,
-0xFFACBCCC,
-0xFFAFBFCF,
-0xFFB0C0CF,
-0xFFB2C2D1,
-0xFFB6C6D3,
-0xFFB9C7D4,
-0xFFBDC9D7,
-0xFFC0CCD8,
-0xFFC3CDD9,
-0xFFC4CED8,
-0xFFC9D1DC,
-0xFFC9D2DB,
-0xFFC6CDD7,
-0xFFCAD1D9,
-0xFFCBD2DA,
-0xFFCBD2DA,
-0xFFCBD2DA,
-0xFFCDD1DA,
-0xFFCBD2DA,
-0xFFCED2DB,
-0xFFCDD4DC,
-0xFFCBD2DC,
-0xFFC7D0D9,
-0xFFC5CDD8,
-0xFFC0CAD4,
-0xFFBCC6D2,
-0xFFB5C1CF,
-0xFFB1BDCD,
-0xFFABB8C9,
-0xFFABB8CB,
-0xFFA9B8CD,
-0xFFA5B4CB,
-0xFFA1B1CA,
-0xFF9FAFC8,
-0xFF9AABC5,
-0xFF99AAC6,
-0xFF9AAEC7,
-0xFF9DB3CA,
-0xFF97ADC2,
-0xFF99B2C8,
-0xFF98AEC3,
-0xFF94A5B7,
-0xFFACB9CA,
-0xFF9EAAB8,
-0xFF9DAABA,
-0xFF9AACC4,
-0xFF94A8C3,
-0xFF95A9C4,
-0xFF9AABC5,
-0xFF9BABC4,
-0xFF9CACC3,
-0xFF9FB1C7,
-0xFFA0B5CA,
-0xFFC3CDD7,
-0xFFCBD5DF,
-0xFFBFC7D2,
-0xFFCAD3DC,
-0xFFD0D7E1,
-0xFFC8CFD9,
-0xFFCDD5E0,
-0xFFC6CED9,
-0xFFC2CAD7,
-0xFFC6CEDB,
-0xFFBEC6D3,
-0xFFC5CBD9,
-0xFFC1C7D5,
-0xFFC5C9D5,
-0xFFD1D5E1,
-0xFFD3D8DE,
-0xFFDADFE2,
-0xFFDAE0E0,
-0xFFCFD4DA,
-0xFFCFD3DF,
-0xFFC3C8DC,
-0xFFC0C6DE,
-0xFFC1C7DF,
-0xFFBCC4D9,
-0xFFBEC7D8,
-0xFFBFCBD7,
-0xFFC6D0D9,
-0xFFC8D2DB,
-0xFFCBD5DE,
-0xFFCCD6E0,
-0xFFCBD5E1,
-0xFFCAD4E0,
-0xFFC3CDD9,
-0xFFC2CCD6,
-0xFFC1C9D6,
-0xFFC1CBD5,
-0xFFC6CED9,
-0xFFC5CFD8,
-0xFFC6CED9,
-0xFFCAD3DC,
-0xFFCDD5E0,
-0xFFCED7E0,
-0xFFC9D0DA,
-0xFFCBD2DC,
-0xFFD1D8E2,
-0xFFD1D8E2,
-0xFFD2D9E3,
-0xFFD4DBE5,
-0xFFD6DDE5,
-0xFFD3DCE3,
-0xFFD0D9DE,
-0xFFCFD8DD,
-0xFFD3DAE0,
-0xFFD4DBE1,
-0xFFD5DCE2,
-0xFFD8DFE5,
-0xFFDBE2E8,
-0xFFD8DFE5,
-0xFFD5DCE4,
-0xFFD3DAE2,
-0xFFD2D9E1,
-0xFFD1DAE1,
-0xFFD2D9E1,
-0xFFD2D9E3,
-0xFFD7DEE8,
-0xFFDADEE9,
-0xFFDADEE9,
-0xFFD7DBE6,
-0xFFD5D9E4,
-0xFFD4D8E3,
-0xFFD4D8E3,
-0xFFD1D8E2,
-0xFFD0D7E1,
-0xFFCED5DF,
-0xFFCAD0DC,
-0xFFC4CCD7,
-0xFFC1C9D4,
-0xFFC1C9D4,
-0xFFC2CAD7,
-0xFFC3CDD7,
-0xFFC3D0D8,
-0xFFC9D6DF,
-0xFFCCD8E8,
-0xFFC1CCE2,
-0xFF2B3451,
-0xFF293251,
-0xFF2F3559,
-0xFF3B4165,
-0xFF383E62,
-0xFF393D62,
-0xFF383C62,
-0xFF31355A,
-0xFF2D3154,
-0xFF2C3151,
-0xFF2A2E4B,
-0xFF292D48,
-0xFF2C2D49,
-0xFF272741,
-0xFF23203B,
-0xFF202038,
-0xFF23253A,
-0xFF212639,
-0xFF1A2133,
-0xFF151B2B,
-0xFF0C0E1D,
-0xFF090B1A,
-0xFF00000E,
-0xFF707682,
-0xFFDBE5F1,
-0xFFCAD4DE,
-0xFFCAD2DD,
-0xFFC8D0DB,
-0xFFC8D1DA,
-0xFFCBD4DD,
-0xFFCAD3DC,
-0xFFCBD4DD,
-0xFFD5DCE4,
-0xFFE0E4ED,
-0xFFE2E5EC,
-0xFFE0E3EA,
-0xFFDDE0E7,
-0xFFDADDE4,
-0xFFD9DCE3,
-0xFFDDE0E7,
-0xFFE2E5EA,
-0xFFE5E8ED,
-0xFFE2E7EB,
-0xFFE0E3E8,
-0xFFE3E4E8,
-0xFFE1E2E6,
-0xFFDBDEE3,
-0xFFDADDE2,
-0xFFDDE2E8,
-0xFFDCE1E7,
-0xFFD8DCE5,
-0xFFD4DBE5,
-0xFFD6DDE7,
-0xFFD4DBE5,
-0xFFD4DBE5,
-0xFFD4DDE6,
-0xFFD4DBE5,
-0xFFD0D9E2,
-0xFFD2D9E3,
-0xFFD5DCE4,
-0xFFDCE0E9,
-0xFFDBE0E6,
-0xFFD9DDE6,
-0xFFD6DBE1,
-0xFFD6DAE3,
-0xFFD9DDE6,
-0xFFDADEE7,
-0xFFDADEE7,
-0xFFD6DAE5,
-0xFFD4D8E1,
-0xFFD5D9E4,
-0xFFD6DDE5,
-0xFFD9DDE8,
-0xFFD6DDE5,
-0xFFD9DDE8,
-0xFFDCE0E9,
-0xFFE1E4E9,
-0xFFE1E4E9,
-0xFFE2E5EA,
-0xFFE3E6EB,
-0xFFE0E3EA,
-0xFFDADFE5,
-0xFFD8DDE3,
-0xFFD6DDE3,
-0xFFD8DCE5,
-0xFFD6DBE1,
-0xFFDBE0E6,
-0xFFE3E8EE,
-0xFFE4E9ED,
-0xFFE5EAEE,
-0xFFE7EAEF,
-0xFFE4E8EB,
-0xFFE8E9EB,
-0xFFE9EAEC,
-0xFFEBECEE,
-0xFFE9EDEE,
-0xFFEBECEE,
-0xFFE9EDEE,
-0xFFE9EDEE,
-0xFFE7EBEC,
-0xFFE9EDF0,
-0xFFE9EDEE,
-0xFFE9EDEE,
-0xFFE8ECED,
-0xFFE8E9EB,
-0xFFE8E9EB,
-0xFFE9EAEC,
-0xFFEBECEE,
-0xFFE9ECF1,
-0xFFE8EDF1,
-0xFFE6EBF1,
-0xFFE2E7EB,
-0xFFE0E5EB,
-0xFFDBE0E6,
-0xFFDADFE5,
-0xFFDBE2EA,
-0xFFDBDFE8,
-0xFFD7DEE6,
-0xFFD6DAE5,
-0xFFD2D9E3,
-0xFFD3D7E2,
-0xFFD0D7E1,
-0xFFCFD5E1,
-0xFFD2D6DF,
-0xFFE3E4E8,
-0xFFECF0F3,
-0xFFE7F0F7,
-0xFFA6B0B9,
-0xFFC7CFDA,
-0xFFE4D9D3,
-0xFFF0C39A,
-0xFFC56E41,
-0xFF991405,
-0xFFA83837,
-0xFFFCE2E5,
-0xFFD2E1E6,
-0xFFCFDADE,
-0xFFDCE4E7,
-0xFFE3E9E9,
-0xFFE2E6E5,
-0xFFE0E4E5,
-0xFFDFE3E6,
-0xFFDBDEE3,
-0xFFC8CBD0,
-0xFFC7C8CD,
-0xFFDBDCE1,
-0xFFD9D9E1,
-0xFFD9D9E3,
-0xFFD0D3DC,
-0xFFCCCEDA,
-0xFFC8CAD7,
-0xFFC8CCD8,
-0xFFC4CAD8,
-0xFFC7CFDC,
-0xFFC5CCDC,
-0xFFC0C9D8,
-0xFFBDC9D7,
-0xFFBCCAD7,
-0xFFBCCAD7,
-0xFFBBC9D6,
-0xFFBBC8D8,
-0xFFBBC8D8,
-0xFFB9C9D8,
-0xFFB8C8D8,
-0xFFB7C7D7,
-0xFFB4C3D6,
-0xFFAFC0D2,
-0xFFAEBFD3,
-0xFFAABCD2,
-0xFFA4B9CE,
-0xFFA1B5CD,
-0xFF9FB3CB,
-0xFFA3B8CD,
-0xFFA3B9CE,
-0xFFA6BBD0,
-0xFFA6BBD0,
-0xFFA5BACF,
-0xFFA6BBD0,
-0xFFA9BED3,
-0xFFAFC1D7,
-0xFFABBDD3,
-0xFFAABCD2,
-0xFFAABCD2,
-0xFFABBDD1,
-0xFFABBDD1,
-0xFFABBDD1,
-0xFFABBDD1,
-0xFFABBECF,
-0xFFAEBFD1,
-0xFFB2C3D5,
-0xFFB1C2D4,
-0xFFB0BFD2,
-0xFFB5C5D5,
-0xFFBAC7D8,
-0xFFBBC8D8,
-0xFFBECADA,
-0xFFBCC8D6,
-0xFFBBC7D5,
-0xFFBCC8D6,
-0xFFBFCBD9,
-0xFFC3CCDB,
-0xFFC2CEDC,
-0xFFC4CDDC,
-0xFFC3CFDD,
-0xFFC5D1DD,
-0xFFCBD7E3,
-0xFFCDD9E7,
-0xFFC5D3E0,
-0xFFC6D3E3,
-0xFFB6C6D6,
-0xFFADBCCF,
-0xFFAABBCF,
-0xFFAABAD3,
-0xFFA4B5CF,
-0xFFA0B1CD,
-0xFF9CAFCD,
-0xFF99ACCC,
-0xFF97ACCB,
-0xFF98ACCD,
-0xFF95ACCC,
-0xFF8EA8C3,
-0xFF92ACC5,
-0xFF92ACC7,
-0xFF8CA4BE,
-0xFF98AAC2,
-0xFFABBCD0,
-0xFF91A1B1,
-0xFF98A9BB,
-0xFF93A8C3,
-0xFF8FA6C6,
-0xFF92A9C9,
-0xFF95A9CA,
-0xFF95A8C9,
-0xFF9BAECE,
-0xFF9DB2CF,
-0xFF98B0CC,
-0xFFBDC9D5,
-0xFFCCD8E4,
-0xFFC3CDD7,
-0xFFC4CED8,
-0xFF848C97,
-0xFFADB5C0,
-0xFFC3CDD9,
-0xFFBCC5D4,
-0xFFBEC7D8,
-0xFFB2BBCC,
-0xFFB5BECF,
-0xFFAFB8C9,
-0xFFA9B2C3,
-0xFFB4BBCD,
-0xFFBAC1D1,
-0xFFC4CCD7,
-0xFFC3CCD1,
-0xFFBFCACE,
-0xFFC2CAD5,
-0xFFBEC7D8,
-0xFFBBC3DA,
-0xFFC2C9E3,
-0xFFBDC4DE,
-0xFFBAC4DD,
-0xFFBBC6DA,
-0xFFB2BDCF,
-0xFFB8C4D2,
-0xFFC0CCDA,
-0xFFC2CEDE,
-0xFFCDD8EA,
-0xFFC3CEE2,
-0xFFC1CCE0,
-0xFFBCC8D8,
-0xFFBBC7D5,
-0xFFBFCBD9,
-0xFFC9D5E3,
-0xFFD1DDE9,
-0xFFCDD9E5,
-0xFFC4D0DC,
-0xFFBFCBD7,
-0xFFC0CAD6,
-0xFFC8D2DC,
-0xFFC9D3DD,
-0xFFCAD4DE,
-0xFFCED6E1,
-0xFFCAD3DC,
-0xFFC9D1DC,
-0xFFCFD8E1,
-0xFFD2DBE4,
-0xFFD4DDE4,
-0xFFD5DEE5,
-0xFFD7E0E5,
-0xFFD8DFE7,
-0xFFD4DBE1,
-0xFFD0D7DF,
-0xFFD1D8E0,
-0xFFD1D8E0,
-0xFFCED5DD,
-0xFFCCD3DD,
-0xFFCBD4DD,
-0xFFCCD5DE,
-0xFFCBD5DE,
-0xFFCBD5DF,
-0xFFCBD3DE,
-0xFFCCD2DE,
-0xFFCFD5E1,
-0xFFD0D6E2,
-0xFFD0D6E2,
-0xFFD1D7E3,
-0xFFD3DAE4,
-0xFFD6DCE8,
-0xFFD7DDE9,
-0xFFDBE3EE,
-0xFFDBE3EE,
-0xFFD9E1EC,
-0xFFD6DEEB,
-0xFFD1D9E6,
-0xFFCCD6E2,
-0xFFCBD5E1,
-0xFFC8D4E0,
-0xFFC3D1DA,
-0xFFC9D7E4,
-0xFFC9D6E9,
-0xFFAEB8D3,
-0xFF222B4A,
-0xFF313A5B,
-0xFF313759,
-0xFF303658,
-0xFF2E3255,
-0xFF303457,
-0xFF34385B,
-0xFF2E3255,
-0xFF292E4E,
-0xFF2A2F4D,
-0xFF282C49,
-0xFF292D48,
-0xFF2A2C45,
-0xFF2A2A42,
-0xFF29273F,
-0xFF26243C,
-0xFF202237,
-0xFF1D2236,
-0xFF1F2438,
-0xFF22273A,
-0xFF2D2E42,
-0xFF151426,
-0xFF000012,
-0xFF959BAB,
-0xFFBECAD8,
-0xFFBECCD9,
-0xFFC7D1DD,
-0xFFC6D0DC,
-0xFFC8D2DC,
-0xFFCAD3DC,
-0xFFC9D2DB,
-0xFFCDD6DF,
-0xFFDAE1EB,
-0xFFE1E8F0,
-0xFFE1E5EE,
-0xFFDCDFE6,
-0xFFDADDE4,
-0xFFD8DBE2,
-0xFFD7DAE1,
-0xFFD9DCE3,
-0xFFDFE2E9,
-0xFFE2E7EB,
-0xFFE2E7ED,
-0xFFE0E5E9,
-0xFFDDE0E5,
-0xFFDEE1E6,
-0xFFDBE0E6,
-0xFFD9DEE4,
-0xFFD6DDE5,
-0xFFD4DBE3,
-0xFFD3DAE4,
-0xFFD4DDE6,
-0xFFD5DBE7,
-0xFFD2DBE4,
-0xFFD2DAE5,
-0xFFD6DFE8,
-0xFFD5DEE7,
-0xFFD0D9E2,
-0xFFCCD5DE,
-0xFFCCD5DE,
-0xFFCDD4DE,
-0xFFCFD6DE,
-0xFFD2D9E3,
-0xFFD5DCE6,
-0xFFD7DEE8,
-0xFFD7DEE8,
-0xFFD4DBE5,
-0xFFD1D8E2,
-0xFFD0D6E2,
-0xFFCED5DF,
-0xFFCDD3DF,
-0xFFCCD5DE,
-0xFFCDD5E0,
-0xFFCFD8E1,
-0xFFD3DBE6,
-0xFFD9E0EA,
-0xFFE0E4ED,
-0xFFDFE4EA,
-0xFFDEE2EB,
-0xFFDCE0E9,
-0xFFD7DEE6,
-0xFFD3DAE2,
-0xFFD3DAE4,
-0xFFD4DDE6,
-0xFFD7E0E9,
-0xFFD4DDE4,
-0xFFDAE1E9,
-0xFFDFE6EC,
-0xFFDCE3E9,
-0xFFE0E5EB,
-0xFFE4E9EF,
-0xFFE3E6EB,
-0xFFE6EAED,
-0xFFE7EBEE,
-0xFFE7EBEE,
-0xFFE6EBEE,
-0xFFE7ECEF,
-0xFFE8EDF0,
-0xFFE8EDF1,
-0xFFE7ECF0,
-0xFFE4E9ED,
-0xFFE4E9ED,
-0xFFE3E8EB,
-0xFFE4E9EC,
-0xFFE5EAED,
-0xFFE7EBEE,
-0xFFE7EBEE,
-0xFFE6E9EE,
-0xFFE5EAF0,
-0xFFE7ECF2,
-0xFFE6EBF1,
-0xFFDFE4EA,
-0xFFD8DDE3,
-0xFFD1D8E0,
-0xFFD2D9E1,
-0xFFD8E1EA,
-0xFFD1D9E4,
-0xFFD0D8E3,
-0xFFCFD7E2,
-0xFFCED6E1,
-0xFFCDD5E2,
-0xFFCAD4E0,
-0xFFC8D2DE,
-0xFFC9D0DA,
-0xFFE4E5E9,
-0xFFF0F1F5,
-0xFFEAF1F9,
-0xFFAEB8C2,
-0xFFC9D5E1,
-0xFFDDD5D3,
-0xFFBA8D6C,
-0xFF691900,
-0xFF9F2D22,
-0xFFB65A5B,
-0xFFEAD5DA,
-0xFFC9D8DF,
-0xFFD2DFE5,
-0xFFCED7DC,
-0xFFDFE4E8,
-0xFFE2E6E9,
-0xFFDDE2E6,
-0xFFD6DBDF,
-0xFFCFD4DA,
-0xFFC7CAD1,
-0xFFCCCFD6,
-0xFFCACDD4,
-0xFFD4D4DE,
-0xFFD0D2DE,
-0xFFCDCFDC,
-0xFFCACEDA,
-0xFFCFD2E1,
-0xFFC0C6D6,
-0xFFC6CDDD,
-0xFFBDC6D7,
-0xFFC2CBDC,
-0xFFB8C3D5,
-0xFFB6C3D6,
-0xFFB2C1D6,
-0xFFAEBDD2,
-0xFFAABBCF,
-0xFFA9B9D0,
-0xFFA9B9D0,
-0xFFA7B9D1,
-0xFFA6B8D0,
-0xFFA6B8D0,
-0xFFA3B4CE,
-0xFFA2B3CD,
-0xFFA0B4CD,
-0xFFA0B4CD,
-0xFF9EB2CD,
-0xFF9DB1CC,
-0xFF9DB2CD,
-0xFF97ADC5,
-0xFF99AFC7,
-0xFF99AFC7,
-0xFF98AEC6,
-0xFF97ADC5,
-0xFF98AEC6,
-0xFF9BB1C9,
-0xFF9CB2CA,
-0xFFA6BAD3,
-0xFFA7BDD5,
-0xFFA5BBD3,
-0xFFA1B7CF,
-0xFFA1B7CF,
-0xFFA5BBD2,
-0xFFABC1D8,
-0xFFAEC2DA,
-0xFFB2C4DC,
-0xFFB1C3D9,
-0xFFB1C3D9,
-0xFFB3C5DB,
-0xFFB5C5DC,
-0xFFB4C5D9,
-0xFFB5C6DA,
-0xFFBAC9DE,
-0xFFBAC9DC,
-0xFFBCCBDE,
-0xFFBDCCDF,
-0xFFBDCCE1,
-0xFFBCCBE0,
-0xFFBBCADF,
-0xFFB9C8DD,
-0xFFB6C7D9,
-0xFFB3C4D6,
-0xFFB6C7D9,
-0xFFB7CADB,
-0xFFB0C2D6,
-0xFFA7BCD1,
-0xFF9EB2CA,
-0xFF9BB1C9,
-0xFF9BB0CB,
-0xFF94ACC8,
-0xFF8DA4C3,
-0xFF88A0C2,
-0xFF869EC0,
-0xFF819BBE,
-0xFF809ABF,
-0xFF809CC3,
-0xFF7D99BE,
-0xFF83A0C2,
-0xFF7F9CBC,
-0xFF83A0C0,
-0xFF859EBD,
-0xFF879CB9,
-0xFFA1B3CB,
-0xFF96A7B9,
-0xFF8D9FB3,
-0xFF869DBC,
-0xFF859FC2,
-0xFF87A1C6,
-0xFF859DC3,
-0xFF8298BF,
-0xFF859BC2,
-0xFF859DBF,
-0xFF7C96B7,
-0xFFA4B5C7,
-0xFF9FB0C2,
-0xFFA8B7CA,
-0xFFA5B4C7,
-0xFF7C8B9E,
-0xFF808FA2,
-0xFFA3B4C8,
-0xFFA5B6CA,
-0xFF9EB0C6,
-0xFFA4B6CE,
-0xFFA3B5CD,
-0xFFA1B3CB,
-0xFFA2B4CC,
-0xFFB2C2D9,
-0xFFA9B8CF,
-0xFFACBBD0,
-0xFFA9BACC,
-0xFFA3B6C5,
-0xFFABBCCE,
-0xFFA9BACE,
-0xFFA9B9D0,
-0xFFA8B8D1,
-0xFFA4B4CD,
-0xFFA5B3CD,
-0xFFA7B5CF,
-0xFFA6B5CC,
-0xFFAAB9D0,
-0xFFB3C1DB,
-0xFFB3C1DB,
-0xFFB8C6E1,
-0xFFBDCBE6,
-0xFFB9C7E1,
-0xFFBCCBDE,
-0xFFB7C7D7,
-0xFFB8C8D8,
-0xFFC0D0E0,
-0xFFC9D6E6,
-0xFFCCD9E9,
-0xFFCBD9E6,
-0xFFC9D7E4,
-0xFFC1CFDC,
-0xFFC5D3E0,
-0xFFC5D1DF,
-0xFFC7D3DF,
-0xFFCEDAE6,
-0xFFCDDAE3,
-0xFFC7D3DF,
-0xFFCAD7E0,
-0xFFCED8E1,
-0xFFCDD7E0,
-0xFFCAD4DD,
-0xFFC8D3D9,
-0xFFC8D1DA,
-0xFFC6CFD6,
-0xFFC5CED7,
-0xFFC7D0D9,
-0xFFCBD4DD,
-0xFFC9D2DB,
-0xFFC7CFDA,
-0xFFC5CFD9,
-0xFFC6D0DA,
-0xFFC4D1DA,
-0xFFC2CEDA,
-0xFFC0CCD8,
-0xFFC0CAD6,
-0xFFC1CBD7,
-0xFFC2CCD8,
-0xFFC2CCD8,
-0xFFC3CDD9,
-0xFFC7D1DB,
-0xFFCBD5E1,
-0xFFCDD7E3,
-0xFFD0DAE6,
-0xFFD2DCE8,
-0xFFD3DDE9,
-0xFFD1DDEB,
-0xFFCDD9E7,
-0xFFC9D5E3,
-0xFFC5D3E0,
-0xFFC2D2E1,
-0xFFC0D1E1,
-0xFFC0D1E5,
-0xFFBECCE7,
-0xFF9CA6C9,
-0xFF1F274C,
-0xFF2F375C,
-0xFF31375B,
-0xFF2C3053,
-0xFF303354,
-0xFF2D3051,
-0xFF2F3253,
-0xFF292C4D,
-0xFF282B4C,
-0xFF2B2E4D,
-0xFF252A47,
-0xFF252B45,
-0xFF232941,
-0xFF21263C,
-0xFF202038,
-0xFF1F1D33,
-0xFF1B1C30,
-0xFF191A2C,
-0xFF17182A,
-0xFF181729,
-0xFF161125,
-0xFF161125,
-0xFF060719,
-0xFF313848,
-0xFFC0CDDD,
-0xFFB0C2D0,
-0xFFADBECE,
-0xFFB4C4D3,
-0xFFBCC8D4,
-0xFFC1CBD5,
-0xFFC5CFD9,
-0xFFCED8E1,
-0xFFDAE3EC,
-0xFFDEE5ED,
-0xFFDAE1E9,
-0xFFD9DDE6,
-0xFFD5D9E2,
-0xFFD8DCE5,
-0xFFDBDFE8,
-0xFFDEE2EB,
-0xFFE0E4ED,
-0xFFDFE6EC,
-0xFFDDE4EC,
-0xFFDAE1E9,
-0xFFD8DFE7,
-0xFFDAE1E9,
-0xFFD8E1E8,
-0xFFD5DEE5,
-0xFFD3DCE5,
-0xFFCFD7E2,
-0xFFCED6E1,
-0xFFD0DAE4,
-0xFFD1D9E6,
-0xFFCED8E2,
-0xFFCFD9E5,
-0xFFD4DEE8,
-0xFFD5DFE9,
-0xFFD2DCE6,
-0xFFCFD8E1,
-0xFFCED7E0,
-0xFFC8D1DA,
-0xFFC8D1DA,
-0xFFC9D1DC,
-0xFFCBD3DE,
-0xFFCED6E1,
-0xFFD1D9E4,
-0xFFD1D9E4,
-0xFFCFD7E2,
-0xFFCDD5E2,
-0xFFCAD2DD,
-0xFFC8D0DD,
-0xFFC7D1DB,
-0xFFC7D1DD,
-0xFFC7D1DB,
-0xFFC9D3DF,
-0xFFCBD5DF,
-0xFFD4DDE6,
-0xFFD7DEE8,
-0xFFD6DFE8,
-0xFFD3DCE5,
-0xFFCFD7E2,
-0xFFCDD7E1,
-0xFFCCD6E0,
-0xFFCCD6E0,
-0xFFCDD7E1,
-0xFFCDD7E1,
-0xFFD6DEE9,
-0xFFDAE3EC,
-0xFFD7E0E9,
-0xFFDAE1E9,
-0xFFE0E7EF,
-0xFFE2E7ED,
-0xFFE5EAF0,
-0xFFE3E8EE,
-0xFFE0E5EB,
-0xFFDAE1E7,
-0xFFD9E0E8,
-0xFFDAE1E9,
-0xFFDBE2EA,
-0xFFDBE2EA,
-0xFFDEE5ED,
-0xFFDDE4EC,
-0xFFDBE2EA,
-0xFFDCE3EB,
-0xFFDEE5EB,
-0xFFE1E6EC,
-0xFFDFE4EA,
-0xFFDEE3E9,
-0xFFDADEE7,
-0xFFDCE0E9,
-0xFFD9E0E8,
-0xFFD5DCE4,
-0xFFD0D7DF,
-0xFFCAD3DC,
-0xFFC9D1DC,
-0xFFCCD6E0,
-0xFFC5D1DD,
-0xFFC5D1DF,
-0xFFC5D3E0,
-0xFFC5D2E2,
-0xFFC4D1E2,
-0xFFC0D0E0,
-0xFFBDCDDD,
-0xFFBFC9D5,
-0xFFE2E3E8,
-0xFFF2F0F5,
-0xFFE7EAF3,
-0xFFA5ADBA,
-0xFFBFCCDD,
-0xFFDADEE1,
-0xFFAA9173,
-0xFF552000,
-0xFF480000,
-0xFFA96D6C,
-0xFFE9DCE3,
-0xFFCCD6E0,
-0xFFCAD4DE,
-0xFFD0DAE4,
-0xFFD8DFE9,
-0xFFD9DDE6,
-0xFFD3DAE4,
-0xFFC7CED8,
-0xFFC6CDD7,
-0xFFBABEC9,
-0xFFC1C5D0,
-0xFFB2B6C1,
-0xFFC6C8D5,
-0xFFC9CDD9,
-0xFFC3C6D5,
-0xFFC2C8D8,
-0xFFBEC5D5,
-0xFFB9C2D3,
-0xFFB9C5D5,
-0xFFBDCADB,
-0xFFBCC9DA,
-0xFFB5C4D9,
-0xFFB0C0D9,
-0xFFABBCD6,
-0xFFA8B9D5,
-0xFFA6B7D3,
-0xFFA3B6D4,
-0xFFA3B6D4,
-0xFFA1B6D3,
-0xFFA0B5D2,
-0xFF9FB4D1,
-0xFFA0B5D4,
-0xFFA2B7D6,
-0xFFA3B6D4,
-0xFFA0B3D1,
-0xFF9CAFCD,
-0xFF99ACCA,
-0xFF98ABC9,
-0xFF9AAFCA,
-0xFF96AEC8,
-0xFF92AAC4,
-0xFF8FA7C1,
-0xFF90A8C4,
-0xFF93ABC7,
-0xFF93ABC7,
-0xFF91A9C5,
-0xFF94A9C8,
-0xFF93AAC9,
-0xFF96ADCC,
-0xFF99B0CF,
-0xFF9BB2D1,
-0xFF9CB4D0,
-0xFF9DB5D1,
-0xFFA0B5D0,
-0xFFA6BAD3,
-0xFFA3B5CD,
-0xFFA5B7CF,
-0xFFA7B9D1,
-0xFFA2B4CC,
-0xFFA4B6CE,
-0xFFAABCD4,
-0xFFAABAD3,
-0xFFACBCD5,
-0xFFB2C2DB,
-0xFFB3C5DD,
-0xFFAFC0DA,
-0xFFAABBD5,
-0xFFA6B7D1,
-0xFFA0B4CD,
-0xFF9BB1C9,
-0xFF97AFC9,
-0xFF8EA8C1,
-0xFF90AAC3,
-0xFF8FA9C4,
-0xFF7E99B4,
-0xFF7F9AB7,
-0xFF819EBC,
-0xFF7B98B8,
-0xFF7997B9,
-0xFF7391B5,
-0xFF7090B7,
-0xFF6F8FB6,
-0xFF6A8BB4,
-0xFF6A8BB4,
-0xFF6A8DB7,
-0xFF698AB3,
-0xFF6A8AB1,
-0xFF6D8BB1,
-0xFF708EB4,
-0xFF758FB2,
-0xFF768AAB,
-0xFF91A2BE,
-0xFF92A3B7,
-0xFF77899F,
-0xFF758EAD,
-0xFF6F8BB2,
-0xFF728EB6,
-0xFF7793BB,
-0xFF788FBB,
-0xFF768DB7,
-0xFF7690B5,
-0xFF7491B3,
-0xFF92A6BE,
-0xFF9CB0C8,
-0xFF92A6BE,
-0xFFA5B9D1,
-0xFF9BAFC7,
-0xFF9DB1C9,
-0xFF9CB2CA,
-0xFF9DB2CD,
-0xFF9DB5D1,
-0xFF91A9C5,
-0xFF88A1BF,
-0xFF859EBC,
-0xFF95ADC9,
-0xFF6D85A1,
-0xFF9EB3CE,
-0xFF9CB1CC,
-0xFFA2B8D0,
-0xFF9FB7CF,
-0xFFA4BCD4,
-0xFFAEC4DC,
-0xFFB2C6DF,
-0xFFA5B9D1,
-0xFFA8BAD0,
-0xFFA3B4C8,
-0xFF9FB0C2,
-0xFF9EADC0,
-0xFF8C9BAE,
-0xFF95A4B7,
-0xFFA7B6CB,
-0xFFA3B2C9,
-0xFFB4C3DA,
-0xFFACBBD2,
-0xFFABBCD0,
-0xFFA9BBCF,
-0xFFACBED2,
-0xFFB1C4D5,
-0xFFB3C4D6,
-0xFFB5C6D6,
-0xFFB8C9D9,
-0xFFB9CADA,
-0xFFB9CADA,
-0xFFB6C8D6,
-0xFFB5C5D4,
-0xFFB6C6D3,
-0xFFBDCDDA,
-0xFFBFD0DA,
-0xFFBBCBD8,
-0xFFC0CED9,
-0xFFC5D2DB,
-0xFFCBD5DE,
-0xFFCCD6E0,
-0xFFCCD6DF,
-0xFFCED6E1,
-0xFFCBD4DD,
-0xFFC6CED9,
-0xFFC3CBD6,
-0xFFC3CBD6,
-0xFFC1CBD7,
-0xFFC0CAD6,
-0xFFBFCBD9,
-0xFFC1CDDB,
-0xFFC2D0DD,
-0xFFC1CFDC,
-0xFFBECEDD,
-0xFFB7C4D4,
-0xFFB5C5D4,
-0xFFB5C2D2,
-0xFFB1C1D0,
-0xFFB4C1D1,
-0xFFB7C5D2,
-0xFFB9C7D4,
-0xFFBAC8D5,
-0xFFC4D1E1,
-0xFFC3D3E2,
-0xFFC4D1E1,
-0xFFC0D0DF,
-0xFFBACADA,
-0xFFB4C5D5,
-0xFFAFC0D0,
-0xFFACBFCE,
-0xFFABBECD,
-0xFFAABCD0,
-0xFFADBCD9,
-0xFF98A5C7,
-0xFF1B2549,
-0xFF20264A,
-0xFF272C4C,
-0xFF252946,
-0xFF292D48,
-0xFF292D48,
-0xFF2C304D,
-0xFF2B2F4C,
-0xFF292C4B,
-0xFF282C49,
-0xFF232943,
-0xFF232941,
-0xFF1F253B,
-0xFF1E2339,
-0xFF202136,
-0xFF232136,
-0xFF262739,
-0xFF282A39,
-0xFF222431,
-0xFF1C1B29,
-0xFF181423,
-0xFF0D0918,
-0xFF000110,
-0xFF5C6373,
-0xFFC1D1E0,
-0xFFB5C8D7,
-0xFFB1C6D7,
-0xFFBACDDC,
-0xFFBACAD7,
-0xFFC1CDD9,
-0xFFC4D0DC,
-0xFFCBD5DF,
-0xFFD0DAE4,
-0xFFD2DBE4,
-0xFFD3DCE5,
-0xFFD6DDE5,
-0xFFD3DAE2,
-0xFFD6DDE5,
-0xFFDDE1EA,
-0xFFDEE5ED,
-0xFFDEE5ED,
-0xFFDCE3EB,
-0xFFDAE1E9,
-0xFFD7E0E9,
-0xFFD7E1EA,
-0xFFD5DFE9,
-0xFFD1DEE7,
-0xFFD1DEE7,
-0xFFD2DEEA,
-0xFFCEDAE6,
-0xFFCAD6E2,
-0xFFCAD6E2,
-0xFFCFDBE9,
-0xFFCFD9E5,
-0xFFCED8E4,
-0xFFCFD9E5,
-0xFFD0DAE4,
-0xFFD0DAE4,
-0xFFD0D9E2,
-0xFFCFD8E1,
-0xFFD0DAE4,
-0xFFCCD9E2,
-0xFFCBD5E1,
-0xFFC8D4E0,
-0xFFCCD6E2,
-0xFFCDD9E5,
-0xFFD0DCE8,
-0xFFD1DDE9,
-0xFFD3DFEB,
-0xFFD1DDE9,
-0xFFD0DCE8,
-0xFFD0DCE8,
-0xFFCFDBE7,
-0xFFCBD9E4,
-0xFFCAD6E2,
-0xFFC9D5E1,
-0xFFC9D3DF,
-0xFFCDD7E3,
-0xFFD0DAE6,
-0xFFCEDAE6,
-0xFFCBD7E3,
-0xFFC9D5E3,
-0xFFC7D3E1,
-0xFFC3D1DE,
-0xFFC1CDDB,
-0xFFC2CEDA,
-0xFFC7D3DF,
-0xFFCCD6E0,
-0xFFCAD4DE,
-0xFFCFD8E1,
-0xFFD6DFE8,
-0xFFD9E2EB,
-0xFFD7DEE8,
-0xFFD7E0E9,
-0xFFD6DDE7,
-0xFFD1DAE3,
-0xFFCED6E1,
-0xFFCBD5DF,
-0xFFCBD3DE,
-0xFFCAD4DE,
-0xFFCAD2DD,
-0xFFC7D1DB,
-0xFFC7CFDA,
-0xFFC6CED9,
-0xFFC7D0D9,
-0xFFC8D1DA,
-0xFFC8CFD9,
-0xFFC7CED8,
-0xFFCBCFD8,
-0xFFCBCFD8,
-0xFFCAD1D9,
-0xFFCCD3DB,
-0xFFCED7E0,
-0xFFCAD4DE,
-0xFFC2CCD8,
-0xFFBDC9D7,
-0xFFBBC9D6,
-0xFFB9C9D8,
-0xFFB9CADA,
-0xFFB9CADC,
-0xFFB7C9DD,
-0xFFB5C7DB,
-0xFFB1C3D7,
-0xFFAFBFCE,
-0xFFDADDE4,
-0xFFF5F4FA,
-0xFFEEF1FA,
-0xFFA9B0C0,
-0xFFB5C6DA,
-0xFFD2D9DF,
-0xFF9D8968,
-0xFF542900,
-0xFF410400,
-0xFF703F3B,
-0xFFEADEE8,
-0xFFC7D0DF,
-0xFFC5D3E0,
-0xFFCAD6E4,
-0xFFCBD3E0,
-0xFFCBD3E0,
-0xFFC5CDDA,
-0xFFB9C1CE,
-0xFFBFC7D4,
-0xFFA3A9B7,
-0xFFA1A7B5,
-0xFF999FAD,
-0xFFABAEBF,
-0xFFB8BECE,
-0xFFACB2C2,
-0xFFB2B9CB,
-0xFFAEB7C8,
-0xFFAFBACC,
-0xFFAEBBCC,
-0xFFB4C3D6,
-0xFFB0BFD2,
-0xFFAFC0D4,
-0xFFA9BAD4,
-0xFFA5B9D4,
-0xFFA3B6D4,
-0xFFA1B6D3,
-0xFF9FB4D3,
-0xFF9AB1D0,
-0xFF99B0CF,
-0xFF99B0CF,
-0xFF97AECD,
-0xFF9AB1D0,
-0xFF9DB2CF,
-0xFF9BAECC,
-0xFF99ADC8,
-0xFF9AABC5,
-0xFF9AABC5,
-0xFF99ABC3,
-0xFF97A9C1,
-0xFF98ACC4,
-0xFF9CAEC6,
-0xFF9BAFC7,
-0xFF9CB0C9,
-0xFFA0B4CD,
-0xFFA5B9D2,
-0xFFA8BCD5,
-0xFFA4B8D3,
-0xFF99ADC8,
-0xFF93A8C3,
-0xFF98ADC8,
-0xFF9BB0CB,
-0xFF98ADC8,
-0xFF99AFC7,
-0xFF9FB3CB,
-0xFFA1B3C9,
-0xFFA4B5C9,
-0xFFABBCD0,
-0xFFAABBCF,
-0xFFA6B7CB,
-0xFFACBDD1,
-0xFFAEBED5,
-0xFFA1B3C9,
-0xFFA4B6CE,
-0xFFA6B8D0,
-0xFFA4B8D1,
-0xFFA2B6CF,
-0xFF9FB3CE,
-0xFF9AAFCA,
-0xFF93A8C3,
-0xFF8AA2BE,
-0xFF869EBA,
-0xFF86A0BB,
-0xFF7E98B3,
-0xFF7F98B6,
-0xFF7E99B6,
-0xFF7E99B7,
-0xFF7390B0,
-0xFF728FAF,
-0xFF6D8BAD,
-0xFF6C8AAE,
-0xFF6D8DB3,
-0xFF7191B8,
-0xFF7092B8,
-0xFF7091BA,
-0xFF6E91B9,
-0xFF6D8EB7,
-0xFF6686AF,
-0xFF7393BC,
-0xFF6E8BB3,
-0xFF6B87AC,
-0xFF7589AC,
-0xFF8B9FBA,
-0xFF8E9FB1,
-0xFF718699,
-0xFF6E87A6,
-0xFF6B89AD,
-0xFF6D8BB1,
-0xFF6E8BB3,
-0xFF728AB6,
-0xFF728BB4,
-0xFF718DB2,
-0xFF728FB1,
-0xFF859AB7,
-0xFF889DBA,
-0xFF768BA6,
-0xFF5F748F,
-0xFF7D92AD,
-0xFF7C94AE,
-0xFF809AB5,
-0xFF89A2C0,
-0xFF8FAAC8,
-0xFF90AACB,
-0xFF84A1C1,
-0xFF87A4C4,
-0xFF849FBD,
-0xFF0C2745,
-0xFF8CA5C3,
-0xFF88A1BF,
-0xFF8CA6C1,
-0xFF90AAC5,
-0xFF94ADCB,
-0xFFA2BAD6,
-0xFFAEC3DE,
-0xFFAEC0D6,
-0xFFA4B5C5,
-0xFF8E9FA9,
-0xFF76858A,
-0xFF627272,
-0xFF2E3C3C,
-0xFF354343,
-0xFF536162,
-0xFF626F75,
-0xFF839099,
-0xFFAAB8C5,
-0xFFA2B4C8,
-0xFFA0B5CA,
-0xFFA4B9CE,
-0xFFA4B9CE,
-0xFFA3B5CB,
-0xFFA7B9CD,
-0xFFAFC1D5,
-0xFFB2C5D6,
-0xFFB2C5D6,
-0xFFB4C7D6,
-0xFFBACBDB,
-0xFFB5C7D5,
-0xFFAFC1CF,
-0xFFB0C2CE,
-0xFFB5C7D5,
-0xFFC1D1DE,
-0xFFC6D4DF,
-0xFFC9D6DF,
-0xFFC8D2DE,
-0xFFC5CFD9,
-0xFFC7D1DD,
-0xFFCBD5DF,
-0xFFCBD5E1,
-0xFFCBD5E1,
-0xFFC9D3DF,
-0xFFC7D0DF,
-0xFFC4CDDC,
-0xFFBFCBDB,
-0xFFBBC8D8,
-0xFFB5C5D4,
-0xFFB1C1D0,
-0xFFAEBFCF,
-0xFFB1C4D5,
-0xFFAFC4D7,
-0xFFB0C2D6,
-0xFFAEC3D4,
-0xFFAFC2D3,
-0xFFAFC2D3,
-0xFFAEC1D2,
-0xFFACBFD0,
-0xFFA8BBCC,
-0xFFA7BCCD,
-0xFFABBDD1,
-0xFFABC0D3,
-0xFFACC1D4,
-0xFFABC2D4,
-0xFFABC1D6,
-0xFFABC2D2,
-0xFFABC3CF,
-0xFFB0C6D3,
-0xFFAEBED5,
-0xFFBAC8E3,
-0xFF1C2743,
-0xFF222946,
-0xFF1C223A,
-0xFF191E32,
-0xFF1E2134,
-0xFF232639,
-0xFF292B40,
-0xFF2D2F46,
-0xFF282C45,
-0xFF22273D,
-0xFF21283B,
-0xFF22293B,
-0xFF26283D,
-0xFF2D2E42,
-0xFF302F41,
-0xFF2A2939,
-0xFF212330,
-0xFF191D28,
-0xFF11151E,
-0xFF0B0E17,
-0xFF0E0E18,
-0xFF0C0C18,
-0xFF080C18,
-0xFF2A3440,
-0xFFD0E0EF,
-0xFFBACDDC,
-0xFFB7CADB,
-0xFFBBCEDD,
-0xFFC2D2E1,
-0xFFC7D5E2,
-0xFFC7D5E2,
-0xFFC6D2DE,
-0xFFC7D3DF,
-0xFFCBD5DF,
-0xFFCED6E1,
-0xFFD1DAE3,
-0xFFD1DAE3,
-0xFFD1DAE3,
-0xFFD5DCE6,
-0xFFD7E0E9,
-0xFFD6DFE8,
-0xFFD2DBE4,
-0xFFD0D9E2,
-0xFFCED8E1,
-0xFFC9D5E1,
-0xFFCBD9E4,
-0xFFCBD9E6,
-0xFFC9D7E4,
-0xFFC4D2DF,
-0xFFBECCD9,
-0xFFBECCD9,
-0xFFC5D3E0,
-0xFFC7D4E4,
-0xFFC7D3E1,
-0xFFC5D1DF,
-0xFFC3CFDB,
-0xFFC6D0DA,
-0xFFC8D2DC,
-0xFFCAD3DC,
-0xFFC8D2DC,
-0xFFC7D3DF,
-0xFFC6D4DF,
-0xFFC8D4E2,
-0xFFC9D7E4,
-0xFFCCD8E6,
-0xFFCBD9E6,
-0xFFCAD8E5,
-0xFFC9D7E4,
-0xFFC9D7E4,
-0xFFC6D4E1,
-0xFFC3D1DE,
-0xFFC1CFDC,
-0xFFC1CFDC,
-0xFFBFCFDC,
-0xFFC2D0DD,
-0xFFC3D1DE,
-0xFFC1CFDC,
-0xFFC3CFDD,
-0xFFC5D1DF,
-0xFFC5D3E0,
-0xFFC3D1DE,
-0xFFC0CDDD,
-0xFFBFCCDC,
-0xFFBCCCDB,
-0xFFC0CDDD,
-0xFFBFCDDA,
-0xFFBFCDDA,
-0xFFBFCBD7,
-0xFFBECAD6,
-0xFFC2CCD6,
-0xFFC3CDD7,
-0xFFC4CED8,
-0xFFC8D0DB,
-0xFFCAD4DE,
-0xFFCDD5E2,
-0xFFCBD5E1,
-0xFFC8D2DE,
-0xFFC4D0DC,
-0xFFC5CEDD,
-0xFFC2CEDC,
-0xFFC3CCDB,
-0xFFC1CDDB,
-0xFFC2CCD8,
-0xFFC2CCD8,
-0xFFC2CCD8,
-0xFFC4CEDA,
-0xFFC7CFDA,
-0xFFC9D1DC,
-0xFFC7CED8,
-0xFFCACED7,
-0xFFC9D0DA,
-0xFFD0D7E1,
-0xFFD4DCE7,
-0xFFCED8E2,
-0xFFC0CCDA,
-0xFFB8C5D5,
-0xFFB3C4D4,
-0xFFB0C3D4,
-0xFFABC0D3,
-0xFFA9BED3,
-0xFFA8BED5,
-0xFFA4BDD3,
-0xFFA0B8D0,
-0xFF9EB3C4,
-0xFFD4DDE4,
-0xFFEDF2F6,
-0xFFE6EFF6,
-0xFFA3B1BE,
-0xFFA1B5CD,
-0xFFB7BFC2,
-0xFF90754A,
-0xFF6F3704,
-0xFF5E1000,
-0xFF50100E,
-0xFFD3C9D4,
-0xFFB7C8DA,
-0xFFB9CADC,
-0xFFBFD0E0,
-0xFFC9D7E4,
-0xFFC8D4E2,
-0xFFBECADA,
-0xFFB3BCCD,
-0xFFB5BECF,
-0xFFACB3C5,
-0xFF9CA3B5,
-0xFF9097A9,
-0xFF9398AB,
-0xFFA9B0C2,
-0xFF9AA1B3,
-0xFF9CA4B7,
-0xFFA6B1C3,
-0xFF9AA7BA,
-0xFFABBACD,
-0xFFA1B2C6,
-0xFFA7B9CD,
-0xFF9FB4C7,
-0xFFA0B6CD,
-0xFFA0B6CE,
-0xFFA1B6D1,
-0xFF9DB5CF,
-0xFF98B2CD,
-0xFF95AFCA,
-0xFF96B0CB,
-0xFF99B3CE,
-0xFF94AEC7,
-0xFF95ADC5,
-0xFF95ABC2,
-0xFF93A8BD,
-0xFF9AACC0,
-0xFFA7B8CA,
-0xFFB2C1D4,
-0xFFB7C4D4,
-0xFFC3CFDD,
-0xFFC9D5E1,
-0xFFD3DDE9,
-0xFFD5E1ED,
-0xFFD3DFED,
-0xFFD0DCEA,
-0xFFD1DDED,
-0xFFD3DFEF,
-0xFFC4D1E2,
-0xFFBDCADB,
-0xFFB9C9D9,
-0xFFBFCFDF,
-0xFFC0D0E0,
-0xFFBACADA,
-0xFFB5C5D5,
-0xFFB6C6D5,
-0xFFB8C6D3,
-0xFFC3D1DC,
-0xFFCEDCE9,
-0xFFCFDDEA,
-0xFFCCDCEB,
-0xFFCCDCEB,
-0xFFC0D0E0,
-0xFFAABBCB,
-0xFF9BACBE,
-0xFF9AACC0,
-0xFF98ADC2,
-0xFF97ACC1,
-0xFF92A8BF,
-0xFF8BA1B9,
-0xFF879DB5,
-0xFF869CB4,
-0xFF889AB2,
-0xFF90A0B9,
-0xFF899BB3,
-0xFF899AB4,
-0xFF92A6BF,
-0xFF8EA2BB,
-0xFF8196B1,
-0xFF8499B4,
-0xFF869EBA,
-0xFF879EBD,
-0xFF88A1BF,
-0xFF8DA6C5,
-0xFF8FAAC8,
-0xFF89A3C4,
-0xFF7F99BA,
-0xFF7793B8,
-0xFF7895BD,
-0xFF7292BB,
-0xFF708DB5,
-0xFF708CB1,
-0xFF7387A8,
-0xFF889CB5,
-0xFF95A7B5,
-0xFF7D93A0,
-0xFF7D99B1,
-0xFF809FBE,
-0xFF7C9ABC,
-0xFF7593B7,
-0xFF7992BA,
-0xFF7A94B9,
-0xFF7390B0,
-0xFF6F8EAB,
-0xFF93A7C2,
-0xFF9BB0CB,
-0xFF879DB5,
-0xFF021830,
-0xFFA4B9D4,
-0xFF91A6C1,
-0xFF90A8C4,
-0xFF879FBB,
-0xFF849DBB,
-0xFF7F98B6,
-0xFF839EBB,
-0xFF86A1BE,
-0xFF809AB5,
-0xFF809AB5,
-0xFF87A1BC,
-0xFF849EB9,
-0xFF8BA5C0,
-0xFF8CA6C1,
-0xFF8EA6C2,
-0xFF8EA3BE,
-0xFF97ABC3,
-0xFFA1B2C4,
-0xFF7C8A95,
-0xFF526063,
-0xFF4E5A56,
-0xFF545F57,
-0xFF353F36,
-0xFF3B453C,
-0xFF333D35,
-0xFF2F3A36,
-0xFF454F50,
-0xFFABB6BC,
-0xFFABBBCA,
-0xFFACBED2,
-0xFFB3C5D9,
-0xFFB5C7DB,
-0xFFB1C2D6,
-0xFFAFC0D4,
-0xFFAFC0D2,
-0xFFABBCCE,
-0xFFA9BACA,
-0xFFA6B8C6,
-0xFFACBECC,
-0xFFADBFCD,
-0xFFAFC1CF,
-0xFFB6C8D6,
-0xFFB9CBD9,
-0xFFC0D0DF,
-0xFFC1CFDA,
-0xFFC5D1DD,
-0xFFC3CDD9,
-0xFFBEC8D4,
-0xFFC0CAD6,
-0xFFC6D0DC,
-0xFFC5D1DD,
-0xFFC7D1DD,
-0xFFC5CFDB,
-0xFFC5CFDB,
-0xFFC5CEDD,
-0xFFC3CFDF,
-0xFFBFCFDE,
-0xFFBCCDDD,
-0xFFB9CADA,
-0xFFB6C7D7,
-0xFFBBCEDF,
-0xFFBCCFE0,
-0xFFBACFE0,
-0xFFB7CCDD,
-0xFFB2C8D6,
-0xFFABC1CF,
-0xFFA5B8C9,
-0xFF9FB2C3,
-0xFF9FB4C7,
-0xFF9EB5C7,
-0xFF9FB5CA,
-0xFF9FB8CC,
-0xFFA0B9CD,
-0xFFA1BACE,
-0xFFA3B9D0,
-0xFFA3B8CB,
-0xFFA4BAC7,
-0xFFA5BBC8,
-0xFFA9BBCF,
-0xFFBECDE4,
-0xFF222E48,
-0xFF202A43,
-0xFF242B3E,
-0xFF131929,
-0xFF1B1E2D,
-0xFF1E202D,
-0xFF1E1F31,
-0xFF25283B,
-0xFF26293C,
-0xFF1F2437,
-0xFF222838,
-0xFF222838,
-0xFF202334,
-0xFF1E1F31,
-0xFF171628,
-0xFF0F0E1E,
-0xFF0F111E,
-0xFF151723,
-0xFF12171D,
-0xFF0C1117,
-0xFF0E1118,
-0xFF0A0D14,
-0xFF040B15,
-0xFF1E2A36,
-0xFFBECEDD,
-0xFFAEBFCF,
-0xFFBBCEDF,
-0xFFB8CBDC,
-0xFFBBCCDC,
-0xFFBFD0E0,
-0xFFBFCFDE,
-0xFFBCCCDB,
-0xFFC1CFDC,
-0xFFC5D3DE,
-0xFFC7D0DF,
-0xFFC4CEDA,
-0xFFC7D1DB,
-0xFFC6D0DA,
-0xFFC8D2DC,
-0xFFCBD5DF,
-0xFFCAD4DD,
-0xFFC1CED7,
-0xFFBBC8D1,
-0xFFB8C6D1,
-0xFFB3C3D0,
-0xFFB2C4D2,
-0xFFB1C2D2,
-0xFFB2C3D3,
-0xFFB4C5D5,
-0xFFB4C5D5,
-0xFFB6C7D7,
-0xFFBCCEDC,
-0xFFBDCDDC,
-0xFFBECEDD,
-0xFFBFCCDC,
-0xFFBECCD9,
-0xFFC1CDDB,
-0xFFC8D2DE,
-0xFFCAD4E0,
-0xFFCAD4E0,
-0xFFBECBDB,
-0xFFBAC7D7,
-0xFFB4C4D3,
-0xFFB1C1D0,
-0xFFB0C0CF,
-0xFFB0C0CF,
-0xFFB0C1D1,
-0xFFB1C2D2,
-0xFFB2C3D3,
-0xFFB1C2D2,
-0xFFB2C4D2,
-0xFFB3C5D3,
-0xFFB5C5D4,
-0xFFB4C6D2,
-0xFFB5C7D5,
-0xFFB6C8D6,
-0xFFB9CBD9,
-0xFFB6C8D6,
-0xFFB5C5D4,
-0xFFB4C5D5,
-0xFFB2C3D3,
-0xFFAFC0D0,
-0xFFB0C1D1,
-0xFFB4C5D5,
-0xFFB6C7D7,
-0xFFB8C9D9,
-0xFFB8CAD8,
-0xFFBBCBDA,
-0xFFBFCFDE,
-0xFFBECEDD,
-0xFFBAC8D5,
-0xFFB7C5D2,
-0xFFB3C1CE,
-0xFFB6C2D0,
-0xFFB7C3D3,
-0xFFB5C1D1,
-0xFFB4C0D0,
-0xFFB6C2D2,
-0xFFB9C5D5,
-0xFFBCC8D8,
-0xFFBECADA,
-0xFFC0CCDA,
-0xFFC3CCDB,
-0xFFC4CDDC,
-0xFFC4CDDC,
-0xFFC8D2DE,
-0xFFCDD7E3,
-0xFFD2DCE6,
-0xFFD3DAE4,
-0xFFD5DCE6,
-0xFFD7DEE8,
-0xFFDAE2ED,
-0xFFDAE4EE,
-0xFFD0DCE8,
-0xFFC1CFDC,
-0xFFB7C7D7,
-0xFFB1C2D4,
-0xFFAABFD2,
-0xFFA3B9CE,
-0xFF9DB6CC,
-0xFF9BB5CC,
-0xFF9AB4CD,
-0xFF95B1C9,
-0xFF94AABF,
-0xFFD3DDE6,
-0xFFECF4F7,
-0xFFE7F2F8,
-0xFFA0B0BD,
-0xFF8EA4BB,
-0xFFA8B1B0,
-0xFFB19862,
-0xFFD49D5C,
-0xFF711E00,
-0xFF550C06,
-0xFF8D7582,
-0xFFB1B2C6,
-0xFFAEAFC3,
-0xFFB7B8CA,
-0xFFBCB9CA,
-0xFFBAB9C9,
-0xFFB4BBCD,
-0xFFB3BED2,
-0xFFA6B1C5,
-0xFFADB5CA,
-0xFF9CA3B6,
-0xFFA0A7B9,
-0xFFA1A9BC,
-0xFFAEB7C8,
-0xFF969FAE,
-0xFF95A1B1,
-0xFF909BAF,
-0xFF95A1B7,
-0xFF9CABC0,
-0xFFA4B5C9,
-0xFF9EB0C6,
-0xFF99AEC3,
-0xFF98ADC2,
-0xFF9BB0C5,
-0xFF9CB2C7,
-0xFF9CB2C7,
-0xFF99AFC4,
-0xFF98AEC3,
-0xFF9BB4C8,
-0xFFA3B9CE,
-0xFFB3CADC,
-0xFFBACDDE,
-0xFFBDCEDE,
-0xFFBFCFDE,
-0xFFC8D8E7,
-0xFFD7E4F4,
-0xFFDEEAF6,
-0xFFDFE8F1,
-0xFFDBE2EA,
-0xFFDFE3EC,
-0xFFE4E9EF,
-0xFFE8EFF7,
-0xFFE8EFF7,
-0xFFDEE5EF,
-0xFFD1D7E3,
-0xFFC8D0DB,
-0xFFC8D0DD,
-0xFFCBD5E1,
-0xFFCED8E4,
-0xFFCCD9E2,
-0xFFCDDAE3,
-0xFFCDDAE3,
-0xFFCCD8E4,
-0xFFCAD7E0,
-0xFFCDD7E1,
-0xFFD4DEE7,
-0xFFD4DEE8,
-0xFFD0DCE8,
-0xFFD2DEEA,
-0xFFCEDCE9,
-0xFFBECBDB,
-0xFFADBDCC,
-0xFFACBCCC,
-0xFFB0C1D1,
-0xFFB9CADA,
-0xFFBACBDD,
-0xFFAFC0D2,
-0xFFA6B7C9,
-0xFFADBED0,
-0xFFBCCCDC,
-0xFFBCC9DA,
-0xFFBFCBDB,
-0xFFD4DCEF,
-0xFFDEE6F9,
-0xFFDCE4F7,
-0xFFD3DEF0,
-0xFFCFDCEF,
-0xFFBECDE0,
-0xFFBECFE3,
-0xFFBECFE3,
-0xFFBCCCE3,
-0xFFBBCDE5,
-0xFFBBCDE5,
-0xFFABBFD8,
-0xFF95AAC5,
-0xFF879FBB,
-0xFF87A1C4,
-0xFF87A1C6,
-0xFF86A0C3,
-0xFF8FA8C7,
-0xFF9FB3CE,
-0xFFA5B6CA,
-0xFF9DAEB8,
-0xFF9EB0BA,
-0xFF97B0C4,
-0xFF9AB6CE,
-0xFF99B4CF,
-0xFF9DB8D5,
-0xFFA9C2E1,
-0xFFA9C0DF,
-0xFFA5BFD8,
-0xFFAAC4DB,
-0xFFACBBCE,
-0xFFB1C2D4,
-0xFFB7C8DC,
-0xFF728397,
-0xFFB4C4DB,
-0xFFA0B0C7,
-0xFFB1C3DB,
-0xFFA9BBD1,
-0xFFADBFD5,
-0xFFA7B9CF,
-0xFFA6BBCE,
-0xFFABC0D3,
-0xFF98ADC0,
-0xFFA7BCCF,
-0xFFA5BACD,
-0xFFAABFD4,
-0xFFA4BCD4,
-0xFF9DB5CD,
-0xFF9DB3CA,
-0xFF9EB0C4,
-0xFFACBCCB,
-0xFFBCC9D2,
-0xFF798287,
-0xFF3D4343,
-0xFF535854,
-0xFF6F746D,
-0xFF43463F,
-0xFF3B3E37,
-0xFF454742,
-0xFF2D322E,
-0xFF393D3C,
-0xFF5B6064,
-0xFF919AA3,
-0xFFCBD4E3,
-0xFFC6CFDE,
-0xFFCBD4E5,
-0xFFC1CCDE,
-0xFFC1CCDE,
-0xFFB9C5D5,
-0xFFBFCBD9,
-0xFFBECAD6,
-0xFFC0CDD6,
-0xFFBBC8D1,
-0xFFC1CDD9,
-0xFFC9D5E3,
-0xFFC7D3E3,
-0xFFC4CFE1,
-0xFFCBD7E7,
-0xFFC5D1DD,
-0xFFC7D1DB,
-0xFFCCD4E1,
-0xFFC2CAD7,
-0xFFBFC9D5,
-0xFFC4D0DC,
-0xFFC4D2DB,
-0xFFCFDCE5,
-0xFFD1D9E4,
-0xFFCDD5E0,
-0xFFCBD5E1,
-0xFFC6D2DE,
-0xFFC6D6E3,
-0xFFBDCFDD,
-0xFFC5D7E5,
-0xFFC1D1E0,
-0xFFC0CDDD,
-0xFFCAD8E5,
-0xFFCADBE5,
-0xFFC2D4DE,
-0xFFC7D9E3,
-0xFFBFD1DB,
-0xFFB9C9D6,
-0xFFABBBCB,
-0xFFA3B6C7,
-0xFFA0B5C8,
-0xFF97B0C4,
-0xFF94AFC4,
-0xFF97B0C6,
-0xFF9CB2C9,
-0xFFA5B7CD,
-0xFFA2B3C7,
-0xFFA1B2C4,
-0xFF9BAEBF,
-0xFFA8B9CD,
-0xFFBECDE4,
-0xFF5D6983,
-0xFF17213A,
-0xFF181F32,
-0xFF191F2F,
-0xFF0E121E,
-0xFF242633,
-0xFF262837,
-0xFF1F2130,
-0xFF262835,
-0xFF232733,
-0xFF1B1E2D,
-0xFF0A1020,
-0xFF030615,
-0xFF1F2231,
-0xFF06071B,
-0xFF1F1D32,
-0xFF2A293B,
-0xFF1F1E2C,
-0xFF171721,
-0xFF17181D,
-0xFF12151A,
-0xFF0F141A,
-0xFF020B14,
-0xFF091523,
-0xFFCDDAED,
-0xFFB1C0D5,
-0xFFB5C6DA,
-0xFFB9CBE1,
-0xFFB9CBE1,
-0xFFB0C2D8,
-0xFFB8CADE,
-0xFFB9CCDD,
-0xFFBACCD8,
-0xFFBDCFDB,
-0xFFC0CDDE,
-0xFFBCC9DA,
-0xFFBFCBD9,
-0xFFBECAD6,
-0xFFC2D0DD,
-0xFFBAC8D3,
-0xFFB8C9D1,
-0xFFB5C7D1,
-0xFFB1C4D2,
-0xFFAFC2D1,
-0xFFADC3D1,
-0xFFB5CBD9,
-0xFFB8CADE,
-0xFFB8CAE0,
-0xFFB3C5DB,
-0xFFBACCE0,
-0xFFB8CBDC,
-0xFFBDD0DF,
-0xFFBACDDB,
-0xFFBACDDB,
-0xFFB8C9D9,
-0xFFC1D2E2,
-0xFFBDCDDD,
-0xFFC5D2E3,
-0xFFC3CFDF,
-0xFFC4D0E0,
-0xFFBFCCDF,
-0xFFB9C8DB,
-0xFFB7C8DA,
-0xFFA8BBCA,
-0xFFACBFD0,
-0xFFA7BCCF,
-0xFF9FB4C9,
-0xFFA1B6CB,
-0xFFA5B7CF,
-0xFFA4B6CC,
-0xFFA5B7CB,
-0xFFACBFD0,
-0xFFB2C3D3,
-0xFFB0C3D1,
-0xFFAEC1D0,
-0xFFAEC4D2,
-0xFFABC1CF,
-0xFFAAC1CF,
-0xFFAAC0CE,
-0xFFABC2D2,
-0xFFA2B9C9,
-0xFFA5BCCC,
-0xFFA3BACA,
-0xFFA2B9CB,
-0xFFA2B9CB,
-0xFFA5BCCE,
-0xFFA7BED0,
-0xFFA4B9CC,
-0xFFABC0D3,
-0xFFAFC4D7,
-0xFFACC1D4,
-0xFFB0C5D8,
-0xFFAFC2D3,
-0xFFB3C4D6,
-0xFFB7C6D9,
-0xFFAFBED1,
-0xFFB8C5D6,
-0xFFBDC8DA,
-0xFFC1CDDD,
-0xFFC0C9D8,
-0xFFC5CEDD,
-0xFFD0DAE6,
-0xFFD1D9E6,
-0xFFD1DBE7,
-0xFFC8D2DE,
-0xFFC4D0DC,
-0xFFB9C5D1,
-0xFFBFCCD5,
-0xFFC3CDD7,
-0xFFC8D0DB,
-0xFFD0D8E3,
-0xFFCFD7E2,
-0xFFD5DFE9,
-0xFFD5E1ED,
-0xFFCAD7E7,
-0xFFB9CADC,
-0xFFB0C2D6,
-0xFFA5B9D1,
-0xFFA8BED5,
-0xFF9DB5CD,
-0xFF9CB6CD,
-0xFF94AEC7,
-0xFF96B0CB,
-0xFF92A6BE,
-0xFFD3D9E5,
-0xFFF1F4F9,
-0xFFE8F3F7,
-0xFF9EB1B8,
-0xFF9CB1C4,
-0xFFB2BCB4,
-0xFFC4B16F,
-0xFFD4A557,
-0xFF752600,
-0xFF540400,
-0xFF723E4A,
-0xFFE5BFD4,
-0xFFDFBACC,
-0xFFC39EB0,
-0xFFBD93A7,
-0xFFDEC1D7,
-0xFFC5C3D8,
-0xFFB0BCD2,
-0xFFA0ACC4,
-0xFFAAB5CB,
-0xFF99A2B3,
-0xFF919AA9,
-0xFFB7C3D3,
-0xFFB9C7D4,
-0xFF9CABB2,
-0xFFA1AFB8,
-0xFF98A3B5,
-0xFFA2ADC3,
-0xFFA6B2C8,
-0xFFACBBD2,
-0xFFA0B2CA,
-0xFF9CAEC4,
-0xFFA5B6C8,
-0xFFAFBFCE,
-0xFFB2C4D2,
-0xFFB5C7D3,
-0xFFBACBD3,
-0xFFC3D1DA,
-0xFFBECEDB,
-0xFFCBDBE8,
-0xFFD8E4F0,
-0xFFDAE4ED,
-0xFFE5E9F2,
-0xFFE6EAF5,
-0xFFDCE4F1,
-0xFFD6DEEB,
-0xFFDBDFE8,
-0xFFDCDFE4,
-0xFFDEDEE6,
-0xFFE3E3EB,
-0xFFE4E7EC,
-0xFFE5E8ED,
-0xFFE6E9F0,
-0xFFE4E8F1,
-0xFFDCE0EC,
-0xFFD2D8E6,
-0xFFC6CDDD,
-0xFFC4CEDA,
-0xFFC4CED8,
-0xFFC7D1DA,
-0xFFC8D5DD,
-0xFFC9D6DE,
-0xFFC7D5DE,
-0xFFC6D3DC,
-0xFFCCD4DF,
-0xFFCCD3DD,
-0xFFCFD7E2,
-0xFFD1DBE7,
-0xFFCAD6E6,
-0xFFC1CEDF,
-0xFFBCC9DC,
-0xFFBAC7DA,
-0xFFBBC8D9,
-0xFFC9D6E6,
-0xFFD1DDEB,
-0xFFD7E1ED,
-0xFFE0E9F2,
-0xFFE5ECF4,
-0xFFE5EAEE,
-0xFFE5EAEE,
-0xFFE2E9EF,
-0xFFD1D8E0,
-0xFFE5E8F1,
-0xFFE9E7F2,
-0xFFE8E7EF,
-0xFFE6E6EE,
-0xFFE1E4ED,
-0xFFD4DBE3,
-0xFFD3DCE5,
-0xFFD0DAE4,
-0xFFCFD9E5,
-0xFFCDD6E5,
-0xFFC5D0E2,
-0xFFBFCCDD,
-0xFFB9CADC,
-0xFFB6C8DE,
-0xFFB6C7E1,
-0xFFAEC1DF,
-0xFFACC0DB,
-0xFFB1C5DE,
-0xFFACBDD1,
-0xFFABB8C8,
-0xFFA3ACB3,
-0xFFA7B0B7,
-0xFFB2C4D2,
-0xFFA6BBCE,
-0xFFAEC3D6,
-0xFFB8CAE0,
-0xFFB9C9E0,
-0xFFB2C3D7,
-0xFFBCCBDE,
-0xFFC6D3E4,
-0xFF484F59,
-0xFF59626B,
-0xFF575F6A,
-0xFF808893,
-0xFFC0C8D5,
-0xFFA0AAB6,
-0xFF5C6373,
-0xFF4A5460,
-0xFF59636D,
-0xFFACB6BF,
-0xFFB4BEC7,
-0xFF8E9BA3,
-0xFF87919A,
-0xFF8B98A0,
-0xFFB2BCC5,
-0xFFD1DFEA,
-0xFFC5D6E6,
-0xFFBBCCDC,
-0xFFC4D4E1,
-0xFFCAD8E1,
-0xFFD1DCE2,
-0xFFD5DDDF,
-0xFF6F7372,
-0xFF41433E,
-0xFF595A52,
-0xFF54544C,
-0xFF303028,
-0xFF3E3E36,
-0xFF23241E,
-0xFF343530,
-0xFF595B58,
-0xFF252628,
-0xFF5D6065,
-0xFFD9DDE6,
-0xFFCED2DB,
-0xFFD5D9E4,
-0xFFCFD5E1,
-0xFFD2D8E4,
-0xFFD1D7E3,
-0xFFCDD6DF,
-0xFFCFD8E1,
-0xFFC8D1D8,
-0xFFC9D2D9,
-0xFFCAD4DD,
-0xFFC3CDD7,
-0xFFC7D1DD,
-0xFFC9D2E1,
-0xFFCBD4E3,
-0xFFC9D6DF,
-0xFFCBD5DF,
-0xFFD0D8E5,
-0xFFCDD7E3,
-0xFFC6D2DE,
-0xFFC0CED9,
-0xFFC6D4DD,
-0xFFC1CFD8,
-0xFFC7D1DB,
-0xFFCAD2DD,
-0xFFC4CED8,
-0xFFBDCAD3,
-0xFFBDCED8,
-0xFFBACCD8,
-0xFFBFCFDE,
-0xFFB8C5D5,
-0xFFC2CBDA,
-0xFFC9D3DF,
-0xFFC3D0D9,
-0xFFC5D2DA,
-0xFFC1CED6,
-0xFFC3D0D8,
-0xFFC7D1DD,
-0xFFC2CEDC,
-0xFFBDCDDD,
-0xFFB2C5D6,
-0xFFB3CADA,
-0xFFACC6D7,
-0xFFAEC5D7,
-0xFFBCCEE2,
-0xFFBCCBDE,
-0xFFBFCCDF,
-0xFFC1D1E1,
-0xFFB8C9D9,
-0xFFB8C7DA,
-0xFFC5D4E9,
-0xFF8490A8,
-0xFF222C45,
-0xFF1C2336,
-0xFF0D1321,
-0xFF080C18,
-0xFF131521,
-0xFF1A1927,
-0xFF232230,
-0xFF181B24,
-0xFF0F121B,
-0xFF060918,
-0xFF010413,
-0xFF282E3C,
-0xFF111725,
-0xFF222337,
-0xFF25263A,
-0xFF1F1C31,
-0xFF191627,
-0xFF15141C,
-0xFF0E0F13,
-0xFF131418,
-0xFF050A0E,
-0xFF09121B,
-0xFF091221,
-0xFFD1DCEE,
-0xFFBCC9DC,
-0xFFB9C6D9,
-0xFFB0BFD2,
-0xFFADBFD3,
-0xFFABBDD3,
-0xFFAEC0D4,
-0xFFA6B9CA,
-0xFFAEC2CD,
-0xFFB0C2CE,
-0xFFB5C5D5,
-0xFFBBCBDB,
-0xFFBECCD7,
-0xFFBFCDD8,
-0xFFBBC9D6,
-0xFFC4D4E3,
-0xFFBED0DA,
-0xFFB3C7D2,
-0xFFB3C9D7,
-0xFFB2C8D6,
-0xFFB7CBD6,
-0xFFB5C9D4,
-0xFFB4C5D5,
-0xFFB2C3D5,
-0xFFB1C2D6,
-0xFFB7C8DA,
-0xFFB5C8D7,
-0xFFB7CAD8,
-0xFFB8CEDB,
-0xFFB4CAD7,
-0xFFB5CADB,
-0xFFB0C5D8,
-0xFFBACCE2,
-0xFFB3C4D8,
-0xFFB1C2D6,
-0xFFB3C2D5,
-0xFFB6C5DA,
-0xFFB1C0D3,
-0xFFAFC0D2,
-0xFFB2C5D6,
-0xFFAABFD0,
-0xFFAAC1D1,
-0xFFB4CBDD,
-0xFFB9D0E2,
-0xFFBCD1E6,
-0xFFBACFE2,
-0xFFB2C4D8,
-0xFFB3C6D7,
-0xFFB6C9DA,
-0xFFB8CBDA,
-0xFFB9CFDD,
-0xFFBBD1DF,
-0xFFBBD2E0,
-0xFFBAD1DF,
-0xFFBBD2E2,
-0xFFBBD2E2,
-0xFFB8CFDF,
-0xFFB8CFDF,
-0xFFBDD2E3,
-0xFFB9D0E0,
-0xFFB1C6D9,
-0xFFABC2D4,
-0xFFA7BCCF,
-0xFFA7BED0,
-0xFFA6BBD0,
-0xFFA8BED3,
-0xFFAEC3D8,
-0xFFB9CEE1,
-0xFFBDD2E3,
-0xFFBED1E2,
-0xFFBCCDDF,
-0xFFC1D1E1,
-0xFFC7D4E4,
-0xFFC9D5E3,
-0xFFCAD4E0,
-0xFFCBD3DE,
-0xFFD3DBE6,
-0xFFD7DFEA,
-0xFFD5DDE8,
-0xFFD5DDE8,
-0xFFCFD9E3,
-0xFFC7D4DD,
-0xFFC7D4DD,
-0xFFC4D2DB,
-0xFFC5D1DD,
-0xFFC2CCD8,
-0xFFC0CAD6,
-0xFFC0CAD4,
-0xFFC4CED8,
-0xFFC0CDD6,
-0xFFBECCD9,
-0xFFC1D1E0,
-0xFFBECFE1,
-0xFFBFD1E5,
-0xFFB7CCDF,
-0xFFAFC4D9,
-0xFFB1C6DB,
-0xFFB0C5DA,
-0xFFA3B7CF,
-0xFFA1B0C3,
-0xFFD7DBE7,
-0xFFECEFF6,
-0xFFE8F3F7,
-0xFFA4B5BD,
-0xFFB5C6D8,
-0xFFC4CAC6,
-0xFFD3C78D,
-0xFFC8A65E,
-0xFFC6895A,
-0xFF96553F,
-0xFF57242B,
-0xFFB88DA0,
-0xFFA67C8A,
-0xFF774252,
-0xFF823D4F,
-0xFFC58C9F,
-0xFFDBC8DB,
-0xFFC0C3D6,
-0xFFB1B8CB,
-0xFFA9B0C3,
-0xFF9AA1B3,
-0xFF8E95A5,
-0xFFA7B3C3,
-0xFFB1BFCC,
-0xFF8B9AA1,
-0xFF95A2AB,
-0xFF9CA5B6,
-0xFFB1B7CD,
-0xFFB9C4D8,
-0xFFBBC8DB,
-0xFFAAB9CE,
-0xFFBFCEE3,
-0xFFCEDBEB,
-0xFFDCE8F4,
-0xFFDDEBF6,
-0xFFD2E1E8,
-0xFFD0DBE1,
-0xFFD4DDE4,
-0xFFD6E0EA,
-0xFFD5DFE9,
-0xFFD2D9E3,
-0xFFD5D8DF,
-0xFFDFE0E5,
-0xFFDBDBE3,
-0xFFD4DAE6,
-0xFFD2DAE5,
-0xFFD8DDE3,
-0xFFD7DBDE,
-0xFFDADBE0,
-0xFFDDDEE3,
-0xFFDDE1E4,
-0xFFDDE1E4,
-0xFFDEE1E6,
-0xFFE0E4ED,
-0xFFDFE3EE,
-0xFFD9DFED,
-0xFFD5DBE9,
-0xFFCFD7E4,
-0xFFCAD2DD,
-0xFFC7D1DA,
-0xFFCAD4DD,
-0xFFCAD7DF,
-0xFFCAD6E2,
-0xFFC9D5E1,
-0xFFC7D1DD,
-0xFFC9D3DF,
-0xFFCAD6E4,
-0xFFC3D0E0,
-0xFFB2C2D2,
-0xFFA8B7CA,
-0xFFA9B8CD,
-0xFFADBCD1,
-0xFFB8C7DA,
-0xFFBDCADB,
-0xFFC7D3E1,
-0xFFD4DCE7,
-0xFFDFE4EA,
-0xFFE4E8EB,
-0xFFE9E9E9,
-0xFFE7E9E8,
-0xFFE6EBEE,
-0xFFD4D9DC,
-0xFFE6E5EB,
-0xFFE7E5EA,
-0xFFEBE6EC,
-0xFFE8E6EB,
-0xFFE4E5EA,
-0xFFDBE0E6,
-0xFFD5DCE2,
-0xFFCED7DE,
-0xFFCCD2DE,
-0xFFCAD2DF,
-0xFFC4CBDD,
-0xFFBCC7D9,
-0xFFB6C6D6,
-0xFFB3C4D6,
-0xFFB1C1DA,
-0xFFAEC0D8,
-0xFFAEC2DB,
-0xFFA4B9CE,
-0xFFA6B9CA,
-0xFFACBAC5,
-0xFF9CA3A9,
-0xFFA6ADB3,
-0xFFADBDCA,
-0xFFACBFD0,
-0xFFB9CADC,
-0xFFBACBDD,
-0xFFADBED0,
-0xFFAABACA,
-0xFFBAC6D6,
-0xFFC2CEDC,
-0xFF302B27,
-0xFF2A2623,
-0xFF2E2A29,
-0xFF312D2C,
-0xFF6E6A69,
-0xFF2D2C2A,
-0xFF322E2F,
-0xFF3C3B39,
-0xFF353432,
-0xFF2D2C28,
-0xFF2E2D29,
-0xFF1C1D17,
-0xFF23221E,
-0xFF12130E,
-0xFF262523,
-0xFF686A69,
-0xFF969EA1,
-0xFFB0BABC,
-0xFFB5BDBF,
-0xFF858B8B,
-0xFF717672,
-0xFF6E716A,
-0xFF5F5F55,
-0xFF5A5A4E,
-0xFF3E3F31,
-0xFF4B4C3E,
-0xFF404034,
-0xFF313125,
-0xFF2C2E23,
-0xFF41423A,
-0xFF3C3F38,
-0xFF383A37,
-0xFF6D6D6F,
-0xFFE5E5E7,
-0xFFCECED0,
-0xFFBFC0C4,
-0xFFC8CCCF,
-0xFFBABDC2,
-0xFFC3C8CC,
-0xFFCFD7DA,
-0xFFB5BDC0,
-0xFFCFD9DB,
-0xFFD2DBE0,
-0xFFC2CBD0,
-0xFFCCD7DB,
-0xFFCDD8DC,
-0xFFCAD5DB,
-0xFFCAD5DB,
-0xFFC5CFD9,
-0xFFC9D3DF,
-0xFFC6D2DE,
-0xFFC9D5E1,
-0xFFD2E0ED,
-0xFFCFDDEA,
-0xFFCDDBE8,
-0xFFCBD7E5,
-0xFFCCD8E4,
-0xFFC5CFDB,
-0xFFC9D3DD,
-0xFFC7D1DB,
-0xFFC1CDD9,
-0xFFBFCDDA,
-0xFFB9C6D6,
-0xFFBFCBDB,
-0xFF9FA4B7,
-0xFFB0B3C4,
-0xFFCDD3DF,
-0xFFCFD6E0,
-0xFFCFD3DE,
-0xFFCFD3DE,
-0xFFBEC2CE,
-0xFFD4DAE8,
-0xFFCCD6E2,
-0xFFB7C5D0,
-0xFF7B8D97,
-0xFF97A9B3,
-0xFFC2D4DE,
-0xFFC6D7E1,
-0xFFD3DFED,
-0xFFD0DAE6,
-0xFFCBD9E4,
-0xFFD2E3ED,
-0xFFC2D0DB,
-0xFFCAD8E5,
-0xFFA2AFC2,
-0xFF1B263A,
-0xFF252C3C,
-0xFF0F1521,
-0xFF111520,
-0xFF090B17,
-0xFF080814,
-0xFF2F2F3B,
-0xFF040710,
-0xFF02050E,
-0xFF070A19,
-0xFF2A303E,
-0xFF1C2230,
-0xFF2B313F,
-0xFF252638,
-0xFF1A1B2D,
-0xFF201D2E,
-0xFF171522,
-0xFF0E0D15,
-0xFF0F1014,
-0xFF07080C,
-0xFF0C1115,
-0xFF00070F,
-0xFF0E1621,
-0xFFD9E0F0,
-0xFFBAC3D2,
-0xFFBAC4D0,
-0xFFBBC7D3,
-0xFFB4C4D1,
-0xFFB3C5D3,
-0xFFB3C4D4,
-0xFFB1C2D2,
-0xFFAEC0CA,
-0xFFB5C6D0,
-0xFFB7C7D4,
-0xFFBECCD7,
-0xFFBFCCD4,
-0xFFC3D0D8,
-0xFFC0CCDA,
-0xFFB5C2D2,
-0xFFBECEDB,
-0xFFB7C9D5,
-0xFFBCD0DB,
-0xFFCDDFE9,
-0xFFD4E3E6,
-0xFFD6E1E5,
-0xFFD6E0E9,
-0xFFD7E1EB,
-0xFFCEDAE6,
-0xFFC1CDDB,
-0xFFBDCBD6,
-0xFFB5C7D1,
-0xFFB2C6CF,
-0xFFA7BFCB,
-0xFFACC3D3,
-0xFFABC4D8,
-0xFFA3BCD2,
-0xFFA4BDD3,
-0xFFA2BBD1,
-0xFFA6BDCF,
-0xFFA7B8C8,
-0xFFACBCCB,
-0xFFB3C4D4,
-0xFFADC0CF,
-0xFFB7CDDA,
-0xFFB5CBD6,
-0xFFC4DBE3,
-0xFFC3DAE0,
-0xFFD1E5EC,
-0xFFCADEE7,
-0xFFB2C5D3,
-0xFFAEC1D0,
-0xFFB2C5D6,
-0xFFB3C6D5,
-0xFFB1C7D4,
-0xFFB1C7D2,
-0xFFB6C9D7,
-0xFFB6C8D6,
-0xFFB5C6D6,
-0xFFB4C5D5,
-0xFFB6C7D7,
-0xFFB1C2D2,
-0xFFBCCCDC,
-0xFFB8C9D9,
-0xFFBECEDE,
-0xFFBACBDB,
-0xFFB8C8D8,
-0xFFBFD0E0,
-0xFFBFCFDF,
-0xFFBDCEDE,
-0xFFBECEDE,
-0xFFBDCEDE,
-0xFFBED0DE,
-0xFFBBCBD8,
-0xFFBCCCD9,
-0xFFC1CFDA,
-0xFFBAC7D0,
-0xFFC9D4DA,
-0xFFDFE8ED,
-0xFFDFE6EC,
-0xFFD7DEE4,
-0xFFD6DDE3,
-0xFFDAE1E9,
-0xFFD0D9E0,
-0xFFCED8E1,
-0xFFC5D2DB,
-0xFFC2CFD8,
-0xFFB7C5D0,
-0xFFB7C5D2,
-0xFFBFCDD8,
-0xFFBFCBD7,
-0xFFC0CAD4,
-0xFFBEC8D1,
-0xFFC4CED7,
-0xFFC5D2DA,
-0xFFC0CDD6,
-0xFFBECAD6,
-0xFFC0CEDB,
-0xFFC5D3E0,
-0xFFCCDAE5,
-0xFFD4E2ED,
-0xFFD4E0EC,
-0xFFCCD6E2,
-0xFFD1D9E4,
-0xFFE2E4F0,
-0xFFECF0F9,
-0xFFE6EFF8,
-0xFFABB5BF,
-0xFFCCD5E6,
-0xFFD8D9DD,
-0xFFE4DABF,
-0xFFC5B385,
-0xFFA68A5A,
-0xFFFCE2BF,
-0xFFECDADA,
-0xFFBCAEBB,
-0xFFCEBDC7,
-0xFFFFDAE2,
-0xFFA04B52,
-0xFF5E0C12,
-0xFF5B323A,
-0xFFE6D6E0,
-0xFFC2BCC8,
-0xFFB7B6C6,
-0xFFA6A9BC,
-0xFFA6ADC0,
-0xFFCAD6E6,
-0xFFBAC8D5,
-0xFF8D99A7,
-0xFFABB4C3,
-0xFFBFC2D1,
-0xFFC0C3D2,
-0xFFCCD3E3,
-0xFFC5CEDD,
-0xFFD4DDEE,
-0xFFDBE4F5,
-0xFFD6DFEE,
-0xFFD4DEEA,
-0xFFD0DAE6,
-0xFFC5CFD9,
-0xFFCFD8E1,
-0xFFCFD7E2,
-0xFFE0E8F5,
-0xFFDCE4F1,
-0xFFDBDFEB,
-0xFFD8DAE6,
-0xFFD9D9E3,
-0xFFCFD3DE,
-0xFFC4D1DA,
-0xFFC9D7E0,
-0xFFC7D4DA,
-0xFFC9D3D5,
-0xFFCED6D9,
-0xFFD5DADD,
-0xFFD7DCDF,
-0xFFD5DADD,
-0xFFD1D6DA,
-0xFFCAD1D7,
-0xFFC4CBD3,
-0xFFBFC6D0,
-0xFFC0C6D2,
-0xFFBFC7D2,
-0xFFBFC7D2,
-0xFFBFC9D3,
-0xFFBFC9D3,
-0xFFBEC8D4,
-0xFFBCC5D4,
-0xFFB7C4D4,
-0xFFB4C6D4,
-0xFFB3C9D7,
-0xFFB5CBD9,
-0xFFB0C7D7,
-0xFFA5BCCE,
-0xFF9FB5CA,
-0xFF9EB4C9,
-0xFF9FB4C9,
-0xFFA2B4CA,
-0xFFA6B7C9,
-0xFFB6C3D3,
-0xFFC2CCD8,
-0xFFC8CFD9,
-0xFFD3D8DE,
-0xFFDFE2E7,
-0xFFDFE4E7,
-0xFFDBE5E7,
-0xFFC9D3D5,
-0xFFD7DAE1,
-0xFFD8D8E0,
-0xFFDCDBE3,
-0xFFD9D9E1,
-0xFFD3D7E0,
-0xFFCFD8E1,
-0xFFCBD5DF,
-0xFFC1CDD9,
-0xFFBFC8D9,
-0xFFBBC6D8,
-0xFFB4BFD3,
-0xFFAAB9CE,
-0xFFA3B5CB,
-0xFF9EB2CA,
-0xFF9DB1CA,
-0xFF9BB1C9,
-0xFF97AFC9,
-0xFF9AB3C9,
-0xFF9BB2C4,
-0xFF9EB1BF,
-0xFF9DA7B0,
-0xFF9EA8B1,
-0xFF9DB0BF,
-0xFF9FB6C8,
-0xFF9FB4C9,
-0xFFA3B8CD,
-0xFFA4B9CE,
-0xFFA1B6C9,
-0xFFADBED0,
-0xFFC7D8E8,
-0xFF3B3127,
-0xFF2C2419,
-0xFF3E342B,
-0xFF261D14,
-0xFF2E251E,
-0xFF373026,
-0xFF342B22,
-0xFF362F25,
-0xFF342D23,
-0xFF2C281C,
-0xFF2E281C,
-0xFF2C281C,
-0xFF1F1B10,
-0xFF2F2B20,
-0xFF29251C,
-0xFF221F18,
-0xFF1B1A16,
-0xFF454641,
-0xFF4F4E49,
-0xFF36362E,
-0xFF2E2B22,
-0xFF353327,
-0xFF454233,
-0xFF363324,
-0xFF322F1E,
-0xFF2D2B1C,
-0xFF403E31,
-0xFF303123,
-0xFF28281E,
-0xFF1C1C12,
-0xFF2C2D25,
-0xFF23221D,
-0xFF1D1916,
-0xFF5C5855,
-0xFF575350,
-0xFF363530,
-0xFF4F504B,
-0xFF51534E,
-0xFF414642,
-0xFF545857,
-0xFF303634,
-0xFF6B7171,
-0xFF989DA0,
-0xFF3D4343,
-0xFFDFE5E5,
-0xFFD7DDDB,
-0xFFD5DBD7,
-0xFFD5DBDB,
-0xFFD3D8DE,
-0xFFAEB5BD,
-0xFFB9C4C8,
-0xFFC5D0D4,
-0xFFACB7BD,
-0xFFA7B0B7,
-0xFFB8C1CA,
-0xFFCED7E0,
-0xFFCFD8E1,
-0xFFD5DEE5,
-0xFFCFD7DA,
-0xFFCBD0D4,
-0xFFD4D7DC,
-0xFFDEE3E9,
-0xFFB0B7BF,
-0xFFBEC5CD,
-0xFFB1B4BD,
-0xFFBCBCC4,
-0xFFD2D1D6,
-0xFFA9A9AB,
-0xFF99979A,
-0xFF747275,
-0xFF5F5E64,
-0xFF8C8C94,
-0xFF767B81,
-0xFF4E575C,
-0xFF535E62,
-0xFF5D6B6E,
-0xFF616C72,
-0xFF9FA9B2,
-0xFFA1A7B3,
-0xFFCAD2DD,
-0xFFCCD6E0,
-0xFFCAD7DF,
-0xFFCDDAE2,
-0xFFCFDBE7,
-0xFFB6C1D5,
-0xFF151D32,
-0xFF232A3A,
-0xFF323844,
-0xFF1B1D2A,
-0xFF0D0F1C,
-0xFF11111D,
-0xFF0E101C,
-0xFF00010A,
-0xFF1A1E29,
-0xFF333947,
-0xFF2A3040,
-0xFF272D3B,
-0xFF1A202E,
-0xFF1B1D2C,
-0xFF181A29,
-0xFF100F1D,
-0xFF16141F,
-0xFF0D0C12,
-0xFF0C0D11,
-0xFF090A0C,
-0xFF0B0F12,
-0xFF060B11,
-0xFF1B1F2A,
-0xFFE7EEF8,
-0xFFE2E9F3,
-0xFFE0E7ED,
-0xFFE0E7ED,
-0xFFDBE6EC,
-0xFFD0DDE5,
-0xFFCFDBE7,
-0xFFD2DEEC,
-0xFFD3E0E9,
-0xFFDAE7EF,
-0xFFDFECF5,
-0xFFE0EAF3,
-0xFFDBE6EA,
-0xFFE0EBEF,
-0xFFD4DCE9,
-0xFFD3DCED,
-0xFFD6E2F0,
-0xFFCFDDE8,
-0xFFD2E3ED,
-0xFFD9E8EF,
-0xFFDAE4E6,
-0xFFD5DDDF,
-0xFFDDE2E8,
-0xFFD8DCE7,
-0xFFD4DAE6,
-0xFFD9E1EC,
-0xFFD4DEE7,
-0xFFD4E1E9,
-0xFFC9DAE2,
-0xFFC2D6DF,
-0xFFB7CDDB,
-0xFFA9C0D2,
-0xFFA6BCD1,
-0xFFA5BED2,
-0xFFA7C1D2,
-0xFFBED4E2,
-0xFFCCDCE9,
-0xFFCCDAE7,
-0xFFC7D5E2,
-0xFFCBDBE8,
-0xFFD3E5F1,
-0xFFD6E8F2,
-0xFFCCDFE5,
-0xFFD1E4EA,
-0xFFCDDEE5,
-0xFFD4E5ED,
-0xFFD2E2EF,
-0xFFC1D3E1,
-0xFFBECFDF,
-0xFFB7CAD8,
-0xFFC3D7E2,
-0xFFC1D5DE,
-0xFFC0D2DE,
-0xFFC3D3E0,
-0xFFC5D5E2,
-0xFFCAD8E5,
-0xFFCFDDEA,
-0xFFCDD9E7,
-0xFFD8E4F2,
-0xFFD6E2F0,
-0xFFCCD8E6,
-0xFFCDD9E5,
-0xFFC9D5E1,
-0xFFC9D5E1,
-0xFFC5D1DD,
-0xFFC0CCD8,
-0xFFC6D2DE,
-0xFFCDDBE6,
-0xFFCDDBE4,
-0xFFCADBE3,
-0xFFCCDAE3,
-0xFFCCD9E1,
-0xFFD5E0E6,
-0xFFDCE5EA,
-0xFFDFE6EC,
-0xFFE9F0F6,
-0xFFE1E8EE,
-0xFFD6DDE3,
-0xFFDBE2EA,
-0xFFD5DEE5,
-0xFFD7E1EA,
-0xFFD1DEE7,
-0xFFCFDBE7,
-0xFFD7E5F0,
-0xFFD3E1EE,
-0xFFD1DFEA,
-0xFFD3DFEB,
-0xFFD6E0EA,
-0xFFCFD9E2,
-0xFFD0DBE1,
-0xFFCFDAE0,
-0xFFCBD5DE,
-0xFFCCD6E0,
-0xFFCCD6E0,
-0xFFD1DBE5,
-0xFFD4DEE8,
-0xFFD8E1EA,
-0xFFD4DDE6,
-0xFFDDE1EC,
-0xFFD2D6DF,
-0xFFDFE2E7,
-0xFFEDF2F6,
-0xFFE7EEF4,
-0xFFAFB8C1,
-0xFFD4DCE9,
-0xFFD9DEE4,
-0xFFDEDED6,
-0xFFCFC9B1,
-0xFF80794F,
-0xFFD5CD9F,
-0xFFD8CFAE,
-0xFFE0D5B9,
-0xFFE5D4B8,
-0xFFFFE3C7,
-0xFF832F17,
-0xFF640C00,
-0xFF835234,
-0xFFE7CFB3,
-0xFFD5C8B7,
-0xFFC4BFBB,
-0xFF9797A3,
-0xFF9DA4B7,
-0xFFCCD5E6,
-0xFFADB6C5,
-0xFF8B92A2,
-0xFFAFB5C3,
-0xFFC2C6CF,
-0xFFCED2DB,
-0xFFC9CFDB,
-0xFFBDC5D0,
-0xFFD0D6E2,
-0xFFC3CBD6,
-0xFFC6CEDB,
-0xFFC5CDDA,
-0xFFBEC5D5,
-0xFFC0C8D5,
-0xFFC0C8D5,
-0xFFD0D8E5,
-0xFFCFD9E5,
-0xFFCCD4E1,
-0xFFCBCEDD,
-0xFFCED0DD,
-0xFFD0D4E0,
-0xFFD2DAE5,
-0xFFC6D4DD,
-0xFFCDDEE6,
-0xFFC9D8DF,
-0xFFD3E1E4,
-0xFFD7E0E5,
-0xFFDBE3E6,
-0xFFDCE4E7,
-0xFFDAE2E5,
-0xFFD7DEE4,
-0xFFD6DDE3,
-0xFFD6DDE5,
-0xFFD6DDE5,
-0xFFDBE2EC,
-0xFFD6DEE9,
-0xFFCFD7E2,
-0xFFC8D2DC,
-0xFFC4CEDA,
-0xFFC3CDD9,
-0xFFC1CAD9,
-0xFFBCC9D9,
-0xFFB4C7D6,
-0xFFB1C7D5,
-0xFFB2C9D7,
-0xFFB4CBDB,
-0xFFB5CCDC,
-0xFFB5CCDC,
-0xFFB3CADA,
-0xFFAEC3D4,
-0xFFAEC1D2,
-0xFFB7C8D8,
-0xFFC3D0E0,
-0xFFC2CEDC,
-0xFFC2CAD7,
-0xFFC8CEDA,
-0xFFCED2DD,
-0xFFCACED7,
-0xFFC9D2D7,
-0xFFBAC3C8,
-0xFFCACFD5,
-0xFFCCCFD6,
-0xFFD1D1DB,
-0xFFC9CCD5,
-0xFFC2CBD4,
-0xFFC4CED8,
-0xFFBECAD6,
-0xFFB6C4D1,
-0xFFB4C0D0,
-0xFFB3BED0,
-0xFFACB9CC,
-0xFFA1B0C3,
-0xFF9BACC0,
-0xFF98AAC0,
-0xFF96A8BE,
-0xFF92A6BE,
-0xFF8CA2B9,
-0xFF93A9BE,
-0xFF8FA4B5,
-0xFF98A8B5,
-0xFFA5AEB5,
-0xFFBFC8CF,
-0xFFC2D2E1,
-0xFFC0D3E4,
-0xFFAFC1D5,
-0xFFA9BBCF,
-0xFFA6B8CC,
-0xFFA0B2C6,
-0xFFA3B4C4,
-0xFFBFCFDE,
-0xFF31291E,
-0xFF231D11,
-0xFF453D32,
-0xFF3E382C,
-0xFF2F281E,
-0xFF2B271B,
-0xFF383226,
-0xFF2D2A1B,
-0xFF353223,
-0xFF211F10,
-0xFF312E1F,
-0xFF201E0F,
-0xFF333124,
-0xFF28261A,
-0xFF2C2920,
-0xFF151209,
-0xFF18140B,
-0xFF1F1810,
-0xFF3B342C,
-0xFF2A2319,
-0xFF262014,
-0xFF2A2416,
-0xFF393325,
-0xFF393323,
-0xFF2C2618,
-0xFF3E3B2C,
-0xFF292519,
-0xFF413F32,
-0xFF29261D,
-0xFF221F16,
-0xFF211E17,
-0xFF221F18,
-0xFF28241B,
-0xFF464438,
-0xFF373529,
-0xFF3E3E32,
-0xFF414234,
-0xFF35372A,
-0xFF37392E,
-0xFF3D4037,
-0xFF32332E,
-0xFF2A2B26,
-0xFF272624,
-0xFF34332F,
-0xFF908D88,
-0xFFA7A49B,
-0xFF9C988D,
-0xFF787469,
-0xFF706D68,
-0xFF545550,
-0xFF575C55,
-0xFF565E53,
-0xFF2E332C,
-0xFF292B26,
-0xFF343432,
-0xFF494949,
-0xFF797B78,
-0xFF696A64,
-0xFF79796F,
-0xFF646054,
-0xFF81796E,
-0xFF80796F,
-0xFF95928B,
-0xFFA0A098,
-0xFF717165,
-0xFF4B493A,
-0xFF494635,
-0xFF464030,
-0xFF5A5343,
-0xFF61594E,
-0xFF857E76,
-0xFF898681,
-0xFF9FA09B,
-0xFF545653,
-0xFF4F5450,
-0xFF525655,
-0xFF686C6F,
-0xFF8C8F98,
-0xFFBEC0CF,
-0xFFD3D6E7,
-0xFFD0D8E5,
-0xFFC6D0DA,
-0xFFC7D1DA,
-0xFFCFD8E7,
-0xFFD6DDF7,
-0xFF232845,
-0xFF272C3F,
-0xFF1C2232,
-0xFF2F3044,
-0xFF2E2F41,
-0xFF1E202D,
-0xFF0F111D,
-0xFF2E303D,
-0xFF303342,
-0xFF262B3E,
-0xFF202538,
-0xFF1D2331,
-0xFF191F2D,
-0xFF1C1E2D,
-0xFF141623,
-0xFF161620,
-0xFF0D0D15,
-0xFF0A0B0F,
-0xFF0C0D0F,
-0xFF0B0C10,
-0xFF0C0D11,
-0xFF02050C,
-0xFF2C2F36,
-0xFFF4F5FA,
-0xFFE3E4E8,
-0xFFE1E3E2,
-0xFFEDEFEC,
-0xFFE6EAEB,
-0xFFE4E9ED,
-0xFFDEE5ED,
-0xFFD8DFE9,
-0xFFE1E8F0,
-0xFFDEE5EB,
-0xFFDFE6EE,
-0xFFDEE3E9,
-0xFFDADFE2,
-0xFFC0C5C9,
-0xFFE2E4F1,
-0xFFDDE0EF,
-0xFFDADEEA,
-0xFFDBE2EC,
-0xFFD9E2EB,
-0xFFD3DCE3,
-0xFFDCE3EB,
-0xFFE0E4ED,
-0xFFD5D7E4,
-0xFFD9DBEA,
-0xFFDADCEB,
-0xFFD9DBEA,
-0xFFDBDFEA,
-0xFFCDD4DC,
-0xFFCED7DE,
-0xFFC4D1D9,
-0xFFC8D6E1,
-0xFFC6D6E3,
-0xFFBFCFDC,
-0xFFC4D5DF,
-0xFFCADBE3,
-0xFFD1E0E7,
-0xFFD3DDE7,
-0xFFD1DBE5,
-0xFFD1DBE5,
-0xFFD0DAE4,
-0xFFD0DCE8,
-0xFFCEDAE6,
-0xFFCFD9E5,
-0xFFCAD3E2,
-0xFFC5CEDD,
-0xFFC2CBDA,
-0xFFC5CEDF,
-0xFFC8D4E4,
-0xFFC2CFDF,
-0xFFC3D3E0,
-0xFFC1D1DE,
-0xFFC2D4DE,
-0xFFC6D7DF,
-0xFFCBD9E2,
-0xFFCBD9E2,
-0xFFCFDCE5,
-0xFFD2DFE7,
-0xFFD0DAE3,
-0xFFD3DDE6,
-0xFFD3DDE6,
-0xFFD8E2EB,
-0xFFD4DFE5,
-0xFFCFDAE0,
-0xFFD1DCE2,
-0xFFDBE6EA,
-0xFFD5E0E4,
-0xFFD3DEE2,
-0xFFD8E3E7,
-0xFFD1E0E5,
-0xFFD5E4EB,
-0xFFD2DFE7,
-0xFFD6E3E9,
-0xFFD8E2EB,
-0xFFE1EAF3,
-0xFFD1D8E2,
-0xFFBEC4D0,
-0xFFCED4E0,
-0xFFD8DEEA,
-0xFFD3DBE6,
-0xFFD0DAE4,
-0xFFCFD9E3,
-0xFFCEDAE6,
-0xFFCFDBE7,
-0xFFD5E3F0,
-0xFFD0DEEB,
-0xFFCEDAE6,
-0xFFDEEAF6,
-0xFFD4DEE8,
-0xFFD2DBE4,
-0xFFD2DBE4,
-0xFFD4DDE6,
-0xFFD2DBE4,
-0xFFD4DCE7,
-0xFFD1D9E4,
-0xFFD1DBE7,
-0xFFD2DCE8,
-0xFFD1D9E6,
-0xFFCED6E3,
-0xFFD5D9E5,
-0xFFCBD0D6,
-0xFFDFE3E2,
-0xFFEEF3EF,
-0xFFEBEFEE,
-0xFFA9B1B3,
-0xFFC9D8DD,
-0xFFC6D5DA,
-0xFFC7D3D3,
-0xFFCED4CA,
-0xFFCDC8B4,
-0xFF837546,
-0xFFE0C870,
-0xFFDAB950,
-0xFFEEC863,
-0xFFC59237,
-0xFF934E03,
-0xFF955307,
-0xFFDBB354,
-0xFFCAB155,
-0xFFC8B674,
-0xFFC5BD98,
-0xFF959794,
-0xFFAFB6C6,
-0xFFB9C0D2,
-0xFF8E94A2,
-0xFFA5A9B4,
-0xFFBDC2C8,
-0xFFCDD5D8,
-0xFFC7CED4,
-0xFFB0B4BF,
-0xFFC1C5D0,
-0xFFBEC5CD,
-0xFFC8D1DA,
-0xFFC9D1DE,
-0xFFC7CEDE,
-0xFFC5CADD,
-0xFFC3CADA,
-0xFFBECAD8,
-0xFFBDCBD6,
-0xFFC4D2DB,
-0xFFC9D6DF,
-0xFFD0D8E5,
-0xFFCFD5E3,
-0xFFCFD7E4,
-0xFFD1DBE5,
-0xFFC7D4DC,
-0xFFC8D5DD,
-0xFFC9D3DD,
-0xFFD7E1EA,
-0xFFD6DFE8,
-0xFFD7E0E7,
-0xFFD7E0E7,
-0xFFD6DFE6,
-0xFFD6DDE5,
-0xFFD7DEE6,
-0xFFD9E2E9,
-0xFFDBE4EB,
-0xFFD8E1E8,
-0xFFD3DCE5,
-0xFFCDD5E0,
-0xFFC9D3DD,
-0xFFCCD6E2,
-0xFFCFDBE7,
-0xFFCFDBE7,
-0xFFCBD9E6,
-0xFFC5D3E0,
-0xFFC3D1DE,
-0xFFC3D1DE,
-0xFFC4D2DD,
-0xFFC2D3DD,
-0xFFC6D7DF,
-0xFFC7D8DF,
-0xFFC5D6DD,
-0xFFC2D3DA,
-0xFFCDDBE4,
-0xFFD0DDE6,
-0xFFD0DAE6,
-0xFFD3DAEA,
-0xFFD3D9E9,
-0xFFCCD1E4,
-0xFFC6CCDC,
-0xFFCED5DF,
-0xFFC4CBD1,
-0xFFDADDE4,
-0xFFDFDFE7,
-0xFFE1E1E9,
-0xFFD7DAE3,
-0xFFD1D8E0,
-0xFFD3DDE6,
-0xFFD1DEE6,
-0xFFCCD9E1,
-0xFFCED8E2,
-0xFFCFD9E5,
-0xFFC8D4E0,
-0xFFC3CFDB,
-0xFFC0CED9,
-0xFFC1CFDC,
-0xFFC4D0DE,
-0xFFBFCBDB,
-0xFFBCC9DA,
-0xFFBFCCDC,
-0xFFCAD6E4,
-0xFFD0D7DF,
-0xFFA7A7A9,
-0xFFC6C6C8,
-0xFFDDE4EE,
-0xFFD8E1F0,
-0xFFD3DCED,
-0xFFD0D9EA,
-0xFFC4D0E0,
-0xFFC9D5E3,
-0xFFC8D2DE,
-0xFFC3CBD6,
-0xFF2B2519,
-0xFF292317,
-0xFF443E32,
-0xFF373327,
-0xFF2B271B,
-0xFF2E2A1E,
-0xFF333021,
-0xFF252314,
-0xFF252412,
-0xFF2C2B19,
-0xFF2B291A,
-0xFF202111,
-0xFF2E2F21,
-0xFF232317,
-0xFF2A2A20,
-0xFF1E1B12,
-0xFF160F07,
-0xFF1C130C,
-0xFF443B32,
-0xFF281F16,
-0xFF292317,
-0xFF211B0F,
-0xFF2E281A,
-0xFF282214,
-0xFF241E10,
-0xFF262014,
-0xFF2C261A,
-0xFF3F392D,
-0xFF292218,
-0xFF272016,
-0xFF2D261E,
-0xFF342D23,
-0xFF332D21,
-0xFF383526,
-0xFF353223,
-0xFF272516,
-0xFF232210,
-0xFF313222,
-0xFF3A3B2D,
-0xFF343428,
-0xFF2A2720,
-0xFF2F2A26,
-0xFF2B2320,
-0xFF302722,
-0xFF3D332A,
-0xFF42362A,
-0xFF554838,
-0xFF645848,
-0xFF362E23,
-0xFF4D493D,
-0xFF3E412E,
-0xFF2F3420,
-0xFF2E2F1D,
-0xFF363427,
-0xFF312D24,
-0xFF322E25,
-0xFF312F23,
-0xFF2B2819,
-0xFF37301D,
-0xFF50452F,
-0xFF6A5B44,
-0xFF564732,
-0xFF5C5040,
-0xFF534C3A,
-0xFF514F38,
-0xFF5B573C,
-0xFF4F482C,
-0xFF473B21,
-0xFF665740,
-0xFF594A37,
-0xFF584C3E,
-0xFF655D52,
-0xFF4C483D,
-0xFF524F46,
-0xFF66665C,
-0xFF4A4A42,
-0xFF565553,
-0xFFB5B2B9,
-0xFFE3E1EF,
-0xFFDAD9E9,
-0xFFD6D9E8,
-0xFFCDD4DE,
-0xFFD6DDE5,
-0xFFCED4E2,
-0xFFD0D5F2,
-0xFF242947,
-0xFF24293F,
-0xFF262B3F,
-0xFF202239,
-0xFF212237,
-0xFF1D1F2E,
-0xFF1C202C,
-0xFF2B2E3F,
-0xFF2F3146,
-0xFF21263C,
-0xFF1D2236,
-0xFF1C2232,
-0xFF232635,
-0xFF232532,
-0xFF161824,
-0xFF14141E,
-0xFF131419,
-0xFF090A0E,
-0xFF0D0E10,
-0xFF0A0B0F,
-0xFF07080D,
-0xFF0B0C11,
-0xFF302F34,
-0xFFC5C3C6,
-0xFFD6D5D1,
-0xFF908D84,
-0xFF6F6C63,
-0xFF807D76,
-0xFF797873,
-0xFF959492,
-0xFFCCCCCA,
-0xFFB8B9B4,
-0xFFB2B3AE,
-0xFFB8B8B6,
-0xFFC7C7C5,
-0xFFA7A6A2,
-0xFF82817D,
-0xFFA2A0A3,
-0xFFCFCDD2,
-0xFFDFDFE1,
-0xFFDDDFDE,
-0xFFDDDEE0,
-0xFFE0E4E5,
-0xFFD7DBDE,
-0xFFDEE1E6,
-0xFFDBDBE3,
-0xFFE0DEE9,
-0xFFE3E1EC,
-0xFFD9D8E0,
-0xFFDFDEE3,
-0xFFDCDCDE,
-0xFFDBDCDE,
-0xFFDCE0E1,
-0xFFD7DADF,
-0xFFD8DDE1,
-0xFFDEE3E7,
-0xFFDEE3E6,
-0xFFD8DEDC,
-0xFFDAE0DE,
-0xFFC2C6C9,
-0xFFC1C5C8,
-0xFFBDC1C4,
-0xFFA8ADB0,
-0xFFB0B5B8,
-0xFF787D81,
-0xFF8C8F96,
-0xFFB9BCC5,
-0xFFCCCEDA,
-0xFFC0C3CC,
-0xFFE5E8F1,
-0xFFDEE2EB,
-0xFFDEE5ED,
-0xFFD6E1E7,
-0xFFD3E0E8,
-0xFFCAD7DF,
-0xFFC4D1D9,
-0xFFC2CFD7,
-0xFFC3CDD6,
-0xFFC2CDD3,
-0xFFC6CFD6,
-0xFFC5CED5,
-0xFFC6CDD5,
-0xFFC9D0D6,
-0xFFCAD1D7,
-0xFFDAE2E5,
-0xFFE7EFF2,
-0xFFE2EAEC,
-0xFFDFE7E9,
-0xFFDCE5E4,
-0xFFD5DEDD,
-0xFFD7DFE1,
-0xFFD1D9DC,
-0xFFD2DCDE,
-0xFFB9C1C4,
-0xFFC3CBCD,
-0xFFD3D8DB,
-0xFFDADDE2,
-0xFFA6A6AE,
-0xFF8F8F97,
-0xFFBFBFC9,
-0xFFDADDE6,
-0xFFCCD0D9,
-0xFFD1D8E0,
-0xFFC9D0D8,
-0xFFC8D1DA,
-0xFFD1D9E4,
-0xFFCED6E1,
-0xFFD6DDE5,
-0xFFC4C9CD,
-0xFF7B8083,
-0xFFAEB2B5,
-0xFFC4C5C7,
-0xFFB2B3B5,
-0xFF8D8E90,
-0xFF7A7E7F,
-0xFFBDC1C4,
-0xFFD8DCDF,
-0xFFD6DBE1,
-0xFFD9DDE6,
-0xFFD6D9E2,
-0xFFD9DCE3,
-0xFFD6D7DC,
-0xFFCECFD1,
-0xFFE2E7E1,
-0xFFEFF4EE,
-0xFFF1F3F2,
-0xFFB4B9BC,
-0xFFCFDADC,
-0xFFCFDFDF,
-0xFFCCD8D8,
-0xFFD0D6D2,
-0xFFE0DED1,
-0xFFA79A6E,
-0xFF947A1B,
-0xFFCCA52E,
-0xFFCD9E28,
-0xFFDEA439,
-0xFF9B5000,
-0xFF955100,
-0xFFA57B0B,
-0xFFCEB541,
-0xFFBDA649,
-0xFFB6A668,
-0xFFA4A289,
-0xFF9EA09D,
-0xFF999A9F,
-0xFF6F6E74,
-0xFFCCCACD,
-0xFFE6E6E6,
-0xFFEFF5F1,
-0xFFE5EBE9,
-0xFFECECEE,
-0xFFEEEEF0,
-0xFFE6EBE7,
-0xFFE8EEEC,
-0xFFD3D7DA,
-0xFFD1D1D9,
-0xFFE0DFE7,
-0xFFD8DBE4,
-0xFFCFD8DF,
-0xFFD2DDE3,
-0xFFD8E3E7,
-0xFFD7E2E6,
-0xFFD4DBE5,
-0xFFCBD3DE,
-0xFFC6D0DC,
-0xFFC7D1DB,
-0xFFD0D9E0,
-0xFFCCD5DC,
-0xFFCBD3DE,
-0xFFCCD4E1,
-0xFFD0D8E3,
-0xFFD1DAE3,
-0xFFD4DDE6,
-0xFFD6DFE8,
-0xFFD5DBE7,
-0xFFCED7E0,
-0xFFC8D1DA,
-0xFFC4CDD4,
-0xFFC4CDD4,
-0xFFC7D1DA,
-0xFFCAD4DE,
-0xFFC7D3DF,
-0xFFC5D1DD,
-0xFFC2D0DB,
-0xFFBFCDD8,
-0xFFBDCBD8,
-0xFFBFCBDB,
-0xFFBCC8D8,
-0xFFBBC7D5,
-0xFFBBC7D5,
-0xFFB9C7D2,
-0xFFBBC9D2,
-0xFFBECDD4,
-0xFFBDCCD3,
-0xFFC0CDD5,
-0xFFC4D1DA,
-0xFFC5CFDB,
-0xFFC6D0DC,
-0xFFCAD1E1,
-0xFFC6CDDF,
-0xFFC3C8DC,
-0xFFC8CEDE,
-0xFFD6DDE5,
-0xFFCED3D7,
-0xFFE4E7EC,
-0xFFE8E9EE,
-0xFFE5E5ED,
-0xFFD9DCE3,
-0xFFD2D9E1,
-0xFFD1DCE2,
-0xFFCDD8DE,
-0xFFC9D6DE,
-0xFFCCD6DF,
-0xFFCCD6E0,
-0xFFC8D2DC,
-0xFFC7D1DB,
-0xFFC8D5DE,
-0xFFCBD8E1,
-0xFFCBD5DF,
-0xFFCED8E2,
-0xFFCDD9E7,
-0xFFCCD8E4,
-0xFFCAD4DE,
-0xFFCDD2D8,
-0xFFAAA8A9,
-0xFFBCBABB,
-0xFFC8CCD5,
-0xFFC2CAD7,
-0xFFC2CAD7,
-0xFFC0C8D5,
-0xFFB5BECD,
-0xFFB6C0CC,
-0xFFB7BFCA,
-0xFFB3BBC6,
-0xFF1E1A0F,
-0xFF332F24,
-0xFF282419,
-0xFF38362A,
-0xFF2D2B1E,
-0xFF2C2A1D,
-0xFF2D2B1C,
-0xFF222313,
-0xFF2B2C1A,
-0xFF20210F,
-0xFF272818,
-0xFF212315,
-0xFF232518,
-0xFF1B1D12,
-0xFF11120A,
-0xFF0F0E09,
-0xFF100D08,
-0xFF342F2B,
-0xFF35302A,
-0xFF28231D,
-0xFF27231A,
-0xFF28241B,
-0xFF2A261B,
-0xFF1F1B10,
-0xFF221E13,
-0xFF2A2418,
-0xFF2D271B,
-0xFF393126,
-0xFF392F25,
-0xFF32281E,
-0xFF3F3229,
-0xFF483B32,
-0xFF4A4235,
-0xFF343122,
-0xFF272415,
-0xFF21200E,
-0xFF2A2819,
-0xFF282617,
-0xFF323023,
-0xFF363227,
-0xFF352E26,
-0xFF2F261F,
-0xFF322721,
-0xFF55473E,
-0xFF534336,
-0xFF513E2F,
-0xFF6B5643,
-0xFF61503E,
-0xFF392D1F,
-0xFF423C2C,
-0xFF363820,
-0xFF2C2F14,
-0xFF2E3018,
-0xFF2D2C18,
-0xFF292519,
-0xFF282216,
-0xFF352F21,
-0xFF433C29,
-0xFF564C31,
-0xFF645639,
-0xFF665738,
-0xFF5A492D,
-0xFF65563F,
-0xFF493E2A,
-0xFF575139,
-0xFF635D43,
-0xFF50442A,
-0xFF403017,
-0xFF6A5540,
-0xFF695645,
-0xFF4A3A2B,
-0xFF44382C,
-0xFF463E33,
-0xFF403A2E,
-0xFF504A3C,
-0xFF443D33,
-0xFF3D3834,
-0xFF747071,
-0xFFB1AEB9,
-0xFFAEACB9,
-0xFFD6D6E2,
-0xFFDBDEE5,
-0xFFB8BDC0,
-0xFFD5D9E2,
-0xFFCED2ED,
-0xFF282B4C,
-0xFF262A43,
-0xFF262B41,
-0xFF262743,
-0xFF1B1D36,
-0xFF1B1E2F,
-0xFF0F1221,
-0xFF27293E,
-0xFF262A43,
-0xFF272B46,
-0xFF20243D,
-0xFF303247,
-0xFF282B3C,
-0xFF101221,
-0xFF181A26,
-0xFF15181F,
-0xFF090C11,
-0xFF0D0E12,
-0xFF0B0C10,
-0xFF0E0F14,
-0xFF0A0B10,
-0xFF0D0C12,
-0xFF272528,
-0xFF4F4B48,
-0xFF625B53,
-0xFF564E41,
-0xFF4C4332,
-0xFF49412E,
-0xFF645D4A,
-0xFF534C39,
-0xFF6B654F,
-0xFF59543E,
-0xFF635E48,
-0xFF57503E,
-0xFF777060,
-0xFF615847,
-0xFF584F3E,
-0xFF534A3B,
-0xFF57503E,
-0xFF494431,
-0xFF706D5A,
-0xFF716E5D,
-0xFF979888,
-0xFF65695B,
-0xFF9DA095,
-0xFFD8D8D0,
-0xFF96938E,
-0xFF898480,
-0xFFA7A09A,
-0xFF9F9890,
-0xFFA39A91,
-0xFF766F65,
-0xFF928B83,
-0xFF8D8582,
-0xFFC6BEBB,
-0xFFADA5A2,
-0xFFCAC3BB,
-0xFFA9A397,
-0xFFA29C90,
-0xFF767269,
-0xFF928F86,
-0xFFADAB9E,
-0xFF767465,
-0xFF4B493A,
-0xFF4D4B3E,
-0xFF555146,
-0xFF49453A,
-0xFF4A463D,
-0xFF5E5B52,
-0xFF98958C,
-0xFF88887E,
-0xFFB8B9B1,
-0xFF848983,
-0xFF8C9290,
-0xFFEAF2F5,
-0xFFE4EDF4,
-0xFFDDE6EF,
-0xFFE2E9F1,
-0xFFDDE4EC,
-0xFFE8ECF5,
-0xFFE4E9EF,
-0xFFDDE0E7,
-0xFFDEE1E6,
-0xFFE3E4E8,
-0xFFE2E3E5,
-0xFFE7E8EA,
-0xFFE8EAE9,
-0xFFE1E3E2,
-0xFFEBEDEC,
-0xFFD5D7D4,
-0xFFCACCC9,
-0xFFD8D6D7,
-0xFFA9A5A6,
-0xFF46423F,
-0xFF6A6760,
-0xFF908C83,
-0xFF8E8A81,
-0xFF8E8781,
-0xFF615A54,
-0xFF98908D,
-0xFF908B87,
-0xFF7E7B76,
-0xFF9C9B97,
-0xFFABABAB,
-0xFFBEBFC1,
-0xFFCDCDD5,
-0xFFCAC9CE,
-0xFF8C8781,
-0xFF585246,
-0xFF474133,
-0xFF423B2B,
-0xFF4E4639,
-0xFF564E41,
-0xFF5D5548,
-0xFF5D5548,
-0xFF5C5646,
-0xFF777163,
-0xFFA29E93,
-0xFF908B85,
-0xFF87827E,
-0xFF9B948E,
-0xFF635C52,
-0xFF585449,
-0xFFD5D6D0,
-0xFFE9EDEC,
-0xFFEBEBF3,
-0xFFB4B4BE,
-0xFF9B9CA0,
-0xFFA2A4A3,
-0xFF93968F,
-0xFF828276,
-0xFFA8A390,
-0xFFA19678,
-0xFFA3915F,
-0xFFB69955,
-0xFFC09843,
-0xFFDFA051,
-0xFFA2410E,
-0xFFA84A14,
-0xFF8A5B03,
-0xFFD3B753,
-0xFFEACD6F,
-0xFFCAB161,
-0xFFBEB17A,
-0xFF59512D,
-0xFF645947,
-0xFF6B5E56,
-0xFF766963,
-0xFF8C837C,
-0xFF97978B,
-0xFFA9AC9B,
-0xFF8A8776,
-0xFFA9A693,
-0xFF787A65,
-0xFFB0AF9B,
-0xFF857E6C,
-0xFFCCC3B4,
-0xFFA3998F,
-0xFFB9B2AA,
-0xFFD7D6D2,
-0xFFCDCFCC,
-0xFFC1C2BD,
-0xFFC7C9C6,
-0xFFD0D1D6,
-0xFFD6DAE3,
-0xFFD1D9E4,
-0xFFDBE4ED,
-0xFFE8EDF1,
-0xFFE5ECF2,
-0xFFD8E2EE,
-0xFFC9D2E1,
-0xFFD0D6E2,
-0xFFCED4E0,
-0xFFCFD5E1,
-0xFFD2D8E4,
-0xFFD4DCE9,
-0xFFD2DAE5,
-0xFFCFD8E1,
-0xFFCBD5DE,
-0xFFC4CED7,
-0xFFC6D3DB,
-0xFFC6D4DF,
-0xFFBFCFDC,
-0xFFB9C9D6,
-0xFFB6C8D4,
-0xFFB6C8D4,
-0xFFB6C8D6,
-0xFFB2C1D4,
-0xFFAEBDD2,
-0xFFAEBDD2,
-0xFFB1C0D5,
-0xFFB1C0D5,
-0xFFB1C0D3,
-0xFFB2C1D4,
-0xFFB2C1D4,
-0xFFAEBBCC,
-0xFFB0BDCE,
-0xFFB5C1D1,
-0xFFBAC6D6,
-0xFFBFC8D7,
-0xFFC0CAD6,
-0xFFC9D1DE,
-0xFFD5DCE6,
-0xFFDFE4E7,
-0xFFD2D6D5,
-0xFFE3E7E8,
-0xFFE2E6E9,
-0xFFDDE0E5,
-0xFFD3D8DE,
-0xFFCDD4DC,
-0xFFC8D3D9,
-0xFFC7D1DA,
-0xFFC4D1DA,
-0xFFC7D1DD,
-0xFFC5CFDB,
-0xFFC2C9D9,
-0xFFC3CADA,
-0xFFC7CEE0,
-0xFFC8D1E0,
-0xFFC2CEDA,
-0xFFBFCDD6,
-0xFFB5C7D3,
-0xFFB9CBD5,
-0xFFB2C3CB,
-0xFFB4BFC5,
-0xFFAAAEAF,
-0xFF9CA0A1,
-0xFFA8B2BB,
-0xFFA8B6C3,
-0xFFABB9C6,
-0xFFA9B7C4,
-0xFFA5B5C4,
-0xFFA1B1C0,
-0xFFB1C1CE,
-0xFFC9D9E6,
-0xFF181409,
-0xFF332F24,
-0xFF282419,
-0xFF2B291D,
-0xFF272518,
-0xFF29271A,
-0xFF292718,
-0xFF222313,
-0xFF222311,
-0xFF2C2D1B,
-0xFF242515,
-0xFF2B2D1F,
-0xFF17170B,
-0xFF0E1005,
-0xFF1B1C16,
-0xFF151610,
-0xFF0F0E0A,
-0xFF2A2925,
-0xFF171611,
-0xFF15140F,
-0xFF2D2C27,
-0xFF212119,
-0xFF191911,
-0xFF1A170E,
-0xFF1C1A0E,
-0xFF181409,
-0xFF322C20,
-0xFF2F271A,
-0xFF2E2418,
-0xFF322618,
-0xFF514134,
-0xFF3E3023,
-0xFF3C3226,
-0xFF342E20,
-0xFF272113,
-0xFF312D21,
-0xFF2B271B,
-0xFF1A180C,
-0xFF231F14,
-0xFF474338,
-0xFF383129,
-0xFF2D241B,
-0xFF392F25,
-0xFF4B3D30,
-0xFF4C3B2B,
-0xFF614E3D,
-0xFF634E39,
-0xFF4E3D29,
-0xFF413525,
-0xFF3C3724,
-0xFF383820,
-0xFF2E2E12,
-0xFF44442A,
-0xFF373621,
-0xFF1D1A0B,
-0xFF1F190D,
-0xFF2E2619,
-0xFF4D4532,
-0xFF5B5034,
-0xFF524525,
-0xFF584827,
-0xFF544325,
-0xFF5A4A31,
-0xFF5D4E39,
-0xFF453D28,
-0xFF554D38,
-0xFF4C3D28,
-0xFF422D18,
-0xFF58412F,
-0xFF624B3B,
-0xFF604E40,
-0xFF403225,
-0xFF403728,
-0xFF383121,
-0xFF3B3422,
-0xFF322B1B,
-0xFF322920,
-0xFF302B27,
-0xFF3E393D,
-0xFF3D3A41,
-0xFF807F84,
-0xFF999999,
-0xFF4D5049,
-0xFF7D8182,
-0xFF8789A0,
-0xFF272A49,
-0xFF292D46,
-0xFF22273D,
-0xFF252644,
-0xFF1D1F38,
-0xFF181B2C,
-0xFF0D101F,
-0xFF20253B,
-0xFF353956,
-0xFF3A3D5C,
-0xFF323653,
-0xFF1E2037,
-0xFF0F1223,
-0xFF242635,
-0xFF161824,
-0xFF13161D,
-0xFF0C0F14,
-0xFF0F1015,
-0xFF0D0E13,
-0xFF08090E,
-0xFF0C0B11,
-0xFF0A080D,
-0xFF2C2829,
-0xFF6E6761,
-0xFF5C5449,
-0xFF544937,
-0xFF564A34,
-0xFF4B3F29,
-0xFF4E422A,
-0xFF3E3218,
-0xFF544B2E,
-0xFF564D2E,
-0xFF5E5538,
-0xFF574B33,
-0xFF635741,
-0xFF62533E,
-0xFF584932,
-0xFF63553B,
-0xFF6A5E44,
-0xFF675E41,
-0xFF4E472B,
-0xFF3A341A,
-0xFF433F26,
-0xFF494931,
-0xFF4B4A35,
-0xFF5F5C49,
-0xFF363020,
-0xFF4E4536,
-0xFF554939,
-0xFF4B3E2D,
-0xFF473A29,
-0xFF635646,
-0xFF65574A,
-0xFF55493D,
-0xFF52453C,
-0xFF564A3E,
-0xFF5A4E40,
-0xFF685B4A,
-0xFF635844,
-0xFF605845,
-0xFF5A523F,
-0xFF7D7663,
-0xFF5C5640,
-0xFF4E4830,
-0xFF544E36,
-0xFF443C25,
-0xFF58503B,
-0xFF463E29,
-0xFF5C543F,
-0xFF5A5340,
-0xFF46412E,
-0xFF3A3728,
-0xFF4D4D41,
-0xFF464741,
-0xFFBABCB9,
-0xFFDCE0E1,
-0xFFD2D6D9,
-0xFFDBDCE0,
-0xFFCCCDCF,
-0xFFD0D0D2,
-0xFFB8B8B8,
-0xFF9E9C9D,
-0xFF92918F,
-0xFF7E7A77,
-0xFF64615C,
-0xFF6B6861,
-0xFF8F8C85,
-0xFF8D8A81,
-0xFF928F86,
-0xFF666458,
-0xFF524E43,
-0xFF615851,
-0xFF645A51,
-0xFF62584C,
-0xFF5F5645,
-0xFF655949,
-0xFF5D5240,
-0xFF5C4E41,
-0xFF56483B,
-0xFF4E4236,
-0xFF5B5145,
-0xFF696051,
-0xFF5D5749,
-0xFF40392F,
-0xFF58544B,
-0xFF74706D,
-0xFF847F79,
-0xFF554C3B,
-0xFF4F442E,
-0xFF493F26,
-0xFF3F331B,
-0xFF5D5139,
-0xFF62533C,
-0xFF52462E,
-0xFF5F5339,
-0xFF5D5437,
-0xFF554B30,
-0xFF554A36,
-0xFF625646,
-0xFF625648,
-0xFF5B4F3F,
-0xFF594D37,
-0xFF4D4633,
-0xFFD0D3CA,
-0xFFF3F9F9,
-0xFFEEEEFA,
-0xFFB5B2BD,
-0xFF615859,
-0xFF736A63,
-0xFF706959,
-0xFF5E5842,
-0xFF867F65,
-0xFF776D52,
-0xFF6E6347,
-0xFF735D38,
-0xFF895E27,
-0xFF7A3100,
-0xFF921F02,
-0xFFA83D1D,
-0xFFA8783A,
-0xFF968132,
-0xFF987B2B,
-0xFF917521,
-0xFFCEBA61,
-0xFF7F6E26,
-0xFF6F5F3D,
-0xFF756355,
-0xFF65574C,
-0xFF665C50,
-0xFF666350,
-0xFF5D5C47,
-0xFF67634A,
-0xFF605C41,
-0xFF625E41,
-0xFF666143,
-0xFF7E7357,
-0xFF7B6D52,
-0xFF70614A,
-0xFF6B604C,
-0xFF958C7D,
-0xFF7E7669,
-0xFF706454,
-0xFF998D81,
-0xFFBAB3AB,
-0xFFD7D3D0,
-0xFFD2D2D2,
-0xFFE1E3E2,
-0xFFE0DCD9,
-0xFFEBEBE9,
-0xFFDEE5EB,
-0xFFD3DDE7,
-0xFFD7DDE9,
-0xFFD2D8E4,
-0xFFCED4E0,
-0xFFD0D8E5,
-0xFFD4DCE9,
-0xFFD4DEE8,
-0xFFD2DCE6,
-0xFFCFDCE5,
-0xFFD1DEE7,
-0xFFCCDAE3,
-0xFFC5D3DE,
-0xFFBFCFDC,
-0xFFC0D0DF,
-0xFFC2D2E1,
-0xFFC0D0DD,
-0xFFBCCCDB,
-0xFFBCCBDE,
-0xFFB9C8DD,
-0xFFBAC9DE,
-0xFFBBCADF,
-0xFFB8C7DC,
-0xFFB7C6DB,
-0xFFBDC9DF,
-0xFFC1CDE3,
-0xFFC2CDE1,
-0xFFC1CCDE,
-0xFFC7D3E3,
-0xFFCED7E6,
-0xFFCCD6E2,
-0xFFD0D8E3,
-0xFFD5DEE7,
-0xFFD6DDE5,
-0xFFDCE1E5,
-0xFFCACFD2,
-0xFFD9DEE1,
-0xFFD8DDE1,
-0xFFD4D9DF,
-0xFFCED5DD,
-0xFFCCD5DE,
-0xFFC4CED8,
-0xFFC2CFD8,
-0xFFC3CFDB,
-0xFFC4D0DE,
-0xFFC3CCDB,
-0xFFC0C7D9,
-0xFFC2C7DA,
-0xFFC6CBDE,
-0xFFC5CCDC,
-0xFFC0CAD4,
-0xFFB6C4CD,
-0xFFB7C9D3,
-0xFFB9CBD5,
-0xFFBFD0D8,
-0xFFBFCCD2,
-0xFFB6BABB,
-0xFFA6AAAB,
-0xFFC8D2DB,
-0xFFC2D0DB,
-0xFFC8D6E3,
-0xFFCAD8E5,
-0xFFC7D7E6,
-0xFFBCCEDC,
-0xFFBCCEDC,
-0xFFB9CBD9,
-0xFF282117,
-0xFF393228,
-0xFF2C251B,
-0xFF231F14,
-0xFF2B271B,
-0xFF2B271B,
-0xFF2E2B1C,
-0xFF2A2819,
-0xFF282715,
-0xFF292816,
-0xFF282617,
-0xFF1B1C0E,
-0xFF1F1D11,
-0xFF121208,
-0xFF0F0E09,
-0xFF14150F,
-0xFF1B1C17,
-0xFF161712,
-0xFF1F201B,
-0xFF14150F,
-0xFF191C15,
-0xFF21241B,
-0xFF13140C,
-0xFF15170C,
-0xFF17170B,
-0xFF242216,
-0xFF322C20,
-0xFF2B2316,
-0xFF32291A,
-0xFF3D3121,
-0xFF4F3F30,
-0xFF403323,
-0xFF594F43,
-0xFF372F24,
-0xFF31281F,
-0xFF251E16,
-0xFF28231F,
-0xFF221D19,
-0xFF15120D,
-0xFF28231D,
-0xFF2E2A21,
-0xFF363024,
-0xFF40382B,
-0xFF524938,
-0xFF443925,
-0xFF4C402A,
-0xFF4E3F28,
-0xFF443724,
-0xFF3D3528,
-0xFF383526,
-0xFF2F2C19,
-0xFF38361F,
-0xFF35341F,
-0xFF2E2D1B,
-0xFF28261A,
-0xFF29251C,
-0xFF382E25,
-0xFF483C2E,
-0xFF4E422A,
-0xFF4C3E23,
-0xFF423417,
-0xFF45371C,
-0xFF5B4A36,
-0xFF49392A,
-0xFF3A3122,
-0xFF3D3425,
-0xFF372718,
-0xFF463022,
-0xFF5E4739,
-0xFF574032,
-0xFF544035,
-0xFF403023,
-0xFF362A1A,
-0xFF3A321F,
-0xFF453D28,
-0xFF47402D,
-0xFF3F3828,
-0xFF373125,
-0xFF35322D,
-0xFF33322E,
-0xFF67645D,
-0xFF5A584C,
-0xFF5E5F4D,
-0xFF72736B,
-0xFFA2A4B1,
-0xFF2A2C43,
-0xFF2E3347,
-0xFF23283C,
-0xFF232742,
-0xFF1E2339,
-0xFF1B1E2D,
-0xFF0E1120,
-0xFF20253B,
-0xFF3A3E5B,
-0xFF282B4C,
-0xFF202342,
-0xFF272940,
-0xFF26293C,
-0xFF1C1E2D,
-0xFF141622,
-0xFF11141D,
-0xFF0D1017,
-0xFF0C0F16,
-0xFF090C13,
-0xFF191921,
-0xFF0A0911,
-0xFF0B090E,
-0xFF352F2F,
-0xFF554C45,
-0xFF574E3F,
-0xFF5D503D,
-0xFF594A35,
-0xFF584838,
-0xFF4D3D2D,
-0xFF71624D,
-0xFF5E523A,
-0xFF40341C,
-0xFF5B4F37,
-0xFF564732,
-0xFF5E4F3C,
-0xFF5B4A38,
-0xFF5C4B37,
-0xFF6D5D44,
-0xFF6E5E44,
-0xFF6C5E44,
-0xFF5D5137,
-0xFF50462D,
-0xFF362F15,
-0xFF3A3517,
-0xFF605A3A,
-0xFF5F553A,
-0xFF645840,
-0xFF61523B,
-0xFF64543D,
-0xFF5D4D34,
-0xFF56462F,
-0xFF60513C,
-0xFF635441,
-0xFF514434,
-0xFF483A2D,
-0xFF524535,
-0xFF6A5D4C,
-0xFF665A42,
-0xFF53472D,
-0xFF594F36,
-0xFF5A5037,
-0xFF524733,
-0xFF463B27,
-0xFF5E533F,
-0xFF665B45,
-0xFF695D43,
-0xFF584C32,
-0xFF594D33,
-0xFF62563E,
-0xFF4C412F,
-0xFF4F4838,
-0xFF322C20,
-0xFF3C382D,
-0xFF454239,
-0xFF494941,
-0xFF625F56,
-0xFF4E4B42,
-0xFF5B574E,
-0xFF3A362B,
-0xFF4B4539,
-0xFF413B2D,
-0xFF4B4336,
-0xFF504738,
-0xFF594D3D,
-0xFF5E5341,
-0xFF564B37,
-0xFF3B301C,
-0xFF413922,
-0xFF585039,
-0xFF615A40,
-0xFF584D37,
-0xFF5D503D,
-0xFF5C4D3A,
-0xFF564730,
-0xFF64563C,
-0xFF68583F,
-0xFF675740,
-0xFF645341,
-0xFF6C5B4B,
-0xFF584838,
-0xFF594C39,
-0xFF655943,
-0xFF554E34,
-0xFF4F4730,
-0xFF615B45,
-0xFF5A5541,
-0xFF6D6854,
-0xFF5F5941,
-0xFF5D563C,
-0xFF585135,
-0xFF5B5136,
-0xFF50442A,
-0xFF40341A,
-0xFF473C20,
-0xFF6A5F3F,
-0xFF6D6340,
-0xFF695E3E,
-0xFF5E5238,
-0xFF655943,
-0xFF594A37,
-0xFF51422D,
-0xFF695A3D,
-0xFF5E573B,
-0xFFCED6C7,
-0xFFECF7F3,
-0xFFEEEEF8,
-0xFFB7B0B8,
-0xFF63524B,
-0xFF6B5945,
-0xFF6E5F42,
-0xFF8E815E,
-0xFF877A57,
-0xFF5C5430,
-0xFF464227,
-0xFF5B472E,
-0xFF874E30,
-0xFF812609,
-0xFF9C1F0B,
-0xFFA93C27,
-0xFF7D532D,
-0xFF766A3A,
-0xFF6C5521,
-0xFF8F7626,
-0xFFF4DF60,
-0xFFA99620,
-0xFF5E4E1D,
-0xFF615547,
-0xFF5C5543,
-0xFF514F3A,
-0xFF6B6652,
-0xFF5E5C47,
-0xFF4A4C36,
-0xFF4B4B33,
-0xFF585335,
-0xFF564D2C,
-0xFF665D3E,
-0xFF514628,
-0xFF4E4327,
-0xFF61553B,
-0xFF6C5E44,
-0xFF79684E,
-0xFF806749,
-0xFF7A5F42,
-0xFF735D45,
-0xFF84745D,
-0xFF746756,
-0xFFAEA191,
-0xFFA69686,
-0xFFAB9F91,
-0xFFD5D6D1,
-0xFFDFE7E9,
-0xFFD8E1E6,
-0xFFD7E0E9,
-0xFFCED7E0,
-0xFFCDD7E1,
-0xFFCBD5DF,
-0xFFC7D4DD,
-0xFFC6D3DC,
-0xFFC6D4DF,
-0xFFC5D3DE,
-0xFFC4D2DD,
-0xFFC5D3E0,
-0xFFC0CCDA,
-0xFFC3CFDD,
-0xFFC7D3E1,
-0xFFC7D3E1,
-0xFFCCD5E4,
-0xFFD3DCEB,
-0xFFD4DDEE,
-0xFFCCD5E6,
-0xFFC7D0E1,
-0xFFCBD4E5,
-0xFFCDD6E7,
-0xFFCCD5E4,
-0xFFCBD4E3,
-0xFFCAD4E0,
-0xFFC7D1DD,
-0xFFCED8E2,
-0xFFCED6E1,
-0xFFCFD8E1,
-0xFFCFD6E0,
-0xFFCFD6DE,
-0xFFCDD4DE,
-0xFFCBD1DD,
-0xFFB2B8C4,
-0xFFC1C7D3,
-0xFFC5CBD9,
-0xFFC2CAD7,
-0xFFC9D1DE,
-0xFFCFD8E7,
-0xFFC6D2E0,
-0xFFC8D4E2,
-0xFFC1CFDC,
-0xFFCAD8E5,
-0xFFBFCBD9,
-0xFFC6CFDE,
-0xFFCAD1E1,
-0xFFCCD2E2,
-0xFFCED1E0,
-0xFFCCD0DB,
-0xFFD0D7E1,
-0xFFD2DCE6,
-0xFFC9D5E1,
-0xFFCAD7E0,
-0xFFC9D2D9,
-0xFFC2C2C2,
-0xFFA5A5A7,
-0xFFCED5DD,
-0xFFC0CAD4,
-0xFFC5CDDA,
-0xFFC6D0DC,
-0xFFC4D0DE,
-0xFFC5D1DF,
-0xFFBDCBD8,
-0xFFC1CFDC,
-0xFF251E16,
-0xFF322B23,
-0xFF2B241C,
-0xFF272018,
-0xFF201C11,
-0xFF1E1A0F,
-0xFF2F2B1F,
-0xFF231F13,
-0xFF2A2819,
-0xFF312F20,
-0xFF151306,
-0xFF2A281B,
-0xFF1D1A11,
-0xFF14110A,
-0xFF100F0A,
-0xFF11100B,
-0xFF272622,
-0xFF141510,
-0xFF181914,
-0xFF13140F,
-0xFF0E110A,
-0xFF161912,
-0xFF181B12,
-0xFF16170F,
-0xFF1D1D13,
-0xFF242216,
-0xFF312D21,
-0xFF342E22,
-0xFF41372B,
-0xFF4A3E30,
-0xFF433528,
-0xFF4B3D30,
-0xFF42382E,
-0xFF30271E,
-0xFF28211B,
-0xFF2C2421,
-0xFF231D1D,
-0xFF1E1A19,
-0xFF110D0C,
-0xFF23201B,
-0xFF2B271E,
-0xFF2D291D,
-0xFF433D2D,
-0xFF4F4A36,
-0xFF423C26,
-0xFF544C35,
-0xFF524731,
-0xFF443927,
-0xFF292317,
-0xFF3B372B,
-0xFF393323,
-0xFF302B17,
-0xFF2D2C18,
-0xFF272516,
-0xFF252317,
-0xFF27231A,
-0xFF3C3229,
-0xFF46382B,
-0xFF4F402B,
-0xFF47391F,
-0xFF51462A,
-0xFF40341A,
-0xFF483727,
-0xFF362619,
-0xFF463C30,
-0xFF3A3024,
-0xFF655548,
-0xFF4B382A,
-0xFF573F33,
-0xFF675042,
-0xFF463325,
-0xFF413122,
-0xFF3F3422,
-0xFF453D2A,
-0xFF3E3621,
-0xFF48412E,
-0xFF453E2C,
-0xFF3A3426,
-0xFF161408,
-0xFF474539,
-0xFF605C50,
-0xFF565342,
-0xFF57573F,
-0xFF505143,
-0xFF6F6F79,
-0xFF38394E,
-0xFF27293E,
-0xFF24293F,
-0xFF21253E,
-0xFF22273B,
-0xFF191D29,
-0xFF131723,
-0xFF282D43,
-0xFF353956,
-0xFF2F3251,
-0xFF2B2F4C,
-0xFF272942,
-0xFF1A1D30,
-0xFF1D1F2E,
-0xFF171925,
-0xFF0F121B,
-0xFF0A0D16,
-0xFF080B14,
-0xFF171925,
-0xFF11111B,
-0xFF0E0D15,
-0xFF0A080D,
-0xFF2E2926,
-0xFF5C534A,
-0xFF504436,
-0xFF564734,
-0xFF544532,
-0xFF564637,
-0xFF5B4B3C,
-0xFF504332,
-0xFF473A27,
-0xFF3F301D,
-0xFF675843,
-0xFF493824,
-0xFF4C3B27,
-0xFF574531,
-0xFF5B4935,
-0xFF67553D,
-0xFF635339,
-0xFF5C4E34,
-0xFF52462C,
-0xFF5F553C,
-0xFF443D21,
-0xFF504728,
-0xFF5C5334,
-0xFF53482C,
-0xFF695B41,
-0xFF524229,
-0xFF423219,
-0xFF5B4B32,
-0xFF605037,
-0xFF62533C,
-0xFF483924,
-0xFF493C2B,
-0xFF4B3F2F,
-0xFF605543,
-0xFF625741,
-0xFF5B5235,
-0xFF665B3D,
-0xFF766B4D,
-0xFF4C4125,
-0xFF4B3F27,
-0xFF413620,
-0xFF534633,
-0xFF6C604A,
-0xFF574B31,
-0xFF4D4226,
-0xFF5E5337,
-0xFF52462E,
-0xFF564B37,
-0xFF42392A,
-0xFF2C2618,
-0xFF363226,
-0xFF38362A,
-0xFF373529,
-0xFF353223,
-0xFF4D4737,
-0xFF403929,
-0xFF423B2B,
-0xFF433A29,
-0xFF413926,
-0xFF453827,
-0xFF4B3E2B,
-0xFF63543F,
-0xFF5B4C35,
-0xFF615339,
-0xFF524429,
-0xFF564B2F,
-0xFF584D2F,
-0xFF615638,
-0xFF64593D,
-0xFF53442D,
-0xFF564730,
-0xFF63553A,
-0xFF5B4D30,
-0xFF5B4C2F,
-0xFF79694F,
-0xFF6C5B47,
-0xFF645542,
-0xFF5E4F3C,
-0xFF534731,
-0xFF5F5639,
-0xFF635D3D,
-0xFF645D40,
-0xFF555033,
-0xFF69654C,
-0xFF68634D,
-0xFF423C24,
-0xFF504A30,
-0xFF615A3E,
-0xFF635C40,
-0xFF453B22,
-0xFF5C5237,
-0xFF605539,
-0xFF5A5130,
-0xFF726A45,
-0xFF615935,
-0xFF584F32,
-0xFF4E432D,
-0xFF514431,
-0xFF4D3E29,
-0xFF7F7051,
-0xFF5A5538,
-0xFFC8D0C1,
-0xFFEFF9F8,
-0xFFF4F4FE,
-0xFFB6ACB4,
-0xFF5C4B41,
-0xFF5A4830,
-0xFF776745,
-0xFF807349,
-0xFF75693F,
-0xFF635B36,
-0xFF444229,
-0xFF5D4732,
-0xFF863A2A,
-0xFF972918,
-0xFFAA281A,
-0xFFA43D2C,
-0xFF75513B,
-0xFF655F3F,
-0xFF6E592A,
-0xFF795E0D,
-0xFFE6CA43,
-0xFFEFD75B,
-0xFF3D2B00,
-0xFF554C3D,
-0xFF4F4D38,
-0xFF54543C,
-0xFF5F5A44,
-0xFF56513D,
-0xFF4D4F3A,
-0xFF414129,
-0xFF544B2C,
-0xFF6F6240,
-0xFF5D5234,
-0xFF433A1D,
-0xFF3D3415,
-0xFF574C2E,
-0xFF59482A,
-0xFF6C5535,
-0xFF7D5D37,
-0xFF82603A,
-0xFF7B5F3A,
-0xFF5A4321,
-0xFF6F5C3E,
-0xFF79684E,
-0xFF7E6A51,
-0xFF726350,
-0xFF8C8A7E,
-0xFFC5CBC9,
-0xFFCFD8DD,
-0xFFC7D1DA,
-0xFFCAD4DD,
-0xFFC8D5DD,
-0xFFC1CED7,
-0xFFC3D1DC,
-0xFFC4D2DD,
-0xFFBFCDDA,
-0xFFC2D0DD,
-0xFFCAD6E2,
-0xFFC4CED8,
-0xFFCBD4DD,
-0xFFC8CFD9,
-0xFFCED2DB,
-0xFFBDC1CA,
-0xFF8B9096,
-0xFFB1B6BA,
-0xFFB1B6B9,
-0xFFD1D6DA,
-0xFFD6DDE3,
-0xFFC5CCD4,
-0xFFCCD3DB,
-0xFFC6CDD7,
-0xFFCAD3DC,
-0xFFC7D0D9,
-0xFFBEC7D0,
-0xFFC6CFD8,
-0xFFC7D0D7,
-0xFFC5CCD2,
-0xFFCDD4DA,
-0xFFDEE6E9,
-0xFFCED5DB,
-0xFFCFD6DE,
-0xFFCBD2DC,
-0xFFCDD4DE,
-0xFFC7CED8,
-0xFFB2BBC4,
-0xFFC0C9D2,
-0xFFC4CDD6,
-0xFFC6CED9,
-0xFFCCD6E0,
-0xFFC9D3DD,
-0xFFBEC8D2,
-0xFFBEC8D2,
-0xFFC0C8D3,
-0xFFC4CAD6,
-0xFFCACCD9,
-0xFFC5C3CE,
-0xFFD6D4D9,
-0xFFD7D5D8,
-0xFFD2D5DC,
-0xFFCCD1D7,
-0xFFC4CBD1,
-0xFFC5C9CA,
-0xFFBDB8B4,
-0xFF9A9591,
-0xFFD0D1D3,
-0xFFC9CED2,
-0xFFCED1D8,
-0xFFD1D4DB,
-0xFFD3D7E0,
-0xFFC9D0D8,
-0xFFC5CCD6,
-0xFFBCC5CC,
-0xFF231E18,
-0xFF2E2923,
-0xFF1E1913,
-0xFF231E18,
-0xFF28231D,
-0xFF1B1610,
-0xFF2A261D,
-0xFF302C23,
-0xFF312D22,
-0xFF2D291E,
-0xFF19170B,
-0xFF26231A,
-0xFF25221B,
-0xFF120F0A,
-0xFF130F0C,
-0xFF0C0805,
-0xFF2F2A26,
-0xFF221D19,
-0xFF14110C,
-0xFF1E1B16,
-0xFF1A1914,
-0xFF11100B,
-0xFF0D0C07,
-0xFF1C1C14,
-0xFF1E1E16,
-0xFF2D2A21,
-0xFF2B271E,
-0xFF3B342C,
-0xFF443A31,
-0xFF3F3229,
-0xFF31241B,
-0xFF4B4137,
-0xFF362F25,
-0xFF231F14,
-0xFF29241E,
-0xFF24211C,
-0xFF130F0E,
-0xFF24201F,
-0xFF0C0807,
-0xFF2E2B26,
-0xFF2C2920,
-0xFF363324,
-0xFF383320,
-0xFF403B25,
-0xFF4E4830,
-0xFF534B34,
-0xFF30250F,
-0xFF3F3724,
-0xFF2F291D,
-0xFF3A3428,
-0xFF3A3323,
-0xFF302917,
-0xFF292615,
-0xFF343223,
-0xFF2E2C20,
-0xFF3B342A,
-0xFF4D4037,
-0xFF5A4A3D,
-0xFF50412C,
-0xFF51452D,
-0xFF3A3015,
-0xFF3B301A,
-0xFF2F1F10,
-0xFF332518,
-0xFF42392A,
-0xFF504736,
-0xFF574A39,
-0xFF473624,
-0xFF584332,
-0xFF65503F,
-0xFF3B2817,
-0xFF3D2E1B,
-0xFF514634,
-0xFF443C29,
-0xFF413A28,
-0xFF342D1B,
-0xFF393222,
-0xFF3C3628,
-0xFF4A4738,
-0xFF423F30,
-0xFF40382D,
-0xFF585141,
-0xFF55503A,
-0xFF2F2D20,
-0xFF32303B,
-0xFF42425A,
-0xFF292B44,
-0xFF252740,
-0xFF21253E,
-0xFF171C2F,
-0xFF1B222C,
-0xFF0C131D,
-0xFF23283B,
-0xFF3E425B,
-0xFF2B2F4A,
-0xFF262A45,
-0xFF23253C,
-0xFF26293C,
-0xFF181A29,
-0xFF131522,
-0xFF10121E,
-0xFF050713,
-0xFF0E101D,
-0xFF1C1E2B,
-0xFF10101C,
-0xFF090810,
-0xFF100E11,
-0xFF1E1916,
-0xFF574E45,
-0xFF5A4E40,
-0xFF3D301F,
-0xFF473A27,
-0xFF5C5040,
-0xFF473E2D,
-0xFF473B2B,
-0xFF473C2A,
-0xFF2E2110,
-0xFF5C4D3A,
-0xFF8F7F66,
-0xFF6E5E44,
-0xFF4F3D25,
-0xFF5C4A32,
-0xFF69593F,
-0xFF504026,
-0xFF54482E,
-0xFF544A2F,
-0xFF534E30,
-0xFF575234,
-0xFF443D23,
-0xFF4A3F2B,
-0xFF423524,
-0xFF594939,
-0xFF4B3B2B,
-0xFF433421,
-0xFF4E3F2A,
-0xFF524630,
-0xFF5B503A,
-0xFF504531,
-0xFF4F4734,
-0xFF4B4330,
-0xFF514934,
-0xFF4A4327,
-0xFF534D2B,
-0xFF69613C,
-0xFF8E8661,
-0xFF49411D,
-0xFF5B5233,
-0xFF3D361A,
-0xFF584D37,
-0xFF6C614D,
-0xFF473C28,
-0xFF524731,
-0xFF5C513B,
-0xFF4D452E,
-0xFF4C4431,
-0xFF352E1C,
-0xFF474131,
-0xFF494637,
-0xFF363427,
-0xFF2F2D20,
-0xFF242014,
-0xFF403A2C,
-0xFF332B1E,
-0xFF362F1F,
-0xFF3B3223,
-0xFF382F1E,
-0xFF372A1A,
-0xFF3F3221,
-0xFF5E4F3C,
-0xFF62533E,
-0xFF564732,
-0xFF4D3E27,
-0xFF53472F,
-0xFF463A20,
-0xFF62563C,
-0xFF62563E,
-0xFF483C2C,
-0xFF4E4232,
-0xFF6D624C,
-0xFF63593E,
-0xFF5D5437,
-0xFF4F452A,
-0xFF534930,
-0xFF716650,
-0xFF4C412B,
-0xFF615A40,
-0xFF656042,
-0xFF5A5738,
-0xFF413D20,
-0xFF413F26,
-0xFF64634F,
-0xFF4D4A39,
-0xFF403B27,
-0xFF3E3923,
-0xFF5A543A,
-0xFF5A5339,
-0xFF504831,
-0xFF585039,
-0xFF5F553C,
-0xFF6B6447,
-0xFF58542F,
-0xFF5E5A37,
-0xFF605A42,
-0xFF48412F,
-0xFF32281C,
-0xFF534A39,
-0xFF685E43,
-0xFF47432A,
-0xFFCDD0C7,
-0xFFEEF1F6,
-0xFFEAE6F4,
-0xFFBAB3BB,
-0xFF4A413A,
-0xFF4A422B,
-0xFF655C3B,
-0xFF776F48,
-0xFF69613A,
-0xFF615B39,
-0xFF525037,
-0xFF61402D,
-0xFF9D3C2B,
-0xFFA82918,
-0xFFB33624,
-0xFFA64938,
-0xFF5D3D2E,
-0xFF4C4624,
-0xFF87742F,
-0xFF927517,
-0xFFB89328,
-0xFFC4A249,
-0xFF4D3916,
-0xFF585043,
-0xFF3F3E2A,
-0xFF595843,
-0xFF4F4933,
-0xFF57513B,
-0xFF4A4531,
-0xFF2D270F,
-0xFF665537,
-0xFF725D3E,
-0xFF635339,
-0xFF3F3319,
-0xFF342B0E,
-0xFF4E4325,
-0xFF5E4E2D,
-0xFF715A38,
-0xFF7F623A,
-0xFF85683E,
-0xFF745D33,
-0xFF55431B,
-0xFF685A35,
-0xFF716243,
-0xFF726147,
-0xFF665946,
-0xFF78786C,
-0xFF9CA5A2,
-0xFFC0CBD1,
-0xFFCBD8E1,
-0xFFCBD8E1,
-0xFFC9D8DF,
-0xFFCCDAE3,
-0xFFC7D5E0,
-0xFFC9D6E6,
-0xFFCCD9E9,
-0xFFD1DDEB,
-0xFFD4DEE8,
-0xFFDFE4EA,
-0xFFE3E7E8,
-0xFFE9E9E7,
-0xFFC7C6C2,
-0xFF827D7A,
-0xFF65625B,
-0xFF5D5E4E,
-0xFF575A47,
-0xFF66685A,
-0xFFA5A89F,
-0xFFC6CBC5,
-0xFFC8CCCD,
-0xFFDADFE5,
-0xFFCDD4DC,
-0xFFCAD1DB,
-0xFFCAD1DB,
-0xFFD0D7DF,
-0xFFC8CFD5,
-0xFFA7AFB1,
-0xFFE4EDEC,
-0xFFC6CFCC,
-0xFF9FA5A1,
-0xFF919690,
-0xFFBEC3BD,
-0xFF9EA39F,
-0xFF999F9B,
-0xFF7E837F,
-0xFF6B706C,
-0xFF70726F,
-0xFF828483,
-0xFF868A89,
-0xFFCBCFD0,
-0xFFC3C9C9,
-0xFFB7BCBF,
-0xFFB4B7BC,
-0xFFA4A3A9,
-0xFFB0ABB2,
-0xFFBAB1B6,
-0xFF9B8D8A,
-0xFF8C7F77,
-0xFF7F7774,
-0xFF9E9B96,
-0xFFBBBAB5,
-0xFFAFABA2,
-0xFF9D9183,
-0xFF998D7D,
-0xFFACA89D,
-0xFF909088,
-0xFFD4D1CC,
-0xFF9D9A95,
-0xFF8E8D89,
-0xFFA5A4A0,
-0xFF747371,
-0xFF969792,
-0xFF322922,
-0xFF2F261F,
-0xFF1D140F,
-0xFF19100B,
-0xFF150C07,
-0xFF1E1510,
-0xFF2F261F,
-0xFF251C15,
-0xFF30271E,
-0xFF1B1209,
-0xFF322B21,
-0xFF1B140A,
-0xFF332C24,
-0xFF28211B,
-0xFF160E0B,
-0xFF1B1310,
-0xFF281D19,
-0xFF271C18,
-0xFF120904,
-0xFF1B120D,
-0xFF18110B,
-0xFF110C06,
-0xFF140F09,
-0xFF1D1812,
-0xFF2D2822,
-0xFF181109,
-0xFF2E2721,
-0xFF433A33,
-0xFF3C312B,
-0xFF30231D,
-0xFF2F2019,
-0xFF473A32,
-0xFF352F23,
-0xFF2F2B20,
-0xFF2D2920,
-0xFF2B2620,
-0xFF1B1613,
-0xFF1F1A17,
-0xFF140F0C,
-0xFF2A231D,
-0xFF1E170D,
-0xFF282212,
-0xFF48402D,
-0xFF433B26,
-0xFF493E28,
-0xFF473C26,
-0xFF3B2F19,
-0xFF342917,
-0xFF352D20,
-0xFF2F291D,
-0xFF453C2D,
-0xFF32291A,
-0xFF1F1909,
-0xFF4A4738,
-0xFF2C281C,
-0xFF302A1E,
-0xFF514539,
-0xFF504333,
-0xFF493C29,
-0xFF4A3F29,
-0xFF302A12,
-0xFF2D2613,
-0xFF2A1E10,
-0xFF483C30,
-0xFF362D1E,
-0xFF483F2E,
-0xFF392C1C,
-0xFF413122,
-0xFF5E4B3C,
-0xFF554231,
-0xFF382715,
-0xFF5D4E3B,
-0xFF433826,
-0xFF42392A,
-0xFF3E3629,
-0xFF332B20,
-0xFF292317,
-0xFF433D2F,
-0xFF332D1D,
-0xFF494232,
-0xFF45392D,
-0xFF54483A,
-0xFF453F29,
-0xFF322E22,
-0xFF423F4A,
-0xFF2B2941,
-0xFF262544,
-0xFF282947,
-0xFF1F233C,
-0xFF171C2F,
-0xFF171E28,
-0xFF151C26,
-0xFF232939,
-0xFF373C52,
-0xFF2D314C,
-0xFF272B46,
-0xFF26283F,
-0xFF212437,
-0xFF151726,
-0xFF171926,
-0xFF0A0C18,
-0xFF090B18,
-0xFF232534,
-0xFF1C1E2D,
-0xFF1B1B27,
-0xFF0B0A12,
-0xFF110F10,
-0xFF17140F,
-0xFF534D41,
-0xFF52493A,
-0xFF473A2A,
-0xFF493E2C,
-0xFF4C4532,
-0xFF453E2B,
-0xFF58513E,
-0xFF2F2714,
-0xFF372C1A,
-0xFF7C6D58,
-0xFFD0C1A4,
-0xFF726241,
-0xFF705F41,
-0xFF8F7E62,
-0xFF6C5B3D,
-0xFF56482B,
-0xFF4F4329,
-0xFF4B4428,
-0xFF524D2D,
-0xFF4B4829,
-0xFF403A22,
-0xFF423A27,
-0xFF5D5141,
-0xFF514535,
-0xFF483B2A,
-0xFF463926,
-0xFF4F4430,
-0xFF534832,
-0xFF504831,
-0xFF423A25,
-0xFF3E3724,
-0xFF59533D,
-0xFF413A20,
-0xFF3F3919,
-0xFF6A623D,
-0xFF6C643D,
-0xFF615934,
-0xFF554D29,
-0xFF544E2C,
-0xFF352E11,
-0xFF484127,
-0xFF706A52,
-0xFF4C442F,
-0xFF4A442E,
-0xFF4B432E,
-0xFF47412B,
-0xFF453F29,
-0xFF534E38,
-0xFF55523F,
-0xFF383725,
-0xFF373528,
-0xFF343428,
-0xFF353125,
-0xFF464236,
-0xFF292315,
-0xFF352F21,
-0xFF413A2A,
-0xFF3D3425,
-0xFF2F2313,
-0xFF584C3C,
-0xFF625544,
-0xFF665946,
-0xFF4A3D2A,
-0xFF4A3E28,
-0xFF342913,
-0xFF3B3118,
-0xFF60563D,
-0xFF544933,
-0xFF514537,
-0xFF382F20,
-0xFF4D422E,
-0xFF655B40,
-0xFF675E41,
-0xFF645A3F,
-0xFF4D422C,
-0xFF6B634E,
-0xFF453D28,
-0xFF423C24,
-0xFF5B5638,
-0xFF514E2F,
-0xFF484729,
-0xFF4F4D36,
-0xFF373624,
-0xFF434132,
-0xFF322F1C,
-0xFF3F3A24,
-0xFF5A563D,
-0xFF4B452D,
-0xFF48412E,
-0xFF4C4532,
-0xFF625C44,
-0xFF595538,
-0xFF585532,
-0xFF555533,
-0xFF3D3B24,
-0xFF232011,
-0xFF28241B,
-0xFF5B5549,
-0xFF666249,
-0xFF3D3B24,
-0xFFC1C4BB,
-0xFFF4F5F9,
-0xFFF7F3FF,
-0xFFB6AEB9,
-0xFF38332D,
-0xFF43412C,
-0xFF6A6744,
-0xFF626037,
-0xFF615D37,
-0xFF504C29,
-0xFF5F5A3D,
-0xFF4E2A14,
-0xFF9F392A,
-0xFFCA4C3E,
-0xFFBA4F3D,
-0xFF782D1A,
-0xFF644A39,
-0xFF413A0E,
-0xFFAE9C3A,
-0xFFB39827,
-0xFF987519,
-0xFF7A5B1B,
-0xFF544528,
-0xFF443E30,
-0xFF42412D,
-0xFF3E402A,
-0xFF504B37,
-0xFF48422C,
-0xFF4B4632,
-0xFF615942,
-0xFF6A593D,
-0xFF574328,
-0xFF42361C,
-0xFF2A2309,
-0xFF4F492F,
-0xFF686346,
-0xFF6A5F43,
-0xFF5E4D2F,
-0xFF6C5837,
-0xFF77633E,
-0xFF6F6039,
-0xFF665831,
-0xFF6D613B,
-0xFF726543,
-0xFF6F6146,
-0xFF5F543E,
-0xFF696655,
-0xFFB1B4AB,
-0xFFD2D9DF,
-0xFFCCD4DF,
-0xFFCCD7DD,
-0xFFC9D6DC,
-0xFFCBDAE1,
-0xFFCBD9E4,
-0xFFC1CEDE,
-0xFFC4D0E0,
-0xFFCFD8E7,
-0xFFD7DEE6,
-0xFFDFE1E0,
-0xFFD1D1C7,
-0xFF878475,
-0xFF58513F,
-0xFF534739,
-0xFF564E3B,
-0xFF504C31,
-0xFF565537,
-0xFF494931,
-0xFF51503C,
-0xFF7F8072,
-0xFF62635B,
-0xFFA7A9A4,
-0xFFCDCFCE,
-0xFFE3E4E6,
-0xFFCFD1D0,
-0xFFD9D9D9,
-0xFFBABBB6,
-0xFFA6A69E,
-0xFFA9A99F,
-0xFF7E7F71,
-0xFF505141,
-0xFF615F50,
-0xFF969787,
-0xFF626456,
-0xFF606254,
-0xFF646555,
-0xFF4B493A,
-0xFF474435,
-0xFF474337,
-0xFF504C40,
-0xFF656356,
-0xFF828276,
-0xFF6D6D63,
-0xFF625F58,
-0xFF6D6864,
-0xFF756969,
-0xFF645250,
-0xFF6B554A,
-0xFF6D574A,
-0xFF68574D,
-0xFF685B52,
-0xFF6A6257,
-0xFF6E6254,
-0xFF887861,
-0xFF9E8E77,
-0xFF5C5342,
-0xFF5E5649,
-0xFF7F7569,
-0xFF62584C,
-0xFF585045,
-0xFF625A4F,
-0xFF574E45,
-0xFF5F574C,
-0xFF594B40,
-0xFF4E4035,
-0xFF4A3C33,
-0xFF55473E,
-0xFF4E3F38,
-0xFF51423B,
-0xFF4B3D34,
-0xFF42342B,
-0xFF45372C,
-0xFF483A2F,
-0xFF483A2D,
-0xFF45372C,
-0xFF57493E,
-0xFF493B32,
-0xFF3F3128,
-0xFF44352E,
-0xFF33201A,
-0xFF3E2B27,
-0xFF32201C,
-0xFF2B1915,
-0xFF3E2F2A,
-0xFF1E110B,
-0xFF1C0F09,
-0xFF1F140E,
-0xFF322721,
-0xFF2C1F17,
-0xFF1D100A,
-0xFF5C4D46,
-0xFF44332C,
-0xFF32211A,
-0xFF23100A,
-0xFF3A2921,
-0xFF2D2317,
-0xFF282214,
-0xFF292317,
-0xFF292017,
-0xFF30271E,
-0xFF231910,
-0xFF281B13,
-0xFF34271E,
-0xFF3A2C21,
-0xFF3F3222,
-0xFF564535,
-0xFF372614,
-0xFF5A4834,
-0xFF483622,
-0xFF4C3A26,
-0xFF392816,
-0xFF463C30,
-0xFF3E362B,
-0xFF42382C,
-0xFF3A3024,
-0xFF271F12,
-0xFF2B2517,
-0xFF302A1C,
-0xFF322A1D,
-0xFF483C30,
-0xFF493D2D,
-0xFF4A3F2D,
-0xFF39311E,
-0xFF35301C,
-0xFF3D3727,
-0xFF322C20,
-0xFF302A1E,
-0xFF32281F,
-0xFF392C24,
-0xFF33241D,
-0xFF34231B,
-0xFF503E34,
-0xFF402E22,
-0xFF473626,
-0xFF554535,
-0xFF493B2E,
-0xFF3E342A,
-0xFF201712,
-0xFF261E1B,
-0xFF1C150F,
-0xFF231D11,
-0xFF2F2615,
-0xFF302513,
-0xFF46382B,
-0xFF392C1C,
-0xFF413924,
-0xFF565344,
-0xFF4B4851,
-0xFF201E36,
-0xFF313052,
-0xFF1C1C3E,
-0xFF1C203B,
-0xFF1D2235,
-0xFF131925,
-0xFF0F1521,
-0xFF212437,
-0xFF43455C,
-0xFF31324E,
-0xFF2C2D49,
-0xFF292B42,
-0xFF1D2031,
-0xFF181A29,
-0xFF131522,
-0xFF0E0D1B,
-0xFF151422,
-0xFF1F2130,
-0xFF202231,
-0xFF161622,
-0xFF0C0D12,
-0xFF070705,
-0xFF2C2C24,
-0xFF423E32,
-0xFF433D2D,
-0xFF3F3627,
-0xFF3C3322,
-0xFF393420,
-0xFF312C16,
-0xFF847E68,
-0xFFA19984,
-0xFF483D29,
-0xFF493B21,
-0xFFAB9B7A,
-0xFF8F7D59,
-0xFFBCA887,
-0xFF493415,
-0xFF594928,
-0xFF554627,
-0xFF564B2F,
-0xFF514A2D,
-0xFF5A5734,
-0xFF4C4C2A,
-0xFF322E13,
-0xFF47432A,
-0xFF49432D,
-0xFF443E28,
-0xFF504831,
-0xFF423B21,
-0xFF383117,
-0xFF4B4428,
-0xFF504A30,
-0xFF49432B,
-0xFF3B331E,
-0xFF524A33,
-0xFF4C4227,
-0xFF584D2D,
-0xFF6A5E36,
-0xFF5F532B,
-0xFF493F1C,
-0xFF4B4223,
-0xFF2B2503,
-0xFF4A4424,
-0xFF423D1F,
-0xFF5B573C,
-0xFF3B351D,
-0xFF464229,
-0xFF4F4931,
-0xFF444025,
-0xFF444025,
-0xFF99957A,
-0xFF4A4831,
-0xFF252412,
-0xFF2E2B22,
-0xFF212119,
-0xFF4D4D41,
-0xFF494A3C,
-0xFF2C2A1B,
-0xFF403E2F,
-0xFF3E3B2A,
-0xFF332D1D,
-0xFF383121,
-0xFF544D3B,
-0xFF514837,
-0xFF514936,
-0xFF4B4431,
-0xFF37311B,
-0xFF413B25,
-0xFF3C361E,
-0xFF58543B,
-0xFF625C46,
-0xFF504434,
-0xFF413622,
-0xFF44381E,
-0xFF685D3F,
-0xFF64593B,
-0xFF5F5339,
-0xFF594C39,
-0xFF403322,
-0xFF392C1B,
-0xFF2D220E,
-0xFF5E5439,
-0xFF554E31,
-0xFF544F32,
-0xFF48422A,
-0xFF45402D,
-0xFF393323,
-0xFF292613,
-0xFF2F2D16,
-0xFF504E35,
-0xFF605B45,
-0xFF393421,
-0xFF484330,
-0xFF696750,
-0xFF4F5031,
-0xFF535530,
-0xFF454928,
-0xFF333720,
-0xFF191B0E,
-0xFF21221C,
-0xFF535349,
-0xFF50523C,
-0xFF292D14,
-0xFFBEC7B6,
-0xFFF0F6F2,
-0xFFF5F1FF,
-0xFFB6B0BC,
-0xFF423D39,
-0xFF484732,
-0xFF3E421D,
-0xFF50562A,
-0xFF5C5D35,
-0xFF5C5832,
-0xFF6B613E,
-0xFF765136,
-0xFF802419,
-0xFF7C140B,
-0xFF904333,
-0xFF62321B,
-0xFF514022,
-0xFF433E00,
-0xFFFFF570,
-0xFFC9B329,
-0xFF705703,
-0xFF493709,
-0xFF59513A,
-0xFF515242,
-0xFF464833,
-0xFF3B3D27,
-0xFF3D3C27,
-0xFF474631,
-0xFF494730,
-0xFF504A34,
-0xFF4B402A,
-0xFF544933,
-0xFF433F26,
-0xFF2A2A12,
-0xFF585A44,
-0xFF656752,
-0xFF585542,
-0xFF46412E,
-0xFF443D2A,
-0xFF3C341D,
-0xFF534C30,
-0xFF615839,
-0xFF6F6542,
-0xFF685B39,
-0xFF645639,
-0xFF5B5034,
-0xFF64593D,
-0xFF827B68,
-0xFFB7B5B6,
-0xFFCFD2D9,
-0xFF898F8F,
-0xFF707978,
-0xFFB6C0C2,
-0xFFE0EBF1,
-0xFFCDD6E5,
-0xFFD1DAEB,
-0xFFD3D9E7,
-0xFFD6DBDF,
-0xFFC5C6BE,
-0xFF5D5B46,
-0xFF534E31,
-0xFF5B5032,
-0xFF5F4F35,
-0xFF514328,
-0xFF4C4528,
-0xFF817C5E,
-0xFF454126,
-0xFF555138,
-0xFF76715B,
-0xFF46442F,
-0xFF4D4A39,
-0xFF555241,
-0xFFB0AA9A,
-0xFFBAB3A1,
-0xFF867A6A,
-0xFF857865,
-0xFF756450,
-0xFF66543C,
-0xFF69583E,
-0xFF63533A,
-0xFF594E38,
-0xFF8A8370,
-0xFF7F7A64,
-0xFF5D5842,
-0xFF5C563E,
-0xFF4F482E,
-0xFF564A32,
-0xFF4E4228,
-0xFF5B4F35,
-0xFF5C5036,
-0xFF625B41,
-0xFF564E37,
-0xFF524A35,
-0xFF564936,
-0xFF675445,
-0xFF694F42,
-0xFF6A4A3D,
-0xFF6B4B3E,
-0xFF6D5247,
-0xFF675348,
-0xFF645447,
-0xFF5B4A3A,
-0xFF816B53,
-0xFFB29C84,
-0xFF695A45,
-0xFF645746,
-0xFF6A5949,
-0xFF695848,
-0xFF635344,
-0xFF605041,
-0xFF635145,
-0xFF665446,
-0xFF513E30,
-0xFF5A463B,
-0xFF5A463B,
-0xFF564239,
-0xFF58443B,
-0xFF655148,
-0xFF564239,
-0xFF503C31,
-0xFF614D42,
-0xFF635042,
-0xFF624F41,
-0xFF655244,
-0xFF6E5B4D,
-0xFF685547,
-0xFF584439,
-0xFF675348,
-0xFF69524A,
-0xFF715851,
-0xFF68514B,
-0xFF715A52,
-0xFF665249,
-0xFF6B594F,
-0xFF6E5C52,
-0xFF6A584E,
-0xFF645248,
-0xFF6B594F,
-0xFF68544B,
-0xFF624E43,
-0xFF563F37,
-0xFF675146,
-0xFF6C534C,
-0xFF5E483D,
-0xFF615142,
-0xFF534636,
-0xFF5B4E3E,
-0xFF514132,
-0xFF6A584C,
-0xFF4F3D31,
-0xFF513E30,
-0xFF604A3D,
-0xFF5D473A,
-0xFF5B4436,
-0xFF5A4335,
-0xFF442A1B,
-0xFF543A29,
-0xFF4D3420,
-0xFF5D4430,
-0xFF513C29,
-0xFF483829,
-0xFF423429,
-0xFF392B1E,
-0xFF3B2D20,
-0xFF312316,
-0xFF4E4033,
-0xFF2A1C0F,
-0xFF271A0A,
-0xFF6C5C4D,
-0xFF483828,
-0xFF382B1A,
-0xFF3D3220,
-0xFF271E0D,
-0xFF393222,
-0xFF2B2519,
-0xFF251F13,
-0xFF281B13,
-0xFF21120B,
-0xFF362722,
-0xFF271813,
-0xFF3B2A22,
-0xFF4A382C,
-0xFF4D3C2C,
-0xFF4B3A2A,
-0xFF55473A,
-0xFF372A22,
-0xFF1C1211,
-0xFF2C2324,
-0xFF150D0A,
-0xFF2D251A,
-0xFF2D220E,
-0xFF483C22,
-0xFF493A23,
-0xFF4D4129,
-0xFF2E2808,
-0xFF5B5640,
-0xFF474246,
-0xFF312F44,
-0xFF2E2D4D,
-0xFF2A2A4C,
-0xFF282C45,
-0xFF23283B,
-0xFF1B212F,
-0xFF101624,
-0xFF1A1C31,
-0xFF444561,
-0xFF262648,
-0xFF303150,
-0xFF1F2138,
-0xFF131627,
-0xFF171926,
-0xFF151724,
-0xFF0B0A18,
-0xFF201F2D,
-0xFF323345,
-0xFF1C1E2D,
-0xFF090915,
-0xFF0A0B10,
-0xFF060604,
-0xFF36382D,
-0xFF3B392A,
-0xFF484534,
-0xFF494134,
-0xFF30281B,
-0xFF27220F,
-0xFF4D4834,
-0xFF403A22,
-0xFF7E765F,
-0xFFE7DBC5,
-0xFF7F6F55,
-0xFFA18E6D,
-0xFFC8B491,
-0xFF573E1F,
-0xFF4D3617,
-0xFF6C5837,
-0xFF625231,
-0xFF54462B,
-0xFF51472C,
-0xFF4C4729,
-0xFF504D2E,
-0xFF353116,
-0xFF504C33,
-0xFF413D24,
-0xFF554F37,
-0xFF625C44,
-0xFF443E24,
-0xFF474225,
-0xFF443F22,
-0xFF524C32,
-0xFF372F18,
-0xFF3A321D,
-0xFF4B402A,
-0xFF53452B,
-0xFF615231,
-0xFF64552C,
-0xFF64552C,
-0xFF5C4F2C,
-0xFF403716,
-0xFF4D4423,
-0xFF514B2B,
-0xFF3E391C,
-0xFF555136,
-0xFF444027,
-0xFF332F16,
-0xFF4F4B32,
-0xFF454126,
-0xFF332E11,
-0xFF7C785D,
-0xFF4D4832,
-0xFF252211,
-0xFF2A271E,
-0xFF201D16,
-0xFF3E3E32,
-0xFF333527,
-0xFF2E2F1F,
-0xFF353324,
-0xFF353221,
-0xFF403D2C,
-0xFF443E2E,
-0xFF3E3828,
-0xFF413A28,
-0xFF4A4331,
-0xFF4D4634,
-0xFF2A2511,
-0xFF4E4935,
-0xFF2A250F,
-0xFF4A4531,
-0xFF55503C,
-0xFF3A321F,
-0xFF30250F,
-0xFF504527,
-0xFF695E3E,
-0xFF6D6242,
-0xFF52472B,
-0xFF574833,
-0xFF493C2B,
-0xFF4D402F,
-0xFF3D321E,
-0xFF483E23,
-0xFF423B1E,
-0xFF70694D,
-0xFF534D35,
-0xFF4A4331,
-0xFF322B1B,
-0xFF362F1D,
-0xFF423C26,
-0xFF68624A,
-0xFF605A42,
-0xFF38301D,
-0xFF564E3B,
-0xFF5C563E,
-0xFF5C5739,
-0xFF4D4B24,
-0xFF565632,
-0xFF4F4D34,
-0xFF272415,
-0xFF2B271E,
-0xFF403A2E,
-0xFF6D694E,
-0xFF2C2B0D,
-0xFFC2C5B0,
-0xFFF4F7F0,
-0xFFF2EFF8,
-0xFFB5B2BB,
-0xFF23221D,
-0xFF4E503B,
-0xFF565A37,
-0xFF555A31,
-0xFF40421D,
-0xFF514E2D,
-0xFF6C5F3F,
-0xFF744A32,
-0xFF70160D,
-0xFF660500,
-0xFF612316,
-0xFF5B391E,
-0xFF4D3F10,
-0xFF898228,
-0xFFEEDF46,
-0xFFEDDC48,
-0xFF6F5D15,
-0xFF504225,
-0xFF42402B,
-0xFF595A4A,
-0xFF575642,
-0xFF43422D,
-0xFF4A4935,
-0xFF373622,
-0xFF4F4E39,
-0xFF36341F,
-0xFF433E2B,
-0xFF43412C,
-0xFF32341C,
-0xFF2F331C,
-0xFF474A35,
-0xFF606151,
-0xFF525343,
-0xFF3C3D2F,
-0xFF28291B,
-0xFF363523,
-0xFF3D371F,
-0xFF74694D,
-0xFF655637,
-0xFF5F502F,
-0xFF605539,
-0xFF57492E,
-0xFF615032,
-0xFF5A4A33,
-0xFF524741,
-0xFFAEA9A6,
-0xFF77776D,
-0xFF55584D,
-0xFF464B45,
-0xFFC1C9CB,
-0xFFD3DBE6,
-0xFFD1D7E7,
-0xFFD8DCE8,
-0xFFDBDFE2,
-0xFF9A9B8D,
-0xFF59583C,
-0xFF4E4622,
-0xFF615431,
-0xFF695938,
-0xFF615233,
-0xFF44391D,
-0xFF797256,
-0xFF3A341A,
-0xFF433D23,
-0xFF726C54,
-0xFF3B371E,
-0xFF3B351F,
-0xFF3E3820,
-0xFF383019,
-0xFF8D836A,
-0xFF56462D,
-0xFF645337,
-0xFF70583C,
-0xFF745B3C,
-0xFF846A49,
-0xFF72593B,
-0xFF5C4C35,
-0xFF7F745E,
-0xFF79715A,
-0xFF474026,
-0xFF4E4429,
-0xFF44391D,
-0xFF605134,
-0xFF5C4B2D,
-0xFF6C593B,
-0xFF625133,
-0xFF6C5E41,
-0xFF6A5F43,
-0xFF685A40,
-0xFF64523C,
-0xFF533D28,
-0xFF5C3F2D,
-0xFF6C4737,
-0xFF603A2D,
-0xFF715348,
-0xFF6E564A,
-0xFF584537,
-0xFF5E4B3A,
-0xFF8E765C,
-0xFFB29A80,
-0xFF56462F,
-0xFF5E4F3A,
-0xFF6E5C48,
-0xFF62503C,
-0xFF5B4837,
-0xFF665344,
-0xFF5F493B,
-0xFF5A4436,
-0xFF513B2D,
-0xFF4C3628,
-0xFF584235,
-0xFF5B453A,
-0xFF553F34,
-0xFF564035,
-0xFF553F34,
-0xFF4D372C,
-0xFF584034,
-0xFF584133,
-0xFF594234,
-0xFF5C4537,
-0xFF6D5648,
-0xFF5D4638,
-0xFF634C3E,
-0xFF624B3D,
-0xFF5F4538,
-0xFF6D5346,
-0xFF74594E,
-0xFF5F4538,
-0xFF6C5245,
-0xFF6D5648,
-0xFF715A4A,
-0xFF654E3E,
-0xFF5C4533,
-0xFF6E5443,
-0xFF6A4F3E,
-0xFF644936,
-0xFF6A4D3D,
-0xFF6A4D3B,
-0xFF785849,
-0xFF725545,
-0xFF6E5244,
-0xFF735749,
-0xFF745948,
-0xFF684D3C,
-0xFF8B6E5C,
-0xFF6B4E3C,
-0xFF745747,
-0xFF755546,
-0xFF6D4D40,
-0xFF78584D,
-0xFF77574C,
-0xFF76594B,
-0xFF755848,
-0xFF795E4B,
-0xFF664C35,
-0xFF412611,
-0xFF654B3C,
-0xFF5D4638,
-0xFF644E40,
-0xFF584234,
-0xFF695244,
-0xFF62483B,
-0xFF5F4536,
-0xFF593F2E,
-0xFF5B4432,
-0xFF4A3522,
-0xFF4A3522,
-0xFF4C3726,
-0xFF372416,
-0xFF463629,
-0xFF362A1C,
-0xFF261A0E,
-0xFF2B1D12,
-0xFF2C1B13,
-0xFF2D1E17,
-0xFF34251E,
-0xFF39281E,
-0xFF322012,
-0xFF3E2C18,
-0xFF392713,
-0xFF3B2B1C,
-0xFF271A12,
-0xFF211716,
-0xFF1F1617,
-0xFF140D07,
-0xFF3D3425,
-0xFF302509,
-0xFF453815,
-0xFF544621,
-0xFF594D23,
-0xFF7F784A,
-0xFF4D4B25,
-0xFF626054,
-0xFF35343C,
-0xFF2D2D47,
-0xFF30314F,
-0xFF2B3044,
-0xFF0E1424,
-0xFF070D1D,
-0xFF1E2336,
-0xFF272942,
-0xFF49496B,
-0xFF3E3D65,
-0xFF37375D,
-0xFF1F2138,
-0xFF242736,
-0xFF191B28,
-0xFF11131F,
-0xFF141321,
-0xFF252432,
-0xFF2C2B3D,
-0xFF0B0A1A,
-0xFF0B0E17,
-0xFF0C1013,
-0xFF0D0F0A,
-0xFF2D2F22,
-0xFF4C4A3B,
-0xFF4B4839,
-0xFF645E52,
-0xFF383226,
-0xFF31291E,
-0xFF312A1A,
-0xFF463E29,
-0xFF43371F,
-0xFF72624B,
-0xFFC1AD94,
-0xFF9B8465,
-0xFF8B7253,
-0xFF4F3119,
-0xFF745840,
-0xFF8E7556,
-0xFF5F4A2B,
-0xFF56452B,
-0xFF675B43,
-0xFF443C25,
-0xFF443E26,
-0xFF2D270F,
-0xFF4C4630,
-0xFF4D4731,
-0xFF423A23,
-0xFF5B533C,
-0xFF2F280E,
-0xFF484326,
-0xFF464124,
-0xFF453E24,
-0xFF3E361F,
-0xFF382D19,
-0xFF372B15,
-0xFF4E3E25,
-0xFF5A492B,
-0xFF66522D,
-0xFF645328,
-0xFF63562C,
-0xFF584C26,
-0xFF685D3D,
-0xFF41381B,
-0xFF504831,
-0xFF59533D,
-0xFF3B351F,
-0xFF322C14,
-0xFF48422A,
-0xFF2F2911,
-0xFF433B24,
-0xFF746E58,
-0xFF5F5846,
-0xFF282212,
-0xFF4B4537,
-0xFF2E2A1E,
-0xFF323023,
-0xFF393A2C,
-0xFF343223,
-0xFF312F20,
-0xFF373425,
-0xFF4E483A,
-0xFF352E1E,
-0xFF342D1D,
-0xFF393021,
-0xFF433A29,
-0xFF3C3322,
-0xFF362F1D,
-0xFF433C2A,
-0xFF26210D,
-0xFF494431,
-0xFF46412D,
-0xFF2C2411,
-0xFF595238,
-0xFF706746,
-0xFF615934,
-0xFF544C27,
-0xFF554C2B,
-0xFF53472D,
-0xFF3A2F19,
-0xFF362B17,
-0xFF514630,
-0xFF494023,
-0xFF4E472A,
-0xFF5F583C,
-0xFF332D15,
-0xFF504939,
-0xFF332B1E,
-0xFF453929,
-0xFF645744,
-0xFF7E6F58,
-0xFF65563F,
-0xFF5A4935,
-0xFF6D5B47,
-0xFF6F5E44,
-0xFF8A7A58,
-0xFF7F7045,
-0xFF72633A,
-0xFF7D6C4E,
-0xFF73614B,
-0xFF584234,
-0xFF452F1A,
-0xFF6F5836,
-0xFF6E5C38,
-0xFF978C76,
-0xFFF2EEE5,
-0xFFEEECF1,
-0xFFB3B4B8,
-0xFF212820,
-0xFF2F3420,
-0xFF5D5C3E,
-0xFF514E2F,
-0xFF43462B,
-0xFF56543F,
-0xFF524532,
-0xFF592B1C,
-0xFF78160D,
-0xFF750E07,
-0xFF68281F,
-0xFF644125,
-0xFF3E2B00,
-0xFFD1C454,
-0xFFE0D032,
-0xFFE9D84A,
-0xFF6C5C21,
-0xFF504533,
-0xFF595643,
-0xFF4B4A36,
-0xFF3F3826,
-0xFF382F20,
-0xFF3F372A,
-0xFF494637,
-0xFF3A3B29,
-0xFF292C17,
-0xFF2B2C1A,
-0xFF2E311C,
-0xFF1B1F08,
-0xFF464A31,
-0xFF474631,
-0xFF5D5A47,
-0xFF504D3A,
-0xFF4C4B37,
-0xFF272A17,
-0xFF23220D,
-0xFF40341A,
-0xFF635234,
-0xFF6D5938,
-0xFF796646,
-0xFF50442C,
-0xFF453923,
-0xFF533D26,
-0xFF604733,
-0xFF554434,
-0xFF4A3D2D,
-0xFF504831,
-0xFF45402A,
-0xFF2D2E1C,
-0xFF7F827B,
-0xFFD0D3DA,
-0xFFD3D7E3,
-0xFFD9DBE8,
-0xFFA8A9AD,
-0xFF6F7062,
-0xFF5A593D,
-0xFF524A26,
-0xFF6A5D3A,
-0xFF756446,
-0xFF68583E,
-0xFF41351D,
-0xFF78705B,
-0xFF2C2610,
-0xFF49422F,
-0xFF7D7864,
-0xFF35331E,
-0xFF3A3521,
-0xFF37321E,
-0xFF38321C,
-0xFF8F8770,
-0xFF57492F,
-0xFF554629,
-0xFF695435,
-0xFF806949,
-0xFF806645,
-0xFF715A3B,
-0xFF493824,
-0xFF6F6452,
-0xFF766E59,
-0xFF564E37,
-0xFF695F46,
-0xFF56482E,
-0xFF746349,
-0xFF6E5A3F,
-0xFF816C51,
-0xFF725E45,
-0xFF695940,
-0xFF65563F,
-0xFF62513D,
-0xFF614E3D,
-0xFF583E31,
-0xFF523225,
-0xFF583323,
-0xFF593424,
-0xFF5E4236,
-0xFF5E483B,
-0xFF5B493B,
-0xFF665543,
-0xFF7A654A,
-0xFFAF9A7F,
-0xFF61523B,
-0xFF524630,
-0xFF54442D,
-0xFF52402A,
-0xFF4F3C2B,
-0xFF4C3B29,
-0xFF544130,
-0xFF604D3C,
-0xFF4F382A,
-0xFF533C2E,
-0xFF543C30,
-0xFF4C3428,
-0xFF543C32,
-0xFF50382E,
-0xFF563E34,
-0xFF563B30,
-0xFF5E4437,
-0xFF5D4334,
-0xFF5F4536,
-0xFF5C4032,
-0xFF715547,
-0xFF5A3E30,
-0xFF6E5244,
-0xFF583C2E,
-0xFF65493B,
-0xFF64483A,
-0xFF5F4234,
-0xFF664939,
-0xFF644938,
-0xFF654A37,
-0xFF5D402E,
-0xFF725641,
-0xFF694E39,
-0xFF5F432D,
-0xFF6A4A35,
-0xFF64412D,
-0xFF6A4733,
-0xFF6A4733,
-0xFF785541,
-0xFF785541,
-0xFF714E3B,
-0xFF765340,
-0xFF7D5A47,
-0xFF5C3925,
-0xFF805D49,
-0xFF775440,
-0xFF775441,
-0xFF7C5946,
-0xFF745042,
-0xFF765244,
-0xFF6E4C40,
-0xFF6B493D,
-0xFF735344,
-0xFF795A46,
-0xFF70513D,
-0xFF634430,
-0xFF6E4E3F,
-0xFF715444,
-0xFF705544,
-0xFF705544,
-0xFF7A5A4B,
-0xFF725243,
-0xFF785746,
-0xFF583925,
-0xFF624631,
-0xFF826752,
-0xFF806552,
-0xFF785D4C,
-0xFF775B4D,
-0xFF876D60,
-0xFF685547,
-0xFF6B584A,
-0xFF725B4D,
-0xFF6A5345,
-0xFF6C5649,
-0xFF645143,
-0xFF6E5B4A,
-0xFF67523F,
-0xFF715844,
-0xFF563D29,
-0xFF5E4737,
-0xFF5B483A,
-0xFF483A31,
-0xFF3F3229,
-0xFF3C3022,
-0xFF382912,
-0xFF5B4B29,
-0xFF837247,
-0xFF7E6B40,
-0xFF796938,
-0xFF625922,
-0xFF615D2E,
-0xFF84826B,
-0xFF343331,
-0xFF35364A,
-0xFF383957,
-0xFF1E223B,
-0xFF0C1127,
-0xFF32374B,
-0xFF30354B,
-0xFF070922,
-0xFF333453,
-0xFF3C3B63,
-0xFF29294D,
-0xFF1D1F34,
-0xFF131723,
-0xFF141623,
-0xFF0F111E,
-0xFF1B1D2C,
-0xFF333544,
-0xFF28293B,
-0xFF0D101F,
-0xFF0F131C,
-0xFF050608,
-0xFF19160D,
-0xFF373123,
-0xFF484232,
-0xFF4E4735,
-0xFF3F3828,
-0xFF31291C,
-0xFF3B3125,
-0xFF413829,
-0xFF564A34,
-0xFF55452C,
-0xFF4B3921,
-0xFF503B20,
-0xFFC3A88B,
-0xFF7C5F41,
-0xFF54341B,
-0xFF5D3F25,
-0xFF604527,
-0xFF664F30,
-0xFF4E3A21,
-0xFF42311D,
-0xFF473C28,
-0xFF433824,
-0xFF3D2E19,
-0xFF3E2E17,
-0xFF43341F,
-0xFF40311C,
-0xFF54442D,
-0xFF53452B,
-0xFF50472A,
-0xFF453E22,
-0xFF4E472D,
-0xFF413620,
-0xFF271805,
-0xFF46361F,
-0xFF5C462E,
-0xFF5A4324,
-0xFF7B6540,
-0xFF65522A,
-0xFF73643B,
-0xFF625630,
-0xFF504527,
-0xFF575036,
-0xFF443C29,
-0xFF4C4533,
-0xFF37301E,
-0xFF1F1805,
-0xFF59513C,
-0xFF4C442F,
-0xFF423723,
-0xFF867B69,
-0xFF514837,
-0xFF201909,
-0xFF373020,
-0xFF484234,
-0xFF373529,
-0xFF2E2C20,
-0xFF39372A,
-0xFF454233,
-0xFF403D2E,
-0xFF322C1E,
-0xFF413B2B,
-0xFF383222,
-0xFF3E3629,
-0xFF4A4034,
-0xFF3F3627,
-0xFF2E2717,
-0xFF5D5646,
-0xFF2C2616,
-0xFF3B3424,
-0xFF4B4432,
-0xFF302916,
-0xFF413A20,
-0xFF5B5535,
-0xFF4D4723,
-0xFF534B26,
-0xFF655D39,
-0xFF564D30,
-0xFF42381D,
-0xFF4C4229,
-0xFF585135,
-0xFF504A2A,
-0xFF534D2B,
-0xFF60593C,
-0xFF3C351B,
-0xFF5A5140,
-0xFF372B1B,
-0xFF4F422F,
-0xFF7B6D53,
-0xFF6C5B41,
-0xFF615036,
-0xFF4A3824,
-0xFF4C3820,
-0xFF7D6445,
-0xFF846B43,
-0xFFA58D61,
-0xFF90784C,
-0xFF997C5A,
-0xFF785A3E,
-0xFF84614B,
-0xFF7C5A3F,
-0xFF977750,
-0xFF836944,
-0xFFA4957E,
-0xFFF2EBE1,
-0xFFF4F2F5,
-0xFFB4B5B7,
-0xFF252B21,
-0xFF2B2E1B,
-0xFF302A12,
-0xFF48422A,
-0xFF252614,
-0xFF403E2F,
-0xFF413527,
-0xFF5F3328,
-0xFF75120C,
-0xFF720905,
-0xFF682B26,
-0xFF5F3E1D,
-0xFF624C00,
-0xFFF3E163,
-0xFFE1D239,
-0xFFB4A526,
-0xFF6A5C2B,
-0xFF4C4236,
-0xFF4D4A37,
-0xFF494834,
-0xFF241E0E,
-0xFF30281B,
-0xFF3F372C,
-0xFF453F33,
-0xFF2C2D1D,
-0xFF181B0A,
-0xFF252719,
-0xFF212413,
-0xFF3C4029,
-0xFF484A32,
-0xFF37321C,
-0xFF635D47,
-0xFF48422A,
-0xFF3F3921,
-0xFF33311A,
-0xFF38341B,
-0xFF423419,
-0xFF604D2D,
-0xFF6C5837,
-0xFF5B4A2C,
-0xFF3B301A,
-0xFF534737,
-0xFF543E30,
-0xFF462F21,
-0xFF4D3C2A,
-0xFF4C402A,
-0xFF3B3418,
-0xFF423E23,
-0xFF35341F,
-0xFF4A4A3E,
-0xFFDADCDB,
-0xFFE1E2E7,
-0xFFE2E1E6,
-0xFF575652,
-0xFF63604D,
-0xFF696446,
-0xFF645C38,
-0xFF796F4B,
-0xFF57492C,
-0xFF6E6046,
-0xFF463E27,
-0xFF746D5A,
-0xFF3C3724,
-0xFF413C29,
-0xFF777461,
-0xFF3A3724,
-0xFF312E1B,
-0xFF43402D,
-0xFF443F29,
-0xFF89816A,
-0xFF50442A,
-0xFF524427,
-0xFF615032,
-0xFF766142,
-0xFF695233,
-0xFF665136,
-0xFF483924,
-0xFF645945,
-0xFF817662,
-0xFF5A4F39,
-0xFF5E523A,
-0xFF594930,
-0xFF76624A,
-0xFF6D5740,
-0xFF6D573F,
-0xFF5B472F,
-0xFF675740,
-0xFF5A4935,
-0xFF61503E,
-0xFF635041,
-0xFF543C30,
-0xFF51352A,
-0xFF4A291A,
-0xFF593827,
-0xFF583C2E,
-0xFF5B4537,
-0xFF5D4C3C,
-0xFF63503F,
-0xFF675139,
-0xFFB6A186,
-0xFF4F3F26,
-0xFF4B3B22,
-0xFF56452B,
-0xFF47331A,
-0xFF45331B,
-0xFF4B3921,
-0xFF544027,
-0xFF59452C,
-0xFF5F4439,
-0xFF53382D,
-0xFF563B30,
-0xFF50352C,
-0xFF573C33,
-0xFF5C4138,
-0xFF593E33,
-0xFF503429,
-0xFF593D31,
-0xFF5E4234,
-0xFF5A3E30,
-0xFF624535,
-0xFF624537,
-0xFF56392B,
-0xFF67473C,
-0xFF54362B,
-0xFF6A4D3F,
-0xFF593C2E,
-0xFF6C4C3D,
-0xFF60412F,
-0xFF5F432E,
-0xFF644832,
-0xFF6B4C37,
-0xFF70513C,
-0xFF664A34,
-0xFF664830,
-0xFF69452F,
-0xFF744E39,
-0xFF69432E,
-0xFF734F39,
-0xFF704C36,
-0xFF77513C,
-0xFF6F4934,
-0xFF724C37,
-0xFF75513B,
-0xFF68452F,
-0xFF78553F,
-0xFF795640,
-0xFF845F4C,
-0xFF714C3A,
-0xFF795643,
-0xFF543020,
-0xFF664536,
-0xFF715041,
-0xFF6A4938,
-0xFF704F3E,
-0xFF755141,
-0xFF745342,
-0xFF715240,
-0xFF6C4D3B,
-0xFF634231,
-0xFF6E4A3A,
-0xFF6F4B3B,
-0xFF73503D,
-0xFF704F3C,
-0xFF7D5D48,
-0xFF71523D,
-0xFF81624E,
-0xFF664532,
-0xFF775343,
-0xFF7E5A4A,
-0xFF775645,
-0xFF755546,
-0xFF775647,
-0xFF744F3F,
-0xFF6E4937,
-0xFF785843,
-0xFF7B5F47,
-0xFF765B40,
-0xFF9B7D65,
-0xFF7A5744,
-0xFF805C4C,
-0xFF896857,
-0xFF8B6C58,
-0xFF80664F,
-0xFF806B4E,
-0xFFAA9578,
-0xFF8E7755,
-0xFFA28B5F,
-0xFF997E4F,
-0xFF8F7246,
-0xFF8D7245,
-0xFF937F4A,
-0xFF887C4A,
-0xFF9A9673,
-0xFF403E31,
-0xFF373646,
-0xFF383958,
-0xFF1D1F45,
-0xFF34385B,
-0xFF333855,
-0xFF0D1329,
-0xFF000216,
-0xFF4A4F65,
-0xFF373B58,
-0xFF10142F,
-0xFF000412,
-0xFF080C17,
-0xFF191B2A,
-0xFF202133,
-0xFF36394C,
-0xFF2E3346,
-0xFF192032,
-0xFF040C19,
-0xFF050E15,
-0xFF090909,
-0xFF1C0E03,
-0xFF5B4837,
-0xFF3E2B1A,
-0xFF635240,
-0xFF271803,
-0xFF3A2E18,
-0xFF261B07,
-0xFF392C19,
-0xFF5F4D37,
-0xFF5A462D,
-0xFF574426,
-0xFF40290A,
-0xFF775A3A,
-0xFF6C4E2C,
-0xFF68492A,
-0xFF634628,
-0xFF503919,
-0xFF5A4528,
-0xFF47331B,
-0xFF55432F,
-0xFF3E311E,
-0xFF53442F,
-0xFFEBD3BB,
-0xFFAC8E76,
-0xFF573B26,
-0xFF583C27,
-0xFF4D2D18,
-0xFF6D5139,
-0xFF59482A,
-0xFF463B1D,
-0xFF453921,
-0xFF463722,
-0xFF2C1A04,
-0xFF543C24,
-0xFF6A482C,
-0xFF8F6E4F,
-0xFF6F5532,
-0xFF6F5836,
-0xFF3B2B09,
-0xFF635636,
-0xFF423B1F,
-0xFF544F39,
-0xFF241D0D,
-0xFF4B4338,
-0xFF302A1E,
-0xFF181204,
-0xFF423B2B,
-0xFF4D4230,
-0xFF4B3B2B,
-0xFF786956,
-0xFF554D3A,
-0xFF2B2412,
-0xFF463D2E,
-0xFF3E362B,
-0xFF2B2620,
-0xFF201D16,
-0xFF3A332B,
-0xFF342E22,
-0xFF3B3829,
-0xFF403F2D,
-0xFF302F1D,
-0xFF3A3728,
-0xFF312B1F,
-0xFF4F473C,
-0xFF473E35,
-0xFF2C231A,
-0xFF464034,
-0xFF2A2418,
-0xFF41392C,
-0xFF645D4D,
-0xFF362F1C,
-0xFF322A13,
-0xFF645D40,
-0xFF595031,
-0xFF3B3010,
-0xFF675C3C,
-0xFF504728,
-0xFF51482B,
-0xFF322B0E,
-0xFF4C4727,
-0xFF4E4A25,
-0xFF5F5A34,
-0xFF574E2D,
-0xFF66583B,
-0xFF64543D,
-0xFF4E3E27,
-0xFF665939,
-0xFF6E613E,
-0xFF7C6C48,
-0xFF4F3E20,
-0xFF342812,
-0xFF4E3E25,
-0xFF8F734C,
-0xFFC1A073,
-0xFF9D7C4F,
-0xFF6C4B20,
-0xFF79582F,
-0xFF8D6A44,
-0xFFA2795B,
-0xFF8F6648,
-0xFF9F7B57,
-0xFF644A29,
-0xFFB9AE9A,
-0xFFF4F4EC,
-0xFFEDF1F4,
-0xFFB6B7B9,
-0xFF4F4B40,
-0xFF342D1A,
-0xFF352E1B,
-0xFF3B3623,
-0xFF312F23,
-0xFF413F33,
-0xFF3D3727,
-0xFF532D20,
-0xFF7F221B,
-0xFF821E1C,
-0xFF6A3531,
-0xFF4E320B,
-0xFF846D05,
-0xFFCFBD35,
-0xFFE3D550,
-0xFF7B6F09,
-0xFF7F784C,
-0xFF393323,
-0xFF4E4935,
-0xFF494633,
-0xFF2F3022,
-0xFF28281C,
-0xFF383629,
-0xFF3D3B2E,
-0xFF333426,
-0xFF18190B,
-0xFF242015,
-0xFF171307,
-0xFF3D3A27,
-0xFF423D27,
-0xFF4A442C,
-0xFF554B32,
-0xFF5C5036,
-0xFF4E4228,
-0xFF382C14,
-0xFF403218,
-0xFF433319,
-0xFF6B5C3F,
-0xFF605333,
-0xFF574C30,
-0xFF504531,
-0xFF43392D,
-0xFF41342E,
-0xFF291C16,
-0xFF413A2A,
-0xFF48462F,
-0xFF2D2D15,
-0xFF343620,
-0xFF303320,
-0xFF353729,
-0xFF84867B,
-0xFFA2A298,
-0xFF848075,
-0xFF3D3624,
-0xFF696246,
-0xFF726948,
-0xFF6B633F,
-0xFF746C48,
-0xFF504A2A,
-0xFF625D40,
-0xFF3C381F,
-0xFF6F6D56,
-0xFF272510,
-0xFF2C2916,
-0xFF6F6E5C,
-0xFF262513,
-0xFF282514,
-0xFF363320,
-0xFF37321C,
-0xFF817B61,
-0xFF43391E,
-0xFF4C4125,
-0xFF56482D,
-0xFF5B4B32,
-0xFF5E4C36,
-0xFF63533C,
-0xFF4F432B,
-0xFF675D44,
-0xFF93876F,
-0xFF6C5D46,
-0xFF615137,
-0xFF5C4B31,
-0xFF5A4530,
-0xFF6D5843,
-0xFF665239,
-0xFF6F5B43,
-0xFF4A3726,
-0xFF544333,
-0xFF635240,
-0xFF584838,
-0xFF544234,
-0xFF594638,
-0xFF452B1C,
-0xFF4A2F1E,
-0xFF553C28,
-0xFF59432E,
-0xFF47301E,
-0xFF48311F,
-0xFF684F3B,
-0xFFAE957F,
-0xFF644F34,
-0xFF756041,
-0xFF7D6646,
-0xFF887151,
-0xFF7B6444,
-0xFF87704E,
-0xFF9C855C,
-0xFFA38C62,
-0xFF5C4136,
-0xFF4A2F24,
-0xFF563B30,
-0xFF50352A,
-0xFF573C33,
-0xFF4D3126,
-0xFF54382D,
-0xFF5C3E33,
-0xFF55382A,
-0xFF563929,
-0xFF533626,
-0xFF634334,
-0xFF6C4C3D,
-0xFF613F33,
-0xFF725044,
-0xFF613F33,
-0xFF5F3F32,
-0xFF5E3E2F,
-0xFF694434,
-0xFF5B3624,
-0xFF563621,
-0xFF63432E,
-0xFF65422C,
-0xFF6F4F38,
-0xFF6A4C34,
-0xFF64442D,
-0xFF704733,
-0xFF734835,
-0xFF6E4531,
-0xFF704731,
-0xFF6D442E,
-0xFF6C432D,
-0xFF744B35,
-0xFF774E38,
-0xFF765039,
-0xFF613B24,
-0xFF603C24,
-0xFF77533D,
-0xFF6C4832,
-0xFF704C36,
-0xFF704B38,
-0xFF77523F,
-0xFF684331,
-0xFF6E4937,
-0xFF775240,
-0xFF724B3A,
-0xFF7E5746,
-0xFF6A4533,
-0xFF6F4C39,
-0xFF724F3B,
-0xFF76513E,
-0xFF78523F,
-0xFF764D3B,
-0xFF7E5541,
-0xFF6B4530,
-0xFF78543C,
-0xFF734F39,
-0xFF88644E,
-0xFF7E5A44,
-0xFF7D5742,
-0xFF79533E,
-0xFF7A5441,
-0xFF7C5341,
-0xFF79503E,
-0xFF7F5141,
-0xFF744936,
-0xFF7D5740,
-0xFF775339,
-0xFF785539,
-0xFF8C664F,
-0xFF693F2F,
-0xFF85594C,
-0xFF845949,
-0xFF7E5843,
-0xFF745236,
-0xFF7C5E3C,
-0xFFA1835F,
-0xFF8E7147,
-0xFF8C6C3D,
-0xFF886837,
-0xFF886839,
-0xFFA88C5D,
-0xFF8E774B,
-0xFF776942,
-0xFF7A725B,
-0xFF4F4C47,
-0xFF343547,
-0xFF333655,
-0xFF2D3156,
-0xFF3D4166,
-0xFF242946,
-0xFF080E24,
-0xFF12172B,
-0xFF43485C,
-0xFF1D213A,
-0xFF050A20,
-0xFF1F2535,
-0xFF323544,
-0xFF313244,
-0xFF2E2F41,
-0xFF2E3144,
-0xFF252A3D,
-0xFF0A1121,
-0xFF040C19,
-0xFF09101A,
-0xFF0F0B0C,
-0xFF351D11,
-0xFFA48571,
-0xFF9E826D,
-0xFF9F8670,
-0xFF897459,
-0xFF877255,
-0xFF7D674F,
-0xFF897159,
-0xFF8F7159,
-0xFF816246,
-0xFF6E5133,
-0xFF836644,
-0xFF6C4A27,
-0xFF734F2D,
-0xFF633F1D,
-0xFF775635,
-0xFF634626,
-0xFF593E21,
-0xFF5B3F27,
-0xFF583E27,
-0xFF432F17,
-0xFF432B13,
-0xFF8A664C,
-0xFFDDB59B,
-0xFFC19B84,
-0xFF916852,
-0xFF7A4D36,
-0xFF6F452C,
-0xFF533417,
-0xFF695032,
-0xFF432B13,
-0xFF6C523B,
-0xFF6F533B,
-0xFF765438,
-0xFF795030,
-0xFF714B27,
-0xFF4F3510,
-0xFF4B3510,
-0xFF503C1B,
-0xFF7E6D51,
-0xFF40341A,
-0xFF4A3F2B,
-0xFF302416,
-0xFF44382C,
-0xFF362C20,
-0xFF211809,
-0xFF3E3121,
-0xFF5D4D3D,
-0xFF66513E,
-0xFF7A6854,
-0xFF463926,
-0xFF2A220D,
-0xFF453C2B,
-0xFF32291A,
-0xFF1E180C,
-0xFF372E25,
-0xFF382E24,
-0xFF2C2012,
-0xFF2F2615,
-0xFF312A17,
-0xFF2F2A16,
-0xFF3B3421,
-0xFF2C2010,
-0xFF4B3D30,
-0xFF3B2D20,
-0xFF322618,
-0xFF393021,
-0xFF3E3526,
-0xFF413525,
-0xFF4F4231,
-0xFF41321F,
-0xFF55462F,
-0xFF5D4D33,
-0xFF5B4A2E,
-0xFF503F21,
-0xFF7A694B,
-0xFF5E4F30,
-0xFF635636,
-0xFF554828,
-0xFF483E1B,
-0xFF3C320E,
-0xFF796D47,
-0xFF6B5B39,
-0xFF7A6747,
-0xFF7C644A,
-0xFF685034,
-0xFF6C5C3B,
-0xFF70603C,
-0xFF79633C,
-0xFF836C4A,
-0xFF2F1F05,
-0xFF887557,
-0xFFC5A67A,
-0xFFBA9463,
-0xFF885E34,
-0xFF794F27,
-0xFF845D32,
-0xFF8B6139,
-0xFF7D4F2E,
-0xFF6A3D1E,
-0xFF6D4424,
-0xFF65482A,
-0xFFAA9F8B,
-0xFFEEEEE4,
-0xFFEFEFEF,
-0xFFB7B6B2,
-0xFF4F4734,
-0xFF453921,
-0xFF453825,
-0xFF423626,
-0xFF372D21,
-0xFF3C3427,
-0xFF2D2413,
-0xFF3E1D0E,
-0xFF520200,
-0xFF580300,
-0xFF52271E,
-0xFF4A3405,
-0xFFA48E17,
-0xFFCFBA2D,
-0xFFAD9C2A,
-0xFF504500,
-0xFF65613B,
-0xFF4D4A39,
-0xFF3D3825,
-0xFF262010,
-0xFF313224,
-0xFF262719,
-0xFF403D2E,
-0xFF3E3B2C,
-0xFF29271A,
-0xFF28261A,
-0xFF373028,
-0xFF261D14,
-0xFF342D1D,
-0xFF2F2913,
-0xFF4C4229,
-0xFF675C40,
-0xFF5F5033,
-0xFF584527,
-0xFF614D32,
-0xFF655138,
-0xFF634F34,
-0xFF77664A,
-0xFF5D4F32,
-0xFF4F4428,
-0xFF4A3F29,
-0xFF271E0F,
-0xFF1F140E,
-0xFF1B120D,
-0xFF201D0E,
-0xFF282A15,
-0xFF353823,
-0xFF3B3E29,
-0xFF363928,
-0xFF3D402F,
-0xFF585649,
-0xFF605D4E,
-0xFF645C49,
-0xFF776D54,
-0xFF84795B,
-0xFF786E4B,
-0xFF5D5531,
-0xFF6E6846,
-0xFF423D1F,
-0xFF4A492D,
-0xFF2C2C14,
-0xFF72715D,
-0xFF242311,
-0xFF292718,
-0xFF737164,
-0xFF232114,
-0xFF242112,
-0xFF3D3A29,
-0xFF332E1A,
-0xFF706C53,
-0xFF40391D,
-0xFF544A2F,
-0xFF4A3E24,
-0xFF41321B,
-0xFF51422F,
-0xFF675843,
-0xFF55492F,
-0xFF6C6145,
-0xFF92846A,
-0xFF615138,
-0xFF5B4A2C,
-0xFF574426,
-0xFF614B34,
-0xFF57412A,
-0xFF6F5A3D,
-0xFF675235,
-0xFF513B24,
-0xFF5F4934,
-0xFF443018,
-0xFF5F4D35,
-0xFF503E28,
-0xFF5C4732,
-0xFF4E351F,
-0xFF533920,
-0xFF6E5439,
-0xFF745A3F,
-0xFF896F56,
-0xFF927861,
-0xFFA48A73,
-0xFFA99177,
-0xFF9E8566,
-0xFFC3AC8A,
-0xFF99835E,
-0xFFB59F78,
-0xFF9F8962,
-0xFFB9A37A,
-0xFFB9A477,
-0xFFAA9664,
-0xFF61473A,
-0xFF4F3528,
-0xFF583C30,
-0xFF583C30,
-0xFF61453A,
-0xFF5B3D32,
-0xFF583A2F,
-0xFF68483B,
-0xFF4F2F20,
-0xFF664735,
-0xFF614230,
-0xFF775645,
-0xFF61402F,
-0xFF745042,
-0xFF664234,
-0xFF704C3E,
-0xFF644032,
-0xFF6B4636,
-0xFF6A3E31,
-0xFF704535,
-0xFF76503D,
-0xFF724C37,
-0xFF79533E,
-0xFF87634D,
-0xFF74543D,
-0xFF66432D,
-0xFF7B503D,
-0xFF724331,
-0xFF724530,
-0xFF7F553F,
-0xFF845A42,
-0xFF794F37,
-0xFF835941,
-0xFF865C44,
-0xFF784E36,
-0xFF7B5139,
-0xFF6B4129,
-0xFF6C432D,
-0xFF6B422C,
-0xFF714B34,
-0xFF6A442D,
-0xFF603721,
-0xFF704731,
-0xFF764C36,
-0xFF744A34,
-0xFF6C422C,
-0xFF714731,
-0xFF6F452F,
-0xFF7B513B,
-0xFF774D35,
-0xFF6E442C,
-0xFF744A32,
-0xFF744730,
-0xFF784C33,
-0xFF81533B,
-0xFF76482E,
-0xFF764830,
-0xFF8D6148,
-0xFF7C5239,
-0xFF7C543A,
-0xFF835B41,
-0xFF7A5038,
-0xFF764932,
-0xFF7A4D38,
-0xFF7A4C3D,
-0xFF764B3B,
-0xFF7E5543,
-0xFF7D5440,
-0xFF875C49,
-0xFF815441,
-0xFF724333,
-0xFF8B5C4C,
-0xFF835345,
-0xFF855747,
-0xFF79503A,
-0xFF774F35,
-0xFF79532F,
-0xFF967147,
-0xFF82592D,
-0xFF8F6B39,
-0xFF9F814B,
-0xFFA08A59,
-0xFF9B886A,
-0xFF7F7166,
-0xFF6A6068,
-0xFF4B485B,
-0xFF3A3A54,
-0xFF2D314E,
-0xFF2D324F,
-0xFF2A304A,
-0xFF1E223B,
-0xFF10152B,
-0xFF181D31,
-0xFF41465C,
-0xFF21253E,
-0xFF20243D,
-0xFF1D1F38,
-0xFF191931,
-0xFF09071C,
-0xFF0B0A1A,
-0xFF0C0B19,
-0xFF131521,
-0xFF121622,
-0xFF212330,
-0xFF141321,
-0xFF080003,
-0xFF47291F,
-0xFFA8826F,
-0xFFB7937D,
-0xFF9D7B60,
-0xFFA58667,
-0xFFA17E5E,
-0xFF9E7758,
-0xFFB4886D,
-0xFFAA7B5F,
-0xFF9C6D51,
-0xFFA07354,
-0xFFA47758,
-0xFFA77958,
-0xFF8E603F,
-0xFF704221,
-0xFF784B2C,
-0xFF9F7658,
-0xFF997052,
-0xFF9A7155,
-0xFF9A7155,
-0xFF9E765C,
-0xFF9B7457,
-0xFF9C6F50,
-0xFF9B6C4E,
-0xFFA97B61,
-0xFF8E5F45,
-0xFFA46E54,
-0xFF855031,
-0xFF835031,
-0xFF936446,
-0xFF8C5C45,
-0xFFA97B63,
-0xFF9F7056,
-0xFF8E6142,
-0xFF9B6F4A,
-0xFF856238,
-0xFF6B5428,
-0xFF655228,
-0xFF4A2D0B,
-0xFF725337,
-0xFF70563D,
-0xFF644E37,
-0xFF644D3B,
-0xFF6A5343,
-0xFF442F1E,
-0xFF402B18,
-0xFF57422D,
-0xFF644E37,
-0xFF644B35,
-0xFF463018,
-0xFF524229,
-0xFF362A12,
-0xFF4B4128,
-0xFF4B402A,
-0xFF5D523C,
-0xFF4E422C,
-0xFF54422E,
-0xFF3E2914,
-0xFF45331B,
-0xFF54422A,
-0xFF58472D,
-0xFF5D4930,
-0xFF4D351D,
-0xFF7D654D,
-0xFF472F17,
-0xFF331F07,
-0xFF3C2A12,
-0xFF3B2B12,
-0xFF503E26,
-0xFF553F28,
-0xFF51351F,
-0xFF664830,
-0xFF573921,
-0xFF6F5137,
-0xFF67492F,
-0xFF7F6145,
-0xFF876C4E,
-0xFF937A5B,
-0xFF765E3C,
-0xFF4C3513,
-0xFF5D4624,
-0xFF89714F,
-0xFF846A49,
-0xFFA28567,
-0xFF7C5D40,
-0xFF6D4E32,
-0xFF765C41,
-0xFF5E4527,
-0xFF927150,
-0xFF755431,
-0xFFA78A6C,
-0xFF6F512F,
-0xFF8F693C,
-0xFFC19564,
-0xFF926339,
-0xFF976741,
-0xFF7E502C,
-0xFF906240,
-0xFF936242,
-0xFFA17254,
-0xFF794C2D,
-0xFF7C583E,
-0xFFCDBCA8,
-0xFFFBF4E4,
-0xFFF4EDE3,
-0xFFC8C1B1,
-0xFF65573A,
-0xFF5F4F2D,
-0xFF5B452D,
-0xFF4C331F,
-0xFF3D2314,
-0xFF432C1C,
-0xFF341F0C,
-0xFF401F0E,
-0xFF420600,
-0xFF460A00,
-0xFF472A18,
-0xFF3D2C00,
-0xFFC7AE30,
-0xFFC9AE23,
-0xFFAC9535,
-0xFF433300,
-0xFF676043,
-0xFF3B3829,
-0xFF3D352A,
-0xFF20180D,
-0xFF2D271B,
-0xFF403A2A,
-0xFF5B503C,
-0xFF4B402E,
-0xFF271F12,
-0xFF2E271D,
-0xFF3F362F,
-0xFF241B12,
-0xFF181101,
-0xFF2E2611,
-0xFF594D33,
-0xFF56472A,
-0xFF6B5838,
-0xFF543D1D,
-0xFF644B2D,
-0xFF705739,
-0xFF4D3318,
-0xFF7B6445,
-0xFF5E4B2B,
-0xFF463517,
-0xFF4F4126,
-0xFF31250D,
-0xFF180C00,
-0xFF181101,
-0xFF1D1A09,
-0xFF272612,
-0xFF393B26,
-0xFF32341F,
-0xFF303121,
-0xFF413F30,
-0xFF464034,
-0xFF554B3F,
-0xFF6D604F,
-0xFF897A63,
-0xFF96876A,
-0xFF766949,
-0xFF695E3E,
-0xFF666040,
-0xFF3F3B1E,
-0xFF56543D,
-0xFF201F0D,
-0xFF616155,
-0xFF222218,
-0xFF32322A,
-0xFF74746C,
-0xFF202018,
-0xFF1B180F,
-0xFF333124,
-0xFF312E1B,
-0xFF6F6A54,
-0xFF3D371D,
-0xFF463F23,
-0xFF43391E,
-0xFF3B2F17,
-0xFF584C36,
-0xFF564732,
-0xFF504228,
-0xFF55452B,
-0xFF9E8C74,
-0xFF57432A,
-0xFF564122,
-0xFF654E2E,
-0xFF6C5237,
-0xFF6F5638,
-0xFF896F4C,
-0xFF836742,
-0xFF876A4A,
-0xFF9B7E5E,
-0xFFA58866,
-0xFFA98F6A,
-0xFFAC926F,
-0xFFB99C7A,
-0xFFB79771,
-0xFFC2A07A,
-0xFFC8A882,
-0xFFCAAC86,
-0xFFCAAC88,
-0xFFB89C77,
-0xFFBBA17E,
-0xFFAA926E,
-0xFF96805B,
-0xFFB19D78,
-0xFF715F37,
-0xFF95835B,
-0xFF8F8057,
-0xFF928358,
-0xFF807146,
-0xFF8C7E51,
-0xFF52382B,
-0xFF543A2D,
-0xFF593D31,
-0xFF492D21,
-0xFF5C3E33,
-0xFF624235,
-0xFF523225,
-0xFF4F2E1F,
-0xFF735241,
-0xFF6E4D3A,
-0xFF623F2C,
-0xFF74513E,
-0xFF65422F,
-0xFF73503D,
-0xFF654131,
-0xFF654131,
-0xFF684333,
-0xFF835949,
-0xFF754738,
-0xFF754737,
-0xFF784D3A,
-0xFF8A614D,
-0xFF774E3A,
-0xFF9E7863,
-0xFF7B5842,
-0xFF78553F,
-0xFF704532,
-0xFF885947,
-0xFF7A4D38,
-0xFF90664E,
-0xFF6E462C,
-0xFF875F45,
-0xFF7F573D,
-0xFF956B52,
-0xFF966952,
-0xFF82563D,
-0xFF875942,
-0xFF7D5138,
-0xFF865C43,
-0xFF774F35,
-0xFF886046,
-0xFF7B5138,
-0xFF855940,
-0xFF865840,
-0xFF7E4E37,
-0xFF82543C,
-0xFF80543B,
-0xFF855940,
-0xFF7A4B31,
-0xFF815238,
-0xFF77492F,
-0xFF895B41,
-0xFF794A2E,
-0xFF825035,
-0xFF9C664A,
-0xFF8A5438,
-0xFF925F42,
-0xFF976648,
-0xFF845738,
-0xFF855A3A,
-0xFF885C3F,
-0xFF7A4E31,
-0xFF7C4D31,
-0xFF7D4D36,
-0xFF7C4D3B,
-0xFF744535,
-0xFF805340,
-0xFF82553E,
-0xFF8D5F48,
-0xFF8D5D47,
-0xFF87543F,
-0xFF7B4732,
-0xFF8A5742,
-0xFF885842,
-0xFF83543A,
-0xFF7B4C2E,
-0xFFA57753,
-0xFFA07349,
-0xFF8A6030,
-0xFFB69260,
-0xFF9C834D,
-0xFF7F6D45,
-0xFF6E5E51,
-0xFF352933,
-0xFF362D4A,
-0xFF403C5F,
-0xFF434463,
-0xFF2A2E49,
-0xFF32384E,
-0xFF2E3547,
-0xFF202538,
-0xFF181D30,
-0xFF0C1127,
-0xFF343851,
-0xFF30344F,
-0xFF333754,
-0xFF303150,
-0xFF262743,
-0xFF2A283E,
-0xFF2B2A3A,
-0xFF21202E,
-0xFF1C1C28,
-0xFF222433,
-0xFF201F2F,
-0xFF15111F,
-0xFF0E0002,
-0xFF6D4B3F,
-0xFF91674F,
-0xFFA78063,
-0xFFA37F5F,
-0xFF8C6642,
-0xFF845C38,
-0xFF976646,
-0xFFB37E5E,
-0xFFA56E50,
-0xFF9C6547,
-0xFF8E593A,
-0xFFA06B4C,
-0xFF9A6546,
-0xFF9E694A,
-0xFFAB7859,
-0xFFA16E4F,
-0xFF744325,
-0xFF815234,
-0xFF936446,
-0xFF9A6D4C,
-0xFF815433,
-0xFF8E6140,
-0xFF885736,
-0xFFA37051,
-0xFF6A371A,
-0xFF7D472B,
-0xFFA66B4D,
-0xFF925737,
-0xFF885230,
-0xFF9B6946,
-0xFF895A3C,
-0xFF98694B,
-0xFF8D5C3C,
-0xFF9A6A46,
-0xFF8A5D34,
-0xFF9D7B4D,
-0xFF685223,
-0xFF5F4A1D,
-0xFF704F2C,
-0xFF987356,
-0xFF9F7D61,
-0xFFA38468,
-0xFF9F8169,
-0xFF9D7F67,
-0xFF997A65,
-0xFF9B7D65,
-0xFFA28269,
-0xFF9D7D64,
-0xFF947559,
-0xFF9C7E62,
-0xFF9A8266,
-0xFF907D5F,
-0xFF918064,
-0xFF948365,
-0xFFA99978,
-0xFF917E5E,
-0xFF9B8264,
-0xFF9F8467,
-0xFFA18367,
-0xFF9E8064,
-0xFFB19275,
-0xFFAE8C70,
-0xFFA98467,
-0xFF987152,
-0xFF957151,
-0xFF987756,
-0xFF836646,
-0xFFA18466,
-0xFF9C7D61,
-0xFF9C7A5F,
-0xFFA57D63,
-0xFFA37960,
-0xFFA17960,
-0xFFA77F66,
-0xFFA17C61,
-0xFFAB886A,
-0xFF8B6848,
-0xFFA58461,
-0xFF927450,
-0xFF947652,
-0xFFA38563,
-0xFFA38563,
-0xFFA68564,
-0xFFAC8B6A,
-0xFF9F7C5C,
-0xFF9C7B5A,
-0xFF957A5C,
-0xFF9E8365,
-0xFFB18D6B,
-0xFF97734F,
-0xFFAC8B68,
-0xFFAC8C65,
-0xFF936A3C,
-0xFF9C7240,
-0xFF9B7141,
-0xFF9B7045,
-0xFF976D47,
-0xFF916643,
-0xFF825734,
-0xFF865E3B,
-0xFF8F6847,
-0xFFB19474,
-0xFFA7967C,
-0xFF877D64,
-0xFFA69F85,
-0xFF9A9172,
-0xFF8A7B52,
-0xFF846D44,
-0xFF896A4D,
-0xFF85634A,
-0xFF8C6A51,
-0xFF73533C,
-0xFF704F3C,
-0xFF4B2413,
-0xFF3A0200,
-0xFF461300,
-0xFF59411D,
-0xFF918134,
-0xFFE8D143,
-0xFFD4BA29,
-0xFF78600A,
-0xFF4F3D0D,
-0xFF6D6447,
-0xFF231E0A,
-0xFF393021,
-0xFF2C2314,
-0xFF2F2815,
-0xFF423A25,
-0xFF50442C,
-0xFF443822,
-0xFF32291A,
-0xFF30281D,
-0xFF3D3327,
-0xFF413525,
-0xFF362A14,
-0xFF524429,
-0xFF7B6A4C,
-0xFF614D2A,
-0xFF644C26,
-0xFF5F4520,
-0xFF6A4D2B,
-0xFF654826,
-0xFF593E20,
-0xFF6A4F31,
-0xFF6E5536,
-0xFF756041,
-0xFF6E5B3D,
-0xFF6A593D,
-0xFF584630,
-0xFF31200C,
-0xFF201500,
-0xFF322A15,
-0xFF37321C,
-0xFF383621,
-0xFF393623,
-0xFF383526,
-0xFF2A2418,
-0xFF2B2316,
-0xFF6B5F4F,
-0xFF867762,
-0xFF928268,
-0xFF7D6E4F,
-0xFF6E5F40,
-0xFF776A4A,
-0xFF4B4024,
-0xFF514A30,
-0xFF201907,
-0xFF645E50,
-0xFF251E14,
-0xFF3A3329,
-0xFF756E66,
-0xFF181107,
-0xFF140C01,
-0xFF3B3422,
-0xFF463E27,
-0xFF8A8367,
-0xFF544B2C,
-0xFF3D3212,
-0xFF3F3212,
-0xFF594A2B,
-0xFF756649,
-0xFF867559,
-0xFF928163,
-0xFF9F8C6E,
-0xFFB7A287,
-0xFFB19A7B,
-0xFFA8916F,
-0xFFC3AB87,
-0xFFC9AF8E,
-0xFFC9AF8C,
-0xFFC7AB83,
-0xFFD0B389,
-0xFFCCAF87,
-0xFFC9AC84,
-0xFFCFB286,
-0xFFC9AC80,
-0xFFC8AB81,
-0xFFCCAF85,
-0xFFC4A579,
-0xFFBE9F73,
-0xFF9C7C53,
-0xFF9F8258,
-0xFF977C51,
-0xFFAC9468,
-0xFFA0895F,
-0xFF9E895E,
-0xFF7D6A42,
-0xFF8C7951,
-0xFF503E16,
-0xFF85734B,
-0xFF78673C,
-0xFF837247,
-0xFF79673F,
-0xFF7E6F48,
-0xFF4B3122,
-0xFF4C3223,
-0xFF44281A,
-0xFF482C1E,
-0xFF4A2D1F,
-0xFF523225,
-0xFF4D2C1D,
-0xFF795545,
-0xFF603D2A,
-0xFF54311D,
-0xFF7F5A47,
-0xFF714E3A,
-0xFF4F2C18,
-0xFF724F3B,
-0xFF583522,
-0xFF6E4B38,
-0xFF542F1D,
-0xFF58321F,
-0xFF693E2D,
-0xFF6F4431,
-0xFF744B37,
-0xFF714B36,
-0xFF704A35,
-0xFF66422C,
-0xFF5B3B26,
-0xFF70503B,
-0xFF623925,
-0xFF6F4431,
-0xFF5E351F,
-0xFF805B41,
-0xFF735034,
-0xFF6E4B2D,
-0xFF593417,
-0xFF7D5639,
-0xFF7C4E36,
-0xFF95674D,
-0xFF93634C,
-0xFF8D5F45,
-0xFF855C40,
-0xFF855E41,
-0xFF8C6546,
-0xFF896042,
-0xFF86573B,
-0xFF845237,
-0xFF9B6A4C,
-0xFF966749,
-0xFF76492A,
-0xFF885B3C,
-0xFF905E43,
-0xFF89563B,
-0xFF855436,
-0xFF976648,
-0xFF875435,
-0xFF9B6647,
-0xFF8F5638,
-0xFF9E6547,
-0xFF9D6647,
-0xFFA26D4D,
-0xFF9E704F,
-0xFF845736,
-0xFF986B4A,
-0xFF8E6140,
-0xFF89583A,
-0xFF8B583D,
-0xFF9E6752,
-0xFF89553F,
-0xFF9C6D51,
-0xFF986B4A,
-0xFF8D5C3B,
-0xFFA06E4D,
-0xFF956041,
-0xFF996244,
-0xFF9D6848,
-0xFFA36F4A,
-0xFFA57048,
-0xFFAC774D,
-0xFFA06B41,
-0xFFA27242,
-0xFFAD864D,
-0xFF987B43,
-0xFFCEBB93,
-0xFF615441,
-0xFF22171F,
-0xFF342B48,
-0xFF28234B,
-0xFF212048,
-0xFF161A37,
-0xFF0B1127,
-0xFF242A3A,
-0xFF3E4452,
-0xFF1F2231,
-0xFF191C2D,
-0xFF15172C,
-0xFF3E425D,
-0xFF3F4263,
-0xFF2C3053,
-0xFF303553,
-0xFF252B45,
-0xFF272940,
-0xFF232639,
-0xFF272A3D,
-0xFF2E3144,
-0xFF313447,
-0xFF131426,
-0xFF0A0813,
-0xFF0C0000,
-0xFF896950,
-0xFFA78059,
-0xFFB48E67,
-0xFFBF9974,
-0xFF906845,
-0xFFA67B59,
-0xFFB88766,
-0xFFAE7C59,
-0xFFA46F4F,
-0xFFA67151,
-0xFFA26B4C,
-0xFF9A6344,
-0xFF996244,
-0xFF7F4A2B,
-0xFF986548,
-0xFF865336,
-0xFF623111,
-0xFF805231,
-0xFF996E4C,
-0xFFA57D59,
-0xFF8F6743,
-0xFF916945,
-0xFF9E704E,
-0xFF7C4727,
-0xFF7F4629,
-0xFF8A4D31,
-0xFF985B3C,
-0xFF9C6642,
-0xFFAD8057,
-0xFF937046,
-0xFFA88C64,
-0xFF82663F,
-0xFF9C7953,
-0xFF977049,
-0xFF986E44,
-0xFF795427,
-0xFF7F6437,
-0xFF725A2E,
-0xFF93714C,
-0xFF9A7654,
-0xFFAC8866,
-0xFFA07D5D,
-0xFFA98867,
-0xFF9E7B5B,
-0xFFA27D60,
-0xFFA57E5F,
-0xFFAC8365,
-0xFFB4886B,
-0xFFAC8365,
-0xFF9F7658,
-0xFFA67F60,
-0xFF9B7858,
-0xFFAF916F,
-0xFF8F734E,
-0xFF978057,
-0xFF9B8259,
-0xFFAC8C66,
-0xFFA88462,
-0xFFAB8463,
-0xFFB28969,
-0xFFAA7D5C,
-0xFFB07F5E,
-0xFFBA8563,
-0xFFA06A46,
-0xFFA36F48,
-0xFFAE7D55,
-0xFFB1845D,
-0xFFB38764,
-0xFF9F7150,
-0xFF99684A,
-0xFF8C5E3D,
-0xFFA07251,
-0xFF95684B,
-0xFF996D50,
-0xFF8A6344,
-0xFF896543,
-0xFFA27F59,
-0xFFA07F56,
-0xFF6B4A21,
-0xFFA08059,
-0xFFA68660,
-0xFFB59471,
-0xFFBD9C79,
-0xFFA3835D,
-0xFF9F7F58,
-0xFF94794E,
-0xFF9E895C,
-0xFFA38C62,
-0xFF8E6C47,
-0xFF997752,
-0xFFAD946C,
-0xFF977C51,
-0xFF9B7747,
-0xFF9E7B45,
-0xFFA0884C,
-0xFF816C33,
-0xFF806538,
-0xFF7C5F37,
-0xFF81613A,
-0xFF7D6139,
-0xFF68572B,
-0xFF8C7F53,
-0xFF8C8058,
-0xFF817A50,
-0xFF6F6E3E,
-0xFF6F6937,
-0xFF957F4E,
-0xFF917045,
-0xFF8B6340,
-0xFFA47B5B,
-0xFF997752,
-0xFFA17D5D,
-0xFFA57662,
-0xFF622A1B,
-0xFF591B06,
-0xFF723A17,
-0xFF9B7B3E,
-0xFFCFBC53,
-0xFFE4D32E,
-0xFFF5E345,
-0xFFA08A37,
-0xFF7C673C,
-0xFF9B8E6B,
-0xFF564D2C,
-0xFF5E5335,
-0xFF5A5132,
-0xFF595532,
-0xFF5D5936,
-0xFF5B5437,
-0xFF413A20,
-0xFF3E3725,
-0xFF3F3825,
-0xFF4B3F27,
-0xFF625135,
-0xFF755E3F,
-0xFF6F5532,
-0xFF836A42,
-0xFF705528,
-0xFF8A6E3F,
-0xFF947849,
-0xFFA58A5D,
-0xFF8C7048,
-0xFF80643F,
-0xFF765937,
-0xFF6E5335,
-0xFF7D6244,
-0xFF8B7053,
-0xFF7A5C42,
-0xFF76563F,
-0xFF84664E,
-0xFF795E43,
-0xFF826D50,
-0xFF6A593D,
-0xFF54482E,
-0xFF2F2A14,
-0xFF232210,
-0xFF232416,
-0xFF242215,
-0xFF615E4D,
-0xFF857F69,
-0xFF83785C,
-0xFF685837,
-0xFF6E5A37,
-0xFF78613F,
-0xFF69512F,
-0xFF654E2F,
-0xFF2C1B01,
-0xFF7A6A53,
-0xFF2A1907,
-0xFF41301E,
-0xFF81705E,
-0xFF2F1E0A,
-0xFF4D3D26,
-0xFF96866C,
-0xFFB5A584,
-0xFFC1AF8B,
-0xFFC6B48E,
-0xFFB4A179,
-0xFFC1AB82,
-0xFFCFB88F,
-0xFFD1B993,
-0xFFC5AD87,
-0xFFC9B18B,
-0xFFC8B08A,
-0xFFCAB08D,
-0xFFC7AD88,
-0xFFAA9168,
-0xFFB39B6F,
-0xFFA38A61,
-0xFFB29970,
-0xFF9D8555,
-0xFFA38B5B,
-0xFFB9A173,
-0xFFBEA678,
-0xFFA08858,
-0xFF9A8252,
-0xFF8E7648,
-0xFF90794D,
-0xFF816C3F,
-0xFF5D481D,
-0xFF57411A,
-0xFF4C3911,
-0xFF614E23,
-0xFF826F44,
-0xFF806F41,
-0xFF89784C,
-0xFF6B5830,
-0xFF624E29,
-0xFF49330E,
-0xFF907A53,
-0xFF7B643B,
-0xFF8A7149,
-0xFFB59B78,
-0xFF987E5D,
-0xFF4E3425,
-0xFF4D3324,
-0xFF422618,
-0xFF4A2E20,
-0xFF533326,
-0xFF5A3A2B,
-0xFF4F2E1D,
-0xFF65422F,
-0xFF734E3B,
-0xFF613D27,
-0xFF7C5943,
-0xFF5A3721,
-0xFF573720,
-0xFF76563F,
-0xFF5F3F2A,
-0xFF755540,
-0xFF7A5743,
-0xFF57331D,
-0xFF784F3B,
-0xFF7A513D,
-0xFF67412C,
-0xFF724E38,
-0xFF77533D,
-0xFF67442E,
-0xFF4B2C17,
-0xFF674833,
-0xFF714B36,
-0xFF6F4630,
-0xFF734F35,
-0xFF745236,
-0xFF8E6D4E,
-0xFF644324,
-0xFF896849,
-0xFF6A4528,
-0xFF865A3F,
-0xFF82543A,
-0xFF7B4D33,
-0xFF7F5338,
-0xFF7D5637,
-0xFF9E7A5A,
-0xFF75512F,
-0xFF8F6847,
-0xFF7E4F31,
-0xFF865537,
-0xFF875636,
-0xFF906241,
-0xFF885D3B,
-0xFF835836,
-0xFF714224,
-0xFF905F41,
-0xFF9A674A,
-0xFF8B5839,
-0xFF9B6647,
-0xFF986142,
-0xFF773E20,
-0xFF9B6342,
-0xFF804A28,
-0xFF9E6947,
-0xFF986746,
-0xFF7F512F,
-0xFF8E603E,
-0xFF714322,
-0xFF976948,
-0xFF986749,
-0xFF905A40,
-0xFF834D33,
-0xFF8D5C3C,
-0xFF9B6B47,
-0xFF8E5D35,
-0xFFB37D57,
-0xFFA56F4D,
-0xFF96603E,
-0xFF9E6A42,
-0xFF9F6C3F,
-0xFFB17D4D,
-0xFFB27D4B,
-0xFF9D673B,
-0xFFA17141,
-0xFFA48046,
-0xFF957E4C,
-0xFF796B51,
-0xFF1B1311,
-0xFF292139,
-0xFF3C385D,
-0xFF3E3D69,
-0xFF282A53,
-0xFF151A37,
-0xFF252B41,
-0xFF191F2F,
-0xFF191F2D,
-0xFF030615,
-0xFF0D101F,
-0xFF131629,
-0xFF363A53,
-0xFF2E3154,
-0xFF2C3056,
-0xFF2A2F4F,
-0xFF2D324F,
-0xFF282C45,
-0xFF262B3F,
-0xFF262B3F,
-0xFF282A3F,
-0xFF202237,
-0xFF0A0B1D,
-0xFF07060E,
-0xFF0F0200,
-0xFF846546,
-0xFF9C754A,
-0xFFB69165,
-0xFFA27B52,
-0xFF845936,
-0xFFA97D5A,
-0xFFD3A281,
-0xFFA2704D,
-0xFF9A6A46,
-0xFF92603D,
-0xFFA0694A,
-0xFFA2694B,
-0xFF915A3B,
-0xFF824D2D,
-0xFF986546,
-0xFF835232,
-0xFF815030,
-0xFF744825,
-0xFF8F6944,
-0xFF815E38,
-0xFF7F5D37,
-0xFF89633E,
-0xFF865B38,
-0xFF8A5938,
-0xFF854C2F,
-0xFFA86D4F,
-0xFF9D6745,
-0xFF996C43,
-0xFF806031,
-0xFF735F2D,
-0xFF5D5322,
-0xFF7B6F3F,
-0xFF897145,
-0xFF89683D,
-0xFF9F7D50,
-0xFF68471A,
-0xFF876F41,
-0xFF70592D,
-0xFF674E25,
-0xFF7E603A,
-0xFF6C4C25,
-0xFF92724B,
-0xFF957850,
-0xFFA18158,
-0xFF906D47,
-0xFF8D6541,
-0xFFA27653,
-0xFFAF815F,
-0xFFA67A57,
-0xFF8D613E,
-0xFFA77B58,
-0xFF9C714E,
-0xFF9B7550,
-0xFF927249,
-0xFF816639,
-0xFF927748,
-0xFFAB8A5F,
-0xFFA27C55,
-0xFFA57D59,
-0xFF9E7652,
-0xFFA17550,
-0xFFC1916B,
-0xFFA9754D,
-0xFFBC875D,
-0xFFCF9C6F,
-0xFFA67749,
-0xFFB4895E,
-0xFFA4794F,
-0xFF996B47,
-0xFF996B47,
-0xFFA3784E,
-0xFFA57B53,
-0xFFAA825E,
-0xFF916D49,
-0xFF84623D,
-0xFFC6A981,
-0xFFB4976B,
-0xFF7D6233,
-0xFF775C2D,
-0xFFC7AC7F,
-0xFFAF9469,
-0xFFD3B78F,
-0xFFB79E75,
-0xFF836C40,
-0xFF836D3C,
-0xFF685723,
-0xFF928950,
-0xFF796E36,
-0xFF7E6837,
-0xFF8F774B,
-0xFFA59365,
-0xFFA18F5F,
-0xFF907947,
-0xFF948147,
-0xFF7D7534,
-0xFF706C2C,
-0xFF756C35,
-0xFF6C5E2D,
-0xFF705C2A,
-0xFF917B4A,
-0xFF655021,
-0xFF786336,
-0xFF6E552D,
-0xFF967F55,
-0xFF938554,
-0xFF867541,
-0xFFA37F4F,
-0xFF93673A,
-0xFF865F34,
-0xFF9D7C51,
-0xFF937C4A,
-0xFF9D8056,
-0xFFA5755E,
-0xFF4A0D00,
-0xFF450300,
-0xFF6D3407,
-0xFF967724,
-0xFFD9CA4B,
-0xFFE0D428,
-0xFFE8DB3F,
-0xFF7F6D1B,
-0xFF847347,
-0xFF908859,
-0xFF726E3F,
-0xFF676336,
-0xFF615D30,
-0xFF626131,
-0xFF666537,
-0xFF4D4B24,
-0xFF3F3C19,
-0xFF4B4B29,
-0xFF625F3C,
-0xFF8A8359,
-0xFF8D8255,
-0xFF8A794E,
-0xFF8A7548,
-0xFF7D6937,
-0xFF98844F,
-0xFFAF9C62,
-0xFFAF9C64,
-0xFF9D8954,
-0xFF948250,
-0xFF776537,
-0xFF57441A,
-0xFF544119,
-0xFF68542F,
-0xFF937D58,
-0xFF816947,
-0xFF7D6342,
-0xFF866C4B,
-0xFF88704A,
-0xFF948159,
-0xFF8E8059,
-0xFF726A46,
-0xFF302D0E,
-0xFF25280D,
-0xFF292D16,
-0xFF232710,
-0xFF484A32,
-0xFF6F6E50,
-0xFF6C6642,
-0xFF696037,
-0xFF86774C,
-0xFF867348,
-0xFF735D34,
-0xFF89764E,
-0xFF92825E,
-0xFFC3B592,
-0xFFBCAD8C,
-0xFFB5A687,
-0xFFBAAB8C,
-0xFF9D8E6D,
-0xFFA19370,
-0xFFA79974,
-0xFFB2A37A,
-0xFFA89A6D,
-0xFFA89769,
-0xFF958554,
-0xFFA18F5F,
-0xFF8F7A4B,
-0xFF9C875A,
-0xFFA38E61,
-0xFF998457,
-0xFF968154,
-0xFF958055,
-0xFF897447,
-0xFF806E3E,
-0xFF705E2C,
-0xFF7F6D3D,
-0xFF8F7D4D,
-0xFF93814F,
-0xFF8E7C4A,
-0xFFB5A373,
-0xFFBFAD7F,
-0xFF998757,
-0xFF735E2F,
-0xFF6A5528,
-0xFF5E4B20,
-0xFF5F5027,
-0xFF4C3E17,
-0xFF574926,
-0xFF594B28,
-0xFF61532C,
-0xFF665B2E,
-0xFF706537,
-0xFF6F6236,
-0xFF564720,
-0xFF63512D,
-0xFF64502B,
-0xFF907A53,
-0xFF927B52,
-0xFF765C37,
-0xFF8D7050,
-0xFF8F7254,
-0xFF4F3828,
-0xFF4A3021,
-0xFF563A2C,
-0xFF4D3123,
-0xFF5E3E2F,
-0xFF523223,
-0xFF634231,
-0xFF62412E,
-0xFF5B3824,
-0xFF603D27,
-0xFF6A4A31,
-0xFF63452B,
-0xFF53381D,
-0xFF6E5338,
-0xFF543A21,
-0xFF785C44,
-0xFF4A2C14,
-0xFF604027,
-0xFF79553D,
-0xFF6F4B33,
-0xFF714F36,
-0xFF67472E,
-0xFF714E38,
-0xFF6A4A33,
-0xFF6C503A,
-0xFF654933,
-0xFF66422C,
-0xFF7F5942,
-0xFF815F44,
-0xFF5D3E21,
-0xFF6D5030,
-0xFF806341,
-0xFF6B4E2E,
-0xFF6C4D2E,
-0xFF906B4E,
-0xFF80573B,
-0xFF784C2F,
-0xFF7E5738,
-0xFF81603F,
-0xFF806240,
-0xFF735531,
-0xFF74522F,
-0xFF916646,
-0xFF895A3C,
-0xFF865837,
-0xFF7C4F2E,
-0xFF916B47,
-0xFF7A5634,
-0xFF774E30,
-0xFF6E4225,
-0xFF835438,
-0xFF8C593C,
-0xFF9C664A,
-0xFF875032,
-0xFF915C3D,
-0xFF925D3D,
-0xFF9A6847,
-0xFF8F5D3C,
-0xFF905D3E,
-0xFF815030,
-0xFF875636,
-0xFF825335,
-0xFF946748,
-0xFF996C4D,
-0xFF8C5D41,
-0xFF99684A,
-0xFF82502F,
-0xFF8A5533,
-0xFFA36B46,
-0xFF8D5532,
-0xFF7F4628,
-0xFF9F6A48,
-0xFFA27349,
-0xFFB28657,
-0xFFB68854,
-0xFF9F713D,
-0xFFA07143,
-0xFF895E33,
-0xFFBA986A,
-0xFFB39C7A,
-0xFF332A23,
-0xFF1D1B29,
-0xFF2B2A4A,
-0xFF474670,
-0xFF2A2D56,
-0xFF34385E,
-0xFF343957,
-0xFF1B213B,
-0xFF0E122B,
-0xFF080A1F,
-0xFF040517,
-0xFF000110,
-0xFF00000F,
-0xFF31364A,
-0xFF3D4061,
-0xFF34385E,
-0xFF272B50,
-0xFF282B4C,
-0xFF222641,
-0xFF2F3148,
-0xFF2E3045,
-0xFF28293D,
-0xFF1B1C30,
-0xFF0C0B1B,
-0xFF0F0C13,
-0xFF100100,
-0xFF8B6C4F,
-0xFF987148,
-0xFFA57E53,
-0xFF966C42,
-0xFF9D714A,
-0xFF8F613D,
-0xFFB48362,
-0xFFA57453,
-0xFF986A48,
-0xFF8B5A39,
-0xFF9D6745,
-0xFF945E3C,
-0xFF814C2A,
-0xFF905E3B,
-0xFF8A5A36,
-0xFF956743,
-0xFF936541,
-0xFF9A6F4C,
-0xFF95734D,
-0xFF82653D,
-0xFF896942,
-0xFF8B6944,
-0xFF86603C,
-0xFF774C2A,
-0xFF7C4B2A,
-0xFF9A6A46,
-0xFF936E44,
-0xFF85693A,
-0xFF90804C,
-0xFF8E8952,
-0xFF898C55,
-0xFF7E7C49,
-0xFF827042,
-0xFF998155,
-0xFF94794C,
-0xFF7D6738,
-0xFF827443,
-0xFF5C5221,
-0xFF6D6033,
-0xFF796B3E,
-0xFF5E4C1E,
-0xFF746232,
-0xFF897745,
-0xFF978350,
-0xFF9B7F50,
-0xFF967447,
-0xFFAC855C,
-0xFFA57B53,
-0xFFA57E57,
-0xFFA57E57,
-0xFFB0865E,
-0xFFA37951,
-0xFFA48255,
-0xFFB29365,
-0xFF9E8857,
-0xFFA79160,
-0xFFB99C70,
-0xFFA3835A,
-0xFFA6865D,
-0xFFB99C72,
-0xFFAB8E62,
-0xFFAA8B5D,
-0xFFC2A072,
-0xFF866232,
-0xFFA1814E,
-0xFFAC915C,
-0xFFA58E5C,
-0xFF998352,
-0xFF9E8658,
-0xFF9D8253,
-0xFFAD915F,
-0xFFA78B59,
-0xFF9F8757,
-0xFF776233,
-0xFF837141,
-0xFF897B4A,
-0xFFA69964,
-0xFF8E814C,
-0xFFA29560,
-0xFFBAAD78,
-0xFF9C8F5B,
-0xFFA29463,
-0xFF918551,
-0xFF928952,
-0xFF8A854B,
-0xFF858545,
-0xFF79833E,
-0xFF96A059,
-0xFF919050,
-0xFF958F53,
-0xFFA39E66,
-0xFF9D9A63,
-0xFF85844E,
-0xFF898C53,
-0xFF757F40,
-0xFF6F7A36,
-0xFF929D5B,
-0xFF818344,
-0xFF82763A,
-0xFF977C47,
-0xFF8F6238,
-0xFF86502E,
-0xFF682F14,
-0xFF4C1600,
-0xFF633617,
-0xFF744622,
-0xFF90522B,
-0xFFB1784B,
-0xFF9C7E4C,
-0xFF998E56,
-0xFF8D8D4F,
-0xFF988F58,
-0xFF926B4A,
-0xFF3C0400,
-0xFF460800,
-0xFF885424,
-0xFF9E8622,
-0xFFC4BC33,
-0xFFDFD736,
-0xFFC1B92A,
-0xFF7E7321,
-0xFF87824A,
-0xFF7F8346,
-0xFF878F53,
-0xFF6C7137,
-0xFF636830,
-0xFF7E8349,
-0xFF777A43,
-0xFF61642F,
-0xFF747740,
-0xFF82884C,
-0xFF818749,
-0xFF909457,
-0xFF84884D,
-0xFF858851,
-0xFF7B7C43,
-0xFF7D7E42,
-0xFF828244,
-0xFF8C8C4C,
-0xFF818040,
-0xFF7B793C,
-0xFF88864B,
-0xFF76753C,
-0xFF6B6A32,
-0xFF797842,
-0xFF7A7943,
-0xFF93925C,
-0xFF9A9764,
-0xFF989260,
-0xFF888250,
-0xFF817E4B,
-0xFF868451,
-0xFF8E8E5C,
-0xFF878B59,
-0xFF62683A,
-0xFF6F764A,
-0xFF697148,
-0xFF626940,
-0xFF676C43,
-0xFF777A4D,
-0xFF7C7E4C,
-0xFF71713B,
-0xFF929159,
-0xFF76753D,
-0xFF6E6D37,
-0xFF7D7B48,
-0xFF86854F,
-0xFF979562,
-0xFF858352,
-0xFF858352,
-0xFF848353,
-0xFF6D6C3C,
-0xFF747241,
-0xFF757342,
-0xFF817F4C,
-0xFF75743E,
-0xFF706D36,
-0xFF807D46,
-0xFF716C35,
-0xFF746F38,
-0xFF8B8551,
-0xFF8E8753,
-0xFF827B45,
-0xFF77703A,
-0xFF645F28,
-0xFF68632C,
-0xFF6F6A33,
-0xFF66612A,
-0xFF746E3A,
-0xFF746E3A,
-0xFF928B57,
-0xFF908857,
-0xFFAA9F71,
-0xFF9D9265,
-0xFF7E7147,
-0xFF62532A,
-0xFF64552E,
-0xFF52441F,
-0xFF655B38,
-0xFF766D4E,
-0xFF5B5235,
-0xFF675E3F,
-0xFF5A522E,
-0xFF6F6A42,
-0xFF645F35,
-0xFF575228,
-0xFF5F5730,
-0xFF685F38,
-0xFF695D35,
-0xFF796B44,
-0xFF63542B,
-0xFF68562E,
-0xFF685431,
-0xFF725B3B,
-0xFF523B2B,
-0xFF4D3626,
-0xFF4B3122,
-0xFF503426,
-0xFF4C2F1F,
-0xFF5F4230,
-0xFF684937,
-0xFF52331E,
-0xFF583821,
-0xFF6D4F35,
-0xFF63482B,
-0xFF62492B,
-0xFF533B1F,
-0xFF634E31,
-0xFF6A553A,
-0xFF402B10,
-0xFF553D21,
-0xFF674C31,
-0xFF64442B,
-0xFF65432A,
-0xFF56381E,
-0xFF5A3C22,
-0xFF5C3C25,
-0xFF65472F,
-0xFF6E543D,
-0xFF4B2F19,
-0xFF67432D,
-0xFF7E5A42,
-0xFF624025,
-0xFF614225,
-0xFF765939,
-0xFF846A47,
-0xFF674F2D,
-0xFF775D3C,
-0xFF836243,
-0xFF724D30,
-0xFF7F583B,
-0xFF623F1F,
-0xFF6F5232,
-0xFF836B47,
-0xFF6A502D,
-0xFF896B49,
-0xFF754E2F,
-0xFF865A3D,
-0xFF76492A,
-0xFF855C3C,
-0xFF92704D,
-0xFF755433,
-0xFF684728,
-0xFF815C3F,
-0xFF875B40,
-0xFF7D4E32,
-0xFF905D42,
-0xFF925F42,
-0xFF966547,
-0xFF784727,
-0xFF7C4E2D,
-0xFFA87757,
-0xFF865535,
-0xFF8B5A3A,
-0xFF9B6A4C,
-0xFF835436,
-0xFF7A4F2F,
-0xFF92694B,
-0xFF7E5235,
-0xFF946949,
-0xFFA17956,
-0xFF8C603D,
-0xFFA57352,
-0xFF966141,
-0xFF976243,
-0xFF905F3E,
-0xFF977049,
-0xFF946F42,
-0xFF8A6231,
-0xFFAC804F,
-0xFF845829,
-0xFFC29B72,
-0xFFA28567,
-0xFF736252,
-0xFF18151C,
-0xFF1B1D36,
-0xFF3E4067,
-0xFF404370,
-0xFF353A64,
-0xFF3A3F65,
-0xFF2F3452,
-0xFF333752,
-0xFF383955,
-0xFF31334A,
-0xFF262739,
-0xFF313340,
-0xFF222632,
-0xFF292E42,
-0xFF474C6C,
-0xFF383C62,
-0xFF2D2F56,
-0xFF292C4F,
-0xFF2A2B49,
-0xFF2C2E47,
-0xFF1E1E36,
-0xFF16172B,
-0xFF1B1A2C,
-0xFF0B0916,
-0xFF0B080F,
-0xFF31241C,
-0xFF94795C,
-0xFF937048,
-0xFF9D7A52,
-0xFF876238,
-0xFF81572F,
-0xFF976B44,
-0xFF9E7350,
-0xFF9E7652,
-0xFF86603B,
-0xFFA07A53,
-0xFF8E623D,
-0xFF8A5E37,
-0xFF9A734A,
-0xFF89673A,
-0xFF957346,
-0xFF8F6E41,
-0xFF856238,
-0xFF88693D,
-0xFF725B2F,
-0xFF857345,
-0xFF816C41,
-0xFF70592F,
-0xFF9A8159,
-0xFF81643C,
-0xFF82623B,
-0xFF896C42,
-0xFF7F6D3B,
-0xFF9E955E,
-0xFF828047,
-0xFF868A4F,
-0xFF848F53,
-0xFF5B642B,
-0xFF98925E,
-0xFF948856,
-0xFF8A804D,
-0xFF8E8854,
-0xFF6B6A34,
-0xFF8D8D59,
-0xFF7C7C4A,
-0xFF757340,
-0xFF817A46,
-0xFF6A632D,
-0xFF878049,
-0xFF867D44,
-0xFF92814B,
-0xFF8A733F,
-0xFF917545,
-0xFFAC9061,
-0xFF9F8457,
-0xFFA4895A,
-0xFFA58658,
-0xFFA68A5A,
-0xFFB7A06C,
-0xFF8D7C48,
-0xFF8C7F4B,
-0xFF9A8C5B,
-0xFF715F2F,
-0xFF9C8A5A,
-0xFF918150,
-0xFF9A8C5B,
-0xFF9D915D,
-0xFF908450,
-0xFFA1915D,
-0xFF7A6A36,
-0xFF9D905B,
-0xFF9B925B,
-0xFFA6A169,
-0xFF8E8B54,
-0xFF7F7945,
-0xFF6F6832,
-0xFF94884E,
-0xFF988C52,
-0xFF80773E,
-0xFF837E44,
-0xFF7D7C43,
-0xFF8B8C52,
-0xFF9E9F63,
-0xFF808145,
-0xFFA2A266,
-0xFF9F9F63,
-0xFF8A8950,
-0xFF7E7D44,
-0xFF7F8044,
-0xFF85894C,
-0xFF808948,
-0xFF84914B,
-0xFF7B8B42,
-0xFF8C9C51,
-0xFF919D55,
-0xFF828B48,
-0xFF7A8040,
-0xFF91975B,
-0xFF848F55,
-0xFF78864B,
-0xFF748245,
-0xFF788245,
-0xFF898A4E,
-0xFF807A3E,
-0xFF88793E,
-0xFF573C05,
-0xFF4E1F00,
-0xFF5F2903,
-0xFF663111,
-0xFF4C1B00,
-0xFF3E1300,
-0xFF3C0A00,
-0xFF7C3710,
-0xFF9C5529,
-0xFFB98756,
-0xFFAF965D,
-0xFF949655,
-0xFF89874E,
-0xFF966E4B,
-0xFF4D1300,
-0xFF531D01,
-0xFFA17A41,
-0xFF9F8E22,
-0xFFD1CB3F,
-0xFFB9B31D,
-0xFFA09B19,
-0xFF96943F,
-0xFFA3A566,
-0xFF95A05C,
-0xFF7F8E4B,
-0xFF7D8949,
-0xFF899354,
-0xFF969F60,
-0xFF8B9153,
-0xFF8F9557,
-0xFF8F9855,
-0xFF88944A,
-0xFF879349,
-0xFF7B8642,
-0xFF909C5A,
-0xFF93A261,
-0xFF7E8D4C,
-0xFF8A9654,
-0xFF707D38,
-0xFF848F4B,
-0xFF8C9752,
-0xFF808946,
-0xFF919A57,
-0xFF7E8947,
-0xFF919C5A,
-0xFF9AA465,
-0xFF8C9657,
-0xFF939D5E,
-0xFF9DA667,
-0xFF889152,
-0xFF798145,
-0xFF7F874C,
-0xFF81894E,
-0xFF7F894D,
-0xFF8A9559,
-0xFF839154,
-0xFF97A56A,
-0xFF899660,
-0xFF8A9761,
-0xFF859058,
-0xFF8B965C,
-0xFF7C8647,
-0xFF8A9553,
-0xFF848F4D,
-0xFF6F793A,
-0xFF818C50,
-0xFF7E884B,
-0xFF85904E,
-0xFF7B8441,
-0xFF899253,
-0xFF778142,
-0xFF757F42,
-0xFF858F52,
-0xFF798346,
-0xFF818B4E,
-0xFF8B9357,
-0xFF60682C,
-0xFF7B8445,
-0xFF7F8547,
-0xFF72783C,
-0xFF787E42,
-0xFF7F844A,
-0xFF666B31,
-0xFF82854C,
-0xFF7A7F45,
-0xFF80854B,
-0xFF7C8147,
-0xFF7B8046,
-0xFF666E33,
-0xFF767B43,
-0xFF7A7F49,
-0xFF7F844E,
-0xFF707240,
-0xFFA7A676,
-0xFF848154,
-0xFF767147,
-0xFF645C35,
-0xFF6C643D,
-0xFF645C37,
-0xFF534D2B,
-0xFF676242,
-0xFF625D3D,
-0xFF504C29,
-0xFF605E37,
-0xFF68693F,
-0xFF606135,
-0xFF757748,
-0xFF626337,
-0xFF6C6B3F,
-0xFF504D22,
-0xFF565127,
-0xFF5B542A,
-0xFF635B34,
-0xFF524824,
-0xFF493C19,
-0xFF533D2F,
-0xFF4F382A,
-0xFF3F281A,
-0xFF4C3223,
-0xFF482E1D,
-0xFF6D523F,
-0xFF4F3220,
-0xFF5D412B,
-0xFF5D432A,
-0xFF61472C,
-0xFF6C5536,
-0xFF4F3A1B,
-0xFF655436,
-0xFF4C3D1E,
-0xFF625437,
-0xFF332407,
-0xFF604D2F,
-0xFF80694A,
-0xFF523418,
-0xFF644529,
-0xFF6D4F33,
-0xFF634529,
-0xFF997960,
-0xFF907258,
-0xFF43270F,
-0xFF51351D,
-0xFF75513B,
-0xFF89634C,
-0xFF654127,
-0xFF816245,
-0xFF9C7F5F,
-0xFF7B6140,
-0xFF564221,
-0xFF6F5838,
-0xFF644729,
-0xFF805E42,
-0xFF775438,
-0xFF715233,
-0xFF72593A,
-0xFF7A6341,
-0xFF7C6442,
-0xFF765939,
-0xFF896447,
-0xFF92694D,
-0xFF855C40,
-0xFF6F4A2D,
-0xFF775839,
-0xFF664C2B,
-0xFF523719,
-0xFF7D5E3F,
-0xFF714C2F,
-0xFF7E5537,
-0xFF724528,
-0xFF9E6F51,
-0xFF825536,
-0xFF815435,
-0xFF8B5E3F,
-0xFF906344,
-0xFF8C5D3F,
-0xFF855638,
-0xFF9A6B4F,
-0xFF704326,
-0xFF855C3E,
-0xFF734A2E,
-0xFF885C41,
-0xFF876343,
-0xFF7B653E,
-0xFF634D26,
-0xFF725034,
-0xFF764C33,
-0xFFA17254,
-0xFF855A3A,
-0xFF856745,
-0xFF6A4E29,
-0xFF87643E,
-0xFFA87D53,
-0xFF7E4E20,
-0xFF916946,
-0xFF766257,
-0xFF352E35,
-0xFF131524,
-0xFF222744,
-0xFF4D527C,
-0xFF3D4171,
-0xFF353C6A,
-0xFF3D426A,
-0xFF414663,
-0xFF31364C,
-0xFF2A2C43,
-0xFF242539,
-0xFF302F3F,
-0xFF212330,
-0xFF0A0E1A,
-0xFF1B2034,
-0xFF494D72,
-0xFF373A63,
-0xFF43456B,
-0xFF3B3E61,
-0xFF272A49,
-0xFF2D314C,
-0xFF2D2F48,
-0xFF212237,
-0xFF222133,
-0xFF161620,
-0xFF09080D,
-0xFF61584F,
-0xFF735E41,
-0xFF8E724B,
-0xFF977E56,
-0xFF8B6E46,
-0xFF7D5C33,
-0xFFAE8B63,
-0xFF93734A,
-0xFF94794E,
-0xFF927D50,
-0xFF8C7748,
-0xFF745E2F,
-0xFF816D3B,
-0xFFA99966,
-0xFF9A915A,
-0xFFABA26B,
-0xFF898049,
-0xFF8A7E4A,
-0xFF736934,
-0xFF827C48,
-0xFF686530,
-0xFF847E4C,
-0xFF675F2E,
-0xFF4E4617,
-0xFF8E8657,
-0xFF857F4B,
-0xFF9F9E66,
-0xFF8A9257,
-0xFF7A8648,
-0xFF7B8347,
-0xFF858F50,
-0xFF859556,
-0xFF788849,
-0xFF798347,
-0xFF767F46,
-0xFF7A884D,
-0xFF738247,
-0xFF869157,
-0xFF949F65,
-0xFF7C874F,
-0xFF707942,
-0xFF575A23,
-0xFF74753C,
-0xFF7D8347,
-0xFF7E8245,
-0xFF676228,
-0xFF786F36,
-0xFF857A44,
-0xFF584F18,
-0xFF837E47,
-0xFF908B54,
-0xFF9D9660,
-0xFF817A43,
-0xFF757539,
-0xFF74783D,
-0xFF7E814C,
-0xFF767644,
-0xFF696734,
-0xFF5C5B25,
-0xFF80834C,
-0xFF98A065,
-0xFF576125,
-0xFF6E783C,
-0xFF61662E,
-0xFF7C8149,
-0xFF697138,
-0xFF6B763C,
-0xFF6A783D,
-0xFF87955A,
-0xFF818C52,
-0xFF586024,
-0xFF6F7034,
-0xFF7A7C3D,
-0xFF909754,
-0xFF8A9551,
-0xFF707F3C,
-0xFF7C8D49,
-0xFF6C7C3B,
-0xFF8C9A5C,
-0xFF6E7A3C,
-0xFFA2AE6E,
-0xFF677230,
-0xFF788442,
-0xFF64732E,
-0xFF7F904A,
-0xFF849853,
-0xFF8EA25B,
-0xFF8C9953,
-0xFF86934D,
-0xFF778842,
-0xFF94A561,
-0xFF697837,
-0xFF98A466,
-0xFF919B5E,
-0xFF6C763A,
-0xFF636C35,
-0xFF7B7543,
-0xFF815F39,
-0xFF5B310B,
-0xFF5C3B10,
-0xFF533908,
-0xFF907A41,
-0xFF9F8F54,
-0xFF878049,
-0xFF98935C,
-0xFF928B54,
-0xFF937A44,
-0xFF945728,
-0xFF7F2B00,
-0xFFAB451D,
-0xFFB16237,
-0xFF9F8F54,
-0xFF857E4A,
-0xFF743E24,
-0xFF4D0F00,
-0xFF3F1900,
-0xFFA4904B,
-0xFFA19527,
-0xFFC9C03D,
-0xFFD8D14C,
-0xFF8C8A13,
-0xFF878935,
-0xFF959C59,
-0xFF879653,
-0xFF7D8D4C,
-0xFF758544,
-0xFF788744,
-0xFF909B59,
-0xFF949D5C,
-0xFF8E9955,
-0xFF818C47,
-0xFF849149,
-0xFF91A15A,
-0xFF788649,
-0xFF808E51,
-0xFF899A56,
-0xFF8C9D56,
-0xFF889952,
-0xFF879651,
-0xFF909D58,
-0xFF8E9B56,
-0xFF919E58,
-0xFF8A9751,
-0xFF8F9F58,
-0xFF91A158,
-0xFF8F9F58,
-0xFF889752,
-0xFF93A05B,
-0xFF97A361,
-0xFF788341,
-0xFF778142,
-0xFF778144,
-0xFF798547,
-0xFF879653,
-0xFF7A8B45,
-0xFF6C8039,
-0xFF788D48,
-0xFF859A55,
-0xFF7C914E,
-0xFF6B803B,
-0xFF70843D,
-0xFF7D8E47,
-0xFF819349,
-0xFF687831,
-0xFF768540,
-0xFF839251,
-0xFF6E7D3C,
-0xFF819148,
-0xFF94A557,
-0xFF87974E,
-0xFF7F9147,
-0xFF72833C,
-0xFF7D8E48,
-0xFF72833D,
-0xFF7C8D47,
-0xFF8B9A55,
-0xFF74833E,
-0xFF606F2C,
-0xFF6E7A38,
-0xFF717D3D,
-0xFF798545,
-0xFF6C783A,
-0xFF5C672B,
-0xFF7E8B53,
-0xFF6B7842,
-0xFF74814B,
-0xFF6D7C45,
-0xFF7D8C55,
-0xFF586A30,
-0xFF637239,
-0xFF606F36,
-0xFF697841,
-0xFF6A7741,
-0xFF6E7844,
-0xFF5E6633,
-0xFF5B6131,
-0xFF777A4D,
-0xFF7B7E51,
-0xFF515226,
-0xFF5D5E32,
-0xFF59582C,
-0xFF4D4F20,
-0xFF686A39,
-0xFF888C5A,
-0xFF787F4C,
-0xFF7B8350,
-0xFF6E7843,
-0xFF68723D,
-0xFF59632E,
-0xFF68703F,
-0xFF545C2D,
-0xFF666C40,
-0xFF898E65,
-0xFF757750,
-0xFF80825B,
-0xFF7C695A,
-0xFF311E0F,
-0xFF543E30,
-0xFF4C3726,
-0xFF4B3422,
-0xFF4F3924,
-0xFF5E4531,
-0xFF58422A,
-0xFF554025,
-0xFF665335,
-0xFF6E5E3D,
-0xFF5E4F2E,
-0xFF675C3C,
-0xFF605736,
-0xFF585232,
-0xFF574E2F,
-0xFF5E5131,
-0xFF786847,
-0xFF675031,
-0xFF594022,
-0xFF553E1F,
-0xFF61482A,
-0xFF81664B,
-0xFF5A4025,
-0xFF584026,
-0xFF6E543B,
-0xFF65422C,
-0xFF67442E,
-0xFF7B5B42,
-0xFF56381C,
-0xFF9A7F61,
-0xFF7E6747,
-0xFF5D4A29,
-0xFF6E5B3A,
-0xFF775C3E,
-0xFF715436,
-0xFF624326,
-0xFF705335,
-0xFF7D6647,
-0xFF766241,
-0xFF9D8869,
-0xFF563D1E,
-0xFF7F5D42,
-0xFF785539,
-0xFF6F4A30,
-0xFFA07E62,
-0xFF5B4023,
-0xFF574020,
-0xFF604929,
-0xFF6D5234,
-0xFF745536,
-0xFF7F5C3C,
-0xFF7B5435,
-0xFF986F4F,
-0xFF805737,
-0xFF7A5131,
-0xFF8B6040,
-0xFF784D2D,
-0xFF774C2C,
-0xFF956A4A,
-0xFF8C6345,
-0xFF8C6345,
-0xFF7E573A,
-0xFF754E31,
-0xFF7D5639,
-0xFF886A48,
-0xFF6F6037,
-0xFF786A43,
-0xFF2A1000,
-0xFF947559,
-0xFF846040,
-0xFF82613E,
-0xFF836F4E,
-0xFF624F2E,
-0xFF785E3B,
-0xFF7D5D37,
-0xFF704E21,
-0xFFA78A6C,
-0xFF665B5F,
-0xFF1E1F34,
-0xFF0B1127,
-0xFF464C6C,
-0xFF454C78,
-0xFF3D4375,
-0xFF3D4472,
-0xFF24294F,
-0xFF070D27,
-0xFF010619,
-0xFF000011,
-0xFF00010E,
-0xFF02020E,
-0xFF02020E,
-0xFF00000E,
-0xFF2F334C,
-0xFF45496F,
-0xFF3E426F,
-0xFF363A60,
-0xFF45496C,
-0xFF3D4260,
-0xFF191E3B,
-0xFF292D46,
-0xFF36384D,
-0xFF2D2F3E,
-0xFF252831,
-0xFF161719,
-0xFF3D3B2F,
-0xFF66583D,
-0xFF9A8864,
-0xFF8D7E57,
-0xFF76643C,
-0xFF7D663C,
-0xFFAB9367,
-0xFF917C4F,
-0xFF8B7D4E,
-0xFF988E5D,
-0xFF88814D,
-0xFF766F3B,
-0xFF89834F,
-0xFF7F7F49,
-0xFFAFB47A,
-0xFF798146,
-0xFFA7AC72,
-0xFF94975E,
-0xFF777A41,
-0xFF767E43,
-0xFF767E43,
-0xFF6B7038,
-0xFF8E915A,
-0xFF2F3100,
-0xFF6C703D,
-0xFF626A31,
-0xFF737E42,
-0xFF819355,
-0xFF4D5F21,
-0xFF717D3F,
-0xFF778345,
-0xFF6F7F40,
-0xFF7F9252,
-0xFF6B7D3F,
-0xFF6C8043,
-0xFF61793D,
-0xFF677C41,
-0xFF68763B,
-0xFF515C22,
-0xFF7B8850,
-0xFF8D9A64,
-0xFF525B24,
-0xFF818950,
-0xFF7A8447,
-0xFF7F894C,
-0xFF7B7F44,
-0xFF7F8046,
-0xFF7B7C42,
-0xFF797D42,
-0xFF878F54,
-0xFF788246,
-0xFF60682C,
-0xFF586225,
-0xFF515F21,
-0xFF516123,
-0xFF3E4B13,
-0xFF57612C,
-0xFF8E9760,
-0xFF454E15,
-0xFF4C5C1E,
-0xFF617536,
-0xFF4B6121,
-0xFF738949,
-0xFF86985E,
-0xFF49581F,
-0xFF54652E,
-0xFF73844D,
-0xFF81955A,
-0xFFA5B77B,
-0xFF576528,
-0xFF687436,
-0xFF626C2D,
-0xFF737F3D,
-0xFF7D8E48,
-0xFF677B33,
-0xFF778D45,
-0xFF819852,
-0xFF5D7332,
-0xFF788E4D,
-0xFF708244,
-0xFF8DA060,
-0xFF6B7C38,
-0xFF70843D,
-0xFF768A42,
-0xFF6E843C,
-0xFF859C56,
-0xFF748946,
-0xFF6C7838,
-0xFF939F5F,
-0xFF6B7E3E,
-0xFF687D3C,
-0xFF677A3A,
-0xFF758345,
-0xFF979C62,
-0xFF7E7D47,
-0xFF736C3E,
-0xFF4E3811,
-0xFF431600,
-0xFF411300,
-0xFF7A5A34,
-0xFF736133,
-0xFF8C834A,
-0xFFADAF6E,
-0xFF9AA563,
-0xFF838F47,
-0xFF8F9444,
-0xFF64580C,
-0xFFAB8345,
-0xFFC7794B,
-0xFFB73C1B,
-0xFFB24423,
-0xFF9F7744,
-0xFF988251,
-0xFF642A14,
-0xFF450B00,
-0xFF523708,
-0xFFAB9F55,
-0xFF928419,
-0xFFAB9F25,
-0xFFB1AB33,
-0xFF76740D,
-0xFF636619,
-0xFF8F9859,
-0xFF869155,
-0xFF6E7E3F,
-0xFF7D8E4A,
-0xFF85944F,
-0xFF808B49,
-0xFFA0AB67,
-0xFF84914C,
-0xFF899952,
-0xFF9DAC67,
-0xFF8A9956,
-0xFF768447,
-0xFF6F7D3F,
-0xFF94A45B,
-0xFF98A85D,
-0xFF8F9F56,
-0xFF899952,
-0xFF7D8C47,
-0xFF798843,
-0xFF8C9C55,
-0xFF8B9D53,
-0xFF8B9D51,
-0xFF8A9C50,
-0xFFA5B76D,
-0xFF7F9049,
-0xFF8A9954,
-0xFF838F4D,
-0xFF70793A,
-0xFF757E3F,
-0xFF8A9457,
-0xFF7D8949,
-0xFF6D7C37,
-0xFF7F9049,
-0xFF758941,
-0xFF7F934B,
-0xFF7A9047,
-0xFF7B9149,
-0xFF798D46,
-0xFF798D45,
-0xFF93A85D,
-0xFF738539,
-0xFF798B41,
-0xFF80914A,
-0xFF758544,
-0xFF70813D,
-0xFF82944A,
-0xFF95A859,
-0xFF889D50,
-0xFF758A3F,
-0xFF82964E,
-0xFF9AAE66,
-0xFF71853E,
-0xFF7B8F48,
-0xFF899D56,
-0xFF899D56,
-0xFF98A965,
-0xFF839450,
-0xFF768743,
-0xFF788945,
-0xFF6D7D3C,
-0xFF7C8C4E,
-0xFF5F6E37,
-0xFF30410B,
-0xFF677842,
-0xFF576A33,
-0xFF60733C,
-0xFF8A9F66,
-0xFF596E33,
-0xFF5B7035,
-0xFF50652C,
-0xFF6D8048,
-0xFF61753A,
-0xFF43551B,
-0xFF6B7A43,
-0xFF74824D,
-0xFF67743F,
-0xFF727C48,
-0xFF5B642F,
-0xFF69723B,
-0xFF596327,
-0xFF788347,
-0xFF69743A,
-0xFF69763E,
-0xFF6E7D44,
-0xFF627138,
-0xFF617337,
-0xFF55672D,
-0xFF576530,
-0xFF606E3D,
-0xFF455025,
-0xFF515C32,
-0xFF636B42,
-0xFF6B734A,
-0xFF544333,
-0xFF655444,
-0xFF3D2C1A,
-0xFF6C5B49,
-0xFF412F1B,
-0xFF705E48,
-0xFF4D3B25,
-0xFF45341A,
-0xFF5F5033,
-0xFF615434,
-0xFF534926,
-0xFF6C6440,
-0xFF554F2D,
-0xFF5D5936,
-0xFF656241,
-0xFF4D4A29,
-0xFF383210,
-0xFF908766,
-0xFF554625,
-0xFF8F7F5E,
-0xFF4E3F1E,
-0xFF655534,
-0xFF6C593B,
-0xFF968365,
-0xFF49381C,
-0xFF443317,
-0xFF785E45,
-0xFF62462E,
-0xFF5D4328,
-0xFF5B4627,
-0xFF887555,
-0xFF443413,
-0xFF6D5D3C,
-0xFF5A4727,
-0xFF6C5536,
-0xFF9B8063,
-0xFF896B4F,
-0xFF6A5133,
-0xFF7C674A,
-0xFF917E5E,
-0xFF6D5A3C,
-0xFF685132,
-0xFF70553A,
-0xFF735539,
-0xFF75553C,
-0xFF6E5336,
-0xFF61492D,
-0xFF5E492A,
-0xFF4D3918,
-0xFF685131,
-0xFF7D6543,
-0xFF886E4B,
-0xFF795B39,
-0xFF896744,
-0xFF795231,
-0xFF7A5430,
-0xFF8D6542,
-0xFF643E1A,
-0xFF724E2C,
-0xFF8C6A47,
-0xFF815E3E,
-0xFF987557,
-0xFF7D583D,
-0xFF9D785B,
-0xFF8C6E4C,
-0xFF7B623A,
-0xFF766037,
-0xFF8A744D,
-0xFF684F30,
-0xFF8F7657,
-0xFF745E39,
-0xFF75633D,
-0xFF584C26,
-0xFF655B37,
-0xFF6D643D,
-0xFF4E471D,
-0xFF69643A,
-0xFF727057,
-0xFF2B2D39,
-0xFF1F2441,
-0xFF1C2340,
-0xFF474D6F,
-0xFF414874,
-0xFF3F4674,
-0xFF1F2650,
-0xFF141A3A,
-0xFF1F2639,
-0xFF1D232F,
-0xFF1B1E27,
-0xFF0C0C14,
-0xFF05040C,
-0xFF00000C,
-0xFF000010,
-0xFF414562,
-0xFF525582,
-0xFF3D4171,
-0xFF393E66,
-0xFF373D5F,
-0xFF37405D,
-0xFF414B64,
-0xFF232B40,
-0xFF080F1F,
-0xFF151C26,
-0xFF2C3137,
-0xFF11191B,
-0xFF3A3D34,
-0xFF6E6850,
-0xFF453C1B,
-0xFF57512D,
-0xFF645F37,
-0xFF73683B,
-0xFF8B7F4F,
-0xFF887E4D,
-0xFF6C6634,
-0xFF918F5C,
-0xFF575725,
-0xFF848452,
-0xFF757745,
-0xFF6A713D,
-0xFF5D6631,
-0xFF7D8752,
-0xFF6C7641,
-0xFF58612A,
-0xFF67723A,
-0xFF6D783E,
-0xFF919F64,
-0xFF545F23,
-0xFF7D864D,
-0xFF5E6532,
-0xFF5B622F,
-0xFF767D47,
-0xFF6C753C,
-0xFF919F64,
-0xFF5A682D,
-0xFF6A733C,
-0xFF495219,
-0xFF6D783E,
-0xFF57662B,
-0xFF7A8C52,
-0xFF52652D,
-0xFF4C5F28,
-0xFF32410A,
-0xFF7D804B,
-0xFF797C47,
-0xFF68713C,
-0xFF56632D,
-0xFF848D56,
-0xFF535C23,
-0xFF4B561C,
-0xFF6B7539,
-0xFF586025,
-0xFF6A6F35,
-0xFF74793F,
-0xFF798347,
-0xFF6D7B3E,
-0xFF4A5A1C,
-0xFF6B7B3D,
-0xFF758749,
-0xFF748A4A,
-0xFF809656,
-0xFF64783D,
-0xFF4B5A23,
-0xFF728045,
-0xFF97A769,
-0xFF6D8241,
-0xFF718746,
-0xFF7F9856,
-0xFF637939,
-0xFF697B41,
-0xFF7D8C55,
-0xFF4E5B26,
-0xFF636D38,
-0xFF747F47,
-0xFF838C53,
-0xFF92955C,
-0xFF5B6125,
-0xFF5C682A,
-0xFF758544,
-0xFF6B7F3A,
-0xFF829850,
-0xFFB8CF87,
-0xFF607731,
-0xFF708645,
-0xFF526828,
-0xFF798B4F,
-0xFF7B8E4E,
-0xFF7F934E,
-0xFF738740,
-0xFF778B44,
-0xFF819651,
-0xFF798E4B,
-0xFF637539,
-0xFF67743E,
-0xFF515E29,
-0xFF6E7D42,
-0xFF66783A,
-0xFF879A5A,
-0xFF6C763A,
-0xFF968E5D,
-0xFF7D6740,
-0xFF442506,
-0xFF361300,
-0xFF543811,
-0xFF927D52,
-0xFF6C6134,
-0xFF9B976A,
-0xFF807E4E,
-0xFF8E8E58,
-0xFF8B8D4C,
-0xFF858734,
-0xFFFBF78B,
-0xFFF1E97E,
-0xFF8E8334,
-0xFF9C6D39,
-0xFFCA583D,
-0xFFAD351C,
-0xFFA25E31,
-0xFFC99A6E,
-0xFF4C1200,
-0xFF350500,
-0xFF6E5829,
-0xFF9D8F46,
-0xFFA58F2A,
-0xFF9D8919,
-0xFF7F760F,
-0xFFA2A049,
-0xFF8D8D4D,
-0xFF828653,
-0xFF838A56,
-0xFF788148,
-0xFF899651,
-0xFF9BA661,
-0xFF949D5A,
-0xFF8C9753,
-0xFF81904B,
-0xFF778844,
-0xFF627130,
-0xFF849050,
-0xFF899450,
-0xFF89954B,
-0xFF95A253,
-0xFF9BA859,
-0xFF939F55,
-0xFF8C9953,
-0xFF94A35E,
-0xFF83924D,
-0xFF7E8F48,
-0xFF90A55A,
-0xFF7F9447,
-0xFFA3B86D,
-0xFF7B8C45,
-0xFF5F6E29,
-0xFF6B7737,
-0xFF6A7236,
-0xFF696C33,
-0xFF797C43,
-0xFF6B7538,
-0xFF7B8747,
-0xFF788442,
-0xFF7D8A44,
-0xFF6B7832,
-0xFF929F59,
-0xFF677331,
-0xFF6E7A38,
-0xFF6F7B39,
-0xFF73803B,
-0xFF808D47,
-0xFF748139,
-0xFF818E48,
-0xFF71803B,
-0xFF8C9B58,
-0xFF869554,
-0xFF8E9F5B,
-0xFF859650,
-0xFF879854,
-0xFF869753,
-0xFF8D9D5C,
-0xFF92A261,
-0xFF728241,
-0xFF889857,
-0xFF5E712F,
-0xFF788B49,
-0xFF657534,
-0xFF8B9B5A,
-0xFF99A968,
-0xFF596928,
-0xFF647433,
-0xFF6B7B3D,
-0xFF5C6B34,
-0xFF36440F,
-0xFF606F38,
-0xFF60713A,
-0xFF485B23,
-0xFF6A7E43,
-0xFF677D3F,
-0xFF5F7535,
-0xFF607638,
-0xFF61793B,
-0xFF506928,
-0xFF6A8342,
-0xFF7C9254,
-0xFF74894E,
-0xFF697D40,
-0xFF64783B,
-0xFF6C8043,
-0xFF75894A,
-0xFF4D621F,
-0xFF879C57,
-0xFF4A5F1E,
-0xFF748849,
-0xFF81965B,
-0xFF53682D,
-0xFF536728,
-0xFF54682B,
-0xFF5F7039,
-0xFF5C6C3B,
-0xFF536034,
-0xFF4D5A2F,
-0xFF616C42,
-0xFF657045,
-0xFF4F4231,
-0xFF433623,
-0xFF544734,
-0xFF473B25,
-0xFF53442F,
-0xFF473821,
-0xFF44361C,
-0xFF4B4024,
-0xFF4F4625,
-0xFF5B532F,
-0xFF79734F,
-0xFF3C3813,
-0xFF63603D,
-0xFF565330,
-0xFF81815F,
-0xFF424220,
-0xFF3B3C1A,
-0xFF7C7C58,
-0xFF595331,
-0xFF605834,
-0xFF615935,
-0xFF605834,
-0xFF746949,
-0xFF7C7151,
-0xFF3F3617,
-0xFF413618,
-0xFF655438,
-0xFF604C31,
-0xFF5E4F32,
-0xFF675A3A,
-0xFF8B8060,
-0xFF665C39,
-0xFF706343,
-0xFF615231,
-0xFF604D2F,
-0xFF887054,
-0xFF755D41,
-0xFF574225,
-0xFF514022,
-0xFF5A4B2C,
-0xFF5B4A2C,
-0xFF928163,
-0xFF6A5538,
-0xFF634B2F,
-0xFF897155,
-0xFF756041,
-0xFF59482A,
-0xFF564625,
-0xFF8E7E5D,
-0xFF6D5A39,
-0xFF5A4A26,
-0xFF66542E,
-0xFF7B6540,
-0xFF755B36,
-0xFF6E502C,
-0xFF8B6B45,
-0xFF896845,
-0xFF8A6C48,
-0xFF795F3A,
-0xFF806844,
-0xFF5C4221,
-0xFF73583A,
-0xFF815F44,
-0xFF98795C,
-0xFF927C57,
-0xFF7F6D45,
-0xFF76643C,
-0xFF8A7B52,
-0xFF978964,
-0xFF5A502C,
-0xFF514922,
-0xFF78734B,
-0xFF706843,
-0xFF9C9771,
-0xFF96946D,
-0xFF2D2F0A,
-0xFF5D6445,
-0xFF586257,
-0xFF282F41,
-0xFF191F41,
-0xFF222848,
-0xFF454B6D,
-0xFF42476F,
-0xFF2D355C,
-0xFF242A4E,
-0xFF2C334F,
-0xFF303548,
-0xFF202430,
-0xFF191923,
-0xFF1C1C24,
-0xFF1D1C24,
-0xFF1D1D27,
-0xFF000012,
-0xFF4A4E6B,
-0xFF565986,
-0xFF424675,
-0xFF393E64,
-0xFF303656,
-0xFF222C47,
-0xFF1B223C,
-0xFF050B21,
-0xFF080D20,
-0xFF2F333F,
-0xFF0F141A,
-0xFF040C0E,
-0xFF090F05,
-0xFF7D7B62,
-0xFF54512E,
-0xFF555732,
-0xFF676840,
-0xFFA8A57A,
-0xFF8A8657,
-0xFF727040,
-0xFF80804E,
-0xFF5D5F2E,
-0xFF777B49,
-0xFF8B8E5F,
-0xFF4E5424,
-0xFF7A8253,
-0xFF565F30,
-0xFF434F1F,
-0xFF74804E,
-0xFF798651,
-0xFF55622C,
-0xFF6C7B42,
-0xFF7F8E55,
-0xFF68773C,
-0xFF606D35,
-0xFF8F9967,
-0xFF7B8352,
-0xFF414A15,
-0xFF505922,
-0xFF67743E,
-0xFF7C8953,
-0xFF6A7440,
-0xFF555F2A,
-0xFF707942,
-0xFF626D35,
-0xFF66733D,
-0xFF6F7D48,
-0xFF778552,
-0xFF485220,
-0xFF656735,
-0xFF747742,
-0xFF58612A,
-0xFF667139,
-0xFFB4BF87,
-0xFF5A632C,
-0xFF434C15,
-0xFF414A13,
-0xFF525923,
-0xFF596128,
-0xFF7D854A,
-0xFF677236,
-0xFF647436,
-0xFF627436,
-0xFF687A3C,
-0xFF4B5F20,
-0xFF6B8141,
-0xFF556B2D,
-0xFF718349,
-0xFF859459,
-0xFF687639,
-0xFF576728,
-0xFF677C3B,
-0xFF657C38,
-0xFF799250,
-0xFF748A4A,
-0xFF83955B,
-0xFF5F6C36,
-0xFF87915C,
-0xFF6D7641,
-0xFF778049,
-0xFF80884F,
-0xFF83844B,
-0xFFA1A46B,
-0xFF646F33,
-0xFF94A668,
-0xFF8A9D5B,
-0xFF6D813C,
-0xFF778C47,
-0xFF8FA461,
-0xFF748849,
-0xFF7F9155,
-0xFF56682C,
-0xFF425416,
-0xFF80904F,
-0xFF7D8E4A,
-0xFF879854,
-0xFF849453,
-0xFF859557,
-0xFF68773E,
-0xFF454F1D,
-0xFF4D5325,
-0xFF595828,
-0xFF7A7744,
-0xFF817E47,
-0xFF837544,
-0xFF95714D,
-0xFF68391D,
-0xFF471500,
-0xFF764D2F,
-0xFF655428,
-0xFF74713E,
-0xFF828153,
-0xFF696A3E,
-0xFF6E6F45,
-0xFF7A7949,
-0xFF817B3D,
-0xFFDCD483,
-0xFFE0D267,
-0xFFEBDE75,
-0xFFB5AF61,
-0xFF825F29,
-0xFFB74F32,
-0xFFB64229,
-0xFFC2744E,
-0xFFAC724D,
-0xFF440B00,
-0xFF330600,
-0xFF90804F,
-0xFF898139,
-0xFFB39E43,
-0xFFAA9431,
-0xFF6D6206,
-0xFF999443,
-0xFF949456,
-0xFF9FA26D,
-0xFF7C804D,
-0xFF8B9358,
-0xFF9EA965,
-0xFF858F4A,
-0xFF818646,
-0xFF858B4D,
-0xFF828E4C,
-0xFF7D8C49,
-0xFF444F13,
-0xFFB9C386,
-0xFF8E9954,
-0xFF818D41,
-0xFF9DA85C,
-0xFFA0AA61,
-0xFF87924D,
-0xFF8F9A56,
-0xFFA3AF6F,
-0xFF7D8947,
-0xFF74843D,
-0xFF85974D,
-0xFF62742A,
-0xFF899B51,
-0xFF6C7B36,
-0xFF727E3C,
-0xFF7F894C,
-0xFF8B9358,
-0xFF7C7F48,
-0xFF6D723A,
-0xFF767F46,
-0xFF758044,
-0xFF818D4D,
-0xFF6A7533,
-0xFF767F3C,
-0xFF757E3B,
-0xFF828B4A,
-0xFF70793A,
-0xFF7F8849,
-0xFF737E3C,
-0xFF86914D,
-0xFF919E58,
-0xFF98A560,
-0xFF81904D,
-0xFF7A8948,
-0xFF808E50,
-0xFF8A9958,
-0xFF758443,
-0xFF94A362,
-0xFF7D8C4B,
-0xFF798847,
-0xFF92A160,
-0xFF8C9B5A,
-0xFF778645,
-0xFF6A7A39,
-0xFF657534,
-0xFF7E8D4C,
-0xFF73823F,
-0xFF849350,
-0xFF697833,
-0xFF7E8D48,
-0xFF728140,
-0xFF7C8B50,
-0xFF707F46,
-0xFF849358,
-0xFF819357,
-0xFF596B31,
-0xFF697D40,
-0xFF627736,
-0xFF718844,
-0xFF718747,
-0xFF455B1B,
-0xFF617736,
-0xFF657E3C,
-0xFF8EA464,
-0xFF607638,
-0xFF506628,
-0xFF647A3A,
-0xFF73894B,
-0xFF728B4A,
-0xFF6A833F,
-0xFF738C48,
-0xFF566C2B,
-0xFF4A6022,
-0xFF475C21,
-0xFF50652A,
-0xFF657B3D,
-0xFF607437,
-0xFF53662E,
-0xFF32430F,
-0xFF4C5C2F,
-0xFF48572C,
-0xFF6B784C,
-0xFF3D4A1C,
-0xFF342E18,
-0xFF554F37,
-0xFF3C341D,
-0xFF423A23,
-0xFF433B24,
-0xFF575036,
-0xFF4A4326,
-0xFF645E3E,
-0xFF5D5936,
-0xFF5F5B36,
-0xFF625E39,
-0xFF494720,
-0xFF43411B,
-0xFF51512D,
-0xFF3C3C1A,
-0xFF686947,
-0xFF2F3712,
-0xFF5B633E,
-0xFF60623D,
-0xFF4A4A26,
-0xFF6C6C46,
-0xFF787852,
-0xFF6E6C46,
-0xFF4F4D27,
-0xFF484824,
-0xFF474421,
-0xFF5D5435,
-0xFF5C5334,
-0xFF4B4626,
-0xFF474423,
-0xFF6A6A48,
-0xFF716E4B,
-0xFF565030,
-0xFF7C7151,
-0xFF68593C,
-0xFF67563A,
-0xFF9C8B6F,
-0xFF4E3F22,
-0xFF554828,
-0xFF534828,
-0xFF605633,
-0xFF4E4421,
-0xFFA59876,
-0xFF413412,
-0xFF6D603E,
-0xFF756845,
-0xFF6B633F,
-0xFF6F6743,
-0xFF847755,
-0xFF756845,
-0xFF716743,
-0xFF615831,
-0xFF71633E,
-0xFF71623B,
-0xFF6B5732,
-0xFFA69069,
-0xFFA58F6A,
-0xFF75613C,
-0xFFA0906C,
-0xFF7A6C49,
-0xFF493918,
-0xFF342403,
-0xFF5A4226,
-0xFF897658,
-0xFF584E2B,
-0xFF67633D,
-0xFF4A481F,
-0xFF55582D,
-0xFF7E8559,
-0xFF525D32,
-0xFF59613A,
-0xFF3D411C,
-0xFF696540,
-0xFF8B8561,
-0xFF373310,
-0xFF2A2811,
-0xFF5A5C57,
-0xFF2B2F3B,
-0xFF313550,
-0xFF292C4D,
-0xFF272A4B,
-0xFF424767,
-0xFF3D4164,
-0xFF292F4F,
-0xFF313653,
-0xFF2C324A,
-0xFF22273D,
-0xFF232639,
-0xFF272636,
-0xFF302E3C,
-0xFF272530,
-0xFF0E0E1A,
-0xFF000011,
-0xFF5A5E79,
-0xFF50557B,
-0xFF333860,
-0xFF1E2343,
-0xFF222641,
-0xFF1A203A,
-0xFF181C37,
-0xFF10112D,
-0xFF32324A,
-0xFF2A273C,
-0xFF12101D,
-0xFF111214,
-0xFF000200,
-0xFF928F6E,
-0xFFA6A47B,
-0xFF84865E,
-0xFF777952,
-0xFF6E6A47,
-0xFF3E3A15,
-0xFF67683E,
-0xFF494C1F,
-0xFF65683D,
-0xFF9DA075,
-0xFF63693D,
-0xFF6A7145,
-0xFF848A5E,
-0xFF5F663A,
-0xFF767D51,
-0xFF949D6E,
-0xFF798555,
-0xFF808E5B,
-0xFF56632E,
-0xFF6D7B46,
-0xFF47561F,
-0xFF4D5B26,
-0xFF72804F,
-0xFF2E3A0A,
-0xFF59632F,
-0xFF58622D,
-0xFF5E6B36,
-0xFF52632F,
-0xFF819361,
-0xFF435420,
-0xFF58602D,
-0xFF505724,
-0xFF888E5E,
-0xFF4E5627,
-0xFF4D592B,
-0xFF616D3D,
-0xFF64713C,
-0xFF75824A,
-0xFF636E34,
-0xFF6C773D,
-0xFF7E8951,
-0xFF5D6631,
-0xFF818854,
-0xFF7A7E4B,
-0xFF636734,
-0xFF838A54,
-0xFF586027,
-0xFF495317,
-0xFF7A8447,
-0xFF7E8A4C,
-0xFF5E6C2F,
-0xFF758547,
-0xFF67753A,
-0xFF919F64,
-0xFF596428,
-0xFF7F8A4E,
-0xFF8F995C,
-0xFFA2AC6F,
-0xFF6C7A3C,
-0xFF809051,
-0xFF647638,
-0xFF708244,
-0xFF68763B,
-0xFF7E8B53,
-0xFF737E46,
-0xFF3F4C14,
-0xFF88955D,
-0xFF616E36,
-0xFF616930,
-0xFF8A935A,
-0xFF66733B,
-0xFF718047,
-0xFF6E7D42,
-0xFF93A365,
-0xFF728043,
-0xFF758346,
-0xFF78864B,
-0xFF79874C,
-0xFF77854A,
-0xFF7C8C4E,
-0xFF6F7D40,
-0xFF728042,
-0xFF6D7B3E,
-0xFF869155,
-0xFF8A955B,
-0xFF777E48,
-0xFF6E703F,
-0xFF71653B,
-0xFF6B4D2B,
-0xFF835838,
-0xFFA97F59,
-0xFF8C5634,
-0xFF661504,
-0xFF661305,
-0xFF83432A,
-0xFF89613E,
-0xFF6D6033,
-0xFF979765,
-0xFF716E43,
-0xFF47441B,
-0xFF6A6841,
-0xFF5C5829,
-0xFFD5C68F,
-0xFFA6914E,
-0xFF786113,
-0xFF836C20,
-0xFF7D692A,
-0xFF9B713F,
-0xFFB25A36,
-0xFFBB593C,
-0xFF9E593A,
-0xFF733B20,
-0xFF571E0B,
-0xFF3E1400,
-0xFF867C4B,
-0xFF999A56,
-0xFFA29747,
-0xFF655500,
-0xFF5B4C00,
-0xFF857D2C,
-0xFF7C7B38,
-0xFFACB272,
-0xFF8C9556,
-0xFF899452,
-0xFF9AA560,
-0xFF8F9855,
-0xFF98975F,
-0xFFA09D68,
-0xFF9B9F62,
-0xFF6F7839,
-0xFF61692D,
-0xFF929C5F,
-0xFF8F9B59,
-0xFF879651,
-0xFF5A6722,
-0xFF94A05E,
-0xFF848E51,
-0xFF636D31,
-0xFF858D52,
-0xFF71773B,
-0xFF99A25F,
-0xFF848E47,
-0xFF89934C,
-0xFF88934E,
-0xFF8D9856,
-0xFF707A3B,
-0xFF9AA467,
-0xFF8A9458,
-0xFF9AA266,
-0xFF879155,
-0xFF5A6732,
-0xFF85925D,
-0xFF626D33,
-0xFF6E783B,
-0xFF8D9655,
-0xFF7D8645,
-0xFF909958,
-0xFF788140,
-0xFF737E3C,
-0xFF879250,
-0xFF7E8945,
-0xFF7F8C47,
-0xFF899855,
-0xFF6B7B3A,
-0xFF6A793E,
-0xFF889659,
-0xFF7F8B4B,
-0xFF929D59,
-0xFF747F3B,
-0xFF798440,
-0xFF616C27,
-0xFF909B56,
-0xFF838E49,
-0xFF88934E,
-0xFF707B36,
-0xFF89944F,
-0xFF707B36,
-0xFF6F7B33,
-0xFF9BA860,
-0xFF808E43,
-0xFF849245,
-0xFF7E8E45,
-0xFF5A6A29,
-0xFF768949,
-0xFF90A361,
-0xFF607331,
-0xFF667939,
-0xFF849757,
-0xFFA4B871,
-0xFF849851,
-0xFF576A2A,
-0xFF4C5F1F,
-0xFF7D904E,
-0xFF738644,
-0xFF546328,
-0xFF6B7A3F,
-0xFF536227,
-0xFF6C7B40,
-0xFF63773C,
-0xFF778C51,
-0xFF6B8143,
-0xFF62783A,
-0xFF697D42,
-0xFF54682D,
-0xFF4F622A,
-0xFF667941,
-0xFF4B5E26,
-0xFF64773F,
-0xFF50632C,
-0xFF5C6E3A,
-0xFF4D5F2D,
-0xFF566838,
-0xFF465828,
-0xFF495B29,
-0xFF434128,
-0xFF46442B,
-0xFF615D44,
-0xFF484429,
-0xFF49452A,
-0xFF575336,
-0xFF686544,
-0xFF4C4926,
-0xFF62603A,
-0xFF74724B,
-0xFF74724B,
-0xFF595730,
-0xFF5F5F39,
-0xFF2E2E08,
-0xFF646440,
-0xFF575836,
-0xFF2C3613,
-0xFF3C4623,
-0xFF3C401D,
-0xFF1C1E00,
-0xFF7C7E57,
-0xFF777952,
-0xFF6A6A44,
-0xFF4D4F28,
-0xFF4D512C,
-0xFF6A6E49,
-0xFF4B4827,
-0xFF6A6746,
-0xFF353415,
-0xFF444827,
-0xFF696F4D,
-0xFF2E320F,
-0xFF5A5736,
-0xFF746E4E,
-0xFF665D3E,
-0xFF847B5C,
-0xFF837A5B,
-0xFF52492A,
-0xFF67613F,
-0xFF655F3B,
-0xFF756F4B,
-0xFF817D58,
-0xFF504C27,
-0xFF716D47,
-0xFF635F39,
-0xFF828057,
-0xFF6C6D43,
-0xFF8C8A63,
-0xFF6C6843,
-0xFF534D2B,
-0xFF54502B,
-0xFF807A56,
-0xFF79714C,
-0xFF524A23,
-0xFF50441E,
-0xFF6E623C,
-0xFF5A512A,
-0xFF6D653E,
-0xFF746E4A,
-0xFF605A36,
-0xFF6E6848,
-0xFF7B7253,
-0xFFA09579,
-0xFF7D7457,
-0xFF817E5D,
-0xFF5F613C,
-0xFF313912,
-0xFF1D2A00,
-0xFF435726,
-0xFF5A6E3D,
-0xFF7D8C63,
-0xFF424A25,
-0xFF2C2C06,
-0xFF464320,
-0xFF151400,
-0xFF161709,
-0xFF434250,
-0xFF31324E,
-0xFF323554,
-0xFF333657,
-0xFF303354,
-0xFF313455,
-0xFF333655,
-0xFF383D5A,
-0xFF2D334D,
-0xFF282C45,
-0xFF31334A,
-0xFF2C2D41,
-0xFF201F2F,
-0xFF0E0C19,
-0xFF05030E,
-0xFF03030F,
-0xFF07081A,
-0xFF5D617C,
-0xFF3D4268,
-0xFF31365E,
-0xFF3E4363,
-0xFF333752,
-0xFF292D48,
-0xFF292D46,
-0xFF464660,
-0xFF3B3750,
-0xFF0A051B,
-0xFF0B0716,
-0xFF090A0E,
-0xFF0B0D00,
-0xFF696947,
-0xFF6A6B3F,
-0xFF50572D,
-0xFF6F754F,
-0xFF555533,
-0xFF7A7756,
-0xFF2C3109,
-0xFF373C13,
-0xFF75774F,
-0xFF51572B,
-0xFF969F72,
-0xFF444D20,
-0xFF293203,
-0xFF444D1E,
-0xFF8E9866,
-0xFF677341,
-0xFF616F3C,
-0xFF74824F,
-0xFFC0CC9A,
-0xFF707C4A,
-0xFF465421,
-0xFF4A5825,
-0xFF60703F,
-0xFF6F7D4A,
-0xFF57642E,
-0xFF4D5820,
-0xFF424F19,
-0xFF879864,
-0xFF49602C,
-0xFF5A6E39,
-0xFF47511D,
-0xFF545B27,
-0xFF5E6635,
-0xFF586230,
-0xFF525E30,
-0xFF3F4D1C,
-0xFF52612A,
-0xFF5D6C31,
-0xFF536124,
-0xFF8E995D,
-0xFF6F7C44,
-0xFF4F5924,
-0xFF5D612F,
-0xFF5E6230,
-0xFF79804D,
-0xFF6E7541,
-0xFF818A51,
-0xFF808A4E,
-0xFF7A8246,
-0xFF606A2D,
-0xFF5F6D2F,
-0xFF6C7A3D,
-0xFF586329,
-0xFF4E571E,
-0xFF717B3E,
-0xFF747E41,
-0xFF8D9559,
-0xFF91995D,
-0xFF576125,
-0xFF6F7A3E,
-0xFF677739,
-0xFF7C8B50,
-0xFF808B51,
-0xFF96A167,
-0xFF828D53,
-0xFF89965E,
-0xFF42541A,
-0xFF819057,
-0xFF88955D,
-0xFFA1AC74,
-0xFF93A06A,
-0xFF8F9E67,
-0xFF63703A,
-0xFF5F6934,
-0xFF707B43,
-0xFF858E57,
-0xFF79844A,
-0xFF59642A,
-0xFF6D7B40,
-0xFF5E6C31,
-0xFF58662B,
-0xFF7B894E,
-0xFF545F27,
-0xFF7D864F,
-0xFF747B45,
-0xFF777B48,
-0xFF767846,
-0xFF63562A,
-0xFF91684A,
-0xFF854D32,
-0xFFFDC39E,
-0xFFA86344,
-0xFFC87062,
-0xFFEE9B8D,
-0xFF9F664B,
-0xFF705029,
-0xFF908557,
-0xFF6F6F3D,
-0xFF9F9B6C,
-0xFF7F7B4E,
-0xFF6B683D,
-0xFF4A4616,
-0xFF7A6B34,
-0xFF826D34,
-0xFF8D773E,
-0xFF957E48,
-0xFF6E5829,
-0xFF856036,
-0xFFA5613A,
-0xFF994E2E,
-0xFF9B6245,
-0xFF471700,
-0xFF764630,
-0xFF4D2A0C,
-0xFF948E5A,
-0xFF858745,
-0xFF807728,
-0xFF6F600B,
-0xFF82741C,
-0xFF9E9643,
-0xFF8B8B43,
-0xFF626926,
-0xFF808646,
-0xFF7C8544,
-0xFF7E8947,
-0xFF656B2D,
-0xFF6A6734,
-0xFFA9A371,
-0xFF93945A,
-0xFF747A3A,
-0xFF888E50,
-0xFF8F975B,
-0xFF95A163,
-0xFF7E8C4E,
-0xFF8B9759,
-0xFF5A6529,
-0xFF767F46,
-0xFF8C945B,
-0xFF535820,
-0xFF7C8246,
-0xFF929956,
-0xFF8B924E,
-0xFFA0A763,
-0xFF7D8643,
-0xFF80884C,
-0xFF6B7539,
-0xFF8C955C,
-0xFF8C955C,
-0xFF7D874B,
-0xFF7B844B,
-0xFF717B47,
-0xFF7A8450,
-0xFF747D46,
-0xFF646C31,
-0xFF8C9556,
-0xFF929B5C,
-0xFF5B6425,
-0xFF656D31,
-0xFF858F52,
-0xFF838D4E,
-0xFF7E8A48,
-0xFF8D9957,
-0xFF788442,
-0xFF99A867,
-0xFF939E62,
-0xFF9FAA6E,
-0xFF818B4C,
-0xFF6D7834,
-0xFF6A7330,
-0xFF919B56,
-0xFF6B7530,
-0xFF737D36,
-0xFF6E7833,
-0xFF727C37,
-0xFF828C47,
-0xFF8F9954,
-0xFF818B44,
-0xFF929E56,
-0xFF97A359,
-0xFF859147,
-0xFF889448,
-0xFF77853A,
-0xFF677832,
-0xFF91A560,
-0xFF899D58,
-0xFF627631,
-0xFF546423,
-0xFF9AAA69,
-0xFF85964F,
-0xFF61722B,
-0xFF728243,
-0xFF6C7A3C,
-0xFF728140,
-0xFF798847,
-0xFF6A783D,
-0xFF5C6A2F,
-0xFF647237,
-0xFF556429,
-0xFF788A50,
-0xFF485A20,
-0xFF75874D,
-0xFF586932,
-0xFF586730,
-0xFF718049,
-0xFF47561F,
-0xFF798752,
-0xFF606E39,
-0xFF556632,
-0xFF738450,
-0xFF7B8D59,
-0xFF435521,
-0xFF445823,
-0xFF4A5E2B,
-0xFF556936,
-0xFF4C4C30,
-0xFF3C3C20,
-0xFF4B4B2F,
-0xFF4D4D31,
-0xFF494A2B,
-0xFF4B4C2C,
-0xFF444422,
-0xFF63633F,
-0xFF62623C,
-0xFF83845C,
-0xFF585931,
-0xFF62633B,
-0xFF6A6842,
-0xFF5A5832,
-0xFF524F2C,
-0xFF6F6F4D,
-0xFF404725,
-0xFF3F4624,
-0xFF3B3F1C,
-0xFF797B56,
-0xFF494B24,
-0xFF54562F,
-0xFF6B6C44,
-0xFF54562F,
-0xFF424822,
-0xFF565A35,
-0xFF4E4E2C,
-0xFF4D4C2D,
-0xFF404122,
-0xFF6A6F4F,
-0xFF4D5735,
-0xFF585F3D,
-0xFF3C3D1D,
-0xFF525132,
-0xFF575637,
-0xFF595839,
-0xFF575735,
-0xFF646442,
-0xFF70704C,
-0xFF54542E,
-0xFF464620,
-0xFF80825A,
-0xFF595E35,
-0xFF454B1F,
-0xFFB6BE8F,
-0xFF394213,
-0xFF565F30,
-0xFF737A4E,
-0xFF6B6F4A,
-0xFF4D4E2E,
-0xFF3B3B19,
-0xFF7C7958,
-0xFF736F4C,
-0xFF7F7D57,
-0xFF585630,
-0xFF999A72,
-0xFF696B44,
-0xFF62673F,
-0xFF535432,
-0xFF7A7B59,
-0xFF2D2C0E,
-0xFF353416,
-0xFF37371B,
-0xFF555436,
-0xFF585536,
-0xFF464526,
-0xFF36401D,
-0xFF516238,
-0xFF415524,
-0xFF4C5E2E,
-0xFF485328,
-0xFF485027,
-0xFF434A20,
-0xFF373D19,
-0xFF434831,
-0xFF242925,
-0xFF3C4155,
-0xFF313656,
-0xFF2D3653,
-0xFF2C3350,
-0xFF2D3051,
-0xFF2F2F51,
-0xFF2A2B4A,
-0xFF303352,
-0xFF2F3350,
-0xFF2D314A,
-0xFF222439,
-0xFF000211,
-0xFF00000A,
-0xFF09080E,
-0xFF020107,
-0xFF01010B,
-0xFF070A1D,
-0xFF535876,
-0xFF3F446C,
-0xFF3C436D,
-0xFF2B3056,
-0xFF272C4C,
-0xFF373D55,
-0xFF3D4456,
-0xFF181B2A,
-0xFF070616,
-0xFF0D091A,
-0xFF0E0A18,
-0xFF04040C,
-0xFF13160F,
-0xFF727354,
-0xFF454B1F,
-0xFF4A552A,
-0xFF4E592F,
-0xFF767A55,
-0xFF434520,
-0xFF333810,
-0xFF73784F,
-0xFF61633B,
-0xFF505628,
-0xFF606E3B,
-0xFF455620,
-0xFF95A66F,
-0xFF7C8E54,
-0xFF5A6C32,
-0xFF607238,
-0xFF74884D,
-0xFF70814A,
-0xFF68723E,
-0xFF606837,
-0xFF6F7947,
-0xFF697543,
-0xFF404E1B,
-0xFF8E9D66,
-0xFFA4B277,
-0xFF545F23,
-0xFF505B21,
-0xFF63723B,
-0xFF5A7139,
-0xFF61763E,
-0xFF536028,
-0xFF7F8A50,
-0xFF62713A,
-0xFF73844D,
-0xFF74824F,
-0xFF414E19,
-0xFF374208,
-0xFF727E40,
-0xFF576325,
-0xFF99A769,
-0xFF516025,
-0xFF414E18,
-0xFF5B6131,
-0xFFA3A979,
-0xFF626A39,
-0xFF858F5A,
-0xFF88965B,
-0xFF556123,
-0xFF636D2E,
-0xFF808C4C,
-0xFF506021,
-0xFF5A6A2C,
-0xFF636E34,
-0xFF6E773E,
-0xFF889456,
-0xFF7B8747,
-0xFF828A4E,
-0xFF8C9459,
-0xFF5A632A,
-0xFF79844A,
-0xFF707B41,
-0xFF717C42,
-0xFF6E763D,
-0xFF767E43,
-0xFF616C30,
-0xFFB6C489,
-0xFF4C5E24,
-0xFF6A7C42,
-0xFF93A16C,
-0xFF8A9762,
-0xFF85935E,
-0xFF65723D,
-0xFF4E5826,
-0xFF6D7544,
-0xFF8B925F,
-0xFF5C632F,
-0xFF5C652C,
-0xFF8D985C,
-0xFF808E51,
-0xFF5A692E,
-0xFF5D6C33,
-0xFF54632C,
-0xFF596631,
-0xFF555D2A,
-0xFF676E3A,
-0xFF8F9662,
-0xFF7B8550,
-0xFF6C6A39,
-0xFF745831,
-0xFF855932,
-0xFF9E6C3B,
-0xFFE1AB7D,
-0xFFFFCAAF,
-0xFFFFDFC8,
-0xFFC5A481,
-0xFF837247,
-0xFF585022,
-0xFF746E3E,
-0xFF817B49,
-0xFF7A7440,
-0xFF807D48,
-0xFF6C6932,
-0xFF7B743D,
-0xFF867F49,
-0xFF82774A,
-0xFF9E916E,
-0xFF978A6A,
-0xFF6B5434,
-0xFFBC956E,
-0xFF9B6B45,
-0xFFAD8063,
-0xFF6A4228,
-0xFF7B5C3F,
-0xFF705D35,
-0xFF9F9C65,
-0xFF6E6B24,
-0xFF8B7B23,
-0xFFB4A03F,
-0xFFADA13F,
-0xFF8E892E,
-0xFF8C8E45,
-0xFF898D50,
-0xFFACAF7A,
-0xFF80854F,
-0xFF596128,
-0xFF848951,
-0xFF94915E,
-0xFFA9A671,
-0xFF9EA466,
-0xFF727D3B,
-0xFF646D2A,
-0xFF818A4B,
-0xFF576125,
-0xFF707B41,
-0xFF687138,
-0xFF687138,
-0xFF828A51,
-0xFF767E45,
-0xFF81894D,
-0xFF747D3E,
-0xFF96A05B,
-0xFF8A9550,
-0xFF8C9753,
-0xFF717B3E,
-0xFF848D56,
-0xFF69713E,
-0xFF777F4E,
-0xFF5A622F,
-0xFF969D67,
-0xFF8D925C,
-0xFF5B5F2C,
-0xFF5C612B,
-0xFF676A31,
-0xFF676B30,
-0xFF787C41,
-0xFF8A9054,
-0xFF747C43,
-0xFF474E18,
-0xFF8D965F,
-0xFF5E672E,
-0xFF5E682B,
-0xFF566021,
-0xFF828B4A,
-0xFF8C9554,
-0xFF7C8242,
-0xFF757B3B,
-0xFF7C8745,
-0xFF697631,
-0xFF8E9955,
-0xFF8E9955,
-0xFF6F7A36,
-0xFF808B46,
-0xFF75803C,
-0xFF7A8541,
-0xFF828D49,
-0xFF96A15D,
-0xFF7C8743,
-0xFF919E59,
-0xFFA5B26C,
-0xFF73803A,
-0xFF6F7C34,
-0xFF697630,
-0xFF505C1A,
-0xFF798543,
-0xFF8B9755,
-0xFF6C7836,
-0xFF7B8747,
-0xFF798545,
-0xFF63702A,
-0xFF73803A,
-0xFF636F31,
-0xFF556325,
-0xFF707F3C,
-0xFF687935,
-0xFF607032,
-0xFF5D6F33,
-0xFF536529,
-0xFF718345,
-0xFF5B6A2F,
-0xFF516025,
-0xFF314009,
-0xFF62713A,
-0xFF5B6832,
-0xFF49561E,
-0xFF535E26,
-0xFF6E7843,
-0xFF4A5624,
-0xFF626E3C,
-0xFF515F2C,
-0xFF41521E,
-0xFF4A5D26,
-0xFF495C25,
-0xFF546833,
-0xFF5F7340,
-0xFF4B4B2F,
-0xFF3E3E22,
-0xFF525236,
-0xFF393C1F,
-0xFF464A29,
-0xFF5C603D,
-0xFF5A5B39,
-0xFF4B4B27,
-0xFF868662,
-0xFF595933,
-0xFF626039,
-0xFF40401A,
-0xFF5F5C39,
-0xFF6A6A48,
-0xFF5A5A38,
-0xFF30310F,
-0xFF444728,
-0xFF242708,
-0xFF8E8F6F,
-0xFF555533,
-0xFF3B3D18,
-0xFF74764F,
-0xFF4C4E27,
-0xFF3B4018,
-0xFF7C825C,
-0xFF414725,
-0xFF636445,
-0xFF49492D,
-0xFF686B4E,
-0xFF55593E,
-0xFF1A2004,
-0xFF2B3115,
-0xFF6A6D50,
-0xFF6B6C4D,
-0xFF303314,
-0xFF2C2F10,
-0xFF5D6140,
-0xFF444825,
-0xFF616540,
-0xFF3C4119,
-0xFF6B7047,
-0xFF686F43,
-0xFF333A10,
-0xFF5B6439,
-0xFF657046,
-0xFF7F8A60,
-0xFF687349,
-0xFF3F4720,
-0xFF757C5B,
-0xFF303515,
-0xFF2C2D0E,
-0xFF363516,
-0xFF4B4829,
-0xFF585834,
-0xFF70724B,
-0xFF484F26,
-0xFF434925,
-0xFF5B613F,
-0xFF505634,
-0xFF474B2A,
-0xFF363A19,
-0xFF313415,
-0xFF282D0F,
-0xFF454829,
-0xFF4B4829,
-0xFF7B7B59,
-0xFF37411C,
-0xFF64754B,
-0xFF66774B,
-0xFF455528,
-0xFF4C5528,
-0xFF394215,
-0xFF414C21,
-0xFF687450,
-0xFF3C4736,
-0xFF3A4446,
-0xFF363C56,
-0xFF313558,
-0xFF2C3350,
-0xFF2C314E,
-0xFF2E2F4E,
-0xFF2A2948,
-0xFF212240,
-0xFF191A36,
-0xFF181A33,
-0xFF07091E,
-0xFF020315,
-0xFF070713,
-0xFF07080D,
-0xFF06050A,
-0xFF050608,
-0xFF000108,
-0xFF515368,
-0xFF474C6A,
-0xFF3E436B,
-0xFF313660,
-0xFF373B61,
-0xFF414664,
-0xFF2D3349,
-0xFF050B1B,
-0xFF050915,
-0xFF080814,
-0xFF100E1C,
-0xFF060412,
-0xFF040612,
-0xFF121711,
-0xFF454A2A,
-0xFF798152,
-0xFF576534,
-0xFF637042,
-0xFF778055,
-0xFF535A30,
-0xFF767D53,
-0xFF747A4E,
-0xFF64673C,
-0xFF4B5322,
-0xFF94A26D,
-0xFF6D7F45,
-0xFF37490F,
-0xFF607236,
-0xFF7B8D51,
-0xFF6C7E42,
-0xFF3D5116,
-0xFF5F7137,
-0xFF5F6934,
-0xFF454C19,
-0xFF717948,
-0xFF394311,
-0xFF4A5722,
-0xFF7A8950,
-0xFF849255,
-0xFF606E30,
-0xFF636E32,
-0xFF435219,
-0xFF5E733B,
-0xFF73884F,
-0xFF637237,
-0xFF586629,
-0xFF55642B,
-0xFF6A7B44,
-0xFF62703D,
-0xFF3E4B16,
-0xFF646D34,
-0xFF576124,
-0xFF7A8648,
-0xFF5C6A2D,
-0xFF8D9C61,
-0xFF6C7941,
-0xFF3E4613,
-0xFF6D7343,
-0xFF4B5523,
-0xFF6C7644,
-0xFF6C7944,
-0xFF6F7A40,
-0xFF8B9556,
-0xFF95A15F,
-0xFF748342,
-0xFF606E30,
-0xFF616C30,
-0xFF626C2F,
-0xFF768242,
-0xFF707C3A,
-0xFF949C60,
-0xFF8F975E,
-0xFF767F48,
-0xFF505924,
-0xFF919B66,
-0xFF7D8651,
-0xFF6C743B,
-0xFF676F36,
-0xFF848D54,
-0xFF818E56,
-0xFF4D5B26,
-0xFF4A5B27,
-0xFF74824F,
-0xFF5D6B38,
-0xFF626E3C,
-0xFF4D5927,
-0xFF4C5425,
-0xFF7A8052,
-0xFF646836,
-0xFF5C602D,
-0xFF787F49,
-0xFF7D864D,
-0xFF6D7B40,
-0xFF637136,
-0xFF35440D,
-0xFF74814B,
-0xFF99A36F,
-0xFF535B28,
-0xFF49501D,
-0xFF6B7340,
-0xFF697640,
-0xFF838852,
-0xFF736236,
-0xFF8C7041,
-0xFF94733D,
-0xFFC5A46F,
-0xFF6C4E28,
-0xFFA08864,
-0xFF908156,
-0xFF898152,
-0xFF7E7647,
-0xFF6F6937,
-0xFF7A753E,
-0xFF77723A,
-0xFF918C54,
-0xFF8B8950,
-0xFF6B6A32,
-0xFF575725,
-0xFF56542B,
-0xFF989471,
-0xFFA39E7E,
-0xFF5D5330,
-0xFF9B855C,
-0xFF886D42,
-0xFF7F633C,
-0xFF7E6640,
-0xFF95865B,
-0xFF7F7746,
-0xFF8E8E52,
-0xFF7B792F,
-0xFF857A21,
-0xFF7C6D0E,
-0xFF7E7A19,
-0xFF95953D,
-0xFF7E813A,
-0xFF959B5F,
-0xFF727540,
-0xFFABAF7C,
-0xFF727A41,
-0xFF949C63,
-0xFF8D8D5B,
-0xFF6E703E,
-0xFF798146,
-0xFF838F51,
-0xFF606A2B,
-0xFF8C9458,
-0xFF8A9458,
-0xFF6A733A,
-0xFF7B844B,
-0xFF969F66,
-0xFF606930,
-0xFF7F894D,
-0xFF838D50,
-0xFF8A9455,
-0xFF929D5B,
-0xFF9CA765,
-0xFF838D4E,
-0xFF778145,
-0xFF8F9764,
-0xFF596132,
-0xFF6B7344,
-0xFF414717,
-0xFF919865,
-0xFF929663,
-0xFF666934,
-0xFF7B7E49,
-0xFF656831,
-0xFF8E9359,
-0xFF7A7F45,
-0xFF5E662B,
-0xFF7C844B,
-0xFF545D26,
-0xFF858E59,
-0xFF535C27,
-0xFF646D36,
-0xFF747C41,
-0xFF8C9256,
-0xFF737838,
-0xFF7D7F40,
-0xFF848949,
-0xFF7E8746,
-0xFF6C7735,
-0xFF636E2C,
-0xFF616C28,
-0xFF909956,
-0xFF949D5A,
-0xFF97A05D,
-0xFF737E3A,
-0xFF7D8846,
-0xFF8D9856,
-0xFF707C3A,
-0xFF8F9C57,
-0xFF9BA863,
-0xFF98A55F,
-0xFF75823A,
-0xFF93A05A,
-0xFF707C3C,
-0xFF7A8445,
-0xFF778240,
-0xFF6D7937,
-0xFF677132,
-0xFF7E8A4A,
-0xFF67742F,
-0xFF667230,
-0xFF657133,
-0xFF6A783B,
-0xFF8E9D5C,
-0xFF70803F,
-0xFF8B9B5C,
-0xFF4D5D1F,
-0xFF738345,
-0xFF8B9B5D,
-0xFF6B793C,
-0xFF869459,
-0xFF8B9862,
-0xFF4D5722,
-0xFF515B26,
-0xFF5C672F,
-0xFF5C652E,
-0xFF616A35,
-0xFF616A3B,
-0xFF636F41,
-0xFF647241,
-0xFF576532,
-0xFF465721,
-0xFF31420C,
-0xFF475925,
-0xFF566834,
-0xFF544F32,
-0xFF4A4629,
-0xFF464529,
-0xFF57573B,
-0xFF545535,
-0xFF3E3F1D,
-0xFF4C4B2C,
-0xFF4B4A2B,
-0xFF5E5B3C,
-0xFF63603F,
-0xFF4E4A27,
-0xFF5A5736,
-0xFF585739,
-0xFF626344,
-0xFF3F4424,
-0xFF6C6F50,
-0xFF454627,
-0xFF454426,
-0xFF8D8C6D,
-0xFF61613F,
-0xFF525331,
-0xFF585C37,
-0xFF737953,
-0xFF595F3B,
-0xFF545B39,
-0xFF3D4425,
-0xFF32351A,
-0xFF1C1E06,
-0xFF32341F,
-0xFF52513F,
-0xFF1D1C0A,
-0xFF5E5D4B,
-0xFF373621,
-0xFF5E6048,
-0xFF62654A,
-0xFF34371C,
-0xFF2D3214,
-0xFF727757,
-0xFF595F3B,
-0xFF3F461D,
-0xFF9AA175,
-0xFF383F13,
-0xFF454C23,
-0xFF464C2A,
-0xFF6C7055,
-0xFF1B1F08,
-0xFF33351F,
-0xFF53553F,
-0xFF33351D,
-0xFF7E8166,
-0xFF68694A,
-0xFF555637,
-0xFF39381C,
-0xFF242304,
-0xFF4C4D23,
-0xFF6B6D45,
-0xFF666747,
-0xFF656549,
-0xFF555637,
-0xFF161A00,
-0xFF494D28,
-0xFF4A4E29,
-0xFF474D2B,
-0xFF8B8F6E,
-0xFFC4C6A1,
-0xFF777951,
-0xFF323B10,
-0xFF424F23,
-0xFF6B7751,
-0xFF414D27,
-0xFF4F5829,
-0xFF626C3A,
-0xFF182300,
-0xFF273212,
-0xFF1E2A20,
-0xFF333D46,
-0xFF373D57,
-0xFF2C2F50,
-0xFF302F4F,
-0xFF2F2E4D,
-0xFF2D2D49,
-0xFF292B44,
-0xFF27283D,
-0xFF222337,
-0xFF171928,
-0xFF0F111D,
-0xFF0C0C16,
-0xFF0A0A12,
-0xFF06060E,
-0xFF0A0B10,
-0xFF010506,
-0xFF03080C,
-0xFF5E6376,
-0xFF474B68,
-0xFF3C4065,
-0xFF3B3F64,
-0xFF3D405F,
-0xFF2C2E47,
-0xFF101326,
-0xFF101324,
-0xFF0C0D1F,
-0xFF050716,
-0xFF0B0A18,
-0xFF171624,
-0xFF151726,
-0xFF090E0A,
-0xFF79815C,
-0xFF5E6B35,
-0xFF697841,
-0xFF9CAA75,
-0xFF7C8856,
-0xFF7A8656,
-0xFF5B6533,
-0xFF4F5927,
-0xFF636B3A,
-0xFF848C59,
-0xFF6C7641,
-0xFF7E8853,
-0xFF424C1A,
-0xFF69733F,
-0xFF74814B,
-0xFF7E8B55,
-0xFF47541F,
-0xFF303D08,
-0xFF5D6631,
-0xFF5E6732,
-0xFF4F5622,
-0xFF8A925F,
-0xFF3B4513,
-0xFF616E39,
-0xFF8B9B5D,
-0xFF7E8E4F,
-0xFF748247,
-0xFF435018,
-0xFF5B6E37,
-0xFF798C54,
-0xFF5C6E32,
-0xFF49571A,
-0xFF57622A,
-0xFF6F7945,
-0xFF606C3E,
-0xFF495527,
-0xFF5B622E,
-0xFF8C945B,
-0xFF636C35,
-0xFF6F7A42,
-0xFF8D985C,
-0xFF586327,
-0xFF4E571E,
-0xFF707942,
-0xFF545C2D,
-0xFF666D43,
-0xFF525930,
-0xFF636B3A,
-0xFF848D4E,
-0xFF747F3B,
-0xFF707C3A,
-0xFF838F4F,
-0xFF828C4D,
-0xFF677230,
-0xFF88934F,
-0xFF65702E,
-0xFF677134,
-0xFF828B54,
-0xFF58612C,
-0xFF6B7342,
-0xFF4A5422,
-0xFF6A7442,
-0xFF79824D,
-0xFF727B44,
-0xFF5E6833,
-0xFF454F1D,
-0xFF535E33,
-0xFF434E24,
-0xFF879365,
-0xFF3D4919,
-0xFF3C4516,
-0xFF4E5728,
-0xFF8E9667,
-0xFF868D5A,
-0xFF595E28,
-0xFF7A7F47,
-0xFF757A44,
-0xFF5B622C,
-0xFF5E6732,
-0xFF3C470F,
-0xFF636E36,
-0xFF2E3900,
-0xFF7E884C,
-0xFF5D662D,
-0xFF404616,
-0xFFA3AB7A,
-0xFF707B43,
-0xFF8A9259,
-0xFF666330,
-0xFF756D3C,
-0xFF665F2B,
-0xFFA9A36F,
-0xFF494515,
-0xFF94915E,
-0xFF857F4B,
-0xFF928F58,
-0xFF838049,
-0xFF8D8C54,
-0xFF99985F,
-0xFF8F8E55,
-0xFF928D56,
-0xFFA09D66,
-0xFF7A7A46,
-0xFF7A7C4A,
-0xFF999B6C,
-0xFF9FA172,
-0xFF828153,
-0xFF9E9A6B,
-0xFF978F5E,
-0xFFA09661,
-0xFF9A905B,
-0xFF5E5721,
-0xFF828047,
-0xFF9FA162,
-0xFF8B904D,
-0xFF656B21,
-0xFF787B2C,
-0xFFA3A655,
-0xFF585D0D,
-0xFF70782D,
-0xFF818A47,
-0xFF7F8849,
-0xFF7D874A,
-0xFF899354,
-0xFF717C3A,
-0xFF6D773A,
-0xFF545A2A,
-0xFF5E6539,
-0xFF8B9360,
-0xFF7C8651,
-0xFF666F3A,
-0xFF88915A,
-0xFF7E884B,
-0xFF7E8A4A,
-0xFF7E8A4C,
-0xFF818F52,
-0xFF576228,
-0xFF545F25,
-0xFF687337,
-0xFF7E884C,
-0xFF6C753E,
-0xFF7D864D,
-0xFF798347,
-0xFF7B8348,
-0xFF9DA470,
-0xFF525926,
-0xFF727946,
-0xFF5A612E,
-0xFF656C39,
-0xFF4C5320,
-0xFF5F6632,
-0xFF4B521E,
-0xFF666F3A,
-0xFF656E39,
-0xFF7D864F,
-0xFF646F35,
-0xFFACB77B,
-0xFF626D33,
-0xFF545F27,
-0xFF626C38,
-0xFF4B5322,
-0xFF515825,
-0xFF7B804A,
-0xFF64672E,
-0xFF848549,
-0xFF6D7134,
-0xFF6F7338,
-0xFF767C40,
-0xFF585E20,
-0xFF777D3D,
-0xFF8A914E,
-0xFF848B48,
-0xFF979D5D,
-0xFF737C3B,
-0xFF7B8443,
-0xFF8F9A58,
-0xFF606D28,
-0xFFA6B36E,
-0xFF6E7E35,
-0xFF91A156,
-0xFF97A85A,
-0xFF7F8F46,
-0xFF737F41,
-0xFF4D581C,
-0xFF899555,
-0xFF6D7C39,
-0xFF737F3D,
-0xFF6C7B38,
-0xFF6B7A39,
-0xFF6D7B3D,
-0xFF6E7C41,
-0xFF67753A,
-0xFF7C8A4D,
-0xFF7E8A4C,
-0xFF859153,
-0xFF5F6B2D,
-0xFF828E50,
-0xFF6A7638,
-0xFF646F33,
-0xFF8D985E,
-0xFF505B23,
-0xFF616A35,
-0xFF858E59,
-0xFF646D38,
-0xFF5F6734,
-0xFF5C6435,
-0xFF60693C,
-0xFF4F5A2F,
-0xFF4B582C,
-0xFF637042,
-0xFF4F5D2C,
-0xFF505E2B,
-0xFF33400B,
-0xFF616E39,
-0xFF524D2F,
-0xFF2E2A0D,
-0xFF444327,
-0xFF404024,
-0xFF6F704E,
-0xFF616240,
-0xFF343515,
-0xFF3A391B,
-0xFF524E31,
-0xFF555233,
-0xFF484526,
-0xFF322F10,
-0xFF444428,
-0xFF42452A,
-0xFF7B8263,
-0xFF555A3A,
-0xFF4A492A,
-0xFF6D6A4B,
-0xFF555435,
-0xFF535434,
-0xFF3B3F1E,
-0xFF333917,
-0xFF505735,
-0xFF5C6341,
-0xFF252C0B,
-0xFF727958,
-0xFF272B10,
-0xFF30341B,
-0xFF1D1F0A,
-0xFF272516,
-0xFF1A160A,
-0xFF3C382C,
-0xFF32311D,
-0xFF1E2008,
-0xFF4A4D32,
-0xFF44472A,
-0xFF41452A,
-0xFF53583A,
-0xFF242909,
-0xFF545C37,
-0xFF5F673E,
-0xFF626940,
-0xFF4A502A,
-0xFF4B4E2F,
-0xFF22240E,
-0xFF535240,
-0xFF51503E,
-0xFF373624,
-0xFF4C4B36,
-0xFF46462C,
-0xFF7F7F63,
-0xFF48492A,
-0xFF616044,
-0xFF484728,
-0xFF73744A,
-0xFF5D5E34,
-0xFF5A593B,
-0xFF616147,
-0xFF3F3F23,
-0xFF4C502D,
-0xFF535830,
-0xFF484F26,
-0xFF666C48,
-0xFF626844,
-0xFF80855D,
-0xFF3F441B,
-0xFF394215,
-0xFF515C31,
-0xFF485430,
-0xFF343E19,
-0xFF374013,
-0xFF6A7344,
-0xFF848F64,
-0xFF010C00,
-0xFF1C2824,
-0xFF3A4450,
-0xFF282E46,
-0xFF2B2E4D,
-0xFF2B2847,
-0xFF35304E,
-0xFF2D2D47,
-0xFF26283D,
-0xFF232438,
-0xFF1E202F,
-0xFF161620,
-0xFF0E0E16,
-0xFF0A0B10,
-0xFF08090E,
-0xFF06070C,
-0xFF04080B,
-0xFF000200,
-0xFF4E5452,
-0xFF5E6472,
-0xFF40445F,
-0xFF3B3F62,
-0xFF34375A,
-0xFF2C2D4B,
-0xFF23233B,
-0xFF2A2B3F,
-0xFF292B3A,
-0xFF262739,
-0xFF323443,
-0xFF464855,
-0xFF262835,
-0xFF1E202F,
-0xFF212524,
-0xFFD1DCB4,
-0xFF5C6A2F,
-0xFF505F24,
-0xFF7B8A51,
-0xFF8E9D66,
-0xFF516029,
-0xFF85925C,
-0xFF808A55,
-0xFF5D6732,
-0xFF7D8651,
-0xFF6D7641,
-0xFFBCC491,
-0xFF5B6236,
-0xFF7D8458,
-0xFF818B59,
-0xFF97A16D,
-0xFF7E8856,
-0xFF3C4614,
-0xFF707A46,
-0xFF858D5A,
-0xFF81895A,
-0xFF5D6438,
-0xFF646D40,
-0xFF778351,
-0xFF56682E,
-0xFF91A365,
-0xFF65723A,
-0xFF515E28,
-0xFF576832,
-0xFF455821,
-0xFF4E6024,
-0xFF7C8B50,
-0xFF767F4A,
-0xFF525A29,
-0xFF677248,
-0xFF566136,
-0xFF696F3F,
-0xFF565A27,
-0xFF747D48,
-0xFF757E47,
-0xFF7C864A,
-0xFF858F52,
-0xFF626C2D,
-0xFF6F793D,
-0xFF6E7542,
-0xFF5F6539,
-0xFF545930,
-0xFF585E2E,
-0xFF50591A,
-0xFF717A37,
-0xFF8A9553,
-0xFF707A3B,
-0xFF7C8745,
-0xFF838E4C,
-0xFF9CA765,
-0xFFA1AB6C,
-0xFF99A269,
-0xFF808954,
-0xFF6B7340,
-0xFF474F1C,
-0xFF6B7543,
-0xFF4B5521,
-0xFF59632E,
-0xFF6F7A42,
-0xFF48521D,
-0xFF6A7442,
-0xFF717950,
-0xFF394118,
-0xFF909867,
-0xFF434D18,
-0xFF6E7846,
-0xFF798150,
-0xFF646B38,
-0xFF4D541E,
-0xFF82884C,
-0xFF858B4D,
-0xFF6A6F37,
-0xFF787D47,
-0xFF8D945E,
-0xFF6B743D,
-0xFF737C45,
-0xFF8A935A,
-0xFFB0BA7D,
-0xFF6B743B,
-0xFF5D6335,
-0xFFBDC397,
-0xFF636C37,
-0xFF6E763D,
-0xFF858853,
-0xFF545722,
-0xFF6D723C,
-0xFF727943,
-0xFF9DA66D,
-0xFF6F743A,
-0xFFA0A167,
-0xFF85844B,
-0xFF929158,
-0xFFA5A66C,
-0xFFB8B97F,
-0xFFADAE74,
-0xFF9F9D64,
-0xFF928F58,
-0xFF747742,
-0xFF5F6330,
-0xFF5A5E2B,
-0xFF8A8F59,
-0xFF8A8D58,
-0xFFAAAA74,
-0xFFAAA971,
-0xFFABAC73,
-0xFF7B7C42,
-0xFF8A8E51,
-0xFF7F8442,
-0xFF909753,
-0xFF9AA15B,
-0xFF88924B,
-0xFF99A35A,
-0xFF7C863F,
-0xFF6C7732,
-0xFF88934F,
-0xFFA5AF70,
-0xFF798344,
-0xFF838F4D,
-0xFFADBA75,
-0xFF94A15B,
-0xFF8B9757,
-0xFF828C58,
-0xFF7E875A,
-0xFF67713F,
-0xFF6E7846,
-0xFF6E7549,
-0xFF485021,
-0xFF656E35,
-0xFF949E61,
-0xFF7F8D50,
-0xFF87955A,
-0xFF748247,
-0xFF3B460C,
-0xFF859056,
-0xFF848D58,
-0xFF5C6433,
-0xFF5D6333,
-0xFF79804A,
-0xFFA4AC73,
-0xFF737745,
-0xFF616435,
-0xFF686B3C,
-0xFF4B4E1F,
-0xFF8F9567,
-0xFF757B4B,
-0xFF535B28,
-0xFF5D6532,
-0xFF545C29,
-0xFF4C5622,
-0xFF737D48,
-0xFF5D6A32,
-0xFF6C7A3F,
-0xFF5D6B30,
-0xFF6E7B45,
-0xFF4B5523,
-0xFF5A6233,
-0xFF757B4D,
-0xFF585C2A,
-0xFF5C5F2A,
-0xFF87884F,
-0xFF5D5E24,
-0xFF7D8047,
-0xFF5B5F24,
-0xFF6B6F34,
-0xFF8A8E51,
-0xFF7D8242,
-0xFF858A48,
-0xFF8C9252,
-0xFF818747,
-0xFF828B4C,
-0xFF889152,
-0xFF7D8846,
-0xFF84914C,
-0xFF7B8842,
-0xFF57671E,
-0xFFA8B96B,
-0xFF798940,
-0xFF94A062,
-0xFF7D884C,
-0xFF889454,
-0xFF5B6A27,
-0xFF788744,
-0xFF677635,
-0xFF6E7C3F,
-0xFF919F64,
-0xFF7E8B53,
-0xFF6F7D42,
-0xFF818C50,
-0xFF6E7A3C,
-0xFF808A4B,
-0xFF838D4E,
-0xFF949C60,
-0xFF7D854A,
-0xFF879057,
-0xFF6E7941,
-0xFF7D8651,
-0xFF868F5A,
-0xFF78814C,
-0xFF636B38,
-0xFF6A7241,
-0xFF444D1E,
-0xFF666F42,
-0xFF414C21,
-0xFF455226,
-0xFF435024,
-0xFF667244,
-0xFF4E5A2A,
-0xFF798351,
-0xFF46501C,
-0xFF494829,
-0xFF414022,
-0xFF505034,
-0xFF333617,
-0xFF6A6E4B,
-0xFF4B4F2C,
-0xFF454928,
-0xFF3B3C1D,
-0xFF333415,
-0xFF5C5B3C,
-0xFF3A391A,
-0xFF353616,
-0xFF373A1F,
-0xFF8C9075,
-0xFF3E4526,
-0xFF3D4321,
-0xFF565831,
-0xFF5D5E36,
-0xFF2C2C0A,
-0xFF4D4E2F,
-0xFF2E3116,
-0xFF2F3318,
-0xFF495031,
-0xFF353C1B,
-0xFF1B2200,
-0xFF515934,
-0xFF343A16,
-0xFF303614,
-0xFF4C4F34,
-0xFF555440,
-0xFF252316,
-0xFF131104,
-0xFF272611,
-0xFF404024,
-0xFF565A39,
-0xFF676B4A,
-0xFF8B8E71,
-0xFF22260D,
-0xFF60644D,
-0xFF2C3019,
-0xFF404429,
-0xFF4F5233,
-0xFF595D3C,
-0xFF282909,
-0xFF3E3E24,
-0xFF2F2D16,
-0xFF36341D,
-0xFF514F38,
-0xFF5B5B43,
-0xFF2E2E14,
-0xFF333415,
-0xFF5A5B3C,
-0xFF2F2F13,
-0xFF424323,
-0xFF676A3F,
-0xFF5A5D32,
-0xFF4C4D2E,
-0xFF5C5C40,
-0xFF454829,
-0xFF323814,
-0xFF3E451C,
-0xFF555E33,
-0xFF272F08,
-0xFF2A320D,
-0xFF828661,
-0xFF3C421C,
-0xFF202801,
-0xFF49542C,
-0xFF6C7651,
-0xFF5C673F,
-0xFF4E562D,
-0xFF30380F,
-0xFF69744A,
-0xFF424C33,
-0xFF424C4D,
-0xFF343D4E,
-0xFF2E344C,
-0xFF232742,
-0xFF2D2C4B,
-0xFF322F4E,
-0xFF292943,
-0xFF23253A,
-0xFF222335,
-0xFF212330,
-0xFF1B1B25,
-0xFF101018,
-0xFF090911,
-0xFF05060B,
-0xFF07080A,
-0xFF000500,
-0xFF0D1402,
-0xFF586051,
-0xFF6E757D,
-0xFF2B3046,
-0xFF2B2F52,
-0xFF2E3056,
-0xFF222244,
-0xFF1B1C38,
-0xFF18192E,
-0xFF1D1F2E,
-0xFF2A2C3B,
-0xFF2E303D,
-0xFF191B27,
-0xFF0F111D,
-0xFF131524,
-0xFF191D1C,
-0xFF38421D,
-0xFF2C3901,
-0xFFA8B87A,
-0xFF96A668,
-0xFF8B9B5D,
-0xFF6E7C3F,
-0xFF737E44,
-0xFF949D64,
-0xFF6D763F,
-0xFF757C48,
-0xFF2F3602,
-0xFF979D6D,
-0xFF6D744B,
-0xFF545B32,
-0xFF5D6639,
-0xFFA2AC7A,
-0xFFA6B282,
-0xFF465222,
-0xFF5D6939,
-0xFF9BA479,
-0xFF8A916F,
-0xFF262D0C,
-0xFF788059,
-0xFF637042,
-0xFF667741,
-0xFF85965F,
-0xFF66733D,
-0xFF86935E,
-0xFF5C6A37,
-0xFF6C7D47,
-0xFF697841,
-0xFF76834E,
-0xFF343A0A,
-0xFF8A9064,
-0xFF4F572E,
-0xFF565E35,
-0xFF585B30,
-0xFF828654,
-0xFF7A8249,
-0xFF81894E,
-0xFF6E763B,
-0xFF879051,
-0xFF76803B,
-0xFF78813E,
-0xFF798148,
-0xFF818854,
-0xFF737A46,
-0xFF7D854C,
-0xFF576021,
-0xFF7F8847,
-0xFF8B9455,
-0xFF80884C,
-0xFF7F894A,
-0xFF7E884B,
-0xFF98A065,
-0xFF525923,
-0xFF899160,
-0xFF798150,
-0xFF4C5421,
-0xFF656E37,
-0xFF737C43,
-0xFF646D34,
-0xFF5F6831,
-0xFF505922,
-0xFF47501B,
-0xFF646C39,
-0xFF586031,
-0xFF6A723F,
-0xFF697135,
-0xFF7E8849,
-0xFF6F793D,
-0xFF596229,
-0xFF555C26,
-0xFF565E22,
-0xFFA9B06A,
-0xFF7E853F,
-0xFF81874B,
-0xFF767B41,
-0xFF9CA468,
-0xFF959D62,
-0xFF6A713D,
-0xFFCCD39F,
-0xFF9BA36A,
-0xFF636A36,
-0xFFA3A580,
-0xFFA5A984,
-0xFFB1B885,
-0xFF7C844B,
-0xFF9B9E65,
-0xFF81844B,
-0xFF656B2F,
-0xFF7D8549,
-0xFF6C7536,
-0xFF919759,
-0xFF84854B,
-0xFF82834A,
-0xFF7C7D44,
-0xFFB2B37A,
-0xFF9E9F65,
-0xFFB1B276,
-0xFFB2B073,
-0xFFA3A367,
-0xFF787B42,
-0xFF7B824C,
-0xFF737842,
-0xFF939860,
-0xFF888B54,
-0xFF9A9D66,
-0xFFCACB92,
-0xFFA6A76E,
-0xFFB4B57B,
-0xFF787C3F,
-0xFF6A6E31,
-0xFFAFB575,
-0xFF9CA360,
-0xFF8F9855,
-0xFF808A45,
-0xFF7A8541,
-0xFF707A3B,
-0xFF737D3E,
-0xFF96A061,
-0xFF828C4D,
-0xFF94A060,
-0xFF8F9B59,
-0xFF85924C,
-0xFF788442,
-0xFF687138,
-0xFF7A834E,
-0xFF3C4510,
-0xFF737B4A,
-0xFF484C29,
-0xFF5B5F3C,
-0xFF72784A,
-0xFF929966,
-0xFF8B9360,
-0xFF646E39,
-0xFF7F8954,
-0xFF3F4813,
-0xFF525B26,
-0xFFC1C797,
-0xFFB6BB93,
-0xFF45471F,
-0xFF525624,
-0xFF676B38,
-0xFF606638,
-0xFF999E75,
-0xFF5D623A,
-0xFF6C7149,
-0xFFB4B990,
-0xFF42481C,
-0xFFA6AC7C,
-0xFF5E6633,
-0xFF626A37,
-0xFF6C7642,
-0xFF6C7642,
-0xFF919B66,
-0xFF59632F,
-0xFF646E3A,
-0xFF687240,
-0xFF5D6637,
-0xFF6E7647,
-0xFF666C3E,
-0xFF4E5220,
-0xFF5E622F,
-0xFF797C47,
-0xFF959861,
-0xFF8C8F56,
-0xFF7E8247,
-0xFF888C51,
-0xFF8D9154,
-0xFF767B3B,
-0xFF808545,
-0xFF969C5E,
-0xFF909658,
-0xFF9FA569,
-0xFF8D9559,
-0xFF899155,
-0xFF737D3E,
-0xFF85904E,
-0xFF83904B,
-0xFFA7B46E,
-0xFF687530,
-0xFF657131,
-0xFFA2AC6F,
-0xFF757F40,
-0xFF586424,
-0xFF4F5B1D,
-0xFF7F8A4E,
-0xFF727D45,
-0xFF828D55,
-0xFF7C874F,
-0xFF7F8A4E,
-0xFF7D874A,
-0xFF869051,
-0xFF868F50,
-0xFF80884C,
-0xFF949961,
-0xFF848B55,
-0xFF77804B,
-0xFF939D69,
-0xFF7A824F,
-0xFF8B9360,
-0xFF4C5421,
-0xFF828A57,
-0xFF676F3C,
-0xFF535D2B,
-0xFF4C5624,
-0xFF5B6737,
-0xFF6B7948,
-0xFF4A5729,
-0xFF525E30,
-0xFF5E6A3C,
-0xFF404C1E,
-0xFF546032,
-0xFF525635,
-0xFF515534,
-0xFF404324,
-0xFF434627,
-0xFF4D532F,
-0xFF505632,
-0xFF5A5E3D,
-0xFF424526,
-0xFF4B4E2F,
-0xFF616445,
-0xFF353918,
-0xFF656948,
-0xFF64684D,
-0xFF5B5F44,
-0xFF656C4D,
-0xFF373D19,
-0xFF8A8D62,
-0xFF53562B,
-0xFF6B6D48,
-0xFF414524,
-0xFF2B3012,
-0xFF32361B,
-0xFF5C6246,
-0xFF414829,
-0xFF525937,
-0xFF323A15,
-0xFF3D431F,
-0xFF313715,
-0xFF4C4F30,
-0xFF25280D,
-0xFF252712,
-0xFF383723,
-0xFF37371D,
-0xFF4F5030,
-0xFF656944,
-0xFF939774,
-0xFF383B1E,
-0xFF4C4E38,
-0xFF6D705D,
-0xFF222512,
-0xFF1F210B,
-0xFF24270A,
-0xFF343515,
-0xFF191A00,
-0xFF302F11,
-0xFF343317,
-0xFF37361A,
-0xFF262509,
-0xFF54543A,
-0xFF4F4F33,
-0xFF1F2000,
-0xFF666747,
-0xFF747556,
-0xFF8C8D6D,
-0xFF4A4D22,
-0xFF909368,
-0xFF5B5C3C,
-0xFF5A5D40,
-0xFF4B5030,
-0xFF818763,
-0xFF7C855A,
-0xFF899267,
-0xFF646F47,
-0xFF555D38,
-0xFF979D79,
-0xFF434925,
-0xFF39401E,
-0xFF4B5532,
-0xFF5B663E,
-0xFF444C25,
-0xFF636943,
-0xFF3F4521,
-0xFF7A815F,
-0xFF49523D,
-0xFF3E474E,
-0xFF2A3247,
-0xFF21273D,
-0xFF252942,
-0xFF333251,
-0xFF31304F,
-0xFF292B44,
-0xFF202237,
-0xFF1A1B2D,
-0xFF181A27,
-0xFF13131D,
-0xFF0C0C14,
-0xFF090913,
-0xFF08090E,
-0xFF080A07,
-0xFF000400,
-0xFF616C4C,
-0xFF737D64,
-0xFF4D5557,
-0xFF363D50,
-0xFF323757,
-0xFF282C51,
-0xFF292C4B,
-0xFF2B2D46,
-0xFF212236,
-0xFF1B1D2C,
-0xFF111322,
-0xFF151724,
-0xFF141720,
-0xFF1A1D26,
-0xFF0D0F1C,
-0xFF101511,
-0xFF707A55,
-0xFFA2AF77,
-0xFF58682A,
-0xFF829254,
-0xFF8D9D5F,
-0xFF667439,
-0xFF8E9762,
-0xFF525828,
-0xFF646A3A,
-0xFF6F7545,
-0xFF808354,
-0xFF818759,
-0xFF4B4F2A,
-0xFF454B25,
-0xFF697247,
-0xFF838F5F,
-0xFF2F3D0C,
-0xFF6A7847,
-0xFF303E0D,
-0xFF2A350A,
-0xFF1C2603,
-0xFF141E00,
-0xFF37411C,
-0xFF323F13,
-0xFF4F5F2E,
-0xFF4E5F2B,
-0xFF818D5B,
-0xFF5E6A38,
-0xFF52602D,
-0xFF6B7946,
-0xFF6A7847,
-0xFF515A2B,
-0xFF4D5327,
-0xFF62673F,
-0xFF525832,
-0xFF656B45,
-0xFF676942,
-0xFF626337,
-0xFF8F945E,
-0xFF5A6227,
-0xFF7B834A,
-0xFFA3AB70,
-0xFF88914E,
-0xFF707A35,
-0xFF80854B,
-0xFF8C945B,
-0xFF5C6428,
-0xFF949D5E,
-0xFF7C8546,
-0xFF5B6327,
-0xFF586025,
-0xFF7C8449,
-0xFF8B9559,
-0xFF636D31,
-0xFF7B834A,
-0xFFB7BE8A,
-0xFF868E5F,
-0xFF394112,
-0xFF505924,
-0xFF889158,
-0xFF879154,
-0xFF525C20,
-0xFF757E45,
-0xFF808751,
-0xFF6D743E,
-0xFF848B55,
-0xFF7E824F,
-0xFF5F642C,
-0xFF616727,
-0xFF767F3C,
-0xFF848D4E,
-0xFF697336,
-0xFF7E864B,
-0xFF92985A,
-0xFF808741,
-0xFF676E28,
-0xFF75793C,
-0xFF7E8349,
-0xFF696F33,
-0xFF8C9459,
-0xFF8F9660,
-0xFFA9B07A,
-0xFFB9C186,
-0xFFA0A771,
-0xFF74764E,
-0xFF888A62,
-0xFF8A8E5B,
-0xFFA8AD73,
-0xFF83894D,
-0xFF888E50,
-0xFFAAB072,
-0xFF6D7635,
-0xFF737C3B,
-0xFF717739,
-0xFF8D9156,
-0xFF7E8148,
-0xFF8A8D54,
-0xFFAFB077,
-0xFF9A9B61,
-0xFF929357,
-0xFF9F9F5F,
-0xFFA5A768,
-0xFF696F33,
-0xFF626A2F,
-0xFF8C9459,
-0xFF91965E,
-0xFF898E56,
-0xFFA9AC75,
-0xFF696C33,
-0xFF8D9057,
-0xFF85884F,
-0xFF646A2E,
-0xFF63692D,
-0xFF8C9458,
-0xFFB5BE7F,
-0xFF818B4C,
-0xFF687331,
-0xFF828C4D,
-0xFF6F793D,
-0xFF6F793D,
-0xFF858F53,
-0xFF768043,
-0xFF586426,
-0xFF788444,
-0xFFA5B16F,
-0xFF8C9755,
-0xFF727C3F,
-0xFF6D753A,
-0xFF6E763D,
-0xFF73794B,
-0xFF38391A,
-0xFF49492F,
-0xFF494A28,
-0xFF686A42,
-0xFF6B7145,
-0xFF686E42,
-0xFF5B6133,
-0xFF545A2C,
-0xFF898C5F,
-0xFFC6C8A0,
-0xFF7D7E5C,
-0xFF3E3F1D,
-0xFF64673C,
-0xFF4A4D20,
-0xFF43451E,
-0xFF545833,
-0xFF585C39,
-0xFF393D1A,
-0xFF535732,
-0xFF767B52,
-0xFF93996B,
-0xFF6D7343,
-0xFF777F4C,
-0xFF5A622F,
-0xFF6E7645,
-0xFF798351,
-0xFF737B4C,
-0xFF30390C,
-0xFF30370D,
-0xFF5B6236,
-0xFF505829,
-0xFF5B6131,
-0xFF7A814E,
-0xFF868A58,
-0xFF898D5B,
-0xFF626633,
-0xFF989D65,
-0xFF73783E,
-0xFF868A4F,
-0xFF747A3C,
-0xFF767A3D,
-0xFF9BA163,
-0xFF676D2F,
-0xFF91975B,
-0xFF74793F,
-0xFF474C14,
-0xFF949C63,
-0xFF767E43,
-0xFF7F874C,
-0xFF707A3D,
-0xFF687233,
-0xFF717B3C,
-0xFF697336,
-0xFF808A4D,
-0xFF8C9659,
-0xFF535D20,
-0xFF697239,
-0xFF7C874F,
-0xFF717B46,
-0xFF79834E,
-0xFF77824A,
-0xFF6B763A,
-0xFF6C7637,
-0xFF929C5D,
-0xFF656E2F,
-0xFF848C51,
-0xFF848953,
-0xFF9DA471,
-0xFF7F8756,
-0xFF5A6432,
-0xFF858D5C,
-0xFF535B2A,
-0xFF626A39,
-0xFF707847,
-0xFF666E3D,
-0xFF707A46,
-0xFF76804C,
-0xFF84915C,
-0xFF586633,
-0xFF475524,
-0xFF768254,
-0xFF566234,
-0xFF495429,
-0xFF4F5A30,
-0xFF313713,
-0xFF626846,
-0xFF282D0D,
-0xFF5C6141,
-0xFF4A4E2B,
-0xFF494D2A,
-0xFF1E2201,
-0xFF424526,
-0xFF515638,
-0xFF4E5333,
-0xFF4A512F,
-0xFF777E5D,
-0xFF82886C,
-0xFF20260A,
-0xFF43482A,
-0xFF292F0D,
-0xFF7A7F56,
-0xFF4F5529,
-0xFF5F643B,
-0xFF4F532E,
-0xFF494F2B,
-0xFF5A603E,
-0xFF585D3D,
-0xFF585D3F,
-0xFF222709,
-0xFF1B2002,
-0xFF252A0C,
-0xFF454A2C,
-0xFF2E3313,
-0xFF313715,
-0xFF3D4321,
-0xFF7F8362,
-0xFF686949,
-0xFF6B6C4A,
-0xFF353614,
-0xFF494A2A,
-0xFF54573C,
-0xFF646650,
-0xFF797B66,
-0xFF6D6F59,
-0xFF77775D,
-0xFF5E5F40,
-0xFF676648,
-0xFF3D3C1E,
-0xFF4E4A2F,
-0xFF545033,
-0xFF535031,
-0xFF423F20,
-0xFF555637,
-0xFF383B1C,
-0xFF515532,
-0xFF656946,
-0xFF4D5031,
-0xFF565A37,
-0xFF757B4F,
-0xFF343A0E,
-0xFF414522,
-0xFF323516,
-0xFF444A28,
-0xFF4C522E,
-0xFF5E663D,
-0xFF2F3A10,
-0xFF87926A,
-0xFF58603B,
-0xFF353B17,
-0xFF515735,
-0xFF3F4627,
-0xFF3E4524,
-0xFF363E17,
-0xFF6E764D,
-0xFF474D29,
-0xFF393E1E,
-0xFF50563C,
-0xFF53594D,
-0xFF333947,
-0xFF21273F,
-0xFF22283E,
-0xFF272C42,
-0xFF2E2F4B,
-0xFF30304C,
-0xFF26283F,
-0xFF1C1F32,
-0xFF171928,
-0xFF141622,
-0xFF12121C,
-0xFF0D0D15,
-0xFF0A0A14,
-0xFF090A0F,
-0xFF000600,
-0xFF081000,
-0xFF6F7C50,
-0xFF77835F,
-0xFF4D5651,
-0xFF363D4F,
-0xFF313656,
-0xFF262A4D,
-0xFF1C2039,
-0xFF1F2235,
-0xFF16192A,
-0xFF111423,
-0xFF131426,
-0xFF111322,
-0xFF222430,
-0xFF11141D,
-0xFF070A13,
-0xFF0D120B,
-0xFF8D986E,
-0xFF8B995E,
-0xFF5D6B30,
-0xFFAFBC84,
-0xFF5A6732,
-0xFF737C4F,
-0xFF434724,
-0xFF575839,
-0xFF525333,
-0xFF565833,
-0xFF66673F,
-0xFF4B4D25,
-0xFF5A5E39,
-0xFF656B45,
-0xFF636C41,
-0xFF4E5A2C,
-0xFF1B2800,
-0xFF6A7749,
-0xFF687643,
-0xFF414F1C,
-0xFF475426,
-0xFF586338,
-0xFF4E592F,
-0xFF3E4B20,
-0xFF3B4A1F,
-0xFF3A471B,
-0xFF465224,
-0xFF404C1C,
-0xFF404E1D,
-0xFF4D5A2C,
-0xFF505B30,
-0xFF485027,
-0xFF434722,
-0xFF5B5D38,
-0xFF4A4E2B,
-0xFF6C704D,
-0xFF545432,
-0xFF4D4D27,
-0xFF686B3C,
-0xFF595D2A,
-0xFF424516,
-0xFF818552,
-0xFF6C7236,
-0xFF8A9050,
-0xFF9DA067,
-0xFF6A6F35,
-0xFF7D8345,
-0xFF717739,
-0xFF6E7438,
-0xFF7B8048,
-0xFF929963,
-0xFFA0A773,
-0xFF6F7640,
-0xFF788047,
-0xFF646C31,
-0xFF99A06A,
-0xFF454B1D,
-0xFF5E6436,
-0xFF59602A,
-0xFF6A7237,
-0xFF6C7438,
-0xFF444C10,
-0xFF50581F,
-0xFF767B43,
-0xFF4D5218,
-0xFF7D8347,
-0xFF767940,
-0xFF55581F,
-0xFF7C8045,
-0xFF898D52,
-0xFF646C30,
-0xFF757D41,
-0xFF7E8349,
-0xFF6A7034,
-0xFF55591C,
-0xFF606427,
-0xFF85864D,
-0xFF63662F,
-0xFF666B35,
-0xFF636832,
-0xFF959A62,
-0xFFBEC488,
-0xFFAAB070,
-0xFFB5BB7B,
-0xFF80834A,
-0xFF8D9059,
-0xFF7D8047,
-0xFF8A9054,
-0xFFB1B779,
-0xFF787E40,
-0xFFBDC385,
-0xFF676D2F,
-0xFF8B9153,
-0xFF969C5E,
-0xFF73793D,
-0xFF919759,
-0xFF808648,
-0xFFB7BB7E,
-0xFF9FA064,
-0xFFAFB172,
-0xFF8B8D4E,
-0xFF63672A,
-0xFF80894A,
-0xFF6E783B,
-0xFF7B8548,
-0xFF969E63,
-0xFF9FA76C,
-0xFF9CA167,
-0xFF989D63,
-0xFF676C32,
-0xFF53581E,
-0xFF53581E,
-0xFF585D23,
-0xFF8B9358,
-0xFF8D955A,
-0xFF596327,
-0xFF707A3E,
-0xFF859054,
-0xFF656E37,
-0xFF929B64,
-0xFF5F6831,
-0xFF475019,
-0xFF6F7841,
-0xFF4B541B,
-0xFF879152,
-0xFF7F8849,
-0xFF5D6627,
-0xFF82884C,
-0xFF7D824A,
-0xFF6E7144,
-0xFF232206,
-0xFF5E5C45,
-0xFF5D5C40,
-0xFF434223,
-0xFF545432,
-0xFF4F4F2D,
-0xFF31310F,
-0xFF3E3E1A,
-0xFF2D2D09,
-0xFF2E2E0C,
-0xFF727153,
-0xFF383719,
-0xFF5D5D37,
-0xFF33350E,
-0xFF5E5F3D,
-0xFF4C4D2D,
-0xFF515532,
-0xFF474B28,
-0xFF444A26,
-0xFF585F36,
-0xFF737A4E,
-0xFF697140,
-0xFF616936,
-0xFF4D5522,
-0xFF535B2C,
-0xFF7B8256,
-0xFF4C5129,
-0xFF505630,
-0xFF494D28,
-0xFF646B41,
-0xFF4D5526,
-0xFF626A37,
-0xFF6F7744,
-0xFF565C2C,
-0xFF5D6335,
-0xFF656B3B,
-0xFF787F49,
-0xFF646C31,
-0xFF90965A,
-0xFFA0A86C,
-0xFF878D51,
-0xFF80864A,
-0xFF7B8145,
-0xFF63682E,
-0xFF676C34,
-0xFF6B703A,
-0xFF7A7F49,
-0xFF777C46,
-0xFF636832,
-0xFF6F773E,
-0xFF586025,
-0xFF687035,
-0xFF687035,
-0xFF737B3F,
-0xFF858D51,
-0xFF879154,
-0xFF677037,
-0xFF636C35,
-0xFF535C27,
-0xFF7E8752,
-0xFF606932,
-0xFF8A935A,
-0xFF6F773B,
-0xFF70793A,
-0xFF3E460A,
-0xFF6E763D,
-0xFF8E925F,
-0xFF6E7444,
-0xFF929A69,
-0xFF444E1C,
-0xFF4E5627,
-0xFF495024,
-0xFF6A7145,
-0xFF5B6236,
-0xFF666E3F,
-0xFF737D4B,
-0xFF757F4B,
-0xFF8A9762,
-0xFF45531E,
-0xFF6A7845,
-0xFF5F6B3B,
-0xFF1E2900,
-0xFF333E14,
-0xFF444F27,
-0xFF343A16,
-0xFF6D7351,
-0xFF4E5333,
-0xFF424526,
-0xFF5B5C3A,
-0xFF343513,
-0xFF3B3C1C,
-0xFF2B2E0F,
-0xFF2C3113,
-0xFF353C1B,
-0xFF636D4B,
-0xFF7A8462,
-0xFF3A4024,
-0xFF21270D,
-0xFF2E3217,
-0xFF383D1D,
-0xFF797D5A,
-0xFF3C401B,
-0xFF636840,
-0xFF373C14,
-0xFF3F461D,
-0xFF383F16,
-0xFF454B25,
-0xFF8D936F,
-0xFF757A5A,
-0xFF7E8365,
-0xFF23270C,
-0xFF44482D,
-0xFF595E3E,
-0xFF515735,
-0xFF8D936D,
-0xFF737953,
-0xFF777B58,
-0xFF3F401E,
-0xFF3B3C1A,
-0xFF656647,
-0xFF3D4025,
-0xFF20220C,
-0xFF41432D,
-0xFF5A5D42,
-0xFF5D5E3F,
-0xFF6B6C4C,
-0xFF79785A,
-0xFFA3A284,
-0xFF979378,
-0xFF747053,
-0xFF9D9976,
-0xFF8C8966,
-0xFF454926,
-0xFF3B411D,
-0xFF4D532D,
-0xFF5A603A,
-0xFF797F5D,
-0xFF555936,
-0xFF42481C,
-0xFF3B4115,
-0xFF50542F,
-0xFF4E5231,
-0xFF505634,
-0xFF5D633F,
-0xFF4B532A,
-0xFF384319,
-0xFF979F7A,
-0xFF303715,
-0xFF383F1D,
-0xFF585D3D,
-0xFF636A49,
-0xFF545B39,
-0xFF505831,
-0xFF424920,
-0xFF535734,
-0xFF464A2F,
-0xFF383B2A,
-0xFF4F5352,
-0xFF2B3141,
-0xFF1A203A,
-0xFF272D45,
-0xFF2F334C,
-0xFF2D2E4A,
-0xFF32334F,
-0xFF1D1F36,
-0xFF171A2D,
-0xFF161827,
-0xFF151723,
-0xFF14141E,
-0xFF0F0F17,
-0xFF090913,
-0xFF050608,
-0xFF000400,
-0xFF485230,
-0xFF798754,
-0xFF738257,
-0xFF434D45,
-0xFF272E40,
-0xFF323956,
-0xFF303555,
-0xFF2C3049,
-0xFF1D2033,
-0xFF232637,
-0xFF2A2D3E,
-0xFF313244,
-0xFF313244,
-0xFF1D1F2C,
-0xFF060814,
-0xFF0B0E17,
-0xFF060B04,
-0xFF5B663E,
-0xFF67743E,
-0xFF73804A,
-0xFF94A16C,
-0xFF3F4B1B,
-0xFF252D04,
-0xFF44472A,
-0xFF515139,
-0xFF48462F,
-0xFF3F3E22,
-0xFF50502E,
-0xFF7D7F5A,
-0xFF8B8F6A,
-0xFF5D643B,
-0xFF5E6738,
-0xFF4E5A2A,
-0xFF455224,
-0xFF515E30,
-0xFF687945,
-0xFF6A7B45,
-0xFF7F8D58,
-0xFF576534,
-0xFF758056,
-0xFF2D3810,
-0xFF4C5830,
-0xFF38451A,
-0xFF313C11,
-0xFF616A3D,
-0xFF535F31,
-0xFF6A754A,
-0xFF50582F,
-0xFF5C623C,
-0xFF4A4B29,
-0xFF535432,
-0xFF5D5E3C,
-0xFF555634,
-0xFF7D7A5B,
-0xFF464320,
-0xFF65663C,
-0xFF777A4D,
-0xFF5B5D35,
-0xFF7B7E51,
-0xFF6B6D3B,
-0xFFA4A770,
-0xFF82854C,
-0xFF6E7237,
-0xFF7B8143,
-0xFF6D7335,
-0xFF73783E,
-0xFF868B53,
-0xFF6C733F,
-0xFF79804D,
-0xFF5F6632,
-0xFF7A814B,
-0xFF4D551A,
-0xFF6D743E,
-0xFF93996B,
-0xFF7F8557,
-0xFF767D47,
-0xFFA2AA6F,
-0xFF60682D,
-0xFF777F44,
-0xFF858A54,
-0xFF757A42,
-0xFF878B50,
-0xFF56571B,
-0xFF5B5C22,
-0xFF8E8F56,
-0xFF777640,
-0xFF6E6E38,
-0xFF73783E,
-0xFF858B4F,
-0xFF73763D,
-0xFF75783F,
-0xFF6F7036,
-0xFF717238,
-0xFF898953,
-0xFF83834F,
-0xFF9C9E6C,
-0xFF5D622C,
-0xFFA7AC72,
-0xFF858B4D,
-0xFFB0B773,
-0xFFA2A965,
-0xFFB0B676,
-0xFF6C7033,
-0xFFA8AC6F,
-0xFF6D7134,
-0xFFB2BB7C,
-0xFFB2BB7C,
-0xFF92985C,
-0xFFA3A96D,
-0xFF9B9E65,
-0xFF8F9358,
-0xFF60682C,
-0xFF9BA465,
-0xFF7B8443,
-0xFFC6CC8C,
-0xFF9EA363,
-0xFFACAD71,
-0xFF73773C,
-0xFF70763A,
-0xFFA9B374,
-0xFF626C2D,
-0xFF5B6528,
-0xFF929C5F,
-0xFF9AA267,
-0xFF90985D,
-0xFF71763C,
-0xFF72773D,
-0xFF838850,
-0xFF7E864D,
-0xFF6F773E,
-0xFF616A33,
-0xFF626B34,
-0xFF6D7840,
-0xFF848F57,
-0xFF87925A,
-0xFF5D662F,
-0xFF555E29,
-0xFF697140,
-0xFF616938,
-0xFF646C39,
-0xFF5E6531,
-0xFF676F36,
-0xFF7E8349,
-0xFF777C42,
-0xFF72753E,
-0xFF6C6C3A,
-0xFF98966D,
-0xFF2F2A0D,
-0xFF140E00,
-0xFF534D33,
-0xFF676245,
-0xFF817C5F,
-0xFF3E391C,
-0xFFB3AD93,
-0xFF332D13,
-0xFF817C5C,
-0xFF423F1E,
-0xFF7A7758,
-0xFF515031,
-0xFF80805C,
-0xFF61613B,
-0xFF3A3B19,
-0xFF797B56,
-0xFFA0A57C,
-0xFF4F5529,
-0xFF474E24,
-0xFF7F865C,
-0xFF4B5324,
-0xFF6A7241,
-0xFF57602B,
-0xFF929A67,
-0xFF747A4C,
-0xFF50552D,
-0xFF3B3F1C,
-0xFF2C300D,
-0xFF525631,
-0xFF71784E,
-0xFF525A29,
-0xFF58602D,
-0xFF7B8350,
-0xFF656F3D,
-0xFF454E21,
-0xFF596233,
-0xFF88915A,
-0xFF6B7539,
-0xFF3D470B,
-0xFF889255,
-0xFFA7B175,
-0xFF61692E,
-0xFF71793E,
-0xFF575C24,
-0xFF727741,
-0xFF7D824C,
-0xFF696D3A,
-0xFF767A47,
-0xFF868A57,
-0xFF6A6E3B,
-0xFF6C713B,
-0xFF797E48,
-0xFF666E35,
-0xFF717940,
-0xFF757D42,
-0xFF6F773C,
-0xFF5D662D,
-0xFF555E27,
-0xFF7A834E,
-0xFF6D7641,
-0xFF6D7641,
-0xFF88915A,
-0xFF646C31,
-0xFF7D854A,
-0xFF81894E,
-0xFF6C743B,
-0xFF767D4A,
-0xFF6E7542,
-0xFF6D7542,
-0xFF737D4B,
-0xFF424A1B,
-0xFF6D7448,
-0xFF7A8158,
-0xFF61683F,
-0xFF383F15,
-0xFF7B8457,
-0xFF5E6A38,
-0xFF677341,
-0xFF5B6934,
-0xFF768451,
-0xFF475323,
-0xFF444F24,
-0xFF515C32,
-0xFF505B33,
-0xFF4B4F2C,
-0xFF565A39,
-0xFF525334,
-0xFF363517,
-0xFF514E2D,
-0xFF3E3B1A,
-0xFF5D5C3D,
-0xFF3C3D1E,
-0xFF383D1F,
-0xFF5A6140,
-0xFF66704E,
-0xFF626C4A,
-0xFF3D4329,
-0xFF1A2006,
-0xFF25290E,
-0xFF161900,
-0xFFA1A489,
-0xFF36391C,
-0xFF3F4322,
-0xFF4E522D,
-0xFF70764A,
-0xFF4B5121,
-0xFF505628,
-0xFF82885C,
-0xFF42471F,
-0xFF8E926F,
-0xFF262B0B,
-0xFF313618,
-0xFF3A4122,
-0xFF6C7352,
-0xFF3E4524,
-0xFF393F1D,
-0xFF464A27,
-0xFF565A37,
-0xFF3A3E1D,
-0xFF595C3D,
-0xFF404328,
-0xFF32351A,
-0xFF4A4D32,
-0xFF3B3E1F,
-0xFF565735,
-0xFFA1A37E,
-0xFF434223,
-0xFF535233,
-0xFF6A6649,
-0xFF7E7B5C,
-0xFF908E68,
-0xFF7D7E56,
-0xFF747B52,
-0xFF565E35,
-0xFF2D360B,
-0xFF757E53,
-0xFF656D46,
-0xFF5C623C,
-0xFF575E34,
-0xFF5D6438,
-0xFF5D633D,
-0xFF646A46,
-0xFF6B714F,
-0xFFAAB08E,
-0xFF414721,
-0xFF878F68,
-0xFF3E4422,
-0xFF2A3110,
-0xFF555C3B,
-0xFF515836,
-0xFF7E8462,
-0xFFA4AA86,
-0xFF8B916B,
-0xFF5B5F3A,
-0xFF3C401B,
-0xFF3E4227,
-0xFF4A4B45,
-0xFF3D4049,
-0xFF282B3E,
-0xFF21253E,
-0xFF262C46,
-0xFF2C324C,
-0xFF313550,
-0xFF262841,
-0xFF191B30,
-0xFF131627,
-0xFF10121F,
-0xFF0D1019,
-0xFF0B0B13,
-0xFF0A0B10,
-0xFF08090E,
-0xFF030502,
-0xFF2A321B,
-0xFF68734B,
-0xFF899861,
-0xFF849467,
-0xFF727B76,
-0xFF2F3648,
-0xFF262D49,
-0xFF262B49,
-0xFF1D213C,
-0xFF292B42,
-0xFF282A3F,
-0xFF191C2F,
-0xFF1F2032,
-0xFF262837,
-0xFF030512,
-0xFF0F111D,
-0xFF0B0B17,
-0xFF090B08,
-0xFF656C4B,
-0xFF636C3D,
-0xFFA7B17F,
-0xFF596331,
-0xFF344010,
-0xFF80895E,
-0xFF989E7A,
-0xFF424526,
-0xFF2B2B13,
-0xFF36361E,
-0xFF49492D,
-0xFF696A4A,
-0xFF555934,
-0xFF767D51,
-0xFF67713C,
-0xFF5C6933,
-0xFF5C693B,
-0xFF313E12,
-0xFF6F7C4E,
-0xFF72804F,
-0xFF434F1D,
-0xFF556131,
-0xFF646F45,
-0xFF27320A,
-0xFF626F44,
-0xFF202D01,
-0xFF697547,
-0xFF586134,
-0xFF374015,
-0xFF969F74,
-0xFF60683F,
-0xFF5F653F,
-0xFF70714F,
-0xFF535331,
-0xFF4B4A2B,
-0xFF5E5D3E,
-0xFF807D5C,
-0xFF8B8867,
-0xFF696945,
-0xFF51512D,
-0xFF585834,
-0xFF4C4C26,
-0xFF5C5D33,
-0xFF5F6132,
-0xFF7D804B,
-0xFF80834A,
-0xFF65682F,
-0xFF9A9E63,
-0xFF797F43,
-0xFF676C32,
-0xFF757946,
-0xFF818552,
-0xFF9DA46E,
-0xFF777F46,
-0xFF646C33,
-0xFF616834,
-0xFF5D6333,
-0xFF858B5B,
-0xFF7F8650,
-0xFF747C43,
-0xFF565B25,
-0xFF777B48,
-0xFF585A28,
-0xFF7C7F4A,
-0xFF7C7D43,
-0xFFA7A86E,
-0xFF77763E,
-0xFF9A9865,
-0xFF7B7748,
-0xFF838150,
-0xFF7B7C43,
-0xFF61642B,
-0xFF7B7B45,
-0xFF888751,
-0xFF9A9A5E,
-0xFF4C4C10,
-0xFF5B5A22,
-0xFF8F8F59,
-0xFF7C7F46,
-0xFF8B9056,
-0xFF9EA369,
-0xFFACB478,
-0xFF98A15E,
-0xFFABB570,
-0xFF868F50,
-0xFF93995D,
-0xFF696D30,
-0xFF575B1E,
-0xFFA5AD71,
-0xFFA3AB6F,
-0xFF959A60,
-0xFF70753B,
-0xFF898C55,
-0xFF777A43,
-0xFF7C8448,
-0xFFACB677,
-0xFF8C9554,
-0xFFA5AB6B,
-0xFF828747,
-0xFF979B60,
-0xFF878C54,
-0xFF6B743B,
-0xFF919B5E,
-0xFF737F3F,
-0xFF929E60,
-0xFF99A567,
-0xFF8E985C,
-0xFF697337,
-0xFF99A168,
-0xFF6B733A,
-0xFF69703A,
-0xFF6E753F,
-0xFF555C26,
-0xFF6D7641,
-0xFF6E7742,
-0xFFB4BE89,
-0xFF656F3A,
-0xFF98A26D,
-0xFF2F3801,
-0xFF949B67,
-0xFF585E32,
-0xFF71764D,
-0xFF686E42,
-0xFF7C7F50,
-0xFF787C49,
-0xFF727442,
-0xFF6F6E40,
-0xFF656438,
-0xFF6A673C,
-0xFF77734D,
-0xFF766F52,
-0xFF4F482E,
-0xFF6D6348,
-0xFF8A8065,
-0xFF8E8469,
-0xFF7F755C,
-0xFF847C69,
-0xFF7F7762,
-0xFF6E6848,
-0xFF75714C,
-0xFF8D8963,
-0xFF504E27,
-0xFF5B5C34,
-0xFF4F5028,
-0xFF54562E,
-0xFF949768,
-0xFF7D854C,
-0xFF969E63,
-0xFF525B24,
-0xFF6E7643,
-0xFF78824E,
-0xFF656F3A,
-0xFF525B26,
-0xFF5A622F,
-0xFF646A3E,
-0xFF3F431E,
-0xFF3A3E1D,
-0xFF4A4E2B,
-0xFF5A6138,
-0xFF4A5125,
-0xFF69713E,
-0xFF68723E,
-0xFF737D49,
-0xFF5D6937,
-0xFF5B6739,
-0xFF3A4616,
-0xFF657038,
-0xFF747F45,
-0xFF879258,
-0xFF838E52,
-0xFF6F7A40,
-0xFF828B52,
-0xFF697239,
-0xFF80884F,
-0xFF4D541E,
-0xFF787F4B,
-0xFF7C804D,
-0xFF4A4E1B,
-0xFF939564,
-0xFF757746,
-0xFF818351,
-0xFF929663,
-0xFF626936,
-0xFF606733,
-0xFF7A8249,
-0xFF5E662B,
-0xFF687034,
-0xFF5F672C,
-0xFF7F8851,
-0xFF6E7742,
-0xFF666E3B,
-0xFF7B8350,
-0xFF6C753E,
-0xFF7D864F,
-0xFF818A53,
-0xFF737C45,
-0xFF5E6732,
-0xFF747D48,
-0xFF717B46,
-0xFF616B37,
-0xFF626A3B,
-0xFF4B5228,
-0xFF626842,
-0xFF484E2A,
-0xFF5E663F,
-0xFF5B633A,
-0xFF525E30,
-0xFF394515,
-0xFF768451,
-0xFF505E2B,
-0xFF7B8757,
-0xFF556133,
-0xFF5D663B,
-0xFF515930,
-0xFF474725,
-0xFF393917,
-0xFF4C482B,
-0xFF464124,
-0xFF4D4727,
-0xFF635E3E,
-0xFF7F7C5D,
-0xFF1C1D00,
-0xFF6B7052,
-0xFF6D7453,
-0xFF2B3512,
-0xFF5A6442,
-0xFF2C3218,
-0xFF3A3E25,
-0xFF2E3116,
-0xFF52553A,
-0xFF35371F,
-0xFF5B5D45,
-0xFF4A4D2E,
-0xFF555934,
-0xFF292F03,
-0xFF515425,
-0xFF434617,
-0xFF45481B,
-0xFF676941,
-0xFF60643F,
-0xFF313415,
-0xFF282D0D,
-0xFF464B2D,
-0xFF737A59,
-0xFF484F2E,
-0xFF343B19,
-0xFF454B27,
-0xFF444A26,
-0xFF5C603B,
-0xFF282E0A,
-0xFF4E5132,
-0xFF525739,
-0xFF313417,
-0xFF2C2F10,
-0xFF7B7F5A,
-0xFF767851,
-0xFFABAD88,
-0xFF40401E,
-0xFF484826,
-0xFF848460,
-0xFF57552C,
-0xFFADB083,
-0xFF414A1F,
-0xFF667347,
-0xFF5F6C3E,
-0xFF8B9769,
-0xFF313C12,
-0xFF525A31,
-0xFF41481E,
-0xFF99A076,
-0xFF434A21,
-0xFF4A502A,
-0xFF404624,
-0xFF2D3011,
-0xFF202401,
-0xFF585C39,
-0xFF606344,
-0xFF6F7454,
-0xFF4D5232,
-0xFF767C58,
-0xFF222802,
-0xFF2C3109,
-0xFF565A35,
-0xFF4B4F2A,
-0xFF878C64,
-0xFF7C8067,
-0xFF4B4C50,
-0xFF2E2F41,
-0xFF23253A,
-0xFF1B2036,
-0xFF30344F,
-0xFF2F3451,
-0xFF2C3049,
-0xFF1D2238,
-0xFF16192C,
-0xFF131627,
-0xFF121421,
-0xFF10131C,
-0xFF0E0F14,
-0xFF0D0E12,
-0xFF090A0C,
-0xFF020500,
-0xFF60694C,
-0xFF737E53,
-0xFF3A4912,
-0xFF67734B,
-0xFF59625F,
-0xFF2F3649,
-0xFF2F354F,
-0xFF272C49,
-0xFF262A45,
-0xFF1C1E35,
-0xFF111328,
-0xFF0E1124,
-0xFF121423,
-0xFF151724,
-0xFF1E202D,
-0xFF0F111D,
-0xFF0B0B17,
-0xFF0B0D0C,
-0xFF363C22,
-0xFF575F38,
-0xFF596237,
-0xFF1E2700,
-0xFF343F14,
-0xFF6D764B,
-0xFF5B6238,
-0xFF5A5E39,
-0xFF393C1F,
-0xFF27270D,
-0xFF5C5C40,
-0xFF4C502D,
-0xFF787D54,
-0xFF757D4C,
-0xFF5E692F,
-0xFF6D783E,
-0xFF232F01,
-0xFF354016,
-0xFF808B61,
-0xFF354015,
-0xFF586134,
-0xFF3F481B,
-0xFF576238,
-0xFF59643A,
-0xFF849062,
-0xFF919D6D,
-0xFF616A3D,
-0xFF50592C,
-0xFF596237,
-0xFF9DA47A,
-0xFF596036,
-0xFF7F845B,
-0xFF71734E,
-0xFF555533,
-0xFF656445,
-0xFF464324,
-0xFF666141,
-0xFF868360,
-0xFF7E7B5A,
-0xFF81815F,
-0xFF83835F,
-0xFF6F6F49,
-0xFFA9A983,
-0xFF45461C,
-0xFF777947,
-0xFF92955E,
-0xFF757841,
-0xFF7C7F46,
-0xFF72783C,
-0xFF72783C,
-0xFF757A42,
-0xFF727741,
-0xFF8F975E,
-0xFF4E551F,
-0xFF7D8451,
-0xFF585E30,
-0xFF595F33,
-0xFF848A5C,
-0xFF4C5320,
-0xFF727945,
-0xFF666A38,
-0xFF7D8051,
-0xFF67693A,
-0xFF606231,
-0xFF8D8D59,
-0xFF9A9A66,
-0xFFA09C6C,
-0xFF918D5E,
-0xFF747041,
-0xFF979363,
-0xFF8A8953,
-0xFF9B9A64,
-0xFF6F6D3C,
-0xFFB7B584,
-0xFF8A884F,
-0xFFA4A267,
-0xFF96955F,
-0xFF7E7E48,
-0xFF8C9055,
-0xFFC9CF93,
-0xFF7E864D,
-0xFF899356,
-0xFF9AA561,
-0xFFACB772,
-0xFF869051,
-0xFFA6AE72,
-0xFF777A41,
-0xFF767940,
-0xFF8F975B,
-0xFFA7B174,
-0xFF979F64,
-0xFF62672F,
-0xFF929560,
-0xFF7F844E,
-0xFF7D864D,
-0xFF455014,
-0xFF889255,
-0xFF8A9354,
-0xFF797D42,
-0xFF64672E,
-0xFF6F7640,
-0xFF646D36,
-0xFF869155,
-0xFFA5B173,
-0xFF778345,
-0xFF929E60,
-0xFF778145,
-0xFF798347,
-0xFFB0B87F,
-0xFF6A7239,
-0xFF434A14,
-0xFF828953,
-0xFF59622D,
-0xFF7E8752,
-0xFF7B8551,
-0xFF5B6531,
-0xFF98A570,
-0xFF7C8651,
-0xFF5C642B,
-0xFF707743,
-0xFF9A9C74,
-0xFF61633C,
-0xFF64663E,
-0xFF5C5D31,
-0xFF6B6C40,
-0xFF6C6A41,
-0xFF7E7A55,
-0xFF4B4523,
-0xFF625C3A,
-0xFF786F50,
-0xFF5E5439,
-0xFF63573D,
-0xFFA59A7E,
-0xFF968B6F,
-0xFF463B1F,
-0xFF5B4F37,
-0xFF554837,
-0xFF726753,
-0xFF786F4E,
-0xFFA39E74,
-0xFF9A9669,
-0xFF545124,
-0xFF717044,
-0xFF5D5E32,
-0xFF393C0D,
-0xFF7D824C,
-0xFFAAB370,
-0xFF717B34,
-0xFF6B7536,
-0xFF667034,
-0xFF77824A,
-0xFF657038,
-0xFF737C45,
-0xFF939B68,
-0xFF52582C,
-0xFF4D512C,
-0xFF595D3A,
-0xFF1E2200,
-0xFF4F562A,
-0xFF697140,
-0xFF5A6430,
-0xFF5C6934,
-0xFFA4B07E,
-0xFF293706,
-0xFF566433,
-0xFF5E6C39,
-0xFF44531A,
-0xFF88975C,
-0xFF96A469,
-0xFF738146,
-0xFF92A065,
-0xFF8C975D,
-0xFF535E24,
-0xFF7D864D,
-0xFF6B743D,
-0xFF7C834D,
-0xFF757946,
-0xFF818552,
-0xFF747644,
-0xFF646635,
-0xFF8D8F5E,
-0xFF5A5E2C,
-0xFF7F8253,
-0xFF6B723F,
-0xFF6D743E,
-0xFF6D753A,
-0xFF828A4E,
-0xFF666E32,
-0xFF5D662F,
-0xFF818956,
-0xFF808857,
-0xFF495120,
-0xFF59612E,
-0xFF5E6732,
-0xFF727B44,
-0xFF707B43,
-0xFF5E6732,
-0xFF616B36,
-0xFF59642C,
-0xFF5B6530,
-0xFF656D3E,
-0xFF92996F,
-0xFF606642,
-0xFF5F6543,
-0xFF4C542F,
-0xFF545C35,
-0xFF535E33,
-0xFF5F6B3B,
-0xFF556330,
-0xFF5D6B36,
-0xFF596533,
-0xFF616D3D,
-0xFF6C7548,
-0xFF3A4318,
-0xFF4C4624,
-0xFF585232,
-0xFF2E270B,
-0xFF5B5235,
-0xFF5D5232,
-0xFF6E6544,
-0xFF433E20,
-0xFF484729,
-0xFF6D7051,
-0xFF424928,
-0xFF3E4825,
-0xFF46502D,
-0xFF343A1E,
-0xFF20240B,
-0xFF2D3015,
-0xFF444428,
-0xFF4A4D32,
-0xFF838669,
-0xFF606141,
-0xFF585A35,
-0xFF676941,
-0xFF7A7B51,
-0xFF2E2F07,
-0xFF31330C,
-0xFF4B4C2A,
-0xFF383B1C,
-0xFF373A1D,
-0xFF1E2305,
-0xFF2E3313,
-0xFF4A502E,
-0xFF737B54,
-0xFF262E07,
-0xFF2E3611,
-0xFF3B431C,
-0xFF61683E,
-0xFF98A176,
-0xFF5F653F,
-0xFF575E3C,
-0xFF474C2E,
-0xFF454A2C,
-0xFF414725,
-0xFF3A3E19,
-0xFF4F542C,
-0xFF93956D,
-0xFF676941,
-0xFF6A6D42,
-0xFF5D5F30,
-0xFF7E8454,
-0xFF404E1D,
-0xFF6A7A49,
-0xFF869763,
-0xFF313F0E,
-0xFF232E03,
-0xFF7B865C,
-0xFF676F46,
-0xFF62693F,
-0xFF444B22,
-0xFF515530,
-0xFF4F5332,
-0xFF38391A,
-0xFF363717,
-0xFF2C2D0D,
-0xFF26260A,
-0xFF46462A,
-0xFF505634,
-0xFF3B411B,
-0xFFA4AA7E,
-0xFF63663B,
-0xFF6E7049,
-0xFF636540,
-0xFF5A5E39,
-0xFF4B4E39,
-0xFF393945,
-0xFF2D2D47,
-0xFF1F2136,
-0xFF21263C,
-0xFF2C304B,
-0xFF343855,
-0xFF20263E,
-0xFF13182C,
-0xFF16192A,
-0xFF121524,
-0xFF121420,
-0xFF0A0D14,
-0xFF121317,
-0xFF0E100F,
-0xFF020500,
-0xFF373B2A,
-0xFF535A39,
-0xFF7A855A,
-0xFF677542,
-0xFF36411F,
-0xFF474F51,
-0xFF1D2339,
-0xFF242A44,
-0xFF232943,
-0xFF44495F,
-0xFF34364B,
-0xFF272A3D,
-0xFF232637,
-0xFF1E202D,
-0xFF20222F,
-0xFF22212F,
-0xFF0E0D1B,
-0xFF0D0C1A,
-0xFF08090D,
-0xFF454938,
-0xFF171E00,
-0xFF464D2C,
-0xFF474E2D,
-0xFF535A39,
-0xFF7B835E,
-0xFF737C4D,
-0xFF575F30,
-0xFF5A603A,
-0xFF494D2C,
-0xFF4D512E,
-0xFF61663E,
-0xFF878D5F,
-0xFF9BA46F,
-0xFF8B965A,
-0xFF5B662C,
-0xFF6A7346,
-0xFF626A43,
-0xFF828A63,
-0xFF555D36,
-0xFF4B5229,
-0xFF777E54,
-0xFF575F36,
-0xFF626D42,
-0xFF3E4A18,
-0xFF808A56,
-0xFF848E5C,
-0xFF727B4C,
-0xFF636A3E,
-0xFF8D9367,
-0xFF8C9264,
-0xFF6D7043,
-0xFF7A7B53,
-0xFF72724E,
-0xFF6D6A4B,
-0xFF575234,
-0xFF3C3813,
-0xFF525029,
-0xFF3D3B15,
-0xFF575830,
-0xFF64653B,
-0xFF7C7D53,
-0xFF5E5F37,
-0xFF98996F,
-0xFF939563,
-0xFF747742,
-0xFF939661,
-0xFF83864F,
-0xFF82884A,
-0xFF9BA161,
-0xFF959D61,
-0xFF5D652A,
-0xFF99A166,
-0xFF8A915D,
-0xFF656A41,
-0xFF373B18,
-0xFF737754,
-0xFF353A12,
-0xFF5D6335,
-0xFF5C6232,
-0xFF818759,
-0xFF646A3E,
-0xFF696C41,
-0xFF6C6D43,
-0xFF68673B,
-0xFF737148,
-0xFF4C4721,
-0xFF938E66,
-0xFF66602E,
-0xFF908D56,
-0xFF827F4C,
-0xFF8D8959,
-0xFF706B41,
-0xFFC0BB91,
-0xFF898653,
-0xFFA4A16C,
-0xFF989663,
-0xFF8F8F5B,
-0xFF90955B,
-0xFF99A165,
-0xFF8F985F,
-0xFF7E894D,
-0xFF99A660,
-0xFF7D8A42,
-0xFF929F5A,
-0xFF717B3E,
-0xFF6A6D38,
-0xFF5B5D2B,
-0xFF788246,
-0xFFA5AF72,
-0xFFABB475,
-0xFF898F53,
-0xFFB0B37E,
-0xFFAFB380,
-0xFF78804D,
-0xFF747E49,
-0xFF636C35,
-0xFF5C642B,
-0xFFACAF78,
-0xFF3E430B,
-0xFF434C15,
-0xFF7F8A52,
-0xFFB3BE82,
-0xFF9DA86C,
-0xFF566125,
-0xFF9BA66A,
-0xFF5C652C,
-0xFFB2BB82,
-0xFF9DA66D,
-0xFF8F985F,
-0xFF6F7841,
-0xFF8C955E,
-0xFF555E29,
-0xFFA0A974,
-0xFF59632F,
-0xFF68723E,
-0xFF98A570,
-0xFF5D6732,
-0xFF858D52,
-0xFF81864E,
-0xFF75764C,
-0xFF83845C,
-0xFF525329,
-0xFF939266,
-0xFF98956C,
-0xFF8A8460,
-0xFF7A7356,
-0xFF8E846B,
-0xFF7F755C,
-0xFF83775F,
-0xFF483C24,
-0xFF372811,
-0xFF7F7157,
-0xFF796B4E,
-0xFF847659,
-0xFF86785D,
-0xFF61523D,
-0xFF887C64,
-0xFF857D56,
-0xFF696536,
-0xFF797545,
-0xFF898756,
-0xFF807F4F,
-0xFF636534,
-0xFF626633,
-0xFF676C32,
-0xFF646E25,
-0xFF6E792D,
-0xFF949D5A,
-0xFF7F894A,
-0xFF667135,
-0xFF7A854B,
-0xFF5F6831,
-0xFF737B48,
-0xFF696E45,
-0xFF7A7E59,
-0xFF7C805B,
-0xFF62673E,
-0xFF495120,
-0xFF6F7843,
-0xFF76804B,
-0xFF9FAC77,
-0xFFA5B382,
-0xFF5F6F3E,
-0xFF364711,
-0xFF5D6E37,
-0xFF52642A,
-0xFF798B51,
-0xFF6A7940,
-0xFF75844B,
-0xFF738249,
-0xFF9BA870,
-0xFF606E33,
-0xFF7F8A50,
-0xFF5B642B,
-0xFF434C13,
-0xFF555C26,
-0xFF939A64,
-0xFF9EA36D,
-0xFF666A37,
-0xFF777947,
-0xFF787C4A,
-0xFF6E7142,
-0xFF767D4A,
-0xFF666D37,
-0xFF7B8348,
-0xFF8C9659,
-0xFF5F692D,
-0xFF737C45,
-0xFF7D8552,
-0xFF697341,
-0xFF687240,
-0xFF6F7945,
-0xFF68723D,
-0xFF89945C,
-0xFF536028,
-0xFF9AA46F,
-0xFF6B7842,
-0xFF65723A,
-0xFF495620,
-0xFF40491A,
-0xFF454E23,
-0xFF494F29,
-0xFF2F3511,
-0xFF3D4520,
-0xFF3E461F,
-0xFF434F21,
-0xFF525E2E,
-0xFF697543,
-0xFF525F2A,
-0xFF66703E,
-0xFF586132,
-0xFF434A1E,
-0xFF82895F,
-0xFF3D3212,
-0xFF7F7456,
-0xFF54492D,
-0xFF615338,
-0xFF655838,
-0xFF817656,
-0xFF777053,
-0xFF8F8B6E,
-0xFF424324,
-0xFF292F0D,
-0xFF272F0A,
-0xFF474E2C,
-0xFF383E22,
-0xFF2A2E13,
-0xFF404326,
-0xFF7D7D61,
-0xFF585B3E,
-0xFF3A3D1E,
-0xFF686947,
-0xFF72744F,
-0xFF565630,
-0xFF383812,
-0xFF31310D,
-0xFF3D3D1B,
-0xFF646546,
-0xFF2F2F13,
-0xFF393C1F,
-0xFF181B00,
-0xFF252A0A,
-0xFF2A300C,
-0xFF5D653E,
-0xFF535B32,
-0xFF757D58,
-0xFF141C00,
-0xFF959E71,
-0xFF98A174,
-0xFF899168,
-0xFF545C37,
-0xFF313817,
-0xFF42492A,
-0xFF656B49,
-0xFF212701,
-0xFF696E45,
-0xFF70764A,
-0xFF1B2100,
-0xFF6D7345,
-0xFF9C9F70,
-0xFF4D5524,
-0xFF374514,
-0xFF61733F,
-0xFF97A874,
-0xFF34420F,
-0xFF3C471C,
-0xFF6C774D,
-0xFF505831,
-0xFF2D340B,
-0xFF7D8259,
-0xFF5D5F38,
-0xFF575839,
-0xFF4B4A2E,
-0xFF4B4A2C,
-0xFF363517,
-0xFF58543B,
-0xFF191800,
-0xFF777B58,
-0xFF3A3F17,
-0xFF66693C,
-0xFF545529,
-0xFF2C2D05,
-0xFF484A25,
-0xFF646847,
-0xFF414433,
-0xFF353746,
-0xFF2C2C48,
-0xFF23253C,
-0xFF26283F,
-0xFF2A2E49,
-0xFF2B2F4C,
-0xFF21253E,
-0xFF1C2135,
-0xFF1F2233,
-0xFF1D212D,
-0xFF151821,
-0xFF191C23,
-0xFF111216,
-0xFF0D0F0C,
-0xFF040800,
-0xFF555A43,
-0xFF182000,
-0xFF717A4F,
-0xFF535E33,
-0xFF404A2F,
-0xFF3C4349,
-0xFF2A2F45,
-0xFF252B43,
-0xFF191F35,
-0xFF2C3144,
-0xFF202336,
-0xFF23253A,
-0xFF202336,
-0xFF2E303F,
-0xFF292B38,
-0xFF1F1E2E,
-0xFF111020,
-0xFF0C0B19,
-0xFF08090D,
-0xFF5B5F50,
-0xFF373D23,
-0xFF242A0E,
-0xFF62684C,
-0xFF5B6049,
-0xFF4B5233,
-0xFFA0A97C,
-0xFF384112,
-0xFF454D24,
-0xFF373D17,
-0xFF575E35,
-0xFF767C50,
-0xFF424A1B,
-0xFF78804D,
-0xFF828D53,
-0xFF3C470F,
-0xFF525B2E,
-0xFF596037,
-0xFF525930,
-0xFF2B3008,
-0xFF959A71,
-0xFF787D54,
-0xFF3E471C,
-0xFF586134,
-0xFF656F3A,
-0xFF747D46,
-0xFF424C18,
-0xFF394110,
-0xFF41471B,
-0xFF878D61,
-0xFF6F7341,
-0xFF3C400E,
-0xFF838458,
-0xFF5B5B35,
-0xFF73704F,
-0xFF726D4D,
-0xFFB0AC86,
-0xFF838256,
-0xFF6D6E44,
-0xFF515226,
-0xFF898B5C,
-0xFF666839,
-0xFF7A7B51,
-0xFF68693F,
-0xFF7B7D4E,
-0xFF656736,
-0xFF5A5C2B,
-0xFF727741,
-0xFF92975D,
-0xFF6B7337,
-0xFF727A3E,
-0xFF80884D,
-0xFF868D57,
-0xFF5D6333,
-0xFF888C69,
-0xFF474A2B,
-0xFF494C2D,
-0xFF484C2B,
-0xFF5C603B,
-0xFF555A31,
-0xFF696E46,
-0xFF7C8159,
-0xFF65673F,
-0xFF3A3C15,
-0xFF696947,
-0xFF252203,
-0xFF5B5639,
-0xFF8D8765,
-0xFF595623,
-0xFF7F7D44,
-0xFF85824D,
-0xFF898757,
-0xFF524D25,
-0xFFD2CFA6,
-0xFFA29E6F,
-0xFF706E3D,
-0xFF9B9B69,
-0xFF959765,
-0xFFA4A973,
-0xFF8F985F,
-0xFF465119,
-0xFF5C6A2D,
-0xFFACBB76,
-0xFF92A35C,
-0xFF97A661,
-0xFF5E6A2A,
-0xFF6C703E,
-0xFF7F8351,
-0xFFA2AB72,
-0xFF768043,
-0xFFB8C182,
-0xFFA1A76B,
-0xFF575C26,
-0xFF8A915E,
-0xFF66703E,
-0xFF4B5523,
-0xFF8A935E,
-0xFF4C531D,
-0xFF6F743C,
-0xFF878C54,
-0xFF5A632E,
-0xFF6A753D,
-0xFF98A369,
-0xFF768145,
-0xFF616C30,
-0xFF859054,
-0xFF737C43,
-0xFF808950,
-0xFF939C63,
-0xFF9DA66D,
-0xFF97A069,
-0xFF6A733C,
-0xFF77804B,
-0xFFBDC691,
-0xFF6A7440,
-0xFF96A06C,
-0xFF555F2B,
-0xFF87925A,
-0xFF82884C,
-0xFF989B62,
-0xFF8A8C5D,
-0xFF86875B,
-0xFF8D8C5E,
-0xFF605D30,
-0xFF6F6A44,
-0xFF908A68,
-0xFF61583B,
-0xFF574D34,
-0xFF685B48,
-0xFF625544,
-0xFFA49484,
-0xFF7E6F5C,
-0xFF4D3C28,
-0xFF67573E,
-0xFF8C7E61,
-0xFF706245,
-0xFF3C2D16,
-0xFF4A3F23,
-0xFF8E865F,
-0xFFB5AE80,
-0xFF9F9B6C,
-0xFF696737,
-0xFF848353,
-0xFF777646,
-0xFF787A4B,
-0xFF7A7F49,
-0xFF565C1C,
-0xFF76803B,
-0xFF939959,
-0xFF828A4E,
-0xFF727C40,
-0xFF828B52,
-0xFF565F28,
-0xFF464E1B,
-0xFF5C6138,
-0xFF737850,
-0xFF3D421A,
-0xFF676D41,
-0xFF6E7742,
-0xFF67723A,
-0xFF7A844F,
-0xFF7A8752,
-0xFF768453,
-0xFF5F6F3E,
-0xFF82935C,
-0xFF63773A,
-0xFF56682E,
-0xFF5D6F35,
-0xFF56682E,
-0xFF72844A,
-0xFF9BAA71,
-0xFF79884F,
-0xFF87955A,
-0xFF849257,
-0xFF5E692F,
-0xFF3C460A,
-0xFF70783F,
-0xFF737B42,
-0xFF81864E,
-0xFF9EA36D,
-0xFF757745,
-0xFF6F7341,
-0xFF494F1F,
-0xFF919865,
-0xFF8A915B,
-0xFF969E65,
-0xFF737C43,
-0xFF868F56,
-0xFF454E19,
-0xFF5C6431,
-0xFF687240,
-0xFF757F4D,
-0xFF79834E,
-0xFF4B5820,
-0xFF6D7A42,
-0xFF5F6C34,
-0xFF9DAA74,
-0xFFA0AD78,
-0xFF7A8751,
-0xFF707D48,
-0xFF7C8556,
-0xFF889166,
-0xFF5F663D,
-0xFF363C16,
-0xFF49512A,
-0xFF4E572C,
-0xFF515D2D,
-0xFF55612F,
-0xFF5E6B36,
-0xFF7F8C57,
-0xFF545E2C,
-0xFF454E1F,
-0xFF464D23,
-0xFF50572D,
-0xFF5A4D2D,
-0xFF736548,
-0xFF6E6045,
-0xFF504227,
-0xFF8F8262,
-0xFF615837,
-0xFFA8A282,
-0xFF585536,
-0xFF2A2B0B,
-0xFF262A09,
-0xFF444A26,
-0xFF646A46,
-0xFF2A2F11,
-0xFF2B2E13,
-0xFF626246,
-0xFF4E4F30,
-0xFF2F3011,
-0xFF666748,
-0xFF616240,
-0xFF434520,
-0xFF575934,
-0xFF2E300B,
-0xFF5A5C37,
-0xFF474826,
-0xFF383919,
-0xFF515233,
-0xFF404326,
-0xFF45482B,
-0xFF323717,
-0xFF424826,
-0xFF3F4722,
-0xFF49512C,
-0xFF616B48,
-0xFF343E19,
-0xFF677248,
-0xFF3E491E,
-0xFF182300,
-0xFF323D13,
-0xFF3C441F,
-0xFF767E59,
-0xFF3A4219,
-0xFF374015,
-0xFF7C8357,
-0xFF6D7448,
-0xFF474E24,
-0xFF9CA377,
-0xFF444A1C,
-0xFF5C6634,
-0xFF546231,
-0xFF90A16D,
-0xFF8C9A67,
-0xFF404E1B,
-0xFF4D582D,
-0xFF566139,
-0xFF5E6641,
-0xFF5C623C,
-0xFF757A51,
-0xFF6E7049,
-0xFF767557,
-0xFF403C21,
-0xFF423E21,
-0xFF807C61,
-0xFF4F4931,
-0xFF686449,
-0xFF6D6E4C,
-0xFF777C53,
-0xFF505125,
-0xFF616334,
-0xFF525329,
-0xFF62643F,
-0xFF676B50,
-0xFF6C6F66,
-0xFF2F3140,
-0xFF262743,
-0xFF21233A,
-0xFF23253C,
-0xFF2A2B47,
-0xFF272B46,
-0xFF272C42,
-0xFF2A2F42,
-0xFF262938,
-0xFF1F212D,
-0xFF16161E,
-0xFF0E0F14,
-0xFF0B0C0E,
-0xFF050801,
-0xFF0E1100,
-0xFF3F4328,
-0xFF717952,
-0xFF30380F,
-0xFF4E5931,
-0xFF5C664E,
-0xFF6C7379,
-0xFF30354B,
-0xFF30364C,
-0xFF293043,
-0xFF252B3B,
-0xFF252B3B,
-0xFF282A41,
-0xFF2D2F46,
-0xFF2D2E43,
-0xFF2C2D41,
-0xFF2F2E40,
-0xFF242333,
-0xFF0D0D19,
-0xFF08090B,
-0xFF5E6150,
-0xFF4B4F34,
-0xFF25290E,
-0xFF22260D,
-0xFF323520,
-0xFF1B2009,
-0xFF394320,
-0xFF3F4A22,
-0xFF4A542F,
-0xFF303811,
-0xFF3B4216,
-0xFF596132,
-0xFF6D7448,
-0xFF535A2E,
-0xFF5D6532,
-0xFF565E2D,
-0xFF8C9367,
-0xFF282F05,
-0xFF909668,
-0xFF46491A,
-0xFF6F7243,
-0xFF686B3E,
-0xFF50572B,
-0xFF727C4A,
-0xFF899158,
-0xFF959D62,
-0xFF5D662F,
-0xFF8D9562,
-0xFF7C8254,
-0xFF585B2E,
-0xFF575927,
-0xFF7B7D4B,
-0xFF8D9061,
-0xFF7B7C54,
-0xFF524F2E,
-0xFF36320F,
-0xFF8F8D64,
-0xFF9B9A6C,
-0xFF909462,
-0xFF676B39,
-0xFF7D814F,
-0xFF757849,
-0xFF606338,
-0xFF5B5D35,
-0xFF7E8058,
-0xFF595C31,
-0xFF4E5122,
-0xFF818553,
-0xFF7C804E,
-0xFF6C733F,
-0xFF717842,
-0xFF7F8853,
-0xFF404819,
-0xFF777E55,
-0xFF545835,
-0xFF404324,
-0xFF55593E,
-0xFF61654A,
-0xFF484D2F,
-0xFF565C3A,
-0xFF767C58,
-0xFF151B00,
-0xFF484D25,
-0xFF4F512C,
-0xFF3C3C20,
-0xFF2F2D18,
-0xFF403B28,
-0xFF514B31,
-0xFF918F5F,
-0xFF5F5E26,
-0xFF8C8B53,
-0xFF959561,
-0xFF7B784B,
-0xFF949367,
-0xFFA5A277,
-0xFF706F41,
-0xFF717040,
-0xFFA4A876,
-0xFF606636,
-0xFF5B6332,
-0xFF75824D,
-0xFF8E9D64,
-0xFF96A665,
-0xFFA6BA75,
-0xFF74853F,
-0xFF4B5A19,
-0xFF9BA26F,
-0xFF888C5A,
-0xFFAEB77E,
-0xFF7D874B,
-0xFF868E52,
-0xFF9EA66D,
-0xFF7B824E,
-0xFF4F5525,
-0xFF626B3C,
-0xFF57612F,
-0xFF59622D,
-0xFF666E35,
-0xFF464B13,
-0xFFA3A872,
-0xFF636B38,
-0xFF7E8653,
-0xFF929B64,
-0xFF323B02,
-0xFF677037,
-0xFF4E571E,
-0xFF646C33,
-0xFF6F773E,
-0xFF959D64,
-0xFF889057,
-0xFF7B824C,
-0xFF4D541E,
-0xFFCAD39C,
-0xFF818A53,
-0xFF6B743F,
-0xFFA3AD78,
-0xFFA7B17C,
-0xFF78814A,
-0xFF8D9357,
-0xFF8D9156,
-0xFF8C8C58,
-0xFF71713F,
-0xFF888653,
-0xFF7E7C4B,
-0xFF88835B,
-0xFF504A26,
-0xFF6C6342,
-0xFF8F8669,
-0xFF8D806D,
-0xFF7F7164,
-0xFF493830,
-0xFF64534B,
-0xFF524233,
-0xFF463724,
-0xFF988972,
-0xFF796B51,
-0xFF50442A,
-0xFF5F5436,
-0xFF4A421D,
-0xFFA9A17A,
-0xFF625C38,
-0xFF8C8863,
-0xFF57552C,
-0xFF8D8B64,
-0xFF686842,
-0xFF797953,
-0xFF76774B,
-0xFF585C2A,
-0xFF6F7140,
-0xFF6C703D,
-0xFF4E5521,
-0xFF818852,
-0xFF8F9662,
-0xFF787F4C,
-0xFF8E936A,
-0xFF595E36,
-0xFF6C7148,
-0xFF676D3F,
-0xFF505922,
-0xFF7B864C,
-0xFF656F3A,
-0xFF869260,
-0xFF465325,
-0xFF647443,
-0xFF44561A,
-0xFF7F9153,
-0xFF536529,
-0xFF5B6D33,
-0xFF67793F,
-0xFF697B41,
-0xFF728148,
-0xFF7C8B52,
-0xFF89985D,
-0xFF717F44,
-0xFF636E32,
-0xFF657133,
-0xFF6D773B,
-0xFF9BA569,
-0xFF5E662D,
-0xFF848B55,
-0xFF5D612E,
-0xFF595D2A,
-0xFF8E9562,
-0xFF7F8652,
-0xFF929963,
-0xFF5D642E,
-0xFF666D39,
-0xFF5F6632,
-0xFF626A37,
-0xFF5D6532,
-0xFF646E3A,
-0xFF49531E,
-0xFF808E53,
-0xFF677538,
-0xFF707E43,
-0xFF66753C,
-0xFF657340,
-0xFF6D7B4A,
-0xFF5E6C39,
-0xFF788653,
-0xFF99A577,
-0xFF566234,
-0xFF545D32,
-0xFF333C11,
-0xFF5E673A,
-0xFF565F30,
-0xFF64713C,
-0xFF63703A,
-0xFF4B5822,
-0xFF919E69,
-0xFF535D2B,
-0xFF474E22,
-0xFF62673F,
-0xFF4D522A,
-0xFF6E5F40,
-0xFF5D4E31,
-0xFF54462B,
-0xFF483D21,
-0xFF59502F,
-0xFF908A68,
-0xFF8A8565,
-0xFF474425,
-0xFF434223,
-0xFF30310F,
-0xFF717550,
-0xFF2E320F,
-0xFF393C1F,
-0xFF595C3F,
-0xFF434425,
-0xFF4C4D2D,
-0xFF717250,
-0xFF4A4C27,
-0xFF80815F,
-0xFF383917,
-0xFF2E2F0F,
-0xFF4D4E2E,
-0xFF4B4C2C,
-0xFF5A5E3D,
-0xFF494D2C,
-0xFF353918,
-0xFF2B2F0E,
-0xFF3B411F,
-0xFF4C5230,
-0xFF313715,
-0xFF4A512F,
-0xFF3B4220,
-0xFF4E5836,
-0xFF818B68,
-0xFF525D35,
-0xFF3E491F,
-0xFF485329,
-0xFF626D43,
-0xFF555D34,
-0xFFACB58A,
-0xFF2F380B,
-0xFF2C3508,
-0xFF9AA177,
-0xFF5D643B,
-0xFFABB18B,
-0xFF30370E,
-0xFF394112,
-0xFF9EA876,
-0xFF455123,
-0xFF5E6C3B,
-0xFF6E7A48,
-0xFF566232,
-0xFF2D350C,
-0xFF2D350E,
-0xFF3F4523,
-0xFF3D411E,
-0xFF51532B,
-0xFF34350D,
-0xFF797657,
-0xFF575338,
-0xFF8A8568,
-0xFF5A5538,
-0xFF655F47,
-0xFF4F4B30,
-0xFF636442,
-0xFF51532B,
-0xFF7B7950,
-0xFF646337,
-0xFF4E4D21,
-0xFF535432,
-0xFF3F4231,
-0xFF4B4F4E,
-0xFF2D3041,
-0xFF272942,
-0xFF21233A,
-0xFF202239,
-0xFF292B44,
-0xFF272942,
-0xFF262B3F,
-0xFF232939,
-0xFF171926,
-0xFF060912,
-0xFF121318,
-0xFF0C0D11,
-0xFF08090B,
-0xFF060902,
-0xFF2A2D18,
-0xFF1F2404,
-0xFF6A724B,
-0xFF646C43,
-0xFF38421F,
-0xFF545C47,
-0xFF3E4347,
-0xFF363B4E,
-0xFF31364A,
-0xFF3A4056,
-0xFF282D40,
-0xFF22273B,
-0xFF272844,
-0xFF32334F,
-0xFF2A2B40,
-0xFF303145,
-0xFF323143,
-0xFF131220,
-0xFF0F0F19,
-0xFF080A07,
-0xFFABAE9B,
-0xFF5C6045,
-0xFF353A1C,
-0xFF363B1D,
-0xFF2D3118,
-0xFF363C22,
-0xFF4B5435,
-0xFF596442,
-0xFF404A27,
-0xFF5F6742,
-0xFF5F663C,
-0xFF666D43,
-0xFF777D57,
-0xFF3E441E,
-0xFF50572B,
-0xFF868E5F,
-0xFF636A3E,
-0xFF7A8253,
-0xFF888F5C,
-0xFF595D2B,
-0xFF4B4C20,
-0xFF505326,
-0xFF8D9468,
-0xFF777F4C,
-0xFF696E36,
-0xFF868B51,
-0xFF5A632C,
-0xFF7F8754,
-0xFF9CA274,
-0xFF616435,
-0xFF595B29,
-0xFF7D7F4D,
-0xFFBABD8E,
-0xFF6C6F44,
-0xFF73704D,
-0xFF3C3813,
-0xFF69683C,
-0xFF8A8C5B,
-0xFF9EA572,
-0xFF616835,
-0xFF7F8555,
-0xFF7C8254,
-0xFF262800,
-0xFF2E330B,
-0xFF393B16,
-0xFF343911,
-0xFF515427,
-0xFF666C3C,
-0xFF575C33,
-0xFF62673E,
-0xFF4F5726,
-0xFF7D8556,
-0xFF444B22,
-0xFF6F7551,
-0xFF313512,
-0xFF636947,
-0xFF393D24,
-0xFF41452E,
-0xFF282C13,
-0xFF1C2206,
-0xFF707555,
-0xFF424826,
-0xFF515733,
-0xFF4A4E2D,
-0xFF1F2109,
-0xFF3D3C2A,
-0xFF2A261A,
-0xFF393420,
-0xFF85835A,
-0xFF6F6F3B,
-0xFF454813,
-0xFF8C8E5D,
-0xFF43441A,
-0xFF55562E,
-0xFF65663C,
-0xFF939566,
-0xFF797B4A,
-0xFF535724,
-0xFF909865,
-0xFF97A16D,
-0xFF54612C,
-0xFFB0BF86,
-0xFF7E9151,
-0xFF849853,
-0xFF71853E,
-0xFF96A665,
-0xFF949D68,
-0xFF9FA673,
-0xFF5C642B,
-0xFF586226,
-0xFF364004,
-0xFF909960,
-0xFF767E4B,
-0xFF313908,
-0xFF7F8756,
-0xFF525A27,
-0xFF778047,
-0xFF414B0F,
-0xFF676F34,
-0xFF7C834D,
-0xFF737949,
-0xFF666E3D,
-0xFF606932,
-0xFF717A41,
-0xFFA5AE75,
-0xFF5D662D,
-0xFF616930,
-0xFF596128,
-0xFF939B62,
-0xFF838B52,
-0xFF636A34,
-0xFF79804A,
-0xFFA5AC76,
-0xFF616A33,
-0xFF8F9863,
-0xFFAEB782,
-0xFF6F7843,
-0xFF606932,
-0xFF9FA567,
-0xFF9DA164,
-0xFFA0A168,
-0xFF7A7A44,
-0xFF4E4D15,
-0xFF888653,
-0xFF68633B,
-0xFF736D49,
-0xFF6B633E,
-0xFF655C3B,
-0xFF817660,
-0xFF75675C,
-0xFF40312C,
-0xFF5D4E49,
-0xFF66584D,
-0xFF3C2F1F,
-0xFF726552,
-0xFF61553D,
-0xFF7A6E54,
-0xFF5A5132,
-0xFFA9A07F,
-0xFF686240,
-0xFF484326,
-0xFF777255,
-0xFF625F3C,
-0xFF757251,
-0xFF636246,
-0xFF49482C,
-0xFF818062,
-0xFF929270,
-0xFF494721,
-0xFF3F4016,
-0xFF4A4D20,
-0xFF5B5E2F,
-0xFF777B49,
-0xFF7D8051,
-0xFF575A2F,
-0xFF72774E,
-0xFF878C63,
-0xFF575D2D,
-0xFF4D541E,
-0xFF565F26,
-0xFF606A35,
-0xFF65713F,
-0xFF475325,
-0xFF62703F,
-0xFF546328,
-0xFF758546,
-0xFF57662B,
-0xFF506228,
-0xFF707F46,
-0xFF718047,
-0xFF7D8C53,
-0xFF5D6C33,
-0xFF69783D,
-0xFF6D7B3E,
-0xFF99A468,
-0xFF697537,
-0xFF6F793C,
-0xFF8B9559,
-0xFF6A7239,
-0xFF757C46,
-0xFF3B3F0C,
-0xFF6B6F3C,
-0xFF7A814D,
-0xFF888F5B,
-0xFFB3BA86,
-0xFF69703C,
-0xFF5A612E,
-0xFF79804D,
-0xFF7D8353,
-0xFF676F3C,
-0xFF424B16,
-0xFF606B33,
-0xFF798448,
-0xFF6C7A3C,
-0xFF6B7B3D,
-0xFF606F36,
-0xFF70814D,
-0xFF667647,
-0xFF6E7E4D,
-0xFF546231,
-0xFF768453,
-0xFF697545,
-0xFF6F7849,
-0xFF576031,
-0xFF788250,
-0xFF58622E,
-0xFF4D5A24,
-0xFF68753D,
-0xFF66733D,
-0xFF7D8753,
-0xFF676F3E,
-0xFF545B2F,
-0xFF4B5027,
-0xFF666B43,
-0xFF796C4C,
-0xFF45371A,
-0xFF504529,
-0xFF5D5639,
-0xFF5E5A37,
-0xFF686542,
-0xFF31310F,
-0xFF737351,
-0xFF3B3C1C,
-0xFF3A3B19,
-0xFF747651,
-0xFF3C3E19,
-0xFF6F7051,
-0xFF444428,
-0xFF434425,
-0xFF555732,
-0xFF84875C,
-0xFF5B5E31,
-0xFF6E7049,
-0xFF4B4C2C,
-0xFF4E5136,
-0xFF4A4C34,
-0xFF272911,
-0xFF4A4E33,
-0xFF2C3111,
-0xFF2B310D,
-0xFF3F451F,
-0xFF525A33,
-0xFF565E37,
-0xFF68704B,
-0xFF636A49,
-0xFF333A1B,
-0xFF3A4324,
-0xFF2D3617,
-0xFF323C19,
-0xFF505A35,
-0xFF5C643D,
-0xFF59613A,
-0xFF50592E,
-0xFF7B8457,
-0xFF3A4314,
-0xFF202900,
-0xFF646C43,
-0xFFA3AB86,
-0xFF2D3311,
-0xFF353B17,
-0xFF6E7549,
-0xFF6D7546,
-0xFF7C855A,
-0xFF596237,
-0xFF919A6D,
-0xFF636C3F,
-0xFF4C522C,
-0xFF7E8261,
-0xFF76795C,
-0xFF1F2000,
-0xFF6C6E46,
-0xFF797A50,
-0xFF53502F,
-0xFF888467,
-0xFF6C6749,
-0xFF6C6749,
-0xFF130E00,
-0xFF4D492C,
-0xFF525230,
-0xFF72724C,
-0xFF87835D,
-0xFF69663D,
-0xFF45431A,
-0xFF676849,
-0xFF6A6B65,
-0xFF373A43,
-0xFF272C3F,
-0xFF272C42,
-0xFF24263D,
-0xFF1F2138,
-0xFF292941,
-0xFF28293E,
-0xFF24273A,
-0xFF161C2A,
-0xFF030511,
-0xFF080B12,
-0xFF07080C,
-0xFF050608,
-0xFF0A0A0C,
-0xFF080903,
-0xFF1D210A,
-0xFF353B19,
-0xFF60673E,
-0xFF414920,
-0xFF0F1900,
-0xFF303821,
-0xFF424846,
-0xFF313842,
-0xFF3A3F53,
-0xFF3D415A,
-0xFF363A55,
-0xFF323653,
-0xFF2C2D4C,
-0xFF242543,
-0xFF2F3044,
-0xFF2D2F3E,
-0xFF151422,
-0xFF080812,
-0xFF0E0D13,
-0xFF141510,
-0xFF373A27,
-0xFF3E4325,
-0xFF8D916E,
-0xFF666A45,
-0xFF575B36,
-0xFF606640,
-0xFF585F3D,
-0xFF545E3C,
-0xFF2A3110,
-0xFF1C2302,
-0xFF2C3210,
-0xFF616745,
-0xFF272B10,
-0xFF606547,
-0xFF121800,
-0xFF656C40,
-0xFF646C3D,
-0xFF5D6534,
-0xFF767C4C,
-0xFF6D7345,
-0xFF373914,
-0xFF5C5E39,
-0xFF484F23,
-0xFF838A57,
-0xFF6D7039,
-0xFF73783E,
-0xFF939C65,
-0xFF707944,
-0xFF676A3B,
-0xFF7E8051,
-0xFF686A38,
-0xFF676B38,
-0xFFA6AC7C,
-0xFF777A4F,
-0xFF716F49,
-0xFF67653E,
-0xFF313206,
-0xFF838755,
-0xFF7A824F,
-0xFF6F7746,
-0xFF4F5728,
-0xFF838A60,
-0xFF30340F,
-0xFF636945,
-0xFF909471,
-0xFF565D34,
-0xFF5D6335,
-0xFF5D6438,
-0xFF989E7A,
-0xFF515735,
-0xFF5B6239,
-0xFF7F865D,
-0xFF676E4C,
-0xFF3C4321,
-0xFF5B613B,
-0xFF777D59,
-0xFF171B02,
-0xFF1E230D,
-0xFF444932,
-0xFF1D250D,
-0xFF21270B,
-0xFF555C3D,
-0xFF252C0B,
-0xFF585D3F,
-0xFF373B22,
-0xFF282A15,
-0xFF3D3B2C,
-0xFF46442F,
-0xFF5A5A36,
-0xFF696A3E,
-0xFF4A5024,
-0xFF555C33,
-0xFF252809,
-0xFF5D6140,
-0xFF76794E,
-0xFF4B521F,
-0xFF515825,
-0xFF848D56,
-0xFF5A6628,
-0xFF899759,
-0xFF697841,
-0xFF6D7C43,
-0xFFA6B773,
-0xFF61722B,
-0xFF91A25C,
-0xFF9BAB6A,
-0xFF758046,
-0xFF707942,
-0xFF485015,
-0xFF6D773B,
-0xFFA9B377,
-0xFF505B23,
-0xFF848E5C,
-0xFF505A28,
-0xFF3D4512,
-0xFF828B54,
-0xFF98A263,
-0xFF606B29,
-0xFF677132,
-0xFF798146,
-0xFF888E5E,
-0xFF737949,
-0xFF686F39,
-0xFF979F66,
-0xFF81894E,
-0xFF7B8348,
-0xFF8B9056,
-0xFF787D43,
-0xFF858A52,
-0xFF6C7139,
-0xFF838850,
-0xFF889057,
-0xFF525923,
-0xFF626933,
-0xFF9EA571,
-0xFF606733,
-0xFF636A37,
-0xFFB4BB85,
-0xFFAAB072,
-0xFF464C0E,
-0xFF949760,
-0xFF7E814C,
-0xFF7D7D47,
-0xFF8C8C58,
-0xFF68653C,
-0xFF69653F,
-0xFF79744A,
-0xFF7C7751,
-0xFF90896D,
-0xFF7A6E5E,
-0xFF2C1F17,
-0xFF2B1E18,
-0xFF4A3D34,
-0xFF584C3E,
-0xFF6C6050,
-0xFF6D624E,
-0xFF7B7156,
-0xFF595235,
-0xFF635D3D,
-0xFF625D3F,
-0xFF6B654F,
-0xFF6B654F,
-0xFF555134,
-0xFF6F6B50,
-0xFF706B57,
-0xFF666050,
-0xFF66614E,
-0xFF5E5943,
-0xFF858063,
-0xFF918E6D,
-0xFF7A7754,
-0xFF86875F,
-0xFF7C7E4F,
-0xFF585A2B,
-0xFF717248,
-0xFF80825A,
-0xFF83855D,
-0xFF5B6133,
-0xFF818854,
-0xFF3F4811,
-0xFF666E3B,
-0xFF8C9566,
-0xFF475025,
-0xFF6A7344,
-0xFF788349,
-0xFF576527,
-0xFF627035,
-0xFF536227,
-0xFF6E7B43,
-0xFF727F47,
-0xFF57642C,
-0xFF6F7C44,
-0xFF344207,
-0xFF748245,
-0xFF6F7A3E,
-0xFF818D4F,
-0xFF646E32,
-0xFF6D773B,
-0xFF737A44,
-0xFF49501C,
-0xFF505422,
-0xFF6E7240,
-0xFF676B39,
-0xFF565A27,
-0xFF898D5A,
-0xFF3B3F0C,
-0xFF969A68,
-0xFF707442,
-0xFF686B3C,
-0xFF626936,
-0xFF626935,
-0xFF7B844B,
-0xFF748042,
-0xFF758345,
-0xFF718143,
-0xFF86955C,
-0xFF879864,
-0xFF748453,
-0xFF576738,
-0xFF7D8D5C,
-0xFF42501F,
-0xFF576532,
-0xFF63703B,
-0xFF5F6C37,
-0xFF636D38,
-0xFF656F3A,
-0xFF646F37,
-0xFF657038,
-0xFF68723D,
-0xFF3D4713,
-0xFF6D7544,
-0xFF4E5426,
-0xFF5A5D32,
-0xFF4C4E26,
-0xFF5B5030,
-0xFF504728,
-0xFF494225,
-0xFF666344,
-0xFF52522E,
-0xFF2E3009,
-0xFF3D411C,
-0xFF616542,
-0xFF646545,
-0xFF424321,
-0xFF5B5B37,
-0xFF33330F,
-0xFF353416,
-0xFF595A3B,
-0xFF4A4B2B,
-0xFF2C2E09,
-0xFF5C5F32,
-0xFF727548,
-0xFF6D6F48,
-0xFF4D512E,
-0xFF404326,
-0xFF393D22,
-0xFF50543B,
-0xFF686F50,
-0xFF525937,
-0xFF343E19,
-0xFF222A01,
-0xFF455026,
-0xFF3A421B,
-0xFF606745,
-0xFF444B2A,
-0xFF3A4122,
-0xFF434C2D,
-0xFF2B3415,
-0xFF4C5633,
-0xFF232D08,
-0xFF626A45,
-0xFF39411C,
-0xFF6A724B,
-0xFF586037,
-0xFF545D32,
-0xFF3D461B,
-0xFF929A73,
-0xFF111800,
-0xFF5B613F,
-0xFF3F4521,
-0xFF636A3E,
-0xFF525A2B,
-0xFF6F744C,
-0xFF414520,
-0xFF72774F,
-0xFF7D825A,
-0xFF565A39,
-0xFF5E5F40,
-0xFF4C4C32,
-0xFF2D2E0F,
-0xFF777850,
-0xFF5E5F35,
-0xFF4D4A29,
-0xFF797657,
-0xFF4D4A29,
-0xFF817C5C,
-0xFF575234,
-0xFF3E3B1C,
-0xFF3B3817,
-0xFF6D6A47,
-0xFF48421E,
-0xFF615C36,
-0xFF74704A,
-0xFF616147,
-0xFF626365,
-0xFF2E3140,
-0xFF262D3F,
-0xFF293043,
-0xFF202539,
-0xFF1E2035,
-0xFF26243A,
-0xFF25263A,
-0xFF242738,
-0xFF181B2A,
-0xFF0A0C18,
-0xFF04070E,
-0xFF08090B,
-0xFF080A09,
-0xFF060608,
-0xFF13140E,
-0xFF21250C,
-0xFF464C28,
-0xFF1F2600,
-0xFF454C23,
-0xFF49502E,
-0xFF242C14,
-0xFF353D32,
-0xFF42474B,
-0xFF454A5D,
-0xFF363A53,
-0xFF42475D,
-0xFF3B3F58,
-0xFF373854,
-0xFF36384F,
-0xFF1F2130,
-0xFF181B24,
-0xFF0B0B15,
-0xFF0D0E13,
-0xFF070709,
-0xFF1E1F19,
-0xFF333623,
-0xFF303517,
-0xFF373B18,
-0xFF636742,
-0xFF6C704B,
-0xFF373D19,
-0xFF3B4221,
-0xFF414A2D,
-0xFF1E2408,
-0xFF1F2509,
-0xFF2C3113,
-0xFF262A0F,
-0xFF323520,
-0xFF292D16,
-0xFF3E4323,
-0xFF565C36,
-0xFF4B5228,
-0xFF4B5226,
-0xFF555B2F,
-0xFF747950,
-0xFF686949,
-0xFF525633,
-0xFF52582C,
-0xFF979E6B,
-0xFF8A8D58,
-0xFF73763F,
-0xFF6C753E,
-0xFF424B16,
-0xFF646836,
-0xFF7E804F,
-0xFF6C6E3D,
-0xFF9B9F6D,
-0xFF73794B,
-0xFF7E8458,
-0xFF797750,
-0xFF73714A,
-0xFF7D7E52,
-0xFF6B7141,
-0xFF919968,
-0xFF37410F,
-0xFF656E41,
-0xFF6C724C,
-0xFF676C4C,
-0xFF393E1E,
-0xFF363C16,
-0xFFB4BB8F,
-0xFF606837,
-0xFFD6DEAF,
-0xFF5C623E,
-0xFF464B2B,
-0xFF676D49,
-0xFF898F6B,
-0xFF202706,
-0xFF555C3B,
-0xFF505634,
-0xFF545939,
-0xFF545942,
-0xFF1B200A,
-0xFF464E36,
-0xFF232C11,
-0xFF353E23,
-0xFF606850,
-0xFF171F07,
-0xFF0E1300,
-0xFF5D6349,
-0xFF54583F,
-0xFF272913,
-0xFF424226,
-0xFF898B64,
-0xFF6A7044,
-0xFF626B3E,
-0xFF747F55,
-0xFF212807,
-0xFF434A28,
-0xFF888F63,
-0xFF717946,
-0xFF545D28,
-0xFF525D25,
-0xFF738143,
-0xFF738143,
-0xFF5E6D36,
-0xFF6F7E47,
-0xFF8E9E5D,
-0xFF8FA05C,
-0xFFB2C281,
-0xFF6E7C3E,
-0xFF77854A,
-0xFF5E692F,
-0xFF7E864A,
-0xFF99A263,
-0xFF919D5F,
-0xFF77854A,
-0xFF596631,
-0xFFA7B17D,
-0xFF5E6633,
-0xFFA4AC73,
-0xFF6D7635,
-0xFF77823E,
-0xFF7A8541,
-0xFF6E783B,
-0xFF717542,
-0xFF505422,
-0xFF7B804A,
-0xFF596126,
-0xFF7F874C,
-0xFF9BA368,
-0xFF7B8046,
-0xFF8E9359,
-0xFF797E46,
-0xFF979C64,
-0xFF8D925A,
-0xFF575C24,
-0xFF6A713B,
-0xFF585F29,
-0xFF9CA36F,
-0xFF565D29,
-0xFF828956,
-0xFF6F7640,
-0xFF818749,
-0xFF747A3C,
-0xFF6F7340,
-0xFF5B5D2C,
-0xFF888B56,
-0xFF5F5F2D,
-0xFF8E8C63,
-0xFF7E7A54,
-0xFF716E41,
-0xFF7E7B50,
-0xFF635D3D,
-0xFF534D35,
-0xFF766D5E,
-0xFF3F372C,
-0xFF483E34,
-0xFF352C1D,
-0xFF7E7663,
-0xFF6E664F,
-0xFF9B9478,
-0xFF6A6545,
-0xFF797552,
-0xFF4C4727,
-0xFF544E36,
-0xFF736D57,
-0xFF393518,
-0xFF5E5A3F,
-0xFF413C28,
-0xFF494333,
-0xFF716A58,
-0xFF504A34,
-0xFF363016,
-0xFF686346,
-0xFF565036,
-0xFF514C2E,
-0xFF716E45,
-0xFFA6A577,
-0xFF7C7B4F,
-0xFF5A5B31,
-0xFF373711,
-0xFF989A72,
-0xFF888C5A,
-0xFF676E3A,
-0xFF848B58,
-0xFF737B4C,
-0xFF7D8259,
-0xFF5D6438,
-0xFF737C45,
-0xFF828D51,
-0xFF737E42,
-0xFF616F34,
-0xFF7B864C,
-0xFF4A571F,
-0xFF8A955D,
-0xFF7C8951,
-0xFF788349,
-0xFF626D33,
-0xFF758044,
-0xFF727E40,
-0xFF8E985C,
-0xFF677037,
-0xFF5E6531,
-0xFF6C7340,
-0xFF727546,
-0xFF5B5E31,
-0xFFADB081,
-0xFF9DA16F,
-0xFF5B5F2C,
-0xFF8C905D,
-0xFF6F7340,
-0xFF686C39,
-0xFF6B6F3D,
-0xFF878B59,
-0xFF797D4A,
-0xFF585F29,
-0xFF848E52,
-0xFF566224,
-0xFF839154,
-0xFF66753A,
-0xFF798752,
-0xFF465723,
-0xFF768856,
-0xFF819361,
-0xFF4E5F2B,
-0xFF43511C,
-0xFF66733D,
-0xFF424F19,
-0xFF9CA671,
-0xFF6B7540,
-0xFF555F2A,
-0xFF87915C,
-0xFF6E7844,
-0xFF414918,
-0xFF6F7545,
-0xFF414717,
-0xFF6F7245,
-0xFF5F6233,
-0xFF443E1C,
-0xFF504B2B,
-0xFF575435,
-0xFF4B4C2C,
-0xFF3D441B,
-0xFF2B330A,
-0xFF606841,
-0xFF303612,
-0xFF4D512E,
-0xFF4A4B29,
-0xFF4D4D29,
-0xFF565632,
-0xFF3A391A,
-0xFF393A1B,
-0xFF737454,
-0xFF343815,
-0xFF353914,
-0xFF646843,
-0xFF5E623D,
-0xFF535933,
-0xFF515731,
-0xFF6D754E,
-0xFF66704B,
-0xFF49542C,
-0xFF1D2800,
-0xFF222E06,
-0xFF434E26,
-0xFF56623C,
-0xFF394320,
-0xFF2B3513,
-0xFF343D1E,
-0xFF475031,
-0xFF7F8667,
-0xFF5D6442,
-0xFF919972,
-0xFF545C33,
-0xFF303813,
-0xFF656C4A,
-0xFF44492B,
-0xFF5F6348,
-0xFF393E20,
-0xFF494E2E,
-0xFF404624,
-0xFF6B714D,
-0xFF585E3A,
-0xFF41481F,
-0xFF959D6E,
-0xFF565C2E,
-0xFF3A3B19,
-0xFF2C2D0D,
-0xFF3C3E19,
-0xFF454722,
-0xFF4F5031,
-0xFF434128,
-0xFF797762,
-0xFF414024,
-0xFF53542C,
-0xFF6A6B3F,
-0xFF40401C,
-0xFF4E4E2C,
-0xFF6B6B47,
-0xFF67653F,
-0xFF75724F,
-0xFF676443,
-0xFF4E4B2C,
-0xFF333011,
-0xFF746E4C,
-0xFF4C4622,
-0xFF635F3A,
-0xFFADAC97,
-0xFF3F4247,
-0xFF292E42,
-0xFF2D3447,
-0xFF2B3245,
-0xFF1E2337,
-0xFF222538,
-0xFF27253A,
-0xFF232438,
-0xFF202332,
-0xFF191D29,
-0xFF121420,
-0xFF121318,
-0xFF0D0F0E,
-0xFF030502,
-0xFF030303,
-0xFF191A14,
-0xFF2B2D15,
-0xFF454926,
-0xFF3D431D,
-0xFF7C835A,
-0xFF6C744F,
-0xFFA9B295,
-0xFF4B5443,
-0xFF757B7B,
-0xFF5C6174,
-0xFF353A4E,
-0xFF596068,
-0xFF2B3238,
-0xFF2A2E3A,
-0xFF181C28,
-0xFF0D1015,
-0xFF181C1F,
-0xFF08090E,
-0xFF16171B,
-0xFF111111,
-0xFF404139,
-0xFF6D6E5C,
-0xFF4F5237,
-0xFF66694C,
-0xFF4E5136,
-0xFF4C4E36,
-0xFF3E422B,
-0xFF111600,
-0xFF242913,
-0xFF3F422D,
-0xFF20230E,
-0xFF35371F,
-0xFF1A1C04,
-0xFF4C4D3B,
-0xFF2C2E19,
-0xFF565A3F,
-0xFF5B6040,
-0xFF6C7352,
-0xFF565D3B,
-0xFF505630,
-0xFF242B02,
-0xFF797D5A,
-0xFF424621,
-0xFF33390B,
-0xFF6F7341,
-0xFF868654,
-0xFF797B49,
-0xFF535C27,
-0xFF98A16C,
-0xFF757947,
-0xFF8B8D5C,
-0xFF626435,
-0xFF8D9063,
-0xFF686F43,
-0xFF4F5529,
-0xFF64623B,
-0xFF737148,
-0xFF5F6237,
-0xFF535B2C,
-0xFF949E6C,
-0xFF667242,
-0xFF354015,
-0xFF777F5A,
-0xFF72785C,
-0xFF2A3110,
-0xFF40491A,
-0xFF8F9964,
-0xFFA4AF77,
-0xFF6A7440,
-0xFFA3AC81,
-0xFF535B36,
-0xFF767E59,
-0xFF3C441F,
-0xFF202803,
-0xFF808766,
-0xFF1A1E05,
-0xFF575A45,
-0xFF0D1200,
-0xFF515640,
-0xFF1C2506,
-0xFF4F5839,
-0xFF263015,
-0xFF737C67,
-0xFF1B2413,
-0xFF1F2614,
-0xFF0B1300,
-0xFFA1A889,
-0xFF0D1300,
-0xFF81865E,
-0xFF93996B,
-0xFF353E09,
-0xFFA6B57C,
-0xFF64753E,
-0xFF2E3B0F,
-0xFF3B481C,
-0xFF838F5D,
-0xFF8A9761,
-0xFF637038,
-0xFF59662E,
-0xFF6B793E,
-0xFF5F6E35,
-0xFF2E3C09,
-0xFF8F9D6A,
-0xFFBFCC94,
-0xFFABB97E,
-0xFF5D6B30,
-0xFF5C6A2F,
-0xFF85925C,
-0xFF545F27,
-0xFFA1AA6B,
-0xFF909956,
-0xFF9BA863,
-0xFF9FAE6D,
-0xFF818F54,
-0xFF96A36D,
-0xFF59602C,
-0xFF8D955C,
-0xFF6D7637,
-0xFF7B8642,
-0xFF7C8944,
-0xFF717B3C,
-0xFF9EA36B,
-0xFF6B703A,
-0xFF787D43,
-0xFF6D7337,
-0xFF9BA165,
-0xFFA7AD71,
-0xFF848A4E,
-0xFF898F53,
-0xFF7A7F45,
-0xFF676C32,
-0xFF82874F,
-0xFF858A52,
-0xFF80854F,
-0xFF777C46,
-0xFF5A5E2B,
-0xFF919563,
-0xFF585E2E,
-0xFF666D37,
-0xFF848D4E,
-0xFF747C40,
-0xFF72784A,
-0xFF4F5129,
-0xFF636639,
-0xFF7B7C50,
-0xFF72734B,
-0xFF7B7952,
-0xFF89885A,
-0xFF6C6B3F,
-0xFF76724D,
-0xFF7A7758,
-0xFF514B31,
-0xFFAAA58F,
-0xFF47402E,
-0xFF4C4532,
-0xFF68624A,
-0xFF4D482B,
-0xFF5E5939,
-0xFF8D8964,
-0xFF5B582F,
-0xFF83815A,
-0xFF4F4C2B,
-0xFF908D6E,
-0xFF73704F,
-0xFF565332,
-0xFF453F25,
-0xFF342E16,
-0xFF383115,
-0xFF726B4E,
-0xFF716B49,
-0xFF7A7454,
-0xFF5F5742,
-0xFF4F4730,
-0xFF57522C,
-0xFF797649,
-0xFF858257,
-0xFF828057,
-0xFF666340,
-0xFF6B6B45,
-0xFFA6A77B,
-0xFF707442,
-0xFF8A8D5E,
-0xFF6D7345,
-0xFF54562E,
-0xFF8B9165,
-0xFF6D7440,
-0xFF4A5219,
-0xFF949E62,
-0xFF545F23,
-0xFF707940,
-0xFF5F6A30,
-0xFF5B642D,
-0xFF6A753D,
-0xFF677037,
-0xFF6B743B,
-0xFF6B7539,
-0xFF687236,
-0xFF636B32,
-0xFF7F8650,
-0xFF6B6F3D,
-0xFF606334,
-0xFF62653A,
-0xFF93966B,
-0xFF3B3C12,
-0xFF97986C,
-0xFF676937,
-0xFF9B9E69,
-0xFF757841,
-0xFF7F824B,
-0xFF8D905B,
-0xFF878B58,
-0xFF737744,
-0xFF787F4B,
-0xFF7E8750,
-0xFF69743A,
-0xFF49571C,
-0xFF58672C,
-0xFF97A66D,
-0xFF5E6F38,
-0xFF384B14,
-0xFF61743D,
-0xFF42531C,
-0xFF54632C,
-0xFF435018,
-0xFF6B7842,
-0xFF949E69,
-0xFF555F2B,
-0xFF535D2B,
-0xFF6E7846,
-0xFF4D5524,
-0xFF5D6534,
-0xFF818757,
-0xFF7F8653,
-0xFF646835,
-0xFF4C4F1A,
-0xFF504D2C,
-0xFF464526,
-0xFF515233,
-0xFF3F4523,
-0xFF3C471F,
-0xFF343F15,
-0xFF38421D,
-0xFF454C2A,
-0xFF474B2A,
-0xFF626343,
-0xFF494927,
-0xFF5E5B3A,
-0xFF49482A,
-0xFF38391A,
-0xFF373B1A,
-0xFF2A300C,
-0xFF2A300E,
-0xFF434927,
-0xFF616743,
-0xFF737B54,
-0xFF525A31,
-0xFF5F6A40,
-0xFF313E13,
-0xFF606F44,
-0xFF69784D,
-0xFF505F34,
-0xFF5C6B42,
-0xFF424E28,
-0xFF535F3B,
-0xFF1C2804,
-0xFF232D0B,
-0xFF495331,
-0xFF333A1B,
-0xFF444929,
-0xFF282C09,
-0xFF5C603B,
-0xFF5D5E3E,
-0xFF515233,
-0xFF63664B,
-0xFF505338,
-0xFF31351A,
-0xFF212608,
-0xFF3F4523,
-0xFF343A16,
-0xFF4F552F,
-0xFF535A31,
-0xFF7A8253,
-0xFF4F5529,
-0xFF4E4F2F,
-0xFF38391A,
-0xFF7E7F5D,
-0xFF3F401E,
-0xFF404122,
-0xFF57573D,
-0xFF44442A,
-0xFF333415,
-0xFF676840,
-0xFF4F5026,
-0xFF787856,
-0xFF545432,
-0xFF7D7D59,
-0xFF43431D,
-0xFF5F5C39,
-0xFF73704F,
-0xFF626142,
-0xFF666344,
-0xFF676044,
-0xFF2F250A,
-0xFF7E795B,
-0xFF81806E,
-0xFF2F323B,
-0xFF292E44,
-0xFF272F44,
-0xFF232A3D,
-0xFF1A1D30,
-0xFF2B2C40,
-0xFF303145,
-0xFF292A3C,
-0xFF212433,
-0xFF1B1F2A,
-0xFF15151F,
-0xFF1D1D25,
-0xFF080C0D,
-0xFF060805,
-0xFF000000,
-0xFF303024,
-0xFF6A6D50,
-0xFF868A65,
-0xFF858B65,
-0xFF6B714B,
-0xFF757B55,
-0xFF59603F,
-0xFF757D66,
-0xFF4B5348,
-0xFF484C55,
-0xFF373B46,
-0xFF48514C,
-0xFF040B03,
-0xFF000604,
-0xFF000300,
-0xFFCFD5CB,
-0xFFDEE2D4,
-0xFF1C1F18,
-0xFF010400,
-0xFF0D0E08,
-0xFF48483E,
-0xFF353624,
-0xFF454731,
-0xFF343620,
-0xFF272B14,
-0xFF5A5E47,
-0xFF383D26,
-0xFF484C3B,
-0xFF161A09,
-0xFF575A49,
-0xFF40422D,
-0xFF5F6149,
-0xFF42452A,
-0xFF171901,
-0xFF676B52,
-0xFF2F331A,
-0xFF5A5E43,
-0xFF393E20,
-0xFF575C3C,
-0xFF949A76,
-0xFF4A502A,
-0xFF5A603C,
-0xFF3F461D,
-0xFF3E4617,
-0xFF5F6633,
-0xFF888A58,
-0xFF686A38,
-0xFF5D6631,
-0xFF8F9863,
-0xFF6F7341,
-0xFF656839,
-0xFF606137,
-0xFF7B7C54,
-0xFF5F6237,
-0xFF585B30,
-0xFF747249,
-0xFF59572E,
-0xFF81875B,
-0xFF707849,
-0xFF838D5B,
-0xFF838C5D,
-0xFF4B5429,
-0xFFA3AB86,
-0xFF565D3E,
-0xFF0C1300,
-0xFF626C38,
-0xFFA0AB71,
-0xFF87925A,
-0xFF3F4917,
-0xFF60673E,
-0xFF3D4520,
-0xFF8A926D,
-0xFF6B734C,
-0xFF343C15,
-0xFF7E8563,
-0xFF1E2209,
-0xFF444732,
-0xFF0C1100,
-0xFF0B1000,
-0xFF73795D,
-0xFF313A1B,
-0xFF151E01,
-0xFF6C765D,
-0xFF464F3A,
-0xFF162007,
-0xFF2B3415,
-0xFF818C64,
-0xFFB5C095,
-0xFF535D2B,
-0xFF848D58,
-0xFF768147,
-0xFF6D7F41,
-0xFF8CA063,
-0xFF485922,
-0xFF63743E,
-0xFF65733E,
-0xFF96A46F,
-0xFF4A5721,
-0xFF5F6C34,
-0xFF717E46,
-0xFF74834A,
-0xFF9EAC77,
-0xFFBFCD98,
-0xFF83925B,
-0xFF8C9B62,
-0xFF536126,
-0xFF3D4C11,
-0xFF69783F,
-0xFF869459,
-0xFF8E9859,
-0xFF8E9955,
-0xFF9DAD66,
-0xFFA7B872,
-0xFF6A783A,
-0xFF8D9B60,
-0xFF5F682F,
-0xFF7E874E,
-0xFF99A166,
-0xFF8F995C,
-0xFF869252,
-0xFF687434,
-0xFF858A50,
-0xFF8A8F55,
-0xFF7E8349,
-0xFF82874D,
-0xFFB2B77D,
-0xFF777C42,
-0xFF787B42,
-0xFF878C52,
-0xFF898E56,
-0xFF787F49,
-0xFF7C8149,
-0xFF5C6129,
-0xFF9A9F69,
-0xFF797B49,
-0xFF7A7C4A,
-0xFF939765,
-0xFF7D8051,
-0xFF7A814D,
-0xFFA1A769,
-0xFF81874B,
-0xFF858859,
-0xFF8E9068,
-0xFF686B40,
-0xFF777951,
-0xFF5C5C36,
-0xFF6B6B45,
-0xFFB4B387,
-0xFF3D3C0E,
-0xFF68663F,
-0xFF706D4A,
-0xFF322F10,
-0xFF918D72,
-0xFF8A856F,
-0xFF45402A,
-0xFF656043,
-0xFF676242,
-0xFF4E4A27,
-0xFF6C6A43,
-0xFF7D7F4E,
-0xFF767847,
-0xFF787951,
-0xFF5B5B35,
-0xFF7D7E56,
-0xFF4D4D27,
-0xFF706C4F,
-0xFF4A4629,
-0xFF5B5734,
-0xFF5C5832,
-0xFF8B885F,
-0xFF797552,
-0xFF69614C,
-0xFF584D39,
-0xFF5D5433,
-0xFF565127,
-0xFF403D12,
-0xFFA6A37A,
-0xFF4F4D27,
-0xFF615F38,
-0xFF5F6034,
-0xFF747846,
-0xFF666D3A,
-0xFF5F6633,
-0xFF494F21,
-0xFF53592B,
-0xFF747B48,
-0xFF525925,
-0xFF919862,
-0xFF8A935A,
-0xFF6A753B,
-0xFF57622A,
-0xFF545E29,
-0xFF77824A,
-0xFF454E15,
-0xFF7D874B,
-0xFF838D51,
-0xFF7F874C,
-0xFF6E733B,
-0xFF858853,
-0xFF9A9C6B,
-0xFF727445,
-0xFF606137,
-0xFF74754B,
-0xFF797A4E,
-0xFF87895A,
-0xFF60602E,
-0xFF8F8F5B,
-0xFF73763D,
-0xFF84874E,
-0xFF5E632B,
-0xFF848855,
-0xFF8B8D5C,
-0xFF747645,
-0xFF787C49,
-0xFF464D17,
-0xFF5B662C,
-0xFF68763B,
-0xFF717E46,
-0xFF64713B,
-0xFF77864F,
-0xFF586932,
-0xFF566730,
-0xFF63743D,
-0xFF819059,
-0xFF78854F,
-0xFF5F6937,
-0xFF525B2C,
-0xFF5E6738,
-0xFF687142,
-0xFF6A7442,
-0xFF646C39,
-0xFF7F8754,
-0xFF69703D,
-0xFF646835,
-0xFF797C47,
-0xFF3D4023,
-0xFF353A1C,
-0xFF454C2D,
-0xFF4D5735,
-0xFF5A6640,
-0xFF243008,
-0xFF26300D,
-0xFF464D2E,
-0xFF4C4F34,
-0xFF2C2A11,
-0xFF353116,
-0xFF504F33,
-0xFF49492F,
-0xFF303316,
-0xFF333A18,
-0xFF404A25,
-0xFF404725,
-0xFF505735,
-0xFF6C7351,
-0xFF6F7954,
-0xFF6D7953,
-0xFF3A4920,
-0xFF304117,
-0xFF405125,
-0xFF2C3D11,
-0xFF3D4E22,
-0xFF5A6B3F,
-0xFF64734A,
-0xFF4F5E35,
-0xFF4C5B32,
-0xFF424E26,
-0xFF49532E,
-0xFF383F20,
-0xFF36391E,
-0xFF8D896E,
-0xFF696248,
-0xFF40361D,
-0xFF5F583C,
-0xFF4F4C2B,
-0xFF585937,
-0xFF2E3412,
-0xFF39401E,
-0xFF2B310D,
-0xFF5A603C,
-0xFF474B2A,
-0xFF656946,
-0xFF747950,
-0xFF51562D,
-0xFF4A4E2D,
-0xFF484C2B,
-0xFF5A5E39,
-0xFF343813,
-0xFF585C3B,
-0xFF5D6140,
-0xFF3F4320,
-0xFF3B3F1A,
-0xFF5E6039,
-0xFF484A25,
-0xFF525132,
-0xFF737253,
-0xFF413E1D,
-0xFF5B5835,
-0xFF464324,
-0xFF50502E,
-0xFFABB289,
-0xFF484C29,
-0xFF261D0C,
-0xFF4B3F33,
-0xFF504936,
-0xFF444236,
-0xFF383745,
-0xFF2B2F48,
-0xFF2B324C,
-0xFF232941,
-0xFF222337,
-0xFF252436,
-0xFF1C1D2F,
-0xFF282B3A,
-0xFF1F232F,
-0xFF252934,
-0xFF22222C,
-0xFF2D3039,
-0xFF0A0E17,
-0xFF0A0E11,
-0xFF0D0D05,
-0xFF73725D,
-0xFF92976F,
-0xFFB0B78B,
-0xFF1A2100,
-0xFF6C724C,
-0xFF72744D,
-0xFF555934,
-0xFF838C6F,
-0xFF444D38,
-0xFF2F3325,
-0xFF4F554B,
-0xFF141C0F,
-0xFF000500,
-0xFF000300,
-0xFF929783,
-0xFFE4EBC9,
-0xFFCCD4AD,
-0xFFD5DBBF,
-0xFF646953,
-0xFF000200,
-0xFF414234,
-0xFF221F0E,
-0xFF63624E,
-0xFF4B4C3C,
-0xFF1D220C,
-0xFF64704C,
-0xFF5B6946,
-0xFF131A08,
-0xFF212517,
-0xFF262715,
-0xFF74745C,
-0xFF555539,
-0xFF707453,
-0xFF4F5531,
-0xFF5A613F,
-0xFF101600,
-0xFF4B5137,
-0xFF313415,
-0xFF919572,
-0xFF525631,
-0xFF232800,
-0xFF636B44,
-0xFF3A4318,
-0xFF4D5725,
-0xFF868F5A,
-0xFF747B45,
-0xFF636A34,
-0xFF8F9863,
-0xFF949C69,
-0xFF5C6232,
-0xFF8D9367,
-0xFF393915,
-0xFF64613E,
-0xFF706B41,
-0xFF615D30,
-0xFF8E8B62,
-0xFF45461E,
-0xFFA6AD81,
-0xFF576031,
-0xFF4C5423,
-0xFFABB183,
-0xFFADB48A,
-0xFF3F4720,
-0xFF626A45,
-0xFF2B330A,
-0xFF6F7843,
-0xFF677039,
-0xFF6F7746,
-0xFF5C633A,
-0xFF4E5134,
-0xFF52563B,
-0xFF848A68,
-0xFF474D27,
-0xFF5F663D,
-0xFF4D542B,
-0xFF474B28,
-0xFF3A3F21,
-0xFF121700,
-0xFF717662,
-0xFF3F422D,
-0xFF33371E,
-0xFF616B49,
-0xFF47512C,
-0xFF404D22,
-0xFF485529,
-0xFF737F51,
-0xFF758151,
-0xFF657642,
-0xFF60713A,
-0xFF86955A,
-0xFF617133,
-0xFF8A9B64,
-0xFF73844D,
-0xFF9FB173,
-0xFF2C3C00,
-0xFF6C7944,
-0xFF6C7846,
-0xFF4A5324,
-0xFF3D4A15,
-0xFF5C6A2D,
-0xFFB9C789,
-0xFF506022,
-0xFF829156,
-0xFF87995D,
-0xFF516325,
-0xFF445916,
-0xFF728744,
-0xFF718444,
-0xFFA8B879,
-0xFF677538,
-0xFF657433,
-0xFF97AB64,
-0xFF889C54,
-0xFFB3C27F,
-0xFF404C0A,
-0xFFABBC78,
-0xFF7B894B,
-0xFFABB27C,
-0xFF7F8652,
-0xFF7B844D,
-0xFF747D44,
-0xFF7E864D,
-0xFF9CA167,
-0xFF81864E,
-0xFFAAAF77,
-0xFFA5A871,
-0xFF656831,
-0xFF696933,
-0xFF90935E,
-0xFF6D7343,
-0xFF818956,
-0xFF90985F,
-0xFF71793E,
-0xFF444614,
-0xFF787846,
-0xFF6D6D3B,
-0xFF70703E,
-0xFF474918,
-0xFF818552,
-0xFF64672E,
-0xFF8F9259,
-0xFF828550,
-0xFF626435,
-0xFF4F5129,
-0xFF8A8C67,
-0xFF8D8A69,
-0xFF5F5C39,
-0xFF6A6B41,
-0xFF5A5B2F,
-0xFF5F5C33,
-0xFF75714C,
-0xFF504F30,
-0xFF434226,
-0xFFA8A68D,
-0xFF2C280D,
-0xFF797454,
-0xFF716D4A,
-0xFF7A7555,
-0xFF383911,
-0xFF8D925A,
-0xFF747C41,
-0xFF8A9261,
-0xFF838A5E,
-0xFF7F8555,
-0xFF656B3F,
-0xFF303112,
-0xFF505132,
-0xFF66673D,
-0xFF9EA071,
-0xFF6D6E42,
-0xFF4D4B25,
-0xFF7F795F,
-0xFF736B54,
-0xFF918668,
-0xFF7C724F,
-0xFF5A572E,
-0xFF868559,
-0xFF817E53,
-0xFF9F9E70,
-0xFF606231,
-0xFF494D1A,
-0xFF7F8A50,
-0xFF849257,
-0xFF4B541D,
-0xFF545C29,
-0xFF5E6836,
-0xFF717A4B,
-0xFF868C5C,
-0xFF606734,
-0xFF6F7C46,
-0xFF44531C,
-0xFF717F4A,
-0xFF7D8A55,
-0xFF69743A,
-0xFF7A8448,
-0xFF6C763A,
-0xFF84894F,
-0xFF585824,
-0xFF7C7A49,
-0xFF837D4D,
-0xFF726E3F,
-0xFF76744B,
-0xFF555428,
-0xFF9D9D69,
-0xFF60602A,
-0xFF7B7946,
-0xFF757541,
-0xFF818650,
-0xFF323A01,
-0xFF545B25,
-0xFF8F9360,
-0xFF6E6B3E,
-0xFF737043,
-0xFF7B7949,
-0xFF6D6F3D,
-0xFF6B723C,
-0xFF5D662D,
-0xFF7E8750,
-0xFF57602B,
-0xFF4E5824,
-0xFF74804E,
-0xFF465421,
-0xFF637440,
-0xFF5D6E3A,
-0xFF697744,
-0xFF364214,
-0xFF757E53,
-0xFF444B1F,
-0xFF5D6735,
-0xFF68733B,
-0xFF5F6A32,
-0xFF78824D,
-0xFF606835,
-0xFF727546,
-0xFF828556,
-0xFF32361B,
-0xFF383F20,
-0xFF273011,
-0xFF283313,
-0xFF3B4624,
-0xFF222D0B,
-0xFF1E2708,
-0xFF1E2408,
-0xFF282A14,
-0xFF2F2E19,
-0xFF48462F,
-0xFF35351B,
-0xFF43462B,
-0xFF515638,
-0xFF454F2C,
-0xFF59633E,
-0xFF434A28,
-0xFF363D1B,
-0xFF161D00,
-0xFF535D3A,
-0xFF48542E,
-0xFF4C5B34,
-0xFF2D3C13,
-0xFF192A00,
-0xFF3B4C22,
-0xFF404F26,
-0xFF54633A,
-0xFF5D6941,
-0xFF67734B,
-0xFF4F5A32,
-0xFF414C24,
-0xFF3E4422,
-0xFF242408,
-0xFF605C43,
-0xFF544A31,
-0xFF322610,
-0xFF554633,
-0xFF6A5E46,
-0xFF4C4825,
-0xFF393913,
-0xFF464C28,
-0xFF454C2A,
-0xFF424824,
-0xFF585E3A,
-0xFF3C401F,
-0xFF6C704D,
-0xFF33380F,
-0xFF62673E,
-0xFF2A2E0D,
-0xFF303413,
-0xFF383E1A,
-0xFF4B512D,
-0xFF363C1A,
-0xFF949A76,
-0xFF828661,
-0xFF898E66,
-0xFF333712,
-0xFF3F401E,
-0xFF666747,
-0xFF525132,
-0xFF3E3E1C,
-0xFF585534,
-0xFF817E5F,
-0xFF414220,
-0xFF5E673A,
-0xFF1E2500,
-0xFF171100,
-0xFF3E3526,
-0xFF595441,
-0xFF38362A,
-0xFF272229,
-0xFF2B283B,
-0xFF2B2E41,
-0xFF292E41,
-0xFF1D1C2E,
-0xFF1D1C2E,
-0xFF242335,
-0xFF1A1C29,
-0xFF191C25,
-0xFF15181F,
-0xFF36373C,
-0xFF1C1D22,
-0xFF06090E,
-0xFF020605,
-0xFF151304,
-0xFF5A593D,
-0xFF6F744B,
-0xFF6B7246,
-0xFF484E2A,
-0xFF4C502D,
-0xFF505328,
-0xFF777D51,
-0xFF444E29,
-0xFF424D2F,
-0xFF848973,
-0xFF5C6051,
-0xFF767C72,
-0xFF585E54,
-0xFF242819,
-0xFF151900,
-0xFFAEB58B,
-0xFFB9C192,
-0xFFA6AC86,
-0xFF595E40,
-0xFF5F604E,
-0xFF151304,
-0xFF151203,
-0xFF696655,
-0xFF262715,
-0xFF52583C,
-0xFF708053,
-0xFF78875C,
-0xFF262D1B,
-0xFF090B00,
-0xFF181705,
-0xFF58583E,
-0xFF696947,
-0xFF868B63,
-0xFF878E64,
-0xFF5B663E,
-0xFF0C1200,
-0xFF181E04,
-0xFF838667,
-0xFFABAC8A,
-0xFF202200,
-0xFF73784F,
-0xFF7F885D,
-0xFF808C5E,
-0xFF8B9863,
-0xFF6D7840,
-0xFF666F38,
-0xFFB7C089,
-0xFF808A55,
-0xFF707A45,
-0xFF56602C,
-0xFF959C70,
-0xFF42441F,
-0xFF484522,
-0xFF888457,
-0xFF888455,
-0xFF6A6640,
-0xFF80825A,
-0xFF828A5B,
-0xFF76804E,
-0xFF373B08,
-0xFFC8CC9A,
-0xFF767C50,
-0xFF5F673E,
-0xFF3A4318,
-0xFF8D9667,
-0xFF6D763F,
-0xFF777E48,
-0xFF7A8052,
-0xFF3F441C,
-0xFF505336,
-0xFF5C6143,
-0xFF767C56,
-0xFF5D643A,
-0xFF777E54,
-0xFF42471E,
-0xFF787D55,
-0xFF2C300F,
-0xFF6F755B,
-0xFF232611,
-0xFF3C3E28,
-0xFF4F4F35,
-0xFF868C68,
-0xFF6F784B,
-0xFF313B07,
-0xFF909B63,
-0xFF7B844F,
-0xFF545E29,
-0xFF5B6C36,
-0xFF9CAD76,
-0xFF516025,
-0xFF94A368,
-0xFF7D8C55,
-0xFF697A43,
-0xFFB2C283,
-0xFF69793A,
-0xFF38450F,
-0xFFA0AC7A,
-0xFF727C4A,
-0xFFBECB95,
-0xFF606F2E,
-0xFFBFD08C,
-0xFF4E5E1F,
-0xFFA8BB7B,
-0xFF768B4A,
-0xFF324704,
-0xFF768D47,
-0xFF6B803B,
-0xFF5A6D2D,
-0xFF6D7D3F,
-0xFF3A480B,
-0xFF768645,
-0xFF61772E,
-0xFF94AA5F,
-0xFF93A35A,
-0xFF4A5A13,
-0xFF8FA35B,
-0xFF92A661,
-0xFF6C753C,
-0xFFACB37D,
-0xFF778248,
-0xFF677335,
-0xFF929B5C,
-0xFFADB677,
-0xFF878F54,
-0xFF90985F,
-0xFF70733E,
-0xFF53531F,
-0xFF777542,
-0xFF8E8E5C,
-0xFF4F5225,
-0xFF757D4E,
-0xFF7C854E,
-0xFF828B54,
-0xFF757947,
-0xFF5A5C2D,
-0xFF666535,
-0xFF6F6E3E,
-0xFF5C5E2F,
-0xFF686A39,
-0xFF7B7E45,
-0xFF61652A,
-0xFF8A8A54,
-0xFF707241,
-0xFF62673E,
-0xFF6D714C,
-0xFF898665,
-0xFF83815B,
-0xFF74774A,
-0xFF717445,
-0xFFA29F74,
-0xFF5D5B34,
-0xFF525230,
-0xFF4C4D2D,
-0xFF858664,
-0xFF4D4D29,
-0xFF736F4A,
-0xFF58542F,
-0xFF5F5D37,
-0xFF636639,
-0xFF454D12,
-0xFF98A466,
-0xFF8F9964,
-0xFF838D59,
-0xFF8A935C,
-0xFF5A622F,
-0xFF373B16,
-0xFF434722,
-0xFF636939,
-0xFF808754,
-0xFF535627,
-0xFF52542C,
-0xFF5F5F3D,
-0xFF3F3A1C,
-0xFF988F70,
-0xFF7F7753,
-0xFF908E67,
-0xFF606135,
-0xFF9F9F6D,
-0xFF848450,
-0xFF848654,
-0xFF848B55,
-0xFF768446,
-0xFF8F9D5F,
-0xFF586027,
-0xFF626935,
-0xFF596331,
-0xFF3A4314,
-0xFF585B2E,
-0xFF545A2C,
-0xFF525F2A,
-0xFF879862,
-0xFF435420,
-0xFF778550,
-0xFF46531B,
-0xFF586327,
-0xFF96A064,
-0xFF81864C,
-0xFF7C7C46,
-0xFF73703D,
-0xFF958D5C,
-0xFF716B3B,
-0xFF8C895E,
-0xFF4C4E1F,
-0xFF8B8E57,
-0xFF73743B,
-0xFF787645,
-0xFF717040,
-0xFF767D49,
-0xFF646D38,
-0xFF5B642F,
-0xFF525926,
-0xFF565328,
-0xFF817C52,
-0xFF9A9667,
-0xFF555523,
-0xFF7A814B,
-0xFF576027,
-0xFF707741,
-0xFF5C602D,
-0xFF59602C,
-0xFF808A56,
-0xFF374514,
-0xFF485827,
-0xFF495A26,
-0xFF758350,
-0xFF515D2F,
-0xFF697245,
-0xFF676F40,
-0xFF545E2A,
-0xFF6D7B40,
-0xFF5A682D,
-0xFF57612C,
-0xFF68703F,
-0xFF646A3A,
-0xFF525526,
-0xFF2D3415,
-0xFF505A38,
-0xFF232D0B,
-0xFF313A1B,
-0xFF2D361B,
-0xFF0F1400,
-0xFF1A1F08,
-0xFF232710,
-0xFF20240D,
-0xFF363822,
-0xFF32341E,
-0xFF2C2F14,
-0xFF434828,
-0xFF474D2B,
-0xFF4A512F,
-0xFF3D4422,
-0xFF222A05,
-0xFF303813,
-0xFF4A522D,
-0xFF252D08,
-0xFF838D68,
-0xFF929C77,
-0xFF404A25,
-0xFF232D08,
-0xFF333D18,
-0xFF36401B,
-0xFF666D4B,
-0xFF4F5533,
-0xFF414626,
-0xFF2E3112,
-0xFF272A0B,
-0xFF565235,
-0xFF968A70,
-0xFF5D4D34,
-0xFF42341A,
-0xFF52432C,
-0xFF40341E,
-0xFF393218,
-0xFF413E1B,
-0xFF393B16,
-0xFF404324,
-0xFF43482A,
-0xFF474E2C,
-0xFF3E4422,
-0xFF333818,
-0xFF252906,
-0xFF484D24,
-0xFF646940,
-0xFF6C704F,
-0xFF5D6242,
-0xFF353819,
-0xFF393C1D,
-0xFF2A2E0D,
-0xFF4D5130,
-0xFF7D7E5C,
-0xFF8B8F6A,
-0xFF797D58,
-0xFF616540,
-0xFF393D18,
-0xFF484A25,
-0xFF494A28,
-0xFF434321,
-0xFF7C7B5C,
-0xFF6D6F4A,
-0xFF474D21,
-0xFF4A5022,
-0xFFB8B690,
-0xFF7C7958,
-0xFF5B5A3E,
-0xFF46412E,
-0xFF372825,
-0xFF251619,
-0xFF2A2627,
-0xFF3A3B40,
-0xFF242335,
-0xFF211E33,
-0xFF211A2C,
-0xFF221F2A,
-0xFF303136,
-0xFF202123,
-0xFF383836,
-0xFF0C0D08,
-0xFF020500,
-0xFF1E2012,
-0xFF54523D,
-0xFF444023,
-0xFF363715,
-0xFF515534,
-0xFF515437,
-0xFF3A3E1D,
-0xFF3A3E0C,
-0xFF909761,
-0xFF8C986A,
-0xFF7E8967,
-0xFF000300,
-0xFF0A0C07,
-0xFF2F3237,
-0xFF23272A,
-0xFF31322C,
-0xFF424331,
-0xFF1F2302,
-0xFF595E36,
-0xFF5A5E3B,
-0xFF6A6D50,
-0xFF3F402E,
-0xFF403E31,
-0xFF373327,
-0xFF3A3726,
-0xFF57573F,
-0xFF3E441E,
-0xFF8E9B65,
-0xFF919F6C,
-0xFF393E28,
-0xFF252519,
-0xFF1C1906,
-0xFF3E3D21,
-0xFF6F6D47,
-0xFF878A5F,
-0xFF969C70,
-0xFF202800,
-0xFF151A00,
-0xFF121600,
-0xFFDEDEC2,
-0xFFA9A987,
-0xFF3F4016,
-0xFF929566,
-0xFF868E5D,
-0xFF414B17,
-0xFF86905B,
-0xFFAEB981,
-0xFF656F3A,
-0xFF9AA771,
-0xFF819059,
-0xFF617339,
-0xFF75864F,
-0xFF4A5823,
-0xFF70794C,
-0xFF7D8357,
-0xFF838554,
-0xFF929463,
-0xFF5F6139,
-0xFF202500,
-0xFF646D3E,
-0xFF8A935E,
-0xFF8F925B,
-0xFFACAF7A,
-0xFFB2B888,
-0xFF394213,
-0xFF525E2C,
-0xFF43501B,
-0xFF99A06A,
-0xFFBBBF8C,
-0xFF4B4E1F,
-0xFF7F8257,
-0xFF747B51,
-0xFF5B6439,
-0xFF868F60,
-0xFF3F4718,
-0xFF83895D,
-0xFF676941,
-0xFF3A3B19,
-0xFF717455,
-0xFF32351A,
-0xFF4D5035,
-0xFF3A361B,
-0xFF636041,
-0xFF5B5C34,
-0xFF737647,
-0xFF90955F,
-0xFF6F743A,
-0xFF3B3E05,
-0xFF9CA46B,
-0xFFA9B680,
-0xFF9EAD76,
-0xFF4D5A24,
-0xFF9CA971,
-0xFF88975E,
-0xFF79884D,
-0xFF94A466,
-0xFFA2B274,
-0xFF4C5923,
-0xFF8A9762,
-0xFFC7D49C,
-0xFF687639,
-0xFF8A9958,
-0xFFB6C783,
-0xFF8E9E5F,
-0xFF9FB272,
-0xFF485D1A,
-0xFF94A964,
-0xFF859A55,
-0xFF7A8F4C,
-0xFF5A6C30,
-0xFF7F8E53,
-0xFF404E10,
-0xFF758640,
-0xFF5D7426,
-0xFF748B39,
-0xFF7C8F3E,
-0xFF809344,
-0xFF80964B,
-0xFF8FA35C,
-0xFF6E7D3A,
-0xFF9FAB69,
-0xFF64732E,
-0xFF93A35A,
-0xFF7C883C,
-0xFF78843A,
-0xFF54611C,
-0xFF899356,
-0xFF7A7C4A,
-0xFF7A7847,
-0xFF504D18,
-0xFF82804D,
-0xFF4E5021,
-0xFF656B3D,
-0xFF76804C,
-0xFF97A16F,
-0xFF585F33,
-0xFF52582C,
-0xFF676B39,
-0xFF616332,
-0xFF62653A,
-0xFF707344,
-0xFF7E8247,
-0xFF6A6F2F,
-0xFF83864F,
-0xFF8B8F5D,
-0xFF878E64,
-0xFF575E34,
-0xFF707147,
-0xFF818354,
-0xFF7A814D,
-0xFF9DA470,
-0xFF757448,
-0xFF45461E,
-0xFF757750,
-0xFF6C7148,
-0xFF565C2E,
-0xFF757849,
-0xFF494A1E,
-0xFF7D7E52,
-0xFF888B5C,
-0xFF505723,
-0xFF7E884C,
-0xFF5B662A,
-0xFF95A068,
-0xFF5C6A2F,
-0xFF98A466,
-0xFF4D591B,
-0xFF9DA671,
-0xFF5A6231,
-0xFF394110,
-0xFF798150,
-0xFF6B7143,
-0xFF464C20,
-0xFF696E46,
-0xFF62643D,
-0xFF55532C,
-0xFF55532C,
-0xFF83855E,
-0xFF94976C,
-0xFF82854E,
-0xFF8C8F56,
-0xFF8B8E59,
-0xFF454A14,
-0xFF778345,
-0xFF727D41,
-0xFF6E7240,
-0xFF67693A,
-0xFF7D8353,
-0xFF989E6E,
-0xFF848758,
-0xFF3F4515,
-0xFF75814F,
-0xFF6A7B47,
-0xFF71824E,
-0xFF586631,
-0xFF3C4913,
-0xFF7A854D,
-0xFF7B8549,
-0xFF545C21,
-0xFF7B7F44,
-0xFFB3B27A,
-0xFF9A9462,
-0xFF7A7646,
-0xFF9F9E70,
-0xFF6A6E3C,
-0xFF7D844E,
-0xFF6C713B,
-0xFF535526,
-0xFF545627,
-0xFF8F9663,
-0xFF4D5522,
-0xFF5B6531,
-0xFF5F6535,
-0xFF88865D,
-0xFF565328,
-0xFF555424,
-0xFF777947,
-0xFF949D66,
-0xFF767F46,
-0xFF5F6630,
-0xFF686D37,
-0xFF7A8249,
-0xFF68713A,
-0xFF596631,
-0xFF63713C,
-0xFF7F9059,
-0xFF6F7E45,
-0xFF616E38,
-0xFF505A25,
-0xFF535D28,
-0xFF59632E,
-0xFF55622A,
-0xFF424F19,
-0xFF384210,
-0xFF58602F,
-0xFF8F9360,
-0xFF5F622D,
-0xFF2F3917,
-0xFF404A27,
-0xFF384220,
-0xFF363D1E,
-0xFF20250F,
-0xFF252817,
-0xFF1C1F0C,
-0xFF343722,
-0xFF21250E,
-0xFF2B3019,
-0xFF30351E,
-0xFF242A0E,
-0xFF4E5533,
-0xFF555D38,
-0xFF5C643F,
-0xFF68704B,
-0xFF2D3510,
-0xFF3C441D,
-0xFF353D16,
-0xFF656D48,
-0xFF2E3611,
-0xFF575F3A,
-0xFF6E7553,
-0xFF303614,
-0xFF353A1A,
-0xFF535838,
-0xFF26290C,
-0xFF29290D,
-0xFF343219,
-0xFF312F16,
-0xFF3B3620,
-0xFF473F28,
-0xFF3E2C14,
-0xFF5A442C,
-0xFF3C2C13,
-0xFF60543C,
-0xFF3B331E,
-0xFF342E16,
-0xFF403C1F,
-0xFF3F3E1F,
-0xFF27270D,
-0xFF2B2D15,
-0xFF464A2F,
-0xFF626749,
-0xFF393E20,
-0xFF676A4B,
-0xFF64663F,
-0xFF62643D,
-0xFF363C1A,
-0xFF2F3416,
-0xFF2F3217,
-0xFF222206,
-0xFF2C2D0E,
-0xFF696849,
-0xFF2D2C0D,
-0xFF6E6F4D,
-0xFF555934,
-0xFF5E633B,
-0xFF585F35,
-0xFF697047,
-0xFF2A2E0B,
-0xFF1C1D00,
-0xFF767757,
-0xFF838361,
-0xFF50502A,
-0xFF3A3B11,
-0xFF95986B,
-0xFF9B9E73,
-0xFF90906C,
-0xFF5C5038,
-0xFFB18F86,
-0xFF643E3D,
-0xFF45312A,
-0xFF3B302C,
-0xFF2A232B,
-0xFF241E2C,
-0xFF332733,
-0xFF2A2126,
-0xFF454442,
-0xFF1E1F19,
-0xFF35322B,
-0xFF0C0A00,
-0xFF191B06,
-0xFF55583D,
-0xFF5D593C,
-0xFF4D482A,
-0xFF454426,
-0xFF5C5C40,
-0xFF8F8F75,
-0xFF3B3C1C,
-0xFF101200,
-0xFF737A47,
-0xFF6E7951,
-0xFF303A1F,
-0xFF1B2113,
-0xFF5B5D5A,
-0xFF5D6164,
-0xFF191D1E,
-0xFF6C6D65,
-0xFF1E1D0B,
-0xFF7B7960,
-0xFF3F3E20,
-0xFF343515,
-0xFF656647,
-0xFF171700,
-0xFF4A4734,
-0xFF0A0500,
-0xFF5D5842,
-0xFF868664,
-0xFF595F33,
-0xFF78834B,
-0xFF444D1E,
-0xFF4C4E38,
-0xFF1C1A0D,
-0xFF1F1A06,
-0xFF4D4A2B,
-0xFFA29F76,
-0xFFB7B686,
-0xFF7A7D50,
-0xFF161B00,
-0xFF3A3E1D,
-0xFF494C2F,
-0xFF67664A,
-0xFFA9A987,
-0xFF979668,
-0xFFDBDEA9,
-0xFF7B824C,
-0xFF7C854C,
-0xFF717940,
-0xFF99A26B,
-0xFFA3AD79,
-0xFFC5D29D,
-0xFF75864F,
-0xFF8A9E63,
-0xFF82965B,
-0xFF94A66C,
-0xFF96A36E,
-0xFF7F8955,
-0xFF656C39,
-0xFF8E9464,
-0xFF32380C,
-0xFF585E32,
-0xFF676F3E,
-0xFF99A06A,
-0xFFBDBE84,
-0xFF818248,
-0xFFD6DFAA,
-0xFF5E6B36,
-0xFF5C6B34,
-0xFF5B6832,
-0xFF6E7541,
-0xFFD4D6A4,
-0xFF5D5F30,
-0xFF777A4B,
-0xFF9DA572,
-0xFF414B16,
-0xFF656F3B,
-0xFF707845,
-0xFF818457,
-0xFF5D5F37,
-0xFF737550,
-0xFF202101,
-0xFF141700,
-0xFF5B5C3C,
-0xFF302B0D,
-0xFF484220,
-0xFF8A875E,
-0xFF959363,
-0xFF6C6B35,
-0xFF626129,
-0xFF89884F,
-0xFF9C9F66,
-0xFF697239,
-0xFF4A571F,
-0xFF737D48,
-0xFFBBC590,
-0xFF5C6A2F,
-0xFF879759,
-0xFF92A264,
-0xFF455419,
-0xFF3D4A14,
-0xFFAFBC84,
-0xFF839153,
-0xFF82934F,
-0xFF82934D,
-0xFF7D8E4A,
-0xFF819454,
-0xFF7B8E4E,
-0xFF465A15,
-0xFFA3B971,
-0xFF7A8E49,
-0xFF718442,
-0xFF738344,
-0xFF98A867,
-0xFF899952,
-0xFF728536,
-0xFF6F8634,
-0xFF96AE5A,
-0xFF9DB05E,
-0xFFA0B362,
-0xFF91A75C,
-0xFF62782F,
-0xFF4D5F15,
-0xFFABBB72,
-0xFF8B9D53,
-0xFF839549,
-0xFF616F22,
-0xFF6E7C31,
-0xFF8B9B54,
-0xFF7D8949,
-0xFF696E38,
-0xFF92905F,
-0xFF6A6732,
-0xFF868350,
-0xFF504F1F,
-0xFF919767,
-0xFF3D4713,
-0xFFA2AE7C,
-0xFF667242,
-0xFF485220,
-0xFF6C733F,
-0xFF747B47,
-0xFF7E8454,
-0xFF8A8E5C,
-0xFFAFB376,
-0xFF848949,
-0xFFB3B67F,
-0xFF868A58,
-0xFF7B8354,
-0xFF575F30,
-0xFF747846,
-0xFFA3A774,
-0xFF666F38,
-0xFF8B945D,
-0xFF7A7C4D,
-0xFF97986C,
-0xFF686E40,
-0xFF545C2B,
-0xFF5C652E,
-0xFF676F36,
-0xFF4B4F1C,
-0xFF787C49,
-0xFF767E45,
-0xFF778144,
-0xFF8D9959,
-0xFF636F2D,
-0xFF829052,
-0xFF8B9A59,
-0xFFABB873,
-0xFF54601E,
-0xFF7B8549,
-0xFF525B26,
-0xFF969E6D,
-0xFF535B2C,
-0xFF7B8354,
-0xFF666D41,
-0xFF6A7147,
-0xFF898F63,
-0xFF5F6034,
-0xFF646539,
-0xFF60653C,
-0xFF5F6738,
-0xFF5C6129,
-0xFF81844B,
-0xFF7E804E,
-0xFF7B7F4C,
-0xFF646E31,
-0xFF7D874A,
-0xFF757745,
-0xFF4A4C1D,
-0xFF484A19,
-0xFFB4B886,
-0xFF767847,
-0xFF4F5525,
-0xFF909C6C,
-0xFFAABA89,
-0xFF51622E,
-0xFF475520,
-0xFF4E5B26,
-0xFF5D6732,
-0xFF555E25,
-0xFF545C21,
-0xFF53571C,
-0xFFA8A96F,
-0xFF94915E,
-0xFF7C7A49,
-0xFF505220,
-0xFF606733,
-0xFF97A067,
-0xFF858E57,
-0xFF787B4C,
-0xFF66693C,
-0xFF7D8451,
-0xFF6A723F,
-0xFF58622E,
-0xFF878F60,
-0xFF909167,
-0xFF505127,
-0xFF5F6130,
-0xFF5E652F,
-0xFF929D65,
-0xFF869157,
-0xFF707741,
-0xFF797E46,
-0xFF656A30,
-0xFF586226,
-0xFF7C8951,
-0xFF52612A,
-0xFF6D7F43,
-0xFF5E6E30,
-0xFF606E31,
-0xFF5A652B,
-0xFF545F27,
-0xFF58652F,
-0xFF4F5E27,
-0xFF3C4A15,
-0xFF444D1E,
-0xFF343C0B,
-0xFF686D35,
-0xFF666930,
-0xFF4B5532,
-0xFF222C09,
-0xFF29300F,
-0xFF2D3118,
-0xFF323524,
-0xFF414135,
-0xFF262719,
-0xFF1C1F0C,
-0xFF1B200A,
-0xFF0A1200,
-0xFF1F280D,
-0xFF3C4526,
-0xFF525D35,
-0xFF6D754C,
-0xFF373F1A,
-0xFF727A55,
-0xFF727D53,
-0xFF586339,
-0xFF2C370D,
-0xFF404B23,
-0xFF3D4520,
-0xFF666D4B,
-0xFF747959,
-0xFF313417,
-0xFF34341A,
-0xFF414127,
-0xFF3E3C25,
-0xFF3F3D28,
-0xFF3B3623,
-0xFF625D4A,
-0xFF403927,
-0xFF312413,
-0xFF5C4631,
-0xFF503A23,
-0xFF493922,
-0xFF2A1F09,
-0xFF35301D,
-0xFF363320,
-0xFF59543E,
-0xFF403B25,
-0xFF24210E,
-0xFF31301E,
-0xFF3F412C,
-0xFF323520,
-0xFF2F321D,
-0xFF373921,
-0xFF605F40,
-0xFF4B4C2A,
-0xFF3D4222,
-0xFF3F4529,
-0xFF42442E,
-0xFF35351D,
-0xFF2F2B0E,
-0xFF464324,
-0xFF5E5B3C,
-0xFF636243,
-0xFF282C07,
-0xFF121900,
-0xFF576031,
-0xFF323B0E,
-0xFF2F3511,
-0xFF212705,
-0xFF303111,
-0xFF494829,
-0xFF665F42,
-0xFF454020,
-0xFF444B22,
-0xFF9BA276,
-0xFFA19E73,
-0xFF6B5033,
-0xFFC98A85,
-0xFFC67E82,
-0xFFBD8A86,
-0xFF68473E,
-0xFF322119,
-0xFF3C312B,
-0xFF53413F,
-0xFF564742,
-0xFF3B372B,
-0xFF191A0C,
-0xFF4B473B,
-0xFF25200D,
-0xFF5E5E3C,
-0xFF676840,
-0xFFA6A27D,
-0xFF383313,
-0xFF585437,
-0xFF67664A,
-0xFF858666,
-0xFF1E2000,
-0xFF6E6F45,
-0xFF676944,
-0xFF323625,
-0xFF2D3329,
-0xFF40433C,
-0xFF979A91,
-0xFF40463A,
-0xFF3C4031,
-0xFF939580,
-0xFF6D6B56,
-0xFF231E0B,
-0xFF38311E,
-0xFF99957A,
-0xFF4F4F2D,
-0xFF949470,
-0xFF696945,
-0xFF070400,
-0xFF5B5835,
-0xFF636236,
-0xFF7A7C4D,
-0xFF83895B,
-0xFF4D512C,
-0xFF51503C,
-0xFF5A5446,
-0xFF28220C,
-0xFF6B6646,
-0xFFAAA677,
-0xFFA6A471,
-0xFF686A3B,
-0xFF484A22,
-0xFF3A3B19,
-0xFF757455,
-0xFF908C6F,
-0xFF474421,
-0xFF918F5C,
-0xFF949559,
-0xFFA0A668,
-0xFF585E20,
-0xFF91945B,
-0xFF757A44,
-0xFF969C6C,
-0xFF6E7846,
-0xFF485720,
-0xFF9AAC70,
-0xFFA4B67A,
-0xFF8FA165,
-0xFF9FAD72,
-0xFF69743A,
-0xFF99A26D,
-0xFF7D8353,
-0xFF464C20,
-0xFF5F6235,
-0xFF585C2A,
-0xFFB4B780,
-0xFF9E9E60,
-0xFF818344,
-0xFF6C753E,
-0xFFCCD9A4,
-0xFF7D8C53,
-0xFF7E8951,
-0xFF747846,
-0xFFCBCA9A,
-0xFF7A794B,
-0xFFC8CA99,
-0xFFA9B279,
-0xFF6C773D,
-0xFF647139,
-0xFF606835,
-0xFF737647,
-0xFF95966A,
-0xFF6B6D45,
-0xFF40451D,
-0xFF575C34,
-0xFF7F7F59,
-0xFF6D6743,
-0xFF5B532E,
-0xFFA29A73,
-0xFFA9A276,
-0xFF5A5724,
-0xFF5D5A25,
-0xFFCCC992,
-0xFFACAD73,
-0xFF969E62,
-0xFF4C571B,
-0xFF5A652D,
-0xFF8F9A62,
-0xFF657034,
-0xFF6B793B,
-0xFF808E51,
-0xFF57652A,
-0xFF9FAC74,
-0xFF5B692C,
-0xFFC0D18D,
-0xFF708238,
-0xFF586A20,
-0xFFA5B971,
-0xFF9AAD6D,
-0xFF5F7232,
-0xFF718540,
-0xFF81954E,
-0xFF73843E,
-0xFF96A760,
-0xFF9EB066,
-0xFF98A959,
-0xFF71802B,
-0xFF90A34A,
-0xFF768C37,
-0xFF89A14B,
-0xFFBFD37E,
-0xFFB8CE7C,
-0xFF6B8339,
-0xFF627A30,
-0xFF90A558,
-0xFFA6B86C,
-0xFF80914A,
-0xFF5D6E2A,
-0xFF4F5E1D,
-0xFF576625,
-0xFF7D904E,
-0xFF819150,
-0xFF90985D,
-0xFF8B8B55,
-0xFF888250,
-0xFF979363,
-0xFF878755,
-0xFF8D9460,
-0xFF637038,
-0xFFA3B279,
-0xFF7D8C51,
-0xFFA5B577,
-0xFFA9B478,
-0xFF99A366,
-0xFF9DA76A,
-0xFFA1A96D,
-0xFFA3A868,
-0xFF929357,
-0xFFB4B47E,
-0xFF959765,
-0xFF666E3B,
-0xFF9CA471,
-0xFF929963,
-0xFF727943,
-0xFF707B43,
-0xFF515C24,
-0xFF828653,
-0xFF737744,
-0xFFA7B07B,
-0xFF69743A,
-0xFF707B3F,
-0xFF667033,
-0xFF6B7539,
-0xFF616B2E,
-0xFF7A8543,
-0xFF839048,
-0xFF69772A,
-0xFF9AAB5D,
-0xFF63732C,
-0xFF5E6E27,
-0xFF99A75C,
-0xFF818E48,
-0xFF79844A,
-0xFF7F8957,
-0xFF80895A,
-0xFF5E673A,
-0xFF343D10,
-0xFF5E673C,
-0xFF697247,
-0xFF4E5529,
-0xFF737745,
-0xFF626633,
-0xFF454D1E,
-0xFF636B3A,
-0xFF515822,
-0xFF4E531D,
-0xFF595C2D,
-0xFF7A7E4C,
-0xFF798344,
-0xFF8F9857,
-0xFF72753E,
-0xFF3D3F0D,
-0xFF626433,
-0xFF6A6E3C,
-0xFF797B4A,
-0xFF242A00,
-0xFFB6C294,
-0xFF3D4B1A,
-0xFF717F4A,
-0xFF4B5A23,
-0xFF414E19,
-0xFF757F4B,
-0xFF57612C,
-0xFF838C53,
-0xFF8D9357,
-0xFF7E8247,
-0xFF696734,
-0xFF5E5E2A,
-0xFF72773F,
-0xFF596327,
-0xFF6C7A3D,
-0xFF768147,
-0xFF656B3B,
-0xFF7D8355,
-0xFF606934,
-0xFF414A13,
-0xFF616B37,
-0xFF606837,
-0xFF3A4014,
-0xFF6A7042,
-0xFF686F3B,
-0xFF525D25,
-0xFF5E6B33,
-0xFF616E36,
-0xFF5F682F,
-0xFF7C8147,
-0xFF5D6327,
-0xFF525A1E,
-0xFF586329,
-0xFF627136,
-0xFF809353,
-0xFF627231,
-0xFF788648,
-0xFF5F6D30,
-0xFF6A7741,
-0xFF424F1A,
-0xFF5E6C39,
-0xFF586635,
-0xFF596235,
-0xFF4A5221,
-0xFF747941,
-0xFF75793E,
-0xFF656D48,
-0xFF353C1A,
-0xFF373C1E,
-0xFF2F331A,
-0xFF424333,
-0xFF2E2F21,
-0xFF2C2D1F,
-0xFF3D402F,
-0xFF414630,
-0xFF6F785D,
-0xFF4C5739,
-0xFF4A5533,
-0xFF69744C,
-0xFF7C875D,
-0xFF1F2700,
-0xFF939B72,
-0xFF7C895D,
-0xFF3D4D20,
-0xFF566337,
-0xFF646F45,
-0xFF454F2A,
-0xFF6F7654,
-0xFF1D2204,
-0xFF3C3E26,
-0xFF44432E,
-0xFF413E2B,
-0xFF474431,
-0xFF332D1D,
-0xFF453F2F,
-0xFF312B1B,
-0xFF4B4434,
-0xFF342917,
-0xFF5D4B35,
-0xFF7A6852,
-0xFF60553F,
-0xFF47412B,
-0xFF33301F,
-0xFF413E2D,
-0xFF494431,
-0xFF3B3422,
-0xFF2F271A,
-0xFF534D41,
-0xFF0A0600,
-0xFF141203,
-0xFF1C1D0D,
-0xFF34331F,
-0xFF5A593D,
-0xFF6F7050,
-0xFF464D2C,
-0xFF555B3F,
-0xFF4E503A,
-0xFF6F6D58,
-0xFF736D53,
-0xFF7C7759,
-0xFF7A7558,
-0xFF787758,
-0xFF585C37,
-0xFF4B5427,
-0xFF606C3A,
-0xFF3B4918,
-0xFF37421A,
-0xFF1E2503,
-0xFF36391A,
-0xFF4C4B2D,
-0xFF211A00,
-0xFF3A3518,
-0xFF656B49,
-0xFF6A7148,
-0xFF7E7D51,
-0xFF735C3A,
-0xFFB07567,
-0xFFA15C55,
-0xFF713D2F,
-0xFF866651,
-0xFF69593F,
-0xFF453E22,
-0xFF392A17,
-0xFF564936,
-0xFF6F6B52,
-0xFF605E45,
-0xFF37321C,
-0xFF393417,
-0xFF75734C,
-0xFFABAA7C,
-0xFF7E7A54,
-0xFF3F3917,
-0xFF625D3F,
-0xFF5C583B,
-0xFF50502E,
-0xFF42421C,
-0xFF63643C,
-0xFF505131,
-0xFF585A4C,
-0xFF30332A,
-0xFF797D6C,
-0xFF4A4F38,
-0xFF576043,
-0xFF8E9574,
-0xFF484929,
-0xFF514D30,
-0xFF3C3523,
-0xFF776F5C,
-0xFF8E896C,
-0xFF73714B,
-0xFF6A6B41,
-0xFF8F9064,
-0xFF67653E,
-0xFF626037,
-0xFF3D3C0C,
-0xFF757444,
-0xFF494B23,
-0xFF6C6D4D,
-0xFF292410,
-0xFF0C0500,
-0xFF39311A,
-0xFFA29C7A,
-0xFF777343,
-0xFF72713B,
-0xFF777648,
-0xFF6D6E44,
-0xFF80805A,
-0xFF4A4724,
-0xFF858060,
-0xFF555229,
-0xFF96955D,
-0xFFACAE6D,
-0xFF9BA05D,
-0xFF9DA260,
-0xFF656529,
-0xFF51511B,
-0xFF4A5020,
-0xFF515B29,
-0xFF707F46,
-0xFF899B5F,
-0xFF738249,
-0xFF97A56A,
-0xFF96A165,
-0xFF707A3E,
-0xFFACB580,
-0xFF8D9562,
-0xFF818757,
-0xFF414415,
-0xFFA9AB79,
-0xFFB6B77E,
-0xFF959555,
-0xFF7B7D3E,
-0xFF374009,
-0xFFD4E1AC,
-0xFF8B9862,
-0xFF414B16,
-0xFF888C5A,
-0xFFB9B88A,
-0xFFC1C092,
-0xFF929463,
-0xFFA3AB72,
-0xFFA3AE74,
-0xFF56602B,
-0xFF5D6532,
-0xFFC1C593,
-0xFF616334,
-0xFF737949,
-0xFF767C4E,
-0xFF6C7244,
-0xFF46491C,
-0xFF5A552D,
-0xFF544C25,
-0xFF1C1500,
-0xFF6F683C,
-0xFF989464,
-0xFF96935E,
-0xFF85824B,
-0xFF9A9960,
-0xFF6E7738,
-0xFF798547,
-0xFF6F7A40,
-0xFF707B41,
-0xFF586225,
-0xFF7C8848,
-0xFF6F7B3D,
-0xFF9AA86B,
-0xFF4D5B20,
-0xFFB2C083,
-0xFF899A53,
-0xFF889A4E,
-0xFF5B7021,
-0xFF6C8136,
-0xFFAABD7B,
-0xFF5E6E30,
-0xFF3F4F0E,
-0xFF748340,
-0xFF7A8944,
-0xFF97A75E,
-0xFF98A657,
-0xFF859441,
-0xFF83933A,
-0xFFBBCE75,
-0xFF576D1A,
-0xFF8DA351,
-0xFF8FA251,
-0xFF7E9344,
-0xFF576E26,
-0xFFA8C076,
-0xFF879C4D,
-0xFF6F8233,
-0xFF7B8F48,
-0xFF5A6D2D,
-0xFF6F7E45,
-0xFF647338,
-0xFF607532,
-0xFF6C803B,
-0xFF76813F,
-0xFF808449,
-0xFF716E39,
-0xFF83804D,
-0xFF727240,
-0xFF767D49,
-0xFF414F14,
-0xFF364608,
-0xFF3F4F10,
-0xFF5F6F2E,
-0xFF4B5717,
-0xFF859151,
-0xFF76813F,
-0xFF7D8643,
-0xFFABB070,
-0xFF8A8B51,
-0xFF80804E,
-0xFF7A7C4B,
-0xFF919865,
-0xFFABB47D,
-0xFF7A8247,
-0xFF81894E,
-0xFF515C22,
-0xFF838E56,
-0xFF5F6633,
-0xFF929965,
-0xFF717A43,
-0xFF6B763A,
-0xFF98A466,
-0xFF6F7B3D,
-0xFFA7B175,
-0xFF909A5B,
-0xFF85924D,
-0xFF77853A,
-0xFF718331,
-0xFFB7C977,
-0xFF637426,
-0xFF75853A,
-0xFF8A974F,
-0xFF65722D,
-0xFF5D682E,
-0xFFA7B17D,
-0xFF646E3C,
-0xFF485122,
-0xFF283404,
-0xFF566234,
-0xFF333A11,
-0xFF454B1F,
-0xFF828654,
-0xFF555C26,
-0xFF555D2A,
-0xFF555D2C,
-0xFF656D3C,
-0xFF3E4414,
-0xFF52582A,
-0xFF515825,
-0xFF8A9455,
-0xFF7A8340,
-0xFF878D51,
-0xFF7F844C,
-0xFF676B38,
-0xFF5B5F2D,
-0xFF5D5F30,
-0xFF4F5225,
-0xFFB8C194,
-0xFF7B8757,
-0xFF76834D,
-0xFF727F49,
-0xFF4A5420,
-0xFF545E2C,
-0xFF57612D,
-0xFF757E49,
-0xFF757D44,
-0xFF7E8349,
-0xFF979763,
-0xFF656833,
-0xFF6F773B,
-0xFF8D9959,
-0xFF667534,
-0xFF728043,
-0xFF5A622F,
-0xFF8E9562,
-0xFF79804A,
-0xFF687138,
-0xFF727B46,
-0xFF676F3C,
-0xFF474E22,
-0xFF6D7546,
-0xFF758048,
-0xFF627035,
-0xFF66753C,
-0xFF6D7A42,
-0xFF4C551C,
-0xFF889057,
-0xFF65682F,
-0xFF6C7137,
-0xFF687138,
-0xFF69773C,
-0xFF7E8E4D,
-0xFF687B39,
-0xFF6B793C,
-0xFF515E26,
-0xFF43501B,
-0xFF65713F,
-0xFF4F5D2A,
-0xFF4E5C2B,
-0xFF677345,
-0xFF4A5223,
-0xFF6E733D,
-0xFF5E6128,
-0xFF444A28,
-0xFF474C2C,
-0xFF303419,
-0xFF2A2E17,
-0xFF3F432C,
-0xFF262914,
-0xFF343724,
-0xFF323723,
-0xFF596149,
-0xFF4D5639,
-0xFF4B5634,
-0xFF424E28,
-0xFF444E29,
-0xFF48532B,
-0xFF3D481E,
-0xFF879468,
-0xFF768858,
-0xFF415522,
-0xFF95A679,
-0xFF36451A,
-0xFF3C4822,
-0xFF273011,
-0xFF1C2208,
-0xFF161904,
-0xFF3F402E,
-0xFF363425,
-0xFF3B392A,
-0xFF43402F,
-0xFF403D2C,
-0xFF2B2815,
-0xFF373622,
-0xFF323019,
-0xFF383218,
-0xFF5E583E,
-0xFF2A280F,
-0xFF494833,
-0xFF565541,
-0xFF5F5C4B,
-0xFF4B4432,
-0xFF6A6150,
-0xFF494031,
-0xFF291F15,
-0xFF120A00,
-0xFF1E180C,
-0xFF3A362A,
-0xFF444130,
-0xFF524D37,
-0xFF2F2F13,
-0xFF5F6645,
-0xFF171E00,
-0xFF30321A,
-0xFF443F29,
-0xFF3C351B,
-0xFF514A2E,
-0xFF605B3D,
-0xFF575735,
-0xFF555A32,
-0xFF556133,
-0xFF869461,
-0xFF5D6D3C,
-0xFF424E26,
-0xFF394320,
-0xFF171C00,
-0xFF393C1D,
-0xFF7B7A5B,
-0xFF69684A,
-0xFF7F7F63,
-0xFF676A4B,
-0xFF4B5229,
-0xFF56542B,
-0xFF94805D,
-0xFF866C4B,
-0xFF5B4722,
-0xFF90845C,
-0xFF5D5A2F,
-0xFF535428,
-0xFF58562D,
-0xFFC0BC96,
-0xFF9E9973,
-0xFF4A4420,
-0xFF6B6742,
-0xFF908C66,
-0xFF59572E,
-0xFF4C4B1F,
-0xFF88845F,
-0xFF433D1B,
-0xFF5B5734,
-0xFF918E6B,
-0xFF514E2B,
-0xFF7A7852,
-0xFF626039,
-0xFF595935,
-0xFF8F9277,
-0xFF696D52,
-0xFF5E653B,
-0xFFA9B182,
-0xFF879365,
-0xFF5D6639,
-0xFF494C1F,
-0xFF828059,
-0xFF554E32,
-0xFF7D765A,
-0xFF9B9772,
-0xFF87855C,
-0xFFB0B283,
-0xFF414216,
-0xFF45431C,
-0xFF5B5930,
-0xFF555225,
-0xFF77764A,
-0xFF595935,
-0xFF434224,
-0xFF28220A,
-0xFF5C543D,
-0xFF655E41,
-0xFFB8B38D,
-0xFF545020,
-0xFF797641,
-0xFF858353,
-0xFF565529,
-0xFF54522B,
-0xFF5B5932,
-0xFF8B8761,
-0xFF848252,
-0xFFA7A96A,
-0xFF535611,
-0xFFADB36D,
-0xFF808240,
-0xFF6D6B2E,
-0xFF76753F,
-0xFF626536,
-0xFF5E6836,
-0xFF5D6A32,
-0xFF58672C,
-0xFF515B27,
-0xFFBEC792,
-0xFF5F672E,
-0xFF6D753C,
-0xFF646D36,
-0xFF9BA46F,
-0xFF8E9663,
-0xFF5E6531,
-0xFFB7BA83,
-0xFF84854B,
-0xFF9C9C5E,
-0xFF8D8E52,
-0xFF686F3B,
-0xFF646E3C,
-0xFFD0DAA8,
-0xFF4C5624,
-0xFF717445,
-0xFF636536,
-0xFFC8CA9B,
-0xFFA0A273,
-0xFF6C7340,
-0xFF7F8754,
-0xFF8B9362,
-0xFF7A8251,
-0xFF898D5B,
-0xFF4E521F,
-0xFF767D49,
-0xFF6C7540,
-0xFF7E8752,
-0xFF616835,
-0xFFC6C599,
-0xFF59542C,
-0xFF646134,
-0xFF949262,
-0xFF7D7B4A,
-0xFF777542,
-0xFF8A8953,
-0xFF75763D,
-0xFF606A2D,
-0xFF627032,
-0xFF626D31,
-0xFF798347,
-0xFF7A8246,
-0xFF838C4D,
-0xFF4B5516,
-0xFF7D894B,
-0xFFB4BF85,
-0xFF657336,
-0xFF7D8E47,
-0xFF86994A,
-0xFF5F7221,
-0xFF9AAC60,
-0xFF59692A,
-0xFF9EAC71,
-0xFF637136,
-0xFF5F6B2D,
-0xFF95A25D,
-0xFFAAB76F,
-0xFF808C40,
-0xFF93A051,
-0xFF677424,
-0xFF889647,
-0xFF65772D,
-0xFF41520C,
-0xFF82934C,
-0xFF52661E,
-0xFF8FA45F,
-0xFF41570F,
-0xFF869B4E,
-0xFF6A7F32,
-0xFF5B6F2A,
-0xFF758749,
-0xFF53622B,
-0xFF65773D,
-0xFF9AB169,
-0xFF758D41,
-0xFF7A8A41,
-0xFF3F4805,
-0xFF7F8044,
-0xFF6A6A34,
-0xFF676B38,
-0xFF353E09,
-0xFF616C30,
-0xFF7A8948,
-0xFF4A581A,
-0xFF798547,
-0xFF6F7B3D,
-0xFF818B4C,
-0xFF697533,
-0xFF8F9857,
-0xFF8F9356,
-0xFF84834D,
-0xFF676437,
-0xFF5B5C32,
-0xFF808656,
-0xFF88915A,
-0xFF868F50,
-0xFF77803F,
-0xFF6E783C,
-0xFF767F4A,
-0xFF6C6F40,
-0xFF696C3F,
-0xFF7E8653,
-0xFF49541C,
-0xFFA4AE72,
-0xFF6C763A,
-0xFF7C854C,
-0xFF9BA569,
-0xFF525E1E,
-0xFF7F8C46,
-0xFF5E6E23,
-0xFF90A151,
-0xFF909F4E,
-0xFFA5B366,
-0xFF5D6826,
-0xFF3B4509,
-0xFF8D975B,
-0xFF919A61,
-0xFF414B16,
-0xFF3F4914,
-0xFF7E8B55,
-0xFF525C2A,
-0xFF3E431B,
-0xFF4D4F27,
-0xFF747647,
-0xFF464A17,
-0xFF4F5622,
-0xFF495120,
-0xFF636A40,
-0xFF777E54,
-0xFF606839,
-0xFF414A15,
-0xFF566023,
-0xFF65702C,
-0xFFA5AE6D,
-0xFF7D8748,
-0xFF636C35,
-0xFF4F5724,
-0xFF6A6B3F,
-0xFF8E8F65,
-0xFF757C50,
-0xFF9AA374,
-0xFF58622D,
-0xFF616A35,
-0xFF646C39,
-0xFF515928,
-0xFF50592A,
-0xFF727A49,
-0xFF909763,
-0xFF797D4A,
-0xFFA7A977,
-0xFF6F743C,
-0xFF6F793A,
-0xFF99A661,
-0xFF54631E,
-0xFF707C3A,
-0xFF727943,
-0xFF929761,
-0xFF81864C,
-0xFF767C40,
-0xFF434B12,
-0xFF67703B,
-0xFF687142,
-0xFF7B8755,
-0xFF6A7940,
-0xFF4E5D22,
-0xFF617339,
-0xFF78874E,
-0xFF5B662C,
-0xFF737B42,
-0xFF4C4F1A,
-0xFF767B45,
-0xFF626B34,
-0xFF69773C,
-0xFF718142,
-0xFF748747,
-0xFF606D37,
-0xFF596533,
-0xFF5B6739,
-0xFF586436,
-0xFF5E6C39,
-0xFF52602D,
-0xFF4C582A,
-0xFF4A5223,
-0xFF636534,
-0xFF5C5C2A,
-0xFF46492A,
-0xFF484B2E,
-0xFF3F432A,
-0xFF272B12,
-0xFF22280C,
-0xFF3B4125,
-0xFF393F25,
-0xFF323A22,
-0xFF485136,
-0xFF363F20,
-0xFF414B26,
-0xFF4D5732,
-0xFF252F0C,
-0xFF1E2803,
-0xFF59643A,
-0xFF8B9B6C,
-0xFF6C7E4A,
-0xFF8A9E69,
-0xFF6C7E4E,
-0xFF2E3D12,
-0xFF384420,
-0xFF1A2306,
-0xFF1E230D,
-0xFF262916,
-0xFF1C1E10,
-0xFF232416,
-0xFF2E2F1F,
-0xFF20210F,
-0xFF272914,
-0xFF22240E,
-0xFF1E2008,
-0xFF3F4328,
-0xFF2E3112,
-0xFF303314,
-0xFF55583B,
-0xFF4B4B31,
-0xFF45432C,
-0xFF443F29,
-0xFF645E46,
-0xFF433B26,
-0xFF342C19,
-0xFF312A18,
-0xFF3C3427,
-0xFF302A1C,
-0xFF514B3D,
-0xFF43402D,
-0xFF4F4A34,
-0xFF4F5031,
-0xFF717856,
-0xFF161D00,
-0xFF272809,
-0xFF454126,
-0xFF514A2E,
-0xFF463F22,
-0xFF373214,
-0xFF3B3B17,
-0xFF5A6137,
-0xFF616D3F,
-0xFF93A372,
-0xFF536535,
-0xFF5C6D41,
-0xFF44502A,
-0xFF1D2403,
-0xFF282D0D,
-0xFF3D3E1C,
-0xFF6D6E4C,
-0xFF2F2E12,
-0xFF4C4F32,
-0xFF464E27,
-0xFF444D20,
-0xFF848355,
-0xFF7A7848,
-0xFF696838,
-0xFF4D4F1E,
-0xFF838553,
-0xFF8F9360,
-0xFF737544,
-0xFFD8D7A7,
-0xFF635F32,
-0xFF7D764C,
-0xFFA6A37A,
-0xFF817F56,
-0xFF3E3C13,
-0xFF53512A,
-0xFF615D38,
-0xFF524E2B,
-0xFF9F9B78,
-0xFFACA883,
-0xFF312D08,
-0xFF797750,
-0xFF59582C,
-0xFF6B6940,
-0xFF3F3F1D,
-0xFF888A65,
-0xFFC4C896,
-0xFF9AA16D,
-0xFF677341,
-0xFF3E4A1A,
-0xFF565D2A,
-0xFF8D8C5E,
-0xFF87815D,
-0xFF5E5836,
-0xFF5F5D34,
-0xFF6F7044,
-0xFF3B3C10,
-0xFF57582E,
-0xFF32300A,
-0xFF5E5C36,
-0xFF7B784F,
-0xFF716F46,
-0xFF64613E,
-0xFF848162,
-0xFF6E694C,
-0xFF564F32,
-0xFF4C4624,
-0xFF817E55,
-0xFF5A5626,
-0xFF807E4B,
-0xFF858353,
-0xFF353205,
-0xFF79774E,
-0xFF68663D,
-0xFFB6B587,
-0xFFAAAA74,
-0xFF8C8E4D,
-0xFF959851,
-0xFFA4AA62,
-0xFFA6A866,
-0xFF8D8D4F,
-0xFF818249,
-0xFF353C09,
-0xFFA4B07E,
-0xFF39460E,
-0xFF6E7B43,
-0xFF262E00,
-0xFF848A5C,
-0xFF5B5F2C,
-0xFF7C834D,
-0xFF8C955E,
-0xFF949E69,
-0xFF848F57,
-0xFFA7B077,
-0xFF52571F,
-0xFF5C6025,
-0xFF4E4F13,
-0xFF606429,
-0xFF5B5F2C,
-0xFF626A39,
-0xFFC2CA9B,
-0xFF7E8657,
-0xFF9AA070,
-0xFF5B6131,
-0xFFCED1A2,
-0xFF7E8154,
-0xFF76794C,
-0xFF858B5F,
-0xFF6D7347,
-0xFF686E40,
-0xFFB6BD8A,
-0xFF747B45,
-0xFF8C935D,
-0xFF78814A,
-0xFF5E6730,
-0xFF818855,
-0xFF292A00,
-0xFF403F13,
-0xFF686836,
-0xFF585B26,
-0xFF797C45,
-0xFFB0B07A,
-0xFF858551,
-0xFF80834E,
-0xFF757F43,
-0xFF8B965A,
-0xFF707A3E,
-0xFF727A3F,
-0xFF757A40,
-0xFF868C50,
-0xFFA6AF70,
-0xFFBEC88B,
-0xFF5A632A,
-0xFF2B3600,
-0xFF596922,
-0xFF849748,
-0xFF9BAE5D,
-0xFF809246,
-0xFF7B894C,
-0xFF77814C,
-0xFF6A753D,
-0xFF848E52,
-0xFF8F9A58,
-0xFF66702B,
-0xFF9BA560,
-0xFF5F6924,
-0xFF4A540F,
-0xFF85904C,
-0xFF828E4E,
-0xFF384608,
-0xFF71803F,
-0xFF98A867,
-0xFF778B46,
-0xFF4C6019,
-0xFF677B33,
-0xFF687C34,
-0xFF9FB06C,
-0xFF3F4F10,
-0xFF56652C,
-0xFF223400,
-0xFF6C863C,
-0xFFA9C173,
-0xFF475811,
-0xFF64712C,
-0xFF7A8342,
-0xFF4B5016,
-0xFF49501D,
-0xFF808855,
-0xFFA5B074,
-0xFF3F4B0D,
-0xFF646D34,
-0xFF919A61,
-0xFF8F975B,
-0xFF778142,
-0xFF737F3F,
-0xFF737D40,
-0xFF777A43,
-0xFFA7A574,
-0xFF817E53,
-0xFF919064,
-0xFF7B7F4C,
-0xFF5D652A,
-0xFFABB171,
-0xFFB4BA7A,
-0xFF747C41,
-0xFF6E7541,
-0xFF717344,
-0xFF7D7F50,
-0xFF727946,
-0xFF929B66,
-0xFF39420B,
-0xFF666F38,
-0xFF5E662D,
-0xFF899357,
-0xFF798344,
-0xFF7D8947,
-0xFF374301,
-0xFF5C6923,
-0xFF8B9849,
-0xFF606C22,
-0xFF61692E,
-0xFF909761,
-0xFF98A065,
-0xFF60682D,
-0xFF5D662F,
-0xFF545E29,
-0xFF86905B,
-0xFF78804F,
-0xFF4B4D25,
-0xFF65663E,
-0xFF525425,
-0xFF747846,
-0xFF676E3A,
-0xFF4C5423,
-0xFF3F451F,
-0xFF585E38,
-0xFF7D8554,
-0xFF505922,
-0xFF555F23,
-0xFF717B3E,
-0xFF8D9758,
-0xFF9AA668,
-0xFF323D03,
-0xFF6A723F,
-0xFF807F53,
-0xFFA19F76,
-0xFF575D31,
-0xFF7B8354,
-0xFF9EA675,
-0xFF727848,
-0xFF686E3E,
-0xFF595F31,
-0xFF82895D,
-0xFF9EA778,
-0xFF686E3E,
-0xFF505724,
-0xFF787A48,
-0xFF5B6028,
-0xFF768043,
-0xFF7B8745,
-0xFF5D6A25,
-0xFF939D5E,
-0xFF585D27,
-0xFF777947,
-0xFF5C5D24,
-0xFF64682D,
-0xFF595C25,
-0xFF5A612D,
-0xFF6A7442,
-0xFF6E7C49,
-0xFF485A20,
-0xFF627438,
-0xFF4A5C22,
-0xFF728148,
-0xFF6B793E,
-0xFF6B743B,
-0xFF616630,
-0xFF535523,
-0xFF565F2A,
-0xFF89965E,
-0xFF6E7E40,
-0xFF697B3F,
-0xFF5D6937,
-0xFF5D693B,
-0xFF475227,
-0xFF4B582A,
-0xFF455320,
-0xFF4F5D28,
-0xFF626E3E,
-0xFF4D5526,
-0xFF66673B,
-0xFF6A693B,
-0xFF49492F,
-0xFF424228,
-0xFF2D2F17,
-0xFF30361A,
-0xFF37411E,
-0xFF616D47,
-0xFF7A8662,
-0xFF424C2A,
-0xFF273011,
-0xFF434A29,
-0xFF505833,
-0xFF3C441F,
-0xFF242E0B,
-0xFF2A3411,
-0xFF4A562E,
-0xFF5B6B3C,
-0xFF7B8D59,
-0xFF8A9C68,
-0xFF435525,
-0xFF3A4920,
-0xFF374220,
-0xFF384126,
-0xFF262B17,
-0xFF36382A,
-0xFF1F2114,
-0xFF222417,
-0xFF2F3123,
-0xFF262916,
-0xFF252910,
-0xFF383F20,
-0xFF3A4120,
-0xFF636D4A,
-0xFF88946E,
-0xFF49532E,
-0xFF3E4221,
-0xFF535234,
-0xFF4D4A2B,
-0xFF5D583A,
-0xFF696444,
-0xFF4B4626,
-0xFF494627,
-0xFF939274,
-0xFF4B4932,
-0xFF403B27,
-0xFF2D2814,
-0xFF4F4A34,
-0xFF5B5A3E,
-0xFF5E5F3F,
-0xFF969E79,
-0xFF3A421B,
-0xFF4B4D28,
-0xFF4B4827,
-0xFF484124,
-0xFF585134,
-0xFF403C19,
-0xFF44441E,
-0xFF52592F,
-0xFF455224,
-0xFF526336,
-0xFF243709,
-0xFF627347,
-0xFF4A5932,
-0xFF1D2705,
-0xFF353A1A,
-0xFF676942,
-0xFF71734C,
-0xFF323615,
-0xFF4B512F,
-0xFF6E744E,
-0xFF343910,
-0xFF55582B,
-0xFF606334,
-0xFF696F41,
-0xFF4E5426,
-0xFF6E6D3F,
-0xFF928F62,
-0xFF7D7C4E,
-0xFF828155,
-0xFF67623A,
-0xFF726D45,
-0xFFB6B48D,
-0xFF5F5D36,
-0xFF66643E,
-0xFF5A5832,
-0xFF54512E,
-0xFF625E3B,
-0xFFB4B08D,
-0xFF928C6A,
-0xFF2F2907,
-0xFF5E5B32,
-0xFF545221,
-0xFFB7B584,
-0xFF78754C,
-0xFFA4A07B,
-0xFF75734C,
-0xFF3B3D15,
-0xFF586037,
-0xFF283308,
-0xFF2E3406,
-0xFF949667,
-0xFF605D34,
-0xFF434017,
-0xFF4C4B1F,
-0xFF525329,
-0xFF34350D,
-0xFF222200,
-0xFF5D5A3B,
-0xFF83805F,
-0xFF47431E,
-0xFF46441D,
-0xFFC6C49D,
-0xFF626039,
-0xFF47431E,
-0xFF7F7B56,
-0xFF7A7650,
-0xFF302F03,
-0xFF6A673A,
-0xFF7D7B4A,
-0xFF878554,
-0xFFB4B282,
-0xFFACAB7F,
-0xFF434214,
-0xFF74743E,
-0xFF7A7E41,
-0xFF919653,
-0xFF9EA45C,
-0xFF959853,
-0xFFA3A866,
-0xFFBCC083,
-0xFF596126,
-0xFF7E8B56,
-0xFF9BA974,
-0xFF55642B,
-0xFF84915B,
-0xFF212800,
-0xFF646941,
-0xFF7A8052,
-0xFF323B06,
-0xFF656F3A,
-0xFF99A86F,
-0xFF404F14,
-0xFF7C8C4E,
-0xFF7F8A4E,
-0xFF6E783C,
-0xFF6B733A,
-0xFFA5AA72,
-0xFF595E28,
-0xFF535724,
-0xFF8F9263,
-0xFFB8BE90,
-0xFF434B1A,
-0xFF646C3B,
-0xFFB1B787,
-0xFF42481C,
-0xFF7A7A54,
-0xFF81815B,
-0xFF34350B,
-0xFF7E8152,
-0xFF535C27,
-0xFF757E47,
-0xFF868B55,
-0xFF9A9E6B,
-0xFF4E5722,
-0xFF737A47,
-0xFF5B5C30,
-0xFF666839,
-0xFF6C7137,
-0xFF6A7032,
-0xFF838949,
-0xFF5B6125,
-0xFFB9B985,
-0xFFCACC9B,
-0xFFA8AF79,
-0xFF818A53,
-0xFF848B55,
-0xFF555A24,
-0xFF8A8D54,
-0xFF90965A,
-0xFFD5DB9F,
-0xFF51591D,
-0xFF464F16,
-0xFF838E52,
-0xFF77843E,
-0xFF9FAF64,
-0xFF95A658,
-0xFF54641B,
-0xFF7C874D,
-0xFF87915D,
-0xFFB0B984,
-0xFF464E15,
-0xFF8B9455,
-0xFF959B5B,
-0xFF696F33,
-0xFF70783F,
-0xFF616930,
-0xFF616930,
-0xFF717A41,
-0xFF8F995D,
-0xFF96A165,
-0xFF3C4A0C,
-0xFF879655,
-0xFF73823F,
-0xFF687736,
-0xFF546423,
-0xFF8E9D5C,
-0xFF7B8A47,
-0xFFA1B06F,
-0xFF5C7029,
-0xFF698437,
-0xFF6F893F,
-0xFF697B3D,
-0xFF5D6C31,
-0xFF748040,
-0xFF455014,
-0xFF4C5526,
-0xFF6D7649,
-0xFF9CA56E,
-0xFF7D844E,
-0xFF7C7F52,
-0xFF595B2C,
-0xFF898F53,
-0xFF879051,
-0xFF677238,
-0xFF505924,
-0xFF656738,
-0xFF9B986B,
-0xFF454112,
-0xFFBABA84,
-0xFF62682A,
-0xFF989E5E,
-0xFFAAAF6F,
-0xFF82864B,
-0xFF373B08,
-0xFF5C602E,
-0xFF777745,
-0xFF73733F,
-0xFF868B53,
-0xFF959C66,
-0xFF42481C,
-0xFF63693B,
-0xFF878C52,
-0xFF889150,
-0xFFAEB776,
-0xFF5E6829,
-0xFF636D31,
-0xFF6B7539,
-0xFF646D2A,
-0xFF5C6524,
-0xFF646835,
-0xFF9A9D6E,
-0xFF7D824A,
-0xFF7A7F47,
-0xFF464A18,
-0xFF454B1D,
-0xFF393F13,
-0xFF4B5027,
-0xFF6A6B41,
-0xFF807E55,
-0xFF6B6C40,
-0xFF7F8253,
-0xFF474D1F,
-0xFF42481C,
-0xFF424822,
-0xFF3B4219,
-0xFF6A713E,
-0xFF727A41,
-0xFF787F4B,
-0xFF656C38,
-0xFF5C652E,
-0xFF707B43,
-0xFF5B662E,
-0xFF6A733E,
-0xFF6A693B,
-0xFF9C9B6F,
-0xFF4C4F22,
-0xFF696F43,
-0xFF555A31,
-0xFF74764E,
-0xFF61633B,
-0xFF85885D,
-0xFF737A4E,
-0xFF495225,
-0xFF52582A,
-0xFF212800,
-0xFF4B4D1B,
-0xFF888D55,
-0xFF656D34,
-0xFF6C763A,
-0xFF848C51,
-0xFF6C7139,
-0xFF666839,
-0xFF5D5C2E,
-0xFF898754,
-0xFF676630,
-0xFF767443,
-0xFF6D713F,
-0xFF697142,
-0xFF5E6C39,
-0xFF3F5117,
-0xFF5F7336,
-0xFF4B5D21,
-0xFF596B2D,
-0xFF9CAC6E,
-0xFF5C6A2D,
-0xFF5B602A,
-0xFF4E521F,
-0xFF6A733E,
-0xFF7F8C56,
-0xFF637239,
-0xFF51622B,
-0xFF414D1F,
-0xFF5E693E,
-0xFF626D42,
-0xFF72804F,
-0xFF55642D,
-0xFF53622B,
-0xFF64703E,
-0xFF4E5627,
-0xFF7A7D50,
-0xFFA8A97D,
-0xFF3B3922,
-0xFF37371F,
-0xFF33361B,
-0xFF363D1C,
-0xFF39451D,
-0xFF5F6E43,
-0xFF35441B,
-0xFF232F07,
-0xFF2A3411,
-0xFF323917,
-0xFF636947,
-0xFF353B19,
-0xFF363D1B,
-0xFF2C3613,
-0xFF434F29,
-0xFF4B5A2F,
-0xFF9CAC7B,
-0xFF758350,
-0xFF334014,
-0xFF535D38,
-0xFF121900,
-0xFF40452E,
-0xFF2F3221,
-0xFF2D2E20,
-0xFF29291D,
-0xFF4B4D3F,
-0xFF666757,
-0xFF3A3D28,
-0xFF404429,
-0xFF777E5D,
-0xFF6A724D,
-0xFF6F7954,
-0xFF37431D,
-0xFF424C27,
-0xFF333716,
-0xFF454223,
-0xFF5E5836,
-0xFF615B37,
-0xFF413F19,
-0xFF42421C,
-0xFF4F542B,
-0xFF343813,
-0xFF5B5E3F,
-0xFF77775B,
-0xFF4F4E32,
-0xFF49482C,
-0xFF474627,
-0xFF363715,
-0xFF394017,
-0xFF4C5329,
-0xFF5D6035,
-0xFF75734C,
-0xFF474222,
-0xFF5A5434,
-0xFF6D6A47,
-0xFF5B5D35,
-0xFF515A2F,
-0xFF4C592D,
-0xFF304218,
-0xFF1E3006,
-0xFF3F5026,
-0xFF687750,
-0xFF232D0B,
-0xFF6A6F4F,
-0xFF7C7C56,
-0xFF272800,
-0xFF3A4117,
-0xFF949F74,
-0xFF737A51,
-0xFF676E44,
-0xFF76794C,
-0xFF585E32,
-0xFF80875D,
-0xFF40451C,
-0xFF423F16,
-0xFF646136,
-0xFF898A60,
-0xFF8A8B61,
-0xFF615932,
-0xFF4D451E,
-0xFF282700,
-0xFF97986C,
-0xFF464519,
-0xFF6D6B42,
-0xFF514F28,
-0xFF4F4D27,
-0xFF413D1A,
-0xFF6C6644,
-0xFF615B3B,
-0xFF635E38,
-0xFF84814C,
-0xFF817E47,
-0xFFB2AE81,
-0xFF7A754F,
-0xFF6F6945,
-0xFF43431F,
-0xFF555D34,
-0xFF253005,
-0xFF454B1F,
-0xFF44471A,
-0xFF838556,
-0xFF5D5C2E,
-0xFF4A4B1F,
-0xFF54572C,
-0xFF262801,
-0xFF80805C,
-0xFF4E4B2A,
-0xFF413C1C,
-0xFF403C17,
-0xFF76744D,
-0xFF87885C,
-0xFF5A5B2F,
-0xFF75734A,
-0xFF403E15,
-0xFFB7B68A,
-0xFF636536,
-0xFFA7A678,
-0xFF929161,
-0xFF7D7D4B,
-0xFF696736,
-0xFF8C8B5F,
-0xFF4E4D1D,
-0xFF52561B,
-0xFF797E3C,
-0xFFA1A761,
-0xFF8A904A,
-0xFF676928,
-0xFFACB171,
-0xFF93995B,
-0xFF737D41,
-0xFF929F69,
-0xFF66743F,
-0xFF515E26,
-0xFF5E6834,
-0xFF515530,
-0xFF2B2C0A,
-0xFF8B8D65,
-0xFF7B8151,
-0xFF4B561E,
-0xFF6E7D42,
-0xFF77894B,
-0xFF334606,
-0xFFA5B577,
-0xFF677238,
-0xFF88915C,
-0xFFCFD6A2,
-0xFF7B7E45,
-0xFF9B9E65,
-0xFF909260,
-0xFFE2E9B6,
-0xFF636D39,
-0xFF99A671,
-0xFFB9C391,
-0xFF676E42,
-0xFF4F4F29,
-0xFF1C1A00,
-0xFF797A4E,
-0xFF535725,
-0xFF79824D,
-0xFF656E37,
-0xFF545923,
-0xFF8A8C5A,
-0xFF737A46,
-0xFF7C8350,
-0xFF707145,
-0xFF707241,
-0xFF8A9054,
-0xFF848D4A,
-0xFF737D38,
-0xFF969C5E,
-0xFF717341,
-0xFFA3A576,
-0xFFB3BA87,
-0xFF747B47,
-0xFF868856,
-0xFF767944,
-0xFF63662D,
-0xFFA2A76D,
-0xFF575C22,
-0xFF8A9257,
-0xFF4E571E,
-0xFF3D470A,
-0xFF9BA862,
-0xFF4B590E,
-0xFF697930,
-0xFF566522,
-0xFF69733E,
-0xFF636B3A,
-0xFF515824,
-0xFF7A8249,
-0xFF9FA569,
-0xFF91975B,
-0xFF7A7F47,
-0xFF9BA06A,
-0xFF5B622F,
-0xFF69703C,
-0xFF80854F,
-0xFF788047,
-0xFF808950,
-0xFF757F43,
-0xFF6E7839,
-0xFF545E1F,
-0xFF444F15,
-0xFF58662B,
-0xFF99A769,
-0xFF869552,
-0xFF73823D,
-0xFF71853D,
-0xFF5B7329,
-0xFF889F59,
-0xFF485C21,
-0xFF667740,
-0xFF91A163,
-0xFF3B490E,
-0xFF3C4818,
-0xFF656E41,
-0xFF4A531E,
-0xFF636734,
-0xFFA2A175,
-0xFF7F7C4F,
-0xFF83844A,
-0xFF949A5C,
-0xFFB0B980,
-0xFF545D28,
-0xFF797A4E,
-0xFF888558,
-0xFF6B6835,
-0xFF8C8B52,
-0xFF979C5A,
-0xFF898E4B,
-0xFFAAAA6C,
-0xFF55541B,
-0xFF5B5B29,
-0xFF7F7E4E,
-0xFF9C9964,
-0xFF85824B,
-0xFF989960,
-0xFF6E723F,
-0xFF7D7D57,
-0xFF51522A,
-0xFF7A7D48,
-0xFF82884A,
-0xFFA2A86C,
-0xFF9DA26A,
-0xFF7D814F,
-0xFF7F8351,
-0xFF888D55,
-0xFF676A35,
-0xFF75764A,
-0xFF9F9E72,
-0xFF888856,
-0xFF777745,
-0xFF55562A,
-0xFF6C6D43,
-0xFF474921,
-0xFF64653D,
-0xFF767549,
-0xFF525123,
-0xFF616435,
-0xFF5E6434,
-0xFF52582C,
-0xFF363B12,
-0xFF737955,
-0xFF383F16,
-0xFF444B18,
-0xFF666B35,
-0xFF7A7C4B,
-0xFF6E7144,
-0xFF43491B,
-0xFF565E2D,
-0xFF3C4510,
-0xFF6E7541,
-0xFFACAA7A,
-0xFF817E51,
-0xFF626538,
-0xFF91976B,
-0xFF2C2D0B,
-0xFF444525,
-0xFF81815D,
-0xFF5D5F37,
-0xFF171E00,
-0xFF414A1B,
-0xFF81895A,
-0xFF39400D,
-0xFF525721,
-0xFF90955F,
-0xFF5F6632,
-0xFF404714,
-0xFF6D6F3E,
-0xFF565529,
-0xFF4C4A24,
-0xFF413D18,
-0xFF7C774D,
-0xFF878054,
-0xFF807C4F,
-0xFF77764A,
-0xFF4C5327,
-0xFF4E5A2A,
-0xFF4E5F28,
-0xFF637539,
-0xFF47591B,
-0xFF586B2B,
-0xFF8C9F5F,
-0xFF607031,
-0xFF5E662B,
-0xFF656D34,
-0xFF79814E,
-0xFF586530,
-0xFF5E6C37,
-0xFF465723,
-0xFF424E20,
-0xFF576335,
-0xFF535F2F,
-0xFF46541F,
-0xFF49581F,
-0xFF5A6930,
-0xFF596631,
-0xFF4D5524,
-0xFF5F6235,
-0xFFBBBC90,
-0xFF2F2D18,
-0xFF38381E,
-0xFF2B3010,
-0xFF3A441F,
-0xFF2A3910,
-0xFF415226,
-0xFF2B3C0F,
-0xFF29390C,
-0xFF39441C,
-0xFF363D1B,
-0xFF3D4224,
-0xFF303517,
-0xFF1F2605,
-0xFF343E1B,
-0xFF46512F,
-0xFF4C5832,
-0xFF687146,
-0xFF282F03,
-0xFF4F562D,
-0xFF545A38,
-0xFF3C3F24,
-0xFF464832,
-0xFF2F2E1C,
-0xFF252314,
-0xFF252316,
-0xFF2E2F1F,
-0xFF3E3D2B,
-0xFF4B4D35,
-0xFF5A5D40,
-0xFF575D3B,
-0xFF454B25,
-0xFF4C542D,
-0xFF3F4926,
-0xFF292E0E,
-0xFF4D4C2E,
-0xFF524B2E,
-0xFF716847,
-0xFF7D7753,
-0xFF383812,
-0xFF474E24,
-0xFF636F41,
-0xFF4A572B,
-0xFF3D4422,
-0xFF303515,
-0xFF414425,
-0xFF3E3F1F,
-0xFF626343,
-0xFF3F411C,
-0xFF3D441A,
-0xFF2B3206,
-0xFF5E6134,
-0xFF727349,
-0xFF494623,
-0xFF8D8A67,
-0xFF54542E,
-0xFF686D44,
-0xFF687146,
-0xFF37461D,
-0xFF20300B,
-0xFF344620,
-0xFF2E3E17,
-0xFF2C3B14,
-0xFF141F00,
-0xFF4D5232,
-0xFF484421,
-0xFF5A582F,
-0xFFC8D29D,
-0xFF47591F,
-0xFF667240,
-0xFF4A5324,
-0xFF4F5529,
-0xFF54562E,
-0xFF616540,
-0xFF393B16,
-0xFF44401A,
-0xFF89875E,
-0xFF656C42,
-0xFF73794D,
-0xFF7E754C,
-0xFF403508,
-0xFF7B7B47,
-0xFF92975D,
-0xFF74783D,
-0xFF97985F,
-0xFF9B9E69,
-0xFF707243,
-0xFF433F1A,
-0xFF2C2606,
-0xFF544B2E,
-0xFF524C28,
-0xFF777441,
-0xFF716E37,
-0xFF877F51,
-0xFF9E956C,
-0xFF8E865F,
-0xFF514F26,
-0xFF767E4F,
-0xFF6B7445,
-0xFF636A3E,
-0xFF5E6436,
-0xFF616435,
-0xFF76794A,
-0xFF8D9365,
-0xFF62683C,
-0xFF62643C,
-0xFF818258,
-0xFF4A471E,
-0xFF757249,
-0xFF605D34,
-0xFF56542B,
-0xFF999C6F,
-0xFF4F5223,
-0xFF3A390B,
-0xFFCBCA9C,
-0xFF787A4B,
-0xFF717445,
-0xFF898B5C,
-0xFF737546,
-0xFF50501C,
-0xFF727240,
-0xFF727145,
-0xFF464515,
-0xFF616528,
-0xFFB4BB77,
-0xFFAAB16D,
-0xFF939856,
-0xFF6B6C30,
-0xFFA1A56A,
-0xFF596125,
-0xFF899357,
-0xFF8A955D,
-0xFF414B16,
-0xFF454E19,
-0xFF494F1F,
-0xFF747651,
-0xFF424122,
-0xFF6E6E48,
-0xFF878A5B,
-0xFF39420B,
-0xFF7C874B,
-0xFF7B894B,
-0xFF425213,
-0xFF728043,
-0xFF9CA971,
-0xFF36400E,
-0xFF8A915D,
-0xFFA4A86B,
-0xFF848947,
-0xFFB3B77C,
-0xFFB7BE88,
-0xFF8F9C66,
-0xFFB9C792,
-0xFF97A371,
-0xFF939C6D,
-0xFF33360B,
-0xFF4A491D,
-0xFF5D5D2B,
-0xFF929761,
-0xFF67723A,
-0xFF727D45,
-0xFF1C1F00,
-0xFF777741,
-0xFF979C66,
-0xFF7D814F,
-0xFF7A794D,
-0xFF89885A,
-0xFF474D0F,
-0xFF57611C,
-0xFF7D8643,
-0xFFA3A96D,
-0xFF5F5E30,
-0xFF98966D,
-0xFF565A28,
-0xFFAAAE7B,
-0xFF61612D,
-0xFF75753F,
-0xFFA1A56A,
-0xFF62682C,
-0xFF454A12,
-0xFF505721,
-0xFF767F46,
-0xFF727C3F,
-0xFF8D9A54,
-0xFF748139,
-0xFF55611F,
-0xFF586329,
-0xFF515928,
-0xFF5C6433,
-0xFF727943,
-0xFFA5AD72,
-0xFFA6AB73,
-0xFF5B6026,
-0xFF888E52,
-0xFF9FA46A,
-0xFF626933,
-0xFF696E38,
-0xFF6F723B,
-0xFF898C53,
-0xFF5D652A,
-0xFF7D8549,
-0xFF707636,
-0xFF565C1E,
-0xFF404912,
-0xFF838D58,
-0xFF909B5F,
-0xFF737F41,
-0xFF879653,
-0xFFAEC27D,
-0xFF6D823F,
-0xFF334708,
-0xFF54652E,
-0xFF364711,
-0xFF4F6029,
-0xFF4A5922,
-0xFF4D5B28,
-0xFF778351,
-0xFF4F5622,
-0xFFA0A270,
-0xFFBDB989,
-0xFF76703E,
-0xFF939158,
-0xFF919256,
-0xFFC6CE92,
-0xFF7A8247,
-0xFF9FA16F,
-0xFF767642,
-0xFFA1A06A,
-0xFF78783C,
-0xFF747939,
-0xFF858746,
-0xFF99975A,
-0xFF817F44,
-0xFF81804A,
-0xFF62602D,
-0xFFB8B27E,
-0xFF807B44,
-0xFFBAB885,
-0xFFA2A473,
-0xFF7C7A53,
-0xFF787650,
-0xFF717044,
-0xFF5E5D2D,
-0xFF6F6E3E,
-0xFF838556,
-0xFF58592F,
-0xFF4C4D25,
-0xFF7C7D55,
-0xFF45431A,
-0xFF96946B,
-0xFF6E6B40,
-0xFF848154,
-0xFF6D6A3D,
-0xFF78754A,
-0xFF747148,
-0xFF6E6D41,
-0xFF4A491B,
-0xFF656436,
-0xFF868857,
-0xFF414814,
-0xFF5F6633,
-0xFF4C5226,
-0xFF41461E,
-0xFF5C623C,
-0xFF4A5128,
-0xFF2A3000,
-0xFF686A39,
-0xFF747347,
-0xFF74724B,
-0xFF82825E,
-0xFF494B24,
-0xFF6C6F42,
-0xFF777948,
-0xFFAEAC7B,
-0xFF595726,
-0xFF707243,
-0xFF7C7E56,
-0xFF3B3A1C,
-0xFF48472B,
-0xFF5B5839,
-0xFF51512B,
-0xFF485021,
-0xFF67713F,
-0xFF5E6635,
-0xFF3F4613,
-0xFF737842,
-0xFF5D612E,
-0xFF474D1F,
-0xFF31360D,
-0xFF635F3C,
-0xFF625B3E,
-0xFF888366,
-0xFF383316,
-0xFF544D30,
-0xFF615837,
-0xFF78724E,
-0xFF45431D,
-0xFF4A4F27,
-0xFF5A6338,
-0xFF4B5725,
-0xFF617037,
-0xFF4C5C1D,
-0xFF495918,
-0xFF6B803D,
-0xFF839654,
-0xFF6D7738,
-0xFF838D50,
-0xFF5B6531,
-0xFF54622F,
-0xFF62733F,
-0xFF4A5B27,
-0xFF5C6838,
-0xFF6B7745,
-0xFF65723D,
-0xFF526128,
-0xFF56652A,
-0xFF4C5B22,
-0xFF5F6C37,
-0xFF515B29,
-0xFF676E3B,
-0xFFC6CA97,
-0xFF33311A,
-0xFF57573B,
-0xFF444A26,
-0xFF424D23,
-0xFF425128,
-0xFF495A2E,
-0xFF475929,
-0xFF4E5E31,
-0xFF57623A,
-0xFF535A38,
-0xFF2B2F14,
-0xFF161A00,
-0xFF292E10,
-0xFF585F3E,
-0xFF2A3515,
-0xFF414B29,
-0xFF585E3A,
-0xFF4F532E,
-0xFF60613F,
-0xFF4B4C2D,
-0xFF505036,
-0xFF3D3D25,
-0xFF2B2815,
-0xFF373423,
-0xFF333220,
-0xFF292814,
-0xFF41402B,
-0xFF3E3E26,
-0xFF38381C,
-0xFF414524,
-0xFF2F3310,
-0xFF2A300C,
-0xFF4B5030,
-0xFF3E4124,
-0xFF4E4A31,
-0xFF534C32,
-0xFF544B2C,
-0xFF4D4926,
-0xFF666843,
-0xFF525A31,
-0xFF5A6739,
-0xFF3A471B,
-0xFF525C39,
-0xFF626948,
-0xFF424826,
-0xFF2E3211,
-0xFF525331,
-0xFF646843,
-0xFF6B7047,
-0xFFA4AA7E,
-0xFFC0C394,
-0xFF4D4E22,
-0xFF3E3E18,
-0xFF797955,
-0xFF83855E,
-0xFF383F16,
-0xFF4C572F,
-0xFF46552E,
-0xFF253511,
-0xFF283915,
-0xFF2B3B16,
-0xFF25340D,
-0xFF152100,
-0xFF2C3210,
-0xFF5F5B38,
-0xFF838055,
-0xFFC6D497,
-0xFF879A5A,
-0xFF5D6A35,
-0xFF333B0C,
-0xFF5F6233,
-0xFF4A4B1F,
-0xFF3D3F17,
-0xFF2C2C06,
-0xFF48421E,
-0xFFA39F79,
-0xFF596132,
-0xFF8C9360,
-0xFF908A5A,
-0xFF67602C,
-0xFFC0C38C,
-0xFFA4A971,
-0xFF6C6F36,
-0xFFC4C58C,
-0xFF686B34,
-0xFF454716,
-0xFF514E25,
-0xFF96906E,
-0xFF3A3114,
-0xFF463D1C,
-0xFF7F7B4B,
-0xFF6E6834,
-0xFF958D5E,
-0xFF6C6036,
-0xFF6A6138,
-0xFF504D20,
-0xFF909764,
-0xFF3E4814,
-0xFF3A4211,
-0xFF858B5B,
-0xFF646B38,
-0xFF858D5A,
-0xFFE1E9BA,
-0xFF767C4E,
-0xFF4E5124,
-0xFF727145,
-0xFF716D40,
-0xFF676034,
-0xFF5B562C,
-0xFF59582C,
-0xFF9C9F70,
-0xFF8B8F5D,
-0xFF313302,
-0xFF7C7E4D,
-0xFF6F7341,
-0xFF5A5E2C,
-0xFF696C3D,
-0xFF424614,
-0xFF666934,
-0xFF8D8D5B,
-0xFF838254,
-0xFF7C7B4B,
-0xFF5C6224,
-0xFF8B924E,
-0xFFAEB572,
-0xFF838949,
-0xFF818249,
-0xFF8F925B,
-0xFF585D23,
-0xFF343C01,
-0xFF888F59,
-0xFF3F4310,
-0xFF858957,
-0xFF5E6031,
-0xFF222000,
-0xFF413E1B,
-0xFF3B3C14,
-0xFF787B4C,
-0xFFA0A56B,
-0xFF525A1E,
-0xFF5C6629,
-0xFF616C30,
-0xFF69743A,
-0xFFA5B078,
-0xFF5B6435,
-0xFF343C09,
-0xFF858B4B,
-0xFFCDD28F,
-0xFF6B7030,
-0xFF636B30,
-0xFFBDCA94,
-0xFF74854F,
-0xFF364411,
-0xFFA8B27E,
-0xFF444718,
-0xFF8D8F5D,
-0xFF5F5F2B,
-0xFF6F743C,
-0xFF7C8651,
-0xFF48531B,
-0xFF3D4009,
-0xFF85864D,
-0xFF6D7238,
-0xFF686D37,
-0xFF6C6B3F,
-0xFF767547,
-0xFF50561A,
-0xFF969F5C,
-0xFF767F3E,
-0xFF757A40,
-0xFF737246,
-0xFF706E45,
-0xFF464A18,
-0xFF8A8F57,
-0xFF9A9A64,
-0xFF56571E,
-0xFF757B3F,
-0xFF91995D,
-0xFF3F4610,
-0xFF3B440D,
-0xFF8D965D,
-0xFFA0AC6C,
-0xFF68752F,
-0xFF8F9C56,
-0xFF626D31,
-0xFF89935F,
-0xFF5B6437,
-0xFF565E2F,
-0xFF808950,
-0xFF91995E,
-0xFF616832,
-0xFF7F874E,
-0xFF666E32,
-0xFF878F53,
-0xFFAEB67D,
-0xFF8A8F59,
-0xFF9C9F66,
-0xFF93965D,
-0xFF8B9056,
-0xFFA3A96D,
-0xFF909253,
-0xFF606427,
-0xFF7D844E,
-0xFF4B561E,
-0xFF909960,
-0xFF929E60,
-0xFF9BAA69,
-0xFF97AA68,
-0xFF728545,
-0xFF384B0B,
-0xFF3F4E13,
-0xFF59682F,
-0xFF1A2900,
-0xFF515F2A,
-0xFF65733E,
-0xFF7E8853,
-0xFF868D59,
-0xFF969964,
-0xFFA29F6A,
-0xFFABA66F,
-0xFF97945D,
-0xFFA6A56D,
-0xFF92985C,
-0xFF485014,
-0xFF878C54,
-0xFF53561F,
-0xFF86874D,
-0xFF9E9F63,
-0xFF7A7E41,
-0xFF6A6B2F,
-0xFF817C45,
-0xFFA39C68,
-0xFF7A7744,
-0xFF5B5523,
-0xFF786E3B,
-0xFFA49D69,
-0xFF7B7845,
-0xFF8C8B5D,
-0xFF96946D,
-0xFF7A7653,
-0xFF6D6944,
-0xFF524E28,
-0xFF7F7C51,
-0xFF706F43,
-0xFF686640,
-0xFF545430,
-0xFFB2AF8C,
-0xFF94926C,
-0xFF7C7852,
-0xFF6F6A44,
-0xFFD1CCA4,
-0xFFBDB590,
-0xFF5D5531,
-0xFF908864,
-0xFF8F8A62,
-0xFF504C1F,
-0xFF716E41,
-0xFF5A5929,
-0xFF474E18,
-0xFF565D29,
-0xFF2B3105,
-0xFF4A4E29,
-0xFF6A704A,
-0xFF3D441B,
-0xFF4A4D1E,
-0xFF858756,
-0xFFA19E73,
-0xFF68633D,
-0xFF605D3C,
-0xFF585836,
-0xFF57582E,
-0xFF8A8959,
-0xFF73713E,
-0xFF83834F,
-0xFF545826,
-0xFF54572C,
-0xFF353617,
-0xFF504F33,
-0xFF605D3E,
-0xFF54562F,
-0xFF61693A,
-0xFF8F9965,
-0xFF757D4A,
-0xFF7D8651,
-0xFF7B7F4C,
-0xFF404412,
-0xFF494F23,
-0xFF3D3F1A,
-0xFF403B1E,
-0xFF3B331C,
-0xFF4D472F,
-0xFF3B351D,
-0xFF433B24,
-0xFF3B3418,
-0xFF1E1800,
-0xFF726E4B,
-0xFF656742,
-0xFF5B6239,
-0xFF374011,
-0xFF5B6530,
-0xFF6A7636,
-0xFF5B6A27,
-0xFF556A27,
-0xFF859856,
-0xFF8A9654,
-0xFF95A163,
-0xFF3B4812,
-0xFF485925,
-0xFF647541,
-0xFF404E1B,
-0xFF626E3C,
-0xFF63703B,
-0xFF626F39,
-0xFF45521A,
-0xFF5B6A31,
-0xFF62713A,
-0xFF6B7946,
-0xFF5A6334,
-0xFF515824,
-0xFF959C66,
-0xFF343516,
-0xFF6F7350,
-0xFF717952,
-0xFF5A653B,
-0xFF56653C,
-0xFF57683E,
-0xFF596A3E,
-0xFF4A592E,
-0xFF505C36,
-0xFF676E4D,
-0xFF31371B,
-0xFF31351C,
-0xFF51553A,
-0xFF5A6044,
-0xFF3B4127,
-0xFF31371D,
-0xFF383B1E,
-0xFF444526,
-0xFF57563A,
-0xFF5F5E42,
-0xFF37351C,
-0xFF2A280F,
-0xFF323019,
-0xFF43412A,
-0xFF27250E,
-0xFF323019,
-0xFF3D3B24,
-0xFF3C3A21,
-0xFF28260D,
-0xFF5A5A3E,
-0xFF818263,
-0xFF404122,
-0xFF4C4C32,
-0xFF494931,
-0xFF55503C,
-0xFF524C36,
-0xFF5A5538,
-0xFF494627,
-0xFF373818,
-0xFF363C18,
-0xFF293108,
-0xFF29340C,
-0xFF5F6647,
-0xFF555C3D,
-0xFF484D2D,
-0xFF242A06,
-0xFF1E2200,
-0xFF70754D,
-0xFF999E76,
-0xFF90926A,
-0xFF76794C,
-0xFF66693C,
-0xFF4B4D25,
-0xFF4F542C,
-0xFF2F360D,
-0xFF4A552D,
-0xFF323E1A,
-0xFF293714,
-0xFF182708,
-0xFF152403,
-0xFF32401D,
-0xFF0C1B00,
-0xFF4D5933,
-0xFF3D431D,
-0xFF4A4620,
-0xFFAEAD7D,
-0xFFC7D695,
-0xFF778746,
-0xFF2E3607,
-0xFF282900,
-0xFF6A6835,
-0xFF4A4911,
-0xFF626933,
-0xFF494C1D,
-0xFF4D4520,
-0xFF8D845D,
-0xFF898756,
-0xFF9D9E64,
-0xFFA7A76B,
-0xFF4E4F15,
-0xFF656839,
-0xFF474921,
-0xFF514F29,
-0xFFD4D2AB,
-0xFF717344,
-0xFF707241,
-0xFF959363,
-0xFFB4AF87,
-0xFF3B3215,
-0xFF473E1F,
-0xFF666137,
-0xFF817D4D,
-0xFF9E9366,
-0xFF55491F,
-0xFF6D643B,
-0xFF666336,
-0xFF3C430D,
-0xFF464F18,
-0xFF424B16,
-0xFFBCC590,
-0xFF8B945D,
-0xFFBFCA92,
-0xFFC5CF9B,
-0xFF212900,
-0xFF3B3D0E,
-0xFF827F52,
-0xFFA9A173,
-0xFF82794E,
-0xFF3D360C,
-0xFF4B481D,
-0xFF46491A,
-0xFF979E6B,
-0xFF454716,
-0xFF686A38,
-0xFF646836,
-0xFF868D5A,
-0xFF848B57,
-0xFF2D3100,
-0xFF363904,
-0xFFB4B482,
-0xFF9E9B6E,
-0xFF828151,
-0xFF5E6329,
-0xFF818A4B,
-0xFF838C4B,
-0xFF898F53,
-0xFF555521,
-0xFF4D4D1B,
-0xFF8F925B,
-0xFF7E814A,
-0xFF8D8D5B,
-0xFF535121,
-0xFF8D8A5D,
-0xFF747144,
-0xFF4C4B1F,
-0xFF929165,
-0xFF55562A,
-0xFF676937,
-0xFF7E8247,
-0xFF5F6326,
-0xFF5C5F26,
-0xFF6A6F37,
-0xFF666B33,
-0xFF585F29,
-0xFFA4AC7D,
-0xFF757D4A,
-0xFF7D8345,
-0xFF79803C,
-0xFF686E2E,
-0xFF879155,
-0xFF6C7A45,
-0xFF879864,
-0xFF3E4C17,
-0xFFB5C28C,
-0xFF565D27,
-0xFF7B8048,
-0xFF8E915C,
-0xFF5F6630,
-0xFF4A5722,
-0xFF8D9A64,
-0xFF969B61,
-0xFF6B7133,
-0xFF90995A,
-0xFF6A7237,
-0xFF4E5021,
-0xFF6F7142,
-0xFFC5CA90,
-0xFF848D4E,
-0xFF6F773B,
-0xFF6D723A,
-0xFF626339,
-0xFFC1C298,
-0xFF606731,
-0xFF899155,
-0xFF757B3F,
-0xFF757B3F,
-0xFF767F40,
-0xFF828C4F,
-0xFF707940,
-0xFF616C34,
-0xFF626D31,
-0xFF8E9A5A,
-0xFF94A15B,
-0xFF7C8B46,
-0xFF7C8951,
-0xFF525E2E,
-0xFF667146,
-0xFF394213,
-0xFF515C22,
-0xFF98A266,
-0xFF717A43,
-0xFF79824B,
-0xFF8C965A,
-0xFF8D975A,
-0xFF7A834A,
-0xFF616930,
-0xFFA9A973,
-0xFFAFAF79,
-0xFF757841,
-0xFF61642B,
-0xFF6D6D31,
-0xFF5B5B1F,
-0xFF646C31,
-0xFF848E52,
-0xFF757F42,
-0xFF4F5B1B,
-0xFF697938,
-0xFF7A8D4B,
-0xFF5B6C28,
-0xFF7A8944,
-0xFF889550,
-0xFF85914F,
-0xFF5A652B,
-0xFF4F5A22,
-0xFF4E5921,
-0xFF828D53,
-0xFF495118,
-0xFF91945D,
-0xFF9E9D64,
-0xFF84814A,
-0xFF605C2C,
-0xFF5C5A29,
-0xFF797C45,
-0xFF7E8349,
-0xFF858D54,
-0xFF7D8248,
-0xFF767A3D,
-0xFF8D9252,
-0xFF7C8045,
-0xFF7E7D47,
-0xFFA39A6F,
-0xFF6B5F37,
-0xFFA9A075,
-0xFF776F41,
-0xFF7C703E,
-0xFFB1A573,
-0xFF706A38,
-0xFF959265,
-0xFFA19D77,
-0xFF8C8865,
-0xFF837D5D,
-0xFF6E6844,
-0xFF555026,
-0xFF555225,
-0xFF66643D,
-0xFF413F19,
-0xFF9A9871,
-0xFFBEBC95,
-0xFF7A7555,
-0xFF9E9878,
-0xFF645B3A,
-0xFFA4997B,
-0xFF63573F,
-0xFF372B13,
-0xFF5D5232,
-0xFF6F6541,
-0xFF877F58,
-0xFF575429,
-0xFF686C3A,
-0xFF676E3B,
-0xFF54562E,
-0xFF797B56,
-0xFF5B613D,
-0xFF2C330A,
-0xFF4A4D1E,
-0xFF686836,
-0xFF8E8A5D,
-0xFFCCC7A1,
-0xFF504D2A,
-0xFF585834,
-0xFF706F43,
-0xFF50501E,
-0xFF95955F,
-0xFF61642D,
-0xFF69703C,
-0xFF707648,
-0xFF3A3C17,
-0xFF4E4F2D,
-0xFF383814,
-0xFF585A32,
-0xFF6F7748,
-0xFF7B8755,
-0xFF59632F,
-0xFF7A824F,
-0xFF565A28,
-0xFF606636,
-0xFF52592D,
-0xFF3B3F1A,
-0xFF423C22,
-0xFF342C15,
-0xFF343017,
-0xFF3C381F,
-0xFF2B250F,
-0xFF3F381E,
-0xFF1D1700,
-0xFF95916C,
-0xFF6F6F49,
-0xFF7F845C,
-0xFF555A31,
-0xFF434B18,
-0xFF6E7839,
-0xFF9DAA65,
-0xFF586B29,
-0xFF768B4A,
-0xFF8E9D5A,
-0xFF8C9A5C,
-0xFF5B6A33,
-0xFF42531F,
-0xFF657640,
-0xFF596732,
-0xFF687540,
-0xFF5A6430,
-0xFF545E2A,
-0xFF5E6B36,
-0xFF616F3A,
-0xFF4E5C29,
-0xFF3D4A1C,
-0xFF3E4A1C,
-0xFF505825,
-0xFF7A834E,
-0xFF565D34,
-0xFF777F56,
-0xFF7E865D,
-0xFF525D33,
-0xFF3A461E,
-0xFF4B5A33,
-0xFF404F28,
-0xFF22310A,
-0xFF46522E,
-0xFF444D2E,
-0xFF353E21,
-0xFF393F25,
-0xFF454930,
-0xFF3E422B,
-0xFF262914,
-0xFF30331E,
-0xFF3D3C27,
-0xFF404028,
-0xFF2B2912,
-0xFF3A3A20,
-0xFF2A2A10,
-0xFF2D2D11,
-0xFF353519,
-0xFF36361A,
-0xFF49492D,
-0xFF47472B,
-0xFF424226,
-0xFF434128,
-0xFF35331A,
-0xFF38361F,
-0xFF323019,
-0xFF2D2B14,
-0xFF2F2F15,
-0xFF51533B,
-0xFF403F2B,
-0xFF2E2D18,
-0xFF37361A,
-0xFF333214,
-0xFF212105,
-0xFF292A0B,
-0xFF4C4E29,
-0xFF414522,
-0xFF626548,
-0xFF5A5F41,
-0xFF636947,
-0xFF444A24,
-0xFF31360D,
-0xFF2E330A,
-0xFF4C4E27,
-0xFF51532C,
-0xFF63653D,
-0xFF7F8559,
-0xFF686E42,
-0xFF353C12,
-0xFF1F2A02,
-0xFF2D3915,
-0xFF283615,
-0xFF455234,
-0xFF313E22,
-0xFF142103,
-0xFF142201,
-0xFF2C3814,
-0xFF8F9B73,
-0xFF252C03,
-0xFF393711,
-0xFF9B9A6E,
-0xFFADB87E,
-0xFF37450A,
-0xFF272901,
-0xFF423E19,
-0xFF726A39,
-0xFF9A955E,
-0xFF747845,
-0xFF606233,
-0xFF473D19,
-0xFF8E805B,
-0xFF888051,
-0xFF6D6A33,
-0xFF6B6C32,
-0xFF696C35,
-0xFF505328,
-0xFF525331,
-0xFF4B4829,
-0xFF8F8A6A,
-0xFF505129,
-0xFF47481C,
-0xFF8F8C5F,
-0xFF625D35,
-0xFF4B4223,
-0xFF6C6646,
-0xFF5E5B30,
-0xFF666232,
-0xFF7D7245,
-0xFF493D13,
-0xFF736B44,
-0xFF777447,
-0xFF676B38,
-0xFF464F16,
-0xFF808954,
-0xFF9EA772,
-0xFF566129,
-0xFF444E19,
-0xFF343E0A,
-0xFF212900,
-0xFF606233,
-0xFF787447,
-0xFF978B61,
-0xFF76693F,
-0xFF544B22,
-0xFF6A673C,
-0xFF7F8253,
-0xFF808754,
-0xFF737544,
-0xFF848654,
-0xFF686C3A,
-0xFF7E8551,
-0xFF8A915B,
-0xFFB4B981,
-0xFF494C17,
-0xFF9B9B69,
-0xFF888558,
-0xFF979666,
-0xFF6B703A,
-0xFF9FA76C,
-0xFF5E662A,
-0xFF8C9157,
-0xFF9F9E6E,
-0xFF716F3F,
-0xFF81814D,
-0xFF7A7A44,
-0xFF7F7D4D,
-0xFF9B976A,
-0xFF605C2F,
-0xFF666336,
-0xFFAAAC7B,
-0xFF828653,
-0xFF9CA06D,
-0xFF757A42,
-0xFF7F8444,
-0xFF848949,
-0xFF61612B,
-0xFF787846,
-0xFF636631,
-0xFF454A14,
-0xFF616938,
-0xFF868E5B,
-0xFF687034,
-0xFF6A7334,
-0xFF454D11,
-0xFF6F7A40,
-0xFF73814E,
-0xFF84925F,
-0xFF596831,
-0xFFA7B47C,
-0xFF495116,
-0xFF6E763D,
-0xFF545B27,
-0xFFA5AD7A,
-0xFF8D9967,
-0xFF596631,
-0xFFA8B178,
-0xFF707A3D,
-0xFF7C8846,
-0xFF939D60,
-0xFF606431,
-0xFF5E602F,
-0xFFA2AA6F,
-0xFF3E4708,
-0xFF8A9256,
-0xFF656D34,
-0xFF6B6E41,
-0xFF636637,
-0xFF778246,
-0xFF829150,
-0xFF858F52,
-0xFF667033,
-0xFF616D2F,
-0xFF677537,
-0xFF475216,
-0xFF788649,
-0xFF6D793B,
-0xFF808F4E,
-0xFF697833,
-0xFFC3D291,
-0xFF84915B,
-0xFF495525,
-0xFF586338,
-0xFF222E00,
-0xFF8B995E,
-0xFF889659,
-0xFF58632B,
-0xFF8A945F,
-0xFF9BA66E,
-0xFF384309,
-0xFF6A7539,
-0xFFC5CD92,
-0xFF82834A,
-0xFFB8B980,
-0xFF83864D,
-0xFF676A31,
-0xFF86834E,
-0xFF64632D,
-0xFF41460C,
-0xFF394307,
-0xFF9DA76A,
-0xFF727E3E,
-0xFF354504,
-0xFF6C803B,
-0xFF4F5E1B,
-0xFF5C6826,
-0xFFA0AB67,
-0xFF6A7332,
-0xFF485015,
-0xFF4B531A,
-0xFF808952,
-0xFF414A13,
-0xFF677037,
-0xFF7F844A,
-0xFF67682F,
-0xFF93925C,
-0xFF878353,
-0xFF7A7847,
-0xFF999965,
-0xFF40450D,
-0xFF5D662D,
-0xFF596327,
-0xFF73793B,
-0xFF808449,
-0xFFABAD7B,
-0xFF59562B,
-0xFF534828,
-0xFF605134,
-0xFF807350,
-0xFF655931,
-0xFF998B5E,
-0xFF6A5C2D,
-0xFF857D4F,
-0xFF4F4A20,
-0xFF5E5A34,
-0xFF4E4826,
-0xFF82795A,
-0xFF6C6342,
-0xFF716C44,
-0xFF504D24,
-0xFF696540,
-0xFF484620,
-0xFFA09E77,
-0xFF93916A,
-0xFF858060,
-0xFF463F22,
-0xFF564D2E,
-0xFF9D9276,
-0xFF685944,
-0xFF6E5F4A,
-0xFF54452E,
-0xFF6E6043,
-0xFF453818,
-0xFF5E5430,
-0xFF706E45,
-0xFF828359,
-0xFF63603D,
-0xFF5D5D3B,
-0xFF686C4B,
-0xFF5E633B,
-0xFF484D17,
-0xFFA6A670,
-0xFF575024,
-0xFFCBC6A0,
-0xFF4F4F29,
-0xFF53552D,
-0xFF7B7D4C,
-0xFF71743D,
-0xFF757841,
-0xFF7D824C,
-0xFF4C5520,
-0xFF78804F,
-0xFF52582A,
-0xFF4A4D22,
-0xFF44461E,
-0xFF656B3F,
-0xFF515A2B,
-0xFF828E5E,
-0xFF4E5A28,
-0xFF434D1B,
-0xFF717749,
-0xFF5E6436,
-0xFF4C5526,
-0xFF4B5027,
-0xFF393416,
-0xFF4A4327,
-0xFF141300,
-0xFF474628,
-0xFF444027,
-0xFF251F05,
-0xFF908C69,
-0xFF827E58,
-0xFF4F5028,
-0xFF5E6038,
-0xFF595B33,
-0xFF474A1B,
-0xFF777D3F,
-0xFF7F8A46,
-0xFF627535,
-0xFF637738,
-0xFF859556,
-0xFF748245,
-0xFF73844D,
-0xFF3E511A,
-0xFF475821,
-0xFF495821,
-0xFF5C6836,
-0xFF384112,
-0xFF596235,
-0xFF515A2D,
-0xFF414D1F,
-0xFF566335,
-0xFF4C592E,
-0xFF3F4A1F,
-0xFF535C2D,
-0xFF565E2B,
-0xFF5B6737,
-0xFF576335,
-0xFF5D683E,
-0xFF354018,
-0xFF343E19,
-0xFF56623E,
-0xFF2B3614,
-0xFF32401F,
-0xFF5E694B,
-0xFF2F3A1C,
-0xFF444F2F,
-0xFF384124,
-0xFF2D321C,
-0xFF262916,
-0xFF1F200E,
-0xFF2A2B19,
-0xFF2A2B19,
-0xFF2D2F1A,
-0xFF3B3A25,
-0xFF5F6149,
-0xFF323518,
-0xFF2E3112,
-0xFF363A19,
-0xFF696D4A,
-0xFF626643,
-0xFF232706,
-0xFF343718,
-0xFF4C4C30,
-0xFF26260E,
-0xFF3C3B27,
-0xFF3B3827,
-0xFF272612,
-0xFF272A0F,
-0xFF252C0D,
-0xFF384126,
-0xFF353B21,
-0xFF3F4426,
-0xFF313415,
-0xFF2E2A0F,
-0xFF413C1F,
-0xFF7A7452,
-0xFF7A7555,
-0xFF3D391E,
-0xFF6E6F50,
-0xFFB1B590,
-0xFF6C7246,
-0xFF454B1B,
-0xFF474A1D,
-0xFF3F4018,
-0xFF464622,
-0xFF4B4D28,
-0xFF555A32,
-0xFF5B6437,
-0xFF3D491B,
-0xFF3B4721,
-0xFF394726,
-0xFF4C593D,
-0xFF58654B,
-0xFF283519,
-0xFF131D02,
-0xFF3F4A2C,
-0xFF687450,
-0xFF727F54,
-0xFF283106,
-0xFF575733,
-0xFF666342,
-0xFF474C24,
-0xFF495027,
-0xFF424323,
-0xFF5F5A3A,
-0xFF60542E,
-0xFF4C401A,
-0xFF6C6644,
-0xFF443E1E,
-0xFF5B4E2B,
-0xFF887A55,
-0xFF777046,
-0xFF312E03,
-0xFF9A996D,
-0xFF94956B,
-0xFF6E7049,
-0xFF50502C,
-0xFF5E5A37,
-0xFF706C49,
-0xFF494925,
-0xFF31310B,
-0xFF8D8964,
-0xFF625C38,
-0xFF5D5435,
-0xFF4D4822,
-0xFF545221,
-0xFF696734,
-0xFF51481D,
-0xFF534A23,
-0xFF706B43,
-0xFF7F7E52,
-0xFF545625,
-0xFF49501C,
-0xFF929A69,
-0xFF525C2A,
-0xFFA9B583,
-0xFFABB787,
-0xFF364214,
-0xFF686F43,
-0xFF525027,
-0xFFA7A076,
-0xFF94865F,
-0xFFAC9D76,
-0xFF685C34,
-0xFF767147,
-0xFF949A6C,
-0xFF404819,
-0xFF737544,
-0xFF7C7E4D,
-0xFF1B2200,
-0xFF68713C,
-0xFF7E884C,
-0xFF8B9357,
-0xFF70703C,
-0xFF72703F,
-0xFF2D2B00,
-0xFF9B9A6A,
-0xFF808251,
-0xFF666A37,
-0xFF767B43,
-0xFF61642D,
-0xFF575427,
-0xFFB4B184,
-0xFF5D602B,
-0xFF5F622D,
-0xFF7F7C4F,
-0xFF89845A,
-0xFF656237,
-0xFFC3C594,
-0xFFB9C289,
-0xFF728042,
-0xFF324002,
-0xFF6E7A3A,
-0xFF87904D,
-0xFF878D4D,
-0xFF4E511C,
-0xFF5E5D2D,
-0xFF6E703E,
-0xFF737842,
-0xFF4F5724,
-0xFF8C9461,
-0xFF79824B,
-0xFF5D682E,
-0xFF424D15,
-0xFF43501A,
-0xFF6E7A4A,
-0xFF546030,
-0xFF445119,
-0xFF828D51,
-0xFF8F995C,
-0xFF404910,
-0xFF4B5324,
-0xFF97A075,
-0xFF788456,
-0xFF4B5725,
-0xFF5D6A35,
-0xFF8F9E63,
-0xFF7E8F4B,
-0xFF83924F,
-0xFF879057,
-0xFF6C743B,
-0xFF7B8445,
-0xFF6F7A36,
-0xFF899452,
-0xFF555F23,
-0xFF606733,
-0xFF858E59,
-0xFF859556,
-0xFF677A38,
-0xFF6D7F43,
-0xFF839259,
-0xFF748348,
-0xFF39490B,
-0xFF758443,
-0xFF647433,
-0xFF6E7D3C,
-0xFF7F8F4E,
-0xFF627231,
-0xFF869658,
-0xFF34430C,
-0xFF94A271,
-0xFF738054,
-0xFF5B6938,
-0xFF6D7C43,
-0xFF3D4C11,
-0xFF47541C,
-0xFF424F19,
-0xFF45511F,
-0xFF4C5924,
-0xFF6C7A3D,
-0xFFA4AE6F,
-0xFF939458,
-0xFFA3A367,
-0xFF94955B,
-0xFF6D6D37,
-0xFF979062,
-0xFF726E41,
-0xFF4C501D,
-0xFF969F68,
-0xFF858E55,
-0xFF727E40,
-0xFF60742F,
-0xFF667A35,
-0xFF596827,
-0xFF8C965A,
-0xFFA1A572,
-0xFF6E703E,
-0xFF3E410A,
-0xFFDADFA7,
-0xFF656C39,
-0xFF434B18,
-0xFF6F783F,
-0xFF525A1F,
-0xFF878957,
-0xFF8B8B59,
-0xFF797840,
-0xFF827F48,
-0xFF74723F,
-0xFF434611,
-0xFF838E52,
-0xFF8E995D,
-0xFF687035,
-0xFF515522,
-0xFF35370F,
-0xFF6B6849,
-0xFF4C3D28,
-0xFF56462F,
-0xFF6A5B3E,
-0xFFA29471,
-0xFF85734D,
-0xFF6A5B34,
-0xFF8A815A,
-0xFF565129,
-0xFF646138,
-0xFF4E4923,
-0xFF615734,
-0xFF584D2D,
-0xFF534A2B,
-0xFF645F3F,
-0xFF6A6545,
-0xFF524F2C,
-0xFFB5B38D,
-0xFF5F5D37,
-0xFF54502D,
-0xFF756F4D,
-0xFF483F1E,
-0xFF74694B,
-0xFF45371D,
-0xFF3E2E17,
-0xFF5D4C3C,
-0xFF5A4935,
-0xFF7A664D,
-0xFF4C3B1D,
-0xFF60573A,
-0xFF645F42,
-0xFF3E371B,
-0xFF575235,
-0xFF555436,
-0xFF3F4119,
-0xFF585C1F,
-0xFFBCBE7F,
-0xFF3A3609,
-0xFFB6B28D,
-0xFF3A3C15,
-0xFF5F6736,
-0xFF8D9559,
-0xFF687130,
-0xFF50581F,
-0xFF7C834F,
-0xFF6C7642,
-0xFF5B6530,
-0xFF4F5620,
-0xFF4D541E,
-0xFF606734,
-0xFF555D2E,
-0xFF556133,
-0xFF667347,
-0xFF293608,
-0xFF475325,
-0xFF666D43,
-0xFF4C5327,
-0xFF5A6432,
-0xFF6C7443,
-0xFF424019,
-0xFF64603B,
-0xFF363810,
-0xFF2B3008,
-0xFF474828,
-0xFF585738,
-0xFF848158,
-0xFF605D32,
-0xFF505125,
-0xFF53542A,
-0xFF64653D,
-0xFF3F4112,
-0xFF83874A,
-0xFF626B28,
-0xFF506022,
-0xFF4F6328,
-0xFF7B8A51,
-0xFF4F5E27,
-0xFF84975F,
-0xFF566B32,
-0xFF4E6225,
-0xFF516329,
-0xFF3B4717,
-0xFF3F471E,
-0xFF595F3B,
-0xFF222A05,
-0xFF2C370F,
-0xFF5E6B40,
-0xFF424E28,
-0xFF465129,
-0xFF485126,
-0xFF495225,
-0xFF404E19,
-0xFF3A4817,
-0xFF4C572D,
-0xFF515B36,
-0xFF46502B,
-0xFF47512E,
-0xFF2E391B,
-0xFF3F492E,
-0xFF374428,
-0xFF435032,
-0xFF475232,
-0xFF3B4427,
-0xFF2F341E,
-0xFF232615,
-0xFF282617,
-0xFF373526,
-0xFF242515,
-0xFF323321,
-0xFF484A35,
-0xFF51533B,
-0xFF454A2C,
-0xFF292F0D,
-0xFF555B37,
-0xFF444A24,
-0xFF656B45,
-0xFF777D59,
-0xFF565A39,
-0xFF484B2E,
-0xFF2C2B16,
-0xFF262513,
-0xFF2C291A,
-0xFF383725,
-0xFF575C3E,
-0xFF313B19,
-0xFF5A6449,
-0xFF4F593E,
-0xFF636C4D,
-0xFF36391A,
-0xFF47432A,
-0xFF585135,
-0xFF5F5436,
-0xFF3B3211,
-0xFF373117,
-0xFF3C3B1D,
-0xFFADAF88,
-0xFFC2C89A,
-0xFF9DA471,
-0xFF6F7243,
-0xFF505129,
-0xFF282804,
-0xFF4B4C2A,
-0xFF61683F,
-0xFF4C5528,
-0xFF616E40,
-0xFF6D7953,
-0xFF283615,
-0xFF2D3921,
-0xFF2A361E,
-0xFF1E280F,
-0xFF293318,
-0xFF2F3A1C,
-0xFF242F0D,
-0xFF3F4C20,
-0xFF596237,
-0xFF363614,
-0xFF605C3F,
-0xFF393A1B,
-0xFF3A3D1E,
-0xFF414024,
-0xFF7D785A,
-0xFF7A6B4C,
-0xFF928163,
-0xFF7F735B,
-0xFF483C22,
-0xFF615231,
-0xFF675932,
-0xFF726A45,
-0xFF918D68,
-0xFF55522F,
-0xFFA8A884,
-0xFF757752,
-0xFF43431D,
-0xFF4D4723,
-0xFF66603C,
-0xFF4F4F2D,
-0xFF636341,
-0xFF595434,
-0xFF655F3F,
-0xFF5D5433,
-0xFF555028,
-0xFF83814E,
-0xFF6A6933,
-0xFF5D542B,
-0xFF665C38,
-0xFF5E5931,
-0xFFA3A276,
-0xFF6B6D3E,
-0xFF7C8350,
-0xFFA2A87A,
-0xFF576031,
-0xFFAAB688,
-0xFF5E6B3D,
-0xFF667146,
-0xFF363D13,
-0xFF4C4A21,
-0xFF9E966F,
-0xFF80714A,
-0xFFBDAE87,
-0xFF796D45,
-0xFF969167,
-0xFF595F33,
-0xFF343C0D,
-0xFF666839,
-0xFF555726,
-0xFF5B622F,
-0xFF757E47,
-0xFF6A7437,
-0xFF98A162,
-0xFF6D6D39,
-0xFF434110,
-0xFF2B2900,
-0xFF7A7949,
-0xFF55562A,
-0xFF4F5321,
-0xFF555A24,
-0xFF838651,
-0xFF302D00,
-0xFF636033,
-0xFF313301,
-0xFF787B46,
-0xFF7D7A4D,
-0xFF625F34,
-0xFF514E23,
-0xFFBDC18F,
-0xFFB8C486,
-0xFF455612,
-0xFF657836,
-0xFFA9BA76,
-0xFFBEC984,
-0xFF979D5D,
-0xFFA1A371,
-0xFF6D6F40,
-0xFF808250,
-0xFF9AA16B,
-0xFF777E4B,
-0xFF575F2C,
-0xFF919B66,
-0xFF8D9762,
-0xFF76834D,
-0xFF64713C,
-0xFF7D895B,
-0xFF849060,
-0xFF6A753D,
-0xFF889456,
-0xFF899356,
-0xFF414A11,
-0xFF616A3D,
-0xFFA1A980,
-0xFF5D683D,
-0xFF303E0D,
-0xFF687643,
-0xFFA5B77D,
-0xFFA2B772,
-0xFF6B7F3A,
-0xFF869054,
-0xFF474F14,
-0xFF45500E,
-0xFF919C57,
-0xFF8B9654,
-0xFF6B7538,
-0xFF707942,
-0xFF5D6A32,
-0xFF6D803E,
-0xFF607733,
-0xFF64783D,
-0xFF384B13,
-0xFF54632A,
-0xFF768648,
-0xFF81924E,
-0xFF82934D,
-0xFF7D8D4C,
-0xFF6D7D3C,
-0xFF556526,
-0xFF49591B,
-0xFF75834E,
-0xFFBBC998,
-0xFF839062,
-0xFF5D6B3A,
-0xFF606F38,
-0xFF4B5A1F,
-0xFF4D5C23,
-0xFF52612A,
-0xFF616E40,
-0xFF485623,
-0xFF7D8B4E,
-0xFF98A361,
-0xFFA7A96A,
-0xFF9D9D5F,
-0xFF818246,
-0xFF9C9C66,
-0xFF989167,
-0xFF514C24,
-0xFF7B7E4F,
-0xFFA8B17A,
-0xFF909962,
-0xFF646F33,
-0xFF80944F,
-0xFF596D28,
-0xFF667436,
-0xFF3D460F,
-0xFF75764A,
-0xFFA09F73,
-0xFF74743E,
-0xFF72753E,
-0xFFA1A477,
-0xFF939969,
-0xFF929B62,
-0xFF6A7237,
-0xFF767A48,
-0xFF646432,
-0xFFAEAD74,
-0xFF8A884D,
-0xFF706E3B,
-0xFF6D6F3D,
-0xFF909B5F,
-0xFF475518,
-0xFF656E35,
-0xFF4F5525,
-0xFF575836,
-0xFF646047,
-0xFF796959,
-0xFF53402F,
-0xFF3D2D13,
-0xFF594928,
-0xFF63502F,
-0xFF645430,
-0xFF7B6E4C,
-0xFF847F59,
-0xFF5C572F,
-0xFF625D35,
-0xFF746A46,
-0xFF635838,
-0xFF8D8368,
-0xFF656043,
-0xFF797456,
-0xFFA3A07D,
-0xFF64613E,
-0xFF95936D,
-0xFF9B9772,
-0xFFA59F7B,
-0xFF312807,
-0xFFA79C7C,
-0xFF6D5D43,
-0xFF4C3C25,
-0xFF5A483A,
-0xFF3E2B1C,
-0xFF533D26,
-0xFF5B472C,
-0xFF40341E,
-0xFF5D553E,
-0xFF564B35,
-0xFF5C553B,
-0xFF59583A,
-0xFF484B20,
-0xFF909553,
-0xFF888A48,
-0xFF504C1F,
-0xFF817D58,
-0xFF676C44,
-0xFF58622E,
-0xFF515C1A,
-0xFF838E49,
-0xFF666E35,
-0xFF707944,
-0xFF7B8551,
-0xFF535E26,
-0xFF505A1E,
-0xFF4D5519,
-0xFF616834,
-0xFF454D1C,
-0xFF576438,
-0xFF304013,
-0xFF2D3A0E,
-0xFF5C683A,
-0xFF535B32,
-0xFF485124,
-0xFF626C38,
-0xFF848D58,
-0xFF68663D,
-0xFF6D6B42,
-0xFF666C3E,
-0xFF3E4519,
-0xFF464A27,
-0xFF464624,
-0xFF656438,
-0xFF5E5D2D,
-0xFF414014,
-0xFF76774D,
-0xFF504E27,
-0xFF79784A,
-0xFF909155,
-0xFF787F3C,
-0xFF5C6B30,
-0xFF44571F,
-0xFF707E49,
-0xFF5C6D37,
-0xFF4D6028,
-0xFF63783D,
-0xFF4A5E21,
-0xFF4A5C22,
-0xFF283406,
-0xFF616942,
-0xFF555A3A,
-0xFF323918,
-0xFF39431E,
-0xFF455129,
-0xFF495531,
-0xFF36421C,
-0xFF3A421B,
-0xFF4F572E};
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* __IMAGE_320x240_ARGB8888_H */
-
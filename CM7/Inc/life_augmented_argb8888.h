@@ -1,76840 +0,0 @@
-/**
-  ******************************************************************************
-  * @file    LCD_DSI/LCD_DSI_VideoMode_SingleBuffer/CM7/Inc/life_augmented_argb8888.h
-  * @author  MCD Application Team
-  * @brief   This file contains ARGB8888 image 320x240.
-  ******************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2019 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  ******************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __LIFE_AUGMENTED_ARGB8888_H
-#define __LIFE_AUGMENTED_ARGB8888_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Includes ------------------------------------------------------------------*/
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-
-const uint32_t life_augmented_argb8888[76800] =
-{
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFBFFFD,
-0xFFFBFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFF9FFFD,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFBFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFF9FFFD,
-0xFFFBFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFF9FFFD,
-0xFFF9FFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFB,
-0xFFFBFFFB,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFCFFFA,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFBFFFC,
-0xFFFCFFFD,
-0xFFFAFCFB,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFAFEFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFEFEFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFEFC,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFF9FBF8,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFCFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFBFFFC,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFBFDFA,
-0xFFFFFFFD,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFAFBFD,
-0xFFFDFEFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFFEFEFC,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFCFEFD,
-0xFFFCFFFD,
-0xFFFBFDFA,
-0xFFFBFDF8,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFFEFDF9,
-0xFFFFFDFA,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFDFCFA,
-0xFFFFFEFC,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFEFFF9,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFDFFFC,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFDFFFC,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFAFFFF,
-0xFFF9FEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFBFDF8,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFC,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFBFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FFFD,
-0xFFF7FFFD,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF2FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF1FFFF,
-0xFFEDFFFF,
-0xFFF2FFFF,
-0xFFF7FFFF,
-0xFFF8FDFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFAFCF7,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFBFA,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFF7FAFF,
-0xFFFBFFFF,
-0xFFF6FFFF,
-0xFFF1FFFF,
-0xFFF0FFFF,
-0xFFEDFFFF,
-0xFFD6EDFB,
-0xFFBAD4E3,
-0xFFA5C2D2,
-0xFF92B3C4,
-0xFF7FA4B6,
-0xFF769CAF,
-0xFF739CAE,
-0xFF709BAC,
-0xFF709BAC,
-0xFF719CAD,
-0xFF6F9DAC,
-0xFF6F9DAD,
-0xFF6F9DAD,
-0xFF719AAE,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF7399B0,
-0xFF749AB1,
-0xFF759BB2,
-0xFF759BB2,
-0xFF759BB2,
-0xFF759BB2,
-0xFF749AB1,
-0xFF749AB1,
-0xFF749AB1,
-0xFF749AB1,
-0xFF759BB2,
-0xFF759BB2,
-0xFF759BB2,
-0xFF759BB2,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB3,
-0xFF769CB1,
-0xFF769CB1,
-0xFF769CB1,
-0xFF769CB1,
-0xFF769CB1,
-0xFF769CB1,
-0xFF769CB1,
-0xFF769CB1,
-0xFF799FB4,
-0xFF799FB4,
-0xFF799FB4,
-0xFF799FB4,
-0xFF799FB4,
-0xFF799FB4,
-0xFF799FB4,
-0xFF769FB3,
-0xFF769FB5,
-0xFF76A0B6,
-0xFF76A0B6,
-0xFF77A1B7,
-0xFF77A1B7,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF78A2B8,
-0xFF7AA3B9,
-0xFF79A3B9,
-0xFF7AA3B9,
-0xFF79A3B9,
-0xFF7BA4BA,
-0xFF7AA4BA,
-0xFF7AA3B9,
-0xFF79A3B9,
-0xFF7AA3B9,
-0xFF79A3B9,
-0xFF7AA3B9,
-0xFF7AA4BA,
-0xFF7BA4BA,
-0xFF7AA4BA,
-0xFF7BA4BA,
-0xFF7AA5B8,
-0xFF7BA4BA,
-0xFF7AA5B8,
-0xFF7BA4BA,
-0xFF7AA5B8,
-0xFF7BA4BA,
-0xFF7AA5B8,
-0xFF7CA5BB,
-0xFF7BA6B9,
-0xFF7CA5BB,
-0xFF7BA6B9,
-0xFF7CA5BB,
-0xFF7BA6B9,
-0xFF7CA5BB,
-0xFF7BA5BB,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7CA6BC,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7DA7BD,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7DA8BB,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7EA9BC,
-0xFF7FAABD,
-0xFF7FAABD,
-0xFF7FAABD,
-0xFF80ABBE,
-0xFF80A9BF,
-0xFF80A9BF,
-0xFF80A9BF,
-0xFF80A9BF,
-0xFF80A9BF,
-0xFF81AAC0,
-0xFF81AAC0,
-0xFF81AAC0,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF83ACC2,
-0xFF85ABC2,
-0xFF85ABC2,
-0xFF85ABC2,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF86ACC3,
-0xFF87ADC4,
-0xFF87ADC4,
-0xFF85AEC4,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF84ADC1,
-0xFF85AEC2,
-0xFF85AEC2,
-0xFF85AEC2,
-0xFF85AEC2,
-0xFF85AEC2,
-0xFF85AEC2,
-0xFF85AEC2,
-0xFF84ADC1,
-0xFF85AEC4,
-0xFF88AEC1,
-0xFF88A9B8,
-0xFFBFD7E1,
-0xFFF3FEFF,
-0xFFFBFFFF,
-0xFFFAFCF9,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFCF7FB,
-0xFFFFFCFF,
-0xFFFEFEFF,
-0xFFF7FFFF,
-0xFFF1FFFF,
-0xFFF1FFFF,
-0xFFD8EFFD,
-0xFFA3BFD4,
-0xFF7999B0,
-0xFF5B7E94,
-0xFF5B8198,
-0xFF5D859F,
-0xFF56829D,
-0xFF5685A1,
-0xFF5B8EAB,
-0xFF588EAA,
-0xFF558EAB,
-0xFF558EAC,
-0xFF528EAA,
-0xFF538FAB,
-0xFF528FAB,
-0xFF528FAB,
-0xFF528FAB,
-0xFF5790AE,
-0xFF578FB0,
-0xFF588EB0,
-0xFF578FB0,
-0xFF588EB0,
-0xFF578FB0,
-0xFF578DAF,
-0xFF568EAF,
-0xFF588EB0,
-0xFF578FB0,
-0xFF588EB0,
-0xFF5890B1,
-0xFF5A90B2,
-0xFF5991B2,
-0xFF5A90B2,
-0xFF5991B2,
-0xFF5991B2,
-0xFF5991B2,
-0xFF5991B2,
-0xFF5991B2,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5A92B3,
-0xFF5B93B4,
-0xFF5B93B4,
-0xFF5B93B4,
-0xFF5B93B4,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5C95B3,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5B94B2,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5C95B3,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5D96B4,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5E97B5,
-0xFF5F98B6,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF5F98B5,
-0xFF6099B6,
-0xFF6099B6,
-0xFF6099B6,
-0xFF6099B6,
-0xFF619AB7,
-0xFF619AB7,
-0xFF619AB7,
-0xFF619AB7,
-0xFF629BB9,
-0xFF629BB9,
-0xFF629BB9,
-0xFF629BB9,
-0xFF629BB9,
-0xFF639CBA,
-0xFF639CBA,
-0xFF639CBA,
-0xFF639CBA,
-0xFF639CBA,
-0xFF639CBA,
-0xFF649DBB,
-0xFF649DBB,
-0xFF649DBB,
-0xFF659EBC,
-0xFF659EBC,
-0xFF639EBC,
-0xFF639EBC,
-0xFF639EBC,
-0xFF639EBC,
-0xFF639EBC,
-0xFF649FBD,
-0xFF649FBD,
-0xFF649FBD,
-0xFF65A0BE,
-0xFF65A0BE,
-0xFF65A0BE,
-0xFF65A0BE,
-0xFF65A0BE,
-0xFF65A0BE,
-0xFF66A1BF,
-0xFF66A1BF,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF65A0C0,
-0xFF65A0C0,
-0xFF65A0C0,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF66A1C1,
-0xFF67A2C2,
-0xFF69A1C2,
-0xFF69A1C2,
-0xFF69A1C2,
-0xFF69A1C2,
-0xFF69A1C2,
-0xFF6AA2C3,
-0xFF6AA2C3,
-0xFF6AA2C3,
-0xFF6AA2C3,
-0xFF6AA2C3,
-0xFF6AA2C3,
-0xFF6AA2C3,
-0xFF6BA3C4,
-0xFF6BA3C4,
-0xFF6CA4C5,
-0xFF6CA4C5,
-0xFF6BA4C2,
-0xFF69A4C2,
-0xFF69A4C2,
-0xFF6AA5C3,
-0xFF6AA5C3,
-0xFF6AA5C3,
-0xFF6AA5C3,
-0xFF6BA6C4,
-0xFF6AA5C3,
-0xFF6AA5C3,
-0xFF6BA6C4,
-0xFF6BA6C4,
-0xFF6BA6C4,
-0xFF6BA6C4,
-0xFF6CA7C5,
-0xFF6CA7C5,
-0xFF6FA8C5,
-0xFF6BA1B9,
-0xFF73A2B4,
-0xFF6D8F9B,
-0xFFE2F3FD,
-0xFFFBFFFF,
-0xFFFDFFFE,
-0xFFFEFFFA,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFF9FFFF,
-0xFFF3FFFF,
-0xFFEAFFFF,
-0xFFA3C3D2,
-0xFF5F8695,
-0xFF507B8E,
-0xFF55839A,
-0xFF56859F,
-0xFF5688A3,
-0xFF5689A6,
-0xFF558AA9,
-0xFF578EAD,
-0xFF528DAF,
-0xFF4B87AB,
-0xFF4B89AE,
-0xFF4B89AE,
-0xFF4B89B0,
-0xFF4C8AB1,
-0xFF4C8AB1,
-0xFF4C8AAF,
-0xFF4C8AAF,
-0xFF4C8AAF,
-0xFF4B8BB1,
-0xFF4A8BB1,
-0xFF4B8BB1,
-0xFF4A8BB1,
-0xFF4B8BB1,
-0xFF4A8BB1,
-0xFF4B8BB1,
-0xFF4A8BB1,
-0xFF4D8DB3,
-0xFF4C8DB3,
-0xFF4D8DB3,
-0xFF4C8DB3,
-0xFF4D8DB3,
-0xFF4C8DB3,
-0xFF4D8DB3,
-0xFF4B8CB2,
-0xFF4C8DB5,
-0xFF4C8DB5,
-0xFF4C8DB5,
-0xFF4C8DB5,
-0xFF4C8DB5,
-0xFF4D8EB6,
-0xFF4D8EB6,
-0xFF4D8EB6,
-0xFF4C8DB5,
-0xFF4C8DB5,
-0xFF4D8EB6,
-0xFF4D8EB6,
-0xFF4E8FB7,
-0xFF4E8FB7,
-0xFF4F90B8,
-0xFF4F90B6,
-0xFF5191B5,
-0xFF5191B5,
-0xFF5191B5,
-0xFF5292B6,
-0xFF5292B6,
-0xFF5292B6,
-0xFF5393B7,
-0xFF5393B7,
-0xFF5393B7,
-0xFF5393B7,
-0xFF5494B8,
-0xFF5494B8,
-0xFF5494B8,
-0xFF5595B9,
-0xFF5595B9,
-0xFF5694B9,
-0xFF5995B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5A94B9,
-0xFF5B95BA,
-0xFF5B95BA,
-0xFF5B95BA,
-0xFF5C96BB,
-0xFF5C96BB,
-0xFF5D97BC,
-0xFF5D98BA,
-0xFF5D98BA,
-0xFF5D98B8,
-0xFF5D98B8,
-0xFF5E99B9,
-0xFF5E99B9,
-0xFF5E99B9,
-0xFF5F9ABA,
-0xFF5F9ABA,
-0xFF5E99B9,
-0xFF5E99B9,
-0xFF5F9ABA,
-0xFF5F9ABA,
-0xFF609BBB,
-0xFF609BBB,
-0xFF619CBC,
-0xFF619CBC,
-0xFF619CBC,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF619CBA,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF609BBB,
-0xFF5F9BBD,
-0xFF5D9CBF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF5B9BBF,
-0xFF5A9AC0,
-0xFF599AC0,
-0xFF599AC0,
-0xFF599AC0,
-0xFF599AC0,
-0xFF5899BF,
-0xFF5899BF,
-0xFF5899BF,
-0xFF5B9CC2,
-0xFF5A9BC1,
-0xFF5A9BC1,
-0xFF5A9BC1,
-0xFF5A9BC1,
-0xFF5A9BC1,
-0xFF599AC0,
-0xFF599AC0,
-0xFF5A9BC3,
-0xFF5A9BC3,
-0xFF5A9BC3,
-0xFF5A9BC3,
-0xFF5A9BC3,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC2,
-0xFF599AC0,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5A9ABE,
-0xFF5999BD,
-0xFF5999BD,
-0xFF5999BD,
-0xFF5999BD,
-0xFF5999BD,
-0xFF589ABD,
-0xFF599BBE,
-0xFF61A0BF,
-0xFF71A7BF,
-0xFF7197AA,
-0xFFD0E2F0,
-0xFFFBFFFF,
-0xFFFCFCFE,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF6FFFF,
-0xFFF2FFFF,
-0xFFE2F8FF,
-0xFF89A6B8,
-0xFF4E7487,
-0xFF4C7B8F,
-0xFF53879D,
-0xFF4F87A0,
-0xFF518AA7,
-0xFF4C84A5,
-0xFF4782A2,
-0xFF427EA0,
-0xFF3D799D,
-0xFF39779C,
-0xFF39799F,
-0xFF3877A0,
-0xFF3778A0,
-0xFF3879A3,
-0xFF3A79A5,
-0xFF3B7AA6,
-0xFF3A79A4,
-0xFF3A79A4,
-0xFF3B7AA5,
-0xFF3B7CA6,
-0xFF397CA6,
-0xFF397EA7,
-0xFF397EA7,
-0xFF3A7FA8,
-0xFF3B80A9,
-0xFF3C81AA,
-0xFF3C81AB,
-0xFF3D82AC,
-0xFF3D82AC,
-0xFF3B82AC,
-0xFF3B82AC,
-0xFF3C83AD,
-0xFF3D84AE,
-0xFF3E85AF,
-0xFF3E85AF,
-0xFF3E85AF,
-0xFF3F88B3,
-0xFF3F88B3,
-0xFF3F88B3,
-0xFF3F88B3,
-0xFF3F88B3,
-0xFF4089B4,
-0xFF4089B4,
-0xFF4089B4,
-0xFF418AB5,
-0xFF428BB6,
-0xFF428BB6,
-0xFF438CB7,
-0xFF448DB8,
-0xFF468DB7,
-0xFF478EB8,
-0xFF478EB8,
-0xFF4B90B9,
-0xFF4B90B9,
-0xFF4D90BA,
-0xFF4C91BA,
-0xFF4E91BB,
-0xFF4D92B9,
-0xFF4F92BC,
-0xFF4F93BA,
-0xFF4F92BC,
-0xFF4F93BA,
-0xFF5094BB,
-0xFF5195BC,
-0xFF5195BC,
-0xFF5296BD,
-0xFF5397BE,
-0xFF5596BE,
-0xFF5696BC,
-0xFF5795BC,
-0xFF5896BD,
-0xFF5997BE,
-0xFF5A98BF,
-0xFF5B99C0,
-0xFF5C9AC1,
-0xFF5D9BC0,
-0xFF5D9BC2,
-0xFF5D9BC0,
-0xFF5D9BC0,
-0xFF5E9CC1,
-0xFF5F9DC2,
-0xFF5F9DC2,
-0xFF609EC3,
-0xFF609EC3,
-0xFF61A0C3,
-0xFF61A0C3,
-0xFF639FC3,
-0xFF62A1C4,
-0xFF64A0C4,
-0xFF65A1C5,
-0xFF65A1C5,
-0xFF65A1C3,
-0xFF67A3C5,
-0xFF67A3C5,
-0xFF67A3C5,
-0xFF68A4C6,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA6C8,
-0xFF69A6C5,
-0xFF69A5C7,
-0xFF68A5C4,
-0xFF67A3C5,
-0xFF67A4C3,
-0xFF66A2C4,
-0xFF66A2C4,
-0xFF66A2C4,
-0xFF63A2C3,
-0xFF65A1C3,
-0xFF62A1C2,
-0xFF61A0C3,
-0xFF61A0C1,
-0xFF609FC2,
-0xFF609FC2,
-0xFF609FC2,
-0xFF609FC2,
-0xFF609FC2,
-0xFF5F9EC1,
-0xFF5E9DC0,
-0xFF5E9DC0,
-0xFF5D9CBF,
-0xFF5D9BC0,
-0xFF5B9BC1,
-0xFF5A99C2,
-0xFF5998C1,
-0xFF5998C1,
-0xFF5897C0,
-0xFF5796BF,
-0xFF5695BE,
-0xFF5596BE,
-0xFF5594BF,
-0xFF5394BE,
-0xFF5493BE,
-0xFF5293BD,
-0xFF5293BD,
-0xFF5293BD,
-0xFF5293BD,
-0xFF5192BC,
-0xFF4D92BB,
-0xFF4A92BA,
-0xFF4C91BA,
-0xFF4991B9,
-0xFF4B90B9,
-0xFF4890B8,
-0xFF4A8FB9,
-0xFF488FB9,
-0xFF458CB6,
-0xFF458CB6,
-0xFF448BB5,
-0xFF438AB4,
-0xFF4289B3,
-0xFF4188B2,
-0xFF4087B1,
-0xFF3F88B1,
-0xFF3E87B2,
-0xFF3E87B2,
-0xFF3E87B2,
-0xFF3D86B1,
-0xFF3D86B1,
-0xFF3C85B0,
-0xFF3C85B0,
-0xFF3C85B0,
-0xFF3C85B0,
-0xFF3B84AF,
-0xFF3B84AF,
-0xFF3A83AE,
-0xFF3A83AE,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3980AA,
-0xFF3B80AA,
-0xFF3A7FA8,
-0xFF3A7FA8,
-0xFF397EA7,
-0xFF397CA6,
-0xFF377CA5,
-0xFF377CA5,
-0xFF377CA5,
-0xFF367BA4,
-0xFF367BA4,
-0xFF3679A3,
-0xFF3579A0,
-0xFF3477A1,
-0xFF3477A1,
-0xFF3376A0,
-0xFF32779E,
-0xFF30759C,
-0xFF64A5C5,
-0xFF6599B1,
-0xFF7093A6,
-0xFFF4FFFF,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFCFCFA,
-0xFFFFFFFB,
-0xFFFEFDF8,
-0xFFFEFFFD,
-0xFFF9FFFF,
-0xFFF4FFFF,
-0xFFECFFFF,
-0xFF84A5B6,
-0xFF467088,
-0xFF487A95,
-0xFF4A819F,
-0xFF4883A1,
-0xFF4784A3,
-0xFF3B7A9B,
-0xFF38769B,
-0xFF38769D,
-0xFF37779D,
-0xFF37779D,
-0xFF38789E,
-0xFF39799F,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3A7BA5,
-0xFF3B7CA6,
-0xFF3B7BA7,
-0xFF3B7BA7,
-0xFF3A7DA8,
-0xFF3B7EA9,
-0xFF3B7EA9,
-0xFF3C7FAA,
-0xFF3B80AA,
-0xFF3C81AB,
-0xFF3C81AB,
-0xFF3C81AB,
-0xFF3B82AE,
-0xFF3B82AE,
-0xFF3D84B0,
-0xFF3C85B0,
-0xFF3C85B0,
-0xFF3D86B1,
-0xFF3E87B2,
-0xFF3E87B2,
-0xFF3D88B2,
-0xFF3D87B4,
-0xFF3D8AB8,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3D89BA,
-0xFF3D8BBB,
-0xFF3D8BBB,
-0xFF3D8BB9,
-0xFF3D8BB9,
-0xFF3F8CBA,
-0xFF408DBB,
-0xFF448EBB,
-0xFF428CB9,
-0xFF458FBC,
-0xFF458EB9,
-0xFF4790BB,
-0xFF478EBA,
-0xFF4990BA,
-0xFF4990BA,
-0xFF4C91BB,
-0xFF4A91BB,
-0xFF4D92BC,
-0xFF4B93BB,
-0xFF4E93BD,
-0xFF4E93BC,
-0xFF4E93BD,
-0xFF5095BE,
-0xFF4F94BD,
-0xFF5297C0,
-0xFF5093BD,
-0xFF5396C0,
-0xFF5495BF,
-0xFF5497C1,
-0xFF5498BF,
-0xFF5498BF,
-0xFF5498BF,
-0xFF5599C0,
-0xFF569AC1,
-0xFF579BC2,
-0xFF5A9BC3,
-0xFF5B9CC2,
-0xFF5C9BC4,
-0xFF5D9DC3,
-0xFF5D9DC3,
-0xFF5C9CC2,
-0xFF5D9DC3,
-0xFF5F9FC5,
-0xFF5F9FC5,
-0xFF5E9EC4,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF619FC4,
-0xFF60A0C4,
-0xFF62A0C5,
-0xFF63A1C6,
-0xFF63A1C6,
-0xFF64A3C6,
-0xFF65A4C7,
-0xFF65A4C7,
-0xFF67A3C7,
-0xFF67A3C7,
-0xFF69A5C7,
-0xFF6AA6C8,
-0xFF6BA6C8,
-0xFF69A4C6,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF67A6C9,
-0xFF67A6C7,
-0xFF67A6C9,
-0xFF66A5C6,
-0xFF66A5C8,
-0xFF66A5C6,
-0xFF65A4C7,
-0xFF64A3C6,
-0xFF63A2C5,
-0xFF63A3C6,
-0xFF64A3C6,
-0xFF62A2C5,
-0xFF60A0C4,
-0xFF60A0C3,
-0xFF60A0C4,
-0xFF60A0C4,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5E9EC2,
-0xFF5E9EC2,
-0xFF5C9EC1,
-0xFF5C9EC1,
-0xFF5B9CC2,
-0xFF5B9CC2,
-0xFF5B9CC4,
-0xFF5A9BC5,
-0xFF599AC4,
-0xFF5899C3,
-0xFF5798C2,
-0xFF5798C2,
-0xFF5697C1,
-0xFF5396C0,
-0xFF5696C2,
-0xFF5396C1,
-0xFF5494C0,
-0xFF5295C0,
-0xFF5194BF,
-0xFF5194BF,
-0xFF5093C0,
-0xFF4E92BF,
-0xFF4C93BD,
-0xFF4B94BD,
-0xFF4B92BC,
-0xFF4A93BC,
-0xFF4A91BB,
-0xFF4891BA,
-0xFF4990BC,
-0xFF4891BC,
-0xFF468FBA,
-0xFF468FBA,
-0xFF468FBA,
-0xFF458EB9,
-0xFF438DBA,
-0xFF428CB9,
-0xFF3F8CB8,
-0xFF3F8CB8,
-0xFF3E8BB9,
-0xFF3D8BB9,
-0xFF3C8AB8,
-0xFF3C8AB8,
-0xFF3C89B7,
-0xFF3B88B6,
-0xFF3D87B6,
-0xFF3E88B7,
-0xFF3D87B4,
-0xFF3D87B4,
-0xFF3D87B4,
-0xFF3C86B3,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B84B1,
-0xFF3B82B0,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3C81AB,
-0xFF3980AA,
-0xFF3980AC,
-0xFF387FAB,
-0xFF367DA9,
-0xFF387FAB,
-0xFF387DA7,
-0xFF3A7FA8,
-0xFF387BA6,
-0xFF387BA6,
-0xFF3A7FA9,
-0xFF31769F,
-0xFF468AAF,
-0xFF66A1BF,
-0xFF6691A4,
-0xFFACC6D3,
-0xFFF8FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFBFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFF2FFFF,
-0xFFB0CBD6,
-0xFF4D7083,
-0xFF46748B,
-0xFF457B97,
-0xFF4580A0,
-0xFF407FA2,
-0xFF39799C,
-0xFF36769A,
-0xFF36769A,
-0xFF36779F,
-0xFF3677A1,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3A7BA5,
-0xFF397CA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3B7FAC,
-0xFF3A81AD,
-0xFF3C80AD,
-0xFF3A81AD,
-0xFF3B82B0,
-0xFF3A83B0,
-0xFF3C85B2,
-0xFF3B85B2,
-0xFF3B85B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A88B6,
-0xFF3C8ABB,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8CBB,
-0xFF3E8CBC,
-0xFF3F8DBD,
-0xFF428EBF,
-0xFF408DBB,
-0xFF458FBE,
-0xFF448EBB,
-0xFF4790BD,
-0xFF468FBA,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4990BE,
-0xFF4992BD,
-0xFF4B92BE,
-0xFF4A93BC,
-0xFF4C93BF,
-0xFF4C93BD,
-0xFF4C93BF,
-0xFF4E95BF,
-0xFF4D94BE,
-0xFF5297C0,
-0xFF4F94BE,
-0xFF5396C0,
-0xFF5295C0,
-0xFF5497C1,
-0xFF5398C1,
-0xFF5199C1,
-0xFF5398C1,
-0xFF5499C2,
-0xFF559AC3,
-0xFF579AC4,
-0xFF589CC3,
-0xFF599DC4,
-0xFF5B9CC4,
-0xFF5C9DC5,
-0xFF5C9DC3,
-0xFF5B9CC2,
-0xFF5C9DC3,
-0xFF5E9FC5,
-0xFF5F9FC5,
-0xFF5E9EC4,
-0xFF5F9FC5,
-0xFF60A0C6,
-0xFF60A0C6,
-0xFF60A0C6,
-0xFF61A1C7,
-0xFF62A2C6,
-0xFF64A2C7,
-0xFF64A2C7,
-0xFF65A4C7,
-0xFF66A5C8,
-0xFF68A4C8,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF69A5C7,
-0xFF6AA5C7,
-0xFF6AA5C7,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6AA6C8,
-0xFF6AA6CA,
-0xFF6AA6CA,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF64A3C6,
-0xFF63A2C5,
-0xFF63A3C6,
-0xFF62A2C6,
-0xFF62A2C6,
-0xFF61A1C5,
-0xFF5FA1C4,
-0xFF5FA1C4,
-0xFF5FA1C4,
-0xFF5E9FC5,
-0xFF5E9FC5,
-0xFF5D9EC4,
-0xFF5D9EC4,
-0xFF5C9DC3,
-0xFF5A9EC3,
-0xFF5B9CC4,
-0xFF599DC4,
-0xFF5B9CC6,
-0xFF589BC5,
-0xFF599AC4,
-0xFF5699C3,
-0xFF5798C2,
-0xFF5598C2,
-0xFF5497C2,
-0xFF5297C1,
-0xFF5497C2,
-0xFF5297C1,
-0xFF5295C2,
-0xFF5195C2,
-0xFF5094C1,
-0xFF4E95C1,
-0xFF4F93C0,
-0xFF4C93BF,
-0xFF4B94BF,
-0xFF4B94BD,
-0xFF4A93BE,
-0xFF4A93BE,
-0xFF4992BD,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4791BE,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBE,
-0xFF428FBD,
-0xFF418EBC,
-0xFF3F8DBB,
-0xFF3F8DBD,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8ABA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3D89BA,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A84B3,
-0xFF3A82B2,
-0xFF3A81AF,
-0xFF3A81AD,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AE,
-0xFF3780AD,
-0xFF3980AE,
-0xFF387FAB,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF397CA7,
-0xFF377AA5,
-0xFF377AA5,
-0xFF3477A1,
-0xFF5393B7,
-0xFF6197B3,
-0xFF638699,
-0xFFE3F5FF,
-0xFFFBFFFF,
-0xFFFCFAFB,
-0xFFFDFBFE,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDFCFA,
-0xFFFEFFFF,
-0xFFF6FEFF,
-0xFFF4FFFF,
-0xFFEEFFFF,
-0xFF648191,
-0xFF42677A,
-0xFF44728A,
-0xFF4A7D9A,
-0xFF437A99,
-0xFF387393,
-0xFF387496,
-0xFF357495,
-0xFF347396,
-0xFF39789B,
-0xFF37779D,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3A7BA3,
-0xFF387BA5,
-0xFF397CA6,
-0xFF397CA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7EAB,
-0xFF387FAB,
-0xFF3980AE,
-0xFF3982AF,
-0xFF3A81AF,
-0xFF3982AF,
-0xFF3A82B2,
-0xFF3983B2,
-0xFF3B85B4,
-0xFF3986B4,
-0xFF3985B6,
-0xFF3987B7,
-0xFF3987B7,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3888B9,
-0xFF3A8ABB,
-0xFF3989BC,
-0xFF3989BC,
-0xFF398BBD,
-0xFF3A8CBE,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3C8CBD,
-0xFF3D8EBD,
-0xFF418FBF,
-0xFF3F8DBB,
-0xFF4390BE,
-0xFF428FBB,
-0xFF4690BD,
-0xFF458FBC,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4890C0,
-0xFF4892BF,
-0xFF4A93C0,
-0xFF4994BE,
-0xFF4B94C1,
-0xFF4B94BF,
-0xFF4B94C1,
-0xFF4D96C1,
-0xFF4C95C0,
-0xFF5097C1,
-0xFF4D94C0,
-0xFF5297C1,
-0xFF5195C2,
-0xFF5398C2,
-0xFF5398C1,
-0xFF5398C1,
-0xFF5497C1,
-0xFF5598C2,
-0xFF5699C3,
-0xFF599AC4,
-0xFF5A9BC3,
-0xFF5A9BC3,
-0xFF5C9CC2,
-0xFF5D9DC3,
-0xFF5D9DC3,
-0xFF5C9CC2,
-0xFF5D9DC1,
-0xFF5F9FC3,
-0xFF609EC3,
-0xFF5E9EC2,
-0xFF5F9FC5,
-0xFF60A0C6,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF62A0C5,
-0xFF63A1C6,
-0xFF64A2C7,
-0xFF64A3C6,
-0xFF66A2C6,
-0xFF68A4C8,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF69A4C6,
-0xFF69A4C4,
-0xFF6AA5C5,
-0xFF6AA5C5,
-0xFF6AA7C6,
-0xFF6BA8C7,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6AA6C8,
-0xFF69A5C7,
-0xFF6AA6C8,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF65A4C5,
-0xFF64A3C6,
-0xFF64A3C6,
-0xFF63A2C5,
-0xFF63A2C5,
-0xFF62A1C4,
-0xFF60A0C3,
-0xFF60A0C4,
-0xFF60A0C4,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5E9EC4,
-0xFF5E9EC4,
-0xFF5D9DC3,
-0xFF5C9DC3,
-0xFF5C9CC2,
-0xFF5B9CC2,
-0xFF599DC4,
-0xFF579CC3,
-0xFF579BC2,
-0xFF559AC1,
-0xFF5599C0,
-0xFF5499C0,
-0xFF5398C1,
-0xFF5098C0,
-0xFF5398C1,
-0xFF5098C0,
-0xFF5196C0,
-0xFF4F96C0,
-0xFF4E95BF,
-0xFF4D96BF,
-0xFF4D94BE,
-0xFF4B94BF,
-0xFF4B94BF,
-0xFF4A95BF,
-0xFF4993C0,
-0xFF4993C0,
-0xFF4892BF,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4791C0,
-0xFF458FBE,
-0xFF4390BE,
-0xFF438FC0,
-0xFF418FBF,
-0xFF418FBF,
-0xFF408EBE,
-0xFF3F8DBE,
-0xFF3C8CBD,
-0xFF3B8DBD,
-0xFF3B8DBD,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3A8ABB,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3C8ABA,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3987B7,
-0xFF3886B6,
-0xFF3886B6,
-0xFF3886B6,
-0xFF3986B4,
-0xFF3A84B3,
-0xFF3A83B0,
-0xFF3A81AF,
-0xFF3A81AD,
-0xFF3B7FAC,
-0xFF3B80AA,
-0xFF3B7FAC,
-0xFF387FAB,
-0xFF3B7FAC,
-0xFF387DA7,
-0xFF397EA8,
-0xFF3A7DA7,
-0xFF3C7DA7,
-0xFF3A7BA5,
-0xFF397AA4,
-0xFF4080A6,
-0xFF5C98BA,
-0xFF5C8EA7,
-0xFF83A3B2,
-0xFFF2FFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFDFA,
-0xFFFFFFFD,
-0xFFF5FDFF,
-0xFFF2FFFF,
-0xFFC8E2F1,
-0xFF45687C,
-0xFF436D86,
-0xFF43728E,
-0xFF447998,
-0xFF397290,
-0xFF346F8F,
-0xFF397494,
-0xFF3B7799,
-0xFF397597,
-0xFF387498,
-0xFF367499,
-0xFF37779D,
-0xFF36779F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF387CA3,
-0xFF387BA5,
-0xFF397CA6,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7EAB,
-0xFF387FAB,
-0xFF387FAD,
-0xFF3881AE,
-0xFF3982AF,
-0xFF3981B1,
-0xFF3981B1,
-0xFF3983B2,
-0xFF3A84B3,
-0xFF3985B6,
-0xFF3884B5,
-0xFF3886B6,
-0xFF3886B6,
-0xFF3787B8,
-0xFF3888B9,
-0xFF3888B9,
-0xFF3888B9,
-0xFF3A8ABD,
-0xFF3989BC,
-0xFF3989BC,
-0xFF398BBD,
-0xFF3A8CBE,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3B8DBD,
-0xFF3C8CBD,
-0xFF3D8EBD,
-0xFF418FBF,
-0xFF3F8DBB,
-0xFF4390BE,
-0xFF428FBD,
-0xFF4690BD,
-0xFF458FBC,
-0xFF4791C0,
-0xFF4791C0,
-0xFF4791C0,
-0xFF4892C1,
-0xFF4892BF,
-0xFF4993C0,
-0xFF4A94C1,
-0xFF4A94C1,
-0xFF4A94C1,
-0xFF4C96C3,
-0xFF4C95C0,
-0xFF4F98C3,
-0xFF4D94C0,
-0xFF5097C3,
-0xFF4F96C2,
-0xFF5198C4,
-0xFF5297C1,
-0xFF5398C1,
-0xFF5497C1,
-0xFF5598C2,
-0xFF5899C3,
-0xFF599AC4,
-0xFF5A9BC3,
-0xFF5A9BC3,
-0xFF5C9CC2,
-0xFF5D9DC3,
-0xFF5D9DC3,
-0xFF5C9CC2,
-0xFF5E9CC1,
-0xFF609EC3,
-0xFF609EC3,
-0xFF5F9DC2,
-0xFF5F9FC5,
-0xFF60A0C6,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF62A0C5,
-0xFF63A1C6,
-0xFF64A3C6,
-0xFF64A3C6,
-0xFF66A2C6,
-0xFF68A4C8,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF69A4C4,
-0xFF6AA5C5,
-0xFF6AA5C5,
-0xFF6AA5C5,
-0xFF6AA7C6,
-0xFF6BA8C7,
-0xFF6BA7C9,
-0xFF6CA8CA,
-0xFF6CA8CA,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF67A3C5,
-0xFF64A3C6,
-0xFF64A3C6,
-0xFF63A2C5,
-0xFF63A2C5,
-0xFF62A1C4,
-0xFF61A0C3,
-0xFF619FC4,
-0xFF60A0C4,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5E9EC4,
-0xFF5E9EC4,
-0xFF5D9DC3,
-0xFF5C9CC2,
-0xFF5C9CC2,
-0xFF5B9CC2,
-0xFF599DC4,
-0xFF579CC3,
-0xFF569BC2,
-0xFF559AC1,
-0xFF5499C0,
-0xFF5499C0,
-0xFF5199C1,
-0xFF5098C0,
-0xFF5199C1,
-0xFF5098C0,
-0xFF4F96C0,
-0xFF4F96C0,
-0xFF4D96BF,
-0xFF4D96BF,
-0xFF4C95BE,
-0xFF4B94BD,
-0xFF4A94C1,
-0xFF4A94C1,
-0xFF4993C0,
-0xFF4993C0,
-0xFF4892BF,
-0xFF4892BF,
-0xFF4791C0,
-0xFF4791C0,
-0xFF4690C1,
-0xFF438FC0,
-0xFF438FC0,
-0xFF418FBF,
-0xFF418FC0,
-0xFF408EBF,
-0xFF3D8DBE,
-0xFF3C8CBD,
-0xFF3B8DBD,
-0xFF398DBC,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3A8ABB,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3A8BBA,
-0xFF3987B7,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3987B7,
-0xFF3987B7,
-0xFF3886B6,
-0xFF3886B6,
-0xFF3986B4,
-0xFF3A84B1,
-0xFF3A83B0,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3B80AA,
-0xFF3B80AA,
-0xFF3B7FAC,
-0xFF3A7EAB,
-0xFF3A7FA9,
-0xFF377CA6,
-0xFF3A7DA7,
-0xFF3A7DA7,
-0xFF3C7DA5,
-0xFF3A7BA3,
-0xFF3A7BA1,
-0xFF4A89AC,
-0xFF568DAB,
-0xFF4F7C93,
-0xFFCAE6F4,
-0xFFF2FFFF,
-0xFFF9FDFE,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFCFA,
-0xFFFBFFFF,
-0xFFF3FFFF,
-0xFFAFC9D8,
-0xFF395D75,
-0xFF3E6B88,
-0xFF396E90,
-0xFF3C7499,
-0xFF397398,
-0xFF367294,
-0xFF3B7698,
-0xFF3D789A,
-0xFF367294,
-0xFF367296,
-0xFF39779C,
-0xFF36769C,
-0xFF36779F,
-0xFF36779F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A3,
-0xFF397AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF377EAA,
-0xFF387FAB,
-0xFF377EAA,
-0xFF387FAB,
-0xFF3881AE,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B2,
-0xFF3A84B3,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3886B6,
-0xFF3886B6,
-0xFF3787B8,
-0xFF3888B9,
-0xFF3888B9,
-0xFF3888B9,
-0xFF3C8ABB,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3D8EBD,
-0xFF418FBF,
-0xFF3F8DBB,
-0xFF4390BE,
-0xFF448EBB,
-0xFF4690BD,
-0xFF458FBC,
-0xFF4791C0,
-0xFF4791C0,
-0xFF4791BE,
-0xFF4892BF,
-0xFF4892BF,
-0xFF4993C0,
-0xFF4A94C1,
-0xFF4A94C1,
-0xFF4A95BF,
-0xFF4C97C1,
-0xFF4C95C0,
-0xFF4F98C3,
-0xFF4D94C0,
-0xFF5097C3,
-0xFF4F96C2,
-0xFF5198C4,
-0xFF5297C1,
-0xFF5398C2,
-0xFF5497C1,
-0xFF5598C2,
-0xFF5899C3,
-0xFF599AC4,
-0xFF5B9AC3,
-0xFF5B9AC3,
-0xFF5D9BC2,
-0xFF5E9CC3,
-0xFF5E9CC1,
-0xFF5E9CC1,
-0xFF5E9CC1,
-0xFF609EC3,
-0xFF609EC3,
-0xFF5F9DC2,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF61A1C5,
-0xFF62A1C4,
-0xFF63A2C5,
-0xFF64A3C6,
-0xFF65A4C7,
-0xFF66A2C4,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF69A6C5,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6BA6C6,
-0xFF6CA7C7,
-0xFF6DA8C8,
-0xFF6DA8C8,
-0xFF6CA9C8,
-0xFF6CA9C8,
-0xFF6BA8C7,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA6C8,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF67A3C5,
-0xFF66A2C6,
-0xFF66A2C6,
-0xFF65A1C5,
-0xFF65A1C5,
-0xFF64A0C4,
-0xFF61A0C3,
-0xFF619FC4,
-0xFF609EC3,
-0xFF609EC3,
-0xFF609EC3,
-0xFF609EC3,
-0xFF5F9DC2,
-0xFF5E9CC3,
-0xFF5D9BC2,
-0xFF5D9BC2,
-0xFF5D9DC3,
-0xFF599DC2,
-0xFF579DC1,
-0xFF569BC2,
-0xFF559AC1,
-0xFF5499C0,
-0xFF5499C0,
-0xFF5398BF,
-0xFF5297BE,
-0xFF5199C1,
-0xFF5098C0,
-0xFF4F97BF,
-0xFF4F97BF,
-0xFF4E96BE,
-0xFF4E96BE,
-0xFF4C95BE,
-0xFF4B94BD,
-0xFF4B94C1,
-0xFF4B94C1,
-0xFF4A93C0,
-0xFF4A93C0,
-0xFF4992BF,
-0xFF4992BF,
-0xFF4890C0,
-0xFF4791C0,
-0xFF4690BF,
-0xFF4390BE,
-0xFF438FC0,
-0xFF428EBF,
-0xFF418FBF,
-0xFF408EBE,
-0xFF3F8DBD,
-0xFF3C8DBC,
-0xFF3B8DBC,
-0xFF3B8DBC,
-0xFF3A8CBB,
-0xFF3A8CBB,
-0xFF3A8BBA,
-0xFF398AB9,
-0xFF3B89B9,
-0xFF3C8ABA,
-0xFF3A86B7,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A84B1,
-0xFF3984AE,
-0xFF3982AD,
-0xFF3980AC,
-0xFF3B80AA,
-0xFF3B80AA,
-0xFF3C7FAA,
-0xFF3B7EA9,
-0xFF3C7FAA,
-0xFF397CA7,
-0xFF3B7EA9,
-0xFF3A7DA7,
-0xFF3B7CA4,
-0xFF397AA0,
-0xFF3C7CA0,
-0xFF508BAB,
-0xFF5887A1,
-0xFF5D8295,
-0xFFEEFFFF,
-0xFFF7FFFF,
-0xFFFEFFFF,
-0xFFFEFDFB,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFBFFFE,
-0xFFFBFFFF,
-0xFFF3FFFF,
-0xFF95ACBA,
-0xFF34576B,
-0xFF376481,
-0xFF366C90,
-0xFF3A759D,
-0xFF327097,
-0xFF327095,
-0xFF387498,
-0xFF3A7597,
-0xFF377294,
-0xFF377397,
-0xFF38769B,
-0xFF36779D,
-0xFF34759D,
-0xFF36779F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA4,
-0xFF397AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF377CA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF377EAA,
-0xFF387FAB,
-0xFF377EAA,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3886B6,
-0xFF3987B7,
-0xFF3889B8,
-0xFF3A88B9,
-0xFF3A88B8,
-0xFF3B89BA,
-0xFF3B89B9,
-0xFF3B89BA,
-0xFF3A8BBA,
-0xFF3B8BBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3F8DBB,
-0xFF418FBD,
-0xFF408DB9,
-0xFF458FBC,
-0xFF448EBB,
-0xFF4690BD,
-0xFF458FBC,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4892BF,
-0xFF4892BF,
-0xFF4994BE,
-0xFF4A94C1,
-0xFF4A95BF,
-0xFF4A95BF,
-0xFF4D96C1,
-0xFF4C95C0,
-0xFF4F96C0,
-0xFF4D94C0,
-0xFF5097C1,
-0xFF5195C2,
-0xFF5398C2,
-0xFF5297C1,
-0xFF5398C2,
-0xFF5497C1,
-0xFF5699C3,
-0xFF5899C3,
-0xFF599AC4,
-0xFF5B9AC3,
-0xFF5B9AC3,
-0xFF5D9BC4,
-0xFF5E9CC3,
-0xFF5E9CC3,
-0xFF5E9CC1,
-0xFF5F9DC2,
-0xFF609EC3,
-0xFF609EC3,
-0xFF5F9DC2,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF61A1C5,
-0xFF62A1C4,
-0xFF63A2C5,
-0xFF64A3C6,
-0xFF65A4C7,
-0xFF67A3C5,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF69A6C5,
-0xFF6AA7C6,
-0xFF6BA8C7,
-0xFF6AA7C6,
-0xFF6CA7C7,
-0xFF6DA8C8,
-0xFF6DA8C8,
-0xFF6EA9C9,
-0xFF6DAAC9,
-0xFF6CA9C8,
-0xFF6CA9C8,
-0xFF6BA8C7,
-0xFF6AA7C6,
-0xFF6AA7C6,
-0xFF6AA6C8,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF67A3C5,
-0xFF66A2C6,
-0xFF66A2C6,
-0xFF65A1C5,
-0xFF65A1C5,
-0xFF64A0C4,
-0xFF62A1C4,
-0xFF619FC4,
-0xFF609EC3,
-0xFF5F9DC2,
-0xFF609EC3,
-0xFF609EC3,
-0xFF5F9DC2,
-0xFF5E9CC3,
-0xFF5D9BC2,
-0xFF5D9BC2,
-0xFF5D9DC3,
-0xFF599DC2,
-0xFF579CC3,
-0xFF579BC2,
-0xFF559AC1,
-0xFF5599C0,
-0xFF5499C0,
-0xFF5398BF,
-0xFF5297BE,
-0xFF5398C1,
-0xFF5098C0,
-0xFF4F97BF,
-0xFF4F97BF,
-0xFF4E96BE,
-0xFF4E96BE,
-0xFF4D94BE,
-0xFF4B94BD,
-0xFF4C93BF,
-0xFF4B94BF,
-0xFF4B92C0,
-0xFF4A93BE,
-0xFF4992BF,
-0xFF4992BF,
-0xFF4891BE,
-0xFF4891BE,
-0xFF478FBF,
-0xFF458FBE,
-0xFF448EBD,
-0xFF428FBD,
-0xFF428EBF,
-0xFF408EBC,
-0xFF3F8DBD,
-0xFF3E8CBC,
-0xFF3D8EBD,
-0xFF3B8DBC,
-0xFF3B8DBC,
-0xFF3B8DBC,
-0xFF3B8CBB,
-0xFF3A8BBA,
-0xFF3C8ABA,
-0xFF3D8BB9,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3885B1,
-0xFF3A84B1,
-0xFF3984AE,
-0xFF3883AD,
-0xFF3881AC,
-0xFF3980AC,
-0xFF3B80AA,
-0xFF3C7FAA,
-0xFF3B7EA9,
-0xFF3B7EA9,
-0xFF3A7DA8,
-0xFF3A7DA8,
-0xFF3A7DA7,
-0xFF3B7CA4,
-0xFF3B7B9F,
-0xFF407FA2,
-0xFF5188A6,
-0xFF50798F,
-0xFFA3BFCD,
-0xFFF0FFFF,
-0xFFF7FFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFF8FFFF,
-0xFFF1FFFF,
-0xFF8EA8B5,
-0xFF35586C,
-0xFF3A6681,
-0xFF356A8A,
-0xFF367096,
-0xFF337198,
-0xFF35739A,
-0xFF39759A,
-0xFF3C769B,
-0xFF397496,
-0xFF377294,
-0xFF37759A,
-0xFF35769C,
-0xFF3176A0,
-0xFF3479A3,
-0xFF3477A1,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A0,
-0xFF377AA4,
-0xFF387BA5,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387CA9,
-0xFF397DAA,
-0xFF387FAB,
-0xFF387FAB,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3B80AA,
-0xFF3A81AB,
-0xFF3A81AD,
-0xFF3A83AE,
-0xFF3A83AE,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A88B6,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3C88B9,
-0xFF3C89B7,
-0xFF3C88B9,
-0xFF3C8AB8,
-0xFF3D8BBB,
-0xFF3D8BB9,
-0xFF3D8BB9,
-0xFF3E8CBA,
-0xFF3E8CBA,
-0xFF408DBB,
-0xFF428FBD,
-0xFF428CB9,
-0xFF458FBC,
-0xFF458EB9,
-0xFF4790BB,
-0xFF468FBA,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4992BD,
-0xFF4992BD,
-0xFF4A93BC,
-0xFF4A93BE,
-0xFF4B94BD,
-0xFF4B94BD,
-0xFF4D94BE,
-0xFF4D94BE,
-0xFF5196BF,
-0xFF5095BF,
-0xFF5297C0,
-0xFF5396C1,
-0xFF5398C2,
-0xFF5297C1,
-0xFF5198C2,
-0xFF5499C3,
-0xFF559AC4,
-0xFF579AC4,
-0xFF579AC4,
-0xFF5A9BC5,
-0xFF5A9BC3,
-0xFF5C9BC4,
-0xFF5D9DC3,
-0xFF5D9DC3,
-0xFF5D9DC3,
-0xFF5E9EC2,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF61A1C5,
-0xFF61A1C4,
-0xFF62A2C5,
-0xFF63A3C6,
-0xFF64A4C7,
-0xFF64A3C4,
-0xFF66A5C6,
-0xFF67A6C7,
-0xFF67A6C7,
-0xFF67A6C7,
-0xFF68A7C8,
-0xFF68A7C8,
-0xFF68A7C8,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6CA8CA,
-0xFF6DA9CB,
-0xFF6DA9CB,
-0xFF6CA8CA,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF68A7C8,
-0xFF67A6C7,
-0xFF66A5C6,
-0xFF67A6C7,
-0xFF66A5C6,
-0xFF64A3C4,
-0xFF64A3C6,
-0xFF64A3C6,
-0xFF63A2C5,
-0xFF63A2C5,
-0xFF62A0C5,
-0xFF62A0C5,
-0xFF619FC4,
-0xFF5F9FC3,
-0xFF5E9EC2,
-0xFF5F9FC3,
-0xFF5F9FC5,
-0xFF5E9EC4,
-0xFF5D9DC3,
-0xFF5C9CC2,
-0xFF5C9CC2,
-0xFF5C9DC3,
-0xFF5B9CC4,
-0xFF589BC5,
-0xFF599AC4,
-0xFF5699C3,
-0xFF5798C2,
-0xFF5598C2,
-0xFF5497C1,
-0xFF5396C0,
-0xFF5497C2,
-0xFF5297C1,
-0xFF5196C0,
-0xFF5196C0,
-0xFF5095BF,
-0xFF5095BF,
-0xFF4F94BE,
-0xFF4C93BD,
-0xFF4E93BD,
-0xFF4C93BD,
-0xFF4D91BE,
-0xFF4B92BC,
-0xFF4A91BD,
-0xFF4A91BD,
-0xFF4990BC,
-0xFF4891BC,
-0xFF4790BD,
-0xFF458FBC,
-0xFF448EBB,
-0xFF428FBB,
-0xFF428FBD,
-0xFF418EBA,
-0xFF408DBB,
-0xFF3D8BB9,
-0xFF3D8EBB,
-0xFF3C8DBA,
-0xFF3C8DBA,
-0xFF3C8DBA,
-0xFF3D8BB9,
-0xFF3B89B7,
-0xFF3C89B7,
-0xFF3D8AB6,
-0xFF3B85B2,
-0xFF3C86B3,
-0xFF3D87B4,
-0xFF3D87B4,
-0xFF3C86B3,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3784B0,
-0xFF3683AF,
-0xFF3781AE,
-0xFF3881AE,
-0xFF3980AC,
-0xFF3A7FA9,
-0xFF3B7EA9,
-0xFF397DAA,
-0xFF397DAA,
-0xFF387CA9,
-0xFF397EA8,
-0xFF397DA4,
-0xFF3D7DA1,
-0xFF4581A3,
-0xFF4D7F9A,
-0xFF4F7083,
-0xFFE5F9FF,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFDFBFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFF4FFFF,
-0xFF9EB8C7,
-0xFF2B4F65,
-0xFF37637C,
-0xFF356686,
-0xFF387093,
-0xFF347095,
-0xFF37759C,
-0xFF35739A,
-0xFF387297,
-0xFF377294,
-0xFF3A7295,
-0xFF3A7597,
-0xFF367499,
-0xFF35769E,
-0xFF3077A3,
-0xFF2E75A1,
-0xFF3477A1,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A0,
-0xFF377AA4,
-0xFF387BA5,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387CA9,
-0xFF397DAA,
-0xFF387FAB,
-0xFF387FA9,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3B80AA,
-0xFF3A81AB,
-0xFF3A81AB,
-0xFF3B82AC,
-0xFF3A83AE,
-0xFF3B84AF,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3C89B7,
-0xFF3C89B7,
-0xFF3C89B7,
-0xFF3C8AB8,
-0xFF3D8BBB,
-0xFF3D8BB9,
-0xFF3D8BBB,
-0xFF3E8CBA,
-0xFF3E8CBA,
-0xFF408DBB,
-0xFF428FBD,
-0xFF428CB9,
-0xFF458FBC,
-0xFF458EB9,
-0xFF4790BD,
-0xFF468FBA,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4992BD,
-0xFF4992BB,
-0xFF4A93BC,
-0xFF4A93BC,
-0xFF4B94BD,
-0xFF4C93BD,
-0xFF4D94BE,
-0xFF4F94BD,
-0xFF5196BF,
-0xFF5194BE,
-0xFF5396C0,
-0xFF5396C0,
-0xFF5398C1,
-0xFF5097C1,
-0xFF5198C2,
-0xFF5499C3,
-0xFF559AC4,
-0xFF579AC4,
-0xFF579AC4,
-0xFF5A9BC5,
-0xFF5A9BC5,
-0xFF5B9CC4,
-0xFF5D9CC5,
-0xFF5D9DC3,
-0xFF5D9DC3,
-0xFF5E9EC2,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF62A2C6,
-0xFF61A1C4,
-0xFF62A2C5,
-0xFF63A3C6,
-0xFF64A4C7,
-0xFF64A3C4,
-0xFF67A6C7,
-0xFF68A7C8,
-0xFF67A6C7,
-0xFF66A5C6,
-0xFF67A6C7,
-0xFF68A7C8,
-0xFF69A8C9,
-0xFF6AA6C8,
-0xFF6BA7C9,
-0xFF6CA8CA,
-0xFF6DA9CB,
-0xFF6DA9CB,
-0xFF6CA8CA,
-0xFF6BA7C9,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF6AA6C8,
-0xFF67A6C7,
-0xFF66A5C6,
-0xFF66A5C6,
-0xFF66A5C6,
-0xFF66A5C6,
-0xFF64A3C4,
-0xFF65A4C7,
-0xFF64A3C6,
-0xFF63A2C5,
-0xFF62A2C5,
-0xFF62A0C5,
-0xFF61A1C5,
-0xFF60A0C4,
-0xFF5F9FC3,
-0xFF5E9EC2,
-0xFF5F9FC3,
-0xFF5F9FC5,
-0xFF5E9EC4,
-0xFF5D9DC3,
-0xFF5B9CC2,
-0xFF5B9CC2,
-0xFF5C9DC5,
-0xFF5B9CC6,
-0xFF5A9BC5,
-0xFF599AC4,
-0xFF5899C3,
-0xFF5798C2,
-0xFF5598C2,
-0xFF5497C1,
-0xFF5396C1,
-0xFF5497C2,
-0xFF5297C1,
-0xFF5196C0,
-0xFF5196C0,
-0xFF5095BF,
-0xFF5095BF,
-0xFF4F94BE,
-0xFF4E93BD,
-0xFF4E93BD,
-0xFF4C93BD,
-0xFF4D92BC,
-0xFF4B92BC,
-0xFF4A91BB,
-0xFF4A91BB,
-0xFF4990BC,
-0xFF4891BC,
-0xFF468FBA,
-0xFF448FB9,
-0xFF448EBB,
-0xFF418EBA,
-0xFF428FBB,
-0xFF418EBA,
-0xFF408DB9,
-0xFF3D8BB9,
-0xFF3C8DBA,
-0xFF3B8CB9,
-0xFF3B8CBB,
-0xFF3B8CB9,
-0xFF3C8AB8,
-0xFF3B89B7,
-0xFF3C89B7,
-0xFF3D8AB6,
-0xFF3986B4,
-0xFF3C86B3,
-0xFF3D87B6,
-0xFF3D87B4,
-0xFF3C86B3,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3784B0,
-0xFF3683B1,
-0xFF3582B0,
-0xFF3781B0,
-0xFF3881AE,
-0xFF3A7EAB,
-0xFF3B7EA9,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF367DA9,
-0xFF397EA8,
-0xFF387CA3,
-0xFF3D7C9F,
-0xFF477FA0,
-0xFF47758D,
-0xFF7A94A3,
-0xFFF4FFFF,
-0xFFF8FFFF,
-0xFFFCFDFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFC,
-0xFFFFFCF9,
-0xFFFFFFFD,
-0xFFFDFDFD,
-0xFFF9FDFE,
-0xFFF9FFFF,
-0xFFF2FDFF,
-0xFFC4D8E3,
-0xFF294D63,
-0xFF2D5A77,
-0xFF326383,
-0xFF376C8E,
-0xFF3A7295,
-0xFF377196,
-0xFF387499,
-0xFF3A7499,
-0xFF387297,
-0xFF3B7396,
-0xFF397496,
-0xFF387498,
-0xFF35759B,
-0xFF32759F,
-0xFF3276A3,
-0xFF3276A3,
-0xFF3578A2,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A2,
-0xFF3879A3,
-0xFF377AA4,
-0xFF387BA5,
-0xFF3679A4,
-0xFF377AA5,
-0xFF377CA6,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3B80AA,
-0xFF377EA8,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3B82AE,
-0xFF3C85B0,
-0xFF3B84B1,
-0xFF3A83B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A88B8,
-0xFF3987B7,
-0xFF3C8ABA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B8CBB,
-0xFF3C8CBD,
-0xFF3B8CBB,
-0xFF3B8BBC,
-0xFF3C8DBC,
-0xFF3B8CBB,
-0xFF3E8CBC,
-0xFF3F8DBD,
-0xFF428FBD,
-0xFF428FBD,
-0xFF458FBC,
-0xFF458FBE,
-0xFF458FBC,
-0xFF4790BD,
-0xFF4891BE,
-0xFF4792BC,
-0xFF4893BD,
-0xFF4994BE,
-0xFF4994BE,
-0xFF4B94BF,
-0xFF4B94BF,
-0xFF4C95BE,
-0xFF4C95BE,
-0xFF4D94BE,
-0xFF4D94BE,
-0xFF5095BF,
-0xFF5196C0,
-0xFF5297C1,
-0xFF5398C2,
-0xFF5198C2,
-0xFF5099C2,
-0xFF5299C3,
-0xFF539AC4,
-0xFF569BC4,
-0xFF569BC4,
-0xFF579AC4,
-0xFF589BC5,
-0xFF5B9FC6,
-0xFF5C9DC5,
-0xFF5B9CC2,
-0xFF5C9DC3,
-0xFF5D9EC4,
-0xFF5E9FC5,
-0xFF5EA0C3,
-0xFF5EA0C3,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF60A0C4,
-0xFF61A1C5,
-0xFF62A2C6,
-0xFF63A3C7,
-0xFF63A3C6,
-0xFF64A4C7,
-0xFF65A4C7,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF66A5C6,
-0xFF66A5C6,
-0xFF67A6C7,
-0xFF67A6C7,
-0xFF6AA6C8,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6CA8CA,
-0xFF6CA8CA,
-0xFF6BA7C9,
-0xFF69A8C9,
-0xFF68A7C8,
-0xFF67A6C9,
-0xFF68A7CA,
-0xFF68A7CA,
-0xFF67A6C9,
-0xFF66A5C8,
-0xFF65A4C7,
-0xFF65A4C7,
-0xFF65A4C7,
-0xFF63A3C7,
-0xFF63A3C7,
-0xFF62A2C6,
-0xFF61A3C6,
-0xFF61A1C5,
-0xFF60A2C5,
-0xFF60A2C5,
-0xFF5FA1C4,
-0xFF5D9EC4,
-0xFF5E9FC5,
-0xFF5E9FC5,
-0xFF5C9DC3,
-0xFF5C9DC5,
-0xFF5A9EC5,
-0xFF599DC4,
-0xFF589CC3,
-0xFF599CC6,
-0xFF589BC6,
-0xFF579AC5,
-0xFF5699C4,
-0xFF5497C2,
-0xFF5396C1,
-0xFF5396C1,
-0xFF5195C2,
-0xFF5397C4,
-0xFF5397C4,
-0xFF5296C3,
-0xFF4F96C2,
-0xFF4E95C1,
-0xFF4D94C0,
-0xFF4D94C0,
-0xFF4C93BF,
-0xFF4D94C0,
-0xFF4B94BF,
-0xFF4C93BF,
-0xFF4A93BE,
-0xFF4A93BE,
-0xFF4A93BE,
-0xFF4992BF,
-0xFF4791BE,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF428FBB,
-0xFF418EBC,
-0xFF3F8DBB,
-0xFF3E8CBA,
-0xFF3B8CB9,
-0xFF3C8DBC,
-0xFF3B8DBC,
-0xFF3A8CBC,
-0xFF3A8CBB,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B89B9,
-0xFF3B89B7,
-0xFF3A88B8,
-0xFF3B88B6,
-0xFF3B87B8,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3885B1,
-0xFF3784B0,
-0xFF3482B0,
-0xFF3482B0,
-0xFF3781B0,
-0xFF3881AE,
-0xFF3B7FAC,
-0xFF3A7EAB,
-0xFF397DAC,
-0xFF397DAC,
-0xFF377EAC,
-0xFF357CA8,
-0xFF3A7BA3,
-0xFF407CA0,
-0xFF417896,
-0xFF40697F,
-0xFFCDE1EC,
-0xFFF5FEFF,
-0xFFFCFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFAFAF8,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF1FEFF,
-0xFFE9FBFF,
-0xFF2C4758,
-0xFF295570,
-0xFF2E6383,
-0xFF356B8D,
-0xFF397192,
-0xFF3A7295,
-0xFF367095,
-0xFF377196,
-0xFF387297,
-0xFF387297,
-0xFF387297,
-0xFF397399,
-0xFF367499,
-0xFF35759B,
-0xFF34759D,
-0xFF3376A1,
-0xFF3376A1,
-0xFF3677A1,
-0xFF36779F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF397CA7,
-0xFF3A7DA8,
-0xFF397EA8,
-0xFF377CA6,
-0xFF367BA5,
-0xFF367BA5,
-0xFF387DA7,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3B82AE,
-0xFF3982AD,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3881AE,
-0xFF3780AD,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3987B7,
-0xFF3886B6,
-0xFF3B89B9,
-0xFF3987B7,
-0xFF3888B9,
-0xFF3989BA,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3C8DBC,
-0xFF3D8EBD,
-0xFF408EBE,
-0xFF418FBF,
-0xFF438FC0,
-0xFF4390BE,
-0xFF458FBE,
-0xFF458FBE,
-0xFF4891BE,
-0xFF4891BE,
-0xFF4893BD,
-0xFF4994BE,
-0xFF4994BE,
-0xFF4A95BF,
-0xFF4B94BF,
-0xFF4C95C0,
-0xFF4D96C1,
-0xFF4D96BF,
-0xFF4E95BF,
-0xFF4E95BF,
-0xFF5196C0,
-0xFF5297C1,
-0xFF5398C2,
-0xFF5499C3,
-0xFF5097C1,
-0xFF5098C0,
-0xFF5198C2,
-0xFF5499C2,
-0xFF559AC3,
-0xFF579BC2,
-0xFF579AC4,
-0xFF589CC3,
-0xFF599DC4,
-0xFF5B9CC2,
-0xFF5B9CC2,
-0xFF5B9CC2,
-0xFF5C9DC3,
-0xFF5D9FC2,
-0xFF5D9FC2,
-0xFF5E9EC2,
-0xFF60A0C4,
-0xFF60A0C4,
-0xFF62A0C5,
-0xFF61A1C5,
-0xFF63A1C6,
-0xFF62A2C6,
-0xFF63A2C5,
-0xFF64A3C6,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF67A6C7,
-0xFF67A6C7,
-0xFF68A7C8,
-0xFF68A7C8,
-0xFF6AA6C8,
-0xFF6BA7C9,
-0xFF6BA7C9,
-0xFF6CA8CA,
-0xFF6CA8CA,
-0xFF6BA7C9,
-0xFF6AA6C8,
-0xFF68A7C8,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF64A3C6,
-0xFF63A3C7,
-0xFF62A2C6,
-0xFF60A2C5,
-0xFF61A1C5,
-0xFF5FA1C4,
-0xFF5FA1C4,
-0xFF5FA1C4,
-0xFF5D9EC4,
-0xFF5E9FC5,
-0xFF5D9EC4,
-0xFF5C9DC3,
-0xFF5B9CC2,
-0xFF599DC4,
-0xFF599DC4,
-0xFF579BC2,
-0xFF599CC6,
-0xFF589BC6,
-0xFF579AC5,
-0xFF5699C4,
-0xFF5598C3,
-0xFF5499C3,
-0xFF5398C2,
-0xFF5398C2,
-0xFF5296C3,
-0xFF5297C1,
-0xFF5097C3,
-0xFF4F96C0,
-0xFF4E95C1,
-0xFF4E95BF,
-0xFF4E95C1,
-0xFF4C95C0,
-0xFF4A93BE,
-0xFF4994BE,
-0xFF4992BD,
-0xFF4893BD,
-0xFF4992BD,
-0xFF4792BC,
-0xFF4690BD,
-0xFF458FBC,
-0xFF448EBB,
-0xFF4390BC,
-0xFF428FBB,
-0xFF428FBB,
-0xFF408EBC,
-0xFF3F8DBB,
-0xFF3D8EBB,
-0xFF3C8DBA,
-0xFF3A8CBC,
-0xFF398BBB,
-0xFF398BBB,
-0xFF388ABA,
-0xFF398AB9,
-0xFF3889B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3B85B2,
-0xFF3784B0,
-0xFF3583B1,
-0xFF3583B1,
-0xFF3882B1,
-0xFF3982AF,
-0xFF3B7FAC,
-0xFF3A7FA9,
-0xFF3C7FAC,
-0xFF397DAC,
-0xFF377EAC,
-0xFF3A7EAB,
-0xFF3D7CA5,
-0xFF3C7799,
-0xFF3F718C,
-0xFF4D7083,
-0xFFEFFDFF,
-0xFFFCFFFF,
-0xFFFCFCFE,
-0xFFFCFBF9,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFDFB,
-0xFFFDFDFB,
-0xFFFDFFFE,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFF0FFFF,
-0xFF3F5968,
-0xFF2F5268,
-0xFF2A5977,
-0xFF32688A,
-0xFF376F90,
-0xFF3A7293,
-0xFF397194,
-0xFF376F92,
-0xFF377196,
-0xFF387297,
-0xFF377398,
-0xFF357398,
-0xFF36749B,
-0xFF35759B,
-0xFF35759B,
-0xFF35759B,
-0xFF36769C,
-0xFF36759E,
-0xFF35769E,
-0xFF36779F,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA4,
-0xFF3879A3,
-0xFF3679A3,
-0xFF3679A3,
-0xFF3578A2,
-0xFF3679A3,
-0xFF387BA5,
-0xFF3A7DA7,
-0xFF3C7FA9,
-0xFF3C7FA9,
-0xFF3B7EA8,
-0xFF397EA8,
-0xFF357CA8,
-0xFF367FAC,
-0xFF3881AE,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3A84B1,
-0xFF3B85B4,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3C8CBD,
-0xFF3C8CBD,
-0xFF3C8CBD,
-0xFF3D8DBE,
-0xFF3F8DBE,
-0xFF408EBE,
-0xFF428EBF,
-0xFF428EBF,
-0xFF428EBF,
-0xFF428FBD,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4892BF,
-0xFF4993C0,
-0xFF4993C0,
-0xFF4A95BF,
-0xFF4B94BF,
-0xFF4B94BF,
-0xFF4C93BF,
-0xFF4D94C0,
-0xFF4E95BF,
-0xFF4F96C0,
-0xFF5297C1,
-0xFF5297C1,
-0xFF5398C1,
-0xFF5398BF,
-0xFF5499C2,
-0xFF5599C0,
-0xFF569AC1,
-0xFF5A9BC1,
-0xFF5B9CC4,
-0xFF5B9CC2,
-0xFF5C9DC3,
-0xFF5D9DC1,
-0xFF5D9DC1,
-0xFF5E9EC2,
-0xFF5E9EC2,
-0xFF5F9FC2,
-0xFF5F9FC2,
-0xFF5F9FC2,
-0xFF609FC2,
-0xFF609FC2,
-0xFF639FC3,
-0xFF61A0C3,
-0xFF64A0C4,
-0xFF62A1C4,
-0xFF65A1C5,
-0xFF65A1C5,
-0xFF66A2C4,
-0xFF67A3C5,
-0xFF67A3C5,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF6AA5C7,
-0xFF6AA5C7,
-0xFF6BA6C8,
-0xFF6BA6C8,
-0xFF6BA6C8,
-0xFF6BA6C8,
-0xFF6AA5C7,
-0xFF69A5C7,
-0xFF69A5C7,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF68A4C6,
-0xFF67A3C5,
-0xFF64A3C4,
-0xFF63A2C3,
-0xFF63A2C5,
-0xFF62A1C4,
-0xFF61A1C4,
-0xFF61A0C3,
-0xFF5F9FC2,
-0xFF5F9FC2,
-0xFF5F9FC2,
-0xFF5F9FC3,
-0xFF60A0C4,
-0xFF5F9FC3,
-0xFF5E9EC2,
-0xFF5E9EC2,
-0xFF5C9DC3,
-0xFF5C9DC3,
-0xFF599DC4,
-0xFF589BC5,
-0xFF579CC5,
-0xFF559AC3,
-0xFF5499C2,
-0xFF5398C1,
-0xFF5398C1,
-0xFF5398C1,
-0xFF5199C1,
-0xFF5097C1,
-0xFF4F97BF,
-0xFF4F96C0,
-0xFF4E96BE,
-0xFF4C95BE,
-0xFF4C96BD,
-0xFF4C95BE,
-0xFF4B94BD,
-0xFF4B96C0,
-0xFF4996C2,
-0xFF4A94C1,
-0xFF4794C0,
-0xFF4993C0,
-0xFF4693BF,
-0xFF4592BE,
-0xFF4491BD,
-0xFF428FBD,
-0xFF428FBD,
-0xFF428FBD,
-0xFF418FBD,
-0xFF408EBC,
-0xFF3F8DBB,
-0xFF3C8DBA,
-0xFF3B8CB9,
-0xFF3B8DBD,
-0xFF3B8DBD,
-0xFF3B8DBD,
-0xFF3A8CBC,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3987B8,
-0xFF3987B8,
-0xFF3987B7,
-0xFF3987B7,
-0xFF3886B6,
-0xFF3785B5,
-0xFF3785B5,
-0xFF3986B4,
-0xFF3B84AF,
-0xFF3A83AC,
-0xFF3882AF,
-0xFF3781AE,
-0xFF3781AE,
-0xFF3980AC,
-0xFF3B7EA9,
-0xFF3B7EA8,
-0xFF3B7BA7,
-0xFF3B7EA9,
-0xFF367AA7,
-0xFF387BA6,
-0xFF3A789D,
-0xFF3A6F8F,
-0xFF3C6980,
-0xFF98B5C5,
-0xFFF8FFFF,
-0xFFFFFFFF,
-0xFFFEFCFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFAFFFF,
-0xFFF7FFFF,
-0xFFEEFFFF,
-0xFF7D97A6,
-0xFF29495E,
-0xFF2B556E,
-0xFF2D5F80,
-0xFF346C8F,
-0xFF387091,
-0xFF397192,
-0xFF397194,
-0xFF387093,
-0xFF387297,
-0xFF377398,
-0xFF35739A,
-0xFF35739A,
-0xFF35749D,
-0xFF35759B,
-0xFF35759B,
-0xFF357599,
-0xFF37759A,
-0xFF36769A,
-0xFF36769C,
-0xFF36779F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF397AA4,
-0xFF3879A3,
-0xFF3679A3,
-0xFF3679A3,
-0xFF397CA6,
-0xFF397CA6,
-0xFF387BA5,
-0xFF377AA4,
-0xFF387BA5,
-0xFF3A7DA7,
-0xFF3A7DA7,
-0xFF3A7DA7,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3B82B0,
-0xFF3A83B0,
-0xFF3B84B1,
-0xFF3C85B2,
-0xFF3C85B2,
-0xFF3D86B3,
-0xFF3D85B5,
-0xFF3C86B5,
-0xFF3D87B6,
-0xFF3D87B6,
-0xFF3D87B6,
-0xFF3C89B7,
-0xFF3D8AB8,
-0xFF3D8AB8,
-0xFF3E8ABB,
-0xFF3E8BB9,
-0xFF408CBD,
-0xFF418EBC,
-0xFF438DBC,
-0xFF448EBD,
-0xFF468EBE,
-0xFF468FBC,
-0xFF468FBC,
-0xFF4790BD,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4A91BD,
-0xFF4992BD,
-0xFF4B92BE,
-0xFF4B94BF,
-0xFF4C93BF,
-0xFF4C93BD,
-0xFF4D94BE,
-0xFF4F94BE,
-0xFF4F94BE,
-0xFF5095BE,
-0xFF5196BF,
-0xFF5295BF,
-0xFF5396C0,
-0xFF5498BF,
-0xFF5596BC,
-0xFF5596BC,
-0xFF5596BC,
-0xFF5697BD,
-0xFF5898BC,
-0xFF5999BD,
-0xFF5B9BBF,
-0xFF5B9BBF,
-0xFF5C9BBE,
-0xFF5D9CBF,
-0xFF5D9CBF,
-0xFF5E9DC0,
-0xFF5F9EC1,
-0xFF5F9EBF,
-0xFF5F9EC1,
-0xFF5F9EBF,
-0xFF629EC2,
-0xFF639EC0,
-0xFF649EC3,
-0xFF65A0C2,
-0xFF66A0C5,
-0xFF67A2C4,
-0xFF67A2C4,
-0xFF68A3C5,
-0xFF68A3C5,
-0xFF68A3C3,
-0xFF69A4C6,
-0xFF69A4C4,
-0xFF6AA5C7,
-0xFF6AA5C5,
-0xFF6AA5C7,
-0xFF6BA6C6,
-0xFF6CA4C7,
-0xFF6DA5C6,
-0xFF6DA5C8,
-0xFF6BA6C6,
-0xFF6DA5C8,
-0xFF6BA6C6,
-0xFF6DA5C8,
-0xFF6BA6C6,
-0xFF6CA7C9,
-0xFF6BA6C6,
-0xFF6AA5C7,
-0xFF6AA5C5,
-0xFF6AA5C7,
-0xFF6AA5C5,
-0xFF69A4C6,
-0xFF67A2C2,
-0xFF66A2C4,
-0xFF66A2C4,
-0xFF65A1C3,
-0xFF64A0C2,
-0xFF639FC1,
-0xFF639FC1,
-0xFF609FC0,
-0xFF609FC2,
-0xFF5F9EC1,
-0xFF5F9EC1,
-0xFF5E9DC0,
-0xFF5E9DC0,
-0xFF5D9CBF,
-0xFF5C9ABF,
-0xFF5B9BBF,
-0xFF5A9AC0,
-0xFF5C9DC3,
-0xFF599DC4,
-0xFF579BC2,
-0xFF569AC1,
-0xFF5599C0,
-0xFF5498BF,
-0xFF5498BF,
-0xFF5398BF,
-0xFF5398BF,
-0xFF5297BE,
-0xFF5196BD,
-0xFF5095BC,
-0xFF4F94BB,
-0xFF4C94BA,
-0xFF4C94BA,
-0xFF4C94BC,
-0xFF4A93BC,
-0xFF4994BE,
-0xFF4992BD,
-0xFF4992BD,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4790BB,
-0xFF468FBA,
-0xFF4790BB,
-0xFF4691BB,
-0xFF4690BD,
-0xFF458FBC,
-0xFF438DBA,
-0xFF428CB9,
-0xFF3F8CB8,
-0xFF3F8CB8,
-0xFF3D8BB9,
-0xFF3D8BB9,
-0xFF3C8ABA,
-0xFF3C8AB8,
-0xFF3C88B9,
-0xFF3C89B7,
-0xFF3D87B6,
-0xFF3D87B6,
-0xFF3E88B7,
-0xFF3E88B7,
-0xFF3D87B6,
-0xFF3D87B4,
-0xFF3B85B4,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3B84AF,
-0xFF3E83AC,
-0xFF3F83AA,
-0xFF3B82AC,
-0xFF3982AD,
-0xFF3A81AD,
-0xFF3C81AB,
-0xFF3E7FA7,
-0xFF3E7EA4,
-0xFF3E7EA4,
-0xFF3C7DA5,
-0xFF3C7DA7,
-0xFF407FA8,
-0xFF387093,
-0xFF3B6A86,
-0xFF375A6E,
-0xFFEEFFFF,
-0xFFF7FCFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDFCFA,
-0xFFFEFFFF,
-0xFFF8FFFF,
-0xFFF1FFFF,
-0xFFD6EDFB,
-0xFF204055,
-0xFF274F69,
-0xFF22516F,
-0xFF366B8D,
-0xFF3A7295,
-0xFF397194,
-0xFF387093,
-0xFF397196,
-0xFF397196,
-0xFF387298,
-0xFF357196,
-0xFF35739A,
-0xFF35739A,
-0xFF34749A,
-0xFF35759B,
-0xFF36749B,
-0xFF37759A,
-0xFF37759A,
-0xFF36769A,
-0xFF37779D,
-0xFF36779F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF3477A1,
-0xFF387BA5,
-0xFF3D7EA6,
-0xFF3C7DA5,
-0xFF3B7CA4,
-0xFF3B7CA4,
-0xFF3E7FA7,
-0xFF3F80A8,
-0xFF3C7FA9,
-0xFF3C7FA9,
-0xFF3C7FA9,
-0xFF3E81AB,
-0xFF4083AD,
-0xFF4285AF,
-0xFF4386B0,
-0xFF4386B0,
-0xFF4687B1,
-0xFF4487B1,
-0xFF4588B2,
-0xFF4689B3,
-0xFF4689B3,
-0xFF478AB4,
-0xFF478AB5,
-0xFF478AB5,
-0xFF478AB5,
-0xFF478CB6,
-0xFF478CB6,
-0xFF478CB6,
-0xFF488DB7,
-0xFF478EB8,
-0xFF478EBA,
-0xFF478EB8,
-0xFF4990BC,
-0xFF4A91BB,
-0xFF4C91BB,
-0xFF4D92BC,
-0xFF4F92BD,
-0xFF4F92BC,
-0xFF5093BD,
-0xFF5093BD,
-0xFF5296BD,
-0xFF5296BD,
-0xFF5495BD,
-0xFF5397BE,
-0xFF5596BE,
-0xFF5498BF,
-0xFF5697BF,
-0xFF5697BD,
-0xFF5798BE,
-0xFF5898BE,
-0xFF5999BF,
-0xFF5999BF,
-0xFF5A9AC0,
-0xFF5B99BE,
-0xFF5C9ABF,
-0xFF5C9ABF,
-0xFF619DC1,
-0xFF619DC1,
-0xFF619DC1,
-0xFF619DC1,
-0xFF639DC2,
-0xFF649EC3,
-0xFF66A1C3,
-0xFF66A1C3,
-0xFF66A1C3,
-0xFF66A1C3,
-0xFF67A2C4,
-0xFF68A3C5,
-0xFF68A3C5,
-0xFF68A3C3,
-0xFF68A3C5,
-0xFF69A4C4,
-0xFF6BA3C6,
-0xFF6CA4C5,
-0xFF6CA4C7,
-0xFF6DA5C6,
-0xFF6EA6C9,
-0xFF6FA7C8,
-0xFF6FA7C8,
-0xFF6FA7C8,
-0xFF70A8C9,
-0xFF70A9C7,
-0xFF71A9CA,
-0xFF71AAC8,
-0xFF71A9CA,
-0xFF71AAC8,
-0xFF72AACB,
-0xFF73ACCA,
-0xFF72A8CA,
-0xFF72A9C8,
-0xFF73A9CB,
-0xFF72ABC9,
-0xFF73A9CB,
-0xFF72ABC9,
-0xFF73A9CB,
-0xFF72ABC9,
-0xFF74ACCD,
-0xFF72ABC9,
-0xFF71A9CA,
-0xFF71AAC8,
-0xFF72AACB,
-0xFF72ABC9,
-0xFF70A8C9,
-0xFF6FA8C6,
-0xFF6FA7C8,
-0xFF6FA7C8,
-0xFF6EA6C7,
-0xFF6DA5C6,
-0xFF6DA5C6,
-0xFF6CA4C5,
-0xFF6AA5C5,
-0xFF6AA5C7,
-0xFF69A4C6,
-0xFF68A3C5,
-0xFF68A3C5,
-0xFF68A3C5,
-0xFF67A2C4,
-0xFF67A1C6,
-0xFF66A0C5,
-0xFF65A1C5,
-0xFF62A1C4,
-0xFF61A0C3,
-0xFF609FC2,
-0xFF5F9EC1,
-0xFF5E9DC0,
-0xFF5C9CBF,
-0xFF5C9CC0,
-0xFF5C9CC0,
-0xFF5C9CC0,
-0xFF5B9BBF,
-0xFF5A9ABE,
-0xFF599BBE,
-0xFF589ABD,
-0xFF5799BC,
-0xFF5799BC,
-0xFF5599BE,
-0xFF5498BF,
-0xFF5297BE,
-0xFF5397BE,
-0xFF5296BD,
-0xFF5296BD,
-0xFF5296BD,
-0xFF5195BC,
-0xFF5094BB,
-0xFF4E92B9,
-0xFF4E92B9,
-0xFF4E91BB,
-0xFF4C91BA,
-0xFF4B90B9,
-0xFF4A8FB8,
-0xFF498EB7,
-0xFF498EB8,
-0xFF468DB7,
-0xFF458CB6,
-0xFF458CB8,
-0xFF458CB6,
-0xFF468AB7,
-0xFF468BB5,
-0xFF468BB5,
-0xFF468BB5,
-0xFF4388B2,
-0xFF4388B2,
-0xFF4388B2,
-0xFF4287B0,
-0xFF4186B0,
-0xFF4186AF,
-0xFF4186AF,
-0xFF4286AD,
-0xFF4583A8,
-0xFF4482A7,
-0xFF4283AB,
-0xFF4083AD,
-0xFF4182AA,
-0xFF4282A8,
-0xFF4480A4,
-0xFF4580A2,
-0xFF437FA3,
-0xFF407EA3,
-0xFF417FA6,
-0xFF3B779C,
-0xFF356788,
-0xFF3F6780,
-0xFF678190,
-0xFFF4FFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFDFDFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFDFFFC,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFBFDFC,
-0xFFF8FFFF,
-0xFFF2FFFF,
-0xFF4B6677,
-0xFF294F66,
-0xFF245371,
-0xFF366B8D,
-0xFF397194,
-0xFF3B7396,
-0xFF376F92,
-0xFF376F92,
-0xFF3A7297,
-0xFF377196,
-0xFF387298,
-0xFF357196,
-0xFF377398,
-0xFF357398,
-0xFF35739A,
-0xFF367499,
-0xFF367499,
-0xFF37759A,
-0xFF36769A,
-0xFF36769A,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A2,
-0xFF3879A3,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3C7DA5,
-0xFF4081A9,
-0xFF4181A7,
-0xFF3F7FA5,
-0xFF3F7DA2,
-0xFF3B799E,
-0xFF357398,
-0xFF306E93,
-0xFF2A688D,
-0xFF246287,
-0xFF225E83,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF205C81,
-0xFF1F5D82,
-0xFF1F5D82,
-0xFF1F5D82,
-0xFF1F5D84,
-0xFF1F5F85,
-0xFF1F5F85,
-0xFF1F5F85,
-0xFF1E5E84,
-0xFF1E5E82,
-0xFF1F5D82,
-0xFF205E83,
-0xFF225E83,
-0xFF235F83,
-0xFF235F83,
-0xFF235F83,
-0xFF246084,
-0xFF246084,
-0xFF246084,
-0xFF246084,
-0xFF246084,
-0xFF246084,
-0xFF256183,
-0xFF256183,
-0xFF266183,
-0xFF266183,
-0xFF266183,
-0xFF266183,
-0xFF296182,
-0xFF296182,
-0xFF2A6082,
-0xFF2A6082,
-0xFF286081,
-0xFF286081,
-0xFF286081,
-0xFF286081,
-0xFF2A6082,
-0xFF2B6183,
-0xFF2B6183,
-0xFF2C6382,
-0xFF2B6183,
-0xFF2B6281,
-0xFF2C6284,
-0xFF2C6382,
-0xFF2C6284,
-0xFF2C6382,
-0xFF2D6385,
-0xFF2D6483,
-0xFF2E6385,
-0xFF2E6383,
-0xFF2E6385,
-0xFF2E6383,
-0xFF2E6385,
-0xFF2E6383,
-0xFF2E6383,
-0xFF2E6382,
-0xFF2F6484,
-0xFF2F6483,
-0xFF306585,
-0xFF306584,
-0xFF306585,
-0xFF306584,
-0xFF306585,
-0xFF316685,
-0xFF306585,
-0xFF306584,
-0xFF316686,
-0xFF316685,
-0xFF316686,
-0xFF316685,
-0xFF316686,
-0xFF306785,
-0xFF316686,
-0xFF306785,
-0xFF306585,
-0xFF2F6684,
-0xFF316686,
-0xFF316886,
-0xFF326787,
-0xFF316685,
-0xFF326787,
-0xFF326786,
-0xFF316686,
-0xFF316685,
-0xFF316686,
-0xFF316686,
-0xFF306786,
-0xFF306786,
-0xFF316887,
-0xFF306786,
-0xFF306688,
-0xFF306688,
-0xFF306688,
-0xFF2F6587,
-0xFF2F6587,
-0xFF2F6587,
-0xFF306889,
-0xFF306889,
-0xFF306889,
-0xFF306889,
-0xFF306889,
-0xFF306889,
-0xFF2E698B,
-0xFF2E698B,
-0xFF2E698B,
-0xFF2D688A,
-0xFF2D688A,
-0xFF2D688A,
-0xFF2C688A,
-0xFF2C688A,
-0xFF2C688A,
-0xFF2C688A,
-0xFF2B6A8D,
-0xFF2B6A8D,
-0xFF2A698C,
-0xFF2B6A8D,
-0xFF2D698D,
-0xFF2D698D,
-0xFF2C688C,
-0xFF2C688C,
-0xFF2D698D,
-0xFF2D698D,
-0xFF2D698D,
-0xFF2B6A8D,
-0xFF2B698E,
-0xFF2B698E,
-0xFF2B698E,
-0xFF2B698E,
-0xFF2C6A91,
-0xFF2B6B91,
-0xFF2C6A91,
-0xFF2C6A91,
-0xFF2C6A91,
-0xFF2C6A8F,
-0xFF2C6A8F,
-0xFF2C6A8F,
-0xFF2C6A8F,
-0xFF2D6B90,
-0xFF2D6B90,
-0xFF2D6B90,
-0xFF2C6A8F,
-0xFF2C6B8E,
-0xFF2D6C8F,
-0xFF2F6B8D,
-0xFF31698A,
-0xFF31698A,
-0xFF2E6A8F,
-0xFF2B6B8F,
-0xFF2C6A8F,
-0xFF2E6A8C,
-0xFF306987,
-0xFF316886,
-0xFF306987,
-0xFF336B8C,
-0xFF326C91,
-0xFF2F6587,
-0xFF3A6784,
-0xFF2D4D62,
-0xFFD0E2EE,
-0xFFF8FFFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFBFCFE,
-0xFFF8FFFF,
-0xFFBDD1DC,
-0xFF1D3C50,
-0xFF305975,
-0xFF2A5F81,
-0xFF346E93,
-0xFF356F94,
-0xFF377196,
-0xFF336D92,
-0xFF356F94,
-0xFF387297,
-0xFF367095,
-0xFF377196,
-0xFF387297,
-0xFF387297,
-0xFF387297,
-0xFF377398,
-0xFF357398,
-0xFF367499,
-0xFF36769C,
-0xFF35769E,
-0xFF34759D,
-0xFF36779F,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A2,
-0xFF3879A3,
-0xFF397AA4,
-0xFF397AA4,
-0xFF3778A0,
-0xFF3A7BA3,
-0xFF3C7DA5,
-0xFF3D7EA6,
-0xFF3D7DA3,
-0xFF36769C,
-0xFF2A688F,
-0xFF205C81,
-0xFF1F577A,
-0xFF1F5577,
-0xFF1E5476,
-0xFF1E5476,
-0xFF1F5675,
-0xFF1F5675,
-0xFF205776,
-0xFF215877,
-0xFF205575,
-0xFF215676,
-0xFF215676,
-0xFF205575,
-0xFF1F5474,
-0xFF1F5474,
-0xFF1F5474,
-0xFF205575,
-0xFF1F5473,
-0xFF205574,
-0xFF215675,
-0xFF205574,
-0xFF1F5474,
-0xFF1F5675,
-0xFF205776,
-0xFF1F5675,
-0xFF1F5675,
-0xFF1F5675,
-0xFF205575,
-0xFF205574,
-0xFF225574,
-0xFF225574,
-0xFF225574,
-0xFF225574,
-0xFF205574,
-0xFF1F5474,
-0xFF1F5474,
-0xFF1F5474,
-0xFF1F5473,
-0xFF1F5473,
-0xFF1F5473,
-0xFF1F5473,
-0xFF1E5372,
-0xFF1F5473,
-0xFF215471,
-0xFF215471,
-0xFF225371,
-0xFF225371,
-0xFF225371,
-0xFF215270,
-0xFF215473,
-0xFF1F5474,
-0xFF215374,
-0xFF225475,
-0xFF225475,
-0xFF225475,
-0xFF225475,
-0xFF225574,
-0xFF225475,
-0xFF225574,
-0xFF225475,
-0xFF225574,
-0xFF225475,
-0xFF225574,
-0xFF205575,
-0xFF215675,
-0xFF245677,
-0xFF245776,
-0xFF245677,
-0xFF235675,
-0xFF235576,
-0xFF235675,
-0xFF235675,
-0xFF235673,
-0xFF235675,
-0xFF245774,
-0xFF245776,
-0xFF245774,
-0xFF235675,
-0xFF235673,
-0xFF245776,
-0xFF245774,
-0xFF255877,
-0xFF255875,
-0xFF255877,
-0xFF255875,
-0xFF255877,
-0xFF255875,
-0xFF255877,
-0xFF235975,
-0xFF255877,
-0xFF235975,
-0xFF255877,
-0xFF235975,
-0xFF255877,
-0xFF245A76,
-0xFF275A79,
-0xFF275A77,
-0xFF285979,
-0xFF285977,
-0xFF285979,
-0xFF285977,
-0xFF275A79,
-0xFF285B7A,
-0xFF285B7A,
-0xFF285B7A,
-0xFF285B7A,
-0xFF275A79,
-0xFF27597A,
-0xFF285A7B,
-0xFF265B7B,
-0xFF255A7A,
-0xFF255A7A,
-0xFF285A7B,
-0xFF295A7A,
-0xFF295A7A,
-0xFF295A7A,
-0xFF2A5B7B,
-0xFF295C7B,
-0xFF295C7B,
-0xFF295C7B,
-0xFF295C7B,
-0xFF285D7C,
-0xFF285D7C,
-0xFF285D7C,
-0xFF285D7C,
-0xFF285D7C,
-0xFF285D7C,
-0xFF295E7D,
-0xFF295E7D,
-0xFF275E7C,
-0xFF275E7C,
-0xFF285D7C,
-0xFF295E7D,
-0xFF2A5F7E,
-0xFF2A5F7E,
-0xFF2C5E7F,
-0xFF2B5D7E,
-0xFF2B5D7E,
-0xFF2B5D7E,
-0xFF2B5D7E,
-0xFF295E7E,
-0xFF2A5F7F,
-0xFF2A5F7F,
-0xFF2B6080,
-0xFF2B6080,
-0xFF2A5F7F,
-0xFF29607F,
-0xFF2A5F7F,
-0xFF2A5F7F,
-0xFF2A5F7F,
-0xFF2B6080,
-0xFF2B6080,
-0xFF2B607F,
-0xFF2A5F7E,
-0xFF2A5F7E,
-0xFF2B607F,
-0xFF2B607F,
-0xFF2B607F,
-0xFF2A617F,
-0xFF2B6280,
-0xFF2C627E,
-0xFF2F607E,
-0xFF2E617E,
-0xFF2B6384,
-0xFF296486,
-0xFF296486,
-0xFF2B6482,
-0xFF2C627E,
-0xFF2E617C,
-0xFF2D637F,
-0xFF2B607F,
-0xFF2B6183,
-0xFF2F6281,
-0xFF335B75,
-0xFF415C6F,
-0xFFF5FFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFEFCFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFEFB,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFF4FFFF,
-0xFF46606F,
-0xFF30546C,
-0xFF275674,
-0xFF346A8E,
-0xFF387297,
-0xFF346E93,
-0xFF367095,
-0xFF346E93,
-0xFF377196,
-0xFF387297,
-0xFF346E93,
-0xFF367095,
-0xFF397398,
-0xFF387298,
-0xFF377397,
-0xFF377397,
-0xFF357398,
-0xFF36749B,
-0xFF36759E,
-0xFF3576A0,
-0xFF34759F,
-0xFF3576A0,
-0xFF36779F,
-0xFF3778A0,
-0xFF367AA1,
-0xFF367AA1,
-0xFF367AA1,
-0xFF3879A1,
-0xFF3A7AA0,
-0xFF3D7DA3,
-0xFF3D7BA0,
-0xFF367499,
-0xFF28668B,
-0xFF1E5A7E,
-0xFF1B557A,
-0xFF1F577A,
-0xFF265879,
-0xFF27556F,
-0xFF275169,
-0xFF264E67,
-0xFF234B64,
-0xFF20495F,
-0xFF1D465C,
-0xFF1C455B,
-0xFF1F455C,
-0xFF20465D,
-0xFF21455B,
-0xFF21455D,
-0xFF21455D,
-0xFF20445C,
-0xFF1F455C,
-0xFF21455D,
-0xFF21455B,
-0xFF20445A,
-0xFF22465C,
-0xFF22465C,
-0xFF21455B,
-0xFF20445A,
-0xFF21455B,
-0xFF20465D,
-0xFF20465B,
-0xFF20465D,
-0xFF20465B,
-0xFF21455B,
-0xFF20445A,
-0xFF20445A,
-0xFF21445A,
-0xFF214458,
-0xFF214458,
-0xFF20445A,
-0xFF20445A,
-0xFF20445C,
-0xFF1F4359,
-0xFF1F4359,
-0xFF1F4359,
-0xFF1F4359,
-0xFF1F4359,
-0xFF1F4359,
-0xFF1F4359,
-0xFF1F4457,
-0xFF204357,
-0xFF204357,
-0xFF204357,
-0xFF1F4256,
-0xFF1F4258,
-0xFF1F435B,
-0xFF1E445B,
-0xFF1F435B,
-0xFF1F435B,
-0xFF1F435B,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1F435B,
-0xFF1F435B,
-0xFF1F435B,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E445B,
-0xFF1E445B,
-0xFF1D4159,
-0xFF1D4159,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E425A,
-0xFF1E4258,
-0xFF1F435B,
-0xFF1F4359,
-0xFF1F435B,
-0xFF1F4359,
-0xFF1F435B,
-0xFF1F4359,
-0xFF1F435B,
-0xFF1F4359,
-0xFF1E425A,
-0xFF1E4258,
-0xFF1E425A,
-0xFF1E4258,
-0xFF1E425A,
-0xFF1F4359,
-0xFF1E445B,
-0xFF1E4459,
-0xFF1E445B,
-0xFF1E4459,
-0xFF1E445B,
-0xFF1E4459,
-0xFF1E445B,
-0xFF1E4459,
-0xFF1F455C,
-0xFF1F455A,
-0xFF1E425A,
-0xFF1E4258,
-0xFF20425B,
-0xFF1F4359,
-0xFF20445C,
-0xFF20445A,
-0xFF21455D,
-0xFF21455D,
-0xFF21455D,
-0xFF20445C,
-0xFF20445C,
-0xFF22465E,
-0xFF21475E,
-0xFF20465D,
-0xFF20455F,
-0xFF224660,
-0xFF22445D,
-0xFF23465C,
-0xFF23455E,
-0xFF23465C,
-0xFF23455E,
-0xFF22465C,
-0xFF23455E,
-0xFF21455B,
-0xFF23475F,
-0xFF23475D,
-0xFF23475F,
-0xFF23475D,
-0xFF23475F,
-0xFF23475D,
-0xFF23475F,
-0xFF23475D,
-0xFF22485D,
-0xFF22485D,
-0xFF23475D,
-0xFF24485E,
-0xFF25495F,
-0xFF264A60,
-0xFF264A60,
-0xFF264A60,
-0xFF254760,
-0xFF24485E,
-0xFF254760,
-0xFF24485E,
-0xFF254961,
-0xFF25495F,
-0xFF264A62,
-0xFF264A60,
-0xFF254961,
-0xFF25495F,
-0xFF254961,
-0xFF25495F,
-0xFF254961,
-0xFF264A60,
-0xFF264A60,
-0xFF274B61,
-0xFF274B61,
-0xFF274B61,
-0xFF274B61,
-0xFF274B61,
-0xFF274B61,
-0xFF274B61,
-0xFF264C5F,
-0xFF284D60,
-0xFF284B5F,
-0xFF274B61,
-0xFF254D66,
-0xFF244E66,
-0xFF244E66,
-0xFF244E64,
-0xFF274D60,
-0xFF284D5F,
-0xFF264C5F,
-0xFF284E63,
-0xFF285167,
-0xFF264A60,
-0xFF2C495B,
-0xFFBDCFDB,
-0xFFF9FFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFDFE,
-0xFFFEFFFF,
-0xFFF5FFFF,
-0xFFBED8E7,
-0xFF22465E,
-0xFF2A5577,
-0xFF306084,
-0xFF366B8D,
-0xFF396F91,
-0xFF376F90,
-0xFF376F92,
-0xFF387093,
-0xFF397194,
-0xFF397196,
-0xFF367095,
-0xFF367297,
-0xFF357398,
-0xFF35739A,
-0xFF357599,
-0xFF37779B,
-0xFF37759A,
-0xFF35739A,
-0xFF36749D,
-0xFF3776A1,
-0xFF34739E,
-0xFF3978A3,
-0xFF3778A2,
-0xFF33779E,
-0xFF357AA1,
-0xFF327B9E,
-0xFF377D9F,
-0xFF387A9D,
-0xFF3E7DA0,
-0xFF346F91,
-0xFF21597A,
-0xFF235A79,
-0xFF245979,
-0xFF235675,
-0xFF275674,
-0xFF224B69,
-0xFF21455F,
-0xFF324D5E,
-0xFF506673,
-0xFF798C9A,
-0xFF9BAFBA,
-0xFFB4C6D0,
-0xFFC6D8E2,
-0xFFD6E7EF,
-0xFFE2F0F9,
-0xFFE1EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE1EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE4EEF7,
-0xFFE4EEF7,
-0xFFE4EEF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE4EEF7,
-0xFFE4EEF7,
-0xFFE4EEF7,
-0xFFE4EEF7,
-0xFFE4EEF7,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE4EEF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE2EFF8,
-0xFFE4EEF8,
-0xFFE4EEF7,
-0xFFE4EEF8,
-0xFFE4EEF7,
-0xFFE4EEF8,
-0xFFE2EFF7,
-0xFFE4EEF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE3F0F8,
-0xFFE3F0F8,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE4EEF8,
-0xFFE2EFF7,
-0xFFE4EEF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF8,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE4EFF5,
-0xFFE2EFF7,
-0xFFE2EFF7,
-0xFFE1F0F7,
-0xFFE1F0F7,
-0xFFE1F0F7,
-0xFFE2EFF5,
-0xFFE2EFF5,
-0xFFE2EFF5,
-0xFFE1EEF6,
-0xFFE2EFF7,
-0xFFE7F4FC,
-0xFFF2FBFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFFFE,
-0xFFFBFFFC,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFF2FFFF,
-0xFF5B7E92,
-0xFF24516E,
-0xFF28587C,
-0xFF3A6B93,
-0xFF3B7092,
-0xFF356C8B,
-0xFF376F90,
-0xFF376F90,
-0xFF386E92,
-0xFF397194,
-0xFF397196,
-0xFF367095,
-0xFF367297,
-0xFF35739A,
-0xFF34749A,
-0xFF337397,
-0xFF347498,
-0xFF357398,
-0xFF347299,
-0xFF36749B,
-0xFF3875A1,
-0xFF36739F,
-0xFF37769F,
-0xFF33749C,
-0xFF377BA2,
-0xFF34789D,
-0xFF367A9F,
-0xFF3B7DA0,
-0xFF327192,
-0xFF215C7C,
-0xFF235A78,
-0xFF2A5C77,
-0xFF29576F,
-0xFF244C65,
-0xFF26495F,
-0xFF4C6B80,
-0xFF95B0C5,
-0xFFCEE3F4,
-0xFFF4FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFBFFFE,
-0xFFFAFFFE,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFE6F8FF,
-0xFF234C62,
-0xFF275A79,
-0xFF2B5D80,
-0xFF3B6D92,
-0xFF386D8F,
-0xFF396F91,
-0xFF366E91,
-0xFF366E91,
-0xFF376F94,
-0xFF387095,
-0xFF387095,
-0xFF367095,
-0xFF357196,
-0xFF367297,
-0xFF367499,
-0xFF347396,
-0xFF357497,
-0xFF387498,
-0xFF377398,
-0xFF38739B,
-0xFF38769F,
-0xFF36759E,
-0xFF35779A,
-0xFF387A9D,
-0xFF3A789D,
-0xFF417CA4,
-0xFF386F98,
-0xFF265D84,
-0xFF266183,
-0xFF245D7A,
-0xFF235971,
-0xFF1F4E60,
-0xFF395A6B,
-0xFF99AFBD,
-0xFFEBF7FF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF7FEFF,
-0xFFF9FEFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFCFCFC,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFDFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFA,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFF8FFFF,
-0xFF90A7B5,
-0xFF24546B,
-0xFF27607E,
-0xFF356A8C,
-0xFF396B90,
-0xFF346A8C,
-0xFF396F91,
-0xFF366E91,
-0xFF376F92,
-0xFF376F94,
-0xFF367095,
-0xFF367095,
-0xFF367095,
-0xFF377196,
-0xFF377196,
-0xFF397398,
-0xFF377196,
-0xFF387297,
-0xFF3A769A,
-0xFF387499,
-0xFF387499,
-0xFF37759C,
-0xFF36769C,
-0xFF37779B,
-0xFF357598,
-0xFF3F799E,
-0xFF31678D,
-0xFF295B80,
-0xFF2F5F83,
-0xFF215270,
-0xFF204E66,
-0xFF3E6878,
-0xFFB3D3DE,
-0xFFF0FFFF,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFEFCFF,
-0xFFFDFDFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF8FFFA,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF4FFFF,
-0xFF3A5769,
-0xFF275D77,
-0xFF246382,
-0xFF376D91,
-0xFF366A8F,
-0xFF386E92,
-0xFF356D90,
-0xFF376F94,
-0xFF376F94,
-0xFF367096,
-0xFF357196,
-0xFF357195,
-0xFF377196,
-0xFF377196,
-0xFF397194,
-0xFF3A7295,
-0xFF387093,
-0xFF3A7297,
-0xFF3A7499,
-0xFF377398,
-0xFF377398,
-0xFF37759A,
-0xFF38769B,
-0xFF38769D,
-0xFF3C789D,
-0xFF296186,
-0xFF2A5F7F,
-0xFF2B5D78,
-0xFF29566D,
-0xFF385B6E,
-0xFFAFC9D6,
-0xFFF0FEFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFAFAF8,
-0xFFFFFEFA,
-0xFFFFFEFB,
-0xFFFFFBF8,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFEFD,
-0xFFFDFDFD,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFAFFFE,
-0xFFF7FFFC,
-0xFFFBFFFD,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFBFD1E5,
-0xFF294E68,
-0xFF2A637E,
-0xFF2A6988,
-0xFF336B8E,
-0xFF366C90,
-0xFF356B8F,
-0xFF376F92,
-0xFF376F94,
-0xFF376F94,
-0xFF367096,
-0xFF357196,
-0xFF357195,
-0xFF377397,
-0xFF387395,
-0xFF397194,
-0xFF3B7195,
-0xFF3A7096,
-0xFF3A7297,
-0xFF387298,
-0xFF377398,
-0xFF37759A,
-0xFF38789B,
-0xFF38769B,
-0xFF37729A,
-0xFF276187,
-0xFF2C6284,
-0xFF2C5E77,
-0xFF224B5F,
-0xFF6C8C99,
-0xFFF1FFFF,
-0xFFF7FEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFFDFDFB,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFBF8,
-0xFFFFFDFA,
-0xFFFEFEFE,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFDFDFD,
-0xFFFDFDFD,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFBFFFC,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFEFEFE,
-0xFFF5FCFF,
-0xFF58768E,
-0xFF2F5E7C,
-0xFF2D6684,
-0xFF326F8E,
-0xFF326C91,
-0xFF366E93,
-0xFF33698D,
-0xFF386E92,
-0xFF376D93,
-0xFF376F94,
-0xFF356F95,
-0xFF347095,
-0xFF337196,
-0xFF377397,
-0xFF377294,
-0xFF387093,
-0xFF3C7298,
-0xFF3C7298,
-0xFF3B729B,
-0xFF38729A,
-0xFF35739A,
-0xFF37779B,
-0xFF367699,
-0xFF317195,
-0xFF28668F,
-0xFF276187,
-0xFF2A5D7A,
-0xFF2B5466,
-0xFFBAD2DE,
-0xFFF7FFFF,
-0xFFFEFCFD,
-0xFFFFFBFB,
-0xFFFFFDFC,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFAFEFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFDFDFD,
-0xFFFEFDFB,
-0xFFFFFEFC,
-0xFFFFFEFC,
-0xFFFFFEFC,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF7FBFC,
-0xFFE9F7FF,
-0xFF29506D,
-0xFF2F6388,
-0xFF2D6385,
-0xFF366E8F,
-0xFF306A8F,
-0xFF326C91,
-0xFF397194,
-0xFF396F91,
-0xFF376D91,
-0xFF376F94,
-0xFF356F95,
-0xFF347095,
-0xFF337196,
-0xFF367296,
-0xFF397196,
-0xFF396F93,
-0xFF3A7096,
-0xFF3B7098,
-0xFF39729D,
-0xFF35739C,
-0xFF34739C,
-0xFF36769A,
-0xFF327194,
-0xFF286788,
-0xFF296486,
-0xFF2B5E7D,
-0xFF345D73,
-0xFFDEFAFF,
-0xFFF7FFFF,
-0xFFFEFCFD,
-0xFFFFFDFA,
-0xFFFFFCFA,
-0xFFFFFEFB,
-0xFFFDFFFE,
-0xFFF8FDFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFDFF,
-0xFFFCFEFD,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFF9FCFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFF88A3AE,
-0xFF2F5E7C,
-0xFF2D648B,
-0xFF37698E,
-0xFF3A6C8F,
-0xFF356D92,
-0xFF326C91,
-0xFF346C8F,
-0xFF376D8F,
-0xFF386D8F,
-0xFF376D91,
-0xFF356F94,
-0xFF347095,
-0xFF357196,
-0xFF367296,
-0xFF397196,
-0xFF3A7094,
-0xFF3A7096,
-0xFF356F97,
-0xFF35729E,
-0xFF35749F,
-0xFF33749C,
-0xFF36769A,
-0xFF2B6789,
-0xFF2C6582,
-0xFF2E6077,
-0xFF41677A,
-0xFFEDFFFF,
-0xFFF7FFFF,
-0xFFFDFCFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFEFEFF,
-0xFFF8FFFF,
-0xFFEEFFFF,
-0xFF375B6B,
-0xFF2D6282,
-0xFF2D678D,
-0xFF386890,
-0xFF3A6A90,
-0xFF356B8F,
-0xFF326D8F,
-0xFF346C8F,
-0xFF376D8F,
-0xFF386D8F,
-0xFF376D8F,
-0xFF356F94,
-0xFF347095,
-0xFF357196,
-0xFF377197,
-0xFF397196,
-0xFF3A7094,
-0xFF3C739A,
-0xFF3C779F,
-0xFF35749F,
-0xFF33749E,
-0xFF33749C,
-0xFF2C6A8F,
-0xFF2A6381,
-0xFF306077,
-0xFF416774,
-0xFFEDFFFF,
-0xFFF4FFFF,
-0xFFFAFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDFFFC,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFBF9,
-0xFFFFFFFD,
-0xFFFDFBFE,
-0xFFFFFEFF,
-0xFFFBFAFF,
-0xFFF4FEFF,
-0xFFAECEDB,
-0xFF2A596D,
-0xFF306987,
-0xFF326A8F,
-0xFF386890,
-0xFF3B6891,
-0xFF366B8D,
-0xFF346C8D,
-0xFF366C90,
-0xFF376D8F,
-0xFF386D8D,
-0xFF386D8F,
-0xFF376F94,
-0xFF367096,
-0xFF367098,
-0xFF377197,
-0xFF397196,
-0xFF397194,
-0xFF326C92,
-0xFF347299,
-0xFF30719B,
-0xFF3477A1,
-0xFF2C6C92,
-0xFF31698C,
-0xFF346583,
-0xFF395C70,
-0xFFF3FFFF,
-0xFFFAFFFF,
-0xFFF8FFFF,
-0xFFF6FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFCFE,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFCFCFF,
-0xFFF4FFFF,
-0xFF557E92,
-0xFF306881,
-0xFF316C8A,
-0xFF346A8E,
-0xFF386890,
-0xFF3B6891,
-0xFF366B8D,
-0xFF356C8B,
-0xFF366C8E,
-0xFF386D8F,
-0xFF376C8C,
-0xFF386D8D,
-0xFF376F94,
-0xFF367096,
-0xFF377199,
-0xFF397097,
-0xFF3A7096,
-0xFF387093,
-0xFF3A769A,
-0xFF37779B,
-0xFF32769D,
-0xFF2E6F97,
-0xFF2E6A8E,
-0xFF336685,
-0xFF2A4F69,
-0xFFDCF3FF,
-0xFFFBFFFF,
-0xFFFEFDF9,
-0xFFF8FDF9,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFDFF,
-0xFFFCFFFF,
-0xFFF8FEFF,
-0xFFD9EEFF,
-0xFF295B74,
-0xFF2A6A86,
-0xFF316C8C,
-0xFF346A8C,
-0xFF386890,
-0xFF396991,
-0xFF376C8C,
-0xFF366D8C,
-0xFF376C8E,
-0xFF376C8E,
-0xFF376C8C,
-0xFF376E8D,
-0xFF376F94,
-0xFF367098,
-0xFF396F9B,
-0xFF397099,
-0xFF396F95,
-0xFF387093,
-0xFF317091,
-0xFF327496,
-0xFF307499,
-0xFF2F6F93,
-0xFF316887,
-0xFF2A546D,
-0xFFADC8DB,
-0xFFF2FFFF,
-0xFFFAFFFF,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFF8F8F8,
-0xFFFEFFFF,
-0xFFFAFAFC,
-0xFFFFFFFF,
-0xFFFEFCFD,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFCFCFE,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF81A0B4,
-0xFF2C6381,
-0xFF337396,
-0xFF316C8C,
-0xFF356A8C,
-0xFF37698E,
-0xFF386A8F,
-0xFF366D8C,
-0xFF366D8C,
-0xFF376C8E,
-0xFF376C8E,
-0xFF376C8C,
-0xFF376D8F,
-0xFF376E95,
-0xFF367098,
-0xFF386E9A,
-0xFF386F98,
-0xFF3A7096,
-0xFF387093,
-0xFF347394,
-0xFF357797,
-0xFF2B6F92,
-0xFF317091,
-0xFF316280,
-0xFF688BA1,
-0xFFF1FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFAFCF9,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFCFA,
-0xFFFFFFFF,
-0xFFF9FEFF,
-0xFFECFFFF,
-0xFF395F74,
-0xFF336E8E,
-0xFF2E7093,
-0xFF306B8D,
-0xFF356A8C,
-0xFF37698C,
-0xFF366B8D,
-0xFF346C8D,
-0xFF346C8D,
-0xFF376B90,
-0xFF376C8E,
-0xFF386D8D,
-0xFF376D8F,
-0xFF376E95,
-0xFF356E99,
-0xFF386E9A,
-0xFF396E98,
-0xFF3B6F94,
-0xFF397192,
-0xFF2F6E8D,
-0xFF367898,
-0xFF2C7190,
-0xFF2D6A87,
-0xFF2B5971,
-0xFFEAFFFF,
-0xFFF5FCFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFD,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFBFBFB,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFF8FFFF,
-0xFFAAC7D9,
-0xFF32607A,
-0xFF377395,
-0xFF2D6D91,
-0xFF306A8F,
-0xFF346A8C,
-0xFF37698A,
-0xFF356A8A,
-0xFF316C8C,
-0xFF326D8F,
-0xFF376B90,
-0xFF396B8E,
-0xFF386D8D,
-0xFF376D8F,
-0xFF346E96,
-0xFF356E99,
-0xFF396E98,
-0xFF396E96,
-0xFF397196,
-0xFF377294,
-0xFF387496,
-0xFF306F90,
-0xFF2F6E8D,
-0xFF2F657F,
-0xFF99BCCF,
-0xFFF0FFFF,
-0xFFFEFFFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFF3FFFF,
-0xFF5A7F99,
-0xFF346A8E,
-0xFF357398,
-0xFF2E6C93,
-0xFF326A8D,
-0xFF33698B,
-0xFF37698A,
-0xFF356A8A,
-0xFF336B90,
-0xFF346C91,
-0xFF396B8E,
-0xFF3A6B8C,
-0xFF396C8B,
-0xFF386D8F,
-0xFF346F99,
-0xFF346F99,
-0xFF396F95,
-0xFF3A7094,
-0xFF367296,
-0xFF347297,
-0xFF377397,
-0xFF346F91,
-0xFF386E90,
-0xFF406A82,
-0xFFEFFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFCFB,
-0xFFFFFDFB,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFB,
-0xFFFFFEFA,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFEF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFD8EEF9,
-0xFF31607E,
-0xFF346F97,
-0xFF35739A,
-0xFF2A668B,
-0xFF326A8D,
-0xFF346989,
-0xFF356A8A,
-0xFF356A8C,
-0xFF346C91,
-0xFF346C91,
-0xFF376B90,
-0xFF396B8C,
-0xFF3B6C8D,
-0xFF396D92,
-0xFF346F99,
-0xFF346F99,
-0xFF386E92,
-0xFF387091,
-0xFF337295,
-0xFF317298,
-0xFF347299,
-0xFF3A7297,
-0xFF326081,
-0xFFA1C2D5,
-0xFFF7FFFF,
-0xFFFEFFFA,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFDFB,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFF9FDFE,
-0xFFF4FFFF,
-0xFF809FB3,
-0xFF34698B,
-0xFF3C7AA1,
-0xFF316D92,
-0xFF326A8D,
-0xFF346989,
-0xFF346989,
-0xFF356A8A,
-0xFF356A8C,
-0xFF346C91,
-0xFF346C91,
-0xFF366A8F,
-0xFF366B8D,
-0xFF3A6C8F,
-0xFF376D91,
-0xFF356F97,
-0xFF356F97,
-0xFF386E92,
-0xFF376F90,
-0xFF337295,
-0xFF327296,
-0xFF36759E,
-0xFF397196,
-0xFF3E6A85,
-0xFFE9FFFF,
-0xFFF7FFFF,
-0xFFFEFFFD,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFA,
-0xFFF9FFFF,
-0xFFEAFFFF,
-0xFF34607B,
-0xFF40779E,
-0xFF38769F,
-0xFF2C668B,
-0xFF336A89,
-0xFF356887,
-0xFF366988,
-0xFF356A8A,
-0xFF356B8D,
-0xFF356B8F,
-0xFF356B91,
-0xFF356B8F,
-0xFF356B8F,
-0xFF366A8F,
-0xFF366C90,
-0xFF366D96,
-0xFF376E95,
-0xFF386E92,
-0xFF376F90,
-0xFF347394,
-0xFF347498,
-0xFF3778A2,
-0xFF326A8F,
-0xFF83A7BF,
-0xFFEEFFFF,
-0xFFF4FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFDFEF9,
-0xFFF5FFFF,
-0xFFA4C9E3,
-0xFF326A8D,
-0xFF3C7AA3,
-0xFF2C6B94,
-0xFF30688B,
-0xFF366988,
-0xFF386785,
-0xFF376886,
-0xFF356A8A,
-0xFF356B8D,
-0xFF356B8F,
-0xFF356B8F,
-0xFF356B91,
-0xFF346C91,
-0xFF356B91,
-0xFF356D92,
-0xFF376C94,
-0xFF386D95,
-0xFF386E92,
-0xFF376F90,
-0xFF367294,
-0xFF36769C,
-0xFF3676A2,
-0xFF32688E,
-0xFFD2EFFF,
-0xFFF3FFFF,
-0xFFF8FFFF,
-0xFFFBFFFE,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFBFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFF8,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFCFD,
-0xFFFFFCFD,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFF0FFFF,
-0xFF497A9A,
-0xFF3A79A4,
-0xFF3B7CA6,
-0xFF2D6B92,
-0xFF316789,
-0xFF386987,
-0xFF386783,
-0xFF396884,
-0xFF356A8A,
-0xFF346A8E,
-0xFF356B8F,
-0xFF356B8F,
-0xFF346C91,
-0xFF346C91,
-0xFF366E93,
-0xFF356D92,
-0xFF376C94,
-0xFF386E94,
-0xFF386E90,
-0xFF366E8F,
-0xFF357497,
-0xFF38789E,
-0xFF3474A0,
-0xFF497B9E,
-0xFFEEFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FDFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFDFB,
-0xFFFFFDFB,
-0xFFFFFCFD,
-0xFFFFFDFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFF4FFFF,
-0xFFCDEDFC,
-0xFF356D92,
-0xFF3276A3,
-0xFF33729B,
-0xFF2C688C,
-0xFF326789,
-0xFF356684,
-0xFF396884,
-0xFF396886,
-0xFF34698B,
-0xFF336B8E,
-0xFF346A8E,
-0xFF356B8F,
-0xFF356B8F,
-0xFF356D92,
-0xFF366E93,
-0xFF356C93,
-0xFF376D93,
-0xFF396D92,
-0xFF386D8D,
-0xFF376F90,
-0xFF357599,
-0xFF397AA0,
-0xFF34729B,
-0xFF81AECD,
-0xFFF0FFFF,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFFAFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFDFB,
-0xFFFFFDFB,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFBFFFF,
-0xFFEEFFFF,
-0xFF7BA4BA,
-0xFF35739A,
-0xFF3C80AD,
-0xFF336E96,
-0xFF2C6487,
-0xFF356A8A,
-0xFF376A89,
-0xFF396884,
-0xFF376886,
-0xFF33698B,
-0xFF336B90,
-0xFF346A8E,
-0xFF356B8F,
-0xFF366A8F,
-0xFF366C90,
-0xFF356D92,
-0xFF346B92,
-0xFF366C92,
-0xFF396D92,
-0xFF396E8E,
-0xFF376F90,
-0xFF34789D,
-0xFF3A7EA5,
-0xFF316B91,
-0xFFBBE3FD,
-0xFFF7FFFF,
-0xFFFFFFFB,
-0xFFFBFFFE,
-0xFFFEFFFF,
-0xFFFFFDFE,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFDFA,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFDFD,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFF9FFFF,
-0xFFE7FFFF,
-0xFF3B6E8D,
-0xFF3B7AA3,
-0xFF3C7DA7,
-0xFF2F6589,
-0xFF336685,
-0xFF346989,
-0xFF316686,
-0xFF366785,
-0xFF366988,
-0xFF33698D,
-0xFF336B90,
-0xFF336B90,
-0xFF346A8E,
-0xFF386A8D,
-0xFF376C8E,
-0xFF346C8F,
-0xFF366E93,
-0xFF366B93,
-0xFF376B90,
-0xFF3A6D8C,
-0xFF366E8F,
-0xFF397EA7,
-0xFF397CA6,
-0xFF366B8D,
-0xFFE5FFFF,
-0xFFF8FFFF,
-0xFFFFFFFA,
-0xFFFEFFFD,
-0xFFFDFFFE,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFDFA,
-0xFFFEFEFC,
-0xFFFBFFFE,
-0xFFFCFFFF,
-0xFFF9FFFD,
-0xFFFCFFFF,
-0xFFFCFEFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFBFFFE,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEF9FD,
-0xFFFFFDFD,
-0xFFFDFCF8,
-0xFFFEFFFB,
-0xFFF8FEFE,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFCFBF7,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFAFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFFAFFFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFDFCF7,
-0xFFFEFFFA,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFAFEFD,
-0xFFFCFEFB,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFDFE,
-0xFFF3FFFF,
-0xFF9CC6DF,
-0xFF3B759A,
-0xFF4281AA,
-0xFF316F96,
-0xFF336685,
-0xFF356684,
-0xFF336888,
-0xFF33688A,
-0xFF356887,
-0xFF366889,
-0xFF33698D,
-0xFF336B90,
-0xFF336B90,
-0xFF346A8E,
-0xFF386A8B,
-0xFF396B8C,
-0xFF346C8F,
-0xFF336D92,
-0xFF356C93,
-0xFF366C90,
-0xFF3A6D8C,
-0xFF376F90,
-0xFF3780AB,
-0xFF387DA7,
-0xFF5481A0,
-0xFFEBFFFF,
-0xFFF9FFFF,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFDFDFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFAF7,
-0xFFFFFEFB,
-0xFFFDFFFE,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFEFFFFF,
-0xFFF1FFFF,
-0xFFE0F3F7,
-0xFFE2F3FA,
-0xFFE4F3FA,
-0xFFE4F3FA,
-0xFFE5F2FA,
-0xFFE5F2FB,
-0xFFE5F2FB,
-0xFFE5F1FD,
-0xFFE4F2FD,
-0xFFE5F3FC,
-0xFFE3F4FB,
-0xFFE5F4FB,
-0xFFE3F4FB,
-0xFFE5F4FB,
-0xFFE3F4FB,
-0xFFE3F4FB,
-0xFFE3F4FB,
-0xFFE3F4FB,
-0xFFE3F4FC,
-0xFFE4F5FD,
-0xFFE3F6FD,
-0xFFE4F5FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE4F7FE,
-0xFFE4F7FE,
-0xFFE4F7FD,
-0xFFE4F7FE,
-0xFFE4F7FE,
-0xFFE5F6FE,
-0xFFE5F6FE,
-0xFFE5F6FE,
-0xFFE5F6FE,
-0xFFE4F5FF,
-0xFFE4F5FD,
-0xFFE4F5FF,
-0xFFE4F5FF,
-0xFFE4F5FF,
-0xFFE4F5FF,
-0xFFE4F5FF,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FC,
-0xFFE3F6FD,
-0xFFE3F6FC,
-0xFFE3F6FD,
-0xFFE3F6FC,
-0xFFE3F6FD,
-0xFFE3F6FC,
-0xFFE4F5FD,
-0xFFE4F5FC,
-0xFFE4F5FD,
-0xFFE4F5FC,
-0xFFE4F5FD,
-0xFFE4F5FC,
-0xFFE4F5FD,
-0xFFE4F5FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE3F4FC,
-0xFFE3F4FB,
-0xFFE3F4FC,
-0xFFE3F4FC,
-0xFFE3F4FC,
-0xFFE2F5FC,
-0xFFE3F5FF,
-0xFFE3F6FD,
-0xFFE4F6FF,
-0xFFE4F7FE,
-0xFFE3F6FD,
-0xFFE3F6FD,
-0xFFE4F5FD,
-0xFFE5F6FE,
-0xFFE5F6FD,
-0xFFE5F6FF,
-0xFFDCEFFD,
-0xFFF2FFFF,
-0xFFFBFFFF,
-0xFFFBFBFD,
-0xFFFFFFFD,
-0xFFFDFFFC,
-0xFFFAFFFF,
-0xFFF6FEFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFDF8,
-0xFFFFFEF9,
-0xFFFFFFFB,
-0xFFFDFFFE,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF2FFFF,
-0xFFECFEFF,
-0xFFDDEEF6,
-0xFFDCEDF4,
-0xFFDCEDF4,
-0xFFDCEDF4,
-0xFFDDEEF5,
-0xFFDDEEF5,
-0xFFDEEFF7,
-0xFFDFF0F7,
-0xFFE0F1F9,
-0xFFE0F1F9,
-0xFFE0F1F9,
-0xFFE0F1F9,
-0xFFE0F3FA,
-0xFFE0F3FA,
-0xFFE0F2FC,
-0xFFE0F3FA,
-0xFFE0F1F9,
-0xFFE1F2FA,
-0xFFE1F4FB,
-0xFFE0F3FA,
-0xFFE1F4FB,
-0xFFE2F4FE,
-0xFFE2F4FE,
-0xFFE2F4FE,
-0xFFE1F3FD,
-0xFFE1F4FB,
-0xFFE3F6FD,
-0xFFE4F5FD,
-0xFFE4F5FD,
-0xFFE5F6FE,
-0xFFE6F5FC,
-0xFFE4F5FD,
-0xFFEBFFFF,
-0xFFF2FFFF,
-0xFFFAFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFF8FEFC,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFCFFFD,
-0xFFFEFFFA,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFDFE,
-0xFFFCFDFF,
-0xFFF0FFFF,
-0xFF5284A5,
-0xFF3B7CA4,
-0xFF4583AA,
-0xFF2C6487,
-0xFF356684,
-0xFF376684,
-0xFF346989,
-0xFF326789,
-0xFF35678A,
-0xFF36688B,
-0xFF33698D,
-0xFF346A90,
-0xFF336B90,
-0xFF346A8E,
-0xFF396A8A,
-0xFF386B8A,
-0xFF336B8C,
-0xFF336D92,
-0xFF356C93,
-0xFF366C90,
-0xFF3A6D8C,
-0xFF367193,
-0xFF3781B0,
-0xFF387BA6,
-0xFF78A0B9,
-0xFFF1FFFF,
-0xFFFAFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFBFFFF,
-0xFFEFFFFF,
-0xFFC7E3EF,
-0xFF7BA0B0,
-0xFF558093,
-0xFF5D8A9F,
-0xFF5C8AA1,
-0xFF5B8BA1,
-0xFF5B8BA1,
-0xFF5B8BA1,
-0xFF5C8CA2,
-0xFF5D8BA2,
-0xFF5D8BA2,
-0xFF5E8BA2,
-0xFF5E8BA2,
-0xFF5F8CA3,
-0xFF628CA4,
-0xFF608DA4,
-0xFF628CA4,
-0xFF608DA4,
-0xFF608DA4,
-0xFF5F8CA3,
-0xFF618EA5,
-0xFF618DA6,
-0xFF628EA7,
-0xFF618FA7,
-0xFF628EA7,
-0xFF618FA7,
-0xFF618FA7,
-0xFF6290A8,
-0xFF638FA8,
-0xFF658FA7,
-0xFF658FA8,
-0xFF6690A9,
-0xFF6690A9,
-0xFF6690A9,
-0xFF6690A9,
-0xFF6690A9,
-0xFF6692AD,
-0xFF6692AB,
-0xFF6793AE,
-0xFF6793AE,
-0xFF6793AE,
-0xFF6793AE,
-0xFF6793AE,
-0xFF6894AF,
-0xFF6995AE,
-0xFF6896AD,
-0xFF6896AE,
-0xFF6997AE,
-0xFF6997AF,
-0xFF6997AE,
-0xFF6B97B0,
-0xFF6B98AF,
-0xFF6D99B2,
-0xFF6D9AB1,
-0xFF6D99B2,
-0xFF6D9AB1,
-0xFF6D99B2,
-0xFF6E9BB2,
-0xFF709AB3,
-0xFF709AB3,
-0xFF6E9AB3,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6E9CB4,
-0xFF6F9DB5,
-0xFF6F9DB5,
-0xFF6F9DB5,
-0xFF6F9DB5,
-0xFF6F9DB5,
-0xFF709EB6,
-0xFF719DB6,
-0xFF719EB5,
-0xFF719DB6,
-0xFF709EB6,
-0xFF709EB6,
-0xFF719FB7,
-0xFF719FB9,
-0xFF719FB7,
-0xFF6E9CB6,
-0xFF6D9BB3,
-0xFF6D9BB3,
-0xFF6D9BB3,
-0xFF6F9CB3,
-0xFF6F9CB3,
-0xFF6E9BB2,
-0xFF6D9AB1,
-0xFF709DB4,
-0xFF7EA1B4,
-0xFFF1FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFEFC,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFCFCFA,
-0xFFFAFFFF,
-0xFFF5FFFF,
-0xFFEAFEFF,
-0xFF7A94A5,
-0xFF4A6A7F,
-0xFF476D84,
-0xFF456F87,
-0xFF467088,
-0xFF48728A,
-0xFF4A748C,
-0xFF4B758D,
-0xFF4B7790,
-0xFF4C7990,
-0xFF4E7A93,
-0xFF4F7B94,
-0xFF507C95,
-0xFF517D96,
-0xFF537F98,
-0xFF55819A,
-0xFF55839D,
-0xFF55839B,
-0xFF59879F,
-0xFF5B89A1,
-0xFF5C8CA3,
-0xFF5C8CA3,
-0xFF5E8EA5,
-0xFF608FA9,
-0xFF6291AB,
-0xFF6392AC,
-0xFF6593AD,
-0xFF6896AE,
-0xFF6997AF,
-0xFF6B97B0,
-0xFF6E9BB2,
-0xFF6E9BB2,
-0xFF6F99B1,
-0xFF6F9AAD,
-0xFF6C93A4,
-0xFFB8D6E1,
-0xFFF5FFFF,
-0xFFF9FCFF,
-0xFFFEFCFF,
-0xFFFDFDFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFF9FFFD,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFCF9,
-0xFFFEFFFF,
-0xFFF7FFFF,
-0xFFCCE8FF,
-0xFF397399,
-0xFF3C81AB,
-0xFF3D799E,
-0xFF2E6383,
-0xFF376684,
-0xFF366583,
-0xFF37698A,
-0xFF306587,
-0xFF35678A,
-0xFF34688D,
-0xFF34688D,
-0xFF33698F,
-0xFF346A90,
-0xFF346A8E,
-0xFF396A8B,
-0xFF386B8A,
-0xFF346A8C,
-0xFF336E90,
-0xFF356D92,
-0xFF366C92,
-0xFF386D8D,
-0xFF377397,
-0xFF3783B4,
-0xFF377AA5,
-0xFF98B8CD,
-0xFFF4FFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFBFCFF,
-0xFFF4FFFF,
-0xFF95B1BD,
-0xFF547D91,
-0xFF568AA2,
-0xFF568FAC,
-0xFF5693B2,
-0xFF5291B2,
-0xFF5192B2,
-0xFF5193B3,
-0xFF5194B1,
-0xFF5293B1,
-0xFF5493B2,
-0xFF5693B2,
-0xFF5792B2,
-0xFF5893B3,
-0xFF5794B3,
-0xFF5895B4,
-0xFF5895B4,
-0xFF5995B7,
-0xFF5996B5,
-0xFF5995B7,
-0xFF5695B6,
-0xFF5897B8,
-0xFF5897B8,
-0xFF5998BB,
-0xFF5998B9,
-0xFF5998BB,
-0xFF5998B9,
-0xFF5A99BC,
-0xFF5A99BC,
-0xFF5D99BD,
-0xFF5E98BD,
-0xFF5E98BD,
-0xFF5E98BD,
-0xFF5F99BE,
-0xFF5F99BE,
-0xFF5F99BE,
-0xFF5E9ABF,
-0xFF5F9BC0,
-0xFF5F9BC0,
-0xFF5F9BC0,
-0xFF609CC1,
-0xFF609CC1,
-0xFF619CC4,
-0xFF619CC4,
-0xFF5F9DC2,
-0xFF5E9DC0,
-0xFF5E9DC0,
-0xFF5F9EC1,
-0xFF5F9EC1,
-0xFF609FC2,
-0xFF609FC2,
-0xFF609FC2,
-0xFF639FC3,
-0xFF639FC3,
-0xFF639FC3,
-0xFF639FC3,
-0xFF64A0C4,
-0xFF64A0C4,
-0xFF64A0C4,
-0xFF65A1C5,
-0xFF65A1C5,
-0xFF66A2C6,
-0xFF64A3C6,
-0xFF64A3C6,
-0xFF64A3C6,
-0xFF65A4C7,
-0xFF65A4C7,
-0xFF65A4C7,
-0xFF65A4C7,
-0xFF66A5C8,
-0xFF66A5C8,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF67A6C9,
-0xFF68A7CA,
-0xFF68A7CA,
-0xFF68A7CA,
-0xFF69A8CB,
-0xFF69A8CB,
-0xFF69A8CB,
-0xFF6AA9CC,
-0xFF69A9CC,
-0xFF69A9CC,
-0xFF6AAACE,
-0xFF6AAACD,
-0xFF6BABCF,
-0xFF6BABCE,
-0xFF6DACCF,
-0xFF6DACCD,
-0xFF6DACCD,
-0xFF6EABCA,
-0xFF6EABCA,
-0xFF70ABC9,
-0xFF6EA7C2,
-0xFF6F9EB2,
-0xFFC2D9E7,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFEFFFA,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFEFAF7,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFF3FEFF,
-0xFFE6FAFF,
-0xFF486575,
-0xFF476B83,
-0xFF497693,
-0xFF437A99,
-0xFF417C9E,
-0xFF427D9F,
-0xFF447FA1,
-0xFF4680A5,
-0xFF4783A7,
-0xFF4884A8,
-0xFF4884A8,
-0xFF4A86AA,
-0xFF4B87AB,
-0xFF4C88AD,
-0xFF4C8AAF,
-0xFF508CB1,
-0xFF508EB3,
-0xFF5290B5,
-0xFF5391B6,
-0xFF5393B7,
-0xFF5696BA,
-0xFF5799BC,
-0xFF589ABD,
-0xFF599BBE,
-0xFF5B9DC0,
-0xFF5D9EC4,
-0xFF5EA0C3,
-0xFF61A1C5,
-0xFF63A3C6,
-0xFF64A3C6,
-0xFF65A4C5,
-0xFF6DA9CB,
-0xFF6AA7C6,
-0xFF6DAAC9,
-0xFF73ACC9,
-0xFF75A8BD,
-0xFF769BAB,
-0xFFF2FFFF,
-0xFFFCFFFF,
-0xFFFDFBFE,
-0xFFFFFEFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFEFB,
-0xFFFFFDF9,
-0xFFFFFFFD,
-0xFFF9FFFF,
-0xFFEEFFFF,
-0xFF789FBE,
-0xFF3F7EA9,
-0xFF4084B1,
-0xFF316B90,
-0xFF316384,
-0xFF356686,
-0xFF346585,
-0xFF356788,
-0xFF336588,
-0xFF35678A,
-0xFF34688D,
-0xFF34688D,
-0xFF34688D,
-0xFF34688D,
-0xFF35698E,
-0xFF37698A,
-0xFF386A8B,
-0xFF346A8C,
-0xFF346C8F,
-0xFF366C92,
-0xFF366C92,
-0xFF366E91,
-0xFF36769C,
-0xFF3A86B7,
-0xFF3879A1,
-0xFFB0CDDF,
-0xFFF6FFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFA,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF9EB9C0,
-0xFF4D7581,
-0xFF53879C,
-0xFF4B88A4,
-0xFF4586A6,
-0xFF36779D,
-0xFF3C7DA3,
-0xFF3D7EA4,
-0xFF3D7FA2,
-0xFF3E80A3,
-0xFF3F7FA2,
-0xFF437FA3,
-0xFF447EA3,
-0xFF447EA3,
-0xFF4280A5,
-0xFF4082A5,
-0xFF4082A5,
-0xFF4082A5,
-0xFF4182A8,
-0xFF4183A6,
-0xFF4283A9,
-0xFF4084A9,
-0xFF4185AA,
-0xFF4185AA,
-0xFF4286AD,
-0xFF4286AB,
-0xFF4286AD,
-0xFF4286AB,
-0xFF4387AE,
-0xFF4488AF,
-0xFF4687AF,
-0xFF4687AF,
-0xFF4687AF,
-0xFF4788B0,
-0xFF4589B0,
-0xFF468AB1,
-0xFF468AB1,
-0xFF4689B3,
-0xFF4689B3,
-0xFF458AB3,
-0xFF458AB3,
-0xFF468BB4,
-0xFF468BB4,
-0xFF478CB6,
-0xFF478CB6,
-0xFF458CB6,
-0xFF478FB7,
-0xFF478FB7,
-0xFF4890B8,
-0xFF4890B8,
-0xFF4991B9,
-0xFF4991B9,
-0xFF4A92BA,
-0xFF4C91BA,
-0xFF4C91BA,
-0xFF4C91BA,
-0xFF4C91BA,
-0xFF4D92BB,
-0xFF4D92BB,
-0xFF4E93BC,
-0xFF4E93BC,
-0xFF5093BD,
-0xFF5094BB,
-0xFF5094BB,
-0xFF5094BB,
-0xFF5195BC,
-0xFF5195BC,
-0xFF5195BC,
-0xFF5195BC,
-0xFF5296BD,
-0xFF5397BE,
-0xFF5397BE,
-0xFF5397BE,
-0xFF5498BF,
-0xFF5498BF,
-0xFF5599C0,
-0xFF5599C0,
-0xFF5599C0,
-0xFF5599C0,
-0xFF5599C0,
-0xFF5499C0,
-0xFF5499C0,
-0xFF559AC1,
-0xFF559AC1,
-0xFF539BC3,
-0xFF549CC2,
-0xFF5499C2,
-0xFF559AC1,
-0xFF579BC2,
-0xFF569ABF,
-0xFF5599BE,
-0xFF5698BB,
-0xFF5A9CBF,
-0xFF60A1C1,
-0xFF65A5C1,
-0xFF6598AD,
-0xFFD6EEFA,
-0xFFF6FFFF,
-0xFFFDFDFD,
-0xFFFFFFFD,
-0xFFF5F6F8,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFEFFFA,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFAFCFB,
-0xFFF9FFFF,
-0xFFF1FFFF,
-0xFF5A7787,
-0xFF477086,
-0xFF417290,
-0xFF457DA0,
-0xFF4888AE,
-0xFF4589B0,
-0xFF4589B0,
-0xFF4589B0,
-0xFF4689B3,
-0xFF4489B2,
-0xFF4489B2,
-0xFF4489B2,
-0xFF458AB3,
-0xFF458AB3,
-0xFF458AB4,
-0xFF438AB4,
-0xFF468BB5,
-0xFF448BB5,
-0xFF448BB5,
-0xFF458CB6,
-0xFF448CB4,
-0xFF458DB5,
-0xFF458EB7,
-0xFF448DB6,
-0xFF438CB5,
-0xFF448DB6,
-0xFF458EB7,
-0xFF458EB7,
-0xFF468DB7,
-0xFF468EB6,
-0xFF498EB5,
-0xFF498FB3,
-0xFF4B8FB2,
-0xFF498BAE,
-0xFF589ABC,
-0xFF67A4C1,
-0xFF6CA3B8,
-0xFF8BB2C1,
-0xFFEFFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFDFE,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFEFFF8,
-0xFFFEFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFEFB,
-0xFFFFFCF8,
-0xFFFFFFFF,
-0xFFF4FFFF,
-0xFFDFFFFF,
-0xFF427497,
-0xFF4386B1,
-0xFF3E83AD,
-0xFF2C6487,
-0xFF2F6182,
-0xFF33688A,
-0xFF346689,
-0xFF336485,
-0xFF376889,
-0xFF35678A,
-0xFF33678C,
-0xFF34688D,
-0xFF34688D,
-0xFF36688D,
-0xFF356A8C,
-0xFF37698C,
-0xFF366B8D,
-0xFF356B8D,
-0xFF346C8D,
-0xFF366C90,
-0xFF366C92,
-0xFF346E94,
-0xFF3778A2,
-0xFF3C88B9,
-0xFF39799F,
-0xFFC3DDEC,
-0xFFFAFFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFFEAFEFF,
-0xFF4D6F79,
-0xFF538292,
-0xFF49819A,
-0xFF397897,
-0xFF307197,
-0xFF3376A0,
-0xFF34759F,
-0xFF34759D,
-0xFF35769E,
-0xFF35769C,
-0xFF37779B,
-0xFF38769B,
-0xFF3B779C,
-0xFF3B769E,
-0xFF39799F,
-0xFF367A9F,
-0xFF3579A0,
-0xFF3479A0,
-0xFF367AA1,
-0xFF367BA2,
-0xFF387CA3,
-0xFF377CA3,
-0xFF377CA5,
-0xFF367EA6,
-0xFF387DA6,
-0xFF377FA7,
-0xFF397EA7,
-0xFF377FA7,
-0xFF3A7FA8,
-0xFF3980AA,
-0xFF3980AA,
-0xFF3980AA,
-0xFF3A81AB,
-0xFF3A81AB,
-0xFF3B82AC,
-0xFF3A83AC,
-0xFF3A83AC,
-0xFF3B84AF,
-0xFF3C85B0,
-0xFF3C87B1,
-0xFF3C87B1,
-0xFF3C87B1,
-0xFF3D87B4,
-0xFF3D87B4,
-0xFF3C89B5,
-0xFF3C89B5,
-0xFF3A87B3,
-0xFF3A89B4,
-0xFF3B88B4,
-0xFF3B88B4,
-0xFF3C89B5,
-0xFF3C89B5,
-0xFF3D8AB6,
-0xFF3D8AB6,
-0xFF418BB8,
-0xFF418BB8,
-0xFF418BB8,
-0xFF428CB9,
-0xFF428CB9,
-0xFF438DBA,
-0xFF438DBA,
-0xFF458EB9,
-0xFF458EB9,
-0xFF458EB7,
-0xFF478EB8,
-0xFF468FB8,
-0xFF488FB9,
-0xFF4790B9,
-0xFF488FB9,
-0xFF4790B9,
-0xFF4990BA,
-0xFF4891BA,
-0xFF4990BA,
-0xFF4992BB,
-0xFF4A91BB,
-0xFF4A93BC,
-0xFF4B92BC,
-0xFF4B92BC,
-0xFF4A91BB,
-0xFF4B92BC,
-0xFF4B92BC,
-0xFF4A93BC,
-0xFF4A93BC,
-0xFF4B94BD,
-0xFF4B94BF,
-0xFF4B94BD,
-0xFF4B94BD,
-0xFF4C93BD,
-0xFF4C93BD,
-0xFF4E93BC,
-0xFF4C91B8,
-0xFF4E92B9,
-0xFF5697BD,
-0xFF5D9DC0,
-0xFF629EBA,
-0xFF6794A7,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFEFFFF,
-0xFFFBFCFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFC,
-0xFFFEFFFF,
-0xFFF2FDFF,
-0xFFD2E8F3,
-0xFF375C6F,
-0xFF3D6F8A,
-0xFF437FA1,
-0xFF498DB4,
-0xFF478EB8,
-0xFF468FBA,
-0xFF468FBA,
-0xFF458EB9,
-0xFF458EB9,
-0xFF438DBA,
-0xFF428CB9,
-0xFF428CB9,
-0xFF418BB8,
-0xFF418BB8,
-0xFF3F8CBA,
-0xFF3E8BB9,
-0xFF3D8AB8,
-0xFF3C89B7,
-0xFF3C89B7,
-0xFF3B88B4,
-0xFF3D87B4,
-0xFF3E88B5,
-0xFF3E88B5,
-0xFF3A87B3,
-0xFF3A87B5,
-0xFF3A87B3,
-0xFF3A87B3,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3B84AF,
-0xFF3D86AF,
-0xFF3C84AC,
-0xFF3B80A7,
-0xFF397DA2,
-0xFF5498BD,
-0xFF69A6C5,
-0xFF6A9DB2,
-0xFFBADBEA,
-0xFFF5FFFF,
-0xFFFDFCFF,
-0xFFFFFCFB,
-0xFFFFFEFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFA,
-0xFFFEFFFA,
-0xFFFCFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFA,
-0xFFFFFEFB,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFFEFFFF,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFCFFFF,
-0xFFEFFFFF,
-0xFFA1CAE6,
-0xFF407AA0,
-0xFF4487B2,
-0xFF3376A0,
-0xFF2B6386,
-0xFF2E6383,
-0xFF32688E,
-0xFF31658A,
-0xFF366485,
-0xFF3A6788,
-0xFF36668A,
-0xFF35678C,
-0xFF36688B,
-0xFF36688B,
-0xFF37678B,
-0xFF36688B,
-0xFF356A8C,
-0xFF356B8D,
-0xFF346C8D,
-0xFF356B8D,
-0xFF376C8E,
-0xFF356B91,
-0xFF326D95,
-0xFF3679A4,
-0xFF3E8ABB,
-0xFF3C789D,
-0xFFCFE6F4,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFBFFFE,
-0xFFFDFFFC,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFFA3BACA,
-0xFF486B7F,
-0xFF47758D,
-0xFF407796,
-0xFF357196,
-0xFF35739C,
-0xFF3875A1,
-0xFF3974A0,
-0xFF37759E,
-0xFF36759E,
-0xFF36779D,
-0xFF34789D,
-0xFF35799E,
-0xFF37789E,
-0xFF3877A0,
-0xFF3978A1,
-0xFF3879A1,
-0xFF3879A3,
-0xFF377AA4,
-0xFF397AA4,
-0xFF387BA5,
-0xFF3A7BA5,
-0xFF397CA6,
-0xFF397CA7,
-0xFF387DA7,
-0xFF3A7DA8,
-0xFF3A7FA9,
-0xFF3B7EA9,
-0xFF3A7FA9,
-0xFF3C7FAA,
-0xFF3C80AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3A83AE,
-0xFF3A83AE,
-0xFF3A85AF,
-0xFF3A85AF,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3A87B3,
-0xFF3A87B3,
-0xFF3A87B3,
-0xFF3A88B6,
-0xFF3A88B6,
-0xFF3A88B6,
-0xFF3889B6,
-0xFF3A8BB8,
-0xFF3A8BB8,
-0xFF3A8BB8,
-0xFF3A8BB8,
-0xFF3B8CB9,
-0xFF3B8CB9,
-0xFF3E8CBA,
-0xFF3E8CBA,
-0xFF3E8CBA,
-0xFF3E8CBA,
-0xFF3F8CBA,
-0xFF408DBB,
-0xFF408DBB,
-0xFF418EBC,
-0xFF418EBC,
-0xFF418EBC,
-0xFF4590BA,
-0xFF4590BA,
-0xFF468FBA,
-0xFF4691BB,
-0xFF4790BB,
-0xFF4792BC,
-0xFF4891BC,
-0xFF4792BC,
-0xFF4891BC,
-0xFF4792BC,
-0xFF4992BD,
-0xFF4893BD,
-0xFF4992BD,
-0xFF4994BE,
-0xFF4A93BE,
-0xFF4A93BE,
-0xFF4C93BF,
-0xFF4E92BF,
-0xFF4E92BF,
-0xFF4C93BF,
-0xFF4C93BF,
-0xFF4C93BF,
-0xFF4D94C2,
-0xFF4D94C0,
-0xFF4D94C0,
-0xFF4E93BD,
-0xFF4E93BD,
-0xFF5093BD,
-0xFF5192BA,
-0xFF5192BA,
-0xFF5494BA,
-0xFF5C97B9,
-0xFF5A8CA5,
-0xFFACCDDC,
-0xFFF6FFFF,
-0xFFFFFFFD,
-0xFFFFFCF8,
-0xFFFFFBF8,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFEFCFD,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF7993A2,
-0xFF3B657D,
-0xFF336C8A,
-0xFF4A8EB5,
-0xFF4792BC,
-0xFF448EBB,
-0xFF448EBB,
-0xFF448EBB,
-0xFF428FBB,
-0xFF418EBA,
-0xFF418EBC,
-0xFF408DBB,
-0xFF408DBB,
-0xFF3E8CBA,
-0xFF3E8CBA,
-0xFF3D8BBB,
-0xFF3D8BBB,
-0xFF3D8BBB,
-0xFF3C8ABA,
-0xFF3C8ABA,
-0xFF3C8ABA,
-0xFF3E88B9,
-0xFF3E88B7,
-0xFF3D87B6,
-0xFF3D87B6,
-0xFF3D87B8,
-0xFF3E88B7,
-0xFF3D87B6,
-0xFF3B85B2,
-0xFF3C85B2,
-0xFF3B82AE,
-0xFF3E85AF,
-0xFF3C81AA,
-0xFF3C80A7,
-0xFF3F80A6,
-0xFF5C9DC3,
-0xFF68A0C1,
-0xFF6E97AB,
-0xFFEBFFFF,
-0xFFFBFFFF,
-0xFFFFFDFE,
-0xFFFFFFFA,
-0xFFFCFDF7,
-0xFFF9FFFD,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFCFFFB,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFA,
-0xFFFFFEFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFFFBFA,
-0xFFFFFFFD,
-0xFFF8FFFF,
-0xFFEBFFFF,
-0xFF5385A6,
-0xFF4786AF,
-0xFF4889B1,
-0xFF28668D,
-0xFF2E6486,
-0xFF316686,
-0xFF30668C,
-0xFF306489,
-0xFF3A6889,
-0xFF376485,
-0xFF36668A,
-0xFF35678C,
-0xFF37678B,
-0xFF37678B,
-0xFF376889,
-0xFF36688B,
-0xFF356A8C,
-0xFF346A8E,
-0xFF356B8F,
-0xFF356B8D,
-0xFF376C8E,
-0xFF356B8F,
-0xFF306E95,
-0xFF377AA5,
-0xFF418BBA,
-0xFF3C789D,
-0xFFD3E9F6,
-0xFFF9FDFE,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFDFFFC,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFF859BB0,
-0xFF456981,
-0xFF447391,
-0xFF3A7297,
-0xFF34729B,
-0xFF3977A0,
-0xFF35709A,
-0xFF3A749C,
-0xFF39749C,
-0xFF37759C,
-0xFF36779F,
-0xFF34789F,
-0xFF34789F,
-0xFF3579A0,
-0xFF3579A0,
-0xFF3778A0,
-0xFF3877A0,
-0xFF3879A3,
-0xFF397AA4,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF397CA7,
-0xFF3A7DA8,
-0xFF3A7DA8,
-0xFF3B7EA9,
-0xFF3B7EA9,
-0xFF3C7FAA,
-0xFF3C7FAC,
-0xFF3C80AD,
-0xFF3881AC,
-0xFF3782AC,
-0xFF3883AD,
-0xFF3883AD,
-0xFF3984AE,
-0xFF3A85AF,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3986B2,
-0xFF3988B3,
-0xFF3987B5,
-0xFF3987B5,
-0xFF3987B5,
-0xFF3889B6,
-0xFF3A88B6,
-0xFF3889B6,
-0xFF398AB9,
-0xFF398AB9,
-0xFF398AB9,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3F8DBD,
-0xFF3F8DBD,
-0xFF3F8DBD,
-0xFF408EBE,
-0xFF408EBE,
-0xFF408EBC,
-0xFF428FBB,
-0xFF448FB9,
-0xFF4590BA,
-0xFF4590BA,
-0xFF4691BB,
-0xFF4691BB,
-0xFF4792BC,
-0xFF4792BC,
-0xFF4792BC,
-0xFF4792BC,
-0xFF4792BC,
-0xFF4893BD,
-0xFF4893BD,
-0xFF4893BD,
-0xFF4893BD,
-0xFF4A93BE,
-0xFF4B92BE,
-0xFF4B92BE,
-0xFF4B92BE,
-0xFF4A93C0,
-0xFF4C93C1,
-0xFF4C93C1,
-0xFF4C93C1,
-0xFF4C93BF,
-0xFF4F93C0,
-0xFF4D91BE,
-0xFF4D91BE,
-0xFF5194BF,
-0xFF5394BE,
-0xFF5191B7,
-0xFF528EB3,
-0xFF578CAB,
-0xFF597E91,
-0xFFEAFFFF,
-0xFFFBFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF8FDFF,
-0xFFF1FFFF,
-0xFF355669,
-0xFF3B6A86,
-0xFF377397,
-0xFF478EB8,
-0xFF428FBD,
-0xFF4390BE,
-0xFF428FBD,
-0xFF428FBD,
-0xFF408EBC,
-0xFF3F8DBB,
-0xFF3F8DBB,
-0xFF3E8CBC,
-0xFF3E8CBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8BBC,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3989BA,
-0xFF3B89BA,
-0xFF3D89BA,
-0xFF3E88B9,
-0xFF3D87B8,
-0xFF3C86B7,
-0xFF3D86B9,
-0xFF3C88B9,
-0xFF3A87B5,
-0xFF3A84B1,
-0xFF3E87B4,
-0xFF3B82AE,
-0xFF3C83AF,
-0xFF3C81AB,
-0xFF4384AC,
-0xFF4989AF,
-0xFF62A0C5,
-0xFF6295B4,
-0xFFA1C0D2,
-0xFFF1FFFF,
-0xFFFEFFFF,
-0xFFFFFDFD,
-0xFFFFFCF7,
-0xFFFFFFFA,
-0xFFF9FFFD,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFF8,
-0xFFFFFFF6,
-0xFFFFFEFA,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFDFFFE,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFEFFFFF,
-0xFFC1E4F7,
-0xFF447FA1,
-0xFF4B8FB6,
-0xFF3D779C,
-0xFF326789,
-0xFF2E6081,
-0xFF336586,
-0xFF336588,
-0xFF326487,
-0xFF356687,
-0xFF366788,
-0xFF346689,
-0xFF35678A,
-0xFF36688B,
-0xFF36688B,
-0xFF37698C,
-0xFF356A8C,
-0xFF34698B,
-0xFF34688D,
-0xFF35698E,
-0xFF366C90,
-0xFF376C8E,
-0xFF346C8D,
-0xFF326E93,
-0xFF3A7BA5,
-0xFF438DBC,
-0xFF417DA2,
-0xFFD2E8F5,
-0xFFFAFEFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFAFFFC,
-0xFFFCFFFB,
-0xFFFDFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFF8298A6,
-0xFF406379,
-0xFF3B6C8A,
-0xFF337198,
-0xFF32759F,
-0xFF34749A,
-0xFF377699,
-0xFF397597,
-0xFF397496,
-0xFF38739B,
-0xFF3875A1,
-0xFF3978A4,
-0xFF3676A2,
-0xFF34789F,
-0xFF367A9F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF397AA4,
-0xFF397AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF397CA7,
-0xFF3A7DA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7EAB,
-0xFF3B7FAC,
-0xFF3881AE,
-0xFF3881AE,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3987B5,
-0xFF3B87B8,
-0xFF3A88B8,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3B89BA,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3C8CBD,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3D8EBD,
-0xFF3D8EBD,
-0xFF3E8FBE,
-0xFF3E8FBE,
-0xFF408EBE,
-0xFF428FBD,
-0xFF428FBB,
-0xFF4390BC,
-0xFF4390BC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF468FBC,
-0xFF468FBC,
-0xFF4790BD,
-0xFF4891BE,
-0xFF4891BE,
-0xFF4891BE,
-0xFF4892BF,
-0xFF4892BF,
-0xFF4892BF,
-0xFF4893BD,
-0xFF4A93BC,
-0xFF4A93BC,
-0xFF4794C0,
-0xFF4794C2,
-0xFF4A92C2,
-0xFF4C93C1,
-0xFF4E92BF,
-0xFF4E93BD,
-0xFF4A91BB,
-0xFF4D94C0,
-0xFF4990BC,
-0xFF5094C1,
-0xFF5095BE,
-0xFF4F91B4,
-0xFF4E89A9,
-0xFF507C95,
-0xFF8BA3AF,
-0xFFF5FFFF,
-0xFFFAFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFDF9,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFAFFFF,
-0xFF9BB2C2,
-0xFF365E77,
-0xFF326987,
-0xFF4181A5,
-0xFF4A91BB,
-0xFF448EBB,
-0xFF4390BE,
-0xFF418FBD,
-0xFF408EBC,
-0xFF3F8DBB,
-0xFF3F8DBB,
-0xFF3D8EBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8BBC,
-0xFF3A8ABB,
-0xFF3B89BA,
-0xFF3A88B9,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3D87B8,
-0xFF3D86B9,
-0xFF3B87BB,
-0xFF3987B8,
-0xFF3788B3,
-0xFF3887B0,
-0xFF3C85B0,
-0xFF3D84B0,
-0xFF3A84B3,
-0xFF3C85B2,
-0xFF3C7BA4,
-0xFF5F99BF,
-0xFF629DBF,
-0xFF5E8CA4,
-0xFFE6FAFF,
-0xFFF7FCFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFF8,
-0xFFFFFFF6,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFF8FFFF,
-0xFFEDFFFF,
-0xFF7BA5BB,
-0xFF4C8BAE,
-0xFF5091B9,
-0xFF33698B,
-0xFF326383,
-0xFF316282,
-0xFF336484,
-0xFF346586,
-0xFF346586,
-0xFF346687,
-0xFF346687,
-0xFF35678A,
-0xFF35678A,
-0xFF35678A,
-0xFF36688B,
-0xFF34698B,
-0xFF34698B,
-0xFF34698B,
-0xFF34698B,
-0xFF34688D,
-0xFF366A8F,
-0xFF366B8D,
-0xFF356B8D,
-0xFF326C91,
-0xFF3A7BA3,
-0xFF4791BE,
-0xFF4180A3,
-0xFFD0E8F4,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFAFFFB,
-0xFFFCFFFB,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF6FDFF,
-0xFFAEBECB,
-0xFF335368,
-0xFF3A6987,
-0xFF347094,
-0xFF307197,
-0xFF337397,
-0xFF357497,
-0xFF3B7897,
-0xFF397496,
-0xFF37729A,
-0xFF35729E,
-0xFF3574A0,
-0xFF3777A3,
-0xFF397AA2,
-0xFF34789D,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF397AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7EAB,
-0xFF387FAB,
-0xFF3980AE,
-0xFF3881AE,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3C88BA,
-0xFF3C88BA,
-0xFF3C88BA,
-0xFF3C88BA,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3D8EBD,
-0xFF3D8EBD,
-0xFF3D8EBD,
-0xFF418FBD,
-0xFF428FBD,
-0xFF428FBB,
-0xFF4390BC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF468FBC,
-0xFF468FBC,
-0xFF4790BD,
-0xFF4790BD,
-0xFF4891BE,
-0xFF4891BE,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4792BC,
-0xFF4992BB,
-0xFF4893BB,
-0xFF4594BF,
-0xFF4694C2,
-0xFF4993C2,
-0xFF4B92C0,
-0xFF4D91BE,
-0xFF4D92BC,
-0xFF4C93BD,
-0xFF4A91BD,
-0xFF4C95C2,
-0xFF4990BC,
-0xFF4E93BA,
-0xFF4484A7,
-0xFF457A99,
-0xFF4C7287,
-0xFFD0E1E8,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFEFDF9,
-0xFFFDFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFF8FFFF,
-0xFF476476,
-0xFF32607A,
-0xFF306B8D,
-0xFF4B8FB6,
-0xFF458CB8,
-0xFF448EBB,
-0xFF428FBD,
-0xFF408EBC,
-0xFF3F8DBB,
-0xFF3E8CBA,
-0xFF3C8DBA,
-0xFF3C8DBA,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3D87B8,
-0xFF3C85B8,
-0xFF3A86BA,
-0xFF3886B7,
-0xFF3687B2,
-0xFF3887AE,
-0xFF3A83AC,
-0xFF3F86B2,
-0xFF3983B2,
-0xFF3780AD,
-0xFF4483AC,
-0xFF5C94B7,
-0xFF5D92B1,
-0xFF7AA0B5,
-0xFFF2FFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFF4FDFF,
-0xFFDFFFFF,
-0xFF51839C,
-0xFF538FB4,
-0xFF4B89B0,
-0xFF2A5F81,
-0xFF326383,
-0xFF336484,
-0xFF326383,
-0xFF336485,
-0xFF346586,
-0xFF336586,
-0xFF346687,
-0xFF35678A,
-0xFF35678A,
-0xFF35678A,
-0xFF36688B,
-0xFF34698B,
-0xFF34698B,
-0xFF34698B,
-0xFF356A8C,
-0xFF346A8E,
-0xFF35698E,
-0xFF376C8E,
-0xFF366B8D,
-0xFF336B90,
-0xFF3B7BA1,
-0xFF4C97C1,
-0xFF4584A7,
-0xFFC9E0EE,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFEFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF7FFFF,
-0xFF2D4C60,
-0xFF325E79,
-0xFF2F627F,
-0xFF37708E,
-0xFF397597,
-0xFF37759A,
-0xFF377398,
-0xFF367199,
-0xFF37759C,
-0xFF37769F,
-0xFF31759C,
-0xFF34789F,
-0xFF3A79A2,
-0xFF37769F,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A3,
-0xFF397AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF397CA7,
-0xFF387BA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FA9,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3C88BA,
-0xFF3B87B9,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3B89B9,
-0xFF3C8ABA,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3D8EBD,
-0xFF3D8EBD,
-0xFF408EBC,
-0xFF408EBC,
-0xFF418EBC,
-0xFF428FBD,
-0xFF4390BE,
-0xFF4390BE,
-0xFF458FBC,
-0xFF458FBC,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4791BE,
-0xFF4792BC,
-0xFF4792BA,
-0xFF4792BC,
-0xFF4791BE,
-0xFF4892C1,
-0xFF4892BF,
-0xFF4992BF,
-0xFF4A91BD,
-0xFF4D91BE,
-0xFF4C93BF,
-0xFF4790BD,
-0xFF4A94C1,
-0xFF4992BB,
-0xFF5393B9,
-0xFF437B9E,
-0xFF467893,
-0xFF54778A,
-0xFFF4FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDFCFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFCFF,
-0xFFFCFDFF,
-0xFFFDFFFE,
-0xFFFBFFFF,
-0xFFF6FDFF,
-0xFFC9D9E6,
-0xFF2D4D62,
-0xFF346381,
-0xFF39779C,
-0xFF458CB6,
-0xFF428CB9,
-0xFF418EBC,
-0xFF408EBE,
-0xFF3F8DBD,
-0xFF3C8DBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3A8BBA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3C88BA,
-0xFF3A88B8,
-0xFF3A88B6,
-0xFF3A87B5,
-0xFF3D85B7,
-0xFF3D84B8,
-0xFF3985B6,
-0xFF3886B4,
-0xFF3586B1,
-0xFF3786AF,
-0xFF3984AE,
-0xFF3B82AE,
-0xFF3980AC,
-0xFF3C81AB,
-0xFF4F8FB3,
-0xFF5B94B2,
-0xFF5887A1,
-0xFFBEDDEF,
-0xFFF7FFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF5FFFF,
-0xFFA0C9DB,
-0xFF5289A7,
-0xFF5C96BC,
-0xFF377199,
-0xFF2A5F81,
-0xFF346585,
-0xFF346585,
-0xFF316282,
-0xFF336485,
-0xFF336485,
-0xFF326485,
-0xFF356788,
-0xFF35678A,
-0xFF35678A,
-0xFF35678A,
-0xFF35678A,
-0xFF33688A,
-0xFF34698B,
-0xFF356A8C,
-0xFF356A8C,
-0xFF356B8F,
-0xFF346A8E,
-0xFF396B8E,
-0xFF376C8E,
-0xFF33698D,
-0xFF39779E,
-0xFF4F9AC2,
-0xFF4988AB,
-0xFFB9D3E2,
-0xFFF9FFFF,
-0xFFFAFFFF,
-0xFFFEFFFF,
-0xFFFEFEFC,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFF9FFFF,
-0xFFABC1CF,
-0xFF214458,
-0xFF2C566E,
-0xFF285A75,
-0xFF2F6685,
-0xFF3A7499,
-0xFF39739B,
-0xFF38739D,
-0xFF36769C,
-0xFF36779D,
-0xFF34789D,
-0xFF32769B,
-0xFF37759E,
-0xFF3A78A1,
-0xFF3877A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA6,
-0xFF387BA6,
-0xFF377CA6,
-0xFF387DA7,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF3881AC,
-0xFF3881AC,
-0xFF3881AC,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3885B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3B87B9,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B89B9,
-0xFF3C8ABA,
-0xFF398AB9,
-0xFF398AB9,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3F8DBD,
-0xFF3F8DBB,
-0xFF418EBC,
-0xFF418EBC,
-0xFF428FBD,
-0xFF428FBD,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4792BC,
-0xFF4792BC,
-0xFF4891BE,
-0xFF4891BE,
-0xFF4892BF,
-0xFF4892BF,
-0xFF4A91BD,
-0xFF4A91BD,
-0xFF4992BF,
-0xFF4993C0,
-0xFF4895C1,
-0xFF4D94BE,
-0xFF417DA2,
-0xFF3D6F90,
-0xFF3D6780,
-0xFFA1C1D0,
-0xFFF3FFFF,
-0xFFF9FDFE,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFCFC,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFF627C8B,
-0xFF335970,
-0xFF2A5D7C,
-0xFF498AB2,
-0xFF428CB9,
-0xFF4491BF,
-0xFF3B89B9,
-0xFF3F8DBD,
-0xFF3E8CBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF398AB9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B87B9,
-0xFF3A86B7,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3D85B7,
-0xFF3D85B7,
-0xFF3986B4,
-0xFF3887B2,
-0xFF3786AF,
-0xFF3786AF,
-0xFF3C87B1,
-0xFF3980AC,
-0xFF3C7FAA,
-0xFF4081A7,
-0xFF5191B4,
-0xFF5890AB,
-0xFF61879C,
-0xFFEDFFFF,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF0FFFF,
-0xFF6090A7,
-0xFF5793B5,
-0xFF6097BE,
-0xFF285C84,
-0xFF306285,
-0xFF346585,
-0xFF336484,
-0xFF326383,
-0xFF346586,
-0xFF336485,
-0xFF326384,
-0xFF356687,
-0xFF356788,
-0xFF356788,
-0xFF35678A,
-0xFF35678A,
-0xFF33688A,
-0xFF34698B,
-0xFF34698B,
-0xFF356A8C,
-0xFF356B8D,
-0xFF33698B,
-0xFF396B8E,
-0xFF396B8E,
-0xFF34688D,
-0xFF377398,
-0xFF529CC3,
-0xFF4F8EAF,
-0xFFA6C3D5,
-0xFFF7FFFF,
-0xFFF9FEFF,
-0xFFFEFFFF,
-0xFFFFFDFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FDFE,
-0xFFF9FFFF,
-0xFF899BA5,
-0xFF24475B,
-0xFF27536C,
-0xFF265573,
-0xFF2C6183,
-0xFF3B7299,
-0xFF3B79A2,
-0xFF34759B,
-0xFF2F7398,
-0xFF34789B,
-0xFF35769C,
-0xFF36719B,
-0xFF3B76A0,
-0xFF37769F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF3B80AA,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3A86B7,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8BBC,
-0xFF3C8CBD,
-0xFF3C8CBD,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3F8DBD,
-0xFF3F8DBD,
-0xFF408EBC,
-0xFF418FBD,
-0xFF428FBD,
-0xFF428FBD,
-0xFF428FBD,
-0xFF428FBD,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4690BD,
-0xFF4491BD,
-0xFF4690BD,
-0xFF4990BE,
-0xFF4990BE,
-0xFF4791BE,
-0xFF4792BC,
-0xFF4A91BD,
-0xFF4A91BD,
-0xFF4892BF,
-0xFF4693BF,
-0xFF4592BE,
-0xFF4E93BC,
-0xFF366C90,
-0xFF3E6A87,
-0xFF385B71,
-0xFFEBFFFF,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFCFEFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFCFC,
-0xFFF9FEFF,
-0xFFE7FDFF,
-0xFF274A5E,
-0xFF2B5973,
-0xFF2E6689,
-0xFF4B8FBC,
-0xFF428EBF,
-0xFF3E8CBC,
-0xFF3B8BBC,
-0xFF3C8CBD,
-0xFF3C8CBD,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3A8BBA,
-0xFF398AB9,
-0xFF398AB9,
-0xFF3C8ABA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3A87B3,
-0xFF3C86B3,
-0xFF3E84B7,
-0xFF3E84B7,
-0xFF3B86B0,
-0xFF3886AD,
-0xFF3885AF,
-0xFF3885B1,
-0xFF3983B0,
-0xFF3980AC,
-0xFF4180A9,
-0xFF4382A5,
-0xFF5392B1,
-0xFF51859B,
-0xFF9BB8C8,
-0xFFF5FFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFCFAFF,
-0xFFF8FFFF,
-0xFFC4E0EE,
-0xFF538BA6,
-0xFF61A1C4,
-0xFF477CA4,
-0xFF2D5D85,
-0xFF326384,
-0xFF326383,
-0xFF316282,
-0xFF336484,
-0xFF366788,
-0xFF346586,
-0xFF326384,
-0xFF346586,
-0xFF346687,
-0xFF346687,
-0xFF35678A,
-0xFF35678A,
-0xFF34698B,
-0xFF34698B,
-0xFF34698B,
-0xFF356A8C,
-0xFF346A8C,
-0xFF33698B,
-0xFF386A8D,
-0xFF39698D,
-0xFF36688D,
-0xFF346E93,
-0xFF539BC1,
-0xFF5495B5,
-0xFF8EB1C5,
-0xFFF2FFFF,
-0xFFF8FFFF,
-0xFFFFFFFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFF9FFFF,
-0xFF889EAC,
-0xFF1C3F55,
-0xFF2B536D,
-0xFF214F70,
-0xFF2A6084,
-0xFF377398,
-0xFF39799D,
-0xFF33749A,
-0xFF35769C,
-0xFF36769C,
-0xFF36749D,
-0xFF3977A0,
-0xFF37769F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF3679A3,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF377CA6,
-0xFF377CA6,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3881AE,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3983B2,
-0xFF3A84B3,
-0xFF3885B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A86B7,
-0xFF3A86B7,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B8CBB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3C8CBD,
-0xFF3C8CBD,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3E8CBC,
-0xFF3F8DBD,
-0xFF3F8DBB,
-0xFF408EBC,
-0xFF418EBC,
-0xFF418EBC,
-0xFF418EBC,
-0xFF428FBD,
-0xFF448EBB,
-0xFF448EBB,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF458FBC,
-0xFF4491BD,
-0xFF4690BD,
-0xFF4790BD,
-0xFF488FBD,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4891BC,
-0xFF4791BE,
-0xFF4693C1,
-0xFF428FBB,
-0xFF4A95BF,
-0xFF4384AC,
-0xFF356788,
-0xFF365B75,
-0xFF7792A3,
-0xFFF2FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFAFBFD,
-0xFFFEFEFF,
-0xFFF8FFFF,
-0xFF8DAABA,
-0xFF254F68,
-0xFF275A79,
-0xFF3F7DA2,
-0xFF468CBD,
-0xFF3D8BBC,
-0xFF398BBB,
-0xFF3D8FBF,
-0xFF3B8DBD,
-0xFF3C8CBD,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3A8BBA,
-0xFF398AB9,
-0xFF3889B8,
-0xFF398AB9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3987B7,
-0xFF3A86B7,
-0xFF3B88B6,
-0xFF3C86B3,
-0xFF3D86B3,
-0xFF3E84B7,
-0xFF3C84B4,
-0xFF3B86AE,
-0xFF3886AD,
-0xFF3885AF,
-0xFF3784B0,
-0xFF3882B1,
-0xFF387FAB,
-0xFF4381A8,
-0xFF4B86A8,
-0xFF528EA8,
-0xFF4E7D8F,
-0xFFE2F6FF,
-0xFFFAFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFCFBFF,
-0xFFF1FFFF,
-0xFF87ACBE,
-0xFF639CB9,
-0xFF64A3C6,
-0xFF2C6087,
-0xFF356289,
-0xFF346284,
-0xFF326081,
-0xFF316282,
-0xFF346585,
-0xFF346585,
-0xFF336484,
-0xFF346586,
-0xFF336485,
-0xFF346687,
-0xFF346687,
-0xFF35678A,
-0xFF35678A,
-0xFF36688B,
-0xFF36688B,
-0xFF36688B,
-0xFF34698B,
-0xFF346A8C,
-0xFF33698B,
-0xFF37698C,
-0xFF39698D,
-0xFF38688E,
-0xFF32688E,
-0xFF5498BD,
-0xFF599AB8,
-0xFF739DB3,
-0xFFEEFFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFBF9,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFF9FFFF,
-0xFFA2B3C3,
-0xFF1A3C55,
-0xFF2A5774,
-0xFF215471,
-0xFF2B6481,
-0xFF347396,
-0xFF38789E,
-0xFF36759E,
-0xFF35749D,
-0xFF37769F,
-0xFF37769F,
-0xFF36779F,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF397AA4,
-0xFF397AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF377CA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF387FAB,
-0xFF387FAB,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3881AC,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3C89B7,
-0xFF3C89B7,
-0xFF3C89B7,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3C8ABA,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3A8CBB,
-0xFF3B8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3D8EBD,
-0xFF3D8EBD,
-0xFF3F8DBB,
-0xFF3F8DBB,
-0xFF408EBC,
-0xFF408EBC,
-0xFF418EBC,
-0xFF428FBD,
-0xFF428FBB,
-0xFF4390BC,
-0xFF4390BC,
-0xFF4390BC,
-0xFF458FBE,
-0xFF458FBE,
-0xFF458FBC,
-0xFF4790BD,
-0xFF488FBB,
-0xFF488FBB,
-0xFF4690BD,
-0xFF4592BE,
-0xFF4492C0,
-0xFF4592BE,
-0xFF5196C0,
-0xFF2E6A8F,
-0xFF2B5A78,
-0xFF2C4F63,
-0xFFCFE2F0,
-0xFFF5FEFF,
-0xFFF9FDFF,
-0xFFFDFDFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFEFFDFF,
-0xFF2F5266,
-0xFF20526D,
-0xFF225D7F,
-0xFF4889B3,
-0xFF438DBE,
-0xFF3D8DC0,
-0xFF3C8FC1,
-0xFF388BBD,
-0xFF3B8DBD,
-0xFF3B8DBD,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3B8BBC,
-0xFF3A8ABB,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A86B7,
-0xFF3A86B7,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3C86B3,
-0xFF3D86B3,
-0xFF3C84B4,
-0xFF3B85B2,
-0xFF3886AD,
-0xFF3886AD,
-0xFF3983B0,
-0xFF3983B2,
-0xFF3C84B6,
-0xFF3A7EAB,
-0xFF4381A8,
-0xFF4E87A5,
-0xFF4B7F95,
-0xFF749AA7,
-0xFFF5FFFF,
-0xFFFCFCFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFCFE,
-0xFFFCFFFF,
-0xFFDFF9FF,
-0xFF6390A7,
-0xFF649DBB,
-0xFF5490B2,
-0xFF2B5D82,
-0xFF335F84,
-0xFF346284,
-0xFF326081,
-0xFF326383,
-0xFF336484,
-0xFF316282,
-0xFF336484,
-0xFF366788,
-0xFF346586,
-0xFF336586,
-0xFF346687,
-0xFF35678A,
-0xFF35678A,
-0xFF36688B,
-0xFF36688B,
-0xFF36688B,
-0xFF34698B,
-0xFF356B8D,
-0xFF346A8C,
-0xFF37698C,
-0xFF39698D,
-0xFF3A678E,
-0xFF306489,
-0xFF5595B9,
-0xFF5B9CBA,
-0xFF5D8DA3,
-0xFFE6FFFF,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFEFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFF7FDFF,
-0xFFA7BDD2,
-0xFF1C4058,
-0xFF2E5C73,
-0xFF215771,
-0xFF2A6381,
-0xFF387498,
-0xFF39749E,
-0xFF3774A0,
-0xFF3778A2,
-0xFF31749E,
-0xFF36779F,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF397AA4,
-0xFF387BA5,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF3A7EAB,
-0xFF387FAB,
-0xFF377EAA,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3881AC,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3C89B7,
-0xFF3C89B7,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3A8CBB,
-0xFF3B8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3F8DBB,
-0xFF3F8DBB,
-0xFF408EBC,
-0xFF408EBC,
-0xFF418EBC,
-0xFF428FBD,
-0xFF428FBB,
-0xFF428FBB,
-0xFF4390BC,
-0xFF4390BE,
-0xFF458FC0,
-0xFF458FC0,
-0xFF4390BE,
-0xFF458FBC,
-0xFF498DBA,
-0xFF488FBB,
-0xFF4491BD,
-0xFF4391BF,
-0xFF4192BF,
-0xFF448EBB,
-0xFF498AB2,
-0xFF215779,
-0xFF2B5770,
-0xFF456272,
-0xFFF5FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFBFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFBFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFEFDFB,
-0xFFFFFFFF,
-0xFFF6FDFF,
-0xFFBFD2E0,
-0xFF1C455B,
-0xFF1E5573,
-0xFF2C6C92,
-0xFF4C93BF,
-0xFF3E87BA,
-0xFF3C8CBF,
-0xFF398CBE,
-0xFF378DBE,
-0xFF3B8DBD,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3989BA,
-0xFF3888B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3987B7,
-0xFF3987B7,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3C84B4,
-0xFF3C84B4,
-0xFF3B85B2,
-0xFF3885B1,
-0xFF3885AF,
-0xFF3784AE,
-0xFF3882AF,
-0xFF3981B1,
-0xFF3880B0,
-0xFF3A7EAB,
-0xFF4482A7,
-0xFF4E84A0,
-0xFF4D7889,
-0xFFBCD8E3,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFF6FFFC,
-0xFFFAFFFB,
-0xFFFEFFFD,
-0xFFFCFBFF,
-0xFFFFFEFF,
-0xFFFFFDFC,
-0xFFF8FFFF,
-0xFFA2C7D9,
-0xFF659BB5,
-0xFF6EA5C3,
-0xFF39708F,
-0xFF2B5B7F,
-0xFF346286,
-0xFF326082,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF326383,
-0xFF326383,
-0xFF336485,
-0xFF336485,
-0xFF336485,
-0xFF356687,
-0xFF35678A,
-0xFF346689,
-0xFF346689,
-0xFF36688B,
-0xFF36688B,
-0xFF34698B,
-0xFF356B8D,
-0xFF33698B,
-0xFF356A8C,
-0xFF386A8D,
-0xFF3E6A8F,
-0xFF37678D,
-0xFF4682A6,
-0xFF65A4C3,
-0xFF5C92AA,
-0xFFC6EBFB,
-0xFFF7FEFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFDF9,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDFDFB,
-0xFFFEFFFD,
-0xFFF8FCFD,
-0xFFFCFFFF,
-0xFFFDFDFF,
-0xFFFCFFFF,
-0xFFF5FEFF,
-0xFFB2C8D5,
-0xFF1C4559,
-0xFF275B73,
-0xFF285B76,
-0xFF295E7E,
-0xFF3C739A,
-0xFF36739F,
-0xFF3679A4,
-0xFF3378A2,
-0xFF3576A0,
-0xFF3877A0,
-0xFF3877A0,
-0xFF37769F,
-0xFF3778A0,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3778A0,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA6,
-0xFF397CA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3C86B3,
-0xFF3D87B4,
-0xFF3D87B4,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3C8ABA,
-0xFF3C8ABA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3A8ABB,
-0xFF388ABA,
-0xFF398BBB,
-0xFF3A8CBC,
-0xFF3B8DBD,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3F8DBD,
-0xFF3F8DBD,
-0xFF3F8DBB,
-0xFF3F8DBB,
-0xFF418EBC,
-0xFF428FBD,
-0xFF428FBD,
-0xFF4390BE,
-0xFF428EBF,
-0xFF428EBF,
-0xFF428FBD,
-0xFF458FBC,
-0xFF478EBA,
-0xFF478EBA,
-0xFF428FBB,
-0xFF3F90BD,
-0xFF4290BE,
-0xFF4D96BF,
-0xFF2D6B90,
-0xFF225373,
-0xFF20445A,
-0xFF9EB4C2,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFDFF,
-0xFFF5FFFF,
-0xFF597485,
-0xFF25516A,
-0xFF155070,
-0xFF4388B1,
-0xFF458FBE,
-0xFF3E87BA,
-0xFF3C8ABB,
-0xFF398DBC,
-0xFF398FBE,
-0xFF398BBB,
-0xFF398BBB,
-0xFF3A8ABB,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3987B7,
-0xFF3A88B8,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3C84B6,
-0xFF3D87B6,
-0xFF3986B2,
-0xFF3685AE,
-0xFF3784B0,
-0xFF3784B0,
-0xFF3882B1,
-0xFF3981B1,
-0xFF3A81AF,
-0xFF3D80AB,
-0xFF4181A4,
-0xFF4B7E99,
-0xFF537382,
-0xFFF2FFFF,
-0xFFFAFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFBFC,
-0xFFFBFFFF,
-0xFFF9FFFD,
-0xFFFCFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFF2FFFF,
-0xFF72A1B5,
-0xFF65A1BD,
-0xFF6CA2BE,
-0xFF2A5B7B,
-0xFF316283,
-0xFF326082,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF326383,
-0xFF326383,
-0xFF336485,
-0xFF346586,
-0xFF346586,
-0xFF356687,
-0xFF35678A,
-0xFF35678A,
-0xFF35678A,
-0xFF36688B,
-0xFF37698C,
-0xFF36688B,
-0xFF356A8C,
-0xFF32688A,
-0xFF346A8C,
-0xFF37698C,
-0xFF3B698D,
-0xFF37678D,
-0xFF3B759A,
-0xFF69A8C7,
-0xFF629EB6,
-0xFF9DC8D9,
-0xFFF5FFFF,
-0xFFFFFDFF,
-0xFFFBFFFF,
-0xFFFAFFFF,
-0xFFFFFFFB,
-0xFFFFFDF8,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFF9FAFF,
-0xFFFEFFFF,
-0xFFF5FFFF,
-0xFFBBD7E5,
-0xFF1F485C,
-0xFF2E5B72,
-0xFF295A78,
-0xFF2D6387,
-0xFF39749C,
-0xFF32739D,
-0xFF31749F,
-0xFF34759F,
-0xFF36759E,
-0xFF3877A0,
-0xFF3978A1,
-0xFF3778A0,
-0xFF36779F,
-0xFF3879A1,
-0xFF397AA2,
-0xFF3679A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3C86B3,
-0xFF3C86B3,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3989BA,
-0xFF398BBB,
-0xFF3A8CBC,
-0xFF3A8CBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3E8CBC,
-0xFF3E8CBC,
-0xFF3E8CBA,
-0xFF3F8DBB,
-0xFF408DBB,
-0xFF418EBC,
-0xFF418EBC,
-0xFF428EBF,
-0xFF418FC0,
-0xFF428EBF,
-0xFF428FBD,
-0xFF438DBA,
-0xFF458EBB,
-0xFF468FBC,
-0xFF4390BE,
-0xFF418FBD,
-0xFF4592BE,
-0xFF4A8FB8,
-0xFF1A5577,
-0xFF28546F,
-0xFF284557,
-0xFFF0FFFF,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFAFB,
-0xFFFFFFFF,
-0xFFFDFFFC,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFE8FBFF,
-0xFF23465C,
-0xFF245671,
-0xFF29688B,
-0xFF408AB7,
-0xFF3E8CBD,
-0xFF3E8ABC,
-0xFF3E8ABC,
-0xFF3B8DBD,
-0xFF378BBA,
-0xFF398BBB,
-0xFF398BBB,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3985B6,
-0xFF3A81B5,
-0xFF3B85B6,
-0xFF3786AF,
-0xFF3486AE,
-0xFF3784B0,
-0xFF3983B2,
-0xFF3981B1,
-0xFF3B82B0,
-0xFF3A7FA9,
-0xFF3D7EA6,
-0xFF4382A3,
-0xFF427289,
-0xFFA1B7C5,
-0xFFF9FFFF,
-0xFFFBFDFC,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFDFB,
-0xFFFBFFFF,
-0xFFFBFFFD,
-0xFFF8FDF9,
-0xFFFCFCFA,
-0xFFFEFCFF,
-0xFFFDFCFF,
-0xFFF8FFFF,
-0xFFC9E4ED,
-0xFF6197AF,
-0xFF6CACC8,
-0xFF52849F,
-0xFF2C5976,
-0xFF336182,
-0xFF316283,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF356384,
-0xFF336485,
-0xFF346586,
-0xFF346586,
-0xFF356687,
-0xFF366788,
-0xFF366788,
-0xFF35678A,
-0xFF36688B,
-0xFF36688B,
-0xFF36688B,
-0xFF356A8C,
-0xFF32688A,
-0xFF33698B,
-0xFF356A8C,
-0xFF39668D,
-0xFF39698F,
-0xFF31698E,
-0xFF67A4C3,
-0xFF66A4BD,
-0xFF74A3B5,
-0xFFF2FFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFCF9,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFF9FAFE,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFCCDFED,
-0xFF23495E,
-0xFF31607A,
-0xFF295C79,
-0xFF285E80,
-0xFF3D78A2,
-0xFF3978A3,
-0xFF37769F,
-0xFF36769C,
-0xFF37779D,
-0xFF39799F,
-0xFF3778A0,
-0xFF35769E,
-0xFF36779F,
-0xFF3A7BA3,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF397CA6,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3B80AA,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3B84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B4,
-0xFF3C86B5,
-0xFF3D87B6,
-0xFF3E88B7,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3B89BA,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3C8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3C8DBC,
-0xFF3E8CBC,
-0xFF3E8CBC,
-0xFF3F8DBD,
-0xFF3F8DBD,
-0xFF3E8EBF,
-0xFF418FBF,
-0xFF438DBC,
-0xFF438CB9,
-0xFF428CB9,
-0xFF4390BE,
-0xFF4390BE,
-0xFF418EBC,
-0xFF448DB8,
-0xFF3A7BA1,
-0xFF205775,
-0xFF244D63,
-0xFF748A98,
-0xFFF7FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFCFB,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFCFEFD,
-0xFFF5FFFF,
-0xFF8FAABD,
-0xFF204A63,
-0xFF215877,
-0xFF3F80A6,
-0xFF3F8CBA,
-0xFF3989BC,
-0xFF3F8BBC,
-0xFF3D89BA,
-0xFF3D8EBD,
-0xFF388AB9,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3885B3,
-0xFF3884B5,
-0xFF3980B4,
-0xFF3983B4,
-0xFF3486AE,
-0xFF3486AC,
-0xFF3784B2,
-0xFF3781B0,
-0xFF3881AE,
-0xFF3C81AB,
-0xFF3D81A8,
-0xFF3A799C,
-0xFF417A97,
-0xFF426B7F,
-0xFFE6F4FF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFCFA,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFAFFFE,
-0xFFFCFEFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFF2FFFF,
-0xFF8BAFBD,
-0xFF6EA7C2,
-0xFF70AFCE,
-0xFF2F617C,
-0xFF36627D,
-0xFF315E7F,
-0xFF336182,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF336485,
-0xFF346586,
-0xFF336485,
-0xFF346586,
-0xFF356687,
-0xFF356687,
-0xFF346689,
-0xFF35678A,
-0xFF35678A,
-0xFF36688B,
-0xFF34698B,
-0xFF34698B,
-0xFF346A8C,
-0xFF346A8C,
-0xFF37678D,
-0xFF3A6A90,
-0xFF2E648A,
-0xFF5591B3,
-0xFF6BABC6,
-0xFF6699AE,
-0xFFDDF4FF,
-0xFFF6FEFF,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFEFE,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFF9FDFE,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFF8FFFF,
-0xFFD1EBFA,
-0xFF294F62,
-0xFF2F5F76,
-0xFF2D637F,
-0xFF2E648A,
-0xFF336D95,
-0xFF3B79A0,
-0xFF37779D,
-0xFF35759B,
-0xFF36769C,
-0xFF36779F,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3C86B5,
-0xFF3D87B6,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3989BA,
-0xFF3A8ABB,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3A8BBA,
-0xFF3B8CBB,
-0xFF3C8DBC,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3B8CBB,
-0xFF3D8BBB,
-0xFF3E8CBC,
-0xFF3E8CBC,
-0xFF3C8DBC,
-0xFF3C8EBE,
-0xFF3D8EBD,
-0xFF428CBB,
-0xFF438DBA,
-0xFF418EBC,
-0xFF408EBC,
-0xFF408CBD,
-0xFF428CBB,
-0xFF4E93BD,
-0xFF266588,
-0xFF275A75,
-0xFF234659,
-0xFFD8E8F5,
-0xFFF9FEFF,
-0xFFFFFFFF,
-0xFFFEFDFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFCFB,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFEEFFFF,
-0xFF395D73,
-0xFF2D607F,
-0xFF225E82,
-0xFF478CB5,
-0xFF3F8DBD,
-0xFF388ABC,
-0xFF3E8ABB,
-0xFF3B88B6,
-0xFF3C8ABA,
-0xFF3A8BBA,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3A83B6,
-0xFF3882B3,
-0xFF3584AD,
-0xFF3685AC,
-0xFF3882AF,
-0xFF3880B0,
-0xFF3980AC,
-0xFF3C81AA,
-0xFF3E7EA2,
-0xFF3B7694,
-0xFF3D6F88,
-0xFF7091A2,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFEFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFB,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFCFDFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFF7FEFF,
-0xFFDEF8FF,
-0xFF6E98AE,
-0xFF73ACC9,
-0xFF5B98B5,
-0xFF2A5977,
-0xFF345D7B,
-0xFF356080,
-0xFF325F80,
-0xFF326081,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF356384,
-0xFF356384,
-0xFF336485,
-0xFF346586,
-0xFF346586,
-0xFF356687,
-0xFF346689,
-0xFF346689,
-0xFF35678A,
-0xFF35678A,
-0xFF35678C,
-0xFF34698B,
-0xFF356B8D,
-0xFF33698B,
-0xFF38688E,
-0xFF39698F,
-0xFF32688E,
-0xFF3C7799,
-0xFF75B2CE,
-0xFF6EA2B8,
-0xFFA3C2D6,
-0xFFF1FFFF,
-0xFFF6FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFAFEFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFCFBFF,
-0xFFF8FFFF,
-0xFFD8EEF9,
-0xFF2E576B,
-0xFF2E607B,
-0xFF326383,
-0xFF31658A,
-0xFF377398,
-0xFF36769C,
-0xFF37779D,
-0xFF36769C,
-0xFF37769F,
-0xFF3877A0,
-0xFF3778A0,
-0xFF36779F,
-0xFF3879A1,
-0xFF3879A1,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397CA7,
-0xFF3A7DA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3C86B5,
-0xFF3D87B6,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3C8ABA,
-0xFF3C8ABA,
-0xFF398AB9,
-0xFF3A8BBA,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3D8BBC,
-0xFF3B8BBC,
-0xFF3C8EBD,
-0xFF3C8DBC,
-0xFF3F8CBA,
-0xFF418EBC,
-0xFF408EBE,
-0xFF3C8DBC,
-0xFF3F8DBE,
-0xFF468EBE,
-0xFF4184AE,
-0xFF1D5878,
-0xFF2C5A71,
-0xFF486877,
-0xFFF3FFFF,
-0xFFFCFFFF,
-0xFFFDFDFD,
-0xFFFFFEFC,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFC,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF1FEFF,
-0xFFBAD4E1,
-0xFF25516A,
-0xFF266183,
-0xFF2F729C,
-0xFF448EBB,
-0xFF3D8BBC,
-0xFF3A8ABB,
-0xFF3B89B9,
-0xFF3A88B6,
-0xFF3A86B7,
-0xFF3C8ABA,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3885B3,
-0xFF3B85B6,
-0xFF3781B0,
-0xFF3683AD,
-0xFF3785AC,
-0xFF3881AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3C80A7,
-0xFF377697,
-0xFF417791,
-0xFF3F6578,
-0xFFC0D6E3,
-0xFFFCFFFF,
-0xFFFFFCFF,
-0xFFFFFFFF,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFDFCFF,
-0xFFFEFDFF,
-0xFFFEFFFF,
-0xFFFAFCFB,
-0xFFFDFDFD,
-0xFFF7FFFF,
-0xFFA5C5DC,
-0xFF6C9DBB,
-0xFF74ADCA,
-0xFF366F8C,
-0xFF32617F,
-0xFF305B7B,
-0xFF386181,
-0xFF325D7D,
-0xFF336081,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF356384,
-0xFF356384,
-0xFF346586,
-0xFF346586,
-0xFF346586,
-0xFF356687,
-0xFF35678A,
-0xFF346689,
-0xFF35678A,
-0xFF36688B,
-0xFF35678C,
-0xFF326789,
-0xFF356B8D,
-0xFF316789,
-0xFF37698E,
-0xFF36678F,
-0xFF356C93,
-0xFF2B658A,
-0xFF67A2C0,
-0xFF76AAC2,
-0xFF759BB0,
-0xFFE8FFFF,
-0xFFF8FFFF,
-0xFFFBFCFE,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFCFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF5F9FC,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFF6FFFF,
-0xFFDDF9FF,
-0xFF345D73,
-0xFF315F79,
-0xFF2E6383,
-0xFF2D698D,
-0xFF327298,
-0xFF38789E,
-0xFF38789E,
-0xFF37769F,
-0xFF37769F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3882AF,
-0xFF3983B0,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3D87B6,
-0xFF3C88B9,
-0xFF3B87B8,
-0xFF3987B7,
-0xFF3987B7,
-0xFF3A88B8,
-0xFF3B89B9,
-0xFF3A88B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF398AB9,
-0xFF398AB9,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3B8BBC,
-0xFF3D8BBC,
-0xFF3B8BBC,
-0xFF3C8EBD,
-0xFF3B8DBC,
-0xFF3D8BB9,
-0xFF3E8CBA,
-0xFF3D8EBD,
-0xFF3C8DBC,
-0xFF408EBF,
-0xFF478FBF,
-0xFF2E6F97,
-0xFF2A6180,
-0xFF275064,
-0xFFAAC5D0,
-0xFFF6FFFF,
-0xFFF8FCFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFAFFFF,
-0xFFF1FFFF,
-0xFF5D7E91,
-0xFF2D5E7C,
-0xFF236387,
-0xFF3E87B4,
-0xFF3E8CBD,
-0xFF3A88B9,
-0xFF3A8ABB,
-0xFF398AB9,
-0xFF3D8BBB,
-0xFF3A86B7,
-0xFF3D89BA,
-0xFF3B87B8,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3A84B3,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3A84B3,
-0xFF3680AF,
-0xFF3883AD,
-0xFF3A83AC,
-0xFF3980AA,
-0xFF3C81AB,
-0xFF3D82AC,
-0xFF3B7CA2,
-0xFF347190,
-0xFF3D6F86,
-0xFF516E7E,
-0xFFF2FFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFDFDFF,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFF2FFFF,
-0xFF7299B6,
-0xFF6CA2C6,
-0xFF669DBB,
-0xFF245A76,
-0xFF306181,
-0xFF346182,
-0xFF365F7F,
-0xFF365F7F,
-0xFF336081,
-0xFF326081,
-0xFF336182,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF356384,
-0xFF346586,
-0xFF336485,
-0xFF346586,
-0xFF356687,
-0xFF36668A,
-0xFF356589,
-0xFF35678A,
-0xFF36688B,
-0xFF36688D,
-0xFF326789,
-0xFF346A8C,
-0xFF316789,
-0xFF386A8F,
-0xFF33678E,
-0xFF356C93,
-0xFF2C668B,
-0xFF49809F,
-0xFF73A6C1,
-0xFF6B99B0,
-0xFFB5D6E5,
-0xFFF8FFFF,
-0xFFFDFBFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFDFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFF9FFFF,
-0xFFE4FAFF,
-0xFF356279,
-0xFF2B6482,
-0xFF276689,
-0xFF2D6D93,
-0xFF34749A,
-0xFF37779D,
-0xFF37779D,
-0xFF37779D,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A3,
-0xFF3879A3,
-0xFF3679A3,
-0xFF3679A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3882AF,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3C86B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3987B7,
-0xFF3987B7,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF398AB9,
-0xFF398AB9,
-0xFF3989BA,
-0xFF3989BA,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3A8ABB,
-0xFF3B8BBC,
-0xFF3B8BBE,
-0xFF3B8BBE,
-0xFF3B8BBE,
-0xFF3B8BBC,
-0xFF3A8CBB,
-0xFF3B8DBC,
-0xFF3B8EBA,
-0xFF3A8BB8,
-0xFF3D8BBB,
-0xFF3F8DBE,
-0xFF3F8DBE,
-0xFF3F89B6,
-0xFF236389,
-0xFF2C5F7C,
-0xFF2B4E61,
-0xFFEEFFFF,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFCFCFC,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFEFE,
-0xFFFDFDFD,
-0xFFFFFFFF,
-0xFFF6FDFF,
-0xFFE4FBFF,
-0xFF2D536A,
-0xFF306786,
-0xFF2B6F96,
-0xFF408CBE,
-0xFF3989BE,
-0xFF3987B8,
-0xFF3B89B9,
-0xFF388ABA,
-0xFF3B8CBB,
-0xFF3C88B9,
-0xFF3E88B9,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3D87B6,
-0xFF3C86B5,
-0xFF3C86B5,
-0xFF3B85B4,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3784B0,
-0xFF3784B0,
-0xFF3983B0,
-0xFF3680AD,
-0xFF3A81AF,
-0xFF3A81AD,
-0xFF3A7FA8,
-0xFF3D81A8,
-0xFF3C7FA9,
-0xFF34759B,
-0xFF326F8B,
-0xFF336276,
-0xFF98AEB9,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFDFDFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFCFDFF,
-0xFFFBFFFF,
-0xFFF5FDFF,
-0xFFC6DCE9,
-0xFF6695B3,
-0xFF68A2C7,
-0xFF4A7F9F,
-0xFF2A5B7B,
-0xFF2C5D7E,
-0xFF325F80,
-0xFF37607E,
-0xFF37607E,
-0xFF325F7E,
-0xFF326081,
-0xFF336182,
-0xFF336182,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF336485,
-0xFF336485,
-0xFF336485,
-0xFF356687,
-0xFF356589,
-0xFF346488,
-0xFF346689,
-0xFF35678A,
-0xFF39698D,
-0xFF336588,
-0xFF346A8C,
-0xFF31698A,
-0xFF356B8F,
-0xFF32688E,
-0xFF346B92,
-0xFF366E93,
-0xFF33688A,
-0xFF6A9FBE,
-0xFF6EA4BE,
-0xFF6D98AB,
-0xFFEDFFFF,
-0xFFFBFFFF,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFC,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFAFBFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFDFDFD,
-0xFFFFFEFD,
-0xFFFFFAFA,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE4FFFF,
-0xFF3C6C83,
-0xFF2F6886,
-0xFF2D698D,
-0xFF2E6C91,
-0xFF34749A,
-0xFF37769F,
-0xFF36779F,
-0xFF36779F,
-0xFF36779F,
-0xFF3778A0,
-0xFF3778A0,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3679A3,
-0xFF3679A4,
-0xFF377AA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA6,
-0xFF397CA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF387FAB,
-0xFF387FAB,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3980AE,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3C86B5,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF3B89B9,
-0xFF398AB9,
-0xFF3B89BA,
-0xFF3989BA,
-0xFF3B89BA,
-0xFF3989BA,
-0xFF3C8ABB,
-0xFF3A8ABB,
-0xFF3D8ABE,
-0xFF3B8BBE,
-0xFF3D8ABE,
-0xFF3B8BBC,
-0xFF388ABA,
-0xFF3C8EBD,
-0xFF3C8FBB,
-0xFF398AB9,
-0xFF3D8BBC,
-0xFF408EBF,
-0xFF3C88B9,
-0xFF377EAA,
-0xFF256388,
-0xFF2D5C76,
-0xFF7C97A8,
-0xFFF4FFFF,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFBF9FA,
-0xFFF8FFFF,
-0xFF86A5B7,
-0xFF30627D,
-0xFF28688C,
-0xFF3A83AE,
-0xFF3B88BC,
-0xFF3A8ABF,
-0xFF3C89BD,
-0xFF3D89BB,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A86B7,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3D87B6,
-0xFF3C86B5,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3983B0,
-0xFF3683AF,
-0xFF3683AF,
-0xFF3983B0,
-0xFF3881AC,
-0xFF3D81AE,
-0xFF3C81AB,
-0xFF397EA7,
-0xFF3C7FA9,
-0xFF3B7CA4,
-0xFF306F92,
-0xFF366C86,
-0xFF335A6B,
-0xFFF2FFFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFCFE,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFF4FFFF,
-0xFFF0FFFF,
-0xFF81A4B8,
-0xFF629BB6,
-0xFF69A8C9,
-0xFF29597F,
-0xFF305C81,
-0xFF346083,
-0xFF315C7E,
-0xFF365F7B,
-0xFF37607C,
-0xFF33607D,
-0xFF33607F,
-0xFF326081,
-0xFF326081,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF336485,
-0xFF336485,
-0xFF336387,
-0xFF346488,
-0xFF356589,
-0xFF356589,
-0xFF346689,
-0xFF36668A,
-0xFF39658A,
-0xFF38668A,
-0xFF33698B,
-0xFF316C8C,
-0xFF316C8C,
-0xFF336B8E,
-0xFF35698E,
-0xFF35698E,
-0xFF34688D,
-0xFF477FA2,
-0xFF67A3C5,
-0xFF679DB9,
-0xFF98BDD0,
-0xFFEEFFFF,
-0xFFF7FEFF,
-0xFFFFFFFF,
-0xFFFBFFFE,
-0xFFFCFFFF,
-0xFFFEFDFF,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFECFFFF,
-0xFF406D84,
-0xFF346B8A,
-0xFF316B90,
-0xFF2C6A91,
-0xFF3677A1,
-0xFF33739F,
-0xFF3677A1,
-0xFF36779F,
-0xFF34759D,
-0xFF38799F,
-0xFF3A7BA1,
-0xFF397AA0,
-0xFF37789E,
-0xFF3879A3,
-0xFF387BA8,
-0xFF377BA8,
-0xFF377CA6,
-0xFF377CA5,
-0xFF377CA6,
-0xFF377CA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397DAA,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3A81AD,
-0xFF3C80AD,
-0xFF3A81AD,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3986B2,
-0xFF3A87B3,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3A88B6,
-0xFF3A88B6,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3B89B9,
-0xFF3D89BA,
-0xFF3C8ABA,
-0xFF3C88B9,
-0xFF3B89B9,
-0xFF3C88BA,
-0xFF3C8ABB,
-0xFF3D89BB,
-0xFF3C8ABB,
-0xFF3D89BB,
-0xFF3C8ABB,
-0xFF398BBD,
-0xFF3A8CBC,
-0xFF3B8CBB,
-0xFF3F8DBD,
-0xFF3989BA,
-0xFF408EBE,
-0xFF438CB9,
-0xFF2A6B93,
-0xFF2D6586,
-0xFF2B556D,
-0xFFD8ECF7,
-0xFFF8FFFF,
-0xFFF9FDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFF4FFFF,
-0xFF3C697E,
-0xFF317194,
-0xFF26739F,
-0xFF3A8ABB,
-0xFF3C8ABB,
-0xFF3D89BB,
-0xFF3D89BD,
-0xFF3E87BA,
-0xFF3E86B6,
-0xFF3D87B4,
-0xFF3788B3,
-0xFF3588B4,
-0xFF3B89B7,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3A87B5,
-0xFF3B85B4,
-0xFF3C84B4,
-0xFF3B84B1,
-0xFF3B84B1,
-0xFF3C85B2,
-0xFF3C85B2,
-0xFF3B84B1,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3882AF,
-0xFF3683AF,
-0xFF3882AF,
-0xFF3881AE,
-0xFF4084B1,
-0xFF3A7FA8,
-0xFF3C81AA,
-0xFF397DAA,
-0xFF3B7EAB,
-0xFF3E7CA5,
-0xFF2F6587,
-0xFF37617A,
-0xFF6B8795,
-0xFFF7FFFF,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFDFBFE,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFF9FFFF,
-0xFFF2FFFF,
-0xFFD4F3FF,
-0xFF618FA7,
-0xFF64A0BC,
-0xFF508BAB,
-0xFF2B597D,
-0xFF335A81,
-0xFF345E84,
-0xFF315C7E,
-0xFF37607C,
-0xFF345E77,
-0xFF34607D,
-0xFF33607F,
-0xFF326081,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF336485,
-0xFF336485,
-0xFF336387,
-0xFF346488,
-0xFF356589,
-0xFF356589,
-0xFF346689,
-0xFF36668A,
-0xFF396588,
-0xFF386688,
-0xFF33698B,
-0xFF306B8B,
-0xFF316C8C,
-0xFF336B8C,
-0xFF37698C,
-0xFF37698C,
-0xFF34688F,
-0xFF30678E,
-0xFF609EC3,
-0xFF5D9AB9,
-0xFF5D8FA6,
-0xFFD4F5FF,
-0xFFF3FFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFEFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFCFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF7FFFF,
-0xFFE9FFFF,
-0xFF46738A,
-0xFF356887,
-0xFF356F94,
-0xFF306F98,
-0xFF30739E,
-0xFF3376A0,
-0xFF3376A0,
-0xFF3879A1,
-0xFF37789E,
-0xFF38789E,
-0xFF38789E,
-0xFF3778A0,
-0xFF397AA4,
-0xFF367AA7,
-0xFF3579A6,
-0xFF367BA5,
-0xFF377CA5,
-0xFF377CA6,
-0xFF377CA6,
-0xFF377CA6,
-0xFF387DA7,
-0xFF387CA9,
-0xFF397DAA,
-0xFF397DAA,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3986B2,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3987B5,
-0xFF3987B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88BA,
-0xFF3C88BA,
-0xFF3D89BB,
-0xFF3D89BB,
-0xFF3C88BA,
-0xFF3B89BA,
-0xFF3A8ABD,
-0xFF398BBB,
-0xFF3D8BBB,
-0xFF3E8CBC,
-0xFF3888B9,
-0xFF3C8ABA,
-0xFF3F86B2,
-0xFF29678C,
-0xFF2E6180,
-0xFF527589,
-0xFFF4FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFB,
-0xFFFFFFFA,
-0xFFFFFEFA,
-0xFFFFFCFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFF9FFFF,
-0xFFBBD4DB,
-0xFF2D637D,
-0xFF287299,
-0xFF2D7EAD,
-0xFF3B8EC0,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3B87B9,
-0xFF3D86B9,
-0xFF3F85B6,
-0xFF3E87B4,
-0xFF3788B3,
-0xFF3689B3,
-0xFF3987B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3B85B4,
-0xFF3A84B3,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A83B0,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3C80AF,
-0xFF3478A5,
-0xFF3E83AA,
-0xFF3C81A8,
-0xFF3D81AE,
-0xFF3C7FAC,
-0xFF316B93,
-0xFF316283,
-0xFF34576D,
-0xFFC5D9E4,
-0xFFFCFFFF,
-0xFFFEFFFA,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFCFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFDFDFF,
-0xFFF3FFFF,
-0xFF95BED4,
-0xFF5C93B1,
-0xFF679DBF,
-0xFF37698C,
-0xFF2E5B7C,
-0xFF315C7C,
-0xFF325E81,
-0xFF305D7E,
-0xFF38617D,
-0xFF325B77,
-0xFF34607D,
-0xFF33607F,
-0xFF32617F,
-0xFF336280,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF336485,
-0xFF336485,
-0xFF336485,
-0xFF346586,
-0xFF336586,
-0xFF346687,
-0xFF346689,
-0xFF356589,
-0xFF39658A,
-0xFF38668A,
-0xFF33698D,
-0xFF326A8D,
-0xFF326A8B,
-0xFF346A8C,
-0xFF37698A,
-0xFF38698A,
-0xFF386A8F,
-0xFF31698E,
-0xFF39779C,
-0xFF6AA6C8,
-0xFF5E94B0,
-0xFF729BB1,
-0xFFEAFFFF,
-0xFFF3FFFF,
-0xFFFEFFFF,
-0xFFFFFCFD,
-0xFFFFFFFD,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFFEBFFFF,
-0xFF567F95,
-0xFF316685,
-0xFF336F93,
-0xFF31729A,
-0xFF357AA3,
-0xFF31769F,
-0xFF3578A2,
-0xFF37769F,
-0xFF37759C,
-0xFF37769F,
-0xFF3879A3,
-0xFF357AA4,
-0xFF357AA4,
-0xFF3479A3,
-0xFF367BA4,
-0xFF377BA2,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA6,
-0xFF397CA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397DAA,
-0xFF397DAA,
-0xFF397DAA,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3B80AA,
-0xFF3B80AA,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3A83AE,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3B89BA,
-0xFF3C8ABA,
-0xFF398AB9,
-0xFF3889B8,
-0xFF3B8CBB,
-0xFF3D8BBB,
-0xFF3E8BB9,
-0xFF3077A3,
-0xFF2B678C,
-0xFF2E5C76,
-0xFFAECBDB,
-0xFFF5FFFF,
-0xFFF9FDFE,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFCFF,
-0xFFFEFCFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFCFFFB,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF9FFFF,
-0xFFEEFFFF,
-0xFF5E8898,
-0xFF367392,
-0xFF2F7AA2,
-0xFF3A88B8,
-0xFF3688B8,
-0xFF3788B7,
-0xFF3987B5,
-0xFF3A86B7,
-0xFF3D87B8,
-0xFF3F85B6,
-0xFF3E86B6,
-0xFF3A88B6,
-0xFF3987B5,
-0xFF3B85B6,
-0xFF3B85B6,
-0xFF3986B4,
-0xFF3885B3,
-0xFF3785B3,
-0xFF3586B3,
-0xFF3586B1,
-0xFF3586B1,
-0xFF3485B0,
-0xFF3685B0,
-0xFF3683AD,
-0xFF3883AD,
-0xFF3A81AD,
-0xFF3C80AD,
-0xFF3C80AD,
-0xFF3D80AD,
-0xFF4082B2,
-0xFF3A7EAB,
-0xFF3B80A9,
-0xFF377CA5,
-0xFF3B80AA,
-0xFF3C7DA7,
-0xFF275E85,
-0xFF346180,
-0xFF405D6F,
-0xFFF4FFFF,
-0xFFF9FFFF,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFA,
-0xFFFFFFFD,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFF1FFFF,
-0xFF5A8DA8,
-0xFF5A99BC,
-0xFF5D8FB4,
-0xFF2C587B,
-0xFF345D7B,
-0xFF305C79,
-0xFF315E7F,
-0xFF315E7F,
-0xFF37607E,
-0xFF345D79,
-0xFF345F7F,
-0xFF33607F,
-0xFF32617F,
-0xFF32617F,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF326384,
-0xFF336485,
-0xFF336485,
-0xFF346586,
-0xFF336586,
-0xFF336586,
-0xFF346689,
-0xFF356589,
-0xFF376589,
-0xFF36668A,
-0xFF33678C,
-0xFF326A8D,
-0xFF326A8B,
-0xFF356A8A,
-0xFF38698A,
-0xFF3A688A,
-0xFF3B6D90,
-0xFF33698D,
-0xFF296589,
-0xFF4D89AD,
-0xFF67A0BE,
-0xFF5F8EAA,
-0xFF8BAFC7,
-0xFFEEFFFF,
-0xFFF9FCFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFBFFFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF1FEFF,
-0xFFEBFFFF,
-0xFF648A9F,
-0xFF386B88,
-0xFF347396,
-0xFF2E7299,
-0xFF357AA4,
-0xFF32759F,
-0xFF3675A0,
-0xFF38769F,
-0xFF3978A1,
-0xFF3879A3,
-0xFF3578A2,
-0xFF3479A2,
-0xFF367BA2,
-0xFF377BA2,
-0xFF377BA2,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA6,
-0xFF387BA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387CA9,
-0xFF387CA9,
-0xFF397DAA,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3C88B9,
-0xFF3B89BA,
-0xFF3A88B9,
-0xFF3A88B9,
-0xFF3A88B8,
-0xFF3C89B7,
-0xFF3C8AB8,
-0xFF3888B9,
-0xFF3989BA,
-0xFF3D8AB8,
-0xFF4089B6,
-0xFF286D97,
-0xFF336E90,
-0xFF375D72,
-0xFFEEFFFF,
-0xFFF6FFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFCFD,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFCFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFF2FFFF,
-0xFFD5F8FF,
-0xFF2F6581,
-0xFF3B7CA2,
-0xFF327BA6,
-0xFF3D8AB8,
-0xFF3A88B8,
-0xFF3889B6,
-0xFF3A88B6,
-0xFF3D87B6,
-0xFF3E86B6,
-0xFF3D85B7,
-0xFF3D85B7,
-0xFF3C86B5,
-0xFF3986B4,
-0xFF3B85B6,
-0xFF3B85B6,
-0xFF3A84B3,
-0xFF3885B3,
-0xFF3785B3,
-0xFF3586B3,
-0xFF3485B0,
-0xFF3485B0,
-0xFF3485B0,
-0xFF3685B0,
-0xFF3683AD,
-0xFF3883AD,
-0xFF3A81AD,
-0xFF3C80AD,
-0xFF3C81AB,
-0xFF3D80AB,
-0xFF397BAB,
-0xFF3C80AD,
-0xFF3A81AB,
-0xFF3981A9,
-0xFF3B80A7,
-0xFF2D6D91,
-0xFF2B6185,
-0xFF29526E,
-0xFF9BB1BF,
-0xFFF8FFFF,
-0xFFFAFFFF,
-0xFFFCFFFD,
-0xFFFAFEFD,
-0xFFFEFFFD,
-0xFFFDFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFDFFFC,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF8FBFF,
-0xFFBDD6EC,
-0xFF4C88AA,
-0xFF569AC1,
-0xFF44719A,
-0xFF30567A,
-0xFF365D7A,
-0xFF305C75,
-0xFF31607E,
-0xFF305E7F,
-0xFF325D7D,
-0xFF376080,
-0xFF335E7E,
-0xFF325F7E,
-0xFF33607F,
-0xFF33607F,
-0xFF33607F,
-0xFF346180,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF356384,
-0xFF336484,
-0xFF346585,
-0xFF346586,
-0xFF346586,
-0xFF346687,
-0xFF346687,
-0xFF356589,
-0xFF346689,
-0xFF32668B,
-0xFF32688C,
-0xFF33698B,
-0xFF37698A,
-0xFF3A688A,
-0xFF3B698A,
-0xFF356687,
-0xFF3C7193,
-0xFF2C668B,
-0xFF2E6A8F,
-0xFF5894B8,
-0xFF6199BA,
-0xFF598AAA,
-0xFFA1C4DA,
-0xFFF5FFFF,
-0xFFFCFFFF,
-0xFFF4FBFF,
-0xFFF7FEFF,
-0xFFFFFFFD,
-0xFFFFFEF9,
-0xFFFFFFFA,
-0xFFFEFDF9,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF1FFFF,
-0xFF6D93A6,
-0xFF316886,
-0xFF3A7BA3,
-0xFF3279A5,
-0xFF3676A2,
-0xFF3776A1,
-0xFF3776A1,
-0xFF3877A2,
-0xFF3778A0,
-0xFF37789E,
-0xFF38799F,
-0xFF397B9E,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA6,
-0xFF387BA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3A87B3,
-0xFF3A87B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B88B6,
-0xFF3B88B6,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B87B8,
-0xFF3D87B4,
-0xFF3E8BB9,
-0xFF3A8ABB,
-0xFF3888B9,
-0xFF3B88B6,
-0xFF357CA8,
-0xFF2E719B,
-0xFF316686,
-0xFF8AA7B7,
-0xFFF3FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFC,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF0FFFF,
-0xFF83B2D0,
-0xFF36779F,
-0xFF3578A5,
-0xFF3980AE,
-0xFF4087B5,
-0xFF3E87B4,
-0xFF3A88B6,
-0xFF3A88B6,
-0xFF3D87B4,
-0xFF3D85B5,
-0xFF3D85B7,
-0xFF3C83B7,
-0xFF3C84B6,
-0xFF3B83B3,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3A84B3,
-0xFF3983B2,
-0xFF3983B2,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3984AE,
-0xFF3984AE,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AB,
-0xFF3982AB,
-0xFF3881AA,
-0xFF387FA9,
-0xFF3B82B0,
-0xFF337AA8,
-0xFF347FA9,
-0xFF367FA8,
-0xFF3C82A6,
-0xFF205F80,
-0xFF2D607F,
-0xFF23475D,
-0xFFF2FFFF,
-0xFFFAFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFEFB,
-0xFFFDFFFA,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFBFFFC,
-0xFFFFFEFF,
-0xFFFBFDFF,
-0xFFF0FFFF,
-0xFF7097B6,
-0xFF5195BA,
-0xFF5499C2,
-0xFF2D5A81,
-0xFF35597D,
-0xFF355C79,
-0xFF305C75,
-0xFF31607C,
-0xFF305F7D,
-0xFF315C7E,
-0xFF345F81,
-0xFF335E7E,
-0xFF325F7E,
-0xFF325F7E,
-0xFF33607F,
-0xFF33607F,
-0xFF33607F,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF336484,
-0xFF346585,
-0xFF336485,
-0xFF346586,
-0xFF346586,
-0xFF346687,
-0xFF346687,
-0xFF346689,
-0xFF326789,
-0xFF33678C,
-0xFF34698B,
-0xFF36688B,
-0xFF3A688A,
-0xFF3B698B,
-0xFF38698A,
-0xFF346689,
-0xFF387095,
-0xFF326E93,
-0xFF2D6B90,
-0xFF5B99BE,
-0xFF5490B4,
-0xFF598AA8,
-0xFFAFCCDE,
-0xFFEAFCFF,
-0xFFF5FFFF,
-0xFFF8FFFF,
-0xFFFEFFFD,
-0xFFFFFEF7,
-0xFFFFFDFA,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFEFD,
-0xFFFFFEFA,
-0xFFFBFFFF,
-0xFFECFFFF,
-0xFF759EB2,
-0xFF326A8B,
-0xFF34759D,
-0xFF3A7AA6,
-0xFF3679A4,
-0xFF3477A2,
-0xFF3576A0,
-0xFF37779D,
-0xFF39799D,
-0xFF3A799C,
-0xFF38789B,
-0xFF38799F,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA2,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA6,
-0xFF387BA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3882AF,
-0xFF3882AF,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A86B7,
-0xFF3A86B7,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3A88B8,
-0xFF3B88B6,
-0xFF3D87B4,
-0xFF3B88B4,
-0xFF3888B9,
-0xFF3A8ABB,
-0xFF3C88B9,
-0xFF2B729E,
-0xFF35749D,
-0xFF2D5C78,
-0xFFE1F7FF,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFBFCFE,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFCF8,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFEDFFFF,
-0xFF3D749B,
-0xFF3B83B5,
-0xFF367CAD,
-0xFF4488B9,
-0xFF4588B5,
-0xFF3B82AE,
-0xFF3986B4,
-0xFF3886B4,
-0xFF3B85B2,
-0xFF3C85B2,
-0xFF3C83B7,
-0xFF3C83B7,
-0xFF3C84B4,
-0xFF3B83B3,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3A82B2,
-0xFF3A82B2,
-0xFF3A81AF,
-0xFF3A81AF,
-0xFF3B82AE,
-0xFF3A81AD,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AA,
-0xFF3780AB,
-0xFF367FAA,
-0xFF3680AD,
-0xFF3882B1,
-0xFF3380AC,
-0xFF3B86AE,
-0xFF30799A,
-0xFF175773,
-0xFF13425C,
-0xFF557284,
-0xFFF8FFFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFBFDF8,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFDFFFC,
-0xFFFFFEFF,
-0xFFF8FFFF,
-0xFFC8EFFF,
-0xFF4681A9,
-0xFF4C94BC,
-0xFF3C80A7,
-0xFF27577B,
-0xFF345B7C,
-0xFF335C7A,
-0xFF325E79,
-0xFF315F79,
-0xFF305D7A,
-0xFF315D80,
-0xFF325D80,
-0xFF335E80,
-0xFF335E7E,
-0xFF335E7E,
-0xFF345F7F,
-0xFF33607F,
-0xFF33607F,
-0xFF346180,
-0xFF346180,
-0xFF336182,
-0xFF346283,
-0xFF356384,
-0xFF356384,
-0xFF356384,
-0xFF336484,
-0xFF346585,
-0xFF356686,
-0xFF346786,
-0xFF346687,
-0xFF346689,
-0xFF35678A,
-0xFF35678C,
-0xFF36688B,
-0xFF38688C,
-0xFF38698A,
-0xFF366788,
-0xFF396B8E,
-0xFF32688C,
-0xFF2D678C,
-0xFF306E95,
-0xFF307096,
-0xFF5899C1,
-0xFF5191B5,
-0xFF4C85A3,
-0xFFA3CDE3,
-0xFFEFFFFF,
-0xFFFCFFFF,
-0xFFFDFDFD,
-0xFFFFFEFD,
-0xFFFFFDFB,
-0xFFFFFCFD,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFEFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFF9FDFE,
-0xFFFBFFFF,
-0xFFF1FFFF,
-0xFF83A7BD,
-0xFF3A6F91,
-0xFF3578A3,
-0xFF337CA9,
-0xFF347BA5,
-0xFF34789F,
-0xFF36769A,
-0xFF39789B,
-0xFF3C789C,
-0xFF39789B,
-0xFF39799F,
-0xFF38799F,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA4,
-0xFF397AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3881AC,
-0xFF3881AC,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3D87B4,
-0xFF3A87B3,
-0xFF3785B5,
-0xFF3C8ABB,
-0xFF3886B6,
-0xFF2E75A1,
-0xFF336D92,
-0xFF6189A2,
-0xFFEFFFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFF3FDFF,
-0xFFBAD8F0,
-0xFF3776A1,
-0xFF3784B8,
-0xFF3C83B7,
-0xFF3D83B4,
-0xFF4386B3,
-0xFF4186B0,
-0xFF3986B2,
-0xFF3886B4,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3985B7,
-0xFF3985B7,
-0xFF3B85B4,
-0xFF3B85B2,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A83B0,
-0xFF3982AF,
-0xFF3A81AF,
-0xFF3A81AF,
-0xFF3C80AF,
-0xFF3B7FAE,
-0xFF3A7EAD,
-0xFF3A7EAD,
-0xFF3B7FAE,
-0xFF3B7FAC,
-0xFF3A7EAD,
-0xFF367FAC,
-0xFF3280B0,
-0xFF3788B7,
-0xFF2A7BA8,
-0xFF25749B,
-0xFF05506F,
-0xFF04425B,
-0xFF0E394C,
-0xFFC2DAE6,
-0xFFF9FDFF,
-0xFFFFFFFD,
-0xFFFCFEFD,
-0xFFFAFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFCFEFD,
-0xFFFFFFFF,
-0xFFECFEFF,
-0xFF6EAACF,
-0xFF2A78A6,
-0xFF3D88B0,
-0xFF25678A,
-0xFF2C6181,
-0xFF305D7C,
-0xFF305D7E,
-0xFF325F7E,
-0xFF2E5C76,
-0xFF2F5D77,
-0xFF336183,
-0xFF305C81,
-0xFF336081,
-0xFF345F7F,
-0xFF345F7F,
-0xFF345F7F,
-0xFF33607F,
-0xFF346180,
-0xFF346180,
-0xFF346180,
-0xFF336182,
-0xFF346283,
-0xFF356384,
-0xFF356384,
-0xFF356384,
-0xFF356384,
-0xFF346585,
-0xFF356686,
-0xFF366787,
-0xFF356887,
-0xFF356788,
-0xFF35678A,
-0xFF35678C,
-0xFF35678C,
-0xFF36688D,
-0xFF36688B,
-0xFF35678A,
-0xFF36688B,
-0xFF386D8F,
-0xFF366E91,
-0xFF326E93,
-0xFF2C6C92,
-0xFF33779E,
-0xFF5098BE,
-0xFF4D95BB,
-0xFF45809E,
-0xFFA0C0CF,
-0xFFF2FFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFAFEFF,
-0xFFF0FFFF,
-0xFF8BAFC7,
-0xFF346E93,
-0xFF347BA5,
-0xFF3881AA,
-0xFF357DA5,
-0xFF34759B,
-0xFF37759A,
-0xFF39779C,
-0xFF3A789D,
-0xFF39799F,
-0xFF38799F,
-0xFF3879A1,
-0xFF3879A1,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA4,
-0xFF397AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA6,
-0xFF387BA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3882AF,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3885B1,
-0xFF3885B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3A87B5,
-0xFF3A86B7,
-0xFF3B87B8,
-0xFF3B87B8,
-0xFF3B88B6,
-0xFF3986B2,
-0xFF3D8AB6,
-0xFF3B88B6,
-0xFF3C88B9,
-0xFF2E7CAD,
-0xFF3478A5,
-0xFF316686,
-0xFFB6D7EA,
-0xFFF7FFFF,
-0xFFFEFEFC,
-0xFFFDFFFE,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFDFDFD,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFCFFFF,
-0xFFF0FFFF,
-0xFF668FAB,
-0xFF4084B1,
-0xFF3787BC,
-0xFF3A86B8,
-0xFF3C84B4,
-0xFF3E83AD,
-0xFF3E85AF,
-0xFF3986B2,
-0xFF3887B2,
-0xFF3986B2,
-0xFF3986B2,
-0xFF3886B7,
-0xFF3886B6,
-0xFF3885B1,
-0xFF3885AF,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3882AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3A81AF,
-0xFF3C80AF,
-0xFF3C80AF,
-0xFF3C80AF,
-0xFF3B7FB0,
-0xFF387EAF,
-0xFF387EAF,
-0xFF3880B0,
-0xFF3781B0,
-0xFF3582B0,
-0xFF3182B1,
-0xFF2579A8,
-0xFF156B9A,
-0xFF176B99,
-0xFF14668C,
-0xFF004764,
-0xFF064459,
-0xFF224757,
-0xFFF2FFFF,
-0xFFFEFFFF,
-0xFFFFFBFA,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFF9FFFF,
-0xFFE6FFFF,
-0xFF1B6C97,
-0xFF1E7EB0,
-0xFF29749B,
-0xFF094867,
-0xFF17506D,
-0xFF205370,
-0xFF2A587A,
-0xFF305E80,
-0xFF31607C,
-0xFF31607C,
-0xFF2E5F80,
-0xFF2D5E7F,
-0xFF325F80,
-0xFF325F7E,
-0xFF325F80,
-0xFF325F80,
-0xFF336081,
-0xFF336081,
-0xFF336081,
-0xFF336081,
-0xFF356283,
-0xFF356283,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF356384,
-0xFF366486,
-0xFF346585,
-0xFF346585,
-0xFF346585,
-0xFF356687,
-0xFF346689,
-0xFF35678C,
-0xFF33678C,
-0xFF34688D,
-0xFF34688D,
-0xFF35698E,
-0xFF356A8C,
-0xFF386A8D,
-0xFF356A8C,
-0xFF336B8E,
-0xFF306C91,
-0xFF2E6F95,
-0xFF2D7299,
-0xFF4C96BD,
-0xFF4C90B5,
-0xFF48819F,
-0xFF91B7CE,
-0xFFF1FFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFAFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFBFBF9,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF1FFFF,
-0xFF8EB6CF,
-0xFF387395,
-0xFF3A81AB,
-0xFF3680AD,
-0xFF397EA7,
-0xFF34759D,
-0xFF3879A1,
-0xFF3778A0,
-0xFF3778A0,
-0xFF36779F,
-0xFF36779F,
-0xFF3B7CA4,
-0xFF3879A1,
-0xFF397AA2,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA4,
-0xFF3A7BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3B80AA,
-0xFF3B80AA,
-0xFF3B80AA,
-0xFF3980AC,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3883AD,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3B85B2,
-0xFF3C86B3,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3A87B5,
-0xFF3C89B7,
-0xFF3885B3,
-0xFF3C86B3,
-0xFF3E88B7,
-0xFF2E7BAF,
-0xFF3477A4,
-0xFF3B6782,
-0xFFEDFFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFCFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFEFCFD,
-0xFFFFFEFD,
-0xFFF8FFFF,
-0xFFD6F5FF,
-0xFF457A9C,
-0xFF3D86B1,
-0xFF3B8DBC,
-0xFF3586B5,
-0xFF3786B1,
-0xFF3F8AB4,
-0xFF3883AB,
-0xFF3887B0,
-0xFF3586B1,
-0xFF3786B1,
-0xFF3684B2,
-0xFF3785B5,
-0xFF3785B3,
-0xFF3786AF,
-0xFF3786AD,
-0xFF3683AD,
-0xFF3984AE,
-0xFF3A83AE,
-0xFF3A81AD,
-0xFF3C80AF,
-0xFF3D81B0,
-0xFF3E80B2,
-0xFF3D7FB1,
-0xFF3A7EAF,
-0xFF3880B2,
-0xFF3682B3,
-0xFF3384B3,
-0xFF2C83B0,
-0xFF217CA8,
-0xFF14739F,
-0xFF0D6E9B,
-0xFF096999,
-0xFF11709E,
-0xFF166F9B,
-0xFF085C80,
-0xFF004C66,
-0xFF013C4E,
-0xFF8DABB5,
-0xFFF7FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFF9FEFF,
-0xFFF1FFFF,
-0xFF91C4D9,
-0xFF1675A1,
-0xFF1A83B3,
-0xFF156185,
-0xFF114E6A,
-0xFF114D67,
-0xFF144D68,
-0xFF194B6C,
-0xFF1D4E6F,
-0xFF225373,
-0xFF275876,
-0xFF2C5E7F,
-0xFF2F6182,
-0xFF2F5D7E,
-0xFF315F80,
-0xFF336081,
-0xFF336182,
-0xFF346182,
-0xFF336182,
-0xFF346182,
-0xFF336182,
-0xFF336081,
-0xFF336182,
-0xFF336182,
-0xFF346283,
-0xFF346283,
-0xFF346283,
-0xFF346284,
-0xFF346284,
-0xFF366787,
-0xFF366787,
-0xFF366787,
-0xFF356788,
-0xFF36688B,
-0xFF33678C,
-0xFF32688E,
-0xFF32688E,
-0xFF34688F,
-0xFF35698E,
-0xFF37698A,
-0xFF356A8A,
-0xFF346A8C,
-0xFF336B8E,
-0xFF316D92,
-0xFF2F6F95,
-0xFF2F729C,
-0xFF4D92BC,
-0xFF478CB5,
-0xFF457FA4,
-0xFF8EB0CB,
-0xFFEFFFFF,
-0xFFF1FFFF,
-0xFFF8FFFF,
-0xFFF9FDFF,
-0xFFFFFFFF,
-0xFFFEFAF9,
-0xFFFCFBF9,
-0xFFFFFFFB,
-0xFFFCFEFB,
-0xFFFCFEFD,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFF9FFFF,
-0xFFEDFFFF,
-0xFF9DC7DF,
-0xFF316B90,
-0xFF3F84AE,
-0xFF3F86B2,
-0xFF3980AC,
-0xFF2B6F9C,
-0xFF367BA5,
-0xFF377AA4,
-0xFF34759D,
-0xFF397AA2,
-0xFF36779F,
-0xFF3B7CA4,
-0xFF35769E,
-0xFF3A7BA3,
-0xFF3879A1,
-0xFF397AA4,
-0xFF397AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF387FAB,
-0xFF387FAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B2,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3885B3,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3986B4,
-0xFF3785B5,
-0xFF3C89B7,
-0xFF3B84AF,
-0xFF367FAC,
-0xFF347DB0,
-0xFF32719C,
-0xFF94B8CE,
-0xFFF0FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFDFE,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFBFB,
-0xFFF3FFFF,
-0xFF8EB7D3,
-0xFF4583AA,
-0xFF458EB7,
-0xFF3889B4,
-0xFF3586B3,
-0xFF3485B0,
-0xFF3885AF,
-0xFF3D88B2,
-0xFF3986B0,
-0xFF3887B2,
-0xFF3986B4,
-0xFF3985B6,
-0xFF3A84B5,
-0xFF3784B2,
-0xFF3483AC,
-0xFF3482A9,
-0xFF3A85AF,
-0xFF3A83AE,
-0xFF3881AC,
-0xFF3780AD,
-0xFF3780AD,
-0xFF3880B0,
-0xFF3882B1,
-0xFF3581B2,
-0xFF3785B5,
-0xFF2E80B0,
-0xFF2179A7,
-0xFF1672A1,
-0xFF0E6F9C,
-0xFF086F9A,
-0xFF056F99,
-0xFF046F9B,
-0xFF0972A1,
-0xFF0D6F9C,
-0xFF18759E,
-0xFF00496B,
-0xFF014B64,
-0xFF0B4050,
-0xFFE9FFFF,
-0xFFF7FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFF7FFFF,
-0xFFE3FFFF,
-0xFF3A7D97,
-0xFF0E739F,
-0xFF147BA8,
-0xFF045070,
-0xFF114F68,
-0xFF15536C,
-0xFF14506A,
-0xFF164B6B,
-0xFF184A6B,
-0xFF194B6E,
-0xFF1A4F6F,
-0xFF1C5170,
-0xFF1E5372,
-0xFF2E5F7F,
-0xFF2F6081,
-0xFF315F81,
-0xFF2F6081,
-0xFF305E80,
-0xFF2E5F80,
-0xFF315F81,
-0xFF306182,
-0xFF356385,
-0xFF336485,
-0xFF326384,
-0xFF326384,
-0xFF326384,
-0xFF336485,
-0xFF346586,
-0xFF356687,
-0xFF336484,
-0xFF336484,
-0xFF346585,
-0xFF346687,
-0xFF35678A,
-0xFF33678C,
-0xFF32688E,
-0xFF31698E,
-0xFF33698F,
-0xFF34688D,
-0xFF366889,
-0xFF376A89,
-0xFF356A8A,
-0xFF366B8B,
-0xFF346C8F,
-0xFF326C91,
-0xFF316B93,
-0xFF33709C,
-0xFF468DBB,
-0xFF438AB8,
-0xFF3E7FA9,
-0xFF76A9C8,
-0xFFEBFFFF,
-0xFFF2FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF0FFFF,
-0xFFADD1E9,
-0xFF3F7398,
-0xFF3C80AF,
-0xFF3D89BB,
-0xFF3F89B8,
-0xFF2A739E,
-0xFF2E739C,
-0xFF3A7EA5,
-0xFF3579A0,
-0xFF3579A0,
-0xFF36779F,
-0xFF3C7DA5,
-0xFF36759E,
-0xFF3A79A2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA4,
-0xFF3A7BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3A83AE,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3983B0,
-0xFF3983B0,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3986B4,
-0xFF3684B4,
-0xFF3A86B7,
-0xFF3B84AF,
-0xFF3A7EAB,
-0xFF3980AE,
-0xFF376F94,
-0xFFDEF9FF,
-0xFFF6FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFCFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFEDFFFF,
-0xFF588AAB,
-0xFF4C8FB9,
-0xFF4890B8,
-0xFF3A85AD,
-0xFF3786B1,
-0xFF3886B4,
-0xFF3582AE,
-0xFF3984AE,
-0xFF3B84AF,
-0xFF3B84B1,
-0xFF3A84B5,
-0xFF3A82B4,
-0xFF3D80B4,
-0xFF3B81B2,
-0xFF3B84AF,
-0xFF3B84AF,
-0xFF387FAD,
-0xFF387FAD,
-0xFF3882AF,
-0xFF3885B3,
-0xFF3588B4,
-0xFF3087B4,
-0xFF2681AD,
-0xFF1D7CA8,
-0xFF0F729C,
-0xFF0A719C,
-0xFF06709A,
-0xFF046F9B,
-0xFF05709C,
-0xFF07729E,
-0xFF0875A0,
-0xFF0874A2,
-0xFF0773A1,
-0xFF086F9A,
-0xFF07658B,
-0xFF00516F,
-0xFF05475F,
-0xFF4F7D8A,
-0xFFF2FFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFF1FFFF,
-0xFFB6EAFF,
-0xFF186987,
-0xFF13769F,
-0xFF0C6C96,
-0xFF085171,
-0xFF14526B,
-0xFF125069,
-0xFF14506C,
-0xFF164F6D,
-0xFF174D6F,
-0xFF174D71,
-0xFF174D6F,
-0xFF164D6B,
-0xFF164D6B,
-0xFF124767,
-0xFF194B6C,
-0xFF215374,
-0xFF295B7C,
-0xFF2D5F80,
-0xFF306283,
-0xFF326485,
-0xFF336586,
-0xFF2F6182,
-0xFF306283,
-0xFF316384,
-0xFF316384,
-0xFF326485,
-0xFF326485,
-0xFF336586,
-0xFF336586,
-0xFF366788,
-0xFF366787,
-0xFF356686,
-0xFF346786,
-0xFF326787,
-0xFF326789,
-0xFF32688E,
-0xFF32688E,
-0xFF33698F,
-0xFF34688D,
-0xFF356A8A,
-0xFF376A89,
-0xFF386B8A,
-0xFF366B8B,
-0xFF366B8D,
-0xFF366A91,
-0xFF396D95,
-0xFF2E6490,
-0xFF2C6E9E,
-0xFF448EBF,
-0xFF3A88B8,
-0xFF3B80A7,
-0xFF76A3B8,
-0xFFEAFFFF,
-0xFFF2FFFF,
-0xFFF8FFFF,
-0xFFFCFDFF,
-0xFFFBFAFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFDFBFC,
-0xFFFCFBF9,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFF9FFFF,
-0xFFEEFFFF,
-0xFFB3D6F2,
-0xFF38729A,
-0xFF3D84B2,
-0xFF3E87B4,
-0xFF3F88B3,
-0xFF3277A0,
-0xFF34789F,
-0xFF377BA2,
-0xFF34789F,
-0xFF3879A1,
-0xFF3778A0,
-0xFF3978A1,
-0xFF3978A1,
-0xFF3879A1,
-0xFF397AA2,
-0xFF397AA4,
-0xFF397AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF377CA6,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3882AF,
-0xFF3882AF,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B1,
-0xFF3A84B3,
-0xFF3A84B3,
-0xFF3B85B4,
-0xFF3B85B4,
-0xFF3886B6,
-0xFF3682B3,
-0xFF3E87B4,
-0xFF3F84AE,
-0xFF3C7AA3,
-0xFF6897B5,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFAFA,
-0xFFFFFBFF,
-0xFFF9FCFF,
-0xFFF5FFFF,
-0xFFB8D7E9,
-0xFF4F87AC,
-0xFF5195C2,
-0xFF4388B1,
-0xFF3D87AE,
-0xFF3986B2,
-0xFF3A88B6,
-0xFF3A87B5,
-0xFF3983B0,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3983B4,
-0xFF3B82B6,
-0xFF3D80B4,
-0xFF3A80B1,
-0xFF3880B0,
-0xFF3582AE,
-0xFF3684B2,
-0xFF3687B4,
-0xFF3286B4,
-0xFF267FAB,
-0xFF1774A0,
-0xFF0C6F99,
-0xFF076E97,
-0xFF06719B,
-0xFF07749D,
-0xFF04749C,
-0xFF03729D,
-0xFF02719C,
-0xFF04709E,
-0xFF06719F,
-0xFF06719F,
-0xFF06719F,
-0xFF0874A3,
-0xFF0D749F,
-0xFF00587D,
-0xFF05526E,
-0xFF0A4357,
-0xFFBDE2EB,
-0xFFF3FEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF6FDFF,
-0xFFEAFFFF,
-0xFF5096B0,
-0xFF106A8D,
-0xFF1A7499,
-0xFF03557A,
-0xFF0A4D6A,
-0xFF124E6A,
-0xFF144D6A,
-0xFF144D6A,
-0xFF154E6C,
-0xFF154D6E,
-0xFF154D72,
-0xFF164E71,
-0xFF15516D,
-0xFF17536F,
-0xFF1A5371,
-0xFF195172,
-0xFF174F70,
-0xFF154D6E,
-0xFF164E6F,
-0xFF1A5273,
-0xFF215779,
-0xFF255B7D,
-0xFF306688,
-0xFF306688,
-0xFF306587,
-0xFF2E6385,
-0xFF2E6385,
-0xFF2E6385,
-0xFF2F6486,
-0xFF306587,
-0xFF326487,
-0xFF326485,
-0xFF326584,
-0xFF306682,
-0xFF316685,
-0xFF326787,
-0xFF33678C,
-0xFF34688F,
-0xFF33678E,
-0xFF34688D,
-0xFF366B8D,
-0xFF366B8B,
-0xFF356A89,
-0xFF356A8A,
-0xFF37698E,
-0xFF386991,
-0xFF376891,
-0xFF396E98,
-0xFF38719C,
-0xFF30719B,
-0xFF418AB5,
-0xFF3B85AC,
-0xFF397DA0,
-0xFF679AB5,
-0xFFE8FFFF,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFDFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFEFDFB,
-0xFFFEFFFF,
-0xFFF8FFFF,
-0xFFEEFFFF,
-0xFFC0E4FC,
-0xFF497B9C,
-0xFF4382AB,
-0xFF448BB5,
-0xFF4489B3,
-0xFF30759E,
-0xFF3277A0,
-0xFF387BA5,
-0xFF3677A1,
-0xFF33749E,
-0xFF3A7BA3,
-0xFF3879A1,
-0xFF3978A1,
-0xFF3978A1,
-0xFF397AA4,
-0xFF397AA4,
-0xFF377AA4,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF397CA6,
-0xFF397CA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7FA9,
-0xFF3A7FA9,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3B7FAC,
-0xFF3980AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3B84B1,
-0xFF3B84B1,
-0xFF3B84B1,
-0xFF3A84B3,
-0xFF3986B4,
-0xFF3784B2,
-0xFF3D87B6,
-0xFF3D80AB,
-0xFF3C7193,
-0xFFBCDFF5,
-0xFFF5FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFEFB,
-0xFFFFFEFB,
-0xFFFFFCFC,
-0xFFFFFEFF,
-0xFFF8FFFF,
-0xFFEBFFFF,
-0xFF759EB4,
-0xFF5993B9,
-0xFF5598C5,
-0xFF3E81AB,
-0xFF3C83AD,
-0xFF3581B2,
-0xFF3381B2,
-0xFF3682B4,
-0xFF3781B2,
-0xFF3983B0,
-0xFF3784B2,
-0xFF3583B4,
-0xFF3481B5,
-0xFF3780B3,
-0xFF3581B3,
-0xFF3482B3,
-0xFF2F85B4,
-0xFF1F7EAC,
-0xFF1277A3,
-0xFF086F9A,
-0xFF046E98,
-0xFF07729C,
-0xFF09769F,
-0xFF08759E,
-0xFF03729D,
-0xFF02719C,
-0xFF02719C,
-0xFF05709E,
-0xFF07709F,
-0xFF0A70A0,
-0xFF0C70A1,
-0xFF0D71A2,
-0xFF0C72A2,
-0xFF046D9C,
-0xFF086D97,
-0xFF00577B,
-0xFF084E68,
-0xFF2B5969,
-0xFFEBFFFF,
-0xFFFBFFFF,
-0xFFFEFDFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFFDEFFFF,
-0xFF126283,
-0xFF137399,
-0xFF1A6D8F,
-0xFF084F6F,
-0xFF114E6D,
-0xFF164F6C,
-0xFF184F6D,
-0xFF184F6D,
-0xFF15506E,
-0xFF134E6E,
-0xFF124C71,
-0xFF114C6E,
-0xFF124F6C,
-0xFF14516D,
-0xFF114E6D,
-0xFF13506F,
-0xFF155271,
-0xFF165372,
-0xFF165372,
-0xFF155271,
-0xFF155070,
-0xFF144F6F,
-0xFF124D6D,
-0xFF185373,
-0xFF235B7C,
-0xFF2A6283,
-0xFF2F6788,
-0xFF31698A,
-0xFF32688A,
-0xFF31678B,
-0xFF30648B,
-0xFF306489,
-0xFF316685,
-0xFF316783,
-0xFF326882,
-0xFF356885,
-0xFF356788,
-0xFF35678C,
-0xFF34668B,
-0xFF34688D,
-0xFF346A8C,
-0xFF346B8A,
-0xFF336A89,
-0xFF34698B,
-0xFF376890,
-0xFF396991,
-0xFF3C6D96,
-0xFF31658C,
-0xFF33698F,
-0xFF2E6A8F,
-0xFF2C7097,
-0xFF3B83AB,
-0xFF3C87AF,
-0xFF3C7B9E,
-0xFF6D92AC,
-0xFFEEFFFF,
-0xFFF2FFFF,
-0xFFF7FFFF,
-0xFFF8FBFF,
-0xFFFEFDFF,
-0xFFFFFFFD,
-0xFFFFFEFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFEFDFB,
-0xFFFCFDFF,
-0xFFF8FFFF,
-0xFFEEFFFF,
-0xFFC6E6FB,
-0xFF4F80A0,
-0xFF4F8BB0,
-0xFF4D90BA,
-0xFF468BB5,
-0xFF3479A2,
-0xFF31769F,
-0xFF31749E,
-0xFF3A7BA5,
-0xFF35769E,
-0xFF3879A1,
-0xFF3877A0,
-0xFF3978A1,
-0xFF397AA4,
-0xFF397AA4,
-0xFF3679A3,
-0xFF3679A3,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA6,
-0xFF397CA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3B7FAC,
-0xFF3980AC,
-0xFF3881AC,
-0xFF3881AC,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3A83B0,
-0xFF3781AE,
-0xFF3A87B5,
-0xFF3987B7,
-0xFF3C7FA9,
-0xFF56829D,
-0xFFEDFFFF,
-0xFFF8FFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FEF8,
-0xFFFFFFFA,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFF5FFFF,
-0xFFD3F2FF,
-0xFF5F8EA8,
-0xFF5F9BC0,
-0xFF5295C0,
-0xFF3B80AA,
-0xFF3881AE,
-0xFF3987B8,
-0xFF3484B7,
-0xFF3481B5,
-0xFF3684B4,
-0xFF3487B3,
-0xFF3387B3,
-0xFF3088B6,
-0xFF2D85B5,
-0xFF287EB1,
-0xFF1F77A9,
-0xFF146EA0,
-0xFF0A6A9A,
-0xFF07709F,
-0xFF0574A1,
-0xFF0776A3,
-0xFF0776A3,
-0xFF0574A1,
-0xFF02739F,
-0xFF03729F,
-0xFF05749F,
-0xFF01709B,
-0xFF04719C,
-0xFF0772A0,
-0xFF0A73A2,
-0xFF0D71A2,
-0xFF0C70A1,
-0xFF0C6E9F,
-0xFF086D9B,
-0xFF0C72A2,
-0xFF03668F,
-0xFF075D80,
-0xFF0A4A63,
-0xFF94B8C6,
-0xFFF3FFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF9FFFF,
-0xFFEFFFFF,
-0xFF8CBDCE,
-0xFF075F83,
-0xFF0D6F96,
-0xFF0C5776,
-0xFF0F4C68,
-0xFF144A6C,
-0xFF154A6A,
-0xFF184B6A,
-0xFF174C6B,
-0xFF13506F,
-0xFF115071,
-0xFF144F71,
-0xFF144F6F,
-0xFF11516D,
-0xFF10516D,
-0xFF115270,
-0xFF115272,
-0xFF125172,
-0xFF135273,
-0xFF145374,
-0xFF145374,
-0xFF155173,
-0xFF155173,
-0xFF185476,
-0xFF175375,
-0xFF165173,
-0xFF144F71,
-0xFF165173,
-0xFF1A5577,
-0xFF225A7D,
-0xFF275F84,
-0xFF30658D,
-0xFF31678D,
-0xFF326988,
-0xFF346A84,
-0xFF346A82,
-0xFF356883,
-0xFF366485,
-0xFF366486,
-0xFF35678C,
-0xFF34688D,
-0xFF336B8C,
-0xFF336C8A,
-0xFF326A8B,
-0xFF33698D,
-0xFF376891,
-0xFF386890,
-0xFF36688D,
-0xFF3A6F91,
-0xFF376D8F,
-0xFF367095,
-0xFF306C91,
-0xFF327298,
-0xFF3B7AA3,
-0xFF417FA6,
-0xFF41779B,
-0xFF527E99,
-0xFFEAFFFF,
-0xFFF4FFFF,
-0xFFFBFFFF,
-0xFFFEFEFC,
-0xFFFEFDF9,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFCF9,
-0xFFFFFEF9,
-0xFFFFFFFA,
-0xFFFCFFFD,
-0xFFF3FEFF,
-0xFFF0FFFF,
-0xFFD3F0FF,
-0xFF58849F,
-0xFF4F8DB2,
-0xFF5299C3,
-0xFF4A8FB9,
-0xFF30759F,
-0xFF387BA5,
-0xFF3578A2,
-0xFF3677A1,
-0xFF3778A2,
-0xFF3877A0,
-0xFF3978A1,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3879A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA5,
-0xFF387BA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF3A7DA8,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397EA8,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3A81AD,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3982AF,
-0xFF3881AC,
-0xFF3E88B5,
-0xFF3A8ABB,
-0xFF3D80AA,
-0xFF9CC1D4,
-0xFFF4FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFD,
-0xFFFCFFFB,
-0xFFFFFFFA,
-0xFFFFFDFC,
-0xFFFBFBFF,
-0xFFF0FFFF,
-0xFF9AC0D5,
-0xFF5E96B1,
-0xFF5E9DC0,
-0xFF4388B1,
-0xFF3781AE,
-0xFF3381B1,
-0xFF3788BD,
-0xFF3487BD,
-0xFF3083B5,
-0xFF2D83B2,
-0xFF1F7CA7,
-0xFF1679A0,
-0xFF0C739C,
-0xFF06709A,
-0xFF056E9D,
-0xFF06719F,
-0xFF0773A2,
-0xFF0975A4,
-0xFF0773A4,
-0xFF0672A3,
-0xFF0672A3,
-0xFF0672A3,
-0xFF0672A1,
-0xFF02719F,
-0xFF036F9E,
-0xFF036F9D,
-0xFF05719F,
-0xFF05719F,
-0xFF06719D,
-0xFF07709D,
-0xFF07709D,
-0xFF0A719E,
-0xFF0C719F,
-0xFF0C719D,
-0xFF0A719E,
-0xFF005C84,
-0xFF045779,
-0xFF104C64,
-0xFFE6FFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFCFB,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFD,
-0xFFFEFFF8,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF5FFFF,
-0xFFE6FFFF,
-0xFF235F77,
-0xFF136B8F,
-0xFF0C688D,
-0xFF094C69,
-0xFF164E69,
-0xFF184A6B,
-0xFF184A6B,
-0xFF194C6B,
-0xFF164D6C,
-0xFF124E70,
-0xFF104F70,
-0xFF124F6E,
-0xFF13506D,
-0xFF10506C,
-0xFF0F506C,
-0xFF135472,
-0xFF115272,
-0xFF105171,
-0xFF115272,
-0xFF135273,
-0xFF145374,
-0xFF145374,
-0xFF145374,
-0xFF125172,
-0xFF135273,
-0xFF155475,
-0xFF185476,
-0xFF185476,
-0xFF175375,
-0xFF175375,
-0xFF185478,
-0xFF175179,
-0xFF1B557B,
-0xFF215C7C,
-0xFF29627F,
-0xFF2E6782,
-0xFF326A85,
-0xFF346989,
-0xFF34698B,
-0xFF34688D,
-0xFF326A8D,
-0xFF306B8B,
-0xFF306B8B,
-0xFF316C8E,
-0xFF346A90,
-0xFF356991,
-0xFF376890,
-0xFF39698D,
-0xFF37698A,
-0xFF366D8C,
-0xFF346C8D,
-0xFF366E91,
-0xFF326C92,
-0xFF346E96,
-0xFF3E79A3,
-0xFF3C7BA4,
-0xFF3E769B,
-0xFF58809A,
-0xFFEBFFFF,
-0xFFF2FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFDFA,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFBFCF7,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFF4FFFF,
-0xFFD8F3FF,
-0xFF5C8BA5,
-0xFF5792B4,
-0xFF5999BF,
-0xFF4D90BA,
-0xFF3376A1,
-0xFF31719D,
-0xFF3778A2,
-0xFF3778A2,
-0xFF3778A0,
-0xFF3978A1,
-0xFF3A79A2,
-0xFF3879A1,
-0xFF3679A3,
-0xFF3679A3,
-0xFF3879A3,
-0xFF377AA4,
-0xFF377AA4,
-0xFF367BA4,
-0xFF377AA4,
-0xFF367BA4,
-0xFF387BA6,
-0xFF377CA6,
-0xFF397CA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF397DAA,
-0xFF397DAA,
-0xFF397DAA,
-0xFF397DAA,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3A7EAB,
-0xFF3B7FAC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AC,
-0xFF3980AE,
-0xFF3980AE,
-0xFF3A81AF,
-0xFF3A81AF,
-0xFF3A81AF,
-0xFF3982AD,
-0xFF3982AD,
-0xFF3B82AE,
-0xFF438CB7,
-0xFF458FBC,
-0xFF437FA1,
-0xFFE5FFFF,
-0xFFF7FFFF,
-0xFFFFFFFF,
-0xFFFEFDFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFC,
-0xFFFCFFFB,
-0xFFFEFDF9,
-0xFFFFFEFF,
-0xFFF9FFFF,
-0xFFEDFFFF,
-0xFF6A98B2,
-0xFF61A0C1,
-0xFF5BA3C9,
-0xFF307FAA,
-0xFF3286B4,
-0xFF2782B1,
-0xFF1D79AC,
-0xFF1671A6,
-0xFF1470A1,
-0xFF0D6E9B,
-0xFF0C739C,
-0xFF08749B,
-0xFF04749C,
-0xFF03749E,
-0xFF0576A2,
-0xFF0376A3,
-0xFF0176A2,
-0xFF0073A2,
-0xFF0674A5,
-0xFF0670A2,
-0xFF056FA3,
-0xFF0670A4,
-0xFF0671A5,
-0xFF0571A2,
-0xFF06719F,
-0xFF06719F,
-0xFF0873A1,
-0xFF0873A1,
-0xFF0873A1,
-0xFF07729E,
-0xFF09709B,
-0xFF086F9A,
-0xFF096E9A,
-0xFF076E99,
-0xFF036A97,
-0xFF06638C,
-0xFF0B5673,
-0xFF5F92A5,
-0xFFF1FFFF,
-0xFFFFFFFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFD,
-0xFFFEFFFA,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFDFE,
-0xFFFEFFFF,
-0xFFF0FFFF,
-0xFFACE0F8,
-0xFF0F5879,
-0xFF0E6183,
-0xFF105F80,
-0xFF0D4A69,
-0xFF154865,
-0xFF1C4F6E,
-0xFF154867,
-0xFF154C6A,
-0xFF134E6C,
-0xFF134E70,
-0xFF144F71,
-0xFF13506F,
-0xFF13506D,
-0xFF124F6B,
-0xFF124F6B,
-0xFF11506F,
-0xFF125170,
-0xFF125170,
-0xFF125170,
-0xFF145170,
-0xFF155271,
-0xFF155173,
-0xFF165274,
-0xFF135273,
-0xFF135273,
-0xFF145376,
-0xFF145477,
-0xFF155578,
-0xFF155578,
-0xFF155578,
-0xFF145477,
-0xFF16567A,
-0xFF155579,
-0xFF145477,
-0xFF135474,
-0xFF145575,
-0xFF175878,
-0xFF1C5B7E,
-0xFF1F5E81,
-0xFF28678A,
-0xFF2A698C,
-0xFF2D6C8D,
-0xFF316D8F,
-0xFF326C91,
-0xFF336B90,
-0xFF356B91,
-0xFF376B92,
-0xFF39698D,
-0xFF396A8B,
-0xFF366B8B,
-0xFF356C8B,
-0xFF366C8E,
-0xFF366C90,
-0xFF346B92,
-0xFF316C96,
-0xFF3778A2,
-0xFF397AA0,
-0xFF387091,
-0xFF45738B,
-0xFFEAFFFF,
-0xFFF5FFFF,
-0xFFFBFBFD,
-0xFFFFFEFB,
-0xFFFEFFF9,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FDFE,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF6FFFF,
-0xFFE1F8FF,
-0xFF6E93A5,
-0xFF6095B5,
-0xFF5998C1,
-0xFF5795C4,
-0xFF3474A2,
-0xFF31719D,
-0xFF3477A1,
-0xFF34789F,
-0xFF397AA2,
-0xFF37759C,
-0xFF3A79A2,
-0xFF3479A3,
-0xFF2D749E,
-0xFF397AA4,
-0xFF3879A1,
-0xFF357AA1,
-0xFF347CA2,
-0xFF367BA4,
-0xFF347CA4,
-0xFF377CA5,
-0xFF357DA5,
-0xFF377CA5,
-0xFF367EA6,
-0xFF357DA5,
-0xFF367EA6,
-0xFF377EA8,
-0xFF367DA7,
-0xFF367DA7,
-0xFF367DA7,
-0xFF397EA8,
-0xFF397EA8,
-0xFF3A7DA8,
-0xFF3A7DAA,
-0xFF3A7CAC,
-0xFF3B7DAD,
-0xFF3A7EAD,
-0xFF3B7FAC,
-0xFF3B80AA,
-0xFF3B80AA,
-0xFF3B7FAC,
-0xFF387CAB,
-0xFF3F81B3,
-0xFF3D7FB1,
-0xFF3D7FAF,
-0xFF3A7EAB,
-0xFF3982AB,
-0xFF3881AC,
-0xFF3D84B2,
-0xFF5295C0,
-0xFF4A8BAB,
-0xFF7BABBF,
-0xFFF1FFFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFEFC,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFA,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFBFEFF,
-0xFFF2FFFF,
-0xFFBADAEF,
-0xFF6398B8,
-0xFF5DA6CF,
-0xFF2A85B1,
-0xFF1075A3,
-0xFF076D9D,
-0xFF0972A2,
-0xFF0973A3,
-0xFF0771A1,
-0xFF0771A1,
-0xFF0772A0,
-0xFF0773A1,
-0xFF0473A0,
-0xFF0473A0,
-0xFF0574A1,
-0xFF0574A2,
-0xFF0474A2,
-0xFF0575A3,
-0xFF0576A2,
-0xFF0473A0,
-0xFF04709E,
-0xFF046EA0,
-0xFF046EA2,
-0xFF0570A4,
-0xFF0672A3,
-0xFF09729F,
-0xFF0A749E,
-0xFF09729F,
-0xFF0873A1,
-0xFF0670A0,
-0xFF066F9E,
-0xFF0C6F98,
-0xFF0C6E95,
-0xFF0B6E98,
-0xFF0A719E,
-0xFF016C9A,
-0xFF015F85,
-0xFF104E65,
-0xFFCAEEFA,
-0xFFF7FFFF,
-0xFFFDFBFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFDFBFC,
-0xFFFFFCFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFEAFFFF,
-0xFF4382A1,
-0xFF0D5D82,
-0xFF166586,
-0xFF074E6C,
-0xFF114C6A,
-0xFF194C69,
-0xFF164966,
-0xFF174A67,
-0xFF144D6A,
-0xFF134E6C,
-0xFF134E6E,
-0xFF134E6E,
-0xFF13506D,
-0xFF13506C,
-0xFF134F6B,
-0xFF134F6B,
-0xFF13506D,
-0xFF125170,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF155271,
-0xFF155173,
-0xFF165274,
-0xFF135273,
-0xFF145374,
-0xFF135376,
-0xFF145477,
-0xFF135577,
-0xFF135577,
-0xFF135577,
-0xFF135577,
-0xFF145679,
-0xFF145679,
-0xFF13577A,
-0xFF13577A,
-0xFF13577A,
-0xFF13577A,
-0xFF15597C,
-0xFF175B7E,
-0xFF105576,
-0xFF145678,
-0xFF19597C,
-0xFF1F5E81,
-0xFF236285,
-0xFF2A668A,
-0xFF2F698E,
-0xFF326C91,
-0xFF346A8E,
-0xFF346A8E,
-0xFF336B8C,
-0xFF346C8D,
-0xFF346C8D,
-0xFF356D90,
-0xFF346E94,
-0xFF316F98,
-0xFF2C6F99,
-0xFF32769D,
-0xFF37799C,
-0xFF3B7491,
-0xFF467086,
-0xFFE8FFFF,
-0xFFF8FFFF,
-0xFFFCFDFF,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFFEFFFF,
-0xFFFBFCFE,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFCFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFE3FAFF,
-0xFF638DA6,
-0xFF699FC5,
-0xFF649FCB,
-0xFF4F8DBC,
-0xFF33739F,
-0xFF3879A3,
-0xFF3778A0,
-0xFF37779D,
-0xFF3C789D,
-0xFF36749B,
-0xFF3378A2,
-0xFF357CA8,
-0xFF3677A1,
-0xFF3778A0,
-0xFF3579A0,
-0xFF3479A0,
-0xFF357AA3,
-0xFF357AA3,
-0xFF367BA4,
-0xFF367BA4,
-0xFF367BA4,
-0xFF377CA5,
-0xFF367BA4,
-0xFF377CA5,
-0xFF387DA7,
-0xFF387DA7,
-0xFF387DA7,
-0xFF397EA8,
-0xFF3A7DA8,
-0xFF3B7EA9,
-0xFF3C7FA9,
-0xFF3C7FAA,
-0xFF3C7FAC,
-0xFF3C7EAE,
-0xFF3A7EAB,
-0xFF377EAA,
-0xFF397EA7,
-0xFF397EA7,
-0xFF3D81AE,
-0xFF3B7FAE,
-0xFF3C80B1,
-0xFF3B7FB0,
-0xFF3A7EAD,
-0xFF3A7EAB,
-0xFF3982AB,
-0xFF367FA8,
-0xFF4B92C0,
-0xFF5897C0,
-0xFF5288A2,
-0xFFC5E9F7,
-0xFFF8FFFF,
-0xFFFFFBFA,
-0xFFFFFDFA,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFCFEFB,
-0xFFFCFCFC,
-0xFFF9FFFF,
-0xFFEDFFFF,
-0xFF729CB4,
-0xFF5B97BC,
-0xFF4B9CC9,
-0xFF0F74A2,
-0xFF0371A2,
-0xFF0373A3,
-0xFF0676A6,
-0xFF0575A5,
-0xFF0373A3,
-0xFF0373A1,
-0xFF0575A3,
-0xFF0474A2,
-0xFF0474A2,
-0xFF0574A2,
-0xFF0675A3,
-0xFF0574A2,
-0xFF0473A1,
-0xFF03729F,
-0xFF02719C,
-0xFF05729B,
-0xFF05729D,
-0xFF0670A0,
-0xFF0771A3,
-0xFF0772A6,
-0xFF0773A4,
-0xFF0A719C,
-0xFF0A7098,
-0xFF09709B,
-0xFF0871A0,
-0xFF056F9F,
-0xFF046F9D,
-0xFF0C6F98,
-0xFF0D6F96,
-0xFF0B6E98,
-0xFF086D9B,
-0xFF006895,
-0xFF0E668A,
-0xFF376B80,
-0xFFE6FFFF,
-0xFFF9FFFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFCFB,
-0xFFFFFAFC,
-0xFFFFFFFF,
-0xFFF3FEFF,
-0xFFE0FFFF,
-0xFF0D4E6C,
-0xFF0D5B7F,
-0xFF145D7E,
-0xFF074969,
-0xFF114C6A,
-0xFF144C67,
-0xFF174A67,
-0xFF184B68,
-0xFF164B6A,
-0xFF144D6B,
-0xFF134E6E,
-0xFF124F6E,
-0xFF124F6C,
-0xFF124F6B,
-0xFF134F6B,
-0xFF134F6B,
-0xFF13506D,
-0xFF13506F,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF155173,
-0xFF155173,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF135474,
-0xFF125476,
-0xFF135577,
-0xFF135577,
-0xFF135577,
-0xFF135578,
-0xFF145679,
-0xFF16587B,
-0xFF16587B,
-0xFF14587B,
-0xFF13577A,
-0xFF13577A,
-0xFF14587B,
-0xFF15597C,
-0xFF15597C,
-0xFF14587B,
-0xFF16587B,
-0xFF16587B,
-0xFF16587B,
-0xFF18587C,
-0xFF17597C,
-0xFF1A6082,
-0xFF1D6385,
-0xFF24698A,
-0xFF2B6D8D,
-0xFF2F7090,
-0xFF307191,
-0xFF307094,
-0xFF2F7098,
-0xFF2E6F99,
-0xFF31729A,
-0xFF2F7396,
-0xFF30718F,
-0xFF3A7289,
-0xFF3C677A,
-0xFFE0FCFF,
-0xFFF5FFFF,
-0xFFFFFEFF,
-0xFFFCFBF9,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF2FFFF,
-0xFFD7F3FF,
-0xFF6790AE,
-0xFF69A1C6,
-0xFF66A5CE,
-0xFF4180A9,
-0xFF306F98,
-0xFF3A7AA0,
-0xFF347299,
-0xFF3A789D,
-0xFF3A7AA0,
-0xFF3477A2,
-0xFF377CA6,
-0xFF367AA1,
-0xFF38799F,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF397AA2,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3A7BA5,
-0xFF3B7CA6,
-0xFF3B7CA6,
-0xFF3B7BA7,
-0xFF3B7BA7,
-0xFF3C7CA8,
-0xFF3A7DA7,
-0xFF377CA3,
-0xFF367EA4,
-0xFF387DA6,
-0xFF397EA8,
-0xFF377EA8,
-0xFF3781A8,
-0xFF3880A8,
-0xFF3880A8,
-0xFF377FA7,
-0xFF387FA9,
-0xFF367FAA,
-0xFF3580AA,
-0xFF3580A8,
-0xFF3782AA,
-0xFF3882A9,
-0xFF3C84AC,
-0xFF599DCA,
-0xFF5D99BE,
-0xFF6996AD,
-0xFFE9FFFF,
-0xFFF9FFFF,
-0xFFFFFFFD,
-0xFFFCFCFA,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFF8FFFF,
-0xFFD4F4FF,
-0xFF598CA7,
-0xFF5DA1C6,
-0xFF4195C1,
-0xFF056C99,
-0xFF0473A1,
-0xFF0675A3,
-0xFF0574A2,
-0xFF0373A1,
-0xFF0373A1,
-0xFF0373A1,
-0xFF0676A4,
-0xFF0473A1,
-0xFF0473A1,
-0xFF0574A1,
-0xFF0574A1,
-0xFF0672A0,
-0xFF05719F,
-0xFF04709E,
-0xFF03709B,
-0xFF07729C,
-0xFF07729C,
-0xFF0772A0,
-0xFF0773A2,
-0xFF0573A4,
-0xFF0773A2,
-0xFF0A6F99,
-0xFF0C6D97,
-0xFF0B6D9A,
-0xFF096E9C,
-0xFF05709E,
-0xFF03709B,
-0xFF087097,
-0xFF0B7197,
-0xFF096E9C,
-0xFF066B99,
-0xFF086B95,
-0xFF0C5C7F,
-0xFF99C6D9,
-0xFFF0FFFF,
-0xFFFAFFFF,
-0xFFFFFEFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFCFE,
-0xFFFDFEFF,
-0xFFEFFFFF,
-0xFF7DA7B7,
-0xFF125572,
-0xFF0C587A,
-0xFF0B4F72,
-0xFF0E4D6C,
-0xFF114D69,
-0xFF104964,
-0xFF174D67,
-0xFF194C69,
-0xFF184B6A,
-0xFF154C6B,
-0xFF124D6D,
-0xFF124F6E,
-0xFF124F6C,
-0xFF124F6C,
-0xFF134F6B,
-0xFF14506C,
-0xFF13506D,
-0xFF13506F,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF155173,
-0xFF155173,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF135474,
-0xFF135376,
-0xFF125476,
-0xFF135577,
-0xFF135577,
-0xFF135578,
-0xFF145679,
-0xFF15577A,
-0xFF15577A,
-0xFF13577A,
-0xFF13577A,
-0xFF14587B,
-0xFF15597C,
-0xFF12587A,
-0xFF12587A,
-0xFF12587A,
-0xFF13597B,
-0xFF145A7C,
-0xFF155B7D,
-0xFF155B7D,
-0xFF125B7E,
-0xFF0E5D7E,
-0xFF0E5D7E,
-0xFF105B7B,
-0xFF115A7A,
-0xFF135A7A,
-0xFF175C7D,
-0xFF1B5F82,
-0xFF1F6388,
-0xFF23678E,
-0xFF286C93,
-0xFF287194,
-0xFF2D7696,
-0xFF2D738D,
-0xFF326E86,
-0xFF35657C,
-0xFFDAF9FF,
-0xFFF4FEFF,
-0xFFFEFFFF,
-0xFFF8FEFE,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFBFC,
-0xFFFFFCFF,
-0xFFFFFAFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFFFF,
-0xFFF7FFFF,
-0xFFF1FFFF,
-0xFFB5D4E8,
-0xFF6A9CB7,
-0xFF68A5C4,
-0xFF68A6CB,
-0xFF3C7CA2,
-0xFF327097,
-0xFF39779C,
-0xFF37779B,
-0xFF38789E,
-0xFF3778A2,
-0xFF32759F,
-0xFF35799E,
-0xFF367A9F,
-0xFF3879A1,
-0xFF3978A1,
-0xFF3978A1,
-0xFF3978A1,
-0xFF3978A3,
-0xFF3978A3,
-0xFF3978A3,
-0xFF3978A3,
-0xFF3978A3,
-0xFF397AA4,
-0xFF3A79A4,
-0xFF397AA4,
-0xFF3B7AA6,
-0xFF3A7AA6,
-0xFF3B7AA6,
-0xFF387BA5,
-0xFF397EA5,
-0xFF3880A6,
-0xFF3A7FA8,
-0xFF3A7FA8,
-0xFF3880A8,
-0xFF3880A8,
-0xFF3880A8,
-0xFF3880A8,
-0xFF3A7FA8,
-0xFF3A82AA,
-0xFF3883AA,
-0xFF3583A9,
-0xFF3686AB,
-0xFF3482A8,
-0xFF357CA6,
-0xFF4D90BA,
-0xFF5DA1C8,
-0xFF5F97B8,
-0xFFB0CFE4,
-0xFFF4FFFF,
-0xFFF8FDFF,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFB,
-0xFFFCFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF8FCFD,
-0xFFFCFFFF,
-0xFFFCFEFD,
-0xFFF4FFFF,
-0xFF8AB5C8,
-0xFF5695B4,
-0xFF509EC4,
-0xFF1C77A3,
-0xFF066F9C,
-0xFF0776A4,
-0xFF0574A2,
-0xFF02719F,
-0xFF0474A2,
-0xFF0474A2,
-0xFF0373A1,
-0xFF0474A2,
-0xFF0372A0,
-0xFF0372A0,
-0xFF03729F,
-0xFF05719F,
-0xFF05719F,
-0xFF05719F,
-0xFF05719F,
-0xFF06719D,
-0xFF09739D,
-0xFF09739D,
-0xFF08719E,
-0xFF06719F,
-0xFF0672A1,
-0xFF06719F,
-0xFF0C6F99,
-0xFF0D6D97,
-0xFF0E6D99,
-0xFF0B6D9A,
-0xFF05709C,
-0xFF04719A,
-0xFF067097,
-0xFF067097,
-0xFF066F9E,
-0xFF086C9D,
-0xFF0D6992,
-0xFF145978,
-0xFFE4FFFF,
-0xFFF3FFFF,
-0xFFFBFFFF,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFFFFFFB,
-0xFFFFFDFA,
-0xFFFFFDFF,
-0xFFF8FDFF,
-0xFFEAFFFF,
-0xFF1C4C60,
-0xFF0D5470,
-0xFF0D5878,
-0xFF0B4A6D,
-0xFF0F4A6A,
-0xFF114D69,
-0xFF104C66,
-0xFF124A63,
-0xFF1A4D6A,
-0xFF194A6A,
-0xFF164B6B,
-0xFF124D6D,
-0xFF114E6D,
-0xFF124F6C,
-0xFF134E6C,
-0xFF154E6B,
-0xFF14506C,
-0xFF124F6C,
-0xFF13506F,
-0xFF13506F,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF155271,
-0xFF135273,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF135474,
-0xFF135474,
-0xFF135577,
-0xFF145678,
-0xFF135578,
-0xFF135578,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF15577A,
-0xFF14587B,
-0xFF15597C,
-0xFF155B7D,
-0xFF145A7C,
-0xFF125B7C,
-0xFF125B7C,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115B7E,
-0xFF105C7E,
-0xFF0E5C82,
-0xFF105E84,
-0xFF146084,
-0xFF166083,
-0xFF155E81,
-0xFF165C7E,
-0xFF165A7F,
-0xFF165A7F,
-0xFF125A80,
-0xFF105C80,
-0xFF116184,
-0xFF0D6082,
-0xFF116182,
-0xFF11607F,
-0xFF145E7B,
-0xFF18526A,
-0xFFD6F3FF,
-0xFFF2FFFF,
-0xFFF6FDFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFBFC,
-0xFFFFFAFC,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFF0FFFF,
-0xFF95BCCD,
-0xFF73A7BF,
-0xFF6EABCA,
-0xFF5D9DC1,
-0xFF2F6D92,
-0xFF3D7DA1,
-0xFF36779D,
-0xFF2E7299,
-0xFF397AA2,
-0xFF367AA1,
-0xFF31779B,
-0xFF357B9F,
-0xFF3579A0,
-0xFF3778A2,
-0xFF3879A3,
-0xFF3879A3,
-0xFF3879A3,
-0xFF3879A3,
-0xFF3979A5,
-0xFF3979A5,
-0xFF3979A5,
-0xFF377AA5,
-0xFF3A7AA6,
-0xFF387BA6,
-0xFF3B7BA7,
-0xFF3A7DA8,
-0xFF3C7CA8,
-0xFF3A7DA8,
-0xFF367BA4,
-0xFF377CA5,
-0xFF387BA5,
-0xFF397CA6,
-0xFF397CA7,
-0xFF397CA7,
-0xFF3A7DA8,
-0xFF3A7DA8,
-0xFF3B7CA6,
-0xFF397CA6,
-0xFF3882A9,
-0xFF3381A7,
-0xFF3686AB,
-0xFF347FA7,
-0xFF3D7DAB,
-0xFF66A3CF,
-0xFF63A3C7,
-0xFF6496B1,
-0xFFE9FCFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFAFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFB,
-0xFFFCFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFEAFFFF,
-0xFF5189A0,
-0xFF4F9BBD,
-0xFF439BC3,
-0xFF096A95,
-0xFF06719F,
-0xFF0574A2,
-0xFF0372A0,
-0xFF0372A0,
-0xFF0675A3,
-0xFF0574A2,
-0xFF01709D,
-0xFF03729F,
-0xFF04709E,
-0xFF04709E,
-0xFF05719F,
-0xFF06719F,
-0xFF06719F,
-0xFF0772A0,
-0xFF08739F,
-0xFF09729F,
-0xFF09739D,
-0xFF0A719A,
-0xFF09709B,
-0xFF066F9C,
-0xFF05709E,
-0xFF066F9C,
-0xFF0C6F99,
-0xFF0E6E98,
-0xFF0F6E9A,
-0xFF0B6C97,
-0xFF086F9A,
-0xFF07739A,
-0xFF036F95,
-0xFF026F98,
-0xFF0571A2,
-0xFF0B6FA0,
-0xFF17698E,
-0xFF69A1BA,
-0xFFEBFFFF,
-0xFFF7FEFF,
-0xFFFCFFFF,
-0xFFFCFEFB,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFCFF,
-0xFFF7FFFF,
-0xFFABD0E0,
-0xFF0D455C,
-0xFF0A516F,
-0xFF0A5373,
-0xFF0D496B,
-0xFF124B69,
-0xFF114D69,
-0xFF124E68,
-0xFF114962,
-0xFF184B66,
-0xFF194A6A,
-0xFF184B6A,
-0xFF124D6B,
-0xFF114E6D,
-0xFF124D6B,
-0xFF134E6C,
-0xFF164F6C,
-0xFF164F6C,
-0xFF134E6C,
-0xFF13506F,
-0xFF13506F,
-0xFF13506F,
-0xFF13506F,
-0xFF145170,
-0xFF145170,
-0xFF155271,
-0xFF135273,
-0xFF135273,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF135474,
-0xFF135577,
-0xFF145678,
-0xFF135578,
-0xFF135578,
-0xFF145679,
-0xFF15577A,
-0xFF15577A,
-0xFF15577A,
-0xFF13577A,
-0xFF13577A,
-0xFF13597B,
-0xFF115A7B,
-0xFF10597A,
-0xFF0F5A7A,
-0xFF0F5B7D,
-0xFF0F5E7F,
-0xFF105F80,
-0xFF115F83,
-0xFF115C83,
-0xFF0F5D83,
-0xFF0F5D83,
-0xFF0E5C80,
-0xFF125C81,
-0xFF145D80,
-0xFF195F83,
-0xFF1A6084,
-0xFF166286,
-0xFF116184,
-0xFF0B5F83,
-0xFF0F6588,
-0xFF0A5F84,
-0xFF085D82,
-0xFF075C81,
-0xFF0F5879,
-0xFF15475E,
-0xFFC8E5F5,
-0xFFF4FFFF,
-0xFFFCFFFF,
-0xFFFFFBFC,
-0xFFFFFDFB,
-0xFFFFFCFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFDFDFF,
-0xFFFEFFFF,
-0xFFF7FFFF,
-0xFFEAFFFF,
-0xFF719BAB,
-0xFF6AA1BF,
-0xFF6FAFD3,
-0xFF4686AA,
-0xFF2F7096,
-0xFF30759C,
-0xFF3078A0,
-0xFF32779E,
-0xFF367BA2,
-0xFF2E789D,
-0xFF327CA1,
-0xFF3378A1,
-0xFF3378A1,
-0xFF3479A3,
-0xFF3479A2,
-0xFF357AA4,
-0xFF367BA5,
-0xFF367BA5,
-0xFF377CA6,
-0xFF357CA8,
-0xFF347BA5,
-0xFF347BA7,
-0xFF337AA4,
-0xFF337AA6,
-0xFF337AA6,
-0xFF337AA6,
-0xFF317AA5,
-0xFF3580AA,
-0xFF3580A8,
-0xFF3580A8,
-0xFF367FA8,
-0xFF367FAA,
-0xFF367FAC,
-0xFF367FAC,
-0xFF367FAC,
-0xFF3982AD,
-0xFF3681A9,
-0xFF3382A9,
-0xFF2A7EA3,
-0xFF2A7FA6,
-0xFF2675A0,
-0xFF3E82B3,
-0xFF65A4D0,
-0xFF5E99B9,
-0xFF8AB4CA,
-0xFFF7FFFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFF7FFFF,
-0xFFF8FEFE,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFBFFFD,
-0xFFFBFFFA,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFEFF,
-0xFFF3FAFF,
-0xFFF2FFFF,
-0xFFA8CEDB,
-0xFF4487A2,
-0xFF459DC1,
-0xFF2585AF,
-0xFF086F9A,
-0xFF0772A0,
-0xFF0473A1,
-0xFF0372A0,
-0xFF02719F,
-0xFF01709E,
-0xFF006F9D,
-0xFF006F9C,
-0xFF0473A0,
-0xFF05719F,
-0xFF05719F,
-0xFF0772A0,
-0xFF0873A1,
-0xFF0873A1,
-0xFF0972A1,
-0xFF08719E,
-0xFF08729C,
-0xFF06709A,
-0xFF086F98,
-0xFF096E9A,
-0xFF0A6F9B,
-0xFF09709D,
-0xFF09709D,
-0xFF0B6E98,
-0xFF0C6D98,
-0xFF0E6D99,
-0xFF0A6B96,
-0xFF096E98,
-0xFF097099,
-0xFF026E95,
-0xFF026F9A,
-0xFF0474A6,
-0xFF0F71A0,
-0xFF1A6181,
-0xFFC9F4FF,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFCFEFB,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFDFA,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFF1FFFF,
-0xFF3D6A7F,
-0xFF0C4965,
-0xFF0E5372,
-0xFF084D6C,
-0xFF0D4868,
-0xFF154C6A,
-0xFF124B66,
-0xFF124C64,
-0xFF134B64,
-0xFF164964,
-0xFF184969,
-0xFF174A69,
-0xFF134C6A,
-0xFF124D6B,
-0xFF124D6B,
-0xFF134E6C,
-0xFF164F6C,
-0xFF164F6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF144F6D,
-0xFF13506F,
-0xFF13506F,
-0xFF145170,
-0xFF155271,
-0xFF125170,
-0xFF135271,
-0xFF155475,
-0xFF155475,
-0xFF135474,
-0xFF135474,
-0xFF135474,
-0xFF135575,
-0xFF135577,
-0xFF115677,
-0xFF145678,
-0xFF145678,
-0xFF15577A,
-0xFF15577A,
-0xFF145679,
-0xFF125679,
-0xFF155B7F,
-0xFF135C7F,
-0xFF125B7E,
-0xFF105A7D,
-0xFF0E5A7C,
-0xFF0C5B7C,
-0xFF0D5B7F,
-0xFF0E5C80,
-0xFF105A81,
-0xFF105B82,
-0xFF0F5F84,
-0xFF106085,
-0xFF115F85,
-0xFF125E82,
-0xFF125C81,
-0xFF115B80,
-0xFF116081,
-0xFF085B7D,
-0xFF17698E,
-0xFF0E6086,
-0xFF0F6189,
-0xFF146590,
-0xFF0A5E8C,
-0xFF05547D,
-0xFF105272,
-0xFF11435C,
-0xFFC1DEF0,
-0xFFEEFCFF,
-0xFFFCFFFF,
-0xFFFFFEFA,
-0xFFFEFFFA,
-0xFFFDFFFC,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF7FFFD,
-0xFFF6FFFF,
-0xFFC8E1E8,
-0xFF6799B2,
-0xFF63A3C6,
-0xFF62A6CB,
-0xFF2E769E,
-0xFF2E79A1,
-0xFF3482A9,
-0xFF2F7B9F,
-0xFF327EA2,
-0xFF307BA2,
-0xFF337EA6,
-0xFF327DA5,
-0xFF327DA5,
-0xFF307DA7,
-0xFF307EA5,
-0xFF307DA7,
-0xFF307DA7,
-0xFF307FA8,
-0xFF307FA8,
-0xFF307FAA,
-0xFF2F7EA7,
-0xFF2C7DA8,
-0xFF2C7EA6,
-0xFF2B7CA7,
-0xFF2B7CA7,
-0xFF2A7BA6,
-0xFF287BA7,
-0xFF2178A3,
-0xFF2079A3,
-0xFF1D79A0,
-0xFF1B77A0,
-0xFF1B74A0,
-0xFF1A709F,
-0xFF1870A0,
-0xFF176F9D,
-0xFF0F6A96,
-0xFF0E6C92,
-0xFF0B6B91,
-0xFF0B6D92,
-0xFF0C6E95,
-0xFF0F6C97,
-0xFF4294C4,
-0xFF559CC6,
-0xFF5991AA,
-0xFFCBEBFA,
-0xFFFCFEFF,
-0xFFFFFAFF,
-0xFFFFFEFC,
-0xFFFCFFFB,
-0xFFF9FFFD,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFBFFFD,
-0xFFF9FFFA,
-0xFFFEFFF8,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE7FFFF,
-0xFF5F92A7,
-0xFF4594B5,
-0xFF3999C1,
-0xFF076E97,
-0xFF06719D,
-0xFF0672A0,
-0xFF05719F,
-0xFF05719F,
-0xFF04709E,
-0xFF016D9B,
-0xFF026E9C,
-0xFF05719F,
-0xFF0672A0,
-0xFF07729E,
-0xFF07729E,
-0xFF09729F,
-0xFF09729F,
-0xFF09729F,
-0xFF0A719E,
-0xFF09709D,
-0xFF086F9A,
-0xFF046F99,
-0xFF056F97,
-0xFF0B6E98,
-0xFF0D6E9B,
-0xFF0C6E9B,
-0xFF0C6E9B,
-0xFF096E9A,
-0xFF0A6D97,
-0xFF0C6D98,
-0xFF096A94,
-0xFF0B6C96,
-0xFF0A6D97,
-0xFF056C95,
-0xFF07749F,
-0xFF0779AB,
-0xFF0F709D,
-0xFF3F7B97,
-0xFFE9FFFF,
-0xFFF8FFFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFCFFFB,
-0xFFF9FDFC,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFDFDFD,
-0xFFF8FFFF,
-0xFFD9F3FF,
-0xFF0C4058,
-0xFF0B4C6A,
-0xFF084B68,
-0xFF0D4E6C,
-0xFF0C4765,
-0xFF114A67,
-0xFF144C67,
-0xFF124A63,
-0xFF144A64,
-0xFF154B65,
-0xFF174A67,
-0xFF154A69,
-0xFF144B6A,
-0xFF144D6B,
-0xFF124D6B,
-0xFF134E6C,
-0xFF164F6C,
-0xFF164F6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF144F6D,
-0xFF13506F,
-0xFF13506F,
-0xFF145170,
-0xFF145170,
-0xFF135271,
-0xFF145372,
-0xFF155475,
-0xFF155475,
-0xFF135474,
-0xFF125373,
-0xFF135474,
-0xFF135474,
-0xFF135577,
-0xFF115677,
-0xFF135577,
-0xFF135577,
-0xFF145679,
-0xFF15577A,
-0xFF15577A,
-0xFF16587B,
-0xFF12567B,
-0xFF12587C,
-0xFF125B7E,
-0xFF115B7E,
-0xFF0F5B7D,
-0xFF0D5C7D,
-0xFF0E5C80,
-0xFF115D81,
-0xFF145E83,
-0xFF135D84,
-0xFF105B82,
-0xFF0E5C82,
-0xFF0F5D83,
-0xFF105E84,
-0xFF115F85,
-0xFF126084,
-0xFF126283,
-0xFF126283,
-0xFF0E5E81,
-0xFF0E5E83,
-0xFF17648E,
-0xFF0F5D8B,
-0xFF0C5E8D,
-0xFF0D5E8B,
-0xFF07557B,
-0xFF0C4F6C,
-0xFF0D3D54,
-0xFFB9D9E8,
-0xFFECFDFF,
-0xFFF9FFFF,
-0xFFFCFFFD,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFAFEFD,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFF2FFFF,
-0xFF7BA5BB,
-0xFF4C8BAC,
-0xFF509AC1,
-0xFF2F7EA7,
-0xFF176893,
-0xFF13668E,
-0xFF176B8F,
-0xFF17698E,
-0xFF17668F,
-0xFF1A6994,
-0xFF176893,
-0xFF166993,
-0xFF156892,
-0xFF146992,
-0xFF136891,
-0xFF126790,
-0xFF126790,
-0xFF0F678F,
-0xFF116893,
-0xFF106792,
-0xFF106792,
-0xFF0F6892,
-0xFF106993,
-0xFF106993,
-0xFF106993,
-0xFF0E6995,
-0xFF0E6B97,
-0xFF0B6C97,
-0xFF096F97,
-0xFF096F97,
-0xFF0D6E9B,
-0xFF0D6D9D,
-0xFF0E6EA0,
-0xFF0D6FA0,
-0xFF0C719D,
-0xFF0D759C,
-0xFF097198,
-0xFF0C729A,
-0xFF086D97,
-0xFF0F709D,
-0xFF4FAAD7,
-0xFF4D97BC,
-0xFF6A9AAE,
-0xFFEEFFFF,
-0xFFFEFDFF,
-0xFFFFFBFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFCFFFD,
-0xFFFBFCFE,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFBFFFD,
-0xFFF9FFFB,
-0xFFFEFFFA,
-0xFFFFFFFA,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFF5FFFF,
-0xFFC5EEFF,
-0xFF3A7B99,
-0xFF3C94BA,
-0xFF2489B3,
-0xFF026D99,
-0xFF04719C,
-0xFF026E9C,
-0xFF036F9D,
-0xFF0773A1,
-0xFF0975A3,
-0xFF0773A1,
-0xFF0975A3,
-0xFF0A75A3,
-0xFF05709C,
-0xFF07729E,
-0xFF08719E,
-0xFF07709D,
-0xFF07709D,
-0xFF086F9C,
-0xFF086F9C,
-0xFF096E9C,
-0xFF086F9A,
-0xFF047097,
-0xFF067098,
-0xFF0C6D98,
-0xFF106D99,
-0xFF0E6D9B,
-0xFF0B6D9A,
-0xFF096E9A,
-0xFF096E9A,
-0xFF0A6D97,
-0xFF0A6B95,
-0xFF0C6C96,
-0xFF0A6B96,
-0xFF076C98,
-0xFF0D78A4,
-0xFF0E7CAD,
-0xFF126E97,
-0xFFA5D3EB,
-0xFFF1FFFF,
-0xFFF9FCFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFCFEF9,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF2FFFF,
-0xFF6E92A2,
-0xFF0A435E,
-0xFF0A4C6C,
-0xFF0C4B6A,
-0xFF0E4B67,
-0xFF0E4B67,
-0xFF0F4B65,
-0xFF144A64,
-0xFF164964,
-0xFF164964,
-0xFF144A64,
-0xFF134B66,
-0xFF144C67,
-0xFF154C6A,
-0xFF154C6A,
-0xFF144D6A,
-0xFF144D6A,
-0xFF154E6B,
-0xFF164F6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF15506E,
-0xFF145170,
-0xFF155271,
-0xFF145170,
-0xFF145170,
-0xFF135271,
-0xFF145372,
-0xFF155475,
-0xFF155475,
-0xFF145374,
-0xFF125373,
-0xFF135577,
-0xFF115677,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145678,
-0xFF16567A,
-0xFF16587B,
-0xFF15577A,
-0xFF13577A,
-0xFF14587D,
-0xFF145A7E,
-0xFF125B7E,
-0xFF115B7E,
-0xFF105A7F,
-0xFF0F597E,
-0xFF125B7E,
-0xFF155B7F,
-0xFF145C82,
-0xFF135D84,
-0xFF0F5D83,
-0xFF0E5E83,
-0xFF0D5F84,
-0xFF0D6082,
-0xFF105F80,
-0xFF135F81,
-0xFF155F82,
-0xFF135F83,
-0xFF115F86,
-0xFF105F88,
-0xFF12618C,
-0xFF13628D,
-0xFF0C5B84,
-0xFF055175,
-0xFF0B516B,
-0xFF073E52,
-0xFFA7CBD7,
-0xFFF0FFFF,
-0xFFF8FDFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFFFEFC,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF6FCFC,
-0xFFFCFFFD,
-0xFFFFFEF8,
-0xFFFAFEFF,
-0xFFDBFAFF,
-0xFF3D7493,
-0xFF3F8CB6,
-0xFF3F97C5,
-0xFF0A638F,
-0xFF0E678F,
-0xFF106A8F,
-0xFF0E668C,
-0xFF12658F,
-0xFF136692,
-0xFF106792,
-0xFF106993,
-0xFF116A94,
-0xFF0E6A93,
-0xFF0D6992,
-0xFF0C6992,
-0xFF0D6A93,
-0xFF0E6B94,
-0xFF0D6A95,
-0xFF0C6C96,
-0xFF0D6D97,
-0xFF0D6D97,
-0xFF0D6D97,
-0xFF0C6D97,
-0xFF0C6D97,
-0xFF0D6E99,
-0xFF0E6D9D,
-0xFF0C6C9C,
-0xFF076E97,
-0xFF056F97,
-0xFF096E9C,
-0xFF0C6DA0,
-0xFF0A6EA2,
-0xFF096FA0,
-0xFF066F9C,
-0xFF0A749C,
-0xFF0A6F99,
-0xFF0F719E,
-0xFF0B6B9B,
-0xFF2A89B7,
-0xFF449DC9,
-0xFF468CAE,
-0xFFACD1E1,
-0xFFF0FFFF,
-0xFFFFFEFF,
-0xFFFFFBFF,
-0xFFFFFFFB,
-0xFFFDFEF8,
-0xFFFEFFFB,
-0xFFFEFEFE,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFF7FDFB,
-0xFFF9FFFD,
-0xFFFCFFFB,
-0xFFFFFFFB,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFEFFFFF,
-0xFF74ACC7,
-0xFF3486AC,
-0xFF3494BE,
-0xFF0F76A3,
-0xFF05729D,
-0xFF0773A1,
-0xFF07749F,
-0xFF08739F,
-0xFF08739F,
-0xFF08739F,
-0xFF08739F,
-0xFF08739F,
-0xFF09729F,
-0xFF09729F,
-0xFF066F9C,
-0xFF09709B,
-0xFF09709B,
-0xFF076E99,
-0xFF086D99,
-0xFF096E9A,
-0xFF0C6E9B,
-0xFF096E9A,
-0xFF067098,
-0xFF086F98,
-0xFF0C6D9A,
-0xFF0F6B9A,
-0xFF0D6C9A,
-0xFF0B6C99,
-0xFF076E9B,
-0xFF066D98,
-0xFF096C96,
-0xFF0B6C97,
-0xFF086892,
-0xFF096A95,
-0xFF086D99,
-0xFF1C83B0,
-0xFF1379A9,
-0xFF217097,
-0xFFE4FFFF,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFDFFFC,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFF8FDFF,
-0xFFEBFFFF,
-0xFF123D50,
-0xFF084562,
-0xFF054767,
-0xFF0F4A68,
-0xFF114A67,
-0xFF0E4C65,
-0xFF0E4C65,
-0xFF134963,
-0xFF174964,
-0xFF164964,
-0xFF144A64,
-0xFF124B66,
-0xFF134C67,
-0xFF154A69,
-0xFF164B6A,
-0xFF154C6A,
-0xFF144D6A,
-0xFF154E6B,
-0xFF164F6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF144F6D,
-0xFF145170,
-0xFF155271,
-0xFF145170,
-0xFF145170,
-0xFF135271,
-0xFF145372,
-0xFF155475,
-0xFF155475,
-0xFF145374,
-0xFF125373,
-0xFF125476,
-0xFF105576,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145678,
-0xFF16567A,
-0xFF16567A,
-0xFF145679,
-0xFF15577A,
-0xFF16577D,
-0xFF14587D,
-0xFF13597D,
-0xFF115A7D,
-0xFF11597F,
-0xFF10597C,
-0xFF13597B,
-0xFF145A7C,
-0xFF165A7F,
-0xFF155A81,
-0xFF115C83,
-0xFF0E5D84,
-0xFF0C5E83,
-0xFF0D5F84,
-0xFF125E82,
-0xFF145E81,
-0xFF165F82,
-0xFF155F84,
-0xFF115F85,
-0xFF105F86,
-0xFF0F6187,
-0xFF10628A,
-0xFF0E6189,
-0xFF095B81,
-0xFF004D6E,
-0xFF0C526C,
-0xFF073B50,
-0xFF95B6C5,
-0xFFF4FFFF,
-0xFFF7FBFE,
-0xFFFEFEFC,
-0xFFFFFFFB,
-0xFFFDFFFC,
-0xFFFEFFFF,
-0xFFFBFCFE,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDF7,
-0xFFFFFEFC,
-0xFFECFFFF,
-0xFF81AFC9,
-0xFF3986B2,
-0xFF3493C3,
-0xFF1979A3,
-0xFF06668C,
-0xFF0A6A90,
-0xFF0D6990,
-0xFF116593,
-0xFF106492,
-0xFF0C6793,
-0xFF0B6891,
-0xFF0D6A95,
-0xFF0D6A95,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0A6B95,
-0xFF0A6B95,
-0xFF0A6B95,
-0xFF0A6B95,
-0xFF0A6D97,
-0xFF0A6D97,
-0xFF0A6D97,
-0xFF0B6E98,
-0xFF0A6F99,
-0xFF0C6E9B,
-0xFF0D6C9C,
-0xFF0C6C9C,
-0xFF067098,
-0xFF057198,
-0xFF096D9E,
-0xFF096D9F,
-0xFF086DA1,
-0xFF0770A0,
-0xFF06719D,
-0xFF047097,
-0xFF086D99,
-0xFF0E709D,
-0xFF096999,
-0xFF3F9AC7,
-0xFF4194BC,
-0xFF4686A2,
-0xFFE7FFFF,
-0xFFF9FFFF,
-0xFFFBFCFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFAFBF5,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFAFE,
-0xFFFFFDFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF8FDF9,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFF9FEFF,
-0xFFE9FFFF,
-0xFF2D7395,
-0xFF2A89B5,
-0xFF2B8DBA,
-0xFF046B98,
-0xFF0873A1,
-0xFF04709E,
-0xFF08739F,
-0xFF08739F,
-0xFF08719E,
-0xFF08719E,
-0xFF07709D,
-0xFF07709D,
-0xFF066F9C,
-0xFF066F9C,
-0xFF086F9A,
-0xFF09709B,
-0xFF086F9A,
-0xFF086D99,
-0xFF086D99,
-0xFF096E9A,
-0xFF0B6D9A,
-0xFF096E9A,
-0xFF097099,
-0xFF097099,
-0xFF0C6D9A,
-0xFF0C6B99,
-0xFF0B6C99,
-0xFF096B98,
-0xFF076C9A,
-0xFF076C98,
-0xFF0A6B96,
-0xFF0A6995,
-0xFF0D6D97,
-0xFF0B6A96,
-0xFF1274A1,
-0xFF2689B3,
-0xFF1E7AA3,
-0xFF74B6D8,
-0xFFEDFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFF3FFFF,
-0xFF9EBFD0,
-0xFF05374E,
-0xFF094663,
-0xFF0A496A,
-0xFF124968,
-0xFF124A65,
-0xFF0C4C65,
-0xFF0E4C65,
-0xFF134965,
-0xFF164765,
-0xFF164966,
-0xFF144A66,
-0xFF124B66,
-0xFF134C67,
-0xFF154B67,
-0xFF164C68,
-0xFF154C6A,
-0xFF154C6A,
-0xFF154E6B,
-0xFF154E6B,
-0xFF164F6C,
-0xFF154E6B,
-0xFF154E6C,
-0xFF154E6C,
-0xFF144F6D,
-0xFF144F6D,
-0xFF14516E,
-0xFF14516E,
-0xFF145170,
-0xFF145170,
-0xFF135271,
-0xFF135271,
-0xFF145372,
-0xFF145372,
-0xFF145372,
-0xFF135472,
-0xFF125474,
-0xFF125474,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145678,
-0xFF155578,
-0xFF165679,
-0xFF16567A,
-0xFF15577A,
-0xFF15567C,
-0xFF16577D,
-0xFF14587D,
-0xFF14587D,
-0xFF14587D,
-0xFF13597D,
-0xFF13597B,
-0xFF13597B,
-0xFF15597E,
-0xFF155A81,
-0xFF125C83,
-0xFF0F5D83,
-0xFF0E5E83,
-0xFF0E5E83,
-0xFF125E82,
-0xFF125E82,
-0xFF145E81,
-0xFF146082,
-0xFF106083,
-0xFF0D6183,
-0xFF0D6384,
-0xFF0C6587,
-0xFF0D6287,
-0xFF13678C,
-0xFF075B80,
-0xFF004B6F,
-0xFF084768,
-0xFF0E3D57,
-0xFF93AEBF,
-0xFFF4FFFF,
-0xFFFCFFFF,
-0xFFFAF9F5,
-0xFFFFFFFB,
-0xFFFCFBF9,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFDFA,
-0xFFFFFFFD,
-0xFFF9FFFF,
-0xFFCCECFF,
-0xFF3079A4,
-0xFF2888BA,
-0xFF2A8DB6,
-0xFF056C8F,
-0xFF066990,
-0xFF0A6A94,
-0xFF0F6693,
-0xFF106794,
-0xFF0C6793,
-0xFF0B6893,
-0xFF096993,
-0xFF0A6A94,
-0xFF0B6A96,
-0xFF0C6B97,
-0xFF0B6C97,
-0xFF0A6B96,
-0xFF0B6C97,
-0xFF0B6C97,
-0xFF096C96,
-0xFF096C96,
-0xFF076C98,
-0xFF076C98,
-0xFF096E9A,
-0xFF0B6D9A,
-0xFF0F6B9A,
-0xFF0D6E9B,
-0xFF077198,
-0xFF067298,
-0xFF096E9C,
-0xFF086C9D,
-0xFF086E9E,
-0xFF07709D,
-0xFF047097,
-0xFF047096,
-0xFF076E99,
-0xFF0C6E9B,
-0xFF1778A5,
-0xFF3B94BE,
-0xFF3C87A7,
-0xFF7DB1C7,
-0xFFF1FFFF,
-0xFFFCFDFF,
-0xFFF9FDFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFFFFCFB,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFB,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFDFEFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFCFAFF,
-0xFFFAFDFF,
-0xFFF2FFFF,
-0xFF99C3D9,
-0xFF2578A0,
-0xFF248DBD,
-0xFF1579AA,
-0xFF086D9B,
-0xFF066F9C,
-0xFF0A73A0,
-0xFF07709D,
-0xFF07709D,
-0xFF09709B,
-0xFF086F9A,
-0xFF086F9A,
-0xFF086F9A,
-0xFF076E99,
-0xFF076E99,
-0xFF096E9A,
-0xFF0A6F9B,
-0xFF096E98,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0D6E99,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0A6C99,
-0xFF096B9A,
-0xFF096B98,
-0xFF096B98,
-0xFF076C98,
-0xFF096B98,
-0xFF0E6B97,
-0xFF0D6A95,
-0xFF0D6D97,
-0xFF066791,
-0xFF2687B2,
-0xFF2C88AF,
-0xFF287295,
-0xFFC8FAFF,
-0xFFF4FFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFBFDF8,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF1FFFF,
-0xFF305B6E,
-0xFF084059,
-0xFF094867,
-0xFF094665,
-0xFF134867,
-0xFF134965,
-0xFF0E4C65,
-0xFF0D4B64,
-0xFF124864,
-0xFF164765,
-0xFF164966,
-0xFF144A66,
-0xFF124B66,
-0xFF124B66,
-0xFF154B67,
-0xFF154B67,
-0xFF154C6A,
-0xFF154C6A,
-0xFF144D6A,
-0xFF154E6B,
-0xFF164F6C,
-0xFF154E6B,
-0xFF154E6C,
-0xFF154E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF13506D,
-0xFF13506D,
-0xFF145170,
-0xFF145170,
-0xFF125170,
-0xFF135271,
-0xFF135271,
-0xFF145372,
-0xFF145372,
-0xFF145372,
-0xFF135474,
-0xFF125474,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145678,
-0xFF155578,
-0xFF155578,
-0xFF16567A,
-0xFF15577A,
-0xFF15567C,
-0xFF15567C,
-0xFF15567C,
-0xFF16577D,
-0xFF14587D,
-0xFF14587B,
-0xFF10597A,
-0xFF115A7B,
-0xFF125B7C,
-0xFF125B7E,
-0xFF125C81,
-0xFF115C83,
-0xFF0F5D83,
-0xFF0F5D83,
-0xFF0F5D81,
-0xFF125E82,
-0xFF145E83,
-0xFF145E81,
-0xFF135F81,
-0xFF0E6181,
-0xFF0B6482,
-0xFF0A6582,
-0xFF0F6588,
-0xFF0D6186,
-0xFF0F628A,
-0xFF0F5E87,
-0xFF02476E,
-0xFF094464,
-0xFF09364D,
-0xFF86A3B1,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFBFBF9,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFAFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFEEFFFF,
-0xFF5493BC,
-0xFF227CAE,
-0xFF278EB7,
-0xFF087299,
-0xFF02688E,
-0xFF0B6B95,
-0xFF0F6894,
-0xFF116895,
-0xFF0D6894,
-0xFF0C6994,
-0xFF0B6893,
-0xFF096993,
-0xFF096894,
-0xFF0B6A96,
-0xFF0B6A96,
-0xFF0B6C97,
-0xFF0C6D98,
-0xFF0B6C97,
-0xFF0B6C97,
-0xFF096C96,
-0xFF096B98,
-0xFF066B97,
-0xFF096B98,
-0xFF0A6B98,
-0xFF0E6A99,
-0xFF0C6D98,
-0xFF077198,
-0xFF067298,
-0xFF096E9A,
-0xFF0B6D9C,
-0xFF086F9C,
-0xFF07719B,
-0xFF056F96,
-0xFF087299,
-0xFF066F9C,
-0xFF056C99,
-0xFF298BB8,
-0xFF368EB2,
-0xFF367892,
-0xFFC8EFFF,
-0xFFF6FFFF,
-0xFFFEFEFE,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFBF9,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFDFC,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFD,
-0xFFFCFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFE,
-0xFFFFFEFF,
-0xFFFAFBFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE7FFFF,
-0xFF3C7892,
-0xFF2483AF,
-0xFF1785B6,
-0xFF0A70A0,
-0xFF0C6E9D,
-0xFF0A719E,
-0xFF056C99,
-0xFF086F9C,
-0xFF086F9C,
-0xFF086F9A,
-0xFF086F9A,
-0xFF086F9A,
-0xFF086F9A,
-0xFF086F9A,
-0xFF086F9A,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF0C6F99,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0C6D98,
-0xFF0C6D98,
-0xFF0B6A96,
-0xFF0A6B96,
-0xFF096B9A,
-0xFF076C9A,
-0xFF076C98,
-0xFF076C98,
-0xFF096B98,
-0xFF0C6B97,
-0xFF0F6A96,
-0xFF0C6793,
-0xFF0D6A95,
-0xFF0E6E98,
-0xFF3794BD,
-0xFF3383A8,
-0xFF5B94B1,
-0xFFE6FFFF,
-0xFFF8FFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFCFFFB,
-0xFFFEFFFA,
-0xFFFCFFFF,
-0xFFF5FFFF,
-0xFFD2ECFD,
-0xFF0A3953,
-0xFF0D4A67,
-0xFF084562,
-0xFF134F6B,
-0xFF134965,
-0xFF134963,
-0xFF104964,
-0xFF104964,
-0xFF114866,
-0xFF134867,
-0xFF134867,
-0xFF134A68,
-0xFF134B66,
-0xFF134B66,
-0xFF144A66,
-0xFF154B67,
-0xFF144C67,
-0xFF154D68,
-0xFF154C6A,
-0xFF154C6A,
-0xFF164D6B,
-0xFF164D6B,
-0xFF154E6B,
-0xFF154E6B,
-0xFF134E6C,
-0xFF134E6C,
-0xFF13506D,
-0xFF13506D,
-0xFF14516E,
-0xFF14516E,
-0xFF145170,
-0xFF145170,
-0xFF155271,
-0xFF155271,
-0xFF165372,
-0xFF145372,
-0xFF125373,
-0xFF135474,
-0xFF145575,
-0xFF145575,
-0xFF135577,
-0xFF145678,
-0xFF135577,
-0xFF135577,
-0xFF155779,
-0xFF155779,
-0xFF15577A,
-0xFF15577A,
-0xFF15577A,
-0xFF16587B,
-0xFF17597C,
-0xFF145A7C,
-0xFF0F5B7B,
-0xFF0C5D7B,
-0xFF0C5D7B,
-0xFF0E5D7E,
-0xFF115D7F,
-0xFF125C81,
-0xFF115D81,
-0xFF115D81,
-0xFF0F5D83,
-0xFF105E82,
-0xFF145C82,
-0xFF175C83,
-0xFF175D81,
-0xFF145E81,
-0xFF0D627F,
-0xFF0A6381,
-0xFF09607E,
-0xFF12668A,
-0xFF126188,
-0xFF145F89,
-0xFF0D567F,
-0xFF01456A,
-0xFF04415E,
-0xFF0A3A4E,
-0xFF7494A1,
-0xFFF2FFFF,
-0xFFF9FFFF,
-0xFFFDFDFF,
-0xFFFCFCFE,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFC,
-0xFFF5FFFF,
-0xFFA8DAFB,
-0xFF1E6F9A,
-0xFF1E83AF,
-0xFF0E7BA4,
-0xFF02688E,
-0xFF0C6C92,
-0xFF116A94,
-0xFF0E6791,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0D6894,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0C6994,
-0xFF0B6B95,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6B97,
-0xFF0B6C97,
-0xFF0A6B96,
-0xFF096C96,
-0xFF096A95,
-0xFF096A95,
-0xFF0D6A96,
-0xFF0A6B95,
-0xFF076F94,
-0xFF076F94,
-0xFF0B6E98,
-0xFF0C6D9A,
-0xFF0A6F9B,
-0xFF0A6F99,
-0xFF0A7096,
-0xFF0A7299,
-0xFF046F9D,
-0xFF05719F,
-0xFF258FB9,
-0xFF348AAB,
-0xFF568AA0,
-0xFFECFFFF,
-0xFFF9FFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFC,
-0xFFFFFDFE,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFBFBFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFEAFEFF,
-0xFFB5E7FE,
-0xFF1C6B8C,
-0xFF157FA9,
-0xFF0B7BAB,
-0xFF086E9E,
-0xFF0A6C9B,
-0xFF066B99,
-0xFF0A6F9D,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF0A6F99,
-0xFF0A6F99,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0B6E98,
-0xFF0B6C97,
-0xFF0B6C97,
-0xFF0A6B96,
-0xFF0B6A96,
-0xFF0C6994,
-0xFF0A6995,
-0xFF0A6A9A,
-0xFF096B9A,
-0xFF096B98,
-0xFF096C96,
-0xFF0A6B96,
-0xFF0B6B95,
-0xFF0F6894,
-0xFF0B648E,
-0xFF0C6793,
-0xFF2A86AF,
-0xFF3B93B9,
-0xFF387D9E,
-0xFFB8DEF1,
-0xFFF2FFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFB,
-0xFFFBFEF7,
-0xFFFBFFFF,
-0xFFF2FFFF,
-0xFF6A8A9F,
-0xFF0B405F,
-0xFF0D4C6D,
-0xFF0C4965,
-0xFF0F4B65,
-0xFF134963,
-0xFF134963,
-0xFF124864,
-0xFF114964,
-0xFF104966,
-0xFF114A67,
-0xFF114A67,
-0xFF134A68,
-0xFF134B66,
-0xFF144A66,
-0xFF144A66,
-0xFF134B66,
-0xFF144C67,
-0xFF154D68,
-0xFF154C6A,
-0xFF154C6A,
-0xFF164D6B,
-0xFF164D6B,
-0xFF154E6B,
-0xFF154E6B,
-0xFF134E6C,
-0xFF134E6C,
-0xFF124F6C,
-0xFF124F6C,
-0xFF14516E,
-0xFF14516E,
-0xFF145170,
-0xFF145170,
-0xFF145170,
-0xFF155271,
-0xFF165372,
-0xFF165372,
-0xFF145374,
-0xFF135474,
-0xFF135474,
-0xFF145575,
-0xFF135577,
-0xFF135577,
-0xFF135577,
-0xFF115677,
-0xFF125778,
-0xFF125778,
-0xFF13577A,
-0xFF15577A,
-0xFF15577A,
-0xFF16587B,
-0xFF16587B,
-0xFF145A7C,
-0xFF0F5B7D,
-0xFF0C5C7D,
-0xFF0D5C7B,
-0xFF105C7C,
-0xFF115C7C,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115D81,
-0xFF0F5D83,
-0xFF0F5D83,
-0xFF145C84,
-0xFF165B82,
-0xFF185C83,
-0xFF155E81,
-0xFF106081,
-0xFF0D6281,
-0xFF0C6180,
-0xFF0F6284,
-0xFF136187,
-0xFF17628A,
-0xFF146289,
-0xFF145F86,
-0xFF004869,
-0xFF06435F,
-0xFF0E3D51,
-0xFF6A8A99,
-0xFFF1FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFDFEFF,
-0xFFFFFDFD,
-0xFFF8FDFF,
-0xFFE1FFFF,
-0xFF2A6E93,
-0xFF1577A4,
-0xFF1180AD,
-0xFF066A8E,
-0xFF0A688A,
-0xFF0D6990,
-0xFF0E6791,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0E6A93,
-0xFF0E6995,
-0xFF0C6994,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0A6A94,
-0xFF0A6A94,
-0xFF0A6A94,
-0xFF0B6B95,
-0xFF0B6C97,
-0xFF0B6C97,
-0xFF0A6B96,
-0xFF0B6A96,
-0xFF096894,
-0xFF096A95,
-0xFF066C92,
-0xFF076D93,
-0xFF0A6B96,
-0xFF0C6B99,
-0xFF0A6D97,
-0xFF0B6E97,
-0xFF0B6D94,
-0xFF096E98,
-0xFF006F9D,
-0xFF0C7FAE,
-0xFF1A8AB2,
-0xFF1B7290,
-0xFFA4CADF,
-0xFFF5FFFF,
-0xFFF9FDFF,
-0xFFFCFCFA,
-0xFFFCFEFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFBFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFF4FCFF,
-0xFFE9FFFF,
-0xFF5396B3,
-0xFF16769E,
-0xFF1483AE,
-0xFF0374A0,
-0xFF066C9C,
-0xFF0D6D9D,
-0xFF086A99,
-0xFF1072A1,
-0xFF0D6F9C,
-0xFF0D6F9C,
-0xFF0C6E9B,
-0xFF0A6F9B,
-0xFF0A6F9B,
-0xFF096E9A,
-0xFF096E98,
-0xFF096E98,
-0xFF0A6D97,
-0xFF0A6D97,
-0xFF096C96,
-0xFF0A6D97,
-0xFF0A6B96,
-0xFF096A95,
-0xFF096A95,
-0xFF0A6A94,
-0xFF0D6A93,
-0xFF0D6A95,
-0xFF0B6A9A,
-0xFF0A6A9A,
-0xFF0A6B96,
-0xFF096A94,
-0xFF096A94,
-0xFF096991,
-0xFF0E6791,
-0xFF0D648F,
-0xFF0F6894,
-0xFF4198C3,
-0xFF408FB6,
-0xFF4B87A3,
-0xFFEDFFFF,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFB,
-0xFFFFFFF8,
-0xFFFAFFFE,
-0xFFF0FFFF,
-0xFF173D54,
-0xFF134B6C,
-0xFF0F4F72,
-0xFF0D4A66,
-0xFF114B63,
-0xFF124A63,
-0xFF134963,
-0xFF164765,
-0xFF154865,
-0xFF114A67,
-0xFF0E4B67,
-0xFF0F4B67,
-0xFF114A67,
-0xFF144A66,
-0xFF164966,
-0xFF134B66,
-0xFF134B66,
-0xFF144C67,
-0xFF164C68,
-0xFF164B6A,
-0xFF154A69,
-0xFF154C6A,
-0xFF154C6A,
-0xFF154E6B,
-0xFF154E6B,
-0xFF134F6B,
-0xFF14506C,
-0xFF13506D,
-0xFF13506D,
-0xFF13506D,
-0xFF14516E,
-0xFF145170,
-0xFF155271,
-0xFF145170,
-0xFF155271,
-0xFF155271,
-0xFF165372,
-0xFF165274,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF125474,
-0xFF135575,
-0xFF115677,
-0xFF115677,
-0xFF115677,
-0xFF115878,
-0xFF115878,
-0xFF125778,
-0xFF13577A,
-0xFF13577A,
-0xFF14587B,
-0xFF13597D,
-0xFF125A80,
-0xFF11597F,
-0xFF13577C,
-0xFF16587B,
-0xFF14587B,
-0xFF125B7C,
-0xFF115D7D,
-0xFF0F5E7F,
-0xFF0F5D81,
-0xFF115C83,
-0xFF125B84,
-0xFF145B85,
-0xFF145B85,
-0xFF135E85,
-0xFF106085,
-0xFF0E6183,
-0xFF106083,
-0xFF116184,
-0xFF0B5E7E,
-0xFF126587,
-0xFF0E5E81,
-0xFF126287,
-0xFF176387,
-0xFF004668,
-0xFF0B4865,
-0xFF06394E,
-0xFF618794,
-0xFFECFFFF,
-0xFFF5FFFF,
-0xFFFCFFFF,
-0xFFFCFBF9,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFCFDFF,
-0xFFFFFEFD,
-0xFFFBFEFF,
-0xFFEBFFFF,
-0xFF639AB8,
-0xFF0D6D9D,
-0xFF0F7DAE,
-0xFF096B8E,
-0xFF096685,
-0xFF0C6689,
-0xFF0F6890,
-0xFF0C688F,
-0xFF0C688F,
-0xFF0D6990,
-0xFF0D6992,
-0xFF0C6992,
-0xFF0C6992,
-0xFF0B6891,
-0xFF0A6790,
-0xFF0B6891,
-0xFF0B6891,
-0xFF096991,
-0xFF0A6A92,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0B6A96,
-0xFF0A6997,
-0xFF096A97,
-0xFF096C95,
-0xFF096C95,
-0xFF0A6997,
-0xFF0A6997,
-0xFF0B6A96,
-0xFF0C6B97,
-0xFF0D6894,
-0xFF096B98,
-0xFF0171A3,
-0xFF0D85B7,
-0xFF0C83AD,
-0xFF1E7795,
-0xFFE4FFFF,
-0xFFFEFEFF,
-0xFFFDFEFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFC,
-0xFFFDFDFD,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFCFAFB,
-0xFFFFFEFC,
-0xFFFDFFFE,
-0xFFF8FFFF,
-0xFFE0FFFF,
-0xFF0F6186,
-0xFF0B77A5,
-0xFF0778A0,
-0xFF006F97,
-0xFF0A6F9D,
-0xFF0C6C9E,
-0xFF1171A1,
-0xFF056595,
-0xFF0C6D9A,
-0xFF0B6D9A,
-0xFF0B6D9A,
-0xFF0B6D9A,
-0xFF0A6D97,
-0xFF0A6D97,
-0xFF0A6D97,
-0xFF0A6D97,
-0xFF096C96,
-0xFF086B95,
-0xFF096C96,
-0xFF0A6D97,
-0xFF0B6C96,
-0xFF096A94,
-0xFF096A94,
-0xFF0B6B95,
-0xFF0D6A93,
-0xFF0E6A93,
-0xFF0D6998,
-0xFF0C6897,
-0xFF0C6994,
-0xFF096991,
-0xFF086A91,
-0xFF09698F,
-0xFF0D6990,
-0xFF0F678F,
-0xFF257CA7,
-0xFF499AC5,
-0xFF448CB4,
-0xFF8DBFDA,
-0xFFF4FFFF,
-0xFFFFFFFA,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFB,
-0xFFFFFEF9,
-0xFFF9FFFF,
-0xFF9DBACC,
-0xFF13425E,
-0xFF175375,
-0xFF09496C,
-0xFF124F6B,
-0xFF0F4961,
-0xFF104A62,
-0xFF134963,
-0xFF164765,
-0xFF154865,
-0xFF0F4B67,
-0xFF0E4B67,
-0xFF0F4B67,
-0xFF114A67,
-0xFF144A66,
-0xFF144A66,
-0xFF134B66,
-0xFF124B66,
-0xFF144C67,
-0xFF154D68,
-0xFF154A69,
-0xFF144B69,
-0xFF154C6A,
-0xFF154C6A,
-0xFF154E6B,
-0xFF154E6B,
-0xFF134F6B,
-0xFF14506C,
-0xFF13506D,
-0xFF13506D,
-0xFF13506D,
-0xFF14516E,
-0xFF145170,
-0xFF155271,
-0xFF155271,
-0xFF155271,
-0xFF155271,
-0xFF165372,
-0xFF165274,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF125474,
-0xFF125474,
-0xFF115677,
-0xFF115677,
-0xFF105576,
-0xFF105777,
-0xFF105777,
-0xFF115878,
-0xFF125679,
-0xFF13577A,
-0xFF13577A,
-0xFF12587A,
-0xFF145980,
-0xFF13587F,
-0xFF16567C,
-0xFF16567A,
-0xFF14587B,
-0xFF125B7B,
-0xFF105C7C,
-0xFF0E5D7E,
-0xFF0F5D81,
-0xFF115C83,
-0xFF125B84,
-0xFF125B84,
-0xFF125D85,
-0xFF105E84,
-0xFF115F85,
-0xFF106085,
-0xFF105E82,
-0xFF105E82,
-0xFF126283,
-0xFF0D6080,
-0xFF116486,
-0xFF116186,
-0xFF105F86,
-0xFF156087,
-0xFF024B6C,
-0xFF0A4C66,
-0xFF073F50,
-0xFF577F89,
-0xFFEEFFFF,
-0xFFF6FFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFD,
-0xFFFEFFFD,
-0xFFFAFFFC,
-0xFFFBFFFF,
-0xFFFCFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF3FFFF,
-0xFFADD7EF,
-0xFF0A638F,
-0xFF0973A3,
-0xFF0D6D93,
-0xFF0E6988,
-0xFF0B6588,
-0xFF0E688D,
-0xFF0F6890,
-0xFF0C688F,
-0xFF0B678E,
-0xFF0B678E,
-0xFF0D6992,
-0xFF0D6A93,
-0xFF0D6992,
-0xFF0B6891,
-0xFF0C6992,
-0xFF0B6891,
-0xFF0A6790,
-0xFF086890,
-0xFF0B6891,
-0xFF0A6A92,
-0xFF0D6A95,
-0xFF0B6B95,
-0xFF0B6A98,
-0xFF0C6B99,
-0xFF0C6D98,
-0xFF0A6B96,
-0xFF096A97,
-0xFF096896,
-0xFF0A6995,
-0xFF0E6B97,
-0xFF0F6A97,
-0xFF066897,
-0xFF0074A7,
-0xFF097FAD,
-0xFF097599,
-0xFF5CA6C1,
-0xFFF0FFFF,
-0xFFFFF9FF,
-0xFFFFFFFF,
-0xFFFDFFFE,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFAFEFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF8FCFD,
-0xFFFFFDFE,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFF9FFFF,
-0xFFF1FFFF,
-0xFF81B1C5,
-0xFF0E6995,
-0xFF0474A6,
-0xFF05759D,
-0xFF047097,
-0xFF086D99,
-0xFF0C6E9D,
-0xFF076797,
-0xFF10719E,
-0xFF0A6B98,
-0xFF0A6B98,
-0xFF096B98,
-0xFF096C96,
-0xFF096C96,
-0xFF096C96,
-0xFF0A6B96,
-0xFF096C96,
-0xFF0A6B96,
-0xFF086B95,
-0xFF0A6B96,
-0xFF0B6C97,
-0xFF0B6C96,
-0xFF0A6B95,
-0xFF0B6B95,
-0xFF0C6C96,
-0xFF0C6992,
-0xFF0D6992,
-0xFF0C6794,
-0xFF0C6794,
-0xFF0B6893,
-0xFF0B6891,
-0xFF09698F,
-0xFF0C6A90,
-0xFF0D698E,
-0xFF0C648A,
-0xFF489BC5,
-0xFF4D97BE,
-0xFF4B83A6,
-0xFFE1FFFF,
-0xFFF7FFFF,
-0xFFFFFFF8,
-0xFFFEFFFB,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFCFF,
-0xFFFFF9F7,
-0xFFFFFDFB,
-0xFFFFFEFF,
-0xFFF9FAFE,
-0xFFFCFFFF,
-0xFFFCFEFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFF37607E,
-0xFF165277,
-0xFF135275,
-0xFF0D4C6B,
-0xFF0A4763,
-0xFF0F4B65,
-0xFF114A65,
-0xFF124A65,
-0xFF114964,
-0xFF114964,
-0xFF104964,
-0xFF0E4A64,
-0xFF114A65,
-0xFF114A65,
-0xFF124A65,
-0xFF134B66,
-0xFF124B66,
-0xFF124B66,
-0xFF124B66,
-0xFF124B66,
-0xFF144C67,
-0xFF144D68,
-0xFF144D6A,
-0xFF144D6A,
-0xFF144D6A,
-0xFF154E6B,
-0xFF14506C,
-0xFF14506C,
-0xFF144F6D,
-0xFF134E6C,
-0xFF124F6E,
-0xFF13506F,
-0xFF125170,
-0xFF125170,
-0xFF125172,
-0xFF125172,
-0xFF135273,
-0xFF145374,
-0xFF135271,
-0xFF135472,
-0xFF145573,
-0xFF145573,
-0xFF115373,
-0xFF105272,
-0xFF125474,
-0xFF125776,
-0xFF115677,
-0xFF115677,
-0xFF125778,
-0xFF125778,
-0xFF12587A,
-0xFF12587A,
-0xFF13597B,
-0xFF13597B,
-0xFF12587A,
-0xFF13597B,
-0xFF15597C,
-0xFF15597C,
-0xFF13597B,
-0xFF10597A,
-0xFF105A7D,
-0xFF105C7E,
-0xFF115D7F,
-0xFF125E82,
-0xFF125E82,
-0xFF115C83,
-0xFF115C83,
-0xFF105E82,
-0xFF115F83,
-0xFF126084,
-0xFF135E85,
-0xFF135E85,
-0xFF126084,
-0xFF126084,
-0xFF126086,
-0xFF116186,
-0xFF126188,
-0xFF126188,
-0xFF106083,
-0xFF075472,
-0xFF084E67,
-0xFF0B4457,
-0xFF4D757F,
-0xFFEBFFFF,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFCF9,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFCFAFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFEFF,
-0xFFE7FFFF,
-0xFF0F5B7F,
-0xFF0B6E98,
-0xFF0A6A94,
-0xFF0B678E,
-0xFF10688E,
-0xFF0E668C,
-0xFF0F678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0C688F,
-0xFF0F6890,
-0xFF0D6990,
-0xFF0F6B94,
-0xFF0F6B94,
-0xFF0E6A93,
-0xFF0B6891,
-0xFF0B6790,
-0xFF0B6891,
-0xFF0D6992,
-0xFF0C6994,
-0xFF0D6A95,
-0xFF096894,
-0xFF0B6A98,
-0xFF0A6B98,
-0xFF096C96,
-0xFF0C6F99,
-0xFF0F6F99,
-0xFF0B6894,
-0xFF0A6695,
-0xFF076D9D,
-0xFF0579AA,
-0xFF05729B,
-0xFF1A6781,
-0xFFC4F2FF,
-0xFFF6FFFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFCFE,
-0xFFFFFEFB,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFF3FFFF,
-0xFFE3FFFF,
-0xFF23637F,
-0xFF0D6C9C,
-0xFF0570A6,
-0xFF086F9A,
-0xFF066C94,
-0xFF076C96,
-0xFF096E98,
-0xFF0B6D9A,
-0xFF096B98,
-0xFF0A6B98,
-0xFF0A6B96,
-0xFF0A6B96,
-0xFF0B6C97,
-0xFF0A6B96,
-0xFF0A6B95,
-0xFF0B6B95,
-0xFF096A94,
-0xFF0C6C96,
-0xFF0B6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0B6B95,
-0xFF0C6994,
-0xFF0A6A94,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0E6995,
-0xFF0B6692,
-0xFF086892,
-0xFF0C6C96,
-0xFF0F6892,
-0xFF106890,
-0xFF0E688D,
-0xFF1A7296,
-0xFF53A5CA,
-0xFF5799B9,
-0xFF7EA4BB,
-0xFFEDFFFF,
-0xFFF9FFFF,
-0xFFFBFDF8,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFDFB,
-0xFFFFFAF8,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFD6E6F6,
-0xFF144566,
-0xFF16567C,
-0xFF175677,
-0xFF104D69,
-0xFF0E4A64,
-0xFF114D65,
-0xFF104964,
-0xFF104964,
-0xFF114964,
-0xFF104964,
-0xFF114964,
-0xFF114A65,
-0xFF124A65,
-0xFF114A65,
-0xFF124A65,
-0xFF124B66,
-0xFF134B66,
-0xFF124B66,
-0xFF134B66,
-0xFF124B66,
-0xFF144C67,
-0xFF134C67,
-0xFF154C6A,
-0xFF144D6A,
-0xFF154C6A,
-0xFF154E6B,
-0xFF154E6B,
-0xFF14506C,
-0xFF164F6D,
-0xFF134E6C,
-0xFF134E6E,
-0xFF13506F,
-0xFF13506F,
-0xFF125170,
-0xFF145072,
-0xFF125172,
-0xFF155173,
-0xFF135273,
-0xFF135271,
-0xFF135472,
-0xFF155473,
-0xFF135472,
-0xFF125373,
-0xFF115373,
-0xFF135474,
-0xFF135575,
-0xFF125476,
-0xFF105576,
-0xFF115677,
-0xFF115677,
-0xFF125679,
-0xFF115779,
-0xFF13577A,
-0xFF12587A,
-0xFF135879,
-0xFF135A7A,
-0xFF15597C,
-0xFF13597B,
-0xFF13597B,
-0xFF10597A,
-0xFF115A7D,
-0xFF105A7D,
-0xFF125C7F,
-0xFF115D7F,
-0xFF125E82,
-0xFF115D81,
-0xFF115D81,
-0xFF0F5D81,
-0xFF105E82,
-0xFF115F83,
-0xFF135E85,
-0xFF135E85,
-0xFF145F86,
-0xFF145F86,
-0xFF115F85,
-0xFF115F85,
-0xFF116087,
-0xFF0F6189,
-0xFF13678C,
-0xFF0F6284,
-0xFF045371,
-0xFF0C526B,
-0xFF0E4257,
-0xFF4E7383,
-0xFFEFFFFF,
-0xFFF6FDFF,
-0xFFFFFFFF,
-0xFFFDF9F6,
-0xFFFFFEFC,
-0xFFFFFFFD,
-0xFFFDFDFD,
-0xFFFCFCFC,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFECFFFF,
-0xFF256A87,
-0xFF0A668D,
-0xFF096691,
-0xFF096490,
-0xFF0E668C,
-0xFF0F648B,
-0xFF0E668C,
-0xFF0E668E,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0D6992,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0D6992,
-0xFF0C6891,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF09668F,
-0xFF0B6893,
-0xFF0C6B99,
-0xFF0B6C99,
-0xFF076A94,
-0xFF096A94,
-0xFF0C6C96,
-0xFF0D6A95,
-0xFF0F6E9C,
-0xFF056C99,
-0xFF00709C,
-0xFF0B6D90,
-0xFF3D788A,
-0xFFEBFFFF,
-0xFFF8FCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFFFCF9,
-0xFFFFFBF7,
-0xFFFDFEF9,
-0xFFF1FFFF,
-0xFFADDDF1,
-0xFF0E587B,
-0xFF09679A,
-0xFF056DA4,
-0xFF0A6C9B,
-0xFF096A94,
-0xFF076A91,
-0xFF076D95,
-0xFF096C96,
-0xFF076996,
-0xFF0A6B96,
-0xFF0A6B96,
-0xFF0B6C97,
-0xFF0B6C97,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0A6A94,
-0xFF0C6994,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0A6A94,
-0xFF0A6792,
-0xFF106993,
-0xFF0C6891,
-0xFF0A6A94,
-0xFF0C6992,
-0xFF0F6892,
-0xFF0E668E,
-0xFF096187,
-0xFF4397BC,
-0xFF509FC0,
-0xFF5790AB,
-0xFFC9E5F3,
-0xFFF8FFFF,
-0xFFFAFFFF,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFD,
-0xFFFEFAF9,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFF8FDF9,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFF738D9E,
-0xFF184967,
-0xFF1E5A7C,
-0xFF114D69,
-0xFF0C465E,
-0xFF124A61,
-0xFF124A61,
-0xFF114962,
-0xFF114964,
-0xFF134965,
-0xFF124A65,
-0xFF134965,
-0xFF124A65,
-0xFF134965,
-0xFF114964,
-0xFF134965,
-0xFF124A65,
-0xFF144A66,
-0xFF134B66,
-0xFF144A66,
-0xFF134B66,
-0xFF154B67,
-0xFF144C67,
-0xFF164C68,
-0xFF154D68,
-0xFF164C68,
-0xFF154D68,
-0xFF164D6B,
-0xFF154E6B,
-0xFF174E6C,
-0xFF164F6C,
-0xFF154E6C,
-0xFF134E6C,
-0xFF144F6F,
-0xFF13506F,
-0xFF155070,
-0xFF155271,
-0xFF165171,
-0xFF155271,
-0xFF155271,
-0xFF135271,
-0xFF165372,
-0xFF145372,
-0xFF145374,
-0xFF135474,
-0xFF145374,
-0xFF135474,
-0xFF135376,
-0xFF125476,
-0xFF125476,
-0xFF135577,
-0xFF135577,
-0xFF125778,
-0xFF145679,
-0xFF125679,
-0xFF155779,
-0xFF135879,
-0xFF16587B,
-0xFF14587B,
-0xFF14587B,
-0xFF13597B,
-0xFF13597B,
-0xFF10597A,
-0xFF125B7E,
-0xFF115B7E,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF135D84,
-0xFF145E85,
-0xFF135F83,
-0xFF135F83,
-0xFF115F83,
-0xFF115F85,
-0xFF105F86,
-0xFF0E6088,
-0xFF0C6188,
-0xFF0C6186,
-0xFF0E6286,
-0xFF105C7C,
-0xFF12536F,
-0xFF0F425D,
-0xFF476C86,
-0xFFEBFFFF,
-0xFFF6FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFAFAFA,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFBFFFD,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFEFFFFF,
-0xFF4888A3,
-0xFF085E81,
-0xFF086189,
-0xFF0A638B,
-0xFF0D658B,
-0xFF10658C,
-0xFF0D658B,
-0xFF0D658B,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0F678F,
-0xFF0F678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0E6A93,
-0xFF0D6992,
-0xFF0D6992,
-0xFF09668F,
-0xFF0B6891,
-0xFF0B6B95,
-0xFF0A6995,
-0xFF0C6995,
-0xFF0A6792,
-0xFF086892,
-0xFF0A6B95,
-0xFF096894,
-0xFF086B95,
-0xFF046E95,
-0xFF09607E,
-0xFF97C6D8,
-0xFFF1FFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFDFE,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFEDFFFF,
-0xFF447C93,
-0xFF0C5C81,
-0xFF086495,
-0xFF05699D,
-0xFF0A6C9B,
-0xFF096C96,
-0xFF086A8F,
-0xFF096B90,
-0xFF086B95,
-0xFF086A97,
-0xFF0A6B96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0C6C96,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0C6994,
-0xFF0C6994,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0C6994,
-0xFF0E6B94,
-0xFF0B6891,
-0xFF106993,
-0xFF0F6892,
-0xFF116A92,
-0xFF0A668D,
-0xFF0D6990,
-0xFF0A638B,
-0xFF126790,
-0xFF54A3CA,
-0xFF589FBF,
-0xFF6498B0,
-0xFFEDFFFF,
-0xFFF7FFFF,
-0xFFFAFEFD,
-0xFFFDFFFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFC,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFE9FFFF,
-0xFF1E4459,
-0xFF265C78,
-0xFF1F5C79,
-0xFF104964,
-0xFF124A61,
-0xFF154D64,
-0xFF10465E,
-0xFF124864,
-0xFF124864,
-0xFF134965,
-0xFF134965,
-0xFF134965,
-0xFF134965,
-0xFF124864,
-0xFF124864,
-0xFF134965,
-0xFF134965,
-0xFF144A66,
-0xFF144A66,
-0xFF144A66,
-0xFF144A66,
-0xFF144A66,
-0xFF154B67,
-0xFF164C68,
-0xFF164C68,
-0xFF164C68,
-0xFF164C68,
-0xFF154C6A,
-0xFF164D6B,
-0xFF164D6B,
-0xFF174E6C,
-0xFF164F6D,
-0xFF154E6C,
-0xFF134E6E,
-0xFF144F6F,
-0xFF155070,
-0xFF165171,
-0xFF155070,
-0xFF155070,
-0xFF145170,
-0xFF145170,
-0xFF155173,
-0xFF165274,
-0xFF145374,
-0xFF145374,
-0xFF145374,
-0xFF135273,
-0xFF135376,
-0xFF145477,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145679,
-0xFF145679,
-0xFF15577A,
-0xFF15577A,
-0xFF15577A,
-0xFF15577A,
-0xFF16587B,
-0xFF15597C,
-0xFF15597C,
-0xFF13597B,
-0xFF13597D,
-0xFF10597C,
-0xFF115A7D,
-0xFF115B7E,
-0xFF125C81,
-0xFF125C81,
-0xFF125C81,
-0xFF115D81,
-0xFF115C83,
-0xFF125D84,
-0xFF125D84,
-0xFF135E85,
-0xFF115F83,
-0xFF115F83,
-0xFF115F85,
-0xFF115F86,
-0xFF105F88,
-0xFF0E6189,
-0xFF10658C,
-0xFF0D6287,
-0xFF0D5D82,
-0xFF115A7B,
-0xFF165576,
-0xFF0E4363,
-0xFF486D87,
-0xFFEDFFFF,
-0xFFF8FFFF,
-0xFFF9FDFE,
-0xFFFCFCFA,
-0xFFFFFEFC,
-0xFFFFFFFD,
-0xFFFCFDFF,
-0xFFFCFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF1FFFF,
-0xFF6EA6BF,
-0xFF065576,
-0xFF075C81,
-0xFF0A6489,
-0xFF0F648B,
-0xFF10658C,
-0xFF0E638A,
-0xFF0D658B,
-0xFF0D658D,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6990,
-0xFF0C6A90,
-0xFF0D6B91,
-0xFF086890,
-0xFF0A6792,
-0xFF126897,
-0xFF0F6795,
-0xFF07678F,
-0xFF096B92,
-0xFF096993,
-0xFF08668C,
-0xFF076485,
-0xFF0F5770,
-0xFFE5FFFF,
-0xFFF3FDFF,
-0xFFFCFFFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF8FCFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF5FFFF,
-0xFFD9FBFF,
-0xFF0F4F6A,
-0xFF0D6088,
-0xFF086493,
-0xFF07699A,
-0xFF0A6C9B,
-0xFF0A6D97,
-0xFF0B6B91,
-0xFF0B6C8F,
-0xFF0A6B96,
-0xFF0B6C97,
-0xFF0B6A96,
-0xFF0B6B95,
-0xFF0B6B95,
-0xFF0A6A94,
-0xFF0A6A94,
-0xFF0A6A94,
-0xFF096993,
-0xFF096993,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0C6994,
-0xFF0C6994,
-0xFF0D6A95,
-0xFF0D6A93,
-0xFF0E6C92,
-0xFF0D6990,
-0xFF0F6894,
-0xFF0E6590,
-0xFF136891,
-0xFF0C648A,
-0xFF0D6990,
-0xFF07638A,
-0xFF2E83AC,
-0xFF539EC5,
-0xFF5693B2,
-0xFFA3CEE1,
-0xFFF1FFFF,
-0xFFF7FDFD,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFAFFFF,
-0xFFF1FFFF,
-0xFF9BC1D4,
-0xFF154B65,
-0xFF25617D,
-0xFF195673,
-0xFF0C4965,
-0xFF0F4B65,
-0xFF124B66,
-0xFF124A65,
-0xFF124766,
-0xFF124766,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF124766,
-0xFF124766,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF144968,
-0xFF144968,
-0xFF144968,
-0xFF144968,
-0xFF144B69,
-0xFF144B69,
-0xFF144B69,
-0xFF154C6A,
-0xFF154C6B,
-0xFF154C6B,
-0xFF154E6C,
-0xFF164F6D,
-0xFF164E6F,
-0xFF154D6E,
-0xFF134E6E,
-0xFF134E6E,
-0xFF144F71,
-0xFF155072,
-0xFF145072,
-0xFF145072,
-0xFF145072,
-0xFF145072,
-0xFF145074,
-0xFF155175,
-0xFF145376,
-0xFF145376,
-0xFF145376,
-0xFF135275,
-0xFF145478,
-0xFF145478,
-0xFF135578,
-0xFF135578,
-0xFF145679,
-0xFF14557B,
-0xFF14557B,
-0xFF15567C,
-0xFF15567C,
-0xFF14557B,
-0xFF12567B,
-0xFF13577C,
-0xFF15597E,
-0xFF165A7F,
-0xFF145A7E,
-0xFF13587F,
-0xFF10587E,
-0xFF10587E,
-0xFF105A7F,
-0xFF115B82,
-0xFF115C83,
-0xFF115C83,
-0xFF115C83,
-0xFF115C83,
-0xFF0F5C86,
-0xFF0E5D86,
-0xFF0F5E85,
-0xFF106085,
-0xFF116184,
-0xFF126084,
-0xFF145F86,
-0xFF135E85,
-0xFF0E5D84,
-0xFF0D5F85,
-0xFF14668C,
-0xFF17678C,
-0xFF115D81,
-0xFF195F83,
-0xFF1C5B7E,
-0xFF114260,
-0xFF8EADC1,
-0xFFF2FFFF,
-0xFFF9FEFF,
-0xFFFFFFFD,
-0xFFFFFEFA,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFF1FFFF,
-0xFF8FBDD4,
-0xFF064B6A,
-0xFF065677,
-0xFF0B6085,
-0xFF0E638A,
-0xFF0E638C,
-0xFF0E638A,
-0xFF0E638A,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0E668C,
-0xFF0E668C,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0E678F,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0F6890,
-0xFF0D6990,
-0xFF0D6B91,
-0xFF0D6B8F,
-0xFF08688E,
-0xFF0B6790,
-0xFF146897,
-0xFF136796,
-0xFF096991,
-0xFF0A6C91,
-0xFF06668C,
-0xFF055E80,
-0xFF095670,
-0xFF6198AC,
-0xFFF0FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFF6FEFF,
-0xFFEEFFFF,
-0xFF77A2B2,
-0xFF0D5676,
-0xFF055E86,
-0xFF0B6894,
-0xFF096A97,
-0xFF096B98,
-0xFF0A6B96,
-0xFF0C6A90,
-0xFF0D6B8F,
-0xFF0B6A96,
-0xFF0B6A96,
-0xFF096894,
-0xFF096993,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0C6992,
-0xFF0C6992,
-0xFF0D6992,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0C688D,
-0xFF0D6990,
-0xFF0F6894,
-0xFF0F6391,
-0xFF13668E,
-0xFF0F6489,
-0xFF0D678C,
-0xFF0A668D,
-0xFF4198C3,
-0xFF519BC2,
-0xFF51839E,
-0xFFE6FFFF,
-0xFFF5FFFF,
-0xFFFBFFFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFF9FDFF,
-0xFFFAFFFF,
-0xFFF5FCFF,
-0xFFEEFFFF,
-0xFF376980,
-0xFF21627E,
-0xFF21617D,
-0xFF0D4A66,
-0xFF0E4B68,
-0xFF0C4864,
-0xFF104966,
-0xFF124967,
-0xFF124766,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF124766,
-0xFF124766,
-0xFF124766,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF134867,
-0xFF144968,
-0xFF144968,
-0xFF144968,
-0xFF144968,
-0xFF144B69,
-0xFF144B69,
-0xFF144B69,
-0xFF154C6A,
-0xFF154C6A,
-0xFF154C6B,
-0xFF154E6C,
-0xFF154E6C,
-0xFF164F6D,
-0xFF154D6E,
-0xFF134E6E,
-0xFF134E6E,
-0xFF144F6F,
-0xFF144F6F,
-0xFF145072,
-0xFF145072,
-0xFF134F71,
-0xFF145072,
-0xFF145074,
-0xFF155175,
-0xFF145376,
-0xFF145376,
-0xFF145376,
-0xFF145376,
-0xFF135376,
-0xFF135376,
-0xFF135377,
-0xFF135578,
-0xFF135578,
-0xFF135578,
-0xFF14557B,
-0xFF145679,
-0xFF15567C,
-0xFF14557B,
-0xFF14557B,
-0xFF13577C,
-0xFF14587D,
-0xFF15597E,
-0xFF15597E,
-0xFF145A7E,
-0xFF13587F,
-0xFF10587E,
-0xFF11597F,
-0xFF105A7F,
-0xFF115B82,
-0xFF115D81,
-0xFF115C83,
-0xFF115C83,
-0xFF0F5C86,
-0xFF0E5D86,
-0xFF0F5E85,
-0xFF0D5F84,
-0xFF106083,
-0xFF126182,
-0xFF155F82,
-0xFF155F84,
-0xFF135E85,
-0xFF156389,
-0xFF0C5C81,
-0xFF136388,
-0xFF115F85,
-0xFF155F84,
-0xFF15597C,
-0xFF1F5778,
-0xFF204861,
-0xFFE8FFFF,
-0xFFF9FFFF,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFF4FFFF,
-0xFFA7CDE0,
-0xFF084460,
-0xFF055270,
-0xFF0B5F81,
-0xFF0F628A,
-0xFF0F628C,
-0xFF0E638A,
-0xFF0E638A,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0D658B,
-0xFF0D658B,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0F678F,
-0xFF0D668E,
-0xFF0C658D,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0D6990,
-0xFF0B678C,
-0xFF0C6A8E,
-0xFF0C6A8E,
-0xFF0E678F,
-0xFF136595,
-0xFF126695,
-0xFF0C6992,
-0xFF0C6D90,
-0xFF005C7E,
-0xFF075876,
-0xFF0D4A5F,
-0xFFC9EFFC,
-0xFFF6FFFF,
-0xFFFFFEFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFF7FFFF,
-0xFFE7FFFF,
-0xFF154C61,
-0xFF055475,
-0xFF015D86,
-0xFF0D6A95,
-0xFF0B6A96,
-0xFF096A95,
-0xFF096993,
-0xFF0B698F,
-0xFF0C688F,
-0xFF0B6893,
-0xFF086793,
-0xFF096993,
-0xFF096993,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0B6893,
-0xFF0C6994,
-0xFF0C6994,
-0xFF0D6A95,
-0xFF0C6992,
-0xFF0D6A93,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0D6992,
-0xFF0C6891,
-0xFF0B678E,
-0xFF0A668B,
-0xFF0E688D,
-0xFF0E6791,
-0xFF106490,
-0xFF14668E,
-0xFF11648C,
-0xFF0B658A,
-0xFF167299,
-0xFF449BC6,
-0xFF488DB4,
-0xFF82A8BF,
-0xFFF1FFFF,
-0xFFF8FFFF,
-0xFFFEFFFD,
-0xFFFFFEFC,
-0xFFFEFDFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFCFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFFFF,
-0xFFF7FFFF,
-0xFFC7E2F7,
-0xFF144D68,
-0xFF1E6382,
-0xFF1B5B77,
-0xFF094561,
-0xFF144F6D,
-0xFF164F6D,
-0xFF164B6A,
-0xFF114463,
-0xFF134965,
-0xFF124A65,
-0xFF124A65,
-0xFF114964,
-0xFF114964,
-0xFF114964,
-0xFF114964,
-0xFF114964,
-0xFF124A65,
-0xFF124A65,
-0xFF124A65,
-0xFF124A65,
-0xFF134B66,
-0xFF134B66,
-0xFF134B66,
-0xFF124A65,
-0xFF134B66,
-0xFF144C67,
-0xFF144C67,
-0xFF154D68,
-0xFF154D68,
-0xFF154C6A,
-0xFF164D6B,
-0xFF164D6B,
-0xFF154E6B,
-0xFF154E6C,
-0xFF154E6C,
-0xFF154E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF144F6F,
-0xFF155070,
-0xFF13506F,
-0xFF13506F,
-0xFF145072,
-0xFF145072,
-0xFF155173,
-0xFF155173,
-0xFF145374,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF135376,
-0xFF135376,
-0xFF145477,
-0xFF145477,
-0xFF145478,
-0xFF145477,
-0xFF155579,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF15577A,
-0xFF13577A,
-0xFF14587B,
-0xFF13597B,
-0xFF145A7E,
-0xFF115A7D,
-0xFF115A7D,
-0xFF0F597C,
-0xFF105A7F,
-0xFF115B7E,
-0xFF125C81,
-0xFF115D81,
-0xFF115C84,
-0xFF0F5D84,
-0xFF0E5E83,
-0xFF0F5F82,
-0xFF116081,
-0xFF135F7F,
-0xFF155E7F,
-0xFF155E7F,
-0xFF145D80,
-0xFF176186,
-0xFF115D81,
-0xFF105F80,
-0xFF1A6688,
-0xFF135E7E,
-0xFF196283,
-0xFF21607F,
-0xFF1D4A67,
-0xFFB4D0E5,
-0xFFF5FEFF,
-0xFFFFFFFB,
-0xFFFFFCF8,
-0xFFFEFAF7,
-0xFFFCFFFF,
-0xFFF8FDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFF5FFFF,
-0xFFB2D3E4,
-0xFF0B3F57,
-0xFF024C67,
-0xFF0A5D7D,
-0xFF0F6388,
-0xFF0F628C,
-0xFF10638B,
-0xFF10638B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0D658B,
-0xFF0E668C,
-0xFF0D658B,
-0xFF0C648C,
-0xFF0D658D,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0D668E,
-0xFF0C688F,
-0xFF0A668B,
-0xFF0B698D,
-0xFF0F698C,
-0xFF0F678D,
-0xFF106492,
-0xFF126695,
-0xFF0F6890,
-0xFF086587,
-0xFF005A79,
-0xFF054F68,
-0xFF3C6778,
-0xFFEFFFFF,
-0xFFFBFFFF,
-0xFFFDFBFE,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFF4FFFF,
-0xFFA2CCDC,
-0xFF094964,
-0xFF045477,
-0xFF046087,
-0xFF0B6B95,
-0xFF0A6A94,
-0xFF0B6893,
-0xFF0B6891,
-0xFF0D6990,
-0xFF0C688F,
-0xFF0B6893,
-0xFF0A6793,
-0xFF0C6994,
-0xFF0C6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0E6A93,
-0xFF0E6A93,
-0xFF0F6B94,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0F6892,
-0xFF0F6892,
-0xFF0E6791,
-0xFF0E6791,
-0xFF0E678F,
-0xFF0D668E,
-0xFF0D678C,
-0xFF0D678C,
-0xFF0C658D,
-0xFF0E668E,
-0xFF12638E,
-0xFF11638B,
-0xFF0B6389,
-0xFF2D86AE,
-0xFF3F96C1,
-0xFF4387AA,
-0xFFCDEAFC,
-0xFFF4FBFF,
-0xFFFAFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFF9FDFF,
-0xFFF2FFFF,
-0xFF6A8CA5,
-0xFF1A5774,
-0xFF1F6682,
-0xFF124F6B,
-0xFF114A65,
-0xFF0F4866,
-0xFF114867,
-0xFF144565,
-0xFF174866,
-0xFF134965,
-0xFF124A65,
-0xFF114964,
-0xFF114964,
-0xFF114964,
-0xFF114964,
-0xFF114964,
-0xFF124A65,
-0xFF124A65,
-0xFF124A65,
-0xFF114964,
-0xFF124A65,
-0xFF134B66,
-0xFF134B66,
-0xFF134B66,
-0xFF124A65,
-0xFF124A65,
-0xFF134B66,
-0xFF144C67,
-0xFF154D68,
-0xFF154D68,
-0xFF154D68,
-0xFF154C6A,
-0xFF154E6B,
-0xFF154E6B,
-0xFF154E6B,
-0xFF164F6D,
-0xFF134E6C,
-0xFF134E6C,
-0xFF134E6C,
-0xFF144F6D,
-0xFF15506E,
-0xFF13506F,
-0xFF13506F,
-0xFF145170,
-0xFF145170,
-0xFF145072,
-0xFF155173,
-0xFF145374,
-0xFF155475,
-0xFF145374,
-0xFF145374,
-0xFF135474,
-0xFF135474,
-0xFF145477,
-0xFF145477,
-0xFF145477,
-0xFF145477,
-0xFF165679,
-0xFF155578,
-0xFF145678,
-0xFF135578,
-0xFF135578,
-0xFF145679,
-0xFF13577A,
-0xFF14587B,
-0xFF165C7E,
-0xFF145A7C,
-0xFF115A7B,
-0xFF10597A,
-0xFF115A7D,
-0xFF115C7C,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C81,
-0xFF125C81,
-0xFF0E5C80,
-0xFF0F5E7F,
-0xFF105F7E,
-0xFF125E7E,
-0xFF145F7F,
-0xFF145D7E,
-0xFF176083,
-0xFF105A7F,
-0xFF166286,
-0xFF126084,
-0xFF105F80,
-0xFF126182,
-0xFF176282,
-0xFF1E6080,
-0xFF205171,
-0xFF86A5BA,
-0xFFF7FFFF,
-0xFFFEFDF9,
-0xFFFFFEFA,
-0xFFFFFDFA,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFA,
-0xFFF7FFFF,
-0xFFB6D3E3,
-0xFF0A3A51,
-0xFF014761,
-0xFF095A78,
-0xFF0F6187,
-0xFF0D6088,
-0xFF11648C,
-0xFF10638B,
-0xFF10638B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0C648A,
-0xFF0C648C,
-0xFF0D658D,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0D668E,
-0xFF0D698E,
-0xFF0B678C,
-0xFF0E688B,
-0xFF0E668C,
-0xFF0E6592,
-0xFF116796,
-0xFF0D658D,
-0xFF045A7D,
-0xFF004E6C,
-0xFF07455C,
-0xFF9CB9C7,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFDFCFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFBFDFA,
-0xFFF1FFFF,
-0xFF35657B,
-0xFF044B69,
-0xFF005175,
-0xFF0C688F,
-0xFF096991,
-0xFF096993,
-0xFF0C688F,
-0xFF0D6990,
-0xFF0E6A91,
-0xFF0E6A93,
-0xFF0D6A95,
-0xFF0D6A95,
-0xFF0E6B94,
-0xFF0F6B94,
-0xFF0E6A93,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0D6992,
-0xFF0E6A93,
-0xFF0C6891,
-0xFF0C6891,
-0xFF0E6791,
-0xFF0D6690,
-0xFF0E6791,
-0xFF0E6791,
-0xFF0F6890,
-0xFF0F6890,
-0xFF106991,
-0xFF0D668E,
-0xFF08648B,
-0xFF0E668E,
-0xFF0F628C,
-0xFF0F628C,
-0xFF0A638D,
-0xFF3E97BF,
-0xFF398CB4,
-0xFF4F8CAB,
-0xFFEEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFDFCFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFFBFBFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF8FFFF,
-0xFFEEFFFF,
-0xFF1C4360,
-0xFF2B6884,
-0xFF185B75,
-0xFF104C66,
-0xFF104863,
-0xFF124968,
-0xFF134867,
-0xFF184763,
-0xFF184761,
-0xFF134965,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF114A65,
-0xFF124B66,
-0xFF124B66,
-0xFF124B66,
-0xFF134C67,
-0xFF144D68,
-0xFF144D68,
-0xFF154E6B,
-0xFF134F6B,
-0xFF134F6B,
-0xFF134F6B,
-0xFF134F6B,
-0xFF134F6B,
-0xFF144F6D,
-0xFF13506D,
-0xFF13506D,
-0xFF13506D,
-0xFF13506F,
-0xFF13506F,
-0xFF125170,
-0xFF125170,
-0xFF135271,
-0xFF135271,
-0xFF145372,
-0xFF145372,
-0xFF135271,
-0xFF135271,
-0xFF125373,
-0xFF125373,
-0xFF135474,
-0xFF135474,
-0xFF135474,
-0xFF145575,
-0xFF135575,
-0xFF135575,
-0xFF135575,
-0xFF145678,
-0xFF145678,
-0xFF155779,
-0xFF135879,
-0xFF135879,
-0xFF135A7A,
-0xFF135A7A,
-0xFF135A7A,
-0xFF115A7A,
-0xFF115A7B,
-0xFF115A7A,
-0xFF115A7B,
-0xFF115A7A,
-0xFF15597C,
-0xFF145A7C,
-0xFF125D7D,
-0xFF115D7D,
-0xFF0F5E7D,
-0xFF0F5E7D,
-0xFF115D81,
-0xFF135D82,
-0xFF155F86,
-0xFF125D84,
-0xFF126087,
-0xFF105F86,
-0xFF0E6085,
-0xFF106287,
-0xFF126084,
-0xFF1F6386,
-0xFF205372,
-0xFF8BAABF,
-0xFFF6FFFF,
-0xFFFFFFFB,
-0xFFFFFDF9,
-0xFFFFFEFB,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFB,
-0xFFF5FFFF,
-0xFFB5D1DF,
-0xFF0A384F,
-0xFF054862,
-0xFF0B5A78,
-0xFF14668B,
-0xFF0E6088,
-0xFF10628A,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0F6388,
-0xFF106489,
-0xFF106489,
-0xFF10638B,
-0xFF0E638A,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0D658B,
-0xFF0D658B,
-0xFF0C668B,
-0xFF0A668B,
-0xFF0C688D,
-0xFF0A6487,
-0xFF0F678D,
-0xFF0E6592,
-0xFF0D6491,
-0xFF11668D,
-0xFF004A6B,
-0xFF054A69,
-0xFF07374D,
-0xFFF1FFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFD,
-0xFFFFFDFC,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFF9FDFC,
-0xFFDFF6FC,
-0xFF033951,
-0xFF044F6F,
-0xFF015579,
-0xFF0F6B90,
-0xFF0E6C92,
-0xFF0E6C92,
-0xFF0E6A91,
-0xFF106991,
-0xFF0F6890,
-0xFF0D6992,
-0xFF0C6994,
-0xFF0C6994,
-0xFF0D6992,
-0xFF0F6890,
-0xFF0F6890,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E668E,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0E668E,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0B678E,
-0xFF0B648C,
-0xFF0C648A,
-0xFF0F628C,
-0xFF085F8A,
-0xFF1A77A3,
-0xFF3790BA,
-0xFF357FA2,
-0xFF98CAE3,
-0xFFF4FFFF,
-0xFFFFFEFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFC,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFCFEFD,
-0xFFFCFEFB,
-0xFFF7FFFF,
-0xFF94B0C6,
-0xFF265370,
-0xFF205E77,
-0xFF13556F,
-0xFF0C4A63,
-0xFF0C4864,
-0xFF0E4969,
-0xFF104869,
-0xFF144563,
-0xFF144661,
-0xFF104765,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0D4965,
-0xFF0E4A66,
-0xFF0F4B67,
-0xFF0F4B67,
-0xFF0F4B67,
-0xFF104C68,
-0xFF104C68,
-0xFF104D6A,
-0xFF104D6A,
-0xFF104D6A,
-0xFF104D6A,
-0xFF114E6B,
-0xFF114E6B,
-0xFF114E6D,
-0xFF0F4E6D,
-0xFF0F4E6D,
-0xFF0F4E6D,
-0xFF104F70,
-0xFF104F70,
-0xFF115071,
-0xFF105171,
-0xFF115071,
-0xFF115272,
-0xFF125172,
-0xFF115272,
-0xFF135273,
-0xFF125373,
-0xFF125373,
-0xFF125474,
-0xFF135376,
-0xFF125474,
-0xFF135376,
-0xFF135577,
-0xFF135577,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145678,
-0xFF125778,
-0xFF125679,
-0xFF125778,
-0xFF13597B,
-0xFF135A7A,
-0xFF13597B,
-0xFF135A7A,
-0xFF115A7B,
-0xFF115A7A,
-0xFF115A7B,
-0xFF135A7A,
-0xFF17597B,
-0xFF17597B,
-0xFF135C7C,
-0xFF125D7D,
-0xFF115D7D,
-0xFF115D7F,
-0xFF115C83,
-0xFF125D84,
-0xFF155E87,
-0xFF115C84,
-0xFF115F86,
-0xFF105F86,
-0xFF0C5C81,
-0xFF0F5F82,
-0xFF186488,
-0xFF1C5E80,
-0xFF1A4967,
-0xFFBFDBF0,
-0xFFF5FEFF,
-0xFFFFFFFB,
-0xFFFFFEFA,
-0xFFFFFEFB,
-0xFFFAFEFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFEF9,
-0xFFF5FFFF,
-0xFFA2BFCF,
-0xFF0B3B52,
-0xFF094C66,
-0xFF0B5A78,
-0xFF116186,
-0xFF116389,
-0xFF106288,
-0xFF106288,
-0xFF0E6287,
-0xFF0E6287,
-0xFF0E6287,
-0xFF0F6388,
-0xFF0F628A,
-0xFF0F628A,
-0xFF0F628A,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0D658B,
-0xFF0D658B,
-0xFF0D678C,
-0xFF0C668B,
-0xFF0B658A,
-0xFF116991,
-0xFF0D6491,
-0xFF136793,
-0xFF075B80,
-0xFF004565,
-0xFF053D58,
-0xFF6C8FA3,
-0xFFF1FEFF,
-0xFFFCFEFD,
-0xFFFBFFFF,
-0xFFFDFFFE,
-0xFFFFFDFC,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFBFA,
-0xFFFCFCFC,
-0xFFF7FFFF,
-0xFF6E8C96,
-0xFF043D58,
-0xFF004A6C,
-0xFF0B6085,
-0xFF126E95,
-0xFF0D698E,
-0xFF0D698E,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0F678F,
-0xFF0D6690,
-0xFF0B6692,
-0xFF0B6692,
-0xFF0F6892,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0D668E,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E678F,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0D658D,
-0xFF09658E,
-0xFF08648B,
-0xFF0D668E,
-0xFF0D658D,
-0xFF126790,
-0xFF08618D,
-0xFF2A8CBB,
-0xFF2D86B0,
-0xFF3C7998,
-0xFFDCFFFF,
-0xFFF8FFFF,
-0xFFFFFFFF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFF9FEFA,
-0xFFFBFDFA,
-0xFFFCFFFD,
-0xFFF9FFFD,
-0xFFEFFFFF,
-0xFF3F637B,
-0xFF275A79,
-0xFF24627B,
-0xFF1B5D77,
-0xFF175874,
-0xFF175979,
-0xFF185A7D,
-0xFF18587C,
-0xFF1C5779,
-0xFF1E5677,
-0xFF1B5877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF195877,
-0xFF1C5978,
-0xFF1C5978,
-0xFF1C5978,
-0xFF1C5978,
-0xFF1B5A79,
-0xFF1B5A79,
-0xFF1B5A7B,
-0xFF1B5A7B,
-0xFF1B5A7B,
-0xFF1B5A7B,
-0xFF1B5A7B,
-0xFF1A5B7B,
-0xFF1A5B7B,
-0xFF1A5B7B,
-0xFF1A5B7B,
-0xFF1A5B7B,
-0xFF19597C,
-0xFF19597C,
-0xFF19597C,
-0xFF185A7C,
-0xFF19597C,
-0xFF195B7D,
-0xFF1A5A7D,
-0xFF195B7D,
-0xFF1B5B7E,
-0xFF1A5C7E,
-0xFF1A5C7E,
-0xFF185D7E,
-0xFF1A5C7F,
-0xFF185D7E,
-0xFF1A5C7F,
-0xFF185C7F,
-0xFF195D80,
-0xFF195D80,
-0xFF195D80,
-0xFF195D80,
-0xFF195D80,
-0xFF185E80,
-0xFF185E82,
-0xFF185E80,
-0xFF195F83,
-0xFF195F81,
-0xFF195F83,
-0xFF195F81,
-0xFF176083,
-0xFF176081,
-0xFF176083,
-0xFF195F81,
-0xFF1C5E80,
-0xFF1C5E80,
-0xFF1A6082,
-0xFF176184,
-0xFF156185,
-0xFF166188,
-0xFF176188,
-0xFF176089,
-0xFF155C86,
-0xFF176089,
-0xFF176289,
-0xFF186488,
-0xFF176184,
-0xFF196283,
-0xFF1F6386,
-0xFF265F7D,
-0xFF386079,
-0xFFEDFFFF,
-0xFFF9FFFF,
-0xFFFFFFFB,
-0xFFFFFCF7,
-0xFFFEFDF9,
-0xFFFCFFFF,
-0xFFF9FDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFF5FFFF,
-0xFF8BACBF,
-0xFF0E415C,
-0xFF0F526F,
-0xFF105C7C,
-0xFF115F83,
-0xFF14638A,
-0xFF106288,
-0xFF106288,
-0xFF0F6187,
-0xFF0F6187,
-0xFF0F6187,
-0xFF0F6187,
-0xFF0F6187,
-0xFF0E6287,
-0xFF0F6388,
-0xFF0F6388,
-0xFF10638B,
-0xFF10638B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF10658C,
-0xFF10658C,
-0xFF0C648A,
-0xFF0C648A,
-0xFF0B658A,
-0xFF0E678F,
-0xFF0E628E,
-0xFF12658D,
-0xFF005173,
-0xFF064966,
-0xFF0F3751,
-0xFFD5EAFB,
-0xFFF8FFFF,
-0xFFFBFFFC,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFFFDFE,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFCFFFF,
-0xFFEFFFFF,
-0xFF19404F,
-0xFF084561,
-0xFF004A6B,
-0xFF10688E,
-0xFF0D6990,
-0xFF0E688B,
-0xFF0E668A,
-0xFF0D668E,
-0xFF0D6690,
-0xFF10658E,
-0xFF0E668E,
-0xFF0B6692,
-0xFF0B6692,
-0xFF0E6791,
-0xFF0F678F,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0E668E,
-0xFF0F678F,
-0xFF0E668C,
-0xFF0E668C,
-0xFF10658C,
-0xFF10658C,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0D658B,
-0xFF09658C,
-0xFF09658C,
-0xFF0D658D,
-0xFF11668F,
-0xFF0B638B,
-0xFF106D98,
-0xFF258BBB,
-0xFF277EA9,
-0xFF719FB7,
-0xFFF0FFFF,
-0xFFFAFEFF,
-0xFFFDFEFF,
-0xFFFBFFFF,
-0xFFFBFFFE,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFEFB,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFAFFFB,
-0xFFFBFFFF,
-0xFFEFFFFF,
-0xFF21455B,
-0xFF295B76,
-0xFF2A627B,
-0xFF25617B,
-0xFF22627E,
-0xFF226383,
-0xFF226487,
-0xFF226286,
-0xFF256185,
-0xFF286081,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF26617F,
-0xFF28617F,
-0xFF28617F,
-0xFF28617F,
-0xFF28617F,
-0xFF26617F,
-0xFF26617F,
-0xFF266181,
-0xFF266181,
-0xFF266181,
-0xFF266181,
-0xFF266181,
-0xFF266181,
-0xFF256281,
-0xFF246180,
-0xFF246180,
-0xFF246180,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF256183,
-0xFF236283,
-0xFF226182,
-0xFF226182,
-0xFF226182,
-0xFF226182,
-0xFF226182,
-0xFF236283,
-0xFF236283,
-0xFF236285,
-0xFF236283,
-0xFF236285,
-0xFF216282,
-0xFF226184,
-0xFF216282,
-0xFF226184,
-0xFF216282,
-0xFF226184,
-0xFF216282,
-0xFF216184,
-0xFF216282,
-0xFF216184,
-0xFF216282,
-0xFF246180,
-0xFF246180,
-0xFF216282,
-0xFF206284,
-0xFF206285,
-0xFF206285,
-0xFF226288,
-0xFF226288,
-0xFF236186,
-0xFF206083,
-0xFF216282,
-0xFF20617F,
-0xFF25627F,
-0xFF28617E,
-0xFF1D536F,
-0xFF1D4962,
-0xFFDBF8FF,
-0xFFF1FFFF,
-0xFFF9FEFF,
-0xFFFFFFFD,
-0xFFFCFBF7,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF1FFFF,
-0xFF6B91A8,
-0xFF124B69,
-0xFF105576,
-0xFF135F81,
-0xFF136185,
-0xFF106085,
-0xFF116186,
-0xFF0F6187,
-0xFF106288,
-0xFF116389,
-0xFF116389,
-0xFF106288,
-0xFF0F6187,
-0xFF0E6086,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0F628A,
-0xFF10638B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0E6189,
-0xFF10658C,
-0xFF0C658D,
-0xFF0B648C,
-0xFF11638B,
-0xFF0F5D83,
-0xFF045070,
-0xFF0F4B67,
-0xFF456177,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFAFFFC,
-0xFFFAFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFF8FFFF,
-0xFFA0C0CB,
-0xFF083B4E,
-0xFF064763,
-0xFF08567A,
-0xFF136B93,
-0xFF09658C,
-0xFF0F678B,
-0xFF0F678B,
-0xFF0D668E,
-0xFF0D6690,
-0xFF11668F,
-0xFF11668F,
-0xFF0E6791,
-0xFF0C6891,
-0xFF0D668E,
-0xFF0E668E,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0D658D,
-0xFF0E668E,
-0xFF0F678F,
-0xFF0D658B,
-0xFF0D658B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF10658C,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0D658B,
-0xFF0C668B,
-0xFF0E678F,
-0xFF0D628B,
-0xFF106490,
-0xFF036089,
-0xFF1A7BA5,
-0xFF1C83B0,
-0xFF1E7096,
-0xFFC6E9FD,
-0xFFF4FDFF,
-0xFFFCFFFF,
-0xFFFCFDFF,
-0xFFF9FFFD,
-0xFFFAFFFC,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFBFDF8,
-0xFFFEFFFD,
-0xFFF7FBFA,
-0xFFFBFFFF,
-0xFFF1FFFF,
-0xFF5D7D8C,
-0xFF1D475D,
-0xFF214E65,
-0xFF204F69,
-0xFF1E516C,
-0xFF1C526E,
-0xFF1A5371,
-0xFF1A5273,
-0xFF1C5171,
-0xFF1F506E,
-0xFF21506C,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF21506A,
-0xFF204F69,
-0xFF204F69,
-0xFF204F69,
-0xFF204F6B,
-0xFF204F6B,
-0xFF204F6B,
-0xFF204F6B,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF1F516C,
-0xFF1E506B,
-0xFF1E506B,
-0xFF1E506B,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF21506C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1F506E,
-0xFF1F516C,
-0xFF1F506E,
-0xFF1D506B,
-0xFF1E4F6D,
-0xFF1D506B,
-0xFF1F506E,
-0xFF1E516C,
-0xFF1F506E,
-0xFF1E516C,
-0xFF1E516E,
-0xFF1E516C,
-0xFF1E516E,
-0xFF1E516C,
-0xFF1F516C,
-0xFF1F516C,
-0xFF1E516E,
-0xFF1E516E,
-0xFF1E5170,
-0xFF1E5170,
-0xFF21506E,
-0xFF21506E,
-0xFF1F4C69,
-0xFF24546B,
-0xFF215167,
-0xFF1C4B5F,
-0xFF244F62,
-0xFF244A5D,
-0xFF618295,
-0xFFEBFFFF,
-0xFFF2FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFBFBF9,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFFFE,
-0xFFF1FFFF,
-0xFF406E86,
-0xFF145376,
-0xFF11577B,
-0xFF145E83,
-0xFF166284,
-0xFF0E5E7F,
-0xFF106085,
-0xFF116186,
-0xFF126287,
-0xFF136388,
-0xFF136388,
-0xFF136388,
-0xFF106288,
-0xFF0F6187,
-0xFF0F6187,
-0xFF106288,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0E6287,
-0xFF0F628A,
-0xFF0F628A,
-0xFF116389,
-0xFF10638B,
-0xFF0D668E,
-0xFF0D658D,
-0xFF136388,
-0xFF0F587B,
-0xFF105574,
-0xFF0B3F57,
-0xFFB1C4D5,
-0xFFFAFEFF,
-0xFFF8FEFC,
-0xFFFBFFFD,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFFFDFE,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF1FFFF,
-0xFF396475,
-0xFF0D4963,
-0xFF044B69,
-0xFF156588,
-0xFF116991,
-0xFF0B678E,
-0xFF0E668A,
-0xFF0E668A,
-0xFF0E668E,
-0xFF0E6590,
-0xFF11648E,
-0xFF10658C,
-0xFF0E678F,
-0xFF0C688F,
-0xFF0C668B,
-0xFF0D658B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF10658C,
-0xFF10658C,
-0xFF0F648B,
-0xFF0F648B,
-0xFF10638B,
-0xFF10638B,
-0xFF10638B,
-0xFF10638B,
-0xFF10638B,
-0xFF0F648B,
-0xFF0C648A,
-0xFF0F648B,
-0xFF0F608B,
-0xFF0A618C,
-0xFF076A93,
-0xFF197EA8,
-0xFF1D7DA7,
-0xFF377D9F,
-0xFFEBFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFBFFFB,
-0xFFFCFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFB,
-0xFFFDFDFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFFECFFFF,
-0xFFB1CFDA,
-0xFFACC9DB,
-0xFFABCADF,
-0xFFABCBE0,
-0xFFA7CCDF,
-0xFFA7CBE1,
-0xFFA7CBE1,
-0xFFA8CBE1,
-0xFFAACADF,
-0xFFAACBDE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFAACBDC,
-0xFFABCADE,
-0xFFABCADC,
-0xFFABCADE,
-0xFFABCADC,
-0xFFABCADE,
-0xFFABCADE,
-0xFFABCADE,
-0xFFABCADE,
-0xFFABCADE,
-0xFFAACBDE,
-0xFFABCADE,
-0xFFAACBDE,
-0xFFABCADE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAAC9DD,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFA9CADD,
-0xFFA9CADD,
-0xFFA9CADD,
-0xFFA9CADD,
-0xFFA9CADD,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFAACBDE,
-0xFFA8CBDF,
-0xFFA8CBDF,
-0xFFAACADF,
-0xFFABCADF,
-0xFFADC9DE,
-0xFFAEC9DC,
-0xFFADCADA,
-0xFFACC9D7,
-0xFFABCBD6,
-0xFFA5C6CF,
-0xFFC4DFEA,
-0xFFEBFFFF,
-0xFFF0FFFF,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFCFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF0FFFF,
-0xFF20536E,
-0xFF195D82,
-0xFF175C85,
-0xFF135D82,
-0xFF156183,
-0xFF11607F,
-0xFF106083,
-0xFF106085,
-0xFF116186,
-0xFF116186,
-0xFF116186,
-0xFF116186,
-0xFF106288,
-0xFF106288,
-0xFF0F6187,
-0xFF106288,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0E6287,
-0xFF0E6287,
-0xFF0E6189,
-0xFF106288,
-0xFF14638A,
-0xFF0C5E86,
-0xFF0C658D,
-0xFF0F678D,
-0xFF146084,
-0xFF155A7B,
-0xFF175471,
-0xFF1F4C63,
-0xFFF4FFFF,
-0xFFFEFFFF,
-0xFFFAFEFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFDFF,
-0xFFFEFEFE,
-0xFFFEFEFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFD2ECF9,
-0xFF093D55,
-0xFF0B506F,
-0xFF0A5678,
-0xFF13678B,
-0xFF096187,
-0xFF0E678F,
-0xFF0C658D,
-0xFF0C658D,
-0xFF0D658D,
-0xFF0F648D,
-0xFF10638D,
-0xFF10638B,
-0xFF0D658B,
-0xFF0C6689,
-0xFF0D658B,
-0xFF0D658B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF10658C,
-0xFF0F648B,
-0xFF10638B,
-0xFF10638B,
-0xFF0F628A,
-0xFF0F628A,
-0xFF0F628A,
-0xFF0E6287,
-0xFF0F6388,
-0xFF0C6085,
-0xFF11638B,
-0xFF07608A,
-0xFF07719B,
-0xFF127CA4,
-0xFF10688E,
-0xFF8DC8E6,
-0xFFEFFFFF,
-0xFFFDFCFF,
-0xFFFFFEFC,
-0xFFFEFFF9,
-0xFFF9FEF7,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFAFAFC,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF6FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF2FFFF,
-0xFFF9FFFF,
-0xFFFEFEFF,
-0xFFFEFBFF,
-0xFFFEFAF9,
-0xFFFFFEFB,
-0xFFFCFBF9,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFAFAFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFD3E9F6,
-0xFF17506D,
-0xFF1A648B,
-0xFF19608A,
-0xFF125C83,
-0xFF146080,
-0xFF11607F,
-0xFF106083,
-0xFF106085,
-0xFF106085,
-0xFF106085,
-0xFF0F5F84,
-0xFF106085,
-0xFF116186,
-0xFF126287,
-0xFF0F6187,
-0xFF106288,
-0xFF106288,
-0xFF106288,
-0xFF0F6187,
-0xFF0F6187,
-0xFF0F6388,
-0xFF116389,
-0xFF126087,
-0xFF105F86,
-0xFF0C608C,
-0xFF11648C,
-0xFF146080,
-0xFF1D5E7C,
-0xFF184D6C,
-0xFF789CB2,
-0xFFF4FFFF,
-0xFFFEFEFE,
-0xFFFCFEFB,
-0xFFFEFEFE,
-0xFFFCFBFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFDFFFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFEFFEFF,
-0xFF7A99AB,
-0xFF094561,
-0xFF085476,
-0xFF0D6186,
-0xFF0E638A,
-0xFF0C6186,
-0xFF0F678D,
-0xFF08658E,
-0xFF08658E,
-0xFF0E638A,
-0xFF10628A,
-0xFF0F628C,
-0xFF0F628C,
-0xFF0C6488,
-0xFF0C6587,
-0xFF0D6589,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0F648B,
-0xFF0E638A,
-0xFF10638B,
-0xFF10638B,
-0xFF0F628A,
-0xFF0F628A,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0F6388,
-0xFF136388,
-0xFF106085,
-0xFF106287,
-0xFF06628B,
-0xFF0473A0,
-0xFF0C77A1,
-0xFF216D8D,
-0xFFDAFFFF,
-0xFFF1FFFF,
-0xFFF7FAFF,
-0xFFFFFFFA,
-0xFFFFFFF6,
-0xFFFFFFF8,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFFEFEFF,
-0xFFFEFFFD,
-0xFFFDFDFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFC,
-0xFFFFFDFC,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFA,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFEFEFC,
-0xFFFCFFFD,
-0xFFF7FDF9,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFCFE,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFB,
-0xFFFFFBF8,
-0xFFFFFFFD,
-0xFFFEFCFD,
-0xFFFDFDFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF7FEFF,
-0xFFA5BFCE,
-0xFF185371,
-0xFF156087,
-0xFF165F88,
-0xFF115B82,
-0xFF156181,
-0xFF105F7E,
-0xFF105E82,
-0xFF106085,
-0xFF126086,
-0xFF116186,
-0xFF115F85,
-0xFF106085,
-0xFF106085,
-0xFF106085,
-0xFF105F86,
-0xFF0F6187,
-0xFF126188,
-0xFF106288,
-0xFF126188,
-0xFF0F6187,
-0xFF106288,
-0xFF116388,
-0xFF0F5D83,
-0xFF18668D,
-0xFF0C5F89,
-0xFF0F6189,
-0xFF186383,
-0xFF24617E,
-0xFF1C4861,
-0xFFDEF9FF,
-0xFFF8FFFF,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF9FFFF,
-0xFFECFFFF,
-0xFF204A62,
-0xFF165576,
-0xFF0C5A80,
-0xFF11658A,
-0xFF0F648B,
-0xFF14688D,
-0xFF0C6188,
-0xFF0A668F,
-0xFF0A668F,
-0xFF0F628A,
-0xFF106288,
-0xFF10618C,
-0xFF0E638C,
-0xFF0E6388,
-0xFF0C6587,
-0xFF0F6489,
-0xFF0F648B,
-0xFF10658C,
-0xFF10658C,
-0xFF10658C,
-0xFF0F648B,
-0xFF0E638A,
-0xFF0E638A,
-0xFF0F628A,
-0xFF0E6287,
-0xFF0E6189,
-0xFF0E6287,
-0xFF0F6388,
-0xFF0F6388,
-0xFF106489,
-0xFF12648A,
-0xFF116186,
-0xFF146489,
-0xFF0D6185,
-0xFF08668C,
-0xFF0675A2,
-0xFF0B6E97,
-0xFF5A96B2,
-0xFFE7FFFF,
-0xFFF1FDFF,
-0xFFFCFFFF,
-0xFFFBFAF5,
-0xFFFFFFF6,
-0xFFFFFFFA,
-0xFFFCFDF8,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFCFB,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFCFEFD,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF5E7D8F,
-0xFF1B5875,
-0xFF186488,
-0xFF135D84,
-0xFF145E85,
-0xFF0F597E,
-0xFF135F81,
-0xFF145F86,
-0xFF115F85,
-0xFF135E85,
-0xFF115F85,
-0xFF135E85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF106085,
-0xFF126086,
-0xFF116186,
-0xFF136187,
-0xFF126287,
-0xFF126287,
-0xFF136388,
-0xFF115F85,
-0xFF156389,
-0xFF126188,
-0xFF136188,
-0xFF1E668C,
-0xFF1E5774,
-0xFF577889,
-0xFFF1FFFF,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFAFCFB,
-0xFFFEFFFF,
-0xFFFDFDFF,
-0xFFF5FFFF,
-0xFFA0C5DF,
-0xFF104869,
-0xFF17597C,
-0xFF196388,
-0xFF106085,
-0xFF0E6287,
-0xFF0F6388,
-0xFF0F6489,
-0xFF10658E,
-0xFF10638D,
-0xFF11638B,
-0xFF10628A,
-0xFF10628A,
-0xFF0E638A,
-0xFF0E638A,
-0xFF0D6589,
-0xFF0D6287,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0E6287,
-0xFF0D6088,
-0xFF0D6088,
-0xFF0D6289,
-0xFF0D6289,
-0xFF0D6186,
-0xFF0E6286,
-0xFF0F6388,
-0xFF106489,
-0xFF116389,
-0xFF106288,
-0xFF106288,
-0xFF136289,
-0xFF126087,
-0xFF106288,
-0xFF0B6387,
-0xFF0A6B8E,
-0xFF0B709A,
-0xFF116186,
-0xFFC0E4FA,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFFFFFB,
-0xFFF9FBF6,
-0xFFFEFFFF,
-0xFFF7FFFF,
-0xFFEEFFFF,
-0xFF284E65,
-0xFF246382,
-0xFF186285,
-0xFF115B82,
-0xFF0F5A81,
-0xFF125C81,
-0xFF125C81,
-0xFF125E82,
-0xFF125D84,
-0xFF135E85,
-0xFF135E85,
-0xFF135E85,
-0xFF135E85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF126086,
-0xFF126086,
-0xFF126086,
-0xFF126086,
-0xFF126086,
-0xFF146286,
-0xFF115F83,
-0xFF105E84,
-0xFF166188,
-0xFF1F6388,
-0xFF1B4E6B,
-0xFFB7D2DD,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFCFFFA,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFEEFFFF,
-0xFF3E6D8B,
-0xFF17577B,
-0xFF1A5E83,
-0xFF125C7F,
-0xFF15658A,
-0xFF12668A,
-0xFF106489,
-0xFF10658A,
-0xFF10628A,
-0xFF10628A,
-0xFF12618A,
-0xFF12618A,
-0xFF10628A,
-0xFF0F628A,
-0xFF0E638A,
-0xFF0E6388,
-0xFF0E6287,
-0xFF0E6286,
-0xFF0E6287,
-0xFF0E6287,
-0xFF0E6189,
-0xFF0E6189,
-0xFF0F628A,
-0xFF0F6388,
-0xFF106488,
-0xFF106488,
-0xFF116388,
-0xFF106287,
-0xFF106287,
-0xFF116087,
-0xFF116087,
-0xFF116087,
-0xFF105F86,
-0xFF10638B,
-0xFF056387,
-0xFF066488,
-0xFF10658A,
-0xFF377491,
-0xFFEEFFFF,
-0xFFFAFAFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFBFCFE,
-0xFFF7FFFF,
-0xFFABCADE,
-0xFF1A4965,
-0xFF266286,
-0xFF165F82,
-0xFF105B82,
-0xFF0F5D81,
-0xFF145E81,
-0xFF115C7C,
-0xFF115D81,
-0xFF115D81,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF135F83,
-0xFF135E85,
-0xFF135E85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF126084,
-0xFF105E82,
-0xFF17658B,
-0xFF196187,
-0xFF1E5F7F,
-0xFF28586F,
-0xFFEFFFFF,
-0xFFFAFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFCF9,
-0xFFFFFDFF,
-0xFFF6FFFF,
-0xFFD4EEFF,
-0xFF164968,
-0xFF1F6184,
-0xFF1C6286,
-0xFF166083,
-0xFF136388,
-0xFF0E6286,
-0xFF0D6186,
-0xFF0A5F84,
-0xFF0E6088,
-0xFF0F6189,
-0xFF12618A,
-0xFF12618A,
-0xFF11638B,
-0xFF0F628A,
-0xFF0E6388,
-0xFF0D6287,
-0xFF0F6388,
-0xFF0E6287,
-0xFF0F6187,
-0xFF0F6187,
-0xFF106288,
-0xFF106288,
-0xFF106288,
-0xFF106288,
-0xFF106287,
-0xFF106385,
-0xFF116184,
-0xFF116184,
-0xFF116184,
-0xFF126086,
-0xFF126086,
-0xFF106085,
-0xFF0E6085,
-0xFF075F85,
-0xFF056690,
-0xFF0D678C,
-0xFF135472,
-0xFFA5D0E3,
-0xFFF1FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFDFCFA,
-0xFFFCFCFC,
-0xFFFCFFFF,
-0xFFEEFFFF,
-0xFF4C718B,
-0xFF2A5F81,
-0xFF205C81,
-0xFF14587F,
-0xFF125E82,
-0xFF115F83,
-0xFF105B7B,
-0xFF135E7E,
-0xFF125C7F,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF125E82,
-0xFF125E82,
-0xFF125D84,
-0xFF125D84,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF105E84,
-0xFF126084,
-0xFF125E82,
-0xFF186488,
-0xFF1C6284,
-0xFF1A5672,
-0xFF83ACBE,
-0xFFF4FFFF,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFEFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFCFA,
-0xFFFFFEFF,
-0xFFF1FFFF,
-0xFF7295A9,
-0xFF225978,
-0xFF195D80,
-0xFF195F83,
-0xFF186488,
-0xFF106085,
-0xFF0F6387,
-0xFF0F6388,
-0xFF0E6287,
-0xFF0F6189,
-0xFF10628A,
-0xFF12618A,
-0xFF13628B,
-0xFF13628B,
-0xFF106288,
-0xFF0F6388,
-0xFF0F6388,
-0xFF106489,
-0xFF0F6388,
-0xFF0F6187,
-0xFF116087,
-0xFF126188,
-0xFF136188,
-0xFF126087,
-0xFF126086,
-0xFF115F83,
-0xFF116184,
-0xFF116184,
-0xFF106083,
-0xFF115F83,
-0xFF115F83,
-0xFF105E84,
-0xFF0F5F84,
-0xFF106689,
-0xFF035D82,
-0xFF025F8A,
-0xFF09597E,
-0xFF2F5E72,
-0xFFEBFFFF,
-0xFFF0FFFF,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF8FDFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFF8FFFF,
-0xFFDDF7FF,
-0xFF1E4D6B,
-0xFF235D83,
-0xFF1F5D86,
-0xFF15567E,
-0xFF125C81,
-0xFF0E5A7C,
-0xFF0E5978,
-0xFF145F7E,
-0xFF125C7F,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF115F83,
-0xFF115F83,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF135F83,
-0xFF166085,
-0xFF196388,
-0xFF1F6181,
-0xFF1D4D63,
-0xFFDFFCFF,
-0xFFF8FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFFFFBF9,
-0xFFFEFDFF,
-0xFFEBFFFF,
-0xFF1F4D65,
-0xFF245F81,
-0xFF1A6084,
-0xFF186086,
-0xFF115F83,
-0xFF106287,
-0xFF106488,
-0xFF0E6287,
-0xFF12668B,
-0xFF116389,
-0xFF116389,
-0xFF126188,
-0xFF126188,
-0xFF126188,
-0xFF106287,
-0xFF106287,
-0xFF0F6388,
-0xFF0F6388,
-0xFF0F628A,
-0xFF0F6187,
-0xFF116087,
-0xFF126086,
-0xFF145F86,
-0xFF145F86,
-0xFF135F83,
-0xFF135F83,
-0xFF136185,
-0xFF136185,
-0xFF115F83,
-0xFF105E82,
-0xFF105E82,
-0xFF115F83,
-0xFF0D6082,
-0xFF0A6385,
-0xFF045E81,
-0xFF075C85,
-0xFF0D4E6E,
-0xFFAECAD6,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFEFD,
-0xFFFCFBF9,
-0xFFFFFDFE,
-0xFFFCFFFF,
-0xFFEEFFFF,
-0xFF7499AC,
-0xFF1F5474,
-0xFF1F5F85,
-0xFF195883,
-0xFF175882,
-0xFF0F587B,
-0xFF0D5979,
-0xFF135E7D,
-0xFF115C7B,
-0xFF125C7F,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF125E82,
-0xFF105E82,
-0xFF105E82,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF135F83,
-0xFF135D82,
-0xFF176184,
-0xFF1E678A,
-0xFF195672,
-0xFF5A7F91,
-0xFFF1FFFF,
-0xFFF9FCFF,
-0xFFFFFCFF,
-0xFFFFFDFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFCFDFF,
-0xFFFAFFFB,
-0xFFFFFFFB,
-0xFFFFFBF9,
-0xFFFAFFFF,
-0xFFA4C4D9,
-0xFF1A4F6E,
-0xFF216184,
-0xFF1A6386,
-0xFF166085,
-0xFF115F83,
-0xFF116388,
-0xFF0C6084,
-0xFF0F6388,
-0xFF0D6186,
-0xFF106288,
-0xFF126188,
-0xFF126087,
-0xFF126086,
-0xFF116186,
-0xFF116186,
-0xFF116186,
-0xFF0F6186,
-0xFF0F6187,
-0xFF0E6086,
-0xFF105F86,
-0xFF115F85,
-0xFF135E85,
-0xFF155F86,
-0xFF155F84,
-0xFF155F84,
-0xFF135F83,
-0xFF146084,
-0xFF126084,
-0xFF105E82,
-0xFF105E82,
-0xFF126084,
-0xFF146286,
-0xFF106385,
-0xFF045D7D,
-0xFF005173,
-0xFF0D5375,
-0xFF33617B,
-0xFFF5FFFF,
-0xFFFBFBF9,
-0xFFFAFFFC,
-0xFFF9FFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFDFC,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFF8FFFF,
-0xFFE4FFFF,
-0xFF1B4D66,
-0xFF245F7D,
-0xFF216386,
-0xFF13547E,
-0xFF165983,
-0xFF11577B,
-0xFF125B7C,
-0xFF145F7F,
-0xFF0E5979,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B80,
-0xFF125C81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF155F84,
-0xFF176083,
-0xFF1A6181,
-0xFF1A526B,
-0xFFBFD9E6,
-0xFFF8FFFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFDFEFF,
-0xFFFCFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFF0FEFF,
-0xFF3F6982,
-0xFF1C587A,
-0xFF1E6287,
-0xFF135D82,
-0xFF115D81,
-0xFF126084,
-0xFF0F6186,
-0xFF0E6085,
-0xFF12668A,
-0xFF0E6286,
-0xFF0F6186,
-0xFF116186,
-0xFF115F85,
-0xFF115F85,
-0xFF115F85,
-0xFF106083,
-0xFF106083,
-0xFF0E6085,
-0xFF0E6086,
-0xFF0E6086,
-0xFF105F86,
-0xFF115F85,
-0xFF145E85,
-0xFF155D83,
-0xFF155D83,
-0xFF155F84,
-0xFF135E85,
-0xFF135E85,
-0xFF105E84,
-0xFF0E5E83,
-0xFF106085,
-0xFF126287,
-0xFF126084,
-0xFF0E5E81,
-0xFF005674,
-0xFF0A5773,
-0xFF0A3953,
-0xFFD6F0FF,
-0xFFF8FDFF,
-0xFFFFFEFC,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFCF9,
-0xFFFFFEFD,
-0xFFF8FCFF,
-0xFFF0FFFF,
-0xFF6A97AE,
-0xFF185371,
-0xFF236482,
-0xFF135577,
-0xFF175B82,
-0xFF13577E,
-0xFF15597E,
-0xFF13597D,
-0xFF10597C,
-0xFF0F597C,
-0xFF0F597C,
-0xFF105A7D,
-0xFF105A7D,
-0xFF105A7D,
-0xFF115B80,
-0xFF115B80,
-0xFF125C81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF135D82,
-0xFF145D80,
-0xFF1D6385,
-0xFF1F6080,
-0xFF2C5C73,
-0xFFF0FFFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFAFCFB,
-0xFFF8FFFF,
-0xFFD1E8F6,
-0xFF174A67,
-0xFF1F6086,
-0xFF175F85,
-0xFF146084,
-0xFF146286,
-0xFF0F5D81,
-0xFF106085,
-0xFF116388,
-0xFF0B5D82,
-0xFF0F6186,
-0xFF0F5F84,
-0xFF106085,
-0xFF115F85,
-0xFF126086,
-0xFF126084,
-0xFF126084,
-0xFF115F83,
-0xFF106083,
-0xFF0F6186,
-0xFF116186,
-0xFF126086,
-0xFF146084,
-0xFF145E83,
-0xFF145C82,
-0xFF145C82,
-0xFF145E83,
-0xFF135E85,
-0xFF126086,
-0xFF106085,
-0xFF0F5F84,
-0xFF106085,
-0xFF115F83,
-0xFF0C5A7E,
-0xFF075373,
-0xFF004D68,
-0xFF05435A,
-0xFF7A97A7,
-0xFFF5FFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFBF8,
-0xFFFFFEFA,
-0xFFFFF8F6,
-0xFFFFFCFB,
-0xFFF7FFFF,
-0xFFD2F2FF,
-0xFF144B69,
-0xFF1D6283,
-0xFF1D607D,
-0xFF175A77,
-0xFF125679,
-0xFF13577C,
-0xFF175880,
-0xFF155980,
-0xFF145980,
-0xFF125B7E,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF125C7F,
-0xFF125C7F,
-0xFF145E81,
-0xFF135D80,
-0xFF105A7F,
-0xFF125C81,
-0xFF145E83,
-0xFF105A7F,
-0xFF176083,
-0xFF206284,
-0xFF1B5471,
-0xFF89AFC4,
-0xFFF7FFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFBFCFE,
-0xFFFFFEFD,
-0xFFFBFCFE,
-0xFFF0FFFF,
-0xFF6B90A2,
-0xFF21597A,
-0xFF1D6188,
-0xFF155F86,
-0xFF145F86,
-0xFF126086,
-0xFF126086,
-0xFF116186,
-0xFF106085,
-0xFF106085,
-0xFF106085,
-0xFF106085,
-0xFF115F85,
-0xFF135F83,
-0xFF135F83,
-0xFF135F83,
-0xFF135F83,
-0xFF135F81,
-0xFF126084,
-0xFF0E5E81,
-0xFF106083,
-0xFF126084,
-0xFF135F81,
-0xFF135D80,
-0xFF145E81,
-0xFF135D82,
-0xFF115D81,
-0xFF0E5C82,
-0xFF105F86,
-0xFF105F86,
-0xFF0E5E83,
-0xFF106085,
-0xFF115F83,
-0xFF075174,
-0xFF004765,
-0xFF084861,
-0xFF1E4C5C,
-0xFFF5FFFF,
-0xFFFDFCFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFBF8,
-0xFFFFFCFB,
-0xFFFCFCFE,
-0xFFE9FFFF,
-0xFF447186,
-0xFF1B5C7A,
-0xFF1E6788,
-0xFF155A77,
-0xFF145772,
-0xFF115675,
-0xFF13577A,
-0xFF16577F,
-0xFF165781,
-0xFF13587F,
-0xFF125A80,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF105A7D,
-0xFF115B7E,
-0xFF115B7E,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115B80,
-0xFF125C81,
-0xFF135D82,
-0xFF125B7E,
-0xFF1C6284,
-0xFF23607F,
-0xFF1A4963,
-0xFFE7FFFF,
-0xFFF6FDFF,
-0xFFFEFCFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFCFD,
-0xFFFBFFFF,
-0xFFE9FFFF,
-0xFF1C4C62,
-0xFF216083,
-0xFF1B6089,
-0xFF145E85,
-0xFF135E85,
-0xFF126086,
-0xFF126086,
-0xFF116186,
-0xFF116186,
-0xFF116186,
-0xFF106085,
-0xFF115F85,
-0xFF115F85,
-0xFF135F83,
-0xFF135F83,
-0xFF135F83,
-0xFF135F83,
-0xFF135F81,
-0xFF116081,
-0xFF0F5F82,
-0xFF106083,
-0xFF116081,
-0xFF125E80,
-0xFF135D80,
-0xFF135D80,
-0xFF125E82,
-0xFF0F5D81,
-0xFF126188,
-0xFF0A5980,
-0xFF105F86,
-0xFF0E5C82,
-0xFF0F5B7D,
-0xFF0C5576,
-0xFF004465,
-0xFF084460,
-0xFF043347,
-0xFFE3FFFF,
-0xFFF9FDFF,
-0xFFFFFEFD,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDF9FA,
-0xFFFFFBFC,
-0xFFF8FFFF,
-0xFF94B7CA,
-0xFF174F68,
-0xFF1D6283,
-0xFF176081,
-0xFF105775,
-0xFF115673,
-0xFF135671,
-0xFF155777,
-0xFF15567E,
-0xFF145480,
-0xFF12557F,
-0xFF13587F,
-0xFF13597D,
-0xFF13597B,
-0xFF13597B,
-0xFF13597B,
-0xFF13597D,
-0xFF13597D,
-0xFF13597D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF125B7E,
-0xFF125B7E,
-0xFF125B7E,
-0xFF165C7E,
-0xFF1E6384,
-0xFF1E5573,
-0xFF62859B,
-0xFFEFFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFAFBFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFFFDFF,
-0xFFF7FFFF,
-0xFF92BBCD,
-0xFF17536D,
-0xFF1F6184,
-0xFF196189,
-0xFF125D84,
-0xFF105E84,
-0xFF115F85,
-0xFF115F85,
-0xFF115F83,
-0xFF115F83,
-0xFF115F83,
-0xFF115F83,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF135D80,
-0xFF135D80,
-0xFF135D80,
-0xFF135F81,
-0xFF105F80,
-0xFF0F5F80,
-0xFF0F5E7F,
-0xFF105C7E,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115D81,
-0xFF0F5D81,
-0xFF09587F,
-0xFF136289,
-0xFF126086,
-0xFF0E587B,
-0xFF175C7D,
-0xFF0C4D6B,
-0xFF0C4562,
-0xFF0A384F,
-0xFFBEDAE6,
-0xFFF5FFFF,
-0xFFFEFFFF,
-0xFFFEFDFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFF8,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFDBEEFC,
-0xFF1B4961,
-0xFF226180,
-0xFF226788,
-0xFF105678,
-0xFF115878,
-0xFF125776,
-0xFF155873,
-0xFF175876,
-0xFF15567E,
-0xFF13547E,
-0xFF14557D,
-0xFF13577C,
-0xFF14587B,
-0xFF13597B,
-0xFF13597B,
-0xFF13597B,
-0xFF13597D,
-0xFF13597D,
-0xFF13597D,
-0xFF13597D,
-0xFF12587C,
-0xFF115A7D,
-0xFF10597C,
-0xFF10597C,
-0xFF125B7E,
-0xFF10597C,
-0xFF115A7D,
-0xFF1B5F82,
-0xFF20617F,
-0xFF194B64,
-0xFFC4DEEF,
-0xFFF3FDFF,
-0xFFFCFFFF,
-0xFFFBFDFC,
-0xFFFEFFFF,
-0xFFFAFAFC,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFF1FFFF,
-0xFF33657C,
-0xFF1C5F7C,
-0xFF1F6589,
-0xFF125A82,
-0xFF115C83,
-0xFF105E84,
-0xFF105E84,
-0xFF105E84,
-0xFF105E82,
-0xFF105E82,
-0xFF125E82,
-0xFF125E82,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF115D81,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125E80,
-0xFF0F5E7F,
-0xFF0F5E7F,
-0xFF105C7E,
-0xFF105C7E,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115D81,
-0xFF0E5C80,
-0xFF0F5F84,
-0xFF105E84,
-0xFF105A7D,
-0xFF14597A,
-0xFF104D69,
-0xFF124862,
-0xFF0C3A51,
-0xFF96B7C8,
-0xFFF4FFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFF8,
-0xFFFEFFFA,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFF2FFFF,
-0xFFEDFFFF,
-0xFF33576D,
-0xFF265D7B,
-0xFF266689,
-0xFF165679,
-0xFF115375,
-0xFF13577A,
-0xFF135879,
-0xFF145774,
-0xFF165775,
-0xFF145679,
-0xFF14557B,
-0xFF14557B,
-0xFF15567C,
-0xFF13577A,
-0xFF13577A,
-0xFF13577A,
-0xFF14587B,
-0xFF14587B,
-0xFF14587B,
-0xFF14587B,
-0xFF145A7C,
-0xFF12587A,
-0xFF145A7C,
-0xFF13597D,
-0xFF12587C,
-0xFF13597D,
-0xFF12587C,
-0xFF155B7F,
-0xFF216385,
-0xFF24607C,
-0xFF3A6578,
-0xFFEFFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFBFDFC,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFBFCFE,
-0xFFF8FFFF,
-0xFFC6DFF3,
-0xFF174E6C,
-0xFF1C6284,
-0xFF135C7F,
-0xFF135D82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125C81,
-0xFF125C81,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115D7F,
-0xFF115D7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125E82,
-0xFF115D81,
-0xFF115D7F,
-0xFF135D80,
-0xFF135D80,
-0xFF125C7F,
-0xFF105C80,
-0xFF105C80,
-0xFF126084,
-0xFF135D80,
-0xFF125778,
-0xFF1A5672,
-0xFF1B4B62,
-0xFF13394E,
-0xFF97B6C8,
-0xFFF1FFFF,
-0xFFFAFFFF,
-0xFFFAFAFA,
-0xFFFDFFFC,
-0xFFFDFFFC,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFF4FFFF,
-0xFFE9FFFF,
-0xFF567F95,
-0xFF225874,
-0xFF1F5B7D,
-0xFF1D5D81,
-0xFF165578,
-0xFF155477,
-0xFF14557B,
-0xFF12567B,
-0xFF135577,
-0xFF135577,
-0xFF145678,
-0xFF145678,
-0xFF16567A,
-0xFF16567C,
-0xFF15577A,
-0xFF13577A,
-0xFF13577A,
-0xFF13577A,
-0xFF13577A,
-0xFF14587B,
-0xFF14587B,
-0xFF14587B,
-0xFF13597B,
-0xFF155B7D,
-0xFF145A7E,
-0xFF13597D,
-0xFF12587C,
-0xFF13597D,
-0xFF185E82,
-0xFF236484,
-0xFF1B516B,
-0xFF8BB0C2,
-0xFFF5FFFF,
-0xFFFCFDFF,
-0xFFFBFBFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFDF9,
-0xFFFEFFFF,
-0xFFF4FFFF,
-0xFF66869F,
-0xFF215C7C,
-0xFF1D6689,
-0xFF145E81,
-0xFF125E80,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF125E82,
-0xFF135D82,
-0xFF125C81,
-0xFF125C81,
-0xFF125C81,
-0xFF135D80,
-0xFF125C7F,
-0xFF115D7F,
-0xFF115D7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115D81,
-0xFF115D81,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115B7E,
-0xFF105A7D,
-0xFF105A7F,
-0xFF105C7E,
-0xFF0D577A,
-0xFF135A7A,
-0xFF1C5C78,
-0xFF1F536B,
-0xFF173D50,
-0xFF9CB8C6,
-0xFFF2FFFF,
-0xFFF4FDFF,
-0xFFFFFFFF,
-0xFFFFFEFC,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFCFBFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFF8FFFF,
-0xFFF0FFFF,
-0xFF688DA0,
-0xFF18516E,
-0xFF1C5E80,
-0xFF226085,
-0xFF155176,
-0xFF175176,
-0xFF175377,
-0xFF14547A,
-0xFF12537B,
-0xFF10547B,
-0xFF105479,
-0xFF135673,
-0xFF155674,
-0xFF155578,
-0xFF155579,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF15577A,
-0xFF15577A,
-0xFF13577A,
-0xFF13577A,
-0xFF14587B,
-0xFF14587B,
-0xFF15597C,
-0xFF14587B,
-0xFF13577A,
-0xFF165A7D,
-0xFF1A6082,
-0xFF205F7E,
-0xFF1F4D67,
-0xFFE9FFFF,
-0xFFF8FFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFDFB,
-0xFFFFFFFB,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFF8,
-0xFFFEFFF8,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFCFFFF,
-0xFFEDFFFF,
-0xFF1D455F,
-0xFF235F83,
-0xFF1B6389,
-0xFF0E5A7C,
-0xFF125E80,
-0xFF115D81,
-0xFF115D81,
-0xFF125C81,
-0xFF125C81,
-0xFF135B81,
-0xFF135B81,
-0xFF135C7F,
-0xFF135C7F,
-0xFF125C7F,
-0xFF125C7F,
-0xFF115D7F,
-0xFF105C7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B80,
-0xFF105A7F,
-0xFF115A7D,
-0xFF115A7D,
-0xFF10597C,
-0xFF0F597C,
-0xFF115B7E,
-0xFF145E81,
-0xFF1A6384,
-0xFF1D5F7F,
-0xFF19526D,
-0xFF164559,
-0xFFBBD8E8,
-0xFFF2FFFF,
-0xFFF8FDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFF9,
-0xFFF8F9F1,
-0xFFFFFFFA,
-0xFFFBFBF9,
-0xFFFEFFFF,
-0xFFFEFDFF,
-0xFFFFFEFB,
-0xFFFFFEF8,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF1FFFF,
-0xFF7B9CAB,
-0xFF1C4C63,
-0xFF206282,
-0xFF1E678A,
-0xFF135377,
-0xFF165276,
-0xFF185277,
-0xFF155175,
-0xFF145277,
-0xFF13547A,
-0xFF11557C,
-0xFF11557A,
-0xFF135673,
-0xFF145571,
-0xFF145575,
-0xFF135578,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF145679,
-0xFF125679,
-0xFF13577A,
-0xFF125679,
-0xFF14587B,
-0xFF14587B,
-0xFF125679,
-0xFF175B7E,
-0xFF1B5F82,
-0xFF205B79,
-0xFF65899F,
-0xFFEFFFFF,
-0xFFF7FFFF,
-0xFFFEFFFA,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFA,
-0xFFFEFFFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFF7FFFF,
-0xFF95B4C8,
-0xFF225371,
-0xFF216185,
-0xFF115B80,
-0xFF125E7E,
-0xFF105C7C,
-0xFF105A7D,
-0xFF105A7D,
-0xFF115B80,
-0xFF125A80,
-0xFF125A80,
-0xFF125A80,
-0xFF125B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF115B7E,
-0xFF0F5B7D,
-0xFF0F5B7D,
-0xFF105A7D,
-0xFF105A7D,
-0xFF105A7D,
-0xFF105A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF125B7E,
-0xFF165F80,
-0xFF1D6283,
-0xFF20617F,
-0xFF1B546F,
-0xFF2F5C71,
-0xFFD6F7FF,
-0xFFEFFFFF,
-0xFFF8FFFF,
-0xFFFDFDFD,
-0xFFFFFFFD,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFFFFFA,
-0xFFFFFEF8,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEF9,
-0xFFFFFFFA,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFDFDFB,
-0xFFFEFDFB,
-0xFFFFFFFF,
-0xFFF7FEFF,
-0xFFF3FFFF,
-0xFFEDFFFF,
-0xFF698C9F,
-0xFF1B4D66,
-0xFF225F7C,
-0xFF206282,
-0xFF135879,
-0xFF115174,
-0xFF145374,
-0xFF145374,
-0xFF135273,
-0xFF145477,
-0xFF145477,
-0xFF135577,
-0xFF125476,
-0xFF125474,
-0xFF125572,
-0xFF135575,
-0xFF135577,
-0xFF145679,
-0xFF12567B,
-0xFF145679,
-0xFF145679,
-0xFF155578,
-0xFF165679,
-0xFF165679,
-0xFF155779,
-0xFF16587A,
-0xFF145678,
-0xFF14587B,
-0xFF13577A,
-0xFF115578,
-0xFF1D6184,
-0xFF1F6386,
-0xFF154B67,
-0xFFCFE7F3,
-0xFFF5FDFF,
-0xFFFEFFFF,
-0xFFFCFCFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFCFFFD,
-0xFFF6FFFF,
-0xFFEAFFFF,
-0xFF336178,
-0xFF24617E,
-0xFF1C6586,
-0xFF0D597B,
-0xFF0F5C7A,
-0xFF0F5A77,
-0xFF115A7B,
-0xFF13597B,
-0xFF13597D,
-0xFF115A7D,
-0xFF115A7D,
-0xFF105A7D,
-0xFF105A7F,
-0xFF0F5B7F,
-0xFF0F5B7F,
-0xFF105C80,
-0xFF105C7E,
-0xFF0E5A7C,
-0xFF0F5A7A,
-0xFF0F5A7A,
-0xFF105B7B,
-0xFF10597A,
-0xFF12587A,
-0xFF145A7E,
-0xFF145A7E,
-0xFF0F577D,
-0xFF166085,
-0xFF1D6689,
-0xFF1B607F,
-0xFF215E7A,
-0xFF174960,
-0xFF6B91A4,
-0xFFEBFFFF,
-0xFFEDFEFF,
-0xFFF9FFFF,
-0xFFFCFFFD,
-0xFFFDFFF9,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFEF9,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFA,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFF9FEFF,
-0xFFF4FFFF,
-0xFFE9FFFF,
-0xFF597F96,
-0xFF20526D,
-0xFF266382,
-0xFF1E6080,
-0xFF175979,
-0xFF115373,
-0xFF125373,
-0xFF125373,
-0xFF135474,
-0xFF165777,
-0xFF135474,
-0xFF135474,
-0xFF135474,
-0xFF135474,
-0xFF125474,
-0xFF135575,
-0xFF135575,
-0xFF135577,
-0xFF125679,
-0xFF12567B,
-0xFF145679,
-0xFF145678,
-0xFF155578,
-0xFF165777,
-0xFF165777,
-0xFF155779,
-0xFF135577,
-0xFF165A7D,
-0xFF13577A,
-0xFF16587B,
-0xFF145678,
-0xFF216184,
-0xFF1D5C7D,
-0xFF3A6880,
-0xFFEFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFCFFFF,
-0xFFF2FFFF,
-0xFFC0E1F0,
-0xFF184B66,
-0xFF1D5D80,
-0xFF176186,
-0xFF0C587C,
-0xFF156080,
-0xFF115878,
-0xFF115779,
-0xFF125679,
-0xFF12587A,
-0xFF12587A,
-0xFF10597C,
-0xFF0F597C,
-0xFF0E587D,
-0xFF0E587D,
-0xFF115B80,
-0xFF0F597C,
-0xFF0E587B,
-0xFF105B7B,
-0xFF135C7D,
-0xFF135C7D,
-0xFF115A7B,
-0xFF13597B,
-0xFF165A7D,
-0xFF115578,
-0xFF1A5E81,
-0xFF1C6083,
-0xFF1F6181,
-0xFF1D5D79,
-0xFF1A506A,
-0xFF305D72,
-0xFFC2E1F3,
-0xFFECFFFF,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFDFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFCF9,
-0xFFFFFDF9,
-0xFFFEFDF9,
-0xFFFAFEFF,
-0xFFF2FFFF,
-0xFFDEF9FF,
-0xFF365E78,
-0xFF1B5072,
-0xFF246084,
-0xFF216184,
-0xFF155779,
-0xFF0F4F72,
-0xFF115174,
-0xFF135376,
-0xFF125275,
-0xFF145376,
-0xFF145376,
-0xFF145376,
-0xFF145376,
-0xFF135376,
-0xFF135376,
-0xFF135376,
-0xFF145477,
-0xFF135577,
-0xFF135577,
-0xFF105477,
-0xFF105477,
-0xFF125476,
-0xFF125474,
-0xFF135474,
-0xFF145575,
-0xFF135575,
-0xFF135577,
-0xFF14587D,
-0xFF12567B,
-0xFF0F5378,
-0xFF18587C,
-0xFF1A5678,
-0xFF255E7C,
-0xFF255875,
-0xFF96BBCE,
-0xFFF5FFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFF2FFFF,
-0xFF5F7E92,
-0xFF245575,
-0xFF25638A,
-0xFF135882,
-0xFF115882,
-0xFF13577E,
-0xFF14587D,
-0xFF15597C,
-0xFF145A7C,
-0xFF145A7C,
-0xFF145A7C,
-0xFF145A7E,
-0xFF125B7E,
-0xFF125B7E,
-0xFF125B7E,
-0xFF10597C,
-0xFF125B7E,
-0xFF155B7F,
-0xFF145A7C,
-0xFF125679,
-0xFF145678,
-0xFF16587A,
-0xFF175C7D,
-0xFF185C7F,
-0xFF25698C,
-0xFF1C5E7E,
-0xFF225F7B,
-0xFF1F5369,
-0xFF30596B,
-0xFF98B3C4,
-0xFFF2FFFF,
-0xFFF8FFFF,
-0xFFFEFEFF,
-0xFFFBFAFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFDFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFCFB,
-0xFFFFFFFF,
-0xFFF8FFFF,
-0xFFF1FFFF,
-0xFF9DBDCC,
-0xFF214E65,
-0xFF215876,
-0xFF215F84,
-0xFF206189,
-0xFF0F5174,
-0xFF0B4D6F,
-0xFF0E4E72,
-0xFF105073,
-0xFF0F4F73,
-0xFF115174,
-0xFF135176,
-0xFF0F4E71,
-0xFF125075,
-0xFF125174,
-0xFF115175,
-0xFF105073,
-0xFF105074,
-0xFF105073,
-0xFF0F5174,
-0xFF0F5174,
-0xFF0F5579,
-0xFF0F5577,
-0xFF105576,
-0xFF125474,
-0xFF135474,
-0xFF145575,
-0xFF135577,
-0xFF115578,
-0xFF0E537A,
-0xFF0E537A,
-0xFF14587F,
-0xFF1A587D,
-0xFF296182,
-0xFF30627D,
-0xFF19435B,
-0xFFE8FFFF,
-0xFFF6FFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFEEFFFF,
-0xFF26465B,
-0xFF2D5E7F,
-0xFF1F5D84,
-0xFF135882,
-0xFF0D547E,
-0xFF185C83,
-0xFF16587B,
-0xFF14587B,
-0xFF13597B,
-0xFF13597B,
-0xFF13597B,
-0xFF13597D,
-0xFF13597D,
-0xFF13597D,
-0xFF14587D,
-0xFF14587D,
-0xFF165A7D,
-0xFF195B7E,
-0xFF1B5B7E,
-0xFF1F5E81,
-0xFF236283,
-0xFF246384,
-0xFF256183,
-0xFF246082,
-0xFF1D5674,
-0xFF1B4E69,
-0xFF2F5C71,
-0xFF95B6C5,
-0xFFEEFFFF,
-0xFFF5FFFF,
-0xFFFCFDFF,
-0xFFFFFDFF,
-0xFFFDF7F9,
-0xFFFFFDFF,
-0xFFFCFAFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFFDFCFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFDF9,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFF1FFFF,
-0xFFD0EDFB,
-0xFF3F6C7F,
-0xFF195168,
-0xFF1A5B77,
-0xFF206584,
-0xFF1E6384,
-0xFF1C6083,
-0xFF206285,
-0xFF226286,
-0xFF24648A,
-0xFF236387,
-0xFF1F5F85,
-0xFF226286,
-0xFF25658B,
-0xFF226286,
-0xFF236389,
-0xFF236387,
-0xFF226288,
-0xFF226286,
-0xFF226288,
-0xFF226286,
-0xFF226288,
-0xFF216288,
-0xFF1C6286,
-0xFF1C6284,
-0xFF1D6283,
-0xFF1F6181,
-0xFF206181,
-0xFF206083,
-0xFF206285,
-0xFF1E6289,
-0xFF1B628C,
-0xFF1B628C,
-0xFF20638D,
-0xFF1F5D82,
-0xFF2A5F7F,
-0xFF19455E,
-0xFF95B8CC,
-0xFFEDFFFF,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFABC3CD,
-0xFF22485B,
-0xFF275F7A,
-0xFF1D5F81,
-0xFF1C6588,
-0xFF1B6588,
-0xFF1C6383,
-0xFF1E6382,
-0xFF1D6184,
-0xFF1D6186,
-0xFF1D6186,
-0xFF1D6186,
-0xFF1D6186,
-0xFF1D6186,
-0xFF1D6186,
-0xFF1F6086,
-0xFF216185,
-0xFF206084,
-0xFF205E83,
-0xFF246084,
-0xFF245E83,
-0xFF21597C,
-0xFF1A5275,
-0xFF1A4C6D,
-0xFF24506B,
-0xFF5E829A,
-0xFFBDD8EB,
-0xFFF0FFFF,
-0xFFF2FFFF,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFF9F9F7,
-0xFFFFFFFD,
-0xFFFFFDFE,
-0xFFFEFCFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFAFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFDFEFF,
-0xFFE2EBF2,
-0xFF5C6F7E,
-0xFF1D3E51,
-0xFF215168,
-0xFF1F5971,
-0xFF1D5B74,
-0xFF1B5972,
-0xFF1B556D,
-0xFF205670,
-0xFF215675,
-0xFF1F5473,
-0xFF1F5473,
-0xFF1F5473,
-0xFF1D5271,
-0xFF1E5372,
-0xFF1F5473,
-0xFF1F5473,
-0xFF1E5372,
-0xFF1E5372,
-0xFF1E5372,
-0xFF1E5372,
-0xFF1E5372,
-0xFF1E5372,
-0xFF1F5473,
-0xFF1E5573,
-0xFF1D5673,
-0xFF1D5673,
-0xFF1E5671,
-0xFF1F556F,
-0xFF21546F,
-0xFF1F5571,
-0xFF1E5574,
-0xFF1D5576,
-0xFF1B5779,
-0xFF175274,
-0xFF1D5375,
-0xFF20516F,
-0xFF1D455E,
-0xFF8DACBE,
-0xFFEDFFFF,
-0xFFF3FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFFDEF2FB,
-0xFF204150,
-0xFF28566D,
-0xFF215974,
-0xFF195472,
-0xFF185571,
-0xFF215B73,
-0xFF1A5269,
-0xFF1E5671,
-0xFF1E5774,
-0xFF1F5674,
-0xFF1F5674,
-0xFF1F5674,
-0xFF1F5674,
-0xFF205574,
-0xFF1F5473,
-0xFF1F5271,
-0xFF1F506E,
-0xFF204F6B,
-0xFF214E6B,
-0xFF24506B,
-0xFF406985,
-0xFF78A2BB,
-0xFFB0D4EC,
-0xFFEAFFFF,
-0xFFEFFFFF,
-0xFFF2FCFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFB,
-0xFFFDFEF9,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFCFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFEFD,
-0xFFFFFDFA,
-0xFFFFFEFA,
-0xFFFFFEFA,
-0xFFFFFFFF,
-0xFFFAFDFF,
-0xFFDBE2EC,
-0xFF7D8A9A,
-0xFF8CA1B4,
-0xFF7B97AC,
-0xFF81A1B6,
-0xFF7D9EB1,
-0xFF7F9EB0,
-0xFF859FAE,
-0xFF869DAD,
-0xFF839FAD,
-0xFF829FAF,
-0xFF819EAE,
-0xFF83A0B0,
-0xFF84A1B1,
-0xFF83A0B0,
-0xFF819EAE,
-0xFF829FAF,
-0xFF829FAF,
-0xFF829FAF,
-0xFF829FAF,
-0xFF829FAF,
-0xFF829FAF,
-0xFF83A0B0,
-0xFF83A0B0,
-0xFF81A1B0,
-0xFF7FA0AF,
-0xFF7FA1AD,
-0xFF80A0AD,
-0xFF82A0AB,
-0xFF82A0AB,
-0xFF80A0AD,
-0xFF7FA0B1,
-0xFF7DA0B3,
-0xFF7DA0B4,
-0xFF7DA0B3,
-0xFF81A0B2,
-0xFF97B1BE,
-0xFFE6F7FF,
-0xFFF8FFFF,
-0xFFFBFDFC,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFDFDFD,
-0xFFFDFDFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF8FFFF,
-0xFFCDDDEA,
-0xFF7892A3,
-0xFF7F9EB3,
-0xFF83A3B8,
-0xFF7E9DB1,
-0xFF809BAC,
-0xFF87A3B1,
-0xFF80A0AD,
-0xFF7FA0AF,
-0xFF80A0AF,
-0xFF80A0AF,
-0xFF80A0AF,
-0xFF80A0AF,
-0xFF829FAF,
-0xFF839FAD,
-0xFF92AEBC,
-0xFF9EB8C5,
-0xFFBAD2DE,
-0xFFDCF2FF,
-0xFFF0FFFF,
-0xFFF1FFFF,
-0xFFF0FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFCFC,
-0xFFFFFCFC,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF3F9F9,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFBF8,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFA,
-0xFFFDFCF8,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFF9FBFA,
-0xFFFCFFFF,
-0xFFF7FEFF,
-0xFFF8FFFF,
-0xFFF0FCFF,
-0xFFF4FFFF,
-0xFFF1FFFF,
-0xFFF4FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF2FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF2FFFF,
-0xFFF1FFFF,
-0xFFF0FFFF,
-0xFFF1FFFF,
-0xFFF5FFFF,
-0xFFF5FEFF,
-0xFFFCFFFF,
-0xFFFFFEFA,
-0xFFFFFEF8,
-0xFFFFFCF6,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFEFF,
-0xFFFAFEFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF0FEFF,
-0xFFF5FFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFDFFFA,
-0xFFFFFFFB,
-0xFFFEFDF9,
-0xFFFFFCF9,
-0xFFFFFDFD,
-0xFFFFFBFD,
-0xFFFFFEFF,
-0xFFFCFDFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF6FFFD,
-0xFFFBFFFD,
-0xFFFCFEFB,
-0xFFFEFDF9,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFD,
-0xFFF9FFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFBFFFD,
-0xFFFBFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFEFFFA,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFCFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFD,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFCFD,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFDFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFCFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFEFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFF8,
-0xFFFFFFF8,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFBFFFB,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFA,
-0xFFFEFFFA,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFCFFF6,
-0xFFFCFFF6,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFB,
-0xFFFFFEFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFD,
-0xFFFCFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFCFFF8,
-0xFFFCFFF8,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFF8,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFEFFF8,
-0xFFFCFFFA,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFAFF,
-0xFFFFFBFF,
-0xFFFFFDFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFA,
-0xFFFFFFF8,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFCFD,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFFFEFA,
-0xFFFFFFFB,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFA,
-0xFFFEFDF9,
-0xFFFFFEF8,
-0xFFFFFDF7,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFA,
-0xFFFFFEF8,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFDFE,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFDFCFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFDFFFC,
-0xFFFCFEFD,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFBFCF7,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFBFC,
-0xFFFEFFFF,
-0xFFFAFBFF,
-0xFFFDFDFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFFFFFFB,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFBF9,
-0xFFFFFEFC,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFEFEFC,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFEFEFE,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFA,
-0xFFFFFEF8,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFDFDFB,
-0xFFFDFFFE,
-0xFFFCFFFF,
-0xFFFCFEFF,
-0xFFFCFCFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFEFFF8,
-0xFFFCFFFA,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFC,
-0xFFFBFDFC,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFCFF,
-0xFFFFFDFE,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFBFFFF,
-0xFFFAFDFF,
-0xFFFCFFFF,
-0xFFF8FBFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFF8FB,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFAFBFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFF5FDFF,
-0xFFF7FEFF,
-0xFFFAFFFF,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFAFAF8,
-0xFFFFFFFD,
-0xFFF8FFFF,
-0xFFEEFFFF,
-0xFFEAFFFF,
-0xFFEBFFFF,
-0xFFF1FFFF,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFDFDFF,
-0xFFFFFDFE,
-0xFFFFFEF8,
-0xFFFFFEF9,
-0xFFF9FFFF,
-0xFFF2FCFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFFEFFFB,
-0xFFFFFFF8,
-0xFFFCFFFA,
-0xFFFCFFFB,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFDF9,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF6FDFF,
-0xFFF7FCFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFDFEF8,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFAFD,
-0xFFFFFDFF,
-0xFFF9FDFE,
-0xFFF8FFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFDFF3FE,
-0xFFDAF6FF,
-0xFFD9F8FF,
-0xFFDDFFFF,
-0xFFD2F7FF,
-0xFFDEFDFF,
-0xFFF5FFFF,
-0xFFFFFFFA,
-0xFFFBFBFB,
-0xFFFFFEFF,
-0xFFFDFCFA,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFF1FFFF,
-0xFFB4D8EE,
-0xFF6695B1,
-0xFF6A94AD,
-0xFFD7F8FF,
-0xFFF2FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFEDFFFF,
-0xFFDAFFFF,
-0xFFBAE3F9,
-0xFFA9C6D6,
-0xFFF2FFFF,
-0xFFFCFFFD,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFF9FFFD,
-0xFFF9FFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFA,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFD2D9E3,
-0xFFD3DAEC,
-0xFFD6DEEB,
-0xFFFBFFFF,
-0xFFFAFCFB,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFEFCFD,
-0xFFFFFFFA,
-0xFFFCFFFF,
-0xFFD1D4E3,
-0xFFD3D5EA,
-0xFFDCDFF2,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFBFEF7,
-0xFFFBFFFD,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFEDFFFF,
-0xFF63A2C5,
-0xFF4093BD,
-0xFF4195C3,
-0xFF3B93C1,
-0xFF3897C5,
-0xFF4C93B1,
-0xFFEFFFFF,
-0xFFFFFFF3,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFCFB,
-0xFFF8FCFD,
-0xFFF0FFFF,
-0xFFA8D9F9,
-0xFF5393B9,
-0xFF518BB0,
-0xFFCDFBFF,
-0xFFEEFFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFDFF,
-0xFFECFDFF,
-0xFFD5FFFF,
-0xFF66B5D3,
-0xFF3092B9,
-0xFF3C98BF,
-0xFF5A96B2,
-0xFFE6FFFF,
-0xFFF9FFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFDFEFF,
-0xFFF2F9FF,
-0xFF000215,
-0xFF000621,
-0xFF192138,
-0xFFF2F9FF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFCFF,
-0xFFFFFFFF,
-0xFFF9FCF5,
-0xFFFCFFFF,
-0xFF00051B,
-0xFF000221,
-0xFF383C57,
-0xFFF8FBFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFA,
-0xFFFCFFF8,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFAFDFF,
-0xFFECFFFF,
-0xFF64A4C7,
-0xFF3E97C3,
-0xFF3D9DD0,
-0xFF38A1D8,
-0xFF36ABE1,
-0xFF4AA6CD,
-0xFFEBFFFF,
-0xFFFFFFF4,
-0xFFFCFDF8,
-0xFFFEFFFF,
-0xFFFFFDFE,
-0xFFFEFEFE,
-0xFFFCFFFF,
-0xFFF0FFFF,
-0xFFA2D4F5,
-0xFF5394BC,
-0xFF5492B7,
-0xFFC9F8FF,
-0xFFEEFFFF,
-0xFFF9FFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFDFFFFF,
-0xFF4A99BA,
-0xFF3CA3CC,
-0xFF39A4D0,
-0xFF3995BC,
-0xFF629AB3,
-0xFFE6FFFF,
-0xFFF8FFFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFF07112C,
-0xFF0A1438,
-0xFF242D4C,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFDFDFF,
-0xFFFEFFFB,
-0xFFFBFFFF,
-0xFF010423,
-0xFF0B0F35,
-0xFF454869,
-0xFFFBFDFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFDF9,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFDFF,
-0xFFF5FEFF,
-0xFFC5E3EE,
-0xFFB1E0F4,
-0xFFADECFF,
-0xFF5EB1DB,
-0xFF36A4D9,
-0xFF439ECA,
-0xFFE5FFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFAFBFF,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFDFFFC,
-0xFFEFFEFF,
-0xFFAAD4ED,
-0xFF4E84A6,
-0xFF5283A3,
-0xFFD3F7FF,
-0xFFF7FFFF,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFF8FFFF,
-0xFFE6FFFF,
-0xFF78ADCF,
-0xFF439ECA,
-0xFF3897C3,
-0xFF75B6D6,
-0xFFDEFFFF,
-0xFFEFFFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFF9FCFF,
-0xFFF3F9FF,
-0xFF0A1236,
-0xFF0A1240,
-0xFF262E55,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFCFF,
-0xFFFEFFFF,
-0xFFFCFFFB,
-0xFFF4FBFF,
-0xFF05092E,
-0xFF0B0F3E,
-0xFF464A70,
-0xFFF8FCFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFAFB,
-0xFFFFFEFF,
-0xFFFDFCFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFEEFFFF,
-0xFFDBFFFF,
-0xFF6EB4D8,
-0xFF39A1D4,
-0xFF49A4D1,
-0xFFE7FFFF,
-0xFFFCFDFF,
-0xFFFCFBFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FEFF,
-0xFFFFFFFD,
-0xFFF7FFFF,
-0xFFE0FFFF,
-0xFFD4FAFF,
-0xFFD5F5FF,
-0xFFECFFFF,
-0xFFFBFFFF,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFF5FFFF,
-0xFFD6FFFF,
-0xFF468BB4,
-0xFF429FCB,
-0xFF69BBE1,
-0xFFE3FFFF,
-0xFFF6FFFF,
-0xFFFFFFFD,
-0xFFFCFBF7,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFF8FEFF,
-0xFF030D31,
-0xFF0B1546,
-0xFF232C55,
-0xFFF9FEFF,
-0xFFFBFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFE,
-0xFFF9FEFA,
-0xFFFBFFFF,
-0xFF00042C,
-0xFF0B0F3F,
-0xFF474B70,
-0xFFF9FEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFF4FFFF,
-0xFFE3FFFF,
-0xFF70B2D2,
-0xFF3CA0D2,
-0xFF4BA2CF,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFBFC,
-0xFFFCFFFF,
-0xFFF2FFFF,
-0xFFEFFFFF,
-0xFFF7FFFF,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFDFC,
-0xFFF3FFFF,
-0xFFABE2FF,
-0xFF4796BD,
-0xFF4195B9,
-0xFFB6F8FF,
-0xFFEDFFFF,
-0xFFFCFBFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFDFDFF,
-0xFFFBFEFF,
-0xFFFEFFFF,
-0xFFFFFBFA,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFBF8,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFAFF,
-0xFFFFFCFF,
-0xFFFBFFFD,
-0xFFF8FFFC,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFCFCFE,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFF9FCF5,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFCFA,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFBFDFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFDFBFE,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FDFE,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFEFDFB,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFF8FEFE,
-0xFFFCFEFB,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFEFBFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFCFEFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFBFA,
-0xFFFFFFFD,
-0xFFFDFDFB,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFEFEFC,
-0xFFFEFEFF,
-0xFFFEFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFDFA,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFBFDFA,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFEFD,
-0xFFFFFCFC,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFEFF,
-0xFFFFFEFB,
-0xFFFEFDF9,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFBFFFE,
-0xFFFBFFFC,
-0xFFFBFFFE,
-0xFFFEFFFF,
-0xFFFEFBFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFDFA,
-0xFFFFFFFB,
-0xFFFBFDFC,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFEFCFF,
-0xFFFCFFFD,
-0xFFFBFFFB,
-0xFFFBFBFB,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFBFCFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFCFDFF,
-0xFFFCFFFF,
-0xFFFDFFF7,
-0xFFFFFFF8,
-0xFFFDFBFC,
-0xFFFEFDFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFE,
-0xFFFFFDFC,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFCFE,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFAFCFB,
-0xFFFCFFFD,
-0xFFFCFFFA,
-0xFFFDFFF9,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFAFEFD,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFEFFFA,
-0xFFFFFFFA,
-0xFFFCFDF8,
-0xFFFEFFFA,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFC,
-0xFFFEFFFF,
-0xFFF8FEFF,
-0xFF040E31,
-0xFF051342,
-0xFF26325A,
-0xFFF9FFFF,
-0xFFFDFEFF,
-0xFFFFFFFD,
-0xFFFDFCF8,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFDFFFE,
-0xFFFEFFFD,
-0xFFFCFAFB,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFDFE,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFCFDF7,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFDFDFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFBFFFA,
-0xFFFCFFFB,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFFFDFE,
-0xFFFEFEF6,
-0xFFFFFFFA,
-0xFFFEFFFF,
-0xFFFBFCFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFDFF,
-0xFFF8FBFF,
-0xFF010630,
-0xFF0D1442,
-0xFF434866,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFF7FFFF,
-0xFFF1FFFF,
-0xFFECFFFF,
-0xFFEDFFFF,
-0xFFF2FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFCFDFF,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFE4FFFF,
-0xFF97DFFF,
-0xFF459EC8,
-0xFF4597BC,
-0xFFC6FFFF,
-0xFFE3FFFF,
-0xFFF3FFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFFFF,
-0xFFFCFEFB,
-0xFFFFFEFC,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FCFF,
-0xFFF9FFFF,
-0xFFF4FFFF,
-0xFFEFFFFF,
-0xFFF4FFFF,
-0xFFF1FFFF,
-0xFFF0FFFF,
-0xFFF0FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFFBFDF8,
-0xFFFFFFFA,
-0xFFFEFCFD,
-0xFFFFFAFF,
-0xFFFFF8FF,
-0xFFFFFDFF,
-0xFFFCFFFD,
-0xFFF9FFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF8FAFF,
-0xFFFBFCFF,
-0xFFFBFCFF,
-0xFFFCFDFF,
-0xFFFCFEFF,
-0xFFF9FCFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFAFEFF,
-0xFFFCFCFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFAFB,
-0xFFFEFFFF,
-0xFFFBFEFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFBFC,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFDFDFB,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFEFF,
-0xFFF8FDF9,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFC,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFAFCF9,
-0xFFFBFDFA,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFBFDFF,
-0xFFF9FAFF,
-0xFFFCFDFF,
-0xFFFBFCFF,
-0xFFFEFDFF,
-0xFFFBFBFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFF6F9FF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFF9FF,
-0xFFFFFDFF,
-0xFFFCFFFF,
-0xFFFCFCFE,
-0xFFFFFFFF,
-0xFFF8FBFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF6FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFCFEFF,
-0xFFFCFCFF,
-0xFFFDFEFF,
-0xFFFAFEFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFAFAFF,
-0xFFFFFEFF,
-0xFFFAFDFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF8F5FF,
-0xFFFFFDFF,
-0xFFF4FCFF,
-0xFFF6FFFC,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFBFCF7,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFDFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFB,
-0xFFFBFFFC,
-0xFFFEFEFF,
-0xFFFCFEFF,
-0xFFF7FFFF,
-0xFFF2FCFF,
-0xFFFCFEFF,
-0xFFFEFEFF,
-0xFFFAFEFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFDFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFEFFFD,
-0xFFF6FBF7,
-0xFFFBFFFC,
-0xFFFCFFFF,
-0xFFFCFCFF,
-0xFFFEFEFF,
-0xFFFAFBFF,
-0xFFFCFFFF,
-0xFFF8FBFF,
-0xFFFBFFFF,
-0xFFF7FDFF,
-0xFFF9FFFF,
-0xFFF8FCFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFBF9FF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFB,
-0xFFFEFFFA,
-0xFFFFFEFA,
-0xFFFFFEFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFBFDFF,
-0xFFF6FDFF,
-0xFF010F34,
-0xFF061846,
-0xFF202F58,
-0xFFF4FAFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFAFF,
-0xFFFEFBFF,
-0xFFFBFFFC,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFDFF,
-0xFFF9FDFF,
-0xFFFAFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF7FDFF,
-0xFFF9FDFF,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFBFDFC,
-0xFFFEFFFF,
-0xFFFCFEFB,
-0xFFFEFFFD,
-0xFFFDFDFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFF8FDFF,
-0xFFF6FCFF,
-0xFFFBFFFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFEFF,
-0xFF000833,
-0xFF050D3B,
-0xFF444B67,
-0xFFFCFEFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF1FFFF,
-0xFFBCE6F4,
-0xFFB2E9FE,
-0xFFB0E8FF,
-0xFFB1E9FF,
-0xFFB5E4FE,
-0xFFC4E9FB,
-0xFFF2FFFF,
-0xFFF9FFFF,
-0xFFFEFFFD,
-0xFFFAFEFF,
-0xFFF7FFFF,
-0xFFD5EFFC,
-0xFFB3E5FE,
-0xFFA7F0FF,
-0xFF71C9F7,
-0xFF3B9BCD,
-0xFF3B97C6,
-0xFF98ECFF,
-0xFFADF5FF,
-0xFFB3E4F5,
-0xFFEAFCFF,
-0xFFFBFEFF,
-0xFFFCFEFB,
-0xFFFDFEF8,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFF6FBF7,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFEFFFFF,
-0xFFE2FFFF,
-0xFFD4FFFF,
-0xFFB3EBFF,
-0xFFAEE6FF,
-0xFFBEF2FF,
-0xFFDAFFFF,
-0xFFE3FFFF,
-0xFFE9FFFF,
-0xFFF7FFFF,
-0xFFFBFFF8,
-0xFFF8FFFA,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFAFC,
-0xFFFCFAFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFCFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFD0DBEF,
-0xFF737DA1,
-0xFF333E6B,
-0xFF131D4E,
-0xFF192150,
-0xFF222A51,
-0xFF606688,
-0xFFB2B7D5,
-0xFFF9FEFF,
-0xFFF9FDFF,
-0xFFFBFFFF,
-0xFFD8DEEA,
-0xFFB0B6C6,
-0xFFABAFBB,
-0xFFE9ECF3,
-0xFFFFFFFF,
-0xFFFDFDFB,
-0xFFFFFFFF,
-0xFFFAFDFF,
-0xFFD7DBE7,
-0xFFABB1BF,
-0xFFAFAEBC,
-0xFFF6F5FD,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFBFFFF,
-0xFFF9FDFE,
-0xFFFEFFFD,
-0xFFFEFEFC,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFFCFFFF,
-0xFFE5EAEE,
-0xFFA9AFBB,
-0xFFAEB1C4,
-0xFFE4E5F7,
-0xFFFBF9FF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFAFCF9,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFF9FDFF,
-0xFFF9FEFF,
-0xFF9399B9,
-0xFF474F76,
-0xFF18214C,
-0xFF121E46,
-0xFF212E51,
-0xFF586182,
-0xFFB1B8D2,
-0xFFF8FFFF,
-0xFFFAFDFF,
-0xFFFCFEFF,
-0xFFD9DBE8,
-0xFFB5B4C6,
-0xFFADAFBE,
-0xFFEBF0F4,
-0xFFFBFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFC5C7DC,
-0xFFACB2C8,
-0xFFAAADBC,
-0xFFFBFEFF,
-0xFFF8FEFF,
-0xFFA8AFCB,
-0xFF4D5677,
-0xFF1E284B,
-0xFF182245,
-0xFF414C6C,
-0xFF8E95B1,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFF8FEFF,
-0xFFF7FDFF,
-0xFFE9EFFF,
-0xFF7F85A9,
-0xFF3B4569,
-0xFF132344,
-0xFF182748,
-0xFF5A5E81,
-0xFFA9ACCB,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFDFDFB,
-0xFFFEFEF4,
-0xFFFFFFF8,
-0xFFFBFDF8,
-0xFFFDFCFF,
-0xFFFFFEFF,
-0xFFFFFBFC,
-0xFFFFFFFD,
-0xFFFAFEFD,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFB3B8D6,
-0xFF5D678A,
-0xFF1C3150,
-0xFF102747,
-0xFF1C2C4E,
-0xFF495474,
-0xFF959FBA,
-0xFFF7FEFF,
-0xFFF5FBFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFCFBF6,
-0xFFFFFEFD,
-0xFFFCFBF9,
-0xFFFBFCF7,
-0xFFFEFFFF,
-0xFFFCFEFF,
-0xFFB9BACE,
-0xFFAFAECD,
-0xFFB5B4D3,
-0xFFFCFDFF,
-0xFFF7FDFF,
-0xFFDDE5FC,
-0xFF6C7592,
-0xFF2E385B,
-0xFF101A3D,
-0xFF23284E,
-0xFF484C6F,
-0xFF8889A7,
-0xFFFBFDFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF6FCFA,
-0xFFFCFEFB,
-0xFFFFFEFF,
-0xFFFDFAFF,
-0xFFFDFBFF,
-0xFFB3B1C6,
-0xFFB5B5CF,
-0xFFB5B9DC,
-0xFFA9B5DD,
-0xFF041644,
-0xFF001645,
-0xFF152A55,
-0xFFC4CDEE,
-0xFFB1B5D0,
-0xFFB4B4CE,
-0xFFB2B3C8,
-0xFFE7E5F3,
-0xFFFEFEFF,
-0xFFFBFFFF,
-0xFFF9FFFB,
-0xFFF8FAF7,
-0xFFFBFCFE,
-0xFFFBFDFF,
-0xFFF8FDFF,
-0xFFC1C9E0,
-0xFF6C7592,
-0xFF2A3757,
-0xFF152245,
-0xFF19254B,
-0xFF3E4B6E,
-0xFF8790B1,
-0xFFECF2FF,
-0xFFFBFEFF,
-0xFFFCFFFF,
-0xFFFBFCFF,
-0xFFFCFDFF,
-0xFFFFFFFF,
-0xFFFBFAFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFDFE,
-0xFFFCFCFA,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF4FDFF,
-0xFF9DA7C0,
-0xFF55607E,
-0xFF1C294B,
-0xFF172447,
-0xFF1D2A4D,
-0xFF465073,
-0xFF8F98B7,
-0xFFF8FCFF,
-0xFFF8FBFF,
-0xFFF8FCFF,
-0xFFF5FCFF,
-0xFF000A34,
-0xFF05123F,
-0xFF434C69,
-0xFFF9FCFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFEBFFFF,
-0xFF679EB2,
-0xFF4F94B3,
-0xFF4A92B8,
-0xFF4B94BD,
-0xFF4993BA,
-0xFF6AA3C0,
-0xFFEDFFFF,
-0xFFF6FFFC,
-0xFFFBFFFD,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFA2C3D4,
-0xFF4C8EAE,
-0xFF429BC5,
-0xFF3C9ECF,
-0xFF41A6DA,
-0xFF44A8DA,
-0xFF3899C6,
-0xFF3F99BC,
-0xFF4689A3,
-0xFFCDE9F7,
-0xFFF9FFFF,
-0xFFFCFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFCFEFD,
-0xFFF7FFFF,
-0xFFECFFFF,
-0xFFE6FFFF,
-0xFFA7D5E5,
-0xFF63A0BC,
-0xFF4992B3,
-0xFF4C98BC,
-0xFF4A96BA,
-0xFF4E94B8,
-0xFF4B8DAF,
-0xFF609FBE,
-0xFFA4DBF0,
-0xFFE2FFFF,
-0xFFE9FFFF,
-0xFFF2FFFF,
-0xFFF9FFFF,
-0xFFFDFBFC,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFF9FBFF,
-0xFFDADFF3,
-0xFF2B324E,
-0xFF00082A,
-0xFF04113D,
-0xFF051344,
-0xFF051246,
-0xFF000D41,
-0xFF091545,
-0xFF050D3B,
-0xFF00052F,
-0xFF0A0F2F,
-0xFFB8BECC,
-0xFFF8FFFF,
-0xFF7E899F,
-0xFF00011C,
-0xFF00061B,
-0xFFB2B8C6,
-0xFFFBFCFF,
-0xFFFDFDFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFF757C8E,
-0xFF00041C,
-0xFF010318,
-0xFFCBCADA,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFCFCFC,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFF9DA0AF,
-0xFF02061F,
-0xFF000322,
-0xFFA4A4C0,
-0xFFFEFCFF,
-0xFFFEFCFF,
-0xFFFFFFFF,
-0xFFFCFEFB,
-0xFFFBFFFF,
-0xFFF5FCFF,
-0xFFF9FFFF,
-0xFF6E748C,
-0xFF000324,
-0xFF000A32,
-0xFF05123E,
-0xFF04123F,
-0xFF031440,
-0xFF01123D,
-0xFF03103A,
-0xFF000A2D,
-0xFF091231,
-0xFFBFC6E0,
-0xFFF9FDFF,
-0xFF80829B,
-0xFF020321,
-0xFF000118,
-0xFFC0C7CF,
-0xFFFBFFFF,
-0xFFFFFDFF,
-0xFFFCFAFF,
-0xFF404763,
-0xFF000626,
-0xFF000724,
-0xFFF2F8FF,
-0xFF1B2347,
-0xFF00062A,
-0xFF09123B,
-0xFF04103A,
-0xFF08153F,
-0xFF06143B,
-0xFF00092B,
-0xFF000922,
-0xFF898F9D,
-0xFFF9FFFF,
-0xFFF6FEFF,
-0xFFF7FFFF,
-0xFF656F93,
-0xFF000431,
-0xFF000B39,
-0xFF01103B,
-0xFF00123A,
-0xFF05173D,
-0xFF060D37,
-0xFF02072D,
-0xFF0B1435,
-0xFFBFC7DE,
-0xFFFCFFFF,
-0xFFFEFFFA,
-0xFFFEFFF7,
-0xFFFDFEF8,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFFA6ADC0,
-0xFF0D122F,
-0xFF050A32,
-0xFF04103A,
-0xFF00153A,
-0xFF00173B,
-0xFF000F37,
-0xFF08163D,
-0xFF030D30,
-0xFF000928,
-0xFF7B85A0,
-0xFFF5FEFF,
-0xFFF7FFFF,
-0xFFFBFFFC,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFBFEFF,
-0xFF0F1233,
-0xFF040730,
-0xFF040931,
-0xFFF8FDFF,
-0xFF4F5673,
-0xFF000124,
-0xFF010F34,
-0xFF04133C,
-0xFF020F39,
-0xFF08113C,
-0xFF050C36,
-0xFF090D33,
-0xFF010626,
-0xFF878EA8,
-0xFFF2FBFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFF080520,
-0xFF09092D,
-0xFF000731,
-0xFF000936,
-0xFF051B4A,
-0xFF001B4A,
-0xFF021945,
-0xFF000A2E,
-0xFF060B2B,
-0xFF080B2A,
-0xFF03051E,
-0xFFABADBC,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFC9CFE7,
-0xFF1B2445,
-0xFF020C30,
-0xFF020E34,
-0xFF010E38,
-0xFF020F3B,
-0xFF04133E,
-0xFF020F3B,
-0xFF020E36,
-0xFF00062A,
-0xFF585D7A,
-0xFFF7FCFF,
-0xFFFCFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFEFCFF,
-0xFFFEFFFF,
-0xFFF7FDFF,
-0xFF707B8F,
-0xFF000E2B,
-0xFF000E2F,
-0xFF021639,
-0xFF03163E,
-0xFF011240,
-0xFF000E3D,
-0xFF0A1640,
-0xFF040D34,
-0xFF00062A,
-0xFF737895,
-0xFFF8FFFF,
-0xFFF4FFFF,
-0xFF000530,
-0xFF061441,
-0xFF3E4965,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFCFFFF,
-0xFFF6FFFA,
-0xFFEEFFFF,
-0xFF6696AC,
-0xFF4B8BAE,
-0xFF4992BB,
-0xFF4FA2CE,
-0xFF42A1CF,
-0xFF66B2D4,
-0xFFEAFFFF,
-0xFFFAFFFC,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF3FFFF,
-0xFF9FBFCE,
-0xFF4A89A8,
-0xFF4196BF,
-0xFF3C9DCA,
-0xFF3FA5D6,
-0xFF3EA6D9,
-0xFF379BCD,
-0xFF3E9BC6,
-0xFF478CAB,
-0xFFCAE6F2,
-0xFFF9FEFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFBFFFF,
-0xFFF2FFFF,
-0xFFEDFFFF,
-0xFFCCFAFF,
-0xFF4A99BA,
-0xFF3C9CC4,
-0xFF419ECA,
-0xFF4198C5,
-0xFF4694BA,
-0xFF4C94BA,
-0xFF4F94BE,
-0xFF4A94C3,
-0xFF409FCD,
-0xFF3798C2,
-0xFF499CBA,
-0xFFBAF7FF,
-0xFFEBFFFF,
-0xFFFBFFFF,
-0xFFFFFDFF,
-0xFFFFF9FB,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF7FBFF,
-0xFF979ABB,
-0xFF01042F,
-0xFF0D113E,
-0xFF060F36,
-0xFF000C2E,
-0xFF000E2D,
-0xFF31405F,
-0xFF394869,
-0xFF1D2A4C,
-0xFF00092C,
-0xFF060F38,
-0xFF0F183F,
-0xFF000429,
-0xFF848EB2,
-0xFF96A4C9,
-0xFF041235,
-0xFF000B29,
-0xFFB6BCD2,
-0xFFFAFDFF,
-0xFFFFFFFF,
-0xFFF9FAFC,
-0xFFF9FDFF,
-0xFF7D849E,
-0xFF080E30,
-0xFF060B29,
-0xFFD3D5EA,
-0xFFFAF7FF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFBF9,
-0xFFFDFEF9,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFFFC,
-0xFFFCFFFF,
-0xFFA5A9C2,
-0xFF070B2E,
-0xFF070A33,
-0xFFA6A6C8,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF1F8FF,
-0xFF121B3C,
-0xFF020B34,
-0xFF0C1842,
-0xFF051338,
-0xFF000927,
-0xFF2B3C56,
-0xFF44566E,
-0xFF1F2E4B,
-0xFF000C2F,
-0xFF010D35,
-0xFF08113A,
-0xFF000229,
-0xFF9BA3C8,
-0xFF98A0C5,
-0xFF081037,
-0xFF040D2E,
-0xFFC3CADA,
-0xFFFBFFFF,
-0xFFFEFEFF,
-0xFFFBFEFF,
-0xFF444F6D,
-0xFF011039,
-0xFF081341,
-0xFF182051,
-0xFF0A1240,
-0xFF050E35,
-0xFF030E2E,
-0xFF32405B,
-0xFF2D3C59,
-0xFF071635,
-0xFF031032,
-0xFF0D173A,
-0xFF000728,
-0xFF636E8E,
-0xFFF2FFFF,
-0xFF2E3B5D,
-0xFF000C36,
-0xFF07123F,
-0xFF010D33,
-0xFF0B1A39,
-0xFF314560,
-0xFF263753,
-0xFF01092D,
-0xFF0B1038,
-0xFF101846,
-0xFF000028,
-0xFFA3AAC4,
-0xFFFBFFFF,
-0xFFFFFFFB,
-0xFFFFFFF6,
-0xFFFCFBF7,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFEFEFF,
-0xFFF8FEFF,
-0xFF505676,
-0xFF02062C,
-0xFF0C0E37,
-0xFF0B0D36,
-0xFF03092D,
-0xFF1A2842,
-0xFF36455C,
-0xFF303754,
-0xFF02082A,
-0xFF00072B,
-0xFF0E183C,
-0xFF000B33,
-0xFF162343,
-0xFFF4FFFF,
-0xFFF7FFFF,
-0xFFF7FAFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFF9F9FF,
-0xFFF8FEFF,
-0xFF172144,
-0xFF061340,
-0xFF142251,
-0xFF43507C,
-0xFF000B35,
-0xFF08163B,
-0xFF00082B,
-0xFF0D1D3E,
-0xFF364765,
-0xFF1F2D4A,
-0xFF030C2D,
-0xFF090E36,
-0xFF0E133D,
-0xFF00052E,
-0xFF50597A,
-0xFFF5FCFF,
-0xFFFBFFFF,
-0xFFFEFDFF,
-0xFFFDF8FF,
-0xFFFFFBFF,
-0xFF07041F,
-0xFF040728,
-0xFF000A2E,
-0xFF001038,
-0xFF041B45,
-0xFF001A4B,
-0xFF001644,
-0xFF000C2E,
-0xFF040926,
-0xFF060A23,
-0xFF000012,
-0xFFB1B4BD,
-0xFFFBFFFF,
-0xFFF6FFFF,
-0xFFF4FFFF,
-0xFFFAFDFF,
-0xFF757996,
-0xFF00002A,
-0xFF0D1845,
-0xFF020B34,
-0xFF020C2F,
-0xFF182140,
-0xFF3A4362,
-0xFF313C5C,
-0xFF071134,
-0xFF010E31,
-0xFF061034,
-0xFF091135,
-0xFF090F2F,
-0xFFE0E2F9,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFEFAF7,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFDFF,
-0xFFF9FCFF,
-0xFFF9FEFF,
-0xFF20264A,
-0xFF05113B,
-0xFF061540,
-0xFF001136,
-0xFF000827,
-0xFF152A49,
-0xFF334367,
-0xFF2C385E,
-0xFF020A2E,
-0xFF040A2E,
-0xFF090E34,
-0xFF040A2E,
-0xFF212844,
-0xFFF4FFFF,
-0xFF000C3D,
-0xFF021442,
-0xFF3D4B68,
-0xFFF7FEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFF2FFFF,
-0xFFDEFFFF,
-0xFFCFFFFF,
-0xFFCBFFFF,
-0xFF57A8D5,
-0xFF3B9FD1,
-0xFF62B6DB,
-0xFFE8FFFF,
-0xFFF9FEF8,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFE1F7FF,
-0xFFC3F1FF,
-0xFFBBFDFF,
-0xFF7FD4FD,
-0xFF41A2CF,
-0xFF3799C8,
-0xFF99F4FF,
-0xFFB1FDFF,
-0xFFBCF0FF,
-0xFFEDFFFF,
-0xFFFCFFFF,
-0xFFFEFFFB,
-0xFFFAFFFB,
-0xFFF6FFFF,
-0xFFE7FFFF,
-0xFFC1F0FF,
-0xFF478CB6,
-0xFF46A3CF,
-0xFF3B9CC9,
-0xFF53A6CE,
-0xFF97DDFF,
-0xFFC0FDFF,
-0xFFC8FFFF,
-0xFFC0F5FF,
-0xFFA0DEFF,
-0xFF57AAD4,
-0xFF3A9AC4,
-0xFF43A4CE,
-0xFF4092B7,
-0xFFAFDDFE,
-0xFFECFFFF,
-0xFFFCFFFF,
-0xFFFFFCF9,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFF949FB1,
-0xFF00022C,
-0xFF121447,
-0xFF020532,
-0xFF454B6D,
-0xFFD0D8EB,
-0xFFF7FFFF,
-0xFFF4FDFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF0FBFF,
-0xFF76819D,
-0xFF00092C,
-0xFF05103D,
-0xFF02103F,
-0xFF293B69,
-0xFF071843,
-0xFF020E34,
-0xFFB0B7D1,
-0xFFFAFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFF7D86A5,
-0xFF060F36,
-0xFF02082C,
-0xFFCDD1EA,
-0xFFFFFEFF,
-0xFFFFFDFC,
-0xFFFFFEFC,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFEF9,
-0xFFFDFDFB,
-0xFFFEFEFC,
-0xFFFCFEFD,
-0xFFFBFDFF,
-0xFFA4A7C6,
-0xFF060932,
-0xFF090C37,
-0xFFA5A8C9,
-0xFFFEFDFF,
-0xFFFEFFFF,
-0xFFF8FCFF,
-0xFFF9FDFF,
-0xFFF5FCFF,
-0xFF000626,
-0xFF0C1540,
-0xFF030E3B,
-0xFF0D1A3D,
-0xFFA7B5CF,
-0xFFF2FFFF,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFF838CAB,
-0xFF070F34,
-0xFF0B143D,
-0xFF000633,
-0xFF3A4974,
-0xFF061743,
-0xFF00072A,
-0xFFBEC7D8,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFF455473,
-0xFF031545,
-0xFF0E1951,
-0xFF050F44,
-0xFF000934,
-0xFF9099BA,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFFA6B0CB,
-0xFF030E2E,
-0xFF07133D,
-0xFF020F3C,
-0xFF3C4B76,
-0xFF000D37,
-0xFF071039,
-0xFF141C40,
-0xFFC5CCE6,
-0xFFF6FEFF,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFF8FEFF,
-0xFF6D7196,
-0xFF000432,
-0xFF0D1846,
-0xFF000026,
-0xFFE2EAFF,
-0xFFFEFFFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFDFCFA,
-0xFFFFFEFF,
-0xFFF9FBFF,
-0xFF393F63,
-0xFF020935,
-0xFF101340,
-0xFF080A33,
-0xFF8487A8,
-0xFFF9FDFF,
-0xFFF5FEFF,
-0xFFF7FFFF,
-0xFFF7F8FF,
-0xFFFCFCFF,
-0xFFA9AECB,
-0xFF0F1839,
-0xFF020E38,
-0xFF09173E,
-0xFF061532,
-0xFFF4FFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF5FDFF,
-0xFF152445,
-0xFF051745,
-0xFF061A4C,
-0xFF001141,
-0xFF03123D,
-0xFF404A6D,
-0xFFE3EFFF,
-0xFFF2FFFF,
-0xFFF2FFFF,
-0xFFF2FEFF,
-0xFFF6FEFF,
-0xFF787D9D,
-0xFF050A32,
-0xFF0B1341,
-0xFF020B36,
-0xFF7A80A0,
-0xFFF3F8FF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFCBCADC,
-0xFFCBCDE4,
-0xFFC9D3EE,
-0xFFBBCCEA,
-0xFF02183F,
-0xFF02194B,
-0xFF1A305F,
-0xFFDAE5FF,
-0xFFCBD0E4,
-0xFFCCCFDE,
-0xFFCCCFD6,
-0xFFF0F4F7,
-0xFFF4F9FC,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFF6C6F8E,
-0xFF03062F,
-0xFF0E1644,
-0xFF00042E,
-0xFF67708F,
-0xFFEBF3FF,
-0xFFF9FEFF,
-0xFFF8FDFF,
-0xFFF8FEFF,
-0xFFF6FEFF,
-0xFFBFC9E4,
-0xFF273250,
-0xFF000A2D,
-0xFF0B1337,
-0xFF000220,
-0xFFE2E5F8,
-0xFFFEFFFF,
-0xFFFEFDF8,
-0xFFFFFFFA,
-0xFFFBFCF6,
-0xFFFEFFFD,
-0xFFFAFFFF,
-0xFFF8FFFF,
-0xFF060F2E,
-0xFF040C3A,
-0xFF030D3E,
-0xFF07153C,
-0xFF8D9EBC,
-0xFFF0FFFF,
-0xFFEEFFFF,
-0xFFF4FFFF,
-0xFFF4FBFF,
-0xFFF9FEFF,
-0xFFB7BBD4,
-0xFF252B4B,
-0xFF01092D,
-0xFF091135,
-0xFF27335B,
-0xFF011246,
-0xFF001242,
-0xFF3D4D67,
-0xFFF7FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFAFEFF,
-0xFFF5FDFF,
-0xFFEEFFFF,
-0xFFD9FFFF,
-0xFF6AB0D4,
-0xFF3B9BCD,
-0xFF5EB1D9,
-0xFFE9FFFF,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFFDFCFF,
-0xFFF9FCFF,
-0xFFF7FFFF,
-0xFFF2FFFF,
-0xFFE4FFFF,
-0xFF9FE1FF,
-0xFF4A9BC6,
-0xFF4191B6,
-0xFFC6FFFF,
-0xFFDFFFFF,
-0xFFF2FFFF,
-0xFFFCFFFD,
-0xFFFFFEF9,
-0xFFFFFFFA,
-0xFFF5FEFB,
-0xFFF1FFFF,
-0xFFD3FFFF,
-0xFF4093BD,
-0xFF44A3D3,
-0xFF448BB7,
-0xFFA1D6F6,
-0xFFE6FFFF,
-0xFFECFFFF,
-0xFFEAFFFF,
-0xFFEBFFFF,
-0xFFEEFFFF,
-0xFFE8FFFF,
-0xFFE4FFFF,
-0xFFB2E5FF,
-0xFF4493BE,
-0xFF45A0CF,
-0xFF4394BF,
-0xFFC2FBFF,
-0xFFF1FFFF,
-0xFFFDFFF4,
-0xFFFEFFFF,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFD1DEF1,
-0xFF000322,
-0xFF101745,
-0xFF000330,
-0xFFA5A6C4,
-0xFFFCFEFF,
-0xFFFBFCFE,
-0xFFFEFFFF,
-0xFFFBFCFF,
-0xFFFCFFFF,
-0xFFF6FBFE,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFE4EFFF,
-0xFF0A163E,
-0xFF031346,
-0xFF001446,
-0xFF0B1D4B,
-0xFF000630,
-0xFFB2B9D6,
-0xFFFEFEFF,
-0xFFFBFBFB,
-0xFFFDFFFE,
-0xFFF9FDFF,
-0xFF7880A4,
-0xFF040F3C,
-0xFF030B32,
-0xFFCACFEC,
-0xFFFEFEFF,
-0xFFFEFDFB,
-0xFFFFFDFC,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFEFEFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFCFEFF,
-0xFFA5AACA,
-0xFF050A34,
-0xFF050A30,
-0xFFA6ACC6,
-0xFFFAFDFF,
-0xFFFBFFFE,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFF1A2042,
-0xFF0F1640,
-0xFF030A36,
-0xFF3A4266,
-0xFFF3FFFF,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFF8FDFF,
-0xFFFCFFFF,
-0xFFFAFAFF,
-0xFFFEFEFF,
-0xFFFBFDFF,
-0xFFE9EEFF,
-0xFF11193D,
-0xFF0A1744,
-0xFF021446,
-0xFF051D4B,
-0xFF000F30,
-0xFFC0CCDA,
-0xFFF9FEFF,
-0xFFFEFFFD,
-0xFFF9FFFF,
-0xFF3F5273,
-0xFF001042,
-0xFF08154A,
-0xFF030B3A,
-0xFFBAC1DE,
-0xFFF9FFFF,
-0xFFFBFEFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFF9FEFF,
-0xFFFBFFFF,
-0xFFD4DAF0,
-0xFF000C33,
-0xFF051546,
-0xFF031346,
-0xFF091642,
-0xFF0A1030,
-0xFFFBFDFF,
-0xFFFBFBFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF6F9FF,
-0xFFFEFDFF,
-0xFFFBFDFF,
-0xFF7E84A8,
-0xFF06123C,
-0xFF061340,
-0xFF3E486B,
-0xFFFAF9FF,
-0xFFFFFEFF,
-0xFFFEFDF9,
-0xFFFBFBFD,
-0xFFFCFEFF,
-0xFF7A7F9C,
-0xFF000833,
-0xFF0A1240,
-0xFF11163C,
-0xFFF8FDFF,
-0xFFF6FCFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFFFFDFF,
-0xFFFBF9FF,
-0xFFFEFDFF,
-0xFFF9FEFF,
-0xFF3F476B,
-0xFF000B33,
-0xFF041237,
-0xFF35405E,
-0xFFF7FAFF,
-0xFFFDFBFF,
-0xFFFEFBFF,
-0xFFF9F9FF,
-0xFFF5FFFF,
-0xFF13243E,
-0xFF051C46,
-0xFF001848,
-0xFF000D38,
-0xFF6B789A,
-0xFFF9FEFF,
-0xFFFCFEFF,
-0xFFF8FFFF,
-0xFFF7FEFF,
-0xFFF9FEFF,
-0xFFFAFFFF,
-0xFFFBFEFF,
-0xFFBCC0DB,
-0xFF020933,
-0xFF070F3D,
-0xFF00052F,
-0xFFF0F3FF,
-0xFFFCFCFF,
-0xFFFFFFFF,
-0xFFFBFBFB,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF4FFFF,
-0xFF000F30,
-0xFF021648,
-0xFF1D2E5C,
-0xFFF5FDFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFDFFFA,
-0xFFF9FBF6,
-0xFFFCFFFF,
-0xFFF6FEFF,
-0xFFAFB4D1,
-0xFF00002B,
-0xFF0F123F,
-0xFF020C2F,
-0xFFD4E0F6,
-0xFFF8FFFF,
-0xFFF9FEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFF9F9FF,
-0xFFFCFEFF,
-0xFFF8FEFF,
-0xFFF7FFFF,
-0xFF6D7993,
-0xFF000A2D,
-0xFF0A1438,
-0xFF0D1732,
-0xFFF5FEFF,
-0xFFFBFFFF,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFF5FAFD,
-0xFFF7FFFF,
-0xFF2E3959,
-0xFF08143E,
-0xFF09123D,
-0xFF323C5F,
-0xFFF5FFFF,
-0xFFF6FFFF,
-0xFFF5FEFF,
-0xFFF9FFFF,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFF6FDFF,
-0xFF5D6782,
-0xFF000731,
-0xFF081245,
-0xFF07184E,
-0xFF021442,
-0xFF44546D,
-0xFFF2FCFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFCFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFD,
-0xFFFCFEFB,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFF8FFFF,
-0xFFE4FFFF,
-0xFF68A7CA,
-0xFF3F9BCE,
-0xFF62B4DC,
-0xFFE8FFFF,
-0xFFFEFFFB,
-0xFFFFFAFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFDFFFE,
-0xFFEFFFFF,
-0xFFA2DDFD,
-0xFF4A95BD,
-0xFF4B94B5,
-0xFFCBFFFF,
-0xFFF1FFFF,
-0xFFFFFFFB,
-0xFFFFFDF9,
-0xFFFFFEFA,
-0xFFFFFFFB,
-0xFFF5FFFF,
-0xFFE1FFFF,
-0xFF63A3BF,
-0xFF42A4D1,
-0xFF3897C5,
-0xFFB7E9FF,
-0xFFEEFFFF,
-0xFFF9FFFF,
-0xFFFFFFF8,
-0xFFF9FEF8,
-0xFFFBFFFD,
-0xFFFCFFFF,
-0xFFFAFEFF,
-0xFFFBFFFF,
-0xFFEEFFFF,
-0xFFCDFFFF,
-0xFF4594BF,
-0xFF42A3D0,
-0xFF4F9FC0,
-0xFFE3FFFF,
-0xFFF9FFFB,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFF9FFFF,
-0xFF1C2B4A,
-0xFF081740,
-0xFF000630,
-0xFFA6A9CA,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFDFBFE,
-0xFFFFFFFA,
-0xFFFEFFF8,
-0xFFF8FDF6,
-0xFFF8FFFF,
-0xFFEFF8FF,
-0xFF020F3B,
-0xFF021744,
-0xFF031845,
-0xFF05103D,
-0xFFB4B9D9,
-0xFFFCFCFF,
-0xFFFFFEFF,
-0xFFFDFDFD,
-0xFFFBFFFF,
-0xFF7D87AA,
-0xFF030E3B,
-0xFF000730,
-0xFFCDD2EF,
-0xFFFCFDFF,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFCFEFF,
-0xFFA3A7CA,
-0xFF020A31,
-0xFF030C2D,
-0xFFA6ACC2,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFF8FEFF,
-0xFF878EA8,
-0xFF040B37,
-0xFF080E3E,
-0xFF2D3157,
-0xFFF9FEFF,
-0xFFF9FFFF,
-0xFFFBFFFD,
-0xFFFDFFFC,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFCFEFF,
-0xFFF7FEFF,
-0xFF000C36,
-0xFF081A4C,
-0xFF011949,
-0xFF000E30,
-0xFFC3CDD9,
-0xFFFCFFFF,
-0xFFFDFFFC,
-0xFFF8FFFF,
-0xFF405276,
-0xFF031749,
-0xFF051141,
-0xFF41496E,
-0xFFF8FDFF,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFAF9F7,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFF9F9FB,
-0xFFFBFFFF,
-0xFF5E688B,
-0xFF00113F,
-0xFF09194D,
-0xFF000C38,
-0xFFA2A6BF,
-0xFFF9F9FF,
-0xFFFFFFFD,
-0xFFFFFEF9,
-0xFFFEFEFC,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFCFBFF,
-0xFFF8FEFF,
-0xFF131E3E,
-0xFF071441,
-0xFF000730,
-0xFFF8FAFF,
-0xFFFFFEFF,
-0xFFFCFCFC,
-0xFFFEFFFF,
-0xFFE0E5FB,
-0xFF000526,
-0xFF0C153E,
-0xFF0A133A,
-0xFFF7FEFF,
-0xFFF4FAFF,
-0xFFF9FFFF,
-0xFFF7FDFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFBFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFEFEFF,
-0xFFF8FEFF,
-0xFF313C5C,
-0xFF06143B,
-0xFF00062A,
-0xFFB0B2CB,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFF11223C,
-0xFF021943,
-0xFF001645,
-0xFF1F2F51,
-0xFFF7FFFF,
-0xFFFEFEFF,
-0xFFFEFCFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFDFEF9,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFF9FCFF,
-0xFF6E7496,
-0xFF09123D,
-0xFF040B39,
-0xFF797DA2,
-0xFFFCFEFF,
-0xFFFDFDFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFCFFFF,
-0xFFF2FAFF,
-0xFF051235,
-0xFF011144,
-0xFF273461,
-0xFFF8FDFF,
-0xFFFCFDFF,
-0xFFFFFFFB,
-0xFFFBFCF4,
-0xFFFFFFFA,
-0xFFFCFFFF,
-0xFFF7FDFF,
-0xFF03092D,
-0xFF111240,
-0xFF04062F,
-0xFFE1E7FF,
-0xFFF3FCFF,
-0xFFFBFFFD,
-0xFFFEFFFA,
-0xFFFBFBF9,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFDFCFF,
-0xFFFCFEFD,
-0xFFFAFFFF,
-0xFFF8FFFF,
-0xFF5F6887,
-0xFF040D34,
-0xFF041133,
-0xFF708090,
-0xFFF7FFFF,
-0xFFFEFFFD,
-0xFFFEFEFE,
-0xFFF9FFFF,
-0xFFA4AEC7,
-0xFF00072F,
-0xFF05103D,
-0xFF222A4E,
-0xFFF8FEFF,
-0xFFFBFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFDFDFB,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFF9FFFF,
-0xFFF4FDFF,
-0xFF515680,
-0xFF050C42,
-0xFF09184F,
-0xFF031543,
-0xFF3A4862,
-0xFFF7FFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFFFA,
-0xFFFCFFF8,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFF8FFFF,
-0xFFE5FFFF,
-0xFF6CA8CC,
-0xFF439ACF,
-0xFF65B2DE,
-0xFFE9FFFF,
-0xFFFEFFFD,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFA,
-0xFFEEFFFF,
-0xFF9FDFFB,
-0xFF4698BE,
-0xFF4994B4,
-0xFFCAFFFF,
-0xFFF0FFFF,
-0xFFFFFEFF,
-0xFFFFFAFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFF0FFFF,
-0xFFACE8FF,
-0xFF4296BB,
-0xFF429DC9,
-0xFF83CDF0,
-0xFFE8FFFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF9FFFF,
-0xFFEDFFFF,
-0xFFB0E2F9,
-0xFF3F9AC6,
-0xFF3A96BF,
-0xFFAFE0F1,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFDFCFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFDFDFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFC1C6DC,
-0xFF000630,
-0xFF091642,
-0xFF3C4262,
-0xFFFCFDFF,
-0xFFFFFEFF,
-0xFFFAF9F7,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFDFBFF,
-0xFFFFFEFB,
-0xFFFFFFF8,
-0xFFFFFFF7,
-0xFFFCFEFD,
-0xFFFBFFFF,
-0xFF9CA3BD,
-0xFF000C30,
-0xFF091C46,
-0xFF010937,
-0xFFB4B7D8,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFAFEFF,
-0xFF7A84A7,
-0xFF020F3B,
-0xFF000A30,
-0xFFCAD1EB,
-0xFFFCFFFF,
-0xFFFDFCF8,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFDFEFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFF8FAFF,
-0xFFA3A8C8,
-0xFF040C31,
-0xFF030C2B,
-0xFFA3ACBD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFF0B1435,
-0xFF0D1345,
-0xFF030736,
-0xFFF0F0FF,
-0xFFF9F7FF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFA,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFF8FEFF,
-0xFFA1ACCA,
-0xFF000B37,
-0xFF091B4D,
-0xFF000A33,
-0xFFC3C9D7,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFF425276,
-0xFF001240,
-0xFF000C34,
-0xFFAFB6D0,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFCFD5ED,
-0xFF00082E,
-0xFF0C1A4B,
-0xFF000D34,
-0xFFF8FEFF,
-0xFFFDFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFF798092,
-0xFF030C33,
-0xFF020B34,
-0xFFB6BDD0,
-0xFFF9FFFF,
-0xFFF9FCFF,
-0xFFFBFFFF,
-0xFF5A617D,
-0xFF060E32,
-0xFF010C2C,
-0xFFAFB6D0,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFBFF,
-0xFFFFFCFF,
-0xFFFBFFFF,
-0xFFF0F9FF,
-0xFF000929,
-0xFF0C163A,
-0xFF212240,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFF6FDFF,
-0xFF162441,
-0xFF06184A,
-0xFF000D3B,
-0xFFA5ADC2,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF2FAFF,
-0xFF000929,
-0xFF0A113D,
-0xFF2A2E53,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFA,
-0xFFFFFFF8,
-0xFFFFFFFF,
-0xFFF7FBFF,
-0xFF070E38,
-0xFF071347,
-0xFF232E5B,
-0xFFFBFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFCFA,
-0xFFFEFEFC,
-0xFFFBFFFF,
-0xFF8B91B1,
-0xFF010A33,
-0xFF0C1139,
-0xFF7E81A0,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFFFFF8,
-0xFFFFFFF8,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFF8,
-0xFFFFFEFA,
-0xFFFDFDFF,
-0xFFFBFDFF,
-0xFF0B1038,
-0xFF0A163E,
-0xFF000E2A,
-0xFFF2FFFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFF8FAFF,
-0xFF1A2044,
-0xFF0D1641,
-0xFF00082F,
-0xFFE5EBFF,
-0xFFFBFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFBFFFC,
-0xFFF9FFFF,
-0xFFF8FDFF,
-0xFF070D3D,
-0xFF09164A,
-0xFF02133F,
-0xFF3F4D67,
-0xFFF7FFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFB,
-0xFFFCFFFA,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFF7FFFF,
-0xFFE3FFFF,
-0xFF6CA8CC,
-0xFF4499CF,
-0xFF65B2DE,
-0xFFE9FFFF,
-0xFFFEFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFA,
-0xFFEDFFFF,
-0xFF9DE0FB,
-0xFF4599BE,
-0xFF4993B6,
-0xFFCDFFFF,
-0xFFF2FFFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFDFDFD,
-0xFFEAFFFF,
-0xFF63B1D5,
-0xFF3D9FCE,
-0xFF459AC3,
-0xFFCFFFFF,
-0xFFEBFFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFE3FFFF,
-0xFF53ABD3,
-0xFF3E9DC9,
-0xFF6BA7C1,
-0xFFE9FFFF,
-0xFFF3FAFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFDFF,
-0xFFFAF9FF,
-0xFF5C607B,
-0xFF020D3B,
-0xFF000633,
-0xFFD2D8F0,
-0xFFF5F8FF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFCFCFE,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFCF9,
-0xFFFFFEFB,
-0xFFFEFAF9,
-0xFFFFFFFF,
-0xFFF8FEFF,
-0xFF0F1E3D,
-0xFF0A1942,
-0xFF040B35,
-0xFFB7B7D9,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFCFBF9,
-0xFFFBFFFF,
-0xFF7E87A8,
-0xFF03103A,
-0xFF000A2D,
-0xFFC9D4EA,
-0xFFFBFFFF,
-0xFFFFFFFB,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFA3A8C6,
-0xFF040C30,
-0xFF040F2B,
-0xFFA3ABBE,
-0xFFFBFFFF,
-0xFFF8FDFF,
-0xFFBBC3D8,
-0xFF00082C,
-0xFF060E3F,
-0xFF565B85,
-0xFFFCFAFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFC,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFE,
-0xFFFFFFFA,
-0xFFFAF9F4,
-0xFFFEFFFD,
-0xFFFAFEFF,
-0xFFF8FEFF,
-0xFF172145,
-0xFF081245,
-0xFF000934,
-0xFFC8CBDC,
-0xFFFFFFFF,
-0xFFFFFEFC,
-0xFFFBFDFF,
-0xFF435176,
-0xFF00113F,
-0xFF040E31,
-0xFFDDE4F7,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFF6FBFF,
-0xFF00072B,
-0xFF051342,
-0xFF16244B,
-0xFFF9FFFF,
-0xFFFDFFFC,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFADB1BD,
-0xFF060E33,
-0xFF020B34,
-0xFF8994A8,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF3FAFF,
-0xFF040F2F,
-0xFF0A173A,
-0xFF0F1A38,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFDFAFF,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF52617E,
-0xFF091639,
-0xFF000124,
-0xFFDAD7F2,
-0xFFFFFAFF,
-0xFFFFFDFF,
-0xFFF8FFFF,
-0xFF162345,
-0xFF08154A,
-0xFF000C38,
-0xFFF0F4FF,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFF212C48,
-0xFF0B123C,
-0xFF060C30,
-0xFFFBFFFF,
-0xFFF8FCFB,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFF9FBFF,
-0xFF070E38,
-0xFF071345,
-0xFF252E59,
-0xFFFCFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF6FCFF,
-0xFF242E52,
-0xFF081340,
-0xFF00092D,
-0xFFF8FDFF,
-0xFFFEFBFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFDFFFE,
-0xFFFBFEFF,
-0xFFFBFEFF,
-0xFFFBFEFF,
-0xFFFDFEFF,
-0xFFFEFDF9,
-0xFFFDFBFC,
-0xFFFEFCFF,
-0xFFFBFBFF,
-0xFF9295C0,
-0xFF020D3B,
-0xFF000930,
-0xFF9EACC7,
-0xFFFBFDFF,
-0xFFFFFDFF,
-0xFFDADDFC,
-0xFF030832,
-0xFF060D39,
-0xFF464C6E,
-0xFFFBFEFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFF8FEFE,
-0xFFFBFDFF,
-0xFF8A90B4,
-0xFF020F3C,
-0xFF05143F,
-0xFF424E68,
-0xFFF7FDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFF4FFFF,
-0xFFE2FFFF,
-0xFF6CA8CC,
-0xFF419CCB,
-0xFF64B3DC,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFEAFFFF,
-0xFF9BE1FB,
-0xFF4698BD,
-0xFF4D91B6,
-0xFFD2FEFF,
-0xFFF7FFFF,
-0xFFFFFEFF,
-0xFFFFFFFA,
-0xFFFEFFFA,
-0xFFFAFFFE,
-0xFFE2FFFF,
-0xFF429ECD,
-0xFF35A0D6,
-0xFF78CCF1,
-0xFFD0FFFF,
-0xFFE0FFFF,
-0xFFE6FFFF,
-0xFFEAFFFF,
-0xFFEAFFFF,
-0xFFE7FFFF,
-0xFFE7FFFF,
-0xFFE7FFFF,
-0xFFE6FFFF,
-0xFFE3FFFF,
-0xFFE4FFFF,
-0xFFE8FFFF,
-0xFFDFFFFF,
-0xFF95E7FF,
-0xFF4099C3,
-0xFF5699B6,
-0xFFDDFFFF,
-0xFFF8FFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFB,
-0xFFFCFEF9,
-0xFFFDFEFF,
-0xFFFEFEFF,
-0xFFFCFEFF,
-0xFF181C37,
-0xFF0A1741,
-0xFF07153A,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFAFFFC,
-0xFFFCFFFB,
-0xFFFFFFFD,
-0xFFFFFAFE,
-0xFFFFF9FF,
-0xFFFFFCFF,
-0xFFFDFBFE,
-0xFFFBFFFF,
-0xFF5D6B86,
-0xFF051338,
-0xFF01062E,
-0xFFBAB9D9,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFC,
-0xFFFBFFFF,
-0xFF7B84A3,
-0xFF010F36,
-0xFF000D2F,
-0xFFCDD5EA,
-0xFFFAFEFF,
-0xFFFFFFFB,
-0xFFFDFDFF,
-0xFFFFFEFF,
-0xFFFDFBFC,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFAFEFF,
-0xFFFDFDFD,
-0xFFFEFEFF,
-0xFFA3A8C5,
-0xFF020C2F,
-0xFF020D2B,
-0xFFA4ACC3,
-0xFFF9FDFF,
-0xFFFBFFFF,
-0xFF79839E,
-0xFF061034,
-0xFF020B36,
-0xFFB0B5DB,
-0xFFFCFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFDFEF9,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFFEFFF9,
-0xFFFFFFFA,
-0xFFFAFCF9,
-0xFFFCFFFF,
-0xFFFAFCFF,
-0xFF6F7396,
-0xFF070B3B,
-0xFF050833,
-0xFFC7C8DC,
-0xFFFEFDFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFF465278,
-0xFF03113E,
-0xFF00082C,
-0xFFF8FEFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF9FEFF,
-0xFF01092D,
-0xFF081645,
-0xFF29385F,
-0xFFF8FFFF,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFAFDFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFAFCFB,
-0xFFCDD1DD,
-0xFF030A34,
-0xFF030C37,
-0xFF808B9F,
-0xFFF7FFFF,
-0xFFF7FEFF,
-0xFFCCD4E7,
-0xFF00092C,
-0xFF04133C,
-0xFF6E7D9E,
-0xFFF5FFFF,
-0xFFF9FEFF,
-0xFFFCFDFF,
-0xFFFCFCFF,
-0xFFFCFCFF,
-0xFFFEFCFF,
-0xFFFEFCFF,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFEFCFF,
-0xFFFAFCFF,
-0xFFF7FFFF,
-0xFFF2FFFF,
-0xFFADC2E1,
-0xFF00092F,
-0xFF071039,
-0xFF9396B7,
-0xFFFFFDFF,
-0xFFFDFDFF,
-0xFFF7FFFF,
-0xFF18244A,
-0xFF031044,
-0xFF041038,
-0xFFFEFEFF,
-0xFFFFFCF5,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF46546E,
-0xFF071039,
-0xFF000125,
-0xFFF8FCFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF7FBFF,
-0xFF061034,
-0xFF071441,
-0xFF232F55,
-0xFFFBFEFF,
-0xFFFFFFFF,
-0xFFFDFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFF000D32,
-0xFF0A1845,
-0xFF3B496E,
-0xFFF5FEFF,
-0xFFFCFBFF,
-0xFFFFFAFF,
-0xFFFCFCFF,
-0xFFF9FEFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFFAFEFF,
-0xFFFBFEFF,
-0xFFFBFDFF,
-0xFFF6F9FF,
-0xFFE1E5FF,
-0xFF040C3D,
-0xFF000C3C,
-0xFF5E6B8D,
-0xFFF9FFFF,
-0xFFFAFEFF,
-0xFF979BBE,
-0xFF030734,
-0xFF040931,
-0xFFA2A5C4,
-0xFFFEFDFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFF8FAF7,
-0xFFFEFFFF,
-0xFFE7ECFF,
-0xFF00062C,
-0xFF020F39,
-0xFF434C69,
-0xFFF9FEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFF5FFFF,
-0xFFE2FFFF,
-0xFF6AA9CA,
-0xFF409DC9,
-0xFF64B3DA,
-0xFFEBFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFEBFFFF,
-0xFF9DE0FB,
-0xFF4699BB,
-0xFF4F90B6,
-0xFFD2FEFF,
-0xFFF7FFFF,
-0xFFFFFFFD,
-0xFFFCFFFA,
-0xFFF9FFFA,
-0xFFF9FFFF,
-0xFFDAFFFF,
-0xFF3494C6,
-0xFF35A6DE,
-0xFF63BBE3,
-0xFF78BDDE,
-0xFF7FBCDB,
-0xFF82B9D7,
-0xFF82B7D6,
-0xFF82B7D6,
-0xFF80B9D6,
-0xFF7EBAD4,
-0xFF7EBBD0,
-0xFF7EBAD2,
-0xFF7DBAD6,
-0xFF7EBAD6,
-0xFF86BAD0,
-0xFF7DBBD4,
-0xFF64BCE2,
-0xFF46A2C9,
-0xFF4790B0,
-0xFFC6F5FF,
-0xFFF5FFFF,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFCFDFF,
-0xFFFCFFFF,
-0xFFFAFBFF,
-0xFF020724,
-0xFF05143D,
-0xFF2B3B5D,
-0xFFF4FEFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFDFCFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFFBFFFB,
-0xFFFBFFFA,
-0xFFFFFDFE,
-0xFFFFFDFF,
-0xFFFFF8FF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFF7FBFF,
-0xFFA0ACC6,
-0xFF000D30,
-0xFF03082E,
-0xFFB9BAD8,
-0xFFFFF9FF,
-0xFFFFFDFF,
-0xFFFFFFFD,
-0xFFFAFEFF,
-0xFF7C85A4,
-0xFF020E36,
-0xFF010B2E,
-0xFFCBD3E8,
-0xFFFBFFFF,
-0xFFFEFEFC,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFFFE,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFA7ACC9,
-0xFF020C30,
-0xFF010B2E,
-0xFFA6ADC7,
-0xFFFAFEFF,
-0xFFFBFFFF,
-0xFF4F5875,
-0xFF071437,
-0xFF00082F,
-0xFFE6ECFF,
-0xFFFAFDFF,
-0xFFFDFEFF,
-0xFFFDFEFF,
-0xFFFCFEFD,
-0xFFFDFFFC,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFDFEF9,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFF7FAFF,
-0xFFA6AAC7,
-0xFF080B38,
-0xFF040732,
-0xFFC5C6DA,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFF485178,
-0xFF061242,
-0xFF000126,
-0xFFF8FEFF,
-0xFFFBFFFF,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF4F9FF,
-0xFF040C30,
-0xFF071846,
-0xFF2A3C62,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFBFEFF,
-0xFFFCFFFF,
-0xFFFAFEFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFBFCFE,
-0xFFCCCFDE,
-0xFF000833,
-0xFF020D3A,
-0xFF8189A0,
-0xFFF8FFFF,
-0xFFF7FEFF,
-0xFFA8B0C3,
-0xFF000C31,
-0xFF091A46,
-0xFF021438,
-0xFF000A2C,
-0xFF040A2C,
-0xFF06092A,
-0xFF06092C,
-0xFF06092C,
-0xFF08082A,
-0xFF080928,
-0xFF080928,
-0xFF080928,
-0xFF06092C,
-0xFF050B2D,
-0xFF000A28,
-0xFF000E2A,
-0xFF001535,
-0xFF05193E,
-0xFF05123E,
-0xFF63698B,
-0xFFFCFFFF,
-0xFFFBFEFF,
-0xFFF3FDFF,
-0xFF18284C,
-0xFF031344,
-0xFF0E1A40,
-0xFFF7F7FF,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFCFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF9FFFF,
-0xFFF4FFFF,
-0xFF53617B,
-0xFF060F3A,
-0xFF050A32,
-0xFFF0F3FF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF6FCFF,
-0xFF041131,
-0xFF06153E,
-0xFF233052,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFCFEFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFD7E1EB,
-0xFF00082C,
-0xFF041644,
-0xFF081740,
-0xFF000A30,
-0xFF050831,
-0xFF06082F,
-0xFF05092E,
-0xFF040A2C,
-0xFF010C2A,
-0xFF000D28,
-0xFF000D27,
-0xFF000E25,
-0xFF020E26,
-0xFF000722,
-0xFF00092A,
-0xFF00072C,
-0xFF0A1240,
-0xFF0C1647,
-0xFF0C1649,
-0xFF2D375A,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFF666E92,
-0xFF0B1240,
-0xFF050A32,
-0xFFD2D6F3,
-0xFFFEFCFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFFFA,
-0xFFF9FFFF,
-0xFF010B2F,
-0xFF0A1743,
-0xFF3D4665,
-0xFFFBFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFF8FFFF,
-0xFFE5FFFF,
-0xFF6AA9C8,
-0xFF3E9EC8,
-0xFF62B4D9,
-0xFFEDFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF0FFFF,
-0xFF9EE0FA,
-0xFF4599BB,
-0xFF4A92BA,
-0xFFCDFFFF,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFCDEDFA,
-0xFF419CC8,
-0xFF33A5DB,
-0xFF40A2D1,
-0xFF3C94C2,
-0xFF3E94C3,
-0xFF4195C3,
-0xFF4297C0,
-0xFF4297BE,
-0xFF4497C3,
-0xFF4397C5,
-0xFF4099C1,
-0xFF4199BF,
-0xFF4497BF,
-0xFF4597BF,
-0xFF4698C0,
-0xFF3D96C0,
-0xFF3AA1CC,
-0xFF3DA0C7,
-0xFF4392B1,
-0xFFB8ECFF,
-0xFFF1FFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFEFFFA,
-0xFFFDFFFA,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFCFF,
-0xFF000323,
-0xFF02143C,
-0xFF3A4D6E,
-0xFFF5FFFF,
-0xFFF9FEFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFAFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFDFBFC,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFA5B3D0,
-0xFF000A2F,
-0xFF081035,
-0xFFB4B8D3,
-0xFFFFFCFF,
-0xFFFFFEFD,
-0xFFFEFEFE,
-0xFFFBFFFF,
-0xFF7F88A7,
-0xFF051139,
-0xFF000529,
-0xFFCCD2EA,
-0xFFFCFFFF,
-0xFFFDFDFB,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFFFE,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFDFCFF,
-0xFFA7ACCA,
-0xFF000932,
-0xFF040D34,
-0xFFA2A9C6,
-0xFFFCFEFF,
-0xFFFAFCFF,
-0xFF444D6A,
-0xFF071437,
-0xFF000427,
-0xFFF1F8FF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFBFBF9,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFB2B9CC,
-0xFF000630,
-0xFF040933,
-0xFFC6C9DC,
-0xFFFEFFFF,
-0xFFFDFDFD,
-0xFFFBFDFF,
-0xFF454E77,
-0xFF071345,
-0xFF00042A,
-0xFFF8FDFF,
-0xFFFBFFFF,
-0xFFFEFFF8,
-0xFFFFFFF8,
-0xFFFEFFFA,
-0xFFFCFFFA,
-0xFFFBFFFD,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF9FEFF,
-0xFF030E2E,
-0xFF001240,
-0xFF25395E,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFCFCFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFC9CEE1,
-0xFF000835,
-0xFF03103D,
-0xFF878DA7,
-0xFFF7FAFF,
-0xFFFCFEFF,
-0xFFA7AEC0,
-0xFF000A31,
-0xFF061B48,
-0xFF051B44,
-0xFF011339,
-0xFF051137,
-0xFF071037,
-0xFF051139,
-0xFF051139,
-0xFF071039,
-0xFF080F39,
-0xFF080F3D,
-0xFF07103B,
-0xFF060F36,
-0xFF050F33,
-0xFF061336,
-0xFF031134,
-0xFF000D30,
-0xFF05173D,
-0xFF00052D,
-0xFF565D7A,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF0FFFF,
-0xFF122546,
-0xFF011641,
-0xFF07173B,
-0xFFFCFEFF,
-0xFFFFFFFB,
-0xFFFCFFFA,
-0xFFFBFFFA,
-0xFFFBFFFB,
-0xFFFBFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF5FFFF,
-0xFF4E5C76,
-0xFF091142,
-0xFF020635,
-0xFFEEF0FF,
-0xFFFBFCFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF5FEFF,
-0xFF04122D,
-0xFF06153E,
-0xFF223152,
-0xFFF9FFFF,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFF8FDF7,
-0xFFFBFFFD,
-0xFFC3CDD7,
-0xFF000D31,
-0xFF0B1D4D,
-0xFF061441,
-0xFF02113A,
-0xFF041036,
-0xFF041036,
-0xFF041038,
-0xFF041038,
-0xFF04103A,
-0xFF03103A,
-0xFF02113A,
-0xFF02113A,
-0xFF05173D,
-0xFF000C32,
-0xFF07193D,
-0xFF021438,
-0xFF000D31,
-0xFF020F39,
-0xFF020D3A,
-0xFF192241,
-0xFFF6FFFF,
-0xFFF8FFFF,
-0xFF646E92,
-0xFF020C3F,
-0xFF000833,
-0xFFD9E0FC,
-0xFFFCFFFF,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFCFD,
-0xFFFFFFFD,
-0xFFFEFFFA,
-0xFFF6FDFF,
-0xFF091337,
-0xFF05123F,
-0xFF3F4869,
-0xFFF8FDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFF9FFFF,
-0xFFE3FFFF,
-0xFF69AAC6,
-0xFF3E9DC9,
-0xFF62B4DA,
-0xFFEDFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFF2FFFF,
-0xFF9FDFFA,
-0xFF4698BD,
-0xFF4993BA,
-0xFFCBFFFF,
-0xFFF0FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFD9F5FF,
-0xFF3F96C1,
-0xFF37A5DA,
-0xFF5EBBE7,
-0xFF75C8F0,
-0xFF77C4EE,
-0xFF7CC7EE,
-0xFF76C5E6,
-0xFF76C5E6,
-0xFF7AC2EA,
-0xFF7AC1EB,
-0xFF78C3EB,
-0xFF79C5E9,
-0xFF7DC3E5,
-0xFF7EC2E5,
-0xFF78C0E6,
-0xFF77C2E9,
-0xFF79C9EC,
-0xFF77C2E1,
-0xFF7DBBD4,
-0xFFCFF9FF,
-0xFFF0FFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFA,
-0xFFFAFDF6,
-0xFFFCFFFF,
-0xFFFBFEFF,
-0xFFFBFDFF,
-0xFF000527,
-0xFF061742,
-0xFF25375B,
-0xFFF7FFFF,
-0xFFFDFFFC,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFEFD,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFEF9FD,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFAFFFB,
-0xFFF4FDFF,
-0xFF9AA7C7,
-0xFF000C36,
-0xFF030D31,
-0xFFB4BAD4,
-0xFFFEFEFF,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFBFFFF,
-0xFF767F9E,
-0xFF060F38,
-0xFF00082D,
-0xFFD0D4ED,
-0xFFFEFEFF,
-0xFFFFFFFD,
-0xFFFCFEFD,
-0xFFFFFFFF,
-0xFFFEFCFD,
-0xFFFFFDFE,
-0xFFFCFFFF,
-0xFFFBFFFC,
-0xFFFFFDFA,
-0xFFFFFEFF,
-0xFF9DA2C2,
-0xFF020B36,
-0xFF040D34,
-0xFFA2A9C6,
-0xFFFBFDFF,
-0xFFFCFEFF,
-0xFF4F5875,
-0xFF081538,
-0xFF000428,
-0xFFE6EDFF,
-0xFFF9FFFF,
-0xFFFBFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFEFEFE,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFF7FCF8,
-0xFFF9FFFF,
-0xFF9DA5B8,
-0xFF050E39,
-0xFF000733,
-0xFFC3CADD,
-0xFFFBFFFF,
-0xFFFCFEFD,
-0xFFFCFEFF,
-0xFF444D74,
-0xFF050F40,
-0xFF02062B,
-0xFFFAFCFF,
-0xFFFCFFFF,
-0xFFFEFFFA,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFEFFF8,
-0xFFFCFFFB,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFF9FEFF,
-0xFF030C2B,
-0xFF011341,
-0xFF263961,
-0xFFF9FFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFDFDFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFCDD2E6,
-0xFF000834,
-0xFF04113E,
-0xFF7D849E,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFAAB0C0,
-0xFF000A31,
-0xFF041646,
-0xFF3D507A,
-0xFF69799D,
-0xFF6A7595,
-0xFF6B7493,
-0xFF6A7593,
-0xFF687595,
-0xFF6B7495,
-0xFF6B7397,
-0xFF6A739A,
-0xFF6A7498,
-0xFF6C7797,
-0xFF6A7591,
-0xFF6C7691,
-0xFF69728F,
-0xFF6E7C99,
-0xFF687595,
-0xFF697291,
-0xFF9A9EB7,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFF3FFFF,
-0xFF112444,
-0xFF001640,
-0xFF02143A,
-0xFFF9FFFF,
-0xFFFCFCFC,
-0xFFFCFFFD,
-0xFFFBFFFB,
-0xFFFBFFFB,
-0xFFFCFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFF505C74,
-0xFF0A1241,
-0xFF000130,
-0xFFF1F3FF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF5FEFF,
-0xFF04122D,
-0xFF04163E,
-0xFF223152,
-0xFFFBFFFF,
-0xFFFFFFFB,
-0xFFFCFDF8,
-0xFFFEFFFB,
-0xFFFCFFFD,
-0xFFD8E0EB,
-0xFF000B32,
-0xFF021245,
-0xFF2B3966,
-0xFF707EA5,
-0xFF697696,
-0xFF697792,
-0xFF6C7594,
-0xFF6C7596,
-0xFF6C7498,
-0xFF6C7499,
-0xFF6B749B,
-0xFF69759B,
-0xFF687598,
-0xFF697897,
-0xFF667793,
-0xFF64758F,
-0xFF697993,
-0xFF6B7996,
-0xFF646C90,
-0xFF7E849E,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFF6D779B,
-0xFF000C3C,
-0xFF000731,
-0xFFD3DFF9,
-0xFFFBFFFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFFDFFFC,
-0xFFF9FFFF,
-0xFF020E36,
-0xFF000B3B,
-0xFF444C70,
-0xFFF8FDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE6FFFF,
-0xFF72B1D0,
-0xFF3EA0D1,
-0xFF4DA1CD,
-0xFFEAFFFF,
-0xFFFFFFFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFFE1FFFF,
-0xFF68AACA,
-0xFF3E9CD0,
-0xFF62B3E0,
-0xFFEBFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFD,
-0xFFFBFFFD,
-0xFFFFFFFF,
-0xFFF0FFFF,
-0xFF9FDFFB,
-0xFF4898BD,
-0xFF4A92B8,
-0xFFCDFFFF,
-0xFFF4FFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFE4FEFF,
-0xFF3A91BE,
-0xFF38A1D1,
-0xFF8CD7F4,
-0xFFD6FFFF,
-0xFFE7FFFF,
-0xFFE8FFFF,
-0xFFE7FFFF,
-0xFFE9FFFF,
-0xFFEDFFFF,
-0xFFF0FFFF,
-0xFFEEFFFF,
-0xFFEEFFFF,
-0xFFEDFFFF,
-0xFFEDFFFF,
-0xFFEDFFFF,
-0xFFEEFFFF,
-0xFFEFFFFF,
-0xFFF1FFFF,
-0xFFF0FFFF,
-0xFFF0FFFF,
-0xFFFEFFFF,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFEFFFA,
-0xFFFEFFFA,
-0xFFFCFFFF,
-0xFFFAFDFF,
-0xFFF7F9FF,
-0xFF1E2446,
-0xFF061340,
-0xFF09173E,
-0xFFF6FCFF,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFCFD,
-0xFFFDFCFA,
-0xFFFBFDFA,
-0xFFFCFFFD,
-0xFFFAFEFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFBFA,
-0xFFFFFEFA,
-0xFFFCFFFB,
-0xFFF8FFFF,
-0xFF637293,
-0xFF04133E,
-0xFF00082E,
-0xFFB5BCD6,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFF7FEFF,
-0xFF7A83A2,
-0xFF030C35,
-0xFF070C32,
-0xFFC1C5E0,
-0xFFFEFEFF,
-0xFFFFFFFD,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFF8589AE,
-0xFF070F3D,
-0xFF010A31,
-0xFFA8AFCB,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFF79839E,
-0xFF000C2F,
-0xFF050D34,
-0xFFAEB3D1,
-0xFFFBFEFF,
-0xFFFEFEFC,
-0xFFFEFEFC,
-0xFFFEFEFC,
-0xFFFFFEFC,
-0xFFFFFDFE,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFAFD,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFF6FEFF,
-0xFF5B6580,
-0xFF071240,
-0xFF000936,
-0xFFC0CBDF,
-0xFFF6FFFF,
-0xFFFCFFFB,
-0xFFFBFFFF,
-0xFF465171,
-0xFF060F38,
-0xFF000324,
-0xFFFBFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFAFCFF,
-0xFF050C28,
-0xFF061745,
-0xFF283A62,
-0xFFFAFDFF,
-0xFFFEFEFC,
-0xFFFFFFFB,
-0xFFFCFDF8,
-0xFFFFFEFC,
-0xFFFFFEFC,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFDFAFF,
-0xFFCDCFE4,
-0xFF000734,
-0xFF01103B,
-0xFF838EA2,
-0xFFF4FDFF,
-0xFFF9FEFF,
-0xFFCCD2E0,
-0xFF020E36,
-0xFF010F40,
-0xFF6A769C,
-0xFFF7FEFF,
-0xFFFCFEFF,
-0xFFFEFEFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF5FDFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFCFCFF,
-0xFFF9FCFF,
-0xFFFAFDFF,
-0xFFFCFDFF,
-0xFFFFFDFF,
-0xFFFFFDFE,
-0xFFFFFFFF,
-0xFFF6FFFF,
-0xFF162743,
-0xFF031847,
-0xFF0B1C47,
-0xFFF3F9FF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFF7FFFF,
-0xFF545F71,
-0xFF081037,
-0xFF01062E,
-0xFFF1F4FF,
-0xFFFEFFFF,
-0xFFFDFCFF,
-0xFFFEFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF5FDFF,
-0xFF041133,
-0xFF061540,
-0xFF233053,
-0xFFFCFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFD,
-0xFFFBFFFF,
-0xFF010937,
-0xFF040F45,
-0xFF344068,
-0xFFF5FEFF,
-0xFFF9FEFF,
-0xFFFBFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFEFDFF,
-0xFFFEFDFF,
-0xFFFCFEFF,
-0xFFF9FDFF,
-0xFFF9FFFF,
-0xFFF8FEFF,
-0xFFF7FDFF,
-0xFFF9FEFF,
-0xFFFBFCFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFF989EBE,
-0xFF030F37,
-0xFF000F33,
-0xFF96A4BE,
-0xFFF6FDFF,
-0xFFFEFFFB,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFB,
-0xFFFEFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFA,
-0xFFFEFFFD,
-0xFFFAFBFF,
-0xFFE3E8FE,
-0xFF000738,
-0xFF0B174B,
-0xFF40486C,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFF7FFFF,
-0xFFE4FFFF,
-0xFF71B2D2,
-0xFF3CA0D1,
-0xFF4BA2CD,
-0xFFEBFFFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFF4FFFF,
-0xFFDFFFFF,
-0xFF68AACC,
-0xFF409BD2,
-0xFF64B2E2,
-0xFFEBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFD,
-0xFFFBFFFD,
-0xFFFEFFFF,
-0xFFF0FFFF,
-0xFFA1DEFD,
-0xFF4997BE,
-0xFF4A93B6,
-0xFFCDFFFF,
-0xFFF4FFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFDFC,
-0xFFEDFFFF,
-0xFF54A6CE,
-0xFF3EA0CD,
-0xFF61ABC6,
-0xFFDCFFFF,
-0xFFF4FFFF,
-0xFFFEFEFC,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF4FCFF,
-0xFFFEFFFF,
-0xFFFFFEFB,
-0xFFFFFCFC,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFEEFFFF,
-0xFFEAFFFF,
-0xFFEBFFFF,
-0xFFF0FFFF,
-0xFFF7FFFF,
-0xFFF8FEFE,
-0xFFFCFFFD,
-0xFFFDFFFA,
-0xFFFCFDFF,
-0xFFFEFEFF,
-0xFFFEFDFF,
-0xFF646786,
-0xFF06113F,
-0xFF000532,
-0xFFC2C7DD,
-0xFFFFFDFF,
-0xFFFFFAFE,
-0xFFFFFBFE,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFDFBFE,
-0xFFFFFDFF,
-0xFFFEFCFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF6FEFF,
-0xFF07163D,
-0xFF061846,
-0xFF020E34,
-0xFFB3BBD2,
-0xFFF9FCFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFF919AB7,
-0xFF040D34,
-0xFF030B32,
-0xFFA3A8C6,
-0xFFFBFEFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFEFC,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFF9F8FF,
-0xFF63688E,
-0xFF020D3B,
-0xFF000B33,
-0xFFA3ADC8,
-0xFFFBFEFF,
-0xFFF9FCFF,
-0xFFC2CADF,
-0xFF000A2D,
-0xFF09123D,
-0xFF474C72,
-0xFFFCFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFEFE,
-0xFFFCFFFD,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFF071135,
-0xFF0B154A,
-0xFF000836,
-0xFFC0CDE0,
-0xFFF6FFFF,
-0xFFFCFFFB,
-0xFFF8FDFF,
-0xFF45506E,
-0xFF07133B,
-0xFF000326,
-0xFFFCFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFEFF,
-0xFF070E2A,
-0xFF011240,
-0xFF273661,
-0xFFF9FFFF,
-0xFFFDFEF9,
-0xFFFFFFF7,
-0xFFFFFFF8,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFDFCF7,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFCBCCE1,
-0xFF020E38,
-0xFF000D37,
-0xFF7E8B9C,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFF060F36,
-0xFF071142,
-0xFF0B123C,
-0xFFF8FCFF,
-0xFFFDFDFF,
-0xFFFEFEFC,
-0xFFFDFFFA,
-0xFFFDFFFA,
-0xFFFEFEFF,
-0xFFFDFEFF,
-0xFFFBFFFC,
-0xFFFAFFFC,
-0xFFFBFFFF,
-0xFFF8FDFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFB8BAC9,
-0xFFB3B4C8,
-0xFFADACBE,
-0xFFFCF9FF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFF132440,
-0xFF001443,
-0xFF071843,
-0xFFF9FEFF,
-0xFFFDFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFF9FFFF,
-0xFF535B70,
-0xFF080F39,
-0xFF02072F,
-0xFFF0F3FF,
-0xFFFBFCFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFF5FDFF,
-0xFF041134,
-0xFF061441,
-0xFF232F55,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFBFDFF,
-0xFF252A52,
-0xFF0C1445,
-0xFF000631,
-0xFFF7FEFF,
-0xFFFCFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFDFD,
-0xFFFFFCFF,
-0xFFFFFBFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFDFCFA,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFBABCC9,
-0xFF9497A8,
-0xFF8C8FA0,
-0xFFE2E4F1,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFDBE1FB,
-0xFF000628,
-0xFF09193B,
-0xFF394963,
-0xFFF5FFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFB,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFF8A90B0,
-0xFF010D3F,
-0xFF021041,
-0xFF3F4A68,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFFFFFA,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFDFDFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFFDFFFA,
-0xFFFEFFFD,
-0xFFF4FFFF,
-0xFFE4FFFF,
-0xFF6EB0D0,
-0xFF399FD0,
-0xFF4CA5D1,
-0xFFECFFFF,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF0FFFF,
-0xFFE2FFFF,
-0xFF67A6C9,
-0xFF459AD1,
-0xFF65AFDE,
-0xFFEBFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFDFCF8,
-0xFFFFFFFD,
-0xFFFDFFFC,
-0xFFFEFFFF,
-0xFFEEFFFF,
-0xFFA2DDFF,
-0xFF4D98C0,
-0xFF458EB1,
-0xFFCEFFFF,
-0xFFF0FFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFDFC,
-0xFFFFFCFD,
-0xFFF1FFFF,
-0xFF8ED0F0,
-0xFF3E9AC1,
-0xFF3F97BB,
-0xFFB4F6FF,
-0xFFEDFFFF,
-0xFFFCFEFD,
-0xFFFFFFFF,
-0xFFFAFAFA,
-0xFFFFFFFD,
-0xFFFCFCFC,
-0xFFFAFDFF,
-0xFFFEFEFF,
-0xFFFFFCFB,
-0xFFFEFFFF,
-0xFFEBFFFF,
-0xFFD8FFFF,
-0xFFA9E0FE,
-0xFFACDEF7,
-0xFFD4ECF8,
-0xFFFBFFFF,
-0xFFFFFDFE,
-0xFFFFFDFD,
-0xFFFDFDFF,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFFE5FFFF,
-0xFF7FC0DC,
-0xFF4597BC,
-0xFF4496BC,
-0xFF7ABDDA,
-0xFFE2FFFF,
-0xFFF2FFFF,
-0xFFF9FFFF,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFEF9FF,
-0xFFD7D5EA,
-0xFF000837,
-0xFF030F41,
-0xFF2C3350,
-0xFFFBFEFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFDFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFDFDFD,
-0xFFFDFEFF,
-0xFFFDFDFF,
-0xFF99A0BA,
-0xFF000E3D,
-0xFF02194B,
-0xFF021033,
-0xFFB1B9CC,
-0xFFFEFEFF,
-0xFFFFFEFB,
-0xFFFAF8FD,
-0xFFFEFDFF,
-0xFFC2C8E2,
-0xFF01092D,
-0xFF020B32,
-0xFF616A89,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFEFEFC,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFEFD,
-0xFFFEFDFB,
-0xFFFBFCFF,
-0xFFF9FEFF,
-0xFF08143C,
-0xFF0A1849,
-0xFF000D39,
-0xFF9EA9C7,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFF6FCFF,
-0xFF0C1631,
-0xFF05123F,
-0xFF000835,
-0xFFE1E3FA,
-0xFFFCFBFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFCFCFA,
-0xFFFCFFFD,
-0xFFF8FFFF,
-0xFF848DAA,
-0xFF030E3C,
-0xFF0D1752,
-0xFF000536,
-0xFFC1C9DC,
-0xFFF6FEFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFF475476,
-0xFF05123E,
-0xFF00032B,
-0xFFFBFCFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFF030E2A,
-0xFF011144,
-0xFF2B3A65,
-0xFFF5FDFF,
-0xFFFEFFFA,
-0xFFFFFEF9,
-0xFFFFFEFA,
-0xFFFEFDFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFCDCEE2,
-0xFF00042F,
-0xFF06133D,
-0xFF848C9F,
-0xFFF6FFFF,
-0xFFF9FFFF,
-0xFFF6FFFF,
-0xFF5A6082,
-0xFF050C3A,
-0xFF030A38,
-0xFF989EC2,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFFFB,
-0xFFF9FEFA,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFEFC,
-0xFFFEFFFA,
-0xFFFBFFFB,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFDCE2F8,
-0xFF000320,
-0xFF000928,
-0xFF131732,
-0xFFFEFBFF,
-0xFFFFFCFF,
-0xFFFEFDFF,
-0xFFF5FFFF,
-0xFF122742,
-0xFF001740,
-0xFF051840,
-0xFFF9FFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFF515A79,
-0xFF0B1047,
-0xFF000033,
-0xFFEEF3FF,
-0xFFFCFFFF,
-0xFFFDFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFF6FEFF,
-0xFF041334,
-0xFF051342,
-0xFF212F56,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFEFBFF,
-0xFFFFFDFF,
-0xFFFCFEFF,
-0xFF9197B1,
-0xFF020A2F,
-0xFF050D3E,
-0xFF60658F,
-0xFFFBFEFF,
-0xFFFEFFFF,
-0xFFFCFDF5,
-0xFFFFFFF8,
-0xFFFFFEFD,
-0xFFFFFAFE,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFEF9,
-0xFFFFFFFB,
-0xFFFEFEFF,
-0xFFF9FAFF,
-0xFF030627,
-0xFF04082B,
-0xFF00031B,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF8FFFF,
-0xFF222D4D,
-0xFF051338,
-0xFF000C2D,
-0xFFCDDAED,
-0xFFF7FFFF,
-0xFFFCFFFF,
-0xFFFEFFFA,
-0xFFFFFFFD,
-0xFFFCFAFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFF9FBFA,
-0xFFFBFFFF,
-0xFFF8FFFD,
-0xFFF3FFFF,
-0xFFF4FFFF,
-0xFF07143E,
-0xFF081643,
-0xFF021138,
-0xFF404F66,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFAFCF9,
-0xFFF5FFFF,
-0xFFE3FFFF,
-0xFF73B5D7,
-0xFF399FD0,
-0xFF4BA4D0,
-0xFFEBFFFF,
-0xFFFFFBFC,
-0xFFFFFAFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFEFD,
-0xFFFCFFFF,
-0xFFF2FFFF,
-0xFFE2FFFF,
-0xFF69A8CB,
-0xFF459AD0,
-0xFF68B2DF,
-0xFFE9FFFF,
-0xFFFEFFFB,
-0xFFFFFEFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF9FDFE,
-0xFFEDFFFF,
-0xFFA1DDFF,
-0xFF4693BD,
-0xFF4A93B6,
-0xFFCEFFFF,
-0xFFEEFFFF,
-0xFFF8FEFC,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFBFB,
-0xFFF8FFFF,
-0xFFD9FFFF,
-0xFF4994B4,
-0xFF449FCC,
-0xFF53A2CB,
-0xFFDEFFFF,
-0xFFF0FFFF,
-0xFFF9FFFF,
-0xFFFFFFFF,
-0xFFFCFCFA,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FEFF,
-0xFFF9FDFF,
-0xFFF2FFFF,
-0xFFDDFFFF,
-0xFF69ABCB,
-0xFF4290B7,
-0xFF4486A8,
-0xFFD8F4FF,
-0xFFF8FDFF,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFFFF,
-0xFFF4FFFF,
-0xFFEAFFFF,
-0xFF75ABC3,
-0xFF3E99C5,
-0xFF38A7DC,
-0xFF37A6DD,
-0xFF3D9CC8,
-0xFF70AAC2,
-0xFFE7FFFF,
-0xFFF2FFFF,
-0xFFFCFDFF,
-0xFFFDFCFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFDFBFF,
-0xFF2E335B,
-0xFF0D1846,
-0xFF01092D,
-0xFF848CA3,
-0xFFFBFEFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFBFBFD,
-0xFFFFFEFC,
-0xFFFDFCFA,
-0xFFFFFFFB,
-0xFFFDFFFE,
-0xFFFCFFFF,
-0xFFFCFEFF,
-0xFFEBEDFF,
-0xFF030B30,
-0xFF03194B,
-0xFF041B4D,
-0xFF00092C,
-0xFFB7BED0,
-0xFFFFFFFF,
-0xFFFFFDFC,
-0xFFFFFDFF,
-0xFFFBF9FF,
-0xFFF8FDFF,
-0xFF010A29,
-0xFF0E1A42,
-0xFF010E31,
-0xFFF5FFFF,
-0xFFF7FEFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFBFAFF,
-0xFFFFFEFF,
-0xFFFDFBFC,
-0xFFFFFEFF,
-0xFFFBFEFF,
-0xFFA0A7C3,
-0xFF000B38,
-0xFF021245,
-0xFF000B36,
-0xFFA8B3D1,
-0xFFF7FEFF,
-0xFFF9FDFC,
-0xFFFBFFFF,
-0xFF8E95A8,
-0xFF010E3A,
-0xFF091643,
-0xFF171E3B,
-0xFFF5FAFF,
-0xFFFCFEFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFDCE5F4,
-0xFF050F33,
-0xFF091346,
-0xFF07124A,
-0xFF040F3D,
-0xFFC6CFE0,
-0xFFFBFFFF,
-0xFFFBFCFE,
-0xFFF9FFFF,
-0xFF404E71,
-0xFF04113D,
-0xFF00032B,
-0xFFFBFCFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFDFB,
-0xFFFFFDFB,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF6FFFF,
-0xFF000C2C,
-0xFF071448,
-0xFF2D3A67,
-0xFFF8FFFF,
-0xFFFAFCF7,
-0xFFFFFDFA,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFDFDFD,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFCECFE3,
-0xFF000833,
-0xFF000C36,
-0xFF83899F,
-0xFFF7FEFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFE2E8FF,
-0xFF01062C,
-0xFF111545,
-0xFF000431,
-0xFFE3EBFF,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFBFCFF,
-0xFFFFFFFD,
-0xFFFAFCF7,
-0xFFF6FFFA,
-0xFFF7FFFF,
-0xFFF6FDFF,
-0xFF232B4F,
-0xFF08143A,
-0xFF00072A,
-0xFFADB2CF,
-0xFFFEFDFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFF5FFFF,
-0xFF0D223D,
-0xFF001840,
-0xFF04183D,
-0xFFF8FEFF,
-0xFFFBFAFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFCFFFD,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFF51597D,
-0xFF070C46,
-0xFF02053A,
-0xFFF0F5FF,
-0xFFFCFFFF,
-0xFFFEFEFC,
-0xFFFFFFFD,
-0xFFFEFDFB,
-0xFFFEFFFF,
-0xFFF6FEFF,
-0xFF000D2F,
-0xFF071546,
-0xFF202D57,
-0xFFF7FFFF,
-0xFFF7FDF9,
-0xFFFCFCFE,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFAFAFF,
-0xFFF9FFFF,
-0xFF040B27,
-0xFF111747,
-0xFF000735,
-0xFFB7BDD5,
-0xFFF9FDFF,
-0xFFFCFFFD,
-0xFFFAFDF6,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFDFFFC,
-0xFFFAFEFF,
-0xFFF9FEFF,
-0xFF4B506E,
-0xFF0C0F3A,
-0xFF060B33,
-0xFF7B829C,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFF7FDFF,
-0xFFAFB9D4,
-0xFF00092B,
-0xFF071538,
-0xFF13213E,
-0xFFF1FCFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF4FFFF,
-0xFF445277,
-0xFF061445,
-0xFF0B194A,
-0xFF04133A,
-0xFF3F4E65,
-0xFFF5FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFF9FBFA,
-0xFFFCFFFF,
-0xFFF1FFFF,
-0xFFE3FFFF,
-0xFF71B1D5,
-0xFF399DCF,
-0xFF4CA5CF,
-0xFFE4FFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFDF5FF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFEFA,
-0xFFF5FFFF,
-0xFFDDFFFF,
-0xFF66ABCC,
-0xFF419DD0,
-0xFF60B1DE,
-0xFFE6FFFF,
-0xFFFAFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFBFFFF,
-0xFFF7FFFF,
-0xFFF8FEFE,
-0xFFEDFFFF,
-0xFF9FDFFF,
-0xFF4899C4,
-0xFF4A92BA,
-0xFFCFFFFF,
-0xFFF0FFFF,
-0xFFFCFFFF,
-0xFFF8FEFA,
-0xFFFAFFF9,
-0xFFFFFFFB,
-0xFFFBFFFF,
-0xFFEDFFFF,
-0xFFA9D6F3,
-0xFF4595CA,
-0xFF3F98D0,
-0xFF5DA5CB,
-0xFFD9FFFF,
-0xFFEDFFFF,
-0xFFF5FFFF,
-0xFFFBFFFF,
-0xFFF9FFFD,
-0xFFFAFFFE,
-0xFFF6FFFF,
-0xFFF0FFFF,
-0xFFDEFFFF,
-0xFF69B3DA,
-0xFF3E94C3,
-0xFF4799C8,
-0xFF89C5E7,
-0xFFF0FFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFF0FFFF,
-0xFFC9FBFF,
-0xFF4290B7,
-0xFF41A4DB,
-0xFF35A5E4,
-0xFF32A5E4,
-0xFF3DA5DC,
-0xFF418FB3,
-0xFFC0F3FF,
-0xFFF0FFFF,
-0xFFFCFFFF,
-0xFFFCFDFF,
-0xFFFFFEFF,
-0xFFFCFBFF,
-0xFFFBFDFF,
-0xFFEEF4FF,
-0xFF000322,
-0xFF0B1338,
-0xFF00072B,
-0xFF7C85A4,
-0xFFEEF9FF,
-0xFFF7FFFF,
-0xFFF8FFFD,
-0xFFFAFFF9,
-0xFFFCFFFB,
-0xFFFAFEFF,
-0xFFFBFFFF,
-0xFFF8FDFF,
-0xFFD5DAF8,
-0xFF090E38,
-0xFF0A1445,
-0xFF031749,
-0xFF051A47,
-0xFF020F32,
-0xFFB4B9CF,
-0xFFFDFCFF,
-0xFFFEFAFB,
-0xFFFFFDFF,
-0xFFFEFEFF,
-0xFFF9FFFF,
-0xFF515B74,
-0xFF010D37,
-0xFF05103E,
-0xFF4A5277,
-0xFFF8FEFF,
-0xFFFBFDFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFFBFFFF,
-0xFFF9FCFF,
-0xFFD5DAFA,
-0xFF020A38,
-0xFF0B184D,
-0xFF0A1A4D,
-0xFF000A31,
-0xFFA4AEC9,
-0xFFFAFCFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFF20294A,
-0xFF000D37,
-0xFF05133A,
-0xFF21304F,
-0xFFEFFCFF,
-0xFFF5FDFF,
-0xFFFBFFFF,
-0xFFF7FBFA,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFF9FEFF,
-0xFFF8FFFF,
-0xFFD8E3F9,
-0xFF041131,
-0xFF07153C,
-0xFF061340,
-0xFF0A1849,
-0xFF000931,
-0xFFBFC6D6,
-0xFFFAFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFF424F6F,
-0xFF051139,
-0xFF03072C,
-0xFFFAFAFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFEFB,
-0xFFFFFDFD,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFF040E31,
-0xFF051046,
-0xFF2D3866,
-0xFFF5FDFF,
-0xFFFEFFFD,
-0xFFFFFDFD,
-0xFFFFFCFC,
-0xFFFFFFFD,
-0xFFFDFFFE,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFCDCDE5,
-0xFF030A38,
-0xFF060E3D,
-0xFF8589A6,
-0xFFFBFFFF,
-0xFFF9FFFB,
-0xFFF8FFFC,
-0xFFF8FFFF,
-0xFF757C98,
-0xFF030737,
-0xFF121548,
-0xFF060B31,
-0xFFCED4EC,
-0xFFF5FEFF,
-0xFFF9FFFF,
-0xFFF4F9FC,
-0xFFFBFFFF,
-0xFFFAFFF9,
-0xFFFBFFFD,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFF333661,
-0xFF05083B,
-0xFF08113A,
-0xFF394261,
-0xFFF5FAFF,
-0xFFFEFEFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFF162840,
-0xFF011740,
-0xFF07193F,
-0xFFFAFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFF6FEFF,
-0xFF545B78,
-0xFF0A0D42,
-0xFF020435,
-0xFFEFF5FF,
-0xFFFBFFFE,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFDFBFC,
-0xFFFEFEFF,
-0xFFF3F9FF,
-0xFF081236,
-0xFF091549,
-0xFF222F5B,
-0xFFF7FFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFCFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFAFB8C9,
-0xFF00052A,
-0xFF0A113D,
-0xFF000629,
-0xFFA7B1CA,
-0xFFF3FBFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFBFDFC,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFF8FFFF,
-0xFFF5FFFF,
-0xFF4A5573,
-0xFF00082F,
-0xFF0A113B,
-0xFF171D41,
-0xFFF9FEFF,
-0xFFFBFEFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFF7FFFF,
-0xFF45506C,
-0xFF000C2F,
-0xFF050E37,
-0xFF21294E,
-0xFFF2F7FF,
-0xFFFBFEFF,
-0xFFF9FDFF,
-0xFFFEFFFB,
-0xFFF9FEF7,
-0xFFF6FBF5,
-0xFFFBFFFF,
-0xFFF6FDFF,
-0xFFF7FFFF,
-0xFF535C7D,
-0xFF000937,
-0xFF040F47,
-0xFF0B1550,
-0xFF081446,
-0xFF3D476A,
-0xFFF5FDFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFAFE,
-0xFFFFFFFF,
-0xFFF8FFFF,
-0xFFD8F2FF,
-0xFFD0FAFF,
-0xFFCAFFFF,
-0xFF61B0DB,
-0xFF3CA2D3,
-0xFF49AAD5,
-0xFFC9FFFF,
-0xFFD1F2FF,
-0xFFDDF0FF,
-0xFFF8FFFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFDEF2FB,
-0xFFD5FCFF,
-0xFFC7FFFF,
-0xFF54A9CE,
-0xFF3EA3D7,
-0xFF56B2E1,
-0xFFCCFFFF,
-0xFFD6F7FF,
-0xFFDEF2FD,
-0xFFF4FFFF,
-0xFFF4FFFF,
-0xFFE4F8FF,
-0xFFD7F4FF,
-0xFFD0FFFF,
-0xFF83D5FD,
-0xFF43A0CC,
-0xFF4599C5,
-0xFFB0F6FF,
-0xFFCFFDFF,
-0xFFD7F3FF,
-0xFFF5FFFF,
-0xFFFBFFFD,
-0xFFFCFFFB,
-0xFFFBFFFC,
-0xFFFBFFFF,
-0xFFEAFFFF,
-0xFF7BB6E0,
-0xFF4494C7,
-0xFF49A0CB,
-0xFF4998B9,
-0xFFA4DBF0,
-0xFFE0FFFF,
-0xFFE4FFFF,
-0xFFE6FFFF,
-0xFFE7FFFF,
-0xFFE3FFFF,
-0xFFACDFF4,
-0xFF5B9DBD,
-0xFF499DC9,
-0xFF4498C6,
-0xFF6EAFD5,
-0xFFDFFFFF,
-0xFFF2FFFF,
-0xFFFFFFFB,
-0xFFFCFEFD,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFEEFFFF,
-0xFFB2E9FF,
-0xFF4699C5,
-0xFF40A5DD,
-0xFF37A9E8,
-0xFF33A6E7,
-0xFF3AA4DE,
-0xFF4799C1,
-0xFFABE1F9,
-0xFFF0FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFBAC2D5,
-0xFF000728,
-0xFF091239,
-0xFF000A30,
-0xFF253252,
-0xFFA4B4C4,
-0xFFF4FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFDCE2FA,
-0xFF626888,
-0xFF010930,
-0xFF0A1240,
-0xFF000B38,
-0xFF3F507C,
-0xFF03123B,
-0xFF030B2F,
-0xFFB4B8D1,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFDFEFF,
-0xFFF9FFFF,
-0xFFEFF8FF,
-0xFF020C2F,
-0xFF06113E,
-0xFF020A38,
-0xFF393E66,
-0xFFD5D9F4,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFF1FDFF,
-0xFFF8FFFF,
-0xFF8D93AD,
-0xFF090E36,
-0xFF0A1243,
-0xFF031044,
-0xFF091744,
-0xFF000D30,
-0xFFA3ABC2,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFCFCFC,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFF0C1A37,
-0xFF000F36,
-0xFF06183E,
-0xFF000F2E,
-0xFF8392A9,
-0xFFF0FCFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF7FEFF,
-0xFFE0E8FB,
-0xFF6A748F,
-0xFF00082C,
-0xFF030F37,
-0xFF000E33,
-0xFF45547B,
-0xFF061443,
-0xFF000A32,
-0xFFC7CEDE,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFBFEFF,
-0xFF49556F,
-0xFF091336,
-0xFF010626,
-0xFFFAFBFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FEFF,
-0xFF03092D,
-0xFF071144,
-0xFF303964,
-0xFFF6FCFF,
-0xFFFEFFFF,
-0xFFFFFBFC,
-0xFFFFFDFE,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFEFDFF,
-0xFFFFFBFF,
-0xFFD0CDE8,
-0xFF00022F,
-0xFF050C3A,
-0xFF8586A5,
-0xFFFCFEFF,
-0xFFF7FCF8,
-0xFFFBFFFA,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFF42466C,
-0xFF020635,
-0xFF0F143E,
-0xFF040A2C,
-0xFF5A6076,
-0xFFE0E7F7,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFF3F9FF,
-0xFF878DA3,
-0xFF0B0F32,
-0xFF0D0D3F,
-0xFF090B3C,
-0xFF131939,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFAFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFF7FFFF,
-0xFF15233D,
-0xFF03143F,
-0xFF07153C,
-0xFFFBFFFF,
-0xFFFDFBFC,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFF555C76,
-0xFF0D1140,
-0xFF020530,
-0xFFF4F7FF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFDFE,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFF4FAFF,
-0xFF060E33,
-0xFF081247,
-0xFF212D57,
-0xFFF8FFFF,
-0xFFF8FCFB,
-0xFFFDFBFC,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFF737A96,
-0xFF010930,
-0xFF0B143D,
-0xFF030C33,
-0xFF404966,
-0xFFCCD2E8,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFF9EAAC0,
-0xFF0F1D38,
-0xFF061437,
-0xFF09153B,
-0xFF060E32,
-0xFFE7EDFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFF8F8F8,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF5FDFF,
-0xFF151E3D,
-0xFF080F39,
-0xFF09103E,
-0xFF090E36,
-0xFF7B80A0,
-0xFFE9EEFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF4FAFF,
-0xFFA7ADC5,
-0xFF171C3C,
-0xFF0A0F35,
-0xFF060D3B,
-0xFF394074,
-0xFF0A134C,
-0xFF030D40,
-0xFF454D72,
-0xFFF6FCFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFEDFFFF,
-0xFF4489B0,
-0xFF3696C9,
-0xFF2F99CD,
-0xFF3CAADF,
-0xFF39A8DD,
-0xFF34A4D4,
-0xFF33A0C7,
-0xFF3C99B8,
-0xFF599AB0,
-0xFFE2FFFF,
-0xFFF2FFFF,
-0xFFEBFFFF,
-0xFF4C90B5,
-0xFF3595C5,
-0xFF329CCE,
-0xFF36A8DC,
-0xFF34A7DE,
-0xFF38A7DE,
-0xFF3A9CCD,
-0xFF4092BA,
-0xFF669FBD,
-0xFFE0FFFF,
-0xFFE5FFFF,
-0xFF9BC6D9,
-0xFF408FB8,
-0xFF359AD0,
-0xFF37A5DA,
-0xFF33A7D8,
-0xFF33A8D4,
-0xFF32A2D0,
-0xFF2F98C8,
-0xFF3E89B1,
-0xFFCCEBFD,
-0xFFF6FFFF,
-0xFFFBFFFF,
-0xFFF7FCF8,
-0xFFFFFFFB,
-0xFFF9FFFF,
-0xFFEBFFFF,
-0xFF91C5DD,
-0xFF3E92B7,
-0xFF42A4D1,
-0xFF3B9CC9,
-0xFF3796C2,
-0xFF57B0DC,
-0xFF5CB3DE,
-0xFF54ACD4,
-0xFF4199C1,
-0xFF3E9BC4,
-0xFF49A2CA,
-0xFF4692B6,
-0xFF7FB8D5,
-0xFFE5FFFF,
-0xFFF3FFFF,
-0xFFFCFFFF,
-0xFFFFFEFC,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFF2FFFF,
-0xFFD7FFFF,
-0xFF428AB0,
-0xFF42A3D6,
-0xFF32A3DD,
-0xFF38AAE6,
-0xFF3DA1D5,
-0xFF4B8CB2,
-0xFFD6FCFF,
-0xFFF5FFFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FDFE,
-0xFFFCFFFF,
-0xFFF9FEFF,
-0xFFF6FDFF,
-0xFFC7CDE3,
-0xFF060C2C,
-0xFF040C33,
-0xFF0A133E,
-0xFF000B35,
-0xFF00072F,
-0xFF111E41,
-0xFF121E44,
-0xFF040C3A,
-0xFF000635,
-0xFF060E3D,
-0xFF0C133D,
-0xFF000021,
-0xFFADB8D6,
-0xFF94A0C6,
-0xFF060F36,
-0xFF03072A,
-0xFFB7B9D2,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFEFF,
-0xFFF8FEFC,
-0xFFF8FFFF,
-0xFFC4D0E0,
-0xFF000A28,
-0xFF0C1540,
-0xFF0B1240,
-0xFF00022A,
-0xFF0A0F35,
-0xFF2B345D,
-0xFF1D294F,
-0xFF01092E,
-0xFF060B31,
-0xFF0A1239,
-0xFF030C33,
-0xFF96A4C9,
-0xFF031233,
-0xFF020D29,
-0xFFA7AEC1,
-0xFFFDFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFF9FBFA,
-0xFFF4FEFF,
-0xFFF5FFFF,
-0xFF293452,
-0xFF00042C,
-0xFF0B1844,
-0xFF000B36,
-0xFF00062F,
-0xFF091640,
-0xFF14204A,
-0xFF050E39,
-0xFF030A36,
-0xFF050C38,
-0xFF0A113D,
-0xFF00072E,
-0xFFA0ABC7,
-0xFF98A7C6,
-0xFF000C3D,
-0xFF000936,
-0xFFC3CADD,
-0xFFF7FAFF,
-0xFFFFFFFF,
-0xFFFAFDFF,
-0xFF495166,
-0xFF060F2C,
-0xFF00041F,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFEFF,
-0xFF070A29,
-0xFF0C133F,
-0xFF2F375C,
-0xFFF9FFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFCFEFB,
-0xFFFCFFFD,
-0xFFFEFEFF,
-0xFFFDFCFF,
-0xFFFFFCFF,
-0xFFCFCDE5,
-0xFF02062B,
-0xFF0D1238,
-0xFF8685A4,
-0xFFFDFCFF,
-0xFFFEFFFD,
-0xFFFCFFF8,
-0xFFFCFFFA,
-0xFFF8FDFF,
-0xFFF9FEFF,
-0xFF575C7C,
-0xFF000329,
-0xFF10133C,
-0xFF080D35,
-0xFF00052D,
-0xFF070B38,
-0xFF1C204F,
-0xFF080C3C,
-0xFF000434,
-0xFF090D3D,
-0xFF0E1040,
-0xFF080733,
-0xFF2F3253,
-0xFFF8FFFF,
-0xFFF4FEFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF9FEFF,
-0xFF182140,
-0xFF0A1542,
-0xFF091337,
-0xFFFCFFFF,
-0xFFFDFDF5,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFF585F72,
-0xFF0A0E34,
-0xFF020629,
-0xFFE9EDF8,
-0xFFFEFFFF,
-0xFFFDFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFCFF,
-0xFFF7FCFF,
-0xFF090F31,
-0xFF0C1443,
-0xFF242C53,
-0xFFF8FFFF,
-0xFFFBFFFC,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFDF8,
-0xFFFFFFFA,
-0xFFFCFFFD,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFF8086A6,
-0xFF000632,
-0xFF070D3F,
-0xFF0B1145,
-0xFF000539,
-0xFF000635,
-0xFF151D4B,
-0xFF07133B,
-0xFF00082E,
-0xFF000C33,
-0xFF0A163C,
-0xFF00082B,
-0xFF121B38,
-0xFFEBF2FF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFEFC,
-0xFFFCFFFF,
-0xFFF7FCFF,
-0xFFF6FDFF,
-0xFF3C4161,
-0xFF030832,
-0xFF0B0F3F,
-0xFF080C3C,
-0xFF040835,
-0xFF060B33,
-0xFF282C52,
-0xFF13173D,
-0xFF020532,
-0xFF050833,
-0xFF0E1036,
-0xFF020526,
-0xFF3C4063,
-0xFFF7FCFF,
-0xFF000432,
-0xFF0E1541,
-0xFF3E4562,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFAFFFB,
-0xFFFEFFFD,
-0xFFFDFFFE,
-0xFFEDFFFF,
-0xFF4A8FB8,
-0xFF3898CA,
-0xFF3599CA,
-0xFF3B9DCA,
-0xFF419AC6,
-0xFF3B97C0,
-0xFF369DC0,
-0xFF3B99B5,
-0xFF5D9FB5,
-0xFFDFFFFF,
-0xFFF2FFFF,
-0xFFE8FFFF,
-0xFF579CC3,
-0xFF3A99C9,
-0xFF389AC9,
-0xFF359AC6,
-0xFF3B9CC7,
-0xFF3998C4,
-0xFF3C9BCB,
-0xFF3C8FBB,
-0xFF659DBE,
-0xFFE0FFFF,
-0xFFE8FFFF,
-0xFF97C0D2,
-0xFF3F8EB9,
-0xFF3899CE,
-0xFF3797C7,
-0xFF3C9DC7,
-0xFF3B9EC5,
-0xFF349AC2,
-0xFF37A0CF,
-0xFF3D8CB5,
-0xFFCBEAFF,
-0xFFF9FFFF,
-0xFFF9FCFF,
-0xFFFEFFFF,
-0xFFFFFEFA,
-0xFFFFFFFB,
-0xFFF5FFFC,
-0xFFE9FFFF,
-0xFFB0F0FF,
-0xFF56A9D1,
-0xFF3994C0,
-0xFF3E9DCD,
-0xFF3999CC,
-0xFF3F9FD2,
-0xFF3E9BC7,
-0xFF3D99C2,
-0xFF3E96BE,
-0xFF529EC0,
-0xFFACE4FF,
-0xFFE4FFFF,
-0xFFF4FFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFFFF,
-0xFFF3FEFF,
-0xFFE9FFFF,
-0xFF8BBFD7,
-0xFF4594BB,
-0xFF44A3D3,
-0xFF42A2D2,
-0xFF4294BC,
-0xFF84B6D1,
-0xFFEDFFFF,
-0xFFF4FBFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFBFFFE,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFEFF,
-0xFF5B607E,
-0xFF01062C,
-0xFF020B36,
-0xFF06113F,
-0xFF000D3A,
-0xFF081542,
-0xFF050F40,
-0xFF000B39,
-0xFF00052E,
-0xFF282E4E,
-0xFFDEE5F8,
-0xFFF6FDFF,
-0xFF7F86A2,
-0xFF00001D,
-0xFF020321,
-0xFFB1B2C7,
-0xFFFFFDFF,
-0xFFFEFCFF,
-0xFFFDFCFF,
-0xFFFEFFFF,
-0xFFFBFFFC,
-0xFFF9FFFF,
-0xFFF7FFFF,
-0xFFE4EDFC,
-0xFF29324F,
-0xFF000027,
-0xFF0D123C,
-0xFF050C3A,
-0xFF040C3B,
-0xFF0D1543,
-0xFF040931,
-0xFF03092B,
-0xFF111834,
-0xFFDFE9FF,
-0xFFBAC6E0,
-0xFF00051D,
-0xFF00081B,
-0xFF9FA5B3,
-0xFFFDFDFF,
-0xFFFEFCFF,
-0xFFFEFDFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFF6FFFF,
-0xFFF7FDFF,
-0xFF9096B6,
-0xFF020B32,
-0xFF000B35,
-0xFF061441,
-0xFF04123F,
-0xFF000D39,
-0xFF08143E,
-0xFF030734,
-0xFF01042F,
-0xFF1E2248,
-0xFFCFD4F4,
-0xFFF4FFFF,
-0xFF74829F,
-0xFF031044,
-0xFF000738,
-0xFFCDD2E6,
-0xFFFEFFFF,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFF3B4252,
-0xFF00061B,
-0xFF030619,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFBFF,
-0xFF05071E,
-0xFF000121,
-0xFF202743,
-0xFFFBFFFF,
-0xFFF8F9FB,
-0xFFFFFDFF,
-0xFFFDFBFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFDFDFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFC7C6D8,
-0xFF060A25,
-0xFF00001B,
-0xFF7C7D92,
-0xFFFEFCFF,
-0xFFFEFFFF,
-0xFFFDFFF7,
-0xFFFEFFF8,
-0xFFFCFFFB,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFB7BBD6,
-0xFF141939,
-0xFF01052B,
-0xFF080C39,
-0xFF090D3D,
-0xFF090F43,
-0xFF080D44,
-0xFF080E42,
-0xFF030737,
-0xFF050831,
-0xFF9898BA,
-0xFFFCFDFF,
-0xFFF7FCFF,
-0xFFF9FFFD,
-0xFFF8FEFC,
-0xFFFBFFFE,
-0xFFFEFCFD,
-0xFFFFFEFF,
-0xFFF9FCFF,
-0xFF0B1129,
-0xFF00082D,
-0xFF040B28,
-0xFFFCFDFF,
-0xFFFFFFF7,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFF444A58,
-0xFF020524,
-0xFF020621,
-0xFFF1F4FB,
-0xFFFBFDFA,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFDFBFF,
-0xFFF8FBFF,
-0xFF00041E,
-0xFF02082C,
-0xFF19203D,
-0xFFF4FBFF,
-0xFFFCFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFC,
-0xFFFFFFFB,
-0xFFFBFFFA,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFD5D8F9,
-0xFF2A2D58,
-0xFF000031,
-0xFF050A41,
-0xFF050F44,
-0xFF061041,
-0xFF081541,
-0xFF010F36,
-0xFF000A30,
-0xFF000A2D,
-0xFF79809C,
-0xFFF6FBFF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFBFBFD,
-0xFFFFFDFF,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFDFEF9,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FDFF,
-0xFF9BA0BE,
-0xFF0F143A,
-0xFF000531,
-0xFF070E3C,
-0xFF09103E,
-0xFF070B38,
-0xFF0C103F,
-0xFF0B0D3D,
-0xFF050833,
-0xFF0D0E2C,
-0xFF8B8DA4,
-0xFFF9FEFF,
-0xFFF5FBFF,
-0xFF000724,
-0xFF000421,
-0xFF363C52,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFAFAFF,
-0xFFFBFFFF,
-0xFFF8FFFB,
-0xFFF8FFFA,
-0xFFFAFFFA,
-0xFFF5FFFF,
-0xFFC9E6F6,
-0xFFC5EBFF,
-0xFFC3EEFF,
-0xFFC0EAFF,
-0xFFC7EAFF,
-0xFFC7E9FF,
-0xFFC4ECF6,
-0xFFC9EEF6,
-0xFFCDE5F1,
-0xFFF4FFFF,
-0xFFFAFDFF,
-0xFFFBFFFF,
-0xFFCADFF0,
-0xFFC6E7FA,
-0xFFC6EDFC,
-0xFFC5F1FE,
-0xFFC0EEFD,
-0xFFBFECFF,
-0xFFC2ECFF,
-0xFFC7EBFF,
-0xFFD6EBFC,
-0xFFF3FFFF,
-0xFFF8FFFF,
-0xFFE3F2F9,
-0xFFCBEAFC,
-0xFFC3EBFF,
-0xFFC1EAFF,
-0xFFC7EDFF,
-0xFFC4E9FC,
-0xFFC6ECFF,
-0xFFC2F1FF,
-0xFFBFE4F4,
-0xFFEEFCFF,
-0xFFFDFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFF8F9FB,
-0xFFF9FFFD,
-0xFFF4FFFF,
-0xFFEEFFFF,
-0xFFE8FFFF,
-0xFFD4F7FF,
-0xFFA3CFEA,
-0xFF83BBE0,
-0xFF75AFD4,
-0xFF88BBD6,
-0xFFA6D4E4,
-0xFFCAF0FD,
-0xFFE9FFFF,
-0xFFEEFFFF,
-0xFFF2FFFF,
-0xFFFAFEFF,
-0xFFFFFFFB,
-0xFFFAFCF9,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFF7FDFD,
-0xFFF8FFFF,
-0xFFEEFFFF,
-0xFFA3D3E9,
-0xFF6EABCA,
-0xFF6FACCB,
-0xFFA4D6ED,
-0xFFEBFFFF,
-0xFFF5FFFF,
-0xFFF8FFFF,
-0xFFFCFFFF,
-0xFFFDFFFE,
-0xFFFEFDFB,
-0xFFFFFFFA,
-0xFFFFFDF8,
-0xFFFFFFFB,
-0xFFFCFCFA,
-0xFFFFFFFF,
-0xFFFAFBFF,
-0xFFFEFEFF,
-0xFFFAFDFF,
-0xFFA1A7BD,
-0xFF646B87,
-0xFF3C4564,
-0xFF374260,
-0xFF48536F,
-0xFF7F8AA0,
-0xFFD7E0EF,
-0xFFF8FFFF,
-0xFFF8FBFF,
-0xFFFBFEFF,
-0xFFDBDFEB,
-0xFFC0C3D4,
-0xFFC0C1D3,
-0xFFEDECFC,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFD,
-0xFFF6FFFC,
-0xFFF7FFFF,
-0xFFD4DDEE,
-0xFF777E9B,
-0xFF42486C,
-0xFF2B3155,
-0xFF303656,
-0xFF666A83,
-0xFFAEB1C2,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFEAF4FF,
-0xFFB7C1CD,
-0xFFBAC2CD,
-0xFFE5E9F2,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFF61657E,
-0xFF697293,
-0xFF636989,
-0xFFF9FBFF,
-0xFFFBFCFF,
-0xFFF9FFFF,
-0xFFB9C2D3,
-0xFF6D788E,
-0xFF3A455B,
-0xFF384355,
-0xFF4B5366,
-0xFF8789A0,
-0xFFD7D7EF,
-0xFFFCFDFF,
-0xFFFAFDFF,
-0xFFF8FFFF,
-0xFF3D4868,
-0xFF051145,
-0xFF000435,
-0xFFF6F8FF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFF8F9FB,
-0xFFCFD6E0,
-0xFFBDC5D2,
-0xFFBABCC9,
-0xFFFCFCFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFBFBFC9,
-0xFFBEC3D6,
-0xFFC6CCDC,
-0xFFF9FEFF,
-0xFFFEFFFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFB,
-0xFFFFFFFD,
-0xFFFEFEFE,
-0xFFFFFDFF,
-0xFFF5F3FE,
-0xFFB6BAC6,
-0xFFC3C9D5,
-0xFFE2E2EC,
-0xFFFFFEFF,
-0xFFFCFCFC,
-0xFFFFFFFB,
-0xFFFEFFF9,
-0xFFFBFEF7,
-0xFFFEFFFB,
-0xFFF7FBFC,
-0xFFF9FEFF,
-0xFFF9FFFF,
-0xFFCCD3E6,
-0xFF727A91,
-0xFF414864,
-0xFF39425F,
-0xFF424B68,
-0xFF69738C,
-0xFFB3BBD0,
-0xFFF7FCFF,
-0xFFFCFEFF,
-0xFFF9F9FF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFEFEFE,
-0xFFFEFFFF,
-0xFFC6CAD3,
-0xFFBCC1D4,
-0xFFB9BFCF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFD4D8E1,
-0xFFC1C3D8,
-0xFFB6B9CC,
-0xFFFAFEFF,
-0xFFFEFFFD,
-0xFFFDFDFF,
-0xFFFDFBFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFBFC2D1,
-0xFFBBC0D6,
-0xFFC3C9D9,
-0xFFFBFFFF,
-0xFFFEFFFA,
-0xFFFEFCFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF6FBFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFBFDFF,
-0xFFE0E4FD,
-0xFF868BA9,
-0xFF4F5875,
-0xFF303C56,
-0xFF38445A,
-0xFF626D81,
-0xFFA6AEC3,
-0xFFF5FCFF,
-0xFFFAFEFF,
-0xFFFEFFFF,
-0xFFFDFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFDFD,
-0xFFFDFBFC,
-0xFFFFFDFE,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFAFEFF,
-0xFFF9FFFF,
-0xFFF4FCFF,
-0xFFC2CEDE,
-0xFF758096,
-0xFF3F4962,
-0xFF39405C,
-0xFF424764,
-0xFF656986,
-0xFFB4B6CD,
-0xFFF8FAFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFB9C0CA,
-0xFFBEC4D0,
-0xFFCDD1DA,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF8FFF8,
-0xFFF9FFF8,
-0xFFFBFFFB,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFFBFEFF,
-0xFFFBFDFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FEFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF0FEFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF6FFFF,
-0xFFFCFFFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFFBFFFF,
-0xFFF7FCFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFFBFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFBFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFDFFFA,
-0xFFFEFFFB,
-0xFFFDFEFF,
-0xFFFEFEFF,
-0xFFFAFFFF,
-0xFFF5FFFF,
-0xFFE9FFFF,
-0xFFE7FFFF,
-0xFFECFFFF,
-0xFFEFFFFF,
-0xFFF6FFFF,
-0xFFFBFFFF,
-0xFFFAFDFF,
-0xFFFEFFFF,
-0xFFFDFDFB,
-0xFFFEFFFB,
-0xFFFBFFFD,
-0xFFF9FFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFFFFF8,
-0xFFF8FEFA,
-0xFFEDFFFF,
-0xFFE7FFFF,
-0xFFE7FFFF,
-0xFFECFFFF,
-0xFFF6FFFF,
-0xFFFAFFFE,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFEFEFE,
-0xFFFFFFFD,
-0xFFFFFDF9,
-0xFFFFFEF8,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFA,
-0xFFFFFFFB,
-0xFFFEFEFC,
-0xFFFEFFFF,
-0xFFFCFEFF,
-0xFFFBFEFF,
-0xFFF9FEFF,
-0xFFF5FCFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFDFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFDFCFF,
-0xFFFEFDFF,
-0xFFFEFDFF,
-0xFFFEFFFF,
-0xFFFDFFF9,
-0xFFFCFFFA,
-0xFFFBFFFD,
-0xFFF4FCFF,
-0xFFF8FFFF,
-0xFFF7FDFF,
-0xFFF9FEFF,
-0xFFF9FCFF,
-0xFFFCFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFAFFFF,
-0xFFFAFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFDFFFE,
-0xFFFEFFFF,
-0xFFF9FBFF,
-0xFF494C6B,
-0xFF000632,
-0xFF00042E,
-0xFF9799B2,
-0xFFFCFEFF,
-0xFFFBFFFF,
-0xFFFAFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF8FDFF,
-0xFFFCFFFF,
-0xFFFDFDFF,
-0xFFFEFEFF,
-0xFFFBFEFF,
-0xFFF9FFFF,
-0xFFF4FAFF,
-0xFF020A2F,
-0xFF0C1649,
-0xFF0C1341,
-0xFFFCFDFF,
-0xFFFEFDFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFAFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFDFEFF,
-0xFFFFFEFF,
-0xFFFEFDFF,
-0xFFFEFFFD,
-0xFFF9FEF8,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFCFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFCFE,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFCFCFC,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFDFEFF,
-0xFFFCFFFF,
-0xFFFBFFFC,
-0xFFFFFFFB,
-0xFFFDFDFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFBFDFF,
-0xFFFCFEFF,
-0xFFFEFFFF,
-0xFFFDFDFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFF,
-0xFFFFFFFF,
-0xFFFDFEFF,
-0xFFFBFEFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFAFFF9,
-0xFFFEFFF8,
-0xFFFFFEFF,
-0xFFFFFAFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFDFDFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFE,
-0xFFFEFFFB,
-0xFFFBFDFA,
-0xFFFCFFFF,
-0xFFFBFEFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFDFF,
-0xFFFFFFFF,
-0xFFFFFEFA,
-0xFFFFFDFA,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFDFDFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFCFD,
-0xFFFEFFFD,
-0xFFFBFFFC,
-0xFFF9FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFF7FFFF,
-0xFFF7FDFF,
-0xFFFAFEFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFBFDFC,
-0xFFFCFEFB,
-0xFFFCFFFD,
-0xFFFAFEFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFA,
-0xFFFFFFFA,
-0xFFFEFFFD,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF8FFFB,
-0xFFF9FFFB,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF7FFFF,
-0xFFF5FFFF,
-0xFFF5FFFF,
-0xFFF7FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFCFFFA,
-0xFFF8FFFD,
-0xFFF9FFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFBFFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFA,
-0xFFFCFFFB,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFC,
-0xFFFEFFFA,
-0xFFFBFDF8,
-0xFFFCFFFF,
-0xFFD8DDF1,
-0xFF00042E,
-0xFF0C1442,
-0xFF030C2D,
-0xFFEFF7FF,
-0xFFF7FEFF,
-0xFFFCFFFF,
-0xFFFEFDFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFEFCFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFF8FFFF,
-0xFFF6FFFF,
-0xFF61698E,
-0xFF060D3B,
-0xFF09103C,
-0xFF74789B,
-0xFFFCFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFF9FFFD,
-0xFFFBFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFB,
-0xFFFCFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFA,
-0xFFFEFFFA,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF9FFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFBFB,
-0xFFFFFCFA,
-0xFFFFFFFD,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFCFFFB,
-0xFFFCFFF8,
-0xFFFCFFFA,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFB,
-0xFFFFFDFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFCFFFD,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFFFFF8,
-0xFFFEFFFA,
-0xFFFAFEFD,
-0xFFF9FDFF,
-0xFF4A4E71,
-0xFF050E39,
-0xFF06123A,
-0xFF071434,
-0xFFEEF6FF,
-0xFFFAFDFF,
-0xFFFEFEFF,
-0xFFFBF8FF,
-0xFFFDFAFF,
-0xFFFFFEFF,
-0xFFF9FEFF,
-0xFFF8FFFF,
-0xFFF3FFFF,
-0xFF8894AE,
-0xFF000730,
-0xFF0E1541,
-0xFF020727,
-0xFFFAFCFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFF8,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFA,
-0xFFFCFFFB,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFBFFFB,
-0xFFFCFFFA,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFF9FFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFCFD,
-0xFFFFFCFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFD,
-0xFFFBFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFBFFFA,
-0xFFF9FFFA,
-0xFFFBFFFD,
-0xFFFEFFFD,
-0xFFFFFFFA,
-0xFFFFFEFA,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFF8,
-0xFFFFFFF4,
-0xFFFFFFF6,
-0xFFFFFEFA,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFCFBF7,
-0xFFFFFFFB,
-0xFFFDFDFD,
-0xFFFEFEFF,
-0xFFFBFEFF,
-0xFF121838,
-0xFF0A1542,
-0xFF0A1849,
-0xFF000635,
-0xFF858DB2,
-0xFFF6FCFF,
-0xFFF8FFFF,
-0xFFF8FFFF,
-0xFFF5FFFF,
-0xFFF4FFFF,
-0xFFD4E3F6,
-0xFF3F4E6D,
-0xFF000B31,
-0xFF0D143E,
-0xFF000427,
-0xFFB2B5C4,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFA,
-0xFFF9FFFA,
-0xFFF9FFFA,
-0xFFFBFFFB,
-0xFFFEFFFB,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFF8,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFA,
-0xFFFFFFFB,
-0xFFFCFBF9,
-0xFFFDFDFD,
-0xFFFEFDFF,
-0xFFFAFAFF,
-0xFFFBFEFF,
-0xFF1B2445,
-0xFF000A37,
-0xFF0B154A,
-0xFF00093A,
-0xFF00092D,
-0xFF22304B,
-0xFF374761,
-0xFF384963,
-0xFF0C1D37,
-0xFF000927,
-0xFF06133D,
-0xFF0D1641,
-0xFF000428,
-0xFF8D92A8,
-0xFFFDFEFF,
-0xFFFBFCF7,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFFFFFA,
-0xFFFEFFFB,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFFFFFF,
-0xFFFEFFFB,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFBF7,
-0xFFFFFFFA,
-0xFFFEFFF9,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFF7F8699,
-0xFF070F36,
-0xFF000836,
-0xFF05123E,
-0xFF02143C,
-0xFF000F37,
-0xFF00133B,
-0xFF02143A,
-0xFF021037,
-0xFF00032E,
-0xFF272B50,
-0xFFD6D8EF,
-0xFFFCFEFF,
-0xFFFDFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFEFFFF,
-0xFFFCFFFB,
-0xFFFBFFFA,
-0xFFFBFFFA,
-0xFFFCFFFB,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFF9FFFF,
-0xFFF9FFFF,
-0xFFFCFFFB,
-0xFFFEFFFA,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFD,
-0xFFFBFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFB,
-0xFFFCFFFA,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFEFB,
-0xFFFFFEFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFEFEFC,
-0xFFFEFFFF,
-0xFFFAFBFF,
-0xFFFDFCFF,
-0xFFFFFFFF,
-0xFFFDFDFB,
-0xFFFEFFFD,
-0xFFFBFEFF,
-0xFFF9FEFF,
-0xFFA8AECE,
-0xFF5C668A,
-0xFF29375A,
-0xFF19274A,
-0xFF182649,
-0xFF3C4669,
-0xFF7A83A4,
-0xFFD3D8F8,
-0xFFFBFDFF,
-0xFFFCFEFF,
-0xFFF9FAFE,
-0xFFFCFEFD,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFCFF,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFCFFFD,
-0xFFFBFFFA,
-0xFFF9FFF8,
-0xFFFBFFFA,
-0xFFFCFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFD,
-0xFFFFFDFD,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFCFF,
-0xFFFFFCFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFCFD,
-0xFFFFFDFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFCFFFB,
-0xFFFBFFFD,
-0xFFFCFFFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFB,
-0xFFFFFEFB,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFCFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFEFE,
-0xFFFAFBFD,
-0xFFFCFFFF,
-0xFFFAFDFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFBFCFF,
-0xFFF9FCFF,
-0xFFFCFEFF,
-0xFFF7F9FF,
-0xFFFCFEFF,
-0xFFFCFEFF,
-0xFFFCFBFF,
-0xFFFEFEFF,
-0xFFFBFBFF,
-0xFFFCFDFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFA,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFA,
-0xFFFEFFFA,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFEFA,
-0xFFFFFEFB,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFBFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFCFFFB,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFD,
-0xFFFFFEFB,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFBFF,
-0xFFFFFBFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFCFFFB,
-0xFFFBFFFB,
-0xFFFEFFFB,
-0xFFFFFFF8,
-0xFFFFFEFA,
-0xFFFFFEFD,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFDFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFEFFF8,
-0xFFFEFFF8,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFB,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFBFEFF,
-0xFFFAFDFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFCFEFD,
-0xFFFEFFFF,
-0xFFFEFDFF,
-0xFFFFFFFF,
-0xFFFFFFFA,
-0xFFFDFEF8,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFCFBF9,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFDFBFC,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFEFEFC,
-0xFFFEFFFB,
-0xFFFBFFFC,
-0xFFFCFFFB,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFB,
-0xFFFEFFFA,
-0xFFFEFFFA,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFB,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFB,
-0xFFFFFFFB,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFCFFFF,
-0xFFFCFFFF,
-0xFFFFFFFF,
-0xFFFFFEFB,
-0xFFFFFFFA,
-0xFFFFFFFA,
-0xFFFEFFFF,
-0xFFFCFFFF,
-0xFFFBFFFF,
-0xFFFCFFFF,
-0xFFFEFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFEFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFB,
-0xFFFFFFF8,
-0xFFFFFFFA,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFB,
-0xFFFEFFFB,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFD,
-0xFFFCFFFD,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFDFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFA,
-0xFFFFFFFB,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFD,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFEFFFF,
-0xFFFEFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFEFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFEFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFD,
-0xFFFFFFFD,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF,
-0xFFFFFFFF};
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* __LIFE_AUGMENTED_ARGB8888_H */
-
@@ -25,6 +25,7 @@
 #include "stm32h747i_discovery.h"
 #include "stm32h747i_discovery_lcd.h"
 #include "stm32h747i_discovery_sdram.h"
+#include "stm32h747i_discovery_bus.h"
 #include "stm32_lcd.h"
 
 /* Exported types ------------------------------------------------------------*/
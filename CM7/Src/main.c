@@ -21,11 +21,18 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
-#include "image_320x240_argb8888.h"
-#include "life_augmented_argb8888.h"
+#if (USE_LCD_PIXEL_FORMAT_RGB565 == 1)
+#include "assets_rgb565.h"
+#else
+#include "assets_argb8888.h"
+#endif
 #include <string.h>
 #include <stdio.h>
 
+#if (USE_BSP_LCD_ASSETS == 0)
+#error "The example images are asset packs: set USE_BSP_LCD_ASSETS"
+#endif
+
 /** @addtogroup STM32H7xx_HAL_Examples
   * @{
   */
@@ -35,31 +42,57 @@
   */
 
 /* Private typedef -----------------------------------------------------------*/
-static DMA2D_HandleTypeDef           hdma2d;
 
 /* Private define ------------------------------------------------------------*/
 #define LAYER0_ADDRESS               (LCD_FB_START_ADDRESS)
+#if (USE_LCD_PIXEL_FORMAT_RGB565 == 1)
+#define EXAMPLE_PIXEL_FORMAT         LCD_PIXEL_FORMAT_RGB565
+#define ASSET_PACK                   assets_rgb565
+#else
+#define EXAMPLE_PIXEL_FORMAT         LCD_PIXEL_FORMAT_RGB888
+#define ASSET_PACK                   assets_argb8888
+#endif
+/* Compressed assets are decoded after the camera frame buffer */
+#define ASSET_BUFFER_ADDRESS         0xD0800000U
+#define ASSET_BUFFER_SIZE            0x00200000U
+/* Areas drawn in the previous frame, copied again to the buffer two frames old */
+#define PREV_RECTS_NBR               8U
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static uint32_t ImageIndex = 0;
 static uint32_t LCD_X_Size = 0;
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+static uint32_t LCD_DrawnBuffer = 0;
+static uint32_t LCD_BackBuffer = 0;
+#endif
+#if (LCD_LAYER_0_BUFFERS_NBR == 3U)
+static UTIL_LCD_Rect_t LCD_PrevRects[PREV_RECTS_NBR];
+static uint32_t LCD_PrevRectsNbr = 0;
+#endif
 
-static const uint32_t * Images[] = 
+/* Board services used by the LCD utility beyond the LCD component interface */
+static const UTIL_LCD_ExtDrv_t LCD_ExtDriver =
 {
-  image_320x240_argb8888,
-  life_augmented_argb8888,  
+  BSP_LCD_DrawAlpha,
+  BSP_LCD_GetFrameBuffer,
+  BSP_LCD_FrameBufferDrawn
+};
+
+static const uint32_t Images[] = 
+{
+  ASSET_IMAGE_320X240,
+  ASSET_LIFE_AUGMENTED,  
 };
 
 /* Private function prototypes -----------------------------------------------*/
 static void SystemClock_Config(void);
 static void Error_Handler(void);
-static void CopyBuffer(uint32_t *pSrc, 
-                           uint32_t *pDst, 
-                           uint16_t x, 
-                           uint16_t y, 
-                           uint16_t xsize, 
-                           uint16_t ysize);
+static void DrawImage(uint32_t Id, uint32_t y);
 static void LCD_BriefDisplay(void);
+static void LCD_ShowFrame(void);
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+static void LCD_FlushRect(uint32_t Device, const UTIL_LCD_Rect_t *pRect);
+#endif
 static void CPU_CACHE_Enable(void);
 static void MPU_Config(void);
 
@@ -119,31 +152,31 @@ int main(void)
     uint32_t Orientation;
 #if (USE_LCD_CTRL_NT35510 > 0)
     Lcd_Driver_Type = LCD_CTRL_NT35510;
-    PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    PixelFormat = EXAMPLE_PIXEL_FORMAT;
     Orientation = LCD_ORIENTATION_LANDSCAPE;
     Width = 800;
     Height = 480;
 #elif (USE_LCD_CTRL_OTM8009A > 0)
     Lcd_Driver_Type = LCD_CTRL_OTM8009A;
-    PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    PixelFormat = EXAMPLE_PIXEL_FORMAT;
     Orientation = LCD_ORIENTATION_LANDSCAPE;
     Width = 800;
     Height = 480;
 #elif (USE_LCD_CTRL_WAVESHARE_2P8 > 0)
     Lcd_Driver_Type = LCD_CTRL_WAVESHARE_2P8;
-    PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    PixelFormat = EXAMPLE_PIXEL_FORMAT;
     Orientation = LCD_ORIENTATION_PORTRAIT;
     Width = 480;
     Height = 640;
 #elif (USE_LCD_CTRL_RASPBERRYPI > 0)
     Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
-    PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    PixelFormat = EXAMPLE_PIXEL_FORMAT;
     Orientation = LCD_ORIENTATION_LANDSCAPE;
     Width = 800;
     Height = 480;
 #else
     Lcd_Driver_Type = LCD_CTRL_UNKNOWN;
-    PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    PixelFormat = EXAMPLE_PIXEL_FORMAT;
     Orientation = LCD_ORIENTATION_LANDSCAPE;
     Width = 800;
     Height = 480;
@@ -153,13 +186,28 @@ int main(void)
     {
       Error_Handler();
     }
+
+    /* The panel is brought up while the boot goes on, until the first frame */
+    if(BSP_LCD_InitWait(0) != BSP_ERROR_NONE)
+    {
+      Error_Handler();
+    }
   }
 
   UTIL_LCD_SetFuncDriver(&LCD_Driver);
+  UTIL_LCD_SetExtFuncDriver(&LCD_ExtDriver);
   UTIL_LCD_SetLayer(0);
+
+  /* Record the drawn areas, copied to the next back buffer by LCD_ShowFrame() */
+  UTIL_LCD_SetDirtyTracking(1);
   
   /* Get the LCD Width */
   BSP_LCD_GetXSize(0, &LCD_X_Size);
+
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+  /* Update the single frame buffer behind the LTDC scan */
+  BSP_LCD_BeamStart(0);
+#endif
     
 #if (USE_LCD_TEST_VERTICAL > 0)
   HAL_DSI_PatternGeneratorStart(&hlcd_dsi.Instance, 0, 0);
@@ -168,13 +216,15 @@ int main(void)
 #else
   /* Display example brief   */
   LCD_BriefDisplay();
+  LCD_ShowFrame();
 #endif;
   
   /* Infinite loop */
   while (1)
   {
 #if ((USE_LCD_TEST_VERTICAL == 0) && (USE_LCD_TEST_HORIZONTAL == 0))
-    CopyBuffer((uint32_t *)Images[ImageIndex ++], (uint32_t *)LCD_FRAME_BUFFER, (LCD_X_Size - 320)/2, 160, 320, 240);
+    DrawImage(Images[ImageIndex ++], 160);
+    LCD_ShowFrame();
     
     if(ImageIndex >= 2)
     {
@@ -183,14 +233,26 @@ int main(void)
 #endif
     
     /* Wait some time before switching to next stage */
+#if (USE_BSP_LCD_ULPM == 1)
+    uint32_t tickstart = HAL_GetTick();
+    while((HAL_GetTick() - tickstart) < 2000U)
+    {
+      /* Let the DSI link sleep while the image is shown */
+      (void)BSP_LCD_Idle(0);
+      __WFI();
+    }
+#else
     HAL_Delay(2000);
+#endif
     BSP_LED_Toggle(LED2);
 
+#if (USE_BSP_LCD_KEEPALIVE == 0)
     /* Some Raspberry Pi Displays will go to sleep if they don't get I2C traffic */
     if (Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI) {
       uint32_t tmpb;
       BSP_LCD_GetBrightness(0, &tmpb);
     }
+#endif
   }
 }
 
@@ -295,6 +357,9 @@ static void SystemClock_Config(void)
   */
 static void LCD_BriefDisplay(void)
 {
+  BSP_LCD_InitTime_t init_time;
+  char desc[96];
+
   UTIL_LCD_Clear(UTIL_LCD_COLOR_WHITE);
   UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_BLUE);
   UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_BLUE);
@@ -304,55 +369,126 @@ static void LCD_BriefDisplay(void)
   UTIL_LCD_SetFont(&Font16);    
   UTIL_LCD_DisplayStringAt(0, LINE(5), (uint8_t *)"This example shows how to display images", CENTER_MODE);    
   UTIL_LCD_DisplayStringAt(0, LINE(6), (uint8_t *)"on LCD DSI using same buffer for display and for draw", CENTER_MODE);
+
+  /* Boot-to-first-frame time and the part of the panel delays used by other boot work */
+  if(BSP_LCD_GetInitTime(0, &init_time) == BSP_ERROR_NONE)
+  {
+    snprintf(desc, sizeof(desc), "First frame at %lu ms, %lu/%lu ms of panel delays overlapped",
+             (unsigned long)init_time.FirstFrame, (unsigned long)init_time.IdleWork, (unsigned long)init_time.PanelWait);
+    UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_BLUE);
+    UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_WHITE);
+    UTIL_LCD_DisplayStringAt(0, LINE(8), (uint8_t *)desc, CENTER_MODE);
+  }
 }
 /**
-  * @brief  Converts a line to an ARGB8888 pixel format.
-  * @param  pSrc: Pointer to source buffer
-  * @param  pDst: Output color
-  * @param  xSize: Buffer width
-  * @param  ColorMode: Input color mode   
+  * @brief  Draws an image of the asset pack, centered horizontally. The DMA2D
+  *         converts it to the LCD pixel format (RGB888 on the HDMI monitor).
+  * @param  Id: Asset Id
+  * @param  y: Image Y position
   * @retval None
   */
-static void CopyBuffer(uint32_t *pSrc, uint32_t *pDst, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize)
-{   
-  
-  uint32_t destination = (uint32_t)pDst + (y * LCD_X_Size + x) * 4;
-  uint32_t source      = (uint32_t)pSrc;
-  
-  /*##-1- Configure the DMA2D Mode, Color Mode and output offset #############*/ 
-  hdma2d.Init.Mode         = DMA2D_M2M;
-  hdma2d.Init.ColorMode    = DMA2D_OUTPUT_ARGB8888;
-  hdma2d.Init.OutputOffset = LCD_X_Size - xsize; 
-  hdma2d.Init.AlphaInverted = DMA2D_REGULAR_ALPHA;  /* No Output Alpha Inversion*/  
-  hdma2d.Init.RedBlueSwap   = DMA2D_RB_REGULAR;     /* No Output Red & Blue swap */  
-  
-  /*##-2- DMA2D Callbacks Configuration ######################################*/
-  hdma2d.XferCpltCallback  = NULL;
-  
-  /*##-3- Foreground Configuration ###########################################*/
-  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hdma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
-  hdma2d.LayerCfg[1].InputOffset = 0;
-  hdma2d.LayerCfg[1].RedBlueSwap = DMA2D_RB_REGULAR; /* No ForeGround Red/Blue swap */
-  hdma2d.LayerCfg[1].AlphaInverted = DMA2D_REGULAR_ALPHA; /* No ForeGround Alpha inversion */  
-
-  hdma2d.Instance          = DMA2D; 
-   
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
+static void DrawImage(uint32_t Id, uint32_t y)
+{
+  BSP_LCD_Asset_t asset;
+
+  /*##-1- Find the asset, it points to the pack in flash ######################*/
+  if(BSP_LCD_AssetFind(ASSET_PACK, Id, &asset) != BSP_ERROR_NONE)
   {
-    if(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start(&hdma2d, source, destination, xsize, ysize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&hdma2d, 100);
-      }
-    }
-  }   
+    Error_Handler();
+  }
+
+  /*##-2- Decode it to the SDRAM when it is compressed, else draw it in place #*/
+  if(BSP_LCD_AssetLoad(&asset, (uint8_t *)ASSET_BUFFER_ADDRESS, ASSET_BUFFER_SIZE) != BSP_ERROR_NONE)
+  {
+    Error_Handler();
+  }
+
+  /*##-3- Copy or convert it to the frame buffer ##############################*/
+  (void)BSP_LCD_DrawAsset(0, (LCD_X_Size - asset.Width)/2, y, &asset, 0);
+
+  /* Drawn without the utility, record its area */
+  UTIL_LCD_AddDirtyRect((LCD_X_Size - asset.Width)/2, y, asset.Width, asset.Height);
 }
 
+/**
+  * @brief  Shows the drawn frame. With several layer 0 buffers, the areas drawn
+  *         since the previous frame are copied to the new back buffer, so that
+  *         the next frame is drawn over the shown one instead of redrawing the
+  *         whole screen. With a single buffer they are already displayed.
+  * @param  None
+  * @retval None
+  */
+static void LCD_ShowFrame(void)
+{
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+#if (LCD_LAYER_0_BUFFERS_NBR == 3U)
+  UTIL_LCD_Rect_t rects[PREV_RECTS_NBR];
+  uint32_t i, nbr;
+#endif
+
+  if((BSP_LCD_GetFrameBuffer(0, &LCD_DrawnBuffer) != BSP_ERROR_NONE) ||
+     (BSP_LCD_SwapBuffers(0, &LCD_BackBuffer) != BSP_ERROR_NONE))
+  {
+    Error_Handler();
+  }
+
+#if (LCD_LAYER_0_BUFFERS_NBR == 3U)
+  /* The new back buffer may miss the previous frame as well */
+  nbr = UTIL_LCD_GetDirtyRects(rects, PREV_RECTS_NBR);
+  for(i = 0; i < LCD_PrevRectsNbr; i++)
+  {
+    LCD_FlushRect(0, &LCD_PrevRects[i]);
+  }
+  for(i = 0; i < nbr; i++)
+  {
+    LCD_PrevRects[i] = rects[i];
+  }
+  LCD_PrevRectsNbr = nbr;
+#endif
+
+  UTIL_LCD_FlushDirtyRects(LCD_FlushRect);
+  (void)BSP_LCD_DMA2D_Sync(0);
+#else
+  /* Drawn in the scanned out buffer, nothing to copy */
+  UTIL_LCD_FlushDirtyRects(NULL);
+#endif
+}
+
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+/**
+  * @brief  Copies an area of the shown frame to the back buffer by DMA2D.
+  * @param  Device: LCD instance
+  * @param  pRect: Area
+  * @retval None
+  */
+static void LCD_FlushRect(uint32_t Device, const UTIL_LCD_Rect_t *pRect)
+{
+  BSP_LCD_DMA2D_Job_t job;
+  uint32_t format, bpp, offset;
+
+  if((LCD_DrawnBuffer != LCD_BackBuffer) && (BSP_LCD_GetPixelFormat(Device, &format) == BSP_ERROR_NONE))
+  {
+    /* The RGB888 frame buffers are ARGB8888 */
+    bpp    = (format == LCD_PIXEL_FORMAT_RGB565) ? 2U : 4U;
+    offset = ((pRect->Y * LCD_X_Size) + pRect->X) * bpp;
+
+    memset(&job, 0, sizeof(job));
+    job.Init.Mode                 = DMA2D_M2M;
+    job.Init.ColorMode            = (bpp == 2U) ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+    job.Init.OutputOffset         = LCD_X_Size - pRect->Width;
+    job.Foreground.InputColorMode = (bpp == 2U) ? DMA2D_INPUT_RGB565 : DMA2D_INPUT_ARGB8888;
+    job.Foreground.InputOffset    = LCD_X_Size - pRect->Width;
+    job.Foreground.AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+    job.Foreground.InputAlpha     = 0xFF;
+    job.Source                    = LCD_DrawnBuffer + offset;
+    job.Destination               = LCD_BackBuffer + offset;
+    job.Width                     = pRect->Width;
+    job.Height                    = pRect->Height;
+    (void)BSP_LCD_DMA2D_Submit(Device, &job, NULL);
+  }
+}
+#endif
+
 /**
 * @brief  CPU L1-Cache enable.
 * @param  None
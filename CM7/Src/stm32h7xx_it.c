@@ -144,6 +144,71 @@ void SysTick_Handler(void)
 /*  file (startup_stm32h7xx.s).                                               */
 /******************************************************************************/
 
+/**
+  * @brief  This function handles LTDC interrupt request.
+  * @param  None
+  * @retval None
+  */
+void LTDC_IRQHandler(void)
+{
+  BSP_LCD_LTDC_IRQHandler(0);
+}
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+/**
+  * @brief  This function handles DSI interrupt request.
+  * @param  None
+  * @retval None
+  */
+void DSI_IRQHandler(void)
+{
+  BSP_LCD_DSI_IRQHandler(0);
+}
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+/**
+  * @brief  This function handles DMA2D interrupt request.
+  * @param  None
+  * @retval None
+  */
+void DMA2D_IRQHandler(void)
+{
+  BSP_LCD_DMA2D_IRQHandler(0);
+}
+
+#if (USE_BSP_I2C4_QUEUE == 1)
+/**
+  * @brief  This function handles I2C4 event interrupt request.
+  * @param  None
+  * @retval None
+  */
+void I2C4_EV_IRQHandler(void)
+{
+  BSP_I2C4_EV_IRQHandler();
+}
+
+/**
+  * @brief  This function handles I2C4 error interrupt request.
+  * @param  None
+  * @retval None
+  */
+void I2C4_ER_IRQHandler(void)
+{
+  BSP_I2C4_ER_IRQHandler();
+}
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+/**
+  * @brief  This function handles TIM7 interrupt request.
+  * @param  None
+  * @retval None
+  */
+void TIM7_IRQHandler(void)
+{
+  BSP_LCD_KeepAlive_IRQHandler(0);
+}
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
 
 /**
   * @}
@@ -40,8 +40,62 @@
 #define USE_LCD_TEST_VERTICAL               0U
 #define USE_LCD_TEST_HORIZONTAL             0U
 
+/* Example pixel format: RGB565 layer, DSI link and dithered image assets
+   (half the memory and bandwidth of ARGB8888), else RGB888 */
+#define USE_LCD_PIXEL_FORMAT_RGB565         0U
+
 #define LCD_LAYER_0_ADDRESS                 0xD0000000U
 #define LCD_LAYER_1_ADDRESS                 0xD0200000U
+
+/* LCD draw statistics (DWT cycle counter based) */
+#define USE_BSP_LCD_STATS                   0U
+
+/* Layer 0 frame buffers: 1 (single), 2 (double) or 3 (triple buffering).
+   Buffers are contiguous from LCD_LAYER_0_ADDRESS, move LCD_LAYER_1_ADDRESS
+   after them when layer 1 is used */
+#define LCD_LAYER_0_BUFFERS_NBR             1U
+
+/* Release the DMA2D fills of a band once the LTDC scanned past it */
+#define USE_BSP_LCD_BEAM_RACING             0U
+
+/* Probe the panel detected at the previous boot first (backup SRAM record) */
+#define USE_BSP_LCD_PANEL_CACHE             1U
+
+/* Send the DSI writes of the panel init script without waiting for each packet */
+#define USE_BSP_LCD_DSI_BATCH               1U
+
+/* Interrupt driven I2C4 transfers, queued by device priority */
+#define USE_BSP_I2C4_QUEUE                  1U
+
+/* Keep the RASPBERRYPI panel awake from a timer (needs USE_BSP_I2C4_QUEUE) */
+#define USE_BSP_LCD_KEEPALIVE               1U
+
+/* Drive the NT35510 and OTM8009A panels in DSI adapted command mode, refreshing
+   only the areas drawn (needs a single frame buffer and no beam racing) */
+#define USE_BSP_LCD_CMD_MODE                0U
+
+/* Put the DSI link in ultra low power mode while the display is idle */
+#define USE_BSP_LCD_ULPM                    0U
+
+/* Compose a layer 1 overlay window over layer 0, in its own pixel format */
+#define USE_BSP_LCD_OVERLAY                 0U
+
+/* Interpolate the LTDC layer alpha, window position and address at each vertical blanking */
+#define USE_BSP_LCD_ANIMATION               0U
+
+/* Rotate the drawn image to the panel by tiles, for panels mounted in another orientation */
+#define USE_BSP_LCD_ROTATION                0U
+#define LCD_ROTATION_ADDRESS                0xD0400000U
+
+/* Switch the NT35510/OTM8009A between portrait and landscape at run time */
+#define USE_BSP_LCD_ORIENTATION             0U
+
+/* Indexed color layers (L8, AL44, AL88), their CLUT swapped at the vertical blanking */
+#define USE_BSP_LCD_CLUT                    0U
+
+/* Asset packs of Tools/lcd_assets.py, drawn in place or decoded to RAM */
+#define USE_BSP_LCD_ASSETS                  1U
+
 /* Camera sensors defines */
 #define USE_CAMERA_SENSOR_OV5640            1U
 #define USE_CAMERA_SENSOR_OV9655            1U
@@ -69,6 +123,8 @@
 #define BSP_SD_RX_IT_PRIORITY               14U
 #define BSP_SD_TX_IT_PRIORITY               15U
 #define BSP_TS_IT_PRIORITY                  15U
+#define BSP_I2C4_IT_PRIORITY                14U
+#define BSP_LCD_KEEPALIVE_IT_PRIORITY       15U
 #define BSP_JOY1_SEL_IT_PRIORITY            15U
 #define BSP_JOY1_DOWN_IT_PRIORITY           15U
 #define BSP_JOY1_LEFT_IT_PRIORITY           15U
@@ -222,12 +222,16 @@ int32_t NT35510_Init(NT35510_Object_t *pObj, uint32_t ColorCoding, uint32_t Orie
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_MADCTL, &nt35510_madctl_portrait[1], 0);
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_CASET, nt35510_caset_portrait, 4);
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_RASET, nt35510_raset_portrait, 4);
+
+    NT35510Ctx.Orientation = NT35510_ORIENTATION_PORTRAIT;
   }
   else
   {
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_MADCTL, &nt35510_madctl_landscape[1], 0);
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_CASET, nt35510_caset_landscape, 4);
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_RASET, nt35510_raset_landscape, 4);
+
+    NT35510Ctx.Orientation = NT35510_ORIENTATION_LANDSCAPE;
   }
 
   ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_SLPOUT, &nt35510_reg27[1], 0);
@@ -417,7 +421,7 @@ int32_t NT35510_SetOrientation(NT35510_Object_t *pObj, uint32_t Orientation)
   }/* Send command to configure display orientation mode  */
   else if(Orientation == NT35510_ORIENTATION_LANDSCAPE)
   {
-    ret = nt35510_write_reg(&pObj->Ctx, NT35510_CMD_RDDMADCTL, &tmp, 0);
+    ret = nt35510_write_reg(&pObj->Ctx, NT35510_CMD_MADCTL, &tmp, 0);
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_CASET, nt35510_caset_landscape, 4);
     ret += nt35510_write_reg(&pObj->Ctx, NT35510_CMD_RASET, nt35510_raset_landscape, 4);
     
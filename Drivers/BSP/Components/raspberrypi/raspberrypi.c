@@ -72,6 +72,105 @@ static RASPBERRYPI_LCD_Ctx_t RASPBERRYPICtx;
   */
 
 /* Private macros ------------------------------------------------------------*/
+/* Operands of the script instructions */
+#define RASPBERRYPI_RD16(p)           ((uint16_t)((uint16_t)(p)[0] | ((uint16_t)(p)[1] << 8)))
+#define RASPBERRYPI_RD32(p)           ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) | ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t *pTicks;
+  uint32_t  Nbr;
+} RASPBERRYPI_Profile_t;
+
+/* Private constants ---------------------------------------------------------*/
+/* Power up, from the Linux panel-raspberrypi-touchscreen driver */
+static const uint8_t RASPBERRYPI_PreInitScript[] =
+{
+  /* Turn off so we can cleanly sequence powering on */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_POWERON, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(25U),
+  /* Backlight Off */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PWM, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  /* LCD Power Down */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTA, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTB, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTC, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(30U),
+  /* LCD Power Up: ensure bridge and tp stay in reset, set orientation,
+     main regulator on and power to the panel, bring controllers out of reset */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTC, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTA, RASPBERRYPI_PA_LCD_LR),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTB, RASPBERRYPI_PB_LCD_MAIN),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTC, RASPBERRYPI_PC_LED_EN),
+  RASPBERRYPI_SCRIPT_DELAY(80U),
+  /* GPIO RST_BRIDGE_N = 0 then 1 */
+  RASPBERRYPI_SCRIPT_I2C_CLEAR(RASPBERRYPI_REG_PORTC, RASPBERRYPI_PC_RST_BRIDGE_N | RASPBERRYPI_PC_RST_LCD_N),
+  RASPBERRYPI_SCRIPT_DELAY(100U),
+  RASPBERRYPI_SCRIPT_I2C_SET(RASPBERRYPI_REG_PORTC, RASPBERRYPI_PC_RST_BRIDGE_N | RASPBERRYPI_PC_RST_LCD_N),
+  RASPBERRYPI_SCRIPT_DELAY(8U),
+  /* Setup Display: 0x047C register set to 0x0000 is DSI input + DPI output */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_ADDRH, 0x04U),
+  RASPBERRYPI_SCRIPT_DELAY(8U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_ADDRL, 0x7CU),
+  RASPBERRYPI_SCRIPT_DELAY(8U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_WRITEH, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(8U),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_WRITEL, 0x00U),
+  RASPBERRYPI_SCRIPT_DELAY(8U),
+  /* Power up the Toshiba bridge. The Atmel device can misbehave over I2C
+     for a few ms after writes to REG_POWERON, so sleep after it */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_POWERON, 0x01U),
+  RASPBERRYPI_SCRIPT_DELAY(25U),
+  /* Wait for nPWRDWN to go low to indicate poweron is done */
+  RASPBERRYPI_SCRIPT_I2C_POLL(RASPBERRYPI_REG_PORTB, 0x01U, 100U, 1U),
+  RASPBERRYPI_SCRIPT_END
+};
+
+/* rpi_touchscreen_prepare and rpi_touchscreen_enable */
+static const uint8_t RASPBERRYPI_InitScript[] =
+{
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_DSI_LANEENABLE, RASPBERRYPI_LANEENABLE_L0EN | RASPBERRYPI_LANEENABLE_CLEN),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_PPI_D0S_CLRSIPOCOUNT, 5U),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_PPI_D1S_CLRSIPOCOUNT, 5U),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_PPI_D0S_ATMR, 0U),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_PPI_D1S_ATMR, 0U),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_PPI_D1S_ATMR, RASPBERRYPI_LPX_PERIOD),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_SPICMR, 0U),
+  /* RGB888, negative HSYNC and VSYNC: 0x001A0150 */
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_LCDCTRL, RASPBERRYPI_LCDCTRL_VSDELAY(1) | RASPBERRYPI_LCDCTRL_RGB888 |
+                                                    RASPBERRYPI_LCDCTRL_UNK6 | RASPBERRYPI_LCDCTRL_VTGEN |
+                                                    RASPBERRYPI_LCDCTRL_HSPOL | RASPBERRYPI_LCDCTRL_VSPOL),
+  /* The LCD_HS_HBP, LCD_HDISP_HFP, LCD_VS_VBP and LCD_VDISP_VFP timings set by
+     tc358762.c are not written: the display does not work with them */
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_SYSCTRL, 0x040FU),
+  RASPBERRYPI_SCRIPT_DELAY(100U),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_PPI_STARTPPI, RASPBERRYPI_PPI_START_FUNCTION),
+  RASPBERRYPI_SCRIPT_DSI_WRITE(RASPBERRYPI_DSI_STARTDSI, RASPBERRYPI_DSI_RX_START),
+  RASPBERRYPI_SCRIPT_DELAY(100U),
+  /* Turn on the backlight and default to the same orientation as the
+     closed source firmware used for the panel */
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PWM, 0xFFU),
+  RASPBERRYPI_SCRIPT_I2C_WRITE(RASPBERRYPI_REG_PORTA, RASPBERRYPI_PA_LCD_LR),
+  RASPBERRYPI_SCRIPT_DELAY(10U),
+  RASPBERRYPI_SCRIPT_END
+};
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t *RASPBERRYPI_Scripts[RASPBERRYPI_SCRIPT_NBR] =
+{
+  RASPBERRYPI_PreInitScript,
+  RASPBERRYPI_InitScript
+};
+
+static RASPBERRYPI_Profile_t RASPBERRYPI_Profiles[RASPBERRYPI_SCRIPT_NBR];
+
 /* Private functions ---------------------------------------------------------*/
 static int32_t RASPBERRYPI_ReadI2CRegWrap(void *Handle, uint16_t Reg, uint8_t* Data, uint16_t Length);
 static int32_t RASPBERRYPI_WriteI2CRegWrap(void *Handle, uint16_t Reg, uint8_t *pData, uint16_t Length);
@@ -79,6 +178,9 @@ static int32_t RASPBERRYPI_ReadDSIRegWrap(void *Handle, uint16_t Reg, uint8_t* D
 static int32_t RASPBERRYPI_WriteDSIRegWrap(void *Handle, uint16_t Reg, uint8_t *pData, uint16_t Length);
 static int32_t RASPBERRYPI_IO_Delay(RASPBERRYPI_Object_t *pObj, uint32_t Delay);
 static void RASPBERRYPI_SetI2C_Address(RASPBERRYPI_Object_t *pObj, uint8_t Address);
+static void RASPBERRYPI_StartScript(RASPBERRYPI_Object_t *pObj, uint8_t Script);
+static int32_t RASPBERRYPI_RunInstruction(RASPBERRYPI_Object_t *pObj);
+static void RASPBERRYPI_NextInstruction(RASPBERRYPI_Object_t *pObj, uint16_t Size, uint8_t Nbr);
 /**
   * @}
   */
@@ -140,7 +242,8 @@ int32_t RASPBERRYPI_RegisterBusIO (RASPBERRYPI_Object_t *pObj, RASPBERRYPI_IO_t
 }
 
 /**
-  * @brief  Initializes the LCD
+  * @brief  Powers up the panel and the TC358762 bridge over I2C.
+  *         Blocking version of RASPBERRYPI_PreInitStart().
   * @param  pObj Component object
   * @param  ColorCoding   Color Code
   * @param  Orientation   Display orientation
@@ -148,113 +251,11 @@ int32_t RASPBERRYPI_RegisterBusIO (RASPBERRYPI_Object_t *pObj, RASPBERRYPI_IO_t
   */
 int32_t RASPBERRYPI_PreInit(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation)
 {
-  int32_t ret = RASPBERRYPI_OK;
-  uint8_t val;
-  uint32_t tmp;
-  uint32_t lcdctrl;
+  int32_t ret = RASPBERRYPI_PreInitStart(pObj, ColorCoding, Orientation);
 
-  if(pObj->IsInitialized == 0U)
+  while(ret == RASPBERRYPI_BUSY)
   {
-    pObj->IO.Init();
-
-    RASPBERRYPI_SetI2C_Address(pObj, RASPBERRYPI_I2C_ADDR);
-
-    // Turn off so we can cleanly sequence powering on
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_POWERON, &val, 1);
-    HAL_Delay (25);
-
-    // Backlight Off
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PWM, &val, 1);
-    HAL_Delay (10);
-
-    // LCD Power Down
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTA, &val, 1);
-    HAL_Delay (10);
-
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTB, &val, 1);
-    HAL_Delay (10);
-
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    HAL_Delay (30);
-
-    // LCD Power Up
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1); // Ensure bridge, and tp stay in reset
-    HAL_Delay (10);
-
-    val = RASPBERRYPI_PA_LCD_LR;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTA, &val, 1); // Set orientation
-    HAL_Delay (10);
-
-    val = RASPBERRYPI_PB_LCD_MAIN;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTB, &val, 1); // Main regulator on and power to the panel
-    HAL_Delay (10);
-
-    val = RASPBERRYPI_PC_LED_EN;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1); // Bring controllers out of reset
-    HAL_Delay (80);
-
-    // GPIO RST_BRIDGE_N = 0
-    ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    val &= ~(RASPBERRYPI_PC_RST_BRIDGE_N | RASPBERRYPI_PC_RST_LCD_N);
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-
-    HAL_Delay(100);
-
-    // GPIO RST_BRIDGE_N = 1
-    ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    val |= (RASPBERRYPI_PC_RST_BRIDGE_N | RASPBERRYPI_PC_RST_LCD_N);
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    HAL_Delay(8);
-
-    // Setup Display
-    val = 0x04;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_ADDRH, &val, 1); // 0x047C register set to 0x0000 is DSI input + DPI output
-    HAL_Delay (8);
-
-    val = 0x7C;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_ADDRL, &val, 1); // 0x047C register set to 0x0000 is DSI input + DPI output
-    HAL_Delay (8);
-
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_WRITEH, &val, 1);
-    HAL_Delay (8);
-
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_WRITEL, &val, 1);
-    HAL_Delay (8);
-
-    /*
-     * Power up the Toshiba bridge. The Atmel device can misbehave
-     * over I2C for a few ms after writes to REG_POWERON (including the
-     * write in rpi_touchscreen_disable()), so sleep before and after.
-     * Also to ensure that the bridge has been off for at least 100ms.
-     */
-    val = 0x01;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_POWERON, &val, 1);
-    HAL_Delay (25);
-
-    /* Wait for nPWRDWN to go low to indicate poweron is done. */
-    for (int ii = 0; ii < 100; ii++) {
-      val = 0x00;
-      ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTB, &val, 1);
-      if (val >= 0 && (val & 1)) {
-        break;
-      }
-      HAL_Delay (1);
-    }
-
-    if(ret != RASPBERRYPI_OK)
-    {
-      ret = RASPBERRYPI_ERROR;
-    } else {
-      pObj->IsInitialized = 1;
-    }
+    ret = RASPBERRYPI_Process(pObj);
   }
 
   return ret;
@@ -262,6 +263,7 @@ int32_t RASPBERRYPI_PreInit(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, ui
 
 /**
   * @brief  Initializes the LCD
+  *         Blocking version of RASPBERRYPI_InitStart().
   * @param  pObj Component object
   * @param  ColorCoding   Color Code
   * @param  Orientation   Display orientation
@@ -269,201 +271,149 @@ int32_t RASPBERRYPI_PreInit(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, ui
   */
 int32_t RASPBERRYPI_Init(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation)
 {
-  /*
-   * 		.clock = 25979400 / 1000,
-		.hdisplay = 800,
-		.hsync_start = 800 + 1, // HFP=1
-		.hsync_end = 800 + 1 + 2, //HSYNC=2
-		.htotal = 800 + 1 + 2 + 46, // HBP=46
-		.vdisplay = 480,
-		.vsync_start = 480 + 7, // VFP=7
-		.vsync_end = 480 + 7 + 2, // VSYNC=2
-		.vtotal = 480 + 7 + 2 + 21, // VBP=21
-   */
+  int32_t ret = RASPBERRYPI_InitStart(pObj, ColorCoding, Orientation);
+
+  while(ret == RASPBERRYPI_BUSY)
+  {
+    ret = RASPBERRYPI_Process(pObj);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Starts powering up the panel and the TC358762 bridge over I2C.
+  *         This must be done before the DSI host is started. The
+  *         RASPBERRYPI_SCRIPT_PREINIT script is then run by RASPBERRYPI_Process().
+  * @param  pObj Component object
+  * @param  ColorCoding   Color Code
+  * @param  Orientation   Display orientation
+  * @retval RASPBERRYPI_BUSY while the sequence runs, else component status
+  */
+int32_t RASPBERRYPI_PreInitStart(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation)
+{
   int32_t ret = RASPBERRYPI_OK;
-  uint8_t val;
-  uint32_t tmp;
-  uint32_t lcdctrl;
-  uint16_t hdisplay = RASPBERRYPI_800X480_WIDTH;
-  uint16_t hsync_start = RASPBERRYPI_800X480_WIDTH + RASPBERRYPI_800X480_HFP;     // HFP=131
-  uint16_t hsync_end = RASPBERRYPI_800X480_WIDTH + RASPBERRYPI_800X480_HFP + RASPBERRYPI_800X480_HSYNC;   // HSYNC=2
-  uint16_t htotal = RASPBERRYPI_800X480_WIDTH + RASPBERRYPI_800X480_HFP + RASPBERRYPI_800X480_HSYNC + RASPBERRYPI_800X480_HBP; // HBP=45
-  uint16_t vdisplay = RASPBERRYPI_800X480_HEIGHT;              // VACT
-  uint16_t vsync_start = RASPBERRYPI_800X480_HEIGHT + RASPBERRYPI_800X480_VFP;       // VFP=7
-  uint16_t vsync_end = RASPBERRYPI_800X480_HEIGHT + RASPBERRYPI_800X480_VFP + RASPBERRYPI_800X480_VSYNC;     // SW=2
-  uint16_t vtotal = RASPBERRYPI_800X480_HEIGHT + RASPBERRYPI_800X480_VFP + RASPBERRYPI_800X480_VSYNC + RASPBERRYPI_800X480_VBP;   // VBP=22
-  uint16_t flags = RASPBERRYPI_DRM_MODE_FLAG_NVSYNC | RASPBERRYPI_DRM_MODE_FLAG_NHSYNC;;
-
-#if I2C_IN_INIT
+
   if(pObj->IsInitialized == 0U)
   {
     pObj->IO.Init();
 
     RASPBERRYPI_SetI2C_Address(pObj, RASPBERRYPI_I2C_ADDR);
 
-    // Turn off so we can cleanly sequence powering on
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_POWERON, &val, 1);
-    HAL_Delay (25);
-
-    // Backlight Off
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PWM, &val, 1);
-    HAL_Delay (10);
-
-    // LCD Power Down
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTA, &val, 1);
-    HAL_Delay (10);
-
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTB, &val, 1);
-    HAL_Delay (10);
-
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    HAL_Delay (30);
-
-    // LCD Power Up
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1); // Ensure bridge, and tp stay in reset
-    HAL_Delay (10);
-
-    val = RASPBERRYPI_PA_LCD_LR;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTA, &val, 1); // Set orientation
-    HAL_Delay (10);
-
-    val = RASPBERRYPI_PB_LCD_MAIN;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTB, &val, 1); // Main regulator on and power to the panel
-    HAL_Delay (10);
-
-    val = RASPBERRYPI_PC_LED_EN;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1); // Bring controllers out of reset
-    HAL_Delay (80);
-
-    // GPIO RST_BRIDGE_N = 0
-    ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    val &= ~(RASPBERRYPI_PC_RST_BRIDGE_N | RASPBERRYPI_PC_RST_LCD_N);
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-
-    HAL_Delay(100);
+    RASPBERRYPI_StartScript(pObj, RASPBERRYPI_SCRIPT_PREINIT);
+    ret = RASPBERRYPI_Process(pObj);
+  }
 
-    // GPIO RST_BRIDGE_N = 1
-    ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    val |= (RASPBERRYPI_PC_RST_BRIDGE_N | RASPBERRYPI_PC_RST_LCD_N);
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTC, &val, 1);
-    HAL_Delay(8);
+  return ret;
+}
 
-    // Setup Display
-    val = 0x04;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_ADDRH, &val, 1); // 0x047C register set to 0x0000 is DSI input + DPI output
-    HAL_Delay (8);
+/**
+  * @brief  Starts the TC358762 DSI configuration and the backlight enable,
+  *         once the DSI host is started. The RASPBERRYPI_SCRIPT_INIT script
+  *         is then run by RASPBERRYPI_Process().
+  * @param  pObj Component object
+  * @param  ColorCoding   Color Code
+  * @param  Orientation   Display orientation
+  * @retval RASPBERRYPI_BUSY while the sequence runs, else component status
+  */
+int32_t RASPBERRYPI_InitStart(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation)
+{
+  RASPBERRYPI_StartScript(pObj, RASPBERRYPI_SCRIPT_INIT);
 
-    val = 0x7C;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_ADDRL, &val, 1); // 0x047C register set to 0x0000 is DSI input + DPI output
-    HAL_Delay (8);
+  return RASPBERRYPI_Process(pObj);
+}
 
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_WRITEH, &val, 1);
-    HAL_Delay (8);
+/**
+  * @brief  Runs the script started by RASPBERRYPI_PreInitStart() or
+  *         RASPBERRYPI_InitStart(). The instructions due are run until one
+  *         requires a delay, the function never waits.
+  * @param  pObj Component object
+  * @retval RASPBERRYPI_BUSY while the script runs, else component status
+  */
+int32_t RASPBERRYPI_Process(RASPBERRYPI_Object_t *pObj)
+{
+  int32_t ret = RASPBERRYPI_BUSY;
 
-    val = 0x00;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_WRITEL, &val, 1);
-    HAL_Delay (8);
-
-    /*
-     * Power up the Toshiba bridge. The Atmel device can misbehave
-     * over I2C for a few ms after writes to REG_POWERON (including the
-     * write in rpi_touchscreen_disable()), so sleep before and after.
-     * Also to ensure that the bridge has been off for at least 100ms.
-     */
-    val = 0x01;
-    ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_POWERON, &val, 1);
-    HAL_Delay (25);
-
-    /* Wait for nPWRDWN to go low to indicate poweron is done. */
-    for (int ii = 0; ii < 100; ii++) {
-      val = 0x00;
-      ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTB, &val, 1);
-      if (val >= 0 && (val & 1)) {
-        break;
-      }
-      HAL_Delay (1);
-    }
-#else
+  if(pObj->pScript == NULL)
   {
-#endif
-    // Start DSI Configuration
-    // index name refresh (Hz) hdisp hss hse htot vdisp vss vse vtot
-    // #0 800x480 60.03 800 931 933 978 480 487 489 511 30000 flags: nhsync, nvsync; type: preferred, driver
-    if(ret == RASPBERRYPI_OK)
+    ret = RASPBERRYPI_OK;
+  }
+  else if(((uint32_t)pObj->IO.GetTick() - pObj->TickStart) >= pObj->Delay)
+  {
+    pObj->Delay = 0U;
+    while((ret == RASPBERRYPI_BUSY) && (pObj->Delay == 0U))
     {
-      // rpi_touchscreen_prepare
-      ret = raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_DSI_LANEENABLE, RASPBERRYPI_LANEENABLE_L0EN | RASPBERRYPI_LANEENABLE_CLEN);
-
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_PPI_D0S_CLRSIPOCOUNT, 5);
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_PPI_D1S_CLRSIPOCOUNT, 5);
-
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_PPI_D0S_ATMR, 0);
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_PPI_D1S_ATMR, 0);
-
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_PPI_D1S_ATMR, RASPBERRYPI_LPX_PERIOD);
-
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_SPICMR, 0);
-
-      lcdctrl = RASPBERRYPI_LCDCTRL_VSDELAY(1) | RASPBERRYPI_LCDCTRL_RGB888 | RASPBERRYPI_LCDCTRL_UNK6 | RASPBERRYPI_LCDCTRL_VTGEN;
-
-      if (flags & RASPBERRYPI_DRM_MODE_FLAG_NHSYNC)
-	lcdctrl |= RASPBERRYPI_LCDCTRL_HSPOL;
-
-      if (flags & RASPBERRYPI_DRM_MODE_FLAG_NVSYNC)
-	lcdctrl |= RASPBERRYPI_LCDCTRL_VSPOL;
-
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_LCDCTRL, lcdctrl); // 0x00100150
+      if(pObj->pScript[pObj->Pc] == RASPBERRYPI_OP_END)
+      {
+        pObj->pScript = NULL;
+        pObj->IsInitialized = 1;
+        ret = RASPBERRYPI_OK;
+      }
+      else if(RASPBERRYPI_RunInstruction(pObj) != RASPBERRYPI_OK)
+      {
+        pObj->pScript = NULL;
+        ret = RASPBERRYPI_ERROR;
+      }
+      else
+      {
+        pObj->TickStart = (uint32_t)pObj->IO.GetTick();
+      }
+    }
+  }
 
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_SYSCTRL, 0x040f);
+  return ret;
+}
 
-      // Manually set timings - this code is found in tc358762.c but when included with
-      // it causes the raspberry pi display to not work
-      /*
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_LCD_HS_HBP,
-		  (hsync_end - hsync_start) | ((htotal - hsync_end) << 16));
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_LCD_HDISP_HFP,hdisplay | ((hsync_start - hdisplay) << 16));
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_LCD_VS_VBP,
-		  (vsync_end - vsync_start) | ((vtotal - vsync_end) << 16));
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_LCD_VDISP_VFP, vdisplay | ((vsync_start - vdisplay) << 16));
-      */
-      HAL_Delay (100);
+/**
+  * @brief  Replaces an init script, to tune the delays or the TC358762
+  *         setup without changing the driver. The script is a byte array
+  *         built with the RASPBERRYPI_SCRIPT_xxx() instructions and ended
+  *         by RASPBERRYPI_SCRIPT_END. It is used by the next start.
+  * @param  Script   RASPBERRYPI_SCRIPT_PREINIT or RASPBERRYPI_SCRIPT_INIT
+  * @param  pScript  Script, which must stay valid, or NULL for the default one
+  * @retval Component status
+  */
+int32_t RASPBERRYPI_SetScript(uint32_t Script, const uint8_t *pScript)
+{
+  int32_t ret = RASPBERRYPI_OK;
 
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_PPI_STARTPPI, RASPBERRYPI_PPI_START_FUNCTION);
-      ret += raspberrypi_write_dsi_reg(&pObj->Ctx, RASPBERRYPI_DSI_STARTDSI, RASPBERRYPI_DSI_RX_START);
+  if(Script >= RASPBERRYPI_SCRIPT_NBR)
+  {
+    ret = RASPBERRYPI_ERROR;
+  }
+  else if(pScript != NULL)
+  {
+    RASPBERRYPI_Scripts[Script] = pScript;
+  }
+  else
+  {
+    RASPBERRYPI_Scripts[Script] = (Script == RASPBERRYPI_SCRIPT_PREINIT) ? RASPBERRYPI_PreInitScript : RASPBERRYPI_InitScript;
+  }
 
-      HAL_Delay (100);
-    }
+  return ret;
+}
 
-    // rpi_touchscreen_enable
-    if(ret == RASPBERRYPI_OK)
-    {
-      // Turn on the backlight
-      val = 0xFF;
-      ret = raspberrypi_write_i2c_reg(&pObj->Ctx, RASPBERRYPI_REG_PWM, &val, 1);
-
-      /* Default to the same orientation as the closed source
-       * firmware used for the panel.  Runtime rotation
-       * configuration will be supported using VC4's plane
-       * orientation bits.
-       */
-      val = RASPBERRYPI_PA_LCD_LR;
-      ret += raspberrypi_write_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_PORTA, &val, 1); // Set orientation
-      HAL_Delay (10);
-    }
+/**
+  * @brief  Profiles the next runs of an init script. The time (ms) from the
+  *         start of the script at which its instruction i is run is stored
+  *         in pTicks[i], for the first Nbr instructions.
+  * @param  Script   RASPBERRYPI_SCRIPT_PREINIT or RASPBERRYPI_SCRIPT_INIT
+  * @param  pTicks   Profile buffer or NULL to stop profiling
+  * @param  Nbr      Number of entries of pTicks
+  * @retval Component status
+  */
+int32_t RASPBERRYPI_SetProfile(uint32_t Script, uint32_t *pTicks, uint32_t Nbr)
+{
+  int32_t ret = RASPBERRYPI_OK;
 
-    if(ret != RASPBERRYPI_OK)
-    {
-      ret = RASPBERRYPI_ERROR;
-    } else {
-      pObj->IsInitialized = 1;
-    }
+  if(Script >= RASPBERRYPI_SCRIPT_NBR)
+  {
+    ret = RASPBERRYPI_ERROR;
+  }
+  else
+  {
+    RASPBERRYPI_Profiles[Script].pTicks = pTicks;
+    RASPBERRYPI_Profiles[Script].Nbr    = (pTicks != NULL) ? Nbr : 0U;
   }
 
   return ret;
@@ -498,7 +448,7 @@ int32_t RASPBERRYPI_ReadID(RASPBERRYPI_Object_t *pObj, uint32_t *Id)
   uint8_t tmp;
 
   // Read version
-  ret += raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_ID, &tmp, 1); // Ensure bridge, and tp stay in reset
+  ret = raspberrypi_read_i2c_reg (&pObj->Ctx, RASPBERRYPI_REG_ID, &tmp, 1); // Ensure bridge, and tp stay in reset
   if (ret == RASPBERRYPI_OK)
   {
     *Id = tmp;
@@ -834,6 +784,132 @@ static void RASPBERRYPI_SetI2C_Address(RASPBERRYPI_Object_t *pObj, uint8_t Addre
   pObj->IO.Address = Address;
 }
 
+/**
+  * @brief  Starts an init script
+  * @param  pObj    Component object
+  * @param  Script  RASPBERRYPI_SCRIPT_PREINIT or RASPBERRYPI_SCRIPT_INIT
+  */
+static void RASPBERRYPI_StartScript(RASPBERRYPI_Object_t *pObj, uint8_t Script)
+{
+  pObj->pScript     = RASPBERRYPI_Scripts[Script];
+  pObj->Script      = Script;
+  pObj->Pc          = 0U;
+  pObj->Step        = 0U;
+  pObj->Retry       = 0U;
+  pObj->Delay       = 0U;
+  pObj->TickStart   = (uint32_t)pObj->IO.GetTick();
+  pObj->ScriptStart = pObj->TickStart;
+}
+
+/**
+  * @brief  Runs the script instruction at pObj->Pc and sets the delay before
+  *         the next one. Consecutive DSI writes to contiguous registers are
+  *         sent in a single packet of up to RASPBERRYPI_DSI_BURST_MAX registers.
+  *         A poll is run again until a bit is set or it was tried Tries times.
+  * @param  pObj   Component object
+  * @retval Component status
+  */
+static int32_t RASPBERRYPI_RunInstruction(RASPBERRYPI_Object_t *pObj)
+{
+  int32_t ret = RASPBERRYPI_OK;
+  const uint8_t *pIns = &pObj->pScript[pObj->Pc];
+  uint32_t data[RASPBERRYPI_DSI_BURST_MAX];
+  uint16_t size = 0U, reg;
+  uint8_t val, nbr = 1U;
+
+  switch(pIns[0])
+  {
+  case RASPBERRYPI_OP_I2C_WRITE:
+    val = pIns[2];
+    ret = raspberrypi_write_i2c_reg(&pObj->Ctx, pIns[1], &val, 1);
+    size = 3U;
+    break;
+  case RASPBERRYPI_OP_I2C_CLEAR:
+  case RASPBERRYPI_OP_I2C_SET:
+    ret = raspberrypi_read_i2c_reg(&pObj->Ctx, pIns[1], &val, 1);
+    if(ret == RASPBERRYPI_OK)
+    {
+      val = (pIns[0] == RASPBERRYPI_OP_I2C_SET) ? (val | pIns[2]) : (val & (uint8_t)~pIns[2]);
+      ret = raspberrypi_write_i2c_reg(&pObj->Ctx, pIns[1], &val, 1);
+    }
+    size = 3U;
+    break;
+  case RASPBERRYPI_OP_I2C_POLL:
+    if(pObj->Retry == 0U)
+    {
+      pObj->Retry = pIns[3];
+    }
+    val = 0x00;
+    ret = raspberrypi_read_i2c_reg(&pObj->Ctx, pIns[1], &val, 1);
+    if((ret == RASPBERRYPI_OK) && ((val & pIns[2]) == 0U) && (pObj->Retry > 1U))
+    {
+      /* Try again after the interval */
+      pObj->Retry--;
+      pObj->Delay = pIns[4];
+    }
+    else
+    {
+      size = 5U;
+    }
+    break;
+  case RASPBERRYPI_OP_DSI_WRITE:
+    reg = RASPBERRYPI_RD16(&pIns[1]);
+    data[0] = RASPBERRYPI_RD32(&pIns[3]);
+    size = 7U;
+    while((nbr < RASPBERRYPI_DSI_BURST_MAX) && (pIns[size] == RASPBERRYPI_OP_DSI_WRITE) &&
+          (RASPBERRYPI_RD16(&pIns[size + 1U]) == (uint16_t)(reg + (4U * nbr))))
+    {
+      data[nbr] = RASPBERRYPI_RD32(&pIns[size + 3U]);
+      nbr++;
+      size += 7U;
+    }
+    ret = raspberrypi_write_dsi_regs(&pObj->Ctx, reg, data, nbr);
+    break;
+  case RASPBERRYPI_OP_DELAY:
+    pObj->Delay = RASPBERRYPI_RD16(&pIns[1]);
+    size = 3U;
+    break;
+  default:
+    ret = RASPBERRYPI_ERROR;
+    break;
+  }
+
+  if(ret != RASPBERRYPI_OK)
+  {
+    ret = RASPBERRYPI_ERROR;
+  }
+  else if(size != 0U)
+  {
+    RASPBERRYPI_NextInstruction(pObj, size, nbr);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Moves to the next script instruction and profiles the run ones
+  * @param  pObj   Component object
+  * @param  Size   Size of the run instructions, in bytes
+  * @param  Nbr    Number of run instructions
+  */
+static void RASPBERRYPI_NextInstruction(RASPBERRYPI_Object_t *pObj, uint16_t Size, uint8_t Nbr)
+{
+  const RASPBERRYPI_Profile_t *profile = &RASPBERRYPI_Profiles[pObj->Script];
+  uint32_t tick = (uint32_t)pObj->IO.GetTick() - pObj->ScriptStart;
+  uint8_t i;
+
+  for(i = 0U; i < Nbr; i++)
+  {
+    if(pObj->Step < profile->Nbr)
+    {
+      profile->pTicks[pObj->Step] = tick;
+    }
+    pObj->Step++;
+  }
+  pObj->Pc   += Size;
+  pObj->Retry = 0U;
+}
+
 /**
   * @brief  Wrap component ReadReg to Bus Read function
   * @param  Handle  Component object handle
@@ -78,6 +78,14 @@ typedef struct
   RASPBERRYPI_IO_t       IO;
   raspberrypi_ctx_t      Ctx; 
   uint8_t              IsInitialized;
+  const uint8_t       *pScript;     /* Init script run by RASPBERRYPI_Process()      */
+  uint16_t             Pc;          /* Offset of the next instruction                */
+  uint8_t              Script;      /* RASPBERRYPI_SCRIPT_xxx being run              */
+  uint8_t              Step;        /* Index of the next instruction                 */
+  uint8_t              Retry;       /* Tries left on the current poll                */
+  uint32_t             ScriptStart; /* Start of the script                           */
+  uint32_t             TickStart;   /* Start of the current delay                    */
+  uint32_t             Delay;       /* Delay (ms) before the next instruction        */
 } RASPBERRYPI_Object_t;
 
 typedef struct
@@ -113,6 +121,7 @@ typedef struct
 
 #define RASPBERRYPI_OK                (0)
 #define RASPBERRYPI_ERROR             (-1)
+#define RASPBERRYPI_BUSY              (1)
 
 #define RASPBERRYPI_I2C_ADDR          0x45U
 
@@ -134,6 +143,40 @@ typedef struct
 #define RASPBERRYPI_FORMAT_RGB888    ((uint32_t)0x00) /* Pixel format chosen is RGB888 : 24 bpp */
 #define RASPBERRYPI_FORMAT_RBG565    ((uint32_t)0x02) /* Pixel format chosen is RGB565 : 16 bpp */
 
+/**
+ *  @brief  Init scripts run by RASPBERRYPI_PreInitStart() and RASPBERRYPI_InitStart()
+ */
+#define RASPBERRYPI_SCRIPT_PREINIT   0U  /* Power up over I2C, before the DSI host is started */
+#define RASPBERRYPI_SCRIPT_INIT      1U  /* TC358762 setup over DSI and backlight on          */
+#define RASPBERRYPI_SCRIPT_NBR       2U
+
+/**
+ *  @brief  Init script opcodes. A script is a byte array of instructions,
+ *  an opcode followed by its operands, little endian when wider than a byte.
+ */
+#define RASPBERRYPI_OP_END           0x00U  /* End of the script                                 */
+#define RASPBERRYPI_OP_I2C_WRITE     0x01U  /* Reg, Value                                        */
+#define RASPBERRYPI_OP_I2C_CLEAR     0x02U  /* Reg, Mask: read-modify-write clearing Mask bits   */
+#define RASPBERRYPI_OP_I2C_SET       0x03U  /* Reg, Mask: read-modify-write setting Mask bits    */
+#define RASPBERRYPI_OP_I2C_POLL      0x04U  /* Reg, Mask, Tries, Interval (ms): read until a Mask
+                                               bit is set, going on after Tries reads           */
+#define RASPBERRYPI_OP_DSI_WRITE     0x05U  /* Reg (16 bits), Value (32 bits)                    */
+#define RASPBERRYPI_OP_DELAY         0x06U  /* Delay (ms, 16 bits)                               */
+
+/**
+ *  @brief  Init script instructions
+ */
+#define RASPBERRYPI_SCRIPT_I2C_WRITE(Reg, Value)  RASPBERRYPI_OP_I2C_WRITE, (uint8_t)(Reg), (uint8_t)(Value)
+#define RASPBERRYPI_SCRIPT_I2C_CLEAR(Reg, Mask)   RASPBERRYPI_OP_I2C_CLEAR, (uint8_t)(Reg), (uint8_t)(Mask)
+#define RASPBERRYPI_SCRIPT_I2C_SET(Reg, Mask)     RASPBERRYPI_OP_I2C_SET, (uint8_t)(Reg), (uint8_t)(Mask)
+#define RASPBERRYPI_SCRIPT_I2C_POLL(Reg, Mask, Tries, Interval) \
+  RASPBERRYPI_OP_I2C_POLL, (uint8_t)(Reg), (uint8_t)(Mask), (uint8_t)(Tries), (uint8_t)(Interval)
+#define RASPBERRYPI_SCRIPT_DSI_WRITE(Reg, Value) \
+  RASPBERRYPI_OP_DSI_WRITE, (uint8_t)(Reg), (uint8_t)((Reg) >> 8), \
+  (uint8_t)(Value), (uint8_t)((Value) >> 8), (uint8_t)((Value) >> 16), (uint8_t)((Value) >> 24)
+#define RASPBERRYPI_SCRIPT_DELAY(Ms)              RASPBERRYPI_OP_DELAY, (uint8_t)(Ms), (uint8_t)((Ms) >> 8)
+#define RASPBERRYPI_SCRIPT_END                    RASPBERRYPI_OP_END
+
 /**
   * @brief  RASPBERRYPI_480X800 Size
   */
@@ -198,6 +241,11 @@ typedef struct
 int32_t RASPBERRYPI_RegisterBusIO (RASPBERRYPI_Object_t *pObj, RASPBERRYPI_IO_t *pIO);
 int32_t RASPBERRYPI_PreInit(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation);
 int32_t RASPBERRYPI_Init(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation);
+int32_t RASPBERRYPI_PreInitStart(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation);
+int32_t RASPBERRYPI_InitStart(RASPBERRYPI_Object_t *pObj, uint32_t ColorCoding, uint32_t Orientation);
+int32_t RASPBERRYPI_Process(RASPBERRYPI_Object_t *pObj);
+int32_t RASPBERRYPI_SetScript(uint32_t Script, const uint8_t *pScript);
+int32_t RASPBERRYPI_SetProfile(uint32_t Script, uint32_t *pTicks, uint32_t Nbr);
 int32_t RASPBERRYPI_DeInit(RASPBERRYPI_Object_t *pObj);
 int32_t RASPBERRYPI_ReadID(RASPBERRYPI_Object_t *pObj, uint32_t *Id);
 int32_t RASPBERRYPI_DisplayOn(RASPBERRYPI_Object_t *pObj);
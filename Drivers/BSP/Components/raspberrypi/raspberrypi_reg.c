@@ -95,6 +95,36 @@ int32_t raspberrypi_write_dsi_reg(raspberrypi_ctx_t *ctx, uint16_t reg, const ui
   return ctx->WriteDSIReg(ctx->handle, msg[0], (uint8_t *)(&msg[1]), 5);
 }
 
+/*******************************************************************************
+* Function Name : raspberrypi_write_dsi_regs
+* Description   : Burst writing function. Writes contiguous registers in a
+*                 single DSI long packet
+* Input         : First register address, Data to be written, number of registers
+*                 (up to RASPBERRYPI_DSI_BURST_MAX)
+* Output        : None
+*******************************************************************************/
+int32_t raspberrypi_write_dsi_regs(raspberrypi_ctx_t *ctx, uint16_t reg, const uint32_t *pdata, uint16_t nbr)
+{
+  uint8_t msg[2U + (4U * RASPBERRYPI_DSI_BURST_MAX)];
+  uint16_t i;
+
+  if((nbr == 0U) || (nbr > RASPBERRYPI_DSI_BURST_MAX))
+  {
+    return -1;
+  }
+
+  msg[0] = (uint8_t)reg;
+  msg[1] = (uint8_t)(reg >> 8);
+  for(i = 0U; i < nbr; i++)
+  {
+    msg[2U + (4U * i)] = (uint8_t)pdata[i];
+    msg[3U + (4U * i)] = (uint8_t)(pdata[i] >> 8);
+    msg[4U + (4U * i)] = (uint8_t)(pdata[i] >> 16);
+    msg[5U + (4U * i)] = (uint8_t)(pdata[i] >> 24);
+  }
+  return ctx->WriteDSIReg(ctx->handle, msg[0], &msg[1], (uint16_t)(1U + (4U * nbr)));
+}
+
 /**
   * @}
   */
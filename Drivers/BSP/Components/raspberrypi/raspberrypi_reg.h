@@ -161,6 +161,12 @@
 #define RASPBERRYPI_LANEENABLE_L0EN		                    _RPI_BIT(1)
 #define RASPBERRYPI_LANEENABLE_L1EN		                    _RPI_BIT(2)
 
+/* TC358762 registers written by one DSI long packet, the bridge increments
+   the register address by 4 after each data word. 1 disables the bursts */
+#ifndef RASPBERRYPI_DSI_BURST_MAX
+#define RASPBERRYPI_DSI_BURST_MAX                         4U
+#endif /* RASPBERRYPI_DSI_BURST_MAX */
+
 /**
   * @}
   */
@@ -206,6 +212,7 @@ int32_t raspberrypi_read_i2c_reg(raspberrypi_ctx_t *ctx, uint16_t reg, uint8_t *
 int32_t raspberrypi_write_i2c_reg(raspberrypi_ctx_t *ctx, uint16_t reg, const uint8_t *pdata, uint16_t length);
 int32_t raspberrypi_read_dsi_reg(raspberrypi_ctx_t *ctx, uint16_t reg, uint32_t pdata);
 int32_t raspberrypi_write_dsi_reg(raspberrypi_ctx_t *ctx, uint16_t reg, const uint32_t pdata);
+int32_t raspberrypi_write_dsi_regs(raspberrypi_ctx_t *ctx, uint16_t reg, const uint32_t *pdata, uint16_t nbr);
 
 /**
   * @}
@@ -54,6 +54,7 @@
 #define I2C_SCLH_MAX                           256U
 #define I2C_SCLL_MAX                           256U
 #define SEC2NSEC                               1000000000UL
+#define BUS_I2C4_TIMEOUT                       1000U /* ms */
 /**
   * @}
   */
@@ -152,6 +153,16 @@ static uint32_t      I2c_valid_timing_nbr = 0;
 #if defined(BSP_USE_CMSIS_OS)
 static osSemaphoreId BspI2cSemaphore = 0;
 #endif
+#if (USE_BSP_I2C4_QUEUE == 1)
+static BSP_I2C4_Xfer_t *volatile I2c4Pending = NULL;   /* Pending transfers, by priority */
+static BSP_I2C4_Xfer_t *volatile I2c4Current = NULL;   /* Transfer on the bus            */
+static volatile uint32_t I2c4Hold = 0U;               /* Bus reserved for a polled access */
+static uint32_t I2c4StartTime;
+static uint32_t I2c4LastError;
+/* Lower is more urgent: touch reads go before the panel keep-alive, audio and camera uploads */
+static uint32_t I2c4Priority[BSP_I2C4_DEV_NBR] = {0U, 1U, 2U, 3U, 3U};
+static BSP_I2C4_Stats_t I2c4Stats[BSP_I2C4_DEV_NBR];
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 /**
   * @}
   */
@@ -174,6 +185,17 @@ static int32_t I2C4_ReadReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
 static uint32_t I2C_GetTiming(uint32_t clock_src_freq, uint32_t i2c_freq);
 static uint32_t I2C_Compute_SCLL_SCLH(uint32_t clock_src_freq, uint32_t I2C_speed);
 static void     I2C_Compute_PRESC_SCLDEL_SDADEL(uint32_t clock_src_freq, uint32_t I2C_speed);
+static uint32_t I2C4_GetError(void);
+#if (USE_BSP_I2C4_QUEUE == 1)
+static int32_t  I2C4_Transfer(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length, uint32_t Read);
+static BSP_I2C4_Device_t I2C4_GetDevice(uint16_t DevAddr);
+static void     I2C4_Kick(void);
+static void     I2C4_Complete(int32_t Status);
+static void     I2C4_Recover(void);
+static uint32_t I2C4_Wait(uint32_t Start);
+static void     I2C4_XferCpltCallback(I2C_HandleTypeDef *hi2c);
+static void     I2C4_XferErrorCallback(I2C_HandleTypeDef *hi2c);
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 /**
   * @}
   */
@@ -227,6 +249,29 @@ int32_t BSP_I2C4_Init(void)
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
       }
 #endif
+#if (USE_BSP_I2C4_QUEUE == 1)
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+      if (ret == BSP_ERROR_NONE)
+      {
+        if ((HAL_I2C_RegisterCallback(&hbus_i2c4, HAL_I2C_MEM_TX_COMPLETE_CB_ID, I2C4_XferCpltCallback) != HAL_OK) ||
+            (HAL_I2C_RegisterCallback(&hbus_i2c4, HAL_I2C_MEM_RX_COMPLETE_CB_ID, I2C4_XferCpltCallback) != HAL_OK) ||
+            (HAL_I2C_RegisterCallback(&hbus_i2c4, HAL_I2C_ERROR_CB_ID, I2C4_XferErrorCallback) != HAL_OK))
+        {
+          ret = BSP_ERROR_PERIPH_FAILURE;
+        }
+      }
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS == 1 */
+      if (ret == BSP_ERROR_NONE)
+      {
+        /* Time the transfers for the bus statistics */
+        BSP_EnableCycleCounter();
+
+        HAL_NVIC_SetPriority(I2C4_EV_IRQn, BSP_I2C4_IT_PRIORITY, 0);
+        HAL_NVIC_EnableIRQ(I2C4_EV_IRQn);
+        HAL_NVIC_SetPriority(I2C4_ER_IRQn, BSP_I2C4_IT_PRIORITY, 0);
+        HAL_NVIC_EnableIRQ(I2C4_ER_IRQn);
+      }
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
     }
   }
 
@@ -244,6 +289,10 @@ int32_t BSP_I2C4_DeInit(void)
   I2c4InitCounter--;
   if (I2c4InitCounter == 0U)
   {
+#if (USE_BSP_I2C4_QUEUE == 1)
+    HAL_NVIC_DisableIRQ(I2C4_EV_IRQn);
+    HAL_NVIC_DisableIRQ(I2C4_ER_IRQn);
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 0)
     I2C4_MspDeInit(&hbus_i2c4);
 #endif /* (USE_HAL_I2C_REGISTER_CALLBACKS == 0) */
@@ -323,7 +372,7 @@ int32_t BSP_I2C4_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16
   }
   else
   {
-    if( HAL_I2C_GetError(&hbus_i2c4) == HAL_I2C_ERROR_AF)
+    if(I2C4_GetError() == HAL_I2C_ERROR_AF)
     {
       ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
     }
@@ -360,7 +409,7 @@ int32_t BSP_I2C4_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_
   }
   else
   {
-    if( HAL_I2C_GetError(&hbus_i2c4) == HAL_I2C_ERROR_AF)
+    if(I2C4_GetError() == HAL_I2C_ERROR_AF)
     {
       ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
     }
@@ -397,7 +446,7 @@ int32_t BSP_I2C4_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
   }
   else
   {
-    if( HAL_I2C_GetError(&hbus_i2c4) == HAL_I2C_ERROR_AF)
+    if(I2C4_GetError() == HAL_I2C_ERROR_AF)
     {
       ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
     }
@@ -434,7 +483,7 @@ int32_t BSP_I2C4_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
   }
   else
   {
-    if( HAL_I2C_GetError(&hbus_i2c4) == HAL_I2C_ERROR_AF)
+    if(I2C4_GetError() == HAL_I2C_ERROR_AF)
     {
       ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
     }
@@ -464,10 +513,31 @@ int32_t BSP_I2C4_IsReady(uint16_t DevAddr, uint32_t Trials)
   /* Get semaphore to prevent multiple I2C access */
   osSemaphoreWait(BspI2cSemaphore, osWaitForever);
 #endif
+#if (USE_BSP_I2C4_QUEUE == 1)
+  uint32_t start = DWT->CYCCNT;
+  uint32_t primask;
+
+  /* The HAL has no interrupt mode probe: hold the queue while the bus is polled */
+  I2c4Hold = 1U;
+  while((I2c4Current != NULL) && (I2C4_Wait(start) != 0U))
+  {
+  }
+  if(I2c4Current != NULL)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    I2C4_Recover();
+    __set_PRIMASK(primask);
+  }
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
   if(HAL_I2C_IsDeviceReady(&hbus_i2c4, DevAddr, Trials, 1000) != HAL_OK)
   {
     ret = BSP_ERROR_BUSY;
   }
+#if (USE_BSP_I2C4_QUEUE == 1)
+  I2c4Hold = 0U;
+  I2C4_Kick();
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 #if defined(BSP_USE_CMSIS_OS)
   /* Release semaphore to prevent multiple I2C access */
   osSemaphoreRelease(BspI2cSemaphore);
@@ -484,6 +554,247 @@ int32_t BSP_GetTick(void)
   return (int32_t)HAL_GetTick();
 }
 
+/**
+  * @brief  Enables the DWT cycle counter, used by the BSP to time transfers and
+  *         draws and to bound the waits that cannot rely on the HAL tick.
+  * @retval None
+  */
+void BSP_EnableCycleCounter(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#if (USE_BSP_I2C4_QUEUE == 1)
+/**
+  * @brief  Queues a register transfer on I2C4. The transfers are run by the I2C4
+  *         interrupt, the most urgent device first and in submission order
+  *         for a given device, so a touch read waits at most for the transfer
+  *         already on the bus.
+  * @note   pXfer and its data buffer must stay valid until pXfer->Status is no
+  *         longer BSP_ERROR_BUSY. The callback runs in interrupt context.
+  * @param  pXfer  Transfer to queue
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_Submit(BSP_I2C4_Xfer_t *pXfer)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_I2C4_Xfer_t **pp;
+  uint32_t primask;
+
+  if((pXfer == NULL) || (pXfer->Device >= BSP_I2C4_DEV_NBR) || ((pXfer->pData == NULL) && (pXfer->Length != 0U)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(I2c4InitCounter == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    pXfer->Status    = BSP_ERROR_BUSY;
+    pXfer->QueueTime = DWT->CYCCNT;
+    pXfer->pNext     = NULL;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Behind the pending transfers of the same or a more urgent priority */
+    pp = (BSP_I2C4_Xfer_t **)&I2c4Pending;
+    while((*pp != NULL) && (I2c4Priority[(*pp)->Device] <= I2c4Priority[pXfer->Device]))
+    {
+      pp = &(*pp)->pNext;
+    }
+    pXfer->pNext = *pp;
+    *pp = pXfer;
+
+    I2C4_Kick();
+    __set_PRIMASK(primask);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Sets the priority of the transfers of a device.
+  * @param  Device    Device
+  * @param  Priority  0 for the most urgent device
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_SetPriority(BSP_I2C4_Device_t Device, uint32_t Priority)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if(Device >= BSP_I2C4_DEV_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Applies to the transfers submitted from now on */
+    I2c4Priority[Device] = Priority;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the bus occupancy statistics of a device since the last
+  *         BSP_I2C4_ResetStats() call.
+  * @param  Device  Device
+  * @param  Stats   Pointer to the statistics to fill
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_GetStats(BSP_I2C4_Device_t Device, BSP_I2C4_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  if((Device >= BSP_I2C4_DEV_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *Stats = I2c4Stats[Device];
+    __set_PRIMASK(primask);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Clears the bus occupancy statistics of all the devices.
+  * @retval None
+  */
+void BSP_I2C4_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+  for(i = 0U; i < (uint32_t)BSP_I2C4_DEV_NBR; i++)
+  {
+    I2c4Stats[i].Transfers = 0U;
+    I2c4Stats[i].Bytes     = 0U;
+    I2c4Stats[i].Errors    = 0U;
+    I2c4Stats[i].BusTime   = 0U;
+    I2c4Stats[i].MaxWait   = 0U;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Handles I2C4 event interrupt request.
+  * @retval None
+  */
+void BSP_I2C4_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hbus_i2c4);
+}
+
+/**
+  * @brief  Handles I2C4 error interrupt request.
+  * @retval None
+  */
+void BSP_I2C4_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hbus_i2c4);
+}
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 0)
+/**
+  * @brief  Memory Tx transfer completed callback. The events of the other I2C
+  *         instances are passed to BSP_I2C_MemTxCpltCallback().
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if(hi2c == &hbus_i2c4)
+  {
+    I2C4_XferCpltCallback(hi2c);
+  }
+  else
+  {
+    BSP_I2C_MemTxCpltCallback(hi2c);
+  }
+}
+
+/**
+  * @brief  Memory Rx transfer completed callback. The events of the other I2C
+  *         instances are passed to BSP_I2C_MemRxCpltCallback().
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if(hi2c == &hbus_i2c4)
+  {
+    I2C4_XferCpltCallback(hi2c);
+  }
+  else
+  {
+    BSP_I2C_MemRxCpltCallback(hi2c);
+  }
+}
+
+/**
+  * @brief  I2C error callback. The errors of the other I2C instances are
+  *         passed to BSP_I2C_ErrorCallback().
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if(hi2c == &hbus_i2c4)
+  {
+    I2C4_XferErrorCallback(hi2c);
+  }
+  else
+  {
+    BSP_I2C_ErrorCallback(hi2c);
+  }
+}
+
+/**
+  * @brief  Memory Tx transfer completed on an I2C instance other than I2C4.
+  *         The queue owns the HAL callback: the application overrides this one.
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+__weak void BSP_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  UNUSED(hi2c);
+}
+
+/**
+  * @brief  Memory Rx transfer completed on an I2C instance other than I2C4.
+  *         The queue owns the HAL callback: the application overrides this one.
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+__weak void BSP_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  UNUSED(hi2c);
+}
+
+/**
+  * @brief  Error on an I2C instance other than I2C4.
+  *         The queue owns the HAL callback: the application overrides this one.
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+__weak void BSP_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  UNUSED(hi2c);
+}
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS == 0 */
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
 /**
   * @brief Register Default I2C4 Bus Msp Callbacks
@@ -838,12 +1149,16 @@ static void I2C4_MspDeInit(I2C_HandleTypeDef *phi2c)
   */
 static int32_t I2C4_WriteReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
 {
+#if (USE_BSP_I2C4_QUEUE == 1)
+  return I2C4_Transfer(DevAddr, Reg, MemAddSize, pData, Length, 0U);
+#else
   if(HAL_I2C_Mem_Write(&hbus_i2c4, DevAddr, Reg, MemAddSize, pData, Length, 1000) == HAL_OK)
   {
     return BSP_ERROR_NONE;
   }
 
   return BSP_ERROR_BUS_FAILURE;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 }
 
 /**
@@ -857,13 +1172,280 @@ static int32_t I2C4_WriteReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize
   */
 static int32_t I2C4_ReadReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
 {
+#if (USE_BSP_I2C4_QUEUE == 1)
+  return I2C4_Transfer(DevAddr, Reg, MemAddSize, pData, Length, 1U);
+#else
   if (HAL_I2C_Mem_Read(&hbus_i2c4, DevAddr, Reg, MemAddSize, pData, Length, 1000) == HAL_OK)
   {
     return BSP_ERROR_NONE;
   }
 
   return BSP_ERROR_BUS_FAILURE;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+}
+
+/**
+  * @brief  Gets the HAL error of the last blocking transfer.
+  * @retval HAL_I2C_ERROR_xxx
+  */
+static uint32_t I2C4_GetError(void)
+{
+#if (USE_BSP_I2C4_QUEUE == 1)
+  return I2c4LastError;
+#else
+  return HAL_I2C_GetError(&hbus_i2c4);
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+}
+
+#if (USE_BSP_I2C4_QUEUE == 1)
+/**
+  * @brief  Queues a register transfer and waits for it.
+  * @param  DevAddr    Device address on BUS
+  * @param  Reg        The target register address
+  * @param  MemAddSize Size of internal memory address
+  * @param  pData      The register value to write or read
+  * @param  Length     data length in bytes
+  * @param  Read       1 to read the register, 0 to write it
+  * @retval BSP status
+  */
+static int32_t I2C4_Transfer(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length, uint32_t Read)
+{
+  BSP_I2C4_Xfer_t xfer;
+  BSP_I2C4_Xfer_t **pp;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t primask;
+
+  xfer.Device     = I2C4_GetDevice(DevAddr);
+  xfer.DevAddr    = DevAddr;
+  xfer.Reg        = Reg;
+  xfer.MemAddSize = MemAddSize;
+  xfer.Length     = Length;
+  xfer.pData      = pData;
+  xfer.Read       = Read;
+  xfer.Callback   = NULL;
+  xfer.pArg       = NULL;
+
+  if(BSP_I2C4_Submit(&xfer) != BSP_ERROR_NONE)
+  {
+    xfer.Status = BSP_ERROR_BUS_FAILURE;
+  }
+
+  while((xfer.Status == BSP_ERROR_BUSY) && (I2C4_Wait(start) != 0U))
+  {
+  }
+
+  if(xfer.Status == BSP_ERROR_BUSY)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if(I2c4Current == &xfer)
+    {
+      /* Stuck on the bus: the HAL cannot abort memory transfers, reset I2C4
+         and go on with the pending transfers */
+      I2C4_Recover();
+    }
+    else
+    {
+      pp = (BSP_I2C4_Xfer_t **)&I2c4Pending;
+      while((*pp != NULL) && (*pp != &xfer))
+      {
+        pp = &(*pp)->pNext;
+      }
+      if(*pp != NULL)
+      {
+        *pp = xfer.pNext;
+      }
+    }
+    __set_PRIMASK(primask);
+    xfer.Status = BSP_ERROR_BUS_FAILURE;
+  }
+
+  I2c4LastError = (xfer.Status == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE) ? HAL_I2C_ERROR_AF : HAL_I2C_ERROR_NONE;
+
+  return (xfer.Status == BSP_ERROR_NONE) ? BSP_ERROR_NONE : BSP_ERROR_BUS_FAILURE;
+}
+
+/**
+  * @brief  Gets the device of a blocking transfer from its bus address.
+  * @param  DevAddr    Device address on BUS
+  * @retval Device
+  */
+static BSP_I2C4_Device_t I2C4_GetDevice(uint16_t DevAddr)
+{
+  BSP_I2C4_Device_t device;
+
+  switch(DevAddr)
+  {
+  case 0x54U:   /* FT6X06 */
+  case 0x70U:   /* FT6X06 on A02 boards */
+    device = BSP_I2C4_DEV_TOUCH;
+    break;
+  case 0x8AU:   /* RaspberryPi and Waveshare panel MCUs */
+  case 0x7AU:   /* ADV7533 */
+    device = BSP_I2C4_DEV_PANEL;
+    break;
+  case 0x34U:   /* WM8994 */
+    device = BSP_I2C4_DEV_AUDIO;
+    break;
+  case 0x60U:   /* OV9655 */
+  case 0x78U:   /* OV5640, also the ADV7533 CEC/DSI map */
+    device = BSP_I2C4_DEV_CAMERA;
+    break;
+  default:
+    device = BSP_I2C4_DEV_OTHER;
+    break;
+  }
+
+  return device;
+}
+
+/**
+  * @brief  Starts the most urgent pending transfer if the bus is free.
+  * @note   Called with the interrupts masked or from the I2C4 interrupt.
+  * @retval None
+  */
+static void I2C4_Kick(void)
+{
+  BSP_I2C4_Xfer_t *pxfer;
+  HAL_StatusTypeDef status;
+  uint32_t wait;
+
+  while((I2c4Current == NULL) && (I2c4Pending != NULL) && (I2c4Hold == 0U))
+  {
+    pxfer = I2c4Pending;
+    I2c4Pending = pxfer->pNext;
+    I2c4Current = pxfer;
+
+    I2c4StartTime = DWT->CYCCNT;
+    wait = (I2c4StartTime - pxfer->QueueTime) / (SystemCoreClock / 1000000U);
+    if(wait > I2c4Stats[pxfer->Device].MaxWait)
+    {
+      I2c4Stats[pxfer->Device].MaxWait = wait;
+    }
+
+    if(pxfer->Read != 0U)
+    {
+      status = HAL_I2C_Mem_Read_IT(&hbus_i2c4, pxfer->DevAddr, pxfer->Reg, pxfer->MemAddSize, pxfer->pData, pxfer->Length);
+    }
+    else
+    {
+      status = HAL_I2C_Mem_Write_IT(&hbus_i2c4, pxfer->DevAddr, pxfer->Reg, pxfer->MemAddSize, pxfer->pData, pxfer->Length);
+    }
+
+    if(status != HAL_OK)
+    {
+      /* Completes it, the loop then starts the next one */
+      I2C4_Complete((HAL_I2C_GetError(&hbus_i2c4) == HAL_I2C_ERROR_AF) ? BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE : BSP_ERROR_PERIPH_FAILURE);
+    }
+  }
+}
+
+/**
+  * @brief  Completes the transfer on the bus and starts the next one.
+  * @param  Status  BSP status of the transfer
+  * @retval None
+  */
+static void I2C4_Complete(int32_t Status)
+{
+  BSP_I2C4_Xfer_t *pxfer = I2c4Current;
+  BSP_I2C4_XferCb_t callback;
+  BSP_I2C4_Stats_t *pstats;
+
+  if(pxfer != NULL)
+  {
+    pstats = &I2c4Stats[pxfer->Device];
+    pstats->BusTime += (DWT->CYCCNT - I2c4StartTime) / (SystemCoreClock / 1000000U);
+    if(Status == BSP_ERROR_NONE)
+    {
+      pstats->Transfers++;
+      pstats->Bytes += pxfer->Length;
+    }
+    else
+    {
+      pstats->Errors++;
+    }
+
+    /* A blocking caller may return as soon as Status is set */
+    callback = pxfer->Callback;
+    I2c4Current = NULL;
+    pxfer->Status = Status;
+    if(callback != NULL)
+    {
+      callback(pxfer);
+    }
+  }
+
+  I2C4_Kick();
+}
+
+/**
+  * @brief  Resets I2C4 after a transfer that never completed. The transfer is
+  *         completed with BSP_ERROR_BUS_FAILURE, its callback is called and
+  *         the next pending transfer is started unless the bus is held.
+  * @note   Called with the interrupts masked.
+  * @retval None
+  */
+static void I2C4_Recover(void)
+{
+  (void)HAL_I2C_DeInit(&hbus_i2c4);
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 0)
+  I2C4_MspInit(&hbus_i2c4);
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS == 0 */
+  (void)MX_I2C4_Init(&hbus_i2c4, I2C_GetTiming(HAL_RCC_GetPCLK2Freq(), BUS_I2C4_FREQUENCY));
+
+  I2C4_Complete(BSP_ERROR_BUS_FAILURE);
+}
+
+/**
+  * @brief  Waits for the queued transfers. When the I2C4 interrupts cannot
+  *         preempt the caller (interrupts masked, or handler mode at the same
+  *         or a higher priority), they are served here. The timeout runs on
+  *         the DWT cycle counter, as the HAL tick may be frozen too.
+  * @param  Start  DWT->CYCCNT value at the start of the wait
+  * @retval 1 while BUS_I2C4_TIMEOUT is not elapsed, 0 otherwise
+  */
+static uint32_t I2C4_Wait(uint32_t Start)
+{
+  uint32_t primask;
+
+  if((__get_PRIMASK() != 0U) || (__get_IPSR() != 0U))
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    HAL_I2C_EV_IRQHandler(&hbus_i2c4);
+    HAL_I2C_ER_IRQHandler(&hbus_i2c4);
+    __set_PRIMASK(primask);
+  }
+
+  return (((DWT->CYCCNT - Start) / (SystemCoreClock / 1000U)) < BUS_I2C4_TIMEOUT) ? 1U : 0U;
+}
+
+/**
+  * @brief  I2C4 memory transfer completed.
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+static void I2C4_XferCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if(hi2c == &hbus_i2c4)
+  {
+    I2C4_Complete(BSP_ERROR_NONE);
+  }
+}
+
+/**
+  * @brief  I2C4 transfer error.
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+static void I2C4_XferErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if(hi2c == &hbus_i2c4)
+  {
+    I2C4_Complete(((HAL_I2C_GetError(hi2c) & HAL_I2C_ERROR_AF) != 0U) ? BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE : BSP_ERROR_PERIPH_FAILURE);
+  }
 }
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 
 /**
   * @}
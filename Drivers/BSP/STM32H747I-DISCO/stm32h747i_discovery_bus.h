@@ -54,6 +54,46 @@ typedef struct
 }BSP_I2C_Cb_t;
 #endif /* (USE_HAL_I2C_REGISTER_CALLBACKS == 1) */
 
+#if (USE_BSP_I2C4_QUEUE == 1)
+typedef enum
+{
+  BSP_I2C4_DEV_TOUCH = 0U,     /* FT6X06 touch controller                 */
+  BSP_I2C4_DEV_PANEL,          /* RaspberryPi/Waveshare panel MCU, ADV7533 */
+  BSP_I2C4_DEV_AUDIO,          /* WM8994 audio codec                      */
+  BSP_I2C4_DEV_CAMERA,         /* OV5640/OV9655 camera sensors            */
+  BSP_I2C4_DEV_OTHER,          /* Any other device                        */
+  BSP_I2C4_DEV_NBR
+} BSP_I2C4_Device_t;
+
+typedef struct BSP_I2C4_Xfer_s BSP_I2C4_Xfer_t;
+typedef void (* BSP_I2C4_XferCb_t)(BSP_I2C4_Xfer_t *pXfer);
+
+struct BSP_I2C4_Xfer_s
+{
+  BSP_I2C4_Device_t  Device;      /* Device, selects the priority of the transfer      */
+  uint16_t           DevAddr;     /* Device address on bus                             */
+  uint16_t           Reg;         /* Register address                                  */
+  uint16_t           MemAddSize;  /* I2C_MEMADD_SIZE_8BIT or I2C_MEMADD_SIZE_16BIT      */
+  uint16_t           Length;      /* Data length in bytes                              */
+  uint8_t           *pData;       /* Data to write or read buffer                      */
+  uint32_t           Read;        /* 1 to read the register, 0 to write it             */
+  BSP_I2C4_XferCb_t  Callback;    /* Called from the I2C4 interrupt once done, or NULL */
+  void              *pArg;        /* User argument for the callback                    */
+  volatile int32_t   Status;      /* BSP_ERROR_BUSY until done, then the BSP status    */
+  uint32_t           QueueTime;   /* Private: DWT cycle count at submission            */
+  BSP_I2C4_Xfer_t   *pNext;       /* Private: next pending transfer                    */
+};
+
+typedef struct
+{
+  uint32_t Transfers;          /* Completed transfers                              */
+  uint32_t Bytes;              /* Data bytes transferred                           */
+  uint32_t Errors;             /* Failed transfers                                 */
+  uint32_t BusTime;            /* Time the device transfers held the bus (us)      */
+  uint32_t MaxWait;            /* Longest time a transfer waited in the queue (us) */
+} BSP_I2C4_Stats_t;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
 /**
   * @}
   */
@@ -84,6 +124,15 @@ typedef struct
    #define BUS_I2C4_FREQUENCY  100000U /* Frequency of I2Cn = 100 KHz*/
 #endif
 
+/* Interrupt driven I2C4 transfers, queued by device priority */
+#ifndef USE_BSP_I2C4_QUEUE
+   #define USE_BSP_I2C4_QUEUE  0U
+#endif
+
+#ifndef BSP_I2C4_IT_PRIORITY
+   #define BSP_I2C4_IT_PRIORITY  14U
+#endif
+
 /**
   * @}
   */
@@ -107,6 +156,20 @@ int32_t BSP_I2C4_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
 int32_t BSP_I2C4_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C4_IsReady(uint16_t DevAddr, uint32_t Trials);
 int32_t BSP_GetTick(void);
+void    BSP_EnableCycleCounter(void);
+#if (USE_BSP_I2C4_QUEUE == 1)
+int32_t BSP_I2C4_Submit(BSP_I2C4_Xfer_t *pXfer);
+int32_t BSP_I2C4_SetPriority(BSP_I2C4_Device_t Device, uint32_t Priority);
+int32_t BSP_I2C4_GetStats(BSP_I2C4_Device_t Device, BSP_I2C4_Stats_t *Stats);
+void    BSP_I2C4_ResetStats(void);
+void    BSP_I2C4_EV_IRQHandler(void);
+void    BSP_I2C4_ER_IRQHandler(void);
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 0)
+void    BSP_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void    BSP_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void    BSP_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS == 0 */
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
 int32_t BSP_I2C4_RegisterDefaultMspCallbacks (void);
 int32_t BSP_I2C4_RegisterMspCallbacks (BSP_I2C_Cb_t *Callback);
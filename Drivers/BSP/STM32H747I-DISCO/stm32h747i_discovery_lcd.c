@@ -45,6 +45,43 @@
        To initialize DSI in command mode, user have to override MX_DSIHOST_DSI_Init(), weak function,
        content at application level.
 
+     o The DSI timings, DSI PLL, PLL3, polarities and probe hooks of each supported
+       panel are held in a BSP_LCD_Panel_t descriptor. The panel is auto-detected
+       unless Lcd_Driver_Type is set, or a custom descriptor (other timings or clocks
+       of a supported panel) is selected using BSP_LCD_SetPanel() before BSP_LCD_InitEx().
+       Get the descriptor of the initialized panel using BSP_LCD_GetPanel().
+     o Compute the DSI PLL and PLL3 settings of a copy of a panel descriptor for a
+       refresh rate and lane count using BSP_LCD_ComputeClocks(), then select it
+       using BSP_LCD_SetPanel().
+     o The XRES reset pulse and the RASPBERRYPI panel delays do not block the CPU:
+       BSP_LCD_InitEx() starts the initialization and returns with the reset
+       pulse running. Call
+       BSP_LCD_InitPoll() from the application boot loop until it no longer
+       returns BSP_ERROR_BUSY: each call runs the steps due and returns, the SDRAM
+       is initialized during the first delay. Or call BSP_LCD_InitWait(), which
+       calls BSP_LCD_InitIdleCallback(), weak function, repeatedly until the end
+       so the application can overlap its own boot work (asset loading ...).
+       BSP_LCD_Init() waits for the end. Get the boot-to-first-frame time and
+       the overlapped time using BSP_LCD_GetInitTime().
+     o When USE_BSP_LCD_PANEL_CACHE is set, the detected panel and its ID are kept
+       in a checksummed record, in backup SRAM by default. On the next auto-detection
+       the cached panel is probed first, and all panels are probed only if it fails.
+       Override BSP_LCD_PanelCacheRead() and BSP_LCD_PanelCacheWrite(), weak functions,
+       to keep the record elsewhere (QSPI flash ...).
+     o DSI long writes issued between BSP_LCD_DSI_BatchStart() and BSP_LCD_DSI_BatchEnd()
+       are pushed to the DSI command FIFO without waiting for the previous packets
+       to be sent, BSP_LCD_DSI_BatchEnd() waits once for the FIFO to drain. When
+       USE_BSP_LCD_DSI_BATCH is set, the RASPBERRYPI init script is sent this way,
+       one batch per script step: the packets of a step ending on a delay are
+       sent during the delay.
+       With USE_BSP_LCD_STATS, get the DSI packets and time of the last
+       BSP_LCD_InitEx() using BSP_LCD_GetDsiStats().
+     o When USE_BSP_LCD_KEEPALIVE is set, a RASPBERRYPI panel is kept awake by a
+       timer which queues a read of the panel MCU on I2C4 when it was not accessed
+       for BSP_LCD_KEEPALIVE_PERIOD, so the application needs no periodic access.
+       BSP_LCD_KeepAlive_IRQHandler() must be called from the interrupt handler of
+       BSP_LCD_KEEPALIVE_TIM. Get its counters using BSP_LCD_GetKeepAliveStats().
+
      o Initialize the display with HDMI using BSP_LCD_InitHDMI(). Two display formats
        are supported: HDMI_FORMAT_720_480 or HDMI_FORMAT_720_576
 
@@ -59,6 +96,182 @@
      o Draw a vertical line using the BSP_LCD_DrawVLine() function.
      o Draw a bitmap image using the BSP_LCD_DrawBitmap() function.
 
+   + Frame buffers
+     o Set LCD_LAYER_0_BUFFERS_NBR to 2 or 3 for double or triple buffering of layer 0.
+       The draw functions then render to a back buffer which is not scanned out.
+     o Show the back buffer using BSP_LCD_SwapBuffers(). The new layer 0 address is
+       loaded by the LTDC at the next vertical blanking and the address of the next
+       back buffer is returned.
+       With 2 buffers, BSP_LCD_SwapBuffers() waits for the vertical blanking as the
+       next back buffer is the one being scanned out. With 3 buffers, it returns
+       immediately: a frame still waiting for the vertical blanking is replaced
+       by the new one and its buffer becomes the back buffer.
+     o BSP_LCD_LTDC_IRQHandler() must be called from the LTDC_IRQHandler().
+
+   + Beam racing
+     o Get the line being scanned out by the LTDC using BSP_LCD_GetScanline().
+     o When USE_BSP_LCD_BEAM_RACING is set, the frame is split in BSP_LCD_BEAM_BANDS_NBR
+       horizontal bands. After BSP_LCD_BeamStart(), the DMA2D fills of a band are held
+       until the LTDC scanned past the band, using the LTDC line event, so a single
+       buffer is updated without tearing. A fill over several bands is split, each
+       band being written once the LTDC left it.
+     o Queue a custom DMA2D job by band using BSP_LCD_BeamSubmit(). The job source
+       must stay valid until BSP_LCD_BeamSync() returns. L4 and A4 sources with an
+       odd line pitch are not split and are held until the LTDC scanned past the
+       last line of the job.
+     o Bitmap, RGB and asset copies, whose source belongs to the caller, and CPU
+       pixel accesses are not held. Call BSP_LCD_BeamSync() before mixing them
+       with fills of the same area.
+     o Stop holding jobs using BSP_LCD_BeamStop().
+
+   + DMA2D queue
+     o Fills and format conversions are pushed to an interrupt driven DMA2D job
+       queue and the draw functions return as soon as the job is queued.
+       BSP_LCD_DMA2D_IRQHandler() must be called from the DMA2D_IRQHandler().
+     o Queue a custom DMA2D job using BSP_LCD_DMA2D_Submit(), which returns a fence.
+     o Wait for the completion of a job using BSP_LCD_DMA2D_WaitFence().
+     o Wait for the completion of all the queued jobs using BSP_LCD_DMA2D_Sync()
+       before accessing the frame buffer with the CPU.
+     o Draw an A8 coverage map (text glyphs ...) in the text color with a single
+       DMA2D blending using BSP_LCD_DrawAlpha().
+     o Get the address of the drawn frame buffer for direct CPU access using
+       BSP_LCD_GetFrameBuffer(), once all the queued DMA2D jobs are completed.
+     o BSP_LCD_DrawAlpha(), BSP_LCD_GetFrameBuffer() and BSP_LCD_FrameBufferDrawn()
+       are not part of LCD_Driver: link them to the UTIL_LCD services with
+       UTIL_LCD_SetExtFuncDriver().
+
+   + Command mode
+     o When USE_BSP_LCD_CMD_MODE is set, NT35510 and OTM8009A panels are switched to
+       DSI adapted command mode once initialized. The panel keeps the image in its
+       memory and only the areas drawn since the previous refresh are sent, at the
+       tearing effect (TE) signal of the panel, so a static screen uses no DSI link
+       bandwidth. BSP_LCD_DSI_IRQHandler() must be called from the DSI_IRQHandler().
+     o The BSP draw functions mark the areas they draw. Mark the areas written
+       directly in the frame buffer (CPU, custom DMA2D jobs ...) using
+       BSP_LCD_Invalidate(). An area is sent once its DMA2D jobs are completed.
+     o Get the number of TE events, refreshes and pixels sent using
+       BSP_LCD_GetCmdModeStats().
+
+   + Ultra low power mode
+     o When USE_BSP_LCD_ULPM is set, BSP_LCD_Idle() puts the DSI lanes and D-PHY PLL
+       in ultra low power mode (ULPM) once the display was left untouched for
+       BSP_LCD_ULPM_TIMEOUT ms. Call it from the application idle loop. The link
+       is only put in ULPM while the LTDC does not stream to it: between the
+       refreshes of a command mode panel, or once the LTDC is disabled.
+     o The link is woken up by the BSP draw functions, BSP_LCD_Invalidate() and
+       BSP_TS_GetState() when a touch is detected, or explicitly using
+       BSP_LCD_Wake(). A wake requested from an interrupt (draw, touch or
+       BSP_LCD_Wake() called from a handler) is only recorded, as the ULPM exit
+       waits on the HAL tick: the link leaves ULPM at the next BSP_LCD_Idle() call.
+       The application idle loop must therefore keep calling BSP_LCD_Idle(), and
+       a command mode refresh drawn from an interrupt is sent once it did. A draw
+       from an interrupt during the ULPM entry wakes the link at the end of the
+       entry, before BSP_LCD_Idle() returns.
+     o The ULPM exit takes about 2 ms (D-PHY PLL lock and 1 ms wake-up time).
+       BSP_LCD_GetUlpmStats() returns the measured wake latencies and counts the
+       wakes exceeding BSP_LCD_ULPM_WAKE_BUDGET us (one 60 Hz frame by default).
+
+   + Overlay
+     o When USE_BSP_LCD_OVERLAY is set, layer 1 is composed over the full screen
+       layer 0 (camera video, static image ...) by the LTDC. Configure it at
+       LCD_LAYER_1_ADDRESS using BSP_LCD_ConfigOverlay() with its window and its
+       own pixel format: ARGB8888, RGB565, ARGB1555, ARGB4444, L8, AL44 or AL88.
+       It is cleared to transparent and shown. The L8, AL44 and AL88 formats use
+       a gray ramp CLUT, the luminance of the drawn colors is kept.
+     o With LCD_LAYER_0_BUFFERS_NBR > 1, move LCD_LAYER_1_ADDRESS after the layer 0
+       buffers: BSP_LCD_ConfigOverlay() refuses an overlay overlapping them.
+     o Select it using BSP_LCD_SetActiveLayer(): the draw functions then use its
+       size and pixel format, with coordinates relative to the window, and never
+       write the layer 0 pixels. Select layer 0 to draw the background again.
+     o The layer 1 pixel alpha and constant alpha are used for the blending. Set
+       the constant alpha using BSP_LCD_SetTransparency(), make a color of an L8
+       overlay transparent using BSP_LCD_SetColorKeying() and move the window
+       using BSP_LCD_SetOverlayPosition().
+     o The DMA2D cannot write the L8, AL44 and AL88 formats, which are drawn by
+       the CPU once the queued DMA2D jobs are completed.
+     o The overlay is not available when the panel is driven in command mode.
+
+   + Animation
+     o When USE_BSP_LCD_ANIMATION is set, BSP_LCD_AnimStart() interpolates a layer
+       constant alpha, window position or frame buffer address over a number of
+       frames (cross-fades, sliding menus, scrolling) without drawing any pixel.
+       The values of all the running animations are written to the LTDC shadow
+       registers at each register reload interrupt and loaded together at the
+       next vertical blanking. BSP_LCD_LTDC_IRQHandler() must be called from the
+       LTDC_IRQHandler().
+     o Up to BSP_LCD_ANIM_NBR animations run at the same time. Starting an
+       animation of a running layer property replaces it from its From value.
+     o BSP_LCD_AnimCallback(), a weak function called from the LTDC interrupt,
+       notifies the end of an animation once its To value is shown. Stop an
+       animation on its current value using BSP_LCD_AnimStop() and wait for the
+       end of all of them using BSP_LCD_AnimWait().
+     o The window keeps its size and stays inside the screen. An address moving
+       by whole lines of the layer (vertical scrolling) moves by whole lines.
+     o Animations are not available when the panel is driven in command mode,
+       and the layer 0 address is not animated with several layer 0 buffers.
+
+   + Rotation
+     o When USE_BSP_LCD_ROTATION is set, BSP_LCD_SetRotation() presents the layer 0
+       image rotated by 90, 180 or 270 degrees on panels without hardware
+       rotation (portrait mounted RASPBERRYPI panel). The draw functions then
+       write to a buffer at LCD_ROTATION_ADDRESS, of the rotated size returned by
+       BSP_LCD_GetXSize() and BSP_LCD_GetYSize(). Call UTIL_LCD_SetLayer(0)
+       afterwards for the utility to use the new size.
+     o Drawn areas are tracked by tiles of BSP_LCD_ROTATION_TILE pixels.
+       BSP_LCD_RotationFlush() copies the tiles drawn since the previous flush to
+       the scanned out buffer, rotating them one tile at a time so that both the
+       read and the written lines stay in the D-cache. Call it once a frame is
+       drawn. Areas written directly by the CPU (BSP_LCD_GetFrameBufferAddress())
+       are declared using BSP_LCD_RotationInvalidate(); the UTIL_LCD raster
+       functions declare theirs through BSP_LCD_FrameBufferDrawn().
+     o BSP_LCD_GetRotationStats() returns the flushed tiles and the rotation
+       throughput in pixels per second, measured with the DWT cycle counter.
+     o Layer 1 and the command mode refreshes keep the panel coordinates. The
+       rotation uses a single layer 0 buffer, without beam racing.
+
+   + Orientation
+     o When USE_BSP_LCD_ORIENTATION is set, BSP_LCD_SetOrientation() switches the
+       NT35510 and OTM8009A panels between LCD_ORIENTATION_PORTRAIT (480x800) and
+       LCD_ORIENTATION_LANDSCAPE (800x480) at run time. The panel controller
+       scans its memory in the new direction (MADCTL), the LTDC and DSI active
+       width and height are swapped and BSP_LCD_GetXSize() / BSP_LCD_GetYSize()
+       return the new size. No pixel is copied: redraw the screen afterwards.
+     o The touch screen follows the LCD orientation, its orientation flags and
+       size are updated at the next touch read.
+
+   + Indexed colors
+     o When USE_BSP_LCD_CLUT is set, BSP_LCD_InitEx() accepts the L8, AL44 and
+       AL88 formats: one byte per pixel (two for AL88) are scanned out instead
+       of four, through the layer CLUT loaded with a gray ramp. The draw
+       functions write the index given by the color luminance, the color of
+       the index N being LCD_COLOR_INDEX(N). Fills of word aligned areas are
+       done by the DMA2D, the other primitives by the CPU.
+     o BSP_LCD_SetCLUT() loads the layer CLUT at once. BSP_LCD_SwapCLUT() copies
+       the colors and loads them from the register reload interrupt of the next
+       vertical blanking (palette animation), BSP_LCD_LTDC_IRQHandler() must be
+       called from the LTDC_IRQHandler(). The swap is not available when the
+       panel is driven in command mode.
+     o BSP_LCD_DrawIndexed() draws an indexed image: the DMA2D loads the image
+       CLUT and converts its indexes to the layer format, blending the AL44
+       and AL88 pixels. To a layer of the image format, the indexes are copied.
+       A DMA2D job given a pCLUT loads it to the foreground CLUT before its
+       transfer.
+     o The layer 0 rotation is not available for the indexed formats.
+
+   + Assets
+     o When USE_BSP_LCD_ASSETS is set, images are read from an asset pack built
+       from PNG files by Tools/lcd_assets.py: each asset keeps its own pixel
+       format (ARGB8888, RGB565, L8 with its CLUT, or A8), its lines padded to
+       a stride and its pixels on a 32-byte boundary for the DMA2D. The pack is
+       linked as a C array (--header) or written to a memory mapped flash (--bin).
+     o BSP_LCD_AssetFind() checks the pack directory and returns the asset of an
+       Id, pointing to its pixels in the pack. BSP_LCD_AssetLoad() decodes an RLE
+       or LZ4 compressed asset to a RAM buffer of Stride * Height bytes, an
+       uncompressed asset is drawn where it is stored, without a copy.
+     o BSP_LCD_DrawAsset() draws the asset with one DMA2D transfer: copied,
+       converted or blended over the frame buffer when it is not opaque. A8
+       assets are coverage maps of the given color.
+
    + Options
      o Configure the LTDC reload mode by calling BSP_LCD_Reload(). By default, the
        reload mode is set to BSP_LCD_RELOAD_IMMEDIATE then LTDC is reloaded immediately.
@@ -95,6 +308,22 @@
 #include "stm32h747i_discovery_lcd.h"
 #include "stm32h747i_discovery_bus.h"
 #include "stm32h747i_discovery_sdram.h"
+
+#if (USE_BSP_LCD_KEEPALIVE == 1) && (USE_BSP_I2C4_QUEUE == 0)
+#error "USE_BSP_LCD_KEEPALIVE requires USE_BSP_I2C4_QUEUE"
+#endif
+
+#if (USE_BSP_LCD_CMD_MODE == 1) && ((LCD_LAYER_0_BUFFERS_NBR > 1U) || (USE_BSP_LCD_BEAM_RACING == 1))
+#error "USE_BSP_LCD_CMD_MODE refreshes a single frame buffer, without beam racing"
+#endif
+
+#if (USE_BSP_LCD_ROTATION == 1) && ((LCD_LAYER_0_BUFFERS_NBR > 1U) || (USE_BSP_LCD_BEAM_RACING == 1))
+#error "USE_BSP_LCD_ROTATION copies to a single frame buffer, without beam racing"
+#endif
+
+#if (USE_BSP_LCD_ROTATION == 1) && (BSP_LCD_ROTATION_TILE != 8U) && (BSP_LCD_ROTATION_TILE != 16U)
+#error "BSP_LCD_ROTATION_TILE must be 8 or 16"
+#endif
 /** @addtogroup BSP
   * @{
   */
@@ -110,6 +339,33 @@
   * @{
   */
 static LCD_Drv_t                *Lcd_Drv = NULL;
+static const BSP_LCD_Panel_t    *Lcd_Panel = NULL;
+static BSP_LCD_InitTime_t       Lcd_InitTime[LCD_INSTANCES_NBR];
+static int32_t                  Lcd_SdramStatus = BSP_ERROR_BUSY;
+static uint32_t                 Lcd_PanelId = 0;
+static uint32_t                 Lcd_DsiBatch = 0U;
+static uint32_t                 Lcd_DsiBatchPackets = 0U;       /* Long writes pushed, not waited for */
+static int32_t                  (*Lcd_PanelProcess)(void) = NULL; /* Panel sequence left to run */
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+static uint32_t                 Lcd_KeepAliveRunning = 0U;
+static volatile uint32_t        Lcd_KeepAliveLast;        /* Tick of the last panel MCU access */
+static uint8_t                  Lcd_KeepAliveData;
+static BSP_I2C4_Xfer_t          Lcd_KeepAliveXfer;
+static BSP_LCD_KeepAlive_Stats_t Lcd_KeepAliveStats;
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+#if (USE_BSP_LCD_ULPM == 1)
+static __IO uint32_t            Lcd_UlpmAsleep = 0U;      /* DSI lanes and PLL in ULPM        */
+static __IO uint32_t            Lcd_UlpmEntering = 0U;    /* ULPM entry on going              */
+static __IO uint32_t            Lcd_UlpmWakeRequest = 0U; /* Wake deferred from an interrupt  */
+static __IO uint32_t            Lcd_UlpmWakeStart;        /* Cycle count of the wake request  */
+static __IO uint32_t            Lcd_UlpmLast;             /* Tick of the last display activity */
+static uint32_t                 Lcd_UlpmSleepStart;
+static BSP_LCD_Ulpm_Stats_t     Lcd_UlpmStats;
+#endif /* USE_BSP_LCD_ULPM == 1 */
+#if (USE_BSP_LCD_STATS == 1)
+static BSP_LCD_Stats_t          Lcd_Stats[LCD_INSTANCES_NBR][BSP_LCD_STATS_NBR];
+static BSP_LCD_DSI_Stats_t      Lcd_DsiStats[LCD_INSTANCES_NBR];
+#endif /* USE_BSP_LCD_STATS == 1 */
 /**
   * @}
   */
@@ -152,6 +408,168 @@ typedef struct
   uint32_t      StopWaitTime;
 } LCD_HDMI_Timing_t;
 
+typedef struct
+{
+  BSP_LCD_DMA2D_Job_t Jobs[BSP_LCD_DMA2D_QUEUE_SIZE];
+  __IO uint32_t       Head;    /* Number of submitted jobs, fence of the last one */
+  __IO uint32_t       Tail;    /* Number of completed jobs                        */
+  __IO uint32_t       Busy;    /* DMA2D is processing Jobs[Tail]                  */
+  __IO uint32_t       Errors;  /* Number of jobs ended on a DMA2D error           */
+} LCD_DMA2D_Queue_t;
+
+static LCD_DMA2D_Queue_t Lcd_Dma2dQueue;
+
+/* Steps of the initialization started by BSP_LCD_InitEx() */
+#define LCD_INIT_NONE           0U   /* Not started, ended or failed              */
+#define LCD_INIT_RESET          1U   /* XRES held low                             */
+#define LCD_INIT_RESET_END      2U   /* XRES released, panel not ready yet        */
+#define LCD_INIT_PREPROBE       3U   /* Panel probes before the DSI host init     */
+#define LCD_INIT_PROBE          4U   /* Panel probes once the DSI host is started */
+
+#define LCD_RESET_LOW_TIME      20U  /* XRES low, in ms                           */
+#define LCD_RESET_END_TIME      10U  /* XRES high before sending commands, in ms  */
+
+typedef struct
+{
+  uint32_t State;            /* LCD_INIT_xxx                                  */
+  int32_t  Status;           /* Result, once State is back to LCD_INIT_NONE   */
+  uint32_t Orientation;
+  uint32_t PixelFormat;
+  uint32_t LtdcPixelFormat;
+  uint32_t DsiPixelFormat;
+  uint32_t Width;
+  uint32_t Height;
+  uint32_t TickStart;        /* Tick of the BSP_LCD_InitEx() call             */
+  uint32_t WaitStart;        /* Tick at which the running reset or panel sequence started */
+  uint32_t Panel;            /* Lcd_Panels entry being probed                 */
+  int32_t  ProbeStatus;      /* BSP_ERROR_UNKNOWN_COMPONENT once a probe failed */
+  uint32_t Cached;           /* The probed panel was read from the panel cache */
+  uint32_t ProbeAll;         /* Panel cache ignored                           */
+} LCD_Init_t;
+
+static LCD_Init_t Lcd_Init[LCD_INSTANCES_NBR];
+
+#if (USE_BSP_LCD_OVERLAY == 1)
+#define LCD_LAYERS_NBR          2U
+
+/* Geometry and pixel format the draw functions use on a layer */
+typedef struct
+{
+  uint32_t XSize;
+  uint32_t YSize;
+  uint32_t PixelFormat;
+  uint32_t BppFactor;
+} LCD_LayerCtx_t;
+
+static LCD_LayerCtx_t Lcd_Layers[LCD_INSTANCES_NBR][LCD_LAYERS_NBR];
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+typedef struct
+{
+  uint32_t        X0;      /* Inclusive bounds of the area */
+  uint32_t        Y0;
+  uint32_t        X1;
+  uint32_t        Y1;
+  BSP_LCD_Fence_t Fence;   /* Last DMA2D job queued when the area was drawn */
+} LCD_DirtyRect_t;
+
+typedef struct
+{
+  LCD_DirtyRect_t            Dirty[BSP_LCD_CMD_DIRTY_NBR];
+  __IO uint32_t              DirtyNbr;
+  __IO uint32_t              Active;   /* Panel driven in adapted command mode */
+  __IO uint32_t              Busy;     /* A refresh is being sent              */
+  BSP_LCD_CmdMode_Stats_t    Stats;
+} LCD_CmdMode_t;
+
+static LCD_CmdMode_t Lcd_CmdMode;
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+typedef struct
+{
+  uint32_t Address[LCD_LAYER_0_BUFFERS_NBR];
+  uint32_t Front;    /* Buffer scanned out by the LTDC                         */
+  uint32_t Pending;  /* Buffer loaded at the next vertical blanking, or Front  */
+  uint32_t Back;     /* Buffer drawn by the BSP                                */
+} LCD_FrameBuffers_t;
+
+static LCD_FrameBuffers_t Lcd_FrameBuffers[LCD_INSTANCES_NBR];
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+typedef struct
+{
+  BSP_LCD_DMA2D_Job_t Jobs[BSP_LCD_BEAM_BANDS_NBR][BSP_LCD_BEAM_QUEUE_SIZE];
+  __IO uint32_t       Head[BSP_LCD_BEAM_BANDS_NBR];  /* Jobs held per band     */
+  __IO uint32_t       Tail[BSP_LCD_BEAM_BANDS_NBR];  /* Jobs released per band */
+  __IO uint32_t       Running;
+  __IO uint32_t       NextBand;  /* Band ending at the programmed line event */
+} LCD_Beam_t;
+
+static LCD_Beam_t Lcd_Beam[LCD_INSTANCES_NBR];
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+
+#if (USE_BSP_LCD_ANIMATION == 1)
+#define LCD_ANIM_FREE           0U
+#define LCD_ANIM_RUNNING        1U
+#define LCD_ANIM_DONE           2U   /* To value staged, shown at the next reload */
+
+typedef struct
+{
+  BSP_LCD_Anim_t Anim;
+  uint32_t       Step;    /* Granularity of the interpolated value */
+  uint32_t       Frame;   /* Frames staged since the From value    */
+  __IO uint32_t  State;
+} LCD_AnimSlot_t;
+
+typedef struct
+{
+  LCD_AnimSlot_t Slots[BSP_LCD_ANIM_NBR];
+  __IO uint32_t  Pending;   /* Staged values wait for the vertical blanking reload */
+  __IO uint32_t  Reloads;   /* Vertical blanking reloads completed                  */
+} LCD_Anim_t;
+
+static LCD_Anim_t Lcd_Anim;
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+
+#if (USE_BSP_LCD_ROTATION == 1)
+/* Largest side of the panels, in pixels */
+#define LCD_ROT_MAX_SIZE        800U
+#define LCD_ROT_TILES_SIDE      ((LCD_ROT_MAX_SIZE + BSP_LCD_ROTATION_TILE - 1U) / BSP_LCD_ROTATION_TILE)
+#define LCD_ROT_DIRTY_WORDS     (((LCD_ROT_TILES_SIDE * LCD_ROT_TILES_SIDE) + 31U) / 32U)
+
+typedef struct
+{
+  uint32_t Rotation;
+  uint32_t XSize;       /* Size of the drawn (rotated) buffer */
+  uint32_t YSize;
+  uint32_t BppFactor;
+  uint32_t TilesX;      /* Tiles per drawn buffer line        */
+  uint32_t TilesY;
+  uint32_t Dirty[LCD_ROT_DIRTY_WORDS];  /* One bit per tile drawn since the last flush */
+  BSP_LCD_Rotation_Stats_t Stats;
+} LCD_Rotation_t;
+
+static LCD_Rotation_t Lcd_Rotation[LCD_INSTANCES_NBR];
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+
+#if (USE_BSP_LCD_ORIENTATION == 1)
+static uint32_t Lcd_Orientation[LCD_INSTANCES_NBR];
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
+
+#if (USE_BSP_LCD_CLUT == 1)
+typedef struct
+{
+  uint32_t      Colors[256];
+  uint32_t      Size;
+  __IO uint32_t Pending;   /* Colors wait for the vertical blanking */
+} LCD_ClutSwap_t;
+
+static LCD_ClutSwap_t Lcd_ClutSwap[2];
+#endif /* USE_BSP_LCD_CLUT == 1 */
+
 /**
   * @}
   */
@@ -177,6 +595,31 @@ static void DSI_MspInit(DSI_HandleTypeDef *hdsi);
 static void DSI_MspDeInit(DSI_HandleTypeDef *hdsi);
 static int32_t DSI_IO_Write(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData, uint16_t Size);
 static int32_t DSI_IO_Read(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData, uint16_t Size);
+static int32_t LCD_DSI_PushLongWrite(uint32_t ChannelID, uint32_t Mode, uint32_t NbParams, uint32_t Param1, const uint8_t *pParams);
+static int32_t LCD_DSI_WaitFlag(uint32_t Flag, uint32_t State);
+static int32_t LCD_I2C4_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
+static int32_t LCD_I2C4_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
+#if (USE_BSP_LCD_CMD_MODE == 1)
+static int32_t LCD_CmdModeStart(uint32_t Instance);
+static void LCD_CmdModeStop(void);
+static void LCD_CmdModeNext(uint32_t Instance);
+static void LCD_CmdModeRefresh(uint32_t Instance, const LCD_DirtyRect_t *Rect);
+#if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
+static void DSI_TearingEffectCallback(DSI_HandleTypeDef *hdsi);
+static void DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi);
+#endif /* USE_HAL_DSI_REGISTER_CALLBACKS == 1 */
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+#if (USE_BSP_LCD_ULPM == 1)
+static void LCD_UlpmStart(void);
+static uint32_t LCD_UlpmLinkIdle(void);
+#endif /* USE_BSP_LCD_ULPM == 1 */
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+static void LCD_KeepAliveStart(void);
+static void LCD_KeepAliveStop(void);
+static void LCD_KeepAliveArm(uint32_t Delay);
+static void LCD_KeepAliveTraffic(void);
+static void LCD_KeepAliveDone(BSP_I2C4_Xfer_t *pXfer);
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
 
 static int32_t NT35510_Probe(uint32_t ColorCoding, uint32_t Orientation);
 static int32_t OTM8009A_Probe(uint32_t ColorCoding, uint32_t Orientation);
@@ -195,9 +638,173 @@ static void LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc);
 static void DMA2D_MspInit(DMA2D_HandleTypeDef *hdma2d);
 static void DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d);
 static void LL_FillBuffer(uint32_t Instance, uint32_t *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color);
-static void LL_ConvertLineToRGB(uint32_t Instance, uint32_t *pSrc, uint32_t *pDst, uint32_t xSize, uint32_t ColorMode);
+static int32_t LCD_GetOutputColorMode(uint32_t PixelFormat, uint32_t *ColorMode);
+static uint32_t LCD_GetReadColorMode(uint32_t OutputColorMode);
+static uint32_t LCD_ColorToRaw(uint32_t PixelFormat, uint32_t Color);
+static uint32_t LCD_RawToColor(uint32_t PixelFormat, uint32_t Raw);
+static void LCD_CpuFill(uint32_t BppFactor, uint32_t Address, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Raw);
+#if (USE_BSP_LCD_OVERLAY == 1) || (USE_BSP_LCD_CLUT == 1)
+static void LCD_ConfigGrayClut(uint32_t LayerIndex, uint32_t PixelFormat);
+static uint32_t LCD_ClutSize(uint32_t PixelFormat);
+#endif /* (USE_BSP_LCD_OVERLAY == 1) || (USE_BSP_LCD_CLUT == 1) */
+static BSP_LCD_Fence_t LL_ConvertLineToRGB(uint32_t Instance, uint32_t *pSrc, uint32_t *pDst, uint32_t xSize, uint32_t ColorMode);
+static int32_t LCD_DMA2D_StartJob(const BSP_LCD_DMA2D_Job_t *Job);
+static HAL_StatusTypeDef LCD_DMA2D_LoadCLUT(const BSP_LCD_DMA2D_Job_t *Job);
+static void LCD_DMA2D_XferCpltCallback(DMA2D_HandleTypeDef *hdma2d);
+static void LCD_DMA2D_XferErrorCallback(DMA2D_HandleTypeDef *hdma2d);
+static void LCD_DMA2D_JobDone(uint32_t Error);
+static void LCD_ResetStart(void);
 static void LCD_InitSequence(void);
 static void LCD_DeInitSequence(void);
+static void LCD_FrameBuffersInit(uint32_t Instance);
+static uint32_t LCD_GetDrawAddress(uint32_t Instance);
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+static void LCD_FrameBuffersUpdate(uint32_t Instance);
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+static uint32_t LCD_GetBand(uint32_t Instance, uint32_t Row);
+static uint32_t LCD_GetScanBand(uint32_t Instance);
+static uint32_t LCD_GetBandEnd(uint32_t Instance, uint32_t Band);
+static int32_t LCD_BeamGetJobRow(uint32_t Instance, const BSP_LCD_DMA2D_Job_t *Job, uint32_t *Row);
+static int32_t LCD_BeamGetPitch(uint32_t ColorMode, uint32_t Width, uint32_t Offset, uint32_t LineOffsetMode, uint32_t *Pitch);
+static int32_t LCD_BeamGetJobPart(const BSP_LCD_DMA2D_Job_t *Job, uint32_t Line, uint32_t Height, BSP_LCD_DMA2D_Job_t *Part);
+static int32_t LCD_BeamHold(uint32_t Instance, uint32_t Band, const BSP_LCD_DMA2D_Job_t *Part, uint32_t TickStart);
+static uint32_t LCD_BeamBandEndLine(uint32_t Instance, uint32_t Band);
+static void LCD_BeamRelease(uint32_t Instance, uint32_t Band);
+static void LCD_BeamPoll(uint32_t Instance);
+static void LCD_BeamLineEvent(uint32_t Instance);
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+static void LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc);
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 1) */
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+#if (USE_BSP_LCD_ANIMATION == 1)
+static int32_t LCD_AnimCheck(const BSP_LCD_Anim_t *Anim, uint32_t *Step);
+static uint32_t LCD_AnimValue(const BSP_LCD_Anim_t *Anim, uint32_t From, uint32_t To, uint32_t Step, uint32_t Frame);
+static void LCD_AnimApply(const LCD_AnimSlot_t *Slot);
+static void LCD_AnimStep(uint32_t Instance);
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+#if (USE_BSP_LCD_CLUT == 1)
+static int32_t LCD_GetInputColorMode(uint32_t PixelFormat, uint32_t *InputColorMode, uint32_t *BppFactor);
+static void LCD_ClutReloadEvent(void);
+#endif /* USE_BSP_LCD_CLUT == 1 */
+#if (USE_BSP_LCD_ASSETS == 1)
+static uint32_t LCD_AssetBpp(uint32_t Format);
+static int32_t LCD_AssetRle(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize, uint32_t Unit);
+static int32_t LCD_AssetLz4(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize);
+#endif /* USE_BSP_LCD_ASSETS == 1 */
+#if (USE_BSP_LCD_ANIMATION == 1) || (USE_BSP_LCD_CLUT == 1)
+static void LCD_ReloadEvent(uint32_t Instance);
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+static void LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc);
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 1) */
+#endif /* (USE_BSP_LCD_ANIMATION == 1) || (USE_BSP_LCD_CLUT == 1) */
+#if (USE_BSP_LCD_ROTATION == 1)
+static void LCD_RotationDrawn(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+static void LCD_RotationMark(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+static void LCD_RotationCopy(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+static void LCD_RotateTile(uint32_t Src, uint32_t SrcPitch, uint32_t Dst, uint32_t StepX, uint32_t StepY,
+                           uint32_t Width, uint32_t Height, uint32_t BppFactor);
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+#if (USE_BSP_LCD_STATS == 1)
+static void LCD_StatsUpdate(uint32_t Instance, BSP_LCD_StatsId_t Primitive, uint32_t NbPixels, uint32_t Cycles);
+#endif /* USE_BSP_LCD_STATS == 1 */
+static const BSP_LCD_Panel_t *LCD_FindPanel(LCD_Driver_t Id);
+static const BSP_LCD_Panel_t *LCD_GetInitPanel(void);
+static HAL_StatusTypeDef LCD_DsiConfigVideoMode(DSI_HandleTypeDef *hdsi, uint32_t Width, uint32_t Height, uint32_t PixelFormat);
+#if (USE_BSP_LCD_ORIENTATION == 1)
+static int32_t LCD_SetActiveSize(uint32_t Instance, uint32_t Width, uint32_t Height);
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
+static int32_t LCD_InitProcess(uint32_t Instance);
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+static int32_t LCD_InitRetry(uint32_t Instance);
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
+static int32_t LCD_ProbePanels(uint32_t Instance, uint32_t PreProbe);
+static int32_t LCD_ComputePll3(uint64_t PixelClock, RCC_PLL3InitTypeDef *Pll3, uint32_t *Achieved);
+static int32_t LCD_SdramInit(void);
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+static const BSP_LCD_Panel_t *LCD_PanelCacheLoad(uint32_t Instance);
+static void LCD_PanelCacheStore(uint32_t Instance);
+static uint32_t LCD_PanelCacheChecksum(const BSP_LCD_PanelCache_t *Cache);
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
+static int32_t RASPBERRYPI_Status(int32_t Status);
+static int32_t RASPBERRYPI_Continue(void);
+#if (USE_BSP_LCD_DSI_BATCH == 1)
+static int32_t RASPBERRYPI_BatchEnd(int32_t Status);
+#endif /* USE_BSP_LCD_DSI_BATCH == 1 */
+/**
+  * @}
+  */
+
+/** @defgroup STM32H747I_DISCO_LCD_Private_Constants Private Constants
+  * @{
+  */
+/* Supported DSI panels, in probing order. The first entry also provides the
+   DSI and LTDC clocks used while no panel is detected */
+static const BSP_LCD_Panel_t Lcd_Panels[] =
+{
+  {
+    LCD_CTRL_NT35510,
+    NT35510_480X800_HSYNC, NT35510_480X800_HBP, NT35510_480X800_HFP,
+    NT35510_480X800_VSYNC, NT35510_480X800_VBP, NT35510_480X800_VFP,
+    62500U, 27429U,
+    DSI_TWO_DATA_LANES, 4U,
+    {100U, DSI_PLL_IN_DIV5, DSI_PLL_OUT_DIV1},
+    {5U, 132U, 2U, 2U, 24U, RCC_PLL3VCIRANGE_2, RCC_PLL3VCOWIDE, 0U},
+    DSI_LOOSELY_PACKED_ENABLE, 64U, 64U,
+    DSI_HSYNC_ACTIVE_HIGH, DSI_VSYNC_ACTIVE_HIGH,
+    LTDC_HSPOLARITY_AL, LTDC_VSPOLARITY_AL,
+    NT35510_FORMAT_RBG565, NT35510_FORMAT_RGB888,
+    NULL, NT35510_Probe
+  },
+  {
+    LCD_CTRL_OTM8009A,
+    OTM8009A_480X800_HSYNC, OTM8009A_480X800_HBP, OTM8009A_480X800_HFP,
+    OTM8009A_480X800_VSYNC, OTM8009A_480X800_VBP, OTM8009A_480X800_VFP,
+    62500U, 27429U,
+    DSI_TWO_DATA_LANES, 4U,
+    {100U, DSI_PLL_IN_DIV5, DSI_PLL_OUT_DIV1},
+    {5U, 132U, 2U, 2U, 24U, RCC_PLL3VCIRANGE_2, RCC_PLL3VCOWIDE, 0U},
+    DSI_LOOSELY_PACKED_DISABLE, 4U, 4U,
+    DSI_HSYNC_ACTIVE_HIGH, DSI_VSYNC_ACTIVE_HIGH,
+    LTDC_HSPOLARITY_AL, LTDC_VSPOLARITY_AL,
+    OTM8009A_FORMAT_RBG565, OTM8009A_FORMAT_RGB888,
+    NULL, OTM8009A_Probe
+  },
+  {
+    /* Probed before the DSI host initialization as it holds the DSI lines
+       until it is initialized. The controller color coding is not used */
+    LCD_CTRL_WAVESHARE_2P8,
+    WAVESHARE_2P8IN_480X640_HSYNC, WAVESHARE_2P8IN_480X640_HBP, WAVESHARE_2P8IN_480X640_HFP,
+    WAVESHARE_2P8IN_480X640_VSYNC, WAVESHARE_2P8IN_480X640_VBP, WAVESHARE_2P8IN_480X640_VFP,
+    125000U, 50000U,
+    DSI_TWO_DATA_LANES, 8U,
+    {120U, DSI_PLL_IN_DIV3, DSI_PLL_OUT_DIV1},
+    {5U, 80U, 2U, 2U, 8U, RCC_PLL3VCIRANGE_2, RCC_PLL3VCOMEDIUM, 0U},
+    DSI_LOOSELY_PACKED_DISABLE, 4U, 4U,
+    DSI_HSYNC_ACTIVE_HIGH, DSI_VSYNC_ACTIVE_HIGH,
+    LTDC_HSPOLARITY_AL, LTDC_VSPOLARITY_AL,
+    0U, 0U,
+    WAVESHARE_2P8_Probe, NULL
+  },
+  {
+    /* The DSI PLL gives a 100000 kHz lane byte clock but the horizontal
+       timings were tuned with a 125000 kHz ratio, which is kept */
+    LCD_CTRL_RASPBERRYPI,
+    RASPBERRYPI_800X480_HSYNC, RASPBERRYPI_800X480_HBP, RASPBERRYPI_800X480_HFP,
+    RASPBERRYPI_800X480_VSYNC, RASPBERRYPI_800X480_VBP, RASPBERRYPI_800X480_VFP,
+    125000U, 30000U,
+    DSI_ONE_DATA_LANE, 10U,
+    {32U, DSI_PLL_IN_DIV1, DSI_PLL_OUT_DIV1},
+    {5U, 96U, 2U, 2U, 16U, RCC_PLL3VCIRANGE_2, RCC_PLL3VCOWIDE, 0U},
+    DSI_LOOSELY_PACKED_DISABLE, 64U, 64U,
+    DSI_HSYNC_ACTIVE_LOW, DSI_VSYNC_ACTIVE_LOW,
+    LTDC_HSPOLARITY_AH, LTDC_VSPOLARITY_AH,
+    RASPBERRYPI_FORMAT_RBG565, RASPBERRYPI_FORMAT_RGB888,
+    RASPBERRYPI_PreProbe, RASPBERRYPI_Probe
+  }
+};
+
+#define LCD_PANELS_NBR                             (sizeof(Lcd_Panels) / sizeof(Lcd_Panels[0]))
 /**
   * @}
   */
@@ -208,6 +815,86 @@ static void LCD_DeInitSequence(void);
                                      (((((((Color) >> (5U)) & 0x3FU) * 259U) + 33U) >> (6U)) << (8U)) |\
                                      (((((Color) & 0x1FU) * 527U) + 23U) >> (6U)) | (0xFF000000U))
 
+#if (USE_BSP_LCD_STATS == 1)
+#define LCD_STATS_START()                          uint32_t stats_start = DWT->CYCCNT
+#define LCD_STATS_STOP(Instance, Primitive, NbPixels)  LCD_StatsUpdate((Instance), (Primitive), (NbPixels), DWT->CYCCNT - stats_start)
+#else
+#define LCD_STATS_START()
+#define LCD_STATS_STOP(Instance, Primitive, NbPixels)
+#endif /* USE_BSP_LCD_STATS == 1 */
+
+#if ((BSP_LCD_DMA2D_QUEUE_SIZE & (BSP_LCD_DMA2D_QUEUE_SIZE - 1U)) != 0U)
+#error "BSP_LCD_DMA2D_QUEUE_SIZE must be a power of 2"
+#endif
+#define LCD_DMA2D_QUEUE_MASK                       (BSP_LCD_DMA2D_QUEUE_SIZE - 1U)
+/* Fences are sequence numbers, compare them modulo 2^32 */
+#define LCD_DMA2D_FENCE_DONE(Fence)                ((int32_t)(Lcd_Dma2dQueue.Tail - (Fence)) >= 0)
+
+/* Lines before the vertical blanking where a pending reload may be latched
+   while the layer address is being rewritten */
+#define LCD_SWAP_GUARD_LINES                       2U
+
+/* DSI PLL limits: input frequency after IDF and VCO frequency, in Hz.
+   The lane byte clock is VCO / (2 * ODF * 8) */
+#define LCD_DSI_PLL_IN_MIN                         4000000U
+#define LCD_DSI_PLL_IN_MAX                         25000000U
+#define LCD_DSI_VCO_MIN                            1000000000U
+#define LCD_DSI_VCO_MAX                            2000000000U
+/* Highest escape clock, in kHz */
+#define LCD_DSI_ESCAPE_CLOCK_MAX                   20000U
+/* Header and checksum bytes of the DSI pixel stream long packet */
+#define LCD_DSI_LONG_PACKET_OVERHEAD               6U
+
+/* PLL3 limits in wide VCO range: reference (input after DIVM3) and VCO
+   frequencies in Hz. The fractional part of DIVN3 is FRACN3 / 8192 */
+#define LCD_PLL3_REF_MIN                           2000000U
+#define LCD_PLL3_REF_MAX                           16000000U
+#define LCD_PLL3_VCO_MIN                           192000000U
+#define LCD_PLL3_VCO_MAX                           836000000U
+#define LCD_PLL3_FRACN_SHIFT                       13U
+
+/* An area of the panel changed */
+#if (USE_BSP_LCD_CMD_MODE == 1)
+#define LCD_PANEL_DRAWN(Instance, X, Y, W, H) (void)BSP_LCD_Invalidate((Instance), (X), (Y), (W), (H))
+#elif (USE_BSP_LCD_ULPM == 1)
+#define LCD_PANEL_DRAWN(Instance, X, Y, W, H) (void)BSP_LCD_Wake(Instance)
+#else
+#define LCD_PANEL_DRAWN(Instance, X, Y, W, H)
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+/* An area of the active layer was drawn */
+#if (USE_BSP_LCD_ROTATION == 1)
+#define LCD_AREA_DRAWN(Instance, X, Y, W, H)  LCD_RotationDrawn((Instance), (X), (Y), (W), (H))
+#else
+#define LCD_AREA_DRAWN(Instance, X, Y, W, H)  LCD_PANEL_DRAWN((Instance), (X), (Y), (W), (H))
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+
+/* Standard DCS commands of the NT35510 and OTM8009A */
+#define LCD_DCS_CASET                              0x2AU
+#define LCD_DCS_PASET                              0x2BU
+#define LCD_DCS_TEEON                              0x35U
+
+/* Maximum time (ms) spent waiting for the DSI command and payload FIFOs */
+#define LCD_DSI_FIFO_TIMEOUT                       100U
+
+#if (USE_BSP_LCD_STATS == 1)
+#define LCD_DSI_STATS_START()                      uint32_t dsi_start = DWT->CYCCNT
+#define LCD_DSI_STATS_STOP(NbPackets, NbWaits)     do { Lcd_DsiStats[0].Packets += (NbPackets); \
+                                                        Lcd_DsiStats[0].Waits   += (NbWaits); \
+                                                        Lcd_DsiStats[0].Cycles  += DWT->CYCCNT - dsi_start; } while(0)
+#else
+#define LCD_DSI_STATS_START()
+#define LCD_DSI_STATS_STOP(NbPackets, NbWaits)
+#endif /* USE_BSP_LCD_STATS == 1 */
+
+/* Tag of a panel cache record: "LCDP" */
+#define LCD_PANEL_CACHE_MAGIC                      0x4C434450U
+
+#define LCD_BEAM_QUEUE_MASK                        (BSP_LCD_BEAM_QUEUE_SIZE - 1U)
+#if ((BSP_LCD_BEAM_QUEUE_SIZE & LCD_BEAM_QUEUE_MASK) != 0U)
+#error "BSP_LCD_BEAM_QUEUE_SIZE must be a power of 2"
+#endif
+
 /**
   * @}
   */
@@ -222,14 +909,24 @@ static void LCD_DeInitSequence(void);
   */
 int32_t BSP_LCD_Init(uint32_t Instance, uint32_t Orientation)
 {
-  return BSP_LCD_InitEx(Instance, Orientation, LCD_PIXEL_FORMAT_RGB888, LCD_DEFAULT_WIDTH, LCD_DEFAULT_HEIGHT);
+  int32_t ret = BSP_LCD_InitEx(Instance, Orientation, LCD_PIXEL_FORMAT_RGB888, LCD_DEFAULT_WIDTH, LCD_DEFAULT_HEIGHT);
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    ret = BSP_LCD_InitWait(Instance);
+  }
+
+  return ret;
 }
 
 /**
-  * @brief  Initializes the LCD.
+  * @brief  Starts the LCD initialization. It returns once the reset pulse
+  *         is started, the initialization is then advanced by BSP_LCD_InitPoll()
+  *         or completed by BSP_LCD_InitWait().
   * @param  Instance    LCD Instance
   * @param  Orientation LCD_ORIENTATION_LANDSCAPE
-  * @param  PixelFormat LCD_PIXEL_FORMAT_RBG565 or LCD_PIXEL_FORMAT_RBG888
+  * @param  PixelFormat LCD_PIXEL_FORMAT_RBG565 or LCD_PIXEL_FORMAT_RBG888, or
+  *                     LCD_PIXEL_FORMAT_L8, _AL44 or _AL88 when USE_BSP_LCD_CLUT is set
   * @param  Width       Display width
   * @param  Height      Display height
   * @retval BSP status
@@ -237,37 +934,80 @@ int32_t BSP_LCD_Init(uint32_t Instance, uint32_t Orientation)
 int32_t BSP_LCD_InitEx(uint32_t Instance, uint32_t Orientation, uint32_t PixelFormat, uint32_t Width, uint32_t Height)
 {
   int32_t ret = BSP_ERROR_NONE;
-  uint32_t ctrl_pixel_format, ltdc_pixel_format, dsi_pixel_format;
-  MX_LTDC_LayerConfig_t config;
+  uint32_t ltdc_pixel_format = PixelFormat, dsi_pixel_format = DSI_RGB888, bpp;
+  uint32_t tickstart = BSP_GetTick();
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_RGB565:
+    dsi_pixel_format = DSI_RGB565;
+    bpp = 2U;
+    break;
+  case LCD_PIXEL_FORMAT_RGB888:
+    ltdc_pixel_format = LTDC_PIXEL_FORMAT_ARGB8888;
+    bpp = 4U;
+    break;
+#if (USE_BSP_LCD_CLUT == 1)
+  case LCD_PIXEL_FORMAT_L8:
+  case LCD_PIXEL_FORMAT_AL44:
+    /* The LTDC sends the CLUT colors of the indexes */
+    bpp = 1U;
+    break;
+  case LCD_PIXEL_FORMAT_AL88:
+    bpp = 2U;
+    break;
+#endif /* USE_BSP_LCD_CLUT == 1 */
+  default:
+    bpp = 0U;
+    break;
+  }
 
-  if((Orientation > LCD_ORIENTATION_LANDSCAPE) || (Instance >= LCD_INSTANCES_NBR) || \
-     ((PixelFormat != LCD_PIXEL_FORMAT_RGB565) && (PixelFormat != LTDC_PIXEL_FORMAT_RGB888)))
+  if((Orientation > LCD_ORIENTATION_LANDSCAPE) || (Instance >= LCD_INSTANCES_NBR) || (bpp == 0U))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    if(PixelFormat == LCD_PIXEL_FORMAT_RGB565)
-    {
-      ltdc_pixel_format = LTDC_PIXEL_FORMAT_RGB565;
-      dsi_pixel_format = DSI_RGB565;
-      Lcd_Ctx[Instance].BppFactor = 2U;
-    }
-    else /* LCD_PIXEL_FORMAT_RGB888 */
-    {
-      ltdc_pixel_format = LTDC_PIXEL_FORMAT_ARGB8888;
-      dsi_pixel_format = DSI_RGB888;
-      Lcd_Ctx[Instance].BppFactor = 4U;
-    }
+    Lcd_Ctx[Instance].BppFactor = bpp;
 
     /* Store pixel format, xsize and ysize information */
     Lcd_Ctx[Instance].PixelFormat = PixelFormat;
     Lcd_Ctx[Instance].XSize  = Width;
     Lcd_Ctx[Instance].YSize  = Height;
-
-    /* Toggle Hardware Reset of the LCD using its XRES signal (active low) */
-    BSP_LCD_Reset(Instance);
-
+    Lcd_Ctx[Instance].ActiveLayer = 0U;
+#if (USE_BSP_LCD_ROTATION == 1)
+    Lcd_Rotation[Instance].Rotation = LCD_ROTATION_0;
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+#if (USE_BSP_LCD_ORIENTATION == 1)
+    Lcd_Orientation[Instance] = Orientation;
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
+#if (USE_BSP_LCD_OVERLAY == 1)
+    Lcd_Layers[Instance][0].XSize       = Width;
+    Lcd_Layers[Instance][0].YSize       = Height;
+    Lcd_Layers[Instance][0].PixelFormat = PixelFormat;
+    Lcd_Layers[Instance][0].BppFactor   = Lcd_Ctx[Instance].BppFactor;
+    Lcd_Layers[Instance][1].XSize       = 0U;
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+
+    /* The SDRAM is initialized once, possibly while waiting for the panel */
+    Lcd_SdramStatus = BSP_ERROR_BUSY;
+    Lcd_InitTime[Instance].FirstFrame = 0U;
+    Lcd_InitTime[Instance].InitTime   = 0U;
+    Lcd_InitTime[Instance].PanelWait  = 0U;
+    Lcd_InitTime[Instance].IdleWork   = 0U;
+#if (USE_BSP_LCD_STATS == 1)
+    /* Time the DSI writes of the panel initialization */
+    BSP_EnableCycleCounter();
+    Lcd_DsiStats[Instance].Packets = 0U;
+    Lcd_DsiStats[Instance].Waits   = 0U;
+    Lcd_DsiStats[Instance].Cycles  = 0U;
+    Lcd_DsiStats[Instance].Time    = 0U;
+#endif /* USE_BSP_LCD_STATS == 1 */
+
+    /* Hardware Reset of the LCD using its XRES signal (active low), released
+       by LCD_InitProcess() */
+    LCD_ResetStart();
+    Lcd_Init[Instance].WaitStart = BSP_GetTick();
 
     /* Initialize LCD special pins GPIOs */
     LCD_InitSequence();
@@ -305,169 +1045,112 @@ int32_t BSP_LCD_InitEx(uint32_t Instance, uint32_t Orientation, uint32_t PixelFo
 #else
     DSI_MspInit(&hlcd_dsi);
 #endif
-    // The WAVESHARE driver needs to be probed before MX_DSIHOST_DSI_Init because it
-    // will hold the DSI lines (causing MX_DSIHOST_DSI_Init to fail) if not initialized first
-    if ((Lcd_Driver_Type == LCD_CTRL_UNKNOWN) || (Lcd_Driver_Type == LCD_CTRL_WAVESHARE_2P8))
+    /* Select the panel descriptor of the configured controller, if any */
+    if((Lcd_Panel == NULL) || (Lcd_Panel->Id != Lcd_Driver_Type))
     {
-      if(WAVESHARE_2P8_Probe(ctrl_pixel_format, Orientation) != BSP_ERROR_NONE)
-      {
-	ret = BSP_ERROR_UNKNOWN_COMPONENT;
-      }
-      else
-      {
-	Lcd_Driver_Type = LCD_CTRL_WAVESHARE_2P8;
-	ret = BSP_ERROR_NONE;
-      }
+      Lcd_Panel = LCD_FindPanel(Lcd_Driver_Type);
     }
 
-    if ((Lcd_Driver_Type == LCD_CTRL_UNKNOWN) || (Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI))
+    Lcd_Init[Instance].Orientation     = Orientation;
+    Lcd_Init[Instance].PixelFormat     = PixelFormat;
+    Lcd_Init[Instance].LtdcPixelFormat = ltdc_pixel_format;
+    Lcd_Init[Instance].DsiPixelFormat  = dsi_pixel_format;
+    Lcd_Init[Instance].Width           = Width;
+    Lcd_Init[Instance].Height          = Height;
+    Lcd_Init[Instance].TickStart       = tickstart;
+    Lcd_Init[Instance].Cached          = 0U;
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+    /* When auto-detecting, probe the panel found at the previous boot only */
+    if((Lcd_Panel == NULL) && (Lcd_Init[Instance].ProbeAll == 0U))
     {
-      if(RASPBERRYPI_PreProbe(ctrl_pixel_format, Orientation) != BSP_ERROR_NONE)
-      {
-	ret = BSP_ERROR_UNKNOWN_COMPONENT;
-      }
-      else
-      {
-	Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
-	ret = BSP_ERROR_NONE;
-      }
+      Lcd_Panel = LCD_PanelCacheLoad(Instance);
+      Lcd_Init[Instance].Cached = (Lcd_Panel != NULL) ? 1U : 0U;
     }
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
 
-    // If we get here and it's still not None then
-    if(ret != BSP_ERROR_NONE)
-    {
-      Lcd_Driver_Type = LCD_CTRL_UNKNOWN;
-      ret = BSP_ERROR_UNKNOWN_COMPONENT; // Couldn't auto-detect
-    }
+    Lcd_Init[Instance].State       = LCD_INIT_RESET;
+    Lcd_Init[Instance].Panel       = 0U;
+    Lcd_Init[Instance].ProbeStatus = BSP_ERROR_NONE;
+    Lcd_PanelProcess = NULL;
 
-    if(MX_DSIHOST_DSI_Init(&hlcd_dsi, Width, Height, dsi_pixel_format) != HAL_OK)
-    {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
-    else if(MX_LTDC_ClockConfig(&hlcd_ltdc) != HAL_OK)
+    /* Run the initialization up to the end of the reset pulse */
+    ret = LCD_InitProcess(Instance);
+    if(ret == BSP_ERROR_BUSY)
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
+      ret = BSP_ERROR_NONE;
     }
-    else
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Advances the initialization started by BSP_LCD_InitEx(): runs the
+  *         steps due and returns, without waiting for the panel delays. The
+  *         SDRAM is initialized on the first call finding a delay pending.
+  *         Call it until it returns another status than BSP_ERROR_BUSY.
+  * @param  Instance    LCD Instance
+  * @retval BSP status, BSP_ERROR_BUSY while the initialization runs
+  */
+int32_t BSP_LCD_InitPoll(uint32_t Instance)
+{
+  int32_t ret;
+  uint32_t tickstart;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Lcd_Init[Instance].State == LCD_INIT_NONE)
+  {
+    ret = Lcd_Init[Instance].Status;
+  }
+  else
+  {
+    ret = LCD_InitProcess(Instance);
+    if((ret == BSP_ERROR_BUSY) && (Lcd_SdramStatus == BSP_ERROR_BUSY))
     {
-     if(MX_LTDC_Init(&hlcd_ltdc, Width, Height) != HAL_OK)
-     {
-       ret = BSP_ERROR_PERIPH_FAILURE;
-     }
+      /* An error is reported once the layer is configured */
+      tickstart = BSP_GetTick();
+      (void)LCD_SdramInit();
+      Lcd_InitTime[Instance].IdleWork += BSP_GetTick() - tickstart;
     }
+  }
 
-    if(ret == BSP_ERROR_NONE)
-    {
-      /* Before configuring LTDC layer, ensure SDRAM is initialized */
-#if !defined(DATA_IN_ExtSDRAM)
-      /* Initialize the SDRAM */
-      if(BSP_SDRAM_Init(0) != BSP_ERROR_NONE)
-      {
-        return BSP_ERROR_PERIPH_FAILURE;
-      }
-#endif /* DATA_IN_ExtSDRAM */
+  return ret;
+}
 
-      /* Configure default LTDC Layer 0. This configuration can be override by calling
-      BSP_LCD_ConfigLayer() at application level */
-      config.X0          = 0;
-      config.X1          = Width;
-      config.Y0          = 0;
-      config.Y1          = Height;
-      config.PixelFormat = ltdc_pixel_format;
-      config.Address     = LCD_LAYER_0_ADDRESS;
-      if(MX_LTDC_ConfigLayer(&hlcd_ltdc, 0, &config) != HAL_OK)
-      {
-        ret = BSP_ERROR_PERIPH_FAILURE;
-      }
-      else
-      {
-        /* Enable the DSI host and wrapper after the LTDC initialization
-        To avoid any synchronization issue, the DSI shall be started after enabling the LTDC */
-        (void)HAL_DSI_Start(&hlcd_dsi);
-
-        /* Enable the DSI BTW for read operations */
-        (void)HAL_DSI_ConfigFlowControl(&hlcd_dsi, DSI_FLOW_CONTROL_BTA);
-
-	if ((Lcd_Driver_Type == LCD_CTRL_UNKNOWN) || (Lcd_Driver_Type == LCD_CTRL_NT35510))
-	{
-	  /* Initialize the NT35510 LCD Display IC Driver (KoD LCD IC Driver)
-	  depending on configuration of DSI */
-	  if(PixelFormat == LCD_PIXEL_FORMAT_RGB565)
-	  {
-	    ctrl_pixel_format = NT35510_FORMAT_RBG565;
-	  }
-	  else /* LCD_PIXEL_FORMAT_RGB888 */
-	  {
-	    ctrl_pixel_format = NT35510_FORMAT_RGB888;
-	  }
-	  if (NT35510_Probe(ctrl_pixel_format, Orientation) == BSP_ERROR_NONE) {
-	    Lcd_Driver_Type = LCD_CTRL_NT35510;
-	    ret = BSP_ERROR_NONE;
-	  }
-	}
-
-	if ((Lcd_Driver_Type == LCD_CTRL_UNKNOWN) || (Lcd_Driver_Type == LCD_CTRL_OTM8009A))
-	{
-	  /* Initialize the OTM8009A LCD Display IC Driver (KoD LCD IC Driver)
-	  depending on configuration of DSI */
-	  if(PixelFormat == LCD_PIXEL_FORMAT_RGB565)
-	  {
-	    ctrl_pixel_format = OTM8009A_FORMAT_RBG565;
-	  }
-	  else /* LCD_PIXEL_FORMAT_RGB888 */
-	  {
-	    ctrl_pixel_format = OTM8009A_FORMAT_RGB888;
-	  }
-	  if(OTM8009A_Probe(ctrl_pixel_format, Orientation) != BSP_ERROR_NONE)
-	  {
-	    ret = BSP_ERROR_UNKNOWN_COMPONENT;
-	  }
-	  else
-	  {
-	    Lcd_Driver_Type = LCD_CTRL_OTM8009A;
-	    ret = BSP_ERROR_NONE;
-	  }
-	}
-
-	if ((Lcd_Driver_Type == LCD_CTRL_UNKNOWN) || (Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI))
-	{
-	  /* Initialize the LCD_CTRL_RASPBERRYPI LCD Display IC Driver (KoD LCD IC Driver)
-	  depending on configuration of DSI */
-	  if(PixelFormat == LCD_PIXEL_FORMAT_RGB565)
-	  {
-	    ctrl_pixel_format = RASPBERRYPI_FORMAT_RBG565;
-	  }
-	  else /* LCD_PIXEL_FORMAT_RGB888 */
-	  {
-	    ctrl_pixel_format = RASPBERRYPI_FORMAT_RGB888;
-	  }
-	  if(RASPBERRYPI_Probe(ctrl_pixel_format, Orientation) != BSP_ERROR_NONE)
-	  {
-	    ret = BSP_ERROR_UNKNOWN_COMPONENT;
-	  }
-	  else
-	  {
-	    Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
-	    ret = BSP_ERROR_NONE;
-	  }
-	}
-
-
-      }
-    /* By default the reload is activated and executed immediately */
-    Lcd_Ctx[Instance].ReloadEnable = 1U;
-   }
+/**
+  * @brief  Completes the initialization started by BSP_LCD_InitEx(). While
+  *         the panel delays are pending, BSP_LCD_InitIdleCallback() is called
+  *         repeatedly.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_InitWait(uint32_t Instance)
+{
+  int32_t ret = BSP_LCD_InitPoll(Instance);
+  uint32_t tickstart;
+
+  while(ret == BSP_ERROR_BUSY)
+  {
+    tickstart = BSP_GetTick();
+    BSP_LCD_InitIdleCallback(Instance);
+    Lcd_InitTime[Instance].IdleWork += BSP_GetTick() - tickstart;
+    ret = BSP_LCD_InitPoll(Instance);
   }
 
   return ret;
 }
-
 /**
-  * @brief  De-Initializes the LCD resources.
+  * @brief  Selects the panel descriptor used by the next BSP_LCD_InitEx() call.
+  *         Only this panel is then probed. It allows using timings or clocks
+  *         other than the ones of the supported panels.
   * @param  Instance    LCD Instance
+  * @param  Panel       Panel descriptor, which must stay valid, or NULL to auto-detect
   * @retval BSP status
   */
-int32_t BSP_LCD_DeInit(uint32_t Instance)
+int32_t BSP_LCD_SetPanel(uint32_t Instance, const BSP_LCD_Panel_t *Panel)
 {
   int32_t ret = BSP_ERROR_NONE;
 
@@ -475,84 +1158,457 @@ int32_t BSP_LCD_DeInit(uint32_t Instance)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  else if((Panel != NULL) && ((Panel->Id == LCD_CTRL_UNKNOWN) || (Panel->PixelClock == 0U)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
   else
   {
-    LCD_DeInitSequence();
-#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 0)
-    LTDC_MspDeInit(&hlcd_ltdc);
-#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 0) */
+    Lcd_Panel = Panel;
+    Lcd_Driver_Type = (Panel != NULL) ? Panel->Id : LCD_CTRL_UNKNOWN;
+  }
 
-    DMA2D_MspDeInit(&hlcd_dma2d);
+  return ret;
+}
 
-#if (USE_HAL_DSI_REGISTER_CALLBACKS == 0)
-    DSI_MspDeInit(&hlcd_dsi);
-#endif /* (USE_HAL_DSI_REGISTER_CALLBACKS == 0) */
-    if(HAL_DSI_DeInit(&hlcd_dsi) != HAL_OK)
+/**
+  * @brief  Gets the descriptor of the initialized panel or, before the
+  *         initialization, of the panel set in Lcd_Driver_Type.
+  * @param  Instance    LCD Instance
+  * @param  Panel       Pointer to the panel descriptor
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetPanel(uint32_t Instance, const BSP_LCD_Panel_t **Panel)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  const BSP_LCD_Panel_t *panel;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Panel == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    panel = (Lcd_Panel != NULL) ? Lcd_Panel : LCD_FindPanel(Lcd_Driver_Type);
+    if(panel == NULL)
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
     }
     else
     {
-      (void)HAL_LTDC_DeInit(&hlcd_ltdc);
-      if(HAL_DMA2D_DeInit(&hlcd_dma2d) != HAL_OK)
-      {
-        ret = BSP_ERROR_PERIPH_FAILURE;
-      }
-      else
-      {
-        Lcd_Ctx[Instance].IsMspCallbacksValid = 0;
-      }
+      *Panel = panel;
     }
   }
 
   return ret;
 }
-#if (USE_LCD_CTRL_ADV7533 > 0)
+
+
 /**
-  * @brief  Initializes the LCD HDMI Mode.
+  * @brief  Gets the boot timings of the last initialization.
   * @param  Instance    LCD Instance
-  * @param  Format      HDMI format could be HDMI_FORMAT_720_480 or HDMI_FORMAT_720_576
+  * @param  InitTime    Pointer to the boot timings, all in ms. FirstFrame is 0
+  *                     when the initialization failed.
   * @retval BSP status
   */
-int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format)
+int32_t BSP_LCD_GetInitTime(uint32_t Instance, BSP_LCD_InitTime_t *InitTime)
 {
-  int32_t ret;
-  DSI_PLLInitTypeDef    dsiPllInit;
-  DSI_PHY_TimerTypeDef  dsiPhyInit;
-  MX_LTDC_LayerConfig_t hdmi_config;
-  LCD_HDMI_Timing_t     hdmi_timing;
-  DSI_VidCfgTypeDef     hDsiVideoMode;
+  int32_t ret = BSP_ERROR_NONE;
 
-  if(Instance >= LCD_INSTANCES_NBR)
+  if((Instance >= LCD_INSTANCES_NBR) || (InitTime == NULL))
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    LCD_Get_HDMI_VideoModeTiming(Format, &hdmi_timing);
-    Lcd_Ctx[Instance].XSize       = hdmi_timing.HACT;
-    Lcd_Ctx[Instance].YSize       = hdmi_timing.VACT;
-    Lcd_Ctx[Instance].PixelFormat = LCD_PIXEL_FORMAT_RGB888;
-    Lcd_Ctx[Instance].BppFactor = 4U;
+    *InitTime = Lcd_InitTime[Instance];
+  }
 
-    /* Toggle Hardware Reset of the DSI LCD using
-    * its XRES signal (active low) */
-    BSP_LCD_Reset(Instance);
+  return ret;
+}
 
-    /* Initializes peripherals instance value */
-    hlcd_ltdc.Instance = LTDC;
-    hlcd_dma2d.Instance = DMA2D;
-    hlcd_dsi.Instance = DSI;
+/**
+  * @brief  Starts a batch of DSI writes. The long writes of DSI_IO_Write() are
+  *         then pushed to the command FIFO without waiting for the previous
+  *         packets to be sent. Short writes and reads still wait for them.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_DSI_BatchStart(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
 
-    if(ADV7533_Probe() != BSP_ERROR_NONE)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else if(Lcd_Drv->DisplayOn(Lcd_CompObj)!= BSP_ERROR_NONE)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Lcd_DsiBatch = 1U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Ends a batch of DSI writes, waiting for all its packets to be sent.
+  *         It does not wait when no packet is pending.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_DSI_BatchEnd(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Lcd_DsiBatch = 0U;
+    if(Lcd_DsiBatchPackets != 0U)
+    {
+      LCD_DSI_STATS_START();
+      Lcd_DsiBatchPackets = 0U;
+      ret = LCD_DSI_WaitFlag(DSI_GPSR_CMDFE, DSI_GPSR_CMDFE);
+      LCD_DSI_STATS_STOP(0U, 1U);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Called repeatedly by BSP_LCD_InitWait() while it waits for the panel
+  *         delays. The SDRAM is initialized before the first call.
+  *         Work done here must be split in short chunks as the panel bring-up
+  *         is only advanced between calls.
+  * @param  Instance    LCD Instance
+  * @retval None
+  */
+__weak void BSP_LCD_InitIdleCallback(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+
+  /* This function should be implemented by the user application.
+     It is called into this driver when the panel bring-up is waiting. */
+}
+
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+/**
+  * @brief  Reads the panel cache record, from backup SRAM by default.
+  *         Being __weak it can be overwritten by the application to read
+  *         the record from another memory. The record is checked by the
+  *         caller, it may be left uninitialized.
+  * @param  Instance    LCD Instance
+  * @param  Cache       Pointer to the read record
+  * @retval BSP status
+  */
+__weak int32_t BSP_LCD_PanelCacheRead(uint32_t Instance, BSP_LCD_PanelCache_t *Cache)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+
+  /* The backup SRAM keeps its content over resets */
+  __HAL_RCC_BKPRAM_CLK_ENABLE();
+  SCB_CleanInvalidateDCache_by_Addr((uint32_t *)BSP_LCD_PANEL_CACHE_ADDRESS, (int32_t)sizeof(BSP_LCD_PanelCache_t));
+  *Cache = *(BSP_LCD_PanelCache_t *)BSP_LCD_PANEL_CACHE_ADDRESS;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Writes the panel cache record, to backup SRAM by default. It is
+  *         only called when the detected panel changes.
+  *         Being __weak it can be overwritten by the application to write
+  *         the record to another memory.
+  * @param  Instance    LCD Instance
+  * @param  Cache       Pointer to the record to write
+  * @retval BSP status
+  */
+__weak int32_t BSP_LCD_PanelCacheWrite(uint32_t Instance, const BSP_LCD_PanelCache_t *Cache)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+
+  __HAL_RCC_BKPRAM_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+  *(BSP_LCD_PanelCache_t *)BSP_LCD_PANEL_CACHE_ADDRESS = *Cache;
+  SCB_CleanDCache_by_Addr((uint32_t *)BSP_LCD_PANEL_CACHE_ADDRESS, (int32_t)sizeof(BSP_LCD_PanelCache_t));
+
+  return BSP_ERROR_NONE;
+}
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
+/**
+  * @brief  Computes the DSI PLL and PLL3 settings of a panel for a refresh rate.
+  *         PLL3, using its fractional divider, gives the pixel clock closest to
+  *         the target. The DSI PLL then gives the lane byte clock, not above
+  *         BSP_LCD_DSI_LANE_BYTE_CLOCK_MAX, whose HorizontalLine best matches
+  *         the LTDC line duration while leaving room for the active line
+  *         packet. Ties select the lowest lane byte clock.
+  *         The timings and NumberOfLanes of Panel are read, its DsiPll, Pll3,
+  *         LaneByteClock, PixelClock and TXEscapeCkdiv fields are written.
+  *         The panel may then be selected using BSP_LCD_SetPanel().
+  * @param  Instance       LCD Instance
+  * @param  Panel          Panel descriptor
+  * @param  Width          Display width
+  * @param  Height         Display height
+  * @param  PixelFormat    LCD_PIXEL_FORMAT_RGB565 or LCD_PIXEL_FORMAT_RGB888
+  * @param  RefreshRate    Target refresh rate in mHz
+  * @param  HorizontalLine DSI line duration in lane byte clock cycles, may be NULL
+  * @param  AchievedRate   Refresh rate given by the pixel clock in mHz, may be NULL
+  * @retval BSP status
+  */
+int32_t BSP_LCD_ComputeClocks(uint32_t Instance, BSP_LCD_Panel_t *Panel, uint32_t Width, uint32_t Height, uint32_t PixelFormat,
+                              uint32_t RefreshRate, uint32_t *HorizontalLine, uint32_t *AchievedRate)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t htotal, vtotal, lanes, packet, pixel_clock, pixel_khz;
+  uint32_t idf, odf, ndiv, byte_khz, line, porch;
+  uint32_t best_khz = 0U, best_line = 0U;
+  uint64_t byte_clock, diff, best_diff = 0U;
+  DSI_PLLInitTypeDef best_pll = {0};
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Panel == NULL) || (Width == 0U) || (Height == 0U) || (RefreshRate == 0U) ||
+     ((PixelFormat != LCD_PIXEL_FORMAT_RGB565) && (PixelFormat != LCD_PIXEL_FORMAT_RGB888)) ||
+     ((Panel->NumberOfLanes != DSI_ONE_DATA_LANE) && (Panel->NumberOfLanes != DSI_TWO_DATA_LANES)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    htotal = Width + Panel->HSYNC + Panel->HBP + Panel->HFP;
+    vtotal = Height + Panel->VSYNC + Panel->VBP + Panel->VFP;
+
+    if(LCD_ComputePll3((((uint64_t)RefreshRate * htotal * vtotal) + 500U) / 1000U, &Panel->Pll3, &pixel_clock) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_CLOCK_FAILURE;
+    }
+    else
+    {
+      pixel_khz = (pixel_clock + 500U) / 1000U;
+      lanes = (Panel->NumberOfLanes == DSI_TWO_DATA_LANES) ? 2U : 1U;
+      packet = (Width * ((PixelFormat == LCD_PIXEL_FORMAT_RGB565) ? 2U : 3U)) + LCD_DSI_LONG_PACKET_OVERHEAD;
+      packet = (packet + lanes - 1U) / lanes;
+
+      for(idf = DSI_PLL_IN_DIV1; idf <= DSI_PLL_IN_DIV7; idf++)
+      {
+        if(((HSE_VALUE / idf) < LCD_DSI_PLL_IN_MIN) || ((HSE_VALUE / idf) > LCD_DSI_PLL_IN_MAX))
+        {
+          continue;
+        }
+        for(odf = DSI_PLL_OUT_DIV1; odf <= DSI_PLL_OUT_DIV8; odf++)
+        {
+          for(ndiv = 10U; ndiv <= 125U; ndiv++)
+          {
+            byte_clock = ((uint64_t)HSE_VALUE * 2U * ndiv) / idf;
+            if((byte_clock < LCD_DSI_VCO_MIN) || (byte_clock > LCD_DSI_VCO_MAX))
+            {
+              continue;
+            }
+            byte_clock = byte_clock / (16UL << odf);
+            byte_khz = (uint32_t)((byte_clock + 500U) / 1000U);
+            if(byte_khz > BSP_LCD_DSI_LANE_BYTE_CLOCK_MAX)
+            {
+              continue;
+            }
+
+            /* Same scaling as MX_DSIHOST_DSI_Init() */
+            line  = (htotal * byte_khz) / pixel_khz;
+            porch = ((Panel->HSYNC * byte_khz) / pixel_khz) + ((Panel->HBP * byte_khz) / pixel_khz);
+            if((porch + packet) >= line)
+            {
+              continue;
+            }
+
+            /* DSI and LTDC line durations differ by diff / (byte_clock * pixel_clock) */
+            diff = (uint64_t)line * pixel_clock;
+            byte_clock = byte_clock * htotal;
+            diff = ((diff > byte_clock) ? (diff - byte_clock) : (byte_clock - diff)) / 1000U;
+            if((best_khz == 0U) || ((diff * best_khz) < (best_diff * byte_khz)) ||
+               (((diff * best_khz) == (best_diff * byte_khz)) && (byte_khz < best_khz)))
+            {
+              best_diff = diff;
+              best_khz  = byte_khz;
+              best_line = line;
+              best_pll.PLLNDIV = ndiv;
+              best_pll.PLLIDF  = idf;
+              best_pll.PLLODF  = odf;
+            }
+          }
+        }
+      }
+
+      if(best_khz == 0U)
+      {
+        ret = BSP_ERROR_CLOCK_FAILURE;
+      }
+      else
+      {
+        Panel->DsiPll        = best_pll;
+        Panel->LaneByteClock = best_khz;
+        Panel->PixelClock    = pixel_khz;
+        Panel->TXEscapeCkdiv = (best_khz + LCD_DSI_ESCAPE_CLOCK_MAX - 1U) / LCD_DSI_ESCAPE_CLOCK_MAX;
+
+        if(HorizontalLine != NULL)
+        {
+          *HorizontalLine = best_line;
+        }
+        if(AchievedRate != NULL)
+        {
+          *AchievedRate = (uint32_t)((((uint64_t)pixel_clock * 1000U) + ((htotal * vtotal) / 2U)) / (htotal * vtotal));
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  De-Initializes the LCD resources.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_DeInit(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+#if (USE_BSP_LCD_ANIMATION == 1)
+  uint32_t i;
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Abort a running initialization */
+    Lcd_Init[Instance].State = LCD_INIT_NONE;
+    Lcd_PanelProcess = NULL;
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+    /* Release the held jobs */
+    (void)BSP_LCD_BeamStop(Instance);
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+    LCD_KeepAliveStop();
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+#if (USE_BSP_LCD_ULPM == 1)
+    Lcd_UlpmWakeRequest = 0U;
+    (void)BSP_LCD_Wake(Instance);
+#endif /* USE_BSP_LCD_ULPM == 1 */
+#if (USE_BSP_LCD_CMD_MODE == 1)
+    LCD_CmdModeStop();
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+#if (USE_BSP_LCD_ANIMATION == 1)
+    /* Drop the running animations */
+    for(i = 0U; i < BSP_LCD_ANIM_NBR; i++)
+    {
+      Lcd_Anim.Slots[i].State = LCD_ANIM_FREE;
+    }
+    Lcd_Anim.Pending = 0U;
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+#if (USE_BSP_LCD_CLUT == 1)
+    /* Drop the CLUT swaps */
+    Lcd_ClutSwap[0].Pending = 0U;
+    Lcd_ClutSwap[1].Pending = 0U;
+#endif /* USE_BSP_LCD_CLUT == 1 */
+
+    /* Let the queued DMA2D jobs complete before the reset */
+    (void)BSP_LCD_DMA2D_Sync(Instance);
+
+    LCD_DeInitSequence();
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 0)
+    LTDC_MspDeInit(&hlcd_ltdc);
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 0) */
+
+    DMA2D_MspDeInit(&hlcd_dma2d);
+
+#if (USE_HAL_DSI_REGISTER_CALLBACKS == 0)
+    DSI_MspDeInit(&hlcd_dsi);
+#endif /* (USE_HAL_DSI_REGISTER_CALLBACKS == 0) */
+    if(HAL_DSI_DeInit(&hlcd_dsi) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      (void)HAL_LTDC_DeInit(&hlcd_ltdc);
+      if(HAL_DMA2D_DeInit(&hlcd_dma2d) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        Lcd_Ctx[Instance].IsMspCallbacksValid = 0;
+      }
+    }
+  }
+
+  return ret;
+}
+#if (USE_LCD_CTRL_ADV7533 > 0)
+/**
+  * @brief  Initializes the LCD HDMI Mode.
+  * @param  Instance    LCD Instance
+  * @param  Format      HDMI format could be HDMI_FORMAT_720_480 or HDMI_FORMAT_720_576
+  * @retval BSP status
+  */
+int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format)
+{
+  int32_t ret;
+  DSI_PLLInitTypeDef    dsiPllInit;
+  DSI_PHY_TimerTypeDef  dsiPhyInit;
+  MX_LTDC_LayerConfig_t hdmi_config;
+  LCD_HDMI_Timing_t     hdmi_timing;
+  DSI_VidCfgTypeDef     hDsiVideoMode;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    LCD_Get_HDMI_VideoModeTiming(Format, &hdmi_timing);
+    Lcd_Ctx[Instance].XSize       = hdmi_timing.HACT;
+    Lcd_Ctx[Instance].YSize       = hdmi_timing.VACT;
+    Lcd_Ctx[Instance].PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    Lcd_Ctx[Instance].BppFactor = 4U;
+    Lcd_Ctx[Instance].ActiveLayer = 0U;
+#if (USE_BSP_LCD_ROTATION == 1)
+    Lcd_Rotation[Instance].Rotation = LCD_ROTATION_0;
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+#if (USE_BSP_LCD_ORIENTATION == 1)
+    Lcd_Orientation[Instance] = LCD_ORIENTATION_LANDSCAPE;
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
+#if (USE_BSP_LCD_OVERLAY == 1)
+    Lcd_Layers[Instance][0].XSize       = Lcd_Ctx[Instance].XSize;
+    Lcd_Layers[Instance][0].YSize       = Lcd_Ctx[Instance].YSize;
+    Lcd_Layers[Instance][0].PixelFormat = LCD_PIXEL_FORMAT_RGB888;
+    Lcd_Layers[Instance][0].BppFactor   = 4U;
+    Lcd_Layers[Instance][1].XSize       = 0U;
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+
+    /* Toggle Hardware Reset of the DSI LCD using
+    * its XRES signal (active low) */
+    BSP_LCD_Reset(Instance);
+
+    /* Initializes peripherals instance value */
+    hlcd_ltdc.Instance = LTDC;
+    hlcd_dma2d.Instance = DMA2D;
+    hlcd_dsi.Instance = DSI;
+
+    if(ADV7533_Probe() != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if(Lcd_Drv->DisplayOn(Lcd_CompObj)!= BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
     {
       /* Call first MSP Initialize only in case of first initialization
       * This will set IP blocks LTDC, DSI and DMA2D
@@ -686,6 +1742,8 @@ int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format)
       {
         return BSP_ERROR_PERIPH_FAILURE;
       }
+      LCD_FrameBuffersInit(Instance);
+
       /* Enable the DSI host and wrapper after the LTDC initialization
       To avoid any synchronization issue, the DSI shall be started after enabling the LTDC */
       (void)HAL_DSI_Start(&(hlcd_dsi));
@@ -724,6 +1782,18 @@ int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format)
   * @param  Instance LCD Instance
   */
 void BSP_LCD_Reset(uint32_t Instance)
+{
+  LCD_ResetStart();
+  HAL_Delay(LCD_RESET_LOW_TIME);/* wait 20 ms */
+  HAL_GPIO_WritePin(LCD_RESET_GPIO_PORT , LCD_RESET_PIN, GPIO_PIN_SET);/* Deactivate XRES */
+  HAL_Delay(LCD_RESET_END_TIME);/* Wait for 10ms after releasing XRES before sending commands */
+}
+
+/**
+  * @brief  Configures the XRES pin and activates it (active low).
+  * @retval None
+  */
+static void LCD_ResetStart(void)
 {
   GPIO_InitTypeDef  gpio_init_structure;
 
@@ -738,9 +1808,6 @@ void BSP_LCD_Reset(uint32_t Instance)
 
   /* Activate XRES active low */
   HAL_GPIO_WritePin(LCD_RESET_GPIO_PORT , LCD_RESET_PIN, GPIO_PIN_RESET);
-  HAL_Delay(20);/* wait 20 ms */
-  HAL_GPIO_WritePin(LCD_RESET_GPIO_PORT , LCD_RESET_PIN, GPIO_PIN_SET);/* Deactivate XRES */
-  HAL_Delay(10);/* Wait for 10ms after releasing XRES before sending commands */
 }
 
 /**
@@ -813,137 +1880,20 @@ static void LCD_DeInitSequence(void)
   */
 __weak HAL_StatusTypeDef MX_DSIHOST_DSI_Init(DSI_HandleTypeDef *hdsi, uint32_t Width, uint32_t Height, uint32_t PixelFormat)
 {
+  const BSP_LCD_Panel_t *panel = LCD_GetInitPanel();
   DSI_PLLInitTypeDef PLLInit;
-  DSI_VidCfgTypeDef VidCfg;
 
   hdsi->Instance = DSI;
   hdsi->Init.AutomaticClockLaneControl = DSI_AUTO_CLK_LANE_CTRL_DISABLE;
-
-  if (Lcd_Driver_Type == LCD_CTRL_WAVESHARE_2P8) {
-    /*
-    The lane byte clock is set 125000 Khz
-    The pixel clock is set to 50000 Khz
-    */
-    hdsi->Init.TXEscapeCkdiv = 8;
-    hdsi->Init.NumberOfLanes = DSI_TWO_DATA_LANES;
-    PLLInit.PLLNDIV = 120;
-    PLLInit.PLLIDF = DSI_PLL_IN_DIV3;
-    PLLInit.PLLODF = DSI_PLL_OUT_DIV1;
-  } else if (Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI) {
-    /*
-    The lane byte clock is set 100000 Khz
-    The pixel clock is set to 30000 Khz
-    */
-    hdsi->Init.TXEscapeCkdiv = 10;
-    hdsi->Init.NumberOfLanes = DSI_ONE_DATA_LANE;
-    PLLInit.PLLNDIV = 32;
-    PLLInit.PLLIDF = DSI_PLL_IN_DIV1;
-    PLLInit.PLLODF = DSI_PLL_OUT_DIV1;
-  } else {
-    /*
-    The lane byte clock is set 62500 Khz
-    The pixel clock is set to 27429 Khz
-    */
-    hdsi->Init.TXEscapeCkdiv = 4;
-    hdsi->Init.NumberOfLanes = DSI_TWO_DATA_LANES;
-    PLLInit.PLLNDIV = 100;
-    PLLInit.PLLIDF = DSI_PLL_IN_DIV5;
-    PLLInit.PLLODF = DSI_PLL_OUT_DIV1;
-  }
+  hdsi->Init.TXEscapeCkdiv = panel->TXEscapeCkdiv;
+  hdsi->Init.NumberOfLanes = panel->NumberOfLanes;
+  PLLInit = panel->DsiPll;
   if (HAL_DSI_Init(hdsi, &PLLInit) != HAL_OK)
   {
     return HAL_ERROR;
   }
 
-  /* Timing parameters for all Video modes */
-
-  VidCfg.VirtualChannelID = 0;
-  VidCfg.ColorCoding = PixelFormat;
-
-  if(Lcd_Driver_Type == LCD_CTRL_NT35510)
-  {
-    VidCfg.LooselyPacked = DSI_LOOSELY_PACKED_ENABLE;
-  }
-  else
-  {
-    VidCfg.LooselyPacked = DSI_LOOSELY_PACKED_DISABLE;
-  }
-
-  VidCfg.Mode = DSI_VID_MODE_BURST;
-  VidCfg.PacketSize = Width;
-  VidCfg.NumberOfChunks = 0;
-  VidCfg.NullPacketSize = 0xFFFU;
-  VidCfg.HSPolarity = DSI_HSYNC_ACTIVE_HIGH;
-  VidCfg.VSPolarity = DSI_VSYNC_ACTIVE_HIGH;
-  VidCfg.DEPolarity = DSI_DATA_ENABLE_ACTIVE_HIGH;
-  
-  if(Lcd_Driver_Type == LCD_CTRL_NT35510)
-  {
-    VidCfg.HorizontalSyncActive = (NT35510_480X800_HSYNC * 62500U)/27429U;
-    VidCfg.HorizontalBackPorch = (NT35510_480X800_HBP * 62500U)/27429U;
-    VidCfg.HorizontalLine = ((Width + NT35510_480X800_HSYNC + NT35510_480X800_HBP + NT35510_480X800_HFP) * 62500U)/27429U;
-    VidCfg.VerticalSyncActive = NT35510_480X800_VSYNC;
-    VidCfg.VerticalBackPorch = NT35510_480X800_VBP;
-    VidCfg.VerticalFrontPorch = NT35510_480X800_VFP;
-  }
-  else if(Lcd_Driver_Type == LCD_CTRL_OTM8009A)
-  {
-    VidCfg.HorizontalSyncActive = (OTM8009A_480X800_HSYNC * 62500U)/27429U;
-    VidCfg.HorizontalBackPorch = (OTM8009A_480X800_HBP * 62500U)/27429U;
-    VidCfg.HorizontalLine = ((Width + OTM8009A_480X800_HSYNC + OTM8009A_480X800_HBP + OTM8009A_480X800_HFP) * 62500U)/27429U;
-    VidCfg.VerticalSyncActive = OTM8009A_480X800_VSYNC;
-    VidCfg.VerticalBackPorch = OTM8009A_480X800_VBP;
-    VidCfg.VerticalFrontPorch = OTM8009A_480X800_VFP;
-  }
-  else if(Lcd_Driver_Type == LCD_CTRL_WAVESHARE_2P8)
-  {
-    VidCfg.HorizontalSyncActive = (WAVESHARE_2P8IN_480X640_HSYNC * 125000U)/50000U;
-    VidCfg.HorizontalBackPorch = (WAVESHARE_2P8IN_480X640_HBP * 125000U)/50000U;
-    VidCfg.HorizontalLine = ((Width + WAVESHARE_2P8IN_480X640_HSYNC + WAVESHARE_2P8IN_480X640_HBP + WAVESHARE_2P8IN_480X640_HFP) * 125000U)/50000U;
-    VidCfg.VerticalSyncActive = WAVESHARE_2P8IN_480X640_VSYNC;
-    VidCfg.VerticalBackPorch = WAVESHARE_2P8IN_480X640_VBP;
-    VidCfg.VerticalFrontPorch = WAVESHARE_2P8IN_480X640_VFP;
-  }
-  else if(Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI)
-  {
-    VidCfg.HorizontalSyncActive = (RASPBERRYPI_800X480_HSYNC * 125000U)/30000U;
-    VidCfg.HorizontalBackPorch = (RASPBERRYPI_800X480_HBP * 125000U)/30000U;
-    VidCfg.HorizontalLine = ((Width + RASPBERRYPI_800X480_HSYNC + RASPBERRYPI_800X480_HBP + RASPBERRYPI_800X480_HFP) * 125000U)/30000U;
-    VidCfg.VerticalSyncActive = RASPBERRYPI_800X480_VSYNC;
-    VidCfg.VerticalBackPorch = RASPBERRYPI_800X480_VBP;
-    VidCfg.VerticalFrontPorch = RASPBERRYPI_800X480_VFP;
-    VidCfg.HSPolarity = DSI_HSYNC_ACTIVE_LOW;
-    VidCfg.VSPolarity = DSI_VSYNC_ACTIVE_LOW;
-  }
-
-  VidCfg.VerticalActive = Height;
-  VidCfg.LPCommandEnable = DSI_LP_COMMAND_ENABLE;
-
-  if((Lcd_Driver_Type == LCD_CTRL_NT35510) ||(Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI))
-  {
-    VidCfg.LPLargestPacketSize = 64;
-    VidCfg.LPVACTLargestPacketSize = 64;
-  }
-  else
-  {
-    VidCfg.LPLargestPacketSize = 4;
-    VidCfg.LPVACTLargestPacketSize = 4;
-  }
-
-  VidCfg.LPHorizontalFrontPorchEnable  = DSI_LP_HFP_ENABLE;
-  VidCfg.LPHorizontalBackPorchEnable   = DSI_LP_HBP_ENABLE;
-  VidCfg.LPVerticalActiveEnable        = DSI_LP_VACT_ENABLE;
-  VidCfg.LPVerticalFrontPorchEnable    = DSI_LP_VFP_ENABLE;
-  VidCfg.LPVerticalBackPorchEnable     = DSI_LP_VBP_ENABLE;
-  VidCfg.LPVerticalSyncActiveEnable    = DSI_LP_VSYNC_ENABLE;
-  VidCfg.FrameBTAAcknowledgeEnable     = DSI_FBTAA_DISABLE;
-
-  if (HAL_DSI_ConfigVideoMode(hdsi, &VidCfg) != HAL_OK)
-  {
-    return HAL_ERROR;
-  }
-
-  return HAL_OK;
+  return LCD_DsiConfigVideoMode(hdsi, Width, Height, PixelFormat);
 }
 
 /**
@@ -955,58 +1905,22 @@ __weak HAL_StatusTypeDef MX_DSIHOST_DSI_Init(DSI_HandleTypeDef *hdsi, uint32_t W
   */
 __weak HAL_StatusTypeDef MX_LTDC_Init(LTDC_HandleTypeDef *hltdc, uint32_t Width, uint32_t Height)
 {
+  const BSP_LCD_Panel_t *panel = LCD_GetInitPanel();
+
   hltdc->Instance = LTDC;
-  hltdc->Init.HSPolarity = LTDC_HSPOLARITY_AL;
-  hltdc->Init.VSPolarity = LTDC_VSPOLARITY_AL;
+  hltdc->Init.HSPolarity = panel->LtdcHSPolarity;
+  hltdc->Init.VSPolarity = panel->LtdcVSPolarity;
   hltdc->Init.DEPolarity = LTDC_DEPOLARITY_AL;
   hltdc->Init.PCPolarity = LTDC_PCPOLARITY_IPC;
 
-  if(Lcd_Driver_Type == LCD_CTRL_NT35510)
-  {
-    hltdc->Init.HorizontalSync     = NT35510_480X800_HSYNC - 1;
-    hltdc->Init.AccumulatedHBP     = NT35510_480X800_HSYNC + NT35510_480X800_HBP - 1;
-    hltdc->Init.AccumulatedActiveW = NT35510_480X800_HSYNC + Width + NT35510_480X800_HBP - 1;
-    hltdc->Init.TotalWidth         = NT35510_480X800_HSYNC + Width + NT35510_480X800_HBP + NT35510_480X800_HFP - 1;
-    hltdc->Init.VerticalSync       = NT35510_480X800_VSYNC - 1;
-    hltdc->Init.AccumulatedVBP     = NT35510_480X800_VSYNC + NT35510_480X800_VBP - 1;
-    hltdc->Init.AccumulatedActiveH = NT35510_480X800_VSYNC + Height + NT35510_480X800_VBP - 1;
-    hltdc->Init.TotalHeigh         = NT35510_480X800_VSYNC + Height + NT35510_480X800_VBP + NT35510_480X800_VFP - 1;
-  }
-  else if(Lcd_Driver_Type == LCD_CTRL_OTM8009A)
-  {
-    hltdc->Init.HorizontalSync     = OTM8009A_480X800_HSYNC - 1;
-    hltdc->Init.AccumulatedHBP     = OTM8009A_480X800_HSYNC + OTM8009A_480X800_HBP - 1;
-    hltdc->Init.AccumulatedActiveW = OTM8009A_480X800_HSYNC + Width + OTM8009A_480X800_HBP - 1;
-    hltdc->Init.TotalWidth         = OTM8009A_480X800_HSYNC + Width + OTM8009A_480X800_HBP + OTM8009A_480X800_HFP - 1;
-    hltdc->Init.VerticalSync       = OTM8009A_480X800_VSYNC - 1;
-    hltdc->Init.AccumulatedVBP     = OTM8009A_480X800_VSYNC + OTM8009A_480X800_VBP - 1;
-    hltdc->Init.AccumulatedActiveH = OTM8009A_480X800_VSYNC + Height + OTM8009A_480X800_VBP - 1;
-    hltdc->Init.TotalHeigh         = OTM8009A_480X800_VSYNC + Height + OTM8009A_480X800_VBP + OTM8009A_480X800_VFP - 1;
-  }
-  else if(Lcd_Driver_Type == LCD_CTRL_WAVESHARE_2P8)
-  {
-    hltdc->Init.HorizontalSync     = WAVESHARE_2P8IN_480X640_HSYNC - 1;
-    hltdc->Init.AccumulatedHBP     = WAVESHARE_2P8IN_480X640_HSYNC + WAVESHARE_2P8IN_480X640_HBP - 1;
-    hltdc->Init.AccumulatedActiveW = WAVESHARE_2P8IN_480X640_HSYNC + Width + WAVESHARE_2P8IN_480X640_HBP - 1;
-    hltdc->Init.TotalWidth         = WAVESHARE_2P8IN_480X640_HSYNC + Width + WAVESHARE_2P8IN_480X640_HBP + WAVESHARE_2P8IN_480X640_HFP - 1;
-    hltdc->Init.VerticalSync       = WAVESHARE_2P8IN_480X640_VSYNC - 1;
-    hltdc->Init.AccumulatedVBP     = WAVESHARE_2P8IN_480X640_VSYNC + WAVESHARE_2P8IN_480X640_VBP - 1;
-    hltdc->Init.AccumulatedActiveH = WAVESHARE_2P8IN_480X640_VSYNC + Height + WAVESHARE_2P8IN_480X640_VBP - 1;
-    hltdc->Init.TotalHeigh         = WAVESHARE_2P8IN_480X640_VSYNC + Height + WAVESHARE_2P8IN_480X640_VBP + WAVESHARE_2P8IN_480X640_VFP - 1;
-  }
-  else if(Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI)
-  {
-    hltdc->Init.HorizontalSync     = RASPBERRYPI_800X480_HSYNC - 1;
-    hltdc->Init.AccumulatedHBP     = RASPBERRYPI_800X480_HSYNC + RASPBERRYPI_800X480_HBP - 1;
-    hltdc->Init.AccumulatedActiveW = RASPBERRYPI_800X480_HSYNC + Width + RASPBERRYPI_800X480_HBP - 1;
-    hltdc->Init.TotalWidth         = RASPBERRYPI_800X480_HSYNC + Width + RASPBERRYPI_800X480_HBP + RASPBERRYPI_800X480_HFP - 1;
-    hltdc->Init.VerticalSync       = RASPBERRYPI_800X480_VSYNC - 1;
-    hltdc->Init.AccumulatedVBP     = RASPBERRYPI_800X480_VSYNC + RASPBERRYPI_800X480_VBP - 1;
-    hltdc->Init.AccumulatedActiveH = RASPBERRYPI_800X480_VSYNC + Height + RASPBERRYPI_800X480_VBP - 1;
-    hltdc->Init.TotalHeigh         = RASPBERRYPI_800X480_VSYNC + Height + RASPBERRYPI_800X480_VBP + RASPBERRYPI_800X480_VFP - 1;
-    hltdc->Init.HSPolarity = LTDC_HSPOLARITY_AH;
-    hltdc->Init.VSPolarity = LTDC_VSPOLARITY_AH;
-  }
+  hltdc->Init.HorizontalSync     = panel->HSYNC - 1U;
+  hltdc->Init.AccumulatedHBP     = panel->HSYNC + panel->HBP - 1U;
+  hltdc->Init.AccumulatedActiveW = panel->HSYNC + Width + panel->HBP - 1U;
+  hltdc->Init.TotalWidth         = panel->HSYNC + Width + panel->HBP + panel->HFP - 1U;
+  hltdc->Init.VerticalSync       = panel->VSYNC - 1U;
+  hltdc->Init.AccumulatedVBP     = panel->VSYNC + panel->VBP - 1U;
+  hltdc->Init.AccumulatedActiveH = panel->VSYNC + Height + panel->VBP - 1U;
+  hltdc->Init.TotalHeigh         = panel->VSYNC + Height + panel->VBP + panel->VFP - 1U;
 
   hltdc->Init.Backcolor.Blue  = 0x00;
   hltdc->Init.Backcolor.Green = 0x00;
@@ -1054,39 +1968,8 @@ __weak HAL_StatusTypeDef MX_LTDC_ClockConfig(LTDC_HandleTypeDef *hltdc)
 {
   RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
 
-  if (Lcd_Driver_Type == LCD_CTRL_WAVESHARE_2P8)
-  {
-    PeriphClkInitStruct.PeriphClockSelection   = RCC_PERIPHCLK_LTDC;
-    PeriphClkInitStruct.PLL3.PLL3M      = 5U;
-    PeriphClkInitStruct.PLL3.PLL3N      = 80U;
-    PeriphClkInitStruct.PLL3.PLL3P      = 2U;
-    PeriphClkInitStruct.PLL3.PLL3Q      = 2U;
-    PeriphClkInitStruct.PLL3.PLL3R      = 8U;
-    PeriphClkInitStruct.PLL3.PLL3RGE    = RCC_PLL3VCIRANGE_2; // 4 - 8 MHz
-    PeriphClkInitStruct.PLL3.PLL3VCOSEL = RCC_PLL3VCOMEDIUM; // 400MHz into DIVR3
-    PeriphClkInitStruct.PLL3.PLL3FRACN  = 0U;
-  } else if (Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI)
-  {
-    PeriphClkInitStruct.PeriphClockSelection   = RCC_PERIPHCLK_LTDC;
-    PeriphClkInitStruct.PLL3.PLL3M      = 5U;
-    PeriphClkInitStruct.PLL3.PLL3N      = 96U;
-    PeriphClkInitStruct.PLL3.PLL3P      = 2U;
-    PeriphClkInitStruct.PLL3.PLL3Q      = 2U;
-    PeriphClkInitStruct.PLL3.PLL3R      = 16U;
-    PeriphClkInitStruct.PLL3.PLL3RGE    = RCC_PLL3VCIRANGE_2; // 4 - 8 MHz
-    PeriphClkInitStruct.PLL3.PLL3VCOSEL = RCC_PLL3VCOWIDE; // 480MHz into DIVR3
-    PeriphClkInitStruct.PLL3.PLL3FRACN  = 0U;
-  } else {
-    PeriphClkInitStruct.PeriphClockSelection   = RCC_PERIPHCLK_LTDC;
-    PeriphClkInitStruct.PLL3.PLL3M      = 5U;
-    PeriphClkInitStruct.PLL3.PLL3N      = 132U;
-    PeriphClkInitStruct.PLL3.PLL3P      = 2U;
-    PeriphClkInitStruct.PLL3.PLL3Q      = 2U;
-    PeriphClkInitStruct.PLL3.PLL3R      = 24U;
-    PeriphClkInitStruct.PLL3.PLL3RGE    = RCC_PLLCFGR_PLL3RGE_2;
-    PeriphClkInitStruct.PLL3.PLL3VCOSEL = RCC_PLL3VCOWIDE;
-    PeriphClkInitStruct.PLL3.PLL3FRACN  = 0U;
-  }
+  PeriphClkInitStruct.PeriphClockSelection   = RCC_PERIPHCLK_LTDC;
+  PeriphClkInitStruct.PLL3 = LCD_GetInitPanel()->Pll3;
   return HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
 }
 
@@ -1257,17 +2140,37 @@ int32_t BSP_LCD_SetActiveLayer(uint32_t Instance, uint32_t LayerIndex)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (USE_BSP_LCD_OVERLAY == 1)
+  else if(LayerIndex >= LCD_LAYERS_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
   else
   {
     Lcd_Ctx[Instance].ActiveLayer = LayerIndex;
-  }
 
-  return ret;
-}
-/**
-  * @brief  Gets the LCD Active LCD Pixel Format.
-  * @param  Instance    LCD Instance
-  * @param  PixelFormat Active LCD Pixel Format
+    /* Draw with the geometry and pixel format of the layer, if known */
+    if(Lcd_Layers[Instance][LayerIndex].XSize != 0U)
+    {
+      Lcd_Ctx[Instance].XSize       = Lcd_Layers[Instance][LayerIndex].XSize;
+      Lcd_Ctx[Instance].YSize       = Lcd_Layers[Instance][LayerIndex].YSize;
+      Lcd_Ctx[Instance].PixelFormat = Lcd_Layers[Instance][LayerIndex].PixelFormat;
+      Lcd_Ctx[Instance].BppFactor   = Lcd_Layers[Instance][LayerIndex].BppFactor;
+    }
+  }
+#else
+  else
+  {
+    Lcd_Ctx[Instance].ActiveLayer = LayerIndex;
+  }
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+
+  return ret;
+}
+/**
+  * @brief  Gets the LCD Active LCD Pixel Format.
+  * @param  Instance    LCD Instance
+  * @param  PixelFormat Active LCD Pixel Format
   * @retval BSP status
   */
 int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat)
@@ -1522,6 +2425,137 @@ int32_t BSP_LCD_ResetColorKeying(uint32_t Instance, uint32_t LayerIndex)
   return ret;
 }
 
+#if (USE_BSP_LCD_OVERLAY == 1)
+/**
+  * @brief  Configures layer 1 as an overlay window at LCD_LAYER_1_ADDRESS,
+  *         clears it to transparent and shows it. The overlay is blended over
+  *         layer 0 with its pixel alpha and constant alpha. It is refused when
+  *         it would overlap the layer 0 buffers (LCD_LAYER_0_BUFFERS_NBR > 1
+  *         with the default LCD_LAYER_1_ADDRESS).
+  * @param  Instance    LCD Instance
+  * @param  Xpos        Window X position
+  * @param  Ypos        Window Y position
+  * @param  Width       Window width
+  * @param  Height      Window height
+  * @param  PixelFormat Overlay pixel format, LCD_PIXEL_FORMAT_ARGB8888, _RGB565,
+  *                     _ARGB1555, _ARGB4444, _L8, _AL44 or _AL88
+  * @retval BSP status
+  */
+int32_t BSP_LCD_ConfigOverlay(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t PixelFormat)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  MX_LTDC_LayerConfig_t config;
+  uint32_t bpp;
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_ARGB8888:
+    bpp = 4U;
+    break;
+  case LCD_PIXEL_FORMAT_L8:
+  case LCD_PIXEL_FORMAT_AL44:
+    bpp = 1U;
+    break;
+  case LCD_PIXEL_FORMAT_AL88:
+    bpp = 2U;
+    break;
+  default:
+    /* RGB565, ARGB1555 and ARGB4444, RGB888 is not supported */
+    bpp = (PixelFormat == LCD_PIXEL_FORMAT_RGB888) ? 0U : 2U;
+    break;
+  }
+
+  if((Instance >= LCD_INSTANCES_NBR) || (bpp == 0U) || (PixelFormat > LCD_PIXEL_FORMAT_AL88) ||
+     (Width == 0U) || (Height == 0U) ||
+     ((Xpos + Width) > hlcd_ltdc.LayerCfg[0].ImageWidth) || ((Ypos + Height) > hlcd_ltdc.LayerCfg[0].ImageHeight))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_LCD_CMD_MODE == 1)
+  else if(Lcd_CmdMode.Active != 0U)
+  {
+    /* The partial refreshes only move the layer 0 window */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+  else if((LCD_LAYER_1_ADDRESS < (LCD_LAYER_0_ADDRESS + (LCD_LAYER_0_BUFFERS_NBR * hlcd_ltdc.LayerCfg[0].ImageWidth *
+                                  hlcd_ltdc.LayerCfg[0].ImageHeight * Lcd_Layers[Instance][0].BppFactor))) &&
+          ((LCD_LAYER_1_ADDRESS + (Width * Height * bpp)) > LCD_LAYER_0_ADDRESS))
+  {
+    /* The overlay would overwrite a layer 0 back buffer: LCD_LAYER_1_ADDRESS
+       must be moved after them */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+  else
+  {
+    /* The previous overlay content may still be drawn by the DMA2D */
+    (void)BSP_LCD_DMA2D_Sync(Instance);
+
+    config.X0          = Xpos;
+    config.X1          = Xpos + Width;
+    config.Y0          = Ypos;
+    config.Y1          = Ypos + Height;
+    config.PixelFormat = PixelFormat;  /* Same values as LTDC_PIXEL_FORMAT_xxx */
+    config.Address     = LCD_LAYER_1_ADDRESS;
+    if(MX_LTDC_ConfigLayer(&hlcd_ltdc, 1, &config) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      LCD_ConfigGrayClut(1U, PixelFormat);
+
+      Lcd_Layers[Instance][1].XSize       = Width;
+      Lcd_Layers[Instance][1].YSize       = Height;
+      Lcd_Layers[Instance][1].PixelFormat = PixelFormat;
+      Lcd_Layers[Instance][1].BppFactor   = bpp;
+
+      /* Transparent: null pixel alpha, black L8 pixels are made transparent
+         with BSP_LCD_SetColorKeying() */
+      LCD_CpuFill(1U, LCD_LAYER_1_ADDRESS, Width * Height * bpp, 1U, 0U, 0U);
+
+      if(Lcd_Ctx[Instance].ActiveLayer == 1U)
+      {
+        ret = BSP_LCD_SetActiveLayer(Instance, 1U);
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Moves the overlay window, its content is not changed.
+  * @param  Instance    LCD Instance
+  * @param  Xpos        Window X position
+  * @param  Ypos        Window Y position
+  * @retval BSP status
+  */
+int32_t BSP_LCD_SetOverlayPosition(uint32_t Instance, uint32_t Xpos, uint32_t Ypos)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Lcd_Layers[Instance][1].XSize == 0U) ||
+     ((Xpos + Lcd_Layers[Instance][1].XSize) > hlcd_ltdc.LayerCfg[0].ImageWidth) ||
+     ((Ypos + Lcd_Layers[Instance][1].YSize) > hlcd_ltdc.LayerCfg[0].ImageHeight))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Lcd_Ctx[Instance].ReloadEnable == 1U)
+  {
+    (void)HAL_LTDC_SetWindowPosition(&hlcd_ltdc, Xpos, Ypos, 1);
+  }
+  else
+  {
+    (void)HAL_LTDC_SetWindowPosition_NoReload(&hlcd_ltdc, Xpos, Ypos, 1);
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+
 /**
   * @brief  Gets the LCD X size.
   * @param  Instance  LCD Instance
@@ -1566,6 +2600,139 @@ int32_t BSP_LCD_GetYSize(uint32_t Instance, uint32_t *YSize)
   return ret;
 }
 
+#if (USE_BSP_LCD_ORIENTATION == 1)
+/**
+  * @brief  Switches the NT35510 or OTM8009A panel orientation. The panel scan
+  *         direction is changed and the active width and height swapped, the
+  *         frame buffer content is not moved.
+  * @param  Instance    LCD Instance
+  * @param  Orientation LCD_ORIENTATION_PORTRAIT or LCD_ORIENTATION_LANDSCAPE
+  * @retval BSP status
+  */
+int32_t BSP_LCD_SetOrientation(uint32_t Instance, uint32_t Orientation)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t width, height;
+#if (USE_BSP_LCD_CMD_MODE == 1)
+  uint32_t tickstart;
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Orientation > LCD_ORIENTATION_LANDSCAPE))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if((Lcd_Driver_Type != LCD_CTRL_NT35510) && (Lcd_Driver_Type != LCD_CTRL_OTM8009A))
+  {
+    /* The other panels cannot change their scan direction */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if(Orientation == Lcd_Orientation[Instance])
+  {
+    /* Nothing to do */
+  }
+#if (USE_BSP_LCD_OVERLAY == 1)
+  else if((Lcd_Layers[Instance][1].XSize != 0U) &&
+          ((hlcd_ltdc.LayerCfg[1].WindowX1 > hlcd_ltdc.LayerCfg[0].ImageHeight) ||
+           (hlcd_ltdc.LayerCfg[1].WindowY1 > hlcd_ltdc.LayerCfg[0].ImageWidth)))
+  {
+    /* The overlay window would leave the screen */
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+  else if(BSP_LCD_DMA2D_Sync(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    width  = hlcd_ltdc.LayerCfg[0].ImageHeight;
+    height = hlcd_ltdc.LayerCfg[0].ImageWidth;
+
+#if (USE_BSP_LCD_ULPM == 1)
+    (void)BSP_LCD_Wake(Instance);
+#endif /* USE_BSP_LCD_ULPM == 1 */
+#if (USE_BSP_LCD_CMD_MODE == 1)
+    if(Lcd_CmdMode.Active != 0U)
+    {
+      /* No refresh starts until the panel and the LTDC use the new geometry */
+      __HAL_DSI_DISABLE_IT(&hlcd_dsi, DSI_IT_TE);
+      tickstart = HAL_GetTick();
+      while(Lcd_CmdMode.Busy != 0U)
+      {
+        if((HAL_GetTick() - tickstart) > BSP_LCD_DMA2D_TIMEOUT)
+        {
+          ret = BSP_ERROR_PERIPH_FAILURE;
+          break;
+        }
+      }
+      Lcd_CmdMode.DirtyNbr = 0U;
+    }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+    if(ret == BSP_ERROR_NONE)
+    {
+      ret = LCD_SetActiveSize(Instance, width, height);
+    }
+
+    /* The controller scans its memory in the new direction */
+    if((ret == BSP_ERROR_NONE) && (Lcd_Drv->SetOrientation(Lcd_CompObj, Orientation) < 0))
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+
+    if(ret == BSP_ERROR_NONE)
+    {
+      Lcd_Orientation[Instance] = Orientation;
+#if (USE_BSP_LCD_OVERLAY == 1)
+      Lcd_Layers[Instance][0].XSize = width;
+      Lcd_Layers[Instance][0].YSize = height;
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+      if(Lcd_Ctx[Instance].ActiveLayer == 0U)
+      {
+        Lcd_Ctx[Instance].XSize = width;
+        Lcd_Ctx[Instance].YSize = height;
+      }
+#if (USE_BSP_LCD_ROTATION == 1)
+      /* The rotated buffer follows the new panel size */
+      ret = BSP_LCD_SetRotation(Instance, Lcd_Rotation[Instance].Rotation);
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+    }
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+    if(Lcd_CmdMode.Active != 0U)
+    {
+      __HAL_DSI_ENABLE_IT(&hlcd_dsi, DSI_IT_TE);
+      (void)BSP_LCD_Invalidate(Instance, 0, 0, hlcd_ltdc.LayerCfg[0].ImageWidth, hlcd_ltdc.LayerCfg[0].ImageHeight);
+    }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the panel orientation.
+  * @param  Instance    LCD Instance
+  * @param  Orientation LCD_ORIENTATION_PORTRAIT or LCD_ORIENTATION_LANDSCAPE
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetOrientation(uint32_t Instance, uint32_t *Orientation)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Orientation == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *Orientation = Lcd_Orientation[Instance];
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
+
 /**
   * @brief  Switch On the display.
   * @param  Instance    LCD Instance
@@ -1687,6 +2854,8 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   uint32_t Address;
   uint32_t input_color_mode;
   uint8_t *pbmp;
+  BSP_LCD_Fence_t fence = Lcd_Dma2dQueue.Tail;
+  LCD_STATS_START();
 
   /* Get bitmap data address offset */
   index = (uint32_t)pBmp[10] + ((uint32_t)pBmp[11] << 8) + ((uint32_t)pBmp[12] << 16)  + ((uint32_t)pBmp[13] << 24);
@@ -1701,7 +2870,7 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   bit_pixel = (uint32_t)pBmp[28] + ((uint32_t)pBmp[29] << 8);
 
   /* Set the address */
-  Address = hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (((Lcd_Ctx[Instance].XSize*Ypos) + Xpos)*Lcd_Ctx[Instance].BppFactor);
+  Address = LCD_GetDrawAddress(Instance) + (((Lcd_Ctx[Instance].XSize*Ypos) + Xpos)*Lcd_Ctx[Instance].BppFactor);
 
   /* Get the layer pixel format */
   if ((bit_pixel/8U) == 4U)
@@ -1724,13 +2893,22 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   for(index=0; index < height; index++)
   {
     /* Pixel format conversion */
-    LL_ConvertLineToRGB(Instance, (uint32_t *)pbmp, (uint32_t *)Address, width, input_color_mode);
+    fence = LL_ConvertLineToRGB(Instance, (uint32_t *)pbmp, (uint32_t *)Address, width, input_color_mode);
 
     /* Increment the source and destination buffers */
     Address+=  (Lcd_Ctx[Instance].XSize * Lcd_Ctx[Instance].BppFactor);
     pbmp -= width*(bit_pixel/8U);
   }
 
+  /* The bitmap may be released on return, wait for the last line */
+  if(BSP_LCD_DMA2D_WaitFence(Instance, fence, BSP_LCD_DMA2D_TIMEOUT) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  LCD_AREA_DRAWN(Instance, Xpos, Ypos, width, height);
+  LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_BITMAP, width * height);
+
   return ret;
 }
 /**
@@ -1746,29 +2924,36 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
 int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
 {
     uint32_t i;
+    /* The data is RGB565 for an RGB565 layer, else ARGB8888 */
+    uint32_t src_bpp = (Lcd_Ctx[Instance].PixelFormat == LCD_PIXEL_FORMAT_RGB565) ? 2U : 4U;
+    LCD_STATS_START();
 
 #if (USE_DMA2D_TO_FILL_RGB_RECT == 1)
   uint32_t  Xaddress;
+  BSP_LCD_Fence_t fence = Lcd_Dma2dQueue.Tail;
   for(i = 0; i < Height; i++)
   {
     /* Get the line address */
-    Xaddress = hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*(Ypos + i)) + Xpos));
+    Xaddress = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*(Ypos + i)) + Xpos));
 
 #if (USE_BSP_CPU_CACHE_MAINTENANCE == 1)
-    SCB_CleanDCache_by_Addr((uint32_t *)pdata, Lcd_Ctx[Instance].BppFactor*Lcd_Ctx[Instance].XSize);
+    SCB_CleanDCache_by_Addr((uint32_t *)pData, src_bpp*Width);
 #endif /* USE_BSP_CPU_CACHE_MAINTENANCE */
 
     /* Write line */
     if(Lcd_Ctx[Instance].PixelFormat == LCD_PIXEL_FORMAT_RGB565)
     {
-      LL_ConvertLineToRGB(Instance, (uint32_t *)pData, (uint32_t *)Xaddress, Width, DMA2D_INPUT_RGB565);
+      fence = LL_ConvertLineToRGB(Instance, (uint32_t *)pData, (uint32_t *)Xaddress, Width, DMA2D_INPUT_RGB565);
     }
     else
     {
-      LL_ConvertLineToRGB(Instance, (uint32_t *)pData, (uint32_t *)Xaddress, Width, DMA2D_INPUT_ARGB8888);
+      fence = LL_ConvertLineToRGB(Instance, (uint32_t *)pData, (uint32_t *)Xaddress, Width, DMA2D_INPUT_ARGB8888);
     }
-    pData += Lcd_Ctx[Instance].BppFactor*Width;
+    pData += src_bpp*Width;
   }
+
+  /* pData is owned by the caller, wait for the last line */
+  (void)BSP_LCD_DMA2D_WaitFence(Instance, fence, BSP_LCD_DMA2D_TIMEOUT);
 #else
   uint32_t color, j;
   for(i = 0; i < Height; i++)
@@ -1777,13 +2962,152 @@ int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uin
     {
       color = *pData | (*(pData + 1) << 8) | (*(pData + 2) << 16) | (*(pData + 3) << 24);
       BSP_LCD_WritePixel(Instance, Xpos + j, Ypos + i, color);
-      pData += Lcd_Ctx[Instance].BppFactor;
+      pData += src_bpp;
     }
   }
 #endif
+  LCD_AREA_DRAWN(Instance, Xpos, Ypos, Width, Height);
+  LCD_STATS_STOP(Instance, BSP_LCD_STATS_FILL_RGB_RECT, Width * Height);
+
   return BSP_ERROR_NONE;
 }
 
+/**
+  * @brief  Draws an A8 coverage map with a color, using a single DMA2D blending.
+  * @param  Instance LCD Instance.
+  * @param  Xpos X position.
+  * @param  Ypos Y position.
+  * @param  pAlpha Pointer to the A8 coverage map, Width bytes per line. It must be
+  *         readable by the DMA2D (not in DTCM).
+  * @param  Width Coverage map width.
+  * @param  Height Coverage map height.
+  * @param  Color ARGB8888 color drawn where the coverage is 0xFF.
+  * @param  BackColor ARGB8888 color drawn where the coverage is 0. When its alpha
+  *         is 0, the map is blended over the frame buffer content instead.
+  * @retval BSP status.
+  */
+int32_t BSP_LCD_DrawAlpha(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, const uint8_t *pAlpha, uint32_t Width, uint32_t Height, uint32_t Color, uint32_t BackColor)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t input_color_mode, output_color_mode;
+  uint32_t i, j, address, coverage, back, mixed, shift;
+  BSP_LCD_DMA2D_Job_t job = {0};
+  BSP_LCD_Fence_t fence;
+  LCD_STATS_START();
+
+  if((Instance >= LCD_INSTANCES_NBR) || (pAlpha == NULL) || (Width == 0U) || (Height == 0U) ||
+     ((Xpos + Width) > Lcd_Ctx[Instance].XSize) || ((Ypos + Height) > Lcd_Ctx[Instance].YSize))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(LCD_GetOutputColorMode(Lcd_Ctx[Instance].PixelFormat, &output_color_mode) != BSP_ERROR_NONE)
+  {
+    /* CLUT formats: blended by the CPU, after the queued jobs */
+    (void)BSP_LCD_DMA2D_Sync(Instance);
+
+    for(i = 0U; i < Height; i++)
+    {
+      address = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*(Ypos + i)) + Xpos));
+      for(j = 0U; j < Width; j++)
+      {
+        coverage = ((uint32_t)pAlpha[(i * Width) + j] * (Color >> 24)) / 255U;
+        if((BackColor & 0xFF000000U) != 0U)
+        {
+          back = BackColor;
+        }
+        else if(Lcd_Ctx[Instance].BppFactor == 1U)
+        {
+          back = LCD_RawToColor(Lcd_Ctx[Instance].PixelFormat, *(__IO uint8_t *)address);
+        }
+        else
+        {
+          back = LCD_RawToColor(Lcd_Ctx[Instance].PixelFormat, *(__IO uint16_t *)address);
+        }
+
+        /* Color over the background, channel by channel, the alpha included */
+        mixed = (coverage + (((back >> 24) * (255U - coverage)) / 255U)) << 24;
+        for(shift = 0U; shift < 24U; shift += 8U)
+        {
+          mixed |= (((((Color >> shift) & 0xFFU) * coverage) + (((back >> shift) & 0xFFU) * (255U - coverage))) / 255U) << shift;
+        }
+
+        if(Lcd_Ctx[Instance].BppFactor == 1U)
+        {
+          *(__IO uint8_t *)address = (uint8_t)LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, mixed);
+        }
+        else
+        {
+          *(__IO uint16_t *)address = (uint16_t)LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, mixed);
+        }
+        address += Lcd_Ctx[Instance].BppFactor;
+      }
+    }
+
+    LCD_AREA_DRAWN(Instance, Xpos, Ypos, Width, Height);
+    LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_ALPHA, Width * Height);
+  }
+  else
+  {
+    /* The frame buffer is read back in the format it is written */
+    input_color_mode = LCD_GetReadColorMode(output_color_mode);
+
+    /* The map was just written by the CPU: push it out of the D-cache */
+    SCB_CleanDCache_by_Addr((uint32_t *)pAlpha, (int32_t)(Width * Height));
+
+    job.Init.ColorMode    = output_color_mode;
+    job.Init.OutputOffset = Lcd_Ctx[Instance].XSize - Width;
+
+    /* Foreground: the coverage map, colored by the DMA2D and combined with the color alpha */
+    job.Foreground.InputColorMode = DMA2D_INPUT_A8;
+    job.Foreground.AlphaMode      = DMA2D_COMBINE_ALPHA;
+    job.Foreground.InputAlpha     = Color;
+    job.Foreground.InputOffset    = 0;
+
+    job.Source      = (uint32_t)pAlpha;
+    job.Destination = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*Ypos) + Xpos));
+    job.Width       = Width;
+    job.Height      = Height;
+
+    if((BackColor & 0xFF000000U) == 0U)
+    {
+      /* Background: the frame buffer area itself */
+      job.Init.Mode                 = DMA2D_M2M_BLEND;
+      job.Background.InputColorMode = input_color_mode;
+      job.Background.AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+      job.Background.InputAlpha     = 0xFF;
+      job.Background.InputOffset    = Lcd_Ctx[Instance].XSize - Width;
+      job.Source2                   = job.Destination;
+    }
+    else
+    {
+      /* Background: fixed color, the frame buffer is only written */
+      job.Init.Mode                 = DMA2D_M2M_BLEND_BG;
+      job.Background.InputColorMode = DMA2D_INPUT_ARGB8888;
+      job.Background.AlphaMode      = DMA2D_REPLACE_ALPHA;
+      job.Background.InputAlpha     = BackColor >> 24;
+      job.Background.InputOffset    = 0;
+      job.Source2                   = BackColor & 0x00FFFFFFU;
+    }
+
+    /* pAlpha is owned by the caller, wait for the transfer */
+    if(BSP_LCD_DMA2D_Submit(Instance, &job, &fence) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if(BSP_LCD_DMA2D_WaitFence(Instance, fence, BSP_LCD_DMA2D_TIMEOUT) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      LCD_AREA_DRAWN(Instance, Xpos, Ypos, Width, Height);
+      LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_ALPHA, Width * Height);
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Draws an horizontal line in currently active layer.
   * @param  Instance   LCD Instance
@@ -1796,9 +3120,10 @@ int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uin
 int32_t BSP_LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
   uint32_t  Xaddress;
+  LCD_STATS_START();
 
   /* Get the line address */
-  Xaddress = hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*Ypos) + Xpos));
+  Xaddress = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*Ypos) + Xpos));
 
   /* Write line */
   if((Xpos + Length) > Lcd_Ctx[Instance].XSize)
@@ -1807,6 +3132,9 @@ int32_t BSP_LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
   }
   LL_FillBuffer(Instance, (uint32_t *)Xaddress, Length, 1, 0, Color);
 
+  LCD_AREA_DRAWN(Instance, Xpos, Ypos, Length, 1U);
+  LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_HLINE, Length);
+
   return BSP_ERROR_NONE;
 }
 
@@ -1822,9 +3150,10 @@ int32_t BSP_LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
 int32_t BSP_LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
   uint32_t  Xaddress;
+  LCD_STATS_START();
 
   /* Get the line address */
-  Xaddress = (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress) + (Lcd_Ctx[Instance].BppFactor*(Lcd_Ctx[Instance].XSize*Ypos + Xpos));
+  Xaddress = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*(Lcd_Ctx[Instance].XSize*Ypos + Xpos));
 
   /* Write line */
   if((Ypos + Length) > Lcd_Ctx[Instance].YSize)
@@ -1833,6 +3162,9 @@ int32_t BSP_LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
   }
  LL_FillBuffer(Instance, (uint32_t *)Xaddress, 1, Length, (Lcd_Ctx[Instance].XSize - 1U), Color);
 
+  LCD_AREA_DRAWN(Instance, Xpos, Ypos, 1U, Length);
+  LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_VLINE, Length);
+
   return BSP_ERROR_NONE;
 }
 
@@ -1849,13 +3181,17 @@ int32_t BSP_LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
 int32_t BSP_LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
 {
   uint32_t  Xaddress;
+  LCD_STATS_START();
 
   /* Get the rectangle start address */
-  Xaddress = (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress) + (Lcd_Ctx[Instance].BppFactor*(Lcd_Ctx[Instance].XSize*Ypos + Xpos));
+  Xaddress = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*(Lcd_Ctx[Instance].XSize*Ypos + Xpos));
 
   /* Fill the rectangle */
  LL_FillBuffer(Instance, (uint32_t *)Xaddress, Width, Height, (Lcd_Ctx[Instance].XSize - Width), Color);
 
+  LCD_AREA_DRAWN(Instance, Xpos, Ypos, Width, Height);
+  LCD_STATS_STOP(Instance, BSP_LCD_STATS_FILL_RECT, Width * Height);
+
   return BSP_ERROR_NONE;
 }
 
@@ -1869,677 +3205,5401 @@ int32_t BSP_LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32
   */
 int32_t BSP_LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t *Color)
 {
-  if(hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
+  /* Pixel may be pending in the DMA2D queue */
+  (void)BSP_LCD_DMA2D_Sync(Instance);
+
+  if(Lcd_Ctx[Instance].BppFactor == 4U)
   {
     /* Read data value from SDRAM memory */
-    *Color = *(__IO uint32_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (4U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos)));
+    *Color = *(__IO uint32_t*) (LCD_GetDrawAddress(Instance) + (4U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos)));
   }
-  else /* if((hlcd_ltdc.LayerCfg[layer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) */
+  else if(Lcd_Ctx[Instance].BppFactor == 2U)
   {
     /* Read data value from SDRAM memory */
-    *Color = *(__IO uint16_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (2U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos)));
+    *Color = LCD_RawToColor(Lcd_Ctx[Instance].PixelFormat,
+                            *(__IO uint16_t*) (LCD_GetDrawAddress(Instance) + (2U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos))));
+  }
+  else
+  {
+    /* L8 and AL44 overlay */
+    *Color = LCD_RawToColor(Lcd_Ctx[Instance].PixelFormat,
+                            *(__IO uint8_t*) (LCD_GetDrawAddress(Instance) + (Ypos*Lcd_Ctx[Instance].XSize + Xpos)));
   }
 
   return BSP_ERROR_NONE;
 }
 
 /**
-  * @brief  Draws a pixel on LCD.
-  * @param  Instance    LCD Instance
-  * @param  Xpos X position
-  * @param  Ypos Y position
-  * @param  Color Pixel color
+  * @brief  Gets the frame buffer drawn by the CPU, after the completion of the
+  *         queued DMA2D jobs. The frame buffer is XSize pixels wide, its pixel
+  *         format is given by BSP_LCD_GetPixelFormat(). It must not be mapped
+  *         as write-back cacheable, the LTDC would display stale pixels.
+  * @param  Instance LCD Instance
+  * @param  Address  Frame buffer address of the active layer
   * @retval BSP status
   */
-int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Color)
+int32_t BSP_LCD_GetFrameBuffer(uint32_t Instance, uint32_t *Address)
 {
-  if(hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
+  int32_t ret;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Address == NULL))
   {
-    /* Write data value to SDRAM memory */
-    *(__IO uint32_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (4U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos))) = Color;
+    ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    /* Write data value to SDRAM memory */
-    *(__IO uint16_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (2U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos))) = Color;
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+    /* Jobs held for the scan position were queued before the CPU writes */
+    ret = BSP_LCD_BeamSync(Instance);
+#else
+    ret = BSP_LCD_DMA2D_Sync(Instance);
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+
+    *Address = LCD_GetDrawAddress(Instance);
   }
 
-  return BSP_ERROR_NONE;
+  return ret;
 }
 
 /**
-  * @}
-  */
-
-/** @defgroup STM32H747I_DISCO_LCD_Private_Functions Private Functions
-  * @{
-  */
-/**
-  * @brief  Fills a buffer.
+  * @brief  Declares an area written by the CPU in the frame buffer returned by
+  *         BSP_LCD_GetFrameBuffer(), as the BSP draw functions do for their own
+  *         writes: the area is marked for the rotation flush, sent to a panel
+  *         driven in command mode, or wakes the link from ULPM.
   * @param  Instance LCD Instance
-  * @param  pDst Pointer to destination buffer
-  * @param  xSize Buffer width
-  * @param  ySize Buffer height
-  * @param  OffLine Offset
-  * @param  Color Color index
+  * @param  Xpos     X position
+  * @param  Ypos     Y position
+  * @param  Width    Area width
+  * @param  Height   Area height
+  * @retval BSP status
   */
-static void LL_FillBuffer(uint32_t Instance, uint32_t *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color)
+int32_t BSP_LCD_FrameBufferDrawn(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
 {
-  uint32_t output_color_mode, input_color = Color;
+  int32_t ret = BSP_ERROR_NONE;
 
-  switch(Lcd_Ctx[Instance].PixelFormat)
+  if(Instance >= LCD_INSTANCES_NBR)
   {
-  case LCD_PIXEL_FORMAT_RGB565:
-    output_color_mode = DMA2D_OUTPUT_RGB565; /* RGB565 */
-    input_color = CONVERTRGB5652ARGB8888(Color);
-    break;
-  case LCD_PIXEL_FORMAT_RGB888:
-  default:
-    output_color_mode = DMA2D_OUTPUT_ARGB8888; /* ARGB8888 */
-    break;
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    LCD_AREA_DRAWN(Instance, Xpos, Ypos, Width, Height);
   }
 
-  /* Register to memory mode with ARGB8888 as color Mode */
-  hlcd_dma2d.Init.Mode         = DMA2D_R2M;
-  hlcd_dma2d.Init.ColorMode    = output_color_mode;
-  hlcd_dma2d.Init.OutputOffset = OffLine;
+  return ret;
+}
 
-  hlcd_dma2d.Instance = DMA2D;
+/**
+  * @brief  Draws a pixel on LCD.
+  * @param  Instance    LCD Instance
+  * @param  Xpos X position
+  * @param  Ypos Y position
+  * @param  Color Pixel color
+  * @retval BSP status
+  */
+int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Color)
+{
+  LCD_STATS_START();
 
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hlcd_dma2d) == HAL_OK)
+  /* Keep the CPU write ordered with the queued DMA2D jobs */
+  (void)BSP_LCD_DMA2D_Sync(Instance);
+
+  if(Lcd_Ctx[Instance].BppFactor == 4U)
   {
-    if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 1) == HAL_OK)
-    {
-      if (HAL_DMA2D_Start(&hlcd_dma2d, input_color, (uint32_t)pDst, xSize, ySize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */
-        (void)HAL_DMA2D_PollForTransfer(&hlcd_dma2d, 25);
-      }
-    }
+    /* Write data value to SDRAM memory */
+    *(__IO uint32_t*) (LCD_GetDrawAddress(Instance) + (4U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos))) = Color;
   }
+  else if(Lcd_Ctx[Instance].BppFactor == 2U)
+  {
+    /* Write data value to SDRAM memory */
+    *(__IO uint16_t*) (LCD_GetDrawAddress(Instance) + (2U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos))) =
+      (uint16_t)LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, Color);
+  }
+  else
+  {
+    /* L8 and AL44 overlay */
+    *(__IO uint8_t*) (LCD_GetDrawAddress(Instance) + (Ypos*Lcd_Ctx[Instance].XSize + Xpos)) =
+      (uint8_t)LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, Color);
+  }
+
+  LCD_AREA_DRAWN(Instance, Xpos, Ypos, 1U, 1U);
+  LCD_STATS_STOP(Instance, BSP_LCD_STATS_WRITE_PIXEL, 1U);
+
+  return BSP_ERROR_NONE;
 }
 
 /**
-  * @brief  Converts a line to an RGB pixel format.
-  * @param  Instance LCD Instance
-  * @param  pSrc Pointer to source buffer
-  * @param  pDst Output color
-  * @param  xSize Buffer width
-  * @param  ColorMode Input color mode
+  * @brief  Shows the layer 0 back buffer at the next vertical blanking and
+  *         returns the buffer to draw the next frame in.
+  *         The queued DMA2D jobs are completed first.
+  * @param  Instance    LCD Instance
+  * @param  Address     Address of the new back buffer
+  * @retval BSP status
   */
-static void LL_ConvertLineToRGB(uint32_t Instance, uint32_t *pSrc, uint32_t *pDst, uint32_t xSize, uint32_t ColorMode)
+int32_t BSP_LCD_SwapBuffers(uint32_t Instance, uint32_t *Address)
 {
-  uint32_t output_color_mode;
-
-  switch(Lcd_Ctx[Instance].PixelFormat)
+  int32_t ret = BSP_ERROR_NONE;
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+  LCD_FrameBuffers_t *fb;
+  uint32_t primask, free_buffer;
+#if (LCD_LAYER_0_BUFFERS_NBR == 2U)
+  uint32_t tickstart;
+#if (USE_BSP_LCD_ANIMATION == 1)
+  uint32_t reloads;
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+#endif /* LCD_LAYER_0_BUFFERS_NBR == 2U */
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Address == NULL))
   {
-  case LCD_PIXEL_FORMAT_RGB565:
-    output_color_mode = DMA2D_OUTPUT_RGB565; /* RGB565 */
-    break;
-  case LCD_PIXEL_FORMAT_RGB888:
-  default:
-    output_color_mode = DMA2D_OUTPUT_ARGB8888; /* ARGB8888 */
-    break;
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(BSP_LCD_DMA2D_Sync(Instance) != BSP_ERROR_NONE)
+  {
+    /* Back buffer content is not complete */
+    ret = BSP_ERROR_PERIPH_FAILURE;
   }
+  else
+  {
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+    fb = &Lcd_FrameBuffers[Instance];
 
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  hlcd_dma2d.Init.Mode         = DMA2D_M2M_PFC;
-  hlcd_dma2d.Init.ColorMode    = output_color_mode;
-  hlcd_dma2d.Init.OutputOffset = 0;
+    primask = __get_PRIMASK();
+    __disable_irq();
 
-  /* Foreground Configuration */
-  hlcd_dma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hlcd_dma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hlcd_dma2d.LayerCfg[1].InputColorMode = ColorMode;
-  hlcd_dma2d.LayerCfg[1].InputOffset = 0;
+    LCD_FrameBuffersUpdate(Instance);
 
-  hlcd_dma2d.Instance = DMA2D;
+    if(fb->Pending != fb->Front)
+    {
+      /* Previous frame not shown yet, the new one replaces it */
+      free_buffer = fb->Pending;
+    }
+    else
+    {
+      /* Buffer neither scanned out nor drawn (the front one with 2 buffers) */
+      free_buffer = (LCD_LAYER_0_BUFFERS_NBR == 2U) ? fb->Front : (3U - fb->Front - fb->Back);
+    }
 
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hlcd_dma2d) == HAL_OK)
-  {
-    if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 1) == HAL_OK)
+    (void)HAL_LTDC_SetAddress_NoReload(&hlcd_ltdc, fb->Address[fb->Back], 0);
+    (void)HAL_LTDC_Reload(&hlcd_ltdc, BSP_LCD_RELOAD_VERTICAL_BLANKING);
+    fb->Pending = fb->Back;
+    fb->Back    = free_buffer;
+#if (USE_BSP_LCD_ANIMATION == 1) && (LCD_LAYER_0_BUFFERS_NBR == 2U)
+    reloads = Lcd_Anim.Reloads;
+#endif /* (USE_BSP_LCD_ANIMATION == 1) && (LCD_LAYER_0_BUFFERS_NBR == 2U) */
+
+    __set_PRIMASK(primask);
+
+#if (LCD_LAYER_0_BUFFERS_NBR == 2U)
+    /* The new back buffer is scanned out until the vertical blanking */
+    tickstart = HAL_GetTick();
+#if (USE_BSP_LCD_ANIMATION == 1)
+    /* The running animations request the next reload as soon as this one is done */
+    while(((hlcd_ltdc.Instance->SRCR & LTDC_SRCR_VBR) != 0U) && (Lcd_Anim.Reloads == reloads))
+#else
+    while((hlcd_ltdc.Instance->SRCR & LTDC_SRCR_VBR) != 0U)
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
     {
-      if (HAL_DMA2D_Start(&hlcd_dma2d, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
+      if((HAL_GetTick() - tickstart) > BSP_LCD_DMA2D_TIMEOUT)
       {
-        /* Polling For DMA transfer */
-        (void)HAL_DMA2D_PollForTransfer(&hlcd_dma2d, 50);
+        ret = BSP_ERROR_PERIPH_FAILURE;
+        break;
       }
     }
-  }
-}
-
-/*******************************************************************************
-                       BSP Routines:
-                                       LTDC
-                                       DMA2D
-                                       DSI
-*******************************************************************************/
-/**
-  * @brief  Initialize the BSP LTDC Msp.
-  * @param  hltdc  LTDC handle
-  * @retval None
-  */
-static void LTDC_MspInit(LTDC_HandleTypeDef *hltdc)
-{
-  if(hltdc->Instance == LTDC)
-  {
-    /** Enable the LTDC clock */
-    __HAL_RCC_LTDC_CLK_ENABLE();
-
+#endif /* LCD_LAYER_0_BUFFERS_NBR == 2U */
 
-    /** Toggle Sw reset of LTDC IP */
-    __HAL_RCC_LTDC_FORCE_RESET();
-    __HAL_RCC_LTDC_RELEASE_RESET();
+    *Address = fb->Address[fb->Back];
+#else
+    /* Single buffer, keep drawing to the scanned out buffer */
+    *Address = hlcd_ltdc.LayerCfg[0].FBStartAdress;
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
   }
+
+  return ret;
 }
 
 /**
-  * @brief  De-Initializes the BSP LTDC Msp
-  * @param  hltdc  LTDC handle
+  * @brief  This function handles the LTDC interrupt request.
+  * @param  Instance    LCD Instance
   * @retval None
   */
-static void LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc)
+void BSP_LCD_LTDC_IRQHandler(uint32_t Instance)
 {
-  if(hltdc->Instance == LTDC)
+  if(Instance < LCD_INSTANCES_NBR)
   {
-    /** Force and let in reset state LTDC */
-    __HAL_RCC_LTDC_FORCE_RESET();
-
-    /** Disable the LTDC */
-    __HAL_RCC_LTDC_CLK_DISABLE();
+    HAL_LTDC_IRQHandler(&hlcd_ltdc);
   }
 }
 
+#if (USE_BSP_LCD_CLUT == 1)
 /**
-  * @brief  Initialize the BSP DMA2D Msp.
-  * @param  hdma2d  DMA2D handle
-  * @retval None
+  * @brief  Loads the CLUT of an L8, AL44 or AL88 layer. The new colors are
+  *         used from the line being scanned out, use BSP_LCD_SwapCLUT() to
+  *         change all of them at the vertical blanking.
+  * @param  Instance    LCD Instance
+  * @param  LayerIndex  Layer 0 or 1
+  * @param  pCLUT       ARGB8888 colors, their alpha is not used by the LTDC
+  * @param  Size        Number of colors, up to 256 (16 for an AL44 layer)
+  * @retval BSP status
   */
-static void DMA2D_MspInit(DMA2D_HandleTypeDef *hdma2d)
+int32_t BSP_LCD_SetCLUT(uint32_t Instance, uint32_t LayerIndex, const uint32_t *pCLUT, uint32_t Size)
 {
-  if(hdma2d->Instance == DMA2D)
-  {
-    /** Enable the DMA2D clock */
-    __HAL_RCC_DMA2D_CLK_ENABLE();
+  int32_t ret = BSP_ERROR_NONE;
 
-    /** Toggle Sw reset of DMA2D IP */
-    __HAL_RCC_DMA2D_FORCE_RESET();
-    __HAL_RCC_DMA2D_RELEASE_RESET();
+  if((Instance >= LCD_INSTANCES_NBR) || (LayerIndex > 1U) || (pCLUT == NULL) || (Size == 0U) ||
+     (Size > LCD_ClutSize(hlcd_ltdc.LayerCfg[LayerIndex].PixelFormat)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
   }
-}
-
-/**
-  * @brief  De-Initializes the BSP DMA2D Msp
-  * @param  hdma2d  DMA2D handle
-  * @retval None
-  */
-static void DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d)
-{
-  if(hdma2d->Instance == DMA2D)
+  else
   {
-    /** Disable IRQ of DMA2D IP */
-    HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+    (void)HAL_LTDC_ConfigCLUT(&hlcd_ltdc, pCLUT, Size, LayerIndex);
 
-    /** Force and let in reset state DMA2D */
-    __HAL_RCC_DMA2D_FORCE_RESET();
+    if(Lcd_Ctx[Instance].ReloadEnable == 1U)
+    {
+      (void)HAL_LTDC_EnableCLUT(&hlcd_ltdc, LayerIndex);
+    }
+    else
+    {
+      (void)HAL_LTDC_EnableCLUT_NoReload(&hlcd_ltdc, LayerIndex);
+    }
 
-    /** Disable the DMA2D */
-    __HAL_RCC_DMA2D_CLK_DISABLE();
+#if (USE_BSP_LCD_CMD_MODE == 1)
+    if(Lcd_CmdMode.Active != 0U)
+    {
+      /* The panel shows the new colors once refreshed */
+      (void)BSP_LCD_Invalidate(Instance, 0, 0, hlcd_ltdc.LayerCfg[0].ImageWidth, hlcd_ltdc.LayerCfg[0].ImageHeight);
+    }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
   }
+
+  return ret;
 }
 
 /**
-  * @brief  Initialize the BSP DSI Msp.
-  * @param  hdsi  DSI handle
-  * @retval None
+  * @brief  Loads the CLUT of an L8, AL44 or AL88 layer at the next vertical
+  *         blanking (palette animation). The colors are copied, a new swap
+  *         requested before the vertical blanking replaces this one.
+  * @param  Instance    LCD Instance
+  * @param  LayerIndex  Layer 0 or 1
+  * @param  pCLUT       ARGB8888 colors, their alpha is not used by the LTDC
+  * @param  Size        Number of colors, up to 256 (16 for an AL44 layer)
+  * @retval BSP status
   */
-static void DSI_MspInit(DSI_HandleTypeDef *hdsi)
+int32_t BSP_LCD_SwapCLUT(uint32_t Instance, uint32_t LayerIndex, const uint32_t *pCLUT, uint32_t Size)
 {
-  if(hdsi->Instance == DSI)
-  {
-    /** Enable DSI Host and wrapper clocks */
-    __HAL_RCC_DSI_CLK_ENABLE();
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask, i;
 
-    /** Soft Reset the DSI Host and wrapper */
-    __HAL_RCC_DSI_FORCE_RESET();
-    __HAL_RCC_DSI_RELEASE_RESET();
+  if((Instance >= LCD_INSTANCES_NBR) || (LayerIndex > 1U) || (pCLUT == NULL) || (Size == 0U) ||
+     (Size > LCD_ClutSize(hlcd_ltdc.LayerCfg[LayerIndex].PixelFormat)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
   }
-}
-
-/**
-  * @brief  De-Initializes the BSP DSI Msp
-  * @param  hdsi  DSI handle
-  * @retval None
-  */
-static void DSI_MspDeInit(DSI_HandleTypeDef *hdsi)
-{
-  if(hdsi->Instance == DSI)
+#if (USE_BSP_LCD_CMD_MODE == 1)
+  else if(Lcd_CmdMode.Active == 1U)
   {
-    /** Disable IRQ of DSI IP */
-    HAL_NVIC_DisableIRQ(DSI_IRQn);
+    /* The LTDC only runs during the refreshes of the panel */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+  else
+  {
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+    if(HAL_LTDC_RegisterCallback(&hlcd_ltdc, HAL_LTDC_RELOAD_EVENT_CB_ID, LTDC_ReloadEventCallback) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 1) */
 
-    /** Force and let in reset state the DSI Host + Wrapper IPs */
-    __HAL_RCC_DSI_FORCE_RESET();
+    if(ret == BSP_ERROR_NONE)
+    {
+      primask = __get_PRIMASK();
+      __disable_irq();
 
-    /** Disable the DSI Host and Wrapper clocks */
-    __HAL_RCC_DSI_CLK_DISABLE();
+      for(i = 0U; i < Size; i++)
+      {
+        Lcd_ClutSwap[LayerIndex].Colors[i] = pCLUT[i];
+      }
+      Lcd_ClutSwap[LayerIndex].Size    = Size;
+      Lcd_ClutSwap[LayerIndex].Pending = 1U;
+
+      if((LTDC_LAYER(&hlcd_ltdc, LayerIndex)->CR & LTDC_LxCR_CLUTEN) == 0U)
+      {
+        (void)HAL_LTDC_EnableCLUT_NoReload(&hlcd_ltdc, LayerIndex);
+      }
+
+      /* The colors are written from the reload interrupt of the vertical blanking */
+      __HAL_LTDC_ENABLE_IT(&hlcd_ltdc, LTDC_IT_RR);
+      hlcd_ltdc.Instance->SRCR = LTDC_SRCR_VBR;
+
+      __set_PRIMASK(primask);
+    }
   }
+
+  return ret;
 }
 
 /**
-  * @brief  DCS or Generic short/long write command
-  * @param  ChannelNbr Virtual channel ID
-  * @param  Reg Register to be written
-  * @param  pData pointer to a buffer of data to be write
-  * @param  Size To precise command to be used (short or long)
+  * @brief  Draws an L8, AL44 or AL88 image in the active layer. The DMA2D
+  *         converts the indexes of the image through its CLUT, the AL44 and
+  *         AL88 pixels are blended over the frame buffer using their alpha.
+  *         The indexes are copied as they are to a layer of the image format,
+  *         the layer CLUT then gives their colors.
+  * @param  Instance LCD Instance
+  * @param  Xpos     X position
+  * @param  Ypos     Y position
+  * @param  Image    Indexed image and its CLUT
   * @retval BSP status
   */
-static int32_t DSI_IO_Write(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData, uint16_t Size)
+int32_t BSP_LCD_DrawIndexed(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, const BSP_LCD_IndexedImage_t *Image)
 {
   int32_t ret = BSP_ERROR_NONE;
+  uint32_t input_color_mode = DMA2D_INPUT_L8, output_color_mode, bpp = 0U;
+  BSP_LCD_DMA2D_Job_t job = {0};
+  BSP_LCD_Fence_t fence;
+  LCD_STATS_START();
 
-  if(Size <= 1U)
+  if((Instance >= LCD_INSTANCES_NBR) || (Image == NULL))
   {
-    if(HAL_DSI_ShortWrite(&hlcd_dsi, ChannelNbr, DSI_DCS_SHORT_PKT_WRITE_P1, Reg, (uint32_t)pData[Size]) != HAL_OK)
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if((Image->pData == NULL) || (Image->Width == 0U) || (Image->Height == 0U) ||
+          ((Xpos + Image->Width) > Lcd_Ctx[Instance].XSize) || ((Ypos + Image->Height) > Lcd_Ctx[Instance].YSize) ||
+          (LCD_GetInputColorMode(Image->PixelFormat, &input_color_mode, &bpp) != BSP_ERROR_NONE))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(LCD_GetOutputColorMode(Lcd_Ctx[Instance].PixelFormat, &output_color_mode) != BSP_ERROR_NONE)
+  {
+    if(Image->PixelFormat != Lcd_Ctx[Instance].PixelFormat)
     {
-      ret = BSP_ERROR_BUS_FAILURE;
+      /* The DMA2D cannot write indexes of another format */
+      ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    else
+    {
+      /* Copy of the indexes, of the foreground pixel size */
+      job.Init.Mode      = DMA2D_M2M;
+      job.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
     }
   }
+  else if((Image->pCLUT == NULL) || (Image->CLUTSize == 0U) || (Image->CLUTSize > LCD_ClutSize(Image->PixelFormat)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
   else
   {
-    if(HAL_DSI_LongWrite(&hlcd_dsi, ChannelNbr, DSI_DCS_LONG_PKT_WRITE, Size, (uint32_t)Reg, pData) != HAL_OK)
+    job.Init.Mode      = (Image->PixelFormat == LCD_PIXEL_FORMAT_L8) ? DMA2D_M2M_PFC : DMA2D_M2M_BLEND;
+    job.Init.ColorMode = output_color_mode;
+    job.pCLUT          = Image->pCLUT;
+    job.CLUTSize       = Image->CLUTSize;
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+#if (USE_BSP_CPU_CACHE_MAINTENANCE == 1)
+    SCB_CleanDCache_by_Addr((uint32_t *)Image->pData, (int32_t)(Image->Width * Image->Height * bpp));
+    if(job.pCLUT != NULL)
     {
-      ret = BSP_ERROR_BUS_FAILURE;
+      SCB_CleanDCache_by_Addr((uint32_t *)job.pCLUT, (int32_t)(job.CLUTSize * 4U));
+    }
+#endif /* USE_BSP_CPU_CACHE_MAINTENANCE */
+
+    job.Init.OutputOffset = Lcd_Ctx[Instance].XSize - Image->Width;
+
+    job.Foreground.InputColorMode = input_color_mode;
+    job.Foreground.AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+    job.Foreground.InputAlpha     = 0xFF;
+    job.Foreground.InputOffset    = 0;
+
+    job.Source      = (uint32_t)Image->pData;
+    job.Destination = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*Ypos) + Xpos));
+    job.Width       = Image->Width;
+    job.Height      = Image->Height;
+
+    if(job.Init.Mode == DMA2D_M2M_BLEND)
+    {
+      /* Background: the frame buffer area itself */
+      job.Background.InputColorMode = LCD_GetReadColorMode(output_color_mode);
+      job.Background.AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+      job.Background.InputAlpha     = 0xFF;
+      job.Background.InputOffset    = Lcd_Ctx[Instance].XSize - Image->Width;
+      job.Source2                   = job.Destination;
+    }
+
+    /* The image is owned by the caller, wait for the transfer */
+    if(BSP_LCD_DMA2D_Submit(Instance, &job, &fence) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if(BSP_LCD_DMA2D_WaitFence(Instance, fence, BSP_LCD_DMA2D_TIMEOUT) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      LCD_AREA_DRAWN(Instance, Xpos, Ypos, Image->Width, Image->Height);
+      LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_INDEXED, Image->Width * Image->Height);
     }
   }
 
   return ret;
 }
+#endif /* USE_BSP_LCD_CLUT == 1 */
 
+#if (USE_BSP_LCD_ASSETS == 1)
 /**
-  * @brief  DCS or Generic read command
-  * @param  ChannelNbr Virtual channel ID
-  * @param  Reg Register to be read
-  * @param  pData pointer to a buffer to store the payload of a read back operation.
-  * @param  Size  Data size to be read (in byte).
+  * @brief  Finds an asset of a pack written by Tools/lcd_assets.py. The pack
+  *         directory is checked and the asset pixels are not copied: pData
+  *         points into the pack, so that an uncompressed asset stored in a
+  *         memory mapped flash is drawn where it is stored.
+  * @param  pPack  Pack start, 32-byte aligned
+  * @param  Id     Asset Id (ASSET_xxx define of the generated header)
+  * @param  Asset  Asset found
   * @retval BSP status
   */
-static int32_t DSI_IO_Read(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData, uint16_t Size)
+int32_t BSP_LCD_AssetFind(const void *pPack, uint32_t Id, BSP_LCD_Asset_t *Asset)
 {
   int32_t ret = BSP_ERROR_NONE;
+  const BSP_LCD_AssetDir_t *dir = (const BSP_LCD_AssetDir_t *)pPack;
+  const BSP_LCD_AssetEntry_t *entries, *entry = NULL;
+  uint32_t low, high, middle, bpp;
 
-  if(HAL_DSI_Read(&hlcd_dsi, ChannelNbr, pData, Size, DSI_DCS_SHORT_PKT_READ, Reg, pData) != HAL_OK)
+  if((pPack == NULL) || (Asset == NULL))
   {
-    ret = BSP_ERROR_BUS_FAILURE;
+    ret = BSP_ERROR_WRONG_PARAM;
   }
-
-  return ret;
-}
-#if (USE_LCD_CTRL_ADV7533 > 0)
-/**
-  * @brief  Get HDMI DSI video mode timings for selected format
-  * @param  Format   Display format
+  else if((dir->Magic != BSP_LCD_ASSET_MAGIC) || (dir->Version != BSP_LCD_ASSET_VERSION) ||
+          (dir->Size < sizeof(BSP_LCD_AssetDir_t)) ||
+          (dir->Count > ((dir->Size - sizeof(BSP_LCD_AssetDir_t)) / sizeof(BSP_LCD_AssetEntry_t))))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* The entries follow the directory, sorted by Id */
+    entries = (const BSP_LCD_AssetEntry_t *)&dir[1];
+    low     = 0U;
+    high    = dir->Count;
+    while((low < high) && (entry == NULL))
+    {
+      middle = (low + high) / 2U;
+      if(entries[middle].Id == Id)
+      {
+        entry = &entries[middle];
+      }
+      else if(entries[middle].Id < Id)
+      {
+        low = middle + 1U;
+      }
+      else
+      {
+        high = middle;
+      }
+    }
+
+    bpp = (entry == NULL) ? 0U : LCD_AssetBpp(entry->Format);
+    if((entry == NULL) || (bpp == 0U) || (entry->Width == 0U) || (entry->Height == 0U) ||
+       (entry->Stride < ((uint64_t)entry->Width * bpp)) || ((entry->Stride % bpp) != 0U) ||
+       (((uint64_t)entry->Stride * entry->Height) > 0xFFFFFFFFU) ||
+       (entry->Offset > dir->Size) || (entry->StoredSize > (dir->Size - entry->Offset)) ||
+       (entry->Compression > BSP_LCD_ASSET_LZ4) ||
+       ((entry->Compression == BSP_LCD_ASSET_RAW) && (entry->StoredSize < (entry->Stride * entry->Height))))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else if((entry->Format == BSP_LCD_ASSET_L8) &&
+            ((entry->CLUTSize == 0U) || (entry->CLUTSize > 256U) || ((entry->CLUTOffset % 4U) != 0U) ||
+             (entry->CLUTOffset > dir->Size) || ((entry->CLUTSize * 4U) > (dir->Size - entry->CLUTOffset))))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else
+    {
+      Asset->Id          = entry->Id;
+      Asset->Format      = entry->Format;
+      Asset->Width       = entry->Width;
+      Asset->Height      = entry->Height;
+      Asset->Stride      = entry->Stride;
+      Asset->Flags       = entry->Flags;
+      Asset->Compression = entry->Compression;
+      Asset->pData       = (const uint8_t *)pPack + entry->Offset;
+      Asset->DataSize    = entry->StoredSize;
+      if(entry->Format == BSP_LCD_ASSET_L8)
+      {
+        Asset->pCLUT    = (const uint32_t *)((const uint8_t *)pPack + entry->CLUTOffset);
+        Asset->CLUTSize = entry->CLUTSize;
+      }
+      else
+      {
+        Asset->pCLUT    = NULL;
+        Asset->CLUTSize = 0U;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Makes an asset ready to be drawn. A compressed asset is decoded to
+  *         pBuffer, which pData then points to. An uncompressed asset is left
+  *         where it is stored and pBuffer is not used.
+  *         The asset pixels and CLUT are cleaned from the D-cache, for the DMA2D.
+  * @param  Asset    Asset found by BSP_LCD_AssetFind()
+  * @param  pBuffer  Decoded pixels, readable by the DMA2D (not in DTCM)
+  * @param  Size     pBuffer size in bytes, at least Stride * Height
+  * @retval BSP status
+  */
+int32_t BSP_LCD_AssetLoad(BSP_LCD_Asset_t *Asset, uint8_t *pBuffer, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t bpp;
+
+  if((Asset == NULL) || (Asset->pData == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Asset->Compression == BSP_LCD_ASSET_RAW)
+  {
+    /* Drawn in place */
+  }
+  else if((pBuffer == NULL) || (Size < (Asset->Stride * Asset->Height)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    bpp = LCD_AssetBpp(Asset->Format);
+    if(Asset->Compression == BSP_LCD_ASSET_RLE)
+    {
+      ret = LCD_AssetRle(Asset->pData, Asset->DataSize, pBuffer, Asset->Stride * Asset->Height, bpp);
+    }
+    else if(Asset->Compression == BSP_LCD_ASSET_LZ4)
+    {
+      ret = LCD_AssetLz4(Asset->pData, Asset->DataSize, pBuffer, Asset->Stride * Asset->Height);
+    }
+    else
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+
+    if(ret == BSP_ERROR_NONE)
+    {
+      Asset->pData       = pBuffer;
+      Asset->DataSize    = Asset->Stride * Asset->Height;
+      Asset->Compression = BSP_LCD_ASSET_RAW;
+    }
+  }
+
+#if (USE_BSP_CPU_CACHE_MAINTENANCE == 1)
+  if(ret == BSP_ERROR_NONE)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)Asset->pData, (int32_t)(Asset->Stride * Asset->Height));
+    if(Asset->pCLUT != NULL)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)Asset->pCLUT, (int32_t)(Asset->CLUTSize * 4U));
+    }
+  }
+#endif /* USE_BSP_CPU_CACHE_MAINTENANCE */
+
+  return ret;
+}
+
+/**
+  * @brief  Draws an asset in the active layer with a single DMA2D transfer.
+  *         Opaque assets of the layer format are copied, the other opaque
+  *         assets converted (the L8 ones through their CLUT) and the assets
+  *         with an alpha blended over the frame buffer. An A8 asset is a
+  *         coverage map of Color, blended over the frame buffer.
+  *         To an L8 layer, only the indexes of an L8 asset are copied.
+  * @param  Instance LCD Instance
+  * @param  Xpos     X position
+  * @param  Ypos     Y position
+  * @param  Asset    Asset made ready by BSP_LCD_AssetLoad()
+  * @param  Color    ARGB8888 color of an A8 asset, not used otherwise
+  * @retval BSP status
+  */
+int32_t BSP_LCD_DrawAsset(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, const BSP_LCD_Asset_t *Asset, uint32_t Color)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t output_color_mode, bpp;
+  BSP_LCD_DMA2D_Job_t job = {0};
+  BSP_LCD_Fence_t fence;
+  LCD_STATS_START();
+
+  bpp = (Asset == NULL) ? 0U : LCD_AssetBpp(Asset->Format);
+  if((Instance >= LCD_INSTANCES_NBR) || (Asset == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if((Asset->pData == NULL) || (Asset->Compression != BSP_LCD_ASSET_RAW) || (bpp == 0U) || (Asset->Width == 0U) || (Asset->Height == 0U) ||
+          (Asset->Stride < (Asset->Width * bpp)) || ((Asset->Stride % bpp) != 0U) ||
+          ((Asset->Format == BSP_LCD_ASSET_L8) && ((Asset->pCLUT == NULL) || (Asset->CLUTSize == 0U) || (Asset->CLUTSize > 256U))) ||
+          ((Xpos + Asset->Width) > Lcd_Ctx[Instance].XSize) || ((Ypos + Asset->Height) > Lcd_Ctx[Instance].YSize))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(LCD_GetOutputColorMode(Lcd_Ctx[Instance].PixelFormat, &output_color_mode) != BSP_ERROR_NONE)
+  {
+    if((Asset->Format != BSP_LCD_ASSET_L8) || (Lcd_Ctx[Instance].PixelFormat != LCD_PIXEL_FORMAT_L8))
+    {
+      /* The DMA2D cannot write indexes */
+      ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    else
+    {
+      /* Copy of the indexes, of the foreground pixel size */
+      job.Init.Mode      = DMA2D_M2M;
+      job.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+    }
+  }
+  else
+  {
+    if((Asset->Format == BSP_LCD_ASSET_A8) || ((Asset->Flags & BSP_LCD_ASSET_OPAQUE) == 0U))
+    {
+      job.Init.Mode = DMA2D_M2M_BLEND;
+    }
+    else if(Asset->Format == output_color_mode)
+    {
+      job.Init.Mode = DMA2D_M2M;
+    }
+    else
+    {
+      job.Init.Mode = DMA2D_M2M_PFC;
+    }
+    job.Init.ColorMode = output_color_mode;
+
+    if(Asset->Format == BSP_LCD_ASSET_L8)
+    {
+      job.pCLUT    = Asset->pCLUT;
+      job.CLUTSize = Asset->CLUTSize;
+    }
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    job.Init.OutputOffset = Lcd_Ctx[Instance].XSize - Asset->Width;
+
+    job.Foreground.InputColorMode = Asset->Format;
+    if(Asset->Format == BSP_LCD_ASSET_A8)
+    {
+      /* Coverage map, colored by the DMA2D and combined with the color alpha */
+      job.Foreground.AlphaMode  = DMA2D_COMBINE_ALPHA;
+      job.Foreground.InputAlpha = Color;
+    }
+    else
+    {
+      job.Foreground.AlphaMode  = DMA2D_NO_MODIF_ALPHA;
+      job.Foreground.InputAlpha = 0xFF;
+    }
+    /* Lines padded to the stride */
+    job.Foreground.InputOffset = (Asset->Stride / bpp) - Asset->Width;
+
+    job.Source      = (uint32_t)Asset->pData;
+    job.Destination = LCD_GetDrawAddress(Instance) + (Lcd_Ctx[Instance].BppFactor*((Lcd_Ctx[Instance].XSize*Ypos) + Xpos));
+    job.Width       = Asset->Width;
+    job.Height      = Asset->Height;
+
+    if(job.Init.Mode == DMA2D_M2M_BLEND)
+    {
+      /* Background: the frame buffer area itself */
+      job.Background.InputColorMode = LCD_GetReadColorMode(output_color_mode);
+      job.Background.AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+      job.Background.InputAlpha     = 0xFF;
+      job.Background.InputOffset    = Lcd_Ctx[Instance].XSize - Asset->Width;
+      job.Source2                   = job.Destination;
+    }
+
+    /* The decoded pixels may be reused by the caller, wait for the transfer */
+    if(BSP_LCD_DMA2D_Submit(Instance, &job, &fence) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if(BSP_LCD_DMA2D_WaitFence(Instance, fence, BSP_LCD_DMA2D_TIMEOUT) != BSP_ERROR_NONE)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      LCD_AREA_DRAWN(Instance, Xpos, Ypos, Asset->Width, Asset->Height);
+      LCD_STATS_STOP(Instance, BSP_LCD_STATS_DRAW_ASSET, Asset->Width * Asset->Height);
+    }
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_ASSETS == 1 */
+
+#if (USE_BSP_LCD_ANIMATION == 1)
+/**
+  * @brief  Starts interpolating a layer register once per frame. The From value
+  *         is shown at the next vertical blanking and the To value Frames
+  *         vertical blankings later.
+  * @param  Instance    LCD Instance
+  * @param  Anim        Animated layer property, values and duration
+  * @param  Id          Animation identifier, given to BSP_LCD_AnimCallback()
+  * @retval BSP status, BSP_ERROR_BUSY if BSP_LCD_ANIM_NBR animations are running
+  */
+int32_t BSP_LCD_AnimStart(uint32_t Instance, const BSP_LCD_Anim_t *Anim, uint32_t *Id)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask, step = 1U, i, slot = BSP_LCD_ANIM_NBR, free_slot = BSP_LCD_ANIM_NBR;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Anim == NULL) || (Id == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_LCD_CMD_MODE == 1)
+  else if(Lcd_CmdMode.Active == 1U)
+  {
+    /* The LTDC only runs during the refreshes of the panel */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+  else
+  {
+    ret = LCD_AnimCheck(Anim, &step);
+
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+    if(ret == BSP_ERROR_NONE)
+    {
+      if(HAL_LTDC_RegisterCallback(&hlcd_ltdc, HAL_LTDC_RELOAD_EVENT_CB_ID, LTDC_ReloadEventCallback) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 1) */
+
+    if(ret == BSP_ERROR_NONE)
+    {
+      primask = __get_PRIMASK();
+      __disable_irq();
+
+      for(i = 0U; i < BSP_LCD_ANIM_NBR; i++)
+      {
+        if(Lcd_Anim.Slots[i].State == LCD_ANIM_FREE)
+        {
+          if(free_slot == BSP_LCD_ANIM_NBR)
+          {
+            free_slot = i;
+          }
+        }
+        else if((Lcd_Anim.Slots[i].Anim.LayerIndex == Anim->LayerIndex) &&
+                (Lcd_Anim.Slots[i].Anim.Property == Anim->Property))
+        {
+          /* Replace the running animation of the same register */
+          slot = i;
+          break;
+        }
+        else
+        {
+          /* Slot used by another animation */
+        }
+      }
+
+      if(slot == BSP_LCD_ANIM_NBR)
+      {
+        slot = free_slot;
+      }
+
+      if(slot == BSP_LCD_ANIM_NBR)
+      {
+        ret = BSP_ERROR_BUSY;
+      }
+      else
+      {
+        Lcd_Anim.Slots[slot].Anim  = *Anim;
+        Lcd_Anim.Slots[slot].Step  = step;
+        Lcd_Anim.Slots[slot].Frame = 0U;
+        Lcd_Anim.Slots[slot].State = LCD_ANIM_RUNNING;
+        *Id = slot;
+
+        if(Lcd_Anim.Pending == 0U)
+        {
+          /* No reload requested by the running animations, stage the first frame */
+          LCD_AnimStep(Instance);
+        }
+      }
+
+      __set_PRIMASK(primask);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Stops an animation, the layer keeps its last staged value.
+  *         BSP_LCD_AnimCallback() is not called.
+  * @param  Instance    LCD Instance
+  * @param  Id          Identifier returned by BSP_LCD_AnimStart()
+  * @retval BSP status
+  */
+int32_t BSP_LCD_AnimStop(uint32_t Instance, uint32_t Id)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Id >= BSP_LCD_ANIM_NBR))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Lcd_Anim.Slots[Id].State = LCD_ANIM_FREE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Waits for the end of all the running animations.
+  * @param  Instance    LCD Instance
+  * @param  Timeout     Timeout in ms, 0 only checks the animations
+  * @retval BSP status, BSP_ERROR_BUSY if an animation is still running
+  */
+int32_t BSP_LCD_AnimWait(uint32_t Instance, uint32_t Timeout)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t tickstart;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    tickstart = HAL_GetTick();
+
+    while(Lcd_Anim.Pending != 0U)
+    {
+      if((HAL_GetTick() - tickstart) >= Timeout)
+      {
+        ret = BSP_ERROR_BUSY;
+        break;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Animation end callback, called from the LTDC interrupt once the
+  *         To value of the animation is shown.
+  * @param  Instance    LCD Instance
+  * @param  Id          Identifier returned by BSP_LCD_AnimStart()
+  * @retval None
+  */
+__weak void BSP_LCD_AnimCallback(uint32_t Instance, uint32_t Id)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  UNUSED(Id);
+
+  /* This function should be implemented by the user application.
+     It is called from the LTDC interrupt, BSP_LCD_AnimStart() can be
+     used to chain another animation. */
+}
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+
+#if (USE_BSP_LCD_ROTATION == 1)
+/**
+  * @brief  Sets the rotation of the drawn layer 0 image on the panel. The draw
+  *         functions write to the LCD_ROTATION_ADDRESS buffer of the rotated
+  *         size, copied to the scanned out buffer by BSP_LCD_RotationFlush().
+  * @param  Instance    LCD Instance
+  * @param  Rotation    LCD_ROTATION_0 to draw to the scanned out buffer,
+  *                     LCD_ROTATION_90, LCD_ROTATION_180 or LCD_ROTATION_270
+  * @retval BSP status
+  */
+int32_t BSP_LCD_SetRotation(uint32_t Instance, uint32_t Rotation)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  LCD_Rotation_t *rot;
+  uint32_t width  = hlcd_ltdc.LayerCfg[0].ImageWidth;
+  uint32_t height = hlcd_ltdc.LayerCfg[0].ImageHeight;
+  uint32_t i;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Rotation > LCD_ROTATION_270) ||
+     (width > LCD_ROT_MAX_SIZE) || (height > LCD_ROT_MAX_SIZE))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_LCD_CLUT == 1)
+  else if((Rotation != LCD_ROTATION_0) && (LCD_ClutSize(hlcd_ltdc.LayerCfg[0].PixelFormat) != 0U))
+  {
+    /* The tiles are rotated by words of 16 or 32 bits */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+#endif /* USE_BSP_LCD_CLUT == 1 */
+  else if(BSP_LCD_DMA2D_Sync(Instance) != BSP_ERROR_NONE)
+  {
+    /* Queued jobs write to the previous buffer */
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    rot = &Lcd_Rotation[Instance];
+    rot->Rotation  = Rotation;
+    rot->BppFactor = (hlcd_ltdc.LayerCfg[0].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) ? 2U : 4U;
+
+    if((Rotation == LCD_ROTATION_90) || (Rotation == LCD_ROTATION_270))
+    {
+      rot->XSize = height;
+      rot->YSize = width;
+    }
+    else
+    {
+      rot->XSize = width;
+      rot->YSize = height;
+    }
+    rot->TilesX = (rot->XSize + BSP_LCD_ROTATION_TILE - 1U) / BSP_LCD_ROTATION_TILE;
+    rot->TilesY = (rot->YSize + BSP_LCD_ROTATION_TILE - 1U) / BSP_LCD_ROTATION_TILE;
+
+    for(i = 0U; i < LCD_ROT_DIRTY_WORDS; i++)
+    {
+      rot->Dirty[i] = 0U;
+    }
+
+    if(Rotation != LCD_ROTATION_0)
+    {
+      /* The whole drawn buffer is shown by the next flush */
+      LCD_RotationMark(Instance, 0U, 0U, rot->XSize, rot->YSize);
+
+      /* Enable the DWT cycle counter used to time the flushes */
+      BSP_EnableCycleCounter();
+    }
+
+    /* The draw functions use the size of the drawn buffer */
+#if (USE_BSP_LCD_OVERLAY == 1)
+    Lcd_Layers[Instance][0].XSize = rot->XSize;
+    Lcd_Layers[Instance][0].YSize = rot->YSize;
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+    if(Lcd_Ctx[Instance].ActiveLayer == 0U)
+    {
+      Lcd_Ctx[Instance].XSize = rot->XSize;
+      Lcd_Ctx[Instance].YSize = rot->YSize;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Marks an area written by the CPU to the drawn buffer, to be copied
+  *         to the panel by the next BSP_LCD_RotationFlush(). The areas drawn by
+  *         the BSP draw functions are marked by them.
+  * @param  Instance    LCD Instance
+  * @param  Xpos        X position, in drawn buffer coordinates
+  * @param  Ypos        Y position, in drawn buffer coordinates
+  * @param  Width       Area width
+  * @param  Height      Area height
+  * @retval BSP status
+  */
+int32_t BSP_LCD_RotationInvalidate(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    LCD_RotationDrawn(Instance, Xpos, Ypos, Width, Height);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Rotates the tiles drawn since the previous flush to the scanned out
+  *         buffer. Waits for the queued DMA2D jobs first.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_RotationFlush(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  LCD_Rotation_t *rot;
+  uint32_t word, bit, tile, x, y, width, height, start;
+  uint32_t words, tiles = 0U, pixels = 0U;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Lcd_Rotation[Instance].Rotation == LCD_ROTATION_0)
+  {
+    /* Drawing to the scanned out buffer */
+  }
+  else if(BSP_LCD_DMA2D_Sync(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    rot   = &Lcd_Rotation[Instance];
+    words = ((rot->TilesX * rot->TilesY) + 31U) / 32U;
+    start = DWT->CYCCNT;
+
+    for(word = 0U; word < words; word++)
+    {
+      while(rot->Dirty[word] != 0U)
+      {
+        /* Lowest dirty tile first: tiles are copied line of tiles by line of tiles */
+        bit = __CLZ(__RBIT(rot->Dirty[word]));
+        rot->Dirty[word] &= ~(1UL << bit);
+
+        tile   = (word * 32U) + bit;
+        x      = (tile % rot->TilesX) * BSP_LCD_ROTATION_TILE;
+        y      = (tile / rot->TilesX) * BSP_LCD_ROTATION_TILE;
+        width  = ((x + BSP_LCD_ROTATION_TILE) > rot->XSize) ? (rot->XSize - x) : BSP_LCD_ROTATION_TILE;
+        height = ((y + BSP_LCD_ROTATION_TILE) > rot->YSize) ? (rot->YSize - y) : BSP_LCD_ROTATION_TILE;
+
+        LCD_RotationCopy(Instance, x, y, width, height);
+        tiles++;
+        pixels += width * height;
+      }
+    }
+
+    rot->Stats.Cycles += DWT->CYCCNT - start;
+    rot->Stats.Flushes++;
+    rot->Stats.Tiles  += tiles;
+    rot->Stats.Pixels += pixels;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the software rotation counters.
+  * @param  Instance    LCD Instance
+  * @param  Stats       Pointer to the counters to fill
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetRotationStats(uint32_t Instance, BSP_LCD_Rotation_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *Stats = Lcd_Rotation[Instance].Stats;
+
+    /* DWT counts core clock cycles */
+    if(Stats->Cycles != 0U)
+    {
+      Stats->PixelsPerSec = (uint32_t)((Stats->Pixels * (uint64_t)SystemCoreClock) / Stats->Cycles);
+    }
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+/**
+  * @brief  Handles the keep-alive timer interrupt. Queues a read of the RASPBERRYPI
+  *         panel MCU if it was not accessed for BSP_LCD_KEEPALIVE_PERIOD, else waits
+  *         until that period has elapsed since its last access.
+  * @param  Instance    LCD Instance
+  * @retval None
+  */
+void BSP_LCD_KeepAlive_IRQHandler(uint32_t Instance)
+{
+  uint32_t idle;
+
+  if((Instance < LCD_INSTANCES_NBR) && ((BSP_LCD_KEEPALIVE_TIM->SR & TIM_SR_UIF) != 0U))
+  {
+    BSP_LCD_KEEPALIVE_TIM->SR = ~(uint32_t)TIM_SR_UIF;
+
+    idle = HAL_GetTick() - Lcd_KeepAliveLast;
+    if(idle < BSP_LCD_KEEPALIVE_PERIOD)
+    {
+      Lcd_KeepAliveStats.Deferred++;
+      LCD_KeepAliveArm(BSP_LCD_KEEPALIVE_PERIOD - idle);
+    }
+    else
+    {
+      /* A read still queued behind other transfers will do */
+      if(Lcd_KeepAliveXfer.Status != BSP_ERROR_BUSY)
+      {
+        Lcd_KeepAliveXfer.Device     = BSP_I2C4_DEV_PANEL;
+        Lcd_KeepAliveXfer.DevAddr    = (uint16_t)(RASPBERRYPI_I2C_ADDR << 1);
+        Lcd_KeepAliveXfer.Reg        = RASPBERRYPI_REG_PWM;
+        Lcd_KeepAliveXfer.MemAddSize = I2C_MEMADD_SIZE_8BIT;
+        Lcd_KeepAliveXfer.Length     = 1U;
+        Lcd_KeepAliveXfer.pData      = &Lcd_KeepAliveData;
+        Lcd_KeepAliveXfer.Read       = 1U;
+        Lcd_KeepAliveXfer.Callback   = LCD_KeepAliveDone;
+        Lcd_KeepAliveXfer.pArg       = NULL;
+
+        if(BSP_I2C4_Submit(&Lcd_KeepAliveXfer) == BSP_ERROR_NONE)
+        {
+          Lcd_KeepAliveStats.Sent++;
+        }
+        else
+        {
+          Lcd_KeepAliveStats.Errors++;
+        }
+      }
+      LCD_KeepAliveArm(BSP_LCD_KEEPALIVE_PERIOD);
+    }
+  }
+}
+
+/**
+  * @brief  Gets the counters of the RASPBERRYPI panel keep-alive since the
+  *         panel initialization.
+  * @param  Instance    LCD Instance
+  * @param  Stats       Pointer to the counters to fill
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetKeepAliveStats(uint32_t Instance, BSP_LCD_KeepAlive_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *Stats = Lcd_KeepAliveStats;
+    __set_PRIMASK(primask);
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+/**
+  * @brief  Marks an area of the scanned out frame buffer to be sent to a panel
+  *         driven in command mode. Areas are merged into BSP_LCD_CMD_DIRTY_NBR
+  *         column and page windows. Does nothing in video mode, where the frame
+  *         buffer is sent every frame.
+  * @param  Instance    LCD Instance
+  * @param  Xpos        X position, in panel coordinates
+  * @param  Ypos        Y position, in panel coordinates
+  * @param  Width       Area width
+  * @param  Height      Area height
+  * @retval BSP status
+  */
+int32_t BSP_LCD_Invalidate(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  LCD_DirtyRect_t rect, merged;
+  LCD_DirtyRect_t *pdirty;
+  uint32_t i, best = 0U, area, best_area = 0xFFFFFFFFU;
+  uint32_t primask;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Xpos >= hlcd_ltdc.LayerCfg[0].ImageWidth) || (Ypos >= hlcd_ltdc.LayerCfg[0].ImageHeight))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if((Lcd_CmdMode.Active != 0U) && (Width != 0U) && (Height != 0U))
+  {
+#if (USE_BSP_LCD_ULPM == 1)
+    (void)BSP_LCD_Wake(Instance);
+#endif /* USE_BSP_LCD_ULPM == 1 */
+    rect.X0    = Xpos;
+    rect.Y0    = Ypos;
+    rect.X1    = ((Xpos + Width) > hlcd_ltdc.LayerCfg[0].ImageWidth) ? (hlcd_ltdc.LayerCfg[0].ImageWidth - 1U) : (Xpos + Width - 1U);
+    rect.Y1    = ((Ypos + Height) > hlcd_ltdc.LayerCfg[0].ImageHeight) ? (hlcd_ltdc.LayerCfg[0].ImageHeight - 1U) : (Ypos + Height - 1U);
+    rect.Fence = Lcd_Dma2dQueue.Head;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Merge with the window whose bounding box grows least, overlapping ones first */
+    for(i = 0U; i < Lcd_CmdMode.DirtyNbr; i++)
+    {
+      pdirty = &Lcd_CmdMode.Dirty[i];
+      merged.X0 = (pdirty->X0 < rect.X0) ? pdirty->X0 : rect.X0;
+      merged.Y0 = (pdirty->Y0 < rect.Y0) ? pdirty->Y0 : rect.Y0;
+      merged.X1 = (pdirty->X1 > rect.X1) ? pdirty->X1 : rect.X1;
+      merged.Y1 = (pdirty->Y1 > rect.Y1) ? pdirty->Y1 : rect.Y1;
+      area = ((merged.X1 - merged.X0 + 1U) * (merged.Y1 - merged.Y0 + 1U)) -
+             ((pdirty->X1 - pdirty->X0 + 1U) * (pdirty->Y1 - pdirty->Y0 + 1U));
+      if((rect.X0 <= pdirty->X1) && (pdirty->X0 <= rect.X1) && (rect.Y0 <= pdirty->Y1) && (pdirty->Y0 <= rect.Y1))
+      {
+        area = 0U;
+      }
+      if(area < best_area)
+      {
+        best_area = area;
+        best = i;
+      }
+    }
+
+    if((best_area == 0U) || (Lcd_CmdMode.DirtyNbr == BSP_LCD_CMD_DIRTY_NBR))
+    {
+      pdirty = &Lcd_CmdMode.Dirty[best];
+      pdirty->X0    = (pdirty->X0 < rect.X0) ? pdirty->X0 : rect.X0;
+      pdirty->Y0    = (pdirty->Y0 < rect.Y0) ? pdirty->Y0 : rect.Y0;
+      pdirty->X1    = (pdirty->X1 > rect.X1) ? pdirty->X1 : rect.X1;
+      pdirty->Y1    = (pdirty->Y1 > rect.Y1) ? pdirty->Y1 : rect.Y1;
+      pdirty->Fence = rect.Fence;
+    }
+    else
+    {
+      Lcd_CmdMode.Dirty[Lcd_CmdMode.DirtyNbr] = rect;
+      Lcd_CmdMode.DirtyNbr++;
+    }
+
+    __set_PRIMASK(primask);
+  }
+  else
+  {
+    /* Video mode or empty area */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the command mode counters since the panel initialization.
+  * @param  Instance    LCD Instance
+  * @param  Stats       Pointer to the counters to fill
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetCmdModeStats(uint32_t Instance, BSP_LCD_CmdMode_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Lcd_CmdMode.Active == 0U)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *Stats = Lcd_CmdMode.Stats;
+    __set_PRIMASK(primask);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Handles DSI interrupt request.
+  * @param  Instance    LCD Instance
+  * @retval None
+  */
+void BSP_LCD_DSI_IRQHandler(uint32_t Instance)
+{
+  if(Instance < LCD_INSTANCES_NBR)
+  {
+    HAL_DSI_IRQHandler(&hlcd_dsi);
+  }
+}
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+#if (USE_BSP_LCD_ULPM == 1)
+/**
+  * @brief  Puts the DSI link in ultra low power mode once the display has been
+  *         idle for BSP_LCD_ULPM_TIMEOUT ms. Completes the wakes requested from
+  *         an interrupt. To be called from the application idle loop.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_Idle(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Lcd_UlpmWakeRequest != 0U)
+  {
+    ret = BSP_LCD_Wake(Instance);
+  }
+  else if((Lcd_UlpmAsleep == 0U) && ((HAL_GetTick() - Lcd_UlpmLast) >= BSP_LCD_ULPM_TIMEOUT))
+  {
+    /* No TE refresh may start while the lanes are switched. A wake requested
+       by another interrupt during the entry is recorded by BSP_LCD_Wake() */
+    HAL_NVIC_DisableIRQ(DSI_IRQn);
+    Lcd_UlpmEntering = 1U;
+
+    if((LCD_UlpmLinkIdle() == 0U) || (Lcd_UlpmWakeRequest != 0U))
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+    else if(HAL_DSI_EnterULPM(&hlcd_dsi) != HAL_OK)
+    {
+      Lcd_UlpmStats.Errors++;
+      Lcd_UlpmLast = HAL_GetTick();
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      Lcd_UlpmAsleep = 1U;
+      Lcd_UlpmSleepStart = HAL_GetTick();
+      Lcd_UlpmStats.Entries++;
+    }
+
+    /* Wake at once if the display was drawn during the entry */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Lcd_UlpmEntering = 0U;
+    if(Lcd_UlpmAsleep == 0U)
+    {
+      Lcd_UlpmWakeRequest = 0U;
+    }
+    else if((LCD_UlpmLinkIdle() == 0U) && (Lcd_UlpmWakeRequest == 0U))
+    {
+      /* Area queued without a wake */
+      Lcd_UlpmWakeStart = DWT->CYCCNT;
+      Lcd_UlpmWakeRequest = 1U;
+    }
+    else
+    {
+      /* Asleep, woken below if requested */
+    }
+    __set_PRIMASK(primask);
+
+    HAL_NVIC_EnableIRQ(DSI_IRQn);
+
+    if(Lcd_UlpmWakeRequest != 0U)
+    {
+      ret = BSP_LCD_Wake(Instance);
+    }
+  }
+  else
+  {
+    /* Link in use, or already in ULPM */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Records a display activity and takes the DSI link out of ultra low
+  *         power mode if needed.
+  * @note   From an interrupt handler the ULPM exit, which waits on the HAL tick,
+  *         is not done: the wake is recorded, BSP_ERROR_BUSY is returned and the
+  *         link stays in ULPM until the next BSP_LCD_Idle() call from the
+  *         application idle loop. A wake interrupting the ULPM entry is
+  *         recorded the same way, and completed by BSP_LCD_Idle() at the end
+  *         of the entry.
+  * @param  Instance    LCD Instance
+  * @retval BSP status, BSP_ERROR_BUSY when the wake is deferred
+  */
+int32_t BSP_LCD_Wake(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t latency;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    Lcd_UlpmLast = HAL_GetTick();
+
+    if((Lcd_UlpmAsleep == 0U) && (Lcd_UlpmEntering == 0U))
+    {
+      /* Nothing to wake */
+    }
+    else if(__get_IPSR() != 0U)
+    {
+      if(Lcd_UlpmWakeRequest == 0U)
+      {
+        Lcd_UlpmWakeStart = DWT->CYCCNT;
+        Lcd_UlpmWakeRequest = 1U;
+      }
+      ret = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      if(Lcd_UlpmWakeRequest == 0U)
+      {
+        Lcd_UlpmWakeStart = DWT->CYCCNT;
+      }
+
+      HAL_NVIC_DisableIRQ(DSI_IRQn);
+
+      if(HAL_DSI_ExitULPM(&hlcd_dsi) != HAL_OK)
+      {
+        Lcd_UlpmStats.Errors++;
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        latency = (DWT->CYCCNT - Lcd_UlpmWakeStart) / (SystemCoreClock / 1000000U);
+        Lcd_UlpmAsleep = 0U;
+        Lcd_UlpmWakeRequest = 0U;
+        Lcd_UlpmStats.Exits++;
+        Lcd_UlpmStats.SleepTime += HAL_GetTick() - Lcd_UlpmSleepStart;
+        Lcd_UlpmStats.LastWake = latency;
+        if(latency > Lcd_UlpmStats.MaxWake)
+        {
+          Lcd_UlpmStats.MaxWake = latency;
+        }
+        if(latency > BSP_LCD_ULPM_WAKE_BUDGET)
+        {
+          Lcd_UlpmStats.Overruns++;
+        }
+      }
+
+      HAL_NVIC_EnableIRQ(DSI_IRQn);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the ultra low power mode counters since the panel initialization.
+  * @param  Instance    LCD Instance
+  * @param  Stats       Pointer to the counters to fill
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetUlpmStats(uint32_t Instance, BSP_LCD_Ulpm_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *Stats = Lcd_UlpmStats;
+    if(Lcd_UlpmAsleep != 0U)
+    {
+      Stats->SleepTime += HAL_GetTick() - Lcd_UlpmSleepStart;
+    }
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_ULPM == 1 */
+
+/**
+  * @brief  Gets the line being scanned out by the LTDC.
+  * @param  Instance    LCD Instance
+  * @param  Line        Line of the active area, LCD height during the blanking
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetScanline(uint32_t Instance, uint32_t *Line)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t line;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Line == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    line = (hlcd_ltdc.Instance->CPSR & LTDC_CPSR_CYPOS);
+
+    if((line <= hlcd_ltdc.Init.AccumulatedVBP) || (line > hlcd_ltdc.Init.AccumulatedActiveH))
+    {
+      *Line = Lcd_Ctx[Instance].YSize;
+    }
+    else
+    {
+      *Line = line - hlcd_ltdc.Init.AccumulatedVBP - 1U;
+    }
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+/**
+  * @brief  Starts holding the DMA2D fills until the LTDC scanned past their band.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_BeamStart(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+    if(HAL_LTDC_RegisterCallback(&hlcd_ltdc, HAL_LTDC_LINE_EVENT_CB_ID, LTDC_LineEventCallback) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 1) */
+
+    if(ret == BSP_ERROR_NONE)
+    {
+      Lcd_Beam[Instance].NextBand = LCD_GetScanBand(Instance);
+      Lcd_Beam[Instance].Running  = 1U;
+
+      if(HAL_LTDC_ProgramLineEvent(&hlcd_ltdc, LCD_BeamBandEndLine(Instance, Lcd_Beam[Instance].NextBand)) != HAL_OK)
+      {
+        Lcd_Beam[Instance].Running = 0U;
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Stops holding the DMA2D fills, the held ones are released.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_BeamStop(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t band, primask;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    Lcd_Beam[Instance].Running = 0U;
+    __HAL_LTDC_DISABLE_IT(&hlcd_ltdc, LTDC_IT_LI);
+
+    for(band = 0; band < BSP_LCD_BEAM_BANDS_NBR; band++)
+    {
+      LCD_BeamRelease(Instance, band);
+    }
+
+    __set_PRIMASK(primask);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Queues a DMA2D job writing to a displayed frame buffer. The job is
+  *         split by band, each part being held until the LTDC scanned past
+  *         its band. Other jobs, or all jobs when beam racing is stopped, go to
+  *         the DMA2D queue directly.
+  * @param  Instance    LCD Instance
+  * @param  Job         Pointer to the job, copied
+  * @retval BSP status
+  */
+int32_t BSP_LCD_BeamSubmit(uint32_t Instance, const BSP_LCD_DMA2D_Job_t *Job)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  BSP_LCD_DMA2D_Job_t part;
+  uint32_t row, band, line = 0U, lines, split, tickstart;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Job == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if((Lcd_Beam[Instance].Running == 0U) || (LCD_BeamGetJobRow(Instance, Job, &row) != BSP_ERROR_NONE))
+  {
+    ret = BSP_LCD_DMA2D_Submit(Instance, Job, NULL);
+  }
+  else
+  {
+    tickstart = HAL_GetTick();
+    split = (LCD_BeamGetJobPart(Job, 0U, Job->Height, &part) == BSP_ERROR_NONE) ? 1U : 0U;
+
+    while((line < Job->Height) && (ret == BSP_ERROR_NONE))
+    {
+      if(split == 1U)
+      {
+        /* Lines of the job in the band of its first remaining line */
+        band  = LCD_GetBand(Instance, row + line);
+        lines = Job->Height - line;
+        if((band < (BSP_LCD_BEAM_BANDS_NBR - 1U)) && ((LCD_GetBandEnd(Instance, band) - (row + line)) < lines))
+        {
+          lines = LCD_GetBandEnd(Instance, band) - (row + line);
+        }
+        (void)LCD_BeamGetJobPart(Job, line, lines, &part);
+      }
+      else
+      {
+        /* Input lines not starting on a byte, held until the LTDC scanned past
+           the last line of the job */
+        band  = LCD_GetBand(Instance, row + Job->Height - 1U);
+        lines = Job->Height;
+        part  = *Job;
+      }
+
+      ret = LCD_BeamHold(Instance, band, &part, tickstart);
+      line += lines;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Waits for the release of the held jobs and for their completion.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_BeamSync(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t band, tickstart;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    tickstart = HAL_GetTick();
+
+    for(band = 0; (band < BSP_LCD_BEAM_BANDS_NBR) && (ret == BSP_ERROR_NONE); band++)
+    {
+      while(Lcd_Beam[Instance].Tail[band] != Lcd_Beam[Instance].Head[band])
+      {
+        LCD_BeamPoll(Instance);
+
+        if((HAL_GetTick() - tickstart) > BSP_LCD_DMA2D_TIMEOUT)
+        {
+          ret = BSP_ERROR_BUSY;
+          break;
+        }
+      }
+    }
+
+    if(ret == BSP_ERROR_NONE)
+    {
+      ret = BSP_LCD_DMA2D_Sync(Instance);
+    }
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+
+/**
+  * @brief  Queues a DMA2D job. The job is started from the DMA2D interrupt once
+  *         the previous jobs are completed. When the queue is full, waits for
+  *         the oldest job to complete.
+  * @param  Instance    LCD Instance
+  * @param  Job         Pointer to the job, copied in the queue
+  * @param  Fence       Pointer to the job fence, may be NULL
+  * @retval BSP status
+  */
+int32_t BSP_LCD_DMA2D_Submit(uint32_t Instance, const BSP_LCD_DMA2D_Job_t *Job, BSP_LCD_Fence_t *Fence)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t primask;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Job == NULL) ||
+     ((Job->pCLUT != NULL) && ((Job->CLUTSize == 0U) || (Job->CLUTSize > 256U))))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if((Lcd_Dma2dQueue.Head - Lcd_Dma2dQueue.Tail) >= BSP_LCD_DMA2D_QUEUE_SIZE)
+  {
+    /* Free the oldest slot */
+    ret = BSP_LCD_DMA2D_WaitFence(Instance, Lcd_Dma2dQueue.Head - LCD_DMA2D_QUEUE_MASK, BSP_LCD_DMA2D_TIMEOUT);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    Lcd_Dma2dQueue.Jobs[Lcd_Dma2dQueue.Head & LCD_DMA2D_QUEUE_MASK] = *Job;
+    Lcd_Dma2dQueue.Head++;
+
+    if(Fence != NULL)
+    {
+      *Fence = Lcd_Dma2dQueue.Head;
+    }
+
+    if(Lcd_Dma2dQueue.Busy == 0U)
+    {
+      /* DMA2D idle, the new job is the only pending one */
+      if(LCD_DMA2D_StartJob(&Lcd_Dma2dQueue.Jobs[Lcd_Dma2dQueue.Tail & LCD_DMA2D_QUEUE_MASK]) != BSP_ERROR_NONE)
+      {
+        LCD_DMA2D_JobDone(1U);
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+
+    __set_PRIMASK(primask);
+  }
+  else if(Fence != NULL)
+  {
+    /* Job not queued, return an already signaled fence */
+    *Fence = Lcd_Dma2dQueue.Tail;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Waits for the completion of a DMA2D job.
+  *         When called with interrupts masked or from an interrupt handler, the
+  *         DMA2D interrupt is serviced here so that the queue keeps moving.
+  * @param  Instance    LCD Instance
+  * @param  Fence       Fence returned by BSP_LCD_DMA2D_Submit()
+  * @param  Timeout     Timeout in ms, 0 only checks the fence
+  * @note   The timeout is measured with the DWT cycle counter: the HAL tick does
+  *         not move with the interrupts masked or from a higher priority handler.
+  * @retval BSP status, BSP_ERROR_BUSY if the job is still pending
+  */
+int32_t BSP_LCD_DMA2D_WaitFence(uint32_t Instance, BSP_LCD_Fence_t Fence, uint32_t Timeout)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t start, primask;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    BSP_EnableCycleCounter();
+    start = DWT->CYCCNT;
+
+    while(!LCD_DMA2D_FENCE_DONE(Fence))
+    {
+      if((__get_PRIMASK() != 0U) || (__get_IPSR() != 0U))
+      {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        BSP_LCD_DMA2D_IRQHandler(Instance);
+        __set_PRIMASK(primask);
+      }
+
+      if(((DWT->CYCCNT - start) / (SystemCoreClock / 1000U)) >= Timeout)
+      {
+        ret = BSP_ERROR_BUSY;
+        break;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Waits for the completion of all the queued DMA2D jobs.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_DMA2D_Sync(uint32_t Instance)
+{
+  int32_t ret;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if(Lcd_Dma2dQueue.Errors != 0U)
+  {
+    /* Report the errors once, the queue is drained anyway */
+    Lcd_Dma2dQueue.Errors = 0U;
+    (void)BSP_LCD_DMA2D_WaitFence(Instance, Lcd_Dma2dQueue.Head, BSP_LCD_DMA2D_TIMEOUT);
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    ret = BSP_LCD_DMA2D_WaitFence(Instance, Lcd_Dma2dQueue.Head, BSP_LCD_DMA2D_TIMEOUT);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  This function handles the DMA2D interrupt request.
+  * @param  Instance    LCD Instance
+  * @retval None
+  */
+void BSP_LCD_DMA2D_IRQHandler(uint32_t Instance)
+{
+  if(Instance < LCD_INSTANCES_NBR)
+  {
+    HAL_DMA2D_IRQHandler(&hlcd_dma2d);
+  }
+}
+
+#if (USE_BSP_LCD_STATS == 1)
+/**
+  * @brief  Clears the draw statistics and starts the DWT cycle counter.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+int32_t BSP_LCD_ResetStats(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t i;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Enable the DWT cycle counter used to time the primitives */
+    BSP_EnableCycleCounter();
+
+    for(i = 0; i < (uint32_t)BSP_LCD_STATS_NBR; i++)
+    {
+      Lcd_Stats[Instance][i].Calls        = 0U;
+      Lcd_Stats[Instance][i].Pixels       = 0U;
+      Lcd_Stats[Instance][i].Cycles       = 0U;
+      Lcd_Stats[Instance][i].PixelsPerSec = 0U;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the draw statistics of a primitive.
+  * @param  Instance    LCD Instance
+  * @param  Primitive   Primitive identifier, one of BSP_LCD_StatsId_t
+  * @param  Stats       Pointer to the statistics to fill
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetStats(uint32_t Instance, BSP_LCD_StatsId_t Primitive, BSP_LCD_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Primitive >= BSP_LCD_STATS_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *Stats = Lcd_Stats[Instance][Primitive];
+
+    /* DWT counts core clock cycles */
+    if(Stats->Cycles != 0U)
+    {
+      Stats->PixelsPerSec = (uint32_t)((Stats->Pixels * (uint64_t)SystemCoreClock) / Stats->Cycles);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the DSI write statistics of the last BSP_LCD_InitEx() call.
+  * @param  Instance    LCD Instance
+  * @param  Stats       Pointer to the statistics to fill
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetDsiStats(uint32_t Instance, BSP_LCD_DSI_Stats_t *Stats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if((Instance >= LCD_INSTANCES_NBR) || (Stats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *Stats = Lcd_DsiStats[Instance];
+
+    /* DWT counts core clock cycles */
+    Stats->Time = (uint32_t)(((uint64_t)Stats->Cycles * 1000000U) / SystemCoreClock);
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_STATS == 1 */
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32H747I_DISCO_LCD_Private_Functions Private Functions
+  * @{
+  */
+/**
+  * @brief  Fills a buffer.
+  * @param  Instance LCD Instance
+  * @param  pDst Pointer to destination buffer
+  * @param  xSize Buffer width
+  * @param  ySize Buffer height
+  * @param  OffLine Offset
+  * @param  Color Color index
+  */
+static void LL_FillBuffer(uint32_t Instance, uint32_t *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color)
+{
+  uint32_t output_color_mode, input_color = Color;
+  uint32_t width = xSize, offline = OffLine, raw, pack;
+  BSP_LCD_DMA2D_Job_t job = {0};
+
+  if(LCD_GetOutputColorMode(Lcd_Ctx[Instance].PixelFormat, &output_color_mode) != BSP_ERROR_NONE)
+  {
+    raw  = LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, Color);
+    pack = 4U / Lcd_Ctx[Instance].BppFactor;
+
+    if((((uint32_t)pDst % 4U) == 0U) && ((xSize % pack) == 0U) && ((OffLine % pack) == 0U))
+    {
+      /* CLUT formats: the DMA2D fills ARGB8888 words holding pack pixels */
+      output_color_mode = DMA2D_OUTPUT_ARGB8888;
+      input_color = raw * ((pack == 4U) ? 0x01010101U : 0x00010001U);
+      width   = xSize / pack;
+      offline = OffLine / pack;
+    }
+    else
+    {
+      /* CLUT formats, unaligned area: filled by the CPU, after the queued jobs */
+      (void)BSP_LCD_DMA2D_Sync(Instance);
+      LCD_CpuFill(Lcd_Ctx[Instance].BppFactor, (uint32_t)pDst, xSize, ySize, OffLine, raw);
+      width = 0U;
+    }
+  }
+  else if(Lcd_Ctx[Instance].PixelFormat == LCD_PIXEL_FORMAT_RGB565)
+  {
+    input_color = CONVERTRGB5652ARGB8888(Color);
+  }
+  else
+  {
+    /* ARGB8888 color */
+  }
+
+  if(width != 0U)
+  {
+    /* Register to memory mode, the DMA2D converts the ARGB8888 color */
+    job.Init.Mode         = DMA2D_R2M;
+    job.Init.ColorMode    = output_color_mode;
+    job.Init.OutputOffset = offline;
+
+    job.Source      = input_color;
+    job.Destination = (uint32_t)pDst;
+    job.Width       = width;
+    job.Height      = ySize;
+
+    /* The color is held in the job, no need to wait for the transfer */
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+    if(Lcd_Ctx[Instance].ActiveLayer == 0U)
+    {
+      (void)BSP_LCD_BeamSubmit(Instance, &job);
+    }
+    else
+    {
+      /* The bands are layer 0 lines */
+      (void)BSP_LCD_DMA2D_Submit(Instance, &job, NULL);
+    }
+#else
+    (void)BSP_LCD_DMA2D_Submit(Instance, &job, NULL);
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+  }
+}
+
+/**
+  * @brief  Converts a line to an RGB pixel format.
+  * @param  Instance LCD Instance
+  * @param  pSrc Pointer to source buffer
+  * @param  pDst Output color
+  * @param  xSize Buffer width
+  * @param  ColorMode Input color mode
+  * @retval Fence of the conversion job
+  */
+static BSP_LCD_Fence_t LL_ConvertLineToRGB(uint32_t Instance, uint32_t *pSrc, uint32_t *pDst, uint32_t xSize, uint32_t ColorMode)
+{
+  uint32_t output_color_mode, i, color;
+  uint8_t *psrc = (uint8_t *)pSrc;
+  uint32_t address = (uint32_t)pDst;
+  BSP_LCD_DMA2D_Job_t job = {0};
+  BSP_LCD_Fence_t fence;
+
+  if(LCD_GetOutputColorMode(Lcd_Ctx[Instance].PixelFormat, &output_color_mode) != BSP_ERROR_NONE)
+  {
+    /* CLUT formats: converted by the CPU, after the queued jobs */
+    (void)BSP_LCD_DMA2D_Sync(Instance);
+
+    for(i = 0U; i < xSize; i++)
+    {
+      if(ColorMode == DMA2D_INPUT_ARGB8888)
+      {
+        color = (uint32_t)psrc[0] | ((uint32_t)psrc[1] << 8) | ((uint32_t)psrc[2] << 16) | ((uint32_t)psrc[3] << 24);
+        psrc += 4;
+      }
+      else if(ColorMode == DMA2D_INPUT_RGB565)
+      {
+        color = 0xFF000000U | CONVERTRGB5652ARGB8888((uint32_t)psrc[0] | ((uint32_t)psrc[1] << 8));
+        psrc += 2;
+      }
+      else
+      {
+        color = 0xFF000000U | (uint32_t)psrc[0] | ((uint32_t)psrc[1] << 8) | ((uint32_t)psrc[2] << 16);
+        psrc += 3;
+      }
+
+      if(Lcd_Ctx[Instance].BppFactor == 1U)
+      {
+        *(__IO uint8_t *)address = (uint8_t)LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, color);
+      }
+      else
+      {
+        *(__IO uint16_t *)address = (uint16_t)LCD_ColorToRaw(Lcd_Ctx[Instance].PixelFormat, color);
+      }
+      address += Lcd_Ctx[Instance].BppFactor;
+    }
+
+    /* Nothing left in the queue */
+    fence = Lcd_Dma2dQueue.Head;
+  }
+  else
+  {
+    /* Configure the DMA2D Mode, Color Mode and output offset */
+    job.Init.Mode         = DMA2D_M2M_PFC;
+    job.Init.ColorMode    = output_color_mode;
+    job.Init.OutputOffset = 0;
+
+    /* Foreground Configuration */
+    job.Foreground.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    job.Foreground.InputAlpha = 0xFF;
+    job.Foreground.InputColorMode = ColorMode;
+    job.Foreground.InputOffset = 0;
+
+    job.Source      = (uint32_t)pSrc;
+    job.Destination = (uint32_t)pDst;
+    job.Width       = xSize;
+    job.Height      = 1;
+
+    (void)BSP_LCD_DMA2D_Submit(Instance, &job, &fence);
+  }
+
+  return fence;
+}
+
+/**
+  * @brief  Gets the DMA2D output color mode of a layer pixel format.
+  * @param  PixelFormat LCD pixel format
+  * @param  ColorMode   DMA2D output color mode
+  * @retval BSP_ERROR_FEATURE_NOT_SUPPORTED for the L8, AL44 and AL88 formats,
+  *         which the DMA2D cannot write
+  */
+static int32_t LCD_GetOutputColorMode(uint32_t PixelFormat, uint32_t *ColorMode)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_RGB565:
+    *ColorMode = DMA2D_OUTPUT_RGB565;
+    break;
+  case LCD_PIXEL_FORMAT_ARGB1555:
+    *ColorMode = DMA2D_OUTPUT_ARGB1555;
+    break;
+  case LCD_PIXEL_FORMAT_ARGB4444:
+    *ColorMode = DMA2D_OUTPUT_ARGB4444;
+    break;
+  case LCD_PIXEL_FORMAT_L8:
+  case LCD_PIXEL_FORMAT_AL44:
+  case LCD_PIXEL_FORMAT_AL88:
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+    break;
+  case LCD_PIXEL_FORMAT_RGB888:
+  default:
+    *ColorMode = DMA2D_OUTPUT_ARGB8888;
+    break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the DMA2D input color mode reading back a frame buffer.
+  * @param  OutputColorMode DMA2D output color mode of the frame buffer
+  * @retval DMA2D input color mode
+  */
+static uint32_t LCD_GetReadColorMode(uint32_t OutputColorMode)
+{
+  uint32_t input_color_mode;
+
+  switch(OutputColorMode)
+  {
+  case DMA2D_OUTPUT_RGB565:
+    input_color_mode = DMA2D_INPUT_RGB565;
+    break;
+  case DMA2D_OUTPUT_ARGB1555:
+    input_color_mode = DMA2D_INPUT_ARGB1555;
+    break;
+  case DMA2D_OUTPUT_ARGB4444:
+    input_color_mode = DMA2D_INPUT_ARGB4444;
+    break;
+  default:
+    input_color_mode = DMA2D_INPUT_ARGB8888;
+    break;
+  }
+
+  return input_color_mode;
+}
+
+/**
+  * @brief  Converts an ARGB8888 color to a pixel of a layer pixel format. The
+  *         CLUT formats hold the luminance of the color.
+  * @param  PixelFormat LCD pixel format
+  * @param  Color       ARGB8888 color, or RGB565 color for the RGB565 format
+  * @retval Pixel value
+  */
+static uint32_t LCD_ColorToRaw(uint32_t PixelFormat, uint32_t Color)
+{
+  uint32_t alpha = (Color >> 24) & 0xFFU;
+  uint32_t red   = (Color >> 16) & 0xFFU;
+  uint32_t green = (Color >> 8) & 0xFFU;
+  uint32_t blue  = Color & 0xFFU;
+  uint32_t luma  = ((red * 77U) + (green * 150U) + (blue * 29U)) >> 8;
+  uint32_t raw;
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_ARGB1555:
+    raw = ((alpha >> 7) << 15) | ((red >> 3) << 10) | ((green >> 3) << 5) | (blue >> 3);
+    break;
+  case LCD_PIXEL_FORMAT_ARGB4444:
+    raw = ((alpha >> 4) << 12) | ((red >> 4) << 8) | ((green >> 4) << 4) | (blue >> 4);
+    break;
+  case LCD_PIXEL_FORMAT_L8:
+    raw = luma;
+    break;
+  case LCD_PIXEL_FORMAT_AL44:
+    raw = (alpha & 0xF0U) | (luma >> 4);
+    break;
+  case LCD_PIXEL_FORMAT_AL88:
+    raw = (alpha << 8) | luma;
+    break;
+  default:
+    raw = Color;
+    break;
+  }
+
+  return raw;
+}
+
+/**
+  * @brief  Converts a pixel of a layer pixel format to an ARGB8888 color.
+  * @param  PixelFormat LCD pixel format
+  * @param  Raw         Pixel value
+  * @retval ARGB8888 color, or RGB565 color for the RGB565 format
+  */
+static uint32_t LCD_RawToColor(uint32_t PixelFormat, uint32_t Raw)
+{
+  uint32_t color;
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_ARGB1555:
+    color = (((Raw & 0x8000U) != 0U) ? 0xFF000000U : 0U) |
+            ((((Raw >> 10) & 0x1FU) * 255U / 31U) << 16) |
+            ((((Raw >> 5) & 0x1FU) * 255U / 31U) << 8) |
+            ((Raw & 0x1FU) * 255U / 31U);
+    break;
+  case LCD_PIXEL_FORMAT_ARGB4444:
+    color = ((((Raw >> 12) & 0xFU) * 17U) << 24) | ((((Raw >> 8) & 0xFU) * 17U) << 16) |
+            ((((Raw >> 4) & 0xFU) * 17U) << 8) | ((Raw & 0xFU) * 17U);
+    break;
+  case LCD_PIXEL_FORMAT_L8:
+    color = 0xFF000000U | ((Raw & 0xFFU) * 0x010101U);
+    break;
+  case LCD_PIXEL_FORMAT_AL44:
+    color = ((((Raw >> 4) & 0xFU) * 17U) << 24) | (((Raw & 0xFU) * 17U) * 0x010101U);
+    break;
+  case LCD_PIXEL_FORMAT_AL88:
+    color = (((Raw >> 8) & 0xFFU) << 24) | ((Raw & 0xFFU) * 0x010101U);
+    break;
+  default:
+    color = Raw;
+    break;
+  }
+
+  return color;
+}
+
+/**
+  * @brief  Fills a buffer with the CPU.
+  * @param  BppFactor Bytes per pixel, 1 or 2
+  * @param  Address   Buffer address
+  * @param  xSize     Buffer width
+  * @param  ySize     Buffer height
+  * @param  OffLine   Offset
+  * @param  Raw       Pixel value
+  */
+static void LCD_CpuFill(uint32_t BppFactor, uint32_t Address, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Raw)
+{
+  uint32_t i, j;
+  uint32_t address = Address;
+
+  for(i = 0U; i < ySize; i++)
+  {
+    for(j = 0U; j < xSize; j++)
+    {
+      if(BppFactor == 1U)
+      {
+        *(__IO uint8_t *)address = (uint8_t)Raw;
+      }
+      else
+      {
+        *(__IO uint16_t *)address = (uint16_t)Raw;
+      }
+      address += BppFactor;
+    }
+    address += OffLine * BppFactor;
+  }
+}
+
+#if (USE_BSP_LCD_OVERLAY == 1) || (USE_BSP_LCD_CLUT == 1)
+/**
+  * @brief  Loads a gray ramp to the CLUT of an L8, AL44 or AL88 layer, the
+  *         indexes then hold the luminance. The CLUT of the other formats is
+  *         disabled.
+  * @param  LayerIndex  Layer 0 or 1
+  * @param  PixelFormat Layer pixel format
+  * @retval None
+  */
+static void LCD_ConfigGrayClut(uint32_t LayerIndex, uint32_t PixelFormat)
+{
+  uint32_t clut[256];
+  uint32_t i, clut_size = LCD_ClutSize(PixelFormat);
+
+  if(clut_size != 0U)
+  {
+    for(i = 0U; i < clut_size; i++)
+    {
+      clut[i] = ((i * 255U) / (clut_size - 1U)) * 0x010101U;
+    }
+    (void)HAL_LTDC_ConfigCLUT(&hlcd_ltdc, clut, clut_size, LayerIndex);
+    (void)HAL_LTDC_EnableCLUT(&hlcd_ltdc, LayerIndex);
+  }
+  else
+  {
+    (void)HAL_LTDC_DisableCLUT(&hlcd_ltdc, LayerIndex);
+  }
+}
+
+/**
+  * @brief  Gets the number of CLUT colors of a pixel format.
+  * @param  PixelFormat Pixel format
+  * @retval 256 for L8 and AL88, 16 for AL44, 0 for the formats without CLUT
+  */
+static uint32_t LCD_ClutSize(uint32_t PixelFormat)
+{
+  uint32_t clut_size;
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_L8:
+  case LCD_PIXEL_FORMAT_AL88:
+    clut_size = 256U;
+    break;
+  case LCD_PIXEL_FORMAT_AL44:
+    clut_size = 16U;
+    break;
+  default:
+    clut_size = 0U;
+    break;
+  }
+
+  return clut_size;
+}
+#endif /* (USE_BSP_LCD_OVERLAY == 1) || (USE_BSP_LCD_CLUT == 1) */
+
+/**
+  * @brief  Programs the DMA2D with a queued job and starts it in interrupt mode.
+  * @param  Job  Pointer to the job
+  * @retval BSP status
+  */
+static int32_t LCD_DMA2D_StartJob(const BSP_LCD_DMA2D_Job_t *Job)
+{
+  int32_t ret = BSP_ERROR_PERIPH_FAILURE;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  hlcd_dma2d.Instance = DMA2D;
+  hlcd_dma2d.Init     = Job->Init;
+  hlcd_dma2d.LayerCfg[0] = Job->Background;
+  hlcd_dma2d.LayerCfg[1] = Job->Foreground;
+  hlcd_dma2d.XferCpltCallback  = LCD_DMA2D_XferCpltCallback;
+  hlcd_dma2d.XferErrorCallback = LCD_DMA2D_XferErrorCallback;
+
+  /* DMA2D Initialization, the foreground CLUT is loaded before the transfer */
+  if((HAL_DMA2D_Init(&hlcd_dma2d) == HAL_OK) && (LCD_DMA2D_LoadCLUT(Job) == HAL_OK))
+  {
+    switch(Job->Init.Mode)
+    {
+    case DMA2D_R2M:
+      status = HAL_DMA2D_Start_IT(&hlcd_dma2d, Job->Source, Job->Destination, Job->Width, Job->Height);
+      break;
+    case DMA2D_M2M_BLEND:
+    case DMA2D_M2M_BLEND_FG:
+    case DMA2D_M2M_BLEND_BG:
+      if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 0) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+      else if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 1) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+      else
+      {
+        status = HAL_DMA2D_BlendingStart_IT(&hlcd_dma2d, Job->Source, Job->Source2, Job->Destination, Job->Width, Job->Height);
+      }
+      break;
+    case DMA2D_M2M:
+    case DMA2D_M2M_PFC:
+    default:
+      if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 1) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+      else
+      {
+        status = HAL_DMA2D_Start_IT(&hlcd_dma2d, Job->Source, Job->Destination, Job->Width, Job->Height);
+      }
+      break;
+    }
+
+    if(status == HAL_OK)
+    {
+      Lcd_Dma2dQueue.Busy = 1U;
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Loads the foreground CLUT of a job, if any, and waits for the end
+  *         of the load (about 1 us for 256 colors).
+  * @param  Job  Pointer to the job
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef LCD_DMA2D_LoadCLUT(const BSP_LCD_DMA2D_Job_t *Job)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  DMA2D_CLUTCfgTypeDef clut;
+
+  if(Job->pCLUT != NULL)
+  {
+    clut.pCLUT         = (uint32_t *)Job->pCLUT;
+    clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+    clut.Size          = Job->CLUTSize - 1U;
+    status = HAL_DMA2D_CLUTStartLoad(&hlcd_dma2d, &clut, DMA2D_FOREGROUND_LAYER);
+    if(status == HAL_OK)
+    {
+      status = HAL_DMA2D_PollForTransfer(&hlcd_dma2d, BSP_LCD_DMA2D_TIMEOUT);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Retires the current DMA2D job and starts the next queued one.
+  *         Called with the DMA2D interrupt masked or from the DMA2D interrupt.
+  * @param  Error  1 if the job ended on an error
+  * @retval None
+  */
+static void LCD_DMA2D_JobDone(uint32_t Error)
+{
+  uint32_t error = Error;
+
+  /* Skip the jobs which cannot be started, their fences are still signaled */
+  do
+  {
+    Lcd_Dma2dQueue.Busy = 0U;
+    Lcd_Dma2dQueue.Errors += error;
+    Lcd_Dma2dQueue.Tail++;
+    error = 1U;
+  } while((Lcd_Dma2dQueue.Tail != Lcd_Dma2dQueue.Head) &&
+          (LCD_DMA2D_StartJob(&Lcd_Dma2dQueue.Jobs[Lcd_Dma2dQueue.Tail & LCD_DMA2D_QUEUE_MASK]) != BSP_ERROR_NONE));
+}
+
+/**
+  * @brief  DMA2D transfer complete callback.
+  * @param  hdma2d  DMA2D handle
+  * @retval None
+  */
+static void LCD_DMA2D_XferCpltCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  UNUSED(hdma2d);
+
+  LCD_DMA2D_JobDone(0U);
+}
+
+/**
+  * @brief  DMA2D transfer error callback.
+  * @param  hdma2d  DMA2D handle
+  * @retval None
+  */
+static void LCD_DMA2D_XferErrorCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  UNUSED(hdma2d);
+
+  LCD_DMA2D_JobDone(1U);
+}
+
+/**
+  * @brief  Places the layer 0 frame buffers after LCD_LAYER_0_ADDRESS, the
+  *         first one being scanned out.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+static void LCD_FrameBuffersInit(uint32_t Instance)
+{
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+  uint32_t i;
+
+  for(i = 0; i < LCD_LAYER_0_BUFFERS_NBR; i++)
+  {
+    Lcd_FrameBuffers[Instance].Address[i] = LCD_LAYER_0_ADDRESS + (i * Lcd_Ctx[Instance].XSize * Lcd_Ctx[Instance].YSize * Lcd_Ctx[Instance].BppFactor);
+  }
+  Lcd_FrameBuffers[Instance].Front   = 0U;
+  Lcd_FrameBuffers[Instance].Pending = 0U;
+  Lcd_FrameBuffers[Instance].Back    = 1U;
+#else
+  UNUSED(Instance);
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+}
+
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+/**
+  * @brief  Makes the pending buffer the front one once the LTDC loaded it.
+  *         When a reload is about to happen, waits for it so that the caller
+  *         can safely rewrite the layer address. Called with interrupts masked.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+static void LCD_FrameBuffersUpdate(uint32_t Instance)
+{
+  uint32_t line;
+  uint32_t last_line = (hlcd_ltdc.Instance->AWCR & LTDC_AWCR_AAH);
+
+  if((hlcd_ltdc.Instance->SRCR & LTDC_SRCR_VBR) != 0U)
+  {
+    line = (hlcd_ltdc.Instance->CPSR & LTDC_CPSR_CYPOS);
+    while(((hlcd_ltdc.Instance->SRCR & LTDC_SRCR_VBR) != 0U) &&
+          (line >= (last_line - LCD_SWAP_GUARD_LINES)) && (line <= last_line))
+    {
+      line = (hlcd_ltdc.Instance->CPSR & LTDC_CPSR_CYPOS);
+    }
+  }
+
+  if((hlcd_ltdc.Instance->SRCR & LTDC_SRCR_VBR) == 0U)
+  {
+    Lcd_FrameBuffers[Instance].Front = Lcd_FrameBuffers[Instance].Pending;
+  }
+}
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+
+/**
+  * @brief  Gets the frame buffer address the draw functions write to.
+  * @param  Instance LCD Instance
+  * @retval Frame buffer address of the active layer
+  */
+static uint32_t LCD_GetDrawAddress(uint32_t Instance)
+{
+  uint32_t address = hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress;
+
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+  if(Lcd_Ctx[Instance].ActiveLayer == 0U)
+  {
+    address = Lcd_FrameBuffers[Instance].Address[Lcd_FrameBuffers[Instance].Back];
+  }
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+#if (USE_BSP_LCD_ROTATION == 1)
+  if((Lcd_Ctx[Instance].ActiveLayer == 0U) && (Lcd_Rotation[Instance].Rotation != LCD_ROTATION_0))
+  {
+    address = LCD_ROTATION_ADDRESS;
+  }
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+
+  return address;
+}
+
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+/**
+  * @brief  Gets the beam racing band of a line of the active area.
+  * @param  Instance LCD Instance
+  * @param  Row      Line of the active area
+  * @retval Band index
+  */
+static uint32_t LCD_GetBand(uint32_t Instance, uint32_t Row)
+{
+  uint32_t band = Row / (Lcd_Ctx[Instance].YSize / BSP_LCD_BEAM_BANDS_NBR);
+
+  if(band >= BSP_LCD_BEAM_BANDS_NBR)
+  {
+    /* The last band gets the remaining lines */
+    band = BSP_LCD_BEAM_BANDS_NBR - 1U;
+  }
+
+  return band;
+}
+
+/**
+  * @brief  Gets the band being scanned out by the LTDC. The blanking counts as
+  *         band 0 as the next scanned lines are the band 0 ones.
+  * @param  Instance LCD Instance
+  * @retval Band index
+  */
+static uint32_t LCD_GetScanBand(uint32_t Instance)
+{
+  uint32_t line;
+
+  (void)BSP_LCD_GetScanline(Instance, &line);
+
+  return (line < Lcd_Ctx[Instance].YSize) ? LCD_GetBand(Instance, line) : 0U;
+}
+
+/**
+  * @brief  Gets the active area line following a band.
+  * @param  Instance LCD Instance
+  * @param  Band     Band index
+  * @retval Line of the active area
+  */
+static uint32_t LCD_GetBandEnd(uint32_t Instance, uint32_t Band)
+{
+  uint32_t row;
+
+  if(Band == (BSP_LCD_BEAM_BANDS_NBR - 1U))
+  {
+    row = Lcd_Ctx[Instance].YSize;
+  }
+  else
+  {
+    row = (Band + 1U) * (Lcd_Ctx[Instance].YSize / BSP_LCD_BEAM_BANDS_NBR);
+  }
+
+  return row;
+}
+
+/**
+  * @brief  Gets the first active area line written by a job.
+  * @param  Instance LCD Instance
+  * @param  Job      Pointer to the job
+  * @param  Row      Line of the active area
+  * @retval BSP status, BSP_ERROR_WRONG_PARAM when the job does not write to a
+  *         displayed frame buffer
+  */
+static int32_t LCD_BeamGetJobRow(uint32_t Instance, const BSP_LCD_DMA2D_Job_t *Job, uint32_t *Row)
+{
+  int32_t ret = BSP_ERROR_WRONG_PARAM;
+  uint32_t layer, address;
+  uint32_t pitch = Lcd_Ctx[Instance].XSize * Lcd_Ctx[Instance].BppFactor;
+
+  for(layer = LTDC_LAYER_1; layer <= LTDC_LAYER_2; layer++)
+  {
+    address = hlcd_ltdc.LayerCfg[layer].FBStartAdress;
+
+    if(((LTDC_LAYER(&hlcd_ltdc, layer)->CR & LTDC_LxCR_LEN) != 0U) &&
+       (Job->Destination >= address) && (Job->Destination < (address + (pitch * Lcd_Ctx[Instance].YSize))))
+    {
+      *Row = (Job->Destination - address) / pitch;
+      ret = BSP_ERROR_NONE;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the distance in bytes between two lines of a DMA2D layer.
+  * @param  ColorMode      DMA2D input color mode, or output color mode (same
+  *                        values as the first five input ones)
+  * @param  Width          Line width in pixels
+  * @param  Offset         Line offset
+  * @param  LineOffsetMode DMA2D_LOM_PIXELS or DMA2D_LOM_BYTES
+  * @param  Pitch          Bytes between two lines
+  * @retval BSP status, BSP_ERROR_FEATURE_NOT_SUPPORTED when the lines do not
+  *         start on a byte (L4 and A4 with an odd pitch)
+  */
+static int32_t LCD_BeamGetPitch(uint32_t ColorMode, uint32_t Width, uint32_t Offset, uint32_t LineOffsetMode, uint32_t *Pitch)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t bits;
+
+  switch(ColorMode)
+  {
+  case DMA2D_INPUT_ARGB8888:
+    bits = 32U;
+    break;
+  case DMA2D_INPUT_RGB888:
+    bits = 24U;
+    break;
+  case DMA2D_INPUT_RGB565:
+  case DMA2D_INPUT_ARGB1555:
+  case DMA2D_INPUT_ARGB4444:
+  case DMA2D_INPUT_AL88:
+    bits = 16U;
+    break;
+  case DMA2D_INPUT_L4:
+  case DMA2D_INPUT_A4:
+    bits = 4U;
+    break;
+  default:
+    /* L8, AL44 and A8 */
+    bits = 8U;
+    break;
+  }
+
+  bits = (LineOffsetMode == DMA2D_LOM_BYTES) ? ((Width * bits) + (Offset * 8U)) : ((Width + Offset) * bits);
+
+  if((bits % 8U) != 0U)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    *Pitch = bits / 8U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the part of a job writing some of its lines.
+  * @param  Job      Pointer to the job
+  * @param  Line     First line of the part, counted from the job first line
+  * @param  Height   Number of lines of the part
+  * @param  Part     Pointer to the part
+  * @retval BSP status, BSP_ERROR_FEATURE_NOT_SUPPORTED when the job lines
+  *         cannot be addressed separately
+  */
+static int32_t LCD_BeamGetJobPart(const BSP_LCD_DMA2D_Job_t *Job, uint32_t Line, uint32_t Height, BSP_LCD_DMA2D_Job_t *Part)
+{
+  int32_t ret;
+  uint32_t pitch, fg_pitch = 0U, bg_pitch = 0U;
+
+  ret = LCD_BeamGetPitch(Job->Init.ColorMode, Job->Width, Job->Init.OutputOffset, Job->Init.LineOffsetMode, &pitch);
+
+  /* Source is a color in DMA2D_R2M and DMA2D_M2M_BLEND_FG modes, Source2 is
+     used by the blending modes and is a color in DMA2D_M2M_BLEND_BG mode */
+  if((ret == BSP_ERROR_NONE) && (Job->Init.Mode != DMA2D_R2M) && (Job->Init.Mode != DMA2D_M2M_BLEND_FG))
+  {
+    ret = LCD_BeamGetPitch(Job->Foreground.InputColorMode, Job->Width, Job->Foreground.InputOffset,
+                           Job->Init.LineOffsetMode, &fg_pitch);
+  }
+  if((ret == BSP_ERROR_NONE) && ((Job->Init.Mode == DMA2D_M2M_BLEND) || (Job->Init.Mode == DMA2D_M2M_BLEND_FG)))
+  {
+    ret = LCD_BeamGetPitch(Job->Background.InputColorMode, Job->Width, Job->Background.InputOffset,
+                           Job->Init.LineOffsetMode, &bg_pitch);
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    *Part = *Job;
+    Part->Height       = Height;
+    Part->Destination += Line * pitch;
+    Part->Source      += Line * fg_pitch;
+    Part->Source2     += Line * bg_pitch;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Holds a job part until the LTDC scanned past its band, or queues
+  *         it if the LTDC is already below the band.
+  * @param  Instance  LCD Instance
+  * @param  Band      Band index
+  * @param  Part      Pointer to the part, copied
+  * @param  TickStart Tick of the submission, for the timeout
+  * @retval BSP status
+  */
+static int32_t LCD_BeamHold(uint32_t Instance, uint32_t Band, const BSP_LCD_DMA2D_Job_t *Part, uint32_t TickStart)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  LCD_Beam_t *beam = &Lcd_Beam[Instance];
+  uint32_t primask, queued = 0U;
+
+  while((queued == 0U) && (ret == BSP_ERROR_NONE))
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if(LCD_GetScanBand(Instance) > Band)
+    {
+      /* Beam below the part lines, a full frame to complete it */
+      ret = BSP_LCD_DMA2D_Submit(Instance, Part, NULL);
+      queued = 1U;
+    }
+    else if((beam->Head[Band] - beam->Tail[Band]) < BSP_LCD_BEAM_QUEUE_SIZE)
+    {
+      beam->Jobs[Band][beam->Head[Band] & LCD_BEAM_QUEUE_MASK] = *Part;
+      beam->Head[Band]++;
+      queued = 1U;
+    }
+    else
+    {
+      /* Band full, wait for its line event */
+    }
+
+    __set_PRIMASK(primask);
+
+    if(queued == 0U)
+    {
+      LCD_BeamPoll(Instance);
+
+      if((HAL_GetTick() - TickStart) > BSP_LCD_DMA2D_TIMEOUT)
+      {
+        ret = BSP_ERROR_BUSY;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the LTDC line following a band.
+  * @param  Instance LCD Instance
+  * @param  Band     Band index
+  * @retval Line position, as counted by the LTDC
+  */
+static uint32_t LCD_BeamBandEndLine(uint32_t Instance, uint32_t Band)
+{
+  return hlcd_ltdc.Init.AccumulatedVBP + 1U + LCD_GetBandEnd(Instance, Band);
+}
+
+/**
+  * @brief  Pushes the jobs held for a band to the DMA2D queue.
+  *         Called with interrupts masked or from the LTDC interrupt.
+  * @param  Instance LCD Instance
+  * @param  Band     Band index
+  * @retval None
+  */
+static void LCD_BeamRelease(uint32_t Instance, uint32_t Band)
+{
+  LCD_Beam_t *beam = &Lcd_Beam[Instance];
+
+  while(beam->Tail[Band] != beam->Head[Band])
+  {
+    (void)BSP_LCD_DMA2D_Submit(Instance, &beam->Jobs[Band][beam->Tail[Band] & LCD_BEAM_QUEUE_MASK], NULL);
+    beam->Tail[Band]++;
+  }
+}
+
+/**
+  * @brief  Services the LTDC interrupt when the caller cannot be preempted by it.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+static void LCD_BeamPoll(uint32_t Instance)
+{
+  uint32_t primask;
+
+  if((__get_PRIMASK() != 0U) || (__get_IPSR() != 0U))
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    BSP_LCD_LTDC_IRQHandler(Instance);
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Releases the band the LTDC just scanned past and programs the line
+  *         event of the next one.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+static void LCD_BeamLineEvent(uint32_t Instance)
+{
+  LCD_Beam_t *beam = &Lcd_Beam[Instance];
+  uint32_t line;
+
+  if(beam->Running == 1U)
+  {
+    LCD_BeamRelease(Instance, beam->NextBand);
+    beam->NextBand = (beam->NextBand + 1U) % BSP_LCD_BEAM_BANDS_NBR;
+    line = LCD_BeamBandEndLine(Instance, beam->NextBand);
+
+    if(HAL_LTDC_ProgramLineEvent(&hlcd_ltdc, line) != HAL_OK)
+    {
+      /* Handle locked by the interrupted code, program the line event directly */
+      hlcd_ltdc.Instance->LIPCR = line;
+      __HAL_LTDC_ENABLE_IT(&hlcd_ltdc, LTDC_IT_LI);
+    }
+  }
+}
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+
+#if (USE_BSP_LCD_ANIMATION == 1)
+/**
+  * @brief  Checks the values of an animation against its layer.
+  * @param  Anim  Animation
+  * @param  Step  Granularity of the interpolated value
+  * @retval BSP status
+  */
+static int32_t LCD_AnimCheck(const BSP_LCD_Anim_t *Anim, uint32_t *Step)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  const LTDC_LayerCfgTypeDef *cfg;
+  uint32_t width, height, bpp, pitch, delta;
+
+  if((Anim->LayerIndex > 1U) || (Anim->Frames == 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+  else if((Anim->Property == BSP_LCD_ANIM_ADDRESS) && (Anim->LayerIndex == 0U))
+  {
+    /* Owned by BSP_LCD_SwapBuffers() */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+  else
+  {
+    cfg = &hlcd_ltdc.LayerCfg[Anim->LayerIndex];
+
+    switch(Anim->Property)
+    {
+    case BSP_LCD_ANIM_ALPHA:
+      if((Anim->From > 0xFFU) || (Anim->To > 0xFFU))
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      break;
+    case BSP_LCD_ANIM_POSITION:
+      /* The whole window stays in the active area */
+      width  = (hlcd_ltdc.Init.AccumulatedActiveW - hlcd_ltdc.Init.AccumulatedHBP) - (cfg->WindowX1 - cfg->WindowX0);
+      height = (hlcd_ltdc.Init.AccumulatedActiveH - hlcd_ltdc.Init.AccumulatedVBP) - (cfg->WindowY1 - cfg->WindowY0);
+      if((Anim->From > width) || (Anim->To > width) || (Anim->FromY > height) || (Anim->ToY > height))
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      break;
+    case BSP_LCD_ANIM_ADDRESS:
+      switch(cfg->PixelFormat)
+      {
+      case LTDC_PIXEL_FORMAT_ARGB8888:
+        bpp = 4U;
+        break;
+      case LTDC_PIXEL_FORMAT_RGB888:
+        bpp = 3U;
+        break;
+      case LTDC_PIXEL_FORMAT_L8:
+      case LTDC_PIXEL_FORMAT_AL44:
+        bpp = 1U;
+        break;
+      default:
+        bpp = 2U;
+        break;
+      }
+      pitch = cfg->ImageWidth * bpp;
+      delta = (Anim->To > Anim->From) ? (Anim->To - Anim->From) : (Anim->From - Anim->To);
+
+      if((delta % bpp) != 0U)
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      else
+      {
+        /* Whole lines keep the image aligned while scrolling vertically */
+        *Step = ((delta % pitch) == 0U) ? pitch : bpp;
+      }
+      break;
+    default:
+      ret = BSP_ERROR_WRONG_PARAM;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Interpolates an animated value.
+  * @param  Anim   Animation
+  * @param  From   Start value
+  * @param  To     End value
+  * @param  Step   Granularity of the value
+  * @param  Frame  Frames elapsed since the start value, up to Anim->Frames
+  * @retval Value of the frame
+  */
+static uint32_t LCD_AnimValue(const BSP_LCD_Anim_t *Anim, uint32_t From, uint32_t To, uint32_t Step, uint32_t Frame)
+{
+  uint64_t t, u, e;
+  uint32_t steps, ret;
+
+  /* Progress and eased progress, 16.16 fixed point */
+  t = ((uint64_t)Frame << 16U) / Anim->Frames;
+
+  switch(Anim->Easing)
+  {
+  case BSP_LCD_ANIM_EASE_IN:
+    e = (t * t) >> 16U;
+    break;
+  case BSP_LCD_ANIM_EASE_OUT:
+    u = 0x10000U - t;
+    e = 0x10000U - ((u * u) >> 16U);
+    break;
+  case BSP_LCD_ANIM_EASE_IN_OUT:
+    e = (((t * t) >> 16U) * (0x30000U - (2U * t))) >> 16U;
+    break;
+  default:
+    e = t;
+    break;
+  }
+
+  if(To >= From)
+  {
+    steps = (uint32_t)(((((uint64_t)To - From) / Step) * e + 0x8000U) >> 16U);
+    ret   = From + (steps * Step);
+  }
+  else
+  {
+    steps = (uint32_t)(((((uint64_t)From - To) / Step) * e + 0x8000U) >> 16U);
+    ret   = From - (steps * Step);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes the value of the current frame of an animation to the LTDC
+  *         shadow registers. The registers are written directly as the HAL
+  *         handle may be locked by the interrupted code, the HAL layer
+  *         configuration is kept in sync.
+  * @param  Slot  Animation slot
+  * @retval None
+  */
+static void LCD_AnimApply(const LCD_AnimSlot_t *Slot)
+{
+  const BSP_LCD_Anim_t *anim = &Slot->Anim;
+  LTDC_LayerCfgTypeDef *cfg = &hlcd_ltdc.LayerCfg[anim->LayerIndex];
+  uint32_t ahbp = (hlcd_ltdc.Instance->BPCR & LTDC_BPCR_AHBP) >> 16U;
+  uint32_t avbp = (hlcd_ltdc.Instance->BPCR & LTDC_BPCR_AVBP);
+  uint32_t width, height;
+
+  switch(anim->Property)
+  {
+  case BSP_LCD_ANIM_ALPHA:
+    cfg->Alpha = LCD_AnimValue(anim, anim->From, anim->To, Slot->Step, Slot->Frame);
+    LTDC_LAYER(&hlcd_ltdc, anim->LayerIndex)->CACR = cfg->Alpha;
+    break;
+  case BSP_LCD_ANIM_POSITION:
+    width  = cfg->WindowX1 - cfg->WindowX0;
+    height = cfg->WindowY1 - cfg->WindowY0;
+    cfg->WindowX0 = LCD_AnimValue(anim, anim->From, anim->To, Slot->Step, Slot->Frame);
+    cfg->WindowY0 = LCD_AnimValue(anim, anim->FromY, anim->ToY, Slot->Step, Slot->Frame);
+    cfg->WindowX1 = cfg->WindowX0 + width;
+    cfg->WindowY1 = cfg->WindowY0 + height;
+    LTDC_LAYER(&hlcd_ltdc, anim->LayerIndex)->WHPCR = (cfg->WindowX0 + ahbp + 1U) | ((cfg->WindowX1 + ahbp) << 16U);
+    LTDC_LAYER(&hlcd_ltdc, anim->LayerIndex)->WVPCR = (cfg->WindowY0 + avbp + 1U) | ((cfg->WindowY1 + avbp) << 16U);
+    break;
+  default:
+    cfg->FBStartAdress = LCD_AnimValue(anim, anim->From, anim->To, Slot->Step, Slot->Frame);
+    LTDC_LAYER(&hlcd_ltdc, anim->LayerIndex)->CFBAR = cfg->FBStartAdress;
+    break;
+  }
+}
+
+/**
+  * @brief  Stages the next frame of the running animations and requests their
+  *         reload at the next vertical blanking. The animations whose To value
+  *         was just loaded are ended. Called with the LTDC interrupt masked.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+static void LCD_AnimStep(uint32_t Instance)
+{
+  LCD_AnimSlot_t *slot;
+  uint32_t i, staged = 0U, done = 0U;
+
+  for(i = 0U; i < BSP_LCD_ANIM_NBR; i++)
+  {
+    slot = &Lcd_Anim.Slots[i];
+
+    if(slot->State == LCD_ANIM_DONE)
+    {
+      slot->State = LCD_ANIM_FREE;
+      done |= (1UL << i);
+    }
+    else if(slot->State == LCD_ANIM_RUNNING)
+    {
+      LCD_AnimApply(slot);
+
+      if(slot->Frame == slot->Anim.Frames)
+      {
+        slot->State = LCD_ANIM_DONE;
+      }
+      else
+      {
+        slot->Frame++;
+      }
+      staged = 1U;
+    }
+    else
+    {
+      /* Free slot */
+    }
+  }
+
+  if(staged == 1U)
+  {
+    __HAL_LTDC_ENABLE_IT(&hlcd_ltdc, LTDC_IT_RR);
+    hlcd_ltdc.Instance->SRCR = LTDC_SRCR_VBR;
+  }
+  Lcd_Anim.Pending = staged;
+
+  /* Notified last, the callbacks may start new animations */
+  for(i = 0U; i < BSP_LCD_ANIM_NBR; i++)
+  {
+    if((done & (1UL << i)) != 0U)
+    {
+      BSP_LCD_AnimCallback(Instance, i);
+    }
+  }
+}
+
+/**
+  * @brief  Handles the LTDC register reload interrupt.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+
+#if (USE_BSP_LCD_CLUT == 1)
+/**
+  * @brief  Gets the DMA2D input color mode of an indexed image.
+  * @param  PixelFormat    LCD_PIXEL_FORMAT_L8, _AL44 or _AL88
+  * @param  InputColorMode DMA2D input color mode
+  * @param  BppFactor      Bytes per pixel
+  * @retval BSP status
+  */
+static int32_t LCD_GetInputColorMode(uint32_t PixelFormat, uint32_t *InputColorMode, uint32_t *BppFactor)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  switch(PixelFormat)
+  {
+  case LCD_PIXEL_FORMAT_L8:
+    *InputColorMode = DMA2D_INPUT_L8;
+    *BppFactor      = 1U;
+    break;
+  case LCD_PIXEL_FORMAT_AL44:
+    *InputColorMode = DMA2D_INPUT_AL44;
+    *BppFactor      = 1U;
+    break;
+  case LCD_PIXEL_FORMAT_AL88:
+    *InputColorMode = DMA2D_INPUT_AL88;
+    *BppFactor      = 2U;
+    break;
+  default:
+    ret = BSP_ERROR_WRONG_PARAM;
+    break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes the swapped CLUTs during the vertical blanking. Called from
+  *         the LTDC register reload interrupt.
+  * @retval None
+  */
+static void LCD_ClutReloadEvent(void)
+{
+  uint32_t i, layer, address;
+
+  for(layer = 0U; layer < 2U; layer++)
+  {
+    if(Lcd_ClutSwap[layer].Pending == 1U)
+    {
+      if((hlcd_ltdc.Instance->CDSR & LTDC_CDSR_VDES) == 0U)
+      {
+        for(i = 0U; i < Lcd_ClutSwap[layer].Size; i++)
+        {
+          /* Same addresses as HAL_LTDC_ConfigCLUT(), the AL44 indexes are 4-bit */
+          address = (hlcd_ltdc.LayerCfg[layer].PixelFormat == LTDC_PIXEL_FORMAT_AL44) ? (i * 17U) : i;
+          LTDC_LAYER(&hlcd_ltdc, layer)->CLUTWR = (address << 24) | (Lcd_ClutSwap[layer].Colors[i] & 0x00FFFFFFU);
+        }
+        Lcd_ClutSwap[layer].Pending = 0U;
+      }
+      else
+      {
+        /* Interrupt served after the vertical blanking, retry at the next one */
+        __HAL_LTDC_ENABLE_IT(&hlcd_ltdc, LTDC_IT_RR);
+        hlcd_ltdc.Instance->SRCR = LTDC_SRCR_VBR;
+      }
+    }
+  }
+}
+#endif /* USE_BSP_LCD_CLUT == 1 */
+
+#if (USE_BSP_LCD_ASSETS == 1)
+/**
+  * @brief  Gets the pixel size of an asset format.
+  * @param  Format BSP_LCD_ASSET_ARGB8888, _RGB565, _L8 or _A8
+  * @retval Bytes per pixel, 0 for an unknown format
+  */
+static uint32_t LCD_AssetBpp(uint32_t Format)
+{
+  uint32_t bpp;
+
+  switch(Format)
+  {
+  case BSP_LCD_ASSET_ARGB8888:
+    bpp = 4U;
+    break;
+  case BSP_LCD_ASSET_RGB565:
+    bpp = 2U;
+    break;
+  case BSP_LCD_ASSET_L8:
+  case BSP_LCD_ASSET_A8:
+    bpp = 1U;
+    break;
+  default:
+    bpp = 0U;
+    break;
+  }
+
+  return bpp;
+}
+
+/**
+  * @brief  Decodes RLE asset pixels. A control byte C below 128 is followed by
+  *         C + 1 pixels, a control byte C of 128 or more by a pixel repeated
+  *         C - 126 times.
+  * @param  pSrc    Encoded pixels
+  * @param  SrcSize Encoded size in bytes
+  * @param  pDst    Decoded pixels
+  * @param  DstSize Decoded size in bytes, filled exactly
+  * @param  Unit    Bytes per pixel
+  * @retval BSP status
+  */
+static int32_t LCD_AssetRle(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize, uint32_t Unit)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t in = 0U, out = 0U, control, length, i;
+
+  while((ret == BSP_ERROR_NONE) && (in < SrcSize))
+  {
+    control = pSrc[in];
+    in++;
+    if(control < 128U)
+    {
+      /* Literal pixels */
+      length = (control + 1U) * Unit;
+      if((length > (SrcSize - in)) || (length > (DstSize - out)))
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      else
+      {
+        for(i = 0U; i < length; i++)
+        {
+          pDst[out + i] = pSrc[in + i];
+        }
+        in  += length;
+        out += length;
+      }
+    }
+    else
+    {
+      /* Repeated pixel */
+      length = (control - 126U) * Unit;
+      if((Unit > (SrcSize - in)) || (length > (DstSize - out)))
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      else
+      {
+        for(i = 0U; i < length; i++)
+        {
+          pDst[out + i] = pSrc[in + (i % Unit)];
+        }
+        in  += Unit;
+        out += length;
+      }
+    }
+  }
+
+  if((ret == BSP_ERROR_NONE) && (out != DstSize))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Decodes an LZ4 block (sequences of literals and of matches).
+  * @param  pSrc    LZ4 block
+  * @param  SrcSize Block size in bytes
+  * @param  pDst    Decoded bytes
+  * @param  DstSize Decoded size in bytes, filled exactly
+  * @retval BSP status
+  */
+static int32_t LCD_AssetLz4(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t in = 0U, out = 0U, token, length, offset, last = 0U, i;
+
+  while((ret == BSP_ERROR_NONE) && (last == 0U) && (in < SrcSize))
+  {
+    token = pSrc[in];
+    in++;
+
+    /* Literals, their length extended by the bytes following a 15 */
+    length = token >> 4;
+    if(length == 15U)
+    {
+      do
+      {
+        if(in >= SrcSize)
+        {
+          ret = BSP_ERROR_WRONG_PARAM;
+        }
+        else
+        {
+          length += pSrc[in];
+          in++;
+        }
+      } while((ret == BSP_ERROR_NONE) && (pSrc[in - 1U] == 255U));
+    }
+
+    if(ret != BSP_ERROR_NONE)
+    {
+      /* Truncated length */
+    }
+    else if((length > (SrcSize - in)) || (length > (DstSize - out)))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else
+    {
+      for(i = 0U; i < length; i++)
+      {
+        pDst[out + i] = pSrc[in + i];
+      }
+      in  += length;
+      out += length;
+
+      if(in == SrcSize)
+      {
+        /* The last sequence has no match */
+        last = 1U;
+      }
+      else if((SrcSize - in) < 2U)
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+      else
+      {
+        offset = (uint32_t)pSrc[in] | ((uint32_t)pSrc[in + 1U] << 8);
+        in += 2U;
+
+        length = token & 0x0FU;
+        if(length == 15U)
+        {
+          do
+          {
+            if(in >= SrcSize)
+            {
+              ret = BSP_ERROR_WRONG_PARAM;
+            }
+            else
+            {
+              length += pSrc[in];
+              in++;
+            }
+          } while((ret == BSP_ERROR_NONE) && (pSrc[in - 1U] == 255U));
+        }
+        length += 4U;
+
+        if(ret != BSP_ERROR_NONE)
+        {
+          /* Truncated length */
+        }
+        else if((offset == 0U) || (offset > out) || (length > (DstSize - out)))
+        {
+          ret = BSP_ERROR_WRONG_PARAM;
+        }
+        else
+        {
+          /* Byte by byte, the match may overlap the bytes it writes */
+          for(i = 0U; i < length; i++)
+          {
+            pDst[out + i] = pDst[out + i - offset];
+          }
+          out += length;
+        }
+      }
+    }
+  }
+
+  if((ret == BSP_ERROR_NONE) && (out != DstSize))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_ASSETS == 1 */
+
+#if (USE_BSP_LCD_ANIMATION == 1) || (USE_BSP_LCD_CLUT == 1)
+/**
+  * @brief  Handles the LTDC register reload interrupt.
+  * @param  Instance LCD Instance
+  * @retval None
+  */
+static void LCD_ReloadEvent(uint32_t Instance)
+{
+#if (USE_BSP_LCD_ANIMATION == 1)
+  /* Skip the reload of an interrupt delayed past a new reload request */
+  if((hlcd_ltdc.Instance->SRCR & LTDC_SRCR_VBR) == 0U)
+  {
+#if (LCD_LAYER_0_BUFFERS_NBR > 1U)
+    /* The animations request the next reload before the thread sees this one */
+    Lcd_FrameBuffers[Instance].Front = Lcd_FrameBuffers[Instance].Pending;
+#endif /* LCD_LAYER_0_BUFFERS_NBR > 1U */
+    Lcd_Anim.Reloads++;
+  }
+
+  if(Lcd_Anim.Pending == 1U)
+  {
+    LCD_AnimStep(Instance);
+  }
+#else
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+
+#if (USE_BSP_LCD_CLUT == 1)
+  /* After the reload count, a CLUT retry requests a new reload */
+  LCD_ClutReloadEvent();
+#endif /* USE_BSP_LCD_CLUT == 1 */
+}
+#endif /* (USE_BSP_LCD_ANIMATION == 1) || (USE_BSP_LCD_CLUT == 1) */
+
+#if (USE_BSP_LCD_STATS == 1)
+/**
+  * @brief  Accounts one primitive call in the draw statistics.
+  * @param  Instance  LCD Instance
+  * @param  Primitive Primitive identifier
+  * @param  NbPixels  Number of pixels written
+  * @param  Cycles    Elapsed DWT cycles
+  */
+static void LCD_StatsUpdate(uint32_t Instance, BSP_LCD_StatsId_t Primitive, uint32_t NbPixels, uint32_t Cycles)
+{
+  Lcd_Stats[Instance][Primitive].Calls++;
+  Lcd_Stats[Instance][Primitive].Pixels += NbPixels;
+  Lcd_Stats[Instance][Primitive].Cycles += Cycles;
+}
+#endif /* USE_BSP_LCD_STATS == 1 */
+
+/*******************************************************************************
+                       BSP Routines:
+                                       LTDC
+                                       DMA2D
+                                       DSI
+*******************************************************************************/
+/**
+  * @brief  Initialize the BSP LTDC Msp.
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+static void LTDC_MspInit(LTDC_HandleTypeDef *hltdc)
+{
+  if(hltdc->Instance == LTDC)
+  {
+    /** Enable the LTDC clock */
+    __HAL_RCC_LTDC_CLK_ENABLE();
+
+
+    /** Toggle Sw reset of LTDC IP */
+    __HAL_RCC_LTDC_FORCE_RESET();
+    __HAL_RCC_LTDC_RELEASE_RESET();
+  }
+}
+
+/**
+  * @brief  De-Initializes the BSP LTDC Msp
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+static void LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc)
+{
+  if(hltdc->Instance == LTDC)
+  {
+    /** Force and let in reset state LTDC */
+    __HAL_RCC_LTDC_FORCE_RESET();
+
+    /** Disable the LTDC */
+    __HAL_RCC_LTDC_CLK_DISABLE();
+  }
+}
+
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 0)
+/**
+  * @brief  Line event callback
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hltdc);
+
+  LCD_BeamLineEvent(0);
+}
+#else
+/**
+  * @brief  Line event callback
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+static void LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hltdc);
+
+  LCD_BeamLineEvent(0);
+}
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 0) */
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+
+#if (USE_BSP_LCD_ANIMATION == 1) || (USE_BSP_LCD_CLUT == 1)
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 0)
+/**
+  * @brief  Reload event callback
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hltdc);
+
+  LCD_ReloadEvent(0);
+}
+#else
+/**
+  * @brief  Reload event callback
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+static void LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hltdc);
+
+  LCD_ReloadEvent(0);
+}
+#endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 0) */
+#endif /* (USE_BSP_LCD_ANIMATION == 1) || (USE_BSP_LCD_CLUT == 1) */
+
+#if (USE_BSP_LCD_ROTATION == 1)
+/**
+  * @brief  Handles an area drawn to the active layer: marks its tiles when the
+  *         layer 0 image is rotated, else signals the panel change.
+  * @param  Instance    LCD Instance
+  * @param  Xpos        X position
+  * @param  Ypos        Y position
+  * @param  Width       Area width
+  * @param  Height      Area height
+  * @retval None
+  */
+static void LCD_RotationDrawn(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  if((Lcd_Ctx[Instance].ActiveLayer == 0U) && (Lcd_Rotation[Instance].Rotation != LCD_ROTATION_0))
+  {
+    LCD_RotationMark(Instance, Xpos, Ypos, Width, Height);
+  }
+  else
+  {
+    LCD_PANEL_DRAWN(Instance, Xpos, Ypos, Width, Height);
+  }
+}
+
+/**
+  * @brief  Marks the tiles of an area of the drawn buffer as dirty.
+  * @param  Instance    LCD Instance
+  * @param  Xpos        X position
+  * @param  Ypos        Y position
+  * @param  Width       Area width
+  * @param  Height      Area height
+  * @retval None
+  */
+static void LCD_RotationMark(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  LCD_Rotation_t *rot = &Lcd_Rotation[Instance];
+  uint32_t tx, ty, tx_end, ty_end, tile;
+
+  if((Width != 0U) && (Height != 0U) && (Xpos < rot->XSize) && (Ypos < rot->YSize))
+  {
+    tx_end = (((Xpos + Width) > rot->XSize) ? (rot->XSize - 1U) : (Xpos + Width - 1U)) / BSP_LCD_ROTATION_TILE;
+    ty_end = (((Ypos + Height) > rot->YSize) ? (rot->YSize - 1U) : (Ypos + Height - 1U)) / BSP_LCD_ROTATION_TILE;
+
+    for(ty = Ypos / BSP_LCD_ROTATION_TILE; ty <= ty_end; ty++)
+    {
+      for(tx = Xpos / BSP_LCD_ROTATION_TILE; tx <= tx_end; tx++)
+      {
+        tile = (ty * rot->TilesX) + tx;
+        rot->Dirty[tile / 32U] |= 1UL << (tile % 32U);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Copies a tile of the drawn buffer to its rotated position in the
+  *         scanned out buffer.
+  * @param  Instance    LCD Instance
+  * @param  Xpos        Tile X position in the drawn buffer
+  * @param  Ypos        Tile Y position in the drawn buffer
+  * @param  Width       Tile width
+  * @param  Height      Tile height
+  * @retval None
+  */
+static void LCD_RotationCopy(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  const LCD_Rotation_t *rot = &Lcd_Rotation[Instance];
+  uint32_t bpp       = rot->BppFactor;
+  uint32_t width     = hlcd_ltdc.LayerCfg[0].ImageWidth;
+  uint32_t height    = hlcd_ltdc.LayerCfg[0].ImageHeight;
+  uint32_t src_pitch = rot->XSize * bpp;
+  uint32_t dst_pitch = width * bpp;
+  uint32_t src       = LCD_ROTATION_ADDRESS + (Ypos * src_pitch) + (Xpos * bpp);
+  uint32_t dst, step_x, step_y;
+  uint32_t panel_x, panel_y, panel_w, panel_h;
+  uint32_t i;
+
+  /* Destination of the first drawn pixel and moves of the destination for the
+     next pixel of a line and for the next line (two's complement when negative) */
+  switch(rot->Rotation)
+  {
+  case LCD_ROTATION_90:
+    /* Drawn lines become panel columns, from right to left */
+    panel_x = width - Ypos - Height;
+    panel_y = Xpos;
+    panel_w = Height;
+    panel_h = Width;
+    step_x  = dst_pitch;
+    step_y  = 0U - bpp;
+    break;
+  case LCD_ROTATION_180:
+    panel_x = width - Xpos - Width;
+    panel_y = height - Ypos - Height;
+    panel_w = Width;
+    panel_h = Height;
+    step_x  = 0U - bpp;
+    step_y  = 0U - dst_pitch;
+    break;
+  default:
+    /* LCD_ROTATION_270: drawn lines become panel columns, from left to right */
+    panel_x = Ypos;
+    panel_y = height - Xpos - Width;
+    panel_w = Height;
+    panel_h = Width;
+    step_x  = 0U - dst_pitch;
+    step_y  = bpp;
+    break;
+  }
+
+  /* The first drawn pixel lands on the corner of the panel area it maps to */
+  dst = hlcd_ltdc.LayerCfg[0].FBStartAdress +
+        ((((rot->Rotation == LCD_ROTATION_90) ? panel_y : (panel_y + panel_h - 1U)) * dst_pitch) +
+         (((rot->Rotation == LCD_ROTATION_270) ? panel_x : (panel_x + panel_w - 1U)) * bpp));
+
+  /* Drop stale lines of the tile drawn by the DMA2D: the CPU reads it back
+     whatever the cache maintenance setting, as the DMA2D bypasses the cache */
+  for(i = 0U; i < Height; i++)
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(src + (i * src_pitch)), (int32_t)(Width * bpp));
+  }
+
+  LCD_RotateTile(src, src_pitch, dst, step_x, step_y, Width, Height, bpp);
+
+#if (USE_BSP_CPU_CACHE_MAINTENANCE == 1)
+  /* The LTDC reads the SDRAM */
+  for(i = 0U; i < panel_h; i++)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)(hlcd_ltdc.LayerCfg[0].FBStartAdress + ((panel_y + i) * dst_pitch) + (panel_x * bpp)),
+                            (int32_t)(panel_w * bpp));
+  }
+#endif /* USE_BSP_CPU_CACHE_MAINTENANCE == 1 */
+
+  LCD_PANEL_DRAWN(Instance, panel_x, panel_y, panel_w, panel_h);
+}
+
+/**
+  * @brief  Copies a tile of pixels, moving the destination by StepX for each
+  *         pixel of a source line and by StepY for each source line.
+  * @param  Src         Address of the first source pixel
+  * @param  SrcPitch    Source line pitch in bytes
+  * @param  Dst         Destination of the first source pixel
+  * @param  StepX       Destination move per source pixel, in bytes
+  * @param  StepY       Destination move per source line, in bytes
+  * @param  Width       Tile width
+  * @param  Height      Tile height
+  * @param  BppFactor   Bytes per pixel, 2 or 4
+  * @retval None
+  */
+static void LCD_RotateTile(uint32_t Src, uint32_t SrcPitch, uint32_t Dst, uint32_t StepX, uint32_t StepY,
+                           uint32_t Width, uint32_t Height, uint32_t BppFactor)
+{
+  uint32_t x, y, src, dst;
+
+  for(y = 0U; y < Height; y++)
+  {
+    src = Src + (y * SrcPitch);
+    dst = Dst + (y * StepY);
+
+    if(BppFactor == 4U)
+    {
+      for(x = 0U; x < Width; x++)
+      {
+        *(uint32_t *)dst = ((uint32_t *)src)[x];
+        dst += StepX;
+      }
+    }
+    else
+    {
+      for(x = 0U; x < Width; x++)
+      {
+        *(uint16_t *)dst = ((uint16_t *)src)[x];
+        dst += StepX;
+      }
+    }
+  }
+}
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+
+/**
+  * @brief  Initialize the BSP DMA2D Msp.
+  * @param  hdma2d  DMA2D handle
+  * @retval None
+  */
+static void DMA2D_MspInit(DMA2D_HandleTypeDef *hdma2d)
+{
+  if(hdma2d->Instance == DMA2D)
+  {
+    /** Enable the DMA2D clock */
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+
+    /** Toggle Sw reset of DMA2D IP */
+    __HAL_RCC_DMA2D_FORCE_RESET();
+    __HAL_RCC_DMA2D_RELEASE_RESET();
+  }
+}
+
+/**
+  * @brief  De-Initializes the BSP DMA2D Msp
+  * @param  hdma2d  DMA2D handle
+  * @retval None
+  */
+static void DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d)
+{
+  if(hdma2d->Instance == DMA2D)
+  {
+    /** Disable IRQ of DMA2D IP */
+    HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+
+    /** Force and let in reset state DMA2D */
+    __HAL_RCC_DMA2D_FORCE_RESET();
+
+    /** Disable the DMA2D */
+    __HAL_RCC_DMA2D_CLK_DISABLE();
+  }
+}
+
+/**
+  * @brief  Initialize the BSP DSI Msp.
+  * @param  hdsi  DSI handle
+  * @retval None
+  */
+static void DSI_MspInit(DSI_HandleTypeDef *hdsi)
+{
+  if(hdsi->Instance == DSI)
+  {
+    /** Enable DSI Host and wrapper clocks */
+    __HAL_RCC_DSI_CLK_ENABLE();
+
+    /** Soft Reset the DSI Host and wrapper */
+    __HAL_RCC_DSI_FORCE_RESET();
+    __HAL_RCC_DSI_RELEASE_RESET();
+  }
+}
+
+/**
+  * @brief  De-Initializes the BSP DSI Msp
+  * @param  hdsi  DSI handle
+  * @retval None
+  */
+static void DSI_MspDeInit(DSI_HandleTypeDef *hdsi)
+{
+  if(hdsi->Instance == DSI)
+  {
+    /** Disable IRQ of DSI IP */
+    HAL_NVIC_DisableIRQ(DSI_IRQn);
+
+    /** Force and let in reset state the DSI Host + Wrapper IPs */
+    __HAL_RCC_DSI_FORCE_RESET();
+
+    /** Disable the DSI Host and Wrapper clocks */
+    __HAL_RCC_DSI_CLK_DISABLE();
+  }
+}
+
+/**
+  * @brief  DCS or Generic short/long write command
+  * @param  ChannelNbr Virtual channel ID
+  * @param  Reg Register to be written
+  * @param  pData pointer to a buffer of data to be write
+  * @param  Size To precise command to be used (short or long)
+  * @retval BSP status
+  */
+static int32_t DSI_IO_Write(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData, uint16_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  LCD_DSI_STATS_START();
+
+  if(Size <= 1U)
+  {
+    if(HAL_DSI_ShortWrite(&hlcd_dsi, ChannelNbr, DSI_DCS_SHORT_PKT_WRITE_P1, Reg, (uint32_t)pData[Size]) != HAL_OK)
+    {
+      ret = BSP_ERROR_BUS_FAILURE;
+    }
+    LCD_DSI_STATS_STOP(1U, 1U);
+  }
+  else if(Lcd_DsiBatch != 0U)
+  {
+    ret = LCD_DSI_PushLongWrite(ChannelNbr, DSI_DCS_LONG_PKT_WRITE, Size, (uint32_t)Reg, pData);
+    Lcd_DsiBatchPackets++;
+    LCD_DSI_STATS_STOP(1U, 0U);
+  }
+  else
+  {
+    if(HAL_DSI_LongWrite(&hlcd_dsi, ChannelNbr, DSI_DCS_LONG_PKT_WRITE, Size, (uint32_t)Reg, pData) != HAL_OK)
+    {
+      ret = BSP_ERROR_BUS_FAILURE;
+    }
+    LCD_DSI_STATS_STOP(1U, 1U);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Pushes a long write packet to the DSI command FIFO, as HAL_DSI_LongWrite()
+  *         does, but only waits for room in the FIFOs.
+  * @param  ChannelID   Virtual channel ID
+  * @param  Mode        DSI long packet data type
+  * @param  NbParams    Number of parameters following Param1
+  * @param  Param1      First payload byte (DCS command)
+  * @param  pParams     Other payload bytes
+  * @retval BSP status
+  */
+static int32_t LCD_DSI_PushLongWrite(uint32_t ChannelID, uint32_t Mode, uint32_t NbParams, uint32_t Param1, const uint8_t *pParams)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t i, fifoword = Param1;
+
+  /* Payload: Param1 then the parameters, 4 bytes per FIFO word */
+  for(i = 0U; (i < NbParams) && (ret == BSP_ERROR_NONE); i++)
+  {
+    fifoword |= (uint32_t)pParams[i] << (8U * ((i + 1U) % 4U));
+    if((((i + 2U) % 4U) == 0U) && ((i + 1U) < NbParams))
+    {
+      ret = LCD_DSI_WaitFlag(DSI_GPSR_PWRFF, 0U);
+      hlcd_dsi.Instance->GPDR = fifoword;
+      fifoword = 0U;
+    }
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    ret = LCD_DSI_WaitFlag(DSI_GPSR_PWRFF, 0U);
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    hlcd_dsi.Instance->GPDR = fifoword;
+    ret = LCD_DSI_WaitFlag(DSI_GPSR_CMDFF, 0U);
+  }
+
+  if(ret == BSP_ERROR_NONE)
+  {
+    hlcd_dsi.Instance->GHCR = Mode | (ChannelID << 6U) | (((NbParams + 1U) & 0x00FFU) << 8U) |
+                              ((((NbParams + 1U) & 0xFF00U) >> 8U) << 16U);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Waits for a DSI FIFO status flag.
+  * @param  Flag        DSI_GPSR_xxx flag
+  * @param  State       Flag value to wait for
+  * @retval BSP status
+  */
+static int32_t LCD_DSI_WaitFlag(uint32_t Flag, uint32_t State)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t tickstart;
+
+  /* The time base is only read when the flag is not already set */
+  if((hlcd_dsi.Instance->GPSR & Flag) != State)
+  {
+    tickstart = HAL_GetTick();
+    while((hlcd_dsi.Instance->GPSR & Flag) != State)
+    {
+      if((HAL_GetTick() - tickstart) > LCD_DSI_FIFO_TIMEOUT)
+      {
+        ret = BSP_ERROR_BUS_FAILURE;
+        break;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reads a register of a component on I2C4 once the pending DSI
+  *         writes are sent, keeping the order of the I2C and DSI accesses.
+  * @param  DevAddr     Device address
+  * @param  Reg         Register address
+  * @param  pData       Pointer to the read data
+  * @param  Length      Data length
+  * @retval BSP status
+  */
+static int32_t LCD_I2C4_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  int32_t ret;
+
+  if(BSP_LCD_DSI_BatchEnd(0) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    ret = BSP_I2C4_ReadReg(DevAddr, Reg, pData, Length);
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+    LCD_KeepAliveTraffic();
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes a register of a component on I2C4 once the pending DSI
+  *         writes are sent, keeping the order of the I2C and DSI accesses.
+  * @param  DevAddr     Device address
+  * @param  Reg         Register address
+  * @param  pData       Pointer to the data to write
+  * @param  Length      Data length
+  * @retval BSP status
+  */
+static int32_t LCD_I2C4_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  int32_t ret;
+
+  if(BSP_LCD_DSI_BatchEnd(0) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    ret = BSP_I2C4_WriteReg(DevAddr, Reg, pData, Length);
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+    LCD_KeepAliveTraffic();
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+/**
+  * @brief  Starts the RASPBERRYPI panel keep-alive timer.
+  * @retval None
+  */
+static void LCD_KeepAliveStart(void)
+{
+  RCC_ClkInitTypeDef clkconfig;
+  uint32_t flatency;
+  uint32_t clock;
+
+  /* The APB1 timers run at twice the APB1 clock when it is divided */
+  HAL_RCC_GetClockConfig(&clkconfig, &flatency);
+  clock = HAL_RCC_GetPCLK1Freq();
+  if(clkconfig.APB1CLKDivider != RCC_APB1_DIV1)
+  {
+    clock *= 2U;
+  }
+
+  Lcd_KeepAliveLast = HAL_GetTick();
+  Lcd_KeepAliveStats.Sent     = 0U;
+  Lcd_KeepAliveStats.Errors   = 0U;
+  Lcd_KeepAliveStats.Traffic  = 0U;
+  Lcd_KeepAliveStats.Deferred = 0U;
+  Lcd_KeepAliveStats.MaxIdle  = 0U;
+  Lcd_KeepAliveRunning = 1U;
+
+  /* One pulse 10 kHz counter, updates by software do not raise the interrupt */
+  BSP_LCD_KEEPALIVE_TIM_CLK_ENABLE();
+  BSP_LCD_KEEPALIVE_TIM->CR1  = TIM_CR1_OPM | TIM_CR1_URS;
+  BSP_LCD_KEEPALIVE_TIM->PSC  = (clock / 10000U) - 1U;
+  BSP_LCD_KEEPALIVE_TIM->SR   = 0U;
+  BSP_LCD_KEEPALIVE_TIM->DIER = TIM_DIER_UIE;
+
+  HAL_NVIC_SetPriority(BSP_LCD_KEEPALIVE_TIM_IRQn, BSP_LCD_KEEPALIVE_IT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(BSP_LCD_KEEPALIVE_TIM_IRQn);
+
+  LCD_KeepAliveArm(BSP_LCD_KEEPALIVE_PERIOD);
+}
+
+/**
+  * @brief  Stops the RASPBERRYPI panel keep-alive timer.
+  * @retval None
+  */
+static void LCD_KeepAliveStop(void)
+{
+  if(Lcd_KeepAliveRunning != 0U)
+  {
+    Lcd_KeepAliveRunning = 0U;
+    HAL_NVIC_DisableIRQ(BSP_LCD_KEEPALIVE_TIM_IRQn);
+    BSP_LCD_KEEPALIVE_TIM->CR1  = 0U;
+    BSP_LCD_KEEPALIVE_TIM->DIER = 0U;
+    BSP_LCD_KEEPALIVE_TIM->SR   = 0U;
+    BSP_LCD_KEEPALIVE_TIM_CLK_DISABLE();
+  }
+}
+
+/**
+  * @brief  Arms the keep-alive timer.
+  * @param  Delay   Delay in ms
+  * @retval None
+  */
+static void LCD_KeepAliveArm(uint32_t Delay)
+{
+  uint32_t count = Delay * 10U;
+
+  if(count > 0x10000U)
+  {
+    count = 0x10000U;
+  }
+  else if(count == 0U)
+  {
+    count = 1U;
+  }
+  else
+  {
+    /* Within the 16-bit counter */
+  }
+
+  BSP_LCD_KEEPALIVE_TIM->ARR = count - 1U;
+  BSP_LCD_KEEPALIVE_TIM->EGR = TIM_EGR_UG;
+  BSP_LCD_KEEPALIVE_TIM->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+  * @brief  Records an access to the RASPBERRYPI panel MCU, which keeps it awake.
+  * @retval None
+  */
+static void LCD_KeepAliveTraffic(void)
+{
+  uint32_t tick = HAL_GetTick();
+  uint32_t idle = tick - Lcd_KeepAliveLast;
+
+  if(Lcd_KeepAliveRunning != 0U)
+  {
+    if(idle > Lcd_KeepAliveStats.MaxIdle)
+    {
+      Lcd_KeepAliveStats.MaxIdle = idle;
+    }
+    Lcd_KeepAliveStats.Traffic++;
+  }
+  Lcd_KeepAliveLast = tick;
+}
+
+/**
+  * @brief  Keep-alive read completed, called from the I2C4 interrupt.
+  * @param  pXfer   Keep-alive transfer
+  * @retval None
+  */
+static void LCD_KeepAliveDone(BSP_I2C4_Xfer_t *pXfer)
+{
+  uint32_t tick = HAL_GetTick();
+
+  if(pXfer->Status != BSP_ERROR_NONE)
+  {
+    Lcd_KeepAliveStats.Errors++;
+  }
+  else
+  {
+    if((tick - Lcd_KeepAliveLast) > Lcd_KeepAliveStats.MaxIdle)
+    {
+      Lcd_KeepAliveStats.MaxIdle = tick - Lcd_KeepAliveLast;
+    }
+    Lcd_KeepAliveLast = tick;
+  }
+}
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+
+#if (USE_BSP_LCD_ULPM == 1)
+/**
+  * @brief  Clears the ultra low power mode counters and starts the idle timeout.
+  * @retval None
+  */
+static void LCD_UlpmStart(void)
+{
+  /* The wake latency is measured with the DWT cycle counter */
+  BSP_EnableCycleCounter();
+
+  Lcd_UlpmAsleep          = 0U;
+  Lcd_UlpmEntering        = 0U;
+  Lcd_UlpmWakeRequest     = 0U;
+  Lcd_UlpmLast            = HAL_GetTick();
+  Lcd_UlpmStats.Entries   = 0U;
+  Lcd_UlpmStats.Exits     = 0U;
+  Lcd_UlpmStats.Errors    = 0U;
+  Lcd_UlpmStats.SleepTime = 0U;
+  Lcd_UlpmStats.LastWake  = 0U;
+  Lcd_UlpmStats.MaxWake   = 0U;
+  Lcd_UlpmStats.Overruns  = 0U;
+}
+
+/**
+  * @brief  Checks that the LTDC does not stream to the DSI link.
+  * @retval 1 if the link may enter ULPM, 0 otherwise
+  */
+static uint32_t LCD_UlpmLinkIdle(void)
+{
+  uint32_t idle;
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+  if(Lcd_CmdMode.Active != 0U)
+  {
+    /* Nothing to send and no refresh on going */
+    idle = ((Lcd_CmdMode.DirtyNbr == 0U) && (Lcd_CmdMode.Busy == 0U)) ? 1U : 0U;
+  }
+  else
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+  {
+    /* Video mode: only once the LTDC is stopped */
+    idle = ((LTDC->GCR & LTDC_GCR_LTDCEN) == 0U) ? 1U : 0U;
+  }
+
+  return idle;
+}
+#endif /* USE_BSP_LCD_ULPM == 1 */
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+/**
+  * @brief  Switches the panel from video mode to adapted command mode, with the
+  *         refreshes synchronized on its tearing effect output.
+  * @param  Instance    LCD Instance
+  * @retval BSP status
+  */
+static int32_t LCD_CmdModeStart(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  DSI_CmdCfgTypeDef cmd_cfg;
+  GPIO_InitTypeDef  gpio_init_structure;
+
+  cmd_cfg.VirtualChannelID      = 0;
+  cmd_cfg.ColorCoding           = (Lcd_Ctx[Instance].PixelFormat == LCD_PIXEL_FORMAT_RGB565) ? DSI_RGB565 : DSI_RGB888;
+  cmd_cfg.CommandSize           = Lcd_Ctx[Instance].XSize;
+  cmd_cfg.TearingEffectSource   = DSI_TE_EXTERNAL;
+  cmd_cfg.TearingEffectPolarity = DSI_TE_RISING_EDGE;
+  cmd_cfg.HSPolarity            = DSI_HSYNC_ACTIVE_LOW;
+  cmd_cfg.VSPolarity            = DSI_VSYNC_ACTIVE_LOW;
+  cmd_cfg.DEPolarity            = DSI_DATA_ENABLE_ACTIVE_HIGH;
+  cmd_cfg.VSyncPol              = DSI_VSYNC_FALLING;
+  cmd_cfg.AutomaticRefresh      = DSI_AR_DISABLE;
+  cmd_cfg.TEAcknowledgeRequest  = DSI_TE_ACKNOWLEDGE_DISABLE;
+
+  /* The panel TE output drives the DSI_TE input */
+  gpio_init_structure.Pin       = LCD_TE_PIN;
+  gpio_init_structure.Mode      = GPIO_MODE_AF_PP;
+  gpio_init_structure.Pull      = GPIO_NOPULL;
+  gpio_init_structure.Speed     = GPIO_SPEED_FREQ_HIGH;
+  gpio_init_structure.Alternate = GPIO_AF13_DSI;
+  HAL_GPIO_Init(LCD_TE_GPIO_PORT, &gpio_init_structure);
+
+  Lcd_CmdMode.DirtyNbr = 0U;
+  Lcd_CmdMode.Busy     = 0U;
+  Lcd_CmdMode.Stats.TearingEvents = 0U;
+  Lcd_CmdMode.Stats.Refreshes     = 0U;
+  Lcd_CmdMode.Stats.Pixels        = 0U;
+
+#if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
+  if((HAL_DSI_RegisterCallback(&hlcd_dsi, HAL_DSI_TEARING_EFFECT_CB_ID, DSI_TearingEffectCallback) != HAL_OK) ||
+     (HAL_DSI_RegisterCallback(&hlcd_dsi, HAL_DSI_ENDOF_REFRESH_CB_ID, DSI_EndOfRefreshCallback) != HAL_OK))
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+#endif /* USE_HAL_DSI_REGISTER_CALLBACKS == 1 */
+  if(HAL_DSI_Stop(&hlcd_dsi) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if(HAL_DSI_ConfigAdaptedCommandMode(&hlcd_dsi, &cmd_cfg) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if(HAL_DSI_Start(&hlcd_dsi) != HAL_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if(HAL_DSI_ShortWrite(&hlcd_dsi, 0, DSI_DCS_SHORT_PKT_WRITE_P1, LCD_DCS_TEEON, 0x00U) != HAL_OK)
+  {
+    /* TE output on, vertical blanking only */
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    Lcd_CmdMode.Active = 1U;
+    __HAL_DSI_ENABLE_IT(&hlcd_dsi, DSI_IT_TE);
+    __HAL_DSI_ENABLE_IT(&hlcd_dsi, DSI_IT_ER);
+
+    /* Send the whole frame buffer at the first TE */
+    (void)BSP_LCD_Invalidate(Instance, 0, 0, hlcd_ltdc.LayerCfg[0].ImageWidth, hlcd_ltdc.LayerCfg[0].ImageHeight);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Stops the command mode refreshes.
+  * @retval None
+  */
+static void LCD_CmdModeStop(void)
+{
+  if(Lcd_CmdMode.Active != 0U)
+  {
+    __HAL_DSI_DISABLE_IT(&hlcd_dsi, DSI_IT_TE);
+    __HAL_DSI_DISABLE_IT(&hlcd_dsi, DSI_IT_ER);
+    Lcd_CmdMode.Active   = 0U;
+    Lcd_CmdMode.DirtyNbr = 0U;
+    Lcd_CmdMode.Busy     = 0U;
+    HAL_GPIO_DeInit(LCD_TE_GPIO_PORT, LCD_TE_PIN);
+  }
+}
+
+/**
+  * @brief  Sends the first dirty window whose DMA2D jobs are completed.
+  * @note   Called from the DSI interrupt.
+  * @param  Instance    LCD Instance
+  * @retval None
+  */
+static void LCD_CmdModeNext(uint32_t Instance)
+{
+  LCD_DirtyRect_t rect;
+  uint32_t i;
+
+#if (USE_BSP_LCD_ULPM == 1)
+  /* The windows are sent once the link is woken up */
+  if(Lcd_UlpmAsleep != 0U)
+  {
+    i = Lcd_CmdMode.DirtyNbr;
+  }
+  else
+  {
+    i = 0U;
+  }
+#else
+  i = 0U;
+#endif /* USE_BSP_LCD_ULPM == 1 */
+
+  for(; (i < Lcd_CmdMode.DirtyNbr) && (Lcd_CmdMode.Busy == 0U); i++)
+  {
+    if(LCD_DMA2D_FENCE_DONE(Lcd_CmdMode.Dirty[i].Fence))
+    {
+      rect = Lcd_CmdMode.Dirty[i];
+      Lcd_CmdMode.DirtyNbr--;
+      Lcd_CmdMode.Dirty[i] = Lcd_CmdMode.Dirty[Lcd_CmdMode.DirtyNbr];
+      Lcd_CmdMode.Busy = 1U;
+      LCD_CmdModeRefresh(Instance, &rect);
+    }
+  }
+}
+
+/**
+  * @brief  Sends a window of the frame buffer: the LTDC active area and layer
+  *         window are shrunk to the window, the DSI command size is set to its
+  *         width and the panel column and page addresses to its bounds.
+  * @param  Instance    LCD Instance
+  * @param  Rect        Window to send
+  * @retval None
+  */
+static void LCD_CmdModeRefresh(uint32_t Instance, const LCD_DirtyRect_t *Rect)
+{
+  uint32_t width  = Rect->X1 - Rect->X0 + 1U;
+  uint32_t height = Rect->Y1 - Rect->Y0 + 1U;
+  uint32_t ahbp   = hlcd_ltdc.Init.AccumulatedHBP;
+  uint32_t avbp   = hlcd_ltdc.Init.AccumulatedVBP;
+  uint32_t hfp    = hlcd_ltdc.Init.TotalWidth - hlcd_ltdc.Init.AccumulatedActiveW;
+  uint32_t vfp    = hlcd_ltdc.Init.TotalHeigh - hlcd_ltdc.Init.AccumulatedActiveH;
+  uint32_t bpp    = Lcd_Ctx[Instance].BppFactor;
+  uint8_t  columns[4], pages[4];
+
+  columns[0] = (uint8_t)(Rect->X0 >> 8);
+  columns[1] = (uint8_t)(Rect->X0 & 0xFFU);
+  columns[2] = (uint8_t)(Rect->X1 >> 8);
+  columns[3] = (uint8_t)(Rect->X1 & 0xFFU);
+  pages[0]   = (uint8_t)(Rect->Y0 >> 8);
+  pages[1]   = (uint8_t)(Rect->Y0 & 0xFFU);
+  pages[2]   = (uint8_t)(Rect->Y1 >> 8);
+  pages[3]   = (uint8_t)(Rect->Y1 & 0xFFU);
+
+  /* The LTDC registers are only reloaded while the DSI wrapper is disabled.
+     hlcd_ltdc keeps describing the whole frame buffer */
+  __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+  LTDC->AWCR = ((ahbp + width) << 16) | (avbp + height);
+  LTDC->TWCR = ((ahbp + width + hfp) << 16) | (avbp + height + vfp);
+  LTDC_Layer1->WHPCR  = (ahbp + 1U) | ((ahbp + width) << 16);
+  LTDC_Layer1->WVPCR  = (avbp + 1U) | ((avbp + height) << 16);
+  LTDC_Layer1->CFBAR  = hlcd_ltdc.LayerCfg[0].FBStartAdress + (((Rect->Y0 * hlcd_ltdc.LayerCfg[0].ImageWidth) + Rect->X0) * bpp);
+  LTDC_Layer1->CFBLR  = ((hlcd_ltdc.LayerCfg[0].ImageWidth * bpp) << 16) | ((width * bpp) + 7U);
+  LTDC_Layer1->CFBLNR = height;
+  LTDC->SRCR = LTDC_SRCR_IMR;
+  hlcd_dsi.Instance->LCCR = width;
+  __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
+
+  if((HAL_DSI_LongWrite(&hlcd_dsi, 0, DSI_DCS_LONG_PKT_WRITE, 4, LCD_DCS_CASET, columns) != HAL_OK) ||
+     (HAL_DSI_LongWrite(&hlcd_dsi, 0, DSI_DCS_LONG_PKT_WRITE, 4, LCD_DCS_PASET, pages) != HAL_OK) ||
+     (HAL_DSI_Refresh(&hlcd_dsi) != HAL_OK))
+  {
+    /* Retried at the next TE */
+    Lcd_CmdMode.Busy = 0U;
+    (void)BSP_LCD_Invalidate(Instance, Rect->X0, Rect->Y0, width, height);
+  }
+  else
+  {
+    Lcd_CmdMode.Stats.Refreshes++;
+    Lcd_CmdMode.Stats.Pixels += width * height;
+  }
+}
+
+#if (USE_HAL_DSI_REGISTER_CALLBACKS == 0)
+/**
+  * @brief  Tearing effect callback
+  * @param  hdsi  DSI handle
+  * @retval None
+  */
+void HAL_DSI_TearingEffectCallback(DSI_HandleTypeDef *hdsi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdsi);
+
+  Lcd_CmdMode.Stats.TearingEvents++;
+  LCD_CmdModeNext(0);
+}
+
+/**
+  * @brief  End of refresh callback
+  * @param  hdsi  DSI handle
+  * @retval None
+  */
+void HAL_DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdsi);
+
+  /* The other ready windows follow in the same blanking */
+  Lcd_CmdMode.Busy = 0U;
+  LCD_CmdModeNext(0);
+}
+#else
+/**
+  * @brief  Tearing effect callback
+  * @param  hdsi  DSI handle
+  * @retval None
+  */
+static void DSI_TearingEffectCallback(DSI_HandleTypeDef *hdsi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdsi);
+
+  Lcd_CmdMode.Stats.TearingEvents++;
+  LCD_CmdModeNext(0);
+}
+
+/**
+  * @brief  End of refresh callback
+  * @param  hdsi  DSI handle
+  * @retval None
+  */
+static void DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdsi);
+
+  /* The other ready windows follow in the same blanking */
+  Lcd_CmdMode.Busy = 0U;
+  LCD_CmdModeNext(0);
+}
+#endif /* USE_HAL_DSI_REGISTER_CALLBACKS == 0 */
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+
+/**
+  * @brief  DCS or Generic read command
+  * @param  ChannelNbr Virtual channel ID
+  * @param  Reg Register to be read
+  * @param  pData pointer to a buffer to store the payload of a read back operation.
+  * @param  Size  Data size to be read (in byte).
+  * @retval BSP status
+  */
+static int32_t DSI_IO_Read(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData, uint16_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if(HAL_DSI_Read(&hlcd_dsi, ChannelNbr, pData, Size, DSI_DCS_SHORT_PKT_READ, Reg, pData) != HAL_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+
+  return ret;
+}
+#if (USE_LCD_CTRL_ADV7533 > 0)
+/**
+  * @brief  Get HDMI DSI video mode timings for selected format
+  * @param  Format   Display format
+  * @param  Timing   pointer to timing structure
+  * @retval None
+  */
+static void LCD_Get_HDMI_VideoModeTiming(uint32_t Format, LCD_HDMI_Timing_t *Timing)
+{
+  if(Format == HDMI_FORMAT_720_480)
+  {
+    Timing->HSYNC = 62U;
+    Timing->HBP   = 60U;
+    Timing->HFP   = 30U;
+    Timing->VSYNC = 6U;
+    Timing->VBP   = 19U;
+    Timing->VFP   = 9U;
+    Timing->HACT  = 720U;
+    Timing->VACT  = 480U;
+  }
+  else /* (Format == HDMI_FORMAT_720_576) */
+  {
+    Timing->HSYNC = 64U;
+    Timing->HBP   = 68U;
+    Timing->HFP   = 12U;
+    Timing->VSYNC = 5U;
+    Timing->VBP   = 39U;
+    Timing->VFP   = 5U;
+    Timing->HACT  = 720U;
+    Timing->VACT  = 576U;
+  }
+  Timing->ClockLaneHS2LPTime = 0x14;
+  Timing->ClockLaneLP2HSTime = 0x14;
+  Timing->DataLaneHS2LPTime = 0x0A;
+  Timing->DataLaneLP2HSTime = 0x0A;
+  Timing->DataLaneMaxReadTime = 0x00;
+  Timing->StopWaitTime = 0x00;
+}
+
+/**
+  * @brief  LTDC initialization
   * @param  Timing   pointer to timing structure
   * @retval None
   */
-static void LCD_Get_HDMI_VideoModeTiming(uint32_t Format, LCD_HDMI_Timing_t *Timing)
+static void LTDC_HDMI_Init(LCD_HDMI_Timing_t *Timing)
+{
+  /* Background value */
+  hlcd_ltdc.Init.Backcolor.Blue = 0x00;
+  hlcd_ltdc.Init.Backcolor.Green = 0xFF;
+  hlcd_ltdc.Init.Backcolor.Red = 0xFF;
+
+  hlcd_ltdc.Init.HorizontalSync     = Timing->HSYNC - 1;
+  hlcd_ltdc.Init.AccumulatedHBP     = Timing->HSYNC + Timing->HBP - 1;
+  hlcd_ltdc.Init.AccumulatedActiveW = Timing->HSYNC + Timing->HACT + Timing->HBP - 1;
+  hlcd_ltdc.Init.TotalWidth         = Timing->HSYNC + Timing->HACT + Timing->HBP + Timing->HFP - 1;
+  hlcd_ltdc.Init.VerticalSync       = Timing->VSYNC - 1;
+  hlcd_ltdc.Init.AccumulatedVBP     = Timing->VSYNC + Timing->VBP - 1;
+  hlcd_ltdc.Init.AccumulatedActiveH = Timing->VSYNC + Timing->VACT + Timing->VBP - 1;
+  hlcd_ltdc.Init.TotalHeigh         = Timing->VSYNC + Timing->VACT + Timing->VBP + Timing->VFP - 1;
+
+  /* Polarity */
+  hlcd_ltdc.Init.HSPolarity = LTDC_HSPOLARITY_AL;
+  hlcd_ltdc.Init.VSPolarity = LTDC_VSPOLARITY_AL;
+  hlcd_ltdc.Init.DEPolarity = LTDC_DEPOLARITY_AL;
+  hlcd_ltdc.Init.PCPolarity = LTDC_PCPOLARITY_IPC;
+  hlcd_ltdc.Instance = LTDC;
+
+  /* Initialize the LTDC */
+  (void)HAL_LTDC_Init(&hlcd_ltdc);
+}
+
+/**
+  * @brief  Register Bus IOs if component ID is OK
+  * @retval error status
+  */
+static int32_t ADV7533_Probe(void)
+{
+  int32_t ret;
+  uint32_t id;
+  ADV7533_IO_t              IOCtx;
+  static ADV7533_Object_t         ADV7533Obj;
+
+  /* Configure the audio driver */
+  IOCtx.Address     = ADV7533_MAIN_I2C_ADDR;
+  IOCtx.Init        = BSP_I2C4_Init;
+  IOCtx.DeInit      = BSP_I2C4_DeInit;
+  IOCtx.ReadReg     = BSP_I2C4_ReadReg;
+  IOCtx.WriteReg    = BSP_I2C4_WriteReg;
+  IOCtx.GetTick     = BSP_GetTick;
+
+  if(ADV7533_RegisterBusIO (&ADV7533Obj, &IOCtx) != ADV7533_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else if(ADV7533_ReadID(&ADV7533Obj, &id) != ADV7533_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if(id != ADV7533_ID)
+  {
+    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+  }
+  else
+  {
+    Lcd_Drv = (LCD_Drv_t *) &ADV7533_LCD_Driver;
+    Lcd_CompObj = &ADV7533Obj;
+    if(Lcd_Drv->Init(Lcd_CompObj, 0, 0) != ADV7533_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if(ADV7533_Configure(Lcd_CompObj, 2)!= ADV7533_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  return ret;
+}
+#endif /* USE_LCD_CTRL_ADV7533 */
+
+/**
+  * @brief  Register Bus IOs if component ID is OK
+  * @retval error status
+  */
+int32_t NT35510_Probe(uint32_t ColorCoding, uint32_t Orientation)
+{
+  int32_t ret;
+  uint32_t id = 0;
+  NT35510_IO_t              IOCtx;
+  static NT35510_Object_t   NT35510Obj;
+
+  /* Configure the audio driver */
+  IOCtx.Address     = 0;
+  IOCtx.GetTick     = BSP_GetTick;
+  IOCtx.WriteReg    = DSI_IO_Write;
+  IOCtx.ReadReg     = DSI_IO_Read;
+
+  if(NT35510_RegisterBusIO(&NT35510Obj, &IOCtx) != NT35510_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    Lcd_CompObj = &NT35510Obj;
+
+    if(NT35510_ReadID(Lcd_CompObj, &id) != NT35510_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (id != NT35510_ID)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+    else
+    {
+      Lcd_PanelId = id;
+      Lcd_Drv = (LCD_Drv_t *)(void *) &NT35510_LCD_Driver;
+      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != NT35510_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else
+      {
+        ret = BSP_ERROR_NONE;
+      }
+    }
+  }
+  return ret;
+}
+
+/**
+  * @brief  Register Bus IOs if component ID is OK
+  * @retval error status
+  */
+static int32_t OTM8009A_Probe(uint32_t ColorCoding, uint32_t Orientation)
+{
+  int32_t ret;
+  uint32_t id = 0;
+  OTM8009A_IO_t              IOCtx;
+  static OTM8009A_Object_t   OTM8009AObj;
+
+  /* Configure the audio driver */
+  IOCtx.Address     = 0;
+  IOCtx.GetTick     = BSP_GetTick;
+  IOCtx.WriteReg    = DSI_IO_Write;
+  IOCtx.ReadReg     = DSI_IO_Read;
+
+  if(OTM8009A_RegisterBusIO(&OTM8009AObj, &IOCtx) != OTM8009A_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    Lcd_CompObj = &OTM8009AObj;
+
+    if(OTM8009A_ReadID(Lcd_CompObj, &id) != OTM8009A_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (id != OTM8009A_ID)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+    else
+    {
+      Lcd_PanelId = id;
+      Lcd_Drv = (LCD_Drv_t *)(void *) &OTM8009A_LCD_Driver;
+      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != OTM8009A_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else
+      {
+        ret = BSP_ERROR_NONE;
+      }
+    }
+  }
+  return ret;
+}
+
+static int32_t WAVESHARE_2P8_Probe(uint32_t ColorCoding, uint32_t Orientation)
+{
+  int32_t ret;
+  uint32_t id = 0;
+  WAVESHARE_IO_t               IOCtx;
+  static WAVESHARE_Object_t   WAVESHAREObj;
+
+  IOCtx.Address     = WAVESHARE_I2C_ADDR;
+  IOCtx.Init        = BSP_I2C4_Init;
+  IOCtx.DeInit      = BSP_I2C4_DeInit;
+  IOCtx.ReadReg     = BSP_I2C4_ReadReg;
+  IOCtx.WriteReg    = BSP_I2C4_WriteReg;
+  IOCtx.GetTick     = BSP_GetTick;
+
+  if(WAVESHARE_RegisterBusIO(&WAVESHAREObj, &IOCtx) != WAVESHARE_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    Lcd_CompObj = &WAVESHAREObj;
+
+    if(WAVESHARE_ReadID(Lcd_CompObj, &id) != WAVESHARE_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (id != WAVESHARE_2P8IN_ID)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+    else
+    {
+      Lcd_PanelId = id;
+      Lcd_Drv = (LCD_Drv_t *)(void *) &WAVESHARE_LCD_Driver;
+      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != WAVESHARE_OK)
+      {
+	ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else
+      {
+	ret = BSP_ERROR_NONE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+static int32_t RASPBERRYPI_PreProbe(uint32_t ColorCoding, uint32_t Orientation)
+{
+  int32_t ret;
+  uint32_t id = 0;
+  RASPBERRYPI_IO_t               IOCtx;
+  static RASPBERRYPI_Object_t    RASPBERRYPIObj;
+
+  IOCtx.Address     = RASPBERRYPI_I2C_ADDR;
+  IOCtx.Init        = BSP_I2C4_Init;
+  IOCtx.DeInit      = BSP_I2C4_DeInit;
+  IOCtx.ReadI2CReg  = BSP_I2C4_ReadReg;
+  IOCtx.WriteI2CReg = BSP_I2C4_WriteReg;
+  IOCtx.ReadDSIReg  = DSI_IO_Read;
+  IOCtx.WriteDSIReg = DSI_IO_Write;
+  IOCtx.GetTick     = BSP_GetTick;
+
+  if(RASPBERRYPI_RegisterBusIO(&RASPBERRYPIObj, &IOCtx) != RASPBERRYPI_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    Lcd_CompObj = &RASPBERRYPIObj;
+
+    if(RASPBERRYPI_ReadID(Lcd_CompObj, &id) != RASPBERRYPI_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (id != RASPBERRYPI_VER2_ID)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+    else
+    {
+      Lcd_PanelId = id;
+      Lcd_Drv = (LCD_Drv_t *)(void *) &RASPBERRYPI_LCD_Driver;
+      ret = RASPBERRYPI_Status(RASPBERRYPI_PreInitStart(Lcd_CompObj, ColorCoding, Orientation));
+    }
+  }
+
+  return ret;
+}
+
+
+static int32_t RASPBERRYPI_Probe(uint32_t ColorCoding, uint32_t Orientation)
+{
+  int32_t ret, status;
+  uint32_t id = 0;
+  RASPBERRYPI_IO_t               IOCtx;
+  static RASPBERRYPI_Object_t    RASPBERRYPIObj;
+
+  IOCtx.Address     = RASPBERRYPI_I2C_ADDR;
+  IOCtx.Init        = BSP_I2C4_Init;
+  IOCtx.DeInit      = BSP_I2C4_DeInit;
+  IOCtx.ReadI2CReg  = LCD_I2C4_ReadReg;
+  IOCtx.WriteI2CReg = LCD_I2C4_WriteReg;
+  IOCtx.ReadDSIReg  = DSI_IO_Read;
+  IOCtx.WriteDSIReg = DSI_IO_Write;
+  IOCtx.GetTick     = BSP_GetTick;
+
+  if(RASPBERRYPI_RegisterBusIO(&RASPBERRYPIObj, &IOCtx) != RASPBERRYPI_OK)
+  {
+    ret = BSP_ERROR_BUS_FAILURE;
+  }
+  else
+  {
+    Lcd_CompObj = &RASPBERRYPIObj;
+
+    if(RASPBERRYPI_ReadID(Lcd_CompObj, &id) != RASPBERRYPI_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (id != RASPBERRYPI_VER2_ID)
+    {
+      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    }
+    else
+    {
+      Lcd_PanelId = id;
+      Lcd_Drv = (LCD_Drv_t *)(void *) &RASPBERRYPI_LCD_Driver;
+#if (USE_BSP_LCD_DSI_BATCH == 1)
+      /* The first step of the sequence is run by RASPBERRYPI_InitStart() */
+      (void)BSP_LCD_DSI_BatchStart(0);
+      status = RASPBERRYPI_BatchEnd(RASPBERRYPI_InitStart(Lcd_CompObj, ColorCoding, Orientation));
+#else
+      status = RASPBERRYPI_InitStart(Lcd_CompObj, ColorCoding, Orientation);
+#endif /* USE_BSP_LCD_DSI_BATCH == 1 */
+      ret = RASPBERRYPI_Status(status);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Converts the status of a RASPBERRYPI bring-up sequence. While the
+  *         sequence runs, it is left to RASPBERRYPI_Continue().
+  * @param  Status  Component status
+  * @retval BSP status, BSP_ERROR_BUSY while the sequence runs
+  */
+static int32_t RASPBERRYPI_Status(int32_t Status)
 {
-  if(Format == HDMI_FORMAT_720_480)
+  int32_t ret;
+
+  if(Status == RASPBERRYPI_BUSY)
   {
-    Timing->HSYNC = 62U;
-    Timing->HBP   = 60U;
-    Timing->HFP   = 30U;
-    Timing->VSYNC = 6U;
-    Timing->VBP   = 19U;
-    Timing->VFP   = 9U;
-    Timing->HACT  = 720U;
-    Timing->VACT  = 480U;
+    Lcd_PanelProcess = RASPBERRYPI_Continue;
+    ret = BSP_ERROR_BUSY;
   }
-  else /* (Format == HDMI_FORMAT_720_576) */
+  else if(Status != RASPBERRYPI_OK)
   {
-    Timing->HSYNC = 64U;
-    Timing->HBP   = 68U;
-    Timing->HFP   = 12U;
-    Timing->VSYNC = 5U;
-    Timing->VBP   = 39U;
-    Timing->VFP   = 5U;
-    Timing->HACT  = 720U;
-    Timing->VACT  = 576U;
+    ret = BSP_ERROR_COMPONENT_FAILURE;
   }
-  Timing->ClockLaneHS2LPTime = 0x14;
-  Timing->ClockLaneLP2HSTime = 0x14;
-  Timing->DataLaneHS2LPTime = 0x0A;
-  Timing->DataLaneLP2HSTime = 0x0A;
-  Timing->DataLaneMaxReadTime = 0x00;
-  Timing->StopWaitTime = 0x00;
+  else
+  {
+    ret = BSP_ERROR_NONE;
+  }
+
+  return ret;
 }
 
 /**
-  * @brief  LTDC initialization
-  * @param  Timing   pointer to timing structure
+  * @brief  Runs the steps due of the RASPBERRYPI bring-up sequence, without
+  *         waiting for its delays.
+  * @retval BSP status, BSP_ERROR_BUSY while the sequence runs
+  */
+static int32_t RASPBERRYPI_Continue(void)
+{
+  int32_t ret;
+
+#if (USE_BSP_LCD_DSI_BATCH == 1)
+  /* Send the DSI writes run until the next delay in one batch */
+  (void)BSP_LCD_DSI_BatchStart(0);
+  ret = RASPBERRYPI_BatchEnd(RASPBERRYPI_Process(Lcd_CompObj));
+#else
+  ret = RASPBERRYPI_Process(Lcd_CompObj);
+#endif /* USE_BSP_LCD_DSI_BATCH == 1 */
+
+  return RASPBERRYPI_Status(ret);
+}
+
+#if (USE_BSP_LCD_DSI_BATCH == 1)
+/**
+  * @brief  Ends the batch of a RASPBERRYPI sequence step. When the step ends
+  *         on a delay, its packets are sent during the delay: the next I2C
+  *         access or batch end waits for them.
+  * @param  Status  Component status of the step
+  * @retval Component status
+  */
+static int32_t RASPBERRYPI_BatchEnd(int32_t Status)
+{
+  int32_t ret = Status;
+
+  if(Status == RASPBERRYPI_BUSY)
+  {
+    Lcd_DsiBatch = 0U;
+  }
+  else if(BSP_LCD_DSI_BatchEnd(0) != BSP_ERROR_NONE)
+  {
+    ret = RASPBERRYPI_ERROR;
+  }
+  else
+  {
+    /* Sequence ended, its packets are sent */
+  }
+
+  return ret;
+}
+#endif /* USE_BSP_LCD_DSI_BATCH == 1 */
+
+/**
+  * @brief  Initializes the SDRAM, once by BSP_LCD_InitEx() call.
+  * @retval BSP status
+  */
+static int32_t LCD_SdramInit(void)
+{
+#if !defined(DATA_IN_ExtSDRAM)
+  if(Lcd_SdramStatus == BSP_ERROR_BUSY)
+  {
+    Lcd_SdramStatus = BSP_SDRAM_Init(0);
+  }
+#else
+  Lcd_SdramStatus = BSP_ERROR_NONE;
+#endif /* DATA_IN_ExtSDRAM */
+
+  return Lcd_SdramStatus;
+}
+
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+/**
+  * @brief  Gets the panel detected at the previous boot.
+  * @param  Instance    LCD Instance
+  * @retval Panel descriptor or NULL if the record is not valid
+  */
+static const BSP_LCD_Panel_t *LCD_PanelCacheLoad(uint32_t Instance)
+{
+  const BSP_LCD_Panel_t *panel = NULL;
+  BSP_LCD_PanelCache_t cache;
+
+  if(BSP_LCD_PanelCacheRead(Instance, &cache) == BSP_ERROR_NONE)
+  {
+    if((cache.Magic == LCD_PANEL_CACHE_MAGIC) && (cache.Checksum == LCD_PanelCacheChecksum(&cache)))
+    {
+      panel = LCD_FindPanel((LCD_Driver_t)cache.DriverType);
+    }
+  }
+
+  return panel;
+}
+
+/**
+  * @brief  Records the detected panel, unless already recorded.
+  * @param  Instance    LCD Instance
   * @retval None
   */
-static void LTDC_HDMI_Init(LCD_HDMI_Timing_t *Timing)
+static void LCD_PanelCacheStore(uint32_t Instance)
 {
-  /* Background value */
-  hlcd_ltdc.Init.Backcolor.Blue = 0x00;
-  hlcd_ltdc.Init.Backcolor.Green = 0xFF;
-  hlcd_ltdc.Init.Backcolor.Red = 0xFF;
+  BSP_LCD_PanelCache_t cache;
 
-  hlcd_ltdc.Init.HorizontalSync     = Timing->HSYNC - 1;
-  hlcd_ltdc.Init.AccumulatedHBP     = Timing->HSYNC + Timing->HBP - 1;
-  hlcd_ltdc.Init.AccumulatedActiveW = Timing->HSYNC + Timing->HACT + Timing->HBP - 1;
-  hlcd_ltdc.Init.TotalWidth         = Timing->HSYNC + Timing->HACT + Timing->HBP + Timing->HFP - 1;
-  hlcd_ltdc.Init.VerticalSync       = Timing->VSYNC - 1;
-  hlcd_ltdc.Init.AccumulatedVBP     = Timing->VSYNC + Timing->VBP - 1;
-  hlcd_ltdc.Init.AccumulatedActiveH = Timing->VSYNC + Timing->VACT + Timing->VBP - 1;
-  hlcd_ltdc.Init.TotalHeigh         = Timing->VSYNC + Timing->VACT + Timing->VBP + Timing->VFP - 1;
+  if((BSP_LCD_PanelCacheRead(Instance, &cache) != BSP_ERROR_NONE) || (cache.Magic != LCD_PANEL_CACHE_MAGIC) ||
+     (cache.DriverType != (uint32_t)Lcd_Driver_Type) || (cache.PanelId != Lcd_PanelId) ||
+     (cache.Checksum != LCD_PanelCacheChecksum(&cache)))
+  {
+    cache.Magic      = LCD_PANEL_CACHE_MAGIC;
+    cache.DriverType = (uint32_t)Lcd_Driver_Type;
+    cache.PanelId    = Lcd_PanelId;
+    cache.Checksum   = LCD_PanelCacheChecksum(&cache);
+    (void)BSP_LCD_PanelCacheWrite(Instance, &cache);
+  }
+}
 
-  /* Polarity */
-  hlcd_ltdc.Init.HSPolarity = LTDC_HSPOLARITY_AL;
-  hlcd_ltdc.Init.VSPolarity = LTDC_VSPOLARITY_AL;
-  hlcd_ltdc.Init.DEPolarity = LTDC_DEPOLARITY_AL;
-  hlcd_ltdc.Init.PCPolarity = LTDC_PCPOLARITY_IPC;
-  hlcd_ltdc.Instance = LTDC;
+/**
+  * @brief  Computes the CRC-32 (IEEE 802.3) of a panel cache record, checksum excluded.
+  * @param  Cache       Record
+  * @retval Checksum
+  */
+static uint32_t LCD_PanelCacheChecksum(const BSP_LCD_PanelCache_t *Cache)
+{
+  uint32_t data[3];
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i, bit;
+
+  data[0] = Cache->Magic;
+  data[1] = Cache->DriverType;
+  data[2] = Cache->PanelId;
+  for(i = 0U; i < (sizeof(data) * 8U); i += 8U)
+  {
+    crc ^= (data[i / 32U] >> (i % 32U)) & 0xFFU;
+    for(bit = 0U; bit < 8U; bit++)
+    {
+      crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+  }
 
-  /* Initialize the LTDC */
-  (void)HAL_LTDC_Init(&hlcd_ltdc);
+  return ~crc;
 }
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
 
 /**
-  * @brief  Register Bus IOs if component ID is OK
-  * @retval error status
+  * @brief  Gets the descriptor of a supported panel.
+  * @param  Id     Panel controller
+  * @retval Panel descriptor or NULL if the controller is unknown
   */
-static int32_t ADV7533_Probe(void)
+static const BSP_LCD_Panel_t *LCD_FindPanel(LCD_Driver_t Id)
 {
-  int32_t ret;
-  uint32_t id;
-  ADV7533_IO_t              IOCtx;
-  static ADV7533_Object_t         ADV7533Obj;
+  const BSP_LCD_Panel_t *panel = NULL;
+  uint32_t i;
 
-  /* Configure the audio driver */
-  IOCtx.Address     = ADV7533_MAIN_I2C_ADDR;
-  IOCtx.Init        = BSP_I2C4_Init;
-  IOCtx.DeInit      = BSP_I2C4_DeInit;
-  IOCtx.ReadReg     = BSP_I2C4_ReadReg;
-  IOCtx.WriteReg    = BSP_I2C4_WriteReg;
-  IOCtx.GetTick     = BSP_GetTick;
+  for(i = 0U; i < LCD_PANELS_NBR; i++)
+  {
+    if(Lcd_Panels[i].Id == Id)
+    {
+      panel = &Lcd_Panels[i];
+      break;
+    }
+  }
+
+  return panel;
+}
+
+/**
+  * @brief  Gets the panel descriptor used to configure the DSI and LTDC.
+  * @retval Selected panel descriptor, or the default one while no panel is detected
+  */
+static const BSP_LCD_Panel_t *LCD_GetInitPanel(void)
+{
+  return (Lcd_Panel != NULL) ? Lcd_Panel : &Lcd_Panels[0];
+}
+
+/**
+  * @brief  Configures the DSI video mode timings of the panel.
+  * @param  hdsi   DSI handle
+  * @param  Width  Horizontal active width
+  * @param  Height Vertical active height
+  * @param  PixelFormat DSI color coding RGB888 or RGB565
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef LCD_DsiConfigVideoMode(DSI_HandleTypeDef *hdsi, uint32_t Width, uint32_t Height, uint32_t PixelFormat)
+{
+  const BSP_LCD_Panel_t *panel = LCD_GetInitPanel();
+  DSI_VidCfgTypeDef VidCfg;
+
+  /* Timing parameters for all Video modes */
+
+  VidCfg.VirtualChannelID = 0;
+  VidCfg.ColorCoding = PixelFormat;
+  VidCfg.LooselyPacked = panel->LooselyPacked;
+  VidCfg.Mode = DSI_VID_MODE_BURST;
+  VidCfg.PacketSize = Width;
+  VidCfg.NumberOfChunks = 0;
+  VidCfg.NullPacketSize = 0xFFFU;
+  VidCfg.HSPolarity = panel->DsiHSPolarity;
+  VidCfg.VSPolarity = panel->DsiVSPolarity;
+  VidCfg.DEPolarity = DSI_DATA_ENABLE_ACTIVE_HIGH;
+
+  /* Horizontal timings are given in lane byte clock cycles */
+  VidCfg.HorizontalSyncActive = (panel->HSYNC * panel->LaneByteClock)/panel->PixelClock;
+  VidCfg.HorizontalBackPorch = (panel->HBP * panel->LaneByteClock)/panel->PixelClock;
+  VidCfg.HorizontalLine = ((Width + panel->HSYNC + panel->HBP + panel->HFP) * panel->LaneByteClock)/panel->PixelClock;
+  VidCfg.VerticalSyncActive = panel->VSYNC;
+  VidCfg.VerticalBackPorch = panel->VBP;
+  VidCfg.VerticalFrontPorch = panel->VFP;
+  VidCfg.VerticalActive = Height;
+  VidCfg.LPCommandEnable = DSI_LP_COMMAND_ENABLE;
+  VidCfg.LPLargestPacketSize = panel->LPLargestPacketSize;
+  VidCfg.LPVACTLargestPacketSize = panel->LPVACTLargestPacketSize;
+
+  VidCfg.LPHorizontalFrontPorchEnable  = DSI_LP_HFP_ENABLE;
+  VidCfg.LPHorizontalBackPorchEnable   = DSI_LP_HBP_ENABLE;
+  VidCfg.LPVerticalActiveEnable        = DSI_LP_VACT_ENABLE;
+  VidCfg.LPVerticalFrontPorchEnable    = DSI_LP_VFP_ENABLE;
+  VidCfg.LPVerticalBackPorchEnable     = DSI_LP_VBP_ENABLE;
+  VidCfg.LPVerticalSyncActiveEnable    = DSI_LP_VSYNC_ENABLE;
+  VidCfg.FrameBTAAcknowledgeEnable     = DSI_FBTAA_DISABLE;
+
+  return HAL_DSI_ConfigVideoMode(hdsi, &VidCfg);
+}
+
+#if (USE_BSP_LCD_ORIENTATION == 1)
+/**
+  * @brief  Changes the LTDC and DSI active width and height, keeping the panel
+  *         timings and the layer 0 frame buffer.
+  * @param  Instance    LCD Instance
+  * @param  Width       Active width
+  * @param  Height      Active height
+  * @retval BSP status
+  */
+static int32_t LCD_SetActiveSize(uint32_t Instance, uint32_t Width, uint32_t Height)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint32_t dsi_pixel_format = (hlcd_ltdc.LayerCfg[0].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) ? DSI_RGB565 : DSI_RGB888;
 
-  if(ADV7533_RegisterBusIO (&ADV7533Obj, &IOCtx) != ADV7533_OK)
-  {
-    ret = BSP_ERROR_BUS_FAILURE;
-  }
-  else if(ADV7533_ReadID(&ADV7533Obj, &id) != ADV7533_OK)
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+
+#if (USE_BSP_LCD_CMD_MODE == 1)
+  if(Lcd_CmdMode.Active != 0U)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    /* The link stays in command mode, each refresh derives its LTDC window
+       from hlcd_ltdc. The LTDC registers are written with the wrapper off */
+    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+    if((MX_LTDC_Init(&hlcd_ltdc, Width, Height) != HAL_OK) ||
+       (HAL_LTDC_SetWindowSize(&hlcd_ltdc, Width, Height, 0) != HAL_OK))
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
   }
-  else if(id != ADV7533_ID)
+  else
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+  if(HAL_DSI_Stop(&hlcd_dsi) != HAL_OK)
   {
-    ret = BSP_ERROR_UNKNOWN_COMPONENT;
+    ret = BSP_ERROR_PERIPH_FAILURE;
   }
   else
   {
-    Lcd_Drv = (LCD_Drv_t *) &ADV7533_LCD_Driver;
-    Lcd_CompObj = &ADV7533Obj;
-    if(Lcd_Drv->Init(Lcd_CompObj, 0, 0) != ADV7533_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else if(ADV7533_Configure(Lcd_CompObj, 2)!= ADV7533_OK)
+    if((LCD_DsiConfigVideoMode(&hlcd_dsi, Width, Height, dsi_pixel_format) != HAL_OK) ||
+       (MX_LTDC_Init(&hlcd_ltdc, Width, Height) != HAL_OK) ||
+       (HAL_LTDC_SetWindowSize(&hlcd_ltdc, Width, Height, 0) != HAL_OK))
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      ret = BSP_ERROR_PERIPH_FAILURE;
     }
-    else
+
+    /* The video stream restarts with the new active area */
+    if(HAL_DSI_Start(&hlcd_dsi) != HAL_OK)
     {
-      ret = BSP_ERROR_NONE;
+      ret = BSP_ERROR_PERIPH_FAILURE;
     }
   }
 
   return ret;
 }
-#endif /* USE_LCD_CTRL_ADV7533 */
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
 
 /**
-  * @brief  Register Bus IOs if component ID is OK
-  * @retval error status
+  * @brief  Runs the steps of the initialization started by BSP_LCD_InitEx()
+  *         up to the next panel delay or to its end.
+  * @param  Instance    LCD Instance
+  * @retval BSP status, BSP_ERROR_BUSY while a panel delay is pending
   */
-int32_t NT35510_Probe(uint32_t ColorCoding, uint32_t Orientation)
+static int32_t LCD_InitProcess(uint32_t Instance)
 {
-  int32_t ret;
-  uint32_t id = 0;
-  NT35510_IO_t              IOCtx;
-  static NT35510_Object_t   NT35510Obj;
-
-  /* Configure the audio driver */
-  IOCtx.Address     = 0;
-  IOCtx.GetTick     = BSP_GetTick;
-  IOCtx.WriteReg    = DSI_IO_Write;
-  IOCtx.ReadReg     = DSI_IO_Read;
+  LCD_Init_t *init = &Lcd_Init[Instance];
+  MX_LTDC_LayerConfig_t config;
+  int32_t ret = BSP_ERROR_BUSY;
 
-  if(NT35510_RegisterBusIO(&NT35510Obj, &IOCtx) != NT35510_OK)
+  /* Reset pulse, timed as the one of BSP_LCD_Reset() */
+  if((init->State == LCD_INIT_RESET) && ((BSP_GetTick() - init->WaitStart) > LCD_RESET_LOW_TIME))
   {
-    ret = BSP_ERROR_BUS_FAILURE;
+    HAL_GPIO_WritePin(LCD_RESET_GPIO_PORT , LCD_RESET_PIN, GPIO_PIN_SET);/* Deactivate XRES */
+    Lcd_InitTime[Instance].PanelWait += BSP_GetTick() - init->WaitStart;
+    init->WaitStart = BSP_GetTick();
+    init->State     = LCD_INIT_RESET_END;
   }
-  else
+  if((init->State == LCD_INIT_RESET_END) && ((BSP_GetTick() - init->WaitStart) > LCD_RESET_END_TIME))
   {
-    Lcd_CompObj = &NT35510Obj;
+    Lcd_InitTime[Instance].PanelWait += BSP_GetTick() - init->WaitStart;
+    init->State = LCD_INIT_PREPROBE;
+  }
 
-    if(NT35510_ReadID(Lcd_CompObj, &id) != NT35510_OK)
+  if(init->State == LCD_INIT_PREPROBE)
+  {
+    /* Some panels (WAVESHARE) must be probed before MX_DSIHOST_DSI_Init as they
+       hold the DSI lines, causing MX_DSIHOST_DSI_Init to fail, until initialized */
+    ret = LCD_ProbePanels(Instance, 1U);
+    if(ret != BSP_ERROR_BUSY)
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      init->State = LCD_INIT_NONE;
+      if(ret != BSP_ERROR_NONE)
+      {
+        /* Couldn't auto-detect */
+        Lcd_Driver_Type = LCD_CTRL_UNKNOWN;
+        Lcd_Panel = NULL;
+        ret = BSP_ERROR_UNKNOWN_COMPONENT;
+      }
+
+      if(MX_DSIHOST_DSI_Init(&hlcd_dsi, init->Width, init->Height, init->DsiPixelFormat) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if(MX_LTDC_ClockConfig(&hlcd_ltdc) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if(MX_LTDC_Init(&hlcd_ltdc, init->Width, init->Height) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        /* DSI and LTDC initialized */
+      }
+
+      if(ret == BSP_ERROR_NONE)
+      {
+        /* Before configuring LTDC layer, ensure SDRAM is initialized */
+        if(LCD_SdramInit() != BSP_ERROR_NONE)
+        {
+          ret = BSP_ERROR_PERIPH_FAILURE;
+        }
+        else
+        {
+          /* Configure default LTDC Layer 0. This configuration can be override by calling
+          BSP_LCD_ConfigLayer() at application level */
+          config.X0          = 0;
+          config.X1          = init->Width;
+          config.Y0          = 0;
+          config.Y1          = init->Height;
+          config.PixelFormat = init->LtdcPixelFormat;
+          config.Address     = LCD_LAYER_0_ADDRESS;
+          if(MX_LTDC_ConfigLayer(&hlcd_ltdc, 0, &config) != HAL_OK)
+          {
+            ret = BSP_ERROR_PERIPH_FAILURE;
+          }
+          else
+          {
+#if (USE_BSP_LCD_CLUT == 1)
+            /* Gray ramp until the application loads its palette */
+            LCD_ConfigGrayClut(0U, init->PixelFormat);
+#endif /* USE_BSP_LCD_CLUT == 1 */
+            LCD_FrameBuffersInit(Instance);
+
+            /* Enable the DSI host and wrapper after the LTDC initialization
+            To avoid any synchronization issue, the DSI shall be started after enabling the LTDC */
+            (void)HAL_DSI_Start(&hlcd_dsi);
+
+            /* Enable the DSI BTW for read operations */
+            (void)HAL_DSI_ConfigFlowControl(&hlcd_dsi, DSI_FLOW_CONTROL_BTA);
+
+            init->State       = LCD_INIT_PROBE;
+            init->Panel       = 0U;
+            init->ProbeStatus = BSP_ERROR_NONE;
+            ret = BSP_ERROR_BUSY;
+          }
+        }
+        /* By default the reload is activated and executed immediately */
+        Lcd_Ctx[Instance].ReloadEnable = 1U;
+      }
     }
-    else if (id != NT35510_ID)
+  }
+
+  if(init->State == LCD_INIT_PROBE)
+  {
+    /* Initialize the panel controller depending on configuration of DSI */
+    ret = LCD_ProbePanels(Instance, 0U);
+    if(ret != BSP_ERROR_BUSY)
     {
-      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+      init->State = LCD_INIT_NONE;
     }
-    else
+    if(ret == BSP_ERROR_NONE)
     {
-      Lcd_Drv = (LCD_Drv_t *)(void *) &NT35510_LCD_Driver;
-      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != NT35510_OK)
+      /* The LTDC frames are now shown by the panel */
+      Lcd_InitTime[Instance].FirstFrame = BSP_GetTick();
+      Lcd_InitTime[Instance].InitTime   = Lcd_InitTime[Instance].FirstFrame - init->TickStart;
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+      LCD_PanelCacheStore(Instance);
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+      if(Lcd_Driver_Type == LCD_CTRL_RASPBERRYPI)
       {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
+        LCD_KeepAliveStart();
       }
-      else
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+#if (USE_BSP_LCD_CMD_MODE == 1)
+      if((Lcd_Driver_Type == LCD_CTRL_NT35510) || (Lcd_Driver_Type == LCD_CTRL_OTM8009A))
       {
-        ret = BSP_ERROR_NONE;
+        ret = LCD_CmdModeStart(Instance);
       }
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+#if (USE_BSP_LCD_ULPM == 1)
+      LCD_UlpmStart();
+#endif /* USE_BSP_LCD_ULPM == 1 */
+    }
+  }
+
+  if(ret != BSP_ERROR_BUSY)
+  {
+    init->Status = ret;
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+    if((init->Cached != 0U) && (ret != BSP_ERROR_NONE))
+    {
+      ret = LCD_InitRetry(Instance);
     }
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
   }
+
   return ret;
 }
 
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
 /**
-  * @brief  Register Bus IOs if component ID is OK
-  * @retval error status
+  * @brief  Restarts the initialization probing all the panels, when the panel
+  *         read from the panel cache did not answer.
+  * @param  Instance    LCD Instance
+  * @retval BSP status, BSP_ERROR_BUSY while the initialization runs
   */
-static int32_t OTM8009A_Probe(uint32_t ColorCoding, uint32_t Orientation)
+static int32_t LCD_InitRetry(uint32_t Instance)
 {
+  LCD_Init_t *init = &Lcd_Init[Instance];
+  uint32_t tickstart = init->TickStart;
   int32_t ret;
-  uint32_t id = 0;
-  OTM8009A_IO_t              IOCtx;
-  static OTM8009A_Object_t   OTM8009AObj;
-
-  /* Configure the audio driver */
-  IOCtx.Address     = 0;
-  IOCtx.GetTick     = BSP_GetTick;
-  IOCtx.WriteReg    = DSI_IO_Write;
-  IOCtx.ReadReg     = DSI_IO_Read;
 
-  if(OTM8009A_RegisterBusIO(&OTM8009AObj, &IOCtx) != OTM8009A_OK)
+  /* The cached panel was replaced: forget it and probe all the panels */
+  (void)BSP_LCD_DeInit(Instance);
+  Lcd_Driver_Type = LCD_CTRL_UNKNOWN;
+  Lcd_Panel = NULL;
+  init->ProbeAll = 1U;
+  ret = BSP_LCD_InitEx(Instance, init->Orientation, init->PixelFormat, init->Width, init->Height);
+  init->ProbeAll = 0U;
+
+  /* The boot time counts from the first BSP_LCD_InitEx() call */
+  init->TickStart = tickstart;
+  if(ret != BSP_ERROR_NONE)
   {
-    ret = BSP_ERROR_BUS_FAILURE;
+    init->Status = ret;
+  }
+  else if(init->State != LCD_INIT_NONE)
+  {
+    ret = BSP_ERROR_BUSY;
   }
   else
   {
-    Lcd_CompObj = &OTM8009AObj;
+    ret = init->Status;
+    if(ret == BSP_ERROR_NONE)
+    {
+      Lcd_InitTime[Instance].InitTime = Lcd_InitTime[Instance].FirstFrame - tickstart;
+    }
+  }
 
-    if(OTM8009A_ReadID(Lcd_CompObj, &id) != OTM8009A_OK)
+  return ret;
+}
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
+
+/**
+  * @brief  Probes the selected panel or, when auto-detecting, the supported
+  *         panels in order until one answers. A probe returning BSP_ERROR_BUSY
+  *         has started a panel sequence, run by Lcd_PanelProcess on the next
+  *         calls.
+  * @param  Instance    LCD Instance
+  * @param  PreProbe    1 to call the hooks run before the DSI host initialization,
+  *                     0 to call the ones run once the DSI host is started
+  * @retval BSP status, BSP_ERROR_BUSY while a panel sequence runs
+  */
+static int32_t LCD_ProbePanels(uint32_t Instance, uint32_t PreProbe)
+{
+  LCD_Init_t *init = &Lcd_Init[Instance];
+  const BSP_LCD_Panel_t *panel;
+  BSP_LCD_ProbeFunc_t probe;
+  uint32_t nbr = (Lcd_Panel != NULL) ? 1U : LCD_PANELS_NBR;
+  uint32_t resumed;
+  int32_t ret = BSP_ERROR_BUSY, status;
+
+  while((ret == BSP_ERROR_BUSY) && (init->Panel < nbr))
+  {
+    panel = (Lcd_Panel != NULL) ? Lcd_Panel : &Lcd_Panels[init->Panel];
+    probe = (PreProbe != 0U) ? panel->PreProbe : panel->Probe;
+    resumed = (Lcd_PanelProcess != NULL) ? 1U : 0U;
+    if(resumed != 0U)
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      status = Lcd_PanelProcess();
     }
-    else if (id != OTM8009A_ID)
+    else if(probe != NULL)
     {
-      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+      status = probe((init->PixelFormat == LCD_PIXEL_FORMAT_RGB565) ? panel->FormatRGB565 : panel->FormatRGB888,
+                     init->Orientation);
     }
     else
     {
-      Lcd_Drv = (LCD_Drv_t *)(void *) &OTM8009A_LCD_Driver;
-      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != OTM8009A_OK)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else
+      status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+
+    if(status == BSP_ERROR_BUSY)
+    {
+      /* Panel delay: resumed by the next call */
+      if(resumed == 0U)
       {
-        ret = BSP_ERROR_NONE;
+        init->WaitStart = BSP_GetTick();
       }
+      break;
     }
-  }
-  return ret;
-}
-
-static int32_t WAVESHARE_2P8_Probe(uint32_t ColorCoding, uint32_t Orientation)
-{
-  int32_t ret;
-  uint32_t id = 0;
-  WAVESHARE_IO_t               IOCtx;
-  static WAVESHARE_Object_t   WAVESHAREObj;
-
-  IOCtx.Address     = WAVESHARE_I2C_ADDR;
-  IOCtx.Init        = BSP_I2C4_Init;
-  IOCtx.DeInit      = BSP_I2C4_DeInit;
-  IOCtx.ReadReg     = BSP_I2C4_ReadReg;
-  IOCtx.WriteReg    = BSP_I2C4_WriteReg;
-  IOCtx.GetTick     = BSP_GetTick;
-
-  if(WAVESHARE_RegisterBusIO(&WAVESHAREObj, &IOCtx) != WAVESHARE_OK)
-  {
-    ret = BSP_ERROR_BUS_FAILURE;
-  }
-  else
-  {
-    Lcd_CompObj = &WAVESHAREObj;
 
-    if(WAVESHARE_ReadID(Lcd_CompObj, &id) != WAVESHARE_OK)
+    if(resumed != 0U)
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      Lcd_PanelProcess = NULL;
+      Lcd_InitTime[Instance].PanelWait += BSP_GetTick() - init->WaitStart;
     }
-    else if (id != WAVESHARE_2P8IN_ID)
+    if(status == BSP_ERROR_NONE)
     {
-      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+      Lcd_Panel = panel;
+      Lcd_Driver_Type = panel->Id;
+      ret = BSP_ERROR_NONE;
     }
     else
     {
-      Lcd_Drv = (LCD_Drv_t *)(void *) &WAVESHARE_LCD_Driver;
-      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != WAVESHARE_OK)
-      {
-	ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else
-      {
-	ret = BSP_ERROR_NONE;
-      }
+      init->ProbeStatus = (probe != NULL) ? BSP_ERROR_UNKNOWN_COMPONENT : init->ProbeStatus;
+      init->Panel++;
     }
   }
 
+  if((ret == BSP_ERROR_BUSY) && (init->Panel >= nbr))
+  {
+    /* No panel answered, or none needs this probe */
+    ret = init->ProbeStatus;
+  }
+
   return ret;
 }
 
-static int32_t RASPBERRYPI_PreProbe(uint32_t ColorCoding, uint32_t Orientation)
+/**
+  * @brief  Finds the PLL3 setting, in wide VCO range, giving the pixel clock
+  *         closest to the target. Integer DIVN3 are kept on ties.
+  * @param  PixelClock  Target pixel clock in Hz
+  * @param  Pll3        PLL3 setting
+  * @param  Achieved    Pixel clock given by the PLL3 setting, in Hz
+  * @retval BSP status
+  */
+static int32_t LCD_ComputePll3(uint64_t PixelClock, RCC_PLL3InitTypeDef *Pll3, uint32_t *Achieved)
 {
-  int32_t ret;
-  uint32_t id = 0;
-  RASPBERRYPI_IO_t               IOCtx;
-  static RASPBERRYPI_Object_t    RASPBERRYPIObj;
-
-  IOCtx.Address     = RASPBERRYPI_I2C_ADDR;
-  IOCtx.Init        = BSP_I2C4_Init;
-  IOCtx.DeInit      = BSP_I2C4_DeInit;
-  IOCtx.ReadI2CReg  = BSP_I2C4_ReadReg;
-  IOCtx.WriteI2CReg = BSP_I2C4_WriteReg;
-  IOCtx.ReadDSIReg  = DSI_IO_Read;
-  IOCtx.WriteDSIReg = DSI_IO_Write;
-  IOCtx.GetTick     = BSP_GetTick;
+  int32_t ret = BSP_ERROR_CLOCK_FAILURE;
+  uint32_t m, r, best_m = 0U, best_r = 0U;
+  uint64_t den, nf, vco, err, best_den = 1U, best_nf = 0U, best_err = 0U;
 
-  if(RASPBERRYPI_RegisterBusIO(&RASPBERRYPIObj, &IOCtx) != RASPBERRYPI_OK)
-  {
-    ret = BSP_ERROR_BUS_FAILURE;
-  }
-  else
+  for(m = 1U; m <= 63U; m++)
   {
-    Lcd_CompObj = &RASPBERRYPIObj;
-
-    if(RASPBERRYPI_ReadID(Lcd_CompObj, &id) != RASPBERRYPI_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else if (id != RASPBERRYPI_VER2_ID)
+    if(((HSE_VALUE / m) < LCD_PLL3_REF_MIN) || ((HSE_VALUE / m) > LCD_PLL3_REF_MAX))
     {
-      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+      continue;
     }
-    else
+    for(r = 1U; r <= 128U; r++)
     {
-      Lcd_Drv = (LCD_Drv_t *)(void *) &RASPBERRYPI_LCD_Driver;
-      if(RASPBERRYPI_PreInit(Lcd_CompObj, ColorCoding, Orientation) != RASPBERRYPI_OK)
+      /* Pixel clock = HSE * nf / den with nf = DIVN3 * 8192 + FRACN3 */
+      den = ((uint64_t)m * r) << LCD_PLL3_FRACN_SHIFT;
+      nf  = ((PixelClock * den) + (HSE_VALUE / 2U)) / HSE_VALUE;
+      vco = ((uint64_t)HSE_VALUE * nf) / ((uint64_t)m << LCD_PLL3_FRACN_SHIFT);
+      if((nf < (4UL << LCD_PLL3_FRACN_SHIFT)) || (nf >= (513UL << LCD_PLL3_FRACN_SHIFT)) ||
+         (vco < LCD_PLL3_VCO_MIN) || (vco > LCD_PLL3_VCO_MAX))
       {
-	ret = BSP_ERROR_COMPONENT_FAILURE;
+        continue;
       }
-      else
+
+      /* Error relative to the target is err / (den * PixelClock) */
+      err = (uint64_t)HSE_VALUE * nf;
+      err = (err > (PixelClock * den)) ? (err - (PixelClock * den)) : ((PixelClock * den) - err);
+      if((best_m == 0U) || ((err * best_den) < (best_err * den)) ||
+         (((err * best_den) == (best_err * den)) && ((nf & 8191U) == 0U) && ((best_nf & 8191U) != 0U)))
       {
-	ret = BSP_ERROR_NONE;
+        best_m   = m;
+        best_r   = r;
+        best_nf  = nf;
+        best_den = den;
+        best_err = err;
       }
     }
   }
 
-  return ret;
-}
-
-
-static int32_t RASPBERRYPI_Probe(uint32_t ColorCoding, uint32_t Orientation)
-{
-  int32_t ret;
-  uint32_t id = 0;
-  RASPBERRYPI_IO_t               IOCtx;
-  static RASPBERRYPI_Object_t    RASPBERRYPIObj;
-
-  IOCtx.Address     = RASPBERRYPI_I2C_ADDR;
-  IOCtx.Init        = BSP_I2C4_Init;
-  IOCtx.DeInit      = BSP_I2C4_DeInit;
-  IOCtx.ReadI2CReg  = BSP_I2C4_ReadReg;
-  IOCtx.WriteI2CReg = BSP_I2C4_WriteReg;
-  IOCtx.ReadDSIReg  = DSI_IO_Read;
-  IOCtx.WriteDSIReg = DSI_IO_Write;
-  IOCtx.GetTick     = BSP_GetTick;
-
-  if(RASPBERRYPI_RegisterBusIO(&RASPBERRYPIObj, &IOCtx) != RASPBERRYPI_OK)
-  {
-    ret = BSP_ERROR_BUS_FAILURE;
-  }
-  else
+  if(best_m != 0U)
   {
-    Lcd_CompObj = &RASPBERRYPIObj;
-
-    if(RASPBERRYPI_ReadID(Lcd_CompObj, &id) != RASPBERRYPI_OK)
+    Pll3->PLL3M      = best_m;
+    Pll3->PLL3N      = (uint32_t)(best_nf >> LCD_PLL3_FRACN_SHIFT);
+    Pll3->PLL3P      = 2U;
+    Pll3->PLL3Q      = 2U;
+    Pll3->PLL3R      = best_r;
+    Pll3->PLL3VCOSEL = RCC_PLL3VCOWIDE;
+    Pll3->PLL3FRACN  = (uint32_t)(best_nf & 8191U);
+    if((HSE_VALUE / best_m) < 4000000U)
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      Pll3->PLL3RGE = RCC_PLL3VCIRANGE_1;
     }
-    else if (id != RASPBERRYPI_VER2_ID)
+    else if((HSE_VALUE / best_m) < 8000000U)
     {
-      ret = BSP_ERROR_UNKNOWN_COMPONENT;
+      Pll3->PLL3RGE = RCC_PLL3VCIRANGE_2;
     }
     else
     {
-      Lcd_Drv = (LCD_Drv_t *)(void *) &RASPBERRYPI_LCD_Driver;
-      if(Lcd_Drv->Init(Lcd_CompObj, ColorCoding, Orientation) != RASPBERRYPI_OK)
-      {
-	ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else
-      {
-	ret = BSP_ERROR_NONE;
-      }
+      Pll3->PLL3RGE = RCC_PLL3VCIRANGE_3;
     }
+    *Achieved = (uint32_t)((((uint64_t)HSE_VALUE * best_nf) + (best_den / 2U)) / best_den);
+    ret = BSP_ERROR_NONE;
   }
 
   return ret;
@@ -72,14 +72,172 @@ typedef enum
   * @{
   */
 #define LCD_INSTANCES_NBR          1
+
+#ifndef USE_BSP_LCD_STATS
+#define USE_BSP_LCD_STATS          0U
+#endif /* USE_BSP_LCD_STATS */
+
+#ifndef LCD_LAYER_0_BUFFERS_NBR
+#define LCD_LAYER_0_BUFFERS_NBR    1U
+#endif /* LCD_LAYER_0_BUFFERS_NBR */
+
+#if (LCD_LAYER_0_BUFFERS_NBR < 1U) || (LCD_LAYER_0_BUFFERS_NBR > 3U)
+#error "LCD_LAYER_0_BUFFERS_NBR must be 1, 2 or 3"
+#endif
+
+#ifndef USE_BSP_LCD_BEAM_RACING
+#define USE_BSP_LCD_BEAM_RACING    0U
+#endif /* USE_BSP_LCD_BEAM_RACING */
+
+/* Number of horizontal bands of the beam racing scheduler */
+#ifndef BSP_LCD_BEAM_BANDS_NBR
+#define BSP_LCD_BEAM_BANDS_NBR     4U
+#endif /* BSP_LCD_BEAM_BANDS_NBR */
+
+/* Jobs held per band, must be a power of 2 */
+#ifndef BSP_LCD_BEAM_QUEUE_SIZE
+#define BSP_LCD_BEAM_QUEUE_SIZE    8U
+#endif /* BSP_LCD_BEAM_QUEUE_SIZE */
+
+/* Depth of the DMA2D job queue, must be a power of 2 */
+#ifndef BSP_LCD_DMA2D_QUEUE_SIZE
+#define BSP_LCD_DMA2D_QUEUE_SIZE   16U
+#endif /* BSP_LCD_DMA2D_QUEUE_SIZE */
+
+/* Maximum time (ms) spent waiting for a DMA2D fence */
+#define BSP_LCD_DMA2D_TIMEOUT      100U
+
+#ifndef USE_BSP_LCD_DSI_BATCH
+#define USE_BSP_LCD_DSI_BATCH      0U
+#endif /* USE_BSP_LCD_DSI_BATCH */
+
+#ifndef USE_BSP_LCD_PANEL_CACHE
+#define USE_BSP_LCD_PANEL_CACHE    0U
+#endif /* USE_BSP_LCD_PANEL_CACHE */
+
+#ifndef USE_BSP_LCD_KEEPALIVE
+#define USE_BSP_LCD_KEEPALIVE      0U
+#endif /* USE_BSP_LCD_KEEPALIVE */
+
+#ifndef USE_BSP_LCD_CMD_MODE
+#define USE_BSP_LCD_CMD_MODE       0U
+#endif /* USE_BSP_LCD_CMD_MODE */
+
+/* Column and page windows merging the areas to send in command mode */
+#ifndef BSP_LCD_CMD_DIRTY_NBR
+#define BSP_LCD_CMD_DIRTY_NBR      4U
+#endif /* BSP_LCD_CMD_DIRTY_NBR */
+
+#ifndef USE_BSP_LCD_ULPM
+#define USE_BSP_LCD_ULPM           0U
+#endif /* USE_BSP_LCD_ULPM */
+
+#ifndef USE_BSP_LCD_OVERLAY
+#define USE_BSP_LCD_OVERLAY        0U
+#endif /* USE_BSP_LCD_OVERLAY */
+
+#ifndef USE_BSP_LCD_ANIMATION
+#define USE_BSP_LCD_ANIMATION      0U
+#endif /* USE_BSP_LCD_ANIMATION */
+
+/* Layer register animations run at the same time */
+#ifndef BSP_LCD_ANIM_NBR
+#define BSP_LCD_ANIM_NBR           4U
+#endif /* BSP_LCD_ANIM_NBR */
+
+#ifndef USE_BSP_LCD_ROTATION
+#define USE_BSP_LCD_ROTATION       0U
+#endif /* USE_BSP_LCD_ROTATION */
+
+#ifndef USE_BSP_LCD_ORIENTATION
+#define USE_BSP_LCD_ORIENTATION    0U
+#endif /* USE_BSP_LCD_ORIENTATION */
+
+#ifndef USE_BSP_LCD_CLUT
+#define USE_BSP_LCD_CLUT           0U
+#endif /* USE_BSP_LCD_CLUT */
+
+#ifndef USE_BSP_LCD_ASSETS
+#define USE_BSP_LCD_ASSETS         0U
+#endif /* USE_BSP_LCD_ASSETS */
+
+/* Side (pixels) of the tiles rotated at once: 8 or 16, a 16x16 ARGB8888 tile
+   and its rotated copy use 2 KB of the 16 KB D-cache */
+#ifndef BSP_LCD_ROTATION_TILE
+#define BSP_LCD_ROTATION_TILE      16U
+#endif /* BSP_LCD_ROTATION_TILE */
+
+/* Buffer drawn by the application when the display is rotated */
+#ifndef LCD_ROTATION_ADDRESS
+#define LCD_ROTATION_ADDRESS       0xD0400000U
+#endif /* LCD_ROTATION_ADDRESS */
+
+/* Display idle time (ms) before the DSI link enters ULPM */
+#ifndef BSP_LCD_ULPM_TIMEOUT
+#define BSP_LCD_ULPM_TIMEOUT       500U
+#endif /* BSP_LCD_ULPM_TIMEOUT */
+
+/* Longest expected ULPM exit (us), one 60 Hz frame */
+#ifndef BSP_LCD_ULPM_WAKE_BUDGET
+#define BSP_LCD_ULPM_WAKE_BUDGET   16666U
+#endif /* BSP_LCD_ULPM_WAKE_BUDGET */
+
+/* Longest time (ms, up to 6500) without I2C access to the RASPBERRYPI panel MCU,
+   which turns the panel off when it is not accessed for a few seconds */
+#ifndef BSP_LCD_KEEPALIVE_PERIOD
+#define BSP_LCD_KEEPALIVE_PERIOD   2000U
+#endif /* BSP_LCD_KEEPALIVE_PERIOD */
+
+#ifndef BSP_LCD_KEEPALIVE_IT_PRIORITY
+#define BSP_LCD_KEEPALIVE_IT_PRIORITY  15U
+#endif /* BSP_LCD_KEEPALIVE_IT_PRIORITY */
+
+/* Keep-alive timer, its interrupt handler shall call BSP_LCD_KeepAlive_IRQHandler() */
+#define BSP_LCD_KEEPALIVE_TIM                TIM7
+#define BSP_LCD_KEEPALIVE_TIM_IRQn           TIM7_IRQn
+#define BSP_LCD_KEEPALIVE_TIM_CLK_ENABLE()   __HAL_RCC_TIM7_CLK_ENABLE()
+#define BSP_LCD_KEEPALIVE_TIM_CLK_DISABLE()  __HAL_RCC_TIM7_CLK_DISABLE()
+
+/* Address of the panel cache record written by BSP_LCD_PanelCacheWrite() */
+#ifndef BSP_LCD_PANEL_CACHE_ADDRESS
+#define BSP_LCD_PANEL_CACHE_ADDRESS  D3_BKPSRAM_BASE
+#endif /* BSP_LCD_PANEL_CACHE_ADDRESS */
+
+/* Highest DSI lane byte clock (kHz) selected by BSP_LCD_ComputeClocks() */
+#ifndef BSP_LCD_DSI_LANE_BYTE_CLOCK_MAX
+#define BSP_LCD_DSI_LANE_BYTE_CLOCK_MAX  125000U
+#endif /* BSP_LCD_DSI_LANE_BYTE_CLOCK_MAX */
+
 /**
   * @brief  HDMI Format
   */
 #define HDMI_FORMAT_720_480              0x00U /* 720_480 format choice of HDMI display */
 #define HDMI_FORMAT_720_576              0x01U /* 720_576 format choice of HDMI display */
 
+#define LCD_ORIENTATION_PORTRAIT         0x00U /* Portrait orientation choice of LCD screen               */
 #define LCD_ORIENTATION_LANDSCAPE        0x01U /* Landscape orientation choice of LCD screen              */
 
+#define LCD_ROTATION_0                   0x00U /* Draw to the scanned out buffer                          */
+#define LCD_ROTATION_90                  0x01U /* Drawn image rotated 90 degrees clockwise on the panel   */
+#define LCD_ROTATION_180                 0x02U /* Drawn image rotated 180 degrees on the panel            */
+#define LCD_ROTATION_270                 0x03U /* Drawn image rotated 270 degrees clockwise on the panel  */
+
+/* Color written as the CLUT index Index (0..255) by the draw functions to an
+   L8 or AL88 layer, (Index * 17) for the 16 indexes of an AL44 layer */
+#define LCD_COLOR_INDEX(Index)           (0xFF000000U | ((uint32_t)(Index) * 0x010101U))
+
+/* Asset packs written by Tools/lcd_assets.py */
+#define BSP_LCD_ASSET_MAGIC              0x4144434CU  /* "LCDA"                                */
+#define BSP_LCD_ASSET_VERSION            1U
+#define BSP_LCD_ASSET_ARGB8888           0x00U        /* Pixel formats, same values as DMA2D_INPUT_xxx */
+#define BSP_LCD_ASSET_RGB565             0x02U
+#define BSP_LCD_ASSET_L8                 0x05U
+#define BSP_LCD_ASSET_A8                 0x09U
+#define BSP_LCD_ASSET_RAW                0x00U        /* Pixels stored as they are drawn        */
+#define BSP_LCD_ASSET_RLE                0x01U        /* Run length encoded pixels              */
+#define BSP_LCD_ASSET_LZ4                0x02U        /* LZ4 block                              */
+#define BSP_LCD_ASSET_OPAQUE             0x0001U      /* All the pixels have a 0xFF alpha       */
+
 #define LCD_DEFAULT_WIDTH                800
 #define LCD_DEFAULT_HEIGHT               480
 
@@ -229,6 +387,267 @@ typedef struct
 
 #define BSP_LCD_LayerConfig_t MX_LTDC_LayerConfig_t
 
+/* Panel probe hook, ColorCoding is the panel controller pixel format */
+typedef int32_t (*BSP_LCD_ProbeFunc_t)(uint32_t ColorCoding, uint32_t Orientation);
+
+/**
+  * @brief  DSI panel descriptor consumed by the generic initialization code.
+  *         Timings are in pixel clocks and lines. The DSI horizontal timings
+  *         are scaled from pixel clocks to lane byte clocks by
+  *         LaneByteClock / PixelClock.
+  *         PreProbe is called before the DSI host initialization and Probe
+  *         once the DSI host is started, either may be NULL.
+  */
+typedef struct
+{
+  LCD_Driver_t        Id;
+  uint16_t            HSYNC;                    /* Horizontal synchronization       */
+  uint16_t            HBP;                      /* Horizontal back porch            */
+  uint16_t            HFP;                      /* Horizontal front porch           */
+  uint16_t            VSYNC;                    /* Vertical synchronization         */
+  uint16_t            VBP;                      /* Vertical back porch              */
+  uint16_t            VFP;                      /* Vertical front porch             */
+  uint32_t            LaneByteClock;            /* DSI lane byte clock in kHz       */
+  uint32_t            PixelClock;               /* LTDC pixel clock in kHz          */
+  uint32_t            NumberOfLanes;            /* DSI_ONE_DATA_LANE or DSI_TWO_DATA_LANES */
+  uint32_t            TXEscapeCkdiv;            /* Lane byte clock to escape clock divider */
+  DSI_PLLInitTypeDef  DsiPll;                   /* DSI PLL NDIV, IDF and ODF        */
+  RCC_PLL3InitTypeDef Pll3;                     /* PLL3 feeding the LTDC pixel clock */
+  uint32_t            LooselyPacked;            /* DSI_LOOSELY_PACKED_xxx           */
+  uint32_t            LPLargestPacketSize;      /* LP packet size in blanking, in bytes */
+  uint32_t            LPVACTLargestPacketSize;  /* LP packet size in VACT, in bytes */
+  uint32_t            DsiHSPolarity;            /* DSI_HSYNC_ACTIVE_xxx             */
+  uint32_t            DsiVSPolarity;            /* DSI_VSYNC_ACTIVE_xxx             */
+  uint32_t            LtdcHSPolarity;           /* LTDC_HSPOLARITY_xxx              */
+  uint32_t            LtdcVSPolarity;           /* LTDC_VSPOLARITY_xxx              */
+  uint32_t            FormatRGB565;             /* Controller RGB565 color coding   */
+  uint32_t            FormatRGB888;             /* Controller RGB888 color coding   */
+  BSP_LCD_ProbeFunc_t PreProbe;
+  BSP_LCD_ProbeFunc_t Probe;
+} BSP_LCD_Panel_t;
+
+/**
+  * @brief  Boot timings of the initialization started by BSP_LCD_InitEx(), in ms
+  */
+typedef struct
+{
+  uint32_t FirstFrame;   /* Tick at which the panel shows the first LTDC frame */
+  uint32_t InitTime;     /* From BSP_LCD_InitEx() to the first frame           */
+  uint32_t PanelWait;    /* Time spent in the non-blocking reset and panel delays */
+  uint32_t IdleWork;     /* Part of PanelWait used by the SDRAM init and the idle callback */
+} BSP_LCD_InitTime_t;
+
+/**
+  * @brief  Panel detected at the previous boot
+  */
+typedef struct
+{
+  uint32_t Magic;        /* Record tag                                         */
+  uint32_t DriverType;   /* LCD_Driver_t of the panel                          */
+  uint32_t PanelId;      /* ID read from the panel controller                  */
+  uint32_t Checksum;     /* CRC-32 of the fields above                         */
+} BSP_LCD_PanelCache_t;
+
+/**
+  * @brief  RASPBERRYPI panel keep-alive counters
+  */
+typedef struct
+{
+  uint32_t Sent;         /* Keep-alive reads queued to the panel MCU             */
+  uint32_t Errors;       /* Keep-alive reads that could not be queued or failed  */
+  uint32_t Traffic;      /* Other panel MCU accesses, each one acts as keep-alive */
+  uint32_t Deferred;     /* Timer expiries postponed by that traffic             */
+  uint32_t MaxIdle;      /* Longest time (ms) seen between panel MCU accesses    */
+} BSP_LCD_KeepAlive_Stats_t;
+
+/**
+  * @brief  Command mode counters
+  */
+typedef struct
+{
+  uint32_t TearingEvents;  /* TE signals received from the panel             */
+  uint32_t Refreshes;      /* Windows sent to the panel                      */
+  uint32_t Pixels;         /* Pixels sent to the panel                       */
+} BSP_LCD_CmdMode_Stats_t;
+
+/**
+  * @brief  DSI ultra low power mode counters
+  */
+typedef struct
+{
+  uint32_t Entries;        /* ULPM entries                                   */
+  uint32_t Exits;          /* ULPM exits                                     */
+  uint32_t Errors;         /* ULPM entries or exits failed                   */
+  uint32_t SleepTime;      /* Time spent in ULPM (ms)                        */
+  uint32_t LastWake;       /* Latency of the last wake, from its request (us)*/
+  uint32_t MaxWake;        /* Longest wake latency (us)                      */
+  uint32_t Overruns;       /* Wakes longer than BSP_LCD_ULPM_WAKE_BUDGET     */
+} BSP_LCD_Ulpm_Stats_t;
+
+/**
+  * @brief  LTDC layer register interpolated by an animation
+  */
+typedef enum
+{
+  BSP_LCD_ANIM_ALPHA = 0,    /* Constant alpha, From and To in 0..255            */
+  BSP_LCD_ANIM_POSITION,     /* Window position, X in From/To, Y in FromY/ToY    */
+  BSP_LCD_ANIM_ADDRESS       /* Frame buffer start address                       */
+} BSP_LCD_AnimProperty_t;
+
+typedef enum
+{
+  BSP_LCD_ANIM_LINEAR = 0,
+  BSP_LCD_ANIM_EASE_IN,      /* Starts slowly, quadratic                         */
+  BSP_LCD_ANIM_EASE_OUT,     /* Ends slowly, quadratic                           */
+  BSP_LCD_ANIM_EASE_IN_OUT   /* Starts and ends slowly, smoothstep               */
+} BSP_LCD_AnimEasing_t;
+
+typedef struct
+{
+  uint32_t               LayerIndex;
+  BSP_LCD_AnimProperty_t Property;
+  BSP_LCD_AnimEasing_t   Easing;
+  uint32_t               Frames;   /* Duration, To is shown Frames frames after From */
+  uint32_t               From;
+  uint32_t               To;
+  uint32_t               FromY;
+  uint32_t               ToY;
+} BSP_LCD_Anim_t;
+
+/**
+  * @brief  Software rotation counters
+  */
+typedef struct
+{
+  uint32_t Flushes;        /* BSP_LCD_RotationFlush() calls                  */
+  uint32_t Tiles;          /* Tiles rotated to the scanned out buffer        */
+  uint64_t Pixels;         /* Pixels rotated                                 */
+  uint64_t Cycles;         /* CPU cycles spent rotating the tiles            */
+  uint32_t PixelsPerSec;   /* Throughput derived from Pixels, Cycles and HCLK */
+} BSP_LCD_Rotation_Stats_t;
+
+/**
+  * @brief  DMA2D job pushed to the BSP DMA2D queue.
+  *         Init, Foreground and Background follow the HAL DMA2D structures.
+  *         Source is the color in DMA2D_R2M mode and the foreground address
+  *         otherwise. Source2 is the background address (or color for
+  *         DMA2D_M2M_BLEND_BG) of the blending modes. When pCLUT is not NULL,
+  *         its CLUTSize ARGB8888 colors are loaded to the foreground CLUT
+  *         before the transfer (L8, AL44, AL88 ... foreground).
+  */
+typedef struct
+{
+  DMA2D_InitTypeDef     Init;
+  DMA2D_LayerCfgTypeDef Foreground;
+  DMA2D_LayerCfgTypeDef Background;
+  uint32_t              Source;
+  uint32_t              Source2;
+  uint32_t              Destination;
+  uint32_t              Width;
+  uint32_t              Height;
+  const uint32_t       *pCLUT;
+  uint32_t              CLUTSize;
+} BSP_LCD_DMA2D_Job_t;
+
+/**
+  * @brief  Indexed color image drawn by BSP_LCD_DrawIndexed(). The pixels are
+  *         CLUT indexes, with their own alpha in the AL44 and AL88 formats.
+  */
+typedef struct
+{
+  const uint8_t  *pData;        /* Width pixels per line, readable by the DMA2D    */
+  const uint32_t *pCLUT;        /* ARGB8888 colors of the indexes, idem            */
+  uint32_t        CLUTSize;     /* Number of colors, up to 256 (16 for AL44)       */
+  uint32_t        PixelFormat;  /* LCD_PIXEL_FORMAT_L8, _AL44 or _AL88             */
+  uint32_t        Width;
+  uint32_t        Height;
+} BSP_LCD_IndexedImage_t;
+
+/**
+  * @brief  Asset pack directory, followed by Count entries sorted by Id. The
+  *         offsets are from the directory start, the pixels and the CLUTs
+  *         start on a 32-byte boundary.
+  */
+typedef struct
+{
+  uint32_t Magic;               /* BSP_LCD_ASSET_MAGIC                             */
+  uint16_t Version;             /* BSP_LCD_ASSET_VERSION                           */
+  uint16_t Count;               /* Number of assets                                */
+  uint32_t Size;                /* Pack size in bytes                              */
+  uint32_t Reserved;
+} BSP_LCD_AssetDir_t;
+
+typedef struct
+{
+  uint32_t Id;
+  uint32_t Offset;              /* Stored pixels                                   */
+  uint32_t StoredSize;          /* Stored pixels size in bytes                     */
+  uint16_t Width;
+  uint16_t Height;
+  uint32_t Stride;              /* Bytes per line of the decoded pixels            */
+  uint8_t  Format;              /* BSP_LCD_ASSET_ARGB8888, _RGB565, _L8 or _A8     */
+  uint8_t  Compression;         /* BSP_LCD_ASSET_RAW, _RLE or _LZ4                 */
+  uint16_t Flags;               /* BSP_LCD_ASSET_OPAQUE                            */
+  uint32_t CLUTOffset;          /* ARGB8888 colors of an L8 asset                  */
+  uint16_t CLUTSize;
+  uint16_t Reserved;
+} BSP_LCD_AssetEntry_t;
+
+/**
+  * @brief  Asset found by BSP_LCD_AssetFind(). pData points to the stored
+  *         pixels, which are drawn in place once BSP_LCD_AssetLoad() decoded
+  *         them (Compression is then BSP_LCD_ASSET_RAW).
+  */
+typedef struct
+{
+  uint32_t        Id;
+  uint32_t        Format;
+  uint32_t        Width;
+  uint32_t        Height;
+  uint32_t        Stride;
+  uint32_t        Flags;
+  uint32_t        Compression;
+  const uint8_t  *pData;
+  uint32_t        DataSize;     /* Stored size, Stride * Height once decoded       */
+  const uint32_t *pCLUT;
+  uint32_t        CLUTSize;
+} BSP_LCD_Asset_t;
+
+/* Sequence number of a queued DMA2D job */
+typedef uint32_t BSP_LCD_Fence_t;
+
+#if (USE_BSP_LCD_STATS == 1)
+typedef enum
+{
+  BSP_LCD_STATS_FILL_RECT = 0,
+  BSP_LCD_STATS_DRAW_HLINE,
+  BSP_LCD_STATS_DRAW_VLINE,
+  BSP_LCD_STATS_DRAW_BITMAP,
+  BSP_LCD_STATS_FILL_RGB_RECT,
+  BSP_LCD_STATS_WRITE_PIXEL,
+  BSP_LCD_STATS_DRAW_ALPHA,
+  BSP_LCD_STATS_DRAW_INDEXED,
+  BSP_LCD_STATS_DRAW_ASSET,
+  BSP_LCD_STATS_NBR
+} BSP_LCD_StatsId_t;
+
+typedef struct
+{
+  uint32_t Calls;          /* Number of primitive calls                        */
+  uint64_t Pixels;         /* Number of pixels written by the primitive        */
+  uint64_t Cycles;         /* CPU cycles spent in the call                     */
+  uint32_t PixelsPerSec;   /* Throughput derived from Pixels, Cycles and HCLK  */
+} BSP_LCD_Stats_t;
+
+typedef struct
+{
+  uint32_t Packets;        /* DSI write packets                                */
+  uint32_t Waits;          /* Waits for the DSI command FIFO to drain          */
+  uint32_t Cycles;         /* CPU cycles spent in the writes and waits         */
+  uint32_t Time;           /* Same in us                                       */
+} BSP_LCD_DSI_Stats_t;
+#endif /* USE_BSP_LCD_STATS == 1 */
+
 #if ((USE_HAL_LTDC_REGISTER_CALLBACKS == 1) || (USE_HAL_DSI_REGISTER_CALLBACKS == 1))
 typedef struct
 {
@@ -266,10 +685,42 @@ extern void               *Lcd_CompObj;
 /* Initialization APIs */
 int32_t BSP_LCD_Init(uint32_t Instance, uint32_t Orientation);
 int32_t BSP_LCD_InitEx(uint32_t Instance, uint32_t Orientation, uint32_t PixelFormat, uint32_t Width, uint32_t Height);
+int32_t BSP_LCD_InitPoll(uint32_t Instance);
+int32_t BSP_LCD_InitWait(uint32_t Instance);
 #if (USE_LCD_CTRL_ADV7533 > 0)
 int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format);
 #endif /* (USE_LCD_CTRL_ADV7533 > 0) */
 int32_t BSP_LCD_DeInit(uint32_t Instance);
+int32_t BSP_LCD_SetPanel(uint32_t Instance, const BSP_LCD_Panel_t *Panel);
+int32_t BSP_LCD_GetPanel(uint32_t Instance, const BSP_LCD_Panel_t **Panel);
+int32_t BSP_LCD_GetInitTime(uint32_t Instance, BSP_LCD_InitTime_t *InitTime);
+void    BSP_LCD_InitIdleCallback(uint32_t Instance);
+int32_t BSP_LCD_DSI_BatchStart(uint32_t Instance);
+int32_t BSP_LCD_DSI_BatchEnd(uint32_t Instance);
+#if (USE_BSP_LCD_PANEL_CACHE == 1)
+int32_t BSP_LCD_PanelCacheRead(uint32_t Instance, BSP_LCD_PanelCache_t *Cache);
+int32_t BSP_LCD_PanelCacheWrite(uint32_t Instance, const BSP_LCD_PanelCache_t *Cache);
+#endif /* USE_BSP_LCD_PANEL_CACHE == 1 */
+#if (USE_BSP_LCD_CMD_MODE == 1)
+int32_t BSP_LCD_Invalidate(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+int32_t BSP_LCD_GetCmdModeStats(uint32_t Instance, BSP_LCD_CmdMode_Stats_t *Stats);
+void    BSP_LCD_DSI_IRQHandler(uint32_t Instance);
+#endif /* USE_BSP_LCD_CMD_MODE == 1 */
+#if (USE_BSP_LCD_OVERLAY == 1)
+int32_t BSP_LCD_ConfigOverlay(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t PixelFormat);
+int32_t BSP_LCD_SetOverlayPosition(uint32_t Instance, uint32_t Xpos, uint32_t Ypos);
+#endif /* USE_BSP_LCD_OVERLAY == 1 */
+#if (USE_BSP_LCD_ULPM == 1)
+int32_t BSP_LCD_Idle(uint32_t Instance);
+int32_t BSP_LCD_Wake(uint32_t Instance);
+int32_t BSP_LCD_GetUlpmStats(uint32_t Instance, BSP_LCD_Ulpm_Stats_t *Stats);
+#endif /* USE_BSP_LCD_ULPM == 1 */
+#if (USE_BSP_LCD_KEEPALIVE == 1)
+int32_t BSP_LCD_GetKeepAliveStats(uint32_t Instance, BSP_LCD_KeepAlive_Stats_t *Stats);
+void    BSP_LCD_KeepAlive_IRQHandler(uint32_t Instance);
+#endif /* USE_BSP_LCD_KEEPALIVE == 1 */
+int32_t BSP_LCD_ComputeClocks(uint32_t Instance, BSP_LCD_Panel_t *Panel, uint32_t Width, uint32_t Height, uint32_t PixelFormat,
+                              uint32_t RefreshRate, uint32_t *HorizontalLine, uint32_t *AchievedRate);
 
 /* Register Callbacks APIs */
 #if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
@@ -295,6 +746,10 @@ int32_t BSP_LCD_SetBrightness(uint32_t Instance, uint32_t Brightness);
 int32_t BSP_LCD_GetBrightness(uint32_t Instance, uint32_t *Brightness);
 int32_t BSP_LCD_GetXSize(uint32_t Instance, uint32_t *XSize);
 int32_t BSP_LCD_GetYSize(uint32_t Instance, uint32_t *YSize);
+#if (USE_BSP_LCD_ORIENTATION == 1)
+int32_t BSP_LCD_SetOrientation(uint32_t Instance, uint32_t Orientation);
+int32_t BSP_LCD_GetOrientation(uint32_t Instance, uint32_t *Orientation);
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
 
 /* LCD generic APIs: Draw operations. This list of APIs is required for
    lcd gfx utilities */
@@ -313,7 +768,66 @@ HAL_StatusTypeDef MX_LTDC_Init(LTDC_HandleTypeDef *hltdc, uint32_t Width, uint32
 HAL_StatusTypeDef MX_LTDC_ClockConfig2(LTDC_HandleTypeDef *hltdc);
 HAL_StatusTypeDef MX_DSIHOST_DSI_Init(DSI_HandleTypeDef *hdsi, uint32_t Width, uint32_t Height, uint32_t PixelFormat);
 int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height);
+int32_t BSP_LCD_DrawAlpha(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, const uint8_t *pAlpha, uint32_t Width, uint32_t Height, uint32_t Color, uint32_t BackColor);
 int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat);
+int32_t BSP_LCD_GetFrameBuffer(uint32_t Instance, uint32_t *Address);
+int32_t BSP_LCD_FrameBufferDrawn(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+
+/* LCD frame buffers APIs */
+int32_t BSP_LCD_SwapBuffers(uint32_t Instance, uint32_t *Address);
+void    BSP_LCD_LTDC_IRQHandler(uint32_t Instance);
+
+#if (USE_BSP_LCD_ROTATION == 1)
+/* LCD software rotation APIs */
+int32_t BSP_LCD_SetRotation(uint32_t Instance, uint32_t Rotation);
+int32_t BSP_LCD_RotationInvalidate(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+int32_t BSP_LCD_RotationFlush(uint32_t Instance);
+int32_t BSP_LCD_GetRotationStats(uint32_t Instance, BSP_LCD_Rotation_Stats_t *Stats);
+#endif /* USE_BSP_LCD_ROTATION == 1 */
+
+#if (USE_BSP_LCD_CLUT == 1)
+/* LCD indexed color APIs */
+int32_t BSP_LCD_SetCLUT(uint32_t Instance, uint32_t LayerIndex, const uint32_t *pCLUT, uint32_t Size);
+int32_t BSP_LCD_SwapCLUT(uint32_t Instance, uint32_t LayerIndex, const uint32_t *pCLUT, uint32_t Size);
+int32_t BSP_LCD_DrawIndexed(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, const BSP_LCD_IndexedImage_t *Image);
+#endif /* USE_BSP_LCD_CLUT == 1 */
+
+#if (USE_BSP_LCD_ASSETS == 1)
+/* LCD asset pack APIs */
+int32_t BSP_LCD_AssetFind(const void *pPack, uint32_t Id, BSP_LCD_Asset_t *Asset);
+int32_t BSP_LCD_AssetLoad(BSP_LCD_Asset_t *Asset, uint8_t *pBuffer, uint32_t Size);
+int32_t BSP_LCD_DrawAsset(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, const BSP_LCD_Asset_t *Asset, uint32_t Color);
+#endif /* USE_BSP_LCD_ASSETS == 1 */
+
+#if (USE_BSP_LCD_ANIMATION == 1)
+/* LCD layer animation APIs */
+int32_t BSP_LCD_AnimStart(uint32_t Instance, const BSP_LCD_Anim_t *Anim, uint32_t *Id);
+int32_t BSP_LCD_AnimStop(uint32_t Instance, uint32_t Id);
+int32_t BSP_LCD_AnimWait(uint32_t Instance, uint32_t Timeout);
+void    BSP_LCD_AnimCallback(uint32_t Instance, uint32_t Id);
+#endif /* USE_BSP_LCD_ANIMATION == 1 */
+
+/* LCD scan position APIs */
+int32_t BSP_LCD_GetScanline(uint32_t Instance, uint32_t *Line);
+#if (USE_BSP_LCD_BEAM_RACING == 1)
+int32_t BSP_LCD_BeamStart(uint32_t Instance);
+int32_t BSP_LCD_BeamStop(uint32_t Instance);
+int32_t BSP_LCD_BeamSubmit(uint32_t Instance, const BSP_LCD_DMA2D_Job_t *Job);
+int32_t BSP_LCD_BeamSync(uint32_t Instance);
+#endif /* USE_BSP_LCD_BEAM_RACING == 1 */
+
+/* LCD DMA2D queue APIs */
+int32_t BSP_LCD_DMA2D_Submit(uint32_t Instance, const BSP_LCD_DMA2D_Job_t *Job, BSP_LCD_Fence_t *Fence);
+int32_t BSP_LCD_DMA2D_WaitFence(uint32_t Instance, BSP_LCD_Fence_t Fence, uint32_t Timeout);
+int32_t BSP_LCD_DMA2D_Sync(uint32_t Instance);
+void    BSP_LCD_DMA2D_IRQHandler(uint32_t Instance);
+
+#if (USE_BSP_LCD_STATS == 1)
+/* LCD draw statistics APIs */
+int32_t BSP_LCD_ResetStats(uint32_t Instance);
+int32_t BSP_LCD_GetStats(uint32_t Instance, BSP_LCD_StatsId_t Primitive, BSP_LCD_Stats_t *Stats);
+int32_t BSP_LCD_GetDsiStats(uint32_t Instance, BSP_LCD_DSI_Stats_t *Stats);
+#endif /* USE_BSP_LCD_STATS == 1 */
 /**
   * @}
   */
@@ -323,7 +837,6 @@ int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat);
   * @{
   */
 /* Legacy defines */
-#define LCD_ORIENTATION_PORTRAIT         0x00U /* Portrait orientation choice of LCD screen               */
 #define BSP_LCD_Relaod   BSP_LCD_Reload
 /**
   * @}
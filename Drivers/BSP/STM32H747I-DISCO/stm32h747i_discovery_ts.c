@@ -50,6 +50,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h747i_discovery_ts.h"
 #include "stm32h747i_discovery_bus.h"
+#if (USE_BSP_LCD_ULPM == 1) || (USE_BSP_LCD_ORIENTATION == 1)
+#include "stm32h747i_discovery_lcd.h"
+#endif /* (USE_BSP_LCD_ULPM == 1) || (USE_BSP_LCD_ORIENTATION == 1) */
 
 
 /** @addtogroup BSP
@@ -84,6 +87,9 @@ typedef void (* BSP_EXTI_LineCallback) (void);
   */
 static int32_t FT6X06_Probe(uint32_t Instance);
 static void TS_EXTI_Callback(void);
+#if (USE_BSP_LCD_ORIENTATION == 1)
+static void TS_FollowLcdOrientation(uint32_t Instance);
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
 /**
   * @}
   */
@@ -93,6 +99,10 @@ static void TS_EXTI_Callback(void);
   */
 static EXTI_HandleTypeDef hts_exti[TS_INSTANCES_NBR] = {0};
 static TS_Drv_t           *Ts_Drv = NULL;
+#if (USE_BSP_LCD_ORIENTATION == 1)
+/* LCD orientation the TS context was set up for */
+static uint32_t           Ts_LcdOrientation[TS_INSTANCES_NBR];
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
 
 /**
   * @}
@@ -140,6 +150,12 @@ int32_t BSP_TS_Init(uint32_t Instance, TS_Init_t *TS_Init)
       Ts_Ctx[Instance].Height            = TS_Init->Height;
       Ts_Ctx[Instance].Orientation       = TS_Init->Orientation;
       Ts_Ctx[Instance].Accuracy          = TS_Init->Accuracy;
+#if (USE_BSP_LCD_ORIENTATION == 1)
+      if(BSP_LCD_GetOrientation(0, &Ts_LcdOrientation[Instance]) != BSP_ERROR_NONE)
+      {
+        Ts_LcdOrientation[Instance] = LCD_ORIENTATION_LANDSCAPE;
+      }
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
 
       if (Ts_Drv->GetCapabilities(Ts_CompObj[Instance], &Capabilities) < 0)
       {
@@ -337,6 +353,13 @@ int32_t BSP_TS_GetState(uint32_t Instance, TS_State_t *TS_State)
     }/* Check and update the number of touches active detected */
     else if(state.TouchDetected != 0U)
     {
+#if (USE_BSP_LCD_ULPM == 1)
+      /* A touch will likely update the display */
+      (void)BSP_LCD_Wake(0);
+#endif /* USE_BSP_LCD_ULPM == 1 */
+#if (USE_BSP_LCD_ORIENTATION == 1)
+      TS_FollowLcdOrientation(Instance);
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
       x_oriented = state.TouchX;
       y_oriented = state.TouchY;
 
@@ -422,6 +445,9 @@ int32_t BSP_TS_Get_MultiTouchState(uint32_t Instance, TS_MultiTouch_State_t *TS_
     }/* Check and update the number of touches active detected */
     else if(state.TouchDetected != 0U)
     {
+#if (USE_BSP_LCD_ORIENTATION == 1)
+      TS_FollowLcdOrientation(Instance);
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
       for(index = 0; index < state.TouchDetected; index++)
       {
         x_oriented[index] = state.TouchX[index];
@@ -678,6 +704,51 @@ static void TS_EXTI_Callback(void)
 
 }
 
+#if (USE_BSP_LCD_ORIENTATION == 1)
+/**
+  * @brief  Rotates the touch orientation by a quarter turn when the LCD was
+  *         switched between portrait and landscape since the last read.
+  * @param  Instance TS instance. Could be only 0.
+  * @retval None
+  */
+static void TS_FollowLcdOrientation(uint32_t Instance)
+{
+  uint32_t lcd_orientation;
+  uint32_t orientation = Ts_Ctx[Instance].Orientation;
+  uint32_t swap_x = ((orientation & TS_SWAP_X) == TS_SWAP_X) ? 1U : 0U;
+  uint32_t swap_y = ((orientation & TS_SWAP_Y) == TS_SWAP_Y) ? 1U : 0U;
+  uint32_t tmp;
+
+  if((BSP_LCD_GetOrientation(0, &lcd_orientation) == BSP_ERROR_NONE) &&
+     (lcd_orientation != Ts_LcdOrientation[Instance]))
+  {
+    /* Portrait X runs along landscape Y backwards, portrait Y along landscape X */
+    orientation = (orientation & TS_SWAP_XY) ^ TS_SWAP_XY;
+    if(lcd_orientation == LCD_ORIENTATION_PORTRAIT)
+    {
+      orientation |= (swap_y == 0U) ? TS_SWAP_X : 0U;
+      orientation |= (swap_x != 0U) ? TS_SWAP_Y : 0U;
+    }
+    else
+    {
+      orientation |= (swap_y != 0U) ? TS_SWAP_X : 0U;
+      orientation |= (swap_x == 0U) ? TS_SWAP_Y : 0U;
+    }
+    Ts_Ctx[Instance].Orientation = (orientation == 0U) ? TS_SWAP_NONE : orientation;
+
+    /* The screen and the controller axes are exchanged */
+    tmp = Ts_Ctx[Instance].Width;
+    Ts_Ctx[Instance].Width  = Ts_Ctx[Instance].Height;
+    Ts_Ctx[Instance].Height = tmp;
+    tmp = Ts_Ctx[Instance].MaxX;
+    Ts_Ctx[Instance].MaxX = Ts_Ctx[Instance].MaxY;
+    Ts_Ctx[Instance].MaxY = tmp;
+
+    Ts_LcdOrientation[Instance] = lcd_orientation;
+  }
+}
+#endif /* USE_BSP_LCD_ORIENTATION == 1 */
+
 /**
   * @}
   */
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    core_cm7.h
+  * @brief   Host build of the Cortex-M7 core header.
+  *          Found before Drivers/CMSIS/Include by the device header, it replaces
+  *          the GCC intrinsics of cmsis_gcc.h (inline ARM assembly) by calls to
+  *          the host model, then includes the CMSIS core header for the register
+  *          definitions. The D-cache maintenance functions are counted by the
+  *          model instead of being executed line by line.
+  ******************************************************************************
+  */
+
+#ifndef HOST_CORE_CM7_H
+#define HOST_CORE_CM7_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Keep cmsis_gcc.h out: its intrinsics are ARM instructions */
+#define __CMSIS_GCC_H
+
+#define __ASM                                  __asm
+#define __INLINE                               inline
+#define __STATIC_INLINE                        static inline
+#define __STATIC_FORCEINLINE                   __attribute__((always_inline)) static inline
+#define __NO_RETURN                            __attribute__((__noreturn__))
+#define __USED                                 __attribute__((used))
+#define __WEAK                                 __attribute__((weak))
+#define __PACKED                               __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT                        struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION                         union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                           __attribute__((aligned(x)))
+#define __RESTRICT                             __restrict
+#define __COMPILER_BARRIER()                   __ASM volatile("":::"memory")
+
+#define __UNALIGNED_UINT16_READ(addr)          (*(const uint16_t *)(const void *)(addr))
+#define __UNALIGNED_UINT16_WRITE(addr, val)    (void)(*(uint16_t *)(void *)(addr) = (val))
+#define __UNALIGNED_UINT32_READ(addr)          (*(const uint32_t *)(const void *)(addr))
+#define __UNALIGNED_UINT32_WRITE(addr, val)    (void)(*(uint32_t *)(void *)(addr) = (val))
+
+/* Interrupt mask and exception state, kept by the host model */
+uint32_t Host_GetPrimask(void);
+void     Host_SetPrimask(uint32_t Primask);
+uint32_t Host_GetIpsr(void);
+void     Host_WaitForInterrupt(void);
+void     Host_DCacheOp(uint32_t Op, const void *Address, int32_t Size);
+
+#define HOST_DCACHE_CLEAN              0U
+#define HOST_DCACHE_INVALIDATE         1U
+#define HOST_DCACHE_CLEAN_INVALIDATE   2U
+
+__STATIC_FORCEINLINE void __enable_irq(void)               { Host_SetPrimask(0U); }
+__STATIC_FORCEINLINE void __disable_irq(void)              { Host_SetPrimask(1U); }
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)          { return Host_GetPrimask(); }
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)  { Host_SetPrimask(priMask & 1U); }
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)             { return Host_GetIpsr(); }
+__STATIC_FORCEINLINE uint32_t __get_CONTROL(void)          { return 0U; }
+__STATIC_FORCEINLINE void __set_CONTROL(uint32_t control)  { (void)control; }
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)          { return 0U; }
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri)  { (void)basePri; }
+__STATIC_FORCEINLINE uint32_t __get_FPSCR(void)            { return 0U; }
+__STATIC_FORCEINLINE void __set_FPSCR(uint32_t fpscr)      { (void)fpscr; }
+
+#define __NOP()                        __COMPILER_BARRIER()
+#define __WFI()                        Host_WaitForInterrupt()
+#define __WFE()                        Host_WaitForInterrupt()
+#define __SEV()                        __COMPILER_BARRIER()
+#define __BKPT(value)                  __builtin_trap()
+
+__STATIC_FORCEINLINE void __ISB(void)                      { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __DSB(void)                      { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __DMB(void)                      { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)        { return __builtin_bswap32(value); }
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)      { return ((value & 0xFF00FF00U) >> 8) | ((value & 0x00FF00FFU) << 8); }
+__STATIC_FORCEINLINE int16_t __REVSH(int16_t value)        { return (int16_t)__builtin_bswap16((uint16_t)value); }
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32U;
+  return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+  uint32_t i;
+
+  for(i = 0U; i < 32U; i++)
+  {
+    result = (result << 1) | ((value >> i) & 1U);
+  }
+  return result;
+}
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)         { return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value); }
+
+/* The CMSIS core: registers, NVIC, SCB, SysTick and MPU definitions */
+#include "../../../Drivers/CMSIS/Include/core_cm7.h"
+
+/* D-cache maintenance: the host memory is coherent, the model only counts it */
+#define SCB_EnableDCache()                         Host_DCacheOp(HOST_DCACHE_INVALIDATE, NULL, 0)
+#define SCB_DisableDCache()                        Host_DCacheOp(HOST_DCACHE_CLEAN_INVALIDATE, NULL, 0)
+#define SCB_InvalidateDCache()                     Host_DCacheOp(HOST_DCACHE_INVALIDATE, NULL, 0)
+#define SCB_CleanDCache()                          Host_DCacheOp(HOST_DCACHE_CLEAN, NULL, 0)
+#define SCB_CleanInvalidateDCache()                Host_DCacheOp(HOST_DCACHE_CLEAN_INVALIDATE, NULL, 0)
+#define SCB_CleanDCache_by_Addr(addr, size)        Host_DCacheOp(HOST_DCACHE_CLEAN, (const void *)(addr), (int32_t)(size))
+#define SCB_InvalidateDCache_by_Addr(addr, size)   Host_DCacheOp(HOST_DCACHE_INVALIDATE, (const void *)(addr), (int32_t)(size))
+#define SCB_CleanInvalidateDCache_by_Addr(addr, size) \
+                                                   Host_DCacheOp(HOST_DCACHE_CLEAN_INVALIDATE, (const void *)(addr), (int32_t)(size))
+#define SCB_EnableICache()                         ((void)0)
+#define SCB_DisableICache()                        ((void)0)
+#define SCB_InvalidateICache()                     ((void)0)
+
+#endif /* HOST_CORE_CM7_H */
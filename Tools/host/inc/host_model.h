@@ -0,0 +1,177 @@
+/**
+  ******************************************************************************
+  * @file    host_model.h
+  * @brief   Host model of the STM32H747I-DISCO display path: Cortex-M7 core,
+  *          DMA2D, LTDC, DSI host and RCC, run against the BSP sources.
+  *          The peripheral registers sit at their STM32 addresses in the host
+  *          process. Accesses to the modelled peripherals are trapped and
+  *          advance a virtual clock, so the BSP polling loops, interrupts and
+  *          timeouts behave as on the target.
+  ******************************************************************************
+  */
+
+#ifndef HOST_MODEL_H
+#define HOST_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32h7xx.h"
+#include <stdint.h>
+
+/** @addtogroup Host_Model
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+#define HOST_CPU_CLOCK                400000000U  /* Virtual CPU clock, in Hz                 */
+#define HOST_MMIO_CYCLES              16U         /* Cost of a trapped register access        */
+#define HOST_TICK_CYCLES              4000U       /* Cost of a HAL_GetTick() call             */
+#define HOST_NEVER                    UINT64_MAX  /* No pending event                         */
+
+#define HOST_DSI_PACKETS_MAX          4096U
+#define HOST_DSI_PAYLOAD_MAX          256U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Modelled peripheral, covering whole pages of the memory map.
+  *         The hooks run with the register page in the backdoor view.
+  */
+typedef struct
+{
+  const char *Name;
+  uint32_t    Base;                                          /* Page aligned               */
+  uint32_t    Size;                                          /* Multiple of the page size  */
+  void      (*Reset)(void);
+  void      (*Read)(uint32_t Offset);                        /* Before a read or a write   */
+  void      (*Write)(uint32_t Offset, uint32_t Old, uint32_t New);
+  uint64_t  (*NextEvent)(void);                              /* Absolute cycle, or HOST_NEVER */
+  void      (*Event)(uint64_t Now);
+} Host_Periph_t;
+
+typedef struct
+{
+  uint32_t Jobs;              /* Completed transfers           */
+  uint64_t Pixels;            /* Output pixels                 */
+  uint64_t BytesRead;         /* Foreground and background     */
+  uint64_t BytesWritten;      /* Output                        */
+  uint64_t BusyCycles;        /* CPU cycles with a transfer on */
+} Host_Dma2dStats_t;
+
+typedef struct
+{
+  uint64_t Start;             /* CPU cycle of the start        */
+  uint64_t End;               /* CPU cycle of the completion   */
+  uint32_t Mode;              /* DMA2D_CR MODE field           */
+  uint32_t Address;           /* Output address                */
+  uint32_t Width;             /* Pixels per line               */
+  uint32_t Height;            /* Lines                         */
+  uint32_t Pitch;             /* Output line pitch, in bytes   */
+} Host_Dma2dJob_t;
+
+typedef void (*Host_Dma2dHook_t)(const Host_Dma2dJob_t *Job);
+
+typedef struct
+{
+  uint64_t Time;              /* CPU cycle of the header write */
+  uint64_t Sent;              /* CPU cycle the packet is sent  */
+  uint8_t  Type;              /* DSI data type                 */
+  uint8_t  Channel;           /* Virtual channel               */
+  uint16_t Size;              /* Payload bytes                 */
+  uint8_t  Data[HOST_DSI_PAYLOAD_MAX];
+} Host_DsiPacket_t;
+
+typedef struct
+{
+  uint32_t Frames;            /* Frames sent by the LTDC       */
+  uint32_t Refreshes;         /* Command mode refreshes        */
+  uint32_t UlpmEntries;       /* Link put in ULPM              */
+  uint32_t UlpmExits;         /* Link taken out of ULPM        */
+  uint64_t UlpmCycles;        /* Time spent in ULPM            */
+} Host_DsiStats_t;
+
+typedef struct
+{
+  uint32_t Ops;               /* Maintenance calls             */
+  uint64_t Bytes;             /* Bytes given by address        */
+  uint32_t Whole;             /* Whole cache operations        */
+} Host_CacheStats_t;
+
+typedef enum
+{
+  HOST_PANEL_NONE = 0,
+  HOST_PANEL_RASPBERRYPI,     /* ATTINY on I2C4 + TC358762     */
+  HOST_PANEL_OTM8009A,        /* DSI DCS, ID 0x40              */
+  HOST_PANEL_NT35510          /* DSI DCS, ID 0x80              */
+} Host_Panel_t;
+
+/* Exported functions ------------------------------------------------------- */
+/* Virtual time */
+uint64_t Host_GetCycles(void);
+void     Host_Advance(uint64_t Cycles);
+void     Host_Run(uint64_t Cycles);
+void     Host_RunUntil(volatile const uint32_t *pFlag, uint32_t Mask, uint32_t Value, uint64_t MaxCycles);
+double   Host_Seconds(uint64_t Cycles);
+
+/* Register views and events for the peripheral models */
+volatile uint32_t *Host_Reg(uint32_t Address);
+
+/* Interrupts */
+void     Host_SetIrqLine(IRQn_Type IRQn, uint32_t Level);
+void     Host_DeliverInterrupts(void);
+uint32_t Host_GetIrqCount(IRQn_Type IRQn);
+
+/* D-cache maintenance counters */
+void     Host_GetCacheStats(Host_CacheStats_t *Stats);
+void     Host_ResetCacheStats(void);
+
+/* DMA2D */
+void     Host_Dma2dGetStats(Host_Dma2dStats_t *Stats);
+void     Host_Dma2dResetStats(void);
+void     Host_Dma2dSetHook(Host_Dma2dHook_t Hook);
+void     Host_Dma2dSetCost(uint32_t FillCycles, uint32_t CopyCycles, uint32_t BlendCycles);
+
+/* LTDC */
+uint32_t Host_LtdcGetPixelClock(void);
+uint64_t Host_LtdcGetFrameCycles(void);
+uint32_t Host_LtdcGetFrames(void);
+int32_t  Host_LtdcCompose(uint32_t *pRgb, uint32_t Width, uint32_t Height);
+int32_t  Host_LtdcDump(const char *pPath);
+
+/* DSI */
+void     Host_DsiSetPanel(Host_Panel_t Panel);
+uint32_t Host_DsiGetPackets(const Host_DsiPacket_t **pPackets);
+void     Host_DsiResetPackets(void);
+void     Host_DsiGetStats(Host_DsiStats_t *Stats);
+uint32_t Host_DsiInUlpm(void);
+void     Host_DsiSetTearingEffect(uint32_t Enable);
+
+/* Board: I2C4 devices */
+void     Host_BoardSetPanel(Host_Panel_t Panel);
+uint32_t Host_BoardGetI2cXfers(void);
+uint64_t Host_BoardGetI2cCycles(void);
+
+/* Images */
+int32_t  Host_WritePPM(const char *pPath, const uint32_t *pRgb, uint32_t Width, uint32_t Height);
+int32_t  Host_WritePNG(const char *pPath, const uint32_t *pRgb, uint32_t Width, uint32_t Height);
+int32_t  Host_WriteImage(const char *pPath, const uint32_t *pRgb, uint32_t Width, uint32_t Height);
+
+/* Test helpers */
+int      Host_Argc(void);
+const char *Host_Argv(int Index);
+double   Host_WallSeconds(void);
+void     Host_Check(int Condition, const char *pExpr, const char *pFile, int Line);
+int      Host_Failures(void);
+
+#define HOST_CHECK(cond)              Host_Check((cond) ? 1 : 0, #cond, __FILE__, __LINE__)
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_MODEL_H */
@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    host_board.c
+  * @brief   Host replacement of the board services used by the LCD driver: the
+  *          I2C4 bus, blocking or queued, with the ATTINY of the Raspberry Pi
+  *          panel as its only device, the SDRAM initialization and the BSP time
+  *          base. The bus runs at 100 kHz, 9 bit times per byte.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_bus.h"
+#include "stm32h747i_discovery_sdram.h"
+#include "stm32h747i_discovery_errno.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_I2C_BIT_CYCLES           (HOST_CPU_CLOCK / 100000U)
+#define HOST_I2C_ATTINY               0x45U
+#define HOST_ATTINY_REG_ID            0x80U
+#define HOST_ATTINY_REG_PORTB         0x82U
+#define HOST_ATTINY_REG_POWERON       0x85U
+#define HOST_SDRAM_INIT_CYCLES        (2U * (HOST_CPU_CLOCK / 1000U))
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_BoardReset(void);
+static uint64_t Host_BoardNextEvent(void);
+static void Host_BoardEvent(uint64_t Now);
+
+/* Exported variables --------------------------------------------------------*/
+const Host_Periph_t Host_BoardPeriph =
+{
+  "Board", 0U, 0U, Host_BoardReset, NULL, NULL, Host_BoardNextEvent, Host_BoardEvent
+};
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t          Host_AttinyRegs[256];
+static Host_Panel_t     Host_BoardPanel = HOST_PANEL_RASPBERRYPI;
+static uint32_t         Host_I2cInit;
+static uint32_t         Host_I2cXfers;
+static uint64_t         Host_I2cCycles;
+static uint64_t         Host_I2cFree;              /* End of the transfer on the bus */
+#if (USE_BSP_I2C4_QUEUE == 1)
+static BSP_I2C4_Xfer_t *Host_I2cQueue;             /* Submitted, in order            */
+static BSP_I2C4_Xfer_t *Host_I2cActive;
+static uint64_t         Host_I2cActiveEnd;
+static uint32_t         Host_I2cDone;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gets the bus time of a register access.
+  * @param  Read    1 for a read, with its repeated start
+  * @param  Length  Data bytes
+  * @retval CPU cycles
+  */
+static uint64_t Host_I2cCost(uint32_t Read, uint32_t Length)
+{
+  /* Address, register, [address again], data */
+  return (uint64_t)(2U + Read + Length) * 9U * HOST_I2C_BIT_CYCLES;
+}
+
+/**
+  * @brief  Accesses the registers of a device.
+  * @param  DevAddr Device address, 7-bit or shifted
+  * @param  Reg     Register
+  * @param  pData   Data
+  * @param  Length  Data length
+  * @param  Read    1 to read, 0 to write
+  * @retval BSP status
+  */
+static int32_t Host_I2cAccess(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length, uint32_t Read)
+{
+  uint32_t i, reg;
+
+  if((Host_BoardPanel != HOST_PANEL_RASPBERRYPI) ||
+     ((DevAddr != HOST_I2C_ATTINY) && (DevAddr != (HOST_I2C_ATTINY << 1))))
+  {
+    return BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
+  }
+
+  for(i = 0U; i < Length; i++)
+  {
+    reg = (Reg + i) & 0xFFU;
+    if(Read != 0U)
+    {
+      pData[i] = Host_AttinyRegs[reg];
+    }
+    else if(reg != HOST_ATTINY_REG_ID)
+    {
+      Host_AttinyRegs[reg] = pData[i];
+      if(reg == HOST_ATTINY_REG_POWERON)
+      {
+        /* The bridge power good follows the power on */
+        Host_AttinyRegs[HOST_ATTINY_REG_PORTB] = (uint8_t)((Host_AttinyRegs[HOST_ATTINY_REG_PORTB] & 0xFEU) |
+                                                           (pData[i] & 0x01U));
+      }
+    }
+    else
+    {
+      /* Read only */
+    }
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Tells whether a queued transfer holds the bus.
+  * @retval 1 if busy
+  */
+static uint32_t Host_I2cBusy(void)
+{
+#if (USE_BSP_I2C4_QUEUE == 1)
+  return (Host_I2cActive != NULL) ? 1U : 0U;
+#else
+  return 0U;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+}
+
+/**
+  * @brief  Runs a blocking transfer once the bus is free.
+  * @param  DevAddr Device address
+  * @param  Reg     Register
+  * @param  pData   Data
+  * @param  Length  Data length
+  * @param  Read    1 to read, 0 to write
+  * @retval BSP status
+  */
+static int32_t Host_I2cBlocking(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length, uint32_t Read)
+{
+  uint64_t cost = Host_I2cCost(Read, Length);
+
+  while((Host_I2cBusy() != 0U) || (Host_I2cFree > Host_GetCycles()))
+  {
+    Host_Run((Host_I2cFree > Host_GetCycles()) ? (Host_I2cFree - Host_GetCycles()) : HOST_MMIO_CYCLES);
+  }
+  Host_I2cFree = Host_GetCycles() + cost;
+  Host_I2cXfers++;
+  Host_I2cCycles += cost;
+  Host_Run(cost);
+
+  return Host_I2cAccess(DevAddr, Reg, pData, Length, Read);
+}
+
+#if (USE_BSP_I2C4_QUEUE == 1)
+/**
+  * @brief  Starts the first queued transfer when the bus is free.
+  * @retval None
+  */
+static void Host_I2cKick(void)
+{
+  uint64_t start;
+
+  if((Host_I2cActive == NULL) && (Host_I2cQueue != NULL))
+  {
+    Host_I2cActive = Host_I2cQueue;
+    Host_I2cQueue = Host_I2cQueue->pNext;
+    start = (Host_I2cFree > Host_GetCycles()) ? Host_I2cFree : Host_GetCycles();
+    Host_I2cActiveEnd = start + Host_I2cCost(Host_I2cActive->Read, Host_I2cActive->Length);
+    Host_I2cFree = Host_I2cActiveEnd;
+  }
+}
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
+/**
+  * @brief  Board: powers the ATTINY down and empties the I2C4 queue.
+  * @retval None
+  */
+static void Host_BoardReset(void)
+{
+  memset(Host_AttinyRegs, 0, sizeof(Host_AttinyRegs));
+  Host_AttinyRegs[HOST_ATTINY_REG_ID] = 0xC3U;
+  Host_I2cInit   = 0U;
+  Host_I2cXfers  = 0U;
+  Host_I2cCycles = 0U;
+  Host_I2cFree   = 0U;
+#if (USE_BSP_I2C4_QUEUE == 1)
+  Host_I2cQueue  = NULL;
+  Host_I2cActive = NULL;
+  Host_I2cDone   = 0U;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+}
+
+/**
+  * @brief  Gets the end of the queued transfer on the bus.
+  * @retval Absolute cycle, or HOST_NEVER
+  */
+static uint64_t Host_BoardNextEvent(void)
+{
+#if (USE_BSP_I2C4_QUEUE == 1)
+  return ((Host_I2cActive != NULL) && (Host_I2cDone == 0U)) ? Host_I2cActiveEnd : HOST_NEVER;
+#else
+  return HOST_NEVER;
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
+}
+
+/**
+  * @brief  End of the queued transfer on the bus: raises the I2C4 event
+  *         interrupt, whose handler completes the transfer.
+  * @param  Now     Current cycle
+  * @retval None
+  */
+static void Host_BoardEvent(uint64_t Now)
+{
+  (void)Now;
+#if (USE_BSP_I2C4_QUEUE == 1)
+  Host_I2cDone = 1U;
+  Host_SetIrqLine(I2C4_EV_IRQn, 1U);
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+}
+
+/* Exported functions --------------------------------------------------------*/
+void Host_BoardSetPanel(Host_Panel_t Panel)
+{
+  Host_BoardPanel = Panel;
+  Host_DsiSetPanel(Panel);
+}
+
+/**
+  * @brief  Gets the I2C4 transfers run so far.
+  * @retval Transfers
+  */
+uint32_t Host_BoardGetI2cXfers(void)
+{
+  return Host_I2cXfers;
+}
+
+/**
+  * @brief  Gets the I2C4 bus time of the transfers run so far.
+  * @retval CPU cycles
+  */
+uint64_t Host_BoardGetI2cCycles(void)
+{
+  return Host_I2cCycles;
+}
+
+/**
+  * @brief  Initializes the I2C4 bus, counted as the BSP does.
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_Init(void)
+{
+  Host_I2cInit++;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  De-initializes the I2C4 bus.
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_DeInit(void)
+{
+  if(Host_I2cInit != 0U)
+  {
+    Host_I2cInit--;
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Reads registers, blocking.
+  * @param  DevAddr Device address
+  * @param  Reg     First register
+  * @param  pData   Data
+  * @param  Length  Data length
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  return Host_I2cBlocking(DevAddr, Reg, pData, Length, 1U);
+}
+
+/**
+  * @brief  Writes registers, blocking.
+  * @param  DevAddr Device address
+  * @param  Reg     First register
+  * @param  pData   Data
+  * @param  Length  Data length
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  return Host_I2cBlocking(DevAddr, Reg, pData, Length, 0U);
+}
+
+#if (USE_BSP_I2C4_QUEUE == 1)
+/**
+  * @brief  Queues a transfer, completed from the I2C4 event interrupt. The
+  *         device priorities are not modelled: transfers run in order.
+  * @param  pXfer   Transfer
+  * @retval BSP status
+  */
+int32_t BSP_I2C4_Submit(BSP_I2C4_Xfer_t *pXfer)
+{
+  BSP_I2C4_Xfer_t **pp = &Host_I2cQueue;
+
+  if((pXfer == NULL) || (pXfer->Device >= BSP_I2C4_DEV_NBR) || ((pXfer->pData == NULL) && (pXfer->Length != 0U)))
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+  if(Host_I2cInit == 0U)
+  {
+    return BSP_ERROR_NO_INIT;
+  }
+
+  pXfer->Status = BSP_ERROR_BUSY;
+  pXfer->pNext  = NULL;
+  while(*pp != NULL)
+  {
+    pp = &(*pp)->pNext;
+  }
+  *pp = pXfer;
+  Host_I2cKick();
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Completes the queued transfer at the end of its bus time.
+  * @retval None
+  */
+void BSP_I2C4_EV_IRQHandler(void)
+{
+  BSP_I2C4_Xfer_t *xfer = Host_I2cActive;
+
+  Host_SetIrqLine(I2C4_EV_IRQn, 0U);
+  if((xfer == NULL) || (Host_I2cDone == 0U))
+  {
+    return;
+  }
+
+  Host_I2cActive = NULL;
+  Host_I2cDone = 0U;
+  Host_I2cXfers++;
+  Host_I2cCycles += Host_I2cCost(xfer->Read, xfer->Length);
+  xfer->Status = Host_I2cAccess(xfer->DevAddr, xfer->Reg, xfer->pData, xfer->Length, xfer->Read);
+  Host_I2cKick();
+  if(xfer->Callback != NULL)
+  {
+    xfer->Callback(xfer);
+  }
+}
+
+/**
+  * @brief  I2C4 error interrupt: no bus error is modelled.
+  * @retval None
+  */
+void BSP_I2C4_ER_IRQHandler(void)
+{
+  Host_SetIrqLine(I2C4_ER_IRQn, 0U);
+}
+#endif /* USE_BSP_I2C4_QUEUE == 1 */
+
+/**
+  * @brief  BSP time base.
+  * @retval Tick, in ms
+  */
+int32_t BSP_GetTick(void)
+{
+  return (int32_t)HAL_GetTick();
+}
+
+/**
+  * @brief  Starts the DWT cycle counter, as the BSP does.
+  * @retval None
+  */
+void BSP_EnableCycleCounter(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  SDRAM: the frame buffers are host memory, only the time of the
+  *         FMC initialization is spent.
+  * @param  Instance    SDRAM instance
+  * @retval BSP status
+  */
+int32_t BSP_SDRAM_Init(uint32_t Instance)
+{
+  (void)Instance;
+  Host_Run(HOST_SDRAM_INIT_CYCLES);
+
+  return BSP_ERROR_NONE;
+}
@@ -0,0 +1,1232 @@
+/**
+  ******************************************************************************
+  * @file    host_core.c
+  * @brief   Host model of the Cortex-M7 core and of the STM32H747 memory map.
+  *          The memories used by the BSP are mapped at their STM32 addresses.
+  *          The register pages of the modelled peripherals are kept inaccessible:
+  *          an access faults, the model advances the virtual clock and runs the
+  *          read hook. The plain moves are then done on the backdoor view of the
+  *          page; any other instruction is run alone on the opened page. The
+  *          write hook runs last, then the pending interrupts are delivered.
+  *          The program is built without PIE, and runs on a stack mapped below
+  *          4 GB, so that the BSP casts between pointers and uint32_t hold.
+  ******************************************************************************
+  */
+
+#define _GNU_SOURCE
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_PAGE_SIZE                0x1000U
+#define HOST_STACK_BASE               0x60000000U
+#define HOST_STACK_SIZE               0x00800000U
+#define HOST_IRQ_NBR                  160U
+#define HOST_IRQ_STORM                1000000U
+#define HOST_POLL_MAX_CYCLES          1024U      /* Longest step of a polling loop */
+#define HOST_X86_TF                   0x100U     /* EFLAGS trap flag          */
+#define HOST_X86_PF_WRITE             0x2U       /* Page fault on a write     */
+#define HOST_X86_REX                  0x40U      /* REX prefix, W R X B bits  */
+#define HOST_X86_OPSIZE               0x66U      /* 16-bit operand prefix     */
+
+#define HOST_DWT_CTRL                 0x000U
+#define HOST_DWT_CYCCNT               0x004U
+#define HOST_NVIC_ISER                0x100U
+#define HOST_NVIC_ICER                0x180U
+#define HOST_NVIC_ISPR                0x200U
+#define HOST_NVIC_ICPR                0x280U
+#define HOST_NVIC_IABR                0x300U
+#define HOST_NVIC_IP                  0x400U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Base;
+  uint32_t Size;
+  int      NoReserve;
+} Host_Region_t;
+
+typedef struct
+{
+  const Host_Periph_t *Periph;
+  uint32_t             Address;
+  uint32_t             Old;
+  uint32_t             Write;
+} Host_Access_t;
+
+typedef struct
+{
+  uint64_t Pc;                /* Instruction of the last read  */
+  uint32_t Address;           /* Register of the last read     */
+  uint32_t Value;             /* Value it returned             */
+  uint32_t Repeats;           /* Same reads returning it       */
+  uint64_t Step;              /* Cycles charged for the next   */
+} Host_Poll_t;
+
+/* External variables --------------------------------------------------------*/
+extern const Host_Periph_t Host_Dma2dPeriph;
+extern const Host_Periph_t Host_LtdcPeriph;
+extern const Host_Periph_t Host_DsiPeriph;
+extern const Host_Periph_t Host_RccPeriph;
+extern const Host_Periph_t Host_TimPeriph;
+extern const Host_Periph_t Host_BoardPeriph;
+
+/* Interrupt handlers of the application, CM7/Src/stm32h7xx_it.c */
+extern void LTDC_IRQHandler(void) __attribute__((weak));
+extern void LTDC_ER_IRQHandler(void) __attribute__((weak));
+extern void DMA2D_IRQHandler(void) __attribute__((weak));
+extern void DSI_IRQHandler(void) __attribute__((weak));
+extern void I2C4_EV_IRQHandler(void) __attribute__((weak));
+extern void I2C4_ER_IRQHandler(void) __attribute__((weak));
+extern void TIM7_IRQHandler(void) __attribute__((weak));
+
+/* The test program */
+extern int Host_Test(void);
+
+/* Global variables ----------------------------------------------------------*/
+uint32_t SystemCoreClock = HOST_CPU_CLOCK;
+uint32_t SystemD2Clock   = HOST_CPU_CLOCK / 2U;
+const  uint8_t D1CorePrescTable[16] = {0, 0, 0, 0, 1, 2, 3, 4, 1, 2, 3, 4, 6, 7, 8, 9};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_ScsReset(void);
+static void Host_ScsRead(uint32_t Offset);
+static void Host_ScsWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+static void Host_DwtReset(void);
+static void Host_DwtRead(uint32_t Offset);
+static void Host_DwtWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+static uint32_t Host_EmulateMoffs(ucontext_t *pCtx, uint8_t *pMem, uint32_t Opcode, uint32_t Rex,
+                                  uint32_t OpSize, uint32_t Len, uint32_t Write);
+static uint32_t Host_Emulate(ucontext_t *pCtx, uint32_t Address, uint32_t Write);
+
+/* Private variables ---------------------------------------------------------*/
+static const Host_Region_t Host_Regions[] =
+{
+  { 0x24000000U, 0x00080000U, 0 },   /* AXI SRAM                      */
+  { 0x30000000U, 0x00048000U, 0 },   /* SRAM1 to SRAM3                */
+  { 0x38000000U, 0x00801000U, 1 },   /* SRAM4 and backup SRAM         */
+  { 0x40000000U, 0x20000000U, 1 },   /* Peripherals                   */
+  { 0xD0000000U, 0x02000000U, 0 },   /* SDRAM                         */
+  { 0xE0000000U, 0x00100000U, 0 },   /* Cortex-M7 private peripherals */
+};
+
+static const Host_Periph_t Host_ScsPeriph =
+{
+  "SCS", 0xE000E000U, HOST_PAGE_SIZE, Host_ScsReset, Host_ScsRead, Host_ScsWrite, NULL, NULL
+};
+
+static const Host_Periph_t Host_DwtPeriph =
+{
+  "DWT", 0xE0001000U, HOST_PAGE_SIZE, Host_DwtReset, Host_DwtRead, Host_DwtWrite, NULL, NULL
+};
+
+static const Host_Periph_t *const Host_Periphs[] =
+{
+  &Host_ScsPeriph,
+  &Host_DwtPeriph,
+  &Host_RccPeriph,
+  &Host_TimPeriph,
+  &Host_DsiPeriph,
+  &Host_LtdcPeriph,
+  &Host_Dma2dPeriph,
+  &Host_BoardPeriph,
+};
+
+#define HOST_PERIPHS_NBR              (sizeof(Host_Periphs) / sizeof(Host_Periphs[0]))
+
+static uint8_t      *Host_Backdoor[HOST_PERIPHS_NBR];
+static Host_Access_t Host_Pending;
+static Host_Poll_t   Host_Poll;
+static uint64_t      Host_Now;
+static uint32_t      Host_Primask;
+static uint32_t      Host_Ipsr;
+static uint32_t      Host_IrqEnabled[HOST_IRQ_NBR / 32U];
+static uint32_t      Host_IrqPending[HOST_IRQ_NBR / 32U];
+static uint32_t      Host_IrqActive[HOST_IRQ_NBR / 32U];
+static uint32_t      Host_IrqLine[HOST_IRQ_NBR / 32U];
+static uint32_t      Host_IrqCount[HOST_IRQ_NBR];
+static uint32_t      Host_DwtEnabled;
+static uint64_t      Host_DwtOrigin;
+static uint32_t      Host_DwtFrozen;
+static Host_CacheStats_t Host_Cache;
+static int           Host_Errors;
+static ucontext_t    Host_MainContext;
+static ucontext_t    Host_TestContext;
+static int           Host_TestStatus;
+static int           Host_ArgCount;
+static char        **Host_ArgValues;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Prints a fatal model error and stops the program.
+  * @param  pMsg    Message
+  * @param  Value   Value printed after the message
+  * @retval None
+  */
+static void Host_Fatal(const char *pMsg, uint64_t Value)
+{
+  fprintf(stderr, "host: %s 0x%llx at cycle %llu\n", pMsg, (unsigned long long)Value, (unsigned long long)Host_Now);
+  fflush(NULL);
+  abort();
+}
+
+/**
+  * @brief  Finds the modelled peripheral holding an address.
+  * @param  Address     Address
+  * @retval Index in Host_Periphs, or -1
+  */
+static int Host_FindPeriph(uint64_t Address)
+{
+  uint32_t i;
+
+  for(i = 0U; i < HOST_PERIPHS_NBR; i++)
+  {
+    if((Host_Periphs[i]->Size != 0U) && (Address >= Host_Periphs[i]->Base) &&
+       (Address < ((uint64_t)Host_Periphs[i]->Base + Host_Periphs[i]->Size)))
+    {
+      return (int)i;
+    }
+  }
+
+  return -1;
+}
+
+/**
+  * @brief  Gets the earliest event of the models.
+  * @retval Absolute cycle, or HOST_NEVER
+  */
+static uint64_t Host_NextEvent(void)
+{
+  uint64_t next = HOST_NEVER, t;
+  uint32_t i;
+
+  for(i = 0U; i < HOST_PERIPHS_NBR; i++)
+  {
+    if(Host_Periphs[i]->NextEvent != NULL)
+    {
+      t = Host_Periphs[i]->NextEvent();
+      if(t < next)
+      {
+        next = t;
+      }
+    }
+  }
+
+  return next;
+}
+
+/**
+  * @brief  Runs the model events up to a time. Interrupts are only pended.
+  * @param  Time        Absolute cycle
+  * @retval None
+  */
+static void Host_AdvanceTo(uint64_t Time)
+{
+  uint64_t next;
+  uint32_t i;
+
+  while((next = Host_NextEvent()) <= Time)
+  {
+    if(next > Host_Now)
+    {
+      Host_Now = next;
+    }
+    for(i = 0U; i < HOST_PERIPHS_NBR; i++)
+    {
+      if((Host_Periphs[i]->NextEvent != NULL) && (Host_Periphs[i]->NextEvent() <= Host_Now))
+      {
+        Host_Periphs[i]->Event(Host_Now);
+      }
+    }
+  }
+
+  if(Time > Host_Now)
+  {
+    Host_Now = Time;
+  }
+}
+
+/**
+  * @brief  Gets the time charged for a register access. A read repeating the
+  *         previous one, from the same instruction with the same result, is a
+  *         polling loop: its step doubles, up to the next model event, so a
+  *         long wait costs a few traps instead of one per 16 cycles.
+  * @param  Pc          Instruction of the access
+  * @param  Address     Register
+  * @param  Write       1 for a write
+  * @retval CPU cycles
+  */
+static uint64_t Host_PollCycles(uint64_t Pc, uint32_t Address, uint32_t Write)
+{
+  uint64_t next;
+
+  if((Write != 0U) || (Pc != Host_Poll.Pc) || (Address != Host_Poll.Address) || (Host_Poll.Repeats < 2U))
+  {
+    if((Write != 0U) || (Pc != Host_Poll.Pc) || (Address != Host_Poll.Address))
+    {
+      Host_Poll.Repeats = 0U;
+    }
+    Host_Poll.Pc   = (Write != 0U) ? 0U : Pc;
+    Host_Poll.Step = HOST_MMIO_CYCLES;
+    return HOST_MMIO_CYCLES;
+  }
+
+  Host_Poll.Step = (Host_Poll.Step < HOST_POLL_MAX_CYCLES) ? (Host_Poll.Step * 2U) : HOST_POLL_MAX_CYCLES;
+  next = Host_NextEvent();
+  if((next > Host_Now) && ((next - Host_Now) < Host_Poll.Step))
+  {
+    return ((next - Host_Now) > HOST_MMIO_CYCLES) ? (next - Host_Now) : HOST_MMIO_CYCLES;
+  }
+
+  return Host_Poll.Step;
+}
+
+/**
+  * @brief  Records the result of a register read for the polling detection.
+  * @param  Address     Register
+  * @param  Value       Value read
+  * @retval None
+  */
+static void Host_PollRead(uint32_t Address, uint32_t Value)
+{
+  /* The cycle counter changes on each read without any progress */
+  if((Address == Host_Poll.Address) &&
+     ((Value == Host_Poll.Value) || (Address == (0xE0001000U + HOST_DWT_CYCCNT))))
+  {
+    Host_Poll.Repeats++;
+  }
+  else
+  {
+    Host_Poll.Repeats = 0U;
+  }
+  Host_Poll.Address = Address;
+  Host_Poll.Value   = Value;
+}
+
+/**
+  * @brief  Gets the pending and enabled interrupt of highest priority.
+  * @retval IRQ number, or -1
+  */
+static int Host_NextIrq(void)
+{
+  const volatile uint8_t *priority = (const volatile uint8_t *)Host_Reg(0xE000E000U + HOST_NVIC_IP);
+  int irq = -1;
+  uint32_t i;
+
+  for(i = 0U; i < HOST_IRQ_NBR; i++)
+  {
+    if(((Host_IrqPending[i / 32U] & Host_IrqEnabled[i / 32U]) & (1UL << (i % 32U))) != 0U)
+    {
+      if((irq < 0) || (priority[i] < priority[irq]))
+      {
+        irq = (int)i;
+      }
+    }
+  }
+
+  return irq;
+}
+
+/**
+  * @brief  Calls the handler of an interrupt.
+  * @param  IRQn        IRQ number
+  * @retval None
+  */
+static void Host_CallHandler(int IRQn)
+{
+  void (*handler)(void) = NULL;
+
+  switch(IRQn)
+  {
+  case LTDC_IRQn:       handler = LTDC_IRQHandler;     break;
+  case LTDC_ER_IRQn:    handler = LTDC_ER_IRQHandler;  break;
+  case DMA2D_IRQn:      handler = DMA2D_IRQHandler;    break;
+  case DSI_IRQn:        handler = DSI_IRQHandler;      break;
+  case I2C4_EV_IRQn:    handler = I2C4_EV_IRQHandler;  break;
+  case I2C4_ER_IRQn:    handler = I2C4_ER_IRQHandler;  break;
+  case TIM7_IRQn:       handler = TIM7_IRQHandler;     break;
+  default:                                             break;
+  }
+
+  if(handler == NULL)
+  {
+    Host_Fatal("no handler for IRQ", (uint64_t)IRQn);
+  }
+  handler();
+}
+
+/**
+  * @brief  Does a move between the accumulator and an absolute address.
+  * @param  pCtx        Interrupted context
+  * @param  pMem        Backdoor view of the address
+  * @param  Opcode      0xA0 to 0xA3
+  * @param  Rex         REX prefix, 0 if none
+  * @param  OpSize      1 with the 16-bit operand prefix
+  * @param  Len         Length of the prefixes and opcode
+  * @param  Write       1 for a write
+  * @retval 1 if the instruction was done, 0 to run it on the opened page
+  */
+static uint32_t Host_EmulateMoffs(ucontext_t *pCtx, uint8_t *pMem, uint32_t Opcode, uint32_t Rex,
+                                  uint32_t OpSize, uint32_t Len, uint32_t Write)
+{
+  greg_t *rax = &pCtx->uc_mcontext.gregs[REG_RAX];
+  uint32_t size = ((Opcode & 1U) == 0U) ? 1U : (((Rex & 0x8U) != 0U) ? 8U : ((OpSize != 0U) ? 2U : 4U));
+  uint64_t value = 0U;
+
+  if(((Opcode >= 0xA2U) ? 1U : 0U) != Write)
+  {
+    return 0U;
+  }
+
+  if(Write != 0U)
+  {
+    value = (uint64_t)*rax;
+    memcpy(pMem, &value, size);
+  }
+  else if(size >= 4U)
+  {
+    memcpy(&value, pMem, size);
+    *rax = (greg_t)value;
+  }
+  else
+  {
+    memcpy(rax, pMem, size);
+  }
+
+  pCtx->uc_mcontext.gregs[REG_RIP] += (greg_t)(Len + 8U);
+
+  return 1U;
+}
+
+/**
+  * @brief  Does a plain move from or to a register page on its backdoor view,
+  *         then steps over the instruction. The loads, stores and zero or
+  *         sign extending loads of the volatile accesses are covered.
+  * @param  pCtx        Interrupted context
+  * @param  Address     Accessed address
+  * @param  Write       1 for a write
+  * @retval 1 if the instruction was done, 0 to run it on the opened page
+  */
+static uint32_t Host_Emulate(ucontext_t *pCtx, uint32_t Address, uint32_t Write)
+{
+  /* x86 register numbers to the saved context */
+  static const int regs[16] =
+  {
+    REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+    REG_R8,  REG_R9,  REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15
+  };
+  const uint8_t *pc = (const uint8_t *)(uintptr_t)pCtx->uc_mcontext.gregs[REG_RIP];
+  uint8_t *mem = (uint8_t *)Host_Reg(Address & ~3U) + (Address & 3U);
+  greg_t *greg;
+  uint32_t rex = 0U, size = 4U, opsize = 0U, store = 0U, imm = 0U, sign = 0U, len = 0U;
+  uint32_t opcode, modrm, mod, rm, reg;
+  uint64_t value = 0U;
+  int64_t svalue;
+
+  if(pc[len] == HOST_X86_OPSIZE)
+  {
+    opsize = 1U;
+    len++;
+  }
+  if((pc[len] & 0xF0U) == HOST_X86_REX)
+  {
+    rex = pc[len];
+    len++;
+  }
+
+  opcode = pc[len++];
+  if(opcode == 0x0FU)
+  {
+    opcode = 0x0F00U | pc[len++];
+  }
+
+  switch(opcode)
+  {
+  case 0x88U: store = 1U; size = 1U; break;                      /* mov m8, r8           */
+  case 0x89U: store = 1U; break;                                 /* mov m, r             */
+  case 0x8AU: size = 1U; break;                                  /* mov r8, m8           */
+  case 0x8BU: break;                                             /* mov r, m             */
+  case 0xC6U: store = 1U; imm = 1U; size = 1U; break;            /* mov m8, imm8         */
+  case 0xC7U: store = 1U; imm = 4U; break;                       /* mov m, imm32         */
+  case 0xA0U: case 0xA1U: case 0xA2U: case 0xA3U:               /* movabs al/eax, moffs */
+    return Host_EmulateMoffs(pCtx, mem, opcode, rex, opsize, len, Write);
+  case 0x0FB6U: size = 1U; break;                                /* movzx r, m8          */
+  case 0x0FB7U: size = 2U; break;                                /* movzx r, m16         */
+  case 0x0FBEU: size = 1U; sign = 1U; break;                     /* movsx r, m8          */
+  case 0x0FBFU: size = 2U; sign = 1U; break;                     /* movsx r, m16         */
+  default:
+    return 0U;
+  }
+  if((opcode >= 0x0F00U) && (opsize != 0U))
+  {
+    /* 16-bit destination */
+    return 0U;
+  }
+  if((opcode == 0x89U) || (opcode == 0x8BU) || (opcode == 0xC7U))
+  {
+    size = ((rex & 0x8U) != 0U) ? 8U : ((opsize != 0U) ? 2U : 4U);
+    imm  = ((imm != 0U) && (size == 2U)) ? 2U : imm;
+  }
+
+  /* ModRM, SIB and displacement: only their length matters, the address is known */
+  modrm = pc[len++];
+  mod = modrm >> 6;
+  rm  = modrm & 7U;
+  reg = ((modrm >> 3) & 7U) | (((rex & 0x4U) != 0U) ? 8U : 0U);
+  if((mod == 3U) || (store != Write) || ((imm != 0U) && ((modrm & 0x38U) != 0U)) ||
+     (((opcode == 0x88U) || (opcode == 0x8AU)) && (rex == 0U) && (reg >= 4U)) || (((Address & 0xFFFU) + size) > HOST_PAGE_SIZE))
+  {
+    /* Register operand, AH..BH, or across the page: not handled */
+    return 0U;
+  }
+  if(rm == 4U)
+  {
+    rm = pc[len++] & 7U;                  /* SIB base */
+    if((mod == 0U) && (rm == 5U))
+    {
+      len += 4U;
+    }
+  }
+  else if((mod == 0U) && (rm == 5U))
+  {
+    len += 4U;                            /* RIP relative */
+  }
+  else
+  {
+    /* No displacement for mod 0 */
+  }
+  len += (mod == 1U) ? 1U : ((mod == 2U) ? 4U : 0U);
+
+  greg = &pCtx->uc_mcontext.gregs[regs[reg]];
+  if(store != 0U)
+  {
+    if(imm != 0U)
+    {
+      memcpy(&value, &pc[len], imm);
+      len += imm;
+      if(size == 8U)
+      {
+        value = (uint64_t)(int64_t)(int32_t)value;
+      }
+    }
+    else
+    {
+      value = (uint64_t)*greg;
+    }
+    memcpy(mem, &value, size);
+  }
+  else
+  {
+    memcpy(&value, mem, size);
+    if(sign != 0U)
+    {
+      svalue = (size == 1U) ? (int64_t)(int8_t)value : (int64_t)(int16_t)value;
+      *greg = ((rex & 0x8U) != 0U) ? (greg_t)svalue : (greg_t)(uint32_t)svalue;
+    }
+    else if((size == 4U) || (size == 8U) || (opcode >= 0x0F00U))
+    {
+      /* 32-bit results are zero extended */
+      *greg = (greg_t)value;
+    }
+    else
+    {
+      /* 8 and 16-bit moves keep the upper bits */
+      memcpy(greg, &value, size);
+    }
+  }
+
+  pCtx->uc_mcontext.gregs[REG_RIP] += (greg_t)len;
+
+  return 1U;
+}
+
+/**
+  * @brief  Page fault on a modelled register page.
+  * @param  Sig     Signal number
+  * @param  pInfo   Fault information
+  * @param  pCtx    Interrupted context
+  * @retval None
+  */
+static void Host_SegvHandler(int Sig, siginfo_t *pInfo, void *pCtx)
+{
+  ucontext_t *ctx = (ucontext_t *)pCtx;
+  uint64_t address = (uint64_t)(uintptr_t)pInfo->si_addr;
+  int index = Host_FindPeriph(address);
+  const Host_Periph_t *periph;
+  uint32_t word;
+
+  (void)Sig;
+  if((index < 0) || (Host_Pending.Periph != NULL))
+  {
+    fprintf(stderr, "host: segmentation fault at %p, pc %p\n", pInfo->si_addr,
+            (void *)(uintptr_t)ctx->uc_mcontext.gregs[REG_RIP]);
+    fflush(NULL);
+    signal(SIGSEGV, SIG_DFL);
+    return;
+  }
+
+  periph = Host_Periphs[index];
+  word = (uint32_t)address & ~3U;
+  Host_Pending.Periph  = periph;
+  Host_Pending.Address = word;
+  Host_Pending.Write   = ((ctx->uc_mcontext.gregs[REG_ERR] & HOST_X86_PF_WRITE) != 0) ? 1U : 0U;
+  Host_AdvanceTo(Host_Now + Host_PollCycles((uint64_t)ctx->uc_mcontext.gregs[REG_RIP], word, Host_Pending.Write));
+
+  if((Host_Pending.Write == 0U) && (periph->Read != NULL))
+  {
+    periph->Read(word - periph->Base);
+  }
+  Host_Pending.Old = *Host_Reg(word);
+  if(Host_Pending.Write == 0U)
+  {
+    Host_PollRead(word, Host_Pending.Old);
+  }
+
+  if(Host_Emulate(ctx, (uint32_t)address, Host_Pending.Write) != 0U)
+  {
+    Host_Pending.Periph = NULL;
+    if((Host_Pending.Write != 0U) && (periph->Write != NULL))
+    {
+      periph->Write(word - periph->Base, Host_Pending.Old, *Host_Reg(word));
+    }
+    Host_DeliverInterrupts();
+    return;
+  }
+
+  /* Run the faulting instruction alone on the open page */
+  (void)mprotect((void *)(uintptr_t)(word & ~(HOST_PAGE_SIZE - 1U)), HOST_PAGE_SIZE, PROT_READ | PROT_WRITE);
+  ctx->uc_mcontext.gregs[REG_EFL] |= HOST_X86_TF;
+}
+
+/**
+  * @brief  Single step trap after an access to a modelled register page.
+  * @param  Sig     Signal number
+  * @param  pInfo   Trap information
+  * @param  pCtx    Interrupted context
+  * @retval None
+  */
+static void Host_TrapHandler(int Sig, siginfo_t *pInfo, void *pCtx)
+{
+  ucontext_t *ctx = (ucontext_t *)pCtx;
+  Host_Access_t access = Host_Pending;
+
+  (void)Sig;
+  (void)pInfo;
+  if(access.Periph == NULL)
+  {
+    signal(SIGTRAP, SIG_DFL);
+    return;
+  }
+
+  Host_Pending.Periph = NULL;
+  (void)mprotect((void *)(uintptr_t)(access.Address & ~(HOST_PAGE_SIZE - 1U)), HOST_PAGE_SIZE, PROT_NONE);
+  ctx->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)HOST_X86_TF;
+
+  if((access.Write != 0U) && (access.Periph->Write != NULL))
+  {
+    access.Periph->Write(access.Address - access.Periph->Base, access.Old, *Host_Reg(access.Address));
+  }
+
+  Host_DeliverInterrupts();
+}
+
+/**
+  * @brief  Maps the memories and the modelled register pages.
+  * @retval None
+  */
+static void Host_MapMemory(void)
+{
+  const Host_Periph_t *periph;
+  uint32_t i, page, size = 0U, offset = 0U;
+  void *p;
+  int fd;
+
+  for(i = 0U; i < (sizeof(Host_Regions) / sizeof(Host_Regions[0])); i++)
+  {
+    p = mmap((void *)(uintptr_t)Host_Regions[i].Base, Host_Regions[i].Size, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | ((Host_Regions[i].NoReserve != 0) ? MAP_NORESERVE : 0),
+             -1, 0);
+    if(p != (void *)(uintptr_t)Host_Regions[i].Base)
+    {
+      Host_Fatal("cannot map the memory at", Host_Regions[i].Base);
+    }
+  }
+
+  /* Each register page is shared between its trapped view and the backdoor */
+  for(i = 0U; i < HOST_PERIPHS_NBR; i++)
+  {
+    size += Host_Periphs[i]->Size;
+  }
+  fd = memfd_create("host_registers", 0);
+  if((fd < 0) || (ftruncate(fd, (off_t)size) != 0))
+  {
+    Host_Fatal("cannot create the register file", 0U);
+  }
+
+  for(i = 0U; i < HOST_PERIPHS_NBR; i++)
+  {
+    periph = Host_Periphs[i];
+    if(periph->Size == 0U)
+    {
+      continue;
+    }
+    Host_Backdoor[i] = mmap(NULL, periph->Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, (off_t)offset);
+    if(Host_Backdoor[i] == MAP_FAILED)
+    {
+      Host_Fatal("cannot map the backdoor of", periph->Base);
+    }
+    for(page = 0U; page < periph->Size; page += HOST_PAGE_SIZE)
+    {
+      p = mmap((void *)(uintptr_t)(periph->Base + page), HOST_PAGE_SIZE, PROT_NONE, MAP_SHARED | MAP_FIXED, fd,
+               (off_t)(offset + page));
+      if(p == MAP_FAILED)
+      {
+        Host_Fatal("cannot map the registers at", periph->Base + page);
+      }
+    }
+    offset += periph->Size;
+  }
+}
+
+/**
+  * @brief  Entry of the test context, on the stack mapped below 4 GB.
+  * @retval None
+  */
+static void Host_TestEntry(void)
+{
+  uint32_t i;
+
+  for(i = 0U; i < HOST_PERIPHS_NBR; i++)
+  {
+    if(Host_Periphs[i]->Reset != NULL)
+    {
+      Host_Periphs[i]->Reset();
+    }
+  }
+
+  Host_TestStatus = Host_Test();
+}
+
+/**
+  * @brief  NVIC, SCB and SysTick registers: resets them.
+  * @retval None
+  */
+static void Host_ScsReset(void)
+{
+  memset(Host_IrqEnabled, 0, sizeof(Host_IrqEnabled));
+  memset(Host_IrqPending, 0, sizeof(Host_IrqPending));
+  memset(Host_IrqActive, 0, sizeof(Host_IrqActive));
+  memset(Host_IrqLine, 0, sizeof(Host_IrqLine));
+  memset(Host_IrqCount, 0, sizeof(Host_IrqCount));
+  /* Cortex-M7 r1p1 */
+  *Host_Reg((uint32_t)(uintptr_t)&SCB->CPUID) = 0x411FC271U;
+}
+
+/**
+  * @brief  NVIC, SCB and SysTick registers: read hook.
+  * @param  Offset  Register offset
+  * @retval None
+  */
+static void Host_ScsRead(uint32_t Offset)
+{
+  uint32_t n = (Offset & 0x7FU) / 4U;
+
+  if(n < (HOST_IRQ_NBR / 32U))
+  {
+    switch(Offset & ~0x7FU)
+    {
+    case HOST_NVIC_ISER:
+    case HOST_NVIC_ICER:
+      *Host_Reg(0xE000E000U + Offset) = Host_IrqEnabled[n];
+      break;
+    case HOST_NVIC_ISPR:
+    case HOST_NVIC_ICPR:
+      *Host_Reg(0xE000E000U + Offset) = Host_IrqPending[n];
+      break;
+    case HOST_NVIC_IABR:
+      *Host_Reg(0xE000E000U + Offset) = Host_IrqActive[n];
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  NVIC, SCB and SysTick registers: write hook.
+  * @param  Offset  Register offset
+  * @param  Old     Value before the write
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_ScsWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  uint32_t n = (Offset & 0x7FU) / 4U;
+
+  (void)Old;
+  if(n < (HOST_IRQ_NBR / 32U))
+  {
+    switch(Offset & ~0x7FU)
+    {
+    case HOST_NVIC_ISER:
+      Host_IrqEnabled[n] |= New;
+      break;
+    case HOST_NVIC_ICER:
+      Host_IrqEnabled[n] &= ~New;
+      break;
+    case HOST_NVIC_ISPR:
+      Host_IrqPending[n] |= New;
+      break;
+    case HOST_NVIC_ICPR:
+      /* A level still asserted pends the interrupt again */
+      Host_IrqPending[n] &= ~New | Host_IrqLine[n];
+      break;
+    default:
+      return;
+    }
+    Host_ScsRead(Offset);
+  }
+}
+
+/**
+  * @brief  DWT registers: resets them.
+  * @retval None
+  */
+static void Host_DwtReset(void)
+{
+  Host_DwtEnabled = 0U;
+  Host_DwtOrigin  = 0U;
+  Host_DwtFrozen  = 0U;
+}
+
+/**
+  * @brief  DWT registers: read hook, the cycle counter follows the virtual clock.
+  * @param  Offset  Register offset
+  * @retval None
+  */
+static void Host_DwtRead(uint32_t Offset)
+{
+  if(Offset == HOST_DWT_CYCCNT)
+  {
+    *Host_Reg(0xE0001000U + Offset) = (Host_DwtEnabled != 0U) ? (uint32_t)(Host_Now - Host_DwtOrigin) : Host_DwtFrozen;
+  }
+}
+
+/**
+  * @brief  DWT registers: write hook.
+  * @param  Offset  Register offset
+  * @param  Old     Value before the write
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_DwtWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  uint32_t count;
+
+  (void)Old;
+  Host_DwtRead(HOST_DWT_CYCCNT);
+  count = (Offset == HOST_DWT_CYCCNT) ? New : *Host_Reg(0xE0001000U + HOST_DWT_CYCCNT);
+  if(Offset == HOST_DWT_CTRL)
+  {
+    if(Host_DwtEnabled == 0U)
+    {
+      count = Host_DwtFrozen;
+    }
+    Host_DwtEnabled = New & DWT_CTRL_CYCCNTENA_Msk;
+  }
+  Host_DwtOrigin = Host_Now - count;
+  Host_DwtFrozen = count;
+  *Host_Reg(0xE0001000U + HOST_DWT_CYCCNT) = count;
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Maps the memory, then runs Host_Test() on a stack below 4 GB.
+  * @param  argc    Argument count
+  * @param  argv    Arguments, given to the test by Host_Argv()
+  * @retval Exit status: the test status, or 1 on a failed check
+  */
+int main(int argc, char **argv)
+{
+  struct sigaction action;
+  void *stack;
+
+  Host_ArgCount  = argc;
+  Host_ArgValues = argv;
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  Host_MapMemory();
+
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  action.sa_sigaction = Host_SegvHandler;
+  (void)sigaction(SIGSEGV, &action, NULL);
+  action.sa_sigaction = Host_TrapHandler;
+  (void)sigaction(SIGTRAP, &action, NULL);
+
+  stack = mmap((void *)(uintptr_t)HOST_STACK_BASE, HOST_STACK_SIZE, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if(stack != (void *)(uintptr_t)HOST_STACK_BASE)
+  {
+    Host_Fatal("cannot map the stack at", HOST_STACK_BASE);
+  }
+  (void)getcontext(&Host_TestContext);
+  Host_TestContext.uc_stack.ss_sp   = stack;
+  Host_TestContext.uc_stack.ss_size = HOST_STACK_SIZE;
+  Host_TestContext.uc_link          = &Host_MainContext;
+  makecontext(&Host_TestContext, Host_TestEntry, 0);
+  (void)swapcontext(&Host_MainContext, &Host_TestContext);
+
+  if(Host_Errors != 0)
+  {
+    printf("FAILED: %d check(s)\n", Host_Errors);
+    return 1;
+  }
+
+  return Host_TestStatus;
+}
+
+/**
+  * @brief  Gets the backdoor view of a modelled register, or the memory itself.
+  * @param  Address     Register address
+  * @retval Register pointer
+  */
+volatile uint32_t *Host_Reg(uint32_t Address)
+{
+  int index = Host_FindPeriph(Address);
+
+  if(index < 0)
+  {
+    return (volatile uint32_t *)(uintptr_t)Address;
+  }
+
+  return (volatile uint32_t *)(void *)(Host_Backdoor[index] + (Address - Host_Periphs[index]->Base));
+}
+
+/**
+  * @brief  Gets the virtual time.
+  * @retval CPU cycles since the start
+  */
+uint64_t Host_GetCycles(void)
+{
+  return Host_Now;
+}
+
+/**
+  * @brief  Converts CPU cycles to seconds.
+  * @param  Cycles      CPU cycles
+  * @retval Seconds
+  */
+double Host_Seconds(uint64_t Cycles)
+{
+  return (double)Cycles / (double)HOST_CPU_CLOCK;
+}
+
+/**
+  * @brief  Spends CPU time without taking interrupts, as code running with
+  *         the interrupts masked or in a handler.
+  * @param  Cycles      CPU cycles
+  * @retval None
+  */
+void Host_Advance(uint64_t Cycles)
+{
+  Host_AdvanceTo(Host_Now + Cycles);
+}
+
+/**
+  * @brief  Spends CPU time, taking the interrupts when they occur.
+  * @param  Cycles      CPU cycles
+  * @retval None
+  */
+void Host_Run(uint64_t Cycles)
+{
+  uint64_t end = Host_Now + Cycles;
+  uint64_t next;
+
+  Host_DeliverInterrupts();
+  while((next = Host_NextEvent()) <= end)
+  {
+    Host_AdvanceTo(next);
+    Host_DeliverInterrupts();
+  }
+  Host_AdvanceTo(end);
+  Host_DeliverInterrupts();
+}
+
+/**
+  * @brief  Runs until a flag takes a value, an event at a time.
+  * @param  pFlag       Flag
+  * @param  Mask        Bits of the flag to check
+  * @param  Value       Value to wait for
+  * @param  MaxCycles   Longest wait
+  * @retval None
+  */
+void Host_RunUntil(volatile const uint32_t *pFlag, uint32_t Mask, uint32_t Value, uint64_t MaxCycles)
+{
+  uint64_t end = Host_Now + MaxCycles;
+  uint64_t next;
+
+  Host_DeliverInterrupts();
+  while(((*pFlag & Mask) != Value) && (Host_Now < end))
+  {
+    next = Host_NextEvent();
+    Host_Run(((next == HOST_NEVER) || (next > end)) ? (end - Host_Now) : ((next > Host_Now) ? (next - Host_Now) : 1U));
+  }
+}
+
+/**
+  * @brief  Sets the level of a peripheral interrupt line.
+  * @param  IRQn        IRQ number
+  * @param  Level       1 asserted, 0 released
+  * @retval None
+  */
+void Host_SetIrqLine(IRQn_Type IRQn, uint32_t Level)
+{
+  uint32_t n = (uint32_t)IRQn / 32U, bit = 1UL << ((uint32_t)IRQn % 32U);
+
+  if(Level != 0U)
+  {
+    Host_IrqLine[n]    |= bit;
+    Host_IrqPending[n] |= bit;
+  }
+  else
+  {
+    Host_IrqLine[n] &= ~bit;
+  }
+}
+
+/**
+  * @brief  Runs the handlers of the pending interrupts, unless masked or
+  *         already in a handler.
+  * @retval None
+  */
+void Host_DeliverInterrupts(void)
+{
+  uint32_t n, bit, storm = 0U;
+  int irq;
+
+  while((Host_Primask == 0U) && (Host_Ipsr == 0U) && ((irq = Host_NextIrq()) >= 0))
+  {
+    n = (uint32_t)irq / 32U;
+    bit = 1UL << ((uint32_t)irq % 32U);
+    Host_IrqPending[n] &= ~bit;
+    Host_IrqActive[n]  |= bit;
+    Host_IrqCount[irq]++;
+    Host_Ipsr = (uint32_t)irq + 16U;
+    Host_AdvanceTo(Host_Now + 12U);
+    Host_CallHandler(irq);
+    Host_Ipsr = 0U;
+    Host_IrqActive[n] &= ~bit;
+    if((Host_IrqLine[n] & bit) != 0U)
+    {
+      Host_IrqPending[n] |= bit;
+    }
+    if(++storm > HOST_IRQ_STORM)
+    {
+      Host_Fatal("interrupt not cleared by its handler, IRQ", (uint64_t)irq);
+    }
+  }
+}
+
+/**
+  * @brief  Gets the number of times an interrupt handler ran.
+  * @param  IRQn        IRQ number
+  * @retval Count
+  */
+uint32_t Host_GetIrqCount(IRQn_Type IRQn)
+{
+  return Host_IrqCount[IRQn];
+}
+
+/**
+  * @brief  Gets the interrupt mask.
+  * @retval PRIMASK
+  */
+uint32_t Host_GetPrimask(void)
+{
+  return Host_Primask;
+}
+
+/**
+  * @brief  Sets the interrupt mask, then takes the pending interrupts.
+  * @param  Primask PRIMASK
+  * @retval None
+  */
+void Host_SetPrimask(uint32_t Primask)
+{
+  Host_Primask = Primask;
+  if(Primask == 0U)
+  {
+    Host_DeliverInterrupts();
+  }
+}
+
+/**
+  * @brief  Gets the active exception.
+  * @retval IPSR
+  */
+uint32_t Host_GetIpsr(void)
+{
+  return Host_Ipsr;
+}
+
+/**
+  * @brief  WFI: runs up to the next event, or to the pending interrupt.
+  * @retval None
+  */
+void Host_WaitForInterrupt(void)
+{
+  uint64_t next;
+
+  if(Host_NextIrq() < 0)
+  {
+    next = Host_NextEvent();
+    if(next == HOST_NEVER)
+    {
+      Host_Fatal("WFI without any event to come", 0U);
+    }
+    Host_Run((next > Host_Now) ? (next - Host_Now) : 0U);
+  }
+  else
+  {
+    Host_DeliverInterrupts();
+  }
+}
+
+/**
+  * @brief  D-cache maintenance: counted, and charged one cycle per line.
+  * @param  Op          HOST_DCACHE_CLEAN, _INVALIDATE or _CLEAN_INVALIDATE
+  * @param  Address     Start address, NULL for the whole cache
+  * @param  Size        Size in bytes
+  * @retval None
+  */
+void Host_DCacheOp(uint32_t Op, const void *Address, int32_t Size)
+{
+  (void)Op;
+  Host_Cache.Ops++;
+  if(Address == NULL)
+  {
+    Host_Cache.Whole++;
+    Host_Advance(2048U);
+  }
+  else if(Size > 0)
+  {
+    Host_Cache.Bytes += (uint64_t)Size;
+    Host_Advance(((uint64_t)Size + 31U) / 32U);
+  }
+  else
+  {
+    /* Nothing to maintain */
+  }
+}
+
+/**
+  * @brief  Gets the D-cache maintenance counters.
+  * @param  Stats   Counters
+  * @retval None
+  */
+void Host_GetCacheStats(Host_CacheStats_t *Stats)
+{
+  *Stats = Host_Cache;
+}
+
+/**
+  * @brief  Clears the D-cache maintenance counters.
+  * @retval None
+  */
+void Host_ResetCacheStats(void)
+{
+  memset(&Host_Cache, 0, sizeof(Host_Cache));
+}
+
+/**
+  * @brief  HAL time base on the virtual clock. Each call costs HOST_TICK_CYCLES,
+  *         so the polling loops of the HAL and BSP move time forward.
+  * @retval Milliseconds since the start
+  */
+uint32_t HAL_GetTick(void)
+{
+  Host_Advance(HOST_TICK_CYCLES);
+  Host_DeliverInterrupts();
+
+  return (uint32_t)(Host_Now / (HOST_CPU_CLOCK / 1000U));
+}
+
+/**
+  * @brief  HAL delay on the virtual clock, as the HAL one: at least Delay
+  *         full milliseconds.
+  * @param  Delay       Delay in ms
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  uint64_t tick = Host_Now / (HOST_CPU_CLOCK / 1000U);
+
+  Host_Run(((tick + Delay + 1U) * (HOST_CPU_CLOCK / 1000U)) - Host_Now);
+}
+
+/**
+  * @brief  Gets the argument count of the test program.
+  * @retval Arguments
+  */
+int Host_Argc(void)
+{
+  return Host_ArgCount;
+}
+
+/**
+  * @brief  Gets an argument of the test program.
+  * @param  Index   Argument, 0 for the program
+  * @retval Argument, or NULL
+  */
+const char *Host_Argv(int Index)
+{
+  return ((Index >= 0) && (Index < Host_ArgCount)) ? Host_ArgValues[Index] : NULL;
+}
+
+/**
+  * @brief  Wall clock, to measure the host throughput.
+  * @retval Seconds
+  */
+double Host_WallSeconds(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+  * @brief  Records a test check.
+  * @param  Condition   Check result
+  * @param  pExpr       Checked expression
+  * @param  pFile       Source file
+  * @param  Line        Source line
+  * @retval None
+  */
+void Host_Check(int Condition, const char *pExpr, const char *pFile, int Line)
+{
+  if(Condition == 0)
+  {
+    printf("%s:%d: check failed: %s\n", pFile, Line, pExpr);
+    Host_Errors++;
+  }
+}
+
+/**
+  * @brief  Gets the failed checks.
+  * @retval Failed checks
+  */
+int Host_Failures(void)
+{
+  return Host_Errors;
+}
@@ -0,0 +1,607 @@
+/**
+  ******************************************************************************
+  * @file    host_dma2d.c
+  * @brief   Host model of the DMA2D: register to memory, memory to memory with
+  *          or without pixel format conversion, blending, and CLUT loading,
+  *          with the transfer complete, CLUT transfer complete interrupts and
+  *          abort. A transfer lasts a setup time plus a cost per output pixel
+  *          set by the mode, and its pixels are written when it completes.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_DMA2D_SETUP_CYCLES       40U
+#define HOST_DMA2D_CLUT_CYCLES        2U       /* Per CLUT entry */
+
+#define HOST_DMA2D_M2M                0U
+#define HOST_DMA2D_M2M_PFC            1U
+#define HOST_DMA2D_M2M_BLEND          2U
+#define HOST_DMA2D_R2M                3U
+#define HOST_DMA2D_BLEND_FG           4U
+#define HOST_DMA2D_BLEND_BG           5U
+
+#define HOST_DMA2D_IDLE               0U
+#define HOST_DMA2D_XFER               1U
+#define HOST_DMA2D_FG_CLUT            2U
+#define HOST_DMA2D_BG_CLUT            3U
+
+/* Private macros ------------------------------------------------------------*/
+#define HOST_DMA2D                    ((DMA2D_TypeDef *)(uintptr_t)Host_Reg(DMA2D_BASE))
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Address;
+  uint32_t Offset;
+  uint32_t Pfccr;
+  uint32_t Color;
+  const uint32_t *pClut;
+} Host_Dma2dLayer_t;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_Dma2dReset(void);
+static void Host_Dma2dWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+static uint64_t Host_Dma2dNextEvent(void);
+static void Host_Dma2dEvent(uint64_t Now);
+
+/* Exported variables --------------------------------------------------------*/
+const Host_Periph_t Host_Dma2dPeriph =
+{
+  "DMA2D", DMA2D_BASE, 0x1000U, Host_Dma2dReset, NULL, Host_Dma2dWrite, Host_Dma2dNextEvent, Host_Dma2dEvent
+};
+
+/* Private variables ---------------------------------------------------------*/
+static DMA2D_TypeDef     Host_Dma2dJobRegs;      /* Registers latched at the start */
+static uint32_t          Host_Dma2dState;
+static uint64_t          Host_Dma2dStart;
+static uint64_t          Host_Dma2dEnd;
+static uint32_t          Host_Dma2dClut[2][256];
+static Host_Dma2dStats_t Host_Dma2dStatistics;
+static Host_Dma2dHook_t  Host_Dma2dJobHook;
+static uint32_t          Host_Dma2dCost[3] = { 2U, 4U, 6U };
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gets the size of a pixel.
+  * @param  Cm      Color mode of an input, or DMA2D_OUTPUT_xxx
+  * @retval Bits per pixel
+  */
+static uint32_t Host_Dma2dBits(uint32_t Cm)
+{
+  static const uint8_t bits[16] = { 32U, 24U, 16U, 16U, 16U, 8U, 8U, 16U, 4U, 8U, 4U, 0U, 0U, 0U, 0U, 0U };
+
+  return bits[Cm & 0xFU];
+}
+
+/**
+  * @brief  Expands a color field to 8 bits, replicating its MSBs.
+  * @param  Value   Field value
+  * @param  Bits    Field size
+  * @retval 8-bit value
+  */
+static uint32_t Host_Dma2dExpand(uint32_t Value, uint32_t Bits)
+{
+  uint32_t v = Value << (8U - Bits);
+
+  return v | (v >> Bits);
+}
+
+/**
+  * @brief  Reads an input pixel as ARGB8888, alpha and swap options applied.
+  * @param  pLayer  Input layer
+  * @param  Width   Pixels per line
+  * @param  Lom     Line offset in bytes (1) or in pixels (0)
+  * @param  X       Column
+  * @param  Y       Line
+  * @retval ARGB8888 pixel
+  */
+static uint32_t Host_Dma2dFetch(const Host_Dma2dLayer_t *pLayer, uint32_t Width, uint32_t Lom, uint32_t X, uint32_t Y)
+{
+  uint32_t cm = pLayer->Pfccr & DMA2D_FGPFCCR_CM;
+  uint32_t bits = Host_Dma2dBits(cm);
+  uint64_t pitch = (Lom != 0U) ? (((uint64_t)Width * bits) + (8U * (uint64_t)pLayer->Offset)) :
+                                 ((uint64_t)(Width + pLayer->Offset) * bits);
+  uint64_t bit = (Y * pitch) + ((uint64_t)X * bits);
+  const uint8_t *p = (const uint8_t *)(uintptr_t)(pLayer->Address + (uint32_t)(bit / 8U));
+  uint32_t a = 0xFFU, rgb = 0U, v, alpha, am, r, b;
+
+  switch(cm)
+  {
+  case DMA2D_INPUT_ARGB8888:
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    a = v >> 24;
+    rgb = v & 0xFFFFFFU;
+    break;
+  case DMA2D_INPUT_RGB888:
+    rgb = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    break;
+  case DMA2D_INPUT_RGB565:
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    rgb = (Host_Dma2dExpand(v >> 11, 5U) << 16) | (Host_Dma2dExpand((v >> 5) & 0x3FU, 6U) << 8) |
+          Host_Dma2dExpand(v & 0x1FU, 5U);
+    break;
+  case DMA2D_INPUT_ARGB1555:
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    a = ((v & 0x8000U) != 0U) ? 0xFFU : 0U;
+    rgb = (Host_Dma2dExpand((v >> 10) & 0x1FU, 5U) << 16) | (Host_Dma2dExpand((v >> 5) & 0x1FU, 5U) << 8) |
+          Host_Dma2dExpand(v & 0x1FU, 5U);
+    break;
+  case DMA2D_INPUT_ARGB4444:
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    a = ((v >> 12) & 0xFU) * 17U;
+    rgb = ((((v >> 8) & 0xFU) * 17U) << 16) | ((((v >> 4) & 0xFU) * 17U) << 8) | ((v & 0xFU) * 17U);
+    break;
+  case DMA2D_INPUT_L8:
+    v = pLayer->pClut[p[0]];
+    a = v >> 24;
+    rgb = v & 0xFFFFFFU;
+    break;
+  case DMA2D_INPUT_AL44:
+    v = pLayer->pClut[p[0] & 0xFU];
+    a = (uint32_t)(p[0] >> 4) * 17U;
+    rgb = v & 0xFFFFFFU;
+    break;
+  case DMA2D_INPUT_AL88:
+    v = pLayer->pClut[p[0]];
+    a = p[1];
+    rgb = v & 0xFFFFFFU;
+    break;
+  case DMA2D_INPUT_L4:
+    v = pLayer->pClut[((bit % 8U) != 0U) ? (uint32_t)(p[0] >> 4) : (uint32_t)(p[0] & 0xFU)];
+    a = v >> 24;
+    rgb = v & 0xFFFFFFU;
+    break;
+  case DMA2D_INPUT_A8:
+    a = p[0];
+    rgb = pLayer->Color & 0xFFFFFFU;
+    break;
+  case DMA2D_INPUT_A4:
+    a = (((bit % 8U) != 0U) ? (uint32_t)(p[0] >> 4) : (uint32_t)(p[0] & 0xFU)) * 17U;
+    rgb = pLayer->Color & 0xFFFFFFU;
+    break;
+  default:
+    break;
+  }
+
+  if((pLayer->Pfccr & DMA2D_FGPFCCR_AI) != 0U)
+  {
+    a = 0xFFU - a;
+  }
+  alpha = pLayer->Pfccr >> DMA2D_FGPFCCR_ALPHA_Pos;
+  am = (pLayer->Pfccr & DMA2D_FGPFCCR_AM) >> DMA2D_FGPFCCR_AM_Pos;
+  if(am == 1U)
+  {
+    a = alpha;
+  }
+  else if(am == 2U)
+  {
+    a = (a * alpha) / 255U;
+  }
+  else
+  {
+    /* Alpha kept */
+  }
+  if((pLayer->Pfccr & DMA2D_FGPFCCR_RBS) != 0U)
+  {
+    r = (rgb >> 16) & 0xFFU;
+    b = rgb & 0xFFU;
+    rgb = (rgb & 0x00FF00U) | (b << 16) | r;
+  }
+
+  return (a << 24) | rgb;
+}
+
+/**
+  * @brief  Blends a foreground pixel over a background pixel, as the DMA2D.
+  * @param  Fg      ARGB8888 foreground
+  * @param  Bg      ARGB8888 background
+  * @retval ARGB8888 result
+  */
+static uint32_t Host_Dma2dBlend(uint32_t Fg, uint32_t Bg)
+{
+  uint32_t afg = Fg >> 24, abg = Bg >> 24;
+  uint32_t amult = (afg * abg) / 255U;
+  uint32_t aout = afg + abg - amult;
+  uint32_t out = aout << 24, shift, cfg, cbg;
+
+  if(aout == 0U)
+  {
+    return 0U;
+  }
+  for(shift = 0U; shift < 24U; shift += 8U)
+  {
+    cfg = (Fg >> shift) & 0xFFU;
+    cbg = (Bg >> shift) & 0xFFU;
+    out |= (((cfg * afg) + (cbg * abg) - (cbg * amult)) / aout) << shift;
+  }
+
+  return out;
+}
+
+/**
+  * @brief  Writes an output pixel from ARGB8888.
+  * @param  pDst    Pixel address
+  * @param  Opfccr  Output PFC control register
+  * @param  Argb    ARGB8888 pixel
+  * @retval None
+  */
+static void Host_Dma2dStore(uint8_t *pDst, uint32_t Opfccr, uint32_t Argb)
+{
+  uint32_t a = Argb >> 24, r = (Argb >> 16) & 0xFFU, g = (Argb >> 8) & 0xFFU, b = Argb & 0xFFU, t, v;
+
+  if((Opfccr & DMA2D_OPFCCR_AI) != 0U)
+  {
+    a = 0xFFU - a;
+  }
+  if((Opfccr & DMA2D_OPFCCR_RBS) != 0U)
+  {
+    t = r;
+    r = b;
+    b = t;
+  }
+
+  switch(Opfccr & DMA2D_OPFCCR_CM)
+  {
+  case DMA2D_OUTPUT_ARGB8888:
+    pDst[0] = (uint8_t)b;
+    pDst[1] = (uint8_t)g;
+    pDst[2] = (uint8_t)r;
+    pDst[3] = (uint8_t)a;
+    break;
+  case DMA2D_OUTPUT_RGB888:
+    pDst[0] = (uint8_t)b;
+    pDst[1] = (uint8_t)g;
+    pDst[2] = (uint8_t)r;
+    break;
+  case DMA2D_OUTPUT_RGB565:
+    v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    pDst[0] = (uint8_t)v;
+    pDst[1] = (uint8_t)(v >> 8);
+    break;
+  case DMA2D_OUTPUT_ARGB1555:
+    v = ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+    pDst[0] = (uint8_t)v;
+    pDst[1] = (uint8_t)(v >> 8);
+    break;
+  default:
+    v = ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+    pDst[0] = (uint8_t)v;
+    pDst[1] = (uint8_t)(v >> 8);
+    break;
+  }
+}
+
+/**
+  * @brief  Updates the DMA2D interrupt line.
+  * @retval None
+  */
+static void Host_Dma2dIrq(void)
+{
+  DMA2D_TypeDef *dma2d = HOST_DMA2D;
+
+  Host_SetIrqLine(DMA2D_IRQn, ((dma2d->ISR & (dma2d->CR >> DMA2D_CR_TEIE_Pos) & 0x3FU) != 0U) ? 1U : 0U);
+}
+
+/**
+  * @brief  Runs the latched transfer: writes the output pixels.
+  * @retval None
+  */
+static void Host_Dma2dTransfer(void)
+{
+  const DMA2D_TypeDef *regs = &Host_Dma2dJobRegs;
+  uint32_t mode = (regs->CR & DMA2D_CR_MODE) >> DMA2D_CR_MODE_Pos;
+  uint32_t lom = ((regs->CR & DMA2D_CR_LOM) != 0U) ? 1U : 0U;
+  uint32_t width = (regs->NLR & DMA2D_NLR_PL) >> DMA2D_NLR_PL_Pos;
+  uint32_t height = regs->NLR & DMA2D_NLR_NL;
+  uint32_t obits = Host_Dma2dBits(regs->OPFCCR & DMA2D_OPFCCR_CM);
+  uint32_t ooffset = regs->OOR & DMA2D_OOR_LO;
+  uint64_t pitch = (lom != 0U) ? ((((uint64_t)width * obits) / 8U) + ooffset) : (((uint64_t)(width + ooffset) * obits) / 8U);
+  Host_Dma2dLayer_t fg, bg;
+  uint32_t x, y, argb, raw, nbytes;
+  uint8_t *dst;
+
+  fg.Address = regs->FGMAR;
+  fg.Offset  = regs->FGOR & DMA2D_FGOR_LO;
+  fg.Pfccr   = regs->FGPFCCR;
+  fg.Color   = regs->FGCOLR;
+  fg.pClut   = Host_Dma2dClut[0];
+  bg.Address = regs->BGMAR;
+  bg.Offset  = regs->BGOR & DMA2D_BGOR_LO;
+  bg.Pfccr   = regs->BGPFCCR;
+  bg.Color   = regs->BGCOLR;
+  bg.pClut   = Host_Dma2dClut[1];
+
+  for(y = 0U; y < height; y++)
+  {
+    dst = (uint8_t *)(uintptr_t)(regs->OMAR + (uint32_t)(y * pitch));
+    if(mode == HOST_DMA2D_M2M)
+    {
+      /* Raw copy of the foreground pixels */
+      nbytes = (width * Host_Dma2dBits(fg.Pfccr & DMA2D_FGPFCCR_CM)) / 8U;
+      memmove(dst, (const uint8_t *)(uintptr_t)(fg.Address + (y * ((lom != 0U) ? (nbytes + fg.Offset) :
+                   (((width + fg.Offset) * Host_Dma2dBits(fg.Pfccr & DMA2D_FGPFCCR_CM)) / 8U)))), nbytes);
+      continue;
+    }
+    for(x = 0U; x < width; x++)
+    {
+      switch(mode)
+      {
+      case HOST_DMA2D_R2M:
+        raw = regs->OCOLR;
+        memcpy(&dst[(x * obits) / 8U], &raw, obits / 8U);
+        continue;
+      case HOST_DMA2D_M2M_PFC:
+        argb = Host_Dma2dFetch(&fg, width, lom, x, y);
+        break;
+      case HOST_DMA2D_BLEND_FG:
+        argb = Host_Dma2dBlend(((fg.Pfccr >> DMA2D_FGPFCCR_ALPHA_Pos) << 24) | (fg.Color & 0xFFFFFFU),
+                               Host_Dma2dFetch(&bg, width, lom, x, y));
+        break;
+      case HOST_DMA2D_BLEND_BG:
+        argb = Host_Dma2dBlend(Host_Dma2dFetch(&fg, width, lom, x, y),
+                               ((bg.Pfccr >> DMA2D_BGPFCCR_ALPHA_Pos) << 24) | (bg.Color & 0xFFFFFFU));
+        break;
+      default:
+        argb = Host_Dma2dBlend(Host_Dma2dFetch(&fg, width, lom, x, y), Host_Dma2dFetch(&bg, width, lom, x, y));
+        break;
+      }
+      Host_Dma2dStore(&dst[(x * obits) / 8U], regs->OPFCCR, argb);
+    }
+  }
+}
+
+/**
+  * @brief  Latches the registers and starts a transfer.
+  * @retval None
+  */
+static void Host_Dma2dStartTransfer(void)
+{
+  DMA2D_TypeDef *dma2d = HOST_DMA2D;
+  uint32_t mode, pixels, cost, fgbits, bgbits;
+
+  memcpy(&Host_Dma2dJobRegs, dma2d, offsetof(DMA2D_TypeDef, RESERVED));
+  mode = (dma2d->CR & DMA2D_CR_MODE) >> DMA2D_CR_MODE_Pos;
+  pixels = ((dma2d->NLR & DMA2D_NLR_PL) >> DMA2D_NLR_PL_Pos) * (dma2d->NLR & DMA2D_NLR_NL);
+  fgbits = Host_Dma2dBits(dma2d->FGPFCCR & DMA2D_FGPFCCR_CM);
+  bgbits = Host_Dma2dBits(dma2d->BGPFCCR & DMA2D_BGPFCCR_CM);
+
+  if(mode == HOST_DMA2D_R2M)
+  {
+    cost = Host_Dma2dCost[0];
+    fgbits = 0U;
+    bgbits = 0U;
+  }
+  else if((mode == HOST_DMA2D_M2M) || (mode == HOST_DMA2D_M2M_PFC))
+  {
+    cost = Host_Dma2dCost[1];
+    bgbits = 0U;
+  }
+  else
+  {
+    cost = Host_Dma2dCost[2];
+    fgbits = (mode == HOST_DMA2D_BLEND_FG) ? 0U : fgbits;
+    bgbits = (mode == HOST_DMA2D_BLEND_BG) ? 0U : bgbits;
+  }
+
+  Host_Dma2dStatistics.BytesRead    += ((uint64_t)pixels * (fgbits + bgbits)) / 8U;
+  Host_Dma2dStatistics.BytesWritten += ((uint64_t)pixels * Host_Dma2dBits(dma2d->OPFCCR & DMA2D_OPFCCR_CM)) / 8U;
+  Host_Dma2dStatistics.Pixels       += pixels;
+
+  Host_Dma2dState = HOST_DMA2D_XFER;
+  Host_Dma2dStart = Host_GetCycles();
+  Host_Dma2dEnd   = Host_Dma2dStart + HOST_DMA2D_SETUP_CYCLES + ((uint64_t)pixels * cost);
+}
+
+/**
+  * @brief  Starts a CLUT load.
+  * @param  Background  0 for the foreground CLUT, 1 for the background one
+  * @retval None
+  */
+static void Host_Dma2dStartClut(uint32_t Background)
+{
+  DMA2D_TypeDef *dma2d = HOST_DMA2D;
+  uint32_t pfccr = (Background != 0U) ? dma2d->BGPFCCR : dma2d->FGPFCCR;
+  uint32_t size = ((pfccr & DMA2D_FGPFCCR_CS) >> DMA2D_FGPFCCR_CS_Pos) + 1U;
+
+  memcpy(&Host_Dma2dJobRegs, dma2d, offsetof(DMA2D_TypeDef, RESERVED));
+  Host_Dma2dState = (Background != 0U) ? HOST_DMA2D_BG_CLUT : HOST_DMA2D_FG_CLUT;
+  Host_Dma2dStart = Host_GetCycles();
+  Host_Dma2dEnd   = Host_Dma2dStart + HOST_DMA2D_SETUP_CYCLES + ((uint64_t)size * HOST_DMA2D_CLUT_CYCLES);
+}
+
+/**
+  * @brief  Copies the latched CLUT from memory.
+  * @retval None
+  */
+static void Host_Dma2dLoadClut(void)
+{
+  uint32_t background = (Host_Dma2dState == HOST_DMA2D_BG_CLUT) ? 1U : 0U;
+  uint32_t pfccr = (background != 0U) ? Host_Dma2dJobRegs.BGPFCCR : Host_Dma2dJobRegs.FGPFCCR;
+  const uint8_t *src = (const uint8_t *)(uintptr_t)((background != 0U) ? Host_Dma2dJobRegs.BGCMAR : Host_Dma2dJobRegs.FGCMAR);
+  volatile uint32_t *regs = (background != 0U) ? HOST_DMA2D->BGCLUT : HOST_DMA2D->FGCLUT;
+  uint32_t size = ((pfccr & DMA2D_FGPFCCR_CS) >> DMA2D_FGPFCCR_CS_Pos) + 1U;
+  uint32_t i;
+
+  for(i = 0U; i < size; i++)
+  {
+    if((pfccr & DMA2D_FGPFCCR_CCM) != 0U)
+    {
+      Host_Dma2dClut[background][i] = 0xFF000000U | (uint32_t)src[3U * i] | ((uint32_t)src[(3U * i) + 1U] << 8) |
+                                      ((uint32_t)src[(3U * i) + 2U] << 16);
+    }
+    else
+    {
+      Host_Dma2dClut[background][i] = (uint32_t)src[4U * i] | ((uint32_t)src[(4U * i) + 1U] << 8) |
+                                      ((uint32_t)src[(4U * i) + 2U] << 16) | ((uint32_t)src[(4U * i) + 3U] << 24);
+    }
+    regs[i] = Host_Dma2dClut[background][i];
+  }
+}
+
+/**
+  * @brief  DMA2D: resets it.
+  * @retval None
+  */
+static void Host_Dma2dReset(void)
+{
+  Host_Dma2dState = HOST_DMA2D_IDLE;
+  memset(Host_Dma2dClut, 0, sizeof(Host_Dma2dClut));
+  Host_Dma2dResetStats();
+}
+
+/**
+  * @brief  DMA2D: write hook.
+  * @param  Offset  Register offset
+  * @param  Old     Value before the write
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_Dma2dWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  DMA2D_TypeDef *dma2d = HOST_DMA2D;
+
+  switch(Offset)
+  {
+  case offsetof(DMA2D_TypeDef, CR):
+    if((New & DMA2D_CR_ABORT) != 0U)
+    {
+      /* The transfer stops where it is, without the transfer complete flag */
+      Host_Dma2dState = HOST_DMA2D_IDLE;
+      dma2d->CR &= ~(DMA2D_CR_START | DMA2D_CR_ABORT);
+      dma2d->FGPFCCR &= ~DMA2D_FGPFCCR_START;
+      dma2d->BGPFCCR &= ~DMA2D_BGPFCCR_START;
+    }
+    else if(((New & DMA2D_CR_START) != 0U) && ((Old & DMA2D_CR_START) == 0U) && (Host_Dma2dState == HOST_DMA2D_IDLE))
+    {
+      Host_Dma2dStartTransfer();
+    }
+    else
+    {
+      /* Interrupt enables */
+    }
+    break;
+  case offsetof(DMA2D_TypeDef, IFCR):
+    dma2d->ISR &= ~New;
+    dma2d->IFCR = 0U;
+    break;
+  case offsetof(DMA2D_TypeDef, FGPFCCR):
+  case offsetof(DMA2D_TypeDef, BGPFCCR):
+    if(((New & DMA2D_FGPFCCR_START) != 0U) && ((Old & DMA2D_FGPFCCR_START) == 0U) && (Host_Dma2dState == HOST_DMA2D_IDLE))
+    {
+      Host_Dma2dStartClut((Offset == offsetof(DMA2D_TypeDef, BGPFCCR)) ? 1U : 0U);
+    }
+    break;
+  default:
+    if((Offset >= offsetof(DMA2D_TypeDef, FGCLUT)) && (Offset < (offsetof(DMA2D_TypeDef, BGCLUT) + 0x400U)))
+    {
+      /* CLUT written by the CPU */
+      Host_Dma2dClut[(Offset >= offsetof(DMA2D_TypeDef, BGCLUT)) ? 1U : 0U][(Offset / 4U) % 256U] = New;
+    }
+    break;
+  }
+
+  Host_Dma2dIrq();
+}
+
+/**
+  * @brief  Gets the end of the running transfer or CLUT load.
+  * @retval Absolute cycle, or HOST_NEVER
+  */
+static uint64_t Host_Dma2dNextEvent(void)
+{
+  return (Host_Dma2dState == HOST_DMA2D_IDLE) ? HOST_NEVER : Host_Dma2dEnd;
+}
+
+/**
+  * @brief  DMA2D: end of the transfer or of the CLUT load.
+  * @param  Now     Current cycle
+  * @retval None
+  */
+static void Host_Dma2dEvent(uint64_t Now)
+{
+  DMA2D_TypeDef *dma2d = HOST_DMA2D;
+  Host_Dma2dJob_t job;
+
+  (void)Now;
+  if(Host_Dma2dState == HOST_DMA2D_XFER)
+  {
+    Host_Dma2dTransfer();
+    dma2d->CR &= ~DMA2D_CR_START;
+    dma2d->ISR |= DMA2D_ISR_TCIF;
+    Host_Dma2dStatistics.Jobs++;
+    Host_Dma2dStatistics.BusyCycles += Host_Dma2dEnd - Host_Dma2dStart;
+    if(Host_Dma2dJobHook != NULL)
+    {
+      job.Start   = Host_Dma2dStart;
+      job.End     = Host_Dma2dEnd;
+      job.Mode    = (Host_Dma2dJobRegs.CR & DMA2D_CR_MODE) >> DMA2D_CR_MODE_Pos;
+      job.Address = Host_Dma2dJobRegs.OMAR;
+      job.Width   = (Host_Dma2dJobRegs.NLR & DMA2D_NLR_PL) >> DMA2D_NLR_PL_Pos;
+      job.Height  = Host_Dma2dJobRegs.NLR & DMA2D_NLR_NL;
+      job.Pitch   = ((job.Width + (Host_Dma2dJobRegs.OOR & DMA2D_OOR_LO)) *
+                     Host_Dma2dBits(Host_Dma2dJobRegs.OPFCCR & DMA2D_OPFCCR_CM)) / 8U;
+      Host_Dma2dState = HOST_DMA2D_IDLE;
+      Host_Dma2dJobHook(&job);
+    }
+  }
+  else
+  {
+    Host_Dma2dLoadClut();
+    if(Host_Dma2dState == HOST_DMA2D_BG_CLUT)
+    {
+      dma2d->BGPFCCR &= ~DMA2D_BGPFCCR_START;
+    }
+    else
+    {
+      dma2d->FGPFCCR &= ~DMA2D_FGPFCCR_START;
+    }
+    dma2d->ISR |= DMA2D_ISR_CTCIF;
+  }
+
+  Host_Dma2dState = HOST_DMA2D_IDLE;
+  Host_Dma2dIrq();
+}
+
+/* Exported functions --------------------------------------------------------*/
+void Host_Dma2dGetStats(Host_Dma2dStats_t *Stats)
+{
+  *Stats = Host_Dma2dStatistics;
+}
+
+/**
+  * @brief  Clears the DMA2D counters.
+  * @retval None
+  */
+void Host_Dma2dResetStats(void)
+{
+  memset(&Host_Dma2dStatistics, 0, sizeof(Host_Dma2dStatistics));
+}
+
+/**
+  * @brief  Sets the function told of each completed transfer.
+  * @param  Hook    Function, or NULL
+  * @retval None
+  */
+void Host_Dma2dSetHook(Host_Dma2dHook_t Hook)
+{
+  Host_Dma2dJobHook = Hook;
+}
+
+/**
+  * @brief  Sets the cost of an output pixel, in CPU cycles.
+  * @param  FillCycles  Register to memory
+  * @param  CopyCycles  Memory to memory, with or without conversion
+  * @param  BlendCycles Blending
+  * @retval None
+  */
+void Host_Dma2dSetCost(uint32_t FillCycles, uint32_t CopyCycles, uint32_t BlendCycles)
+{
+  Host_Dma2dCost[0] = FillCycles;
+  Host_Dma2dCost[1] = CopyCycles;
+  Host_Dma2dCost[2] = BlendCycles;
+}
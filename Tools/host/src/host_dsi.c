@@ -0,0 +1,644 @@
+/**
+  ******************************************************************************
+  * @file    host_dsi.c
+  * @brief   Host model of the DSI host: wrapper regulator and PLL, D-PHY lane
+  *          states with the ULPM entry and exit, generic packet interface with
+  *          the command, payload and read FIFOs, adapted command mode refresh
+  *          and tearing effect. Every packet is logged with the time it is
+  *          queued and the time it leaves the link. Packets are sent one after
+  *          the other, in low power or high speed mode as set in CMCR:
+  *          - low power: 16 escape clocks per byte plus 40 for the entry and
+  *            exit sequences, the escape clock being the lane byte clock
+  *            divided by TXECKDIV,
+  *          - high speed: the bytes shared on the data lanes, plus the LP to HS
+  *            and HS to LP times of DLTCR, in lane byte clocks.
+  *          The FIFO depths are estimates: 16 headers and 64 payload words.
+  *          The connected panel answers the DCS ID reads.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "host_periph.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_DSI_CMD_FIFO             16U      /* Headers                    */
+#define HOST_DSI_PAYLOAD_FIFO         64U      /* 32-bit words               */
+#define HOST_DSI_QUEUE                64U
+#define HOST_DSI_READ_FIFO            16U
+#define HOST_DSI_LP_BYTE              16U      /* Escape clocks per byte     */
+#define HOST_DSI_LP_OVERHEAD          40U      /* Escape clocks per packet   */
+#define HOST_DSI_BTA                  200U     /* Escape clocks, turnaround  */
+#define HOST_DSI_TE_CYCLES            (HOST_CPU_CLOCK / 60U)
+
+#define HOST_DSI_MAX_RETURN           0x37U
+#define HOST_DSI_DCS_READ             0x06U
+
+/* Private macros ------------------------------------------------------------*/
+#define HOST_DSI                      ((DSI_TypeDef *)(uintptr_t)Host_Reg(DSI_BASE))
+#define HOST_DSI_LONG(type)           ((((type) & 0x0FU) == 0x09U) || ((type) == 0x39U) || ((type) == 0x29U))
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t Start;
+  uint64_t End;
+  uint32_t Words;
+} Host_DsiQueued_t;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_DsiReset(void);
+static void Host_DsiRead(uint32_t Offset);
+static void Host_DsiWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+static uint64_t Host_DsiNextEvent(void);
+static void Host_DsiEvent(uint64_t Now);
+
+/* Exported variables --------------------------------------------------------*/
+const Host_Periph_t Host_DsiPeriph =
+{
+  "DSI", DSI_BASE, 0x1000U, Host_DsiReset, Host_DsiRead, Host_DsiWrite, Host_DsiNextEvent, Host_DsiEvent
+};
+
+/* Private variables ---------------------------------------------------------*/
+static Host_DsiPacket_t Host_DsiLog[HOST_DSI_PACKETS_MAX];
+static uint32_t         Host_DsiLogNbr;
+static Host_DsiQueued_t Host_DsiQueue[HOST_DSI_QUEUE];
+static uint32_t         Host_DsiQueueNbr;
+static uint64_t         Host_DsiLinkFree;          /* End of the last queued packet */
+static uint32_t         Host_DsiPayload[1024];     /* Words not yet in a packet     */
+static uint32_t         Host_DsiPayloadNbr;
+static uint32_t         Host_DsiReadFifo[HOST_DSI_READ_FIFO];
+static uint32_t         Host_DsiReadNbr;
+static uint32_t         Host_DsiReadWords[HOST_DSI_READ_FIFO];
+static uint32_t         Host_DsiReadPending;       /* Words of the coming response  */
+static uint64_t         Host_DsiReadTime;
+static uint32_t         Host_DsiMaxReturn;
+static uint64_t         Host_DsiRefreshEnd;
+static uint64_t         Host_DsiNextTe;
+static uint32_t         Host_DsiTe;
+static uint32_t         Host_DsiUlpm;
+static uint64_t         Host_DsiUlpmStart;
+static Host_DsiStats_t  Host_DsiStatistics;
+static Host_Panel_t     Host_DsiPanelType = HOST_PANEL_RASPBERRYPI;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gets the lane byte clock from the DSI PLL setting.
+  * @retval Frequency in Hz
+  */
+static double Host_DsiLaneByteClock(void)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+  uint32_t ndiv = (dsi->WRPCR & DSI_WRPCR_PLL_NDIV) >> DSI_WRPCR_PLL_NDIV_Pos;
+  uint32_t idf  = (dsi->WRPCR & DSI_WRPCR_PLL_IDF) >> DSI_WRPCR_PLL_IDF_Pos;
+  uint32_t odf  = (dsi->WRPCR & DSI_WRPCR_PLL_ODF) >> DSI_WRPCR_PLL_ODF_Pos;
+
+  if((ndiv == 0U) || (idf == 0U))
+  {
+    return 62500000.0;
+  }
+
+  return ((double)HSE_VALUE * 2.0 * (double)ndiv) / (double)idf / (double)(16UL << odf);
+}
+
+/**
+  * @brief  Converts lane byte clock cycles to CPU cycles.
+  * @param  Cycles  Lane byte clock cycles
+  * @retval CPU cycles
+  */
+static uint64_t Host_DsiCycles(double Cycles)
+{
+  return (uint64_t)((Cycles * (double)HOST_CPU_CLOCK) / Host_DsiLaneByteClock()) + 1U;
+}
+
+/**
+  * @brief  Gets the time to send a packet.
+  * @param  Type    Data type
+  * @param  Bytes   Packet bytes, header and checksum included
+  * @retval CPU cycles
+  */
+static uint64_t Host_DsiPacketCycles(uint32_t Type, uint32_t Bytes)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+  uint32_t lanes = ((dsi->PCONFR & DSI_PCONFR_NL) != 0U) ? 2U : 1U;
+  uint32_t div = dsi->CCR & DSI_CCR_TXECKDIV;
+  uint32_t bit;
+  double cycles;
+
+  switch(Type)
+  {
+  case 0x03U: bit = DSI_CMCR_GSW0TX; break;
+  case 0x13U: bit = DSI_CMCR_GSW1TX; break;
+  case 0x23U: bit = DSI_CMCR_GSW2TX; break;
+  case 0x04U: bit = DSI_CMCR_GSR0TX; break;
+  case 0x14U: bit = DSI_CMCR_GSR1TX; break;
+  case 0x24U: bit = DSI_CMCR_GSR2TX; break;
+  case 0x29U: bit = DSI_CMCR_GLWTX;  break;
+  case 0x05U: bit = DSI_CMCR_DSW0TX; break;
+  case 0x15U: bit = DSI_CMCR_DSW1TX; break;
+  case 0x06U: bit = DSI_CMCR_DSR0TX; break;
+  case 0x39U: bit = DSI_CMCR_DLWTX;  break;
+  default:    bit = DSI_CMCR_MRDPS;  break;
+  }
+
+  if((dsi->CMCR & bit) != 0U)
+  {
+    /* Low power, escape mode */
+    cycles = (double)((Bytes * HOST_DSI_LP_BYTE) + HOST_DSI_LP_OVERHEAD) * (double)((div == 0U) ? 1U : div);
+  }
+  else
+  {
+    cycles = (double)(((Bytes + lanes) - 1U) / lanes) +
+             (double)((dsi->DLTCR & DSI_DLTCR_LP2HS_TIME) >> DSI_DLTCR_LP2HS_TIME_Pos) +
+             (double)((dsi->DLTCR & DSI_DLTCR_HS2LP_TIME) >> DSI_DLTCR_HS2LP_TIME_Pos);
+  }
+
+  return Host_DsiCycles(cycles);
+}
+
+/**
+  * @brief  Drops the packets sent from the link queue.
+  * @retval None
+  */
+static void Host_DsiPrune(void)
+{
+  uint64_t now = Host_GetCycles();
+  uint32_t i, n = 0U;
+
+  for(i = 0U; i < Host_DsiQueueNbr; i++)
+  {
+    if(Host_DsiQueue[i].End > now)
+    {
+      Host_DsiQueue[n++] = Host_DsiQueue[i];
+    }
+  }
+  Host_DsiQueueNbr = n;
+}
+
+/**
+  * @brief  Computes the generic packet status register.
+  * @retval GPSR value
+  */
+static uint32_t Host_DsiGpsr(void)
+{
+  uint64_t now = Host_GetCycles();
+  uint32_t i, headers = 0U, words = Host_DsiPayloadNbr, gpsr = 0U;
+
+  Host_DsiPrune();
+  for(i = 0U; i < Host_DsiQueueNbr; i++)
+  {
+    headers += (Host_DsiQueue[i].Start > now) ? 1U : 0U;
+    words   += Host_DsiQueue[i].Words;
+  }
+
+  gpsr |= (headers == 0U) ? DSI_GPSR_CMDFE : 0U;
+  gpsr |= ((headers >= HOST_DSI_CMD_FIFO) || (Host_DsiQueueNbr >= HOST_DSI_QUEUE)) ? DSI_GPSR_CMDFF : 0U;
+  gpsr |= (words == 0U) ? DSI_GPSR_PWRFE : 0U;
+  gpsr |= (words >= HOST_DSI_PAYLOAD_FIFO) ? DSI_GPSR_PWRFF : 0U;
+  gpsr |= (Host_DsiReadNbr == 0U) ? DSI_GPSR_PRDFE : 0U;
+  gpsr |= (Host_DsiReadNbr >= HOST_DSI_READ_FIFO) ? DSI_GPSR_PRDFF : 0U;
+  gpsr |= (Host_DsiReadPending != 0U) ? DSI_GPSR_RCB : 0U;
+
+  return gpsr;
+}
+
+/**
+  * @brief  Computes the D-PHY status register from the lane states.
+  * @retval PSR value
+  */
+static uint32_t Host_DsiPsr(void)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+  uint32_t stop = DSI_PSR_PSSC | DSI_PSR_PSS0 | DSI_PSR_PSS1;
+  uint32_t ulpm_not_active = DSI_PSR_UANC | DSI_PSR_UAN0 | DSI_PSR_UAN1;
+
+  if((dsi->PCTLR & (DSI_PCTLR_DEN | DSI_PCTLR_CKE)) != (DSI_PCTLR_DEN | DSI_PCTLR_CKE))
+  {
+    return 0U;
+  }
+  if(Host_DsiUlpm != 0U)
+  {
+    /* Exit requested: the lanes leave ULPM, then reach the stop state on release */
+    return ((dsi->PUCR & (DSI_PUCR_UECL | DSI_PUCR_UEDL)) != 0U) ? ulpm_not_active : 0U;
+  }
+
+  return stop | ulpm_not_active;
+}
+
+/**
+  * @brief  Updates the DSI interrupt line.
+  * @retval None
+  */
+static void Host_DsiIrq(void)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+
+  Host_SetIrqLine(DSI_IRQn, ((dsi->WISR & dsi->WIER & (DSI_WISR_TEIF | DSI_WISR_ERIF)) != 0U) ? 1U : 0U);
+}
+
+/**
+  * @brief  Gets the answer of the panel to a read.
+  * @param  Cmd     DCS command, or first generic parameter
+  * @retval First byte of the answer
+  */
+static uint8_t Host_DsiPanelRead(uint32_t Cmd)
+{
+  uint8_t data = 0U;
+
+  if((Host_DsiPanelType == HOST_PANEL_OTM8009A) && (Cmd == 0xDAU))
+  {
+    data = 0x40U;
+  }
+  else if((Host_DsiPanelType == HOST_PANEL_NT35510) && (Cmd == 0xDBU))
+  {
+    data = 0x80U;
+  }
+  else
+  {
+    /* No answer from the panel: zeros */
+  }
+
+  return data;
+}
+
+/**
+  * @brief  Queues a packet written to GHCR, with its payload.
+  * @param  Header  GHCR value
+  * @retval None
+  */
+static void Host_DsiSend(uint32_t Header)
+{
+  uint64_t now = Host_GetCycles();
+  uint32_t type = Header & DSI_GHCR_DT;
+  uint32_t channel = (Header & DSI_GHCR_VCID) >> DSI_GHCR_VCID_Pos;
+  uint32_t wc = (Header >> 8) & 0xFFFFU;
+  uint32_t i, words = 0U, bytes, size;
+  uint64_t start, end;
+  Host_DsiPacket_t *pkt = NULL;
+
+  if(HOST_DSI_LONG(type))
+  {
+    words = (wc + 3U) / 4U;
+    words = (words > Host_DsiPayloadNbr) ? Host_DsiPayloadNbr : words;
+    bytes = 4U + wc + 2U;
+    size = wc;
+  }
+  else
+  {
+    bytes = 4U;
+    switch(type)
+    {
+    case 0x03U:
+    case 0x04U:
+      size = 0U;
+      break;
+    case 0x05U:
+    case 0x06U:
+    case 0x13U:
+    case 0x14U:
+      size = 1U;
+      break;
+    default:
+      size = 2U;
+      break;
+    }
+  }
+
+  Host_DsiPrune();
+  start = (Host_DsiLinkFree > now) ? Host_DsiLinkFree : now;
+  end = start + Host_DsiPacketCycles(type, bytes);
+  Host_DsiLinkFree = end;
+  if(Host_DsiQueueNbr < HOST_DSI_QUEUE)
+  {
+    Host_DsiQueue[Host_DsiQueueNbr].Start = start;
+    Host_DsiQueue[Host_DsiQueueNbr].End   = end;
+    Host_DsiQueue[Host_DsiQueueNbr].Words = words;
+    Host_DsiQueueNbr++;
+  }
+
+  if(Host_DsiLogNbr < HOST_DSI_PACKETS_MAX)
+  {
+    pkt = &Host_DsiLog[Host_DsiLogNbr++];
+    memset(pkt, 0, sizeof(*pkt));
+    pkt->Time    = now;
+    pkt->Sent    = end;
+    pkt->Type    = (uint8_t)type;
+    pkt->Channel = (uint8_t)channel;
+    pkt->Size    = (uint16_t)((size > HOST_DSI_PAYLOAD_MAX) ? HOST_DSI_PAYLOAD_MAX : size);
+    if(HOST_DSI_LONG(type))
+    {
+      for(i = 0U; i < pkt->Size; i++)
+      {
+        pkt->Data[i] = (uint8_t)(Host_DsiPayload[i / 4U] >> (8U * (i % 4U)));
+      }
+    }
+    else
+    {
+      pkt->Data[0] = (uint8_t)(Header >> 8);
+      pkt->Data[1] = (uint8_t)(Header >> 16);
+    }
+  }
+
+  /* The payload leaves the write FIFO */
+  memmove(Host_DsiPayload, &Host_DsiPayload[words], (Host_DsiPayloadNbr - words) * sizeof(uint32_t));
+  Host_DsiPayloadNbr -= words;
+
+  if(type == HOST_DSI_MAX_RETURN)
+  {
+    Host_DsiMaxReturn = wc;
+  }
+  else if((type == HOST_DSI_DCS_READ) || ((type & 0x0FU) == 0x04U))
+  {
+    /* Read: the answer comes back after the bus turnaround */
+    size = (Host_DsiMaxReturn == 0U) ? 1U : Host_DsiMaxReturn;
+    size = (size > (4U * HOST_DSI_READ_FIFO)) ? (4U * HOST_DSI_READ_FIFO) : size;
+    memset(Host_DsiReadWords, 0, sizeof(Host_DsiReadWords));
+    Host_DsiReadWords[0] = Host_DsiPanelRead((Header >> 8) & 0xFFU);
+    Host_DsiReadPending = (size + 3U) / 4U;
+    Host_DsiReadTime = end + Host_DsiPacketCycles(HOST_DSI_DCS_READ, (size <= 2U) ? 4U : (size + 6U)) +
+                       Host_DsiCycles((double)(2U * HOST_DSI_BTA * (HOST_DSI->CCR & DSI_CCR_TXECKDIV)));
+  }
+  else
+  {
+    /* Write */
+  }
+}
+
+/**
+  * @brief  Starts an adapted command mode refresh: the LTDC active area is
+  *         sent in high speed, a packet of CMDSIZE pixels at most at a time.
+  * @retval None
+  */
+static void Host_DsiRefresh(void)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+  uint32_t width, height, packets, bpp, cmdsize;
+  uint64_t now = Host_GetCycles(), start;
+
+  Host_LtdcGetActive(&width, &height);
+  bpp = ((dsi->LCOLCR & DSI_LCOLCR_COLC) <= 2U) ? 2U : 3U;
+  cmdsize = dsi->LCCR & DSI_LCCR_CMDSIZE;
+  cmdsize = ((cmdsize == 0U) || (cmdsize > width)) ? width : cmdsize;
+  packets = (width + cmdsize - 1U) / cmdsize;
+
+  start = (Host_DsiLinkFree > now) ? Host_DsiLinkFree : now;
+  Host_DsiRefreshEnd = start + ((uint64_t)height * packets *
+                                Host_DsiPacketCycles(0x3EU, (cmdsize * bpp) + 6U));
+  Host_DsiLinkFree = Host_DsiRefreshEnd;
+  dsi->WISR |= DSI_WISR_BUSY;
+}
+
+/**
+  * @brief  DSI: resets it.
+  * @retval None
+  */
+static void Host_DsiReset(void)
+{
+  Host_DsiLogNbr      = 0U;
+  Host_DsiQueueNbr    = 0U;
+  Host_DsiLinkFree    = 0U;
+  Host_DsiPayloadNbr  = 0U;
+  Host_DsiReadNbr     = 0U;
+  Host_DsiReadPending = 0U;
+  Host_DsiMaxReturn   = 0U;
+  Host_DsiRefreshEnd  = HOST_NEVER;
+  Host_DsiNextTe      = HOST_NEVER;
+  Host_DsiTe          = 0U;
+  Host_DsiUlpm        = 0U;
+  memset(&Host_DsiStatistics, 0, sizeof(Host_DsiStatistics));
+}
+
+/**
+  * @brief  DSI: read hook, for the status registers and the read FIFO.
+  * @param  Offset  Register offset
+  * @retval None
+  */
+static void Host_DsiRead(uint32_t Offset)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+
+  switch(Offset)
+  {
+  case offsetof(DSI_TypeDef, GPSR):
+    dsi->GPSR = Host_DsiGpsr();
+    break;
+  case offsetof(DSI_TypeDef, PSR):
+    dsi->PSR = Host_DsiPsr();
+    break;
+  case offsetof(DSI_TypeDef, GPDR):
+    if(Host_DsiReadNbr != 0U)
+    {
+      dsi->GPDR = Host_DsiReadFifo[0];
+      Host_DsiReadNbr--;
+      memmove(Host_DsiReadFifo, &Host_DsiReadFifo[1], Host_DsiReadNbr * sizeof(uint32_t));
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  DSI: write hook.
+  * @param  Offset  Register offset
+  * @param  Old     Value before the write
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_DsiWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+  uint64_t now = Host_GetCycles();
+
+  switch(Offset)
+  {
+  case offsetof(DSI_TypeDef, WRPCR):
+    dsi->WISR = (dsi->WISR & ~(DSI_WISR_RRS | DSI_WISR_PLLLS)) |
+                (((New & DSI_WRPCR_REGEN) != 0U) ? DSI_WISR_RRS : 0U) |
+                (((New & DSI_WRPCR_PLLEN) != 0U) ? DSI_WISR_PLLLS : 0U);
+    break;
+  case offsetof(DSI_TypeDef, GPDR):
+    if(Host_DsiPayloadNbr < (sizeof(Host_DsiPayload) / sizeof(Host_DsiPayload[0])))
+    {
+      Host_DsiPayload[Host_DsiPayloadNbr++] = New;
+    }
+    break;
+  case offsetof(DSI_TypeDef, GHCR):
+    Host_DsiSend(New);
+    break;
+  case offsetof(DSI_TypeDef, PUCR):
+    if(((New & (DSI_PUCR_URCL | DSI_PUCR_URDL)) != 0U) && (Host_DsiUlpm == 0U))
+    {
+      Host_DsiUlpm = 1U;
+      Host_DsiUlpmStart = now;
+      Host_DsiStatistics.UlpmEntries++;
+    }
+    else if(((New & (DSI_PUCR_UECL | DSI_PUCR_UEDL)) == 0U) && ((Old & (DSI_PUCR_UECL | DSI_PUCR_UEDL)) != 0U) &&
+            (Host_DsiUlpm != 0U))
+    {
+      Host_DsiUlpm = 0U;
+      Host_DsiStatistics.UlpmExits++;
+      Host_DsiStatistics.UlpmCycles += now - Host_DsiUlpmStart;
+    }
+    else
+    {
+      /* Exit requested, or no change */
+    }
+    break;
+  case offsetof(DSI_TypeDef, WCFGR):
+    if(((New ^ Old) & DSI_WCFGR_DSIM) != 0U)
+    {
+      Host_LtdcClockChanged();
+    }
+    break;
+  case offsetof(DSI_TypeDef, WCR):
+    if(((New & DSI_WCR_LTDCEN) != 0U) && ((Old & DSI_WCR_LTDCEN) == 0U) &&
+       ((dsi->WCFGR & DSI_WCFGR_DSIM) != 0U))
+    {
+      Host_DsiRefresh();
+    }
+    break;
+  case offsetof(DSI_TypeDef, WIFCR):
+    dsi->WISR &= ~(New & (DSI_WISR_TEIF | DSI_WISR_ERIF | DSI_WISR_PLLLIF | DSI_WISR_PLLUIF | DSI_WISR_RRIF));
+    dsi->WIFCR = 0U;
+    break;
+  default:
+    break;
+  }
+
+  Host_DsiIrq();
+}
+
+/**
+  * @brief  DSI: gets the next event: read answer, end of refresh or tearing
+  *         effect.
+  * @retval Absolute cycle, or HOST_NEVER
+  */
+static uint64_t Host_DsiNextEvent(void)
+{
+  uint64_t next = Host_DsiRefreshEnd;
+
+  if((Host_DsiReadPending != 0U) && (Host_DsiReadTime < next))
+  {
+    next = Host_DsiReadTime;
+  }
+  if((Host_DsiTe != 0U) && (Host_DsiNextTe < next))
+  {
+    next = Host_DsiNextTe;
+  }
+
+  return next;
+}
+
+/**
+  * @brief  DSI: runs the events due.
+  * @param  Now     Current cycle
+  * @retval None
+  */
+static void Host_DsiEvent(uint64_t Now)
+{
+  DSI_TypeDef *dsi = HOST_DSI;
+  uint32_t i;
+
+  if((Host_DsiReadPending != 0U) && (Host_DsiReadTime <= Now))
+  {
+    for(i = 0U; (i < Host_DsiReadPending) && (Host_DsiReadNbr < HOST_DSI_READ_FIFO); i++)
+    {
+      Host_DsiReadFifo[Host_DsiReadNbr++] = Host_DsiReadWords[i];
+    }
+    Host_DsiReadPending = 0U;
+  }
+  if(Host_DsiRefreshEnd <= Now)
+  {
+    Host_DsiRefreshEnd = HOST_NEVER;
+    dsi->WCR &= ~DSI_WCR_LTDCEN;
+    dsi->WISR = (dsi->WISR & ~DSI_WISR_BUSY) | DSI_WISR_ERIF;
+    Host_DsiStatistics.Refreshes++;
+    Host_LtdcRefreshDone();
+  }
+  if((Host_DsiTe != 0U) && (Host_DsiNextTe <= Now))
+  {
+    Host_DsiNextTe += HOST_DSI_TE_CYCLES;
+    dsi->WISR |= DSI_WISR_TEIF;
+  }
+
+  Host_DsiIrq();
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Checks if the DSI host halts the LTDC, in adapted command mode.
+  * @retval 1 if halted
+  */
+uint32_t Host_DsiHaltsLtdc(void)
+{
+  return ((HOST_DSI->WCFGR & DSI_WCFGR_DSIM) != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Selects the panel answering the DSI reads.
+  * @param  Panel   Panel
+  * @retval None
+  */
+void Host_DsiSetPanel(Host_Panel_t Panel)
+{
+  Host_DsiPanelType = Panel;
+}
+
+/**
+  * @brief  Gets the packet log.
+  * @param  pPackets    Log
+  * @retval Number of packets
+  */
+uint32_t Host_DsiGetPackets(const Host_DsiPacket_t **pPackets)
+{
+  *pPackets = Host_DsiLog;
+
+  return Host_DsiLogNbr;
+}
+
+/**
+  * @brief  Empties the packet log.
+  * @retval None
+  */
+void Host_DsiResetPackets(void)
+{
+  Host_DsiLogNbr = 0U;
+}
+
+/**
+  * @brief  Gets the link statistics, the current ULPM period included.
+  * @param  Stats   Statistics
+  * @retval None
+  */
+void Host_DsiGetStats(Host_DsiStats_t *Stats)
+{
+  *Stats = Host_DsiStatistics;
+  Stats->Frames = Host_LtdcGetFrames();
+  if(Host_DsiUlpm != 0U)
+  {
+    Stats->UlpmCycles += Host_GetCycles() - Host_DsiUlpmStart;
+  }
+}
+
+/**
+  * @brief  Tells whether the link is in ULPM.
+  * @retval 1 in ULPM, else 0
+  */
+uint32_t Host_DsiInUlpm(void)
+{
+  return Host_DsiUlpm;
+}
+
+/**
+  * @brief  Starts or stops the tearing effect of the panel, at 60 Hz.
+  * @param  Enable  1 to start, 0 to stop
+  * @retval None
+  */
+void Host_DsiSetTearingEffect(uint32_t Enable)
+{
+  Host_DsiTe = Enable;
+  Host_DsiNextTe = Host_GetCycles() + HOST_DSI_TE_CYCLES;
+}
@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file    host_image.c
+  * @brief   Screen dumps of the host model: binary PPM, and PNG written with
+  *          stored (uncompressed) deflate blocks, so no library is needed.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_PNG_BLOCK                65535U   /* Largest stored block */
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Updates a CRC-32, as used by the PNG chunks.
+  * @param  Crc     Current CRC, 0 to start
+  * @param  pData   Data
+  * @param  Size    Data size
+  * @retval CRC
+  */
+static uint32_t Host_Crc32(uint32_t Crc, const uint8_t *pData, size_t Size)
+{
+  uint32_t c = ~Crc;
+  size_t i;
+  uint32_t k;
+
+  for(i = 0U; i < Size; i++)
+  {
+    c ^= pData[i];
+    for(k = 0U; k < 8U; k++)
+    {
+      c = ((c & 1U) != 0U) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+    }
+  }
+
+  return ~c;
+}
+
+/**
+  * @brief  Writes a big endian 32-bit value.
+  * @param  pDst    Destination
+  * @param  Value   Value
+  * @retval None
+  */
+static void Host_Put32(uint8_t *pDst, uint32_t Value)
+{
+  pDst[0] = (uint8_t)(Value >> 24);
+  pDst[1] = (uint8_t)(Value >> 16);
+  pDst[2] = (uint8_t)(Value >> 8);
+  pDst[3] = (uint8_t)Value;
+}
+
+/**
+  * @brief  Writes a PNG chunk.
+  * @param  pFile   File
+  * @param  pType   Chunk type, 4 characters
+  * @param  pData   Chunk data
+  * @param  Size    Data size
+  * @retval None
+  */
+static void Host_PngChunk(FILE *pFile, const char *pType, const uint8_t *pData, uint32_t Size)
+{
+  uint8_t head[8];
+  uint8_t tail[4];
+  uint32_t crc;
+
+  Host_Put32(head, Size);
+  memcpy(&head[4], pType, 4U);
+  crc = Host_Crc32(0U, &head[4], 4U);
+  crc = Host_Crc32(crc, pData, Size);
+  Host_Put32(tail, crc);
+  (void)fwrite(head, 1U, sizeof(head), pFile);
+  (void)fwrite(pData, 1U, Size, pFile);
+  (void)fwrite(tail, 1U, sizeof(tail), pFile);
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Writes a binary PPM image.
+  * @param  pPath   File path
+  * @param  pRgb    0x00RRGGBB pixels
+  * @param  Width   Image width
+  * @param  Height  Image height
+  * @retval 0 on success, -1 on error
+  */
+int32_t Host_WritePPM(const char *pPath, const uint32_t *pRgb, uint32_t Width, uint32_t Height)
+{
+  FILE *file = fopen(pPath, "wb");
+  uint8_t rgb[3];
+  uint32_t i;
+
+  if(file == NULL)
+  {
+    return -1;
+  }
+
+  (void)fprintf(file, "P6\n%u %u\n255\n", (unsigned)Width, (unsigned)Height);
+  for(i = 0U; i < (Width * Height); i++)
+  {
+    rgb[0] = (uint8_t)(pRgb[i] >> 16);
+    rgb[1] = (uint8_t)(pRgb[i] >> 8);
+    rgb[2] = (uint8_t)pRgb[i];
+    (void)fwrite(rgb, 1U, sizeof(rgb), file);
+  }
+
+  return (fclose(file) == 0) ? 0 : -1;
+}
+
+/**
+  * @brief  Writes an RGB PNG image, without compression.
+  * @param  pPath   File path
+  * @param  pRgb    0x00RRGGBB pixels
+  * @param  Width   Image width
+  * @param  Height  Image height
+  * @retval 0 on success, -1 on error
+  */
+int32_t Host_WritePNG(const char *pPath, const uint32_t *pRgb, uint32_t Width, uint32_t Height)
+{
+  static const uint8_t signature[8] = { 0x89U, 'P', 'N', 'G', 0x0DU, 0x0AU, 0x1AU, 0x0AU };
+  size_t raw_size = (size_t)Height * ((3U * (size_t)Width) + 1U);
+  size_t blocks = (raw_size + HOST_PNG_BLOCK - 1U) / HOST_PNG_BLOCK;
+  size_t zsize = 2U + (5U * blocks) + raw_size + 4U;
+  uint8_t *raw = malloc(raw_size);
+  uint8_t *z = malloc(zsize);
+  uint8_t ihdr[13];
+  uint8_t *p;
+  uint32_t x, y, a = 1U, b = 0U;
+  size_t i, n;
+  FILE *file;
+  int32_t ret = -1;
+
+  if((raw == NULL) || (z == NULL) || (zsize > 0xFFFFFFFFU))
+  {
+    free(raw);
+    free(z);
+    return -1;
+  }
+
+  /* Scanlines, filter type 0 */
+  p = raw;
+  for(y = 0U; y < Height; y++)
+  {
+    *p++ = 0U;
+    for(x = 0U; x < Width; x++)
+    {
+      *p++ = (uint8_t)(pRgb[(y * Width) + x] >> 16);
+      *p++ = (uint8_t)(pRgb[(y * Width) + x] >> 8);
+      *p++ = (uint8_t)pRgb[(y * Width) + x];
+    }
+  }
+
+  /* zlib stream of stored blocks, with its Adler-32 */
+  p = z;
+  *p++ = 0x78U;
+  *p++ = 0x01U;
+  for(i = 0U; i < raw_size; i += n)
+  {
+    n = ((raw_size - i) > HOST_PNG_BLOCK) ? HOST_PNG_BLOCK : (raw_size - i);
+    *p++ = ((i + n) == raw_size) ? 1U : 0U;
+    *p++ = (uint8_t)n;
+    *p++ = (uint8_t)(n >> 8);
+    *p++ = (uint8_t)~n;
+    *p++ = (uint8_t)(~n >> 8);
+    memcpy(p, &raw[i], n);
+    p += n;
+  }
+  for(i = 0U; i < raw_size; i++)
+  {
+    a = (a + raw[i]) % 65521U;
+    b = (b + a) % 65521U;
+  }
+  Host_Put32(p, (b << 16) | a);
+
+  Host_Put32(&ihdr[0], Width);
+  Host_Put32(&ihdr[4], Height);
+  ihdr[8]  = 8U;     /* Bit depth           */
+  ihdr[9]  = 2U;     /* Truecolor           */
+  ihdr[10] = 0U;     /* Deflate             */
+  ihdr[11] = 0U;     /* Adaptive filtering  */
+  ihdr[12] = 0U;     /* No interlace        */
+
+  file = fopen(pPath, "wb");
+  if(file != NULL)
+  {
+    (void)fwrite(signature, 1U, sizeof(signature), file);
+    Host_PngChunk(file, "IHDR", ihdr, sizeof(ihdr));
+    Host_PngChunk(file, "IDAT", z, (uint32_t)zsize);
+    Host_PngChunk(file, "IEND", NULL, 0U);
+    ret = (fclose(file) == 0) ? 0 : -1;
+  }
+
+  free(raw);
+  free(z);
+
+  return ret;
+}
+
+/**
+  * @brief  Writes an image, as PNG if the path ends in ".png", else as PPM.
+  * @param  pPath   File path
+  * @param  pRgb    0x00RRGGBB pixels
+  * @param  Width   Image width
+  * @param  Height  Image height
+  * @retval 0 on success, -1 on error
+  */
+int32_t Host_WriteImage(const char *pPath, const uint32_t *pRgb, uint32_t Width, uint32_t Height)
+{
+  size_t len = strlen(pPath);
+
+  if((len > 4U) && (strcmp(&pPath[len - 4U], ".png") == 0))
+  {
+    return Host_WritePNG(pPath, pRgb, Width, Height);
+  }
+
+  return Host_WritePPM(pPath, pRgb, Width, Height);
+}
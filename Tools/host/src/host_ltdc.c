@@ -0,0 +1,569 @@
+/**
+  ******************************************************************************
+  * @file    host_ltdc.c
+  * @brief   Host model of the LTDC: the pixel position runs on the PLL3 R clock
+  *          from the enable of the controller, with the line interrupt, the
+  *          shadow reload at the vertical blanking and the frame count. The
+  *          layer registers take effect on reload, as on the target. The screen
+  *          is composed from the active registers on demand, with the layer
+  *          blending, the color keying and the CLUT.
+  *          While the DSI host runs in adapted command mode, the controller is
+  *          halted and a frame is only sent on a DSI refresh.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "host_periph.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_LTDC_LAYERS              2U
+
+/* Private macros ------------------------------------------------------------*/
+#define HOST_LTDC                     ((LTDC_TypeDef *)(uintptr_t)Host_Reg(LTDC_BASE))
+#define HOST_LTDC_LAYER(l)            ((LTDC_Layer_TypeDef *)(uintptr_t)Host_Reg(LTDC_Layer1_BASE + ((l) * 0x80U)))
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_LtdcReset(void);
+static void Host_LtdcRead(uint32_t Offset);
+static void Host_LtdcWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+static uint64_t Host_LtdcNextEvent(void);
+static void Host_LtdcEvent(uint64_t Now);
+
+/* Exported variables --------------------------------------------------------*/
+const Host_Periph_t Host_LtdcPeriph =
+{
+  "LTDC", LTDC_BASE, 0x1000U, Host_LtdcReset, Host_LtdcRead, Host_LtdcWrite, Host_LtdcNextEvent, Host_LtdcEvent
+};
+
+/* Private variables ---------------------------------------------------------*/
+static LTDC_Layer_TypeDef Host_LtdcActive[HOST_LTDC_LAYERS];   /* Registers in use     */
+static uint32_t Host_LtdcClut[HOST_LTDC_LAYERS][256];
+static double   Host_LtdcClock;       /* Pixel clock while running, 0 when stopped */
+static uint64_t Host_LtdcOrigin;      /* Cycle of Host_LtdcOriginPixel             */
+static uint64_t Host_LtdcOriginPixel; /* Pixels sent since the enable              */
+static uint64_t Host_LtdcLastPixel;   /* Position of the last event                */
+static uint64_t Host_LtdcLastEvent;
+static uint32_t Host_LtdcFrameCount;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gets the pixels of a frame, blanking included.
+  * @retval Pixels
+  */
+static uint64_t Host_LtdcFramePixels(void)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+
+  return (uint64_t)(((ltdc->TWCR & LTDC_TWCR_TOTALW) >> LTDC_TWCR_TOTALW_Pos) + 1U) *
+         (uint64_t)((ltdc->TWCR & LTDC_TWCR_TOTALH) + 1U);
+}
+
+/**
+  * @brief  Gets the pixels of a line, blanking included.
+  * @retval Pixels
+  */
+static uint32_t Host_LtdcLinePixels(void)
+{
+  return ((HOST_LTDC->TWCR & LTDC_TWCR_TOTALW) >> LTDC_TWCR_TOTALW_Pos) + 1U;
+}
+
+/**
+  * @brief  Gets the pixels sent since the enable.
+  * @param  Now     CPU cycle
+  * @retval Pixels
+  */
+static uint64_t Host_LtdcPixel(uint64_t Now)
+{
+  if(Host_LtdcClock == 0.0)
+  {
+    return Host_LtdcOriginPixel;
+  }
+
+  return Host_LtdcOriginPixel + (uint64_t)floor((((double)(Now - Host_LtdcOrigin) * Host_LtdcClock) / (double)HOST_CPU_CLOCK) + 1e-9);
+}
+
+/**
+  * @brief  Gets the CPU cycle a pixel is reached.
+  * @param  Pixel   Pixels since the enable
+  * @retval CPU cycle
+  */
+static uint64_t Host_LtdcCycle(uint64_t Pixel)
+{
+  return Host_LtdcOrigin + (uint64_t)ceil((((double)(Pixel - Host_LtdcOriginPixel) * (double)HOST_CPU_CLOCK) / Host_LtdcClock) - 1e-9);
+}
+
+/**
+  * @brief  Gets the first pixel after a position at a given offset of the frame.
+  * @param  Pixel   Position
+  * @param  Offset  Offset in the frame
+  * @retval Pixels since the enable
+  */
+static uint64_t Host_LtdcNext(uint64_t Pixel, uint64_t Offset)
+{
+  uint64_t total = Host_LtdcFramePixels();
+
+  return ((((Pixel + total) - Offset) / total) * total) + Offset;
+}
+
+/**
+  * @brief  Checks if a position at a given offset of the frame was crossed.
+  * @param  From    Previous position
+  * @param  To      Current position
+  * @param  Offset  Offset in the frame
+  * @retval Number of times
+  */
+static uint64_t Host_LtdcCrossed(uint64_t From, uint64_t To, uint64_t Offset)
+{
+  uint64_t total = Host_LtdcFramePixels();
+
+  return (((To + total) - Offset) / total) - (((From + total) - Offset) / total);
+}
+
+/**
+  * @brief  Updates the LTDC interrupt lines.
+  * @retval None
+  */
+static void Host_LtdcIrq(void)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+  uint32_t pending = ltdc->ISR & ltdc->IER;
+
+  Host_SetIrqLine(LTDC_IRQn, ((pending & (LTDC_ISR_LIF | LTDC_ISR_RRIF)) != 0U) ? 1U : 0U);
+  Host_SetIrqLine(LTDC_ER_IRQn, ((pending & (LTDC_ISR_FUIF | LTDC_ISR_TERRIF)) != 0U) ? 1U : 0U);
+}
+
+/**
+  * @brief  Copies the shadow layer registers to the active ones.
+  * @retval None
+  */
+static void Host_LtdcReload(void)
+{
+  uint32_t l;
+
+  for(l = 0U; l < HOST_LTDC_LAYERS; l++)
+  {
+    memcpy(&Host_LtdcActive[l], (const void *)HOST_LTDC_LAYER(l), sizeof(LTDC_Layer_TypeDef));
+  }
+}
+
+/**
+  * @brief  Applies a reload pending for the vertical blanking.
+  * @retval None
+  */
+static void Host_LtdcBlanking(void)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+
+  if((ltdc->SRCR & LTDC_SRCR_VBR) != 0U)
+  {
+    Host_LtdcReload();
+    ltdc->SRCR &= ~LTDC_SRCR_VBR;
+    ltdc->ISR |= LTDC_ISR_RRIF;
+  }
+}
+
+/**
+  * @brief  LTDC: resets it.
+  * @retval None
+  */
+static void Host_LtdcReset(void)
+{
+  memset(Host_LtdcActive, 0, sizeof(Host_LtdcActive));
+  memset(Host_LtdcClut, 0, sizeof(Host_LtdcClut));
+  Host_LtdcClock       = 0.0;
+  Host_LtdcOrigin      = 0U;
+  Host_LtdcOriginPixel = 0U;
+  Host_LtdcLastPixel   = 0U;
+  Host_LtdcLastEvent   = 0U;
+  Host_LtdcFrameCount  = 0U;
+}
+
+/**
+  * @brief  LTDC: read hook, for the position and status registers.
+  * @param  Offset  Register offset
+  * @retval None
+  */
+static void Host_LtdcRead(uint32_t Offset)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+  uint64_t pixel;
+  uint32_t x, y, hsw, vsh, ahbp, avbp, aaw, aah;
+
+  if((Offset != offsetof(LTDC_TypeDef, CPSR)) && (Offset != offsetof(LTDC_TypeDef, CDSR)))
+  {
+    return;
+  }
+
+  pixel = (Host_LtdcClock == 0.0) ? 0U : (Host_LtdcPixel(Host_GetCycles()) % Host_LtdcFramePixels());
+  x = (uint32_t)(pixel % Host_LtdcLinePixels());
+  y = (uint32_t)(pixel / Host_LtdcLinePixels());
+  hsw  = (ltdc->SSCR & LTDC_SSCR_HSW) >> LTDC_SSCR_HSW_Pos;
+  vsh  = ltdc->SSCR & LTDC_SSCR_VSH;
+  ahbp = (ltdc->BPCR & LTDC_BPCR_AHBP) >> LTDC_BPCR_AHBP_Pos;
+  avbp = ltdc->BPCR & LTDC_BPCR_AVBP;
+  aaw  = (ltdc->AWCR & LTDC_AWCR_AAW) >> LTDC_AWCR_AAW_Pos;
+  aah  = ltdc->AWCR & LTDC_AWCR_AAH;
+
+  ltdc->CPSR = (x << LTDC_CPSR_CXPOS_Pos) | y;
+  ltdc->CDSR = (((y > avbp) && (y <= aah)) ? LTDC_CDSR_VDES : 0U) |
+               (((x > ahbp) && (x <= aaw)) ? LTDC_CDSR_HDES : 0U) |
+               ((y <= vsh) ? LTDC_CDSR_VSYNCS : 0U) |
+               ((x <= hsw) ? LTDC_CDSR_HSYNCS : 0U);
+}
+
+/**
+  * @brief  LTDC: write hook.
+  * @param  Offset  Register offset
+  * @param  Old     Value before the write
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_LtdcWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+  uint32_t layer;
+
+  switch(Offset)
+  {
+  case offsetof(LTDC_TypeDef, GCR):
+    if(((New & LTDC_GCR_LTDCEN) != 0U) && ((Old & LTDC_GCR_LTDCEN) == 0U))
+    {
+      /* The enable starts a frame */
+      Host_LtdcClock       = 0.0;
+      Host_LtdcOriginPixel = 0U;
+      Host_LtdcLastPixel   = 0U;
+    }
+    Host_LtdcClockChanged();
+    break;
+  case offsetof(LTDC_TypeDef, SRCR):
+    if((New & LTDC_SRCR_IMR) != 0U)
+    {
+      Host_LtdcReload();
+      ltdc->SRCR &= ~LTDC_SRCR_IMR;
+    }
+    break;
+  case offsetof(LTDC_TypeDef, ICR):
+    ltdc->ISR &= ~New;
+    ltdc->ICR = 0U;
+    break;
+  default:
+    if(Offset >= (LTDC_Layer1_BASE - LTDC_BASE))
+    {
+      layer = (Offset - (LTDC_Layer1_BASE - LTDC_BASE)) / 0x80U;
+      if((layer < HOST_LTDC_LAYERS) &&
+         (((Offset - (LTDC_Layer1_BASE - LTDC_BASE)) % 0x80U) == offsetof(LTDC_Layer_TypeDef, CLUTWR)))
+      {
+        /* CLUT written at once, not shadowed */
+        Host_LtdcClut[layer][(New & LTDC_LxCLUTWR_CLUTADD) >> LTDC_LxCLUTWR_CLUTADD_Pos] = New & 0xFFFFFFU;
+      }
+    }
+    break;
+  }
+
+  Host_LtdcIrq();
+}
+
+/**
+  * @brief  LTDC: gets the next position of interest: the programmed line, the
+  *         vertical blanking or the start of a frame.
+  * @retval Absolute cycle, or HOST_NEVER
+  */
+static uint64_t Host_LtdcNextEvent(void)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+  uint64_t line, pixel, next, t;
+
+  if((Host_LtdcClock == 0.0) || (Host_LtdcFramePixels() <= 1U))
+  {
+    return HOST_NEVER;
+  }
+
+  line = Host_LtdcLinePixels();
+  pixel = Host_LtdcLastPixel + 1U;
+  next = Host_LtdcNext(pixel, 0U);
+  t = Host_LtdcNext(pixel, (uint64_t)(ltdc->LIPCR & LTDC_LIPCR_LIPOS) * line);
+  next = (t < next) ? t : next;
+  t = Host_LtdcNext(pixel, ((uint64_t)(ltdc->AWCR & LTDC_AWCR_AAH) + 1U) * line);
+  next = (t < next) ? t : next;
+
+  t = Host_LtdcCycle(next);
+
+  return (t > Host_LtdcLastEvent) ? t : (Host_LtdcLastEvent + 1U);
+}
+
+/**
+  * @brief  LTDC: flags the positions crossed since the last event.
+  * @param  Now     Current cycle
+  * @retval None
+  */
+static void Host_LtdcEvent(uint64_t Now)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+  uint64_t line = Host_LtdcLinePixels();
+  uint64_t pixel = Host_LtdcPixel(Now);
+
+  if(pixel <= Host_LtdcLastPixel)
+  {
+    pixel = Host_LtdcLastPixel + 1U;
+  }
+  if(Host_LtdcCrossed(Host_LtdcLastPixel, pixel, (uint64_t)(ltdc->LIPCR & LTDC_LIPCR_LIPOS) * line) != 0U)
+  {
+    ltdc->ISR |= LTDC_ISR_LIF;
+  }
+  if(Host_LtdcCrossed(Host_LtdcLastPixel, pixel, ((uint64_t)(ltdc->AWCR & LTDC_AWCR_AAH) + 1U) * line) != 0U)
+  {
+    Host_LtdcBlanking();
+  }
+  Host_LtdcFrameCount += (uint32_t)Host_LtdcCrossed(Host_LtdcLastPixel, pixel, 0U);
+
+  Host_LtdcLastPixel = pixel;
+  Host_LtdcLastEvent = Now;
+  Host_LtdcIrq();
+}
+
+/**
+  * @brief  Reads a pixel of a layer as ARGB8888.
+  * @param  Layer   Layer index
+  * @param  pAddr   Pixel address
+  * @retval ARGB8888 pixel
+  */
+static uint32_t Host_LtdcFetch(uint32_t Layer, const uint8_t *pAddr)
+{
+  const LTDC_Layer_TypeDef *regs = &Host_LtdcActive[Layer];
+  uint32_t v, a = 0xFFU, rgb = 0U;
+
+  switch(regs->PFCR & LTDC_LxPFCR_PF)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    v = (uint32_t)pAddr[0] | ((uint32_t)pAddr[1] << 8) | ((uint32_t)pAddr[2] << 16) | ((uint32_t)pAddr[3] << 24);
+    a = v >> 24;
+    rgb = v & 0xFFFFFFU;
+    break;
+  case LTDC_PIXEL_FORMAT_RGB888:
+    rgb = (uint32_t)pAddr[0] | ((uint32_t)pAddr[1] << 8) | ((uint32_t)pAddr[2] << 16);
+    break;
+  case LTDC_PIXEL_FORMAT_RGB565:
+    v = (uint32_t)pAddr[0] | ((uint32_t)pAddr[1] << 8);
+    rgb = ((((v >> 11) * 255U) / 31U) << 16) | (((((v >> 5) & 0x3FU) * 255U) / 63U) << 8) | (((v & 0x1FU) * 255U) / 31U);
+    break;
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+    v = (uint32_t)pAddr[0] | ((uint32_t)pAddr[1] << 8);
+    a = ((v & 0x8000U) != 0U) ? 0xFFU : 0U;
+    rgb = (((((v >> 10) & 0x1FU) * 255U) / 31U) << 16) | (((((v >> 5) & 0x1FU) * 255U) / 31U) << 8) |
+          (((v & 0x1FU) * 255U) / 31U);
+    break;
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+    v = (uint32_t)pAddr[0] | ((uint32_t)pAddr[1] << 8);
+    a = (v >> 12) * 17U;
+    rgb = ((((v >> 8) & 0xFU) * 17U) << 16) | ((((v >> 4) & 0xFU) * 17U) << 8) | ((v & 0xFU) * 17U);
+    break;
+  case LTDC_PIXEL_FORMAT_L8:
+    rgb = pAddr[0];
+    break;
+  case LTDC_PIXEL_FORMAT_AL44:
+    a = (uint32_t)(pAddr[0] >> 4) * 17U;
+    rgb = pAddr[0] & 0xFU;
+    break;
+  default:
+    a = pAddr[1];
+    rgb = pAddr[0];
+    break;
+  }
+
+  if((regs->PFCR & LTDC_LxPFCR_PF) >= LTDC_PIXEL_FORMAT_L8)
+  {
+    /* Luminance formats: the CLUT gives the color, the gray level without it */
+    rgb = ((regs->CR & LTDC_LxCR_CLUTEN) != 0U) ? Host_LtdcClut[Layer][rgb] : (rgb * 0x010101U);
+  }
+  if(((regs->CR & LTDC_LxCR_COLKEN) != 0U) && (rgb == (regs->CKCR & 0xFFFFFFU)))
+  {
+    a = 0U;
+  }
+
+  return (a << 24) | rgb;
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Restarts the pixel count at the current position when the pixel
+  *         clock, the enable or the halt by the DSI host change.
+  * @retval None
+  */
+void Host_LtdcClockChanged(void)
+{
+  uint64_t now = Host_GetCycles();
+  double clock = 0.0;
+
+  Host_LtdcOriginPixel = Host_LtdcPixel(now);
+  Host_LtdcOrigin = now;
+  if(((HOST_LTDC->GCR & LTDC_GCR_LTDCEN) != 0U) && (Host_DsiHaltsLtdc() == 0U))
+  {
+    clock = Host_RccGetPll3R();
+  }
+  Host_LtdcClock = clock;
+}
+
+/**
+  * @brief  Checks if the LTDC is enabled.
+  * @retval 1 if enabled
+  */
+uint32_t Host_LtdcIsEnabled(void)
+{
+  return ((HOST_LTDC->GCR & LTDC_GCR_LTDCEN) != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Gets the size of the active area.
+  * @param  pWidth  Active width
+  * @param  pHeight Active height
+  * @retval None
+  */
+void Host_LtdcGetActive(uint32_t *pWidth, uint32_t *pHeight)
+{
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+
+  *pWidth  = ((ltdc->AWCR & LTDC_AWCR_AAW) >> LTDC_AWCR_AAW_Pos) - ((ltdc->BPCR & LTDC_BPCR_AHBP) >> LTDC_BPCR_AHBP_Pos);
+  *pHeight = (ltdc->AWCR & LTDC_AWCR_AAH) - (ltdc->BPCR & LTDC_BPCR_AVBP);
+}
+
+/**
+  * @brief  End of a frame sent on a DSI command mode refresh.
+  * @retval None
+  */
+void Host_LtdcRefreshDone(void)
+{
+  Host_LtdcFrameCount++;
+  Host_LtdcBlanking();
+  Host_LtdcIrq();
+}
+
+/**
+  * @brief  Gets the pixel clock.
+  * @retval Frequency in Hz, 0 when PLL3 is off
+  */
+uint32_t Host_LtdcGetPixelClock(void)
+{
+  return (uint32_t)Host_RccGetPll3R();
+}
+
+/**
+  * @brief  Gets the duration of a frame, blanking included.
+  * @retval CPU cycles, 0 when PLL3 is off
+  */
+uint64_t Host_LtdcGetFrameCycles(void)
+{
+  double clock = Host_RccGetPll3R();
+
+  return (clock == 0.0) ? 0U : (uint64_t)(((double)Host_LtdcFramePixels() * (double)HOST_CPU_CLOCK) / clock);
+}
+
+/**
+  * @brief  Gets the number of frames sent.
+  * @retval Frames
+  */
+uint32_t Host_LtdcGetFrames(void)
+{
+  return Host_LtdcFrameCount;
+}
+
+/**
+  * @brief  Composes the screen from the active registers and the frame buffers.
+  * @param  pRgb    Output, 0x00RRGGBB pixels
+  * @param  Width   Output width, at most the active width
+  * @param  Height  Output height, at most the active height
+  * @retval 0 on success, -1 if the output is larger than the active area
+  */
+int32_t Host_LtdcCompose(uint32_t *pRgb, uint32_t Width, uint32_t Height)
+{
+  static const uint8_t bpp[8] = { 4U, 3U, 2U, 2U, 2U, 1U, 1U, 2U };
+  LTDC_TypeDef *ltdc = HOST_LTDC;
+  const LTDC_Layer_TypeDef *regs;
+  uint32_t ahbp = (ltdc->BPCR & LTDC_BPCR_AHBP) >> LTDC_BPCR_AHBP_Pos;
+  uint32_t avbp = ltdc->BPCR & LTDC_BPCR_AVBP;
+  uint32_t active_w, active_h, x, y, l, col, row, pixel, alpha, ca, bf1, c, shift, out;
+  uint32_t h0, h1, v0, v1;
+
+  Host_LtdcGetActive(&active_w, &active_h);
+  if((Width > active_w) || (Height > active_h))
+  {
+    return -1;
+  }
+
+  for(y = 0U; y < Height; y++)
+  {
+    for(x = 0U; x < Width; x++)
+    {
+      out = ltdc->BCCR & 0xFFFFFFU;
+      for(l = 0U; l < HOST_LTDC_LAYERS; l++)
+      {
+        regs = &Host_LtdcActive[l];
+        if((regs->CR & LTDC_LxCR_LEN) == 0U)
+        {
+          continue;
+        }
+        h0 = regs->WHPCR & LTDC_LxWHPCR_WHSTPOS;
+        h1 = (regs->WHPCR & LTDC_LxWHPCR_WHSPPOS) >> LTDC_LxWHPCR_WHSPPOS_Pos;
+        v0 = regs->WVPCR & LTDC_LxWVPCR_WVSTPOS;
+        v1 = (regs->WVPCR & LTDC_LxWVPCR_WVSPPOS) >> LTDC_LxWVPCR_WVSPPOS_Pos;
+        col = x + ahbp + 1U;
+        row = y + avbp + 1U;
+        if((col < h0) || (col > h1) || (row < v0) || (row > v1) || ((row - v0) >= (regs->CFBLNR & LTDC_LxCFBLNR_CFBLNBR)))
+        {
+          /* Outside of the window: the default color of the layer */
+          pixel = regs->DCCR;
+        }
+        else
+        {
+          pixel = Host_LtdcFetch(l, (const uint8_t *)(uintptr_t)(regs->CFBAR +
+                                 ((row - v0) * ((regs->CFBLR & LTDC_LxCFBLR_CFBP) >> LTDC_LxCFBLR_CFBP_Pos)) +
+                                 ((col - h0) * bpp[regs->PFCR & 7U])));
+        }
+
+        ca = regs->CACR & LTDC_LxCACR_CONSTA;
+        bf1 = (regs->BFCR & LTDC_LxBFCR_BF1) >> LTDC_LxBFCR_BF1_Pos;
+        alpha = (bf1 == 6U) ? (((pixel >> 24) * ca) / 255U) : ca;
+        c = 0U;
+        for(shift = 0U; shift < 24U; shift += 8U)
+        {
+          c |= (((((pixel >> shift) & 0xFFU) * alpha) + (((out >> shift) & 0xFFU) * (255U - alpha))) / 255U) << shift;
+        }
+        out = c;
+      }
+      pRgb[(y * Width) + x] = out;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Writes the screen to a PPM or PNG file, by the file extension.
+  * @param  pPath   File path
+  * @retval 0 on success, -1 on error
+  */
+int32_t Host_LtdcDump(const char *pPath)
+{
+  uint32_t width, height;
+  uint32_t *rgb;
+  int32_t ret;
+
+  Host_LtdcGetActive(&width, &height);
+  rgb = malloc(sizeof(uint32_t) * width * height);
+  if(rgb == NULL)
+  {
+    return -1;
+  }
+  ret = Host_LtdcCompose(rgb, width, height);
+  if(ret == 0)
+  {
+    ret = Host_WriteImage(pPath, rgb, width, height);
+  }
+  free(rgb);
+
+  return ret;
+}
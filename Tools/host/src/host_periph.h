@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    host_periph.h
+  * @brief   Links between the host peripheral models.
+  ******************************************************************************
+  */
+
+#ifndef HOST_PERIPH_H
+#define HOST_PERIPH_H
+
+#include "host_model.h"
+
+/* RCC */
+double   Host_RccGetPll3R(void);
+
+/* LTDC */
+void     Host_LtdcClockChanged(void);
+uint32_t Host_LtdcIsEnabled(void);
+void     Host_LtdcGetActive(uint32_t *pWidth, uint32_t *pHeight);
+void     Host_LtdcRefreshDone(void);
+
+/* DSI */
+uint32_t Host_DsiHaltsLtdc(void);
+
+#endif /* HOST_PERIPH_H */
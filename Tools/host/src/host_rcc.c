@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    host_rcc.c
+  * @brief   Host model of the RCC and PWR registers. The reset state is the one
+  *          left by the SystemClock_Config() of the example: 400 MHz from PLL1
+  *          on the 25 MHz HSE. The oscillators and PLLs are ready as soon as
+  *          they are switched on, and the pixel clock is read from PLL3.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "host_periph.h"
+#include <stddef.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_RCC_PAGE                 0x58024000U
+#define HOST_RCC_ON_MASK              (RCC_CR_HSION | RCC_CR_CSION | RCC_CR_HSI48ON | RCC_CR_HSEON | \
+                                       RCC_CR_PLL1ON | RCC_CR_PLL2ON | RCC_CR_PLL3ON)
+
+/* Private macros ------------------------------------------------------------*/
+#define HOST_RCC                      ((RCC_TypeDef *)(uintptr_t)Host_Reg(RCC_BASE))
+#define HOST_PWR                      ((PWR_TypeDef *)(uintptr_t)Host_Reg(PWR_BASE))
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_RccReset(void);
+static void Host_RccWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+
+/* Exported variables --------------------------------------------------------*/
+const Host_Periph_t Host_RccPeriph =
+{
+  "RCC", HOST_RCC_PAGE, 0x1000U, Host_RccReset, NULL, Host_RccWrite, NULL, NULL
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Sets the ready flags of the switched on oscillators and PLLs.
+  * @retval None
+  */
+static void Host_RccUpdate(void)
+{
+  RCC_TypeDef *rcc = HOST_RCC;
+  uint32_t on = rcc->CR & HOST_RCC_ON_MASK;
+
+  /* Each xxxRDY flag is the bit above its xxxON bit */
+  rcc->CR = (rcc->CR & ~(HOST_RCC_ON_MASK << 1)) | (on << 1) | RCC_CR_D1CKRDY | RCC_CR_D2CKRDY;
+  rcc->CFGR = (rcc->CFGR & ~RCC_CFGR_SWS) | ((rcc->CFGR & RCC_CFGR_SW) << RCC_CFGR_SWS_Pos);
+}
+
+/**
+  * @brief  RCC and PWR: resets them to the clock configuration of the example.
+  * @retval None
+  */
+static void Host_RccReset(void)
+{
+  RCC_TypeDef *rcc = HOST_RCC;
+  PWR_TypeDef *pwr = HOST_PWR;
+
+  rcc->CR       = RCC_CR_HSION | RCC_CR_HSEON | RCC_CR_PLL1ON;
+  rcc->CFGR     = RCC_CFGR_SW_PLL1;
+  rcc->D1CFGR   = RCC_D1CFGR_HPRE_DIV2 | RCC_D1CFGR_D1PPRE_DIV2;
+  rcc->D2CFGR   = RCC_D2CFGR_D2PPRE1_DIV2 | RCC_D2CFGR_D2PPRE2_DIV2;
+  rcc->D3CFGR   = RCC_D3CFGR_D3PPRE_DIV2;
+  rcc->PLLCKSELR = RCC_PLLCKSELR_PLLSRC_HSE | (5UL << RCC_PLLCKSELR_DIVM1_Pos);
+  rcc->PLLCFGR  = RCC_PLLCFGR_DIVP1EN | RCC_PLLCFGR_DIVQ1EN | RCC_PLLCFGR_DIVR1EN | RCC_PLLCFGR_PLL1RGE_2;
+  rcc->PLL1DIVR = (159UL << RCC_PLL1DIVR_N1_Pos) | (1UL << RCC_PLL1DIVR_P1_Pos) |
+                  (3UL << RCC_PLL1DIVR_Q1_Pos) | (1UL << RCC_PLL1DIVR_R1_Pos);
+  Host_RccUpdate();
+
+  pwr->CSR1 = PWR_CSR1_ACTVOSRDY;
+  pwr->D3CR = PWR_D3CR_VOSRDY | PWR_D3CR_VOS;
+}
+
+/**
+  * @brief  RCC and PWR: write hook.
+  * @param  Offset  Register offset in the page
+  * @param  Old     Value before the write
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_RccWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  uint32_t reg = Offset - (RCC_BASE - HOST_RCC_PAGE);
+
+  (void)Old;
+  (void)New;
+  if((reg == offsetof(RCC_TypeDef, CR)) || (reg == offsetof(RCC_TypeDef, CFGR)))
+  {
+    Host_RccUpdate();
+  }
+  if((reg == offsetof(RCC_TypeDef, CR)) || (reg == offsetof(RCC_TypeDef, PLLCKSELR)) ||
+     (reg == offsetof(RCC_TypeDef, PLLCFGR)) || (reg == offsetof(RCC_TypeDef, PLL3DIVR)) ||
+     (reg == offsetof(RCC_TypeDef, PLL3FRACR)))
+  {
+    /* Possibly a new pixel clock */
+    Host_LtdcClockChanged();
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  Gets the PLL3 R output, the LTDC pixel clock.
+  * @retval Frequency in Hz, 0 when PLL3 is off
+  */
+double Host_RccGetPll3R(void)
+{
+  RCC_TypeDef *rcc = HOST_RCC;
+  uint32_t m = (rcc->PLLCKSELR & RCC_PLLCKSELR_DIVM3) >> RCC_PLLCKSELR_DIVM3_Pos;
+  double n;
+
+  if(((rcc->CR & RCC_CR_PLL3RDY) == 0U) || (m == 0U))
+  {
+    return 0.0;
+  }
+
+  n = (double)(((rcc->PLL3DIVR & RCC_PLL3DIVR_N3) >> RCC_PLL3DIVR_N3_Pos) + 1U);
+  if((rcc->PLLCFGR & RCC_PLLCFGR_PLL3FRACEN) != 0U)
+  {
+    n += (double)((rcc->PLL3FRACR & RCC_PLL3FRACR_FRACN3) >> RCC_PLL3FRACR_FRACN3_Pos) / 8192.0;
+  }
+
+  return (((double)HSE_VALUE / (double)m) * n) / (double)(((rcc->PLL3DIVR & RCC_PLL3DIVR_R3) >> RCC_PLL3DIVR_R3_Pos) + 1U);
+}
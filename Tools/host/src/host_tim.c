@@ -0,0 +1,194 @@
+/**
+  ******************************************************************************
+  * @file    host_tim.c
+  * @brief   Host model of TIM7, the basic timer of the panel keep-alive: up
+  *          counter with one pulse mode and the update interrupt. The timer
+  *          kernel clock is 200 MHz, as with the APB1 of the example.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include <stddef.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_TIM_PAGE                 0x40001000U
+#define HOST_TIM_CYCLES_PER_TICK      2U
+
+/* Private macros ------------------------------------------------------------*/
+#define HOST_TIM                      ((TIM_TypeDef *)(uintptr_t)Host_Reg(TIM7_BASE))
+
+/* Private function prototypes -----------------------------------------------*/
+static void Host_TimReset(void);
+static void Host_TimRead(uint32_t Offset);
+static void Host_TimWrite(uint32_t Offset, uint32_t Old, uint32_t New);
+static uint64_t Host_TimNextEvent(void);
+static void Host_TimEvent(uint64_t Now);
+
+/* Exported variables --------------------------------------------------------*/
+const Host_Periph_t Host_TimPeriph =
+{
+  "TIM7", HOST_TIM_PAGE, 0x1000U, Host_TimReset, Host_TimRead, Host_TimWrite, Host_TimNextEvent, Host_TimEvent
+};
+
+/* Private variables ---------------------------------------------------------*/
+static uint64_t Host_TimStart;      /* Cycle at which the counter was Host_TimCount */
+static uint32_t Host_TimCount;
+static uint32_t Host_TimRunning;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gets the CPU cycles of a counter tick.
+  * @retval CPU cycles
+  */
+static uint64_t Host_TimTickCycles(void)
+{
+  return (uint64_t)(HOST_TIM->PSC + 1U) * HOST_TIM_CYCLES_PER_TICK;
+}
+
+/**
+  * @brief  Gets the counter value at the current time.
+  * @retval Counter
+  */
+static uint32_t Host_TimCounter(void)
+{
+  if(Host_TimRunning == 0U)
+  {
+    return Host_TimCount;
+  }
+
+  return Host_TimCount + (uint32_t)((Host_GetCycles() - Host_TimStart) / Host_TimTickCycles());
+}
+
+/**
+  * @brief  Updates the TIM7 interrupt line.
+  * @retval None
+  */
+static void Host_TimIrq(void)
+{
+  TIM_TypeDef *tim = HOST_TIM;
+
+  Host_SetIrqLine(TIM7_IRQn, (((tim->SR & TIM_SR_UIF) != 0U) && ((tim->DIER & TIM_DIER_UIE) != 0U)) ? 1U : 0U);
+}
+
+/**
+  * @brief  TIM7: stops it.
+  * @retval None
+  */
+static void Host_TimReset(void)
+{
+  Host_TimRunning = 0U;
+  Host_TimCount   = 0U;
+}
+
+/**
+  * @brief  TIM7 register read: latches the counter.
+  * @param  Offset  Register offset in the page
+  * @retval None
+  */
+static void Host_TimRead(uint32_t Offset)
+{
+  if(Offset == ((TIM7_BASE - HOST_TIM_PAGE) + offsetof(TIM_TypeDef, CNT)))
+  {
+    HOST_TIM->CNT = Host_TimCounter();
+  }
+}
+
+/**
+  * @brief  TIM7 register write.
+  * @param  Offset  Register offset in the page
+  * @param  Old     Previous value
+  * @param  New     Written value
+  * @retval None
+  */
+static void Host_TimWrite(uint32_t Offset, uint32_t Old, uint32_t New)
+{
+  TIM_TypeDef *tim = HOST_TIM;
+  uint32_t reg = Offset - (TIM7_BASE - HOST_TIM_PAGE);
+
+  if(Offset < (TIM7_BASE - HOST_TIM_PAGE))
+  {
+    /* TIM6, not modelled */
+    return;
+  }
+
+  switch(reg)
+  {
+  case offsetof(TIM_TypeDef, CR1):
+    if(((New & TIM_CR1_CEN) != 0U) && (Host_TimRunning == 0U))
+    {
+      Host_TimRunning = 1U;
+      Host_TimStart = Host_GetCycles();
+    }
+    else if(((New & TIM_CR1_CEN) == 0U) && (Host_TimRunning != 0U))
+    {
+      Host_TimCount = Host_TimCounter();
+      Host_TimRunning = 0U;
+    }
+    else
+    {
+      /* No change of state */
+    }
+    break;
+  case offsetof(TIM_TypeDef, EGR):
+    if((New & TIM_EGR_UG) != 0U)
+    {
+      Host_TimCount = 0U;
+      Host_TimStart = Host_GetCycles();
+      if((tim->CR1 & TIM_CR1_URS) == 0U)
+      {
+        tim->SR |= TIM_SR_UIF;
+      }
+    }
+    tim->EGR = 0U;
+    break;
+  case offsetof(TIM_TypeDef, SR):
+    /* rc_w0 */
+    tim->SR = Old & New;
+    break;
+  case offsetof(TIM_TypeDef, CNT):
+    Host_TimCount = New;
+    Host_TimStart = Host_GetCycles();
+    break;
+  default:
+    break;
+  }
+
+  Host_TimIrq();
+}
+
+/**
+  * @brief  Gets the time of the next update event.
+  * @retval Absolute cycle, or HOST_NEVER
+  */
+static uint64_t Host_TimNextEvent(void)
+{
+  uint32_t arr = HOST_TIM->ARR & 0xFFFFU;
+
+  if(Host_TimRunning == 0U)
+  {
+    return HOST_NEVER;
+  }
+
+  return Host_TimStart + ((uint64_t)((arr + 1U) - ((Host_TimCount > arr) ? arr : Host_TimCount)) * Host_TimTickCycles());
+}
+
+/**
+  * @brief  Update event: sets UIF and restarts the count.
+  * @param  Now     Current cycle
+  * @retval None
+  */
+static void Host_TimEvent(uint64_t Now)
+{
+  TIM_TypeDef *tim = HOST_TIM;
+
+  tim->SR |= TIM_SR_UIF;
+  Host_TimCount = 0U;
+  Host_TimStart = Now;
+  if((tim->CR1 & TIM_CR1_OPM) != 0U)
+  {
+    tim->CR1 &= ~TIM_CR1_CEN;
+    Host_TimRunning = 0U;
+  }
+  Host_TimIrq();
+}
@@ -0,0 +1,205 @@
+/**
+  ******************************************************************************
+  * @file    bench_draw.c
+  * @brief   Brings the display up on the host model, runs the drawing
+  *          primitives of the BSP and of the LCD utility, checks the composed
+  *          screen and dumps it. Prints the virtual and the host pixel rates,
+  *          one "BENCH <name> <value> <unit>" line per figure, for the CI.
+  *
+  *          Arguments: [dump path], default "bench_draw.png".
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include "stm32_lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_BMP_WIDTH               64U
+#define BENCH_BMP_HEIGHT              48U
+#define BENCH_BMP_HEADER              54U
+#define BENCH_LOOPS                   8U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  const char *Name;
+  uint64_t    Cycles;
+  double      Wall;
+  uint64_t    Pixels;
+} Bench_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* The driver keeps the buffer addresses in 32 bits: static, below 4 GB */
+static uint8_t  Bench_Bmp[BENCH_BMP_HEADER + (BENCH_BMP_WIDTH * BENCH_BMP_HEIGHT * 4U)];
+static uint32_t Bench_Rgb[BENCH_BMP_WIDTH * BENCH_BMP_HEIGHT];
+static Bench_t  Bench_Current;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Builds a 32 bpp bottom-up BMP with a gradient.
+  * @retval None
+  */
+static void Bench_MakeBitmap(void)
+{
+  uint8_t *p = Bench_Bmp;
+  uint32_t x, y, size = sizeof(Bench_Bmp);
+
+  memset(p, 0, BENCH_BMP_HEADER);
+  p[0]  = 'B';
+  p[1]  = 'M';
+  p[2]  = (uint8_t)size;
+  p[3]  = (uint8_t)(size >> 8);
+  p[4]  = (uint8_t)(size >> 16);
+  p[10] = BENCH_BMP_HEADER;
+  p[14] = 40U;
+  p[18] = BENCH_BMP_WIDTH;
+  p[22] = BENCH_BMP_HEIGHT;
+  p[26] = 1U;
+  p[28] = 32U;
+
+  for(y = 0U; y < BENCH_BMP_HEIGHT; y++)
+  {
+    for(x = 0U; x < BENCH_BMP_WIDTH; x++)
+    {
+      /* Row 0 of the file is the bottom line of the picture */
+      p = &Bench_Bmp[BENCH_BMP_HEADER + (((y * BENCH_BMP_WIDTH) + x) * 4U)];
+      p[0] = (uint8_t)(x * 4U);                    /* Blue  */
+      p[1] = (uint8_t)(y * 5U);                    /* Green */
+      p[2] = 0x80U;                                /* Red   */
+      p[3] = 0xFFU;                                /* Alpha */
+    }
+  }
+
+  for(x = 0U; x < (BENCH_BMP_WIDTH * BENCH_BMP_HEIGHT); x++)
+  {
+    Bench_Rgb[x] = 0xFF00FF00U | (x & 0xFFU);
+  }
+}
+
+/**
+  * @brief  Starts a measurement.
+  * @param  pName   Figure name
+  * @retval None
+  */
+static void Bench_Start(const char *pName)
+{
+  Bench_Current.Name   = pName;
+  Bench_Current.Pixels = 0U;
+  Bench_Current.Cycles = Host_GetCycles();
+  Bench_Current.Wall   = Host_WallSeconds();
+}
+
+/**
+  * @brief  Ends a measurement, once the queued DMA2D work is done, and prints
+  *         its rates.
+  * @retval None
+  */
+static void Bench_Stop(void)
+{
+  double seconds, wall;
+
+  HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+  seconds = Host_Seconds(Host_GetCycles() - Bench_Current.Cycles);
+  wall    = Host_WallSeconds() - Bench_Current.Wall;
+
+  printf("BENCH %s.virtual %.2f MPix/s\n", Bench_Current.Name,
+         (seconds > 0.0) ? ((double)Bench_Current.Pixels / seconds / 1e6) : 0.0);
+  printf("BENCH %s.host %.2f MPix/s\n", Bench_Current.Name,
+         (wall > 0.0) ? ((double)Bench_Current.Pixels / wall / 1e6) : 0.0);
+}
+
+/**
+  * @brief  Reads a pixel of the composed screen.
+  * @param  pScreen Composed screen
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @retval 0x00RRGGBB
+  */
+static uint32_t Bench_Pixel(const uint32_t *pScreen, uint32_t Xpos, uint32_t Ypos)
+{
+  return pScreen[(Ypos * 800U) + Xpos] & 0x00FFFFFFU;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  static uint32_t screen[800U * 480U];
+  uint32_t i, x_size = 0U, y_size = 0U, color = 0U;
+  const char *path = (Host_Argc() > 1) ? Host_Argv(1) : "bench_draw.png";
+  uint64_t start;
+
+  Bench_MakeBitmap();
+
+  start = Host_GetCycles();
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  printf("BENCH init %.3f ms\n", Host_Seconds(Host_GetCycles() - start) * 1e3);
+  HOST_CHECK(BSP_LCD_GetXSize(0, &x_size) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_GetYSize(0, &y_size) == BSP_ERROR_NONE);
+  HOST_CHECK((x_size == 800U) && (y_size == 480U));
+  UTIL_LCD_SetFuncDriver(&LCD_Driver);
+
+  Bench_Start("fill");
+  for(i = 0U; i < BENCH_LOOPS; i++)
+  {
+    HOST_CHECK(BSP_LCD_FillRect(0, 0, 0, x_size, y_size, (i & 1U) ? LCD_COLOR_ARGB8888_BLACK : LCD_COLOR_ARGB8888_WHITE) == BSP_ERROR_NONE);
+    Bench_Current.Pixels += (uint64_t)x_size * y_size;
+  }
+  Bench_Stop();
+
+  Bench_Start("bitmap");
+  for(i = 0U; i < BENCH_LOOPS; i++)
+  {
+    HOST_CHECK(BSP_LCD_DrawBitmap(0, 16U + (i * 80U), 16, Bench_Bmp) == BSP_ERROR_NONE);
+    Bench_Current.Pixels += BENCH_BMP_WIDTH * BENCH_BMP_HEIGHT;
+  }
+  Bench_Stop();
+
+  Bench_Start("rgbrect");
+  for(i = 0U; i < BENCH_LOOPS; i++)
+  {
+    HOST_CHECK(BSP_LCD_FillRGBRect(0, 16U + (i * 80U), 96, (uint8_t *)Bench_Rgb, BENCH_BMP_WIDTH, BENCH_BMP_HEIGHT) == BSP_ERROR_NONE);
+    Bench_Current.Pixels += BENCH_BMP_WIDTH * BENCH_BMP_HEIGHT;
+  }
+  Bench_Stop();
+
+  Bench_Start("lines");
+  for(i = 0U; i < 64U; i++)
+  {
+    HOST_CHECK(BSP_LCD_DrawHLine(0, 0, 160U + i, x_size, LCD_COLOR_ARGB8888_RED) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_DrawVLine(0, 400U + i, 160, 64, LCD_COLOR_ARGB8888_RED) == BSP_ERROR_NONE);
+    Bench_Current.Pixels += x_size + 64U;
+  }
+  Bench_Stop();
+
+  Bench_Start("util");
+  UTIL_LCD_SetFont(&Font24);
+  UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_WHITE);
+  UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_BLUE);
+  for(i = 0U; i < 4U; i++)
+  {
+    UTIL_LCD_DisplayStringAt(0, 240U + (i * 24U), (uint8_t *)"STM32H747I-DISCO host", LEFT_MODE);
+    Bench_Current.Pixels += 21U * Font24.Width * Font24.Height;
+  }
+  UTIL_LCD_FillCircle(600, 360, 80, UTIL_LCD_COLOR_GREEN);
+  UTIL_LCD_DrawRect(440, 240, 320, 220, UTIL_LCD_COLOR_WHITE);
+  Bench_Current.Pixels += 3U * 80U * 80U;
+  Bench_Stop();
+
+  /* The screen as the LTDC sends it */
+  HOST_CHECK(Host_LtdcCompose(screen, 800U, 480U) == 0);
+  HOST_CHECK(Bench_Pixel(screen, 799U, 479U) == 0x000000U);
+  HOST_CHECK(Bench_Pixel(screen, 200U, 170U) == 0xFF0000U);
+  HOST_CHECK(Bench_Pixel(screen, 600U, 360U) == 0x00FF00U);
+  HOST_CHECK(Bench_Pixel(screen, 16U + 10U, 16U + 5U) == (0x800000U | ((uint32_t)(BENCH_BMP_HEIGHT - 1U - 5U) * 5U << 8) | 40U));
+  HOST_CHECK(Bench_Pixel(screen, 16U + 3U, 96U) == 0x00FF03U);
+  HOST_CHECK(BSP_LCD_ReadPixel(0, 600, 360, &color) == BSP_ERROR_NONE);
+  HOST_CHECK(color == LCD_COLOR_ARGB8888_GREEN);
+  HOST_CHECK(Host_LtdcDump(path) == 0);
+  printf("Screen dumped to %s\n", path);
+
+  return 0;
+}
@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * @file    test_beam_racing.c
+  * @brief   Beam racing of layer 0: a fill and a copy over the 4 bands,
+  *          submitted while the LTDC scans band 1. Each band is written by its
+  *          own DMA2D transfer, started once the LTDC left the band, and no
+  *          transfer runs while the LTDC scans the lines it writes.
+  *          The mean latency of the lines, from the submission to the end of
+  *          their transfer, is compared with a job held until the LTDC scanned
+  *          past its last line, whose lines are all written with the last band.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_WIDTH                    800U
+#define TEST_HEIGHT                   480U
+#define TEST_BAND_HEIGHT              (TEST_HEIGHT / BSP_LCD_BEAM_BANDS_NBR)
+#define TEST_SCRATCH_ADDRESS          0xD0800000U
+#define TEST_COLOR_OLD                0xFF102030U
+#define TEST_COLOR_NEW                0xFFA0B0C0U
+
+/* Copy of rows 60 to 419, across the 4 bands */
+#define TEST_COPY_ROW                 60U
+#define TEST_COPY_HEIGHT              360U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t Cycle;             /* Cycle of the CPSR read        */
+  uint64_t Pixel;             /* LTDC pixel read at that cycle */
+} Test_Scan_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Panel selection of the driver: the WAVESHARE probe, run first when
+   auto-detecting, would take the ATTINY of the Raspberry Pi panel */
+extern LCD_Driver_t Lcd_Driver_Type;
+extern LTDC_HandleTypeDef hlcd_ltdc;
+
+static Host_Dma2dJob_t Test_Done[16];
+static uint32_t        Test_DoneNbr;
+static Test_Scan_t     Test_Scan;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Records the completed transfers.
+  * @param  Job     Transfer
+  * @retval None
+  */
+static void Test_Dma2dHook(const Host_Dma2dJob_t *Job)
+{
+  if(Test_DoneNbr < (sizeof(Test_Done) / sizeof(Test_Done[0])))
+  {
+    Test_Done[Test_DoneNbr] = *Job;
+  }
+  Test_DoneNbr++;
+}
+
+/**
+  * @brief  Reads the LTDC position, the origin of Test_ScanRow().
+  * @retval None
+  */
+static void Test_ScanSync(void)
+{
+  uint32_t cpsr = hlcd_ltdc.Instance->CPSR;
+
+  Test_Scan.Cycle = Host_GetCycles();
+  Test_Scan.Pixel = ((uint64_t)(cpsr & LTDC_CPSR_CYPOS) * (hlcd_ltdc.Init.TotalWidth + 1U)) +
+                    ((cpsr & LTDC_CPSR_CXPOS) >> LTDC_CPSR_CXPOS_Pos);
+}
+
+/**
+  * @brief  Gives the active area line scanned out at a cycle.
+  * @param  Cycle   CPU cycle, after the Test_ScanSync() one
+  * @retval Line, TEST_HEIGHT during the blanking
+  */
+static uint32_t Test_ScanRow(uint64_t Cycle)
+{
+  uint64_t line_pixels  = hlcd_ltdc.Init.TotalWidth + 1U;
+  uint64_t frame_pixels = line_pixels * (hlcd_ltdc.Init.TotalHeigh + 1U);
+  uint64_t pixel;
+  uint32_t line;
+
+  pixel = Test_Scan.Pixel + (uint64_t)((double)(Cycle - Test_Scan.Cycle) * (double)frame_pixels /
+                                       (double)Host_LtdcGetFrameCycles());
+  line = (uint32_t)((pixel % frame_pixels) / line_pixels);
+
+  return ((line <= hlcd_ltdc.Init.AccumulatedVBP) || (line > hlcd_ltdc.Init.AccumulatedActiveH)) ?
+         TEST_HEIGHT : (line - hlcd_ltdc.Init.AccumulatedVBP - 1U);
+}
+
+/**
+  * @brief  Runs until the LTDC scans the first lines of a band.
+  * @param  Band    Band index
+  * @retval None
+  */
+static void Test_WaitBand(uint32_t Band)
+{
+  uint32_t line = TEST_HEIGHT;
+  uint32_t i;
+
+  for(i = 0U; (i < 100000U) && ((line < (Band * TEST_BAND_HEIGHT)) || (line >= ((Band * TEST_BAND_HEIGHT) + 8U))); i++)
+  {
+    Host_Run(200U);
+    (void)BSP_LCD_GetScanline(0, &line);
+  }
+}
+
+/**
+  * @brief  Checks the transfers of a job submitted over the 4 bands.
+  * @param  Name    Job name
+  * @param  Row     First line of the job
+  * @param  Height  Lines of the job
+  * @param  Submit  Cycle of the submission
+  * @retval Number of errors
+  */
+static uint32_t Test_CheckBands(const char *Name, uint32_t Row, uint32_t Height, uint64_t Submit)
+{
+  uint64_t line_cycles = Host_LtdcGetFrameCycles() / (hlcd_ltdc.Init.TotalHeigh + 1U);
+  uint64_t held_end = 0U, t;
+  double line_latency = 0.0;
+  uint32_t i, first, last, band, scan, start_band, errors = 0U, lines = 0U;
+
+  HOST_CHECK(Test_DoneNbr == BSP_LCD_BEAM_BANDS_NBR);
+
+  for(i = 0U; (i < Test_DoneNbr) && (i < BSP_LCD_BEAM_BANDS_NBR); i++)
+  {
+    first = (Test_Done[i].Address - LCD_LAYER_0_ADDRESS) / (TEST_WIDTH * 4U);
+    last  = first + Test_Done[i].Height - 1U;
+    band  = first / TEST_BAND_HEIGHT;
+    lines += Test_Done[i].Height;
+
+    /* One band per transfer, in the band order: band 0, already scanned,
+       at once */
+    errors += ((last / TEST_BAND_HEIGHT) != band) ? 1U : 0U;
+    errors += (band != i) ? 1U : 0U;
+
+    /* Started while the LTDC scans the next band, the blanking counting as
+       band 0 */
+    scan = Test_ScanRow(Test_Done[i].Start);
+    start_band = (scan < TEST_HEIGHT) ? (scan / TEST_BAND_HEIGHT) : 0U;
+    errors += (start_band != ((band + 1U) % BSP_LCD_BEAM_BANDS_NBR)) ? 1U : 0U;
+
+    /* Never writing the lines being scanned out */
+    for(t = Test_Done[i].Start; t <= Test_Done[i].End; t += (line_cycles / 2U))
+    {
+      scan = Test_ScanRow(t);
+      errors += ((scan >= first) && (scan <= last)) ? 1U : 0U;
+    }
+
+    printf("%s: lines %3u-%3u done %.1f us after the submission, LTDC at line %u\n", Name, (unsigned)first,
+           (unsigned)last, Host_Seconds(Test_Done[i].End - Submit) * 1e6, (unsigned)Test_ScanRow(Test_Done[i].Start));
+    line_latency += Host_Seconds(Test_Done[i].End - Submit) * 1e6 * (double)Test_Done[i].Height;
+    held_end = (Test_Done[i].End > held_end) ? Test_Done[i].End : held_end;
+  }
+  errors += (lines != Height) ? 1U : 0U;
+  errors += ((Test_Done[0].Address - LCD_LAYER_0_ADDRESS) != (Row * TEST_WIDTH * 4U)) ? 1U : 0U;
+
+  /* A job held for its last band is written once the LTDC scanned past it,
+     when the last part is done */
+  printf("BENCH beam.%s.line_latency %.1f us\n", Name, line_latency / (double)Height);
+  printf("BENCH beam.%s.held_job_line_latency %.1f us\n", Name, Host_Seconds(held_end - Submit) * 1e6);
+
+  return errors;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  uint32_t *frame = (uint32_t *)LCD_LAYER_0_ADDRESS;
+  uint32_t *source = (uint32_t *)TEST_SCRATCH_ADDRESS;
+  BSP_LCD_DMA2D_Job_t job;
+  uint64_t submit;
+  uint32_t i, errors;
+
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_SetActiveLayer(0, 0) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_FillRect(0, 0, 0, TEST_WIDTH, TEST_HEIGHT, TEST_COLOR_OLD) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_BeamStart(0) == BSP_ERROR_NONE);
+  Host_Dma2dSetHook(Test_Dma2dHook);
+
+  /* Fill of the whole frame */
+  Test_WaitBand(1U);
+  Test_ScanSync();
+  Test_DoneNbr = 0U;
+  submit = Host_GetCycles();
+  HOST_CHECK(BSP_LCD_FillRect(0, 0, 0, TEST_WIDTH, TEST_HEIGHT, TEST_COLOR_NEW) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_BeamSync(0) == BSP_ERROR_NONE);
+  HOST_CHECK(Test_CheckBands("fill", 0U, TEST_HEIGHT, submit) == 0U);
+
+  errors = 0U;
+  for(i = 0U; i < (TEST_WIDTH * TEST_HEIGHT); i++)
+  {
+    errors += (frame[i] != TEST_COLOR_NEW) ? 1U : 0U;
+  }
+  HOST_CHECK(errors == 0U);
+
+  /* Copy of a memory image: the source of each part follows its lines */
+  for(i = 0U; i < (TEST_WIDTH * TEST_COPY_HEIGHT); i++)
+  {
+    source[i] = 0xFF000000U | i;
+  }
+  SCB_CleanDCache_by_Addr(source, (int32_t)(TEST_WIDTH * TEST_COPY_HEIGHT * 4U));
+
+  memset(&job, 0, sizeof(job));
+  job.Init.Mode                  = DMA2D_M2M;
+  job.Init.ColorMode             = DMA2D_OUTPUT_ARGB8888;
+  job.Foreground.InputColorMode  = DMA2D_INPUT_ARGB8888;
+  job.Foreground.InputAlpha      = 0xFFU;
+  job.Source                     = TEST_SCRATCH_ADDRESS;
+  job.Destination                = LCD_LAYER_0_ADDRESS + (TEST_COPY_ROW * TEST_WIDTH * 4U);
+  job.Width                      = TEST_WIDTH;
+  job.Height                     = TEST_COPY_HEIGHT;
+
+  Test_WaitBand(1U);
+  Test_ScanSync();
+  Test_DoneNbr = 0U;
+  submit = Host_GetCycles();
+  HOST_CHECK(BSP_LCD_BeamSubmit(0, &job) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_BeamSync(0) == BSP_ERROR_NONE);
+  HOST_CHECK(Test_CheckBands("copy", TEST_COPY_ROW, TEST_COPY_HEIGHT, submit) == 0U);
+
+  HOST_CHECK(memcmp(&frame[TEST_COPY_ROW * TEST_WIDTH], source, TEST_WIDTH * TEST_COPY_HEIGHT * 4U) == 0);
+  HOST_CHECK(frame[(TEST_COPY_ROW * TEST_WIDTH) - 1U] == TEST_COLOR_NEW);
+  HOST_CHECK(frame[(TEST_COPY_ROW + TEST_COPY_HEIGHT) * TEST_WIDTH] == TEST_COLOR_NEW);
+
+  Host_Dma2dSetHook(NULL);
+  HOST_CHECK(BSP_LCD_BeamStop(0) == BSP_ERROR_NONE);
+
+  return 0;
+}
@@ -0,0 +1,200 @@
+/**
+  ******************************************************************************
+  * @file    test_clock_solver.c
+  * @brief   BSP_LCD_ComputeClocks(): for each DSI panel and refresh rate, the
+  *          PLL3 and DSI PLL settings must be within the H747 limits, give
+  *          the refresh rate within 10 ppm and a DSI line matching the LTDC
+  *          line within one lane byte clock. The refresh rate error of the
+  *          panel table settings is printed alongside.
+  *          The settings found for the Raspberry Pi panel are then run on the
+  *          model, which measures the pixel clock and the frame rate.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <math.h>
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_WIDTH                    800U
+#define TEST_HEIGHT                   480U
+#define TEST_RATE_PPM_MAX             10.0
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  LCD_Driver_t Id;
+  const char  *Name;
+} Test_Panel_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Panel selection of the driver, read by BSP_LCD_GetPanel() before the
+   initialization */
+extern LCD_Driver_t Lcd_Driver_Type;
+
+static const Test_Panel_t Test_Panels[] =
+{
+  { LCD_CTRL_RASPBERRYPI, "rpi"      },
+  { LCD_CTRL_OTM8009A,    "otm8009a" },
+  { LCD_CTRL_NT35510,     "nt35510"  },
+};
+
+static const uint32_t Test_Rates[] = { 50000U, 60000U, 75000U };
+
+static BSP_LCD_Panel_t Test_Panel;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gets the PLL3 R output of a setting.
+  * @param  pPll3   PLL3 setting
+  * @retval Frequency in Hz
+  */
+static double Test_Pll3R(const RCC_PLL3InitTypeDef *pPll3)
+{
+  return ((double)HSE_VALUE * ((double)pPll3->PLL3N + ((double)pPll3->PLL3FRACN / 8192.0))) /
+         ((double)pPll3->PLL3M * (double)pPll3->PLL3R);
+}
+
+/**
+  * @brief  Gets the refresh rate of a panel for its PLL3 setting.
+  * @param  pPanel  Panel descriptor
+  * @retval Refresh rate in Hz
+  */
+static double Test_Rate(const BSP_LCD_Panel_t *pPanel)
+{
+  double htotal = (double)(TEST_WIDTH + pPanel->HSYNC + pPanel->HBP + pPanel->HFP);
+  double vtotal = (double)(TEST_HEIGHT + pPanel->VSYNC + pPanel->VBP + pPanel->VFP);
+
+  return Test_Pll3R(&pPanel->Pll3) / (htotal * vtotal);
+}
+
+/**
+  * @brief  Checks a solver result against the H747 PLL limits and the target.
+  * @param  pPanel          Panel descriptor written by the solver
+  * @param  Rate            Target refresh rate in mHz
+  * @param  HorizontalLine  DSI line duration returned by the solver
+  * @param  AchievedRate    Refresh rate returned by the solver in mHz
+  * @retval Refresh rate error in ppm
+  */
+static double Test_CheckClocks(const BSP_LCD_Panel_t *pPanel, uint32_t Rate, uint32_t HorizontalLine, uint32_t AchievedRate)
+{
+  const RCC_PLL3InitTypeDef *pll3 = &pPanel->Pll3;
+  const DSI_PLLInitTypeDef *dsi = &pPanel->DsiPll;
+  uint32_t htotal = TEST_WIDTH + pPanel->HSYNC + pPanel->HBP + pPanel->HFP;
+  double ref, vco, ppm, line_ltdc, line_dsi;
+
+  /* PLL3: reference 2 to 16 MHz, wide VCO 192 to 836 MHz */
+  ref = (double)HSE_VALUE / (double)pll3->PLL3M;
+  vco = (ref * ((double)pll3->PLL3N + ((double)pll3->PLL3FRACN / 8192.0)));
+  HOST_CHECK((ref >= 2e6) && (ref <= 16e6));
+  HOST_CHECK((vco >= 192e6) && (vco <= 836e6));
+  HOST_CHECK((pll3->PLL3N >= 4U) && (pll3->PLL3N <= 512U) && (pll3->PLL3FRACN < 8192U));
+  HOST_CHECK((pll3->PLL3R >= 1U) && (pll3->PLL3R <= 128U) && (pll3->PLL3VCOSEL == RCC_PLL3VCOWIDE));
+  HOST_CHECK(pPanel->PixelClock == (uint32_t)lround(Test_Pll3R(pll3) / 1e3));
+
+  /* DSI PLL: input 4 to 25 MHz, VCO 1 to 2 GHz, lane byte clock within the limit */
+  ref = (double)HSE_VALUE / (double)dsi->PLLIDF;
+  vco = ref * 2.0 * (double)dsi->PLLNDIV;
+  HOST_CHECK((ref >= 4e6) && (ref <= 25e6));
+  HOST_CHECK((vco >= 1e9) && (vco <= 2e9));
+  HOST_CHECK(pPanel->LaneByteClock == (uint32_t)lround(vco / (double)(16UL << dsi->PLLODF) / 1e3));
+  HOST_CHECK(pPanel->LaneByteClock <= BSP_LCD_DSI_LANE_BYTE_CLOCK_MAX);
+
+  /* Refresh rate */
+  ppm = ((Test_Rate(pPanel) * 1e3) - (double)Rate) / (double)Rate * 1e6;
+  HOST_CHECK(fabs(ppm) <= TEST_RATE_PPM_MAX);
+  HOST_CHECK(AchievedRate == (uint32_t)lround(Test_Rate(pPanel) * 1e3));
+
+  /* DSI line, scaled as MX_DSIHOST_DSI_Init() does, within a lane byte clock of the LTDC line */
+  HOST_CHECK(HorizontalLine == ((htotal * pPanel->LaneByteClock) / pPanel->PixelClock));
+  line_ltdc = (double)htotal / (Test_Pll3R(pll3) / 1e3);
+  line_dsi  = (double)HorizontalLine / (double)pPanel->LaneByteClock;
+  HOST_CHECK(fabs(line_dsi - line_ltdc) <= (1.0 / (double)pPanel->LaneByteClock));
+
+  return ppm;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  const BSP_LCD_Panel_t *table;
+  uint32_t p, r, line = 0U, achieved = 0U, frames;
+  double ppm, rate;
+  uint64_t start;
+
+  /* Parameters */
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+  HOST_CHECK(BSP_LCD_GetPanel(0, &table) == BSP_ERROR_NONE);
+  Test_Panel = *table;
+  HOST_CHECK(BSP_LCD_ComputeClocks(LCD_INSTANCES_NBR, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, 60000U,
+                                   NULL, NULL) == BSP_ERROR_WRONG_PARAM);
+  HOST_CHECK(BSP_LCD_ComputeClocks(0, NULL, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, 60000U,
+                                   NULL, NULL) == BSP_ERROR_WRONG_PARAM);
+  HOST_CHECK(BSP_LCD_ComputeClocks(0, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, 0U,
+                                   NULL, NULL) == BSP_ERROR_WRONG_PARAM);
+  HOST_CHECK(BSP_LCD_ComputeClocks(0, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_ARGB8888, 60000U,
+                                   NULL, NULL) == BSP_ERROR_WRONG_PARAM);
+  Test_Panel.NumberOfLanes = 3U;
+  HOST_CHECK(BSP_LCD_ComputeClocks(0, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, 60000U,
+                                   NULL, NULL) == BSP_ERROR_WRONG_PARAM);
+
+  /* No setting: above the PLL3 output range */
+  Test_Panel = *table;
+  HOST_CHECK(BSP_LCD_ComputeClocks(0, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, 5000000U,
+                                   NULL, NULL) == BSP_ERROR_CLOCK_FAILURE);
+
+  /* Each panel and refresh rate */
+  for(p = 0U; p < (sizeof(Test_Panels) / sizeof(Test_Panels[0])); p++)
+  {
+    Lcd_Driver_Type = Test_Panels[p].Id;
+    HOST_CHECK(BSP_LCD_GetPanel(0, &table) == BSP_ERROR_NONE);
+
+    for(r = 0U; r < (sizeof(Test_Rates) / sizeof(Test_Rates[0])); r++)
+    {
+      Test_Panel = *table;
+      HOST_CHECK(BSP_LCD_ComputeClocks(0, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, Test_Rates[r],
+                                       &line, &achieved) == BSP_ERROR_NONE);
+      ppm = Test_CheckClocks(&Test_Panel, Test_Rates[r], line, achieved);
+      printf("%-8s %2u Hz: PLL3 M %2u N %3u FRACN %4u R %3u, DSI NDIV %3u IDF %u ODF %u, "
+             "lane byte clock %u kHz, line %u, error %.3f ppm\n",
+             Test_Panels[p].Name, (unsigned)(Test_Rates[r] / 1000U), (unsigned)Test_Panel.Pll3.PLL3M,
+             (unsigned)Test_Panel.Pll3.PLL3N, (unsigned)Test_Panel.Pll3.PLL3FRACN, (unsigned)Test_Panel.Pll3.PLL3R,
+             (unsigned)Test_Panel.DsiPll.PLLNDIV, (unsigned)Test_Panel.DsiPll.PLLIDF,
+             (unsigned)Test_Panel.DsiPll.PLLODF, (unsigned)Test_Panel.LaneByteClock, (unsigned)line, ppm);
+      if(Test_Rates[r] == 60000U)
+      {
+        printf("BENCH clock_solver.%s.error %.3f ppm\n", Test_Panels[p].Name, fabs(ppm));
+      }
+    }
+
+    /* Refresh rate given by the panel table setting */
+    rate = Test_Rate(table);
+    printf("%-8s table setting: %.3f Hz\n", Test_Panels[p].Name, rate);
+    printf("BENCH clock_solver.%s.table_error %.0f ppm\n", Test_Panels[p].Name, fabs(rate - 60.0) / 60.0 * 1e6);
+  }
+
+  /* Raspberry Pi panel at 60 Hz on the model */
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+  HOST_CHECK(BSP_LCD_GetPanel(0, &table) == BSP_ERROR_NONE);
+  Test_Panel = *table;
+  HOST_CHECK(BSP_LCD_ComputeClocks(0, &Test_Panel, TEST_WIDTH, TEST_HEIGHT, LCD_PIXEL_FORMAT_RGB888, 60000U,
+                                   &line, &achieved) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_SetPanel(0, &Test_Panel) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  HOST_CHECK(fabs((double)Host_LtdcGetPixelClock() - Test_Pll3R(&Test_Panel.Pll3)) <= 1.0);
+  HOST_CHECK((DSI->VLCR & DSI_VLCR_HLINE) == line);
+
+  rate = (double)HOST_CPU_CLOCK / (double)Host_LtdcGetFrameCycles();
+  start = Host_GetCycles();
+  frames = Host_LtdcGetFrames();
+  Host_Run(HOST_CPU_CLOCK);
+  frames = Host_LtdcGetFrames() - frames;
+  printf("Model: pixel clock %u Hz, %.4f Hz, %u frames in %.3f s\n", (unsigned)Host_LtdcGetPixelClock(), rate,
+         (unsigned)frames, Host_Seconds(Host_GetCycles() - start));
+  HOST_CHECK(fabs(rate - 60.0) <= (60.0 * TEST_RATE_PPM_MAX * 1e-6));
+  HOST_CHECK((frames >= 59U) && (frames <= 61U));
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    test_dirty_flush.c
+  * @brief   Damaged rectangles of the LCD utility: a UI is drawn in the
+  *          layer 0 buffer, which is copied to a second buffer by DMA2D
+  *          either whole or rectangle by rectangle. After each frame both
+  *          buffers must be equal, and the bytes written by the DMA2D are
+  *          compared between the two flushes.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include "stm32_lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_WIDTH                    800U
+#define TEST_HEIGHT                   480U
+#define TEST_FRONT                    0xD0800000U
+#define TEST_FRAMES                   16U
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Copies a rectangle of the layer 0 buffer to the front buffer.
+  * @param  Device  LCD instance
+  * @param  pRect   Rectangle
+  * @retval None
+  */
+static void Test_Flush(uint32_t Device, const UTIL_LCD_Rect_t *pRect)
+{
+  BSP_LCD_DMA2D_Job_t job;
+  uint32_t offset = ((pRect->Y * TEST_WIDTH) + pRect->X) * 4U;
+
+  memset(&job, 0, sizeof(job));
+  job.Init.Mode                  = DMA2D_M2M;
+  job.Init.ColorMode             = DMA2D_OUTPUT_ARGB8888;
+  job.Init.OutputOffset          = TEST_WIDTH - pRect->Width;
+  job.Foreground.InputColorMode  = DMA2D_INPUT_ARGB8888;
+  job.Foreground.InputOffset     = TEST_WIDTH - pRect->Width;
+  job.Foreground.AlphaMode       = DMA2D_NO_MODIF_ALPHA;
+  job.Foreground.InputAlpha      = 0xFFU;
+  job.Source                     = LCD_LAYER_0_ADDRESS + offset;
+  job.Destination                = TEST_FRONT + offset;
+  job.Width                      = pRect->Width;
+  job.Height                     = pRect->Height;
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(Device, &job, NULL) == BSP_ERROR_NONE);
+}
+
+/**
+  * @brief  Draws the changes of a UI frame: a moving needle, a progress bar,
+  *         a counter and a blinking dot.
+  * @param  Frame   Frame number
+  * @retval None
+  */
+static void Test_DrawFrame(uint32_t Frame)
+{
+  char text[32];
+
+  /* Needle: erased then drawn as a diagonal line */
+  UTIL_LCD_FillRect(40, 40, 200, 200, UTIL_LCD_COLOR_DARKBLUE);
+  UTIL_LCD_DrawLine(140, 140, 40 + ((Frame * 12U) % 200U), 40, UTIL_LCD_COLOR_YELLOW);
+
+  /* Progress bar */
+  UTIL_LCD_FillRect(300, 420, (Frame * 400U) / TEST_FRAMES, 20, UTIL_LCD_COLOR_GREEN);
+
+  /* Counter */
+  (void)snprintf(text, sizeof(text), "Frame %02u", (unsigned)Frame);
+  UTIL_LCD_DisplayStringAt(500, 60, (uint8_t *)text, LEFT_MODE);
+
+  /* Blinking dot */
+  UTIL_LCD_FillCircle(740, 240, 16, ((Frame & 1U) != 0U) ? UTIL_LCD_COLOR_RED : UTIL_LCD_COLOR_BLACK);
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  UTIL_LCD_Rect_t full = { 0U, 0U, TEST_WIDTH, TEST_HEIGHT };
+  UTIL_LCD_Rect_t rects[8];
+  Host_Dma2dStats_t stats;
+  uint64_t dirty_bytes = 0U, full_bytes = 0U;
+  uint32_t frame, n, max_rects = 0U;
+
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  UTIL_LCD_SetFuncDriver(&LCD_Driver);
+  UTIL_LCD_SetFont(&Font24);
+  UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_BLACK);
+  UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_WHITE);
+
+  /* Static background, copied whole */
+  UTIL_LCD_Clear(UTIL_LCD_COLOR_BLACK);
+  UTIL_LCD_DrawRect(20, 20, 240, 240, UTIL_LCD_COLOR_WHITE);
+  UTIL_LCD_DrawRect(290, 410, 420, 40, UTIL_LCD_COLOR_WHITE);
+  Test_Flush(0, &full);
+  HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+  HOST_CHECK(memcmp((const void *)LCD_LAYER_0_ADDRESS, (const void *)TEST_FRONT, TEST_WIDTH * TEST_HEIGHT * 4U) == 0);
+
+  UTIL_LCD_SetDirtyTracking(1U);
+  HOST_CHECK(UTIL_LCD_GetDirtyRects(rects, 8U) == 0U);
+
+  for(frame = 1U; frame <= TEST_FRAMES; frame++)
+  {
+    Test_DrawFrame(frame);
+    n = UTIL_LCD_GetDirtyRects(rects, 8U);
+    HOST_CHECK((n > 0U) && (n <= 8U));
+    max_rects = (n > max_rects) ? n : max_rects;
+
+    /* Dirty flush: every written pixel reaches the front buffer */
+    HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+    Host_Dma2dResetStats();
+    UTIL_LCD_FlushDirtyRects(Test_Flush);
+    HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+    Host_Dma2dGetStats(&stats);
+    dirty_bytes += stats.BytesWritten;
+    HOST_CHECK(UTIL_LCD_GetDirtyRects(rects, 8U) == 0U);
+    HOST_CHECK(memcmp((const void *)LCD_LAYER_0_ADDRESS, (const void *)TEST_FRONT, TEST_WIDTH * TEST_HEIGHT * 4U) == 0);
+
+    /* Full flush of the same frame, for the comparison */
+    Host_Dma2dResetStats();
+    Test_Flush(0, &full);
+    HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+    Host_Dma2dGetStats(&stats);
+    full_bytes += stats.BytesWritten;
+  }
+
+  printf("Dirty flush: %llu bytes, up to %u rectangles a frame\n", (unsigned long long)dirty_bytes, (unsigned)max_rects);
+  printf("Full flush:  %llu bytes\n", (unsigned long long)full_bytes);
+  printf("BENCH dirty_flush.bytes_ratio %.3f\n", (double)dirty_bytes / (double)full_bytes);
+  HOST_CHECK(full_bytes == ((uint64_t)TEST_FRAMES * TEST_WIDTH * TEST_HEIGHT * 4U));
+  HOST_CHECK((dirty_bytes * 4U) < full_bytes);
+
+  /* Areas written without the utility */
+  UTIL_LCD_AddDirtyRect(790, 470, 20, 20);
+  n = UTIL_LCD_GetDirtyRects(rects, 8U);
+  HOST_CHECK((n == 1U) && (rects[0].X == 790U) && (rects[0].Width == 10U) && (rects[0].Height == 10U));
+  UTIL_LCD_SetDirtyTracking(0U);
+  UTIL_LCD_FillRect(0, 0, 10, 10, UTIL_LCD_COLOR_RED);
+  HOST_CHECK(UTIL_LCD_GetDirtyRects(rects, 8U) == 0U);
+
+  return 0;
+}
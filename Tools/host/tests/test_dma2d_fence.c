@@ -0,0 +1,151 @@
+/**
+  ******************************************************************************
+  * @file    test_dma2d_fence.c
+  * @brief   DMA2D job queue: fences are issued in submission order, the jobs
+  *          run one after the other in that order, a fence is signaled only
+  *          once its job and all the earlier ones are done, and a wait
+  *          completes with the interrupts masked and times out when the DMA2D
+  *          interrupt is lost.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_JOBS                     (BSP_LCD_DMA2D_QUEUE_SIZE + 8U)
+#define TEST_SCRATCH                  0xD0800000U
+#define TEST_JOB_SIZE                 0x4000U
+#define TEST_WIDTH                    64U
+#define TEST_HEIGHT                   32U
+
+/* Private variables ---------------------------------------------------------*/
+static Host_Dma2dJob_t Test_Done[64];
+static uint32_t        Test_DoneNbr;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Records the completed transfers.
+  * @param  Job     Transfer
+  * @retval None
+  */
+static void Test_Dma2dHook(const Host_Dma2dJob_t *Job)
+{
+  if(Test_DoneNbr < (sizeof(Test_Done) / sizeof(Test_Done[0])))
+  {
+    Test_Done[Test_DoneNbr] = *Job;
+  }
+  Test_DoneNbr++;
+}
+
+/**
+  * @brief  Builds a register to memory fill of the scratch area.
+  * @param  pJob    Job
+  * @param  Index   Job number, selects the destination
+  * @param  Color   ARGB8888 color
+  * @retval None
+  */
+static void Test_FillJob(BSP_LCD_DMA2D_Job_t *pJob, uint32_t Index, uint32_t Color)
+{
+  memset(pJob, 0, sizeof(*pJob));
+  pJob->Init.Mode      = DMA2D_R2M;
+  pJob->Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+  pJob->Source         = Color;
+  pJob->Destination    = TEST_SCRATCH + (Index * TEST_JOB_SIZE);
+  pJob->Width          = TEST_WIDTH;
+  pJob->Height         = TEST_HEIGHT;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  BSP_LCD_DMA2D_Job_t job;
+  BSP_LCD_Fence_t fence[TEST_JOBS], last;
+  uint32_t i, done;
+  uint64_t start;
+
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+  Host_Dma2dSetHook(Test_Dma2dHook);
+
+  /* Parameters */
+  Test_FillJob(&job, 0U, 0U);
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(LCD_INSTANCES_NBR, &job, &last) == BSP_ERROR_WRONG_PARAM);
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(0, NULL, &last) == BSP_ERROR_WRONG_PARAM);
+  job.pCLUT = (const uint32_t *)TEST_SCRATCH;
+  job.CLUTSize = 0U;
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(0, &job, &last) == BSP_ERROR_WRONG_PARAM);
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, last, 0U) == BSP_ERROR_NONE);
+  HOST_CHECK(Test_DoneNbr == 0U);
+
+  /* More jobs than queue slots: the submission waits for a free slot */
+  for(i = 0U; i < TEST_JOBS; i++)
+  {
+    Test_FillJob(&job, i, 0xFF000000U | i);
+    HOST_CHECK(BSP_LCD_DMA2D_Submit(0, &job, &fence[i]) == BSP_ERROR_NONE);
+    HOST_CHECK((i == 0U) || (fence[i] == (fence[i - 1U] + 1U)));
+    HOST_CHECK(((i + 1U) - Test_DoneNbr) <= BSP_LCD_DMA2D_QUEUE_SIZE);
+  }
+
+  /* The last job is queued, not run */
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, fence[TEST_JOBS - 1U], 0U) == BSP_ERROR_BUSY);
+  HOST_CHECK(Test_DoneNbr < TEST_JOBS);
+
+  /* A fence covers its job and the earlier ones, the later ones may be pending */
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, fence[TEST_JOBS / 2U], BSP_LCD_DMA2D_TIMEOUT) == BSP_ERROR_NONE);
+  done = Test_DoneNbr;
+  HOST_CHECK(done >= ((TEST_JOBS / 2U) + 1U));
+  HOST_CHECK(done < TEST_JOBS);
+  for(i = 0U; i < done; i++)
+  {
+    HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, fence[i], 0U) == BSP_ERROR_NONE);
+  }
+
+  /* Submission order, one job at a time */
+  HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+  HOST_CHECK(Test_DoneNbr == TEST_JOBS);
+  for(i = 0U; i < TEST_JOBS; i++)
+  {
+    HOST_CHECK(Test_Done[i].Address == (TEST_SCRATCH + (i * TEST_JOB_SIZE)));
+    HOST_CHECK((i == 0U) || (Test_Done[i].Start >= Test_Done[i - 1U].End));
+    HOST_CHECK(*(volatile uint32_t *)(TEST_SCRATCH + (i * TEST_JOB_SIZE) + (TEST_WIDTH * TEST_HEIGHT * 4U) - 4U) ==
+               (0xFF000000U | i));
+  }
+
+  /* Jobs on the same area: the last one submitted wins */
+  Test_FillJob(&job, 0U, 0xFF112233U);
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(0, &job, NULL) == BSP_ERROR_NONE);
+  Test_FillJob(&job, 0U, 0xFF445566U);
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(0, &job, &last) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, last, BSP_LCD_DMA2D_TIMEOUT) == BSP_ERROR_NONE);
+  HOST_CHECK(*(volatile uint32_t *)TEST_SCRATCH == 0xFF445566U);
+
+  /* Interrupts masked: the wait services the DMA2D */
+  __disable_irq();
+  Test_FillJob(&job, 1U, 0xFF778899U);
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(0, &job, &last) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, last, BSP_LCD_DMA2D_TIMEOUT) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+  __enable_irq();
+  HOST_CHECK(*(volatile uint32_t *)(TEST_SCRATCH + TEST_JOB_SIZE) == 0xFF778899U);
+
+  /* Lost interrupt: the wait times out on the cycle counter, then recovers */
+  NVIC_DisableIRQ(DMA2D_IRQn);
+  Test_FillJob(&job, 2U, 0xFFAABBCCU);
+  HOST_CHECK(BSP_LCD_DMA2D_Submit(0, &job, &last) == BSP_ERROR_NONE);
+  start = Host_GetCycles();
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, last, 5U) == BSP_ERROR_BUSY);
+  printf("Lost interrupt: wait returned after %.3f ms\n", Host_Seconds(Host_GetCycles() - start) * 1e3);
+  HOST_CHECK(Host_Seconds(Host_GetCycles() - start) >= 0.005);
+  HOST_CHECK(Host_Seconds(Host_GetCycles() - start) < 0.006);
+  NVIC_EnableIRQ(DMA2D_IRQn);
+  HOST_CHECK(BSP_LCD_DMA2D_WaitFence(0, last, BSP_LCD_DMA2D_TIMEOUT) == BSP_ERROR_NONE);
+  HOST_CHECK(*(volatile uint32_t *)(TEST_SCRATCH + (2U * TEST_JOB_SIZE)) == 0xFFAABBCCU);
+
+  Host_Dma2dSetHook(NULL);
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file    test_dsi_batch.c
+  * @brief   DSI write batching of the RASPBERRYPI initialization. Built twice:
+  *          with USE_BSP_LCD_DSI_BATCH, the long writes of a script step are
+  *          queued in the command FIFO, and without it, each write waits for
+  *          the FIFO to drain.
+  *          The unbatched run writes the packets the panel received and the
+  *          DSI statistics to a file, that the batched run compares with its
+  *          own: same packets, in the same order, with the same payloads,
+  *          fewer FIFO waits and less CPU time in the writes.
+  *
+  *          Arguments: [reference file], default "dsi_batch_off.bin".
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_PACKETS_MAX              256U
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  BSP_LCD_DSI_Stats_t Stats;  /* Driver statistics of the init */
+  uint32_t            Nbr;    /* Packets received              */
+  Host_DsiPacket_t    Packets[TEST_PACKETS_MAX];
+} Test_Result_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Panel selection of the driver: the WAVESHARE probe, run first when
+   auto-detecting, would take the ATTINY of the Raspberry Pi panel */
+extern LCD_Driver_t Lcd_Driver_Type;
+
+static Test_Result_t Test_Result;
+static Test_Result_t Test_Reference;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Compares the content of two packets, not their timings.
+  * @param  pA  Packet
+  * @param  pB  Packet
+  * @retval 1 if they are the same
+  */
+static uint32_t Test_SamePacket(const Host_DsiPacket_t *pA, const Host_DsiPacket_t *pB)
+{
+  return ((pA->Type == pB->Type) && (pA->Channel == pB->Channel) && (pA->Size == pB->Size) &&
+          (memcmp(pA->Data, pB->Data, (pA->Size < HOST_DSI_PAYLOAD_MAX) ? pA->Size : HOST_DSI_PAYLOAD_MAX) == 0)) ? 1U : 0U;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  const char *path = (Host_Argc() > 1) ? Host_Argv(1) : "dsi_batch_off.bin";
+  const Host_DsiPacket_t *packets;
+  uint32_t i, nbr, order = 0U, diff = 0U;
+  FILE *file;
+
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+  Host_DsiResetPackets();
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  HOST_CHECK(BSP_LCD_GetDsiStats(0, &Test_Result.Stats) == BSP_ERROR_NONE);
+
+  /* Packets of the init, sent in the order they were written */
+  nbr = Host_DsiGetPackets(&packets);
+  HOST_CHECK((nbr > 0U) && (nbr <= TEST_PACKETS_MAX));
+  Test_Result.Nbr = (nbr < TEST_PACKETS_MAX) ? nbr : TEST_PACKETS_MAX;
+  for(i = 0U; i < Test_Result.Nbr; i++)
+  {
+    Test_Result.Packets[i] = packets[i];
+    if((i > 0U) && ((packets[i].Sent < packets[i - 1U].Sent) || (packets[i].Time < packets[i - 1U].Time)))
+    {
+      order++;
+    }
+  }
+  HOST_CHECK(order == 0U);
+  HOST_CHECK(Test_Result.Stats.Packets > 0U);
+
+  printf("%u packets received, driver: %u packets, %u FIFO waits, %u cycles (%u us)\n", (unsigned)Test_Result.Nbr,
+         (unsigned)Test_Result.Stats.Packets, (unsigned)Test_Result.Stats.Waits, (unsigned)Test_Result.Stats.Cycles,
+         (unsigned)Test_Result.Stats.Time);
+  printf("BENCH dsi_batch.%s.write_time %u us\n", (USE_BSP_LCD_DSI_BATCH != 0) ? "on" : "off",
+         (unsigned)Test_Result.Stats.Time);
+
+#if (USE_BSP_LCD_DSI_BATCH == 0)
+  file = fopen(path, "wb");
+  HOST_CHECK(file != NULL);
+  if(file != NULL)
+  {
+    HOST_CHECK(fwrite(&Test_Result, sizeof(Test_Result), 1U, file) == 1U);
+    (void)fclose(file);
+  }
+#else
+  file = fopen(path, "rb");
+  HOST_CHECK(file != NULL);
+  if(file != NULL)
+  {
+    HOST_CHECK(fread(&Test_Reference, sizeof(Test_Reference), 1U, file) == 1U);
+    (void)fclose(file);
+
+    /* Same packets and payloads, in the same order */
+    HOST_CHECK(Test_Result.Nbr == Test_Reference.Nbr);
+    for(i = 0U; (i < Test_Result.Nbr) && (i < Test_Reference.Nbr); i++)
+    {
+      if(Test_SamePacket(&Test_Result.Packets[i], &Test_Reference.Packets[i]) == 0U)
+      {
+        printf("Packet %u: type 0x%02X size %u, expected type 0x%02X size %u\n", (unsigned)i,
+               (unsigned)Test_Result.Packets[i].Type, (unsigned)Test_Result.Packets[i].Size,
+               (unsigned)Test_Reference.Packets[i].Type, (unsigned)Test_Reference.Packets[i].Size);
+        diff++;
+      }
+    }
+    HOST_CHECK(diff == 0U);
+    HOST_CHECK(Test_Result.Stats.Packets == Test_Reference.Stats.Packets);
+
+    printf("Unbatched: %u FIFO waits, %u us, batched: %u FIFO waits, %u us\n",
+           (unsigned)Test_Reference.Stats.Waits, (unsigned)Test_Reference.Stats.Time,
+           (unsigned)Test_Result.Stats.Waits, (unsigned)Test_Result.Stats.Time);
+    printf("BENCH dsi_batch.speedup %.2f x\n", (double)Test_Reference.Stats.Cycles / (double)Test_Result.Stats.Cycles);
+    HOST_CHECK(Test_Result.Stats.Waits < Test_Reference.Stats.Waits);
+    HOST_CHECK(Test_Result.Stats.Cycles < Test_Reference.Stats.Cycles);
+  }
+#endif /* USE_BSP_LCD_DSI_BATCH */
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    test_init_overlap.c
+  * @brief   Boot critical path: the LCD initialization of the Raspberry Pi
+  *          panel and 200 ms of application boot work, in 5 ms chunks, on
+  *          virtual time. Built twice: with INIT_BLOCKING, BSP_LCD_Init() is
+  *          followed by the work, else BSP_LCD_InitEx() returns once the
+  *          reset pulse is started and the work is run between
+  *          BSP_LCD_InitPoll() calls.
+  *          The blocking run writes its figures to a file, that the polled
+  *          run compares with its own.
+  *
+  *          Arguments: [reference file], default "init_blocking.bin".
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_CHUNKS                   40U
+#define TEST_CHUNK_CYCLES             (5U * (HOST_CPU_CLOCK / 1000U))
+
+#ifndef INIT_BLOCKING
+#define INIT_BLOCKING                 0
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t FirstFrame;        /* Cycles from the start to the first frame   */
+  uint64_t CriticalPath;      /* Cycles from the start to the end of both   */
+} Test_Result_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Panel selection of the driver: the WAVESHARE probe, run first when
+   auto-detecting, would take the ATTINY of the Raspberry Pi panel */
+extern LCD_Driver_t Lcd_Driver_Type;
+
+static Test_Result_t Test_Result;
+static Test_Result_t Test_Reference;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Converts cycles to ms.
+  * @param  Cycles  CPU cycles
+  * @retval ms
+  */
+static double Test_Ms(uint64_t Cycles)
+{
+  return Host_Seconds(Cycles) * 1e3;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  const char *path = (Host_Argc() > 1) ? Host_Argv(1) : "init_blocking.bin";
+  BSP_LCD_InitTime_t init_time;
+  uint64_t start;
+  uint32_t chunks = 0U, polls = 0U;
+  int32_t ret;
+  FILE *file;
+
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+
+  start = Host_GetCycles();
+#if (INIT_BLOCKING != 0)
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  Test_Result.FirstFrame = Host_GetCycles() - start;
+  for(chunks = 0U; chunks < TEST_CHUNKS; chunks++)
+  {
+    Host_Run(TEST_CHUNK_CYCLES);
+  }
+  ret = BSP_ERROR_NONE;
+#else
+  /* Returns with the reset pulse running */
+  HOST_CHECK(BSP_LCD_InitEx(0, LCD_ORIENTATION_LANDSCAPE, LCD_PIXEL_FORMAT_RGB888, 800, 480) == BSP_ERROR_NONE);
+  printf("BSP_LCD_InitEx() returned after %.3f ms\n", Test_Ms(Host_GetCycles() - start));
+  HOST_CHECK(Test_Ms(Host_GetCycles() - start) < 1.0);
+  HOST_CHECK(BSP_LCD_InitPoll(0) == BSP_ERROR_BUSY);
+
+  /* Boot work between the polls, up to the end of both */
+  do
+  {
+    ret = BSP_LCD_InitPoll(0);
+    polls++;
+    if((ret != BSP_ERROR_BUSY) && (Test_Result.FirstFrame == 0U))
+    {
+      Test_Result.FirstFrame = Host_GetCycles() - start;
+    }
+    if(chunks < TEST_CHUNKS)
+    {
+      Host_Run(TEST_CHUNK_CYCLES);
+      chunks++;
+    }
+  } while((ret == BSP_ERROR_BUSY) || (chunks < TEST_CHUNKS));
+  HOST_CHECK(BSP_LCD_InitPoll(0) == BSP_ERROR_NONE);
+#endif /* INIT_BLOCKING */
+  HOST_CHECK(ret == BSP_ERROR_NONE);
+  Test_Result.CriticalPath = Host_GetCycles() - start;
+
+  /* The panel shows the LTDC frames */
+  HOST_CHECK(BSP_LCD_GetInitTime(0, &init_time) == BSP_ERROR_NONE);
+  HOST_CHECK(init_time.FirstFrame != 0U);
+  HOST_CHECK(init_time.PanelWait > 0U);
+  Host_Run(HOST_CPU_CLOCK / 10U);
+  HOST_CHECK(Host_LtdcGetFrames() > 0U);
+
+  printf("First frame %.1f ms, critical path %.1f ms, panel delays %u ms, SDRAM and idle work %u ms, %u polls\n",
+         Test_Ms(Test_Result.FirstFrame), Test_Ms(Test_Result.CriticalPath), (unsigned)init_time.PanelWait,
+         (unsigned)init_time.IdleWork, (unsigned)polls);
+  printf("BENCH init.%s.critical_path %.1f ms\n", (INIT_BLOCKING != 0) ? "blocking" : "polled",
+         Test_Ms(Test_Result.CriticalPath));
+
+#if (INIT_BLOCKING != 0)
+  file = fopen(path, "wb");
+  HOST_CHECK(file != NULL);
+  if(file != NULL)
+  {
+    HOST_CHECK(fwrite(&Test_Result, sizeof(Test_Result), 1U, file) == 1U);
+    (void)fclose(file);
+  }
+#else
+  file = fopen(path, "rb");
+  HOST_CHECK(file != NULL);
+  if(file != NULL)
+  {
+    HOST_CHECK(fread(&Test_Reference, sizeof(Test_Reference), 1U, file) == 1U);
+    (void)fclose(file);
+
+    /* The work overlaps the panel delays: the critical path is the longest
+       of the two, instead of their sum */
+    printf("Blocking: first frame %.1f ms, critical path %.1f ms\n", Test_Ms(Test_Reference.FirstFrame),
+           Test_Ms(Test_Reference.CriticalPath));
+    printf("BENCH init.critical_path_saved %.1f ms\n", Test_Ms(Test_Reference.CriticalPath - Test_Result.CriticalPath));
+    HOST_CHECK(Test_Result.CriticalPath < Test_Reference.CriticalPath);
+    HOST_CHECK((Test_Reference.CriticalPath - Test_Result.CriticalPath) >= ((TEST_CHUNKS * TEST_CHUNK_CYCLES) / 2U));
+    HOST_CHECK(Test_Result.CriticalPath <= (Test_Reference.FirstFrame + (2U * TEST_CHUNK_CYCLES)));
+  }
+#endif /* INIT_BLOCKING */
+
+  return 0;
+}
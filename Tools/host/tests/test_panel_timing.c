@@ -0,0 +1,158 @@
+/**
+  ******************************************************************************
+  * @file    test_panel_timing.c
+  * @brief   Panel descriptors: the DSI host, LTDC and PLL3 registers set up by
+  *          BSP_LCD_Init() from the BSP_LCD_Panel_t entry of the panel must be
+  *          the ones the driver wrote with its per panel code, recorded below.
+  *          Built once per panel, selected by TEST_PANEL. Built with
+  *          TEST_PANEL_PRINT, it prints the registers instead, in the table
+  *          format.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_PANEL_RASPBERRYPI        1
+#define TEST_PANEL_OTM8009A           2
+#define TEST_PANEL_NT35510            3
+#define TEST_PANEL_WAVESHARE_2P8      4
+
+#ifndef TEST_PANEL
+#define TEST_PANEL                    TEST_PANEL_RASPBERRYPI
+#endif
+
+#define TEST_REG(periph, reg)         { #periph "->" #reg, &(periph)->reg }
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  const char                *Name;
+  volatile const uint32_t   *pReg;
+} Test_Reg_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* Panel selection of the driver: when auto-detecting, the WAVESHARE probe runs
+   first and takes the ATTINY of the Raspberry Pi panel, and the panels probed
+   before the DSI host must answer */
+extern LCD_Driver_t Lcd_Driver_Type;
+
+static const Test_Reg_t Test_Regs[] =
+{
+  TEST_REG(DSI, CCR),       TEST_REG(DSI, LVCIDR),    TEST_REG(DSI, LCOLCR),    TEST_REG(DSI, LPCR),
+  TEST_REG(DSI, LPMCR),     TEST_REG(DSI, PCR),       TEST_REG(DSI, MCR),       TEST_REG(DSI, VMCR),
+  TEST_REG(DSI, VPCR),      TEST_REG(DSI, VCCR),      TEST_REG(DSI, VNPCR),     TEST_REG(DSI, VHSACR),
+  TEST_REG(DSI, VHBPCR),    TEST_REG(DSI, VLCR),      TEST_REG(DSI, VVSACR),    TEST_REG(DSI, VVBPCR),
+  TEST_REG(DSI, VVFPCR),    TEST_REG(DSI, VVACR),     TEST_REG(DSI, LCCR),      TEST_REG(DSI, CMCR),
+  TEST_REG(DSI, CLCR),      TEST_REG(DSI, CLTCR),     TEST_REG(DSI, DLTCR),     TEST_REG(DSI, PCONFR),
+  TEST_REG(DSI, WCFGR),     TEST_REG(DSI, WRPCR),
+  TEST_REG(LTDC, SSCR),     TEST_REG(LTDC, BPCR),     TEST_REG(LTDC, AWCR),     TEST_REG(LTDC, TWCR),
+  TEST_REG(LTDC, GCR),      TEST_REG(LTDC, BCCR),
+  TEST_REG(LTDC_Layer1, WHPCR), TEST_REG(LTDC_Layer1, WVPCR), TEST_REG(LTDC_Layer1, PFCR),
+  TEST_REG(LTDC_Layer1, CFBLR), TEST_REG(LTDC_Layer1, CFBLNR),
+  TEST_REG(RCC, PLLCKSELR), TEST_REG(RCC, PLLCFGR),   TEST_REG(RCC, PLL3DIVR),  TEST_REG(RCC, PLL3FRACR),
+};
+
+#define TEST_REGS_NBR                 (sizeof(Test_Regs) / sizeof(Test_Regs[0]))
+
+/* Register values written by the per panel code, in Test_Regs order */
+static const uint32_t Test_Expected[TEST_REGS_NBR] =
+{
+#if (TEST_PANEL == TEST_PANEL_RASPBERRYPI)
+  0x0000000AU, 0x00000000U, 0x00000005U, 0x00000006U,
+  0x00400040U, 0x00000004U, 0x00000000U, 0x0000BF02U,
+  0x00000320U, 0x00000000U, 0x00000FFFU, 0x00000008U,
+  0x000000BBU, 0x00000FEBU, 0x00000002U, 0x00000016U,
+  0x00000007U, 0x000001E0U, 0x00000000U, 0x00000000U,
+  0x00000001U, 0x00000000U, 0x00000000U, 0x00000000U,
+  0x0000000AU, 0x01000881U,
+  0x00010001U, 0x002E0017U, 0x034E01F7U, 0x03D101FEU,
+  0xC0000001U, 0x00000000U,
+  0x034E002FU, 0x01F70018U, 0x00000000U,
+  0x0C800C87U, 0x000001E0U,
+  0x00500052U, 0x01070908U, 0x0F01025FU, 0x00000000U,
+#elif (TEST_PANEL == TEST_PANEL_OTM8009A)
+  0x00000004U, 0x00000000U, 0x00000005U, 0x00000000U,
+  0x00040004U, 0x00000004U, 0x00000000U, 0x0000BF02U,
+  0x00000320U, 0x00000000U, 0x00000FFFU, 0x00000004U,
+  0x0000004DU, 0x000007BEU, 0x00000001U, 0x0000000FU,
+  0x00000010U, 0x000001E0U, 0x00000000U, 0x00000000U,
+  0x00000001U, 0x00000000U, 0x00000000U, 0x00000001U,
+  0x0000000AU, 0x01002991U,
+  0x00010000U, 0x0023000FU, 0x034301EFU, 0x036501FFU,
+  0x00000001U, 0x00000000U,
+  0x03430024U, 0x01EF0010U, 0x00000000U,
+  0x0C800C87U, 0x000001E0U,
+  0x00500052U, 0x01070908U, 0x17010283U, 0x00000000U,
+#elif (TEST_PANEL == TEST_PANEL_WAVESHARE_2P8)
+  0x00000008U, 0x00000000U, 0x00000005U, 0x00000000U,
+  0x00040004U, 0x00000004U, 0x00000000U, 0x0000BF02U,
+  0x00000320U, 0x00000000U, 0x00000FFFU, 0x0000007DU,
+  0x00000177U, 0x00000B3BU, 0x00000032U, 0x00000096U,
+  0x00000096U, 0x000001E0U, 0x00000000U, 0x00000000U,
+  0x00000001U, 0x00000000U, 0x00000000U, 0x00000001U,
+  0x0000000AU, 0x010019E1U,
+  0x00310031U, 0x00C700C7U, 0x03E702A7U, 0x047D033DU,
+  0x00000001U, 0x00000000U,
+  0x03E700C8U, 0x02A700C8U, 0x00000000U,
+  0x0C800C87U, 0x000001E0U,
+  0x00500052U, 0x01070B08U, 0x0701024FU, 0x00000000U,
+#else
+  0x00000004U, 0x00000000U, 0x00000005U, 0x00000000U,
+  0x00400040U, 0x00000004U, 0x00000000U, 0x0000BF02U,
+  0x00000320U, 0x00000000U, 0x00000FFFU, 0x00000004U,
+  0x0000004DU, 0x000007BEU, 0x00000078U, 0x00000096U,
+  0x00000096U, 0x000001E0U, 0x00000000U, 0x00000000U,
+  0x00000001U, 0x00000000U, 0x00000000U, 0x00000001U,
+  0x0000000AU, 0x01002991U,
+  0x00010077U, 0x0023010DU, 0x034302EDU, 0x03650383U,
+  0x00000001U, 0x00000000U,
+  0x03430024U, 0x02ED010EU, 0x00000000U,
+  0x0C800C87U, 0x000001E0U,
+  0x00500052U, 0x01070908U, 0x17010283U, 0x00000000U,
+#endif
+};
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  uint32_t i, errors = 0U;
+
+#if (TEST_PANEL == TEST_PANEL_RASPBERRYPI)
+  Host_BoardSetPanel(HOST_PANEL_RASPBERRYPI);
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+#elif (TEST_PANEL == TEST_PANEL_OTM8009A)
+  Host_BoardSetPanel(HOST_PANEL_OTM8009A);
+  Lcd_Driver_Type = LCD_CTRL_OTM8009A;
+#elif (TEST_PANEL == TEST_PANEL_WAVESHARE_2P8)
+  /* The WAVESHARE panel answers at the address of the ATTINY */
+  Host_BoardSetPanel(HOST_PANEL_RASPBERRYPI);
+  Lcd_Driver_Type = LCD_CTRL_WAVESHARE_2P8;
+#else
+  Host_BoardSetPanel(HOST_PANEL_NT35510);
+  Lcd_Driver_Type = LCD_CTRL_NT35510;
+#endif
+
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+
+  for(i = 0U; i < TEST_REGS_NBR; i++)
+  {
+#ifdef TEST_PANEL_PRINT
+    printf("  0x%08XU,  /* %s */\n", (unsigned)*Test_Regs[i].pReg, Test_Regs[i].Name);
+#else
+    if(*Test_Regs[i].pReg != Test_Expected[i])
+    {
+      printf("%-20s 0x%08X, expected 0x%08X\n", Test_Regs[i].Name, (unsigned)*Test_Regs[i].pReg,
+             (unsigned)Test_Expected[i]);
+      errors++;
+    }
+#endif
+  }
+  printf("Panel %d: %u of %u registers differ\n", TEST_PANEL, (unsigned)errors, (unsigned)TEST_REGS_NBR);
+  HOST_CHECK(errors == 0U);
+
+  return 0;
+}
@@ -0,0 +1,207 @@
+/**
+  ******************************************************************************
+  * @file    test_polygon_fill.c
+  * @brief   UTIL_LCD_FillPolygon() fill rate. Built twice: with the scanline
+  *          filler, and with POLYGON_FILL_REFERENCE and an edge table of two
+  *          entries, too small for the test shapes, which sends them to the
+  *          previous triangle fan.
+  *          The reference run writes its figures and the pixels it covered to
+  *          a file, that the scanline run compares with its own.
+  *
+  *          Arguments: [reference file], default "polygon_fill_fan.bin".
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include "stm32_lcd.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_WIDTH                    800U
+#define TEST_HEIGHT                   480U
+#define TEST_LOOPS                    2U
+#define TEST_SHAPES                   4U
+#define TEST_POINTS_MAX               16U
+
+#ifndef POLYGON_FILL_REFERENCE
+#define POLYGON_FILL_REFERENCE        0
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t Cycles;            /* Virtual time of the fills     */
+  uint64_t Pixels;            /* Pixels filled                 */
+  uint8_t  Mask[TEST_WIDTH * TEST_HEIGHT];
+} Test_Result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static Point         Test_Shapes[TEST_SHAPES][TEST_POINTS_MAX];
+static uint32_t      Test_ShapePoints[TEST_SHAPES];
+static Test_Result_t Test_Result;
+static Test_Result_t Test_Reference;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Builds a regular polygon or a star, symmetric about its center.
+  * @param  Shape   Shape number
+  * @param  Xc      Center X
+  * @param  Yc      Center Y
+  * @param  Points  Number of points
+  * @param  R1      Radius of the even points
+  * @param  R2      Radius of the odd points
+  * @retval None
+  */
+static void Test_MakeShape(uint32_t Shape, int32_t Xc, int32_t Yc, uint32_t Points, double R1, double R2)
+{
+  uint32_t i;
+  double a, r;
+
+  for(i = 0U; i < Points; i++)
+  {
+    a = (6.283185307179586 * (double)i) / (double)Points;
+    r = ((i & 1U) != 0U) ? R2 : R1;
+    Test_Shapes[Shape][i].X = (int16_t)lround((double)Xc + (r * cos(a)));
+    Test_Shapes[Shape][i].Y = (int16_t)lround((double)Yc + (r * sin(a)));
+  }
+  Test_ShapePoints[Shape] = Points;
+}
+
+/**
+  * @brief  Counts the pixels of the layer 0 buffer that are not black, and
+  *         records them in the mask.
+  * @param  pMask   Coverage mask, or NULL
+  * @retval Pixels
+  */
+static uint64_t Test_Coverage(uint8_t *pMask)
+{
+  const uint32_t *p = (const uint32_t *)LCD_LAYER_0_ADDRESS;
+  uint64_t n = 0U;
+  uint32_t i;
+
+  for(i = 0U; i < (TEST_WIDTH * TEST_HEIGHT); i++)
+  {
+    if((p[i] & 0x00FFFFFFU) != 0U)
+    {
+      n++;
+      if(pMask != NULL)
+      {
+        pMask[i] = 1U;
+      }
+    }
+  }
+
+  return n;
+}
+
+/**
+  * @brief  Tells whether a pixel is near the edge of the covered area. The
+  *         triangle fan draws the edges inclusively, and reaches two pixels
+  *         deep in the concave corners.
+  * @param  pMask   Coverage mask
+  * @param  Index   Pixel
+  * @retval 1 if a pixel at most 2 away differs from it
+  */
+static uint32_t Test_OnEdge(const uint8_t *pMask, uint32_t Index)
+{
+  uint32_t x = Index % TEST_WIDTH, y = Index / TEST_WIDTH;
+  int32_t dx, dy, nx, ny;
+
+  for(dy = -2; dy <= 2; dy++)
+  {
+    for(dx = -2; dx <= 2; dx++)
+    {
+      nx = (int32_t)x + dx;
+      ny = (int32_t)y + dy;
+      if((nx >= 0) && (ny >= 0) && (nx < (int32_t)TEST_WIDTH) && (ny < (int32_t)TEST_HEIGHT) &&
+         (pMask[((uint32_t)ny * TEST_WIDTH) + (uint32_t)nx] != pMask[Index]))
+      {
+        return 1U;
+      }
+    }
+  }
+
+  return 0U;
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  const char *path = (Host_Argc() > 1) ? Host_Argv(1) : "polygon_fill_fan.bin";
+  uint64_t start, area;
+  uint32_t shape, i, diff = 0U, covered = 0U, inside = 0U;
+  double rate, reference_rate;
+  FILE *file;
+
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  UTIL_LCD_SetFuncDriver(&LCD_Driver);
+
+  /* The triangle fan writes pixel by pixel: small shapes keep its run short */
+  Test_MakeShape(0U, 200, 240, 6U, 90.0, 90.0);      /* Hexagon        */
+  Test_MakeShape(1U, 600, 240, 16U, 100.0, 45.0);    /* 8 branch star  */
+  Test_MakeShape(2U, 400, 240, 3U, 60.0, 60.0);      /* Triangle       */
+  Test_MakeShape(3U, 400, 120, 12U, 30.0, 30.0);     /* Small polygon  */
+
+  /* Fill rate of each shape on a cleared screen */
+  for(shape = 0U; shape < TEST_SHAPES; shape++)
+  {
+    HOST_CHECK(BSP_LCD_FillRect(0, 0, 0, TEST_WIDTH, TEST_HEIGHT, LCD_COLOR_ARGB8888_BLACK) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+
+    start = Host_GetCycles();
+    for(i = 0U; i < TEST_LOOPS; i++)
+    {
+      UTIL_LCD_FillPolygon(Test_Shapes[shape], Test_ShapePoints[shape], UTIL_LCD_COLOR_WHITE - i);
+    }
+    HOST_CHECK(BSP_LCD_DMA2D_Sync(0) == BSP_ERROR_NONE);
+    Test_Result.Cycles += Host_GetCycles() - start;
+
+    area = Test_Coverage(Test_Result.Mask);
+    HOST_CHECK(area > 0U);
+    Test_Result.Pixels += area * TEST_LOOPS;
+  }
+
+  rate = (double)Test_Result.Pixels / Host_Seconds(Test_Result.Cycles) / 1e6;
+  printf("BENCH polygon_fill.%s %.2f MPix/s\n", (POLYGON_FILL_REFERENCE != 0) ? "fan" : "scanline", rate);
+
+#if (POLYGON_FILL_REFERENCE != 0)
+  file = fopen(path, "wb");
+  HOST_CHECK(file != NULL);
+  if(file != NULL)
+  {
+    HOST_CHECK(fwrite(&Test_Result, sizeof(Test_Result), 1U, file) == 1U);
+    (void)fclose(file);
+  }
+#else
+  file = fopen(path, "rb");
+  HOST_CHECK(file != NULL);
+  if(file != NULL)
+  {
+    HOST_CHECK(fread(&Test_Reference, sizeof(Test_Reference), 1U, file) == 1U);
+    (void)fclose(file);
+
+    /* Same shapes: the pixels differ along the edges only */
+    for(i = 0U; i < (TEST_WIDTH * TEST_HEIGHT); i++)
+    {
+      covered += Test_Reference.Mask[i];
+      if(Test_Reference.Mask[i] != Test_Result.Mask[i])
+      {
+        diff++;
+        inside += (Test_OnEdge(Test_Reference.Mask, i) == 0U) ? 1U : 0U;
+      }
+    }
+    reference_rate = (double)Test_Reference.Pixels / Host_Seconds(Test_Reference.Cycles) / 1e6;
+    printf("Triangle fan: %.2f MPix/s, scanline: %.2f MPix/s, %u of %u pixels differ\n",
+           reference_rate, rate, (unsigned)diff, (unsigned)covered);
+    printf("BENCH polygon_fill.speedup %.2f x\n", rate / reference_rate);
+    HOST_CHECK(rate > (2.0 * reference_rate));
+    HOST_CHECK(inside == 0U);
+  }
+#endif /* POLYGON_FILL_REFERENCE */
+
+  return 0;
+}
@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file    test_rotation.c
+  * @brief   Software rotation of layer 0: BSP_LCD_RotationFlush() at 90, 180
+  *          and 270 degrees. Checks where each drawn pixel lands on the panel
+  *          and that only the dirty tiles are copied, and measures the
+  *          throughput. Built once per BSP_LCD_ROTATION_TILE size.
+  *          The copies are CPU work, which does not move the virtual clock:
+  *          the rates are host rates, against a pixel by pixel rotation of the
+  *          same frame with whole buffer cache maintenance. They include the
+  *          model time of each D-cache maintenance call, which the tiles make
+  *          per tile line. BSP_LCD_GetRotationStats() gives the rate on the
+  *          board.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_WIDTH                    800U
+#define TEST_HEIGHT                   480U
+#define TEST_LOOPS                    20U
+#define TEST_SCRATCH_ADDRESS          0xD0800000U
+
+/* Dirty area of the partial flush, in drawn buffer coordinates */
+#define TEST_AREA_X                   100U
+#define TEST_AREA_Y                   50U
+#define TEST_AREA_WIDTH               40U
+#define TEST_AREA_HEIGHT              30U
+
+/* Private variables ---------------------------------------------------------*/
+/* Panel selection of the driver: the WAVESHARE probe, run first when
+   auto-detecting, would take the ATTINY of the Raspberry Pi panel */
+extern LCD_Driver_t Lcd_Driver_Type;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Gives the panel position of a drawn pixel.
+  * @param  Rotation    LCD_ROTATION_90, LCD_ROTATION_180 or LCD_ROTATION_270
+  * @param  X           Drawn X
+  * @param  Y           Drawn Y
+  * @retval Panel pixel index
+  */
+static uint32_t Test_PanelIndex(uint32_t Rotation, uint32_t X, uint32_t Y)
+{
+  uint32_t px, py;
+
+  if(Rotation == LCD_ROTATION_90)
+  {
+    px = TEST_WIDTH - 1U - Y;
+    py = X;
+  }
+  else if(Rotation == LCD_ROTATION_180)
+  {
+    px = TEST_WIDTH - 1U - X;
+    py = TEST_HEIGHT - 1U - Y;
+  }
+  else
+  {
+    px = Y;
+    py = TEST_HEIGHT - 1U - X;
+  }
+
+  return (py * TEST_WIDTH) + px;
+}
+
+/**
+  * @brief  Rotates the drawn buffer pixel by pixel, in panel order, as a
+  *         copy without tiles does.
+  * @param  Rotation    LCD_ROTATION_90, LCD_ROTATION_180 or LCD_ROTATION_270
+  * @param  XSize       Drawn width
+  * @param  YSize       Drawn height
+  * @retval None
+  */
+static void Test_NaiveRotate(uint32_t Rotation, uint32_t XSize, uint32_t YSize)
+{
+  const uint32_t *src = (const uint32_t *)LCD_ROTATION_ADDRESS;
+  uint32_t *dst = (uint32_t *)TEST_SCRATCH_ADDRESS;
+  uint32_t x, y;
+
+  SCB_CleanInvalidateDCache_by_Addr((uint32_t *)LCD_ROTATION_ADDRESS, (int32_t)(XSize * YSize * 4U));
+  for(y = 0U; y < YSize; y++)
+  {
+    for(x = 0U; x < XSize; x++)
+    {
+      dst[Test_PanelIndex(Rotation, x, y)] = src[(y * XSize) + x];
+    }
+  }
+  SCB_CleanDCache_by_Addr((uint32_t *)TEST_SCRATCH_ADDRESS, (int32_t)(XSize * YSize * 4U));
+}
+
+/* Exported functions --------------------------------------------------------*/
+int Host_Test(void)
+{
+  static const uint32_t rotations[] = {LCD_ROTATION_90, LCD_ROTATION_180, LCD_ROTATION_270};
+  static const char *names[] = {"90", "180", "270"};
+  uint32_t *drawn = (uint32_t *)LCD_ROTATION_ADDRESS;
+  uint32_t *panel = (uint32_t *)LCD_LAYER_0_ADDRESS;
+  BSP_LCD_Rotation_Stats_t before, stats;
+  Host_CacheStats_t cache_start, cache_end;
+  uint32_t r, i, x, y, xsize, ysize, errors, outside, tiles;
+  double wall, rate, naive_rate;
+
+  Lcd_Driver_Type = LCD_CTRL_RASPBERRYPI;
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+
+  for(r = 0U; r < 3U; r++)
+  {
+    HOST_CHECK(BSP_LCD_SetRotation(0, rotations[r]) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_GetXSize(0, &xsize) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_GetYSize(0, &ysize) == BSP_ERROR_NONE);
+    HOST_CHECK((xsize * ysize) == (TEST_WIDTH * TEST_HEIGHT));
+
+    /* Each drawn pixel holds its position */
+    for(y = 0U; y < ysize; y++)
+    {
+      for(x = 0U; x < xsize; x++)
+      {
+        drawn[(y * xsize) + x] = 0xFF000000U | (x << 12) | y;
+      }
+    }
+    HOST_CHECK(BSP_LCD_RotationInvalidate(0, 0, 0, xsize, ysize) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_RotationFlush(0) == BSP_ERROR_NONE);
+
+    errors = 0U;
+    for(y = 0U; y < ysize; y++)
+    {
+      for(x = 0U; x < xsize; x++)
+      {
+        errors += (panel[Test_PanelIndex(rotations[r], x, y)] != (0xFF000000U | (x << 12) | y)) ? 1U : 0U;
+      }
+    }
+    HOST_CHECK(errors == 0U);
+
+    /* Only the tiles of a dirty area are copied */
+    memset(panel, 0, TEST_WIDTH * TEST_HEIGHT * 4U);
+    HOST_CHECK(BSP_LCD_GetRotationStats(0, &before) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_RotationInvalidate(0, TEST_AREA_X, TEST_AREA_Y, TEST_AREA_WIDTH, TEST_AREA_HEIGHT) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_RotationFlush(0) == BSP_ERROR_NONE);
+    HOST_CHECK(BSP_LCD_GetRotationStats(0, &stats) == BSP_ERROR_NONE);
+    stats.Tiles  -= before.Tiles;
+    stats.Pixels -= before.Pixels;
+    tiles = (((TEST_AREA_X + TEST_AREA_WIDTH - 1U) / BSP_LCD_ROTATION_TILE) - (TEST_AREA_X / BSP_LCD_ROTATION_TILE) + 1U) *
+            (((TEST_AREA_Y + TEST_AREA_HEIGHT - 1U) / BSP_LCD_ROTATION_TILE) - (TEST_AREA_Y / BSP_LCD_ROTATION_TILE) + 1U);
+    HOST_CHECK(stats.Tiles == tiles);
+    outside = 0U;
+    for(y = 0U; y < ysize; y++)
+    {
+      for(x = 0U; x < xsize; x++)
+      {
+        if(((x / BSP_LCD_ROTATION_TILE) < (TEST_AREA_X / BSP_LCD_ROTATION_TILE)) ||
+           ((x / BSP_LCD_ROTATION_TILE) > ((TEST_AREA_X + TEST_AREA_WIDTH - 1U) / BSP_LCD_ROTATION_TILE)) ||
+           ((y / BSP_LCD_ROTATION_TILE) < (TEST_AREA_Y / BSP_LCD_ROTATION_TILE)) ||
+           ((y / BSP_LCD_ROTATION_TILE) > ((TEST_AREA_Y + TEST_AREA_HEIGHT - 1U) / BSP_LCD_ROTATION_TILE)))
+        {
+          outside += (panel[Test_PanelIndex(rotations[r], x, y)] != 0U) ? 1U : 0U;
+        }
+      }
+    }
+    HOST_CHECK(outside == 0U);
+    printf("Rotation %s: %u x %u drawn, dirty area: %u tiles, %u pixels copied\n", names[r], (unsigned)xsize,
+           (unsigned)ysize, (unsigned)stats.Tiles, (unsigned)stats.Pixels);
+
+    /* Whole frame rates, tiled and pixel by pixel */
+    Host_GetCacheStats(&cache_start);
+    wall = Host_WallSeconds();
+    for(i = 0U; i < TEST_LOOPS; i++)
+    {
+      (void)BSP_LCD_RotationInvalidate(0, 0, 0, xsize, ysize);
+      (void)BSP_LCD_RotationFlush(0);
+    }
+    rate = ((double)TEST_LOOPS * (double)(xsize * ysize)) / (Host_WallSeconds() - wall) / 1e6;
+    Host_GetCacheStats(&cache_end);
+
+    wall = Host_WallSeconds();
+    for(i = 0U; i < TEST_LOOPS; i++)
+    {
+      Test_NaiveRotate(rotations[r], xsize, ysize);
+    }
+    naive_rate = ((double)TEST_LOOPS * (double)(xsize * ysize)) / (Host_WallSeconds() - wall) / 1e6;
+    HOST_CHECK(memcmp(panel, (const void *)TEST_SCRATCH_ADDRESS, TEST_WIDTH * TEST_HEIGHT * 4U) == 0);
+
+    printf("Whole frame: %u D-cache maintenance calls\n", (unsigned)((cache_end.Ops - cache_start.Ops) / TEST_LOOPS));
+    printf("BENCH rotation.%s.tile%u.host %.2f MPix/s\n", names[r], (unsigned)BSP_LCD_ROTATION_TILE, rate);
+    printf("BENCH rotation.%s.pixel.host %.2f MPix/s\n", names[r], naive_rate);
+  }
+
+  HOST_CHECK(BSP_LCD_SetRotation(0, LCD_ROTATION_0) == BSP_ERROR_NONE);
+
+  return 0;
+}
@@ -0,0 +1,180 @@
+/**
+  ******************************************************************************
+  * @file    test_ulpm_cmd_mode.c
+  * @brief   DSI ultra low power mode of an OTM8009A panel driven in adapted
+  *          command mode, with its tearing effect output running. The idle
+  *          loop calls BSP_LCD_Idle() every ms:
+  *          - the link enters ULPM BSP_LCD_ULPM_TIMEOUT ms after the last
+  *            draw, once it is sent, and no refresh is sent while in ULPM,
+  *          - a draw wakes the link and is sent at the next TE,
+  *          - a draw from an interrupt while in ULPM is sent once the next
+  *            BSP_LCD_Idle() call woke the link,
+  *          - a draw from an interrupt during the ULPM entry (TIM7, one pulse
+  *            in the 1 ms delay of HAL_DSI_EnterULPM()) wakes the link at the
+  *            end of the entry, so the area is not left unsent in ULPM.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_model.h"
+#include "stm32h747i_discovery_lcd.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_MS_CYCLES                (HOST_CPU_CLOCK / 1000U)
+#define TEST_TE_PERIODS_MS            40U      /* Two TE periods and the refresh */
+
+/* TIM7 one pulse: 2 us ticks, 250 ticks */
+#define TEST_TIM_PSC                  399U
+#define TEST_TIM_ARR                  250U
+
+/* Private variables ---------------------------------------------------------*/
+extern LCD_Driver_t Lcd_Driver_Type;
+
+static uint32_t Test_IrqDraws;
+static int32_t  Test_IrqStatus;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Runs the idle loop: 1 ms steps, each followed by a BSP_LCD_Idle()
+  *         call.
+  * @param  Ms      Duration
+  * @param  Stop    Stops at the ULPM entry if 1
+  * @retval Time run, in ms
+  */
+static uint32_t Test_IdleLoop(uint32_t Ms, uint32_t Stop)
+{
+  uint32_t ms;
+
+  for(ms = 0U; (ms < Ms) && ((Stop == 0U) || (Host_DsiInUlpm() == 0U)); ms++)
+  {
+    Host_Run(TEST_MS_CYCLES);
+    (void)BSP_LCD_Idle(0);
+  }
+
+  return ms;
+}
+
+/**
+  * @brief  Gets the refreshes sent by the DSI host.
+  * @retval Refreshes
+  */
+static uint32_t Test_Refreshes(void)
+{
+  Host_DsiStats_t stats;
+
+  Host_DsiGetStats(&stats);
+
+  return stats.Refreshes;
+}
+
+/**
+  * @brief  Starts the TIM7 one pulse whose interrupt draws an area.
+  * @retval None
+  */
+static void Test_ArmDraw(void)
+{
+  TIM7->CR1  = TIM_CR1_OPM | TIM_CR1_URS;
+  TIM7->PSC  = TEST_TIM_PSC;
+  TIM7->ARR  = TEST_TIM_ARR;
+  TIM7->SR   = 0U;
+  TIM7->DIER = TIM_DIER_UIE;
+  TIM7->CNT  = 0U;
+  HAL_NVIC_EnableIRQ(TIM7_IRQn);
+  TIM7->CR1 |= TIM_CR1_CEN;
+}
+
+/* Exported functions --------------------------------------------------------*/
+/**
+  * @brief  TIM7 interrupt: a draw from an interrupt handler.
+  * @retval None
+  */
+void TIM7_IRQHandler(void)
+{
+  TIM7->SR = 0U;
+  Test_IrqStatus = BSP_LCD_Invalidate(0, 0, 0, 100, 100);
+  Test_IrqDraws++;
+}
+
+int Host_Test(void)
+{
+  BSP_LCD_Ulpm_Stats_t ulpm;
+  Host_DsiStats_t dsi;
+  uint32_t refreshes, entries;
+  uint64_t start;
+  double ms;
+
+  Host_BoardSetPanel(HOST_PANEL_OTM8009A);
+  Lcd_Driver_Type = LCD_CTRL_OTM8009A;
+  HOST_CHECK(BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE) == BSP_ERROR_NONE);
+  Host_DsiSetTearingEffect(1U);
+
+  /* Idle timeout after the first frame */
+  start = Host_GetCycles();
+  HOST_CHECK(BSP_LCD_FillRect(0, 0, 0, 800, 480, 0xFF0000FFU) == BSP_ERROR_NONE);
+  (void)Test_IdleLoop(TEST_TE_PERIODS_MS, 0U);
+  refreshes = Test_Refreshes();
+  HOST_CHECK(refreshes > 0U);
+  HOST_CHECK(Host_DsiInUlpm() == 0U);
+  (void)Test_IdleLoop(2U * BSP_LCD_ULPM_TIMEOUT, 1U);
+  ms = Host_Seconds(Host_GetCycles() - start) * 1e3;
+  HOST_CHECK(Host_DsiInUlpm() == 1U);
+  HOST_CHECK((ms >= (double)BSP_LCD_ULPM_TIMEOUT) && (ms < (double)(BSP_LCD_ULPM_TIMEOUT + 5U)));
+  printf("ULPM entered %.1f ms after the draw\n", ms);
+
+  /* Nothing sent in ULPM */
+  (void)Test_IdleLoop(TEST_TE_PERIODS_MS, 0U);
+  HOST_CHECK(Host_DsiInUlpm() == 1U);
+  HOST_CHECK(Test_Refreshes() == refreshes);
+
+  /* Draw from the application: woken at once, sent at the next TE */
+  HOST_CHECK(BSP_LCD_FillRect(0, 10, 10, 50, 50, 0xFFFF0000U) == BSP_ERROR_NONE);
+  HOST_CHECK(Host_DsiInUlpm() == 0U);
+  (void)Test_IdleLoop(TEST_TE_PERIODS_MS, 0U);
+  HOST_CHECK(Test_Refreshes() == (refreshes + 1U));
+  refreshes = Test_Refreshes();
+  HOST_CHECK(BSP_LCD_GetUlpmStats(0, &ulpm) == BSP_ERROR_NONE);
+  printf("Wake latency %u us\n", (unsigned)ulpm.LastWake);
+  printf("BENCH ulpm.cmd_mode.wake_latency %u us\n", (unsigned)ulpm.LastWake);
+
+  /* Draw from an interrupt in ULPM: deferred to the next BSP_LCD_Idle() */
+  (void)Test_IdleLoop(2U * BSP_LCD_ULPM_TIMEOUT, 1U);
+  HOST_CHECK(Host_DsiInUlpm() == 1U);
+  Test_IrqDraws = 0U;
+  Test_ArmDraw();
+  Host_Run(TEST_MS_CYCLES);
+  HOST_CHECK(Test_IrqDraws == 1U);
+  HOST_CHECK(Test_IrqStatus == BSP_ERROR_NONE);
+  HOST_CHECK(Host_DsiInUlpm() == 1U);
+  (void)Test_IdleLoop(TEST_TE_PERIODS_MS, 0U);
+  HOST_CHECK(Host_DsiInUlpm() == 0U);
+  HOST_CHECK(Test_Refreshes() == (refreshes + 1U));
+  refreshes = Test_Refreshes();
+
+  /* Draw from an interrupt during the ULPM entry: woken at its end */
+  Host_Run((uint64_t)(BSP_LCD_ULPM_TIMEOUT + 1U) * TEST_MS_CYCLES);
+  HOST_CHECK(BSP_LCD_GetUlpmStats(0, &ulpm) == BSP_ERROR_NONE);
+  entries = ulpm.Entries;
+  Test_IrqDraws = 0U;
+  Test_ArmDraw();
+  (void)BSP_LCD_Idle(0);
+  HOST_CHECK(Test_IrqDraws == 1U);
+  HOST_CHECK(BSP_LCD_GetUlpmStats(0, &ulpm) == BSP_ERROR_NONE);
+  HOST_CHECK(ulpm.Entries == (entries + 1U));
+  HOST_CHECK(ulpm.Exits == ulpm.Entries);
+  HOST_CHECK(Host_DsiInUlpm() == 0U);
+  (void)Test_IdleLoop(TEST_TE_PERIODS_MS, 0U);
+  HOST_CHECK(Host_DsiInUlpm() == 0U);
+  HOST_CHECK(Test_Refreshes() == (refreshes + 1U));
+
+  Host_DsiGetStats(&dsi);
+  HOST_CHECK(BSP_LCD_GetUlpmStats(0, &ulpm) == BSP_ERROR_NONE);
+  HOST_CHECK(dsi.UlpmEntries == ulpm.Entries);
+  HOST_CHECK(dsi.UlpmExits == ulpm.Exits);
+  printf("%u ULPM entries, %u exits, %u errors, %.1f ms in ULPM, max wake %u us, %u refreshes\n",
+         (unsigned)ulpm.Entries, (unsigned)ulpm.Exits, (unsigned)ulpm.Errors, Host_Seconds(dsi.UlpmCycles) * 1e3,
+         (unsigned)ulpm.MaxWake, (unsigned)dsi.Refreshes);
+  HOST_CHECK(ulpm.Errors == 0U);
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Converts an ARGB8888 image C header to an RGB565 C header.
+
+The 8-bit channels are reduced to 5 (red, blue) and 6 (green) bits with a
+4x4 ordered (Bayer) dither, which keeps the gradients of the photos free of
+banding without the noise of error diffusion and gives the same result for
+each build. The DMA2D copies the RGB565 pixels as they are to an RGB565
+layer, at half the memory and bandwidth of ARGB8888. Tools/lcd_assets.py
+uses the same dither for the RGB565 assets of a pack.
+
+Usage:
+  python3 Tools/img2rgb565.py IMAGE_argb8888.h IMAGE_rgb565.h --width WIDTH
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# 4x4 Bayer matrix, thresholds 0..15
+BAYER_4X4 = (
+    (0, 8, 2, 10),
+    (12, 4, 14, 6),
+    (3, 11, 1, 9),
+    (15, 7, 13, 5),
+)
+
+
+def quantize(value, levels, threshold):
+    """Reduces an 8-bit channel to levels values, offset by a threshold of
+    (threshold + 0.5) / 16 of a step so that the dither averages to the
+    rounded value."""
+    return (value * (levels - 1) * 32 + (2 * threshold + 1) * 255) // (255 * 32)
+
+
+def dither_rgb565(pixels, width):
+    """Converts a list of ARGB8888 pixels, width pixels per line, to RGB565."""
+    out = []
+    for index, argb in enumerate(pixels):
+        threshold = BAYER_4X4[(index // width) % 4][(index % width) % 4]
+        red = quantize((argb >> 16) & 0xFF, 32, threshold)
+        green = quantize((argb >> 8) & 0xFF, 64, threshold)
+        blue = quantize(argb & 0xFF, 32, threshold)
+        out.append((red << 11) | (green << 5) | blue)
+    return out
+
+
+def read_argb8888_header(path):
+    """Returns the pixels of the first array initializer of a C header."""
+    with open(path, "r", encoding="ascii") as header:
+        text = header.read()
+    start = text.index("=")
+    body = text[text.index("{", start) + 1:text.index("}", start)]
+    return [int(word, 16) for word in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+
+def write_rgb565_header(path, pixels, width):
+    """Writes the pixels as a const uint16_t array, in the layout of the
+    ARGB8888 headers of the example."""
+    base = os.path.basename(path)
+    name = os.path.splitext(base)[0]
+    guard = "__" + name.upper() + "_H"
+    height = len(pixels) // width
+
+    lines = [
+        "/**",
+        "  " + "*" * 78,
+        "  * @file    LCD_DSI/LCD_DSI_VideoMode_SingleBuffer/CM7/Inc/" + base,
+        "  * @author  MCD Application Team",
+        "  * @brief   This file contains RGB565 image %ux%u, ordered dithered." % (width, height),
+        "  *          Generated by Tools/img2rgb565.py, do not edit.",
+        "  " + "*" * 78,
+        "  * @attention",
+        "  *",
+        "  * Copyright (c) 2019 STMicroelectronics.",
+        "  * All rights reserved.",
+        "  *",
+        "  * This software is licensed under terms that can be found in the LICENSE file",
+        "  * in the root directory of this software component.",
+        "  * If no LICENSE file comes with this software, it is provided AS-IS.",
+        "  *",
+        "  " + "*" * 78,
+        "  */",
+        "",
+        "/* Define to prevent recursive inclusion -------------------------------------*/",
+        "#ifndef " + guard,
+        "#define " + guard,
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "/* Includes ------------------------------------------------------------------*/",
+        "/* Exported types ------------------------------------------------------------*/",
+        "/* Exported constants --------------------------------------------------------*/",
+        "/* Exported macro ------------------------------------------------------------*/",
+        "/* Exported functions ------------------------------------------------------- */",
+        "",
+        "const uint16_t %s[%u] =" % (name, len(pixels)),
+        "{",
+    ]
+    lines.append(",\n".join("0x%04X" % pixel for pixel in pixels) + "};")
+    lines += [
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+        "#endif /* %s */" % guard,
+        "",
+    ]
+    with open(path, "w", encoding="ascii", newline="\n") as header:
+        header.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="ARGB8888 image C header")
+    parser.add_argument("output", help="RGB565 image C header to write")
+    parser.add_argument("--width", type=int, required=True, help="image width in pixels")
+    args = parser.parse_args()
+
+    pixels = read_argb8888_header(args.input)
+    if (args.width <= 0) or ((len(pixels) % args.width) != 0):
+        sys.exit("%s: %u pixels are not lines of %d pixels" % (args.input, len(pixels), args.width))
+
+    write_rgb565_header(args.output, dither_rgb565(pixels, args.width), args.width)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,417 @@
+#!/usr/bin/env python3
+"""Converts PNG images to an LCD asset pack read by BSP_LCD_AssetFind().
+
+Each asset is stored in its own pixel format (ARGB8888, RGB565, L8 or A8),
+with its lines padded to the stride given by --line-align and its pixels
+starting on a 32-byte boundary, so that the DMA2D reads them in bursts and
+an uncompressed asset is drawn where it is stored. Assets may be RLE or LZ4
+compressed, they are then decoded to RAM by BSP_LCD_AssetLoad().
+
+  ARGB8888  the PNG pixels, alpha included
+  RGB565    the PNG pixels reduced with the 4x4 ordered (Bayer) dither of
+            Tools/img2rgb565.py
+  L8        the indexes of a palette PNG, or of a PNG of at most 256 colors,
+            followed by their ARGB8888 CLUT. A gray PNG gives a gray CLUT.
+  A8        the PNG alpha, or its luminance when the PNG has no alpha
+
+Pack layout (little endian), see BSP_LCD_AssetDir_t and BSP_LCD_AssetEntry_t:
+  directory  Magic "LCDA", Version, Count, Size, Reserved      (16 bytes)
+  entries    Count entries sorted by Id                        (32 bytes each)
+  data       CLUTs and pixels, each on a 32-byte boundary
+
+Usage:
+  python3 Tools/lcd_assets.py --header CM7/Inc/assets_rgb565.h \\
+          CM7/Assets/image_320x240.png:rgb565 CM7/Assets/life_augmented.png:rgb565:lz4
+
+  An asset is given as FILE.png:FORMAT[:COMPRESSION], FORMAT being argb8888,
+  rgb565, l8 or a8 and COMPRESSION none (default), rle or lz4. Its Id is its
+  position on the command line, defined as ASSET_<FILE> in the headers.
+  --header writes the Ids and the pack as a C array for the internal flash,
+  --bin the pack alone (QSPI flash, SD card) and --ids the Ids alone.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+from img2rgb565 import dither_rgb565
+
+PACK_MAGIC = b"LCDA"
+PACK_VERSION = 1
+PACK_ALIGN = 32
+DIR_SIZE = 16
+ENTRY_SIZE = 32
+
+# Pixel formats, same values as DMA2D_INPUT_xxx
+FORMATS = {"argb8888": (0, 4), "rgb565": (2, 2), "l8": (5, 1), "a8": (9, 1)}
+COMPRESSIONS = {"none": 0, "rle": 1, "lz4": 2}
+FLAG_OPAQUE = 0x0001
+
+class Image:
+    """Decoded PNG: ARGB8888 pixels, and the palette indexes of a palette PNG."""
+
+    def __init__(self, width, height, pixels, indexes=None, palette=None, gray=False, alpha=False):
+        self.width = width
+        self.height = height
+        self.pixels = pixels
+        self.indexes = indexes
+        self.palette = palette
+        self.gray = gray
+        self.alpha = alpha
+
+
+def png_read(path):
+    """Decodes a non interlaced PNG of any color type and bit depth."""
+    with open(path, "rb") as png:
+        data = png.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG file" % path)
+
+    pos, idat, plte, trns = 8, b"", b"", b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            plte = body
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+        pos += 12 + length
+    if interlace != 0:
+        raise ValueError("%s: interlaced PNG are not supported" % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bits = channels * depth
+    pixel_bytes = max(1, bits // 8)
+    line_bytes = (width * bits + 7) // 8
+    raw = zlib.decompress(idat)
+
+    # Reverse the line filters
+    lines, prev = [], bytearray(line_bytes)
+    for y in range(height):
+        start = y * (line_bytes + 1)
+        ftype = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + line_bytes])
+        for i in range(line_bytes):
+            left = line[i - pixel_bytes] if i >= pixel_bytes else 0
+            up = prev[i]
+            upleft = prev[i - pixel_bytes] if i >= pixel_bytes else 0
+            if ftype == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = left + up - upleft
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - upleft)
+                pred = left if (pa <= pb and pa <= pc) else (up if pb <= pc else upleft)
+                line[i] = (line[i] + pred) & 0xFF
+        lines.append(line)
+        prev = line
+
+    def samples(line):
+        """Samples of a line, 16-bit samples reduced to their high byte."""
+        if depth == 8:
+            return list(line)
+        if depth == 16:
+            return list(line[0::2])
+        out = []
+        for byte in line:
+            for shift in range(8 - depth, -1, -depth):
+                out.append((byte >> shift) & ((1 << depth) - 1))
+        return out
+
+    scale = 255 // ((1 << depth) - 1) if depth < 8 else 1
+    pixels, indexes, palette = [], None, None
+    if ctype == 3:
+        palette = []
+        for i in range(len(plte) // 3):
+            alpha = trns[i] if i < len(trns) else 0xFF
+            palette.append((alpha << 24) | (plte[3 * i] << 16) | (plte[3 * i + 1] << 8) | plte[3 * i + 2])
+        indexes = []
+    for line in lines:
+        values = samples(line)
+        for x in range(width):
+            if ctype == 3:
+                index = values[x]
+                indexes.append(index)
+                pixels.append(palette[index])
+            elif ctype in (0, 4):
+                level = values[x * channels] * scale
+                alpha = values[x * channels + 1] if ctype == 4 else 0xFF
+                if (ctype == 0) and (len(trns) >= 2) and (values[x] == struct.unpack(">H", trns[:2])[0]):
+                    alpha = 0
+                pixels.append((alpha << 24) | (level * 0x010101))
+            else:
+                red, green, blue = values[x * channels:x * channels + 3]
+                alpha = values[x * channels + 3] if ctype == 6 else 0xFF
+                pixels.append((alpha << 24) | (red << 16) | (green << 8) | blue)
+
+    has_alpha = (ctype in (4, 6)) or (len(trns) != 0)
+    return Image(width, height, pixels, indexes, palette, ctype in (0, 4), has_alpha)
+
+
+def luminance(argb):
+    """BT.601 luma of an ARGB8888 color, as LCD_ColorToRaw() computes it."""
+    return (((argb >> 16) & 0xFF) * 77 + ((argb >> 8) & 0xFF) * 150 + (argb & 0xFF) * 29) >> 8
+
+
+def convert(image, fmt):
+    """Returns the pixel lines, each a bytes object, the CLUT and the flags."""
+    width, clut, flags = image.width, [], 0
+    lines = []
+    if fmt == "argb8888":
+        flags = FLAG_OPAQUE if all((p >> 24) == 0xFF for p in image.pixels) else 0
+        for y in range(image.height):
+            lines.append(struct.pack("<%uI" % width, *image.pixels[y * width:(y + 1) * width]))
+    elif fmt == "rgb565":
+        flags = FLAG_OPAQUE
+        pixels = dither_rgb565(image.pixels, width)
+        for y in range(image.height):
+            lines.append(struct.pack("<%uH" % width, *pixels[y * width:(y + 1) * width]))
+    elif fmt == "l8":
+        if image.indexes is not None:
+            indexes, clut = image.indexes, image.palette
+        elif image.gray and not image.alpha:
+            indexes, clut = [luminance(p) for p in image.pixels], [0xFF000000 | (i * 0x010101) for i in range(256)]
+        else:
+            colors = sorted(set(image.pixels))
+            if len(colors) > 256:
+                raise ValueError("%u colors, an L8 asset takes a palette PNG or at most 256 colors" % len(colors))
+            lookup = {color: i for i, color in enumerate(colors)}
+            indexes, clut = [lookup[p] for p in image.pixels], colors
+        flags = FLAG_OPAQUE if all((clut[i] >> 24) == 0xFF for i in set(indexes)) else 0
+        for y in range(image.height):
+            lines.append(bytes(indexes[y * width:(y + 1) * width]))
+    else:
+        for y in range(image.height):
+            line = image.pixels[y * width:(y + 1) * width]
+            lines.append(bytes((p >> 24) if image.alpha else luminance(p) for p in line))
+    return lines, clut, flags
+
+
+def rle_compress(data, unit):
+    """Run length encoding by pixels of unit bytes. A control byte C below 128
+    is followed by C + 1 literal pixels, else by one pixel repeated C - 126
+    times (2 to 129)."""
+    pixels = [data[i:i + unit] for i in range(0, len(data), unit)]
+    out, i, literals = bytearray(), 0, []
+
+    def flush():
+        for start in range(0, len(literals), 128):
+            chunk = literals[start:start + 128]
+            out.append(len(chunk) - 1)
+            out.extend(b"".join(chunk))
+        del literals[:]
+
+    while i < len(pixels):
+        run = 1
+        while (i + run < len(pixels)) and (run < 129) and (pixels[i + run] == pixels[i]):
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(run + 126)
+            out.extend(pixels[i])
+            i += run
+        else:
+            literals.append(pixels[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def lz4_compress(data):
+    """LZ4 block format (no frame), greedy matches of 4 bytes or more. The last
+    match starts 12 bytes or more before the end, the last 5 bytes are
+    literals, as required by the LZ4 decoders."""
+    size, out, table = len(data), bytearray(), {}
+    anchor, i = 0, 0
+
+    def length(value):
+        while value >= 255:
+            out.append(255)
+            value -= 255
+        out.append(value)
+
+    while i + 12 <= size:
+        key = data[i:i + 4]
+        candidate = table.get(key)
+        table[key] = i
+        if (candidate is None) or (i - candidate > 0xFFFF):
+            i += 1
+            continue
+        match, limit = 4, size - 5 - i
+        while (match < limit) and (data[candidate + match] == data[i + match]):
+            match += 1
+        literals = i - anchor
+        out.append((min(literals, 15) << 4) | min(match - 4, 15))
+        if literals >= 15:
+            length(literals - 15)
+        out.extend(data[anchor:i])
+        out.extend(struct.pack("<H", i - candidate))
+        if match - 4 >= 15:
+            length(match - 4 - 15)
+        i += match
+        anchor = i
+
+    literals = size - anchor
+    out.append(min(literals, 15) << 4)
+    if literals >= 15:
+        length(literals - 15)
+    out.extend(data[anchor:])
+    return bytes(out)
+
+
+def align(value, boundary):
+    return (value + boundary - 1) // boundary * boundary
+
+
+def build_pack(assets, line_align):
+    """Returns the pack bytes and the asset names, in Id order."""
+    entries, blobs, names = [], [], []
+    offset = align(DIR_SIZE + ENTRY_SIZE * len(assets), PACK_ALIGN)
+
+    for asset_id, (path, fmt, compression) in enumerate(assets):
+        image = png_read(path)
+        code, bpp = FORMATS[fmt]
+        lines, clut, flags = convert(image, fmt)
+
+        # Stride in bytes, a multiple of the pixel size and of line_align
+        step = bpp * line_align // gcd(bpp, line_align)
+        stride = align(image.width * bpp, step)
+        pixels = b"".join(line + bytes(stride - len(line)) for line in lines)
+
+        if compression == "rle":
+            stored = rle_compress(pixels, bpp)
+        elif compression == "lz4":
+            stored = lz4_compress(pixels)
+        else:
+            stored = pixels
+
+        clut_offset = 0
+        if clut:
+            clut_offset = offset
+            blobs.append((offset, struct.pack("<%uI" % len(clut), *clut)))
+            offset = align(offset + 4 * len(clut), PACK_ALIGN)
+        blobs.append((offset, stored))
+        entries.append(struct.pack("<IIIHHIBBHIHH", asset_id, offset, len(stored), image.width, image.height,
+                                   stride, code, COMPRESSIONS[compression], flags, clut_offset, len(clut), 0))
+        offset = align(offset + len(stored), PACK_ALIGN)
+        names.append(re.sub(r"[^0-9A-Za-z]", "_", os.path.splitext(os.path.basename(path))[0]).upper())
+
+        ratio = 100 * len(stored) // len(pixels)
+        print("%-32s %4ux%-4u %-8s %-4s %7u bytes (%u%%)" % (os.path.basename(path), image.width, image.height,
+                                                             fmt, compression, len(stored), ratio))
+
+    pack = bytearray(offset)
+    pack[0:DIR_SIZE] = struct.pack("<4sHHII", PACK_MAGIC, PACK_VERSION, len(assets), offset, 0)
+    for index, entry in enumerate(entries):
+        pack[DIR_SIZE + ENTRY_SIZE * index:DIR_SIZE + ENTRY_SIZE * (index + 1)] = entry
+    for start, blob in blobs:
+        pack[start:start + len(blob)] = blob
+    return bytes(pack), names
+
+
+def gcd(a, b):
+    while b:
+        a, b = b, a % b
+    return a
+
+
+def write_header(path, pack, names, with_data):
+    """Writes the asset Ids and, with_data, the pack as a 32-byte aligned
+    uint32_t array named after the header."""
+    base = os.path.basename(path)
+    name = os.path.splitext(base)[0]
+    guard = "__" + re.sub(r"[^0-9A-Za-z]", "_", name).upper() + "_H"
+    lines = [
+        "/**",
+        "  " + "*" * 78,
+        "  * @file    " + base,
+        "  * @brief   LCD asset pack%s, %u bytes." % ("" if with_data else " Ids", len(pack)),
+        "  *          Generated by Tools/lcd_assets.py, do not edit.",
+        "  " + "*" * 78,
+        "  */",
+        "",
+        "/* Define to prevent recursive inclusion -------------------------------------*/",
+        "#ifndef " + guard,
+        "#define " + guard,
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "/* Exported constants --------------------------------------------------------*/",
+    ]
+    for asset_id, asset_name in enumerate(names):
+        lines.append("#define %-40s %uU" % ("ASSET_" + asset_name, asset_id))
+    lines.append("")
+    if with_data:
+        words = struct.unpack("<%uI" % (len(pack) // 4), pack)
+        lines.append("ALIGN_32BYTES(const uint32_t %s[%u]) =" % (name, len(words)))
+        lines.append("{")
+        rows = [", ".join("0x%08X" % w for w in words[i:i + 8]) for i in range(0, len(words), 8)]
+        lines.append(",\n".join(rows))
+        lines.append("};")
+        lines.append("")
+    lines += [
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+        "#endif /* %s */" % guard,
+        "",
+    ]
+    with open(path, "w", encoding="ascii", newline="\n") as header:
+        header.write("\n".join(lines))
+
+
+def parse_asset(text):
+    """FILE.png:FORMAT[:COMPRESSION] to (FILE.png, FORMAT, COMPRESSION)."""
+    parts = text.split(":")
+    compression = "none"
+    if parts[-1].lower() in COMPRESSIONS:
+        compression = parts.pop().lower()
+    if (len(parts) < 2) or (parts[-1].lower() not in FORMATS):
+        raise argparse.ArgumentTypeError("%s: expected FILE.png:FORMAT[:COMPRESSION]" % text)
+    return ":".join(parts[:-1]), parts[-1].lower(), compression
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("assets", nargs="+", type=parse_asset, help="FILE.png:FORMAT[:COMPRESSION]")
+    parser.add_argument("--header", help="C header of the asset Ids and the pack array")
+    parser.add_argument("--ids", help="C header of the asset Ids only")
+    parser.add_argument("--bin", help="binary pack")
+    parser.add_argument("--line-align", type=int, default=4, help="line alignment in bytes (default 4)")
+    args = parser.parse_args()
+
+    if args.line_align <= 0:
+        sys.exit("--line-align must be positive")
+    try:
+        pack, names = build_pack(args.assets, args.line_align)
+    except (OSError, ValueError, zlib.error) as error:
+        sys.exit(str(error))
+
+    if args.header:
+        write_header(args.header, pack, names, True)
+    if args.ids:
+        write_header(args.ids, pack, names, False)
+    if args.bin:
+        with open(args.bin, "wb") as binary:
+            binary.write(pack)
+    print("%u assets, %u bytes" % (len(names), len(pack)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
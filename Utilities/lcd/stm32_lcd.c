@@ -37,6 +37,7 @@
      API to link board LCD drivers to BASIC GUI LCD drivers.
      User can then call the BASIC GUI services:
          UTIL_LCD_SetFuncDriver()
+         UTIL_LCD_SetExtFuncDriver()
          UTIL_LCD_SetLayer()
          UTIL_LCD_SetDevice()
          UTIL_LCD_SetTextColor()
@@ -64,7 +65,47 @@
          UTIL_LCD_DrawEllipse()
          UTIL_LCD_FillCircle()
          UTIL_LCD_FillPolygon()
+         UTIL_LCD_FillPolygonEx()
          UTIL_LCD_FillEllipse()
+         UTIL_LCD_SetDirtyTracking()
+         UTIL_LCD_AddDirtyRect()
+         UTIL_LCD_GetDirtyRects()
+         UTIL_LCD_FlushDirtyRects()
+
+   - Damaged rectangles tracking:
+     Once enabled with UTIL_LCD_SetDirtyTracking(1), the area written by every
+     drawing service of the current layer is recorded. Overlapping rectangles and
+     rectangles sharing an edge are merged (not those touching by a corner only),
+     and when the UTIL_LCD_DIRTY_RECTS_NBR entries are used the new rectangle is
+     merged with the one growing the least.
+     Areas written without the utility (direct DMA2D copies ...) are recorded by
+     calling UTIL_LCD_AddDirtyRect().
+     UTIL_LCD_FlushDirtyRects() calls the given function for each rectangle, to copy
+     it to the display or to the back buffer, then clears the list.
+
+   - Optional board services:
+     UTIL_LCD_SetExtFuncDriver() links the board services that are not part of the
+     LCD component interface (DrawAlpha, GetFrameBuffer and Invalidate). Without
+     them, the text and the shapes are drawn with the component services only.
+
+   - Text rendering:
+     When the board driver provides the DrawAlpha service, the glyphs of the current
+     font are expanded once to A8 coverage in a glyph cache of UTIL_LCD_GLYPH_CACHE_SIZE
+     bytes. A string is assembled from the cached glyphs in a coverage line buffer of
+     UTIL_LCD_TEXT_BUFFER_SIZE bytes and drawn with a single DMA2D blending in the text
+     color. A background color with a null alpha leaves the background unchanged
+     (without DrawAlpha, it is written as any other color).
+     Both buffers are placed in the UTIL_LCD_GLYPH_SECTION linker section, which must
+     be readable by the DMA2D. The DrawAlpha service cleans the text buffer from the
+     D-cache before the transfer.
+
+   - Raster backend:
+     When the board driver provides the GetFrameBuffer service, lines, circles,
+     ellipses and polygons are rasterized to horizontal runs, batched by
+     UTIL_LCD_RASTER_RUNS_NBR and written directly in the frame buffer by a copy
+     loop specialized for each pixel format. Runs of UTIL_LCD_RASTER_DMA2D_LENGTH
+     pixels or more are filled by the driver DrawHLine service instead. The area
+     written by the CPU is reported to the driver Invalidate service, if any.
 ------------------------------------------------------------------------------*/
 
 /* Includes ------------------------------------------------------------------*/
@@ -95,12 +136,59 @@
   #define UTIL_LCD_MAX_LAYERS_NBR    2U
 #endif
 
+#ifndef UTIL_LCD_DIRTY_RECTS_NBR
+  #define UTIL_LCD_DIRTY_RECTS_NBR   8U
+#endif
+
+/* Default cache size holds all the Font24 glyphs */
+#ifndef UTIL_LCD_GLYPH_CACHE_SIZE
+  #define UTIL_LCD_GLYPH_CACHE_SIZE  (95U * 17U * 24U)
+#endif
+
+/* Default text buffer size holds a 800 pixels wide line of Font24 */
+#ifndef UTIL_LCD_TEXT_BUFFER_SIZE
+  #define UTIL_LCD_TEXT_BUFFER_SIZE  (800U * 24U)
+#endif
+
+#ifndef UTIL_LCD_POLY_EDGES_NBR
+  #define UTIL_LCD_POLY_EDGES_NBR    64U
+#endif
+
+#ifndef UTIL_LCD_RASTER_RUNS_NBR
+  #define UTIL_LCD_RASTER_RUNS_NBR      64U
+#endif
+
+#ifndef UTIL_LCD_RASTER_DMA2D_LENGTH
+  #define UTIL_LCD_RASTER_DMA2D_LENGTH  64U
+#endif
+
+#ifndef UTIL_LCD_GLYPH_SECTION
+  #define UTIL_LCD_GLYPH_SECTION     ".RAM_D1"
+#endif
+
 /** @defgroup UTIL_LCD_Private_Macros STM32 LCD Utility Private Macros
   * @{
   */
 #define ABS(X)                 ((X) > 0 ? (X) : -(X))
 #define POLY_X(Z)              ((int32_t)((Points + (Z))->X))
 #define POLY_Y(Z)              ((int32_t)((Points + (Z))->Y))
+#define MIN(A, B)              ((A) < (B) ? (A) : (B))
+#define MAX(A, B)              ((A) > (B) ? (A) : (B))
+
+/* First pixel whose center is right of or on the edge */
+#define POLY_EDGE_PIXEL(E)     ((E)->X + (((2 * (E)->Rem) > (E)->Den) ? 1 : 0))
+/* Edge A is left of edge B */
+#define POLY_EDGE_LESS(A, B)   (((A)->X < (B)->X) || (((A)->X == (B)->X) && \
+                                (((int64_t)(A)->Rem * (B)->Den) < ((int64_t)(B)->Rem * (A)->Den))))
+
+#if defined ( __GNUC__ ) || defined ( __CC_ARM )
+#define GLYPH_BUFFER(Buffer)   Buffer __attribute__((section(UTIL_LCD_GLYPH_SECTION), aligned(32)))
+#else
+#define GLYPH_BUFFER(Buffer)   Buffer
+#endif
+
+#define GLYPHS_NBR             95U          /* ' ' to '~' */
+#define GLYPH_NOT_CACHED       0xFFFFFFFFU
 
 #define CONVERTARGB88882RGB565(Color)((((Color & 0xFFU) >> 3) & 0x1FU) |\
                                      (((((Color & 0xFF00U) >> 8) >>2) & 0x3FU) << 5) |\
@@ -127,6 +215,48 @@ typedef struct
   uint32_t y3;
 }Triangle_Positions_t;
 
+typedef struct
+{
+  UTIL_LCD_Rect_t Rects[UTIL_LCD_DIRTY_RECTS_NBR];
+  uint32_t        Count;
+  uint32_t        State;
+}Dirty_Rects_t;
+
+typedef struct
+{
+  int32_t X;        /* X at the current scanline center, integer part      */
+  int32_t Rem;      /* X at the current scanline center, in 1/Den units    */
+  int32_t Den;      /* Twice the edge height                               */
+  int32_t XStep;    /* X increment per scanline, integer part              */
+  int32_t RemStep;  /* X increment per scanline, in 1/Den units            */
+  int32_t YFirst;   /* First scanline crossing the edge                    */
+  int32_t YLast;    /* Last scanline crossing the edge                     */
+  int32_t Dir;      /* 1 for a downward edge, -1 for an upward one         */
+}Poly_Edge_t;
+
+typedef struct
+{
+  int16_t  X;
+  int16_t  Y;
+  uint16_t Length;
+}Raster_Run_t;
+
+typedef struct
+{
+  uint32_t     Address;                         /* Frame buffer of the drawn layer   */
+  uint32_t     Color;                           /* Color in the layer pixel format   */
+  uint32_t     Count;                           /* Number of batched runs            */
+  int32_t      XMin, YMin, XMax, YMax;          /* Area written since RasterBegin()  */
+  Raster_Run_t Runs[UTIL_LCD_RASTER_RUNS_NBR];
+}Raster_t;
+
+typedef struct
+{
+  const sFONT *pFont;               /* Font of the cached glyphs           */
+  uint32_t     Used;                /* Bytes used in the glyph data        */
+  uint32_t     Offset[GLYPHS_NBR];  /* Offset of each glyph in the data    */
+}Glyph_Cache_t;
+
 /**
   * @}
   */
@@ -140,6 +270,30 @@ typedef struct
   */
 static UTIL_LCD_Ctx_t DrawProp[UTIL_LCD_MAX_LAYERS_NBR];
 static LCD_UTILS_Drv_t FuncDriver;
+static UTIL_LCD_ExtDrv_t ExtFuncDriver;
+
+/**
+  * @brief  Damaged rectangles of each layer
+  */
+static Dirty_Rects_t DirtyRects[UTIL_LCD_MAX_LAYERS_NBR];
+
+/**
+  * @brief  Batched runs of the raster backend
+  */
+static Raster_t Raster;
+
+/**
+  * @brief  Polygon edge table and active edges
+  */
+static Poly_Edge_t PolyEdges[UTIL_LCD_POLY_EDGES_NBR];
+static Poly_Edge_t *PolyActive[UTIL_LCD_POLY_EDGES_NBR];
+
+/**
+  * @brief  A8 glyph cache and text coverage buffer
+  */
+static Glyph_Cache_t GlyphCache;
+static GLYPH_BUFFER(uint8_t GlyphData[UTIL_LCD_GLYPH_CACHE_SIZE]);
+static GLYPH_BUFFER(uint8_t TextBuffer[UTIL_LCD_TEXT_BUFFER_SIZE]);
 
 /**
   * @}
@@ -149,7 +303,25 @@ static LCD_UTILS_Drv_t FuncDriver;
   * @{
   */
 static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData);
+static uint32_t DrawText(uint32_t Xpos, uint32_t Ypos, const uint8_t *Text, uint32_t Count);
+static const uint8_t *GetGlyph(const sFONT *pFont, uint8_t Ascii);
+static void ExpandGlyph(const sFONT *pFont, uint8_t Ascii, uint8_t *pDst, uint32_t Pitch);
 static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color);
+static uint32_t BuildEdgeTable(pPoint Points, uint32_t PointCount);
+static void EdgeStep(Poly_Edge_t *pEdge, int32_t Lines);
+static int32_t FloorDiv(int32_t Num, int32_t Den);
+static void FillPolygonFan(pPoint Points, uint32_t PointCount, uint32_t Color);
+static uint32_t RasterBegin(uint32_t Color);
+static void RasterRun(int32_t Xpos, int32_t Ypos, int32_t Length);
+static void RasterEnd(void);
+static void RasterFlush(void);
+static void RasterFlush16(void);
+static void RasterFlush32(void);
+static void RasterLine(int32_t Xpos1, int32_t Ypos1, int32_t Xpos2, int32_t Ypos2);
+static void RasterCircle(int32_t Xpos, int32_t Ypos, int32_t Radius, uint32_t Fill);
+static void RasterCircleLines(int32_t Xpos, int32_t Ypos, int32_t XStart, int32_t XEnd, int32_t Offset, uint32_t Fill);
+static uint32_t RectsTouch(const UTIL_LCD_Rect_t *pRect1, const UTIL_LCD_Rect_t *pRect2);
+static void MergeRects(UTIL_LCD_Rect_t *pDst, const UTIL_LCD_Rect_t *pSrc);
 /**
   * @}
   */
@@ -183,6 +355,26 @@ void UTIL_LCD_SetFuncDriver(const LCD_UTILS_Drv_t *pDrv)
   FuncDriver.GetFormat(0, &DrawProp->LcdPixelFormat);
 }
 
+/**
+  * @brief  Link the optional board services to STM32 LCD Utility drivers
+  * @param  pDrv Structure of optional functions, NULL to unlink them
+  */
+void UTIL_LCD_SetExtFuncDriver(const UTIL_LCD_ExtDrv_t *pDrv)
+{
+  if(pDrv == NULL)
+  {
+    ExtFuncDriver.DrawAlpha      = NULL;
+    ExtFuncDriver.GetFrameBuffer = NULL;
+    ExtFuncDriver.Invalidate     = NULL;
+  }
+  else
+  {
+    ExtFuncDriver.DrawAlpha      = pDrv->DrawAlpha;
+    ExtFuncDriver.GetFrameBuffer = pDrv->GetFrameBuffer;
+    ExtFuncDriver.Invalidate     = pDrv->Invalidate;
+  }
+}
+
 /**
   * @brief  Set the LCD layer.
   * @param  Layer  LCD layer
@@ -194,6 +386,11 @@ void UTIL_LCD_SetLayer(uint32_t Layer)
     if(FuncDriver.SetLayer(DrawProp->LcdDevice, Layer) == 0)
     {
       DrawProp->LcdLayer = Layer;
+
+      /* The layers may differ in size and pixel format */
+      FuncDriver.GetXSize(DrawProp->LcdDevice, &DrawProp->LcdXsize);
+      FuncDriver.GetYSize(DrawProp->LcdDevice, &DrawProp->LcdYsize);
+      FuncDriver.GetFormat(DrawProp->LcdDevice, &DrawProp->LcdPixelFormat);
     }
   }
 }
@@ -229,6 +426,9 @@ uint32_t UTIL_LCD_GetTextColor(void)
 
 /**
   * @brief  Sets the LCD background color.
+  * @note   When the board provides the DrawAlpha service, a color with a null
+  *         alpha draws the text without background: the frame buffer content
+  *         is kept around the glyphs.
   * @param  Color  Layer background color code
   */
 void UTIL_LCD_SetBackColor(uint32_t Color)
@@ -274,6 +474,7 @@ void UTIL_LCD_FillRGBRect(uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t
 {
   /* Write RGB rectangle data */
   FuncDriver.FillRGBRect(DrawProp->LcdDevice, Xpos, Ypos, pData, Width, Height);
+  UTIL_LCD_AddDirtyRect(Xpos, Ypos, Width, Height);
 }
 
 /**
@@ -294,6 +495,7 @@ void UTIL_LCD_DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t
   {
     FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
   }
+  UTIL_LCD_AddDirtyRect(Xpos, Ypos, Length, 1U);
 }
 
 /**
@@ -314,6 +516,7 @@ void UTIL_LCD_DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t
   {
     FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
   }
+  UTIL_LCD_AddDirtyRect(Xpos, Ypos, 1U, Length);
 }
 
 /**
@@ -349,6 +552,7 @@ void UTIL_LCD_SetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Color)
   {
     FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, Color);
   }
+  UTIL_LCD_AddDirtyRect(Xpos, Ypos, 1U, 1U);
 }
 
 /**
@@ -380,8 +584,11 @@ void UTIL_LCD_ClearStringLine(uint32_t Line)
   */
 void UTIL_LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[DrawProp->LcdLayer].pFont->table[(Ascii-' ') *\
-  DrawProp[DrawProp->LcdLayer].pFont->Height * ((DrawProp[DrawProp->LcdLayer].pFont->Width + 7) / 8)]);
+  if(DrawText(Xpos, Ypos, &Ascii, 1U) != 0U)
+  {
+    DrawChar(Xpos, Ypos, &DrawProp[DrawProp->LcdLayer].pFont->table[(Ascii-' ') *\
+    DrawProp[DrawProp->LcdLayer].pFont->Height * ((DrawProp[DrawProp->LcdLayer].pFont->Width + 7) / 8)]);
+  }
 }
 
 /**
@@ -437,18 +644,27 @@ void UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_
     refcolumn = 1;
   }
 
-  /* Send the string character by character on LCD */
-  while ((*Text != 0) & (((DrawProp->LcdXsize - (i*DrawProp[DrawProp->LcdLayer].pFont->Width)) & 0xFFFF) >= DrawProp[DrawProp->LcdLayer].pFont->Width))
+  /* Get the number of characters fitting in the line */
+  while ((Text[i] != 0) & (((DrawProp->LcdXsize - (i*DrawProp[DrawProp->LcdLayer].pFont->Width)) & 0xFFFF) >= DrawProp[DrawProp->LcdLayer].pFont->Width))
   {
-    /* Display one character on LCD */
-    UTIL_LCD_DisplayChar(refcolumn, Ypos, *Text);
-    /* Decrement the column position by 16 */
-    refcolumn += DrawProp[DrawProp->LcdLayer].pFont->Width;
-
-    /* Point on the next character */
-    Text++;
     i++;
   }
+
+  /* Draw the whole string at once, else character by character */
+  if(DrawText(refcolumn, Ypos, Text, i) != 0U)
+  {
+    while (i > 0U)
+    {
+      /* Display one character on LCD */
+      UTIL_LCD_DisplayChar(refcolumn, Ypos, *Text);
+      /* Decrement the column position by 16 */
+      refcolumn += DrawProp[DrawProp->LcdLayer].pFont->Width;
+
+      /* Point on the next character */
+      Text++;
+      i--;
+    }
+  }
 }
 
 /**
@@ -476,6 +692,13 @@ void UTIL_LCD_DrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t
   curpixel = 0;
   int32_t x_diff, y_diff;
 
+  if(RasterBegin(Color) == 0U)
+  {
+    RasterLine((int32_t)Xpos1, (int32_t)Ypos1, (int32_t)Xpos2, (int32_t)Ypos2);
+    RasterEnd();
+    return;
+  }
+
   x_diff = Xpos2 - Xpos1;
   y_diff = Ypos2 - Ypos1;
 
@@ -572,6 +795,13 @@ void UTIL_LCD_DrawCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t
   uint32_t  current_x; /* Current X Value */
   uint32_t  current_y; /* Current Y Value */
 
+  if(RasterBegin(Color) == 0U)
+  {
+    RasterCircle((int32_t)Xpos, (int32_t)Ypos, (int32_t)Radius, 0U);
+    RasterEnd();
+    return;
+  }
+
   decision = 3 - (Radius << 1);
   current_x = 0;
   current_y = Radius;
@@ -675,7 +905,7 @@ void UTIL_LCD_DrawPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
   */
 void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t Color)
 {
-  int x_pos = 0, y_pos = -YRadius, err = 2-2*XRadius, e2;
+  int x_pos = 0, y_pos = -YRadius, err = 2-2*XRadius, e2, x_diff;
   float k = 0, rad1 = 0, rad2 = 0;
 
   rad1 = XRadius;
@@ -683,6 +913,32 @@ void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
 
   k = (float)(rad2/rad1);
 
+  if(RasterBegin(Color) == 0U)
+  {
+    do
+    {
+      x_diff = (int)(x_pos/k);
+      RasterRun(Xpos - x_diff, Ypos + y_pos, 1);
+      RasterRun(Xpos + x_diff, Ypos + y_pos, 1);
+      RasterRun(Xpos + x_diff, Ypos - y_pos, 1);
+      RasterRun(Xpos - x_diff, Ypos - y_pos, 1);
+
+      e2 = err;
+      if (e2 <= x_pos)
+      {
+        err += ++x_pos*2+1;
+        if (-y_pos == x_pos && e2 <= y_pos) e2 = 0;
+      }
+      if (e2 > y_pos)
+      {
+        err += ++y_pos*2+1;
+      }
+    }while (y_pos <= 0);
+
+    RasterEnd();
+    return;
+  }
+
   do
   {
     UTIL_LCD_SetPixel((Xpos-(uint32_t)(x_pos/k)), (Ypos + y_pos), Color);
@@ -711,7 +967,14 @@ void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
   */
 void UTIL_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pData)
 {
+  uint32_t width, height;
+
   FuncDriver.DrawBitmap(DrawProp->LcdDevice, Xpos, Ypos, pData);
+
+  /* Read bitmap width and height */
+  width  = (uint32_t)pData[18] + ((uint32_t)pData[19] << 8) + ((uint32_t)pData[20] << 16) + ((uint32_t)pData[21] << 24);
+  height = (uint32_t)pData[22] + ((uint32_t)pData[23] << 8) + ((uint32_t)pData[24] << 16) + ((uint32_t)pData[25] << 24);
+  UTIL_LCD_AddDirtyRect(Xpos, Ypos, width, height);
 }
 
 /**
@@ -733,6 +996,7 @@ void UTIL_LCD_FillRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t He
   {
     FuncDriver.FillRect(DrawProp->LcdDevice, Xpos, Ypos, Width, Height, Color);
   }
+  UTIL_LCD_AddDirtyRect(Xpos, Ypos, Width, Height);
 }
 
 /**
@@ -748,6 +1012,13 @@ void UTIL_LCD_FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t
   uint32_t  current_x; /* Current X Value */
   uint32_t  current_y; /* Current Y Value */
 
+  if(RasterBegin(Color) == 0U)
+  {
+    RasterCircle((int32_t)Xpos, (int32_t)Ypos, (int32_t)Radius, 1U);
+    RasterEnd();
+    return;
+  }
+
   decision = 3 - (Radius << 1);
 
   current_x = 0;
@@ -805,98 +1076,159 @@ void UTIL_LCD_FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t
   */
 void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
 {
-  int16_t X = 0, Y = 0, X2 = 0, Y2 = 0, x_center = 0, y_center = 0, x_first = 0, y_first = 0, pixel_x = 0, pixel_y = 0, counter = 0;
-  uint32_t  image_left = 0, image_right = 0, image_top = 0, image_bottom = 0;
-  Triangle_Positions_t positions;
+  if(PointCount == 2U)
+  {
+    /* No area: the triangle fan draws the segment, as it always did */
+    FillPolygonFan(Points, PointCount, Color);
+  }
+  else
+  {
+    UTIL_LCD_FillPolygonEx(Points, PointCount, Color, UTIL_LCD_FILL_NON_ZERO, NULL);
+  }
+}
 
-  image_left = image_right = Points->X;
-  image_top= image_bottom = Points->Y;
+/**
+  * @brief  Draws a full polygon in currently active layer, with a scanline
+  *         active edge table. Concave and self-intersecting polygons are filled
+  *         according to the fill rule.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @param  Color      Draw color
+  * @param  Rule       Fill rule
+  *          This parameter can be one of the following values:
+  *            @arg  UTIL_LCD_FILL_NON_ZERO
+  *            @arg  UTIL_LCD_FILL_EVEN_ODD
+  * @param  pClip      Clipping rectangle, NULL to clip to the display only
+  * @note   Polygons of less than 3 points have no area and are not drawn,
+  *         UTIL_LCD_FillPolygon() still draws a 2 points polygon as a segment.
+  */
+void UTIL_LCD_FillPolygonEx(pPoint Points, uint32_t PointCount, uint32_t Color, UTIL_LCD_FillRule_t Rule, const UTIL_LCD_Rect_t *pClip)
+{
+  int32_t clip_left = 0, clip_top = 0;
+  int32_t clip_right = (int32_t)DrawProp->LcdXsize - 1, clip_bottom = (int32_t)DrawProp->LcdYsize - 1;
+  int32_t y, y_end, x_start, x_end, winding, x_min, x_max;
+  uint32_t i, j, edges_nbr, next_edge = 0, active_nbr = 0;
+  uint32_t color = Color, raster;
+  Poly_Edge_t *pedge;
+
+  if(PointCount < 3U)
+  {
+    return;
+  }
 
-  for(counter = 1; counter < PointCount; counter++)
+  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
   {
-    pixel_x = POLY_X(counter);
-    if(pixel_x < image_left)
-    {
-      image_left = pixel_x;
-    }
-    if(pixel_x > image_right)
-    {
-      image_right = pixel_x;
-    }
+    color = CONVERTARGB88882RGB565(Color);
+  }
 
-    pixel_y = POLY_Y(counter);
-    if(pixel_y < image_top)
-    {
-      image_top = pixel_y;
-    }
-    if(pixel_y > image_bottom)
-    {
-      image_bottom = pixel_y;
-    }
+  if(pClip != NULL)
+  {
+    clip_left   = MAX(clip_left, (int32_t)pClip->X);
+    clip_top    = MAX(clip_top, (int32_t)pClip->Y);
+    clip_right  = MIN(clip_right, (int32_t)(pClip->X + pClip->Width) - 1);
+    clip_bottom = MIN(clip_bottom, (int32_t)(pClip->Y + pClip->Height) - 1);
   }
 
-  if(PointCount < 2)
+  edges_nbr = BuildEdgeTable(Points, PointCount);
+  if(edges_nbr > UTIL_LCD_POLY_EDGES_NBR)
   {
+    /* Edge table too small, fall back to the triangle fan */
+    FillPolygonFan(Points, PointCount, Color);
     return;
   }
 
-  x_center = (image_left + image_right)/2;
-  y_center = (image_bottom + image_top)/2;
+  if((edges_nbr == 0U) || (clip_left > clip_right) || (clip_top > clip_bottom))
+  {
+    return;
+  }
 
-  x_first = Points->X;
-  y_first = Points->Y;
+  raster = RasterBegin(Color);
 
-  while(--PointCount)
+  /* Scan the polygon lines inside the clipping rectangle */
+  y     = MAX(PolyEdges[0].YFirst, clip_top);
+  y_end = clip_bottom;
+  x_min = clip_right + 1;
+  x_max = clip_left - 1;
+
+  while(((next_edge < edges_nbr) || (active_nbr != 0U)) && (y <= y_end))
   {
-    X = Points->X;
-    Y = Points->Y;
-    Points++;
-    X2 = Points->X;
-    Y2 = Points->Y;
-    positions.x1 = X;
-    positions.y1 = Y;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = x_center;
-    positions.y3 = y_center;
-    FillTriangle(&positions, Color);
+    /* Add the edges starting on this line, moved to the line if clipped */
+    while((next_edge < edges_nbr) && (PolyEdges[next_edge].YFirst <= y))
+    {
+      pedge = &PolyEdges[next_edge++];
+      if(pedge->YLast >= y)
+      {
+        EdgeStep(pedge, y - pedge->YFirst);
+        PolyActive[active_nbr++] = pedge;
+      }
+    }
 
-    positions.x2 = x_center;
-    positions.y2 = y_center;
-    positions.x3 = X2;
-    positions.y3 = Y2;
-    FillTriangle(&positions, Color);
+    /* Remove the edges ended before this line */
+    for(i = 0, j = 0; i < active_nbr; i++)
+    {
+      if(PolyActive[i]->YLast >= y)
+      {
+        PolyActive[j++] = PolyActive[i];
+      }
+    }
+    active_nbr = j;
 
-    positions.x1 = x_center;
-    positions.y1 = y_center;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = X;
-    positions.y3 = Y;
-    FillTriangle(&positions, Color);
-  }
+    /* Sort the active edges by X, they are mostly sorted from the previous line */
+    for(i = 1; i < active_nbr; i++)
+    {
+      pedge = PolyActive[i];
+      for(j = i; (j > 0U) && POLY_EDGE_LESS(pedge, PolyActive[j - 1U]); j--)
+      {
+        PolyActive[j] = PolyActive[j - 1U];
+      }
+      PolyActive[j] = pedge;
+    }
 
-    positions.x1 = x_first;
-    positions.y1 = y_first;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = x_center;
-    positions.y3 = y_center;
-    FillTriangle(&positions, Color);
+    /* Emit the spans between the crossings, pixel centers inside are filled */
+    winding = 0;
+    for(i = 0; (i + 1U) < active_nbr; i++)
+    {
+      winding += (Rule == UTIL_LCD_FILL_EVEN_ODD) ? 1 : PolyActive[i]->Dir;
+      if(((Rule == UTIL_LCD_FILL_EVEN_ODD) && ((winding & 1) != 0)) ||
+         ((Rule != UTIL_LCD_FILL_EVEN_ODD) && (winding != 0)))
+      {
+        x_start = POLY_EDGE_PIXEL(PolyActive[i]);
+        x_end   = POLY_EDGE_PIXEL(PolyActive[i + 1U]) - 1;
+        x_start = MAX(x_start, clip_left);
+        x_end   = MIN(x_end, clip_right);
+        if(x_start <= x_end)
+        {
+          if(raster == 0U)
+          {
+            RasterRun(x_start, y, x_end - x_start + 1);
+          }
+          else
+          {
+            FuncDriver.DrawHLine(DrawProp->LcdDevice, (uint32_t)x_start, (uint32_t)y, (uint32_t)(x_end - x_start + 1), color);
+            x_min = MIN(x_min, x_start);
+            x_max = MAX(x_max, x_end);
+          }
+        }
+      }
+    }
 
-    positions.x2 = x_center;
-    positions.y2 = y_center;
-    positions.x3 = X2;
-    positions.y3 = Y2;
-    FillTriangle(&positions, Color);
+    for(i = 0; i < active_nbr; i++)
+    {
+      EdgeStep(PolyActive[i], 1);
+    }
+    y++;
+  }
 
-    positions.x1 = x_center;
-    positions.y1 = y_center;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = x_first;
-    positions.y3 = y_first;
-    FillTriangle(&positions, Color);
+  if(raster == 0U)
+  {
+    RasterEnd();
+  }
+  else if(x_min <= x_max)
+  {
+    y_end = y - 1;
+    y     = MAX(PolyEdges[0].YFirst, clip_top);
+    UTIL_LCD_AddDirtyRect((uint32_t)x_min, (uint32_t)y, (uint32_t)(x_max - x_min + 1), (uint32_t)(y_end - y + 1));
+  }
 }
 
 /**
@@ -909,7 +1241,7 @@ void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
   */
 void UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t Color)
 {
-  int x_pos = 0, y_pos = -YRadius, err = 2-2*XRadius, e2;
+  int x_pos = 0, y_pos = -YRadius, err = 2-2*XRadius, e2, x_diff;
   float k = 0, rad1 = 0, rad2 = 0;
 
   rad1 = XRadius;
@@ -917,6 +1249,35 @@ void UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
 
   k = (float)(rad2/rad1);
 
+  if(RasterBegin(Color) == 0U)
+  {
+    do
+    {
+      x_diff = (int)(x_pos/k);
+
+      e2 = err;
+      if (e2 <= x_pos)
+      {
+        err += ++x_pos*2+1;
+        if (-y_pos == x_pos && e2 <= y_pos) e2 = 0;
+      }
+      if (e2 > y_pos)
+      {
+        /* Only the widest run of a line is drawn */
+        RasterRun(Xpos - x_diff, Ypos + y_pos, (2*x_diff) + 1);
+        if(y_pos != 0)
+        {
+          RasterRun(Xpos - x_diff, Ypos - y_pos, (2*x_diff) + 1);
+        }
+        err += ++y_pos*2+1;
+      }
+    }
+    while (y_pos <= 0);
+
+    RasterEnd();
+    return;
+  }
+
   do
   {
     UTIL_LCD_DrawHLine((Xpos-(uint32_t)(x_pos/k)), (Ypos + y_pos), (2*(uint32_t)(x_pos/k) + 1), Color);
@@ -934,37 +1295,157 @@ void UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
 }
 
 /**
-  * @brief  Draws a character on LCD.
-  * @param  Xpos  Line where to display the character shape
-  * @param  Ypos  Start column address
-  * @param  pData Pointer to the character data
+  * @brief  Enables or disables the damaged rectangles tracking of the current
+  *         layer. The list of rectangles is cleared.
+  * @param  State  1 to enable the tracking, 0 to disable it
   */
-static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
+void UTIL_LCD_SetDirtyTracking(uint32_t State)
 {
-  uint32_t i = 0, j = 0, offset;
-  uint32_t height, width;
-  uint8_t  *pchar;
-  uint32_t line;
-
-  height = DrawProp[DrawProp->LcdLayer].pFont->Height;
-  width  = DrawProp[DrawProp->LcdLayer].pFont->Width;
-  uint16_t rgb565[24];
-  uint32_t argb8888[24];
+  DirtyRects[DrawProp->LcdLayer].State = State;
+  DirtyRects[DrawProp->LcdLayer].Count = 0;
+}
 
-  offset =  8 *((width + 7)/8) -  width ;
+/**
+  * @brief  Records a damaged rectangle of the current layer.
+  * @param  Xpos   X position
+  * @param  Ypos   Y position
+  * @param  Width  Rectangle width
+  * @param  Height Rectangle height
+  */
+void UTIL_LCD_AddDirtyRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  Dirty_Rects_t *dirty = &DirtyRects[DrawProp->LcdLayer];
+  UTIL_LCD_Rect_t rect;
+  uint32_t i, merged, best, growth, best_growth;
 
-  for(i = 0; i < height; i++)
+  if((dirty->State != 0U) && (Width != 0U) && (Height != 0U) &&
+     (Xpos < DrawProp->LcdXsize) && (Ypos < DrawProp->LcdYsize))
   {
-    pchar = ((uint8_t *)pData + (width + 7)/8 * i);
+    /* Clip to the display */
+    rect.X      = Xpos;
+    rect.Y      = Ypos;
+    rect.Width  = MIN(Width, DrawProp->LcdXsize - Xpos);
+    rect.Height = MIN(Height, DrawProp->LcdYsize - Ypos);
 
-    switch(((width + 7)/8))
+    do
     {
+      merged = 0;
 
-    case 1:
-      line =  pchar[0];
-      break;
+      /* Absorb an overlapping or adjacent rectangle, the union may touch other ones */
+      for(i = 0; i < dirty->Count; i++)
+      {
+        if(RectsTouch(&rect, &dirty->Rects[i]) != 0U)
+        {
+          merged = 1;
+          break;
+        }
+      }
 
-    case 2:
+      if((merged == 0U) && (dirty->Count == UTIL_LCD_DIRTY_RECTS_NBR))
+      {
+        /* List full, take the rectangle adding the least area to the union */
+        best = 0;
+        best_growth = 0xFFFFFFFFU;
+        for(i = 0; i < dirty->Count; i++)
+        {
+          UTIL_LCD_Rect_t tmp = dirty->Rects[i];
+
+          MergeRects(&tmp, &rect);
+          growth = (tmp.Width * tmp.Height) - (dirty->Rects[i].Width * dirty->Rects[i].Height);
+          if(growth < best_growth)
+          {
+            best_growth = growth;
+            best = i;
+          }
+        }
+        i = best;
+        merged = 1;
+      }
+
+      if(merged != 0U)
+      {
+        MergeRects(&rect, &dirty->Rects[i]);
+        dirty->Count--;
+        dirty->Rects[i] = dirty->Rects[dirty->Count];
+      }
+    } while(merged != 0U);
+
+    dirty->Rects[dirty->Count] = rect;
+    dirty->Count++;
+  }
+}
+
+/**
+  * @brief  Gets the damaged rectangles of the current layer.
+  * @param  pRects  Pointer to the rectangles to fill
+  * @param  MaxNbr  Maximum number of rectangles to fill
+  * @retval Number of rectangles filled, 0 when pRects is NULL
+  */
+uint32_t UTIL_LCD_GetDirtyRects(UTIL_LCD_Rect_t *pRects, uint32_t MaxNbr)
+{
+  uint32_t i, count = (pRects == NULL) ? 0U : MIN(DirtyRects[DrawProp->LcdLayer].Count, MaxNbr);
+
+  for(i = 0; i < count; i++)
+  {
+    pRects[i] = DirtyRects[DrawProp->LcdLayer].Rects[i];
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Calls a function for each damaged rectangle of the current layer
+  *         then clears the list.
+  * @param  pFlush  Function copying a rectangle to the display or back buffer
+  */
+void UTIL_LCD_FlushDirtyRects(UTIL_LCD_FlushFunc_t pFlush)
+{
+  Dirty_Rects_t *dirty = &DirtyRects[DrawProp->LcdLayer];
+  uint32_t i;
+
+  if(pFlush != NULL)
+  {
+    for(i = 0; i < dirty->Count; i++)
+    {
+      pFlush(DrawProp->LcdDevice, &dirty->Rects[i]);
+    }
+  }
+
+  dirty->Count = 0;
+}
+
+/**
+  * @brief  Draws a character on LCD.
+  * @param  Xpos  Line where to display the character shape
+  * @param  Ypos  Start column address
+  * @param  pData Pointer to the character data
+  */
+static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
+{
+  uint32_t i = 0, j = 0, offset;
+  uint32_t height, width;
+  uint8_t  *pchar;
+  uint32_t line;
+
+  height = DrawProp[DrawProp->LcdLayer].pFont->Height;
+  width  = DrawProp[DrawProp->LcdLayer].pFont->Width;
+  uint16_t rgb565[24];
+  uint32_t argb8888[24];
+
+  offset =  8 *((width + 7)/8) -  width ;
+
+  for(i = 0; i < height; i++)
+  {
+    pchar = ((uint8_t *)pData + (width + 7)/8 * i);
+
+    switch(((width + 7)/8))
+    {
+
+    case 1:
+      line =  pchar[0];
+      break;
+
+    case 2:
       line =  (pchar[0]<< 8) | pchar[1];
       break;
 
@@ -1007,6 +1488,629 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
   }
 }
 
+/**
+  * @brief  Draws characters from the A8 glyph cache, one DMA2D blending per
+  *         text buffer.
+  * @param  Xpos  X position
+  * @param  Ypos  Y position
+  * @param  Text  Pointer to the characters
+  * @param  Count Number of characters
+  * @retval 0 if drawn, 1 if the text must be drawn with DrawChar()
+  */
+static uint32_t DrawText(uint32_t Xpos, uint32_t Ypos, const uint8_t *Text, uint32_t Count)
+{
+  const sFONT *pfont = DrawProp[DrawProp->LcdLayer].pFont;
+  uint32_t width = pfont->Width, height = pfont->Height;
+  uint32_t max_count = UTIL_LCD_TEXT_BUFFER_SIZE / (width * height);
+  uint32_t nbr, pitch, i, j, k;
+  const uint8_t *pglyph;
+  uint32_t ret = 1U;
+
+  if((ExtFuncDriver.DrawAlpha != NULL) && (max_count != 0U) && (Count != 0U) &&
+     ((Xpos + (Count * width)) <= DrawProp->LcdXsize) && ((Ypos + height) <= DrawProp->LcdYsize))
+  {
+    UTIL_LCD_AddDirtyRect(Xpos, Ypos, Count * width, height);
+
+    while(Count > 0U)
+    {
+      nbr   = MIN(Count, max_count);
+      pitch = nbr * width;
+
+      /* Assemble the coverage of the characters */
+      for(i = 0; i < nbr; i++)
+      {
+        pglyph = GetGlyph(pfont, Text[i]);
+        if(pglyph == NULL)
+        {
+          ExpandGlyph(pfont, Text[i], &TextBuffer[i * width], pitch);
+        }
+        else
+        {
+          for(j = 0; j < height; j++)
+          {
+            for(k = 0; k < width; k++)
+            {
+              TextBuffer[(j * pitch) + (i * width) + k] = pglyph[(j * width) + k];
+            }
+          }
+        }
+      }
+
+      /* Blend the text color and the background in one transfer */
+      ExtFuncDriver.DrawAlpha(DrawProp->LcdDevice, Xpos, Ypos, TextBuffer, pitch, height,
+                           DrawProp[DrawProp->LcdLayer].TextColor, DrawProp[DrawProp->LcdLayer].BackColor);
+
+      Xpos  += pitch;
+      Text  += nbr;
+      Count -= nbr;
+    }
+
+    ret = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the A8 coverage of a character, expanding it in the glyph cache
+  *         on its first use.
+  * @param  pFont Font of the character
+  * @param  Ascii Character ascii code
+  * @retval Pointer to the coverage, Width bytes per line, or NULL if not cached
+  */
+static const uint8_t *GetGlyph(const sFONT *pFont, uint8_t Ascii)
+{
+  uint32_t index = (uint32_t)Ascii - (uint32_t)' ';
+  uint32_t size = (uint32_t)pFont->Width * pFont->Height;
+  const uint8_t *pglyph = NULL;
+  uint32_t i;
+
+  /* The cache holds the glyphs of a single font */
+  if(GlyphCache.pFont != pFont)
+  {
+    GlyphCache.pFont = pFont;
+    GlyphCache.Used  = 0;
+    for(i = 0; i < GLYPHS_NBR; i++)
+    {
+      GlyphCache.Offset[i] = GLYPH_NOT_CACHED;
+    }
+  }
+
+  if(index < GLYPHS_NBR)
+  {
+    if((GlyphCache.Offset[index] == GLYPH_NOT_CACHED) && ((GlyphCache.Used + size) <= UTIL_LCD_GLYPH_CACHE_SIZE))
+    {
+      ExpandGlyph(pFont, Ascii, &GlyphData[GlyphCache.Used], pFont->Width);
+      GlyphCache.Offset[index] = GlyphCache.Used;
+      GlyphCache.Used += size;
+    }
+
+    if(GlyphCache.Offset[index] != GLYPH_NOT_CACHED)
+    {
+      pglyph = &GlyphData[GlyphCache.Offset[index]];
+    }
+  }
+
+  return pglyph;
+}
+
+/**
+  * @brief  Expands a 1 bit per pixel font character to A8 coverage.
+  * @param  pFont Font of the character
+  * @param  Ascii Character ascii code
+  * @param  pDst  Pointer to the coverage
+  * @param  Pitch Coverage line length in bytes
+  */
+static void ExpandGlyph(const sFONT *pFont, uint8_t Ascii, uint8_t *pDst, uint32_t Pitch)
+{
+  uint32_t i, j;
+  uint32_t bytes = ((uint32_t)pFont->Width + 7U) / 8U;
+  const uint8_t *pchar = &pFont->table[((uint32_t)Ascii - (uint32_t)' ') * pFont->Height * bytes];
+
+  for(i = 0; i < pFont->Height; i++)
+  {
+    for(j = 0; j < pFont->Width; j++)
+    {
+      pDst[j] = ((pchar[j / 8U] & (0x80U >> (j % 8U))) != 0U) ? 0xFFU : 0x00U;
+    }
+    pchar += bytes;
+    pDst  += Pitch;
+  }
+}
+
+/**
+  * @brief  Builds the polygon edge table, sorted by first scanline. Horizontal
+  *         edges are skipped.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @retval Number of edges, greater than UTIL_LCD_POLY_EDGES_NBR if they do not fit
+  */
+static uint32_t BuildEdgeTable(pPoint Points, uint32_t PointCount)
+{
+  int32_t x1, y1, x2, y2;
+  uint32_t i, j, edges_nbr = 0;
+  Poly_Edge_t edge;
+
+  for(i = 0; i < PointCount; i++)
+  {
+    x1 = POLY_X(i);
+    y1 = POLY_Y(i);
+    x2 = POLY_X((i + 1U) % PointCount);
+    y2 = POLY_Y((i + 1U) % PointCount);
+
+    if(y1 == y2)
+    {
+      continue;
+    }
+
+    if(edges_nbr == UTIL_LCD_POLY_EDGES_NBR)
+    {
+      return UTIL_LCD_POLY_EDGES_NBR + 1U;
+    }
+
+    /* Orient the edge downward, keeping its direction for the non-zero rule */
+    edge.Dir = 1;
+    if(y1 > y2)
+    {
+      edge.Dir = -1;
+      x1 = POLY_X((i + 1U) % PointCount);
+      y1 = POLY_Y((i + 1U) % PointCount);
+      x2 = POLY_X(i);
+      y2 = POLY_Y(i);
+    }
+
+    /* Scanlines are sampled at the pixel centers: the first one is y1, the last
+       one is y2 - 1 and X is computed half a line below the vertex. X is kept
+       exact so that pixel centers lying on an edge are always filled the same way */
+    edge.Den     = 2 * (y2 - y1);
+    edge.X       = x1 + FloorDiv(x2 - x1, edge.Den);
+    edge.Rem     = (x2 - x1) - ((edge.X - x1) * edge.Den);
+    edge.XStep   = FloorDiv(2 * (x2 - x1), edge.Den);
+    edge.RemStep = (2 * (x2 - x1)) - (edge.XStep * edge.Den);
+    edge.YFirst  = y1;
+    edge.YLast   = y2 - 1;
+
+    /* Insert sorted by first scanline */
+    for(j = edges_nbr; (j > 0U) && (PolyEdges[j - 1U].YFirst > edge.YFirst); j--)
+    {
+      PolyEdges[j] = PolyEdges[j - 1U];
+    }
+    PolyEdges[j] = edge;
+    edges_nbr++;
+  }
+
+  return edges_nbr;
+}
+
+/**
+  * @brief  Moves a polygon edge down by a number of scanlines.
+  * @param  pEdge Pointer to the edge
+  * @param  Lines Number of scanlines
+  */
+static void EdgeStep(Poly_Edge_t *pEdge, int32_t Lines)
+{
+  int64_t rem = pEdge->Rem + ((int64_t)pEdge->RemStep * Lines);
+
+  pEdge->X  += (pEdge->XStep * Lines) + (int32_t)(rem / pEdge->Den);
+  pEdge->Rem = (int32_t)(rem % pEdge->Den);
+}
+
+/**
+  * @brief  Divides rounding toward minus infinity.
+  * @param  Num Numerator
+  * @param  Den Denominator, greater than 0
+  * @retval Quotient
+  */
+static int32_t FloorDiv(int32_t Num, int32_t Den)
+{
+  int32_t quotient = Num / Den;
+
+  if(((Num % Den) != 0) && (Num < 0))
+  {
+    quotient--;
+  }
+
+  return quotient;
+}
+
+/**
+  * @brief  Draws a full polygon as triangles around its bounding box center.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @param  Color      Draw color
+  */
+static void FillPolygonFan(pPoint Points, uint32_t PointCount, uint32_t Color)
+{
+  int16_t X = 0, Y = 0, X2 = 0, Y2 = 0, x_center = 0, y_center = 0, x_first = 0, y_first = 0, pixel_x = 0, pixel_y = 0, counter = 0;
+  uint32_t  image_left = 0, image_right = 0, image_top = 0, image_bottom = 0;
+  Triangle_Positions_t positions;
+
+  image_left = image_right = Points->X;
+  image_top= image_bottom = Points->Y;
+
+  for(counter = 1; counter < PointCount; counter++)
+  {
+    pixel_x = POLY_X(counter);
+    if(pixel_x < image_left)
+    {
+      image_left = pixel_x;
+    }
+    if(pixel_x > image_right)
+    {
+      image_right = pixel_x;
+    }
+
+    pixel_y = POLY_Y(counter);
+    if(pixel_y < image_top)
+    {
+      image_top = pixel_y;
+    }
+    if(pixel_y > image_bottom)
+    {
+      image_bottom = pixel_y;
+    }
+  }
+
+  if(PointCount < 2)
+  {
+    return;
+  }
+
+  x_center = (image_left + image_right)/2;
+  y_center = (image_bottom + image_top)/2;
+
+  x_first = Points->X;
+  y_first = Points->Y;
+
+  while(--PointCount)
+  {
+    X = Points->X;
+    Y = Points->Y;
+    Points++;
+    X2 = Points->X;
+    Y2 = Points->Y;
+    positions.x1 = X;
+    positions.y1 = Y;
+    positions.x2 = X2;
+    positions.y2 = Y2;
+    positions.x3 = x_center;
+    positions.y3 = y_center;
+    FillTriangle(&positions, Color);
+
+    positions.x2 = x_center;
+    positions.y2 = y_center;
+    positions.x3 = X2;
+    positions.y3 = Y2;
+    FillTriangle(&positions, Color);
+
+    positions.x1 = x_center;
+    positions.y1 = y_center;
+    positions.x2 = X2;
+    positions.y2 = Y2;
+    positions.x3 = X;
+    positions.y3 = Y;
+    FillTriangle(&positions, Color);
+  }
+
+    positions.x1 = x_first;
+    positions.y1 = y_first;
+    positions.x2 = X2;
+    positions.y2 = Y2;
+    positions.x3 = x_center;
+    positions.y3 = y_center;
+    FillTriangle(&positions, Color);
+
+    positions.x2 = x_center;
+    positions.y2 = y_center;
+    positions.x3 = X2;
+    positions.y3 = Y2;
+    FillTriangle(&positions, Color);
+
+    positions.x1 = x_center;
+    positions.y1 = y_center;
+    positions.x2 = X2;
+    positions.y2 = Y2;
+    positions.x3 = x_first;
+    positions.y3 = y_first;
+    FillTriangle(&positions, Color);
+}
+
+/**
+  * @brief  Starts drawing with the raster backend.
+  * @param  Color Draw color
+  * @retval 0 if the frame buffer is directly accessible, else 1
+  */
+static uint32_t RasterBegin(uint32_t Color)
+{
+  uint32_t ret = 1U;
+
+  /* The runs are copied in 16 or 32 bpp only */
+  if((ExtFuncDriver.GetFrameBuffer != NULL) &&
+     ((DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565) || (DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_ARGB8888) ||
+      (DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB888)))
+  {
+    if(ExtFuncDriver.GetFrameBuffer(DrawProp->LcdDevice, &Raster.Address) == 0)
+    {
+      if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+      {
+        Raster.Color = CONVERTARGB88882RGB565(Color);
+      }
+      else
+      {
+        Raster.Color = Color;
+      }
+      Raster.Count = 0;
+      Raster.XMin  = (int32_t)DrawProp->LcdXsize;
+      Raster.YMin  = (int32_t)DrawProp->LcdYsize;
+      Raster.XMax  = -1;
+      Raster.YMax  = -1;
+      ret = 0U;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Adds a horizontal run, clipped to the display. It is merged with the
+  *         previous run when they are adjacent on the same line.
+  * @param  Xpos   X position of the leftmost pixel
+  * @param  Ypos   Y position
+  * @param  Length Run length
+  */
+static void RasterRun(int32_t Xpos, int32_t Ypos, int32_t Length)
+{
+  int32_t x_start = MAX(Xpos, 0);
+  int32_t x_end = MIN(Xpos + Length, (int32_t)DrawProp->LcdXsize) - 1;
+  Raster_Run_t *prun = (Raster.Count != 0U) ? &Raster.Runs[Raster.Count - 1U] : NULL;
+
+  if((Ypos < 0) || (Ypos >= (int32_t)DrawProp->LcdYsize) || (x_start > x_end))
+  {
+    return;
+  }
+
+  if((prun != NULL) && (prun->Y == Ypos) &&
+     (x_start <= (prun->X + prun->Length)) && (x_end >= (prun->X - 1)))
+  {
+    x_end      = MAX(x_end, prun->X + prun->Length - 1);
+    prun->X      = (int16_t)MIN(x_start, prun->X);
+    prun->Length = (uint16_t)(x_end - prun->X + 1);
+  }
+  else
+  {
+    if(Raster.Count == UTIL_LCD_RASTER_RUNS_NBR)
+    {
+      RasterFlush();
+    }
+    prun = &Raster.Runs[Raster.Count++];
+    prun->X      = (int16_t)x_start;
+    prun->Y      = (int16_t)Ypos;
+    prun->Length = (uint16_t)(x_end - x_start + 1);
+  }
+
+  Raster.XMin = MIN(Raster.XMin, x_start);
+  Raster.XMax = MAX(Raster.XMax, x_end);
+  Raster.YMin = MIN(Raster.YMin, Ypos);
+  Raster.YMax = MAX(Raster.YMax, Ypos);
+}
+
+/**
+  * @brief  Writes the batched runs, records the damaged area and reports it
+  *         to the board driver, which did not see the CPU writes.
+  */
+static void RasterEnd(void)
+{
+  RasterFlush();
+
+  if(Raster.XMin <= Raster.XMax)
+  {
+    if(ExtFuncDriver.Invalidate != NULL)
+    {
+      (void)ExtFuncDriver.Invalidate(DrawProp->LcdDevice, (uint32_t)Raster.XMin, (uint32_t)Raster.YMin,
+                                  (uint32_t)(Raster.XMax - Raster.XMin + 1), (uint32_t)(Raster.YMax - Raster.YMin + 1));
+    }
+    UTIL_LCD_AddDirtyRect((uint32_t)Raster.XMin, (uint32_t)Raster.YMin,
+                          (uint32_t)(Raster.XMax - Raster.XMin + 1), (uint32_t)(Raster.YMax - Raster.YMin + 1));
+  }
+}
+
+/**
+  * @brief  Writes the batched runs with the copy loop of the layer pixel format.
+  */
+static void RasterFlush(void)
+{
+  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+  {
+    RasterFlush16();
+  }
+  else
+  {
+    RasterFlush32();
+  }
+  Raster.Count = 0;
+}
+
+/**
+  * @brief  Writes the batched runs in a 16 bpp frame buffer.
+  */
+static void RasterFlush16(void)
+{
+  uint32_t i, length;
+  uint16_t *ppixel;
+  const Raster_Run_t *prun = Raster.Runs;
+
+  for(i = 0; i < Raster.Count; i++, prun++)
+  {
+    if(prun->Length >= UTIL_LCD_RASTER_DMA2D_LENGTH)
+    {
+      FuncDriver.DrawHLine(DrawProp->LcdDevice, (uint32_t)prun->X, (uint32_t)prun->Y, prun->Length, Raster.Color);
+    }
+    else
+    {
+      ppixel = (uint16_t *)Raster.Address + (((uint32_t)prun->Y * DrawProp->LcdXsize) + (uint32_t)prun->X);
+      for(length = prun->Length; length > 0U; length--)
+      {
+        *ppixel++ = (uint16_t)Raster.Color;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Writes the batched runs in a 32 bpp frame buffer.
+  */
+static void RasterFlush32(void)
+{
+  uint32_t i, length;
+  uint32_t *ppixel;
+  const Raster_Run_t *prun = Raster.Runs;
+
+  for(i = 0; i < Raster.Count; i++, prun++)
+  {
+    if(prun->Length >= UTIL_LCD_RASTER_DMA2D_LENGTH)
+    {
+      FuncDriver.DrawHLine(DrawProp->LcdDevice, (uint32_t)prun->X, (uint32_t)prun->Y, prun->Length, Raster.Color);
+    }
+    else
+    {
+      ppixel = (uint32_t *)Raster.Address + (((uint32_t)prun->Y * DrawProp->LcdXsize) + (uint32_t)prun->X);
+      for(length = prun->Length; length > 0U; length--)
+      {
+        *ppixel++ = Raster.Color;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Rasterizes a line to runs, one run per line crossed when the line is
+  *         mostly horizontal.
+  * @param  Xpos1 Point 1 X position
+  * @param  Ypos1 Point 1 Y position
+  * @param  Xpos2 Point 2 X position
+  * @param  Ypos2 Point 2 Y position
+  */
+static void RasterLine(int32_t Xpos1, int32_t Ypos1, int32_t Xpos2, int32_t Ypos2)
+{
+  int32_t deltax = ABS(Xpos2 - Xpos1), deltay = ABS(Ypos2 - Ypos1);
+  int32_t xinc = (Xpos2 >= Xpos1) ? 1 : -1, yinc = (Ypos2 >= Ypos1) ? 1 : -1;
+  int32_t x = Xpos1, y = Ypos1, num, run_x = Xpos1, i;
+
+  if(deltax >= deltay)
+  {
+    num = deltax / 2;
+    for(i = 0; i <= deltax; i++)
+    {
+      num += deltay;
+      if((num >= deltax) || (i == deltax))
+      {
+        /* Last pixel of the line crossed, draw from run_x to x */
+        RasterRun(MIN(run_x, x), y, ABS(x - run_x) + 1);
+        if(num >= deltax)
+        {
+          num -= deltax;
+          y += yinc;
+        }
+        run_x = x + xinc;
+      }
+      x += xinc;
+    }
+  }
+  else
+  {
+    num = deltay / 2;
+    for(i = 0; i <= deltay; i++)
+    {
+      RasterRun(x, y, 1);
+      num += deltax;
+      if(num >= deltay)
+      {
+        num -= deltay;
+        x += xinc;
+      }
+      y += yinc;
+    }
+  }
+}
+
+/**
+  * @brief  Rasterizes a circle or a disc to runs. The lines of the top and
+  *         bottom octants are drawn as a single run.
+  * @param  Xpos   X position
+  * @param  Ypos   Y position
+  * @param  Radius Circle radius
+  * @param  Fill   1 for a disc, 0 for a circle
+  */
+static void RasterCircle(int32_t Xpos, int32_t Ypos, int32_t Radius, uint32_t Fill)
+{
+  int32_t decision = 3 - (Radius << 1);
+  int32_t current_x = 0, current_y = Radius, run_x = 0;
+
+  while (current_x <= current_y)
+  {
+    /* Left and right octants, one pixel per line */
+    if(Fill != 0U)
+    {
+      RasterRun(Xpos - current_y, Ypos - current_x, (2*current_y) + 1);
+      if(current_x != 0)
+      {
+        RasterRun(Xpos - current_y, Ypos + current_x, (2*current_y) + 1);
+      }
+    }
+    else
+    {
+      RasterRun(Xpos - current_y, Ypos - current_x, 1);
+      RasterRun(Xpos + current_y, Ypos - current_x, 1);
+      RasterRun(Xpos - current_y, Ypos + current_x, 1);
+      RasterRun(Xpos + current_y, Ypos + current_x, 1);
+    }
+
+    if (decision < 0)
+    {
+      decision += (current_x << 2) + 6;
+    }
+    else
+    {
+      /* Top and bottom octants, the line is left: draw it */
+      RasterCircleLines(Xpos, Ypos, run_x, current_x, current_y, Fill);
+      decision += (4 * (current_x - current_y)) + 10;
+      current_y--;
+      run_x = current_x + 1;
+    }
+    current_x++;
+  }
+
+  if(run_x < current_x)
+  {
+    RasterCircleLines(Xpos, Ypos, run_x, current_x - 1, current_y, Fill);
+  }
+}
+
+/**
+  * @brief  Adds the runs of a top and bottom octants line of a circle or a disc.
+  * @param  Xpos   X position of the center
+  * @param  Ypos   Y position of the center
+  * @param  XStart First X offset of the line
+  * @param  XEnd   Last X offset of the line
+  * @param  Offset Y offset of the line
+  * @param  Fill   1 for a disc, 0 for a circle
+  */
+static void RasterCircleLines(int32_t Xpos, int32_t Ypos, int32_t XStart, int32_t XEnd, int32_t Offset, uint32_t Fill)
+{
+  if(Fill != 0U)
+  {
+    RasterRun(Xpos - XEnd, Ypos - Offset, (2*XEnd) + 1);
+    RasterRun(Xpos - XEnd, Ypos + Offset, (2*XEnd) + 1);
+  }
+  else
+  {
+    RasterRun(Xpos - XEnd, Ypos - Offset, XEnd - XStart + 1);
+    RasterRun(Xpos + XStart, Ypos - Offset, XEnd - XStart + 1);
+    RasterRun(Xpos - XEnd, Ypos + Offset, XEnd - XStart + 1);
+    RasterRun(Xpos + XStart, Ypos + Offset, XEnd - XStart + 1);
+  }
+}
+
 /**
   * @brief  Fills a triangle (between 3 points).
   * @param  Positions  pointer to riangle coordinates
@@ -1084,6 +2188,44 @@ static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color)
   }
 }
 
+/**
+  * @brief  Checks if two rectangles overlap or share an edge. Rectangles
+  *         touching by a corner only are not merged, so that a diagonal drawn
+  *         pixel by pixel does not grow to its bounding box.
+  * @param  pRect1  First rectangle
+  * @param  pRect2  Second rectangle
+  * @retval 1 if the rectangles touch, 0 otherwise
+  */
+static uint32_t RectsTouch(const UTIL_LCD_Rect_t *pRect1, const UTIL_LCD_Rect_t *pRect2)
+{
+  uint32_t overlap_x = ((pRect1->X < (pRect2->X + pRect2->Width)) && (pRect2->X < (pRect1->X + pRect1->Width))) ? 1U : 0U;
+  uint32_t overlap_y = ((pRect1->Y < (pRect2->Y + pRect2->Height)) && (pRect2->Y < (pRect1->Y + pRect1->Height))) ? 1U : 0U;
+  uint32_t adjacent_x = ((pRect1->X <= (pRect2->X + pRect2->Width)) && (pRect2->X <= (pRect1->X + pRect1->Width))) ? 1U : 0U;
+  uint32_t adjacent_y = ((pRect1->Y <= (pRect2->Y + pRect2->Height)) && (pRect2->Y <= (pRect1->Y + pRect1->Height))) ? 1U : 0U;
+
+  /* Overlap on one axis, overlap or adjacency on the other */
+  return (((overlap_x == 1U) && (adjacent_y == 1U)) || ((adjacent_x == 1U) && (overlap_y == 1U))) ? 1U : 0U;
+}
+
+/**
+  * @brief  Extends a rectangle to the bounding box of itself and another one.
+  * @param  pDst  Rectangle to extend
+  * @param  pSrc  Rectangle to include
+  */
+static void MergeRects(UTIL_LCD_Rect_t *pDst, const UTIL_LCD_Rect_t *pSrc)
+{
+  uint32_t x2 = pDst->X + pDst->Width;
+  uint32_t y2 = pDst->Y + pDst->Height;
+
+  x2 = (x2 > (pSrc->X + pSrc->Width))  ? x2 : (pSrc->X + pSrc->Width);
+  y2 = (y2 > (pSrc->Y + pSrc->Height)) ? y2 : (pSrc->Y + pSrc->Height);
+
+  pDst->X      = MIN(pDst->X, pSrc->X);
+  pDst->Y      = MIN(pDst->Y, pSrc->Y);
+  pDst->Width  = x2 - pDst->X;
+  pDst->Height = y2 - pDst->Y;
+}
+
 /**
   * @}
   */
@@ -152,6 +152,42 @@ typedef enum
   LEFT_MODE               = 0x03     /*!< Left mode   */
 } Text_AlignModeTypdef;
 
+/**
+  * @brief  LCD Utility polygon fill rule definitions
+  */
+typedef enum
+{
+  UTIL_LCD_FILL_NON_ZERO  = 0x00,    /*!< Fill where the winding number is not zero */
+  UTIL_LCD_FILL_EVEN_ODD  = 0x01     /*!< Fill where the crossing count is odd      */
+} UTIL_LCD_FillRule_t;
+
+/**
+  * @brief  LCD Utility optional board services, not part of the LCD component
+  *         interface. Each entry may be NULL.
+  */
+typedef struct
+{
+  int32_t ( *DrawAlpha       ) (uint32_t, uint32_t, uint32_t, const uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t);
+  int32_t ( *GetFrameBuffer  ) (uint32_t, uint32_t *);
+  int32_t ( *Invalidate      ) (uint32_t, uint32_t, uint32_t, uint32_t, uint32_t);
+} UTIL_LCD_ExtDrv_t;
+
+/**
+  * @brief  LCD Utility rectangle definition
+  */
+typedef struct
+{
+  uint32_t X;      /*!< X position of the top left corner */
+  uint32_t Y;      /*!< Y position of the top left corner */
+  uint32_t Width;  /*!< Rectangle width                   */
+  uint32_t Height; /*!< Rectangle height                  */
+} UTIL_LCD_Rect_t;
+
+/**
+  * @brief  LCD Utility damaged rectangle flush function
+  */
+typedef void (*UTIL_LCD_FlushFunc_t)(uint32_t Device, const UTIL_LCD_Rect_t *pRect);
+
 /**
   * @}
   */
@@ -160,6 +196,7 @@ typedef enum
   * @{
   */
 void     UTIL_LCD_SetFuncDriver(const LCD_UTILS_Drv_t *pDrv);
+void     UTIL_LCD_SetExtFuncDriver(const UTIL_LCD_ExtDrv_t *pDrv);
 
 void     UTIL_LCD_SetLayer(uint32_t Layer);
 void     UTIL_LCD_SetDevice(uint32_t Device);
@@ -190,8 +227,14 @@ void     UTIL_LCD_DrawPolygon(pPoint Points, uint32_t PointCount, uint32_t Color
 void     UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t Color);
 void     UTIL_LCD_FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color);
 void     UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color);
+void     UTIL_LCD_FillPolygonEx(pPoint Points, uint32_t PointCount, uint32_t Color, UTIL_LCD_FillRule_t Rule, const UTIL_LCD_Rect_t *pClip);
 void     UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t Color);
 
+void     UTIL_LCD_SetDirtyTracking(uint32_t State);
+void     UTIL_LCD_AddDirtyRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+uint32_t UTIL_LCD_GetDirtyRects(UTIL_LCD_Rect_t *pRects, uint32_t MaxNbr);
+void     UTIL_LCD_FlushDirtyRects(UTIL_LCD_FlushFunc_t pFlush);
+
 /**
   * @}
   */